@@ -28,6 +28,7 @@
 #include "Platform.h"
 #include "GPU.h"
 #include "ARMJIT_Memory.h"
+#include "MelonPrimeProfile.h"
 
 namespace melonDS
 {
@@ -57,6 +58,8 @@ void ARM::GdbCheckB()
 }
 void ARM::GdbCheckC()
 {
+    GdbCheckD();
+
     u32 pc_real = R[15] - ((CPSR & 0x20) ? 2 : 4);
     Gdb::StubState st = GdbStub.CheckBkpt(pc_real, true, true);
     if (st != Gdb::StubState::CheckNoHit)
@@ -66,10 +69,52 @@ void ARM::GdbCheckC()
     }
     else GdbCheckB();
 }
+void ARM::GdbCheckD()
+{
+    if (GdbWatchHit)
+    { // a watched access was made, R15 is past the instruction making it
+        GdbWatchHit = false;
+        Gdb::StubState st = GdbStub.CheckWatchpt(GdbWatchAddr, GdbWatchLen, GdbWatchKind, true, true);
+        if (st != Gdb::StubState::CheckNoHit)
+        {
+            IsSingleStep = st == Gdb::StubState::Step;
+            BreakReq = st == Gdb::StubState::Attach || st == Gdb::StubState::Break;
+        }
+    }
+}
+bool ARM::GdbMustStepJIT(u32 addr, bool hasBlock) const
+{
+    // blocks never start at a breakpoint, so only a missing block can be one
+    return IsSingleStep || BreakReq || (!hasBlock && GdbStub.HasBkpt(addr));
+}
+
+void ARM::GdbWatchAccess(u32 addr, u32 size, bool write)
+{
+    if (!GdbWatchHit && GdbStub.FindWatchpt(addr, size, write ? 2 : 3))
+    {
+        GdbWatchHit = true;
+        GdbWatchAddr = addr;
+        GdbWatchLen = size;
+        GdbWatchKind = write ? 2 : 3;
+    }
+}
+
+void ARM::BreakpointsChanged()
+{
+    GdbWatching = GdbStub.HasWatchpts();
+#ifdef JIT_ENABLED
+    // compiled blocks have to end before the new breakpoints, and fastmem has
+    // to fault on the newly watched pages
+    if (NDS.IsJITEnabled())
+        NDS.JIT.ResetBlockCache();
+#endif
+}
 #else
 void ARM::GdbCheckA() {}
 void ARM::GdbCheckB() {}
 void ARM::GdbCheckC() {}
+void ARM::GdbCheckD() {}
+bool ARM::GdbMustStepJIT(u32 addr, bool hasBlock) const { return false; }
 #endif
 
 
@@ -107,7 +152,7 @@ const u32 ARM::ConditionTable[16] =
     0x0000  // NE
 };
 
-ARM::ARM(u32 num, bool jit, std::optional<GDBArgs> gdb, melonDS::NDS& nds) :
+ARM::ARM(u32 num, std::optional<GDBArgs> gdb, melonDS::NDS& nds) :
 #ifdef GDBSTUB_ENABLED
     GdbStub(this),
     BreakOnStartup(false),
@@ -115,7 +160,7 @@ ARM::ARM(u32 num, bool jit, std::optional<GDBArgs> gdb, melonDS::NDS& nds) :
     Num(num), // well uh
     NDS(nds)
 {
-    SetGdbArgs(jit ? std::nullopt : gdb);
+    SetGdbArgs(gdb);
 }
 
 ARM::~ARM()
@@ -123,14 +168,14 @@ ARM::~ARM()
     // dorp
 }
 
-ARMv5::ARMv5(melonDS::NDS& nds, std::optional<GDBArgs> gdb, bool jit) : ARM(0, jit, gdb, nds)
+ARMv5::ARMv5(melonDS::NDS& nds, std::optional<GDBArgs> gdb) : ARM(0, gdb, nds)
 {
     DTCM = NDS.JIT.Memory.GetARM9DTCM();
 
     PU_Map = PU_PrivMap;
 }
 
-ARMv4::ARMv4(melonDS::NDS& nds, std::optional<GDBArgs> gdb, bool jit) : ARM(1, jit, gdb, nds)
+ARMv4::ARMv4(melonDS::NDS& nds, std::optional<GDBArgs> gdb) : ARM(1, gdb, nds)
 {
     //
 }
@@ -617,7 +662,7 @@ void ARMv5::Execute()
     while (NDS.ARM9Timestamp < NDS.ARM9Target)
     {
 #ifdef JIT_ENABLED
-        if constexpr (mode == CPUExecuteMode::JIT)
+        if constexpr (mode == CPUExecuteMode::JIT || mode == CPUExecuteMode::JITGDB)
         {
             u32 instrAddr = R[15] - ((CPSR&0x20)?2:4);
 
@@ -631,11 +676,26 @@ void ARMv5::Execute()
 
             JitBlockEntry block = NDS.JIT.LookUpBlock(0, FastBlockLookup,
                 instrAddr - FastBlockLookupStart, instrAddr);
-            if (block)
-                ARM_Dispatch(this, block);
+            if (mode == CPUExecuteMode::JITGDB && GdbMustStepJIT(instrAddr, block != nullptr))
+                GdbStepJIT();
+            else if (block)
+            {
+                if (MelonPrimeProfile::IsEnabled())
+                {
+                    // the block adds to Cycles, the timestamp catches up below
+                    s32 start = Cycles;
+                    ARM_Dispatch(this, block);
+                    MelonPrimeProfile::Record(0, instrAddr, (u64)(Cycles - start), IdleLoop);
+                }
+                else
+                    ARM_Dispatch(this, block);
+            }
             else
                 NDS.JIT.CompileBlock(this);
 
+            if constexpr (mode == CPUExecuteMode::JITGDB)
+                GdbCheckD();
+
             if (StopExecution)
             {
                 // this order is crucial otherwise idle loops waiting for an IRQ won't function
@@ -733,6 +793,21 @@ template void ARMv5::Execute<CPUExecuteMode::Interpreter>();
 template void ARMv5::Execute<CPUExecuteMode::InterpreterGDB>();
 #ifdef JIT_ENABLED
 template void ARMv5::Execute<CPUExecuteMode::JIT>();
+template void ARMv5::Execute<CPUExecuteMode::JITGDB>();
+
+void ARMv5::GdbStepJIT()
+{
+    // runs a single instruction in the interpreter, stopping before it for
+    // breakpoints and single-steps like InterpreterGDB does; the JIT doesn't
+    // keep the pipeline filled
+    FillPipeline();
+    GdbCheckC();
+
+    u64 target = NDS.ARM9Target;
+    NDS.ARM9Target = NDS.ARM9Timestamp + 1;
+    Execute<CPUExecuteMode::Interpreter>();
+    NDS.ARM9Target = target;
+}
 #endif
 
 template <CPUExecuteMode mode>
@@ -763,7 +838,7 @@ void ARMv4::Execute()
     while (NDS.ARM7Timestamp < NDS.ARM7Target)
     {
 #ifdef JIT_ENABLED
-        if constexpr (mode == CPUExecuteMode::JIT)
+        if constexpr (mode == CPUExecuteMode::JIT || mode == CPUExecuteMode::JITGDB)
         {
             u32 instrAddr = R[15] - ((CPSR&0x20)?2:4);
 
@@ -777,11 +852,26 @@ void ARMv4::Execute()
 
             JitBlockEntry block = NDS.JIT.LookUpBlock(1, FastBlockLookup,
                 instrAddr - FastBlockLookupStart, instrAddr);
-            if (block)
-                ARM_Dispatch(this, block);
+            if (mode == CPUExecuteMode::JITGDB && GdbMustStepJIT(instrAddr, block != nullptr))
+                GdbStepJIT();
+            else if (block)
+            {
+                if (MelonPrimeProfile::IsEnabled())
+                {
+                    // the block adds to Cycles, the timestamp catches up below
+                    s32 start = Cycles;
+                    ARM_Dispatch(this, block);
+                    MelonPrimeProfile::Record(1, instrAddr, (u64)(Cycles - start), IdleLoop);
+                }
+                else
+                    ARM_Dispatch(this, block);
+            }
             else
                 NDS.JIT.CompileBlock(this);
 
+            if constexpr (mode == CPUExecuteMode::JITGDB)
+                GdbCheckD();
+
             if (StopExecution)
             {
                 if (IRQ)
@@ -875,6 +965,21 @@ template void ARMv4::Execute<CPUExecuteMode::Interpreter>();
 template void ARMv4::Execute<CPUExecuteMode::InterpreterGDB>();
 #ifdef JIT_ENABLED
 template void ARMv4::Execute<CPUExecuteMode::JIT>();
+template void ARMv4::Execute<CPUExecuteMode::JITGDB>();
+
+void ARMv4::GdbStepJIT()
+{
+    // runs a single instruction in the interpreter, stopping before it for
+    // breakpoints and single-steps like InterpreterGDB does; the JIT doesn't
+    // keep the pipeline filled
+    FillPipeline();
+    GdbCheckC();
+
+    u64 target = NDS.ARM7Target;
+    NDS.ARM7Target = NDS.ARM7Timestamp + 1;
+    Execute<CPUExecuteMode::Interpreter>();
+    NDS.ARM7Target = target;
+}
 #endif
 
 void ARMv5::FillPipeline()
@@ -1127,6 +1232,8 @@ u32 ARMv5::ReadMem(u32 addr, int size)
 
 void ARMv4::DataRead8(u32 addr, u32* val)
 {
+    GdbCheckData(addr, 1, false);
+
     *val = BusRead8(addr);
     DataRegion = addr;
     DataCycles = NDS.ARM7MemTimings[addr >> 15][0];
@@ -1135,6 +1242,7 @@ void ARMv4::DataRead8(u32 addr, u32* val)
 void ARMv4::DataRead16(u32 addr, u32* val)
 {
     addr &= ~1;
+    GdbCheckData(addr, 2, false);
 
     *val = BusRead16(addr);
     DataRegion = addr;
@@ -1144,6 +1252,7 @@ void ARMv4::DataRead16(u32 addr, u32* val)
 void ARMv4::DataRead32(u32 addr, u32* val)
 {
     addr &= ~3;
+    GdbCheckData(addr, 4, false);
 
     *val = BusRead32(addr);
     DataRegion = addr;
@@ -1153,6 +1262,7 @@ void ARMv4::DataRead32(u32 addr, u32* val)
 void ARMv4::DataRead32S(u32 addr, u32* val)
 {
     addr &= ~3;
+    GdbCheckData(addr, 4, false);
 
     *val = BusRead32(addr);
     DataCycles += NDS.ARM7MemTimings[addr >> 15][3];
@@ -1160,6 +1270,8 @@ void ARMv4::DataRead32S(u32 addr, u32* val)
 
 void ARMv4::DataWrite8(u32 addr, u8 val)
 {
+    GdbCheckData(addr, 1, true);
+
     BusWrite8(addr, val);
     DataRegion = addr;
     DataCycles = NDS.ARM7MemTimings[addr >> 15][0];
@@ -1168,6 +1280,7 @@ void ARMv4::DataWrite8(u32 addr, u8 val)
 void ARMv4::DataWrite16(u32 addr, u16 val)
 {
     addr &= ~1;
+    GdbCheckData(addr, 2, true);
 
     BusWrite16(addr, val);
     DataRegion = addr;
@@ -1177,6 +1290,7 @@ void ARMv4::DataWrite16(u32 addr, u16 val)
 void ARMv4::DataWrite32(u32 addr, u32 val)
 {
     addr &= ~3;
+    GdbCheckData(addr, 4, true);
 
     BusWrite32(addr, val);
     DataRegion = addr;
@@ -1186,6 +1300,7 @@ void ARMv4::DataWrite32(u32 addr, u32 val)
 void ARMv4::DataWrite32S(u32 addr, u32 val)
 {
     addr &= ~3;
+    GdbCheckData(addr, 4, true);
 
     BusWrite32(addr, val);
     DataCycles += NDS.ARM7MemTimings[addr >> 15][3];
@@ -48,7 +48,8 @@ enum class CPUExecuteMode : u32
     Interpreter,
     InterpreterGDB,
 #ifdef JIT_ENABLED
-    JIT
+    JIT,
+    JITGDB
 #endif
 };
 
@@ -65,7 +66,7 @@ class ARM
 #endif
 {
 public:
-    ARM(u32 num, bool jit, std::optional<GDBArgs> gdb, NDS& nds);
+    ARM(u32 num, std::optional<GDBArgs> gdb, NDS& nds);
     virtual ~ARM(); // destroy shit
 
     void SetGdbArgs(std::optional<GDBArgs> gdb);
@@ -151,6 +152,15 @@ public:
 
     void CheckGdbIncoming();
 
+    // data accesses are checked against the stub's watchpoints while it has any
+    void GdbCheckData(u32 addr, u32 size, bool write)
+    {
+#ifdef GDBSTUB_ENABLED
+        if (GdbWatching)
+            GdbWatchAccess(addr, size, write);
+#endif
+    }
+
     u32 Num;
 
     s32 Cycles;
@@ -210,6 +220,15 @@ protected:
     bool BreakOnStartup;
     u16 Port;
 
+    bool GdbWatching = false;
+    // the first watched access since the stub was last entered, reported
+    // once the instruction (or JIT block) making it has finished
+    bool GdbWatchHit = false;
+    u32 GdbWatchAddr, GdbWatchLen;
+    int GdbWatchKind;
+
+    void GdbWatchAccess(u32 addr, u32 size, bool write);
+
 public:
     int GetCPU() const override { return Num ? 7 : 9; }
 
@@ -221,18 +240,22 @@ public:
     void ResetGdb() override;
     int RemoteCmd(const u8* cmd, size_t len) override;
 
+    void BreakpointsChanged() override;
+
 protected:
 #endif
 
     void GdbCheckA();
     void GdbCheckB();
     void GdbCheckC();
+    void GdbCheckD();
+    bool GdbMustStepJIT(u32 addr, bool hasBlock) const;
 };
 
 class ARMv5 : public ARM
 {
 public:
-    ARMv5(melonDS::NDS& nds, std::optional<GDBArgs> gdb, bool jit);
+    ARMv5(melonDS::NDS& nds, std::optional<GDBArgs> gdb);
     ~ARMv5();
 
     void Reset() override;
@@ -250,6 +273,7 @@ public:
 
     template <CPUExecuteMode mode>
     void Execute();
+    void GdbStepJIT();
 
     // all code accesses are forced nonseq 32bit
     u32 CodeRead32(u32 addr, bool branch);
@@ -383,7 +407,7 @@ protected:
 class ARMv4 : public ARM
 {
 public:
-    ARMv4(melonDS::NDS& nds, std::optional<GDBArgs> gdb, bool jit);
+    ARMv4(melonDS::NDS& nds, std::optional<GDBArgs> gdb);
 
     void FillPipeline() override;
 
@@ -391,6 +415,7 @@ public:
 
     template <CPUExecuteMode mode>
     void Execute();
+    void GdbStepJIT();
 
     u16 CodeRead16(u32 addr)
     {
@@ -31,6 +31,7 @@
 #include "ARMJIT_Memory.h"
 #include "ARMJIT_Compiler.h"
 #include "ARMJIT_Global.h"
+#include "MelonPrimeTrace.h"
 
 #include "ARMInterpreter_ALU.h"
 #include "ARMInterpreter_LoadStore.h"
@@ -92,11 +93,23 @@ u32 ARMJIT::LocaliseCodeAddress(u32 num, u32 addr) const noexcept
     return 0;
 }
 
+// blocks end before a GDB breakpoint, the dispatcher stops there before
+// running the instruction in the interpreter
+static bool BreakpointAt(const ARM* cpu, u32 addr)
+{
+#ifdef GDBSTUB_ENABLED
+    return cpu->GdbStub.HasBkpt(addr);
+#else
+    return false;
+#endif
+}
+
 template <typename T, int ConsoleType>
 T SlowRead9(u32 addr, ARMv5* cpu)
 {
     u32 offset = addr & 0x3;
     addr &= ~(sizeof(T) - 1);
+    cpu->GdbCheckData(addr, sizeof(T), false);
 
     T val;
     if (addr < cpu->ITCMSize)
@@ -121,6 +134,7 @@ T SlowRead7(u32 addr)
 {
     u32 offset = addr & 0x3;
     addr &= ~(sizeof(T) - 1);
+    NDS::Current->ARM7.GdbCheckData(addr, sizeof(T), false);
 
     T val;
     if (std::is_same<T, u32>::value)
@@ -140,6 +154,7 @@ template <typename T, int ConsoleType>
 void SlowWrite9(u32 addr, ARMv5* cpu, u32 val)
 {
     addr &= ~(sizeof(T) - 1);
+    cpu->GdbCheckData(addr, sizeof(T), true);
 
     if (addr < cpu->ITCMSize)
     {
@@ -168,6 +183,7 @@ template <typename T, int ConsoleType>
 void SlowWrite7(u32 addr, u32 val)
 {
     addr &= ~(sizeof(T) - 1);
+    NDS::Current->ARM7.GdbCheckData(addr, sizeof(T), true);
 
     if (std::is_same<T, u32>::value)
         NDS::Current->ARM7Write32(addr, val);
@@ -470,8 +486,8 @@ InterpreterFunc InterpretTHUMB[ARMInstrInfo::tk_Count] =
 
 ARMJIT::ARMJIT(melonDS::NDS& nds, std::optional<JITArgs> jit) noexcept : 
         NDS(nds),
-        Memory(nds),
-        JITCompiler(nds),
+        Memory(nds, jit.has_value() && jit->HugePages),
+        JITCompiler(nds, jit.has_value() && jit->HugePages),
         MaxBlockSize(jit.has_value() ? std::clamp(jit->MaxBlockSize, 1u, 32u) : 32),
         LiteralOptimizations(jit.has_value() ? jit->LiteralOptimizations : false),
         BranchOptimizations(jit.has_value() ? jit->BranchOptimizations : false),
@@ -534,6 +550,9 @@ void ARMJIT::CompileBlock(ARM* cpu) noexcept
     bool thumb = cpu->CPSR & 0x20;
 
     u32 blockAddr = cpu->R[15] - (thumb ? 2 : 4);
+    MelonPrimeTrace::Scope trace(MelonPrimeTrace::Category::JIT,
+                                 cpu->Num == 0 ? "ARM9 compile block" : "ARM7 compile block",
+                                 blockAddr, MelonPrimeTrace::ArgKind::Address);
 
     u32 localAddr = LocaliseCodeAddress(cpu->Num, blockAddr);
     if (!localAddr)
@@ -795,7 +814,7 @@ void ARMJIT::CompileBlock(ARM* cpu) noexcept
                         JIT_DEBUGPRINT("found %s idle loop %d in block %08x\n", thumb ? "thumb" : "arm", cpu->Num, blockAddr);
                     }
                 }
-                else if (hasBranched && !isBackJump && i + 1 < MaxBlockSize)
+                else if (hasBranched && !isBackJump && i + 1 < MaxBlockSize && !BreakpointAt(cpu, target))
                 {
                     if (link)
                     {
@@ -823,7 +842,7 @@ void ARMJIT::CompileBlock(ARM* cpu) noexcept
                 }
             }
 
-            if (!hasBranched && cond < 0xE && i + 1 < MaxBlockSize)
+            if (!hasBranched && cond < 0xE && i + 1 < MaxBlockSize && !BreakpointAt(cpu, nextInstrAddr[0]))
             {
                 JIT_DEBUGPRINT("block lengthened by untaken branch\n");
                 instrs[i].Info.EndBlock = false;
@@ -837,7 +856,8 @@ void ARMJIT::CompileBlock(ARM* cpu) noexcept
         bool secondaryFlagReadCond = !canCompile || (instrs[i - 1].BranchFlags & (branch_FollowCondTaken | branch_FollowCondNotTaken));
         if (instrs[i - 1].Info.ReadFlags != 0 || secondaryFlagReadCond)
             FloodFillSetFlags(instrs, i - 2, !secondaryFlagReadCond ? instrs[i - 1].Info.ReadFlags : 0xF);
-    } while(!instrs[i - 1].Info.EndBlock && i < MaxBlockSize && !cpu->Halted && (!cpu->IRQ || (cpu->CPSR & 0x80)));
+    } while(!instrs[i - 1].Info.EndBlock && i < MaxBlockSize && !cpu->Halted && (!cpu->IRQ || (cpu->CPSR & 0x80))
+        && !BreakpointAt(cpu, nextInstrAddr[0]));
 
     if (numLiterals)
     {
@@ -1130,6 +1150,7 @@ template void ARMJIT::CheckAndInvalidate<1, ARMJIT_Memory::memregion_NewSharedWR
 void ARMJIT::ResetBlockCache() noexcept
 {
     Log(LogLevel::Debug, "Resetting JIT block cache...\n");
+    MelonPrimeTrace::Scope trace(MelonPrimeTrace::Category::JIT, "Reset block cache");
 
     // could be replace through a function which only resets
     // the permissions but we're too lazy
@@ -206,7 +206,7 @@ void Compiler::PopRegs(bool saveHiRegs, bool saveRegsToBeChanged)
     }
 }
 
-Compiler::Compiler(melonDS::NDS& nds) : Arm64Gen::ARM64XEmitter(), NDS(nds)
+Compiler::Compiler(melonDS::NDS& nds, bool hugepages) : Arm64Gen::ARM64XEmitter(), NDS(nds)
 {
 #ifdef __SWITCH__
     JitRWBase = aligned_alloc(0x1000, JitMemSize);
@@ -247,7 +247,7 @@ Compiler::Compiler(melonDS::NDS& nds) : Arm64Gen::ARM64XEmitter(), NDS(nds)
 #else
     ARMJIT_Global::Init();
 
-    CodeMemBase = ARMJIT_Global::AllocateCodeMem();
+    CodeMemBase = ARMJIT_Global::AllocateCodeMem(hugepages);
     nds.JIT.JitEnableWrite();
 
     SetCodeBase(reinterpret_cast<u8*>(CodeMemBase), reinterpret_cast<u8*>(CodeMemBase));
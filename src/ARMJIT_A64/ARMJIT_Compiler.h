@@ -98,7 +98,7 @@ class Compiler : public Arm64Gen::ARM64XEmitter
 public:
     typedef void (Compiler::*CompileFunc)();
 
-    explicit Compiler(melonDS::NDS& nds);
+    explicit Compiler(melonDS::NDS& nds, bool hugepages = false);
     ~Compiler() override;
 
     void PushRegs(bool saveHiRegs, bool saveRegsToBeChanged, bool allowUnload = true);
@@ -1,5 +1,6 @@
 #include "ARMJIT_Global.h"
 #include "ARMJIT_Memory.h"
+#include "Platform.h"
 
 #ifdef _WIN32
 #include <windows.h>
@@ -10,6 +11,7 @@
 
 #include <stdio.h>
 #include <stdint.h>
+#include <string.h>
 
 #include <mutex>
 
@@ -42,7 +44,19 @@ u8* GetAlignedCodeMemoryStart()
 
 int RefCounter = 0;
 
-void* AllocateCodeMem()
+static void* AdviseCodeMem(void* codeMem, bool hugepages)
+{
+    if (hugepages && codeMem)
+    {
+        // before the compiler first touches the slice, so it faults in as
+        // huge pages rather than waiting for khugepaged to collapse it
+        if (!HugePagesAvailable(false) || !AdviseHugePages(codeMem, CodeMemorySliceSize))
+            Platform::Log(Platform::LogLevel::Info, "JIT: no huge pages for code memory, using normal pages\n");
+    }
+    return codeMem;
+}
+
+void* AllocateCodeMem(bool hugepages)
 {
     std::lock_guard guard(globalMutex);
 
@@ -52,7 +66,7 @@ void* AllocateCodeMem()
         int slice = __builtin_ctz(AvailableCodeMemSlices);
         AvailableCodeMemSlices &= ~(1 << slice);
         //printf("allocating slice %d\n", slice);
-        return &GetAlignedCodeMemoryStart()[slice * CodeMemorySliceSize];
+        return AdviseCodeMem(&GetAlignedCodeMemoryStart()[slice * CodeMemorySliceSize], hugepages);
     }
 #endif
 
@@ -65,7 +79,8 @@ void* AllocateCodeMem()
     return mmap(nullptr, CodeMemorySliceSize, PROT_MPROTECT(PROT_READ | PROT_WRITE | PROT_EXEC), MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
 #else
     //printf("mmaping...\n");
-    return mmap(nullptr, CodeMemorySliceSize, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    void* codeMem = mmap(nullptr, CodeMemorySliceSize, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    return codeMem == MAP_FAILED ? codeMem : AdviseCodeMem(codeMem, hugepages);
 #endif
 }
 
@@ -92,6 +107,41 @@ void FreeCodeMem(void* codeMem)
 #endif
 }
 
+bool HugePagesAvailable(bool shmem)
+{
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    const char* path = shmem ? "/sys/kernel/mm/transparent_hugepage/shmem_enabled"
+                             : "/sys/kernel/mm/transparent_hugepage/enabled";
+    FILE* f = fopen(path, "r");
+    if (!f)
+        return false;
+
+    char buf[128] {};
+    size_t len = fread(buf, 1, sizeof(buf)-1, f);
+    fclose(f);
+    buf[len] = '\0';
+
+    // the active setting is the bracketed one, eg. "always [madvise] never"
+    return !strstr(buf, "[never]") && !strstr(buf, "[deny]") && strchr(buf, '[');
+#else
+    return false;
+#endif
+}
+
+bool AdviseHugePages(void* mem, size_t size)
+{
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    uintptr_t start = (reinterpret_cast<uintptr_t>(mem) + HugePageSize - 1) & ~(uintptr_t)(HugePageSize - 1);
+    uintptr_t end = (reinterpret_cast<uintptr_t>(mem) + size) & ~(uintptr_t)(HugePageSize - 1);
+    if (end <= start)
+        return false;
+
+    return madvise(reinterpret_cast<void*>(start), end - start, MADV_HUGEPAGE) == 0;
+#else
+    return false;
+#endif
+}
+
 void Init()
 {
     std::lock_guard guard(globalMutex);
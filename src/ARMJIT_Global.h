@@ -30,13 +30,24 @@ namespace ARMJIT_Global
 {
 
 static constexpr size_t CodeMemorySliceSize = 1024*1024*32;
+static constexpr size_t HugePageSize = 1024*1024*2;
 
 void Init();
 void DeInit();
 
-void* AllocateCodeMem();
+// hugepages asks for the slice to be backed by huge pages (see AdviseHugePages)
+void* AllocateCodeMem(bool hugepages = false);
 void FreeCodeMem(void* codeMem);
 
+// whether the OS will back memory with transparent huge pages when asked to
+// (Linux only). shmem selects the setting for shared/memfd memory instead of
+// anonymous memory
+bool HugePagesAvailable(bool shmem);
+
+// asks for huge pages on the HugePageSize aligned part of the range
+// returns false if there is no such part or the OS refused
+bool AdviseHugePages(void* mem, size_t size);
+
 }
 
 }
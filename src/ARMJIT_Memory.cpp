@@ -49,6 +49,7 @@
 #include "SPU.h"
 
 #include <stdlib.h>
+#include <algorithm>
 
 /*
     We're handling fastmem here.
@@ -106,7 +107,14 @@ namespace melonDS
 {
 
 static constexpr u64 AddrSpaceSize = 0x100000000;
-static constexpr u64 VirtmemAreaSize = AddrSpaceSize * 2 + MemoryTotalSize;
+#if defined(_WIN32) || defined(__SWITCH__)
+static constexpr u64 MemoryAreaSize = MemoryTotalSize;
+#else
+// the fastmem areas start on a huge page boundary, so that views of the
+// memory file in them line up with its huge pages
+static constexpr u64 MemoryAreaSize = (MemoryTotalSize + ARMJIT_Global::HugePageSize - 1) & ~(u64)(ARMJIT_Global::HugePageSize - 1);
+#endif
+static constexpr u64 VirtmemAreaSize = AddrSpaceSize * 2 + MemoryAreaSize;
 
 using Platform::Log;
 using Platform::LogLevel;
@@ -277,6 +285,9 @@ enum
     memstate_MappedRW,
     // on Switch this is unmapped as well
     memstate_MappedProtected,
+    // has a GDB watchpoint, accesses fault into the slow path
+    // which checks it. Unmapped on Switch too
+    memstate_MappedWatched,
 };
 
 #define CHECK_ALIGNED(value) assert(((value) & (PageSize-1)) == 0)
@@ -335,7 +346,13 @@ bool ARMJIT_Memory::MapIntoRange(u32 addr, u32 num, u32 offset, u32 size) noexce
     Log(LogLevel::Debug, "no mapping at all found??? %p %x %p\n", dst, size, MemoryBase);
     return false;
 #else
-    return mmap(dst, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, MemoryFile, offset) != MAP_FAILED;
+    if (mmap(dst, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, MemoryFile, offset) == MAP_FAILED)
+        return false;
+
+    // every mapping is a new VMA, which doesn't inherit the advice
+    if (HugePages)
+        ARMJIT_Global::AdviseHugePages(dst, size);
+    return true;
 #endif
 }
 
@@ -516,6 +533,10 @@ void ARMJIT_Memory::SetCodeProtection(int region, u32 offset, bool protect) noex
 
         u8* states = (u8*)(mapping.Num == 0 ? MappingStatus9 : MappingStatus7);
 
+        // watched pages stay protected, code on them is invalidated from the slow path
+        if (states[effectiveAddr >> PageShift] == memstate_MappedWatched)
+            continue;
+
         //printf("%x %d %x %x %x %d\n", effectiveAddr, mapping.Num, mapping.Addr, mapping.LocalOffset, mapping.Size, states[effectiveAddr >> PageShift]);
         assert(states[effectiveAddr >> PageShift] == (protect ? memstate_MappedRW : memstate_MappedProtected));
         states[effectiveAddr >> PageShift] = protect ? memstate_MappedProtected : memstate_MappedRW;
@@ -528,11 +549,114 @@ void ARMJIT_Memory::SetCodeProtection(int region, u32 offset, bool protect) noex
             success = MapIntoRange(effectiveAddr, mapping.Num, OffsetsPerRegion[region] + offset, 0x1000);
         assert(success);
 #else
-        SetCodeProtectionRange(effectiveAddr, PageSize, mapping.Num, protect ? 1 : 2);
+        int protection = 1;
+        if (!protect)
+            protection = region == memregion_MainRAM ? MainRAMPageProtection(offset) : 2;
+        SetCodeProtectionRange(effectiveAddr, PageSize, mapping.Num, protection);
 #endif
     }
 }
 
+int ARMJIT_Memory::MainRAMPageProtection(u32 offset) const noexcept
+{
+    return WriteTracking && WriteArmed[(offset & NDS.MainRAMMask) >> PageShift] ? 1 : 2;
+}
+
+void ARMJIT_Memory::ProtectMainRAM(u32 offset, u32 size, int protection) noexcept
+{
+#ifndef __SWITCH__
+    for (int i = 0; i < Mappings[memregion_MainRAM].Length; i++)
+    {
+        Mapping& mapping = Mappings[memregion_MainRAM][i];
+        u32 start = std::max(offset, mapping.LocalOffset);
+        u32 end = std::min(offset + size, mapping.LocalOffset + mapping.Size);
+        u8* states = mapping.Num == 0 ? MappingStatus9 : MappingStatus7;
+
+        // only plain data pages, code and watched pages keep their protection
+        // and DTCM shadows main RAM on the ARM9 side
+        u32 runStart = 0, runSize = 0;
+        for (u32 pageOffset = start; pageOffset < end; pageOffset += PageSize)
+        {
+            u32 addr = mapping.Addr + (pageOffset - mapping.LocalOffset);
+            bool apply = states[addr >> PageShift] == memstate_MappedRW
+                && !(mapping.Num == 0 && (addr & NDS.ARM9.DTCMMask) == NDS.ARM9.DTCMBase);
+            if (apply)
+            {
+                if (runSize == 0)
+                    runStart = addr;
+                runSize += PageSize;
+            }
+            if ((!apply || pageOffset + PageSize >= end) && runSize > 0)
+            {
+                SetCodeProtectionRange(runStart, runSize, mapping.Num, protection);
+                runSize = 0;
+            }
+        }
+    }
+#endif
+}
+
+bool ARMJIT_Memory::SetWriteTracking(bool enable) noexcept
+{
+#if defined(__SWITCH__)
+    return !enable;
+#else
+    // without fastmem there's nothing to track (this also sets up PageSize)
+    if (!IsFastMemSupported())
+        return !enable;
+    if (enable == WriteTracking)
+        return true;
+
+    u32 size = NDS.MainRAMMask + 1;
+    WriteTracking = enable;
+    NumWrittenPages = 0;
+    memset(WriteArmed, enable ? 1 : 0, size >> PageShift);
+    ProtectMainRAM(0, size, enable ? 1 : 2);
+    return true;
+#endif
+}
+
+void ARMJIT_Memory::RearmWriteTracking() noexcept
+{
+    if (!WriteTracking || NumWrittenPages == 0)
+        return;
+
+    std::sort(WrittenPages, WrittenPages + NumWrittenPages);
+    for (u32 i = 0; i < NumWrittenPages;)
+    {
+        u32 first = WrittenPages[i], last = first;
+        while (++i < NumWrittenPages && WrittenPages[i] == last + 1)
+            last++;
+
+        memset(&WriteArmed[first], 1, last - first + 1);
+        ProtectMainRAM(first << PageShift, (last - first + 1) << PageShift, 1);
+    }
+    NumWrittenPages = 0;
+}
+
+bool ARMJIT_Memory::HandleTrackedWrite(u32 num, u32 addr) noexcept
+{
+    if (!WriteTracking)
+        return false;
+
+    int region = num == 0 ? ClassifyAddress9(addr) : ClassifyAddress7(addr);
+    if (region != memregion_MainRAM)
+        return false;
+
+    u32 offset = addr & NDS.MainRAMMask & ~(PageSize - 1);
+    u32 page = offset >> PageShift;
+    if (!WriteArmed[page])
+        return false;
+
+    WriteArmed[page] = 0;
+    WrittenPages[NumWrittenPages++] = page;
+    // the host page may span several of the state hash's
+    for (u32 hashOffset = offset; hashOffset < offset + PageSize; hashOffset += 1 << StateHash::kPageShift)
+        NDS.StateHash.MarkMainRAMDirty(hashOffset);
+    ProtectMainRAM(offset, PageSize, 2);
+    return true;
+}
+
 void ARMJIT_Memory::RemapDTCM(u32 newBase, u32 newSize) noexcept
 {
     // this first part could be made more efficient
@@ -629,6 +753,22 @@ void ARMJIT_Memory::RemapSWRAM() noexcept
     Mappings[memregion_SharedWRAM].Clear();
 }
 
+int ARMJIT_Memory::WatchedPageProtection(u32 num, u32 addr) const noexcept
+{
+#ifdef GDBSTUB_ENABLED
+    const Gdb::GdbStub& stub = num == 0 ? NDS.ARM9.GdbStub : NDS.ARM7.GdbStub;
+    if (stub.HasWatchpts())
+    {
+        addr &= ~(PageSize - 1);
+        if (stub.FindWatchpt(addr, PageSize, 3))
+            return 0;
+        if (stub.FindWatchpt(addr, PageSize, 2))
+            return 1;
+    }
+#endif
+    return 2;
+}
+
 bool ARMJIT_Memory::MapAtAddress(u32 addr) noexcept
 {
     u32 num = NDS.CurCPU;
@@ -688,6 +828,23 @@ bool ARMJIT_Memory::MapAtAddress(u32 addr) noexcept
 
     AddressRange* range = NDS.JIT.CodeMemRegions[region] + memoryOffset / 512;
 
+    // code pages are write protected, watched pages fault on whatever their
+    // watchpoints are interested in
+    auto pageState = [&](u32 offset, int& protection) -> u8
+    {
+        protection = WatchedPageProtection(num, mirrorStart + offset);
+        if (protection != 2)
+            return memstate_MappedWatched;
+        if (isExecutable && PageContainsCode(&range[offset / 512], PageSize))
+        {
+            protection = 1;
+            return memstate_MappedProtected;
+        }
+        if (region == memregion_MainRAM)
+            protection = MainRAMPageProtection(memoryOffset + offset);
+        return memstate_MappedRW;
+    };
+
     // this overcomplicated piece of code basically just finds whole pieces of code memory
     // which can be mapped/protected
     u32 offset = 0;
@@ -701,29 +858,30 @@ bool ARMJIT_Memory::MapAtAddress(u32 addr) noexcept
         else
         {
             u32 sectionOffset = offset;
-            bool hasCode = isExecutable && PageContainsCode(&range[offset / 512], PageSize);
+            int protection, pageProtection;
+            u8 state = pageState(offset, protection);
             while (offset < mirrorSize
-                && (!isExecutable || PageContainsCode(&range[offset / 512], PageSize) == hasCode)
+                && pageState(offset, pageProtection) == state && pageProtection == protection
                 && (!skipDTCM || mirrorStart + offset != NDS.ARM9.DTCMBase))
             {
                 assert(states[(mirrorStart + offset) >> PageShift] == memstate_Unmapped);
-                states[(mirrorStart + offset) >> PageShift] = hasCode ? memstate_MappedProtected : memstate_MappedRW;
+                states[(mirrorStart + offset) >> PageShift] = state;
                 offset += PageSize;
             }
 
             u32 sectionSize = offset - sectionOffset;
 
 #if defined(__SWITCH__)
-            if (!hasCode)
+            if (state == memstate_MappedRW)
             {
                 //printf("trying to map %x (size: %x) from %x\n", mirrorStart + sectionOffset, sectionSize, sectionOffset + memoryOffset + OffsetsPerRegion[region]);
                 bool succeded = MapIntoRange(mirrorStart + sectionOffset, num, sectionOffset + memoryOffset + OffsetsPerRegion[region], sectionSize);
                 assert(succeded);
             }
 #else
-            if (hasCode)
+            if (state != memstate_MappedRW || protection != 2)
             {
-                SetCodeProtectionRange(mirrorStart + sectionOffset, sectionSize, num, 1);
+                SetCodeProtectionRange(mirrorStart + sectionOffset, sectionSize, num, protection);
             }
 #endif
         }
@@ -826,8 +984,14 @@ bool ARMJIT_Memory::FaultHandler(FaultDescription& faultDesc, melonDS::NDS& nds)
 
         u8* memStatus = nds.CurCPU == 0 ? nds.JIT.Memory.MappingStatus9 : nds.JIT.Memory.MappingStatus7;
 
-        if (memStatus[faultDesc.EmulatedFaultAddr >> PageShift] == memstate_Unmapped)
+        u8 status = memStatus[faultDesc.EmulatedFaultAddr >> PageShift];
+        if (status == memstate_Unmapped)
             rewriteToSlowPath = !nds.JIT.Memory.MapAtAddress(faultDesc.EmulatedFaultAddr);
+        // first store to a page armed for write tracking, it's writable
+        // again afterwards so just let the store run again
+        else if (status == memstate_MappedRW
+            && nds.JIT.Memory.HandleTrackedWrite(nds.CurCPU, faultDesc.EmulatedFaultAddr))
+            rewriteToSlowPath = false;
 
         if (rewriteToSlowPath)
         {
@@ -841,7 +1005,7 @@ bool ARMJIT_Memory::FaultHandler(FaultDescription& faultDesc, melonDS::NDS& nds)
     return false;
 }
 
-ARMJIT_Memory::ARMJIT_Memory(melonDS::NDS& nds) : NDS(nds)
+ARMJIT_Memory::ARMJIT_Memory(melonDS::NDS& nds, bool hugepages) : NDS(nds)
 {
     ARMJIT_Global::Init();
 #if defined(__SWITCH__)
@@ -888,7 +1052,43 @@ ARMJIT_Memory::ARMJIT_Memory(melonDS::NDS& nds) : NDS(nds)
         MemoryBase = new u8[MemoryTotalSize];
     }
 #else
-    MemoryBase = (u8*)mmap(nullptr, VirtmemAreaSize, PROT_NONE, MAP_ANON | MAP_PRIVATE, -1, 0);
+#if defined(__linux__) && !defined(__ANDROID__) && defined(MFD_CLOEXEC)
+    // Huge pages for main RAM and the rest of the memory file. MFD_HUGETLB
+    // won't do: hugetlbfs mappings have to be huge page aligned in size and
+    // offset, while fastmem maps mirrors of the small regions at 4 KB
+    // granularity. A regular memfd with shmem THP has no such restriction;
+    // the kernel uses huge pages wherever a view is suitably aligned.
+    if (hugepages)
+    {
+        if (!ARMJIT_Global::HugePagesAvailable(true))
+        {
+            Log(LogLevel::Info, "JIT: shmem huge pages are disabled (transparent_hugepage/shmem_enabled), using normal pages\n");
+        }
+        else if ((MemoryFile = memfd_create("melondsfastmem", MFD_CLOEXEC)) < 0)
+        {
+            Log(LogLevel::Info, "JIT: memfd_create failed (%s), using normal pages\n", strerror(errno));
+        }
+        else
+        {
+            HugePages = true;
+        }
+    }
+#endif
+
+    if (HugePages)
+    {
+        // reserve with enough slack to start the whole area on a huge page
+        const u64 align = ARMJIT_Global::HugePageSize;
+        u8* area = (u8*)mmap(nullptr, VirtmemAreaSize + align, PROT_NONE, MAP_ANON | MAP_PRIVATE, -1, 0);
+        MemoryBase = (u8*)(((uintptr_t)area + align - 1) & ~(uintptr_t)(align - 1));
+        if (MemoryBase != area)
+            munmap(area, MemoryBase - area);
+        munmap(MemoryBase + VirtmemAreaSize, (area + align) - MemoryBase);
+    }
+    else
+    {
+        MemoryBase = (u8*)mmap(nullptr, VirtmemAreaSize, PROT_NONE, MAP_ANON | MAP_PRIVATE, -1, 0);
+    }
 
 #if defined(__ANDROID__)
     Libandroid = Platform::DynamicLibrary_Load("libandroid.so");
@@ -907,14 +1107,17 @@ ARMJIT_Memory::ARMJIT_Memory(melonDS::NDS& nds) : NDS(nds)
         MemoryFile = fd;
     }
 #else
-    char fastmemPidName[snprintf(NULL, 0, "/melondsfastmem%d", getpid()) + 1];
-    snprintf(fastmemPidName, sizeof(fastmemPidName), "/melondsfastmem%d", getpid());
-    MemoryFile = shm_open(fastmemPidName, O_RDWR | O_CREAT | O_EXCL, 0600);
-    if (MemoryFile == -1)
+    if (MemoryFile < 0)
     {
-        Log(LogLevel::Error, "Failed to open memory using shm_open! (%s)", strerror(errno));
+        char fastmemPidName[snprintf(NULL, 0, "/melondsfastmem%d", getpid()) + 1];
+        snprintf(fastmemPidName, sizeof(fastmemPidName), "/melondsfastmem%d", getpid());
+        MemoryFile = shm_open(fastmemPidName, O_RDWR | O_CREAT | O_EXCL, 0600);
+        if (MemoryFile == -1)
+        {
+            Log(LogLevel::Error, "Failed to open memory using shm_open! (%s)", strerror(errno));
+        }
+        shm_unlink(fastmemPidName);
     }
-    shm_unlink(fastmemPidName);
 #endif
     if (ftruncate(MemoryFile, MemoryTotalSize) < 0)
     {
@@ -922,8 +1125,13 @@ ARMJIT_Memory::ARMJIT_Memory(melonDS::NDS& nds) : NDS(nds)
     }
 
     mmap(MemoryBase, MemoryTotalSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, MemoryFile, 0);
+    if (HugePages && !ARMJIT_Global::AdviseHugePages(MemoryBase, MemoryTotalSize))
+    {
+        Log(LogLevel::Info, "JIT: madvise(MADV_HUGEPAGE) failed, using normal pages\n");
+        HugePages = false;
+    }
 #endif
-    FastMem9Start = MemoryBase+MemoryTotalSize;
+    FastMem9Start = MemoryBase+MemoryAreaSize;
     FastMem7Start = static_cast<u8*>(FastMem9Start)+AddrSpaceSize;
 }
 
@@ -1505,6 +1713,12 @@ static void NDS_ARM7IOWrite32(u32 addr, u32 val)
 
 void* ARMJIT_Memory::GetFuncForAddr(ARM* cpu, u32 addr, bool store, int size) const noexcept
 {
+#ifdef GDBSTUB_ENABLED
+    // watched addresses have to take the slow path, it checks the watchpoints
+    if (cpu->GdbStub.FindWatchpt(addr, size / 8, store ? 2 : 3))
+        return NULL;
+#endif
+
     if (cpu->Num == 0)
     {
         switch (addr & 0xFF000000)
@@ -98,7 +98,7 @@ public:
 
 #ifdef JIT_ENABLED
 public:
-    explicit ARMJIT_Memory(melonDS::NDS& nds);
+    explicit ARMJIT_Memory(melonDS::NDS& nds, bool hugepages = false);
     ~ARMJIT_Memory() noexcept;
     ARMJIT_Memory(const ARMJIT_Memory&) = delete;
     ARMJIT_Memory(ARMJIT_Memory&&) = delete;
@@ -141,6 +141,17 @@ public:
 
     static bool IsFastMemSupported();
 
+    // whether the memory file and its fastmem views were set up for huge pages
+    [[nodiscard]] bool UsingHugePages() const noexcept { return HugePages; }
+
+    // Write tracking for main RAM under fastmem: plain data pages are mapped
+    // read-only, the first store to one faults, reports the page to the state
+    // hash and unprotects it. RearmWriteTracking() protects the written pages
+    // again for the next generation. Returns false where it isn't available.
+    bool SetWriteTracking(bool enable) noexcept;
+    void RearmWriteTracking() noexcept;
+    [[nodiscard]] bool IsWriteTracking() const noexcept { return WriteTracking; }
+
     static void RegisterFaultHandler();
     static void UnregisterFaultHandler();
 
@@ -166,11 +177,19 @@ private:
     bool MapIntoRange(u32 addr, u32 num, u32 offset, u32 size) noexcept;
     bool UnmapFromRange(u32 addr, u32 num, u32 offset, u32 size) noexcept;
     void SetCodeProtectionRange(u32 addr, u32 size, u32 num, int protection) noexcept;
+    // protection for a page under GDB watchpoints: 0 for reads, 1 for writes
+    // only, 2 (read/write) if there are none on it
+    int WatchedPageProtection(u32 num, u32 addr) const noexcept;
+    // protection for a plain data page of main RAM, 1 while write tracking has it armed
+    int MainRAMPageProtection(u32 offset) const noexcept;
+    void ProtectMainRAM(u32 offset, u32 size, int protection) noexcept;
+    bool HandleTrackedWrite(u32 num, u32 addr) noexcept;
 
     melonDS::NDS& NDS;
     void* FastMem9Start;
     void* FastMem7Start;
     u8* MemoryBase = nullptr;
+    bool HugePages = false;
 
 #if defined(__SWITCH__)
     VirtmemReservation* FastMem9Reservation, *FastMem7Reservation;
@@ -196,9 +215,15 @@ private:
     u8 MappingStatus9[1 << (32-12)] {};
     u8 MappingStatus7[1 << (32-12)] {};
     TinyVector<Mapping> Mappings[memregions_Count] {};
+
+    // indexed by host page of main RAM
+    bool WriteTracking = false;
+    u8 WriteArmed[MainRAMMaxSize >> 12] {};
+    u32 WrittenPages[MainRAMMaxSize >> 12] {};
+    u32 NumWrittenPages = 0;
 #else
 public:
-    explicit ARMJIT_Memory(melonDS::NDS&) {};
+    explicit ARMJIT_Memory(melonDS::NDS&, bool = false) {};
     ~ARMJIT_Memory() = default;
     ARMJIT_Memory(const ARMJIT_Memory&) = delete;
     ARMJIT_Memory(ARMJIT_Memory&&) = delete;
@@ -210,6 +235,10 @@ public:
     void RemapSWRAM() noexcept {}
     void RemapNWRAM(int num) noexcept {}
     void SetCodeProtection(int region, u32 offset, bool protect) noexcept {}
+    [[nodiscard]] bool UsingHugePages() const noexcept { return false; }
+    bool SetWriteTracking(bool enable) noexcept { return !enable; }
+    void RearmWriteTracking() noexcept {}
+    [[nodiscard]] bool IsWriteTracking() const noexcept { return false; }
 
     [[nodiscard]] u8* GetMainRAM() noexcept { return MainRAM.data(); }
     [[nodiscard]] const u8* GetMainRAM() const noexcept { return MainRAM.data(); }
@@ -223,11 +223,11 @@ void Compiler::A_Comp_MSR()
     }
 }
 
-Compiler::Compiler(melonDS::NDS& nds) : XEmitter(), NDS(nds)
+Compiler::Compiler(melonDS::NDS& nds, bool hugepages) : XEmitter(), NDS(nds)
 {
     ARMJIT_Global::Init();
 
-    CodeMemBase = static_cast<u8*>(ARMJIT_Global::AllocateCodeMem());
+    CodeMemBase = static_cast<u8*>(ARMJIT_Global::AllocateCodeMem(hugepages));
     nds.JIT.JitEnableWrite();
 
     CodeMemSize = ARMJIT_Global::CodeMemorySliceSize;
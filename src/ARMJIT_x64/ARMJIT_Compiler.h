@@ -83,7 +83,7 @@ struct Op2
 class Compiler : public Gen::XEmitter
 {
 public:
-    explicit Compiler(melonDS::NDS& nds);
+    explicit Compiler(melonDS::NDS& nds, bool hugepages = false);
     ~Compiler();
 
     void Reset();
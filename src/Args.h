@@ -67,6 +67,12 @@ struct JITArgs
     /// Enabled by default, but frontends should disable this when debugging
     /// so the constants segfaults don't hinder debugging.
     bool FastMemory = true;
+
+    /// Back the fast memory arena and the JIT code memory with huge pages,
+    /// to cut down on TLB misses. Linux only, and only effective when
+    /// transparent huge pages are enabled (madvise or always); otherwise
+    /// normal pages are used.
+    bool HugePages = false;
 };
 
 using ARM9BIOSImage = std::array<u8, ARM9BIOSSize>;
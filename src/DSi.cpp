@@ -1745,6 +1745,7 @@ void DSi::ARM9Write8(u32 addr, u8 val)
     case 0x0C000000:
         JIT.CheckAndInvalidate<0, ARMJIT_Memory::memregion_MainRAM>(addr);
         *(u8*)&MainRAM[addr & MainRAMMask] = val;
+        StateHash.MarkMainRAMDirty(addr & MainRAMMask);
         return;
     }
 
@@ -1830,6 +1831,7 @@ void DSi::ARM9Write16(u32 addr, u16 val)
     case 0x0C000000:
         JIT.CheckAndInvalidate<0, ARMJIT_Memory::memregion_MainRAM>(addr);
         *(u16*)&MainRAM[addr & MainRAMMask] = val;
+        StateHash.MarkMainRAMDirty(addr & MainRAMMask);
         return;
     }
 
@@ -1915,6 +1917,7 @@ void DSi::ARM9Write32(u32 addr, u32 val)
     case 0x0C000000:
         JIT.CheckAndInvalidate<0, ARMJIT_Memory::memregion_MainRAM>(addr);
         *(u32*)&MainRAM[addr & MainRAMMask] = val;
+        StateHash.MarkMainRAMDirty(addr & MainRAMMask);
         return;
     }
 
@@ -2218,6 +2221,7 @@ void DSi::ARM7Write8(u32 addr, u8 val)
     case 0x0C800000:
         JIT.CheckAndInvalidate<1, ARMJIT_Memory::memregion_MainRAM>(addr);
         *(u8*)&NDS::MainRAM[addr & NDS::MainRAMMask] = val;
+        StateHash.MarkMainRAMDirty(addr & MainRAMMask);
         return;
     }
 
@@ -2308,6 +2312,7 @@ void DSi::ARM7Write16(u32 addr, u16 val)
     case 0x0C800000:
         JIT.CheckAndInvalidate<1, ARMJIT_Memory::memregion_MainRAM>(addr);
         *(u16*)&NDS::MainRAM[addr & NDS::MainRAMMask] = val;
+        StateHash.MarkMainRAMDirty(addr & MainRAMMask);
         return;
     }
 
@@ -2398,6 +2403,7 @@ void DSi::ARM7Write32(u32 addr, u32 val)
     case 0x0C800000:
         JIT.CheckAndInvalidate<1, ARMJIT_Memory::memregion_MainRAM>(addr);
         *(u32*)&NDS::MainRAM[addr & NDS::MainRAMMask] = val;
+        StateHash.MarkMainRAMDirty(addr & MainRAMMask);
         return;
     }
 
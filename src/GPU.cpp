@@ -23,6 +23,7 @@
 #include "ARMJIT.h"
 
 #include "GPU_Soft.h"
+#include "MelonPrimeTrace.h"
 
 namespace melonDS
 {
@@ -304,11 +305,42 @@ void Renderer::ResetCaptureProvenance(
                 VRAMDirty need to be reset for the respective VRAM bank.
 */
 
+static constexpr u32 VRAMBankSizes[9] =
+{
+    128*1024, 128*1024, 128*1024, 128*1024, 64*1024, 16*1024, 16*1024, 32*1024, 16*1024
+};
+
+// in the order of the VRAMFlatView_* indices
+static constexpr u32 VRAMFlatViewSizes[10] =
+{
+    512*1024, 128*1024, 256*1024, 128*1024, 32*1024, 32*1024, 8*1024, 8*1024, 512*1024, 128*1024
+};
+
 GPU::GPU(melonDS::NDS& nds, std::unique_ptr<Renderer>&& renderer) noexcept :
     NDS(nds),
+    VRAMArena(VRAMBankSizes, 9, VRAMFlatViewSizes, 10),
+    VRAM_A(VRAMArena.BankArray<128*1024>(0)),
+    VRAM_B(VRAMArena.BankArray<128*1024>(1)),
+    VRAM_C(VRAMArena.BankArray<128*1024>(2)),
+    VRAM_D(VRAMArena.BankArray<128*1024>(3)),
+    VRAM_E(VRAMArena.BankArray<64*1024>(4)),
+    VRAM_F(VRAMArena.BankArray<16*1024>(5)),
+    VRAM_G(VRAMArena.BankArray<16*1024>(6)),
+    VRAM_H(VRAMArena.BankArray<32*1024>(7)),
+    VRAM_I(VRAMArena.BankArray<16*1024>(8)),
     GPU2D_A(0, *this),
     GPU2D_B(1, *this),
-    GPU3D(*this)
+    GPU3D(*this),
+    VRAMFlat_ABG(VRAMArena.ViewArray<512*1024>(VRAMFlatView_ABG)),
+    VRAMFlat_BBG(VRAMArena.ViewArray<128*1024>(VRAMFlatView_BBG)),
+    VRAMFlat_AOBJ(VRAMArena.ViewArray<256*1024>(VRAMFlatView_AOBJ)),
+    VRAMFlat_BOBJ(VRAMArena.ViewArray<128*1024>(VRAMFlatView_BOBJ)),
+    VRAMFlat_ABGExtPal(VRAMArena.ViewArray<32*1024>(VRAMFlatView_ABGExtPal)),
+    VRAMFlat_BBGExtPal(VRAMArena.ViewArray<32*1024>(VRAMFlatView_BBGExtPal)),
+    VRAMFlat_AOBJExtPal(VRAMArena.ViewArray<8*1024>(VRAMFlatView_AOBJExtPal)),
+    VRAMFlat_BOBJExtPal(VRAMArena.ViewArray<8*1024>(VRAMFlatView_BOBJExtPal)),
+    VRAMFlat_Texture(VRAMArena.ViewArray<512*1024>(VRAMFlatView_Texture)),
+    VRAMFlat_TexPal(VRAMArena.ViewArray<128*1024>(VRAMFlatView_TexPal))
 {
     NDS.RegisterEventFuncs(Event_LCD, this,
     {
@@ -331,6 +363,9 @@ GPU::~GPU() noexcept
 
 void GPU::ResetVRAMCache() noexcept
 {
+    // the memsets below must not reach through to the banks
+    UnaliasVRAMFlatViews(0, VRAMFlatView_Count);
+
     for (int i = 0; i < 9; i++)
         VRAMDirty[i] = NonStupidBitField<128*1024/VRAMDirtyGranularity>();
 
@@ -366,6 +401,7 @@ void GPU::Reset() noexcept
     VCountOverride = false;
     NextVCount = 0;
     TotalScanlines = 0;
+    Skip2DFrame = false;
 
     DispStat[0] = 0;
     DispStat[1] = 0;
@@ -559,6 +595,14 @@ void GPU::DoSavestate(Savestate* file) noexcept
         Rend->InvalidateHighResCaptureState(
             HighResCaptureInvalidationReason::SavestateLoad);
         Rend->RebuildAfterSavestateLoad(VCount);
+
+        // the 3D frame isn't part of the state. From line 215 until the end
+        // of the next visible frame it is shown and may be captured into
+        // VRAM, so render it again from the restored render state rather
+        // than keep whatever the renderer last drew.
+        GPU3D.RenderFrameIdentical = false;
+        if (VCount >= 215 || VCount < 192)
+            Rend->Start3DRendering();
     }
 }
 
@@ -1416,6 +1460,9 @@ void GPU::DisplayFIFO(u32 x) noexcept
 
 void GPU::StartFrame() noexcept
 {
+    LastVRAMFlatStats = CurVRAMFlatStats;
+    CurVRAMFlatStats = {};
+
     ScreensEnabled = !!(NDS.PowerControl9 & (1<<0));
 
     // only run the display FIFO if needed:
@@ -1442,15 +1489,20 @@ void GPU::StartHBlank(u32 line) noexcept
     {
         // draw
         // note: this should start 48 cycles after the scanline start
-        if (line < 192)
-            Rend->DrawScanline(line);
-        if (line < 191)
-            Rend->DrawSprites(line+1);
+        if (!Skip2DFrame)
+        {
+            if (line < 192)
+                Rend->DrawScanline(line);
+            if (line < 191)
+                Rend->DrawSprites(line+1);
+        }
 
         NDS.CheckDMAs(0, 0x02);
     }
     else if (VCount == 215)
     {
+        // rendered even while suppressed: a capture armed later in VBlank
+        // copies this frame into VRAM
         Rend->Start3DRendering();
     }
     else if (VCount == 262)
@@ -1555,6 +1607,8 @@ void GPU::StartScanline(u32 line) noexcept
             CaptureEnable = true;
             CheckCaptureStart();
         }
+
+        Skip2DFrame = RenderingSuppressed && !CaptureEnable;
     }
     else if (VCount == 192)
     {
@@ -1587,7 +1641,8 @@ void GPU::StartScanline(u32 line) noexcept
 
         GPU3D.VBlank();
 
-        Rend->VBlank();
+        if (!Skip2DFrame)
+            Rend->VBlank();
 
         if (CaptureEnable)
         {
@@ -1760,50 +1815,116 @@ template NonStupidBitField<512*1024/VRAMDirtyGranularity> VRAMTrackingSet<512*10
 
 bool GPU::MakeVRAMFlat_TextureCoherent(NonStupidBitField<512*1024/VRAMDirtyGranularity>& dirty) noexcept
 {
-    return CopyLinearVRAM<128*1024>(VRAMFlat_Texture, VRAMMap_Texture, dirty, &GPU::ReadVRAM_Texture<u64>);
+    return CopyLinearVRAM<128*1024>(VRAMFlatView_Texture, VRAMFlat_Texture, VRAMMap_Texture, dirty, &GPU::ReadVRAM_Texture<u64>);
 }
 bool GPU::MakeVRAMFlat_TexPalCoherent(NonStupidBitField<128*1024/VRAMDirtyGranularity>& dirty) noexcept
 {
-    return CopyLinearVRAM<16*1024>(VRAMFlat_TexPal, VRAMMap_TexPal, dirty, &GPU::ReadVRAM_TexPal<u64>);
+    return CopyLinearVRAM<16*1024>(VRAMFlatView_TexPal, VRAMFlat_TexPal, VRAMMap_TexPal, dirty, &GPU::ReadVRAM_TexPal<u64>);
 }
 
 bool GPU::MakeVRAMFlat_ABGCoherent(NonStupidBitField<512*1024/VRAMDirtyGranularity>& dirty) noexcept
 {
-    return CopyLinearVRAM<16*1024>(VRAMFlat_ABG, VRAMMap_ABG, dirty, &GPU::ReadVRAM_ABG<u64>);
+    return CopyLinearVRAM<16*1024>(VRAMFlatView_ABG, VRAMFlat_ABG, VRAMMap_ABG, dirty, &GPU::ReadVRAM_ABG<u64>);
 }
 bool GPU::MakeVRAMFlat_BBGCoherent(NonStupidBitField<128*1024/VRAMDirtyGranularity>& dirty) noexcept
 {
-    return CopyLinearVRAM<16*1024>(VRAMFlat_BBG, VRAMMap_BBG, dirty, &GPU::ReadVRAM_BBG<u64>);
+    return CopyLinearVRAM<16*1024>(VRAMFlatView_BBG, VRAMFlat_BBG, VRAMMap_BBG, dirty, &GPU::ReadVRAM_BBG<u64>);
 }
 
 bool GPU::MakeVRAMFlat_AOBJCoherent(NonStupidBitField<256*1024/VRAMDirtyGranularity>& dirty) noexcept
 {
-    return CopyLinearVRAM<16*1024>(VRAMFlat_AOBJ, VRAMMap_AOBJ, dirty, &GPU::ReadVRAM_AOBJ<u64>);
+    return CopyLinearVRAM<16*1024>(VRAMFlatView_AOBJ, VRAMFlat_AOBJ, VRAMMap_AOBJ, dirty, &GPU::ReadVRAM_AOBJ<u64>);
 }
 bool GPU::MakeVRAMFlat_BOBJCoherent(NonStupidBitField<128*1024/VRAMDirtyGranularity>& dirty) noexcept
 {
-    return CopyLinearVRAM<16*1024>(VRAMFlat_BOBJ, VRAMMap_BOBJ, dirty, &GPU::ReadVRAM_BOBJ<u64>);
+    return CopyLinearVRAM<16*1024>(VRAMFlatView_BOBJ, VRAMFlat_BOBJ, VRAMMap_BOBJ, dirty, &GPU::ReadVRAM_BOBJ<u64>);
 }
 
 bool GPU::MakeVRAMFlat_ABGExtPalCoherent(NonStupidBitField<32*1024/VRAMDirtyGranularity>& dirty) noexcept
 {
-    return CopyLinearVRAM<8*1024>(VRAMFlat_ABGExtPal, VRAMMap_ABGExtPal, dirty, &GPU::ReadVRAM_ABGExtPal<u64>);
+    return CopyLinearVRAM<8*1024>(VRAMFlatView_ABGExtPal, VRAMFlat_ABGExtPal, VRAMMap_ABGExtPal, dirty, &GPU::ReadVRAM_ABGExtPal<u64>);
 }
 bool GPU::MakeVRAMFlat_BBGExtPalCoherent(NonStupidBitField<32*1024/VRAMDirtyGranularity>& dirty) noexcept
 {
-    return CopyLinearVRAM<8*1024>(VRAMFlat_BBGExtPal, VRAMMap_BBGExtPal, dirty, &GPU::ReadVRAM_BBGExtPal<u64>);
+    return CopyLinearVRAM<8*1024>(VRAMFlatView_BBGExtPal, VRAMFlat_BBGExtPal, VRAMMap_BBGExtPal, dirty, &GPU::ReadVRAM_BBGExtPal<u64>);
 }
 
 bool GPU::MakeVRAMFlat_AOBJExtPalCoherent(NonStupidBitField<8*1024/VRAMDirtyGranularity>& dirty) noexcept
 {
-    return CopyLinearVRAM<8*1024>(VRAMFlat_AOBJExtPal, &VRAMMap_AOBJExtPal, dirty, &GPU::ReadVRAM_AOBJExtPal<u64>);
+    return CopyLinearVRAM<8*1024>(VRAMFlatView_AOBJExtPal, VRAMFlat_AOBJExtPal, &VRAMMap_AOBJExtPal, dirty, &GPU::ReadVRAM_AOBJExtPal<u64>);
 }
 bool GPU::MakeVRAMFlat_BOBJExtPalCoherent(NonStupidBitField<8*1024/VRAMDirtyGranularity>& dirty) noexcept
 {
-    return CopyLinearVRAM<8*1024>(VRAMFlat_BOBJExtPal, &VRAMMap_BOBJExtPal, dirty, &GPU::ReadVRAM_BOBJExtPal<u64>);
+    return CopyLinearVRAM<8*1024>(VRAMFlatView_BOBJExtPal, VRAMFlat_BOBJExtPal, &VRAMMap_BOBJExtPal, dirty, &GPU::ReadVRAM_BOBJExtPal<u64>);
 }
 
 
+bool GPU::UpdateVRAMFlatAlias(int view, u32 slot, u32 size, u32 mask) noexcept
+{
+    bool allowed = VRAMFlatAliasing
+        && !(TextureVRAMSnapshots && (view == VRAMFlatView_Texture || view == VRAMFlatView_TexPal));
+
+    // only a slot served by exactly one bank can be aliased, several
+    // overlapping banks have to be ORed together by the copy
+    const u8* bank = (allowed && VRAMArena.CanAlias(size)) ? GetUniqueBankPtr(mask, slot * size) : nullptr;
+    const u8*& cur = VRAMFlatAlias[view][slot];
+    if (bank && bank == cur)
+        return true;
+
+    if (bank && VRAMArena.Alias(view, slot * size, bank, size))
+    {
+        cur = bank;
+        return true;
+    }
+
+    // the slot's own backing is stale now, but we only get here when the
+    // mapping changed, which marks the whole slot dirty so it's all recopied
+    if (cur)
+    {
+        VRAMArena.Unalias(view, slot * size, size);
+        cur = nullptr;
+    }
+    return false;
+}
+
+void GPU::UnaliasVRAMFlatViews(int first, int end) noexcept
+{
+    for (int view = first; view < end; view++)
+    {
+        u32 size = (view == VRAMFlatView_Texture) ? 128*1024
+                 : (view >= VRAMFlatView_ABGExtPal && view <= VRAMFlatView_BOBJExtPal) ? 8*1024
+                 : 16*1024;
+        for (u32 slot = 0; slot < VRAMFlatViewSizes[view] / size; slot++)
+        {
+            if (!VRAMFlatAlias[view][slot]) continue;
+            VRAMArena.Unalias(view, slot * size, size);
+            VRAMFlatAlias[view][slot] = nullptr;
+        }
+    }
+}
+
+void GPU::SetVRAMFlatAliasing(bool enable) noexcept
+{
+    if (VRAMFlatAliasing == enable) return;
+    VRAMFlatAliasing = enable;
+
+    // the unaliased views have to be refilled from scratch
+    ResetVRAMCache();
+}
+
+void GPU::SetTextureVRAMSnapshots(bool snapshots) noexcept
+{
+    if (TextureVRAMSnapshots == snapshots) return;
+    TextureVRAMSnapshots = snapshots;
+
+    if (snapshots)
+    {
+        UnaliasVRAMFlatViews(VRAMFlatView_Texture, VRAMFlatView_TexPal + 1);
+        VRAMDirty_Texture.Reset();
+        VRAMDirty_TexPal.Reset();
+    }
+}
+
 void GPU::VRAMCBFlagsSet(u32 bank, u32 block, u16 val)
 {
     u16* cbflags = &VRAMCaptureBlockFlags[bank << 2];
@@ -2036,6 +2157,9 @@ void GPU::SyncVRAMCaptureBlock(u32 block, bool write)
         return;
     }
 
+    MelonPrimeTrace::Scope trace(MelonPrimeTrace::Category::GPU,
+                                 write ? "Sync VRAM capture (write)" : "Sync VRAM capture (read)",
+                                 block, MelonPrimeTrace::ArgKind::Count);
     const u64 cpuVRAMHashBefore = HashCaptureVRAM(*this, bank, start, len);
     CaptureBlockProvenance owner{};
     const bool provenanceValid = Rend->GetCaptureProvenanceForRange(
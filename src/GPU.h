@@ -25,6 +25,7 @@
 
 #include "GPU2D.h"
 #include "GPU3D.h"
+#include "GPU_VRAMAlias.h"
 #include "NonStupidBitfield.h"
 
 namespace melonDS
@@ -428,6 +429,20 @@ public:
     u8* GetUniqueBankPtr(u32 mask, u32 offset) noexcept;
     const u8* GetUniqueBankPtr(u32 mask, u32 offset) const noexcept;
 
+    struct VRAMFlatStats
+    {
+        u64 BytesCopied = 0;    // dirty bytes copied into the flat views
+        u64 BytesAliased = 0;   // dirty bytes that were already there through a bank alias
+    };
+    // totals over the last complete frame
+    const VRAMFlatStats& GetVRAMFlatStats() const noexcept { return LastVRAMFlatStats; }
+
+    // turning aliasing off makes every flat view a plain copy again
+    void SetVRAMFlatAliasing(bool enable) noexcept;
+    // for renderers that read the texture views on another thread, which
+    // need a copy that holds still for the duration of a frame
+    void SetTextureVRAMSnapshots(bool snapshots) noexcept;
+
     u8 Read8(u32 addr);
     u16 Read16(u32 addr);
     u32 Read32(u32 addr);
@@ -1076,6 +1091,13 @@ public:
 
     void Restart3DFrame() noexcept;
 
+    // while suppressed, the 2D engines skip frames that were already shown,
+    // for re-simulating them (netplay rollback). Frames with a display capture
+    // are still drawn, since the capture ends up in VRAM. 3D is always
+    // rendered: DISPCAPCNT can be armed after the 3D frame has started.
+    void SetRenderingSuppressed(bool suppressed) noexcept { RenderingSuppressed = suppressed; }
+    [[nodiscard]] bool IsRenderingSuppressed() const noexcept { return RenderingSuppressed; }
+
     void DisplayFIFO(u32 x) noexcept;
 
     void SetDispStat(u32 cpu, u16 val, u16 mask) noexcept;
@@ -1121,15 +1143,18 @@ public:
     alignas(u64) u8 Palette[2*1024] {};
     alignas(u64) u8 OAM[2*1024] {};
 
-    alignas(u64) u8 VRAM_A[128*1024] {};
-    alignas(u64) u8 VRAM_B[128*1024] {};
-    alignas(u64) u8 VRAM_C[128*1024] {};
-    alignas(u64) u8 VRAM_D[128*1024] {};
-    alignas(u64) u8 VRAM_E[ 64*1024] {};
-    alignas(u64) u8 VRAM_F[ 16*1024] {};
-    alignas(u64) u8 VRAM_G[ 16*1024] {};
-    alignas(u64) u8 VRAM_H[ 32*1024] {};
-    alignas(u64) u8 VRAM_I[ 16*1024] {};
+    // owns the storage behind the VRAM banks and the flat views below
+    VRAMAliasArena VRAMArena;
+
+    u8 (&VRAM_A)[128*1024];
+    u8 (&VRAM_B)[128*1024];
+    u8 (&VRAM_C)[128*1024];
+    u8 (&VRAM_D)[128*1024];
+    u8 (&VRAM_E)[ 64*1024];
+    u8 (&VRAM_F)[ 16*1024];
+    u8 (&VRAM_G)[ 16*1024];
+    u8 (&VRAM_H)[ 32*1024];
+    u8 (&VRAM_I)[ 16*1024];
 
     u8* const VRAM[9]     = {VRAM_A,  VRAM_B,  VRAM_C,  VRAM_D,  VRAM_E, VRAM_F, VRAM_G, VRAM_H, VRAM_I};
     u32 const VRAMMask[9] = {0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0xFFFF, 0x3FFF, 0x3FFF, 0x7FFF, 0x3FFF};
@@ -1170,19 +1195,21 @@ public:
     VRAMTrackingSet<512*1024, 128*1024> VRAMDirty_Texture {};
     VRAMTrackingSet<128*1024, 16*1024> VRAMDirty_TexPal {};
 
-    u8 VRAMFlat_ABG[512*1024] {};
-    u8 VRAMFlat_BBG[128*1024] {};
-    u8 VRAMFlat_AOBJ[256*1024] {};
-    u8 VRAMFlat_BOBJ[128*1024] {};
+    // slots served by a single bank are mapped straight onto that bank
+    // (see VRAMAliasArena), the others are copied into their own backing
+    u8 (&VRAMFlat_ABG)[512*1024];
+    u8 (&VRAMFlat_BBG)[128*1024];
+    u8 (&VRAMFlat_AOBJ)[256*1024];
+    u8 (&VRAMFlat_BOBJ)[128*1024];
 
-    alignas(u16) u8 VRAMFlat_ABGExtPal[32*1024] {};
-    alignas(u16) u8 VRAMFlat_BBGExtPal[32*1024] {};
+    u8 (&VRAMFlat_ABGExtPal)[32*1024];
+    u8 (&VRAMFlat_BBGExtPal)[32*1024];
 
-    alignas(u16) u8 VRAMFlat_AOBJExtPal[8*1024] {};
-    alignas(u16) u8 VRAMFlat_BOBJExtPal[8*1024] {};
+    u8 (&VRAMFlat_AOBJExtPal)[8*1024];
+    u8 (&VRAMFlat_BOBJExtPal)[8*1024];
 
-    alignas(u64) u8 VRAMFlat_Texture[512*1024] {};
-    alignas(u64) u8 VRAMFlat_TexPal[128*1024] {};
+    u8 (&VRAMFlat_Texture)[512*1024];
+    u8 (&VRAMFlat_TexPal)[128*1024];
 
     u32 OAMDirty = 0;
     u32 PaletteDirty = 0;
@@ -1192,7 +1219,24 @@ public:
     u32 GPU2DWriteJournalSequence = 0;
 
 private:
+    enum
+    {
+        VRAMFlatView_ABG = 0,
+        VRAMFlatView_BBG,
+        VRAMFlatView_AOBJ,
+        VRAMFlatView_BOBJ,
+        VRAMFlatView_ABGExtPal,
+        VRAMFlatView_BBGExtPal,
+        VRAMFlatView_AOBJExtPal,
+        VRAMFlatView_BOBJExtPal,
+        VRAMFlatView_Texture,
+        VRAMFlatView_TexPal,
+        VRAMFlatView_Count
+    };
+
     void ResetVRAMCache() noexcept;
+    bool UpdateVRAMFlatAlias(int view, u32 slot, u32 size, u32 mask) noexcept;
+    void UnaliasVRAMFlatViews(int first, int end) noexcept;
 
     template<typename T>
     T ReadVRAM_ABGExtPal(u32 addr) const noexcept
@@ -1242,15 +1286,33 @@ private:
     }
 
     template <u32 MappingGranularity, u32 Size>
-    constexpr bool CopyLinearVRAM(u8* flat, const u32* mappings, NonStupidBitField<Size>& dirty, u64 (GPU::* const slowAccess)(u32) const noexcept) noexcept
+    constexpr bool CopyLinearVRAM(int view, u8* flat, const u32* mappings, NonStupidBitField<Size>& dirty, u64 (GPU::* const slowAccess)(u32) const noexcept) noexcept
     {
         const u32 VRAMBitsPerMapping = MappingGranularity / VRAMDirtyGranularity;
 
         bool change = false;
+        u32 slot = ~0u;
+        bool aliased = false;
 
         typename NonStupidBitField<Size>::Iterator it = dirty.Begin();
         while (it != dirty.End())
         {
+            // a remapped slot is dirty as a whole, so its first dirty block
+            // is where it gets (un)aliased
+            if (*it / VRAMBitsPerMapping != slot)
+            {
+                slot = *it / VRAMBitsPerMapping;
+                aliased = UpdateVRAMFlatAlias(view, slot, MappingGranularity, mappings[slot]);
+            }
+
+            change = true;
+            if (aliased)
+            {
+                CurVRAMFlatStats.BytesAliased += VRAMDirtyGranularity;
+                it++;
+                continue;
+            }
+
             u32 offset = *it * VRAMDirtyGranularity;
             u8* dst = flat + offset;
             u8* fastAccess = GetUniqueBankPtr(mappings[*it / VRAMBitsPerMapping], offset);
@@ -1263,7 +1325,7 @@ private:
                 for (u32 i = 0; i < VRAMDirtyGranularity; i += 8)
                     *(u64*)&dst[i] = (this->*slowAccess)(offset + i);
             }
-            change = true;
+            CurVRAMFlatStats.BytesCopied += VRAMDirtyGranularity;
             it++;
         }
         return change;
@@ -1300,6 +1362,11 @@ private:
     bool VCountOverride = false;
     u16 NextVCount = 0;
 
+    // not part of the hardware state, don't serialize: they follow what the
+    // renderer was actually asked to do, which loading a state doesn't change
+    bool RenderingSuppressed = false;
+    bool Skip2DFrame = false;
+
     bool RunFIFO = false;
 
     u16 VMatch[2] {};
@@ -1312,6 +1379,13 @@ private:
     u16* VRAMCBF_AOBJ[0x10] {};
     u16* VRAMCBF_BBG[0x8] {};
     u16* VRAMCBF_BOBJ[0x8] {};
+
+    // bank memory each flat view slot is currently mapped onto, if any
+    const u8* VRAMFlatAlias[VRAMFlatView_Count][0x20] {};
+    bool VRAMFlatAliasing = true;
+    bool TextureVRAMSnapshots = false;
+    VRAMFlatStats CurVRAMFlatStats {};
+    VRAMFlatStats LastVRAMFlatStats {};
 };
 
 
@@ -1329,6 +1403,10 @@ struct RendererSettings
     // "improved polygon splitting" (regular OpenGL renderer)
     bool BetterPolygons;
 
+    // render the 2D engines at VBlank from the recorded frame, on several
+    // threads (software renderer)
+    bool Deferred2D;
+
 #if defined(MELONPRIME_DS) && (defined(MELONPRIME_ENABLE_VULKAN) \
     || (defined(_WIN32) && defined(MELONPRIME_ENABLE_DX12)))
     // 0=Off, 1=Reflex low latency, 2=Reflex low latency + GPU clock boost.
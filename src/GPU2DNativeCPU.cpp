@@ -0,0 +1,2099 @@
+/*
+    Copyright 2016-2026 melonDS team
+*/
+
+#include "GPU2DNativeCPU.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define NATIVECPU_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#define NATIVECPU_NEON
+#include <arm_neon.h>
+#endif
+
+#include "GPU.h"
+#include "GPU_ColorOp.h"
+#include "MelonPrimeTrace.h"
+
+namespace melonDS::GPU2DNative
+{
+
+namespace
+{
+
+// same as SoftRenderer2D's
+enum : u32
+{
+    OBJ_StandardPal = (1<<12),
+    OBJ_DirectColor = (1<<15),
+    OBJ_BGPrioMask = (0x3<<16),
+    OBJ_IsOpaque = (1<<18),
+    OBJ_OpaPrioMask = (OBJ_BGPrioMask | OBJ_IsOpaque),
+    OBJ_IsSprite = (1<<19),
+    OBJ_Mosaic = (1<<20),
+};
+
+constexpr u32 LinesPerBand = 8;
+constexpr u32 FrameBands = (2 * ScreenHeight) / LinesPerBand;
+
+u64 NowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+const u32* TimelineRow(const std::array<u32, PackedTimelineRowsWords>& rows, u32 row, u32 block)
+{
+    return row < ScreenHeight ? &rows[row * TimelineBlockCount + block] : nullptr;
+}
+
+const u32* SpriteTimelineRow(const std::array<u32, PackedSpriteTimelineRowsWords>& rows, u32 row, u32 block)
+{
+    return row < ScreenHeight ? &rows[row * SpriteTimelineBlockCount + block] : nullptr;
+}
+
+// The colour effects on four pixels at once. Pixels are 6-bit channels in
+// bytes 0-2 with flags in byte 3, as in BGOBJLine; every function here gives
+// exactly what the GPU_ColorOp.h function it stands in for gives (all
+// intermediate values fit 16-bit lanes), with 0xFF in byte 3.
+//
+// Blends take per-pixel weights in 1/32 units, so ColorBlend4's eva/evb are
+// passed doubled: ((a*2eva + b*2evb + 16) >> 5) == ((a*eva + b*evb + 8) >> 4).
+#if defined(NATIVECPU_SSE2)
+
+using Pixels4 = __m128i;
+
+inline Pixels4 Load4(const u32* src) noexcept { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(src)); }
+inline void Store4(u32* dst, Pixels4 val) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), val); }
+inline Pixels4 Splat4(u32 val) noexcept { return _mm_set1_epi32(static_cast<int>(val)); }
+inline Pixels4 And4(Pixels4 a, Pixels4 b) noexcept { return _mm_and_si128(a, b); }
+inline Pixels4 AndNot4(Pixels4 mask, Pixels4 val) noexcept { return _mm_andnot_si128(mask, val); }
+inline Pixels4 Or4(Pixels4 a, Pixels4 b) noexcept { return _mm_or_si128(a, b); }
+inline Pixels4 Add4(Pixels4 a, Pixels4 b) noexcept { return _mm_add_epi32(a, b); }
+inline Pixels4 Sub4(Pixels4 a, Pixels4 b) noexcept { return _mm_sub_epi32(a, b); }
+inline Pixels4 Equal4(Pixels4 a, Pixels4 b) noexcept { return _mm_cmpeq_epi32(a, b); }
+inline Pixels4 Flags4(Pixels4 val) noexcept { return _mm_srli_epi32(val, 24); }
+template <int N> inline Pixels4 ShiftLeft4(Pixels4 val) noexcept { return _mm_slli_epi32(val, N); }
+inline bool Any4(Pixels4 mask) noexcept { return _mm_movemask_epi8(mask) != 0; }
+
+// four bytes, one per pixel
+inline Pixels4 LoadBytes4(const u8* src) noexcept
+{
+    u32 bytes;
+    memcpy(&bytes, src, 4);
+    const __m128i zero = _mm_setzero_si128();
+    return _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(static_cast<int>(bytes)), zero), zero);
+}
+
+// runs `op` over the channels widened to 16 bits, pixels 0-1 (half 0) then
+// 2-3 (half 1); WidenWeight() lines a per-pixel weight up with them
+template <typename Op>
+inline Pixels4 ChannelOp4(Pixels4 val1, Pixels4 val2, Op op) noexcept
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i mask = _mm_set1_epi32(0x003F3F3F);
+    val1 = _mm_and_si128(val1, mask);
+    val2 = _mm_and_si128(val2, mask);
+    const __m128i lo = op(_mm_unpacklo_epi8(val1, zero), _mm_unpacklo_epi8(val2, zero), 0);
+    const __m128i hi = op(_mm_unpackhi_epi8(val1, zero), _mm_unpackhi_epi8(val2, zero), 1);
+    return _mm_or_si128(_mm_packus_epi16(lo, hi), _mm_set1_epi32(static_cast<int>(0xFF000000)));
+}
+
+inline __m128i WidenWeight(Pixels4 weight, int half) noexcept
+{
+    const __m128i both = _mm_or_si128(weight, _mm_slli_epi32(weight, 16));
+    return half ? _mm_unpackhi_epi32(both, both) : _mm_unpacklo_epi32(both, both);
+}
+
+inline Pixels4 Blend4(Pixels4 val1, Pixels4 val2, Pixels4 eva, Pixels4 evb) noexcept
+{
+    return ChannelOp4(val1, val2, [&](__m128i a, __m128i b, int half) {
+        __m128i sum = _mm_add_epi16(_mm_mullo_epi16(a, WidenWeight(eva, half)),
+                                    _mm_mullo_epi16(b, WidenWeight(evb, half)));
+        sum = _mm_srli_epi16(_mm_add_epi16(sum, _mm_set1_epi16(16)), 5);
+        return _mm_min_epi16(sum, _mm_set1_epi16(0x3F));
+    });
+}
+
+inline Pixels4 BrightnessUp4(Pixels4 val, u32 factor, u32 bias) noexcept
+{
+    const __m128i f = _mm_set1_epi16(static_cast<short>(factor));
+    const __m128i b = _mm_set1_epi16(static_cast<short>(bias));
+    return ChannelOp4(val, val, [&](__m128i c, __m128i, int) {
+        const __m128i up = _mm_mullo_epi16(_mm_sub_epi16(_mm_set1_epi16(0x3F), c), f);
+        return _mm_add_epi16(c, _mm_srli_epi16(_mm_add_epi16(up, b), 4));
+    });
+}
+
+inline Pixels4 BrightnessDown4(Pixels4 val, u32 factor, u32 bias) noexcept
+{
+    const __m128i f = _mm_set1_epi16(static_cast<short>(factor));
+    const __m128i b = _mm_set1_epi16(static_cast<short>(bias));
+    return ChannelOp4(val, val, [&](__m128i c, __m128i, int) {
+        return _mm_sub_epi16(c, _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(c, f), b), 4));
+    });
+}
+
+#elif defined(NATIVECPU_NEON)
+
+using Pixels4 = uint32x4_t;
+
+inline Pixels4 Load4(const u32* src) noexcept { return vld1q_u32(src); }
+inline void Store4(u32* dst, Pixels4 val) noexcept { vst1q_u32(dst, val); }
+inline Pixels4 Splat4(u32 val) noexcept { return vdupq_n_u32(val); }
+inline Pixels4 And4(Pixels4 a, Pixels4 b) noexcept { return vandq_u32(a, b); }
+inline Pixels4 AndNot4(Pixels4 mask, Pixels4 val) noexcept { return vbicq_u32(val, mask); }
+inline Pixels4 Or4(Pixels4 a, Pixels4 b) noexcept { return vorrq_u32(a, b); }
+inline Pixels4 Add4(Pixels4 a, Pixels4 b) noexcept { return vaddq_u32(a, b); }
+inline Pixels4 Sub4(Pixels4 a, Pixels4 b) noexcept { return vsubq_u32(a, b); }
+inline Pixels4 Equal4(Pixels4 a, Pixels4 b) noexcept { return vceqq_u32(a, b); }
+inline Pixels4 Flags4(Pixels4 val) noexcept { return vshrq_n_u32(val, 24); }
+template <int N> inline Pixels4 ShiftLeft4(Pixels4 val) noexcept { return vshlq_n_u32(val, N); }
+inline bool Any4(Pixels4 mask) noexcept
+{
+    const uint32x2_t folded = vorr_u32(vget_low_u32(mask), vget_high_u32(mask));
+    return (vget_lane_u32(folded, 0) | vget_lane_u32(folded, 1)) != 0;
+}
+
+inline Pixels4 LoadBytes4(const u8* src) noexcept
+{
+    u32 bytes;
+    memcpy(&bytes, src, 4);
+    const uint8x8_t b = vreinterpret_u8_u32(vdup_n_u32(bytes));
+    return vmovl_u16(vget_low_u16(vmovl_u8(b)));
+}
+
+template <typename Op>
+inline Pixels4 ChannelOp4(Pixels4 val1, Pixels4 val2, Op op) noexcept
+{
+    const uint32x4_t mask = vdupq_n_u32(0x003F3F3F);
+    const uint8x16_t a = vreinterpretq_u8_u32(vandq_u32(val1, mask));
+    const uint8x16_t b = vreinterpretq_u8_u32(vandq_u32(val2, mask));
+    const uint16x8_t lo = op(vmovl_u8(vget_low_u8(a)), vmovl_u8(vget_low_u8(b)), 0);
+    const uint16x8_t hi = op(vmovl_u8(vget_high_u8(a)), vmovl_u8(vget_high_u8(b)), 1);
+    return vorrq_u32(vreinterpretq_u32_u8(vcombine_u8(vqmovn_u16(lo), vqmovn_u16(hi))),
+                     vdupq_n_u32(0xFF000000));
+}
+
+inline uint16x8_t WidenWeight(Pixels4 weight, int half) noexcept
+{
+    const uint32x4_t both = vorrq_u32(weight, vshlq_n_u32(weight, 16));
+    const uint32x4x2_t pairs = vzipq_u32(both, both);
+    return vreinterpretq_u16_u32(half ? pairs.val[1] : pairs.val[0]);
+}
+
+inline Pixels4 Blend4(Pixels4 val1, Pixels4 val2, Pixels4 eva, Pixels4 evb) noexcept
+{
+    return ChannelOp4(val1, val2, [&](uint16x8_t a, uint16x8_t b, int half) {
+        const uint16x8_t sum = vmlaq_u16(vmulq_u16(a, WidenWeight(eva, half)), b, WidenWeight(evb, half));
+        return vminq_u16(vshrq_n_u16(vaddq_u16(sum, vdupq_n_u16(16)), 5), vdupq_n_u16(0x3F));
+    });
+}
+
+inline Pixels4 BrightnessUp4(Pixels4 val, u32 factor, u32 bias) noexcept
+{
+    const uint16x8_t b = vdupq_n_u16(static_cast<u16>(bias));
+    return ChannelOp4(val, val, [&](uint16x8_t c, uint16x8_t, int) {
+        const uint16x8_t up = vmlaq_n_u16(b, vsubq_u16(vdupq_n_u16(0x3F), c), static_cast<u16>(factor));
+        return vaddq_u16(c, vshrq_n_u16(up, 4));
+    });
+}
+
+inline Pixels4 BrightnessDown4(Pixels4 val, u32 factor, u32 bias) noexcept
+{
+    const uint16x8_t b = vdupq_n_u16(static_cast<u16>(bias));
+    return ChannelOp4(val, val, [&](uint16x8_t c, uint16x8_t, int) {
+        return vsubq_u16(c, vshrq_n_u16(vmlaq_n_u16(b, c, static_cast<u16>(factor)), 4));
+    });
+}
+
+#endif
+
+#if defined(NATIVECPU_SSE2) || defined(NATIVECPU_NEON)
+#define NATIVECPU_SIMD
+
+// mask ? a : b, per pixel
+inline Pixels4 Select4(Pixels4 mask, Pixels4 a, Pixels4 b) noexcept
+{
+    return Or4(And4(mask, a), AndNot4(mask, b));
+}
+
+// all ones where `val` isn't zero
+inline Pixels4 NonZero4(Pixels4 val) noexcept
+{
+    return AndNot4(Equal4(val, Splat4(0)), Splat4(0xFFFFFFFF));
+}
+
+inline Pixels4 AnyBits4(Pixels4 val, u32 bits) noexcept
+{
+    return NonZero4(And4(val, Splat4(bits)));
+}
+#endif
+
+// One of the address spaces a line reads, as the native shader sees it: the
+// frame-start contents, overridden per 512-byte block by the line's timeline
+// row, plus the native capture overlay for BG and OBJ VRAM.
+struct Region
+{
+    const u8* Base = nullptr;
+    u32 Size = 0;
+    const u32* Versions = nullptr;
+    const u32* Overlay = nullptr;
+    u32 OverlayEntries = 0;
+};
+
+class LineMemory
+{
+public:
+    LineMemory(const FrameInput& input, const u8* lcdc, u32 engine, u32 line) noexcept
+        : Payload(input.TimelinePayload.data()), LCDC(lcdc)
+    {
+        const MemorySnapshot& snap = input.Engine[engine];
+        const u32 row = input.TimelineRowIds[line];
+        const u32 engineBlock = TimelineEngineBaseBlock + engine * TimelineEngineBlocks;
+        const bool latch = input.Lines[engine * ScreenHeight + line].SpriteLatchValid & SpriteLatchValidMask;
+        const u32 spriteRow = input.SpriteTimelineRowIds[line];
+
+        BG = {snap.BGVRAM.data(), snap.BGSize, TimelineRow(input.TimelineRows, row, engineBlock)};
+        OBJ = {snap.OBJVRAM.data(), snap.OBJSize,
+               latch ? SpriteTimelineRow(input.SpriteTimelineRows, spriteRow,
+                                         SpriteTimelineOAMBlocks + engine * SpriteTimelineEngineOBJBlocks)
+                     : TimelineRow(input.TimelineRows, row, engineBlock + TimelineEngineBGBlocks)};
+        BGExt = {snap.BGExtendedPalette.data(), snap.BGExtendedPaletteSize,
+                 TimelineRow(input.TimelineRows, row, engineBlock + TimelineEngineBGBlocks + TimelineEngineOBJBlocks)};
+        OBJExt = {snap.OBJExtendedPalette.data(), snap.OBJExtendedPaletteSize,
+                  TimelineRow(input.TimelineRows, row, engineBlock + TimelineEngineBGBlocks
+                              + TimelineEngineOBJBlocks + TimelineEngineBGExtBlocks)};
+        Palette = {&input.Palette[engine * 0x400], 0x400,
+                   TimelineRow(input.TimelineRows, row, TimelinePaletteBaseBlock + engine * 2)};
+        OAM = {&input.OAM[engine * 0x400], 0x400,
+               latch ? SpriteTimelineRow(input.SpriteTimelineRows, spriteRow, engine * 2)
+                     : TimelineRow(input.TimelineRows, row, TimelineOAMBaseBlock + engine * 2)};
+
+        if (input.NativeCaptureOverlayAny & NativeCaptureOverlayAnyMask)
+        {
+            const u32* bgRow = &input.NativeCaptureBGMapping[line * NativeCaptureBGMappingStride + (engine ? 32 : 0)];
+            if (bgRow[0] & NativeCaptureOverlayPresent)
+            {
+                BG.Overlay = bgRow;
+                BG.OverlayEntries = engine ? 8 : 32;
+            }
+            const u32* objRow = &(latch ? input.NativeCaptureSpriteOBJMapping : input.NativeCaptureOBJMapping)
+                [line * NativeCaptureOBJMappingStride + (engine ? 16 : 0)];
+            if (objRow[0] & NativeCaptureOverlayPresent)
+            {
+                OBJ.Overlay = objRow;
+                OBJ.OverlayEntries = engine ? 8 : 16;
+            }
+        }
+    }
+
+    u8 Read8(const Region& region, u32 addr) const noexcept
+    {
+        if (region.Size == 0)
+            return 0;
+
+        const u32 offset = addr & (region.Size - 1);
+        const u32 version = region.Versions ? region.Versions[offset / DirtyBlockBytes] : 0;
+        u8 val = (version == 0 || version > MaxMemoryDeltas)
+            ? region.Base[offset]
+            : Payload[(version - 1) * DirtyBlockBytes + (offset & (DirtyBlockBytes - 1))];
+
+        if (region.Overlay && (offset >> 14) < region.OverlayEntries)
+        {
+            // bytes a native capture owns were left out of the snapshot
+            u32 banks = region.Overlay[offset >> 14] & NativeCaptureBankMask;
+            while (banks)
+            {
+                const u32 bank = __builtin_ctz(banks);
+                banks &= banks - 1;
+                val |= LCDC[bank * LCDCBankBytes + (offset & LCDCBankByteMask)];
+            }
+        }
+        return val;
+    }
+
+    u16 Read16(const Region& region, u32 addr) const noexcept
+    {
+        return Read8(region, addr) | (Read8(region, addr + 1) << 8);
+    }
+
+    Region BG, OBJ, BGExt, OBJExt, Palette, OAM;
+
+private:
+    const u8* Payload;
+    const u8* LCDC;
+};
+
+// Port of SoftRenderer2D's BG/OBJ line rendering over a recorded line.
+class LineRenderer
+{
+public:
+    LineRenderer(const FrameInput& input, const u8* lcdc, u32 engine, u32 line) noexcept
+        : State(input.Lines[engine * ScreenHeight + line]),
+          SpriteState(input.Lines[engine * ScreenHeight + (line ? line - 1 : 0)]),
+          Mem(input, lcdc, engine, line), Num(engine), Line(line),
+          OBJMosaicLine(line ? SpriteState.OBJMosaicLine : 0)
+    {
+    }
+
+    void DrawScanline(const u32* line3D, u32* dst) noexcept;
+
+private:
+    u32 ColorComposite(int i, u32 val1, u32 val2) const noexcept;
+    void CompositeLine(u32* dst) const noexcept;
+    void DrawScanline_BGOBJ(u32* dst) noexcept;
+    void DrawScanlineBGMode(u32 bgmode) noexcept;
+    void DrawScanlineBGMode6() noexcept;
+    void DrawScanlineBGMode7() noexcept;
+    void CalculateWindowMask() noexcept;
+
+    void DrawPixel(u32* dst, u16 color, u32 flag) noexcept;
+    void DrawBG_3D() noexcept;
+    void DrawBG_Text(u32 bgnum) noexcept;
+    void DrawBG_Affine(u32 bgnum) noexcept;
+    void DrawBG_Extended(u32 bgnum) noexcept;
+    void DrawBG_Large() noexcept;
+
+    void DrawSprites() noexcept;
+    void DrawSpritePixel(bool window, int color, u32 pixelattr, s32 xpos) noexcept;
+    void DrawSprite_Rotscale(bool window, u32 num, u32 boundwidth, u32 boundheight, u32 width, u32 height, s32 xpos, s32 ypos) noexcept;
+    void DrawSprite_Normal(bool window, u32 num, u32 width, u32 height, s32 xpos, s32 ypos) noexcept;
+    void ApplySpriteMosaicX() noexcept;
+    void InterleaveSprites(u32 prio) noexcept;
+
+    bool Mosaic(u32 bgnum) const noexcept
+    {
+        return (State.BGCnt[bgnum] & (1<<6)) && (State.BGMosaicSize[0] & 0xF) > 0;
+    }
+
+    // mosaic X offset of pixel i, 0 for a BG without mosaic
+    u32 MosaicX(bool mosaic, u32 i) const noexcept
+    {
+        return mosaic ? i % ((State.BGMosaicSize[0] & 0xF) + 1) : 0;
+    }
+
+    const LineState& State;
+    // sprites are prepared during the line above (DrawSprites(line+1)), with
+    // its registers; line 0's are prepared at VCOUNT 262, with the OBJ
+    // mosaic reset
+    const LineState& SpriteState;
+    LineMemory Mem;
+    u32 Num;
+    u32 Line;
+    u32 OBJMosaicLine;
+    const u32* Output3D = nullptr;
+
+    alignas(8) u32 BGOBJLine[256*2];
+    alignas(8) u32 OBJLine[256];
+    alignas(8) u8 WindowMask[256];
+    alignas(8) u8 OBJWindow[256];
+    u32 NumSprites = 0;
+};
+
+u32 LineRenderer::ColorComposite(int i, u32 val1, u32 val2) const noexcept
+{
+    u32 coloreffect = 0;
+    u32 eva = 0, evb = 0;
+
+    u32 flag1 = val1 >> 24;
+    u32 flag2 = val2 >> 24;
+
+    u32 blendCnt = State.BlendCnt;
+
+    u32 target2;
+    if      (flag2 & 0x80) target2 = 0x1000;
+    else if (flag2 & 0x40) target2 = 0x0100;
+    else                   target2 = flag2 << 8;
+
+    if ((flag1 & 0x80) && (blendCnt & target2))
+    {
+        // sprite blending
+
+        coloreffect = 1;
+
+        if (flag1 & 0x40)
+        {
+            eva = flag1 & 0x1F;
+            evb = 16 - eva;
+        }
+        else
+        {
+            eva = State.EVA;
+            evb = State.EVB;
+        }
+    }
+    else if ((flag1 & 0x40) && (blendCnt & target2))
+    {
+        // 3D layer blending
+
+        coloreffect = 4;
+    }
+    else
+    {
+        if      (flag1 & 0x80) flag1 = 0x10;
+        else if (flag1 & 0x40) flag1 = 0x01;
+
+        if ((blendCnt & flag1) && (WindowMask[i] & 0x20))
+        {
+            coloreffect = (blendCnt >> 6) & 0x3;
+
+            if (coloreffect == 1)
+            {
+                if (blendCnt & target2)
+                {
+                    eva = State.EVA;
+                    evb = State.EVB;
+                }
+                else
+                    coloreffect = 0;
+            }
+        }
+    }
+
+    switch (coloreffect)
+    {
+        case 0: return val1;
+        case 1: return ColorBlend4(val1, val2, eva, evb);
+        case 2: return ColorBrightnessUp(val1, State.EVY, 0x8);
+        case 3: return ColorBrightnessDown(val1, State.EVY, 0x7);
+        case 4: return ColorBlend5(val1, val2);
+    }
+
+    return val1;
+}
+
+void LineRenderer::DrawScanline(const u32* line3D, u32* dst) noexcept
+{
+    if (!State.UnitEnabled)
+    {
+        // black for unit A, white for unit B
+        std::fill_n(dst, 256, Num == 0 ? 0xFF000000 : 0xFF3F3F3F);
+        return;
+    }
+    if (State.ForcedBlank)
+    {
+        std::fill_n(dst, 256, 0xFF3F3F3F);
+        return;
+    }
+
+    Output3D = line3D;
+    DrawSprites();
+    DrawScanline_BGOBJ(dst);
+}
+
+void LineRenderer::DrawScanline_BGOBJ(u32* dst) noexcept
+{
+    u32 backdrop = Mem.Read16(Mem.Palette, 0);
+    {
+        u8 r = (backdrop & 0x001F) << 1;
+        u8 g = ((backdrop & 0x03E0) >> 4) | ((backdrop & 0x8000) >> 15);
+        u8 b = (backdrop & 0x7C00) >> 9;
+
+        backdrop = r | (g << 8) | (b << 16) | 0x20000000;
+        std::fill_n(&BGOBJLine[0], 256, backdrop);
+        std::fill_n(&BGOBJLine[256], 256, 0);
+    }
+
+    if (State.DispCnt & 0xE000)
+        CalculateWindowMask();
+    else
+        memset(WindowMask, 0xFF, 256);
+
+    ApplySpriteMosaicX();
+
+    switch (State.DispCnt & 0x7)
+    {
+        case 6: DrawScanlineBGMode6(); break;
+        case 7: DrawScanlineBGMode7(); break;
+        default: DrawScanlineBGMode(State.DispCnt & 0x7); break;
+    }
+
+    CompositeLine(dst);
+}
+
+// color special effects
+void LineRenderer::CompositeLine(u32* dst) const noexcept
+{
+    int i = 0;
+#if defined(NATIVECPU_SIMD)
+    // ColorComposite() on four pixels at a time: each of its cases becomes a
+    // mask, and the blend weights are per pixel, since semi-transparent
+    // sprites and 3D pixels bring their own
+    const u32 effect = (State.BlendCnt >> 6) & 0x3;
+    const Pixels4 blendCnt = Splat4(State.BlendCnt);
+    const Pixels4 eva = Splat4(State.EVA * 2);
+    const Pixels4 evb = Splat4(State.EVB * 2);
+    for (; i < 256; i += 4)
+    {
+        const Pixels4 val1 = Load4(&BGOBJLine[i]);
+        const Pixels4 val2 = Load4(&BGOBJLine[256+i]);
+        const Pixels4 flag1 = Flags4(val1);
+        const Pixels4 flag2 = Flags4(val2);
+        const Pixels4 sprite1 = AnyBits4(flag1, 0x80);
+        const Pixels4 layer3D1 = AnyBits4(flag1, 0x40);
+
+        const Pixels4 target2 = Select4(AnyBits4(flag2, 0x80), Splat4(0x1000),
+                                        Select4(AnyBits4(flag2, 0x40), Splat4(0x0100), ShiftLeft4<8>(flag2)));
+        const Pixels4 isTarget2 = NonZero4(And4(blendCnt, target2));
+
+        const Pixels4 spriteBlend = And4(sprite1, isTarget2);
+        const Pixels4 alpha = And4(flag1, Splat4(0x1F));
+        const Pixels4 eva3D = Add4(alpha, Splat4(1));
+        // ColorBlend5() leaves a fully opaque 3D pixel as it is
+        const Pixels4 blend3D = AndNot4(Or4(sprite1, Equal4(eva3D, Splat4(32))), And4(layer3D1, isTarget2));
+
+        const Pixels4 layer = Select4(sprite1, Splat4(0x10), Select4(layer3D1, Splat4(0x01), flag1));
+        const Pixels4 regular = AndNot4(Or4(spriteBlend, And4(layer3D1, isTarget2)),
+                                        And4(NonZero4(And4(blendCnt, layer)),
+                                             AnyBits4(LoadBytes4(&WindowMask[i]), 0x20)));
+
+        Pixels4 blend = Or4(spriteBlend, blend3D);
+        Pixels4 bright = Splat4(0);
+        if (effect == 1)
+            blend = Or4(blend, And4(regular, isTarget2));
+        else if (effect != 0)
+            bright = regular;
+
+        if (!Any4(Or4(blend, bright)))
+        {
+            Store4(&dst[i], val1);
+            continue;
+        }
+
+        Pixels4 out = val1;
+        if (Any4(bright))
+        {
+            out = Select4(bright, effect == 2 ? BrightnessUp4(val1, State.EVY, 0x8)
+                                              : BrightnessDown4(val1, State.EVY, 0x7), out);
+        }
+        if (Any4(blend))
+        {
+            // bitmap sprites bring their alpha, other sprites use BLDALPHA
+            const Pixels4 spriteEVA = Select4(layer3D1, ShiftLeft4<1>(alpha), eva);
+            const Pixels4 spriteEVB = Select4(layer3D1, ShiftLeft4<1>(Sub4(Splat4(16), alpha)), evb);
+            const Pixels4 blendEVA = Select4(spriteBlend, spriteEVA, Select4(blend3D, eva3D, eva));
+            const Pixels4 blendEVB = Select4(spriteBlend, spriteEVB,
+                                             Select4(blend3D, Sub4(Splat4(32), eva3D), evb));
+            out = Select4(blend, Blend4(val1, val2, blendEVA, blendEVB), out);
+        }
+        Store4(&dst[i], out);
+    }
+#endif
+    for (; i < 256; i++)
+        dst[i] = ColorComposite(i, BGOBJLine[i], BGOBJLine[256+i]);
+}
+
+void LineRenderer::CalculateWindowMask() noexcept
+{
+    // GPU2D::CalculateWindowMask() runs the window X counters over the line
+    // from their state at the start of it, which is what the line recorded
+    memset(WindowMask, State.WinCnt[2], 256); // window outside
+
+    if (State.DispCnt & (1<<15))
+    {
+        // OBJ window
+        for (int i = 0; i < 256; i++)
+        {
+            if (OBJWindow[i])
+                WindowMask[i] = State.WinCnt[3];
+        }
+    }
+
+    if (State.DispCnt & (1<<14))
+    {
+        // window 1
+        u8 x1 = State.Win1Coords[0];
+        u8 x2 = State.Win1Coords[1];
+        u32 active = State.Win1Active;
+
+        for (int i = 0; i < 256; i++)
+        {
+            if (i == x2)      active &= ~0x2;
+            else if (i == x1) active |=  0x2;
+
+            if (active == 0x3) WindowMask[i] = State.WinCnt[1];
+        }
+    }
+
+    if (State.DispCnt & (1<<13))
+    {
+        // window 0
+        u8 x1 = State.Win0Coords[0];
+        u8 x2 = State.Win0Coords[1];
+        u32 active = State.Win0Active;
+
+        for (int i = 0; i < 256; i++)
+        {
+            if (i == x2)      active &= ~0x2;
+            else if (i == x1) active |=  0x2;
+
+            if (active == 0x3) WindowMask[i] = State.WinCnt[0];
+        }
+    }
+}
+
+void LineRenderer::DrawScanlineBGMode(u32 bgmode) noexcept
+{
+    u32 dispCnt = State.DispCnt;
+    const auto& bgCnt = State.BGCnt;
+    for (u32 i = 4; i-- > 0;)
+    {
+        if ((bgCnt[3] & 0x3) == i)
+        {
+            if (State.LayerEnable & (1<<3))
+            {
+                if (bgmode >= 3)
+                    DrawBG_Extended(3);
+                else if (bgmode >= 1)
+                    DrawBG_Affine(3);
+                else
+                    DrawBG_Text(3);
+            }
+        }
+        if ((bgCnt[2] & 0x3) == i)
+        {
+            if (State.LayerEnable & (1<<2))
+            {
+                if (bgmode == 5)
+                    DrawBG_Extended(2);
+                else if (bgmode == 4 || bgmode == 2)
+                    DrawBG_Affine(2);
+                else
+                    DrawBG_Text(2);
+            }
+        }
+        if ((bgCnt[1] & 0x3) == i)
+        {
+            if (State.LayerEnable & (1<<1))
+                DrawBG_Text(1);
+        }
+        if ((bgCnt[0] & 0x3) == i)
+        {
+            if (State.LayerEnable & (1<<0))
+            {
+                if (!Num && (dispCnt & 0x8))
+                    DrawBG_3D();
+                else
+                    DrawBG_Text(0);
+            }
+        }
+        if ((State.LayerEnable & (1<<4)) && NumSprites)
+            InterleaveSprites(i);
+    }
+}
+
+void LineRenderer::DrawScanlineBGMode6() noexcept
+{
+    u32 dispCnt = State.DispCnt;
+    const auto& bgCnt = State.BGCnt;
+    for (u32 i = 4; i-- > 0;)
+    {
+        if ((bgCnt[2] & 0x3) == i)
+        {
+            if (State.LayerEnable & (1<<2))
+                DrawBG_Large();
+        }
+        if ((bgCnt[0] & 0x3) == i)
+        {
+            if (State.LayerEnable & (1<<0))
+            {
+                if (!Num && (dispCnt & 0x8))
+                    DrawBG_3D();
+            }
+        }
+        if ((State.LayerEnable & (1<<4)) && NumSprites)
+            InterleaveSprites(i);
+    }
+}
+
+void LineRenderer::DrawScanlineBGMode7() noexcept
+{
+    u32 dispCnt = State.DispCnt;
+    const auto& bgCnt = State.BGCnt;
+    // mode 7 only has text-mode BG0 and BG1
+    for (u32 i = 4; i-- > 0;)
+    {
+        if ((bgCnt[1] & 0x3) == i)
+        {
+            if (State.LayerEnable & (1<<1))
+                DrawBG_Text(1);
+        }
+        if ((bgCnt[0] & 0x3) == i)
+        {
+            if (State.LayerEnable & (1<<0))
+            {
+                if (!Num && (dispCnt & 0x8))
+                    DrawBG_3D();
+                else
+                    DrawBG_Text(0);
+            }
+        }
+        if ((State.LayerEnable & (1<<4)) && NumSprites)
+            InterleaveSprites(i);
+    }
+}
+
+void LineRenderer::DrawPixel(u32* dst, u16 color, u32 flag) noexcept
+{
+    u8 r = (color & 0x001F) << 1;
+    u8 g = ((color & 0x03E0) >> 4) | ((color & 0x8000) >> 15);
+    u8 b = (color & 0x7C00) >> 9;
+
+    *(dst+256) = *dst;
+    *dst = r | (g << 8) | (b << 16) | flag;
+}
+
+void LineRenderer::DrawBG_3D() noexcept
+{
+    if (!Output3D)
+        return;
+
+    for (int i = 0; i < 256; i++)
+    {
+        u32 c = Output3D[i];
+
+        if ((c >> 24) == 0) continue;
+        if (!(WindowMask[i] & 0x01)) continue;
+
+        BGOBJLine[i+256] = BGOBJLine[i];
+        BGOBJLine[i] = c | 0x40000000;
+    }
+}
+
+void LineRenderer::DrawBG_Text(u32 bgnum) noexcept
+{
+    u16 bgcnt = State.BGCnt[bgnum];
+    bool mosaic = Mosaic(bgnum);
+
+    u32 tilesetaddr, tilemapaddr;
+    u32 extpal, extpalslot = 0;
+
+    u16 xoff = State.BGXPos[bgnum];
+    u16 yoff = State.BGYPos[bgnum];
+
+    if (bgcnt & (1<<6))
+        yoff += State.BGMosaicLine;
+    else
+        yoff += Line;
+
+    u32 widexmask = (bgcnt & (1<<14)) ? 0x100 : 0;
+
+    extpal = (State.DispCnt & (1<<30));
+    if (extpal) extpalslot = ((bgnum<2) && (bgcnt&0x2000)) ? (2+bgnum) : bgnum;
+
+    if (Num)
+    {
+        tilesetaddr = ((bgcnt & 0x003C) << 12);
+        tilemapaddr = ((bgcnt & 0x1F00) << 3);
+    }
+    else
+    {
+        tilesetaddr = ((State.DispCnt & 0x07000000) >> 8) + ((bgcnt & 0x003C) << 12);
+        tilemapaddr = ((State.DispCnt & 0x38000000) >> 11) + ((bgcnt & 0x1F00) << 3);
+    }
+
+    // adjust Y position in tilemap
+    if (bgcnt & (1<<15))
+    {
+        tilemapaddr += ((yoff & 0x1F8) << 3);
+        if (bgcnt & (1<<14))
+            tilemapaddr += ((yoff & 0x100) << 3);
+    }
+    else
+        tilemapaddr += ((yoff & 0xF8) << 3);
+
+    // the tile only changes every 8 pixels, mosaic or not
+    u32 lastcolumn = ~0u;
+    u16 curtile = 0;
+    u32 pixelsaddr = 0;
+
+    for (u32 i = 0; i < 256; i++, xoff++)
+    {
+        if (!(WindowMask[i] & (1<<bgnum)))
+            continue;
+
+        u32 xpos = (u16)(xoff - MosaicX(mosaic, i));
+        u32 column = (xpos & 0xF8) | (xpos & widexmask);
+        if (column != lastcolumn)
+        {
+            curtile = Mem.Read16(Mem.BG, tilemapaddr + ((xpos & 0xF8) >> 2) + ((xpos & widexmask) << 3));
+            u32 tileyoff = (curtile & (1<<11)) ? (7-(yoff&0x7)) : (yoff&0x7);
+            if (bgcnt & (1<<7))
+                pixelsaddr = tilesetaddr + ((curtile & 0x03FF) << 6) + (tileyoff << 3);
+            else
+                pixelsaddr = tilesetaddr + ((curtile & 0x03FF) << 5) + (tileyoff << 2);
+            lastcolumn = column;
+        }
+
+        u32 tilexoff = (curtile & (1<<10)) ? (7-(xpos&0x7)) : (xpos&0x7);
+        u16 color;
+        if (bgcnt & (1<<7))
+        {
+            // 256-color
+            u8 index = Mem.Read8(Mem.BG, pixelsaddr + tilexoff);
+            if (!index) continue;
+
+            if (extpal)
+                color = Mem.Read16(Mem.BGExt, (extpalslot * 16 + (curtile >> 12)) * 512 + index * 2);
+            else
+                color = Mem.Read16(Mem.Palette, index * 2);
+        }
+        else
+        {
+            // 16-color
+            u8 index = Mem.Read8(Mem.BG, pixelsaddr + (tilexoff >> 1));
+            index = (tilexoff & 0x1) ? (index >> 4) : (index & 0x0F);
+            if (!index) continue;
+
+            color = Mem.Read16(Mem.Palette, ((curtile & 0xF000) >> 7) + index * 2);
+        }
+
+        DrawPixel(&BGOBJLine[i], color, 0x01000000<<bgnum);
+    }
+}
+
+void LineRenderer::DrawBG_Affine(u32 bgnum) noexcept
+{
+    u16 bgcnt = State.BGCnt[bgnum];
+    bool mosaic = Mosaic(bgnum);
+
+    u32 tilesetaddr, tilemapaddr;
+
+    u32 coordmask;
+    u32 yshift;
+    switch ((bgcnt >> 14) & 0x3)
+    {
+        case 0: coordmask = 0x07800; yshift = 7; break;
+        case 1: coordmask = 0x0F800; yshift = 8; break;
+        case 2: coordmask = 0x1F800; yshift = 9; break;
+        default: coordmask = 0x3F800; yshift = 10; break;
+    }
+
+    u32 overflowmask;
+    if (bgcnt & (1<<13)) overflowmask = 0;
+    else                 overflowmask = ~(coordmask | 0x7FF);
+
+    s16 rotA = State.BGRotA[bgnum-2];
+    s16 rotC = State.BGRotC[bgnum-2];
+
+    s32 rotX = State.BGXRefInternal[bgnum-2];
+    s32 rotY = State.BGYRefInternal[bgnum-2];
+
+    if (Num)
+    {
+        tilesetaddr = ((bgcnt & 0x003C) << 12);
+        tilemapaddr = ((bgcnt & 0x1F00) << 3);
+    }
+    else
+    {
+        tilesetaddr = ((State.DispCnt & 0x07000000) >> 8) + ((bgcnt & 0x003C) << 12);
+        tilemapaddr = ((State.DispCnt & 0x38000000) >> 11) + ((bgcnt & 0x1F00) << 3);
+    }
+
+    yshift -= 3;
+
+    for (u32 i = 0; i < 256; i++, rotX += rotA, rotY += rotC)
+    {
+        if (!(WindowMask[i] & (1<<bgnum)))
+            continue;
+
+        s32 im = MosaicX(mosaic, i);
+        s32 finalX = rotX - (im * rotA);
+        s32 finalY = rotY - (im * rotC);
+
+        if ((finalX|finalY) & overflowmask)
+            continue;
+
+        u32 curtile = Mem.Read8(Mem.BG, tilemapaddr + ((((finalY & coordmask) >> 11) << yshift) + ((finalX & coordmask) >> 11)));
+
+        u32 tilexoff = (finalX >> 8) & 0x7;
+        u32 tileyoff = (finalY >> 8) & 0x7;
+
+        u8 color = Mem.Read8(Mem.BG, tilesetaddr + (curtile << 6) + (tileyoff << 3) + tilexoff);
+        if (color)
+            DrawPixel(&BGOBJLine[i], Mem.Read16(Mem.Palette, color * 2), 0x01000000<<bgnum);
+    }
+}
+
+void LineRenderer::DrawBG_Extended(u32 bgnum) noexcept
+{
+    u16 bgcnt = State.BGCnt[bgnum];
+    bool mosaic = Mosaic(bgnum);
+
+    u32 tilesetaddr, tilemapaddr;
+    u32 extpal = (State.DispCnt & (1<<30));
+
+    s16 rotA = State.BGRotA[bgnum-2];
+    s16 rotC = State.BGRotC[bgnum-2];
+
+    s32 rotX = State.BGXRefInternal[bgnum-2];
+    s32 rotY = State.BGYRefInternal[bgnum-2];
+
+    if (bgcnt & (1<<7))
+    {
+        // bitmap modes
+
+        u32 xmask, ymask;
+        u32 yshift;
+        switch ((bgcnt >> 14) & 0x3)
+        {
+            case 0: xmask = 0x07FFF; ymask = 0x07FFF; yshift = 7; break;
+            case 1: xmask = 0x0FFFF; ymask = 0x0FFFF; yshift = 8; break;
+            case 2: xmask = 0x1FFFF; ymask = 0x0FFFF; yshift = 9; break;
+            default: xmask = 0x1FFFF; ymask = 0x1FFFF; yshift = 9; break;
+        }
+
+        u32 ofxmask, ofymask;
+        if (bgcnt & (1<<13))
+        {
+            ofxmask = 0;
+            ofymask = 0;
+        }
+        else
+        {
+            ofxmask = ~xmask;
+            ofymask = ~ymask;
+        }
+
+        tilemapaddr = ((bgcnt & 0x1F00) << 6);
+
+        for (u32 i = 0; i < 256; i++, rotX += rotA, rotY += rotC)
+        {
+            if (!(WindowMask[i] & (1<<bgnum)))
+                continue;
+
+            s32 im = MosaicX(mosaic, i);
+            s32 finalX = rotX - (im * rotA);
+            s32 finalY = rotY - (im * rotC);
+
+            if ((finalX & ofxmask) || (finalY & ofymask))
+                continue;
+
+            u32 pixel = (((finalY & ymask) >> 8) << yshift) + ((finalX & xmask) >> 8);
+            if (bgcnt & (1<<2))
+            {
+                // direct color bitmap
+                u16 color = Mem.Read16(Mem.BG, tilemapaddr + (pixel << 1));
+                if (color & 0x8000)
+                    DrawPixel(&BGOBJLine[i], color & 0x7FFF, 0x01000000<<bgnum);
+            }
+            else
+            {
+                // 256-color bitmap
+                u8 color = Mem.Read8(Mem.BG, tilemapaddr + pixel);
+                if (color)
+                    DrawPixel(&BGOBJLine[i], Mem.Read16(Mem.Palette, color * 2), 0x01000000<<bgnum);
+            }
+        }
+    }
+    else
+    {
+        // mixed affine/text mode
+
+        u32 coordmask;
+        u32 yshift;
+        switch ((bgcnt >> 14) & 0x3)
+        {
+            case 0: coordmask = 0x07800; yshift = 7; break;
+            case 1: coordmask = 0x0F800; yshift = 8; break;
+            case 2: coordmask = 0x1F800; yshift = 9; break;
+            default: coordmask = 0x3F800; yshift = 10; break;
+        }
+
+        u32 overflowmask;
+        if (bgcnt & (1<<13)) overflowmask = 0;
+        else                 overflowmask = ~(coordmask | 0x7FF);
+
+        if (Num)
+        {
+            tilesetaddr = ((bgcnt & 0x003C) << 12);
+            tilemapaddr = ((bgcnt & 0x1F00) << 3);
+        }
+        else
+        {
+            tilesetaddr = ((State.DispCnt & 0x07000000) >> 8) + ((bgcnt & 0x003C) << 12);
+            tilemapaddr = ((State.DispCnt & 0x38000000) >> 11) + ((bgcnt & 0x1F00) << 3);
+        }
+
+        yshift -= 3;
+
+        for (u32 i = 0; i < 256; i++, rotX += rotA, rotY += rotC)
+        {
+            if (!(WindowMask[i] & (1<<bgnum)))
+                continue;
+
+            s32 im = MosaicX(mosaic, i);
+            s32 finalX = rotX - (im * rotA);
+            s32 finalY = rotY - (im * rotC);
+
+            if ((finalX|finalY) & overflowmask)
+                continue;
+
+            u16 curtile = Mem.Read16(Mem.BG, tilemapaddr + (((((finalY & coordmask) >> 11) << yshift) + ((finalX & coordmask) >> 11)) << 1));
+
+            u32 tilexoff = (finalX >> 8) & 0x7;
+            u32 tileyoff = (finalY >> 8) & 0x7;
+
+            if (curtile & (1<<10)) tilexoff = 7-tilexoff;
+            if (curtile & (1<<11)) tileyoff = 7-tileyoff;
+
+            u8 color = Mem.Read8(Mem.BG, tilesetaddr + ((curtile & 0x03FF) << 6) + (tileyoff << 3) + tilexoff);
+            if (!color)
+                continue;
+
+            if (extpal)
+                DrawPixel(&BGOBJLine[i], Mem.Read16(Mem.BGExt, (bgnum * 16 + (curtile >> 12)) * 512 + color * 2), 0x01000000<<bgnum);
+            else
+                DrawPixel(&BGOBJLine[i], Mem.Read16(Mem.Palette, color * 2), 0x01000000<<bgnum);
+        }
+    }
+}
+
+void LineRenderer::DrawBG_Large() noexcept // BG is always BG2
+{
+    u16 bgcnt = State.BGCnt[2];
+    bool mosaic = Mosaic(2);
+
+    // large BG sizes:
+    // 0: 512x1024
+    // 1: 1024x512
+    // 2: 512x256
+    // 3: 512x512
+    u32 xmask, ymask;
+    u32 yshift;
+    switch ((bgcnt >> 14) & 0x3)
+    {
+        case 0: xmask = 0x1FFFF; ymask = 0x3FFFF; yshift = 9; break;
+        case 1: xmask = 0x3FFFF; ymask = 0x1FFFF; yshift = 10; break;
+        case 2: xmask = 0x1FFFF; ymask = 0x0FFFF; yshift = 9; break;
+        default: xmask = 0x1FFFF; ymask = 0x1FFFF; yshift = 9; break;
+    }
+
+    u32 ofxmask, ofymask;
+    if (bgcnt & (1<<13))
+    {
+        ofxmask = 0;
+        ofymask = 0;
+    }
+    else
+    {
+        ofxmask = ~xmask;
+        ofymask = ~ymask;
+    }
+
+    s16 rotA = State.BGRotA[0];
+    s16 rotC = State.BGRotC[0];
+
+    s32 rotX = State.BGXRefInternal[0];
+    s32 rotY = State.BGYRefInternal[0];
+
+    for (u32 i = 0; i < 256; i++, rotX += rotA, rotY += rotC)
+    {
+        if (!(WindowMask[i] & (1<<2)))
+            continue;
+
+        s32 im = MosaicX(mosaic, i);
+        s32 finalX = rotX - (im * rotA);
+        s32 finalY = rotY - (im * rotC);
+
+        if ((finalX & ofxmask) || (finalY & ofymask))
+            continue;
+
+        u8 color = Mem.Read8(Mem.BG, (((finalY & ymask) >> 8) << yshift) + ((finalX & xmask) >> 8));
+        if (color)
+            DrawPixel(&BGOBJLine[i], Mem.Read16(Mem.Palette, color * 2), 0x01000000<<2);
+    }
+}
+
+void LineRenderer::ApplySpriteMosaicX() noexcept
+{
+    // see SoftRenderer2D::ApplySpriteMosaicX() for the rules
+    u8 mosw = State.OBJMosaicSize[0];
+    if (mosw == 0) return;
+
+    u8 mosx = 0;
+    u32 latchcolor = 0;
+    for (int i = 0; i < 256; i++)
+    {
+        u32 curcolor = OBJLine[i];
+        bool latch = false;
+
+        if (mosx == 0)
+            latch = true;
+        else if (!(curcolor & OBJ_Mosaic))
+            latch = true;
+        else if (!(latchcolor & OBJ_Mosaic))
+            latch = true;
+        else if ((curcolor & OBJ_BGPrioMask) < (latchcolor & OBJ_BGPrioMask))
+            latch = true;
+
+        if (latch)
+            latchcolor = curcolor;
+
+        OBJLine[i] = latchcolor;
+
+        if (mosx == mosw)
+            mosx = 0;
+        else
+            mosx++;
+    }
+}
+
+void LineRenderer::InterleaveSprites(u32 prio) noexcept
+{
+    u32 attrmask = (prio << 16) | OBJ_IsOpaque;
+    // the OBJ palette, within this engine's half of palette RAM
+    const u32 pal = 0x200;
+
+    for (u32 i = 0; i < 256; i++)
+    {
+        if ((OBJLine[i] & OBJ_OpaPrioMask) != attrmask)
+            continue;
+        if (!(WindowMask[i] & 0x10))
+            continue;
+
+        u16 color;
+        u32 pixel = OBJLine[i];
+
+        if (pixel & OBJ_DirectColor)
+            color = pixel & 0x7FFF;
+        else if (pixel & OBJ_StandardPal)
+            color = Mem.Read16(Mem.Palette, pal + (pixel & 0xFF) * 2);
+        else
+            color = Mem.Read16(Mem.OBJExt, (pixel & 0xFFF) * 2);
+
+        DrawPixel(&BGOBJLine[i], color, pixel & 0xFF000000);
+    }
+}
+
+void LineRenderer::DrawSprites() noexcept
+{
+    NumSprites = 0;
+    memset(OBJLine, 0, sizeof(OBJLine));
+    memset(OBJWindow, 0, sizeof(OBJWindow));
+
+    if (!SpriteState.OBJEnable)
+        return;
+
+    static constexpr s32 spritewidth[16] =
+    {
+        8, 16, 8, 8,
+        16, 32, 8, 8,
+        32, 32, 16, 8,
+        64, 64, 32, 8
+    };
+    static constexpr s32 spriteheight[16] =
+    {
+        8, 8, 16, 8,
+        16, 8, 32, 8,
+        32, 16, 32, 8,
+        64, 32, 64, 8
+    };
+
+    for (u32 sprnum = 0; sprnum < 128; sprnum++)
+    {
+        u16 attrib0 = Mem.Read16(Mem.OAM, sprnum*8);
+        u16 attrib1 = Mem.Read16(Mem.OAM, sprnum*8 + 2);
+
+        u16 sprtype = (attrib0 >> 8) & 0x3;
+        if (sprtype == 2) // disabled
+            continue;
+
+        bool iswin = (((attrib0 >> 10) & 0x3) == 2);
+
+        u32 sizeparam = (attrib0 >> 14) | ((attrib1 & 0xC000) >> 12);
+        s32 width = spritewidth[sizeparam];
+        s32 height = spriteheight[sizeparam];
+        s32 boundwidth = width;
+        s32 boundheight = height;
+
+        if (sprtype == 3) // double-size rotscale sprite
+        {
+            boundwidth <<= 1;
+            boundheight <<= 1;
+        }
+
+        s32 ypos = attrib0 & 0xFF;
+        if (((Line - ypos) & 0xFF) >= (u32)boundheight)
+            continue;
+
+        s32 xpos = (s32)(attrib1 << 23) >> 23;
+        if (xpos <= -boundwidth)
+            continue;
+
+        if ((attrib0 & (1<<12)) && (!iswin))
+        {
+            // sprite mosaic, clamped like SoftRenderer2D::DrawSprites()
+            ypos = (OBJMosaicLine - ypos) & 0xFF;
+            if (ypos >= boundheight) ypos = 0;
+        }
+        else
+            ypos = (Line - ypos) & 0xFF;
+
+        if (sprtype & 1)
+            DrawSprite_Rotscale(iswin, sprnum, boundwidth, boundheight, width, height, xpos, ypos);
+        else
+            DrawSprite_Normal(iswin, sprnum, width, height, xpos, ypos);
+
+        NumSprites++;
+    }
+}
+
+void LineRenderer::DrawSpritePixel(bool window, int color, u32 pixelattr, s32 xpos) noexcept
+{
+    if (window)
+    {
+        if (color != -1)
+            OBJWindow[xpos] = 1;
+        return;
+    }
+
+    u32 oldpixel = OBJLine[xpos];
+    bool oldisopaque = !!(oldpixel & OBJ_IsOpaque);
+    bool newisopaque = (color != -1);
+    bool priocheck = (pixelattr & OBJ_BGPrioMask) < (oldpixel & OBJ_BGPrioMask);
+
+    if (newisopaque && (!oldisopaque || priocheck))
+    {
+        OBJLine[xpos] = color | pixelattr;
+    }
+    else if (!newisopaque && !oldisopaque)
+    {
+        OBJLine[xpos] &= ~(OBJ_Mosaic | OBJ_BGPrioMask);
+        OBJLine[xpos] |= (pixelattr & (OBJ_IsSprite | OBJ_Mosaic | OBJ_BGPrioMask));
+    }
+}
+
+void LineRenderer::DrawSprite_Rotscale(bool window, u32 num, u32 boundwidth, u32 boundheight, u32 width, u32 height, s32 xpos, s32 ypos) noexcept
+{
+    u16 attrib0 = Mem.Read16(Mem.OAM, num*8);
+    u16 attrib1 = Mem.Read16(Mem.OAM, num*8 + 2);
+    u16 attrib2 = Mem.Read16(Mem.OAM, num*8 + 4);
+    u32 rotparams = (((attrib1 >> 9) & 0x1F) * 32) + 6;
+
+    u32 pixelattr = ((attrib2 & 0x0C00) << 6) | OBJ_IsSprite | OBJ_IsOpaque;
+    u32 tilenum = attrib2 & 0x03FF;
+    u32 spritemode = window ? 0 : ((attrib0 >> 10) & 0x3);
+
+    u32 ytilefactor;
+
+    s32 centerX = boundwidth >> 1;
+    s32 centerY = boundheight >> 1;
+
+    if ((attrib0 & (1<<12)) && !window)
+    {
+        // apply Y mosaic
+        pixelattr |= OBJ_Mosaic;
+    }
+
+    u32 xoff;
+    if (xpos >= 0)
+    {
+        xoff = 0;
+        if ((xpos+boundwidth) > 256)
+            boundwidth = 256-xpos;
+    }
+    else
+    {
+        xoff = -xpos;
+        xpos = 0;
+    }
+
+    s16 rotA = (s16)Mem.Read16(Mem.OAM, rotparams);
+    s16 rotB = (s16)Mem.Read16(Mem.OAM, rotparams + 8);
+    s16 rotC = (s16)Mem.Read16(Mem.OAM, rotparams + 16);
+    s16 rotD = (s16)Mem.Read16(Mem.OAM, rotparams + 24);
+
+    s32 rotX = (s32)(((xoff-centerX) * rotA) + ((ypos-centerY) * rotB) + (width << 7));
+    s32 rotY = (s32)(((xoff-centerX) * rotC) + ((ypos-centerY) * rotD) + (height << 7));
+
+    width <<= 8;
+    height <<= 8;
+
+    if (spritemode == 3)
+    {
+        u32 alpha = attrib2 >> 12;
+        if (!alpha) return;
+        alpha++;
+
+        pixelattr |= (0xC0000000 | (alpha << 24));
+
+        u32 pixelsaddr;
+        if (SpriteState.DispCnt & 0x40)
+        {
+            if (SpriteState.DispCnt & 0x20)
+            {
+                // 'reserved'
+                // draws nothing
+
+                return;
+            }
+            else
+            {
+                pixelsaddr = tilenum << (7 + ((SpriteState.DispCnt >> 22) & 0x1));
+                ytilefactor = ((width >> 8) * 2);
+            }
+        }
+        else
+        {
+            if (SpriteState.DispCnt & 0x20)
+            {
+                pixelsaddr = ((tilenum & 0x01F) << 4) + ((tilenum & 0x3E0) << 7);
+                ytilefactor = (256 * 2);
+            }
+            else
+            {
+                pixelsaddr = ((tilenum & 0x00F) << 4) + ((tilenum & 0x3F0) << 7);
+                ytilefactor = (128 * 2);
+            }
+        }
+
+        for (; xoff < boundwidth; rotX += rotA, rotY += rotC, xoff++, xpos++)
+        {
+            if ((u32)rotX < width && (u32)rotY < height)
+            {
+                u16 color = Mem.Read16(Mem.OBJ, pixelsaddr + ((rotY >> 8) * ytilefactor) + ((rotX >> 8) << 1));
+                DrawSpritePixel(window, (color&0x8000) ? color : -1, pixelattr, xpos);
+            }
+        }
+        return;
+    }
+
+    u32 pixelsaddr = tilenum;
+    if (SpriteState.DispCnt & (1<<4))
+    {
+        pixelsaddr <<= ((SpriteState.DispCnt >> 20) & 0x3);
+        ytilefactor = (width >> 11) << ((attrib0 & 0x2000) ? 1:0);
+    }
+    else
+    {
+        ytilefactor = 0x20;
+    }
+
+    if (spritemode == 1) pixelattr |= 0x80000000;
+    else                 pixelattr |= 0x10000000;
+
+    ytilefactor <<= 5;
+    pixelsaddr <<= 5;
+
+    if (attrib0 & (1<<13))
+    {
+        // 256-color
+        if (!window)
+        {
+            if (!(SpriteState.DispCnt & (1u<<31)))
+                pixelattr |= OBJ_StandardPal;
+            else
+                pixelattr |= ((attrib2 & 0xF000) >> 4);
+        }
+
+        for (; xoff < boundwidth; rotX += rotA, rotY += rotC, xoff++, xpos++)
+        {
+            if ((u32)rotX < width && (u32)rotY < height)
+            {
+                u8 color = Mem.Read8(Mem.OBJ, pixelsaddr + ((rotY>>11)*ytilefactor) + ((rotY&0x700)>>5) + ((rotX>>11)*64) + ((rotX&0x700)>>8));
+                DrawSpritePixel(window, color ? color : -1, pixelattr, xpos);
+            }
+        }
+    }
+    else
+    {
+        // 16-color
+        if (!window)
+        {
+            pixelattr |= OBJ_StandardPal;
+            pixelattr |= ((attrib2 & 0xF000) >> 8);
+        }
+
+        for (; xoff < boundwidth; rotX += rotA, rotY += rotC, xoff++, xpos++)
+        {
+            if ((u32)rotX < width && (u32)rotY < height)
+            {
+                u8 color = Mem.Read8(Mem.OBJ, pixelsaddr + ((rotY>>11)*ytilefactor) + ((rotY&0x700)>>6) + ((rotX>>11)*32) + ((rotX&0x700)>>9));
+                if (rotX & 0x100)
+                    color >>= 4;
+                else
+                    color &= 0x0F;
+
+                DrawSpritePixel(window, color ? color : -1, pixelattr, xpos);
+            }
+        }
+    }
+}
+
+void LineRenderer::DrawSprite_Normal(bool window, u32 num, u32 width, u32 height, s32 xpos, s32 ypos) noexcept
+{
+    u16 attrib0 = Mem.Read16(Mem.OAM, num*8);
+    u16 attrib1 = Mem.Read16(Mem.OAM, num*8 + 2);
+    u16 attrib2 = Mem.Read16(Mem.OAM, num*8 + 4);
+
+    u32 pixelattr = ((attrib2 & 0x0C00) << 6) | OBJ_IsSprite | OBJ_IsOpaque;
+    u32 tilenum = attrib2 & 0x03FF;
+    u32 spritemode = window ? 0 : ((attrib0 >> 10) & 0x3);
+
+    u32 wmask = width - 8; // really ((width - 1) & ~0x7)
+
+    if ((attrib0 & (1<<12)) && !window)
+    {
+        // apply Y mosaic
+        pixelattr |= OBJ_Mosaic;
+    }
+
+    // yflip
+    if (attrib1 & (1<<13))
+        ypos = height-1 - ypos;
+
+    u32 xoff;
+    u32 xend = width;
+    if (xpos >= 0)
+    {
+        xoff = 0;
+        if ((xpos+xend) > 256)
+            xend = 256-xpos;
+    }
+    else
+    {
+        xoff = -xpos;
+        xpos = 0;
+    }
+
+    if (spritemode == 3)
+    {
+        // bitmap sprite
+
+        u32 alpha = attrib2 >> 12;
+        if (!alpha) return;
+        alpha++;
+
+        pixelattr |= (0xC0000000 | (alpha << 24));
+
+        u32 pixelsaddr = tilenum;
+        if (SpriteState.DispCnt & 0x40)
+        {
+            if (SpriteState.DispCnt & 0x20)
+            {
+                // 'reserved'
+                // draws nothing
+
+                return;
+            }
+            else
+            {
+                pixelsaddr <<= (7 + ((SpriteState.DispCnt >> 22) & 0x1));
+                pixelsaddr += (ypos * width * 2);
+            }
+        }
+        else
+        {
+            if (SpriteState.DispCnt & 0x20)
+            {
+                pixelsaddr = ((tilenum & 0x01F) << 4) + ((tilenum & 0x3E0) << 7);
+                pixelsaddr += (ypos * 256 * 2);
+            }
+            else
+            {
+                pixelsaddr = ((tilenum & 0x00F) << 4) + ((tilenum & 0x3F0) << 7);
+                pixelsaddr += (ypos * 128 * 2);
+            }
+        }
+
+        s32 pixelstride;
+
+        if (attrib1 & (1<<12)) // xflip
+        {
+            pixelsaddr += ((width-1) << 1);
+            pixelsaddr -= (xoff << 1);
+            pixelstride = -2;
+        }
+        else
+        {
+            pixelsaddr += (xoff << 1);
+            pixelstride = 2;
+        }
+
+        for (; xoff < xend; xoff++, xpos++)
+        {
+            u16 color = Mem.Read16(Mem.OBJ, pixelsaddr);
+            pixelsaddr += pixelstride;
+
+            DrawSpritePixel(window, (color&0x8000) ? color : -1, pixelattr, xpos);
+        }
+        return;
+    }
+
+    u32 pixelsaddr = tilenum;
+    if (State.DispCnt & (1<<4))
+    {
+        pixelsaddr <<= ((State.DispCnt >> 20) & 0x3);
+        pixelsaddr += ((ypos >> 3) * (width >> 3)) << ((attrib0 & 0x2000) ? 1:0);
+    }
+    else
+    {
+        pixelsaddr += ((ypos >> 3) * 0x20);
+    }
+
+    if (spritemode == 1) pixelattr |= 0x80000000;
+    else                 pixelattr |= 0x10000000;
+
+    if (attrib0 & (1<<13))
+    {
+        // 256-color
+        pixelsaddr <<= 5;
+        pixelsaddr += ((ypos & 0x7) << 3);
+        s32 pixelstride;
+
+        if (!window)
+        {
+            if (!(State.DispCnt & (1u<<31)))
+                pixelattr |= OBJ_StandardPal;
+            else
+                pixelattr |= ((attrib2 & 0xF000) >> 4);
+        }
+
+        if (attrib1 & (1<<12)) // xflip
+        {
+            pixelsaddr += (((width-1) & wmask) << 3);
+            pixelsaddr += ((width-1) & 0x7);
+            pixelsaddr -= ((xoff & wmask) << 3);
+            pixelsaddr -= (xoff & 0x7);
+            pixelstride = -1;
+        }
+        else
+        {
+            pixelsaddr += ((xoff & wmask) << 3);
+            pixelsaddr += (xoff & 0x7);
+            pixelstride = 1;
+        }
+
+        for (; xoff < xend;)
+        {
+            u8 color = Mem.Read8(Mem.OBJ, pixelsaddr);
+            pixelsaddr += pixelstride;
+
+            DrawSpritePixel(window, color ? color : -1, pixelattr, xpos);
+
+            xoff++;
+            xpos++;
+            if (!(xoff & 0x7)) pixelsaddr += (56 * pixelstride);
+        }
+    }
+    else
+    {
+        // 16-color
+        pixelsaddr <<= 5;
+        pixelsaddr += ((ypos & 0x7) << 2);
+
+        if (!window)
+        {
+            pixelattr |= OBJ_StandardPal;
+            pixelattr |= ((attrib2 & 0xF000) >> 8);
+        }
+
+        bool xflip = attrib1 & (1<<12);
+        if (xflip)
+        {
+            pixelsaddr += (((width-1) & wmask) << 2);
+            pixelsaddr += (((width-1) & 0x7) >> 1);
+            pixelsaddr -= ((xoff & wmask) << 2);
+            pixelsaddr -= ((xoff & 0x7) >> 1);
+        }
+        else
+        {
+            pixelsaddr += ((xoff & wmask) << 2);
+            pixelsaddr += ((xoff & 0x7) >> 1);
+        }
+
+        for (; xoff < xend;)
+        {
+            u8 color = Mem.Read8(Mem.OBJ, pixelsaddr);
+            if (xflip)
+            {
+                if (xoff & 0x1) { color &= 0x0F; pixelsaddr--; }
+                else              color >>= 4;
+            }
+            else
+            {
+                if (xoff & 0x1) { color >>= 4; pixelsaddr++; }
+                else              color &= 0x0F;
+            }
+
+            DrawSpritePixel(window, color ? color : -1, pixelattr, xpos);
+
+            xoff++;
+            xpos++;
+            if (!(xoff & 0x7)) pixelsaddr += xflip ? -28 : 28;
+        }
+    }
+}
+
+
+void Scroll3DLine(const u32* rawline, u32 renderXPos, u32* dst) noexcept
+{
+    // same as SoftRenderer3D::GetLine()
+    if (!rawline)
+    {
+        std::fill_n(dst, 256, 0);
+        return;
+    }
+
+    u32 xpos = renderXPos & 0x1FF;
+    u32 i = 0;
+    if (xpos & 0x100)
+    {
+        for (u32 j = xpos; j < 512; i++, j++)
+            dst[i] = 0;
+        for (u32 j = 0; i < 256; i++, j++)
+            dst[i] = rawline[j];
+    }
+    else
+    {
+        for (u32 j = xpos; j < 256; i++, j++)
+            dst[i] = rawline[j];
+        for (; i < 256; i++)
+            dst[i] = 0;
+    }
+}
+
+u32 DisplayColor(u16 color) noexcept
+{
+    u8 r = (color & 0x001F) << 1;
+    u8 g = (color & 0x03E0) >> 4;
+    u8 b = (color & 0x7C00) >> 9;
+
+    return r | (g << 8) | (b << 16);
+}
+
+void ApplyMasterBrightness(u32 regval, u32* dst) noexcept
+{
+    u32 mode = (regval >> 14) & 0x3;
+    u32 factor = std::min<u32>(regval & 0x1F, 16);
+    int i = 0;
+    if (mode == 1)
+    {
+#if defined(NATIVECPU_SIMD)
+        for (; i < 256; i += 4)
+            Store4(&dst[i], BrightnessUp4(Load4(&dst[i]), factor, 0x0));
+#endif
+        for (; i < 256; i++)
+            dst[i] = ColorBrightnessUp(dst[i], factor, 0x0);
+    }
+    else if (mode == 2)
+    {
+#if defined(NATIVECPU_SIMD)
+        for (; i < 256; i += 4)
+            Store4(&dst[i], BrightnessDown4(Load4(&dst[i]), factor, 0xF));
+#endif
+        for (; i < 256; i++)
+            dst[i] = ColorBrightnessDown(dst[i], factor, 0xF);
+    }
+}
+
+// the bank a line's display capture writes, as a mask
+u32 CaptureBankMask(const LineState& state, u32 line) noexcept
+{
+    if (!state.CaptureEnable)
+        return 0;
+    const u32 size = (state.CaptureCnt >> 20) & 0x3;
+    if (line >= CaptureHeightForSize(size))
+        return 0;
+    return state.LCDVRAMMap & (1 << ((state.CaptureCnt >> 16) & 0x3));
+}
+
+}
+
+CpuExecutor::CpuExecutor()
+    : Output2D(2 * ScreenPixelCount), Display(2 * ScreenPixelCount), LCDC(4 * LCDCBankBytes)
+{
+    SetThreadCount(0);
+}
+
+CpuExecutor::~CpuExecutor()
+{
+    StopWorkers();
+}
+
+void CpuExecutor::SetThreadCount(int threads)
+{
+    if (threads <= 0)
+    {
+        // the emulator thread takes a share of the work and has nothing else
+        // to do at VBlank; leave a core to the frontend
+        int hw = (int)std::thread::hardware_concurrency();
+        threads = std::clamp(hw - 1, 1, 8);
+    }
+    if (threads == Threads)
+        return;
+
+    StopWorkers();
+    Threads = threads;
+}
+
+void CpuExecutor::Reset()
+{
+    std::fill(LCDC.begin(), LCDC.end(), 0);
+    CaptureWrites.clear();
+    Stats = {};
+}
+
+void CpuExecutor::Execute(const FrameInput& input, const u32* const* lines3D, u32* top, u32* bottom)
+{
+    const u64 start = NowNs();
+    Input = &input;
+    Lines3D = lines3D;
+    Screens[0] = top;
+    Screens[1] = bottom;
+    CaptureWrites.clear();
+
+    // blocks only a native capture has the contents of are left as they are
+    for (u32 block = 0; block < CapturePhysicalBlockCount; block++)
+    {
+        if (IsNativeCaptureOwner(input.LCDVRAMProvenance[block].Owner))
+            continue;
+        memcpy(&LCDC[block * CapturePhysicalBlockBytes], &input.LCDVRAM[block * CapturePhysicalBlockBytes],
+               CapturePhysicalBlockBytes);
+    }
+
+    // BG and OBJ lines reading capture results through the overlay need the
+    // captures of the lines above them, so they go line by line. So does the
+    // VRAM display of a bank a capture wrote earlier in the frame, which is
+    // the only other way a line's output depends on the lines above it.
+    const bool serial = input.NativeCaptureOverlayAny & NativeCaptureOverlayAnyMask;
+    DisplayOrdered = false;
+    u32 written = 0;
+    for (u32 line = 0; line < ScreenHeight; line++)
+    {
+        const LineState& state = input.Lines[line];
+        if (((state.DispCnt >> 16) & 0x3) == 2 && (written & (1 << ((state.DispCnt >> 18) & 0x3))))
+        {
+            DisplayOrdered = true;
+            break;
+        }
+        written |= CaptureBankMask(state, line);
+    }
+
+    u32 threads = 1;
+    if (serial)
+    {
+        DisplayOrdered = true;
+        for (u32 line = 0; line < ScreenHeight; line++)
+        {
+            RenderLine(0, line);
+            RenderLine(1, line);
+            DisplayLine(0, line);
+            DisplayLine(1, line);
+            RouteLine(line);
+            CaptureLine(line);
+        }
+        Stats.SerialFrames++;
+    }
+    else
+    {
+        RunBands(FrameBands);
+        for (u32 line = 0; line < ScreenHeight; line++)
+        {
+            if (DisplayOrdered)
+                DisplayLine(0, line);
+            RouteLine(line);
+            CaptureLine(line);
+        }
+        if (DisplayOrdered)
+            Stats.OrderedFrames++;
+        threads = Threads;
+    }
+
+    const u64 elapsed = NowNs() - start;
+    Stats.Frames++;
+    Stats.LastNs = elapsed;
+    Stats.TotalNs += elapsed;
+    Stats.LastThreads = threads;
+    Input = nullptr;
+    Lines3D = nullptr;
+}
+
+void CpuExecutor::RenderBand(u32 band)
+{
+    for (u32 unit = band * LinesPerBand; unit < (band + 1) * LinesPerBand; unit++)
+    {
+        const u32 engine = unit / ScreenHeight;
+        const u32 line = unit % ScreenHeight;
+        RenderLine(engine, line);
+        if (!(DisplayOrdered && engine == 0))
+            DisplayLine(engine, line);
+    }
+}
+
+void CpuExecutor::RenderLine(u32 engine, u32 line)
+{
+    u32 line3D[256];
+    const u32* output3D = nullptr;
+    const LineState& state = Input->Lines[engine * ScreenHeight + line];
+    if (engine == 0 && (state.DispCnt & 0x8))
+    {
+        Scroll3DLine(Lines3D ? Lines3D[line] : nullptr, state.RenderXPos, line3D);
+        output3D = line3D;
+    }
+
+    LineRenderer renderer(*Input, LCDC.data(), engine, line);
+    renderer.DrawScanline(output3D, &Output2D[(engine * ScreenHeight + line) * ScreenWidth]);
+}
+
+void CpuExecutor::DisplayLine(u32 engine, u32 line)
+{
+    const LineState& state = Input->Lines[engine * ScreenHeight + line];
+    const u32* src = &Output2D[(engine * ScreenHeight + line) * ScreenWidth];
+    u32* dst = &Display[(engine * ScreenHeight + line) * ScreenWidth];
+
+    if (engine == 1)
+    {
+        if (!(state.DispCnt & (1<<16)))
+        {
+            // screen off
+            std::fill_n(dst, 256, 0xFF3F3F3F);
+            return;
+        }
+        std::copy_n(src, 256, dst);
+        ApplyMasterBrightness(state.MasterBrightness, dst);
+        return;
+    }
+
+    switch ((state.DispCnt >> 16) & 0x3)
+    {
+    case 0: // screen off
+        std::fill_n(dst, 256, 0x3F3F3F);
+        return;
+
+    case 1: // regular display
+        std::copy_n(src, 256, dst);
+        break;
+
+    case 2: // VRAM display
+        {
+            u32 vrambank = (state.DispCnt >> 18) & 0x3;
+            if (state.LCDVRAMMap & (1<<vrambank))
+            {
+                const u32* versions = TimelineRow(Input->TimelineRows, Input->TimelineRowIds[line],
+                                                  TimelineLCDVRAMBaseBlock + vrambank * 256);
+                LineMemory mem(*Input, LCDC.data(), 0, line);
+                Region bank = {&LCDC[vrambank * LCDCBankBytes], LCDCBankBytes, versions};
+                for (u32 i = 0; i < 256; i++)
+                    dst[i] = DisplayColor(mem.Read16(bank, (line * 256 + i) * 2));
+            }
+            else
+                std::fill_n(dst, 256, 0);
+        }
+        break;
+
+    case 3: // FIFO display
+        {
+            LineMemory mem(*Input, LCDC.data(), 0, line);
+            Region fifo = {reinterpret_cast<const u8*>(Input->DisplayFIFO.data()), sizeof(Input->DisplayFIFO),
+                           TimelineRow(Input->TimelineRows, Input->TimelineRowIds[line], TimelineFIFOBaseBlock)};
+            for (u32 i = 0; i < 256; i++)
+                dst[i] = DisplayColor(mem.Read16(fifo, i * 2));
+        }
+        break;
+    }
+
+    ApplyMasterBrightness(state.MasterBrightness, dst);
+}
+
+void CpuExecutor::RouteLine(u32 line)
+{
+    // the screens are blanked as a whole, as of the end of the line
+    const bool enabled = Input->Lines[line].ScreensEnabled;
+    for (u32 screen = 0; screen < 2; screen++)
+    {
+        const u32 engine = Input->ScreenSource[screen * ScreenHeight + line] & 1;
+        const u32* src = &Display[(engine * ScreenHeight + line) * ScreenWidth];
+        u32* dst = &Screens[screen][line * ScreenWidth];
+        const u32 mask = enabled ? 0x3F3F3F : 0;
+        for (u32 i = 0; i < 256; i++)
+            dst[i] = src[i] & mask;
+    }
+}
+
+void CpuExecutor::CaptureLine(u32 line)
+{
+    const LineState& state = Input->Lines[line];
+    const u32 dstmask = CaptureBankMask(state, line);
+    if (!dstmask)
+        return;
+
+    const u32 captureCnt = state.CaptureCnt;
+    const u32 width = CaptureWidthForSize((captureCnt >> 20) & 0x3);
+    const u32 dstvram = (captureCnt >> 16) & 0x3;
+    const u32 dstaddr = ((((captureCnt >> 18) & 0x3) << 14) + (line * width)) & 0xFFFF;
+    u8* dst = &LCDC[dstvram * LCDCBankBytes];
+
+    u32 line3D[256];
+    const u32* srcA;
+    if (captureCnt & (1<<24))
+    {
+        Scroll3DLine(Lines3D ? Lines3D[line] : nullptr, state.RenderXPos, line3D);
+        srcA = line3D;
+    }
+    else
+        srcA = &Output2D[line * ScreenWidth];
+
+    // source B goes through the timeline like the VRAM display does, and
+    // sees this line's own writes to the mirror as it goes
+    LineMemory mem(*Input, LCDC.data(), 0, line);
+    Region srcB;
+    u32 srcBaddr = 0;
+    if (captureCnt & (1<<25))
+    {
+        srcB = {reinterpret_cast<const u8*>(Input->DisplayFIFO.data()), sizeof(Input->DisplayFIFO),
+                TimelineRow(Input->TimelineRows, Input->TimelineRowIds[line], TimelineFIFOBaseBlock)};
+    }
+    else
+    {
+        u32 srcvram = (state.DispCnt >> 18) & 0x3;
+        if (state.LCDVRAMMap & (1<<srcvram))
+        {
+            srcB = {&LCDC[srcvram * LCDCBankBytes], LCDCBankBytes,
+                    TimelineRow(Input->TimelineRows, Input->TimelineRowIds[line],
+                                TimelineLCDVRAMBaseBlock + srcvram * 256)};
+            u32 offset = line * 256;
+            if (((state.DispCnt >> 16) & 0x3) != 2)
+                offset += (((captureCnt >> 26) & 0x3) << 14);
+            srcBaddr = offset & 0xFFFF;
+        }
+    }
+
+    u32 eva = std::min<u32>(captureCnt & 0x1F, 16);
+    u32 evb = std::min<u32>((captureCnt >> 8) & 0x1F, 16);
+    const u32 mode = (captureCnt >> 29) & 0x3;
+
+    // source B is read through the timeline first, so the per-pixel loops
+    // below are plain array loops the compiler vectorizes
+    u16 lineB[256];
+    if (mode != 0)
+    {
+        for (u32 i = 0; i < width; i++)
+            lineB[i] = srcB.Base ? mem.Read16(srcB, ((srcBaddr + i) & 0xFFFF) * 2) : 0;
+    }
+
+    u16 colors[256];
+    if (mode == 0) // source A
+    {
+        for (u32 i = 0; i < width; i++)
+        {
+            u32 val = srcA[i];
+            u32 rA = (val >> 1) & 0x1F;
+            u32 gA = (val >> 9) & 0x1F;
+            u32 bA = (val >> 17) & 0x1F;
+            u32 aA = ((val >> 24) != 0) ? 1 : 0;
+
+            colors[i] = rA | (gA << 5) | (bA << 10) | (aA << 15);
+        }
+    }
+    else if (mode == 1) // source B
+    {
+        std::copy_n(lineB, width, colors);
+    }
+    else // sources A+B
+    {
+        for (u32 i = 0; i < width; i++)
+        {
+            u32 val = srcA[i];
+            u32 rA = (val >> 1) & 0x1F;
+            u32 gA = (val >> 9) & 0x1F;
+            u32 bA = (val >> 17) & 0x1F;
+            u32 aA = ((val >> 24) != 0) ? 1 : 0;
+
+            u32 valB = lineB[i];
+            u32 rB = valB & 0x1F;
+            u32 gB = (valB >> 5) & 0x1F;
+            u32 bB = (valB >> 10) & 0x1F;
+            u32 aB = valB >> 15;
+
+            u32 rD = std::min<u32>(((rA * aA * eva) + (rB * aB * evb) + 8) >> 4, 0x1F);
+            u32 gD = std::min<u32>(((gA * aA * eva) + (gB * aB * evb) + 8) >> 4, 0x1F);
+            u32 bD = std::min<u32>(((bA * aA * eva) + (bB * aB * evb) + 8) >> 4, 0x1F);
+            u32 aD = (eva>0 ? aA : 0) | (evb>0 ? aB : 0);
+
+            colors[i] = rD | (gD << 5) | (bD << 10) | (aD << 15);
+        }
+    }
+
+    for (u32 i = 0; i < width; i++)
+    {
+        const u32 addr = ((dstaddr + i) & 0xFFFF) * 2;
+        dst[addr] = colors[i] & 0xFF;
+        dst[addr + 1] = colors[i] >> 8;
+    }
+
+    CaptureWrites.push_back({dstvram, dstaddr * 2, width * 2});
+    Stats.CaptureLines++;
+}
+
+void CpuExecutor::RunBands(u32 numBands)
+{
+    std::unique_lock<std::mutex> lock(Lock);
+    if (Workers.empty())
+    {
+        Quit = false;
+        for (int i = 1; i < Threads; i++)
+            Workers.emplace_back([this]() { WorkerFunc(); });
+    }
+
+    NumBands = numBands;
+    NextBand = 0;
+    BandsLeft = numBands;
+    Generation++;
+    Ready.notify_all();
+
+    // lend a hand instead of just waiting
+    while (NextBand < NumBands)
+    {
+        u32 band = NextBand++;
+        lock.unlock();
+        RenderBand(band);
+        lock.lock();
+        BandsLeft--;
+    }
+    Done.wait(lock, [&]() { return BandsLeft == 0; });
+}
+
+void CpuExecutor::WorkerFunc()
+{
+    MelonPrimeTrace::SetThreadName("GPU2D worker");
+    u64 seen = 0;
+    std::unique_lock<std::mutex> lock(Lock);
+    for (;;)
+    {
+        Ready.wait(lock, [&]() { return Quit || Generation != seen; });
+        if (Quit) return;
+        seen = Generation;
+
+        while (NextBand < NumBands)
+        {
+            u32 band = NextBand++;
+            lock.unlock();
+            RenderBand(band);
+            lock.lock();
+            if (--BandsLeft == 0)
+                Done.notify_one();
+        }
+    }
+}
+
+void CpuExecutor::StopWorkers()
+{
+    {
+        std::lock_guard<std::mutex> guard(Lock);
+        Quit = true;
+    }
+    Ready.notify_all();
+    for (std::thread& worker : Workers)
+        worker.join();
+    Workers.clear();
+}
+
+}
@@ -0,0 +1,102 @@
+/*
+    Copyright 2016-2026 melonDS team
+
+    CPU executor for the native GPU 2D contract.
+
+    Renders a recorded FrameInput at VBlank the way SoftRenderer2D would have
+    rendered it line by line, split across a small worker pool. It lets the
+    software renderer defer its 2D work to the end of the frame and gives the
+    contract a reference that runs without a GPU.
+*/
+
+#ifndef GPU2D_NATIVE_CPU_H
+#define GPU2D_NATIVE_CPU_H
+
+#include <array>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "GPU2DNative.h"
+#include "types.h"
+
+namespace melonDS::GPU2DNative
+{
+
+struct CpuExecutorStats
+{
+    u64 Frames = 0;
+    u64 OrderedFrames = 0;  // frames with a capture feeding a later line's display
+    u64 SerialFrames = 0;   // frames rendered line by line for a capture overlay
+    u64 CaptureLines = 0;
+    u64 TotalNs = 0;
+    u64 LastNs = 0;
+    u32 LastThreads = 0;
+};
+
+// One display capture line written to the LCDC mirror, in bytes.
+struct CpuCaptureWrite
+{
+    u32 Bank = 0;
+    u32 Offset = 0;
+    u32 Length = 0;
+};
+
+class CpuExecutor
+{
+public:
+    CpuExecutor();
+    ~CpuExecutor();
+    CpuExecutor(const CpuExecutor&) = delete;
+    CpuExecutor& operator=(const CpuExecutor&) = delete;
+
+    // 0 picks a count from the host's core count
+    void SetThreadCount(int threads);
+    void Reset();
+
+    // Renders both screens into 256x192 framebuffers of 6-bit RGB (the
+    // software renderer's format before ExpandColor) and applies the frame's
+    // display captures to the LCDC mirror. lines3D holds the 192 raw 3D
+    // lines, before the X scroll; it or any of its lines may be null.
+    void Execute(const FrameInput& input, const u32* const* lines3D, u32* top, u32* bottom);
+
+    // LCDC banks A-D as left by the last frame's captures
+    [[nodiscard]] const u8* GetLCDCBank(u32 bank) const noexcept { return &LCDC[bank * LCDCBankBytes]; }
+    [[nodiscard]] const std::vector<CpuCaptureWrite>& GetCaptureWrites() const noexcept { return CaptureWrites; }
+    [[nodiscard]] const CpuExecutorStats& GetStats() const noexcept { return Stats; }
+
+private:
+    void RenderBand(u32 band);
+    void RenderLine(u32 engine, u32 line);
+    void DisplayLine(u32 engine, u32 line);
+    void RouteLine(u32 line);
+    void CaptureLine(u32 line);
+
+    void RunBands(u32 numBands);
+    void StopWorkers();
+    void WorkerFunc();
+
+    const FrameInput* Input = nullptr;
+    const u32* const* Lines3D = nullptr;
+    u32* Screens[2] = {};
+    bool DisplayOrdered = false;
+
+    std::vector<u32> Output2D;  // [engine][line][x], before the display mode
+    std::vector<u32> Display;   // [engine][line][x], after master brightness
+    std::vector<u8> LCDC;
+    std::vector<CpuCaptureWrite> CaptureWrites;
+    CpuExecutorStats Stats;
+
+    int Threads = 0;
+    std::vector<std::thread> Workers;
+    std::mutex Lock;
+    std::condition_variable Ready, Done;
+    u32 NumBands = 0, NextBand = 0, BandsLeft = 0;
+    u64 Generation = 0;
+    bool Quit = false;
+};
+
+}
+
+#endif // GPU2D_NATIVE_CPU_H
@@ -21,12 +21,18 @@
 #include <assert.h>
 #include <stdio.h>
 #include <string.h>
+#include <algorithm>
+#include <chrono>
 #include "NDS.h"
 #include "GPU.h"
+#include "Platform.h"
 
 namespace melonDS
 {
 
+using Platform::Log;
+using Platform::LogLevel;
+
 #include "OpenGL_shaders/3DClearVS.h"
 #include "OpenGL_shaders/3DClearFS.h"
 #include "OpenGL_shaders/3DClearBitmapVS.h"
@@ -111,6 +117,7 @@ GLRenderer3D::GLRenderer3D(melonDS::GPU3D& gpu3D, GLRenderer& parent) noexcept :
 
     ScaleFactor = 0;
     BetterPolygons = false;
+    SetPolygonBuildThreads(0);
 
     // GLRenderer3D::Init() will be used to actually initialize the renderer;
     // The various glDelete* functions silently ignore invalid IDs,
@@ -242,12 +249,46 @@ bool GLRenderer3D::Init()
     glTexImage2D(GL_TEXTURE_2D, 0, GL_R32UI, 256, 256, 0, GL_RED_INTEGER, GL_UNSIGNED_INT, nullptr);
 
 
-    glGenBuffers(1, &VertexBufferID);
-    glBindBuffer(GL_ARRAY_BUFFER, VertexBufferID);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(VertexBuffer), nullptr, GL_DYNAMIC_DRAW);
-
     glGenVertexArrays(1, &VertexArrayID);
     glBindVertexArray(VertexArrayID);
+
+    const GLbitfield ringflags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    PersistentRing = GLAD_GL_ARB_buffer_storage && glBufferStorage;
+    if (PersistentRing)
+    {
+        glGenBuffers(1, &VertexBufferID);
+        glBindBuffer(GL_ARRAY_BUFFER, VertexBufferID);
+        glBufferStorage(GL_ARRAY_BUFFER, sizeof(VertexBuffer) * RingSize, nullptr, ringflags);
+        RingVertexData = (u32*)glMapBufferRange(GL_ARRAY_BUFFER, 0, sizeof(VertexBuffer) * RingSize, ringflags);
+
+        glGenBuffers(1, &IndexBufferID);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, IndexBufferID);
+        glBufferStorage(GL_ELEMENT_ARRAY_BUFFER, sizeof(IndexBuffer) * RingSize, nullptr, ringflags);
+        RingIndexData = (u16*)glMapBufferRange(GL_ELEMENT_ARRAY_BUFFER, 0, sizeof(IndexBuffer) * RingSize, ringflags);
+
+        if (!RingVertexData || !RingIndexData)
+        {
+            Log(LogLevel::Warn, "GLRenderer3D: could not map the vertex ring, uploading every frame instead\n");
+            glDeleteBuffers(1, &VertexBufferID);
+            glDeleteBuffers(1, &IndexBufferID);
+            RingVertexData = nullptr;
+            RingIndexData = nullptr;
+            PersistentRing = false;
+        }
+    }
+    if (!PersistentRing)
+    {
+        glGenBuffers(1, &VertexBufferID);
+        glBindBuffer(GL_ARRAY_BUFFER, VertexBufferID);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(VertexBuffer), nullptr, GL_STREAM_DRAW);
+
+        glGenBuffers(1, &IndexBufferID);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, IndexBufferID);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(IndexBuffer), nullptr, GL_STREAM_DRAW);
+    }
+    BuildStats.Persistent = PersistentRing;
+
+    glBindBuffer(GL_ARRAY_BUFFER, VertexBufferID);
     glEnableVertexAttribArray(0); // position
     glVertexAttribIPointer(0, 4, GL_UNSIGNED_SHORT, 7*4, (void*)(0));
     glEnableVertexAttribArray(1); // color
@@ -257,10 +298,6 @@ bool GLRenderer3D::Init()
     glEnableVertexAttribArray(3); // attrib
     glVertexAttribIPointer(3, 3, GL_UNSIGNED_INT, 7*4, (void*)(4*4));
 
-    glGenBuffers(1, &IndexBufferID);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, IndexBufferID);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(IndexBuffer), nullptr, GL_DYNAMIC_DRAW);
-
     glGenFramebuffers(1, &MainFramebuffer);
 
     // color buffers
@@ -299,8 +336,17 @@ GLRenderer3D::~GLRenderer3D()
     glDeleteTextures(1, &DepthBufferTex);
     glDeleteTextures(1, &AttrBufferTex);
 
+    StopBuildWorkers();
+
+    for (GLsync& fence : RingFence)
+    {
+        if (fence) glDeleteSync(fence);
+        fence = nullptr;
+    }
+
     glDeleteVertexArrays(1, &VertexArrayID);
     glDeleteBuffers(1, &VertexBufferID);
+    glDeleteBuffers(1, &IndexBufferID);
     glDeleteVertexArrays(1, &ClearVertexArrayID);
     glDeleteBuffers(1, &ClearVertexBufferID);
     glDeleteTextures(2, ClearBitmapTex);
@@ -320,6 +366,32 @@ void GLRenderer3D::Reset()
 {
     Texcache.Reset();
     ClearBitmapDirty = 0x3;
+
+    if (BuildStats.Frames)
+    {
+        Log(LogLevel::Debug, "GLRenderer3D: polygons built in %.1f us per frame on average (%s, %llu ring waits)\n",
+            (double)BuildStats.TotalUS / BuildStats.Frames,
+            PersistentRing ? "persistent ring" : "orphaned buffers",
+            (unsigned long long)BuildStats.RingWaits);
+    }
+    BuildStats = {};
+    BuildStats.Persistent = PersistentRing;
+}
+
+void GLRenderer3D::SetPolygonBuildThreads(int numThreads) noexcept
+{
+    if (numThreads <= 0)
+    {
+        // the emu thread and the GUI thread are busy already, and polygon
+        // setup is short enough that a few helpers are plenty
+        int hw = (int)std::thread::hardware_concurrency();
+        numThreads = std::clamp(hw - 2, 1, 4);
+    }
+    if (numThreads == BuildThreads)
+        return;
+
+    StopBuildWorkers();
+    BuildThreads = numThreads;
 }
 
 void GLRenderer3D::SetBetterPolygons(bool betterpolygons) noexcept
@@ -481,11 +553,11 @@ u32* GLRenderer3D::SetupVertex(const Polygon* poly, int vid, const Vertex* vtx,
     return vptr;
 }
 
-void GLRenderer3D::BuildPolygons(GLRenderer3D::RendererPolygon* polygons, int npolys, int captureinfo[16])
+int GLRenderer3D::BuildPolygons(GLRenderer3D::RendererPolygon* polygons, int npolys, int captureinfo[16])
 {
-    u32* vptr = &VertexBuffer[0];
+    // first, in order: texture lookups (which may upload textures) and where
+    // each polygon's vertices and indices go
     u32 vidx = 0;
-
     u32 iidx = 0;
     u32 eidx = EdgeIndicesOffset;
 
@@ -499,21 +571,9 @@ void GLRenderer3D::BuildPolygons(GLRenderer3D::RendererPolygon* polygons, int np
         RendererPolygon* rp = &polygons[i];
         Polygon* poly = rp->PolyData;
 
-        rp->IndicesOffset = iidx;
-        rp->NumIndices = 0;
-
-        u32 vidx_first = vidx;
-
-        u32 polyattr = poly->Attr;
         u32 texparam = poly->TexParam & ~0xC00F0000;
         u32 texpal = poly->TexPalette;
 
-        u32 alpha = (polyattr >> 16) & 0x1F;
-
-        u32 vtxattr = polyattr & 0x1F00C8F0;
-        if (poly->FacingView) vtxattr |= (1<<8);
-        if (poly->WBuffer)    vtxattr |= (1<<9);
-
         if ((texparam != curtexparam) || (texpal != curtexpal))
         {
             u32 textype = (texparam >> 26) & 0x7;
@@ -576,13 +636,115 @@ void GLRenderer3D::BuildPolygons(GLRenderer3D::RendererPolygon* polygons, int np
         }
 
         rp->TexID = curtexid;
+        rp->TexLayer = curtexlayer;
         rp->TexRepeat = (poly->TexParam >> 16) & 0xF;
 
-        // assemble vertices
-        if (poly->Type == 1) // line
+        u32 nverts, nindices;
+        if (poly->Type == 1) // line: up to two distinct points
         {
             rp->PrimType = GL_LINES;
 
+            nverts = 0;
+            for (u32 j = 0; j < poly->NumVertices && nverts < 2; j++)
+            {
+                if (j > 0 &&
+                    poly->Vertices[j]->FinalPosition[0] == poly->Vertices[j-1]->FinalPosition[0] &&
+                    poly->Vertices[j]->FinalPosition[1] == poly->Vertices[j-1]->FinalPosition[1])
+                    continue;
+                nverts++;
+            }
+            nindices = nverts;
+        }
+        else
+        {
+            rp->PrimType = GL_TRIANGLES;
+
+            if (poly->NumVertices == 3 || !BetterPolygons)
+            {
+                nverts = poly->NumVertices;
+                nindices = (poly->NumVertices >= 2) ? (poly->NumVertices - 2) * 3 : 0;
+            }
+            else
+            {
+                // plus a center vertex
+                nverts = poly->NumVertices + 1;
+                nindices = poly->NumVertices * 3;
+            }
+        }
+
+        u32 nedges = std::max(poly->NumVertices, 1u) * 2;
+        if (vidx + nverts > MaxVertices ||
+            iidx + nindices > EdgeIndicesOffset ||
+            eidx + nedges > MaxIndices)
+        {
+            Log(LogLevel::Warn, "GLRenderer3D: out of vertex buffer space, dropping %d polygons\n", npolys - i);
+            npolys = i;
+            break;
+        }
+
+        rp->VerticesOffset = vidx;
+        rp->NumVertices = nverts;
+        rp->IndicesOffset = iidx;
+        rp->NumIndices = nindices;
+        rp->EdgeIndicesOffset = eidx;
+        rp->NumEdgeIndices = nedges;
+
+        vidx += nverts;
+        iidx += nindices;
+        eidx += nedges;
+    }
+
+    NumVertices = vidx;
+    NumIndices = iidx;
+    NumEdgeIndices = eidx - EdgeIndicesOffset;
+
+    // then the vertices and indices themselves, which only depend on the
+    // polygon they belong to
+    constexpr int minBandSize = 128;
+    int bands = std::min(BuildThreads * 2, npolys / minBandSize);
+    if (bands > 1)
+    {
+        BuildPolys = polygons;
+        BuildNumPolys = npolys;
+        BuildBandSize = (npolys + bands - 1) / bands;
+        RunBuildBands(bands);
+        BuildStats.LastThreads = std::min(bands, BuildThreads);
+    }
+    else
+    {
+        WritePolygons(polygons, 0, npolys);
+        BuildStats.LastThreads = 1;
+    }
+
+    return npolys;
+}
+
+void GLRenderer3D::WritePolygons(const RendererPolygon* polygons, int start, int end) const
+{
+    for (int i = start; i < end; i++)
+    {
+        const RendererPolygon* rp = &polygons[i];
+        const Polygon* poly = rp->PolyData;
+
+        u32 vidx = rp->VerticesOffset;
+        u32* vptr = &CurVertexData[vidx * 7];
+        u16* iptr = &CurIndexData[rp->IndicesOffset];
+
+        u32 vidx_first = vidx;
+
+        u32 polyattr = poly->Attr;
+        u32 texparam = poly->TexParam & ~0xC00F0000;
+        u32 curtexlayer = rp->TexLayer;
+
+        u32 alpha = (polyattr >> 16) & 0x1F;
+
+        u32 vtxattr = polyattr & 0x1F00C8F0;
+        if (poly->FacingView) vtxattr |= (1<<8);
+        if (poly->WBuffer)    vtxattr |= (1<<9);
+
+        // assemble vertices
+        if (poly->Type == 1) // line
+        {
             u32 lastx, lasty;
             int nout = 0;
             for (u32 j = 0; j < poly->NumVertices; j++)
@@ -600,8 +762,7 @@ void GLRenderer3D::BuildPolygons(GLRenderer3D::RendererPolygon* polygons, int np
 
                 vptr = SetupVertex(poly, j, vtx, vtxattr, curtexlayer, vptr);
 
-                IndexBuffer[iidx++] = vidx;
-                rp->NumIndices++;
+                *iptr++ = vidx;
 
                 vidx++;
                 nout++;
@@ -610,8 +771,6 @@ void GLRenderer3D::BuildPolygons(GLRenderer3D::RendererPolygon* polygons, int np
         }
         else if (poly->NumVertices == 3) // regular triangle
         {
-            rp->PrimType = GL_TRIANGLES;
-
             for (int j = 0; j < 3; j++)
             {
                 Vertex* vtx = poly->Vertices[j];
@@ -621,15 +780,12 @@ void GLRenderer3D::BuildPolygons(GLRenderer3D::RendererPolygon* polygons, int np
             }
 
             // build a triangle
-            IndexBuffer[iidx++] = vidx_first;
-            IndexBuffer[iidx++] = vidx - 2;
-            IndexBuffer[iidx++] = vidx - 1;
-            rp->NumIndices += 3;
+            *iptr++ = vidx_first;
+            *iptr++ = vidx - 2;
+            *iptr++ = vidx - 1;
         }
         else // quad, pentagon, etc
         {
-            rp->PrimType = GL_TRIANGLES;
-
             if (!BetterPolygons)
             {
                 // regular triangle-splitting
@@ -643,10 +799,9 @@ void GLRenderer3D::BuildPolygons(GLRenderer3D::RendererPolygon* polygons, int np
                     if (j >= 2)
                     {
                         // build a triangle
-                        IndexBuffer[iidx++] = vidx_first;
-                        IndexBuffer[iidx++] = vidx - 1;
-                        IndexBuffer[iidx++] = vidx;
-                        rp->NumIndices += 3;
+                        *iptr++ = vidx_first;
+                        *iptr++ = vidx - 1;
+                        *iptr++ = vidx;
                     }
 
                     vidx++;
@@ -737,41 +892,144 @@ void GLRenderer3D::BuildPolygons(GLRenderer3D::RendererPolygon* polygons, int np
                     if (j >= 1)
                     {
                         // build a triangle
-                        IndexBuffer[iidx++] = vidx_first;
-                        IndexBuffer[iidx++] = vidx - 1;
-                        IndexBuffer[iidx++] = vidx;
-                        rp->NumIndices += 3;
+                        *iptr++ = vidx_first;
+                        *iptr++ = vidx - 1;
+                        *iptr++ = vidx;
                     }
 
                     vidx++;
                 }
 
-                IndexBuffer[iidx++] = vidx_first;
-                IndexBuffer[iidx++] = vidx - 1;
-                IndexBuffer[iidx++] = vidx_first + 1;
-                rp->NumIndices += 3;
+                *iptr++ = vidx_first;
+                *iptr++ = vidx - 1;
+                *iptr++ = vidx_first + 1;
             }
         }
 
-        rp->EdgeIndicesOffset = eidx;
-        rp->NumEdgeIndices = 0;
-
+        u16* eptr = &CurIndexData[rp->EdgeIndicesOffset];
         u32 vidx_cur = vidx_first;
         for (u32 j = 1; j < poly->NumVertices; j++)
         {
-            IndexBuffer[eidx++] = vidx_cur;
-            IndexBuffer[eidx++] = vidx_cur + 1;
+            *eptr++ = vidx_cur;
+            *eptr++ = vidx_cur + 1;
             vidx_cur++;
-            rp->NumEdgeIndices += 2;
         }
-        IndexBuffer[eidx++] = vidx_cur;
-        IndexBuffer[eidx++] = vidx_first;
-        rp->NumEdgeIndices += 2;
+        *eptr++ = vidx_cur;
+        *eptr++ = vidx_first;
     }
+}
 
-    NumVertices = vidx;
-    NumIndices = iidx;
-    NumEdgeIndices = eidx - EdgeIndicesOffset;
+void GLRenderer3D::RunBuildBands(int bands)
+{
+    std::unique_lock<std::mutex> lock(BuildLock);
+    if (BuildWorkers.empty())
+    {
+        BuildQuit = false;
+        for (int i = 1; i < BuildThreads; i++)
+            BuildWorkers.emplace_back([this]() { BuildWorkerFunc(); });
+    }
+
+    BuildNumBands = bands;
+    BuildNextBand = 0;
+    BuildBandsLeft = bands;
+    BuildGeneration++;
+    BuildReady.notify_all();
+
+    // lend a hand instead of just waiting
+    while (BuildNextBand < BuildNumBands)
+    {
+        int band = BuildNextBand++;
+        lock.unlock();
+        WritePolygons(BuildPolys, band * BuildBandSize, std::min((band + 1) * BuildBandSize, BuildNumPolys));
+        lock.lock();
+        BuildBandsLeft--;
+    }
+    BuildDone.wait(lock, [&]() { return BuildBandsLeft == 0; });
+}
+
+void GLRenderer3D::BuildWorkerFunc()
+{
+    u64 seen = 0;
+    std::unique_lock<std::mutex> lock(BuildLock);
+    for (;;)
+    {
+        BuildReady.wait(lock, [&]() { return BuildQuit || BuildGeneration != seen; });
+        if (BuildQuit) return;
+        seen = BuildGeneration;
+
+        while (BuildNextBand < BuildNumBands)
+        {
+            int band = BuildNextBand++;
+            lock.unlock();
+            WritePolygons(BuildPolys, band * BuildBandSize, std::min((band + 1) * BuildBandSize, BuildNumPolys));
+            lock.lock();
+            if (--BuildBandsLeft == 0)
+                BuildDone.notify_one();
+        }
+    }
+}
+
+void GLRenderer3D::StopBuildWorkers()
+{
+    {
+        std::lock_guard<std::mutex> guard(BuildLock);
+        BuildQuit = true;
+    }
+    BuildReady.notify_all();
+    for (std::thread& worker : BuildWorkers)
+        worker.join();
+    BuildWorkers.clear();
+}
+
+bool GLRenderer3D::BeginVertexUpload()
+{
+    if (!PersistentRing)
+    {
+        CurVertexData = VertexBuffer;
+        CurIndexData = IndexBuffer;
+        CurBaseVertex = 0;
+        CurIndexBase = 0;
+        return true;
+    }
+
+    RingSlot = (RingSlot + 1) % RingSize;
+    if (GLsync fence = RingFence[RingSlot])
+    {
+        // the GPU is normally done with a frame from three frames ago
+        GLenum status = glClientWaitSync(fence, 0, 0);
+        if (status == GL_TIMEOUT_EXPIRED)
+        {
+            BuildStats.RingWaits++;
+            status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000ull);
+        }
+        glDeleteSync(fence);
+        RingFence[RingSlot] = nullptr;
+        if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+            return false;
+    }
+
+    CurVertexData = &RingVertexData[RingSlot * MaxVertices * 7];
+    CurIndexData = &RingIndexData[RingSlot * MaxIndices];
+    CurBaseVertex = RingSlot * MaxVertices;
+    CurIndexBase = RingSlot * sizeof(IndexBuffer);
+    return true;
+}
+
+void GLRenderer3D::EndVertexUpload()
+{
+    if (PersistentRing)
+        return;
+
+    // orphan the old storage so this doesn't wait for draws still using it
+    glBindBuffer(GL_ARRAY_BUFFER, VertexBufferID);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(VertexBuffer), nullptr, GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, NumVertices*7*4, VertexBuffer);
+
+    // bind to access the index buffer
+    glBindVertexArray(VertexArrayID);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(IndexBuffer), nullptr, GL_STREAM_DRAW);
+    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, NumIndices * 2, IndexBuffer);
+    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, EdgeIndicesOffset * 2, NumEdgeIndices * 2, IndexBuffer + EdgeIndicesOffset);
 }
 
 void GLRenderer3D::SetupPolygonTexture(const RendererPolygon* poly) const
@@ -812,7 +1070,8 @@ int GLRenderer3D::RenderSinglePolygon(int i) const
     const RendererPolygon* rp = &PolygonList[i];
 
     SetupPolygonTexture(rp);
-    glDrawElements(rp->PrimType, rp->NumIndices, GL_UNSIGNED_SHORT, (void*)(uintptr_t)(rp->IndicesOffset * 2));
+    glDrawElementsBaseVertex(rp->PrimType, rp->NumIndices, GL_UNSIGNED_SHORT,
+                             (void*)(CurIndexBase + rp->IndicesOffset * 2), CurBaseVertex);
 
     return 1;
 }
@@ -840,7 +1099,8 @@ int GLRenderer3D::RenderPolygonBatch(int i) const
     }
 
     SetupPolygonTexture(rp);
-    glDrawElements(primtype, numindices, GL_UNSIGNED_SHORT, (void*)(uintptr_t)(rp->IndicesOffset * 2));
+    glDrawElementsBaseVertex(primtype, numindices, GL_UNSIGNED_SHORT,
+                             (void*)(CurIndexBase + rp->IndicesOffset * 2), CurBaseVertex);
     return numpolys;
 }
 
@@ -865,7 +1125,8 @@ int GLRenderer3D::RenderPolygonEdgeBatch(int i) const
     }
 
     SetupPolygonTexture(rp);
-    glDrawElements(GL_LINES, numindices, GL_UNSIGNED_SHORT, (void*)(uintptr_t)(rp->EdgeIndicesOffset * 2));
+    glDrawElementsBaseVertex(GL_LINES, numindices, GL_UNSIGNED_SHORT,
+                             (void*)(CurIndexBase + rp->EdgeIndicesOffset * 2), CurBaseVertex);
     return numpolys;
 }
 
@@ -1381,10 +1642,13 @@ void GLRenderer3D::RenderFrame()
     ShaderConfig.uFogOffset = GPU3D.RenderFogOffset;
     ShaderConfig.uFogShift = GPU3D.RenderFogShift;
 
-    glBindBuffer(GL_UNIFORM_BUFFER, ShaderConfigUBO);
-    void* unibuf = glMapBuffer(GL_UNIFORM_BUFFER, GL_WRITE_ONLY);
-    if (unibuf) memcpy(unibuf, &ShaderConfig, sizeof(ShaderConfig));
-    glUnmapBuffer(GL_UNIFORM_BUFFER);
+    // mostly the same from one frame to the next
+    if (memcmp(&ShaderConfig, &UploadedShaderConfig, sizeof(ShaderConfig)) != 0)
+    {
+        glBindBuffer(GL_UNIFORM_BUFFER, ShaderConfigUBO);
+        glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(ShaderConfig), &ShaderConfig);
+        memcpy(&UploadedShaderConfig, &ShaderConfig, sizeof(ShaderConfig));
+    }
 
     glDisable(GL_SCISSOR_TEST);
     glEnable(GL_DEPTH_TEST);
@@ -1467,19 +1731,26 @@ void GLRenderer3D::RenderFrame()
 
             npolys++;
         }
-        NumFinalPolys = npolys;
-        NumOpaqueFinalPolys = firsttrans;
+        auto buildstart = std::chrono::steady_clock::now();
+        if (!BeginVertexUpload())
+            return;
+        npolys = BuildPolygons(&PolygonList[0], npolys, captureinfo);
+        EndVertexUpload();
+        u32 buildus = (u32)std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - buildstart).count();
+
+        BuildStats.Frames++;
+        BuildStats.TotalUS += buildus;
+        BuildStats.LastUS = buildus;
+        BuildStats.LastPolygons = npolys;
 
-        BuildPolygons(&PolygonList[0], npolys, captureinfo);
-        glBindBuffer(GL_ARRAY_BUFFER, VertexBufferID);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, NumVertices*7*4, VertexBuffer);
-
-        // bind to access the index buffer
-        glBindVertexArray(VertexArrayID);
-        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, NumIndices * 2, IndexBuffer);
-        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, EdgeIndicesOffset * 2, NumEdgeIndices * 2, IndexBuffer + EdgeIndicesOffset);
+        NumFinalPolys = npolys;
+        NumOpaqueFinalPolys = (firsttrans < npolys) ? firsttrans : -1;
 
         RenderSceneChunk(0, 192);
+
+        if (PersistentRing)
+            RingFence[RingSlot] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
     }
 }
 
@@ -19,6 +19,11 @@
 #pragma once
 
 #ifdef OGLRENDERER_ENABLED
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 #include "GPU3D.h"
 #include "OpenGLSupport.h"
 #include "GPU3D_TexcacheOpenGL.h"
@@ -28,6 +33,18 @@ namespace melonDS
 {
 class GLRenderer;
 
+// CPU side of getting a frame's polygons to the GPU, since the last Reset().
+struct GLPolygonBuildStats
+{
+    u64 Frames = 0;
+    u64 TotalUS = 0;        // building vertices and indices, and uploading them
+    u32 LastUS = 0;
+    u32 LastPolygons = 0;
+    u32 LastThreads = 0;    // threads that built the last frame's polygons
+    u64 RingWaits = 0;      // frames that found their ring slot still in use
+    bool Persistent = false; // persistently mapped ring, not orphaned buffers
+};
+
 class GLRenderer3D : public Renderer3D
 {
 public:
@@ -45,6 +62,10 @@ public:
     void RenderFrame() override;
     u32* GetLine(int line) override;
 
+    // 0 picks from the hardware, 1 builds polygons on the calling thread only
+    void SetPolygonBuildThreads(int numThreads) noexcept;
+    [[nodiscard]] const GLPolygonBuildStats& GetPolygonBuildStats() const noexcept { return BuildStats; }
+
 private:
     GLRenderer& Parent;
 
@@ -60,6 +81,10 @@ private:
         u32 IndicesOffset;
         GLuint PrimType;
 
+        u32 NumVertices;
+        u32 VerticesOffset;
+        u32 TexLayer;
+
         u32 NumEdgeIndices;
         u32 EdgeIndicesOffset;
 
@@ -79,7 +104,13 @@ private:
     void UseRenderShader(bool wbuffer);
     void SetupPolygon(RendererPolygon* rp, Polygon* polygon) const;
     u32* SetupVertex(const Polygon* poly, int vid, const Vertex* vtx, u32 vtxattr, u32 texlayer, u32* vptr) const;
-    void BuildPolygons(RendererPolygon* polygons, int npolys, int captureinfo[16]);
+    int BuildPolygons(RendererPolygon* polygons, int npolys, int captureinfo[16]);
+    void WritePolygons(const RendererPolygon* polygons, int start, int end) const;
+    void RunBuildBands(int bands);
+    void BuildWorkerFunc();
+    void StopBuildWorkers();
+    bool BeginVertexUpload();
+    void EndVertexUpload();
     void SetupPolygonTexture(const RendererPolygon* poly) const;
     int RenderSinglePolygon(int i) const;
     int RenderPolygonBatch(int i) const;
@@ -121,6 +152,7 @@ private:
     } ShaderConfig {};
 
     GLuint ShaderConfigUBO {};
+    decltype(ShaderConfig) UploadedShaderConfig {};
     int NumFinalPolys {}, NumOpaqueFinalPolys {};
 
     GLuint ClearVertexBufferID = 0, ClearVertexArrayID {};
@@ -143,17 +175,50 @@ private:
     // * bit8: front-facing (?)
     // * bit9: W-buffering (?)
 
+    static constexpr u32 MaxVertices = 10240;
+    static constexpr u32 MaxIndices = 2048 * 40;
+
     GLuint VertexBufferID {};
-    u32 VertexBuffer[10240 * 7] {};
+    u32 VertexBuffer[MaxVertices * 7] {};
     u32 NumVertices {};
 
     GLuint VertexArrayID {};
     GLuint IndexBufferID {};
-    u16 IndexBuffer[2048 * 40] {};
+    u16 IndexBuffer[MaxIndices] {};
     u32 NumIndices {}, NumEdgeIndices {};
 
     const u32 EdgeIndicesOffset = 2048 * 30;
 
+    // With GL_ARB_buffer_storage, both buffers hold three frames' worth of
+    // data and stay mapped: each frame writes its polygons straight into the
+    // next slot, after waiting on the fence of the frame that last drew from
+    // it. Otherwise the polygons are built in the arrays above and uploaded
+    // into a freshly orphaned buffer.
+    static constexpr int RingSize = 3;
+    bool PersistentRing {};
+    u32* RingVertexData {};
+    u16* RingIndexData {};
+    GLsync RingFence[RingSize] {};
+    int RingSlot {};
+
+    // where this frame's polygons go, and where the draws find them
+    u32* CurVertexData {};
+    u16* CurIndexData {};
+    GLint CurBaseVertex {};
+    uintptr_t CurIndexBase {};
+
+    // polygon building is split in bands across these for big scenes
+    int BuildThreads {};
+    std::vector<std::thread> BuildWorkers;
+    std::mutex BuildLock;
+    std::condition_variable BuildReady, BuildDone;
+    const RendererPolygon* BuildPolys {};
+    int BuildNumPolys {}, BuildBandSize {};
+    int BuildNumBands {}, BuildNextBand {}, BuildBandsLeft {};
+    u64 BuildGeneration {};
+    bool BuildQuit {};
+    GLPolygonBuildStats BuildStats;
+
     int ScaleFactor {};
     bool BetterPolygons {};
     int ScreenW {}, ScreenH {};
@@ -46,6 +46,10 @@ void SoftRenderer3D::StopRenderThread()
 
 void SoftRenderer3D::SetupRenderThread()
 {
+    // the render thread reads the texture views while the next frame's
+    // VRAM writes come in, so they can't be live aliases of the banks
+    GPU.SetTextureVRAMSnapshots(Threaded);
+
     if (Threaded)
     {
         if (!RenderThreadRunning.load(std::memory_order_relaxed))
@@ -1816,14 +1820,10 @@ void SoftRenderer3D::RenderThreadFunc()
     }
 }
 
-u32* SoftRenderer3D::GetLine(int line)
+u32* SoftRenderer3D::GetRawLine(int line)
 {
     if (GPU3D.AbortFrame)
-    {
-        // TODO this isn't accurate
-        memset(ScrolledLine, 0, sizeof(ScrolledLine));
-        return ScrolledLine;
-    }
+        return nullptr;
 
     if (RenderThreadRunning.load(std::memory_order_relaxed))
     {
@@ -1834,7 +1834,19 @@ u32* SoftRenderer3D::GetLine(int line)
             Platform::Semaphore_Wait(Sema_ScanlineCount);
     }
 
-    u32* rawline = &ColorBuffer[(line * ScanlineWidth) + FirstPixelOffset];
+    return &ColorBuffer[(line * ScanlineWidth) + FirstPixelOffset];
+}
+
+u32* SoftRenderer3D::GetLine(int line)
+{
+    u32* rawline = GetRawLine(line);
+    if (!rawline)
+    {
+        // TODO this isn't accurate
+        memset(ScrolledLine, 0, sizeof(ScrolledLine));
+        return ScrolledLine;
+    }
+
     u16 xpos = GPU3D.RenderXPos;
     if (xpos == 0)
         return rawline;
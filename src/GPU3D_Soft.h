@@ -48,6 +48,10 @@ public:
     void RestartFrame() override;
 
     u32* GetLine(int line) override;
+    // The line as rendered, before the 3D layer's X scroll is applied, or
+    // nullptr if the frame was aborted. Like GetLine(), this waits for the
+    // render thread, so it has to be called once per line, top to bottom.
+    u32* GetRawLine(int line);
 
     void SetupRenderThread();
     void EnableRenderThread();
@@ -5,10 +5,15 @@
 #include "GPU.h"
 
 #include <assert.h>
+#include <algorithm>
 #include <cstddef>
+#include <deque>
 #include <unordered_map>
 #include <vector>
 
+#include "MelonPrimeTrace.h"
+#include "Platform.h"
+
 #define XXH_STATIC_LINKING_ONLY
 #include "xxhash/xxhash.h"
 
@@ -78,6 +83,17 @@ struct NoopTextureDecodeTimer
     constexpr NoopTextureDecodeTimer() noexcept = default;
 };
 
+// Counters since the last Reset(). BytesSaved is what the layers shared by
+// more than one cache entry would take up again if every entry had its own.
+struct TexcacheStats
+{
+    u64 Hits = 0;           // found by texture parameters and palette address
+    u64 Misses = 0;         // decoded and uploaded
+    u64 DedupHits = 0;      // new parameters, same content as a live layer
+    u64 Revived = 0;        // same content as a freed layer nothing reused yet
+    u64 BytesSaved = 0;
+};
+
 template <typename TexLoaderT, typename TexHandleT>
 class Texcache
 {
@@ -188,7 +204,7 @@ public:
                 it++;
                 continue;
             invalidate:
-                FreeTextures[entry.WidthLog2][entry.HeightLog2].push_back(entry.Texture);
+                ReleaseLayer(entry);
 
                 //printf("invalidating texture %d\n", entry.ImageDescriptor);
 
@@ -222,6 +238,7 @@ public:
 
         if (it != Cache.end())
         {
+            Stats.Hits++;
             textureHandle = it->second.Texture.TextureID;
             layer = it->second.Texture.Layer;
             helper = &it->second.LastVariant;
@@ -241,8 +258,93 @@ public:
         entry.WidthLog2 = widthLog2;
         entry.HeightLog2 = heightLog2;
 
+        // the VRAM ranges the texture is made of, which are hashed up front
+        // so content that is already decoded somewhere else can be found
+        u32 palAddr = 0;
+        if (fmt == 7)
+        {
+            entry.TextureRAMSize[0] = width * height * 2;
+        }
+        else if (fmt == 5)
+        {
+            u32 slot1addr = 0x20000 + ((addr & 0x1FFFC) >> 1);
+            if (addr >= 0x40000)
+                slot1addr += 0x10000;
+
+            entry.TextureRAMSize[0] = width * height / 16 * 4;
+            entry.TextureRAMStart[1] = slot1addr;
+            entry.TextureRAMSize[1] = width * height / 16 * 2;
+            entry.TexPalStart = palAddr = palBase * 16;
+            entry.TexPalSize = 0x10000;
+        }
+        else
+        {
+            u32 texSize, numPalEntries;
+            palAddr = palBase * 16;
+            switch (fmt)
+            {
+            case 1: texSize = width * height; numPalEntries = 32; break;
+            case 6: texSize = width * height; numPalEntries = 8; break;
+            case 2: texSize = width * height / 4; numPalEntries = 4; palAddr >>= 1; break;
+            case 3: texSize = width * height / 2; numPalEntries = 16; break;
+            case 4: texSize = width * height; numPalEntries = 256; break;
+            default: texSize = 0; numPalEntries = 0; break;
+            }
+
+            palAddr &= 0x1FFFF;
+
+            entry.TextureRAMSize[0] = texSize;
+            entry.TexPalStart = palAddr;
+            entry.TexPalSize = numPalEntries * 2;
+        }
+
+        for (int i = 0; i < 2; i++)
+        {
+            if (entry.TextureRAMSize[i])
+                entry.TextureHash[i] = MaskedHash(GPU.VRAMFlat_Texture, sizeof(GPU.VRAMFlat_Texture),
+                    entry.TextureRAMStart[i], entry.TextureRAMSize[i]);
+        }
+        if (entry.TexPalSize)
+            entry.TexPalHash = MaskedHash(GPU.VRAMFlat_TexPal, sizeof(GPU.VRAMFlat_TexPal),
+                entry.TexPalStart, entry.TexPalSize);
+
+        ContentKey content;
+        content.TextureHash[0] = entry.TextureHash[0];
+        content.TextureHash[1] = entry.TextureHash[1];
+        content.TexPalHash = entry.TexPalHash;
+        // size and format, plus color 0 transparency for the formats using it
+        content.Format = (texParam >> 20) & ((fmt >= 2 && fmt <= 4) ? 0x3FF : 0x1FF);
+
+        auto shared = ContentIndex.find(content);
+        if (shared != ContentIndex.end())
+        {
+            entry.Texture = shared->second;
+            LayerUse& use = LayerUses[widthLog2][heightLog2][entry.Texture.Slot];
+            if (use.RefCount == 0)
+            {
+                // freed by an invalidation (usually the texture moving in
+                // VRAM) but not handed out again, so still holding the pixels
+                auto& freeTextures = FreeTextures[widthLog2][heightLog2];
+                freeTextures.erase(std::find_if(freeTextures.begin(), freeTextures.end(),
+                    [&](const TexArrayEntry& e) { return e.Slot == entry.Texture.Slot; }));
+                Stats.Revived++;
+            }
+            else
+            {
+                Stats.DedupHits++;
+                Stats.BytesSaved += width * height * 4;
+            }
+            use.RefCount++;
+
+            textureHandle = entry.Texture.TextureID;
+            layer = entry.Texture.Layer;
+            helper = &Cache.emplace(std::make_pair(key, entry)).first->second.LastVariant;
+            return;
+        }
+
         auto& texArrays = TexArrays[widthLog2][heightLog2];
         auto& freeTextures = FreeTextures[widthLog2][heightLog2];
+        auto& layerUses = LayerUses[widthLog2][heightLog2];
 
         if (freeTextures.empty())
         {
@@ -263,13 +365,27 @@ public:
             }
 
             for (u32 i = 0; i < layers; i++)
-                freeTextures.push_back(TexArrayEntry{array, i});
+            {
+                freeTextures.push_back(TexArrayEntry{array, i, (u32)layerUses.size()});
+                layerUses.push_back(LayerUse{});
+            }
         }
 
-        TexArrayEntry storagePlace = freeTextures.back();
-        freeTextures.pop_back();
+        // oldest first, so freed layers keep their content for as long as
+        // possible in case it shows up again somewhere else
+        TexArrayEntry storagePlace = freeTextures.front();
+        freeTextures.pop_front();
         entry.Texture = storagePlace;
 
+        LayerUse& use = layerUses[storagePlace.Slot];
+        if (use.Indexed)
+            ContentIndex.erase(use.Content);
+        use.RefCount = 1;
+        use.Indexed = true;
+        use.Content = content;
+        ContentIndex.emplace(content, storagePlace);
+        Stats.Misses++;
+
         const std::size_t decodedBytes = static_cast<std::size_t>(width) * height * 4u;
         TextureDecodeTarget decodeTarget = TexLoader.BeginTextureUpload(
             storagePlace.TextureID, width, height, storagePlace.Layer);
@@ -284,47 +400,21 @@ public:
             : DecodingBuffer;
 
         {
+            MelonPrimeTrace::Scope trace(MelonPrimeTrace::Category::Texture, "Decode texture",
+                                         (u64)width * height, MelonPrimeTrace::ArgKind::Count);
             auto decodeTimer = TexLoader.BeginTextureDecode();
             // apparently a new texture
             if (fmt == 7)
             {
-                entry.TextureRAMSize[0] = width * height * 2;
                 ConvertBitmapTexture<outputFmt_RGB6A5>(width, height, decodeBuffer, addr, GPU);
             }
             else if (fmt == 5)
             {
-                u32 slot1addr = 0x20000 + ((addr & 0x1FFFC) >> 1);
-                if (addr >= 0x40000)
-                    slot1addr += 0x10000;
-
-                entry.TextureRAMSize[0] = width * height / 16 * 4;
-                entry.TextureRAMStart[1] = slot1addr;
-                entry.TextureRAMSize[1] = width * height / 16 * 2;
-                entry.TexPalStart = palBase * 16;
-                entry.TexPalSize = 0x10000;
-
                 ConvertCompressedTexture<outputFmt_RGB6A5>(
-                    width, height, decodeBuffer, addr, slot1addr, entry.TexPalStart, GPU);
+                    width, height, decodeBuffer, addr, entry.TextureRAMStart[1], palAddr, GPU);
             }
             else
             {
-                u32 texSize, palAddr = palBase * 16, numPalEntries;
-                switch (fmt)
-                {
-                case 1: texSize = width * height; numPalEntries = 32; break;
-                case 6: texSize = width * height; numPalEntries = 8; break;
-                case 2: texSize = width * height / 4; numPalEntries = 4; palAddr >>= 1; break;
-                case 3: texSize = width * height / 2; numPalEntries = 16; break;
-                case 4: texSize = width * height; numPalEntries = 256; break;
-                default: texSize = 0; numPalEntries = 0; break;
-                }
-
-                palAddr &= 0x1FFFF;
-
-                entry.TextureRAMSize[0] = texSize;
-                entry.TexPalStart = palAddr;
-                entry.TexPalSize = numPalEntries * 2;
-
                 const bool color0Transparent = texParam & (1 << 29);
 
                 switch (fmt)
@@ -344,16 +434,6 @@ public:
             }
         }
 
-        for (int i = 0; i < 2; i++)
-        {
-            if (entry.TextureRAMSize[i])
-                entry.TextureHash[i] = MaskedHash(GPU.VRAMFlat_Texture, sizeof(GPU.VRAMFlat_Texture),
-                    entry.TextureRAMStart[i], entry.TextureRAMSize[i]);
-        }
-        if (entry.TexPalSize)
-            entry.TexPalHash = MaskedHash(GPU.VRAMFlat_TexPal, sizeof(GPU.VRAMFlat_TexPal),
-                entry.TexPalStart, entry.TexPalSize);
-
         if (decodeTarget.Pixels != nullptr)
             TexLoader.CommitTextureUpload(decodeTarget.Token);
         else
@@ -368,6 +448,13 @@ public:
 
     void Reset()
     {
+        if (Stats.Misses)
+            Platform::Log(Platform::LogLevel::Debug,
+                "Texcache: %llu hits, %llu decoded, %llu deduplicated, %llu revived, %llu KB shared\n",
+                (unsigned long long)Stats.Hits, (unsigned long long)Stats.Misses,
+                (unsigned long long)Stats.DedupHits, (unsigned long long)Stats.Revived,
+                (unsigned long long)(Stats.BytesSaved / 1024));
+
         for (u32 i = 0; i < 8; i++)
         {
             for (u32 j = 0; j < 8; j++)
@@ -376,11 +463,16 @@ public:
                     TexLoader.DeleteTexture(TexArrays[i][j][k]);
                 TexArrays[i][j].clear();
                 FreeTextures[i][j].clear();
+                LayerUses[i][j].clear();
             }
         }
         Cache.clear();
+        ContentIndex.clear();
+        Stats = {};
     }
 
+    const TexcacheStats& GetStats() const noexcept { return Stats; }
+
 private:
     melonDS::GPU& GPU;
 
@@ -388,6 +480,43 @@ private:
     {
         TexHandleT TextureID;
         u32 Layer;
+        u32 Slot; // into LayerUses
+    };
+
+    // What a layer holds, independent of where in VRAM it was decoded from.
+    struct ContentKey
+    {
+        u64 TextureHash[2];
+        u64 TexPalHash;
+        u32 Format;
+
+        bool operator==(const ContentKey& other) const
+        {
+            return TextureHash[0] == other.TextureHash[0]
+                && TextureHash[1] == other.TextureHash[1]
+                && TexPalHash == other.TexPalHash
+                && Format == other.Format;
+        }
+    };
+    struct ContentKeyHash
+    {
+        std::size_t operator()(const ContentKey& k) const
+        {
+            return (std::size_t)(k.TextureHash[0]
+                ^ (k.TextureHash[1] * 0x9E3779B97F4A7C15ull)
+                ^ (k.TexPalHash * 0xC2B2AE3D27D4EB4Full)
+                ^ k.Format);
+        }
+    };
+
+    // A layer is shared by every cache entry with the same content and only
+    // goes back to FreeTextures once the last of them is invalidated. It
+    // stays in ContentIndex until it is handed out again.
+    struct LayerUse
+    {
+        u32 RefCount = 0;
+        bool Indexed = false;
+        ContentKey Content {};
     };
 
     struct TexCacheEntry
@@ -403,11 +532,24 @@ private:
         u64 TexPalHash;
     };
     std::unordered_map<u64, TexCacheEntry> Cache;
+    std::unordered_map<ContentKey, TexArrayEntry, ContentKeyHash> ContentIndex;
 
     TexLoaderT TexLoader;
 
-    std::vector<TexArrayEntry> FreeTextures[8][8];
+    std::deque<TexArrayEntry> FreeTextures[8][8];
     std::vector<TexHandleT> TexArrays[8][8];
+    std::vector<LayerUse> LayerUses[8][8];
+
+    TexcacheStats Stats;
+
+    void ReleaseLayer(const TexCacheEntry& entry)
+    {
+        LayerUse& use = LayerUses[entry.WidthLog2][entry.HeightLog2][entry.Texture.Slot];
+        if (use.RefCount > 1)
+            Stats.BytesSaved -= (8u << entry.WidthLog2) * (8u << entry.HeightLog2) * 4;
+        if (--use.RefCount == 0)
+            FreeTextures[entry.WidthLog2][entry.HeightLog2].push_back(entry.Texture);
+    }
 
     u32 DecodingBuffer[1024*1024];
 };
@@ -40,6 +40,7 @@
 #include "VulkanFeatureProbe.h"
 #include "VulkanPerf.h"
 #include "VulkanPresentedFrame.h"
+#include "VulkanShaderStore.h"
 
 namespace melonDS
 {
@@ -1078,6 +1079,8 @@ void VulkanRenderer3D::SetRenderSettings(int scale, bool hiresCoordinates)
 
     ReleasePipelines();
     ShaderStepIdx = 0;
+    RenderSettingsTime = std::chrono::steady_clock::now();
+    FirstFrameLogged = false;
 
     if (!CreateScaleDependentResources())
     {
@@ -1230,9 +1233,10 @@ bool VulkanRenderer3D::BuildPipeline(u32 pipelineIndex)
     const Vk::DeviceDispatch& fns = Device.Fns();
     VkDevice device = Device.GetHandle();
 
-    const VulkanShaders::ShaderModule& blob =
+    const VulkanShaders::ShaderModule* blob =
         VulkanShaders::Modules[TileGeometryBucket][pipelineIndex];
-    if (!blob.Words || blob.WordCount == 0)
+    const u32* words = blob ? Vk::InflateShaderModule(*blob) : nullptr;
+    if (!words)
     {
         SetRuntimeFailure(
             std::string("no SPIR-V module for pipeline ")
@@ -1242,8 +1246,8 @@ bool VulkanRenderer3D::BuildPipeline(u32 pipelineIndex)
 
     VkShaderModuleCreateInfo moduleInfo{};
     moduleInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-    moduleInfo.codeSize = static_cast<size_t>(blob.WordCount) * sizeof(u32);
-    moduleInfo.pCode = blob.Words;
+    moduleInfo.codeSize = static_cast<size_t>(blob->WordCount) * sizeof(u32);
+    moduleInfo.pCode = words;
 
     VkShaderModule module = VK_NULL_HANDLE;
     if (!MELONPRIME_VK_CHECK("vkCreateShaderModule",
@@ -2945,6 +2949,22 @@ void VulkanRenderer3D::RenderFrame()
         // FinalFB now carries a real frame. The compositor gates on this so it
         // never samples the undefined contents a freshly created image has.
         FinalFBHasContent = true;
+
+        if (!FirstFrameLogged)
+        {
+            // Time to first frame, shader stepping included: the number to
+            // compare cold (empty pipeline cache) against warm runs.
+            FirstFrameLogged = true;
+            const Vk::ShaderInflateStats inflate = Vk::GetShaderInflateStats();
+            Platform::Log(Platform::LogLevel::Info,
+                "[Vulkan] first frame submitted %.1f ms after the resolution change; "
+                "%u shader modules inflated (%.1f -> %.1f KiB in %.2f ms)\n",
+                std::chrono::duration<double, std::milli>(
+                    std::chrono::steady_clock::now() - RenderSettingsTime).count(),
+                inflate.Modules, static_cast<double>(inflate.CompressedBytes) / 1024.0,
+                static_cast<double>(inflate.InflatedBytes) / 1024.0,
+                static_cast<double>(inflate.Nanoseconds) / 1e6);
+        }
     }
     else
     {
@@ -22,6 +22,7 @@
 #if defined(MELONPRIME_DS) && defined(MELONPRIME_ENABLE_VULKAN)
 
 #include <array>
+#include <chrono>
 #include <memory>
 #include <string>
 #include <vector>
@@ -572,6 +573,8 @@ private:
 
     // --- state -------------------------------------------------------------
     int ShaderStepIdx = 0;
+    std::chrono::steady_clock::time_point RenderSettingsTime;
+    bool FirstFrameLogged = true;
     bool RuntimeFailed = false;
     std::string RuntimeFailureReason;
     GPU2DComposeResult LastComposeResult = GPU2DComposeResult::Unavailable;
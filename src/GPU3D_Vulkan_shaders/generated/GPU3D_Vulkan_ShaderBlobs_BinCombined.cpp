@@ -28,13 +28,12 @@
     Pipeline indices match ComputeRenderer3D::ShaderCompileStep() in
     src/GPU3D_Compute.cpp one for one.
 
-    The SPIR-V words live in per-stage translation units rather than in the
-    header so that including the public header stays cheap: the full module set
-    is a few megabytes of integer literals and would otherwise be re-parsed by
-    every consumer.
+    Every module is one zstd frame, inflated on first use by
+    Vk::InflateShaderModule(). The frames live in per-stage translation units
+    rather than in the header so that including the public header stays cheap.
 */
 
-// SPIR-V for src/GPU3D_Vulkan_shaders/BinCombined.comp.
+// SPIR-V for src/GPU3D_Vulkan_shaders/BinCombined.comp, one zstd frame per module.
 
 #include "GPU3D_Vulkan_ShaderBlobs.h"
 
@@ -45,1820 +44,951 @@ namespace VulkanShaders
 namespace detail
 {
 
-extern const uint32_t Blob002[4800];
-const uint32_t Blob002[4800] = {
-    0x07230203, 0x00010300, 0x0008000b, 0x0000027a, 0x00000000, 0x00020011, 0x00000001, 0x0006000b,
-    0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001,
-    0x0007000f, 0x00000005, 0x00000004, 0x6e69616d, 0x00000000, 0x00000117, 0x00000122, 0x00060010,
-    0x00000004, 0x00000011, 0x00000020, 0x00000001, 0x00000001, 0x00030003, 0x00000002, 0x000001c2,
-    0x000a0004, 0x475f4c47, 0x4c474f4f, 0x70635f45, 0x74735f70, 0x5f656c79, 0x656e696c, 0x7269645f,
-    0x69746365, 0x00006576, 0x00080004, 0x475f4c47, 0x4c474f4f, 0x6e695f45, 0x64756c63, 0x69645f65,
-    0x74636572, 0x00657669, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000, 0x00040005, 0x00000009,
-    0x796c6f50, 0x006e6f67, 0x00060006, 0x00000009, 0x00000000, 0x73726946, 0x70535874, 0x00006e61,
-    0x00050006, 0x00000009, 0x00000001, 0x706f5459, 0x00000000, 0x00050006, 0x00000009, 0x00000002,
-    0x746f4259, 0x00000000, 0x00050006, 0x00000009, 0x00000003, 0x6e694d58, 0x00000000, 0x00050006,
-    0x00000009, 0x00000004, 0x78614d58, 0x00000000, 0x00050006, 0x00000009, 0x00000005, 0x6e694d58,
-    0x00000059, 0x00050006, 0x00000009, 0x00000006, 0x78614d58, 0x00000059, 0x00050006, 0x00000009,
-    0x00000007, 0x69726156, 0x00746e61, 0x00050006, 0x00000009, 0x00000008, 0x72747441, 0x00000000,
-    0x00070006, 0x00000009, 0x00000009, 0x74786554, 0x4c657275, 0x72657961, 0x00000000, 0x00060006,
-    0x00000009, 0x0000000a, 0x69636146, 0x6956676e, 0x00007765, 0x00140005, 0x00000012, 0x506e6942,
-    0x67796c6f, 0x73286e6f, 0x63757274, 0x6f502d74, 0x6f67796c, 0x31692d6e, 0x2d31692d, 0x692d3169,
-    0x31692d31, 0x2d31692d, 0x692d3169, 0x31752d31, 0x2d31662d, 0x3b313175, 0x3b326976, 0x3b326976,
-    0x00000000, 0x00040005, 0x0000000f, 0x796c6f70, 0x006e6f67, 0x00040005, 0x00000010, 0x4c706f74,
-    0x00746665, 0x00050005, 0x00000011, 0x52746f62, 0x74686769, 0x00000000, 0x00060005, 0x0000002a,
-    0x796c6f70, 0x486e6f67, 0x68676965, 0x00000074, 0x00060005, 0x00000030, 0x796c6f70, 0x656e6e49,
-    0x706f5472, 0x00000059, 0x00060005, 0x0000003b, 0x796c6f70, 0x656e6e49, 0x746f4272, 0x00000059,
-    0x00050005, 0x00000045, 0x61705358, 0x7465536e, 0x00007075, 0x00040006, 0x00000045, 0x00000000,
-    0x00003058, 0x00040006, 0x00000045, 0x00000001, 0x00003158, 0x00060006, 0x00000045, 0x00000002,
-    0x69736e49, 0x74536564, 0x00747261, 0x00060006, 0x00000045, 0x00000003, 0x69736e49, 0x6e456564,
-    0x00000064, 0x00060006, 0x00000045, 0x00000004, 0x65676445, 0x4c766f43, 0x00000000, 0x00060006,
-    0x00000045, 0x00000005, 0x65676445, 0x52766f43, 0x00000000, 0x00050006, 0x00000045, 0x00000006,
-    0x63655258, 0x00007069, 0x00050006, 0x00000045, 0x00000007, 0x67616c46, 0x00000073, 0x00040006,
-    0x00000045, 0x00000008, 0x0000305a, 0x00040006, 0x00000045, 0x00000009, 0x0000315a, 0x00040006,
-    0x00000045, 0x0000000a, 0x00003057, 0x00040006, 0x00000045, 0x0000000b, 0x00003157, 0x00050006,
-    0x00000045, 0x0000000c, 0x6f6c6f43, 0x00305272, 0x00050006, 0x00000045, 0x0000000d, 0x6f6c6f43,
-    0x00304772, 0x00050006, 0x00000045, 0x0000000e, 0x6f6c6f43, 0x00304272, 0x00050006, 0x00000045,
-    0x0000000f, 0x6f6c6f43, 0x00315272, 0x00050006, 0x00000045, 0x00000010, 0x6f6c6f43, 0x00314772,
-    0x00050006, 0x00000045, 0x00000011, 0x6f6c6f43, 0x00314272, 0x00060006, 0x00000045, 0x00000012,
-    0x63786554, 0x64726f6f, 0x00003055, 0x00060006, 0x00000045, 0x00000013, 0x63786554, 0x64726f6f,
-    0x00003056, 0x00060006, 0x00000045, 0x00000014, 0x63786554, 0x64726f6f, 0x00003155, 0x00060006,
-    0x00000045, 0x00000015, 0x63786554, 0x64726f6f, 0x00003156, 0x00060006, 0x00000045, 0x00000016,
-    0x4c766f43, 0x74696e49, 0x006c6169, 0x00060006, 0x00000045, 0x00000017, 0x52766f43, 0x74696e49,
-    0x006c6169, 0x00050005, 0x00000047, 0x61707378, 0x706f546e, 0x00000000, 0x00050005, 0x00000048,
-    0x61705358, 0x7465536e, 0x00007075, 0x00040006, 0x00000048, 0x00000000, 0x00003058, 0x00040006,
-    0x00000048, 0x00000001, 0x00003158, 0x00060006, 0x00000048, 0x00000002, 0x69736e49, 0x74536564,
-    0x00747261, 0x00060006, 0x00000048, 0x00000003, 0x69736e49, 0x6e456564, 0x00000064, 0x00060006,
-    0x00000048, 0x00000004, 0x65676445, 0x4c766f43, 0x00000000, 0x00060006, 0x00000048, 0x00000005,
-    0x65676445, 0x52766f43, 0x00000000, 0x00050006, 0x00000048, 0x00000006, 0x63655258, 0x00007069,
-    0x00050006, 0x00000048, 0x00000007, 0x67616c46, 0x00000073, 0x00040006, 0x00000048, 0x00000008,
-    0x0000305a, 0x00040006, 0x00000048, 0x00000009, 0x0000315a, 0x00040006, 0x00000048, 0x0000000a,
-    0x00003057, 0x00040006, 0x00000048, 0x0000000b, 0x00003157, 0x00050006, 0x00000048, 0x0000000c,
-    0x6f6c6f43, 0x00305272, 0x00050006, 0x00000048, 0x0000000d, 0x6f6c6f43, 0x00304772, 0x00050006,
-    0x00000048, 0x0000000e, 0x6f6c6f43, 0x00304272, 0x00050006, 0x00000048, 0x0000000f, 0x6f6c6f43,
-    0x00315272, 0x00050006, 0x00000048, 0x00000010, 0x6f6c6f43, 0x00314772, 0x00050006, 0x00000048,
-    0x00000011, 0x6f6c6f43, 0x00314272, 0x00060006, 0x00000048, 0x00000012, 0x63786554, 0x64726f6f,
-    0x00003055, 0x00060006, 0x00000048, 0x00000013, 0x63786554, 0x64726f6f, 0x00003056, 0x00060006,
-    0x00000048, 0x00000014, 0x63786554, 0x64726f6f, 0x00003155, 0x00060006, 0x00000048, 0x00000015,
-    0x63786554, 0x64726f6f, 0x00003156, 0x00060006, 0x00000048, 0x00000016, 0x4c766f43, 0x74696e49,
-    0x006c6169, 0x00060006, 0x00000048, 0x00000017, 0x52766f43, 0x74696e49, 0x006c6169, 0x00070005,
-    0x0000004a, 0x61705358, 0x7465536e, 0x42737075, 0x65666675, 0x00000072, 0x00060006, 0x0000004a,
-    0x00000000, 0x61705358, 0x7465536e, 0x00737075, 0x00030005, 0x0000004c, 0x00000000, 0x00050005,
-    0x0000009a, 0x61707378, 0x746f426e, 0x00000000, 0x00040005, 0x000000e0, 0x586e696d, 0x0000004c,
-    0x00040005, 0x00000100, 0x5878616d, 0x00000052, 0x00050005, 0x00000114, 0x756f7267, 0x78644970,
-    0x00000000, 0x00060005, 0x00000117, 0x575f6c67, 0x476b726f, 0x70756f72, 0x00004449, 0x00050005,
-    0x0000011c, 0x72616f63, 0x69546573, 0x0000656c, 0x00050005, 0x00000121, 0x61636f6c, 0x7864496c,
-    0x00000000, 0x00080005, 0x00000122, 0x4c5f6c67, 0x6c61636f, 0x6f766e49, 0x69746163, 0x6e496e6f,
-    0x00786564, 0x00070005, 0x0000012a, 0x6772656d, 0x614d6465, 0x68536b73, 0x64657261, 0x00000000,
-    0x00060005, 0x0000012d, 0x61636f6c, 0x6c6f506c, 0x6e6f6779, 0x00786449, 0x00050005, 0x00000133,
-    0x796c6f70, 0x496e6f67, 0x00007864, 0x00060005, 0x00000134, 0x68737550, 0x736e6f43, 0x746e6174,
-    0x00000073, 0x00060006, 0x00000134, 0x00000000, 0x56727543, 0x61697261, 0x0000746e, 0x00060006,
-    0x00000134, 0x00000001, 0x57786554, 0x68746469, 0x00000000, 0x00060006, 0x00000134, 0x00000002,
-    0x48786554, 0x68676965, 0x00000074, 0x00060006, 0x00000134, 0x00000003, 0x57786554, 0x53706172,
-    0x00000000, 0x00060006, 0x00000134, 0x00000004, 0x57786554, 0x54706172, 0x00000000, 0x00070006,
-    0x00000134, 0x00000005, 0x49786554, 0x70614373, 0x65727574, 0x00000000, 0x00070006, 0x00000134,
-    0x00000006, 0x74706143, 0x59657275, 0x7366664f, 0x00007465, 0x00050006, 0x00000134, 0x00000007,
-    0x6461705f, 0x00000000, 0x00030005, 0x00000136, 0x00006370, 0x00060005, 0x0000013d, 0x72616f63,
-    0x6f546573, 0x66654c70, 0x00000074, 0x00060005, 0x00000142, 0x72616f63, 0x6f426573, 0x67695274,
-    0x00007468, 0x00040005, 0x00000149, 0x6e6e6962, 0x00006465, 0x00050005, 0x0000015c, 0x6174654d,
-    0x66696e55, 0x006d726f, 0x00060006, 0x0000015c, 0x00000000, 0x506d754e, 0x67796c6f, 0x00736e6f,
-    0x00060006, 0x0000015c, 0x00000001, 0x566d754e, 0x61697261, 0x0073746e, 0x00060006, 0x0000015c,
-    0x00000002, 0x68706c41, 0x66655261, 0x00000000, 0x00050006, 0x0000015c, 0x00000003, 0x70736944,
-    0x00746e43, 0x00060006, 0x0000015c, 0x00000004, 0x6e6f6f54, 0x6c626154, 0x00000065, 0x00060006,
-    0x0000015c, 0x00000005, 0x61656c43, 0x6c6f4372, 0x0000726f, 0x00060006, 0x0000015c, 0x00000006,
-    0x61656c43, 0x70654472, 0x00006874, 0x00060006, 0x0000015c, 0x00000007, 0x61656c43, 0x74744172,
-    0x00000072, 0x00060006, 0x0000015c, 0x00000008, 0x4f676f46, 0x65736666, 0x00000074, 0x00060006,
-    0x0000015c, 0x00000009, 0x53676f46, 0x74666968, 0x00000000, 0x00060006, 0x0000015c, 0x0000000a,
-    0x43676f46, 0x726f6c6f, 0x00000000, 0x00080006, 0x0000015c, 0x0000000b, 0x61656c43, 0x74694272,
-    0x4f70616d, 0x65736666, 0x00000074, 0x00030005, 0x0000015e, 0x00000000, 0x00040005, 0x00000166,
-    0x796c6f50, 0x006e6f67, 0x00060006, 0x00000166, 0x00000000, 0x73726946, 0x70535874, 0x00006e61,
-    0x00050006, 0x00000166, 0x00000001, 0x706f5459, 0x00000000, 0x00050006, 0x00000166, 0x00000002,
-    0x746f4259, 0x00000000, 0x00050006, 0x00000166, 0x00000003, 0x6e694d58, 0x00000000, 0x00050006,
-    0x00000166, 0x00000004, 0x78614d58, 0x00000000, 0x00050006, 0x00000166, 0x00000005, 0x6e694d58,
-    0x00000059, 0x00050006, 0x00000166, 0x00000006, 0x78614d58, 0x00000059, 0x00050006, 0x00000166,
-    0x00000007, 0x69726156, 0x00746e61, 0x00050006, 0x00000166, 0x00000008, 0x72747441, 0x00000000,
-    0x00070006, 0x00000166, 0x00000009, 0x74786554, 0x4c657275, 0x72657961, 0x00000000, 0x00060006,
-    0x00000166, 0x0000000a, 0x69636146, 0x6956676e, 0x00007765, 0x00060005, 0x00000168, 0x796c6f50,
-    0x426e6f67, 0x65666675, 0x00000072, 0x00060006, 0x00000168, 0x00000000, 0x796c6f50, 0x736e6f67,
-    0x00000000, 0x00030005, 0x0000016a, 0x00000000, 0x00040005, 0x0000016c, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000187, 0x61726170, 0x0000006d, 0x00040005, 0x00000189, 0x61726170, 0x0000006d,
-    0x00050005, 0x00000192, 0x6772656d, 0x614d6465, 0x00006b73, 0x00050005, 0x00000194, 0x656e6966,
-    0x656c6954, 0x00000000, 0x00060005, 0x0000019a, 0x656e6966, 0x656c6954, 0x4c706f54, 0x00746665,
-    0x00070005, 0x000001a0, 0x656e6966, 0x656c6954, 0x52746f42, 0x74686769, 0x00000000, 0x00050005,
-    0x000001a4, 0x6e6e6962, 0x614d6465, 0x00006b73, 0x00030005, 0x000001ac, 0x00746962, 0x00050005,
-    0x000001b4, 0x796c6f70, 0x496e6f67, 0x00007864, 0x00040005, 0x000001be, 0x61726170, 0x0000006d,
-    0x00040005, 0x000001d7, 0x61726170, 0x0000006d, 0x00040005, 0x000001d9, 0x61726170, 0x0000006d,
-    0x00050005, 0x000001e2, 0x656e696c, 0x69547261, 0x0000656c, 0x00050005, 0x000001e7, 0x65726353,
-    0x69576e65, 0x00687464, 0x00060005, 0x000001e8, 0x656c6954, 0x72655073, 0x656e694c, 0x00000000,
-    0x00050005, 0x000001f4, 0x6b726f77, 0x7366664f, 0x00007465, 0x00060005, 0x000001fe, 0x526e6942,
-    0x6c757365, 0x66754274, 0x00726566, 0x00080006, 0x000001fe, 0x00000000, 0x69726156, 0x57746e61,
-    0x436b726f, 0x746e756f, 0x00000000, 0x00080006, 0x000001fe, 0x00000001, 0x74726f53, 0x6f576465,
-    0x664f6b72, 0x74657366, 0x00000000, 0x00090006, 0x000001fe, 0x00000002, 0x69726156, 0x57746e61,
-    0x526b726f, 0x436c6165, 0x746e756f, 0x00000000, 0x00080006, 0x000001fe, 0x00000003, 0x74726f53,
-    0x6b726f57, 0x6b726f57, 0x6e756f43, 0x00000074, 0x00090006, 0x000001fe, 0x00000004, 0x6e6e6942,
-    0x4d676e69, 0x416b7361, 0x664f646e, 0x74657366, 0x00000000, 0x00030005, 0x00000200, 0x00000000,
-    0x00060005, 0x00000208, 0x65726353, 0x65486e65, 0x74686769, 0x00000000, 0x00050005, 0x00000209,
-    0x656c6954, 0x656e694c, 0x00000073, 0x00070005, 0x0000020c, 0x6e6e6942, 0x4d676e69, 0x536b7361,
-    0x74726174, 0x00000000, 0x00060005, 0x00000214, 0x72616f63, 0x614d6573, 0x64496b73, 0x00000078,
-    0x00080005, 0x0000022b, 0x6e6e6942, 0x57676e69, 0x4f6b726f, 0x65736666, 0x74537374, 0x00747261,
-    0x00080005, 0x00000233, 0x656c6974, 0x69736f50, 0x6e6f6974, 0x626d6f43, 0x64656e69, 0x00000000,
-    0x00030005, 0x0000023a, 0x00786469, 0x00030005, 0x00000242, 0x00746962, 0x00050005, 0x0000024a,
-    0x796c6f70, 0x496e6f67, 0x00007864, 0x00050005, 0x00000253, 0x69726176, 0x49746e61, 0x00007864,
-    0x00060005, 0x00000258, 0x61566e69, 0x6e616972, 0x66664f74, 0x00746573, 0x00060005, 0x0000025e,
-    0x6b726f57, 0x63736544, 0x66667542, 0x00007265, 0x00060006, 0x0000025e, 0x00000000, 0x6b726f57,
-    0x63736544, 0x00000073, 0x00030005, 0x00000260, 0x00000000, 0x00060005, 0x00000270, 0x5778614d,
-    0x546b726f, 0x73656c69, 0x00000000, 0x00070005, 0x00000271, 0x6d617246, 0x66756265, 0x53726566,
-    0x64697274, 0x00000065, 0x00080005, 0x00000277, 0x6b726f57, 0x63736544, 0x726f5373, 0x53646574,
-    0x74726174, 0x00000000, 0x00050048, 0x00000048, 0x00000000, 0x00000023, 0x00000000, 0x00050048,
-    0x00000048, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x00000048, 0x00000002, 0x00000023,
-    0x00000008, 0x00050048, 0x00000048, 0x00000003, 0x00000023, 0x0000000c, 0x00050048, 0x00000048,
-    0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x00000048, 0x00000005, 0x00000023, 0x00000014,
-    0x00050048, 0x00000048, 0x00000006, 0x00000023, 0x00000018, 0x00050048, 0x00000048, 0x00000007,
-    0x00000023, 0x0000001c, 0x00050048, 0x00000048, 0x00000008, 0x00000023, 0x00000020, 0x00050048,
-    0x00000048, 0x00000009, 0x00000023, 0x00000024, 0x00050048, 0x00000048, 0x0000000a, 0x00000023,
-    0x00000028, 0x00050048, 0x00000048, 0x0000000b, 0x00000023, 0x0000002c, 0x00050048, 0x00000048,
-    0x0000000c, 0x00000023, 0x00000030, 0x00050048, 0x00000048, 0x0000000d, 0x00000023, 0x00000034,
-    0x00050048, 0x00000048, 0x0000000e, 0x00000023, 0x00000038, 0x00050048, 0x00000048, 0x0000000f,
-    0x00000023, 0x0000003c, 0x00050048, 0x00000048, 0x00000010, 0x00000023, 0x00000040, 0x00050048,
-    0x00000048, 0x00000011, 0x00000023, 0x00000044, 0x00050048, 0x00000048, 0x00000012, 0x00000023,
-    0x00000048, 0x00050048, 0x00000048, 0x00000013, 0x00000023, 0x0000004c, 0x00050048, 0x00000048,
-    0x00000014, 0x00000023, 0x00000050, 0x00050048, 0x00000048, 0x00000015, 0x00000023, 0x00000054,
-    0x00050048, 0x00000048, 0x00000016, 0x00000023, 0x00000058, 0x00050048, 0x00000048, 0x00000017,
-    0x00000023, 0x0000005c, 0x00040047, 0x00000049, 0x00000006, 0x00000060, 0x00050048, 0x0000004a,
-    0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x0000004a, 0x00000002, 0x00040047, 0x0000004c,
-    0x00000022, 0x00000000, 0x00040047, 0x0000004c, 0x00000021, 0x00000002, 0x00040047, 0x00000117,
-    0x0000000b, 0x0000001a, 0x00040047, 0x00000122, 0x0000000b, 0x0000001d, 0x00050048, 0x00000134,
-    0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000134, 0x00000001, 0x00000023, 0x00000004,
-    0x00050048, 0x00000134, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x00000134, 0x00000003,
-    0x00000023, 0x0000000c, 0x00050048, 0x00000134, 0x00000004, 0x00000023, 0x00000010, 0x00050048,
-    0x00000134, 0x00000005, 0x00000023, 0x00000014, 0x00050048, 0x00000134, 0x00000006, 0x00000023,
-    0x00000018, 0x00050048, 0x00000134, 0x00000007, 0x00000023, 0x0000001c, 0x00030047, 0x00000134,
-    0x00000002, 0x00040047, 0x0000015a, 0x00000006, 0x00000010, 0x00050048, 0x0000015c, 0x00000000,
-    0x00000023, 0x00000000, 0x00050048, 0x0000015c, 0x00000001, 0x00000023, 0x00000004, 0x00050048,
-    0x0000015c, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x0000015c, 0x00000003, 0x00000023,
-    0x0000000c, 0x00050048, 0x0000015c, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x0000015c,
-    0x00000005, 0x00000023, 0x00000230, 0x00050048, 0x0000015c, 0x00000006, 0x00000023, 0x00000234,
-    0x00050048, 0x0000015c, 0x00000007, 0x00000023, 0x00000238, 0x00050048, 0x0000015c, 0x00000008,
-    0x00000023, 0x0000023c, 0x00050048, 0x0000015c, 0x00000009, 0x00000023, 0x00000240, 0x00050048,
-    0x0000015c, 0x0000000a, 0x00000023, 0x00000244, 0x00050048, 0x0000015c, 0x0000000b, 0x00000023,
-    0x00000248, 0x00030047, 0x0000015c, 0x00000002, 0x00040047, 0x0000015e, 0x00000022, 0x00000000,
-    0x00040047, 0x0000015e, 0x00000021, 0x00000000, 0x00050048, 0x00000166, 0x00000000, 0x00000023,
-    0x00000000, 0x00050048, 0x00000166, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x00000166,
-    0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x00000166, 0x00000003, 0x00000023, 0x0000000c,
-    0x00050048, 0x00000166, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x00000166, 0x00000005,
-    0x00000023, 0x00000014, 0x00050048, 0x00000166, 0x00000006, 0x00000023, 0x00000018, 0x00050048,
-    0x00000166, 0x00000007, 0x00000023, 0x0000001c, 0x00050048, 0x00000166, 0x00000008, 0x00000023,
-    0x00000020, 0x00050048, 0x00000166, 0x00000009, 0x00000023, 0x00000024, 0x00050048, 0x00000166,
-    0x0000000a, 0x00000023, 0x00000028, 0x00040047, 0x00000167, 0x00000006, 0x0000002c, 0x00040048,
-    0x00000168, 0x00000000, 0x00000018, 0x00050048, 0x00000168, 0x00000000, 0x00000023, 0x00000000,
-    0x00030047, 0x00000168, 0x00000002, 0x00040047, 0x0000016a, 0x00000022, 0x00000000, 0x00040047,
-    0x0000016a, 0x00000021, 0x00000001, 0x00040047, 0x000001e7, 0x00000001, 0x00000000, 0x00040047,
-    0x000001fa, 0x00000006, 0x00000010, 0x00040047, 0x000001fb, 0x00000006, 0x00000004, 0x00040047,
-    0x000001fc, 0x00000006, 0x00000004, 0x00040047, 0x000001fd, 0x00000006, 0x00000004, 0x00050048,
-    0x000001fe, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x000001fe, 0x00000001, 0x00000023,
-    0x00008000, 0x00050048, 0x000001fe, 0x00000002, 0x00000023, 0x0000a000, 0x00050048, 0x000001fe,
-    0x00000003, 0x00000023, 0x0000c000, 0x00050048, 0x000001fe, 0x00000004, 0x00000023, 0x0000c010,
-    0x00030047, 0x000001fe, 0x00000002, 0x00040047, 0x00000200, 0x00000022, 0x00000000, 0x00040047,
-    0x00000200, 0x00000021, 0x00000008, 0x00040047, 0x00000208, 0x00000001, 0x00000001, 0x00040047,
-    0x0000025d, 0x00000006, 0x00000008, 0x00050048, 0x0000025e, 0x00000000, 0x00000023, 0x00000000,
-    0x00030047, 0x0000025e, 0x00000002, 0x00040047, 0x00000260, 0x00000022, 0x00000000, 0x00040047,
-    0x00000260, 0x00000021, 0x00000009, 0x00040047, 0x00000270, 0x00000001, 0x00000002, 0x00040047,
-    0x00000279, 0x0000000b, 0x00000019, 0x00020013, 0x00000002, 0x00030021, 0x00000003, 0x00000002,
-    0x00040015, 0x00000006, 0x00000020, 0x00000001, 0x00040015, 0x00000007, 0x00000020, 0x00000000,
-    0x00030016, 0x00000008, 0x00000020, 0x000d001e, 0x00000009, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000007, 0x00000008, 0x00000007,
-    0x00040020, 0x0000000a, 0x00000007, 0x00000009, 0x00040017, 0x0000000b, 0x00000006, 0x00000002,
-    0x00040020, 0x0000000c, 0x00000007, 0x0000000b, 0x00020014, 0x0000000d, 0x00060021, 0x0000000e,
-    0x0000000d, 0x0000000a, 0x0000000c, 0x0000000c, 0x0004002b, 0x00000006, 0x00000014, 0x00000001,
-    0x00040020, 0x00000015, 0x00000007, 0x00000006, 0x0004002b, 0x00000007, 0x00000018, 0x00000001,
-    0x0004002b, 0x00000006, 0x0000001f, 0x00000002, 0x0003002a, 0x0000000d, 0x00000028, 0x0004002b,
-    0x00000006, 0x00000036, 0x00000000, 0x001a001e, 0x00000045, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000007, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00040020, 0x00000046, 0x00000007,
-    0x00000045, 0x001a001e, 0x00000048, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000007, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x0003001d, 0x00000049, 0x00000048, 0x0003001e, 0x0000004a,
-    0x00000049, 0x00040020, 0x0000004b, 0x0000000c, 0x0000004a, 0x0004003b, 0x0000004b, 0x0000004c,
-    0x0000000c, 0x00040020, 0x00000051, 0x0000000c, 0x00000048, 0x0004002b, 0x00000006, 0x0000005b,
-    0x00000003, 0x0004002b, 0x00000006, 0x0000005e, 0x00000004, 0x0004002b, 0x00000006, 0x00000061,
-    0x00000005, 0x0004002b, 0x00000006, 0x00000064, 0x00000006, 0x0004002b, 0x00000006, 0x00000067,
-    0x00000007, 0x00040020, 0x00000068, 0x00000007, 0x00000007, 0x0004002b, 0x00000006, 0x0000006b,
-    0x00000008, 0x0004002b, 0x00000006, 0x0000006e, 0x00000009, 0x0004002b, 0x00000006, 0x00000071,
-    0x0000000a, 0x0004002b, 0x00000006, 0x00000074, 0x0000000b, 0x0004002b, 0x00000006, 0x00000077,
-    0x0000000c, 0x0004002b, 0x00000006, 0x0000007a, 0x0000000d, 0x0004002b, 0x00000006, 0x0000007d,
-    0x0000000e, 0x0004002b, 0x00000006, 0x00000080, 0x0000000f, 0x0004002b, 0x00000006, 0x00000083,
-    0x00000010, 0x0004002b, 0x00000006, 0x00000086, 0x00000011, 0x0004002b, 0x00000006, 0x00000089,
-    0x00000012, 0x0004002b, 0x00000006, 0x0000008c, 0x00000013, 0x0004002b, 0x00000006, 0x0000008f,
-    0x00000014, 0x0004002b, 0x00000006, 0x00000092, 0x00000015, 0x0004002b, 0x00000006, 0x00000095,
-    0x00000016, 0x0004002b, 0x00000006, 0x00000098, 0x00000017, 0x0004002b, 0x00000007, 0x000000ea,
-    0x00000000, 0x00030029, 0x0000000d, 0x00000111, 0x00040017, 0x00000115, 0x00000007, 0x00000003,
-    0x00040020, 0x00000116, 0x00000001, 0x00000115, 0x0004003b, 0x00000116, 0x00000117, 0x00000001,
-    0x00040020, 0x00000118, 0x00000001, 0x00000007, 0x00040017, 0x0000011d, 0x00000007, 0x00000002,
-    0x0004003b, 0x00000118, 0x00000122, 0x00000001, 0x00040020, 0x00000129, 0x00000004, 0x00000007,
-    0x0004003b, 0x00000129, 0x0000012a, 0x00000004, 0x0004002b, 0x00000007, 0x0000012b, 0x00000002,
-    0x0004002b, 0x00000007, 0x0000012c, 0x00000108, 0x0004002b, 0x00000006, 0x0000012f, 0x00000020,
-    0x000a001e, 0x00000134, 0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00000007,
-    0x00000006, 0x00000007, 0x00040020, 0x00000135, 0x00000009, 0x00000134, 0x0004003b, 0x00000135,
-    0x00000136, 0x00000009, 0x00040020, 0x00000137, 0x00000009, 0x00000007, 0x0004002b, 0x00000006,
-    0x0000013f, 0x00000040, 0x0005002c, 0x0000000b, 0x00000140, 0x0000013f, 0x0000012f, 0x0004002b,
-    0x00000006, 0x00000144, 0x0000003f, 0x0004002b, 0x00000006, 0x00000145, 0x0000001f, 0x0005002c,
-    0x0000000b, 0x00000146, 0x00000144, 0x00000145, 0x00040020, 0x00000148, 0x00000007, 0x0000000d,
-    0x00040017, 0x00000158, 0x00000007, 0x00000004, 0x0004002b, 0x00000007, 0x00000159, 0x00000022,
-    0x0004001c, 0x0000015a, 0x00000158, 0x00000159, 0x00040017, 0x0000015b, 0x00000008, 0x00000002,
-    0x000e001e, 0x0000015c, 0x00000007, 0x00000007, 0x00000006, 0x00000007, 0x0000015a, 0x00000007,
-    0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x0000015b, 0x00040020, 0x0000015d,
-    0x00000002, 0x0000015c, 0x0004003b, 0x0000015d, 0x0000015e, 0x00000002, 0x00040020, 0x0000015f,
-    0x00000002, 0x00000007, 0x000d001e, 0x00000166, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000007, 0x00000008, 0x00000007, 0x0003001d,
-    0x00000167, 0x00000166, 0x0003001e, 0x00000168, 0x00000167, 0x00040020, 0x00000169, 0x0000000c,
-    0x00000168, 0x0004003b, 0x00000169, 0x0000016a, 0x0000000c, 0x00040020, 0x0000016d, 0x0000000c,
-    0x00000166, 0x00040020, 0x00000183, 0x00000007, 0x00000008, 0x0005002c, 0x0000000b, 0x0000019d,
-    0x0000006b, 0x0000006b, 0x0005002c, 0x0000000b, 0x000001a2, 0x00000067, 0x00000067, 0x00040032,
-    0x00000006, 0x000001e7, 0x00000100, 0x00060034, 0x00000006, 0x000001e8, 0x00000087, 0x000001e7,
-    0x0000006b, 0x0004002b, 0x00000007, 0x000001f9, 0x00000800, 0x0004001c, 0x000001fa, 0x00000158,
-    0x000001f9, 0x0004001c, 0x000001fb, 0x00000007, 0x000001f9, 0x0004001c, 0x000001fc, 0x00000007,
-    0x000001f9, 0x0003001d, 0x000001fd, 0x00000007, 0x0007001e, 0x000001fe, 0x000001fa, 0x000001fb,
-    0x000001fc, 0x00000158, 0x000001fd, 0x00040020, 0x000001ff, 0x0000000c, 0x000001fe, 0x0004003b,
-    0x000001ff, 0x00000200, 0x0000000c, 0x0004002b, 0x00000007, 0x00000201, 0x00000003, 0x00040020,
-    0x00000202, 0x0000000c, 0x00000007, 0x00040032, 0x00000006, 0x00000208, 0x000000c0, 0x00060034,
-    0x00000006, 0x00000209, 0x00000087, 0x00000208, 0x0000006b, 0x00060034, 0x00000006, 0x0000020a,
-    0x00000084, 0x000001e8, 0x00000209, 0x00060034, 0x00000006, 0x0000020b, 0x00000084, 0x0000020a,
-    0x0000001f, 0x00060034, 0x00000006, 0x0000020c, 0x00000080, 0x00000036, 0x0000020b, 0x00060034,
-    0x00000006, 0x00000229, 0x00000084, 0x000001e8, 0x00000209, 0x00060034, 0x00000006, 0x0000022a,
-    0x00000084, 0x00000229, 0x0000013f, 0x00060034, 0x00000006, 0x0000022b, 0x00000080, 0x0000020c,
-    0x0000022a, 0x00040020, 0x00000255, 0x0000000c, 0x00000006, 0x0003001d, 0x0000025d, 0x0000011d,
-    0x0003001e, 0x0000025e, 0x0000025d, 0x00040020, 0x0000025f, 0x0000000c, 0x0000025e, 0x0004003b,
-    0x0000025f, 0x00000260, 0x0000000c, 0x00040020, 0x0000026c, 0x0000000c, 0x0000011d, 0x00040032,
-    0x00000006, 0x00000270, 0x00003000, 0x00060034, 0x00000006, 0x00000271, 0x00000084, 0x000001e7,
-    0x00000208, 0x0004002b, 0x00000006, 0x00000272, 0x00000800, 0x0004002b, 0x00000007, 0x00000273,
-    0x00008000, 0x0004002b, 0x00000007, 0x00000274, 0x00000004, 0x0004002b, 0x00000007, 0x00000275,
-    0x00000008, 0x00060034, 0x00000007, 0x00000276, 0x00000080, 0x00000270, 0x000000ea, 0x00060034,
-    0x00000007, 0x00000277, 0x00000080, 0x000000ea, 0x00000276, 0x0004002b, 0x00000007, 0x00000278,
-    0x00000020, 0x0006002c, 0x00000115, 0x00000279, 0x00000278, 0x00000018, 0x00000018, 0x00050036,
-    0x00000002, 0x00000004, 0x00000000, 0x00000003, 0x000200f8, 0x00000005, 0x0004003b, 0x00000015,
-    0x00000114, 0x00000007, 0x0004003b, 0x0000000c, 0x0000011c, 0x00000007, 0x0004003b, 0x00000015,
-    0x00000121, 0x00000007, 0x0004003b, 0x00000015, 0x0000012d, 0x00000007, 0x0004003b, 0x00000015,
-    0x00000133, 0x00000007, 0x0004003b, 0x0000000c, 0x0000013d, 0x00000007, 0x0004003b, 0x0000000c,
-    0x00000142, 0x00000007, 0x0004003b, 0x00000148, 0x00000149, 0x00000007, 0x0004003b, 0x0000000a,
-    0x0000016c, 0x00000007, 0x0004003b, 0x0000000c, 0x00000187, 0x00000007, 0x0004003b, 0x0000000c,
-    0x00000189, 0x00000007, 0x0004003b, 0x00000068, 0x00000192, 0x00000007, 0x0004003b, 0x0000000c,
-    0x00000194, 0x00000007, 0x0004003b, 0x0000000c, 0x0000019a, 0x00000007, 0x0004003b, 0x0000000c,
-    0x000001a0, 0x00000007, 0x0004003b, 0x00000068, 0x000001a4, 0x00000007, 0x0004003b, 0x00000015,
-    0x000001ac, 0x00000007, 0x0004003b, 0x00000015, 0x000001b4, 0x00000007, 0x0004003b, 0x0000000a,
-    0x000001be, 0x00000007, 0x0004003b, 0x0000000c, 0x000001d7, 0x00000007, 0x0004003b, 0x0000000c,
-    0x000001d9, 0x00000007, 0x0004003b, 0x00000015, 0x000001e2, 0x00000007, 0x0004003b, 0x00000068,
-    0x000001f4, 0x00000007, 0x0004003b, 0x00000015, 0x00000214, 0x00000007, 0x0004003b, 0x00000068,
-    0x00000233, 0x00000007, 0x0004003b, 0x00000015, 0x0000023a, 0x00000007, 0x0004003b, 0x00000015,
-    0x00000242, 0x00000007, 0x0004003b, 0x00000015, 0x0000024a, 0x00000007, 0x0004003b, 0x00000015,
-    0x00000253, 0x00000007, 0x0004003b, 0x00000015, 0x00000258, 0x00000007, 0x00050041, 0x00000118,
-    0x00000119, 0x00000117, 0x000000ea, 0x0004003d, 0x00000007, 0x0000011a, 0x00000119, 0x0004007c,
-    0x00000006, 0x0000011b, 0x0000011a, 0x0003003e, 0x00000114, 0x0000011b, 0x0004003d, 0x00000115,
-    0x0000011e, 0x00000117, 0x0007004f, 0x0000011d, 0x0000011f, 0x0000011e, 0x0000011e, 0x00000001,
-    0x00000002, 0x0004007c, 0x0000000b, 0x00000120, 0x0000011f, 0x0003003e, 0x0000011c, 0x00000120,
-    0x0004003d, 0x00000007, 0x00000123, 0x00000122, 0x0004007c, 0x00000006, 0x00000124, 0x00000123,
-    0x0003003e, 0x00000121, 0x00000124, 0x0004003d, 0x00000006, 0x00000125, 0x00000121, 0x000500aa,
-    0x0000000d, 0x00000126, 0x00000125, 0x00000036, 0x000300f7, 0x00000128, 0x00000000, 0x000400fa,
-    0x00000126, 0x00000127, 0x00000128, 0x000200f8, 0x00000127, 0x0003003e, 0x0000012a, 0x000000ea,
-    0x000200f9, 0x00000128, 0x000200f8, 0x00000128, 0x000400e0, 0x0000012b, 0x0000012b, 0x0000012c,
-    0x0004003d, 0x00000006, 0x0000012e, 0x00000114, 0x00050084, 0x00000006, 0x00000130, 0x0000012e,
-    0x0000012f, 0x0004003d, 0x00000006, 0x00000131, 0x00000121, 0x00050080, 0x00000006, 0x00000132,
-    0x00000130, 0x00000131, 0x0003003e, 0x0000012d, 0x00000132, 0x00050041, 0x00000137, 0x00000138,
-    0x00000136, 0x00000036, 0x0004003d, 0x00000007, 0x00000139, 0x00000138, 0x0004007c, 0x00000006,
-    0x0000013a, 0x00000139, 0x0004003d, 0x00000006, 0x0000013b, 0x0000012d, 0x00050080, 0x00000006,
-    0x0000013c, 0x0000013a, 0x0000013b, 0x0003003e, 0x00000133, 0x0000013c, 0x0004003d, 0x0000000b,
-    0x0000013e, 0x0000011c, 0x00050084, 0x0000000b, 0x00000141, 0x0000013e, 0x00000140, 0x0003003e,
-    0x0000013d, 0x00000141, 0x0004003d, 0x0000000b, 0x00000143, 0x0000013d, 0x00050080, 0x0000000b,
-    0x00000147, 0x00000143, 0x00000146, 0x0003003e, 0x00000142, 0x00000147, 0x0003003e, 0x00000149,
-    0x00000028, 0x0004003d, 0x00000006, 0x0000014a, 0x00000121, 0x000500b1, 0x0000000d, 0x0000014b,
-    0x0000014a, 0x0000012f, 0x000300f7, 0x0000014d, 0x00000000, 0x000400fa, 0x0000014b, 0x0000014c,
-    0x0000014d, 0x000200f8, 0x0000014c, 0x0004003d, 0x00000006, 0x0000014e, 0x0000012d, 0x00050041,
-    0x00000137, 0x0000014f, 0x00000136, 0x00000014, 0x0004003d, 0x00000007, 0x00000150, 0x0000014f,
-    0x0004007c, 0x00000006, 0x00000151, 0x00000150, 0x000500b1, 0x0000000d, 0x00000152, 0x0000014e,
-    0x00000151, 0x000200f9, 0x0000014d, 0x000200f8, 0x0000014d, 0x000700f5, 0x0000000d, 0x00000153,
-    0x0000014b, 0x00000128, 0x00000152, 0x0000014c, 0x000300f7, 0x00000155, 0x00000000, 0x000400fa,
-    0x00000153, 0x00000154, 0x00000155, 0x000200f8, 0x00000154, 0x0004003d, 0x00000006, 0x00000156,
-    0x00000133, 0x0004007c, 0x00000007, 0x00000157, 0x00000156, 0x00050041, 0x0000015f, 0x00000160,
-    0x0000015e, 0x00000036, 0x0004003d, 0x00000007, 0x00000161, 0x00000160, 0x000500b0, 0x0000000d,
-    0x00000162, 0x00000157, 0x00000161, 0x000200f9, 0x00000155, 0x000200f8, 0x00000155, 0x000700f5,
-    0x0000000d, 0x00000163, 0x00000153, 0x0000014d, 0x00000162, 0x00000154, 0x000300f7, 0x00000165,
-    0x00000000, 0x000400fa, 0x00000163, 0x00000164, 0x00000165, 0x000200f8, 0x00000164, 0x0004003d,
-    0x00000006, 0x0000016b, 0x00000133, 0x00060041, 0x0000016d, 0x0000016e, 0x0000016a, 0x00000036,
-    0x0000016b, 0x0004003d, 0x00000166, 0x0000016f, 0x0000016e, 0x00050051, 0x00000006, 0x00000170,
-    0x0000016f, 0x00000000, 0x00050041, 0x00000015, 0x00000171, 0x0000016c, 0x00000036, 0x0003003e,
-    0x00000171, 0x00000170, 0x00050051, 0x00000006, 0x00000172, 0x0000016f, 0x00000001, 0x00050041,
-    0x00000015, 0x00000173, 0x0000016c, 0x00000014, 0x0003003e, 0x00000173, 0x00000172, 0x00050051,
-    0x00000006, 0x00000174, 0x0000016f, 0x00000002, 0x00050041, 0x00000015, 0x00000175, 0x0000016c,
-    0x0000001f, 0x0003003e, 0x00000175, 0x00000174, 0x00050051, 0x00000006, 0x00000176, 0x0000016f,
-    0x00000003, 0x00050041, 0x00000015, 0x00000177, 0x0000016c, 0x0000005b, 0x0003003e, 0x00000177,
-    0x00000176, 0x00050051, 0x00000006, 0x00000178, 0x0000016f, 0x00000004, 0x00050041, 0x00000015,
-    0x00000179, 0x0000016c, 0x0000005e, 0x0003003e, 0x00000179, 0x00000178, 0x00050051, 0x00000006,
-    0x0000017a, 0x0000016f, 0x00000005, 0x00050041, 0x00000015, 0x0000017b, 0x0000016c, 0x00000061,
-    0x0003003e, 0x0000017b, 0x0000017a, 0x00050051, 0x00000006, 0x0000017c, 0x0000016f, 0x00000006,
-    0x00050041, 0x00000015, 0x0000017d, 0x0000016c, 0x00000064, 0x0003003e, 0x0000017d, 0x0000017c,
-    0x00050051, 0x00000006, 0x0000017e, 0x0000016f, 0x00000007, 0x00050041, 0x00000015, 0x0000017f,
-    0x0000016c, 0x00000067, 0x0003003e, 0x0000017f, 0x0000017e, 0x00050051, 0x00000007, 0x00000180,
-    0x0000016f, 0x00000008, 0x00050041, 0x00000068, 0x00000181, 0x0000016c, 0x0000006b, 0x0003003e,
-    0x00000181, 0x00000180, 0x00050051, 0x00000008, 0x00000182, 0x0000016f, 0x00000009, 0x00050041,
-    0x00000183, 0x00000184, 0x0000016c, 0x0000006e, 0x0003003e, 0x00000184, 0x00000182, 0x00050051,
-    0x00000007, 0x00000185, 0x0000016f, 0x0000000a, 0x00050041, 0x00000068, 0x00000186, 0x0000016c,
-    0x00000071, 0x0003003e, 0x00000186, 0x00000185, 0x0004003d, 0x0000000b, 0x00000188, 0x0000013d,
-    0x0003003e, 0x00000187, 0x00000188, 0x0004003d, 0x0000000b, 0x0000018a, 0x00000142, 0x0003003e,
-    0x00000189, 0x0000018a, 0x00070039, 0x0000000d, 0x0000018b, 0x00000012, 0x0000016c, 0x00000187,
-    0x00000189, 0x0003003e, 0x00000149, 0x0000018b, 0x000200f9, 0x00000165, 0x000200f8, 0x00000165,
-    0x0004003d, 0x0000000d, 0x0000018c, 0x00000149, 0x000300f7, 0x0000018e, 0x00000000, 0x000400fa,
-    0x0000018c, 0x0000018d, 0x0000018e, 0x000200f8, 0x0000018d, 0x0004003d, 0x00000006, 0x0000018f,
-    0x00000121, 0x000500c4, 0x00000007, 0x00000190, 0x00000018, 0x0000018f, 0x000700f1, 0x00000007,
-    0x00000191, 0x0000012a, 0x00000018, 0x000000ea, 0x00000190, 0x000200f9, 0x0000018e, 0x000200f8,
-    0x0000018e, 0x000400e0, 0x0000012b, 0x0000012b, 0x0000012c, 0x0004003d, 0x00000007, 0x00000193,
-    0x0000012a, 0x0003003e, 0x00000192, 0x00000193, 0x0004003d, 0x00000006, 0x00000195, 0x00000121,
-    0x000500c7, 0x00000006, 0x00000196, 0x00000195, 0x00000067, 0x0004003d, 0x00000006, 0x00000197,
-    0x00000121, 0x000500c3, 0x00000006, 0x00000198, 0x00000197, 0x0000005b, 0x00050050, 0x0000000b,
-    0x00000199, 0x00000196, 0x00000198, 0x0003003e, 0x00000194, 0x00000199, 0x0004003d, 0x0000000b,
-    0x0000019b, 0x0000013d, 0x0004003d, 0x0000000b, 0x0000019c, 0x00000194, 0x00050084, 0x0000000b,
-    0x0000019e, 0x0000019c, 0x0000019d, 0x00050080, 0x0000000b, 0x0000019f, 0x0000019b, 0x0000019e,
-    0x0003003e, 0x0000019a, 0x0000019f, 0x0004003d, 0x0000000b, 0x000001a1, 0x0000019a, 0x00050080,
-    0x0000000b, 0x000001a3, 0x000001a1, 0x000001a2, 0x0003003e, 0x000001a0, 0x000001a3, 0x0003003e,
-    0x000001a4, 0x000000ea, 0x000200f9, 0x000001a5, 0x000200f8, 0x000001a5, 0x000400f6, 0x000001a7,
-    0x000001a8, 0x00000000, 0x000200f9, 0x000001a9, 0x000200f8, 0x000001a9, 0x0004003d, 0x00000007,
-    0x000001aa, 0x00000192, 0x000500ab, 0x0000000d, 0x000001ab, 0x000001aa, 0x000000ea, 0x000400fa,
-    0x000001ab, 0x000001a6, 0x000001a7, 0x000200f8, 0x000001a6, 0x0004003d, 0x00000007, 0x000001ad,
-    0x00000192, 0x0006000c, 0x00000006, 0x000001ae, 0x00000001, 0x00000049, 0x000001ad, 0x0003003e,
-    0x000001ac, 0x000001ae, 0x0004003d, 0x00000006, 0x000001af, 0x000001ac, 0x000500c4, 0x00000007,
-    0x000001b0, 0x00000018, 0x000001af, 0x000400c8, 0x00000007, 0x000001b1, 0x000001b0, 0x0004003d,
-    0x00000007, 0x000001b2, 0x00000192, 0x000500c7, 0x00000007, 0x000001b3, 0x000001b2, 0x000001b1,
-    0x0003003e, 0x00000192, 0x000001b3, 0x00050041, 0x00000137, 0x000001b5, 0x00000136, 0x00000036,
-    0x0004003d, 0x00000007, 0x000001b6, 0x000001b5, 0x0004007c, 0x00000006, 0x000001b7, 0x000001b6,
-    0x0004003d, 0x00000006, 0x000001b8, 0x00000114, 0x00050084, 0x00000006, 0x000001b9, 0x000001b8,
-    0x0000012f, 0x00050080, 0x00000006, 0x000001ba, 0x000001b7, 0x000001b9, 0x0004003d, 0x00000006,
-    0x000001bb, 0x000001ac, 0x00050080, 0x00000006, 0x000001bc, 0x000001ba, 0x000001bb, 0x0003003e,
-    0x000001b4, 0x000001bc, 0x0004003d, 0x00000006, 0x000001bd, 0x000001b4, 0x00060041, 0x0000016d,
-    0x000001bf, 0x0000016a, 0x00000036, 0x000001bd, 0x0004003d, 0x00000166, 0x000001c0, 0x000001bf,
-    0x00050051, 0x00000006, 0x000001c1, 0x000001c0, 0x00000000, 0x00050041, 0x00000015, 0x000001c2,
-    0x000001be, 0x00000036, 0x0003003e, 0x000001c2, 0x000001c1, 0x00050051, 0x00000006, 0x000001c3,
-    0x000001c0, 0x00000001, 0x00050041, 0x00000015, 0x000001c4, 0x000001be, 0x00000014, 0x0003003e,
-    0x000001c4, 0x000001c3, 0x00050051, 0x00000006, 0x000001c5, 0x000001c0, 0x00000002, 0x00050041,
-    0x00000015, 0x000001c6, 0x000001be, 0x0000001f, 0x0003003e, 0x000001c6, 0x000001c5, 0x00050051,
-    0x00000006, 0x000001c7, 0x000001c0, 0x00000003, 0x00050041, 0x00000015, 0x000001c8, 0x000001be,
-    0x0000005b, 0x0003003e, 0x000001c8, 0x000001c7, 0x00050051, 0x00000006, 0x000001c9, 0x000001c0,
-    0x00000004, 0x00050041, 0x00000015, 0x000001ca, 0x000001be, 0x0000005e, 0x0003003e, 0x000001ca,
-    0x000001c9, 0x00050051, 0x00000006, 0x000001cb, 0x000001c0, 0x00000005, 0x00050041, 0x00000015,
-    0x000001cc, 0x000001be, 0x00000061, 0x0003003e, 0x000001cc, 0x000001cb, 0x00050051, 0x00000006,
-    0x000001cd, 0x000001c0, 0x00000006, 0x00050041, 0x00000015, 0x000001ce, 0x000001be, 0x00000064,
-    0x0003003e, 0x000001ce, 0x000001cd, 0x00050051, 0x00000006, 0x000001cf, 0x000001c0, 0x00000007,
-    0x00050041, 0x00000015, 0x000001d0, 0x000001be, 0x00000067, 0x0003003e, 0x000001d0, 0x000001cf,
-    0x00050051, 0x00000007, 0x000001d1, 0x000001c0, 0x00000008, 0x00050041, 0x00000068, 0x000001d2,
-    0x000001be, 0x0000006b, 0x0003003e, 0x000001d2, 0x000001d1, 0x00050051, 0x00000008, 0x000001d3,
-    0x000001c0, 0x00000009, 0x00050041, 0x00000183, 0x000001d4, 0x000001be, 0x0000006e, 0x0003003e,
-    0x000001d4, 0x000001d3, 0x00050051, 0x00000007, 0x000001d5, 0x000001c0, 0x0000000a, 0x00050041,
-    0x00000068, 0x000001d6, 0x000001be, 0x00000071, 0x0003003e, 0x000001d6, 0x000001d5, 0x0004003d,
-    0x0000000b, 0x000001d8, 0x0000019a, 0x0003003e, 0x000001d7, 0x000001d8, 0x0004003d, 0x0000000b,
-    0x000001da, 0x000001a0, 0x0003003e, 0x000001d9, 0x000001da, 0x00070039, 0x0000000d, 0x000001db,
-    0x00000012, 0x000001be, 0x000001d7, 0x000001d9, 0x000300f7, 0x000001dd, 0x00000000, 0x000400fa,
-    0x000001db, 0x000001dc, 0x000001dd, 0x000200f8, 0x000001dc, 0x0004003d, 0x00000006, 0x000001de,
-    0x000001ac, 0x000500c4, 0x00000007, 0x000001df, 0x00000018, 0x000001de, 0x0004003d, 0x00000007,
-    0x000001e0, 0x000001a4, 0x000500c5, 0x00000007, 0x000001e1, 0x000001e0, 0x000001df, 0x0003003e,
-    0x000001a4, 0x000001e1, 0x000200f9, 0x000001dd, 0x000200f8, 0x000001dd, 0x000200f9, 0x000001a8,
-    0x000200f8, 0x000001a8, 0x000200f9, 0x000001a5, 0x000200f8, 0x000001a7, 0x00050041, 0x00000015,
-    0x000001e3, 0x00000194, 0x000000ea, 0x0004003d, 0x00000006, 0x000001e4, 0x000001e3, 0x00050041,
-    0x00000015, 0x000001e5, 0x00000194, 0x00000018, 0x0004003d, 0x00000006, 0x000001e6, 0x000001e5,
-    0x00050084, 0x00000006, 0x000001e9, 0x000001e6, 0x000001e8, 0x00050080, 0x00000006, 0x000001ea,
-    0x000001e4, 0x000001e9, 0x00050041, 0x00000015, 0x000001eb, 0x0000011c, 0x000000ea, 0x0004003d,
-    0x00000006, 0x000001ec, 0x000001eb, 0x00050084, 0x00000006, 0x000001ed, 0x000001ec, 0x0000006b,
-    0x00050080, 0x00000006, 0x000001ee, 0x000001ea, 0x000001ed, 0x00050041, 0x00000015, 0x000001ef,
-    0x0000011c, 0x00000018, 0x0004003d, 0x00000006, 0x000001f0, 0x000001ef, 0x00050084, 0x00000006,
-    0x000001f1, 0x000001f0, 0x000001e8, 0x00050084, 0x00000006, 0x000001f2, 0x000001f1, 0x0000005e,
-    0x00050080, 0x00000006, 0x000001f3, 0x000001ee, 0x000001f2, 0x0003003e, 0x000001e2, 0x000001f3,
-    0x0003003e, 0x000001f4, 0x000000ea, 0x0004003d, 0x00000007, 0x000001f5, 0x000001a4, 0x000500ab,
-    0x0000000d, 0x000001f6, 0x000001f5, 0x000000ea, 0x000300f7, 0x000001f8, 0x00000000, 0x000400fa,
-    0x000001f6, 0x000001f7, 0x000001f8, 0x000200f8, 0x000001f7, 0x00070041, 0x00000202, 0x00000203,
-    0x00000200, 0x00000036, 0x00000036, 0x00000201, 0x0004003d, 0x00000007, 0x00000204, 0x000001a4,
-    0x000400cd, 0x00000006, 0x00000205, 0x00000204, 0x0004007c, 0x00000007, 0x00000206, 0x00000205,
-    0x000700ea, 0x00000007, 0x00000207, 0x00000203, 0x00000018, 0x000000ea, 0x00000206, 0x0003003e,
-    0x000001f4, 0x00000207, 0x000200f9, 0x000001f8, 0x000200f8, 0x000001f8, 0x0004003d, 0x00000006,
-    0x0000020d, 0x000001e2, 0x00050084, 0x00000006, 0x0000020e, 0x0000020d, 0x0000013f, 0x00050080,
-    0x00000006, 0x0000020f, 0x0000020c, 0x0000020e, 0x0004003d, 0x00000006, 0x00000210, 0x00000114,
-    0x00050080, 0x00000006, 0x00000211, 0x0000020f, 0x00000210, 0x0004003d, 0x00000007, 0x00000212,
-    0x000001a4, 0x00060041, 0x00000202, 0x00000213, 0x00000200, 0x0000005e, 0x00000211, 0x0003003e,
-    0x00000213, 0x00000212, 0x0004003d, 0x00000006, 0x00000215, 0x000001e2, 0x00050084, 0x00000006,
-    0x00000216, 0x00000215, 0x0000001f, 0x0004003d, 0x00000006, 0x00000217, 0x00000114, 0x000500c3,
-    0x00000006, 0x00000218, 0x00000217, 0x00000061, 0x00050080, 0x00000006, 0x00000219, 0x00000216,
-    0x00000218, 0x0003003e, 0x00000214, 0x00000219, 0x0004003d, 0x00000007, 0x0000021a, 0x000001a4,
-    0x000500ab, 0x0000000d, 0x0000021b, 0x0000021a, 0x000000ea, 0x000300f7, 0x0000021d, 0x00000000,
-    0x000400fa, 0x0000021b, 0x0000021c, 0x0000021d, 0x000200f8, 0x0000021c, 0x0004003d, 0x00000006,
-    0x0000021e, 0x00000214, 0x00050080, 0x00000006, 0x0000021f, 0x00000036, 0x0000021e, 0x00060041,
-    0x00000202, 0x00000220, 0x00000200, 0x0000005e, 0x0000021f, 0x0004003d, 0x00000006, 0x00000221,
-    0x00000114, 0x000500c7, 0x00000006, 0x00000222, 0x00000221, 0x00000145, 0x000500c4, 0x00000007,
-    0x00000223, 0x00000018, 0x00000222, 0x000700f1, 0x00000007, 0x00000224, 0x00000220, 0x00000018,
-    0x000000ea, 0x00000223, 0x000200f9, 0x0000021d, 0x000200f8, 0x0000021d, 0x0004003d, 0x00000007,
-    0x00000225, 0x000001a4, 0x000500ab, 0x0000000d, 0x00000226, 0x00000225, 0x000000ea, 0x000300f7,
-    0x00000228, 0x00000000, 0x000400fa, 0x00000226, 0x00000227, 0x00000228, 0x000200f8, 0x00000227,
-    0x0004003d, 0x00000006, 0x0000022c, 0x000001e2, 0x00050084, 0x00000006, 0x0000022d, 0x0000022c,
-    0x0000013f, 0x00050080, 0x00000006, 0x0000022e, 0x0000022b, 0x0000022d, 0x0004003d, 0x00000006,
-    0x0000022f, 0x00000114, 0x00050080, 0x00000006, 0x00000230, 0x0000022e, 0x0000022f, 0x0004003d,
-    0x00000007, 0x00000231, 0x000001f4, 0x00060041, 0x00000202, 0x00000232, 0x00000200, 0x0000005e,
-    0x00000230, 0x0003003e, 0x00000232, 0x00000231, 0x00050041, 0x00000015, 0x00000234, 0x0000019a,
-    0x000000ea, 0x0004003d, 0x00000006, 0x00000235, 0x00000234, 0x00050041, 0x00000015, 0x00000236,
-    0x0000019a, 0x00000018, 0x0004003d, 0x00000006, 0x00000237, 0x00000236, 0x000700c9, 0x00000006,
-    0x00000238, 0x00000235, 0x00000237, 0x00000083, 0x00000083, 0x0004007c, 0x00000007, 0x00000239,
-    0x00000238, 0x0003003e, 0x00000233, 0x00000239, 0x0003003e, 0x0000023a, 0x00000036, 0x000200f9,
-    0x0000023b, 0x000200f8, 0x0000023b, 0x000400f6, 0x0000023d, 0x0000023e, 0x00000000, 0x000200f9,
-    0x0000023f, 0x000200f8, 0x0000023f, 0x0004003d, 0x00000007, 0x00000240, 0x000001a4, 0x000500ab,
-    0x0000000d, 0x00000241, 0x00000240, 0x000000ea, 0x000400fa, 0x00000241, 0x0000023c, 0x0000023d,
-    0x000200f8, 0x0000023c, 0x0004003d, 0x00000007, 0x00000243, 0x000001a4, 0x0006000c, 0x00000006,
-    0x00000244, 0x00000001, 0x00000049, 0x00000243, 0x0003003e, 0x00000242, 0x00000244, 0x0004003d,
-    0x00000006, 0x00000245, 0x00000242, 0x000500c4, 0x00000007, 0x00000246, 0x00000018, 0x00000245,
-    0x000400c8, 0x00000007, 0x00000247, 0x00000246, 0x0004003d, 0x00000007, 0x00000248, 0x000001a4,
-    0x000500c7, 0x00000007, 0x00000249, 0x00000248, 0x00000247, 0x0003003e, 0x000001a4, 0x00000249,
-    0x00050041, 0x00000137, 0x0000024b, 0x00000136, 0x00000036, 0x0004003d, 0x00000007, 0x0000024c,
-    0x0000024b, 0x0004007c, 0x00000006, 0x0000024d, 0x0000024c, 0x0004003d, 0x00000006, 0x0000024e,
-    0x00000114, 0x00050084, 0x00000006, 0x0000024f, 0x0000024e, 0x0000012f, 0x00050080, 0x00000006,
-    0x00000250, 0x0000024d, 0x0000024f, 0x0004003d, 0x00000006, 0x00000251, 0x00000242, 0x00050080,
-    0x00000006, 0x00000252, 0x00000250, 0x00000251, 0x0003003e, 0x0000024a, 0x00000252, 0x0004003d,
-    0x00000006, 0x00000254, 0x0000024a, 0x00070041, 0x00000255, 0x00000256, 0x0000016a, 0x00000036,
-    0x00000254, 0x00000067, 0x0004003d, 0x00000006, 0x00000257, 0x00000256, 0x0003003e, 0x00000253,
-    0x00000257, 0x0004003d, 0x00000006, 0x00000259, 0x00000253, 0x00070041, 0x00000202, 0x0000025a,
-    0x00000200, 0x00000036, 0x00000259, 0x0000012b, 0x000700ea, 0x00000007, 0x0000025b, 0x0000025a,
-    0x00000018, 0x000000ea, 0x00000018, 0x0004007c, 0x00000006, 0x0000025c, 0x0000025b, 0x0003003e,
-    0x00000258, 0x0000025c, 0x0004003d, 0x00000007, 0x00000261, 0x000001f4, 0x00050080, 0x00000007,
-    0x00000262, 0x000000ea, 0x00000261, 0x0004003d, 0x00000006, 0x00000263, 0x0000023a, 0x0004007c,
-    0x00000007, 0x00000264, 0x00000263, 0x00050080, 0x00000007, 0x00000265, 0x00000262, 0x00000264,
-    0x0004003d, 0x00000007, 0x00000266, 0x00000233, 0x0004003d, 0x00000006, 0x00000267, 0x0000024a,
-    0x0004003d, 0x00000006, 0x00000268, 0x00000258, 0x000700c9, 0x00000006, 0x00000269, 0x00000267,
-    0x00000268, 0x00000074, 0x00000092, 0x0004007c, 0x00000007, 0x0000026a, 0x00000269, 0x00050050,
-    0x0000011d, 0x0000026b, 0x00000266, 0x0000026a, 0x00060041, 0x0000026c, 0x0000026d, 0x00000260,
-    0x00000036, 0x00000265, 0x0003003e, 0x0000026d, 0x0000026b, 0x0004003d, 0x00000006, 0x0000026e,
-    0x0000023a, 0x00050080, 0x00000006, 0x0000026f, 0x0000026e, 0x00000014, 0x0003003e, 0x0000023a,
-    0x0000026f, 0x000200f9, 0x0000023e, 0x000200f8, 0x0000023e, 0x000200f9, 0x0000023b, 0x000200f8,
-    0x0000023d, 0x000200f9, 0x00000228, 0x000200f8, 0x00000228, 0x000100fd, 0x00010038, 0x00050036,
-    0x0000000d, 0x00000012, 0x00000000, 0x0000000e, 0x00030037, 0x0000000a, 0x0000000f, 0x00030037,
-    0x0000000c, 0x00000010, 0x00030037, 0x0000000c, 0x00000011, 0x000200f8, 0x00000013, 0x0004003b,
-    0x00000015, 0x0000002a, 0x00000007, 0x0004003b, 0x00000015, 0x00000030, 0x00000007, 0x0004003b,
-    0x00000015, 0x0000003b, 0x00000007, 0x0004003b, 0x00000046, 0x00000047, 0x00000007, 0x0004003b,
-    0x00000046, 0x0000009a, 0x00000007, 0x0004003b, 0x00000015, 0x000000e0, 0x00000007, 0x0004003b,
-    0x00000015, 0x00000100, 0x00000007, 0x00050041, 0x00000015, 0x00000016, 0x0000000f, 0x00000014,
-    0x0004003d, 0x00000006, 0x00000017, 0x00000016, 0x00050041, 0x00000015, 0x00000019, 0x00000011,
-    0x00000018, 0x0004003d, 0x00000006, 0x0000001a, 0x00000019, 0x000500ad, 0x0000000d, 0x0000001b,
-    0x00000017, 0x0000001a, 0x000400a8, 0x0000000d, 0x0000001c, 0x0000001b, 0x000300f7, 0x0000001e,
-    0x00000000, 0x000400fa, 0x0000001c, 0x0000001d, 0x0000001e, 0x000200f8, 0x0000001d, 0x00050041,
-    0x00000015, 0x00000020, 0x0000000f, 0x0000001f, 0x0004003d, 0x00000006, 0x00000021, 0x00000020,
-    0x00050041, 0x00000015, 0x00000022, 0x00000010, 0x00000018, 0x0004003d, 0x00000006, 0x00000023,
-    0x00000022, 0x000500b3, 0x0000000d, 0x00000024, 0x00000021, 0x00000023, 0x000200f9, 0x0000001e,
-    0x000200f8, 0x0000001e, 0x000700f5, 0x0000000d, 0x00000025, 0x0000001b, 0x00000013, 0x00000024,
-    0x0000001d, 0x000300f7, 0x00000027, 0x00000000, 0x000400fa, 0x00000025, 0x00000026, 0x00000027,
-    0x000200f8, 0x00000026, 0x000200fe, 0x00000028, 0x000200f8, 0x00000027, 0x00050041, 0x00000015,
-    0x0000002b, 0x0000000f, 0x0000001f, 0x0004003d, 0x00000006, 0x0000002c, 0x0000002b, 0x00050041,
-    0x00000015, 0x0000002d, 0x0000000f, 0x00000014, 0x0004003d, 0x00000006, 0x0000002e, 0x0000002d,
-    0x00050082, 0x00000006, 0x0000002f, 0x0000002c, 0x0000002e, 0x0003003e, 0x0000002a, 0x0000002f,
-    0x00050041, 0x00000015, 0x00000031, 0x00000010, 0x00000018, 0x0004003d, 0x00000006, 0x00000032,
-    0x00000031, 0x00050041, 0x00000015, 0x00000033, 0x0000000f, 0x00000014, 0x0004003d, 0x00000006,
-    0x00000034, 0x00000033, 0x00050082, 0x00000006, 0x00000035, 0x00000032, 0x00000034, 0x0004003d,
-    0x00000006, 0x00000037, 0x0000002a, 0x00050082, 0x00000006, 0x00000038, 0x00000037, 0x00000014,
-    0x0007000c, 0x00000006, 0x00000039, 0x00000001, 0x0000002a, 0x00000038, 0x00000036, 0x0008000c,
-    0x00000006, 0x0000003a, 0x00000001, 0x0000002d, 0x00000035, 0x00000036, 0x00000039, 0x0003003e,
-    0x00000030, 0x0000003a, 0x00050041, 0x00000015, 0x0000003c, 0x00000011, 0x00000018, 0x0004003d,
-    0x00000006, 0x0000003d, 0x0000003c, 0x00050041, 0x00000015, 0x0000003e, 0x0000000f, 0x00000014,
-    0x0004003d, 0x00000006, 0x0000003f, 0x0000003e, 0x00050082, 0x00000006, 0x00000040, 0x0000003d,
-    0x0000003f, 0x0004003d, 0x00000006, 0x00000041, 0x0000002a, 0x00050082, 0x00000006, 0x00000042,
-    0x00000041, 0x00000014, 0x0007000c, 0x00000006, 0x00000043, 0x00000001, 0x0000002a, 0x00000042,
-    0x00000036, 0x0008000c, 0x00000006, 0x00000044, 0x00000001, 0x0000002d, 0x00000040, 0x00000036,
-    0x00000043, 0x0003003e, 0x0000003b, 0x00000044, 0x00050041, 0x00000015, 0x0000004d, 0x0000000f,
-    0x00000036, 0x0004003d, 0x00000006, 0x0000004e, 0x0000004d, 0x0004003d, 0x00000006, 0x0000004f,
-    0x00000030, 0x00050080, 0x00000006, 0x00000050, 0x0000004e, 0x0000004f, 0x00060041, 0x00000051,
-    0x00000052, 0x0000004c, 0x00000036, 0x00000050, 0x0004003d, 0x00000048, 0x00000053, 0x00000052,
-    0x00050051, 0x00000006, 0x00000054, 0x00000053, 0x00000000, 0x00050041, 0x00000015, 0x00000055,
-    0x00000047, 0x00000036, 0x0003003e, 0x00000055, 0x00000054, 0x00050051, 0x00000006, 0x00000056,
-    0x00000053, 0x00000001, 0x00050041, 0x00000015, 0x00000057, 0x00000047, 0x00000014, 0x0003003e,
-    0x00000057, 0x00000056, 0x00050051, 0x00000006, 0x00000058, 0x00000053, 0x00000002, 0x00050041,
-    0x00000015, 0x00000059, 0x00000047, 0x0000001f, 0x0003003e, 0x00000059, 0x00000058, 0x00050051,
-    0x00000006, 0x0000005a, 0x00000053, 0x00000003, 0x00050041, 0x00000015, 0x0000005c, 0x00000047,
-    0x0000005b, 0x0003003e, 0x0000005c, 0x0000005a, 0x00050051, 0x00000006, 0x0000005d, 0x00000053,
-    0x00000004, 0x00050041, 0x00000015, 0x0000005f, 0x00000047, 0x0000005e, 0x0003003e, 0x0000005f,
-    0x0000005d, 0x00050051, 0x00000006, 0x00000060, 0x00000053, 0x00000005, 0x00050041, 0x00000015,
-    0x00000062, 0x00000047, 0x00000061, 0x0003003e, 0x00000062, 0x00000060, 0x00050051, 0x00000006,
-    0x00000063, 0x00000053, 0x00000006, 0x00050041, 0x00000015, 0x00000065, 0x00000047, 0x00000064,
-    0x0003003e, 0x00000065, 0x00000063, 0x00050051, 0x00000007, 0x00000066, 0x00000053, 0x00000007,
-    0x00050041, 0x00000068, 0x00000069, 0x00000047, 0x00000067, 0x0003003e, 0x00000069, 0x00000066,
-    0x00050051, 0x00000006, 0x0000006a, 0x00000053, 0x00000008, 0x00050041, 0x00000015, 0x0000006c,
-    0x00000047, 0x0000006b, 0x0003003e, 0x0000006c, 0x0000006a, 0x00050051, 0x00000006, 0x0000006d,
-    0x00000053, 0x00000009, 0x00050041, 0x00000015, 0x0000006f, 0x00000047, 0x0000006e, 0x0003003e,
-    0x0000006f, 0x0000006d, 0x00050051, 0x00000006, 0x00000070, 0x00000053, 0x0000000a, 0x00050041,
-    0x00000015, 0x00000072, 0x00000047, 0x00000071, 0x0003003e, 0x00000072, 0x00000070, 0x00050051,
-    0x00000006, 0x00000073, 0x00000053, 0x0000000b, 0x00050041, 0x00000015, 0x00000075, 0x00000047,
-    0x00000074, 0x0003003e, 0x00000075, 0x00000073, 0x00050051, 0x00000006, 0x00000076, 0x00000053,
-    0x0000000c, 0x00050041, 0x00000015, 0x00000078, 0x00000047, 0x00000077, 0x0003003e, 0x00000078,
-    0x00000076, 0x00050051, 0x00000006, 0x00000079, 0x00000053, 0x0000000d, 0x00050041, 0x00000015,
-    0x0000007b, 0x00000047, 0x0000007a, 0x0003003e, 0x0000007b, 0x00000079, 0x00050051, 0x00000006,
-    0x0000007c, 0x00000053, 0x0000000e, 0x00050041, 0x00000015, 0x0000007e, 0x00000047, 0x0000007d,
-    0x0003003e, 0x0000007e, 0x0000007c, 0x00050051, 0x00000006, 0x0000007f, 0x00000053, 0x0000000f,
-    0x00050041, 0x00000015, 0x00000081, 0x00000047, 0x00000080, 0x0003003e, 0x00000081, 0x0000007f,
-    0x00050051, 0x00000006, 0x00000082, 0x00000053, 0x00000010, 0x00050041, 0x00000015, 0x00000084,
-    0x00000047, 0x00000083, 0x0003003e, 0x00000084, 0x00000082, 0x00050051, 0x00000006, 0x00000085,
-    0x00000053, 0x00000011, 0x00050041, 0x00000015, 0x00000087, 0x00000047, 0x00000086, 0x0003003e,
-    0x00000087, 0x00000085, 0x00050051, 0x00000006, 0x00000088, 0x00000053, 0x00000012, 0x00050041,
-    0x00000015, 0x0000008a, 0x00000047, 0x00000089, 0x0003003e, 0x0000008a, 0x00000088, 0x00050051,
-    0x00000006, 0x0000008b, 0x00000053, 0x00000013, 0x00050041, 0x00000015, 0x0000008d, 0x00000047,
-    0x0000008c, 0x0003003e, 0x0000008d, 0x0000008b, 0x00050051, 0x00000006, 0x0000008e, 0x00000053,
-    0x00000014, 0x00050041, 0x00000015, 0x00000090, 0x00000047, 0x0000008f, 0x0003003e, 0x00000090,
-    0x0000008e, 0x00050051, 0x00000006, 0x00000091, 0x00000053, 0x00000015, 0x00050041, 0x00000015,
-    0x00000093, 0x00000047, 0x00000092, 0x0003003e, 0x00000093, 0x00000091, 0x00050051, 0x00000006,
-    0x00000094, 0x00000053, 0x00000016, 0x00050041, 0x00000015, 0x00000096, 0x00000047, 0x00000095,
-    0x0003003e, 0x00000096, 0x00000094, 0x00050051, 0x00000006, 0x00000097, 0x00000053, 0x00000017,
-    0x00050041, 0x00000015, 0x00000099, 0x00000047, 0x00000098, 0x0003003e, 0x00000099, 0x00000097,
-    0x00050041, 0x00000015, 0x0000009b, 0x0000000f, 0x00000036, 0x0004003d, 0x00000006, 0x0000009c,
-    0x0000009b, 0x0004003d, 0x00000006, 0x0000009d, 0x0000003b, 0x00050080, 0x00000006, 0x0000009e,
-    0x0000009c, 0x0000009d, 0x00060041, 0x00000051, 0x0000009f, 0x0000004c, 0x00000036, 0x0000009e,
-    0x0004003d, 0x00000048, 0x000000a0, 0x0000009f, 0x00050051, 0x00000006, 0x000000a1, 0x000000a0,
-    0x00000000, 0x00050041, 0x00000015, 0x000000a2, 0x0000009a, 0x00000036, 0x0003003e, 0x000000a2,
-    0x000000a1, 0x00050051, 0x00000006, 0x000000a3, 0x000000a0, 0x00000001, 0x00050041, 0x00000015,
-    0x000000a4, 0x0000009a, 0x00000014, 0x0003003e, 0x000000a4, 0x000000a3, 0x00050051, 0x00000006,
-    0x000000a5, 0x000000a0, 0x00000002, 0x00050041, 0x00000015, 0x000000a6, 0x0000009a, 0x0000001f,
-    0x0003003e, 0x000000a6, 0x000000a5, 0x00050051, 0x00000006, 0x000000a7, 0x000000a0, 0x00000003,
-    0x00050041, 0x00000015, 0x000000a8, 0x0000009a, 0x0000005b, 0x0003003e, 0x000000a8, 0x000000a7,
-    0x00050051, 0x00000006, 0x000000a9, 0x000000a0, 0x00000004, 0x00050041, 0x00000015, 0x000000aa,
-    0x0000009a, 0x0000005e, 0x0003003e, 0x000000aa, 0x000000a9, 0x00050051, 0x00000006, 0x000000ab,
-    0x000000a0, 0x00000005, 0x00050041, 0x00000015, 0x000000ac, 0x0000009a, 0x00000061, 0x0003003e,
-    0x000000ac, 0x000000ab, 0x00050051, 0x00000006, 0x000000ad, 0x000000a0, 0x00000006, 0x00050041,
-    0x00000015, 0x000000ae, 0x0000009a, 0x00000064, 0x0003003e, 0x000000ae, 0x000000ad, 0x00050051,
-    0x00000007, 0x000000af, 0x000000a0, 0x00000007, 0x00050041, 0x00000068, 0x000000b0, 0x0000009a,
-    0x00000067, 0x0003003e, 0x000000b0, 0x000000af, 0x00050051, 0x00000006, 0x000000b1, 0x000000a0,
-    0x00000008, 0x00050041, 0x00000015, 0x000000b2, 0x0000009a, 0x0000006b, 0x0003003e, 0x000000b2,
-    0x000000b1, 0x00050051, 0x00000006, 0x000000b3, 0x000000a0, 0x00000009, 0x00050041, 0x00000015,
-    0x000000b4, 0x0000009a, 0x0000006e, 0x0003003e, 0x000000b4, 0x000000b3, 0x00050051, 0x00000006,
-    0x000000b5, 0x000000a0, 0x0000000a, 0x00050041, 0x00000015, 0x000000b6, 0x0000009a, 0x00000071,
-    0x0003003e, 0x000000b6, 0x000000b5, 0x00050051, 0x00000006, 0x000000b7, 0x000000a0, 0x0000000b,
-    0x00050041, 0x00000015, 0x000000b8, 0x0000009a, 0x00000074, 0x0003003e, 0x000000b8, 0x000000b7,
-    0x00050051, 0x00000006, 0x000000b9, 0x000000a0, 0x0000000c, 0x00050041, 0x00000015, 0x000000ba,
-    0x0000009a, 0x00000077, 0x0003003e, 0x000000ba, 0x000000b9, 0x00050051, 0x00000006, 0x000000bb,
-    0x000000a0, 0x0000000d, 0x00050041, 0x00000015, 0x000000bc, 0x0000009a, 0x0000007a, 0x0003003e,
-    0x000000bc, 0x000000bb, 0x00050051, 0x00000006, 0x000000bd, 0x000000a0, 0x0000000e, 0x00050041,
-    0x00000015, 0x000000be, 0x0000009a, 0x0000007d, 0x0003003e, 0x000000be, 0x000000bd, 0x00050051,
-    0x00000006, 0x000000bf, 0x000000a0, 0x0000000f, 0x00050041, 0x00000015, 0x000000c0, 0x0000009a,
-    0x00000080, 0x0003003e, 0x000000c0, 0x000000bf, 0x00050051, 0x00000006, 0x000000c1, 0x000000a0,
-    0x00000010, 0x00050041, 0x00000015, 0x000000c2, 0x0000009a, 0x00000083, 0x0003003e, 0x000000c2,
-    0x000000c1, 0x00050051, 0x00000006, 0x000000c3, 0x000000a0, 0x00000011, 0x00050041, 0x00000015,
-    0x000000c4, 0x0000009a, 0x00000086, 0x0003003e, 0x000000c4, 0x000000c3, 0x00050051, 0x00000006,
-    0x000000c5, 0x000000a0, 0x00000012, 0x00050041, 0x00000015, 0x000000c6, 0x0000009a, 0x00000089,
-    0x0003003e, 0x000000c6, 0x000000c5, 0x00050051, 0x00000006, 0x000000c7, 0x000000a0, 0x00000013,
-    0x00050041, 0x00000015, 0x000000c8, 0x0000009a, 0x0000008c, 0x0003003e, 0x000000c8, 0x000000c7,
-    0x00050051, 0x00000006, 0x000000c9, 0x000000a0, 0x00000014, 0x00050041, 0x00000015, 0x000000ca,
-    0x0000009a, 0x0000008f, 0x0003003e, 0x000000ca, 0x000000c9, 0x00050051, 0x00000006, 0x000000cb,
-    0x000000a0, 0x00000015, 0x00050041, 0x00000015, 0x000000cc, 0x0000009a, 0x00000092, 0x0003003e,
-    0x000000cc, 0x000000cb, 0x00050051, 0x00000006, 0x000000cd, 0x000000a0, 0x00000016, 0x00050041,
-    0x00000015, 0x000000ce, 0x0000009a, 0x00000095, 0x0003003e, 0x000000ce, 0x000000cd, 0x00050051,
-    0x00000006, 0x000000cf, 0x000000a0, 0x00000017, 0x00050041, 0x00000015, 0x000000d0, 0x0000009a,
-    0x00000098, 0x0003003e, 0x000000d0, 0x000000cf, 0x00050041, 0x00000015, 0x000000d1, 0x0000000f,
-    0x00000061, 0x0004003d, 0x00000006, 0x000000d2, 0x000000d1, 0x00050041, 0x00000015, 0x000000d3,
-    0x00000010, 0x00000018, 0x0004003d, 0x00000006, 0x000000d4, 0x000000d3, 0x000500af, 0x0000000d,
-    0x000000d5, 0x000000d2, 0x000000d4, 0x000300f7, 0x000000d7, 0x00000000, 0x000400fa, 0x000000d5,
-    0x000000d6, 0x000000d7, 0x000200f8, 0x000000d6, 0x00050041, 0x00000015, 0x000000d8, 0x0000000f,
-    0x00000061, 0x0004003d, 0x00000006, 0x000000d9, 0x000000d8, 0x00050041, 0x00000015, 0x000000da,
-    0x00000011, 0x00000018, 0x0004003d, 0x00000006, 0x000000db, 0x000000da, 0x000500b3, 0x0000000d,
-    0x000000dc, 0x000000d9, 0x000000db, 0x000200f9, 0x000000d7, 0x000200f8, 0x000000d7, 0x000700f5,
-    0x0000000d, 0x000000dd, 0x000000d5, 0x00000027, 0x000000dc, 0x000000d6, 0x000300f7, 0x000000df,
-    0x00000000, 0x000400fa, 0x000000dd, 0x000000de, 0x000000e3, 0x000200f8, 0x000000de, 0x00050041,
-    0x00000015, 0x000000e1, 0x0000000f, 0x0000005b, 0x0004003d, 0x00000006, 0x000000e2, 0x000000e1,
-    0x0003003e, 0x000000e0, 0x000000e2, 0x000200f9, 0x000000df, 0x000200f8, 0x000000e3, 0x00050041,
-    0x00000015, 0x000000e4, 0x00000047, 0x00000036, 0x0004003d, 0x00000006, 0x000000e5, 0x000000e4,
-    0x00050041, 0x00000015, 0x000000e6, 0x0000009a, 0x00000036, 0x0004003d, 0x00000006, 0x000000e7,
-    0x000000e6, 0x0007000c, 0x00000006, 0x000000e8, 0x00000001, 0x00000027, 0x000000e5, 0x000000e7,
-    0x0003003e, 0x000000e0, 0x000000e8, 0x000200f9, 0x000000df, 0x000200f8, 0x000000df, 0x0004003d,
-    0x00000006, 0x000000e9, 0x000000e0, 0x00050041, 0x00000015, 0x000000eb, 0x00000011, 0x000000ea,
-    0x0004003d, 0x00000006, 0x000000ec, 0x000000eb, 0x000500ad, 0x0000000d, 0x000000ed, 0x000000e9,
-    0x000000ec, 0x000300f7, 0x000000ef, 0x00000000, 0x000400fa, 0x000000ed, 0x000000ee, 0x000000ef,
-    0x000200f8, 0x000000ee, 0x000200fe, 0x00000028, 0x000200f8, 0x000000ef, 0x00050041, 0x00000015,
-    0x000000f1, 0x0000000f, 0x00000064, 0x0004003d, 0x00000006, 0x000000f2, 0x000000f1, 0x00050041,
-    0x00000015, 0x000000f3, 0x00000010, 0x00000018, 0x0004003d, 0x00000006, 0x000000f4, 0x000000f3,
-    0x000500af, 0x0000000d, 0x000000f5, 0x000000f2, 0x000000f4, 0x000300f7, 0x000000f7, 0x00000000,
-    0x000400fa, 0x000000f5, 0x000000f6, 0x000000f7, 0x000200f8, 0x000000f6, 0x00050041, 0x00000015,
-    0x000000f8, 0x0000000f, 0x00000064, 0x0004003d, 0x00000006, 0x000000f9, 0x000000f8, 0x00050041,
-    0x00000015, 0x000000fa, 0x00000011, 0x00000018, 0x0004003d, 0x00000006, 0x000000fb, 0x000000fa,
-    0x000500b3, 0x0000000d, 0x000000fc, 0x000000f9, 0x000000fb, 0x000200f9, 0x000000f7, 0x000200f8,
-    0x000000f7, 0x000700f5, 0x0000000d, 0x000000fd, 0x000000f5, 0x000000ef, 0x000000fc, 0x000000f6,
-    0x000300f7, 0x000000ff, 0x00000000, 0x000400fa, 0x000000fd, 0x000000fe, 0x00000103, 0x000200f8,
-    0x000000fe, 0x00050041, 0x00000015, 0x00000101, 0x0000000f, 0x0000005e, 0x0004003d, 0x00000006,
-    0x00000102, 0x00000101, 0x0003003e, 0x00000100, 0x00000102, 0x000200f9, 0x000000ff, 0x000200f8,
-    0x00000103, 0x00050041, 0x00000015, 0x00000104, 0x00000047, 0x00000014, 0x0004003d, 0x00000006,
-    0x00000105, 0x00000104, 0x00050041, 0x00000015, 0x00000106, 0x0000009a, 0x00000014, 0x0004003d,
-    0x00000006, 0x00000107, 0x00000106, 0x0007000c, 0x00000006, 0x00000108, 0x00000001, 0x0000002a,
-    0x00000105, 0x00000107, 0x00050082, 0x00000006, 0x00000109, 0x00000108, 0x00000014, 0x0003003e,
-    0x00000100, 0x00000109, 0x000200f9, 0x000000ff, 0x000200f8, 0x000000ff, 0x0004003d, 0x00000006,
-    0x0000010a, 0x00000100, 0x00050041, 0x00000015, 0x0000010b, 0x00000010, 0x000000ea, 0x0004003d,
-    0x00000006, 0x0000010c, 0x0000010b, 0x000500b1, 0x0000000d, 0x0000010d, 0x0000010a, 0x0000010c,
-    0x000300f7, 0x0000010f, 0x00000000, 0x000400fa, 0x0000010d, 0x0000010e, 0x0000010f, 0x000200f8,
-    0x0000010e, 0x000200fe, 0x00000028, 0x000200f8, 0x0000010f, 0x000200fe, 0x00000111, 0x00010038,
+const uint8_t Blob002_Data[4960] =
+{
+    0x28, 0xb5, 0x2f, 0xfd, 0x60, 0x00, 0x4a, 0xb5, 0x9a, 0x00, 0x6a, 0x9f, 0x64, 0x26, 0x38, 0x10,
+    0x90, 0xd9, 0x0d, 0x00, 0x5d, 0x10, 0x80, 0x01, 0x80, 0x01, 0xa0, 0x0b, 0x40, 0x22, 0xa7, 0x45,
+    0x03, 0x00, 0x2b, 0xc0, 0x5c, 0x7b, 0xf9, 0xe7, 0xee, 0xfd, 0xbf, 0xdf, 0xe5, 0x66, 0x66, 0xe5,
+    0xca, 0x75, 0x46, 0xc4, 0x54, 0x58, 0xb6, 0xae, 0xb8, 0xc5, 0x13, 0xb9, 0x4d, 0x71, 0xa0, 0x93,
+    0xad, 0x6b, 0x3d, 0xdd, 0x7e, 0xef, 0x14, 0x1d, 0x02, 0x43, 0x02, 0x86, 0x02, 0xbf, 0x05, 0x09,
+    0x11, 0x81, 0xb6, 0x6e, 0x83, 0xbd, 0x7f, 0xdd, 0xed, 0xdf, 0xfb, 0x60, 0x3b, 0x70, 0xc7, 0xad,
+    0xcc, 0xe4, 0x5f, 0xe2, 0x5d, 0xac, 0x92, 0xfb, 0x55, 0x4b, 0xd2, 0xdd, 0x1d, 0x7c, 0xa3, 0xcd,
+    0x5f, 0xb7, 0x6f, 0xef, 0xd9, 0xed, 0xf5, 0xb3, 0xe5, 0xf2, 0xef, 0x77, 0xcf, 0xcf, 0xc0, 0x61,
+    0x1c, 0xed, 0x6f, 0xef, 0x38, 0xbb, 0x0b, 0xf6, 0x9a, 0xfd, 0x70, 0xa0, 0x60, 0x04, 0xbd, 0xf9,
+    0x07, 0xea, 0xdf, 0x2d, 0x9e, 0xcf, 0xd9, 0xfb, 0xed, 0xa6, 0x97, 0xe7, 0xb8, 0x1f, 0xdb, 0xb7,
+    0x5a, 0xff, 0xd8, 0xcf, 0x82, 0xa9, 0xdf, 0x68, 0x83, 0xf9, 0x68, 0xe4, 0x7e, 0x87, 0xb7, 0xdb,
+    0xb7, 0xbb, 0xf9, 0x83, 0xed, 0xb3, 0x30, 0x1b, 0x92, 0x96, 0x3b, 0x7e, 0x2c, 0xd8, 0xd6, 0x8d,
+    0xf2, 0xff, 0xdd, 0x5d, 0x8b, 0xd7, 0xc5, 0xba, 0xe0, 0x59, 0x78, 0x0f, 0xe7, 0xdf, 0xb3, 0x6e,
+    0x58, 0x10, 0xee, 0x0b, 0xec, 0xa5, 0xa5, 0xbd, 0x75, 0xbb, 0x8b, 0x05, 0x0c, 0xdb, 0x6e, 0xda,
+    0x9b, 0xab, 0xdf, 0x57, 0x84, 0xb7, 0x36, 0x67, 0xcb, 0xbf, 0xf8, 0x3e, 0x98, 0x5f, 0x93, 0x5e,
+    0x3b, 0xfb, 0xf5, 0x4e, 0xfd, 0xdb, 0x8b, 0xcb, 0xdd, 0x61, 0xdd, 0xfe, 0x66, 0xa1, 0xd0, 0xd6,
+    0x00, 0xf5, 0x6f, 0x1d, 0x9f, 0xf7, 0xe9, 0x13, 0x6a, 0xd9, 0xc0, 0x82, 0x5f, 0x9d, 0x1b, 0x8d,
+    0xb3, 0x23, 0xb4, 0xe3, 0x7f, 0xb5, 0xcb, 0xf1, 0x40, 0x3b, 0xc8, 0x9c, 0xff, 0xd7, 0x6f, 0xfc,
+    0x6d, 0xfa, 0xbd, 0xdd, 0x0a, 0x5a, 0xc3, 0x6d, 0x9f, 0xae, 0xeb, 0xba, 0xae, 0xeb, 0xba, 0xae,
+    0xeb, 0xba, 0xae, 0xeb, 0xba, 0xae, 0xeb, 0xba, 0x46, 0x86, 0x09, 0xd7, 0x9e, 0xbc, 0x36, 0xbe,
+    0xe3, 0x39, 0x9b, 0x13, 0x5d, 0xd3, 0x5c, 0x94, 0x0e, 0xc0, 0xe7, 0x9a, 0xd3, 0xea, 0xdf, 0x6f,
+    0x96, 0x69, 0x86, 0x3e, 0xbb, 0x9c, 0xd6, 0xa5, 0x35, 0x25, 0xae, 0x38, 0xfd, 0xeb, 0xfd, 0x9e,
+    0x35, 0x91, 0x75, 0xcc, 0xba, 0xe5, 0x11, 0x0f, 0xef, 0x87, 0xb9, 0xb6, 0x57, 0x0d, 0x8c, 0x67,
+    0xef, 0x38, 0x64, 0x1c, 0xf2, 0x5f, 0x07, 0xbf, 0x67, 0x37, 0x57, 0x9b, 0x76, 0xfc, 0x5f, 0x9b,
+    0xa7, 0x19, 0x77, 0xdd, 0xde, 0xb1, 0xb7, 0x16, 0x0f, 0xe7, 0x6c, 0xf2, 0xdc, 0x15, 0x73, 0xfd,
+    0x23, 0x58, 0x70, 0xbf, 0xb1, 0x69, 0xd5, 0x3b, 0xfd, 0xce, 0x73, 0x36, 0xae, 0xbb, 0xbe, 0x42,
+    0xfe, 0xbd, 0xcb, 0xc5, 0xe3, 0xf6, 0xaf, 0x1f, 0x72, 0xdf, 0xde, 0x57, 0xf0, 0x77, 0x7f, 0x82,
+    0x9d, 0x7f, 0x01, 0x3e, 0x58, 0xed, 0xda, 0x6a, 0x75, 0x09, 0x76, 0xe1, 0x5a, 0x5a, 0x7b, 0x56,
+    0x50, 0xdf, 0xc3, 0x56, 0x39, 0x6e, 0xfd, 0xff, 0x33, 0xfd, 0xe8, 0xaf, 0x70, 0xe3, 0x74, 0xdc,
+    0x1c, 0xcf, 0xda, 0x6a, 0xcb, 0xf9, 0x2e, 0xb4, 0xaf, 0xb7, 0x2e, 0xb8, 0x13, 0xde, 0x72, 0x4a,
+    0xfa, 0xeb, 0xfb, 0x6e, 0x96, 0xdc, 0x73, 0x1b, 0xd7, 0x6d, 0x3a, 0x7a, 0xbe, 0x43, 0x7e, 0x42,
+    0xfb, 0xe8, 0x66, 0x67, 0xdc, 0xbf, 0x56, 0xf9, 0x7f, 0xf0, 0x57, 0xee, 0x4e, 0x39, 0xdb, 0x60,
+    0xac, 0xdd, 0x1e, 0xd6, 0x71, 0xb5, 0x3f, 0xff, 0xf9, 0xe7, 0x5f, 0x6e, 0xa1, 0xf7, 0x0b, 0xa7,
+    0xfc, 0x47, 0xad, 0xa0, 0x37, 0x9b, 0xe3, 0xc9, 0x7f, 0x0f, 0xe2, 0x7b, 0xf6, 0xd6, 0x71, 0x2d,
+    0xdf, 0x9d, 0xe3, 0x5e, 0xbe, 0xdb, 0x5b, 0xb8, 0x87, 0xf9, 0xc0, 0xe0, 0x2c, 0x5f, 0xda, 0x75,
+    0xed, 0xed, 0x6d, 0x8d, 0x6f, 0xf9, 0x8f, 0x58, 0x64, 0x63, 0x3c, 0x85, 0x1e, 0x9f, 0x54, 0x4f,
+    0x3f, 0xc7, 0xed, 0xc0, 0x23, 0xf2, 0xd3, 0xdf, 0xf9, 0x8d, 0x7f, 0xe9, 0x73, 0x31, 0xf8, 0xda,
+    0xd2, 0xee, 0xe1, 0xad, 0x2b, 0xf6, 0xba, 0x36, 0xff, 0x1f, 0x7f, 0xf9, 0x43, 0xbf, 0x6c, 0xe1,
+    0x27, 0x3f, 0xf3, 0xc7, 0xc6, 0x4f, 0x17, 0x90, 0x8d, 0x01, 0x05, 0x0c, 0x50, 0x15, 0xa0, 0xa7,
+    0x50, 0x52, 0x53, 0x26, 0x01, 0xa9, 0xa8, 0x37, 0x02, 0x63, 0xdf, 0xf8, 0xc9, 0x7e, 0x3c, 0x00,
+    0x83, 0x80, 0x31, 0xc5, 0x00, 0x52, 0x33, 0x3b, 0x6c, 0x9b, 0x35, 0xcc, 0xab, 0x2b, 0x27, 0xea,
+    0xe2, 0x69, 0x7a, 0xd3, 0xa6, 0x99, 0xb8, 0x5c, 0x82, 0xd8, 0x74, 0xd8, 0xed, 0xf9, 0x17, 0x2d,
+    0xba, 0x24, 0x44, 0x78, 0x97, 0x6c, 0xb5, 0x75, 0xac, 0xe9, 0xa5, 0x35, 0xd5, 0x04, 0xd5, 0xa4,
+    0xa3, 0x55, 0x24, 0x23, 0xe3, 0x3f, 0xca, 0x54, 0xa9, 0xb4, 0x70, 0x9e, 0x12, 0x2a, 0x56, 0x50,
+    0x34, 0x1c, 0x4c, 0x0a, 0xfe, 0xe3, 0x6e, 0xf8, 0xc3, 0xff, 0xeb, 0xc9, 0x0f, 0x14, 0xb8, 0x3e,
+    0xf8, 0x7f, 0xef, 0xb4, 0xaf, 0xca, 0x37, 0x61, 0x2f, 0x6a, 0xc2, 0xdc, 0xc7, 0x7a, 0x90, 0xe0,
+    0x2a, 0x01, 0xd5, 0xb0, 0x29, 0xc5, 0xfc, 0xff, 0xc3, 0x52, 0x69, 0x25, 0x49, 0xcb, 0x53, 0x63,
+    0xdc, 0xfc, 0x55, 0x49, 0xcd, 0x49, 0xd3, 0x48, 0x90, 0xe8, 0x48, 0x90, 0xe8, 0x47, 0x50, 0x8d,
+    0x1c, 0x35, 0x02, 0x14, 0xe1, 0x67, 0xfe, 0xea, 0xb3, 0x80, 0xcb, 0xdd, 0x01, 0x08, 0x78, 0x23,
+    0x49, 0x7b, 0xd8, 0x06, 0x36, 0xff, 0xf0, 0x6e, 0x13, 0xe7, 0x6e, 0x69, 0xbe, 0xe9, 0x5e, 0x55,
+    0x9e, 0x90, 0x87, 0x37, 0xeb, 0xfd, 0x25, 0x39, 0xef, 0xe9, 0xce, 0x0e, 0x0f, 0x8a, 0xea, 0xce,
+    0x4e, 0xa9, 0x9e, 0xa6, 0xa1, 0xa9, 0x49, 0xa5, 0xa1, 0x29, 0x88, 0x99, 0x59, 0x65, 0x0f, 0x94,
+    0x0d, 0xa6, 0xd4, 0x2a, 0x83, 0x79, 0xa9, 0x60, 0xfe, 0x71, 0x32, 0x4b, 0xc6, 0x3a, 0x5e, 0x55,
+    0x8f, 0x09, 0xa8, 0xaa, 0x74, 0x14, 0x2d, 0x8d, 0x9f, 0xaa, 0x4e, 0xc6, 0xa6, 0x18, 0x9a, 0xe0,
+    0x2b, 0xd2, 0x4f, 0x33, 0x9c, 0x60, 0x34, 0xb5, 0x88, 0xaa, 0x00, 0x70, 0x82, 0x89, 0x04, 0x34,
+    0xc4, 0xd3, 0x83, 0xd3, 0x70, 0x29, 0x83, 0x92, 0x85, 0x66, 0x05, 0xe6, 0xbe, 0xa4, 0xa0, 0xcc,
+    0x93, 0x80, 0x74, 0x97, 0x3b, 0x6b, 0x91, 0xf6, 0x71, 0xcf, 0x98, 0x57, 0x4b, 0x68, 0x5e, 0xab,
+    0x6d, 0x4d, 0x08, 0x6c, 0x04, 0x6a, 0xb6, 0xa8, 0x3a, 0x4d, 0x6d, 0x4e, 0x23, 0xf0, 0xa9, 0x56,
+    0x4a, 0x57, 0xb2, 0x94, 0x94, 0x9e, 0xe9, 0xa6, 0x69, 0x14, 0xab, 0xb9, 0x54, 0x9a, 0x95, 0xa2,
+    0xcc, 0xa6, 0xcc, 0x7c, 0x52, 0xd2, 0xcb, 0x24, 0x3d, 0x2b, 0x7d, 0x02, 0x49, 0xa7, 0x4f, 0xc7,
+    0x73, 0x93, 0x71, 0x4a, 0x0e, 0xc0, 0x2c, 0x94, 0xc1, 0xca, 0xbe, 0xbe, 0xbd, 0x79, 0x42, 0x9c,
+    0x4c, 0xca, 0xff, 0x79, 0xb4, 0x62, 0xec, 0x65, 0xc3, 0xf8, 0x7f, 0x49, 0x91, 0x20, 0x1d, 0x1f,
+    0x3d, 0x67, 0x47, 0x3f, 0xee, 0x13, 0xff, 0xfd, 0xfd, 0xdf, 0xcd, 0x9a, 0xb9, 0x7f, 0x3b, 0xf5,
+    0xa9, 0xf6, 0x6a, 0x26, 0xda, 0xb2, 0x4c, 0x29, 0x96, 0x04, 0xfb, 0x92, 0xb9, 0xfe, 0xd7, 0xc3,
+    0xfb, 0x8a, 0xa2, 0x12, 0xf0, 0x34, 0xf5, 0xa9, 0xae, 0xb2, 0xf1, 0xff, 0xb6, 0x3e, 0xb6, 0x35,
+    0xbd, 0x27, 0x3b, 0x27, 0xb9, 0x26, 0xb8, 0xe8, 0x15, 0x40, 0xcd, 0x84, 0x06, 0x2d, 0x7b, 0x8a,
+    0x39, 0xc1, 0x96, 0xbe, 0x94, 0xb8, 0x9a, 0x59, 0x4c, 0xab, 0xa5, 0x01, 0xe5, 0x34, 0x09, 0x45,
+    0x4b, 0xe7, 0x28, 0xf2, 0x79, 0x6c, 0x1a, 0x93, 0xf2, 0x31, 0xfe, 0x05, 0x7e, 0x1d, 0xae, 0x70,
+    0x6b, 0x71, 0x7d, 0xc7, 0xfa, 0xdd, 0x6a, 0x14, 0x3e, 0xb8, 0x6f, 0xce, 0x86, 0x6f, 0xb4, 0xbd,
+    0x1c, 0xb7, 0xfb, 0xf3, 0x20, 0xb6, 0x4d, 0xb6, 0x7e, 0x3c, 0xec, 0x0e, 0xfc, 0x9e, 0xe1, 0xe1,
+    0x2f, 0xdc, 0xee, 0x15, 0xc6, 0x8a, 0xfe, 0xe6, 0xa7, 0xc3, 0xca, 0x5c, 0xd6, 0xe6, 0x66, 0xf9,
+    0x3f, 0xfe, 0x6f, 0xf4, 0xda, 0x77, 0x9c, 0xac, 0xfc, 0x75, 0xda, 0x7b, 0xd7, 0xbf, 0xd8, 0xf8,
+    0xe7, 0x82, 0xdf, 0xb3, 0xba, 0xbf, 0x7b, 0x05, 0xc3, 0x77, 0x9c, 0xa4, 0x0a, 0x89, 0xfe, 0x55,
+    0xbf, 0xe1, 0xc2, 0x7e, 0xf2, 0xfb, 0xd6, 0xb3, 0xd8, 0x3e, 0xba, 0xed, 0xc5, 0xf3, 0xa6, 0x4d,
+    0xe2, 0x5f, 0xb2, 0x23, 0x7e, 0xe3, 0x61, 0xcf, 0xff, 0x1c, 0xdf, 0xbe, 0x08, 0x7f, 0x74, 0x73,
+    0xbf, 0x4d, 0x2e, 0xae, 0x4d, 0x02, 0x5c, 0x9c, 0x55, 0xc2, 0x9b, 0x1b, 0xdc, 0x97, 0xdf, 0x22,
+    0xc8, 0x6e, 0xff, 0x5f, 0x65, 0x08, 0x6c, 0xf5, 0xff, 0x6b, 0xb2, 0xda, 0x97, 0xd3, 0xd0, 0xac,
+    0x68, 0x67, 0x62, 0x63, 0x62, 0x65, 0x66, 0x65, 0x0f, 0x1e, 0x7c, 0xb2, 0xb1, 0x45, 0x55, 0x6a,
+    0x98, 0x03, 0x2f, 0x30, 0x07, 0xff, 0x7b, 0x68, 0xc0, 0x00, 0x8c, 0xfe, 0x5f, 0xa8, 0x0d, 0xa4,
+    0xd4, 0x2f, 0x06, 0x8a, 0xfc, 0x57, 0xd7, 0x02, 0xae, 0x05, 0x89, 0xba, 0x14, 0x6c, 0x71, 0x29,
+    0xd0, 0xc2, 0xda, 0xca, 0xd2, 0xca, 0xaa, 0xb2, 0xaa, 0x42, 0x60, 0x75, 0x00, 0xc1, 0x01, 0x3a,
+    0xca, 0x40, 0x81, 0xb4, 0x29, 0xaa, 0x2e, 0x53, 0x52, 0x53, 0xaa, 0x94, 0x61, 0x94, 0x00, 0x14,
+    0x54, 0x94, 0x80, 0x01, 0x02, 0xe8, 0x00, 0x51, 0x69, 0x00, 0xfb, 0x49, 0x9a, 0xe5, 0x49, 0xaa,
+    0xc9, 0xa9, 0x89, 0x09, 0xba, 0x07, 0x60, 0x3e, 0x64, 0xa2, 0x9f, 0x4e, 0x68, 0xf4, 0xd9, 0x74,
+    0x1a, 0x3e, 0x58, 0xc2, 0xa3, 0xc4, 0x88, 0x11, 0xad, 0x38, 0x63, 0x40, 0x8e, 0xf9, 0xf2, 0x31,
+    0xa6, 0x7e, 0x23, 0xbd, 0xc8, 0x68, 0x71, 0x11, 0xa3, 0x45, 0x45, 0x8b, 0x0e, 0x15, 0x25, 0x42,
+    0x84, 0xe7, 0xd0, 0x20, 0x44, 0x7b, 0x86, 0x0e, 0xf9, 0x29, 0x64, 0x88, 0x50, 0x21, 0x29, 0x21,
+    0x41, 0x8a, 0x83, 0x3e, 0x60, 0x20, 0x41, 0x80, 0x02, 0x29, 0x42, 0x01, 0x52, 0xf4, 0xc3, 0xe7,
+    0xcf, 0x1e, 0x3e, 0xd2, 0x3d, 0x79, 0xf4, 0x28, 0xbe, 0xc8, 0xf3, 0xa3, 0x07, 0x10, 0x20, 0x73,
+    0xe6, 0xdc, 0x39, 0xac, 0x63, 0xe7, 0xce, 0x96, 0x43, 0x3b, 0x74, 0xea, 0x20, 0xd2, 0x91, 0x33,
+    0x47, 0x4e, 0x9c, 0x39, 0x8b, 0x6f, 0xda, 0x24, 0xc6, 0x79, 0xd3, 0xc3, 0x71, 0xd3, 0x86, 0x77,
+    0xb3, 0x86, 0xcd, 0x9a, 0x34, 0x6a, 0xd2, 0x9c, 0x41, 0x73, 0xa6, 0x8c, 0x99, 0x32, 0x63, 0xc8,
+    0x8c, 0x09, 0x23, 0x26, 0xcc, 0x17, 0x30, 0x5f, 0xba, 0x78, 0xe9, 0xb2, 0x85, 0x4b, 0x22, 0x17,
+    0x2b, 0x5b, 0xb2, 0x68, 0x49, 0xd4, 0x62, 0x25, 0xcb, 0x15, 0x2c, 0x89, 0x58, 0xac, 0x5c, 0xa9,
+    0x62, 0x85, 0x4a, 0x95, 0x25, 0x54, 0xa6, 0x2c, 0x91, 0x12, 0x65, 0x0a, 0xa2, 0x94, 0x28, 0x86,
+    0x4f, 0xa0, 0x3c, 0xf9, 0xdf, 0x09, 0x93, 0x26, 0x54, 0x26, 0xff, 0x23, 0x51, 0xd2, 0x25, 0xc9,
+    0x11, 0x24, 0x5e, 0x8c, 0x1c, 0x41, 0x34, 0x52, 0x04, 0x91, 0xad, 0x48, 0x93, 0x08, 0xed, 0xe3,
+    0x87, 0x8f, 0x21, 0x8a, 0x42, 0x86, 0x0c, 0x69, 0x21, 0x24, 0x48, 0x90, 0x0f, 0xe4, 0xc7, 0xa2,
+    0x1e, 0x3d, 0x0e, 0x79, 0xf4, 0x3b, 0x74, 0xf0, 0xe0, 0x75, 0xe4, 0xe0, 0x71, 0xd4, 0xc8, 0x71,
+    0xc3, 0x06, 0x8e, 0x17, 0x36, 0xc6, 0x6a, 0xd0, 0x78, 0x31, 0x23, 0x06, 0x0d, 0x38, 0x19, 0x33,
+    0xb2, 0xc8, 0xe0, 0xc6, 0x98, 0xbb, 0xc0, 0x70, 0xd1, 0xe2, 0xca, 0x05, 0x9d, 0x22, 0x85, 0xe2,
+    0x15, 0x0b, 0xda, 0x90, 0x74, 0x85, 0x96, 0x29, 0x15, 0x28, 0x52, 0xa0, 0x38, 0x91, 0x82, 0xed,
+    0xc4, 0x7d, 0x9b, 0x20, 0x21, 0x82, 0xc9, 0x84, 0x03, 0x12, 0xd6, 0x12, 0x23, 0x44, 0x8c, 0x00,
+    0x41, 0x21, 0xc4, 0x12, 0x44, 0x87, 0xfc, 0x83, 0x07, 0x65, 0x87, 0xa4, 0x21, 0x20, 0x87, 0x6e,
+    0xd2, 0x90, 0xd6, 0xc0, 0xdd, 0x40, 0x6b, 0xc0, 0xa0, 0xcd, 0x30, 0x63, 0xb0, 0x60, 0x5f, 0x40,
+    0x5a, 0x20, 0xdc, 0x2b, 0x3c, 0x12, 0x0e, 0xe6, 0x55, 0x30, 0x0e, 0xee, 0x52, 0x82, 0xf2, 0xae,
+    0x47, 0xc3, 0xb1, 0x0e, 0xf6, 0x52, 0x68, 0xfa, 0x60, 0x09, 0xdf, 0x2d, 0xe0, 0x5f, 0x1e, 0x68,
+    0x06, 0xa8, 0xbd, 0xb5, 0xd9, 0x5b, 0xce, 0xcf, 0x0d, 0x9b, 0x9d, 0x9b, 0xb3, 0xeb, 0xfc, 0x8e,
+    0xd8, 0x7b, 0x7d, 0x7c, 0x66, 0x74, 0x75, 0xb4, 0x17, 0x9d, 0xdc, 0x9c, 0x1c, 0x76, 0xee, 0x1a,
+    0x67, 0x05, 0x01, 0x4b, 0x7f, 0x45, 0x6e, 0x6e, 0x11, 0xe2, 0xe0, 0x24, 0xbc, 0xc1, 0x45, 0xdf,
+    0x22, 0x5c, 0xdd, 0xae, 0x10, 0xdc, 0xda, 0x20, 0x20, 0x99, 0x6a, 0x9b, 0xad, 0xd8, 0xd6, 0xac,
+    0x6a, 0x67, 0x6b, 0x86, 0x63, 0x67, 0x66, 0x63, 0x65, 0x64, 0x66, 0x4c, 0x28, 0x32, 0xa6, 0x98,
+    0x57, 0x35, 0x4c, 0x4c, 0xab, 0xea, 0x20, 0x0c, 0xcc, 0x01, 0x95, 0x0a, 0xd6, 0x40, 0xab, 0x8b,
+    0x6b, 0x81, 0xe1, 0x54, 0x97, 0x82, 0x2d, 0xae, 0xf9, 0x43, 0x74, 0x2b, 0x0b, 0x0b, 0xcb, 0x8e,
+    0x55, 0xa3, 0xab, 0xaa, 0x2a, 0x47, 0xdf, 0x6a, 0x91, 0x7a, 0x00, 0x81, 0x92, 0x90, 0xa9, 0x03,
+    0x06, 0xa6, 0x02, 0x3f, 0xfe, 0x60, 0xff, 0xc7, 0x50, 0xe7, 0x92, 0x73, 0xc9, 0xd9, 0x5c, 0x2a,
+    0x31, 0x9b, 0x8a, 0x4f, 0xe6, 0x5f, 0x4e, 0x52, 0xce, 0x1d, 0xe8, 0xab, 0xe4, 0x4c, 0xf3, 0xf3,
+    0x11, 0x19, 0xfd, 0xf1, 0xd1, 0x38, 0x29, 0xfe, 0xf2, 0x5e, 0x2c, 0xe9, 0xc7, 0x46, 0x49, 0x91,
+    0x26, 0x2d, 0x22, 0x14, 0x69, 0x71, 0xf1, 0x11, 0x24, 0x47, 0x8f, 0x1c, 0x31, 0x6a, 0xa4, 0x65,
+    0xb4, 0x68, 0x71, 0x91, 0xa2, 0xc5, 0x44, 0x8a, 0x10, 0x25, 0x42, 0x64, 0xe8, 0x90, 0xd6, 0x10,
+    0xa1, 0x41, 0x84, 0x06, 0x09, 0x22, 0x14, 0x48, 0x10, 0xa0, 0x40, 0x8a, 0x50, 0x40, 0x76, 0xfe,
+    0xd4, 0xf1, 0xd3, 0xa7, 0xca, 0x0f, 0x9f, 0x3e, 0x3c, 0x1f, 0x3d, 0x7b, 0xa8, 0x6b, 0x7a, 0xf2,
+    0xd4, 0xc1, 0x63, 0xe7, 0x0e, 0x9e, 0x3c, 0xe7, 0x1d, 0x3a, 0x79, 0xe8, 0xcc, 0xa9, 0xc3, 0xa6,
+    0x6a, 0x4e, 0x9b, 0x37, 0x72, 0x94, 0xc4, 0x81, 0xc2, 0x71, 0xf3, 0xc6, 0x0d, 0x9b, 0x36, 0x6c,
+    0xd6, 0xb4, 0x59, 0x44, 0xb3, 0x46, 0xc9, 0x88, 0x1a, 0xe9, 0x33, 0xcd, 0x19, 0x34, 0xf6, 0x99,
+    0x32, 0x66, 0x78, 0x33, 0x7d, 0x99, 0x31, 0x64, 0x78, 0x32, 0xfd, 0x98, 0x30, 0x62, 0x78, 0x31,
+    0x7d, 0x98, 0x2f, 0x60, 0x78, 0x30, 0xfd, 0x97, 0x2e, 0x5e, 0x78, 0x2f, 0x7d, 0x97, 0x2d, 0x5c,
+    0x78, 0x2e, 0xfd, 0x96, 0x2c, 0x5a, 0x78, 0x2d, 0x7d, 0x96, 0x2b, 0x58, 0x78, 0x2c, 0xfd, 0x95,
+    0x2a, 0x56, 0x78, 0x2b, 0x7d, 0x15, 0x2a, 0x89, 0x7c, 0x62, 0x4f, 0x45, 0xca, 0x14, 0x7e, 0x4a,
+    0x2f, 0x05, 0x4a, 0x14, 0x3e, 0x4a, 0x0f, 0xc5, 0xc9, 0x13, 0xfe, 0x49, 0xef, 0x84, 0x49, 0x13,
+    0xbe, 0x49, 0xcf, 0x44, 0xc9, 0x12, 0x7e, 0x49, 0xaf, 0x04, 0x49, 0x12, 0x3e, 0x49, 0x8f, 0xc4,
+    0xc8, 0x11, 0xfe, 0x48, 0x6f, 0x84, 0x48, 0x11, 0xbe, 0x48, 0x4f, 0x64, 0x08, 0x22, 0x8f, 0xd8,
+    0x0f, 0x09, 0x22, 0x84, 0x17, 0xd2, 0x07, 0xf9, 0x01, 0x84, 0x07, 0xd2, 0xff, 0xe8, 0xe1, 0x83,
+    0xf7, 0xd1, 0xf7, 0xe0, 0x71, 0xc8, 0x1f, 0xf6, 0x3c, 0x74, 0xec, 0xe0, 0x77, 0xf4, 0x3a, 0x72,
+    0xf4, 0x38, 0x72, 0xdc, 0xc0, 0x51, 0xbd, 0x51, 0xc3, 0x46, 0x0d, 0x19, 0x33, 0x68, 0x3c, 0xc9,
+    0x78, 0x01, 0x23, 0x86, 0xd3, 0x0b, 0x16, 0x2d, 0x5c, 0x34, 0xb1, 0x48, 0xa1, 0x62, 0x45, 0x34,
+    0x85, 0x89, 0x13, 0x28, 0x00, 0x98, 0x18, 0x41, 0xa2, 0x04, 0xd3, 0x08, 0x10, 0x21, 0x44, 0x40,
+    0x41, 0x74, 0xf0, 0xf0, 0xe1, 0xd9, 0x61, 0x83, 0x21, 0x07, 0xe7, 0x06, 0x0c, 0x19, 0x34, 0x2c,
+    0x61, 0x28, 0xb4, 0x70, 0x41, 0xa9, 0x70, 0xb0, 0x02, 0x61, 0x73, 0x30, 0xbc, 0x0b, 0x32, 0xc3,
+    0x60, 0x0a, 0xfa, 0x12, 0x1c, 0x98, 0x7f, 0x95, 0x81, 0x7f, 0x80, 0xde, 0xe4, 0xdf, 0x96, 0x8b,
+    0x77, 0xe9, 0x2d, 0x9d, 0xd5, 0xde, 0x73, 0xb6, 0xcf, 0xf6, 0x43, 0xf6, 0x4d, 0xd8, 0xe3, 0x3b,
+    0x4e, 0xc0, 0xcb, 0xd3, 0x33, 0xe2, 0xd9, 0x49, 0xdd, 0xc9, 0x76, 0x74, 0xd1, 0xba, 0x98, 0x4e,
+    0x6e, 0x6d, 0xee, 0xcb, 0x49, 0xc0, 0xd6, 0x70, 0xd7, 0x38, 0x09, 0x66, 0x11, 0xb8, 0xde, 0xdc,
+    0x22, 0x50, 0x9d, 0x6e, 0x68, 0xd5, 0xb3, 0x32, 0x34, 0xeb, 0x99, 0x99, 0xd5, 0xec, 0x41, 0x19,
+    0xd9, 0x03, 0x32, 0xb1, 0x31, 0xa8, 0x58, 0x18, 0x97, 0x03, 0x06, 0x5a, 0x61, 0x49, 0xea, 0x55,
+    0xec, 0xa0, 0x19, 0x05, 0xbb, 0x6a, 0xf0, 0xc5, 0xc0, 0xeb, 0xcb, 0xab, 0x6b, 0x41, 0xd7, 0xd5,
+    0x96, 0x82, 0xb9, 0xc3, 0x96, 0x16, 0x56, 0x16, 0x56, 0x95, 0x24, 0x04, 0x55, 0x08, 0x0e, 0x54,
+    0x45, 0x01, 0x38, 0xf0, 0xa7, 0x0c, 0x28, 0x29, 0x20, 0x7d, 0x52, 0x4d, 0xa7, 0xa4, 0x9c, 0xd3,
+    0xa8, 0x28, 0x02, 0x50, 0x4a, 0x40, 0x9e, 0x88, 0x08, 0x90, 0x42, 0x03, 0xfc, 0xa8, 0xd3, 0xb7,
+    0xd3, 0xc4, 0xaf, 0xa9, 0x55, 0xb9, 0xe8, 0x2b, 0x00, 0xd0, 0x67, 0xd3, 0xb9, 0x6c, 0xb0, 0xf4,
+    0x99, 0xa8, 0x60, 0x91, 0xac, 0xac, 0xc6, 0xaa, 0x64, 0x64, 0xdf, 0x1f, 0xcd, 0xbf, 0x61, 0xf9,
+    0x0c, 0x18, 0x78, 0x53, 0xfb, 0x02, 0xbd, 0x7f, 0x5b, 0xc0, 0x28, 0x38, 0xfc, 0xaf, 0xc5, 0xde,
+    0xe5, 0xe2, 0x76, 0xdd, 0x36, 0xae, 0xd7, 0x56, 0xeb, 0x77, 0x67, 0xb5, 0x61, 0x59, 0xdb, 0xcf,
+    0x30, 0x91, 0xad, 0x67, 0x97, 0xa7, 0x37, 0x4b, 0xf1, 0xf2, 0x62, 0x2c, 0xea, 0xc7, 0x93, 0xb1,
+    0x77, 0x75, 0x58, 0xba, 0x3a, 0x6e, 0x1c, 0x89, 0xac, 0xa8, 0xc4, 0x65, 0xfc, 0x41, 0x43, 0x1a,
+    0x04, 0x41, 0xd0, 0x02, 0xe3, 0xa9, 0x09, 0x43, 0xb4, 0x24, 0xa5, 0x70, 0x07, 0x84, 0xcb, 0xa2,
+    0x83, 0x80, 0xcf, 0x60, 0x50, 0x84, 0x0b, 0x00, 0x32, 0x00, 0xa0, 0x00, 0x30, 0x22, 0x92, 0x14,
+    0x49, 0x01, 0x13, 0x03, 0xfd, 0x69, 0x24, 0x56, 0xe0, 0x0f, 0x27, 0xd5, 0x43, 0x72, 0x7c, 0xfc,
+    0x1a, 0x92, 0x55, 0x0f, 0x3e, 0xf3, 0x11, 0x18, 0x92, 0x8b, 0x7f, 0xd9, 0x5e, 0x3d, 0xa2, 0x5e,
+    0x0e, 0xee, 0x47, 0xfb, 0x5a, 0x2e, 0xd3, 0xcf, 0xb8, 0x9f, 0x6d, 0xdc, 0x6e, 0x00, 0x2b, 0xc2,
+    0xf0, 0xd0, 0xe5, 0x46, 0xc8, 0xa7, 0x67, 0xfc, 0x1b, 0xad, 0x4f, 0x4c, 0xc8, 0x0a, 0x44, 0x38,
+    0xac, 0x1e, 0x58, 0x0c, 0x96, 0x35, 0x1c, 0x37, 0xc0, 0x8e, 0xac, 0xa1, 0x37, 0xa5, 0xee, 0xc0,
+    0x41, 0x55, 0xe6, 0x85, 0xb8, 0x27, 0xfe, 0x7d, 0xdb, 0x01, 0xbd, 0x10, 0x2f, 0xed, 0x67, 0x00,
+    0xdb, 0xce, 0x4f, 0x1a, 0x94, 0xe4, 0xf4, 0xe9, 0xf0, 0x30, 0xdc, 0xe0, 0xeb, 0x57, 0xea, 0x02,
+    0x2d, 0x94, 0x31, 0x6e, 0xe6, 0xe6, 0x2a, 0x66, 0xdb, 0x6a, 0xf7, 0xeb, 0x36, 0xcf, 0x80, 0x7d,
+    0x75, 0x92, 0x98, 0x41, 0xe4, 0xd3, 0x41, 0xc9, 0x4a, 0xb5, 0xd5, 0xed, 0x54, 0xf7, 0xb2, 0xbf,
+    0x8a, 0xc3, 0xdc, 0xec, 0xf6, 0xa5, 0x89, 0x04, 0x0c, 0x21, 0xc4, 0x39, 0x64, 0xc0, 0x34, 0x0c,
+    0x62, 0x65, 0x25, 0x80, 0x55, 0xcd, 0xd2, 0x21, 0xeb, 0x06, 0x74, 0xa5, 0x00, 0x81, 0xfe, 0x21,
+    0x93, 0x26, 0x4c, 0xc1, 0x21, 0x52, 0x56, 0x02, 0x58, 0xd5, 0xac, 0x1c, 0xb2, 0x6c, 0x42, 0x47,
+    0x1a, 0x50, 0x68, 0x3f, 0x34, 0x68, 0xc2, 0x28, 0x1c, 0x22, 0xd5, 0x24, 0x00, 0xd5, 0xda, 0xc2,
+    0x23, 0x31, 0x7a, 0xee, 0xb8, 0xe2, 0x4f, 0x75, 0x8e, 0x16, 0x7c, 0x46, 0x3b, 0xba, 0x64, 0x34,
+    0xbf, 0x3b, 0xb4, 0xd0, 0xbc, 0xa9, 0xd0, 0xf7, 0x1f, 0x28, 0xd0, 0x4d, 0x91, 0xcb, 0x97, 0xcf,
+    0x30, 0x50, 0xa6, 0xa9, 0xe9, 0xf7, 0x27, 0x22, 0x14, 0xef, 0x48, 0xe6, 0x6f, 0x03, 0x1f, 0x14,
+    0x76, 0x8e, 0xe6, 0xbb, 0x07, 0x16, 0xca, 0x37, 0x15, 0xfa, 0xfa, 0x03, 0x65, 0x8a, 0x29, 0x7a,
+    0x5c, 0x7f, 0x7e, 0x2c, 0xd1, 0xf8, 0x2c, 0x0e, 0x03, 0x3b, 0xbc, 0x5b, 0x0e, 0x79, 0x30, 0xae,
+    0x95, 0x3b, 0x75, 0x6e, 0x38, 0xf4, 0xa6, 0x82, 0xeb, 0xd8, 0x6b, 0xe0, 0xa9, 0x7b, 0x7a, 0x56,
+    0x0e, 0xf7, 0x55, 0x4c, 0xaf, 0xfb, 0xcf, 0x97, 0xb7, 0x72, 0x95, 0xdb, 0x02, 0xcc, 0x37, 0x05,
+    0x6f, 0x36, 0x80, 0xcb, 0x8e, 0xb9, 0x55, 0x22, 0x01, 0xde, 0x3e, 0x4a, 0x56, 0x49, 0x98, 0x97,
+    0x2a, 0x69, 0xba, 0xc7, 0x1a, 0x3a, 0xe6, 0xb3, 0xa9, 0x9f, 0xd7, 0x55, 0xec, 0xa1, 0xe6, 0x56,
+    0x9e, 0xc3, 0x56, 0x36, 0xc0, 0xec, 0x21, 0xf6, 0x2e, 0x9f, 0xe6, 0x77, 0x87, 0x76, 0x41, 0x65,
+    0x2e, 0x6a, 0x65, 0x7e, 0xd1, 0x8d, 0xfa, 0xe0, 0xf7, 0xff, 0xf5, 0xcc, 0xbe, 0xe2, 0x53, 0x61,
+    0x44, 0x41, 0xf0, 0x46, 0x7f, 0x5d, 0xf1, 0xfd, 0xfc, 0x76, 0x6a, 0x75, 0xa2, 0x2f, 0x3d, 0xe4,
+    0x33, 0x4f, 0xec, 0xcb, 0x35, 0xef, 0x87, 0x76, 0x43, 0x73, 0xf6, 0x1f, 0x8e, 0x0c, 0x98, 0x06,
+    0x14, 0x5e, 0x8b, 0x71, 0x82, 0xf0, 0x4c, 0x2b, 0x0b, 0xf7, 0x9e, 0x46, 0xfd, 0xf5, 0x34, 0x13,
+    0x91, 0x2e, 0x1a, 0x3c, 0xfd, 0x43, 0xdd, 0xda, 0x47, 0x4a, 0x43, 0x7f, 0x94, 0xa1, 0x6d, 0x60,
+    0x83, 0x8c, 0x6d, 0xd1, 0xa2, 0x8a, 0x55, 0x9d, 0x0f, 0x6c, 0xbe, 0xa1, 0xe2, 0x9b, 0xc9, 0xf7,
+    0x96, 0xed, 0xbf, 0xbf, 0xc9, 0x94, 0xb9, 0xa7, 0xd4, 0xe6, 0x15, 0x99, 0xc1, 0x48, 0x93, 0xb8,
+    0xf1, 0x9a, 0xd1, 0x3d, 0x4e, 0xb0, 0x7d, 0x8e, 0x7d, 0x2e, 0xc0, 0x3d, 0x98, 0x98, 0x85, 0xee,
+    0x86, 0x5a, 0xfe, 0x1e, 0xf5, 0xaf, 0xb7, 0x28, 0x8e, 0x76, 0x26, 0x5b, 0x73, 0x0f, 0x7c, 0xe8,
+    0xcb, 0xb0, 0x23, 0xba, 0x7c, 0x70, 0x84, 0xd2, 0xef, 0xf5, 0x5c, 0x67, 0xcc, 0xfb, 0x64, 0x03,
+    0xbe, 0xdb, 0xe8, 0xde, 0xa9, 0xbc, 0x9d, 0x57, 0x9d, 0x4b, 0xe3, 0xd1, 0xe4, 0x0f, 0xd6, 0x9b,
+    0xb7, 0xd3, 0xc7, 0x8d, 0xf1, 0x5f, 0x49, 0x89, 0x39, 0x7b, 0xba, 0xba, 0xe8, 0x6e, 0xa4, 0x08,
+    0x2b, 0xac, 0x5b, 0x0e, 0x72, 0x28, 0x01, 0x76, 0xad, 0x66, 0x4d, 0x1e, 0x46, 0x5e, 0xd7, 0x23,
+    0x3f, 0xc0, 0x30, 0xf1, 0x2b, 0x35, 0xfa, 0xdf, 0x63, 0xd5, 0xc3, 0xb6, 0x98, 0x52, 0xfb, 0xf2,
+    0x35, 0xb7, 0xc3, 0xd8, 0x19, 0x9c, 0xcf, 0x58, 0x32, 0x7a, 0xbc, 0xd1, 0x1a, 0x6e, 0xde, 0x40,
+    0xa7, 0x39, 0x3b, 0x07, 0xbd, 0x49, 0x56, 0x91, 0x98, 0xf7, 0x63, 0xe6, 0xcc, 0xd0, 0x5f, 0xff,
+    0x6f, 0xca, 0x3f, 0x94, 0x1b, 0xa2, 0x62, 0x85, 0x70, 0xdc, 0xe4, 0x5a, 0x9a, 0xed, 0xd6, 0xec,
+    0xed, 0x75, 0x24, 0xf8, 0x71, 0x18, 0xe1, 0x12, 0x2e, 0xb9, 0x50, 0xdb, 0x5b, 0xa0, 0xf5, 0x02,
+    0xa5, 0xd7, 0x32, 0xea, 0xc3, 0x93, 0xec, 0x21, 0x2e, 0x21, 0x8d, 0x0d, 0x33, 0x98, 0x80, 0x5e,
+    0xed, 0xf9, 0x92, 0x2a, 0xbf, 0x8b, 0xdc, 0x3b, 0x2e, 0x7a, 0xe0, 0x2a, 0x9a, 0x3f, 0x62, 0x4f,
+    0xb3, 0xc5, 0xff, 0xf9, 0xe7, 0xbd, 0xc5, 0x24, 0xe2, 0x86, 0xe8, 0x19, 0x8d, 0x82, 0xc5, 0x6b,
+    0xee, 0x75, 0xa8, 0x4f, 0x70, 0xd8, 0xde, 0x7d, 0x12, 0x66, 0xe1, 0xc8, 0xa9, 0x7c, 0xa8, 0x43,
+    0x0e, 0x31, 0x48, 0x06, 0x18, 0x7f, 0xf1, 0xf8, 0x75, 0x0d, 0xaa, 0x31, 0x65, 0xbf, 0x82, 0x4a,
+    0x15, 0xc6, 0x0d, 0x67, 0x19, 0xe3, 0xb6, 0x25, 0x04, 0x84, 0x53, 0x4b, 0xa3, 0x00, 0x76, 0x71,
+    0xdc, 0x96, 0x5f, 0x86, 0x27, 0x48, 0x06, 0x98, 0xb3, 0x86, 0xb8, 0xd0, 0xf5, 0x1f, 0xb5, 0x6e,
+    0xef, 0x62, 0x4b, 0x0f, 0x8c, 0xb6, 0x39, 0xb0, 0xbd, 0x44, 0x19, 0xb5, 0xd1, 0xcc, 0xd8, 0xb2,
+    0xfd, 0xab, 0x4f, 0x39, 0x80, 0x4c, 0x60, 0x86, 0x3b, 0xdb, 0xda, 0x6f, 0x82, 0xaa, 0xdd, 0xb7,
+    0xfd, 0x0f, 0x30, 0x2e, 0xe4, 0xe6, 0xae, 0xfa, 0xf7, 0x68, 0x6c, 0x53, 0x30, 0x60, 0x60, 0xe6,
+    0x82, 0xa7, 0xe6, 0xe0, 0x0c, 0x02, 0x59, 0x29, 0xd9, 0xae, 0xf3, 0x3e, 0xed, 0xa0, 0xc2, 0xf6,
+    0x98, 0x46, 0xd4, 0x54, 0x31, 0xee, 0x4c, 0x57, 0x68, 0x55, 0x15, 0xef, 0x4c, 0x43, 0x6b, 0xaa,
+    0x1e, 0x77, 0x4d, 0xa7, 0x6a, 0xaa, 0x88, 0x77, 0xa6, 0x23, 0xb4, 0xaa, 0x8c, 0xbb, 0xa6, 0x9f,
+    0x2d, 0xa1, 0x52, 0x7d, 0x2e, 0xb9, 0x43, 0x4a, 0x46, 0x54, 0x6b, 0x2f, 0x0e, 0x93, 0x2f, 0x16,
+    0x9c, 0xc3, 0x7d, 0xb8, 0xf1, 0xc0, 0xea, 0xeb, 0x3f, 0xdf, 0x39, 0xeb, 0x11, 0x8d, 0x06, 0xa1,
+    0xdd, 0x74, 0xd0, 0x6e, 0x92, 0x9c, 0x96, 0x7a, 0xfc, 0xb3, 0xfe, 0xea, 0xdc, 0xc7, 0x58, 0x21,
+    0xda, 0xe8, 0xd7, 0x05, 0xf5, 0x6d, 0x06, 0x31, 0x82, 0xfb, 0xe9, 0x9b, 0x88, 0xb6, 0x39, 0xcd,
+    0x87, 0xa8, 0xe1, 0xe3, 0x6a, 0x7f, 0xa6, 0x89, 0x3e, 0x92, 0x72, 0x30, 0xa3, 0x21, 0x6b, 0xbb,
+    0x7a, 0xac, 0x51, 0x13, 0x8d, 0xc7, 0xa9, 0xc0, 0xf7, 0x29, 0xd7, 0x09, 0xaf, 0x8f, 0x0c, 0x6f,
+    0xf9, 0xf7, 0x1e, 0x6d, 0x3d, 0xee, 0xc3, 0x83, 0xbf, 0xa9, 0xa2, 0x3d, 0xb3, 0x78, 0xff, 0xdb,
+    0x1a, 0x3e, 0x43, 0xbc, 0x51, 0xde, 0x1e, 0x06, 0x3a, 0x63, 0xb5, 0xa3, 0x8c, 0x15, 0xfc, 0xfa,
+    0x79, 0x39, 0x5d, 0x36, 0x6a, 0x72, 0xb8, 0x3c, 0x73, 0x92, 0xf3, 0x46, 0x83, 0xbb, 0xff, 0xf5,
+    0xef, 0xa8, 0xb4, 0x67, 0x90, 0xf2, 0x7b, 0xd8, 0x12, 0xa1, 0x39, 0xac, 0x59, 0x41, 0x6e, 0x3b,
+    0x96, 0xa9, 0x42, 0x62, 0xbd, 0x38, 0x38, 0x55, 0xa4, 0x83, 0x50, 0x49, 0x27, 0x59, 0x2a, 0x47,
+    0xc9, 0x20, 0x9e, 0x53, 0xcf, 0x38, 0xda, 0xb7, 0xc1, 0xbd, 0x76, 0xd7, 0x3c, 0x12, 0x7d, 0xa3,
+    0x98, 0xab, 0x07, 0xe6, 0xbf, 0x4e, 0x67, 0x06, 0xcf, 0xa5, 0xbe, 0x30, 0x3c, 0x48, 0xac, 0xa3,
+    0x4d, 0x1c, 0x3a, 0x02, 0x28, 0x1c, 0x98, 0x51, 0x7d, 0x94, 0xad, 0xb8, 0x2c, 0x8f, 0x13, 0x5e,
+    0xe9, 0xc6, 0x07, 0x60, 0x6a, 0xef, 0x55, 0xda, 0xe1, 0x06, 0x3e, 0x94, 0xa6, 0xcf, 0xaf, 0xb7,
+    0x57, 0xfa, 0x79, 0xc7, 0x06, 0x57, 0x84, 0xa2, 0x33, 0x83, 0xa7, 0xf2, 0x27, 0x2a, 0x37, 0xf3,
+    0x5b, 0x7e, 0x8b, 0xb9, 0x09, 0x5e, 0xe2, 0xca, 0xf8, 0x78, 0x27, 0x95, 0x93, 0xd4, 0x57, 0xf5,
+    0xbc, 0xde, 0x5c, 0x74, 0xf9, 0x13, 0xb8, 0x37, 0x23, 0xac, 0xe1, 0x08, 0x2c, 0x2a, 0xef, 0xc2,
+    0xb0, 0x1f, 0x86, 0x7c, 0xbd, 0x9a, 0x7b, 0xe2, 0xfa, 0xdb, 0xb7, 0xa4, 0x77, 0xec, 0xbc, 0x03,
+    0x3f, 0x84, 0x66, 0x24, 0x13, 0x13, 0x8e, 0x73, 0x1e, 0xa3, 0x5c, 0xb7, 0x9d, 0xdf, 0x57, 0x1e,
+    0xbf, 0xf0, 0xe8, 0x85, 0xed, 0xf3, 0xb1, 0xee, 0x35, 0x7c, 0x56, 0xdf, 0x73, 0x0c, 0x6a, 0x42,
+    0xb2, 0x75, 0xb5, 0x5d, 0x80, 0x65, 0xde, 0xe1, 0xd0, 0xd3, 0x61, 0x4f, 0x7a, 0xe2, 0xc6, 0xce,
+    0x17, 0x5d, 0xf6, 0xe2, 0x71, 0x73, 0xd2, 0x65, 0xd0, 0x25, 0x4a, 0x36, 0x6f, 0x89, 0xb6, 0xd6,
+    0x19, 0x3f, 0x84, 0xd9, 0xfe, 0x0c, 0x7c, 0x22, 0xc7, 0xe5, 0xa5, 0xb8, 0x43, 0x6d, 0x38, 0xf7,
+    0x50, 0xa5, 0xda, 0xb2, 0x52, 0xe0, 0x56, 0x8f, 0xfb, 0x1e, 0x30, 0xf7, 0x7f, 0x2a, 0xf8, 0x53,
+    0x2b, 0xb4, 0xc0, 0x1e, 0xec, 0xef, 0xfd, 0xbc, 0xfc, 0x60, 0x5a, 0x8f, 0xd8, 0xd0, 0xe1, 0x31,
+    0xaf, 0x8d, 0x60, 0xc7, 0x77, 0xe9, 0x71, 0xa7, 0x5b, 0x0f, 0xfe, 0x04, 0x89, 0x3f, 0xe1, 0x18,
+    0x09, 0x1f, 0x25, 0x9e, 0xad, 0x2b, 0xc5, 0xdf, 0x90, 0x34, 0x60, 0x45, 0x59, 0xda, 0xf2, 0xe2,
+    0x40, 0x34, 0x21, 0x99, 0x63, 0x4e, 0x2f, 0x5c, 0x7a, 0x3e, 0x3c, 0x5f, 0x31, 0xfd, 0x8f, 0x78,
+    0x38, 0xd7, 0x3e, 0xd3, 0x79, 0x5d, 0xb8, 0xdf, 0x64, 0x53, 0x84, 0x58, 0x27, 0x4d, 0xdb, 0x67,
+    0x93, 0xd2, 0x45, 0x12, 0x6d, 0x35, 0x70, 0x4d, 0x59, 0xca, 0x79, 0x3d, 0x1a, 0x3e, 0xcc, 0xde,
+    0xe9, 0x33, 0xb8, 0x5e, 0xe4, 0x30, 0xc5, 0x7d, 0x6d, 0x1a, 0x39, 0xea, 0xdd, 0xb9, 0x05, 0x51,
+    0xe8, 0x52, 0x8c, 0x9e, 0xf4, 0x41, 0x6e, 0xe9, 0xce, 0x56, 0x51, 0x4d, 0x1b, 0xff, 0xfd, 0x41,
+    0xf9, 0x9d, 0xae, 0x1e, 0x52, 0x77, 0xef, 0x3e, 0x3d, 0x8a, 0x09, 0xc4, 0xaa, 0x3a, 0xf3, 0x19,
+    0xda, 0xaf, 0x10, 0xa7, 0x8c, 0xc6, 0x07, 0x2c, 0x65, 0x31, 0x9e, 0x5e, 0xe4, 0x82, 0x8e, 0xec,
+    0xd8, 0xf2, 0xb0, 0xfa, 0x5f, 0x40, 0x03, 0xcb, 0x9e, 0xd9, 0x9c, 0xbd, 0xb7, 0x52, 0xbf, 0x4b,
+    0x31, 0x1e, 0xd2, 0x30, 0xe9, 0xf6, 0x11, 0x6d, 0x8e, 0x9e, 0x75, 0x42, 0x42, 0xf3, 0x9c, 0x71,
+    0xf8, 0x54, 0x3c, 0xd4, 0xfd, 0x00, 0x97, 0x10, 0x2f, 0xd6, 0x17, 0xf4, 0xa3, 0x37, 0x90, 0x02,
+    0x89, 0xad, 0xcd, 0x67, 0xb2, 0xe7, 0xcc, 0x4e, 0x9b, 0x61, 0xc3, 0x19, 0xac, 0xf0, 0xb8, 0x88,
+    0xa3, 0xd5, 0xea, 0x4e, 0x83, 0xf8, 0xc1, 0x5f, 0xe7, 0x1e, 0x50, 0xfa, 0x16, 0x30, 0x28, 0x15,
+    0x12, 0x64, 0x22, 0x6e, 0x4d, 0x25, 0x12, 0x24, 0x76, 0xc2, 0x28, 0xc6, 0x8f, 0x4e, 0xc4, 0xa8,
+    0xf2, 0x17, 0x60, 0x07, 0xab, 0x21, 0xe2, 0xb0, 0x37, 0x13, 0xed, 0x67, 0xfb, 0xe9, 0x9f, 0x0b,
+    0xc8, 0xb4, 0x83, 0xc8, 0xcd, 0xbc, 0x46, 0x16, 0xf5, 0x7d, 0xef, 0x5a, 0xe3, 0x94, 0x97, 0x37,
+    0x7d, 0x4b, 0x4c, 0x96, 0xd9, 0x00, 0xe0, 0x6a, 0xa6, 0xd5, 0x52, 0xa5, 0x2b, 0x1d, 0x79, 0x22,
+    0xc9, 0x96, 0x86, 0x6a, 0xd1, 0xf9, 0x96, 0x30, 0xf1, 0x7d, 0x91, 0x93, 0xa8, 0x2e, 0xf0, 0x63,
+    0xe5, 0xfc, 0x36, 0xcc, 0xe6, 0x7a, 0x41, 0xf5, 0x43, 0xbc, 0x38, 0x56, 0x9f, 0xa1, 0x98, 0xb4,
+    0x42, 0x69, 0x54, 0xf0, 0x7a, 0x6c, 0x35, 0x14, 0x80, 0x1e, 0xd0, 0xd9, 0x4d, 0x4a, 0x1f, 0xd5,
+    0xc1, 0xb6, 0xa8, 0x8e, 0x8e, 0xe5, 0x5c, 0x0f, 0x28, 0xb6, 0xe1, 0xde, 0x1c, 0xeb, 0x80, 0xf6,
+    0xe8, 0x73, 0xec, 0x7a, 0x23, 0x1b, 0xff, 0x3c, 0xdc, 0xbd, 0xc7, 0x4d, 0x4f, 0x63, 0x86, 0xfa,
+    0x28, 0xe4, 0xd5, 0x77, 0x72, 0x7c, 0xec, 0x94, 0x5e, 0x81, 0x45, 0x9f, 0x71, 0x1d, 0xb7, 0x93,
+    0x0c, 0x53, 0x45, 0xb6, 0x3a, 0xc6, 0x0f, 0x89, 0x8b, 0x2e, 0x0b, 0x91, 0x41, 0x81, 0x57, 0xc5,
+    0x07, 0xe0, 0xc1, 0xe2, 0x0f, 0x72, 0x15, 0x8a, 0x72, 0x1a, 0xcd, 0xb4, 0x10, 0x68, 0xac, 0x7a,
+    0xf3, 0xcb, 0x3f, 0xaa, 0x77, 0xe3, 0xfe, 0xf2, 0xa6, 0x24, 0xe7, 0xbb, 0xc9, 0x96, 0xcc, 0x74,
+    0xe6, 0x9e, 0x0f, 0x77, 0x03, 0xa7, 0x58, 0xbe, 0xd0, 0x18, 0x8e, 0x32, 0xd7, 0xeb, 0xcb, 0xc7,
+    0x68, 0x4c, 0xfe, 0x4d, 0x32, 0x57, 0xac, 0xdc, 0xf1, 0xae, 0x6d, 0x1b, 0xdf, 0x8d, 0x43, 0x46,
+    0x01, 0x0c, 0x0d, 0x63, 0x4b, 0x09, 0x71, 0x45, 0x35, 0x71, 0xf0, 0x50, 0x49, 0x03, 0x7d, 0xc3,
+    0x2d, 0xb7, 0x03, 0x4d, 0x44, 0x93, 0x1e, 0x92, 0x5c, 0x04, 0x94, 0xe6, 0xaf, 0x8d, 0x85, 0xbd,
+    0x34, 0x95, 0xe9, 0xe7, 0xf2, 0x48, 0x8d, 0xdb, 0xe8, 0xb1, 0x21, 0x93, 0xfb, 0xc1, 0x37, 0x41,
+    0xa9, 0xcb, 0xe0, 0x7f, 0xac, 0xf4, 0x8c, 0x91, 0x9a, 0x8d, 0xb2, 0x9b, 0x6d, 0xc7, 0x0a, 0xfb,
+    0xac, 0x0a, 0x71, 0xb5, 0xb8, 0x9f, 0xa6, 0x73, 0xac, 0x67, 0x8c, 0xea, 0x03, 0xd7, 0x1d, 0x8d,
+    0x04, 0x63, 0x36, 0xf7, 0xba, 0x7c, 0x16, 0x5a, 0x72, 0x67, 0xea, 0x5e, 0x45, 0xc1, 0xb0, 0x8b,
+    0x87, 0x32, 0xba, 0x1e, 0xee, 0x24, 0x7f, 0x1e, 0xca, 0x9e, 0xcb, 0x87, 0x2e, 0xff, 0xb0, 0xb9,
+    0x7c, 0xf0, 0xe4, 0xd0, 0x7b, 0x73, 0xf0, 0x2d, 0x75, 0xf1, 0x40, 0xbc, 0x27, 0xf8, 0xa6, 0xdf,
+    0x53, 0xbb, 0x75, 0x3e, 0x1c, 0x5f, 0xe9, 0x9b, 0xe8, 0x9f, 0x09, 0xd9, 0x7a, 0x75, 0x2e, 0x5c,
+    0x21, 0x0e, 0xb8, 0x8e, 0x11, 0x28, 0x7c, 0x74, 0xb5, 0x89, 0x44, 0x07, 0x91, 0xe3, 0x17, 0x43,
+    0x35, 0x01, 0x20, 0xc8, 0x2c, 0x5d, 0x63, 0x93, 0xcf, 0x7e, 0x1d, 0x24, 0xf7, 0x1c, 0x6c, 0xc2,
+    0x61, 0x9c, 0x19, 0x85, 0xac, 0x38, 0xb0, 0x14, 0xf0, 0x1a, 0xcb, 0xc8, 0xe6, 0xcb, 0xe2, 0xa1,
+    0x1c, 0x4f, 0x2f, 0x52, 0x1a, 0xe0, 0xd0, 0xd0, 0x2c, 0x7a, 0xd0, 0x9a, 0xea, 0x49, 0xeb, 0xa0,
+    0xa4, 0x1f, 0x92, 0x1d, 0xf9, 0xd8, 0xac, 0xf3, 0xe8, 0xda, 0x33, 0x44, 0x1b, 0xf0, 0xe4, 0x2d,
+    0x38, 0xdc, 0xc8, 0xf7, 0xcb, 0x6d, 0xf2, 0x5d, 0xb0, 0x2f, 0xa2, 0x9d, 0xd1, 0xc9, 0xf8, 0xa2,
+    0xf7, 0xf3, 0xf8, 0xe2, 0x8b, 0x81, 0x3e, 0xb8, 0x38, 0x39, 0x96, 0x6b, 0xc2, 0x20, 0x25, 0x77,
+    0xa4, 0x5c, 0x44, 0x60, 0xfa, 0xda, 0xe6, 0x92, 0xb5, 0xfe, 0xe3, 0x36, 0x63, 0xd3, 0x3f, 0x69,
+    0xcd, 0x78, 0xb7, 0xaf, 0x66, 0x10, 0xb8, 0xec, 0x3d, 0xc4, 0xf5, 0x1c, 0xd0, 0xcc, 0x9d, 0xd1,
+    0xb4, 0x61, 0xd6, 0xc1, 0x88, 0xb4, 0xd3, 0xb4, 0x1e, 0x56, 0x44, 0x4d, 0x8b, 0x33, 0x2a, 0x93,
+    0xad, 0xbc, 0x9b, 0x18, 0x62, 0x2a, 0x31, 0xa0, 0xe8, 0xa2, 0xd2, 0xb5, 0xc0, 0x48, 0x24, 0x1c,
+    0x5b, 0xe0, 0x75, 0xdb, 0xcd, 0x3c, 0xfc, 0x60, 0x8c, 0x7d, 0xeb, 0x98, 0xf8, 0x08, 0x73, 0x86,
+    0x19, 0xfe, 0x72, 0x0a, 0x90, 0x4c, 0xf0, 0x0f, 0x0b, 0x7a, 0xdd, 0x34, 0xde, 0x56, 0x9c, 0x9c,
+    0x10, 0x0a, 0xf0, 0x68, 0xd6, 0x2e, 0x9e, 0x13, 0xc5, 0xda, 0x5a, 0xbf, 0xd1, 0xa4, 0x7a, 0xd1,
+    0xde, 0xf1, 0x65, 0x3d, 0xa8, 0xe0, 0x5b, 0x20, 0x6f, 0xbe, 0x03, 0xa5, 0x35, 0xbe, 0x26, 0x09,
+    0xb9, 0x12, 0x83, 0x0f, 0x43, 0x58, 0x5e, 0xd3, 0x07, 0xd9, 0xef, 0xb8, 0x17, 0xb0, 0x79, 0xd2,
+    0x6a, 0x15, 0x61, 0x0d, 0x92, 0x1a, 0xdf, 0x36, 0xfd, 0x52, 0xdb, 0x87, 0x27, 0xc1, 0xfb, 0x4e,
+    0x98, 0x63, 0x66, 0x15, 0x5f, 0xcb, 0x25, 0x5e, 0x01, 0xa7, 0xdc, 0x08, 0xfe, 0x67, 0x78, 0x18,
+    0xc3, 0xd2, 0x7a, 0xa8, 0x17, 0x36, 0xb5, 0x3a, 0x33, 0xc7, 0x5f, 0x7d, 0xa8, 0x08, 0xca, 0x33,
+    0xaf, 0x45, 0x11, 0xba, 0x5c, 0xbd, 0xd3, 0x10, 0xf9, 0x05, 0x73, 0x1a, 0x6f, 0xd1, 0x96, 0x6f,
+    0x4e, 0x4a, 0xd7, 0x13, 0xdd, 0x02, 0x79, 0x44, 0x1c, 0xd0, 0x3d, 0x30, 0x6a, 0x59, 0xfa, 0x54,
+    0xc6, 0x1f, 0xa0, 0x65, 0xc3, 0xfd, 0x37, 0xbd, 0x7a, 0x6e, 0xf7, 0x9a, 0xb0, 0x76, 0x41, 0x70,
+    0x96, 0x77, 0xb5, 0x8b, 0x5d, 0x68, 0x50, 0x27, 0x72, 0xa3, 0xd7, 0x73, 0xd3, 0xa3, 0x2d, 0xbf,
+    0xb7, 0x61, 0x65, 0x9d, 0x46, 0xb7, 0x60, 0x1c, 0xd8, 0xe3, 0x5d, 0x88, 0xaf, 0xfd, 0x6f, 0xe4,
+    0x1d, 0x78, 0xb1, 0x58, 0x60, 0x79, 0xb3, 0xb1, 0xe4, 0x1d, 0x05, 0xee, 0x44, 0xae, 0x0d, 0x3e,
+    0x87, 0xfa, 0x44, 0x74, 0xa8, 0x78, 0x1b, 0x57, 0x27, 0x51, 0x27, 0x1f, 0xf5, 0x29, 0x46, 0x40,
+    0x2b, 0x6b, 0x82, 0x64, 0x13, 0x5e, 0x91, 0xeb, 0x6e, 0xfa, 0x21, 0x8a, 0xc9, 0xd9, 0xd0, 0x88,
+    0x2b, 0x1f, 0x94, 0xcb, 0x4b, 0xf2, 0x1b, 0x26, 0x23, 0xf6, 0xb3, 0xe7, 0x00, 0x40, 0x59, 0xb7,
+    0x34, 0xb2, 0xbd, 0x22, 0x87, 0xfc, 0xb8, 0xf3, 0xe6, 0xe9, 0x5b, 0x36, 0xc6, 0x0d, 0x3f, 0x5d,
+    0x4b, 0x7d, 0xde, 0xc6, 0xc1, 0x67, 0x64, 0xf9, 0x49, 0x2e, 0xff, 0x16, 0x53, 0xb7, 0x14, 0x9e,
+    0x2a, 0x15, 0x4d, 0x94, 0xf1, 0x7f, 0x01, 0xcc, 0xff, 0x6f, 0x01, 0xfa, 0xfa, 0x96, 0x1a, 0x5d,
+    0xb6, 0xa0, 0x48, 0x84, 0x4b, 0xb0, 0xf6, 0x23, 0xfa, 0x61, 0x3f, 0xed, 0x1a, 0xcb, 0x04, 0x07,
+    0x38, 0xd0, 0xe6, 0x74, 0x9f, 0x66, 0x61, 0x63, 0xed, 0x9b, 0x1f, 0x7d, 0xa0, 0x18, 0x92, 0xd6,
+    0x55, 0xf5, 0xe0, 0xf5, 0xa3, 0x80, 0x3b, 0x0e, 0xb6, 0x76, 0x28, 0x3d, 0x46, 0x51, 0x9c, 0x2f,
+    0x50, 0x7a, 0xf5, 0x29, 0x5b, 0xf4, 0xab, 0xc0, 0x30, 0xe6, 0xd9, 0x0d, 0xbe, 0xdd, 0xfb, 0x03,
 };
+const ShaderModule Blob002 = { Blob002_Data, 4960u, 4800u, 2u };
 
-extern const uint32_t Blob040[4808];
-const uint32_t Blob040[4808] = {
-    0x07230203, 0x00010300, 0x0008000b, 0x0000027c, 0x00000000, 0x00020011, 0x00000001, 0x0006000b,
-    0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001,
-    0x0007000f, 0x00000005, 0x00000004, 0x6e69616d, 0x00000000, 0x00000117, 0x00000122, 0x00060010,
-    0x00000004, 0x00000011, 0x00000020, 0x00000001, 0x00000001, 0x00030003, 0x00000002, 0x000001c2,
-    0x000a0004, 0x475f4c47, 0x4c474f4f, 0x70635f45, 0x74735f70, 0x5f656c79, 0x656e696c, 0x7269645f,
-    0x69746365, 0x00006576, 0x00080004, 0x475f4c47, 0x4c474f4f, 0x6e695f45, 0x64756c63, 0x69645f65,
-    0x74636572, 0x00657669, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000, 0x00040005, 0x00000009,
-    0x796c6f50, 0x006e6f67, 0x00060006, 0x00000009, 0x00000000, 0x73726946, 0x70535874, 0x00006e61,
-    0x00050006, 0x00000009, 0x00000001, 0x706f5459, 0x00000000, 0x00050006, 0x00000009, 0x00000002,
-    0x746f4259, 0x00000000, 0x00050006, 0x00000009, 0x00000003, 0x6e694d58, 0x00000000, 0x00050006,
-    0x00000009, 0x00000004, 0x78614d58, 0x00000000, 0x00050006, 0x00000009, 0x00000005, 0x6e694d58,
-    0x00000059, 0x00050006, 0x00000009, 0x00000006, 0x78614d58, 0x00000059, 0x00050006, 0x00000009,
-    0x00000007, 0x69726156, 0x00746e61, 0x00050006, 0x00000009, 0x00000008, 0x72747441, 0x00000000,
-    0x00070006, 0x00000009, 0x00000009, 0x74786554, 0x4c657275, 0x72657961, 0x00000000, 0x00060006,
-    0x00000009, 0x0000000a, 0x69636146, 0x6956676e, 0x00007765, 0x00140005, 0x00000012, 0x506e6942,
-    0x67796c6f, 0x73286e6f, 0x63757274, 0x6f502d74, 0x6f67796c, 0x31692d6e, 0x2d31692d, 0x692d3169,
-    0x31692d31, 0x2d31692d, 0x692d3169, 0x31752d31, 0x2d31662d, 0x3b313175, 0x3b326976, 0x3b326976,
-    0x00000000, 0x00040005, 0x0000000f, 0x796c6f70, 0x006e6f67, 0x00040005, 0x00000010, 0x4c706f74,
-    0x00746665, 0x00050005, 0x00000011, 0x52746f62, 0x74686769, 0x00000000, 0x00060005, 0x0000002a,
-    0x796c6f70, 0x486e6f67, 0x68676965, 0x00000074, 0x00060005, 0x00000030, 0x796c6f70, 0x656e6e49,
-    0x706f5472, 0x00000059, 0x00060005, 0x0000003b, 0x796c6f70, 0x656e6e49, 0x746f4272, 0x00000059,
-    0x00050005, 0x00000045, 0x61705358, 0x7465536e, 0x00007075, 0x00040006, 0x00000045, 0x00000000,
-    0x00003058, 0x00040006, 0x00000045, 0x00000001, 0x00003158, 0x00060006, 0x00000045, 0x00000002,
-    0x69736e49, 0x74536564, 0x00747261, 0x00060006, 0x00000045, 0x00000003, 0x69736e49, 0x6e456564,
-    0x00000064, 0x00060006, 0x00000045, 0x00000004, 0x65676445, 0x4c766f43, 0x00000000, 0x00060006,
-    0x00000045, 0x00000005, 0x65676445, 0x52766f43, 0x00000000, 0x00050006, 0x00000045, 0x00000006,
-    0x63655258, 0x00007069, 0x00050006, 0x00000045, 0x00000007, 0x67616c46, 0x00000073, 0x00040006,
-    0x00000045, 0x00000008, 0x0000305a, 0x00040006, 0x00000045, 0x00000009, 0x0000315a, 0x00040006,
-    0x00000045, 0x0000000a, 0x00003057, 0x00040006, 0x00000045, 0x0000000b, 0x00003157, 0x00050006,
-    0x00000045, 0x0000000c, 0x6f6c6f43, 0x00305272, 0x00050006, 0x00000045, 0x0000000d, 0x6f6c6f43,
-    0x00304772, 0x00050006, 0x00000045, 0x0000000e, 0x6f6c6f43, 0x00304272, 0x00050006, 0x00000045,
-    0x0000000f, 0x6f6c6f43, 0x00315272, 0x00050006, 0x00000045, 0x00000010, 0x6f6c6f43, 0x00314772,
-    0x00050006, 0x00000045, 0x00000011, 0x6f6c6f43, 0x00314272, 0x00060006, 0x00000045, 0x00000012,
-    0x63786554, 0x64726f6f, 0x00003055, 0x00060006, 0x00000045, 0x00000013, 0x63786554, 0x64726f6f,
-    0x00003056, 0x00060006, 0x00000045, 0x00000014, 0x63786554, 0x64726f6f, 0x00003155, 0x00060006,
-    0x00000045, 0x00000015, 0x63786554, 0x64726f6f, 0x00003156, 0x00060006, 0x00000045, 0x00000016,
-    0x4c766f43, 0x74696e49, 0x006c6169, 0x00060006, 0x00000045, 0x00000017, 0x52766f43, 0x74696e49,
-    0x006c6169, 0x00050005, 0x00000047, 0x61707378, 0x706f546e, 0x00000000, 0x00050005, 0x00000048,
-    0x61705358, 0x7465536e, 0x00007075, 0x00040006, 0x00000048, 0x00000000, 0x00003058, 0x00040006,
-    0x00000048, 0x00000001, 0x00003158, 0x00060006, 0x00000048, 0x00000002, 0x69736e49, 0x74536564,
-    0x00747261, 0x00060006, 0x00000048, 0x00000003, 0x69736e49, 0x6e456564, 0x00000064, 0x00060006,
-    0x00000048, 0x00000004, 0x65676445, 0x4c766f43, 0x00000000, 0x00060006, 0x00000048, 0x00000005,
-    0x65676445, 0x52766f43, 0x00000000, 0x00050006, 0x00000048, 0x00000006, 0x63655258, 0x00007069,
-    0x00050006, 0x00000048, 0x00000007, 0x67616c46, 0x00000073, 0x00040006, 0x00000048, 0x00000008,
-    0x0000305a, 0x00040006, 0x00000048, 0x00000009, 0x0000315a, 0x00040006, 0x00000048, 0x0000000a,
-    0x00003057, 0x00040006, 0x00000048, 0x0000000b, 0x00003157, 0x00050006, 0x00000048, 0x0000000c,
-    0x6f6c6f43, 0x00305272, 0x00050006, 0x00000048, 0x0000000d, 0x6f6c6f43, 0x00304772, 0x00050006,
-    0x00000048, 0x0000000e, 0x6f6c6f43, 0x00304272, 0x00050006, 0x00000048, 0x0000000f, 0x6f6c6f43,
-    0x00315272, 0x00050006, 0x00000048, 0x00000010, 0x6f6c6f43, 0x00314772, 0x00050006, 0x00000048,
-    0x00000011, 0x6f6c6f43, 0x00314272, 0x00060006, 0x00000048, 0x00000012, 0x63786554, 0x64726f6f,
-    0x00003055, 0x00060006, 0x00000048, 0x00000013, 0x63786554, 0x64726f6f, 0x00003056, 0x00060006,
-    0x00000048, 0x00000014, 0x63786554, 0x64726f6f, 0x00003155, 0x00060006, 0x00000048, 0x00000015,
-    0x63786554, 0x64726f6f, 0x00003156, 0x00060006, 0x00000048, 0x00000016, 0x4c766f43, 0x74696e49,
-    0x006c6169, 0x00060006, 0x00000048, 0x00000017, 0x52766f43, 0x74696e49, 0x006c6169, 0x00070005,
-    0x0000004a, 0x61705358, 0x7465536e, 0x42737075, 0x65666675, 0x00000072, 0x00060006, 0x0000004a,
-    0x00000000, 0x61705358, 0x7465536e, 0x00737075, 0x00030005, 0x0000004c, 0x00000000, 0x00050005,
-    0x0000009a, 0x61707378, 0x746f426e, 0x00000000, 0x00040005, 0x000000e0, 0x586e696d, 0x0000004c,
-    0x00040005, 0x00000100, 0x5878616d, 0x00000052, 0x00050005, 0x00000114, 0x756f7267, 0x78644970,
-    0x00000000, 0x00060005, 0x00000117, 0x575f6c67, 0x476b726f, 0x70756f72, 0x00004449, 0x00050005,
-    0x0000011c, 0x72616f63, 0x69546573, 0x0000656c, 0x00050005, 0x00000121, 0x61636f6c, 0x7864496c,
-    0x00000000, 0x00080005, 0x00000122, 0x4c5f6c67, 0x6c61636f, 0x6f766e49, 0x69746163, 0x6e496e6f,
-    0x00786564, 0x00070005, 0x0000012a, 0x6772656d, 0x614d6465, 0x68536b73, 0x64657261, 0x00000000,
-    0x00060005, 0x0000012d, 0x61636f6c, 0x6c6f506c, 0x6e6f6779, 0x00786449, 0x00050005, 0x00000133,
-    0x796c6f70, 0x496e6f67, 0x00007864, 0x00060005, 0x00000134, 0x68737550, 0x736e6f43, 0x746e6174,
-    0x00000073, 0x00060006, 0x00000134, 0x00000000, 0x56727543, 0x61697261, 0x0000746e, 0x00060006,
-    0x00000134, 0x00000001, 0x57786554, 0x68746469, 0x00000000, 0x00060006, 0x00000134, 0x00000002,
-    0x48786554, 0x68676965, 0x00000074, 0x00060006, 0x00000134, 0x00000003, 0x57786554, 0x53706172,
-    0x00000000, 0x00060006, 0x00000134, 0x00000004, 0x57786554, 0x54706172, 0x00000000, 0x00070006,
-    0x00000134, 0x00000005, 0x49786554, 0x70614373, 0x65727574, 0x00000000, 0x00070006, 0x00000134,
-    0x00000006, 0x74706143, 0x59657275, 0x7366664f, 0x00007465, 0x00050006, 0x00000134, 0x00000007,
-    0x6461705f, 0x00000000, 0x00030005, 0x00000136, 0x00006370, 0x00060005, 0x0000013d, 0x72616f63,
-    0x6f546573, 0x66654c70, 0x00000074, 0x00060005, 0x00000143, 0x72616f63, 0x6f426573, 0x67695274,
-    0x00007468, 0x00040005, 0x0000014a, 0x6e6e6962, 0x00006465, 0x00050005, 0x0000015d, 0x6174654d,
-    0x66696e55, 0x006d726f, 0x00060006, 0x0000015d, 0x00000000, 0x506d754e, 0x67796c6f, 0x00736e6f,
-    0x00060006, 0x0000015d, 0x00000001, 0x566d754e, 0x61697261, 0x0073746e, 0x00060006, 0x0000015d,
-    0x00000002, 0x68706c41, 0x66655261, 0x00000000, 0x00050006, 0x0000015d, 0x00000003, 0x70736944,
-    0x00746e43, 0x00060006, 0x0000015d, 0x00000004, 0x6e6f6f54, 0x6c626154, 0x00000065, 0x00060006,
-    0x0000015d, 0x00000005, 0x61656c43, 0x6c6f4372, 0x0000726f, 0x00060006, 0x0000015d, 0x00000006,
-    0x61656c43, 0x70654472, 0x00006874, 0x00060006, 0x0000015d, 0x00000007, 0x61656c43, 0x74744172,
-    0x00000072, 0x00060006, 0x0000015d, 0x00000008, 0x4f676f46, 0x65736666, 0x00000074, 0x00060006,
-    0x0000015d, 0x00000009, 0x53676f46, 0x74666968, 0x00000000, 0x00060006, 0x0000015d, 0x0000000a,
-    0x43676f46, 0x726f6c6f, 0x00000000, 0x00080006, 0x0000015d, 0x0000000b, 0x61656c43, 0x74694272,
-    0x4f70616d, 0x65736666, 0x00000074, 0x00030005, 0x0000015f, 0x00000000, 0x00040005, 0x00000167,
-    0x796c6f50, 0x006e6f67, 0x00060006, 0x00000167, 0x00000000, 0x73726946, 0x70535874, 0x00006e61,
-    0x00050006, 0x00000167, 0x00000001, 0x706f5459, 0x00000000, 0x00050006, 0x00000167, 0x00000002,
-    0x746f4259, 0x00000000, 0x00050006, 0x00000167, 0x00000003, 0x6e694d58, 0x00000000, 0x00050006,
-    0x00000167, 0x00000004, 0x78614d58, 0x00000000, 0x00050006, 0x00000167, 0x00000005, 0x6e694d58,
-    0x00000059, 0x00050006, 0x00000167, 0x00000006, 0x78614d58, 0x00000059, 0x00050006, 0x00000167,
-    0x00000007, 0x69726156, 0x00746e61, 0x00050006, 0x00000167, 0x00000008, 0x72747441, 0x00000000,
-    0x00070006, 0x00000167, 0x00000009, 0x74786554, 0x4c657275, 0x72657961, 0x00000000, 0x00060006,
-    0x00000167, 0x0000000a, 0x69636146, 0x6956676e, 0x00007765, 0x00060005, 0x00000169, 0x796c6f50,
-    0x426e6f67, 0x65666675, 0x00000072, 0x00060006, 0x00000169, 0x00000000, 0x796c6f50, 0x736e6f67,
-    0x00000000, 0x00030005, 0x0000016b, 0x00000000, 0x00040005, 0x0000016d, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000188, 0x61726170, 0x0000006d, 0x00040005, 0x0000018a, 0x61726170, 0x0000006d,
-    0x00050005, 0x00000193, 0x6772656d, 0x614d6465, 0x00006b73, 0x00050005, 0x00000195, 0x656e6966,
-    0x656c6954, 0x00000000, 0x00060005, 0x0000019b, 0x656e6966, 0x656c6954, 0x4c706f54, 0x00746665,
-    0x00070005, 0x000001a1, 0x656e6966, 0x656c6954, 0x52746f42, 0x74686769, 0x00000000, 0x00050005,
-    0x000001a5, 0x6e6e6962, 0x614d6465, 0x00006b73, 0x00030005, 0x000001ad, 0x00746962, 0x00050005,
-    0x000001b5, 0x796c6f70, 0x496e6f67, 0x00007864, 0x00040005, 0x000001bf, 0x61726170, 0x0000006d,
-    0x00040005, 0x000001d8, 0x61726170, 0x0000006d, 0x00040005, 0x000001da, 0x61726170, 0x0000006d,
-    0x00050005, 0x000001e3, 0x656e696c, 0x69547261, 0x0000656c, 0x00050005, 0x000001e8, 0x65726353,
-    0x69576e65, 0x00687464, 0x00060005, 0x000001e9, 0x656c6954, 0x72655073, 0x656e694c, 0x00000000,
-    0x00050005, 0x000001f5, 0x6b726f77, 0x7366664f, 0x00007465, 0x00060005, 0x000001ff, 0x526e6942,
-    0x6c757365, 0x66754274, 0x00726566, 0x00080006, 0x000001ff, 0x00000000, 0x69726156, 0x57746e61,
-    0x436b726f, 0x746e756f, 0x00000000, 0x00080006, 0x000001ff, 0x00000001, 0x74726f53, 0x6f576465,
-    0x664f6b72, 0x74657366, 0x00000000, 0x00090006, 0x000001ff, 0x00000002, 0x69726156, 0x57746e61,
-    0x526b726f, 0x436c6165, 0x746e756f, 0x00000000, 0x00080006, 0x000001ff, 0x00000003, 0x74726f53,
-    0x6b726f57, 0x6b726f57, 0x6e756f43, 0x00000074, 0x00090006, 0x000001ff, 0x00000004, 0x6e6e6942,
-    0x4d676e69, 0x416b7361, 0x664f646e, 0x74657366, 0x00000000, 0x00030005, 0x00000201, 0x00000000,
-    0x00060005, 0x00000209, 0x65726353, 0x65486e65, 0x74686769, 0x00000000, 0x00050005, 0x0000020a,
-    0x656c6954, 0x656e694c, 0x00000073, 0x00070005, 0x0000020d, 0x6e6e6942, 0x4d676e69, 0x536b7361,
-    0x74726174, 0x00000000, 0x00060005, 0x00000215, 0x72616f63, 0x614d6573, 0x64496b73, 0x00000078,
-    0x00080005, 0x0000022d, 0x6e6e6942, 0x57676e69, 0x4f6b726f, 0x65736666, 0x74537374, 0x00747261,
-    0x00080005, 0x00000235, 0x656c6974, 0x69736f50, 0x6e6f6974, 0x626d6f43, 0x64656e69, 0x00000000,
-    0x00030005, 0x0000023c, 0x00786469, 0x00030005, 0x00000244, 0x00746962, 0x00050005, 0x0000024c,
-    0x796c6f70, 0x496e6f67, 0x00007864, 0x00050005, 0x00000255, 0x69726176, 0x49746e61, 0x00007864,
-    0x00060005, 0x0000025a, 0x61566e69, 0x6e616972, 0x66664f74, 0x00746573, 0x00060005, 0x00000260,
-    0x6b726f57, 0x63736544, 0x66667542, 0x00007265, 0x00060006, 0x00000260, 0x00000000, 0x6b726f57,
-    0x63736544, 0x00000073, 0x00030005, 0x00000262, 0x00000000, 0x00060005, 0x00000272, 0x5778614d,
-    0x546b726f, 0x73656c69, 0x00000000, 0x00070005, 0x00000273, 0x6d617246, 0x66756265, 0x53726566,
-    0x64697274, 0x00000065, 0x00080005, 0x00000279, 0x6b726f57, 0x63736544, 0x726f5373, 0x53646574,
-    0x74726174, 0x00000000, 0x00050048, 0x00000048, 0x00000000, 0x00000023, 0x00000000, 0x00050048,
-    0x00000048, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x00000048, 0x00000002, 0x00000023,
-    0x00000008, 0x00050048, 0x00000048, 0x00000003, 0x00000023, 0x0000000c, 0x00050048, 0x00000048,
-    0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x00000048, 0x00000005, 0x00000023, 0x00000014,
-    0x00050048, 0x00000048, 0x00000006, 0x00000023, 0x00000018, 0x00050048, 0x00000048, 0x00000007,
-    0x00000023, 0x0000001c, 0x00050048, 0x00000048, 0x00000008, 0x00000023, 0x00000020, 0x00050048,
-    0x00000048, 0x00000009, 0x00000023, 0x00000024, 0x00050048, 0x00000048, 0x0000000a, 0x00000023,
-    0x00000028, 0x00050048, 0x00000048, 0x0000000b, 0x00000023, 0x0000002c, 0x00050048, 0x00000048,
-    0x0000000c, 0x00000023, 0x00000030, 0x00050048, 0x00000048, 0x0000000d, 0x00000023, 0x00000034,
-    0x00050048, 0x00000048, 0x0000000e, 0x00000023, 0x00000038, 0x00050048, 0x00000048, 0x0000000f,
-    0x00000023, 0x0000003c, 0x00050048, 0x00000048, 0x00000010, 0x00000023, 0x00000040, 0x00050048,
-    0x00000048, 0x00000011, 0x00000023, 0x00000044, 0x00050048, 0x00000048, 0x00000012, 0x00000023,
-    0x00000048, 0x00050048, 0x00000048, 0x00000013, 0x00000023, 0x0000004c, 0x00050048, 0x00000048,
-    0x00000014, 0x00000023, 0x00000050, 0x00050048, 0x00000048, 0x00000015, 0x00000023, 0x00000054,
-    0x00050048, 0x00000048, 0x00000016, 0x00000023, 0x00000058, 0x00050048, 0x00000048, 0x00000017,
-    0x00000023, 0x0000005c, 0x00040047, 0x00000049, 0x00000006, 0x00000060, 0x00050048, 0x0000004a,
-    0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x0000004a, 0x00000002, 0x00040047, 0x0000004c,
-    0x00000022, 0x00000000, 0x00040047, 0x0000004c, 0x00000021, 0x00000002, 0x00040047, 0x00000117,
-    0x0000000b, 0x0000001a, 0x00040047, 0x00000122, 0x0000000b, 0x0000001d, 0x00050048, 0x00000134,
-    0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000134, 0x00000001, 0x00000023, 0x00000004,
-    0x00050048, 0x00000134, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x00000134, 0x00000003,
-    0x00000023, 0x0000000c, 0x00050048, 0x00000134, 0x00000004, 0x00000023, 0x00000010, 0x00050048,
-    0x00000134, 0x00000005, 0x00000023, 0x00000014, 0x00050048, 0x00000134, 0x00000006, 0x00000023,
-    0x00000018, 0x00050048, 0x00000134, 0x00000007, 0x00000023, 0x0000001c, 0x00030047, 0x00000134,
-    0x00000002, 0x00040047, 0x0000015b, 0x00000006, 0x00000010, 0x00050048, 0x0000015d, 0x00000000,
-    0x00000023, 0x00000000, 0x00050048, 0x0000015d, 0x00000001, 0x00000023, 0x00000004, 0x00050048,
-    0x0000015d, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x0000015d, 0x00000003, 0x00000023,
-    0x0000000c, 0x00050048, 0x0000015d, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x0000015d,
-    0x00000005, 0x00000023, 0x00000230, 0x00050048, 0x0000015d, 0x00000006, 0x00000023, 0x00000234,
-    0x00050048, 0x0000015d, 0x00000007, 0x00000023, 0x00000238, 0x00050048, 0x0000015d, 0x00000008,
-    0x00000023, 0x0000023c, 0x00050048, 0x0000015d, 0x00000009, 0x00000023, 0x00000240, 0x00050048,
-    0x0000015d, 0x0000000a, 0x00000023, 0x00000244, 0x00050048, 0x0000015d, 0x0000000b, 0x00000023,
-    0x00000248, 0x00030047, 0x0000015d, 0x00000002, 0x00040047, 0x0000015f, 0x00000022, 0x00000000,
-    0x00040047, 0x0000015f, 0x00000021, 0x00000000, 0x00050048, 0x00000167, 0x00000000, 0x00000023,
-    0x00000000, 0x00050048, 0x00000167, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x00000167,
-    0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x00000167, 0x00000003, 0x00000023, 0x0000000c,
-    0x00050048, 0x00000167, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x00000167, 0x00000005,
-    0x00000023, 0x00000014, 0x00050048, 0x00000167, 0x00000006, 0x00000023, 0x00000018, 0x00050048,
-    0x00000167, 0x00000007, 0x00000023, 0x0000001c, 0x00050048, 0x00000167, 0x00000008, 0x00000023,
-    0x00000020, 0x00050048, 0x00000167, 0x00000009, 0x00000023, 0x00000024, 0x00050048, 0x00000167,
-    0x0000000a, 0x00000023, 0x00000028, 0x00040047, 0x00000168, 0x00000006, 0x0000002c, 0x00040048,
-    0x00000169, 0x00000000, 0x00000018, 0x00050048, 0x00000169, 0x00000000, 0x00000023, 0x00000000,
-    0x00030047, 0x00000169, 0x00000002, 0x00040047, 0x0000016b, 0x00000022, 0x00000000, 0x00040047,
-    0x0000016b, 0x00000021, 0x00000001, 0x00040047, 0x000001e8, 0x00000001, 0x00000000, 0x00040047,
-    0x000001fb, 0x00000006, 0x00000010, 0x00040047, 0x000001fc, 0x00000006, 0x00000004, 0x00040047,
-    0x000001fd, 0x00000006, 0x00000004, 0x00040047, 0x000001fe, 0x00000006, 0x00000004, 0x00050048,
-    0x000001ff, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x000001ff, 0x00000001, 0x00000023,
-    0x00008000, 0x00050048, 0x000001ff, 0x00000002, 0x00000023, 0x0000a000, 0x00050048, 0x000001ff,
-    0x00000003, 0x00000023, 0x0000c000, 0x00050048, 0x000001ff, 0x00000004, 0x00000023, 0x0000c010,
-    0x00030047, 0x000001ff, 0x00000002, 0x00040047, 0x00000201, 0x00000022, 0x00000000, 0x00040047,
-    0x00000201, 0x00000021, 0x00000008, 0x00040047, 0x00000209, 0x00000001, 0x00000001, 0x00040047,
-    0x0000025f, 0x00000006, 0x00000008, 0x00050048, 0x00000260, 0x00000000, 0x00000023, 0x00000000,
-    0x00030047, 0x00000260, 0x00000002, 0x00040047, 0x00000262, 0x00000022, 0x00000000, 0x00040047,
-    0x00000262, 0x00000021, 0x00000009, 0x00040047, 0x00000272, 0x00000001, 0x00000002, 0x00040047,
-    0x0000027b, 0x0000000b, 0x00000019, 0x00020013, 0x00000002, 0x00030021, 0x00000003, 0x00000002,
-    0x00040015, 0x00000006, 0x00000020, 0x00000001, 0x00040015, 0x00000007, 0x00000020, 0x00000000,
-    0x00030016, 0x00000008, 0x00000020, 0x000d001e, 0x00000009, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000007, 0x00000008, 0x00000007,
-    0x00040020, 0x0000000a, 0x00000007, 0x00000009, 0x00040017, 0x0000000b, 0x00000006, 0x00000002,
-    0x00040020, 0x0000000c, 0x00000007, 0x0000000b, 0x00020014, 0x0000000d, 0x00060021, 0x0000000e,
-    0x0000000d, 0x0000000a, 0x0000000c, 0x0000000c, 0x0004002b, 0x00000006, 0x00000014, 0x00000001,
-    0x00040020, 0x00000015, 0x00000007, 0x00000006, 0x0004002b, 0x00000007, 0x00000018, 0x00000001,
-    0x0004002b, 0x00000006, 0x0000001f, 0x00000002, 0x0003002a, 0x0000000d, 0x00000028, 0x0004002b,
-    0x00000006, 0x00000036, 0x00000000, 0x001a001e, 0x00000045, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000007, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00040020, 0x00000046, 0x00000007,
-    0x00000045, 0x001a001e, 0x00000048, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000007, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x0003001d, 0x00000049, 0x00000048, 0x0003001e, 0x0000004a,
-    0x00000049, 0x00040020, 0x0000004b, 0x0000000c, 0x0000004a, 0x0004003b, 0x0000004b, 0x0000004c,
-    0x0000000c, 0x00040020, 0x00000051, 0x0000000c, 0x00000048, 0x0004002b, 0x00000006, 0x0000005b,
-    0x00000003, 0x0004002b, 0x00000006, 0x0000005e, 0x00000004, 0x0004002b, 0x00000006, 0x00000061,
-    0x00000005, 0x0004002b, 0x00000006, 0x00000064, 0x00000006, 0x0004002b, 0x00000006, 0x00000067,
-    0x00000007, 0x00040020, 0x00000068, 0x00000007, 0x00000007, 0x0004002b, 0x00000006, 0x0000006b,
-    0x00000008, 0x0004002b, 0x00000006, 0x0000006e, 0x00000009, 0x0004002b, 0x00000006, 0x00000071,
-    0x0000000a, 0x0004002b, 0x00000006, 0x00000074, 0x0000000b, 0x0004002b, 0x00000006, 0x00000077,
-    0x0000000c, 0x0004002b, 0x00000006, 0x0000007a, 0x0000000d, 0x0004002b, 0x00000006, 0x0000007d,
-    0x0000000e, 0x0004002b, 0x00000006, 0x00000080, 0x0000000f, 0x0004002b, 0x00000006, 0x00000083,
-    0x00000010, 0x0004002b, 0x00000006, 0x00000086, 0x00000011, 0x0004002b, 0x00000006, 0x00000089,
-    0x00000012, 0x0004002b, 0x00000006, 0x0000008c, 0x00000013, 0x0004002b, 0x00000006, 0x0000008f,
-    0x00000014, 0x0004002b, 0x00000006, 0x00000092, 0x00000015, 0x0004002b, 0x00000006, 0x00000095,
-    0x00000016, 0x0004002b, 0x00000006, 0x00000098, 0x00000017, 0x0004002b, 0x00000007, 0x000000ea,
-    0x00000000, 0x00030029, 0x0000000d, 0x00000111, 0x00040017, 0x00000115, 0x00000007, 0x00000003,
-    0x00040020, 0x00000116, 0x00000001, 0x00000115, 0x0004003b, 0x00000116, 0x00000117, 0x00000001,
-    0x00040020, 0x00000118, 0x00000001, 0x00000007, 0x00040017, 0x0000011d, 0x00000007, 0x00000002,
-    0x0004003b, 0x00000118, 0x00000122, 0x00000001, 0x00040020, 0x00000129, 0x00000004, 0x00000007,
-    0x0004003b, 0x00000129, 0x0000012a, 0x00000004, 0x0004002b, 0x00000007, 0x0000012b, 0x00000002,
-    0x0004002b, 0x00000007, 0x0000012c, 0x00000108, 0x0004002b, 0x00000006, 0x0000012f, 0x00000020,
-    0x000a001e, 0x00000134, 0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00000007,
-    0x00000006, 0x00000007, 0x00040020, 0x00000135, 0x00000009, 0x00000134, 0x0004003b, 0x00000135,
-    0x00000136, 0x00000009, 0x00040020, 0x00000137, 0x00000009, 0x00000007, 0x0004002b, 0x00000006,
-    0x0000013f, 0x00000080, 0x0004002b, 0x00000006, 0x00000140, 0x00000040, 0x0005002c, 0x0000000b,
-    0x00000141, 0x0000013f, 0x00000140, 0x0004002b, 0x00000006, 0x00000145, 0x0000007f, 0x0004002b,
-    0x00000006, 0x00000146, 0x0000003f, 0x0005002c, 0x0000000b, 0x00000147, 0x00000145, 0x00000146,
-    0x00040020, 0x00000149, 0x00000007, 0x0000000d, 0x00040017, 0x00000159, 0x00000007, 0x00000004,
-    0x0004002b, 0x00000007, 0x0000015a, 0x00000022, 0x0004001c, 0x0000015b, 0x00000159, 0x0000015a,
-    0x00040017, 0x0000015c, 0x00000008, 0x00000002, 0x000e001e, 0x0000015d, 0x00000007, 0x00000007,
-    0x00000006, 0x00000007, 0x0000015b, 0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00000007,
-    0x00000007, 0x0000015c, 0x00040020, 0x0000015e, 0x00000002, 0x0000015d, 0x0004003b, 0x0000015e,
-    0x0000015f, 0x00000002, 0x00040020, 0x00000160, 0x00000002, 0x00000007, 0x000d001e, 0x00000167,
-    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000007, 0x00000008, 0x00000007, 0x0003001d, 0x00000168, 0x00000167, 0x0003001e, 0x00000169,
-    0x00000168, 0x00040020, 0x0000016a, 0x0000000c, 0x00000169, 0x0004003b, 0x0000016a, 0x0000016b,
-    0x0000000c, 0x00040020, 0x0000016e, 0x0000000c, 0x00000167, 0x00040020, 0x00000184, 0x00000007,
-    0x00000008, 0x0005002c, 0x0000000b, 0x0000019e, 0x00000083, 0x00000083, 0x0005002c, 0x0000000b,
-    0x000001a3, 0x00000080, 0x00000080, 0x00040032, 0x00000006, 0x000001e8, 0x00000100, 0x00060034,
-    0x00000006, 0x000001e9, 0x00000087, 0x000001e8, 0x00000083, 0x0004002b, 0x00000007, 0x000001fa,
-    0x00000800, 0x0004001c, 0x000001fb, 0x00000159, 0x000001fa, 0x0004001c, 0x000001fc, 0x00000007,
-    0x000001fa, 0x0004001c, 0x000001fd, 0x00000007, 0x000001fa, 0x0003001d, 0x000001fe, 0x00000007,
-    0x0007001e, 0x000001ff, 0x000001fb, 0x000001fc, 0x000001fd, 0x00000159, 0x000001fe, 0x00040020,
-    0x00000200, 0x0000000c, 0x000001ff, 0x0004003b, 0x00000200, 0x00000201, 0x0000000c, 0x0004002b,
-    0x00000007, 0x00000202, 0x00000003, 0x00040020, 0x00000203, 0x0000000c, 0x00000007, 0x00040032,
-    0x00000006, 0x00000209, 0x000000c0, 0x00060034, 0x00000006, 0x0000020a, 0x00000087, 0x00000209,
-    0x00000083, 0x00060034, 0x00000006, 0x0000020b, 0x00000084, 0x000001e9, 0x0000020a, 0x00060034,
-    0x00000006, 0x0000020c, 0x00000084, 0x0000020b, 0x0000001f, 0x00060034, 0x00000006, 0x0000020d,
-    0x00000080, 0x00000036, 0x0000020c, 0x0004002b, 0x00000006, 0x00000223, 0x0000001f, 0x00060034,
-    0x00000006, 0x0000022b, 0x00000084, 0x000001e9, 0x0000020a, 0x00060034, 0x00000006, 0x0000022c,
-    0x00000084, 0x0000022b, 0x00000140, 0x00060034, 0x00000006, 0x0000022d, 0x00000080, 0x0000020d,
-    0x0000022c, 0x00040020, 0x00000257, 0x0000000c, 0x00000006, 0x0003001d, 0x0000025f, 0x0000011d,
-    0x0003001e, 0x00000260, 0x0000025f, 0x00040020, 0x00000261, 0x0000000c, 0x00000260, 0x0004003b,
-    0x00000261, 0x00000262, 0x0000000c, 0x00040020, 0x0000026e, 0x0000000c, 0x0000011d, 0x00040032,
-    0x00000006, 0x00000272, 0x00003000, 0x00060034, 0x00000006, 0x00000273, 0x00000084, 0x000001e8,
-    0x00000209, 0x0004002b, 0x00000006, 0x00000274, 0x00000800, 0x0004002b, 0x00000007, 0x00000275,
-    0x00008000, 0x0004002b, 0x00000007, 0x00000276, 0x00000004, 0x0004002b, 0x00000007, 0x00000277,
-    0x00000008, 0x00060034, 0x00000007, 0x00000278, 0x00000080, 0x00000272, 0x000000ea, 0x00060034,
-    0x00000007, 0x00000279, 0x00000080, 0x000000ea, 0x00000278, 0x0004002b, 0x00000007, 0x0000027a,
-    0x00000020, 0x0006002c, 0x00000115, 0x0000027b, 0x0000027a, 0x00000018, 0x00000018, 0x00050036,
-    0x00000002, 0x00000004, 0x00000000, 0x00000003, 0x000200f8, 0x00000005, 0x0004003b, 0x00000015,
-    0x00000114, 0x00000007, 0x0004003b, 0x0000000c, 0x0000011c, 0x00000007, 0x0004003b, 0x00000015,
-    0x00000121, 0x00000007, 0x0004003b, 0x00000015, 0x0000012d, 0x00000007, 0x0004003b, 0x00000015,
-    0x00000133, 0x00000007, 0x0004003b, 0x0000000c, 0x0000013d, 0x00000007, 0x0004003b, 0x0000000c,
-    0x00000143, 0x00000007, 0x0004003b, 0x00000149, 0x0000014a, 0x00000007, 0x0004003b, 0x0000000a,
-    0x0000016d, 0x00000007, 0x0004003b, 0x0000000c, 0x00000188, 0x00000007, 0x0004003b, 0x0000000c,
-    0x0000018a, 0x00000007, 0x0004003b, 0x00000068, 0x00000193, 0x00000007, 0x0004003b, 0x0000000c,
-    0x00000195, 0x00000007, 0x0004003b, 0x0000000c, 0x0000019b, 0x00000007, 0x0004003b, 0x0000000c,
-    0x000001a1, 0x00000007, 0x0004003b, 0x00000068, 0x000001a5, 0x00000007, 0x0004003b, 0x00000015,
-    0x000001ad, 0x00000007, 0x0004003b, 0x00000015, 0x000001b5, 0x00000007, 0x0004003b, 0x0000000a,
-    0x000001bf, 0x00000007, 0x0004003b, 0x0000000c, 0x000001d8, 0x00000007, 0x0004003b, 0x0000000c,
-    0x000001da, 0x00000007, 0x0004003b, 0x00000015, 0x000001e3, 0x00000007, 0x0004003b, 0x00000068,
-    0x000001f5, 0x00000007, 0x0004003b, 0x00000015, 0x00000215, 0x00000007, 0x0004003b, 0x00000068,
-    0x00000235, 0x00000007, 0x0004003b, 0x00000015, 0x0000023c, 0x00000007, 0x0004003b, 0x00000015,
-    0x00000244, 0x00000007, 0x0004003b, 0x00000015, 0x0000024c, 0x00000007, 0x0004003b, 0x00000015,
-    0x00000255, 0x00000007, 0x0004003b, 0x00000015, 0x0000025a, 0x00000007, 0x00050041, 0x00000118,
-    0x00000119, 0x00000117, 0x000000ea, 0x0004003d, 0x00000007, 0x0000011a, 0x00000119, 0x0004007c,
-    0x00000006, 0x0000011b, 0x0000011a, 0x0003003e, 0x00000114, 0x0000011b, 0x0004003d, 0x00000115,
-    0x0000011e, 0x00000117, 0x0007004f, 0x0000011d, 0x0000011f, 0x0000011e, 0x0000011e, 0x00000001,
-    0x00000002, 0x0004007c, 0x0000000b, 0x00000120, 0x0000011f, 0x0003003e, 0x0000011c, 0x00000120,
-    0x0004003d, 0x00000007, 0x00000123, 0x00000122, 0x0004007c, 0x00000006, 0x00000124, 0x00000123,
-    0x0003003e, 0x00000121, 0x00000124, 0x0004003d, 0x00000006, 0x00000125, 0x00000121, 0x000500aa,
-    0x0000000d, 0x00000126, 0x00000125, 0x00000036, 0x000300f7, 0x00000128, 0x00000000, 0x000400fa,
-    0x00000126, 0x00000127, 0x00000128, 0x000200f8, 0x00000127, 0x0003003e, 0x0000012a, 0x000000ea,
-    0x000200f9, 0x00000128, 0x000200f8, 0x00000128, 0x000400e0, 0x0000012b, 0x0000012b, 0x0000012c,
-    0x0004003d, 0x00000006, 0x0000012e, 0x00000114, 0x00050084, 0x00000006, 0x00000130, 0x0000012e,
-    0x0000012f, 0x0004003d, 0x00000006, 0x00000131, 0x00000121, 0x00050080, 0x00000006, 0x00000132,
-    0x00000130, 0x00000131, 0x0003003e, 0x0000012d, 0x00000132, 0x00050041, 0x00000137, 0x00000138,
-    0x00000136, 0x00000036, 0x0004003d, 0x00000007, 0x00000139, 0x00000138, 0x0004007c, 0x00000006,
-    0x0000013a, 0x00000139, 0x0004003d, 0x00000006, 0x0000013b, 0x0000012d, 0x00050080, 0x00000006,
-    0x0000013c, 0x0000013a, 0x0000013b, 0x0003003e, 0x00000133, 0x0000013c, 0x0004003d, 0x0000000b,
-    0x0000013e, 0x0000011c, 0x00050084, 0x0000000b, 0x00000142, 0x0000013e, 0x00000141, 0x0003003e,
-    0x0000013d, 0x00000142, 0x0004003d, 0x0000000b, 0x00000144, 0x0000013d, 0x00050080, 0x0000000b,
-    0x00000148, 0x00000144, 0x00000147, 0x0003003e, 0x00000143, 0x00000148, 0x0003003e, 0x0000014a,
-    0x00000028, 0x0004003d, 0x00000006, 0x0000014b, 0x00000121, 0x000500b1, 0x0000000d, 0x0000014c,
-    0x0000014b, 0x0000012f, 0x000300f7, 0x0000014e, 0x00000000, 0x000400fa, 0x0000014c, 0x0000014d,
-    0x0000014e, 0x000200f8, 0x0000014d, 0x0004003d, 0x00000006, 0x0000014f, 0x0000012d, 0x00050041,
-    0x00000137, 0x00000150, 0x00000136, 0x00000014, 0x0004003d, 0x00000007, 0x00000151, 0x00000150,
-    0x0004007c, 0x00000006, 0x00000152, 0x00000151, 0x000500b1, 0x0000000d, 0x00000153, 0x0000014f,
-    0x00000152, 0x000200f9, 0x0000014e, 0x000200f8, 0x0000014e, 0x000700f5, 0x0000000d, 0x00000154,
-    0x0000014c, 0x00000128, 0x00000153, 0x0000014d, 0x000300f7, 0x00000156, 0x00000000, 0x000400fa,
-    0x00000154, 0x00000155, 0x00000156, 0x000200f8, 0x00000155, 0x0004003d, 0x00000006, 0x00000157,
-    0x00000133, 0x0004007c, 0x00000007, 0x00000158, 0x00000157, 0x00050041, 0x00000160, 0x00000161,
-    0x0000015f, 0x00000036, 0x0004003d, 0x00000007, 0x00000162, 0x00000161, 0x000500b0, 0x0000000d,
-    0x00000163, 0x00000158, 0x00000162, 0x000200f9, 0x00000156, 0x000200f8, 0x00000156, 0x000700f5,
-    0x0000000d, 0x00000164, 0x00000154, 0x0000014e, 0x00000163, 0x00000155, 0x000300f7, 0x00000166,
-    0x00000000, 0x000400fa, 0x00000164, 0x00000165, 0x00000166, 0x000200f8, 0x00000165, 0x0004003d,
-    0x00000006, 0x0000016c, 0x00000133, 0x00060041, 0x0000016e, 0x0000016f, 0x0000016b, 0x00000036,
-    0x0000016c, 0x0004003d, 0x00000167, 0x00000170, 0x0000016f, 0x00050051, 0x00000006, 0x00000171,
-    0x00000170, 0x00000000, 0x00050041, 0x00000015, 0x00000172, 0x0000016d, 0x00000036, 0x0003003e,
-    0x00000172, 0x00000171, 0x00050051, 0x00000006, 0x00000173, 0x00000170, 0x00000001, 0x00050041,
-    0x00000015, 0x00000174, 0x0000016d, 0x00000014, 0x0003003e, 0x00000174, 0x00000173, 0x00050051,
-    0x00000006, 0x00000175, 0x00000170, 0x00000002, 0x00050041, 0x00000015, 0x00000176, 0x0000016d,
-    0x0000001f, 0x0003003e, 0x00000176, 0x00000175, 0x00050051, 0x00000006, 0x00000177, 0x00000170,
-    0x00000003, 0x00050041, 0x00000015, 0x00000178, 0x0000016d, 0x0000005b, 0x0003003e, 0x00000178,
-    0x00000177, 0x00050051, 0x00000006, 0x00000179, 0x00000170, 0x00000004, 0x00050041, 0x00000015,
-    0x0000017a, 0x0000016d, 0x0000005e, 0x0003003e, 0x0000017a, 0x00000179, 0x00050051, 0x00000006,
-    0x0000017b, 0x00000170, 0x00000005, 0x00050041, 0x00000015, 0x0000017c, 0x0000016d, 0x00000061,
-    0x0003003e, 0x0000017c, 0x0000017b, 0x00050051, 0x00000006, 0x0000017d, 0x00000170, 0x00000006,
-    0x00050041, 0x00000015, 0x0000017e, 0x0000016d, 0x00000064, 0x0003003e, 0x0000017e, 0x0000017d,
-    0x00050051, 0x00000006, 0x0000017f, 0x00000170, 0x00000007, 0x00050041, 0x00000015, 0x00000180,
-    0x0000016d, 0x00000067, 0x0003003e, 0x00000180, 0x0000017f, 0x00050051, 0x00000007, 0x00000181,
-    0x00000170, 0x00000008, 0x00050041, 0x00000068, 0x00000182, 0x0000016d, 0x0000006b, 0x0003003e,
-    0x00000182, 0x00000181, 0x00050051, 0x00000008, 0x00000183, 0x00000170, 0x00000009, 0x00050041,
-    0x00000184, 0x00000185, 0x0000016d, 0x0000006e, 0x0003003e, 0x00000185, 0x00000183, 0x00050051,
-    0x00000007, 0x00000186, 0x00000170, 0x0000000a, 0x00050041, 0x00000068, 0x00000187, 0x0000016d,
-    0x00000071, 0x0003003e, 0x00000187, 0x00000186, 0x0004003d, 0x0000000b, 0x00000189, 0x0000013d,
-    0x0003003e, 0x00000188, 0x00000189, 0x0004003d, 0x0000000b, 0x0000018b, 0x00000143, 0x0003003e,
-    0x0000018a, 0x0000018b, 0x00070039, 0x0000000d, 0x0000018c, 0x00000012, 0x0000016d, 0x00000188,
-    0x0000018a, 0x0003003e, 0x0000014a, 0x0000018c, 0x000200f9, 0x00000166, 0x000200f8, 0x00000166,
-    0x0004003d, 0x0000000d, 0x0000018d, 0x0000014a, 0x000300f7, 0x0000018f, 0x00000000, 0x000400fa,
-    0x0000018d, 0x0000018e, 0x0000018f, 0x000200f8, 0x0000018e, 0x0004003d, 0x00000006, 0x00000190,
-    0x00000121, 0x000500c4, 0x00000007, 0x00000191, 0x00000018, 0x00000190, 0x000700f1, 0x00000007,
-    0x00000192, 0x0000012a, 0x00000018, 0x000000ea, 0x00000191, 0x000200f9, 0x0000018f, 0x000200f8,
-    0x0000018f, 0x000400e0, 0x0000012b, 0x0000012b, 0x0000012c, 0x0004003d, 0x00000007, 0x00000194,
-    0x0000012a, 0x0003003e, 0x00000193, 0x00000194, 0x0004003d, 0x00000006, 0x00000196, 0x00000121,
-    0x000500c7, 0x00000006, 0x00000197, 0x00000196, 0x00000067, 0x0004003d, 0x00000006, 0x00000198,
-    0x00000121, 0x000500c3, 0x00000006, 0x00000199, 0x00000198, 0x0000005b, 0x00050050, 0x0000000b,
-    0x0000019a, 0x00000197, 0x00000199, 0x0003003e, 0x00000195, 0x0000019a, 0x0004003d, 0x0000000b,
-    0x0000019c, 0x0000013d, 0x0004003d, 0x0000000b, 0x0000019d, 0x00000195, 0x00050084, 0x0000000b,
-    0x0000019f, 0x0000019d, 0x0000019e, 0x00050080, 0x0000000b, 0x000001a0, 0x0000019c, 0x0000019f,
-    0x0003003e, 0x0000019b, 0x000001a0, 0x0004003d, 0x0000000b, 0x000001a2, 0x0000019b, 0x00050080,
-    0x0000000b, 0x000001a4, 0x000001a2, 0x000001a3, 0x0003003e, 0x000001a1, 0x000001a4, 0x0003003e,
-    0x000001a5, 0x000000ea, 0x000200f9, 0x000001a6, 0x000200f8, 0x000001a6, 0x000400f6, 0x000001a8,
-    0x000001a9, 0x00000000, 0x000200f9, 0x000001aa, 0x000200f8, 0x000001aa, 0x0004003d, 0x00000007,
-    0x000001ab, 0x00000193, 0x000500ab, 0x0000000d, 0x000001ac, 0x000001ab, 0x000000ea, 0x000400fa,
-    0x000001ac, 0x000001a7, 0x000001a8, 0x000200f8, 0x000001a7, 0x0004003d, 0x00000007, 0x000001ae,
-    0x00000193, 0x0006000c, 0x00000006, 0x000001af, 0x00000001, 0x00000049, 0x000001ae, 0x0003003e,
-    0x000001ad, 0x000001af, 0x0004003d, 0x00000006, 0x000001b0, 0x000001ad, 0x000500c4, 0x00000007,
-    0x000001b1, 0x00000018, 0x000001b0, 0x000400c8, 0x00000007, 0x000001b2, 0x000001b1, 0x0004003d,
-    0x00000007, 0x000001b3, 0x00000193, 0x000500c7, 0x00000007, 0x000001b4, 0x000001b3, 0x000001b2,
-    0x0003003e, 0x00000193, 0x000001b4, 0x00050041, 0x00000137, 0x000001b6, 0x00000136, 0x00000036,
-    0x0004003d, 0x00000007, 0x000001b7, 0x000001b6, 0x0004007c, 0x00000006, 0x000001b8, 0x000001b7,
-    0x0004003d, 0x00000006, 0x000001b9, 0x00000114, 0x00050084, 0x00000006, 0x000001ba, 0x000001b9,
-    0x0000012f, 0x00050080, 0x00000006, 0x000001bb, 0x000001b8, 0x000001ba, 0x0004003d, 0x00000006,
-    0x000001bc, 0x000001ad, 0x00050080, 0x00000006, 0x000001bd, 0x000001bb, 0x000001bc, 0x0003003e,
-    0x000001b5, 0x000001bd, 0x0004003d, 0x00000006, 0x000001be, 0x000001b5, 0x00060041, 0x0000016e,
-    0x000001c0, 0x0000016b, 0x00000036, 0x000001be, 0x0004003d, 0x00000167, 0x000001c1, 0x000001c0,
-    0x00050051, 0x00000006, 0x000001c2, 0x000001c1, 0x00000000, 0x00050041, 0x00000015, 0x000001c3,
-    0x000001bf, 0x00000036, 0x0003003e, 0x000001c3, 0x000001c2, 0x00050051, 0x00000006, 0x000001c4,
-    0x000001c1, 0x00000001, 0x00050041, 0x00000015, 0x000001c5, 0x000001bf, 0x00000014, 0x0003003e,
-    0x000001c5, 0x000001c4, 0x00050051, 0x00000006, 0x000001c6, 0x000001c1, 0x00000002, 0x00050041,
-    0x00000015, 0x000001c7, 0x000001bf, 0x0000001f, 0x0003003e, 0x000001c7, 0x000001c6, 0x00050051,
-    0x00000006, 0x000001c8, 0x000001c1, 0x00000003, 0x00050041, 0x00000015, 0x000001c9, 0x000001bf,
-    0x0000005b, 0x0003003e, 0x000001c9, 0x000001c8, 0x00050051, 0x00000006, 0x000001ca, 0x000001c1,
-    0x00000004, 0x00050041, 0x00000015, 0x000001cb, 0x000001bf, 0x0000005e, 0x0003003e, 0x000001cb,
-    0x000001ca, 0x00050051, 0x00000006, 0x000001cc, 0x000001c1, 0x00000005, 0x00050041, 0x00000015,
-    0x000001cd, 0x000001bf, 0x00000061, 0x0003003e, 0x000001cd, 0x000001cc, 0x00050051, 0x00000006,
-    0x000001ce, 0x000001c1, 0x00000006, 0x00050041, 0x00000015, 0x000001cf, 0x000001bf, 0x00000064,
-    0x0003003e, 0x000001cf, 0x000001ce, 0x00050051, 0x00000006, 0x000001d0, 0x000001c1, 0x00000007,
-    0x00050041, 0x00000015, 0x000001d1, 0x000001bf, 0x00000067, 0x0003003e, 0x000001d1, 0x000001d0,
-    0x00050051, 0x00000007, 0x000001d2, 0x000001c1, 0x00000008, 0x00050041, 0x00000068, 0x000001d3,
-    0x000001bf, 0x0000006b, 0x0003003e, 0x000001d3, 0x000001d2, 0x00050051, 0x00000008, 0x000001d4,
-    0x000001c1, 0x00000009, 0x00050041, 0x00000184, 0x000001d5, 0x000001bf, 0x0000006e, 0x0003003e,
-    0x000001d5, 0x000001d4, 0x00050051, 0x00000007, 0x000001d6, 0x000001c1, 0x0000000a, 0x00050041,
-    0x00000068, 0x000001d7, 0x000001bf, 0x00000071, 0x0003003e, 0x000001d7, 0x000001d6, 0x0004003d,
-    0x0000000b, 0x000001d9, 0x0000019b, 0x0003003e, 0x000001d8, 0x000001d9, 0x0004003d, 0x0000000b,
-    0x000001db, 0x000001a1, 0x0003003e, 0x000001da, 0x000001db, 0x00070039, 0x0000000d, 0x000001dc,
-    0x00000012, 0x000001bf, 0x000001d8, 0x000001da, 0x000300f7, 0x000001de, 0x00000000, 0x000400fa,
-    0x000001dc, 0x000001dd, 0x000001de, 0x000200f8, 0x000001dd, 0x0004003d, 0x00000006, 0x000001df,
-    0x000001ad, 0x000500c4, 0x00000007, 0x000001e0, 0x00000018, 0x000001df, 0x0004003d, 0x00000007,
-    0x000001e1, 0x000001a5, 0x000500c5, 0x00000007, 0x000001e2, 0x000001e1, 0x000001e0, 0x0003003e,
-    0x000001a5, 0x000001e2, 0x000200f9, 0x000001de, 0x000200f8, 0x000001de, 0x000200f9, 0x000001a9,
-    0x000200f8, 0x000001a9, 0x000200f9, 0x000001a6, 0x000200f8, 0x000001a8, 0x00050041, 0x00000015,
-    0x000001e4, 0x00000195, 0x000000ea, 0x0004003d, 0x00000006, 0x000001e5, 0x000001e4, 0x00050041,
-    0x00000015, 0x000001e6, 0x00000195, 0x00000018, 0x0004003d, 0x00000006, 0x000001e7, 0x000001e6,
-    0x00050084, 0x00000006, 0x000001ea, 0x000001e7, 0x000001e9, 0x00050080, 0x00000006, 0x000001eb,
-    0x000001e5, 0x000001ea, 0x00050041, 0x00000015, 0x000001ec, 0x0000011c, 0x000000ea, 0x0004003d,
-    0x00000006, 0x000001ed, 0x000001ec, 0x00050084, 0x00000006, 0x000001ee, 0x000001ed, 0x0000006b,
-    0x00050080, 0x00000006, 0x000001ef, 0x000001eb, 0x000001ee, 0x00050041, 0x00000015, 0x000001f0,
-    0x0000011c, 0x00000018, 0x0004003d, 0x00000006, 0x000001f1, 0x000001f0, 0x00050084, 0x00000006,
-    0x000001f2, 0x000001f1, 0x000001e9, 0x00050084, 0x00000006, 0x000001f3, 0x000001f2, 0x0000005e,
-    0x00050080, 0x00000006, 0x000001f4, 0x000001ef, 0x000001f3, 0x0003003e, 0x000001e3, 0x000001f4,
-    0x0003003e, 0x000001f5, 0x000000ea, 0x0004003d, 0x00000007, 0x000001f6, 0x000001a5, 0x000500ab,
-    0x0000000d, 0x000001f7, 0x000001f6, 0x000000ea, 0x000300f7, 0x000001f9, 0x00000000, 0x000400fa,
-    0x000001f7, 0x000001f8, 0x000001f9, 0x000200f8, 0x000001f8, 0x00070041, 0x00000203, 0x00000204,
-    0x00000201, 0x00000036, 0x00000036, 0x00000202, 0x0004003d, 0x00000007, 0x00000205, 0x000001a5,
-    0x000400cd, 0x00000006, 0x00000206, 0x00000205, 0x0004007c, 0x00000007, 0x00000207, 0x00000206,
-    0x000700ea, 0x00000007, 0x00000208, 0x00000204, 0x00000018, 0x000000ea, 0x00000207, 0x0003003e,
-    0x000001f5, 0x00000208, 0x000200f9, 0x000001f9, 0x000200f8, 0x000001f9, 0x0004003d, 0x00000006,
-    0x0000020e, 0x000001e3, 0x00050084, 0x00000006, 0x0000020f, 0x0000020e, 0x00000140, 0x00050080,
-    0x00000006, 0x00000210, 0x0000020d, 0x0000020f, 0x0004003d, 0x00000006, 0x00000211, 0x00000114,
-    0x00050080, 0x00000006, 0x00000212, 0x00000210, 0x00000211, 0x0004003d, 0x00000007, 0x00000213,
-    0x000001a5, 0x00060041, 0x00000203, 0x00000214, 0x00000201, 0x0000005e, 0x00000212, 0x0003003e,
-    0x00000214, 0x00000213, 0x0004003d, 0x00000006, 0x00000216, 0x000001e3, 0x00050084, 0x00000006,
-    0x00000217, 0x00000216, 0x0000001f, 0x0004003d, 0x00000006, 0x00000218, 0x00000114, 0x000500c3,
-    0x00000006, 0x00000219, 0x00000218, 0x00000061, 0x00050080, 0x00000006, 0x0000021a, 0x00000217,
-    0x00000219, 0x0003003e, 0x00000215, 0x0000021a, 0x0004003d, 0x00000007, 0x0000021b, 0x000001a5,
-    0x000500ab, 0x0000000d, 0x0000021c, 0x0000021b, 0x000000ea, 0x000300f7, 0x0000021e, 0x00000000,
-    0x000400fa, 0x0000021c, 0x0000021d, 0x0000021e, 0x000200f8, 0x0000021d, 0x0004003d, 0x00000006,
-    0x0000021f, 0x00000215, 0x00050080, 0x00000006, 0x00000220, 0x00000036, 0x0000021f, 0x00060041,
-    0x00000203, 0x00000221, 0x00000201, 0x0000005e, 0x00000220, 0x0004003d, 0x00000006, 0x00000222,
-    0x00000114, 0x000500c7, 0x00000006, 0x00000224, 0x00000222, 0x00000223, 0x000500c4, 0x00000007,
-    0x00000225, 0x00000018, 0x00000224, 0x000700f1, 0x00000007, 0x00000226, 0x00000221, 0x00000018,
-    0x000000ea, 0x00000225, 0x000200f9, 0x0000021e, 0x000200f8, 0x0000021e, 0x0004003d, 0x00000007,
-    0x00000227, 0x000001a5, 0x000500ab, 0x0000000d, 0x00000228, 0x00000227, 0x000000ea, 0x000300f7,
-    0x0000022a, 0x00000000, 0x000400fa, 0x00000228, 0x00000229, 0x0000022a, 0x000200f8, 0x00000229,
-    0x0004003d, 0x00000006, 0x0000022e, 0x000001e3, 0x00050084, 0x00000006, 0x0000022f, 0x0000022e,
-    0x00000140, 0x00050080, 0x00000006, 0x00000230, 0x0000022d, 0x0000022f, 0x0004003d, 0x00000006,
-    0x00000231, 0x00000114, 0x00050080, 0x00000006, 0x00000232, 0x00000230, 0x00000231, 0x0004003d,
-    0x00000007, 0x00000233, 0x000001f5, 0x00060041, 0x00000203, 0x00000234, 0x00000201, 0x0000005e,
-    0x00000232, 0x0003003e, 0x00000234, 0x00000233, 0x00050041, 0x00000015, 0x00000236, 0x0000019b,
-    0x000000ea, 0x0004003d, 0x00000006, 0x00000237, 0x00000236, 0x00050041, 0x00000015, 0x00000238,
-    0x0000019b, 0x00000018, 0x0004003d, 0x00000006, 0x00000239, 0x00000238, 0x000700c9, 0x00000006,
-    0x0000023a, 0x00000237, 0x00000239, 0x00000083, 0x00000083, 0x0004007c, 0x00000007, 0x0000023b,
-    0x0000023a, 0x0003003e, 0x00000235, 0x0000023b, 0x0003003e, 0x0000023c, 0x00000036, 0x000200f9,
-    0x0000023d, 0x000200f8, 0x0000023d, 0x000400f6, 0x0000023f, 0x00000240, 0x00000000, 0x000200f9,
-    0x00000241, 0x000200f8, 0x00000241, 0x0004003d, 0x00000007, 0x00000242, 0x000001a5, 0x000500ab,
-    0x0000000d, 0x00000243, 0x00000242, 0x000000ea, 0x000400fa, 0x00000243, 0x0000023e, 0x0000023f,
-    0x000200f8, 0x0000023e, 0x0004003d, 0x00000007, 0x00000245, 0x000001a5, 0x0006000c, 0x00000006,
-    0x00000246, 0x00000001, 0x00000049, 0x00000245, 0x0003003e, 0x00000244, 0x00000246, 0x0004003d,
-    0x00000006, 0x00000247, 0x00000244, 0x000500c4, 0x00000007, 0x00000248, 0x00000018, 0x00000247,
-    0x000400c8, 0x00000007, 0x00000249, 0x00000248, 0x0004003d, 0x00000007, 0x0000024a, 0x000001a5,
-    0x000500c7, 0x00000007, 0x0000024b, 0x0000024a, 0x00000249, 0x0003003e, 0x000001a5, 0x0000024b,
-    0x00050041, 0x00000137, 0x0000024d, 0x00000136, 0x00000036, 0x0004003d, 0x00000007, 0x0000024e,
-    0x0000024d, 0x0004007c, 0x00000006, 0x0000024f, 0x0000024e, 0x0004003d, 0x00000006, 0x00000250,
-    0x00000114, 0x00050084, 0x00000006, 0x00000251, 0x00000250, 0x0000012f, 0x00050080, 0x00000006,
-    0x00000252, 0x0000024f, 0x00000251, 0x0004003d, 0x00000006, 0x00000253, 0x00000244, 0x00050080,
-    0x00000006, 0x00000254, 0x00000252, 0x00000253, 0x0003003e, 0x0000024c, 0x00000254, 0x0004003d,
-    0x00000006, 0x00000256, 0x0000024c, 0x00070041, 0x00000257, 0x00000258, 0x0000016b, 0x00000036,
-    0x00000256, 0x00000067, 0x0004003d, 0x00000006, 0x00000259, 0x00000258, 0x0003003e, 0x00000255,
-    0x00000259, 0x0004003d, 0x00000006, 0x0000025b, 0x00000255, 0x00070041, 0x00000203, 0x0000025c,
-    0x00000201, 0x00000036, 0x0000025b, 0x0000012b, 0x000700ea, 0x00000007, 0x0000025d, 0x0000025c,
-    0x00000018, 0x000000ea, 0x00000018, 0x0004007c, 0x00000006, 0x0000025e, 0x0000025d, 0x0003003e,
-    0x0000025a, 0x0000025e, 0x0004003d, 0x00000007, 0x00000263, 0x000001f5, 0x00050080, 0x00000007,
-    0x00000264, 0x000000ea, 0x00000263, 0x0004003d, 0x00000006, 0x00000265, 0x0000023c, 0x0004007c,
-    0x00000007, 0x00000266, 0x00000265, 0x00050080, 0x00000007, 0x00000267, 0x00000264, 0x00000266,
-    0x0004003d, 0x00000007, 0x00000268, 0x00000235, 0x0004003d, 0x00000006, 0x00000269, 0x0000024c,
-    0x0004003d, 0x00000006, 0x0000026a, 0x0000025a, 0x000700c9, 0x00000006, 0x0000026b, 0x00000269,
-    0x0000026a, 0x00000074, 0x00000092, 0x0004007c, 0x00000007, 0x0000026c, 0x0000026b, 0x00050050,
-    0x0000011d, 0x0000026d, 0x00000268, 0x0000026c, 0x00060041, 0x0000026e, 0x0000026f, 0x00000262,
-    0x00000036, 0x00000267, 0x0003003e, 0x0000026f, 0x0000026d, 0x0004003d, 0x00000006, 0x00000270,
-    0x0000023c, 0x00050080, 0x00000006, 0x00000271, 0x00000270, 0x00000014, 0x0003003e, 0x0000023c,
-    0x00000271, 0x000200f9, 0x00000240, 0x000200f8, 0x00000240, 0x000200f9, 0x0000023d, 0x000200f8,
-    0x0000023f, 0x000200f9, 0x0000022a, 0x000200f8, 0x0000022a, 0x000100fd, 0x00010038, 0x00050036,
-    0x0000000d, 0x00000012, 0x00000000, 0x0000000e, 0x00030037, 0x0000000a, 0x0000000f, 0x00030037,
-    0x0000000c, 0x00000010, 0x00030037, 0x0000000c, 0x00000011, 0x000200f8, 0x00000013, 0x0004003b,
-    0x00000015, 0x0000002a, 0x00000007, 0x0004003b, 0x00000015, 0x00000030, 0x00000007, 0x0004003b,
-    0x00000015, 0x0000003b, 0x00000007, 0x0004003b, 0x00000046, 0x00000047, 0x00000007, 0x0004003b,
-    0x00000046, 0x0000009a, 0x00000007, 0x0004003b, 0x00000015, 0x000000e0, 0x00000007, 0x0004003b,
-    0x00000015, 0x00000100, 0x00000007, 0x00050041, 0x00000015, 0x00000016, 0x0000000f, 0x00000014,
-    0x0004003d, 0x00000006, 0x00000017, 0x00000016, 0x00050041, 0x00000015, 0x00000019, 0x00000011,
-    0x00000018, 0x0004003d, 0x00000006, 0x0000001a, 0x00000019, 0x000500ad, 0x0000000d, 0x0000001b,
-    0x00000017, 0x0000001a, 0x000400a8, 0x0000000d, 0x0000001c, 0x0000001b, 0x000300f7, 0x0000001e,
-    0x00000000, 0x000400fa, 0x0000001c, 0x0000001d, 0x0000001e, 0x000200f8, 0x0000001d, 0x00050041,
-    0x00000015, 0x00000020, 0x0000000f, 0x0000001f, 0x0004003d, 0x00000006, 0x00000021, 0x00000020,
-    0x00050041, 0x00000015, 0x00000022, 0x00000010, 0x00000018, 0x0004003d, 0x00000006, 0x00000023,
-    0x00000022, 0x000500b3, 0x0000000d, 0x00000024, 0x00000021, 0x00000023, 0x000200f9, 0x0000001e,
-    0x000200f8, 0x0000001e, 0x000700f5, 0x0000000d, 0x00000025, 0x0000001b, 0x00000013, 0x00000024,
-    0x0000001d, 0x000300f7, 0x00000027, 0x00000000, 0x000400fa, 0x00000025, 0x00000026, 0x00000027,
-    0x000200f8, 0x00000026, 0x000200fe, 0x00000028, 0x000200f8, 0x00000027, 0x00050041, 0x00000015,
-    0x0000002b, 0x0000000f, 0x0000001f, 0x0004003d, 0x00000006, 0x0000002c, 0x0000002b, 0x00050041,
-    0x00000015, 0x0000002d, 0x0000000f, 0x00000014, 0x0004003d, 0x00000006, 0x0000002e, 0x0000002d,
-    0x00050082, 0x00000006, 0x0000002f, 0x0000002c, 0x0000002e, 0x0003003e, 0x0000002a, 0x0000002f,
-    0x00050041, 0x00000015, 0x00000031, 0x00000010, 0x00000018, 0x0004003d, 0x00000006, 0x00000032,
-    0x00000031, 0x00050041, 0x00000015, 0x00000033, 0x0000000f, 0x00000014, 0x0004003d, 0x00000006,
-    0x00000034, 0x00000033, 0x00050082, 0x00000006, 0x00000035, 0x00000032, 0x00000034, 0x0004003d,
-    0x00000006, 0x00000037, 0x0000002a, 0x00050082, 0x00000006, 0x00000038, 0x00000037, 0x00000014,
-    0x0007000c, 0x00000006, 0x00000039, 0x00000001, 0x0000002a, 0x00000038, 0x00000036, 0x0008000c,
-    0x00000006, 0x0000003a, 0x00000001, 0x0000002d, 0x00000035, 0x00000036, 0x00000039, 0x0003003e,
-    0x00000030, 0x0000003a, 0x00050041, 0x00000015, 0x0000003c, 0x00000011, 0x00000018, 0x0004003d,
-    0x00000006, 0x0000003d, 0x0000003c, 0x00050041, 0x00000015, 0x0000003e, 0x0000000f, 0x00000014,
-    0x0004003d, 0x00000006, 0x0000003f, 0x0000003e, 0x00050082, 0x00000006, 0x00000040, 0x0000003d,
-    0x0000003f, 0x0004003d, 0x00000006, 0x00000041, 0x0000002a, 0x00050082, 0x00000006, 0x00000042,
-    0x00000041, 0x00000014, 0x0007000c, 0x00000006, 0x00000043, 0x00000001, 0x0000002a, 0x00000042,
-    0x00000036, 0x0008000c, 0x00000006, 0x00000044, 0x00000001, 0x0000002d, 0x00000040, 0x00000036,
-    0x00000043, 0x0003003e, 0x0000003b, 0x00000044, 0x00050041, 0x00000015, 0x0000004d, 0x0000000f,
-    0x00000036, 0x0004003d, 0x00000006, 0x0000004e, 0x0000004d, 0x0004003d, 0x00000006, 0x0000004f,
-    0x00000030, 0x00050080, 0x00000006, 0x00000050, 0x0000004e, 0x0000004f, 0x00060041, 0x00000051,
-    0x00000052, 0x0000004c, 0x00000036, 0x00000050, 0x0004003d, 0x00000048, 0x00000053, 0x00000052,
-    0x00050051, 0x00000006, 0x00000054, 0x00000053, 0x00000000, 0x00050041, 0x00000015, 0x00000055,
-    0x00000047, 0x00000036, 0x0003003e, 0x00000055, 0x00000054, 0x00050051, 0x00000006, 0x00000056,
-    0x00000053, 0x00000001, 0x00050041, 0x00000015, 0x00000057, 0x00000047, 0x00000014, 0x0003003e,
-    0x00000057, 0x00000056, 0x00050051, 0x00000006, 0x00000058, 0x00000053, 0x00000002, 0x00050041,
-    0x00000015, 0x00000059, 0x00000047, 0x0000001f, 0x0003003e, 0x00000059, 0x00000058, 0x00050051,
-    0x00000006, 0x0000005a, 0x00000053, 0x00000003, 0x00050041, 0x00000015, 0x0000005c, 0x00000047,
-    0x0000005b, 0x0003003e, 0x0000005c, 0x0000005a, 0x00050051, 0x00000006, 0x0000005d, 0x00000053,
-    0x00000004, 0x00050041, 0x00000015, 0x0000005f, 0x00000047, 0x0000005e, 0x0003003e, 0x0000005f,
-    0x0000005d, 0x00050051, 0x00000006, 0x00000060, 0x00000053, 0x00000005, 0x00050041, 0x00000015,
-    0x00000062, 0x00000047, 0x00000061, 0x0003003e, 0x00000062, 0x00000060, 0x00050051, 0x00000006,
-    0x00000063, 0x00000053, 0x00000006, 0x00050041, 0x00000015, 0x00000065, 0x00000047, 0x00000064,
-    0x0003003e, 0x00000065, 0x00000063, 0x00050051, 0x00000007, 0x00000066, 0x00000053, 0x00000007,
-    0x00050041, 0x00000068, 0x00000069, 0x00000047, 0x00000067, 0x0003003e, 0x00000069, 0x00000066,
-    0x00050051, 0x00000006, 0x0000006a, 0x00000053, 0x00000008, 0x00050041, 0x00000015, 0x0000006c,
-    0x00000047, 0x0000006b, 0x0003003e, 0x0000006c, 0x0000006a, 0x00050051, 0x00000006, 0x0000006d,
-    0x00000053, 0x00000009, 0x00050041, 0x00000015, 0x0000006f, 0x00000047, 0x0000006e, 0x0003003e,
-    0x0000006f, 0x0000006d, 0x00050051, 0x00000006, 0x00000070, 0x00000053, 0x0000000a, 0x00050041,
-    0x00000015, 0x00000072, 0x00000047, 0x00000071, 0x0003003e, 0x00000072, 0x00000070, 0x00050051,
-    0x00000006, 0x00000073, 0x00000053, 0x0000000b, 0x00050041, 0x00000015, 0x00000075, 0x00000047,
-    0x00000074, 0x0003003e, 0x00000075, 0x00000073, 0x00050051, 0x00000006, 0x00000076, 0x00000053,
-    0x0000000c, 0x00050041, 0x00000015, 0x00000078, 0x00000047, 0x00000077, 0x0003003e, 0x00000078,
-    0x00000076, 0x00050051, 0x00000006, 0x00000079, 0x00000053, 0x0000000d, 0x00050041, 0x00000015,
-    0x0000007b, 0x00000047, 0x0000007a, 0x0003003e, 0x0000007b, 0x00000079, 0x00050051, 0x00000006,
-    0x0000007c, 0x00000053, 0x0000000e, 0x00050041, 0x00000015, 0x0000007e, 0x00000047, 0x0000007d,
-    0x0003003e, 0x0000007e, 0x0000007c, 0x00050051, 0x00000006, 0x0000007f, 0x00000053, 0x0000000f,
-    0x00050041, 0x00000015, 0x00000081, 0x00000047, 0x00000080, 0x0003003e, 0x00000081, 0x0000007f,
-    0x00050051, 0x00000006, 0x00000082, 0x00000053, 0x00000010, 0x00050041, 0x00000015, 0x00000084,
-    0x00000047, 0x00000083, 0x0003003e, 0x00000084, 0x00000082, 0x00050051, 0x00000006, 0x00000085,
-    0x00000053, 0x00000011, 0x00050041, 0x00000015, 0x00000087, 0x00000047, 0x00000086, 0x0003003e,
-    0x00000087, 0x00000085, 0x00050051, 0x00000006, 0x00000088, 0x00000053, 0x00000012, 0x00050041,
-    0x00000015, 0x0000008a, 0x00000047, 0x00000089, 0x0003003e, 0x0000008a, 0x00000088, 0x00050051,
-    0x00000006, 0x0000008b, 0x00000053, 0x00000013, 0x00050041, 0x00000015, 0x0000008d, 0x00000047,
-    0x0000008c, 0x0003003e, 0x0000008d, 0x0000008b, 0x00050051, 0x00000006, 0x0000008e, 0x00000053,
-    0x00000014, 0x00050041, 0x00000015, 0x00000090, 0x00000047, 0x0000008f, 0x0003003e, 0x00000090,
-    0x0000008e, 0x00050051, 0x00000006, 0x00000091, 0x00000053, 0x00000015, 0x00050041, 0x00000015,
-    0x00000093, 0x00000047, 0x00000092, 0x0003003e, 0x00000093, 0x00000091, 0x00050051, 0x00000006,
-    0x00000094, 0x00000053, 0x00000016, 0x00050041, 0x00000015, 0x00000096, 0x00000047, 0x00000095,
-    0x0003003e, 0x00000096, 0x00000094, 0x00050051, 0x00000006, 0x00000097, 0x00000053, 0x00000017,
-    0x00050041, 0x00000015, 0x00000099, 0x00000047, 0x00000098, 0x0003003e, 0x00000099, 0x00000097,
-    0x00050041, 0x00000015, 0x0000009b, 0x0000000f, 0x00000036, 0x0004003d, 0x00000006, 0x0000009c,
-    0x0000009b, 0x0004003d, 0x00000006, 0x0000009d, 0x0000003b, 0x00050080, 0x00000006, 0x0000009e,
-    0x0000009c, 0x0000009d, 0x00060041, 0x00000051, 0x0000009f, 0x0000004c, 0x00000036, 0x0000009e,
-    0x0004003d, 0x00000048, 0x000000a0, 0x0000009f, 0x00050051, 0x00000006, 0x000000a1, 0x000000a0,
-    0x00000000, 0x00050041, 0x00000015, 0x000000a2, 0x0000009a, 0x00000036, 0x0003003e, 0x000000a2,
-    0x000000a1, 0x00050051, 0x00000006, 0x000000a3, 0x000000a0, 0x00000001, 0x00050041, 0x00000015,
-    0x000000a4, 0x0000009a, 0x00000014, 0x0003003e, 0x000000a4, 0x000000a3, 0x00050051, 0x00000006,
-    0x000000a5, 0x000000a0, 0x00000002, 0x00050041, 0x00000015, 0x000000a6, 0x0000009a, 0x0000001f,
-    0x0003003e, 0x000000a6, 0x000000a5, 0x00050051, 0x00000006, 0x000000a7, 0x000000a0, 0x00000003,
-    0x00050041, 0x00000015, 0x000000a8, 0x0000009a, 0x0000005b, 0x0003003e, 0x000000a8, 0x000000a7,
-    0x00050051, 0x00000006, 0x000000a9, 0x000000a0, 0x00000004, 0x00050041, 0x00000015, 0x000000aa,
-    0x0000009a, 0x0000005e, 0x0003003e, 0x000000aa, 0x000000a9, 0x00050051, 0x00000006, 0x000000ab,
-    0x000000a0, 0x00000005, 0x00050041, 0x00000015, 0x000000ac, 0x0000009a, 0x00000061, 0x0003003e,
-    0x000000ac, 0x000000ab, 0x00050051, 0x00000006, 0x000000ad, 0x000000a0, 0x00000006, 0x00050041,
-    0x00000015, 0x000000ae, 0x0000009a, 0x00000064, 0x0003003e, 0x000000ae, 0x000000ad, 0x00050051,
-    0x00000007, 0x000000af, 0x000000a0, 0x00000007, 0x00050041, 0x00000068, 0x000000b0, 0x0000009a,
-    0x00000067, 0x0003003e, 0x000000b0, 0x000000af, 0x00050051, 0x00000006, 0x000000b1, 0x000000a0,
-    0x00000008, 0x00050041, 0x00000015, 0x000000b2, 0x0000009a, 0x0000006b, 0x0003003e, 0x000000b2,
-    0x000000b1, 0x00050051, 0x00000006, 0x000000b3, 0x000000a0, 0x00000009, 0x00050041, 0x00000015,
-    0x000000b4, 0x0000009a, 0x0000006e, 0x0003003e, 0x000000b4, 0x000000b3, 0x00050051, 0x00000006,
-    0x000000b5, 0x000000a0, 0x0000000a, 0x00050041, 0x00000015, 0x000000b6, 0x0000009a, 0x00000071,
-    0x0003003e, 0x000000b6, 0x000000b5, 0x00050051, 0x00000006, 0x000000b7, 0x000000a0, 0x0000000b,
-    0x00050041, 0x00000015, 0x000000b8, 0x0000009a, 0x00000074, 0x0003003e, 0x000000b8, 0x000000b7,
-    0x00050051, 0x00000006, 0x000000b9, 0x000000a0, 0x0000000c, 0x00050041, 0x00000015, 0x000000ba,
-    0x0000009a, 0x00000077, 0x0003003e, 0x000000ba, 0x000000b9, 0x00050051, 0x00000006, 0x000000bb,
-    0x000000a0, 0x0000000d, 0x00050041, 0x00000015, 0x000000bc, 0x0000009a, 0x0000007a, 0x0003003e,
-    0x000000bc, 0x000000bb, 0x00050051, 0x00000006, 0x000000bd, 0x000000a0, 0x0000000e, 0x00050041,
-    0x00000015, 0x000000be, 0x0000009a, 0x0000007d, 0x0003003e, 0x000000be, 0x000000bd, 0x00050051,
-    0x00000006, 0x000000bf, 0x000000a0, 0x0000000f, 0x00050041, 0x00000015, 0x000000c0, 0x0000009a,
-    0x00000080, 0x0003003e, 0x000000c0, 0x000000bf, 0x00050051, 0x00000006, 0x000000c1, 0x000000a0,
-    0x00000010, 0x00050041, 0x00000015, 0x000000c2, 0x0000009a, 0x00000083, 0x0003003e, 0x000000c2,
-    0x000000c1, 0x00050051, 0x00000006, 0x000000c3, 0x000000a0, 0x00000011, 0x00050041, 0x00000015,
-    0x000000c4, 0x0000009a, 0x00000086, 0x0003003e, 0x000000c4, 0x000000c3, 0x00050051, 0x00000006,
-    0x000000c5, 0x000000a0, 0x00000012, 0x00050041, 0x00000015, 0x000000c6, 0x0000009a, 0x00000089,
-    0x0003003e, 0x000000c6, 0x000000c5, 0x00050051, 0x00000006, 0x000000c7, 0x000000a0, 0x00000013,
-    0x00050041, 0x00000015, 0x000000c8, 0x0000009a, 0x0000008c, 0x0003003e, 0x000000c8, 0x000000c7,
-    0x00050051, 0x00000006, 0x000000c9, 0x000000a0, 0x00000014, 0x00050041, 0x00000015, 0x000000ca,
-    0x0000009a, 0x0000008f, 0x0003003e, 0x000000ca, 0x000000c9, 0x00050051, 0x00000006, 0x000000cb,
-    0x000000a0, 0x00000015, 0x00050041, 0x00000015, 0x000000cc, 0x0000009a, 0x00000092, 0x0003003e,
-    0x000000cc, 0x000000cb, 0x00050051, 0x00000006, 0x000000cd, 0x000000a0, 0x00000016, 0x00050041,
-    0x00000015, 0x000000ce, 0x0000009a, 0x00000095, 0x0003003e, 0x000000ce, 0x000000cd, 0x00050051,
-    0x00000006, 0x000000cf, 0x000000a0, 0x00000017, 0x00050041, 0x00000015, 0x000000d0, 0x0000009a,
-    0x00000098, 0x0003003e, 0x000000d0, 0x000000cf, 0x00050041, 0x00000015, 0x000000d1, 0x0000000f,
-    0x00000061, 0x0004003d, 0x00000006, 0x000000d2, 0x000000d1, 0x00050041, 0x00000015, 0x000000d3,
-    0x00000010, 0x00000018, 0x0004003d, 0x00000006, 0x000000d4, 0x000000d3, 0x000500af, 0x0000000d,
-    0x000000d5, 0x000000d2, 0x000000d4, 0x000300f7, 0x000000d7, 0x00000000, 0x000400fa, 0x000000d5,
-    0x000000d6, 0x000000d7, 0x000200f8, 0x000000d6, 0x00050041, 0x00000015, 0x000000d8, 0x0000000f,
-    0x00000061, 0x0004003d, 0x00000006, 0x000000d9, 0x000000d8, 0x00050041, 0x00000015, 0x000000da,
-    0x00000011, 0x00000018, 0x0004003d, 0x00000006, 0x000000db, 0x000000da, 0x000500b3, 0x0000000d,
-    0x000000dc, 0x000000d9, 0x000000db, 0x000200f9, 0x000000d7, 0x000200f8, 0x000000d7, 0x000700f5,
-    0x0000000d, 0x000000dd, 0x000000d5, 0x00000027, 0x000000dc, 0x000000d6, 0x000300f7, 0x000000df,
-    0x00000000, 0x000400fa, 0x000000dd, 0x000000de, 0x000000e3, 0x000200f8, 0x000000de, 0x00050041,
-    0x00000015, 0x000000e1, 0x0000000f, 0x0000005b, 0x0004003d, 0x00000006, 0x000000e2, 0x000000e1,
-    0x0003003e, 0x000000e0, 0x000000e2, 0x000200f9, 0x000000df, 0x000200f8, 0x000000e3, 0x00050041,
-    0x00000015, 0x000000e4, 0x00000047, 0x00000036, 0x0004003d, 0x00000006, 0x000000e5, 0x000000e4,
-    0x00050041, 0x00000015, 0x000000e6, 0x0000009a, 0x00000036, 0x0004003d, 0x00000006, 0x000000e7,
-    0x000000e6, 0x0007000c, 0x00000006, 0x000000e8, 0x00000001, 0x00000027, 0x000000e5, 0x000000e7,
-    0x0003003e, 0x000000e0, 0x000000e8, 0x000200f9, 0x000000df, 0x000200f8, 0x000000df, 0x0004003d,
-    0x00000006, 0x000000e9, 0x000000e0, 0x00050041, 0x00000015, 0x000000eb, 0x00000011, 0x000000ea,
-    0x0004003d, 0x00000006, 0x000000ec, 0x000000eb, 0x000500ad, 0x0000000d, 0x000000ed, 0x000000e9,
-    0x000000ec, 0x000300f7, 0x000000ef, 0x00000000, 0x000400fa, 0x000000ed, 0x000000ee, 0x000000ef,
-    0x000200f8, 0x000000ee, 0x000200fe, 0x00000028, 0x000200f8, 0x000000ef, 0x00050041, 0x00000015,
-    0x000000f1, 0x0000000f, 0x00000064, 0x0004003d, 0x00000006, 0x000000f2, 0x000000f1, 0x00050041,
-    0x00000015, 0x000000f3, 0x00000010, 0x00000018, 0x0004003d, 0x00000006, 0x000000f4, 0x000000f3,
-    0x000500af, 0x0000000d, 0x000000f5, 0x000000f2, 0x000000f4, 0x000300f7, 0x000000f7, 0x00000000,
-    0x000400fa, 0x000000f5, 0x000000f6, 0x000000f7, 0x000200f8, 0x000000f6, 0x00050041, 0x00000015,
-    0x000000f8, 0x0000000f, 0x00000064, 0x0004003d, 0x00000006, 0x000000f9, 0x000000f8, 0x00050041,
-    0x00000015, 0x000000fa, 0x00000011, 0x00000018, 0x0004003d, 0x00000006, 0x000000fb, 0x000000fa,
-    0x000500b3, 0x0000000d, 0x000000fc, 0x000000f9, 0x000000fb, 0x000200f9, 0x000000f7, 0x000200f8,
-    0x000000f7, 0x000700f5, 0x0000000d, 0x000000fd, 0x000000f5, 0x000000ef, 0x000000fc, 0x000000f6,
-    0x000300f7, 0x000000ff, 0x00000000, 0x000400fa, 0x000000fd, 0x000000fe, 0x00000103, 0x000200f8,
-    0x000000fe, 0x00050041, 0x00000015, 0x00000101, 0x0000000f, 0x0000005e, 0x0004003d, 0x00000006,
-    0x00000102, 0x00000101, 0x0003003e, 0x00000100, 0x00000102, 0x000200f9, 0x000000ff, 0x000200f8,
-    0x00000103, 0x00050041, 0x00000015, 0x00000104, 0x00000047, 0x00000014, 0x0004003d, 0x00000006,
-    0x00000105, 0x00000104, 0x00050041, 0x00000015, 0x00000106, 0x0000009a, 0x00000014, 0x0004003d,
-    0x00000006, 0x00000107, 0x00000106, 0x0007000c, 0x00000006, 0x00000108, 0x00000001, 0x0000002a,
-    0x00000105, 0x00000107, 0x00050082, 0x00000006, 0x00000109, 0x00000108, 0x00000014, 0x0003003e,
-    0x00000100, 0x00000109, 0x000200f9, 0x000000ff, 0x000200f8, 0x000000ff, 0x0004003d, 0x00000006,
-    0x0000010a, 0x00000100, 0x00050041, 0x00000015, 0x0000010b, 0x00000010, 0x000000ea, 0x0004003d,
-    0x00000006, 0x0000010c, 0x0000010b, 0x000500b1, 0x0000000d, 0x0000010d, 0x0000010a, 0x0000010c,
-    0x000300f7, 0x0000010f, 0x00000000, 0x000400fa, 0x0000010d, 0x0000010e, 0x0000010f, 0x000200f8,
-    0x0000010e, 0x000200fe, 0x00000028, 0x000200f8, 0x0000010f, 0x000200fe, 0x00000111, 0x00010038,
+const uint8_t Blob040_Data[4949] =
+{
+    0x28, 0xb5, 0x2f, 0xfd, 0x60, 0x20, 0x4a, 0x5d, 0x9a, 0x00, 0x1a, 0xa3, 0x58, 0x27, 0x38, 0x10,
+    0x98, 0x59, 0x63, 0x40, 0x55, 0x81, 0xc8, 0x88, 0x88, 0x88, 0x88, 0x50, 0x4d, 0x40, 0xec, 0x41,
+    0x41, 0x85, 0xd1, 0x9f, 0x92, 0x60, 0x11, 0xd8, 0x55, 0x5b, 0x65, 0xb3, 0xb8, 0xed, 0xfe, 0xff,
+    0x77, 0xb9, 0xfe, 0xf7, 0xe5, 0xdd, 0xb4, 0xd6, 0xda, 0x1e, 0x62, 0x1c, 0x40, 0x55, 0x49, 0xdb,
+    0xb6, 0xb7, 0x64, 0x6b, 0xa5, 0x4c, 0x01, 0x26, 0x02, 0x52, 0x02, 0x95, 0x02, 0xcf, 0x64, 0x57,
+    0x4c, 0xd4, 0x81, 0xf8, 0x39, 0x9e, 0x8d, 0xf1, 0x2f, 0x4c, 0x90, 0x20, 0xb4, 0x75, 0xdb, 0x4b,
+    0x38, 0xf8, 0xc5, 0xb5, 0x0f, 0xf8, 0x5e, 0x9b, 0x70, 0xc7, 0xd3, 0x9a, 0xca, 0x67, 0xe2, 0xdb,
+    0xba, 0xa5, 0xb6, 0xcb, 0xa6, 0xd4, 0xeb, 0xed, 0xee, 0xbd, 0xd5, 0xe8, 0xd7, 0xed, 0x9b, 0x4b,
+    0xbd, 0xb9, 0x82, 0xb6, 0x5d, 0xde, 0xed, 0xee, 0x39, 0xd5, 0xfb, 0xc5, 0xd5, 0x3e, 0x7b, 0xd3,
+    0xd9, 0x5b, 0x2f, 0x17, 0xed, 0xbf, 0x84, 0x60, 0x09, 0x7e, 0xf4, 0x13, 0xea, 0xdd, 0x2c, 0x9e,
+    0xdf, 0xd9, 0xfb, 0x0d, 0xe7, 0x97, 0xe7, 0xb8, 0xe0, 0xdb, 0xa7, 0x51, 0xdf, 0xec, 0xaf, 0xde,
+    0xe9, 0x1f, 0x6d, 0x2f, 0x60, 0x9d, 0xdc, 0xef, 0x6f, 0x36, 0x1b, 0xb7, 0x47, 0xbf, 0xd7, 0xa6,
+    0x7e, 0xdd, 0x92, 0xb5, 0x1d, 0xf2, 0xeb, 0xbc, 0xb6, 0x7e, 0x9c, 0xff, 0xb7, 0x3b, 0x16, 0xcf,
+    0x93, 0x75, 0x30, 0xf5, 0xbb, 0x7f, 0xf3, 0x2e, 0x75, 0xfb, 0x05, 0xcb, 0x85, 0x79, 0xc1, 0xb8,
+    0xb0, 0xb7, 0x6e, 0x6f, 0xeb, 0x06, 0xbf, 0x36, 0x1c, 0xf6, 0xd6, 0xea, 0xb7, 0x96, 0xe1, 0x8d,
+    0xcd, 0xdd, 0xf2, 0x2e, 0xbe, 0x17, 0xe6, 0x56, 0x25, 0xd7, 0xbe, 0x76, 0xb9, 0x56, 0x7f, 0x73,
+    0x71, 0xbb, 0xfb, 0xab, 0xdb, 0xdd, 0xab, 0x94, 0x5a, 0xdb, 0xa0, 0xde, 0xcd, 0x03, 0xe4, 0x46,
+    0xbd, 0x21, 0xd6, 0xcd, 0x0b, 0xee, 0xea, 0x5a, 0x28, 0x9d, 0x9e, 0xa1, 0x2d, 0xbf, 0x55, 0x2f,
+    0xc7, 0x09, 0xef, 0x24, 0x73, 0xf1, 0x5b, 0xff, 0xf8, 0x6f, 0xfa, 0x9d, 0xcd, 0x82, 0xd3, 0xbe,
+    0x6f, 0x5f, 0x57, 0xab, 0xd5, 0x6a, 0xb5, 0x5a, 0xad, 0x56, 0xab, 0xd5, 0x6a, 0xb5, 0x5a, 0xad,
+    0x56, 0xab, 0xd5, 0x6a, 0xf2, 0x6b, 0xd8, 0x16, 0xc5, 0xb5, 0xf1, 0x1d, 0xcf, 0xdd, 0xa0, 0xf0,
+    0xa2, 0x77, 0x50, 0xbc, 0xa7, 0xf7, 0xba, 0xc3, 0xea, 0xdd, 0xee, 0xd5, 0x89, 0x4e, 0x6b, 0x6a,
+    0x63, 0xfa, 0xa2, 0x5b, 0x4a, 0x53, 0x6a, 0x7b, 0x7a, 0xd1, 0xe9, 0x5d, 0x6e, 0x97, 0xea, 0x4c,
+    0xe6, 0x35, 0xf3, 0x98, 0x48, 0x3e, 0xbe, 0xff, 0x6a, 0x6d, 0x2e, 0x9b, 0x17, 0xbf, 0xde, 0x74,
+    0x49, 0xba, 0xe4, 0x5b, 0x0b, 0xbb, 0xd4, 0x5b, 0x8b, 0x5d, 0x43, 0xfe, 0x63, 0xf3, 0xb5, 0xe3,
+    0xae, 0xdb, 0x7b, 0xdd, 0x8d, 0xc5, 0xbf, 0xb9, 0xdb, 0x4c, 0x7f, 0xc9, 0x5e, 0x8f, 0xf4, 0x82,
+    0xf7, 0xbb, 0x6e, 0x8d, 0x6c, 0x4f, 0xbf, 0xf3, 0xdc, 0xcd, 0xeb, 0xae, 0x6a, 0x25, 0x7f, 0xdf,
+    0x6a, 0x71, 0xba, 0xbd, 0x2b, 0x98, 0xdc, 0xb3, 0xb7, 0xd5, 0xdb, 0xdd, 0x99, 0xbc, 0x4b, 0xbf,
+    0x00, 0x2f, 0x24, 0xfb, 0xca, 0x72, 0x7d, 0x81, 0xbf, 0x70, 0x2e, 0xae, 0xfd, 0x0a, 0xd6, 0xf7,
+    0x6f, 0x56, 0x8e, 0xa7, 0xfd, 0xbf, 0xd3, 0x43, 0xdf, 0xc2, 0x8d, 0xe3, 0x69, 0x73, 0xfc, 0x6a,
+    0xb3, 0x31, 0xe9, 0xfb, 0xd0, 0xb6, 0xde, 0x3a, 0x78, 0x37, 0xbc, 0xed, 0x96, 0xf5, 0xeb, 0xfb,
+    0x8e, 0xa6, 0xdc, 0x73, 0x1b, 0xd7, 0x6d, 0xbc, 0x9a, 0xde, 0x4b, 0x1a, 0xda, 0x48, 0x38, 0xbd,
+    0xe3, 0xde, 0x4d, 0x9b, 0xff, 0xbd, 0x5d, 0xbb, 0xbd, 0x25, 0x6d, 0x7b, 0xeb, 0xf4, 0xf6, 0xaf,
+    0x8e, 0xb3, 0x3d, 0xfd, 0xf4, 0xe7, 0x5d, 0xed, 0x21, 0xb7, 0x2b, 0xb7, 0x7c, 0x24, 0x16, 0xcc,
+    0xbd, 0xe6, 0xb8, 0xf2, 0x2e, 0xc4, 0xf7, 0xeb, 0xad, 0xe3, 0x58, 0xc0, 0x3b, 0xc7, 0xb9, 0x80,
+    0x37, 0xf7, 0x70, 0xff, 0x02, 0x7a, 0xbd, 0x57, 0xc0, 0x35, 0x6b, 0x5b, 0x5c, 0x5c, 0x1b, 0x20,
+    0xf3, 0x91, 0x59, 0xe6, 0xa3, 0x5c, 0xd5, 0x84, 0x64, 0xba, 0x8a, 0xfa, 0x1c, 0xb7, 0x09, 0x91,
+    0xc9, 0xaf, 0x7f, 0xe9, 0x8f, 0xaf, 0xf4, 0x5e, 0x62, 0x61, 0x5d, 0xd8, 0xfd, 0xdb, 0x65, 0xad,
+    0xb3, 0xb6, 0xd1, 0xff, 0xf2, 0xcf, 0xdf, 0xf4, 0x73, 0x86, 0x57, 0x7e, 0xf3, 0xe5, 0xe3, 0xd7,
+    0x04, 0xe6, 0x63, 0x5b, 0x5b, 0x77, 0xb2, 0x1a, 0x69, 0x61, 0x61, 0x39, 0xfa, 0xac, 0xc6, 0xa9,
+    0x81, 0x03, 0x4f, 0x21, 0x56, 0x06, 0xe8, 0x02, 0x56, 0x04, 0x0a, 0x5c, 0x11, 0xa8, 0xab, 0xa4,
+    0xa8, 0xaa, 0x9a, 0x03, 0xa8, 0xa6, 0xe2, 0x06, 0x98, 0xfd, 0xf1, 0x1f, 0xc8, 0x02, 0x32, 0x04,
+    0xa8, 0xcd, 0x16, 0x01, 0x24, 0x1f, 0x8d, 0xef, 0xce, 0xaa, 0x56, 0x16, 0x15, 0xdb, 0xce, 0xd1,
+    0x28, 0xe3, 0x56, 0x4f, 0x34, 0xce, 0x1b, 0xa7, 0x15, 0x26, 0x13, 0xc5, 0x68, 0xe2, 0x56, 0x07,
+    0x62, 0x8c, 0x17, 0x5b, 0x13, 0x24, 0x08, 0x99, 0x6f, 0x6e, 0x54, 0x33, 0x27, 0x18, 0x97, 0x55,
+    0x54, 0xca, 0x59, 0x43, 0xc9, 0x92, 0x8c, 0x7e, 0x9e, 0x4a, 0xa5, 0x18, 0xe8, 0xaa, 0x0b, 0xb5,
+    0xe1, 0xe1, 0x62, 0xd8, 0x50, 0x69, 0xe1, 0x91, 0x85, 0xe1, 0x07, 0xff, 0xef, 0x4b, 0x10, 0x5f,
+    0xaf, 0xd7, 0x67, 0x41, 0x32, 0x1b, 0x30, 0x70, 0x0a, 0xd0, 0x99, 0x57, 0xc5, 0x75, 0xb6, 0x95,
+    0x60, 0x8b, 0xc0, 0xd6, 0x34, 0xfc, 0xa4, 0x02, 0xd1, 0x64, 0x5e, 0x59, 0xd6, 0xc7, 0xe3, 0x2c,
+    0x93, 0x4d, 0x72, 0x7e, 0x95, 0xa4, 0x48, 0xb5, 0xa4, 0x48, 0x35, 0x24, 0x29, 0x47, 0x8f, 0x1c,
+    0x7d, 0x18, 0x01, 0x88, 0x0e, 0xfb, 0xb3, 0x20, 0x1c, 0xe6, 0xf1, 0xe1, 0x03, 0x0e, 0x65, 0x0d,
+    0x42, 0x9b, 0x3b, 0x07, 0x29, 0xe0, 0x4e, 0x0a, 0x5b, 0x7c, 0xab, 0x9d, 0x03, 0x67, 0xc0, 0x3f,
+    0xbf, 0xf9, 0x6f, 0x42, 0x1f, 0xed, 0xf7, 0x4a, 0xf3, 0x84, 0x28, 0xbe, 0xbd, 0x3e, 0xa9, 0x2b,
+    0xbe, 0xbd, 0xa7, 0x5b, 0x55, 0x1b, 0x1b, 0x87, 0x35, 0xb4, 0x66, 0x82, 0xb3, 0xb3, 0x30, 0x84,
+    0x25, 0x83, 0xe5, 0x54, 0x2c, 0x4c, 0x8c, 0x66, 0x2a, 0xa0, 0x5f, 0x56, 0x26, 0x98, 0xb7, 0x90,
+    0x5a, 0x64, 0x48, 0x04, 0x57, 0x64, 0xf5, 0x54, 0x2d, 0x95, 0xa3, 0xc8, 0xa0, 0x8e, 0x51, 0xb9,
+    0x09, 0xc1, 0x2f, 0xd6, 0x51, 0x34, 0xa0, 0x62, 0x44, 0x5d, 0x40, 0x57, 0x3c, 0xa1, 0x70, 0x2a,
+    0xd1, 0x24, 0x82, 0xe9, 0xc3, 0x52, 0x58, 0x49, 0xc3, 0xf3, 0x82, 0xd3, 0x42, 0x73, 0x67, 0x56,
+    0x58, 0xe6, 0xca, 0xc1, 0x7a, 0xab, 0xa5, 0xb1, 0x49, 0x1b, 0xf9, 0x77, 0xec, 0xab, 0xce, 0x39,
+    0xad, 0x64, 0x6f, 0xce, 0x08, 0x55, 0x6e, 0x03, 0xaa, 0x6e, 0x53, 0xd5, 0x35, 0x36, 0x7a, 0x6d,
+    0xc0, 0x4f, 0xb3, 0x9e, 0x5a, 0x33, 0x95, 0xb4, 0xa6, 0xeb, 0x68, 0x15, 0x74, 0xcb, 0xc9, 0x7c,
+    0xd2, 0x4f, 0x68, 0xd3, 0x39, 0x37, 0xa3, 0x96, 0x35, 0xb3, 0xaa, 0x56, 0xd6, 0xf4, 0xf3, 0x07,
+    0x28, 0xa1, 0xbe, 0x96, 0xe9, 0xe8, 0xd1, 0xea, 0x09, 0x40, 0x13, 0xc3, 0xac, 0x2f, 0x05, 0x05,
+    0x03, 0x69, 0x40, 0x79, 0xa9, 0x9c, 0x65, 0x26, 0xe4, 0x95, 0xe3, 0x78, 0x0e, 0xcb, 0xff, 0x93,
+    0x24, 0x45, 0x42, 0x42, 0x62, 0xa2, 0x1f, 0xbd, 0xfc, 0x47, 0x1e, 0x1c, 0xfc, 0xc7, 0x13, 0xd0,
+    0xdb, 0xd7, 0x5a, 0xfd, 0x15, 0x60, 0xb5, 0xa9, 0xc6, 0x3c, 0x5b, 0x96, 0x29, 0xc7, 0xc2, 0x66,
+    0xaf, 0x7f, 0xbf, 0xbe, 0xb0, 0xa9, 0xab, 0x00, 0x51, 0x56, 0x7f, 0x65, 0x9d, 0x8f, 0xff, 0x6f,
+    0x81, 0x6e, 0x6d, 0x13, 0xa2, 0xf4, 0xa0, 0xec, 0xa2, 0x72, 0x50, 0xeb, 0x53, 0xd5, 0x49, 0xad,
+    0xe9, 0x8c, 0xa9, 0x6c, 0x69, 0x4c, 0x29, 0xec, 0xe9, 0xe5, 0x4c, 0xd0, 0xcc, 0x62, 0x16, 0x58,
+    0x56, 0x29, 0xa5, 0x6a, 0x29, 0x0d, 0x4d, 0x32, 0x21, 0x9d, 0x47, 0xe5, 0x8c, 0x94, 0x9f, 0xc0,
+    0x57, 0xbf, 0x87, 0x37, 0x16, 0xd7, 0xf7, 0x3a, 0xc1, 0x9b, 0xed, 0xfb, 0xba, 0x20, 0x7d, 0xfd,
+    0xde, 0x6a, 0x81, 0x39, 0xce, 0xf7, 0x74, 0xe1, 0x9d, 0x75, 0x56, 0x7b, 0xbc, 0xec, 0x26, 0xec,
+    0x52, 0xf1, 0x6f, 0x57, 0x6e, 0x17, 0xfb, 0x72, 0x45, 0xff, 0xf9, 0xf5, 0x97, 0x99, 0xcf, 0x3f,
+    0xcb, 0xd8, 0x1c, 0x2d, 0x7f, 0xe4, 0xff, 0x91, 0x6b, 0xdf, 0x74, 0xf3, 0xf2, 0xf3, 0xb0, 0xf7,
+    0xae, 0x77, 0xeb, 0xe4, 0xcf, 0xc1, 0x5d, 0x6a, 0xde, 0xef, 0x5c, 0xf0, 0xf7, 0xa6, 0x9b, 0x64,
+    0x81, 0xf1, 0xad, 0xfa, 0x2d, 0xf7, 0x05, 0x94, 0xdf, 0xb7, 0x7e, 0xad, 0xfb, 0xa3, 0xdb, 0x5c,
+    0x3d, 0x71, 0xde, 0x58, 0x09, 0xb4, 0x74, 0x82, 0x9f, 0xbc, 0x35, 0x95, 0x27, 0x1c, 0xef, 0xfa,
+    0xf6, 0xee, 0xf4, 0xf6, 0xb4, 0xf2, 0xa0, 0x5e, 0xde, 0x5b, 0xf1, 0xec, 0xac, 0x75, 0x74, 0x76,
+    0x6a, 0x75, 0x73, 0x71, 0x74, 0x3f, 0xcf, 0xc9, 0xcd, 0x71, 0xff, 0x12, 0x66, 0xb8, 0x08, 0x6f,
+    0x55, 0xb7, 0xb9, 0xfa, 0x73, 0x1b, 0x9b, 0x1a, 0x5b, 0xe2, 0x5a, 0xfd, 0x00, 0xc2, 0x03, 0x6a,
+    0x1a, 0x35, 0x0d, 0x0d, 0xed, 0xcf, 0x20, 0x2c, 0x32, 0x9b, 0x96, 0x91, 0x89, 0x39, 0x20, 0x63,
+    0xe0, 0xa0, 0x7e, 0x30, 0x63, 0x0d, 0xa4, 0x63, 0x53, 0x06, 0x8b, 0x88, 0x53, 0xb0, 0xb0, 0x05,
+    0x61, 0x8c, 0x60, 0x5f, 0x5e, 0x0b, 0xbe, 0x14, 0x70, 0x79, 0x75, 0x29, 0xe8, 0x42, 0xa0, 0x85,
+    0x20, 0x4b, 0x0b, 0x2b, 0x0b, 0xab, 0x1e, 0x60, 0xc0, 0xea, 0xc0, 0x21, 0xa9, 0x01, 0x02, 0x57,
+    0x05, 0xbc, 0x5c, 0x55, 0x59, 0x4d, 0xab, 0xc2, 0x51, 0xaa, 0xa9, 0xa9, 0x01, 0x02, 0xa4, 0x04,
+    0xd4, 0x01, 0xa2, 0x00, 0x02, 0xd8, 0x52, 0x00, 0x5a, 0xa4, 0x54, 0x50, 0x51, 0x50, 0x4f, 0x50,
+    0xa7, 0x3f, 0x28, 0x9d, 0xf8, 0x54, 0x37, 0x31, 0x39, 0x41, 0x9b, 0x9e, 0x4c, 0xe1, 0xb3, 0x25,
+    0x3d, 0x4a, 0x8d, 0x1a, 0x29, 0x17, 0xeb, 0x0c, 0x34, 0x99, 0x39, 0x39, 0x4f, 0x65, 0x64, 0xcd,
+    0xa8, 0x11, 0xa3, 0xc6, 0x46, 0x8d, 0x8b, 0x1a, 0x13, 0x17, 0x31, 0x2a, 0xd2, 0x93, 0xa8, 0x90,
+    0xa2, 0x3f, 0x44, 0x89, 0x00, 0x1d, 0x42, 0x64, 0xe8, 0x90, 0xd4, 0x10, 0xa1, 0x40, 0x85, 0x7e,
+    0x70, 0x10, 0x21, 0x41, 0x83, 0x16, 0xa5, 0x04, 0x2d, 0xf2, 0x09, 0x04, 0xc8, 0xcf, 0x62, 0x1f,
+    0x3f, 0xd2, 0x3e, 0x7b, 0xf8, 0x2c, 0xc6, 0xd8, 0x03, 0xc4, 0x47, 0x90, 0x20, 0x75, 0xea, 0xe4,
+    0x49, 0xbc, 0x83, 0x27, 0x0f, 0x97, 0x44, 0x3c, 0x76, 0xee, 0x28, 0xda, 0xa1, 0x53, 0x87, 0xce,
+    0x9c, 0x3a, 0x8d, 0x71, 0xde, 0x58, 0x99, 0x23, 0x27, 0x8e, 0x0e, 0x39, 0x6f, 0x10, 0xe1, 0xb4,
+    0x71, 0xd3, 0x66, 0x0d, 0x9b, 0x35, 0x69, 0xd4, 0xa4, 0x39, 0x83, 0xe6, 0x4c, 0x19, 0x33, 0x65,
+    0xc6, 0x90, 0x19, 0x13, 0x46, 0x4c, 0x98, 0x2f, 0x60, 0xbe, 0x74, 0xf1, 0x62, 0xc5, 0x0b, 0x96,
+    0x2e, 0x5b, 0xb8, 0x58, 0xe1, 0x82, 0x65, 0x4b, 0x16, 0x2d, 0x56, 0xb4, 0x60, 0xc9, 0x72, 0x05,
+    0x4b, 0x95, 0x2b, 0x4c, 0xaa, 0x50, 0x61, 0x32, 0x45, 0x0a, 0x15, 0xc5, 0x29, 0x52, 0xc2, 0x50,
+    0xa2, 0x40, 0xf9, 0x7f, 0xd2, 0xc4, 0xc9, 0xb4, 0xc9, 0x7f, 0x92, 0x25, 0x5e, 0x94, 0x20, 0x49,
+    0xf2, 0xe5, 0x08, 0x12, 0xc5, 0x23, 0x46, 0x14, 0xdd, 0x8c, 0x38, 0x8b, 0xd4, 0x3f, 0x80, 0xfc,
+    0x20, 0xb2, 0x38, 0x84, 0xc8, 0x90, 0x17, 0x43, 0x84, 0x08, 0xf9, 0x20, 0x40, 0x16, 0xf9, 0xf0,
+    0x91, 0xd8, 0x43, 0x07, 0x8f, 0x1d, 0x3d, 0x10, 0x77, 0x8c, 0x11, 0x73, 0xd8, 0x18, 0xe3, 0xb8,
+    0x91, 0x23, 0xc6, 0x0d, 0x33, 0x1b, 0x4d, 0x71, 0x8c, 0x1a, 0x33, 0xc4, 0x4d, 0xb9, 0x1a, 0xb4,
+    0x16, 0x1a, 0xda, 0x19, 0xb4, 0x17, 0x19, 0x30, 0x5e, 0x68, 0xc1, 0xa8, 0x57, 0xac, 0x58, 0xd4,
+    0x72, 0x51, 0x1f, 0x92, 0xb6, 0xd8, 0x62, 0xc5, 0x42, 0xc5, 0x0a, 0x15, 0x29, 0x56, 0xbc, 0xa5,
+    0xc8, 0x66, 0x51, 0x98, 0x20, 0xe1, 0x84, 0xa2, 0xc1, 0x09, 0x13, 0xd4, 0x13, 0x25, 0x48, 0x94,
+    0x10, 0x31, 0xa2, 0xc2, 0x08, 0xa6, 0x88, 0xfa, 0x43, 0x88, 0x3c, 0x04, 0x88, 0xe5, 0x07, 0x65,
+    0x07, 0x0f, 0x83, 0x1e, 0xb6, 0xca, 0x0e, 0x35, 0x87, 0xb0, 0x36, 0x5c, 0x73, 0xd0, 0xb0, 0x01,
+    0xbb, 0x81, 0xd6, 0x80, 0x21, 0x83, 0x9d, 0x21, 0x89, 0xe1, 0xf0, 0xc2, 0xdf, 0x05, 0xe4, 0xa1,
+    0x05, 0xc3, 0x3e, 0xc3, 0xa3, 0x05, 0x70, 0x21, 0x55, 0xe1, 0x0c, 0xfe, 0xee, 0xd0, 0x5d, 0xfe,
+    0x56, 0xd0, 0x09, 0xf5, 0xe8, 0x57, 0x98, 0xf3, 0x6a, 0xb9, 0x83, 0xdd, 0x1c, 0x8d, 0x7b, 0x67,
+    0x6f, 0x6c, 0xf6, 0xee, 0x2a, 0xc1, 0x0e, 0x8b, 0x87, 0x27, 0xa8, 0x77, 0x3d, 0x22, 0x08, 0x68,
+    0x07, 0xa2, 0xe5, 0xe9, 0xd5, 0x60, 0x79, 0x77, 0x78, 0x77, 0x76, 0x78, 0x70, 0x75, 0x59, 0x56,
+    0xbb, 0xfa, 0x19, 0xe9, 0xe2, 0xea, 0xe6, 0xe8, 0xe4, 0xe6, 0xa0, 0x72, 0x71, 0x70, 0x12, 0xe0,
+    0xac, 0x12, 0x22, 0x58, 0x91, 0x58, 0x45, 0xa0, 0xb3, 0xde, 0xaa, 0xd4, 0x36, 0xb5, 0x6a, 0xd8,
+    0x4c, 0x2d, 0xcd, 0x0c, 0xed, 0x41, 0x5a, 0x53, 0xea, 0x41, 0xb3, 0x0c, 0x8c, 0xcc, 0x41, 0x19,
+    0x17, 0x59, 0x03, 0x07, 0x63, 0x0d, 0xa6, 0xd3, 0x31, 0x06, 0x5c, 0x5f, 0x5e, 0x0b, 0xc2, 0x56,
+    0x5f, 0x0a, 0xba, 0xbc, 0x68, 0x10, 0xd0, 0xae, 0x04, 0x01, 0x2f, 0xff, 0xd8, 0xbf, 0xdc, 0xb4,
+    0xa4, 0xb4, 0xa4, 0xf4, 0x5c, 0x72, 0x32, 0x9f, 0x4d, 0xe7, 0x22, 0x53, 0xf3, 0x99, 0x93, 0x96,
+    0xaf, 0x5c, 0xd2, 0x1e, 0x6a, 0x2d, 0x25, 0x5d, 0x8b, 0x69, 0x64, 0x12, 0x2a, 0x23, 0x8f, 0x93,
+    0xe4, 0x9f, 0xff, 0x64, 0x49, 0xf2, 0x51, 0x52, 0xa4, 0x49, 0x8b, 0x0a, 0x31, 0x46, 0x6a, 0x6c,
+    0x7c, 0x04, 0xc9, 0xd1, 0x23, 0x47, 0x8c, 0x1a, 0x61, 0x19, 0x2d, 0x6a, 0x5c, 0xc4, 0xd8, 0xa8,
+    0x88, 0x31, 0x91, 0xa2, 0x44, 0x87, 0x10, 0x61, 0x0f, 0x15, 0x22, 0x54, 0x88, 0xd0, 0xa0, 0x42,
+    0x82, 0x06, 0x05, 0x12, 0xb4, 0xd8, 0x14, 0xe8, 0x0e, 0x20, 0x3b, 0x7f, 0xfc, 0x60, 0xfd, 0xe9,
+    0xe3, 0x47, 0xdc, 0x67, 0x0f, 0x9f, 0x69, 0xdb, 0x1e, 0x3d, 0x76, 0xf2, 0xdc, 0xc1, 0x93, 0xa7,
+    0x6f, 0x09, 0x4f, 0x1d, 0x3d, 0x75, 0xe8, 0xd8, 0x69, 0x83, 0x45, 0xc7, 0x4d, 0x23, 0x38, 0x73,
+    0x94, 0xc8, 0x69, 0x8a, 0xf3, 0x06, 0xce, 0x9b, 0x36, 0x6e, 0xda, 0xb0, 0x71, 0xd3, 0x98, 0x86,
+    0xcd, 0xd3, 0xc8, 0x1a, 0x29, 0x93, 0x1a, 0x34, 0x69, 0x6c, 0x34, 0x66, 0xce, 0x88, 0xcf, 0x8c,
+    0xcd, 0x90, 0x29, 0x23, 0x2e, 0x33, 0x26, 0x23, 0x66, 0x8c, 0x78, 0xcc, 0x58, 0x0c, 0x98, 0x30,
+    0xe2, 0x30, 0x63, 0x30, 0x5e, 0xbe, 0x88, 0xbf, 0x8c, 0xbd, 0x70, 0xe9, 0x22, 0xee, 0x32, 0xe6,
+    0xa2, 0x65, 0x8b, 0x78, 0xcb, 0x58, 0x0b, 0x96, 0x2c, 0xe2, 0x2c, 0x63, 0x2c, 0x56, 0xae, 0x88,
+    0xaf, 0x8c, 0xad, 0x50, 0xa9, 0x22, 0xae, 0x32, 0xa6, 0x22, 0x65, 0x8a, 0x78, 0xca, 0x58, 0x0a,
+    0x94, 0x28, 0xe2, 0x28, 0x63, 0x28, 0x4e, 0x9e, 0x88, 0x9f, 0x8c, 0x9d, 0x30, 0x69, 0x22, 0x6e,
+    0x32, 0x66, 0xa2, 0x64, 0x89, 0x78, 0xc9, 0x58, 0x09, 0x92, 0x24, 0xe2, 0x24, 0x63, 0x24, 0x46,
+    0x8e, 0x88, 0x8f, 0x8c, 0x8d, 0x28, 0x16, 0x11, 0x17, 0x19, 0x2b, 0x0e, 0x21, 0x22, 0x26, 0x32,
+    0x1e, 0x12, 0x44, 0x88, 0x58, 0xc8, 0x38, 0xc8, 0x0f, 0x20, 0x62, 0x20, 0xe3, 0x1f, 0x89, 0x3e,
+    0xc4, 0x3e, 0xc6, 0x89, 0x3c, 0x7a, 0x88, 0x7b, 0x8c, 0x79, 0xe8, 0xd8, 0x21, 0xde, 0x31, 0xd6,
+    0x91, 0x63, 0x8c, 0x23, 0xc7, 0x0d, 0x1c, 0x64, 0x37, 0x10, 0x6d, 0x20, 0xce, 0xa8, 0x41, 0xa3,
+    0x46, 0xd4, 0x0c, 0x18, 0x32, 0x62, 0xc8, 0x80, 0x82, 0xd1, 0xe2, 0x85, 0x8b, 0x17, 0xd1, 0x16,
+    0x2a, 0x58, 0xac, 0x60, 0x01, 0x55, 0x71, 0x22, 0x05, 0x8a, 0x14, 0x4f, 0x27, 0x48, 0x98, 0x28,
+    0x61, 0xc2, 0x89, 0x44, 0x88, 0x11, 0x22, 0x46, 0x34, 0x85, 0xf0, 0x00, 0xe2, 0x03, 0x08, 0x26,
+    0x0f, 0x1c, 0x3a, 0x84, 0x3b, 0x2c, 0x71, 0xc8, 0xb0, 0x41, 0xc3, 0x06, 0xa5, 0x0c, 0x87, 0x18,
+    0x2e, 0x60, 0x78, 0x1e, 0x16, 0x1a, 0x5a, 0x30, 0x74, 0x16, 0x7e, 0xc1, 0x3b, 0xb8, 0xf9, 0xf5,
+    0xea, 0x15, 0x74, 0xa6, 0x97, 0xb0, 0x9b, 0x77, 0x97, 0x84, 0x14, 0xb8, 0x83, 0xdc, 0xa8, 0x92,
+    0x02, 0x9d, 0xc5, 0xb5, 0xf8, 0xb6, 0xce, 0xd6, 0xd7, 0x1b, 0x7b, 0xd3, 0xd7, 0x40, 0x41, 0x5b,
+    0x30, 0x19, 0xe8, 0x07, 0xf8, 0x07, 0x88, 0xf4, 0xe3, 0x9b, 0xd0, 0x37, 0xe1, 0xc8, 0xa7, 0xb7,
+    0x47, 0xb5, 0x37, 0xeb, 0xe1, 0xe5, 0x41, 0xf3, 0x64, 0x3c, 0xbb, 0xb6, 0xbb, 0xb7, 0x9b, 0xab,
+    0xab, 0xca, 0x59, 0xe9, 0xe6, 0xd0, 0xe2, 0xe4, 0xbc, 0xe2, 0xe0, 0x24, 0x4c, 0x97, 0xe0, 0xd4,
+    0xc8, 0xa8, 0x67, 0x6a, 0x69, 0x54, 0xb4, 0x34, 0x34, 0x08, 0x67, 0x0f, 0x20, 0x3c, 0x28, 0x33,
+    0x6b, 0x2a, 0xf3, 0x6a, 0x20, 0xc6, 0xe5, 0x40, 0x39, 0xd5, 0x92, 0x1b, 0x38, 0xa1, 0x63, 0x5a,
+    0x0c, 0xc2, 0xc4, 0xc0, 0xc2, 0xc0, 0xbe, 0x16, 0x7c, 0x69, 0x75, 0x79, 0xe8, 0xe2, 0xda, 0x4a,
+    0xb0, 0x85, 0x95, 0x25, 0xe9, 0x00, 0xd6, 0x01, 0x03, 0x58, 0x53, 0x4f, 0x06, 0xfe, 0xad, 0x0a,
+    0x28, 0x21, 0x20, 0x65, 0xba, 0xaa, 0xb2, 0xa2, 0x5a, 0xaa, 0xfa, 0xff, 0x97, 0x7a, 0x02, 0x89,
+    0x12, 0xa0, 0x18, 0x40, 0xda, 0x04, 0x20, 0x0a, 0x0a, 0xf5, 0x77, 0xa2, 0xe2, 0x36, 0x36, 0x32,
+    0xaf, 0x5a, 0xeb, 0xa9, 0x89, 0xc9, 0xb9, 0xc4, 0x64, 0xa0, 0xf4, 0x4e, 0xd3, 0xb1, 0x48, 0x5a,
+    0x5a, 0x10, 0xcc, 0xce, 0xce, 0x2a, 0x94, 0x3d, 0xd4, 0x5b, 0xa1, 0xcc, 0x4b, 0x13, 0x76, 0xb5,
+    0x53, 0xc1, 0x6e, 0xce, 0xdd, 0x12, 0x4e, 0xc9, 0x0d, 0x72, 0x5d, 0xec, 0x14, 0xf0, 0x41, 0x3e,
+    0x0a, 0x56, 0x5c, 0x6c, 0x9b, 0xc5, 0x6a, 0xef, 0x6c, 0xd9, 0x7d, 0xc5, 0x86, 0x19, 0xaf, 0x7f,
+    0x7c, 0x7e, 0x7f, 0x01, 0x89, 0xb0, 0xa8, 0xf4, 0x64, 0x3c, 0xba, 0x21, 0x0d, 0x82, 0x20, 0x68,
+    0x01, 0x53, 0x7a, 0x09, 0x03, 0xb4, 0xa4, 0xa4, 0x6e, 0x07, 0x34, 0xec, 0x21, 0x83, 0xa0, 0x0f,
+    0x51, 0x48, 0x88, 0x0b, 0x08, 0xc8, 0x00, 0x80, 0x02, 0xb0, 0x88, 0x48, 0x52, 0x24, 0x05, 0x23,
+    0x03, 0xfd, 0x19, 0x26, 0x95, 0x4c, 0xf3, 0x48, 0xc3, 0x5f, 0x43, 0xe5, 0xca, 0x41, 0x51, 0xdf,
+    0x02, 0x17, 0xe7, 0x35, 0xea, 0x0b, 0xd7, 0x86, 0xd5, 0x85, 0x69, 0x83, 0x4c, 0xb2, 0x07, 0x5e,
+    0xcb, 0xb9, 0x0a, 0x38, 0x14, 0xc3, 0x1c, 0x06, 0x46, 0x99, 0x56, 0xa5, 0xbe, 0xea, 0xbc, 0x58,
+    0xb5, 0x12, 0x54, 0xb3, 0xda, 0x2a, 0xae, 0x24, 0x6f, 0x77, 0x1e, 0xfb, 0xcc, 0x71, 0xa3, 0x09,
+    0x78, 0x8d, 0x2b, 0x6d, 0xac, 0x06, 0x6e, 0xa1, 0xfb, 0x4b, 0x65, 0x37, 0xfb, 0x7b, 0x14, 0xae,
+    0xbc, 0x67, 0x17, 0xae, 0x60, 0x90, 0xd7, 0xf1, 0x4f, 0x02, 0x91, 0x7e, 0xe2, 0x06, 0x1e, 0x96,
+    0x35, 0x68, 0xec, 0x0b, 0x2c, 0xc8, 0x85, 0x79, 0xb7, 0xb2, 0x09, 0x5d, 0x25, 0x76, 0x5d, 0xfd,
+    0xf6, 0xbd, 0x9d, 0x87, 0x0f, 0xec, 0xfa, 0x25, 0xda, 0xfd, 0x80, 0xfd, 0xfd, 0x62, 0x5c, 0x69,
+    0xcf, 0xaa, 0x75, 0x48, 0xdc, 0xb6, 0xb0, 0xfd, 0x49, 0xf3, 0x81, 0x25, 0xaf, 0x74, 0x1e, 0xb1,
+    0x15, 0xa0, 0x00, 0xab, 0x98, 0x82, 0x29, 0x07, 0x2e, 0x70, 0xed, 0x09, 0xda, 0x67, 0xa6, 0x00,
+    0xb4, 0x40, 0x05, 0xb6, 0x32, 0xa2, 0xc0, 0x1b, 0x2c, 0x79, 0xa5, 0xf3, 0x88, 0xad, 0x00, 0x05,
+    0x58, 0xc5, 0x14, 0x4c, 0x39, 0x70, 0x81, 0x6b, 0x4f, 0xd0, 0x3e, 0x33, 0x05, 0xa0, 0x05, 0x2a,
+    0xb0, 0x95, 0x11, 0x05, 0x8e, 0xaa, 0xce, 0x90, 0x60, 0x7c, 0xaa, 0x88, 0xd1, 0x84, 0xbe, 0x0c,
+    0x76, 0x0e, 0x18, 0xd5, 0x83, 0x89, 0x40, 0x9d, 0x24, 0xcb, 0x7e, 0xe4, 0x50, 0x69, 0x0f, 0x01,
+    0x9d, 0x03, 0x82, 0xfc, 0x61, 0x42, 0xd8, 0x06, 0x89, 0xbb, 0x0f, 0x59, 0xdc, 0xc8, 0x83, 0x48,
+    0x40, 0x20, 0xd3, 0x24, 0xc8, 0x44, 0x8d, 0x41, 0x39, 0x26, 0xd0, 0x3b, 0x46, 0x84, 0xad, 0x10,
+    0x39, 0xe3, 0x7b, 0xc2, 0x99, 0x92, 0x1e, 0x7e, 0x80, 0x1f, 0xab, 0xfe, 0x71, 0xbf, 0xbd, 0x60,
+    0xf5, 0x96, 0x89, 0x73, 0xf8, 0x46, 0x2e, 0x4d, 0xec, 0xe8, 0xd7, 0x90, 0x3d, 0x3c, 0xc9, 0x7a,
+    0x37, 0xe0, 0x7e, 0x59, 0x09, 0x31, 0x62, 0xf9, 0x51, 0xcb, 0x7f, 0xed, 0x98, 0x5b, 0x9a, 0x6d,
+    0xfd, 0x3d, 0xe1, 0x67, 0x8b, 0x49, 0x62, 0xa5, 0x9c, 0x11, 0x95, 0x01, 0x32, 0x0f, 0x19, 0x87,
+    0xf9, 0x94, 0xef, 0x86, 0x90, 0x79, 0xb7, 0xeb, 0x4f, 0x73, 0x11, 0x4e, 0xfc, 0x40, 0x36, 0xbf,
+    0xd1, 0x9b, 0x8b, 0xeb, 0x7d, 0x19, 0xe6, 0xcf, 0x08, 0xd4, 0x7c, 0xa3, 0xbb, 0x3a, 0x6b, 0x28,
+    0x38, 0x4f, 0xf8, 0xed, 0xa2, 0x1f, 0x37, 0xfb, 0xf3, 0x22, 0xb3, 0xf0, 0xe7, 0x1e, 0xad, 0x5d,
+    0x65, 0xb6, 0xa7, 0x8a, 0x64, 0x74, 0x12, 0xef, 0x73, 0x13, 0xf4, 0xc8, 0x4c, 0x9f, 0x26, 0x73,
+    0x64, 0xa9, 0xc1, 0x27, 0x87, 0xe7, 0xd6, 0x3e, 0xd9, 0xb6, 0xd4, 0x47, 0xba, 0x68, 0x33, 0x42,
+    0x74, 0x2c, 0x17, 0x77, 0x2b, 0x2a, 0x9f, 0x3f, 0x40, 0xfc, 0x06, 0xab, 0x6a, 0x41, 0x2e, 0xa3,
+    0x69, 0xf6, 0x06, 0x85, 0xdf, 0x43, 0x1b, 0xe4, 0xc5, 0x9a, 0xbf, 0x54, 0x47, 0x6f, 0xa4, 0x35,
+    0x12, 0x3a, 0xee, 0x6d, 0x9c, 0x94, 0xdc, 0x45, 0x53, 0x0f, 0x56, 0x5f, 0xf4, 0xdb, 0x20, 0x9f,
+    0xdf, 0x9b, 0x17, 0xd2, 0x96, 0x5f, 0x96, 0x3f, 0x19, 0x3d, 0x50, 0x40, 0xff, 0x5b, 0x96, 0x3d,
+    0x82, 0xf9, 0xaf, 0x97, 0x34, 0x6b, 0x2f, 0xfc, 0x9f, 0x40, 0xf8, 0x0f, 0x9b, 0xc3, 0xdd, 0xa3,
+    0x36, 0x1a, 0x68, 0xa3, 0x97, 0x2a, 0xdf, 0x1b, 0x1f, 0x0b, 0x63, 0xb9, 0xb9, 0xb8, 0x8a, 0x2c,
+    0xf0, 0x4d, 0xcf, 0x2b, 0xf5, 0xe4, 0x70, 0xcf, 0x5b, 0xae, 0xee, 0x0a, 0x02, 0xeb, 0xdd, 0xca,
+    0x36, 0xa1, 0x79, 0x07, 0x22, 0x99, 0xf7, 0x4e, 0xf5, 0x08, 0xf3, 0xd7, 0xaf, 0x81, 0xb6, 0x57,
+    0x0a, 0xd5, 0x13, 0x7c, 0xf1, 0x60, 0xd1, 0xcb, 0xc6, 0xfc, 0xb3, 0xf1, 0x45, 0x66, 0xbf, 0xe9,
+    0x06, 0xe7, 0xf3, 0x46, 0x29, 0x76, 0x51, 0x83, 0x16, 0x26, 0x67, 0xa1, 0xfd, 0xeb, 0xfe, 0x5e,
+    0xc9, 0xe0, 0xe8, 0xdd, 0xeb, 0x2c, 0x0b, 0x63, 0xf5, 0xfd, 0xff, 0x9e, 0x44, 0x40, 0x36, 0x5e,
+    0xdd, 0x2b, 0xa0, 0x7e, 0x93, 0xce, 0x24, 0x03, 0x6b, 0x3d, 0x60, 0xf7, 0x08, 0x38, 0x0e, 0xf8,
+    0xde, 0x25, 0xdf, 0x20, 0x5b, 0x17, 0x74, 0xb7, 0xe0, 0xa5, 0xe1, 0x3f, 0x27, 0x69, 0x3f, 0xad,
+    0x88, 0x82, 0xe3, 0x99, 0x1d, 0xb1, 0x1d, 0xa1, 0xf8, 0xe9, 0x57, 0xfe, 0x8b, 0x95, 0x78, 0xac,
+    0x10, 0x64, 0xbd, 0x0a, 0x3f, 0x04, 0x4d, 0x87, 0x88, 0xfd, 0x0e, 0xe7, 0xa2, 0xcf, 0xc4, 0x64,
+    0xab, 0xb3, 0x46, 0xc1, 0x53, 0x37, 0x8f, 0xa7, 0xf1, 0x03, 0x7d, 0x6f, 0x37, 0xbd, 0xd5, 0xfb,
+    0xfd, 0xec, 0x78, 0x7d, 0x8c, 0xb9, 0x87, 0x54, 0x5d, 0x0f, 0x18, 0x7c, 0x1f, 0xfc, 0x03, 0x30,
+    0x5c, 0xcf, 0x89, 0xd2, 0x0a, 0x4e, 0xc8, 0x8e, 0x4c, 0xbe, 0x7f, 0xcc, 0xb6, 0xde, 0x5e, 0x87,
+    0x7a, 0xae, 0x87, 0x2c, 0xf1, 0xdc, 0x0d, 0xd7, 0xe5, 0xd7, 0xe1, 0xc6, 0xc6, 0x01, 0xfc, 0x9c,
+    0x15, 0x17, 0xf2, 0xd3, 0x46, 0xdd, 0xe5, 0x21, 0x6e, 0xa9, 0xc7, 0x18, 0x88, 0xc7, 0xac, 0xd1,
+    0x4a, 0x77, 0x72, 0xb0, 0x31, 0x3e, 0xfa, 0xfa, 0xee, 0x04, 0x1a, 0x85, 0x47, 0xe8, 0xfd, 0xdc,
+    0x6f, 0xbe, 0x0b, 0x6e, 0x63, 0x90, 0x70, 0x21, 0x8a, 0xaf, 0xaa, 0xdf, 0xc1, 0x14, 0xb7, 0x3e,
+    0x60, 0xdb, 0xb7, 0x5f, 0xf4, 0x7a, 0x9d, 0x57, 0x3d, 0x7e, 0xf6, 0xb6, 0x95, 0xe0, 0x5a, 0xb6,
+    0x81, 0x2f, 0x3c, 0x62, 0x17, 0x30, 0x66, 0x37, 0x3e, 0xc5, 0xf7, 0x60, 0x47, 0x77, 0x78, 0xc4,
+    0xee, 0x61, 0xcc, 0x2e, 0x7d, 0x0a, 0x5f, 0x61, 0x8e, 0x2e, 0xf1, 0x08, 0xbb, 0x43, 0x98, 0x5d,
+    0xf8, 0x94, 0x6e, 0x3b, 0x10, 0xb1, 0xeb, 0x56, 0xb6, 0xde, 0x8e, 0xa9, 0xc1, 0x46, 0x5a, 0x34,
+    0xf2, 0xff, 0x22, 0xbe, 0x59, 0xa2, 0x4f, 0x67, 0x9d, 0xcd, 0x22, 0xfd, 0xbe, 0x3d, 0xe9, 0x6e,
+    0xc8, 0xd0, 0x20, 0xba, 0x1b, 0xad, 0xaa, 0x64, 0xc2, 0x69, 0xa3, 0xf6, 0x3f, 0x54, 0x0e, 0x82,
+    0xbb, 0xc4, 0xaa, 0xc2, 0xd6, 0xf6, 0x5d, 0xd8, 0x72, 0x53, 0xaf, 0x46, 0x4c, 0x3f, 0xb0, 0x09,
+    0xfd, 0x9b, 0xeb, 0xff, 0xcd, 0xb5, 0x36, 0x9e, 0x2b, 0x33, 0xd1, 0xef, 0x91, 0x7c, 0x23, 0x9e,
+    0x37, 0xac, 0x7d, 0xe1, 0xec, 0x1e, 0x66, 0xd0, 0x47, 0x6a, 0x90, 0xf7, 0x4d, 0x98, 0x09, 0x59,
+    0x4c, 0x4c, 0x8b, 0x35, 0x3d, 0xc0, 0xa3, 0x71, 0xaa, 0xd4, 0xed, 0xa9, 0x56, 0x7f, 0xd2, 0x19,
+    0xff, 0x4d, 0x0d, 0xa1, 0xe0, 0x75, 0x63, 0x15, 0x1f, 0x7a, 0x38, 0xcf, 0xa1, 0xa5, 0xfe, 0x56,
+    0xe8, 0xfa, 0xd0, 0x41, 0x63, 0x1b, 0x0d, 0xbc, 0xbc, 0x24, 0x7f, 0x92, 0xe3, 0x0d, 0x12, 0x74,
+    0x7f, 0x16, 0xde, 0x71, 0xbc, 0x0a, 0xec, 0x37, 0x76, 0x89, 0x2c, 0x91, 0x95, 0x31, 0xac, 0x94,
+    0x5f, 0x07, 0x29, 0x30, 0x94, 0x20, 0xa7, 0xc3, 0xa1, 0x3b, 0x00, 0x95, 0x67, 0xa6, 0x69, 0x64,
+    0x54, 0xe4, 0x7a, 0x80, 0xd4, 0xee, 0x79, 0xca, 0x01, 0xc1, 0xa7, 0xc6, 0x9f, 0x21, 0xb8, 0x3d,
+    0x5f, 0xf8, 0x7f, 0x9e, 0xcb, 0xba, 0xf9, 0xf7, 0x78, 0xd0, 0xee, 0xf4, 0xdd, 0x4c, 0x12, 0xd0,
+    0x6a, 0x5a, 0x6c, 0xc6, 0x8b, 0xa9, 0x20, 0xc1, 0xc1, 0x88, 0x89, 0x7e, 0x05, 0x00, 0x50, 0x78,
+    0x0e, 0x59, 0xc7, 0xcd, 0x89, 0x73, 0x87, 0xe9, 0xcf, 0xae, 0x8a, 0xb5, 0x02, 0xf5, 0x3d, 0x07,
+    0x84, 0xb0, 0x79, 0x42, 0x6d, 0x13, 0x6a, 0xf9, 0x4b, 0xac, 0x23, 0x69, 0xcc, 0x5e, 0x1f, 0xd2,
+    0xdd, 0x01, 0xce, 0x29, 0x16, 0xd0, 0x69, 0x85, 0x68, 0x94, 0xfe, 0x5b, 0xbf, 0x39, 0x36, 0x33,
+    0x3c, 0x5b, 0xb5, 0xe6, 0x5b, 0x45, 0xd8, 0x5b, 0xe9, 0x67, 0xa7, 0xb9, 0xf7, 0x5f, 0xe5, 0xfc,
+    0x1b, 0xd3, 0xcd, 0x1c, 0x1e, 0x85, 0x0b, 0xd9, 0x6c, 0x7a, 0x79, 0xaa, 0xe3, 0x63, 0xa2, 0x96,
+    0xf9, 0x26, 0xcb, 0x88, 0x75, 0xb6, 0x8b, 0xf0, 0x97, 0x57, 0xed, 0xc2, 0x49, 0x87, 0x0c, 0xd1,
+    0xe5, 0xf7, 0x18, 0xef, 0x3b, 0xc1, 0x10, 0xa6, 0x03, 0xde, 0x95, 0xef, 0x40, 0x37, 0x6f, 0xa3,
+    0xbc, 0xdf, 0x19, 0x47, 0xa0, 0x4e, 0xff, 0x0c, 0x0b, 0x59, 0xe3, 0x8a, 0x34, 0x8a, 0xc3, 0xb9,
+    0x2e, 0x73, 0xe4, 0x35, 0xed, 0xcd, 0x71, 0x0d, 0xe5, 0x91, 0xcf, 0xcd, 0xa1, 0x7c, 0x66, 0xc4,
+    0x6e, 0x13, 0x35, 0xaf, 0x24, 0x93, 0xb9, 0x17, 0x28, 0x1d, 0x4b, 0x7c, 0xc5, 0x27, 0xee, 0xf5,
+    0x55, 0x74, 0x5e, 0x51, 0x1e, 0x05, 0x5d, 0xd1, 0x95, 0x9d, 0x7f, 0x27, 0xb8, 0xa5, 0xad, 0xa9,
+    0x9e, 0xfb, 0x9b, 0xbd, 0xf2, 0x7a, 0xab, 0x33, 0xff, 0x53, 0x5a, 0xe2, 0x8c, 0x1c, 0xfd, 0x0d,
+    0x97, 0x2b, 0xe4, 0xf9, 0xe7, 0x00, 0x17, 0xfc, 0xea, 0x55, 0xad, 0x48, 0xfe, 0x97, 0xec, 0x62,
+    0x96, 0x74, 0x54, 0xc6, 0xc9, 0xcc, 0x1c, 0xf5, 0xf9, 0xdb, 0xed, 0x0b, 0x7a, 0x8e, 0x1d, 0x7e,
+    0x98, 0x8a, 0x86, 0x8a, 0xcc, 0x53, 0x64, 0x10, 0xa7, 0x31, 0x37, 0xc5, 0x02, 0x8b, 0xf8, 0x88,
+    0x3b, 0xe3, 0x24, 0xa6, 0xdc, 0x87, 0x2d, 0xb4, 0xa9, 0x2d, 0xde, 0x9c, 0xc6, 0x48, 0x78, 0xa9,
+    0x70, 0x71, 0x11, 0xc7, 0x9d, 0x75, 0xa0, 0x38, 0xfc, 0x1b, 0x67, 0xea, 0xf5, 0xa8, 0xc3, 0x8c,
+    0x1e, 0x54, 0x74, 0xf2, 0xb0, 0xbb, 0xce, 0x0e, 0x77, 0x61, 0x26, 0x39, 0x3a, 0xc9, 0xdc, 0x3c,
+    0xa3, 0x93, 0x2d, 0xd6, 0x9b, 0x07, 0x8f, 0x43, 0x60, 0xfb, 0xe3, 0x2f, 0xa6, 0x8d, 0x76, 0xcc,
+    0xe5, 0x08, 0x41, 0xc9, 0xef, 0xf7, 0x6b, 0x66, 0xa7, 0xc0, 0x11, 0x14, 0x58, 0x00, 0x9d, 0x27,
+    0x04, 0xd0, 0xc1, 0xe7, 0xdc, 0x17, 0x72, 0xe4, 0x92, 0xf1, 0x89, 0x26, 0x43, 0x18, 0xc3, 0x47,
+    0xb1, 0xac, 0xcc, 0x4c, 0x55, 0x17, 0xef, 0x5a, 0x17, 0xf3, 0x99, 0x83, 0x86, 0xf7, 0x81, 0xae,
+    0x3a, 0x2e, 0x51, 0x98, 0xc9, 0xd5, 0x25, 0xf3, 0xd0, 0xc2, 0x81, 0xdc, 0x67, 0xd9, 0xbd, 0x2f,
+    0x74, 0x06, 0x6f, 0xa0, 0x15, 0x60, 0x6b, 0xf4, 0xcf, 0x1c, 0x98, 0x23, 0x31, 0x97, 0x1d, 0x30,
+    0x33, 0xf8, 0x8d, 0x03, 0x84, 0x0d, 0xec, 0x17, 0x67, 0x1a, 0xca, 0x0f, 0xe1, 0x3a, 0xe5, 0xc9,
+    0x9c, 0x6f, 0x6d, 0xb2, 0x1f, 0x8b, 0xd4, 0x04, 0x89, 0xad, 0x5c, 0xd7, 0x44, 0xde, 0x30, 0x83,
+    0x61, 0xe8, 0x89, 0x50, 0x25, 0x0c, 0x9d, 0xec, 0x90, 0x33, 0x26, 0x0d, 0x49, 0x22, 0x9e, 0xe5,
+    0xa2, 0xff, 0x6e, 0x30, 0xbb, 0x47, 0xd6, 0x5b, 0x22, 0x09, 0xd9, 0xd9, 0xf7, 0x4d, 0xb4, 0x16,
+    0x20, 0x3f, 0x74, 0x7a, 0x0e, 0x4e, 0xf9, 0xe6, 0xc1, 0xbc, 0xe5, 0x2c, 0xf1, 0x2d, 0xb7, 0x2b,
+    0xd1, 0x3f, 0xf5, 0xd3, 0x27, 0xc7, 0xb8, 0xfa, 0xa3, 0xdf, 0x26, 0x5e, 0x69, 0xf1, 0x5d, 0xbe,
+    0xaf, 0x01, 0xd8, 0xc2, 0xee, 0xa4, 0x2f, 0xd0, 0x78, 0xa6, 0x2e, 0x82, 0x2d, 0x98, 0x78, 0xd8,
+    0x06, 0x31, 0x82, 0x56, 0xfb, 0x0c, 0x66, 0x68, 0xc8, 0x19, 0xc0, 0xf5, 0x8a, 0x25, 0xb4, 0x26,
+    0xcf, 0xca, 0x5c, 0xd4, 0xee, 0x98, 0x80, 0x7b, 0xdc, 0x1e, 0xb7, 0x2f, 0xbe, 0xb4, 0x5b, 0xb4,
+    0x7b, 0xe2, 0xe0, 0xe7, 0x22, 0x8b, 0x7f, 0xae, 0x56, 0xbe, 0x4e, 0x37, 0x61, 0x73, 0x2e, 0xe8,
+    0x0c, 0x71, 0x86, 0xbc, 0x09, 0x03, 0x16, 0xd3, 0xf3, 0x15, 0x98, 0x46, 0x58, 0x57, 0xe7, 0x6d,
+    0xa3, 0xfa, 0x43, 0x00, 0x59, 0x57, 0xf0, 0x41, 0xea, 0xc8, 0xc5, 0xc2, 0x32, 0x0f, 0x95, 0x5e,
+    0xff, 0x80, 0xe1, 0x85, 0x18, 0xd4, 0xf8, 0x41, 0x7e, 0xb6, 0x93, 0xab, 0x28, 0x7e, 0x1e, 0x0e,
+    0xe0, 0xfd, 0x0c, 0x8f, 0x93, 0xb1, 0x09, 0x79, 0xbd, 0xd4, 0xcc, 0x97, 0x37, 0xdc, 0xc2, 0xeb,
+    0xe8, 0x55, 0x79, 0xc2, 0x89, 0x06, 0x3c, 0x85, 0xe5, 0x26, 0xc6, 0x33, 0x22, 0x4f, 0x92, 0x2f,
+    0x23, 0xc7, 0x3b, 0xf7, 0x30, 0x4d, 0xb8, 0x6a, 0x43, 0xe7, 0xb0, 0xb6, 0xd1, 0x68, 0x76, 0x46,
+    0xae, 0x0e, 0x4b, 0xee, 0x4f, 0x84, 0xa5, 0xa0, 0xcd, 0xdc, 0x82, 0xac, 0x0d, 0x4a, 0xe8, 0x7d,
+    0xbd, 0x14, 0x06, 0x87, 0x89, 0x74, 0x8e, 0x87, 0x5a, 0x09, 0x01, 0xa1, 0xf9, 0xae, 0x65, 0x41,
+    0x52, 0x9a, 0x8a, 0xf8, 0xd1, 0x3c, 0x42, 0x04, 0x6c, 0xe4, 0x74, 0x03, 0xe5, 0x5e, 0x0d, 0x37,
+    0x04, 0xd8, 0x27, 0xce, 0xaf, 0xeb, 0x02, 0xc2, 0x20, 0xe5, 0x10, 0x14, 0xa7, 0x75, 0x93, 0xaa,
+    0x50, 0xbd, 0x55, 0x13, 0x8c, 0x28, 0xfe, 0x84, 0xcb, 0x63, 0x11, 0x8f, 0xa4, 0x7f, 0x98, 0xf7,
+    0xf1, 0x11, 0x19, 0xcd, 0x62, 0xaf, 0xfb, 0xd2, 0xc2, 0x3c, 0x56, 0x99, 0x2e, 0xab, 0x04, 0x36,
+    0xb8, 0xe7, 0xbf, 0x26, 0x1d, 0xc4, 0x2f, 0x8c, 0x3f, 0x57, 0xc9, 0x2e, 0xac, 0x3f, 0x32, 0xfc,
+    0x93, 0x6c, 0x59, 0xe1, 0x93, 0xa3, 0xfb, 0x4d, 0x60, 0x47, 0x62, 0xfc, 0x03, 0x3e, 0x9d, 0x90,
+    0xb6, 0xc7, 0x3d, 0xd0, 0x2d, 0xc4, 0x43, 0xa8, 0x8a, 0xed, 0x75, 0xc2, 0x2c, 0x5a, 0x63, 0x22,
+    0x17, 0x19, 0x47, 0xfe, 0x75, 0xf4, 0x5e, 0x15, 0x2a, 0xe4, 0x08, 0x8a, 0x8d, 0xf5, 0x71, 0x8d,
+    0xe1, 0x40, 0x1c, 0x98, 0xc9, 0x10, 0xa4, 0xc1, 0x1b, 0xce, 0xbf, 0xce, 0xb5, 0xfb, 0xbe, 0x36,
+    0xc0, 0x61, 0x19, 0x67, 0x85, 0xf2, 0x1c, 0xd8, 0x14, 0xf9, 0xec, 0xc1, 0xc8, 0xe2, 0x2b, 0xfb,
+    0xc1, 0x11, 0xcc, 0xb3, 0x57, 0x8e, 0x1e, 0x43, 0xe6, 0x50, 0xe9, 0xa1, 0x0e, 0x6b, 0x27, 0xdd,
+    0x83, 0xa9, 0x34, 0x34, 0x3f, 0x12, 0x3d, 0x33, 0x16, 0x47, 0xe3, 0x9f, 0x41, 0x7f, 0xe8, 0xbf,
+    0x40, 0x7f, 0x49, 0xc9, 0x8d, 0x73, 0x7c, 0x91, 0x29, 0xe8, 0x02, 0xc1, 0x17, 0x74, 0x67, 0x04,
+    0xda, 0x73, 0xd1, 0x55, 0xf3, 0xe0, 0xf7, 0x01, 0x19, 0x3e, 0xa0, 0xdb, 0x74, 0x6e, 0x8e, 0x37,
+    0xc5, 0xda, 0x21, 0xd3, 0xaf, 0xbc, 0xbf, 0x8b, 0x15, 0x60, 0x5f, 0xe2, 0x12, 0xff, 0xe1, 0x92,
+    0x37, 0xc6, 0x9b, 0xb7, 0x89, 0xd2, 0x03, 0xef, 0x01, 0x7b, 0xf6, 0xa6, 0xfa, 0xc0, 0x88, 0x3c,
+    0xc4, 0x9c, 0x3d, 0xa7, 0x3b, 0x4f, 0x6a, 0x0f, 0xe6, 0xaa, 0x9d, 0x73, 0x7f, 0x78, 0x9c, 0x34,
+    0x95, 0x7f, 0x2c, 0x88, 0xfb, 0xe4, 0x8f, 0x50, 0x89, 0xab, 0xa8, 0x43, 0x43, 0x9e, 0x94, 0x58,
+    0x19, 0x18, 0x48, 0x80, 0x4c, 0xad, 0xee, 0x8d, 0xf5, 0x5c, 0xa8, 0x19, 0xeb, 0xcb, 0x43, 0xe3,
+    0x8f, 0xa0, 0x43, 0xac, 0x17, 0x5f, 0x97, 0x92, 0x55, 0x1e, 0xf7, 0xc3, 0xdb, 0xf3, 0x5b, 0xc5,
+    0xb6, 0xc9, 0x4f, 0x86, 0x87, 0xac, 0xb2, 0x42, 0x16, 0x36, 0x9c, 0x4b, 0x63, 0xfd, 0x13, 0xbc,
+    0xd7, 0x53, 0xa5, 0xfa, 0x3d, 0x62, 0xca, 0x35, 0x5c, 0x96, 0x59, 0x30, 0x61, 0x7a, 0x45, 0x4a,
+    0xe1, 0xfc, 0xab, 0x80, 0xe4, 0xb2, 0x26, 0x69, 0x34, 0x5b, 0x96, 0xe9, 0x40, 0x7a, 0xdf, 0x15,
+    0x65, 0xd9, 0x8a, 0x57, 0x21, 0xd1, 0xf0, 0x76, 0x92, 0xbe, 0x7e, 0xcb, 0x7e, 0x51, 0xc1, 0xc7,
+    0x33, 0xa3, 0xf1, 0x54, 0xb6, 0xe2, 0xbf, 0x16, 0xa4, 0x95, 0x57, 0xbc, 0xbb, 0x4c, 0xd4, 0xd2,
+    0xf8, 0xd3, 0xf6, 0xc0, 0x78, 0xa0, 0xf5, 0x70, 0xaf, 0x40, 0x2a, 0x80, 0xcd, 0x7c, 0x1d, 0x91,
+    0x83, 0xcb, 0x0d, 0x8f, 0xbb, 0x8a, 0xda, 0x60, 0xe2, 0x46, 0x38, 0x9f, 0x8c, 0x5f, 0x02, 0x1b,
+    0xdc, 0x05, 0xad, 0x1d, 0x06, 0xe2, 0x73, 0x3d, 0xc7, 0x16, 0x91, 0x47, 0xd0, 0x9b, 0x5d, 0x58,
+    0x0f, 0x1e, 0x74, 0x4e, 0x89, 0x73, 0xfd, 0x81, 0xff, 0xf3, 0xeb, 0xa9, 0xa7, 0x47, 0x2f, 0xbd,
+    0x75, 0x28, 0x16, 0x51, 0x89, 0x36, 0xf5, 0x8c, 0x73, 0x2f, 0x1c, 0x28, 0x13, 0x6e, 0xe9, 0x7b,
+    0xeb, 0xd5, 0xdb, 0x73, 0xc1, 0xb7, 0x81, 0x46, 0x4f, 0x83, 0x03, 0x0e, 0x3e, 0xb0, 0x84, 0x61,
+    0x90, 0x0e, 0x16, 0xf5, 0x76, 0x9b, 0xd8, 0x8b, 0xce, 0x96, 0x2b, 0xf1, 0x06, 0x7f, 0xa7, 0xa9,
+    0x0c, 0xff, 0xdc, 0xac, 0x7f, 0x19, 0xa7, 0xe7, 0xe8, 0x95, 0x6b, 0x7c, 0x3f, 0x06, 0xf0, 0x18,
+    0x60, 0x83, 0xde, 0x66, 0x75, 0x28, 0xed, 0x36, 0xa0, 0x76, 0xbe, 0xee, 0xa6, 0xeb, 0x04, 0xd2,
+    0xd2, 0x17, 0xe0, 0x4a, 0xb2, 0x6a, 0xb8, 0x8c, 0xcb, 0xf9, 0x86, 0x63, 0xd1, 0x81, 0x8b, 0xbf,
+    0x0b, 0x7b, 0xb2, 0x8f, 0x81, 0xbe, 0xbd, 0x4a, 0x42, 0x0b, 0x7a, 0x67, 0x92, 0x3d, 0xa6, 0x6c,
+    0xaa, 0x9b, 0x7d, 0x68, 0x33, 0xed, 0x5c, 0x70, 0x21, 0xe3, 0xf0, 0x82, 0x27, 0xa2, 0x9d, 0xdc,
+    0xed, 0xdc, 0x12, 0xc1, 0xb7, 0xd4, 0x27, 0x56, 0x0c, 0xff, 0x05, 0x76, 0xff, 0x3f, 0x04, 0x84,
+    0xf2, 0xb9, 0x59, 0x4c, 0x38, 0x6d, 0x28, 0x0c, 0x2f, 0xf7, 0x62, 0x99, 0x2c, 0x7b, 0x8f, 0x4e,
+    0xa7, 0x24, 0x7c, 0x85, 0x45, 0x8e, 0xb5, 0xb1, 0x76, 0xa5, 0x49, 0x0b, 0xae, 0x0e, 0xce, 0xa9,
+    0x1d, 0x4c, 0x3c, 0xc9, 0xf7, 0xca, 0x6b, 0x03, 0xd1, 0x8f, 0x24, 0x00, 0x8d, 0x9d, 0xcf, 0x50,
+    0xe6, 0xd8, 0x94, 0x9d, 0xb8, 0x4f, 0xfd, 0xbf, 0xef, 0x32, 0x95, 0x5a, 0x25, 0x0b, 0x04, 0x6f,
+    0x6f, 0xf8, 0x84, 0xdf, 0x1f,
 };
+const ShaderModule Blob040 = { Blob040_Data, 4949u, 4808u, 40u };
 
-extern const uint32_t Blob078[4812];
-const uint32_t Blob078[4812] = {
-    0x07230203, 0x00010300, 0x0008000b, 0x0000027d, 0x00000000, 0x00020011, 0x00000001, 0x0006000b,
-    0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001,
-    0x0007000f, 0x00000005, 0x00000004, 0x6e69616d, 0x00000000, 0x00000117, 0x00000122, 0x00060010,
-    0x00000004, 0x00000011, 0x00000030, 0x00000001, 0x00000001, 0x00030003, 0x00000002, 0x000001c2,
-    0x000a0004, 0x475f4c47, 0x4c474f4f, 0x70635f45, 0x74735f70, 0x5f656c79, 0x656e696c, 0x7269645f,
-    0x69746365, 0x00006576, 0x00080004, 0x475f4c47, 0x4c474f4f, 0x6e695f45, 0x64756c63, 0x69645f65,
-    0x74636572, 0x00657669, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000, 0x00040005, 0x00000009,
-    0x796c6f50, 0x006e6f67, 0x00060006, 0x00000009, 0x00000000, 0x73726946, 0x70535874, 0x00006e61,
-    0x00050006, 0x00000009, 0x00000001, 0x706f5459, 0x00000000, 0x00050006, 0x00000009, 0x00000002,
-    0x746f4259, 0x00000000, 0x00050006, 0x00000009, 0x00000003, 0x6e694d58, 0x00000000, 0x00050006,
-    0x00000009, 0x00000004, 0x78614d58, 0x00000000, 0x00050006, 0x00000009, 0x00000005, 0x6e694d58,
-    0x00000059, 0x00050006, 0x00000009, 0x00000006, 0x78614d58, 0x00000059, 0x00050006, 0x00000009,
-    0x00000007, 0x69726156, 0x00746e61, 0x00050006, 0x00000009, 0x00000008, 0x72747441, 0x00000000,
-    0x00070006, 0x00000009, 0x00000009, 0x74786554, 0x4c657275, 0x72657961, 0x00000000, 0x00060006,
-    0x00000009, 0x0000000a, 0x69636146, 0x6956676e, 0x00007765, 0x00140005, 0x00000012, 0x506e6942,
-    0x67796c6f, 0x73286e6f, 0x63757274, 0x6f502d74, 0x6f67796c, 0x31692d6e, 0x2d31692d, 0x692d3169,
-    0x31692d31, 0x2d31692d, 0x692d3169, 0x31752d31, 0x2d31662d, 0x3b313175, 0x3b326976, 0x3b326976,
-    0x00000000, 0x00040005, 0x0000000f, 0x796c6f70, 0x006e6f67, 0x00040005, 0x00000010, 0x4c706f74,
-    0x00746665, 0x00050005, 0x00000011, 0x52746f62, 0x74686769, 0x00000000, 0x00060005, 0x0000002a,
-    0x796c6f70, 0x486e6f67, 0x68676965, 0x00000074, 0x00060005, 0x00000030, 0x796c6f70, 0x656e6e49,
-    0x706f5472, 0x00000059, 0x00060005, 0x0000003b, 0x796c6f70, 0x656e6e49, 0x746f4272, 0x00000059,
-    0x00050005, 0x00000045, 0x61705358, 0x7465536e, 0x00007075, 0x00040006, 0x00000045, 0x00000000,
-    0x00003058, 0x00040006, 0x00000045, 0x00000001, 0x00003158, 0x00060006, 0x00000045, 0x00000002,
-    0x69736e49, 0x74536564, 0x00747261, 0x00060006, 0x00000045, 0x00000003, 0x69736e49, 0x6e456564,
-    0x00000064, 0x00060006, 0x00000045, 0x00000004, 0x65676445, 0x4c766f43, 0x00000000, 0x00060006,
-    0x00000045, 0x00000005, 0x65676445, 0x52766f43, 0x00000000, 0x00050006, 0x00000045, 0x00000006,
-    0x63655258, 0x00007069, 0x00050006, 0x00000045, 0x00000007, 0x67616c46, 0x00000073, 0x00040006,
-    0x00000045, 0x00000008, 0x0000305a, 0x00040006, 0x00000045, 0x00000009, 0x0000315a, 0x00040006,
-    0x00000045, 0x0000000a, 0x00003057, 0x00040006, 0x00000045, 0x0000000b, 0x00003157, 0x00050006,
-    0x00000045, 0x0000000c, 0x6f6c6f43, 0x00305272, 0x00050006, 0x00000045, 0x0000000d, 0x6f6c6f43,
-    0x00304772, 0x00050006, 0x00000045, 0x0000000e, 0x6f6c6f43, 0x00304272, 0x00050006, 0x00000045,
-    0x0000000f, 0x6f6c6f43, 0x00315272, 0x00050006, 0x00000045, 0x00000010, 0x6f6c6f43, 0x00314772,
-    0x00050006, 0x00000045, 0x00000011, 0x6f6c6f43, 0x00314272, 0x00060006, 0x00000045, 0x00000012,
-    0x63786554, 0x64726f6f, 0x00003055, 0x00060006, 0x00000045, 0x00000013, 0x63786554, 0x64726f6f,
-    0x00003056, 0x00060006, 0x00000045, 0x00000014, 0x63786554, 0x64726f6f, 0x00003155, 0x00060006,
-    0x00000045, 0x00000015, 0x63786554, 0x64726f6f, 0x00003156, 0x00060006, 0x00000045, 0x00000016,
-    0x4c766f43, 0x74696e49, 0x006c6169, 0x00060006, 0x00000045, 0x00000017, 0x52766f43, 0x74696e49,
-    0x006c6169, 0x00050005, 0x00000047, 0x61707378, 0x706f546e, 0x00000000, 0x00050005, 0x00000048,
-    0x61705358, 0x7465536e, 0x00007075, 0x00040006, 0x00000048, 0x00000000, 0x00003058, 0x00040006,
-    0x00000048, 0x00000001, 0x00003158, 0x00060006, 0x00000048, 0x00000002, 0x69736e49, 0x74536564,
-    0x00747261, 0x00060006, 0x00000048, 0x00000003, 0x69736e49, 0x6e456564, 0x00000064, 0x00060006,
-    0x00000048, 0x00000004, 0x65676445, 0x4c766f43, 0x00000000, 0x00060006, 0x00000048, 0x00000005,
-    0x65676445, 0x52766f43, 0x00000000, 0x00050006, 0x00000048, 0x00000006, 0x63655258, 0x00007069,
-    0x00050006, 0x00000048, 0x00000007, 0x67616c46, 0x00000073, 0x00040006, 0x00000048, 0x00000008,
-    0x0000305a, 0x00040006, 0x00000048, 0x00000009, 0x0000315a, 0x00040006, 0x00000048, 0x0000000a,
-    0x00003057, 0x00040006, 0x00000048, 0x0000000b, 0x00003157, 0x00050006, 0x00000048, 0x0000000c,
-    0x6f6c6f43, 0x00305272, 0x00050006, 0x00000048, 0x0000000d, 0x6f6c6f43, 0x00304772, 0x00050006,
-    0x00000048, 0x0000000e, 0x6f6c6f43, 0x00304272, 0x00050006, 0x00000048, 0x0000000f, 0x6f6c6f43,
-    0x00315272, 0x00050006, 0x00000048, 0x00000010, 0x6f6c6f43, 0x00314772, 0x00050006, 0x00000048,
-    0x00000011, 0x6f6c6f43, 0x00314272, 0x00060006, 0x00000048, 0x00000012, 0x63786554, 0x64726f6f,
-    0x00003055, 0x00060006, 0x00000048, 0x00000013, 0x63786554, 0x64726f6f, 0x00003056, 0x00060006,
-    0x00000048, 0x00000014, 0x63786554, 0x64726f6f, 0x00003155, 0x00060006, 0x00000048, 0x00000015,
-    0x63786554, 0x64726f6f, 0x00003156, 0x00060006, 0x00000048, 0x00000016, 0x4c766f43, 0x74696e49,
-    0x006c6169, 0x00060006, 0x00000048, 0x00000017, 0x52766f43, 0x74696e49, 0x006c6169, 0x00070005,
-    0x0000004a, 0x61705358, 0x7465536e, 0x42737075, 0x65666675, 0x00000072, 0x00060006, 0x0000004a,
-    0x00000000, 0x61705358, 0x7465536e, 0x00737075, 0x00030005, 0x0000004c, 0x00000000, 0x00050005,
-    0x0000009a, 0x61707378, 0x746f426e, 0x00000000, 0x00040005, 0x000000e0, 0x586e696d, 0x0000004c,
-    0x00040005, 0x00000100, 0x5878616d, 0x00000052, 0x00050005, 0x00000114, 0x756f7267, 0x78644970,
-    0x00000000, 0x00060005, 0x00000117, 0x575f6c67, 0x476b726f, 0x70756f72, 0x00004449, 0x00050005,
-    0x0000011c, 0x72616f63, 0x69546573, 0x0000656c, 0x00050005, 0x00000121, 0x61636f6c, 0x7864496c,
-    0x00000000, 0x00080005, 0x00000122, 0x4c5f6c67, 0x6c61636f, 0x6f766e49, 0x69746163, 0x6e496e6f,
-    0x00786564, 0x00070005, 0x0000012a, 0x6772656d, 0x614d6465, 0x68536b73, 0x64657261, 0x00000000,
-    0x00060005, 0x0000012d, 0x61636f6c, 0x6c6f506c, 0x6e6f6779, 0x00786449, 0x00050005, 0x00000133,
-    0x796c6f70, 0x496e6f67, 0x00007864, 0x00060005, 0x00000134, 0x68737550, 0x736e6f43, 0x746e6174,
-    0x00000073, 0x00060006, 0x00000134, 0x00000000, 0x56727543, 0x61697261, 0x0000746e, 0x00060006,
-    0x00000134, 0x00000001, 0x57786554, 0x68746469, 0x00000000, 0x00060006, 0x00000134, 0x00000002,
-    0x48786554, 0x68676965, 0x00000074, 0x00060006, 0x00000134, 0x00000003, 0x57786554, 0x53706172,
-    0x00000000, 0x00060006, 0x00000134, 0x00000004, 0x57786554, 0x54706172, 0x00000000, 0x00070006,
-    0x00000134, 0x00000005, 0x49786554, 0x70614373, 0x65727574, 0x00000000, 0x00070006, 0x00000134,
-    0x00000006, 0x74706143, 0x59657275, 0x7366664f, 0x00007465, 0x00050006, 0x00000134, 0x00000007,
-    0x6461705f, 0x00000000, 0x00030005, 0x00000136, 0x00006370, 0x00060005, 0x0000013d, 0x72616f63,
-    0x6f546573, 0x66654c70, 0x00000074, 0x00060005, 0x00000143, 0x72616f63, 0x6f426573, 0x67695274,
-    0x00007468, 0x00040005, 0x0000014a, 0x6e6e6962, 0x00006465, 0x00050005, 0x0000015d, 0x6174654d,
-    0x66696e55, 0x006d726f, 0x00060006, 0x0000015d, 0x00000000, 0x506d754e, 0x67796c6f, 0x00736e6f,
-    0x00060006, 0x0000015d, 0x00000001, 0x566d754e, 0x61697261, 0x0073746e, 0x00060006, 0x0000015d,
-    0x00000002, 0x68706c41, 0x66655261, 0x00000000, 0x00050006, 0x0000015d, 0x00000003, 0x70736944,
-    0x00746e43, 0x00060006, 0x0000015d, 0x00000004, 0x6e6f6f54, 0x6c626154, 0x00000065, 0x00060006,
-    0x0000015d, 0x00000005, 0x61656c43, 0x6c6f4372, 0x0000726f, 0x00060006, 0x0000015d, 0x00000006,
-    0x61656c43, 0x70654472, 0x00006874, 0x00060006, 0x0000015d, 0x00000007, 0x61656c43, 0x74744172,
-    0x00000072, 0x00060006, 0x0000015d, 0x00000008, 0x4f676f46, 0x65736666, 0x00000074, 0x00060006,
-    0x0000015d, 0x00000009, 0x53676f46, 0x74666968, 0x00000000, 0x00060006, 0x0000015d, 0x0000000a,
-    0x43676f46, 0x726f6c6f, 0x00000000, 0x00080006, 0x0000015d, 0x0000000b, 0x61656c43, 0x74694272,
-    0x4f70616d, 0x65736666, 0x00000074, 0x00030005, 0x0000015f, 0x00000000, 0x00040005, 0x00000167,
-    0x796c6f50, 0x006e6f67, 0x00060006, 0x00000167, 0x00000000, 0x73726946, 0x70535874, 0x00006e61,
-    0x00050006, 0x00000167, 0x00000001, 0x706f5459, 0x00000000, 0x00050006, 0x00000167, 0x00000002,
-    0x746f4259, 0x00000000, 0x00050006, 0x00000167, 0x00000003, 0x6e694d58, 0x00000000, 0x00050006,
-    0x00000167, 0x00000004, 0x78614d58, 0x00000000, 0x00050006, 0x00000167, 0x00000005, 0x6e694d58,
-    0x00000059, 0x00050006, 0x00000167, 0x00000006, 0x78614d58, 0x00000059, 0x00050006, 0x00000167,
-    0x00000007, 0x69726156, 0x00746e61, 0x00050006, 0x00000167, 0x00000008, 0x72747441, 0x00000000,
-    0x00070006, 0x00000167, 0x00000009, 0x74786554, 0x4c657275, 0x72657961, 0x00000000, 0x00060006,
-    0x00000167, 0x0000000a, 0x69636146, 0x6956676e, 0x00007765, 0x00060005, 0x00000169, 0x796c6f50,
-    0x426e6f67, 0x65666675, 0x00000072, 0x00060006, 0x00000169, 0x00000000, 0x796c6f50, 0x736e6f67,
-    0x00000000, 0x00030005, 0x0000016b, 0x00000000, 0x00040005, 0x0000016d, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000188, 0x61726170, 0x0000006d, 0x00040005, 0x0000018a, 0x61726170, 0x0000006d,
-    0x00050005, 0x00000193, 0x6772656d, 0x614d6465, 0x00006b73, 0x00050005, 0x00000195, 0x656e6966,
-    0x656c6954, 0x00000000, 0x00060005, 0x0000019b, 0x656e6966, 0x656c6954, 0x4c706f54, 0x00746665,
-    0x00070005, 0x000001a1, 0x656e6966, 0x656c6954, 0x52746f42, 0x74686769, 0x00000000, 0x00050005,
-    0x000001a6, 0x6e6e6962, 0x614d6465, 0x00006b73, 0x00030005, 0x000001ae, 0x00746962, 0x00050005,
-    0x000001b6, 0x796c6f70, 0x496e6f67, 0x00007864, 0x00040005, 0x000001c0, 0x61726170, 0x0000006d,
-    0x00040005, 0x000001d9, 0x61726170, 0x0000006d, 0x00040005, 0x000001db, 0x61726170, 0x0000006d,
-    0x00050005, 0x000001e4, 0x656e696c, 0x69547261, 0x0000656c, 0x00050005, 0x000001e9, 0x65726353,
-    0x69576e65, 0x00687464, 0x00060005, 0x000001ea, 0x656c6954, 0x72655073, 0x656e694c, 0x00000000,
-    0x00050005, 0x000001f6, 0x6b726f77, 0x7366664f, 0x00007465, 0x00060005, 0x00000200, 0x526e6942,
-    0x6c757365, 0x66754274, 0x00726566, 0x00080006, 0x00000200, 0x00000000, 0x69726156, 0x57746e61,
-    0x436b726f, 0x746e756f, 0x00000000, 0x00080006, 0x00000200, 0x00000001, 0x74726f53, 0x6f576465,
-    0x664f6b72, 0x74657366, 0x00000000, 0x00090006, 0x00000200, 0x00000002, 0x69726156, 0x57746e61,
-    0x526b726f, 0x436c6165, 0x746e756f, 0x00000000, 0x00080006, 0x00000200, 0x00000003, 0x74726f53,
-    0x6b726f57, 0x6b726f57, 0x6e756f43, 0x00000074, 0x00090006, 0x00000200, 0x00000004, 0x6e6e6942,
-    0x4d676e69, 0x416b7361, 0x664f646e, 0x74657366, 0x00000000, 0x00030005, 0x00000202, 0x00000000,
-    0x00060005, 0x0000020a, 0x65726353, 0x65486e65, 0x74686769, 0x00000000, 0x00050005, 0x0000020b,
-    0x656c6954, 0x656e694c, 0x00000073, 0x00070005, 0x0000020e, 0x6e6e6942, 0x4d676e69, 0x536b7361,
-    0x74726174, 0x00000000, 0x00060005, 0x00000217, 0x72616f63, 0x614d6573, 0x64496b73, 0x00000078,
-    0x00080005, 0x0000022e, 0x6e6e6942, 0x57676e69, 0x4f6b726f, 0x65736666, 0x74537374, 0x00747261,
-    0x00080005, 0x00000236, 0x656c6974, 0x69736f50, 0x6e6f6974, 0x626d6f43, 0x64656e69, 0x00000000,
-    0x00030005, 0x0000023d, 0x00786469, 0x00030005, 0x00000245, 0x00746962, 0x00050005, 0x0000024d,
-    0x796c6f70, 0x496e6f67, 0x00007864, 0x00050005, 0x00000256, 0x69726176, 0x49746e61, 0x00007864,
-    0x00060005, 0x0000025b, 0x61566e69, 0x6e616972, 0x66664f74, 0x00746573, 0x00060005, 0x00000261,
-    0x6b726f57, 0x63736544, 0x66667542, 0x00007265, 0x00060006, 0x00000261, 0x00000000, 0x6b726f57,
-    0x63736544, 0x00000073, 0x00030005, 0x00000263, 0x00000000, 0x00060005, 0x00000273, 0x5778614d,
-    0x546b726f, 0x73656c69, 0x00000000, 0x00070005, 0x00000274, 0x6d617246, 0x66756265, 0x53726566,
-    0x64697274, 0x00000065, 0x00080005, 0x0000027a, 0x6b726f57, 0x63736544, 0x726f5373, 0x53646574,
-    0x74726174, 0x00000000, 0x00050048, 0x00000048, 0x00000000, 0x00000023, 0x00000000, 0x00050048,
-    0x00000048, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x00000048, 0x00000002, 0x00000023,
-    0x00000008, 0x00050048, 0x00000048, 0x00000003, 0x00000023, 0x0000000c, 0x00050048, 0x00000048,
-    0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x00000048, 0x00000005, 0x00000023, 0x00000014,
-    0x00050048, 0x00000048, 0x00000006, 0x00000023, 0x00000018, 0x00050048, 0x00000048, 0x00000007,
-    0x00000023, 0x0000001c, 0x00050048, 0x00000048, 0x00000008, 0x00000023, 0x00000020, 0x00050048,
-    0x00000048, 0x00000009, 0x00000023, 0x00000024, 0x00050048, 0x00000048, 0x0000000a, 0x00000023,
-    0x00000028, 0x00050048, 0x00000048, 0x0000000b, 0x00000023, 0x0000002c, 0x00050048, 0x00000048,
-    0x0000000c, 0x00000023, 0x00000030, 0x00050048, 0x00000048, 0x0000000d, 0x00000023, 0x00000034,
-    0x00050048, 0x00000048, 0x0000000e, 0x00000023, 0x00000038, 0x00050048, 0x00000048, 0x0000000f,
-    0x00000023, 0x0000003c, 0x00050048, 0x00000048, 0x00000010, 0x00000023, 0x00000040, 0x00050048,
-    0x00000048, 0x00000011, 0x00000023, 0x00000044, 0x00050048, 0x00000048, 0x00000012, 0x00000023,
-    0x00000048, 0x00050048, 0x00000048, 0x00000013, 0x00000023, 0x0000004c, 0x00050048, 0x00000048,
-    0x00000014, 0x00000023, 0x00000050, 0x00050048, 0x00000048, 0x00000015, 0x00000023, 0x00000054,
-    0x00050048, 0x00000048, 0x00000016, 0x00000023, 0x00000058, 0x00050048, 0x00000048, 0x00000017,
-    0x00000023, 0x0000005c, 0x00040047, 0x00000049, 0x00000006, 0x00000060, 0x00050048, 0x0000004a,
-    0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x0000004a, 0x00000002, 0x00040047, 0x0000004c,
-    0x00000022, 0x00000000, 0x00040047, 0x0000004c, 0x00000021, 0x00000002, 0x00040047, 0x00000117,
-    0x0000000b, 0x0000001a, 0x00040047, 0x00000122, 0x0000000b, 0x0000001d, 0x00050048, 0x00000134,
-    0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000134, 0x00000001, 0x00000023, 0x00000004,
-    0x00050048, 0x00000134, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x00000134, 0x00000003,
-    0x00000023, 0x0000000c, 0x00050048, 0x00000134, 0x00000004, 0x00000023, 0x00000010, 0x00050048,
-    0x00000134, 0x00000005, 0x00000023, 0x00000014, 0x00050048, 0x00000134, 0x00000006, 0x00000023,
-    0x00000018, 0x00050048, 0x00000134, 0x00000007, 0x00000023, 0x0000001c, 0x00030047, 0x00000134,
-    0x00000002, 0x00040047, 0x0000015b, 0x00000006, 0x00000010, 0x00050048, 0x0000015d, 0x00000000,
-    0x00000023, 0x00000000, 0x00050048, 0x0000015d, 0x00000001, 0x00000023, 0x00000004, 0x00050048,
-    0x0000015d, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x0000015d, 0x00000003, 0x00000023,
-    0x0000000c, 0x00050048, 0x0000015d, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x0000015d,
-    0x00000005, 0x00000023, 0x00000230, 0x00050048, 0x0000015d, 0x00000006, 0x00000023, 0x00000234,
-    0x00050048, 0x0000015d, 0x00000007, 0x00000023, 0x00000238, 0x00050048, 0x0000015d, 0x00000008,
-    0x00000023, 0x0000023c, 0x00050048, 0x0000015d, 0x00000009, 0x00000023, 0x00000240, 0x00050048,
-    0x0000015d, 0x0000000a, 0x00000023, 0x00000244, 0x00050048, 0x0000015d, 0x0000000b, 0x00000023,
-    0x00000248, 0x00030047, 0x0000015d, 0x00000002, 0x00040047, 0x0000015f, 0x00000022, 0x00000000,
-    0x00040047, 0x0000015f, 0x00000021, 0x00000000, 0x00050048, 0x00000167, 0x00000000, 0x00000023,
-    0x00000000, 0x00050048, 0x00000167, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x00000167,
-    0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x00000167, 0x00000003, 0x00000023, 0x0000000c,
-    0x00050048, 0x00000167, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x00000167, 0x00000005,
-    0x00000023, 0x00000014, 0x00050048, 0x00000167, 0x00000006, 0x00000023, 0x00000018, 0x00050048,
-    0x00000167, 0x00000007, 0x00000023, 0x0000001c, 0x00050048, 0x00000167, 0x00000008, 0x00000023,
-    0x00000020, 0x00050048, 0x00000167, 0x00000009, 0x00000023, 0x00000024, 0x00050048, 0x00000167,
-    0x0000000a, 0x00000023, 0x00000028, 0x00040047, 0x00000168, 0x00000006, 0x0000002c, 0x00040048,
-    0x00000169, 0x00000000, 0x00000018, 0x00050048, 0x00000169, 0x00000000, 0x00000023, 0x00000000,
-    0x00030047, 0x00000169, 0x00000002, 0x00040047, 0x0000016b, 0x00000022, 0x00000000, 0x00040047,
-    0x0000016b, 0x00000021, 0x00000001, 0x00040047, 0x000001e9, 0x00000001, 0x00000000, 0x00040047,
-    0x000001fc, 0x00000006, 0x00000010, 0x00040047, 0x000001fd, 0x00000006, 0x00000004, 0x00040047,
-    0x000001fe, 0x00000006, 0x00000004, 0x00040047, 0x000001ff, 0x00000006, 0x00000004, 0x00050048,
-    0x00000200, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000200, 0x00000001, 0x00000023,
-    0x00008000, 0x00050048, 0x00000200, 0x00000002, 0x00000023, 0x0000a000, 0x00050048, 0x00000200,
-    0x00000003, 0x00000023, 0x0000c000, 0x00050048, 0x00000200, 0x00000004, 0x00000023, 0x0000c010,
-    0x00030047, 0x00000200, 0x00000002, 0x00040047, 0x00000202, 0x00000022, 0x00000000, 0x00040047,
-    0x00000202, 0x00000021, 0x00000008, 0x00040047, 0x0000020a, 0x00000001, 0x00000001, 0x00040047,
-    0x00000260, 0x00000006, 0x00000008, 0x00050048, 0x00000261, 0x00000000, 0x00000023, 0x00000000,
-    0x00030047, 0x00000261, 0x00000002, 0x00040047, 0x00000263, 0x00000022, 0x00000000, 0x00040047,
-    0x00000263, 0x00000021, 0x00000009, 0x00040047, 0x00000273, 0x00000001, 0x00000002, 0x00040047,
-    0x0000027c, 0x0000000b, 0x00000019, 0x00020013, 0x00000002, 0x00030021, 0x00000003, 0x00000002,
-    0x00040015, 0x00000006, 0x00000020, 0x00000001, 0x00040015, 0x00000007, 0x00000020, 0x00000000,
-    0x00030016, 0x00000008, 0x00000020, 0x000d001e, 0x00000009, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000007, 0x00000008, 0x00000007,
-    0x00040020, 0x0000000a, 0x00000007, 0x00000009, 0x00040017, 0x0000000b, 0x00000006, 0x00000002,
-    0x00040020, 0x0000000c, 0x00000007, 0x0000000b, 0x00020014, 0x0000000d, 0x00060021, 0x0000000e,
-    0x0000000d, 0x0000000a, 0x0000000c, 0x0000000c, 0x0004002b, 0x00000006, 0x00000014, 0x00000001,
-    0x00040020, 0x00000015, 0x00000007, 0x00000006, 0x0004002b, 0x00000007, 0x00000018, 0x00000001,
-    0x0004002b, 0x00000006, 0x0000001f, 0x00000002, 0x0003002a, 0x0000000d, 0x00000028, 0x0004002b,
-    0x00000006, 0x00000036, 0x00000000, 0x001a001e, 0x00000045, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000007, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00040020, 0x00000046, 0x00000007,
-    0x00000045, 0x001a001e, 0x00000048, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000007, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x0003001d, 0x00000049, 0x00000048, 0x0003001e, 0x0000004a,
-    0x00000049, 0x00040020, 0x0000004b, 0x0000000c, 0x0000004a, 0x0004003b, 0x0000004b, 0x0000004c,
-    0x0000000c, 0x00040020, 0x00000051, 0x0000000c, 0x00000048, 0x0004002b, 0x00000006, 0x0000005b,
-    0x00000003, 0x0004002b, 0x00000006, 0x0000005e, 0x00000004, 0x0004002b, 0x00000006, 0x00000061,
-    0x00000005, 0x0004002b, 0x00000006, 0x00000064, 0x00000006, 0x0004002b, 0x00000006, 0x00000067,
-    0x00000007, 0x00040020, 0x00000068, 0x00000007, 0x00000007, 0x0004002b, 0x00000006, 0x0000006b,
-    0x00000008, 0x0004002b, 0x00000006, 0x0000006e, 0x00000009, 0x0004002b, 0x00000006, 0x00000071,
-    0x0000000a, 0x0004002b, 0x00000006, 0x00000074, 0x0000000b, 0x0004002b, 0x00000006, 0x00000077,
-    0x0000000c, 0x0004002b, 0x00000006, 0x0000007a, 0x0000000d, 0x0004002b, 0x00000006, 0x0000007d,
-    0x0000000e, 0x0004002b, 0x00000006, 0x00000080, 0x0000000f, 0x0004002b, 0x00000006, 0x00000083,
-    0x00000010, 0x0004002b, 0x00000006, 0x00000086, 0x00000011, 0x0004002b, 0x00000006, 0x00000089,
-    0x00000012, 0x0004002b, 0x00000006, 0x0000008c, 0x00000013, 0x0004002b, 0x00000006, 0x0000008f,
-    0x00000014, 0x0004002b, 0x00000006, 0x00000092, 0x00000015, 0x0004002b, 0x00000006, 0x00000095,
-    0x00000016, 0x0004002b, 0x00000006, 0x00000098, 0x00000017, 0x0004002b, 0x00000007, 0x000000ea,
-    0x00000000, 0x00030029, 0x0000000d, 0x00000111, 0x00040017, 0x00000115, 0x00000007, 0x00000003,
-    0x00040020, 0x00000116, 0x00000001, 0x00000115, 0x0004003b, 0x00000116, 0x00000117, 0x00000001,
-    0x00040020, 0x00000118, 0x00000001, 0x00000007, 0x00040017, 0x0000011d, 0x00000007, 0x00000002,
-    0x0004003b, 0x00000118, 0x00000122, 0x00000001, 0x00040020, 0x00000129, 0x00000004, 0x00000007,
-    0x0004003b, 0x00000129, 0x0000012a, 0x00000004, 0x0004002b, 0x00000007, 0x0000012b, 0x00000002,
-    0x0004002b, 0x00000007, 0x0000012c, 0x00000108, 0x0004002b, 0x00000006, 0x0000012f, 0x00000020,
-    0x000a001e, 0x00000134, 0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00000007,
-    0x00000006, 0x00000007, 0x00040020, 0x00000135, 0x00000009, 0x00000134, 0x0004003b, 0x00000135,
-    0x00000136, 0x00000009, 0x00040020, 0x00000137, 0x00000009, 0x00000007, 0x0004002b, 0x00000006,
-    0x0000013f, 0x00000100, 0x0004002b, 0x00000006, 0x00000140, 0x000000c0, 0x0005002c, 0x0000000b,
-    0x00000141, 0x0000013f, 0x00000140, 0x0004002b, 0x00000006, 0x00000145, 0x000000ff, 0x0004002b,
-    0x00000006, 0x00000146, 0x000000bf, 0x0005002c, 0x0000000b, 0x00000147, 0x00000145, 0x00000146,
-    0x00040020, 0x00000149, 0x00000007, 0x0000000d, 0x00040017, 0x00000159, 0x00000007, 0x00000004,
-    0x0004002b, 0x00000007, 0x0000015a, 0x00000022, 0x0004001c, 0x0000015b, 0x00000159, 0x0000015a,
-    0x00040017, 0x0000015c, 0x00000008, 0x00000002, 0x000e001e, 0x0000015d, 0x00000007, 0x00000007,
-    0x00000006, 0x00000007, 0x0000015b, 0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00000007,
-    0x00000007, 0x0000015c, 0x00040020, 0x0000015e, 0x00000002, 0x0000015d, 0x0004003b, 0x0000015e,
-    0x0000015f, 0x00000002, 0x00040020, 0x00000160, 0x00000002, 0x00000007, 0x000d001e, 0x00000167,
-    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000007, 0x00000008, 0x00000007, 0x0003001d, 0x00000168, 0x00000167, 0x0003001e, 0x00000169,
-    0x00000168, 0x00040020, 0x0000016a, 0x0000000c, 0x00000169, 0x0004003b, 0x0000016a, 0x0000016b,
-    0x0000000c, 0x00040020, 0x0000016e, 0x0000000c, 0x00000167, 0x00040020, 0x00000184, 0x00000007,
-    0x00000008, 0x0005002c, 0x0000000b, 0x0000019e, 0x0000012f, 0x0000012f, 0x0004002b, 0x00000006,
-    0x000001a3, 0x0000001f, 0x0005002c, 0x0000000b, 0x000001a4, 0x000001a3, 0x000001a3, 0x00040032,
-    0x00000006, 0x000001e9, 0x00000100, 0x00060034, 0x00000006, 0x000001ea, 0x00000087, 0x000001e9,
-    0x0000012f, 0x0004002b, 0x00000007, 0x000001fb, 0x00000800, 0x0004001c, 0x000001fc, 0x00000159,
-    0x000001fb, 0x0004001c, 0x000001fd, 0x00000007, 0x000001fb, 0x0004001c, 0x000001fe, 0x00000007,
-    0x000001fb, 0x0003001d, 0x000001ff, 0x00000007, 0x0007001e, 0x00000200, 0x000001fc, 0x000001fd,
-    0x000001fe, 0x00000159, 0x000001ff, 0x00040020, 0x00000201, 0x0000000c, 0x00000200, 0x0004003b,
-    0x00000201, 0x00000202, 0x0000000c, 0x0004002b, 0x00000007, 0x00000203, 0x00000003, 0x00040020,
-    0x00000204, 0x0000000c, 0x00000007, 0x00040032, 0x00000006, 0x0000020a, 0x000000c0, 0x00060034,
-    0x00000006, 0x0000020b, 0x00000087, 0x0000020a, 0x0000012f, 0x00060034, 0x00000006, 0x0000020c,
-    0x00000084, 0x000001ea, 0x0000020b, 0x00060034, 0x00000006, 0x0000020d, 0x00000084, 0x0000020c,
-    0x0000001f, 0x00060034, 0x00000006, 0x0000020e, 0x00000080, 0x00000036, 0x0000020d, 0x0004002b,
-    0x00000006, 0x00000210, 0x00000040, 0x00060034, 0x00000006, 0x0000022c, 0x00000084, 0x000001ea,
-    0x0000020b, 0x00060034, 0x00000006, 0x0000022d, 0x00000084, 0x0000022c, 0x00000210, 0x00060034,
-    0x00000006, 0x0000022e, 0x00000080, 0x0000020e, 0x0000022d, 0x00040020, 0x00000258, 0x0000000c,
-    0x00000006, 0x0003001d, 0x00000260, 0x0000011d, 0x0003001e, 0x00000261, 0x00000260, 0x00040020,
-    0x00000262, 0x0000000c, 0x00000261, 0x0004003b, 0x00000262, 0x00000263, 0x0000000c, 0x00040020,
-    0x0000026f, 0x0000000c, 0x0000011d, 0x00040032, 0x00000006, 0x00000273, 0x00003000, 0x00060034,
-    0x00000006, 0x00000274, 0x00000084, 0x000001e9, 0x0000020a, 0x0004002b, 0x00000006, 0x00000275,
-    0x00000800, 0x0004002b, 0x00000007, 0x00000276, 0x00008000, 0x0004002b, 0x00000007, 0x00000277,
-    0x00000004, 0x0004002b, 0x00000007, 0x00000278, 0x00000008, 0x00060034, 0x00000007, 0x00000279,
-    0x00000080, 0x00000273, 0x000000ea, 0x00060034, 0x00000007, 0x0000027a, 0x00000080, 0x000000ea,
-    0x00000279, 0x0004002b, 0x00000007, 0x0000027b, 0x00000030, 0x0006002c, 0x00000115, 0x0000027c,
-    0x0000027b, 0x00000018, 0x00000018, 0x00050036, 0x00000002, 0x00000004, 0x00000000, 0x00000003,
-    0x000200f8, 0x00000005, 0x0004003b, 0x00000015, 0x00000114, 0x00000007, 0x0004003b, 0x0000000c,
-    0x0000011c, 0x00000007, 0x0004003b, 0x00000015, 0x00000121, 0x00000007, 0x0004003b, 0x00000015,
-    0x0000012d, 0x00000007, 0x0004003b, 0x00000015, 0x00000133, 0x00000007, 0x0004003b, 0x0000000c,
-    0x0000013d, 0x00000007, 0x0004003b, 0x0000000c, 0x00000143, 0x00000007, 0x0004003b, 0x00000149,
-    0x0000014a, 0x00000007, 0x0004003b, 0x0000000a, 0x0000016d, 0x00000007, 0x0004003b, 0x0000000c,
-    0x00000188, 0x00000007, 0x0004003b, 0x0000000c, 0x0000018a, 0x00000007, 0x0004003b, 0x00000068,
-    0x00000193, 0x00000007, 0x0004003b, 0x0000000c, 0x00000195, 0x00000007, 0x0004003b, 0x0000000c,
-    0x0000019b, 0x00000007, 0x0004003b, 0x0000000c, 0x000001a1, 0x00000007, 0x0004003b, 0x00000068,
-    0x000001a6, 0x00000007, 0x0004003b, 0x00000015, 0x000001ae, 0x00000007, 0x0004003b, 0x00000015,
-    0x000001b6, 0x00000007, 0x0004003b, 0x0000000a, 0x000001c0, 0x00000007, 0x0004003b, 0x0000000c,
-    0x000001d9, 0x00000007, 0x0004003b, 0x0000000c, 0x000001db, 0x00000007, 0x0004003b, 0x00000015,
-    0x000001e4, 0x00000007, 0x0004003b, 0x00000068, 0x000001f6, 0x00000007, 0x0004003b, 0x00000015,
-    0x00000217, 0x00000007, 0x0004003b, 0x00000068, 0x00000236, 0x00000007, 0x0004003b, 0x00000015,
-    0x0000023d, 0x00000007, 0x0004003b, 0x00000015, 0x00000245, 0x00000007, 0x0004003b, 0x00000015,
-    0x0000024d, 0x00000007, 0x0004003b, 0x00000015, 0x00000256, 0x00000007, 0x0004003b, 0x00000015,
-    0x0000025b, 0x00000007, 0x00050041, 0x00000118, 0x00000119, 0x00000117, 0x000000ea, 0x0004003d,
-    0x00000007, 0x0000011a, 0x00000119, 0x0004007c, 0x00000006, 0x0000011b, 0x0000011a, 0x0003003e,
-    0x00000114, 0x0000011b, 0x0004003d, 0x00000115, 0x0000011e, 0x00000117, 0x0007004f, 0x0000011d,
-    0x0000011f, 0x0000011e, 0x0000011e, 0x00000001, 0x00000002, 0x0004007c, 0x0000000b, 0x00000120,
-    0x0000011f, 0x0003003e, 0x0000011c, 0x00000120, 0x0004003d, 0x00000007, 0x00000123, 0x00000122,
-    0x0004007c, 0x00000006, 0x00000124, 0x00000123, 0x0003003e, 0x00000121, 0x00000124, 0x0004003d,
-    0x00000006, 0x00000125, 0x00000121, 0x000500aa, 0x0000000d, 0x00000126, 0x00000125, 0x00000036,
-    0x000300f7, 0x00000128, 0x00000000, 0x000400fa, 0x00000126, 0x00000127, 0x00000128, 0x000200f8,
-    0x00000127, 0x0003003e, 0x0000012a, 0x000000ea, 0x000200f9, 0x00000128, 0x000200f8, 0x00000128,
-    0x000400e0, 0x0000012b, 0x0000012b, 0x0000012c, 0x0004003d, 0x00000006, 0x0000012e, 0x00000114,
-    0x00050084, 0x00000006, 0x00000130, 0x0000012e, 0x0000012f, 0x0004003d, 0x00000006, 0x00000131,
-    0x00000121, 0x00050080, 0x00000006, 0x00000132, 0x00000130, 0x00000131, 0x0003003e, 0x0000012d,
-    0x00000132, 0x00050041, 0x00000137, 0x00000138, 0x00000136, 0x00000036, 0x0004003d, 0x00000007,
-    0x00000139, 0x00000138, 0x0004007c, 0x00000006, 0x0000013a, 0x00000139, 0x0004003d, 0x00000006,
-    0x0000013b, 0x0000012d, 0x00050080, 0x00000006, 0x0000013c, 0x0000013a, 0x0000013b, 0x0003003e,
-    0x00000133, 0x0000013c, 0x0004003d, 0x0000000b, 0x0000013e, 0x0000011c, 0x00050084, 0x0000000b,
-    0x00000142, 0x0000013e, 0x00000141, 0x0003003e, 0x0000013d, 0x00000142, 0x0004003d, 0x0000000b,
-    0x00000144, 0x0000013d, 0x00050080, 0x0000000b, 0x00000148, 0x00000144, 0x00000147, 0x0003003e,
-    0x00000143, 0x00000148, 0x0003003e, 0x0000014a, 0x00000028, 0x0004003d, 0x00000006, 0x0000014b,
-    0x00000121, 0x000500b1, 0x0000000d, 0x0000014c, 0x0000014b, 0x0000012f, 0x000300f7, 0x0000014e,
-    0x00000000, 0x000400fa, 0x0000014c, 0x0000014d, 0x0000014e, 0x000200f8, 0x0000014d, 0x0004003d,
-    0x00000006, 0x0000014f, 0x0000012d, 0x00050041, 0x00000137, 0x00000150, 0x00000136, 0x00000014,
-    0x0004003d, 0x00000007, 0x00000151, 0x00000150, 0x0004007c, 0x00000006, 0x00000152, 0x00000151,
-    0x000500b1, 0x0000000d, 0x00000153, 0x0000014f, 0x00000152, 0x000200f9, 0x0000014e, 0x000200f8,
-    0x0000014e, 0x000700f5, 0x0000000d, 0x00000154, 0x0000014c, 0x00000128, 0x00000153, 0x0000014d,
-    0x000300f7, 0x00000156, 0x00000000, 0x000400fa, 0x00000154, 0x00000155, 0x00000156, 0x000200f8,
-    0x00000155, 0x0004003d, 0x00000006, 0x00000157, 0x00000133, 0x0004007c, 0x00000007, 0x00000158,
-    0x00000157, 0x00050041, 0x00000160, 0x00000161, 0x0000015f, 0x00000036, 0x0004003d, 0x00000007,
-    0x00000162, 0x00000161, 0x000500b0, 0x0000000d, 0x00000163, 0x00000158, 0x00000162, 0x000200f9,
-    0x00000156, 0x000200f8, 0x00000156, 0x000700f5, 0x0000000d, 0x00000164, 0x00000154, 0x0000014e,
-    0x00000163, 0x00000155, 0x000300f7, 0x00000166, 0x00000000, 0x000400fa, 0x00000164, 0x00000165,
-    0x00000166, 0x000200f8, 0x00000165, 0x0004003d, 0x00000006, 0x0000016c, 0x00000133, 0x00060041,
-    0x0000016e, 0x0000016f, 0x0000016b, 0x00000036, 0x0000016c, 0x0004003d, 0x00000167, 0x00000170,
-    0x0000016f, 0x00050051, 0x00000006, 0x00000171, 0x00000170, 0x00000000, 0x00050041, 0x00000015,
-    0x00000172, 0x0000016d, 0x00000036, 0x0003003e, 0x00000172, 0x00000171, 0x00050051, 0x00000006,
-    0x00000173, 0x00000170, 0x00000001, 0x00050041, 0x00000015, 0x00000174, 0x0000016d, 0x00000014,
-    0x0003003e, 0x00000174, 0x00000173, 0x00050051, 0x00000006, 0x00000175, 0x00000170, 0x00000002,
-    0x00050041, 0x00000015, 0x00000176, 0x0000016d, 0x0000001f, 0x0003003e, 0x00000176, 0x00000175,
-    0x00050051, 0x00000006, 0x00000177, 0x00000170, 0x00000003, 0x00050041, 0x00000015, 0x00000178,
-    0x0000016d, 0x0000005b, 0x0003003e, 0x00000178, 0x00000177, 0x00050051, 0x00000006, 0x00000179,
-    0x00000170, 0x00000004, 0x00050041, 0x00000015, 0x0000017a, 0x0000016d, 0x0000005e, 0x0003003e,
-    0x0000017a, 0x00000179, 0x00050051, 0x00000006, 0x0000017b, 0x00000170, 0x00000005, 0x00050041,
-    0x00000015, 0x0000017c, 0x0000016d, 0x00000061, 0x0003003e, 0x0000017c, 0x0000017b, 0x00050051,
-    0x00000006, 0x0000017d, 0x00000170, 0x00000006, 0x00050041, 0x00000015, 0x0000017e, 0x0000016d,
-    0x00000064, 0x0003003e, 0x0000017e, 0x0000017d, 0x00050051, 0x00000006, 0x0000017f, 0x00000170,
-    0x00000007, 0x00050041, 0x00000015, 0x00000180, 0x0000016d, 0x00000067, 0x0003003e, 0x00000180,
-    0x0000017f, 0x00050051, 0x00000007, 0x00000181, 0x00000170, 0x00000008, 0x00050041, 0x00000068,
-    0x00000182, 0x0000016d, 0x0000006b, 0x0003003e, 0x00000182, 0x00000181, 0x00050051, 0x00000008,
-    0x00000183, 0x00000170, 0x00000009, 0x00050041, 0x00000184, 0x00000185, 0x0000016d, 0x0000006e,
-    0x0003003e, 0x00000185, 0x00000183, 0x00050051, 0x00000007, 0x00000186, 0x00000170, 0x0000000a,
-    0x00050041, 0x00000068, 0x00000187, 0x0000016d, 0x00000071, 0x0003003e, 0x00000187, 0x00000186,
-    0x0004003d, 0x0000000b, 0x00000189, 0x0000013d, 0x0003003e, 0x00000188, 0x00000189, 0x0004003d,
-    0x0000000b, 0x0000018b, 0x00000143, 0x0003003e, 0x0000018a, 0x0000018b, 0x00070039, 0x0000000d,
-    0x0000018c, 0x00000012, 0x0000016d, 0x00000188, 0x0000018a, 0x0003003e, 0x0000014a, 0x0000018c,
-    0x000200f9, 0x00000166, 0x000200f8, 0x00000166, 0x0004003d, 0x0000000d, 0x0000018d, 0x0000014a,
-    0x000300f7, 0x0000018f, 0x00000000, 0x000400fa, 0x0000018d, 0x0000018e, 0x0000018f, 0x000200f8,
-    0x0000018e, 0x0004003d, 0x00000006, 0x00000190, 0x00000121, 0x000500c4, 0x00000007, 0x00000191,
-    0x00000018, 0x00000190, 0x000700f1, 0x00000007, 0x00000192, 0x0000012a, 0x00000018, 0x000000ea,
-    0x00000191, 0x000200f9, 0x0000018f, 0x000200f8, 0x0000018f, 0x000400e0, 0x0000012b, 0x0000012b,
-    0x0000012c, 0x0004003d, 0x00000007, 0x00000194, 0x0000012a, 0x0003003e, 0x00000193, 0x00000194,
-    0x0004003d, 0x00000006, 0x00000196, 0x00000121, 0x000500c7, 0x00000006, 0x00000197, 0x00000196,
-    0x00000067, 0x0004003d, 0x00000006, 0x00000198, 0x00000121, 0x000500c3, 0x00000006, 0x00000199,
-    0x00000198, 0x0000005b, 0x00050050, 0x0000000b, 0x0000019a, 0x00000197, 0x00000199, 0x0003003e,
-    0x00000195, 0x0000019a, 0x0004003d, 0x0000000b, 0x0000019c, 0x0000013d, 0x0004003d, 0x0000000b,
-    0x0000019d, 0x00000195, 0x00050084, 0x0000000b, 0x0000019f, 0x0000019d, 0x0000019e, 0x00050080,
-    0x0000000b, 0x000001a0, 0x0000019c, 0x0000019f, 0x0003003e, 0x0000019b, 0x000001a0, 0x0004003d,
-    0x0000000b, 0x000001a2, 0x0000019b, 0x00050080, 0x0000000b, 0x000001a5, 0x000001a2, 0x000001a4,
-    0x0003003e, 0x000001a1, 0x000001a5, 0x0003003e, 0x000001a6, 0x000000ea, 0x000200f9, 0x000001a7,
-    0x000200f8, 0x000001a7, 0x000400f6, 0x000001a9, 0x000001aa, 0x00000000, 0x000200f9, 0x000001ab,
-    0x000200f8, 0x000001ab, 0x0004003d, 0x00000007, 0x000001ac, 0x00000193, 0x000500ab, 0x0000000d,
-    0x000001ad, 0x000001ac, 0x000000ea, 0x000400fa, 0x000001ad, 0x000001a8, 0x000001a9, 0x000200f8,
-    0x000001a8, 0x0004003d, 0x00000007, 0x000001af, 0x00000193, 0x0006000c, 0x00000006, 0x000001b0,
-    0x00000001, 0x00000049, 0x000001af, 0x0003003e, 0x000001ae, 0x000001b0, 0x0004003d, 0x00000006,
-    0x000001b1, 0x000001ae, 0x000500c4, 0x00000007, 0x000001b2, 0x00000018, 0x000001b1, 0x000400c8,
-    0x00000007, 0x000001b3, 0x000001b2, 0x0004003d, 0x00000007, 0x000001b4, 0x00000193, 0x000500c7,
-    0x00000007, 0x000001b5, 0x000001b4, 0x000001b3, 0x0003003e, 0x00000193, 0x000001b5, 0x00050041,
-    0x00000137, 0x000001b7, 0x00000136, 0x00000036, 0x0004003d, 0x00000007, 0x000001b8, 0x000001b7,
-    0x0004007c, 0x00000006, 0x000001b9, 0x000001b8, 0x0004003d, 0x00000006, 0x000001ba, 0x00000114,
-    0x00050084, 0x00000006, 0x000001bb, 0x000001ba, 0x0000012f, 0x00050080, 0x00000006, 0x000001bc,
-    0x000001b9, 0x000001bb, 0x0004003d, 0x00000006, 0x000001bd, 0x000001ae, 0x00050080, 0x00000006,
-    0x000001be, 0x000001bc, 0x000001bd, 0x0003003e, 0x000001b6, 0x000001be, 0x0004003d, 0x00000006,
-    0x000001bf, 0x000001b6, 0x00060041, 0x0000016e, 0x000001c1, 0x0000016b, 0x00000036, 0x000001bf,
-    0x0004003d, 0x00000167, 0x000001c2, 0x000001c1, 0x00050051, 0x00000006, 0x000001c3, 0x000001c2,
-    0x00000000, 0x00050041, 0x00000015, 0x000001c4, 0x000001c0, 0x00000036, 0x0003003e, 0x000001c4,
-    0x000001c3, 0x00050051, 0x00000006, 0x000001c5, 0x000001c2, 0x00000001, 0x00050041, 0x00000015,
-    0x000001c6, 0x000001c0, 0x00000014, 0x0003003e, 0x000001c6, 0x000001c5, 0x00050051, 0x00000006,
-    0x000001c7, 0x000001c2, 0x00000002, 0x00050041, 0x00000015, 0x000001c8, 0x000001c0, 0x0000001f,
-    0x0003003e, 0x000001c8, 0x000001c7, 0x00050051, 0x00000006, 0x000001c9, 0x000001c2, 0x00000003,
-    0x00050041, 0x00000015, 0x000001ca, 0x000001c0, 0x0000005b, 0x0003003e, 0x000001ca, 0x000001c9,
-    0x00050051, 0x00000006, 0x000001cb, 0x000001c2, 0x00000004, 0x00050041, 0x00000015, 0x000001cc,
-    0x000001c0, 0x0000005e, 0x0003003e, 0x000001cc, 0x000001cb, 0x00050051, 0x00000006, 0x000001cd,
-    0x000001c2, 0x00000005, 0x00050041, 0x00000015, 0x000001ce, 0x000001c0, 0x00000061, 0x0003003e,
-    0x000001ce, 0x000001cd, 0x00050051, 0x00000006, 0x000001cf, 0x000001c2, 0x00000006, 0x00050041,
-    0x00000015, 0x000001d0, 0x000001c0, 0x00000064, 0x0003003e, 0x000001d0, 0x000001cf, 0x00050051,
-    0x00000006, 0x000001d1, 0x000001c2, 0x00000007, 0x00050041, 0x00000015, 0x000001d2, 0x000001c0,
-    0x00000067, 0x0003003e, 0x000001d2, 0x000001d1, 0x00050051, 0x00000007, 0x000001d3, 0x000001c2,
-    0x00000008, 0x00050041, 0x00000068, 0x000001d4, 0x000001c0, 0x0000006b, 0x0003003e, 0x000001d4,
-    0x000001d3, 0x00050051, 0x00000008, 0x000001d5, 0x000001c2, 0x00000009, 0x00050041, 0x00000184,
-    0x000001d6, 0x000001c0, 0x0000006e, 0x0003003e, 0x000001d6, 0x000001d5, 0x00050051, 0x00000007,
-    0x000001d7, 0x000001c2, 0x0000000a, 0x00050041, 0x00000068, 0x000001d8, 0x000001c0, 0x00000071,
-    0x0003003e, 0x000001d8, 0x000001d7, 0x0004003d, 0x0000000b, 0x000001da, 0x0000019b, 0x0003003e,
-    0x000001d9, 0x000001da, 0x0004003d, 0x0000000b, 0x000001dc, 0x000001a1, 0x0003003e, 0x000001db,
-    0x000001dc, 0x00070039, 0x0000000d, 0x000001dd, 0x00000012, 0x000001c0, 0x000001d9, 0x000001db,
-    0x000300f7, 0x000001df, 0x00000000, 0x000400fa, 0x000001dd, 0x000001de, 0x000001df, 0x000200f8,
-    0x000001de, 0x0004003d, 0x00000006, 0x000001e0, 0x000001ae, 0x000500c4, 0x00000007, 0x000001e1,
-    0x00000018, 0x000001e0, 0x0004003d, 0x00000007, 0x000001e2, 0x000001a6, 0x000500c5, 0x00000007,
-    0x000001e3, 0x000001e2, 0x000001e1, 0x0003003e, 0x000001a6, 0x000001e3, 0x000200f9, 0x000001df,
-    0x000200f8, 0x000001df, 0x000200f9, 0x000001aa, 0x000200f8, 0x000001aa, 0x000200f9, 0x000001a7,
-    0x000200f8, 0x000001a9, 0x00050041, 0x00000015, 0x000001e5, 0x00000195, 0x000000ea, 0x0004003d,
-    0x00000006, 0x000001e6, 0x000001e5, 0x00050041, 0x00000015, 0x000001e7, 0x00000195, 0x00000018,
-    0x0004003d, 0x00000006, 0x000001e8, 0x000001e7, 0x00050084, 0x00000006, 0x000001eb, 0x000001e8,
-    0x000001ea, 0x00050080, 0x00000006, 0x000001ec, 0x000001e6, 0x000001eb, 0x00050041, 0x00000015,
-    0x000001ed, 0x0000011c, 0x000000ea, 0x0004003d, 0x00000006, 0x000001ee, 0x000001ed, 0x00050084,
-    0x00000006, 0x000001ef, 0x000001ee, 0x0000006b, 0x00050080, 0x00000006, 0x000001f0, 0x000001ec,
-    0x000001ef, 0x00050041, 0x00000015, 0x000001f1, 0x0000011c, 0x00000018, 0x0004003d, 0x00000006,
-    0x000001f2, 0x000001f1, 0x00050084, 0x00000006, 0x000001f3, 0x000001f2, 0x000001ea, 0x00050084,
-    0x00000006, 0x000001f4, 0x000001f3, 0x00000064, 0x00050080, 0x00000006, 0x000001f5, 0x000001f0,
-    0x000001f4, 0x0003003e, 0x000001e4, 0x000001f5, 0x0003003e, 0x000001f6, 0x000000ea, 0x0004003d,
-    0x00000007, 0x000001f7, 0x000001a6, 0x000500ab, 0x0000000d, 0x000001f8, 0x000001f7, 0x000000ea,
-    0x000300f7, 0x000001fa, 0x00000000, 0x000400fa, 0x000001f8, 0x000001f9, 0x000001fa, 0x000200f8,
-    0x000001f9, 0x00070041, 0x00000204, 0x00000205, 0x00000202, 0x00000036, 0x00000036, 0x00000203,
-    0x0004003d, 0x00000007, 0x00000206, 0x000001a6, 0x000400cd, 0x00000006, 0x00000207, 0x00000206,
-    0x0004007c, 0x00000007, 0x00000208, 0x00000207, 0x000700ea, 0x00000007, 0x00000209, 0x00000205,
-    0x00000018, 0x000000ea, 0x00000208, 0x0003003e, 0x000001f6, 0x00000209, 0x000200f9, 0x000001fa,
-    0x000200f8, 0x000001fa, 0x0004003d, 0x00000006, 0x0000020f, 0x000001e4, 0x00050084, 0x00000006,
-    0x00000211, 0x0000020f, 0x00000210, 0x00050080, 0x00000006, 0x00000212, 0x0000020e, 0x00000211,
-    0x0004003d, 0x00000006, 0x00000213, 0x00000114, 0x00050080, 0x00000006, 0x00000214, 0x00000212,
-    0x00000213, 0x0004003d, 0x00000007, 0x00000215, 0x000001a6, 0x00060041, 0x00000204, 0x00000216,
-    0x00000202, 0x0000005e, 0x00000214, 0x0003003e, 0x00000216, 0x00000215, 0x0004003d, 0x00000006,
-    0x00000218, 0x000001e4, 0x00050084, 0x00000006, 0x00000219, 0x00000218, 0x0000001f, 0x0004003d,
-    0x00000006, 0x0000021a, 0x00000114, 0x000500c3, 0x00000006, 0x0000021b, 0x0000021a, 0x00000061,
-    0x00050080, 0x00000006, 0x0000021c, 0x00000219, 0x0000021b, 0x0003003e, 0x00000217, 0x0000021c,
-    0x0004003d, 0x00000007, 0x0000021d, 0x000001a6, 0x000500ab, 0x0000000d, 0x0000021e, 0x0000021d,
-    0x000000ea, 0x000300f7, 0x00000220, 0x00000000, 0x000400fa, 0x0000021e, 0x0000021f, 0x00000220,
-    0x000200f8, 0x0000021f, 0x0004003d, 0x00000006, 0x00000221, 0x00000217, 0x00050080, 0x00000006,
-    0x00000222, 0x00000036, 0x00000221, 0x00060041, 0x00000204, 0x00000223, 0x00000202, 0x0000005e,
-    0x00000222, 0x0004003d, 0x00000006, 0x00000224, 0x00000114, 0x000500c7, 0x00000006, 0x00000225,
-    0x00000224, 0x000001a3, 0x000500c4, 0x00000007, 0x00000226, 0x00000018, 0x00000225, 0x000700f1,
-    0x00000007, 0x00000227, 0x00000223, 0x00000018, 0x000000ea, 0x00000226, 0x000200f9, 0x00000220,
-    0x000200f8, 0x00000220, 0x0004003d, 0x00000007, 0x00000228, 0x000001a6, 0x000500ab, 0x0000000d,
-    0x00000229, 0x00000228, 0x000000ea, 0x000300f7, 0x0000022b, 0x00000000, 0x000400fa, 0x00000229,
-    0x0000022a, 0x0000022b, 0x000200f8, 0x0000022a, 0x0004003d, 0x00000006, 0x0000022f, 0x000001e4,
-    0x00050084, 0x00000006, 0x00000230, 0x0000022f, 0x00000210, 0x00050080, 0x00000006, 0x00000231,
-    0x0000022e, 0x00000230, 0x0004003d, 0x00000006, 0x00000232, 0x00000114, 0x00050080, 0x00000006,
-    0x00000233, 0x00000231, 0x00000232, 0x0004003d, 0x00000007, 0x00000234, 0x000001f6, 0x00060041,
-    0x00000204, 0x00000235, 0x00000202, 0x0000005e, 0x00000233, 0x0003003e, 0x00000235, 0x00000234,
-    0x00050041, 0x00000015, 0x00000237, 0x0000019b, 0x000000ea, 0x0004003d, 0x00000006, 0x00000238,
-    0x00000237, 0x00050041, 0x00000015, 0x00000239, 0x0000019b, 0x00000018, 0x0004003d, 0x00000006,
-    0x0000023a, 0x00000239, 0x000700c9, 0x00000006, 0x0000023b, 0x00000238, 0x0000023a, 0x00000083,
-    0x00000083, 0x0004007c, 0x00000007, 0x0000023c, 0x0000023b, 0x0003003e, 0x00000236, 0x0000023c,
-    0x0003003e, 0x0000023d, 0x00000036, 0x000200f9, 0x0000023e, 0x000200f8, 0x0000023e, 0x000400f6,
-    0x00000240, 0x00000241, 0x00000000, 0x000200f9, 0x00000242, 0x000200f8, 0x00000242, 0x0004003d,
-    0x00000007, 0x00000243, 0x000001a6, 0x000500ab, 0x0000000d, 0x00000244, 0x00000243, 0x000000ea,
-    0x000400fa, 0x00000244, 0x0000023f, 0x00000240, 0x000200f8, 0x0000023f, 0x0004003d, 0x00000007,
-    0x00000246, 0x000001a6, 0x0006000c, 0x00000006, 0x00000247, 0x00000001, 0x00000049, 0x00000246,
-    0x0003003e, 0x00000245, 0x00000247, 0x0004003d, 0x00000006, 0x00000248, 0x00000245, 0x000500c4,
-    0x00000007, 0x00000249, 0x00000018, 0x00000248, 0x000400c8, 0x00000007, 0x0000024a, 0x00000249,
-    0x0004003d, 0x00000007, 0x0000024b, 0x000001a6, 0x000500c7, 0x00000007, 0x0000024c, 0x0000024b,
-    0x0000024a, 0x0003003e, 0x000001a6, 0x0000024c, 0x00050041, 0x00000137, 0x0000024e, 0x00000136,
-    0x00000036, 0x0004003d, 0x00000007, 0x0000024f, 0x0000024e, 0x0004007c, 0x00000006, 0x00000250,
-    0x0000024f, 0x0004003d, 0x00000006, 0x00000251, 0x00000114, 0x00050084, 0x00000006, 0x00000252,
-    0x00000251, 0x0000012f, 0x00050080, 0x00000006, 0x00000253, 0x00000250, 0x00000252, 0x0004003d,
-    0x00000006, 0x00000254, 0x00000245, 0x00050080, 0x00000006, 0x00000255, 0x00000253, 0x00000254,
-    0x0003003e, 0x0000024d, 0x00000255, 0x0004003d, 0x00000006, 0x00000257, 0x0000024d, 0x00070041,
-    0x00000258, 0x00000259, 0x0000016b, 0x00000036, 0x00000257, 0x00000067, 0x0004003d, 0x00000006,
-    0x0000025a, 0x00000259, 0x0003003e, 0x00000256, 0x0000025a, 0x0004003d, 0x00000006, 0x0000025c,
-    0x00000256, 0x00070041, 0x00000204, 0x0000025d, 0x00000202, 0x00000036, 0x0000025c, 0x0000012b,
-    0x000700ea, 0x00000007, 0x0000025e, 0x0000025d, 0x00000018, 0x000000ea, 0x00000018, 0x0004007c,
-    0x00000006, 0x0000025f, 0x0000025e, 0x0003003e, 0x0000025b, 0x0000025f, 0x0004003d, 0x00000007,
-    0x00000264, 0x000001f6, 0x00050080, 0x00000007, 0x00000265, 0x000000ea, 0x00000264, 0x0004003d,
-    0x00000006, 0x00000266, 0x0000023d, 0x0004007c, 0x00000007, 0x00000267, 0x00000266, 0x00050080,
-    0x00000007, 0x00000268, 0x00000265, 0x00000267, 0x0004003d, 0x00000007, 0x00000269, 0x00000236,
-    0x0004003d, 0x00000006, 0x0000026a, 0x0000024d, 0x0004003d, 0x00000006, 0x0000026b, 0x0000025b,
-    0x000700c9, 0x00000006, 0x0000026c, 0x0000026a, 0x0000026b, 0x00000074, 0x00000092, 0x0004007c,
-    0x00000007, 0x0000026d, 0x0000026c, 0x00050050, 0x0000011d, 0x0000026e, 0x00000269, 0x0000026d,
-    0x00060041, 0x0000026f, 0x00000270, 0x00000263, 0x00000036, 0x00000268, 0x0003003e, 0x00000270,
-    0x0000026e, 0x0004003d, 0x00000006, 0x00000271, 0x0000023d, 0x00050080, 0x00000006, 0x00000272,
-    0x00000271, 0x00000014, 0x0003003e, 0x0000023d, 0x00000272, 0x000200f9, 0x00000241, 0x000200f8,
-    0x00000241, 0x000200f9, 0x0000023e, 0x000200f8, 0x00000240, 0x000200f9, 0x0000022b, 0x000200f8,
-    0x0000022b, 0x000100fd, 0x00010038, 0x00050036, 0x0000000d, 0x00000012, 0x00000000, 0x0000000e,
-    0x00030037, 0x0000000a, 0x0000000f, 0x00030037, 0x0000000c, 0x00000010, 0x00030037, 0x0000000c,
-    0x00000011, 0x000200f8, 0x00000013, 0x0004003b, 0x00000015, 0x0000002a, 0x00000007, 0x0004003b,
-    0x00000015, 0x00000030, 0x00000007, 0x0004003b, 0x00000015, 0x0000003b, 0x00000007, 0x0004003b,
-    0x00000046, 0x00000047, 0x00000007, 0x0004003b, 0x00000046, 0x0000009a, 0x00000007, 0x0004003b,
-    0x00000015, 0x000000e0, 0x00000007, 0x0004003b, 0x00000015, 0x00000100, 0x00000007, 0x00050041,
-    0x00000015, 0x00000016, 0x0000000f, 0x00000014, 0x0004003d, 0x00000006, 0x00000017, 0x00000016,
-    0x00050041, 0x00000015, 0x00000019, 0x00000011, 0x00000018, 0x0004003d, 0x00000006, 0x0000001a,
-    0x00000019, 0x000500ad, 0x0000000d, 0x0000001b, 0x00000017, 0x0000001a, 0x000400a8, 0x0000000d,
-    0x0000001c, 0x0000001b, 0x000300f7, 0x0000001e, 0x00000000, 0x000400fa, 0x0000001c, 0x0000001d,
-    0x0000001e, 0x000200f8, 0x0000001d, 0x00050041, 0x00000015, 0x00000020, 0x0000000f, 0x0000001f,
-    0x0004003d, 0x00000006, 0x00000021, 0x00000020, 0x00050041, 0x00000015, 0x00000022, 0x00000010,
-    0x00000018, 0x0004003d, 0x00000006, 0x00000023, 0x00000022, 0x000500b3, 0x0000000d, 0x00000024,
-    0x00000021, 0x00000023, 0x000200f9, 0x0000001e, 0x000200f8, 0x0000001e, 0x000700f5, 0x0000000d,
-    0x00000025, 0x0000001b, 0x00000013, 0x00000024, 0x0000001d, 0x000300f7, 0x00000027, 0x00000000,
-    0x000400fa, 0x00000025, 0x00000026, 0x00000027, 0x000200f8, 0x00000026, 0x000200fe, 0x00000028,
-    0x000200f8, 0x00000027, 0x00050041, 0x00000015, 0x0000002b, 0x0000000f, 0x0000001f, 0x0004003d,
-    0x00000006, 0x0000002c, 0x0000002b, 0x00050041, 0x00000015, 0x0000002d, 0x0000000f, 0x00000014,
-    0x0004003d, 0x00000006, 0x0000002e, 0x0000002d, 0x00050082, 0x00000006, 0x0000002f, 0x0000002c,
-    0x0000002e, 0x0003003e, 0x0000002a, 0x0000002f, 0x00050041, 0x00000015, 0x00000031, 0x00000010,
-    0x00000018, 0x0004003d, 0x00000006, 0x00000032, 0x00000031, 0x00050041, 0x00000015, 0x00000033,
-    0x0000000f, 0x00000014, 0x0004003d, 0x00000006, 0x00000034, 0x00000033, 0x00050082, 0x00000006,
-    0x00000035, 0x00000032, 0x00000034, 0x0004003d, 0x00000006, 0x00000037, 0x0000002a, 0x00050082,
-    0x00000006, 0x00000038, 0x00000037, 0x00000014, 0x0007000c, 0x00000006, 0x00000039, 0x00000001,
-    0x0000002a, 0x00000038, 0x00000036, 0x0008000c, 0x00000006, 0x0000003a, 0x00000001, 0x0000002d,
-    0x00000035, 0x00000036, 0x00000039, 0x0003003e, 0x00000030, 0x0000003a, 0x00050041, 0x00000015,
-    0x0000003c, 0x00000011, 0x00000018, 0x0004003d, 0x00000006, 0x0000003d, 0x0000003c, 0x00050041,
-    0x00000015, 0x0000003e, 0x0000000f, 0x00000014, 0x0004003d, 0x00000006, 0x0000003f, 0x0000003e,
-    0x00050082, 0x00000006, 0x00000040, 0x0000003d, 0x0000003f, 0x0004003d, 0x00000006, 0x00000041,
-    0x0000002a, 0x00050082, 0x00000006, 0x00000042, 0x00000041, 0x00000014, 0x0007000c, 0x00000006,
-    0x00000043, 0x00000001, 0x0000002a, 0x00000042, 0x00000036, 0x0008000c, 0x00000006, 0x00000044,
-    0x00000001, 0x0000002d, 0x00000040, 0x00000036, 0x00000043, 0x0003003e, 0x0000003b, 0x00000044,
-    0x00050041, 0x00000015, 0x0000004d, 0x0000000f, 0x00000036, 0x0004003d, 0x00000006, 0x0000004e,
-    0x0000004d, 0x0004003d, 0x00000006, 0x0000004f, 0x00000030, 0x00050080, 0x00000006, 0x00000050,
-    0x0000004e, 0x0000004f, 0x00060041, 0x00000051, 0x00000052, 0x0000004c, 0x00000036, 0x00000050,
-    0x0004003d, 0x00000048, 0x00000053, 0x00000052, 0x00050051, 0x00000006, 0x00000054, 0x00000053,
-    0x00000000, 0x00050041, 0x00000015, 0x00000055, 0x00000047, 0x00000036, 0x0003003e, 0x00000055,
-    0x00000054, 0x00050051, 0x00000006, 0x00000056, 0x00000053, 0x00000001, 0x00050041, 0x00000015,
-    0x00000057, 0x00000047, 0x00000014, 0x0003003e, 0x00000057, 0x00000056, 0x00050051, 0x00000006,
-    0x00000058, 0x00000053, 0x00000002, 0x00050041, 0x00000015, 0x00000059, 0x00000047, 0x0000001f,
-    0x0003003e, 0x00000059, 0x00000058, 0x00050051, 0x00000006, 0x0000005a, 0x00000053, 0x00000003,
-    0x00050041, 0x00000015, 0x0000005c, 0x00000047, 0x0000005b, 0x0003003e, 0x0000005c, 0x0000005a,
-    0x00050051, 0x00000006, 0x0000005d, 0x00000053, 0x00000004, 0x00050041, 0x00000015, 0x0000005f,
-    0x00000047, 0x0000005e, 0x0003003e, 0x0000005f, 0x0000005d, 0x00050051, 0x00000006, 0x00000060,
-    0x00000053, 0x00000005, 0x00050041, 0x00000015, 0x00000062, 0x00000047, 0x00000061, 0x0003003e,
-    0x00000062, 0x00000060, 0x00050051, 0x00000006, 0x00000063, 0x00000053, 0x00000006, 0x00050041,
-    0x00000015, 0x00000065, 0x00000047, 0x00000064, 0x0003003e, 0x00000065, 0x00000063, 0x00050051,
-    0x00000007, 0x00000066, 0x00000053, 0x00000007, 0x00050041, 0x00000068, 0x00000069, 0x00000047,
-    0x00000067, 0x0003003e, 0x00000069, 0x00000066, 0x00050051, 0x00000006, 0x0000006a, 0x00000053,
-    0x00000008, 0x00050041, 0x00000015, 0x0000006c, 0x00000047, 0x0000006b, 0x0003003e, 0x0000006c,
-    0x0000006a, 0x00050051, 0x00000006, 0x0000006d, 0x00000053, 0x00000009, 0x00050041, 0x00000015,
-    0x0000006f, 0x00000047, 0x0000006e, 0x0003003e, 0x0000006f, 0x0000006d, 0x00050051, 0x00000006,
-    0x00000070, 0x00000053, 0x0000000a, 0x00050041, 0x00000015, 0x00000072, 0x00000047, 0x00000071,
-    0x0003003e, 0x00000072, 0x00000070, 0x00050051, 0x00000006, 0x00000073, 0x00000053, 0x0000000b,
-    0x00050041, 0x00000015, 0x00000075, 0x00000047, 0x00000074, 0x0003003e, 0x00000075, 0x00000073,
-    0x00050051, 0x00000006, 0x00000076, 0x00000053, 0x0000000c, 0x00050041, 0x00000015, 0x00000078,
-    0x00000047, 0x00000077, 0x0003003e, 0x00000078, 0x00000076, 0x00050051, 0x00000006, 0x00000079,
-    0x00000053, 0x0000000d, 0x00050041, 0x00000015, 0x0000007b, 0x00000047, 0x0000007a, 0x0003003e,
-    0x0000007b, 0x00000079, 0x00050051, 0x00000006, 0x0000007c, 0x00000053, 0x0000000e, 0x00050041,
-    0x00000015, 0x0000007e, 0x00000047, 0x0000007d, 0x0003003e, 0x0000007e, 0x0000007c, 0x00050051,
-    0x00000006, 0x0000007f, 0x00000053, 0x0000000f, 0x00050041, 0x00000015, 0x00000081, 0x00000047,
-    0x00000080, 0x0003003e, 0x00000081, 0x0000007f, 0x00050051, 0x00000006, 0x00000082, 0x00000053,
-    0x00000010, 0x00050041, 0x00000015, 0x00000084, 0x00000047, 0x00000083, 0x0003003e, 0x00000084,
-    0x00000082, 0x00050051, 0x00000006, 0x00000085, 0x00000053, 0x00000011, 0x00050041, 0x00000015,
-    0x00000087, 0x00000047, 0x00000086, 0x0003003e, 0x00000087, 0x00000085, 0x00050051, 0x00000006,
-    0x00000088, 0x00000053, 0x00000012, 0x00050041, 0x00000015, 0x0000008a, 0x00000047, 0x00000089,
-    0x0003003e, 0x0000008a, 0x00000088, 0x00050051, 0x00000006, 0x0000008b, 0x00000053, 0x00000013,
-    0x00050041, 0x00000015, 0x0000008d, 0x00000047, 0x0000008c, 0x0003003e, 0x0000008d, 0x0000008b,
-    0x00050051, 0x00000006, 0x0000008e, 0x00000053, 0x00000014, 0x00050041, 0x00000015, 0x00000090,
-    0x00000047, 0x0000008f, 0x0003003e, 0x00000090, 0x0000008e, 0x00050051, 0x00000006, 0x00000091,
-    0x00000053, 0x00000015, 0x00050041, 0x00000015, 0x00000093, 0x00000047, 0x00000092, 0x0003003e,
-    0x00000093, 0x00000091, 0x00050051, 0x00000006, 0x00000094, 0x00000053, 0x00000016, 0x00050041,
-    0x00000015, 0x00000096, 0x00000047, 0x00000095, 0x0003003e, 0x00000096, 0x00000094, 0x00050051,
-    0x00000006, 0x00000097, 0x00000053, 0x00000017, 0x00050041, 0x00000015, 0x00000099, 0x00000047,
-    0x00000098, 0x0003003e, 0x00000099, 0x00000097, 0x00050041, 0x00000015, 0x0000009b, 0x0000000f,
-    0x00000036, 0x0004003d, 0x00000006, 0x0000009c, 0x0000009b, 0x0004003d, 0x00000006, 0x0000009d,
-    0x0000003b, 0x00050080, 0x00000006, 0x0000009e, 0x0000009c, 0x0000009d, 0x00060041, 0x00000051,
-    0x0000009f, 0x0000004c, 0x00000036, 0x0000009e, 0x0004003d, 0x00000048, 0x000000a0, 0x0000009f,
-    0x00050051, 0x00000006, 0x000000a1, 0x000000a0, 0x00000000, 0x00050041, 0x00000015, 0x000000a2,
-    0x0000009a, 0x00000036, 0x0003003e, 0x000000a2, 0x000000a1, 0x00050051, 0x00000006, 0x000000a3,
-    0x000000a0, 0x00000001, 0x00050041, 0x00000015, 0x000000a4, 0x0000009a, 0x00000014, 0x0003003e,
-    0x000000a4, 0x000000a3, 0x00050051, 0x00000006, 0x000000a5, 0x000000a0, 0x00000002, 0x00050041,
-    0x00000015, 0x000000a6, 0x0000009a, 0x0000001f, 0x0003003e, 0x000000a6, 0x000000a5, 0x00050051,
-    0x00000006, 0x000000a7, 0x000000a0, 0x00000003, 0x00050041, 0x00000015, 0x000000a8, 0x0000009a,
-    0x0000005b, 0x0003003e, 0x000000a8, 0x000000a7, 0x00050051, 0x00000006, 0x000000a9, 0x000000a0,
-    0x00000004, 0x00050041, 0x00000015, 0x000000aa, 0x0000009a, 0x0000005e, 0x0003003e, 0x000000aa,
-    0x000000a9, 0x00050051, 0x00000006, 0x000000ab, 0x000000a0, 0x00000005, 0x00050041, 0x00000015,
-    0x000000ac, 0x0000009a, 0x00000061, 0x0003003e, 0x000000ac, 0x000000ab, 0x00050051, 0x00000006,
-    0x000000ad, 0x000000a0, 0x00000006, 0x00050041, 0x00000015, 0x000000ae, 0x0000009a, 0x00000064,
-    0x0003003e, 0x000000ae, 0x000000ad, 0x00050051, 0x00000007, 0x000000af, 0x000000a0, 0x00000007,
-    0x00050041, 0x00000068, 0x000000b0, 0x0000009a, 0x00000067, 0x0003003e, 0x000000b0, 0x000000af,
-    0x00050051, 0x00000006, 0x000000b1, 0x000000a0, 0x00000008, 0x00050041, 0x00000015, 0x000000b2,
-    0x0000009a, 0x0000006b, 0x0003003e, 0x000000b2, 0x000000b1, 0x00050051, 0x00000006, 0x000000b3,
-    0x000000a0, 0x00000009, 0x00050041, 0x00000015, 0x000000b4, 0x0000009a, 0x0000006e, 0x0003003e,
-    0x000000b4, 0x000000b3, 0x00050051, 0x00000006, 0x000000b5, 0x000000a0, 0x0000000a, 0x00050041,
-    0x00000015, 0x000000b6, 0x0000009a, 0x00000071, 0x0003003e, 0x000000b6, 0x000000b5, 0x00050051,
-    0x00000006, 0x000000b7, 0x000000a0, 0x0000000b, 0x00050041, 0x00000015, 0x000000b8, 0x0000009a,
-    0x00000074, 0x0003003e, 0x000000b8, 0x000000b7, 0x00050051, 0x00000006, 0x000000b9, 0x000000a0,
-    0x0000000c, 0x00050041, 0x00000015, 0x000000ba, 0x0000009a, 0x00000077, 0x0003003e, 0x000000ba,
-    0x000000b9, 0x00050051, 0x00000006, 0x000000bb, 0x000000a0, 0x0000000d, 0x00050041, 0x00000015,
-    0x000000bc, 0x0000009a, 0x0000007a, 0x0003003e, 0x000000bc, 0x000000bb, 0x00050051, 0x00000006,
-    0x000000bd, 0x000000a0, 0x0000000e, 0x00050041, 0x00000015, 0x000000be, 0x0000009a, 0x0000007d,
-    0x0003003e, 0x000000be, 0x000000bd, 0x00050051, 0x00000006, 0x000000bf, 0x000000a0, 0x0000000f,
-    0x00050041, 0x00000015, 0x000000c0, 0x0000009a, 0x00000080, 0x0003003e, 0x000000c0, 0x000000bf,
-    0x00050051, 0x00000006, 0x000000c1, 0x000000a0, 0x00000010, 0x00050041, 0x00000015, 0x000000c2,
-    0x0000009a, 0x00000083, 0x0003003e, 0x000000c2, 0x000000c1, 0x00050051, 0x00000006, 0x000000c3,
-    0x000000a0, 0x00000011, 0x00050041, 0x00000015, 0x000000c4, 0x0000009a, 0x00000086, 0x0003003e,
-    0x000000c4, 0x000000c3, 0x00050051, 0x00000006, 0x000000c5, 0x000000a0, 0x00000012, 0x00050041,
-    0x00000015, 0x000000c6, 0x0000009a, 0x00000089, 0x0003003e, 0x000000c6, 0x000000c5, 0x00050051,
-    0x00000006, 0x000000c7, 0x000000a0, 0x00000013, 0x00050041, 0x00000015, 0x000000c8, 0x0000009a,
-    0x0000008c, 0x0003003e, 0x000000c8, 0x000000c7, 0x00050051, 0x00000006, 0x000000c9, 0x000000a0,
-    0x00000014, 0x00050041, 0x00000015, 0x000000ca, 0x0000009a, 0x0000008f, 0x0003003e, 0x000000ca,
-    0x000000c9, 0x00050051, 0x00000006, 0x000000cb, 0x000000a0, 0x00000015, 0x00050041, 0x00000015,
-    0x000000cc, 0x0000009a, 0x00000092, 0x0003003e, 0x000000cc, 0x000000cb, 0x00050051, 0x00000006,
-    0x000000cd, 0x000000a0, 0x00000016, 0x00050041, 0x00000015, 0x000000ce, 0x0000009a, 0x00000095,
-    0x0003003e, 0x000000ce, 0x000000cd, 0x00050051, 0x00000006, 0x000000cf, 0x000000a0, 0x00000017,
-    0x00050041, 0x00000015, 0x000000d0, 0x0000009a, 0x00000098, 0x0003003e, 0x000000d0, 0x000000cf,
-    0x00050041, 0x00000015, 0x000000d1, 0x0000000f, 0x00000061, 0x0004003d, 0x00000006, 0x000000d2,
-    0x000000d1, 0x00050041, 0x00000015, 0x000000d3, 0x00000010, 0x00000018, 0x0004003d, 0x00000006,
-    0x000000d4, 0x000000d3, 0x000500af, 0x0000000d, 0x000000d5, 0x000000d2, 0x000000d4, 0x000300f7,
-    0x000000d7, 0x00000000, 0x000400fa, 0x000000d5, 0x000000d6, 0x000000d7, 0x000200f8, 0x000000d6,
-    0x00050041, 0x00000015, 0x000000d8, 0x0000000f, 0x00000061, 0x0004003d, 0x00000006, 0x000000d9,
-    0x000000d8, 0x00050041, 0x00000015, 0x000000da, 0x00000011, 0x00000018, 0x0004003d, 0x00000006,
-    0x000000db, 0x000000da, 0x000500b3, 0x0000000d, 0x000000dc, 0x000000d9, 0x000000db, 0x000200f9,
-    0x000000d7, 0x000200f8, 0x000000d7, 0x000700f5, 0x0000000d, 0x000000dd, 0x000000d5, 0x00000027,
-    0x000000dc, 0x000000d6, 0x000300f7, 0x000000df, 0x00000000, 0x000400fa, 0x000000dd, 0x000000de,
-    0x000000e3, 0x000200f8, 0x000000de, 0x00050041, 0x00000015, 0x000000e1, 0x0000000f, 0x0000005b,
-    0x0004003d, 0x00000006, 0x000000e2, 0x000000e1, 0x0003003e, 0x000000e0, 0x000000e2, 0x000200f9,
-    0x000000df, 0x000200f8, 0x000000e3, 0x00050041, 0x00000015, 0x000000e4, 0x00000047, 0x00000036,
-    0x0004003d, 0x00000006, 0x000000e5, 0x000000e4, 0x00050041, 0x00000015, 0x000000e6, 0x0000009a,
-    0x00000036, 0x0004003d, 0x00000006, 0x000000e7, 0x000000e6, 0x0007000c, 0x00000006, 0x000000e8,
-    0x00000001, 0x00000027, 0x000000e5, 0x000000e7, 0x0003003e, 0x000000e0, 0x000000e8, 0x000200f9,
-    0x000000df, 0x000200f8, 0x000000df, 0x0004003d, 0x00000006, 0x000000e9, 0x000000e0, 0x00050041,
-    0x00000015, 0x000000eb, 0x00000011, 0x000000ea, 0x0004003d, 0x00000006, 0x000000ec, 0x000000eb,
-    0x000500ad, 0x0000000d, 0x000000ed, 0x000000e9, 0x000000ec, 0x000300f7, 0x000000ef, 0x00000000,
-    0x000400fa, 0x000000ed, 0x000000ee, 0x000000ef, 0x000200f8, 0x000000ee, 0x000200fe, 0x00000028,
-    0x000200f8, 0x000000ef, 0x00050041, 0x00000015, 0x000000f1, 0x0000000f, 0x00000064, 0x0004003d,
-    0x00000006, 0x000000f2, 0x000000f1, 0x00050041, 0x00000015, 0x000000f3, 0x00000010, 0x00000018,
-    0x0004003d, 0x00000006, 0x000000f4, 0x000000f3, 0x000500af, 0x0000000d, 0x000000f5, 0x000000f2,
-    0x000000f4, 0x000300f7, 0x000000f7, 0x00000000, 0x000400fa, 0x000000f5, 0x000000f6, 0x000000f7,
-    0x000200f8, 0x000000f6, 0x00050041, 0x00000015, 0x000000f8, 0x0000000f, 0x00000064, 0x0004003d,
-    0x00000006, 0x000000f9, 0x000000f8, 0x00050041, 0x00000015, 0x000000fa, 0x00000011, 0x00000018,
-    0x0004003d, 0x00000006, 0x000000fb, 0x000000fa, 0x000500b3, 0x0000000d, 0x000000fc, 0x000000f9,
-    0x000000fb, 0x000200f9, 0x000000f7, 0x000200f8, 0x000000f7, 0x000700f5, 0x0000000d, 0x000000fd,
-    0x000000f5, 0x000000ef, 0x000000fc, 0x000000f6, 0x000300f7, 0x000000ff, 0x00000000, 0x000400fa,
-    0x000000fd, 0x000000fe, 0x00000103, 0x000200f8, 0x000000fe, 0x00050041, 0x00000015, 0x00000101,
-    0x0000000f, 0x0000005e, 0x0004003d, 0x00000006, 0x00000102, 0x00000101, 0x0003003e, 0x00000100,
-    0x00000102, 0x000200f9, 0x000000ff, 0x000200f8, 0x00000103, 0x00050041, 0x00000015, 0x00000104,
-    0x00000047, 0x00000014, 0x0004003d, 0x00000006, 0x00000105, 0x00000104, 0x00050041, 0x00000015,
-    0x00000106, 0x0000009a, 0x00000014, 0x0004003d, 0x00000006, 0x00000107, 0x00000106, 0x0007000c,
-    0x00000006, 0x00000108, 0x00000001, 0x0000002a, 0x00000105, 0x00000107, 0x00050082, 0x00000006,
-    0x00000109, 0x00000108, 0x00000014, 0x0003003e, 0x00000100, 0x00000109, 0x000200f9, 0x000000ff,
-    0x000200f8, 0x000000ff, 0x0004003d, 0x00000006, 0x0000010a, 0x00000100, 0x00050041, 0x00000015,
-    0x0000010b, 0x00000010, 0x000000ea, 0x0004003d, 0x00000006, 0x0000010c, 0x0000010b, 0x000500b1,
-    0x0000000d, 0x0000010d, 0x0000010a, 0x0000010c, 0x000300f7, 0x0000010f, 0x00000000, 0x000400fa,
-    0x0000010d, 0x0000010e, 0x0000010f, 0x000200f8, 0x0000010e, 0x000200fe, 0x00000028, 0x000200f8,
-    0x0000010f, 0x000200fe, 0x00000111, 0x00010038,
+const uint8_t Blob078_Data[4975] =
+{
+    0x28, 0xb5, 0x2f, 0xfd, 0x60, 0x30, 0x4a, 0x2d, 0x9b, 0x00, 0x3a, 0xa1, 0xc4, 0x26, 0x37, 0x10,
+    0x98, 0x59, 0x63, 0xc0, 0x38, 0x32, 0x61, 0x60, 0x60, 0x60, 0x48, 0x41, 0xc1, 0x24, 0x4f, 0x52,
+    0x50, 0x18, 0x97, 0x35, 0x25, 0xc1, 0x22, 0xb0, 0xab, 0xb6, 0x6a, 0x59, 0xe6, 0xff, 0xff, 0x7b,
+    0xae, 0xd5, 0xee, 0xfa, 0xf2, 0x6d, 0x18, 0x15, 0x6d, 0xa7, 0xef, 0x3d, 0x4d, 0xa6, 0xd6, 0xde,
+    0xf3, 0x5b, 0xb2, 0xb5, 0xb4, 0x29, 0x1d, 0x02, 0x43, 0x02, 0x8d, 0x02, 0x3c, 0x0e, 0x3f, 0xc7,
+    0xb3, 0x33, 0x3e, 0x06, 0x0a, 0x13, 0x81, 0xb6, 0x6e, 0x7b, 0x03, 0x01, 0x71, 0xed, 0xff, 0xbd,
+    0xd7, 0x0e, 0xdc, 0xf1, 0x34, 0xa6, 0xf2, 0x97, 0xf8, 0x96, 0x6e, 0x49, 0xdb, 0x65, 0x53, 0xea,
+    0xf4, 0x76, 0xf7, 0xde, 0x6a, 0xf3, 0xeb, 0xf6, 0xcd, 0xad, 0xde, 0x5c, 0x0b, 0x76, 0x5d, 0xde,
+    0xed, 0xee, 0x79, 0xd5, 0xfb, 0xc5, 0xd5, 0x3e, 0x7b, 0xcf, 0xd9, 0x5b, 0x2f, 0x17, 0xed, 0xbf,
+    0x81, 0x60, 0x09, 0x7d, 0xf3, 0x07, 0xea, 0xdd, 0x2c, 0x9e, 0xdb, 0xd9, 0xfb, 0x0d, 0xd7, 0x87,
+    0xc5, 0x2d, 0xbc, 0x7d, 0x5a, 0xf5, 0xcd, 0xae, 0xde, 0xe9, 0x1f, 0x6d, 0xef, 0x1f, 0x9d, 0xdc,
+    0xef, 0x6f, 0x36, 0x1b, 0xa7, 0x37, 0xbf, 0xd7, 0xae, 0x7e, 0xdd, 0x92, 0x74, 0x1d, 0xf2, 0xe9,
+    0xbc, 0xb6, 0x7e, 0x94, 0xff, 0xb7, 0x3b, 0x16, 0xc7, 0x33, 0xea, 0xe0, 0xea, 0x77, 0xff, 0xe6,
+    0xdd, 0xea, 0xf6, 0x0b, 0x96, 0x1b, 0xf3, 0x8a, 0x7d, 0x61, 0x6f, 0xdd, 0xde, 0xd2, 0x01, 0x7e,
+    0x6d, 0x38, 0xec, 0xad, 0xd5, 0x6f, 0xae, 0xc1, 0x1b, 0x9b, 0xbb, 0xe5, 0x5d, 0x7c, 0x17, 0xcc,
+    0xad, 0x4a, 0xae, 0x7d, 0xed, 0x72, 0xb1, 0xfe, 0xe6, 0xe2, 0x75, 0xf7, 0x57, 0xb7, 0xbb, 0x57,
+    0x2a, 0xb5, 0x36, 0x40, 0xbd, 0x8b, 0xf7, 0xc7, 0x8d, 0xfe, 0x20, 0xd6, 0xcd, 0x0b, 0xee, 0xea,
+    0xda, 0xe7, 0x5c, 0xde, 0xa0, 0x6d, 0x7c, 0x6b, 0x5e, 0x8e, 0x07, 0xe6, 0x49, 0xe6, 0xe1, 0xb7,
+    0xfe, 0xf1, 0xdf, 0xf4, 0x3b, 0x9b, 0x05, 0xa7, 0x7d, 0xdf, 0x9e, 0xae, 0xeb, 0xba, 0xae, 0xeb,
+    0xba, 0xae, 0xeb, 0xba, 0xae, 0xeb, 0xba, 0xae, 0xeb, 0xba, 0x4e, 0x7e, 0x07, 0xdb, 0xa2, 0x5c,
+    0x1b, 0xdf, 0xf1, 0xdc, 0x4d, 0xea, 0x0e, 0x6a, 0xf7, 0xbc, 0x8b, 0x7a, 0xa9, 0x1d, 0x56, 0xef,
+    0x76, 0xaf, 0x50, 0x73, 0xda, 0x53, 0x9b, 0x33, 0x6c, 0xce, 0x29, 0xad, 0xa9, 0x8d, 0x49, 0x3a,
+    0xa7, 0x77, 0xb9, 0xdd, 0x6a, 0x33, 0x89, 0xc7, 0xc4, 0x5b, 0x22, 0xf7, 0xf6, 0xfe, 0xab, 0xb5,
+    0xb9, 0x6c, 0x5e, 0xfc, 0x7a, 0xcf, 0x25, 0xe7, 0x92, 0x6f, 0x15, 0xec, 0x56, 0x6f, 0x2d, 0x76,
+    0x0d, 0xf9, 0x8f, 0xcd, 0xd7, 0x8e, 0xbb, 0x6e, 0xef, 0x74, 0x37, 0x16, 0xff, 0xe6, 0x6e, 0xf2,
+    0x1c, 0x66, 0x94, 0x3e, 0xd2, 0x0b, 0xde, 0x6f, 0xba, 0x35, 0xaa, 0x9e, 0x7e, 0xe7, 0xb9, 0x9b,
+    0xf4, 0xae, 0xb9, 0x92, 0xbf, 0x6f, 0xb5, 0xf8, 0xdc, 0xde, 0xb5, 0x90, 0xdc, 0xb3, 0xb7, 0xd5,
+    0xdb, 0xdd, 0x9d, 0x5e, 0xa7, 0x57, 0x80, 0x0b, 0x52, 0xc3, 0xb2, 0x5f, 0x61, 0xe0, 0x30, 0xfc,
+    0xeb, 0x6b, 0xbf, 0x82, 0xf5, 0xfd, 0xbb, 0x95, 0xe3, 0x69, 0xff, 0x0f, 0xf5, 0xcf, 0xcf, 0x70,
+    0xe3, 0x77, 0xda, 0x1c, 0xbf, 0xda, 0x6c, 0xcb, 0xf9, 0x26, 0xb4, 0xad, 0xb7, 0x0e, 0xde, 0x07,
+    0xef, 0xba, 0x25, 0xfa, 0xf5, 0x7d, 0x47, 0x53, 0xee, 0xb9, 0x8d, 0xeb, 0xf6, 0x1d, 0x3d, 0xeb,
+    0x25, 0x07, 0x6d, 0x24, 0x5c, 0xde, 0x71, 0xef, 0xa6, 0xc9, 0xff, 0xde, 0x6e, 0x9d, 0xde, 0xd2,
+    0x6c, 0x7b, 0xe9, 0xf2, 0xf6, 0xaf, 0x8e, 0xb3, 0xfd, 0xfc, 0xf3, 0xe7, 0x5d, 0x2d, 0x21, 0xb7,
+    0x2b, 0xb7, 0xf4, 0x48, 0x2c, 0x98, 0x7b, 0xcd, 0x71, 0xe5, 0x2d, 0x88, 0xef, 0xd7, 0x5b, 0xc7,
+    0xb1, 0x7f, 0x77, 0x8e, 0x73, 0xff, 0x6e, 0x2e, 0xe1, 0xfe, 0xfd, 0xf3, 0x7a, 0xaf, 0x7f, 0x6b,
+    0xd6, 0xb6, 0xb8, 0xb8, 0xb6, 0xbf, 0xe5, 0x23, 0xb7, 0xc8, 0x47, 0xa3, 0xf4, 0x09, 0xe9, 0xcc,
+    0x8a, 0x7e, 0x8e, 0xdb, 0x81, 0xc8, 0xe4, 0xd3, 0xef, 0xf4, 0xc7, 0x6f, 0x7a, 0xe9, 0x82, 0x31,
+    0x30, 0xec, 0xfe, 0x05, 0xb3, 0xd2, 0x59, 0xdb, 0xe6, 0x7f, 0xe3, 0xcb, 0xff, 0xf4, 0x32, 0x87,
+    0x57, 0x3e, 0xf3, 0x8d, 0xc7, 0xa7, 0x09, 0xc8, 0xc7, 0x04, 0xe8, 0x2b, 0x2a, 0xab, 0x2b, 0xe6,
+    0x00, 0xab, 0xaa, 0xb8, 0x01, 0x66, 0x7f, 0xfc, 0x07, 0x46, 0x01, 0x85, 0x01, 0x68, 0xb3, 0x31,
+    0x80, 0xe4, 0xa3, 0xf1, 0xdd, 0xc1, 0xad, 0x99, 0x41, 0xa7, 0x5b, 0x39, 0x0a, 0x55, 0xdc, 0xf6,
+    0x81, 0xd2, 0x91, 0xd3, 0x4c, 0x5c, 0x42, 0x41, 0x02, 0x45, 0xdc, 0xf2, 0x38, 0x9c, 0x11, 0x63,
+    0x8b, 0xc2, 0x44, 0xe0, 0xf2, 0xcd, 0xad, 0x6a, 0xd6, 0x14, 0xfb, 0xc2, 0x82, 0x52, 0x35, 0xe9,
+    0x27, 0x35, 0xe9, 0xe8, 0xe5, 0xe9, 0xd4, 0x54, 0x21, 0xd4, 0x4b, 0xba, 0x61, 0xac, 0x61, 0xfc,
+    0x25, 0x54, 0x0e, 0x3e, 0x32, 0x83, 0xe1, 0x0b, 0xfe, 0x83, 0x97, 0xbb, 0x54, 0xfe, 0x56, 0x75,
+    0xe5, 0x2b, 0xd5, 0xb6, 0xf0, 0xb2, 0x5d, 0x55, 0x21, 0xef, 0xea, 0xab, 0x09, 0xcc, 0xe9, 0xf5,
+    0xe5, 0x75, 0xe6, 0x9c, 0x1a, 0x36, 0x59, 0x31, 0xfd, 0x8b, 0x68, 0x32, 0x13, 0x1f, 0x79, 0x3c,
+    0xca, 0xd4, 0x6f, 0x1a, 0x2b, 0x51, 0xa2, 0x2b, 0x51, 0xa2, 0x27, 0x51, 0x45, 0x92, 0x14, 0x89,
+    0x2e, 0x31, 0x9e, 0xc7, 0x5e, 0x90, 0x02, 0x1f, 0x3f, 0xac, 0x7c, 0x24, 0x48, 0xa0, 0x43, 0x49,
+    0x8b, 0xd0, 0xe6, 0x4d, 0xc0, 0x0b, 0x78, 0xf3, 0xc2, 0x56, 0x4b, 0x57, 0xb8, 0xfa, 0xa3, 0xca,
+    0x7e, 0x14, 0xf8, 0xe6, 0xbe, 0x6f, 0x92, 0x29, 0x44, 0xf7, 0xf4, 0xf8, 0xa8, 0xb2, 0xf6, 0xf4,
+    0x98, 0xdc, 0xae, 0xd8, 0xd6, 0xda, 0xb2, 0xb0, 0x55, 0x5a, 0x3b, 0x33, 0xbe, 0x57, 0xe2, 0xd9,
+    0x43, 0x58, 0x62, 0x70, 0x35, 0xa5, 0x2e, 0x98, 0x97, 0x09, 0x66, 0xa3, 0xd2, 0x4b, 0xee, 0x42,
+    0x72, 0x51, 0x91, 0x08, 0xb2, 0xa8, 0x72, 0x55, 0xd4, 0x38, 0x75, 0x15, 0xa5, 0x4a, 0x1d, 0xa1,
+    0xc6, 0x27, 0x04, 0x3f, 0xa6, 0xa3, 0x36, 0xa4, 0x66, 0x40, 0x61, 0x3c, 0x5b, 0x44, 0xa9, 0x80,
+    0x3a, 0xf1, 0x44, 0xc2, 0x19, 0xc2, 0xc9, 0xb0, 0x89, 0x03, 0x93, 0x86, 0x66, 0x06, 0xe6, 0xbe,
+    0xc4, 0xb0, 0x94, 0x2b, 0x01, 0xe9, 0xad, 0x76, 0xc6, 0x26, 0x6d, 0xa4, 0xdf, 0x91, 0xaf, 0x9e,
+    0xd0, 0xb4, 0x52, 0xdf, 0x9a, 0x11, 0xdc, 0x06, 0xd4, 0x6e, 0x55, 0xf5, 0x1a, 0xdb, 0xbc, 0x36,
+    0xe0, 0xa7, 0x5b, 0x4c, 0x5c, 0xb2, 0xd5, 0x14, 0x3d, 0xd3, 0xd0, 0xab, 0x67, 0x57, 0x73, 0xc9,
+    0x34, 0x33, 0x3d, 0x99, 0x4d, 0x99, 0x19, 0xa5, 0x5f, 0x49, 0xcf, 0x4c, 0x3f, 0x40, 0x29, 0xf5,
+    0xb4, 0x71, 0x86, 0x1e, 0xb1, 0xa2, 0x00, 0x30, 0x0b, 0xe5, 0xef, 0xd2, 0xf5, 0x6a, 0xcf, 0x15,
+    0x8c, 0x4b, 0xa5, 0x2c, 0x3b, 0x91, 0x89, 0x47, 0xb1, 0x6c, 0x68, 0xfc, 0xaf, 0x44, 0x09, 0x39,
+    0xc9, 0x39, 0x4b, 0x7a, 0xa3, 0x20, 0x23, 0x20, 0xe0, 0x3f, 0xee, 0x35, 0x6f, 0x5f, 0x8b, 0xf5,
+    0x59, 0x7f, 0x35, 0x53, 0x6d, 0x79, 0xb6, 0x54, 0xa6, 0x24, 0x1b, 0x93, 0xa5, 0xff, 0x7d, 0x7c,
+    0xaf, 0x94, 0x91, 0xc6, 0xb1, 0xaa, 0xac, 0x00, 0x51, 0x19, 0xeb, 0xb3, 0xac, 0xf2, 0xf1, 0xff,
+    0xad, 0x82, 0x5b, 0x1b, 0x85, 0x68, 0x9e, 0x54, 0x1d, 0x54, 0xee, 0x69, 0x8d, 0xaa, 0xa1, 0xd4,
+    0x9e, 0xce, 0x9c, 0x65, 0x4e, 0x64, 0x4d, 0x63, 0x4c, 0xd2, 0xa6, 0x17, 0x73, 0x6b, 0x59, 0x60,
+    0xe9, 0x4a, 0x49, 0x45, 0x4f, 0xcd, 0xcf, 0xa4, 0x13, 0xd9, 0x3c, 0x2a, 0x65, 0xa4, 0xf1, 0x09,
+    0x7c, 0xfd, 0xd5, 0x70, 0x63, 0x71, 0x7d, 0xa7, 0xb3, 0x70, 0xb3, 0xed, 0xff, 0xbd, 0xce, 0xd7,
+    0xef, 0xad, 0x66, 0xe7, 0x38, 0xdf, 0xcf, 0x82, 0x77, 0x32, 0x9c, 0xbc, 0xf6, 0xb8, 0xd9, 0x1d,
+    0xd8, 0xad, 0xe2, 0xdf, 0xae, 0xdc, 0x3e, 0xfd, 0x82, 0x45, 0xbf, 0xe9, 0xe9, 0x2f, 0xf3, 0xae,
+    0x5f, 0x5e, 0xbe, 0x8c, 0xcd, 0xd1, 0x72, 0xe4, 0xff, 0x91, 0x6b, 0xdf, 0x73, 0xf2, 0xd2, 0xe3,
+    0x61, 0xef, 0x5d, 0xef, 0xd2, 0x19, 0xff, 0xf7, 0x1c, 0xdc, 0xad, 0xe2, 0xfd, 0xce, 0x05, 0x7f,
+    0xef, 0x39, 0xf9, 0x33, 0x28, 0xbe, 0x55, 0xbf, 0xe5, 0xbe, 0xe3, 0xfc, 0xbe, 0xf5, 0x2b, 0x9d,
+    0x20, 0xdd, 0xe6, 0xf6, 0xa1, 0x23, 0x27, 0x11, 0xca, 0x8e, 0x04, 0x31, 0x76, 0x6b, 0x75, 0x73,
+    0x72, 0x74, 0x2f, 0xcf, 0x4d, 0x90, 0xe5, 0xfe, 0xe3, 0x64, 0x09, 0x56, 0xc4, 0x08, 0xff, 0x6f,
+    0x6e, 0x2f, 0xd7, 0x6d, 0x6b, 0x6d, 0x88, 0x6c, 0x34, 0x84, 0x33, 0x08, 0x6a, 0x55, 0xb5, 0x6a,
+    0x5a, 0xda, 0xa3, 0x9d, 0x29, 0x3e, 0x98, 0x9a, 0x95, 0x4d, 0xa9, 0x65, 0xff, 0x21, 0x1c, 0x90,
+    0x51, 0xe9, 0x17, 0xd3, 0xc0, 0xc1, 0x54, 0x03, 0x06, 0x64, 0xe3, 0x43, 0x06, 0x63, 0x0b, 0xc4,
+    0x16, 0x28, 0x8e, 0x29, 0x08, 0x13, 0x53, 0x20, 0x05, 0x0b, 0x4b, 0x20, 0x4d, 0xc0, 0xd5, 0xc5,
+    0x85, 0xa0, 0x6b, 0x0b, 0xc1, 0x16, 0x7d, 0xa5, 0x75, 0xc0, 0x47, 0x01, 0x03, 0x60, 0x0a, 0x64,
+    0x11, 0x98, 0x66, 0x45, 0xb1, 0xac, 0xac, 0xae, 0xaa, 0x06, 0x54, 0xd1, 0x54, 0x51, 0x01, 0x54,
+    0x76, 0x00, 0x01, 0x5c, 0x02, 0x58, 0x4d, 0x01, 0x98, 0x82, 0x3e, 0xfd, 0xa4, 0xa0, 0x51, 0x50,
+    0x4f, 0xc3, 0x67, 0xd4, 0x53, 0x13, 0x94, 0xec, 0x7c, 0xea, 0xe3, 0x04, 0x09, 0xd2, 0xd2, 0x58,
+    0x59, 0x48, 0x9b, 0x91, 0x67, 0xf9, 0xf8, 0x53, 0x39, 0x89, 0x44, 0x7b, 0x04, 0xe9, 0x91, 0x23,
+    0x48, 0x8b, 0x8b, 0x8e, 0x10, 0x17, 0x15, 0x1b, 0xf5, 0x61, 0x84, 0xa8, 0x11, 0x76, 0x11, 0xa3,
+    0xb1, 0xa2, 0x45, 0x89, 0x14, 0x4d, 0x25, 0x3a, 0x44, 0x08, 0xd1, 0x03, 0x1a, 0x3a, 0x54, 0xc8,
+    0xd0, 0x98, 0xaa, 0x10, 0xa1, 0x71, 0xa0, 0x41, 0x80, 0x02, 0x4d, 0x01, 0xf2, 0xf3, 0x67, 0x3c,
+    0xc3, 0xcf, 0x90, 0x20, 0x44, 0x88, 0xe0, 0xc1, 0xc3, 0x07, 0x51, 0xcf, 0x1e, 0x3e, 0x5e, 0x10,
+    0xf7, 0xe4, 0xd1, 0x83, 0x24, 0xcf, 0x1d, 0x3c, 0x77, 0xec, 0xe0, 0x59, 0xa4, 0x23, 0x27, 0xd1,
+    0x0e, 0x1d, 0x1e, 0x75, 0xe4, 0x1c, 0xce, 0x81, 0x13, 0x07, 0x8e, 0x9b, 0x37, 0x6e, 0xd8, 0xb4,
+    0x61, 0xa3, 0x66, 0x8d, 0x1a, 0x34, 0x69, 0xd0, 0x98, 0x39, 0x63, 0x86, 0x4c, 0x19, 0x32, 0x62,
+    0xc6, 0x88, 0x01, 0x13, 0x26, 0x31, 0xcc, 0x16, 0x30, 0x5e, 0xbe, 0x24, 0x7e, 0xd9, 0xe2, 0x85,
+    0x4b, 0x97, 0xc4, 0x2e, 0x5b, 0xb8, 0x68, 0xd9, 0x92, 0x45, 0x0b, 0x94, 0x2c, 0x58, 0xa0, 0x5c,
+    0xb1, 0x82, 0x05, 0xc9, 0x15, 0x2b, 0x86, 0x54, 0xaa, 0x50, 0xf9, 0x9f, 0x12, 0x45, 0xca, 0x34,
+    0xca, 0x7f, 0x93, 0x27, 0x60, 0x9c, 0x30, 0x69, 0x12, 0x66, 0x09, 0x13, 0x24, 0x4b, 0x94, 0x20,
+    0x71, 0x53, 0xd2, 0x4c, 0x42, 0x0b, 0x19, 0x22, 0xe4, 0xc8, 0xd8, 0xc8, 0x91, 0x22, 0x31, 0x8c,
+    0x14, 0x29, 0xf2, 0x44, 0x86, 0x28, 0x06, 0x09, 0x82, 0x08, 0x84, 0xc7, 0x8f, 0x1e, 0x40, 0x0e,
+    0x7b, 0x88, 0x0f, 0x77, 0xe0, 0x10, 0xeb, 0xc8, 0xb1, 0x63, 0x46, 0x0e, 0x33, 0x1c, 0xe1, 0x19,
+    0x37, 0x6a, 0x84, 0xe5, 0x6c, 0xdc, 0xe0, 0x62, 0x43, 0x5b, 0x63, 0x06, 0x43, 0x43, 0x46, 0x0c,
+    0x2e, 0x19, 0x74, 0x8b, 0x16, 0x63, 0x2e, 0x18, 0x74, 0xa2, 0xa9, 0x17, 0x5d, 0xb0, 0x5c, 0xb0,
+    0x68, 0xc1, 0x62, 0x45, 0x8b, 0xb7, 0x15, 0xd9, 0xac, 0x0a, 0x14, 0x26, 0xa0, 0x54, 0x34, 0x48,
+    0x81, 0xa2, 0x9a, 0xe2, 0x84, 0x89, 0x13, 0x24, 0x4a, 0x60, 0x28, 0xb1, 0x24, 0x41, 0x87, 0x18,
+    0x91, 0x8f, 0x10, 0xb1, 0x14, 0x42, 0xf9, 0x01, 0x04, 0x20, 0x88, 0xad, 0xf2, 0x03, 0xed, 0xc1,
+    0x50, 0x6b, 0x48, 0x7b, 0xe0, 0xd0, 0x01, 0xdb, 0x61, 0xe6, 0xb0, 0xa1, 0xd0, 0x2e, 0x4c, 0x6e,
+    0x20, 0xd4, 0xe0, 0xa7, 0x01, 0x49, 0x98, 0x61, 0x90, 0x6f, 0xf0, 0x98, 0x01, 0x2c, 0x68, 0x25,
+    0x28, 0x83, 0xbf, 0xfb, 0x73, 0x37, 0x7e, 0x31, 0xe8, 0x81, 0x3a, 0xf4, 0x31, 0x4c, 0xf0, 0x6a,
+    0xb9, 0x80, 0xdd, 0x1c, 0x8d, 0x7b, 0x67, 0x6f, 0x6c, 0xd6, 0xee, 0x2a, 0xa1, 0x0e, 0x7b, 0x77,
+    0x97, 0x77, 0x55, 0x62, 0xe1, 0xcf, 0xae, 0x80, 0x86, 0x97, 0x47, 0x8b, 0xe1, 0xd9, 0xdd, 0xd9,
+    0xd5, 0xdd, 0xc1, 0xd1, 0x6d, 0x59, 0xeb, 0xe8, 0x6f, 0x34, 0x17, 0x47, 0x37, 0x61, 0x4e, 0x6e,
+    0xc2, 0x53, 0x2e, 0x0e, 0x4e, 0x02, 0x9c, 0x55, 0x42, 0x04, 0xeb, 0x12, 0xac, 0x08, 0xf3, 0xd6,
+    0x5b, 0x5d, 0x6d, 0x53, 0xab, 0x0d, 0xcd, 0xd4, 0xd2, 0xcc, 0xd0, 0x1e, 0xa4, 0x31, 0xa9, 0x1e,
+    0x30, 0xcb, 0xc4, 0xa8, 0x0e, 0xca, 0xbe, 0xa8, 0x0d, 0x1c, 0x90, 0x35, 0x98, 0x4e, 0xc9, 0x18,
+    0x7c, 0x85, 0x49, 0x15, 0x18, 0x62, 0x85, 0x25, 0x00, 0x93, 0xce, 0x22, 0x9e, 0x60, 0x5e, 0x5d,
+    0x5d, 0x79, 0xb6, 0x1e, 0x71, 0x69, 0x69, 0x41, 0xfa, 0xad, 0xc5, 0xa9, 0x81, 0x03, 0x4c, 0x44,
+    0xb0, 0x0c, 0xcc, 0x05, 0xb0, 0x08, 0x14, 0xc8, 0x0a, 0x6f, 0x7c, 0xb2, 0x7f, 0xe3, 0x93, 0x53,
+    0x93, 0x53, 0x93, 0x53, 0x73, 0xc9, 0xc4, 0x6c, 0x8e, 0x9d, 0xcc, 0x5f, 0x56, 0x5a, 0x9a, 0x41,
+    0xd0, 0x5c, 0xca, 0x99, 0x0e, 0xcf, 0xc8, 0xe4, 0xd3, 0x88, 0x3c, 0x56, 0x32, 0xbe, 0xec, 0x67,
+    0xa4, 0x64, 0x3c, 0x52, 0x9a, 0x54, 0x49, 0xf1, 0xd0, 0xa4, 0xc5, 0xc5, 0x48, 0x92, 0x20, 0x45,
+    0x82, 0xe4, 0xe8, 0x11, 0xd6, 0x91, 0xe2, 0xa2, 0x62, 0xa3, 0x45, 0x46, 0x8d, 0x16, 0x31, 0x5a,
+    0x94, 0x48, 0x11, 0x36, 0xd1, 0x21, 0x43, 0x87, 0x0c, 0x15, 0x3a, 0x44, 0xa8, 0xd0, 0x20, 0x42,
+    0xe3, 0xa7, 0x41, 0x79, 0x04, 0xe1, 0x09, 0x04, 0x48, 0x2b, 0xd0, 0x1f, 0x40, 0xe1, 0x3f, 0x7d,
+    0xfc, 0x4c, 0xdb, 0xfa, 0xf0, 0xc1, 0xb3, 0x27, 0x8f, 0x9e, 0x3d, 0x7c, 0x4e, 0x7a, 0xee, 0xf0,
+    0xb9, 0x63, 0x07, 0xcf, 0x1b, 0x2d, 0x3b, 0x70, 0xe4, 0xd4, 0x69, 0x42, 0xe7, 0x69, 0x4e, 0x1c,
+    0x39, 0x71, 0xde, 0xc0, 0x79, 0xe3, 0x06, 0xce, 0xe2, 0x1a, 0x37, 0x4c, 0x49, 0xda, 0x4c, 0x39,
+    0xd9, 0xa8, 0x59, 0x63, 0xab, 0x41, 0x93, 0x26, 0x9c, 0x46, 0x8c, 0xc6, 0xcc, 0x99, 0xf0, 0x19,
+    0xb1, 0x19, 0x32, 0x65, 0xc2, 0x65, 0xc4, 0x64, 0xc4, 0x8c, 0x09, 0x8f, 0x11, 0x8b, 0x01, 0x13,
+    0x26, 0x1c, 0x46, 0x0c, 0xc6, 0xcb, 0x97, 0xf0, 0x17, 0xb1, 0x17, 0x2e, 0x5d, 0xc2, 0x5d, 0xc4,
+    0x5c, 0xb4, 0x6c, 0x09, 0x6f, 0x11, 0x6b, 0xc9, 0x92, 0x18, 0x4e, 0x14, 0x67, 0xb9, 0x82, 0x25,
+    0x8c, 0x45, 0x7c, 0xa5, 0x8a, 0x95, 0xb0, 0x15, 0x71, 0x95, 0x29, 0x54, 0xc2, 0x54, 0xc4, 0x53,
+    0xa2, 0x48, 0x09, 0x4b, 0x11, 0x47, 0x79, 0x02, 0x25, 0x0c, 0x45, 0xfc, 0xa4, 0x89, 0x93, 0xb0,
+    0x13, 0x71, 0x93, 0x25, 0x4c, 0xc2, 0x4c, 0xc4, 0x4b, 0x92, 0x28, 0x09, 0x2b, 0x11, 0x27, 0x39,
+    0x82, 0x24, 0x8c, 0x44, 0x7c, 0xa4, 0x88, 0x91, 0xb0, 0x11, 0x71, 0x91, 0x21, 0x44, 0xc2, 0x44,
+    0xc4, 0x43, 0x82, 0x08, 0x09, 0x0b, 0x11, 0x07, 0x01, 0x82, 0x18, 0x46, 0x14, 0x03, 0xf1, 0xf1,
+    0x23, 0xfc, 0x43, 0xec, 0x83, 0x47, 0x8f, 0x70, 0x0f, 0x31, 0x8f, 0x1d, 0x62, 0x1d, 0x3b, 0x72,
+    0xe8, 0xa0, 0xe6, 0x38, 0xc4, 0x71, 0x58, 0xc3, 0xc6, 0x8d, 0x68, 0x0d, 0x19, 0x33, 0x68, 0x48,
+    0xc9, 0x78, 0x01, 0x23, 0x06, 0xf4, 0x05, 0x8b, 0x16, 0x2e, 0x9e, 0x2c, 0x52, 0xa8, 0x58, 0x11,
+    0x95, 0xc2, 0xc4, 0x09, 0x14, 0x50, 0x26, 0x46, 0x90, 0x28, 0xf1, 0x34, 0x02, 0x44, 0x08, 0x11,
+    0x4e, 0x10, 0x1e, 0x0c, 0x3f, 0x38, 0x79, 0x28, 0xe4, 0xd0, 0xa1, 0xa9, 0x90, 0x50, 0xc3, 0x06,
+    0x26, 0x42, 0xc1, 0x0c, 0x83, 0x4d, 0xc1, 0xef, 0x0e, 0x66, 0x7e, 0xbd, 0x18, 0xf4, 0xa5, 0x37,
+    0x30, 0xef, 0x2e, 0x05, 0x5e, 0x00, 0xe4, 0x2a, 0x2f, 0x64, 0xb5, 0xf8, 0x96, 0xce, 0xd2, 0x57,
+    0xec, 0x3d, 0x5f, 0x2b, 0xd8, 0x16, 0x92, 0x15, 0xfa, 0xfc, 0xfe, 0x90, 0x7d, 0x7b, 0x7c, 0x14,
+    0x8e, 0x7b, 0x79, 0x56, 0x7a, 0x72, 0xde, 0xdd, 0x13, 0xcf, 0x78, 0x57, 0xd7, 0x66, 0xf7, 0x75,
+    0x13, 0xe8, 0x6a, 0x39, 0xeb, 0xdc, 0x04, 0xb4, 0x38, 0x39, 0x69, 0x1c, 0x9c, 0x84, 0x29, 0x9c,
+    0x1a, 0xb5, 0x7a, 0xa6, 0x96, 0x56, 0x45, 0x4b, 0x43, 0x83, 0x70, 0xf6, 0x00, 0xc2, 0x83, 0x32,
+    0xb3, 0xa7, 0x32, 0x69, 0x83, 0x05, 0x5f, 0x0e, 0x94, 0x53, 0x2e, 0x63, 0x83, 0xe6, 0x93, 0x8c,
+    0x8b, 0xc1, 0xd8, 0x02, 0xb1, 0x31, 0xb1, 0x30, 0x05, 0x61, 0x5c, 0x60, 0x09, 0x66, 0x10, 0x60,
+    0x5f, 0x5d, 0x5e, 0x5d, 0x5a, 0x5b, 0x94, 0x0e, 0x68, 0x1d, 0x30, 0xa0, 0x55, 0x15, 0x65, 0xe0,
+    0xb1, 0x0a, 0x34, 0x21, 0xe0, 0xcc, 0xba, 0xc2, 0xb2, 0xba, 0xaa, 0xaa, 0x1a, 0x40, 0xc5, 0x24,
+    0x24, 0x2a, 0xe0, 0x48, 0x80, 0xa9, 0x27, 0x00, 0xd1, 0xa7, 0xd4, 0xe7, 0x81, 0x86, 0xdb, 0xd8,
+    0xa8, 0x52, 0x9a, 0x2b, 0xea, 0xc9, 0xd9, 0x74, 0x5a, 0x32, 0x68, 0x7a, 0xa8, 0x29, 0xd9, 0xa4,
+    0xae, 0xae, 0xb3, 0x07, 0x68, 0x68, 0xba, 0xd9, 0x3f, 0x31, 0xe8, 0x66, 0x18, 0xe6, 0xdc, 0xbb,
+    0x9d, 0x5e, 0xbd, 0xdd, 0x40, 0x3c, 0xaf, 0x92, 0xe3, 0x06, 0xc2, 0xd8, 0x01, 0x2f, 0x70, 0xf9,
+    0x00, 0xe1, 0x2e, 0x4c, 0x71, 0xed, 0xbd, 0xcd, 0x6a, 0xcd, 0xb2, 0xd8, 0xdb, 0x50, 0x11, 0xfb,
+    0xc7, 0xe7, 0xf7, 0x37, 0x4f, 0xf5, 0xf9, 0x19, 0xbb, 0xa6, 0x72, 0x1f, 0xf2, 0x8e, 0xc2, 0xde,
+    0x9d, 0xde, 0x9e, 0xd6, 0x08, 0xa8, 0x97, 0xf7, 0x70, 0x78, 0x76, 0x70, 0x75, 0x74, 0x01, 0x89,
+    0xa8, 0xa8, 0x54, 0x45, 0xbc, 0x32, 0xa1, 0x19, 0x04, 0x41, 0xd0, 0x02, 0x03, 0x9a, 0x09, 0x03,
+    0xb4, 0x28, 0xa5, 0x4e, 0x0b, 0x94, 0x8b, 0x02, 0xc3, 0xc0, 0xef, 0x50, 0x58, 0x84, 0x0b, 0x00,
+    0x33, 0x00, 0xa0, 0x00, 0x30, 0x22, 0x92, 0x14, 0x49, 0x01, 0x13, 0x03, 0xfd, 0x61, 0x50, 0x85,
+    0xc7, 0x6b, 0xc0, 0xb1, 0x87, 0xd4, 0x36, 0xfe, 0x6b, 0xec, 0x3a, 0x3a, 0xc8, 0xe5, 0x2b, 0x0c,
+    0x96, 0xd3, 0xf3, 0x92, 0x01, 0x76, 0x90, 0xa6, 0x1e, 0x30, 0x35, 0x8c, 0xa2, 0x70, 0x4f, 0x8e,
+    0xed, 0x3c, 0x75, 0x04, 0xbc, 0x9d, 0x2a, 0xfc, 0x1a, 0x0a, 0x9d, 0x5d, 0xb4, 0x91, 0x89, 0x83,
+    0xe7, 0x2b, 0xe2, 0x3e, 0xd3, 0x6a, 0x35, 0x0a, 0x15, 0x0c, 0x62, 0x4a, 0xf0, 0xac, 0x9b, 0xba,
+    0x7d, 0x31, 0xdf, 0x35, 0x33, 0x9b, 0xbb, 0x3f, 0xf0, 0x8d, 0x67, 0x5f, 0x8e, 0xb7, 0x07, 0xbf,
+    0xd7, 0x81, 0xe8, 0x7d, 0x7d, 0x21, 0xcb, 0x03, 0xfb, 0x02, 0x7c, 0x32, 0x11, 0x65, 0x8f, 0x06,
+    0xe5, 0x41, 0x2b, 0x83, 0xca, 0x5f, 0xf9, 0xc7, 0xbc, 0x98, 0x50, 0x6d, 0x3b, 0x87, 0xd5, 0x36,
+    0x6e, 0x6d, 0xd6, 0xeb, 0x3e, 0x06, 0x10, 0xb7, 0xd1, 0x75, 0x8c, 0x03, 0x96, 0x4f, 0x3a, 0x7e,
+    0xa5, 0xdd, 0xab, 0x32, 0x84, 0x69, 0x17, 0x96, 0x8d, 0x6b, 0x5d, 0xc6, 0x38, 0x0c, 0x7b, 0xef,
+    0x18, 0xed, 0x9e, 0x49, 0xfb, 0x93, 0x3d, 0x7e, 0x6e, 0xe7, 0xf5, 0x76, 0x5e, 0x6d, 0xe7, 0xeb,
+    0x6e, 0xbe, 0xae, 0xe6, 0xeb, 0x6d, 0xbe, 0xde, 0xc6, 0xeb, 0xed, 0xbc, 0xde, 0xce, 0xab, 0xed,
+    0x7c, 0xdd, 0xcd, 0xd7, 0xd5, 0x7c, 0xbd, 0xcd, 0xd7, 0xdb, 0x78, 0xbd, 0x9d, 0xd7, 0xdb, 0x79,
+    0xb5, 0x9d, 0xaf, 0xbb, 0xf9, 0xba, 0x9a, 0xaf, 0xd5, 0x1e, 0xae, 0x0e, 0xfe, 0xa9, 0x9c, 0x43,
+    0x11, 0x8c, 0x8a, 0x98, 0xb9, 0x2e, 0xed, 0x54, 0x0a, 0x29, 0x92, 0xea, 0x01, 0x2e, 0x3f, 0x45,
+    0x25, 0x69, 0x3e, 0x3c, 0x26, 0xdb, 0xb5, 0x5c, 0x09, 0x72, 0x4d, 0xf2, 0x1b, 0x0f, 0x71, 0x59,
+    0x29, 0x2b, 0x41, 0xf3, 0xe2, 0x30, 0x19, 0xae, 0xe4, 0x4a, 0x94, 0x69, 0x92, 0x9f, 0x7a, 0x80,
+    0xcb, 0x4a, 0x51, 0x49, 0xb5, 0x17, 0x87, 0x5b, 0x65, 0x37, 0x22, 0x87, 0xec, 0xc1, 0xd8, 0x4e,
+    0x76, 0x81, 0xa4, 0x90, 0x37, 0x07, 0x85, 0x40, 0x8f, 0xad, 0x3f, 0x99, 0x40, 0x33, 0x0b, 0x86,
+    0x28, 0x17, 0xb4, 0x63, 0xf6, 0xc4, 0xdb, 0x0f, 0xe9, 0x75, 0x00, 0x9f, 0xee, 0x1f, 0x2f, 0x49,
+    0x54, 0x55, 0x75, 0xa6, 0xdc, 0x68, 0xb8, 0x51, 0x9b, 0xa7, 0x1f, 0x10, 0x48, 0x1d, 0x09, 0x84,
+    0xbd, 0xdf, 0xdf, 0x90, 0x7f, 0x86, 0x10, 0xb8, 0x6c, 0x0e, 0x26, 0xbe, 0x6a, 0x40, 0x22, 0x9e,
+    0x8d, 0xf3, 0xd4, 0xeb, 0x60, 0xb7, 0x58, 0xb0, 0xc6, 0x1c, 0xb7, 0xd7, 0x40, 0x30, 0x07, 0xda,
+    0xeb, 0xfe, 0x64, 0xdd, 0x8d, 0x84, 0x1b, 0xaa, 0xb9, 0xd9, 0xf4, 0xfa, 0x91, 0x37, 0xdd, 0x89,
+    0x34, 0x8e, 0x8c, 0xfd, 0xa5, 0x9f, 0xd3, 0xa8, 0xff, 0xe0, 0x8d, 0xfe, 0xb0, 0xa5, 0xf7, 0xf7,
+    0x56, 0xe6, 0x09, 0x68, 0x99, 0xb7, 0xb3, 0x26, 0xba, 0xaf, 0x74, 0x46, 0x9f, 0x0b, 0xe6, 0xe8,
+    0xef, 0x3f, 0x02, 0x9e, 0x23, 0x01, 0xef, 0x19, 0x87, 0xd2, 0x1f, 0x3d, 0x16, 0xbc, 0x29, 0x33,
+    0x4a, 0x2c, 0x4f, 0xdb, 0x5b, 0xe2, 0xec, 0x92, 0x19, 0x7f, 0x70, 0x6b, 0x5f, 0xf1, 0x30, 0xea,
+    0x51, 0x0f, 0xb1, 0x01, 0x92, 0x3b, 0xb6, 0xc5, 0x17, 0x2b, 0x46, 0x28, 0x3d, 0xfd, 0xf8, 0xc6,
+    0x01, 0x81, 0x3c, 0x97, 0x25, 0x5f, 0x7f, 0x93, 0xd7, 0xb8, 0xe7, 0x06, 0xf6, 0x75, 0x9b, 0x21,
+    0x13, 0xd9, 0xdb, 0xd8, 0x69, 0x20, 0x38, 0x0e, 0xb2, 0x25, 0x98, 0xcf, 0x77, 0xe0, 0x1e, 0x3c,
+    0xfb, 0x62, 0xb4, 0x61, 0x4f, 0xdc, 0xde, 0x86, 0xef, 0x5b, 0x32, 0x8d, 0xc9, 0x93, 0x95, 0x13,
+    0x0d, 0x9c, 0xf9, 0x05, 0x8e, 0x11, 0xed, 0x5f, 0x22, 0xcf, 0xc8, 0x7b, 0x6d, 0xb9, 0xe9, 0x79,
+    0xeb, 0x0f, 0x7c, 0xb6, 0x47, 0xc4, 0xce, 0xa2, 0x44, 0xfa, 0x0b, 0x07, 0x69, 0xe2, 0x5b, 0xc9,
+    0xa9, 0xe5, 0xbf, 0x7b, 0x02, 0xa6, 0xab, 0x3c, 0xae, 0xa4, 0xd9, 0x99, 0x3d, 0x29, 0x72, 0xa9,
+    0x1e, 0x38, 0x18, 0x3c, 0xfe, 0x65, 0xdc, 0x0a, 0xd7, 0x37, 0x63, 0x7c, 0x8a, 0xf4, 0x3d, 0xd3,
+    0x69, 0xd6, 0xe7, 0xf1, 0x64, 0x22, 0xe8, 0x4a, 0x55, 0xa6, 0x5b, 0x16, 0xef, 0xcf, 0x7f, 0x59,
+    0x9f, 0xbf, 0x3a, 0x82, 0xd3, 0x21, 0xe4, 0xac, 0x2b, 0x62, 0x6f, 0xf4, 0xcf, 0x5f, 0x61, 0xb0,
+    0x68, 0xce, 0x72, 0x25, 0xae, 0xf3, 0xa5, 0xcb, 0x60, 0xf2, 0xc1, 0x10, 0x5f, 0x58, 0x82, 0xff,
+    0xf6, 0x32, 0xc7, 0x58, 0x9c, 0xd1, 0xb5, 0xa2, 0x1f, 0x9b, 0x24, 0xc8, 0xce, 0x9e, 0x6b, 0x30,
+    0x52, 0x8e, 0x72, 0xca, 0x1f, 0x06, 0x76, 0x65, 0xa2, 0x17, 0x52, 0x7e, 0xbe, 0x89, 0xb9, 0x60,
+    0x26, 0x62, 0x49, 0xfe, 0xaf, 0xa6, 0xf7, 0xf3, 0xa2, 0xf7, 0x52, 0xfd, 0xd9, 0x0c, 0xb3, 0x8f,
+    0xa5, 0xfc, 0x4f, 0xb3, 0xfb, 0xf7, 0xd7, 0x39, 0xb6, 0x63, 0xb0, 0xfe, 0xfa, 0x8f, 0xa6, 0xa6,
+    0xd5, 0xe1, 0x7f, 0x94, 0xf3, 0x68, 0x6e, 0x92, 0xb0, 0x45, 0xc6, 0x99, 0x46, 0xbe, 0x21, 0xe6,
+    0x49, 0x9f, 0xab, 0xdd, 0x71, 0x1f, 0xc9, 0x1a, 0x1b, 0x0c, 0xb6, 0xa4, 0x02, 0x3a, 0x7e, 0x06,
+    0x1f, 0xe8, 0xc7, 0x43, 0x19, 0x30, 0x03, 0x66, 0x6f, 0x26, 0xfd, 0xf4, 0x0e, 0xdf, 0x9b, 0x10,
+    0xad, 0x80, 0x7b, 0xe4, 0xa1, 0xbc, 0x03, 0x07, 0x7b, 0x3b, 0xd2, 0x3d, 0x08, 0xce, 0xf1, 0x34,
+    0x03, 0x2f, 0x10, 0x11, 0x25, 0xdb, 0xe9, 0x1a, 0x90, 0x39, 0x61, 0xca, 0x85, 0x7c, 0xef, 0xa8,
+    0x2f, 0xbe, 0xcc, 0x56, 0x70, 0x1f, 0xcf, 0xf0, 0x65, 0x7c, 0xa6, 0x40, 0x8a, 0xa9, 0x88, 0x21,
+    0x02, 0xf2, 0x0e, 0x9f, 0x08, 0x2a, 0x4e, 0xf0, 0x39, 0xe9, 0xdc, 0xd8, 0x0f, 0xd2, 0x08, 0x77,
+    0x4f, 0x1b, 0x4c, 0x7f, 0x2f, 0xc4, 0x66, 0xec, 0xf3, 0x7b, 0x5e, 0x63, 0x3f, 0x1b, 0x50, 0x69,
+    0x69, 0xf2, 0xeb, 0x56, 0x15, 0x29, 0x77, 0x9e, 0xa2, 0x05, 0x1d, 0xe4, 0x14, 0x35, 0x78, 0x8e,
+    0xc1, 0xed, 0x54, 0x35, 0xb8, 0x8a, 0xc1, 0xef, 0x54, 0x35, 0xd8, 0x8a, 0x41, 0xee, 0x94, 0x1a,
+    0xd8, 0x8a, 0x81, 0xee, 0x94, 0x9a, 0x59, 0x95, 0x01, 0xf7, 0x94, 0x1a, 0x58, 0x85, 0xc1, 0xd7,
+    0x94, 0x32, 0x8c, 0x4d, 0x18, 0x50, 0x27, 0x1c, 0x96, 0xcb, 0x69, 0xb9, 0x98, 0xb6, 0xab, 0xf9,
+    0xf0, 0xe2, 0x90, 0xb9, 0x94, 0x0f, 0x6c, 0x1e, 0x86, 0x4d, 0x7b, 0x9d, 0x2d, 0x63, 0xea, 0x95,
+    0x62, 0x10, 0x9d, 0x0d, 0xc4, 0x08, 0xe2, 0xfc, 0xb4, 0x14, 0xf1, 0xbf, 0x52, 0xae, 0xfe, 0x8e,
+    0xfd, 0x1a, 0x77, 0x7b, 0x18, 0x2e, 0x18, 0xb3, 0x79, 0x98, 0x47, 0x1a, 0xef, 0xd8, 0x44, 0xa4,
+    0xcd, 0x1d, 0xbf, 0xeb, 0xe8, 0x8c, 0xf7, 0xf3, 0x99, 0x74, 0xed, 0x28, 0xd9, 0xc3, 0x4b, 0x19,
+    0xd7, 0x16, 0xfd, 0x17, 0x45, 0x4d, 0x6c, 0x8f, 0xd4, 0xb9, 0xdd, 0x97, 0x64, 0x26, 0xec, 0x33,
+    0xa2, 0xbd, 0x41, 0xc2, 0x73, 0x34, 0xfa, 0x38, 0x59, 0x4e, 0xb6, 0x4d, 0xe5, 0xc4, 0x03, 0x42,
+    0xf5, 0x0f, 0x78, 0xc8, 0x1a, 0xe4, 0x46, 0x89, 0x7a, 0xd0, 0xf3, 0x8c, 0x43, 0xc9, 0xea, 0x17,
+    0xbe, 0xeb, 0x29, 0x1e, 0x67, 0x6d, 0xd4, 0x7c, 0xef, 0x7a, 0xcb, 0x49, 0xfe, 0x1b, 0x8b, 0xd7,
+    0xfd, 0x1f, 0x78, 0xa7, 0x9e, 0x75, 0xe9, 0xdf, 0xf0, 0x25, 0x58, 0x70, 0xeb, 0xa2, 0x9e, 0x64,
+    0xf2, 0x96, 0x1a, 0xbf, 0xd9, 0x9a, 0xdd, 0x82, 0xc7, 0xb9, 0xb3, 0xeb, 0xdc, 0x68, 0x79, 0xc6,
+    0xee, 0x97, 0xdf, 0xc9, 0x38, 0xf1, 0xbb, 0x61, 0x72, 0x80, 0xf7, 0xdf, 0x9c, 0xcf, 0x40, 0x9c,
+    0xf1, 0x17, 0xcb, 0xa7, 0xcd, 0x0a, 0xdd, 0xf0, 0x2b, 0x2c, 0xf4, 0x61, 0x7e, 0xf0, 0xfb, 0xb4,
+    0xb0, 0xe8, 0x95, 0xbe, 0xae, 0xc7, 0x47, 0xe0, 0xfe, 0xe9, 0x83, 0xd3, 0xe5, 0xe9, 0xea, 0xa2,
+    0x01, 0x11, 0x73, 0xf6, 0xbd, 0x4b, 0xbf, 0xce, 0xf3, 0x1a, 0x3f, 0xe6, 0xf0, 0x7b, 0x2b, 0xb9,
+    0x7f, 0x6e, 0x7f, 0x1b, 0xea, 0x09, 0x82, 0x36, 0xb3, 0xb2, 0x9f, 0xdd, 0x3e, 0x39, 0x5e, 0xca,
+    0x90, 0xe5, 0xbe, 0xeb, 0xf8, 0xa4, 0x97, 0x95, 0x39, 0x03, 0x73, 0x3d, 0xbb, 0x7f, 0x98, 0x87,
+    0x89, 0x21, 0x4d, 0x9f, 0x54, 0xd2, 0xe3, 0x2e, 0x38, 0x72, 0x90, 0xe0, 0x6b, 0x2f, 0xb8, 0xf7,
+    0x2e, 0x67, 0xe5, 0x5b, 0xf7, 0x31, 0xa4, 0xaf, 0xb5, 0xe5, 0xcb, 0x5c, 0x1d, 0x3d, 0x35, 0xc7,
+    0x14, 0x75, 0x2d, 0x75, 0xd7, 0x0e, 0xe8, 0x9e, 0xff, 0x0b, 0xdf, 0xb6, 0x87, 0xe7, 0xf8, 0x66,
+    0xdf, 0x0e, 0xce, 0xdb, 0xbb, 0x1b, 0xf0, 0x60, 0x42, 0x2a, 0xff, 0x98, 0xee, 0xea, 0x17, 0xba,
+    0xb3, 0x7f, 0x97, 0xed, 0x2e, 0x5d, 0x18, 0xd7, 0x5c, 0xe6, 0x18, 0xbb, 0x93, 0xe2, 0xe8, 0xea,
+    0x1d, 0xb6, 0x7b, 0xe0, 0x6e, 0x88, 0x92, 0x39, 0x9e, 0xf1, 0xd0, 0xc9, 0x73, 0x95, 0x26, 0xd7,
+    0x73, 0x3f, 0x47, 0xc9, 0x2a, 0xce, 0xbd, 0x1e, 0xa3, 0x09, 0x6e, 0x80, 0x7a, 0xac, 0x4f, 0xe2,
+    0xe7, 0xfd, 0xe1, 0xda, 0x4e, 0x07, 0xb7, 0x4e, 0xcc, 0x7b, 0xde, 0x56, 0x17, 0x22, 0xb7, 0x5f,
+    0x91, 0x6c, 0xf8, 0xa8, 0x3d, 0x9f, 0xc4, 0x36, 0x03, 0xbf, 0xa9, 0x6b, 0x64, 0xcd, 0xcb, 0x3f,
+    0x7c, 0xfa, 0x62, 0xca, 0x2a, 0xc2, 0x2a, 0xb8, 0x76, 0x98, 0x27, 0xc5, 0x96, 0xf4, 0xda, 0x8e,
+    0x7a, 0x90, 0xbb, 0x9c, 0x7b, 0x37, 0xfe, 0x72, 0x83, 0xc1, 0xd9, 0xf5, 0xfd, 0x96, 0x68, 0x06,
+    0x98, 0x03, 0x83, 0x1d, 0xff, 0xb9, 0xfb, 0x02, 0x94, 0xb0, 0xa6, 0xaa, 0x65, 0x3f, 0x40, 0x47,
+    0x53, 0xf6, 0x05, 0x3d, 0x76, 0x83, 0x4d, 0x29, 0x8b, 0x74, 0xd7, 0x1a, 0x9a, 0x6d, 0xcd, 0xbf,
+    0x6e, 0x99, 0xcb, 0xe6, 0x2e, 0xd9, 0x83, 0x73, 0xa4, 0x40, 0x36, 0x60, 0xfb, 0xdd, 0xdc, 0xf9,
+    0xff, 0x68, 0x71, 0xa8, 0x92, 0x2e, 0xf3, 0x9e, 0xf7, 0x57, 0x1f, 0x3c, 0xd2, 0x20, 0x84, 0x9f,
+    0xea, 0x84, 0xf2, 0x51, 0xe9, 0x6e, 0xcd, 0xcb, 0xb4, 0xf9, 0x98, 0x40, 0xe3, 0xff, 0xdf, 0xee,
+    0x71, 0x1c, 0xf6, 0x4e, 0xe3, 0xbb, 0x30, 0x82, 0x7c, 0xa1, 0x12, 0x5e, 0x8b, 0xf6, 0x4d, 0x77,
+    0xd7, 0x71, 0xd1, 0x21, 0x32, 0x17, 0x69, 0xe9, 0x89, 0x40, 0xa3, 0xc9, 0x3f, 0xb7, 0xa8, 0x38,
+    0xf3, 0x81, 0xc8, 0xc4, 0xb2, 0x86, 0xc8, 0xc3, 0x0b, 0xd6, 0x97, 0xab, 0x07, 0xc8, 0x29, 0x27,
+    0xb8, 0x7c, 0x9d, 0x34, 0x52, 0x25, 0xdd, 0x63, 0xd0, 0x9f, 0xd8, 0xe3, 0xde, 0x6d, 0x5c, 0x37,
+    0xd5, 0x0f, 0xa5, 0x39, 0x00, 0xad, 0x25, 0x17, 0xf4, 0x85, 0x8b, 0xe8, 0x86, 0x01, 0x55, 0x4a,
+    0xd2, 0xf0, 0x87, 0xf7, 0x13, 0x4b, 0xe7, 0xc9, 0x48, 0x30, 0x04, 0xf0, 0x85, 0x81, 0xbc, 0xde,
+    0x50, 0x65, 0x99, 0xdd, 0xe4, 0xfa, 0xa9, 0x5f, 0xf7, 0xe7, 0xdf, 0x72, 0xab, 0x02, 0x35, 0x65,
+    0xea, 0xbc, 0x8e, 0x9f, 0xaf, 0xb7, 0x8d, 0xfb, 0xbb, 0xcc, 0xc5, 0xc0, 0xda, 0x89, 0x3d, 0x95,
+    0x8b, 0x5d, 0xde, 0x71, 0x78, 0xb4, 0x8c, 0x2c, 0xf9, 0xc4, 0xec, 0x59, 0xef, 0xfc, 0xcb, 0x02,
+    0xc2, 0xfb, 0xc0, 0xbc, 0x69, 0x59, 0xc8, 0xa5, 0xbe, 0xaf, 0x5e, 0x6b, 0x25, 0xfb, 0xc0, 0xd3,
+    0x15, 0x8f, 0xa9, 0xce, 0x1a, 0x28, 0x9a, 0xcd, 0x86, 0x7c, 0xbe, 0xf5, 0x4a, 0x79, 0xe7, 0x97,
+    0x11, 0x5c, 0xdc, 0x9c, 0xe2, 0xe5, 0x4e, 0xcd, 0xe2, 0x18, 0x79, 0x72, 0xc1, 0xd6, 0x1a, 0xc0,
+    0x9b, 0xd2, 0x1a, 0xe9, 0x02, 0x21, 0xa7, 0x75, 0xfd, 0xd5, 0xd2, 0x84, 0x07, 0xd4, 0xc8, 0xc6,
+    0x78, 0xda, 0x4f, 0x74, 0x43, 0x97, 0xbf, 0x01, 0x33, 0xae, 0xe2, 0x67, 0x79, 0xd6, 0x98, 0xee,
+    0xaf, 0x01, 0x8e, 0x95, 0x1a, 0xba, 0x09, 0x9c, 0xba, 0x50, 0xa7, 0x35, 0x27, 0x1f, 0x8e, 0x1e,
+    0xd1, 0x4d, 0xda, 0x8a, 0x12, 0x58, 0x3f, 0x65, 0x7a, 0x8e, 0xc1, 0xcd, 0xf3, 0x9b, 0xdf, 0x32,
+    0x7c, 0x94, 0xfd, 0xfb, 0xad, 0x45, 0xe0, 0x2a, 0xae, 0x80, 0xcd, 0xa3, 0xbc, 0xec, 0x6d, 0x93,
+    0x45, 0x84, 0xde, 0xb5, 0x05, 0x8d, 0x1f, 0x65, 0xaf, 0x6c, 0x5d, 0x58, 0x07, 0xd1, 0x98, 0x85,
+    0x1e, 0xda, 0x12, 0x66, 0x6f, 0xbe, 0x21, 0xe5, 0xe1, 0x34, 0x96, 0xa8, 0xf9, 0x07, 0x18, 0x19,
+    0xf2, 0x8f, 0x7b, 0x0c, 0x97, 0x2d, 0xbe, 0xdb, 0x77, 0x99, 0xff, 0xad, 0xc4, 0x7b, 0x4b, 0x45,
+    0x8f, 0x87, 0x4f, 0x41, 0xeb, 0x79, 0x0f, 0xf2, 0xe6, 0x1c, 0xab, 0x90, 0xbd, 0x5c, 0x95, 0x47,
+    0xe3, 0x66, 0xe8, 0x23, 0x85, 0xfc, 0x19, 0xd6, 0xce, 0x46, 0x39, 0x24, 0x4d, 0xbb, 0x49, 0xfe,
+    0xdd, 0x7a, 0xcf, 0x73, 0x6d, 0x87, 0xcd, 0x67, 0xcb, 0xa1, 0xeb, 0xa8, 0x79, 0xdf, 0x5b, 0xbf,
+    0x7e, 0x22, 0x1d, 0xf2, 0x21, 0x22, 0x26, 0x90, 0x6d, 0x46, 0x4e, 0x2c, 0x48, 0xa7, 0xa9, 0xbc,
+    0x9f, 0x04, 0x46, 0x76, 0xa8, 0x8d, 0x2c, 0x1b, 0x08, 0xdd, 0x63, 0x75, 0x33, 0x75, 0xc3, 0x15,
+    0xbd, 0xb6, 0x39, 0x39, 0x25, 0x52, 0x53, 0xa5, 0xac, 0xa6, 0xa5, 0x52, 0x41, 0x01, 0x57, 0xb1,
+    0xd1, 0xb4, 0xf5, 0x27, 0x5e, 0x39, 0x03, 0x60, 0x3f, 0xf0, 0xa1, 0x15, 0x8f, 0x46, 0xdb, 0x20,
+    0x53, 0xf6, 0x72, 0x0d, 0x0b, 0xd3, 0x64, 0xce, 0x54, 0x5c, 0xf5, 0xf8, 0xb1, 0x0d, 0xef, 0xa5,
+    0x74, 0x4d, 0xbb, 0x73, 0xfe, 0x2c, 0x2a, 0x4b, 0x2c, 0xc7, 0x2d, 0xfd, 0x13, 0xee, 0xb2, 0xba,
+    0xc8, 0xd1, 0xf1, 0x26, 0x24, 0x8e, 0xb4, 0xf9, 0xc3, 0x3b, 0x4e, 0x84, 0xad, 0x1d, 0xf8, 0x53,
+    0xa9, 0x7c, 0x90, 0xee, 0x0e, 0xe0, 0x9c, 0xd0, 0x32, 0xaf, 0xeb, 0xe6, 0xaa, 0xc6, 0xc1, 0x3f,
+    0xba, 0x6b, 0xfb, 0x83, 0xee, 0x3d, 0x21, 0x40, 0x47, 0xe9, 0x88, 0xed, 0x50, 0x05, 0x80, 0x71,
+    0x64, 0x2f, 0x17, 0xe3, 0x36, 0xf7, 0xb5, 0xf5, 0xdf, 0x2b, 0xbe, 0x5d, 0x1a, 0x66, 0x1f, 0x17,
+    0x9e, 0x9b, 0x1e, 0xd8, 0xb9, 0x5e, 0x63, 0x18, 0x35, 0x7c, 0x19, 0x61, 0xd8, 0x15, 0x93, 0x30,
+    0x8b, 0x57, 0x61, 0xc8, 0xa2, 0x52, 0x0f, 0x26, 0xcf, 0x3b, 0x89, 0x32, 0x48, 0xa0, 0xa1, 0xd9,
+    0x13, 0x65, 0xd6, 0xed, 0xa3, 0xab, 0xce, 0x40, 0xc1, 0xf0, 0x3c, 0x5a, 0xf6, 0x1a, 0x77, 0x1b,
+    0xa7, 0x7c, 0xa1, 0x16, 0x68, 0xe3, 0xea, 0x8b, 0x32, 0x19, 0xb3, 0x1e, 0xbd, 0x50, 0xb2, 0x79,
+    0x74, 0xe2, 0x64, 0x57, 0x1f, 0x14, 0x7d, 0x87, 0xd8, 0xd3, 0x38, 0x18, 0x95, 0x3b, 0xa4, 0x26,
+    0x91, 0xa9, 0xdc, 0x85, 0xe3, 0x12, 0x47, 0xf9, 0x53, 0x16, 0xa1, 0xaa, 0xa7, 0x25, 0x67, 0xd6,
+    0x3c, 0x5a, 0x0a, 0xbe, 0xec, 0xb4, 0x33, 0xe7, 0x8f, 0xf7, 0x36, 0x01, 0x8b, 0xc4, 0x8d, 0xcf,
+    0x4b, 0x07, 0x23, 0x91, 0x9d, 0x58, 0x72, 0xb8, 0x45, 0x9c, 0x04, 0x7f, 0x94, 0xb9, 0xdf, 0xb9,
+    0x5d, 0xcd, 0x55, 0x55, 0x38, 0xc4, 0x69, 0x8a, 0x52, 0xb0, 0x1c, 0x34, 0x12, 0xb6, 0x6b, 0xb0,
+    0xb2, 0x73, 0xf8, 0x9f, 0x86, 0x71, 0xf4, 0xf5, 0x18, 0xfe, 0x23, 0xab, 0x80, 0xe5, 0xcd, 0xf7,
+    0x01, 0xd4, 0x42, 0x40, 0xfe, 0x10, 0xba, 0xe7, 0x82, 0xf1, 0x6d, 0xc4, 0x13, 0xdc, 0x4a, 0x17,
+    0x20, 0x82, 0xcf, 0x8d, 0x3a, 0x7f, 0x88, 0xd5, 0xf3, 0xc5, 0xea, 0x9c, 0xaa, 0x6b, 0xed, 0x55,
+    0xec, 0xaf, 0x77, 0x54, 0xc5, 0x0b, 0x6a, 0x4a, 0x6a, 0xae, 0x34, 0xac, 0x97, 0x0d, 0x45, 0x6e,
+    0xef, 0xc0, 0x4f, 0xbb, 0x8e, 0x7b, 0x3a, 0xdc, 0xf5, 0x1d, 0x9e, 0xde, 0xce, 0xa9, 0x56, 0x91,
+    0xc0, 0xa9, 0x2c, 0x29, 0x28, 0xd9, 0x82, 0x5f, 0x08, 0x6e, 0xf1, 0x1c, 0x2f, 0xde, 0x16, 0x16,
+    0x18, 0xae, 0xc8, 0x6a, 0xd1, 0xc5, 0x13, 0xe7, 0x09, 0x59, 0x6d, 0xfe, 0xa8, 0x1e, 0x46, 0x63,
+    0xb4, 0x66, 0xe9, 0x85, 0x4b, 0x29, 0xc2, 0x99, 0xcb, 0xb9, 0x39, 0x90, 0x7c, 0xa0, 0x13, 0x6e,
+    0x18, 0x37, 0x88, 0x9c, 0xb8, 0x63, 0xe4, 0xf1, 0x8b, 0xb1, 0x05, 0x7c, 0x2f, 0x03, 0xdf, 0x30,
+    0x3e, 0xae, 0x47, 0xbf, 0x05, 0xea, 0x08, 0x3e, 0xef, 0x7b, 0xec, 0x28, 0xcc, 0xfc, 0xa9, 0x6c,
+    0xac, 0x3f, 0xe0, 0xbf, 0xfd, 0x1b, 0xbd, 0x7a, 0x6f, 0x7b, 0x89, 0xe3, 0x96, 0xb7, 0x51, 0xbd,
+    0x72, 0x8d, 0x97, 0x6d, 0x8a, 0x75, 0x67, 0xba, 0xd1, 0xd3, 0xbb, 0xe9, 0xa1, 0x27, 0x4a, 0xb4,
+    0x21, 0x9f, 0x9f, 0xa6, 0x82, 0x7c, 0x07, 0x24, 0xc7, 0x4c, 0x3e, 0xce, 0x8b, 0xdf, 0xf8, 0x59,
+    0xe0, 0x22, 0x52, 0xa2, 0x11, 0xb3, 0x23, 0xf7, 0x1d, 0x34, 0xaf, 0xc0, 0xab, 0x0e, 0xf4, 0x73,
+    0xe2, 0x52, 0x96, 0x02, 0xea, 0x74, 0x6a, 0x64, 0x05, 0xe3, 0x69, 0xa1, 0xc1, 0x7c, 0x45, 0xba,
+    0x52, 0x1b, 0x31, 0xd6, 0x5d, 0x77, 0xd3, 0x32, 0x08, 0x88, 0xd0, 0x07, 0x80, 0x32, 0x94, 0xe1,
+    0xb8, 0x37, 0x45, 0x92, 0xde, 0x08, 0xd5, 0x79, 0xff, 0x52, 0x02, 0x20, 0xcb, 0xd0, 0x2e, 0xb4,
+    0x57, 0x89, 0x48, 0x63, 0x77, 0x45, 0x9b, 0x98, 0xe1, 0xd1, 0xba, 0xde, 0x87, 0xb4, 0x7c, 0xce,
+    0x07, 0x38, 0x22, 0x8c, 0xc7, 0x3c, 0xc9, 0x75, 0xc8, 0x0b, 0xd0, 0x4d, 0x96, 0x13, 0x94, 0x2c,
+    0x7d, 0x90, 0xce, 0x7f, 0x01, 0xd9, 0xff, 0x3f, 0xc9, 0x14, 0xfd, 0x6f, 0x01, 0x22, 0xab, 0x72,
+    0x88, 0x19, 0x3a, 0xba, 0x7a, 0xa0, 0x87, 0xa2, 0xef, 0x13, 0xa8, 0xb0, 0xc4, 0xf3, 0xff, 0x70,
+    0x1b, 0x7b, 0x6b, 0xda, 0xe1, 0x01, 0x73, 0x74, 0x4c, 0xd8, 0x81, 0xe6, 0x42, 0x5a, 0x57, 0xe3,
+    0x05, 0xb6, 0x7e, 0xdc, 0xc1, 0x19, 0xdb, 0x75, 0x1b, 0x7e, 0x30, 0x47, 0xc8, 0xa6, 0x2f, 0x89,
+    0x7f, 0xfb, 0xcf, 0x84, 0x52, 0x4f, 0xdc, 0xb0, 0xe3, 0x99, 0x37, 0x72, 0x04, 0xec, 0x0f,
 };
+const ShaderModule Blob078 = { Blob078_Data, 4975u, 4812u, 78u };
 
 } // namespace detail
 } // namespace VulkanShaders
@@ -28,13 +28,12 @@
     Pipeline indices match ComputeRenderer3D::ShaderCompileStep() in
     src/GPU3D_Compute.cpp one for one.
 
-    The SPIR-V words live in per-stage translation units rather than in the
-    header so that including the public header stays cheap: the full module set
-    is a few megabytes of integer literals and would otherwise be re-parsed by
-    every consumer.
+    Every module is one zstd frame, inflated on first use by
+    Vk::InflateShaderModule(). The frames live in per-stage translation units
+    rather than in the header so that including the public header stays cheap.
 */
 
-// SPIR-V for src/GPU3D_Vulkan_shaders/CalculateWorkOffsets.comp.
+// SPIR-V for src/GPU3D_Vulkan_shaders/CalculateWorkOffsets.comp, one zstd frame per module.
 
 #include "GPU3D_Vulkan_ShaderBlobs.h"
 
@@ -45,412 +44,278 @@ namespace VulkanShaders
 namespace detail
 {
 
-extern const uint32_t Blob023[1045];
-const uint32_t Blob023[1045] = {
-    0x07230203, 0x00010300, 0x0008000b, 0x00000070, 0x00000000, 0x00020011, 0x00000001, 0x0006000b,
-    0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001,
-    0x0006000f, 0x00000005, 0x00000004, 0x6e69616d, 0x00000000, 0x00000009, 0x00060010, 0x00000004,
-    0x00000011, 0x00000020, 0x00000001, 0x00000001, 0x00030003, 0x00000002, 0x000001c2, 0x000a0004,
-    0x475f4c47, 0x4c474f4f, 0x70635f45, 0x74735f70, 0x5f656c79, 0x656e696c, 0x7269645f, 0x69746365,
-    0x00006576, 0x00080004, 0x475f4c47, 0x4c474f4f, 0x6e695f45, 0x64756c63, 0x69645f65, 0x74636572,
-    0x00657669, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000, 0x00080005, 0x00000009, 0x475f6c67,
-    0x61626f6c, 0x766e496c, 0x7461636f, 0x496e6f69, 0x00000044, 0x00050005, 0x00000014, 0x6174654d,
-    0x66696e55, 0x006d726f, 0x00060006, 0x00000014, 0x00000000, 0x506d754e, 0x67796c6f, 0x00736e6f,
-    0x00060006, 0x00000014, 0x00000001, 0x566d754e, 0x61697261, 0x0073746e, 0x00060006, 0x00000014,
-    0x00000002, 0x68706c41, 0x66655261, 0x00000000, 0x00050006, 0x00000014, 0x00000003, 0x70736944,
-    0x00746e43, 0x00060006, 0x00000014, 0x00000004, 0x6e6f6f54, 0x6c626154, 0x00000065, 0x00060006,
-    0x00000014, 0x00000005, 0x61656c43, 0x6c6f4372, 0x0000726f, 0x00060006, 0x00000014, 0x00000006,
-    0x61656c43, 0x70654472, 0x00006874, 0x00060006, 0x00000014, 0x00000007, 0x61656c43, 0x74744172,
-    0x00000072, 0x00060006, 0x00000014, 0x00000008, 0x4f676f46, 0x65736666, 0x00000074, 0x00060006,
-    0x00000014, 0x00000009, 0x53676f46, 0x74666968, 0x00000000, 0x00060006, 0x00000014, 0x0000000a,
-    0x43676f46, 0x726f6c6f, 0x00000000, 0x00080006, 0x00000014, 0x0000000b, 0x61656c43, 0x74694272,
-    0x4f70616d, 0x65736666, 0x00000074, 0x00030005, 0x00000016, 0x00000000, 0x00060005, 0x00000029,
-    0x526e6942, 0x6c757365, 0x66754274, 0x00726566, 0x00080006, 0x00000029, 0x00000000, 0x69726156,
-    0x57746e61, 0x436b726f, 0x746e756f, 0x00000000, 0x00080006, 0x00000029, 0x00000001, 0x74726f53,
-    0x6f576465, 0x664f6b72, 0x74657366, 0x00000000, 0x00090006, 0x00000029, 0x00000002, 0x69726156,
-    0x57746e61, 0x526b726f, 0x436c6165, 0x746e756f, 0x00000000, 0x00080006, 0x00000029, 0x00000003,
-    0x74726f53, 0x6b726f57, 0x6b726f57, 0x6e756f43, 0x00000074, 0x00090006, 0x00000029, 0x00000004,
-    0x6e6e6942, 0x4d676e69, 0x416b7361, 0x664f646e, 0x74657366, 0x00000000, 0x00030005, 0x0000002b,
-    0x00000000, 0x00050005, 0x00000045, 0x6c616572, 0x6e756f43, 0x00000074, 0x00050005, 0x0000005c,
-    0x65726353, 0x69576e65, 0x00687464, 0x00060005, 0x0000005d, 0x65726353, 0x65486e65, 0x74686769,
-    0x00000000, 0x00060005, 0x0000005e, 0x5778614d, 0x546b726f, 0x73656c69, 0x00000000, 0x00070005,
-    0x00000062, 0x6d617246, 0x66756265, 0x53726566, 0x64697274, 0x00000065, 0x00060005, 0x00000063,
-    0x656c6954, 0x72655073, 0x656e694c, 0x00000000, 0x00050005, 0x00000064, 0x656c6954, 0x656e694c,
-    0x00000073, 0x00060005, 0x00000066, 0x68737550, 0x736e6f43, 0x746e6174, 0x00000073, 0x00060006,
-    0x00000066, 0x00000000, 0x56727543, 0x61697261, 0x0000746e, 0x00060006, 0x00000066, 0x00000001,
-    0x57786554, 0x68746469, 0x00000000, 0x00060006, 0x00000066, 0x00000002, 0x48786554, 0x68676965,
-    0x00000074, 0x00060006, 0x00000066, 0x00000003, 0x57786554, 0x53706172, 0x00000000, 0x00060006,
-    0x00000066, 0x00000004, 0x57786554, 0x54706172, 0x00000000, 0x00070006, 0x00000066, 0x00000005,
-    0x49786554, 0x70614373, 0x65727574, 0x00000000, 0x00070006, 0x00000066, 0x00000006, 0x74706143,
-    0x59657275, 0x7366664f, 0x00007465, 0x00050006, 0x00000066, 0x00000007, 0x6461705f, 0x00000000,
-    0x00030005, 0x00000068, 0x00006370, 0x00070005, 0x0000006b, 0x6e6e6942, 0x4d676e69, 0x536b7361,
-    0x74726174, 0x00000000, 0x00080005, 0x0000006e, 0x6e6e6942, 0x57676e69, 0x4f6b726f, 0x65736666,
-    0x74537374, 0x00747261, 0x00040047, 0x00000009, 0x0000000b, 0x0000001c, 0x00040047, 0x00000011,
-    0x00000006, 0x00000010, 0x00050048, 0x00000014, 0x00000000, 0x00000023, 0x00000000, 0x00050048,
-    0x00000014, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x00000014, 0x00000002, 0x00000023,
-    0x00000008, 0x00050048, 0x00000014, 0x00000003, 0x00000023, 0x0000000c, 0x00050048, 0x00000014,
-    0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x00000014, 0x00000005, 0x00000023, 0x00000230,
-    0x00050048, 0x00000014, 0x00000006, 0x00000023, 0x00000234, 0x00050048, 0x00000014, 0x00000007,
-    0x00000023, 0x00000238, 0x00050048, 0x00000014, 0x00000008, 0x00000023, 0x0000023c, 0x00050048,
-    0x00000014, 0x00000009, 0x00000023, 0x00000240, 0x00050048, 0x00000014, 0x0000000a, 0x00000023,
-    0x00000244, 0x00050048, 0x00000014, 0x0000000b, 0x00000023, 0x00000248, 0x00030047, 0x00000014,
-    0x00000002, 0x00040047, 0x00000016, 0x00000022, 0x00000000, 0x00040047, 0x00000016, 0x00000021,
-    0x00000000, 0x00040047, 0x00000025, 0x00000006, 0x00000010, 0x00040047, 0x00000026, 0x00000006,
-    0x00000004, 0x00040047, 0x00000027, 0x00000006, 0x00000004, 0x00040047, 0x00000028, 0x00000006,
-    0x00000004, 0x00050048, 0x00000029, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000029,
-    0x00000001, 0x00000023, 0x00008000, 0x00050048, 0x00000029, 0x00000002, 0x00000023, 0x0000a000,
-    0x00050048, 0x00000029, 0x00000003, 0x00000023, 0x0000c000, 0x00050048, 0x00000029, 0x00000004,
-    0x00000023, 0x0000c010, 0x00030047, 0x00000029, 0x00000002, 0x00040047, 0x0000002b, 0x00000022,
-    0x00000000, 0x00040047, 0x0000002b, 0x00000021, 0x00000008, 0x00040047, 0x0000005c, 0x00000001,
-    0x00000000, 0x00040047, 0x0000005d, 0x00000001, 0x00000001, 0x00040047, 0x0000005e, 0x00000001,
-    0x00000002, 0x00050048, 0x00000066, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000066,
-    0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x00000066, 0x00000002, 0x00000023, 0x00000008,
-    0x00050048, 0x00000066, 0x00000003, 0x00000023, 0x0000000c, 0x00050048, 0x00000066, 0x00000004,
-    0x00000023, 0x00000010, 0x00050048, 0x00000066, 0x00000005, 0x00000023, 0x00000014, 0x00050048,
-    0x00000066, 0x00000006, 0x00000023, 0x00000018, 0x00050048, 0x00000066, 0x00000007, 0x00000023,
-    0x0000001c, 0x00030047, 0x00000066, 0x00000002, 0x00040047, 0x0000006f, 0x0000000b, 0x00000019,
-    0x00020013, 0x00000002, 0x00030021, 0x00000003, 0x00000002, 0x00040015, 0x00000006, 0x00000020,
-    0x00000000, 0x00040017, 0x00000007, 0x00000006, 0x00000003, 0x00040020, 0x00000008, 0x00000001,
-    0x00000007, 0x0004003b, 0x00000008, 0x00000009, 0x00000001, 0x0004002b, 0x00000006, 0x0000000a,
-    0x00000000, 0x00040020, 0x0000000b, 0x00000001, 0x00000006, 0x00040015, 0x0000000e, 0x00000020,
-    0x00000001, 0x00040017, 0x0000000f, 0x00000006, 0x00000004, 0x0004002b, 0x00000006, 0x00000010,
-    0x00000022, 0x0004001c, 0x00000011, 0x0000000f, 0x00000010, 0x00030016, 0x00000012, 0x00000020,
-    0x00040017, 0x00000013, 0x00000012, 0x00000002, 0x000e001e, 0x00000014, 0x00000006, 0x00000006,
-    0x0000000e, 0x00000006, 0x00000011, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000013, 0x00040020, 0x00000015, 0x00000002, 0x00000014, 0x0004003b, 0x00000015,
-    0x00000016, 0x00000002, 0x0004002b, 0x0000000e, 0x00000017, 0x00000001, 0x00040020, 0x00000018,
-    0x00000002, 0x00000006, 0x00020014, 0x0000001b, 0x0004002b, 0x00000006, 0x00000024, 0x00000800,
-    0x0004001c, 0x00000025, 0x0000000f, 0x00000024, 0x0004001c, 0x00000026, 0x00000006, 0x00000024,
-    0x0004001c, 0x00000027, 0x00000006, 0x00000024, 0x0003001d, 0x00000028, 0x00000006, 0x0007001e,
-    0x00000029, 0x00000025, 0x00000026, 0x00000027, 0x0000000f, 0x00000028, 0x00040020, 0x0000002a,
-    0x0000000c, 0x00000029, 0x0004003b, 0x0000002a, 0x0000002b, 0x0000000c, 0x0004002b, 0x0000000e,
-    0x0000002c, 0x00000003, 0x0004002b, 0x0000000e, 0x0000002d, 0x00000000, 0x0004002b, 0x00000006,
-    0x0000002e, 0x00000003, 0x00040020, 0x0000002f, 0x0000000c, 0x00000006, 0x0004002b, 0x00000006,
-    0x00000032, 0x0000001f, 0x0004002b, 0x00000006, 0x00000034, 0x00000020, 0x0004002b, 0x00000006,
-    0x00000036, 0x00000001, 0x00040020, 0x00000038, 0x0000000c, 0x0000000f, 0x0004002b, 0x00000006,
-    0x0000003f, 0x00000002, 0x00040020, 0x00000044, 0x00000007, 0x00000006, 0x0004002b, 0x0000000e,
-    0x0000004a, 0x00000002, 0x0004002b, 0x00000006, 0x00000052, 0x00008000, 0x00040032, 0x0000000e,
-    0x0000005c, 0x00000100, 0x00040032, 0x0000000e, 0x0000005d, 0x000000c0, 0x00040032, 0x0000000e,
-    0x0000005e, 0x00003000, 0x0004002b, 0x0000000e, 0x0000005f, 0x00000008, 0x0004002b, 0x0000000e,
-    0x00000060, 0x00000040, 0x0004002b, 0x0000000e, 0x00000061, 0x00000020, 0x00060034, 0x0000000e,
-    0x00000062, 0x00000084, 0x0000005c, 0x0000005d, 0x00060034, 0x0000000e, 0x00000063, 0x00000087,
-    0x0000005c, 0x0000005f, 0x00060034, 0x0000000e, 0x00000064, 0x00000087, 0x0000005d, 0x0000005f,
-    0x0004002b, 0x0000000e, 0x00000065, 0x00000800, 0x000a001e, 0x00000066, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x0000000e, 0x00000006, 0x00040020, 0x00000067,
-    0x00000009, 0x00000066, 0x0004003b, 0x00000067, 0x00000068, 0x00000009, 0x00060034, 0x0000000e,
-    0x00000069, 0x00000084, 0x00000063, 0x00000064, 0x00060034, 0x0000000e, 0x0000006a, 0x00000084,
-    0x00000069, 0x0000004a, 0x00060034, 0x0000000e, 0x0000006b, 0x00000080, 0x0000002d, 0x0000006a,
-    0x00060034, 0x0000000e, 0x0000006c, 0x00000084, 0x00000063, 0x00000064, 0x00060034, 0x0000000e,
-    0x0000006d, 0x00000084, 0x0000006c, 0x00000060, 0x00060034, 0x0000000e, 0x0000006e, 0x00000080,
-    0x0000006b, 0x0000006d, 0x0006002c, 0x00000007, 0x0000006f, 0x00000034, 0x00000036, 0x00000036,
-    0x00050036, 0x00000002, 0x00000004, 0x00000000, 0x00000003, 0x000200f8, 0x00000005, 0x0004003b,
-    0x00000044, 0x00000045, 0x00000007, 0x00050041, 0x0000000b, 0x0000000c, 0x00000009, 0x0000000a,
-    0x0004003d, 0x00000006, 0x0000000d, 0x0000000c, 0x00050041, 0x00000018, 0x00000019, 0x00000016,
-    0x00000017, 0x0004003d, 0x00000006, 0x0000001a, 0x00000019, 0x000500b0, 0x0000001b, 0x0000001c,
-    0x0000000d, 0x0000001a, 0x000300f7, 0x0000001e, 0x00000000, 0x000400fa, 0x0000001c, 0x0000001d,
-    0x0000001e, 0x000200f8, 0x0000001d, 0x00050041, 0x0000000b, 0x0000001f, 0x00000009, 0x0000000a,
-    0x0004003d, 0x00000006, 0x00000020, 0x0000001f, 0x000500aa, 0x0000001b, 0x00000021, 0x00000020,
-    0x0000000a, 0x000300f7, 0x00000023, 0x00000000, 0x000400fa, 0x00000021, 0x00000022, 0x00000023,
-    0x000200f8, 0x00000022, 0x00070041, 0x0000002f, 0x00000030, 0x0000002b, 0x0000002d, 0x0000002d,
-    0x0000002e, 0x0004003d, 0x00000006, 0x00000031, 0x00000030, 0x00050080, 0x00000006, 0x00000033,
-    0x00000031, 0x00000032, 0x00050086, 0x00000006, 0x00000035, 0x00000033, 0x00000034, 0x00070050,
-    0x0000000f, 0x00000037, 0x00000035, 0x00000036, 0x00000036, 0x0000000a, 0x00050041, 0x00000038,
-    0x00000039, 0x0000002b, 0x0000002c, 0x0003003e, 0x00000039, 0x00000037, 0x000200f9, 0x00000023,
-    0x000200f8, 0x00000023, 0x00050041, 0x0000000b, 0x0000003a, 0x00000009, 0x0000000a, 0x0004003d,
-    0x00000006, 0x0000003b, 0x0000003a, 0x00070041, 0x0000002f, 0x0000003c, 0x0000002b, 0x0000002d,
-    0x00000017, 0x0000002e, 0x00050041, 0x0000000b, 0x0000003d, 0x00000009, 0x0000000a, 0x0004003d,
-    0x00000006, 0x0000003e, 0x0000003d, 0x00070041, 0x0000002f, 0x00000040, 0x0000002b, 0x0000002d,
-    0x0000003e, 0x0000003f, 0x0004003d, 0x00000006, 0x00000041, 0x00000040, 0x000700ea, 0x00000006,
-    0x00000042, 0x0000003c, 0x00000036, 0x0000000a, 0x00000041, 0x00060041, 0x0000002f, 0x00000043,
-    0x0000002b, 0x00000017, 0x0000003b, 0x0003003e, 0x00000043, 0x00000042, 0x00050041, 0x0000000b,
-    0x00000046, 0x00000009, 0x0000000a, 0x0004003d, 0x00000006, 0x00000047, 0x00000046, 0x00070041,
-    0x0000002f, 0x00000048, 0x0000002b, 0x0000002d, 0x00000047, 0x0000003f, 0x0004003d, 0x00000006,
-    0x00000049, 0x00000048, 0x0003003e, 0x00000045, 0x00000049, 0x00050041, 0x0000000b, 0x0000004b,
-    0x00000009, 0x0000000a, 0x0004003d, 0x00000006, 0x0000004c, 0x0000004b, 0x0004003d, 0x00000006,
-    0x0000004d, 0x00000045, 0x00060041, 0x0000002f, 0x0000004e, 0x0000002b, 0x0000004a, 0x0000004c,
-    0x0003003e, 0x0000004e, 0x0000004d, 0x00050041, 0x0000000b, 0x0000004f, 0x00000009, 0x0000000a,
-    0x0004003d, 0x00000006, 0x00000050, 0x0000004f, 0x0004003d, 0x00000006, 0x00000051, 0x00000045,
-    0x00050080, 0x00000006, 0x00000053, 0x00000051, 0x00000052, 0x00050082, 0x00000006, 0x00000054,
-    0x00000053, 0x00000036, 0x00050086, 0x00000006, 0x00000055, 0x00000054, 0x00000052, 0x00070041,
-    0x0000002f, 0x00000056, 0x0000002b, 0x0000002d, 0x00000050, 0x00000036, 0x0003003e, 0x00000056,
-    0x00000055, 0x00050041, 0x0000000b, 0x00000057, 0x00000009, 0x0000000a, 0x0004003d, 0x00000006,
-    0x00000058, 0x00000057, 0x0004003d, 0x00000006, 0x00000059, 0x00000045, 0x0007000c, 0x00000006,
-    0x0000005a, 0x00000001, 0x00000026, 0x00000059, 0x00000052, 0x00070041, 0x0000002f, 0x0000005b,
-    0x0000002b, 0x0000002d, 0x00000058, 0x0000003f, 0x0003003e, 0x0000005b, 0x0000005a, 0x000200f9,
-    0x0000001e, 0x000200f8, 0x0000001e, 0x000100fd, 0x00010038,
+const uint8_t Blob023_Data[1367] =
+{
+    0x28, 0xb5, 0x2f, 0xfd, 0x60, 0x54, 0x0f, 0x6d, 0x2a, 0x00, 0x36, 0xf4, 0xb7, 0x3f, 0xf0, 0xd4,
+    0xe6, 0xe8, 0xf0, 0x0c, 0xdc, 0x26, 0xb2, 0x89, 0x6c, 0x42, 0x32, 0xb0, 0x91, 0xb4, 0xcc, 0x7c,
+    0x22, 0x9b, 0x48, 0xe1, 0x8c, 0x14, 0xbc, 0xc9, 0x0b, 0xcb, 0x7e, 0x76, 0x1d, 0x49, 0xf4, 0xf4,
+    0x02, 0x9e, 0x76, 0x25, 0x18, 0x87, 0xeb, 0x38, 0x82, 0x5b, 0xd2, 0x41, 0x3a, 0xb0, 0x51, 0xa4,
+    0x3b, 0xc1, 0x4b, 0x89, 0xde, 0xc9, 0x71, 0x37, 0x12, 0x5a, 0xda, 0x24, 0x05, 0x9b, 0x00, 0x9d,
+    0x00, 0xa9, 0x00, 0xb1, 0x2c, 0x0f, 0xbf, 0xc7, 0xb7, 0xb9, 0x7e, 0x71, 0xa8, 0xfa, 0xff, 0x2e,
+    0x0f, 0xb2, 0xc9, 0x19, 0xae, 0x9d, 0x3d, 0x66, 0x5f, 0x9a, 0x95, 0x79, 0xf3, 0xbf, 0x8e, 0x65,
+    0xe4, 0x0f, 0x2c, 0x03, 0x95, 0xcb, 0x97, 0xdf, 0xbf, 0x5f, 0x49, 0xcb, 0xee, 0x1b, 0xc7, 0xb0,
+    0x9d, 0xfb, 0x0a, 0x54, 0x1c, 0x2f, 0x96, 0xdf, 0xce, 0x1e, 0xe5, 0x9e, 0x98, 0x07, 0xb3, 0x46,
+    0x19, 0xd6, 0x15, 0x61, 0x24, 0xea, 0xd3, 0x57, 0xdb, 0x25, 0x7c, 0x8c, 0x5f, 0xd4, 0xf3, 0x9e,
+    0xb7, 0x1f, 0x39, 0xfd, 0xb6, 0x45, 0x1e, 0xbf, 0x70, 0x91, 0xc3, 0x3f, 0xbd, 0x2e, 0xce, 0xf3,
+    0xb1, 0x98, 0xeb, 0xe9, 0x7e, 0x3f, 0x5d, 0x51, 0xf5, 0xe9, 0xbf, 0x99, 0xf4, 0xff, 0x27, 0x6a,
+    0xc6, 0x04, 0x52, 0x57, 0xea, 0xff, 0x3f, 0x7e, 0x59, 0xe5, 0xff, 0xa7, 0x6a, 0xeb, 0xff, 0x1f,
+    0x7d, 0xd6, 0xff, 0x3f, 0x47, 0x08, 0x88, 0x46, 0xdb, 0x6b, 0x8d, 0x9e, 0xb0, 0xa7, 0xdb, 0xff,
+    0xe6, 0x9f, 0x2f, 0xf0, 0xf3, 0xa3, 0x7e, 0xf5, 0x26, 0xfa, 0x6b, 0xc4, 0x89, 0x06, 0xb7, 0x9a,
+    0xa7, 0xae, 0xc3, 0xf4, 0x85, 0x33, 0x4b, 0xa3, 0xe7, 0xfb, 0x70, 0x93, 0x5e, 0xfe, 0xf7, 0x5b,
+    0xb2, 0x5e, 0x02, 0xdd, 0xba, 0xfd, 0x1e, 0xcd, 0x81, 0x47, 0xde, 0xbe, 0x74, 0x17, 0x1a, 0xb9,
+    0x92, 0xa5, 0x59, 0x8c, 0xbf, 0xd6, 0x1c, 0x7e, 0x87, 0x3e, 0xac, 0x2f, 0xe7, 0x7b, 0x12, 0xf9,
+    0xf2, 0x1d, 0x31, 0xd9, 0xdb, 0x77, 0x26, 0xe6, 0x9c, 0x3e, 0xe2, 0xa8, 0x74, 0xee, 0x67, 0xff,
+    0x6d, 0x5c, 0xe3, 0xa9, 0x59, 0x1f, 0x32, 0x7e, 0xe3, 0x14, 0x85, 0x59, 0x1e, 0x3c, 0x53, 0x2d,
+    0xef, 0xb4, 0x2c, 0xfc, 0xff, 0xef, 0xf1, 0x52, 0xbe, 0xf1, 0xd0, 0xf2, 0x8c, 0x8c, 0xe6, 0xae,
+    0xbb, 0xb4, 0x75, 0x78, 0x59, 0xf3, 0x60, 0xfc, 0xda, 0x64, 0xbf, 0xff, 0xff, 0x0f, 0x1e, 0xfd,
+    0x99, 0x55, 0xf6, 0xd7, 0xb6, 0x42, 0xbd, 0xea, 0xbb, 0xfb, 0x26, 0x85, 0xa9, 0xce, 0x6b, 0xd7,
+    0xfd, 0x21, 0x65, 0x16, 0xd4, 0xd3, 0xbd, 0xd7, 0xd6, 0x64, 0x9f, 0x39, 0x6e, 0xd3, 0x32, 0x2c,
+    0xdf, 0x68, 0x96, 0xc3, 0xb7, 0xff, 0xe7, 0xb0, 0x91, 0x1d, 0x06, 0xb8, 0x53, 0xa5, 0x45, 0x22,
+    0x12, 0x03, 0x71, 0xf0, 0xd8, 0x1b, 0x1a, 0xfb, 0x33, 0x50, 0x8c, 0xbf, 0x90, 0x5d, 0x58, 0xb4,
+    0xfe, 0x29, 0x26, 0xd6, 0x47, 0xbf, 0xa1, 0x62, 0x53, 0x48, 0x4c, 0x3c, 0xea, 0x25, 0x16, 0xfe,
+    0xdc, 0x08, 0xb1, 0xd7, 0xec, 0x80, 0x76, 0x1a, 0x10, 0x08, 0xb0, 0x9e, 0xf5, 0xb0, 0x01, 0x82,
+    0xd8, 0xc0, 0x41, 0x8b, 0xc1, 0x95, 0xb6, 0x4c, 0xd6, 0x5e, 0xc5, 0x54, 0xb3, 0x14, 0xcd, 0x4c,
+    0xd1, 0xf5, 0xf5, 0xb1, 0x6d, 0x80, 0x3e, 0x7a, 0x12, 0x24, 0xc8, 0xe8, 0x23, 0xfc, 0x17, 0xb8,
+    0xae, 0xeb, 0xba, 0xee, 0x99, 0x63, 0x12, 0x1f, 0x07, 0x35, 0x9b, 0xc9, 0xde, 0x95, 0x22, 0xa1,
+    0x45, 0x27, 0x90, 0xf9, 0x2f, 0xb3, 0xa8, 0x48, 0x29, 0x26, 0x1e, 0x1e, 0xe2, 0xe0, 0x44, 0x5f,
+    0xb7, 0x5b, 0xe1, 0x54, 0x2b, 0xa9, 0x13, 0x14, 0xc9, 0x0a, 0xb2, 0x4f, 0x0e, 0xd5, 0x95, 0x02,
+    0xa0, 0xa8, 0x33, 0x35, 0x3f, 0xe2, 0x77, 0x2e, 0x81, 0x7f, 0x86, 0x94, 0xae, 0x8e, 0xbf, 0xd3,
+    0x6c, 0x17, 0xf2, 0xfc, 0x71, 0x4e, 0x7e, 0xcb, 0xce, 0xc5, 0x55, 0xad, 0xf9, 0xff, 0xfd, 0x9c,
+    0x5e, 0xf6, 0x99, 0x0d, 0x6f, 0x3e, 0xc9, 0x9b, 0xff, 0x04, 0x83, 0xd9, 0xdc, 0xa8, 0xd0, 0xdc,
+    0x04, 0x29, 0x4c, 0x1b, 0x80, 0x9a, 0x19, 0x9a, 0x99, 0x18, 0x19, 0x11, 0xa0, 0x4c, 0x30, 0x46,
+    0x64, 0x18, 0x14, 0x14, 0xe6, 0x60, 0x7e, 0xc0, 0x9f, 0xef, 0xa5, 0xd7, 0xf2, 0x92, 0xf3, 0xb9,
+    0xf4, 0x5c, 0x78, 0xb9, 0x1d, 0x4f, 0xb7, 0x63, 0xd1, 0xb1, 0xd8, 0x6e, 0xb4, 0xd7, 0x6d, 0xbf,
+    0x6d, 0x2b, 0xd5, 0x54, 0x52, 0x56, 0x50, 0x52, 0x50, 0x5e, 0x27, 0x26, 0x34, 0x93, 0xff, 0xff,
+    0xf3, 0x9b, 0x4a, 0x52, 0x30, 0x4a, 0x48, 0x54, 0x3f, 0xd2, 0x02, 0x82, 0x84, 0x0c, 0x79, 0x7c,
+    0x6c, 0xa0, 0x0e, 0x8d, 0x0c, 0x8e, 0x15, 0x22, 0x02, 0xe2, 0x21, 0x42, 0xf5, 0x60, 0x14, 0x73,
+    0x68, 0x80, 0x35, 0xa4, 0xef, 0x04, 0x5b, 0x0a, 0x60, 0x58, 0x38, 0x52, 0x78, 0x25, 0x20, 0x00,
+    0x04, 0xa0, 0xa8, 0x52, 0xab, 0x5a, 0x0e, 0xa7, 0x32, 0xfd, 0xf9, 0xaa, 0x88, 0xbc, 0x62, 0xf0,
+    0xc4, 0x3a, 0xb0, 0x12, 0xde, 0x01, 0xe2, 0x69, 0x79, 0x77, 0xda, 0xe3, 0x9b, 0x4a, 0xd2, 0x5c,
+    0xe4, 0x66, 0xb9, 0x30, 0x4e, 0x6c, 0x8b, 0x44, 0x47, 0xa2, 0x90, 0x71, 0xc7, 0xd8, 0x15, 0x1d,
+    0x54, 0x91, 0x23, 0x87, 0x68, 0x3e, 0x8e, 0x47, 0xf0, 0x6c, 0xd9, 0x6b, 0x81, 0xe8, 0xa8, 0x51,
+    0xb8, 0x32, 0x22, 0xa2, 0x20, 0x49, 0x92, 0x4a, 0x6b, 0x01, 0x1e, 0x91, 0x43, 0x65, 0x3c, 0x31,
+    0x89, 0x33, 0x9c, 0x48, 0xa9, 0x82, 0x14, 0x14, 0x66, 0x99, 0x03, 0x08, 0x9c, 0x02, 0xb5, 0x5d,
+    0xee, 0xe9, 0xa5, 0x70, 0xc3, 0x01, 0xea, 0x26, 0x49, 0x1b, 0x90, 0xd8, 0x81, 0x94, 0x9d, 0x21,
+    0x64, 0xa5, 0xb0, 0x73, 0x7e, 0x61, 0x9f, 0x15, 0x52, 0x18, 0xe2, 0xbc, 0xc5, 0x9d, 0xbb, 0x4a,
+    0xf9, 0x1f, 0xb5, 0xce, 0x14, 0x01, 0x39, 0x11, 0x39, 0x0e, 0x1a, 0x5c, 0xa0, 0x7c, 0x75, 0x5b,
+    0x74, 0x86, 0xcb, 0x6e, 0x3c, 0x5f, 0xf0, 0xb6, 0x85, 0x09, 0x43, 0xf2, 0xd2, 0x11, 0x2d, 0x36,
+    0xf9, 0xe7, 0x12, 0x77, 0xd4, 0x31, 0xcf, 0x2a, 0xc3, 0x33, 0xa6, 0xeb, 0xd9, 0xa9, 0xbb, 0x41,
+    0x63, 0x57, 0x74, 0x2b, 0x6b, 0x6f, 0x8d, 0xed, 0xf8, 0x38, 0x21, 0xbe, 0x1c, 0x7e, 0x3b, 0x74,
+    0xc8, 0x2e, 0x21, 0xf0, 0xeb, 0x3f, 0xd4, 0x52, 0x43, 0x03, 0x6c, 0x32, 0xf7, 0xfd, 0xcc, 0x01,
+    0xdd, 0x1b, 0xc4, 0x0c, 0x64, 0x4b, 0xb1, 0xbf, 0xce, 0x3e, 0xe1, 0xa2, 0x19, 0x27, 0xda, 0xc4,
+    0xed, 0x87, 0xba, 0x36, 0xca, 0x7b, 0x42, 0xc8, 0xdd, 0x15, 0xf8, 0xfb, 0x81, 0xc5, 0x00, 0xce,
+    0xc2, 0xbc, 0x88, 0x0b, 0x44, 0x75, 0xfd, 0x8c, 0xe8, 0xcd, 0x50, 0x47, 0x42, 0x73, 0xa2, 0x41,
+    0xef, 0x66, 0x61, 0x42, 0xc0, 0xf2, 0x86, 0xca, 0x57, 0x9b, 0x97, 0x8f, 0x77, 0xef, 0x99, 0x1d,
+    0x57, 0xbd, 0xb3, 0x58, 0xc2, 0x32, 0x77, 0x1b, 0x29, 0xef, 0x84, 0x67, 0x83, 0x30, 0xf3, 0xdf,
+    0xc2, 0x38, 0x1a, 0x78, 0x0f, 0xda, 0x3f, 0x59, 0xe6, 0x02, 0x98, 0x61, 0xef, 0xc4, 0x60, 0xc2,
+    0x76, 0x1b, 0x45, 0xff, 0xff, 0xfa, 0xc7, 0xb6, 0xd9, 0x45, 0xf0, 0xae, 0x19, 0x9c, 0x5d, 0x67,
+    0xa8, 0x06, 0xff, 0xba, 0x85, 0xd4, 0xb7, 0x9e, 0x9c, 0xf8, 0xa8, 0x8d, 0xa3, 0xd1, 0x13, 0xa1,
+    0xb9, 0xb1, 0x7f, 0xe7, 0xee, 0xff, 0xa2, 0xe5, 0x4d, 0x1c, 0xda, 0xb8, 0x5f, 0xb7, 0x3d, 0x6d,
+    0xe4, 0xb7, 0x4d, 0xfc, 0x27, 0x32, 0xf3, 0xfd, 0xf3, 0xd5, 0x7f, 0xc4, 0xc4, 0xfe, 0x1e, 0xd7,
+    0x4e, 0xbd, 0xfb, 0x71, 0x36, 0xa2, 0x4f, 0x09, 0x0c, 0x8b, 0xb3, 0x87, 0x74, 0xff, 0xb5, 0x58,
+    0xe7, 0x8a, 0x47, 0x97, 0xdc, 0xe5, 0x79, 0x8e, 0xe6, 0x77, 0xef, 0x99, 0xf8, 0x3f, 0x6f, 0x9e,
+    0xc1, 0x0c, 0x80, 0x22, 0xde, 0x09, 0x7a, 0x3a, 0xc5, 0xf4, 0xa1, 0x92, 0xa1, 0xe4, 0x25, 0x76,
+    0xcd, 0xd8, 0xfe, 0xab, 0xfe, 0x5c, 0xa3, 0x6a, 0x0a, 0x3c, 0x75, 0xa2, 0x79, 0x34, 0x1f, 0x5c,
+    0xb9, 0xc0, 0x30, 0x8f, 0x8d, 0xb1, 0x43, 0x2f, 0x2d, 0x38, 0xa8, 0x1f, 0x8c, 0xd4, 0xdd, 0x98,
+    0xfd, 0xfb, 0x7f, 0x7f, 0xec, 0xbc, 0x98, 0xfd, 0x7f, 0xcf, 0xdd, 0xec, 0xec, 0x9b, 0x89, 0xca,
+    0x02, 0x79, 0xa6, 0xfb, 0x45, 0x4d, 0xc9, 0x66, 0xd4, 0x07, 0xc7, 0x3f, 0xf0, 0x6e, 0x79, 0x9d,
+    0xc0, 0x5b, 0x8f, 0x76, 0xe6, 0x8a, 0x6d, 0xb1, 0x81, 0x49, 0x5b, 0x5e, 0xf6, 0x69, 0x11, 0xbd,
+    0x62, 0x46, 0xe3, 0x03, 0x2f, 0x25, 0xe6, 0x50, 0x00, 0xc4, 0x2e, 0x46, 0xc8, 0x06, 0xf0, 0xe6,
+    0x8b, 0x59, 0x5a, 0x01, 0x99, 0x04, 0x9e, 0x9d, 0xc9, 0xe5, 0x54, 0xa1, 0xc7, 0xc0, 0x74, 0xb8,
+    0x57, 0x49, 0x5e, 0x5d, 0xea, 0x6e, 0x18, 0xf7, 0x94, 0x0d, 0x0e, 0x2a, 0xdc, 0x42, 0xfc, 0x48,
+    0xb8, 0xc0, 0xbe, 0xe4, 0x45, 0x45, 0xd0, 0xa3, 0x7c, 0x70, 0xc5, 0x79, 0xb8, 0x7b, 0x1f, 0xc7,
+    0x25, 0x03, 0xc5, 0xd5, 0x63, 0x07, 0xc2, 0x27, 0x56, 0xaf, 0x56, 0x8d, 0x6e, 0xd6, 0x26, 0xa0,
+    0x90, 0x40, 0x20, 0xf2, 0xbc, 0x63, 0x7d, 0x43, 0xa4, 0xff, 0xf8, 0x9a, 0x09, 0x5d, 0x20, 0xb4,
+    0x4d, 0x0d, 0xdc, 0xd0, 0x1d, 0x98, 0xf1, 0xe8, 0xbf, 0xa3, 0x94, 0x16, 0x74, 0xf1, 0xea, 0x54,
+    0x26, 0xa3, 0x8d, 0x86, 0xc4, 0x98, 0x1c, 0xd3, 0x42, 0xa9, 0x39, 0x92, 0x9b, 0x03, 0x6d, 0xb9,
+    0xd0, 0x06, 0xf2, 0xd0, 0xe0, 0xd6, 0x9d, 0x90, 0x96, 0xd7, 0x90, 0x77, 0x7e, 0x41, 0x47, 0xef,
+    0x3b, 0xbd, 0xf0, 0xa3, 0x96, 0x37, 0xad, 0xf0, 0x01, 0x39, 0xad, 0x0c, 0x3a, 0x0f, 0x91, 0xaf,
+    0x55, 0x2e, 0x7e, 0xf5, 0x45, 0xe8, 0xe6, 0x4b, 0x87, 0xd9, 0x86, 0xd3, 0x1e, 0x65, 0xf1, 0x1d,
+    0x9a, 0xc8, 0x5c, 0x7d, 0x7a, 0x47, 0x1a,
 };
+const ShaderModule Blob023 = { Blob023_Data, 1367u, 1045u, 23u };
 
-extern const uint32_t Blob061[1049];
-const uint32_t Blob061[1049] = {
-    0x07230203, 0x00010300, 0x0008000b, 0x00000071, 0x00000000, 0x00020011, 0x00000001, 0x0006000b,
-    0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001,
-    0x0006000f, 0x00000005, 0x00000004, 0x6e69616d, 0x00000000, 0x00000009, 0x00060010, 0x00000004,
-    0x00000011, 0x00000020, 0x00000001, 0x00000001, 0x00030003, 0x00000002, 0x000001c2, 0x000a0004,
-    0x475f4c47, 0x4c474f4f, 0x70635f45, 0x74735f70, 0x5f656c79, 0x656e696c, 0x7269645f, 0x69746365,
-    0x00006576, 0x00080004, 0x475f4c47, 0x4c474f4f, 0x6e695f45, 0x64756c63, 0x69645f65, 0x74636572,
-    0x00657669, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000, 0x00080005, 0x00000009, 0x475f6c67,
-    0x61626f6c, 0x766e496c, 0x7461636f, 0x496e6f69, 0x00000044, 0x00050005, 0x00000014, 0x6174654d,
-    0x66696e55, 0x006d726f, 0x00060006, 0x00000014, 0x00000000, 0x506d754e, 0x67796c6f, 0x00736e6f,
-    0x00060006, 0x00000014, 0x00000001, 0x566d754e, 0x61697261, 0x0073746e, 0x00060006, 0x00000014,
-    0x00000002, 0x68706c41, 0x66655261, 0x00000000, 0x00050006, 0x00000014, 0x00000003, 0x70736944,
-    0x00746e43, 0x00060006, 0x00000014, 0x00000004, 0x6e6f6f54, 0x6c626154, 0x00000065, 0x00060006,
-    0x00000014, 0x00000005, 0x61656c43, 0x6c6f4372, 0x0000726f, 0x00060006, 0x00000014, 0x00000006,
-    0x61656c43, 0x70654472, 0x00006874, 0x00060006, 0x00000014, 0x00000007, 0x61656c43, 0x74744172,
-    0x00000072, 0x00060006, 0x00000014, 0x00000008, 0x4f676f46, 0x65736666, 0x00000074, 0x00060006,
-    0x00000014, 0x00000009, 0x53676f46, 0x74666968, 0x00000000, 0x00060006, 0x00000014, 0x0000000a,
-    0x43676f46, 0x726f6c6f, 0x00000000, 0x00080006, 0x00000014, 0x0000000b, 0x61656c43, 0x74694272,
-    0x4f70616d, 0x65736666, 0x00000074, 0x00030005, 0x00000016, 0x00000000, 0x00060005, 0x00000029,
-    0x526e6942, 0x6c757365, 0x66754274, 0x00726566, 0x00080006, 0x00000029, 0x00000000, 0x69726156,
-    0x57746e61, 0x436b726f, 0x746e756f, 0x00000000, 0x00080006, 0x00000029, 0x00000001, 0x74726f53,
-    0x6f576465, 0x664f6b72, 0x74657366, 0x00000000, 0x00090006, 0x00000029, 0x00000002, 0x69726156,
-    0x57746e61, 0x526b726f, 0x436c6165, 0x746e756f, 0x00000000, 0x00080006, 0x00000029, 0x00000003,
-    0x74726f53, 0x6b726f57, 0x6b726f57, 0x6e756f43, 0x00000074, 0x00090006, 0x00000029, 0x00000004,
-    0x6e6e6942, 0x4d676e69, 0x416b7361, 0x664f646e, 0x74657366, 0x00000000, 0x00030005, 0x0000002b,
-    0x00000000, 0x00050005, 0x00000045, 0x6c616572, 0x6e756f43, 0x00000074, 0x00050005, 0x0000005c,
-    0x65726353, 0x69576e65, 0x00687464, 0x00060005, 0x0000005d, 0x65726353, 0x65486e65, 0x74686769,
-    0x00000000, 0x00060005, 0x0000005e, 0x5778614d, 0x546b726f, 0x73656c69, 0x00000000, 0x00070005,
-    0x00000062, 0x6d617246, 0x66756265, 0x53726566, 0x64697274, 0x00000065, 0x00060005, 0x00000064,
-    0x656c6954, 0x72655073, 0x656e694c, 0x00000000, 0x00050005, 0x00000065, 0x656c6954, 0x656e694c,
-    0x00000073, 0x00060005, 0x00000067, 0x68737550, 0x736e6f43, 0x746e6174, 0x00000073, 0x00060006,
-    0x00000067, 0x00000000, 0x56727543, 0x61697261, 0x0000746e, 0x00060006, 0x00000067, 0x00000001,
-    0x57786554, 0x68746469, 0x00000000, 0x00060006, 0x00000067, 0x00000002, 0x48786554, 0x68676965,
-    0x00000074, 0x00060006, 0x00000067, 0x00000003, 0x57786554, 0x53706172, 0x00000000, 0x00060006,
-    0x00000067, 0x00000004, 0x57786554, 0x54706172, 0x00000000, 0x00070006, 0x00000067, 0x00000005,
-    0x49786554, 0x70614373, 0x65727574, 0x00000000, 0x00070006, 0x00000067, 0x00000006, 0x74706143,
-    0x59657275, 0x7366664f, 0x00007465, 0x00050006, 0x00000067, 0x00000007, 0x6461705f, 0x00000000,
-    0x00030005, 0x00000069, 0x00006370, 0x00070005, 0x0000006c, 0x6e6e6942, 0x4d676e69, 0x536b7361,
-    0x74726174, 0x00000000, 0x00080005, 0x0000006f, 0x6e6e6942, 0x57676e69, 0x4f6b726f, 0x65736666,
-    0x74537374, 0x00747261, 0x00040047, 0x00000009, 0x0000000b, 0x0000001c, 0x00040047, 0x00000011,
-    0x00000006, 0x00000010, 0x00050048, 0x00000014, 0x00000000, 0x00000023, 0x00000000, 0x00050048,
-    0x00000014, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x00000014, 0x00000002, 0x00000023,
-    0x00000008, 0x00050048, 0x00000014, 0x00000003, 0x00000023, 0x0000000c, 0x00050048, 0x00000014,
-    0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x00000014, 0x00000005, 0x00000023, 0x00000230,
-    0x00050048, 0x00000014, 0x00000006, 0x00000023, 0x00000234, 0x00050048, 0x00000014, 0x00000007,
-    0x00000023, 0x00000238, 0x00050048, 0x00000014, 0x00000008, 0x00000023, 0x0000023c, 0x00050048,
-    0x00000014, 0x00000009, 0x00000023, 0x00000240, 0x00050048, 0x00000014, 0x0000000a, 0x00000023,
-    0x00000244, 0x00050048, 0x00000014, 0x0000000b, 0x00000023, 0x00000248, 0x00030047, 0x00000014,
-    0x00000002, 0x00040047, 0x00000016, 0x00000022, 0x00000000, 0x00040047, 0x00000016, 0x00000021,
-    0x00000000, 0x00040047, 0x00000025, 0x00000006, 0x00000010, 0x00040047, 0x00000026, 0x00000006,
-    0x00000004, 0x00040047, 0x00000027, 0x00000006, 0x00000004, 0x00040047, 0x00000028, 0x00000006,
-    0x00000004, 0x00050048, 0x00000029, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000029,
-    0x00000001, 0x00000023, 0x00008000, 0x00050048, 0x00000029, 0x00000002, 0x00000023, 0x0000a000,
-    0x00050048, 0x00000029, 0x00000003, 0x00000023, 0x0000c000, 0x00050048, 0x00000029, 0x00000004,
-    0x00000023, 0x0000c010, 0x00030047, 0x00000029, 0x00000002, 0x00040047, 0x0000002b, 0x00000022,
-    0x00000000, 0x00040047, 0x0000002b, 0x00000021, 0x00000008, 0x00040047, 0x0000005c, 0x00000001,
-    0x00000000, 0x00040047, 0x0000005d, 0x00000001, 0x00000001, 0x00040047, 0x0000005e, 0x00000001,
-    0x00000002, 0x00050048, 0x00000067, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000067,
-    0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x00000067, 0x00000002, 0x00000023, 0x00000008,
-    0x00050048, 0x00000067, 0x00000003, 0x00000023, 0x0000000c, 0x00050048, 0x00000067, 0x00000004,
-    0x00000023, 0x00000010, 0x00050048, 0x00000067, 0x00000005, 0x00000023, 0x00000014, 0x00050048,
-    0x00000067, 0x00000006, 0x00000023, 0x00000018, 0x00050048, 0x00000067, 0x00000007, 0x00000023,
-    0x0000001c, 0x00030047, 0x00000067, 0x00000002, 0x00040047, 0x00000070, 0x0000000b, 0x00000019,
-    0x00020013, 0x00000002, 0x00030021, 0x00000003, 0x00000002, 0x00040015, 0x00000006, 0x00000020,
-    0x00000000, 0x00040017, 0x00000007, 0x00000006, 0x00000003, 0x00040020, 0x00000008, 0x00000001,
-    0x00000007, 0x0004003b, 0x00000008, 0x00000009, 0x00000001, 0x0004002b, 0x00000006, 0x0000000a,
-    0x00000000, 0x00040020, 0x0000000b, 0x00000001, 0x00000006, 0x00040015, 0x0000000e, 0x00000020,
-    0x00000001, 0x00040017, 0x0000000f, 0x00000006, 0x00000004, 0x0004002b, 0x00000006, 0x00000010,
-    0x00000022, 0x0004001c, 0x00000011, 0x0000000f, 0x00000010, 0x00030016, 0x00000012, 0x00000020,
-    0x00040017, 0x00000013, 0x00000012, 0x00000002, 0x000e001e, 0x00000014, 0x00000006, 0x00000006,
-    0x0000000e, 0x00000006, 0x00000011, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000013, 0x00040020, 0x00000015, 0x00000002, 0x00000014, 0x0004003b, 0x00000015,
-    0x00000016, 0x00000002, 0x0004002b, 0x0000000e, 0x00000017, 0x00000001, 0x00040020, 0x00000018,
-    0x00000002, 0x00000006, 0x00020014, 0x0000001b, 0x0004002b, 0x00000006, 0x00000024, 0x00000800,
-    0x0004001c, 0x00000025, 0x0000000f, 0x00000024, 0x0004001c, 0x00000026, 0x00000006, 0x00000024,
-    0x0004001c, 0x00000027, 0x00000006, 0x00000024, 0x0003001d, 0x00000028, 0x00000006, 0x0007001e,
-    0x00000029, 0x00000025, 0x00000026, 0x00000027, 0x0000000f, 0x00000028, 0x00040020, 0x0000002a,
-    0x0000000c, 0x00000029, 0x0004003b, 0x0000002a, 0x0000002b, 0x0000000c, 0x0004002b, 0x0000000e,
-    0x0000002c, 0x00000003, 0x0004002b, 0x0000000e, 0x0000002d, 0x00000000, 0x0004002b, 0x00000006,
-    0x0000002e, 0x00000003, 0x00040020, 0x0000002f, 0x0000000c, 0x00000006, 0x0004002b, 0x00000006,
-    0x00000032, 0x0000001f, 0x0004002b, 0x00000006, 0x00000034, 0x00000020, 0x0004002b, 0x00000006,
-    0x00000036, 0x00000001, 0x00040020, 0x00000038, 0x0000000c, 0x0000000f, 0x0004002b, 0x00000006,
-    0x0000003f, 0x00000002, 0x00040020, 0x00000044, 0x00000007, 0x00000006, 0x0004002b, 0x0000000e,
-    0x0000004a, 0x00000002, 0x0004002b, 0x00000006, 0x00000052, 0x00008000, 0x00040032, 0x0000000e,
-    0x0000005c, 0x00000100, 0x00040032, 0x0000000e, 0x0000005d, 0x000000c0, 0x00040032, 0x0000000e,
-    0x0000005e, 0x00003000, 0x0004002b, 0x0000000e, 0x0000005f, 0x00000008, 0x0004002b, 0x0000000e,
-    0x00000060, 0x00000080, 0x0004002b, 0x0000000e, 0x00000061, 0x00000040, 0x00060034, 0x0000000e,
-    0x00000062, 0x00000084, 0x0000005c, 0x0000005d, 0x0004002b, 0x0000000e, 0x00000063, 0x00000010,
-    0x00060034, 0x0000000e, 0x00000064, 0x00000087, 0x0000005c, 0x00000063, 0x00060034, 0x0000000e,
-    0x00000065, 0x00000087, 0x0000005d, 0x00000063, 0x0004002b, 0x0000000e, 0x00000066, 0x00000800,
-    0x000a001e, 0x00000067, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x0000000e, 0x00000006, 0x00040020, 0x00000068, 0x00000009, 0x00000067, 0x0004003b, 0x00000068,
-    0x00000069, 0x00000009, 0x00060034, 0x0000000e, 0x0000006a, 0x00000084, 0x00000064, 0x00000065,
-    0x00060034, 0x0000000e, 0x0000006b, 0x00000084, 0x0000006a, 0x0000004a, 0x00060034, 0x0000000e,
-    0x0000006c, 0x00000080, 0x0000002d, 0x0000006b, 0x00060034, 0x0000000e, 0x0000006d, 0x00000084,
-    0x00000064, 0x00000065, 0x00060034, 0x0000000e, 0x0000006e, 0x00000084, 0x0000006d, 0x00000061,
-    0x00060034, 0x0000000e, 0x0000006f, 0x00000080, 0x0000006c, 0x0000006e, 0x0006002c, 0x00000007,
-    0x00000070, 0x00000034, 0x00000036, 0x00000036, 0x00050036, 0x00000002, 0x00000004, 0x00000000,
-    0x00000003, 0x000200f8, 0x00000005, 0x0004003b, 0x00000044, 0x00000045, 0x00000007, 0x00050041,
-    0x0000000b, 0x0000000c, 0x00000009, 0x0000000a, 0x0004003d, 0x00000006, 0x0000000d, 0x0000000c,
-    0x00050041, 0x00000018, 0x00000019, 0x00000016, 0x00000017, 0x0004003d, 0x00000006, 0x0000001a,
-    0x00000019, 0x000500b0, 0x0000001b, 0x0000001c, 0x0000000d, 0x0000001a, 0x000300f7, 0x0000001e,
-    0x00000000, 0x000400fa, 0x0000001c, 0x0000001d, 0x0000001e, 0x000200f8, 0x0000001d, 0x00050041,
-    0x0000000b, 0x0000001f, 0x00000009, 0x0000000a, 0x0004003d, 0x00000006, 0x00000020, 0x0000001f,
-    0x000500aa, 0x0000001b, 0x00000021, 0x00000020, 0x0000000a, 0x000300f7, 0x00000023, 0x00000000,
-    0x000400fa, 0x00000021, 0x00000022, 0x00000023, 0x000200f8, 0x00000022, 0x00070041, 0x0000002f,
-    0x00000030, 0x0000002b, 0x0000002d, 0x0000002d, 0x0000002e, 0x0004003d, 0x00000006, 0x00000031,
-    0x00000030, 0x00050080, 0x00000006, 0x00000033, 0x00000031, 0x00000032, 0x00050086, 0x00000006,
-    0x00000035, 0x00000033, 0x00000034, 0x00070050, 0x0000000f, 0x00000037, 0x00000035, 0x00000036,
-    0x00000036, 0x0000000a, 0x00050041, 0x00000038, 0x00000039, 0x0000002b, 0x0000002c, 0x0003003e,
-    0x00000039, 0x00000037, 0x000200f9, 0x00000023, 0x000200f8, 0x00000023, 0x00050041, 0x0000000b,
-    0x0000003a, 0x00000009, 0x0000000a, 0x0004003d, 0x00000006, 0x0000003b, 0x0000003a, 0x00070041,
-    0x0000002f, 0x0000003c, 0x0000002b, 0x0000002d, 0x00000017, 0x0000002e, 0x00050041, 0x0000000b,
-    0x0000003d, 0x00000009, 0x0000000a, 0x0004003d, 0x00000006, 0x0000003e, 0x0000003d, 0x00070041,
-    0x0000002f, 0x00000040, 0x0000002b, 0x0000002d, 0x0000003e, 0x0000003f, 0x0004003d, 0x00000006,
-    0x00000041, 0x00000040, 0x000700ea, 0x00000006, 0x00000042, 0x0000003c, 0x00000036, 0x0000000a,
-    0x00000041, 0x00060041, 0x0000002f, 0x00000043, 0x0000002b, 0x00000017, 0x0000003b, 0x0003003e,
-    0x00000043, 0x00000042, 0x00050041, 0x0000000b, 0x00000046, 0x00000009, 0x0000000a, 0x0004003d,
-    0x00000006, 0x00000047, 0x00000046, 0x00070041, 0x0000002f, 0x00000048, 0x0000002b, 0x0000002d,
-    0x00000047, 0x0000003f, 0x0004003d, 0x00000006, 0x00000049, 0x00000048, 0x0003003e, 0x00000045,
-    0x00000049, 0x00050041, 0x0000000b, 0x0000004b, 0x00000009, 0x0000000a, 0x0004003d, 0x00000006,
-    0x0000004c, 0x0000004b, 0x0004003d, 0x00000006, 0x0000004d, 0x00000045, 0x00060041, 0x0000002f,
-    0x0000004e, 0x0000002b, 0x0000004a, 0x0000004c, 0x0003003e, 0x0000004e, 0x0000004d, 0x00050041,
-    0x0000000b, 0x0000004f, 0x00000009, 0x0000000a, 0x0004003d, 0x00000006, 0x00000050, 0x0000004f,
-    0x0004003d, 0x00000006, 0x00000051, 0x00000045, 0x00050080, 0x00000006, 0x00000053, 0x00000051,
-    0x00000052, 0x00050082, 0x00000006, 0x00000054, 0x00000053, 0x00000036, 0x00050086, 0x00000006,
-    0x00000055, 0x00000054, 0x00000052, 0x00070041, 0x0000002f, 0x00000056, 0x0000002b, 0x0000002d,
-    0x00000050, 0x00000036, 0x0003003e, 0x00000056, 0x00000055, 0x00050041, 0x0000000b, 0x00000057,
-    0x00000009, 0x0000000a, 0x0004003d, 0x00000006, 0x00000058, 0x00000057, 0x0004003d, 0x00000006,
-    0x00000059, 0x00000045, 0x0007000c, 0x00000006, 0x0000005a, 0x00000001, 0x00000026, 0x00000059,
-    0x00000052, 0x00070041, 0x0000002f, 0x0000005b, 0x0000002b, 0x0000002d, 0x00000058, 0x0000003f,
-    0x0003003e, 0x0000005b, 0x0000005a, 0x000200f9, 0x0000001e, 0x000200f8, 0x0000001e, 0x000100fd,
-    0x00010038,
+const uint8_t Blob061_Data[1373] =
+{
+    0x28, 0xb5, 0x2f, 0xfd, 0x60, 0x64, 0x0f, 0x9d, 0x2a, 0x00, 0x86, 0x34, 0xb9, 0x3f, 0xf0, 0xb6,
+    0x73, 0x14, 0x03, 0xf3, 0xf0, 0xb0, 0x38, 0x2c, 0x0e, 0x8b, 0xad, 0xc5, 0x61, 0xe0, 0x39, 0x71,
+    0x06, 0x9e, 0x81, 0x46, 0xd7, 0x67, 0x86, 0x62, 0x75, 0xb7, 0x1f, 0x58, 0x6f, 0xd3, 0xec, 0xca,
+    0x95, 0xce, 0xb8, 0xe7, 0x05, 0x45, 0xd4, 0x15, 0xad, 0x0b, 0xcf, 0x39, 0xe7, 0xe8, 0x8c, 0xeb,
+    0x60, 0xae, 0x43, 0x16, 0x58, 0xc9, 0xb6, 0x9b, 0x88, 0x88, 0x08, 0x49, 0x01, 0x9c, 0x00, 0x9d,
+    0x00, 0xab, 0x00, 0xc3, 0x58, 0x96, 0x87, 0xdf, 0x63, 0xdc, 0x5c, 0xbf, 0x39, 0x54, 0xfd, 0x7f,
+    0x24, 0x0f, 0xee, 0xe4, 0x0c, 0xdb, 0xce, 0x1e, 0xef, 0x97, 0xde, 0x33, 0x6f, 0xfe, 0xd7, 0xb1,
+    0xec, 0x06, 0xc1, 0x32, 0x50, 0xb9, 0x7c, 0xf9, 0xf5, 0xd7, 0x57, 0xd2, 0x32, 0xf2, 0x8d, 0x65,
+    0x76, 0xe7, 0xbf, 0x02, 0x35, 0xd7, 0x8b, 0xe5, 0xb7, 0xef, 0xa3, 0xfc, 0x13, 0xf7, 0xe0, 0x6d,
+    0x94, 0xe1, 0x5d, 0x11, 0x76, 0x53, 0x9f, 0xbe, 0xda, 0x2e, 0xe1, 0x63, 0xfc, 0xa6, 0x9e, 0xff,
+    0xbc, 0xfd, 0xc8, 0xe9, 0xb7, 0x2d, 0xf2, 0xf8, 0x85, 0x8b, 0x1c, 0x0e, 0xea, 0x75, 0x71, 0x9e,
+    0x8f, 0x45, 0x9d, 0x6f, 0x07, 0x03, 0xb3, 0x2b, 0xae, 0x3e, 0xfd, 0x37, 0x97, 0xfe, 0xff, 0x44,
+    0x4d, 0x99, 0x40, 0xfa, 0x52, 0xfd, 0xff, 0xc7, 0xef, 0x56, 0xfe, 0x7f, 0xaa, 0xba, 0xfe, 0xff,
+    0xd1, 0x6f, 0xfd, 0xff, 0x73, 0x84, 0x80, 0x68, 0xb4, 0xbd, 0xd6, 0xf0, 0x09, 0x7d, 0xbb, 0xf5,
+    0xdf, 0xfc, 0xf3, 0x05, 0xde, 0xe7, 0x53, 0xcf, 0x7a, 0x13, 0x7d, 0x36, 0xe2, 0x44, 0x03, 0xf3,
+    0xc6, 0xd5, 0x3d, 0x95, 0x1d, 0xa6, 0x2f, 0x9c, 0x37, 0x8d, 0x9e, 0x0f, 0xc4, 0x4d, 0x7a, 0xf9,
+    0xdf, 0x71, 0xc9, 0x7a, 0x09, 0x74, 0x6b, 0xfe, 0x3e, 0x9a, 0x03, 0x5b, 0xde, 0xbe, 0x74, 0x17,
+    0x1a, 0xb9, 0x72, 0xd3, 0x2c, 0xc6, 0x67, 0x6b, 0x0e, 0xbf, 0x43, 0xa0, 0xfd, 0xd3, 0xf9, 0x9e,
+    0x74, 0x5f, 0xce, 0x23, 0x26, 0x7b, 0xfb, 0xd2, 0xc4, 0x9c, 0xd3, 0xc7, 0x1c, 0x95, 0xd6, 0x3d,
+    0xed, 0xbf, 0x8d, 0x6d, 0x3d, 0xf5, 0xfe, 0xb9, 0xf1, 0x1b, 0xa7, 0x28, 0xbc, 0x79, 0xf0, 0x54,
+    0xb5, 0xbc, 0xd3, 0xb2, 0xf0, 0xff, 0xbf, 0xc7, 0x4b, 0x19, 0xd7, 0x43, 0xcb, 0x34, 0x33, 0x9a,
+    0x23, 0x91, 0xcb, 0x5b, 0x87, 0x97, 0x35, 0x0f, 0xc6, 0xef, 0x6d, 0xf6, 0xeb, 0xff, 0xff, 0xc1,
+    0xa3, 0x3f, 0x6f, 0x65, 0x7f, 0x6f, 0xac, 0xd4, 0xaf, 0xbe, 0x23, 0xdf, 0xa4, 0x50, 0xd5, 0x79,
+    0x8d, 0x44, 0xc2, 0xb8, 0x32, 0x4b, 0xea, 0xe9, 0xde, 0x6d, 0x6c, 0xb2, 0xcf, 0x3c, 0xb7, 0xd2,
+    0x32, 0x2c, 0xe3, 0xe8, 0xcd, 0x61, 0xdc, 0xff, 0x73, 0xd8, 0xb8, 0x03, 0x2b, 0x9b, 0x3b, 0x55,
+    0x5c, 0x24, 0x22, 0x32, 0x10, 0x07, 0x8f, 0x75, 0x43, 0x63, 0xfd, 0x0c, 0x14, 0x03, 0x80, 0x76,
+    0x31, 0xbb, 0xb0, 0x70, 0xfd, 0x53, 0x4c, 0xb0, 0x8f, 0x7e, 0x43, 0xc5, 0x4a, 0x21, 0x31, 0xf1,
+    0xa9, 0x97, 0x58, 0xf8, 0x73, 0x45, 0x90, 0xc1, 0x68, 0x07, 0xb5, 0xd3, 0x80, 0x40, 0xa0, 0xf5,
+    0xad, 0x8f, 0x0d, 0x10, 0xc8, 0x06, 0x0e, 0x5c, 0x0c, 0xaf, 0xd4, 0x65, 0xb6, 0x56, 0x96, 0x6c,
+    0x45, 0x53, 0xd5, 0xcc, 0x14, 0x65, 0x61, 0x2f, 0x5b, 0x0d, 0xd0, 0x47, 0x4f, 0x82, 0x84, 0x19,
+    0x7d, 0x84, 0xff, 0x02, 0xd7, 0x75, 0x5d, 0xd7, 0x3d, 0x75, 0x4c, 0xe2, 0xe7, 0xa4, 0x68, 0xb4,
+    0xd9, 0xbf, 0x52, 0x25, 0xf4, 0xe8, 0x14, 0x32, 0xff, 0x67, 0x16, 0x15, 0x29, 0xc5, 0xc4, 0xc3,
+    0x43, 0x1c, 0x9c, 0xe8, 0xef, 0x78, 0xac, 0xdc, 0x6a, 0x45, 0x75, 0x92, 0x22, 0x61, 0x41, 0xd6,
+    0x93, 0x43, 0x7d, 0xa5, 0x00, 0x68, 0xea, 0x4c, 0xcd, 0x8f, 0x78, 0xde, 0x4b, 0xe0, 0x9f, 0x41,
+    0xb5, 0xab, 0xe5, 0xef, 0xf4, 0xee, 0x42, 0xf8, 0x8f, 0xf3, 0xfb, 0xed, 0x9e, 0x8b, 0xac, 0x6a,
+    0xf3, 0xff, 0xeb, 0x73, 0x7a, 0xd9, 0x03, 0x6f, 0x3e, 0xc9, 0x9b, 0x1f, 0x15, 0x8b, 0xdd, 0xe0,
+    0xa8, 0xd4, 0xe0, 0x04, 0x29, 0xcc, 0x1b, 0x00, 0x1b, 0x9a, 0x1a, 0x1a, 0x99, 0x19, 0x11, 0xe0,
+    0x4c, 0x50, 0x46, 0x64, 0x38, 0x14, 0x14, 0xea, 0x62, 0x1e, 0x08, 0xf3, 0x7b, 0xf1, 0xb5, 0xbc,
+    0xe8, 0x7e, 0x2e, 0x3e, 0x97, 0x9e, 0x8e, 0xd7, 0xdb, 0xf1, 0x58, 0x76, 0x2c, 0x37, 0x5c, 0x0d,
+    0x86, 0x5b, 0xff, 0x6f, 0x2b, 0x93, 0x4d, 0x25, 0x65, 0x05, 0x25, 0x05, 0x05, 0x76, 0x62, 0x52,
+    0x33, 0xf9, 0xff, 0x3f, 0xff, 0xa9, 0x24, 0x05, 0xa3, 0x84, 0x64, 0xf5, 0x23, 0x2e, 0x20, 0x48,
+    0x48, 0x91, 0xc7, 0xc7, 0x2a, 0xd4, 0xa1, 0x91, 0xc1, 0xc1, 0x42, 0x44, 0x40, 0x3c, 0x44, 0xac,
+    0x1e, 0x90, 0x64, 0x0e, 0x0d, 0xb1, 0x86, 0xf4, 0xa1, 0x62, 0x4d, 0x01, 0x0c, 0x0b, 0x49, 0x0a,
+    0xb0, 0x04, 0x04, 0x80, 0x00, 0x94, 0x95, 0x8a, 0x65, 0x63, 0x75, 0x39, 0xd5, 0xe9, 0xcf, 0x57,
+    0x45, 0x66, 0x16, 0x03, 0x96, 0xb7, 0x32, 0x56, 0xf6, 0x08, 0xc1, 0x2d, 0x3c, 0x3d, 0xbc, 0xe5,
+    0x51, 0xbd, 0x35, 0x37, 0xb9, 0xb6, 0xdc, 0x18, 0x92, 0xc8, 0x8f, 0x46, 0xed, 0xeb, 0x48, 0x24,
+    0x32, 0xae, 0x2b, 0x5b, 0x68, 0x27, 0x55, 0xe4, 0xd0, 0x21, 0x9a, 0x9f, 0xe3, 0x11, 0x3c, 0x5b,
+    0x02, 0x81, 0xeb, 0xa8, 0x51, 0xb4, 0x33, 0x22, 0xa2, 0x20, 0x49, 0x92, 0x4a, 0x6b, 0xf1, 0x1d,
+    0x21, 0xa7, 0xca, 0x78, 0x31, 0x89, 0x33, 0x9e, 0x08, 0xa9, 0x82, 0x14, 0x14, 0x66, 0x99, 0x03,
+    0x90, 0x9f, 0x92, 0x38, 0x77, 0xf7, 0xe8, 0x31, 0xd2, 0xe1, 0xa8, 0x49, 0xe4, 0x85, 0x37, 0xce,
+    0xb7, 0x03, 0x93, 0xd2, 0x21, 0xcf, 0xe2, 0xfc, 0x13, 0x7d, 0x21, 0xe2, 0x17, 0x65, 0xd7, 0x51,
+    0x17, 0x73, 0xde, 0xf4, 0x1f, 0x22, 0xe2, 0x8e, 0x3f, 0x03, 0x9e, 0x5c, 0x71, 0x79, 0xa2, 0xf3,
+    0xd8, 0x99, 0x5b, 0xa2, 0xce, 0x6e, 0x9b, 0xe7, 0x09, 0xa0, 0xa3, 0xf0, 0xfa, 0xb2, 0xbe, 0x41,
+    0x3f, 0x9c, 0x40, 0x70, 0xa4, 0xe2, 0x09, 0x7f, 0xce, 0x69, 0x8c, 0x3a, 0x53, 0x5b, 0x79, 0x73,
+    0x06, 0x27, 0x9e, 0x67, 0xbd, 0x5b, 0x7d, 0xbe, 0x1e, 0x5a, 0x5e, 0x7f, 0x09, 0x83, 0x8f, 0xda,
+    0x69, 0x72, 0xe6, 0x32, 0xd5, 0xa9, 0xa1, 0xf8, 0x1c, 0x99, 0xcf, 0xfb, 0xf0, 0x85, 0x46, 0x06,
+    0xec, 0x09, 0x7b, 0xef, 0xab, 0x87, 0x4e, 0xbf, 0xb8, 0x1a, 0xd0, 0xad, 0x44, 0x1f, 0xd3, 0x7f,
+    0xba, 0x5e, 0xa0, 0xcd, 0xfb, 0x0d, 0x9e, 0x28, 0x1d, 0xaf, 0x4c, 0x79, 0xbf, 0xd0, 0x69, 0x79,
+    0xd5, 0xcc, 0xba, 0x60, 0xc8, 0x76, 0x04, 0xc1, 0xce, 0x62, 0x81, 0x54, 0xef, 0xf7, 0x36, 0xb7,
+    0x1b, 0xf0, 0x8c, 0x37, 0x4f, 0x78, 0xfc, 0x3c, 0x5a, 0x8f, 0xd8, 0x08, 0xfe, 0x50, 0x13, 0xd6,
+    0x07, 0x74, 0x49, 0x7a, 0xe1, 0x62, 0xd8, 0x92, 0xeb, 0x77, 0xa5, 0x51, 0x71, 0xc9, 0xad, 0x53,
+    0xf4, 0x68, 0x5b, 0xa7, 0x3c, 0x5b, 0x0d, 0x35, 0xff, 0xd7, 0x06, 0xf3, 0xc8, 0x7b, 0x6d, 0xb8,
+    0x89, 0xfa, 0xc6, 0x5b, 0x0e, 0xe0, 0x13, 0x7e, 0xfb, 0x57, 0xf7, 0xa0, 0xfd, 0xa2, 0xd7, 0xe9,
+    0x8b, 0xd3, 0x8d, 0xbf, 0xcf, 0xf8, 0x19, 0xdf, 0x81, 0x77, 0xc9, 0xca, 0xd6, 0x2d, 0x45, 0xad,
+    0x7c, 0x44, 0xc0, 0x14, 0xf8, 0x64, 0xab, 0xb4, 0xec, 0x8f, 0xf9, 0x55, 0xbc, 0xc6, 0xdf, 0x38,
+    0xe7, 0xcf, 0xe0, 0xd7, 0x1e, 0x27, 0xcb, 0xbf, 0xcc, 0xdd, 0x35, 0x97, 0x66, 0x12, 0x7f, 0x72,
+    0xf8, 0x34, 0x91, 0xa8, 0x80, 0xc7, 0xe4, 0x53, 0xef, 0xc8, 0xa6, 0x46, 0xf4, 0xb9, 0x84, 0x03,
+    0x3e, 0xe4, 0x71, 0xa3, 0x7f, 0xd7, 0xdb, 0x5a, 0xd1, 0x81, 0xaa, 0x73, 0x3e, 0xc7, 0x81, 0x0c,
+    0xf6, 0x9e, 0x98, 0xfe, 0xb7, 0xda, 0x33, 0x0b, 0xda, 0x32, 0x9a, 0xbd, 0x17, 0x4e, 0x51, 0x4c,
+    0x3f, 0x14, 0x3d, 0x14, 0x5e, 0xba, 0xd3, 0x64, 0xed, 0x3f, 0xd6, 0xa6, 0xe5, 0xad, 0xa6, 0x68,
+    0xcc, 0x73, 0xfc, 0x1c, 0x3f, 0xb7, 0xab, 0xd4, 0x1e, 0xc9, 0x73, 0x50, 0xcf, 0xe8, 0x45, 0xa6,
+    0xca, 0xfb, 0x07, 0x57, 0x57, 0x32, 0x62, 0xfa, 0xfb, 0xfb, 0xdb, 0x7a, 0xaf, 0x61, 0xed, 0xfb,
+    0xe7, 0x93, 0xf3, 0x7d, 0x33, 0xaf, 0x58, 0xe0, 0xc6, 0x74, 0x7f, 0x11, 0x52, 0xb2, 0x0d, 0x39,
+    0xe3, 0xd0, 0x6c, 0xbf, 0x2f, 0xaf, 0xd3, 0x77, 0xeb, 0xf1, 0xce, 0xfc, 0xc0, 0x2d, 0x5a, 0x14,
+    0x0a, 0x94, 0x37, 0x40, 0xc5, 0x47, 0x4f, 0x36, 0x72, 0x67, 0xe1, 0xa5, 0x63, 0x02, 0xbb, 0x03,
+    0xf1, 0x67, 0x5f, 0xf9, 0x00, 0x7b, 0xbe, 0xac, 0xa9, 0x05, 0xc8, 0x24, 0xfb, 0xec, 0x8c, 0x2e,
+    0x42, 0x17, 0x22, 0x0e, 0x4c, 0xe3, 0x1f, 0xe1, 0x7a, 0x75, 0x07, 0xbb, 0x8d, 0xdc, 0xd3, 0x1a,
+    0x8c, 0x6d, 0xb8, 0x85, 0xfc, 0xc8, 0xf8, 0xcb, 0xbe, 0xe8, 0x45, 0x05, 0xb0, 0xa1, 0x7c, 0x58,
+    0xe2, 0xd0, 0xdd, 0x1d, 0xbb, 0xa3, 0x59, 0x81, 0x62, 0xea, 0x3d, 0x03, 0xec, 0xd9, 0xd9, 0xeb,
+    0x52, 0x23, 0x9c, 0x4c, 0x1f, 0x50, 0x20, 0x20, 0xce, 0x7a, 0xdf, 0x61, 0xbe, 0x01, 0xf2, 0x31,
+    0x8a, 0x6b, 0x5a, 0x67, 0x89, 0x62, 0x53, 0x43, 0x37, 0x08, 0x07, 0x66, 0x3a, 0x54, 0xf0, 0x10,
+    0x65, 0x0b, 0xfd, 0xb8, 0xc2, 0x96, 0xc9, 0x18, 0xa3, 0x4d, 0x1e, 0x38, 0x97, 0xf0, 0x50, 0xe2,
+    0xae, 0x05, 0x4f, 0x1e, 0xf7, 0x67, 0xe3, 0x66, 0x7f, 0x68, 0x75, 0x8b, 0x9c, 0x10, 0xe6, 0xed,
+    0x20, 0xd6, 0xc7, 0xfc, 0x89, 0xf6, 0x35, 0x0d, 0xf2, 0x2b, 0xc2, 0x52, 0x18, 0x7c, 0x68, 0x8c,
+    0x3b, 0x83, 0xe6, 0x21, 0xa2, 0xb5, 0xb4, 0x0b, 0x5c, 0x7d, 0x10, 0x62, 0x98, 0x38, 0xb5, 0x9b,
+    0xc4, 0x24, 0xe7, 0x3c, 0xfe, 0x48, 0x3b, 0x9b, 0xa3, 0x4f, 0x2f, 0x49, 0x03,
 };
+const ShaderModule Blob061 = { Blob061_Data, 1373u, 1049u, 61u };
 
-extern const uint32_t Blob099[1053];
-const uint32_t Blob099[1053] = {
-    0x07230203, 0x00010300, 0x0008000b, 0x00000072, 0x00000000, 0x00020011, 0x00000001, 0x0006000b,
-    0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001,
-    0x0006000f, 0x00000005, 0x00000004, 0x6e69616d, 0x00000000, 0x00000009, 0x00060010, 0x00000004,
-    0x00000011, 0x00000020, 0x00000001, 0x00000001, 0x00030003, 0x00000002, 0x000001c2, 0x000a0004,
-    0x475f4c47, 0x4c474f4f, 0x70635f45, 0x74735f70, 0x5f656c79, 0x656e696c, 0x7269645f, 0x69746365,
-    0x00006576, 0x00080004, 0x475f4c47, 0x4c474f4f, 0x6e695f45, 0x64756c63, 0x69645f65, 0x74636572,
-    0x00657669, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000, 0x00080005, 0x00000009, 0x475f6c67,
-    0x61626f6c, 0x766e496c, 0x7461636f, 0x496e6f69, 0x00000044, 0x00050005, 0x00000014, 0x6174654d,
-    0x66696e55, 0x006d726f, 0x00060006, 0x00000014, 0x00000000, 0x506d754e, 0x67796c6f, 0x00736e6f,
-    0x00060006, 0x00000014, 0x00000001, 0x566d754e, 0x61697261, 0x0073746e, 0x00060006, 0x00000014,
-    0x00000002, 0x68706c41, 0x66655261, 0x00000000, 0x00050006, 0x00000014, 0x00000003, 0x70736944,
-    0x00746e43, 0x00060006, 0x00000014, 0x00000004, 0x6e6f6f54, 0x6c626154, 0x00000065, 0x00060006,
-    0x00000014, 0x00000005, 0x61656c43, 0x6c6f4372, 0x0000726f, 0x00060006, 0x00000014, 0x00000006,
-    0x61656c43, 0x70654472, 0x00006874, 0x00060006, 0x00000014, 0x00000007, 0x61656c43, 0x74744172,
-    0x00000072, 0x00060006, 0x00000014, 0x00000008, 0x4f676f46, 0x65736666, 0x00000074, 0x00060006,
-    0x00000014, 0x00000009, 0x53676f46, 0x74666968, 0x00000000, 0x00060006, 0x00000014, 0x0000000a,
-    0x43676f46, 0x726f6c6f, 0x00000000, 0x00080006, 0x00000014, 0x0000000b, 0x61656c43, 0x74694272,
-    0x4f70616d, 0x65736666, 0x00000074, 0x00030005, 0x00000016, 0x00000000, 0x00060005, 0x00000029,
-    0x526e6942, 0x6c757365, 0x66754274, 0x00726566, 0x00080006, 0x00000029, 0x00000000, 0x69726156,
-    0x57746e61, 0x436b726f, 0x746e756f, 0x00000000, 0x00080006, 0x00000029, 0x00000001, 0x74726f53,
-    0x6f576465, 0x664f6b72, 0x74657366, 0x00000000, 0x00090006, 0x00000029, 0x00000002, 0x69726156,
-    0x57746e61, 0x526b726f, 0x436c6165, 0x746e756f, 0x00000000, 0x00080006, 0x00000029, 0x00000003,
-    0x74726f53, 0x6b726f57, 0x6b726f57, 0x6e756f43, 0x00000074, 0x00090006, 0x00000029, 0x00000004,
-    0x6e6e6942, 0x4d676e69, 0x416b7361, 0x664f646e, 0x74657366, 0x00000000, 0x00030005, 0x0000002b,
-    0x00000000, 0x00050005, 0x00000045, 0x6c616572, 0x6e756f43, 0x00000074, 0x00050005, 0x0000005c,
-    0x65726353, 0x69576e65, 0x00687464, 0x00060005, 0x0000005d, 0x65726353, 0x65486e65, 0x74686769,
-    0x00000000, 0x00060005, 0x0000005e, 0x5778614d, 0x546b726f, 0x73656c69, 0x00000000, 0x00070005,
-    0x00000062, 0x6d617246, 0x66756265, 0x53726566, 0x64697274, 0x00000065, 0x00060005, 0x00000064,
-    0x656c6954, 0x72655073, 0x656e694c, 0x00000000, 0x00050005, 0x00000065, 0x656c6954, 0x656e694c,
-    0x00000073, 0x00060005, 0x00000068, 0x68737550, 0x736e6f43, 0x746e6174, 0x00000073, 0x00060006,
-    0x00000068, 0x00000000, 0x56727543, 0x61697261, 0x0000746e, 0x00060006, 0x00000068, 0x00000001,
-    0x57786554, 0x68746469, 0x00000000, 0x00060006, 0x00000068, 0x00000002, 0x48786554, 0x68676965,
-    0x00000074, 0x00060006, 0x00000068, 0x00000003, 0x57786554, 0x53706172, 0x00000000, 0x00060006,
-    0x00000068, 0x00000004, 0x57786554, 0x54706172, 0x00000000, 0x00070006, 0x00000068, 0x00000005,
-    0x49786554, 0x70614373, 0x65727574, 0x00000000, 0x00070006, 0x00000068, 0x00000006, 0x74706143,
-    0x59657275, 0x7366664f, 0x00007465, 0x00050006, 0x00000068, 0x00000007, 0x6461705f, 0x00000000,
-    0x00030005, 0x0000006a, 0x00006370, 0x00070005, 0x0000006d, 0x6e6e6942, 0x4d676e69, 0x536b7361,
-    0x74726174, 0x00000000, 0x00080005, 0x00000070, 0x6e6e6942, 0x57676e69, 0x4f6b726f, 0x65736666,
-    0x74537374, 0x00747261, 0x00040047, 0x00000009, 0x0000000b, 0x0000001c, 0x00040047, 0x00000011,
-    0x00000006, 0x00000010, 0x00050048, 0x00000014, 0x00000000, 0x00000023, 0x00000000, 0x00050048,
-    0x00000014, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x00000014, 0x00000002, 0x00000023,
-    0x00000008, 0x00050048, 0x00000014, 0x00000003, 0x00000023, 0x0000000c, 0x00050048, 0x00000014,
-    0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x00000014, 0x00000005, 0x00000023, 0x00000230,
-    0x00050048, 0x00000014, 0x00000006, 0x00000023, 0x00000234, 0x00050048, 0x00000014, 0x00000007,
-    0x00000023, 0x00000238, 0x00050048, 0x00000014, 0x00000008, 0x00000023, 0x0000023c, 0x00050048,
-    0x00000014, 0x00000009, 0x00000023, 0x00000240, 0x00050048, 0x00000014, 0x0000000a, 0x00000023,
-    0x00000244, 0x00050048, 0x00000014, 0x0000000b, 0x00000023, 0x00000248, 0x00030047, 0x00000014,
-    0x00000002, 0x00040047, 0x00000016, 0x00000022, 0x00000000, 0x00040047, 0x00000016, 0x00000021,
-    0x00000000, 0x00040047, 0x00000025, 0x00000006, 0x00000010, 0x00040047, 0x00000026, 0x00000006,
-    0x00000004, 0x00040047, 0x00000027, 0x00000006, 0x00000004, 0x00040047, 0x00000028, 0x00000006,
-    0x00000004, 0x00050048, 0x00000029, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000029,
-    0x00000001, 0x00000023, 0x00008000, 0x00050048, 0x00000029, 0x00000002, 0x00000023, 0x0000a000,
-    0x00050048, 0x00000029, 0x00000003, 0x00000023, 0x0000c000, 0x00050048, 0x00000029, 0x00000004,
-    0x00000023, 0x0000c010, 0x00030047, 0x00000029, 0x00000002, 0x00040047, 0x0000002b, 0x00000022,
-    0x00000000, 0x00040047, 0x0000002b, 0x00000021, 0x00000008, 0x00040047, 0x0000005c, 0x00000001,
-    0x00000000, 0x00040047, 0x0000005d, 0x00000001, 0x00000001, 0x00040047, 0x0000005e, 0x00000001,
-    0x00000002, 0x00050048, 0x00000068, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000068,
-    0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x00000068, 0x00000002, 0x00000023, 0x00000008,
-    0x00050048, 0x00000068, 0x00000003, 0x00000023, 0x0000000c, 0x00050048, 0x00000068, 0x00000004,
-    0x00000023, 0x00000010, 0x00050048, 0x00000068, 0x00000005, 0x00000023, 0x00000014, 0x00050048,
-    0x00000068, 0x00000006, 0x00000023, 0x00000018, 0x00050048, 0x00000068, 0x00000007, 0x00000023,
-    0x0000001c, 0x00030047, 0x00000068, 0x00000002, 0x00040047, 0x00000071, 0x0000000b, 0x00000019,
-    0x00020013, 0x00000002, 0x00030021, 0x00000003, 0x00000002, 0x00040015, 0x00000006, 0x00000020,
-    0x00000000, 0x00040017, 0x00000007, 0x00000006, 0x00000003, 0x00040020, 0x00000008, 0x00000001,
-    0x00000007, 0x0004003b, 0x00000008, 0x00000009, 0x00000001, 0x0004002b, 0x00000006, 0x0000000a,
-    0x00000000, 0x00040020, 0x0000000b, 0x00000001, 0x00000006, 0x00040015, 0x0000000e, 0x00000020,
-    0x00000001, 0x00040017, 0x0000000f, 0x00000006, 0x00000004, 0x0004002b, 0x00000006, 0x00000010,
-    0x00000022, 0x0004001c, 0x00000011, 0x0000000f, 0x00000010, 0x00030016, 0x00000012, 0x00000020,
-    0x00040017, 0x00000013, 0x00000012, 0x00000002, 0x000e001e, 0x00000014, 0x00000006, 0x00000006,
-    0x0000000e, 0x00000006, 0x00000011, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000013, 0x00040020, 0x00000015, 0x00000002, 0x00000014, 0x0004003b, 0x00000015,
-    0x00000016, 0x00000002, 0x0004002b, 0x0000000e, 0x00000017, 0x00000001, 0x00040020, 0x00000018,
-    0x00000002, 0x00000006, 0x00020014, 0x0000001b, 0x0004002b, 0x00000006, 0x00000024, 0x00000800,
-    0x0004001c, 0x00000025, 0x0000000f, 0x00000024, 0x0004001c, 0x00000026, 0x00000006, 0x00000024,
-    0x0004001c, 0x00000027, 0x00000006, 0x00000024, 0x0003001d, 0x00000028, 0x00000006, 0x0007001e,
-    0x00000029, 0x00000025, 0x00000026, 0x00000027, 0x0000000f, 0x00000028, 0x00040020, 0x0000002a,
-    0x0000000c, 0x00000029, 0x0004003b, 0x0000002a, 0x0000002b, 0x0000000c, 0x0004002b, 0x0000000e,
-    0x0000002c, 0x00000003, 0x0004002b, 0x0000000e, 0x0000002d, 0x00000000, 0x0004002b, 0x00000006,
-    0x0000002e, 0x00000003, 0x00040020, 0x0000002f, 0x0000000c, 0x00000006, 0x0004002b, 0x00000006,
-    0x00000032, 0x0000001f, 0x0004002b, 0x00000006, 0x00000034, 0x00000020, 0x0004002b, 0x00000006,
-    0x00000036, 0x00000001, 0x00040020, 0x00000038, 0x0000000c, 0x0000000f, 0x0004002b, 0x00000006,
-    0x0000003f, 0x00000002, 0x00040020, 0x00000044, 0x00000007, 0x00000006, 0x0004002b, 0x0000000e,
-    0x0000004a, 0x00000002, 0x0004002b, 0x00000006, 0x00000052, 0x00008000, 0x00040032, 0x0000000e,
-    0x0000005c, 0x00000100, 0x00040032, 0x0000000e, 0x0000005d, 0x000000c0, 0x00040032, 0x0000000e,
-    0x0000005e, 0x00003000, 0x0004002b, 0x0000000e, 0x0000005f, 0x00000008, 0x0004002b, 0x0000000e,
-    0x00000060, 0x00000100, 0x0004002b, 0x0000000e, 0x00000061, 0x000000c0, 0x00060034, 0x0000000e,
-    0x00000062, 0x00000084, 0x0000005c, 0x0000005d, 0x0004002b, 0x0000000e, 0x00000063, 0x00000020,
-    0x00060034, 0x0000000e, 0x00000064, 0x00000087, 0x0000005c, 0x00000063, 0x00060034, 0x0000000e,
-    0x00000065, 0x00000087, 0x0000005d, 0x00000063, 0x0004002b, 0x0000000e, 0x00000066, 0x00000040,
-    0x0004002b, 0x0000000e, 0x00000067, 0x00000800, 0x000a001e, 0x00000068, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x0000000e, 0x00000006, 0x00040020, 0x00000069,
-    0x00000009, 0x00000068, 0x0004003b, 0x00000069, 0x0000006a, 0x00000009, 0x00060034, 0x0000000e,
-    0x0000006b, 0x00000084, 0x00000064, 0x00000065, 0x00060034, 0x0000000e, 0x0000006c, 0x00000084,
-    0x0000006b, 0x0000004a, 0x00060034, 0x0000000e, 0x0000006d, 0x00000080, 0x0000002d, 0x0000006c,
-    0x00060034, 0x0000000e, 0x0000006e, 0x00000084, 0x00000064, 0x00000065, 0x00060034, 0x0000000e,
-    0x0000006f, 0x00000084, 0x0000006e, 0x00000066, 0x00060034, 0x0000000e, 0x00000070, 0x00000080,
-    0x0000006d, 0x0000006f, 0x0006002c, 0x00000007, 0x00000071, 0x00000034, 0x00000036, 0x00000036,
-    0x00050036, 0x00000002, 0x00000004, 0x00000000, 0x00000003, 0x000200f8, 0x00000005, 0x0004003b,
-    0x00000044, 0x00000045, 0x00000007, 0x00050041, 0x0000000b, 0x0000000c, 0x00000009, 0x0000000a,
-    0x0004003d, 0x00000006, 0x0000000d, 0x0000000c, 0x00050041, 0x00000018, 0x00000019, 0x00000016,
-    0x00000017, 0x0004003d, 0x00000006, 0x0000001a, 0x00000019, 0x000500b0, 0x0000001b, 0x0000001c,
-    0x0000000d, 0x0000001a, 0x000300f7, 0x0000001e, 0x00000000, 0x000400fa, 0x0000001c, 0x0000001d,
-    0x0000001e, 0x000200f8, 0x0000001d, 0x00050041, 0x0000000b, 0x0000001f, 0x00000009, 0x0000000a,
-    0x0004003d, 0x00000006, 0x00000020, 0x0000001f, 0x000500aa, 0x0000001b, 0x00000021, 0x00000020,
-    0x0000000a, 0x000300f7, 0x00000023, 0x00000000, 0x000400fa, 0x00000021, 0x00000022, 0x00000023,
-    0x000200f8, 0x00000022, 0x00070041, 0x0000002f, 0x00000030, 0x0000002b, 0x0000002d, 0x0000002d,
-    0x0000002e, 0x0004003d, 0x00000006, 0x00000031, 0x00000030, 0x00050080, 0x00000006, 0x00000033,
-    0x00000031, 0x00000032, 0x00050086, 0x00000006, 0x00000035, 0x00000033, 0x00000034, 0x00070050,
-    0x0000000f, 0x00000037, 0x00000035, 0x00000036, 0x00000036, 0x0000000a, 0x00050041, 0x00000038,
-    0x00000039, 0x0000002b, 0x0000002c, 0x0003003e, 0x00000039, 0x00000037, 0x000200f9, 0x00000023,
-    0x000200f8, 0x00000023, 0x00050041, 0x0000000b, 0x0000003a, 0x00000009, 0x0000000a, 0x0004003d,
-    0x00000006, 0x0000003b, 0x0000003a, 0x00070041, 0x0000002f, 0x0000003c, 0x0000002b, 0x0000002d,
-    0x00000017, 0x0000002e, 0x00050041, 0x0000000b, 0x0000003d, 0x00000009, 0x0000000a, 0x0004003d,
-    0x00000006, 0x0000003e, 0x0000003d, 0x00070041, 0x0000002f, 0x00000040, 0x0000002b, 0x0000002d,
-    0x0000003e, 0x0000003f, 0x0004003d, 0x00000006, 0x00000041, 0x00000040, 0x000700ea, 0x00000006,
-    0x00000042, 0x0000003c, 0x00000036, 0x0000000a, 0x00000041, 0x00060041, 0x0000002f, 0x00000043,
-    0x0000002b, 0x00000017, 0x0000003b, 0x0003003e, 0x00000043, 0x00000042, 0x00050041, 0x0000000b,
-    0x00000046, 0x00000009, 0x0000000a, 0x0004003d, 0x00000006, 0x00000047, 0x00000046, 0x00070041,
-    0x0000002f, 0x00000048, 0x0000002b, 0x0000002d, 0x00000047, 0x0000003f, 0x0004003d, 0x00000006,
-    0x00000049, 0x00000048, 0x0003003e, 0x00000045, 0x00000049, 0x00050041, 0x0000000b, 0x0000004b,
-    0x00000009, 0x0000000a, 0x0004003d, 0x00000006, 0x0000004c, 0x0000004b, 0x0004003d, 0x00000006,
-    0x0000004d, 0x00000045, 0x00060041, 0x0000002f, 0x0000004e, 0x0000002b, 0x0000004a, 0x0000004c,
-    0x0003003e, 0x0000004e, 0x0000004d, 0x00050041, 0x0000000b, 0x0000004f, 0x00000009, 0x0000000a,
-    0x0004003d, 0x00000006, 0x00000050, 0x0000004f, 0x0004003d, 0x00000006, 0x00000051, 0x00000045,
-    0x00050080, 0x00000006, 0x00000053, 0x00000051, 0x00000052, 0x00050082, 0x00000006, 0x00000054,
-    0x00000053, 0x00000036, 0x00050086, 0x00000006, 0x00000055, 0x00000054, 0x00000052, 0x00070041,
-    0x0000002f, 0x00000056, 0x0000002b, 0x0000002d, 0x00000050, 0x00000036, 0x0003003e, 0x00000056,
-    0x00000055, 0x00050041, 0x0000000b, 0x00000057, 0x00000009, 0x0000000a, 0x0004003d, 0x00000006,
-    0x00000058, 0x00000057, 0x0004003d, 0x00000006, 0x00000059, 0x00000045, 0x0007000c, 0x00000006,
-    0x0000005a, 0x00000001, 0x00000026, 0x00000059, 0x00000052, 0x00070041, 0x0000002f, 0x0000005b,
-    0x0000002b, 0x0000002d, 0x00000058, 0x0000003f, 0x0003003e, 0x0000005b, 0x0000005a, 0x000200f9,
-    0x0000001e, 0x000200f8, 0x0000001e, 0x000100fd, 0x00010038,
+const uint8_t Blob099_Data[1375] =
+{
+    0x28, 0xb5, 0x2f, 0xfd, 0x60, 0x74, 0x0f, 0xad, 0x2a, 0x00, 0x86, 0xf4, 0xb8, 0x3f, 0xf0, 0xd4,
+    0xe6, 0xe8, 0xf0, 0x0c, 0xdc, 0x26, 0xb2, 0x89, 0x6c, 0x42, 0x32, 0xb0, 0x91, 0xb4, 0xcc, 0x7c,
+    0x22, 0x9b, 0x48, 0xe1, 0x8c, 0x14, 0xbc, 0xc9, 0x5b, 0xbb, 0x6d, 0x2e, 0xf6, 0x43, 0xeb, 0xe0,
+    0x07, 0x4f, 0xdd, 0x40, 0x30, 0x0e, 0xd7, 0x71, 0x04, 0xb7, 0xa4, 0x2b, 0x4f, 0xa2, 0x06, 0xf1,
+    0xcc, 0xc4, 0x53, 0x23, 0x70, 0x27, 0xc7, 0x7a, 0x69, 0x69, 0x69, 0x93, 0x14, 0x9c, 0x00, 0x9d,
+    0x00, 0xaa, 0x00, 0xc3, 0x99, 0xa6, 0x87, 0xdf, 0xe7, 0x5b, 0x7d, 0xc7, 0x38, 0x54, 0xfd, 0x7f,
+    0x24, 0x0f, 0xba, 0x70, 0x2d, 0xd7, 0xce, 0x3e, 0xbb, 0xb1, 0xed, 0xc6, 0xbc, 0xf9, 0x7f, 0xcf,
+    0x74, 0xf2, 0x47, 0xa6, 0x81, 0xca, 0xa5, 0xcb, 0xaf, 0xbf, 0xbe, 0xd2, 0xa6, 0x91, 0xf1, 0x0c,
+    0xe3, 0x76, 0xee, 0x2b, 0x50, 0x71, 0xbc, 0x99, 0x8e, 0xbb, 0x7b, 0xa4, 0x7b, 0x66, 0x9e, 0xec,
+    0x1a, 0x69, 0x59, 0x57, 0x94, 0x93, 0xed, 0xa7, 0xaf, 0xbe, 0x4b, 0xf9, 0x38, 0xc7, 0xed, 0xf3,
+    0x9e, 0xb8, 0x1f, 0xb9, 0x1d, 0xbf, 0x45, 0x3e, 0xc7, 0x72, 0x91, 0xcb, 0x3f, 0xfd, 0x2e, 0xd6,
+    0xf5, 0xb1, 0x98, 0xeb, 0xe9, 0x7e, 0x3f, 0x5d, 0x31, 0xf5, 0xe9, 0xbf, 0x99, 0xf4, 0xff, 0x27,
+    0x6a, 0xc2, 0x04, 0xd2, 0x16, 0xea, 0xff, 0x7f, 0x8e, 0x5d, 0xe5, 0xff, 0xa7, 0x2a, 0xeb, 0xff,
+    0x1f, 0xfd, 0xd5, 0xff, 0x3f, 0x07, 0xc8, 0x4c, 0xe3, 0xed, 0xb7, 0x46, 0x4f, 0xd8, 0xd3, 0xad,
+    0xff, 0xe6, 0x9f, 0x2f, 0xf0, 0xf6, 0xb7, 0xaf, 0x7a, 0x13, 0x7d, 0x36, 0xe2, 0x44, 0x03, 0xb5,
+    0x7b, 0xbb, 0x79, 0x2a, 0x3b, 0x4c, 0x5f, 0x58, 0xbb, 0x36, 0x7a, 0xbe, 0x0f, 0x37, 0xed, 0xe5,
+    0x7f, 0xbf, 0xc1, 0xf7, 0x12, 0x08, 0xdf, 0xfc, 0x7b, 0x36, 0x07, 0xbe, 0xfc, 0x8d, 0xed, 0x2e,
+    0x34, 0x72, 0xa5, 0x6b, 0xaf, 0x18, 0x9f, 0xbd, 0xb9, 0x1c, 0x0f, 0x7d, 0x5c, 0x1f, 0xce, 0x77,
+    0x38, 0x19, 0xf3, 0x1d, 0x11, 0xee, 0x6f, 0x2c, 0x33, 0x73, 0x6e, 0x1f, 0x6f, 0x54, 0x3b, 0xf7,
+    0xb2, 0xff, 0x77, 0xae, 0xed, 0xdc, 0xae, 0x2f, 0x39, 0xc7, 0x73, 0x8a, 0xca, 0x2e, 0x0f, 0x9e,
+    0xa8, 0x97, 0x77, 0x9b, 0x16, 0xfe, 0xff, 0xf7, 0x79, 0x49, 0xdf, 0x76, 0x6c, 0x5a, 0x26, 0x66,
+    0x73, 0x24, 0x72, 0x69, 0xeb, 0xf2, 0xf2, 0xe6, 0xc1, 0x39, 0xb6, 0xc5, 0x7e, 0xfd, 0xff, 0x3f,
+    0x78, 0xf4, 0x6b, 0x57, 0xd9, 0x63, 0x9b, 0xaa, 0xfd, 0xd4, 0x77, 0x64, 0x0c, 0x0b, 0x51, 0x9d,
+    0xdf, 0x48, 0xe4, 0x2f, 0x49, 0xaf, 0xb4, 0x6f, 0xf7, 0x5e, 0x63, 0xe1, 0x5e, 0x73, 0xdc, 0x6a,
+    0xd3, 0x32, 0x7d, 0xb3, 0x5d, 0x2e, 0xdf, 0xfe, 0x9f, 0xcb, 0x46, 0x37, 0x2c, 0x2b, 0x8b, 0x3b,
+    0x53, 0x58, 0x23, 0x21, 0xb0, 0x99, 0x83, 0xc7, 0xba, 0xa1, 0xb1, 0x7e, 0x06, 0x8a, 0xf1, 0x17,
+    0xb1, 0x0b, 0x0b, 0xd6, 0x3f, 0xc5, 0x04, 0xfb, 0xe8, 0x37, 0x54, 0xac, 0x14, 0x12, 0x13, 0xdf,
+    0xbe, 0xc4, 0xc2, 0x9f, 0x2b, 0x02, 0xcc, 0x25, 0x3b, 0xa0, 0x9d, 0x06, 0x04, 0x02, 0xab, 0x5f,
+    0xfd, 0x6b, 0x80, 0x00, 0x36, 0x70, 0xc0, 0x62, 0x68, 0xa5, 0x2c, 0x73, 0xb5, 0xaa, 0x60, 0x29,
+    0x19, 0x8a, 0x66, 0xa6, 0x28, 0xeb, 0x7a, 0xd8, 0x6a, 0x80, 0x3e, 0x7a, 0x12, 0x24, 0xf0, 0xa0,
+    0x8f, 0xf0, 0x5f, 0x00, 0xc3, 0x30, 0x0c, 0xc3, 0x27, 0x8e, 0x49, 0xfc, 0x9b, 0x56, 0x26, 0x8b,
+    0x7d, 0x2b, 0x45, 0x42, 0x8b, 0x4e, 0x20, 0xf3, 0x3f, 0x66, 0x51, 0x91, 0x52, 0x4c, 0x3c, 0x3c,
+    0xc4, 0xc1, 0x89, 0xbe, 0x6e, 0xa7, 0xc2, 0xa5, 0x54, 0x50, 0x26, 0xed, 0x08, 0x3b, 0x5b, 0x4f,
+    0x0e, 0xb5, 0x95, 0x02, 0xa0, 0xed, 0x99, 0x9a, 0x1f, 0xf1, 0xbb, 0x96, 0xc0, 0x3f, 0x03, 0x4a,
+    0x77, 0xd7, 0xdf, 0x6d, 0xb7, 0x0b, 0x95, 0x7f, 0xac, 0x75, 0xfe, 0x75, 0xeb, 0x22, 0xab, 0xd2,
+    0xfc, 0xff, 0xfa, 0xdc, 0x5e, 0xf6, 0x6f, 0xfe, 0xc8, 0x9b, 0xff, 0xf4, 0x7a, 0xd5, 0xd8, 0xa4,
+    0xcc, 0xd8, 0x04, 0x29, 0xcc, 0x1a, 0x00, 0x1a, 0x99, 0x19, 0x19, 0x98, 0x98, 0x10, 0x60, 0x4c,
+    0x10, 0x26, 0x64, 0x18, 0x14, 0x14, 0xe6, 0x5e, 0x7e, 0xc0, 0x9f, 0xcf, 0xa5, 0xc7, 0xe2, 0x92,
+    0xf3, 0xb5, 0xf4, 0x5a, 0x78, 0xb9, 0x1d, 0x4f, 0xb7, 0x5b, 0xd1, 0xad, 0xd8, 0x6e, 0x34, 0xd7,
+    0x6d, 0x7d, 0xdb, 0xaa, 0x54, 0x4b, 0x41, 0x51, 0x39, 0x41, 0x39, 0x71, 0x99, 0x94, 0xd0, 0x4a,
+    0xfe, 0xff, 0xcf, 0x6f, 0x22, 0x41, 0xc1, 0x20, 0x19, 0x49, 0xbd, 0x08, 0x0b, 0x38, 0x03, 0x19,
+    0xf2, 0xf8, 0x58, 0x81, 0x3a, 0x34, 0x32, 0x38, 0x58, 0x88, 0x08, 0x88, 0x87, 0x88, 0xd4, 0x83,
+    0x11, 0xcc, 0xa1, 0xe1, 0xd5, 0x90, 0xbe, 0xd3, 0x6b, 0x29, 0x80, 0x61, 0xe1, 0x48, 0xc1, 0x95,
+    0x80, 0x00, 0x10, 0x70, 0x92, 0x42, 0xa9, 0x6a, 0x39, 0x9c, 0xca, 0xf4, 0xe7, 0xab, 0x21, 0x3c,
+    0x2c, 0x86, 0xb2, 0x46, 0xce, 0xf4, 0x2c, 0x03, 0x29, 0x59, 0x76, 0x64, 0xfe, 0xee, 0xa0, 0x74,
+    0x68, 0x70, 0xbc, 0xae, 0xe0, 0x57, 0x52, 0x05, 0x49, 0xe4, 0x47, 0xa2, 0x17, 0x76, 0x24, 0x0a,
+    0x19, 0xd7, 0x9f, 0xb9, 0xb2, 0x9c, 0xb6, 0xc8, 0x81, 0x43, 0x34, 0xff, 0xc6, 0x23, 0x78, 0x06,
+    0x81, 0xeb, 0xa8, 0x51, 0xb8, 0x32, 0x22, 0xa2, 0x20, 0x49, 0x92, 0x4a, 0x6b, 0xe1, 0x1d, 0x21,
+    0x4e, 0x99, 0xf1, 0x31, 0x89, 0x33, 0x9c, 0x48, 0xa9, 0x82, 0x14, 0x14, 0x66, 0x99, 0x03, 0x18,
+    0x9c, 0x42, 0x95, 0x75, 0xee, 0xe8, 0x0f, 0x67, 0xc3, 0x09, 0xca, 0x45, 0xa3, 0x36, 0x20, 0xb4,
+    0x03, 0x29, 0x3a, 0x43, 0xc8, 0x1e, 0x6e, 0x27, 0xfc, 0xc2, 0x70, 0x46, 0x48, 0x61, 0x88, 0x79,
+    0x03, 0x72, 0xcc, 0x3a, 0x45, 0x7f, 0xd5, 0x3a, 0x93, 0x08, 0xe3, 0x84, 0xc8, 0x31, 0x50, 0x72,
+    0x31, 0x73, 0xd4, 0x6d, 0xcf, 0x39, 0xae, 0xda, 0x50, 0x3e, 0xd1, 0xcb, 0x57, 0x13, 0x06, 0xc4,
+    0x42, 0x47, 0x5e, 0xac, 0xe4, 0x1f, 0x2b, 0xdc, 0x51, 0x63, 0x2a, 0x2b, 0xfe, 0xe7, 0xbc, 0xae,
+    0xa7, 0x50, 0x77, 0x0e, 0xc5, 0xae, 0xe5, 0x56, 0x16, 0x3d, 0x39, 0xd5, 0xa1, 0x71, 0x96, 0x1c,
+    0x39, 0xad, 0x76, 0x2c, 0xc8, 0x18, 0x46, 0xfe, 0xc3, 0xbf, 0xaa, 0xad, 0x42, 0x83, 0x6e, 0x22,
+    0xef, 0xfb, 0xcd, 0xa1, 0xdd, 0x17, 0xc0, 0xcf, 0xb3, 0x48, 0xbb, 0xcf, 0x9e, 0x1f, 0x78, 0xe0,
+    0x11, 0x47, 0xd8, 0xbc, 0x36, 0x0c, 0x75, 0x65, 0x94, 0xf7, 0x86, 0x90, 0xdb, 0x2b, 0xf0, 0xf1,
+    0x13, 0x84, 0x59, 0xce, 0x82, 0x78, 0x8b, 0x0b, 0x44, 0xb9, 0xe0, 0x19, 0x75, 0xb9, 0xc0, 0x0e,
+    0x8f, 0x06, 0x71, 0x4d, 0x66, 0x57, 0x09, 0x33, 0x22, 0x96, 0x47, 0x54, 0xc6, 0xda, 0x84, 0xf2,
+    0x0c, 0x04, 0x06, 0x26, 0xa9, 0xb5, 0xe9, 0x16, 0xb5, 0x77, 0x6e, 0xbd, 0x38, 0xd9, 0xa4, 0xa1,
+    0x3e, 0xf6, 0xc9, 0x04, 0xc7, 0xac, 0xc1, 0xe6, 0xd9, 0xde, 0x7c, 0xf4, 0xf1, 0x3e, 0x76, 0x7f,
+    0x22, 0xcc, 0x0d, 0x36, 0x83, 0xd9, 0x89, 0x41, 0x81, 0xcf, 0x37, 0x48, 0x3f, 0xff, 0xf5, 0xad,
+    0xb4, 0xa1, 0x88, 0xf7, 0x0e, 0x73, 0x9c, 0x75, 0x67, 0xbc, 0x06, 0xfe, 0xba, 0x15, 0xa3, 0x6f,
+    0x91, 0x95, 0xf8, 0x78, 0x0b, 0x47, 0xac, 0x67, 0x40, 0x33, 0x61, 0xff, 0xf0, 0x6e, 0xfe, 0x45,
+    0xca, 0x9b, 0xb8, 0xb3, 0x71, 0xbf, 0xee, 0x7b, 0xda, 0x88, 0xcb, 0x1b, 0xf3, 0x43, 0x64, 0xa6,
+    0xfa, 0xf7, 0xde, 0xcf, 0xd8, 0x44, 0x2d, 0x3d, 0xa6, 0x9d, 0x7a, 0xbf, 0xab, 0x37, 0x5a, 0xbf,
+    0xf2, 0x0c, 0x86, 0xab, 0x67, 0x54, 0xff, 0xb5, 0x58, 0x73, 0xdd, 0x47, 0x16, 0xfa, 0xf2, 0x50,
+    0x56, 0x73, 0x76, 0xef, 0x93, 0xf8, 0x97, 0x2b, 0xcf, 0xc6, 0x04, 0x80, 0x93, 0xdd, 0x09, 0x5a,
+    0x2a, 0xed, 0xf4, 0xa1, 0x92, 0xa1, 0xe4, 0x25, 0x5e, 0x0d, 0xda, 0xfe, 0xaf, 0xfe, 0x58, 0xd3,
+    0x6a, 0x0a, 0x2c, 0x75, 0xa2, 0x79, 0x34, 0x5f, 0x1c, 0x71, 0x80, 0x65, 0x9e, 0x13, 0x63, 0x43,
+    0x2f, 0xfd, 0x50, 0x38, 0x3f, 0x8c, 0x5c, 0xa5, 0x30, 0xfa, 0xf7, 0xff, 0xfe, 0xd8, 0x79, 0x31,
+    0xfb, 0xff, 0xde, 0x3b, 0x99, 0xe1, 0x37, 0x13, 0x95, 0x05, 0xf2, 0x4c, 0xf7, 0x8b, 0x9a, 0x92,
+    0xcd, 0x90, 0x0f, 0x0e, 0x7d, 0xe0, 0xdb, 0xf2, 0x3a, 0x81, 0xb7, 0x1e, 0xed, 0xcc, 0x11, 0xdb,
+    0xa2, 0x02, 0x92, 0xbe, 0x3c, 0xef, 0x53, 0x23, 0xfa, 0xc5, 0x8c, 0x8e, 0x0f, 0xbe, 0x44, 0xcc,
+    0xa1, 0x06, 0x10, 0x5d, 0x8c, 0x96, 0x0d, 0x20, 0xce, 0x97, 0x58, 0xaa, 0x02, 0x32, 0x03, 0x9e,
+    0x75, 0x93, 0x4b, 0xab, 0x42, 0x85, 0x81, 0xe9, 0xbc, 0x47, 0x49, 0x5e, 0xdd, 0xe9, 0x1e, 0x18,
+    0xf7, 0xca, 0x06, 0xa5, 0x15, 0x6e, 0x26, 0x7e, 0x24, 0x1c, 0x60, 0x5f, 0xf4, 0xa2, 0x02, 0xe8,
+    0xa1, 0x7c, 0x98, 0xe2, 0x6e, 0xb8, 0x3b, 0x1e, 0xc7, 0xb0, 0x80, 0xd6, 0x29, 0x63, 0x07, 0xcb,
+    0xe7, 0x55, 0xaf, 0x51, 0x8d, 0x34, 0xab, 0x12, 0xd0, 0x4a, 0x20, 0xa1, 0x78, 0xde, 0x61, 0xbe,
+    0x21, 0xde, 0x3f, 0xa8, 0x66, 0x46, 0x17, 0x08, 0x62, 0x53, 0x03, 0x37, 0x48, 0x07, 0x66, 0x3c,
+    0xf4, 0xef, 0x28, 0xbd, 0x04, 0x9d, 0x5e, 0xb5, 0xca, 0x54, 0xb4, 0x31, 0x48, 0x80, 0xc9, 0x31,
+    0x2c, 0x90, 0x30, 0xc7, 0x72, 0x73, 0xa2, 0x3d, 0x2f, 0xda, 0x3e, 0x0f, 0x39, 0xdc, 0xdd, 0xa9,
+    0xb5, 0x3c, 0x1d, 0x79, 0xf5, 0x97, 0x74, 0xfa, 0xbe, 0xd2, 0x0a, 0xbf, 0x49, 0x79, 0xd3, 0x2e,
+    0x1f, 0x8e, 0xd3, 0xca, 0xa0, 0x79, 0x88, 0x68, 0x2d, 0xe5, 0x92, 0xab, 0xcf, 0x44, 0x21, 0x47,
+    0x2a, 0xcf, 0x32, 0x58, 0xf4, 0x28, 0x8b, 0xef, 0xd0, 0x28, 0x73, 0xf5, 0xe9, 0xb1, 0x69,
 };
+const ShaderModule Blob099 = { Blob099_Data, 1375u, 1053u, 99u };
 
 } // namespace detail
 } // namespace VulkanShaders
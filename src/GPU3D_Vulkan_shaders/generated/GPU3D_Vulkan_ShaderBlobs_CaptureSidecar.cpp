@@ -28,13 +28,12 @@
     Pipeline indices match ComputeRenderer3D::ShaderCompileStep() in
     src/GPU3D_Compute.cpp one for one.
 
-    The SPIR-V words live in per-stage translation units rather than in the
-    header so that including the public header stays cheap: the full module set
-    is a few megabytes of integer literals and would otherwise be re-parsed by
-    every consumer.
+    Every module is one zstd frame, inflated on first use by
+    Vk::InflateShaderModule(). The frames live in per-stage translation units
+    rather than in the header so that including the public header stays cheap.
 */
 
-// SPIR-V for src/GPU3D_Vulkan_shaders/CaptureSidecar.comp.
+// SPIR-V for src/GPU3D_Vulkan_shaders/CaptureSidecar.comp, one zstd frame per module.
 
 #include "GPU3D_Vulkan_ShaderBlobs.h"
 
@@ -45,2462 +44,1264 @@ namespace VulkanShaders
 namespace detail
 {
 
-extern const uint32_t Blob034[6515];
-const uint32_t Blob034[6515] = {
-    0x07230203, 0x00010300, 0x0008000b, 0x0000042c, 0x00000000, 0x00020011, 0x00000001, 0x0006000b,
-    0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001,
-    0x0006000f, 0x00000005, 0x00000004, 0x6e69616d, 0x00000000, 0x000002b4, 0x00060010, 0x00000004,
-    0x00000011, 0x00000008, 0x00000008, 0x00000001, 0x00030003, 0x00000002, 0x000001c2, 0x000a0004,
-    0x475f4c47, 0x4c474f4f, 0x70635f45, 0x74735f70, 0x5f656c79, 0x656e696c, 0x7269645f, 0x69746365,
-    0x00006576, 0x00080004, 0x475f4c47, 0x4c474f4f, 0x6e695f45, 0x64756c63, 0x69645f65, 0x74636572,
-    0x00657669, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000, 0x00070005, 0x0000000a, 0x726f6e55,
-    0x6f54386d, 0x36626752, 0x3b317528, 0x00000000, 0x00040005, 0x00000009, 0x756c6176, 0x00000065,
-    0x00070005, 0x0000000d, 0x726f6e55, 0x6f54386d, 0x68706c41, 0x75283561, 0x00003b31, 0x00040005,
-    0x0000000c, 0x756c6176, 0x00000065, 0x00070005, 0x00000014, 0x64616f4c, 0x616e6946, 0x2842466c,
-    0x3b326976, 0x00000000, 0x00050005, 0x00000013, 0x69736f70, 0x6e6f6974, 0x00000000, 0x00050005,
-    0x00000017, 0x6f6c6f43, 0x28523672, 0x003b3175, 0x00040005, 0x00000016, 0x6f6c6f63, 0x00000072,
-    0x00050005, 0x0000001a, 0x6f6c6f43, 0x28473672, 0x003b3175, 0x00040005, 0x00000019, 0x6f6c6f63,
-    0x00000072, 0x00050005, 0x0000001d, 0x6f6c6f43, 0x28423672, 0x003b3175, 0x00040005, 0x0000001c,
-    0x6f6c6f63, 0x00000072, 0x00080005, 0x00000024, 0x6b636150, 0x6f6c6f43, 0x75283672, 0x31753b31,
-    0x3b31753b, 0x003b3175, 0x00030005, 0x00000020, 0x00000072, 0x00030005, 0x00000021, 0x00000067,
-    0x00030005, 0x00000022, 0x00000062, 0x00040005, 0x00000023, 0x68706c61, 0x00000061, 0x00070005,
-    0x0000002a, 0x6e656c42, 0x75283464, 0x31753b31, 0x3b31753b, 0x003b3175, 0x00040005, 0x00000026,
-    0x73726966, 0x00000074, 0x00040005, 0x00000027, 0x6f636573, 0x0000646e, 0x00030005, 0x00000028,
-    0x00617665, 0x00030005, 0x00000029, 0x00627665, 0x00060005, 0x0000002f, 0x6e656c42, 0x75283564,
-    0x31753b31, 0x0000003b, 0x00040005, 0x0000002d, 0x73726966, 0x00000074, 0x00040005, 0x0000002e,
-    0x6f636573, 0x0000646e, 0x00080005, 0x00000035, 0x67697242, 0x656e7468, 0x70557373, 0x3b317528,
-    0x753b3175, 0x00003b31, 0x00040005, 0x00000032, 0x6f6c6f63, 0x00000072, 0x00040005, 0x00000033,
-    0x74636166, 0x0000726f, 0x00040005, 0x00000034, 0x73616962, 0x00000000, 0x00090005, 0x0000003a,
-    0x67697242, 0x656e7468, 0x6f447373, 0x75286e77, 0x31753b31, 0x3b31753b, 0x00000000, 0x00040005,
-    0x00000037, 0x6f6c6f63, 0x00000072, 0x00040005, 0x00000038, 0x74636166, 0x0000726f, 0x00040005,
-    0x00000039, 0x73616962, 0x00000000, 0x00090005, 0x00000041, 0x64616f4c, 0x74706143, 0x53657275,
-    0x63656469, 0x75287261, 0x75763b31, 0x00003b32, 0x00050005, 0x0000003f, 0x65666572, 0x636e6572,
-    0x00000065, 0x00070005, 0x00000040, 0x6c616373, 0x69576465, 0x6e696874, 0x65786950, 0x0000006c,
-    0x00090005, 0x00000046, 0x64616f4c, 0x74706143, 0x53657275, 0x6372756f, 0x28443365, 0x3b327576,
-    0x003b3175, 0x00050005, 0x00000044, 0x69736f70, 0x6e6f6974, 0x00000000, 0x00050005, 0x00000045,
-    0x656e696c, 0x6174654d, 0x00000000, 0x000a0005, 0x00000050, 0x706d6f43, 0x5365736f, 0x6372756f,
-    0x75284165, 0x75763b31, 0x31753b32, 0x3b31753b, 0x003b3162, 0x00040005, 0x0000004b, 0x65726373,
-    0x00006e65, 0x00030005, 0x0000004c, 0x00006469, 0x00050005, 0x0000004d, 0x6974616e, 0x6e496576,
-    0x00786564, 0x00050005, 0x0000004e, 0x656e696c, 0x6174654d, 0x00000000, 0x00060005, 0x0000004f,
-    0x72756f73, 0x44336563, 0x696c6156, 0x00000064, 0x00090005, 0x00000053, 0x6d726f4e, 0x7a696c61,
-    0x70614365, 0x65727574, 0x78695064, 0x75286c65, 0x00003b31, 0x00040005, 0x00000052, 0x6f6c6f63,
-    0x00000072, 0x00040005, 0x00000068, 0x65786574, 0x0000006c, 0x00040005, 0x0000006b, 0x616e6946,
-    0x0042466c, 0x00050005, 0x00000071, 0x6e617571, 0x657a6974, 0x00000064, 0x00040005, 0x00000077,
-    0x61726170, 0x0000006d, 0x00040005, 0x0000007c, 0x61726170, 0x0000006d, 0x00040005, 0x00000084,
-    0x61726170, 0x0000006d, 0x00040005, 0x0000008c, 0x61726170, 0x0000006d, 0x00040005, 0x000000b3,
-    0x61726170, 0x0000006d, 0x00040005, 0x000000b8, 0x61726170, 0x0000006d, 0x00040005, 0x000000c2,
-    0x61726170, 0x0000006d, 0x00040005, 0x000000c7, 0x61726170, 0x0000006d, 0x00040005, 0x000000cf,
-    0x61726170, 0x0000006d, 0x00040005, 0x000000d4, 0x61726170, 0x0000006d, 0x00040005, 0x000000dc,
-    0x61726170, 0x0000006d, 0x00040005, 0x000000dd, 0x61726170, 0x0000006d, 0x00040005, 0x000000de,
-    0x61726170, 0x0000006d, 0x00040005, 0x000000df, 0x61726170, 0x0000006d, 0x00030005, 0x000000e3,
-    0x00617665, 0x00030005, 0x000000e8, 0x00627665, 0x00040005, 0x000000ec, 0x61726170, 0x0000006d,
-    0x00040005, 0x000000f1, 0x61726170, 0x0000006d, 0x00040005, 0x000000fb, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000100, 0x61726170, 0x0000006d, 0x00040005, 0x00000108, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000010d, 0x61726170, 0x0000006d, 0x00040005, 0x00000115, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000116, 0x61726170, 0x0000006d, 0x00040005, 0x00000117, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000118, 0x61726170, 0x0000006d, 0x00040005, 0x0000011c, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000011f, 0x61726170, 0x0000006d, 0x00040005, 0x00000129, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000012c, 0x61726170, 0x0000006d, 0x00040005, 0x00000136, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000139, 0x61726170, 0x0000006d, 0x00040005, 0x00000143, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000144, 0x61726170, 0x0000006d, 0x00040005, 0x00000145, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000146, 0x61726170, 0x0000006d, 0x00040005, 0x0000014a, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000014d, 0x61726170, 0x0000006d, 0x00040005, 0x00000156, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000159, 0x61726170, 0x0000006d, 0x00040005, 0x00000162, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000165, 0x61726170, 0x0000006d, 0x00040005, 0x0000016e, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000016f, 0x61726170, 0x0000006d, 0x00040005, 0x00000170, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000171, 0x61726170, 0x0000006d, 0x00040005, 0x00000175, 0x72646461, 0x00737365,
-    0x00040005, 0x00000179, 0x6b6e6162, 0x00000000, 0x00040005, 0x0000017e, 0x73726576, 0x006e6f69,
-    0x00060005, 0x00000183, 0x706d6173, 0x5073656c, 0x69507265, 0x006c6578, 0x00050005, 0x00000184,
-    0x65726353, 0x69576e65, 0x00687464, 0x00050005, 0x00000186, 0x6c616353, 0x63614665, 0x00726f74,
-    0x00040005, 0x0000018a, 0x6c6c6563, 0x00000000, 0x00050005, 0x00000194, 0x706d6173, 0x6e49656c,
-    0x00786564, 0x00080005, 0x0000019d, 0x74706143, 0x53657275, 0x63656469, 0x75427261, 0x72656666,
-    0x00000000, 0x00090006, 0x0000019d, 0x00000000, 0x74706143, 0x53657275, 0x63656469, 0x69507261,
-    0x736c6578, 0x00000000, 0x00030005, 0x0000019f, 0x00000000, 0x00050005, 0x000001ab, 0x736f5078,
-    0x6f697469, 0x0000006e, 0x00040005, 0x000001b2, 0x72756f73, 0x00586563, 0x00060005, 0x000001ce,
-    0x68737550, 0x736e6f43, 0x746e6174, 0x00000073, 0x00060006, 0x000001ce, 0x00000000, 0x56727543,
-    0x61697261, 0x0000746e, 0x00060006, 0x000001ce, 0x00000001, 0x57786554, 0x68746469, 0x00000000,
-    0x00060006, 0x000001ce, 0x00000002, 0x48786554, 0x68676965, 0x00000074, 0x00060006, 0x000001ce,
-    0x00000003, 0x57786554, 0x53706172, 0x00000000, 0x00060006, 0x000001ce, 0x00000004, 0x57786554,
-    0x54706172, 0x00000000, 0x00070006, 0x000001ce, 0x00000005, 0x49786554, 0x70614373, 0x65727574,
-    0x00000000, 0x00070006, 0x000001ce, 0x00000006, 0x74706143, 0x59657275, 0x7366664f, 0x00007465,
-    0x00050006, 0x000001ce, 0x00000007, 0x6461705f, 0x00000000, 0x00030005, 0x000001d0, 0x00006370,
-    0x00040005, 0x000001e4, 0x61726170, 0x0000006d, 0x00040005, 0x000001ea, 0x65736162, 0x00000000,
-    0x00040005, 0x000001ec, 0x6f6c6562, 0x00000077, 0x00080005, 0x000001ee, 0x75727453, 0x72757463,
-    0x6e496465, 0x42747570, 0x65666675, 0x00000072, 0x00070006, 0x000001ee, 0x00000000, 0x75727453,
-    0x72757463, 0x6e496465, 0x00747570, 0x00030005, 0x000001f0, 0x00000000, 0x00040005, 0x000001f6,
-    0x766f6261, 0x00000065, 0x00040005, 0x000001fe, 0x746e6f63, 0x006c6f72, 0x00050005, 0x00000206,
-    0x65666572, 0x636e6572, 0x00000065, 0x00040005, 0x0000020e, 0x67616c66, 0x00000073, 0x00040005,
-    0x00000212, 0x6f6c6f63, 0x00000072, 0x00040005, 0x00000224, 0x61726170, 0x0000006d, 0x00040005,
-    0x00000226, 0x61726170, 0x0000006d, 0x00040005, 0x0000022b, 0x746f6c73, 0x00000000, 0x00040005,
-    0x00000235, 0x61726170, 0x0000006d, 0x00040005, 0x00000237, 0x61726170, 0x0000006d, 0x00040005,
-    0x0000023d, 0x61726170, 0x0000006d, 0x00040005, 0x0000023f, 0x61726170, 0x0000006d, 0x00040005,
-    0x0000024a, 0x65646f6d, 0x00000000, 0x00030005, 0x0000024e, 0x00617665, 0x00030005, 0x00000252,
-    0x00627665, 0x00040005, 0x00000261, 0x61726170, 0x0000006d, 0x00040005, 0x00000263, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000265, 0x61726170, 0x0000006d, 0x00040005, 0x00000267, 0x61726170,
-    0x0000006d, 0x00040005, 0x0000026f, 0x61726170, 0x0000006d, 0x00040005, 0x00000271, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000273, 0x61726170, 0x0000006d, 0x00040005, 0x0000027b, 0x61726170,
-    0x0000006d, 0x00040005, 0x0000027d, 0x61726170, 0x0000006d, 0x00040005, 0x0000027f, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000286, 0x61726170, 0x0000006d, 0x00040005, 0x00000288, 0x61726170,
-    0x0000006d, 0x00030005, 0x0000028f, 0x00000072, 0x00030005, 0x00000294, 0x00000067, 0x00030005,
-    0x0000029a, 0x00000062, 0x00030005, 0x000002a0, 0x00000061, 0x00030005, 0x000002b1, 0x00006469,
-    0x00080005, 0x000002b4, 0x475f6c67, 0x61626f6c, 0x766e496c, 0x7461636f, 0x496e6f69, 0x00000044,
-    0x00040005, 0x000002b7, 0x63746162, 0x00000068, 0x00040005, 0x000002bb, 0x6974616e, 0x00596576,
-    0x00040005, 0x000002de, 0x6c616373, 0x00596465, 0x00040005, 0x000002e5, 0x6974616e, 0x00586576,
-    0x00050005, 0x000002ea, 0x6974616e, 0x6e496576, 0x00786564, 0x00050005, 0x000002ef, 0x6d6d6f63,
-    0x42646e61, 0x00657361, 0x00050005, 0x000002f4, 0x74706163, 0x43657275, 0x0000746e, 0x00040005,
-    0x000002f8, 0x6d6d6f63, 0x00646e61, 0x00040005, 0x000002fd, 0x74646977, 0x00000068, 0x00060005,
-    0x00000317, 0x72756f73, 0x63536563, 0x6e656572, 0x00000000, 0x00060005, 0x0000031b, 0x72756f73,
-    0x44336563, 0x696c6156, 0x00000064, 0x00050005, 0x0000031f, 0x656e696c, 0x6174654d, 0x00000000,
-    0x00040005, 0x00000328, 0x72756f73, 0x00416563, 0x00040005, 0x00000338, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000339, 0x61726170, 0x0000006d, 0x00040005, 0x00000343, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000345, 0x61726170, 0x0000006d, 0x00040005, 0x00000346, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000348, 0x61726170, 0x0000006d, 0x00040005, 0x0000034a, 0x61726170, 0x0000006d,
-    0x00070005, 0x0000034e, 0x72756f73, 0x52426563, 0x72656665, 0x65636e65, 0x00000000, 0x00040005,
-    0x00000354, 0x72756f73, 0x00426563, 0x00040005, 0x00000362, 0x61726170, 0x0000006d, 0x00040005,
-    0x00000364, 0x61726170, 0x0000006d, 0x00040005, 0x0000036d, 0x65646f6d, 0x00000000, 0x00040005,
-    0x00000372, 0x75736572, 0x0000746c, 0x00030005, 0x0000037e, 0x00617665, 0x00030005, 0x00000382,
-    0x00627665, 0x00040005, 0x00000387, 0x68706c61, 0x00004161, 0x00040005, 0x0000038c, 0x68706c61,
-    0x00004261, 0x00030005, 0x00000391, 0x00000072, 0x00030005, 0x000003a5, 0x00000067, 0x00030005,
-    0x000003bb, 0x00000062, 0x00040005, 0x000003d1, 0x68706c61, 0x00000061, 0x00040005, 0x000003e6,
-    0x72646461, 0x00737365, 0x00040005, 0x000003ee, 0x6b6e6162, 0x00000000, 0x00040005, 0x000003f1,
-    0x73726576, 0x006e6f69, 0x00060005, 0x000003f5, 0x706d6173, 0x5073656c, 0x69507265, 0x006c6578,
-    0x00040005, 0x000003f9, 0x6c6c6563, 0x00000000, 0x00050005, 0x00000401, 0x706d6173, 0x6e49656c,
-    0x00786564, 0x00040005, 0x00000410, 0x61726170, 0x0000006d, 0x00060005, 0x00000414, 0x65726353,
-    0x65486e65, 0x74686769, 0x00000000, 0x00060005, 0x00000415, 0x5778614d, 0x546b726f, 0x73656c69,
-    0x00000000, 0x00070005, 0x00000418, 0x6d617246, 0x66756265, 0x53726566, 0x64697274, 0x00000065,
-    0x00060005, 0x00000419, 0x656c6954, 0x72655073, 0x656e694c, 0x00000000, 0x00050005, 0x0000041a,
-    0x656c6954, 0x656e694c, 0x00000073, 0x00050005, 0x0000041f, 0x6174654d, 0x66696e55, 0x006d726f,
-    0x00060006, 0x0000041f, 0x00000000, 0x506d754e, 0x67796c6f, 0x00736e6f, 0x00060006, 0x0000041f,
-    0x00000001, 0x566d754e, 0x61697261, 0x0073746e, 0x00060006, 0x0000041f, 0x00000002, 0x68706c41,
-    0x66655261, 0x00000000, 0x00050006, 0x0000041f, 0x00000003, 0x70736944, 0x00746e43, 0x00060006,
-    0x0000041f, 0x00000004, 0x6e6f6f54, 0x6c626154, 0x00000065, 0x00060006, 0x0000041f, 0x00000005,
-    0x61656c43, 0x6c6f4372, 0x0000726f, 0x00060006, 0x0000041f, 0x00000006, 0x61656c43, 0x70654472,
-    0x00006874, 0x00060006, 0x0000041f, 0x00000007, 0x61656c43, 0x74744172, 0x00000072, 0x00060006,
-    0x0000041f, 0x00000008, 0x4f676f46, 0x65736666, 0x00000074, 0x00060006, 0x0000041f, 0x00000009,
-    0x53676f46, 0x74666968, 0x00000000, 0x00060006, 0x0000041f, 0x0000000a, 0x43676f46, 0x726f6c6f,
-    0x00000000, 0x00080006, 0x0000041f, 0x0000000b, 0x61656c43, 0x74694272, 0x4f70616d, 0x65736666,
-    0x00000074, 0x00030005, 0x00000421, 0x00000000, 0x00090005, 0x00000425, 0x73657250, 0x61746e65,
-    0x6e6f6974, 0x7074754f, 0x75427475, 0x72656666, 0x00000000, 0x00080006, 0x00000425, 0x00000000,
-    0x73657250, 0x61746e65, 0x6e6f6974, 0x7074754f, 0x00007475, 0x00030005, 0x00000427, 0x00000000,
-    0x00060005, 0x00000428, 0x65726944, 0x754f7463, 0x74757074, 0x00706f54, 0x00070005, 0x00000429,
-    0x65726944, 0x754f7463, 0x74757074, 0x74746f42, 0x00006d6f, 0x00040047, 0x0000006b, 0x00000022,
-    0x00000000, 0x00040047, 0x0000006b, 0x00000021, 0x0000000b, 0x00030047, 0x0000006b, 0x00000018,
-    0x00040047, 0x00000184, 0x00000001, 0x00000000, 0x00040047, 0x0000019c, 0x00000006, 0x00000004,
-    0x00050048, 0x0000019d, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x0000019d, 0x00000002,
-    0x00040047, 0x0000019f, 0x00000022, 0x00000000, 0x00040047, 0x0000019f, 0x00000021, 0x0000000e,
-    0x00050048, 0x000001ce, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x000001ce, 0x00000001,
-    0x00000023, 0x00000004, 0x00050048, 0x000001ce, 0x00000002, 0x00000023, 0x00000008, 0x00050048,
-    0x000001ce, 0x00000003, 0x00000023, 0x0000000c, 0x00050048, 0x000001ce, 0x00000004, 0x00000023,
-    0x00000010, 0x00050048, 0x000001ce, 0x00000005, 0x00000023, 0x00000014, 0x00050048, 0x000001ce,
-    0x00000006, 0x00000023, 0x00000018, 0x00050048, 0x000001ce, 0x00000007, 0x00000023, 0x0000001c,
-    0x00030047, 0x000001ce, 0x00000002, 0x00040047, 0x000001ed, 0x00000006, 0x00000004, 0x00040048,
-    0x000001ee, 0x00000000, 0x00000018, 0x00050048, 0x000001ee, 0x00000000, 0x00000023, 0x00000000,
-    0x00030047, 0x000001ee, 0x00000002, 0x00040047, 0x000001f0, 0x00000022, 0x00000000, 0x00040047,
-    0x000001f0, 0x00000021, 0x0000000c, 0x00040047, 0x000002b4, 0x0000000b, 0x0000001c, 0x00040047,
-    0x00000414, 0x00000001, 0x00000001, 0x00040047, 0x00000415, 0x00000001, 0x00000002, 0x00040047,
-    0x0000041d, 0x00000006, 0x00000010, 0x00050048, 0x0000041f, 0x00000000, 0x00000023, 0x00000000,
-    0x00050048, 0x0000041f, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x0000041f, 0x00000002,
-    0x00000023, 0x00000008, 0x00050048, 0x0000041f, 0x00000003, 0x00000023, 0x0000000c, 0x00050048,
-    0x0000041f, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x0000041f, 0x00000005, 0x00000023,
-    0x00000230, 0x00050048, 0x0000041f, 0x00000006, 0x00000023, 0x00000234, 0x00050048, 0x0000041f,
-    0x00000007, 0x00000023, 0x00000238, 0x00050048, 0x0000041f, 0x00000008, 0x00000023, 0x0000023c,
-    0x00050048, 0x0000041f, 0x00000009, 0x00000023, 0x00000240, 0x00050048, 0x0000041f, 0x0000000a,
-    0x00000023, 0x00000244, 0x00050048, 0x0000041f, 0x0000000b, 0x00000023, 0x00000248, 0x00030047,
-    0x0000041f, 0x00000002, 0x00040047, 0x00000421, 0x00000022, 0x00000000, 0x00040047, 0x00000421,
-    0x00000021, 0x00000000, 0x00040047, 0x00000424, 0x00000006, 0x00000004, 0x00050048, 0x00000425,
-    0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000425, 0x00000002, 0x00040047, 0x00000427,
-    0x00000022, 0x00000000, 0x00040047, 0x00000427, 0x00000021, 0x0000000d, 0x00040047, 0x00000428,
-    0x00000022, 0x00000000, 0x00040047, 0x00000428, 0x00000021, 0x00000011, 0x00030047, 0x00000428,
-    0x00000019, 0x00040047, 0x00000429, 0x00000022, 0x00000000, 0x00040047, 0x00000429, 0x00000021,
-    0x00000012, 0x00030047, 0x00000429, 0x00000019, 0x00040047, 0x0000042b, 0x0000000b, 0x00000019,
-    0x00020013, 0x00000002, 0x00030021, 0x00000003, 0x00000002, 0x00040015, 0x00000006, 0x00000020,
-    0x00000000, 0x00040020, 0x00000007, 0x00000007, 0x00000006, 0x00040021, 0x00000008, 0x00000006,
-    0x00000007, 0x00040015, 0x0000000f, 0x00000020, 0x00000001, 0x00040017, 0x00000010, 0x0000000f,
-    0x00000002, 0x00040020, 0x00000011, 0x00000007, 0x00000010, 0x00040021, 0x00000012, 0x00000006,
-    0x00000011, 0x00070021, 0x0000001f, 0x00000006, 0x00000007, 0x00000007, 0x00000007, 0x00000007,
-    0x00050021, 0x0000002c, 0x00000006, 0x00000007, 0x00000007, 0x00060021, 0x00000031, 0x00000006,
-    0x00000007, 0x00000007, 0x00000007, 0x00040017, 0x0000003c, 0x00000006, 0x00000002, 0x00040020,
-    0x0000003d, 0x00000007, 0x0000003c, 0x00050021, 0x0000003e, 0x00000006, 0x00000007, 0x0000003d,
-    0x00050021, 0x00000043, 0x00000006, 0x0000003d, 0x00000007, 0x00020014, 0x00000048, 0x00040020,
-    0x00000049, 0x00000007, 0x00000048, 0x00080021, 0x0000004a, 0x00000006, 0x00000007, 0x0000003d,
-    0x00000007, 0x00000007, 0x00000049, 0x0004002b, 0x00000006, 0x00000056, 0x0000003f, 0x0004002b,
-    0x00000006, 0x00000058, 0x0000007f, 0x0004002b, 0x00000006, 0x0000005a, 0x000000ff, 0x0004002b,
-    0x00000006, 0x0000005f, 0x0000001f, 0x00030016, 0x00000065, 0x00000020, 0x00040017, 0x00000066,
-    0x00000065, 0x00000004, 0x00040020, 0x00000067, 0x00000007, 0x00000066, 0x00090019, 0x00000069,
-    0x00000065, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000004, 0x00040020,
-    0x0000006a, 0x00000000, 0x00000069, 0x0004003b, 0x0000006a, 0x0000006b, 0x00000000, 0x00040017,
-    0x0000006f, 0x00000006, 0x00000004, 0x00040020, 0x00000070, 0x00000007, 0x0000006f, 0x0004002b,
-    0x00000065, 0x00000073, 0x437f0000, 0x0004002b, 0x00000006, 0x00000078, 0x00000000, 0x0004002b,
-    0x00000006, 0x0000007d, 0x00000001, 0x0004002b, 0x0000000f, 0x00000081, 0x00000008, 0x0004002b,
-    0x00000006, 0x00000085, 0x00000002, 0x0004002b, 0x0000000f, 0x00000089, 0x00000010, 0x0004002b,
-    0x00000006, 0x0000008d, 0x00000003, 0x0004002b, 0x0000000f, 0x00000091, 0x00000018, 0x0004002b,
-    0x00000006, 0x000000be, 0x00000008, 0x0004002b, 0x0000000f, 0x000000c0, 0x00000004, 0x0004002b,
-    0x00000006, 0x000000e9, 0x00000020, 0x0004002b, 0x00000006, 0x000000f7, 0x00000010, 0x0004002b,
-    0x0000000f, 0x000000f9, 0x00000005, 0x0004002b, 0x00000006, 0x00000177, 0x0000ffff, 0x0004002b,
-    0x00000006, 0x0000017b, 0x0000001c, 0x0004002b, 0x00000006, 0x00000180, 0x0000001e, 0x00040032,
-    0x0000000f, 0x00000184, 0x00000100, 0x0004002b, 0x0000000f, 0x00000185, 0x00000100, 0x00060034,
-    0x0000000f, 0x00000186, 0x00000087, 0x00000184, 0x00000185, 0x00060034, 0x00000006, 0x00000187,
-    0x00000080, 0x00000186, 0x00000078, 0x00060034, 0x00000006, 0x00000188, 0x00000080, 0x00000186,
-    0x00000078, 0x00060034, 0x00000006, 0x00000189, 0x00000084, 0x00000187, 0x00000188, 0x0004002b,
-    0x00000006, 0x0000018c, 0x00000004, 0x0004002b, 0x00000006, 0x00000190, 0x00010000, 0x00060034,
-    0x00000006, 0x00000197, 0x00000080, 0x00000186, 0x00000078, 0x0003001d, 0x0000019c, 0x00000006,
-    0x0003001e, 0x0000019d, 0x0000019c, 0x00040020, 0x0000019e, 0x0000000c, 0x0000019d, 0x0004003b,
-    0x0000019e, 0x0000019f, 0x0000000c, 0x0004002b, 0x0000000f, 0x000001a0, 0x00000000, 0x00040020,
-    0x000001a6, 0x0000000c, 0x00000006, 0x0004002b, 0x00000006, 0x000001ad, 0x00000017, 0x0004002b,
-    0x00000006, 0x000001af, 0x000001ff, 0x00040020, 0x000001b1, 0x00000007, 0x0000000f, 0x0004002b,
-    0x00000006, 0x000001b4, 0x00000100, 0x0004002b, 0x00000006, 0x000001bd, 0x00000200, 0x00060034,
-    0x00000006, 0x000001c0, 0x00000080, 0x00000186, 0x00000078, 0x00060034, 0x00000006, 0x000001c9,
-    0x00000080, 0x00000186, 0x00000078, 0x000a001e, 0x000001ce, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x0000000f, 0x00000006, 0x00040020, 0x000001cf, 0x00000009,
-    0x000001ce, 0x0004003b, 0x000001cf, 0x000001d0, 0x00000009, 0x0004002b, 0x0000000f, 0x000001d1,
-    0x00000001, 0x00040020, 0x000001d2, 0x00000009, 0x00000006, 0x0004002b, 0x00000006, 0x000001eb,
-    0x00060000, 0x0003001d, 0x000001ed, 0x00000006, 0x0003001e, 0x000001ee, 0x000001ed, 0x00040020,
-    0x000001ef, 0x0000000c, 0x000001ee, 0x0004003b, 0x000001ef, 0x000001f0, 0x0000000c, 0x0004002b,
-    0x00000006, 0x000001f8, 0x0000c000, 0x0004002b, 0x00000006, 0x00000200, 0x00018000, 0x0004002b,
-    0x00000006, 0x00000208, 0x00024000, 0x0004002b, 0x00000006, 0x00000210, 0x00000018, 0x0004002b,
-    0x00000006, 0x00000215, 0x00000040, 0x0004002b, 0x00000006, 0x0000021b, 0x80000000, 0x00060034,
-    0x00000006, 0x00000221, 0x00000080, 0x00000186, 0x00000078, 0x00060034, 0x00000006, 0x00000232,
-    0x00000080, 0x00000186, 0x00000078, 0x0004002b, 0x00000006, 0x0000024c, 0x0000000f, 0x0004002b,
-    0x00000006, 0x0000025b, 0x00000080, 0x0004002b, 0x00000006, 0x0000027a, 0x00000007, 0x00040017,
-    0x000002b2, 0x00000006, 0x00000003, 0x00040020, 0x000002b3, 0x00000001, 0x000002b2, 0x0004003b,
-    0x000002b3, 0x000002b4, 0x00000001, 0x0004002b, 0x0000000f, 0x000002c0, 0x00000002, 0x00040020,
-    0x000002c3, 0x00000001, 0x00000006, 0x00060034, 0x00000006, 0x000002cd, 0x00000080, 0x00000184,
-    0x00000078, 0x00060034, 0x00000006, 0x000002d4, 0x00000080, 0x00000186, 0x00000078, 0x0004002b,
-    0x00000006, 0x000002d8, 0x000000c0, 0x00060034, 0x00000006, 0x000002e0, 0x00000080, 0x00000186,
-    0x00000078, 0x00060034, 0x00000006, 0x000002e8, 0x00000080, 0x00000186, 0x00000078, 0x0004002b,
-    0x00000006, 0x000002f0, 0x000a8180, 0x0004002b, 0x00000006, 0x00000320, 0x000a8000, 0x0004002b,
-    0x00000006, 0x0000032a, 0x01000000, 0x0004002b, 0x00000006, 0x0000034f, 0x0009c000, 0x00060034,
-    0x00000006, 0x0000035d, 0x00000080, 0x00000186, 0x00000078, 0x0004002b, 0x00000006, 0x00000367,
-    0x00090000, 0x0004002b, 0x00000006, 0x0000036f, 0x0000001d, 0x00060034, 0x00000006, 0x000003f6,
-    0x00000080, 0x00000186, 0x00000078, 0x00060034, 0x00000006, 0x000003f7, 0x00000080, 0x00000186,
-    0x00000078, 0x00060034, 0x00000006, 0x000003f8, 0x00000084, 0x000003f6, 0x000003f7, 0x00060034,
-    0x00000006, 0x00000404, 0x00000080, 0x00000186, 0x00000078, 0x00060034, 0x00000006, 0x00000408,
-    0x00000080, 0x00000186, 0x00000078, 0x00040032, 0x0000000f, 0x00000414, 0x000000c0, 0x00040032,
-    0x0000000f, 0x00000415, 0x00003000, 0x0004002b, 0x0000000f, 0x00000416, 0x00000040, 0x0004002b,
-    0x0000000f, 0x00000417, 0x00000020, 0x00060034, 0x0000000f, 0x00000418, 0x00000084, 0x00000184,
-    0x00000414, 0x00060034, 0x0000000f, 0x00000419, 0x00000087, 0x00000184, 0x00000081, 0x00060034,
-    0x0000000f, 0x0000041a, 0x00000087, 0x00000414, 0x00000081, 0x0004002b, 0x0000000f, 0x0000041b,
-    0x00000800, 0x0004002b, 0x00000006, 0x0000041c, 0x00000022, 0x0004001c, 0x0000041d, 0x0000006f,
-    0x0000041c, 0x00040017, 0x0000041e, 0x00000065, 0x00000002, 0x000e001e, 0x0000041f, 0x00000006,
-    0x00000006, 0x0000000f, 0x00000006, 0x0000041d, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x0000041e, 0x00040020, 0x00000420, 0x00000002, 0x0000041f, 0x0004003b,
-    0x00000420, 0x00000421, 0x00000002, 0x0004002b, 0x0000000f, 0x00000422, 0x000000c0, 0x0004002b,
-    0x0000000f, 0x00000423, 0x0000c000, 0x0003001d, 0x00000424, 0x00000006, 0x0003001e, 0x00000425,
-    0x00000424, 0x00040020, 0x00000426, 0x0000000c, 0x00000425, 0x0004003b, 0x00000426, 0x00000427,
-    0x0000000c, 0x0004003b, 0x0000006a, 0x00000428, 0x00000000, 0x0004003b, 0x0000006a, 0x00000429,
-    0x00000000, 0x0004002b, 0x00000006, 0x0000042a, 0x00030000, 0x0006002c, 0x000002b2, 0x0000042b,
-    0x000000be, 0x000000be, 0x0000007d, 0x00050036, 0x00000002, 0x00000004, 0x00000000, 0x00000003,
-    0x000200f8, 0x00000005, 0x0004003b, 0x0000003d, 0x000002b1, 0x00000007, 0x0004003b, 0x00000049,
-    0x000002b7, 0x00000007, 0x0004003b, 0x00000007, 0x000002bb, 0x00000007, 0x0004003b, 0x00000007,
-    0x000002bd, 0x00000007, 0x0004003b, 0x00000007, 0x000002de, 0x00000007, 0x0004003b, 0x00000007,
-    0x000002e5, 0x00000007, 0x0004003b, 0x00000007, 0x000002ea, 0x00000007, 0x0004003b, 0x00000007,
-    0x000002ef, 0x00000007, 0x0004003b, 0x00000007, 0x000002f4, 0x00000007, 0x0004003b, 0x00000007,
-    0x000002f8, 0x00000007, 0x0004003b, 0x00000007, 0x000002fd, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000317, 0x00000007, 0x0004003b, 0x00000049, 0x0000031b, 0x00000007, 0x0004003b, 0x00000007,
-    0x0000031f, 0x00000007, 0x0004003b, 0x00000007, 0x00000328, 0x00000007, 0x0004003b, 0x00000007,
-    0x0000032d, 0x00000007, 0x0004003b, 0x00000007, 0x00000331, 0x00000007, 0x0004003b, 0x0000003d,
-    0x00000338, 0x00000007, 0x0004003b, 0x00000007, 0x00000339, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000343, 0x00000007, 0x0004003b, 0x0000003d, 0x00000345, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000346, 0x00000007, 0x0004003b, 0x00000007, 0x00000348, 0x00000007, 0x0004003b, 0x00000049,
-    0x0000034a, 0x00000007, 0x0004003b, 0x00000007, 0x0000034e, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000354, 0x00000007, 0x0004003b, 0x00000007, 0x00000358, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000362, 0x00000007, 0x0004003b, 0x0000003d, 0x00000364, 0x00000007, 0x0004003b, 0x00000007,
-    0x0000036d, 0x00000007, 0x0004003b, 0x00000007, 0x00000372, 0x00000007, 0x0004003b, 0x00000007,
-    0x0000037e, 0x00000007, 0x0004003b, 0x00000007, 0x00000382, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000387, 0x00000007, 0x0004003b, 0x00000007, 0x0000038c, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000391, 0x00000007, 0x0004003b, 0x00000007, 0x000003a5, 0x00000007, 0x0004003b, 0x00000007,
-    0x000003bb, 0x00000007, 0x0004003b, 0x00000007, 0x000003d1, 0x00000007, 0x0004003b, 0x00000007,
-    0x000003e6, 0x00000007, 0x0004003b, 0x00000007, 0x000003ee, 0x00000007, 0x0004003b, 0x00000007,
-    0x000003f1, 0x00000007, 0x0004003b, 0x00000007, 0x000003f5, 0x00000007, 0x0004003b, 0x00000007,
-    0x000003f9, 0x00000007, 0x0004003b, 0x00000007, 0x00000401, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000410, 0x00000007, 0x0004003d, 0x000002b2, 0x000002b5, 0x000002b4, 0x0007004f, 0x0000003c,
-    0x000002b6, 0x000002b5, 0x000002b5, 0x00000000, 0x00000001, 0x0003003e, 0x000002b1, 0x000002b6,
-    0x00050041, 0x000001d2, 0x000002b8, 0x000001d0, 0x000000f9, 0x0004003d, 0x00000006, 0x000002b9,
-    0x000002b8, 0x000500ab, 0x00000048, 0x000002ba, 0x000002b9, 0x00000078, 0x0003003e, 0x000002b7,
-    0x000002ba, 0x0004003d, 0x00000048, 0x000002bc, 0x000002b7, 0x000300f7, 0x000002bf, 0x00000000,
-    0x000400fa, 0x000002bc, 0x000002be, 0x000002c7, 0x000200f8, 0x000002be, 0x00050041, 0x000001d2,
-    0x000002c1, 0x000001d0, 0x000002c0, 0x0004003d, 0x00000006, 0x000002c2, 0x000002c1, 0x00050041,
-    0x000002c3, 0x000002c4, 0x000002b4, 0x00000085, 0x0004003d, 0x00000006, 0x000002c5, 0x000002c4,
-    0x00050080, 0x00000006, 0x000002c6, 0x000002c2, 0x000002c5, 0x0003003e, 0x000002bd, 0x000002c6,
-    0x000200f9, 0x000002bf, 0x000200f8, 0x000002c7, 0x00050041, 0x000001d2, 0x000002c8, 0x000001d0,
-    0x000002c0, 0x0004003d, 0x00000006, 0x000002c9, 0x000002c8, 0x0003003e, 0x000002bd, 0x000002c9,
-    0x000200f9, 0x000002bf, 0x000200f8, 0x000002bf, 0x0004003d, 0x00000006, 0x000002ca, 0x000002bd,
-    0x0003003e, 0x000002bb, 0x000002ca, 0x00050041, 0x00000007, 0x000002cb, 0x000002b1, 0x00000078,
-    0x0004003d, 0x00000006, 0x000002cc, 0x000002cb, 0x000500ae, 0x00000048, 0x000002ce, 0x000002cc,
-    0x000002cd, 0x000400a8, 0x00000048, 0x000002cf, 0x000002ce, 0x000300f7, 0x000002d1, 0x00000000,
-    0x000400fa, 0x000002cf, 0x000002d0, 0x000002d1, 0x000200f8, 0x000002d0, 0x00050041, 0x00000007,
-    0x000002d2, 0x000002b1, 0x0000007d, 0x0004003d, 0x00000006, 0x000002d3, 0x000002d2, 0x000500ae,
-    0x00000048, 0x000002d5, 0x000002d3, 0x000002d4, 0x000200f9, 0x000002d1, 0x000200f8, 0x000002d1,
-    0x000700f5, 0x00000048, 0x000002d6, 0x000002ce, 0x000002bf, 0x000002d5, 0x000002d0, 0x0004003d,
-    0x00000006, 0x000002d7, 0x000002bb, 0x000500ae, 0x00000048, 0x000002d9, 0x000002d7, 0x000002d8,
-    0x000500a6, 0x00000048, 0x000002da, 0x000002d6, 0x000002d9, 0x000300f7, 0x000002dc, 0x00000000,
-    0x000400fa, 0x000002da, 0x000002db, 0x000002dc, 0x000200f8, 0x000002db, 0x000100fd, 0x000200f8,
-    0x000002dc, 0x0004003d, 0x00000006, 0x000002df, 0x000002bb, 0x00050084, 0x00000006, 0x000002e1,
-    0x000002df, 0x000002e0, 0x00050041, 0x00000007, 0x000002e2, 0x000002b1, 0x0000007d, 0x0004003d,
-    0x00000006, 0x000002e3, 0x000002e2, 0x00050080, 0x00000006, 0x000002e4, 0x000002e1, 0x000002e3,
-    0x0003003e, 0x000002de, 0x000002e4, 0x00050041, 0x00000007, 0x000002e6, 0x000002b1, 0x00000078,
-    0x0004003d, 0x00000006, 0x000002e7, 0x000002e6, 0x00050086, 0x00000006, 0x000002e9, 0x000002e7,
-    0x000002e8, 0x0003003e, 0x000002e5, 0x000002e9, 0x0004003d, 0x00000006, 0x000002eb, 0x000002e5,
-    0x0004003d, 0x00000006, 0x000002ec, 0x000002bb, 0x00050084, 0x00000006, 0x000002ed, 0x000002ec,
-    0x000001b4, 0x00050080, 0x00000006, 0x000002ee, 0x000002eb, 0x000002ed, 0x0003003e, 0x000002ea,
-    0x000002ee, 0x0004003d, 0x00000006, 0x000002f1, 0x000002bb, 0x00050084, 0x00000006, 0x000002f2,
-    0x000002f1, 0x0000018c, 0x00050080, 0x00000006, 0x000002f3, 0x000002f0, 0x000002f2, 0x0003003e,
-    0x000002ef, 0x000002f3, 0x0004003d, 0x00000006, 0x000002f5, 0x000002ef, 0x00060041, 0x000001a6,
-    0x000002f6, 0x000001f0, 0x000001a0, 0x000002f5, 0x0004003d, 0x00000006, 0x000002f7, 0x000002f6,
-    0x0003003e, 0x000002f4, 0x000002f7, 0x0004003d, 0x00000006, 0x000002f9, 0x000002ef, 0x00050080,
-    0x00000006, 0x000002fa, 0x000002f9, 0x0000007d, 0x00060041, 0x000001a6, 0x000002fb, 0x000001f0,
-    0x000001a0, 0x000002fa, 0x0004003d, 0x00000006, 0x000002fc, 0x000002fb, 0x0003003e, 0x000002f8,
-    0x000002fc, 0x0004003d, 0x00000006, 0x000002fe, 0x000002ef, 0x00050080, 0x00000006, 0x000002ff,
-    0x000002fe, 0x0000008d, 0x00060041, 0x000001a6, 0x00000300, 0x000001f0, 0x000001a0, 0x000002ff,
-    0x0004003d, 0x00000006, 0x00000301, 0x00000300, 0x0003003e, 0x000002fd, 0x00000301, 0x0004003d,
-    0x00000006, 0x00000302, 0x000002f8, 0x000500c7, 0x00000006, 0x00000303, 0x00000302, 0x0000021b,
-    0x000500aa, 0x00000048, 0x00000304, 0x00000303, 0x00000078, 0x000400a8, 0x00000048, 0x00000305,
-    0x00000304, 0x000300f7, 0x00000307, 0x00000000, 0x000400fa, 0x00000305, 0x00000306, 0x00000307,
-    0x000200f8, 0x00000306, 0x0004003d, 0x00000048, 0x00000308, 0x000002b7, 0x000300f7, 0x0000030a,
-    0x00000000, 0x000400fa, 0x00000308, 0x00000309, 0x0000030a, 0x000200f8, 0x00000309, 0x0004003d,
-    0x00000006, 0x0000030b, 0x000002f8, 0x000500c7, 0x00000006, 0x0000030c, 0x0000030b, 0x000000e9,
-    0x000500aa, 0x00000048, 0x0000030d, 0x0000030c, 0x00000078, 0x000200f9, 0x0000030a, 0x000200f8,
-    0x0000030a, 0x000700f5, 0x00000048, 0x0000030e, 0x00000308, 0x00000306, 0x0000030d, 0x00000309,
-    0x000200f9, 0x00000307, 0x000200f8, 0x00000307, 0x000700f5, 0x00000048, 0x0000030f, 0x00000304,
-    0x000002dc, 0x0000030e, 0x0000030a, 0x0004003d, 0x00000006, 0x00000310, 0x000002e5, 0x0004003d,
-    0x00000006, 0x00000311, 0x000002fd, 0x000500ae, 0x00000048, 0x00000312, 0x00000310, 0x00000311,
-    0x000500a6, 0x00000048, 0x00000313, 0x0000030f, 0x00000312, 0x000300f7, 0x00000315, 0x00000000,
-    0x000400fa, 0x00000313, 0x00000314, 0x00000315, 0x000200f8, 0x00000314, 0x000100fd, 0x000200f8,
-    0x00000315, 0x0004003d, 0x00000006, 0x00000318, 0x000002f8, 0x000500c2, 0x00000006, 0x00000319,
-    0x00000318, 0x0000008d, 0x000500c7, 0x00000006, 0x0000031a, 0x00000319, 0x0000007d, 0x0003003e,
-    0x00000317, 0x0000031a, 0x0004003d, 0x00000006, 0x0000031c, 0x000002f8, 0x000500c7, 0x00000006,
-    0x0000031d, 0x0000031c, 0x000000f7, 0x000500ab, 0x00000048, 0x0000031e, 0x0000031d, 0x00000078,
-    0x0003003e, 0x0000031b, 0x0000031e, 0x0004003d, 0x00000006, 0x00000321, 0x00000317, 0x00050084,
-    0x00000006, 0x00000322, 0x00000321, 0x000002d8, 0x00050080, 0x00000006, 0x00000323, 0x00000320,
-    0x00000322, 0x0004003d, 0x00000006, 0x00000324, 0x000002bb, 0x00050080, 0x00000006, 0x00000325,
-    0x00000323, 0x00000324, 0x00060041, 0x000001a6, 0x00000326, 0x000001f0, 0x000001a0, 0x00000325,
-    0x0004003d, 0x00000006, 0x00000327, 0x00000326, 0x0003003e, 0x0000031f, 0x00000327, 0x0004003d,
-    0x00000006, 0x00000329, 0x000002f4, 0x000500c7, 0x00000006, 0x0000032b, 0x00000329, 0x0000032a,
-    0x000500ab, 0x00000048, 0x0000032c, 0x0000032b, 0x00000078, 0x000300f7, 0x0000032f, 0x00000000,
-    0x000400fa, 0x0000032c, 0x0000032e, 0x0000033e, 0x000200f8, 0x0000032e, 0x0004003d, 0x00000048,
-    0x00000330, 0x0000031b, 0x000300f7, 0x00000333, 0x00000000, 0x000400fa, 0x00000330, 0x00000332,
-    0x0000033c, 0x000200f8, 0x00000332, 0x00050041, 0x00000007, 0x00000334, 0x000002b1, 0x00000078,
-    0x0004003d, 0x00000006, 0x00000335, 0x00000334, 0x0004003d, 0x00000006, 0x00000336, 0x000002de,
-    0x00050050, 0x0000003c, 0x00000337, 0x00000335, 0x00000336, 0x0003003e, 0x00000338, 0x00000337,
-    0x0004003d, 0x00000006, 0x0000033a, 0x0000031f, 0x0003003e, 0x00000339, 0x0000033a, 0x00060039,
-    0x00000006, 0x0000033b, 0x00000046, 0x00000338, 0x00000339, 0x0003003e, 0x00000331, 0x0000033b,
-    0x000200f9, 0x00000333, 0x000200f8, 0x0000033c, 0x0003003e, 0x00000331, 0x00000078, 0x000200f9,
-    0x00000333, 0x000200f8, 0x00000333, 0x0004003d, 0x00000006, 0x0000033d, 0x00000331, 0x0003003e,
-    0x0000032d, 0x0000033d, 0x000200f9, 0x0000032f, 0x000200f8, 0x0000033e, 0x00050041, 0x00000007,
-    0x0000033f, 0x000002b1, 0x00000078, 0x0004003d, 0x00000006, 0x00000340, 0x0000033f, 0x0004003d,
-    0x00000006, 0x00000341, 0x000002de, 0x00050050, 0x0000003c, 0x00000342, 0x00000340, 0x00000341,
-    0x0004003d, 0x00000006, 0x00000344, 0x00000317, 0x0003003e, 0x00000343, 0x00000344, 0x0003003e,
-    0x00000345, 0x00000342, 0x0004003d, 0x00000006, 0x00000347, 0x000002ea, 0x0003003e, 0x00000346,
-    0x00000347, 0x0004003d, 0x00000006, 0x00000349, 0x0000031f, 0x0003003e, 0x00000348, 0x00000349,
-    0x0004003d, 0x00000048, 0x0000034b, 0x0000031b, 0x0003003e, 0x0000034a, 0x0000034b, 0x00090039,
-    0x00000006, 0x0000034c, 0x00000050, 0x00000343, 0x00000345, 0x00000346, 0x00000348, 0x0000034a,
-    0x0003003e, 0x0000032d, 0x0000034c, 0x000200f9, 0x0000032f, 0x000200f8, 0x0000032f, 0x0004003d,
-    0x00000006, 0x0000034d, 0x0000032d, 0x0003003e, 0x00000328, 0x0000034d, 0x0004003d, 0x00000006,
-    0x00000350, 0x000002ea, 0x00050080, 0x00000006, 0x00000351, 0x0000034f, 0x00000350, 0x00060041,
-    0x000001a6, 0x00000352, 0x000001f0, 0x000001a0, 0x00000351, 0x0004003d, 0x00000006, 0x00000353,
-    0x00000352, 0x0003003e, 0x0000034e, 0x00000353, 0x0004003d, 0x00000006, 0x00000355, 0x0000034e,
-    0x000500c7, 0x00000006, 0x00000356, 0x00000355, 0x0000021b, 0x000500ab, 0x00000048, 0x00000357,
-    0x00000356, 0x00000078, 0x000300f7, 0x0000035a, 0x00000000, 0x000400fa, 0x00000357, 0x00000359,
-    0x00000366, 0x000200f8, 0x00000359, 0x00050041, 0x00000007, 0x0000035b, 0x000002b1, 0x00000078,
-    0x0004003d, 0x00000006, 0x0000035c, 0x0000035b, 0x00050089, 0x00000006, 0x0000035e, 0x0000035c,
-    0x0000035d, 0x00050041, 0x00000007, 0x0000035f, 0x000002b1, 0x0000007d, 0x0004003d, 0x00000006,
-    0x00000360, 0x0000035f, 0x00050050, 0x0000003c, 0x00000361, 0x0000035e, 0x00000360, 0x0004003d,
-    0x00000006, 0x00000363, 0x0000034e, 0x0003003e, 0x00000362, 0x00000363, 0x0003003e, 0x00000364,
-    0x00000361, 0x00060039, 0x00000006, 0x00000365, 0x00000041, 0x00000362, 0x00000364, 0x0003003e,
-    0x00000358, 0x00000365, 0x000200f9, 0x0000035a, 0x000200f8, 0x00000366, 0x0004003d, 0x00000006,
-    0x00000368, 0x000002ea, 0x00050080, 0x00000006, 0x00000369, 0x00000367, 0x00000368, 0x00060041,
-    0x000001a6, 0x0000036a, 0x000001f0, 0x000001a0, 0x00000369, 0x0004003d, 0x00000006, 0x0000036b,
-    0x0000036a, 0x0003003e, 0x00000358, 0x0000036b, 0x000200f9, 0x0000035a, 0x000200f8, 0x0000035a,
-    0x0004003d, 0x00000006, 0x0000036c, 0x00000358, 0x0003003e, 0x00000354, 0x0000036c, 0x0004003d,
-    0x00000006, 0x0000036e, 0x000002f4, 0x000500c2, 0x00000006, 0x00000370, 0x0000036e, 0x0000036f,
-    0x000500c7, 0x00000006, 0x00000371, 0x00000370, 0x0000008d, 0x0003003e, 0x0000036d, 0x00000371,
-    0x0004003d, 0x00000006, 0x00000373, 0x00000328, 0x0003003e, 0x00000372, 0x00000373, 0x0004003d,
-    0x00000006, 0x00000374, 0x0000036d, 0x000500aa, 0x00000048, 0x00000375, 0x00000374, 0x0000007d,
-    0x000300f7, 0x00000377, 0x00000000, 0x000400fa, 0x00000375, 0x00000376, 0x00000379, 0x000200f8,
-    0x00000376, 0x0004003d, 0x00000006, 0x00000378, 0x00000354, 0x0003003e, 0x00000372, 0x00000378,
-    0x000200f9, 0x00000377, 0x000200f8, 0x00000379, 0x0004003d, 0x00000006, 0x0000037a, 0x0000036d,
-    0x000500ae, 0x00000048, 0x0000037b, 0x0000037a, 0x00000085, 0x000300f7, 0x0000037d, 0x00000000,
-    0x000400fa, 0x0000037b, 0x0000037c, 0x0000037d, 0x000200f8, 0x0000037c, 0x0004003d, 0x00000006,
-    0x0000037f, 0x000002f4, 0x000500c7, 0x00000006, 0x00000380, 0x0000037f, 0x0000005f, 0x0007000c,
-    0x00000006, 0x00000381, 0x00000001, 0x00000026, 0x00000380, 0x000000f7, 0x0003003e, 0x0000037e,
-    0x00000381, 0x0004003d, 0x00000006, 0x00000383, 0x000002f4, 0x000500c2, 0x00000006, 0x00000384,
-    0x00000383, 0x000000be, 0x000500c7, 0x00000006, 0x00000385, 0x00000384, 0x0000005f, 0x0007000c,
-    0x00000006, 0x00000386, 0x00000001, 0x00000026, 0x00000385, 0x000000f7, 0x0003003e, 0x00000382,
-    0x00000386, 0x0004003d, 0x00000006, 0x00000388, 0x00000328, 0x000500c2, 0x00000006, 0x00000389,
-    0x00000388, 0x00000210, 0x000500ab, 0x00000048, 0x0000038a, 0x00000389, 0x00000078, 0x000600a9,
-    0x00000006, 0x0000038b, 0x0000038a, 0x0000007d, 0x00000078, 0x0003003e, 0x00000387, 0x0000038b,
-    0x0004003d, 0x00000006, 0x0000038d, 0x00000354, 0x000500c2, 0x00000006, 0x0000038e, 0x0000038d,
-    0x00000210, 0x000500ab, 0x00000048, 0x0000038f, 0x0000038e, 0x00000078, 0x000600a9, 0x00000006,
-    0x00000390, 0x0000038f, 0x0000007d, 0x00000078, 0x0003003e, 0x0000038c, 0x00000390, 0x0004003d,
-    0x00000006, 0x00000392, 0x00000328, 0x000500c7, 0x00000006, 0x00000393, 0x00000392, 0x00000056,
-    0x000500c2, 0x00000006, 0x00000394, 0x00000393, 0x0000007d, 0x0004003d, 0x00000006, 0x00000395,
-    0x00000387, 0x00050084, 0x00000006, 0x00000396, 0x00000394, 0x00000395, 0x0004003d, 0x00000006,
-    0x00000397, 0x0000037e, 0x00050084, 0x00000006, 0x00000398, 0x00000396, 0x00000397, 0x0004003d,
-    0x00000006, 0x00000399, 0x00000354, 0x000500c7, 0x00000006, 0x0000039a, 0x00000399, 0x00000056,
-    0x000500c2, 0x00000006, 0x0000039b, 0x0000039a, 0x0000007d, 0x0004003d, 0x00000006, 0x0000039c,
-    0x0000038c, 0x00050084, 0x00000006, 0x0000039d, 0x0000039b, 0x0000039c, 0x0004003d, 0x00000006,
-    0x0000039e, 0x00000382, 0x00050084, 0x00000006, 0x0000039f, 0x0000039d, 0x0000039e, 0x00050080,
-    0x00000006, 0x000003a0, 0x00000398, 0x0000039f, 0x00050080, 0x00000006, 0x000003a1, 0x000003a0,
-    0x000000be, 0x000500c2, 0x00000006, 0x000003a2, 0x000003a1, 0x0000018c, 0x0007000c, 0x00000006,
-    0x000003a3, 0x00000001, 0x00000026, 0x000003a2, 0x0000005f, 0x000500c4, 0x00000006, 0x000003a4,
-    0x000003a3, 0x0000007d, 0x0003003e, 0x00000391, 0x000003a4, 0x0004003d, 0x00000006, 0x000003a6,
-    0x00000328, 0x000500c2, 0x00000006, 0x000003a7, 0x000003a6, 0x000000be, 0x000500c7, 0x00000006,
-    0x000003a8, 0x000003a7, 0x00000056, 0x000500c2, 0x00000006, 0x000003a9, 0x000003a8, 0x0000007d,
-    0x0004003d, 0x00000006, 0x000003aa, 0x00000387, 0x00050084, 0x00000006, 0x000003ab, 0x000003a9,
-    0x000003aa, 0x0004003d, 0x00000006, 0x000003ac, 0x0000037e, 0x00050084, 0x00000006, 0x000003ad,
-    0x000003ab, 0x000003ac, 0x0004003d, 0x00000006, 0x000003ae, 0x00000354, 0x000500c2, 0x00000006,
-    0x000003af, 0x000003ae, 0x000000be, 0x000500c7, 0x00000006, 0x000003b0, 0x000003af, 0x00000056,
-    0x000500c2, 0x00000006, 0x000003b1, 0x000003b0, 0x0000007d, 0x0004003d, 0x00000006, 0x000003b2,
-    0x0000038c, 0x00050084, 0x00000006, 0x000003b3, 0x000003b1, 0x000003b2, 0x0004003d, 0x00000006,
-    0x000003b4, 0x00000382, 0x00050084, 0x00000006, 0x000003b5, 0x000003b3, 0x000003b4, 0x00050080,
-    0x00000006, 0x000003b6, 0x000003ad, 0x000003b5, 0x00050080, 0x00000006, 0x000003b7, 0x000003b6,
-    0x000000be, 0x000500c2, 0x00000006, 0x000003b8, 0x000003b7, 0x0000018c, 0x0007000c, 0x00000006,
-    0x000003b9, 0x00000001, 0x00000026, 0x000003b8, 0x0000005f, 0x000500c4, 0x00000006, 0x000003ba,
-    0x000003b9, 0x0000007d, 0x0003003e, 0x000003a5, 0x000003ba, 0x0004003d, 0x00000006, 0x000003bc,
-    0x00000328, 0x000500c2, 0x00000006, 0x000003bd, 0x000003bc, 0x000000f7, 0x000500c7, 0x00000006,
-    0x000003be, 0x000003bd, 0x00000056, 0x000500c2, 0x00000006, 0x000003bf, 0x000003be, 0x0000007d,
-    0x0004003d, 0x00000006, 0x000003c0, 0x00000387, 0x00050084, 0x00000006, 0x000003c1, 0x000003bf,
-    0x000003c0, 0x0004003d, 0x00000006, 0x000003c2, 0x0000037e, 0x00050084, 0x00000006, 0x000003c3,
-    0x000003c1, 0x000003c2, 0x0004003d, 0x00000006, 0x000003c4, 0x00000354, 0x000500c2, 0x00000006,
-    0x000003c5, 0x000003c4, 0x000000f7, 0x000500c7, 0x00000006, 0x000003c6, 0x000003c5, 0x00000056,
-    0x000500c2, 0x00000006, 0x000003c7, 0x000003c6, 0x0000007d, 0x0004003d, 0x00000006, 0x000003c8,
-    0x0000038c, 0x00050084, 0x00000006, 0x000003c9, 0x000003c7, 0x000003c8, 0x0004003d, 0x00000006,
-    0x000003ca, 0x00000382, 0x00050084, 0x00000006, 0x000003cb, 0x000003c9, 0x000003ca, 0x00050080,
-    0x00000006, 0x000003cc, 0x000003c3, 0x000003cb, 0x00050080, 0x00000006, 0x000003cd, 0x000003cc,
-    0x000000be, 0x000500c2, 0x00000006, 0x000003ce, 0x000003cd, 0x0000018c, 0x0007000c, 0x00000006,
-    0x000003cf, 0x00000001, 0x00000026, 0x000003ce, 0x0000005f, 0x000500c4, 0x00000006, 0x000003d0,
-    0x000003cf, 0x0000007d, 0x0003003e, 0x000003bb, 0x000003d0, 0x0004003d, 0x00000006, 0x000003d2,
-    0x0000037e, 0x000500ab, 0x00000048, 0x000003d3, 0x000003d2, 0x00000078, 0x0004003d, 0x00000006,
-    0x000003d4, 0x00000387, 0x000600a9, 0x00000006, 0x000003d5, 0x000003d3, 0x000003d4, 0x00000078,
-    0x0004003d, 0x00000006, 0x000003d6, 0x00000382, 0x000500ab, 0x00000048, 0x000003d7, 0x000003d6,
-    0x00000078, 0x0004003d, 0x00000006, 0x000003d8, 0x0000038c, 0x000600a9, 0x00000006, 0x000003d9,
-    0x000003d7, 0x000003d8, 0x00000078, 0x000500c5, 0x00000006, 0x000003da, 0x000003d5, 0x000003d9,
-    0x00050084, 0x00000006, 0x000003db, 0x000003da, 0x0000005a, 0x0003003e, 0x000003d1, 0x000003db,
-    0x0004003d, 0x00000006, 0x000003dc, 0x00000391, 0x0004003d, 0x00000006, 0x000003dd, 0x000003a5,
-    0x000500c4, 0x00000006, 0x000003de, 0x000003dd, 0x000000be, 0x000500c5, 0x00000006, 0x000003df,
-    0x000003dc, 0x000003de, 0x0004003d, 0x00000006, 0x000003e0, 0x000003bb, 0x000500c4, 0x00000006,
-    0x000003e1, 0x000003e0, 0x000000f7, 0x000500c5, 0x00000006, 0x000003e2, 0x000003df, 0x000003e1,
-    0x0004003d, 0x00000006, 0x000003e3, 0x000003d1, 0x000500c4, 0x00000006, 0x000003e4, 0x000003e3,
-    0x00000210, 0x000500c5, 0x00000006, 0x000003e5, 0x000003e2, 0x000003e4, 0x0003003e, 0x00000372,
-    0x000003e5, 0x000200f9, 0x0000037d, 0x000200f8, 0x0000037d, 0x000200f9, 0x00000377, 0x000200f8,
-    0x00000377, 0x0004003d, 0x00000006, 0x000003e7, 0x000002ef, 0x00050080, 0x00000006, 0x000003e8,
-    0x000003e7, 0x00000085, 0x00060041, 0x000001a6, 0x000003e9, 0x000001f0, 0x000001a0, 0x000003e8,
-    0x0004003d, 0x00000006, 0x000003ea, 0x000003e9, 0x0004003d, 0x00000006, 0x000003eb, 0x000002e5,
-    0x00050080, 0x00000006, 0x000003ec, 0x000003ea, 0x000003eb, 0x000500c7, 0x00000006, 0x000003ed,
-    0x000003ec, 0x00000177, 0x0003003e, 0x000003e6, 0x000003ed, 0x0004003d, 0x00000006, 0x000003ef,
-    0x000002f8, 0x000500c7, 0x00000006, 0x000003f0, 0x000003ef, 0x0000008d, 0x0003003e, 0x000003ee,
-    0x000003f0, 0x0004003d, 0x00000006, 0x000003f2, 0x000002f8, 0x000500c2, 0x00000006, 0x000003f3,
-    0x000003f2, 0x00000085, 0x000500c7, 0x00000006, 0x000003f4, 0x000003f3, 0x0000007d, 0x0003003e,
-    0x000003f1, 0x000003f4, 0x0003003e, 0x000003f5, 0x000003f8, 0x0004003d, 0x00000006, 0x000003fa,
-    0x000003f1, 0x00050084, 0x00000006, 0x000003fb, 0x000003fa, 0x0000018c, 0x0004003d, 0x00000006,
-    0x000003fc, 0x000003ee, 0x00050080, 0x00000006, 0x000003fd, 0x000003fb, 0x000003fc, 0x00050084,
-    0x00000006, 0x000003fe, 0x000003fd, 0x00000190, 0x0004003d, 0x00000006, 0x000003ff, 0x000003e6,
-    0x00050080, 0x00000006, 0x00000400, 0x000003fe, 0x000003ff, 0x0003003e, 0x000003f9, 0x00000400,
-    0x00050041, 0x00000007, 0x00000402, 0x000002b1, 0x0000007d, 0x0004003d, 0x00000006, 0x00000403,
-    0x00000402, 0x00050084, 0x00000006, 0x00000405, 0x00000403, 0x00000404, 0x00050041, 0x00000007,
-    0x00000406, 0x000002b1, 0x00000078, 0x0004003d, 0x00000006, 0x00000407, 0x00000406, 0x00050089,
-    0x00000006, 0x00000409, 0x00000407, 0x00000408, 0x00050080, 0x00000006, 0x0000040a, 0x00000405,
-    0x00000409, 0x0003003e, 0x00000401, 0x0000040a, 0x0004003d, 0x00000006, 0x0000040b, 0x000003f9,
-    0x0004003d, 0x00000006, 0x0000040c, 0x000003f5, 0x00050084, 0x00000006, 0x0000040d, 0x0000040b,
-    0x0000040c, 0x0004003d, 0x00000006, 0x0000040e, 0x00000401, 0x00050080, 0x00000006, 0x0000040f,
-    0x0000040d, 0x0000040e, 0x0004003d, 0x00000006, 0x00000411, 0x00000372, 0x0003003e, 0x00000410,
-    0x00000411, 0x00050039, 0x00000006, 0x00000412, 0x00000053, 0x00000410, 0x00060041, 0x000001a6,
-    0x00000413, 0x0000019f, 0x000001a0, 0x0000040f, 0x0003003e, 0x00000413, 0x00000412, 0x000100fd,
-    0x00010038, 0x00050036, 0x00000006, 0x0000000a, 0x00000000, 0x00000008, 0x00030037, 0x00000007,
-    0x00000009, 0x000200f8, 0x0000000b, 0x0004003d, 0x00000006, 0x00000055, 0x00000009, 0x00050084,
-    0x00000006, 0x00000057, 0x00000055, 0x00000056, 0x00050080, 0x00000006, 0x00000059, 0x00000057,
-    0x00000058, 0x00050086, 0x00000006, 0x0000005b, 0x00000059, 0x0000005a, 0x000200fe, 0x0000005b,
-    0x00010038, 0x00050036, 0x00000006, 0x0000000d, 0x00000000, 0x00000008, 0x00030037, 0x00000007,
-    0x0000000c, 0x000200f8, 0x0000000e, 0x0004003d, 0x00000006, 0x0000005e, 0x0000000c, 0x00050084,
-    0x00000006, 0x00000060, 0x0000005e, 0x0000005f, 0x00050080, 0x00000006, 0x00000061, 0x00000060,
-    0x00000058, 0x00050086, 0x00000006, 0x00000062, 0x00000061, 0x0000005a, 0x000200fe, 0x00000062,
-    0x00010038, 0x00050036, 0x00000006, 0x00000014, 0x00000000, 0x00000012, 0x00030037, 0x00000011,
-    0x00000013, 0x000200f8, 0x00000015, 0x0004003b, 0x00000067, 0x00000068, 0x00000007, 0x0004003b,
-    0x00000070, 0x00000071, 0x00000007, 0x0004003b, 0x00000007, 0x00000077, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000007c, 0x00000007, 0x0004003b, 0x00000007, 0x00000084, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000008c, 0x00000007, 0x0004003d, 0x00000069, 0x0000006c, 0x0000006b, 0x0004003d,
-    0x00000010, 0x0000006d, 0x00000013, 0x00050062, 0x00000066, 0x0000006e, 0x0000006c, 0x0000006d,
-    0x0003003e, 0x00000068, 0x0000006e, 0x0004003d, 0x00000066, 0x00000072, 0x00000068, 0x0005008e,
-    0x00000066, 0x00000074, 0x00000072, 0x00000073, 0x0006000c, 0x00000066, 0x00000075, 0x00000001,
-    0x00000001, 0x00000074, 0x0004006d, 0x0000006f, 0x00000076, 0x00000075, 0x0003003e, 0x00000071,
-    0x00000076, 0x00050041, 0x00000007, 0x00000079, 0x00000071, 0x00000078, 0x0004003d, 0x00000006,
-    0x0000007a, 0x00000079, 0x0003003e, 0x00000077, 0x0000007a, 0x00050039, 0x00000006, 0x0000007b,
-    0x0000000a, 0x00000077, 0x00050041, 0x00000007, 0x0000007e, 0x00000071, 0x0000007d, 0x0004003d,
-    0x00000006, 0x0000007f, 0x0000007e, 0x0003003e, 0x0000007c, 0x0000007f, 0x00050039, 0x00000006,
-    0x00000080, 0x0000000a, 0x0000007c, 0x000500c4, 0x00000006, 0x00000082, 0x00000080, 0x00000081,
-    0x000500c5, 0x00000006, 0x00000083, 0x0000007b, 0x00000082, 0x00050041, 0x00000007, 0x00000086,
-    0x00000071, 0x00000085, 0x0004003d, 0x00000006, 0x00000087, 0x00000086, 0x0003003e, 0x00000084,
-    0x00000087, 0x00050039, 0x00000006, 0x00000088, 0x0000000a, 0x00000084, 0x000500c4, 0x00000006,
-    0x0000008a, 0x00000088, 0x00000089, 0x000500c5, 0x00000006, 0x0000008b, 0x00000083, 0x0000008a,
-    0x00050041, 0x00000007, 0x0000008e, 0x00000071, 0x0000008d, 0x0004003d, 0x00000006, 0x0000008f,
-    0x0000008e, 0x0003003e, 0x0000008c, 0x0000008f, 0x00050039, 0x00000006, 0x00000090, 0x0000000d,
-    0x0000008c, 0x000500c4, 0x00000006, 0x00000092, 0x00000090, 0x00000091, 0x000500c5, 0x00000006,
-    0x00000093, 0x0000008b, 0x00000092, 0x000200fe, 0x00000093, 0x00010038, 0x00050036, 0x00000006,
-    0x00000017, 0x00000000, 0x00000008, 0x00030037, 0x00000007, 0x00000016, 0x000200f8, 0x00000018,
-    0x0004003d, 0x00000006, 0x00000096, 0x00000016, 0x000500c7, 0x00000006, 0x00000097, 0x00000096,
-    0x00000056, 0x000200fe, 0x00000097, 0x00010038, 0x00050036, 0x00000006, 0x0000001a, 0x00000000,
-    0x00000008, 0x00030037, 0x00000007, 0x00000019, 0x000200f8, 0x0000001b, 0x0004003d, 0x00000006,
-    0x0000009a, 0x00000019, 0x000500c2, 0x00000006, 0x0000009b, 0x0000009a, 0x00000081, 0x000500c7,
-    0x00000006, 0x0000009c, 0x0000009b, 0x00000056, 0x000200fe, 0x0000009c, 0x00010038, 0x00050036,
-    0x00000006, 0x0000001d, 0x00000000, 0x00000008, 0x00030037, 0x00000007, 0x0000001c, 0x000200f8,
-    0x0000001e, 0x0004003d, 0x00000006, 0x0000009f, 0x0000001c, 0x000500c2, 0x00000006, 0x000000a0,
-    0x0000009f, 0x00000089, 0x000500c7, 0x00000006, 0x000000a1, 0x000000a0, 0x00000056, 0x000200fe,
-    0x000000a1, 0x00010038, 0x00050036, 0x00000006, 0x00000024, 0x00000000, 0x0000001f, 0x00030037,
-    0x00000007, 0x00000020, 0x00030037, 0x00000007, 0x00000021, 0x00030037, 0x00000007, 0x00000022,
-    0x00030037, 0x00000007, 0x00000023, 0x000200f8, 0x00000025, 0x0004003d, 0x00000006, 0x000000a4,
-    0x00000020, 0x0007000c, 0x00000006, 0x000000a5, 0x00000001, 0x00000026, 0x000000a4, 0x00000056,
-    0x0004003d, 0x00000006, 0x000000a6, 0x00000021, 0x0007000c, 0x00000006, 0x000000a7, 0x00000001,
-    0x00000026, 0x000000a6, 0x00000056, 0x000500c4, 0x00000006, 0x000000a8, 0x000000a7, 0x00000081,
-    0x000500c5, 0x00000006, 0x000000a9, 0x000000a5, 0x000000a8, 0x0004003d, 0x00000006, 0x000000aa,
-    0x00000022, 0x0007000c, 0x00000006, 0x000000ab, 0x00000001, 0x00000026, 0x000000aa, 0x00000056,
-    0x000500c4, 0x00000006, 0x000000ac, 0x000000ab, 0x00000089, 0x000500c5, 0x00000006, 0x000000ad,
-    0x000000a9, 0x000000ac, 0x0004003d, 0x00000006, 0x000000ae, 0x00000023, 0x000500c4, 0x00000006,
-    0x000000af, 0x000000ae, 0x00000091, 0x000500c5, 0x00000006, 0x000000b0, 0x000000ad, 0x000000af,
-    0x000200fe, 0x000000b0, 0x00010038, 0x00050036, 0x00000006, 0x0000002a, 0x00000000, 0x0000001f,
-    0x00030037, 0x00000007, 0x00000026, 0x00030037, 0x00000007, 0x00000027, 0x00030037, 0x00000007,
-    0x00000028, 0x00030037, 0x00000007, 0x00000029, 0x000200f8, 0x0000002b, 0x0004003b, 0x00000007,
-    0x000000b3, 0x00000007, 0x0004003b, 0x00000007, 0x000000b8, 0x00000007, 0x0004003b, 0x00000007,
-    0x000000c2, 0x00000007, 0x0004003b, 0x00000007, 0x000000c7, 0x00000007, 0x0004003b, 0x00000007,
-    0x000000cf, 0x00000007, 0x0004003b, 0x00000007, 0x000000d4, 0x00000007, 0x0004003b, 0x00000007,
-    0x000000dc, 0x00000007, 0x0004003b, 0x00000007, 0x000000dd, 0x00000007, 0x0004003b, 0x00000007,
-    0x000000de, 0x00000007, 0x0004003b, 0x00000007, 0x000000df, 0x00000007, 0x0004003d, 0x00000006,
-    0x000000b4, 0x00000026, 0x0003003e, 0x000000b3, 0x000000b4, 0x00050039, 0x00000006, 0x000000b5,
-    0x00000017, 0x000000b3, 0x0004003d, 0x00000006, 0x000000b6, 0x00000028, 0x00050084, 0x00000006,
-    0x000000b7, 0x000000b5, 0x000000b6, 0x0004003d, 0x00000006, 0x000000b9, 0x00000027, 0x0003003e,
-    0x000000b8, 0x000000b9, 0x00050039, 0x00000006, 0x000000ba, 0x00000017, 0x000000b8, 0x0004003d,
-    0x00000006, 0x000000bb, 0x00000029, 0x00050084, 0x00000006, 0x000000bc, 0x000000ba, 0x000000bb,
-    0x00050080, 0x00000006, 0x000000bd, 0x000000b7, 0x000000bc, 0x00050080, 0x00000006, 0x000000bf,
-    0x000000bd, 0x000000be, 0x000500c2, 0x00000006, 0x000000c1, 0x000000bf, 0x000000c0, 0x0004003d,
-    0x00000006, 0x000000c3, 0x00000026, 0x0003003e, 0x000000c2, 0x000000c3, 0x00050039, 0x00000006,
-    0x000000c4, 0x0000001a, 0x000000c2, 0x0004003d, 0x00000006, 0x000000c5, 0x00000028, 0x00050084,
-    0x00000006, 0x000000c6, 0x000000c4, 0x000000c5, 0x0004003d, 0x00000006, 0x000000c8, 0x00000027,
-    0x0003003e, 0x000000c7, 0x000000c8, 0x00050039, 0x00000006, 0x000000c9, 0x0000001a, 0x000000c7,
-    0x0004003d, 0x00000006, 0x000000ca, 0x00000029, 0x00050084, 0x00000006, 0x000000cb, 0x000000c9,
-    0x000000ca, 0x00050080, 0x00000006, 0x000000cc, 0x000000c6, 0x000000cb, 0x00050080, 0x00000006,
-    0x000000cd, 0x000000cc, 0x000000be, 0x000500c2, 0x00000006, 0x000000ce, 0x000000cd, 0x000000c0,
-    0x0004003d, 0x00000006, 0x000000d0, 0x00000026, 0x0003003e, 0x000000cf, 0x000000d0, 0x00050039,
-    0x00000006, 0x000000d1, 0x0000001d, 0x000000cf, 0x0004003d, 0x00000006, 0x000000d2, 0x00000028,
-    0x00050084, 0x00000006, 0x000000d3, 0x000000d1, 0x000000d2, 0x0004003d, 0x00000006, 0x000000d5,
-    0x00000027, 0x0003003e, 0x000000d4, 0x000000d5, 0x00050039, 0x00000006, 0x000000d6, 0x0000001d,
-    0x000000d4, 0x0004003d, 0x00000006, 0x000000d7, 0x00000029, 0x00050084, 0x00000006, 0x000000d8,
-    0x000000d6, 0x000000d7, 0x00050080, 0x00000006, 0x000000d9, 0x000000d3, 0x000000d8, 0x00050080,
-    0x00000006, 0x000000da, 0x000000d9, 0x000000be, 0x000500c2, 0x00000006, 0x000000db, 0x000000da,
-    0x000000c0, 0x0003003e, 0x000000dc, 0x000000c1, 0x0003003e, 0x000000dd, 0x000000ce, 0x0003003e,
-    0x000000de, 0x000000db, 0x0003003e, 0x000000df, 0x0000005a, 0x00080039, 0x00000006, 0x000000e0,
-    0x00000024, 0x000000dc, 0x000000dd, 0x000000de, 0x000000df, 0x000200fe, 0x000000e0, 0x00010038,
-    0x00050036, 0x00000006, 0x0000002f, 0x00000000, 0x0000002c, 0x00030037, 0x00000007, 0x0000002d,
-    0x00030037, 0x00000007, 0x0000002e, 0x000200f8, 0x00000030, 0x0004003b, 0x00000007, 0x000000e3,
-    0x00000007, 0x0004003b, 0x00000007, 0x000000e8, 0x00000007, 0x0004003b, 0x00000007, 0x000000ec,
-    0x00000007, 0x0004003b, 0x00000007, 0x000000f1, 0x00000007, 0x0004003b, 0x00000007, 0x000000fb,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000100, 0x00000007, 0x0004003b, 0x00000007, 0x00000108,
-    0x00000007, 0x0004003b, 0x00000007, 0x0000010d, 0x00000007, 0x0004003b, 0x00000007, 0x00000115,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000116, 0x00000007, 0x0004003b, 0x00000007, 0x00000117,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000118, 0x00000007, 0x0004003d, 0x00000006, 0x000000e4,
-    0x0000002d, 0x000500c2, 0x00000006, 0x000000e5, 0x000000e4, 0x00000091, 0x000500c7, 0x00000006,
-    0x000000e6, 0x000000e5, 0x0000005f, 0x00050080, 0x00000006, 0x000000e7, 0x000000e6, 0x0000007d,
-    0x0003003e, 0x000000e3, 0x000000e7, 0x0004003d, 0x00000006, 0x000000ea, 0x000000e3, 0x00050082,
-    0x00000006, 0x000000eb, 0x000000e9, 0x000000ea, 0x0003003e, 0x000000e8, 0x000000eb, 0x0004003d,
-    0x00000006, 0x000000ed, 0x0000002d, 0x0003003e, 0x000000ec, 0x000000ed, 0x00050039, 0x00000006,
-    0x000000ee, 0x00000017, 0x000000ec, 0x0004003d, 0x00000006, 0x000000ef, 0x000000e3, 0x00050084,
-    0x00000006, 0x000000f0, 0x000000ee, 0x000000ef, 0x0004003d, 0x00000006, 0x000000f2, 0x0000002e,
-    0x0003003e, 0x000000f1, 0x000000f2, 0x00050039, 0x00000006, 0x000000f3, 0x00000017, 0x000000f1,
-    0x0004003d, 0x00000006, 0x000000f4, 0x000000e8, 0x00050084, 0x00000006, 0x000000f5, 0x000000f3,
-    0x000000f4, 0x00050080, 0x00000006, 0x000000f6, 0x000000f0, 0x000000f5, 0x00050080, 0x00000006,
-    0x000000f8, 0x000000f6, 0x000000f7, 0x000500c2, 0x00000006, 0x000000fa, 0x000000f8, 0x000000f9,
-    0x0004003d, 0x00000006, 0x000000fc, 0x0000002d, 0x0003003e, 0x000000fb, 0x000000fc, 0x00050039,
-    0x00000006, 0x000000fd, 0x0000001a, 0x000000fb, 0x0004003d, 0x00000006, 0x000000fe, 0x000000e3,
-    0x00050084, 0x00000006, 0x000000ff, 0x000000fd, 0x000000fe, 0x0004003d, 0x00000006, 0x00000101,
-    0x0000002e, 0x0003003e, 0x00000100, 0x00000101, 0x00050039, 0x00000006, 0x00000102, 0x0000001a,
-    0x00000100, 0x0004003d, 0x00000006, 0x00000103, 0x000000e8, 0x00050084, 0x00000006, 0x00000104,
-    0x00000102, 0x00000103, 0x00050080, 0x00000006, 0x00000105, 0x000000ff, 0x00000104, 0x00050080,
-    0x00000006, 0x00000106, 0x00000105, 0x000000f7, 0x000500c2, 0x00000006, 0x00000107, 0x00000106,
-    0x000000f9, 0x0004003d, 0x00000006, 0x00000109, 0x0000002d, 0x0003003e, 0x00000108, 0x00000109,
-    0x00050039, 0x00000006, 0x0000010a, 0x0000001d, 0x00000108, 0x0004003d, 0x00000006, 0x0000010b,
-    0x000000e3, 0x00050084, 0x00000006, 0x0000010c, 0x0000010a, 0x0000010b, 0x0004003d, 0x00000006,
-    0x0000010e, 0x0000002e, 0x0003003e, 0x0000010d, 0x0000010e, 0x00050039, 0x00000006, 0x0000010f,
-    0x0000001d, 0x0000010d, 0x0004003d, 0x00000006, 0x00000110, 0x000000e8, 0x00050084, 0x00000006,
-    0x00000111, 0x0000010f, 0x00000110, 0x00050080, 0x00000006, 0x00000112, 0x0000010c, 0x00000111,
-    0x00050080, 0x00000006, 0x00000113, 0x00000112, 0x000000f7, 0x000500c2, 0x00000006, 0x00000114,
-    0x00000113, 0x000000f9, 0x0003003e, 0x00000115, 0x000000fa, 0x0003003e, 0x00000116, 0x00000107,
-    0x0003003e, 0x00000117, 0x00000114, 0x0003003e, 0x00000118, 0x0000005a, 0x00080039, 0x00000006,
-    0x00000119, 0x00000024, 0x00000115, 0x00000116, 0x00000117, 0x00000118, 0x000200fe, 0x00000119,
-    0x00010038, 0x00050036, 0x00000006, 0x00000035, 0x00000000, 0x00000031, 0x00030037, 0x00000007,
-    0x00000032, 0x00030037, 0x00000007, 0x00000033, 0x00030037, 0x00000007, 0x00000034, 0x000200f8,
-    0x00000036, 0x0004003b, 0x00000007, 0x0000011c, 0x00000007, 0x0004003b, 0x00000007, 0x0000011f,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000129, 0x00000007, 0x0004003b, 0x00000007, 0x0000012c,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000136, 0x00000007, 0x0004003b, 0x00000007, 0x00000139,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000143, 0x00000007, 0x0004003b, 0x00000007, 0x00000144,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000145, 0x00000007, 0x0004003b, 0x00000007, 0x00000146,
-    0x00000007, 0x0004003d, 0x00000006, 0x0000011d, 0x00000032, 0x0003003e, 0x0000011c, 0x0000011d,
-    0x00050039, 0x00000006, 0x0000011e, 0x00000017, 0x0000011c, 0x0004003d, 0x00000006, 0x00000120,
-    0x00000032, 0x0003003e, 0x0000011f, 0x00000120, 0x00050039, 0x00000006, 0x00000121, 0x00000017,
-    0x0000011f, 0x00050082, 0x00000006, 0x00000122, 0x00000056, 0x00000121, 0x0004003d, 0x00000006,
-    0x00000123, 0x00000033, 0x00050084, 0x00000006, 0x00000124, 0x00000122, 0x00000123, 0x0004003d,
-    0x00000006, 0x00000125, 0x00000034, 0x00050080, 0x00000006, 0x00000126, 0x00000124, 0x00000125,
-    0x000500c2, 0x00000006, 0x00000127, 0x00000126, 0x000000c0, 0x00050080, 0x00000006, 0x00000128,
-    0x0000011e, 0x00000127, 0x0004003d, 0x00000006, 0x0000012a, 0x00000032, 0x0003003e, 0x00000129,
-    0x0000012a, 0x00050039, 0x00000006, 0x0000012b, 0x0000001a, 0x00000129, 0x0004003d, 0x00000006,
-    0x0000012d, 0x00000032, 0x0003003e, 0x0000012c, 0x0000012d, 0x00050039, 0x00000006, 0x0000012e,
-    0x0000001a, 0x0000012c, 0x00050082, 0x00000006, 0x0000012f, 0x00000056, 0x0000012e, 0x0004003d,
-    0x00000006, 0x00000130, 0x00000033, 0x00050084, 0x00000006, 0x00000131, 0x0000012f, 0x00000130,
-    0x0004003d, 0x00000006, 0x00000132, 0x00000034, 0x00050080, 0x00000006, 0x00000133, 0x00000131,
-    0x00000132, 0x000500c2, 0x00000006, 0x00000134, 0x00000133, 0x000000c0, 0x00050080, 0x00000006,
-    0x00000135, 0x0000012b, 0x00000134, 0x0004003d, 0x00000006, 0x00000137, 0x00000032, 0x0003003e,
-    0x00000136, 0x00000137, 0x00050039, 0x00000006, 0x00000138, 0x0000001d, 0x00000136, 0x0004003d,
-    0x00000006, 0x0000013a, 0x00000032, 0x0003003e, 0x00000139, 0x0000013a, 0x00050039, 0x00000006,
-    0x0000013b, 0x0000001d, 0x00000139, 0x00050082, 0x00000006, 0x0000013c, 0x00000056, 0x0000013b,
-    0x0004003d, 0x00000006, 0x0000013d, 0x00000033, 0x00050084, 0x00000006, 0x0000013e, 0x0000013c,
-    0x0000013d, 0x0004003d, 0x00000006, 0x0000013f, 0x00000034, 0x00050080, 0x00000006, 0x00000140,
-    0x0000013e, 0x0000013f, 0x000500c2, 0x00000006, 0x00000141, 0x00000140, 0x000000c0, 0x00050080,
-    0x00000006, 0x00000142, 0x00000138, 0x00000141, 0x0003003e, 0x00000143, 0x00000128, 0x0003003e,
-    0x00000144, 0x00000135, 0x0003003e, 0x00000145, 0x00000142, 0x0003003e, 0x00000146, 0x0000005a,
-    0x00080039, 0x00000006, 0x00000147, 0x00000024, 0x00000143, 0x00000144, 0x00000145, 0x00000146,
-    0x000200fe, 0x00000147, 0x00010038, 0x00050036, 0x00000006, 0x0000003a, 0x00000000, 0x00000031,
-    0x00030037, 0x00000007, 0x00000037, 0x00030037, 0x00000007, 0x00000038, 0x00030037, 0x00000007,
-    0x00000039, 0x000200f8, 0x0000003b, 0x0004003b, 0x00000007, 0x0000014a, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000014d, 0x00000007, 0x0004003b, 0x00000007, 0x00000156, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000159, 0x00000007, 0x0004003b, 0x00000007, 0x00000162, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000165, 0x00000007, 0x0004003b, 0x00000007, 0x0000016e, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000016f, 0x00000007, 0x0004003b, 0x00000007, 0x00000170, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000171, 0x00000007, 0x0004003d, 0x00000006, 0x0000014b, 0x00000037, 0x0003003e,
-    0x0000014a, 0x0000014b, 0x00050039, 0x00000006, 0x0000014c, 0x00000017, 0x0000014a, 0x0004003d,
-    0x00000006, 0x0000014e, 0x00000037, 0x0003003e, 0x0000014d, 0x0000014e, 0x00050039, 0x00000006,
-    0x0000014f, 0x00000017, 0x0000014d, 0x0004003d, 0x00000006, 0x00000150, 0x00000038, 0x00050084,
-    0x00000006, 0x00000151, 0x0000014f, 0x00000150, 0x0004003d, 0x00000006, 0x00000152, 0x00000039,
-    0x00050080, 0x00000006, 0x00000153, 0x00000151, 0x00000152, 0x000500c2, 0x00000006, 0x00000154,
-    0x00000153, 0x000000c0, 0x00050082, 0x00000006, 0x00000155, 0x0000014c, 0x00000154, 0x0004003d,
-    0x00000006, 0x00000157, 0x00000037, 0x0003003e, 0x00000156, 0x00000157, 0x00050039, 0x00000006,
-    0x00000158, 0x0000001a, 0x00000156, 0x0004003d, 0x00000006, 0x0000015a, 0x00000037, 0x0003003e,
-    0x00000159, 0x0000015a, 0x00050039, 0x00000006, 0x0000015b, 0x0000001a, 0x00000159, 0x0004003d,
-    0x00000006, 0x0000015c, 0x00000038, 0x00050084, 0x00000006, 0x0000015d, 0x0000015b, 0x0000015c,
-    0x0004003d, 0x00000006, 0x0000015e, 0x00000039, 0x00050080, 0x00000006, 0x0000015f, 0x0000015d,
-    0x0000015e, 0x000500c2, 0x00000006, 0x00000160, 0x0000015f, 0x000000c0, 0x00050082, 0x00000006,
-    0x00000161, 0x00000158, 0x00000160, 0x0004003d, 0x00000006, 0x00000163, 0x00000037, 0x0003003e,
-    0x00000162, 0x00000163, 0x00050039, 0x00000006, 0x00000164, 0x0000001d, 0x00000162, 0x0004003d,
-    0x00000006, 0x00000166, 0x00000037, 0x0003003e, 0x00000165, 0x00000166, 0x00050039, 0x00000006,
-    0x00000167, 0x0000001d, 0x00000165, 0x0004003d, 0x00000006, 0x00000168, 0x00000038, 0x00050084,
-    0x00000006, 0x00000169, 0x00000167, 0x00000168, 0x0004003d, 0x00000006, 0x0000016a, 0x00000039,
-    0x00050080, 0x00000006, 0x0000016b, 0x00000169, 0x0000016a, 0x000500c2, 0x00000006, 0x0000016c,
-    0x0000016b, 0x000000c0, 0x00050082, 0x00000006, 0x0000016d, 0x00000164, 0x0000016c, 0x0003003e,
-    0x0000016e, 0x00000155, 0x0003003e, 0x0000016f, 0x00000161, 0x0003003e, 0x00000170, 0x0000016d,
-    0x0003003e, 0x00000171, 0x0000005a, 0x00080039, 0x00000006, 0x00000172, 0x00000024, 0x0000016e,
-    0x0000016f, 0x00000170, 0x00000171, 0x000200fe, 0x00000172, 0x00010038, 0x00050036, 0x00000006,
-    0x00000041, 0x00000000, 0x0000003e, 0x00030037, 0x00000007, 0x0000003f, 0x00030037, 0x0000003d,
-    0x00000040, 0x000200f8, 0x00000042, 0x0004003b, 0x00000007, 0x00000175, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000179, 0x00000007, 0x0004003b, 0x00000007, 0x0000017e, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000183, 0x00000007, 0x0004003b, 0x00000007, 0x0000018a, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000194, 0x00000007, 0x0004003d, 0x00000006, 0x00000176, 0x0000003f, 0x000500c7,
-    0x00000006, 0x00000178, 0x00000176, 0x00000177, 0x0003003e, 0x00000175, 0x00000178, 0x0004003d,
-    0x00000006, 0x0000017a, 0x0000003f, 0x000500c2, 0x00000006, 0x0000017c, 0x0000017a, 0x0000017b,
-    0x000500c7, 0x00000006, 0x0000017d, 0x0000017c, 0x0000008d, 0x0003003e, 0x00000179, 0x0000017d,
-    0x0004003d, 0x00000006, 0x0000017f, 0x0000003f, 0x000500c2, 0x00000006, 0x00000181, 0x0000017f,
-    0x00000180, 0x000500c7, 0x00000006, 0x00000182, 0x00000181, 0x0000007d, 0x0003003e, 0x0000017e,
-    0x00000182, 0x0003003e, 0x00000183, 0x00000189, 0x0004003d, 0x00000006, 0x0000018b, 0x0000017e,
-    0x00050084, 0x00000006, 0x0000018d, 0x0000018b, 0x0000018c, 0x0004003d, 0x00000006, 0x0000018e,
-    0x00000179, 0x00050080, 0x00000006, 0x0000018f, 0x0000018d, 0x0000018e, 0x00050084, 0x00000006,
-    0x00000191, 0x0000018f, 0x00000190, 0x0004003d, 0x00000006, 0x00000192, 0x00000175, 0x00050080,
-    0x00000006, 0x00000193, 0x00000191, 0x00000192, 0x0003003e, 0x0000018a, 0x00000193, 0x00050041,
-    0x00000007, 0x00000195, 0x00000040, 0x0000007d, 0x0004003d, 0x00000006, 0x00000196, 0x00000195,
-    0x00050084, 0x00000006, 0x00000198, 0x00000196, 0x00000197, 0x00050041, 0x00000007, 0x00000199,
-    0x00000040, 0x00000078, 0x0004003d, 0x00000006, 0x0000019a, 0x00000199, 0x00050080, 0x00000006,
-    0x0000019b, 0x00000198, 0x0000019a, 0x0003003e, 0x00000194, 0x0000019b, 0x0004003d, 0x00000006,
-    0x000001a1, 0x0000018a, 0x0004003d, 0x00000006, 0x000001a2, 0x00000183, 0x00050084, 0x00000006,
-    0x000001a3, 0x000001a1, 0x000001a2, 0x0004003d, 0x00000006, 0x000001a4, 0x00000194, 0x00050080,
-    0x00000006, 0x000001a5, 0x000001a3, 0x000001a4, 0x00060041, 0x000001a6, 0x000001a7, 0x0000019f,
-    0x000001a0, 0x000001a5, 0x0004003d, 0x00000006, 0x000001a8, 0x000001a7, 0x000200fe, 0x000001a8,
-    0x00010038, 0x00050036, 0x00000006, 0x00000046, 0x00000000, 0x00000043, 0x00030037, 0x0000003d,
-    0x00000044, 0x00030037, 0x00000007, 0x00000045, 0x000200f8, 0x00000047, 0x0004003b, 0x00000007,
-    0x000001ab, 0x00000007, 0x0004003b, 0x000001b1, 0x000001b2, 0x00000007, 0x0004003b, 0x000001b1,
-    0x000001b7, 0x00000007, 0x0004003b, 0x00000007, 0x000001dc, 0x00000007, 0x0004003b, 0x00000011,
-    0x000001e4, 0x00000007, 0x0004003d, 0x00000006, 0x000001ac, 0x00000045, 0x000500c2, 0x00000006,
-    0x000001ae, 0x000001ac, 0x000001ad, 0x000500c7, 0x00000006, 0x000001b0, 0x000001ae, 0x000001af,
-    0x0003003e, 0x000001ab, 0x000001b0, 0x0004003d, 0x00000006, 0x000001b3, 0x000001ab, 0x000500c7,
-    0x00000006, 0x000001b5, 0x000001b3, 0x000001b4, 0x000500ab, 0x00000048, 0x000001b6, 0x000001b5,
-    0x00000078, 0x000300f7, 0x000001b9, 0x00000000, 0x000400fa, 0x000001b6, 0x000001b8, 0x000001c4,
-    0x000200f8, 0x000001b8, 0x00050041, 0x00000007, 0x000001ba, 0x00000044, 0x00000078, 0x0004003d,
-    0x00000006, 0x000001bb, 0x000001ba, 0x0004007c, 0x0000000f, 0x000001bc, 0x000001bb, 0x0004003d,
-    0x00000006, 0x000001be, 0x000001ab, 0x00050082, 0x00000006, 0x000001bf, 0x000001bd, 0x000001be,
-    0x00050084, 0x00000006, 0x000001c1, 0x000001bf, 0x000001c0, 0x0004007c, 0x0000000f, 0x000001c2,
-    0x000001c1, 0x00050082, 0x0000000f, 0x000001c3, 0x000001bc, 0x000001c2, 0x0003003e, 0x000001b7,
-    0x000001c3, 0x000200f9, 0x000001b9, 0x000200f8, 0x000001c4, 0x00050041, 0x00000007, 0x000001c5,
-    0x00000044, 0x00000078, 0x0004003d, 0x00000006, 0x000001c6, 0x000001c5, 0x0004007c, 0x0000000f,
-    0x000001c7, 0x000001c6, 0x0004003d, 0x00000006, 0x000001c8, 0x000001ab, 0x00050084, 0x00000006,
-    0x000001ca, 0x000001c8, 0x000001c9, 0x0004007c, 0x0000000f, 0x000001cb, 0x000001ca, 0x00050080,
-    0x0000000f, 0x000001cc, 0x000001c7, 0x000001cb, 0x0003003e, 0x000001b7, 0x000001cc, 0x000200f9,
-    0x000001b9, 0x000200f8, 0x000001b9, 0x0004003d, 0x0000000f, 0x000001cd, 0x000001b7, 0x0003003e,
-    0x000001b2, 0x000001cd, 0x00050041, 0x000001d2, 0x000001d3, 0x000001d0, 0x000001d1, 0x0004003d,
-    0x00000006, 0x000001d4, 0x000001d3, 0x000500ab, 0x00000048, 0x000001d5, 0x000001d4, 0x00000078,
-    0x0004003d, 0x0000000f, 0x000001d6, 0x000001b2, 0x000500af, 0x00000048, 0x000001d7, 0x000001d6,
-    0x000001a0, 0x000500a7, 0x00000048, 0x000001d8, 0x000001d5, 0x000001d7, 0x0004003d, 0x0000000f,
-    0x000001d9, 0x000001b2, 0x000500b1, 0x00000048, 0x000001da, 0x000001d9, 0x00000184, 0x000500a7,
-    0x00000048, 0x000001db, 0x000001d8, 0x000001da, 0x000300f7, 0x000001de, 0x00000000, 0x000400fa,
-    0x000001db, 0x000001dd, 0x000001e6, 0x000200f8, 0x000001dd, 0x0004003d, 0x0000000f, 0x000001df,
-    0x000001b2, 0x00050041, 0x00000007, 0x000001e0, 0x00000044, 0x0000007d, 0x0004003d, 0x00000006,
-    0x000001e1, 0x000001e0, 0x0004007c, 0x0000000f, 0x000001e2, 0x000001e1, 0x00050050, 0x00000010,
-    0x000001e3, 0x000001df, 0x000001e2, 0x0003003e, 0x000001e4, 0x000001e3, 0x00050039, 0x00000006,
-    0x000001e5, 0x00000014, 0x000001e4, 0x0003003e, 0x000001dc, 0x000001e5, 0x000200f9, 0x000001de,
-    0x000200f8, 0x000001e6, 0x0003003e, 0x000001dc, 0x00000078, 0x000200f9, 0x000001de, 0x000200f8,
-    0x000001de, 0x0004003d, 0x00000006, 0x000001e7, 0x000001dc, 0x000200fe, 0x000001e7, 0x00010038,
-    0x00050036, 0x00000006, 0x00000050, 0x00000000, 0x0000004a, 0x00030037, 0x00000007, 0x0000004b,
-    0x00030037, 0x0000003d, 0x0000004c, 0x00030037, 0x00000007, 0x0000004d, 0x00030037, 0x00000007,
-    0x0000004e, 0x00030037, 0x00000049, 0x0000004f, 0x000200f8, 0x00000051, 0x0004003b, 0x00000007,
-    0x000001ea, 0x00000007, 0x0004003b, 0x00000007, 0x000001ec, 0x00000007, 0x0004003b, 0x00000007,
-    0x000001f6, 0x00000007, 0x0004003b, 0x00000007, 0x000001fe, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000206, 0x00000007, 0x0004003b, 0x00000007, 0x0000020e, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000212, 0x00000007, 0x0004003b, 0x00000007, 0x00000224, 0x00000007, 0x0004003b, 0x0000003d,
-    0x00000226, 0x00000007, 0x0004003b, 0x00000007, 0x0000022b, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000235, 0x00000007, 0x0004003b, 0x0000003d, 0x00000237, 0x00000007, 0x0004003b, 0x0000003d,
-    0x0000023d, 0x00000007, 0x0004003b, 0x00000007, 0x0000023f, 0x00000007, 0x0004003b, 0x00000007,
-    0x0000024a, 0x00000007, 0x0004003b, 0x00000007, 0x0000024e, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000252, 0x00000007, 0x0004003b, 0x00000007, 0x00000261, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000263, 0x00000007, 0x0004003b, 0x00000007, 0x00000265, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000267, 0x00000007, 0x0004003b, 0x00000007, 0x0000026f, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000271, 0x00000007, 0x0004003b, 0x00000007, 0x00000273, 0x00000007, 0x0004003b, 0x00000007,
-    0x0000027b, 0x00000007, 0x0004003b, 0x00000007, 0x0000027d, 0x00000007, 0x0004003b, 0x00000007,
-    0x0000027f, 0x00000007, 0x0004003b, 0x00000007, 0x00000286, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000288, 0x00000007, 0x0003003e, 0x000001ea, 0x000001eb, 0x0004003d, 0x00000006, 0x000001f1,
-    0x000001ea, 0x0004003d, 0x00000006, 0x000001f2, 0x0000004d, 0x00050080, 0x00000006, 0x000001f3,
-    0x000001f1, 0x000001f2, 0x00060041, 0x000001a6, 0x000001f4, 0x000001f0, 0x000001a0, 0x000001f3,
-    0x0004003d, 0x00000006, 0x000001f5, 0x000001f4, 0x0003003e, 0x000001ec, 0x000001f5, 0x0004003d,
-    0x00000006, 0x000001f7, 0x000001ea, 0x00050080, 0x00000006, 0x000001f9, 0x000001f7, 0x000001f8,
-    0x0004003d, 0x00000006, 0x000001fa, 0x0000004d, 0x00050080, 0x00000006, 0x000001fb, 0x000001f9,
-    0x000001fa, 0x00060041, 0x000001a6, 0x000001fc, 0x000001f0, 0x000001a0, 0x000001fb, 0x0004003d,
-    0x00000006, 0x000001fd, 0x000001fc, 0x0003003e, 0x000001f6, 0x000001fd, 0x0004003d, 0x00000006,
-    0x000001ff, 0x000001ea, 0x00050080, 0x00000006, 0x00000201, 0x000001ff, 0x00000200, 0x0004003d,
-    0x00000006, 0x00000202, 0x0000004d, 0x00050080, 0x00000006, 0x00000203, 0x00000201, 0x00000202,
-    0x00060041, 0x000001a6, 0x00000204, 0x000001f0, 0x000001a0, 0x00000203, 0x0004003d, 0x00000006,
-    0x00000205, 0x00000204, 0x0003003e, 0x000001fe, 0x00000205, 0x0004003d, 0x00000006, 0x00000207,
-    0x000001ea, 0x00050080, 0x00000006, 0x00000209, 0x00000207, 0x00000208, 0x0004003d, 0x00000006,
-    0x0000020a, 0x0000004d, 0x00050080, 0x00000006, 0x0000020b, 0x00000209, 0x0000020a, 0x00060041,
-    0x000001a6, 0x0000020c, 0x000001f0, 0x000001a0, 0x0000020b, 0x0004003d, 0x00000006, 0x0000020d,
-    0x0000020c, 0x0003003e, 0x00000206, 0x0000020d, 0x0004003d, 0x00000006, 0x0000020f, 0x000001fe,
-    0x000500c2, 0x00000006, 0x00000211, 0x0000020f, 0x00000210, 0x0003003e, 0x0000020e, 0x00000211,
-    0x0004003d, 0x00000006, 0x00000213, 0x000001ec, 0x0003003e, 0x00000212, 0x00000213, 0x0004003d,
-    0x00000006, 0x00000214, 0x0000020e, 0x000500c7, 0x00000006, 0x00000216, 0x00000214, 0x00000215,
-    0x000500aa, 0x00000048, 0x00000217, 0x00000216, 0x00000078, 0x000300f7, 0x00000219, 0x00000000,
-    0x000400fa, 0x00000217, 0x00000218, 0x00000219, 0x000200f8, 0x00000218, 0x0004003d, 0x00000006,
-    0x0000021a, 0x00000206, 0x000500c7, 0x00000006, 0x0000021c, 0x0000021a, 0x0000021b, 0x000500ab,
-    0x00000048, 0x0000021d, 0x0000021c, 0x00000078, 0x000300f7, 0x0000021f, 0x00000000, 0x000400fa,
-    0x0000021d, 0x0000021e, 0x0000021f, 0x000200f8, 0x0000021e, 0x0004003d, 0x0000003c, 0x00000220,
-    0x0000004c, 0x00050050, 0x0000003c, 0x00000222, 0x00000221, 0x00000221, 0x00050089, 0x0000003c,
-    0x00000223, 0x00000220, 0x00000222, 0x0004003d, 0x00000006, 0x00000225, 0x00000206, 0x0003003e,
-    0x00000224, 0x00000225, 0x0003003e, 0x00000226, 0x00000223, 0x00060039, 0x00000006, 0x00000227,
-    0x00000041, 0x00000224, 0x00000226, 0x000200fe, 0x00000227, 0x000200f8, 0x0000021f, 0x0004003d,
-    0x00000006, 0x00000229, 0x00000212, 0x000200fe, 0x00000229, 0x000200f8, 0x00000219, 0x0003003e,
-    0x0000022b, 0x00000078, 0x0004003d, 0x00000006, 0x0000022c, 0x00000206, 0x000500c7, 0x00000006,
-    0x0000022d, 0x0000022c, 0x0000021b, 0x000500ab, 0x00000048, 0x0000022e, 0x0000022d, 0x00000078,
-    0x000300f7, 0x00000230, 0x00000000, 0x000400fa, 0x0000022e, 0x0000022f, 0x00000239, 0x000200f8,
-    0x0000022f, 0x0004003d, 0x0000003c, 0x00000231, 0x0000004c, 0x00050050, 0x0000003c, 0x00000233,
-    0x00000232, 0x00000232, 0x00050089, 0x0000003c, 0x00000234, 0x00000231, 0x00000233, 0x0004003d,
-    0x00000006, 0x00000236, 0x00000206, 0x0003003e, 0x00000235, 0x00000236, 0x0003003e, 0x00000237,
-    0x00000234, 0x00060039, 0x00000006, 0x00000238, 0x00000041, 0x00000235, 0x00000237, 0x0003003e,
-    0x0000022b, 0x00000238, 0x000200f9, 0x00000230, 0x000200f8, 0x00000239, 0x0004003d, 0x00000048,
-    0x0000023a, 0x0000004f, 0x000300f7, 0x0000023c, 0x00000000, 0x000400fa, 0x0000023a, 0x0000023b,
-    0x0000023c, 0x000200f8, 0x0000023b, 0x0004003d, 0x0000003c, 0x0000023e, 0x0000004c, 0x0003003e,
-    0x0000023d, 0x0000023e, 0x0004003d, 0x00000006, 0x00000240, 0x0000004e, 0x0003003e, 0x0000023f,
-    0x00000240, 0x00060039, 0x00000006, 0x00000241, 0x00000046, 0x0000023d, 0x0000023f, 0x0003003e,
-    0x0000022b, 0x00000241, 0x000200f9, 0x0000023c, 0x000200f8, 0x0000023c, 0x000200f9, 0x00000230,
-    0x000200f8, 0x00000230, 0x0004003d, 0x00000006, 0x00000242, 0x0000022b, 0x000500c2, 0x00000006,
-    0x00000243, 0x00000242, 0x00000210, 0x000500c7, 0x00000006, 0x00000244, 0x00000243, 0x0000005f,
-    0x000500aa, 0x00000048, 0x00000245, 0x00000244, 0x00000078, 0x000300f7, 0x00000247, 0x00000000,
-    0x000400fa, 0x00000245, 0x00000246, 0x00000247, 0x000200f8, 0x00000246, 0x0004003d, 0x00000006,
-    0x00000248, 0x000001ec, 0x000200fe, 0x00000248, 0x000200f8, 0x00000247, 0x0004003d, 0x00000006,
-    0x0000024b, 0x0000020e, 0x000500c7, 0x00000006, 0x0000024d, 0x0000024b, 0x0000024c, 0x0003003e,
-    0x0000024a, 0x0000024d, 0x0004003d, 0x00000006, 0x0000024f, 0x000001fe, 0x000500c2, 0x00000006,
-    0x00000250, 0x0000024f, 0x000000be, 0x000500c7, 0x00000006, 0x00000251, 0x00000250, 0x0000005f,
-    0x0003003e, 0x0000024e, 0x00000251, 0x0004003d, 0x00000006, 0x00000253, 0x000001fe, 0x000500c2,
-    0x00000006, 0x00000254, 0x00000253, 0x000000f7, 0x000500c7, 0x00000006, 0x00000255, 0x00000254,
-    0x0000005f, 0x0003003e, 0x00000252, 0x00000255, 0x0004003d, 0x00000006, 0x00000256, 0x0000024a,
-    0x000500aa, 0x00000048, 0x00000257, 0x00000256, 0x0000007d, 0x000300f7, 0x00000259, 0x00000000,
-    0x000400fa, 0x00000257, 0x00000258, 0x00000259, 0x000200f8, 0x00000258, 0x0004003d, 0x00000006,
-    0x0000025a, 0x0000020e, 0x000500c7, 0x00000006, 0x0000025c, 0x0000025a, 0x0000025b, 0x000500ab,
-    0x00000048, 0x0000025d, 0x0000025c, 0x00000078, 0x000200f9, 0x00000259, 0x000200f8, 0x00000259,
-    0x000700f5, 0x00000048, 0x0000025e, 0x00000257, 0x00000247, 0x0000025d, 0x00000258, 0x000300f7,
-    0x00000260, 0x00000000, 0x000400fa, 0x0000025e, 0x0000025f, 0x00000260, 0x000200f8, 0x0000025f,
-    0x0004003d, 0x00000006, 0x00000262, 0x000001f6, 0x0003003e, 0x00000261, 0x00000262, 0x0004003d,
-    0x00000006, 0x00000264, 0x0000022b, 0x0003003e, 0x00000263, 0x00000264, 0x0004003d, 0x00000006,
-    0x00000266, 0x0000024e, 0x0003003e, 0x00000265, 0x00000266, 0x0004003d, 0x00000006, 0x00000268,
-    0x00000252, 0x0003003e, 0x00000267, 0x00000268, 0x00080039, 0x00000006, 0x00000269, 0x0000002a,
-    0x00000261, 0x00000263, 0x00000265, 0x00000267, 0x000200fe, 0x00000269, 0x000200f8, 0x00000260,
-    0x0004003d, 0x00000006, 0x0000026b, 0x0000024a, 0x000500aa, 0x00000048, 0x0000026c, 0x0000026b,
-    0x00000085, 0x000300f7, 0x0000026e, 0x00000000, 0x000400fa, 0x0000026c, 0x0000026d, 0x0000026e,
-    0x000200f8, 0x0000026d, 0x0004003d, 0x00000006, 0x00000270, 0x0000022b, 0x0003003e, 0x0000026f,
-    0x00000270, 0x0004003d, 0x00000006, 0x00000272, 0x0000024e, 0x0003003e, 0x00000271, 0x00000272,
-    0x0003003e, 0x00000273, 0x000000be, 0x00070039, 0x00000006, 0x00000274, 0x00000035, 0x0000026f,
-    0x00000271, 0x00000273, 0x000200fe, 0x00000274, 0x000200f8, 0x0000026e, 0x0004003d, 0x00000006,
-    0x00000276, 0x0000024a, 0x000500aa, 0x00000048, 0x00000277, 0x00000276, 0x0000008d, 0x000300f7,
-    0x00000279, 0x00000000, 0x000400fa, 0x00000277, 0x00000278, 0x00000279, 0x000200f8, 0x00000278,
-    0x0004003d, 0x00000006, 0x0000027c, 0x0000022b, 0x0003003e, 0x0000027b, 0x0000027c, 0x0004003d,
-    0x00000006, 0x0000027e, 0x0000024e, 0x0003003e, 0x0000027d, 0x0000027e, 0x0003003e, 0x0000027f,
-    0x0000027a, 0x00070039, 0x00000006, 0x00000280, 0x0000003a, 0x0000027b, 0x0000027d, 0x0000027f,
-    0x000200fe, 0x00000280, 0x000200f8, 0x00000279, 0x0004003d, 0x00000006, 0x00000282, 0x0000024a,
-    0x000500aa, 0x00000048, 0x00000283, 0x00000282, 0x0000018c, 0x000300f7, 0x00000285, 0x00000000,
-    0x000400fa, 0x00000283, 0x00000284, 0x00000285, 0x000200f8, 0x00000284, 0x0004003d, 0x00000006,
-    0x00000287, 0x0000022b, 0x0003003e, 0x00000286, 0x00000287, 0x0004003d, 0x00000006, 0x00000289,
-    0x000001ec, 0x0003003e, 0x00000288, 0x00000289, 0x00060039, 0x00000006, 0x0000028a, 0x0000002f,
-    0x00000286, 0x00000288, 0x000200fe, 0x0000028a, 0x000200f8, 0x00000285, 0x0004003d, 0x00000006,
-    0x0000028c, 0x0000022b, 0x000200fe, 0x0000028c, 0x00010038, 0x00050036, 0x00000006, 0x00000053,
-    0x00000000, 0x00000008, 0x00030037, 0x00000007, 0x00000052, 0x000200f8, 0x00000054, 0x0004003b,
-    0x00000007, 0x0000028f, 0x00000007, 0x0004003b, 0x00000007, 0x00000294, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000029a, 0x00000007, 0x0004003b, 0x00000007, 0x000002a0, 0x00000007, 0x0004003d,
-    0x00000006, 0x00000290, 0x00000052, 0x000500c7, 0x00000006, 0x00000291, 0x00000290, 0x00000056,
-    0x000500c2, 0x00000006, 0x00000292, 0x00000291, 0x0000007d, 0x000500c4, 0x00000006, 0x00000293,
-    0x00000292, 0x0000007d, 0x0003003e, 0x0000028f, 0x00000293, 0x0004003d, 0x00000006, 0x00000295,
-    0x00000052, 0x000500c2, 0x00000006, 0x00000296, 0x00000295, 0x000000be, 0x000500c7, 0x00000006,
-    0x00000297, 0x00000296, 0x00000056, 0x000500c2, 0x00000006, 0x00000298, 0x00000297, 0x0000007d,
-    0x000500c4, 0x00000006, 0x00000299, 0x00000298, 0x0000007d, 0x0003003e, 0x00000294, 0x00000299,
-    0x0004003d, 0x00000006, 0x0000029b, 0x00000052, 0x000500c2, 0x00000006, 0x0000029c, 0x0000029b,
-    0x000000f7, 0x000500c7, 0x00000006, 0x0000029d, 0x0000029c, 0x00000056, 0x000500c2, 0x00000006,
-    0x0000029e, 0x0000029d, 0x0000007d, 0x000500c4, 0x00000006, 0x0000029f, 0x0000029e, 0x0000007d,
-    0x0003003e, 0x0000029a, 0x0000029f, 0x0004003d, 0x00000006, 0x000002a1, 0x00000052, 0x000500c2,
-    0x00000006, 0x000002a2, 0x000002a1, 0x00000210, 0x000500ab, 0x00000048, 0x000002a3, 0x000002a2,
-    0x00000078, 0x000600a9, 0x00000006, 0x000002a4, 0x000002a3, 0x0000005f, 0x00000078, 0x0003003e,
-    0x000002a0, 0x000002a4, 0x0004003d, 0x00000006, 0x000002a5, 0x0000028f, 0x0004003d, 0x00000006,
-    0x000002a6, 0x00000294, 0x000500c4, 0x00000006, 0x000002a7, 0x000002a6, 0x000000be, 0x000500c5,
-    0x00000006, 0x000002a8, 0x000002a5, 0x000002a7, 0x0004003d, 0x00000006, 0x000002a9, 0x0000029a,
-    0x000500c4, 0x00000006, 0x000002aa, 0x000002a9, 0x000000f7, 0x000500c5, 0x00000006, 0x000002ab,
-    0x000002a8, 0x000002aa, 0x0004003d, 0x00000006, 0x000002ac, 0x000002a0, 0x000500c4, 0x00000006,
-    0x000002ad, 0x000002ac, 0x00000210, 0x000500c5, 0x00000006, 0x000002ae, 0x000002ab, 0x000002ad,
-    0x000200fe, 0x000002ae, 0x00010038,
+const uint8_t Blob034_Data[6624] =
+{
+    0x28, 0xb5, 0x2f, 0xfd, 0x60, 0xcc, 0x64, 0xb5, 0xce, 0x00, 0x5a, 0xe1, 0x18, 0x37, 0x36, 0x10,
+    0x68, 0xba, 0xc6, 0x80, 0x8b, 0x53, 0x20, 0x48, 0x4e, 0xa9, 0xc9, 0x2f, 0x0c, 0xcf, 0x09, 0x06,
+    0xb4, 0x66, 0xd8, 0xe2, 0x09, 0x31, 0x38, 0x3b, 0x64, 0x9b, 0x41, 0x6e, 0x5c, 0xa1, 0xa0, 0x7f,
+    0x29, 0x59, 0x0f, 0xdb, 0x32, 0xaf, 0x5f, 0xa7, 0xf4, 0x6c, 0xf2, 0xe5, 0xe5, 0x45, 0x8b, 0x91,
+    0x84, 0x80, 0xdb, 0x48, 0x0a, 0x13, 0x03, 0x5c, 0x03, 0x91, 0x03, 0x6f, 0xde, 0xd7, 0xeb, 0x1d,
+    0x4d, 0x0a, 0xbd, 0xdf, 0xa9, 0x45, 0x41, 0xbd, 0xd3, 0xaf, 0xd9, 0x73, 0xeb, 0xb3, 0x4e, 0xe7,
+    0xf4, 0xe8, 0xdc, 0xbc, 0x26, 0xa3, 0xd9, 0x74, 0xbf, 0xe6, 0xd7, 0x7e, 0x64, 0x40, 0x3b, 0x9a,
+    0xbf, 0x9d, 0xad, 0xfb, 0xe9, 0xf5, 0xfa, 0x8c, 0x0b, 0xb8, 0x46, 0xeb, 0x6a, 0x78, 0x3a, 0xd7,
+    0xcb, 0x69, 0x7a, 0x39, 0x9c, 0xdf, 0x9d, 0xf7, 0x1d, 0xad, 0x26, 0xab, 0x69, 0x67, 0xfe, 0x3f,
+    0x8b, 0xfd, 0xff, 0x2b, 0x2c, 0xef, 0x74, 0x66, 0xf6, 0xe3, 0xe6, 0xf4, 0xee, 0x47, 0x3e, 0x17,
+    0x40, 0x52, 0x0f, 0x3d, 0x9c, 0x90, 0x3e, 0x26, 0x87, 0x75, 0xb6, 0xa0, 0x27, 0xdf, 0x05, 0xa6,
+    0xf7, 0xbc, 0x76, 0x1e, 0xf7, 0xe3, 0xb3, 0xf5, 0x6e, 0xb1, 0x62, 0x57, 0x56, 0xd5, 0xd3, 0xfc,
+    0x4a, 0x0e, 0x1a, 0xc6, 0xfc, 0x2b, 0xf1, 0x9f, 0x9e, 0x44, 0x8b, 0x3c, 0xd3, 0x3a, 0x6a, 0x17,
+    0xf5, 0xc3, 0x75, 0x99, 0x9d, 0x36, 0x8f, 0xb5, 0x7f, 0x57, 0x87, 0x26, 0xf7, 0xdc, 0x37, 0x30,
+    0xdb, 0x9a, 0x56, 0x7b, 0x16, 0xa5, 0x45, 0x22, 0x7a, 0x5d, 0x0b, 0xf4, 0x84, 0xaf, 0xff, 0x60,
+    0xfe, 0xd3, 0xc4, 0xab, 0x68, 0xe3, 0x73, 0x6e, 0x36, 0xa3, 0x9e, 0x4b, 0x7f, 0x46, 0x8f, 0x54,
+    0x74, 0x4f, 0xc7, 0x04, 0x14, 0xaf, 0xf3, 0x70, 0x0d, 0x35, 0xb7, 0x5c, 0xbc, 0x0f, 0x9e, 0xdd,
+    0xca, 0x79, 0x78, 0x2f, 0xb7, 0xf5, 0x95, 0x2f, 0xc9, 0x30, 0xf2, 0xca, 0xf0, 0x86, 0x3f, 0xca,
+    0xb4, 0x84, 0xd7, 0x3e, 0x68, 0x44, 0x74, 0x37, 0x50, 0x0b, 0xee, 0x7f, 0xba, 0x38, 0xcf, 0xd6,
+    0x65, 0xe5, 0x5e, 0x1f, 0xef, 0xe6, 0xb7, 0xb2, 0xef, 0x57, 0xd7, 0xaf, 0xf7, 0xb2, 0x7a, 0xea,
+    0x09, 0xdd, 0x24, 0xe6, 0x51, 0xff, 0xe5, 0x65, 0xbf, 0x9c, 0x2c, 0xbe, 0xa7, 0xd7, 0x64, 0xf4,
+    0xc1, 0x3d, 0x9c, 0x7f, 0xf9, 0xd4, 0x3f, 0xfd, 0x35, 0x1b, 0x7d, 0x76, 0x1b, 0x8b, 0xd9, 0xe9,
+    0xb5, 0xdd, 0xe9, 0x77, 0x09, 0xf7, 0xb2, 0x6e, 0xfa, 0xba, 0xba, 0xd4, 0x8a, 0x18, 0xfd, 0xf9,
+    0xe3, 0x1c, 0xdd, 0xc7, 0x9d, 0xd1, 0xd5, 0x7e, 0x7e, 0x73, 0x7b, 0xf8, 0xab, 0xdd, 0x66, 0xb8,
+    0x77, 0xdb, 0xb7, 0x43, 0xe7, 0x69, 0xed, 0x5a, 0x07, 0x67, 0xbf, 0xad, 0xdf, 0x61, 0xc9, 0xe9,
+    0x1c, 0x2f, 0xcd, 0x56, 0xaf, 0xd5, 0xe7, 0x3d, 0x0d, 0x50, 0xcd, 0xa6, 0xeb, 0xd4, 0x8b, 0x41,
+    0xd7, 0xb6, 0x7c, 0x10, 0xaf, 0xa6, 0xf9, 0x7f, 0x3f, 0x36, 0x9a, 0x87, 0xef, 0x96, 0x29, 0xbf,
+    0x5c, 0xd6, 0xc5, 0x90, 0x6c, 0x8d, 0x80, 0xeb, 0x31, 0x39, 0xcf, 0xee, 0x3d, 0x93, 0xd6, 0xe9,
+    0xd4, 0x7a, 0x19, 0x6d, 0xce, 0xd5, 0x0e, 0x1e, 0x3f, 0xef, 0x64, 0x75, 0x5a, 0x1f, 0x3c, 0xfc,
+    0xc0, 0x73, 0x1e, 0x2e, 0x54, 0xab, 0xf5, 0xf4, 0x78, 0x9c, 0xb3, 0x05, 0xd1, 0xfb, 0x59, 0x0f,
+    0xef, 0xe1, 0xc5, 0xbd, 0xb1, 0xad, 0xa9, 0xa5, 0x85, 0x79, 0x51, 0x49, 0x21, 0x15, 0x05, 0x01,
+    0x01, 0xf8, 0xc1, 0xe9, 0x62, 0x5f, 0x8c, 0xaa, 0x69, 0x96, 0xd1, 0xd7, 0x4a, 0x11, 0x8d, 0x12,
+    0x9a, 0xc4, 0x93, 0x73, 0xd3, 0x86, 0x8c, 0xc8, 0xb7, 0xa1, 0x39, 0x4f, 0xe7, 0x68, 0xc2, 0xf1,
+    0xfa, 0x9c, 0xb3, 0x05, 0x05, 0xff, 0x03, 0xf5, 0x35, 0x60, 0xdd, 0x58, 0x67, 0x20, 0x67, 0x37,
+    0x26, 0x97, 0x73, 0x3c, 0xf5, 0xdc, 0xcb, 0xb5, 0xf5, 0xf1, 0xd9, 0x2d, 0x3f, 0xc7, 0xfd, 0x98,
+    0x0c, 0xf7, 0x67, 0x5d, 0x4f, 0x0f, 0x08, 0x9f, 0x99, 0xe9, 0xbe, 0xe6, 0xf3, 0xb5, 0x1e, 0x57,
+    0x5e, 0x53, 0xfb, 0x28, 0xb5, 0x2d, 0x5d, 0x9c, 0x66, 0xef, 0x6c, 0x65, 0xbd, 0x4d, 0xa6, 0x3b,
+    0x93, 0x01, 0xd7, 0xe4, 0xbc, 0xb1, 0x5e, 0xce, 0xc5, 0x6a, 0x33, 0xf1, 0x59, 0x4f, 0xeb, 0x7e,
+    0x7a, 0xd9, 0x8c, 0x16, 0x7b, 0x30, 0x9d, 0x8b, 0xf5, 0x31, 0xd9, 0x4e, 0x4f, 0xb3, 0xd7, 0xe8,
+    0x3c, 0xed, 0x2c, 0x0c, 0xec, 0xeb, 0x4c, 0xb8, 0xab, 0x09, 0xf8, 0x57, 0xe7, 0xe4, 0x30, 0xd7,
+    0x5a, 0x9c, 0xff, 0xd6, 0x6b, 0x3d, 0xba, 0x80, 0x5a, 0xad, 0x9f, 0xd7, 0x80, 0x7f, 0xe4, 0xf4,
+    0x77, 0xbd, 0x55, 0x55, 0xd7, 0xd5, 0xe3, 0x61, 0xa9, 0x7c, 0x50, 0x8f, 0x1a, 0x9f, 0x77, 0xb1,
+    0xae, 0x86, 0x5a, 0xab, 0xd3, 0x64, 0xbf, 0x27, 0xae, 0xf1, 0x59, 0x2f, 0xa3, 0x05, 0xc8, 0x73,
+    0xa6, 0xf0, 0xd2, 0x9f, 0x52, 0xd2, 0x6b, 0x03, 0xc5, 0x39, 0x5d, 0xd3, 0x77, 0x8b, 0x1e, 0xcd,
+    0x48, 0xe8, 0xdb, 0x86, 0xd2, 0x62, 0x00, 0x75, 0x5e, 0xe9, 0xbd, 0xbc, 0xa7, 0x01, 0xfd, 0x79,
+    0x27, 0xaf, 0xc9, 0xea, 0x1d, 0xdd, 0xa3, 0x45, 0x1e, 0x8c, 0x42, 0x63, 0x2b, 0xe7, 0x67, 0x32,
+    0xdb, 0x38, 0xdf, 0xe1, 0x7c, 0x6e, 0xba, 0x72, 0x40, 0x74, 0xf9, 0x0c, 0x47, 0x67, 0x97, 0xf3,
+    0x41, 0x9a, 0xff, 0x17, 0xcb, 0x62, 0x47, 0x79, 0x85, 0xff, 0xea, 0xf6, 0x3b, 0x30, 0x73, 0x7a,
+    0x3f, 0x17, 0xa8, 0x79, 0xee, 0x6f, 0xc7, 0xec, 0xb2, 0xf8, 0x4c, 0xee, 0xbe, 0x3e, 0x48, 0x5e,
+    0x8b, 0xf5, 0x34, 0x79, 0xdc, 0xa7, 0x9f, 0xc9, 0xe5, 0x3e, 0xbd, 0x5c, 0xb8, 0x56, 0xf7, 0xa1,
+    0xd1, 0xe2, 0xbe, 0x35, 0xb8, 0xb6, 0xb9, 0xb9, 0xb6, 0xbe, 0x9a, 0xdf, 0x6e, 0x66, 0xb5, 0xd8,
+    0xee, 0xce, 0xd6, 0xfb, 0x9f, 0xbd, 0x3c, 0x93, 0x73, 0xf3, 0xcf, 0xe8, 0xfc, 0xbf, 0xf6, 0x73,
+    0x1e, 0xab, 0x8b, 0xcb, 0x6a, 0xbc, 0x56, 0x5b, 0xc1, 0xd9, 0xc1, 0xb5, 0xe1, 0xff, 0xd8, 0xcf,
+    0xfe, 0xce, 0x6f, 0xa9, 0xbe, 0xfb, 0x36, 0x8f, 0xd5, 0x3e, 0x97, 0x29, 0xab, 0x0d, 0x74, 0x7d,
+    0x0a, 0xdc, 0x7d, 0x08, 0x0e, 0x24, 0x78, 0x34, 0x70, 0xc0, 0xc0, 0x9e, 0xdf, 0x5e, 0x1e, 0x1f,
+    0x5e, 0x1e, 0x11, 0xde, 0x17, 0xb0, 0x93, 0xab, 0xb3, 0x23, 0x50, 0x47, 0x37, 0x47, 0xa0, 0x94,
+    0x2e, 0x2e, 0xaa, 0x2a, 0xee, 0x0a, 0xee, 0x0d, 0xcc, 0xb6, 0x96, 0x46, 0x07, 0x47, 0x33, 0xe0,
+    0x8d, 0x6c, 0x80, 0x1b, 0xd8, 0xad, 0x8d, 0xad, 0xb4, 0x0d, 0x6d, 0x4d, 0x2d, 0x0d, 0x48, 0xed,
+    0xcc, 0x0c, 0xed, 0xac, 0xcc, 0xac, 0x8c, 0xec, 0xea, 0x5b, 0x95, 0xf5, 0xfd, 0x6f, 0x8f, 0x6d,
+    0x89, 0x65, 0x85, 0x81, 0xb1, 0x89, 0xe1, 0x1f, 0x26, 0x20, 0x0c, 0x49, 0xc0, 0x17, 0x98, 0x57,
+    0xd7, 0xd7, 0x18, 0x9d, 0xa8, 0x17, 0x57, 0x17, 0x97, 0xd6, 0x98, 0x16, 0xd6, 0x16, 0x11, 0x96,
+    0x15, 0x99, 0x15, 0xd5, 0x55, 0xeb, 0x14, 0x95, 0x65, 0x00, 0xa9, 0xa9, 0x55, 0x29, 0x28, 0xa4,
+    0x27, 0x28, 0xa7, 0xa7, 0x26, 0x26, 0x27, 0xcc, 0xa6, 0xa5, 0x24, 0xa6, 0x26, 0x4a, 0x4b, 0x6f,
+    0x20, 0xa5, 0x23, 0xa2, 0xb6, 0xd1, 0x11, 0xd8, 0xb2, 0xb5, 0xc8, 0x88, 0xb3, 0x68, 0x08, 0xc8,
+    0x2d, 0x34, 0xc4, 0x29, 0x19, 0x24, 0xb4, 0x19, 0xe4, 0xf3, 0xe3, 0xd3, 0xf3, 0xc3, 0xd3, 0xb3,
+    0xe3, 0xe5, 0x79, 0xdd, 0x21, 0xf5, 0xd6, 0xe4, 0x84, 0x6e, 0x75, 0xb8, 0xdc, 0xc7, 0xe9, 0xe6,
+    0xd4, 0xfc, 0x0d, 0xce, 0x6b, 0xb1, 0xb9, 0xb1, 0xc1, 0x69, 0x6a, 0x68, 0xba, 0x35, 0x5d, 0x30,
+    0x8e, 0xff, 0x73, 0xb7, 0x33, 0xdf, 0xd6, 0x6e, 0xc1, 0x2a, 0x88, 0xb4, 0x9c, 0x60, 0xb2, 0x5a,
+    0xec, 0x2b, 0xb6, 0x8c, 0xf6, 0x25, 0xc9, 0x94, 0x21, 0x33, 0x06, 0x8c, 0x98, 0x31, 0x61, 0xc4,
+    0xbc, 0xdb, 0x35, 0x8c, 0x6b, 0xeb, 0xea, 0x97, 0x56, 0xd6, 0xca, 0xd4, 0x2f, 0x26, 0xce, 0x50,
+    0x59, 0xbd, 0xa0, 0x76, 0x49, 0xf5, 0x12, 0xa9, 0xda, 0x45, 0xf5, 0xb4, 0x94, 0xcb, 0x96, 0x53,
+    0xec, 0xa5, 0x29, 0x17, 0x53, 0xd2, 0x2d, 0x5a, 0x48, 0xb3, 0x60, 0xd1, 0xd2, 0x78, 0x05, 0x4b,
+    0xfb, 0x8a, 0x15, 0xd1, 0x51, 0x2a, 0x56, 0xaa, 0x8c, 0x56, 0x99, 0x22, 0x85, 0x0a, 0xfe, 0x96,
+    0x12, 0x8a, 0xfd, 0x57, 0x28, 0xa1, 0x50, 0x9e, 0x84, 0x3a, 0x59, 0xf2, 0xc4, 0x44, 0x13, 0x26,
+    0x4e, 0x30, 0x99, 0x7c, 0xfe, 0x2f, 0x01, 0xb3, 0x82, 0x82, 0x26, 0x41, 0xa2, 0xe4, 0x08, 0x12,
+    0xf7, 0x91, 0x4f, 0xd0, 0x4f, 0x4f, 0xd0, 0x4e, 0x4f, 0x14, 0x46, 0x8a, 0x74, 0x82, 0x5b, 0x10,
+    0x29, 0xd2, 0x86, 0x41, 0x84, 0x3b, 0x04, 0x53, 0xc7, 0x90, 0x1d, 0x42, 0x82, 0x08, 0x09, 0xc2,
+    0xb9, 0xc3, 0x15, 0x88, 0x8e, 0x4d, 0x20, 0x78, 0xe2, 0x0f, 0x46, 0x1f, 0xcf, 0x63, 0x53, 0x93,
+    0x47, 0x26, 0x67, 0x66, 0x8e, 0x30, 0xbf, 0xa3, 0x35, 0x07, 0xb8, 0x46, 0x1b, 0x07, 0xd8, 0x32,
+    0x7b, 0x03, 0xff, 0xba, 0x66, 0x6d, 0xcc, 0xfc, 0x19, 0x0d, 0xb2, 0xa7, 0x31, 0x36, 0x37, 0xe3,
+    0xeb, 0xdd, 0x62, 0x5d, 0x59, 0x55, 0x4f, 0xaf, 0x80, 0x62, 0x96, 0x98, 0x8c, 0x74, 0x5c, 0x3c,
+    0x4c, 0x9b, 0xc7, 0xdf, 0xb0, 0xde, 0x9d, 0xdc, 0x9b, 0x1b, 0x98, 0x6d, 0x2d, 0x2d, 0x0c, 0xec,
+    0x9b, 0x55, 0x15, 0x85, 0xc4, 0x25, 0x72, 0xd3, 0x02, 0xbd, 0x82, 0x59, 0x45, 0x2d, 0x25, 0x15,
+    0xd5, 0x81, 0xc9, 0xad, 0xe1, 0x26, 0x06, 0xe3, 0x3b, 0x03, 0xe6, 0x67, 0xde, 0xcb, 0x9d, 0x39,
+    0x85, 0x6b, 0x5f, 0xea, 0xa3, 0xa0, 0xb6, 0x4f, 0xbf, 0x75, 0xda, 0x36, 0xfd, 0x33, 0x69, 0x2e,
+    0x29, 0x89, 0x6d, 0x93, 0x7e, 0xfb, 0xff, 0x39, 0x59, 0xfd, 0x08, 0x68, 0x2f, 0x5a, 0x2a, 0xea,
+    0x3e, 0xd1, 0x90, 0xa2, 0xa3, 0xd0, 0xd6, 0xe7, 0x1d, 0x94, 0x04, 0xf4, 0x66, 0x00, 0xb0, 0xfe,
+    0x47, 0xd3, 0x47, 0xab, 0xbb, 0xdd, 0xfe, 0xbf, 0xc1, 0xb4, 0x7e, 0x31, 0xda, 0x9f, 0xe6, 0x4f,
+    0x8b, 0xe0, 0x9f, 0x46, 0x73, 0xee, 0x03, 0xbc, 0xb6, 0x46, 0x31, 0x35, 0xcb, 0x14, 0xcd, 0x26,
+    0x49, 0xde, 0x46, 0xf0, 0x1e, 0xd9, 0x4b, 0x31, 0xac, 0x0c, 0x2d, 0x1e, 0x03, 0x88, 0xcb, 0x20,
+    0xd1, 0x80, 0x0e, 0x9c, 0xd6, 0x2b, 0x25, 0x12, 0x99, 0xfd, 0x04, 0x79, 0xbf, 0xfb, 0xd9, 0xd7,
+    0x04, 0x83, 0xa7, 0xa2, 0x9e, 0xa2, 0x72, 0x39, 0xe5, 0xb2, 0x85, 0xe6, 0x08, 0x16, 0x94, 0xe6,
+    0xd3, 0xb3, 0x93, 0xc6, 0x13, 0xd7, 0xa9, 0xf9, 0x23, 0x21, 0x9a, 0xd9, 0xd7, 0xf1, 0x97, 0x3a,
+    0x5c, 0x18, 0x65, 0x5c, 0x00, 0xb1, 0xc0, 0x4d, 0x7c, 0x25, 0x08, 0xb1, 0x9b, 0x0f, 0x49, 0x1d,
+    0xb4, 0x6f, 0x84, 0xe1, 0xb1, 0xff, 0x13, 0xb6, 0x91, 0xf8, 0x83, 0xf7, 0xe3, 0x83, 0x76, 0xa2,
+    0x23, 0xce, 0xe8, 0xd8, 0xf8, 0x5c, 0x8c, 0x53, 0x6f, 0xad, 0xa3, 0xc4, 0xa2, 0x06, 0x65, 0xb0,
+    0x84, 0x33, 0xae, 0xde, 0xd6, 0x24, 0x2d, 0x5b, 0xcd, 0x6e, 0x66, 0xd0, 0xa4, 0x56, 0xd2, 0xfb,
+    0x98, 0x65, 0xec, 0x2a, 0xea, 0x60, 0xdd, 0xdf, 0x4e, 0x53, 0xeb, 0x3b, 0x1a, 0xdf, 0x3f, 0x50,
+    0x8c, 0xfc, 0x0b, 0xb2, 0x8f, 0x25, 0x0b, 0xf9, 0xfd, 0x6d, 0x75, 0xbf, 0x24, 0x1d, 0x00, 0x52,
+    0x5f, 0x19, 0x3e, 0x44, 0xbd, 0x32, 0xbc, 0x29, 0x37, 0xee, 0xdb, 0x77, 0xc1, 0x6e, 0x60, 0x9f,
+    0x6f, 0xda, 0x97, 0x6c, 0xec, 0x8b, 0x8f, 0x71, 0xb3, 0x94, 0xa8, 0x94, 0xb8, 0x48, 0x4a, 0x3b,
+    0x3c, 0xde, 0x9d, 0xac, 0x8e, 0x17, 0x08, 0xab, 0xc3, 0xed, 0x2a, 0xe1, 0x5c, 0x6e, 0xd2, 0x27,
+    0xe1, 0x3f, 0xaf, 0xfd, 0xec, 0xf7, 0x08, 0xd9, 0x4c, 0x49, 0xf1, 0x48, 0x49, 0x09, 0x69, 0x77,
+    0xa2, 0xa2, 0x70, 0xfe, 0xbf, 0x49, 0x69, 0xab, 0x04, 0xb6, 0x51, 0xab, 0x31, 0xa3, 0x19, 0xeb,
+    0x82, 0x71, 0xe1, 0x59, 0xac, 0xc7, 0x8d, 0xb2, 0x3f, 0x58, 0x9f, 0x22, 0x9b, 0xcb, 0x9b, 0xd4,
+    0xd4, 0xd3, 0xd3, 0x3f, 0x05, 0x73, 0xe9, 0x2c, 0xe2, 0x06, 0xe1, 0x3e, 0x33, 0xde, 0xed, 0x8d,
+    0xb6, 0x9b, 0xdd, 0x62, 0xbf, 0x33, 0x47, 0xe9, 0x97, 0x40, 0x64, 0xb5, 0x4c, 0x1e, 0xc0, 0x5b,
+    0xbc, 0xc3, 0xbf, 0x83, 0xb4, 0x36, 0x4a, 0x4b, 0x6d, 0x1f, 0x9b, 0x4e, 0x4d, 0x4f, 0x89, 0x5c,
+    0x4e, 0x4c, 0x4b, 0x4d, 0x5b, 0x4c, 0x4a, 0x78, 0x4b, 0x8b, 0x48, 0x4a, 0x49, 0x48, 0x49, 0x45,
+    0x40, 0x47, 0x46, 0x45, 0x5a, 0x46, 0x6c, 0x6b, 0x6a, 0x69, 0x61, 0x5e, 0x54, 0x52, 0x48, 0x45,
+    0x5e, 0x5c, 0x5b, 0x5a, 0x59, 0x5d, 0xff, 0xff, 0x2f, 0xc4, 0x17, 0xe4, 0x03, 0xc4, 0x05, 0x10,
+    0xe6, 0xa7, 0xc7, 0x87, 0xa7, 0x67, 0xe7, 0x86, 0xc7, 0xab, 0xb3, 0xe3, 0xc5, 0x31, 0xd2, 0xc9,
+    0xc1, 0xc9, 0xb1, 0xa9, 0xb9, 0x19, 0xb5, 0xe9, 0x1a, 0xd5, 0xd0, 0xd0, 0xe0, 0xdc, 0x7f, 0x7c,
+    0x5b, 0x66, 0x66, 0x8b, 0xd5, 0x62, 0x7f, 0x28, 0xfb, 0xd8, 0xc7, 0x62, 0xc9, 0x94, 0x21, 0x23,
+    0x66, 0xe8, 0x75, 0x8c, 0x98, 0x31, 0xae, 0x61, 0x5a, 0xc1, 0xb0, 0x7e, 0x59, 0x65, 0xcd, 0xb2,
+    0xaa, 0xea, 0xa5, 0x8b, 0xaa, 0x55, 0x17, 0xd4, 0xd4, 0x51, 0x54, 0x53, 0xa0, 0x53, 0x2e, 0xa6,
+    0x55, 0x5c, 0xb6, 0x64, 0x29, 0xd5, 0xb2, 0x65, 0x71, 0xb4, 0x14, 0xcb, 0xa8, 0x1b, 0x0b, 0xe9,
+    0x15, 0xce, 0x49, 0xd2, 0x2a, 0x2b, 0xf8, 0x37, 0x08, 0x08, 0xc0, 0x0f, 0x4e, 0x17, 0xfb, 0x62,
+    0x54, 0x4d, 0xb3, 0x8c, 0x62, 0x59, 0x55, 0x51, 0x5d, 0x4d, 0x91, 0x22, 0x1a, 0xda, 0x34, 0xa5,
+    0xcb, 0x27, 0x05, 0x8a, 0x68, 0x67, 0x14, 0x1e, 0xa1, 0x9a, 0x50, 0x9c, 0x3c, 0x69, 0xe2, 0x84,
+    0x49, 0x13, 0x26, 0x49, 0x8c, 0x96, 0x28, 0x49, 0xa2, 0xe4, 0x08, 0x92, 0x23, 0x9e, 0x46, 0xa0,
+    0x9f, 0x9e, 0x9f, 0x46, 0x3a, 0x8b, 0x18, 0x21, 0x52, 0x64, 0x08, 0x91, 0x21, 0x9c, 0x42, 0x82,
+    0x70, 0x06, 0xf9, 0x01, 0xe4, 0xc7, 0xe6, 0x90, 0x8f, 0x1e, 0x9b, 0x3d, 0x34, 0x79, 0x64, 0xee,
+    0xc8, 0xa1, 0x03, 0x33, 0x87, 0x14, 0xa6, 0x0d, 0x1c, 0x37, 0x6c, 0x40, 0xdd, 0xa0, 0x51, 0x23,
+    0x8a, 0x86, 0x0c, 0xa0, 0x19, 0x97, 0x32, 0x9e, 0x2e, 0xf1, 0xaf, 0x14, 0xd1, 0x28, 0xa1, 0x49,
+    0x3c, 0x39, 0x37, 0x6d, 0xc8, 0x98, 0x92, 0x8a, 0x82, 0x7a, 0x0a, 0xf0, 0xc2, 0xc5, 0x8b, 0x49,
+    0x17, 0x4c, 0x2d, 0x56, 0xb0, 0x78, 0x5c, 0xa1, 0xc2, 0x72, 0x49, 0x05, 0x8a, 0x14, 0x8a, 0x28,
+    0x4e, 0x28, 0x99, 0xc0, 0xfb, 0x12, 0x49, 0x24, 0x9c, 0x98, 0x96, 0x94, 0x92, 0x90, 0x9a, 0x42,
+    0x54, 0x86, 0x78, 0xac, 0x2c, 0x02, 0x71, 0x54, 0x64, 0xd4, 0x81, 0x43, 0x07, 0x45, 0x0e, 0x9b,
+    0x1b, 0x88, 0x84, 0x86, 0x30, 0xe0, 0x61, 0xe0, 0xbc, 0x10, 0x04, 0x00, 0xa8, 0x02, 0x85, 0x0a,
+    0x93, 0x14, 0x22, 0x71, 0x26, 0x48, 0x88, 0x8c, 0x20, 0x41, 0x32, 0x02, 0x24, 0x84, 0x47, 0xc8,
+    0xf7, 0x03, 0xc7, 0x77, 0xa3, 0x23, 0x63, 0xe3, 0xa2, 0x03, 0xc5, 0x45, 0xc3, 0x44, 0x44, 0xc3,
+    0x43, 0x44, 0xf7, 0x21, 0x61, 0x4d, 0x03, 0x3c, 0x8c, 0xb0, 0x90, 0x41, 0xa1, 0x20, 0x7b, 0x70,
+    0x37, 0x63, 0xb1, 0x6c, 0x5c, 0xbd, 0x8e, 0x00, 0x98, 0xf6, 0x3b, 0x03, 0x92, 0x95, 0xcf, 0x7e,
+    0xe1, 0x1e, 0xb3, 0x37, 0xb0, 0x4c, 0xfe, 0x46, 0xbe, 0x0d, 0x09, 0xb9, 0x82, 0x68, 0x2e, 0xe0,
+    0x9f, 0xd8, 0x4f, 0xcf, 0x0e, 0x8f, 0x4f, 0x38, 0x0f, 0x2b, 0xc8, 0xfb, 0x14, 0xdc, 0x24, 0xc8,
+    0xb9, 0xc1, 0x01, 0x33, 0x40, 0x86, 0xcf, 0x40, 0xa3, 0xde, 0x5e, 0x22, 0x5e, 0xde, 0xbb, 0xc0,
+    0xdb, 0x3c, 0xf7, 0xab, 0xfb, 0x35, 0x5e, 0x60, 0xaf, 0x3c, 0x3d, 0x3a, 0x20, 0x7a, 0xbc, 0x76,
+    0x3c, 0x78, 0xd8, 0x8e, 0x37, 0xbd, 0x93, 0x83, 0xa3, 0x83, 0xcd, 0xb9, 0xb1, 0xc1, 0x61, 0xbd,
+    0x71, 0xb5, 0xf9, 0xdf, 0x62, 0x69, 0x66, 0x6a, 0x12, 0xbb, 0x5c, 0x9a, 0x47, 0x9c, 0xdb, 0xc6,
+    0xb7, 0xdb, 0x99, 0xff, 0xad, 0x76, 0x9b, 0xdd, 0xbe, 0xeb, 0x95, 0x32, 0x13, 0x5e, 0xc9, 0x8c,
+    0x11, 0xf3, 0x9a, 0x78, 0x3a, 0x26, 0x8c, 0x18, 0xd5, 0x30, 0x60, 0x58, 0x57, 0x55, 0xbd, 0xac,
+    0x32, 0x76, 0xf1, 0xd2, 0x25, 0xf5, 0x14, 0x35, 0x15, 0x95, 0xcb, 0x15, 0x42, 0x53, 0x2e, 0x5b,
+    0x4a, 0x4d, 0x49, 0xb7, 0x68, 0x29, 0xcd, 0xa2, 0x05, 0x4b, 0x16, 0x54, 0x2c, 0x84, 0x6e, 0x37,
+    0xa9, 0x95, 0x2a, 0xa4, 0x59, 0xef, 0xa8, 0x15, 0xd0, 0x51, 0x2a, 0x52, 0xaa, 0xb4, 0x4e, 0xa1,
+    0x82, 0x39, 0x45, 0x34, 0x54, 0x4a, 0x66, 0x14, 0x51, 0x1f, 0x25, 0xa2, 0x4c, 0x86, 0x42, 0x01,
+    0xe5, 0x7b, 0x02, 0xc5, 0x89, 0x92, 0x27, 0x3f, 0x9a, 0x38, 0x89, 0x6c, 0xb2, 0x84, 0xc9, 0xe2,
+    0x92, 0x24, 0x48, 0x94, 0x38, 0x26, 0x39, 0x82, 0xe4, 0xf0, 0xc8, 0x27, 0xa6, 0xe7, 0x67, 0xa7,
+    0xa7, 0x91, 0xce, 0x22, 0x46, 0x88, 0xf4, 0x28, 0x32, 0x44, 0x08, 0x91, 0x21, 0x41, 0x38, 0x85,
+    0x04, 0x01, 0xc2, 0xf9, 0x03, 0xc8, 0xff, 0x0f, 0x1f, 0x9b, 0x3c, 0x7a, 0x6c, 0x6a, 0xee, 0xe0,
+    0xa1, 0x99, 0xb9, 0x43, 0x47, 0x66, 0xab, 0x8e, 0x1c, 0x38, 0x4a, 0xdc, 0xc0, 0x61, 0xe3, 0x46,
+    0x0d, 0x1b, 0x34, 0x6a, 0xcc, 0x60, 0x41, 0xe3, 0x52, 0xc6, 0x8c, 0xc5, 0xcb, 0x18, 0x30, 0x64,
+    0x44, 0xc6, 0x78, 0x01, 0xc3, 0xc5, 0x8b, 0x16, 0x2e, 0x5a, 0xac, 0xb0, 0x64, 0x71, 0xb8, 0x42,
+    0x45, 0x0a, 0x4b, 0x47, 0x15, 0x28, 0x52, 0x9c, 0x40, 0x61, 0xe2, 0x84, 0x09, 0x12, 0x93, 0x23,
+    0x48, 0xf8, 0xe8, 0x13, 0x31, 0x02, 0x1b, 0x19, 0x42, 0x44, 0x66, 0x65, 0x08, 0x10, 0x19, 0x2a,
+    0x13, 0x3f, 0x78, 0x00, 0xb1, 0xf8, 0xa1, 0x03, 0x07, 0x0f, 0x91, 0x1d, 0x36, 0x70, 0xd0, 0xb0,
+    0x81, 0xf3, 0x4e, 0x03, 0x86, 0x0b, 0x19, 0x0e, 0x31, 0x58, 0xa0, 0xbc, 0xe0, 0x68, 0xc1, 0x5d,
+    0x81, 0xf2, 0xf1, 0x28, 0x54, 0xe0, 0x8c, 0xa2, 0x30, 0x21, 0x52, 0xc2, 0x84, 0x08, 0x12, 0x24,
+    0x23, 0xdc, 0x49, 0x42, 0x70, 0x6c, 0x43, 0x42, 0x48, 0xf1, 0x08, 0xe9, 0x7d, 0xf0, 0xf8, 0xa0,
+    0x71, 0x91, 0xb1, 0xf1, 0xcd, 0xf8, 0x99, 0x0e, 0xde, 0x0e, 0x14, 0x0f, 0x5b, 0x1f, 0xab, 0x88,
+    0xdf, 0xf4, 0x21, 0x26, 0x22, 0x1a, 0xba, 0x0d, 0x1b, 0xb8, 0x19, 0x19, 0x34, 0x68, 0x61, 0x66,
+    0x50, 0x48, 0xd8, 0xbe, 0x6b, 0x0f, 0x16, 0x0e, 0xb2, 0x09, 0x5b, 0xd7, 0x6c, 0xb0, 0x0a, 0xf3,
+    0x5a, 0x9d, 0x8e, 0x52, 0x0b, 0x9a, 0x25, 0xd1, 0x82, 0xfb, 0x19, 0xbd, 0x7a, 0x2e, 0xdf, 0xe9,
+    0x95, 0xf9, 0x02, 0x17, 0x04, 0x92, 0x17, 0x00, 0xfe, 0x91, 0x01, 0xfd, 0xf8, 0x74, 0xbd, 0x71,
+    0xf8, 0x4c, 0xcf, 0xc7, 0xe2, 0xb0, 0x58, 0x41, 0x82, 0x7c, 0x2c, 0x8f, 0x7d, 0x30, 0x16, 0x96,
+    0x2d, 0xbc, 0x2c, 0x2a, 0x57, 0xa8, 0x40, 0x61, 0xd9, 0xaa, 0x62, 0x43, 0x8a, 0x13, 0x25, 0x50,
+    0xfc, 0xc8, 0x34, 0x71, 0x82, 0xd2, 0x84, 0x84, 0x12, 0x24, 0x2a, 0xfb, 0x46, 0x90, 0x48, 0x21,
+    0x62, 0x84, 0x37, 0x84, 0x88, 0x10, 0x20, 0x36, 0x7c, 0x00, 0xe1, 0xe1, 0x43, 0x07, 0x0f, 0xad,
+    0x1c, 0x3a, 0x70, 0xd0, 0x40, 0x99, 0x41, 0x03, 0x86, 0x0c, 0x17, 0x30, 0x58, 0xb8, 0x50, 0x67,
+    0x81, 0x42, 0x05, 0x1f, 0xee, 0x49, 0x0a, 0x9b, 0x78, 0x13, 0x26, 0xeb, 0x26, 0xe0, 0xdf, 0xca,
+    0x0d, 0x94, 0x59, 0x09, 0x77, 0x75, 0x5d, 0x3b, 0xb0, 0xc8, 0xa9, 0x48, 0x46, 0xc8, 0x07, 0x8d,
+    0x57, 0x90, 0x8f, 0x0f, 0x1e, 0x1d, 0x1b, 0x1d, 0xdf, 0x8c, 0x6f, 0x07, 0x8c, 0x91, 0x8b, 0x0e,
+    0x16, 0x0b, 0x13, 0x11, 0xdd, 0x0d, 0x04, 0x24, 0x32, 0x40, 0x3c, 0x74, 0x1f, 0x1a, 0x36, 0x30,
+    0x6c, 0x17, 0xb6, 0x09, 0x0b, 0x25, 0x07, 0x09, 0x07, 0xcf, 0x6b, 0xb5, 0x60, 0xd7, 0x9a, 0xfb,
+    0x61, 0xea, 0xb4, 0x60, 0x1a, 0xbd, 0xa3, 0xcd, 0x67, 0x73, 0xf9, 0xcc, 0x18, 0x58, 0x0e, 0x54,
+    0x40, 0xfe, 0xd3, 0xc5, 0x01, 0xc8, 0x0f, 0xf8, 0x57, 0x07, 0xe8, 0xa7, 0xcb, 0xf9, 0x8d, 0xc5,
+    0x53, 0xe3, 0x70, 0xfe, 0x25, 0xdc, 0xa7, 0xa0, 0x2f, 0x81, 0x82, 0x56, 0x3d, 0x04, 0x6d, 0x79,
+    0x09, 0xf6, 0xfe, 0x00, 0x02, 0x03, 0x7c, 0x07, 0x72, 0xf8, 0xf4, 0xf6, 0xf4, 0xf2, 0xf6, 0xdc,
+    0x78, 0x79, 0x6f, 0x78, 0x05, 0xea, 0xee, 0x0a, 0xb4, 0xda, 0xdd, 0xd9, 0x3d, 0x1d, 0x81, 0xcc,
+    0x39, 0xba, 0xb9, 0xb8, 0x37, 0xb8, 0x01, 0x71, 0x03, 0xda, 0xc0, 0xa6, 0x60, 0x9c, 0xad, 0x8d,
+    0x6d, 0xad, 0x4d, 0x6d, 0xad, 0x4f, 0x0d, 0x2d, 0x6d, 0x0a, 0x0d, 0xc7, 0x1a, 0x1b, 0x3b, 0x2b,
+    0xfb, 0xb2, 0x9d, 0x99, 0x95, 0xc9, 0x99, 0x91, 0x7d, 0xc9, 0xc8, 0xc4, 0xc6, 0xc4, 0x04, 0x8c,
+    0xcd, 0x09, 0x00, 0x87, 0x61, 0x81, 0x7d, 0x75, 0x81, 0x71, 0x7d, 0x79, 0x75, 0x79, 0x6d, 0x65,
+    0x71, 0x69, 0x69, 0x6d, 0x65, 0x5d, 0x85, 0x5d, 0x59, 0x61, 0x55, 0x59, 0x51, 0x55, 0x51, 0x4d,
+    0x09, 0x49, 0xf1, 0x48, 0xe1, 0x48, 0x50, 0xff, 0x50, 0x4c, 0x4f, 0x4e, 0x4d, 0x64, 0x4e, 0x4b,
+    0x49, 0x4c, 0x8f, 0x4a, 0x4a, 0x4b, 0x0f, 0x97, 0x34, 0x76, 0x84, 0x74, 0x64, 0x84, 0x54, 0x64,
+    0x64, 0x49, 0x34, 0x54, 0x84, 0x0f, 0x05, 0x09, 0x05, 0x01, 0x65, 0x85, 0x1e, 0xe8, 0xc7, 0x07,
+    0x40, 0x8e, 0x4f, 0x0f, 0x8f, 0x69, 0xcf, 0x4e, 0x8e, 0x57, 0x67, 0x67, 0x93, 0x8c, 0x0e, 0x0e,
+    0x7e, 0x83, 0x63, 0x73, 0x53, 0x43, 0x63, 0x53, 0xd3, 0xe5, 0xd2, 0x70, 0x67, 0xc8, 0xcc, 0x68,
+    0xb7, 0x59, 0xac, 0x36, 0x9b, 0xfd, 0x2c, 0xb6, 0xcc, 0xeb, 0x97, 0x31, 0xaf, 0x62, 0xc6, 0x84,
+    0x71, 0x15, 0x13, 0x06, 0x4c, 0xab, 0x6b, 0x69, 0x2b, 0xab, 0xe9, 0x2a, 0xab, 0x97, 0xd4, 0xd5,
+    0x2e, 0xaa, 0x5e, 0xe2, 0xba, 0x94, 0xaa, 0x6e, 0xf9, 0x7f, 0xd0, 0x88, 0xe8, 0x6e, 0xa0, 0x16,
+    0xdc, 0xff, 0x74, 0x71, 0x5e, 0x27, 0xf7, 0x56, 0xf6, 0xfd, 0xea, 0x9a, 0xe2, 0x3e, 0x7d, 0x9b,
+    0x78, 0x72, 0xb2, 0x38, 0x99, 0x2f, 0xa6, 0xdc, 0x52, 0x02, 0x73, 0x6e, 0x72, 0xdc, 0x38, 0xb8,
+    0xef, 0x00, 0xee, 0x1b, 0x1d, 0x96, 0x50, 0x2c, 0xa2, 0xdf, 0xbe, 0x22, 0x4a, 0x1a, 0x6a, 0xc5,
+    0x87, 0x74, 0xd4, 0x4a, 0x15, 0x29, 0xa3, 0x5e, 0x3a, 0x2a, 0x55, 0xa6, 0x50, 0x71, 0x4f, 0xe1,
+    0x9e, 0x49, 0x89, 0x72, 0x25, 0x0a, 0x14, 0xd1, 0xd6, 0x27, 0x4d, 0xa0, 0xbc, 0x9d, 0x3c, 0x81,
+    0xe1, 0x84, 0x89, 0x92, 0x26, 0x27, 0x96, 0x30, 0x71, 0x11, 0x63, 0xc9, 0x37, 0x89, 0x12, 0x24,
+    0x49, 0x40, 0x3f, 0x91, 0x1c, 0x31, 0x12, 0xa3, 0x86, 0x91, 0xef, 0x8d, 0x22, 0x44, 0x38, 0x8b,
+    0x24, 0x0e, 0x21, 0x22, 0x24, 0xc8, 0x90, 0x77, 0x10, 0x20, 0x9c, 0x3f, 0x80, 0xfc, 0xf0, 0x71,
+    0xc3, 0xb5, 0x47, 0x8d, 0xcd, 0x1c, 0x3d, 0x74, 0x78, 0x6c, 0x6a, 0xee, 0xe0, 0x91, 0xa9, 0x63,
+    0xc7, 0x62, 0x26, 0x66, 0x0e, 0x1d, 0x43, 0x1c, 0x98, 0x6a, 0x38, 0x7c, 0xd8, 0xa0, 0x81, 0xbd,
+    0xf1, 0x34, 0xc0, 0x97, 0x32, 0x66, 0x58, 0xca, 0x78, 0x61, 0xe9, 0xa2, 0xc5, 0x0b, 0x16, 0x2b,
+    0x5a, 0x6c, 0xae, 0xad, 0xb0, 0xb2, 0x13, 0x5a, 0x23, 0x06, 0x0c, 0xcb, 0xb6, 0x35, 0xae, 0xda,
+    0x37, 0x8d, 0x0d, 0xc5, 0x09, 0x14, 0x25, 0x4e, 0x90, 0x18, 0x51, 0x82, 0x92, 0x84, 0x88, 0x10,
+    0x23, 0x1c, 0x88, 0x80, 0x0c, 0xc1, 0x81, 0x72, 0x43, 0x06, 0x0e, 0x1a, 0x36, 0xb4, 0x35, 0x60,
+    0xb8, 0x90, 0xc1, 0xc2, 0x05, 0x33, 0x0b, 0xdc, 0xb3, 0x0a, 0x90, 0x14, 0x26, 0x2b, 0xb0, 0x29,
+    0x4c, 0x90, 0x30, 0x19, 0x41, 0x52, 0x42, 0x62, 0x61, 0x84, 0x48, 0x08, 0x92, 0xef, 0x43, 0x08,
+    0x8f, 0x0e, 0x16, 0x0f, 0xdd, 0x8a, 0x8b, 0x89, 0x88, 0x8a, 0x88, 0xee, 0x42, 0x49, 0x43, 0x37,
+    0x67, 0x03, 0x06, 0x86, 0x9b, 0x0c, 0xda, 0x6c, 0xc2, 0x76, 0xd9, 0x20, 0x25, 0xa4, 0x83, 0xc3,
+    0x42, 0x36, 0x9a, 0xd9, 0xb7, 0x8c, 0xec, 0x2c, 0x2d, 0x88, 0xde, 0xcf, 0x69, 0x41, 0x33, 0x3a,
+    0xdf, 0x0b, 0x9c, 0xcb, 0x63, 0x73, 0x60, 0x79, 0x01, 0x39, 0x70, 0x01, 0xe0, 0x1f, 0x19, 0x50,
+    0xff, 0xf3, 0xd3, 0xfd, 0xc2, 0x46, 0x63, 0x71, 0x58, 0xac, 0x40, 0x2f, 0xef, 0x53, 0x90, 0x00,
+    0x41, 0x5f, 0x82, 0x03, 0x06, 0x10, 0x1c, 0xd8, 0x33, 0xc0, 0xb7, 0xc7, 0x87, 0x37, 0xa4, 0x97,
+    0x87, 0x97, 0x77, 0x07, 0x57, 0x60, 0xd1, 0xee, 0xae, 0x8e, 0x80, 0x5d, 0x58, 0x1d, 0xdd, 0x1c,
+    0x01, 0x30, 0xba, 0xb8, 0x39, 0xb9, 0x38, 0xb9, 0x37, 0xb8, 0x01, 0x6f, 0x5f, 0x03, 0x04, 0xd1,
+    0xfb, 0x59, 0x0f, 0xef, 0xe1, 0xc5, 0xbd, 0x89, 0x85, 0x81, 0x7d, 0x09, 0x68, 0x63, 0x5b, 0x53,
+    0x4b, 0x6b, 0x63, 0x43, 0x5b, 0xeb, 0x52, 0x8b, 0x4a, 0x3b, 0x03, 0x43, 0x33, 0x3b, 0x2b, 0x23,
+    0x33, 0x2b, 0xfb, 0x8e, 0x91, 0x7d, 0xc5, 0xc6, 0xc2, 0xc4, 0x04, 0x84, 0x09, 0xf0, 0x32, 0x02,
+    0xfb, 0xf2, 0xfa, 0xe2, 0x9a, 0xea, 0xda, 0xe2, 0xd2, 0xca, 0xda, 0xd2, 0xc2, 0xba, 0xca, 0xc2,
+    0xb2, 0xba, 0xa2, 0xb2, 0xaa, 0xa2, 0xaa, 0x92, 0x1a, 0x9a, 0x0a, 0x20, 0x15, 0x00, 0xea, 0x28,
+    0x4a, 0xf3, 0x09, 0x2a, 0x8c, 0xcb, 0xa8, 0xb4, 0xe2, 0xfa, 0x4b, 0x50, 0x23, 0x00, 0x08, 0x00,
+    0x68, 0x00, 0x33, 0x6a, 0x01, 0x83, 0xd3, 0x30, 0x75, 0xf2, 0x0a, 0x44, 0xee, 0x20, 0xa2, 0x60,
+    0x2b, 0x21, 0x48, 0x78, 0x01, 0x00, 0x39, 0x02, 0x2b, 0x06, 0x13, 0xdd, 0x05, 0x6a, 0xa7, 0x14,
+    0x2e, 0xd2, 0xd0, 0xc2, 0xe3, 0xf7, 0x6e, 0xf5, 0x79, 0xa1, 0x93, 0x0f, 0xcb, 0x4c, 0xc4, 0xb5,
+    0x60, 0x83, 0xd8, 0x3b, 0x6d, 0x21, 0x7b, 0xe1, 0x58, 0xdd, 0x83, 0x78, 0xd3, 0x3c, 0xc9, 0xcb,
+    0x65, 0x01, 0xf0, 0x5e, 0x2e, 0x7e, 0x87, 0xee, 0x58, 0x89, 0xdf, 0x7f, 0x76, 0x2c, 0x06, 0x3f,
+    0x40, 0x33, 0x09, 0x6f, 0x3f, 0xfe, 0x61, 0xe8, 0x06, 0x9c, 0x33, 0x42, 0xc7, 0x9f, 0xd0, 0x08,
+    0x75, 0x45, 0xdc, 0x23, 0x73, 0x7f, 0x15, 0xd5, 0xbd, 0x03, 0xde, 0xdb, 0x01, 0xcf, 0x3e, 0xb0,
+    0xad, 0xdb, 0xe9, 0x62, 0x56, 0x10, 0x05, 0x63, 0x4c, 0x3b, 0x30, 0x45, 0x0f, 0xa7, 0x5d, 0xfe,
+    0xcc, 0x43, 0x36, 0xba, 0xc1, 0x18, 0xd1, 0x9f, 0xb8, 0x91, 0x27, 0x0c, 0xf7, 0xf2, 0x33, 0x87,
+    0x7b, 0x60, 0xf7, 0x8c, 0x91, 0x0d, 0x93, 0xf8, 0x89, 0xac, 0x7d, 0x12, 0x26, 0x6a, 0xce, 0xff,
+    0xe6, 0x4f, 0xae, 0xa9, 0x87, 0xca, 0x01, 0x47, 0x58, 0x14, 0x3a, 0xde, 0x20, 0xef, 0xc0, 0x12,
+    0xc1, 0xf6, 0x4e, 0x12, 0x86, 0xaf, 0xc8, 0xe0, 0x21, 0xea, 0x6b, 0xde, 0xf1, 0x60, 0xd7, 0x91,
+    0x1b, 0xfb, 0xe2, 0x12, 0xf8, 0xc3, 0xa3, 0xea, 0xac, 0x51, 0xfb, 0x06, 0xb4, 0xb9, 0xe7, 0x18,
+    0x46, 0x7e, 0x2e, 0x75, 0x34, 0xbf, 0xff, 0x2d, 0x19, 0xe7, 0xb7, 0x74, 0x3a, 0x1f, 0xbb, 0x5d,
+    0x19, 0x8b, 0x30, 0x3a, 0x52, 0x5b, 0xd5, 0x93, 0xcf, 0xcd, 0x0c, 0xe3, 0x6c, 0xea, 0x87, 0xe0,
+    0x48, 0xf0, 0xc7, 0x79, 0xd1, 0xef, 0x2c, 0x9b, 0xb6, 0x4b, 0x24, 0xff, 0x8c, 0xa6, 0xfd, 0xdc,
+    0x1d, 0xf7, 0x13, 0x25, 0x8e, 0x14, 0xa1, 0x7f, 0x1b, 0x11, 0x64, 0xa2, 0x62, 0x1f, 0xa4, 0xe3,
+    0x95, 0xef, 0x40, 0x14, 0x2c, 0xb4, 0xda, 0x2c, 0xfa, 0x69, 0xce, 0xbb, 0xc2, 0x73, 0x9d, 0x7a,
+    0x89, 0xdb, 0xa1, 0xde, 0xd6, 0x2e, 0x73, 0x75, 0x12, 0x59, 0xa9, 0xe5, 0xe7, 0x6d, 0x80, 0x51,
+    0x6b, 0xb3, 0x9e, 0x3f, 0x79, 0x1c, 0xee, 0x0b, 0x9e, 0x52, 0x9f, 0x1d, 0xe5, 0x42, 0xf8, 0x1f,
+    0xa7, 0x2d, 0x75, 0x22, 0x0b, 0x64, 0xf8, 0x55, 0x02, 0x8e, 0xe6, 0xc5, 0xf4, 0xc6, 0x12, 0xdf,
+    0x89, 0xc7, 0xd8, 0x53, 0x59, 0x6a, 0x80, 0x27, 0x4a, 0x16, 0xec, 0xdf, 0xd6, 0x87, 0x9b, 0x63,
+    0x3c, 0x52, 0xe6, 0xef, 0x85, 0x7b, 0x08, 0x3c, 0x84, 0xdb, 0x57, 0xef, 0x61, 0xe5, 0xae, 0xff,
+    0xe5, 0xe3, 0xcc, 0x27, 0xae, 0xfd, 0xd6, 0x00, 0xee, 0xb2, 0xab, 0x11, 0x73, 0x1f, 0xf1, 0xa3,
+    0xac, 0x29, 0xf6, 0xf3, 0x7e, 0x63, 0x84, 0x16, 0x74, 0x1c, 0xd5, 0x1b, 0x68, 0x13, 0x61, 0x33,
+    0xf5, 0x9e, 0xd3, 0x06, 0x55, 0x15, 0xf4, 0x80, 0x7a, 0xe2, 0x59, 0xcc, 0xf1, 0x87, 0x88, 0x52,
+    0x60, 0xbf, 0x9d, 0x73, 0x7e, 0x80, 0xe0, 0xb5, 0x9f, 0x32, 0xf6, 0xcb, 0xe0, 0x4f, 0xd2, 0x48,
+    0xfa, 0xc1, 0x19, 0x3c, 0x93, 0x91, 0xb3, 0x13, 0x77, 0xb2, 0x1f, 0xf1, 0x7d, 0x28, 0x5f, 0xf0,
+    0xb7, 0x76, 0xe8, 0x5b, 0x5b, 0xfd, 0xc8, 0xe6, 0xb1, 0x0c, 0x8c, 0x7e, 0x9e, 0x70, 0x37, 0xfd,
+    0xbe, 0x7c, 0xf9, 0xac, 0xc3, 0xf9, 0x26, 0xf4, 0x3e, 0x1e, 0x70, 0x41, 0xcf, 0x66, 0xef, 0xaf,
+    0x98, 0x37, 0x3e, 0x5a, 0xc3, 0xeb, 0x7d, 0xa2, 0xd2, 0x7e, 0xec, 0xdb, 0x35, 0x2d, 0x6d, 0x60,
+    0x5d, 0xb3, 0xcb, 0xc4, 0x47, 0xe3, 0xb5, 0xf7, 0x57, 0xa6, 0x3b, 0xfd, 0x00, 0x36, 0xf3, 0xcf,
+    0xeb, 0x65, 0x82, 0xbf, 0xd3, 0x03, 0xeb, 0x83, 0xf5, 0x96, 0xbc, 0x4d, 0xe0, 0x95, 0xbc, 0xad,
+    0x91, 0x4f, 0xf5, 0x37, 0x2c, 0xb9, 0x39, 0xcb, 0xdf, 0xe0, 0xad, 0xcf, 0x7f, 0xde, 0xc1, 0x7d,
+    0x34, 0x28, 0x4e, 0xe6, 0x77, 0x52, 0xcf, 0x3a, 0xf7, 0x1f, 0x11, 0xdb, 0xd3, 0xe6, 0xb3, 0x57,
+    0x3e, 0x40, 0x3f, 0xed, 0x7a, 0x3b, 0xe1, 0xaa, 0xf0, 0x7d, 0x5d, 0x30, 0x1e, 0x36, 0xf8, 0xc8,
+    0x13, 0xc4, 0xdc, 0xd9, 0x87, 0x3d, 0xce, 0x3a, 0x7e, 0x5c, 0x97, 0x58, 0x1c, 0xc3, 0x75, 0x6c,
+    0xb3, 0xee, 0xb2, 0x23, 0xf3, 0x39, 0xb7, 0xca, 0xcd, 0xb9, 0xe9, 0xfb, 0x20, 0x3e, 0xdd, 0x0c,
+    0x63, 0xd5, 0x19, 0xf0, 0x90, 0x46, 0xbb, 0x49, 0x47, 0xc0, 0x7d, 0xaf, 0x7b, 0x2f, 0xf6, 0x97,
+    0x2e, 0x9e, 0xfa, 0x2f, 0x61, 0xe6, 0xee, 0xc0, 0xb9, 0x32, 0xd1, 0x4c, 0x12, 0x3f, 0x0c, 0xd7,
+    0xf4, 0x34, 0xd2, 0xb3, 0xbf, 0x9a, 0x46, 0xc0, 0x8f, 0x2c, 0x8d, 0xbd, 0xdc, 0x9d, 0x07, 0xfc,
+    0xc9, 0xc5, 0x3c, 0x8d, 0x96, 0xb7, 0xe3, 0x53, 0xbd, 0x41, 0x85, 0x2f, 0xc1, 0x93, 0xac, 0xe1,
+    0xfa, 0x11, 0xf6, 0xfe, 0x29, 0xc7, 0x07, 0x93, 0x8d, 0x57, 0x4f, 0x71, 0x14, 0x30, 0x0f, 0x67,
+    0x98, 0x11, 0xf2, 0xcf, 0xab, 0x71, 0xd8, 0x19, 0xb6, 0xf1, 0x93, 0x68, 0xf4, 0x66, 0xfa, 0x94,
+    0x78, 0x81, 0xea, 0xac, 0xdb, 0xe9, 0x73, 0x97, 0x09, 0xe0, 0x0f, 0x99, 0xc8, 0xcc, 0x78, 0xa6,
+    0x89, 0xfa, 0x59, 0xda, 0x21, 0x44, 0xc5, 0x1c, 0x73, 0x27, 0xf3, 0x00, 0xf7, 0xf4, 0x98, 0xef,
+    0xca, 0x24, 0x0b, 0xfc, 0xcb, 0x90, 0x63, 0xf2, 0x7f, 0x0e, 0x41, 0x4e, 0x78, 0xd5, 0x3b, 0x7f,
+    0x7e, 0xce, 0x1c, 0x92, 0x3e, 0x4a, 0xc1, 0xc4, 0x8f, 0x6a, 0x03, 0x1b, 0x60, 0x85, 0x3c, 0xd2,
+    0xa5, 0xb8, 0xc7, 0xf9, 0xe2, 0x38, 0x7c, 0x07, 0x4c, 0xe4, 0xce, 0x5f, 0x03, 0x10, 0xc2, 0x3e,
+    0x8e, 0x93, 0x73, 0xf6, 0xfe, 0x7e, 0x9c, 0xf5, 0x11, 0xe2, 0x53, 0xf6, 0xf7, 0x01, 0xaf, 0xed,
+    0x22, 0x2d, 0x0e, 0xc2, 0x2d, 0x0f, 0x1e, 0xbd, 0x41, 0x97, 0xa9, 0x54, 0xfe, 0xf3, 0x34, 0x96,
+    0x35, 0x2d, 0x1d, 0x2e, 0x78, 0xbd, 0xef, 0xca, 0x9e, 0x2e, 0xfb, 0xe3, 0x70, 0xc9, 0x72, 0xc2,
+    0x2b, 0xee, 0xa0, 0xd7, 0x20, 0xfd, 0xb5, 0xde, 0x2c, 0xd2, 0xe5, 0x06, 0xfa, 0xde, 0x79, 0x81,
+    0xf7, 0x29, 0xfd, 0xe8, 0xa2, 0xef, 0x96, 0xf7, 0x50, 0xbd, 0xd1, 0x39, 0x12, 0xac, 0xd8, 0xca,
+    0x36, 0xfd, 0x1e, 0xb4, 0x38, 0xee, 0x53, 0xdb, 0xc8, 0x35, 0x21, 0x4e, 0xc8, 0x36, 0xde, 0xa3,
+    0x0c, 0x00, 0x56, 0xef, 0xe4, 0xe9, 0x7d, 0x73, 0x3a, 0x7b, 0x91, 0x88, 0xe9, 0x4b, 0x65, 0xfa,
+    0xf0, 0x7e, 0x5d, 0x46, 0x6f, 0x64, 0x5d, 0x55, 0x11, 0x2c, 0x2b, 0x7a, 0xdf, 0xe1, 0x9c, 0x3a,
+    0x8e, 0x94, 0xaf, 0xe6, 0x37, 0x7e, 0xee, 0x2f, 0xc5, 0xc4, 0x54, 0x99, 0x8d, 0xdd, 0x97, 0xf4,
+    0xe3, 0xb7, 0x64, 0xbf, 0x22, 0x9c, 0x77, 0x8f, 0x39, 0x6f, 0xdd, 0x33, 0xd7, 0x66, 0xef, 0xa6,
+    0x03, 0x2f, 0xb9, 0x3e, 0x4a, 0x03, 0x2f, 0xea, 0xd5, 0xd9, 0xc9, 0xcf, 0x30, 0x0e, 0xb4, 0x97,
+    0x7a, 0x36, 0x04, 0xd7, 0xa8, 0xf6, 0xa7, 0xcb, 0x62, 0x54, 0xf0, 0x8f, 0x00, 0x17, 0xc0, 0x4f,
+    0x7a, 0x6a, 0x4f, 0x8a, 0x0f, 0xe3, 0xfd, 0xda, 0xdf, 0x78, 0x72, 0x06, 0xf7, 0xdd, 0x5d, 0x2b,
+    0x23, 0x8c, 0xd6, 0xf7, 0x2c, 0xf0, 0xba, 0x1b, 0x7e, 0x36, 0x69, 0xf1, 0x85, 0x1b, 0x72, 0x13,
+    0x8d, 0x8d, 0xe9, 0xe4, 0x9b, 0x87, 0x7c, 0x4b, 0xf8, 0x08, 0xaf, 0x36, 0x55, 0xb3, 0x48, 0x77,
+    0x60, 0x56, 0x4c, 0x02, 0xce, 0xe2, 0xdd, 0x66, 0x5b, 0x17, 0xfa, 0xfb, 0xba, 0x35, 0xca, 0xcd,
+    0x19, 0x78, 0xa4, 0x6e, 0x3d, 0xda, 0x19, 0x49, 0xc0, 0xee, 0x6f, 0xc9, 0xe8, 0xcb, 0xe9, 0x30,
+    0xb6, 0x25, 0xff, 0x71, 0xa8, 0x0c, 0xb6, 0xec, 0xe0, 0x9e, 0x7b, 0xbb, 0x29, 0xf7, 0x2f, 0xfd,
+    0x56, 0xa8, 0xe6, 0x55, 0xf4, 0x78, 0xce, 0xd9, 0xa6, 0x88, 0x17, 0x49, 0x1a, 0xf4, 0xc8, 0xc5,
+    0x19, 0xd2, 0x20, 0x7a, 0x01, 0x09, 0x20, 0x9c, 0x63, 0xae, 0xc5, 0xbf, 0x06, 0x32, 0xeb, 0x0b,
+    0xdb, 0xed, 0xcf, 0xac, 0x3e, 0x8c, 0x06, 0x8a, 0xff, 0x7b, 0x29, 0x99, 0x97, 0xc0, 0x4b, 0xfa,
+    0x4e, 0x8a, 0x64, 0xa9, 0xb5, 0xef, 0x20, 0xf4, 0x99, 0x87, 0x13, 0xd2, 0x75, 0xba, 0xb1, 0x3c,
+    0x49, 0x5e, 0x08, 0xd0, 0x81, 0x95, 0x38, 0x44, 0x98, 0x14, 0x8a, 0xd7, 0x7a, 0x3e, 0xda, 0xa8,
+    0xfa, 0x8f, 0xba, 0xea, 0x7f, 0xb9, 0x3d, 0x8e, 0xbd, 0x7e, 0xce, 0x08, 0x3d, 0xd2, 0x77, 0x90,
+    0x15, 0x9a, 0x06, 0x4e, 0x63, 0x1b, 0xd5, 0xb3, 0x77, 0x36, 0x23, 0x49, 0x76, 0x22, 0x70, 0xf2,
+    0xe4, 0x8c, 0xda, 0x44, 0x90, 0xb1, 0xa3, 0x50, 0x67, 0xc1, 0x63, 0xef, 0xd6, 0x1f, 0xed, 0x10,
+    0x66, 0x47, 0x35, 0x58, 0x12, 0xf7, 0x67, 0xee, 0x91, 0xd7, 0xcc, 0x48, 0x39, 0x6f, 0x11, 0xd0,
+    0x5e, 0x40, 0xdc, 0xfc, 0x00, 0x43, 0xcc, 0x19, 0xb4, 0xe5, 0x6c, 0x7e, 0xa3, 0x78, 0x7d, 0xb2,
+    0x81, 0x9b, 0x69, 0x3e, 0x3e, 0x21, 0xe1, 0xce, 0x4a, 0xee, 0x8e, 0x65, 0xf5, 0x34, 0xf9, 0x74,
+    0x58, 0xe7, 0xc8, 0x30, 0x91, 0x92, 0xd4, 0xcf, 0xd6, 0x3b, 0x1e, 0xec, 0xd7, 0x8d, 0x57, 0x33,
+    0xab, 0xc9, 0xed, 0x57, 0x77, 0xfe, 0x77, 0xd1, 0x8f, 0x1f, 0xf0, 0x11, 0x36, 0x88, 0xd2, 0x33,
+    0x58, 0x06, 0x4b, 0x31, 0x34, 0x0a, 0xe8, 0x75, 0xa4, 0xc7, 0xbd, 0xfd, 0x09, 0xa0, 0x88, 0x2f,
+    0x5e, 0x5d, 0x63, 0x39, 0x6a, 0x29, 0xe2, 0x5f, 0x8d, 0x07, 0xcf, 0x93, 0x48, 0x38, 0x83, 0x99,
+    0xf8, 0x16, 0x31, 0xe7, 0x5d, 0xfc, 0xfc, 0x03, 0x42, 0x0f, 0x97, 0x7c, 0x3e, 0xd3, 0xa7, 0xa1,
+    0x60, 0xc8, 0x40, 0x05, 0xe7, 0xf6, 0x58, 0x92, 0x81, 0xeb, 0x13, 0xfa, 0xdd, 0x6d, 0xc6, 0x67,
+    0xea, 0xe9, 0xd9, 0x80, 0x72, 0xa8, 0xeb, 0x43, 0x9a, 0xf4, 0xb6, 0x4b, 0x2f, 0xbc, 0x5b, 0x6a,
+    0x1a, 0x1d, 0xb6, 0xc3, 0xb8, 0xd1, 0x13, 0x0a, 0xa9, 0xb5, 0x47, 0xe0, 0x64, 0xff, 0xd1, 0xac,
+    0x03, 0x8e, 0xdf, 0xb3, 0x28, 0xbc, 0xbc, 0xfd, 0x6d, 0x97, 0x23, 0x62, 0xdd, 0x31, 0x5c, 0xcd,
+    0x25, 0xce, 0xee, 0x8b, 0xdc, 0x7a, 0x7f, 0xb4, 0x03, 0x73, 0xb7, 0xb6, 0x35, 0xd2, 0xdc, 0x5a,
+    0xf3, 0xf0, 0x3d, 0x77, 0x6b, 0xf6, 0x35, 0x3e, 0x38, 0x90, 0x6b, 0x84, 0x96, 0xd6, 0x60, 0xc0,
+    0x6f, 0xdf, 0xf9, 0xce, 0x75, 0x51, 0x7f, 0x98, 0x59, 0x3d, 0xd5, 0x8f, 0x74, 0x0b, 0xdb, 0x3e,
+    0x9c, 0xcd, 0xa8, 0xd6, 0x75, 0xac, 0x2a, 0x23, 0x99, 0x73, 0x42, 0x45, 0x09, 0x5e, 0xab, 0x97,
+    0xdd, 0x62, 0x3c, 0x8f, 0x7b, 0x13, 0xaf, 0x95, 0xdb, 0xe7, 0xea, 0x01, 0x00, 0x7f, 0x83, 0xc0,
+    0x66, 0x68, 0x44, 0xe1, 0xb2, 0xf7, 0x93, 0xfa, 0x3b, 0xa0, 0x23, 0x21, 0x58, 0x2d, 0xaf, 0xbb,
+    0x71, 0x3e, 0xc7, 0x4e, 0xee, 0xe9, 0x9d, 0xf3, 0x45, 0xf8, 0x3b, 0x0b, 0xdf, 0x9e, 0xf5, 0xfd,
+    0x38, 0xee, 0xa0, 0xf3, 0x18, 0x3e, 0x2a, 0xf5, 0x35, 0x9d, 0xf3, 0xc0, 0x26, 0xbd, 0xa9, 0xec,
+    0x22, 0xf1, 0x01, 0x1d, 0x69, 0xaa, 0xb6, 0xde, 0x02, 0x36, 0xcb, 0x60, 0x60, 0x70, 0x1d, 0x10,
+    0x45, 0x2a, 0xdc, 0xc6, 0x3a, 0xdc, 0xfd, 0xbe, 0x5b, 0x86, 0x49, 0xfd, 0xf3, 0xeb, 0x9e, 0xfb,
+    0xf9, 0x64, 0x26, 0x13, 0xfe, 0x12, 0xa8, 0xfa, 0xfe, 0x1d, 0x5c, 0x82, 0x33, 0xfb, 0x16, 0xe4,
+    0x9f, 0x85, 0x6e, 0xef, 0x5e, 0xac, 0xc6, 0x53, 0x53, 0xce, 0x4c, 0xd8, 0xd8, 0x25, 0x10, 0x1f,
+    0xca, 0xa0, 0xf1, 0xf8, 0x80, 0x5f, 0x41, 0x4c, 0x36, 0x7c, 0x4f, 0x67, 0x24, 0x0f, 0xae, 0x99,
+    0xfe, 0x31, 0xae, 0x0c, 0x30, 0x4b, 0xae, 0x4e, 0xab, 0xd0, 0xd5, 0xaa, 0x11, 0x4e, 0x6c, 0xdd,
+    0x79, 0xe4, 0x39, 0x44, 0xf6, 0xa6, 0xbf, 0xa7, 0xb7, 0xcb, 0x5b, 0x9f, 0x59, 0x44, 0xb4, 0x1b,
+    0x72, 0xae, 0x83, 0xbd, 0xe9, 0x65, 0x62, 0x21, 0x0f, 0xbe, 0x39, 0xed, 0x7d, 0x6d, 0x41, 0xd3,
+    0x91, 0x99, 0x62, 0x1e, 0x66, 0x70, 0x2b, 0x91, 0xf3, 0xb6, 0xa8, 0x55, 0x7a, 0x69, 0xca, 0xab,
+    0xcf, 0x7d, 0xe3, 0x25, 0x8a, 0x79, 0x19, 0x1c, 0x8e, 0x92, 0x8f, 0x6d, 0x68, 0xed, 0xa7, 0x19,
+    0x64, 0xaf, 0xaf, 0x3c, 0xd9, 0xf2, 0xc3, 0x68, 0xfe, 0x83, 0x15, 0x5b, 0xcd, 0x19, 0x52, 0x5f,
+    0x57, 0x3c, 0x7a, 0x94, 0x02, 0x1b, 0x4a, 0xe9, 0x6a, 0xd4, 0x64, 0x9a, 0xfa, 0x66, 0xf3, 0x9c,
+    0xb3, 0xe4, 0xcf, 0xa4, 0x04, 0x6e, 0x4f, 0xed, 0x6c, 0xb8, 0x2f, 0x01, 0x38, 0x27, 0x43, 0x20,
+    0x9b, 0x7f, 0x66, 0xe4, 0x5f, 0x3f, 0x23, 0xd3, 0xc3, 0x9a, 0x21, 0x4b, 0x17, 0xd9, 0xe9, 0x5c,
+    0x1c, 0xaf, 0x07, 0x0a, 0x2e, 0xf0, 0x67, 0x0c, 0xae, 0x83, 0x1f, 0x38, 0x72, 0x66, 0xa4, 0x66,
+    0xd9, 0x9e, 0x57, 0x36, 0x59, 0xc6, 0x38, 0xa2, 0xda, 0xf3, 0xee, 0xe2, 0xc1, 0xd4, 0xa8, 0x0f,
+    0xfb, 0xad, 0x4b, 0x52, 0x39, 0x1d, 0xa9, 0x51, 0x89, 0x0a, 0xc6, 0x8f, 0x2e, 0xf4, 0x7b, 0x8b,
+    0xbf, 0xc1, 0xf2, 0xb7, 0x26, 0x75, 0xec, 0x2f, 0xae, 0x93, 0x0b, 0xa7, 0x2c, 0xbc, 0xf9, 0x2b,
+    0x81, 0xae, 0xd2, 0x8a, 0xd4, 0x72, 0x1f, 0x28, 0x0c, 0x17, 0xe2, 0x28, 0x92, 0x69, 0xb4, 0xf1,
+    0x3c, 0x43, 0x18, 0x8d, 0xe1, 0xb6, 0xe3, 0x74, 0xd3, 0x9f, 0xfb, 0x71, 0x5f, 0xaa, 0x8d, 0x42,
+    0xd9, 0xcf, 0x33, 0x98, 0x0a, 0x46, 0x36, 0x52, 0xb1, 0x7f, 0x1f, 0x30, 0x2e, 0xd9, 0xdc, 0x43,
+    0xdb, 0xd3, 0x58, 0xcd, 0x94, 0x6b, 0x30, 0xbc, 0x78, 0x97, 0x6c, 0x4d, 0xeb, 0x5e, 0xaf, 0xe5,
+    0x06, 0x63, 0x95, 0x72, 0xad, 0x94, 0xd1, 0x7a, 0xf6, 0xa4, 0xf0, 0xe4, 0xdb, 0x26, 0x7b, 0x83,
+    0x03, 0x21, 0x43, 0x41, 0xf5, 0x11, 0xd1, 0x9c, 0x91, 0x29, 0xea, 0xff, 0xfd, 0x9e, 0xde, 0xae,
+    0x78, 0x2f, 0xd7, 0x9e, 0x4d, 0x38, 0xd4, 0x17, 0xb9, 0xa5, 0x11, 0x0e, 0x5c, 0x33, 0x3e, 0x68,
+    0xfb, 0x16, 0xde, 0x1c, 0x63, 0x16, 0x2e, 0xc2, 0x1c, 0xd6, 0x50, 0xe5, 0x1a, 0x1a, 0xe4, 0xeb,
+    0xe8, 0xcb, 0xdc, 0xbd, 0x07, 0x37, 0x1e, 0xba, 0x36, 0x51, 0xdf, 0x1f, 0x34, 0x0b, 0xe5, 0xde,
+    0xdb, 0xee, 0x75, 0x52, 0x62, 0x87, 0xcd, 0x16, 0xab, 0xe1, 0xca, 0x36, 0xa6, 0x7a, 0xaf, 0x8a,
+    0x27, 0x2a, 0x65, 0x34, 0xfe, 0xe6, 0xf0, 0x0a, 0x72, 0x05, 0x92, 0xbd, 0xe6, 0xd3, 0xba, 0x0d,
+    0xaf, 0xb3, 0x41, 0x6d, 0xf8, 0x36, 0x11, 0xb5, 0x8c, 0xb6, 0x7d, 0x5e, 0x80, 0xd2, 0xea, 0xcf,
+    0x5a, 0xf9, 0xf2, 0xd5, 0x37, 0x99, 0xf5, 0xac, 0xe1, 0x75, 0xdf, 0x41, 0xca, 0xc1, 0x2b, 0x35,
+    0xa9, 0x65, 0x37, 0xe8, 0xe3, 0xad, 0xc0, 0x29, 0xd3, 0xf8, 0x2f, 0x7a, 0x34, 0x4d, 0x9c, 0xb2,
+    0x7b, 0xc9, 0xe5, 0x9e, 0x9f, 0x0a, 0xb8, 0xee, 0x02, 0x12, 0xcc, 0xba, 0xad, 0x3b, 0x2c, 0x40,
+    0x88, 0x7f, 0xc1, 0x57, 0x17, 0xb7, 0xcb, 0x3c, 0x51, 0xfd, 0xdd, 0xbb, 0x33, 0xf5, 0x3e, 0x90,
+    0x6c, 0x64, 0x9b, 0xd3, 0x06, 0xb7, 0x1f, 0x9f, 0x30, 0x0c, 0x33, 0xce, 0xb9, 0xcc, 0x83, 0x71,
+    0x41, 0x8d, 0x95, 0xf0, 0x72, 0xfc, 0x4b, 0x30, 0xe0, 0x68, 0xbf, 0x3f, 0x59, 0x53, 0x0f, 0x3b,
+    0x4a, 0xeb, 0xfc, 0xbf, 0x33, 0x47, 0x1f, 0xb7, 0x46, 0xfc, 0xed, 0xb8, 0x24, 0xd9, 0xc5, 0x91,
+    0xbe, 0x93, 0x44, 0x3d, 0x10, 0xc6, 0xa3, 0x29, 0x4d, 0xd3, 0xe0, 0x57, 0x3c, 0x75, 0xc8, 0x3a,
+    0x71, 0x8a, 0x74, 0x32, 0xee, 0x9e, 0x1a, 0x87, 0x2e, 0x33, 0xbb, 0xb3, 0x18, 0xc1, 0xa3, 0x58,
+    0xb9, 0xe7, 0xeb, 0xf1, 0x39, 0x17, 0x0e, 0x12, 0x37, 0xa4, 0x6a, 0xb5, 0xc8, 0xf7, 0x49, 0x94,
+    0x85, 0x9a, 0x1f, 0xc0, 0x30, 0xb5, 0x53, 0x64, 0xce, 0x08, 0x56, 0x43, 0x24, 0x60, 0x39, 0x70,
+    0xe9, 0x8f, 0x52, 0x63, 0x77, 0x79, 0x29, 0x5e, 0x7f, 0xb1, 0x44, 0xd4, 0x7f, 0x07, 0xea, 0x62,
+    0x9b, 0x1a, 0x30, 0xc9, 0x9b, 0x98, 0x67, 0xe3, 0x68, 0xa8, 0xc0, 0x09, 0xb6, 0x03, 0x8d, 0x55,
+    0xaf, 0x47, 0x01, 0x9c, 0x4f, 0xf7, 0xbb, 0xf9, 0xd8, 0x20, 0x74, 0xd4, 0xfe, 0xf8, 0xcc, 0xac,
+    0x12, 0xe9, 0xe8, 0x6a, 0x67, 0x39, 0x72, 0x17, 0x34, 0xcc, 0xf0, 0xc2, 0x52, 0x10, 0xf2, 0x55,
+    0x9b, 0x98, 0x23, 0x6e, 0xf2, 0xf3, 0x99, 0x57, 0x6d, 0xb8, 0x81, 0x2d, 0x56, 0xff, 0x32, 0x87,
+    0x11, 0xc6, 0x9f, 0xfa, 0x49, 0xd6, 0x8d, 0xb4, 0x4c, 0x47, 0x2b, 0xe3, 0x8c, 0x60, 0x42, 0xcb,
+    0x83, 0x7c, 0x39, 0x6e, 0x0c, 0x7f, 0xd3, 0xff, 0x53, 0x3e, 0x51, 0xff, 0xc7, 0xa3, 0x64, 0x54,
+    0x3a, 0x7b, 0x1d, 0x5e, 0x87, 0xef, 0x93, 0xc8, 0x03, 0x74, 0x4f, 0x0d, 0x98, 0xed, 0x71, 0xec,
+    0x6f, 0x0b, 0xdd, 0xdb, 0x9d, 0x59, 0xd6, 0x68, 0x56, 0xc4, 0x97, 0x37, 0x46, 0xdd, 0x1b, 0x39,
+    0x77, 0xbf, 0x50, 0x97, 0xe6, 0x3b, 0x06, 0x3c, 0xd2, 0x31, 0xc6, 0xf1, 0x13, 0xcf, 0x02, 0x0f,
+    0x78, 0x42, 0x16, 0x8d, 0x75, 0xf8, 0x63, 0x64, 0xc9, 0xa1, 0xf8, 0x02, 0x47, 0xf8, 0x63, 0xf6,
+    0xa4, 0x0f, 0xf9, 0xe9, 0x93, 0xc6, 0x75, 0x18, 0x51, 0xfe, 0xa3, 0xe5, 0x6f, 0xff, 0x6b, 0xb2,
+    0xad, 0x30, 0xa2, 0x7d, 0xf3, 0xfb, 0x9d, 0x8b, 0x41, 0xd8, 0x43, 0xe1, 0x8b, 0x78, 0x6c, 0x73,
+    0xd3, 0xfc, 0x51, 0xa2, 0xde, 0xf6, 0x84, 0x24, 0x47, 0xbb, 0x9c, 0xb8, 0x82, 0xe8, 0xe7, 0xd1,
+    0x23, 0x07, 0xdb, 0xab, 0xb6, 0xc0, 0x74, 0x97, 0x03, 0x65, 0x2d, 0xd6, 0xf7, 0xd2, 0xb0, 0x3a,
+    0x0f, 0x38, 0xdb, 0x5f, 0x9c, 0x15, 0xe6, 0xbc, 0xbb, 0x5e, 0x80, 0x3f, 0x44, 0xd7, 0x4c, 0xc2,
+    0x20, 0xb6, 0x7c, 0x67, 0x7b, 0x44, 0xc5, 0xd2, 0x12, 0x42, 0x08, 0xcd, 0x87, 0x21, 0x56, 0xd6,
+    0x76, 0x2e, 0x88, 0x58, 0x17, 0x3b, 0x56, 0x21, 0x2d, 0x7a, 0x78, 0xee, 0x0b, 0xe4, 0x27, 0x98,
+    0xcc, 0x41, 0x4b, 0xf8, 0x45, 0xcb, 0xcd, 0x3d, 0x19, 0x20, 0xda, 0xcd, 0xac, 0x5a, 0xc7, 0xa4,
+    0xf7, 0xe0, 0x75, 0xd5, 0x67, 0x25, 0x13, 0xbe, 0x57, 0x5f, 0xf3, 0xfa, 0xda, 0x9f, 0xe5, 0x63,
+    0x03, 0xe5, 0xdf, 0x6a, 0xf6, 0xc3, 0x92, 0x45, 0x9e, 0x2b, 0x31, 0x2f, 0x10, 0xd3, 0x8d, 0xef,
+    0x5f, 0x12, 0xf7, 0x99, 0xe4, 0x53, 0x1d, 0x52, 0xdb, 0x20, 0x68, 0x90, 0x1e, 0xd7, 0x2c, 0x8e,
+    0x69, 0x25, 0xc6, 0x2c, 0x5a, 0xe7, 0xd1, 0x7a, 0xde, 0x04, 0xd7, 0x67, 0x70, 0x15, 0x17, 0xda,
+    0x1f, 0xf5, 0x0f, 0x2e, 0x6e, 0xe3, 0xba, 0x19, 0xfa, 0xf7, 0x02, 0xd4, 0x85, 0x60, 0x81, 0x67,
+    0x93, 0xa1, 0xc4, 0x59, 0xe3, 0xf3, 0xdf, 0x56, 0xce, 0x91, 0x16, 0xd7, 0x33, 0x19, 0x3a, 0x53,
+    0x60, 0x83, 0x62, 0x33, 0x80, 0x05, 0x64, 0x8f, 0x69, 0x9f, 0x74, 0xfe, 0x05, 0x5c, 0x2b, 0xcf,
+    0xca, 0x01, 0xcc, 0x3c, 0xe6, 0x2c, 0xff, 0xa2, 0xfd, 0x40, 0x5e, 0xe5, 0x3b, 0x25, 0xb7, 0x12,
+    0xd9, 0xba, 0xbb, 0x6f, 0x34, 0xc6, 0x77, 0xb2, 0x0a, 0xbd, 0x3c, 0x3e, 0xb1, 0x0d, 0xd2, 0x5f,
+    0x26, 0x6e, 0xa2, 0xe3, 0xb6, 0xd5, 0x46, 0x2c, 0x93, 0x11, 0xcd, 0x75, 0xf3, 0x9f, 0xd9, 0x71,
+    0xb9, 0x94, 0xd3, 0xb1, 0x37, 0xf2, 0x09, 0x5a, 0x97, 0x8d, 0x7c, 0x65, 0x48, 0x4e, 0x22, 0xa7,
+    0x7c, 0xa0, 0xb3, 0x7d, 0x18, 0xf6, 0xc2, 0xa7, 0xc7, 0xf8, 0x43, 0x9e, 0x10, 0xf2, 0xc8, 0xdb,
+    0xdc, 0x67, 0x05, 0x0e, 0xb1, 0x4b, 0x78, 0x7e, 0x7f, 0x00, 0x2f, 0x2d, 0x5f, 0x1c, 0xf1, 0x21,
+    0x12, 0x59, 0x38, 0x9b, 0xf7, 0x55, 0xdd, 0x4f, 0x4a, 0xf6, 0x53, 0x57, 0x42, 0x7e, 0x6b, 0xf8,
+    0x48, 0x8d, 0x25, 0x0c, 0x6e, 0xd6, 0x24, 0xff, 0xa2, 0x37, 0xc1, 0xbc, 0xc9, 0x9d, 0xd2, 0xe4,
+    0x3d, 0xe3, 0xe5, 0xae, 0xf8, 0x67, 0x16, 0xf0, 0xa0, 0x53, 0x28, 0xb8, 0x2d, 0x8b, 0x40, 0xcd,
+    0xc5, 0xe9, 0x5b, 0xbd, 0xd3, 0xb8, 0xfa, 0x63, 0xc2, 0xa7, 0x5c, 0xf5, 0xa3, 0xd1, 0x14, 0x40,
+    0x9f, 0x39, 0x6e, 0xcc, 0xef, 0xd9, 0xea, 0x1b, 0x81, 0x0c, 0x50, 0x39, 0x95, 0x99, 0xb6, 0xa8,
+    0xae, 0xed, 0xf7, 0x0b, 0x9d, 0xe5, 0x17, 0x81, 0xb4, 0x48, 0x5e, 0x12, 0xe7, 0xdb, 0xd6, 0x17,
+    0x08, 0x74, 0x21, 0x1e, 0x7a, 0x87, 0xdd, 0x80, 0xcd, 0xbb, 0x1e, 0xd0, 0xf1, 0x59, 0x7f, 0x80,
+    0x2f, 0xa0, 0x3d, 0xb2, 0xc7, 0xea, 0x17, 0x7c, 0x5c, 0xdb, 0xae, 0x03, 0xb9, 0xab, 0x5f, 0x51,
+    0xfb, 0x19, 0xcb, 0xa6, 0x5e, 0x69, 0x55, 0x6a, 0x92, 0x0d, 0x64, 0xb9, 0xa1, 0xf3, 0x40, 0x18,
+    0x0b, 0x75, 0x0e, 0x92, 0x71, 0xd8, 0x9b, 0xc2, 0x5d, 0x08, 0x7a, 0x6f, 0x67, 0xdb, 0xcb, 0x77,
+    0xfa, 0x70, 0xc3, 0x8e, 0x5a, 0x5f, 0xae, 0xf5, 0x9d, 0x29, 0x03, 0x86, 0x63, 0xfe, 0x3a, 0xe1,
+    0x2d, 0xeb, 0x70, 0x00, 0x8a, 0xfd, 0x7a, 0x38, 0xd4, 0x0d, 0x94, 0x11, 0x87, 0xc3, 0x9a, 0x24,
+    0xfb, 0x2e, 0x61, 0x6f, 0xfe, 0xdc, 0xd1, 0x22, 0x5c, 0x4d, 0xcf, 0x12, 0x21, 0x32, 0x17, 0x7d,
+    0x0a, 0x16, 0xe0, 0x3f, 0x62, 0xfd, 0x03, 0x17, 0x33, 0xb7, 0x42, 0x73, 0x97, 0x17, 0xc2, 0x3c,
+    0xcb, 0x16, 0x05, 0x5c, 0xf4, 0x3a, 0x99, 0xbc, 0xd1, 0x6f, 0xc5, 0x23, 0xa0, 0x6d, 0xaf, 0x9f,
+    0x3e, 0xd6, 0x76, 0x95, 0x79, 0xac, 0xda, 0x04, 0x48, 0x02, 0x6b, 0x91, 0xd4, 0x4d, 0xd3, 0x36,
+    0xf3, 0x9c, 0x38, 0x61, 0x06, 0x08, 0x6a, 0x65, 0xec, 0xbb, 0xc2, 0xf1, 0x10, 0x4e, 0x4e, 0x19,
+    0xa6, 0xdb, 0x71, 0xc1, 0x82, 0x9d, 0xff, 0x44, 0xfb, 0xb1, 0x01, 0x2a, 0xf9, 0xf8, 0x55, 0x29,
+    0x93, 0x63, 0xcf, 0xc1, 0xd7, 0x1f, 0xed, 0x4a, 0xee, 0xe3, 0x7a, 0xe3, 0x13, 0x3d, 0x3d, 0xb9,
+    0xfe, 0xfe, 0x89, 0x0f, 0xc0, 0xea, 0xa7, 0x01, 0xe5, 0x47, 0x9f, 0x81, 0xf7, 0x4a, 0xc8, 0xd1,
+    0x0e, 0xf0, 0xdf, 0xe0, 0x89, 0xd9, 0x29, 0x32, 0xcf, 0xf2, 0xb5, 0x54, 0x5b, 0x4d, 0xa4, 0x23,
+    0x52, 0x18, 0x51, 0xfd, 0x14, 0x85, 0xef, 0xb7, 0x3d, 0x8c, 0xcc, 0x3e, 0x60, 0x22, 0xc8, 0xe9,
+    0xfa, 0x29, 0x4c, 0xfd, 0x09, 0xd0, 0xfb, 0xd8, 0x91, 0xbd, 0x42, 0xb1, 0x76, 0xb5, 0x70, 0x7d,
+    0xc2, 0x3d, 0xed, 0xff, 0x5e, 0xff, 0x67, 0x5b, 0x43, 0x5b, 0x6e, 0xe9, 0x65, 0xd5, 0x03, 0x7f,
 };
+const ShaderModule Blob034 = { Blob034_Data, 6624u, 6515u, 34u };
 
-extern const uint32_t Blob072[6515];
-const uint32_t Blob072[6515] = {
-    0x07230203, 0x00010300, 0x0008000b, 0x0000042c, 0x00000000, 0x00020011, 0x00000001, 0x0006000b,
-    0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001,
-    0x0006000f, 0x00000005, 0x00000004, 0x6e69616d, 0x00000000, 0x000002b4, 0x00060010, 0x00000004,
-    0x00000011, 0x00000008, 0x00000008, 0x00000001, 0x00030003, 0x00000002, 0x000001c2, 0x000a0004,
-    0x475f4c47, 0x4c474f4f, 0x70635f45, 0x74735f70, 0x5f656c79, 0x656e696c, 0x7269645f, 0x69746365,
-    0x00006576, 0x00080004, 0x475f4c47, 0x4c474f4f, 0x6e695f45, 0x64756c63, 0x69645f65, 0x74636572,
-    0x00657669, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000, 0x00070005, 0x0000000a, 0x726f6e55,
-    0x6f54386d, 0x36626752, 0x3b317528, 0x00000000, 0x00040005, 0x00000009, 0x756c6176, 0x00000065,
-    0x00070005, 0x0000000d, 0x726f6e55, 0x6f54386d, 0x68706c41, 0x75283561, 0x00003b31, 0x00040005,
-    0x0000000c, 0x756c6176, 0x00000065, 0x00070005, 0x00000014, 0x64616f4c, 0x616e6946, 0x2842466c,
-    0x3b326976, 0x00000000, 0x00050005, 0x00000013, 0x69736f70, 0x6e6f6974, 0x00000000, 0x00050005,
-    0x00000017, 0x6f6c6f43, 0x28523672, 0x003b3175, 0x00040005, 0x00000016, 0x6f6c6f63, 0x00000072,
-    0x00050005, 0x0000001a, 0x6f6c6f43, 0x28473672, 0x003b3175, 0x00040005, 0x00000019, 0x6f6c6f63,
-    0x00000072, 0x00050005, 0x0000001d, 0x6f6c6f43, 0x28423672, 0x003b3175, 0x00040005, 0x0000001c,
-    0x6f6c6f63, 0x00000072, 0x00080005, 0x00000024, 0x6b636150, 0x6f6c6f43, 0x75283672, 0x31753b31,
-    0x3b31753b, 0x003b3175, 0x00030005, 0x00000020, 0x00000072, 0x00030005, 0x00000021, 0x00000067,
-    0x00030005, 0x00000022, 0x00000062, 0x00040005, 0x00000023, 0x68706c61, 0x00000061, 0x00070005,
-    0x0000002a, 0x6e656c42, 0x75283464, 0x31753b31, 0x3b31753b, 0x003b3175, 0x00040005, 0x00000026,
-    0x73726966, 0x00000074, 0x00040005, 0x00000027, 0x6f636573, 0x0000646e, 0x00030005, 0x00000028,
-    0x00617665, 0x00030005, 0x00000029, 0x00627665, 0x00060005, 0x0000002f, 0x6e656c42, 0x75283564,
-    0x31753b31, 0x0000003b, 0x00040005, 0x0000002d, 0x73726966, 0x00000074, 0x00040005, 0x0000002e,
-    0x6f636573, 0x0000646e, 0x00080005, 0x00000035, 0x67697242, 0x656e7468, 0x70557373, 0x3b317528,
-    0x753b3175, 0x00003b31, 0x00040005, 0x00000032, 0x6f6c6f63, 0x00000072, 0x00040005, 0x00000033,
-    0x74636166, 0x0000726f, 0x00040005, 0x00000034, 0x73616962, 0x00000000, 0x00090005, 0x0000003a,
-    0x67697242, 0x656e7468, 0x6f447373, 0x75286e77, 0x31753b31, 0x3b31753b, 0x00000000, 0x00040005,
-    0x00000037, 0x6f6c6f63, 0x00000072, 0x00040005, 0x00000038, 0x74636166, 0x0000726f, 0x00040005,
-    0x00000039, 0x73616962, 0x00000000, 0x00090005, 0x00000041, 0x64616f4c, 0x74706143, 0x53657275,
-    0x63656469, 0x75287261, 0x75763b31, 0x00003b32, 0x00050005, 0x0000003f, 0x65666572, 0x636e6572,
-    0x00000065, 0x00070005, 0x00000040, 0x6c616373, 0x69576465, 0x6e696874, 0x65786950, 0x0000006c,
-    0x00090005, 0x00000046, 0x64616f4c, 0x74706143, 0x53657275, 0x6372756f, 0x28443365, 0x3b327576,
-    0x003b3175, 0x00050005, 0x00000044, 0x69736f70, 0x6e6f6974, 0x00000000, 0x00050005, 0x00000045,
-    0x656e696c, 0x6174654d, 0x00000000, 0x000a0005, 0x00000050, 0x706d6f43, 0x5365736f, 0x6372756f,
-    0x75284165, 0x75763b31, 0x31753b32, 0x3b31753b, 0x003b3162, 0x00040005, 0x0000004b, 0x65726373,
-    0x00006e65, 0x00030005, 0x0000004c, 0x00006469, 0x00050005, 0x0000004d, 0x6974616e, 0x6e496576,
-    0x00786564, 0x00050005, 0x0000004e, 0x656e696c, 0x6174654d, 0x00000000, 0x00060005, 0x0000004f,
-    0x72756f73, 0x44336563, 0x696c6156, 0x00000064, 0x00090005, 0x00000053, 0x6d726f4e, 0x7a696c61,
-    0x70614365, 0x65727574, 0x78695064, 0x75286c65, 0x00003b31, 0x00040005, 0x00000052, 0x6f6c6f63,
-    0x00000072, 0x00040005, 0x00000068, 0x65786574, 0x0000006c, 0x00040005, 0x0000006b, 0x616e6946,
-    0x0042466c, 0x00050005, 0x00000071, 0x6e617571, 0x657a6974, 0x00000064, 0x00040005, 0x00000077,
-    0x61726170, 0x0000006d, 0x00040005, 0x0000007c, 0x61726170, 0x0000006d, 0x00040005, 0x00000084,
-    0x61726170, 0x0000006d, 0x00040005, 0x0000008c, 0x61726170, 0x0000006d, 0x00040005, 0x000000b3,
-    0x61726170, 0x0000006d, 0x00040005, 0x000000b8, 0x61726170, 0x0000006d, 0x00040005, 0x000000c2,
-    0x61726170, 0x0000006d, 0x00040005, 0x000000c7, 0x61726170, 0x0000006d, 0x00040005, 0x000000cf,
-    0x61726170, 0x0000006d, 0x00040005, 0x000000d4, 0x61726170, 0x0000006d, 0x00040005, 0x000000dc,
-    0x61726170, 0x0000006d, 0x00040005, 0x000000dd, 0x61726170, 0x0000006d, 0x00040005, 0x000000de,
-    0x61726170, 0x0000006d, 0x00040005, 0x000000df, 0x61726170, 0x0000006d, 0x00030005, 0x000000e3,
-    0x00617665, 0x00030005, 0x000000e8, 0x00627665, 0x00040005, 0x000000ec, 0x61726170, 0x0000006d,
-    0x00040005, 0x000000f1, 0x61726170, 0x0000006d, 0x00040005, 0x000000fb, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000100, 0x61726170, 0x0000006d, 0x00040005, 0x00000108, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000010d, 0x61726170, 0x0000006d, 0x00040005, 0x00000115, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000116, 0x61726170, 0x0000006d, 0x00040005, 0x00000117, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000118, 0x61726170, 0x0000006d, 0x00040005, 0x0000011c, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000011f, 0x61726170, 0x0000006d, 0x00040005, 0x00000129, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000012c, 0x61726170, 0x0000006d, 0x00040005, 0x00000136, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000139, 0x61726170, 0x0000006d, 0x00040005, 0x00000143, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000144, 0x61726170, 0x0000006d, 0x00040005, 0x00000145, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000146, 0x61726170, 0x0000006d, 0x00040005, 0x0000014a, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000014d, 0x61726170, 0x0000006d, 0x00040005, 0x00000156, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000159, 0x61726170, 0x0000006d, 0x00040005, 0x00000162, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000165, 0x61726170, 0x0000006d, 0x00040005, 0x0000016e, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000016f, 0x61726170, 0x0000006d, 0x00040005, 0x00000170, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000171, 0x61726170, 0x0000006d, 0x00040005, 0x00000175, 0x72646461, 0x00737365,
-    0x00040005, 0x00000179, 0x6b6e6162, 0x00000000, 0x00040005, 0x0000017e, 0x73726576, 0x006e6f69,
-    0x00060005, 0x00000183, 0x706d6173, 0x5073656c, 0x69507265, 0x006c6578, 0x00050005, 0x00000184,
-    0x65726353, 0x69576e65, 0x00687464, 0x00050005, 0x00000186, 0x6c616353, 0x63614665, 0x00726f74,
-    0x00040005, 0x0000018a, 0x6c6c6563, 0x00000000, 0x00050005, 0x00000194, 0x706d6173, 0x6e49656c,
-    0x00786564, 0x00080005, 0x0000019d, 0x74706143, 0x53657275, 0x63656469, 0x75427261, 0x72656666,
-    0x00000000, 0x00090006, 0x0000019d, 0x00000000, 0x74706143, 0x53657275, 0x63656469, 0x69507261,
-    0x736c6578, 0x00000000, 0x00030005, 0x0000019f, 0x00000000, 0x00050005, 0x000001ab, 0x736f5078,
-    0x6f697469, 0x0000006e, 0x00040005, 0x000001b2, 0x72756f73, 0x00586563, 0x00060005, 0x000001ce,
-    0x68737550, 0x736e6f43, 0x746e6174, 0x00000073, 0x00060006, 0x000001ce, 0x00000000, 0x56727543,
-    0x61697261, 0x0000746e, 0x00060006, 0x000001ce, 0x00000001, 0x57786554, 0x68746469, 0x00000000,
-    0x00060006, 0x000001ce, 0x00000002, 0x48786554, 0x68676965, 0x00000074, 0x00060006, 0x000001ce,
-    0x00000003, 0x57786554, 0x53706172, 0x00000000, 0x00060006, 0x000001ce, 0x00000004, 0x57786554,
-    0x54706172, 0x00000000, 0x00070006, 0x000001ce, 0x00000005, 0x49786554, 0x70614373, 0x65727574,
-    0x00000000, 0x00070006, 0x000001ce, 0x00000006, 0x74706143, 0x59657275, 0x7366664f, 0x00007465,
-    0x00050006, 0x000001ce, 0x00000007, 0x6461705f, 0x00000000, 0x00030005, 0x000001d0, 0x00006370,
-    0x00040005, 0x000001e4, 0x61726170, 0x0000006d, 0x00040005, 0x000001ea, 0x65736162, 0x00000000,
-    0x00040005, 0x000001ec, 0x6f6c6562, 0x00000077, 0x00080005, 0x000001ee, 0x75727453, 0x72757463,
-    0x6e496465, 0x42747570, 0x65666675, 0x00000072, 0x00070006, 0x000001ee, 0x00000000, 0x75727453,
-    0x72757463, 0x6e496465, 0x00747570, 0x00030005, 0x000001f0, 0x00000000, 0x00040005, 0x000001f6,
-    0x766f6261, 0x00000065, 0x00040005, 0x000001fe, 0x746e6f63, 0x006c6f72, 0x00050005, 0x00000206,
-    0x65666572, 0x636e6572, 0x00000065, 0x00040005, 0x0000020e, 0x67616c66, 0x00000073, 0x00040005,
-    0x00000212, 0x6f6c6f63, 0x00000072, 0x00040005, 0x00000224, 0x61726170, 0x0000006d, 0x00040005,
-    0x00000226, 0x61726170, 0x0000006d, 0x00040005, 0x0000022b, 0x746f6c73, 0x00000000, 0x00040005,
-    0x00000235, 0x61726170, 0x0000006d, 0x00040005, 0x00000237, 0x61726170, 0x0000006d, 0x00040005,
-    0x0000023d, 0x61726170, 0x0000006d, 0x00040005, 0x0000023f, 0x61726170, 0x0000006d, 0x00040005,
-    0x0000024a, 0x65646f6d, 0x00000000, 0x00030005, 0x0000024e, 0x00617665, 0x00030005, 0x00000252,
-    0x00627665, 0x00040005, 0x00000261, 0x61726170, 0x0000006d, 0x00040005, 0x00000263, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000265, 0x61726170, 0x0000006d, 0x00040005, 0x00000267, 0x61726170,
-    0x0000006d, 0x00040005, 0x0000026f, 0x61726170, 0x0000006d, 0x00040005, 0x00000271, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000273, 0x61726170, 0x0000006d, 0x00040005, 0x0000027b, 0x61726170,
-    0x0000006d, 0x00040005, 0x0000027d, 0x61726170, 0x0000006d, 0x00040005, 0x0000027f, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000286, 0x61726170, 0x0000006d, 0x00040005, 0x00000288, 0x61726170,
-    0x0000006d, 0x00030005, 0x0000028f, 0x00000072, 0x00030005, 0x00000294, 0x00000067, 0x00030005,
-    0x0000029a, 0x00000062, 0x00030005, 0x000002a0, 0x00000061, 0x00030005, 0x000002b1, 0x00006469,
-    0x00080005, 0x000002b4, 0x475f6c67, 0x61626f6c, 0x766e496c, 0x7461636f, 0x496e6f69, 0x00000044,
-    0x00040005, 0x000002b7, 0x63746162, 0x00000068, 0x00040005, 0x000002bb, 0x6974616e, 0x00596576,
-    0x00040005, 0x000002de, 0x6c616373, 0x00596465, 0x00040005, 0x000002e5, 0x6974616e, 0x00586576,
-    0x00050005, 0x000002ea, 0x6974616e, 0x6e496576, 0x00786564, 0x00050005, 0x000002ef, 0x6d6d6f63,
-    0x42646e61, 0x00657361, 0x00050005, 0x000002f4, 0x74706163, 0x43657275, 0x0000746e, 0x00040005,
-    0x000002f8, 0x6d6d6f63, 0x00646e61, 0x00040005, 0x000002fd, 0x74646977, 0x00000068, 0x00060005,
-    0x00000317, 0x72756f73, 0x63536563, 0x6e656572, 0x00000000, 0x00060005, 0x0000031b, 0x72756f73,
-    0x44336563, 0x696c6156, 0x00000064, 0x00050005, 0x0000031f, 0x656e696c, 0x6174654d, 0x00000000,
-    0x00040005, 0x00000328, 0x72756f73, 0x00416563, 0x00040005, 0x00000338, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000339, 0x61726170, 0x0000006d, 0x00040005, 0x00000343, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000345, 0x61726170, 0x0000006d, 0x00040005, 0x00000346, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000348, 0x61726170, 0x0000006d, 0x00040005, 0x0000034a, 0x61726170, 0x0000006d,
-    0x00070005, 0x0000034e, 0x72756f73, 0x52426563, 0x72656665, 0x65636e65, 0x00000000, 0x00040005,
-    0x00000354, 0x72756f73, 0x00426563, 0x00040005, 0x00000362, 0x61726170, 0x0000006d, 0x00040005,
-    0x00000364, 0x61726170, 0x0000006d, 0x00040005, 0x0000036d, 0x65646f6d, 0x00000000, 0x00040005,
-    0x00000372, 0x75736572, 0x0000746c, 0x00030005, 0x0000037e, 0x00617665, 0x00030005, 0x00000382,
-    0x00627665, 0x00040005, 0x00000387, 0x68706c61, 0x00004161, 0x00040005, 0x0000038c, 0x68706c61,
-    0x00004261, 0x00030005, 0x00000391, 0x00000072, 0x00030005, 0x000003a5, 0x00000067, 0x00030005,
-    0x000003bb, 0x00000062, 0x00040005, 0x000003d1, 0x68706c61, 0x00000061, 0x00040005, 0x000003e6,
-    0x72646461, 0x00737365, 0x00040005, 0x000003ee, 0x6b6e6162, 0x00000000, 0x00040005, 0x000003f1,
-    0x73726576, 0x006e6f69, 0x00060005, 0x000003f5, 0x706d6173, 0x5073656c, 0x69507265, 0x006c6578,
-    0x00040005, 0x000003f9, 0x6c6c6563, 0x00000000, 0x00050005, 0x00000401, 0x706d6173, 0x6e49656c,
-    0x00786564, 0x00040005, 0x00000410, 0x61726170, 0x0000006d, 0x00060005, 0x00000414, 0x65726353,
-    0x65486e65, 0x74686769, 0x00000000, 0x00060005, 0x00000415, 0x5778614d, 0x546b726f, 0x73656c69,
-    0x00000000, 0x00070005, 0x00000418, 0x6d617246, 0x66756265, 0x53726566, 0x64697274, 0x00000065,
-    0x00060005, 0x00000419, 0x656c6954, 0x72655073, 0x656e694c, 0x00000000, 0x00050005, 0x0000041a,
-    0x656c6954, 0x656e694c, 0x00000073, 0x00050005, 0x0000041f, 0x6174654d, 0x66696e55, 0x006d726f,
-    0x00060006, 0x0000041f, 0x00000000, 0x506d754e, 0x67796c6f, 0x00736e6f, 0x00060006, 0x0000041f,
-    0x00000001, 0x566d754e, 0x61697261, 0x0073746e, 0x00060006, 0x0000041f, 0x00000002, 0x68706c41,
-    0x66655261, 0x00000000, 0x00050006, 0x0000041f, 0x00000003, 0x70736944, 0x00746e43, 0x00060006,
-    0x0000041f, 0x00000004, 0x6e6f6f54, 0x6c626154, 0x00000065, 0x00060006, 0x0000041f, 0x00000005,
-    0x61656c43, 0x6c6f4372, 0x0000726f, 0x00060006, 0x0000041f, 0x00000006, 0x61656c43, 0x70654472,
-    0x00006874, 0x00060006, 0x0000041f, 0x00000007, 0x61656c43, 0x74744172, 0x00000072, 0x00060006,
-    0x0000041f, 0x00000008, 0x4f676f46, 0x65736666, 0x00000074, 0x00060006, 0x0000041f, 0x00000009,
-    0x53676f46, 0x74666968, 0x00000000, 0x00060006, 0x0000041f, 0x0000000a, 0x43676f46, 0x726f6c6f,
-    0x00000000, 0x00080006, 0x0000041f, 0x0000000b, 0x61656c43, 0x74694272, 0x4f70616d, 0x65736666,
-    0x00000074, 0x00030005, 0x00000421, 0x00000000, 0x00090005, 0x00000425, 0x73657250, 0x61746e65,
-    0x6e6f6974, 0x7074754f, 0x75427475, 0x72656666, 0x00000000, 0x00080006, 0x00000425, 0x00000000,
-    0x73657250, 0x61746e65, 0x6e6f6974, 0x7074754f, 0x00007475, 0x00030005, 0x00000427, 0x00000000,
-    0x00060005, 0x00000428, 0x65726944, 0x754f7463, 0x74757074, 0x00706f54, 0x00070005, 0x00000429,
-    0x65726944, 0x754f7463, 0x74757074, 0x74746f42, 0x00006d6f, 0x00040047, 0x0000006b, 0x00000022,
-    0x00000000, 0x00040047, 0x0000006b, 0x00000021, 0x0000000b, 0x00030047, 0x0000006b, 0x00000018,
-    0x00040047, 0x00000184, 0x00000001, 0x00000000, 0x00040047, 0x0000019c, 0x00000006, 0x00000004,
-    0x00050048, 0x0000019d, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x0000019d, 0x00000002,
-    0x00040047, 0x0000019f, 0x00000022, 0x00000000, 0x00040047, 0x0000019f, 0x00000021, 0x0000000e,
-    0x00050048, 0x000001ce, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x000001ce, 0x00000001,
-    0x00000023, 0x00000004, 0x00050048, 0x000001ce, 0x00000002, 0x00000023, 0x00000008, 0x00050048,
-    0x000001ce, 0x00000003, 0x00000023, 0x0000000c, 0x00050048, 0x000001ce, 0x00000004, 0x00000023,
-    0x00000010, 0x00050048, 0x000001ce, 0x00000005, 0x00000023, 0x00000014, 0x00050048, 0x000001ce,
-    0x00000006, 0x00000023, 0x00000018, 0x00050048, 0x000001ce, 0x00000007, 0x00000023, 0x0000001c,
-    0x00030047, 0x000001ce, 0x00000002, 0x00040047, 0x000001ed, 0x00000006, 0x00000004, 0x00040048,
-    0x000001ee, 0x00000000, 0x00000018, 0x00050048, 0x000001ee, 0x00000000, 0x00000023, 0x00000000,
-    0x00030047, 0x000001ee, 0x00000002, 0x00040047, 0x000001f0, 0x00000022, 0x00000000, 0x00040047,
-    0x000001f0, 0x00000021, 0x0000000c, 0x00040047, 0x000002b4, 0x0000000b, 0x0000001c, 0x00040047,
-    0x00000414, 0x00000001, 0x00000001, 0x00040047, 0x00000415, 0x00000001, 0x00000002, 0x00040047,
-    0x0000041d, 0x00000006, 0x00000010, 0x00050048, 0x0000041f, 0x00000000, 0x00000023, 0x00000000,
-    0x00050048, 0x0000041f, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x0000041f, 0x00000002,
-    0x00000023, 0x00000008, 0x00050048, 0x0000041f, 0x00000003, 0x00000023, 0x0000000c, 0x00050048,
-    0x0000041f, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x0000041f, 0x00000005, 0x00000023,
-    0x00000230, 0x00050048, 0x0000041f, 0x00000006, 0x00000023, 0x00000234, 0x00050048, 0x0000041f,
-    0x00000007, 0x00000023, 0x00000238, 0x00050048, 0x0000041f, 0x00000008, 0x00000023, 0x0000023c,
-    0x00050048, 0x0000041f, 0x00000009, 0x00000023, 0x00000240, 0x00050048, 0x0000041f, 0x0000000a,
-    0x00000023, 0x00000244, 0x00050048, 0x0000041f, 0x0000000b, 0x00000023, 0x00000248, 0x00030047,
-    0x0000041f, 0x00000002, 0x00040047, 0x00000421, 0x00000022, 0x00000000, 0x00040047, 0x00000421,
-    0x00000021, 0x00000000, 0x00040047, 0x00000424, 0x00000006, 0x00000004, 0x00050048, 0x00000425,
-    0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000425, 0x00000002, 0x00040047, 0x00000427,
-    0x00000022, 0x00000000, 0x00040047, 0x00000427, 0x00000021, 0x0000000d, 0x00040047, 0x00000428,
-    0x00000022, 0x00000000, 0x00040047, 0x00000428, 0x00000021, 0x00000011, 0x00030047, 0x00000428,
-    0x00000019, 0x00040047, 0x00000429, 0x00000022, 0x00000000, 0x00040047, 0x00000429, 0x00000021,
-    0x00000012, 0x00030047, 0x00000429, 0x00000019, 0x00040047, 0x0000042b, 0x0000000b, 0x00000019,
-    0x00020013, 0x00000002, 0x00030021, 0x00000003, 0x00000002, 0x00040015, 0x00000006, 0x00000020,
-    0x00000000, 0x00040020, 0x00000007, 0x00000007, 0x00000006, 0x00040021, 0x00000008, 0x00000006,
-    0x00000007, 0x00040015, 0x0000000f, 0x00000020, 0x00000001, 0x00040017, 0x00000010, 0x0000000f,
-    0x00000002, 0x00040020, 0x00000011, 0x00000007, 0x00000010, 0x00040021, 0x00000012, 0x00000006,
-    0x00000011, 0x00070021, 0x0000001f, 0x00000006, 0x00000007, 0x00000007, 0x00000007, 0x00000007,
-    0x00050021, 0x0000002c, 0x00000006, 0x00000007, 0x00000007, 0x00060021, 0x00000031, 0x00000006,
-    0x00000007, 0x00000007, 0x00000007, 0x00040017, 0x0000003c, 0x00000006, 0x00000002, 0x00040020,
-    0x0000003d, 0x00000007, 0x0000003c, 0x00050021, 0x0000003e, 0x00000006, 0x00000007, 0x0000003d,
-    0x00050021, 0x00000043, 0x00000006, 0x0000003d, 0x00000007, 0x00020014, 0x00000048, 0x00040020,
-    0x00000049, 0x00000007, 0x00000048, 0x00080021, 0x0000004a, 0x00000006, 0x00000007, 0x0000003d,
-    0x00000007, 0x00000007, 0x00000049, 0x0004002b, 0x00000006, 0x00000056, 0x0000003f, 0x0004002b,
-    0x00000006, 0x00000058, 0x0000007f, 0x0004002b, 0x00000006, 0x0000005a, 0x000000ff, 0x0004002b,
-    0x00000006, 0x0000005f, 0x0000001f, 0x00030016, 0x00000065, 0x00000020, 0x00040017, 0x00000066,
-    0x00000065, 0x00000004, 0x00040020, 0x00000067, 0x00000007, 0x00000066, 0x00090019, 0x00000069,
-    0x00000065, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000004, 0x00040020,
-    0x0000006a, 0x00000000, 0x00000069, 0x0004003b, 0x0000006a, 0x0000006b, 0x00000000, 0x00040017,
-    0x0000006f, 0x00000006, 0x00000004, 0x00040020, 0x00000070, 0x00000007, 0x0000006f, 0x0004002b,
-    0x00000065, 0x00000073, 0x437f0000, 0x0004002b, 0x00000006, 0x00000078, 0x00000000, 0x0004002b,
-    0x00000006, 0x0000007d, 0x00000001, 0x0004002b, 0x0000000f, 0x00000081, 0x00000008, 0x0004002b,
-    0x00000006, 0x00000085, 0x00000002, 0x0004002b, 0x0000000f, 0x00000089, 0x00000010, 0x0004002b,
-    0x00000006, 0x0000008d, 0x00000003, 0x0004002b, 0x0000000f, 0x00000091, 0x00000018, 0x0004002b,
-    0x00000006, 0x000000be, 0x00000008, 0x0004002b, 0x0000000f, 0x000000c0, 0x00000004, 0x0004002b,
-    0x00000006, 0x000000e9, 0x00000020, 0x0004002b, 0x00000006, 0x000000f7, 0x00000010, 0x0004002b,
-    0x0000000f, 0x000000f9, 0x00000005, 0x0004002b, 0x00000006, 0x00000177, 0x0000ffff, 0x0004002b,
-    0x00000006, 0x0000017b, 0x0000001c, 0x0004002b, 0x00000006, 0x00000180, 0x0000001e, 0x00040032,
-    0x0000000f, 0x00000184, 0x00000100, 0x0004002b, 0x0000000f, 0x00000185, 0x00000100, 0x00060034,
-    0x0000000f, 0x00000186, 0x00000087, 0x00000184, 0x00000185, 0x00060034, 0x00000006, 0x00000187,
-    0x00000080, 0x00000186, 0x00000078, 0x00060034, 0x00000006, 0x00000188, 0x00000080, 0x00000186,
-    0x00000078, 0x00060034, 0x00000006, 0x00000189, 0x00000084, 0x00000187, 0x00000188, 0x0004002b,
-    0x00000006, 0x0000018c, 0x00000004, 0x0004002b, 0x00000006, 0x00000190, 0x00010000, 0x00060034,
-    0x00000006, 0x00000197, 0x00000080, 0x00000186, 0x00000078, 0x0003001d, 0x0000019c, 0x00000006,
-    0x0003001e, 0x0000019d, 0x0000019c, 0x00040020, 0x0000019e, 0x0000000c, 0x0000019d, 0x0004003b,
-    0x0000019e, 0x0000019f, 0x0000000c, 0x0004002b, 0x0000000f, 0x000001a0, 0x00000000, 0x00040020,
-    0x000001a6, 0x0000000c, 0x00000006, 0x0004002b, 0x00000006, 0x000001ad, 0x00000017, 0x0004002b,
-    0x00000006, 0x000001af, 0x000001ff, 0x00040020, 0x000001b1, 0x00000007, 0x0000000f, 0x0004002b,
-    0x00000006, 0x000001b4, 0x00000100, 0x0004002b, 0x00000006, 0x000001bd, 0x00000200, 0x00060034,
-    0x00000006, 0x000001c0, 0x00000080, 0x00000186, 0x00000078, 0x00060034, 0x00000006, 0x000001c9,
-    0x00000080, 0x00000186, 0x00000078, 0x000a001e, 0x000001ce, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x0000000f, 0x00000006, 0x00040020, 0x000001cf, 0x00000009,
-    0x000001ce, 0x0004003b, 0x000001cf, 0x000001d0, 0x00000009, 0x0004002b, 0x0000000f, 0x000001d1,
-    0x00000001, 0x00040020, 0x000001d2, 0x00000009, 0x00000006, 0x0004002b, 0x00000006, 0x000001eb,
-    0x00060000, 0x0003001d, 0x000001ed, 0x00000006, 0x0003001e, 0x000001ee, 0x000001ed, 0x00040020,
-    0x000001ef, 0x0000000c, 0x000001ee, 0x0004003b, 0x000001ef, 0x000001f0, 0x0000000c, 0x0004002b,
-    0x00000006, 0x000001f8, 0x0000c000, 0x0004002b, 0x00000006, 0x00000200, 0x00018000, 0x0004002b,
-    0x00000006, 0x00000208, 0x00024000, 0x0004002b, 0x00000006, 0x00000210, 0x00000018, 0x0004002b,
-    0x00000006, 0x00000215, 0x00000040, 0x0004002b, 0x00000006, 0x0000021b, 0x80000000, 0x00060034,
-    0x00000006, 0x00000221, 0x00000080, 0x00000186, 0x00000078, 0x00060034, 0x00000006, 0x00000232,
-    0x00000080, 0x00000186, 0x00000078, 0x0004002b, 0x00000006, 0x0000024c, 0x0000000f, 0x0004002b,
-    0x00000006, 0x0000025b, 0x00000080, 0x0004002b, 0x00000006, 0x0000027a, 0x00000007, 0x00040017,
-    0x000002b2, 0x00000006, 0x00000003, 0x00040020, 0x000002b3, 0x00000001, 0x000002b2, 0x0004003b,
-    0x000002b3, 0x000002b4, 0x00000001, 0x0004002b, 0x0000000f, 0x000002c0, 0x00000002, 0x00040020,
-    0x000002c3, 0x00000001, 0x00000006, 0x00060034, 0x00000006, 0x000002cd, 0x00000080, 0x00000184,
-    0x00000078, 0x00060034, 0x00000006, 0x000002d4, 0x00000080, 0x00000186, 0x00000078, 0x0004002b,
-    0x00000006, 0x000002d8, 0x000000c0, 0x00060034, 0x00000006, 0x000002e0, 0x00000080, 0x00000186,
-    0x00000078, 0x00060034, 0x00000006, 0x000002e8, 0x00000080, 0x00000186, 0x00000078, 0x0004002b,
-    0x00000006, 0x000002f0, 0x000a8180, 0x0004002b, 0x00000006, 0x00000320, 0x000a8000, 0x0004002b,
-    0x00000006, 0x0000032a, 0x01000000, 0x0004002b, 0x00000006, 0x0000034f, 0x0009c000, 0x00060034,
-    0x00000006, 0x0000035d, 0x00000080, 0x00000186, 0x00000078, 0x0004002b, 0x00000006, 0x00000367,
-    0x00090000, 0x0004002b, 0x00000006, 0x0000036f, 0x0000001d, 0x00060034, 0x00000006, 0x000003f6,
-    0x00000080, 0x00000186, 0x00000078, 0x00060034, 0x00000006, 0x000003f7, 0x00000080, 0x00000186,
-    0x00000078, 0x00060034, 0x00000006, 0x000003f8, 0x00000084, 0x000003f6, 0x000003f7, 0x00060034,
-    0x00000006, 0x00000404, 0x00000080, 0x00000186, 0x00000078, 0x00060034, 0x00000006, 0x00000408,
-    0x00000080, 0x00000186, 0x00000078, 0x00040032, 0x0000000f, 0x00000414, 0x000000c0, 0x00040032,
-    0x0000000f, 0x00000415, 0x00003000, 0x0004002b, 0x0000000f, 0x00000416, 0x00000080, 0x0004002b,
-    0x0000000f, 0x00000417, 0x00000040, 0x00060034, 0x0000000f, 0x00000418, 0x00000084, 0x00000184,
-    0x00000414, 0x00060034, 0x0000000f, 0x00000419, 0x00000087, 0x00000184, 0x00000089, 0x00060034,
-    0x0000000f, 0x0000041a, 0x00000087, 0x00000414, 0x00000089, 0x0004002b, 0x0000000f, 0x0000041b,
-    0x00000800, 0x0004002b, 0x00000006, 0x0000041c, 0x00000022, 0x0004001c, 0x0000041d, 0x0000006f,
-    0x0000041c, 0x00040017, 0x0000041e, 0x00000065, 0x00000002, 0x000e001e, 0x0000041f, 0x00000006,
-    0x00000006, 0x0000000f, 0x00000006, 0x0000041d, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x0000041e, 0x00040020, 0x00000420, 0x00000002, 0x0000041f, 0x0004003b,
-    0x00000420, 0x00000421, 0x00000002, 0x0004002b, 0x0000000f, 0x00000422, 0x000000c0, 0x0004002b,
-    0x0000000f, 0x00000423, 0x0000c000, 0x0003001d, 0x00000424, 0x00000006, 0x0003001e, 0x00000425,
-    0x00000424, 0x00040020, 0x00000426, 0x0000000c, 0x00000425, 0x0004003b, 0x00000426, 0x00000427,
-    0x0000000c, 0x0004003b, 0x0000006a, 0x00000428, 0x00000000, 0x0004003b, 0x0000006a, 0x00000429,
-    0x00000000, 0x0004002b, 0x00000006, 0x0000042a, 0x00030000, 0x0006002c, 0x000002b2, 0x0000042b,
-    0x000000be, 0x000000be, 0x0000007d, 0x00050036, 0x00000002, 0x00000004, 0x00000000, 0x00000003,
-    0x000200f8, 0x00000005, 0x0004003b, 0x0000003d, 0x000002b1, 0x00000007, 0x0004003b, 0x00000049,
-    0x000002b7, 0x00000007, 0x0004003b, 0x00000007, 0x000002bb, 0x00000007, 0x0004003b, 0x00000007,
-    0x000002bd, 0x00000007, 0x0004003b, 0x00000007, 0x000002de, 0x00000007, 0x0004003b, 0x00000007,
-    0x000002e5, 0x00000007, 0x0004003b, 0x00000007, 0x000002ea, 0x00000007, 0x0004003b, 0x00000007,
-    0x000002ef, 0x00000007, 0x0004003b, 0x00000007, 0x000002f4, 0x00000007, 0x0004003b, 0x00000007,
-    0x000002f8, 0x00000007, 0x0004003b, 0x00000007, 0x000002fd, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000317, 0x00000007, 0x0004003b, 0x00000049, 0x0000031b, 0x00000007, 0x0004003b, 0x00000007,
-    0x0000031f, 0x00000007, 0x0004003b, 0x00000007, 0x00000328, 0x00000007, 0x0004003b, 0x00000007,
-    0x0000032d, 0x00000007, 0x0004003b, 0x00000007, 0x00000331, 0x00000007, 0x0004003b, 0x0000003d,
-    0x00000338, 0x00000007, 0x0004003b, 0x00000007, 0x00000339, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000343, 0x00000007, 0x0004003b, 0x0000003d, 0x00000345, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000346, 0x00000007, 0x0004003b, 0x00000007, 0x00000348, 0x00000007, 0x0004003b, 0x00000049,
-    0x0000034a, 0x00000007, 0x0004003b, 0x00000007, 0x0000034e, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000354, 0x00000007, 0x0004003b, 0x00000007, 0x00000358, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000362, 0x00000007, 0x0004003b, 0x0000003d, 0x00000364, 0x00000007, 0x0004003b, 0x00000007,
-    0x0000036d, 0x00000007, 0x0004003b, 0x00000007, 0x00000372, 0x00000007, 0x0004003b, 0x00000007,
-    0x0000037e, 0x00000007, 0x0004003b, 0x00000007, 0x00000382, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000387, 0x00000007, 0x0004003b, 0x00000007, 0x0000038c, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000391, 0x00000007, 0x0004003b, 0x00000007, 0x000003a5, 0x00000007, 0x0004003b, 0x00000007,
-    0x000003bb, 0x00000007, 0x0004003b, 0x00000007, 0x000003d1, 0x00000007, 0x0004003b, 0x00000007,
-    0x000003e6, 0x00000007, 0x0004003b, 0x00000007, 0x000003ee, 0x00000007, 0x0004003b, 0x00000007,
-    0x000003f1, 0x00000007, 0x0004003b, 0x00000007, 0x000003f5, 0x00000007, 0x0004003b, 0x00000007,
-    0x000003f9, 0x00000007, 0x0004003b, 0x00000007, 0x00000401, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000410, 0x00000007, 0x0004003d, 0x000002b2, 0x000002b5, 0x000002b4, 0x0007004f, 0x0000003c,
-    0x000002b6, 0x000002b5, 0x000002b5, 0x00000000, 0x00000001, 0x0003003e, 0x000002b1, 0x000002b6,
-    0x00050041, 0x000001d2, 0x000002b8, 0x000001d0, 0x000000f9, 0x0004003d, 0x00000006, 0x000002b9,
-    0x000002b8, 0x000500ab, 0x00000048, 0x000002ba, 0x000002b9, 0x00000078, 0x0003003e, 0x000002b7,
-    0x000002ba, 0x0004003d, 0x00000048, 0x000002bc, 0x000002b7, 0x000300f7, 0x000002bf, 0x00000000,
-    0x000400fa, 0x000002bc, 0x000002be, 0x000002c7, 0x000200f8, 0x000002be, 0x00050041, 0x000001d2,
-    0x000002c1, 0x000001d0, 0x000002c0, 0x0004003d, 0x00000006, 0x000002c2, 0x000002c1, 0x00050041,
-    0x000002c3, 0x000002c4, 0x000002b4, 0x00000085, 0x0004003d, 0x00000006, 0x000002c5, 0x000002c4,
-    0x00050080, 0x00000006, 0x000002c6, 0x000002c2, 0x000002c5, 0x0003003e, 0x000002bd, 0x000002c6,
-    0x000200f9, 0x000002bf, 0x000200f8, 0x000002c7, 0x00050041, 0x000001d2, 0x000002c8, 0x000001d0,
-    0x000002c0, 0x0004003d, 0x00000006, 0x000002c9, 0x000002c8, 0x0003003e, 0x000002bd, 0x000002c9,
-    0x000200f9, 0x000002bf, 0x000200f8, 0x000002bf, 0x0004003d, 0x00000006, 0x000002ca, 0x000002bd,
-    0x0003003e, 0x000002bb, 0x000002ca, 0x00050041, 0x00000007, 0x000002cb, 0x000002b1, 0x00000078,
-    0x0004003d, 0x00000006, 0x000002cc, 0x000002cb, 0x000500ae, 0x00000048, 0x000002ce, 0x000002cc,
-    0x000002cd, 0x000400a8, 0x00000048, 0x000002cf, 0x000002ce, 0x000300f7, 0x000002d1, 0x00000000,
-    0x000400fa, 0x000002cf, 0x000002d0, 0x000002d1, 0x000200f8, 0x000002d0, 0x00050041, 0x00000007,
-    0x000002d2, 0x000002b1, 0x0000007d, 0x0004003d, 0x00000006, 0x000002d3, 0x000002d2, 0x000500ae,
-    0x00000048, 0x000002d5, 0x000002d3, 0x000002d4, 0x000200f9, 0x000002d1, 0x000200f8, 0x000002d1,
-    0x000700f5, 0x00000048, 0x000002d6, 0x000002ce, 0x000002bf, 0x000002d5, 0x000002d0, 0x0004003d,
-    0x00000006, 0x000002d7, 0x000002bb, 0x000500ae, 0x00000048, 0x000002d9, 0x000002d7, 0x000002d8,
-    0x000500a6, 0x00000048, 0x000002da, 0x000002d6, 0x000002d9, 0x000300f7, 0x000002dc, 0x00000000,
-    0x000400fa, 0x000002da, 0x000002db, 0x000002dc, 0x000200f8, 0x000002db, 0x000100fd, 0x000200f8,
-    0x000002dc, 0x0004003d, 0x00000006, 0x000002df, 0x000002bb, 0x00050084, 0x00000006, 0x000002e1,
-    0x000002df, 0x000002e0, 0x00050041, 0x00000007, 0x000002e2, 0x000002b1, 0x0000007d, 0x0004003d,
-    0x00000006, 0x000002e3, 0x000002e2, 0x00050080, 0x00000006, 0x000002e4, 0x000002e1, 0x000002e3,
-    0x0003003e, 0x000002de, 0x000002e4, 0x00050041, 0x00000007, 0x000002e6, 0x000002b1, 0x00000078,
-    0x0004003d, 0x00000006, 0x000002e7, 0x000002e6, 0x00050086, 0x00000006, 0x000002e9, 0x000002e7,
-    0x000002e8, 0x0003003e, 0x000002e5, 0x000002e9, 0x0004003d, 0x00000006, 0x000002eb, 0x000002e5,
-    0x0004003d, 0x00000006, 0x000002ec, 0x000002bb, 0x00050084, 0x00000006, 0x000002ed, 0x000002ec,
-    0x000001b4, 0x00050080, 0x00000006, 0x000002ee, 0x000002eb, 0x000002ed, 0x0003003e, 0x000002ea,
-    0x000002ee, 0x0004003d, 0x00000006, 0x000002f1, 0x000002bb, 0x00050084, 0x00000006, 0x000002f2,
-    0x000002f1, 0x0000018c, 0x00050080, 0x00000006, 0x000002f3, 0x000002f0, 0x000002f2, 0x0003003e,
-    0x000002ef, 0x000002f3, 0x0004003d, 0x00000006, 0x000002f5, 0x000002ef, 0x00060041, 0x000001a6,
-    0x000002f6, 0x000001f0, 0x000001a0, 0x000002f5, 0x0004003d, 0x00000006, 0x000002f7, 0x000002f6,
-    0x0003003e, 0x000002f4, 0x000002f7, 0x0004003d, 0x00000006, 0x000002f9, 0x000002ef, 0x00050080,
-    0x00000006, 0x000002fa, 0x000002f9, 0x0000007d, 0x00060041, 0x000001a6, 0x000002fb, 0x000001f0,
-    0x000001a0, 0x000002fa, 0x0004003d, 0x00000006, 0x000002fc, 0x000002fb, 0x0003003e, 0x000002f8,
-    0x000002fc, 0x0004003d, 0x00000006, 0x000002fe, 0x000002ef, 0x00050080, 0x00000006, 0x000002ff,
-    0x000002fe, 0x0000008d, 0x00060041, 0x000001a6, 0x00000300, 0x000001f0, 0x000001a0, 0x000002ff,
-    0x0004003d, 0x00000006, 0x00000301, 0x00000300, 0x0003003e, 0x000002fd, 0x00000301, 0x0004003d,
-    0x00000006, 0x00000302, 0x000002f8, 0x000500c7, 0x00000006, 0x00000303, 0x00000302, 0x0000021b,
-    0x000500aa, 0x00000048, 0x00000304, 0x00000303, 0x00000078, 0x000400a8, 0x00000048, 0x00000305,
-    0x00000304, 0x000300f7, 0x00000307, 0x00000000, 0x000400fa, 0x00000305, 0x00000306, 0x00000307,
-    0x000200f8, 0x00000306, 0x0004003d, 0x00000048, 0x00000308, 0x000002b7, 0x000300f7, 0x0000030a,
-    0x00000000, 0x000400fa, 0x00000308, 0x00000309, 0x0000030a, 0x000200f8, 0x00000309, 0x0004003d,
-    0x00000006, 0x0000030b, 0x000002f8, 0x000500c7, 0x00000006, 0x0000030c, 0x0000030b, 0x000000e9,
-    0x000500aa, 0x00000048, 0x0000030d, 0x0000030c, 0x00000078, 0x000200f9, 0x0000030a, 0x000200f8,
-    0x0000030a, 0x000700f5, 0x00000048, 0x0000030e, 0x00000308, 0x00000306, 0x0000030d, 0x00000309,
-    0x000200f9, 0x00000307, 0x000200f8, 0x00000307, 0x000700f5, 0x00000048, 0x0000030f, 0x00000304,
-    0x000002dc, 0x0000030e, 0x0000030a, 0x0004003d, 0x00000006, 0x00000310, 0x000002e5, 0x0004003d,
-    0x00000006, 0x00000311, 0x000002fd, 0x000500ae, 0x00000048, 0x00000312, 0x00000310, 0x00000311,
-    0x000500a6, 0x00000048, 0x00000313, 0x0000030f, 0x00000312, 0x000300f7, 0x00000315, 0x00000000,
-    0x000400fa, 0x00000313, 0x00000314, 0x00000315, 0x000200f8, 0x00000314, 0x000100fd, 0x000200f8,
-    0x00000315, 0x0004003d, 0x00000006, 0x00000318, 0x000002f8, 0x000500c2, 0x00000006, 0x00000319,
-    0x00000318, 0x0000008d, 0x000500c7, 0x00000006, 0x0000031a, 0x00000319, 0x0000007d, 0x0003003e,
-    0x00000317, 0x0000031a, 0x0004003d, 0x00000006, 0x0000031c, 0x000002f8, 0x000500c7, 0x00000006,
-    0x0000031d, 0x0000031c, 0x000000f7, 0x000500ab, 0x00000048, 0x0000031e, 0x0000031d, 0x00000078,
-    0x0003003e, 0x0000031b, 0x0000031e, 0x0004003d, 0x00000006, 0x00000321, 0x00000317, 0x00050084,
-    0x00000006, 0x00000322, 0x00000321, 0x000002d8, 0x00050080, 0x00000006, 0x00000323, 0x00000320,
-    0x00000322, 0x0004003d, 0x00000006, 0x00000324, 0x000002bb, 0x00050080, 0x00000006, 0x00000325,
-    0x00000323, 0x00000324, 0x00060041, 0x000001a6, 0x00000326, 0x000001f0, 0x000001a0, 0x00000325,
-    0x0004003d, 0x00000006, 0x00000327, 0x00000326, 0x0003003e, 0x0000031f, 0x00000327, 0x0004003d,
-    0x00000006, 0x00000329, 0x000002f4, 0x000500c7, 0x00000006, 0x0000032b, 0x00000329, 0x0000032a,
-    0x000500ab, 0x00000048, 0x0000032c, 0x0000032b, 0x00000078, 0x000300f7, 0x0000032f, 0x00000000,
-    0x000400fa, 0x0000032c, 0x0000032e, 0x0000033e, 0x000200f8, 0x0000032e, 0x0004003d, 0x00000048,
-    0x00000330, 0x0000031b, 0x000300f7, 0x00000333, 0x00000000, 0x000400fa, 0x00000330, 0x00000332,
-    0x0000033c, 0x000200f8, 0x00000332, 0x00050041, 0x00000007, 0x00000334, 0x000002b1, 0x00000078,
-    0x0004003d, 0x00000006, 0x00000335, 0x00000334, 0x0004003d, 0x00000006, 0x00000336, 0x000002de,
-    0x00050050, 0x0000003c, 0x00000337, 0x00000335, 0x00000336, 0x0003003e, 0x00000338, 0x00000337,
-    0x0004003d, 0x00000006, 0x0000033a, 0x0000031f, 0x0003003e, 0x00000339, 0x0000033a, 0x00060039,
-    0x00000006, 0x0000033b, 0x00000046, 0x00000338, 0x00000339, 0x0003003e, 0x00000331, 0x0000033b,
-    0x000200f9, 0x00000333, 0x000200f8, 0x0000033c, 0x0003003e, 0x00000331, 0x00000078, 0x000200f9,
-    0x00000333, 0x000200f8, 0x00000333, 0x0004003d, 0x00000006, 0x0000033d, 0x00000331, 0x0003003e,
-    0x0000032d, 0x0000033d, 0x000200f9, 0x0000032f, 0x000200f8, 0x0000033e, 0x00050041, 0x00000007,
-    0x0000033f, 0x000002b1, 0x00000078, 0x0004003d, 0x00000006, 0x00000340, 0x0000033f, 0x0004003d,
-    0x00000006, 0x00000341, 0x000002de, 0x00050050, 0x0000003c, 0x00000342, 0x00000340, 0x00000341,
-    0x0004003d, 0x00000006, 0x00000344, 0x00000317, 0x0003003e, 0x00000343, 0x00000344, 0x0003003e,
-    0x00000345, 0x00000342, 0x0004003d, 0x00000006, 0x00000347, 0x000002ea, 0x0003003e, 0x00000346,
-    0x00000347, 0x0004003d, 0x00000006, 0x00000349, 0x0000031f, 0x0003003e, 0x00000348, 0x00000349,
-    0x0004003d, 0x00000048, 0x0000034b, 0x0000031b, 0x0003003e, 0x0000034a, 0x0000034b, 0x00090039,
-    0x00000006, 0x0000034c, 0x00000050, 0x00000343, 0x00000345, 0x00000346, 0x00000348, 0x0000034a,
-    0x0003003e, 0x0000032d, 0x0000034c, 0x000200f9, 0x0000032f, 0x000200f8, 0x0000032f, 0x0004003d,
-    0x00000006, 0x0000034d, 0x0000032d, 0x0003003e, 0x00000328, 0x0000034d, 0x0004003d, 0x00000006,
-    0x00000350, 0x000002ea, 0x00050080, 0x00000006, 0x00000351, 0x0000034f, 0x00000350, 0x00060041,
-    0x000001a6, 0x00000352, 0x000001f0, 0x000001a0, 0x00000351, 0x0004003d, 0x00000006, 0x00000353,
-    0x00000352, 0x0003003e, 0x0000034e, 0x00000353, 0x0004003d, 0x00000006, 0x00000355, 0x0000034e,
-    0x000500c7, 0x00000006, 0x00000356, 0x00000355, 0x0000021b, 0x000500ab, 0x00000048, 0x00000357,
-    0x00000356, 0x00000078, 0x000300f7, 0x0000035a, 0x00000000, 0x000400fa, 0x00000357, 0x00000359,
-    0x00000366, 0x000200f8, 0x00000359, 0x00050041, 0x00000007, 0x0000035b, 0x000002b1, 0x00000078,
-    0x0004003d, 0x00000006, 0x0000035c, 0x0000035b, 0x00050089, 0x00000006, 0x0000035e, 0x0000035c,
-    0x0000035d, 0x00050041, 0x00000007, 0x0000035f, 0x000002b1, 0x0000007d, 0x0004003d, 0x00000006,
-    0x00000360, 0x0000035f, 0x00050050, 0x0000003c, 0x00000361, 0x0000035e, 0x00000360, 0x0004003d,
-    0x00000006, 0x00000363, 0x0000034e, 0x0003003e, 0x00000362, 0x00000363, 0x0003003e, 0x00000364,
-    0x00000361, 0x00060039, 0x00000006, 0x00000365, 0x00000041, 0x00000362, 0x00000364, 0x0003003e,
-    0x00000358, 0x00000365, 0x000200f9, 0x0000035a, 0x000200f8, 0x00000366, 0x0004003d, 0x00000006,
-    0x00000368, 0x000002ea, 0x00050080, 0x00000006, 0x00000369, 0x00000367, 0x00000368, 0x00060041,
-    0x000001a6, 0x0000036a, 0x000001f0, 0x000001a0, 0x00000369, 0x0004003d, 0x00000006, 0x0000036b,
-    0x0000036a, 0x0003003e, 0x00000358, 0x0000036b, 0x000200f9, 0x0000035a, 0x000200f8, 0x0000035a,
-    0x0004003d, 0x00000006, 0x0000036c, 0x00000358, 0x0003003e, 0x00000354, 0x0000036c, 0x0004003d,
-    0x00000006, 0x0000036e, 0x000002f4, 0x000500c2, 0x00000006, 0x00000370, 0x0000036e, 0x0000036f,
-    0x000500c7, 0x00000006, 0x00000371, 0x00000370, 0x0000008d, 0x0003003e, 0x0000036d, 0x00000371,
-    0x0004003d, 0x00000006, 0x00000373, 0x00000328, 0x0003003e, 0x00000372, 0x00000373, 0x0004003d,
-    0x00000006, 0x00000374, 0x0000036d, 0x000500aa, 0x00000048, 0x00000375, 0x00000374, 0x0000007d,
-    0x000300f7, 0x00000377, 0x00000000, 0x000400fa, 0x00000375, 0x00000376, 0x00000379, 0x000200f8,
-    0x00000376, 0x0004003d, 0x00000006, 0x00000378, 0x00000354, 0x0003003e, 0x00000372, 0x00000378,
-    0x000200f9, 0x00000377, 0x000200f8, 0x00000379, 0x0004003d, 0x00000006, 0x0000037a, 0x0000036d,
-    0x000500ae, 0x00000048, 0x0000037b, 0x0000037a, 0x00000085, 0x000300f7, 0x0000037d, 0x00000000,
-    0x000400fa, 0x0000037b, 0x0000037c, 0x0000037d, 0x000200f8, 0x0000037c, 0x0004003d, 0x00000006,
-    0x0000037f, 0x000002f4, 0x000500c7, 0x00000006, 0x00000380, 0x0000037f, 0x0000005f, 0x0007000c,
-    0x00000006, 0x00000381, 0x00000001, 0x00000026, 0x00000380, 0x000000f7, 0x0003003e, 0x0000037e,
-    0x00000381, 0x0004003d, 0x00000006, 0x00000383, 0x000002f4, 0x000500c2, 0x00000006, 0x00000384,
-    0x00000383, 0x000000be, 0x000500c7, 0x00000006, 0x00000385, 0x00000384, 0x0000005f, 0x0007000c,
-    0x00000006, 0x00000386, 0x00000001, 0x00000026, 0x00000385, 0x000000f7, 0x0003003e, 0x00000382,
-    0x00000386, 0x0004003d, 0x00000006, 0x00000388, 0x00000328, 0x000500c2, 0x00000006, 0x00000389,
-    0x00000388, 0x00000210, 0x000500ab, 0x00000048, 0x0000038a, 0x00000389, 0x00000078, 0x000600a9,
-    0x00000006, 0x0000038b, 0x0000038a, 0x0000007d, 0x00000078, 0x0003003e, 0x00000387, 0x0000038b,
-    0x0004003d, 0x00000006, 0x0000038d, 0x00000354, 0x000500c2, 0x00000006, 0x0000038e, 0x0000038d,
-    0x00000210, 0x000500ab, 0x00000048, 0x0000038f, 0x0000038e, 0x00000078, 0x000600a9, 0x00000006,
-    0x00000390, 0x0000038f, 0x0000007d, 0x00000078, 0x0003003e, 0x0000038c, 0x00000390, 0x0004003d,
-    0x00000006, 0x00000392, 0x00000328, 0x000500c7, 0x00000006, 0x00000393, 0x00000392, 0x00000056,
-    0x000500c2, 0x00000006, 0x00000394, 0x00000393, 0x0000007d, 0x0004003d, 0x00000006, 0x00000395,
-    0x00000387, 0x00050084, 0x00000006, 0x00000396, 0x00000394, 0x00000395, 0x0004003d, 0x00000006,
-    0x00000397, 0x0000037e, 0x00050084, 0x00000006, 0x00000398, 0x00000396, 0x00000397, 0x0004003d,
-    0x00000006, 0x00000399, 0x00000354, 0x000500c7, 0x00000006, 0x0000039a, 0x00000399, 0x00000056,
-    0x000500c2, 0x00000006, 0x0000039b, 0x0000039a, 0x0000007d, 0x0004003d, 0x00000006, 0x0000039c,
-    0x0000038c, 0x00050084, 0x00000006, 0x0000039d, 0x0000039b, 0x0000039c, 0x0004003d, 0x00000006,
-    0x0000039e, 0x00000382, 0x00050084, 0x00000006, 0x0000039f, 0x0000039d, 0x0000039e, 0x00050080,
-    0x00000006, 0x000003a0, 0x00000398, 0x0000039f, 0x00050080, 0x00000006, 0x000003a1, 0x000003a0,
-    0x000000be, 0x000500c2, 0x00000006, 0x000003a2, 0x000003a1, 0x0000018c, 0x0007000c, 0x00000006,
-    0x000003a3, 0x00000001, 0x00000026, 0x000003a2, 0x0000005f, 0x000500c4, 0x00000006, 0x000003a4,
-    0x000003a3, 0x0000007d, 0x0003003e, 0x00000391, 0x000003a4, 0x0004003d, 0x00000006, 0x000003a6,
-    0x00000328, 0x000500c2, 0x00000006, 0x000003a7, 0x000003a6, 0x000000be, 0x000500c7, 0x00000006,
-    0x000003a8, 0x000003a7, 0x00000056, 0x000500c2, 0x00000006, 0x000003a9, 0x000003a8, 0x0000007d,
-    0x0004003d, 0x00000006, 0x000003aa, 0x00000387, 0x00050084, 0x00000006, 0x000003ab, 0x000003a9,
-    0x000003aa, 0x0004003d, 0x00000006, 0x000003ac, 0x0000037e, 0x00050084, 0x00000006, 0x000003ad,
-    0x000003ab, 0x000003ac, 0x0004003d, 0x00000006, 0x000003ae, 0x00000354, 0x000500c2, 0x00000006,
-    0x000003af, 0x000003ae, 0x000000be, 0x000500c7, 0x00000006, 0x000003b0, 0x000003af, 0x00000056,
-    0x000500c2, 0x00000006, 0x000003b1, 0x000003b0, 0x0000007d, 0x0004003d, 0x00000006, 0x000003b2,
-    0x0000038c, 0x00050084, 0x00000006, 0x000003b3, 0x000003b1, 0x000003b2, 0x0004003d, 0x00000006,
-    0x000003b4, 0x00000382, 0x00050084, 0x00000006, 0x000003b5, 0x000003b3, 0x000003b4, 0x00050080,
-    0x00000006, 0x000003b6, 0x000003ad, 0x000003b5, 0x00050080, 0x00000006, 0x000003b7, 0x000003b6,
-    0x000000be, 0x000500c2, 0x00000006, 0x000003b8, 0x000003b7, 0x0000018c, 0x0007000c, 0x00000006,
-    0x000003b9, 0x00000001, 0x00000026, 0x000003b8, 0x0000005f, 0x000500c4, 0x00000006, 0x000003ba,
-    0x000003b9, 0x0000007d, 0x0003003e, 0x000003a5, 0x000003ba, 0x0004003d, 0x00000006, 0x000003bc,
-    0x00000328, 0x000500c2, 0x00000006, 0x000003bd, 0x000003bc, 0x000000f7, 0x000500c7, 0x00000006,
-    0x000003be, 0x000003bd, 0x00000056, 0x000500c2, 0x00000006, 0x000003bf, 0x000003be, 0x0000007d,
-    0x0004003d, 0x00000006, 0x000003c0, 0x00000387, 0x00050084, 0x00000006, 0x000003c1, 0x000003bf,
-    0x000003c0, 0x0004003d, 0x00000006, 0x000003c2, 0x0000037e, 0x00050084, 0x00000006, 0x000003c3,
-    0x000003c1, 0x000003c2, 0x0004003d, 0x00000006, 0x000003c4, 0x00000354, 0x000500c2, 0x00000006,
-    0x000003c5, 0x000003c4, 0x000000f7, 0x000500c7, 0x00000006, 0x000003c6, 0x000003c5, 0x00000056,
-    0x000500c2, 0x00000006, 0x000003c7, 0x000003c6, 0x0000007d, 0x0004003d, 0x00000006, 0x000003c8,
-    0x0000038c, 0x00050084, 0x00000006, 0x000003c9, 0x000003c7, 0x000003c8, 0x0004003d, 0x00000006,
-    0x000003ca, 0x00000382, 0x00050084, 0x00000006, 0x000003cb, 0x000003c9, 0x000003ca, 0x00050080,
-    0x00000006, 0x000003cc, 0x000003c3, 0x000003cb, 0x00050080, 0x00000006, 0x000003cd, 0x000003cc,
-    0x000000be, 0x000500c2, 0x00000006, 0x000003ce, 0x000003cd, 0x0000018c, 0x0007000c, 0x00000006,
-    0x000003cf, 0x00000001, 0x00000026, 0x000003ce, 0x0000005f, 0x000500c4, 0x00000006, 0x000003d0,
-    0x000003cf, 0x0000007d, 0x0003003e, 0x000003bb, 0x000003d0, 0x0004003d, 0x00000006, 0x000003d2,
-    0x0000037e, 0x000500ab, 0x00000048, 0x000003d3, 0x000003d2, 0x00000078, 0x0004003d, 0x00000006,
-    0x000003d4, 0x00000387, 0x000600a9, 0x00000006, 0x000003d5, 0x000003d3, 0x000003d4, 0x00000078,
-    0x0004003d, 0x00000006, 0x000003d6, 0x00000382, 0x000500ab, 0x00000048, 0x000003d7, 0x000003d6,
-    0x00000078, 0x0004003d, 0x00000006, 0x000003d8, 0x0000038c, 0x000600a9, 0x00000006, 0x000003d9,
-    0x000003d7, 0x000003d8, 0x00000078, 0x000500c5, 0x00000006, 0x000003da, 0x000003d5, 0x000003d9,
-    0x00050084, 0x00000006, 0x000003db, 0x000003da, 0x0000005a, 0x0003003e, 0x000003d1, 0x000003db,
-    0x0004003d, 0x00000006, 0x000003dc, 0x00000391, 0x0004003d, 0x00000006, 0x000003dd, 0x000003a5,
-    0x000500c4, 0x00000006, 0x000003de, 0x000003dd, 0x000000be, 0x000500c5, 0x00000006, 0x000003df,
-    0x000003dc, 0x000003de, 0x0004003d, 0x00000006, 0x000003e0, 0x000003bb, 0x000500c4, 0x00000006,
-    0x000003e1, 0x000003e0, 0x000000f7, 0x000500c5, 0x00000006, 0x000003e2, 0x000003df, 0x000003e1,
-    0x0004003d, 0x00000006, 0x000003e3, 0x000003d1, 0x000500c4, 0x00000006, 0x000003e4, 0x000003e3,
-    0x00000210, 0x000500c5, 0x00000006, 0x000003e5, 0x000003e2, 0x000003e4, 0x0003003e, 0x00000372,
-    0x000003e5, 0x000200f9, 0x0000037d, 0x000200f8, 0x0000037d, 0x000200f9, 0x00000377, 0x000200f8,
-    0x00000377, 0x0004003d, 0x00000006, 0x000003e7, 0x000002ef, 0x00050080, 0x00000006, 0x000003e8,
-    0x000003e7, 0x00000085, 0x00060041, 0x000001a6, 0x000003e9, 0x000001f0, 0x000001a0, 0x000003e8,
-    0x0004003d, 0x00000006, 0x000003ea, 0x000003e9, 0x0004003d, 0x00000006, 0x000003eb, 0x000002e5,
-    0x00050080, 0x00000006, 0x000003ec, 0x000003ea, 0x000003eb, 0x000500c7, 0x00000006, 0x000003ed,
-    0x000003ec, 0x00000177, 0x0003003e, 0x000003e6, 0x000003ed, 0x0004003d, 0x00000006, 0x000003ef,
-    0x000002f8, 0x000500c7, 0x00000006, 0x000003f0, 0x000003ef, 0x0000008d, 0x0003003e, 0x000003ee,
-    0x000003f0, 0x0004003d, 0x00000006, 0x000003f2, 0x000002f8, 0x000500c2, 0x00000006, 0x000003f3,
-    0x000003f2, 0x00000085, 0x000500c7, 0x00000006, 0x000003f4, 0x000003f3, 0x0000007d, 0x0003003e,
-    0x000003f1, 0x000003f4, 0x0003003e, 0x000003f5, 0x000003f8, 0x0004003d, 0x00000006, 0x000003fa,
-    0x000003f1, 0x00050084, 0x00000006, 0x000003fb, 0x000003fa, 0x0000018c, 0x0004003d, 0x00000006,
-    0x000003fc, 0x000003ee, 0x00050080, 0x00000006, 0x000003fd, 0x000003fb, 0x000003fc, 0x00050084,
-    0x00000006, 0x000003fe, 0x000003fd, 0x00000190, 0x0004003d, 0x00000006, 0x000003ff, 0x000003e6,
-    0x00050080, 0x00000006, 0x00000400, 0x000003fe, 0x000003ff, 0x0003003e, 0x000003f9, 0x00000400,
-    0x00050041, 0x00000007, 0x00000402, 0x000002b1, 0x0000007d, 0x0004003d, 0x00000006, 0x00000403,
-    0x00000402, 0x00050084, 0x00000006, 0x00000405, 0x00000403, 0x00000404, 0x00050041, 0x00000007,
-    0x00000406, 0x000002b1, 0x00000078, 0x0004003d, 0x00000006, 0x00000407, 0x00000406, 0x00050089,
-    0x00000006, 0x00000409, 0x00000407, 0x00000408, 0x00050080, 0x00000006, 0x0000040a, 0x00000405,
-    0x00000409, 0x0003003e, 0x00000401, 0x0000040a, 0x0004003d, 0x00000006, 0x0000040b, 0x000003f9,
-    0x0004003d, 0x00000006, 0x0000040c, 0x000003f5, 0x00050084, 0x00000006, 0x0000040d, 0x0000040b,
-    0x0000040c, 0x0004003d, 0x00000006, 0x0000040e, 0x00000401, 0x00050080, 0x00000006, 0x0000040f,
-    0x0000040d, 0x0000040e, 0x0004003d, 0x00000006, 0x00000411, 0x00000372, 0x0003003e, 0x00000410,
-    0x00000411, 0x00050039, 0x00000006, 0x00000412, 0x00000053, 0x00000410, 0x00060041, 0x000001a6,
-    0x00000413, 0x0000019f, 0x000001a0, 0x0000040f, 0x0003003e, 0x00000413, 0x00000412, 0x000100fd,
-    0x00010038, 0x00050036, 0x00000006, 0x0000000a, 0x00000000, 0x00000008, 0x00030037, 0x00000007,
-    0x00000009, 0x000200f8, 0x0000000b, 0x0004003d, 0x00000006, 0x00000055, 0x00000009, 0x00050084,
-    0x00000006, 0x00000057, 0x00000055, 0x00000056, 0x00050080, 0x00000006, 0x00000059, 0x00000057,
-    0x00000058, 0x00050086, 0x00000006, 0x0000005b, 0x00000059, 0x0000005a, 0x000200fe, 0x0000005b,
-    0x00010038, 0x00050036, 0x00000006, 0x0000000d, 0x00000000, 0x00000008, 0x00030037, 0x00000007,
-    0x0000000c, 0x000200f8, 0x0000000e, 0x0004003d, 0x00000006, 0x0000005e, 0x0000000c, 0x00050084,
-    0x00000006, 0x00000060, 0x0000005e, 0x0000005f, 0x00050080, 0x00000006, 0x00000061, 0x00000060,
-    0x00000058, 0x00050086, 0x00000006, 0x00000062, 0x00000061, 0x0000005a, 0x000200fe, 0x00000062,
-    0x00010038, 0x00050036, 0x00000006, 0x00000014, 0x00000000, 0x00000012, 0x00030037, 0x00000011,
-    0x00000013, 0x000200f8, 0x00000015, 0x0004003b, 0x00000067, 0x00000068, 0x00000007, 0x0004003b,
-    0x00000070, 0x00000071, 0x00000007, 0x0004003b, 0x00000007, 0x00000077, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000007c, 0x00000007, 0x0004003b, 0x00000007, 0x00000084, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000008c, 0x00000007, 0x0004003d, 0x00000069, 0x0000006c, 0x0000006b, 0x0004003d,
-    0x00000010, 0x0000006d, 0x00000013, 0x00050062, 0x00000066, 0x0000006e, 0x0000006c, 0x0000006d,
-    0x0003003e, 0x00000068, 0x0000006e, 0x0004003d, 0x00000066, 0x00000072, 0x00000068, 0x0005008e,
-    0x00000066, 0x00000074, 0x00000072, 0x00000073, 0x0006000c, 0x00000066, 0x00000075, 0x00000001,
-    0x00000001, 0x00000074, 0x0004006d, 0x0000006f, 0x00000076, 0x00000075, 0x0003003e, 0x00000071,
-    0x00000076, 0x00050041, 0x00000007, 0x00000079, 0x00000071, 0x00000078, 0x0004003d, 0x00000006,
-    0x0000007a, 0x00000079, 0x0003003e, 0x00000077, 0x0000007a, 0x00050039, 0x00000006, 0x0000007b,
-    0x0000000a, 0x00000077, 0x00050041, 0x00000007, 0x0000007e, 0x00000071, 0x0000007d, 0x0004003d,
-    0x00000006, 0x0000007f, 0x0000007e, 0x0003003e, 0x0000007c, 0x0000007f, 0x00050039, 0x00000006,
-    0x00000080, 0x0000000a, 0x0000007c, 0x000500c4, 0x00000006, 0x00000082, 0x00000080, 0x00000081,
-    0x000500c5, 0x00000006, 0x00000083, 0x0000007b, 0x00000082, 0x00050041, 0x00000007, 0x00000086,
-    0x00000071, 0x00000085, 0x0004003d, 0x00000006, 0x00000087, 0x00000086, 0x0003003e, 0x00000084,
-    0x00000087, 0x00050039, 0x00000006, 0x00000088, 0x0000000a, 0x00000084, 0x000500c4, 0x00000006,
-    0x0000008a, 0x00000088, 0x00000089, 0x000500c5, 0x00000006, 0x0000008b, 0x00000083, 0x0000008a,
-    0x00050041, 0x00000007, 0x0000008e, 0x00000071, 0x0000008d, 0x0004003d, 0x00000006, 0x0000008f,
-    0x0000008e, 0x0003003e, 0x0000008c, 0x0000008f, 0x00050039, 0x00000006, 0x00000090, 0x0000000d,
-    0x0000008c, 0x000500c4, 0x00000006, 0x00000092, 0x00000090, 0x00000091, 0x000500c5, 0x00000006,
-    0x00000093, 0x0000008b, 0x00000092, 0x000200fe, 0x00000093, 0x00010038, 0x00050036, 0x00000006,
-    0x00000017, 0x00000000, 0x00000008, 0x00030037, 0x00000007, 0x00000016, 0x000200f8, 0x00000018,
-    0x0004003d, 0x00000006, 0x00000096, 0x00000016, 0x000500c7, 0x00000006, 0x00000097, 0x00000096,
-    0x00000056, 0x000200fe, 0x00000097, 0x00010038, 0x00050036, 0x00000006, 0x0000001a, 0x00000000,
-    0x00000008, 0x00030037, 0x00000007, 0x00000019, 0x000200f8, 0x0000001b, 0x0004003d, 0x00000006,
-    0x0000009a, 0x00000019, 0x000500c2, 0x00000006, 0x0000009b, 0x0000009a, 0x00000081, 0x000500c7,
-    0x00000006, 0x0000009c, 0x0000009b, 0x00000056, 0x000200fe, 0x0000009c, 0x00010038, 0x00050036,
-    0x00000006, 0x0000001d, 0x00000000, 0x00000008, 0x00030037, 0x00000007, 0x0000001c, 0x000200f8,
-    0x0000001e, 0x0004003d, 0x00000006, 0x0000009f, 0x0000001c, 0x000500c2, 0x00000006, 0x000000a0,
-    0x0000009f, 0x00000089, 0x000500c7, 0x00000006, 0x000000a1, 0x000000a0, 0x00000056, 0x000200fe,
-    0x000000a1, 0x00010038, 0x00050036, 0x00000006, 0x00000024, 0x00000000, 0x0000001f, 0x00030037,
-    0x00000007, 0x00000020, 0x00030037, 0x00000007, 0x00000021, 0x00030037, 0x00000007, 0x00000022,
-    0x00030037, 0x00000007, 0x00000023, 0x000200f8, 0x00000025, 0x0004003d, 0x00000006, 0x000000a4,
-    0x00000020, 0x0007000c, 0x00000006, 0x000000a5, 0x00000001, 0x00000026, 0x000000a4, 0x00000056,
-    0x0004003d, 0x00000006, 0x000000a6, 0x00000021, 0x0007000c, 0x00000006, 0x000000a7, 0x00000001,
-    0x00000026, 0x000000a6, 0x00000056, 0x000500c4, 0x00000006, 0x000000a8, 0x000000a7, 0x00000081,
-    0x000500c5, 0x00000006, 0x000000a9, 0x000000a5, 0x000000a8, 0x0004003d, 0x00000006, 0x000000aa,
-    0x00000022, 0x0007000c, 0x00000006, 0x000000ab, 0x00000001, 0x00000026, 0x000000aa, 0x00000056,
-    0x000500c4, 0x00000006, 0x000000ac, 0x000000ab, 0x00000089, 0x000500c5, 0x00000006, 0x000000ad,
-    0x000000a9, 0x000000ac, 0x0004003d, 0x00000006, 0x000000ae, 0x00000023, 0x000500c4, 0x00000006,
-    0x000000af, 0x000000ae, 0x00000091, 0x000500c5, 0x00000006, 0x000000b0, 0x000000ad, 0x000000af,
-    0x000200fe, 0x000000b0, 0x00010038, 0x00050036, 0x00000006, 0x0000002a, 0x00000000, 0x0000001f,
-    0x00030037, 0x00000007, 0x00000026, 0x00030037, 0x00000007, 0x00000027, 0x00030037, 0x00000007,
-    0x00000028, 0x00030037, 0x00000007, 0x00000029, 0x000200f8, 0x0000002b, 0x0004003b, 0x00000007,
-    0x000000b3, 0x00000007, 0x0004003b, 0x00000007, 0x000000b8, 0x00000007, 0x0004003b, 0x00000007,
-    0x000000c2, 0x00000007, 0x0004003b, 0x00000007, 0x000000c7, 0x00000007, 0x0004003b, 0x00000007,
-    0x000000cf, 0x00000007, 0x0004003b, 0x00000007, 0x000000d4, 0x00000007, 0x0004003b, 0x00000007,
-    0x000000dc, 0x00000007, 0x0004003b, 0x00000007, 0x000000dd, 0x00000007, 0x0004003b, 0x00000007,
-    0x000000de, 0x00000007, 0x0004003b, 0x00000007, 0x000000df, 0x00000007, 0x0004003d, 0x00000006,
-    0x000000b4, 0x00000026, 0x0003003e, 0x000000b3, 0x000000b4, 0x00050039, 0x00000006, 0x000000b5,
-    0x00000017, 0x000000b3, 0x0004003d, 0x00000006, 0x000000b6, 0x00000028, 0x00050084, 0x00000006,
-    0x000000b7, 0x000000b5, 0x000000b6, 0x0004003d, 0x00000006, 0x000000b9, 0x00000027, 0x0003003e,
-    0x000000b8, 0x000000b9, 0x00050039, 0x00000006, 0x000000ba, 0x00000017, 0x000000b8, 0x0004003d,
-    0x00000006, 0x000000bb, 0x00000029, 0x00050084, 0x00000006, 0x000000bc, 0x000000ba, 0x000000bb,
-    0x00050080, 0x00000006, 0x000000bd, 0x000000b7, 0x000000bc, 0x00050080, 0x00000006, 0x000000bf,
-    0x000000bd, 0x000000be, 0x000500c2, 0x00000006, 0x000000c1, 0x000000bf, 0x000000c0, 0x0004003d,
-    0x00000006, 0x000000c3, 0x00000026, 0x0003003e, 0x000000c2, 0x000000c3, 0x00050039, 0x00000006,
-    0x000000c4, 0x0000001a, 0x000000c2, 0x0004003d, 0x00000006, 0x000000c5, 0x00000028, 0x00050084,
-    0x00000006, 0x000000c6, 0x000000c4, 0x000000c5, 0x0004003d, 0x00000006, 0x000000c8, 0x00000027,
-    0x0003003e, 0x000000c7, 0x000000c8, 0x00050039, 0x00000006, 0x000000c9, 0x0000001a, 0x000000c7,
-    0x0004003d, 0x00000006, 0x000000ca, 0x00000029, 0x00050084, 0x00000006, 0x000000cb, 0x000000c9,
-    0x000000ca, 0x00050080, 0x00000006, 0x000000cc, 0x000000c6, 0x000000cb, 0x00050080, 0x00000006,
-    0x000000cd, 0x000000cc, 0x000000be, 0x000500c2, 0x00000006, 0x000000ce, 0x000000cd, 0x000000c0,
-    0x0004003d, 0x00000006, 0x000000d0, 0x00000026, 0x0003003e, 0x000000cf, 0x000000d0, 0x00050039,
-    0x00000006, 0x000000d1, 0x0000001d, 0x000000cf, 0x0004003d, 0x00000006, 0x000000d2, 0x00000028,
-    0x00050084, 0x00000006, 0x000000d3, 0x000000d1, 0x000000d2, 0x0004003d, 0x00000006, 0x000000d5,
-    0x00000027, 0x0003003e, 0x000000d4, 0x000000d5, 0x00050039, 0x00000006, 0x000000d6, 0x0000001d,
-    0x000000d4, 0x0004003d, 0x00000006, 0x000000d7, 0x00000029, 0x00050084, 0x00000006, 0x000000d8,
-    0x000000d6, 0x000000d7, 0x00050080, 0x00000006, 0x000000d9, 0x000000d3, 0x000000d8, 0x00050080,
-    0x00000006, 0x000000da, 0x000000d9, 0x000000be, 0x000500c2, 0x00000006, 0x000000db, 0x000000da,
-    0x000000c0, 0x0003003e, 0x000000dc, 0x000000c1, 0x0003003e, 0x000000dd, 0x000000ce, 0x0003003e,
-    0x000000de, 0x000000db, 0x0003003e, 0x000000df, 0x0000005a, 0x00080039, 0x00000006, 0x000000e0,
-    0x00000024, 0x000000dc, 0x000000dd, 0x000000de, 0x000000df, 0x000200fe, 0x000000e0, 0x00010038,
-    0x00050036, 0x00000006, 0x0000002f, 0x00000000, 0x0000002c, 0x00030037, 0x00000007, 0x0000002d,
-    0x00030037, 0x00000007, 0x0000002e, 0x000200f8, 0x00000030, 0x0004003b, 0x00000007, 0x000000e3,
-    0x00000007, 0x0004003b, 0x00000007, 0x000000e8, 0x00000007, 0x0004003b, 0x00000007, 0x000000ec,
-    0x00000007, 0x0004003b, 0x00000007, 0x000000f1, 0x00000007, 0x0004003b, 0x00000007, 0x000000fb,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000100, 0x00000007, 0x0004003b, 0x00000007, 0x00000108,
-    0x00000007, 0x0004003b, 0x00000007, 0x0000010d, 0x00000007, 0x0004003b, 0x00000007, 0x00000115,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000116, 0x00000007, 0x0004003b, 0x00000007, 0x00000117,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000118, 0x00000007, 0x0004003d, 0x00000006, 0x000000e4,
-    0x0000002d, 0x000500c2, 0x00000006, 0x000000e5, 0x000000e4, 0x00000091, 0x000500c7, 0x00000006,
-    0x000000e6, 0x000000e5, 0x0000005f, 0x00050080, 0x00000006, 0x000000e7, 0x000000e6, 0x0000007d,
-    0x0003003e, 0x000000e3, 0x000000e7, 0x0004003d, 0x00000006, 0x000000ea, 0x000000e3, 0x00050082,
-    0x00000006, 0x000000eb, 0x000000e9, 0x000000ea, 0x0003003e, 0x000000e8, 0x000000eb, 0x0004003d,
-    0x00000006, 0x000000ed, 0x0000002d, 0x0003003e, 0x000000ec, 0x000000ed, 0x00050039, 0x00000006,
-    0x000000ee, 0x00000017, 0x000000ec, 0x0004003d, 0x00000006, 0x000000ef, 0x000000e3, 0x00050084,
-    0x00000006, 0x000000f0, 0x000000ee, 0x000000ef, 0x0004003d, 0x00000006, 0x000000f2, 0x0000002e,
-    0x0003003e, 0x000000f1, 0x000000f2, 0x00050039, 0x00000006, 0x000000f3, 0x00000017, 0x000000f1,
-    0x0004003d, 0x00000006, 0x000000f4, 0x000000e8, 0x00050084, 0x00000006, 0x000000f5, 0x000000f3,
-    0x000000f4, 0x00050080, 0x00000006, 0x000000f6, 0x000000f0, 0x000000f5, 0x00050080, 0x00000006,
-    0x000000f8, 0x000000f6, 0x000000f7, 0x000500c2, 0x00000006, 0x000000fa, 0x000000f8, 0x000000f9,
-    0x0004003d, 0x00000006, 0x000000fc, 0x0000002d, 0x0003003e, 0x000000fb, 0x000000fc, 0x00050039,
-    0x00000006, 0x000000fd, 0x0000001a, 0x000000fb, 0x0004003d, 0x00000006, 0x000000fe, 0x000000e3,
-    0x00050084, 0x00000006, 0x000000ff, 0x000000fd, 0x000000fe, 0x0004003d, 0x00000006, 0x00000101,
-    0x0000002e, 0x0003003e, 0x00000100, 0x00000101, 0x00050039, 0x00000006, 0x00000102, 0x0000001a,
-    0x00000100, 0x0004003d, 0x00000006, 0x00000103, 0x000000e8, 0x00050084, 0x00000006, 0x00000104,
-    0x00000102, 0x00000103, 0x00050080, 0x00000006, 0x00000105, 0x000000ff, 0x00000104, 0x00050080,
-    0x00000006, 0x00000106, 0x00000105, 0x000000f7, 0x000500c2, 0x00000006, 0x00000107, 0x00000106,
-    0x000000f9, 0x0004003d, 0x00000006, 0x00000109, 0x0000002d, 0x0003003e, 0x00000108, 0x00000109,
-    0x00050039, 0x00000006, 0x0000010a, 0x0000001d, 0x00000108, 0x0004003d, 0x00000006, 0x0000010b,
-    0x000000e3, 0x00050084, 0x00000006, 0x0000010c, 0x0000010a, 0x0000010b, 0x0004003d, 0x00000006,
-    0x0000010e, 0x0000002e, 0x0003003e, 0x0000010d, 0x0000010e, 0x00050039, 0x00000006, 0x0000010f,
-    0x0000001d, 0x0000010d, 0x0004003d, 0x00000006, 0x00000110, 0x000000e8, 0x00050084, 0x00000006,
-    0x00000111, 0x0000010f, 0x00000110, 0x00050080, 0x00000006, 0x00000112, 0x0000010c, 0x00000111,
-    0x00050080, 0x00000006, 0x00000113, 0x00000112, 0x000000f7, 0x000500c2, 0x00000006, 0x00000114,
-    0x00000113, 0x000000f9, 0x0003003e, 0x00000115, 0x000000fa, 0x0003003e, 0x00000116, 0x00000107,
-    0x0003003e, 0x00000117, 0x00000114, 0x0003003e, 0x00000118, 0x0000005a, 0x00080039, 0x00000006,
-    0x00000119, 0x00000024, 0x00000115, 0x00000116, 0x00000117, 0x00000118, 0x000200fe, 0x00000119,
-    0x00010038, 0x00050036, 0x00000006, 0x00000035, 0x00000000, 0x00000031, 0x00030037, 0x00000007,
-    0x00000032, 0x00030037, 0x00000007, 0x00000033, 0x00030037, 0x00000007, 0x00000034, 0x000200f8,
-    0x00000036, 0x0004003b, 0x00000007, 0x0000011c, 0x00000007, 0x0004003b, 0x00000007, 0x0000011f,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000129, 0x00000007, 0x0004003b, 0x00000007, 0x0000012c,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000136, 0x00000007, 0x0004003b, 0x00000007, 0x00000139,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000143, 0x00000007, 0x0004003b, 0x00000007, 0x00000144,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000145, 0x00000007, 0x0004003b, 0x00000007, 0x00000146,
-    0x00000007, 0x0004003d, 0x00000006, 0x0000011d, 0x00000032, 0x0003003e, 0x0000011c, 0x0000011d,
-    0x00050039, 0x00000006, 0x0000011e, 0x00000017, 0x0000011c, 0x0004003d, 0x00000006, 0x00000120,
-    0x00000032, 0x0003003e, 0x0000011f, 0x00000120, 0x00050039, 0x00000006, 0x00000121, 0x00000017,
-    0x0000011f, 0x00050082, 0x00000006, 0x00000122, 0x00000056, 0x00000121, 0x0004003d, 0x00000006,
-    0x00000123, 0x00000033, 0x00050084, 0x00000006, 0x00000124, 0x00000122, 0x00000123, 0x0004003d,
-    0x00000006, 0x00000125, 0x00000034, 0x00050080, 0x00000006, 0x00000126, 0x00000124, 0x00000125,
-    0x000500c2, 0x00000006, 0x00000127, 0x00000126, 0x000000c0, 0x00050080, 0x00000006, 0x00000128,
-    0x0000011e, 0x00000127, 0x0004003d, 0x00000006, 0x0000012a, 0x00000032, 0x0003003e, 0x00000129,
-    0x0000012a, 0x00050039, 0x00000006, 0x0000012b, 0x0000001a, 0x00000129, 0x0004003d, 0x00000006,
-    0x0000012d, 0x00000032, 0x0003003e, 0x0000012c, 0x0000012d, 0x00050039, 0x00000006, 0x0000012e,
-    0x0000001a, 0x0000012c, 0x00050082, 0x00000006, 0x0000012f, 0x00000056, 0x0000012e, 0x0004003d,
-    0x00000006, 0x00000130, 0x00000033, 0x00050084, 0x00000006, 0x00000131, 0x0000012f, 0x00000130,
-    0x0004003d, 0x00000006, 0x00000132, 0x00000034, 0x00050080, 0x00000006, 0x00000133, 0x00000131,
-    0x00000132, 0x000500c2, 0x00000006, 0x00000134, 0x00000133, 0x000000c0, 0x00050080, 0x00000006,
-    0x00000135, 0x0000012b, 0x00000134, 0x0004003d, 0x00000006, 0x00000137, 0x00000032, 0x0003003e,
-    0x00000136, 0x00000137, 0x00050039, 0x00000006, 0x00000138, 0x0000001d, 0x00000136, 0x0004003d,
-    0x00000006, 0x0000013a, 0x00000032, 0x0003003e, 0x00000139, 0x0000013a, 0x00050039, 0x00000006,
-    0x0000013b, 0x0000001d, 0x00000139, 0x00050082, 0x00000006, 0x0000013c, 0x00000056, 0x0000013b,
-    0x0004003d, 0x00000006, 0x0000013d, 0x00000033, 0x00050084, 0x00000006, 0x0000013e, 0x0000013c,
-    0x0000013d, 0x0004003d, 0x00000006, 0x0000013f, 0x00000034, 0x00050080, 0x00000006, 0x00000140,
-    0x0000013e, 0x0000013f, 0x000500c2, 0x00000006, 0x00000141, 0x00000140, 0x000000c0, 0x00050080,
-    0x00000006, 0x00000142, 0x00000138, 0x00000141, 0x0003003e, 0x00000143, 0x00000128, 0x0003003e,
-    0x00000144, 0x00000135, 0x0003003e, 0x00000145, 0x00000142, 0x0003003e, 0x00000146, 0x0000005a,
-    0x00080039, 0x00000006, 0x00000147, 0x00000024, 0x00000143, 0x00000144, 0x00000145, 0x00000146,
-    0x000200fe, 0x00000147, 0x00010038, 0x00050036, 0x00000006, 0x0000003a, 0x00000000, 0x00000031,
-    0x00030037, 0x00000007, 0x00000037, 0x00030037, 0x00000007, 0x00000038, 0x00030037, 0x00000007,
-    0x00000039, 0x000200f8, 0x0000003b, 0x0004003b, 0x00000007, 0x0000014a, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000014d, 0x00000007, 0x0004003b, 0x00000007, 0x00000156, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000159, 0x00000007, 0x0004003b, 0x00000007, 0x00000162, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000165, 0x00000007, 0x0004003b, 0x00000007, 0x0000016e, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000016f, 0x00000007, 0x0004003b, 0x00000007, 0x00000170, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000171, 0x00000007, 0x0004003d, 0x00000006, 0x0000014b, 0x00000037, 0x0003003e,
-    0x0000014a, 0x0000014b, 0x00050039, 0x00000006, 0x0000014c, 0x00000017, 0x0000014a, 0x0004003d,
-    0x00000006, 0x0000014e, 0x00000037, 0x0003003e, 0x0000014d, 0x0000014e, 0x00050039, 0x00000006,
-    0x0000014f, 0x00000017, 0x0000014d, 0x0004003d, 0x00000006, 0x00000150, 0x00000038, 0x00050084,
-    0x00000006, 0x00000151, 0x0000014f, 0x00000150, 0x0004003d, 0x00000006, 0x00000152, 0x00000039,
-    0x00050080, 0x00000006, 0x00000153, 0x00000151, 0x00000152, 0x000500c2, 0x00000006, 0x00000154,
-    0x00000153, 0x000000c0, 0x00050082, 0x00000006, 0x00000155, 0x0000014c, 0x00000154, 0x0004003d,
-    0x00000006, 0x00000157, 0x00000037, 0x0003003e, 0x00000156, 0x00000157, 0x00050039, 0x00000006,
-    0x00000158, 0x0000001a, 0x00000156, 0x0004003d, 0x00000006, 0x0000015a, 0x00000037, 0x0003003e,
-    0x00000159, 0x0000015a, 0x00050039, 0x00000006, 0x0000015b, 0x0000001a, 0x00000159, 0x0004003d,
-    0x00000006, 0x0000015c, 0x00000038, 0x00050084, 0x00000006, 0x0000015d, 0x0000015b, 0x0000015c,
-    0x0004003d, 0x00000006, 0x0000015e, 0x00000039, 0x00050080, 0x00000006, 0x0000015f, 0x0000015d,
-    0x0000015e, 0x000500c2, 0x00000006, 0x00000160, 0x0000015f, 0x000000c0, 0x00050082, 0x00000006,
-    0x00000161, 0x00000158, 0x00000160, 0x0004003d, 0x00000006, 0x00000163, 0x00000037, 0x0003003e,
-    0x00000162, 0x00000163, 0x00050039, 0x00000006, 0x00000164, 0x0000001d, 0x00000162, 0x0004003d,
-    0x00000006, 0x00000166, 0x00000037, 0x0003003e, 0x00000165, 0x00000166, 0x00050039, 0x00000006,
-    0x00000167, 0x0000001d, 0x00000165, 0x0004003d, 0x00000006, 0x00000168, 0x00000038, 0x00050084,
-    0x00000006, 0x00000169, 0x00000167, 0x00000168, 0x0004003d, 0x00000006, 0x0000016a, 0x00000039,
-    0x00050080, 0x00000006, 0x0000016b, 0x00000169, 0x0000016a, 0x000500c2, 0x00000006, 0x0000016c,
-    0x0000016b, 0x000000c0, 0x00050082, 0x00000006, 0x0000016d, 0x00000164, 0x0000016c, 0x0003003e,
-    0x0000016e, 0x00000155, 0x0003003e, 0x0000016f, 0x00000161, 0x0003003e, 0x00000170, 0x0000016d,
-    0x0003003e, 0x00000171, 0x0000005a, 0x00080039, 0x00000006, 0x00000172, 0x00000024, 0x0000016e,
-    0x0000016f, 0x00000170, 0x00000171, 0x000200fe, 0x00000172, 0x00010038, 0x00050036, 0x00000006,
-    0x00000041, 0x00000000, 0x0000003e, 0x00030037, 0x00000007, 0x0000003f, 0x00030037, 0x0000003d,
-    0x00000040, 0x000200f8, 0x00000042, 0x0004003b, 0x00000007, 0x00000175, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000179, 0x00000007, 0x0004003b, 0x00000007, 0x0000017e, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000183, 0x00000007, 0x0004003b, 0x00000007, 0x0000018a, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000194, 0x00000007, 0x0004003d, 0x00000006, 0x00000176, 0x0000003f, 0x000500c7,
-    0x00000006, 0x00000178, 0x00000176, 0x00000177, 0x0003003e, 0x00000175, 0x00000178, 0x0004003d,
-    0x00000006, 0x0000017a, 0x0000003f, 0x000500c2, 0x00000006, 0x0000017c, 0x0000017a, 0x0000017b,
-    0x000500c7, 0x00000006, 0x0000017d, 0x0000017c, 0x0000008d, 0x0003003e, 0x00000179, 0x0000017d,
-    0x0004003d, 0x00000006, 0x0000017f, 0x0000003f, 0x000500c2, 0x00000006, 0x00000181, 0x0000017f,
-    0x00000180, 0x000500c7, 0x00000006, 0x00000182, 0x00000181, 0x0000007d, 0x0003003e, 0x0000017e,
-    0x00000182, 0x0003003e, 0x00000183, 0x00000189, 0x0004003d, 0x00000006, 0x0000018b, 0x0000017e,
-    0x00050084, 0x00000006, 0x0000018d, 0x0000018b, 0x0000018c, 0x0004003d, 0x00000006, 0x0000018e,
-    0x00000179, 0x00050080, 0x00000006, 0x0000018f, 0x0000018d, 0x0000018e, 0x00050084, 0x00000006,
-    0x00000191, 0x0000018f, 0x00000190, 0x0004003d, 0x00000006, 0x00000192, 0x00000175, 0x00050080,
-    0x00000006, 0x00000193, 0x00000191, 0x00000192, 0x0003003e, 0x0000018a, 0x00000193, 0x00050041,
-    0x00000007, 0x00000195, 0x00000040, 0x0000007d, 0x0004003d, 0x00000006, 0x00000196, 0x00000195,
-    0x00050084, 0x00000006, 0x00000198, 0x00000196, 0x00000197, 0x00050041, 0x00000007, 0x00000199,
-    0x00000040, 0x00000078, 0x0004003d, 0x00000006, 0x0000019a, 0x00000199, 0x00050080, 0x00000006,
-    0x0000019b, 0x00000198, 0x0000019a, 0x0003003e, 0x00000194, 0x0000019b, 0x0004003d, 0x00000006,
-    0x000001a1, 0x0000018a, 0x0004003d, 0x00000006, 0x000001a2, 0x00000183, 0x00050084, 0x00000006,
-    0x000001a3, 0x000001a1, 0x000001a2, 0x0004003d, 0x00000006, 0x000001a4, 0x00000194, 0x00050080,
-    0x00000006, 0x000001a5, 0x000001a3, 0x000001a4, 0x00060041, 0x000001a6, 0x000001a7, 0x0000019f,
-    0x000001a0, 0x000001a5, 0x0004003d, 0x00000006, 0x000001a8, 0x000001a7, 0x000200fe, 0x000001a8,
-    0x00010038, 0x00050036, 0x00000006, 0x00000046, 0x00000000, 0x00000043, 0x00030037, 0x0000003d,
-    0x00000044, 0x00030037, 0x00000007, 0x00000045, 0x000200f8, 0x00000047, 0x0004003b, 0x00000007,
-    0x000001ab, 0x00000007, 0x0004003b, 0x000001b1, 0x000001b2, 0x00000007, 0x0004003b, 0x000001b1,
-    0x000001b7, 0x00000007, 0x0004003b, 0x00000007, 0x000001dc, 0x00000007, 0x0004003b, 0x00000011,
-    0x000001e4, 0x00000007, 0x0004003d, 0x00000006, 0x000001ac, 0x00000045, 0x000500c2, 0x00000006,
-    0x000001ae, 0x000001ac, 0x000001ad, 0x000500c7, 0x00000006, 0x000001b0, 0x000001ae, 0x000001af,
-    0x0003003e, 0x000001ab, 0x000001b0, 0x0004003d, 0x00000006, 0x000001b3, 0x000001ab, 0x000500c7,
-    0x00000006, 0x000001b5, 0x000001b3, 0x000001b4, 0x000500ab, 0x00000048, 0x000001b6, 0x000001b5,
-    0x00000078, 0x000300f7, 0x000001b9, 0x00000000, 0x000400fa, 0x000001b6, 0x000001b8, 0x000001c4,
-    0x000200f8, 0x000001b8, 0x00050041, 0x00000007, 0x000001ba, 0x00000044, 0x00000078, 0x0004003d,
-    0x00000006, 0x000001bb, 0x000001ba, 0x0004007c, 0x0000000f, 0x000001bc, 0x000001bb, 0x0004003d,
-    0x00000006, 0x000001be, 0x000001ab, 0x00050082, 0x00000006, 0x000001bf, 0x000001bd, 0x000001be,
-    0x00050084, 0x00000006, 0x000001c1, 0x000001bf, 0x000001c0, 0x0004007c, 0x0000000f, 0x000001c2,
-    0x000001c1, 0x00050082, 0x0000000f, 0x000001c3, 0x000001bc, 0x000001c2, 0x0003003e, 0x000001b7,
-    0x000001c3, 0x000200f9, 0x000001b9, 0x000200f8, 0x000001c4, 0x00050041, 0x00000007, 0x000001c5,
-    0x00000044, 0x00000078, 0x0004003d, 0x00000006, 0x000001c6, 0x000001c5, 0x0004007c, 0x0000000f,
-    0x000001c7, 0x000001c6, 0x0004003d, 0x00000006, 0x000001c8, 0x000001ab, 0x00050084, 0x00000006,
-    0x000001ca, 0x000001c8, 0x000001c9, 0x0004007c, 0x0000000f, 0x000001cb, 0x000001ca, 0x00050080,
-    0x0000000f, 0x000001cc, 0x000001c7, 0x000001cb, 0x0003003e, 0x000001b7, 0x000001cc, 0x000200f9,
-    0x000001b9, 0x000200f8, 0x000001b9, 0x0004003d, 0x0000000f, 0x000001cd, 0x000001b7, 0x0003003e,
-    0x000001b2, 0x000001cd, 0x00050041, 0x000001d2, 0x000001d3, 0x000001d0, 0x000001d1, 0x0004003d,
-    0x00000006, 0x000001d4, 0x000001d3, 0x000500ab, 0x00000048, 0x000001d5, 0x000001d4, 0x00000078,
-    0x0004003d, 0x0000000f, 0x000001d6, 0x000001b2, 0x000500af, 0x00000048, 0x000001d7, 0x000001d6,
-    0x000001a0, 0x000500a7, 0x00000048, 0x000001d8, 0x000001d5, 0x000001d7, 0x0004003d, 0x0000000f,
-    0x000001d9, 0x000001b2, 0x000500b1, 0x00000048, 0x000001da, 0x000001d9, 0x00000184, 0x000500a7,
-    0x00000048, 0x000001db, 0x000001d8, 0x000001da, 0x000300f7, 0x000001de, 0x00000000, 0x000400fa,
-    0x000001db, 0x000001dd, 0x000001e6, 0x000200f8, 0x000001dd, 0x0004003d, 0x0000000f, 0x000001df,
-    0x000001b2, 0x00050041, 0x00000007, 0x000001e0, 0x00000044, 0x0000007d, 0x0004003d, 0x00000006,
-    0x000001e1, 0x000001e0, 0x0004007c, 0x0000000f, 0x000001e2, 0x000001e1, 0x00050050, 0x00000010,
-    0x000001e3, 0x000001df, 0x000001e2, 0x0003003e, 0x000001e4, 0x000001e3, 0x00050039, 0x00000006,
-    0x000001e5, 0x00000014, 0x000001e4, 0x0003003e, 0x000001dc, 0x000001e5, 0x000200f9, 0x000001de,
-    0x000200f8, 0x000001e6, 0x0003003e, 0x000001dc, 0x00000078, 0x000200f9, 0x000001de, 0x000200f8,
-    0x000001de, 0x0004003d, 0x00000006, 0x000001e7, 0x000001dc, 0x000200fe, 0x000001e7, 0x00010038,
-    0x00050036, 0x00000006, 0x00000050, 0x00000000, 0x0000004a, 0x00030037, 0x00000007, 0x0000004b,
-    0x00030037, 0x0000003d, 0x0000004c, 0x00030037, 0x00000007, 0x0000004d, 0x00030037, 0x00000007,
-    0x0000004e, 0x00030037, 0x00000049, 0x0000004f, 0x000200f8, 0x00000051, 0x0004003b, 0x00000007,
-    0x000001ea, 0x00000007, 0x0004003b, 0x00000007, 0x000001ec, 0x00000007, 0x0004003b, 0x00000007,
-    0x000001f6, 0x00000007, 0x0004003b, 0x00000007, 0x000001fe, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000206, 0x00000007, 0x0004003b, 0x00000007, 0x0000020e, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000212, 0x00000007, 0x0004003b, 0x00000007, 0x00000224, 0x00000007, 0x0004003b, 0x0000003d,
-    0x00000226, 0x00000007, 0x0004003b, 0x00000007, 0x0000022b, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000235, 0x00000007, 0x0004003b, 0x0000003d, 0x00000237, 0x00000007, 0x0004003b, 0x0000003d,
-    0x0000023d, 0x00000007, 0x0004003b, 0x00000007, 0x0000023f, 0x00000007, 0x0004003b, 0x00000007,
-    0x0000024a, 0x00000007, 0x0004003b, 0x00000007, 0x0000024e, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000252, 0x00000007, 0x0004003b, 0x00000007, 0x00000261, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000263, 0x00000007, 0x0004003b, 0x00000007, 0x00000265, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000267, 0x00000007, 0x0004003b, 0x00000007, 0x0000026f, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000271, 0x00000007, 0x0004003b, 0x00000007, 0x00000273, 0x00000007, 0x0004003b, 0x00000007,
-    0x0000027b, 0x00000007, 0x0004003b, 0x00000007, 0x0000027d, 0x00000007, 0x0004003b, 0x00000007,
-    0x0000027f, 0x00000007, 0x0004003b, 0x00000007, 0x00000286, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000288, 0x00000007, 0x0003003e, 0x000001ea, 0x000001eb, 0x0004003d, 0x00000006, 0x000001f1,
-    0x000001ea, 0x0004003d, 0x00000006, 0x000001f2, 0x0000004d, 0x00050080, 0x00000006, 0x000001f3,
-    0x000001f1, 0x000001f2, 0x00060041, 0x000001a6, 0x000001f4, 0x000001f0, 0x000001a0, 0x000001f3,
-    0x0004003d, 0x00000006, 0x000001f5, 0x000001f4, 0x0003003e, 0x000001ec, 0x000001f5, 0x0004003d,
-    0x00000006, 0x000001f7, 0x000001ea, 0x00050080, 0x00000006, 0x000001f9, 0x000001f7, 0x000001f8,
-    0x0004003d, 0x00000006, 0x000001fa, 0x0000004d, 0x00050080, 0x00000006, 0x000001fb, 0x000001f9,
-    0x000001fa, 0x00060041, 0x000001a6, 0x000001fc, 0x000001f0, 0x000001a0, 0x000001fb, 0x0004003d,
-    0x00000006, 0x000001fd, 0x000001fc, 0x0003003e, 0x000001f6, 0x000001fd, 0x0004003d, 0x00000006,
-    0x000001ff, 0x000001ea, 0x00050080, 0x00000006, 0x00000201, 0x000001ff, 0x00000200, 0x0004003d,
-    0x00000006, 0x00000202, 0x0000004d, 0x00050080, 0x00000006, 0x00000203, 0x00000201, 0x00000202,
-    0x00060041, 0x000001a6, 0x00000204, 0x000001f0, 0x000001a0, 0x00000203, 0x0004003d, 0x00000006,
-    0x00000205, 0x00000204, 0x0003003e, 0x000001fe, 0x00000205, 0x0004003d, 0x00000006, 0x00000207,
-    0x000001ea, 0x00050080, 0x00000006, 0x00000209, 0x00000207, 0x00000208, 0x0004003d, 0x00000006,
-    0x0000020a, 0x0000004d, 0x00050080, 0x00000006, 0x0000020b, 0x00000209, 0x0000020a, 0x00060041,
-    0x000001a6, 0x0000020c, 0x000001f0, 0x000001a0, 0x0000020b, 0x0004003d, 0x00000006, 0x0000020d,
-    0x0000020c, 0x0003003e, 0x00000206, 0x0000020d, 0x0004003d, 0x00000006, 0x0000020f, 0x000001fe,
-    0x000500c2, 0x00000006, 0x00000211, 0x0000020f, 0x00000210, 0x0003003e, 0x0000020e, 0x00000211,
-    0x0004003d, 0x00000006, 0x00000213, 0x000001ec, 0x0003003e, 0x00000212, 0x00000213, 0x0004003d,
-    0x00000006, 0x00000214, 0x0000020e, 0x000500c7, 0x00000006, 0x00000216, 0x00000214, 0x00000215,
-    0x000500aa, 0x00000048, 0x00000217, 0x00000216, 0x00000078, 0x000300f7, 0x00000219, 0x00000000,
-    0x000400fa, 0x00000217, 0x00000218, 0x00000219, 0x000200f8, 0x00000218, 0x0004003d, 0x00000006,
-    0x0000021a, 0x00000206, 0x000500c7, 0x00000006, 0x0000021c, 0x0000021a, 0x0000021b, 0x000500ab,
-    0x00000048, 0x0000021d, 0x0000021c, 0x00000078, 0x000300f7, 0x0000021f, 0x00000000, 0x000400fa,
-    0x0000021d, 0x0000021e, 0x0000021f, 0x000200f8, 0x0000021e, 0x0004003d, 0x0000003c, 0x00000220,
-    0x0000004c, 0x00050050, 0x0000003c, 0x00000222, 0x00000221, 0x00000221, 0x00050089, 0x0000003c,
-    0x00000223, 0x00000220, 0x00000222, 0x0004003d, 0x00000006, 0x00000225, 0x00000206, 0x0003003e,
-    0x00000224, 0x00000225, 0x0003003e, 0x00000226, 0x00000223, 0x00060039, 0x00000006, 0x00000227,
-    0x00000041, 0x00000224, 0x00000226, 0x000200fe, 0x00000227, 0x000200f8, 0x0000021f, 0x0004003d,
-    0x00000006, 0x00000229, 0x00000212, 0x000200fe, 0x00000229, 0x000200f8, 0x00000219, 0x0003003e,
-    0x0000022b, 0x00000078, 0x0004003d, 0x00000006, 0x0000022c, 0x00000206, 0x000500c7, 0x00000006,
-    0x0000022d, 0x0000022c, 0x0000021b, 0x000500ab, 0x00000048, 0x0000022e, 0x0000022d, 0x00000078,
-    0x000300f7, 0x00000230, 0x00000000, 0x000400fa, 0x0000022e, 0x0000022f, 0x00000239, 0x000200f8,
-    0x0000022f, 0x0004003d, 0x0000003c, 0x00000231, 0x0000004c, 0x00050050, 0x0000003c, 0x00000233,
-    0x00000232, 0x00000232, 0x00050089, 0x0000003c, 0x00000234, 0x00000231, 0x00000233, 0x0004003d,
-    0x00000006, 0x00000236, 0x00000206, 0x0003003e, 0x00000235, 0x00000236, 0x0003003e, 0x00000237,
-    0x00000234, 0x00060039, 0x00000006, 0x00000238, 0x00000041, 0x00000235, 0x00000237, 0x0003003e,
-    0x0000022b, 0x00000238, 0x000200f9, 0x00000230, 0x000200f8, 0x00000239, 0x0004003d, 0x00000048,
-    0x0000023a, 0x0000004f, 0x000300f7, 0x0000023c, 0x00000000, 0x000400fa, 0x0000023a, 0x0000023b,
-    0x0000023c, 0x000200f8, 0x0000023b, 0x0004003d, 0x0000003c, 0x0000023e, 0x0000004c, 0x0003003e,
-    0x0000023d, 0x0000023e, 0x0004003d, 0x00000006, 0x00000240, 0x0000004e, 0x0003003e, 0x0000023f,
-    0x00000240, 0x00060039, 0x00000006, 0x00000241, 0x00000046, 0x0000023d, 0x0000023f, 0x0003003e,
-    0x0000022b, 0x00000241, 0x000200f9, 0x0000023c, 0x000200f8, 0x0000023c, 0x000200f9, 0x00000230,
-    0x000200f8, 0x00000230, 0x0004003d, 0x00000006, 0x00000242, 0x0000022b, 0x000500c2, 0x00000006,
-    0x00000243, 0x00000242, 0x00000210, 0x000500c7, 0x00000006, 0x00000244, 0x00000243, 0x0000005f,
-    0x000500aa, 0x00000048, 0x00000245, 0x00000244, 0x00000078, 0x000300f7, 0x00000247, 0x00000000,
-    0x000400fa, 0x00000245, 0x00000246, 0x00000247, 0x000200f8, 0x00000246, 0x0004003d, 0x00000006,
-    0x00000248, 0x000001ec, 0x000200fe, 0x00000248, 0x000200f8, 0x00000247, 0x0004003d, 0x00000006,
-    0x0000024b, 0x0000020e, 0x000500c7, 0x00000006, 0x0000024d, 0x0000024b, 0x0000024c, 0x0003003e,
-    0x0000024a, 0x0000024d, 0x0004003d, 0x00000006, 0x0000024f, 0x000001fe, 0x000500c2, 0x00000006,
-    0x00000250, 0x0000024f, 0x000000be, 0x000500c7, 0x00000006, 0x00000251, 0x00000250, 0x0000005f,
-    0x0003003e, 0x0000024e, 0x00000251, 0x0004003d, 0x00000006, 0x00000253, 0x000001fe, 0x000500c2,
-    0x00000006, 0x00000254, 0x00000253, 0x000000f7, 0x000500c7, 0x00000006, 0x00000255, 0x00000254,
-    0x0000005f, 0x0003003e, 0x00000252, 0x00000255, 0x0004003d, 0x00000006, 0x00000256, 0x0000024a,
-    0x000500aa, 0x00000048, 0x00000257, 0x00000256, 0x0000007d, 0x000300f7, 0x00000259, 0x00000000,
-    0x000400fa, 0x00000257, 0x00000258, 0x00000259, 0x000200f8, 0x00000258, 0x0004003d, 0x00000006,
-    0x0000025a, 0x0000020e, 0x000500c7, 0x00000006, 0x0000025c, 0x0000025a, 0x0000025b, 0x000500ab,
-    0x00000048, 0x0000025d, 0x0000025c, 0x00000078, 0x000200f9, 0x00000259, 0x000200f8, 0x00000259,
-    0x000700f5, 0x00000048, 0x0000025e, 0x00000257, 0x00000247, 0x0000025d, 0x00000258, 0x000300f7,
-    0x00000260, 0x00000000, 0x000400fa, 0x0000025e, 0x0000025f, 0x00000260, 0x000200f8, 0x0000025f,
-    0x0004003d, 0x00000006, 0x00000262, 0x000001f6, 0x0003003e, 0x00000261, 0x00000262, 0x0004003d,
-    0x00000006, 0x00000264, 0x0000022b, 0x0003003e, 0x00000263, 0x00000264, 0x0004003d, 0x00000006,
-    0x00000266, 0x0000024e, 0x0003003e, 0x00000265, 0x00000266, 0x0004003d, 0x00000006, 0x00000268,
-    0x00000252, 0x0003003e, 0x00000267, 0x00000268, 0x00080039, 0x00000006, 0x00000269, 0x0000002a,
-    0x00000261, 0x00000263, 0x00000265, 0x00000267, 0x000200fe, 0x00000269, 0x000200f8, 0x00000260,
-    0x0004003d, 0x00000006, 0x0000026b, 0x0000024a, 0x000500aa, 0x00000048, 0x0000026c, 0x0000026b,
-    0x00000085, 0x000300f7, 0x0000026e, 0x00000000, 0x000400fa, 0x0000026c, 0x0000026d, 0x0000026e,
-    0x000200f8, 0x0000026d, 0x0004003d, 0x00000006, 0x00000270, 0x0000022b, 0x0003003e, 0x0000026f,
-    0x00000270, 0x0004003d, 0x00000006, 0x00000272, 0x0000024e, 0x0003003e, 0x00000271, 0x00000272,
-    0x0003003e, 0x00000273, 0x000000be, 0x00070039, 0x00000006, 0x00000274, 0x00000035, 0x0000026f,
-    0x00000271, 0x00000273, 0x000200fe, 0x00000274, 0x000200f8, 0x0000026e, 0x0004003d, 0x00000006,
-    0x00000276, 0x0000024a, 0x000500aa, 0x00000048, 0x00000277, 0x00000276, 0x0000008d, 0x000300f7,
-    0x00000279, 0x00000000, 0x000400fa, 0x00000277, 0x00000278, 0x00000279, 0x000200f8, 0x00000278,
-    0x0004003d, 0x00000006, 0x0000027c, 0x0000022b, 0x0003003e, 0x0000027b, 0x0000027c, 0x0004003d,
-    0x00000006, 0x0000027e, 0x0000024e, 0x0003003e, 0x0000027d, 0x0000027e, 0x0003003e, 0x0000027f,
-    0x0000027a, 0x00070039, 0x00000006, 0x00000280, 0x0000003a, 0x0000027b, 0x0000027d, 0x0000027f,
-    0x000200fe, 0x00000280, 0x000200f8, 0x00000279, 0x0004003d, 0x00000006, 0x00000282, 0x0000024a,
-    0x000500aa, 0x00000048, 0x00000283, 0x00000282, 0x0000018c, 0x000300f7, 0x00000285, 0x00000000,
-    0x000400fa, 0x00000283, 0x00000284, 0x00000285, 0x000200f8, 0x00000284, 0x0004003d, 0x00000006,
-    0x00000287, 0x0000022b, 0x0003003e, 0x00000286, 0x00000287, 0x0004003d, 0x00000006, 0x00000289,
-    0x000001ec, 0x0003003e, 0x00000288, 0x00000289, 0x00060039, 0x00000006, 0x0000028a, 0x0000002f,
-    0x00000286, 0x00000288, 0x000200fe, 0x0000028a, 0x000200f8, 0x00000285, 0x0004003d, 0x00000006,
-    0x0000028c, 0x0000022b, 0x000200fe, 0x0000028c, 0x00010038, 0x00050036, 0x00000006, 0x00000053,
-    0x00000000, 0x00000008, 0x00030037, 0x00000007, 0x00000052, 0x000200f8, 0x00000054, 0x0004003b,
-    0x00000007, 0x0000028f, 0x00000007, 0x0004003b, 0x00000007, 0x00000294, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000029a, 0x00000007, 0x0004003b, 0x00000007, 0x000002a0, 0x00000007, 0x0004003d,
-    0x00000006, 0x00000290, 0x00000052, 0x000500c7, 0x00000006, 0x00000291, 0x00000290, 0x00000056,
-    0x000500c2, 0x00000006, 0x00000292, 0x00000291, 0x0000007d, 0x000500c4, 0x00000006, 0x00000293,
-    0x00000292, 0x0000007d, 0x0003003e, 0x0000028f, 0x00000293, 0x0004003d, 0x00000006, 0x00000295,
-    0x00000052, 0x000500c2, 0x00000006, 0x00000296, 0x00000295, 0x000000be, 0x000500c7, 0x00000006,
-    0x00000297, 0x00000296, 0x00000056, 0x000500c2, 0x00000006, 0x00000298, 0x00000297, 0x0000007d,
-    0x000500c4, 0x00000006, 0x00000299, 0x00000298, 0x0000007d, 0x0003003e, 0x00000294, 0x00000299,
-    0x0004003d, 0x00000006, 0x0000029b, 0x00000052, 0x000500c2, 0x00000006, 0x0000029c, 0x0000029b,
-    0x000000f7, 0x000500c7, 0x00000006, 0x0000029d, 0x0000029c, 0x00000056, 0x000500c2, 0x00000006,
-    0x0000029e, 0x0000029d, 0x0000007d, 0x000500c4, 0x00000006, 0x0000029f, 0x0000029e, 0x0000007d,
-    0x0003003e, 0x0000029a, 0x0000029f, 0x0004003d, 0x00000006, 0x000002a1, 0x00000052, 0x000500c2,
-    0x00000006, 0x000002a2, 0x000002a1, 0x00000210, 0x000500ab, 0x00000048, 0x000002a3, 0x000002a2,
-    0x00000078, 0x000600a9, 0x00000006, 0x000002a4, 0x000002a3, 0x0000005f, 0x00000078, 0x0003003e,
-    0x000002a0, 0x000002a4, 0x0004003d, 0x00000006, 0x000002a5, 0x0000028f, 0x0004003d, 0x00000006,
-    0x000002a6, 0x00000294, 0x000500c4, 0x00000006, 0x000002a7, 0x000002a6, 0x000000be, 0x000500c5,
-    0x00000006, 0x000002a8, 0x000002a5, 0x000002a7, 0x0004003d, 0x00000006, 0x000002a9, 0x0000029a,
-    0x000500c4, 0x00000006, 0x000002aa, 0x000002a9, 0x000000f7, 0x000500c5, 0x00000006, 0x000002ab,
-    0x000002a8, 0x000002aa, 0x0004003d, 0x00000006, 0x000002ac, 0x000002a0, 0x000500c4, 0x00000006,
-    0x000002ad, 0x000002ac, 0x00000210, 0x000500c5, 0x00000006, 0x000002ae, 0x000002ab, 0x000002ad,
-    0x000200fe, 0x000002ae, 0x00010038,
+const uint8_t Blob072_Data[6626] =
+{
+    0x28, 0xb5, 0x2f, 0xfd, 0x60, 0xcc, 0x64, 0xc5, 0xce, 0x00, 0x1a, 0xe1, 0x04, 0x37, 0x36, 0x10,
+    0x68, 0xba, 0xc6, 0x80, 0x8b, 0x53, 0x20, 0x48, 0x4e, 0xa9, 0xa8, 0x2f, 0x0c, 0xcf, 0x09, 0x06,
+    0xb4, 0x66, 0xd8, 0xe2, 0x09, 0x31, 0x38, 0xbb, 0x65, 0x9b, 0x41, 0x6e, 0x5c, 0xa1, 0xa0, 0x7f,
+    0x29, 0x59, 0x0f, 0xdb, 0x32, 0xaf, 0x5f, 0xa7, 0xf4, 0x6c, 0xf2, 0xe5, 0xe5, 0x45, 0x8b, 0x91,
+    0x84, 0x80, 0xdb, 0x48, 0x0a, 0x12, 0x03, 0x5a, 0x03, 0x90, 0x03, 0xe6, 0x7d, 0xbd, 0xde, 0xd1,
+    0xa4, 0xd0, 0xfb, 0x9d, 0x5a, 0x14, 0xd4, 0x3b, 0xfd, 0x9a, 0x3d, 0xb7, 0x3e, 0xeb, 0x74, 0x4e,
+    0x8f, 0xce, 0xcd, 0x6b, 0x32, 0x9a, 0x4d, 0xf7, 0x6b, 0x7e, 0xed, 0x47, 0x06, 0xb4, 0xa3, 0xf9,
+    0xdb, 0xd9, 0xba, 0x9f, 0x5e, 0xaf, 0xcf, 0xb8, 0x80, 0x6b, 0xb4, 0xae, 0x86, 0xa7, 0x73, 0xbd,
+    0x9c, 0xa6, 0x97, 0xc3, 0xf9, 0xdd, 0x79, 0xdf, 0xd1, 0x6a, 0xb2, 0x9a, 0x76, 0xe6, 0xff, 0xb3,
+    0xd8, 0xff, 0xbf, 0xc2, 0xf2, 0x4e, 0x67, 0x66, 0x3f, 0x6e, 0x4e, 0xef, 0x7e, 0xe4, 0x73, 0x01,
+    0x24, 0xf5, 0xd0, 0xc3, 0x09, 0xe9, 0x63, 0x72, 0x58, 0x67, 0x0b, 0x7a, 0xf2, 0x5d, 0x60, 0x7a,
+    0xcf, 0x6b, 0xe7, 0x71, 0x3f, 0x3e, 0x5b, 0xef, 0x16, 0x2b, 0x76, 0x65, 0x55, 0x3d, 0xcd, 0xaf,
+    0xe4, 0x9f, 0xe1, 0xcb, 0x3f, 0x13, 0xff, 0x69, 0x49, 0x34, 0xc8, 0x33, 0x6d, 0xa3, 0x56, 0x51,
+    0x3f, 0x5c, 0x97, 0xd9, 0x69, 0xf3, 0x58, 0xfb, 0x77, 0x75, 0x68, 0x72, 0xcf, 0x7d, 0x03, 0xb3,
+    0xad, 0x69, 0xb5, 0x67, 0x51, 0x5a, 0x24, 0xa2, 0xd7, 0xb5, 0x40, 0x4f, 0xf8, 0xfa, 0x0f, 0xe6,
+    0x3f, 0x4d, 0xbc, 0x8a, 0x36, 0x3e, 0xe7, 0x66, 0x33, 0xea, 0xb9, 0xf4, 0x67, 0xf4, 0x48, 0x45,
+    0xf7, 0xf4, 0x4b, 0x40, 0xf1, 0x3a, 0x0f, 0xdb, 0x50, 0x73, 0xcb, 0xc5, 0xfb, 0xe0, 0xd9, 0xad,
+    0x9c, 0x87, 0xf7, 0x72, 0x5b, 0x5f, 0xd9, 0x92, 0x1c, 0x23, 0xa7, 0x0c, 0x73, 0xf8, 0x9b, 0x4c,
+    0x4f, 0x78, 0x2d, 0x04, 0x46, 0x44, 0x77, 0x03, 0xb5, 0xe0, 0xfe, 0xa7, 0x8b, 0xf3, 0x6c, 0x5d,
+    0x56, 0xee, 0xf5, 0xf1, 0x6e, 0x7e, 0x2b, 0xfb, 0x7e, 0x75, 0xfd, 0x7a, 0x2f, 0xab, 0xa7, 0x9e,
+    0xd0, 0x4d, 0x62, 0x1e, 0xf5, 0x5f, 0x5e, 0xf6, 0xcb, 0xc9, 0xe2, 0x7b, 0x7a, 0x4d, 0x46, 0x1f,
+    0xdc, 0xc3, 0xf9, 0x97, 0x4f, 0xfd, 0xd3, 0x5f, 0xb3, 0xd1, 0x67, 0xb7, 0xb1, 0x98, 0x9d, 0x5e,
+    0xdb, 0x9d, 0x7e, 0x97, 0x70, 0x2f, 0xeb, 0xa6, 0xaf, 0xab, 0x4b, 0xad, 0x88, 0xd1, 0x9e, 0x3f,
+    0xce, 0xd1, 0x7d, 0xdc, 0x19, 0x5d, 0xed, 0xe7, 0x37, 0xb7, 0x87, 0xbf, 0xda, 0x6d, 0x86, 0x7b,
+    0xb7, 0x7d, 0x3b, 0x74, 0x9e, 0xd6, 0xae, 0x75, 0x70, 0xf6, 0xdb, 0xfa, 0x1d, 0x96, 0x9c, 0xce,
+    0xf1, 0xd2, 0x6c, 0xf5, 0x5a, 0x7d, 0xde, 0xd3, 0x00, 0xd5, 0x6c, 0x3a, 0x4e, 0x3d, 0x19, 0x74,
+    0xed, 0xca, 0x0f, 0xf1, 0x6a, 0x9a, 0xff, 0xf7, 0x63, 0xa3, 0x7d, 0xf8, 0x6e, 0x79, 0xf2, 0xcb,
+    0x65, 0x5d, 0xfc, 0xc8, 0xc6, 0x08, 0xb8, 0x1e, 0x93, 0xf3, 0xec, 0xde, 0x33, 0x69, 0x9d, 0x4e,
+    0xad, 0x97, 0xd1, 0xe6, 0x5c, 0xfd, 0xe0, 0xf1, 0xf3, 0x4e, 0x56, 0xa7, 0xf5, 0xc1, 0xc3, 0x0f,
+    0x3c, 0xe7, 0xe1, 0x42, 0xb5, 0x5a, 0x4f, 0x8f, 0xc7, 0x39, 0x5b, 0x10, 0xbd, 0x9f, 0xf5, 0xf0,
+    0x1e, 0x5e, 0xdc, 0x1b, 0xdb, 0x9a, 0x5a, 0x5a, 0x98, 0x17, 0x95, 0x14, 0x52, 0x51, 0x10, 0x10,
+    0x80, 0x1f, 0x9c, 0x2e, 0xf6, 0xc5, 0xa8, 0x9a, 0x66, 0x19, 0x7d, 0xad, 0x14, 0xd1, 0x28, 0xa1,
+    0xa0, 0x9d, 0x9b, 0x9a, 0x37, 0x66, 0x40, 0xbe, 0x0d, 0xcd, 0x79, 0x3a, 0x47, 0x13, 0x8e, 0xd7,
+    0xe7, 0x9c, 0x2d, 0x28, 0xf8, 0x1f, 0xa8, 0xaf, 0x01, 0xeb, 0xc6, 0x3a, 0x03, 0x39, 0xbb, 0x31,
+    0xb9, 0x9c, 0xe3, 0xa9, 0xe7, 0x5e, 0xae, 0xad, 0x8f, 0xcf, 0x6e, 0xf9, 0x39, 0xee, 0xc7, 0x64,
+    0xb8, 0x3f, 0xeb, 0x7a, 0x7a, 0x40, 0xf8, 0xcc, 0x4c, 0xf7, 0x35, 0x9f, 0xaf, 0xf5, 0xb8, 0xf2,
+    0x9a, 0xda, 0x47, 0xa9, 0x6d, 0xe9, 0xe2, 0x34, 0x7b, 0x67, 0x2b, 0xeb, 0x6d, 0x32, 0xdd, 0x99,
+    0x0c, 0xb8, 0x26, 0xe7, 0x8d, 0xf5, 0x72, 0x2e, 0x56, 0x9b, 0x89, 0xcf, 0x7a, 0x5a, 0xf7, 0xd3,
+    0xcb, 0x66, 0xb4, 0xd8, 0x83, 0xe9, 0x5c, 0xac, 0x8f, 0xc9, 0x76, 0x7a, 0x9a, 0xbd, 0x46, 0xe7,
+    0x69, 0x67, 0x61, 0x60, 0x5f, 0x67, 0xc2, 0x5d, 0x4d, 0xc0, 0xbf, 0x3a, 0x27, 0x87, 0xb9, 0xd6,
+    0xe2, 0xfc, 0xb7, 0x5e, 0xeb, 0xd1, 0x05, 0xd4, 0x6a, 0xfd, 0xbc, 0x06, 0xfc, 0x23, 0xa7, 0xbf,
+    0xeb, 0xad, 0xaa, 0xba, 0xae, 0x1e, 0x0f, 0x4b, 0xe5, 0x83, 0x7a, 0xd4, 0xf8, 0xbc, 0x8b, 0x75,
+    0x35, 0xd4, 0x5a, 0x9d, 0x26, 0xfb, 0x3d, 0x71, 0x8d, 0xcf, 0x7a, 0x19, 0x2d, 0x40, 0x9e, 0x33,
+    0x85, 0x97, 0xfe, 0x94, 0x92, 0x5e, 0x1b, 0x28, 0xce, 0xe9, 0x9a, 0xbe, 0x5b, 0xf4, 0x68, 0x46,
+    0x42, 0xdf, 0x36, 0x94, 0x16, 0x03, 0xa8, 0xf3, 0x4a, 0xef, 0xe5, 0x3d, 0x0d, 0xe8, 0xcf, 0x3b,
+    0x79, 0x4d, 0x56, 0xef, 0xe8, 0x1e, 0x2d, 0xf2, 0x60, 0x14, 0x1a, 0x5b, 0x39, 0x3f, 0x93, 0xd9,
+    0xc6, 0xf9, 0x0e, 0xe7, 0x73, 0xd3, 0x95, 0x03, 0xa2, 0xcb, 0x67, 0x38, 0x3a, 0xbb, 0x9c, 0x0f,
+    0xd2, 0xfc, 0xbf, 0x58, 0x16, 0x3b, 0xca, 0x2b, 0xfc, 0x57, 0xb7, 0xdf, 0x81, 0x99, 0xd3, 0xfb,
+    0xb9, 0x40, 0xcd, 0x73, 0x7f, 0x3b, 0x66, 0x97, 0xc5, 0x67, 0x72, 0xf7, 0xf5, 0x41, 0xf2, 0x5a,
+    0xac, 0xa7, 0xc9, 0xe3, 0x3e, 0xfd, 0x4c, 0x2e, 0xf7, 0xe9, 0xe5, 0xc2, 0xb5, 0xba, 0x0f, 0x8d,
+    0x16, 0xf7, 0xad, 0xc1, 0xb5, 0xcd, 0xcd, 0xb5, 0xf5, 0xd5, 0xfc, 0x56, 0x33, 0xab, 0xc5, 0x76,
+    0x77, 0xb6, 0xde, 0xff, 0xac, 0xe5, 0x99, 0x9c, 0x9b, 0x7f, 0x46, 0xe7, 0xff, 0xb5, 0x9f, 0xf3,
+    0x58, 0x5d, 0x5c, 0x56, 0xe3, 0xb5, 0xda, 0x0a, 0xce, 0x0e, 0xae, 0x0d, 0xff, 0xc7, 0x7e, 0xf6,
+    0x77, 0x7e, 0x4b, 0xf5, 0xdd, 0xb7, 0x79, 0xac, 0xf6, 0xb9, 0x4c, 0x59, 0x6d, 0xf9, 0x18, 0x5d,
+    0x9f, 0x02, 0x77, 0x1f, 0x82, 0x03, 0x09, 0x1c, 0x0d, 0x1c, 0x30, 0xb0, 0xe7, 0xb7, 0x97, 0xc7,
+    0x87, 0x97, 0x47, 0x84, 0xf7, 0x05, 0xec, 0xe4, 0xea, 0xec, 0x08, 0xd4, 0xd1, 0xcd, 0x11, 0x28,
+    0xa5, 0x8b, 0x8b, 0xaa, 0x8a, 0xbb, 0x82, 0x7b, 0x03, 0xb3, 0xad, 0xa5, 0xd1, 0xc1, 0xd1, 0x0c,
+    0x78, 0x23, 0x1b, 0xe0, 0x06, 0x76, 0x6b, 0x63, 0x2b, 0x6d, 0x43, 0x5b, 0x53, 0x4b, 0x03, 0x52,
+    0x3b, 0x33, 0x43, 0x3b, 0x2b, 0x33, 0x2b, 0x23, 0xbb, 0xfa, 0x56, 0x65, 0x7d, 0xff, 0xdb, 0x63,
+    0x5b, 0x62, 0x59, 0x61, 0x60, 0x6c, 0x62, 0xf8, 0x87, 0x09, 0x08, 0x43, 0x12, 0xf0, 0x05, 0xe6,
+    0xd5, 0xf5, 0x35, 0x46, 0x27, 0xea, 0xc5, 0xd5, 0xc5, 0xa5, 0x35, 0xa6, 0x85, 0xb5, 0x45, 0x84,
+    0x65, 0x45, 0x66, 0x45, 0x75, 0xd5, 0x3a, 0x45, 0x55, 0x19, 0x40, 0x6a, 0x6a, 0x55, 0x0a, 0x0a,
+    0xe9, 0x09, 0xca, 0xe9, 0xa9, 0x89, 0xc9, 0xe9, 0xb2, 0x69, 0x29, 0x89, 0xa9, 0x89, 0xd2, 0xd2,
+    0x1b, 0x48, 0xe9, 0x88, 0xa8, 0x6d, 0x74, 0x04, 0xae, 0x6c, 0x2d, 0x32, 0xda, 0x2c, 0x1a, 0x02,
+    0x72, 0x0b, 0x0d, 0x6d, 0x46, 0x06, 0x09, 0x69, 0x06, 0xf9, 0xfc, 0xf8, 0xf4, 0xfc, 0xf0, 0xf4,
+    0xec, 0x78, 0x79, 0x5e, 0x77, 0x48, 0xbd, 0x35, 0xd9, 0xd0, 0xad, 0x0e, 0x97, 0xfb, 0x38, 0xdd,
+    0x9c, 0x9a, 0xbf, 0xc1, 0x79, 0x2d, 0x36, 0x37, 0x36, 0x38, 0x4d, 0x0d, 0x4d, 0xb7, 0xa6, 0x0b,
+    0xc6, 0xf1, 0x7f, 0xee, 0x76, 0xe6, 0xdb, 0xda, 0x2d, 0x78, 0x05, 0x91, 0x76, 0x13, 0x4c, 0xf6,
+    0x5f, 0xb1, 0x65, 0xb4, 0x1f, 0x49, 0xa6, 0x0c, 0x99, 0x31, 0x60, 0xc4, 0x8c, 0x09, 0x23, 0xe6,
+    0xdd, 0xae, 0x61, 0x5c, 0x5b, 0x57, 0xbf, 0xb4, 0xb2, 0x52, 0xa6, 0x7e, 0x39, 0x71, 0x86, 0xca,
+    0xea, 0x05, 0xb5, 0x4b, 0xaa, 0x17, 0x48, 0xd5, 0x2e, 0xaa, 0xa7, 0xa5, 0x5c, 0xb6, 0x9c, 0x62,
+    0x2d, 0x4d, 0xb9, 0x98, 0x92, 0x6e, 0xd1, 0x42, 0x9a, 0x05, 0x8b, 0x16, 0xc6, 0x2b, 0x58, 0xda,
+    0x57, 0xac, 0x88, 0x8e, 0x52, 0xb1, 0x52, 0x65, 0xb4, 0xca, 0x14, 0x29, 0x54, 0xf0, 0xb7, 0x94,
+    0x50, 0xec, 0xbf, 0x42, 0x09, 0x85, 0xf2, 0x24, 0xd4, 0xc9, 0x92, 0x27, 0x27, 0x9a, 0x30, 0x71,
+    0x72, 0xc9, 0xc4, 0xf3, 0x7f, 0x09, 0x98, 0xf5, 0xf3, 0x13, 0x34, 0x89, 0x12, 0x24, 0x49, 0xdc,
+    0x48, 0x3c, 0x3f, 0x3d, 0x3b, 0x3f, 0x39, 0x3b, 0x53, 0x1c, 0x31, 0xc2, 0x09, 0x76, 0x51, 0xc4,
+    0x48, 0x3b, 0x46, 0x11, 0x2e, 0x91, 0xcb, 0x1d, 0x44, 0x78, 0x0c, 0x11, 0x32, 0x44, 0xc8, 0x26,
+    0x0f, 0xd7, 0x20, 0x3b, 0x34, 0x83, 0xe0, 0x89, 0x40, 0x16, 0x7f, 0x7c, 0x0f, 0xcd, 0xcc, 0x1e,
+    0x98, 0x9b, 0x98, 0x3a, 0xc2, 0x3c, 0x8f, 0x56, 0x1d, 0x60, 0x1b, 0xed, 0x1c, 0xe0, 0xca, 0x2c,
+    0x0e, 0xfc, 0xeb, 0x9a, 0xbd, 0x31, 0xf3, 0x67, 0x35, 0xc8, 0xbe, 0xc6, 0xd8, 0x1c, 0x8d, 0xaf,
+    0x77, 0x8b, 0x75, 0x65, 0x55, 0x3d, 0xbd, 0xf2, 0x79, 0x69, 0x42, 0x12, 0xb2, 0x51, 0xf1, 0x30,
+    0x6d, 0x1e, 0x7f, 0xc3, 0x7a, 0x77, 0x72, 0x6f, 0x6e, 0x60, 0xb6, 0xb5, 0xb4, 0x30, 0xb0, 0x6f,
+    0x56, 0x55, 0x14, 0x12, 0x97, 0xc8, 0x4d, 0x0b, 0xf4, 0x0a, 0x66, 0x15, 0xb5, 0x94, 0x54, 0x74,
+    0xc7, 0x25, 0xd7, 0x86, 0x9b, 0x58, 0x8c, 0xef, 0x0c, 0x98, 0x9f, 0x79, 0x2f, 0x37, 0xe6, 0x14,
+    0xae, 0x7d, 0xa9, 0x8f, 0x82, 0xda, 0x3e, 0xfd, 0xd6, 0x69, 0xdb, 0xf4, 0xcf, 0x94, 0xb9, 0xa4,
+    0x24, 0xf6, 0x49, 0xdb, 0xff, 0xcf, 0xc9, 0xea, 0x47, 0x40, 0x7b, 0xd1, 0x52, 0x51, 0xf7, 0x89,
+    0x86, 0x1c, 0x1b, 0x85, 0xfe, 0xdf, 0x41, 0x66, 0x40, 0x00, 0xb0, 0xfe, 0x27, 0xd3, 0x47, 0xab,
+    0xbb, 0xdd, 0xfe, 0xbf, 0xc1, 0xb4, 0x7e, 0x31, 0xda, 0x9f, 0xe6, 0x4f, 0x8b, 0xe0, 0x9f, 0x26,
+    0x73, 0xee, 0x03, 0xbc, 0xb6, 0xc6, 0x41, 0x6a, 0x96, 0x29, 0x99, 0x4d, 0x40, 0xdf, 0x47, 0x70,
+    0x1f, 0x59, 0x4b, 0x31, 0xec, 0x0c, 0x2d, 0x2e, 0x03, 0x88, 0xcb, 0x20, 0xd1, 0x80, 0x0e, 0x9c,
+    0xd6, 0x2b, 0x25, 0x12, 0x99, 0xfd, 0x04, 0x79, 0xbf, 0xfb, 0xd9, 0xcf, 0x04, 0x83, 0xa7, 0xa2,
+    0x9e, 0xa2, 0x72, 0x39, 0xe5, 0xb2, 0x85, 0x06, 0x09, 0xf6, 0x93, 0xc6, 0xb3, 0x93, 0x93, 0xa6,
+    0x13, 0xd7, 0xa9, 0xf9, 0xa3, 0x21, 0x99, 0xd9, 0xdf, 0xf1, 0x96, 0x3a, 0xdc, 0x18, 0x65, 0x5e,
+    0x00, 0xb5, 0xc0, 0x4f, 0x3c, 0x65, 0x08, 0xb1, 0x1b, 0x10, 0x49, 0x1e, 0xb4, 0x6f, 0x94, 0xe1,
+    0xb1, 0xff, 0x14, 0xb6, 0x90, 0x38, 0x84, 0xb7, 0x23, 0x84, 0x76, 0x62, 0x23, 0xbe, 0xd8, 0xc8,
+    0xf8, 0x5c, 0x8b, 0x53, 0x6f, 0xad, 0xa3, 0xc4, 0xa2, 0x06, 0x65, 0xb0, 0x84, 0x33, 0xae, 0xde,
+    0xd6, 0x24, 0x2d, 0xdb, 0xcc, 0x2e, 0x66, 0x90, 0xa4, 0x36, 0xd2, 0xeb, 0x98, 0x5d, 0xec, 0x3a,
+    0xd0, 0xc1, 0xba, 0xbf, 0x9d, 0xa6, 0xd6, 0x77, 0x34, 0xbe, 0x7f, 0xa0, 0x18, 0xf9, 0x17, 0x64,
+    0x1f, 0x4b, 0x16, 0xf2, 0xfb, 0xdb, 0xea, 0x7e, 0x49, 0x3a, 0x00, 0xa4, 0xbe, 0x32, 0x7c, 0x88,
+    0x7a, 0x65, 0x78, 0x53, 0x6e, 0xdc, 0xb7, 0xef, 0x82, 0xdd, 0xc0, 0x3e, 0xdf, 0xb4, 0x2f, 0xd9,
+    0xd8, 0x17, 0x1f, 0xe3, 0x66, 0x29, 0x51, 0x29, 0x71, 0x91, 0x94, 0x76, 0x78, 0xbc, 0x3b, 0x59,
+    0x1d, 0x2f, 0x10, 0x56, 0x87, 0xdb, 0x55, 0xc2, 0xb9, 0xdc, 0xa4, 0x4f, 0xc2, 0x7f, 0x5e, 0xfb,
+    0xd9, 0xef, 0x11, 0xb2, 0x99, 0x92, 0xe2, 0x91, 0x92, 0x12, 0xd2, 0xee, 0x44, 0x45, 0xe1, 0xfc,
+    0x7f, 0x93, 0xd2, 0x56, 0x09, 0x6c, 0xa3, 0x56, 0x63, 0x46, 0x33, 0xd6, 0x05, 0xe3, 0xc2, 0xb3,
+    0x58, 0x8f, 0x1b, 0x65, 0x7f, 0xb0, 0x3e, 0x45, 0x36, 0x96, 0x37, 0xa9, 0xa9, 0xa7, 0xa7, 0x7f,
+    0x0a, 0xe6, 0xc2, 0x59, 0xc4, 0x0d, 0xc2, 0x7d, 0x66, 0xbc, 0xdb, 0x1b, 0x6d, 0x37, 0xbb, 0xc5,
+    0x3e, 0x67, 0x8e, 0xd2, 0x2f, 0x85, 0xc8, 0x6a, 0x99, 0x3e, 0x80, 0xb7, 0xb8, 0x87, 0x7f, 0x07,
+    0x69, 0x6d, 0x94, 0x96, 0xda, 0xfe, 0x03, 0x50, 0x9a, 0x4e, 0x4d, 0x4f, 0x89, 0x5c, 0x4e, 0x4c,
+    0x4b, 0x4d, 0x5b, 0x4c, 0x4a, 0x78, 0x4b, 0x8a, 0x48, 0x4a, 0x49, 0x48, 0x49, 0x45, 0x40, 0x47,
+    0x46, 0x45, 0x5a, 0x46, 0x6c, 0x6b, 0x6a, 0x69, 0x61, 0x5e, 0x54, 0x52, 0x48, 0x45, 0x5e, 0x5c,
+    0x5b, 0x5a, 0x59, 0x5d, 0xff, 0xff, 0x2f, 0xc4, 0x17, 0xe4, 0x03, 0xc4, 0x05, 0x10, 0xe6, 0xa7,
+    0xc7, 0x87, 0xa7, 0x67, 0xe7, 0x86, 0xc7, 0xab, 0xb3, 0xe3, 0xc5, 0x31, 0xd2, 0xc9, 0xc1, 0xc9,
+    0xb1, 0xa9, 0xb9, 0x19, 0xb5, 0xe9, 0x1a, 0xd5, 0xd0, 0xd0, 0xe0, 0xdc, 0x7f, 0x7c, 0x5b, 0x66,
+    0x66, 0x8b, 0xd5, 0x62, 0x7f, 0x28, 0xfb, 0xd8, 0xc7, 0x62, 0xc9, 0x94, 0x21, 0x23, 0x66, 0xe8,
+    0x75, 0x8c, 0x98, 0x31, 0xae, 0x61, 0x5a, 0xc1, 0xb0, 0x7e, 0x59, 0x65, 0xcd, 0xb2, 0xaa, 0xea,
+    0xa5, 0x8b, 0xaa, 0x55, 0x17, 0xd4, 0xd4, 0x51, 0x54, 0x53, 0xa0, 0x53, 0x2e, 0xa6, 0x55, 0x5c,
+    0xb6, 0x64, 0x29, 0xd5, 0xb2, 0x45, 0x71, 0xb4, 0x14, 0xcb, 0xa8, 0x1b, 0x0b, 0xe9, 0x95, 0x4d,
+    0x49, 0xd2, 0x2a, 0x2b, 0xf8, 0x37, 0x08, 0x08, 0xc0, 0x0f, 0x4e, 0x17, 0xfb, 0x62, 0x54, 0x4d,
+    0xb3, 0x8c, 0x62, 0x59, 0x55, 0x51, 0x5d, 0x4d, 0x91, 0x22, 0x1a, 0xda, 0x34, 0xa5, 0xcb, 0x27,
+    0x05, 0x8a, 0x28, 0x67, 0x94, 0x1e, 0xa1, 0x99, 0x50, 0x9c, 0x3c, 0x69, 0xe2, 0x84, 0x49, 0x13,
+    0x26, 0xa0, 0x46, 0x4b, 0x94, 0x80, 0x2a, 0x41, 0x92, 0x04, 0x49, 0xa7, 0xd1, 0xa7, 0x67, 0xa7,
+    0xe7, 0x11, 0x4e, 0x23, 0x47, 0x8a, 0x18, 0x21, 0x52, 0x84, 0xc8, 0xe6, 0x10, 0x21, 0x9b, 0x42,
+    0x80, 0x04, 0x01, 0xa2, 0x39, 0xf4, 0xc3, 0x87, 0xa6, 0x8f, 0xcc, 0x1e, 0x98, 0x3c, 0x74, 0xec,
+    0xb8, 0xd4, 0x21, 0x75, 0x79, 0x23, 0x07, 0x8e, 0x1b, 0x50, 0x38, 0x6a, 0xd8, 0x88, 0xaa, 0x31,
+    0x03, 0x88, 0x86, 0xe5, 0x8c, 0x27, 0x4b, 0xfc, 0x2b, 0x45, 0x34, 0x4a, 0x28, 0x68, 0xe7, 0xa6,
+    0xe6, 0x8d, 0x19, 0x53, 0x52, 0x51, 0x50, 0x4f, 0x01, 0x60, 0xbc, 0x80, 0x21, 0xf9, 0x82, 0xc9,
+    0x05, 0x8b, 0x16, 0x8e, 0x2c, 0x56, 0x54, 0x2e, 0xad, 0x48, 0xa1, 0xc2, 0x41, 0x0a, 0x14, 0x4a,
+    0x27, 0xf0, 0xde, 0x44, 0x52, 0x09, 0x27, 0xa6, 0x25, 0xa5, 0x24, 0xa4, 0x26, 0x11, 0x94, 0x22,
+    0x1c, 0x29, 0x8b, 0x42, 0x1c, 0x15, 0x19, 0x79, 0xe8, 0xe0, 0xc1, 0x41, 0x07, 0x4d, 0x0e, 0x44,
+    0x42, 0x43, 0x19, 0xf0, 0x32, 0x6c, 0x62, 0x08, 0x02, 0x00, 0x64, 0xa1, 0x82, 0x05, 0xc9, 0x0a,
+    0x90, 0x38, 0x14, 0x26, 0x40, 0x4a, 0x98, 0x10, 0x29, 0xe1, 0x31, 0x82, 0xe3, 0xe3, 0x1b, 0x42,
+    0xe3, 0x9b, 0xb1, 0x71, 0x91, 0x51, 0xf1, 0x81, 0x03, 0x45, 0xc3, 0x44, 0x44, 0xc3, 0x43, 0x44,
+    0xf7, 0x21, 0x61, 0x4d, 0x03, 0x3c, 0x8c, 0xb0, 0x90, 0x41, 0xa1, 0x20, 0x7b, 0x70, 0x37, 0x63,
+    0xb1, 0x6c, 0x5c, 0xbd, 0x96, 0x00, 0x98, 0xf6, 0x3b, 0x03, 0x92, 0x95, 0xcf, 0x7e, 0xe1, 0x1e,
+    0xb3, 0x37, 0xb0, 0x4c, 0xfe, 0x42, 0xbe, 0x0d, 0x09, 0xb9, 0x82, 0x68, 0x2e, 0xe0, 0x9f, 0xd8,
+    0x4f, 0xcf, 0x0e, 0x8f, 0x4f, 0x38, 0x0f, 0x2b, 0xc8, 0xfb, 0x14, 0xdc, 0x24, 0xc8, 0xb9, 0xc1,
+    0x01, 0x33, 0x40, 0x86, 0xcf, 0x00, 0xa3, 0xde, 0x5e, 0x22, 0x5e, 0xde, 0xbb, 0xc0, 0xdb, 0x3c,
+    0xf7, 0xab, 0xfb, 0x35, 0x5e, 0x60, 0xaf, 0x3c, 0x3d, 0x3a, 0x21, 0x7a, 0xbc, 0x76, 0x3c, 0x78,
+    0xd8, 0x8e, 0x37, 0xbd, 0x93, 0x83, 0xa3, 0x83, 0xcd, 0xb9, 0xb1, 0xc1, 0x61, 0xbd, 0x71, 0xb5,
+    0xf9, 0xdf, 0x62, 0x69, 0x66, 0x6a, 0x12, 0xbb, 0x5c, 0x1a, 0x47, 0x9c, 0xdb, 0xc6, 0xb7, 0xdb,
+    0x99, 0xff, 0xad, 0x76, 0x9b, 0xdd, 0xbe, 0xeb, 0x95, 0x32, 0x14, 0x5e, 0xc9, 0x8c, 0x11, 0xf3,
+    0x9a, 0x78, 0x3a, 0x26, 0x8c, 0x18, 0xd5, 0x30, 0x60, 0x58, 0x57, 0x55, 0xbd, 0xac, 0x2e, 0x76,
+    0xf1, 0xd2, 0x25, 0xf5, 0x14, 0x35, 0x15, 0x95, 0xcb, 0x15, 0x42, 0x53, 0x2e, 0x5b, 0x4a, 0x4d,
+    0x49, 0xb7, 0x68, 0x29, 0xcd, 0xa2, 0x05, 0x4b, 0x16, 0x54, 0x2c, 0x84, 0x6e, 0x37, 0xa9, 0x95,
+    0x2a, 0xa4, 0x59, 0xef, 0xa8, 0x95, 0xcf, 0x51, 0x2a, 0x52, 0xaa, 0xb4, 0x4e, 0xa1, 0x72, 0x39,
+    0x45, 0x34, 0x54, 0x0a, 0x66, 0x14, 0xd1, 0x1f, 0x26, 0xa2, 0x48, 0x86, 0x42, 0xf9, 0xe4, 0x7b,
+    0x02, 0xc5, 0x89, 0x92, 0x27, 0x40, 0x9a, 0x38, 0x81, 0x6c, 0xb2, 0x84, 0x89, 0xe2, 0x12, 0xd0,
+    0x24, 0x4a, 0x1a, 0x41, 0x91, 0x24, 0x39, 0x44, 0xe2, 0x79, 0xd9, 0xe9, 0xc9, 0xd9, 0x79, 0x84,
+    0xd3, 0xc8, 0x91, 0x22, 0x3e, 0x8c, 0x10, 0x19, 0x52, 0x84, 0x88, 0x90, 0xcd, 0x21, 0x42, 0x82,
+    0x6c, 0x02, 0x09, 0xf2, 0x0f, 0xe4, 0x87, 0x66, 0x0f, 0x1f, 0x9a, 0x99, 0x3c, 0x7a, 0x64, 0x62,
+    0xf2, 0xd8, 0x81, 0xd9, 0xba, 0x43, 0x47, 0x0e, 0x13, 0x38, 0x72, 0xdc, 0xc0, 0x61, 0xe3, 0x46,
+    0x0d, 0x1b, 0x34, 0x5a, 0xd4, 0xb0, 0x9c, 0x41, 0x43, 0xd1, 0x52, 0x46, 0x8c, 0x19, 0x90, 0x32,
+    0x60, 0xc4, 0x78, 0x01, 0xc3, 0xc5, 0x0b, 0x17, 0x2c, 0x2a, 0x5b, 0x1c, 0xb2, 0x58, 0xa1, 0xa2,
+    0xb2, 0x71, 0x45, 0x0a, 0x15, 0x28, 0x52, 0x9c, 0x40, 0x71, 0xa2, 0x84, 0x24, 0x89, 0x12, 0x3f,
+    0xfa, 0x46, 0x90, 0xc0, 0x42, 0x8a, 0x18, 0x81, 0x49, 0x29, 0x22, 0x84, 0x06, 0xca, 0x44, 0x10,
+    0x1f, 0x42, 0x28, 0x82, 0xf0, 0xd0, 0xe1, 0x03, 0xa4, 0x07, 0x0e, 0x1d, 0x36, 0x70, 0xd8, 0xbc,
+    0xdb, 0x90, 0x01, 0x83, 0x86, 0xc3, 0x0c, 0x17, 0x26, 0x31, 0x34, 0x5e, 0x70, 0x5b, 0x98, 0x7c,
+    0xbc, 0x0a, 0x16, 0x36, 0xa3, 0x2a, 0x50, 0x80, 0x9c, 0x40, 0x41, 0xc2, 0x84, 0x48, 0x09, 0x77,
+    0x91, 0x11, 0x1a, 0xdb, 0x8f, 0x11, 0x54, 0x38, 0x3e, 0x7a, 0x21, 0x38, 0x42, 0x60, 0x54, 0x5c,
+    0x64, 0x7c, 0x2f, 0x3e, 0xe6, 0x83, 0xf7, 0x03, 0x07, 0x87, 0xad, 0x8f, 0x75, 0xc0, 0xfd, 0x3e,
+    0xc4, 0x44, 0x44, 0x43, 0xb7, 0x61, 0x03, 0xf7, 0x22, 0x83, 0x06, 0x2e, 0xcc, 0x0c, 0x0a, 0x09,
+    0xdb, 0x77, 0xed, 0xc1, 0xc2, 0x41, 0x36, 0x61, 0xeb, 0x9a, 0x0d, 0x5e, 0x61, 0x5e, 0xab, 0xd3,
+    0x51, 0x6a, 0x41, 0x73, 0x24, 0x5a, 0x70, 0x3f, 0xa3, 0x57, 0xcf, 0xe5, 0x3b, 0xbd, 0x32, 0x5f,
+    0xe0, 0x82, 0x40, 0xf2, 0x02, 0xc0, 0x3f, 0x32, 0xa0, 0x1f, 0x9f, 0xae, 0x37, 0x0e, 0x9f, 0xe9,
+    0xf9, 0x58, 0x1c, 0x16, 0x2b, 0x48, 0x10, 0x8f, 0x7d, 0xb0, 0x16, 0x95, 0x2e, 0xbc, 0x2d, 0x28,
+    0x59, 0xac, 0x48, 0x51, 0xd9, 0xba, 0x82, 0x83, 0x0a, 0x14, 0x26, 0x52, 0x00, 0xc1, 0x3c, 0x81,
+    0x62, 0xf2, 0xc4, 0x04, 0x13, 0x25, 0x28, 0xfb, 0x48, 0x94, 0x50, 0x31, 0x82, 0x84, 0x57, 0xc4,
+    0x08, 0x11, 0x21, 0x38, 0x80, 0x08, 0xf1, 0x01, 0x84, 0x87, 0x0f, 0xad, 0x1d, 0x3c, 0x74, 0xd8,
+    0x30, 0xa9, 0x61, 0x43, 0x06, 0x0d, 0x18, 0x32, 0x5c, 0xc0, 0x50, 0x77, 0xa1, 0x82, 0x85, 0x1f,
+    0x6e, 0xc9, 0x0a, 0x9a, 0x78, 0x14, 0x24, 0xeb, 0x28, 0xe0, 0x5f, 0x4a, 0x0e, 0x93, 0xd9, 0x09,
+    0x77, 0x75, 0x5d, 0x3b, 0x30, 0xc8, 0x29, 0xc8, 0xc5, 0x47, 0x08, 0x8c, 0x57, 0x8f, 0x8e, 0x10,
+    0x1c, 0x1b, 0x19, 0x1b, 0xdf, 0x8b, 0xef, 0x07, 0x8b, 0x90, 0x8a, 0x0f, 0x14, 0x0b, 0x13, 0x11,
+    0xdd, 0x0d, 0x04, 0x24, 0x32, 0x40, 0x3c, 0x74, 0x1f, 0x1a, 0x36, 0x30, 0x6c, 0x17, 0xb6, 0x09,
+    0x0b, 0x23, 0x07, 0x09, 0x07, 0xcf, 0x6b, 0xb5, 0x60, 0xd7, 0x9a, 0xfb, 0x61, 0xea, 0xb4, 0x60,
+    0x1a, 0xbd, 0xa3, 0xcd, 0x67, 0x73, 0xf9, 0xbc, 0x18, 0x58, 0x0e, 0x54, 0x40, 0xfe, 0xd3, 0xc5,
+    0x01, 0xc8, 0x0f, 0xf8, 0x57, 0x07, 0xe8, 0xa7, 0xcb, 0xf9, 0x8d, 0xc5, 0x53, 0xe3, 0x70, 0xfe,
+    0x25, 0xdc, 0xa7, 0xa0, 0x2f, 0x81, 0x82, 0x56, 0x3d, 0x04, 0x6d, 0x79, 0x09, 0xf6, 0xfe, 0x00,
+    0x02, 0x03, 0x7c, 0x07, 0x72, 0xf8, 0xf4, 0xf6, 0xf4, 0xf2, 0xf6, 0xdc, 0x78, 0x79, 0x6f, 0x78,
+    0x05, 0xea, 0xee, 0x0a, 0xb4, 0xda, 0xdd, 0xd9, 0x3d, 0x1d, 0x01, 0xcc, 0x39, 0xba, 0xb9, 0xb8,
+    0x37, 0xb8, 0x01, 0x71, 0x03, 0xda, 0xc0, 0xa6, 0x60, 0x9c, 0xad, 0x8d, 0x6d, 0xad, 0x4d, 0x6d,
+    0xad, 0x4f, 0x0d, 0x2d, 0x6d, 0x0a, 0x0d, 0xc7, 0x1a, 0x1b, 0x3b, 0x2b, 0xfb, 0xb2, 0x9d, 0x99,
+    0x95, 0xc9, 0x99, 0x91, 0x7d, 0xc9, 0xc8, 0xc4, 0xc6, 0xc4, 0x04, 0x8c, 0xcd, 0x09, 0x00, 0x87,
+    0x61, 0x81, 0x7d, 0x75, 0x81, 0x71, 0x7d, 0x79, 0x75, 0x79, 0x6d, 0x65, 0x71, 0x69, 0x69, 0x6d,
+    0x65, 0x5d, 0x85, 0x5d, 0x59, 0x61, 0x55, 0x59, 0x51, 0x55, 0x51, 0x4d, 0x09, 0x49, 0xf1, 0x48,
+    0xe1, 0x48, 0x50, 0xff, 0x50, 0x4c, 0x4f, 0x4e, 0x4d, 0x64, 0x4e, 0x4b, 0x49, 0x4c, 0x8e, 0x4a,
+    0x4a, 0x4b, 0x0f, 0x97, 0x34, 0x76, 0x84, 0x74, 0x64, 0x84, 0x54, 0x64, 0x54, 0x49, 0x34, 0x54,
+    0x84, 0x0f, 0x05, 0x09, 0x05, 0x01, 0x65, 0x85, 0x1e, 0xe8, 0xc7, 0x07, 0x40, 0x8e, 0x4f, 0x0f,
+    0x8f, 0x69, 0xcf, 0x4e, 0x8e, 0x57, 0x67, 0x47, 0x93, 0x8c, 0x0e, 0x0e, 0x7e, 0x83, 0x63, 0x73,
+    0x53, 0x43, 0x63, 0x53, 0xd3, 0xe5, 0xd2, 0x70, 0x67, 0xc8, 0xcc, 0x68, 0xb7, 0x59, 0xac, 0x36,
+    0x9b, 0xfd, 0x2c, 0xb6, 0xcc, 0xeb, 0x97, 0x31, 0xaf, 0x62, 0xc6, 0x84, 0x71, 0x15, 0x13, 0x06,
+    0x4c, 0xab, 0x6b, 0x69, 0x2b, 0xab, 0xe9, 0x2a, 0xab, 0x97, 0xd4, 0xd5, 0x2e, 0xaa, 0x5e, 0xe2,
+    0xba, 0x94, 0xaa, 0x6e, 0xf9, 0x87, 0xc0, 0x88, 0xe8, 0x6e, 0xa0, 0x16, 0xdc, 0xff, 0x74, 0x71,
+    0x5e, 0x27, 0xf7, 0x56, 0xf6, 0xfd, 0xea, 0x9a, 0xe2, 0x3e, 0x7d, 0x9b, 0x78, 0x72, 0xb2, 0x38,
+    0x99, 0x2f, 0xa6, 0xdc, 0x52, 0x02, 0x73, 0x6e, 0x72, 0xdc, 0x38, 0xb8, 0xef, 0x00, 0xee, 0x1b,
+    0x1d, 0x96, 0x50, 0x2c, 0xa2, 0xdf, 0xbe, 0x22, 0x4a, 0x1a, 0x6a, 0xc5, 0x87, 0x74, 0xd4, 0x4a,
+    0x15, 0x29, 0xa3, 0x5e, 0x3a, 0x2a, 0x55, 0xa6, 0x50, 0x71, 0x4f, 0xe1, 0x9e, 0x49, 0x89, 0x72,
+    0x25, 0x0a, 0x14, 0xd1, 0xd6, 0x27, 0x4d, 0xa0, 0xbc, 0x9d, 0x3c, 0x89, 0xe1, 0x84, 0x89, 0x92,
+    0x26, 0x28, 0x96, 0x30, 0x79, 0x21, 0x63, 0xc9, 0x17, 0x54, 0x49, 0x12, 0xd0, 0x4f, 0xcf, 0x24,
+    0x48, 0x8e, 0xc8, 0xb0, 0x71, 0xe4, 0x8b, 0xc3, 0x48, 0x91, 0x4d, 0x23, 0x89, 0x44, 0x8a, 0x0c,
+    0x11, 0x42, 0xe4, 0x2d, 0x24, 0xc8, 0x26, 0x90, 0x20, 0x40, 0x7e, 0xe0, 0x70, 0xf5, 0x61, 0x43,
+    0x53, 0x87, 0x0f, 0x9d, 0x1e, 0x9a, 0x99, 0x3c, 0x7a, 0x60, 0xee, 0xe0, 0xa1, 0x88, 0x79, 0xa9,
+    0x43, 0xc7, 0x30, 0xc7, 0xa5, 0x5a, 0x8e, 0x1f, 0x37, 0x6a, 0x60, 0x71, 0x7c, 0x0d, 0xb0, 0xe5,
+    0x0c, 0x1a, 0x95, 0x33, 0x60, 0x54, 0xbe, 0x70, 0x01, 0xa3, 0x05, 0x0b, 0x17, 0x9a, 0x6b, 0x2c,
+    0xac, 0xec, 0x84, 0xda, 0x90, 0x11, 0xa3, 0xb2, 0x6d, 0x8d, 0xab, 0xf6, 0x4d, 0x63, 0x4b, 0x81,
+    0x22, 0x85, 0x09, 0x14, 0x25, 0x48, 0x98, 0x98, 0x2c, 0x31, 0x42, 0x04, 0x89, 0x07, 0x23, 0x1e,
+    0x45, 0x74, 0x98, 0xe4, 0xa0, 0xa1, 0xc3, 0x06, 0x0e, 0xed, 0x0d, 0x19, 0x30, 0x68, 0xb8, 0x80,
+    0xc1, 0xec, 0x02, 0xf7, 0xcc, 0xc2, 0x63, 0x05, 0x49, 0x0b, 0xec, 0x0a, 0x14, 0x26, 0x48, 0x4a,
+    0x88, 0x9c, 0x90, 0x58, 0x28, 0x01, 0x32, 0x42, 0xe4, 0xfb, 0x30, 0x82, 0xe3, 0x03, 0xc5, 0x43,
+    0xb7, 0x03, 0xc5, 0x44, 0x44, 0x07, 0x88, 0xee, 0xc2, 0x48, 0x43, 0xf7, 0x66, 0x03, 0x06, 0x86,
+    0x9a, 0x0c, 0xda, 0x6c, 0xc2, 0x76, 0xd9, 0xe0, 0xe4, 0xe3, 0x83, 0xc3, 0x42, 0x36, 0x9a, 0xd9,
+    0xb7, 0x8c, 0xec, 0x2c, 0x2d, 0x88, 0xde, 0xcf, 0x69, 0x41, 0x33, 0x3a, 0xdf, 0x0b, 0x9c, 0xcb,
+    0x63, 0x73, 0x60, 0x79, 0x01, 0x39, 0x70, 0x01, 0xe0, 0x1f, 0x19, 0x50, 0xff, 0xf3, 0xd3, 0xfd,
+    0xc2, 0x46, 0x63, 0x71, 0x58, 0xac, 0x40, 0x2f, 0xef, 0x53, 0x90, 0x00, 0x41, 0x5f, 0x82, 0x03,
+    0x06, 0x10, 0x1c, 0xd8, 0x33, 0xc0, 0xb7, 0xc7, 0x87, 0x37, 0xa4, 0x97, 0x87, 0x97, 0x77, 0x07,
+    0x57, 0x40, 0xd1, 0xee, 0xae, 0x8e, 0x80, 0x5d, 0x58, 0x1d, 0xdd, 0x1c, 0x01, 0x30, 0xba, 0xb8,
+    0x39, 0xb9, 0x38, 0xb9, 0x37, 0xb8, 0x01, 0x6f, 0x5f, 0x03, 0x04, 0xd1, 0xfb, 0x59, 0x0f, 0xef,
+    0xe1, 0xc5, 0xbd, 0x89, 0x85, 0x81, 0x7d, 0x09, 0x68, 0x63, 0x5b, 0x53, 0x4b, 0x6b, 0x63, 0x43,
+    0x5b, 0xeb, 0x52, 0x8b, 0x4a, 0x3b, 0x03, 0x43, 0x33, 0x3b, 0x2b, 0x23, 0x33, 0x2b, 0xfb, 0x8e,
+    0x91, 0x7d, 0xc5, 0xc6, 0xc2, 0xc4, 0x04, 0x84, 0x09, 0xf0, 0x32, 0x02, 0xfb, 0xf2, 0xfa, 0xe2,
+    0x9a, 0xea, 0xda, 0xe2, 0xd2, 0xca, 0xda, 0xd2, 0xc2, 0xba, 0xca, 0xc2, 0xb2, 0xba, 0xa2, 0xb2,
+    0xaa, 0xa2, 0xaa, 0x92, 0x1a, 0x9a, 0x0a, 0x20, 0x15, 0x00, 0xea, 0x28, 0x2a, 0xf3, 0x29, 0x8c,
+    0xca, 0xa8, 0xb4, 0xe2, 0xfa, 0x4b, 0x50, 0x23, 0x00, 0x08, 0x00, 0x68, 0x00, 0x33, 0x6a, 0x01,
+    0x83, 0xd3, 0x30, 0x75, 0xf2, 0x0a, 0x14, 0x0e, 0x21, 0xc2, 0x80, 0x4b, 0x21, 0x40, 0x78, 0x01,
+    0x00, 0x39, 0x02, 0x2b, 0x06, 0x13, 0xdd, 0x55, 0x78, 0xab, 0x91, 0xb6, 0x72, 0x74, 0xc3, 0xcf,
+    0x77, 0x7f, 0xed, 0xc9, 0xc1, 0x94, 0x0f, 0xcb, 0x26, 0xe2, 0x4b, 0x68, 0x81, 0xe8, 0x9d, 0xf6,
+    0x24, 0xb9, 0x90, 0x58, 0xee, 0x41, 0x2c, 0x59, 0x2c, 0xcc, 0x9b, 0xa6, 0x9d, 0x30, 0x5e, 0x2e,
+    0xbe, 0xb3, 0xee, 0x48, 0x8f, 0xdf, 0x77, 0x56, 0x2c, 0x46, 0x3f, 0x50, 0x04, 0xc9, 0x77, 0x3b,
+    0xfe, 0xa1, 0xf0, 0x05, 0x9c, 0x32, 0x02, 0xc7, 0x9f, 0xb0, 0x0e, 0x79, 0x45, 0x9c, 0x63, 0x71,
+    0xd7, 0x6a, 0xd0, 0x7e, 0x07, 0x9e, 0xdb, 0x81, 0xef, 0x2d, 0x8c, 0xed, 0x1b, 0xe3, 0x26, 0x02,
+    0x13, 0x25, 0x56, 0x58, 0xb9, 0x9a, 0x95, 0x85, 0xa7, 0x5d, 0xfe, 0xcc, 0x43, 0x6e, 0xba, 0xf9,
+    0x18, 0x91, 0x9f, 0x95, 0xa1, 0x67, 0x0a, 0x19, 0xee, 0x35, 0x87, 0x79, 0x68, 0xf7, 0x8c, 0x91,
+    0x0d, 0x93, 0xb8, 0x89, 0xac, 0x7c, 0x12, 0x0c, 0xb8, 0x9c, 0x97, 0xe7, 0x4e, 0xae, 0x28, 0x0e,
+    0xf5, 0x0b, 0x88, 0x58, 0x4c, 0x76, 0xec, 0x20, 0xef, 0xce, 0x12, 0xc1, 0xf6, 0x65, 0x2c, 0xa2,
+    0xd5, 0xce, 0xa0, 0x43, 0x40, 0xd4, 0xae, 0xe3, 0x60, 0xc5, 0x91, 0x37, 0xf2, 0xc5, 0x25, 0x30,
+    0xc3, 0x4b, 0xf5, 0x59, 0x4b, 0x8b, 0x0d, 0x08, 0xb3, 0x87, 0xb1, 0x8c, 0xfd, 0x3c, 0xf2, 0x68,
+    0x7c, 0x7f, 0x24, 0x57, 0xae, 0x6f, 0xc9, 0x74, 0x3a, 0x76, 0xfb, 0x2a, 0x16, 0xa0, 0x70, 0x64,
+    0x5b, 0xd5, 0x13, 0x9f, 0x9b, 0x49, 0xc6, 0xd9, 0xd5, 0x02, 0xe1, 0x11, 0xc0, 0xcf, 0xfb, 0xa2,
+    0xdd, 0xfe, 0xbe, 0x6e, 0x96, 0x22, 0xfa, 0x91, 0xe6, 0xfb, 0xb9, 0x33, 0x6e, 0xdb, 0x62, 0x0e,
+    0x82, 0xc5, 0xfb, 0x3d, 0x22, 0xc0, 0x44, 0x85, 0x3e, 0x48, 0xff, 0x6b, 0xdf, 0x81, 0x28, 0x5c,
+    0xe8, 0xb7, 0x59, 0xf4, 0xf3, 0x9c, 0x76, 0x84, 0xf3, 0x3a, 0xf5, 0x06, 0x87, 0x43, 0xbf, 0xd7,
+    0x5f, 0xe2, 0xee, 0x2c, 0xb2, 0x3a, 0x94, 0x9f, 0x37, 0x14, 0x02, 0x80, 0xa6, 0x3c, 0xfe, 0xb4,
+    0x38, 0xfd, 0x33, 0x72, 0x4a, 0x38, 0x3b, 0x8a, 0x0b, 0xe1, 0x3f, 0x4e, 0x7b, 0xd2, 0xc9, 0x16,
+    0xc8, 0x80, 0x57, 0x09, 0x1d, 0xb5, 0xea, 0x93, 0xd5, 0x0b, 0xbe, 0x27, 0xf7, 0x77, 0x27, 0x64,
+    0x15, 0x0a, 0xcf, 0x11, 0x27, 0xb8, 0x7f, 0xed, 0x0f, 0x35, 0xc7, 0x43, 0xa4, 0xec, 0x17, 0x12,
+    0xf7, 0xf0, 0x78, 0xe8, 0xdd, 0x97, 0xce, 0xd8, 0xea, 0x5f, 0xfd, 0x05, 0xe7, 0x99, 0x4e, 0x4c,
+    0xff, 0xd7, 0x20, 0xce, 0x71, 0x57, 0x21, 0xfe, 0x3e, 0xc3, 0x47, 0x5f, 0x53, 0xac, 0xe7, 0xed,
+    0xc6, 0xf8, 0x28, 0xe2, 0x3d, 0xba, 0x47, 0xfa, 0x06, 0xe2, 0x66, 0x2a, 0x3c, 0xa7, 0x4d, 0x34,
+    0x4a, 0xe8, 0x03, 0xff, 0xc4, 0xb3, 0x19, 0x63, 0x0f, 0x51, 0xad, 0xcc, 0xfe, 0x7d, 0xef, 0xfa,
+    0x40, 0xa1, 0x6b, 0x31, 0x65, 0xec, 0x97, 0xf1, 0x1f, 0xb4, 0x91, 0xf5, 0x83, 0x33, 0x70, 0x66,
+    0xa0, 0x65, 0x36, 0xfe, 0xe4, 0x2f, 0xfa, 0xfb, 0x50, 0xbd, 0xe0, 0xdc, 0x66, 0x7a, 0x6d, 0xb6,
+    0xf2, 0x21, 0xcc, 0x63, 0x1e, 0x18, 0xf9, 0x6c, 0x21, 0x66, 0xfc, 0xdd, 0xf6, 0xf2, 0x59, 0x17,
+    0xe7, 0x4d, 0xc0, 0x7b, 0x7a, 0x40, 0x06, 0xfc, 0xcd, 0xbc, 0x5d, 0x07, 0x6b, 0xbd, 0xe6, 0x27,
+    0xaf, 0xe7, 0x49, 0x45, 0xfb, 0xc0, 0x77, 0xd7, 0x5c, 0xb6, 0xc9, 0xfa, 0x87, 0x2e, 0x13, 0x0d,
+    0x8d, 0x97, 0xee, 0x8f, 0xea, 0xee, 0xf4, 0x03, 0xd0, 0xec, 0x0f, 0xab, 0x97, 0x09, 0x7f, 0x67,
+    0x4f, 0x8c, 0x0f, 0xf6, 0x3d, 0xd3, 0x3a, 0xe1, 0xab, 0xf6, 0x5c, 0x03, 0xdc, 0x55, 0xdf, 0x80,
+    0xdc, 0xee, 0x2c, 0xbd, 0xca, 0xb9, 0x94, 0xfd, 0x7a, 0x07, 0xf7, 0xd9, 0xa0, 0x38, 0x87, 0xdf,
+    0x49, 0x2e, 0xe3, 0xfc, 0x79, 0x54, 0x74, 0x4f, 0x9b, 0xa6, 0x5f, 0xb9, 0x82, 0x7f, 0x31, 0xca,
+    0xed, 0x64, 0xab, 0xc0, 0xef, 0x75, 0x49, 0x68, 0xf0, 0xd8, 0x63, 0x47, 0x15, 0x73, 0x0f, 0x1b,
+    0xea, 0x3c, 0xcb, 0xf9, 0xe6, 0x5e, 0x66, 0x51, 0x34, 0xc7, 0xb1, 0xdd, 0x75, 0x48, 0xce, 0xff,
+    0xff, 0x5c, 0x4a, 0x3e, 0x67, 0xb9, 0xef, 0x81, 0xfa, 0x74, 0xb3, 0x8c, 0x05, 0x45, 0xa7, 0x81,
+    0x1a, 0x6d, 0xe6, 0x59, 0xa8, 0xee, 0xbe, 0x7e, 0xa8, 0xd8, 0x4f, 0xba, 0x98, 0xc2, 0xf9, 0x45,
+    0x99, 0x9a, 0x83, 0x63, 0xeb, 0x90, 0x7b, 0x88, 0xda, 0x60, 0xbc, 0xd3, 0x07, 0x48, 0x9e, 0xdf,
+    0x6e, 0x1e, 0x01, 0x7d, 0x72, 0x34, 0xf6, 0x6e, 0x6e, 0x1f, 0x78, 0xf3, 0x2e, 0x73, 0xf5, 0x7e,
+    0xe7, 0xcf, 0xfb, 0x74, 0x9d, 0x65, 0x4b, 0x02, 0x5a, 0x64, 0x26, 0xd6, 0x9f, 0xa1, 0xe7, 0x49,
+    0x3d, 0x9e, 0xdd, 0x62, 0x9f, 0x3b, 0xcc, 0xa2, 0x86, 0xb1, 0x78, 0xe7, 0xae, 0x8e, 0xe3, 0x5a,
+    0x0a, 0xc3, 0x67, 0x63, 0x8d, 0x4c, 0x04, 0x30, 0x37, 0xe3, 0x27, 0x45, 0x2b, 0x17, 0x67, 0xdc,
+    0x9e, 0x9f, 0x3b, 0x4d, 0x10, 0x77, 0x98, 0xc4, 0x1e, 0x8d, 0x37, 0x01, 0xd4, 0xcf, 0xa6, 0x0f,
+    0x61, 0xea, 0xcc, 0xd1, 0x89, 0x9a, 0x10, 0x79, 0xa7, 0xff, 0x7c, 0x54, 0x4f, 0xb2, 0xf0, 0x43,
+    0x7f, 0x22, 0x26, 0xff, 0xf7, 0x10, 0xf4, 0xc4, 0x57, 0xbf, 0xe3, 0xe7, 0xef, 0xcc, 0x21, 0xfa,
+    0x7d, 0x0a, 0x4c, 0x7c, 0x34, 0x36, 0xa0, 0x7a, 0x14, 0xc4, 0xd3, 0x02, 0x81, 0xbd, 0x9d, 0x6f,
+    0x47, 0xf3, 0x56, 0xf8, 0x44, 0xae, 0xfc, 0x75, 0x80, 0x4c, 0xf7, 0x79, 0x9c, 0x9f, 0x13, 0x6f,
+    0xf7, 0x63, 0xac, 0x1c, 0x35, 0x3e, 0x65, 0xbf, 0x0f, 0x78, 0x6d, 0x23, 0x69, 0x30, 0x22, 0xdc,
+    0xf2, 0x40, 0xd0, 0x1b, 0x74, 0xe1, 0xc2, 0xe7, 0x3f, 0x4f, 0x63, 0x49, 0xdb, 0xd2, 0xe1, 0x02,
+    0xd7, 0xf7, 0x2e, 0xec, 0xc9, 0x70, 0x3f, 0xcf, 0xae, 0xac, 0x27, 0xb0, 0xc2, 0x16, 0xe2, 0x1a,
+    0x92, 0x8f, 0xee, 0x9e, 0xa3, 0x5e, 0x6e, 0xa0, 0xec, 0x9d, 0x16, 0x30, 0x9f, 0x42, 0x9f, 0x2e,
+    0xe6, 0xdd, 0x7e, 0x3c, 0xc2, 0x1c, 0x9b, 0xc7, 0x00, 0x3e, 0x5e, 0x4f, 0xe3, 0xef, 0xb1, 0x03,
+    0xef, 0xbe, 0x35, 0x1b, 0x95, 0x14, 0xe7, 0x94, 0x70, 0xc6, 0x7c, 0xda, 0x01, 0x78, 0xf5, 0x5d,
+    0x3e, 0xdd, 0xeb, 0x4a, 0x62, 0x37, 0xc9, 0x1a, 0x66, 0x9d, 0x2c, 0x4f, 0xde, 0xd7, 0xc5, 0xf4,
+    0xcb, 0xf6, 0x2b, 0x25, 0xc2, 0x62, 0x65, 0xec, 0x9d, 0x9d, 0xd3, 0xe3, 0x96, 0xe2, 0x6a, 0xe6,
+    0x06, 0xe7, 0xfa, 0xa5, 0x4c, 0x4c, 0x3e, 0x95, 0xb0, 0x73, 0x91, 0x3e, 0x1e, 0x96, 0xe4, 0x57,
+    0x83, 0xb3, 0xbb, 0x91, 0xf3, 0xeb, 0x67, 0xb7, 0xe8, 0xcd, 0xf5, 0x74, 0xf3, 0x92, 0xc3, 0x47,
+    0xc7, 0x61, 0xd8, 0x5f, 0x3a, 0x3b, 0xfd, 0x0c, 0xef, 0x00, 0x7b, 0xb2, 0xc7, 0x86, 0x70, 0x8f,
+    0x4d, 0x7f, 0xb8, 0x6c, 0x47, 0x0d, 0xff, 0x08, 0x70, 0x81, 0xfc, 0xa1, 0xb3, 0xe6, 0x09, 0xf8,
+    0x60, 0x3c, 0xaf, 0x3d, 0x1a, 0x27, 0x63, 0x30, 0x9e, 0xe3, 0x63, 0x31, 0xf4, 0x44, 0x41, 0xda,
+    0x42, 0x5f, 0xa7, 0xc1, 0x6b, 0xbf, 0x33, 0xb5, 0xb8, 0xa1, 0x6e, 0xd2, 0xb0, 0x75, 0x6d, 0x71,
+    0xf3, 0x90, 0x6f, 0x49, 0x3f, 0xd9, 0xcc, 0x66, 0x88, 0x06, 0xd9, 0x0e, 0xc8, 0x92, 0x4d, 0xd4,
+    0xd8, 0xbc, 0xcb, 0x6c, 0xe7, 0x42, 0x77, 0x1f, 0xb7, 0x36, 0x99, 0xb3, 0x63, 0x8f, 0x5c, 0xad,
+    0x47, 0x37, 0x13, 0x21, 0xd8, 0xfd, 0x2d, 0x13, 0x7d, 0x39, 0x0e, 0xf3, 0xb6, 0xc4, 0x1f, 0x0d,
+    0x95, 0xcc, 0xda, 0x1d, 0xec, 0xfb, 0x69, 0x33, 0xb1, 0xbe, 0xe5, 0xdf, 0x4a, 0x24, 0x7e, 0x46,
+    0x4e, 0xc1, 0x3f, 0x9a, 0xb8, 0xa5, 0x80, 0x41, 0x00, 0x1f, 0xd9, 0x21, 0x81, 0x1e, 0x4c, 0x2f,
+    0x43, 0x61, 0x08, 0xff, 0xec, 0xb5, 0xf9, 0x97, 0x93, 0xcc, 0x60, 0x61, 0x73, 0xff, 0x8c, 0xd5,
+    0x87, 0xd9, 0x40, 0xf1, 0x5f, 0x2f, 0x27, 0xf5, 0x12, 0x19, 0x29, 0xed, 0xa4, 0x91, 0x25, 0xb3,
+    0xf6, 0x1f, 0x84, 0x39, 0xf3, 0x7c, 0x42, 0xb9, 0x6e, 0x37, 0xa6, 0x27, 0xf9, 0x0b, 0x01, 0x70,
+    0x60, 0x21, 0xce, 0x04, 0x93, 0x42, 0x51, 0x52, 0xd2, 0x27, 0x1b, 0x85, 0xff, 0x28, 0x57, 0x95,
+    0x2f, 0x68, 0xc7, 0xb1, 0xaf, 0x9f, 0x1b, 0xa1, 0x47, 0xfe, 0x8e, 0x65, 0x45, 0xd3, 0x89, 0x6c,
+    0xdc, 0xe3, 0xf9, 0xf5, 0xce, 0x7e, 0x24, 0xc9, 0x4e, 0x0c, 0x9c, 0x98, 0x9e, 0x41, 0x5b, 0x0b,
+    0x30, 0xf6, 0x18, 0xea, 0x2c, 0x7a, 0xe1, 0xdd, 0xba, 0x83, 0xcd, 0xc3, 0xec, 0xa8, 0x26, 0x4b,
+    0xf2, 0xf6, 0xc1, 0x39, 0x22, 0xda, 0x19, 0x2d, 0xe7, 0x2d, 0x0e, 0xfa, 0x0b, 0x08, 0x1a, 0x1c,
+    0x60, 0xdc, 0xf9, 0xa7, 0xa6, 0x1d, 0x49, 0x6d, 0x15, 0x5c, 0x43, 0x6a, 0x40, 0x37, 0x7b, 0xc7,
+    0x4f, 0x28, 0xb6, 0xb3, 0xc2, 0x5d, 0x57, 0xac, 0xeb, 0x26, 0x9e, 0xef, 0xeb, 0x3d, 0x2d, 0x4c,
+    0x44, 0x32, 0xf8, 0x91, 0xf5, 0xc7, 0x03, 0xfb, 0x28, 0xec, 0x26, 0xc4, 0x64, 0xf1, 0xd5, 0xab,
+    0x9f, 0xff, 0x2f, 0x98, 0xab, 0x12, 0x7a, 0x02, 0x9c, 0x91, 0x47, 0x7e, 0x8c, 0x48, 0xb1, 0x06,
+    0x8d, 0x0a, 0xbe, 0x1d, 0xf7, 0xb8, 0x19, 0xdf, 0x9a, 0x32, 0xd2, 0x8b, 0x2b, 0xd7, 0xd8, 0x8e,
+    0x09, 0x1e, 0x2c, 0x54, 0xf4, 0xc0, 0xd3, 0x24, 0x53, 0xce, 0xf0, 0xa6, 0xbe, 0x65, 0xf4, 0x6c,
+    0x95, 0x3e, 0xff, 0x50, 0xb0, 0xc3, 0x68, 0x5f, 0x8f, 0xd6, 0x59, 0xa8, 0x1c, 0x38, 0xf0, 0x21,
+    0xb3, 0x79, 0x14, 0xc8, 0xd0, 0xfa, 0x84, 0xff, 0x7e, 0xeb, 0xf1, 0x59, 0xf4, 0xd3, 0x68, 0x5c,
+    0x10, 0xdc, 0xf7, 0x21, 0x4f, 0x7e, 0xd8, 0xe5, 0x13, 0xdf, 0x2d, 0x29, 0xcd, 0x0e, 0x5b, 0x72,
+    0xce, 0xc8, 0x03, 0x81, 0x84, 0xb5, 0x22, 0x72, 0xb2, 0xfe, 0x68, 0xae, 0x03, 0x06, 0xf2, 0xbb,
+    0xab, 0xac, 0xdf, 0xfb, 0xfe, 0x26, 0x93, 0x9b, 0xce, 0x6e, 0x24, 0x14, 0xe6, 0xd7, 0x73, 0x8b,
+    0xa5, 0x25, 0xb4, 0x5f, 0xff, 0x81, 0xf8, 0xee, 0x1a, 0x32, 0xe6, 0x35, 0x13, 0x73, 0x58, 0xd2,
+    0xee, 0x56, 0xf7, 0xd5, 0x3d, 0x16, 0xb1, 0x95, 0x41, 0x87, 0xa0, 0xc1, 0xe2, 0xcb, 0x3b, 0x0f,
+    0xc8, 0x3a, 0xb3, 0xfc, 0x13, 0xfa, 0x3f, 0x81, 0xd2, 0xa9, 0xa0, 0x6c, 0x50, 0xcf, 0x5a, 0x5b,
+    0xf6, 0x75, 0xfa, 0xa7, 0x8e, 0xf8, 0x73, 0x5a, 0xf4, 0xe8, 0xbf, 0xe5, 0x0b, 0x1f, 0xd9, 0x85,
+    0xfb, 0xde, 0xe8, 0x07, 0xca, 0xdc, 0x77, 0x71, 0x40, 0x00, 0x3e, 0x88, 0xc2, 0x39, 0x34, 0xa7,
+    0xba, 0xfc, 0xe5, 0x93, 0xe2, 0x1d, 0xd8, 0x91, 0x18, 0xac, 0x96, 0xd7, 0xbd, 0x39, 0x0e, 0x43,
+    0xd5, 0xe9, 0xfd, 0x9e, 0xc1, 0x02, 0xdc, 0xcb, 0xa9, 0x53, 0x7a, 0xfd, 0x71, 0x1e, 0x17, 0xe0,
+    0x7c, 0x58, 0x2d, 0x98, 0xf4, 0x81, 0xae, 0x73, 0xa0, 0x91, 0xdf, 0xd4, 0x36, 0x98, 0xf0, 0x8f,
+    0x8f, 0xd4, 0x86, 0xb6, 0xdc, 0x02, 0x9a, 0x05, 0x62, 0x3c, 0xb8, 0x0f, 0x07, 0x21, 0x9c, 0x6c,
+    0xc7, 0x7a, 0xee, 0xff, 0xbf, 0x87, 0xc3, 0x64, 0xfe, 0xe9, 0xc3, 0xce, 0xfc, 0xf9, 0x74, 0x2b,
+    0x93, 0x6e, 0x18, 0x44, 0x30, 0xfc, 0x1c, 0x3c, 0xc1, 0x33, 0xf5, 0xae, 0xe1, 0xef, 0x42, 0x7b,
+    0x4f, 0x5d, 0x44, 0xc6, 0x57, 0x32, 0xaf, 0x99, 0x50, 0xe7, 0x52, 0xf8, 0x13, 0xe5, 0xa0, 0x6d,
+    0xfc, 0xa0, 0x5f, 0x43, 0x4f, 0x06, 0x5c, 0x76, 0xd9, 0x79, 0x3f, 0x7f, 0xce, 0xeb, 0x1f, 0xe6,
+    0x2c, 0xb4, 0x5d, 0xbe, 0x3c, 0xad, 0xc1, 0xa4, 0xb6, 0x46, 0x02, 0xc5, 0xf9, 0x06, 0xa7, 0xe7,
+    0xe4, 0xcb, 0xfb, 0x4c, 0xb9, 0x9c, 0x63, 0xb4, 0xd8, 0x7a, 0x12, 0xa8, 0x34, 0xb6, 0xb9, 0xa3,
+    0xc7, 0x6a, 0x0e, 0x88, 0x73, 0xc0, 0x97, 0xcb, 0xce, 0xf6, 0x14, 0xc0, 0x3b, 0x77, 0xf0, 0xd6,
+    0xc3, 0x9a, 0x1d, 0x81, 0x7d, 0x6e, 0xab, 0x9a, 0xdd, 0xc3, 0x95, 0x75, 0xcb, 0xf1, 0x31, 0x50,
+    0xd9, 0x2a, 0xf2, 0x12, 0xc5, 0x46, 0xd0, 0xa1, 0x8b, 0x60, 0x65, 0x03, 0x44, 0xbf, 0x97, 0xb1,
+    0xf6, 0x32, 0x42, 0x76, 0xc2, 0x3f, 0x52, 0x5c, 0x1e, 0xa8, 0x40, 0x7a, 0xfe, 0x2f, 0x98, 0x6b,
+    0x5c, 0xe6, 0xc7, 0x3f, 0x80, 0xa1, 0x14, 0x9f, 0x47, 0x9a, 0xa4, 0xc3, 0x37, 0x9b, 0x87, 0x3f,
+    0x4b, 0x7f, 0x42, 0x9e, 0x70, 0x9b, 0xa9, 0x07, 0x85, 0xf3, 0x82, 0x09, 0xe7, 0x38, 0x44, 0xbb,
+    0xf1, 0x67, 0x42, 0xfe, 0xfb, 0x13, 0x63, 0x79, 0xab, 0x1b, 0xe2, 0x6a, 0x91, 0x9d, 0xcc, 0x5f,
+    0xc9, 0xb1, 0x82, 0xe0, 0x05, 0xfe, 0x8c, 0x94, 0xeb, 0xd8, 0x81, 0xa3, 0x0e, 0x2d, 0xd5, 0x92,
+    0xec, 0xb9, 0x76, 0x93, 0x21, 0x3c, 0x23, 0xbb, 0x79, 0xbc, 0x3e, 0x58, 0x27, 0xd6, 0xea, 0xb0,
+    0xea, 0x5c, 0x20, 0x54, 0xa7, 0x6d, 0x36, 0x9e, 0x5a, 0x7c, 0xfc, 0xe8, 0xd6, 0xbf, 0x77, 0x7c,
+    0x0f, 0x96, 0xbf, 0x35, 0xdd, 0xe2, 0x7c, 0xc1, 0xfa, 0x5c, 0x3e, 0x65, 0xf1, 0xcd, 0x91, 0x4d,
+    0x69, 0x95, 0xad, 0xa4, 0x2d, 0xfb, 0x80, 0x62, 0xb8, 0x30, 0x02, 0x11, 0x18, 0x73, 0xc1, 0xd7,
+    0x19, 0x85, 0x71, 0x18, 0x4e, 0x7b, 0xdb, 0x13, 0xc9, 0xf3, 0x69, 0x3f, 0xeb, 0xf2, 0x28, 0x92,
+    0x7d, 0x36, 0x87, 0xd7, 0x68, 0xb9, 0x91, 0xc7, 0xfc, 0xfb, 0x60, 0xe3, 0x92, 0xcd, 0x1d, 0xda,
+    0x9e, 0x46, 0xbc, 0x0c, 0x5a, 0x53, 0x01, 0x0b, 0xcf, 0xc9, 0xd6, 0x84, 0xa6, 0xd4, 0x05, 0xb7,
+    0x8e, 0x32, 0x17, 0x66, 0x6a, 0x8a, 0xd7, 0xf3, 0x27, 0x0b, 0x4f, 0x28, 0x37, 0xc9, 0x1b, 0x1b,
+    0x00, 0x43, 0xf9, 0x8c, 0xe5, 0x1e, 0xe6, 0x78, 0xf2, 0x61, 0xfe, 0x8b, 0xef, 0xec, 0x76, 0xcb,
+    0xbd, 0xf4, 0x70, 0x96, 0x8d, 0x09, 0x9e, 0xeb, 0x96, 0xec, 0x79, 0xa5, 0x9f, 0x69, 0xa1, 0x4d,
+    0xa3, 0xf0, 0xa0, 0x82, 0x13, 0x5b, 0x82, 0x8d, 0xf7, 0xfc, 0xa6, 0xf8, 0xd4, 0x64, 0x89, 0xb5,
+    0xc9, 0x45, 0x8d, 0x12, 0x30, 0xc7, 0x63, 0x70, 0xd1, 0xfb, 0x98, 0x27, 0xca, 0x9f, 0x83, 0x4d,
+    0x46, 0xdc, 0xc7, 0xf6, 0xfb, 0x4d, 0x3c, 0xe4, 0x60, 0xb0, 0xad, 0xe0, 0xb8, 0xca, 0x2d, 0x61,
+    0xfe, 0xab, 0x7a, 0x37, 0x48, 0x0d, 0x0d, 0xbb, 0x39, 0x91, 0x0a, 0x2d, 0x19, 0xb2, 0x97, 0xf9,
+    0xb4, 0x4e, 0xc4, 0xd5, 0x6c, 0x90, 0x1b, 0xdc, 0x4d, 0xa9, 0x52, 0xa3, 0x0d, 0x9f, 0x07, 0x04,
+    0xb0, 0xd8, 0x79, 0x56, 0xbe, 0x3c, 0x99, 0x06, 0x66, 0x1d, 0x3d, 0x44, 0x25, 0xb6, 0x4d, 0x72,
+    0x70, 0xa5, 0x55, 0xee, 0xb6, 0x0f, 0xdd, 0xbe, 0xd5, 0x72, 0x6a, 0xf5, 0xea, 0xa3, 0x1f, 0x4d,
+    0x1f, 0x73, 0x47, 0x32, 0x43, 0x6f, 0x7f, 0x53, 0x81, 0x17, 0xb3, 0x43, 0x03, 0x59, 0xa3, 0x6d,
+    0x87, 0x05, 0xa6, 0xfb, 0xd7, 0x72, 0x75, 0xe5, 0x76, 0x99, 0x27, 0xaa, 0x47, 0x7b, 0x3a, 0x4c,
+    0x59, 0x86, 0x22, 0x8f, 0xac, 0x67, 0xda, 0xe0, 0xf6, 0x63, 0x13, 0x84, 0x30, 0xc7, 0x19, 0xd7,
+    0xf9, 0x5e, 0x2e, 0xaa, 0xb1, 0x1e, 0x5e, 0x8e, 0xbf, 0x04, 0x31, 0x1e, 0xed, 0xcf, 0x26, 0x2b,
+    0x8f, 0x23, 0xa3, 0x70, 0x9f, 0xff, 0x77, 0x9e, 0xe8, 0xf7, 0x72, 0x84, 0xbb, 0x1d, 0x97, 0x40,
+    0x9d, 0x18, 0xe2, 0x17, 0x92, 0x28, 0x07, 0x86, 0x70, 0x74, 0xcd, 0x49, 0x39, 0x58, 0x8a, 0xa7,
+    0x5e, 0xfa, 0x8a, 0x6c, 0x13, 0x87, 0x87, 0x9d, 0x73, 0xe3, 0xf0, 0x9b, 0x66, 0x37, 0x28, 0x16,
+    0x70, 0xf4, 0x33, 0xf3, 0x7c, 0x39, 0x37, 0xff, 0xc2, 0x4d, 0x63, 0x87, 0x5c, 0xad, 0x55, 0xf3,
+    0x3e, 0x99, 0xa2, 0x10, 0xe3, 0x08, 0x36, 0xcc, 0x77, 0xc6, 0x2f, 0x42, 0xf2, 0x62, 0x88, 0x04,
+    0x34, 0x04, 0x2a, 0xf5, 0x51, 0x6e, 0xed, 0xee, 0x2e, 0xc5, 0xfb, 0x2f, 0x2c, 0x11, 0xed, 0xcf,
+    0x80, 0x3a, 0x6d, 0x53, 0x83, 0x86, 0xb9, 0x13, 0xd3, 0xc8, 0x1e, 0x45, 0x11, 0x76, 0x82, 0xfb,
+    0x48, 0xb1, 0xea, 0xd5, 0x00, 0x93, 0xeb, 0x29, 0xbe, 0x00, 0x13, 0x30, 0xa8, 0x42, 0xda, 0x1f,
+    0x9f, 0x99, 0x92, 0x44, 0x3a, 0x42, 0xed, 0x59, 0x5e, 0xee, 0x72, 0xa6, 0x19, 0xbe, 0x86, 0x0c,
+    0x42, 0xbe, 0xda, 0x3b, 0x0b, 0x8e, 0x41, 0x3e, 0x3d, 0xeb, 0xa5, 0x0b, 0x30, 0xe2, 0xc5, 0xca,
+    0x3f, 0xe7, 0x60, 0x84, 0xf9, 0x53, 0x3f, 0x89, 0xf5, 0x00, 0x85, 0xf9, 0xd1, 0xe5, 0x18, 0x23,
+    0x8f, 0xd0, 0x7c, 0x30, 0x59, 0x86, 0x8d, 0xc3, 0x6f, 0xfa, 0x9f, 0x94, 0x27, 0xcc, 0xc9, 0x74,
+    0xf8, 0xf8, 0xd4, 0x47, 0x6f, 0x83, 0xdb, 0xe1, 0x65, 0x92, 0x7a, 0x40, 0xfc, 0xa9, 0x04, 0xa3,
+    0x2d, 0x47, 0xfd, 0xb7, 0xd0, 0x7f, 0xb2, 0x30, 0xb1, 0x1a, 0x5d, 0x8b, 0x18, 0xf2, 0xc6, 0xa8,
+    0x79, 0x63, 0xe1, 0xee, 0x37, 0xe3, 0xd2, 0xac, 0xc7, 0x80, 0x43, 0x38, 0x5a, 0xb8, 0x7f, 0xe8,
+    0x59, 0xa2, 0xf8, 0x27, 0x04, 0xd1, 0x58, 0xb7, 0x3f, 0x46, 0x16, 0x39, 0x14, 0x5f, 0x68, 0x84,
+    0x3e, 0x36, 0x4f, 0xfa, 0x96, 0x9f, 0xbe, 0x63, 0x9c, 0x26, 0x23, 0xe5, 0x53, 0x5a, 0xfe, 0xc6,
+    0xbf, 0x94, 0x6d, 0x8d, 0x37, 0x1a, 0xa7, 0xbf, 0xc3, 0x44, 0x19, 0x14, 0x3c, 0x14, 0x3e, 0x89,
+    0xc7, 0x36, 0x37, 0xd1, 0x1f, 0xa5, 0xea, 0x6d, 0x4f, 0x48, 0x6a, 0xbc, 0xcb, 0x89, 0x2b, 0x88,
+    0x5e, 0x1e, 0xbd, 0x7d, 0xb0, 0xbd, 0xea, 0x07, 0xa6, 0x77, 0x39, 0x50, 0xd6, 0x22, 0xbf, 0x97,
+    0xbe, 0xc5, 0x79, 0xc0, 0xa1, 0xfe, 0x82, 0xac, 0x3c, 0xe7, 0xde, 0xd5, 0x02, 0xf8, 0x21, 0x8e,
+    0x66, 0x52, 0x06, 0xb1, 0xe5, 0x3b, 0xd9, 0x23, 0xda, 0x96, 0x96, 0x50, 0x42, 0x68, 0x3e, 0x0c,
+    0xb1, 0xb2, 0xb5, 0x71, 0x01, 0xc4, 0xba, 0xd8, 0x59, 0x85, 0xb4, 0xd6, 0xc3, 0xb7, 0x2f, 0xd0,
+    0x9f, 0xc9, 0xa4, 0x07, 0x2d, 0xfb, 0x17, 0x5b, 0x86, 0xce, 0xc9, 0x1c, 0xd1, 0x6e, 0x7e, 0x55,
+    0xda, 0x26, 0xbb, 0xe7, 0xef, 0xab, 0xde, 0x2c, 0x99, 0xf8, 0x5e, 0x7a, 0xba, 0xb7, 0x6b, 0x7f,
+    0x88, 0x8f, 0x1a, 0x28, 0x7f, 0x78, 0xb3, 0x1f, 0x4a, 0x16, 0xd9, 0xdc, 0x81, 0x79, 0x81, 0xce,
+    0xa8, 0xbe, 0x7f, 0x49, 0xdc, 0xcf, 0x02, 0x9f, 0x7a, 0x48, 0x6d, 0xd6, 0xa0, 0x01, 0x4b, 0x5c,
+    0xb3, 0x38, 0xa6, 0x95, 0x18, 0xb3, 0x68, 0xcf, 0xa3, 0xdd, 0xbe, 0x01, 0xd7, 0x87, 0xe1, 0x2a,
+    0x2e, 0xb4, 0x3f, 0xf4, 0x0f, 0x29, 0xda, 0x46, 0xaa, 0x19, 0xca, 0xf7, 0x02, 0xd4, 0x85, 0xe0,
+    0x03, 0x7f, 0xd3, 0xa1, 0xde, 0x59, 0xf3, 0xf3, 0xdf, 0x56, 0xd3, 0x91, 0x56, 0xd2, 0x33, 0x19,
+    0x3a, 0x53, 0x74, 0x83, 0x62, 0x33, 0x80, 0x05, 0x79, 0x8f, 0x2c, 0x9f, 0x31, 0xfe, 0x05, 0x4e,
+    0x95, 0x07, 0xe6, 0x00, 0xe2, 0x3e, 0xe6, 0x9c, 0x7f, 0x11, 0xe4, 0x40, 0x5e, 0x25, 0x9f, 0x52,
+    0x5b, 0x29, 0xdc, 0xd9, 0xad, 0x37, 0x92, 0xe4, 0x3b, 0x59, 0x85, 0x5e, 0x1e, 0x9f, 0xd8, 0x06,
+    0xd5, 0x3f, 0x20, 0x6e, 0xa2, 0x70, 0xdb, 0x7a, 0x2d, 0x8a, 0xa1, 0x91, 0xe6, 0x7a, 0xd3, 0xcf,
+    0xec, 0x6c, 0xb9, 0xeb, 0xd3, 0xb1, 0x37, 0xf0, 0x09, 0xab, 0xcb, 0xc6, 0xb4, 0x32, 0x24, 0x2f,
+    0x91, 0x57, 0x3e, 0xd8, 0xda, 0x7a, 0x19, 0xf6, 0xb2, 0xd3, 0x61, 0xff, 0x21, 0x4b, 0x08, 0x79,
+    0xfd, 0x6d, 0x6e, 0xb6, 0x02, 0x47, 0xda, 0x25, 0x36, 0xbf, 0x35, 0x80, 0x4b, 0x8b, 0x0f, 0x86,
+    0xf8, 0xb0, 0x41, 0x0a, 0xce, 0xe6, 0xf5, 0xaa, 0xe6, 0x27, 0x24, 0x7b, 0x4a, 0x13, 0x91, 0xff,
+    0x1a, 0x3e, 0x53, 0x63, 0x09, 0xe3, 0xcb, 0x34, 0xc9, 0xbd, 0xe8, 0x8f, 0x3d, 0x3f, 0xb9, 0x77,
+    0x9a, 0xbc, 0x37, 0xbc, 0xbc, 0x2b, 0xfe, 0x99, 0x0f, 0x54, 0x74, 0x0a, 0x84, 0xb6, 0x65, 0x11,
+    0xa8, 0xa9, 0x38, 0x9d, 0xb6, 0x77, 0x1a, 0xd7, 0x7f, 0x0c, 0xf8, 0x14, 0x57, 0xf1, 0x68, 0x9b,
+    0x02, 0xe8, 0x33, 0xc7, 0xbd, 0xfa, 0x3d, 0x5b, 0x7d, 0xe3, 0x91, 0x01, 0x8a, 0xa7, 0x12, 0xd3,
+    0x16, 0xe5, 0x5a, 0x7e, 0xdf, 0xd0, 0x59, 0xfa, 0x22, 0x86, 0x9e, 0xc9, 0x4b, 0xf3, 0x7c, 0xdf,
+    0xfa, 0x17, 0x81, 0x2e, 0xe0, 0xa1, 0x77, 0xba, 0x1b, 0x68, 0xbc, 0x81, 0x46, 0xb8, 0x1a, 0x73,
+    0x1f, 0xed, 0x13, 0xf5, 0x01, 0x3c, 0x91, 0xf6, 0x73, 0x1f, 0x68, 0xdb, 0x75, 0x20, 0x77, 0xf5,
+    0x0b, 0x6b, 0x3c, 0x63, 0xb9, 0xd3, 0x2b, 0xad, 0x4a, 0x4d, 0xb2, 0x81, 0x2c, 0x37, 0x76, 0x1d,
+    0x08, 0x63, 0xa1, 0x8e, 0x83, 0x24, 0x0e, 0x63, 0xd3, 0xbb, 0x0b, 0x01, 0xee, 0xed, 0xdf, 0xf6,
+    0xf2, 0x90, 0x3e, 0x6e, 0xd8, 0x51, 0xeb, 0xca, 0x65, 0xb5, 0x33, 0x65, 0x84, 0xe1, 0x98, 0x5f,
+    0xa7, 0xbe, 0x05, 0x1e, 0x0e, 0x58, 0xb1, 0x5f, 0x1c, 0xc6, 0x75, 0x93, 0x72, 0xe2, 0x70, 0x50,
+    0x93, 0x44, 0xdf, 0x35, 0xec, 0xcd, 0x9f, 0x2b, 0x5a, 0xa4, 0xab, 0xe5, 0x59, 0x22, 0x42, 0xe6,
+    0xe2, 0x4f, 0xc1, 0x1f, 0xfc, 0x47, 0xac, 0x5f, 0xe1, 0x62, 0xe6, 0x56, 0x66, 0xd8, 0xe5, 0x65,
+    0xe8, 0x64, 0xd9, 0xa2, 0x80, 0x8b, 0x5f, 0x27, 0x13, 0x10, 0xfd, 0x56, 0x7a, 0x04, 0xd6, 0xda,
+    0xf5, 0xeb, 0x63, 0xd1, 0xae, 0xb2, 0x3c, 0x55, 0x9b, 0x40, 0xc9, 0x4c, 0x2d, 0x92, 0xba, 0x69,
+    0x5a, 0x66, 0x1e, 0x13, 0x07, 0xcf, 0x80, 0x42, 0xad, 0xcc, 0x7d, 0xd7, 0x38, 0x3e, 0xfa, 0xc9,
+    0x25, 0x43, 0x14, 0x39, 0x2e, 0x0c, 0x70, 0xf3, 0x3f, 0x31, 0x3e, 0x36, 0xe0, 0x25, 0x5f, 0xbe,
+    0x36, 0x65, 0x72, 0xf4, 0x3c, 0xe8, 0xea, 0xe3, 0x5c, 0x19, 0x7c, 0x5c, 0x2f, 0x7c, 0x96, 0xa7,
+    0x27, 0xd7, 0xa7, 0x3f, 0x79, 0x03, 0x58, 0x7e, 0xd4, 0x50, 0xbe, 0xe6, 0x1c, 0x8e, 0xd1, 0x03,
+    0x8f, 0x64, 0x98, 0x7f, 0x94, 0x27, 0x46, 0xa7, 0xca, 0x3c, 0xc3, 0xd5, 0x52, 0xda, 0x6a, 0x20,
+    0x8d, 0xe8, 0x60, 0xc4, 0xeb, 0x73, 0x4c, 0xbe, 0x5f, 0xf6, 0x6c, 0x38, 0xf9, 0x80, 0x1d, 0x41,
+    0x8e, 0xeb, 0xa7, 0x30, 0xea, 0x4f, 0x80, 0xde, 0x67, 0x45, 0xf2, 0x05, 0xc5, 0x00, 0xab, 0x05,
+    0xeb, 0x93, 0xf7, 0x34, 0xff, 0xf7, 0xfa, 0x3f, 0xdb, 0x18, 0xda, 0x72, 0x6d, 0xaf, 0x4c, 0x1e,
+    0xf8, 0x03,
 };
+const ShaderModule Blob072 = { Blob072_Data, 6626u, 6515u, 72u };
 
-extern const uint32_t Blob110[6515];
-const uint32_t Blob110[6515] = {
-    0x07230203, 0x00010300, 0x0008000b, 0x0000042c, 0x00000000, 0x00020011, 0x00000001, 0x0006000b,
-    0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001,
-    0x0006000f, 0x00000005, 0x00000004, 0x6e69616d, 0x00000000, 0x000002b4, 0x00060010, 0x00000004,
-    0x00000011, 0x00000008, 0x00000008, 0x00000001, 0x00030003, 0x00000002, 0x000001c2, 0x000a0004,
-    0x475f4c47, 0x4c474f4f, 0x70635f45, 0x74735f70, 0x5f656c79, 0x656e696c, 0x7269645f, 0x69746365,
-    0x00006576, 0x00080004, 0x475f4c47, 0x4c474f4f, 0x6e695f45, 0x64756c63, 0x69645f65, 0x74636572,
-    0x00657669, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000, 0x00070005, 0x0000000a, 0x726f6e55,
-    0x6f54386d, 0x36626752, 0x3b317528, 0x00000000, 0x00040005, 0x00000009, 0x756c6176, 0x00000065,
-    0x00070005, 0x0000000d, 0x726f6e55, 0x6f54386d, 0x68706c41, 0x75283561, 0x00003b31, 0x00040005,
-    0x0000000c, 0x756c6176, 0x00000065, 0x00070005, 0x00000014, 0x64616f4c, 0x616e6946, 0x2842466c,
-    0x3b326976, 0x00000000, 0x00050005, 0x00000013, 0x69736f70, 0x6e6f6974, 0x00000000, 0x00050005,
-    0x00000017, 0x6f6c6f43, 0x28523672, 0x003b3175, 0x00040005, 0x00000016, 0x6f6c6f63, 0x00000072,
-    0x00050005, 0x0000001a, 0x6f6c6f43, 0x28473672, 0x003b3175, 0x00040005, 0x00000019, 0x6f6c6f63,
-    0x00000072, 0x00050005, 0x0000001d, 0x6f6c6f43, 0x28423672, 0x003b3175, 0x00040005, 0x0000001c,
-    0x6f6c6f63, 0x00000072, 0x00080005, 0x00000024, 0x6b636150, 0x6f6c6f43, 0x75283672, 0x31753b31,
-    0x3b31753b, 0x003b3175, 0x00030005, 0x00000020, 0x00000072, 0x00030005, 0x00000021, 0x00000067,
-    0x00030005, 0x00000022, 0x00000062, 0x00040005, 0x00000023, 0x68706c61, 0x00000061, 0x00070005,
-    0x0000002a, 0x6e656c42, 0x75283464, 0x31753b31, 0x3b31753b, 0x003b3175, 0x00040005, 0x00000026,
-    0x73726966, 0x00000074, 0x00040005, 0x00000027, 0x6f636573, 0x0000646e, 0x00030005, 0x00000028,
-    0x00617665, 0x00030005, 0x00000029, 0x00627665, 0x00060005, 0x0000002f, 0x6e656c42, 0x75283564,
-    0x31753b31, 0x0000003b, 0x00040005, 0x0000002d, 0x73726966, 0x00000074, 0x00040005, 0x0000002e,
-    0x6f636573, 0x0000646e, 0x00080005, 0x00000035, 0x67697242, 0x656e7468, 0x70557373, 0x3b317528,
-    0x753b3175, 0x00003b31, 0x00040005, 0x00000032, 0x6f6c6f63, 0x00000072, 0x00040005, 0x00000033,
-    0x74636166, 0x0000726f, 0x00040005, 0x00000034, 0x73616962, 0x00000000, 0x00090005, 0x0000003a,
-    0x67697242, 0x656e7468, 0x6f447373, 0x75286e77, 0x31753b31, 0x3b31753b, 0x00000000, 0x00040005,
-    0x00000037, 0x6f6c6f63, 0x00000072, 0x00040005, 0x00000038, 0x74636166, 0x0000726f, 0x00040005,
-    0x00000039, 0x73616962, 0x00000000, 0x00090005, 0x00000041, 0x64616f4c, 0x74706143, 0x53657275,
-    0x63656469, 0x75287261, 0x75763b31, 0x00003b32, 0x00050005, 0x0000003f, 0x65666572, 0x636e6572,
-    0x00000065, 0x00070005, 0x00000040, 0x6c616373, 0x69576465, 0x6e696874, 0x65786950, 0x0000006c,
-    0x00090005, 0x00000046, 0x64616f4c, 0x74706143, 0x53657275, 0x6372756f, 0x28443365, 0x3b327576,
-    0x003b3175, 0x00050005, 0x00000044, 0x69736f70, 0x6e6f6974, 0x00000000, 0x00050005, 0x00000045,
-    0x656e696c, 0x6174654d, 0x00000000, 0x000a0005, 0x00000050, 0x706d6f43, 0x5365736f, 0x6372756f,
-    0x75284165, 0x75763b31, 0x31753b32, 0x3b31753b, 0x003b3162, 0x00040005, 0x0000004b, 0x65726373,
-    0x00006e65, 0x00030005, 0x0000004c, 0x00006469, 0x00050005, 0x0000004d, 0x6974616e, 0x6e496576,
-    0x00786564, 0x00050005, 0x0000004e, 0x656e696c, 0x6174654d, 0x00000000, 0x00060005, 0x0000004f,
-    0x72756f73, 0x44336563, 0x696c6156, 0x00000064, 0x00090005, 0x00000053, 0x6d726f4e, 0x7a696c61,
-    0x70614365, 0x65727574, 0x78695064, 0x75286c65, 0x00003b31, 0x00040005, 0x00000052, 0x6f6c6f63,
-    0x00000072, 0x00040005, 0x00000068, 0x65786574, 0x0000006c, 0x00040005, 0x0000006b, 0x616e6946,
-    0x0042466c, 0x00050005, 0x00000071, 0x6e617571, 0x657a6974, 0x00000064, 0x00040005, 0x00000077,
-    0x61726170, 0x0000006d, 0x00040005, 0x0000007c, 0x61726170, 0x0000006d, 0x00040005, 0x00000084,
-    0x61726170, 0x0000006d, 0x00040005, 0x0000008c, 0x61726170, 0x0000006d, 0x00040005, 0x000000b3,
-    0x61726170, 0x0000006d, 0x00040005, 0x000000b8, 0x61726170, 0x0000006d, 0x00040005, 0x000000c2,
-    0x61726170, 0x0000006d, 0x00040005, 0x000000c7, 0x61726170, 0x0000006d, 0x00040005, 0x000000cf,
-    0x61726170, 0x0000006d, 0x00040005, 0x000000d4, 0x61726170, 0x0000006d, 0x00040005, 0x000000dc,
-    0x61726170, 0x0000006d, 0x00040005, 0x000000dd, 0x61726170, 0x0000006d, 0x00040005, 0x000000de,
-    0x61726170, 0x0000006d, 0x00040005, 0x000000df, 0x61726170, 0x0000006d, 0x00030005, 0x000000e3,
-    0x00617665, 0x00030005, 0x000000e8, 0x00627665, 0x00040005, 0x000000ec, 0x61726170, 0x0000006d,
-    0x00040005, 0x000000f1, 0x61726170, 0x0000006d, 0x00040005, 0x000000fb, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000100, 0x61726170, 0x0000006d, 0x00040005, 0x00000108, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000010d, 0x61726170, 0x0000006d, 0x00040005, 0x00000115, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000116, 0x61726170, 0x0000006d, 0x00040005, 0x00000117, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000118, 0x61726170, 0x0000006d, 0x00040005, 0x0000011c, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000011f, 0x61726170, 0x0000006d, 0x00040005, 0x00000129, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000012c, 0x61726170, 0x0000006d, 0x00040005, 0x00000136, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000139, 0x61726170, 0x0000006d, 0x00040005, 0x00000143, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000144, 0x61726170, 0x0000006d, 0x00040005, 0x00000145, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000146, 0x61726170, 0x0000006d, 0x00040005, 0x0000014a, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000014d, 0x61726170, 0x0000006d, 0x00040005, 0x00000156, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000159, 0x61726170, 0x0000006d, 0x00040005, 0x00000162, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000165, 0x61726170, 0x0000006d, 0x00040005, 0x0000016e, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000016f, 0x61726170, 0x0000006d, 0x00040005, 0x00000170, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000171, 0x61726170, 0x0000006d, 0x00040005, 0x00000175, 0x72646461, 0x00737365,
-    0x00040005, 0x00000179, 0x6b6e6162, 0x00000000, 0x00040005, 0x0000017e, 0x73726576, 0x006e6f69,
-    0x00060005, 0x00000183, 0x706d6173, 0x5073656c, 0x69507265, 0x006c6578, 0x00050005, 0x00000184,
-    0x65726353, 0x69576e65, 0x00687464, 0x00050005, 0x00000186, 0x6c616353, 0x63614665, 0x00726f74,
-    0x00040005, 0x0000018a, 0x6c6c6563, 0x00000000, 0x00050005, 0x00000194, 0x706d6173, 0x6e49656c,
-    0x00786564, 0x00080005, 0x0000019d, 0x74706143, 0x53657275, 0x63656469, 0x75427261, 0x72656666,
-    0x00000000, 0x00090006, 0x0000019d, 0x00000000, 0x74706143, 0x53657275, 0x63656469, 0x69507261,
-    0x736c6578, 0x00000000, 0x00030005, 0x0000019f, 0x00000000, 0x00050005, 0x000001ab, 0x736f5078,
-    0x6f697469, 0x0000006e, 0x00040005, 0x000001b2, 0x72756f73, 0x00586563, 0x00060005, 0x000001ce,
-    0x68737550, 0x736e6f43, 0x746e6174, 0x00000073, 0x00060006, 0x000001ce, 0x00000000, 0x56727543,
-    0x61697261, 0x0000746e, 0x00060006, 0x000001ce, 0x00000001, 0x57786554, 0x68746469, 0x00000000,
-    0x00060006, 0x000001ce, 0x00000002, 0x48786554, 0x68676965, 0x00000074, 0x00060006, 0x000001ce,
-    0x00000003, 0x57786554, 0x53706172, 0x00000000, 0x00060006, 0x000001ce, 0x00000004, 0x57786554,
-    0x54706172, 0x00000000, 0x00070006, 0x000001ce, 0x00000005, 0x49786554, 0x70614373, 0x65727574,
-    0x00000000, 0x00070006, 0x000001ce, 0x00000006, 0x74706143, 0x59657275, 0x7366664f, 0x00007465,
-    0x00050006, 0x000001ce, 0x00000007, 0x6461705f, 0x00000000, 0x00030005, 0x000001d0, 0x00006370,
-    0x00040005, 0x000001e4, 0x61726170, 0x0000006d, 0x00040005, 0x000001ea, 0x65736162, 0x00000000,
-    0x00040005, 0x000001ec, 0x6f6c6562, 0x00000077, 0x00080005, 0x000001ee, 0x75727453, 0x72757463,
-    0x6e496465, 0x42747570, 0x65666675, 0x00000072, 0x00070006, 0x000001ee, 0x00000000, 0x75727453,
-    0x72757463, 0x6e496465, 0x00747570, 0x00030005, 0x000001f0, 0x00000000, 0x00040005, 0x000001f6,
-    0x766f6261, 0x00000065, 0x00040005, 0x000001fe, 0x746e6f63, 0x006c6f72, 0x00050005, 0x00000206,
-    0x65666572, 0x636e6572, 0x00000065, 0x00040005, 0x0000020e, 0x67616c66, 0x00000073, 0x00040005,
-    0x00000212, 0x6f6c6f63, 0x00000072, 0x00040005, 0x00000224, 0x61726170, 0x0000006d, 0x00040005,
-    0x00000226, 0x61726170, 0x0000006d, 0x00040005, 0x0000022b, 0x746f6c73, 0x00000000, 0x00040005,
-    0x00000235, 0x61726170, 0x0000006d, 0x00040005, 0x00000237, 0x61726170, 0x0000006d, 0x00040005,
-    0x0000023d, 0x61726170, 0x0000006d, 0x00040005, 0x0000023f, 0x61726170, 0x0000006d, 0x00040005,
-    0x0000024a, 0x65646f6d, 0x00000000, 0x00030005, 0x0000024e, 0x00617665, 0x00030005, 0x00000252,
-    0x00627665, 0x00040005, 0x00000261, 0x61726170, 0x0000006d, 0x00040005, 0x00000263, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000265, 0x61726170, 0x0000006d, 0x00040005, 0x00000267, 0x61726170,
-    0x0000006d, 0x00040005, 0x0000026f, 0x61726170, 0x0000006d, 0x00040005, 0x00000271, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000273, 0x61726170, 0x0000006d, 0x00040005, 0x0000027b, 0x61726170,
-    0x0000006d, 0x00040005, 0x0000027d, 0x61726170, 0x0000006d, 0x00040005, 0x0000027f, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000286, 0x61726170, 0x0000006d, 0x00040005, 0x00000288, 0x61726170,
-    0x0000006d, 0x00030005, 0x0000028f, 0x00000072, 0x00030005, 0x00000294, 0x00000067, 0x00030005,
-    0x0000029a, 0x00000062, 0x00030005, 0x000002a0, 0x00000061, 0x00030005, 0x000002b1, 0x00006469,
-    0x00080005, 0x000002b4, 0x475f6c67, 0x61626f6c, 0x766e496c, 0x7461636f, 0x496e6f69, 0x00000044,
-    0x00040005, 0x000002b7, 0x63746162, 0x00000068, 0x00040005, 0x000002bb, 0x6974616e, 0x00596576,
-    0x00040005, 0x000002de, 0x6c616373, 0x00596465, 0x00040005, 0x000002e5, 0x6974616e, 0x00586576,
-    0x00050005, 0x000002ea, 0x6974616e, 0x6e496576, 0x00786564, 0x00050005, 0x000002ef, 0x6d6d6f63,
-    0x42646e61, 0x00657361, 0x00050005, 0x000002f4, 0x74706163, 0x43657275, 0x0000746e, 0x00040005,
-    0x000002f8, 0x6d6d6f63, 0x00646e61, 0x00040005, 0x000002fd, 0x74646977, 0x00000068, 0x00060005,
-    0x00000317, 0x72756f73, 0x63536563, 0x6e656572, 0x00000000, 0x00060005, 0x0000031b, 0x72756f73,
-    0x44336563, 0x696c6156, 0x00000064, 0x00050005, 0x0000031f, 0x656e696c, 0x6174654d, 0x00000000,
-    0x00040005, 0x00000328, 0x72756f73, 0x00416563, 0x00040005, 0x00000338, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000339, 0x61726170, 0x0000006d, 0x00040005, 0x00000343, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000345, 0x61726170, 0x0000006d, 0x00040005, 0x00000346, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000348, 0x61726170, 0x0000006d, 0x00040005, 0x0000034a, 0x61726170, 0x0000006d,
-    0x00070005, 0x0000034e, 0x72756f73, 0x52426563, 0x72656665, 0x65636e65, 0x00000000, 0x00040005,
-    0x00000354, 0x72756f73, 0x00426563, 0x00040005, 0x00000362, 0x61726170, 0x0000006d, 0x00040005,
-    0x00000364, 0x61726170, 0x0000006d, 0x00040005, 0x0000036d, 0x65646f6d, 0x00000000, 0x00040005,
-    0x00000372, 0x75736572, 0x0000746c, 0x00030005, 0x0000037e, 0x00617665, 0x00030005, 0x00000382,
-    0x00627665, 0x00040005, 0x00000387, 0x68706c61, 0x00004161, 0x00040005, 0x0000038c, 0x68706c61,
-    0x00004261, 0x00030005, 0x00000391, 0x00000072, 0x00030005, 0x000003a5, 0x00000067, 0x00030005,
-    0x000003bb, 0x00000062, 0x00040005, 0x000003d1, 0x68706c61, 0x00000061, 0x00040005, 0x000003e6,
-    0x72646461, 0x00737365, 0x00040005, 0x000003ee, 0x6b6e6162, 0x00000000, 0x00040005, 0x000003f1,
-    0x73726576, 0x006e6f69, 0x00060005, 0x000003f5, 0x706d6173, 0x5073656c, 0x69507265, 0x006c6578,
-    0x00040005, 0x000003f9, 0x6c6c6563, 0x00000000, 0x00050005, 0x00000401, 0x706d6173, 0x6e49656c,
-    0x00786564, 0x00040005, 0x00000410, 0x61726170, 0x0000006d, 0x00060005, 0x00000414, 0x65726353,
-    0x65486e65, 0x74686769, 0x00000000, 0x00060005, 0x00000415, 0x5778614d, 0x546b726f, 0x73656c69,
-    0x00000000, 0x00070005, 0x00000417, 0x6d617246, 0x66756265, 0x53726566, 0x64697274, 0x00000065,
-    0x00060005, 0x00000419, 0x656c6954, 0x72655073, 0x656e694c, 0x00000000, 0x00050005, 0x0000041a,
-    0x656c6954, 0x656e694c, 0x00000073, 0x00050005, 0x00000420, 0x6174654d, 0x66696e55, 0x006d726f,
-    0x00060006, 0x00000420, 0x00000000, 0x506d754e, 0x67796c6f, 0x00736e6f, 0x00060006, 0x00000420,
-    0x00000001, 0x566d754e, 0x61697261, 0x0073746e, 0x00060006, 0x00000420, 0x00000002, 0x68706c41,
-    0x66655261, 0x00000000, 0x00050006, 0x00000420, 0x00000003, 0x70736944, 0x00746e43, 0x00060006,
-    0x00000420, 0x00000004, 0x6e6f6f54, 0x6c626154, 0x00000065, 0x00060006, 0x00000420, 0x00000005,
-    0x61656c43, 0x6c6f4372, 0x0000726f, 0x00060006, 0x00000420, 0x00000006, 0x61656c43, 0x70654472,
-    0x00006874, 0x00060006, 0x00000420, 0x00000007, 0x61656c43, 0x74744172, 0x00000072, 0x00060006,
-    0x00000420, 0x00000008, 0x4f676f46, 0x65736666, 0x00000074, 0x00060006, 0x00000420, 0x00000009,
-    0x53676f46, 0x74666968, 0x00000000, 0x00060006, 0x00000420, 0x0000000a, 0x43676f46, 0x726f6c6f,
-    0x00000000, 0x00080006, 0x00000420, 0x0000000b, 0x61656c43, 0x74694272, 0x4f70616d, 0x65736666,
-    0x00000074, 0x00030005, 0x00000422, 0x00000000, 0x00090005, 0x00000425, 0x73657250, 0x61746e65,
-    0x6e6f6974, 0x7074754f, 0x75427475, 0x72656666, 0x00000000, 0x00080006, 0x00000425, 0x00000000,
-    0x73657250, 0x61746e65, 0x6e6f6974, 0x7074754f, 0x00007475, 0x00030005, 0x00000427, 0x00000000,
-    0x00060005, 0x00000428, 0x65726944, 0x754f7463, 0x74757074, 0x00706f54, 0x00070005, 0x00000429,
-    0x65726944, 0x754f7463, 0x74757074, 0x74746f42, 0x00006d6f, 0x00040047, 0x0000006b, 0x00000022,
-    0x00000000, 0x00040047, 0x0000006b, 0x00000021, 0x0000000b, 0x00030047, 0x0000006b, 0x00000018,
-    0x00040047, 0x00000184, 0x00000001, 0x00000000, 0x00040047, 0x0000019c, 0x00000006, 0x00000004,
-    0x00050048, 0x0000019d, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x0000019d, 0x00000002,
-    0x00040047, 0x0000019f, 0x00000022, 0x00000000, 0x00040047, 0x0000019f, 0x00000021, 0x0000000e,
-    0x00050048, 0x000001ce, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x000001ce, 0x00000001,
-    0x00000023, 0x00000004, 0x00050048, 0x000001ce, 0x00000002, 0x00000023, 0x00000008, 0x00050048,
-    0x000001ce, 0x00000003, 0x00000023, 0x0000000c, 0x00050048, 0x000001ce, 0x00000004, 0x00000023,
-    0x00000010, 0x00050048, 0x000001ce, 0x00000005, 0x00000023, 0x00000014, 0x00050048, 0x000001ce,
-    0x00000006, 0x00000023, 0x00000018, 0x00050048, 0x000001ce, 0x00000007, 0x00000023, 0x0000001c,
-    0x00030047, 0x000001ce, 0x00000002, 0x00040047, 0x000001ed, 0x00000006, 0x00000004, 0x00040048,
-    0x000001ee, 0x00000000, 0x00000018, 0x00050048, 0x000001ee, 0x00000000, 0x00000023, 0x00000000,
-    0x00030047, 0x000001ee, 0x00000002, 0x00040047, 0x000001f0, 0x00000022, 0x00000000, 0x00040047,
-    0x000001f0, 0x00000021, 0x0000000c, 0x00040047, 0x000002b4, 0x0000000b, 0x0000001c, 0x00040047,
-    0x00000414, 0x00000001, 0x00000001, 0x00040047, 0x00000415, 0x00000001, 0x00000002, 0x00040047,
-    0x0000041e, 0x00000006, 0x00000010, 0x00050048, 0x00000420, 0x00000000, 0x00000023, 0x00000000,
-    0x00050048, 0x00000420, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x00000420, 0x00000002,
-    0x00000023, 0x00000008, 0x00050048, 0x00000420, 0x00000003, 0x00000023, 0x0000000c, 0x00050048,
-    0x00000420, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x00000420, 0x00000005, 0x00000023,
-    0x00000230, 0x00050048, 0x00000420, 0x00000006, 0x00000023, 0x00000234, 0x00050048, 0x00000420,
-    0x00000007, 0x00000023, 0x00000238, 0x00050048, 0x00000420, 0x00000008, 0x00000023, 0x0000023c,
-    0x00050048, 0x00000420, 0x00000009, 0x00000023, 0x00000240, 0x00050048, 0x00000420, 0x0000000a,
-    0x00000023, 0x00000244, 0x00050048, 0x00000420, 0x0000000b, 0x00000023, 0x00000248, 0x00030047,
-    0x00000420, 0x00000002, 0x00040047, 0x00000422, 0x00000022, 0x00000000, 0x00040047, 0x00000422,
-    0x00000021, 0x00000000, 0x00040047, 0x00000424, 0x00000006, 0x00000004, 0x00050048, 0x00000425,
-    0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000425, 0x00000002, 0x00040047, 0x00000427,
-    0x00000022, 0x00000000, 0x00040047, 0x00000427, 0x00000021, 0x0000000d, 0x00040047, 0x00000428,
-    0x00000022, 0x00000000, 0x00040047, 0x00000428, 0x00000021, 0x00000011, 0x00030047, 0x00000428,
-    0x00000019, 0x00040047, 0x00000429, 0x00000022, 0x00000000, 0x00040047, 0x00000429, 0x00000021,
-    0x00000012, 0x00030047, 0x00000429, 0x00000019, 0x00040047, 0x0000042b, 0x0000000b, 0x00000019,
-    0x00020013, 0x00000002, 0x00030021, 0x00000003, 0x00000002, 0x00040015, 0x00000006, 0x00000020,
-    0x00000000, 0x00040020, 0x00000007, 0x00000007, 0x00000006, 0x00040021, 0x00000008, 0x00000006,
-    0x00000007, 0x00040015, 0x0000000f, 0x00000020, 0x00000001, 0x00040017, 0x00000010, 0x0000000f,
-    0x00000002, 0x00040020, 0x00000011, 0x00000007, 0x00000010, 0x00040021, 0x00000012, 0x00000006,
-    0x00000011, 0x00070021, 0x0000001f, 0x00000006, 0x00000007, 0x00000007, 0x00000007, 0x00000007,
-    0x00050021, 0x0000002c, 0x00000006, 0x00000007, 0x00000007, 0x00060021, 0x00000031, 0x00000006,
-    0x00000007, 0x00000007, 0x00000007, 0x00040017, 0x0000003c, 0x00000006, 0x00000002, 0x00040020,
-    0x0000003d, 0x00000007, 0x0000003c, 0x00050021, 0x0000003e, 0x00000006, 0x00000007, 0x0000003d,
-    0x00050021, 0x00000043, 0x00000006, 0x0000003d, 0x00000007, 0x00020014, 0x00000048, 0x00040020,
-    0x00000049, 0x00000007, 0x00000048, 0x00080021, 0x0000004a, 0x00000006, 0x00000007, 0x0000003d,
-    0x00000007, 0x00000007, 0x00000049, 0x0004002b, 0x00000006, 0x00000056, 0x0000003f, 0x0004002b,
-    0x00000006, 0x00000058, 0x0000007f, 0x0004002b, 0x00000006, 0x0000005a, 0x000000ff, 0x0004002b,
-    0x00000006, 0x0000005f, 0x0000001f, 0x00030016, 0x00000065, 0x00000020, 0x00040017, 0x00000066,
-    0x00000065, 0x00000004, 0x00040020, 0x00000067, 0x00000007, 0x00000066, 0x00090019, 0x00000069,
-    0x00000065, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000004, 0x00040020,
-    0x0000006a, 0x00000000, 0x00000069, 0x0004003b, 0x0000006a, 0x0000006b, 0x00000000, 0x00040017,
-    0x0000006f, 0x00000006, 0x00000004, 0x00040020, 0x00000070, 0x00000007, 0x0000006f, 0x0004002b,
-    0x00000065, 0x00000073, 0x437f0000, 0x0004002b, 0x00000006, 0x00000078, 0x00000000, 0x0004002b,
-    0x00000006, 0x0000007d, 0x00000001, 0x0004002b, 0x0000000f, 0x00000081, 0x00000008, 0x0004002b,
-    0x00000006, 0x00000085, 0x00000002, 0x0004002b, 0x0000000f, 0x00000089, 0x00000010, 0x0004002b,
-    0x00000006, 0x0000008d, 0x00000003, 0x0004002b, 0x0000000f, 0x00000091, 0x00000018, 0x0004002b,
-    0x00000006, 0x000000be, 0x00000008, 0x0004002b, 0x0000000f, 0x000000c0, 0x00000004, 0x0004002b,
-    0x00000006, 0x000000e9, 0x00000020, 0x0004002b, 0x00000006, 0x000000f7, 0x00000010, 0x0004002b,
-    0x0000000f, 0x000000f9, 0x00000005, 0x0004002b, 0x00000006, 0x00000177, 0x0000ffff, 0x0004002b,
-    0x00000006, 0x0000017b, 0x0000001c, 0x0004002b, 0x00000006, 0x00000180, 0x0000001e, 0x00040032,
-    0x0000000f, 0x00000184, 0x00000100, 0x0004002b, 0x0000000f, 0x00000185, 0x00000100, 0x00060034,
-    0x0000000f, 0x00000186, 0x00000087, 0x00000184, 0x00000185, 0x00060034, 0x00000006, 0x00000187,
-    0x00000080, 0x00000186, 0x00000078, 0x00060034, 0x00000006, 0x00000188, 0x00000080, 0x00000186,
-    0x00000078, 0x00060034, 0x00000006, 0x00000189, 0x00000084, 0x00000187, 0x00000188, 0x0004002b,
-    0x00000006, 0x0000018c, 0x00000004, 0x0004002b, 0x00000006, 0x00000190, 0x00010000, 0x00060034,
-    0x00000006, 0x00000197, 0x00000080, 0x00000186, 0x00000078, 0x0003001d, 0x0000019c, 0x00000006,
-    0x0003001e, 0x0000019d, 0x0000019c, 0x00040020, 0x0000019e, 0x0000000c, 0x0000019d, 0x0004003b,
-    0x0000019e, 0x0000019f, 0x0000000c, 0x0004002b, 0x0000000f, 0x000001a0, 0x00000000, 0x00040020,
-    0x000001a6, 0x0000000c, 0x00000006, 0x0004002b, 0x00000006, 0x000001ad, 0x00000017, 0x0004002b,
-    0x00000006, 0x000001af, 0x000001ff, 0x00040020, 0x000001b1, 0x00000007, 0x0000000f, 0x0004002b,
-    0x00000006, 0x000001b4, 0x00000100, 0x0004002b, 0x00000006, 0x000001bd, 0x00000200, 0x00060034,
-    0x00000006, 0x000001c0, 0x00000080, 0x00000186, 0x00000078, 0x00060034, 0x00000006, 0x000001c9,
-    0x00000080, 0x00000186, 0x00000078, 0x000a001e, 0x000001ce, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x0000000f, 0x00000006, 0x00040020, 0x000001cf, 0x00000009,
-    0x000001ce, 0x0004003b, 0x000001cf, 0x000001d0, 0x00000009, 0x0004002b, 0x0000000f, 0x000001d1,
-    0x00000001, 0x00040020, 0x000001d2, 0x00000009, 0x00000006, 0x0004002b, 0x00000006, 0x000001eb,
-    0x00060000, 0x0003001d, 0x000001ed, 0x00000006, 0x0003001e, 0x000001ee, 0x000001ed, 0x00040020,
-    0x000001ef, 0x0000000c, 0x000001ee, 0x0004003b, 0x000001ef, 0x000001f0, 0x0000000c, 0x0004002b,
-    0x00000006, 0x000001f8, 0x0000c000, 0x0004002b, 0x00000006, 0x00000200, 0x00018000, 0x0004002b,
-    0x00000006, 0x00000208, 0x00024000, 0x0004002b, 0x00000006, 0x00000210, 0x00000018, 0x0004002b,
-    0x00000006, 0x00000215, 0x00000040, 0x0004002b, 0x00000006, 0x0000021b, 0x80000000, 0x00060034,
-    0x00000006, 0x00000221, 0x00000080, 0x00000186, 0x00000078, 0x00060034, 0x00000006, 0x00000232,
-    0x00000080, 0x00000186, 0x00000078, 0x0004002b, 0x00000006, 0x0000024c, 0x0000000f, 0x0004002b,
-    0x00000006, 0x0000025b, 0x00000080, 0x0004002b, 0x00000006, 0x0000027a, 0x00000007, 0x00040017,
-    0x000002b2, 0x00000006, 0x00000003, 0x00040020, 0x000002b3, 0x00000001, 0x000002b2, 0x0004003b,
-    0x000002b3, 0x000002b4, 0x00000001, 0x0004002b, 0x0000000f, 0x000002c0, 0x00000002, 0x00040020,
-    0x000002c3, 0x00000001, 0x00000006, 0x00060034, 0x00000006, 0x000002cd, 0x00000080, 0x00000184,
-    0x00000078, 0x00060034, 0x00000006, 0x000002d4, 0x00000080, 0x00000186, 0x00000078, 0x0004002b,
-    0x00000006, 0x000002d8, 0x000000c0, 0x00060034, 0x00000006, 0x000002e0, 0x00000080, 0x00000186,
-    0x00000078, 0x00060034, 0x00000006, 0x000002e8, 0x00000080, 0x00000186, 0x00000078, 0x0004002b,
-    0x00000006, 0x000002f0, 0x000a8180, 0x0004002b, 0x00000006, 0x00000320, 0x000a8000, 0x0004002b,
-    0x00000006, 0x0000032a, 0x01000000, 0x0004002b, 0x00000006, 0x0000034f, 0x0009c000, 0x00060034,
-    0x00000006, 0x0000035d, 0x00000080, 0x00000186, 0x00000078, 0x0004002b, 0x00000006, 0x00000367,
-    0x00090000, 0x0004002b, 0x00000006, 0x0000036f, 0x0000001d, 0x00060034, 0x00000006, 0x000003f6,
-    0x00000080, 0x00000186, 0x00000078, 0x00060034, 0x00000006, 0x000003f7, 0x00000080, 0x00000186,
-    0x00000078, 0x00060034, 0x00000006, 0x000003f8, 0x00000084, 0x000003f6, 0x000003f7, 0x00060034,
-    0x00000006, 0x00000404, 0x00000080, 0x00000186, 0x00000078, 0x00060034, 0x00000006, 0x00000408,
-    0x00000080, 0x00000186, 0x00000078, 0x00040032, 0x0000000f, 0x00000414, 0x000000c0, 0x00040032,
-    0x0000000f, 0x00000415, 0x00003000, 0x0004002b, 0x0000000f, 0x00000416, 0x000000c0, 0x00060034,
-    0x0000000f, 0x00000417, 0x00000084, 0x00000184, 0x00000414, 0x0004002b, 0x0000000f, 0x00000418,
-    0x00000020, 0x00060034, 0x0000000f, 0x00000419, 0x00000087, 0x00000184, 0x00000418, 0x00060034,
-    0x0000000f, 0x0000041a, 0x00000087, 0x00000414, 0x00000418, 0x0004002b, 0x0000000f, 0x0000041b,
-    0x00000040, 0x0004002b, 0x0000000f, 0x0000041c, 0x00000800, 0x0004002b, 0x00000006, 0x0000041d,
-    0x00000022, 0x0004001c, 0x0000041e, 0x0000006f, 0x0000041d, 0x00040017, 0x0000041f, 0x00000065,
-    0x00000002, 0x000e001e, 0x00000420, 0x00000006, 0x00000006, 0x0000000f, 0x00000006, 0x0000041e,
-    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x0000041f, 0x00040020,
-    0x00000421, 0x00000002, 0x00000420, 0x0004003b, 0x00000421, 0x00000422, 0x00000002, 0x0004002b,
-    0x0000000f, 0x00000423, 0x0000c000, 0x0003001d, 0x00000424, 0x00000006, 0x0003001e, 0x00000425,
-    0x00000424, 0x00040020, 0x00000426, 0x0000000c, 0x00000425, 0x0004003b, 0x00000426, 0x00000427,
-    0x0000000c, 0x0004003b, 0x0000006a, 0x00000428, 0x00000000, 0x0004003b, 0x0000006a, 0x00000429,
-    0x00000000, 0x0004002b, 0x00000006, 0x0000042a, 0x00030000, 0x0006002c, 0x000002b2, 0x0000042b,
-    0x000000be, 0x000000be, 0x0000007d, 0x00050036, 0x00000002, 0x00000004, 0x00000000, 0x00000003,
-    0x000200f8, 0x00000005, 0x0004003b, 0x0000003d, 0x000002b1, 0x00000007, 0x0004003b, 0x00000049,
-    0x000002b7, 0x00000007, 0x0004003b, 0x00000007, 0x000002bb, 0x00000007, 0x0004003b, 0x00000007,
-    0x000002bd, 0x00000007, 0x0004003b, 0x00000007, 0x000002de, 0x00000007, 0x0004003b, 0x00000007,
-    0x000002e5, 0x00000007, 0x0004003b, 0x00000007, 0x000002ea, 0x00000007, 0x0004003b, 0x00000007,
-    0x000002ef, 0x00000007, 0x0004003b, 0x00000007, 0x000002f4, 0x00000007, 0x0004003b, 0x00000007,
-    0x000002f8, 0x00000007, 0x0004003b, 0x00000007, 0x000002fd, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000317, 0x00000007, 0x0004003b, 0x00000049, 0x0000031b, 0x00000007, 0x0004003b, 0x00000007,
-    0x0000031f, 0x00000007, 0x0004003b, 0x00000007, 0x00000328, 0x00000007, 0x0004003b, 0x00000007,
-    0x0000032d, 0x00000007, 0x0004003b, 0x00000007, 0x00000331, 0x00000007, 0x0004003b, 0x0000003d,
-    0x00000338, 0x00000007, 0x0004003b, 0x00000007, 0x00000339, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000343, 0x00000007, 0x0004003b, 0x0000003d, 0x00000345, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000346, 0x00000007, 0x0004003b, 0x00000007, 0x00000348, 0x00000007, 0x0004003b, 0x00000049,
-    0x0000034a, 0x00000007, 0x0004003b, 0x00000007, 0x0000034e, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000354, 0x00000007, 0x0004003b, 0x00000007, 0x00000358, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000362, 0x00000007, 0x0004003b, 0x0000003d, 0x00000364, 0x00000007, 0x0004003b, 0x00000007,
-    0x0000036d, 0x00000007, 0x0004003b, 0x00000007, 0x00000372, 0x00000007, 0x0004003b, 0x00000007,
-    0x0000037e, 0x00000007, 0x0004003b, 0x00000007, 0x00000382, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000387, 0x00000007, 0x0004003b, 0x00000007, 0x0000038c, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000391, 0x00000007, 0x0004003b, 0x00000007, 0x000003a5, 0x00000007, 0x0004003b, 0x00000007,
-    0x000003bb, 0x00000007, 0x0004003b, 0x00000007, 0x000003d1, 0x00000007, 0x0004003b, 0x00000007,
-    0x000003e6, 0x00000007, 0x0004003b, 0x00000007, 0x000003ee, 0x00000007, 0x0004003b, 0x00000007,
-    0x000003f1, 0x00000007, 0x0004003b, 0x00000007, 0x000003f5, 0x00000007, 0x0004003b, 0x00000007,
-    0x000003f9, 0x00000007, 0x0004003b, 0x00000007, 0x00000401, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000410, 0x00000007, 0x0004003d, 0x000002b2, 0x000002b5, 0x000002b4, 0x0007004f, 0x0000003c,
-    0x000002b6, 0x000002b5, 0x000002b5, 0x00000000, 0x00000001, 0x0003003e, 0x000002b1, 0x000002b6,
-    0x00050041, 0x000001d2, 0x000002b8, 0x000001d0, 0x000000f9, 0x0004003d, 0x00000006, 0x000002b9,
-    0x000002b8, 0x000500ab, 0x00000048, 0x000002ba, 0x000002b9, 0x00000078, 0x0003003e, 0x000002b7,
-    0x000002ba, 0x0004003d, 0x00000048, 0x000002bc, 0x000002b7, 0x000300f7, 0x000002bf, 0x00000000,
-    0x000400fa, 0x000002bc, 0x000002be, 0x000002c7, 0x000200f8, 0x000002be, 0x00050041, 0x000001d2,
-    0x000002c1, 0x000001d0, 0x000002c0, 0x0004003d, 0x00000006, 0x000002c2, 0x000002c1, 0x00050041,
-    0x000002c3, 0x000002c4, 0x000002b4, 0x00000085, 0x0004003d, 0x00000006, 0x000002c5, 0x000002c4,
-    0x00050080, 0x00000006, 0x000002c6, 0x000002c2, 0x000002c5, 0x0003003e, 0x000002bd, 0x000002c6,
-    0x000200f9, 0x000002bf, 0x000200f8, 0x000002c7, 0x00050041, 0x000001d2, 0x000002c8, 0x000001d0,
-    0x000002c0, 0x0004003d, 0x00000006, 0x000002c9, 0x000002c8, 0x0003003e, 0x000002bd, 0x000002c9,
-    0x000200f9, 0x000002bf, 0x000200f8, 0x000002bf, 0x0004003d, 0x00000006, 0x000002ca, 0x000002bd,
-    0x0003003e, 0x000002bb, 0x000002ca, 0x00050041, 0x00000007, 0x000002cb, 0x000002b1, 0x00000078,
-    0x0004003d, 0x00000006, 0x000002cc, 0x000002cb, 0x000500ae, 0x00000048, 0x000002ce, 0x000002cc,
-    0x000002cd, 0x000400a8, 0x00000048, 0x000002cf, 0x000002ce, 0x000300f7, 0x000002d1, 0x00000000,
-    0x000400fa, 0x000002cf, 0x000002d0, 0x000002d1, 0x000200f8, 0x000002d0, 0x00050041, 0x00000007,
-    0x000002d2, 0x000002b1, 0x0000007d, 0x0004003d, 0x00000006, 0x000002d3, 0x000002d2, 0x000500ae,
-    0x00000048, 0x000002d5, 0x000002d3, 0x000002d4, 0x000200f9, 0x000002d1, 0x000200f8, 0x000002d1,
-    0x000700f5, 0x00000048, 0x000002d6, 0x000002ce, 0x000002bf, 0x000002d5, 0x000002d0, 0x0004003d,
-    0x00000006, 0x000002d7, 0x000002bb, 0x000500ae, 0x00000048, 0x000002d9, 0x000002d7, 0x000002d8,
-    0x000500a6, 0x00000048, 0x000002da, 0x000002d6, 0x000002d9, 0x000300f7, 0x000002dc, 0x00000000,
-    0x000400fa, 0x000002da, 0x000002db, 0x000002dc, 0x000200f8, 0x000002db, 0x000100fd, 0x000200f8,
-    0x000002dc, 0x0004003d, 0x00000006, 0x000002df, 0x000002bb, 0x00050084, 0x00000006, 0x000002e1,
-    0x000002df, 0x000002e0, 0x00050041, 0x00000007, 0x000002e2, 0x000002b1, 0x0000007d, 0x0004003d,
-    0x00000006, 0x000002e3, 0x000002e2, 0x00050080, 0x00000006, 0x000002e4, 0x000002e1, 0x000002e3,
-    0x0003003e, 0x000002de, 0x000002e4, 0x00050041, 0x00000007, 0x000002e6, 0x000002b1, 0x00000078,
-    0x0004003d, 0x00000006, 0x000002e7, 0x000002e6, 0x00050086, 0x00000006, 0x000002e9, 0x000002e7,
-    0x000002e8, 0x0003003e, 0x000002e5, 0x000002e9, 0x0004003d, 0x00000006, 0x000002eb, 0x000002e5,
-    0x0004003d, 0x00000006, 0x000002ec, 0x000002bb, 0x00050084, 0x00000006, 0x000002ed, 0x000002ec,
-    0x000001b4, 0x00050080, 0x00000006, 0x000002ee, 0x000002eb, 0x000002ed, 0x0003003e, 0x000002ea,
-    0x000002ee, 0x0004003d, 0x00000006, 0x000002f1, 0x000002bb, 0x00050084, 0x00000006, 0x000002f2,
-    0x000002f1, 0x0000018c, 0x00050080, 0x00000006, 0x000002f3, 0x000002f0, 0x000002f2, 0x0003003e,
-    0x000002ef, 0x000002f3, 0x0004003d, 0x00000006, 0x000002f5, 0x000002ef, 0x00060041, 0x000001a6,
-    0x000002f6, 0x000001f0, 0x000001a0, 0x000002f5, 0x0004003d, 0x00000006, 0x000002f7, 0x000002f6,
-    0x0003003e, 0x000002f4, 0x000002f7, 0x0004003d, 0x00000006, 0x000002f9, 0x000002ef, 0x00050080,
-    0x00000006, 0x000002fa, 0x000002f9, 0x0000007d, 0x00060041, 0x000001a6, 0x000002fb, 0x000001f0,
-    0x000001a0, 0x000002fa, 0x0004003d, 0x00000006, 0x000002fc, 0x000002fb, 0x0003003e, 0x000002f8,
-    0x000002fc, 0x0004003d, 0x00000006, 0x000002fe, 0x000002ef, 0x00050080, 0x00000006, 0x000002ff,
-    0x000002fe, 0x0000008d, 0x00060041, 0x000001a6, 0x00000300, 0x000001f0, 0x000001a0, 0x000002ff,
-    0x0004003d, 0x00000006, 0x00000301, 0x00000300, 0x0003003e, 0x000002fd, 0x00000301, 0x0004003d,
-    0x00000006, 0x00000302, 0x000002f8, 0x000500c7, 0x00000006, 0x00000303, 0x00000302, 0x0000021b,
-    0x000500aa, 0x00000048, 0x00000304, 0x00000303, 0x00000078, 0x000400a8, 0x00000048, 0x00000305,
-    0x00000304, 0x000300f7, 0x00000307, 0x00000000, 0x000400fa, 0x00000305, 0x00000306, 0x00000307,
-    0x000200f8, 0x00000306, 0x0004003d, 0x00000048, 0x00000308, 0x000002b7, 0x000300f7, 0x0000030a,
-    0x00000000, 0x000400fa, 0x00000308, 0x00000309, 0x0000030a, 0x000200f8, 0x00000309, 0x0004003d,
-    0x00000006, 0x0000030b, 0x000002f8, 0x000500c7, 0x00000006, 0x0000030c, 0x0000030b, 0x000000e9,
-    0x000500aa, 0x00000048, 0x0000030d, 0x0000030c, 0x00000078, 0x000200f9, 0x0000030a, 0x000200f8,
-    0x0000030a, 0x000700f5, 0x00000048, 0x0000030e, 0x00000308, 0x00000306, 0x0000030d, 0x00000309,
-    0x000200f9, 0x00000307, 0x000200f8, 0x00000307, 0x000700f5, 0x00000048, 0x0000030f, 0x00000304,
-    0x000002dc, 0x0000030e, 0x0000030a, 0x0004003d, 0x00000006, 0x00000310, 0x000002e5, 0x0004003d,
-    0x00000006, 0x00000311, 0x000002fd, 0x000500ae, 0x00000048, 0x00000312, 0x00000310, 0x00000311,
-    0x000500a6, 0x00000048, 0x00000313, 0x0000030f, 0x00000312, 0x000300f7, 0x00000315, 0x00000000,
-    0x000400fa, 0x00000313, 0x00000314, 0x00000315, 0x000200f8, 0x00000314, 0x000100fd, 0x000200f8,
-    0x00000315, 0x0004003d, 0x00000006, 0x00000318, 0x000002f8, 0x000500c2, 0x00000006, 0x00000319,
-    0x00000318, 0x0000008d, 0x000500c7, 0x00000006, 0x0000031a, 0x00000319, 0x0000007d, 0x0003003e,
-    0x00000317, 0x0000031a, 0x0004003d, 0x00000006, 0x0000031c, 0x000002f8, 0x000500c7, 0x00000006,
-    0x0000031d, 0x0000031c, 0x000000f7, 0x000500ab, 0x00000048, 0x0000031e, 0x0000031d, 0x00000078,
-    0x0003003e, 0x0000031b, 0x0000031e, 0x0004003d, 0x00000006, 0x00000321, 0x00000317, 0x00050084,
-    0x00000006, 0x00000322, 0x00000321, 0x000002d8, 0x00050080, 0x00000006, 0x00000323, 0x00000320,
-    0x00000322, 0x0004003d, 0x00000006, 0x00000324, 0x000002bb, 0x00050080, 0x00000006, 0x00000325,
-    0x00000323, 0x00000324, 0x00060041, 0x000001a6, 0x00000326, 0x000001f0, 0x000001a0, 0x00000325,
-    0x0004003d, 0x00000006, 0x00000327, 0x00000326, 0x0003003e, 0x0000031f, 0x00000327, 0x0004003d,
-    0x00000006, 0x00000329, 0x000002f4, 0x000500c7, 0x00000006, 0x0000032b, 0x00000329, 0x0000032a,
-    0x000500ab, 0x00000048, 0x0000032c, 0x0000032b, 0x00000078, 0x000300f7, 0x0000032f, 0x00000000,
-    0x000400fa, 0x0000032c, 0x0000032e, 0x0000033e, 0x000200f8, 0x0000032e, 0x0004003d, 0x00000048,
-    0x00000330, 0x0000031b, 0x000300f7, 0x00000333, 0x00000000, 0x000400fa, 0x00000330, 0x00000332,
-    0x0000033c, 0x000200f8, 0x00000332, 0x00050041, 0x00000007, 0x00000334, 0x000002b1, 0x00000078,
-    0x0004003d, 0x00000006, 0x00000335, 0x00000334, 0x0004003d, 0x00000006, 0x00000336, 0x000002de,
-    0x00050050, 0x0000003c, 0x00000337, 0x00000335, 0x00000336, 0x0003003e, 0x00000338, 0x00000337,
-    0x0004003d, 0x00000006, 0x0000033a, 0x0000031f, 0x0003003e, 0x00000339, 0x0000033a, 0x00060039,
-    0x00000006, 0x0000033b, 0x00000046, 0x00000338, 0x00000339, 0x0003003e, 0x00000331, 0x0000033b,
-    0x000200f9, 0x00000333, 0x000200f8, 0x0000033c, 0x0003003e, 0x00000331, 0x00000078, 0x000200f9,
-    0x00000333, 0x000200f8, 0x00000333, 0x0004003d, 0x00000006, 0x0000033d, 0x00000331, 0x0003003e,
-    0x0000032d, 0x0000033d, 0x000200f9, 0x0000032f, 0x000200f8, 0x0000033e, 0x00050041, 0x00000007,
-    0x0000033f, 0x000002b1, 0x00000078, 0x0004003d, 0x00000006, 0x00000340, 0x0000033f, 0x0004003d,
-    0x00000006, 0x00000341, 0x000002de, 0x00050050, 0x0000003c, 0x00000342, 0x00000340, 0x00000341,
-    0x0004003d, 0x00000006, 0x00000344, 0x00000317, 0x0003003e, 0x00000343, 0x00000344, 0x0003003e,
-    0x00000345, 0x00000342, 0x0004003d, 0x00000006, 0x00000347, 0x000002ea, 0x0003003e, 0x00000346,
-    0x00000347, 0x0004003d, 0x00000006, 0x00000349, 0x0000031f, 0x0003003e, 0x00000348, 0x00000349,
-    0x0004003d, 0x00000048, 0x0000034b, 0x0000031b, 0x0003003e, 0x0000034a, 0x0000034b, 0x00090039,
-    0x00000006, 0x0000034c, 0x00000050, 0x00000343, 0x00000345, 0x00000346, 0x00000348, 0x0000034a,
-    0x0003003e, 0x0000032d, 0x0000034c, 0x000200f9, 0x0000032f, 0x000200f8, 0x0000032f, 0x0004003d,
-    0x00000006, 0x0000034d, 0x0000032d, 0x0003003e, 0x00000328, 0x0000034d, 0x0004003d, 0x00000006,
-    0x00000350, 0x000002ea, 0x00050080, 0x00000006, 0x00000351, 0x0000034f, 0x00000350, 0x00060041,
-    0x000001a6, 0x00000352, 0x000001f0, 0x000001a0, 0x00000351, 0x0004003d, 0x00000006, 0x00000353,
-    0x00000352, 0x0003003e, 0x0000034e, 0x00000353, 0x0004003d, 0x00000006, 0x00000355, 0x0000034e,
-    0x000500c7, 0x00000006, 0x00000356, 0x00000355, 0x0000021b, 0x000500ab, 0x00000048, 0x00000357,
-    0x00000356, 0x00000078, 0x000300f7, 0x0000035a, 0x00000000, 0x000400fa, 0x00000357, 0x00000359,
-    0x00000366, 0x000200f8, 0x00000359, 0x00050041, 0x00000007, 0x0000035b, 0x000002b1, 0x00000078,
-    0x0004003d, 0x00000006, 0x0000035c, 0x0000035b, 0x00050089, 0x00000006, 0x0000035e, 0x0000035c,
-    0x0000035d, 0x00050041, 0x00000007, 0x0000035f, 0x000002b1, 0x0000007d, 0x0004003d, 0x00000006,
-    0x00000360, 0x0000035f, 0x00050050, 0x0000003c, 0x00000361, 0x0000035e, 0x00000360, 0x0004003d,
-    0x00000006, 0x00000363, 0x0000034e, 0x0003003e, 0x00000362, 0x00000363, 0x0003003e, 0x00000364,
-    0x00000361, 0x00060039, 0x00000006, 0x00000365, 0x00000041, 0x00000362, 0x00000364, 0x0003003e,
-    0x00000358, 0x00000365, 0x000200f9, 0x0000035a, 0x000200f8, 0x00000366, 0x0004003d, 0x00000006,
-    0x00000368, 0x000002ea, 0x00050080, 0x00000006, 0x00000369, 0x00000367, 0x00000368, 0x00060041,
-    0x000001a6, 0x0000036a, 0x000001f0, 0x000001a0, 0x00000369, 0x0004003d, 0x00000006, 0x0000036b,
-    0x0000036a, 0x0003003e, 0x00000358, 0x0000036b, 0x000200f9, 0x0000035a, 0x000200f8, 0x0000035a,
-    0x0004003d, 0x00000006, 0x0000036c, 0x00000358, 0x0003003e, 0x00000354, 0x0000036c, 0x0004003d,
-    0x00000006, 0x0000036e, 0x000002f4, 0x000500c2, 0x00000006, 0x00000370, 0x0000036e, 0x0000036f,
-    0x000500c7, 0x00000006, 0x00000371, 0x00000370, 0x0000008d, 0x0003003e, 0x0000036d, 0x00000371,
-    0x0004003d, 0x00000006, 0x00000373, 0x00000328, 0x0003003e, 0x00000372, 0x00000373, 0x0004003d,
-    0x00000006, 0x00000374, 0x0000036d, 0x000500aa, 0x00000048, 0x00000375, 0x00000374, 0x0000007d,
-    0x000300f7, 0x00000377, 0x00000000, 0x000400fa, 0x00000375, 0x00000376, 0x00000379, 0x000200f8,
-    0x00000376, 0x0004003d, 0x00000006, 0x00000378, 0x00000354, 0x0003003e, 0x00000372, 0x00000378,
-    0x000200f9, 0x00000377, 0x000200f8, 0x00000379, 0x0004003d, 0x00000006, 0x0000037a, 0x0000036d,
-    0x000500ae, 0x00000048, 0x0000037b, 0x0000037a, 0x00000085, 0x000300f7, 0x0000037d, 0x00000000,
-    0x000400fa, 0x0000037b, 0x0000037c, 0x0000037d, 0x000200f8, 0x0000037c, 0x0004003d, 0x00000006,
-    0x0000037f, 0x000002f4, 0x000500c7, 0x00000006, 0x00000380, 0x0000037f, 0x0000005f, 0x0007000c,
-    0x00000006, 0x00000381, 0x00000001, 0x00000026, 0x00000380, 0x000000f7, 0x0003003e, 0x0000037e,
-    0x00000381, 0x0004003d, 0x00000006, 0x00000383, 0x000002f4, 0x000500c2, 0x00000006, 0x00000384,
-    0x00000383, 0x000000be, 0x000500c7, 0x00000006, 0x00000385, 0x00000384, 0x0000005f, 0x0007000c,
-    0x00000006, 0x00000386, 0x00000001, 0x00000026, 0x00000385, 0x000000f7, 0x0003003e, 0x00000382,
-    0x00000386, 0x0004003d, 0x00000006, 0x00000388, 0x00000328, 0x000500c2, 0x00000006, 0x00000389,
-    0x00000388, 0x00000210, 0x000500ab, 0x00000048, 0x0000038a, 0x00000389, 0x00000078, 0x000600a9,
-    0x00000006, 0x0000038b, 0x0000038a, 0x0000007d, 0x00000078, 0x0003003e, 0x00000387, 0x0000038b,
-    0x0004003d, 0x00000006, 0x0000038d, 0x00000354, 0x000500c2, 0x00000006, 0x0000038e, 0x0000038d,
-    0x00000210, 0x000500ab, 0x00000048, 0x0000038f, 0x0000038e, 0x00000078, 0x000600a9, 0x00000006,
-    0x00000390, 0x0000038f, 0x0000007d, 0x00000078, 0x0003003e, 0x0000038c, 0x00000390, 0x0004003d,
-    0x00000006, 0x00000392, 0x00000328, 0x000500c7, 0x00000006, 0x00000393, 0x00000392, 0x00000056,
-    0x000500c2, 0x00000006, 0x00000394, 0x00000393, 0x0000007d, 0x0004003d, 0x00000006, 0x00000395,
-    0x00000387, 0x00050084, 0x00000006, 0x00000396, 0x00000394, 0x00000395, 0x0004003d, 0x00000006,
-    0x00000397, 0x0000037e, 0x00050084, 0x00000006, 0x00000398, 0x00000396, 0x00000397, 0x0004003d,
-    0x00000006, 0x00000399, 0x00000354, 0x000500c7, 0x00000006, 0x0000039a, 0x00000399, 0x00000056,
-    0x000500c2, 0x00000006, 0x0000039b, 0x0000039a, 0x0000007d, 0x0004003d, 0x00000006, 0x0000039c,
-    0x0000038c, 0x00050084, 0x00000006, 0x0000039d, 0x0000039b, 0x0000039c, 0x0004003d, 0x00000006,
-    0x0000039e, 0x00000382, 0x00050084, 0x00000006, 0x0000039f, 0x0000039d, 0x0000039e, 0x00050080,
-    0x00000006, 0x000003a0, 0x00000398, 0x0000039f, 0x00050080, 0x00000006, 0x000003a1, 0x000003a0,
-    0x000000be, 0x000500c2, 0x00000006, 0x000003a2, 0x000003a1, 0x0000018c, 0x0007000c, 0x00000006,
-    0x000003a3, 0x00000001, 0x00000026, 0x000003a2, 0x0000005f, 0x000500c4, 0x00000006, 0x000003a4,
-    0x000003a3, 0x0000007d, 0x0003003e, 0x00000391, 0x000003a4, 0x0004003d, 0x00000006, 0x000003a6,
-    0x00000328, 0x000500c2, 0x00000006, 0x000003a7, 0x000003a6, 0x000000be, 0x000500c7, 0x00000006,
-    0x000003a8, 0x000003a7, 0x00000056, 0x000500c2, 0x00000006, 0x000003a9, 0x000003a8, 0x0000007d,
-    0x0004003d, 0x00000006, 0x000003aa, 0x00000387, 0x00050084, 0x00000006, 0x000003ab, 0x000003a9,
-    0x000003aa, 0x0004003d, 0x00000006, 0x000003ac, 0x0000037e, 0x00050084, 0x00000006, 0x000003ad,
-    0x000003ab, 0x000003ac, 0x0004003d, 0x00000006, 0x000003ae, 0x00000354, 0x000500c2, 0x00000006,
-    0x000003af, 0x000003ae, 0x000000be, 0x000500c7, 0x00000006, 0x000003b0, 0x000003af, 0x00000056,
-    0x000500c2, 0x00000006, 0x000003b1, 0x000003b0, 0x0000007d, 0x0004003d, 0x00000006, 0x000003b2,
-    0x0000038c, 0x00050084, 0x00000006, 0x000003b3, 0x000003b1, 0x000003b2, 0x0004003d, 0x00000006,
-    0x000003b4, 0x00000382, 0x00050084, 0x00000006, 0x000003b5, 0x000003b3, 0x000003b4, 0x00050080,
-    0x00000006, 0x000003b6, 0x000003ad, 0x000003b5, 0x00050080, 0x00000006, 0x000003b7, 0x000003b6,
-    0x000000be, 0x000500c2, 0x00000006, 0x000003b8, 0x000003b7, 0x0000018c, 0x0007000c, 0x00000006,
-    0x000003b9, 0x00000001, 0x00000026, 0x000003b8, 0x0000005f, 0x000500c4, 0x00000006, 0x000003ba,
-    0x000003b9, 0x0000007d, 0x0003003e, 0x000003a5, 0x000003ba, 0x0004003d, 0x00000006, 0x000003bc,
-    0x00000328, 0x000500c2, 0x00000006, 0x000003bd, 0x000003bc, 0x000000f7, 0x000500c7, 0x00000006,
-    0x000003be, 0x000003bd, 0x00000056, 0x000500c2, 0x00000006, 0x000003bf, 0x000003be, 0x0000007d,
-    0x0004003d, 0x00000006, 0x000003c0, 0x00000387, 0x00050084, 0x00000006, 0x000003c1, 0x000003bf,
-    0x000003c0, 0x0004003d, 0x00000006, 0x000003c2, 0x0000037e, 0x00050084, 0x00000006, 0x000003c3,
-    0x000003c1, 0x000003c2, 0x0004003d, 0x00000006, 0x000003c4, 0x00000354, 0x000500c2, 0x00000006,
-    0x000003c5, 0x000003c4, 0x000000f7, 0x000500c7, 0x00000006, 0x000003c6, 0x000003c5, 0x00000056,
-    0x000500c2, 0x00000006, 0x000003c7, 0x000003c6, 0x0000007d, 0x0004003d, 0x00000006, 0x000003c8,
-    0x0000038c, 0x00050084, 0x00000006, 0x000003c9, 0x000003c7, 0x000003c8, 0x0004003d, 0x00000006,
-    0x000003ca, 0x00000382, 0x00050084, 0x00000006, 0x000003cb, 0x000003c9, 0x000003ca, 0x00050080,
-    0x00000006, 0x000003cc, 0x000003c3, 0x000003cb, 0x00050080, 0x00000006, 0x000003cd, 0x000003cc,
-    0x000000be, 0x000500c2, 0x00000006, 0x000003ce, 0x000003cd, 0x0000018c, 0x0007000c, 0x00000006,
-    0x000003cf, 0x00000001, 0x00000026, 0x000003ce, 0x0000005f, 0x000500c4, 0x00000006, 0x000003d0,
-    0x000003cf, 0x0000007d, 0x0003003e, 0x000003bb, 0x000003d0, 0x0004003d, 0x00000006, 0x000003d2,
-    0x0000037e, 0x000500ab, 0x00000048, 0x000003d3, 0x000003d2, 0x00000078, 0x0004003d, 0x00000006,
-    0x000003d4, 0x00000387, 0x000600a9, 0x00000006, 0x000003d5, 0x000003d3, 0x000003d4, 0x00000078,
-    0x0004003d, 0x00000006, 0x000003d6, 0x00000382, 0x000500ab, 0x00000048, 0x000003d7, 0x000003d6,
-    0x00000078, 0x0004003d, 0x00000006, 0x000003d8, 0x0000038c, 0x000600a9, 0x00000006, 0x000003d9,
-    0x000003d7, 0x000003d8, 0x00000078, 0x000500c5, 0x00000006, 0x000003da, 0x000003d5, 0x000003d9,
-    0x00050084, 0x00000006, 0x000003db, 0x000003da, 0x0000005a, 0x0003003e, 0x000003d1, 0x000003db,
-    0x0004003d, 0x00000006, 0x000003dc, 0x00000391, 0x0004003d, 0x00000006, 0x000003dd, 0x000003a5,
-    0x000500c4, 0x00000006, 0x000003de, 0x000003dd, 0x000000be, 0x000500c5, 0x00000006, 0x000003df,
-    0x000003dc, 0x000003de, 0x0004003d, 0x00000006, 0x000003e0, 0x000003bb, 0x000500c4, 0x00000006,
-    0x000003e1, 0x000003e0, 0x000000f7, 0x000500c5, 0x00000006, 0x000003e2, 0x000003df, 0x000003e1,
-    0x0004003d, 0x00000006, 0x000003e3, 0x000003d1, 0x000500c4, 0x00000006, 0x000003e4, 0x000003e3,
-    0x00000210, 0x000500c5, 0x00000006, 0x000003e5, 0x000003e2, 0x000003e4, 0x0003003e, 0x00000372,
-    0x000003e5, 0x000200f9, 0x0000037d, 0x000200f8, 0x0000037d, 0x000200f9, 0x00000377, 0x000200f8,
-    0x00000377, 0x0004003d, 0x00000006, 0x000003e7, 0x000002ef, 0x00050080, 0x00000006, 0x000003e8,
-    0x000003e7, 0x00000085, 0x00060041, 0x000001a6, 0x000003e9, 0x000001f0, 0x000001a0, 0x000003e8,
-    0x0004003d, 0x00000006, 0x000003ea, 0x000003e9, 0x0004003d, 0x00000006, 0x000003eb, 0x000002e5,
-    0x00050080, 0x00000006, 0x000003ec, 0x000003ea, 0x000003eb, 0x000500c7, 0x00000006, 0x000003ed,
-    0x000003ec, 0x00000177, 0x0003003e, 0x000003e6, 0x000003ed, 0x0004003d, 0x00000006, 0x000003ef,
-    0x000002f8, 0x000500c7, 0x00000006, 0x000003f0, 0x000003ef, 0x0000008d, 0x0003003e, 0x000003ee,
-    0x000003f0, 0x0004003d, 0x00000006, 0x000003f2, 0x000002f8, 0x000500c2, 0x00000006, 0x000003f3,
-    0x000003f2, 0x00000085, 0x000500c7, 0x00000006, 0x000003f4, 0x000003f3, 0x0000007d, 0x0003003e,
-    0x000003f1, 0x000003f4, 0x0003003e, 0x000003f5, 0x000003f8, 0x0004003d, 0x00000006, 0x000003fa,
-    0x000003f1, 0x00050084, 0x00000006, 0x000003fb, 0x000003fa, 0x0000018c, 0x0004003d, 0x00000006,
-    0x000003fc, 0x000003ee, 0x00050080, 0x00000006, 0x000003fd, 0x000003fb, 0x000003fc, 0x00050084,
-    0x00000006, 0x000003fe, 0x000003fd, 0x00000190, 0x0004003d, 0x00000006, 0x000003ff, 0x000003e6,
-    0x00050080, 0x00000006, 0x00000400, 0x000003fe, 0x000003ff, 0x0003003e, 0x000003f9, 0x00000400,
-    0x00050041, 0x00000007, 0x00000402, 0x000002b1, 0x0000007d, 0x0004003d, 0x00000006, 0x00000403,
-    0x00000402, 0x00050084, 0x00000006, 0x00000405, 0x00000403, 0x00000404, 0x00050041, 0x00000007,
-    0x00000406, 0x000002b1, 0x00000078, 0x0004003d, 0x00000006, 0x00000407, 0x00000406, 0x00050089,
-    0x00000006, 0x00000409, 0x00000407, 0x00000408, 0x00050080, 0x00000006, 0x0000040a, 0x00000405,
-    0x00000409, 0x0003003e, 0x00000401, 0x0000040a, 0x0004003d, 0x00000006, 0x0000040b, 0x000003f9,
-    0x0004003d, 0x00000006, 0x0000040c, 0x000003f5, 0x00050084, 0x00000006, 0x0000040d, 0x0000040b,
-    0x0000040c, 0x0004003d, 0x00000006, 0x0000040e, 0x00000401, 0x00050080, 0x00000006, 0x0000040f,
-    0x0000040d, 0x0000040e, 0x0004003d, 0x00000006, 0x00000411, 0x00000372, 0x0003003e, 0x00000410,
-    0x00000411, 0x00050039, 0x00000006, 0x00000412, 0x00000053, 0x00000410, 0x00060041, 0x000001a6,
-    0x00000413, 0x0000019f, 0x000001a0, 0x0000040f, 0x0003003e, 0x00000413, 0x00000412, 0x000100fd,
-    0x00010038, 0x00050036, 0x00000006, 0x0000000a, 0x00000000, 0x00000008, 0x00030037, 0x00000007,
-    0x00000009, 0x000200f8, 0x0000000b, 0x0004003d, 0x00000006, 0x00000055, 0x00000009, 0x00050084,
-    0x00000006, 0x00000057, 0x00000055, 0x00000056, 0x00050080, 0x00000006, 0x00000059, 0x00000057,
-    0x00000058, 0x00050086, 0x00000006, 0x0000005b, 0x00000059, 0x0000005a, 0x000200fe, 0x0000005b,
-    0x00010038, 0x00050036, 0x00000006, 0x0000000d, 0x00000000, 0x00000008, 0x00030037, 0x00000007,
-    0x0000000c, 0x000200f8, 0x0000000e, 0x0004003d, 0x00000006, 0x0000005e, 0x0000000c, 0x00050084,
-    0x00000006, 0x00000060, 0x0000005e, 0x0000005f, 0x00050080, 0x00000006, 0x00000061, 0x00000060,
-    0x00000058, 0x00050086, 0x00000006, 0x00000062, 0x00000061, 0x0000005a, 0x000200fe, 0x00000062,
-    0x00010038, 0x00050036, 0x00000006, 0x00000014, 0x00000000, 0x00000012, 0x00030037, 0x00000011,
-    0x00000013, 0x000200f8, 0x00000015, 0x0004003b, 0x00000067, 0x00000068, 0x00000007, 0x0004003b,
-    0x00000070, 0x00000071, 0x00000007, 0x0004003b, 0x00000007, 0x00000077, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000007c, 0x00000007, 0x0004003b, 0x00000007, 0x00000084, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000008c, 0x00000007, 0x0004003d, 0x00000069, 0x0000006c, 0x0000006b, 0x0004003d,
-    0x00000010, 0x0000006d, 0x00000013, 0x00050062, 0x00000066, 0x0000006e, 0x0000006c, 0x0000006d,
-    0x0003003e, 0x00000068, 0x0000006e, 0x0004003d, 0x00000066, 0x00000072, 0x00000068, 0x0005008e,
-    0x00000066, 0x00000074, 0x00000072, 0x00000073, 0x0006000c, 0x00000066, 0x00000075, 0x00000001,
-    0x00000001, 0x00000074, 0x0004006d, 0x0000006f, 0x00000076, 0x00000075, 0x0003003e, 0x00000071,
-    0x00000076, 0x00050041, 0x00000007, 0x00000079, 0x00000071, 0x00000078, 0x0004003d, 0x00000006,
-    0x0000007a, 0x00000079, 0x0003003e, 0x00000077, 0x0000007a, 0x00050039, 0x00000006, 0x0000007b,
-    0x0000000a, 0x00000077, 0x00050041, 0x00000007, 0x0000007e, 0x00000071, 0x0000007d, 0x0004003d,
-    0x00000006, 0x0000007f, 0x0000007e, 0x0003003e, 0x0000007c, 0x0000007f, 0x00050039, 0x00000006,
-    0x00000080, 0x0000000a, 0x0000007c, 0x000500c4, 0x00000006, 0x00000082, 0x00000080, 0x00000081,
-    0x000500c5, 0x00000006, 0x00000083, 0x0000007b, 0x00000082, 0x00050041, 0x00000007, 0x00000086,
-    0x00000071, 0x00000085, 0x0004003d, 0x00000006, 0x00000087, 0x00000086, 0x0003003e, 0x00000084,
-    0x00000087, 0x00050039, 0x00000006, 0x00000088, 0x0000000a, 0x00000084, 0x000500c4, 0x00000006,
-    0x0000008a, 0x00000088, 0x00000089, 0x000500c5, 0x00000006, 0x0000008b, 0x00000083, 0x0000008a,
-    0x00050041, 0x00000007, 0x0000008e, 0x00000071, 0x0000008d, 0x0004003d, 0x00000006, 0x0000008f,
-    0x0000008e, 0x0003003e, 0x0000008c, 0x0000008f, 0x00050039, 0x00000006, 0x00000090, 0x0000000d,
-    0x0000008c, 0x000500c4, 0x00000006, 0x00000092, 0x00000090, 0x00000091, 0x000500c5, 0x00000006,
-    0x00000093, 0x0000008b, 0x00000092, 0x000200fe, 0x00000093, 0x00010038, 0x00050036, 0x00000006,
-    0x00000017, 0x00000000, 0x00000008, 0x00030037, 0x00000007, 0x00000016, 0x000200f8, 0x00000018,
-    0x0004003d, 0x00000006, 0x00000096, 0x00000016, 0x000500c7, 0x00000006, 0x00000097, 0x00000096,
-    0x00000056, 0x000200fe, 0x00000097, 0x00010038, 0x00050036, 0x00000006, 0x0000001a, 0x00000000,
-    0x00000008, 0x00030037, 0x00000007, 0x00000019, 0x000200f8, 0x0000001b, 0x0004003d, 0x00000006,
-    0x0000009a, 0x00000019, 0x000500c2, 0x00000006, 0x0000009b, 0x0000009a, 0x00000081, 0x000500c7,
-    0x00000006, 0x0000009c, 0x0000009b, 0x00000056, 0x000200fe, 0x0000009c, 0x00010038, 0x00050036,
-    0x00000006, 0x0000001d, 0x00000000, 0x00000008, 0x00030037, 0x00000007, 0x0000001c, 0x000200f8,
-    0x0000001e, 0x0004003d, 0x00000006, 0x0000009f, 0x0000001c, 0x000500c2, 0x00000006, 0x000000a0,
-    0x0000009f, 0x00000089, 0x000500c7, 0x00000006, 0x000000a1, 0x000000a0, 0x00000056, 0x000200fe,
-    0x000000a1, 0x00010038, 0x00050036, 0x00000006, 0x00000024, 0x00000000, 0x0000001f, 0x00030037,
-    0x00000007, 0x00000020, 0x00030037, 0x00000007, 0x00000021, 0x00030037, 0x00000007, 0x00000022,
-    0x00030037, 0x00000007, 0x00000023, 0x000200f8, 0x00000025, 0x0004003d, 0x00000006, 0x000000a4,
-    0x00000020, 0x0007000c, 0x00000006, 0x000000a5, 0x00000001, 0x00000026, 0x000000a4, 0x00000056,
-    0x0004003d, 0x00000006, 0x000000a6, 0x00000021, 0x0007000c, 0x00000006, 0x000000a7, 0x00000001,
-    0x00000026, 0x000000a6, 0x00000056, 0x000500c4, 0x00000006, 0x000000a8, 0x000000a7, 0x00000081,
-    0x000500c5, 0x00000006, 0x000000a9, 0x000000a5, 0x000000a8, 0x0004003d, 0x00000006, 0x000000aa,
-    0x00000022, 0x0007000c, 0x00000006, 0x000000ab, 0x00000001, 0x00000026, 0x000000aa, 0x00000056,
-    0x000500c4, 0x00000006, 0x000000ac, 0x000000ab, 0x00000089, 0x000500c5, 0x00000006, 0x000000ad,
-    0x000000a9, 0x000000ac, 0x0004003d, 0x00000006, 0x000000ae, 0x00000023, 0x000500c4, 0x00000006,
-    0x000000af, 0x000000ae, 0x00000091, 0x000500c5, 0x00000006, 0x000000b0, 0x000000ad, 0x000000af,
-    0x000200fe, 0x000000b0, 0x00010038, 0x00050036, 0x00000006, 0x0000002a, 0x00000000, 0x0000001f,
-    0x00030037, 0x00000007, 0x00000026, 0x00030037, 0x00000007, 0x00000027, 0x00030037, 0x00000007,
-    0x00000028, 0x00030037, 0x00000007, 0x00000029, 0x000200f8, 0x0000002b, 0x0004003b, 0x00000007,
-    0x000000b3, 0x00000007, 0x0004003b, 0x00000007, 0x000000b8, 0x00000007, 0x0004003b, 0x00000007,
-    0x000000c2, 0x00000007, 0x0004003b, 0x00000007, 0x000000c7, 0x00000007, 0x0004003b, 0x00000007,
-    0x000000cf, 0x00000007, 0x0004003b, 0x00000007, 0x000000d4, 0x00000007, 0x0004003b, 0x00000007,
-    0x000000dc, 0x00000007, 0x0004003b, 0x00000007, 0x000000dd, 0x00000007, 0x0004003b, 0x00000007,
-    0x000000de, 0x00000007, 0x0004003b, 0x00000007, 0x000000df, 0x00000007, 0x0004003d, 0x00000006,
-    0x000000b4, 0x00000026, 0x0003003e, 0x000000b3, 0x000000b4, 0x00050039, 0x00000006, 0x000000b5,
-    0x00000017, 0x000000b3, 0x0004003d, 0x00000006, 0x000000b6, 0x00000028, 0x00050084, 0x00000006,
-    0x000000b7, 0x000000b5, 0x000000b6, 0x0004003d, 0x00000006, 0x000000b9, 0x00000027, 0x0003003e,
-    0x000000b8, 0x000000b9, 0x00050039, 0x00000006, 0x000000ba, 0x00000017, 0x000000b8, 0x0004003d,
-    0x00000006, 0x000000bb, 0x00000029, 0x00050084, 0x00000006, 0x000000bc, 0x000000ba, 0x000000bb,
-    0x00050080, 0x00000006, 0x000000bd, 0x000000b7, 0x000000bc, 0x00050080, 0x00000006, 0x000000bf,
-    0x000000bd, 0x000000be, 0x000500c2, 0x00000006, 0x000000c1, 0x000000bf, 0x000000c0, 0x0004003d,
-    0x00000006, 0x000000c3, 0x00000026, 0x0003003e, 0x000000c2, 0x000000c3, 0x00050039, 0x00000006,
-    0x000000c4, 0x0000001a, 0x000000c2, 0x0004003d, 0x00000006, 0x000000c5, 0x00000028, 0x00050084,
-    0x00000006, 0x000000c6, 0x000000c4, 0x000000c5, 0x0004003d, 0x00000006, 0x000000c8, 0x00000027,
-    0x0003003e, 0x000000c7, 0x000000c8, 0x00050039, 0x00000006, 0x000000c9, 0x0000001a, 0x000000c7,
-    0x0004003d, 0x00000006, 0x000000ca, 0x00000029, 0x00050084, 0x00000006, 0x000000cb, 0x000000c9,
-    0x000000ca, 0x00050080, 0x00000006, 0x000000cc, 0x000000c6, 0x000000cb, 0x00050080, 0x00000006,
-    0x000000cd, 0x000000cc, 0x000000be, 0x000500c2, 0x00000006, 0x000000ce, 0x000000cd, 0x000000c0,
-    0x0004003d, 0x00000006, 0x000000d0, 0x00000026, 0x0003003e, 0x000000cf, 0x000000d0, 0x00050039,
-    0x00000006, 0x000000d1, 0x0000001d, 0x000000cf, 0x0004003d, 0x00000006, 0x000000d2, 0x00000028,
-    0x00050084, 0x00000006, 0x000000d3, 0x000000d1, 0x000000d2, 0x0004003d, 0x00000006, 0x000000d5,
-    0x00000027, 0x0003003e, 0x000000d4, 0x000000d5, 0x00050039, 0x00000006, 0x000000d6, 0x0000001d,
-    0x000000d4, 0x0004003d, 0x00000006, 0x000000d7, 0x00000029, 0x00050084, 0x00000006, 0x000000d8,
-    0x000000d6, 0x000000d7, 0x00050080, 0x00000006, 0x000000d9, 0x000000d3, 0x000000d8, 0x00050080,
-    0x00000006, 0x000000da, 0x000000d9, 0x000000be, 0x000500c2, 0x00000006, 0x000000db, 0x000000da,
-    0x000000c0, 0x0003003e, 0x000000dc, 0x000000c1, 0x0003003e, 0x000000dd, 0x000000ce, 0x0003003e,
-    0x000000de, 0x000000db, 0x0003003e, 0x000000df, 0x0000005a, 0x00080039, 0x00000006, 0x000000e0,
-    0x00000024, 0x000000dc, 0x000000dd, 0x000000de, 0x000000df, 0x000200fe, 0x000000e0, 0x00010038,
-    0x00050036, 0x00000006, 0x0000002f, 0x00000000, 0x0000002c, 0x00030037, 0x00000007, 0x0000002d,
-    0x00030037, 0x00000007, 0x0000002e, 0x000200f8, 0x00000030, 0x0004003b, 0x00000007, 0x000000e3,
-    0x00000007, 0x0004003b, 0x00000007, 0x000000e8, 0x00000007, 0x0004003b, 0x00000007, 0x000000ec,
-    0x00000007, 0x0004003b, 0x00000007, 0x000000f1, 0x00000007, 0x0004003b, 0x00000007, 0x000000fb,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000100, 0x00000007, 0x0004003b, 0x00000007, 0x00000108,
-    0x00000007, 0x0004003b, 0x00000007, 0x0000010d, 0x00000007, 0x0004003b, 0x00000007, 0x00000115,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000116, 0x00000007, 0x0004003b, 0x00000007, 0x00000117,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000118, 0x00000007, 0x0004003d, 0x00000006, 0x000000e4,
-    0x0000002d, 0x000500c2, 0x00000006, 0x000000e5, 0x000000e4, 0x00000091, 0x000500c7, 0x00000006,
-    0x000000e6, 0x000000e5, 0x0000005f, 0x00050080, 0x00000006, 0x000000e7, 0x000000e6, 0x0000007d,
-    0x0003003e, 0x000000e3, 0x000000e7, 0x0004003d, 0x00000006, 0x000000ea, 0x000000e3, 0x00050082,
-    0x00000006, 0x000000eb, 0x000000e9, 0x000000ea, 0x0003003e, 0x000000e8, 0x000000eb, 0x0004003d,
-    0x00000006, 0x000000ed, 0x0000002d, 0x0003003e, 0x000000ec, 0x000000ed, 0x00050039, 0x00000006,
-    0x000000ee, 0x00000017, 0x000000ec, 0x0004003d, 0x00000006, 0x000000ef, 0x000000e3, 0x00050084,
-    0x00000006, 0x000000f0, 0x000000ee, 0x000000ef, 0x0004003d, 0x00000006, 0x000000f2, 0x0000002e,
-    0x0003003e, 0x000000f1, 0x000000f2, 0x00050039, 0x00000006, 0x000000f3, 0x00000017, 0x000000f1,
-    0x0004003d, 0x00000006, 0x000000f4, 0x000000e8, 0x00050084, 0x00000006, 0x000000f5, 0x000000f3,
-    0x000000f4, 0x00050080, 0x00000006, 0x000000f6, 0x000000f0, 0x000000f5, 0x00050080, 0x00000006,
-    0x000000f8, 0x000000f6, 0x000000f7, 0x000500c2, 0x00000006, 0x000000fa, 0x000000f8, 0x000000f9,
-    0x0004003d, 0x00000006, 0x000000fc, 0x0000002d, 0x0003003e, 0x000000fb, 0x000000fc, 0x00050039,
-    0x00000006, 0x000000fd, 0x0000001a, 0x000000fb, 0x0004003d, 0x00000006, 0x000000fe, 0x000000e3,
-    0x00050084, 0x00000006, 0x000000ff, 0x000000fd, 0x000000fe, 0x0004003d, 0x00000006, 0x00000101,
-    0x0000002e, 0x0003003e, 0x00000100, 0x00000101, 0x00050039, 0x00000006, 0x00000102, 0x0000001a,
-    0x00000100, 0x0004003d, 0x00000006, 0x00000103, 0x000000e8, 0x00050084, 0x00000006, 0x00000104,
-    0x00000102, 0x00000103, 0x00050080, 0x00000006, 0x00000105, 0x000000ff, 0x00000104, 0x00050080,
-    0x00000006, 0x00000106, 0x00000105, 0x000000f7, 0x000500c2, 0x00000006, 0x00000107, 0x00000106,
-    0x000000f9, 0x0004003d, 0x00000006, 0x00000109, 0x0000002d, 0x0003003e, 0x00000108, 0x00000109,
-    0x00050039, 0x00000006, 0x0000010a, 0x0000001d, 0x00000108, 0x0004003d, 0x00000006, 0x0000010b,
-    0x000000e3, 0x00050084, 0x00000006, 0x0000010c, 0x0000010a, 0x0000010b, 0x0004003d, 0x00000006,
-    0x0000010e, 0x0000002e, 0x0003003e, 0x0000010d, 0x0000010e, 0x00050039, 0x00000006, 0x0000010f,
-    0x0000001d, 0x0000010d, 0x0004003d, 0x00000006, 0x00000110, 0x000000e8, 0x00050084, 0x00000006,
-    0x00000111, 0x0000010f, 0x00000110, 0x00050080, 0x00000006, 0x00000112, 0x0000010c, 0x00000111,
-    0x00050080, 0x00000006, 0x00000113, 0x00000112, 0x000000f7, 0x000500c2, 0x00000006, 0x00000114,
-    0x00000113, 0x000000f9, 0x0003003e, 0x00000115, 0x000000fa, 0x0003003e, 0x00000116, 0x00000107,
-    0x0003003e, 0x00000117, 0x00000114, 0x0003003e, 0x00000118, 0x0000005a, 0x00080039, 0x00000006,
-    0x00000119, 0x00000024, 0x00000115, 0x00000116, 0x00000117, 0x00000118, 0x000200fe, 0x00000119,
-    0x00010038, 0x00050036, 0x00000006, 0x00000035, 0x00000000, 0x00000031, 0x00030037, 0x00000007,
-    0x00000032, 0x00030037, 0x00000007, 0x00000033, 0x00030037, 0x00000007, 0x00000034, 0x000200f8,
-    0x00000036, 0x0004003b, 0x00000007, 0x0000011c, 0x00000007, 0x0004003b, 0x00000007, 0x0000011f,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000129, 0x00000007, 0x0004003b, 0x00000007, 0x0000012c,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000136, 0x00000007, 0x0004003b, 0x00000007, 0x00000139,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000143, 0x00000007, 0x0004003b, 0x00000007, 0x00000144,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000145, 0x00000007, 0x0004003b, 0x00000007, 0x00000146,
-    0x00000007, 0x0004003d, 0x00000006, 0x0000011d, 0x00000032, 0x0003003e, 0x0000011c, 0x0000011d,
-    0x00050039, 0x00000006, 0x0000011e, 0x00000017, 0x0000011c, 0x0004003d, 0x00000006, 0x00000120,
-    0x00000032, 0x0003003e, 0x0000011f, 0x00000120, 0x00050039, 0x00000006, 0x00000121, 0x00000017,
-    0x0000011f, 0x00050082, 0x00000006, 0x00000122, 0x00000056, 0x00000121, 0x0004003d, 0x00000006,
-    0x00000123, 0x00000033, 0x00050084, 0x00000006, 0x00000124, 0x00000122, 0x00000123, 0x0004003d,
-    0x00000006, 0x00000125, 0x00000034, 0x00050080, 0x00000006, 0x00000126, 0x00000124, 0x00000125,
-    0x000500c2, 0x00000006, 0x00000127, 0x00000126, 0x000000c0, 0x00050080, 0x00000006, 0x00000128,
-    0x0000011e, 0x00000127, 0x0004003d, 0x00000006, 0x0000012a, 0x00000032, 0x0003003e, 0x00000129,
-    0x0000012a, 0x00050039, 0x00000006, 0x0000012b, 0x0000001a, 0x00000129, 0x0004003d, 0x00000006,
-    0x0000012d, 0x00000032, 0x0003003e, 0x0000012c, 0x0000012d, 0x00050039, 0x00000006, 0x0000012e,
-    0x0000001a, 0x0000012c, 0x00050082, 0x00000006, 0x0000012f, 0x00000056, 0x0000012e, 0x0004003d,
-    0x00000006, 0x00000130, 0x00000033, 0x00050084, 0x00000006, 0x00000131, 0x0000012f, 0x00000130,
-    0x0004003d, 0x00000006, 0x00000132, 0x00000034, 0x00050080, 0x00000006, 0x00000133, 0x00000131,
-    0x00000132, 0x000500c2, 0x00000006, 0x00000134, 0x00000133, 0x000000c0, 0x00050080, 0x00000006,
-    0x00000135, 0x0000012b, 0x00000134, 0x0004003d, 0x00000006, 0x00000137, 0x00000032, 0x0003003e,
-    0x00000136, 0x00000137, 0x00050039, 0x00000006, 0x00000138, 0x0000001d, 0x00000136, 0x0004003d,
-    0x00000006, 0x0000013a, 0x00000032, 0x0003003e, 0x00000139, 0x0000013a, 0x00050039, 0x00000006,
-    0x0000013b, 0x0000001d, 0x00000139, 0x00050082, 0x00000006, 0x0000013c, 0x00000056, 0x0000013b,
-    0x0004003d, 0x00000006, 0x0000013d, 0x00000033, 0x00050084, 0x00000006, 0x0000013e, 0x0000013c,
-    0x0000013d, 0x0004003d, 0x00000006, 0x0000013f, 0x00000034, 0x00050080, 0x00000006, 0x00000140,
-    0x0000013e, 0x0000013f, 0x000500c2, 0x00000006, 0x00000141, 0x00000140, 0x000000c0, 0x00050080,
-    0x00000006, 0x00000142, 0x00000138, 0x00000141, 0x0003003e, 0x00000143, 0x00000128, 0x0003003e,
-    0x00000144, 0x00000135, 0x0003003e, 0x00000145, 0x00000142, 0x0003003e, 0x00000146, 0x0000005a,
-    0x00080039, 0x00000006, 0x00000147, 0x00000024, 0x00000143, 0x00000144, 0x00000145, 0x00000146,
-    0x000200fe, 0x00000147, 0x00010038, 0x00050036, 0x00000006, 0x0000003a, 0x00000000, 0x00000031,
-    0x00030037, 0x00000007, 0x00000037, 0x00030037, 0x00000007, 0x00000038, 0x00030037, 0x00000007,
-    0x00000039, 0x000200f8, 0x0000003b, 0x0004003b, 0x00000007, 0x0000014a, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000014d, 0x00000007, 0x0004003b, 0x00000007, 0x00000156, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000159, 0x00000007, 0x0004003b, 0x00000007, 0x00000162, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000165, 0x00000007, 0x0004003b, 0x00000007, 0x0000016e, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000016f, 0x00000007, 0x0004003b, 0x00000007, 0x00000170, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000171, 0x00000007, 0x0004003d, 0x00000006, 0x0000014b, 0x00000037, 0x0003003e,
-    0x0000014a, 0x0000014b, 0x00050039, 0x00000006, 0x0000014c, 0x00000017, 0x0000014a, 0x0004003d,
-    0x00000006, 0x0000014e, 0x00000037, 0x0003003e, 0x0000014d, 0x0000014e, 0x00050039, 0x00000006,
-    0x0000014f, 0x00000017, 0x0000014d, 0x0004003d, 0x00000006, 0x00000150, 0x00000038, 0x00050084,
-    0x00000006, 0x00000151, 0x0000014f, 0x00000150, 0x0004003d, 0x00000006, 0x00000152, 0x00000039,
-    0x00050080, 0x00000006, 0x00000153, 0x00000151, 0x00000152, 0x000500c2, 0x00000006, 0x00000154,
-    0x00000153, 0x000000c0, 0x00050082, 0x00000006, 0x00000155, 0x0000014c, 0x00000154, 0x0004003d,
-    0x00000006, 0x00000157, 0x00000037, 0x0003003e, 0x00000156, 0x00000157, 0x00050039, 0x00000006,
-    0x00000158, 0x0000001a, 0x00000156, 0x0004003d, 0x00000006, 0x0000015a, 0x00000037, 0x0003003e,
-    0x00000159, 0x0000015a, 0x00050039, 0x00000006, 0x0000015b, 0x0000001a, 0x00000159, 0x0004003d,
-    0x00000006, 0x0000015c, 0x00000038, 0x00050084, 0x00000006, 0x0000015d, 0x0000015b, 0x0000015c,
-    0x0004003d, 0x00000006, 0x0000015e, 0x00000039, 0x00050080, 0x00000006, 0x0000015f, 0x0000015d,
-    0x0000015e, 0x000500c2, 0x00000006, 0x00000160, 0x0000015f, 0x000000c0, 0x00050082, 0x00000006,
-    0x00000161, 0x00000158, 0x00000160, 0x0004003d, 0x00000006, 0x00000163, 0x00000037, 0x0003003e,
-    0x00000162, 0x00000163, 0x00050039, 0x00000006, 0x00000164, 0x0000001d, 0x00000162, 0x0004003d,
-    0x00000006, 0x00000166, 0x00000037, 0x0003003e, 0x00000165, 0x00000166, 0x00050039, 0x00000006,
-    0x00000167, 0x0000001d, 0x00000165, 0x0004003d, 0x00000006, 0x00000168, 0x00000038, 0x00050084,
-    0x00000006, 0x00000169, 0x00000167, 0x00000168, 0x0004003d, 0x00000006, 0x0000016a, 0x00000039,
-    0x00050080, 0x00000006, 0x0000016b, 0x00000169, 0x0000016a, 0x000500c2, 0x00000006, 0x0000016c,
-    0x0000016b, 0x000000c0, 0x00050082, 0x00000006, 0x0000016d, 0x00000164, 0x0000016c, 0x0003003e,
-    0x0000016e, 0x00000155, 0x0003003e, 0x0000016f, 0x00000161, 0x0003003e, 0x00000170, 0x0000016d,
-    0x0003003e, 0x00000171, 0x0000005a, 0x00080039, 0x00000006, 0x00000172, 0x00000024, 0x0000016e,
-    0x0000016f, 0x00000170, 0x00000171, 0x000200fe, 0x00000172, 0x00010038, 0x00050036, 0x00000006,
-    0x00000041, 0x00000000, 0x0000003e, 0x00030037, 0x00000007, 0x0000003f, 0x00030037, 0x0000003d,
-    0x00000040, 0x000200f8, 0x00000042, 0x0004003b, 0x00000007, 0x00000175, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000179, 0x00000007, 0x0004003b, 0x00000007, 0x0000017e, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000183, 0x00000007, 0x0004003b, 0x00000007, 0x0000018a, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000194, 0x00000007, 0x0004003d, 0x00000006, 0x00000176, 0x0000003f, 0x000500c7,
-    0x00000006, 0x00000178, 0x00000176, 0x00000177, 0x0003003e, 0x00000175, 0x00000178, 0x0004003d,
-    0x00000006, 0x0000017a, 0x0000003f, 0x000500c2, 0x00000006, 0x0000017c, 0x0000017a, 0x0000017b,
-    0x000500c7, 0x00000006, 0x0000017d, 0x0000017c, 0x0000008d, 0x0003003e, 0x00000179, 0x0000017d,
-    0x0004003d, 0x00000006, 0x0000017f, 0x0000003f, 0x000500c2, 0x00000006, 0x00000181, 0x0000017f,
-    0x00000180, 0x000500c7, 0x00000006, 0x00000182, 0x00000181, 0x0000007d, 0x0003003e, 0x0000017e,
-    0x00000182, 0x0003003e, 0x00000183, 0x00000189, 0x0004003d, 0x00000006, 0x0000018b, 0x0000017e,
-    0x00050084, 0x00000006, 0x0000018d, 0x0000018b, 0x0000018c, 0x0004003d, 0x00000006, 0x0000018e,
-    0x00000179, 0x00050080, 0x00000006, 0x0000018f, 0x0000018d, 0x0000018e, 0x00050084, 0x00000006,
-    0x00000191, 0x0000018f, 0x00000190, 0x0004003d, 0x00000006, 0x00000192, 0x00000175, 0x00050080,
-    0x00000006, 0x00000193, 0x00000191, 0x00000192, 0x0003003e, 0x0000018a, 0x00000193, 0x00050041,
-    0x00000007, 0x00000195, 0x00000040, 0x0000007d, 0x0004003d, 0x00000006, 0x00000196, 0x00000195,
-    0x00050084, 0x00000006, 0x00000198, 0x00000196, 0x00000197, 0x00050041, 0x00000007, 0x00000199,
-    0x00000040, 0x00000078, 0x0004003d, 0x00000006, 0x0000019a, 0x00000199, 0x00050080, 0x00000006,
-    0x0000019b, 0x00000198, 0x0000019a, 0x0003003e, 0x00000194, 0x0000019b, 0x0004003d, 0x00000006,
-    0x000001a1, 0x0000018a, 0x0004003d, 0x00000006, 0x000001a2, 0x00000183, 0x00050084, 0x00000006,
-    0x000001a3, 0x000001a1, 0x000001a2, 0x0004003d, 0x00000006, 0x000001a4, 0x00000194, 0x00050080,
-    0x00000006, 0x000001a5, 0x000001a3, 0x000001a4, 0x00060041, 0x000001a6, 0x000001a7, 0x0000019f,
-    0x000001a0, 0x000001a5, 0x0004003d, 0x00000006, 0x000001a8, 0x000001a7, 0x000200fe, 0x000001a8,
-    0x00010038, 0x00050036, 0x00000006, 0x00000046, 0x00000000, 0x00000043, 0x00030037, 0x0000003d,
-    0x00000044, 0x00030037, 0x00000007, 0x00000045, 0x000200f8, 0x00000047, 0x0004003b, 0x00000007,
-    0x000001ab, 0x00000007, 0x0004003b, 0x000001b1, 0x000001b2, 0x00000007, 0x0004003b, 0x000001b1,
-    0x000001b7, 0x00000007, 0x0004003b, 0x00000007, 0x000001dc, 0x00000007, 0x0004003b, 0x00000011,
-    0x000001e4, 0x00000007, 0x0004003d, 0x00000006, 0x000001ac, 0x00000045, 0x000500c2, 0x00000006,
-    0x000001ae, 0x000001ac, 0x000001ad, 0x000500c7, 0x00000006, 0x000001b0, 0x000001ae, 0x000001af,
-    0x0003003e, 0x000001ab, 0x000001b0, 0x0004003d, 0x00000006, 0x000001b3, 0x000001ab, 0x000500c7,
-    0x00000006, 0x000001b5, 0x000001b3, 0x000001b4, 0x000500ab, 0x00000048, 0x000001b6, 0x000001b5,
-    0x00000078, 0x000300f7, 0x000001b9, 0x00000000, 0x000400fa, 0x000001b6, 0x000001b8, 0x000001c4,
-    0x000200f8, 0x000001b8, 0x00050041, 0x00000007, 0x000001ba, 0x00000044, 0x00000078, 0x0004003d,
-    0x00000006, 0x000001bb, 0x000001ba, 0x0004007c, 0x0000000f, 0x000001bc, 0x000001bb, 0x0004003d,
-    0x00000006, 0x000001be, 0x000001ab, 0x00050082, 0x00000006, 0x000001bf, 0x000001bd, 0x000001be,
-    0x00050084, 0x00000006, 0x000001c1, 0x000001bf, 0x000001c0, 0x0004007c, 0x0000000f, 0x000001c2,
-    0x000001c1, 0x00050082, 0x0000000f, 0x000001c3, 0x000001bc, 0x000001c2, 0x0003003e, 0x000001b7,
-    0x000001c3, 0x000200f9, 0x000001b9, 0x000200f8, 0x000001c4, 0x00050041, 0x00000007, 0x000001c5,
-    0x00000044, 0x00000078, 0x0004003d, 0x00000006, 0x000001c6, 0x000001c5, 0x0004007c, 0x0000000f,
-    0x000001c7, 0x000001c6, 0x0004003d, 0x00000006, 0x000001c8, 0x000001ab, 0x00050084, 0x00000006,
-    0x000001ca, 0x000001c8, 0x000001c9, 0x0004007c, 0x0000000f, 0x000001cb, 0x000001ca, 0x00050080,
-    0x0000000f, 0x000001cc, 0x000001c7, 0x000001cb, 0x0003003e, 0x000001b7, 0x000001cc, 0x000200f9,
-    0x000001b9, 0x000200f8, 0x000001b9, 0x0004003d, 0x0000000f, 0x000001cd, 0x000001b7, 0x0003003e,
-    0x000001b2, 0x000001cd, 0x00050041, 0x000001d2, 0x000001d3, 0x000001d0, 0x000001d1, 0x0004003d,
-    0x00000006, 0x000001d4, 0x000001d3, 0x000500ab, 0x00000048, 0x000001d5, 0x000001d4, 0x00000078,
-    0x0004003d, 0x0000000f, 0x000001d6, 0x000001b2, 0x000500af, 0x00000048, 0x000001d7, 0x000001d6,
-    0x000001a0, 0x000500a7, 0x00000048, 0x000001d8, 0x000001d5, 0x000001d7, 0x0004003d, 0x0000000f,
-    0x000001d9, 0x000001b2, 0x000500b1, 0x00000048, 0x000001da, 0x000001d9, 0x00000184, 0x000500a7,
-    0x00000048, 0x000001db, 0x000001d8, 0x000001da, 0x000300f7, 0x000001de, 0x00000000, 0x000400fa,
-    0x000001db, 0x000001dd, 0x000001e6, 0x000200f8, 0x000001dd, 0x0004003d, 0x0000000f, 0x000001df,
-    0x000001b2, 0x00050041, 0x00000007, 0x000001e0, 0x00000044, 0x0000007d, 0x0004003d, 0x00000006,
-    0x000001e1, 0x000001e0, 0x0004007c, 0x0000000f, 0x000001e2, 0x000001e1, 0x00050050, 0x00000010,
-    0x000001e3, 0x000001df, 0x000001e2, 0x0003003e, 0x000001e4, 0x000001e3, 0x00050039, 0x00000006,
-    0x000001e5, 0x00000014, 0x000001e4, 0x0003003e, 0x000001dc, 0x000001e5, 0x000200f9, 0x000001de,
-    0x000200f8, 0x000001e6, 0x0003003e, 0x000001dc, 0x00000078, 0x000200f9, 0x000001de, 0x000200f8,
-    0x000001de, 0x0004003d, 0x00000006, 0x000001e7, 0x000001dc, 0x000200fe, 0x000001e7, 0x00010038,
-    0x00050036, 0x00000006, 0x00000050, 0x00000000, 0x0000004a, 0x00030037, 0x00000007, 0x0000004b,
-    0x00030037, 0x0000003d, 0x0000004c, 0x00030037, 0x00000007, 0x0000004d, 0x00030037, 0x00000007,
-    0x0000004e, 0x00030037, 0x00000049, 0x0000004f, 0x000200f8, 0x00000051, 0x0004003b, 0x00000007,
-    0x000001ea, 0x00000007, 0x0004003b, 0x00000007, 0x000001ec, 0x00000007, 0x0004003b, 0x00000007,
-    0x000001f6, 0x00000007, 0x0004003b, 0x00000007, 0x000001fe, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000206, 0x00000007, 0x0004003b, 0x00000007, 0x0000020e, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000212, 0x00000007, 0x0004003b, 0x00000007, 0x00000224, 0x00000007, 0x0004003b, 0x0000003d,
-    0x00000226, 0x00000007, 0x0004003b, 0x00000007, 0x0000022b, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000235, 0x00000007, 0x0004003b, 0x0000003d, 0x00000237, 0x00000007, 0x0004003b, 0x0000003d,
-    0x0000023d, 0x00000007, 0x0004003b, 0x00000007, 0x0000023f, 0x00000007, 0x0004003b, 0x00000007,
-    0x0000024a, 0x00000007, 0x0004003b, 0x00000007, 0x0000024e, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000252, 0x00000007, 0x0004003b, 0x00000007, 0x00000261, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000263, 0x00000007, 0x0004003b, 0x00000007, 0x00000265, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000267, 0x00000007, 0x0004003b, 0x00000007, 0x0000026f, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000271, 0x00000007, 0x0004003b, 0x00000007, 0x00000273, 0x00000007, 0x0004003b, 0x00000007,
-    0x0000027b, 0x00000007, 0x0004003b, 0x00000007, 0x0000027d, 0x00000007, 0x0004003b, 0x00000007,
-    0x0000027f, 0x00000007, 0x0004003b, 0x00000007, 0x00000286, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000288, 0x00000007, 0x0003003e, 0x000001ea, 0x000001eb, 0x0004003d, 0x00000006, 0x000001f1,
-    0x000001ea, 0x0004003d, 0x00000006, 0x000001f2, 0x0000004d, 0x00050080, 0x00000006, 0x000001f3,
-    0x000001f1, 0x000001f2, 0x00060041, 0x000001a6, 0x000001f4, 0x000001f0, 0x000001a0, 0x000001f3,
-    0x0004003d, 0x00000006, 0x000001f5, 0x000001f4, 0x0003003e, 0x000001ec, 0x000001f5, 0x0004003d,
-    0x00000006, 0x000001f7, 0x000001ea, 0x00050080, 0x00000006, 0x000001f9, 0x000001f7, 0x000001f8,
-    0x0004003d, 0x00000006, 0x000001fa, 0x0000004d, 0x00050080, 0x00000006, 0x000001fb, 0x000001f9,
-    0x000001fa, 0x00060041, 0x000001a6, 0x000001fc, 0x000001f0, 0x000001a0, 0x000001fb, 0x0004003d,
-    0x00000006, 0x000001fd, 0x000001fc, 0x0003003e, 0x000001f6, 0x000001fd, 0x0004003d, 0x00000006,
-    0x000001ff, 0x000001ea, 0x00050080, 0x00000006, 0x00000201, 0x000001ff, 0x00000200, 0x0004003d,
-    0x00000006, 0x00000202, 0x0000004d, 0x00050080, 0x00000006, 0x00000203, 0x00000201, 0x00000202,
-    0x00060041, 0x000001a6, 0x00000204, 0x000001f0, 0x000001a0, 0x00000203, 0x0004003d, 0x00000006,
-    0x00000205, 0x00000204, 0x0003003e, 0x000001fe, 0x00000205, 0x0004003d, 0x00000006, 0x00000207,
-    0x000001ea, 0x00050080, 0x00000006, 0x00000209, 0x00000207, 0x00000208, 0x0004003d, 0x00000006,
-    0x0000020a, 0x0000004d, 0x00050080, 0x00000006, 0x0000020b, 0x00000209, 0x0000020a, 0x00060041,
-    0x000001a6, 0x0000020c, 0x000001f0, 0x000001a0, 0x0000020b, 0x0004003d, 0x00000006, 0x0000020d,
-    0x0000020c, 0x0003003e, 0x00000206, 0x0000020d, 0x0004003d, 0x00000006, 0x0000020f, 0x000001fe,
-    0x000500c2, 0x00000006, 0x00000211, 0x0000020f, 0x00000210, 0x0003003e, 0x0000020e, 0x00000211,
-    0x0004003d, 0x00000006, 0x00000213, 0x000001ec, 0x0003003e, 0x00000212, 0x00000213, 0x0004003d,
-    0x00000006, 0x00000214, 0x0000020e, 0x000500c7, 0x00000006, 0x00000216, 0x00000214, 0x00000215,
-    0x000500aa, 0x00000048, 0x00000217, 0x00000216, 0x00000078, 0x000300f7, 0x00000219, 0x00000000,
-    0x000400fa, 0x00000217, 0x00000218, 0x00000219, 0x000200f8, 0x00000218, 0x0004003d, 0x00000006,
-    0x0000021a, 0x00000206, 0x000500c7, 0x00000006, 0x0000021c, 0x0000021a, 0x0000021b, 0x000500ab,
-    0x00000048, 0x0000021d, 0x0000021c, 0x00000078, 0x000300f7, 0x0000021f, 0x00000000, 0x000400fa,
-    0x0000021d, 0x0000021e, 0x0000021f, 0x000200f8, 0x0000021e, 0x0004003d, 0x0000003c, 0x00000220,
-    0x0000004c, 0x00050050, 0x0000003c, 0x00000222, 0x00000221, 0x00000221, 0x00050089, 0x0000003c,
-    0x00000223, 0x00000220, 0x00000222, 0x0004003d, 0x00000006, 0x00000225, 0x00000206, 0x0003003e,
-    0x00000224, 0x00000225, 0x0003003e, 0x00000226, 0x00000223, 0x00060039, 0x00000006, 0x00000227,
-    0x00000041, 0x00000224, 0x00000226, 0x000200fe, 0x00000227, 0x000200f8, 0x0000021f, 0x0004003d,
-    0x00000006, 0x00000229, 0x00000212, 0x000200fe, 0x00000229, 0x000200f8, 0x00000219, 0x0003003e,
-    0x0000022b, 0x00000078, 0x0004003d, 0x00000006, 0x0000022c, 0x00000206, 0x000500c7, 0x00000006,
-    0x0000022d, 0x0000022c, 0x0000021b, 0x000500ab, 0x00000048, 0x0000022e, 0x0000022d, 0x00000078,
-    0x000300f7, 0x00000230, 0x00000000, 0x000400fa, 0x0000022e, 0x0000022f, 0x00000239, 0x000200f8,
-    0x0000022f, 0x0004003d, 0x0000003c, 0x00000231, 0x0000004c, 0x00050050, 0x0000003c, 0x00000233,
-    0x00000232, 0x00000232, 0x00050089, 0x0000003c, 0x00000234, 0x00000231, 0x00000233, 0x0004003d,
-    0x00000006, 0x00000236, 0x00000206, 0x0003003e, 0x00000235, 0x00000236, 0x0003003e, 0x00000237,
-    0x00000234, 0x00060039, 0x00000006, 0x00000238, 0x00000041, 0x00000235, 0x00000237, 0x0003003e,
-    0x0000022b, 0x00000238, 0x000200f9, 0x00000230, 0x000200f8, 0x00000239, 0x0004003d, 0x00000048,
-    0x0000023a, 0x0000004f, 0x000300f7, 0x0000023c, 0x00000000, 0x000400fa, 0x0000023a, 0x0000023b,
-    0x0000023c, 0x000200f8, 0x0000023b, 0x0004003d, 0x0000003c, 0x0000023e, 0x0000004c, 0x0003003e,
-    0x0000023d, 0x0000023e, 0x0004003d, 0x00000006, 0x00000240, 0x0000004e, 0x0003003e, 0x0000023f,
-    0x00000240, 0x00060039, 0x00000006, 0x00000241, 0x00000046, 0x0000023d, 0x0000023f, 0x0003003e,
-    0x0000022b, 0x00000241, 0x000200f9, 0x0000023c, 0x000200f8, 0x0000023c, 0x000200f9, 0x00000230,
-    0x000200f8, 0x00000230, 0x0004003d, 0x00000006, 0x00000242, 0x0000022b, 0x000500c2, 0x00000006,
-    0x00000243, 0x00000242, 0x00000210, 0x000500c7, 0x00000006, 0x00000244, 0x00000243, 0x0000005f,
-    0x000500aa, 0x00000048, 0x00000245, 0x00000244, 0x00000078, 0x000300f7, 0x00000247, 0x00000000,
-    0x000400fa, 0x00000245, 0x00000246, 0x00000247, 0x000200f8, 0x00000246, 0x0004003d, 0x00000006,
-    0x00000248, 0x000001ec, 0x000200fe, 0x00000248, 0x000200f8, 0x00000247, 0x0004003d, 0x00000006,
-    0x0000024b, 0x0000020e, 0x000500c7, 0x00000006, 0x0000024d, 0x0000024b, 0x0000024c, 0x0003003e,
-    0x0000024a, 0x0000024d, 0x0004003d, 0x00000006, 0x0000024f, 0x000001fe, 0x000500c2, 0x00000006,
-    0x00000250, 0x0000024f, 0x000000be, 0x000500c7, 0x00000006, 0x00000251, 0x00000250, 0x0000005f,
-    0x0003003e, 0x0000024e, 0x00000251, 0x0004003d, 0x00000006, 0x00000253, 0x000001fe, 0x000500c2,
-    0x00000006, 0x00000254, 0x00000253, 0x000000f7, 0x000500c7, 0x00000006, 0x00000255, 0x00000254,
-    0x0000005f, 0x0003003e, 0x00000252, 0x00000255, 0x0004003d, 0x00000006, 0x00000256, 0x0000024a,
-    0x000500aa, 0x00000048, 0x00000257, 0x00000256, 0x0000007d, 0x000300f7, 0x00000259, 0x00000000,
-    0x000400fa, 0x00000257, 0x00000258, 0x00000259, 0x000200f8, 0x00000258, 0x0004003d, 0x00000006,
-    0x0000025a, 0x0000020e, 0x000500c7, 0x00000006, 0x0000025c, 0x0000025a, 0x0000025b, 0x000500ab,
-    0x00000048, 0x0000025d, 0x0000025c, 0x00000078, 0x000200f9, 0x00000259, 0x000200f8, 0x00000259,
-    0x000700f5, 0x00000048, 0x0000025e, 0x00000257, 0x00000247, 0x0000025d, 0x00000258, 0x000300f7,
-    0x00000260, 0x00000000, 0x000400fa, 0x0000025e, 0x0000025f, 0x00000260, 0x000200f8, 0x0000025f,
-    0x0004003d, 0x00000006, 0x00000262, 0x000001f6, 0x0003003e, 0x00000261, 0x00000262, 0x0004003d,
-    0x00000006, 0x00000264, 0x0000022b, 0x0003003e, 0x00000263, 0x00000264, 0x0004003d, 0x00000006,
-    0x00000266, 0x0000024e, 0x0003003e, 0x00000265, 0x00000266, 0x0004003d, 0x00000006, 0x00000268,
-    0x00000252, 0x0003003e, 0x00000267, 0x00000268, 0x00080039, 0x00000006, 0x00000269, 0x0000002a,
-    0x00000261, 0x00000263, 0x00000265, 0x00000267, 0x000200fe, 0x00000269, 0x000200f8, 0x00000260,
-    0x0004003d, 0x00000006, 0x0000026b, 0x0000024a, 0x000500aa, 0x00000048, 0x0000026c, 0x0000026b,
-    0x00000085, 0x000300f7, 0x0000026e, 0x00000000, 0x000400fa, 0x0000026c, 0x0000026d, 0x0000026e,
-    0x000200f8, 0x0000026d, 0x0004003d, 0x00000006, 0x00000270, 0x0000022b, 0x0003003e, 0x0000026f,
-    0x00000270, 0x0004003d, 0x00000006, 0x00000272, 0x0000024e, 0x0003003e, 0x00000271, 0x00000272,
-    0x0003003e, 0x00000273, 0x000000be, 0x00070039, 0x00000006, 0x00000274, 0x00000035, 0x0000026f,
-    0x00000271, 0x00000273, 0x000200fe, 0x00000274, 0x000200f8, 0x0000026e, 0x0004003d, 0x00000006,
-    0x00000276, 0x0000024a, 0x000500aa, 0x00000048, 0x00000277, 0x00000276, 0x0000008d, 0x000300f7,
-    0x00000279, 0x00000000, 0x000400fa, 0x00000277, 0x00000278, 0x00000279, 0x000200f8, 0x00000278,
-    0x0004003d, 0x00000006, 0x0000027c, 0x0000022b, 0x0003003e, 0x0000027b, 0x0000027c, 0x0004003d,
-    0x00000006, 0x0000027e, 0x0000024e, 0x0003003e, 0x0000027d, 0x0000027e, 0x0003003e, 0x0000027f,
-    0x0000027a, 0x00070039, 0x00000006, 0x00000280, 0x0000003a, 0x0000027b, 0x0000027d, 0x0000027f,
-    0x000200fe, 0x00000280, 0x000200f8, 0x00000279, 0x0004003d, 0x00000006, 0x00000282, 0x0000024a,
-    0x000500aa, 0x00000048, 0x00000283, 0x00000282, 0x0000018c, 0x000300f7, 0x00000285, 0x00000000,
-    0x000400fa, 0x00000283, 0x00000284, 0x00000285, 0x000200f8, 0x00000284, 0x0004003d, 0x00000006,
-    0x00000287, 0x0000022b, 0x0003003e, 0x00000286, 0x00000287, 0x0004003d, 0x00000006, 0x00000289,
-    0x000001ec, 0x0003003e, 0x00000288, 0x00000289, 0x00060039, 0x00000006, 0x0000028a, 0x0000002f,
-    0x00000286, 0x00000288, 0x000200fe, 0x0000028a, 0x000200f8, 0x00000285, 0x0004003d, 0x00000006,
-    0x0000028c, 0x0000022b, 0x000200fe, 0x0000028c, 0x00010038, 0x00050036, 0x00000006, 0x00000053,
-    0x00000000, 0x00000008, 0x00030037, 0x00000007, 0x00000052, 0x000200f8, 0x00000054, 0x0004003b,
-    0x00000007, 0x0000028f, 0x00000007, 0x0004003b, 0x00000007, 0x00000294, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000029a, 0x00000007, 0x0004003b, 0x00000007, 0x000002a0, 0x00000007, 0x0004003d,
-    0x00000006, 0x00000290, 0x00000052, 0x000500c7, 0x00000006, 0x00000291, 0x00000290, 0x00000056,
-    0x000500c2, 0x00000006, 0x00000292, 0x00000291, 0x0000007d, 0x000500c4, 0x00000006, 0x00000293,
-    0x00000292, 0x0000007d, 0x0003003e, 0x0000028f, 0x00000293, 0x0004003d, 0x00000006, 0x00000295,
-    0x00000052, 0x000500c2, 0x00000006, 0x00000296, 0x00000295, 0x000000be, 0x000500c7, 0x00000006,
-    0x00000297, 0x00000296, 0x00000056, 0x000500c2, 0x00000006, 0x00000298, 0x00000297, 0x0000007d,
-    0x000500c4, 0x00000006, 0x00000299, 0x00000298, 0x0000007d, 0x0003003e, 0x00000294, 0x00000299,
-    0x0004003d, 0x00000006, 0x0000029b, 0x00000052, 0x000500c2, 0x00000006, 0x0000029c, 0x0000029b,
-    0x000000f7, 0x000500c7, 0x00000006, 0x0000029d, 0x0000029c, 0x00000056, 0x000500c2, 0x00000006,
-    0x0000029e, 0x0000029d, 0x0000007d, 0x000500c4, 0x00000006, 0x0000029f, 0x0000029e, 0x0000007d,
-    0x0003003e, 0x0000029a, 0x0000029f, 0x0004003d, 0x00000006, 0x000002a1, 0x00000052, 0x000500c2,
-    0x00000006, 0x000002a2, 0x000002a1, 0x00000210, 0x000500ab, 0x00000048, 0x000002a3, 0x000002a2,
-    0x00000078, 0x000600a9, 0x00000006, 0x000002a4, 0x000002a3, 0x0000005f, 0x00000078, 0x0003003e,
-    0x000002a0, 0x000002a4, 0x0004003d, 0x00000006, 0x000002a5, 0x0000028f, 0x0004003d, 0x00000006,
-    0x000002a6, 0x00000294, 0x000500c4, 0x00000006, 0x000002a7, 0x000002a6, 0x000000be, 0x000500c5,
-    0x00000006, 0x000002a8, 0x000002a5, 0x000002a7, 0x0004003d, 0x00000006, 0x000002a9, 0x0000029a,
-    0x000500c4, 0x00000006, 0x000002aa, 0x000002a9, 0x000000f7, 0x000500c5, 0x00000006, 0x000002ab,
-    0x000002a8, 0x000002aa, 0x0004003d, 0x00000006, 0x000002ac, 0x000002a0, 0x000500c4, 0x00000006,
-    0x000002ad, 0x000002ac, 0x00000210, 0x000500c5, 0x00000006, 0x000002ae, 0x000002ab, 0x000002ad,
-    0x000200fe, 0x000002ae, 0x00010038,
+const uint8_t Blob110_Data[6627] =
+{
+    0x28, 0xb5, 0x2f, 0xfd, 0x60, 0xcc, 0x64, 0xcd, 0xce, 0x00, 0x8a, 0xe1, 0x24, 0x37, 0x36, 0x10,
+    0x68, 0xba, 0xc6, 0x80, 0x8b, 0x53, 0x20, 0x48, 0x4e, 0xa9, 0xd3, 0x16, 0x53, 0x8f, 0x2d, 0x26,
+    0x2c, 0x46, 0xe1, 0xc2, 0x43, 0x50, 0x48, 0x22, 0xab, 0x31, 0x83, 0xdc, 0xb8, 0x42, 0x41, 0xff,
+    0x52, 0xb2, 0x1e, 0xb6, 0x65, 0x5e, 0xbf, 0x4e, 0xe9, 0xd9, 0xe4, 0xcb, 0x4b, 0x15, 0x5a, 0x19,
+    0x22, 0x25, 0xc8, 0xd6, 0x52, 0x13, 0x03, 0x5b, 0x03, 0x92, 0x03, 0x6f, 0xde, 0xd7, 0xeb, 0x1d,
+    0x4d, 0x0a, 0xbd, 0xdf, 0xa9, 0x45, 0x41, 0xbd, 0xd3, 0xaf, 0xd9, 0x73, 0xeb, 0xb3, 0x4e, 0xe7,
+    0xf4, 0xe8, 0xdc, 0xbc, 0x26, 0xa3, 0xdd, 0x70, 0xdf, 0xe6, 0xd7, 0x7e, 0x64, 0x40, 0xbb, 0x9a,
+    0xbf, 0x9d, 0x8d, 0xfb, 0xe9, 0xf5, 0xfa, 0x6c, 0x0b, 0xb8, 0x46, 0xeb, 0x6a, 0x78, 0x3a, 0xd7,
+    0xcb, 0x69, 0x7a, 0x39, 0x9c, 0xdf, 0x9d, 0xf7, 0x1d, 0xad, 0x26, 0xab, 0x65, 0x69, 0xfe, 0x1f,
+    0x7b, 0xfd, 0xff, 0x2b, 0x2c, 0xef, 0x74, 0x66, 0xf6, 0xe3, 0xe6, 0xf4, 0xee, 0x47, 0x3e, 0x17,
+    0x48, 0x52, 0x0f, 0x3d, 0x9c, 0x90, 0x3e, 0x26, 0x87, 0x75, 0x36, 0xef, 0x93, 0xef, 0x02, 0xd3,
+    0x7b, 0x5e, 0x3b, 0x8f, 0x03, 0xfa, 0xd1, 0x76, 0xb5, 0x57, 0x31, 0xab, 0x2a, 0x6a, 0x69, 0x9e,
+    0x25, 0xf7, 0x0c, 0x5f, 0xfe, 0x99, 0xf8, 0x4f, 0x4b, 0xa2, 0x41, 0x9e, 0x65, 0x1b, 0xb3, 0x8a,
+    0xfa, 0xe1, 0xba, 0xcc, 0x4e, 0x9b, 0xc7, 0xd9, 0xbf, 0xab, 0x43, 0x93, 0xfb, 0xed, 0x1b, 0x98,
+    0x6d, 0x2d, 0x9b, 0x3d, 0x8b, 0xca, 0x22, 0x11, 0xbd, 0x9e, 0xf5, 0x3e, 0x61, 0xeb, 0xbf, 0x98,
+    0xff, 0x34, 0x71, 0x2a, 0xda, 0xf8, 0x9c, 0x9b, 0xcd, 0xa6, 0xe7, 0xd1, 0xa7, 0xd1, 0x13, 0x05,
+    0xdd, 0xd3, 0x2f, 0x01, 0xc5, 0xeb, 0x3c, 0x6c, 0x43, 0xcd, 0x2d, 0x17, 0xef, 0x83, 0x67, 0xb7,
+    0x72, 0x1e, 0xde, 0xcb, 0x6d, 0x7d, 0x65, 0x4b, 0x72, 0x8c, 0x9c, 0x32, 0xcc, 0xe1, 0x6f, 0x32,
+    0x3d, 0xe1, 0xb3, 0x10, 0x18, 0x11, 0xdd, 0x0d, 0xd4, 0x82, 0xfb, 0x9f, 0x2e, 0xce, 0xb1, 0x75,
+    0x58, 0xb9, 0xd7, 0xc7, 0xbb, 0xf9, 0xad, 0xec, 0xfb, 0xd5, 0xf5, 0xeb, 0xbd, 0xac, 0x9e, 0x7a,
+    0x42, 0x37, 0x89, 0x7b, 0xd4, 0x7f, 0x79, 0xd9, 0x4f, 0x07, 0x8b, 0xef, 0xe9, 0xb5, 0x19, 0x7d,
+    0x70, 0x0f, 0xe7, 0x61, 0xfe, 0xf4, 0x4b, 0x7f, 0xcd, 0x46, 0x9f, 0xdd, 0xc6, 0x62, 0x76, 0x7a,
+    0x6d, 0x57, 0xfa, 0x5c, 0xc2, 0xbd, 0xac, 0x93, 0xbe, 0xae, 0x1e, 0xc5, 0x22, 0x46, 0x23, 0xf9,
+    0x71, 0x8e, 0xee, 0xdb, 0xd2, 0xe8, 0x6a, 0x3f, 0xbf, 0xb9, 0x3d, 0xfc, 0xd5, 0x6e, 0x34, 0xdb,
+    0x3b, 0xed, 0xdb, 0xa1, 0xf3, 0x74, 0x76, 0xad, 0x83, 0xb1, 0xdf, 0xd6, 0xef, 0xae, 0xe4, 0x74,
+    0x8e, 0x97, 0x66, 0xab, 0xd7, 0xea, 0xf3, 0x9e, 0x06, 0xa8, 0x66, 0xd3, 0x71, 0xea, 0xc9, 0xa0,
+    0x6b, 0x57, 0x7e, 0x88, 0x57, 0xd7, 0xfc, 0xbf, 0x1f, 0x1b, 0xed, 0xc3, 0x73, 0xcb, 0x93, 0x5f,
+    0x2e, 0xeb, 0xe2, 0x47, 0x36, 0x46, 0xc0, 0xf5, 0x98, 0x9c, 0x67, 0xf7, 0xa6, 0x49, 0xeb, 0x74,
+    0x6a, 0xbd, 0x8c, 0x36, 0xe7, 0xea, 0x07, 0x8f, 0x9f, 0x77, 0xb2, 0x3a, 0xad, 0x0f, 0x1e, 0x7e,
+    0xe0, 0x39, 0x0f, 0x17, 0xaa, 0xd5, 0x7a, 0x7a, 0x3c, 0xce, 0xd9, 0x82, 0xe8, 0xfd, 0xac, 0x87,
+    0xf7, 0xf0, 0xe2, 0xde, 0xd8, 0xd6, 0xd4, 0xd2, 0xc2, 0xbc, 0xa8, 0xa4, 0x90, 0x8a, 0x82, 0xbc,
+    0x00, 0x80, 0x72, 0xb8, 0xd7, 0x27, 0x83, 0x4a, 0xba, 0x25, 0xf4, 0xb3, 0x54, 0x40, 0xa7, 0x7c,
+    0x2e, 0xe9, 0xdc, 0xd4, 0xbc, 0x31, 0x03, 0xf2, 0x6d, 0x68, 0xce, 0xd3, 0x39, 0x9a, 0x70, 0xbc,
+    0x3e, 0xe7, 0x6c, 0x41, 0xc1, 0xff, 0x40, 0x7d, 0x0d, 0x58, 0x37, 0xd6, 0x19, 0xc8, 0xd9, 0x8d,
+    0xc9, 0xe5, 0x1c, 0x4f, 0x3d, 0xf7, 0x72, 0x6d, 0x7d, 0x7c, 0x76, 0xcb, 0xcf, 0x71, 0x3f, 0x26,
+    0xc3, 0xfd, 0x59, 0xd7, 0xd3, 0x03, 0xc2, 0x67, 0x66, 0xba, 0xb7, 0xf9, 0x7c, 0xad, 0xc7, 0x95,
+    0xd7, 0xd4, 0x3e, 0x4a, 0x6d, 0x4b, 0x17, 0xa7, 0xd9, 0x3b, 0x5b, 0x59, 0x6f, 0x93, 0xe9, 0xce,
+    0x64, 0xc0, 0x35, 0x39, 0x6f, 0xac, 0x97, 0x73, 0xb1, 0xda, 0x4c, 0x7c, 0xd6, 0xd3, 0xba, 0x9f,
+    0x5e, 0x46, 0xa3, 0xc5, 0x1e, 0x4c, 0xe7, 0x62, 0x7d, 0x4c, 0xb6, 0xd3, 0xd3, 0xec, 0x35, 0x3a,
+    0x4f, 0x3b, 0x0b, 0x03, 0xfb, 0x3a, 0x13, 0xee, 0x6a, 0x02, 0xfe, 0xd5, 0x39, 0x39, 0xcc, 0xb5,
+    0x16, 0xe7, 0xbf, 0xf5, 0x5a, 0x8f, 0x2e, 0xa0, 0x56, 0xeb, 0xe7, 0x35, 0xe0, 0x1f, 0x39, 0xfd,
+    0x5d, 0x6f, 0x55, 0xd5, 0x75, 0xf5, 0x78, 0x58, 0x2a, 0x1f, 0xd4, 0xa3, 0xc6, 0xe7, 0x5d, 0xac,
+    0xab, 0xa1, 0xd6, 0xea, 0x34, 0xd9, 0xef, 0x89, 0x6b, 0x7c, 0xd6, 0xcb, 0x68, 0x01, 0xf2, 0x9c,
+    0x29, 0xbc, 0xf4, 0xa7, 0x94, 0xf4, 0xd9, 0x40, 0x71, 0x4e, 0xd7, 0xf4, 0xdc, 0xa2, 0x47, 0x33,
+    0x12, 0xfa, 0xb6, 0xa1, 0xb4, 0x18, 0x40, 0x9d, 0x57, 0x7a, 0x2f, 0xef, 0x69, 0xde, 0x3f, 0xef,
+    0xe4, 0x35, 0x59, 0xbd, 0xa3, 0x7d, 0xb4, 0xc8, 0x83, 0x51, 0x68, 0x6c, 0xe5, 0xfc, 0x4c, 0x66,
+    0x1b, 0xe7, 0x3b, 0xdc, 0x0f, 0x4e, 0x57, 0x0e, 0x88, 0x2e, 0x9f, 0xe5, 0xe8, 0xec, 0x72, 0x3e,
+    0x58, 0xf3, 0xff, 0x62, 0x59, 0xec, 0x28, 0xaf, 0xf0, 0x5f, 0xdd, 0x7e, 0x07, 0x66, 0x4e, 0xef,
+    0xe7, 0x02, 0x36, 0xbf, 0x7d, 0xed, 0x98, 0x5d, 0x16, 0x9f, 0xc9, 0xdc, 0xd7, 0x07, 0xc9, 0x6b,
+    0xb1, 0x9e, 0x26, 0x8f, 0xfb, 0xf4, 0x33, 0xb9, 0xdc, 0xa7, 0x97, 0x0b, 0xd7, 0xea, 0x3e, 0x34,
+    0x5a, 0xdc, 0xb7, 0x06, 0xd7, 0x36, 0x37, 0xd7, 0xd6, 0x67, 0xf3, 0x5a, 0x4d, 0x6c, 0xf6, 0xca,
+    0xe5, 0xd1, 0x76, 0xff, 0xb1, 0x96, 0x67, 0x72, 0x6e, 0x7e, 0x9a, 0x9d, 0xff, 0xcf, 0xbe, 0xce,
+    0x63, 0x75, 0x71, 0x59, 0x8d, 0xd7, 0x6a, 0x2b, 0x38, 0x3b, 0xb8, 0x36, 0xfc, 0xff, 0xfa, 0xd8,
+    0xe7, 0x79, 0x2d, 0xd5, 0x73, 0xff, 0xe6, 0xaf, 0xd9, 0xdf, 0x32, 0x61, 0xb3, 0x01, 0x0a, 0xdc,
+    0x7d, 0x08, 0x0e, 0x24, 0x70, 0x34, 0x70, 0xc0, 0xc0, 0x9e, 0xdf, 0x5e, 0x1e, 0x1f, 0x5e, 0x1e,
+    0x11, 0xde, 0x17, 0xb0, 0x93, 0xab, 0xb3, 0x23, 0x50, 0x47, 0x37, 0x47, 0x60, 0x94, 0x2e, 0x2e,
+    0xaa, 0x2a, 0xee, 0x0a, 0xee, 0x0d, 0xcc, 0xb6, 0x96, 0x46, 0x07, 0x57, 0x33, 0xe0, 0x8d, 0x6c,
+    0x80, 0x1b, 0xd8, 0xad, 0x8d, 0x6d, 0xb4, 0x0d, 0x6d, 0x4d, 0x2d, 0xcd, 0xab, 0x76, 0x66, 0x86,
+    0x76, 0x56, 0x66, 0x56, 0x46, 0x76, 0xf5, 0xad, 0xca, 0xfa, 0xfe, 0xb7, 0xc7, 0xb6, 0xc4, 0xb2,
+    0xc2, 0xc0, 0xd8, 0xc4, 0xf0, 0x0f, 0x13, 0x10, 0x86, 0x24, 0xe0, 0x0b, 0xcc, 0xab, 0xeb, 0x6b,
+    0x8c, 0x0e, 0xd4, 0x8b, 0xab, 0x8b, 0x4b, 0x6b, 0x4c, 0x0b, 0x6b, 0x8b, 0x08, 0xcb, 0x8a, 0xcc,
+    0x8a, 0xea, 0x6a, 0x75, 0x8a, 0xaa, 0x32, 0x80, 0xd4, 0x54, 0xaa, 0x14, 0x14, 0xd2, 0x13, 0x94,
+    0xd3, 0x53, 0x13, 0x93, 0xd3, 0x65, 0xd3, 0x52, 0x12, 0xd3, 0x13, 0xa5, 0xa5, 0xb7, 0x57, 0xe9,
+    0x88, 0xa8, 0x6d, 0x74, 0x04, 0xae, 0x5c, 0x2d, 0x32, 0xda, 0x2c, 0x1a, 0xf2, 0xba, 0x85, 0x86,
+    0x36, 0x23, 0x83, 0x84, 0x34, 0x83, 0x7e, 0x80, 0x7e, 0x7c, 0x80, 0x7a, 0x7c, 0x78, 0xba, 0x3d,
+    0xad, 0x3c, 0xa2, 0x5d, 0x1b, 0xec, 0xa7, 0x76, 0x67, 0xbb, 0xfd, 0x1c, 0xae, 0x8e, 0xcd, 0xe3,
+    0xe4, 0x3c, 0x97, 0x1b, 0x9c, 0x1b, 0xbc, 0xc6, 0xa6, 0x86, 0x6b, 0xc3, 0x05, 0xe3, 0xf8, 0xff,
+    0x56, 0x4b, 0xf3, 0xed, 0xac, 0x16, 0xbc, 0x82, 0x28, 0xbb, 0x29, 0x06, 0xfb, 0xad, 0xd7, 0x33,
+    0xd9, 0x8f, 0x34, 0x73, 0xc6, 0x4c, 0x19, 0x31, 0x64, 0xca, 0x8c, 0x21, 0xf3, 0x6e, 0xd6, 0x31,
+    0xac, 0xab, 0xa9, 0x61, 0x56, 0x55, 0x29, 0x4f, 0xc3, 0x9c, 0x38, 0x33, 0x55, 0x05, 0x63, 0xfa,
+    0xe5, 0x14, 0x0c, 0x24, 0xea, 0x17, 0xd4, 0xd2, 0x51, 0x2f, 0x5d, 0x4a, 0xaf, 0x96, 0xa4, 0x5e,
+    0x48, 0x45, 0xbb, 0x70, 0x11, 0xdd, 0xa2, 0x85, 0x0b, 0x63, 0x16, 0x2d, 0xed, 0x2c, 0x58, 0x40,
+    0x43, 0xad, 0x60, 0xb9, 0x12, 0x7a, 0xa5, 0x0a, 0x15, 0x2b, 0xf8, 0x9b, 0xca, 0xe7, 0xf5, 0x5b,
+    0xa5, 0x7c, 0x4a, 0x89, 0xf2, 0x09, 0xa5, 0x49, 0x94, 0x13, 0x4f, 0x9c, 0x40, 0xb9, 0x74, 0x82,
+    0xe4, 0xbf, 0x09, 0x58, 0xd5, 0xd3, 0x73, 0x89, 0x12, 0x26, 0x49, 0x94, 0xb8, 0x93, 0x20, 0xf1,
+    0x44, 0xd2, 0xe9, 0xc9, 0xd9, 0x99, 0xe2, 0x88, 0x11, 0x4e, 0xb0, 0x8b, 0x22, 0x46, 0xda, 0x31,
+    0x8a, 0x6c, 0x89, 0x5c, 0xee, 0x20, 0xc2, 0x63, 0x88, 0x90, 0x21, 0x42, 0x36, 0x79, 0xb0, 0x06,
+    0xd9, 0xa1, 0x19, 0x04, 0x4f, 0x04, 0xb2, 0xf8, 0xe3, 0x7b, 0x68, 0x66, 0xf6, 0xc0, 0xdc, 0xc4,
+    0xd4, 0x31, 0xe6, 0x79, 0xac, 0xea, 0x00, 0xdb, 0x68, 0xe7, 0x00, 0x57, 0x62, 0x71, 0xe0, 0x5f,
+    0x56, 0xec, 0x0d, 0x9a, 0x3f, 0xab, 0x41, 0xf6, 0x35, 0xc6, 0xe6, 0x68, 0x7c, 0xbb, 0xda, 0x2b,
+    0xab, 0x2a, 0x6a, 0x69, 0x16, 0xcf, 0x4b, 0x13, 0x92, 0x90, 0x8d, 0x8a, 0x87, 0x69, 0xf3, 0xf8,
+    0x1b, 0xd6, 0xbb, 0x93, 0x7b, 0x73, 0x03, 0xb3, 0xad, 0xa5, 0x85, 0x81, 0x7d, 0xb3, 0xaa, 0xa2,
+    0x90, 0xb6, 0x44, 0x6e, 0x59, 0x6f, 0xab, 0x98, 0x54, 0xd3, 0x51, 0x51, 0xd0, 0x1d, 0x97, 0x5b,
+    0x1b, 0x6e, 0x62, 0x31, 0xbe, 0x34, 0x62, 0x9e, 0xe6, 0xbd, 0xdc, 0x98, 0x53, 0x78, 0xf6, 0xa5,
+    0x3e, 0x0a, 0x07, 0xea, 0xc9, 0x09, 0xe7, 0xa9, 0x49, 0xdb, 0x94, 0xc9, 0xb4, 0x24, 0xf6, 0x4a,
+    0xff, 0xff, 0xaf, 0x83, 0xd5, 0x91, 0xbc, 0x7b, 0x91, 0x11, 0xf7, 0x8b, 0xcc, 0x88, 0x7e, 0x28,
+    0xa8, 0x51, 0x28, 0x29, 0xe8, 0xff, 0xed, 0x7d, 0x00, 0x58, 0x0f, 0x94, 0xf9, 0xa3, 0xc5, 0xd5,
+    0x6a, 0xff, 0xdf, 0x62, 0x56, 0xc3, 0x18, 0xed, 0x5f, 0xf3, 0x97, 0x45, 0xf0, 0x5f, 0x93, 0x39,
+    0xf7, 0x01, 0x3e, 0x6b, 0xe3, 0xe0, 0x74, 0x4b, 0x95, 0xcc, 0x27, 0x4b, 0xde, 0x47, 0x70, 0x1f,
+    0x58, 0x4b, 0xb1, 0xeb, 0x8c, 0x2c, 0x2e, 0xc3, 0xbb, 0x65, 0x90, 0x68, 0x60, 0x07, 0x4e, 0xeb,
+    0x95, 0x12, 0x89, 0xcc, 0x80, 0x82, 0xba, 0xcf, 0x7d, 0xec, 0x67, 0x8a, 0xc1, 0x4f, 0x4d, 0x4b,
+    0x4d, 0xbd, 0x94, 0x7a, 0xe9, 0x52, 0x93, 0xe4, 0xea, 0x59, 0x83, 0xa4, 0x93, 0xb3, 0xa6, 0x13,
+    0xdf, 0xb1, 0xf9, 0xa3, 0x21, 0x99, 0xd8, 0xdf, 0xf1, 0x96, 0x3b, 0xdb, 0x18, 0x67, 0x5e, 0x78,
+    0x5b, 0xe0, 0x27, 0x9e, 0x32, 0x84, 0x18, 0x0e, 0x88, 0x24, 0x0f, 0xd9, 0x37, 0xca, 0xf0, 0xd7,
+    0x7f, 0x0a, 0x5a, 0x48, 0x1c, 0xc2, 0xdb, 0x11, 0x42, 0x3b, 0xb1, 0x11, 0x5f, 0x6c, 0x64, 0x7c,
+    0xae, 0xc5, 0xa9, 0xb7, 0xd6, 0x51, 0x62, 0x51, 0x83, 0x33, 0x57, 0x42, 0x1a, 0xd6, 0xee, 0x6a,
+    0x12, 0x17, 0x6d, 0x26, 0x17, 0x33, 0x48, 0x32, 0x1b, 0xd9, 0x75, 0xc4, 0x2e, 0x72, 0x1d, 0xec,
+    0x5c, 0xdd, 0xdf, 0x4e, 0x43, 0x54, 0xeb, 0x53, 0xfb, 0x16, 0x8d, 0xef, 0xde, 0x0f, 0x14, 0x23,
+    0xff, 0x02, 0xec, 0x5f, 0xc9, 0x42, 0x7e, 0x7f, 0x5a, 0xdd, 0x2f, 0x49, 0x07, 0x80, 0xd4, 0x77,
+    0x86, 0x0f, 0x51, 0xaf, 0x0c, 0x6f, 0xca, 0x6d, 0xfb, 0xf6, 0x5c, 0xb0, 0x1b, 0xf8, 0xe7, 0x9b,
+    0xf6, 0x25, 0x1b, 0xfb, 0xe2, 0x63, 0xdb, 0x2c, 0x25, 0x2a, 0xa5, 0x2d, 0x92, 0x12, 0x4f, 0x4f,
+    0x97, 0x07, 0xbb, 0xd3, 0xf5, 0x5e, 0x77, 0xb6, 0x5c, 0x25, 0x7c, 0xbb, 0x4d, 0xfa, 0x24, 0x1c,
+    0xe8, 0xb3, 0x8f, 0x7d, 0x1f, 0xa1, 0x9b, 0x29, 0xa9, 0x1e, 0x29, 0x29, 0xa1, 0x2c, 0x4f, 0x54,
+    0x54, 0xce, 0xff, 0x37, 0x29, 0x69, 0x97, 0xc0, 0x37, 0x6a, 0x36, 0x66, 0x35, 0x63, 0x5c, 0x30,
+    0x2e, 0x1c, 0x8b, 0xf5, 0xf8, 0x11, 0x16, 0xe8, 0xfa, 0x53, 0x74, 0x63, 0x89, 0x73, 0x7a, 0x5a,
+    0x5a, 0xfa, 0xa5, 0x60, 0x2f, 0x9c, 0x45, 0xdb, 0x20, 0xfc, 0x87, 0xa6, 0xab, 0xc5, 0xc9, 0x72,
+    0xb1, 0xda, 0xeb, 0x73, 0xea, 0x28, 0xfd, 0x52, 0x08, 0x6c, 0x96, 0xe9, 0x03, 0x58, 0x8b, 0x7b,
+    0xf8, 0x77, 0x50, 0xf6, 0x46, 0x69, 0xa9, 0xed, 0x03, 0x4f, 0x89, 0x5c, 0x4e, 0x4c, 0x4b, 0x4d,
+    0x5b, 0x4c, 0x4a, 0x78, 0x4b, 0x8a, 0x48, 0x4a, 0x49, 0x48, 0x49, 0x45, 0xde, 0x23, 0xa3, 0x22,
+    0x2d, 0x23, 0xb6, 0x35, 0xb5, 0xb4, 0x30, 0x2f, 0x2a, 0x29, 0xa4, 0x22, 0x2f, 0xae, 0x2d, 0xad,
+    0xac, 0xae, 0xff, 0xff, 0x17, 0xe2, 0x0b, 0xfa, 0xf1, 0x6e, 0x01, 0x8c, 0x01, 0xf2, 0xf9, 0xe9,
+    0xf1, 0xe1, 0xc1, 0xe9, 0xe9, 0xee, 0xf0, 0x74, 0x73, 0x8c, 0x76, 0x74, 0x72, 0x74, 0x6e, 0x6c,
+    0x70, 0x42, 0x6f, 0xb8, 0x46, 0x36, 0x35, 0x35, 0xf8, 0xf6, 0x1f, 0x3f, 0x43, 0x93, 0x98, 0xc5,
+    0x6a, 0xaf, 0xd9, 0xeb, 0x15, 0xfb, 0xd7, 0xbf, 0x5e, 0xcd, 0x9c, 0x31, 0x43, 0x66, 0xa8, 0xb5,
+    0x0c, 0x99, 0x32, 0xac, 0x63, 0x56, 0xc5, 0xa8, 0x86, 0x49, 0x55, 0xdd, 0x92, 0x8a, 0x0a, 0xe6,
+    0x0b, 0xaa, 0xd5, 0x17, 0xd3, 0xd3, 0x50, 0x53, 0x52, 0x6f, 0xa9, 0x17, 0xd2, 0x2a, 0x2f, 0x5d,
+    0xb6, 0x8c, 0x72, 0xe9, 0xa2, 0x18, 0x3a, 0xaa, 0x25, 0xd4, 0xad, 0x45, 0x34, 0xcb, 0xa6, 0xa4,
+    0x68, 0x15, 0x16, 0xfc, 0x1b, 0xe4, 0x05, 0x00, 0x94, 0xc3, 0xbd, 0x3e, 0x19, 0x54, 0xd2, 0x2d,
+    0xa1, 0x58, 0x56, 0x55, 0x54, 0x57, 0x55, 0xa8, 0x80, 0x7e, 0x36, 0x55, 0xe1, 0xf2, 0x51, 0x91,
+    0x02, 0xca, 0x39, 0xa5, 0xc7, 0x67, 0xa6, 0x14, 0x28, 0x51, 0x9e, 0x40, 0x71, 0xf2, 0xc4, 0xc9,
+    0x12, 0xa3, 0x26, 0x4c, 0x96, 0x30, 0x49, 0xa2, 0x24, 0x49, 0xa7, 0x91, 0x27, 0x92, 0x4e, 0x24,
+    0x47, 0x38, 0x8d, 0x1c, 0x29, 0x62, 0x84, 0x48, 0x11, 0x22, 0x9b, 0x43, 0x84, 0x6c, 0x0a, 0x01,
+    0x12, 0x04, 0x88, 0xe6, 0xd0, 0x0f, 0x1f, 0x9a, 0x3e, 0x32, 0x7b, 0x60, 0xf2, 0xd0, 0xb1, 0xe3,
+    0x52, 0x87, 0xd4, 0xe5, 0x8d, 0x1c, 0x38, 0x6e, 0x40, 0xe1, 0xa8, 0x61, 0x23, 0xaa, 0xc6, 0x0c,
+    0x2f, 0x0d, 0xcb, 0x19, 0x4f, 0x96, 0xf8, 0x97, 0x0a, 0xe8, 0x94, 0xcf, 0x25, 0x9d, 0x9b, 0x9a,
+    0x37, 0x66, 0x4c, 0x49, 0x45, 0x41, 0x3d, 0x05, 0x80, 0xf1, 0x02, 0x86, 0xe4, 0x0b, 0x26, 0x17,
+    0x2c, 0x5a, 0x38, 0xb2, 0x58, 0x51, 0xb9, 0xb4, 0x22, 0x85, 0x0a, 0x07, 0x29, 0x50, 0x28, 0x9d,
+    0xc0, 0x7b, 0x13, 0x49, 0x25, 0x9c, 0x98, 0x96, 0x94, 0x92, 0x90, 0x9a, 0x44, 0x50, 0x8a, 0x70,
+    0xa4, 0x2c, 0x0a, 0x71, 0x54, 0x64, 0xe4, 0xa1, 0x83, 0x07, 0x07, 0x1d, 0x34, 0x39, 0x10, 0x09,
+    0x0d, 0x65, 0xc0, 0xcb, 0xb0, 0x89, 0x21, 0x08, 0x80, 0xd7, 0x42, 0x05, 0x0b, 0x92, 0x15, 0x20,
+    0x73, 0x28, 0x4c, 0x80, 0x94, 0x30, 0x21, 0x52, 0xc2, 0x63, 0x04, 0xc7, 0xc7, 0x37, 0x84, 0xc6,
+    0x37, 0x63, 0xe3, 0x22, 0xa3, 0xe2, 0x03, 0x07, 0x8a, 0x86, 0x89, 0x88, 0x86, 0x87, 0x88, 0xee,
+    0x43, 0x42, 0x9b, 0x06, 0x78, 0x18, 0x61, 0x21, 0x83, 0x42, 0x41, 0xf6, 0xe0, 0x6e, 0xbe, 0x5e,
+    0xd9, 0xb8, 0x7a, 0x2d, 0x01, 0x30, 0xed, 0x77, 0x06, 0x24, 0x2b, 0x9f, 0xfd, 0xc2, 0x3e, 0xe6,
+    0x6e, 0x60, 0x99, 0xfc, 0x85, 0x7c, 0x1b, 0x12, 0x6e, 0x05, 0xd1, 0x5b, 0xc0, 0x3f, 0x31, 0x20,
+    0x1f, 0x9e, 0x9e, 0x9f, 0x70, 0x1e, 0x56, 0x90, 0xf7, 0x29, 0xc0, 0x49, 0xa0, 0x83, 0x93, 0x03,
+    0x66, 0xc0, 0x0c, 0x9f, 0x01, 0x46, 0xbd, 0xbd, 0x44, 0xbc, 0xbc, 0x77, 0x81, 0xbf, 0xf9, 0xed,
+    0x17, 0xf7, 0x6d, 0xbc, 0xc0, 0x5a, 0x7b, 0x7c, 0x76, 0x42, 0xf8, 0x74, 0xed, 0x7a, 0xf0, 0x30,
+    0x9e, 0x6e, 0x9a, 0x47, 0x27, 0x67, 0xe7, 0xaa, 0x83, 0x73, 0x93, 0xa3, 0x8a, 0xc3, 0x7a, 0xf3,
+    0xaf, 0xbd, 0xd6, 0xd0, 0xd8, 0x24, 0x72, 0xb7, 0x35, 0x8e, 0xf8, 0xb6, 0x8d, 0x6b, 0xb5, 0x34,
+    0xff, 0xda, 0xac, 0x16, 0xab, 0x7d, 0xd6, 0x2c, 0x67, 0x28, 0xb4, 0x9a, 0x29, 0x43, 0xa6, 0x35,
+    0xb1, 0xb4, 0xcc, 0x18, 0x32, 0xa8, 0x63, 0xc4, 0xa8, 0xa6, 0xa2, 0x82, 0x49, 0x5d, 0xfc, 0x02,
+    0xe6, 0xcb, 0x69, 0xa9, 0xe9, 0xa9, 0xa9, 0x97, 0x2c, 0x84, 0xa4, 0x5e, 0xba, 0x8c, 0x92, 0x8a,
+    0x76, 0xe1, 0x32, 0xba, 0x85, 0x8b, 0x96, 0x2d, 0xa6, 0x5a, 0x08, 0xdd, 0x6e, 0x51, 0x2c, 0x57,
+    0x44, 0xb1, 0xdd, 0x50, 0x2c, 0x9e, 0xa1, 0x56, 0xa8, 0x5c, 0x59, 0xad, 0x62, 0xe5, 0xb2, 0x0a,
+    0xe8, 0x27, 0x15, 0xcc, 0x29, 0xa0, 0x3f, 0x4c, 0x4c, 0x91, 0xfc, 0x94, 0xe2, 0xc9, 0x17, 0x45,
+    0x0a, 0x14, 0x26, 0x51, 0x80, 0x3c, 0x81, 0x02, 0xf9, 0xa4, 0x89, 0x13, 0xc5, 0x26, 0x4b, 0x94,
+    0x30, 0x69, 0x5c, 0x92, 0x44, 0xc9, 0x61, 0x12, 0x24, 0x97, 0x9d, 0x48, 0x38, 0x3b, 0x8f, 0x70,
+    0x1a, 0x39, 0x52, 0xc4, 0x87, 0x11, 0x22, 0x43, 0x8a, 0x10, 0x11, 0xb2, 0x39, 0x44, 0x48, 0x90,
+    0x4d, 0x20, 0x41, 0xfe, 0x81, 0xfc, 0xd0, 0xec, 0xe1, 0x43, 0x33, 0x93, 0x47, 0x8f, 0x4c, 0x4c,
+    0x1e, 0x3b, 0x30, 0x57, 0x77, 0xe8, 0xc8, 0x61, 0x02, 0x47, 0x8e, 0x1b, 0x38, 0x6c, 0xdc, 0xa8,
+    0x61, 0x83, 0x46, 0x8b, 0x1a, 0x96, 0x33, 0x68, 0x28, 0x5a, 0xca, 0x88, 0x31, 0x03, 0x52, 0x06,
+    0x8c, 0x18, 0x2f, 0x60, 0xb8, 0x78, 0xe1, 0x82, 0x45, 0x65, 0x8b, 0x43, 0x16, 0x2b, 0x54, 0x54,
+    0x36, 0xae, 0x48, 0xa1, 0x02, 0x45, 0x8a, 0x13, 0x28, 0x4e, 0x94, 0x90, 0x24, 0x51, 0xe2, 0x47,
+    0xdf, 0x08, 0x12, 0x57, 0x48, 0x11, 0x23, 0x30, 0x29, 0x45, 0x84, 0xd0, 0x40, 0x99, 0x08, 0xe2,
+    0x43, 0x08, 0x45, 0x10, 0x1e, 0x3a, 0x7c, 0x80, 0xf4, 0xc0, 0xa1, 0xc3, 0x06, 0x0e, 0x9b, 0x77,
+    0x1b, 0x32, 0x60, 0xd0, 0x70, 0x98, 0xe1, 0xc2, 0x24, 0x86, 0xc6, 0x0b, 0x6e, 0x0b, 0x93, 0x8f,
+    0x57, 0xc1, 0xc2, 0x66, 0x54, 0x05, 0x0a, 0x90, 0x13, 0x28, 0x48, 0x98, 0x10, 0x29, 0xe1, 0x2e,
+    0x32, 0x42, 0x63, 0xfb, 0x31, 0x82, 0x0a, 0xc7, 0xc7, 0x2e, 0x04, 0x47, 0x08, 0x8c, 0x8a, 0x8b,
+    0x8c, 0xef, 0xc5, 0xc7, 0x7c, 0xf0, 0x7e, 0xe0, 0xe0, 0x70, 0xf5, 0xaf, 0x0e, 0x70, 0x9c, 0x3e,
+    0xc4, 0x44, 0x44, 0x43, 0xb7, 0x61, 0x03, 0xf7, 0x22, 0x83, 0x06, 0x2e, 0xcc, 0x0c, 0x0a, 0x09,
+    0xdb, 0x77, 0xed, 0xc1, 0xc2, 0x41, 0x36, 0xe1, 0xea, 0x9a, 0x0d, 0x5e, 0x61, 0x5e, 0xab, 0xd3,
+    0x51, 0x6a, 0x41, 0x73, 0x24, 0x5a, 0x70, 0x3f, 0xa3, 0x53, 0xcf, 0xe5, 0x3b, 0xbd, 0x32, 0x5f,
+    0xe0, 0x82, 0x40, 0xf2, 0x02, 0xc0, 0x3f, 0x32, 0xa0, 0x1f, 0x9f, 0xae, 0x37, 0x0e, 0x9f, 0xe9,
+    0xf9, 0x58, 0x1c, 0x16, 0x2b, 0x48, 0x90, 0x8f, 0xd1, 0xf5, 0x05, 0x7f, 0x7d, 0xb0, 0x16, 0x95,
+    0x2e, 0xba, 0x2d, 0x28, 0x59, 0xac, 0x48, 0x51, 0xb9, 0xba, 0x82, 0x83, 0x0a, 0x14, 0x26, 0x52,
+    0x00, 0xc1, 0x3c, 0x81, 0x62, 0xf2, 0xc4, 0x04, 0x13, 0x25, 0x28, 0xfb, 0x48, 0x94, 0x50, 0x31,
+    0x82, 0x44, 0x57, 0xc4, 0x08, 0x11, 0x21, 0x38, 0x80, 0x08, 0xf1, 0x01, 0x84, 0x87, 0x0f, 0xab,
+    0x1d, 0x3c, 0x74, 0xd8, 0x30, 0xa9, 0x61, 0x43, 0x06, 0x0d, 0x18, 0x32, 0x5c, 0xc0, 0x50, 0x77,
+    0xa1, 0x82, 0x85, 0x1f, 0x6e, 0xc9, 0x0a, 0x9a, 0x78, 0x14, 0x24, 0xeb, 0x28, 0xe0, 0x5f, 0x4a,
+    0x0e, 0x93, 0xd8, 0x09, 0x77, 0x75, 0x5c, 0x3b, 0x30, 0xc8, 0x29, 0xc8, 0xc5, 0x47, 0x08, 0x8c,
+    0x57, 0x8f, 0x8e, 0x10, 0x1c, 0x1b, 0x19, 0x1b, 0xdf, 0x8b, 0xef, 0x07, 0x8b, 0x90, 0x8a, 0x0f,
+    0x14, 0x0b, 0x13, 0x11, 0xdd, 0x0d, 0x04, 0x24, 0x32, 0x40, 0x3c, 0x74, 0x1f, 0x1a, 0x36, 0x30,
+    0x6c, 0x17, 0xb6, 0x09, 0x0b, 0x23, 0x07, 0x09, 0x07, 0xcf, 0x6b, 0xb5, 0x60, 0xd7, 0x7a, 0xfb,
+    0x61, 0xea, 0xb4, 0x60, 0x1a, 0xbd, 0xa3, 0xcd, 0x67, 0x73, 0xf9, 0xbc, 0x18, 0x58, 0x0e, 0x54,
+    0x40, 0xfe, 0xd3, 0xc5, 0x01, 0xc8, 0x0f, 0xf8, 0x57, 0x07, 0xe8, 0xa7, 0xcb, 0xf9, 0x8d, 0xc5,
+    0x53, 0xe3, 0x70, 0x1e, 0x26, 0xdc, 0xa7, 0xa0, 0x2f, 0x81, 0x82, 0x55, 0x3d, 0x04, 0x6d, 0x79,
+    0x09, 0xf6, 0xfe, 0x00, 0x02, 0x03, 0x7c, 0x07, 0x74, 0xf8, 0xf4, 0xf6, 0xf4, 0xf2, 0xf6, 0xdc,
+    0x78, 0x79, 0x6f, 0x78, 0x05, 0xea, 0xee, 0x0a, 0xac, 0xda, 0xdd, 0xd9, 0x3d, 0x1d, 0x01, 0xcc,
+    0x39, 0xba, 0xb9, 0xb8, 0x37, 0xb8, 0x01, 0x71, 0x03, 0xda, 0xc0, 0xa4, 0x60, 0x9c, 0xad, 0x8d,
+    0x6d, 0xad, 0x4d, 0x6d, 0xad, 0x4f, 0x0d, 0x2d, 0x6d, 0x0a, 0x0d, 0xc7, 0x1a, 0x1b, 0x3b, 0x2b,
+    0xfb, 0xb2, 0x9d, 0x99, 0x95, 0xc9, 0x99, 0x91, 0x7d, 0xc9, 0xc8, 0xc4, 0xc6, 0xc4, 0x04, 0x8c,
+    0xcd, 0x09, 0x00, 0x87, 0x61, 0x81, 0x7d, 0x75, 0x81, 0x71, 0x7d, 0x79, 0x75, 0x79, 0x6d, 0x65,
+    0x71, 0x69, 0x69, 0x6d, 0x65, 0x5d, 0x85, 0x5d, 0x59, 0x61, 0x55, 0x59, 0x51, 0x55, 0x51, 0x4d,
+    0x09, 0x49, 0xf5, 0x48, 0xe1, 0x48, 0x50, 0xff, 0x50, 0x4c, 0x4f, 0x4e, 0x4d, 0x64, 0x4e, 0x4b,
+    0x49, 0x4c, 0x8e, 0x4a, 0x4a, 0x4b, 0x0f, 0x97, 0x34, 0x76, 0x84, 0x74, 0x64, 0x84, 0x54, 0x64,
+    0x54, 0x49, 0x34, 0x54, 0x84, 0x0f, 0x05, 0x09, 0x05, 0x79, 0xb1, 0x42, 0xef, 0x05, 0xfa, 0x01,
+    0xa0, 0xf3, 0xe3, 0xd3, 0x43, 0xea, 0xc3, 0xa3, 0xd3, 0xdd, 0xe1, 0xd1, 0x34, 0xb3, 0x93, 0x83,
+    0xe3, 0xe4, 0xdc, 0xe0, 0xd8, 0xd4, 0xdc, 0xd8, 0x70, 0xb7, 0x35, 0x5b, 0x1a, 0x33, 0x34, 0x59,
+    0x2d, 0xf6, 0x9a, 0xc5, 0x62, 0x1f, 0x7b, 0x3d, 0xd3, 0x1a, 0xa6, 0x4c, 0x2b, 0x99, 0x32, 0x63,
+    0x58, 0xc9, 0x8c, 0x11, 0xb3, 0xca, 0x3a, 0xba, 0xaa, 0x4a, 0x9a, 0xaa, 0x0a, 0xe6, 0x34, 0xf5,
+    0x0b, 0x2a, 0x98, 0xb8, 0x2f, 0xa3, 0xa8, 0x5d, 0xfe, 0x21, 0x30, 0x22, 0xba, 0x1b, 0xa8, 0x05,
+    0xf7, 0x3f, 0x5d, 0x9c, 0xd7, 0xc9, 0xbd, 0x95, 0x7d, 0xbf, 0xba, 0xa6, 0xb6, 0x4f, 0xdf, 0xa6,
+    0x1e, 0x1d, 0x2c, 0x6e, 0x26, 0x0c, 0xe9, 0x76, 0x94, 0xc0, 0x9c, 0x9b, 0xdc, 0x36, 0x0e, 0xee,
+    0x3b, 0x60, 0xfb, 0x46, 0xa7, 0xe5, 0x53, 0x0b, 0xe8, 0xb7, 0xb3, 0x80, 0x8a, 0x7e, 0x62, 0xf9,
+    0x11, 0x0d, 0xc5, 0x72, 0x85, 0x4a, 0x68, 0x97, 0xce, 0xca, 0x95, 0x2a, 0x56, 0xdc, 0x55, 0xb6,
+    0x67, 0x54, 0xa6, 0x64, 0x99, 0x22, 0x05, 0x74, 0x35, 0xca, 0x13, 0x29, 0x6f, 0x28, 0x51, 0x62,
+    0x40, 0x71, 0xc2, 0xe4, 0x09, 0x8a, 0x26, 0x4e, 0x5e, 0xc8, 0x68, 0xf2, 0x5d, 0xc2, 0x44, 0xc9,
+    0x12, 0x4f, 0x24, 0x4a, 0x92, 0x1c, 0x91, 0x61, 0xe3, 0xc8, 0x17, 0x87, 0x91, 0x22, 0x9b, 0x46,
+    0x12, 0x89, 0x14, 0x19, 0x22, 0x84, 0xc8, 0x5b, 0x48, 0x90, 0x4d, 0x20, 0x41, 0x80, 0xfc, 0xc0,
+    0xc1, 0xea, 0xc3, 0x86, 0xa6, 0x0e, 0x1f, 0x3b, 0x3d, 0x34, 0x33, 0x79, 0xf4, 0xc0, 0xdc, 0xc1,
+    0x43, 0x11, 0xf3, 0x52, 0xc7, 0x8e, 0x61, 0x8e, 0x4b, 0xb5, 0x1c, 0x3f, 0x6e, 0xd4, 0xb8, 0xe2,
+    0xf8, 0x1a, 0x60, 0xcb, 0x19, 0x34, 0x2a, 0x67, 0xc0, 0xa8, 0x7c, 0xe1, 0x02, 0x46, 0x0b, 0x16,
+    0x2e, 0x34, 0xd7, 0x58, 0x60, 0xe1, 0xf9, 0xb4, 0x21, 0x23, 0x46, 0x65, 0xdb, 0xda, 0x56, 0xed,
+    0x9b, 0xc6, 0x96, 0x02, 0x45, 0x0a, 0x13, 0x28, 0x4a, 0x90, 0x30, 0x31, 0x59, 0x62, 0x84, 0x08,
+    0x12, 0x0f, 0x46, 0x3c, 0x8a, 0xe8, 0x30, 0xc9, 0x41, 0x43, 0x87, 0x0d, 0x1c, 0xda, 0x1b, 0x32,
+    0x60, 0xd0, 0x70, 0x01, 0x83, 0xd9, 0x85, 0xed, 0x99, 0x85, 0xc7, 0x0a, 0x92, 0x16, 0xd8, 0x15,
+    0x28, 0x4c, 0x90, 0x94, 0x10, 0x39, 0x21, 0xb1, 0x50, 0x02, 0x64, 0x84, 0xc8, 0xf7, 0x61, 0x04,
+    0xc7, 0x07, 0x8a, 0x87, 0x6e, 0x07, 0x8a, 0x89, 0x88, 0x0e, 0x10, 0xdd, 0x85, 0x91, 0x86, 0xee,
+    0xcd, 0x06, 0x0c, 0x0c, 0x35, 0x19, 0xb4, 0xd9, 0x84, 0xed, 0xb2, 0xc1, 0xc9, 0xc7, 0x07, 0x87,
+    0x85, 0x6c, 0x34, 0xb3, 0x6f, 0x19, 0xd9, 0x59, 0x5a, 0x10, 0xbd, 0x9f, 0xd3, 0x82, 0x66, 0x74,
+    0xbe, 0x17, 0x38, 0x97, 0xc7, 0xe6, 0xc0, 0xf2, 0x02, 0x72, 0xe0, 0x02, 0xc0, 0x3f, 0x32, 0xa0,
+    0xfe, 0xe7, 0xa7, 0xfb, 0x85, 0x8d, 0xc6, 0xe2, 0xb0, 0x58, 0x81, 0x5e, 0xde, 0xa7, 0x20, 0x01,
+    0x82, 0xbe, 0x04, 0x07, 0x0c, 0x20, 0x38, 0xb0, 0x67, 0x80, 0x6f, 0x8f, 0x0f, 0x6f, 0x48, 0x2f,
+    0x0f, 0x2f, 0xef, 0x0e, 0xae, 0x80, 0xa2, 0xdd, 0x5d, 0x1d, 0x01, 0xbb, 0xb0, 0x3a, 0xba, 0x39,
+    0x02, 0x60, 0x74, 0x71, 0x73, 0x72, 0x71, 0x72, 0x6f, 0x70, 0x03, 0xde, 0xbe, 0x06, 0x08, 0xa2,
+    0xf7, 0xb3, 0x1e, 0xde, 0xc3, 0x8b, 0x7b, 0x13, 0x0b, 0x03, 0xfb, 0x12, 0xd0, 0xc6, 0xb6, 0xa6,
+    0x96, 0xd6, 0xc6, 0x86, 0xb6, 0xd6, 0xa5, 0x16, 0x95, 0x76, 0x06, 0x86, 0x66, 0x76, 0x56, 0x46,
+    0x66, 0x56, 0xf6, 0x1d, 0x23, 0xfb, 0x8a, 0x8d, 0x85, 0x89, 0x09, 0x08, 0x13, 0xe0, 0x65, 0x04,
+    0xf6, 0xe5, 0xf5, 0xc5, 0x35, 0xd5, 0xb5, 0xc5, 0xa5, 0x95, 0xb5, 0xa5, 0x85, 0x75, 0x95, 0x85,
+    0x65, 0x75, 0x45, 0x65, 0x55, 0x45, 0x55, 0x25, 0x35, 0x34, 0x15, 0x40, 0x2a, 0x00, 0xd4, 0x51,
+    0x54, 0xe6, 0x13, 0x94, 0xa6, 0x53, 0x53, 0x8c, 0xc9, 0xa8, 0x94, 0x02, 0xfb, 0x43, 0x50, 0x23,
+    0x00, 0x08, 0x00, 0x68, 0x00, 0x33, 0x6a, 0x09, 0x83, 0xd3, 0x2c, 0x75, 0x52, 0x0b, 0x34, 0xee,
+    0x20, 0xa2, 0x80, 0x4b, 0x21, 0x40, 0x78, 0x01, 0x00, 0x39, 0x02, 0x2b, 0x06, 0x13, 0xdd, 0x55,
+    0x63, 0x28, 0xd1, 0xea, 0xc7, 0xf0, 0xe2, 0xcd, 0xe7, 0x3e, 0xc5, 0xcb, 0xe9, 0xa2, 0x8f, 0xb5,
+    0x66, 0xec, 0x97, 0x54, 0xcd, 0xee, 0x9d, 0x7a, 0x94, 0xb9, 0x70, 0xac, 0xee, 0xe1, 0xb2, 0xfe,
+    0x81, 0x02, 0x53, 0xdc, 0x7a, 0xea, 0x57, 0x68, 0xef, 0x24, 0x71, 0xbc, 0xc7, 0xef, 0xbd, 0x7a,
+    0x16, 0xa3, 0x1d, 0x3c, 0x74, 0x03, 0x97, 0x1e, 0xfa, 0x41, 0x47, 0x0e, 0x0d, 0x04, 0xa9, 0x8c,
+    0x4f, 0x78, 0x43, 0xbc, 0x22, 0xce, 0xf1, 0xa6, 0x67, 0x05, 0xd1, 0xbc, 0x73, 0xea, 0x76, 0x7d,
+    0x58, 0xa6, 0x93, 0x91, 0x8c, 0xba, 0x80, 0x6b, 0xb1, 0x38, 0xd3, 0xea, 0xfe, 0x5d, 0xdc, 0x01,
+    0xec, 0x4e, 0x7d, 0xf0, 0x90, 0xf9, 0xcc, 0x30, 0x26, 0x87, 0x0f, 0xec, 0xeb, 0xc9, 0x0f, 0xd4,
+    0x6f, 0xce, 0x61, 0x3d, 0xa1, 0x3e, 0x23, 0x64, 0xf3, 0x49, 0x5c, 0x24, 0xcb, 0x3d, 0x89, 0x5f,
+    0x8d, 0xff, 0x03, 0x25, 0x93, 0x47, 0xaa, 0xa1, 0xd2, 0xda, 0xdc, 0x0b, 0x1a, 0x2b, 0x3f, 0xc8,
+    0x3d, 0x63, 0x41, 0x70, 0xfb, 0xc5, 0xa0, 0xd3, 0x48, 0xce, 0x37, 0x84, 0xf2, 0xf6, 0xc7, 0x38,
+    0xdc, 0x49, 0xe6, 0x3a, 0xb8, 0x38, 0x06, 0x8b, 0xa1, 0xf6, 0x30, 0xeb, 0x37, 0xbb, 0x01, 0x62,
+    0x4a, 0x1f, 0xfb, 0x32, 0x9f, 0xc9, 0x3e, 0x82, 0xf7, 0x7f, 0xe9, 0x2a, 0xe6, 0x56, 0x0e, 0xb3,
+    0x63, 0xd7, 0x37, 0x6f, 0x83, 0x4a, 0xc3, 0x76, 0x2b, 0xff, 0xc0, 0xb9, 0xd1, 0x61, 0x9c, 0x0d,
+    0x07, 0x47, 0x1b, 0x89, 0x3d, 0xcf, 0x5e, 0xb1, 0x6b, 0x31, 0xce, 0xc7, 0x92, 0xd6, 0x3f, 0xaf,
+    0xb1, 0x9f, 0x3d, 0xe3, 0x85, 0x74, 0xe6, 0xfa, 0x31, 0x2a, 0xf8, 0x56, 0xcf, 0x4d, 0x54, 0xf0,
+    0x83, 0xf8, 0x5f, 0x40, 0x18, 0x51, 0xd9, 0x45, 0x82, 0x9b, 0xc5, 0x2f, 0xfa, 0xc4, 0x46, 0x78,
+    0xb2, 0x53, 0xcf, 0x71, 0x7f, 0xca, 0xdb, 0xc7, 0x65, 0x60, 0x6f, 0x11, 0x2b, 0xbc, 0xfd, 0x3c,
+    0x6f, 0xa0, 0x69, 0x10, 0xfa, 0xd9, 0x97, 0xa8, 0x92, 0x7d, 0x4e, 0xb0, 0xf7, 0xd9, 0x05, 0xdd,
+    0x24, 0xab, 0x71, 0xea, 0xa4, 0x4e, 0xb8, 0x40, 0x88, 0xbf, 0x96, 0xf0, 0x48, 0xbc, 0x9a, 0x84,
+    0xb6, 0xab, 0x3e, 0x72, 0x8a, 0x71, 0x22, 0xc9, 0x91, 0x74, 0x66, 0xe1, 0xc2, 0xe8, 0x21, 0xfc,
+    0x06, 0x5e, 0xd8, 0x85, 0x54, 0x7f, 0x35, 0x80, 0x87, 0x01, 0x8b, 0xde, 0xfe, 0xea, 0x0e, 0x42,
+    0xdb, 0xaa, 0x9f, 0x7c, 0xf2, 0x75, 0xe2, 0xb5, 0x1f, 0xc7, 0xf9, 0x4e, 0xbb, 0xc6, 0xdd, 0xfb,
+    0xe0, 0x2e, 0x39, 0x4d, 0xc9, 0x3f, 0x57, 0x3e, 0xe6, 0x68, 0x41, 0xc3, 0xa3, 0xbe, 0x01, 0xb6,
+    0x60, 0x52, 0xf3, 0xc7, 0x39, 0xd7, 0x7e, 0xf5, 0xe1, 0x1c, 0xa9, 0x77, 0x1e, 0xe0, 0xbc, 0x37,
+    0x04, 0x68, 0x38, 0x7b, 0xff, 0xb8, 0xf6, 0x03, 0x06, 0xae, 0x51, 0xc4, 0xa1, 0x4f, 0x6f, 0x7f,
+    0x2d, 0x87, 0x09, 0x0f, 0xbe, 0xd6, 0x0c, 0x2b, 0xda, 0x86, 0xdc, 0x93, 0x7b, 0xd5, 0x0f, 0x5e,
+    0x7e, 0x61, 0xdf, 0x22, 0x45, 0xa0, 0xec, 0xcd, 0x23, 0xaf, 0xef, 0x6a, 0xa0, 0xcc, 0xf1, 0x12,
+    0x3a, 0xf2, 0xf7, 0xdb, 0x05, 0xf8, 0xa4, 0xb6, 0x1b, 0xfb, 0xf3, 0x7f, 0x00, 0x47, 0x9c, 0x1b,
+    0x54, 0xbd, 0xc6, 0x2f, 0xd2, 0x1b, 0x0d, 0xbc, 0x98, 0xd3, 0x5a, 0xef, 0x79, 0x75, 0x73, 0x7e,
+    0xc9, 0x83, 0xf5, 0x24, 0xe8, 0x26, 0x68, 0x8c, 0x6b, 0xbc, 0x5f, 0x42, 0x4a, 0xe1, 0xef, 0x73,
+    0x82, 0x57, 0x42, 0x9d, 0xf6, 0xff, 0x1d, 0xf5, 0x2c, 0x2e, 0x8b, 0x16, 0xe1, 0xf6, 0xa9, 0xab,
+    0x24, 0xba, 0x26, 0x3a, 0x7c, 0xdf, 0x1e, 0x73, 0x83, 0x71, 0x3f, 0xf1, 0x96, 0x10, 0x20, 0x7e,
+    0x17, 0xe2, 0x2b, 0xb4, 0xb0, 0x59, 0xdb, 0xc9, 0x15, 0xeb, 0x34, 0x71, 0xe6, 0x71, 0xff, 0x30,
+    0x9a, 0xbf, 0x08, 0x16, 0xfe, 0xc9, 0xc5, 0x0d, 0xab, 0x6b, 0xd1, 0x46, 0xd7, 0x55, 0xd1, 0xc8,
+    0xeb, 0x87, 0x8d, 0xd9, 0x7f, 0x37, 0xdc, 0xde, 0xa1, 0x94, 0xe9, 0x49, 0xba, 0xb0, 0xd5, 0x48,
+    0xad, 0xe3, 0xe3, 0x7a, 0x24, 0x1d, 0x60, 0xf5, 0x89, 0x35, 0x65, 0x0e, 0x08, 0x5e, 0x22, 0xe3,
+    0xe9, 0xc6, 0x8c, 0x7d, 0x35, 0x9c, 0x4b, 0x34, 0xda, 0xbd, 0xb3, 0xfa, 0xc3, 0xf5, 0x9a, 0x22,
+    0xcc, 0xbe, 0xf1, 0xe2, 0x39, 0x1e, 0xb8, 0x55, 0x45, 0x31, 0x67, 0x03, 0xae, 0xf2, 0x6a, 0x65,
+    0x48, 0x87, 0x4d, 0x21, 0xb2, 0x3c, 0x99, 0xed, 0x6f, 0xa4, 0xfd, 0x64, 0x13, 0xfc, 0xe8, 0x10,
+    0x7a, 0x30, 0x4e, 0x6e, 0xa6, 0xf5, 0xe0, 0xdd, 0x06, 0x6b, 0x3c, 0x95, 0xdf, 0xa4, 0x6b, 0x8e,
+    0xb1, 0x0f, 0xac, 0x1f, 0x61, 0x6f, 0x47, 0x39, 0xee, 0x06, 0x0c, 0xbe, 0x9e, 0x1f, 0x83, 0x57,
+    0x4e, 0x1c, 0x43, 0x2e, 0x84, 0x57, 0xca, 0xc8, 0x02, 0xcf, 0xc5, 0x48, 0x9d, 0xbe, 0x64, 0x6e,
+    0xec, 0x53, 0xd6, 0x8b, 0x0f, 0x8f, 0x36, 0xff, 0x8e, 0x0a, 0x98, 0x00, 0xee, 0x88, 0xe0, 0x03,
+    0xdf, 0x3f, 0x13, 0x6c, 0xcf, 0x00, 0x1f, 0x92, 0x8c, 0xe7, 0x70, 0x4b, 0xaf, 0xa3, 0x37, 0x07,
+    0xe8, 0x7c, 0x63, 0x9f, 0xa4, 0xc8, 0x47, 0x47, 0x9d, 0x9f, 0x7c, 0x7c, 0x48, 0x7d, 0xec, 0xa7,
+    0xae, 0xf7, 0xa7, 0xfe, 0x77, 0x88, 0xcf, 0x13, 0x80, 0xa3, 0x79, 0xb4, 0x0e, 0x6e, 0xb6, 0x29,
+    0xe4, 0xcc, 0x01, 0xa4, 0x5f, 0xe7, 0x67, 0xe7, 0x3c, 0xbf, 0x31, 0xb9, 0x69, 0x7e, 0x8d, 0x28,
+    0x0d, 0xfe, 0x8c, 0xe7, 0xce, 0xaf, 0xee, 0xa6, 0x78, 0x9e, 0xa9, 0xcb, 0xe3, 0x75, 0x29, 0xab,
+    0x32, 0x68, 0xcd, 0x41, 0x9e, 0x67, 0x4a, 0xe7, 0x80, 0x68, 0x08, 0x0b, 0x56, 0xf9, 0xc3, 0xf9,
+    0x3d, 0xc6, 0x4c, 0x97, 0x84, 0xcb, 0x70, 0xc2, 0xeb, 0xb2, 0xbf, 0xaf, 0xe2, 0x38, 0xbe, 0x80,
+    0x7f, 0xc6, 0x75, 0x77, 0x0d, 0x6b, 0x90, 0x7c, 0x71, 0xfe, 0xbc, 0xfc, 0x76, 0x13, 0xea, 0x5e,
+    0x61, 0x2f, 0x7f, 0x0a, 0xec, 0x7c, 0x31, 0x77, 0xfb, 0xab, 0xa8, 0x5f, 0xc0, 0xc4, 0x71, 0xd7,
+    0x2d, 0xf0, 0x34, 0xbe, 0x87, 0x74, 0xb8, 0xfb, 0xa8, 0x6f, 0x64, 0x4e, 0xb4, 0x53, 0xc9, 0x3f,
+    0xf6, 0x69, 0x06, 0xb7, 0xfd, 0x57, 0xa9, 0x24, 0xa7, 0x9e, 0xbc, 0xb7, 0x4b, 0x63, 0x10, 0x15,
+    0x22, 0x3e, 0xf9, 0x5f, 0x16, 0xfa, 0xa1, 0x95, 0x5f, 0x6e, 0x83, 0x94, 0x45, 0x21, 0xe9, 0xed,
+    0xcc, 0x8d, 0x55, 0x4d, 0x57, 0x87, 0xcb, 0x3e, 0xe9, 0xeb, 0x6c, 0x62, 0xbf, 0xc5, 0xd4, 0xd3,
+    0x55, 0xcd, 0x01, 0xd7, 0xee, 0x5f, 0xd3, 0x98, 0xa7, 0x95, 0xe7, 0x9b, 0xcc, 0x64, 0x07, 0x3b,
+    0xcc, 0x07, 0xf0, 0xa5, 0xa5, 0x8f, 0xf6, 0x10, 0x19, 0x8f, 0xf2, 0xac, 0xfa, 0xb7, 0x9b, 0x73,
+    0xb6, 0x18, 0x06, 0x5b, 0xa1, 0x1f, 0x1a, 0x6c, 0xf1, 0xda, 0x8d, 0x05, 0xcd, 0x41, 0xc0, 0x05,
+    0xa3, 0xe4, 0x61, 0xf9, 0x77, 0xc6, 0x1f, 0xd8, 0x5b, 0x3b, 0xb2, 0x9b, 0x40, 0x4a, 0x7e, 0x75,
+    0x19, 0x18, 0x4c, 0x2b, 0x53, 0x28, 0xeb, 0x7b, 0xa3, 0x16, 0x89, 0x85, 0xcc, 0xd0, 0xeb, 0x26,
+    0x3a, 0xcb, 0xc1, 0xf2, 0xc1, 0xe2, 0xa6, 0x4b, 0xbc, 0x35, 0xf5, 0x72, 0xa3, 0x1e, 0xe1, 0x41,
+    0x42, 0x5b, 0x40, 0x5b, 0x3f, 0x80, 0x0a, 0xfb, 0x0a, 0x66, 0xfa, 0x85, 0xb5, 0x35, 0xdc, 0x7a,
+    0x07, 0x73, 0xb2, 0x3d, 0x5a, 0xdb, 0x1a, 0xfd, 0xc4, 0x6e, 0x7f, 0xfa, 0x1b, 0x24, 0xf7, 0x32,
+    0x3b, 0xe1, 0x4d, 0xaf, 0x7f, 0x36, 0xce, 0x46, 0x6e, 0x77, 0xc8, 0x87, 0xd2, 0x3c, 0xf5, 0x61,
+    0xd7, 0x56, 0x2b, 0x9c, 0x95, 0x3e, 0xa1, 0x86, 0x32, 0xe2, 0xa0, 0xd0, 0x04, 0x32, 0x33, 0x7d,
+    0x17, 0x17, 0xba, 0x35, 0x80, 0xbd, 0xbe, 0x0c, 0x06, 0x97, 0x62, 0x07, 0xc1, 0x6f, 0x88, 0x6a,
+    0x7d, 0x21, 0x8c, 0xfd, 0xef, 0x85, 0x15, 0x6b, 0x28, 0xef, 0xb2, 0x97, 0xbe, 0x79, 0xf5, 0x88,
+    0xa3, 0xe4, 0xa4, 0xe9, 0x20, 0x80, 0xe5, 0x1e, 0x7c, 0x38, 0x5a, 0x39, 0xbd, 0xb9, 0x11, 0x9f,
+    0x88, 0xc6, 0xf6, 0xf2, 0x8c, 0x3c, 0xb8, 0x3f, 0x79, 0xc0, 0x09, 0x4a, 0x97, 0x35, 0x40, 0xf4,
+    0x26, 0x3c, 0xe0, 0x92, 0xd7, 0x2a, 0x60, 0x68, 0xad, 0xdb, 0xef, 0xcf, 0xcd, 0xe0, 0xc3, 0xe0,
+    0x4d, 0xbe, 0x7c, 0x2a, 0x9b, 0x7b, 0x6f, 0x4c, 0x68, 0x74, 0x0e, 0xe6, 0x48, 0x58, 0x4f, 0x80,
+    0x99, 0xae, 0x9e, 0xe9, 0x91, 0xe8, 0x32, 0xf6, 0x68, 0xf2, 0x2c, 0xc4, 0xfa, 0xdd, 0xf7, 0x21,
+    0x2a, 0xde, 0x4c, 0x39, 0xf6, 0x25, 0x9b, 0xf0, 0x90, 0x9a, 0x3a, 0xcb, 0xbb, 0x68, 0xf0, 0x16,
+    0x6d, 0xa3, 0x0b, 0x4c, 0x26, 0x1c, 0xa0, 0xd9, 0x89, 0x0a, 0x93, 0x51, 0x70, 0x6e, 0xa8, 0xad,
+    0x57, 0x39, 0x5c, 0x31, 0x44, 0xfd, 0x27, 0x29, 0xde, 0xc9, 0x92, 0x1d, 0x42, 0x9a, 0xb6, 0xc2,
+    0x1f, 0xa0, 0xd7, 0x72, 0x55, 0x27, 0xca, 0x54, 0xf3, 0x31, 0x12, 0x8f, 0x47, 0x35, 0x48, 0x4e,
+    0xd0, 0x18, 0xfe, 0xd7, 0xfa, 0x64, 0xfe, 0xfd, 0x2f, 0x6b, 0x7d, 0x62, 0x0d, 0x67, 0xc0, 0x1f,
+    0x3f, 0x6b, 0x93, 0x67, 0x15, 0x46, 0x47, 0x01, 0x9c, 0x06, 0x7a, 0x24, 0x3f, 0x40, 0x08, 0x9a,
+    0xf7, 0x02, 0x08, 0x6b, 0xf8, 0xb3, 0xdb, 0xfd, 0xc9, 0x5c, 0x79, 0x10, 0x60, 0x52, 0x30, 0x67,
+    0x0c, 0x64, 0xde, 0x32, 0x63, 0x8a, 0xc4, 0x44, 0x7c, 0xd8, 0xf8, 0xa1, 0xb9, 0x10, 0xf7, 0x29,
+    0x5b, 0x03, 0xbd, 0x0e, 0xae, 0xb1, 0xe0, 0x1f, 0x66, 0x8c, 0xbd, 0x7e, 0x95, 0x7f, 0xdf, 0x4a,
+    0x79, 0xfe, 0x65, 0x73, 0xb0, 0xae, 0xa6, 0x83, 0x1f, 0xef, 0x93, 0x82, 0xee, 0x9a, 0x30, 0x77,
+    0xc5, 0xbe, 0xe5, 0x61, 0x43, 0xd5, 0x8c, 0x92, 0x55, 0x01, 0x7e, 0x2d, 0xbf, 0x4e, 0x82, 0x65,
+    0x28, 0x77, 0x40, 0xd3, 0x64, 0x16, 0xa8, 0xa7, 0xd6, 0xdf, 0x46, 0x19, 0x26, 0xfc, 0xfd, 0x47,
+    0xf2, 0xfc, 0xee, 0x5c, 0xb7, 0x6c, 0xa7, 0xd9, 0xf7, 0x3a, 0x10, 0xb6, 0x32, 0x86, 0x46, 0x95,
+    0x48, 0x65, 0x0c, 0x47, 0x69, 0x37, 0xf8, 0x9f, 0xe3, 0x59, 0x80, 0xbe, 0x36, 0x02, 0xf7, 0x1a,
+    0x0c, 0xfa, 0x02, 0xfa, 0x70, 0xac, 0xbb, 0xcf, 0x83, 0x90, 0xe5, 0x53, 0xa3, 0x45, 0xf3, 0xc0,
+    0xbd, 0xc7, 0x79, 0xf1, 0x4c, 0xba, 0x46, 0xef, 0xb2, 0x13, 0x3f, 0x27, 0x94, 0xf7, 0xec, 0x6c,
+    0x70, 0x45, 0x70, 0x88, 0x29, 0xde, 0x53, 0xf6, 0x02, 0x99, 0xdd, 0x6c, 0x1d, 0x00, 0xf0, 0x4d,
+    0xd0, 0xb0, 0x87, 0x48, 0x99, 0xcb, 0x00, 0x9c, 0x48, 0x9f, 0xb3, 0x19, 0xa9, 0xca, 0x4a, 0xea,
+    0xd4, 0xbd, 0xfa, 0x98, 0xe3, 0xa1, 0xbc, 0xde, 0x5c, 0x5c, 0xa0, 0xdf, 0xc4, 0x75, 0xdd, 0xd8,
+    0x5e, 0x27, 0xe3, 0xe4, 0x3c, 0x2a, 0x0a, 0x8a, 0x0c, 0xef, 0x1e, 0x3c, 0xab, 0x30, 0xad, 0x1b,
+    0xa5, 0x4f, 0x0d, 0x30, 0x98, 0x91, 0x5a, 0x1a, 0xf0, 0xad, 0xd7, 0xac, 0x07, 0x8d, 0xc1, 0xd2,
+    0x01, 0x37, 0x83, 0xa0, 0x10, 0xea, 0x51, 0xed, 0x07, 0x47, 0x73, 0xd8, 0x2f, 0x1d, 0xb0, 0xf7,
+    0xcf, 0xd1, 0xa7, 0x36, 0x99, 0xf0, 0x33, 0xc4, 0xf2, 0xbd, 0xf9, 0x78, 0x7b, 0xcf, 0x14, 0x6a,
+    0x26, 0xc5, 0x0b, 0x13, 0xb1, 0x71, 0x00, 0x19, 0x0f, 0x1a, 0xab, 0xcd, 0xd4, 0x86, 0x97, 0x63,
+    0x7b, 0x90, 0x7f, 0xc2, 0xe3, 0xef, 0xfb, 0x82, 0x6a, 0x32, 0x07, 0xb6, 0x3d, 0xcb, 0xeb, 0x55,
+    0x6b, 0xce, 0xfe, 0x0c, 0xa0, 0x7a, 0xe1, 0xc2, 0xc3, 0xe9, 0x9d, 0xca, 0x2c, 0x3b, 0x8a, 0x04,
+    0xc0, 0xb7, 0x3e, 0x3c, 0x47, 0x7a, 0xde, 0x1a, 0xa3, 0xe7, 0x60, 0xd2, 0x4d, 0x4c, 0x6c, 0xe1,
+    0x85, 0x46, 0xcc, 0x3d, 0x51, 0xd6, 0x77, 0x17, 0x73, 0x3f, 0xca, 0xbb, 0x62, 0x3c, 0x55, 0x00,
+    0xfb, 0xbb, 0xc7, 0x41, 0x49, 0x66, 0x8c, 0x90, 0x84, 0x7f, 0x7b, 0xcd, 0xf6, 0xee, 0x14, 0xba,
+    0x5c, 0xa4, 0xb6, 0xc3, 0xca, 0x0e, 0x82, 0xbb, 0x43, 0x38, 0xce, 0x8e, 0x8c, 0xc6, 0x63, 0x36,
+    0x54, 0xfa, 0x63, 0x8c, 0xbd, 0x57, 0x2d, 0x8a, 0x94, 0xd1, 0xd1, 0x09, 0xfe, 0x81, 0x22, 0xa1,
+    0xe6, 0x32, 0xfb, 0x5b, 0x57, 0x9c, 0x78, 0xa8, 0x05, 0x0f, 0x69, 0xe1, 0x6e, 0xf4, 0xd4, 0x21,
+    0x7d, 0xcf, 0x69, 0xf7, 0x19, 0xe8, 0xcf, 0xfc, 0xa4, 0x8e, 0xa7, 0xf8, 0x86, 0xb9, 0x6f, 0xa5,
+    0x90, 0xfe, 0x21, 0xec, 0xa2, 0x79, 0xe6, 0xe5, 0xdd, 0x7f, 0x5a, 0xfc, 0x99, 0x93, 0x81, 0xcb,
+    0xaf, 0xec, 0xdf, 0xcc, 0xe5, 0x33, 0x73, 0x61, 0x97, 0xfe, 0x03, 0xac, 0x57, 0x30, 0x0c, 0x8c,
+    0x38, 0x4e, 0x46, 0xc6, 0x7c, 0x47, 0xd8, 0x99, 0x4c, 0x8b, 0x3a, 0x10, 0xf1, 0x43, 0x2d, 0x73,
+    0xe2, 0x5c, 0x3b, 0x0e, 0xc2, 0xde, 0x1d, 0x87, 0x73, 0x76, 0x4e, 0xb1, 0x18, 0x1b, 0xc6, 0x8f,
+    0x62, 0xfd, 0xbb, 0x57, 0xee, 0x60, 0xfd, 0xb9, 0xa6, 0x30, 0x22, 0x17, 0xed, 0xcd, 0xae, 0x29,
+    0x23, 0xde, 0x04, 0x92, 0xe8, 0xee, 0xdc, 0x2d, 0x3a, 0xb3, 0x17, 0xd6, 0xc3, 0x97, 0xf5, 0xc2,
+    0xcc, 0x9a, 0x9e, 0x18, 0x4f, 0x27, 0xc7, 0x63, 0x7b, 0x9f, 0x7c, 0x7d, 0x5a, 0x9b, 0x48, 0xfb,
+    0x7c, 0x9f, 0x07, 0xb9, 0xe3, 0x33, 0xbd, 0x70, 0x71, 0x8d, 0x5a, 0x80, 0x8c, 0xdf, 0xab, 0x1e,
+    0x97, 0x34, 0xdc, 0xd0, 0xd6, 0x34, 0xda, 0x67, 0xc1, 0x1a, 0x0f, 0x9b, 0x4c, 0x7a, 0x6b, 0x59,
+    0x96, 0x2d, 0xe5, 0xf6, 0x35, 0x38, 0xd1, 0xb5, 0x13, 0xdd, 0xfb, 0xbc, 0xd1, 0x5e, 0x77, 0x74,
+    0x26, 0xc0, 0xb9, 0x5c, 0x38, 0xc8, 0x0c, 0x4e, 0x4b, 0x0f, 0xf8, 0xeb, 0xbd, 0x5e, 0xf1, 0x62,
+    0x6e, 0x76, 0xb7, 0x60, 0x9a, 0x4f, 0xef, 0x9a, 0x2e, 0xdd, 0xa2, 0x93, 0x6e, 0x28, 0xf8, 0xda,
+    0x30, 0x57, 0x87, 0x70, 0x6f, 0x61, 0x6d, 0x2b, 0xef, 0x6e, 0x5d, 0x28, 0xbf, 0x8b, 0x55, 0xde,
+    0x3d, 0x4c, 0x79, 0xd8, 0xd5, 0x1e, 0xf5, 0x32, 0x99, 0xdc, 0x60, 0x81, 0x6c, 0xe1, 0x4f, 0x49,
+    0x35, 0x27, 0x24, 0x7e, 0xae, 0xd7, 0xfd, 0x87, 0x4d, 0xea, 0x80, 0x71, 0x70, 0x5f, 0x41, 0x4b,
+    0x59, 0x5b, 0x82, 0xd5, 0x57, 0xe5, 0xa1, 0x97, 0x3c, 0x1a, 0x66, 0xf3, 0x61, 0x76, 0xdf, 0xb8,
+    0x4c, 0x2f, 0xf3, 0x69, 0xb9, 0x87, 0xab, 0x99, 0x74, 0x37, 0xb8, 0x9f, 0xf2, 0x9f, 0x47, 0x9b,
+    0xba, 0xcb, 0x0b, 0x72, 0x91, 0x84, 0xaf, 0x78, 0x79, 0x74, 0xf7, 0x0d, 0x7a, 0x7e, 0x70, 0xb4,
+    0x6f, 0xd9, 0x9d, 0xd5, 0x4a, 0xeb, 0xc4, 0x6c, 0x18, 0x36, 0x70, 0x37, 0xe0, 0xb4, 0xda, 0xc3,
+    0x4d, 0x1b, 0x1a, 0x3b, 0xe6, 0x9e, 0x4f, 0x0c, 0x17, 0x2e, 0x4c, 0xc9, 0x29, 0xd2, 0xba, 0x7f,
+    0x58, 0xb3, 0xb2, 0x5d, 0xec, 0xdd, 0x78, 0x11, 0x76, 0x75, 0xcc, 0xca, 0xcc, 0x13, 0xbb, 0xd7,
+    0x7b, 0x6e, 0xa6, 0x63, 0x83, 0x2e, 0xc7, 0x78, 0x86, 0xf3, 0x40, 0xf9, 0xbd, 0x09, 0xaa, 0xb1,
+    0xc6, 0x14, 0xea, 0x91, 0x04, 0x2f, 0x86, 0x5f, 0x3c, 0x5e, 0x76, 0x6b, 0xc9, 0x76, 0x1e, 0x4d,
+    0x59, 0xa6, 0x69, 0x53, 0x9b, 0x8d, 0x5c, 0x36, 0xe7, 0xf7, 0x41, 0xf6, 0xff, 0x37, 0x3e, 0x6d,
+    0x6f, 0xeb, 0xf4, 0xab, 0x98, 0xd7, 0x50, 0x24, 0xf9, 0x43, 0x65, 0xfd, 0xb8, 0x93, 0xdb, 0xcf,
+    0x41, 0x63, 0xee, 0xa8, 0x43, 0x88, 0x3e, 0xaf, 0x1a, 0xf3, 0x6e, 0x7f, 0x08, 0xa3, 0xf3, 0x2c,
+    0xdd, 0x42, 0x38, 0x9d, 0xee, 0xc3, 0x2e, 0x5d, 0x2c, 0xb2, 0x74, 0x54, 0xd5, 0xaa, 0x20, 0xea,
+    0xf3, 0xb1, 0x0a, 0x53, 0x2c, 0xc2, 0x69, 0x7b, 0xc7, 0xd4, 0x15, 0x4f, 0x51, 0x0e, 0x5f, 0x20,
+    0x81, 0xcb, 0x26, 0x4f, 0x8f, 0xe2, 0x7d, 0x75, 0x7e, 0xd0, 0xf9, 0x78, 0x69, 0x8b, 0x17, 0x66,
+    0xd0, 0xaf, 0xf9, 0x18, 0x56, 0x50, 0x31, 0x47, 0xbf, 0xec, 0x3c, 0x2b, 0xef, 0xd4, 0x94, 0x2f,
+    0xd6, 0x03, 0x63, 0x4d, 0xc2, 0x04, 0x8f, 0xf4, 0x70, 0xb3, 0xdc, 0x71, 0xc3, 0xf3, 0xe9, 0xc0,
+    0xf8, 0x1b, 0x30, 0xd3, 0x85, 0x14, 0x67, 0xa1, 0x70, 0x97, 0x5b, 0xca, 0xac, 0x4b, 0x51, 0x4f,
+    0xf1, 0x55, 0x44, 0x97, 0x80, 0xc1, 0xe4, 0xb0, 0x6c, 0xf5, 0xa3, 0xbd, 0xc7, 0xd8, 0x7e, 0x0f,
+    0xc4, 0x2e, 0x37, 0x41, 0x3c, 0x91, 0xc1, 0xad, 0xcb, 0x3b, 0xd4, 0x8e, 0x7a, 0xc2, 0xb1, 0xd1,
+    0x24, 0xdd, 0x87, 0xfd, 0x8d, 0x60, 0x18, 0xfe, 0x30, 0xff, 0x45, 0x7e, 0xfa, 0xcf, 0xc7, 0xa5,
+    0x91, 0xc4, 0xe4, 0x64, 0x1a, 0xae, 0x0d, 0xb1, 0xcd, 0xd9, 0x77, 0x99, 0x4e, 0x23, 0x10, 0xb4,
+    0xb8, 0x74, 0xf3, 0x16, 0x2e, 0xbf, 0x0b, 0xe5, 0x9b, 0x63, 0x7c, 0x21, 0xb4, 0x65, 0x8c, 0x3a,
+    0x6e, 0xec, 0xd9, 0xfd, 0x2a, 0xab, 0x34, 0xeb, 0x18, 0x78, 0xc8, 0x8a, 0x48, 0xf7, 0x0f, 0x0d,
+    0x6b, 0xf3, 0xe2, 0xf4, 0x31, 0x8c, 0x8d, 0xb6, 0xc8, 0x88, 0x43, 0x8e, 0xd6, 0xa3, 0x8f, 0xf0,
+    0x66, 0xf0, 0x43, 0x77, 0xe5, 0x27, 0xca, 0x8d, 0x3e, 0x90, 0xc0, 0xfc, 0x6e, 0xb0, 0xae, 0xf4,
+    0xcd, 0x45, 0xb6, 0x72, 0x02, 0xed, 0x29, 0xfb, 0xbe, 0x54, 0xa9, 0x76, 0x9b, 0xc2, 0x1c, 0xb9,
+    0xb1, 0x27, 0x37, 0xfa, 0xa3, 0x0b, 0xf4, 0xe6, 0x3f, 0x24, 0xb5, 0x41, 0xf1, 0x25, 0x15, 0xac,
+    0xf0, 0x8f, 0x3e, 0xbe, 0x39, 0x56, 0x75, 0xee, 0xfe, 0xcb, 0x94, 0x20, 0xab, 0x8b, 0xdc, 0xab,
+    0xeb, 0x37, 0x3c, 0xf8, 0xe0, 0xfe, 0x82, 0xd2, 0xd9, 0x97, 0x5f, 0xc7, 0x42, 0xff, 0xc1, 0x7f,
+    0x65, 0x26, 0x43, 0x06, 0xd3, 0x6d, 0x8a, 0x47, 0x8e, 0xbc, 0x96, 0x68, 0x61, 0x54, 0x70, 0x48,
+    0x0a, 0x62, 0x75, 0xcb, 0xc6, 0xc4, 0xba, 0xf2, 0xaf, 0x0a, 0xfc, 0x3f, 0xcf, 0x27, 0x5a, 0xa8,
+    0x7c, 0x2a, 0x9e, 0x0f, 0x4a, 0x90, 0x59, 0xfe, 0x97, 0x1e, 0xf7, 0x0b, 0x92, 0x39, 0xd6, 0xaa,
+    0x26, 0xc7, 0xfc, 0x8e, 0x5e, 0xd1, 0x1e, 0xde, 0x3c, 0x63, 0xf7, 0xe9, 0xc5, 0x6a, 0x6e, 0x7f,
+    0x8e, 0xb8, 0x6f, 0x20, 0xfb, 0x4e, 0xcf, 0xfe, 0x2e, 0x2c, 0x5e, 0x4b, 0xfa, 0xf3, 0xd2, 0x3d,
+    0x0e, 0x9c, 0xfe, 0xa5, 0xe0, 0xfe, 0x08, 0x7e, 0xe7, 0x29, 0x55, 0x59, 0x7b, 0x0f, 0xb2, 0x74,
+    0x95, 0xc9, 0x19, 0xf5, 0x62, 0xcc, 0xa2, 0x75, 0x1e, 0xad, 0xe7, 0xa9, 0xba, 0xca, 0x84, 0x57,
+    0x71, 0x81, 0x2a, 0x04, 0x7f, 0x10, 0xa3, 0x37, 0x96, 0x9b, 0x29, 0x4a, 0x17, 0x2c, 0x52, 0x48,
+    0x09, 0x38, 0xa6, 0x9a, 0x1f, 0xc8, 0x45, 0x3e, 0xc8, 0x6d, 0xf5, 0x38, 0xd2, 0x5a, 0xb9, 0x37,
+    0xdc, 0xd9, 0x44, 0x36, 0xcc, 0x3e, 0x03, 0x57, 0xda, 0xd8, 0xc0, 0x8a, 0xef, 0x66, 0xbf, 0x98,
+    0x1f, 0xe3, 0xb4, 0x19, 0x40, 0xd1, 0xf3, 0x58, 0xb7, 0x6f, 0xae, 0xdf, 0xe7, 0xe5, 0xf7, 0x6c,
+    0x72, 0x2b, 0x9a, 0x32, 0x0a, 0xf4, 0x04, 0x4e, 0x7c, 0x4f, 0x6f, 0xd1, 0x4b, 0x67, 0x93, 0xdb,
+    0xa0, 0xfa, 0x04, 0xc4, 0x4d, 0x0b, 0x62, 0xb7, 0x0e, 0x5b, 0xd9, 0x78, 0xd0, 0xdb, 0x28, 0xfb,
+    0xfc, 0x58, 0x2d, 0x57, 0xf5, 0x35, 0xef, 0xe8, 0x3a, 0xaa, 0x6d, 0x59, 0x1a, 0x55, 0x86, 0xcc,
+    0x18, 0xb9, 0x63, 0x49, 0x1d, 0xb6, 0x96, 0xc9, 0x8e, 0x72, 0xcc, 0x5d, 0x7a, 0x8c, 0x4f, 0x20,
+    0x83, 0xd4, 0x67, 0x4d, 0x33, 0xcf, 0xd4, 0xb5, 0x89, 0xcd, 0x93, 0x0d, 0xe0, 0xa2, 0x6d, 0x7c,
+    0xc3, 0x3e, 0x5c, 0x91, 0x03, 0xb9, 0x31, 0xbf, 0x5e, 0x7f, 0xa1, 0x61, 0x37, 0xd2, 0x62, 0x2c,
+    0x75, 0x61, 0x32, 0x40, 0x59, 0xc2, 0xb6, 0xc5, 0x4d, 0xec, 0x4c, 0x7a, 0x07, 0x29, 0xe2, 0xd9,
+    0x85, 0xef, 0x59, 0x16, 0xde, 0xd8, 0xa5, 0xff, 0x83, 0x49, 0xac, 0x33, 0x45, 0xfd, 0xd9, 0xde,
+    0x23, 0x35, 0xf2, 0x9c, 0xb3, 0x7a, 0x98, 0x06, 0x6b, 0x1f, 0x77, 0x71, 0xb4, 0x29, 0x33, 0xc2,
+    0xb3, 0x30, 0x88, 0xe6, 0x2c, 0xfc, 0x78, 0x4f, 0xac, 0x3b, 0x19, 0xe4, 0x00, 0x85, 0x13, 0x25,
+    0xb0, 0x45, 0x39, 0x53, 0xf6, 0x34, 0x74, 0x68, 0xbe, 0x08, 0x91, 0xf3, 0x7d, 0x66, 0x9e, 0xd7,
+    0xb6, 0x4d, 0x4a, 0xd3, 0x85, 0xfc, 0x3f, 0xa0, 0xbd, 0x0d, 0x5d, 0x6d, 0x71, 0x6f, 0xf6, 0x00,
+    0x0d, 0x8f, 0xea, 0x07, 0xfa, 0x22, 0xcd, 0xe7, 0x72, 0x54, 0x1f, 0xbe, 0x96, 0x9d, 0xcb, 0xdd,
+    0xec, 0x92, 0x2a, 0xe7, 0xd8, 0xee, 0xf4, 0xca, 0x6e, 0xb2, 0x9b, 0x7a, 0x41, 0xc3, 0xcf, 0x9e,
+    0xe7, 0x7c, 0x59, 0x9d, 0x3d, 0x78, 0xfa, 0xc3, 0x7c, 0x7b, 0xe0, 0xa2, 0xf5, 0xbd, 0x8d, 0xe0,
+    0xbd, 0x3c, 0xd0, 0xc7, 0x09, 0x76, 0xdc, 0x4c, 0xb9, 0x52, 0xb1, 0x4d, 0xd9, 0x60, 0x36, 0x56,
+    0xd6, 0x49, 0x5f, 0x8a, 0xf7, 0xbb, 0x56, 0xea, 0x17, 0xc5, 0x1b, 0xda, 0x3a, 0x6f, 0x34, 0x1c,
+    0xf2, 0x04, 0xcc, 0x77, 0x89, 0xfb, 0xee, 0xe7, 0x05, 0x97, 0xe0, 0x36, 0x4f, 0x2c, 0x39, 0xf9,
+    0x73, 0xe9, 0x53, 0x39, 0x26, 0xff, 0x01, 0x80, 0x2d, 0x76, 0x69, 0xce, 0x54, 0xe7, 0xd6, 0xf2,
+    0x6a, 0x35, 0xab, 0x6c, 0xb1, 0xe9, 0xc5, 0xd6, 0x30, 0xfb, 0xf6, 0x0f, 0x9b, 0xf0, 0x08, 0x79,
+    0xc3, 0x2b, 0xef, 0x0e, 0xa2, 0x60, 0xe5, 0x10, 0xb3, 0x2a, 0x81, 0xc2, 0xd9, 0x5e, 0x3c, 0x99,
+    0x99, 0x49, 0xf8, 0x18, 0x4e, 0x14, 0x32, 0x0f, 0xb4, 0xa4, 0x92, 0xee, 0xf7, 0xf8, 0xb8, 0x20,
+    0x4c, 0x22, 0x1b, 0xe8, 0x90, 0xf2, 0x2a, 0x93, 0x9c, 0xfe, 0x1a, 0x30, 0xc8, 0xc6, 0x6d, 0xf3,
+    0xd5, 0x18, 0x6c, 0x27, 0x16, 0x84, 0x83, 0xdf, 0x3e, 0x58, 0x0b, 0xc3, 0x47, 0xf5, 0x64, 0x5c,
+    0xe0, 0x69, 0x3b, 0xac, 0xc1, 0x3c, 0x99, 0xb9, 0xc5, 0x7f, 0xb3, 0xef, 0xd7, 0xcc, 0xe3, 0x29,
+    0x3a, 0xf0, 0x94, 0x01, 0x6e, 0x0e, 0xcd, 0xc5, 0xe8, 0x96, 0x89, 0x97, 0x68, 0x81, 0xa4, 0x82,
+    0x4d, 0x93, 0x42, 0x1c, 0x4c, 0x64, 0x6e, 0xa2, 0x6b, 0xf7, 0xcb, 0x5e, 0x4d, 0x15, 0x0c, 0xee,
+    0xc1, 0x88, 0xb2, 0xdc, 0x94, 0x53, 0xfd, 0xa3, 0x70, 0x3f, 0xec, 0x32, 0x7a, 0x38, 0x53, 0xb2,
+    0x5a, 0x66, 0xbd, 0xea, 0x1d, 0xfc, 0xc7, 0xee, 0xff, 0xe3, 0x9b, 0x2d, 0x58, 0xae, 0xf5, 0xfa,
+    0xc8, 0x8a, 0x3f,
 };
+const ShaderModule Blob110 = { Blob110_Data, 6627u, 6515u, 110u };
 
 } // namespace detail
 } // namespace VulkanShaders
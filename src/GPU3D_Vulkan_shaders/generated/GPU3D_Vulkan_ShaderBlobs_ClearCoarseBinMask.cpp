@@ -28,13 +28,12 @@
     Pipeline indices match ComputeRenderer3D::ShaderCompileStep() in
     src/GPU3D_Compute.cpp one for one.
 
-    The SPIR-V words live in per-stage translation units rather than in the
-    header so that including the public header stays cheap: the full module set
-    is a few megabytes of integer literals and would otherwise be re-parsed by
-    every consumer.
+    Every module is one zstd frame, inflated on first use by
+    Vk::InflateShaderModule(). The frames live in per-stage translation units
+    rather than in the header so that including the public header stays cheap.
 */
 
-// SPIR-V for src/GPU3D_Vulkan_shaders/ClearCoarseBinMask.comp.
+// SPIR-V for src/GPU3D_Vulkan_shaders/ClearCoarseBinMask.comp, one zstd frame per module.
 
 #include "GPU3D_Vulkan_ShaderBlobs.h"
 
@@ -45,324 +44,235 @@ namespace VulkanShaders
 namespace detail
 {
 
-extern const uint32_t Blob021[812];
-const uint32_t Blob021[812] = {
-    0x07230203, 0x00010300, 0x0008000b, 0x00000045, 0x00000000, 0x00020011, 0x00000001, 0x0006000b,
-    0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001,
-    0x0006000f, 0x00000005, 0x00000004, 0x6e69616d, 0x00000000, 0x00000015, 0x00060010, 0x00000004,
-    0x00000011, 0x00000040, 0x00000001, 0x00000001, 0x00030003, 0x00000002, 0x000001c2, 0x000a0004,
-    0x475f4c47, 0x4c474f4f, 0x70635f45, 0x74735f70, 0x5f656c79, 0x656e696c, 0x7269645f, 0x69746365,
-    0x00006576, 0x00080004, 0x475f4c47, 0x4c474f4f, 0x6e695f45, 0x64756c63, 0x69645f65, 0x74636572,
-    0x00657669, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000, 0x00060005, 0x0000000d, 0x526e6942,
-    0x6c757365, 0x66754274, 0x00726566, 0x00080006, 0x0000000d, 0x00000000, 0x69726156, 0x57746e61,
-    0x436b726f, 0x746e756f, 0x00000000, 0x00080006, 0x0000000d, 0x00000001, 0x74726f53, 0x6f576465,
-    0x664f6b72, 0x74657366, 0x00000000, 0x00090006, 0x0000000d, 0x00000002, 0x69726156, 0x57746e61,
-    0x526b726f, 0x436c6165, 0x746e756f, 0x00000000, 0x00080006, 0x0000000d, 0x00000003, 0x74726f53,
-    0x6b726f57, 0x6b726f57, 0x6e756f43, 0x00000074, 0x00090006, 0x0000000d, 0x00000004, 0x6e6e6942,
-    0x4d676e69, 0x416b7361, 0x664f646e, 0x74657366, 0x00000000, 0x00030005, 0x0000000f, 0x00000000,
-    0x00080005, 0x00000015, 0x475f6c67, 0x61626f6c, 0x766e496c, 0x7461636f, 0x496e6f69, 0x00000044,
-    0x00050005, 0x00000026, 0x65726353, 0x69576e65, 0x00687464, 0x00060005, 0x00000027, 0x65726353,
-    0x65486e65, 0x74686769, 0x00000000, 0x00060005, 0x00000028, 0x5778614d, 0x546b726f, 0x73656c69,
-    0x00000000, 0x00070005, 0x0000002c, 0x6d617246, 0x66756265, 0x53726566, 0x64697274, 0x00000065,
-    0x00060005, 0x0000002d, 0x656c6954, 0x72655073, 0x656e694c, 0x00000000, 0x00050005, 0x0000002e,
-    0x656c6954, 0x656e694c, 0x00000073, 0x00050005, 0x00000035, 0x6174654d, 0x66696e55, 0x006d726f,
-    0x00060006, 0x00000035, 0x00000000, 0x506d754e, 0x67796c6f, 0x00736e6f, 0x00060006, 0x00000035,
-    0x00000001, 0x566d754e, 0x61697261, 0x0073746e, 0x00060006, 0x00000035, 0x00000002, 0x68706c41,
-    0x66655261, 0x00000000, 0x00050006, 0x00000035, 0x00000003, 0x70736944, 0x00746e43, 0x00060006,
-    0x00000035, 0x00000004, 0x6e6f6f54, 0x6c626154, 0x00000065, 0x00060006, 0x00000035, 0x00000005,
-    0x61656c43, 0x6c6f4372, 0x0000726f, 0x00060006, 0x00000035, 0x00000006, 0x61656c43, 0x70654472,
-    0x00006874, 0x00060006, 0x00000035, 0x00000007, 0x61656c43, 0x74744172, 0x00000072, 0x00060006,
-    0x00000035, 0x00000008, 0x4f676f46, 0x65736666, 0x00000074, 0x00060006, 0x00000035, 0x00000009,
-    0x53676f46, 0x74666968, 0x00000000, 0x00060006, 0x00000035, 0x0000000a, 0x43676f46, 0x726f6c6f,
-    0x00000000, 0x00080006, 0x00000035, 0x0000000b, 0x61656c43, 0x74694272, 0x4f70616d, 0x65736666,
-    0x00000074, 0x00030005, 0x00000037, 0x00000000, 0x00060005, 0x00000038, 0x68737550, 0x736e6f43,
-    0x746e6174, 0x00000073, 0x00060006, 0x00000038, 0x00000000, 0x56727543, 0x61697261, 0x0000746e,
-    0x00060006, 0x00000038, 0x00000001, 0x57786554, 0x68746469, 0x00000000, 0x00060006, 0x00000038,
-    0x00000002, 0x48786554, 0x68676965, 0x00000074, 0x00060006, 0x00000038, 0x00000003, 0x57786554,
-    0x53706172, 0x00000000, 0x00060006, 0x00000038, 0x00000004, 0x57786554, 0x54706172, 0x00000000,
-    0x00070006, 0x00000038, 0x00000005, 0x49786554, 0x70614373, 0x65727574, 0x00000000, 0x00070006,
-    0x00000038, 0x00000006, 0x74706143, 0x59657275, 0x7366664f, 0x00007465, 0x00050006, 0x00000038,
-    0x00000007, 0x6461705f, 0x00000000, 0x00030005, 0x0000003a, 0x00006370, 0x00070005, 0x0000003f,
-    0x6e6e6942, 0x4d676e69, 0x536b7361, 0x74726174, 0x00000000, 0x00080005, 0x00000042, 0x6e6e6942,
-    0x57676e69, 0x4f6b726f, 0x65736666, 0x74537374, 0x00747261, 0x00040047, 0x00000009, 0x00000006,
-    0x00000010, 0x00040047, 0x0000000a, 0x00000006, 0x00000004, 0x00040047, 0x0000000b, 0x00000006,
-    0x00000004, 0x00040047, 0x0000000c, 0x00000006, 0x00000004, 0x00050048, 0x0000000d, 0x00000000,
-    0x00000023, 0x00000000, 0x00050048, 0x0000000d, 0x00000001, 0x00000023, 0x00008000, 0x00050048,
-    0x0000000d, 0x00000002, 0x00000023, 0x0000a000, 0x00050048, 0x0000000d, 0x00000003, 0x00000023,
-    0x0000c000, 0x00050048, 0x0000000d, 0x00000004, 0x00000023, 0x0000c010, 0x00030047, 0x0000000d,
-    0x00000002, 0x00040047, 0x0000000f, 0x00000022, 0x00000000, 0x00040047, 0x0000000f, 0x00000021,
-    0x00000008, 0x00040047, 0x00000015, 0x0000000b, 0x0000001c, 0x00040047, 0x00000026, 0x00000001,
-    0x00000000, 0x00040047, 0x00000027, 0x00000001, 0x00000001, 0x00040047, 0x00000028, 0x00000001,
-    0x00000002, 0x00040047, 0x00000032, 0x00000006, 0x00000010, 0x00050048, 0x00000035, 0x00000000,
-    0x00000023, 0x00000000, 0x00050048, 0x00000035, 0x00000001, 0x00000023, 0x00000004, 0x00050048,
-    0x00000035, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x00000035, 0x00000003, 0x00000023,
-    0x0000000c, 0x00050048, 0x00000035, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x00000035,
-    0x00000005, 0x00000023, 0x00000230, 0x00050048, 0x00000035, 0x00000006, 0x00000023, 0x00000234,
-    0x00050048, 0x00000035, 0x00000007, 0x00000023, 0x00000238, 0x00050048, 0x00000035, 0x00000008,
-    0x00000023, 0x0000023c, 0x00050048, 0x00000035, 0x00000009, 0x00000023, 0x00000240, 0x00050048,
-    0x00000035, 0x0000000a, 0x00000023, 0x00000244, 0x00050048, 0x00000035, 0x0000000b, 0x00000023,
-    0x00000248, 0x00030047, 0x00000035, 0x00000002, 0x00040047, 0x00000037, 0x00000022, 0x00000000,
-    0x00040047, 0x00000037, 0x00000021, 0x00000000, 0x00050048, 0x00000038, 0x00000000, 0x00000023,
-    0x00000000, 0x00050048, 0x00000038, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x00000038,
-    0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x00000038, 0x00000003, 0x00000023, 0x0000000c,
-    0x00050048, 0x00000038, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x00000038, 0x00000005,
-    0x00000023, 0x00000014, 0x00050048, 0x00000038, 0x00000006, 0x00000023, 0x00000018, 0x00050048,
-    0x00000038, 0x00000007, 0x00000023, 0x0000001c, 0x00030047, 0x00000038, 0x00000002, 0x00040047,
-    0x00000044, 0x0000000b, 0x00000019, 0x00020013, 0x00000002, 0x00030021, 0x00000003, 0x00000002,
-    0x00040015, 0x00000006, 0x00000020, 0x00000000, 0x00040017, 0x00000007, 0x00000006, 0x00000004,
-    0x0004002b, 0x00000006, 0x00000008, 0x00000800, 0x0004001c, 0x00000009, 0x00000007, 0x00000008,
-    0x0004001c, 0x0000000a, 0x00000006, 0x00000008, 0x0004001c, 0x0000000b, 0x00000006, 0x00000008,
-    0x0003001d, 0x0000000c, 0x00000006, 0x0007001e, 0x0000000d, 0x00000009, 0x0000000a, 0x0000000b,
-    0x00000007, 0x0000000c, 0x00040020, 0x0000000e, 0x0000000c, 0x0000000d, 0x0004003b, 0x0000000e,
-    0x0000000f, 0x0000000c, 0x00040015, 0x00000010, 0x00000020, 0x00000001, 0x0004002b, 0x00000010,
-    0x00000011, 0x00000004, 0x0004002b, 0x00000006, 0x00000012, 0x00000000, 0x00040017, 0x00000013,
-    0x00000006, 0x00000003, 0x00040020, 0x00000014, 0x00000001, 0x00000013, 0x0004003b, 0x00000014,
-    0x00000015, 0x00000001, 0x00040020, 0x00000016, 0x00000001, 0x00000006, 0x0004002b, 0x00000006,
-    0x00000019, 0x00000002, 0x00040020, 0x0000001d, 0x0000000c, 0x00000006, 0x0004002b, 0x00000006,
-    0x00000023, 0x00000001, 0x00040032, 0x00000010, 0x00000026, 0x00000100, 0x00040032, 0x00000010,
-    0x00000027, 0x000000c0, 0x00040032, 0x00000010, 0x00000028, 0x00003000, 0x0004002b, 0x00000010,
-    0x00000029, 0x00000008, 0x0004002b, 0x00000010, 0x0000002a, 0x00000040, 0x0004002b, 0x00000010,
-    0x0000002b, 0x00000020, 0x00060034, 0x00000010, 0x0000002c, 0x00000084, 0x00000026, 0x00000027,
-    0x00060034, 0x00000010, 0x0000002d, 0x00000087, 0x00000026, 0x00000029, 0x00060034, 0x00000010,
-    0x0000002e, 0x00000087, 0x00000027, 0x00000029, 0x0004002b, 0x00000010, 0x0000002f, 0x00000002,
-    0x0004002b, 0x00000010, 0x00000030, 0x00000800, 0x0004002b, 0x00000006, 0x00000031, 0x00000022,
-    0x0004001c, 0x00000032, 0x00000007, 0x00000031, 0x00030016, 0x00000033, 0x00000020, 0x00040017,
-    0x00000034, 0x00000033, 0x00000002, 0x000e001e, 0x00000035, 0x00000006, 0x00000006, 0x00000010,
-    0x00000006, 0x00000032, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000034, 0x00040020, 0x00000036, 0x00000002, 0x00000035, 0x0004003b, 0x00000036, 0x00000037,
-    0x00000002, 0x000a001e, 0x00000038, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000010, 0x00000006, 0x00040020, 0x00000039, 0x00000009, 0x00000038, 0x0004003b,
-    0x00000039, 0x0000003a, 0x00000009, 0x0004002b, 0x00000006, 0x0000003b, 0x00008000, 0x0004002b,
-    0x00000010, 0x0000003c, 0x00000000, 0x00060034, 0x00000010, 0x0000003d, 0x00000084, 0x0000002d,
-    0x0000002e, 0x00060034, 0x00000010, 0x0000003e, 0x00000084, 0x0000003d, 0x0000002f, 0x00060034,
-    0x00000010, 0x0000003f, 0x00000080, 0x0000003c, 0x0000003e, 0x00060034, 0x00000010, 0x00000040,
-    0x00000084, 0x0000002d, 0x0000002e, 0x00060034, 0x00000010, 0x00000041, 0x00000084, 0x00000040,
-    0x0000002a, 0x00060034, 0x00000010, 0x00000042, 0x00000080, 0x0000003f, 0x00000041, 0x0004002b,
-    0x00000006, 0x00000043, 0x00000040, 0x0006002c, 0x00000013, 0x00000044, 0x00000043, 0x00000023,
-    0x00000023, 0x00050036, 0x00000002, 0x00000004, 0x00000000, 0x00000003, 0x000200f8, 0x00000005,
-    0x00050041, 0x00000016, 0x00000017, 0x00000015, 0x00000012, 0x0004003d, 0x00000006, 0x00000018,
-    0x00000017, 0x00050084, 0x00000006, 0x0000001a, 0x00000018, 0x00000019, 0x00050080, 0x00000006,
-    0x0000001b, 0x00000012, 0x0000001a, 0x00050080, 0x00000006, 0x0000001c, 0x0000001b, 0x00000012,
-    0x00060041, 0x0000001d, 0x0000001e, 0x0000000f, 0x00000011, 0x0000001c, 0x0003003e, 0x0000001e,
-    0x00000012, 0x00050041, 0x00000016, 0x0000001f, 0x00000015, 0x00000012, 0x0004003d, 0x00000006,
-    0x00000020, 0x0000001f, 0x00050084, 0x00000006, 0x00000021, 0x00000020, 0x00000019, 0x00050080,
-    0x00000006, 0x00000022, 0x00000012, 0x00000021, 0x00050080, 0x00000006, 0x00000024, 0x00000022,
-    0x00000023, 0x00060041, 0x0000001d, 0x00000025, 0x0000000f, 0x00000011, 0x00000024, 0x0003003e,
-    0x00000025, 0x00000012, 0x000100fd, 0x00010038,
+const uint8_t Blob021_Data[1132] =
+{
+    0x28, 0xb5, 0x2f, 0xfd, 0x60, 0xb0, 0x0b, 0x15, 0x23, 0x00, 0xf6, 0xf9, 0xa7, 0x3a, 0x20, 0x75,
+    0xb3, 0x06, 0xa0, 0x1a, 0x00, 0x18, 0x00, 0x18, 0xa0, 0x60, 0x00, 0x60, 0x40, 0xc0, 0x00, 0x50,
+    0x26, 0xa0, 0x0b, 0xdb, 0x7b, 0xf6, 0x36, 0x6e, 0xab, 0x26, 0xda, 0x65, 0xc3, 0x8e, 0xb3, 0x49,
+    0xde, 0x0f, 0x2d, 0x09, 0x66, 0x66, 0x36, 0xde, 0x46, 0xba, 0x8c, 0xb7, 0x91, 0x8e, 0x9e, 0x22,
+    0x1d, 0x77, 0x37, 0x11, 0x11, 0x11, 0x21, 0x29, 0x95, 0x00, 0x9e, 0x00, 0x97, 0x00, 0x03, 0x7f,
+    0x87, 0xb5, 0xd4, 0x35, 0xc4, 0x9a, 0x37, 0x42, 0xe9, 0x99, 0x0e, 0xfe, 0x87, 0x9a, 0x77, 0xc7,
+    0x43, 0x5d, 0xd6, 0x66, 0xcb, 0xa9, 0xdd, 0x76, 0x55, 0x65, 0xff, 0x6d, 0x9a, 0x53, 0x5f, 0x43,
+    0xab, 0xfa, 0xd3, 0xa6, 0xe6, 0xb9, 0x9a, 0x3e, 0xff, 0xe4, 0xe2, 0xeb, 0xb5, 0xd9, 0x72, 0x31,
+    0x2d, 0x9a, 0x63, 0xef, 0x4e, 0x7a, 0xc6, 0xfc, 0x01, 0x8b, 0x83, 0x87, 0xb5, 0x1c, 0x4a, 0x4b,
+    0x4f, 0xf2, 0x5b, 0x74, 0xb6, 0xb4, 0xbb, 0x9e, 0xb5, 0xd9, 0x4d, 0x4f, 0x74, 0x76, 0xd1, 0xa3,
+    0x96, 0x9d, 0xe1, 0x70, 0xb4, 0x99, 0x8c, 0x4d, 0x2c, 0x27, 0x27, 0x36, 0x4b, 0x0d, 0x7e, 0xd7,
+    0xf4, 0x7b, 0x7f, 0x7f, 0xdf, 0xfd, 0x30, 0x0f, 0x2e, 0xbe, 0xfa, 0x59, 0xff, 0xe9, 0x69, 0x12,
+    0xfd, 0xe0, 0x1f, 0x2e, 0x3e, 0xf0, 0xff, 0x2d, 0xf0, 0x2f, 0xd2, 0x32, 0x01, 0xa9, 0xb5, 0x2c,
+    0x88, 0x8d, 0xcc, 0x26, 0x26, 0xae, 0xfa, 0xbb, 0xbd, 0x09, 0x96, 0x99, 0x5c, 0x75, 0xf7, 0x3d,
+    0x56, 0x78, 0x5f, 0x39, 0x9d, 0xbf, 0x5c, 0x44, 0x19, 0x67, 0x12, 0xb5, 0x67, 0x8c, 0x8a, 0x3c,
+    0x75, 0x6b, 0x3b, 0x6f, 0x32, 0x94, 0x90, 0x3a, 0xf3, 0x93, 0xaf, 0x6d, 0xeb, 0x1a, 0x6f, 0x2d,
+    0xee, 0xc2, 0xc4, 0x55, 0x45, 0xd5, 0xd7, 0x6a, 0x5e, 0xf4, 0xf5, 0x87, 0xff, 0x17, 0x0d, 0x32,
+    0x79, 0x52, 0x55, 0xe5, 0xb9, 0x4d, 0x5f, 0x38, 0xf6, 0x84, 0xfd, 0x5f, 0xf8, 0xdb, 0xee, 0x8e,
+    0x79, 0xc3, 0xa1, 0xae, 0xdf, 0xeb, 0xd8, 0x54, 0x15, 0x3a, 0x42, 0x55, 0x1d, 0xa2, 0x1c, 0xce,
+    0xbf, 0xb8, 0x38, 0xd1, 0xaa, 0xda, 0xce, 0xb4, 0xc7, 0x6c, 0x6f, 0x8b, 0x05, 0xf9, 0xa6, 0xa7,
+    0xcd, 0x7a, 0x75, 0xfe, 0x8f, 0x5b, 0x3b, 0xd7, 0x56, 0x16, 0x74, 0x89, 0xcc, 0x75, 0xe6, 0xf7,
+    0x78, 0x64, 0x2f, 0x7a, 0xf2, 0x18, 0x99, 0x37, 0xbf, 0xc6, 0xed, 0x4d, 0xe8, 0xbc, 0x34, 0x19,
+    0xb7, 0xb6, 0x76, 0xfe, 0xa4, 0xf7, 0xae, 0x34, 0xd9, 0x8f, 0x71, 0x78, 0xf8, 0xc3, 0x6a, 0x52,
+    0xf5, 0x6c, 0x4d, 0x9a, 0x5a, 0x94, 0xd6, 0xa0, 0x66, 0x90, 0x8a, 0xc6, 0x66, 0xa8, 0x10, 0xf9,
+    0x1f, 0x2b, 0xd6, 0xc0, 0xca, 0x1f, 0x20, 0x30, 0xb8, 0xc4, 0x98, 0x0a, 0x78, 0x1c, 0xe2, 0xbf,
+    0x1f, 0x1c, 0x46, 0x87, 0xc9, 0x8e, 0x71, 0xf0, 0x04, 0x89, 0x5f, 0x64, 0x7d, 0x7f, 0xde, 0xde,
+    0x06, 0xff, 0x02, 0xac, 0xfc, 0x5b, 0xe1, 0x0f, 0xca, 0xb2, 0x2c, 0xcb, 0x72, 0x14, 0x94, 0xd6,
+    0x1e, 0x8d, 0x0a, 0x96, 0x82, 0x41, 0xb1, 0x90, 0xe5, 0x68, 0x22, 0x7a, 0x22, 0x21, 0xc0, 0x93,
+    0x0f, 0xb6, 0x5a, 0x24, 0x9e, 0x46, 0x97, 0x31, 0x86, 0x03, 0x8b, 0xfc, 0x27, 0xfe, 0x29, 0xfe,
+    0x01, 0xef, 0x3b, 0xb6, 0x02, 0x99, 0xbe, 0x25, 0x0f, 0xa9, 0xfb, 0xaf, 0xf8, 0x70, 0x1a, 0x00,
+    0x15, 0x98, 0xfa, 0x15, 0x6a, 0xf0, 0x18, 0x1b, 0x73, 0xbb, 0x9a, 0xad, 0xec, 0x85, 0x86, 0xfb,
+    0x55, 0xae, 0x99, 0xb8, 0xd9, 0x3f, 0x86, 0x40, 0xbf, 0xf8, 0x5d, 0x73, 0x2d, 0xce, 0x7c, 0xb1,
+    0x35, 0xe1, 0xc8, 0x03, 0x2e, 0xc3, 0x99, 0xeb, 0xe7, 0x6d, 0x74, 0x79, 0xfe, 0x6e, 0xcd, 0xbd,
+    0xfe, 0xc5, 0x6f, 0xd9, 0x54, 0x7d, 0xdd, 0xd8, 0x77, 0x97, 0x77, 0x3f, 0x5d, 0x58, 0x5c, 0x54,
+    0x58, 0x4c, 0x50, 0x3c, 0x21, 0x11, 0x51, 0xf0, 0xed, 0x42, 0x00, 0xf1, 0x3f, 0x2c, 0xee, 0x72,
+    0x60, 0x68, 0x40, 0xfa, 0x17, 0x18, 0xc2, 0x93, 0x14, 0x5a, 0x58, 0x09, 0x61, 0xb8, 0xb7, 0xd3,
+    0xde, 0xe1, 0x27, 0x15, 0xb0, 0xdf, 0x60, 0x71, 0x8f, 0x97, 0xeb, 0x7f, 0x89, 0xe1, 0xf8, 0x61,
+    0x5c, 0x30, 0x2e, 0x48, 0xff, 0x4b, 0xc8, 0xdf, 0xe2, 0x02, 0xf2, 0x7f, 0xb4, 0xfc, 0xb3, 0x74,
+    0xac, 0xa0, 0x7e, 0x95, 0xcb, 0x94, 0xcb, 0x53, 0x28, 0x2b, 0x7f, 0xeb, 0xc4, 0x84, 0x64, 0xb5,
+    0x80, 0xf7, 0x26, 0x12, 0x7f, 0xc9, 0xdf, 0x08, 0xa3, 0xc3, 0x08, 0xf9, 0x2f, 0xe2, 0xfd, 0x21,
+    0x19, 0x20, 0x1b, 0x4a, 0xff, 0x47, 0x46, 0xd2, 0xef, 0x21, 0x6e, 0xd2, 0x01, 0xf3, 0x73, 0x4c,
+    0xfe, 0x1b, 0x22, 0xff, 0x1a, 0x33, 0xfd, 0x19, 0xdd, 0x3f, 0x06, 0x49, 0xc5, 0x0f, 0x9e, 0x28,
+    0x22, 0x74, 0x7f, 0x60, 0x70, 0xf0, 0x19, 0x14, 0x10, 0x74, 0xfc, 0x5d, 0x81, 0x20, 0xa8, 0x71,
+    0x7c, 0x83, 0xc8, 0x91, 0xc8, 0x04, 0x29, 0x48, 0x51, 0xd2, 0x01, 0x81, 0x25, 0x21, 0x50, 0x99,
+    0x99, 0x07, 0x31, 0x08, 0x09, 0xc9, 0x46, 0x4e, 0x2a, 0x48, 0x41, 0x61, 0x96, 0x03, 0xca, 0x28,
+    0xf3, 0xbd, 0x13, 0xcc, 0xbf, 0xd6, 0x16, 0xb8, 0x79, 0xf0, 0xe9, 0x99, 0x23, 0x51, 0xaf, 0x5f,
+    0x76, 0x29, 0xb9, 0x32, 0x7b, 0x67, 0x99, 0xb5, 0xfd, 0xa6, 0x8d, 0xdc, 0x33, 0xd8, 0x96, 0x81,
+    0x05, 0x9a, 0x97, 0xb6, 0x50, 0xed, 0xa5, 0xdd, 0xfe, 0x7c, 0x9f, 0x31, 0x1b, 0x87, 0xd7, 0x78,
+    0x16, 0x7c, 0xb9, 0xd0, 0xbb, 0xb3, 0xd9, 0x6e, 0x34, 0x85, 0xa3, 0x55, 0xe2, 0xad, 0x82, 0xc9,
+    0xf2, 0xc6, 0xa4, 0x59, 0xa0, 0xeb, 0x15, 0x9a, 0xca, 0xa6, 0xc4, 0xac, 0x43, 0xff, 0xe2, 0xce,
+    0x63, 0x0e, 0xc4, 0x8b, 0xe1, 0xcf, 0xe3, 0xe8, 0xcf, 0x81, 0xcf, 0xe0, 0xdd, 0x7c, 0x50, 0x3b,
+    0x98, 0xa2, 0x5b, 0x09, 0x26, 0xb9, 0xd2, 0x1e, 0xb6, 0xd3, 0xab, 0xe0, 0x28, 0xf7, 0x11, 0x8a,
+    0x43, 0x9a, 0x21, 0x07, 0xd3, 0x9e, 0x60, 0x62, 0xe1, 0x4b, 0x79, 0x1f, 0x63, 0x7a, 0x07, 0xfc,
+    0xe0, 0x87, 0xcf, 0xa6, 0xd0, 0x7f, 0x36, 0xa2, 0x7e, 0xb9, 0x3d, 0xbe, 0xc9, 0xea, 0x29, 0x7b,
+    0x32, 0x63, 0xf7, 0x83, 0x0b, 0xf3, 0x26, 0x8e, 0xa7, 0x02, 0x71, 0x18, 0xe0, 0xe1, 0x8b, 0xae,
+    0xff, 0x49, 0x3d, 0x05, 0x7c, 0x20, 0xec, 0xdd, 0x1f, 0xb0, 0x6f, 0xf1, 0x26, 0xbd, 0x59, 0xf9,
+    0xbc, 0xf8, 0x4f, 0xae, 0x75, 0xe9, 0x9c, 0xdc, 0x98, 0x90, 0x4c, 0x32, 0xf9, 0x50, 0x8a, 0x8e,
+    0xa1, 0x13, 0x7b, 0x93, 0xa3, 0x2d, 0xc2, 0x35, 0x0b, 0xed, 0x50, 0x64, 0xc5, 0x93, 0x4b, 0x3f,
+    0x10, 0x80, 0xf4, 0x95, 0xe5, 0xc6, 0x16, 0x3c, 0xed, 0x98, 0x98, 0x70, 0x63, 0xe3, 0xe3, 0xf3,
+    0x8f, 0xc8, 0x77, 0x32, 0xec, 0x00, 0x3b, 0x21, 0xd4, 0x5a, 0xa2, 0xb3, 0x22, 0x2a, 0x3c, 0x46,
+    0x73, 0x81, 0x3e, 0x54, 0x13, 0x01, 0x33, 0xdd, 0x75, 0x9b, 0xfc, 0x46, 0xfc, 0x06, 0xbf, 0xf0,
+    0x1e, 0x19, 0x0f, 0x26, 0x6a, 0x77, 0x14, 0x5c, 0x4b, 0xba, 0x01, 0xb0, 0x2c, 0x74, 0x7d, 0x7f,
+    0x9b, 0x07, 0x84, 0x74, 0xc0, 0x89, 0x62, 0x8c, 0x40, 0xbb, 0x80, 0x7a, 0x26, 0x80, 0xf9, 0xd7,
+    0x99, 0x8d, 0x0d, 0xe2, 0x19, 0x2f, 0x1d, 0xe7, 0xc7, 0x9a, 0x8e, 0x8c, 0x2a, 0x08, 0x46, 0x79,
+    0xda, 0xc9, 0x11, 0xbd, 0x03, 0xa4, 0x35, 0x46, 0x88, 0x3a, 0xdb, 0x06, 0xff, 0xd8, 0x13, 0x7e,
+    0x1f, 0xea, 0x1d, 0xc0, 0xe5, 0x48, 0x51, 0x96, 0x6d, 0x01, 0x5f, 0xdc, 0xa3, 0x7e, 0xe6, 0x91,
+    0xed, 0xf1, 0xae, 0xe1, 0x61, 0x1a, 0x37, 0x07, 0xbd, 0xe0, 0x70, 0xef, 0x75, 0x2c, 0x87, 0x6f,
+    0x6c, 0x76, 0x01, 0x6c, 0x03, 0xe3, 0x53, 0x12, 0xf5, 0x81, 0xa5, 0x15, 0xdc, 0x47, 0xb1, 0x26,
+    0x54, 0xcb, 0x93, 0xfc, 0x0c, 0x1f, 0xe5, 0x1f, 0x60, 0x81, 0x8f, 0xb8, 0x18, 0x5b, 0x59, 0xf7,
+    0xc0, 0xa5, 0xed, 0xae, 0x29, 0x74, 0xc0, 0x10, 0x26, 0x59, 0xb8, 0xe2, 0x0c, 0xbe, 0xd4, 0xaf,
+    0x79, 0xf1, 0xec, 0x29, 0xff, 0x6f, 0xa6, 0x67, 0x3d, 0x51, 0x4c, 0x01,
 };
+const ShaderModule Blob021 = { Blob021_Data, 1132u, 812u, 21u };
 
-extern const uint32_t Blob059[816];
-const uint32_t Blob059[816] = {
-    0x07230203, 0x00010300, 0x0008000b, 0x00000046, 0x00000000, 0x00020011, 0x00000001, 0x0006000b,
-    0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001,
-    0x0006000f, 0x00000005, 0x00000004, 0x6e69616d, 0x00000000, 0x00000015, 0x00060010, 0x00000004,
-    0x00000011, 0x00000040, 0x00000001, 0x00000001, 0x00030003, 0x00000002, 0x000001c2, 0x000a0004,
-    0x475f4c47, 0x4c474f4f, 0x70635f45, 0x74735f70, 0x5f656c79, 0x656e696c, 0x7269645f, 0x69746365,
-    0x00006576, 0x00080004, 0x475f4c47, 0x4c474f4f, 0x6e695f45, 0x64756c63, 0x69645f65, 0x74636572,
-    0x00657669, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000, 0x00060005, 0x0000000d, 0x526e6942,
-    0x6c757365, 0x66754274, 0x00726566, 0x00080006, 0x0000000d, 0x00000000, 0x69726156, 0x57746e61,
-    0x436b726f, 0x746e756f, 0x00000000, 0x00080006, 0x0000000d, 0x00000001, 0x74726f53, 0x6f576465,
-    0x664f6b72, 0x74657366, 0x00000000, 0x00090006, 0x0000000d, 0x00000002, 0x69726156, 0x57746e61,
-    0x526b726f, 0x436c6165, 0x746e756f, 0x00000000, 0x00080006, 0x0000000d, 0x00000003, 0x74726f53,
-    0x6b726f57, 0x6b726f57, 0x6e756f43, 0x00000074, 0x00090006, 0x0000000d, 0x00000004, 0x6e6e6942,
-    0x4d676e69, 0x416b7361, 0x664f646e, 0x74657366, 0x00000000, 0x00030005, 0x0000000f, 0x00000000,
-    0x00080005, 0x00000015, 0x475f6c67, 0x61626f6c, 0x766e496c, 0x7461636f, 0x496e6f69, 0x00000044,
-    0x00050005, 0x00000026, 0x65726353, 0x69576e65, 0x00687464, 0x00060005, 0x00000027, 0x65726353,
-    0x65486e65, 0x74686769, 0x00000000, 0x00060005, 0x00000028, 0x5778614d, 0x546b726f, 0x73656c69,
-    0x00000000, 0x00070005, 0x0000002c, 0x6d617246, 0x66756265, 0x53726566, 0x64697274, 0x00000065,
-    0x00060005, 0x0000002e, 0x656c6954, 0x72655073, 0x656e694c, 0x00000000, 0x00050005, 0x0000002f,
-    0x656c6954, 0x656e694c, 0x00000073, 0x00050005, 0x00000036, 0x6174654d, 0x66696e55, 0x006d726f,
-    0x00060006, 0x00000036, 0x00000000, 0x506d754e, 0x67796c6f, 0x00736e6f, 0x00060006, 0x00000036,
-    0x00000001, 0x566d754e, 0x61697261, 0x0073746e, 0x00060006, 0x00000036, 0x00000002, 0x68706c41,
-    0x66655261, 0x00000000, 0x00050006, 0x00000036, 0x00000003, 0x70736944, 0x00746e43, 0x00060006,
-    0x00000036, 0x00000004, 0x6e6f6f54, 0x6c626154, 0x00000065, 0x00060006, 0x00000036, 0x00000005,
-    0x61656c43, 0x6c6f4372, 0x0000726f, 0x00060006, 0x00000036, 0x00000006, 0x61656c43, 0x70654472,
-    0x00006874, 0x00060006, 0x00000036, 0x00000007, 0x61656c43, 0x74744172, 0x00000072, 0x00060006,
-    0x00000036, 0x00000008, 0x4f676f46, 0x65736666, 0x00000074, 0x00060006, 0x00000036, 0x00000009,
-    0x53676f46, 0x74666968, 0x00000000, 0x00060006, 0x00000036, 0x0000000a, 0x43676f46, 0x726f6c6f,
-    0x00000000, 0x00080006, 0x00000036, 0x0000000b, 0x61656c43, 0x74694272, 0x4f70616d, 0x65736666,
-    0x00000074, 0x00030005, 0x00000038, 0x00000000, 0x00060005, 0x00000039, 0x68737550, 0x736e6f43,
-    0x746e6174, 0x00000073, 0x00060006, 0x00000039, 0x00000000, 0x56727543, 0x61697261, 0x0000746e,
-    0x00060006, 0x00000039, 0x00000001, 0x57786554, 0x68746469, 0x00000000, 0x00060006, 0x00000039,
-    0x00000002, 0x48786554, 0x68676965, 0x00000074, 0x00060006, 0x00000039, 0x00000003, 0x57786554,
-    0x53706172, 0x00000000, 0x00060006, 0x00000039, 0x00000004, 0x57786554, 0x54706172, 0x00000000,
-    0x00070006, 0x00000039, 0x00000005, 0x49786554, 0x70614373, 0x65727574, 0x00000000, 0x00070006,
-    0x00000039, 0x00000006, 0x74706143, 0x59657275, 0x7366664f, 0x00007465, 0x00050006, 0x00000039,
-    0x00000007, 0x6461705f, 0x00000000, 0x00030005, 0x0000003b, 0x00006370, 0x00070005, 0x00000040,
-    0x6e6e6942, 0x4d676e69, 0x536b7361, 0x74726174, 0x00000000, 0x00080005, 0x00000043, 0x6e6e6942,
-    0x57676e69, 0x4f6b726f, 0x65736666, 0x74537374, 0x00747261, 0x00040047, 0x00000009, 0x00000006,
-    0x00000010, 0x00040047, 0x0000000a, 0x00000006, 0x00000004, 0x00040047, 0x0000000b, 0x00000006,
-    0x00000004, 0x00040047, 0x0000000c, 0x00000006, 0x00000004, 0x00050048, 0x0000000d, 0x00000000,
-    0x00000023, 0x00000000, 0x00050048, 0x0000000d, 0x00000001, 0x00000023, 0x00008000, 0x00050048,
-    0x0000000d, 0x00000002, 0x00000023, 0x0000a000, 0x00050048, 0x0000000d, 0x00000003, 0x00000023,
-    0x0000c000, 0x00050048, 0x0000000d, 0x00000004, 0x00000023, 0x0000c010, 0x00030047, 0x0000000d,
-    0x00000002, 0x00040047, 0x0000000f, 0x00000022, 0x00000000, 0x00040047, 0x0000000f, 0x00000021,
-    0x00000008, 0x00040047, 0x00000015, 0x0000000b, 0x0000001c, 0x00040047, 0x00000026, 0x00000001,
-    0x00000000, 0x00040047, 0x00000027, 0x00000001, 0x00000001, 0x00040047, 0x00000028, 0x00000001,
-    0x00000002, 0x00040047, 0x00000033, 0x00000006, 0x00000010, 0x00050048, 0x00000036, 0x00000000,
-    0x00000023, 0x00000000, 0x00050048, 0x00000036, 0x00000001, 0x00000023, 0x00000004, 0x00050048,
-    0x00000036, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x00000036, 0x00000003, 0x00000023,
-    0x0000000c, 0x00050048, 0x00000036, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x00000036,
-    0x00000005, 0x00000023, 0x00000230, 0x00050048, 0x00000036, 0x00000006, 0x00000023, 0x00000234,
-    0x00050048, 0x00000036, 0x00000007, 0x00000023, 0x00000238, 0x00050048, 0x00000036, 0x00000008,
-    0x00000023, 0x0000023c, 0x00050048, 0x00000036, 0x00000009, 0x00000023, 0x00000240, 0x00050048,
-    0x00000036, 0x0000000a, 0x00000023, 0x00000244, 0x00050048, 0x00000036, 0x0000000b, 0x00000023,
-    0x00000248, 0x00030047, 0x00000036, 0x00000002, 0x00040047, 0x00000038, 0x00000022, 0x00000000,
-    0x00040047, 0x00000038, 0x00000021, 0x00000000, 0x00050048, 0x00000039, 0x00000000, 0x00000023,
-    0x00000000, 0x00050048, 0x00000039, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x00000039,
-    0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x00000039, 0x00000003, 0x00000023, 0x0000000c,
-    0x00050048, 0x00000039, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x00000039, 0x00000005,
-    0x00000023, 0x00000014, 0x00050048, 0x00000039, 0x00000006, 0x00000023, 0x00000018, 0x00050048,
-    0x00000039, 0x00000007, 0x00000023, 0x0000001c, 0x00030047, 0x00000039, 0x00000002, 0x00040047,
-    0x00000045, 0x0000000b, 0x00000019, 0x00020013, 0x00000002, 0x00030021, 0x00000003, 0x00000002,
-    0x00040015, 0x00000006, 0x00000020, 0x00000000, 0x00040017, 0x00000007, 0x00000006, 0x00000004,
-    0x0004002b, 0x00000006, 0x00000008, 0x00000800, 0x0004001c, 0x00000009, 0x00000007, 0x00000008,
-    0x0004001c, 0x0000000a, 0x00000006, 0x00000008, 0x0004001c, 0x0000000b, 0x00000006, 0x00000008,
-    0x0003001d, 0x0000000c, 0x00000006, 0x0007001e, 0x0000000d, 0x00000009, 0x0000000a, 0x0000000b,
-    0x00000007, 0x0000000c, 0x00040020, 0x0000000e, 0x0000000c, 0x0000000d, 0x0004003b, 0x0000000e,
-    0x0000000f, 0x0000000c, 0x00040015, 0x00000010, 0x00000020, 0x00000001, 0x0004002b, 0x00000010,
-    0x00000011, 0x00000004, 0x0004002b, 0x00000006, 0x00000012, 0x00000000, 0x00040017, 0x00000013,
-    0x00000006, 0x00000003, 0x00040020, 0x00000014, 0x00000001, 0x00000013, 0x0004003b, 0x00000014,
-    0x00000015, 0x00000001, 0x00040020, 0x00000016, 0x00000001, 0x00000006, 0x0004002b, 0x00000006,
-    0x00000019, 0x00000002, 0x00040020, 0x0000001d, 0x0000000c, 0x00000006, 0x0004002b, 0x00000006,
-    0x00000023, 0x00000001, 0x00040032, 0x00000010, 0x00000026, 0x00000100, 0x00040032, 0x00000010,
-    0x00000027, 0x000000c0, 0x00040032, 0x00000010, 0x00000028, 0x00003000, 0x0004002b, 0x00000010,
-    0x00000029, 0x00000008, 0x0004002b, 0x00000010, 0x0000002a, 0x00000080, 0x0004002b, 0x00000010,
-    0x0000002b, 0x00000040, 0x00060034, 0x00000010, 0x0000002c, 0x00000084, 0x00000026, 0x00000027,
-    0x0004002b, 0x00000010, 0x0000002d, 0x00000010, 0x00060034, 0x00000010, 0x0000002e, 0x00000087,
-    0x00000026, 0x0000002d, 0x00060034, 0x00000010, 0x0000002f, 0x00000087, 0x00000027, 0x0000002d,
-    0x0004002b, 0x00000010, 0x00000030, 0x00000002, 0x0004002b, 0x00000010, 0x00000031, 0x00000800,
-    0x0004002b, 0x00000006, 0x00000032, 0x00000022, 0x0004001c, 0x00000033, 0x00000007, 0x00000032,
-    0x00030016, 0x00000034, 0x00000020, 0x00040017, 0x00000035, 0x00000034, 0x00000002, 0x000e001e,
-    0x00000036, 0x00000006, 0x00000006, 0x00000010, 0x00000006, 0x00000033, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000035, 0x00040020, 0x00000037, 0x00000002,
-    0x00000036, 0x0004003b, 0x00000037, 0x00000038, 0x00000002, 0x000a001e, 0x00000039, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000010, 0x00000006, 0x00040020,
-    0x0000003a, 0x00000009, 0x00000039, 0x0004003b, 0x0000003a, 0x0000003b, 0x00000009, 0x0004002b,
-    0x00000006, 0x0000003c, 0x00008000, 0x0004002b, 0x00000010, 0x0000003d, 0x00000000, 0x00060034,
-    0x00000010, 0x0000003e, 0x00000084, 0x0000002e, 0x0000002f, 0x00060034, 0x00000010, 0x0000003f,
-    0x00000084, 0x0000003e, 0x00000030, 0x00060034, 0x00000010, 0x00000040, 0x00000080, 0x0000003d,
-    0x0000003f, 0x00060034, 0x00000010, 0x00000041, 0x00000084, 0x0000002e, 0x0000002f, 0x00060034,
-    0x00000010, 0x00000042, 0x00000084, 0x00000041, 0x0000002b, 0x00060034, 0x00000010, 0x00000043,
-    0x00000080, 0x00000040, 0x00000042, 0x0004002b, 0x00000006, 0x00000044, 0x00000040, 0x0006002c,
-    0x00000013, 0x00000045, 0x00000044, 0x00000023, 0x00000023, 0x00050036, 0x00000002, 0x00000004,
-    0x00000000, 0x00000003, 0x000200f8, 0x00000005, 0x00050041, 0x00000016, 0x00000017, 0x00000015,
-    0x00000012, 0x0004003d, 0x00000006, 0x00000018, 0x00000017, 0x00050084, 0x00000006, 0x0000001a,
-    0x00000018, 0x00000019, 0x00050080, 0x00000006, 0x0000001b, 0x00000012, 0x0000001a, 0x00050080,
-    0x00000006, 0x0000001c, 0x0000001b, 0x00000012, 0x00060041, 0x0000001d, 0x0000001e, 0x0000000f,
-    0x00000011, 0x0000001c, 0x0003003e, 0x0000001e, 0x00000012, 0x00050041, 0x00000016, 0x0000001f,
-    0x00000015, 0x00000012, 0x0004003d, 0x00000006, 0x00000020, 0x0000001f, 0x00050084, 0x00000006,
-    0x00000021, 0x00000020, 0x00000019, 0x00050080, 0x00000006, 0x00000022, 0x00000012, 0x00000021,
-    0x00050080, 0x00000006, 0x00000024, 0x00000022, 0x00000023, 0x00060041, 0x0000001d, 0x00000025,
-    0x0000000f, 0x00000011, 0x00000024, 0x0003003e, 0x00000025, 0x00000012, 0x000100fd, 0x00010038,
+const uint8_t Blob059_Data[1141] =
+{
+    0x28, 0xb5, 0x2f, 0xfd, 0x60, 0xc0, 0x0b, 0x5d, 0x23, 0x00, 0x56, 0x7a, 0xa9, 0x3b, 0x10, 0x95,
+    0xb3, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0xa0, 0x22, 0x00,
+    0x00, 0x24, 0x05, 0xf3, 0x7b, 0xca, 0xb4, 0xb7, 0x9c, 0x74, 0xbc, 0xd4, 0xc8, 0x0e, 0x44, 0x89,
+    0xf6, 0xf0, 0x8a, 0xf2, 0x45, 0xd6, 0x6d, 0x02, 0x98, 0xbb, 0x2c, 0x30, 0xc1, 0x11, 0x66, 0x38,
+    0x43, 0x38, 0x7d, 0xd8, 0xdd, 0xdd, 0xdd, 0x3b, 0x05, 0x96, 0x00, 0x9f, 0x00, 0x9a, 0x00, 0xff,
+    0x04, 0x83, 0x8b, 0xb7, 0x34, 0x16, 0xc4, 0x9a, 0x35, 0x40, 0xe9, 0x99, 0x86, 0x20, 0x6a, 0xde,
+    0x9c, 0x0f, 0xe0, 0xb2, 0x38, 0xdc, 0xcd, 0xed, 0xb6, 0xab, 0x4a, 0xfb, 0x6f, 0xd3, 0x9d, 0x2a,
+    0x0b, 0x5a, 0xd5, 0x9e, 0x36, 0x35, 0xcf, 0xd5, 0xe4, 0xf9, 0x2f, 0x1f, 0x5f, 0x2f, 0x0e, 0xb7,
+    0x73, 0x69, 0xd1, 0x1d, 0x7b, 0x73, 0xd2, 0xd3, 0xe5, 0x17, 0x78, 0x5c, 0x0c, 0x17, 0x6f, 0x3b,
+    0xd4, 0x96, 0x9e, 0xe5, 0x77, 0xe8, 0x6c, 0x6d, 0x77, 0x3d, 0x6f, 0xb5, 0x9b, 0x9e, 0x68, 0xed,
+    0xa2, 0x45, 0x2d, 0x5b, 0xd3, 0xe9, 0x6c, 0x35, 0x18, 0x9a, 0xd9, 0xcd, 0xcd, 0xac, 0x76, 0x3a,
+    0x7c, 0x6f, 0xe9, 0xff, 0x06, 0x07, 0xdf, 0xfb, 0x5b, 0x3e, 0x7c, 0x3c, 0xf5, 0xab, 0xfe, 0xd3,
+    0xd3, 0x14, 0xfa, 0xc3, 0x5f, 0x7c, 0x9c, 0xe0, 0x1f, 0x7c, 0xe0, 0x1f, 0xa4, 0x84, 0xc4, 0xe3,
+    0xd6, 0xb2, 0x1e, 0x34, 0x34, 0x9a, 0xd9, 0x38, 0xea, 0xf7, 0xfe, 0x2e, 0x38, 0xe6, 0x72, 0xd4,
+    0x1e, 0x38, 0xc9, 0xfa, 0xc0, 0x0f, 0x7b, 0x7c, 0xad, 0x33, 0x85, 0xda, 0xd3, 0x05, 0x55, 0x7e,
+    0xba, 0xc5, 0x9d, 0x39, 0x1a, 0x00, 0x90, 0x1a, 0xf3, 0x97, 0xaf, 0x6d, 0x1b, 0x23, 0x73, 0xad,
+    0xee, 0xbe, 0x8c, 0xab, 0x8a, 0xaa, 0xb2, 0xd5, 0xbc, 0xa8, 0xec, 0x17, 0xff, 0x2f, 0xfa, 0x63,
+    0xea, 0xa4, 0xaa, 0xaa, 0x73, 0x9b, 0xca, 0x74, 0xec, 0xf9, 0xf2, 0x83, 0xe2, 0x8f, 0xbb, 0x39,
+    0x66, 0x4e, 0x87, 0xc6, 0xfe, 0xcf, 0x63, 0x53, 0x15, 0xa8, 0x08, 0x55, 0x71, 0x84, 0x76, 0x36,
+    0xff, 0xe3, 0xe3, 0x42, 0xab, 0x8a, 0x3b, 0xd3, 0x1d, 0xb3, 0xbd, 0x35, 0xbf, 0x8b, 0xfd, 0xf8,
+    0xa6, 0x27, 0xcd, 0x7a, 0x71, 0x7e, 0x8f, 0x7b, 0x3b, 0xd7, 0x96, 0xf6, 0x73, 0x85, 0xcc, 0x35,
+    0xe6, 0xe7, 0x98, 0x64, 0x2f, 0x7a, 0xea, 0x10, 0x99, 0x35, 0x3f, 0xc6, 0x6d, 0x0e, 0xe8, 0xbc,
+    0x32, 0xad, 0xc7, 0xc5, 0x73, 0xed, 0xed, 0xec, 0x49, 0xef, 0x5d, 0x6d, 0xb4, 0xff, 0x62, 0x71,
+    0xf1, 0x7f, 0x99, 0x49, 0xd5, 0xb3, 0x35, 0x6d, 0xea, 0x50, 0x3a, 0x83, 0x9a, 0x3f, 0x2a, 0x3a,
+    0xab, 0xa1, 0x40, 0x65, 0x29, 0x15, 0x01, 0xca, 0x2f, 0x30, 0x70, 0xb8, 0x04, 0x79, 0x12, 0x98,
+    0x1c, 0xe2, 0xc1, 0x1f, 0x56, 0xe4, 0xea, 0xcb, 0x0d, 0xf2, 0x70, 0x05, 0x89, 0x7f, 0x54, 0x81,
+    0x83, 0xdf, 0xdf, 0x07, 0x3f, 0x03, 0x0c, 0x6c, 0xf0, 0x85, 0x47, 0x80, 0xc1, 0x60, 0x30, 0x18,
+    0xec, 0xd7, 0xcb, 0xf5, 0x27, 0x83, 0x7a, 0x39, 0xb5, 0x00, 0xa4, 0x94, 0x2f, 0x92, 0x64, 0xfc,
+    0x40, 0xc4, 0x80, 0x2f, 0x3f, 0x74, 0xb9, 0x46, 0x3e, 0x0c, 0xaf, 0xf5, 0xc5, 0x4a, 0x55, 0xfe,
+    0x13, 0xff, 0x14, 0x3f, 0xc1, 0x07, 0x3e, 0x4b, 0x85, 0x4a, 0x60, 0xd2, 0x67, 0xe4, 0xfd, 0xb3,
+    0xc4, 0x65, 0x02, 0x50, 0xe1, 0xe9, 0x53, 0x00, 0x87, 0xcf, 0x58, 0xd9, 0xed, 0x6a, 0xb6, 0xb4,
+    0x16, 0x9b, 0xee, 0x47, 0xf9, 0x66, 0xea, 0x6a, 0x3f, 0x29, 0xfa, 0xfc, 0xe3, 0x77, 0xdd, 0xb5,
+    0x3a, 0x53, 0xc6, 0xce, 0x88, 0xa4, 0x4e, 0x38, 0x4d, 0x67, 0xae, 0xe0, 0x37, 0xd1, 0xd5, 0xf9,
+    0xbd, 0x75, 0x27, 0xfb, 0x1f, 0xbf, 0x65, 0x53, 0x55, 0x96, 0x63, 0x77, 0x38, 0x07, 0x7b, 0xbf,
+    0xf6, 0x6e, 0xb2, 0xa8, 0xb0, 0x60, 0x55, 0x4c, 0x50, 0x3c, 0x21, 0x11, 0x61, 0x00, 0xbe, 0x52,
+    0x00, 0xf1, 0x3f, 0x3c, 0x1e, 0x5b, 0x35, 0x38, 0x18, 0xfd, 0x0c, 0x0d, 0xe2, 0x47, 0x0b, 0x2a,
+    0x2a, 0x05, 0x51, 0xfc, 0x9b, 0xe9, 0x6f, 0x71, 0x17, 0x0b, 0xe6, 0x3f, 0x78, 0x9c, 0xe3, 0xc5,
+    0xe5, 0x6f, 0x91, 0x6d, 0xfc, 0x31, 0x97, 0x18, 0x8b, 0xd1, 0xdf, 0x02, 0xf2, 0xaf, 0xb0, 0x7c,
+    0xfc, 0x1e, 0x2b, 0xff, 0x2a, 0x46, 0xff, 0x29, 0x7f, 0x02, 0x3b, 0x19, 0xf6, 0xe9, 0x85, 0xf2,
+    0xbb, 0x4c, 0x4a, 0x46, 0x52, 0x0f, 0x7c, 0x5f, 0x22, 0xf1, 0x93, 0x0c, 0x9e, 0x40, 0xae, 0x44,
+    0xca, 0xff, 0x10, 0x90, 0xd6, 0x47, 0x07, 0xd2, 0xef, 0x91, 0xfa, 0x3b, 0x5a, 0x47, 0x3f, 0xc7,
+    0x38, 0xc9, 0x86, 0xd1, 0xaf, 0x71, 0xf9, 0x67, 0x80, 0xfc, 0x63, 0xac, 0xf4, 0xb7, 0xbc, 0xff,
+    0x0b, 0x11, 0xd6, 0x0f, 0xdf, 0x38, 0x26, 0x78, 0x08, 0x07, 0x08, 0xe0, 0x81, 0x41, 0xc1, 0xc6,
+    0xef, 0x05, 0x81, 0x1f, 0xa8, 0x71, 0x78, 0x83, 0xc8, 0x21, 0x91, 0x09, 0x52, 0x90, 0x82, 0x82,
+    0xa4, 0x31, 0x81, 0x25, 0x21, 0x50, 0x95, 0x59, 0x1d, 0x31, 0x08, 0x08, 0xc1, 0x86, 0xa0, 0x94,
+    0xa4, 0xa0, 0x30, 0xcb, 0x01, 0x6a, 0x30, 0xfb, 0xbf, 0x34, 0xcc, 0xaf, 0x59, 0xd6, 0xbb, 0xf1,
+    0x10, 0x95, 0x8b, 0x06, 0xe2, 0x7e, 0x7f, 0xd9, 0x81, 0xec, 0x15, 0xdc, 0x5d, 0xdf, 0xcc, 0xed,
+    0x6e, 0xdf, 0x4c, 0xde, 0xc3, 0x3a, 0x97, 0x4e, 0x65, 0xe0, 0xf7, 0x1b, 0xff, 0x4e, 0xec, 0x8f,
+    0x86, 0x19, 0x76, 0xc0, 0xf1, 0x12, 0x62, 0x51, 0x54, 0x3a, 0x56, 0x78, 0x37, 0xd9, 0x8d, 0xec,
+    0xf8, 0x87, 0xbe, 0x38, 0x5c, 0xd8, 0x43, 0xf9, 0x73, 0x12, 0x2c, 0xe5, 0xda, 0x8f, 0x7b, 0xf5,
+    0x46, 0x35, 0xe6, 0xa1, 0x7b, 0xbb, 0x20, 0xc7, 0x1e, 0x68, 0xaf, 0xa6, 0x3f, 0xcf, 0x1f, 0x39,
+    0x46, 0xdc, 0x3d, 0xce, 0xee, 0x05, 0xed, 0x45, 0x1b, 0x91, 0xab, 0x19, 0x6b, 0xbe, 0x62, 0x52,
+    0xae, 0xc3, 0xfb, 0x60, 0x4d, 0xbf, 0xf6, 0xce, 0x63, 0x20, 0xeb, 0xb7, 0x7b, 0x2c, 0x43, 0x85,
+    0x7e, 0xcf, 0x35, 0x31, 0xf2, 0x45, 0xfc, 0x8f, 0x25, 0xb9, 0xf3, 0x54, 0xf8, 0x70, 0xfa, 0x86,
+    0x8a, 0xf6, 0x5d, 0xe3, 0xd9, 0x97, 0x31, 0xd3, 0x88, 0x56, 0x54, 0x11, 0x6e, 0x68, 0x9a, 0x73,
+    0xd0, 0xc2, 0xb4, 0x01, 0xfb, 0x54, 0x77, 0x44, 0x06, 0x7a, 0xd8, 0xc2, 0x35, 0xf6, 0x27, 0xa5,
+    0x00, 0x78, 0x60, 0xfb, 0xdd, 0x35, 0x0e, 0x7b, 0xc1, 0x26, 0xbe, 0xb9, 0xf0, 0x69, 0xff, 0x6f,
+    0xb6, 0xeb, 0xe9, 0x9f, 0x91, 0x9b, 0x90, 0x4c, 0x32, 0xf9, 0x50, 0x02, 0x90, 0xa9, 0x2b, 0x7b,
+    0x03, 0x53, 0xa3, 0x95, 0xea, 0x32, 0x5a, 0xa9, 0xe8, 0x8b, 0x67, 0x4b, 0x18, 0x08, 0x30, 0x89,
+    0x7b, 0x36, 0x1a, 0x07, 0x3f, 0x61, 0x9a, 0x30, 0x97, 0xe6, 0xa6, 0x0f, 0x8b, 0x37, 0x22, 0xb1,
+    0x92, 0x21, 0x06, 0x04, 0x09, 0x20, 0x49, 0x74, 0x36, 0xb9, 0xb7, 0xcc, 0x31, 0x11, 0x59, 0x40,
+    0x7d, 0x56, 0xaa, 0x74, 0xb8, 0xec, 0xdf, 0x8c, 0x1b, 0x88, 0x99, 0xec, 0x63, 0xdc, 0xf3, 0xd7,
+    0xc1, 0x47, 0x78, 0xe7, 0xed, 0xb5, 0x46, 0x98, 0x00, 0x96, 0xa1, 0xae, 0xfa, 0x03, 0xdb, 0x16,
+    0x24, 0x07, 0x9a, 0xe2, 0x39, 0x10, 0xf8, 0x98, 0xa8, 0x7f, 0x04, 0xc4, 0x1e, 0x60, 0x66, 0xcd,
+    0xc6, 0x9b, 0x8c, 0x58, 0x97, 0xf9, 0xc1, 0x27, 0x4a, 0x8f, 0x65, 0x0e, 0x00, 0x79, 0x8e, 0x99,
+    0x3e, 0x17, 0x2c, 0xd2, 0xc1, 0x34, 0x88, 0x9e, 0x39, 0xe4, 0xb4, 0xa1, 0x27, 0x49, 0xbc, 0x29,
+    0xd6, 0x62, 0x60, 0xa5, 0x86, 0x44, 0x14, 0x68, 0x1a, 0x25, 0xe1, 0x8d, 0x6d, 0xb8, 0xfd, 0x17,
+    0x41, 0x8f, 0xaf, 0x0b, 0xbd, 0x34, 0xf6, 0xce, 0x7d, 0x2c, 0x2c, 0x36, 0x4e, 0xef, 0x71, 0xa6,
+    0x53, 0x27, 0xf7, 0xa1, 0xe7, 0x5a, 0xd9, 0x28, 0x14, 0x35, 0xa3, 0xff, 0x80, 0x80, 0x69, 0xee,
+    0x28, 0x9f, 0x21, 0x54, 0x8e, 0xc9, 0x10, 0xb6, 0x15, 0xcf, 0x8e, 0xa4, 0xf4, 0x5d, 0x40, 0x03,
+    0xee, 0x2f, 0x49, 0xc1, 0x55, 0x61, 0x70, 0x4b, 0xfd, 0x6e, 0x72, 0xcf, 0x9e, 0xf6, 0xff, 0x6e,
+    0xfa, 0x26, 0x11, 0x05, 0x1a,
 };
+const ShaderModule Blob059 = { Blob059_Data, 1141u, 816u, 59u };
 
-extern const uint32_t Blob097[820];
-const uint32_t Blob097[820] = {
-    0x07230203, 0x00010300, 0x0008000b, 0x00000047, 0x00000000, 0x00020011, 0x00000001, 0x0006000b,
-    0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001,
-    0x0006000f, 0x00000005, 0x00000004, 0x6e69616d, 0x00000000, 0x00000015, 0x00060010, 0x00000004,
-    0x00000011, 0x00000030, 0x00000001, 0x00000001, 0x00030003, 0x00000002, 0x000001c2, 0x000a0004,
-    0x475f4c47, 0x4c474f4f, 0x70635f45, 0x74735f70, 0x5f656c79, 0x656e696c, 0x7269645f, 0x69746365,
-    0x00006576, 0x00080004, 0x475f4c47, 0x4c474f4f, 0x6e695f45, 0x64756c63, 0x69645f65, 0x74636572,
-    0x00657669, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000, 0x00060005, 0x0000000d, 0x526e6942,
-    0x6c757365, 0x66754274, 0x00726566, 0x00080006, 0x0000000d, 0x00000000, 0x69726156, 0x57746e61,
-    0x436b726f, 0x746e756f, 0x00000000, 0x00080006, 0x0000000d, 0x00000001, 0x74726f53, 0x6f576465,
-    0x664f6b72, 0x74657366, 0x00000000, 0x00090006, 0x0000000d, 0x00000002, 0x69726156, 0x57746e61,
-    0x526b726f, 0x436c6165, 0x746e756f, 0x00000000, 0x00080006, 0x0000000d, 0x00000003, 0x74726f53,
-    0x6b726f57, 0x6b726f57, 0x6e756f43, 0x00000074, 0x00090006, 0x0000000d, 0x00000004, 0x6e6e6942,
-    0x4d676e69, 0x416b7361, 0x664f646e, 0x74657366, 0x00000000, 0x00030005, 0x0000000f, 0x00000000,
-    0x00080005, 0x00000015, 0x475f6c67, 0x61626f6c, 0x766e496c, 0x7461636f, 0x496e6f69, 0x00000044,
-    0x00050005, 0x00000026, 0x65726353, 0x69576e65, 0x00687464, 0x00060005, 0x00000027, 0x65726353,
-    0x65486e65, 0x74686769, 0x00000000, 0x00060005, 0x00000028, 0x5778614d, 0x546b726f, 0x73656c69,
-    0x00000000, 0x00070005, 0x0000002c, 0x6d617246, 0x66756265, 0x53726566, 0x64697274, 0x00000065,
-    0x00060005, 0x0000002e, 0x656c6954, 0x72655073, 0x656e694c, 0x00000000, 0x00050005, 0x0000002f,
-    0x656c6954, 0x656e694c, 0x00000073, 0x00050005, 0x00000037, 0x6174654d, 0x66696e55, 0x006d726f,
-    0x00060006, 0x00000037, 0x00000000, 0x506d754e, 0x67796c6f, 0x00736e6f, 0x00060006, 0x00000037,
-    0x00000001, 0x566d754e, 0x61697261, 0x0073746e, 0x00060006, 0x00000037, 0x00000002, 0x68706c41,
-    0x66655261, 0x00000000, 0x00050006, 0x00000037, 0x00000003, 0x70736944, 0x00746e43, 0x00060006,
-    0x00000037, 0x00000004, 0x6e6f6f54, 0x6c626154, 0x00000065, 0x00060006, 0x00000037, 0x00000005,
-    0x61656c43, 0x6c6f4372, 0x0000726f, 0x00060006, 0x00000037, 0x00000006, 0x61656c43, 0x70654472,
-    0x00006874, 0x00060006, 0x00000037, 0x00000007, 0x61656c43, 0x74744172, 0x00000072, 0x00060006,
-    0x00000037, 0x00000008, 0x4f676f46, 0x65736666, 0x00000074, 0x00060006, 0x00000037, 0x00000009,
-    0x53676f46, 0x74666968, 0x00000000, 0x00060006, 0x00000037, 0x0000000a, 0x43676f46, 0x726f6c6f,
-    0x00000000, 0x00080006, 0x00000037, 0x0000000b, 0x61656c43, 0x74694272, 0x4f70616d, 0x65736666,
-    0x00000074, 0x00030005, 0x00000039, 0x00000000, 0x00060005, 0x0000003a, 0x68737550, 0x736e6f43,
-    0x746e6174, 0x00000073, 0x00060006, 0x0000003a, 0x00000000, 0x56727543, 0x61697261, 0x0000746e,
-    0x00060006, 0x0000003a, 0x00000001, 0x57786554, 0x68746469, 0x00000000, 0x00060006, 0x0000003a,
-    0x00000002, 0x48786554, 0x68676965, 0x00000074, 0x00060006, 0x0000003a, 0x00000003, 0x57786554,
-    0x53706172, 0x00000000, 0x00060006, 0x0000003a, 0x00000004, 0x57786554, 0x54706172, 0x00000000,
-    0x00070006, 0x0000003a, 0x00000005, 0x49786554, 0x70614373, 0x65727574, 0x00000000, 0x00070006,
-    0x0000003a, 0x00000006, 0x74706143, 0x59657275, 0x7366664f, 0x00007465, 0x00050006, 0x0000003a,
-    0x00000007, 0x6461705f, 0x00000000, 0x00030005, 0x0000003c, 0x00006370, 0x00070005, 0x00000041,
-    0x6e6e6942, 0x4d676e69, 0x536b7361, 0x74726174, 0x00000000, 0x00080005, 0x00000044, 0x6e6e6942,
-    0x57676e69, 0x4f6b726f, 0x65736666, 0x74537374, 0x00747261, 0x00040047, 0x00000009, 0x00000006,
-    0x00000010, 0x00040047, 0x0000000a, 0x00000006, 0x00000004, 0x00040047, 0x0000000b, 0x00000006,
-    0x00000004, 0x00040047, 0x0000000c, 0x00000006, 0x00000004, 0x00050048, 0x0000000d, 0x00000000,
-    0x00000023, 0x00000000, 0x00050048, 0x0000000d, 0x00000001, 0x00000023, 0x00008000, 0x00050048,
-    0x0000000d, 0x00000002, 0x00000023, 0x0000a000, 0x00050048, 0x0000000d, 0x00000003, 0x00000023,
-    0x0000c000, 0x00050048, 0x0000000d, 0x00000004, 0x00000023, 0x0000c010, 0x00030047, 0x0000000d,
-    0x00000002, 0x00040047, 0x0000000f, 0x00000022, 0x00000000, 0x00040047, 0x0000000f, 0x00000021,
-    0x00000008, 0x00040047, 0x00000015, 0x0000000b, 0x0000001c, 0x00040047, 0x00000026, 0x00000001,
-    0x00000000, 0x00040047, 0x00000027, 0x00000001, 0x00000001, 0x00040047, 0x00000028, 0x00000001,
-    0x00000002, 0x00040047, 0x00000034, 0x00000006, 0x00000010, 0x00050048, 0x00000037, 0x00000000,
-    0x00000023, 0x00000000, 0x00050048, 0x00000037, 0x00000001, 0x00000023, 0x00000004, 0x00050048,
-    0x00000037, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x00000037, 0x00000003, 0x00000023,
-    0x0000000c, 0x00050048, 0x00000037, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x00000037,
-    0x00000005, 0x00000023, 0x00000230, 0x00050048, 0x00000037, 0x00000006, 0x00000023, 0x00000234,
-    0x00050048, 0x00000037, 0x00000007, 0x00000023, 0x00000238, 0x00050048, 0x00000037, 0x00000008,
-    0x00000023, 0x0000023c, 0x00050048, 0x00000037, 0x00000009, 0x00000023, 0x00000240, 0x00050048,
-    0x00000037, 0x0000000a, 0x00000023, 0x00000244, 0x00050048, 0x00000037, 0x0000000b, 0x00000023,
-    0x00000248, 0x00030047, 0x00000037, 0x00000002, 0x00040047, 0x00000039, 0x00000022, 0x00000000,
-    0x00040047, 0x00000039, 0x00000021, 0x00000000, 0x00050048, 0x0000003a, 0x00000000, 0x00000023,
-    0x00000000, 0x00050048, 0x0000003a, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x0000003a,
-    0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x0000003a, 0x00000003, 0x00000023, 0x0000000c,
-    0x00050048, 0x0000003a, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x0000003a, 0x00000005,
-    0x00000023, 0x00000014, 0x00050048, 0x0000003a, 0x00000006, 0x00000023, 0x00000018, 0x00050048,
-    0x0000003a, 0x00000007, 0x00000023, 0x0000001c, 0x00030047, 0x0000003a, 0x00000002, 0x00040047,
-    0x00000046, 0x0000000b, 0x00000019, 0x00020013, 0x00000002, 0x00030021, 0x00000003, 0x00000002,
-    0x00040015, 0x00000006, 0x00000020, 0x00000000, 0x00040017, 0x00000007, 0x00000006, 0x00000004,
-    0x0004002b, 0x00000006, 0x00000008, 0x00000800, 0x0004001c, 0x00000009, 0x00000007, 0x00000008,
-    0x0004001c, 0x0000000a, 0x00000006, 0x00000008, 0x0004001c, 0x0000000b, 0x00000006, 0x00000008,
-    0x0003001d, 0x0000000c, 0x00000006, 0x0007001e, 0x0000000d, 0x00000009, 0x0000000a, 0x0000000b,
-    0x00000007, 0x0000000c, 0x00040020, 0x0000000e, 0x0000000c, 0x0000000d, 0x0004003b, 0x0000000e,
-    0x0000000f, 0x0000000c, 0x00040015, 0x00000010, 0x00000020, 0x00000001, 0x0004002b, 0x00000010,
-    0x00000011, 0x00000004, 0x0004002b, 0x00000006, 0x00000012, 0x00000000, 0x00040017, 0x00000013,
-    0x00000006, 0x00000003, 0x00040020, 0x00000014, 0x00000001, 0x00000013, 0x0004003b, 0x00000014,
-    0x00000015, 0x00000001, 0x00040020, 0x00000016, 0x00000001, 0x00000006, 0x0004002b, 0x00000006,
-    0x00000019, 0x00000002, 0x00040020, 0x0000001d, 0x0000000c, 0x00000006, 0x0004002b, 0x00000006,
-    0x00000023, 0x00000001, 0x00040032, 0x00000010, 0x00000026, 0x00000100, 0x00040032, 0x00000010,
-    0x00000027, 0x000000c0, 0x00040032, 0x00000010, 0x00000028, 0x00003000, 0x0004002b, 0x00000010,
-    0x00000029, 0x00000008, 0x0004002b, 0x00000010, 0x0000002a, 0x00000100, 0x0004002b, 0x00000010,
-    0x0000002b, 0x000000c0, 0x00060034, 0x00000010, 0x0000002c, 0x00000084, 0x00000026, 0x00000027,
-    0x0004002b, 0x00000010, 0x0000002d, 0x00000020, 0x00060034, 0x00000010, 0x0000002e, 0x00000087,
-    0x00000026, 0x0000002d, 0x00060034, 0x00000010, 0x0000002f, 0x00000087, 0x00000027, 0x0000002d,
-    0x0004002b, 0x00000010, 0x00000030, 0x00000040, 0x0004002b, 0x00000010, 0x00000031, 0x00000002,
-    0x0004002b, 0x00000010, 0x00000032, 0x00000800, 0x0004002b, 0x00000006, 0x00000033, 0x00000022,
-    0x0004001c, 0x00000034, 0x00000007, 0x00000033, 0x00030016, 0x00000035, 0x00000020, 0x00040017,
-    0x00000036, 0x00000035, 0x00000002, 0x000e001e, 0x00000037, 0x00000006, 0x00000006, 0x00000010,
-    0x00000006, 0x00000034, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000036, 0x00040020, 0x00000038, 0x00000002, 0x00000037, 0x0004003b, 0x00000038, 0x00000039,
-    0x00000002, 0x000a001e, 0x0000003a, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000010, 0x00000006, 0x00040020, 0x0000003b, 0x00000009, 0x0000003a, 0x0004003b,
-    0x0000003b, 0x0000003c, 0x00000009, 0x0004002b, 0x00000006, 0x0000003d, 0x00008000, 0x0004002b,
-    0x00000010, 0x0000003e, 0x00000000, 0x00060034, 0x00000010, 0x0000003f, 0x00000084, 0x0000002e,
-    0x0000002f, 0x00060034, 0x00000010, 0x00000040, 0x00000084, 0x0000003f, 0x00000031, 0x00060034,
-    0x00000010, 0x00000041, 0x00000080, 0x0000003e, 0x00000040, 0x00060034, 0x00000010, 0x00000042,
-    0x00000084, 0x0000002e, 0x0000002f, 0x00060034, 0x00000010, 0x00000043, 0x00000084, 0x00000042,
-    0x00000030, 0x00060034, 0x00000010, 0x00000044, 0x00000080, 0x00000041, 0x00000043, 0x0004002b,
-    0x00000006, 0x00000045, 0x00000030, 0x0006002c, 0x00000013, 0x00000046, 0x00000045, 0x00000023,
-    0x00000023, 0x00050036, 0x00000002, 0x00000004, 0x00000000, 0x00000003, 0x000200f8, 0x00000005,
-    0x00050041, 0x00000016, 0x00000017, 0x00000015, 0x00000012, 0x0004003d, 0x00000006, 0x00000018,
-    0x00000017, 0x00050084, 0x00000006, 0x0000001a, 0x00000018, 0x00000019, 0x00050080, 0x00000006,
-    0x0000001b, 0x00000012, 0x0000001a, 0x00050080, 0x00000006, 0x0000001c, 0x0000001b, 0x00000012,
-    0x00060041, 0x0000001d, 0x0000001e, 0x0000000f, 0x00000011, 0x0000001c, 0x0003003e, 0x0000001e,
-    0x00000012, 0x00050041, 0x00000016, 0x0000001f, 0x00000015, 0x00000012, 0x0004003d, 0x00000006,
-    0x00000020, 0x0000001f, 0x00050084, 0x00000006, 0x00000021, 0x00000020, 0x00000019, 0x00050080,
-    0x00000006, 0x00000022, 0x00000012, 0x00000021, 0x00050080, 0x00000006, 0x00000024, 0x00000022,
-    0x00000023, 0x00060041, 0x0000001d, 0x00000025, 0x0000000f, 0x00000011, 0x00000024, 0x0003003e,
-    0x00000025, 0x00000012, 0x000100fd, 0x00010038,
+const uint8_t Blob097_Data[1150] =
+{
+    0x28, 0xb5, 0x2f, 0xfd, 0x60, 0xd0, 0x0b, 0xa5, 0x23, 0x00, 0xc6, 0xba, 0xaa, 0x3b, 0x10, 0x95,
+    0xb3, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0xa0, 0x22, 0x00,
+    0x00, 0x24, 0x05, 0xf3, 0x7b, 0xca, 0xb4, 0xb7, 0x9c, 0x74, 0xbc, 0xd4, 0xc8, 0x0e, 0x44, 0x89,
+    0xf6, 0xf0, 0xa8, 0xca, 0x17, 0x27, 0xf8, 0xb5, 0x00, 0xe0, 0x1b, 0xac, 0x68, 0xdc, 0x02, 0x08,
+    0x7e, 0xbd, 0xda, 0x4f, 0x4b, 0x4b, 0x4b, 0x76, 0x0a, 0x97, 0x00, 0xa0, 0x00, 0x9b, 0x00, 0xe5,
+    0xff, 0xc0, 0xe0, 0xe2, 0x2d, 0x85, 0x05, 0xb1, 0x66, 0x0d, 0x50, 0x7a, 0xa6, 0x21, 0x88, 0x9a,
+    0x37, 0xe7, 0x3b, 0x5d, 0x16, 0x87, 0xbb, 0xb9, 0xdd, 0x76, 0x55, 0x69, 0xff, 0x6d, 0xba, 0x53,
+    0x63, 0x41, 0xab, 0xda, 0xd3, 0xa6, 0xe6, 0xb9, 0x9a, 0x3c, 0xff, 0xe5, 0xe3, 0xeb, 0xc5, 0xe1,
+    0x76, 0x2f, 0x2d, 0xba, 0x63, 0x6f, 0x4e, 0x7a, 0xbe, 0xfc, 0x01, 0x8f, 0x8b, 0xe1, 0xe2, 0x6d,
+    0x87, 0xda, 0xd2, 0xb3, 0xfc, 0x0e, 0x9d, 0xad, 0xed, 0xae, 0xe7, 0xad, 0x76, 0xd3, 0x13, 0xad,
+    0x5d, 0xb4, 0xa8, 0x65, 0x6b, 0x3a, 0x9d, 0xad, 0x06, 0x43, 0x33, 0xbb, 0xb9, 0x99, 0xd5, 0x50,
+    0x87, 0xef, 0x2d, 0xfd, 0xdf, 0xe0, 0xe0, 0x7b, 0xff, 0xc7, 0x87, 0x8f, 0x13, 0xfc, 0xaa, 0xff,
+    0xf4, 0x34, 0x85, 0xfe, 0xf0, 0x17, 0x1f, 0x1f, 0xf8, 0x07, 0x17, 0xf8, 0xff, 0x20, 0x19, 0xe9,
+    0xb8, 0xb5, 0x6c, 0x07, 0x0d, 0x8d, 0x66, 0x36, 0x9e, 0xfa, 0xbd, 0xbf, 0x0b, 0x9e, 0x5d, 0x9e,
+    0xda, 0x03, 0x27, 0x5b, 0x1f, 0x18, 0x38, 0xff, 0xeb, 0x11, 0x65, 0x9d, 0x29, 0xd4, 0x9e, 0x2f,
+    0xa9, 0x72, 0xd4, 0x2d, 0xee, 0xcc, 0xd1, 0x4e, 0x40, 0x6a, 0xcc, 0x5f, 0xbe, 0xb6, 0x2d, 0x8c,
+    0xcc, 0xb5, 0xba, 0x2b, 0x1b, 0x57, 0x15, 0x55, 0x63, 0xab, 0x79, 0xd1, 0xd8, 0x2f, 0xfe, 0x5f,
+    0xf4, 0xc7, 0xd4, 0x49, 0x55, 0x55, 0xe7, 0x36, 0x8d, 0xe9, 0xd8, 0x53, 0xf6, 0x83, 0xe2, 0x8f,
+    0xbb, 0x39, 0x66, 0x4e, 0x87, 0xc2, 0xfe, 0xcf, 0x63, 0x53, 0x15, 0xa8, 0x08, 0x55, 0x71, 0x84,
+    0x76, 0x36, 0xff, 0xe3, 0xe3, 0x42, 0xab, 0x8a, 0x3b, 0xd3, 0x1d, 0xb3, 0xbd, 0x35, 0xbf, 0x09,
+    0xeb, 0xf1, 0x4d, 0x4f, 0x9a, 0xf5, 0xe2, 0xfc, 0x1d, 0xf7, 0x76, 0xae, 0x2d, 0xed, 0xe7, 0x0a,
+    0x99, 0x6b, 0xcc, 0xbf, 0x31, 0xc9, 0x5e, 0xf4, 0xd4, 0x21, 0x32, 0x6b, 0xfe, 0x8b, 0xdb, 0x1c,
+    0xd0, 0x79, 0x65, 0x5c, 0x8f, 0x8b, 0xe7, 0xda, 0xdb, 0xd9, 0x93, 0xde, 0xbb, 0xda, 0x68, 0xbf,
+    0xc5, 0xe2, 0xe2, 0x2f, 0x9b, 0x49, 0xd5, 0xb3, 0x35, 0x6d, 0xea, 0x50, 0x3a, 0x83, 0x9a, 0x3f,
+    0x2a, 0x3a, 0xab, 0xa1, 0x40, 0x01, 0x7b, 0x04, 0xaa, 0x81, 0x94, 0x3f, 0x40, 0xe0, 0x70, 0x16,
+    0x89, 0x0a, 0x98, 0x1c, 0xe2, 0xc1, 0x1f, 0x56, 0xe4, 0xea, 0x52, 0x83, 0x3c, 0x5c, 0x81, 0xf5,
+    0x8f, 0x2a, 0x70, 0xf0, 0xfb, 0xfb, 0xe0, 0x67, 0x88, 0x79, 0x0d, 0xbe, 0xf0, 0x08, 0xaf, 0xd7,
+    0xeb, 0xf5, 0x7a, 0x8d, 0x82, 0x62, 0x32, 0xf8, 0x4c, 0x26, 0x25, 0x43, 0xb9, 0x9c, 0x54, 0xca,
+    0x13, 0x72, 0x64, 0xfc, 0x3e, 0x44, 0x80, 0x2f, 0x3f, 0x34, 0x31, 0x19, 0xf9, 0x2e, 0x3c, 0xd7,
+    0x16, 0x2b, 0x55, 0xf9, 0x4b, 0xfc, 0x4f, 0xfc, 0x03, 0x1f, 0xf8, 0x8c, 0x20, 0x54, 0x02, 0x93,
+    0x3e, 0x23, 0xef, 0xbf, 0x25, 0x2e, 0x03, 0x90, 0x0a, 0x51, 0x4f, 0x70, 0x3a, 0x7c, 0xc6, 0xca,
+    0x6e, 0x57, 0xb3, 0xa5, 0xc1, 0x6c, 0xba, 0x5f, 0xe5, 0x9b, 0xa9, 0xab, 0xfd, 0xa4, 0xe8, 0xf3,
+    0x8f, 0xdf, 0x75, 0xd7, 0xea, 0xcc, 0x18, 0x3b, 0x23, 0x92, 0x3a, 0xe1, 0x34, 0x9d, 0xb9, 0x82,
+    0xdf, 0x44, 0x57, 0xe7, 0xf7, 0xd6, 0x5d, 0xec, 0x7f, 0xfc, 0x96, 0x4d, 0xd5, 0x58, 0x8e, 0xdd,
+    0x05, 0x7b, 0x9f, 0xec, 0xdd, 0x54, 0x41, 0x51, 0xd1, 0xa2, 0x90, 0x98, 0x58, 0x82, 0x15, 0x61,
+    0x00, 0xce, 0x52, 0x00, 0xf1, 0x3f, 0x3c, 0x0e, 0x5b, 0x35, 0x38, 0x18, 0x31, 0x34, 0x88, 0x1f,
+    0x2d, 0xac, 0xa8, 0x14, 0x44, 0xf1, 0x6f, 0xa6, 0xbf, 0xc5, 0x4b, 0x5a, 0x31, 0xff, 0xc1, 0x06,
+    0x4c, 0xec, 0x87, 0xc9, 0x3e, 0xfe, 0x97, 0xd8, 0x8b, 0x8b, 0xd1, 0x0f, 0x6b, 0x71, 0xf1, 0xf8,
+    0x3b, 0x5a, 0xfe, 0x59, 0x34, 0x56, 0x4e, 0xbf, 0xca, 0xaf, 0x94, 0x5f, 0xa3, 0x50, 0x52, 0x7e,
+    0x93, 0x93, 0x92, 0xf1, 0x1f, 0x79, 0x81, 0x21, 0x48, 0xfe, 0x12, 0xd6, 0x4f, 0x32, 0x78, 0x02,
+    0xb9, 0x12, 0x29, 0xff, 0x43, 0xbe, 0x1f, 0xc4, 0xe5, 0x5d, 0x1e, 0x1c, 0x48, 0x7f, 0x07, 0xeb,
+    0xe7, 0x70, 0x1d, 0xfd, 0x1b, 0xe3, 0x23, 0x1a, 0xde, 0x7f, 0xc6, 0xe5, 0x8f, 0xf1, 0xf1, 0x7f,
+    0xb1, 0xd2, 0xef, 0xf2, 0xfe, 0x2d, 0x42, 0x5a, 0x3f, 0x7c, 0xe3, 0x98, 0xe0, 0x3d, 0xc2, 0x01,
+    0x02, 0x78, 0x60, 0x50, 0xa0, 0xf1, 0x01, 0x81, 0x21, 0xa8, 0x71, 0x74, 0x83, 0x08, 0x22, 0x91,
+    0x09, 0x52, 0x90, 0x82, 0x82, 0xa4, 0x31, 0x81, 0x25, 0x21, 0x50, 0x99, 0x99, 0x07, 0x41, 0x08,
+    0x07, 0xc9, 0x86, 0xa0, 0x94, 0xa4, 0xa0, 0x58, 0x3a, 0xca, 0x68, 0xd3, 0xbd, 0xf5, 0x91, 0xdd,
+    0xb8, 0x5a, 0xe5, 0xd2, 0xc1, 0x72, 0x67, 0x18, 0x09, 0x3f, 0x7f, 0xdf, 0x35, 0xa9, 0x4b, 0x3a,
+    0x77, 0xfc, 0x4e, 0xdb, 0x7a, 0xd3, 0x0d, 0xdd, 0xdb, 0xde, 0x97, 0xca, 0x03, 0x4f, 0x4c, 0xbf,
+    0x52, 0xed, 0x85, 0xd7, 0x66, 0xd7, 0xc8, 0x33, 0x83, 0xc9, 0xde, 0x25, 0xef, 0xd2, 0x28, 0x7b,
+    0x68, 0x66, 0xf6, 0x7a, 0x88, 0xfe, 0xd1, 0x48, 0xd9, 0x70, 0x05, 0xbc, 0x56, 0xd4, 0x64, 0xbc,
+    0x41, 0x39, 0x0b, 0x74, 0xbd, 0xd2, 0x53, 0xbd, 0xe9, 0xcd, 0x78, 0xe8, 0x7f, 0x28, 0xe7, 0xab,
+    0x9c, 0x79, 0xa3, 0xe2, 0xf8, 0x44, 0x0f, 0xc8, 0x87, 0xca, 0x85, 0xfe, 0xa1, 0x38, 0x99, 0xd7,
+    0xbd, 0xa8, 0x98, 0x87, 0x5c, 0x0b, 0xdb, 0x00, 0x08, 0x59, 0x3b, 0xae, 0xcb, 0x6f, 0xdb, 0xac,
+    0x1a, 0xbf, 0x21, 0x41, 0x79, 0xc3, 0x60, 0x48, 0x6e, 0x1b, 0x26, 0x7e, 0x62, 0xc9, 0x85, 0xf1,
+    0x3c, 0x46, 0x7a, 0x07, 0xb9, 0x70, 0x87, 0xcd, 0xa6, 0xd1, 0x7e, 0x72, 0x44, 0xfd, 0x72, 0x25,
+    0x74, 0xc6, 0xd5, 0x41, 0xd6, 0xc9, 0xc6, 0xe6, 0x07, 0x17, 0xe6, 0x4d, 0x58, 0x4f, 0x05, 0x62,
+    0xf1, 0xb0, 0xc3, 0x13, 0x5c, 0xff, 0x93, 0x7a, 0x05, 0xf0, 0x40, 0xf8, 0xdd, 0x2b, 0x1e, 0xcb,
+    0xd0, 0x95, 0x78, 0x33, 0xea, 0x79, 0xfd, 0xff, 0x0d, 0xe0, 0xd7, 0x3a, 0xdf, 0x38, 0x0d, 0x9d,
+    0x4a, 0xfa, 0x43, 0xdc, 0x6d, 0x27, 0xdf, 0xc6, 0x7b, 0xc0, 0x2b, 0xb5, 0x79, 0x5f, 0xef, 0xed,
+    0xbf, 0x57, 0x8f, 0x37, 0x92, 0xd6, 0x8e, 0x0e, 0x90, 0xf0, 0x45, 0xcb, 0x8f, 0xed, 0x3f, 0x8d,
+    0x99, 0x68, 0xc3, 0x8a, 0xe6, 0xc7, 0xcd, 0x19, 0xd1, 0xcd, 0x63, 0x38, 0x03, 0x56, 0x10, 0xff,
+    0xbe, 0xe9, 0xfc, 0xc9, 0xad, 0x76, 0x8c, 0x39, 0x16, 0x58, 0x47, 0xa8, 0x01, 0x74, 0x86, 0xbb,
+    0x6e, 0x93, 0x7e, 0xc4, 0xaf, 0xe0, 0x57, 0xee, 0x51, 0xd8, 0xc1, 0x1c, 0xba, 0xa3, 0x96, 0xb5,
+    0x40, 0x58, 0x18, 0x96, 0x57, 0x57, 0xfc, 0x0b, 0xf3, 0x03, 0x93, 0x06, 0x9c, 0xf8, 0x3c, 0x10,
+    0x58, 0x96, 0x10, 0x83, 0x04, 0xd0, 0x3e, 0x30, 0xb3, 0xcc, 0x46, 0x99, 0x8c, 0x57, 0xef, 0xf9,
+    0xf1, 0xd3, 0xe7, 0xa3, 0x0e, 0x86, 0x29, 0x4f, 0xc6, 0x06, 0x67, 0x56, 0x8b, 0xb4, 0xd9, 0x88,
+    0x63, 0xb7, 0xb2, 0x34, 0x9d, 0xf5, 0x84, 0x8a, 0xc7, 0x38, 0x1b, 0x4f, 0x58, 0x29, 0xcc, 0x32,
+    0x83, 0x4e, 0x53, 0xe6, 0xde, 0xda, 0xea, 0x76, 0xa5, 0x08, 0xe6, 0xbe, 0xb9, 0xf2, 0x05, 0xad,
+    0xf7, 0x08, 0xc7, 0x72, 0x63, 0x63, 0xda, 0x1e, 0x17, 0x3d, 0x35, 0x81, 0x1f, 0x7a, 0xae, 0xa0,
+    0x8d, 0xc2, 0xd1, 0x19, 0xd5, 0x11, 0xa4, 0xae, 0x75, 0x47, 0xa5, 0x07, 0x53, 0xfc, 0x11, 0x2c,
+    0x26, 0x56, 0x56, 0x3b, 0x50, 0xd2, 0x77, 0x03, 0x0d, 0x18, 0xbd, 0x24, 0x0b, 0x57, 0x3c, 0xc4,
+    0x41, 0xfd, 0xf2, 0x14, 0x9f, 0x3d, 0xd5, 0xff, 0xfd, 0xf4, 0x4c, 0x22, 0x0a, 0x34,
 };
+const ShaderModule Blob097 = { Blob097_Data, 1150u, 820u, 97u };
 
 } // namespace detail
 } // namespace VulkanShaders
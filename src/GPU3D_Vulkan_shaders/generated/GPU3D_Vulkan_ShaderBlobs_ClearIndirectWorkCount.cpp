@@ -28,13 +28,12 @@
     Pipeline indices match ComputeRenderer3D::ShaderCompileStep() in
     src/GPU3D_Compute.cpp one for one.
 
-    The SPIR-V words live in per-stage translation units rather than in the
-    header so that including the public header stays cheap: the full module set
-    is a few megabytes of integer literals and would otherwise be re-parsed by
-    every consumer.
+    Every module is one zstd frame, inflated on first use by
+    Vk::InflateShaderModule(). The frames live in per-stage translation units
+    rather than in the header so that including the public header stays cheap.
 */
 
-// SPIR-V for src/GPU3D_Vulkan_shaders/ClearIndirectWorkCount.comp.
+// SPIR-V for src/GPU3D_Vulkan_shaders/ClearIndirectWorkCount.comp, one zstd frame per module.
 
 #include "GPU3D_Vulkan_ShaderBlobs.h"
 
@@ -45,306 +44,228 @@ namespace VulkanShaders
 namespace detail
 {
 
-extern const uint32_t Blob022[763];
-const uint32_t Blob022[763] = {
-    0x07230203, 0x00010300, 0x0008000b, 0x0000003b, 0x00000000, 0x00020011, 0x00000001, 0x0006000b,
-    0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001,
-    0x0006000f, 0x00000005, 0x00000004, 0x6e69616d, 0x00000000, 0x00000014, 0x00060010, 0x00000004,
-    0x00000011, 0x00000020, 0x00000001, 0x00000001, 0x00030003, 0x00000002, 0x000001c2, 0x000a0004,
-    0x475f4c47, 0x4c474f4f, 0x70635f45, 0x74735f70, 0x5f656c79, 0x656e696c, 0x7269645f, 0x69746365,
-    0x00006576, 0x00080004, 0x475f4c47, 0x4c474f4f, 0x6e695f45, 0x64756c63, 0x69645f65, 0x74636572,
-    0x00657669, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000, 0x00060005, 0x0000000d, 0x526e6942,
-    0x6c757365, 0x66754274, 0x00726566, 0x00080006, 0x0000000d, 0x00000000, 0x69726156, 0x57746e61,
-    0x436b726f, 0x746e756f, 0x00000000, 0x00080006, 0x0000000d, 0x00000001, 0x74726f53, 0x6f576465,
-    0x664f6b72, 0x74657366, 0x00000000, 0x00090006, 0x0000000d, 0x00000002, 0x69726156, 0x57746e61,
-    0x526b726f, 0x436c6165, 0x746e756f, 0x00000000, 0x00080006, 0x0000000d, 0x00000003, 0x74726f53,
-    0x6b726f57, 0x6b726f57, 0x6e756f43, 0x00000074, 0x00090006, 0x0000000d, 0x00000004, 0x6e6e6942,
-    0x4d676e69, 0x416b7361, 0x664f646e, 0x74657366, 0x00000000, 0x00030005, 0x0000000f, 0x00000000,
-    0x00080005, 0x00000014, 0x475f6c67, 0x61626f6c, 0x766e496c, 0x7461636f, 0x496e6f69, 0x00000044,
-    0x00050005, 0x0000001d, 0x65726353, 0x69576e65, 0x00687464, 0x00060005, 0x0000001e, 0x65726353,
-    0x65486e65, 0x74686769, 0x00000000, 0x00060005, 0x0000001f, 0x5778614d, 0x546b726f, 0x73656c69,
-    0x00000000, 0x00070005, 0x00000023, 0x6d617246, 0x66756265, 0x53726566, 0x64697274, 0x00000065,
-    0x00060005, 0x00000024, 0x656c6954, 0x72655073, 0x656e694c, 0x00000000, 0x00050005, 0x00000025,
-    0x656c6954, 0x656e694c, 0x00000073, 0x00050005, 0x0000002c, 0x6174654d, 0x66696e55, 0x006d726f,
-    0x00060006, 0x0000002c, 0x00000000, 0x506d754e, 0x67796c6f, 0x00736e6f, 0x00060006, 0x0000002c,
-    0x00000001, 0x566d754e, 0x61697261, 0x0073746e, 0x00060006, 0x0000002c, 0x00000002, 0x68706c41,
-    0x66655261, 0x00000000, 0x00050006, 0x0000002c, 0x00000003, 0x70736944, 0x00746e43, 0x00060006,
-    0x0000002c, 0x00000004, 0x6e6f6f54, 0x6c626154, 0x00000065, 0x00060006, 0x0000002c, 0x00000005,
-    0x61656c43, 0x6c6f4372, 0x0000726f, 0x00060006, 0x0000002c, 0x00000006, 0x61656c43, 0x70654472,
-    0x00006874, 0x00060006, 0x0000002c, 0x00000007, 0x61656c43, 0x74744172, 0x00000072, 0x00060006,
-    0x0000002c, 0x00000008, 0x4f676f46, 0x65736666, 0x00000074, 0x00060006, 0x0000002c, 0x00000009,
-    0x53676f46, 0x74666968, 0x00000000, 0x00060006, 0x0000002c, 0x0000000a, 0x43676f46, 0x726f6c6f,
-    0x00000000, 0x00080006, 0x0000002c, 0x0000000b, 0x61656c43, 0x74694272, 0x4f70616d, 0x65736666,
-    0x00000074, 0x00030005, 0x0000002e, 0x00000000, 0x00060005, 0x0000002f, 0x68737550, 0x736e6f43,
-    0x746e6174, 0x00000073, 0x00060006, 0x0000002f, 0x00000000, 0x56727543, 0x61697261, 0x0000746e,
-    0x00060006, 0x0000002f, 0x00000001, 0x57786554, 0x68746469, 0x00000000, 0x00060006, 0x0000002f,
-    0x00000002, 0x48786554, 0x68676965, 0x00000074, 0x00060006, 0x0000002f, 0x00000003, 0x57786554,
-    0x53706172, 0x00000000, 0x00060006, 0x0000002f, 0x00000004, 0x57786554, 0x54706172, 0x00000000,
-    0x00070006, 0x0000002f, 0x00000005, 0x49786554, 0x70614373, 0x65727574, 0x00000000, 0x00070006,
-    0x0000002f, 0x00000006, 0x74706143, 0x59657275, 0x7366664f, 0x00007465, 0x00050006, 0x0000002f,
-    0x00000007, 0x6461705f, 0x00000000, 0x00030005, 0x00000031, 0x00006370, 0x00070005, 0x00000035,
-    0x6e6e6942, 0x4d676e69, 0x536b7361, 0x74726174, 0x00000000, 0x00080005, 0x00000038, 0x6e6e6942,
-    0x57676e69, 0x4f6b726f, 0x65736666, 0x74537374, 0x00747261, 0x00040047, 0x00000009, 0x00000006,
-    0x00000010, 0x00040047, 0x0000000a, 0x00000006, 0x00000004, 0x00040047, 0x0000000b, 0x00000006,
-    0x00000004, 0x00040047, 0x0000000c, 0x00000006, 0x00000004, 0x00050048, 0x0000000d, 0x00000000,
-    0x00000023, 0x00000000, 0x00050048, 0x0000000d, 0x00000001, 0x00000023, 0x00008000, 0x00050048,
-    0x0000000d, 0x00000002, 0x00000023, 0x0000a000, 0x00050048, 0x0000000d, 0x00000003, 0x00000023,
-    0x0000c000, 0x00050048, 0x0000000d, 0x00000004, 0x00000023, 0x0000c010, 0x00030047, 0x0000000d,
-    0x00000002, 0x00040047, 0x0000000f, 0x00000022, 0x00000000, 0x00040047, 0x0000000f, 0x00000021,
-    0x00000008, 0x00040047, 0x00000014, 0x0000000b, 0x0000001c, 0x00040047, 0x0000001d, 0x00000001,
-    0x00000000, 0x00040047, 0x0000001e, 0x00000001, 0x00000001, 0x00040047, 0x0000001f, 0x00000001,
-    0x00000002, 0x00040047, 0x00000029, 0x00000006, 0x00000010, 0x00050048, 0x0000002c, 0x00000000,
-    0x00000023, 0x00000000, 0x00050048, 0x0000002c, 0x00000001, 0x00000023, 0x00000004, 0x00050048,
-    0x0000002c, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x0000002c, 0x00000003, 0x00000023,
-    0x0000000c, 0x00050048, 0x0000002c, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x0000002c,
-    0x00000005, 0x00000023, 0x00000230, 0x00050048, 0x0000002c, 0x00000006, 0x00000023, 0x00000234,
-    0x00050048, 0x0000002c, 0x00000007, 0x00000023, 0x00000238, 0x00050048, 0x0000002c, 0x00000008,
-    0x00000023, 0x0000023c, 0x00050048, 0x0000002c, 0x00000009, 0x00000023, 0x00000240, 0x00050048,
-    0x0000002c, 0x0000000a, 0x00000023, 0x00000244, 0x00050048, 0x0000002c, 0x0000000b, 0x00000023,
-    0x00000248, 0x00030047, 0x0000002c, 0x00000002, 0x00040047, 0x0000002e, 0x00000022, 0x00000000,
-    0x00040047, 0x0000002e, 0x00000021, 0x00000000, 0x00050048, 0x0000002f, 0x00000000, 0x00000023,
-    0x00000000, 0x00050048, 0x0000002f, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x0000002f,
-    0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x0000002f, 0x00000003, 0x00000023, 0x0000000c,
-    0x00050048, 0x0000002f, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x0000002f, 0x00000005,
-    0x00000023, 0x00000014, 0x00050048, 0x0000002f, 0x00000006, 0x00000023, 0x00000018, 0x00050048,
-    0x0000002f, 0x00000007, 0x00000023, 0x0000001c, 0x00030047, 0x0000002f, 0x00000002, 0x00040047,
-    0x0000003a, 0x0000000b, 0x00000019, 0x00020013, 0x00000002, 0x00030021, 0x00000003, 0x00000002,
-    0x00040015, 0x00000006, 0x00000020, 0x00000000, 0x00040017, 0x00000007, 0x00000006, 0x00000004,
-    0x0004002b, 0x00000006, 0x00000008, 0x00000800, 0x0004001c, 0x00000009, 0x00000007, 0x00000008,
-    0x0004001c, 0x0000000a, 0x00000006, 0x00000008, 0x0004001c, 0x0000000b, 0x00000006, 0x00000008,
-    0x0003001d, 0x0000000c, 0x00000006, 0x0007001e, 0x0000000d, 0x00000009, 0x0000000a, 0x0000000b,
-    0x00000007, 0x0000000c, 0x00040020, 0x0000000e, 0x0000000c, 0x0000000d, 0x0004003b, 0x0000000e,
-    0x0000000f, 0x0000000c, 0x00040015, 0x00000010, 0x00000020, 0x00000001, 0x0004002b, 0x00000010,
-    0x00000011, 0x00000000, 0x00040017, 0x00000012, 0x00000006, 0x00000003, 0x00040020, 0x00000013,
-    0x00000001, 0x00000012, 0x0004003b, 0x00000013, 0x00000014, 0x00000001, 0x0004002b, 0x00000006,
-    0x00000015, 0x00000000, 0x00040020, 0x00000016, 0x00000001, 0x00000006, 0x0004002b, 0x00000006,
-    0x00000019, 0x00000001, 0x0007002c, 0x00000007, 0x0000001a, 0x00000019, 0x00000019, 0x00000015,
-    0x00000015, 0x00040020, 0x0000001b, 0x0000000c, 0x00000007, 0x00040032, 0x00000010, 0x0000001d,
-    0x00000100, 0x00040032, 0x00000010, 0x0000001e, 0x000000c0, 0x00040032, 0x00000010, 0x0000001f,
-    0x00003000, 0x0004002b, 0x00000010, 0x00000020, 0x00000008, 0x0004002b, 0x00000010, 0x00000021,
-    0x00000040, 0x0004002b, 0x00000010, 0x00000022, 0x00000020, 0x00060034, 0x00000010, 0x00000023,
-    0x00000084, 0x0000001d, 0x0000001e, 0x00060034, 0x00000010, 0x00000024, 0x00000087, 0x0000001d,
-    0x00000020, 0x00060034, 0x00000010, 0x00000025, 0x00000087, 0x0000001e, 0x00000020, 0x0004002b,
-    0x00000010, 0x00000026, 0x00000002, 0x0004002b, 0x00000010, 0x00000027, 0x00000800, 0x0004002b,
-    0x00000006, 0x00000028, 0x00000022, 0x0004001c, 0x00000029, 0x00000007, 0x00000028, 0x00030016,
-    0x0000002a, 0x00000020, 0x00040017, 0x0000002b, 0x0000002a, 0x00000002, 0x000e001e, 0x0000002c,
-    0x00000006, 0x00000006, 0x00000010, 0x00000006, 0x00000029, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x0000002b, 0x00040020, 0x0000002d, 0x00000002, 0x0000002c,
-    0x0004003b, 0x0000002d, 0x0000002e, 0x00000002, 0x000a001e, 0x0000002f, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000010, 0x00000006, 0x00040020, 0x00000030,
-    0x00000009, 0x0000002f, 0x0004003b, 0x00000030, 0x00000031, 0x00000009, 0x0004002b, 0x00000006,
-    0x00000032, 0x00008000, 0x00060034, 0x00000010, 0x00000033, 0x00000084, 0x00000024, 0x00000025,
-    0x00060034, 0x00000010, 0x00000034, 0x00000084, 0x00000033, 0x00000026, 0x00060034, 0x00000010,
-    0x00000035, 0x00000080, 0x00000011, 0x00000034, 0x00060034, 0x00000010, 0x00000036, 0x00000084,
-    0x00000024, 0x00000025, 0x00060034, 0x00000010, 0x00000037, 0x00000084, 0x00000036, 0x00000021,
-    0x00060034, 0x00000010, 0x00000038, 0x00000080, 0x00000035, 0x00000037, 0x0004002b, 0x00000006,
-    0x00000039, 0x00000020, 0x0006002c, 0x00000012, 0x0000003a, 0x00000039, 0x00000019, 0x00000019,
-    0x00050036, 0x00000002, 0x00000004, 0x00000000, 0x00000003, 0x000200f8, 0x00000005, 0x00050041,
-    0x00000016, 0x00000017, 0x00000014, 0x00000015, 0x0004003d, 0x00000006, 0x00000018, 0x00000017,
-    0x00060041, 0x0000001b, 0x0000001c, 0x0000000f, 0x00000011, 0x00000018, 0x0003003e, 0x0000001c,
-    0x0000001a, 0x000100fd, 0x00010038,
+const uint8_t Blob022_Data[1096] =
+{
+    0x28, 0xb5, 0x2f, 0xfd, 0x60, 0xec, 0x0a, 0xf5, 0x21, 0x00, 0xd6, 0xf8, 0xa3, 0x3a, 0x20, 0x75,
+    0xb3, 0x06, 0xa0, 0x1a, 0x00, 0x18, 0x00, 0x18, 0xa0, 0x60, 0x00, 0x60, 0x40, 0xc0, 0x00, 0x50,
+    0x26, 0xa0, 0x0b, 0xdb, 0x7b, 0xf6, 0x36, 0x6e, 0xab, 0x26, 0xda, 0x65, 0xc3, 0x8e, 0xb3, 0x49,
+    0xde, 0x43, 0x9b, 0xc0, 0xff, 0x5a, 0x11, 0x5b, 0x16, 0xc0, 0x9f, 0xdb, 0xae, 0x60, 0x7e, 0x5d,
+    0x2b, 0xb6, 0x36, 0x5a, 0x5a, 0x5a, 0xb2, 0x53, 0x94, 0x00, 0x9c, 0x00, 0x95, 0x00, 0xdf, 0x61,
+    0x2d, 0x6d, 0x09, 0x62, 0xcd, 0x1a, 0xa0, 0xf4, 0x4c, 0xc1, 0x0f, 0x35, 0x6f, 0x8e, 0x77, 0xba,
+    0xac, 0xcd, 0x76, 0x53, 0xbb, 0xed, 0xaa, 0xca, 0xfe, 0xdb, 0x34, 0xa7, 0xc2, 0x82, 0x56, 0xb5,
+    0xa7, 0x4d, 0xcd, 0x73, 0x35, 0x79, 0xfe, 0xc9, 0xc5, 0xd7, 0x6b, 0xb3, 0xe5, 0x5c, 0x5a, 0x34,
+    0xc7, 0xde, 0x9c, 0xf4, 0x74, 0xf9, 0x03, 0x16, 0x0f, 0xc1, 0xc3, 0x5a, 0x0e, 0xa5, 0xa5, 0x27,
+    0xf9, 0x1d, 0x3a, 0x5b, 0xda, 0x5d, 0xcf, 0xda, 0xec, 0xa6, 0x27, 0x3a, 0xbb, 0x68, 0x51, 0xcb,
+    0xce, 0x70, 0x38, 0xda, 0x0c, 0x86, 0x26, 0x76, 0x73, 0x13, 0x9b, 0xa1, 0x06, 0xbf, 0x5b, 0xfa,
+    0xbd, 0xbf, 0xbf, 0xef, 0xfe, 0xd6, 0x83, 0x8b, 0xab, 0xfe, 0x83, 0xff, 0xf4, 0x34, 0x85, 0x7e,
+    0xf0, 0x0f, 0x17, 0x1f, 0xf8, 0xff, 0x16, 0xf8, 0xef, 0x10, 0x09, 0x79, 0xd5, 0x5a, 0xf6, 0x45,
+    0x23, 0xa3, 0x89, 0x89, 0xa7, 0xfe, 0x6e, 0x6f, 0x82, 0x51, 0x26, 0x4f, 0xdd, 0x7d, 0x8f, 0x13,
+    0xde, 0x17, 0xe2, 0x6b, 0x9c, 0x29, 0xd4, 0x9e, 0x2e, 0x29, 0x12, 0x75, 0x6b, 0x3b, 0x6f, 0xb2,
+    0x13, 0x90, 0x1a, 0xf3, 0x93, 0xaf, 0x6d, 0xdb, 0x32, 0xde, 0x5a, 0xdc, 0x7d, 0x11, 0x57, 0x15,
+    0x55, 0x61, 0xab, 0x79, 0x51, 0xd8, 0x1f, 0xfe, 0x5f, 0xf4, 0xc7, 0xd4, 0x49, 0x55, 0x55, 0xe7,
+    0x36, 0x85, 0xe1, 0xd8, 0xf3, 0xe5, 0xff, 0xc2, 0xdf, 0x76, 0x73, 0xcc, 0x1b, 0x0e, 0x6d, 0xf9,
+    0xbd, 0xbb, 0xd9, 0x54, 0x05, 0x2a, 0x42, 0x55, 0x1c, 0xa1, 0x9c, 0xcd, 0xbf, 0xb8, 0xb8, 0xd0,
+    0xaa, 0xda, 0xce, 0x74, 0xc7, 0x6c, 0xaf, 0x8b, 0xad, 0xf8, 0xa6, 0x27, 0xcd, 0x7a, 0x71, 0x7e,
+    0x8a, 0x5b, 0x3b, 0xd7, 0x56, 0xf6, 0x73, 0x85, 0xcc, 0x35, 0xe6, 0x9f, 0x78, 0x64, 0x2f, 0x7a,
+    0xea, 0x10, 0x99, 0x35, 0x3f, 0xc4, 0xed, 0x0d, 0xe8, 0xbc, 0x32, 0xac, 0x5b, 0x5b, 0x3b, 0x7b,
+    0xd2, 0x7b, 0x57, 0x9a, 0xec, 0x7f, 0x38, 0x3c, 0xfc, 0x5f, 0x66, 0x52, 0xf5, 0x6c, 0x4d, 0x9a,
+    0x3a, 0x94, 0xce, 0xa0, 0xe6, 0x8f, 0x8a, 0xc6, 0x66, 0x28, 0x10, 0xf9, 0x3f, 0x70, 0x01, 0x02,
+    0x83, 0xb7, 0x46, 0x54, 0xc0, 0xe3, 0xac, 0xbf, 0x1f, 0x56, 0xe3, 0xea, 0xc9, 0x8d, 0x71, 0x70,
+    0x85, 0xd6, 0x2f, 0x22, 0x7c, 0x7f, 0xde, 0xde, 0x06, 0x3f, 0xc3, 0x49, 0xf9, 0xf7, 0xc2, 0x07,
+    0x65, 0x59, 0x96, 0x65, 0xf9, 0xeb, 0xe5, 0xda, 0x93, 0x49, 0xbd, 0xa0, 0x58, 0x4e, 0x29, 0x64,
+    0xc9, 0x18, 0x22, 0x7a, 0x1d, 0x21, 0xc0, 0x93, 0x0f, 0xba, 0x5c, 0x19, 0x1e, 0x44, 0xc7, 0xfa,
+    0x61, 0x75, 0x40, 0xfe, 0x11, 0xff, 0x12, 0xff, 0x80, 0xf7, 0x1d, 0x53, 0x81, 0x4a, 0x5f, 0x92,
+    0x67, 0xd4, 0xfd, 0x4f, 0x84, 0xcb, 0x00, 0xa4, 0x40, 0xd4, 0xab, 0x4e, 0x83, 0xc7, 0xd8, 0x92,
+    0x76, 0x35, 0x5b, 0xd9, 0x2f, 0x32, 0x0d, 0xf7, 0x7b, 0x5c, 0x33, 0x71, 0xb3, 0xd2, 0xe7, 0x17,
+    0xbf, 0x6b, 0xae, 0xc5, 0x99, 0x30, 0x76, 0x26, 0x1c, 0x75, 0xc0, 0x65, 0x38, 0x73, 0xfd, 0xbc,
+    0x89, 0xae, 0xce, 0xdf, 0xad, 0x39, 0xd8, 0xbf, 0xf8, 0x2d, 0x9b, 0xaa, 0xb0, 0x1b, 0x9b, 0xc3,
+    0xf9, 0xcb, 0x03, 0x77, 0x97, 0xdc, 0xdd, 0xb4, 0xfa, 0x7b, 0x85, 0x60, 0xf5, 0x3b, 0x2c, 0xde,
+    0xb2, 0xa0, 0xf2, 0x23, 0x28, 0xfc, 0x09, 0x87, 0xb7, 0xfc, 0xe1, 0xde, 0x4c, 0x7b, 0x87, 0x8f,
+    0x30, 0x9c, 0xfc, 0x05, 0x2e, 0x13, 0x91, 0x92, 0x88, 0x7f, 0x84, 0x64, 0x24, 0xc4, 0xe8, 0x17,
+    0x01, 0x09, 0xa9, 0xf8, 0x29, 0x40, 0x8c, 0xfe, 0x3f, 0x4e, 0xbf, 0xc7, 0x65, 0xc7, 0x97, 0xa3,
+    0x7e, 0xa1, 0xfc, 0x2e, 0x8e, 0x8d, 0x0c, 0xd5, 0x02, 0xde, 0x6f, 0xb4, 0x7e, 0x8d, 0xbf, 0x13,
+    0xc6, 0x15, 0x06, 0xf9, 0x7f, 0xe1, 0xfd, 0x16, 0xac, 0x8a, 0x16, 0xd2, 0x4f, 0xc1, 0x3a, 0x52,
+    0x2d, 0x1e, 0x22, 0xc1, 0xf2, 0x47, 0x90, 0x1b, 0xdf, 0xf1, 0x0f, 0xb1, 0xd2, 0xcf, 0xea, 0x1e,
+    0x3e, 0xfe, 0xd1, 0x01, 0x81, 0xa1, 0xe1, 0x1f, 0x1f, 0x77, 0x31, 0x88, 0x09, 0xff, 0x08, 0x9d,
+    0x41, 0x81, 0xc1, 0x57, 0x40, 0xb0, 0xf1, 0x77, 0xaa, 0x07, 0x50, 0xfe, 0x81, 0x0b, 0xa8, 0x81,
+    0x74, 0x82, 0x08, 0x22, 0x91, 0x09, 0x52, 0x90, 0x94, 0x24, 0x1d, 0x71, 0x21, 0x21, 0x50, 0x31,
+    0x53, 0x0f, 0x21, 0x0c, 0xc9, 0xb8, 0x8a, 0xa0, 0x94, 0xa4, 0xa0, 0x98, 0x35, 0xf3, 0xd8, 0xc7,
+    0xfa, 0xad, 0xdc, 0x91, 0xeb, 0xdc, 0x47, 0xf8, 0x2f, 0xfb, 0xb5, 0xca, 0x5f, 0x57, 0x20, 0xe0,
+    0xd8, 0x75, 0x46, 0x91, 0x63, 0xb0, 0x0c, 0x84, 0x25, 0x1b, 0xc2, 0x22, 0x34, 0xf8, 0x8c, 0x64,
+    0x2b, 0xe5, 0xd5, 0x46, 0x4f, 0xe0, 0x3d, 0xee, 0xc1, 0x6c, 0x74, 0x6f, 0x32, 0x2f, 0xb7, 0x55,
+    0x61, 0x05, 0xd9, 0x34, 0xcd, 0x72, 0x28, 0x9f, 0x1c, 0x59, 0x45, 0x53, 0xfe, 0xc7, 0xf3, 0xd4,
+    0xf3, 0x72, 0x83, 0x6c, 0xb0, 0x7b, 0x0b, 0x57, 0x28, 0xfe, 0x3e, 0x1e, 0xfc, 0x8e, 0x2c, 0x06,
+    0x08, 0x80, 0xad, 0x57, 0x9e, 0xfb, 0xfe, 0x20, 0x80, 0x61, 0xea, 0x2f, 0x3e, 0xb6, 0x79, 0xfc,
+    0xf8, 0xd8, 0x56, 0xef, 0xfe, 0xb1, 0xce, 0x86, 0x70, 0x3c, 0x8f, 0x39, 0xbd, 0x0d, 0x9e, 0x70,
+    0xd4, 0x43, 0x4e, 0x34, 0xdc, 0x79, 0x7f, 0xdd, 0x2b, 0xe7, 0xd9, 0xcd, 0xd2, 0x2e, 0x2d, 0x1c,
+    0x37, 0x99, 0xa7, 0x80, 0x02, 0xb9, 0x46, 0xa6, 0x1e, 0x3e, 0xd0, 0x4f, 0x75, 0x08, 0xf5, 0x68,
+    0xf3, 0x1d, 0x3b, 0x91, 0x01, 0xa7, 0x4c, 0xff, 0x06, 0xcb, 0x27, 0xf6, 0xcf, 0x61, 0x2f, 0x3f,
+    0xe4, 0x6b, 0x34, 0xfe, 0xfd, 0x7c, 0xf8, 0x3f, 0xb6, 0x62, 0x03, 0x4e, 0xc0, 0xf0, 0xad, 0xd7,
+    0x75, 0x9c, 0x15, 0x50, 0x4c, 0x63, 0x09, 0xb2, 0x2b, 0x91, 0x2c, 0x1d, 0xbf, 0x24, 0xc5, 0x2b,
+    0xcf, 0x8d, 0x6d, 0x7b, 0x86, 0x4d, 0x50, 0x09, 0x03, 0xa4, 0x8f, 0xc2, 0x3c, 0x62, 0xf6, 0x8f,
+    0x09, 0x0c, 0xce, 0x6c, 0x85, 0x0d, 0x71, 0x39, 0xd8, 0x80, 0xec, 0x6a, 0xd3, 0x17, 0x58, 0x44,
+    0xf0, 0x80, 0x77, 0x58, 0xbb, 0xf6, 0x0c, 0xb2, 0x88, 0xff, 0x7f, 0xe7, 0xf7, 0x48, 0x3f, 0x98,
+    0x1e, 0x77, 0x14, 0xac, 0xd3, 0x15, 0x1e, 0xb3, 0x1e, 0xb6, 0x5e, 0x4d, 0xef, 0x97, 0x47, 0xb7,
+    0x88, 0x9f, 0x3d, 0x0f, 0x30, 0x20, 0x50, 0x66, 0x4a, 0xac, 0x10, 0x10, 0x03, 0xeb, 0x8c, 0x36,
+    0x9b, 0x32, 0x19, 0x05, 0x5f, 0xf3, 0xa8, 0x4d, 0x77, 0xa3, 0x09, 0x23, 0x2c, 0xc7, 0x9a, 0x5a,
+    0x21, 0x03, 0x17, 0x29, 0x73, 0xac, 0x2b, 0x3f, 0x35, 0x3c, 0xcd, 0x7b, 0xba, 0xc6, 0xbb, 0x5c,
+    0x5c, 0x18, 0x5a, 0xaa, 0xec, 0x7d, 0x27, 0x4d, 0x80, 0x8d, 0xda, 0x76, 0x97, 0xaf, 0x3d, 0x76,
+    0x7a, 0x04, 0x87, 0xbe, 0x53, 0xf9, 0xd2, 0xa2, 0x77, 0xc4, 0xb1, 0xac, 0xd8, 0x90, 0xfd, 0xa5,
+    0xc5, 0x06, 0x5a, 0xa7, 0xa4, 0xf4, 0x2b, 0xe7, 0xaa, 0xcf, 0xa8, 0xa4, 0xf9, 0x51, 0x1a, 0x26,
+    0x4f, 0x89, 0x77, 0x64, 0x7a, 0x60, 0xf7, 0xd3, 0x63, 0x51, 0x5b, 0xed, 0xed, 0x40, 0xa7, 0xef,
+    0x2e, 0x1a, 0x2c, 0x7a, 0x09, 0x16, 0x5a, 0xf0, 0x21, 0x0c, 0x50, 0x3f, 0x98, 0x9d, 0xb3, 0xe7,
+    0xf9, 0x3f, 0x92, 0x3e, 0x48, 0x84, 0x81, 0x06,
 };
+const ShaderModule Blob022 = { Blob022_Data, 1096u, 763u, 22u };
 
-extern const uint32_t Blob060[767];
-const uint32_t Blob060[767] = {
-    0x07230203, 0x00010300, 0x0008000b, 0x0000003c, 0x00000000, 0x00020011, 0x00000001, 0x0006000b,
-    0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001,
-    0x0006000f, 0x00000005, 0x00000004, 0x6e69616d, 0x00000000, 0x00000014, 0x00060010, 0x00000004,
-    0x00000011, 0x00000020, 0x00000001, 0x00000001, 0x00030003, 0x00000002, 0x000001c2, 0x000a0004,
-    0x475f4c47, 0x4c474f4f, 0x70635f45, 0x74735f70, 0x5f656c79, 0x656e696c, 0x7269645f, 0x69746365,
-    0x00006576, 0x00080004, 0x475f4c47, 0x4c474f4f, 0x6e695f45, 0x64756c63, 0x69645f65, 0x74636572,
-    0x00657669, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000, 0x00060005, 0x0000000d, 0x526e6942,
-    0x6c757365, 0x66754274, 0x00726566, 0x00080006, 0x0000000d, 0x00000000, 0x69726156, 0x57746e61,
-    0x436b726f, 0x746e756f, 0x00000000, 0x00080006, 0x0000000d, 0x00000001, 0x74726f53, 0x6f576465,
-    0x664f6b72, 0x74657366, 0x00000000, 0x00090006, 0x0000000d, 0x00000002, 0x69726156, 0x57746e61,
-    0x526b726f, 0x436c6165, 0x746e756f, 0x00000000, 0x00080006, 0x0000000d, 0x00000003, 0x74726f53,
-    0x6b726f57, 0x6b726f57, 0x6e756f43, 0x00000074, 0x00090006, 0x0000000d, 0x00000004, 0x6e6e6942,
-    0x4d676e69, 0x416b7361, 0x664f646e, 0x74657366, 0x00000000, 0x00030005, 0x0000000f, 0x00000000,
-    0x00080005, 0x00000014, 0x475f6c67, 0x61626f6c, 0x766e496c, 0x7461636f, 0x496e6f69, 0x00000044,
-    0x00050005, 0x0000001d, 0x65726353, 0x69576e65, 0x00687464, 0x00060005, 0x0000001e, 0x65726353,
-    0x65486e65, 0x74686769, 0x00000000, 0x00060005, 0x0000001f, 0x5778614d, 0x546b726f, 0x73656c69,
-    0x00000000, 0x00070005, 0x00000023, 0x6d617246, 0x66756265, 0x53726566, 0x64697274, 0x00000065,
-    0x00060005, 0x00000025, 0x656c6954, 0x72655073, 0x656e694c, 0x00000000, 0x00050005, 0x00000026,
-    0x656c6954, 0x656e694c, 0x00000073, 0x00050005, 0x0000002d, 0x6174654d, 0x66696e55, 0x006d726f,
-    0x00060006, 0x0000002d, 0x00000000, 0x506d754e, 0x67796c6f, 0x00736e6f, 0x00060006, 0x0000002d,
-    0x00000001, 0x566d754e, 0x61697261, 0x0073746e, 0x00060006, 0x0000002d, 0x00000002, 0x68706c41,
-    0x66655261, 0x00000000, 0x00050006, 0x0000002d, 0x00000003, 0x70736944, 0x00746e43, 0x00060006,
-    0x0000002d, 0x00000004, 0x6e6f6f54, 0x6c626154, 0x00000065, 0x00060006, 0x0000002d, 0x00000005,
-    0x61656c43, 0x6c6f4372, 0x0000726f, 0x00060006, 0x0000002d, 0x00000006, 0x61656c43, 0x70654472,
-    0x00006874, 0x00060006, 0x0000002d, 0x00000007, 0x61656c43, 0x74744172, 0x00000072, 0x00060006,
-    0x0000002d, 0x00000008, 0x4f676f46, 0x65736666, 0x00000074, 0x00060006, 0x0000002d, 0x00000009,
-    0x53676f46, 0x74666968, 0x00000000, 0x00060006, 0x0000002d, 0x0000000a, 0x43676f46, 0x726f6c6f,
-    0x00000000, 0x00080006, 0x0000002d, 0x0000000b, 0x61656c43, 0x74694272, 0x4f70616d, 0x65736666,
-    0x00000074, 0x00030005, 0x0000002f, 0x00000000, 0x00060005, 0x00000030, 0x68737550, 0x736e6f43,
-    0x746e6174, 0x00000073, 0x00060006, 0x00000030, 0x00000000, 0x56727543, 0x61697261, 0x0000746e,
-    0x00060006, 0x00000030, 0x00000001, 0x57786554, 0x68746469, 0x00000000, 0x00060006, 0x00000030,
-    0x00000002, 0x48786554, 0x68676965, 0x00000074, 0x00060006, 0x00000030, 0x00000003, 0x57786554,
-    0x53706172, 0x00000000, 0x00060006, 0x00000030, 0x00000004, 0x57786554, 0x54706172, 0x00000000,
-    0x00070006, 0x00000030, 0x00000005, 0x49786554, 0x70614373, 0x65727574, 0x00000000, 0x00070006,
-    0x00000030, 0x00000006, 0x74706143, 0x59657275, 0x7366664f, 0x00007465, 0x00050006, 0x00000030,
-    0x00000007, 0x6461705f, 0x00000000, 0x00030005, 0x00000032, 0x00006370, 0x00070005, 0x00000036,
-    0x6e6e6942, 0x4d676e69, 0x536b7361, 0x74726174, 0x00000000, 0x00080005, 0x00000039, 0x6e6e6942,
-    0x57676e69, 0x4f6b726f, 0x65736666, 0x74537374, 0x00747261, 0x00040047, 0x00000009, 0x00000006,
-    0x00000010, 0x00040047, 0x0000000a, 0x00000006, 0x00000004, 0x00040047, 0x0000000b, 0x00000006,
-    0x00000004, 0x00040047, 0x0000000c, 0x00000006, 0x00000004, 0x00050048, 0x0000000d, 0x00000000,
-    0x00000023, 0x00000000, 0x00050048, 0x0000000d, 0x00000001, 0x00000023, 0x00008000, 0x00050048,
-    0x0000000d, 0x00000002, 0x00000023, 0x0000a000, 0x00050048, 0x0000000d, 0x00000003, 0x00000023,
-    0x0000c000, 0x00050048, 0x0000000d, 0x00000004, 0x00000023, 0x0000c010, 0x00030047, 0x0000000d,
-    0x00000002, 0x00040047, 0x0000000f, 0x00000022, 0x00000000, 0x00040047, 0x0000000f, 0x00000021,
-    0x00000008, 0x00040047, 0x00000014, 0x0000000b, 0x0000001c, 0x00040047, 0x0000001d, 0x00000001,
-    0x00000000, 0x00040047, 0x0000001e, 0x00000001, 0x00000001, 0x00040047, 0x0000001f, 0x00000001,
-    0x00000002, 0x00040047, 0x0000002a, 0x00000006, 0x00000010, 0x00050048, 0x0000002d, 0x00000000,
-    0x00000023, 0x00000000, 0x00050048, 0x0000002d, 0x00000001, 0x00000023, 0x00000004, 0x00050048,
-    0x0000002d, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x0000002d, 0x00000003, 0x00000023,
-    0x0000000c, 0x00050048, 0x0000002d, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x0000002d,
-    0x00000005, 0x00000023, 0x00000230, 0x00050048, 0x0000002d, 0x00000006, 0x00000023, 0x00000234,
-    0x00050048, 0x0000002d, 0x00000007, 0x00000023, 0x00000238, 0x00050048, 0x0000002d, 0x00000008,
-    0x00000023, 0x0000023c, 0x00050048, 0x0000002d, 0x00000009, 0x00000023, 0x00000240, 0x00050048,
-    0x0000002d, 0x0000000a, 0x00000023, 0x00000244, 0x00050048, 0x0000002d, 0x0000000b, 0x00000023,
-    0x00000248, 0x00030047, 0x0000002d, 0x00000002, 0x00040047, 0x0000002f, 0x00000022, 0x00000000,
-    0x00040047, 0x0000002f, 0x00000021, 0x00000000, 0x00050048, 0x00000030, 0x00000000, 0x00000023,
-    0x00000000, 0x00050048, 0x00000030, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x00000030,
-    0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x00000030, 0x00000003, 0x00000023, 0x0000000c,
-    0x00050048, 0x00000030, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x00000030, 0x00000005,
-    0x00000023, 0x00000014, 0x00050048, 0x00000030, 0x00000006, 0x00000023, 0x00000018, 0x00050048,
-    0x00000030, 0x00000007, 0x00000023, 0x0000001c, 0x00030047, 0x00000030, 0x00000002, 0x00040047,
-    0x0000003b, 0x0000000b, 0x00000019, 0x00020013, 0x00000002, 0x00030021, 0x00000003, 0x00000002,
-    0x00040015, 0x00000006, 0x00000020, 0x00000000, 0x00040017, 0x00000007, 0x00000006, 0x00000004,
-    0x0004002b, 0x00000006, 0x00000008, 0x00000800, 0x0004001c, 0x00000009, 0x00000007, 0x00000008,
-    0x0004001c, 0x0000000a, 0x00000006, 0x00000008, 0x0004001c, 0x0000000b, 0x00000006, 0x00000008,
-    0x0003001d, 0x0000000c, 0x00000006, 0x0007001e, 0x0000000d, 0x00000009, 0x0000000a, 0x0000000b,
-    0x00000007, 0x0000000c, 0x00040020, 0x0000000e, 0x0000000c, 0x0000000d, 0x0004003b, 0x0000000e,
-    0x0000000f, 0x0000000c, 0x00040015, 0x00000010, 0x00000020, 0x00000001, 0x0004002b, 0x00000010,
-    0x00000011, 0x00000000, 0x00040017, 0x00000012, 0x00000006, 0x00000003, 0x00040020, 0x00000013,
-    0x00000001, 0x00000012, 0x0004003b, 0x00000013, 0x00000014, 0x00000001, 0x0004002b, 0x00000006,
-    0x00000015, 0x00000000, 0x00040020, 0x00000016, 0x00000001, 0x00000006, 0x0004002b, 0x00000006,
-    0x00000019, 0x00000001, 0x0007002c, 0x00000007, 0x0000001a, 0x00000019, 0x00000019, 0x00000015,
-    0x00000015, 0x00040020, 0x0000001b, 0x0000000c, 0x00000007, 0x00040032, 0x00000010, 0x0000001d,
-    0x00000100, 0x00040032, 0x00000010, 0x0000001e, 0x000000c0, 0x00040032, 0x00000010, 0x0000001f,
-    0x00003000, 0x0004002b, 0x00000010, 0x00000020, 0x00000008, 0x0004002b, 0x00000010, 0x00000021,
-    0x00000080, 0x0004002b, 0x00000010, 0x00000022, 0x00000040, 0x00060034, 0x00000010, 0x00000023,
-    0x00000084, 0x0000001d, 0x0000001e, 0x0004002b, 0x00000010, 0x00000024, 0x00000010, 0x00060034,
-    0x00000010, 0x00000025, 0x00000087, 0x0000001d, 0x00000024, 0x00060034, 0x00000010, 0x00000026,
-    0x00000087, 0x0000001e, 0x00000024, 0x0004002b, 0x00000010, 0x00000027, 0x00000002, 0x0004002b,
-    0x00000010, 0x00000028, 0x00000800, 0x0004002b, 0x00000006, 0x00000029, 0x00000022, 0x0004001c,
-    0x0000002a, 0x00000007, 0x00000029, 0x00030016, 0x0000002b, 0x00000020, 0x00040017, 0x0000002c,
-    0x0000002b, 0x00000002, 0x000e001e, 0x0000002d, 0x00000006, 0x00000006, 0x00000010, 0x00000006,
-    0x0000002a, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x0000002c,
-    0x00040020, 0x0000002e, 0x00000002, 0x0000002d, 0x0004003b, 0x0000002e, 0x0000002f, 0x00000002,
-    0x000a001e, 0x00000030, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000010, 0x00000006, 0x00040020, 0x00000031, 0x00000009, 0x00000030, 0x0004003b, 0x00000031,
-    0x00000032, 0x00000009, 0x0004002b, 0x00000006, 0x00000033, 0x00008000, 0x00060034, 0x00000010,
-    0x00000034, 0x00000084, 0x00000025, 0x00000026, 0x00060034, 0x00000010, 0x00000035, 0x00000084,
-    0x00000034, 0x00000027, 0x00060034, 0x00000010, 0x00000036, 0x00000080, 0x00000011, 0x00000035,
-    0x00060034, 0x00000010, 0x00000037, 0x00000084, 0x00000025, 0x00000026, 0x00060034, 0x00000010,
-    0x00000038, 0x00000084, 0x00000037, 0x00000022, 0x00060034, 0x00000010, 0x00000039, 0x00000080,
-    0x00000036, 0x00000038, 0x0004002b, 0x00000006, 0x0000003a, 0x00000020, 0x0006002c, 0x00000012,
-    0x0000003b, 0x0000003a, 0x00000019, 0x00000019, 0x00050036, 0x00000002, 0x00000004, 0x00000000,
-    0x00000003, 0x000200f8, 0x00000005, 0x00050041, 0x00000016, 0x00000017, 0x00000014, 0x00000015,
-    0x0004003d, 0x00000006, 0x00000018, 0x00000017, 0x00060041, 0x0000001b, 0x0000001c, 0x0000000f,
-    0x00000011, 0x00000018, 0x0003003e, 0x0000001c, 0x0000001a, 0x000100fd, 0x00010038,
+const uint8_t Blob060_Data[1100] =
+{
+    0x28, 0xb5, 0x2f, 0xfd, 0x60, 0xfc, 0x0a, 0x15, 0x22, 0x00, 0x56, 0xb8, 0xa2, 0x3a, 0x20, 0x75,
+    0xb3, 0x06, 0xa0, 0x1a, 0x00, 0x18, 0x00, 0x18, 0xa0, 0x60, 0x00, 0x60, 0x40, 0xc0, 0x00, 0x50,
+    0x26, 0xa0, 0x0b, 0xdb, 0x7b, 0xf6, 0x36, 0x6e, 0xab, 0x26, 0xda, 0x65, 0xc3, 0x8e, 0xb3, 0x49,
+    0xde, 0x43, 0x4b, 0x03, 0xfc, 0xbf, 0x46, 0x47, 0x16, 0xc0, 0xff, 0xaa, 0x65, 0x01, 0xfc, 0x4c,
+    0xc1, 0x5d, 0x8d, 0x44, 0x44, 0x44, 0x84, 0xa4, 0x94, 0x00, 0x9c, 0x00, 0x91, 0x00, 0x13, 0xfc,
+    0x1d, 0xd6, 0xd2, 0x57, 0x10, 0x6b, 0xd6, 0x00, 0xa5, 0x67, 0x0a, 0x7e, 0xa8, 0x79, 0x73, 0x3c,
+    0x80, 0xcb, 0xda, 0x6c, 0x37, 0xb5, 0xdb, 0xae, 0xaa, 0xec, 0xbf, 0x4d, 0x73, 0x2a, 0x2c, 0x68,
+    0x55, 0x7b, 0xda, 0xd4, 0x3c, 0x57, 0x93, 0xe7, 0x9f, 0x5c, 0x7c, 0xbd, 0x36, 0x5b, 0xce, 0xa5,
+    0x45, 0x73, 0xec, 0xcd, 0x49, 0x4f, 0x97, 0x5f, 0x60, 0xf1, 0x10, 0x3c, 0xac, 0xe5, 0x50, 0x5a,
+    0x7a, 0x92, 0xdf, 0xa1, 0xb3, 0xa5, 0xdd, 0xf5, 0xac, 0xcd, 0x6e, 0x7a, 0xa2, 0xb3, 0x8b, 0x16,
+    0xb5, 0xec, 0x0c, 0x87, 0xa3, 0xcd, 0x60, 0x68, 0x62, 0x37, 0x37, 0xb1, 0xd9, 0x69, 0xf0, 0xbb,
+    0xa5, 0xdf, 0xfb, 0xfb, 0xeb, 0xfe, 0x08, 0x95, 0x78, 0xea, 0x3f, 0xf8, 0x4f, 0x4f, 0x53, 0xe8,
+    0x07, 0xff, 0x70, 0x71, 0x82, 0xff, 0xef, 0x81, 0xff, 0x72, 0xc4, 0xe5, 0x51, 0x6b, 0x59, 0x0f,
+    0x1a, 0x19, 0x4d, 0x4c, 0x1c, 0xf5, 0x77, 0x7b, 0xab, 0x56, 0x99, 0x1c, 0x75, 0xf7, 0x3d, 0x52,
+    0x78, 0x5f, 0xe5, 0xe2, 0xc7, 0x38, 0x53, 0xa8, 0x3d, 0x5d, 0x50, 0xe4, 0xe9, 0xd6, 0x76, 0xde,
+    0x64, 0x00, 0x40, 0x6a, 0xcc, 0x4f, 0xbe, 0xb6, 0xed, 0x6b, 0xbc, 0xb5, 0xb8, 0xfb, 0x22, 0xae,
+    0x2a, 0xaa, 0xc2, 0x56, 0xf3, 0xa2, 0xb0, 0x3f, 0xfc, 0x2f, 0xfa, 0x63, 0xea, 0xa4, 0xaa, 0xaa,
+    0x73, 0x9b, 0xc2, 0x70, 0xec, 0xf9, 0xf2, 0x7f, 0xe1, 0x6f, 0xbb, 0x39, 0xe6, 0x0d, 0x87, 0xbe,
+    0x7e, 0xef, 0x6e, 0x36, 0x55, 0x81, 0x8a, 0x50, 0x15, 0x47, 0x28, 0x67, 0xf3, 0x2f, 0x2e, 0x2e,
+    0xb4, 0xaa, 0xb6, 0x33, 0xdd, 0x31, 0xdb, 0xdb, 0x62, 0x2f, 0xbe, 0xe9, 0x49, 0xb3, 0x5e, 0x9c,
+    0xdf, 0xe2, 0xd6, 0xce, 0xb5, 0x95, 0xfd, 0x5c, 0x21, 0x73, 0x8d, 0xf9, 0x29, 0x1e, 0xd9, 0x8b,
+    0x9e, 0x3a, 0x44, 0x66, 0xcd, 0x0f, 0x71, 0x7b, 0x03, 0x3a, 0xaf, 0x0c, 0xeb, 0xd6, 0xd6, 0xce,
+    0x9e, 0xf4, 0xde, 0x95, 0x26, 0xfb, 0x1f, 0x0e, 0x0f, 0xff, 0x97, 0x99, 0x54, 0x3d, 0x5b, 0x93,
+    0xa6, 0x0e, 0xa5, 0x33, 0xa8, 0xf9, 0xa3, 0xa2, 0xb1, 0x19, 0x0a, 0x44, 0xfe, 0x01, 0xe3, 0x49,
+    0xe0, 0x71, 0xd6, 0xdf, 0x0f, 0xab, 0x71, 0xf5, 0x24, 0xc7, 0x38, 0xb8, 0x42, 0xc4, 0x2f, 0x22,
+    0x7c, 0x7f, 0xde, 0xde, 0x06, 0x3f, 0x43, 0x4a, 0xf9, 0xf7, 0xc2, 0x1f, 0x94, 0x65, 0x59, 0x96,
+    0xe5, 0x1f, 0x1f, 0xad, 0x3d, 0x19, 0xd4, 0xcb, 0xa9, 0x05, 0x40, 0x85, 0x34, 0x19, 0x5d, 0xa2,
+    0x57, 0x86, 0x01, 0x4f, 0x3e, 0xd8, 0x6a, 0x6d, 0x78, 0x10, 0x1d, 0xeb, 0x87, 0xd5, 0x01, 0xf9,
+    0x4b, 0xfc, 0x4f, 0xfc, 0x04, 0xde, 0x77, 0x2c, 0x05, 0x2a, 0x7d, 0x49, 0x9e, 0x51, 0xf7, 0xff,
+    0x0b, 0x1c, 0x2e, 0x13, 0x80, 0x02, 0x4f, 0x9f, 0x02, 0x18, 0x3c, 0xc6, 0x9e, 0xdc, 0xae, 0x66,
+    0x2b, 0xfb, 0x49, 0xa6, 0xe1, 0xfe, 0x90, 0x6b, 0x26, 0x6e, 0x56, 0xfa, 0xfc, 0xe2, 0x77, 0xcd,
+    0xb5, 0x38, 0x13, 0xc6, 0xce, 0x84, 0xa3, 0x0e, 0xb8, 0x0c, 0x67, 0xae, 0x9f, 0x37, 0xd1, 0xd5,
+    0xf9, 0xbb, 0x35, 0x07, 0xfb, 0x17, 0xbf, 0x65, 0x53, 0x15, 0x76, 0x63, 0x73, 0x38, 0x7f, 0x77,
+    0x9b, 0xdc, 0xdd, 0xb4, 0xfa, 0x9b, 0x45, 0xb5, 0xfa, 0x1d, 0x16, 0x7f, 0x2d, 0xac, 0xfc, 0x08,
+    0x0a, 0xe1, 0xaf, 0x3f, 0xdc, 0x9b, 0x69, 0xef, 0x70, 0x92, 0x17, 0xef, 0x40, 0x21, 0x39, 0x29,
+    0x31, 0x29, 0x51, 0x91, 0xb8, 0x46, 0x2c, 0x5c, 0x46, 0xff, 0x22, 0x0f, 0x52, 0x82, 0x7c, 0xf9,
+    0xe9, 0x8f, 0x94, 0xbf, 0xe5, 0xd1, 0xb1, 0x91, 0x7a, 0xc0, 0xfb, 0x8e, 0x88, 0x9f, 0xe3, 0xef,
+    0x84, 0x71, 0xa5, 0x41, 0xfe, 0x67, 0x78, 0x3f, 0x06, 0xeb, 0xa2, 0x02, 0xe9, 0xb7, 0x48, 0xfd,
+    0x15, 0xac, 0xa3, 0x9f, 0x42, 0xdc, 0xf5, 0xb7, 0xfc, 0x13, 0x46, 0xbf, 0x04, 0xc9, 0xf1, 0xe5,
+    0x3f, 0xc4, 0x4a, 0x3f, 0xab, 0x7b, 0x08, 0xf9, 0x47, 0x07, 0x04, 0x86, 0x86, 0x7f, 0x7c, 0xbc,
+    0x83, 0x41, 0x4c, 0xf8, 0x47, 0xe8, 0x0c, 0x0a, 0x0c, 0xbe, 0x02, 0x15, 0xc7, 0xdf, 0xa5, 0x26,
+    0x48, 0xf9, 0x05, 0x06, 0x06, 0x8f, 0x08, 0x81, 0x11, 0xa8, 0x81, 0x78, 0x83, 0xc8, 0x91, 0xc8,
+    0x84, 0x29, 0x48, 0x29, 0xc3, 0x01, 0x81, 0x21, 0x21, 0x50, 0x29, 0x53, 0x0f, 0x21, 0x0c, 0xc9,
+    0xc0, 0x8a, 0x20, 0x94, 0xa4, 0xa0, 0x98, 0x35, 0x03, 0xd9, 0x87, 0xf9, 0xaf, 0xda, 0x9d, 0x75,
+    0x21, 0x99, 0x9c, 0xcb, 0x1e, 0x2a, 0xf1, 0xb7, 0x76, 0x49, 0xd1, 0x9d, 0xdb, 0xf6, 0x31, 0x26,
+    0xcb, 0x11, 0x78, 0x8c, 0x0c, 0xb9, 0x7a, 0x4f, 0x2e, 0x59, 0x82, 0x9d, 0xfe, 0xf6, 0x8c, 0xf0,
+    0xcb, 0xac, 0x98, 0xe9, 0x9f, 0x29, 0xc9, 0x09, 0xfe, 0x1b, 0xeb, 0x92, 0x8f, 0x3d, 0xc4, 0x1f,
+    0xda, 0x85, 0x6c, 0xcd, 0x33, 0xf1, 0x6f, 0x3f, 0x03, 0x3d, 0x32, 0x5f, 0x0c, 0x28, 0xc2, 0xd5,
+    0xb8, 0xf2, 0x9d, 0xfa, 0x64, 0x77, 0x0c, 0x31, 0xa9, 0x2f, 0xc4, 0x0e, 0xa5, 0x07, 0x3e, 0x17,
+    0xa8, 0xcd, 0xad, 0xd9, 0x25, 0xf7, 0x42, 0x05, 0xb7, 0xfa, 0xac, 0xa5, 0xf9, 0x86, 0x7b, 0xf3,
+    0x57, 0x88, 0xf8, 0xc8, 0x76, 0x7c, 0xc2, 0x15, 0x36, 0xfe, 0x1e, 0x67, 0x41, 0x1f, 0xbf, 0x63,
+    0xce, 0x6d, 0xf3, 0x27, 0x84, 0xfe, 0xf0, 0x49, 0xbf, 0xee, 0x7c, 0x4f, 0x75, 0x65, 0x71, 0x76,
+    0xb3, 0x40, 0xaf, 0x16, 0xc4, 0x1b, 0xf4, 0x53, 0xf8, 0xc6, 0x5a, 0x9a, 0x11, 0x9a, 0xdc, 0x4a,
+    0x3f, 0x29, 0x33, 0x54, 0x06, 0x06, 0xef, 0x9e, 0x22, 0x9f, 0x7c, 0x62, 0xff, 0x1b, 0x08, 0x3e,
+    0xe1, 0x3f, 0x61, 0xba, 0x32, 0xb5, 0xf3, 0xca, 0x69, 0xe8, 0xd4, 0xd0, 0x1f, 0x6c, 0xaf, 0xd0,
+    0x57, 0xc1, 0xde, 0x66, 0xd9, 0xef, 0x31, 0x8b, 0x1d, 0x63, 0xac, 0x04, 0x88, 0x87, 0xd6, 0x49,
+    0x10, 0x81, 0xca, 0x39, 0xb2, 0x8f, 0xed, 0x3f, 0xb3, 0x27, 0xe8, 0x15, 0xab, 0xfc, 0xb1, 0x43,
+    0x8f, 0x70, 0x77, 0x99, 0xfb, 0xa0, 0x43, 0x41, 0x44, 0x6b, 0x2d, 0x3f, 0xfb, 0xe0, 0x5b, 0xa5,
+    0x7d, 0xe6, 0x28, 0x7b, 0xf8, 0x66, 0x93, 0xfd, 0x13, 0xd3, 0x0c, 0x62, 0xfe, 0x7e, 0xcc, 0x7b,
+    0xea, 0x3a, 0xa8, 0xf1, 0x3b, 0xda, 0xd6, 0xc9, 0x15, 0x9a, 0x59, 0x1f, 0x5b, 0xaa, 0x56, 0xfd,
+    0x63, 0x48, 0xe8, 0xcc, 0x1f, 0x98, 0xe5, 0x8b, 0x08, 0x84, 0x96, 0xb2, 0xd8, 0x04, 0x24, 0xcf,
+    0x9a, 0xf1, 0xb1, 0x3b, 0x9e, 0xf1, 0x55, 0x38, 0x3f, 0xd6, 0x89, 0xd2, 0x18, 0x15, 0x57, 0xcf,
+    0xa1, 0xa4, 0x9d, 0x0b, 0x5b, 0x40, 0xfa, 0xf1, 0x43, 0x1e, 0xe9, 0x6d, 0xa6, 0x79, 0x4f, 0x57,
+    0x79, 0x47, 0x21, 0x8e, 0x40, 0x4a, 0x01, 0x73, 0x37, 0x49, 0x29, 0xc4, 0x8e, 0x25, 0xc5, 0xdd,
+    0x76, 0x1d, 0xfb, 0x83, 0x87, 0x6d, 0xdc, 0x16, 0x7a, 0x79, 0xdb, 0x5a, 0xce, 0x2d, 0xc5, 0x37,
+    0x9a, 0x76, 0x83, 0xb6, 0x81, 0xfb, 0x54, 0x4f, 0xfe, 0xa2, 0x5c, 0x55, 0x1b, 0x35, 0x61, 0x0a,
+    0x54, 0x73, 0x08, 0x3f, 0xc4, 0x38, 0x3e, 0x3d, 0x1c, 0xa6, 0xd4, 0x5f, 0xa0, 0xad, 0x2a, 0x7c,
+    0xac, 0xd4, 0x6b, 0xd7, 0x1f, 0x14, 0xda, 0x64, 0xda, 0xac, 0xa1, 0x1b, 0x01, 0xa8, 0xdf, 0x23,
+    0x17, 0x47, 0x91, 0x7d, 0xca, 0xff, 0x2d, 0xb4, 0x80, 0x12, 0x9b, 0x1f,
 };
+const ShaderModule Blob060 = { Blob060_Data, 1100u, 767u, 60u };
 
-extern const uint32_t Blob098[771];
-const uint32_t Blob098[771] = {
-    0x07230203, 0x00010300, 0x0008000b, 0x0000003d, 0x00000000, 0x00020011, 0x00000001, 0x0006000b,
-    0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001,
-    0x0006000f, 0x00000005, 0x00000004, 0x6e69616d, 0x00000000, 0x00000014, 0x00060010, 0x00000004,
-    0x00000011, 0x00000020, 0x00000001, 0x00000001, 0x00030003, 0x00000002, 0x000001c2, 0x000a0004,
-    0x475f4c47, 0x4c474f4f, 0x70635f45, 0x74735f70, 0x5f656c79, 0x656e696c, 0x7269645f, 0x69746365,
-    0x00006576, 0x00080004, 0x475f4c47, 0x4c474f4f, 0x6e695f45, 0x64756c63, 0x69645f65, 0x74636572,
-    0x00657669, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000, 0x00060005, 0x0000000d, 0x526e6942,
-    0x6c757365, 0x66754274, 0x00726566, 0x00080006, 0x0000000d, 0x00000000, 0x69726156, 0x57746e61,
-    0x436b726f, 0x746e756f, 0x00000000, 0x00080006, 0x0000000d, 0x00000001, 0x74726f53, 0x6f576465,
-    0x664f6b72, 0x74657366, 0x00000000, 0x00090006, 0x0000000d, 0x00000002, 0x69726156, 0x57746e61,
-    0x526b726f, 0x436c6165, 0x746e756f, 0x00000000, 0x00080006, 0x0000000d, 0x00000003, 0x74726f53,
-    0x6b726f57, 0x6b726f57, 0x6e756f43, 0x00000074, 0x00090006, 0x0000000d, 0x00000004, 0x6e6e6942,
-    0x4d676e69, 0x416b7361, 0x664f646e, 0x74657366, 0x00000000, 0x00030005, 0x0000000f, 0x00000000,
-    0x00080005, 0x00000014, 0x475f6c67, 0x61626f6c, 0x766e496c, 0x7461636f, 0x496e6f69, 0x00000044,
-    0x00050005, 0x0000001d, 0x65726353, 0x69576e65, 0x00687464, 0x00060005, 0x0000001e, 0x65726353,
-    0x65486e65, 0x74686769, 0x00000000, 0x00060005, 0x0000001f, 0x5778614d, 0x546b726f, 0x73656c69,
-    0x00000000, 0x00070005, 0x00000023, 0x6d617246, 0x66756265, 0x53726566, 0x64697274, 0x00000065,
-    0x00060005, 0x00000025, 0x656c6954, 0x72655073, 0x656e694c, 0x00000000, 0x00050005, 0x00000026,
-    0x656c6954, 0x656e694c, 0x00000073, 0x00050005, 0x0000002e, 0x6174654d, 0x66696e55, 0x006d726f,
-    0x00060006, 0x0000002e, 0x00000000, 0x506d754e, 0x67796c6f, 0x00736e6f, 0x00060006, 0x0000002e,
-    0x00000001, 0x566d754e, 0x61697261, 0x0073746e, 0x00060006, 0x0000002e, 0x00000002, 0x68706c41,
-    0x66655261, 0x00000000, 0x00050006, 0x0000002e, 0x00000003, 0x70736944, 0x00746e43, 0x00060006,
-    0x0000002e, 0x00000004, 0x6e6f6f54, 0x6c626154, 0x00000065, 0x00060006, 0x0000002e, 0x00000005,
-    0x61656c43, 0x6c6f4372, 0x0000726f, 0x00060006, 0x0000002e, 0x00000006, 0x61656c43, 0x70654472,
-    0x00006874, 0x00060006, 0x0000002e, 0x00000007, 0x61656c43, 0x74744172, 0x00000072, 0x00060006,
-    0x0000002e, 0x00000008, 0x4f676f46, 0x65736666, 0x00000074, 0x00060006, 0x0000002e, 0x00000009,
-    0x53676f46, 0x74666968, 0x00000000, 0x00060006, 0x0000002e, 0x0000000a, 0x43676f46, 0x726f6c6f,
-    0x00000000, 0x00080006, 0x0000002e, 0x0000000b, 0x61656c43, 0x74694272, 0x4f70616d, 0x65736666,
-    0x00000074, 0x00030005, 0x00000030, 0x00000000, 0x00060005, 0x00000031, 0x68737550, 0x736e6f43,
-    0x746e6174, 0x00000073, 0x00060006, 0x00000031, 0x00000000, 0x56727543, 0x61697261, 0x0000746e,
-    0x00060006, 0x00000031, 0x00000001, 0x57786554, 0x68746469, 0x00000000, 0x00060006, 0x00000031,
-    0x00000002, 0x48786554, 0x68676965, 0x00000074, 0x00060006, 0x00000031, 0x00000003, 0x57786554,
-    0x53706172, 0x00000000, 0x00060006, 0x00000031, 0x00000004, 0x57786554, 0x54706172, 0x00000000,
-    0x00070006, 0x00000031, 0x00000005, 0x49786554, 0x70614373, 0x65727574, 0x00000000, 0x00070006,
-    0x00000031, 0x00000006, 0x74706143, 0x59657275, 0x7366664f, 0x00007465, 0x00050006, 0x00000031,
-    0x00000007, 0x6461705f, 0x00000000, 0x00030005, 0x00000033, 0x00006370, 0x00070005, 0x00000037,
-    0x6e6e6942, 0x4d676e69, 0x536b7361, 0x74726174, 0x00000000, 0x00080005, 0x0000003a, 0x6e6e6942,
-    0x57676e69, 0x4f6b726f, 0x65736666, 0x74537374, 0x00747261, 0x00040047, 0x00000009, 0x00000006,
-    0x00000010, 0x00040047, 0x0000000a, 0x00000006, 0x00000004, 0x00040047, 0x0000000b, 0x00000006,
-    0x00000004, 0x00040047, 0x0000000c, 0x00000006, 0x00000004, 0x00050048, 0x0000000d, 0x00000000,
-    0x00000023, 0x00000000, 0x00050048, 0x0000000d, 0x00000001, 0x00000023, 0x00008000, 0x00050048,
-    0x0000000d, 0x00000002, 0x00000023, 0x0000a000, 0x00050048, 0x0000000d, 0x00000003, 0x00000023,
-    0x0000c000, 0x00050048, 0x0000000d, 0x00000004, 0x00000023, 0x0000c010, 0x00030047, 0x0000000d,
-    0x00000002, 0x00040047, 0x0000000f, 0x00000022, 0x00000000, 0x00040047, 0x0000000f, 0x00000021,
-    0x00000008, 0x00040047, 0x00000014, 0x0000000b, 0x0000001c, 0x00040047, 0x0000001d, 0x00000001,
-    0x00000000, 0x00040047, 0x0000001e, 0x00000001, 0x00000001, 0x00040047, 0x0000001f, 0x00000001,
-    0x00000002, 0x00040047, 0x0000002b, 0x00000006, 0x00000010, 0x00050048, 0x0000002e, 0x00000000,
-    0x00000023, 0x00000000, 0x00050048, 0x0000002e, 0x00000001, 0x00000023, 0x00000004, 0x00050048,
-    0x0000002e, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x0000002e, 0x00000003, 0x00000023,
-    0x0000000c, 0x00050048, 0x0000002e, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x0000002e,
-    0x00000005, 0x00000023, 0x00000230, 0x00050048, 0x0000002e, 0x00000006, 0x00000023, 0x00000234,
-    0x00050048, 0x0000002e, 0x00000007, 0x00000023, 0x00000238, 0x00050048, 0x0000002e, 0x00000008,
-    0x00000023, 0x0000023c, 0x00050048, 0x0000002e, 0x00000009, 0x00000023, 0x00000240, 0x00050048,
-    0x0000002e, 0x0000000a, 0x00000023, 0x00000244, 0x00050048, 0x0000002e, 0x0000000b, 0x00000023,
-    0x00000248, 0x00030047, 0x0000002e, 0x00000002, 0x00040047, 0x00000030, 0x00000022, 0x00000000,
-    0x00040047, 0x00000030, 0x00000021, 0x00000000, 0x00050048, 0x00000031, 0x00000000, 0x00000023,
-    0x00000000, 0x00050048, 0x00000031, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x00000031,
-    0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x00000031, 0x00000003, 0x00000023, 0x0000000c,
-    0x00050048, 0x00000031, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x00000031, 0x00000005,
-    0x00000023, 0x00000014, 0x00050048, 0x00000031, 0x00000006, 0x00000023, 0x00000018, 0x00050048,
-    0x00000031, 0x00000007, 0x00000023, 0x0000001c, 0x00030047, 0x00000031, 0x00000002, 0x00040047,
-    0x0000003c, 0x0000000b, 0x00000019, 0x00020013, 0x00000002, 0x00030021, 0x00000003, 0x00000002,
-    0x00040015, 0x00000006, 0x00000020, 0x00000000, 0x00040017, 0x00000007, 0x00000006, 0x00000004,
-    0x0004002b, 0x00000006, 0x00000008, 0x00000800, 0x0004001c, 0x00000009, 0x00000007, 0x00000008,
-    0x0004001c, 0x0000000a, 0x00000006, 0x00000008, 0x0004001c, 0x0000000b, 0x00000006, 0x00000008,
-    0x0003001d, 0x0000000c, 0x00000006, 0x0007001e, 0x0000000d, 0x00000009, 0x0000000a, 0x0000000b,
-    0x00000007, 0x0000000c, 0x00040020, 0x0000000e, 0x0000000c, 0x0000000d, 0x0004003b, 0x0000000e,
-    0x0000000f, 0x0000000c, 0x00040015, 0x00000010, 0x00000020, 0x00000001, 0x0004002b, 0x00000010,
-    0x00000011, 0x00000000, 0x00040017, 0x00000012, 0x00000006, 0x00000003, 0x00040020, 0x00000013,
-    0x00000001, 0x00000012, 0x0004003b, 0x00000013, 0x00000014, 0x00000001, 0x0004002b, 0x00000006,
-    0x00000015, 0x00000000, 0x00040020, 0x00000016, 0x00000001, 0x00000006, 0x0004002b, 0x00000006,
-    0x00000019, 0x00000001, 0x0007002c, 0x00000007, 0x0000001a, 0x00000019, 0x00000019, 0x00000015,
-    0x00000015, 0x00040020, 0x0000001b, 0x0000000c, 0x00000007, 0x00040032, 0x00000010, 0x0000001d,
-    0x00000100, 0x00040032, 0x00000010, 0x0000001e, 0x000000c0, 0x00040032, 0x00000010, 0x0000001f,
-    0x00003000, 0x0004002b, 0x00000010, 0x00000020, 0x00000008, 0x0004002b, 0x00000010, 0x00000021,
-    0x00000100, 0x0004002b, 0x00000010, 0x00000022, 0x000000c0, 0x00060034, 0x00000010, 0x00000023,
-    0x00000084, 0x0000001d, 0x0000001e, 0x0004002b, 0x00000010, 0x00000024, 0x00000020, 0x00060034,
-    0x00000010, 0x00000025, 0x00000087, 0x0000001d, 0x00000024, 0x00060034, 0x00000010, 0x00000026,
-    0x00000087, 0x0000001e, 0x00000024, 0x0004002b, 0x00000010, 0x00000027, 0x00000040, 0x0004002b,
-    0x00000010, 0x00000028, 0x00000002, 0x0004002b, 0x00000010, 0x00000029, 0x00000800, 0x0004002b,
-    0x00000006, 0x0000002a, 0x00000022, 0x0004001c, 0x0000002b, 0x00000007, 0x0000002a, 0x00030016,
-    0x0000002c, 0x00000020, 0x00040017, 0x0000002d, 0x0000002c, 0x00000002, 0x000e001e, 0x0000002e,
-    0x00000006, 0x00000006, 0x00000010, 0x00000006, 0x0000002b, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x0000002d, 0x00040020, 0x0000002f, 0x00000002, 0x0000002e,
-    0x0004003b, 0x0000002f, 0x00000030, 0x00000002, 0x000a001e, 0x00000031, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000010, 0x00000006, 0x00040020, 0x00000032,
-    0x00000009, 0x00000031, 0x0004003b, 0x00000032, 0x00000033, 0x00000009, 0x0004002b, 0x00000006,
-    0x00000034, 0x00008000, 0x00060034, 0x00000010, 0x00000035, 0x00000084, 0x00000025, 0x00000026,
-    0x00060034, 0x00000010, 0x00000036, 0x00000084, 0x00000035, 0x00000028, 0x00060034, 0x00000010,
-    0x00000037, 0x00000080, 0x00000011, 0x00000036, 0x00060034, 0x00000010, 0x00000038, 0x00000084,
-    0x00000025, 0x00000026, 0x00060034, 0x00000010, 0x00000039, 0x00000084, 0x00000038, 0x00000027,
-    0x00060034, 0x00000010, 0x0000003a, 0x00000080, 0x00000037, 0x00000039, 0x0004002b, 0x00000006,
-    0x0000003b, 0x00000020, 0x0006002c, 0x00000012, 0x0000003c, 0x0000003b, 0x00000019, 0x00000019,
-    0x00050036, 0x00000002, 0x00000004, 0x00000000, 0x00000003, 0x000200f8, 0x00000005, 0x00050041,
-    0x00000016, 0x00000017, 0x00000014, 0x00000015, 0x0004003d, 0x00000006, 0x00000018, 0x00000017,
-    0x00060041, 0x0000001b, 0x0000001c, 0x0000000f, 0x00000011, 0x00000018, 0x0003003e, 0x0000001c,
-    0x0000001a, 0x000100fd, 0x00010038,
+const uint8_t Blob098_Data[1106] =
+{
+    0x28, 0xb5, 0x2f, 0xfd, 0x60, 0x0c, 0x0b, 0x45, 0x22, 0x00, 0x66, 0xf9, 0xa4, 0x3a, 0x20, 0x75,
+    0xb3, 0x06, 0xa0, 0x1a, 0x00, 0x18, 0x00, 0x18, 0xa0, 0x60, 0x00, 0x60, 0x40, 0xc0, 0x00, 0x50,
+    0x26, 0xa0, 0x0b, 0xdb, 0x7b, 0xf6, 0x36, 0x6e, 0xab, 0x26, 0xda, 0x65, 0xc3, 0x3e, 0x4e, 0x66,
+    0x7c, 0x8d, 0x2c, 0x0c, 0xf3, 0x7b, 0x1a, 0x5b, 0x16, 0xc0, 0xff, 0x6b, 0x59, 0x12, 0xcc, 0xef,
+    0x19, 0xa5, 0xc5, 0xee, 0xee, 0xee, 0xde, 0x29, 0x95, 0x00, 0x9c, 0x00, 0x96, 0x00, 0x13, 0xfc,
+    0x1d, 0xd6, 0x52, 0x57, 0x10, 0x6b, 0xda, 0x00, 0xa5, 0x67, 0x0a, 0x7e, 0xa8, 0x79, 0x75, 0x3c,
+    0x80, 0xcb, 0xda, 0x6c, 0x38, 0xb5, 0xdb, 0xae, 0x6a, 0xec, 0xbf, 0x4d, 0x73, 0xea, 0x2b, 0x68,
+    0x55, 0x7b, 0xda, 0xd4, 0x3c, 0x57, 0x93, 0xe7, 0x9f, 0x5c, 0x7c, 0xbd, 0x36, 0x5b, 0xee, 0xa5,
+    0x45, 0x73, 0xec, 0xd5, 0x49, 0xcf, 0x97, 0x5f, 0x60, 0xf1, 0x10, 0x3c, 0xac, 0xe5, 0x50, 0x5a,
+    0x7a, 0x92, 0x77, 0xe8, 0x6c, 0x69, 0x77, 0x3d, 0x6b, 0xb3, 0x9b, 0x9e, 0xe8, 0xec, 0xa2, 0x45,
+    0x2d, 0x3b, 0xc3, 0xe1, 0x68, 0xb3, 0x98, 0x1a, 0x18, 0x0e, 0x0e, 0x6c, 0x76, 0x1a, 0xfc, 0x6e,
+    0xe9, 0xf7, 0xfe, 0xfe, 0xbe, 0xfb, 0x57, 0x0f, 0x2e, 0x5e, 0xf0, 0x27, 0xfc, 0xa7, 0xa7, 0x29,
+    0xf4, 0x83, 0x7f, 0xb8, 0x38, 0xc1, 0xff, 0xf7, 0xc0, 0x7f, 0x8b, 0x64, 0x84, 0x55, 0x6b, 0x59,
+    0x56, 0x4d, 0xac, 0x06, 0x26, 0x8e, 0xfa, 0xbb, 0xbd, 0x0d, 0x66, 0x99, 0x1c, 0x75, 0xf7, 0x3d,
+    0x56, 0x78, 0x5f, 0x5f, 0x2e, 0xb6, 0xc6, 0x99, 0x42, 0xed, 0xf9, 0x82, 0x22, 0x4f, 0xb7, 0xb6,
+    0xf3, 0x16, 0x03, 0x00, 0x52, 0x65, 0x7e, 0xf2, 0xb5, 0x6d, 0x5d, 0xe3, 0xad, 0xc5, 0x5d, 0x18,
+    0x71, 0x55, 0x51, 0xf5, 0xb5, 0x9a, 0x17, 0x7d, 0xfd, 0xe1, 0xff, 0x45, 0x7f, 0x4c, 0x59, 0xaa,
+    0xaa, 0xb2, 0xdb, 0xf4, 0x85, 0x63, 0x4f, 0x98, 0xff, 0x13, 0xff, 0x6d, 0x57, 0xc7, 0xbc, 0xe1,
+    0x50, 0xd7, 0xef, 0xdd, 0xcd, 0xa6, 0x2a, 0x50, 0x11, 0xaa, 0xe6, 0x08, 0xe5, 0x6e, 0xfe, 0xc5,
+    0xc5, 0x85, 0x56, 0xd5, 0x76, 0xa6, 0x3b, 0x66, 0x7b, 0x59, 0x2c, 0xc6, 0x37, 0x3d, 0x6b, 0xd6,
+    0x9b, 0xf3, 0x5f, 0xdc, 0xda, 0xb9, 0xb6, 0xb1, 0x9f, 0x2b, 0x64, 0xae, 0x32, 0x7f, 0xc5, 0x23,
+    0x7b, 0xd1, 0x53, 0x46, 0x64, 0xda, 0xfc, 0x12, 0xb7, 0x37, 0xa0, 0xf3, 0xce, 0xa8, 0x6e, 0x6d,
+    0xed, 0xec, 0x49, 0xef, 0x5d, 0x69, 0xb1, 0x3f, 0xe2, 0xf0, 0xf0, 0x87, 0xa1, 0x49, 0xd5, 0xb3,
+    0x35, 0x69, 0xea, 0x50, 0x4a, 0x83, 0x9a, 0x3f, 0x2a, 0x0a, 0x9b, 0xa1, 0x40, 0xe4, 0x1f, 0x2a,
+    0xbf, 0xc0, 0xc0, 0xe0, 0xab, 0xf1, 0x24, 0xf0, 0xb8, 0xea, 0xef, 0x88, 0xd4, 0x98, 0x7a, 0xb2,
+    0x63, 0x1c, 0x9c, 0x61, 0xf5, 0x8b, 0x0a, 0xdf, 0x9f, 0xb7, 0x37, 0xc2, 0xef, 0xb0, 0x52, 0xfe,
+    0xdd, 0xf0, 0x09, 0x65, 0x59, 0x96, 0x65, 0x79, 0xab, 0xc5, 0xda, 0x9b, 0x41, 0xc1, 0x9c, 0x5c,
+    0x00, 0x56, 0xc8, 0x93, 0x71, 0x44, 0xf4, 0x5a, 0x61, 0xc0, 0x93, 0x0f, 0xb2, 0x58, 0x1d, 0x9e,
+    0x44, 0xa7, 0x3a, 0x22, 0x95, 0x40, 0xfe, 0x13, 0xff, 0x14, 0x3f, 0x81, 0xf7, 0x0d, 0x2b, 0x00,
+    0x95, 0xbe, 0x24, 0xcf, 0xa8, 0xfb, 0xaf, 0x08, 0x9f, 0x09, 0x40, 0x81, 0xa7, 0x2f, 0x00, 0x18,
+    0x1c, 0xc6, 0xa6, 0xdc, 0xae, 0x66, 0x1b, 0xfb, 0x4d, 0xa6, 0xe1, 0x7e, 0x91, 0x6b, 0x26, 0x6e,
+    0x56, 0xfa, 0xfc, 0xe2, 0x77, 0xcd, 0xb5, 0x38, 0xf3, 0xc5, 0xd2, 0x84, 0xa3, 0x0c, 0x3c, 0x86,
+    0x33, 0xd7, 0xcf, 0x9b, 0xe8, 0xca, 0xfe, 0x6e, 0xcd, 0xbd, 0xfe, 0xc5, 0x6f, 0xd9, 0x54, 0x7d,
+    0xdd, 0xd8, 0x5c, 0xce, 0x01, 0x77, 0x9f, 0xdc, 0xdd, 0x94, 0xfa, 0xbb, 0xc5, 0x20, 0xf5, 0x43,
+    0x2c, 0xee, 0x6a, 0x60, 0xf9, 0x15, 0x18, 0xfe, 0x85, 0xc3, 0x5d, 0x7f, 0xb8, 0x37, 0xd3, 0xde,
+    0xe1, 0x25, 0x0e, 0x2b, 0xff, 0x81, 0x87, 0x8a, 0x49, 0x4a, 0xc6, 0x7f, 0x82, 0x72, 0x52, 0x62,
+    0xf4, 0x9b, 0x68, 0xfc, 0x24, 0x25, 0x17, 0x24, 0x46, 0xff, 0x23, 0x22, 0x97, 0x21, 0x5f, 0x7e,
+    0xba, 0xa5, 0xf2, 0xb3, 0x40, 0x3e, 0xc4, 0xff, 0x01, 0xef, 0x3f, 0x56, 0xbf, 0xc7, 0xdf, 0x0b,
+    0x63, 0x8a, 0x83, 0xfc, 0xdf, 0xf0, 0x7e, 0x0d, 0x97, 0x3f, 0x43, 0x85, 0x61, 0x81, 0xf4, 0x5f,
+    0xac, 0x7e, 0x0b, 0xd5, 0xd1, 0x5f, 0x21, 0x3e, 0x42, 0xd1, 0x4d, 0x90, 0x1d, 0xdf, 0xfa, 0x97,
+    0x58, 0xe9, 0x57, 0x75, 0x11, 0x21, 0xff, 0x08, 0xa1, 0xe0, 0xf0, 0xf0, 0x8f, 0x8f, 0x7b, 0x38,
+    0x88, 0x0b, 0xff, 0x0a, 0x1d, 0xc2, 0x01, 0xc2, 0x77, 0x60, 0xd0, 0xf1, 0x77, 0x05, 0x13, 0x04,
+    0x81, 0x0d, 0xa8, 0x71, 0x78, 0x82, 0x08, 0x22, 0x91, 0x09, 0x52, 0x90, 0x94, 0x24, 0x1d, 0x81,
+    0x21, 0x21, 0x50, 0x31, 0x3b, 0x0f, 0x21, 0x0c, 0xc9, 0xd8, 0x48, 0x10, 0x25, 0x29, 0x0c, 0x73,
+    0x13, 0xd9, 0x07, 0xfc, 0x58, 0xdd, 0x83, 0x75, 0x6e, 0xa4, 0xfc, 0x98, 0xf9, 0x5c, 0x7d, 0x85,
+    0xc3, 0x81, 0x71, 0x6c, 0xd6, 0x23, 0xe8, 0x08, 0x38, 0xe4, 0x7d, 0x79, 0xe9, 0x58, 0xd5, 0xed,
+    0x00, 0xb6, 0xd2, 0x90, 0xb8, 0xeb, 0xf9, 0x9b, 0xf9, 0xfd, 0x62, 0x70, 0x69, 0x8c, 0x15, 0xe4,
+    0x23, 0xf2, 0xe5, 0xad, 0x1a, 0x33, 0x8a, 0x4d, 0xd9, 0xec, 0x43, 0x79, 0x9b, 0xe4, 0x5e, 0xdf,
+    0x43, 0xd9, 0xa3, 0xf2, 0x3e, 0xe1, 0xa6, 0x72, 0xac, 0x18, 0x5d, 0x2e, 0x6c, 0x89, 0xf2, 0x07,
+    0xc7, 0x93, 0x50, 0x3f, 0x27, 0xb8, 0x07, 0x06, 0xe6, 0x1a, 0x81, 0x5c, 0xcd, 0x76, 0x63, 0x15,
+    0xf8, 0x0c, 0x09, 0x79, 0x9a, 0x5c, 0x7d, 0xe5, 0xa3, 0x1b, 0xe4, 0xde, 0x4f, 0x64, 0xc5, 0xce,
+    0x5f, 0x74, 0x36, 0x0c, 0xe3, 0x96, 0xe6, 0xd0, 0x6d, 0x7a, 0x6a, 0x21, 0x5f, 0x99, 0xf4, 0x72,
+    0xb7, 0x2d, 0x96, 0x56, 0xe8, 0x0b, 0x1f, 0x1b, 0xbe, 0x5a, 0x98, 0x6c, 0xb0, 0x4f, 0x7b, 0x37,
+    0xf0, 0x8b, 0x9d, 0x09, 0xfd, 0xe4, 0x9f, 0xea, 0x10, 0x95, 0x81, 0xf6, 0xbb, 0xa7, 0x84, 0x06,
+    0x7f, 0xd7, 0xe3, 0x0d, 0xa4, 0x27, 0xf8, 0x6f, 0x37, 0x00, 0xd6, 0xed, 0xf9, 0x4d, 0xab, 0x50,
+    0x55, 0x45, 0xfd, 0xe1, 0xee, 0x5a, 0x99, 0xf4, 0xe1, 0xdb, 0x82, 0x0e, 0x46, 0x89, 0xf7, 0x61,
+    0x56, 0x92, 0xad, 0x07, 0x51, 0x0b, 0x8d, 0x05, 0xcf, 0xc7, 0x79, 0x62, 0x1a, 0xaf, 0x7e, 0x5a,
+    0x99, 0x90, 0x45, 0xc3, 0xd0, 0x07, 0x07, 0x33, 0x42, 0x7c, 0x63, 0x0e, 0x06, 0x96, 0x04, 0xd0,
+    0x48, 0xac, 0x88, 0x9d, 0x8c, 0xe6, 0x16, 0x73, 0x2c, 0xd0, 0x36, 0x23, 0x51, 0x9d, 0xa5, 0x5d,
+    0x4d, 0x06, 0x39, 0xc4, 0x0f, 0xbf, 0xf9, 0x1e, 0xd9, 0x1e, 0xcc, 0xf8, 0x1d, 0xdd, 0x75, 0x74,
+    0xd5, 0xde, 0xec, 0x84, 0xc5, 0xd4, 0x18, 0xbf, 0x12, 0x24, 0x14, 0x02, 0xd9, 0xa7, 0x73, 0x0e,
+    0x04, 0x7e, 0x23, 0x09, 0x3f, 0x02, 0x68, 0x0f, 0x98, 0x11, 0xb3, 0x41, 0x26, 0x43, 0xdb, 0x6d,
+    0x5e, 0xf8, 0x74, 0x7e, 0x74, 0x63, 0x2b, 0xe7, 0x5f, 0x22, 0x21, 0x93, 0x88, 0x25, 0x1d, 0x4b,
+    0xd2, 0x25, 0xa3, 0x58, 0x98, 0xd4, 0x3d, 0x19, 0x61, 0xa4, 0xdf, 0x39, 0x17, 0x29, 0x31, 0xcb,
+    0x9d, 0x36, 0x01, 0x36, 0xea, 0x5f, 0x1d, 0xbf, 0xb0, 0xd8, 0x49, 0x11, 0x9c, 0x7d, 0xe7, 0xe5,
+    0x8b, 0x58, 0x6f, 0x64, 0xc7, 0x12, 0xb1, 0xd1, 0xef, 0x37, 0x0f, 0x1b, 0x40, 0x9d, 0x92, 0xb2,
+    0x5f, 0x39, 0xd7, 0x82, 0x46, 0xa1, 0x38, 0x18, 0xfd, 0x02, 0x72, 0x5b, 0x70, 0x07, 0xfd, 0x07,
+    0x52, 0x68, 0x9a, 0x21, 0x6a, 0x2b, 0x9e, 0x1d, 0xc8, 0xf4, 0x9d, 0x40, 0x03, 0xf6, 0x2f, 0xc1,
+    0x59, 0x9c, 0x0c, 0x5f, 0xd5, 0x2f, 0xcc, 0xe7, 0xec, 0xc9, 0xfc, 0x7f, 0x49, 0x17, 0x24, 0x02,
+    0x40, 0x03,
 };
+const ShaderModule Blob098 = { Blob098_Data, 1106u, 771u, 98u };
 
 } // namespace detail
 } // namespace VulkanShaders
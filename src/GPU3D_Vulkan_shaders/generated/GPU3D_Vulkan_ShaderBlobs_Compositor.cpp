@@ -28,13 +28,12 @@
     Pipeline indices match ComputeRenderer3D::ShaderCompileStep() in
     src/GPU3D_Compute.cpp one for one.
 
-    The SPIR-V words live in per-stage translation units rather than in the
-    header so that including the public header stays cheap: the full module set
-    is a few megabytes of integer literals and would otherwise be re-parsed by
-    every consumer.
+    Every module is one zstd frame, inflated on first use by
+    Vk::InflateShaderModule(). The frames live in per-stage translation units
+    rather than in the header so that including the public header stays cheap.
 */
 
-// SPIR-V for src/GPU3D_Vulkan_shaders/Compositor.comp.
+// SPIR-V for src/GPU3D_Vulkan_shaders/Compositor.comp, one zstd frame per module.
 
 #include "GPU3D_Vulkan_ShaderBlobs.h"
 
@@ -45,2069 +44,1069 @@ namespace VulkanShaders
 namespace detail
 {
 
-extern const uint32_t Blob035[5466];
-const uint32_t Blob035[5466] = {
-    0x07230203, 0x00010300, 0x0008000b, 0x0000036a, 0x00000000, 0x00020011, 0x00000001, 0x0006000b,
-    0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001,
-    0x0006000f, 0x00000005, 0x00000004, 0x6e69616d, 0x00000000, 0x000001c9, 0x00060010, 0x00000004,
-    0x00000011, 0x00000008, 0x00000008, 0x00000001, 0x00030003, 0x00000002, 0x000001c2, 0x000a0004,
-    0x475f4c47, 0x4c474f4f, 0x70635f45, 0x74735f70, 0x5f656c79, 0x656e696c, 0x7269645f, 0x69746365,
-    0x00006576, 0x00080004, 0x475f4c47, 0x4c474f4f, 0x6e695f45, 0x64756c63, 0x69645f65, 0x74636572,
-    0x00657669, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000, 0x00070005, 0x0000000a, 0x726f6e55,
-    0x6f54386d, 0x36626752, 0x3b317528, 0x00000000, 0x00040005, 0x00000009, 0x756c6176, 0x00000065,
-    0x00070005, 0x0000000d, 0x726f6e55, 0x6f54386d, 0x68706c41, 0x75283561, 0x00003b31, 0x00040005,
-    0x0000000c, 0x756c6176, 0x00000065, 0x00070005, 0x00000014, 0x64616f4c, 0x616e6946, 0x2842466c,
-    0x3b326976, 0x00000000, 0x00050005, 0x00000013, 0x69736f70, 0x6e6f6974, 0x00000000, 0x00050005,
-    0x00000017, 0x6f6c6f43, 0x28523672, 0x003b3175, 0x00040005, 0x00000016, 0x6f6c6f63, 0x00000072,
-    0x00050005, 0x0000001a, 0x6f6c6f43, 0x28473672, 0x003b3175, 0x00040005, 0x00000019, 0x6f6c6f63,
-    0x00000072, 0x00050005, 0x0000001d, 0x6f6c6f43, 0x28423672, 0x003b3175, 0x00040005, 0x0000001c,
-    0x6f6c6f63, 0x00000072, 0x00080005, 0x00000024, 0x6b636150, 0x6f6c6f43, 0x75283672, 0x31753b31,
-    0x3b31753b, 0x003b3175, 0x00030005, 0x00000020, 0x00000072, 0x00030005, 0x00000021, 0x00000067,
-    0x00030005, 0x00000022, 0x00000062, 0x00040005, 0x00000023, 0x68706c61, 0x00000061, 0x00070005,
-    0x0000002a, 0x6e656c42, 0x75283464, 0x31753b31, 0x3b31753b, 0x003b3175, 0x00040005, 0x00000026,
-    0x73726966, 0x00000074, 0x00040005, 0x00000027, 0x6f636573, 0x0000646e, 0x00030005, 0x00000028,
-    0x00617665, 0x00030005, 0x00000029, 0x00627665, 0x00060005, 0x0000002f, 0x6e656c42, 0x75283564,
-    0x31753b31, 0x0000003b, 0x00040005, 0x0000002d, 0x73726966, 0x00000074, 0x00040005, 0x0000002e,
-    0x6f636573, 0x0000646e, 0x00080005, 0x00000035, 0x67697242, 0x656e7468, 0x70557373, 0x3b317528,
-    0x753b3175, 0x00003b31, 0x00040005, 0x00000032, 0x6f6c6f63, 0x00000072, 0x00040005, 0x00000033,
-    0x74636166, 0x0000726f, 0x00040005, 0x00000034, 0x73616962, 0x00000000, 0x00090005, 0x0000003a,
-    0x67697242, 0x656e7468, 0x6f447373, 0x75286e77, 0x31753b31, 0x3b31753b, 0x00000000, 0x00040005,
-    0x00000037, 0x6f6c6f63, 0x00000072, 0x00040005, 0x00000038, 0x74636166, 0x0000726f, 0x00040005,
-    0x00000039, 0x73616962, 0x00000000, 0x00050005, 0x0000003d, 0x67426f54, 0x28386172, 0x003b3175,
-    0x00040005, 0x0000003c, 0x6f6c6f63, 0x00000072, 0x00090005, 0x00000044, 0x64616f4c, 0x74706143,
-    0x53657275, 0x63656469, 0x75287261, 0x75763b31, 0x00003b32, 0x00050005, 0x00000042, 0x65666572,
-    0x636e6572, 0x00000065, 0x00070005, 0x00000043, 0x6c616373, 0x69576465, 0x6e696874, 0x65786950,
-    0x0000006c, 0x00040005, 0x00000059, 0x65786574, 0x0000006c, 0x00040005, 0x0000005c, 0x616e6946,
-    0x0042466c, 0x00050005, 0x00000062, 0x6e617571, 0x657a6974, 0x00000064, 0x00040005, 0x00000068,
-    0x61726170, 0x0000006d, 0x00040005, 0x0000006d, 0x61726170, 0x0000006d, 0x00040005, 0x00000075,
-    0x61726170, 0x0000006d, 0x00040005, 0x0000007d, 0x61726170, 0x0000006d, 0x00040005, 0x000000a4,
-    0x61726170, 0x0000006d, 0x00040005, 0x000000a9, 0x61726170, 0x0000006d, 0x00040005, 0x000000b3,
-    0x61726170, 0x0000006d, 0x00040005, 0x000000b8, 0x61726170, 0x0000006d, 0x00040005, 0x000000c0,
-    0x61726170, 0x0000006d, 0x00040005, 0x000000c5, 0x61726170, 0x0000006d, 0x00040005, 0x000000cd,
-    0x61726170, 0x0000006d, 0x00040005, 0x000000ce, 0x61726170, 0x0000006d, 0x00040005, 0x000000cf,
-    0x61726170, 0x0000006d, 0x00040005, 0x000000d0, 0x61726170, 0x0000006d, 0x00030005, 0x000000d4,
-    0x00617665, 0x00030005, 0x000000d9, 0x00627665, 0x00040005, 0x000000dd, 0x61726170, 0x0000006d,
-    0x00040005, 0x000000e2, 0x61726170, 0x0000006d, 0x00040005, 0x000000ec, 0x61726170, 0x0000006d,
-    0x00040005, 0x000000f1, 0x61726170, 0x0000006d, 0x00040005, 0x000000f9, 0x61726170, 0x0000006d,
-    0x00040005, 0x000000fe, 0x61726170, 0x0000006d, 0x00040005, 0x00000106, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000107, 0x61726170, 0x0000006d, 0x00040005, 0x00000108, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000109, 0x61726170, 0x0000006d, 0x00040005, 0x0000010d, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000110, 0x61726170, 0x0000006d, 0x00040005, 0x0000011a, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000011d, 0x61726170, 0x0000006d, 0x00040005, 0x00000127, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000012a, 0x61726170, 0x0000006d, 0x00040005, 0x00000134, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000135, 0x61726170, 0x0000006d, 0x00040005, 0x00000136, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000137, 0x61726170, 0x0000006d, 0x00040005, 0x0000013b, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000013e, 0x61726170, 0x0000006d, 0x00040005, 0x00000147, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000014a, 0x61726170, 0x0000006d, 0x00040005, 0x00000153, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000156, 0x61726170, 0x0000006d, 0x00040005, 0x0000015f, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000160, 0x61726170, 0x0000006d, 0x00040005, 0x00000161, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000162, 0x61726170, 0x0000006d, 0x00030005, 0x00000166, 0x00003672, 0x00040005,
-    0x00000167, 0x61726170, 0x0000006d, 0x00030005, 0x0000016a, 0x00003667, 0x00040005, 0x0000016b,
-    0x61726170, 0x0000006d, 0x00030005, 0x0000016e, 0x00003662, 0x00040005, 0x0000016f, 0x61726170,
-    0x0000006d, 0x00030005, 0x00000172, 0x00003872, 0x00030005, 0x00000179, 0x00003867, 0x00030005,
-    0x0000017f, 0x00003862, 0x00040005, 0x00000190, 0x72646461, 0x00737365, 0x00040005, 0x00000194,
-    0x6b6e6162, 0x00000000, 0x00040005, 0x00000199, 0x73726576, 0x006e6f69, 0x00060005, 0x0000019e,
-    0x706d6173, 0x5073656c, 0x69507265, 0x006c6578, 0x00050005, 0x0000019f, 0x65726353, 0x69576e65,
-    0x00687464, 0x00050005, 0x000001a1, 0x6c616353, 0x63614665, 0x00726f74, 0x00040005, 0x000001a5,
-    0x6c6c6563, 0x00000000, 0x00050005, 0x000001af, 0x706d6173, 0x6e49656c, 0x00786564, 0x00080005,
-    0x000001b8, 0x74706143, 0x53657275, 0x63656469, 0x75427261, 0x72656666, 0x00000000, 0x00090006,
-    0x000001b8, 0x00000000, 0x74706143, 0x53657275, 0x63656469, 0x69507261, 0x736c6578, 0x00000000,
-    0x00030005, 0x000001ba, 0x00000000, 0x00030005, 0x000001c6, 0x00006469, 0x00080005, 0x000001c9,
-    0x475f6c67, 0x61626f6c, 0x766e496c, 0x7461636f, 0x496e6f69, 0x00000044, 0x00060005, 0x000001d6,
-    0x65726353, 0x65486e65, 0x74686769, 0x00000000, 0x00040005, 0x000001de, 0x65726373, 0x00006e65,
-    0x00040005, 0x000001e3, 0x6c616373, 0x00596465, 0x00040005, 0x000001ea, 0x6974616e, 0x00586576,
-    0x00040005, 0x000001ef, 0x6974616e, 0x00596576, 0x00050005, 0x000001f3, 0x6974616e, 0x6e496576,
-    0x00786564, 0x00050005, 0x000001f9, 0x6e616c70, 0x73614265, 0x00000065, 0x00040005, 0x000001fd,
-    0x6f6c6562, 0x00000077, 0x00080005, 0x000001ff, 0x75727453, 0x72757463, 0x6e496465, 0x42747570,
-    0x65666675, 0x00000072, 0x00070006, 0x000001ff, 0x00000000, 0x75727453, 0x72757463, 0x6e496465,
-    0x00747570, 0x00030005, 0x00000201, 0x00000000, 0x00040005, 0x00000207, 0x766f6261, 0x00000065,
-    0x00040005, 0x0000020f, 0x746e6f63, 0x006c6f72, 0x00070005, 0x00000217, 0x74706163, 0x52657275,
-    0x72656665, 0x65636e65, 0x00000000, 0x00060005, 0x0000021f, 0x746e6f63, 0x466c6f72, 0x7367616c,
-    0x00000000, 0x00050005, 0x00000223, 0x656e696c, 0x6174654d, 0x00000000, 0x00050005, 0x0000022d,
-    0x70736964, 0x4d79616c, 0x0065646f, 0x00040005, 0x00000231, 0x6f6c6f63, 0x00000072, 0x00040005,
-    0x0000024e, 0x61726170, 0x0000006d, 0x00040005, 0x00000250, 0x61726170, 0x0000006d, 0x00050005,
-    0x00000258, 0x736f5078, 0x6f697469, 0x0000006e, 0x00040005, 0x0000025f, 0x72756f73, 0x00586563,
-    0x00040005, 0x0000027a, 0x65786970, 0x0044336c, 0x00040005, 0x00000288, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000028a, 0x61726170, 0x0000006d, 0x00060005, 0x0000028d, 0x68737550, 0x736e6f43,
-    0x746e6174, 0x00000073, 0x00060006, 0x0000028d, 0x00000000, 0x56727543, 0x61697261, 0x0000746e,
-    0x00060006, 0x0000028d, 0x00000001, 0x57786554, 0x68746469, 0x00000000, 0x00060006, 0x0000028d,
-    0x00000002, 0x48786554, 0x68676965, 0x00000074, 0x00060006, 0x0000028d, 0x00000003, 0x57786554,
-    0x53706172, 0x00000000, 0x00060006, 0x0000028d, 0x00000004, 0x57786554, 0x54706172, 0x00000000,
-    0x00070006, 0x0000028d, 0x00000005, 0x49786554, 0x70614373, 0x65727574, 0x00000000, 0x00070006,
-    0x0000028d, 0x00000006, 0x74706143, 0x59657275, 0x7366664f, 0x00007465, 0x00050006, 0x0000028d,
-    0x00000007, 0x6461705f, 0x00000000, 0x00030005, 0x0000028f, 0x00006370, 0x00040005, 0x000002a1,
-    0x61726170, 0x0000006d, 0x00060005, 0x000002a9, 0x706d6f63, 0x7469736f, 0x4d6e6f69, 0x0065646f,
-    0x00030005, 0x000002ad, 0x00617665, 0x00030005, 0x000002b1, 0x00627665, 0x00040005, 0x000002c0,
-    0x61726170, 0x0000006d, 0x00040005, 0x000002c2, 0x61726170, 0x0000006d, 0x00040005, 0x000002c4,
-    0x61726170, 0x0000006d, 0x00040005, 0x000002c6, 0x61726170, 0x0000006d, 0x00040005, 0x000002ce,
-    0x61726170, 0x0000006d, 0x00040005, 0x000002d0, 0x61726170, 0x0000006d, 0x00040005, 0x000002d2,
-    0x61726170, 0x0000006d, 0x00040005, 0x000002da, 0x61726170, 0x0000006d, 0x00040005, 0x000002dc,
-    0x61726170, 0x0000006d, 0x00040005, 0x000002de, 0x61726170, 0x0000006d, 0x00040005, 0x000002e5,
-    0x61726170, 0x0000006d, 0x00040005, 0x000002e7, 0x61726170, 0x0000006d, 0x00060005, 0x000002f0,
-    0x67697262, 0x656e7468, 0x6f4d7373, 0x00006564, 0x00070005, 0x000002f4, 0x67697262, 0x656e7468,
-    0x61467373, 0x726f7463, 0x00000000, 0x00040005, 0x000002fc, 0x61726170, 0x0000006d, 0x00040005,
-    0x000002fe, 0x61726170, 0x0000006d, 0x00040005, 0x00000300, 0x61726170, 0x0000006d, 0x00040005,
-    0x00000307, 0x61726170, 0x0000006d, 0x00040005, 0x00000309, 0x61726170, 0x0000006d, 0x00040005,
-    0x0000030b, 0x61726170, 0x0000006d, 0x00040005, 0x0000030d, 0x61726762, 0x00000038, 0x00040005,
-    0x0000030e, 0x61726170, 0x0000006d, 0x00040005, 0x00000317, 0x61626772, 0x00000038, 0x00060005,
-    0x00000330, 0x65726944, 0x754f7463, 0x74757074, 0x00706f54, 0x00070005, 0x0000033a, 0x65726944,
-    0x754f7463, 0x74757074, 0x74746f42, 0x00006d6f, 0x00090005, 0x00000345, 0x73657250, 0x61746e65,
-    0x6e6f6974, 0x7074754f, 0x75427475, 0x72656666, 0x00000000, 0x00080006, 0x00000345, 0x00000000,
-    0x73657250, 0x61746e65, 0x6e6f6974, 0x7074754f, 0x00007475, 0x00030005, 0x00000347, 0x00000000,
-    0x00070005, 0x00000349, 0x6d617246, 0x66756265, 0x53726566, 0x64697274, 0x00000065, 0x00060005,
-    0x00000355, 0x5778614d, 0x546b726f, 0x73656c69, 0x00000000, 0x00060005, 0x00000358, 0x656c6954,
-    0x72655073, 0x656e694c, 0x00000000, 0x00050005, 0x00000359, 0x656c6954, 0x656e694c, 0x00000073,
-    0x00050005, 0x0000035e, 0x6174654d, 0x66696e55, 0x006d726f, 0x00060006, 0x0000035e, 0x00000000,
-    0x506d754e, 0x67796c6f, 0x00736e6f, 0x00060006, 0x0000035e, 0x00000001, 0x566d754e, 0x61697261,
-    0x0073746e, 0x00060006, 0x0000035e, 0x00000002, 0x68706c41, 0x66655261, 0x00000000, 0x00050006,
-    0x0000035e, 0x00000003, 0x70736944, 0x00746e43, 0x00060006, 0x0000035e, 0x00000004, 0x6e6f6f54,
-    0x6c626154, 0x00000065, 0x00060006, 0x0000035e, 0x00000005, 0x61656c43, 0x6c6f4372, 0x0000726f,
-    0x00060006, 0x0000035e, 0x00000006, 0x61656c43, 0x70654472, 0x00006874, 0x00060006, 0x0000035e,
-    0x00000007, 0x61656c43, 0x74744172, 0x00000072, 0x00060006, 0x0000035e, 0x00000008, 0x4f676f46,
-    0x65736666, 0x00000074, 0x00060006, 0x0000035e, 0x00000009, 0x53676f46, 0x74666968, 0x00000000,
-    0x00060006, 0x0000035e, 0x0000000a, 0x43676f46, 0x726f6c6f, 0x00000000, 0x00080006, 0x0000035e,
-    0x0000000b, 0x61656c43, 0x74694272, 0x4f70616d, 0x65736666, 0x00000074, 0x00030005, 0x00000360,
-    0x00000000, 0x00040047, 0x0000005c, 0x00000022, 0x00000000, 0x00040047, 0x0000005c, 0x00000021,
-    0x0000000b, 0x00030047, 0x0000005c, 0x00000018, 0x00040047, 0x0000019f, 0x00000001, 0x00000000,
-    0x00040047, 0x000001b7, 0x00000006, 0x00000004, 0x00050048, 0x000001b8, 0x00000000, 0x00000023,
-    0x00000000, 0x00030047, 0x000001b8, 0x00000002, 0x00040047, 0x000001ba, 0x00000022, 0x00000000,
-    0x00040047, 0x000001ba, 0x00000021, 0x0000000e, 0x00040047, 0x000001c9, 0x0000000b, 0x0000001c,
-    0x00040047, 0x000001d6, 0x00000001, 0x00000001, 0x00040047, 0x000001fe, 0x00000006, 0x00000004,
-    0x00040048, 0x000001ff, 0x00000000, 0x00000018, 0x00050048, 0x000001ff, 0x00000000, 0x00000023,
-    0x00000000, 0x00030047, 0x000001ff, 0x00000002, 0x00040047, 0x00000201, 0x00000022, 0x00000000,
-    0x00040047, 0x00000201, 0x00000021, 0x0000000c, 0x00050048, 0x0000028d, 0x00000000, 0x00000023,
-    0x00000000, 0x00050048, 0x0000028d, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x0000028d,
-    0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x0000028d, 0x00000003, 0x00000023, 0x0000000c,
-    0x00050048, 0x0000028d, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x0000028d, 0x00000005,
-    0x00000023, 0x00000014, 0x00050048, 0x0000028d, 0x00000006, 0x00000023, 0x00000018, 0x00050048,
-    0x0000028d, 0x00000007, 0x00000023, 0x0000001c, 0x00030047, 0x0000028d, 0x00000002, 0x00040047,
-    0x00000330, 0x00000022, 0x00000000, 0x00040047, 0x00000330, 0x00000021, 0x00000011, 0x00030047,
-    0x00000330, 0x00000019, 0x00040047, 0x0000033a, 0x00000022, 0x00000000, 0x00040047, 0x0000033a,
-    0x00000021, 0x00000012, 0x00030047, 0x0000033a, 0x00000019, 0x00040047, 0x00000344, 0x00000006,
-    0x00000004, 0x00050048, 0x00000345, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000345,
-    0x00000002, 0x00040047, 0x00000347, 0x00000022, 0x00000000, 0x00040047, 0x00000347, 0x00000021,
-    0x0000000d, 0x00040047, 0x00000355, 0x00000001, 0x00000002, 0x00040047, 0x0000035c, 0x00000006,
-    0x00000010, 0x00050048, 0x0000035e, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x0000035e,
-    0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x0000035e, 0x00000002, 0x00000023, 0x00000008,
-    0x00050048, 0x0000035e, 0x00000003, 0x00000023, 0x0000000c, 0x00050048, 0x0000035e, 0x00000004,
-    0x00000023, 0x00000010, 0x00050048, 0x0000035e, 0x00000005, 0x00000023, 0x00000230, 0x00050048,
-    0x0000035e, 0x00000006, 0x00000023, 0x00000234, 0x00050048, 0x0000035e, 0x00000007, 0x00000023,
-    0x00000238, 0x00050048, 0x0000035e, 0x00000008, 0x00000023, 0x0000023c, 0x00050048, 0x0000035e,
-    0x00000009, 0x00000023, 0x00000240, 0x00050048, 0x0000035e, 0x0000000a, 0x00000023, 0x00000244,
-    0x00050048, 0x0000035e, 0x0000000b, 0x00000023, 0x00000248, 0x00030047, 0x0000035e, 0x00000002,
-    0x00040047, 0x00000360, 0x00000022, 0x00000000, 0x00040047, 0x00000360, 0x00000021, 0x00000000,
-    0x00040047, 0x00000367, 0x0000000b, 0x00000019, 0x00020013, 0x00000002, 0x00030021, 0x00000003,
-    0x00000002, 0x00040015, 0x00000006, 0x00000020, 0x00000000, 0x00040020, 0x00000007, 0x00000007,
-    0x00000006, 0x00040021, 0x00000008, 0x00000006, 0x00000007, 0x00040015, 0x0000000f, 0x00000020,
-    0x00000001, 0x00040017, 0x00000010, 0x0000000f, 0x00000002, 0x00040020, 0x00000011, 0x00000007,
-    0x00000010, 0x00040021, 0x00000012, 0x00000006, 0x00000011, 0x00070021, 0x0000001f, 0x00000006,
-    0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00050021, 0x0000002c, 0x00000006, 0x00000007,
-    0x00000007, 0x00060021, 0x00000031, 0x00000006, 0x00000007, 0x00000007, 0x00000007, 0x00040017,
-    0x0000003f, 0x00000006, 0x00000002, 0x00040020, 0x00000040, 0x00000007, 0x0000003f, 0x00050021,
-    0x00000041, 0x00000006, 0x00000007, 0x00000040, 0x0004002b, 0x00000006, 0x00000047, 0x0000003f,
-    0x0004002b, 0x00000006, 0x00000049, 0x0000007f, 0x0004002b, 0x00000006, 0x0000004b, 0x000000ff,
-    0x0004002b, 0x00000006, 0x00000050, 0x0000001f, 0x00030016, 0x00000056, 0x00000020, 0x00040017,
-    0x00000057, 0x00000056, 0x00000004, 0x00040020, 0x00000058, 0x00000007, 0x00000057, 0x00090019,
-    0x0000005a, 0x00000056, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000004,
-    0x00040020, 0x0000005b, 0x00000000, 0x0000005a, 0x0004003b, 0x0000005b, 0x0000005c, 0x00000000,
-    0x00040017, 0x00000060, 0x00000006, 0x00000004, 0x00040020, 0x00000061, 0x00000007, 0x00000060,
-    0x0004002b, 0x00000056, 0x00000064, 0x437f0000, 0x0004002b, 0x00000006, 0x00000069, 0x00000000,
-    0x0004002b, 0x00000006, 0x0000006e, 0x00000001, 0x0004002b, 0x0000000f, 0x00000072, 0x00000008,
-    0x0004002b, 0x00000006, 0x00000076, 0x00000002, 0x0004002b, 0x0000000f, 0x0000007a, 0x00000010,
-    0x0004002b, 0x00000006, 0x0000007e, 0x00000003, 0x0004002b, 0x0000000f, 0x00000082, 0x00000018,
-    0x0004002b, 0x00000006, 0x000000af, 0x00000008, 0x0004002b, 0x0000000f, 0x000000b1, 0x00000004,
-    0x0004002b, 0x00000006, 0x000000da, 0x00000020, 0x0004002b, 0x00000006, 0x000000e8, 0x00000010,
-    0x0004002b, 0x0000000f, 0x000000ea, 0x00000005, 0x0004002b, 0x0000000f, 0x00000174, 0x00000002,
-    0x0004002b, 0x00000006, 0x0000018c, 0xff000000, 0x0004002b, 0x00000006, 0x00000192, 0x0000ffff,
-    0x0004002b, 0x00000006, 0x00000196, 0x0000001c, 0x0004002b, 0x00000006, 0x0000019b, 0x0000001e,
-    0x00040032, 0x0000000f, 0x0000019f, 0x00000100, 0x0004002b, 0x0000000f, 0x000001a0, 0x00000100,
-    0x00060034, 0x0000000f, 0x000001a1, 0x00000087, 0x0000019f, 0x000001a0, 0x00060034, 0x00000006,
-    0x000001a2, 0x00000080, 0x000001a1, 0x00000069, 0x00060034, 0x00000006, 0x000001a3, 0x00000080,
-    0x000001a1, 0x00000069, 0x00060034, 0x00000006, 0x000001a4, 0x00000084, 0x000001a2, 0x000001a3,
-    0x0004002b, 0x00000006, 0x000001a7, 0x00000004, 0x0004002b, 0x00000006, 0x000001ab, 0x00010000,
-    0x00060034, 0x00000006, 0x000001b2, 0x00000080, 0x000001a1, 0x00000069, 0x0003001d, 0x000001b7,
-    0x00000006, 0x0003001e, 0x000001b8, 0x000001b7, 0x00040020, 0x000001b9, 0x0000000c, 0x000001b8,
-    0x0004003b, 0x000001b9, 0x000001ba, 0x0000000c, 0x0004002b, 0x0000000f, 0x000001bb, 0x00000000,
-    0x00040020, 0x000001c1, 0x0000000c, 0x00000006, 0x00040017, 0x000001c7, 0x00000006, 0x00000003,
-    0x00040020, 0x000001c8, 0x00000001, 0x000001c7, 0x0004003b, 0x000001c8, 0x000001c9, 0x00000001,
-    0x00020014, 0x000001cc, 0x00060034, 0x00000006, 0x000001cf, 0x00000080, 0x0000019f, 0x00000069,
-    0x00040032, 0x0000000f, 0x000001d6, 0x000000c0, 0x00060034, 0x00000006, 0x000001d7, 0x00000080,
-    0x000001d6, 0x00000069, 0x00060034, 0x00000006, 0x000001d8, 0x00000084, 0x000001d7, 0x00000076,
-    0x00060034, 0x00000006, 0x000001e1, 0x00000080, 0x000001d6, 0x00000069, 0x00060034, 0x00000006,
-    0x000001e7, 0x00000080, 0x000001d6, 0x00000069, 0x00060034, 0x00000006, 0x000001ed, 0x00000080,
-    0x000001a1, 0x00000069, 0x00060034, 0x00000006, 0x000001f1, 0x00000080, 0x000001a1, 0x00000069,
-    0x0004002b, 0x00000006, 0x000001f6, 0x00000100, 0x0004002b, 0x00000006, 0x000001fb, 0x00030000,
-    0x0003001d, 0x000001fe, 0x00000006, 0x0003001e, 0x000001ff, 0x000001fe, 0x00040020, 0x00000200,
-    0x0000000c, 0x000001ff, 0x0004003b, 0x00000200, 0x00000201, 0x0000000c, 0x0004002b, 0x00000006,
-    0x00000209, 0x0000c000, 0x0004002b, 0x00000006, 0x00000211, 0x00018000, 0x0004002b, 0x00000006,
-    0x00000219, 0x00024000, 0x0004002b, 0x00000006, 0x00000221, 0x00000018, 0x0004002b, 0x00000006,
-    0x00000224, 0x000a8000, 0x0004002b, 0x00000006, 0x00000226, 0x000000c0, 0x0004002b, 0x00000006,
-    0x00000234, 0x80000000, 0x0004002b, 0x00000006, 0x0000023f, 0x00000040, 0x00060034, 0x00000006,
-    0x00000248, 0x00000080, 0x000001a1, 0x00000069, 0x00060034, 0x00000006, 0x0000024b, 0x00000080,
-    0x000001a1, 0x00000069, 0x0004002b, 0x00000006, 0x0000025a, 0x00000017, 0x0004002b, 0x00000006,
-    0x0000025c, 0x000001ff, 0x00040020, 0x0000025e, 0x00000007, 0x0000000f, 0x0004002b, 0x00000006,
-    0x00000269, 0x00000200, 0x00060034, 0x00000006, 0x0000026c, 0x00000080, 0x000001a1, 0x00000069,
-    0x00060034, 0x00000006, 0x00000275, 0x00000080, 0x000001a1, 0x00000069, 0x00060034, 0x00000006,
-    0x00000282, 0x00000080, 0x000001a1, 0x00000069, 0x00060034, 0x00000006, 0x00000285, 0x00000080,
-    0x000001a1, 0x00000069, 0x000a001e, 0x0000028d, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x0000000f, 0x00000006, 0x00040020, 0x0000028e, 0x00000009, 0x0000028d,
-    0x0004003b, 0x0000028e, 0x0000028f, 0x00000009, 0x0004002b, 0x0000000f, 0x00000290, 0x00000001,
-    0x00040020, 0x00000291, 0x00000009, 0x00000006, 0x0004002b, 0x00000006, 0x000002ab, 0x0000000f,
-    0x0004002b, 0x00000006, 0x000002ba, 0x00000080, 0x0004002b, 0x00000006, 0x000002d9, 0x00000007,
-    0x0004002b, 0x0000000f, 0x00000311, 0x00000007, 0x0004003b, 0x0000005b, 0x00000330, 0x00000000,
-    0x0004003b, 0x0000005b, 0x0000033a, 0x00000000, 0x0003001d, 0x00000344, 0x00000006, 0x0003001e,
-    0x00000345, 0x00000344, 0x00040020, 0x00000346, 0x0000000c, 0x00000345, 0x0004003b, 0x00000346,
-    0x00000347, 0x0000000c, 0x00060034, 0x0000000f, 0x00000349, 0x00000084, 0x0000019f, 0x000001d6,
-    0x00060034, 0x00000006, 0x0000034a, 0x00000080, 0x00000349, 0x00000069, 0x00060034, 0x00000006,
-    0x0000034d, 0x00000080, 0x0000019f, 0x00000069, 0x00040032, 0x0000000f, 0x00000355, 0x00003000,
-    0x0004002b, 0x0000000f, 0x00000356, 0x00000040, 0x0004002b, 0x0000000f, 0x00000357, 0x00000020,
-    0x00060034, 0x0000000f, 0x00000358, 0x00000087, 0x0000019f, 0x00000072, 0x00060034, 0x0000000f,
-    0x00000359, 0x00000087, 0x000001d6, 0x00000072, 0x0004002b, 0x0000000f, 0x0000035a, 0x00000800,
-    0x0004002b, 0x00000006, 0x0000035b, 0x00000022, 0x0004001c, 0x0000035c, 0x00000060, 0x0000035b,
-    0x00040017, 0x0000035d, 0x00000056, 0x00000002, 0x000e001e, 0x0000035e, 0x00000006, 0x00000006,
-    0x0000000f, 0x00000006, 0x0000035c, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x0000035d, 0x00040020, 0x0000035f, 0x00000002, 0x0000035e, 0x0004003b, 0x0000035f,
-    0x00000360, 0x00000002, 0x0004002b, 0x0000000f, 0x00000361, 0x000000c0, 0x0004002b, 0x0000000f,
-    0x00000362, 0x0000c000, 0x0004002b, 0x00000006, 0x00000363, 0x00060000, 0x0004002b, 0x00000006,
-    0x00000364, 0x00090000, 0x0004002b, 0x00000006, 0x00000365, 0x0009c000, 0x0004002b, 0x00000006,
-    0x00000366, 0x000a8180, 0x0006002c, 0x000001c7, 0x00000367, 0x000000af, 0x000000af, 0x0000006e,
-    0x0004002b, 0x00000006, 0x00000368, 0x20000000, 0x0004002b, 0x00000006, 0x00000369, 0x40000000,
-    0x00050036, 0x00000002, 0x00000004, 0x00000000, 0x00000003, 0x000200f8, 0x00000005, 0x0004003b,
-    0x00000040, 0x000001c6, 0x00000007, 0x0004003b, 0x00000007, 0x000001de, 0x00000007, 0x0004003b,
-    0x00000007, 0x000001e3, 0x00000007, 0x0004003b, 0x00000007, 0x000001ea, 0x00000007, 0x0004003b,
-    0x00000007, 0x000001ef, 0x00000007, 0x0004003b, 0x00000007, 0x000001f3, 0x00000007, 0x0004003b,
-    0x00000007, 0x000001f9, 0x00000007, 0x0004003b, 0x00000007, 0x000001fd, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000207, 0x00000007, 0x0004003b, 0x00000007, 0x0000020f, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000217, 0x00000007, 0x0004003b, 0x00000007, 0x0000021f, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000223, 0x00000007, 0x0004003b, 0x00000007, 0x0000022d, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000231, 0x00000007, 0x0004003b, 0x00000007, 0x0000024e, 0x00000007, 0x0004003b,
-    0x00000040, 0x00000250, 0x00000007, 0x0004003b, 0x00000007, 0x00000258, 0x00000007, 0x0004003b,
-    0x0000025e, 0x0000025f, 0x00000007, 0x0004003b, 0x0000025e, 0x00000263, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000027a, 0x00000007, 0x0004003b, 0x00000007, 0x00000288, 0x00000007, 0x0004003b,
-    0x00000040, 0x0000028a, 0x00000007, 0x0004003b, 0x00000011, 0x000002a1, 0x00000007, 0x0004003b,
-    0x00000007, 0x000002a9, 0x00000007, 0x0004003b, 0x00000007, 0x000002ad, 0x00000007, 0x0004003b,
-    0x00000007, 0x000002b1, 0x00000007, 0x0004003b, 0x00000007, 0x000002c0, 0x00000007, 0x0004003b,
-    0x00000007, 0x000002c2, 0x00000007, 0x0004003b, 0x00000007, 0x000002c4, 0x00000007, 0x0004003b,
-    0x00000007, 0x000002c6, 0x00000007, 0x0004003b, 0x00000007, 0x000002ce, 0x00000007, 0x0004003b,
-    0x00000007, 0x000002d0, 0x00000007, 0x0004003b, 0x00000007, 0x000002d2, 0x00000007, 0x0004003b,
-    0x00000007, 0x000002da, 0x00000007, 0x0004003b, 0x00000007, 0x000002dc, 0x00000007, 0x0004003b,
-    0x00000007, 0x000002de, 0x00000007, 0x0004003b, 0x00000007, 0x000002e5, 0x00000007, 0x0004003b,
-    0x00000007, 0x000002e7, 0x00000007, 0x0004003b, 0x00000007, 0x000002f0, 0x00000007, 0x0004003b,
-    0x00000007, 0x000002f4, 0x00000007, 0x0004003b, 0x00000007, 0x000002fc, 0x00000007, 0x0004003b,
-    0x00000007, 0x000002fe, 0x00000007, 0x0004003b, 0x00000007, 0x00000300, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000307, 0x00000007, 0x0004003b, 0x00000007, 0x00000309, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000030b, 0x00000007, 0x0004003b, 0x00000007, 0x0000030d, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000030e, 0x00000007, 0x0004003b, 0x00000058, 0x00000317, 0x00000007, 0x0004003d,
-    0x000001c7, 0x000001ca, 0x000001c9, 0x0007004f, 0x0000003f, 0x000001cb, 0x000001ca, 0x000001ca,
-    0x00000000, 0x00000001, 0x0003003e, 0x000001c6, 0x000001cb, 0x00050041, 0x00000007, 0x000001cd,
-    0x000001c6, 0x00000069, 0x0004003d, 0x00000006, 0x000001ce, 0x000001cd, 0x000500ae, 0x000001cc,
-    0x000001d0, 0x000001ce, 0x000001cf, 0x000400a8, 0x000001cc, 0x000001d1, 0x000001d0, 0x000300f7,
-    0x000001d3, 0x00000000, 0x000400fa, 0x000001d1, 0x000001d2, 0x000001d3, 0x000200f8, 0x000001d2,
-    0x00050041, 0x00000007, 0x000001d4, 0x000001c6, 0x0000006e, 0x0004003d, 0x00000006, 0x000001d5,
-    0x000001d4, 0x000500ae, 0x000001cc, 0x000001d9, 0x000001d5, 0x000001d8, 0x000200f9, 0x000001d3,
-    0x000200f8, 0x000001d3, 0x000700f5, 0x000001cc, 0x000001da, 0x000001d0, 0x00000005, 0x000001d9,
-    0x000001d2, 0x000300f7, 0x000001dc, 0x00000000, 0x000400fa, 0x000001da, 0x000001db, 0x000001dc,
-    0x000200f8, 0x000001db, 0x000100fd, 0x000200f8, 0x000001dc, 0x00050041, 0x00000007, 0x000001df,
-    0x000001c6, 0x0000006e, 0x0004003d, 0x00000006, 0x000001e0, 0x000001df, 0x00050086, 0x00000006,
-    0x000001e2, 0x000001e0, 0x000001e1, 0x0003003e, 0x000001de, 0x000001e2, 0x00050041, 0x00000007,
-    0x000001e4, 0x000001c6, 0x0000006e, 0x0004003d, 0x00000006, 0x000001e5, 0x000001e4, 0x0004003d,
-    0x00000006, 0x000001e6, 0x000001de, 0x00050084, 0x00000006, 0x000001e8, 0x000001e6, 0x000001e7,
-    0x00050082, 0x00000006, 0x000001e9, 0x000001e5, 0x000001e8, 0x0003003e, 0x000001e3, 0x000001e9,
-    0x00050041, 0x00000007, 0x000001eb, 0x000001c6, 0x00000069, 0x0004003d, 0x00000006, 0x000001ec,
-    0x000001eb, 0x00050086, 0x00000006, 0x000001ee, 0x000001ec, 0x000001ed, 0x0003003e, 0x000001ea,
-    0x000001ee, 0x0004003d, 0x00000006, 0x000001f0, 0x000001e3, 0x00050086, 0x00000006, 0x000001f2,
-    0x000001f0, 0x000001f1, 0x0003003e, 0x000001ef, 0x000001f2, 0x0004003d, 0x00000006, 0x000001f4,
-    0x000001ea, 0x0004003d, 0x00000006, 0x000001f5, 0x000001ef, 0x00050084, 0x00000006, 0x000001f7,
-    0x000001f5, 0x000001f6, 0x00050080, 0x00000006, 0x000001f8, 0x000001f4, 0x000001f7, 0x0003003e,
-    0x000001f3, 0x000001f8, 0x0004003d, 0x00000006, 0x000001fa, 0x000001de, 0x00050084, 0x00000006,
-    0x000001fc, 0x000001fa, 0x000001fb, 0x0003003e, 0x000001f9, 0x000001fc, 0x0004003d, 0x00000006,
-    0x00000202, 0x000001f9, 0x0004003d, 0x00000006, 0x00000203, 0x000001f3, 0x00050080, 0x00000006,
-    0x00000204, 0x00000202, 0x00000203, 0x00060041, 0x000001c1, 0x00000205, 0x00000201, 0x000001bb,
-    0x00000204, 0x0004003d, 0x00000006, 0x00000206, 0x00000205, 0x0003003e, 0x000001fd, 0x00000206,
-    0x0004003d, 0x00000006, 0x00000208, 0x000001f9, 0x00050080, 0x00000006, 0x0000020a, 0x00000208,
-    0x00000209, 0x0004003d, 0x00000006, 0x0000020b, 0x000001f3, 0x00050080, 0x00000006, 0x0000020c,
-    0x0000020a, 0x0000020b, 0x00060041, 0x000001c1, 0x0000020d, 0x00000201, 0x000001bb, 0x0000020c,
-    0x0004003d, 0x00000006, 0x0000020e, 0x0000020d, 0x0003003e, 0x00000207, 0x0000020e, 0x0004003d,
-    0x00000006, 0x00000210, 0x000001f9, 0x00050080, 0x00000006, 0x00000212, 0x00000210, 0x00000211,
-    0x0004003d, 0x00000006, 0x00000213, 0x000001f3, 0x00050080, 0x00000006, 0x00000214, 0x00000212,
-    0x00000213, 0x00060041, 0x000001c1, 0x00000215, 0x00000201, 0x000001bb, 0x00000214, 0x0004003d,
-    0x00000006, 0x00000216, 0x00000215, 0x0003003e, 0x0000020f, 0x00000216, 0x0004003d, 0x00000006,
-    0x00000218, 0x000001f9, 0x00050080, 0x00000006, 0x0000021a, 0x00000218, 0x00000219, 0x0004003d,
-    0x00000006, 0x0000021b, 0x000001f3, 0x00050080, 0x00000006, 0x0000021c, 0x0000021a, 0x0000021b,
-    0x00060041, 0x000001c1, 0x0000021d, 0x00000201, 0x000001bb, 0x0000021c, 0x0004003d, 0x00000006,
-    0x0000021e, 0x0000021d, 0x0003003e, 0x00000217, 0x0000021e, 0x0004003d, 0x00000006, 0x00000220,
-    0x0000020f, 0x000500c2, 0x00000006, 0x00000222, 0x00000220, 0x00000221, 0x0003003e, 0x0000021f,
-    0x00000222, 0x0004003d, 0x00000006, 0x00000225, 0x000001de, 0x00050084, 0x00000006, 0x00000227,
-    0x00000225, 0x00000226, 0x00050080, 0x00000006, 0x00000228, 0x00000224, 0x00000227, 0x0004003d,
-    0x00000006, 0x00000229, 0x000001ef, 0x00050080, 0x00000006, 0x0000022a, 0x00000228, 0x00000229,
-    0x00060041, 0x000001c1, 0x0000022b, 0x00000201, 0x000001bb, 0x0000022a, 0x0004003d, 0x00000006,
-    0x0000022c, 0x0000022b, 0x0003003e, 0x00000223, 0x0000022c, 0x0004003d, 0x00000006, 0x0000022e,
-    0x00000223, 0x000500c2, 0x00000006, 0x0000022f, 0x0000022e, 0x000000e8, 0x000500c7, 0x00000006,
-    0x00000230, 0x0000022f, 0x0000007e, 0x0003003e, 0x0000022d, 0x00000230, 0x0004003d, 0x00000006,
-    0x00000232, 0x000001fd, 0x0003003e, 0x00000231, 0x00000232, 0x0004003d, 0x00000006, 0x00000233,
-    0x00000217, 0x000500c7, 0x00000006, 0x00000235, 0x00000233, 0x00000234, 0x000500ab, 0x000001cc,
-    0x00000236, 0x00000235, 0x00000069, 0x000300f7, 0x00000238, 0x00000000, 0x000400fa, 0x00000236,
-    0x00000237, 0x00000238, 0x000200f8, 0x00000237, 0x0004003d, 0x00000006, 0x00000239, 0x0000022d,
-    0x000500aa, 0x000001cc, 0x0000023a, 0x00000239, 0x00000076, 0x000400a8, 0x000001cc, 0x0000023b,
-    0x0000023a, 0x000300f7, 0x0000023d, 0x00000000, 0x000400fa, 0x0000023b, 0x0000023c, 0x0000023d,
-    0x000200f8, 0x0000023c, 0x0004003d, 0x00000006, 0x0000023e, 0x0000021f, 0x000500c7, 0x00000006,
-    0x00000240, 0x0000023e, 0x0000023f, 0x000500aa, 0x000001cc, 0x00000241, 0x00000240, 0x00000069,
-    0x000200f9, 0x0000023d, 0x000200f8, 0x0000023d, 0x000700f5, 0x000001cc, 0x00000242, 0x0000023a,
-    0x00000237, 0x00000241, 0x0000023c, 0x000200f9, 0x00000238, 0x000200f8, 0x00000238, 0x000700f5,
-    0x000001cc, 0x00000243, 0x00000236, 0x000001dc, 0x00000242, 0x0000023d, 0x000300f7, 0x00000245,
-    0x00000000, 0x000400fa, 0x00000243, 0x00000244, 0x00000252, 0x000200f8, 0x00000244, 0x00050041,
-    0x00000007, 0x00000246, 0x000001c6, 0x00000069, 0x0004003d, 0x00000006, 0x00000247, 0x00000246,
-    0x00050089, 0x00000006, 0x00000249, 0x00000247, 0x00000248, 0x0004003d, 0x00000006, 0x0000024a,
-    0x000001e3, 0x00050089, 0x00000006, 0x0000024c, 0x0000024a, 0x0000024b, 0x00050050, 0x0000003f,
-    0x0000024d, 0x00000249, 0x0000024c, 0x0004003d, 0x00000006, 0x0000024f, 0x00000217, 0x0003003e,
-    0x0000024e, 0x0000024f, 0x0003003e, 0x00000250, 0x0000024d, 0x00060039, 0x00000006, 0x00000251,
-    0x00000044, 0x0000024e, 0x00000250, 0x0003003e, 0x00000231, 0x00000251, 0x000200f9, 0x00000245,
-    0x000200f8, 0x00000252, 0x0004003d, 0x00000006, 0x00000253, 0x0000021f, 0x000500c7, 0x00000006,
-    0x00000254, 0x00000253, 0x0000023f, 0x000500ab, 0x000001cc, 0x00000255, 0x00000254, 0x00000069,
-    0x000300f7, 0x00000257, 0x00000000, 0x000400fa, 0x00000255, 0x00000256, 0x00000257, 0x000200f8,
-    0x00000256, 0x0004003d, 0x00000006, 0x00000259, 0x00000223, 0x000500c2, 0x00000006, 0x0000025b,
-    0x00000259, 0x0000025a, 0x000500c7, 0x00000006, 0x0000025d, 0x0000025b, 0x0000025c, 0x0003003e,
-    0x00000258, 0x0000025d, 0x0004003d, 0x00000006, 0x00000260, 0x00000258, 0x000500c7, 0x00000006,
-    0x00000261, 0x00000260, 0x000001f6, 0x000500ab, 0x000001cc, 0x00000262, 0x00000261, 0x00000069,
-    0x000300f7, 0x00000265, 0x00000000, 0x000400fa, 0x00000262, 0x00000264, 0x00000270, 0x000200f8,
-    0x00000264, 0x00050041, 0x00000007, 0x00000266, 0x000001c6, 0x00000069, 0x0004003d, 0x00000006,
-    0x00000267, 0x00000266, 0x0004007c, 0x0000000f, 0x00000268, 0x00000267, 0x0004003d, 0x00000006,
-    0x0000026a, 0x00000258, 0x00050082, 0x00000006, 0x0000026b, 0x00000269, 0x0000026a, 0x00050084,
-    0x00000006, 0x0000026d, 0x0000026b, 0x0000026c, 0x0004007c, 0x0000000f, 0x0000026e, 0x0000026d,
-    0x00050082, 0x0000000f, 0x0000026f, 0x00000268, 0x0000026e, 0x0003003e, 0x00000263, 0x0000026f,
-    0x000200f9, 0x00000265, 0x000200f8, 0x00000270, 0x00050041, 0x00000007, 0x00000271, 0x000001c6,
-    0x00000069, 0x0004003d, 0x00000006, 0x00000272, 0x00000271, 0x0004007c, 0x0000000f, 0x00000273,
-    0x00000272, 0x0004003d, 0x00000006, 0x00000274, 0x00000258, 0x00050084, 0x00000006, 0x00000276,
-    0x00000274, 0x00000275, 0x0004007c, 0x0000000f, 0x00000277, 0x00000276, 0x00050080, 0x0000000f,
-    0x00000278, 0x00000273, 0x00000277, 0x0003003e, 0x00000263, 0x00000278, 0x000200f9, 0x00000265,
-    0x000200f8, 0x00000265, 0x0004003d, 0x0000000f, 0x00000279, 0x00000263, 0x0003003e, 0x0000025f,
-    0x00000279, 0x0003003e, 0x0000027a, 0x00000069, 0x0004003d, 0x00000006, 0x0000027b, 0x00000217,
-    0x000500c7, 0x00000006, 0x0000027c, 0x0000027b, 0x00000234, 0x000500ab, 0x000001cc, 0x0000027d,
-    0x0000027c, 0x00000069, 0x000300f7, 0x0000027f, 0x00000000, 0x000400fa, 0x0000027d, 0x0000027e,
-    0x0000028c, 0x000200f8, 0x0000027e, 0x00050041, 0x00000007, 0x00000280, 0x000001c6, 0x00000069,
-    0x0004003d, 0x00000006, 0x00000281, 0x00000280, 0x00050089, 0x00000006, 0x00000283, 0x00000281,
-    0x00000282, 0x0004003d, 0x00000006, 0x00000284, 0x000001e3, 0x00050089, 0x00000006, 0x00000286,
-    0x00000284, 0x00000285, 0x00050050, 0x0000003f, 0x00000287, 0x00000283, 0x00000286, 0x0004003d,
-    0x00000006, 0x00000289, 0x00000217, 0x0003003e, 0x00000288, 0x00000289, 0x0003003e, 0x0000028a,
-    0x00000287, 0x00060039, 0x00000006, 0x0000028b, 0x00000044, 0x00000288, 0x0000028a, 0x0003003e,
-    0x0000027a, 0x0000028b, 0x000200f9, 0x0000027f, 0x000200f8, 0x0000028c, 0x00050041, 0x00000291,
-    0x00000292, 0x0000028f, 0x00000290, 0x0004003d, 0x00000006, 0x00000293, 0x00000292, 0x000500ab,
-    0x000001cc, 0x00000294, 0x00000293, 0x00000069, 0x0004003d, 0x0000000f, 0x00000295, 0x0000025f,
-    0x000500af, 0x000001cc, 0x00000296, 0x00000295, 0x000001bb, 0x000500a7, 0x000001cc, 0x00000297,
-    0x00000294, 0x00000296, 0x0004003d, 0x0000000f, 0x00000298, 0x0000025f, 0x000500b1, 0x000001cc,
-    0x00000299, 0x00000298, 0x0000019f, 0x000500a7, 0x000001cc, 0x0000029a, 0x00000297, 0x00000299,
-    0x000300f7, 0x0000029c, 0x00000000, 0x000400fa, 0x0000029a, 0x0000029b, 0x0000029c, 0x000200f8,
-    0x0000029b, 0x0004003d, 0x0000000f, 0x0000029d, 0x0000025f, 0x0004003d, 0x00000006, 0x0000029e,
-    0x000001e3, 0x0004007c, 0x0000000f, 0x0000029f, 0x0000029e, 0x00050050, 0x00000010, 0x000002a0,
-    0x0000029d, 0x0000029f, 0x0003003e, 0x000002a1, 0x000002a0, 0x00050039, 0x00000006, 0x000002a2,
-    0x00000014, 0x000002a1, 0x0003003e, 0x0000027a, 0x000002a2, 0x000200f9, 0x0000029c, 0x000200f8,
-    0x0000029c, 0x000200f9, 0x0000027f, 0x000200f8, 0x0000027f, 0x0004003d, 0x00000006, 0x000002a3,
-    0x0000027a, 0x000500c2, 0x00000006, 0x000002a4, 0x000002a3, 0x00000221, 0x000500c7, 0x00000006,
-    0x000002a5, 0x000002a4, 0x00000050, 0x000500ab, 0x000001cc, 0x000002a6, 0x000002a5, 0x00000069,
-    0x000300f7, 0x000002a8, 0x00000000, 0x000400fa, 0x000002a6, 0x000002a7, 0x000002a8, 0x000200f8,
-    0x000002a7, 0x0004003d, 0x00000006, 0x000002aa, 0x0000021f, 0x000500c7, 0x00000006, 0x000002ac,
-    0x000002aa, 0x000002ab, 0x0003003e, 0x000002a9, 0x000002ac, 0x0004003d, 0x00000006, 0x000002ae,
-    0x0000020f, 0x000500c2, 0x00000006, 0x000002af, 0x000002ae, 0x000000af, 0x000500c7, 0x00000006,
-    0x000002b0, 0x000002af, 0x00000050, 0x0003003e, 0x000002ad, 0x000002b0, 0x0004003d, 0x00000006,
-    0x000002b2, 0x0000020f, 0x000500c2, 0x00000006, 0x000002b3, 0x000002b2, 0x000000e8, 0x000500c7,
-    0x00000006, 0x000002b4, 0x000002b3, 0x00000050, 0x0003003e, 0x000002b1, 0x000002b4, 0x0004003d,
-    0x00000006, 0x000002b5, 0x000002a9, 0x000500aa, 0x000001cc, 0x000002b6, 0x000002b5, 0x0000006e,
-    0x000300f7, 0x000002b8, 0x00000000, 0x000400fa, 0x000002b6, 0x000002b7, 0x000002b8, 0x000200f8,
-    0x000002b7, 0x0004003d, 0x00000006, 0x000002b9, 0x0000021f, 0x000500c7, 0x00000006, 0x000002bb,
-    0x000002b9, 0x000002ba, 0x000500ab, 0x000001cc, 0x000002bc, 0x000002bb, 0x00000069, 0x000200f9,
-    0x000002b8, 0x000200f8, 0x000002b8, 0x000700f5, 0x000001cc, 0x000002bd, 0x000002b6, 0x000002a7,
-    0x000002bc, 0x000002b7, 0x000300f7, 0x000002bf, 0x00000000, 0x000400fa, 0x000002bd, 0x000002be,
-    0x000002c9, 0x000200f8, 0x000002be, 0x0004003d, 0x00000006, 0x000002c1, 0x00000207, 0x0003003e,
-    0x000002c0, 0x000002c1, 0x0004003d, 0x00000006, 0x000002c3, 0x0000027a, 0x0003003e, 0x000002c2,
-    0x000002c3, 0x0004003d, 0x00000006, 0x000002c5, 0x000002ad, 0x0003003e, 0x000002c4, 0x000002c5,
-    0x0004003d, 0x00000006, 0x000002c7, 0x000002b1, 0x0003003e, 0x000002c6, 0x000002c7, 0x00080039,
-    0x00000006, 0x000002c8, 0x0000002a, 0x000002c0, 0x000002c2, 0x000002c4, 0x000002c6, 0x0003003e,
-    0x00000231, 0x000002c8, 0x000200f9, 0x000002bf, 0x000200f8, 0x000002c9, 0x0004003d, 0x00000006,
-    0x000002ca, 0x000002a9, 0x000500aa, 0x000001cc, 0x000002cb, 0x000002ca, 0x00000076, 0x000300f7,
-    0x000002cd, 0x00000000, 0x000400fa, 0x000002cb, 0x000002cc, 0x000002d4, 0x000200f8, 0x000002cc,
-    0x0004003d, 0x00000006, 0x000002cf, 0x0000027a, 0x0003003e, 0x000002ce, 0x000002cf, 0x0004003d,
-    0x00000006, 0x000002d1, 0x000002ad, 0x0003003e, 0x000002d0, 0x000002d1, 0x0003003e, 0x000002d2,
-    0x000000af, 0x00070039, 0x00000006, 0x000002d3, 0x00000035, 0x000002ce, 0x000002d0, 0x000002d2,
-    0x0003003e, 0x00000231, 0x000002d3, 0x000200f9, 0x000002cd, 0x000200f8, 0x000002d4, 0x0004003d,
-    0x00000006, 0x000002d5, 0x000002a9, 0x000500aa, 0x000001cc, 0x000002d6, 0x000002d5, 0x0000007e,
-    0x000300f7, 0x000002d8, 0x00000000, 0x000400fa, 0x000002d6, 0x000002d7, 0x000002e0, 0x000200f8,
-    0x000002d7, 0x0004003d, 0x00000006, 0x000002db, 0x0000027a, 0x0003003e, 0x000002da, 0x000002db,
-    0x0004003d, 0x00000006, 0x000002dd, 0x000002ad, 0x0003003e, 0x000002dc, 0x000002dd, 0x0003003e,
-    0x000002de, 0x000002d9, 0x00070039, 0x00000006, 0x000002df, 0x0000003a, 0x000002da, 0x000002dc,
-    0x000002de, 0x0003003e, 0x00000231, 0x000002df, 0x000200f9, 0x000002d8, 0x000200f8, 0x000002e0,
-    0x0004003d, 0x00000006, 0x000002e1, 0x000002a9, 0x000500aa, 0x000001cc, 0x000002e2, 0x000002e1,
-    0x000001a7, 0x000300f7, 0x000002e4, 0x00000000, 0x000400fa, 0x000002e2, 0x000002e3, 0x000002ea,
-    0x000200f8, 0x000002e3, 0x0004003d, 0x00000006, 0x000002e6, 0x0000027a, 0x0003003e, 0x000002e5,
-    0x000002e6, 0x0004003d, 0x00000006, 0x000002e8, 0x000001fd, 0x0003003e, 0x000002e7, 0x000002e8,
-    0x00060039, 0x00000006, 0x000002e9, 0x0000002f, 0x000002e5, 0x000002e7, 0x0003003e, 0x00000231,
-    0x000002e9, 0x000200f9, 0x000002e4, 0x000200f8, 0x000002ea, 0x0004003d, 0x00000006, 0x000002eb,
-    0x0000027a, 0x0003003e, 0x00000231, 0x000002eb, 0x000200f9, 0x000002e4, 0x000200f8, 0x000002e4,
-    0x000200f9, 0x000002d8, 0x000200f8, 0x000002d8, 0x000200f9, 0x000002cd, 0x000200f8, 0x000002cd,
-    0x000200f9, 0x000002bf, 0x000200f8, 0x000002bf, 0x000200f9, 0x000002a8, 0x000200f8, 0x000002a8,
-    0x000200f9, 0x00000257, 0x000200f8, 0x00000257, 0x000200f9, 0x00000245, 0x000200f8, 0x00000245,
-    0x0004003d, 0x00000006, 0x000002ec, 0x0000022d, 0x000500ab, 0x000001cc, 0x000002ed, 0x000002ec,
-    0x00000069, 0x000300f7, 0x000002ef, 0x00000000, 0x000400fa, 0x000002ed, 0x000002ee, 0x000002ef,
-    0x000200f8, 0x000002ee, 0x0004003d, 0x00000006, 0x000002f1, 0x00000223, 0x000500c2, 0x00000006,
-    0x000002f2, 0x000002f1, 0x000000af, 0x000500c7, 0x00000006, 0x000002f3, 0x000002f2, 0x0000007e,
-    0x0003003e, 0x000002f0, 0x000002f3, 0x0004003d, 0x00000006, 0x000002f5, 0x00000223, 0x000500c7,
-    0x00000006, 0x000002f6, 0x000002f5, 0x00000050, 0x0007000c, 0x00000006, 0x000002f7, 0x00000001,
-    0x00000026, 0x000002f6, 0x000000e8, 0x0003003e, 0x000002f4, 0x000002f7, 0x0004003d, 0x00000006,
-    0x000002f8, 0x000002f0, 0x000500aa, 0x000001cc, 0x000002f9, 0x000002f8, 0x0000006e, 0x000300f7,
-    0x000002fb, 0x00000000, 0x000400fa, 0x000002f9, 0x000002fa, 0x00000302, 0x000200f8, 0x000002fa,
-    0x0004003d, 0x00000006, 0x000002fd, 0x00000231, 0x0003003e, 0x000002fc, 0x000002fd, 0x0004003d,
-    0x00000006, 0x000002ff, 0x000002f4, 0x0003003e, 0x000002fe, 0x000002ff, 0x0003003e, 0x00000300,
-    0x00000069, 0x00070039, 0x00000006, 0x00000301, 0x00000035, 0x000002fc, 0x000002fe, 0x00000300,
-    0x0003003e, 0x00000231, 0x00000301, 0x000200f9, 0x000002fb, 0x000200f8, 0x00000302, 0x0004003d,
-    0x00000006, 0x00000303, 0x000002f0, 0x000500aa, 0x000001cc, 0x00000304, 0x00000303, 0x00000076,
-    0x000300f7, 0x00000306, 0x00000000, 0x000400fa, 0x00000304, 0x00000305, 0x00000306, 0x000200f8,
-    0x00000305, 0x0004003d, 0x00000006, 0x00000308, 0x00000231, 0x0003003e, 0x00000307, 0x00000308,
-    0x0004003d, 0x00000006, 0x0000030a, 0x000002f4, 0x0003003e, 0x00000309, 0x0000030a, 0x0003003e,
-    0x0000030b, 0x000002ab, 0x00070039, 0x00000006, 0x0000030c, 0x0000003a, 0x00000307, 0x00000309,
-    0x0000030b, 0x0003003e, 0x00000231, 0x0000030c, 0x000200f9, 0x00000306, 0x000200f8, 0x00000306,
-    0x000200f9, 0x000002fb, 0x000200f8, 0x000002fb, 0x000200f9, 0x000002ef, 0x000200f8, 0x000002ef,
-    0x0004003d, 0x00000006, 0x0000030f, 0x00000231, 0x0003003e, 0x0000030e, 0x0000030f, 0x00050039,
-    0x00000006, 0x00000310, 0x0000003d, 0x0000030e, 0x0003003e, 0x0000030d, 0x00000310, 0x00050041,
-    0x00000291, 0x00000312, 0x0000028f, 0x00000311, 0x0004003d, 0x00000006, 0x00000313, 0x00000312,
-    0x000500ab, 0x000001cc, 0x00000314, 0x00000313, 0x00000069, 0x000300f7, 0x00000316, 0x00000000,
-    0x000400fa, 0x00000314, 0x00000315, 0x00000343, 0x000200f8, 0x00000315, 0x0004003d, 0x00000006,
-    0x00000318, 0x0000030d, 0x000500c2, 0x00000006, 0x00000319, 0x00000318, 0x000000e8, 0x000500c7,
-    0x00000006, 0x0000031a, 0x00000319, 0x0000004b, 0x00040070, 0x00000056, 0x0000031b, 0x0000031a,
-    0x00050088, 0x00000056, 0x0000031c, 0x0000031b, 0x00000064, 0x0004003d, 0x00000006, 0x0000031d,
-    0x0000030d, 0x000500c2, 0x00000006, 0x0000031e, 0x0000031d, 0x000000af, 0x000500c7, 0x00000006,
-    0x0000031f, 0x0000031e, 0x0000004b, 0x00040070, 0x00000056, 0x00000320, 0x0000031f, 0x00050088,
-    0x00000056, 0x00000321, 0x00000320, 0x00000064, 0x0004003d, 0x00000006, 0x00000322, 0x0000030d,
-    0x000500c7, 0x00000006, 0x00000323, 0x00000322, 0x0000004b, 0x00040070, 0x00000056, 0x00000324,
-    0x00000323, 0x00050088, 0x00000056, 0x00000325, 0x00000324, 0x00000064, 0x0004003d, 0x00000006,
-    0x00000326, 0x0000030d, 0x000500c2, 0x00000006, 0x00000327, 0x00000326, 0x00000221, 0x000500c7,
-    0x00000006, 0x00000328, 0x00000327, 0x0000004b, 0x00040070, 0x00000056, 0x00000329, 0x00000328,
-    0x00050088, 0x00000056, 0x0000032a, 0x00000329, 0x00000064, 0x00070050, 0x00000057, 0x0000032b,
-    0x0000031c, 0x00000321, 0x00000325, 0x0000032a, 0x0003003e, 0x00000317, 0x0000032b, 0x0004003d,
-    0x00000006, 0x0000032c, 0x000001de, 0x000500aa, 0x000001cc, 0x0000032d, 0x0000032c, 0x00000069,
-    0x000300f7, 0x0000032f, 0x00000000, 0x000400fa, 0x0000032d, 0x0000032e, 0x00000339, 0x000200f8,
-    0x0000032e, 0x0004003d, 0x0000005a, 0x00000331, 0x00000330, 0x00050041, 0x00000007, 0x00000332,
-    0x000001c6, 0x00000069, 0x0004003d, 0x00000006, 0x00000333, 0x00000332, 0x0004007c, 0x0000000f,
-    0x00000334, 0x00000333, 0x0004003d, 0x00000006, 0x00000335, 0x000001e3, 0x0004007c, 0x0000000f,
-    0x00000336, 0x00000335, 0x00050050, 0x00000010, 0x00000337, 0x00000334, 0x00000336, 0x0004003d,
-    0x00000057, 0x00000338, 0x00000317, 0x00040063, 0x00000331, 0x00000337, 0x00000338, 0x000200f9,
-    0x0000032f, 0x000200f8, 0x00000339, 0x0004003d, 0x0000005a, 0x0000033b, 0x0000033a, 0x00050041,
-    0x00000007, 0x0000033c, 0x000001c6, 0x00000069, 0x0004003d, 0x00000006, 0x0000033d, 0x0000033c,
-    0x0004007c, 0x0000000f, 0x0000033e, 0x0000033d, 0x0004003d, 0x00000006, 0x0000033f, 0x000001e3,
-    0x0004007c, 0x0000000f, 0x00000340, 0x0000033f, 0x00050050, 0x00000010, 0x00000341, 0x0000033e,
-    0x00000340, 0x0004003d, 0x00000057, 0x00000342, 0x00000317, 0x00040063, 0x0000033b, 0x00000341,
-    0x00000342, 0x000200f9, 0x0000032f, 0x000200f8, 0x0000032f, 0x000200f9, 0x00000316, 0x000200f8,
-    0x00000343, 0x0004003d, 0x00000006, 0x00000348, 0x000001de, 0x00050084, 0x00000006, 0x0000034b,
-    0x00000348, 0x0000034a, 0x0004003d, 0x00000006, 0x0000034c, 0x000001e3, 0x00050084, 0x00000006,
-    0x0000034e, 0x0000034c, 0x0000034d, 0x00050080, 0x00000006, 0x0000034f, 0x0000034b, 0x0000034e,
-    0x00050041, 0x00000007, 0x00000350, 0x000001c6, 0x00000069, 0x0004003d, 0x00000006, 0x00000351,
-    0x00000350, 0x00050080, 0x00000006, 0x00000352, 0x0000034f, 0x00000351, 0x0004003d, 0x00000006,
-    0x00000353, 0x0000030d, 0x00060041, 0x000001c1, 0x00000354, 0x00000347, 0x000001bb, 0x00000352,
-    0x0003003e, 0x00000354, 0x00000353, 0x000200f9, 0x00000316, 0x000200f8, 0x00000316, 0x000100fd,
-    0x00010038, 0x00050036, 0x00000006, 0x0000000a, 0x00000000, 0x00000008, 0x00030037, 0x00000007,
-    0x00000009, 0x000200f8, 0x0000000b, 0x0004003d, 0x00000006, 0x00000046, 0x00000009, 0x00050084,
-    0x00000006, 0x00000048, 0x00000046, 0x00000047, 0x00050080, 0x00000006, 0x0000004a, 0x00000048,
-    0x00000049, 0x00050086, 0x00000006, 0x0000004c, 0x0000004a, 0x0000004b, 0x000200fe, 0x0000004c,
-    0x00010038, 0x00050036, 0x00000006, 0x0000000d, 0x00000000, 0x00000008, 0x00030037, 0x00000007,
-    0x0000000c, 0x000200f8, 0x0000000e, 0x0004003d, 0x00000006, 0x0000004f, 0x0000000c, 0x00050084,
-    0x00000006, 0x00000051, 0x0000004f, 0x00000050, 0x00050080, 0x00000006, 0x00000052, 0x00000051,
-    0x00000049, 0x00050086, 0x00000006, 0x00000053, 0x00000052, 0x0000004b, 0x000200fe, 0x00000053,
-    0x00010038, 0x00050036, 0x00000006, 0x00000014, 0x00000000, 0x00000012, 0x00030037, 0x00000011,
-    0x00000013, 0x000200f8, 0x00000015, 0x0004003b, 0x00000058, 0x00000059, 0x00000007, 0x0004003b,
-    0x00000061, 0x00000062, 0x00000007, 0x0004003b, 0x00000007, 0x00000068, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000006d, 0x00000007, 0x0004003b, 0x00000007, 0x00000075, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000007d, 0x00000007, 0x0004003d, 0x0000005a, 0x0000005d, 0x0000005c, 0x0004003d,
-    0x00000010, 0x0000005e, 0x00000013, 0x00050062, 0x00000057, 0x0000005f, 0x0000005d, 0x0000005e,
-    0x0003003e, 0x00000059, 0x0000005f, 0x0004003d, 0x00000057, 0x00000063, 0x00000059, 0x0005008e,
-    0x00000057, 0x00000065, 0x00000063, 0x00000064, 0x0006000c, 0x00000057, 0x00000066, 0x00000001,
-    0x00000001, 0x00000065, 0x0004006d, 0x00000060, 0x00000067, 0x00000066, 0x0003003e, 0x00000062,
-    0x00000067, 0x00050041, 0x00000007, 0x0000006a, 0x00000062, 0x00000069, 0x0004003d, 0x00000006,
-    0x0000006b, 0x0000006a, 0x0003003e, 0x00000068, 0x0000006b, 0x00050039, 0x00000006, 0x0000006c,
-    0x0000000a, 0x00000068, 0x00050041, 0x00000007, 0x0000006f, 0x00000062, 0x0000006e, 0x0004003d,
-    0x00000006, 0x00000070, 0x0000006f, 0x0003003e, 0x0000006d, 0x00000070, 0x00050039, 0x00000006,
-    0x00000071, 0x0000000a, 0x0000006d, 0x000500c4, 0x00000006, 0x00000073, 0x00000071, 0x00000072,
-    0x000500c5, 0x00000006, 0x00000074, 0x0000006c, 0x00000073, 0x00050041, 0x00000007, 0x00000077,
-    0x00000062, 0x00000076, 0x0004003d, 0x00000006, 0x00000078, 0x00000077, 0x0003003e, 0x00000075,
-    0x00000078, 0x00050039, 0x00000006, 0x00000079, 0x0000000a, 0x00000075, 0x000500c4, 0x00000006,
-    0x0000007b, 0x00000079, 0x0000007a, 0x000500c5, 0x00000006, 0x0000007c, 0x00000074, 0x0000007b,
-    0x00050041, 0x00000007, 0x0000007f, 0x00000062, 0x0000007e, 0x0004003d, 0x00000006, 0x00000080,
-    0x0000007f, 0x0003003e, 0x0000007d, 0x00000080, 0x00050039, 0x00000006, 0x00000081, 0x0000000d,
-    0x0000007d, 0x000500c4, 0x00000006, 0x00000083, 0x00000081, 0x00000082, 0x000500c5, 0x00000006,
-    0x00000084, 0x0000007c, 0x00000083, 0x000200fe, 0x00000084, 0x00010038, 0x00050036, 0x00000006,
-    0x00000017, 0x00000000, 0x00000008, 0x00030037, 0x00000007, 0x00000016, 0x000200f8, 0x00000018,
-    0x0004003d, 0x00000006, 0x00000087, 0x00000016, 0x000500c7, 0x00000006, 0x00000088, 0x00000087,
-    0x00000047, 0x000200fe, 0x00000088, 0x00010038, 0x00050036, 0x00000006, 0x0000001a, 0x00000000,
-    0x00000008, 0x00030037, 0x00000007, 0x00000019, 0x000200f8, 0x0000001b, 0x0004003d, 0x00000006,
-    0x0000008b, 0x00000019, 0x000500c2, 0x00000006, 0x0000008c, 0x0000008b, 0x00000072, 0x000500c7,
-    0x00000006, 0x0000008d, 0x0000008c, 0x00000047, 0x000200fe, 0x0000008d, 0x00010038, 0x00050036,
-    0x00000006, 0x0000001d, 0x00000000, 0x00000008, 0x00030037, 0x00000007, 0x0000001c, 0x000200f8,
-    0x0000001e, 0x0004003d, 0x00000006, 0x00000090, 0x0000001c, 0x000500c2, 0x00000006, 0x00000091,
-    0x00000090, 0x0000007a, 0x000500c7, 0x00000006, 0x00000092, 0x00000091, 0x00000047, 0x000200fe,
-    0x00000092, 0x00010038, 0x00050036, 0x00000006, 0x00000024, 0x00000000, 0x0000001f, 0x00030037,
-    0x00000007, 0x00000020, 0x00030037, 0x00000007, 0x00000021, 0x00030037, 0x00000007, 0x00000022,
-    0x00030037, 0x00000007, 0x00000023, 0x000200f8, 0x00000025, 0x0004003d, 0x00000006, 0x00000095,
-    0x00000020, 0x0007000c, 0x00000006, 0x00000096, 0x00000001, 0x00000026, 0x00000095, 0x00000047,
-    0x0004003d, 0x00000006, 0x00000097, 0x00000021, 0x0007000c, 0x00000006, 0x00000098, 0x00000001,
-    0x00000026, 0x00000097, 0x00000047, 0x000500c4, 0x00000006, 0x00000099, 0x00000098, 0x00000072,
-    0x000500c5, 0x00000006, 0x0000009a, 0x00000096, 0x00000099, 0x0004003d, 0x00000006, 0x0000009b,
-    0x00000022, 0x0007000c, 0x00000006, 0x0000009c, 0x00000001, 0x00000026, 0x0000009b, 0x00000047,
-    0x000500c4, 0x00000006, 0x0000009d, 0x0000009c, 0x0000007a, 0x000500c5, 0x00000006, 0x0000009e,
-    0x0000009a, 0x0000009d, 0x0004003d, 0x00000006, 0x0000009f, 0x00000023, 0x000500c4, 0x00000006,
-    0x000000a0, 0x0000009f, 0x00000082, 0x000500c5, 0x00000006, 0x000000a1, 0x0000009e, 0x000000a0,
-    0x000200fe, 0x000000a1, 0x00010038, 0x00050036, 0x00000006, 0x0000002a, 0x00000000, 0x0000001f,
-    0x00030037, 0x00000007, 0x00000026, 0x00030037, 0x00000007, 0x00000027, 0x00030037, 0x00000007,
-    0x00000028, 0x00030037, 0x00000007, 0x00000029, 0x000200f8, 0x0000002b, 0x0004003b, 0x00000007,
-    0x000000a4, 0x00000007, 0x0004003b, 0x00000007, 0x000000a9, 0x00000007, 0x0004003b, 0x00000007,
-    0x000000b3, 0x00000007, 0x0004003b, 0x00000007, 0x000000b8, 0x00000007, 0x0004003b, 0x00000007,
-    0x000000c0, 0x00000007, 0x0004003b, 0x00000007, 0x000000c5, 0x00000007, 0x0004003b, 0x00000007,
-    0x000000cd, 0x00000007, 0x0004003b, 0x00000007, 0x000000ce, 0x00000007, 0x0004003b, 0x00000007,
-    0x000000cf, 0x00000007, 0x0004003b, 0x00000007, 0x000000d0, 0x00000007, 0x0004003d, 0x00000006,
-    0x000000a5, 0x00000026, 0x0003003e, 0x000000a4, 0x000000a5, 0x00050039, 0x00000006, 0x000000a6,
-    0x00000017, 0x000000a4, 0x0004003d, 0x00000006, 0x000000a7, 0x00000028, 0x00050084, 0x00000006,
-    0x000000a8, 0x000000a6, 0x000000a7, 0x0004003d, 0x00000006, 0x000000aa, 0x00000027, 0x0003003e,
-    0x000000a9, 0x000000aa, 0x00050039, 0x00000006, 0x000000ab, 0x00000017, 0x000000a9, 0x0004003d,
-    0x00000006, 0x000000ac, 0x00000029, 0x00050084, 0x00000006, 0x000000ad, 0x000000ab, 0x000000ac,
-    0x00050080, 0x00000006, 0x000000ae, 0x000000a8, 0x000000ad, 0x00050080, 0x00000006, 0x000000b0,
-    0x000000ae, 0x000000af, 0x000500c2, 0x00000006, 0x000000b2, 0x000000b0, 0x000000b1, 0x0004003d,
-    0x00000006, 0x000000b4, 0x00000026, 0x0003003e, 0x000000b3, 0x000000b4, 0x00050039, 0x00000006,
-    0x000000b5, 0x0000001a, 0x000000b3, 0x0004003d, 0x00000006, 0x000000b6, 0x00000028, 0x00050084,
-    0x00000006, 0x000000b7, 0x000000b5, 0x000000b6, 0x0004003d, 0x00000006, 0x000000b9, 0x00000027,
-    0x0003003e, 0x000000b8, 0x000000b9, 0x00050039, 0x00000006, 0x000000ba, 0x0000001a, 0x000000b8,
-    0x0004003d, 0x00000006, 0x000000bb, 0x00000029, 0x00050084, 0x00000006, 0x000000bc, 0x000000ba,
-    0x000000bb, 0x00050080, 0x00000006, 0x000000bd, 0x000000b7, 0x000000bc, 0x00050080, 0x00000006,
-    0x000000be, 0x000000bd, 0x000000af, 0x000500c2, 0x00000006, 0x000000bf, 0x000000be, 0x000000b1,
-    0x0004003d, 0x00000006, 0x000000c1, 0x00000026, 0x0003003e, 0x000000c0, 0x000000c1, 0x00050039,
-    0x00000006, 0x000000c2, 0x0000001d, 0x000000c0, 0x0004003d, 0x00000006, 0x000000c3, 0x00000028,
-    0x00050084, 0x00000006, 0x000000c4, 0x000000c2, 0x000000c3, 0x0004003d, 0x00000006, 0x000000c6,
-    0x00000027, 0x0003003e, 0x000000c5, 0x000000c6, 0x00050039, 0x00000006, 0x000000c7, 0x0000001d,
-    0x000000c5, 0x0004003d, 0x00000006, 0x000000c8, 0x00000029, 0x00050084, 0x00000006, 0x000000c9,
-    0x000000c7, 0x000000c8, 0x00050080, 0x00000006, 0x000000ca, 0x000000c4, 0x000000c9, 0x00050080,
-    0x00000006, 0x000000cb, 0x000000ca, 0x000000af, 0x000500c2, 0x00000006, 0x000000cc, 0x000000cb,
-    0x000000b1, 0x0003003e, 0x000000cd, 0x000000b2, 0x0003003e, 0x000000ce, 0x000000bf, 0x0003003e,
-    0x000000cf, 0x000000cc, 0x0003003e, 0x000000d0, 0x0000004b, 0x00080039, 0x00000006, 0x000000d1,
-    0x00000024, 0x000000cd, 0x000000ce, 0x000000cf, 0x000000d0, 0x000200fe, 0x000000d1, 0x00010038,
-    0x00050036, 0x00000006, 0x0000002f, 0x00000000, 0x0000002c, 0x00030037, 0x00000007, 0x0000002d,
-    0x00030037, 0x00000007, 0x0000002e, 0x000200f8, 0x00000030, 0x0004003b, 0x00000007, 0x000000d4,
-    0x00000007, 0x0004003b, 0x00000007, 0x000000d9, 0x00000007, 0x0004003b, 0x00000007, 0x000000dd,
-    0x00000007, 0x0004003b, 0x00000007, 0x000000e2, 0x00000007, 0x0004003b, 0x00000007, 0x000000ec,
-    0x00000007, 0x0004003b, 0x00000007, 0x000000f1, 0x00000007, 0x0004003b, 0x00000007, 0x000000f9,
-    0x00000007, 0x0004003b, 0x00000007, 0x000000fe, 0x00000007, 0x0004003b, 0x00000007, 0x00000106,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000107, 0x00000007, 0x0004003b, 0x00000007, 0x00000108,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000109, 0x00000007, 0x0004003d, 0x00000006, 0x000000d5,
-    0x0000002d, 0x000500c2, 0x00000006, 0x000000d6, 0x000000d5, 0x00000082, 0x000500c7, 0x00000006,
-    0x000000d7, 0x000000d6, 0x00000050, 0x00050080, 0x00000006, 0x000000d8, 0x000000d7, 0x0000006e,
-    0x0003003e, 0x000000d4, 0x000000d8, 0x0004003d, 0x00000006, 0x000000db, 0x000000d4, 0x00050082,
-    0x00000006, 0x000000dc, 0x000000da, 0x000000db, 0x0003003e, 0x000000d9, 0x000000dc, 0x0004003d,
-    0x00000006, 0x000000de, 0x0000002d, 0x0003003e, 0x000000dd, 0x000000de, 0x00050039, 0x00000006,
-    0x000000df, 0x00000017, 0x000000dd, 0x0004003d, 0x00000006, 0x000000e0, 0x000000d4, 0x00050084,
-    0x00000006, 0x000000e1, 0x000000df, 0x000000e0, 0x0004003d, 0x00000006, 0x000000e3, 0x0000002e,
-    0x0003003e, 0x000000e2, 0x000000e3, 0x00050039, 0x00000006, 0x000000e4, 0x00000017, 0x000000e2,
-    0x0004003d, 0x00000006, 0x000000e5, 0x000000d9, 0x00050084, 0x00000006, 0x000000e6, 0x000000e4,
-    0x000000e5, 0x00050080, 0x00000006, 0x000000e7, 0x000000e1, 0x000000e6, 0x00050080, 0x00000006,
-    0x000000e9, 0x000000e7, 0x000000e8, 0x000500c2, 0x00000006, 0x000000eb, 0x000000e9, 0x000000ea,
-    0x0004003d, 0x00000006, 0x000000ed, 0x0000002d, 0x0003003e, 0x000000ec, 0x000000ed, 0x00050039,
-    0x00000006, 0x000000ee, 0x0000001a, 0x000000ec, 0x0004003d, 0x00000006, 0x000000ef, 0x000000d4,
-    0x00050084, 0x00000006, 0x000000f0, 0x000000ee, 0x000000ef, 0x0004003d, 0x00000006, 0x000000f2,
-    0x0000002e, 0x0003003e, 0x000000f1, 0x000000f2, 0x00050039, 0x00000006, 0x000000f3, 0x0000001a,
-    0x000000f1, 0x0004003d, 0x00000006, 0x000000f4, 0x000000d9, 0x00050084, 0x00000006, 0x000000f5,
-    0x000000f3, 0x000000f4, 0x00050080, 0x00000006, 0x000000f6, 0x000000f0, 0x000000f5, 0x00050080,
-    0x00000006, 0x000000f7, 0x000000f6, 0x000000e8, 0x000500c2, 0x00000006, 0x000000f8, 0x000000f7,
-    0x000000ea, 0x0004003d, 0x00000006, 0x000000fa, 0x0000002d, 0x0003003e, 0x000000f9, 0x000000fa,
-    0x00050039, 0x00000006, 0x000000fb, 0x0000001d, 0x000000f9, 0x0004003d, 0x00000006, 0x000000fc,
-    0x000000d4, 0x00050084, 0x00000006, 0x000000fd, 0x000000fb, 0x000000fc, 0x0004003d, 0x00000006,
-    0x000000ff, 0x0000002e, 0x0003003e, 0x000000fe, 0x000000ff, 0x00050039, 0x00000006, 0x00000100,
-    0x0000001d, 0x000000fe, 0x0004003d, 0x00000006, 0x00000101, 0x000000d9, 0x00050084, 0x00000006,
-    0x00000102, 0x00000100, 0x00000101, 0x00050080, 0x00000006, 0x00000103, 0x000000fd, 0x00000102,
-    0x00050080, 0x00000006, 0x00000104, 0x00000103, 0x000000e8, 0x000500c2, 0x00000006, 0x00000105,
-    0x00000104, 0x000000ea, 0x0003003e, 0x00000106, 0x000000eb, 0x0003003e, 0x00000107, 0x000000f8,
-    0x0003003e, 0x00000108, 0x00000105, 0x0003003e, 0x00000109, 0x0000004b, 0x00080039, 0x00000006,
-    0x0000010a, 0x00000024, 0x00000106, 0x00000107, 0x00000108, 0x00000109, 0x000200fe, 0x0000010a,
-    0x00010038, 0x00050036, 0x00000006, 0x00000035, 0x00000000, 0x00000031, 0x00030037, 0x00000007,
-    0x00000032, 0x00030037, 0x00000007, 0x00000033, 0x00030037, 0x00000007, 0x00000034, 0x000200f8,
-    0x00000036, 0x0004003b, 0x00000007, 0x0000010d, 0x00000007, 0x0004003b, 0x00000007, 0x00000110,
-    0x00000007, 0x0004003b, 0x00000007, 0x0000011a, 0x00000007, 0x0004003b, 0x00000007, 0x0000011d,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000127, 0x00000007, 0x0004003b, 0x00000007, 0x0000012a,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000134, 0x00000007, 0x0004003b, 0x00000007, 0x00000135,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000136, 0x00000007, 0x0004003b, 0x00000007, 0x00000137,
-    0x00000007, 0x0004003d, 0x00000006, 0x0000010e, 0x00000032, 0x0003003e, 0x0000010d, 0x0000010e,
-    0x00050039, 0x00000006, 0x0000010f, 0x00000017, 0x0000010d, 0x0004003d, 0x00000006, 0x00000111,
-    0x00000032, 0x0003003e, 0x00000110, 0x00000111, 0x00050039, 0x00000006, 0x00000112, 0x00000017,
-    0x00000110, 0x00050082, 0x00000006, 0x00000113, 0x00000047, 0x00000112, 0x0004003d, 0x00000006,
-    0x00000114, 0x00000033, 0x00050084, 0x00000006, 0x00000115, 0x00000113, 0x00000114, 0x0004003d,
-    0x00000006, 0x00000116, 0x00000034, 0x00050080, 0x00000006, 0x00000117, 0x00000115, 0x00000116,
-    0x000500c2, 0x00000006, 0x00000118, 0x00000117, 0x000000b1, 0x00050080, 0x00000006, 0x00000119,
-    0x0000010f, 0x00000118, 0x0004003d, 0x00000006, 0x0000011b, 0x00000032, 0x0003003e, 0x0000011a,
-    0x0000011b, 0x00050039, 0x00000006, 0x0000011c, 0x0000001a, 0x0000011a, 0x0004003d, 0x00000006,
-    0x0000011e, 0x00000032, 0x0003003e, 0x0000011d, 0x0000011e, 0x00050039, 0x00000006, 0x0000011f,
-    0x0000001a, 0x0000011d, 0x00050082, 0x00000006, 0x00000120, 0x00000047, 0x0000011f, 0x0004003d,
-    0x00000006, 0x00000121, 0x00000033, 0x00050084, 0x00000006, 0x00000122, 0x00000120, 0x00000121,
-    0x0004003d, 0x00000006, 0x00000123, 0x00000034, 0x00050080, 0x00000006, 0x00000124, 0x00000122,
-    0x00000123, 0x000500c2, 0x00000006, 0x00000125, 0x00000124, 0x000000b1, 0x00050080, 0x00000006,
-    0x00000126, 0x0000011c, 0x00000125, 0x0004003d, 0x00000006, 0x00000128, 0x00000032, 0x0003003e,
-    0x00000127, 0x00000128, 0x00050039, 0x00000006, 0x00000129, 0x0000001d, 0x00000127, 0x0004003d,
-    0x00000006, 0x0000012b, 0x00000032, 0x0003003e, 0x0000012a, 0x0000012b, 0x00050039, 0x00000006,
-    0x0000012c, 0x0000001d, 0x0000012a, 0x00050082, 0x00000006, 0x0000012d, 0x00000047, 0x0000012c,
-    0x0004003d, 0x00000006, 0x0000012e, 0x00000033, 0x00050084, 0x00000006, 0x0000012f, 0x0000012d,
-    0x0000012e, 0x0004003d, 0x00000006, 0x00000130, 0x00000034, 0x00050080, 0x00000006, 0x00000131,
-    0x0000012f, 0x00000130, 0x000500c2, 0x00000006, 0x00000132, 0x00000131, 0x000000b1, 0x00050080,
-    0x00000006, 0x00000133, 0x00000129, 0x00000132, 0x0003003e, 0x00000134, 0x00000119, 0x0003003e,
-    0x00000135, 0x00000126, 0x0003003e, 0x00000136, 0x00000133, 0x0003003e, 0x00000137, 0x0000004b,
-    0x00080039, 0x00000006, 0x00000138, 0x00000024, 0x00000134, 0x00000135, 0x00000136, 0x00000137,
-    0x000200fe, 0x00000138, 0x00010038, 0x00050036, 0x00000006, 0x0000003a, 0x00000000, 0x00000031,
-    0x00030037, 0x00000007, 0x00000037, 0x00030037, 0x00000007, 0x00000038, 0x00030037, 0x00000007,
-    0x00000039, 0x000200f8, 0x0000003b, 0x0004003b, 0x00000007, 0x0000013b, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000013e, 0x00000007, 0x0004003b, 0x00000007, 0x00000147, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000014a, 0x00000007, 0x0004003b, 0x00000007, 0x00000153, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000156, 0x00000007, 0x0004003b, 0x00000007, 0x0000015f, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000160, 0x00000007, 0x0004003b, 0x00000007, 0x00000161, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000162, 0x00000007, 0x0004003d, 0x00000006, 0x0000013c, 0x00000037, 0x0003003e,
-    0x0000013b, 0x0000013c, 0x00050039, 0x00000006, 0x0000013d, 0x00000017, 0x0000013b, 0x0004003d,
-    0x00000006, 0x0000013f, 0x00000037, 0x0003003e, 0x0000013e, 0x0000013f, 0x00050039, 0x00000006,
-    0x00000140, 0x00000017, 0x0000013e, 0x0004003d, 0x00000006, 0x00000141, 0x00000038, 0x00050084,
-    0x00000006, 0x00000142, 0x00000140, 0x00000141, 0x0004003d, 0x00000006, 0x00000143, 0x00000039,
-    0x00050080, 0x00000006, 0x00000144, 0x00000142, 0x00000143, 0x000500c2, 0x00000006, 0x00000145,
-    0x00000144, 0x000000b1, 0x00050082, 0x00000006, 0x00000146, 0x0000013d, 0x00000145, 0x0004003d,
-    0x00000006, 0x00000148, 0x00000037, 0x0003003e, 0x00000147, 0x00000148, 0x00050039, 0x00000006,
-    0x00000149, 0x0000001a, 0x00000147, 0x0004003d, 0x00000006, 0x0000014b, 0x00000037, 0x0003003e,
-    0x0000014a, 0x0000014b, 0x00050039, 0x00000006, 0x0000014c, 0x0000001a, 0x0000014a, 0x0004003d,
-    0x00000006, 0x0000014d, 0x00000038, 0x00050084, 0x00000006, 0x0000014e, 0x0000014c, 0x0000014d,
-    0x0004003d, 0x00000006, 0x0000014f, 0x00000039, 0x00050080, 0x00000006, 0x00000150, 0x0000014e,
-    0x0000014f, 0x000500c2, 0x00000006, 0x00000151, 0x00000150, 0x000000b1, 0x00050082, 0x00000006,
-    0x00000152, 0x00000149, 0x00000151, 0x0004003d, 0x00000006, 0x00000154, 0x00000037, 0x0003003e,
-    0x00000153, 0x00000154, 0x00050039, 0x00000006, 0x00000155, 0x0000001d, 0x00000153, 0x0004003d,
-    0x00000006, 0x00000157, 0x00000037, 0x0003003e, 0x00000156, 0x00000157, 0x00050039, 0x00000006,
-    0x00000158, 0x0000001d, 0x00000156, 0x0004003d, 0x00000006, 0x00000159, 0x00000038, 0x00050084,
-    0x00000006, 0x0000015a, 0x00000158, 0x00000159, 0x0004003d, 0x00000006, 0x0000015b, 0x00000039,
-    0x00050080, 0x00000006, 0x0000015c, 0x0000015a, 0x0000015b, 0x000500c2, 0x00000006, 0x0000015d,
-    0x0000015c, 0x000000b1, 0x00050082, 0x00000006, 0x0000015e, 0x00000155, 0x0000015d, 0x0003003e,
-    0x0000015f, 0x00000146, 0x0003003e, 0x00000160, 0x00000152, 0x0003003e, 0x00000161, 0x0000015e,
-    0x0003003e, 0x00000162, 0x0000004b, 0x00080039, 0x00000006, 0x00000163, 0x00000024, 0x0000015f,
-    0x00000160, 0x00000161, 0x00000162, 0x000200fe, 0x00000163, 0x00010038, 0x00050036, 0x00000006,
-    0x0000003d, 0x00000000, 0x00000008, 0x00030037, 0x00000007, 0x0000003c, 0x000200f8, 0x0000003e,
-    0x0004003b, 0x00000007, 0x00000166, 0x00000007, 0x0004003b, 0x00000007, 0x00000167, 0x00000007,
-    0x0004003b, 0x00000007, 0x0000016a, 0x00000007, 0x0004003b, 0x00000007, 0x0000016b, 0x00000007,
-    0x0004003b, 0x00000007, 0x0000016e, 0x00000007, 0x0004003b, 0x00000007, 0x0000016f, 0x00000007,
-    0x0004003b, 0x00000007, 0x00000172, 0x00000007, 0x0004003b, 0x00000007, 0x00000179, 0x00000007,
-    0x0004003b, 0x00000007, 0x0000017f, 0x00000007, 0x0004003d, 0x00000006, 0x00000168, 0x0000003c,
-    0x0003003e, 0x00000167, 0x00000168, 0x00050039, 0x00000006, 0x00000169, 0x00000017, 0x00000167,
-    0x0003003e, 0x00000166, 0x00000169, 0x0004003d, 0x00000006, 0x0000016c, 0x0000003c, 0x0003003e,
-    0x0000016b, 0x0000016c, 0x00050039, 0x00000006, 0x0000016d, 0x0000001a, 0x0000016b, 0x0003003e,
-    0x0000016a, 0x0000016d, 0x0004003d, 0x00000006, 0x00000170, 0x0000003c, 0x0003003e, 0x0000016f,
-    0x00000170, 0x00050039, 0x00000006, 0x00000171, 0x0000001d, 0x0000016f, 0x0003003e, 0x0000016e,
-    0x00000171, 0x0004003d, 0x00000006, 0x00000173, 0x00000166, 0x000500c4, 0x00000006, 0x00000175,
-    0x00000173, 0x00000174, 0x0004003d, 0x00000006, 0x00000176, 0x00000166, 0x000500c2, 0x00000006,
-    0x00000177, 0x00000176, 0x000000b1, 0x000500c5, 0x00000006, 0x00000178, 0x00000175, 0x00000177,
-    0x0003003e, 0x00000172, 0x00000178, 0x0004003d, 0x00000006, 0x0000017a, 0x0000016a, 0x000500c4,
-    0x00000006, 0x0000017b, 0x0000017a, 0x00000174, 0x0004003d, 0x00000006, 0x0000017c, 0x0000016a,
-    0x000500c2, 0x00000006, 0x0000017d, 0x0000017c, 0x000000b1, 0x000500c5, 0x00000006, 0x0000017e,
-    0x0000017b, 0x0000017d, 0x0003003e, 0x00000179, 0x0000017e, 0x0004003d, 0x00000006, 0x00000180,
-    0x0000016e, 0x000500c4, 0x00000006, 0x00000181, 0x00000180, 0x00000174, 0x0004003d, 0x00000006,
-    0x00000182, 0x0000016e, 0x000500c2, 0x00000006, 0x00000183, 0x00000182, 0x000000b1, 0x000500c5,
-    0x00000006, 0x00000184, 0x00000181, 0x00000183, 0x0003003e, 0x0000017f, 0x00000184, 0x0004003d,
-    0x00000006, 0x00000185, 0x0000017f, 0x0004003d, 0x00000006, 0x00000186, 0x00000179, 0x000500c4,
-    0x00000006, 0x00000187, 0x00000186, 0x00000072, 0x000500c5, 0x00000006, 0x00000188, 0x00000185,
-    0x00000187, 0x0004003d, 0x00000006, 0x00000189, 0x00000172, 0x000500c4, 0x00000006, 0x0000018a,
-    0x00000189, 0x0000007a, 0x000500c5, 0x00000006, 0x0000018b, 0x00000188, 0x0000018a, 0x000500c5,
-    0x00000006, 0x0000018d, 0x0000018b, 0x0000018c, 0x000200fe, 0x0000018d, 0x00010038, 0x00050036,
-    0x00000006, 0x00000044, 0x00000000, 0x00000041, 0x00030037, 0x00000007, 0x00000042, 0x00030037,
-    0x00000040, 0x00000043, 0x000200f8, 0x00000045, 0x0004003b, 0x00000007, 0x00000190, 0x00000007,
-    0x0004003b, 0x00000007, 0x00000194, 0x00000007, 0x0004003b, 0x00000007, 0x00000199, 0x00000007,
-    0x0004003b, 0x00000007, 0x0000019e, 0x00000007, 0x0004003b, 0x00000007, 0x000001a5, 0x00000007,
-    0x0004003b, 0x00000007, 0x000001af, 0x00000007, 0x0004003d, 0x00000006, 0x00000191, 0x00000042,
-    0x000500c7, 0x00000006, 0x00000193, 0x00000191, 0x00000192, 0x0003003e, 0x00000190, 0x00000193,
-    0x0004003d, 0x00000006, 0x00000195, 0x00000042, 0x000500c2, 0x00000006, 0x00000197, 0x00000195,
-    0x00000196, 0x000500c7, 0x00000006, 0x00000198, 0x00000197, 0x0000007e, 0x0003003e, 0x00000194,
-    0x00000198, 0x0004003d, 0x00000006, 0x0000019a, 0x00000042, 0x000500c2, 0x00000006, 0x0000019c,
-    0x0000019a, 0x0000019b, 0x000500c7, 0x00000006, 0x0000019d, 0x0000019c, 0x0000006e, 0x0003003e,
-    0x00000199, 0x0000019d, 0x0003003e, 0x0000019e, 0x000001a4, 0x0004003d, 0x00000006, 0x000001a6,
-    0x00000199, 0x00050084, 0x00000006, 0x000001a8, 0x000001a6, 0x000001a7, 0x0004003d, 0x00000006,
-    0x000001a9, 0x00000194, 0x00050080, 0x00000006, 0x000001aa, 0x000001a8, 0x000001a9, 0x00050084,
-    0x00000006, 0x000001ac, 0x000001aa, 0x000001ab, 0x0004003d, 0x00000006, 0x000001ad, 0x00000190,
-    0x00050080, 0x00000006, 0x000001ae, 0x000001ac, 0x000001ad, 0x0003003e, 0x000001a5, 0x000001ae,
-    0x00050041, 0x00000007, 0x000001b0, 0x00000043, 0x0000006e, 0x0004003d, 0x00000006, 0x000001b1,
-    0x000001b0, 0x00050084, 0x00000006, 0x000001b3, 0x000001b1, 0x000001b2, 0x00050041, 0x00000007,
-    0x000001b4, 0x00000043, 0x00000069, 0x0004003d, 0x00000006, 0x000001b5, 0x000001b4, 0x00050080,
-    0x00000006, 0x000001b6, 0x000001b3, 0x000001b5, 0x0003003e, 0x000001af, 0x000001b6, 0x0004003d,
-    0x00000006, 0x000001bc, 0x000001a5, 0x0004003d, 0x00000006, 0x000001bd, 0x0000019e, 0x00050084,
-    0x00000006, 0x000001be, 0x000001bc, 0x000001bd, 0x0004003d, 0x00000006, 0x000001bf, 0x000001af,
-    0x00050080, 0x00000006, 0x000001c0, 0x000001be, 0x000001bf, 0x00060041, 0x000001c1, 0x000001c2,
-    0x000001ba, 0x000001bb, 0x000001c0, 0x0004003d, 0x00000006, 0x000001c3, 0x000001c2, 0x000200fe,
-    0x000001c3, 0x00010038,
+const uint8_t Blob035_Data[5583] =
+{
+    0x28, 0xb5, 0x2f, 0xfd, 0x60, 0x68, 0x54, 0x2d, 0xae, 0x00, 0x5a, 0xc2, 0x74, 0x2f, 0x38, 0x10,
+    0x88, 0x5c, 0x63, 0xaf, 0x40, 0x85, 0x52, 0x15, 0x00, 0x80, 0x3a, 0x20, 0x40, 0x48, 0x11, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0xc0, 0xf1, 0x23, 0x5b, 0x19, 0x59, 0xc1, 0x2a, 0x88, 0x0b, 0x49, 0x52,
+    0x92, 0x8a, 0x7f, 0xe9, 0xb4, 0xa1, 0xa1, 0xc2, 0x86, 0x46, 0xda, 0x3b, 0x45, 0x54, 0x52, 0x3c,
+    0xac, 0x45, 0x88, 0x25, 0x52, 0xca, 0x14, 0x9f, 0x02, 0xda, 0x02, 0x10, 0x03, 0x83, 0xb9, 0xce,
+    0x17, 0x18, 0x06, 0xfc, 0xbb, 0xbf, 0xcf, 0xf7, 0x0c, 0xf7, 0xaf, 0xdf, 0xe1, 0x9d, 0x80, 0x0f,
+    0xdf, 0xe6, 0x59, 0x7c, 0xae, 0xee, 0xad, 0x2f, 0x15, 0xeb, 0xf8, 0x55, 0xce, 0xfb, 0x15, 0x8b,
+    0xbf, 0x6f, 0x67, 0xe0, 0xef, 0x9e, 0x78, 0x8c, 0x17, 0xd7, 0xf5, 0x76, 0x96, 0xbb, 0x53, 0x8d,
+    0xb2, 0x45, 0x43, 0x41, 0xd1, 0xfa, 0x3d, 0xff, 0xe0, 0xf9, 0xcf, 0xd2, 0x69, 0xb3, 0x06, 0xf3,
+    0x72, 0xcc, 0x96, 0x2c, 0x96, 0x94, 0x50, 0x26, 0x25, 0x69, 0x48, 0xdc, 0xc7, 0xd7, 0xba, 0xd7,
+    0x71, 0x86, 0x36, 0xc4, 0x6f, 0x6f, 0x30, 0x36, 0x0a, 0x84, 0x87, 0x07, 0x07, 0xf1, 0x00, 0xed,
+    0x0f, 0xd7, 0x01, 0x45, 0xf7, 0xa0, 0xaf, 0x07, 0xbe, 0xf7, 0x9a, 0xfe, 0x43, 0x7c, 0x6f, 0xce,
+    0xf7, 0xbb, 0x6f, 0x1f, 0xc3, 0x85, 0xc5, 0x61, 0xfd, 0x0b, 0x47, 0x18, 0x1e, 0x5f, 0x3f, 0xbc,
+    0xcd, 0x41, 0x43, 0x1c, 0x18, 0x38, 0x51, 0xbb, 0x8f, 0xbf, 0x61, 0xec, 0xf5, 0xf0, 0x8f, 0xbe,
+    0x82, 0x15, 0x68, 0xbd, 0xf0, 0xed, 0x37, 0x01, 0x62, 0x38, 0xdf, 0x6a, 0xfd, 0x2d, 0xc6, 0x13,
+    0xe0, 0x55, 0xdc, 0xbb, 0x3b, 0x17, 0xf5, 0x9f, 0x77, 0x53, 0xbb, 0xdf, 0x5d, 0x3c, 0xc5, 0xc9,
+    0xdf, 0xec, 0x1d, 0xfd, 0x7f, 0x7a, 0xfe, 0xe8, 0x8b, 0xc7, 0x60, 0xbd, 0x6e, 0xab, 0x1d, 0xef,
+    0xe2, 0xcf, 0x08, 0xdf, 0x2e, 0x9e, 0xed, 0xc4, 0xc3, 0xf7, 0x1b, 0xae, 0xdf, 0x5d, 0x30, 0xe7,
+    0x1d, 0xc0, 0xcd, 0x3f, 0x9c, 0xac, 0xbf, 0x01, 0xbc, 0x33, 0x3f, 0x8c, 0xf9, 0x38, 0xdd, 0x97,
+    0xff, 0xb8, 0x3a, 0xfd, 0xd6, 0x7e, 0xc9, 0x7a, 0x5d, 0xf7, 0xce, 0x7e, 0xbb, 0x56, 0x6c, 0x97,
+    0x3b, 0x25, 0xa7, 0x44, 0xf2, 0xe1, 0xa0, 0xff, 0x1f, 0x1c, 0xbf, 0x45, 0x1e, 0xe2, 0x5b, 0xbd,
+    0xee, 0xf1, 0xbb, 0x5d, 0x5c, 0x7b, 0x63, 0x6e, 0x06, 0xa1, 0x78, 0x9b, 0xfb, 0xe9, 0x38, 0xbe,
+    0x6b, 0xf5, 0x62, 0x00, 0xed, 0xf8, 0x35, 0x8c, 0x77, 0xc1, 0xde, 0x3b, 0x0c, 0xe3, 0x6d, 0xfd,
+    0x9b, 0x87, 0x77, 0x9c, 0xbc, 0xe2, 0x0d, 0xf5, 0xdb, 0x44, 0x38, 0x8c, 0xef, 0xdb, 0xed, 0x2d,
+    0xe2, 0xa1, 0xd9, 0x45, 0x2e, 0x62, 0xd9, 0xbe, 0x7f, 0xb3, 0xba, 0x21, 0xb7, 0x90, 0x3b, 0xb6,
+    0x0f, 0x7e, 0x9d, 0xbd, 0x05, 0xb1, 0x7d, 0x7a, 0x08, 0xac, 0x6b, 0x68, 0x64, 0x63, 0x62, 0x61,
+    0x59, 0x57, 0x55, 0xa7, 0xa3, 0xa2, 0x20, 0x69, 0x74, 0xb6, 0x3d, 0x39, 0xeb, 0xc4, 0x49, 0x53,
+    0xe6, 0xc5, 0x74, 0xf9, 0x3a, 0x0b, 0x16, 0xcb, 0x2b, 0x51, 0x24, 0x23, 0x85, 0x38, 0xda, 0xa0,
+    0x30, 0xf6, 0x7a, 0xef, 0xfd, 0x06, 0x13, 0xfe, 0x6f, 0xf1, 0xc4, 0x5c, 0xac, 0xdf, 0x63, 0x08,
+    0x59, 0x07, 0xb8, 0x18, 0xb0, 0x8b, 0x1f, 0xe6, 0x57, 0x3d, 0x27, 0x14, 0xe7, 0x7e, 0x5b, 0xbc,
+    0x7b, 0x6b, 0xc3, 0x70, 0x5a, 0x1d, 0xdf, 0xf1, 0x41, 0xfc, 0x0d, 0x68, 0x4c, 0xde, 0x6f, 0x2d,
+    0xbe, 0xcd, 0xf5, 0xf0, 0x7d, 0x2c, 0x06, 0xdf, 0x70, 0x71, 0x9f, 0x56, 0x76, 0xef, 0xdc, 0xb7,
+    0xef, 0x9e, 0x1a, 0x90, 0x59, 0x19, 0x99, 0x1e, 0xe1, 0x1b, 0x77, 0xf6, 0x41, 0xff, 0xe1, 0x3b,
+    0xcf, 0x86, 0x89, 0xb5, 0xf7, 0x20, 0xd8, 0xd7, 0x83, 0xf9, 0xc2, 0x61, 0x5c, 0x17, 0x13, 0x72,
+    0xf3, 0xfd, 0x4d, 0xec, 0xa5, 0x5b, 0x5a, 0x62, 0x5c, 0x6f, 0x67, 0x0b, 0xdc, 0x64, 0x1c, 0x6b,
+    0xab, 0x7f, 0xb5, 0x78, 0xf8, 0x4a, 0x1c, 0xde, 0xf3, 0x41, 0xab, 0xb0, 0xad, 0x8e, 0x77, 0xdf,
+    0xb2, 0xee, 0xbb, 0x2a, 0x4b, 0xc5, 0x9d, 0xfa, 0xdf, 0xa5, 0xbe, 0x36, 0xd4, 0xde, 0xd7, 0x01,
+    0x2f, 0x7d, 0x7a, 0xab, 0x36, 0x59, 0x9d, 0x76, 0xed, 0x52, 0xde, 0xd8, 0xfe, 0xed, 0x7e, 0xe1,
+    0xa8, 0xaf, 0x7f, 0x73, 0x71, 0x1e, 0xfe, 0x82, 0x93, 0xbe, 0x72, 0x32, 0xd6, 0xdb, 0x5c, 0xf7,
+    0xd6, 0xf3, 0xb9, 0xed, 0xfd, 0xbd, 0x53, 0x22, 0x12, 0xbb, 0x09, 0xc1, 0x5d, 0xb7, 0x22, 0x7c,
+    0xdc, 0xbd, 0xc9, 0x41, 0xff, 0x8f, 0xe6, 0x35, 0xc6, 0x1a, 0xcb, 0x72, 0xf3, 0xbe, 0x7b, 0x65,
+    0xde, 0xfd, 0xab, 0xf3, 0x09, 0x7d, 0xf4, 0xa1, 0xdb, 0x71, 0x57, 0xab, 0xe7, 0xd2, 0xc7, 0xc9,
+    0xb9, 0x58, 0x8b, 0xef, 0xf9, 0x16, 0x8b, 0xeb, 0x79, 0x17, 0x8b, 0x77, 0x11, 0xc5, 0x61, 0x2c,
+    0x18, 0xac, 0xc5, 0xca, 0xdd, 0x59, 0xf1, 0xf0, 0xac, 0x58, 0xa1, 0x87, 0x4e, 0xd2, 0xf5, 0x2c,
+    0x45, 0x82, 0x1e, 0x4d, 0xf9, 0xff, 0xd7, 0xf3, 0xdb, 0x0b, 0x05, 0x9a, 0xfe, 0xbf, 0xd1, 0x77,
+    0x89, 0x85, 0x6d, 0x6d, 0xc5, 0xe1, 0xad, 0x3b, 0xbd, 0x3b, 0xab, 0xfd, 0x3f, 0x3f, 0xfd, 0x48,
+    0x5f, 0x17, 0xbe, 0xf4, 0x87, 0x7e, 0xae, 0x3f, 0x5a, 0x45, 0xd7, 0x01, 0x55, 0x06, 0x0e, 0x64,
+    0x19, 0x28, 0x80, 0x95, 0x55, 0xde, 0x2c, 0x70, 0x35, 0x00, 0xab, 0x6c, 0x45, 0xe0, 0x0a, 0x93,
+    0x00, 0x55, 0xd4, 0x94, 0x14, 0xd5, 0xe4, 0x54, 0x0a, 0x8a, 0x5a, 0x85, 0x7a, 0xaa, 0x0a, 0x70,
+    0x7a, 0x12, 0xd0, 0xc4, 0xe4, 0xc4, 0xb4, 0x34, 0x0d, 0xb0, 0xa4, 0x14, 0x20, 0x09, 0x80, 0x52,
+    0x12, 0xd2, 0x11, 0x80, 0x23, 0xa3, 0x68, 0x91, 0x11, 0x51, 0xd1, 0x90, 0x10, 0xd1, 0x50, 0x90,
+    0x54, 0x88, 0x53, 0x6a, 0x77, 0xda, 0xd0, 0x24, 0x40, 0x4e, 0xdc, 0x6a, 0x1a, 0x7a, 0xa7, 0xe6,
+    0xa4, 0xff, 0x70, 0xfa, 0xe9, 0xf3, 0x07, 0xb3, 0x0f, 0x9f, 0x3b, 0x7b, 0xf0, 0xf0, 0x29, 0xeb,
+    0xc9, 0xb3, 0x67, 0x33, 0xcf, 0x1b, 0x3c, 0x76, 0x36, 0xeb, 0xd0, 0xb1, 0x93, 0x49, 0x67, 0xce,
+    0x1b, 0x39, 0x71, 0xe6, 0xc0, 0x89, 0x93, 0xc3, 0x71, 0x93, 0xa9, 0xb9, 0xc6, 0x0d, 0x63, 0x1b,
+    0x36, 0x9a, 0x8d, 0x98, 0x6c, 0xd4, 0xac, 0x51, 0x93, 0x06, 0x73, 0x0d, 0xcd, 0x99, 0x34, 0x36,
+    0x06, 0x33, 0x67, 0xcc, 0x5c, 0xce, 0xdf, 0x49, 0xe6, 0x92, 0xcc, 0x98, 0xcb, 0x2d, 0x62, 0x80,
+    0xc6, 0x7c, 0x1e, 0x2e, 0xf4, 0x73, 0x86, 0xf1, 0x22, 0xa6, 0x8b, 0x17, 0xbd, 0xcb, 0x96, 0x2d,
+    0x5a, 0xfa, 0x70, 0xd9, 0xa3, 0xc5, 0x8a, 0x0e, 0x2c, 0x96, 0x59, 0xac, 0xfc, 0x98, 0x2d, 0x6d,
+    0x35, 0xca, 0x2b, 0x51, 0xb7, 0x2a, 0x6b, 0x5f, 0x85, 0x0d, 0x8f, 0x8a, 0x1a, 0xf5, 0xcf, 0xa8,
+    0x68, 0x28, 0x28, 0x5a, 0xbf, 0xe7, 0x1f, 0x3c, 0x74, 0xda, 0xac, 0xc1, 0xbc, 0x1c, 0xb3, 0x25,
+    0x8b, 0x25, 0x25, 0x94, 0x49, 0x49, 0x48, 0x1f, 0x8e, 0x33, 0x90, 0x38, 0x68, 0x48, 0xd4, 0x62,
+    0x03, 0xff, 0xae, 0x6d, 0x0a, 0xbc, 0xb4, 0xaa, 0xa2, 0xa8, 0x53, 0x3a, 0xda, 0xc9, 0x79, 0x67,
+    0xf3, 0x4d, 0x26, 0x66, 0x34, 0x4a, 0xd9, 0x06, 0xc4, 0xe7, 0x81, 0x7e, 0xac, 0x2d, 0x97, 0x22,
+    0xb4, 0xf5, 0x47, 0xae, 0xfd, 0x07, 0x5e, 0xa8, 0x42, 0x79, 0x50, 0x12, 0x0f, 0xda, 0xfe, 0x6b,
+    0x3f, 0x2b, 0x79, 0xd3, 0x82, 0xd8, 0x40, 0x1a, 0xfb, 0xe0, 0x3f, 0xf0, 0x8d, 0xe8, 0xbe, 0x07,
+    0x54, 0xc1, 0x27, 0xaa, 0x06, 0xd2, 0x67, 0xb0, 0x7f, 0x01, 0xdc, 0x33, 0xfc, 0x49, 0xf9, 0xb5,
+    0xf5, 0x75, 0xf1, 0xd5, 0x09, 0x6a, 0x04, 0x5f, 0x1a, 0xeb, 0xac, 0xf5, 0xdc, 0xd7, 0x72, 0x75,
+    0xdc, 0x9f, 0x7d, 0x57, 0x8d, 0x14, 0x15, 0x53, 0x46, 0x32, 0xe5, 0x61, 0x8f, 0x98, 0x45, 0x84,
+    0x40, 0x0b, 0x02, 0x61, 0x4f, 0x85, 0x1e, 0xea, 0x02, 0xe3, 0xb8, 0x4b, 0x7f, 0x3e, 0x8d, 0x06,
+    0x7e, 0x3a, 0xa0, 0x32, 0xc8, 0xed, 0xfe, 0xe9, 0xda, 0xd8, 0x3e, 0x4c, 0xd2, 0x4a, 0xa8, 0x3c,
+    0x80, 0x69, 0xea, 0xbf, 0x69, 0x2e, 0x23, 0x49, 0xd2, 0x41, 0x36, 0x3d, 0xff, 0x27, 0xfd, 0x9e,
+    0x9f, 0x9e, 0xf5, 0xbf, 0x9f, 0xd7, 0x93, 0xd7, 0x99, 0x21, 0xa7, 0x0d, 0x1a, 0x72, 0x63, 0x98,
+    0xbc, 0x0c, 0x46, 0xf2, 0x4b, 0x1e, 0x03, 0x8b, 0x15, 0xa5, 0x29, 0x68, 0x95, 0x52, 0xea, 0x4a,
+    0xdb, 0xc9, 0x27, 0x41, 0x82, 0x46, 0x74, 0x44, 0xca, 0x08, 0x54, 0xfd, 0xd5, 0x20, 0xf3, 0x3f,
+    0x0f, 0x68, 0x0e, 0xbb, 0x46, 0xa3, 0x8d, 0x1a, 0x79, 0x99, 0x86, 0x2d, 0x23, 0xc3, 0x8c, 0x0f,
+    0x93, 0x31, 0x7f, 0x8c, 0x2f, 0xa8, 0x16, 0x4f, 0x28, 0x3e, 0x3f, 0x49, 0x7c, 0x7a, 0xa0, 0xc5,
+    0x40, 0x6f, 0x8e, 0x34, 0xa5, 0xc6, 0x40, 0x21, 0xa5, 0x8f, 0x4c, 0x8c, 0xb5, 0xe2, 0x51, 0x22,
+    0x4d, 0x96, 0xee, 0xd3, 0x59, 0xff, 0x1c, 0x6e, 0x71, 0xdb, 0x67, 0x40, 0x30, 0x7a, 0xdb, 0x82,
+    0xd4, 0x77, 0x80, 0xc6, 0xe0, 0x1b, 0xd0, 0x3f, 0x33, 0x68, 0xf2, 0xfb, 0x83, 0xfa, 0x49, 0xf5,
+    0x2d, 0x45, 0x5d, 0x3f, 0xed, 0x16, 0xeb, 0xd8, 0xac, 0x06, 0xda, 0xdc, 0xd8, 0xda, 0x6c, 0xb6,
+    0xa8, 0xd7, 0xd4, 0x81, 0xa9, 0x68, 0xd4, 0x14, 0x12, 0x80, 0x23, 0x24, 0x7a, 0x7a, 0x44, 0x9d,
+    0xa7, 0x51, 0x5b, 0x3a, 0x65, 0x47, 0xa3, 0x52, 0x52, 0x76, 0x00, 0xba, 0xa6, 0x93, 0x9a, 0xb8,
+    0x2f, 0x28, 0x48, 0x37, 0x14, 0x27, 0xd4, 0x16, 0x94, 0x26, 0x2d, 0x8b, 0x86, 0xd9, 0x74, 0x17,
+    0xd0, 0x11, 0x94, 0xa8, 0x96, 0xd2, 0xd0, 0xf9, 0x03, 0x6d, 0x07, 0xf4, 0xcc, 0x57, 0x54, 0x7f,
+    0xdc, 0x19, 0x80, 0xb3, 0xb3, 0xa6, 0x1a, 0xa9, 0xee, 0x7a, 0x8a, 0x32, 0xd9, 0x4a, 0x40, 0x47,
+    0x50, 0xa2, 0x5a, 0x4a, 0x43, 0xe7, 0xff, 0x0f, 0x44, 0xf4, 0xfc, 0xf9, 0xc9, 0xf4, 0x49, 0xe7,
+    0x39, 0xcf, 0x5f, 0x9e, 0x86, 0xa6, 0x18, 0x4d, 0x3d, 0x15, 0x12, 0xba, 0xae, 0x8a, 0xa4, 0x83,
+    0xda, 0x46, 0xe6, 0x67, 0xaa, 0x87, 0xa6, 0x9e, 0xca, 0x2a, 0xf8, 0xe0, 0xdb, 0x2b, 0xce, 0xdf,
+    0x86, 0xa4, 0x2f, 0xf4, 0xe2, 0xc1, 0x9c, 0x50, 0x2f, 0x88, 0xfb, 0x9d, 0x93, 0xfe, 0x2e, 0x16,
+    0xbb, 0x45, 0x09, 0xc5, 0x60, 0x3c, 0xce, 0xfe, 0xfd, 0xc6, 0xbb, 0x70, 0x78, 0x37, 0x7b, 0xef,
+    0xe9, 0xdf, 0xaf, 0x58, 0x87, 0x8b, 0x7b, 0xfb, 0xe9, 0xf9, 0x9f, 0x8b, 0xd8, 0xfd, 0x5e, 0xbd,
+    0x63, 0x05, 0x81, 0xde, 0xfd, 0x1b, 0x5c, 0x41, 0xef, 0x3c, 0x0f, 0x3e, 0xd1, 0x16, 0x07, 0x01,
+    0xa8, 0xf5, 0xc3, 0x02, 0xae, 0x3d, 0xc0, 0xfa, 0x65, 0x93, 0x02, 0x8f, 0x1c, 0x3c, 0x60, 0xa0,
+    0x46, 0x61, 0xec, 0x25, 0x8c, 0x66, 0xef, 0x28, 0xe0, 0x1f, 0x5a, 0x80, 0x24, 0x24, 0x00, 0x4a,
+    0x7a, 0x79, 0x7a, 0x0b, 0xf2, 0xae, 0x0b, 0x88, 0xf0, 0x8c, 0x88, 0x8a, 0xca, 0xee, 0x3c, 0xed,
+    0xee, 0x30, 0xd4, 0x21, 0x28, 0x5b, 0xe9, 0x1a, 0xe7, 0x86, 0xf8, 0x04, 0x45, 0xc9, 0xa4, 0x2f,
+    0x34, 0x56, 0xd6, 0xb9, 0xa4, 0xb7, 0x97, 0x67, 0xdd, 0xd3, 0x5b, 0x80, 0x97, 0x77, 0x5d, 0x70,
+    0x55, 0x80, 0x97, 0xe0, 0x4e, 0x41, 0xe6, 0x1d, 0x02, 0x3a, 0x3b, 0x4c, 0x3a, 0xb8, 0x25, 0xae,
+    0x37, 0x37, 0xb4, 0xb7, 0xb6, 0x35, 0x37, 0xb6, 0x36, 0x36, 0xb5, 0xb5, 0x34, 0xb5, 0xb4, 0x33,
+    0x34, 0x33, 0xae, 0xb2, 0x7f, 0x2d, 0xb5, 0xcc, 0x6f, 0x2c, 0x8c, 0x4c, 0x6c, 0x2c, 0x53, 0x0c,
+    0x2c, 0x6c, 0x3a, 0xe1, 0x0b, 0x8c, 0xf2, 0x2b, 0xda, 0xe5, 0xc5, 0x60, 0xcb, 0x6c, 0x4b, 0x8b,
+    0x2b, 0x3f, 0xa0, 0x35, 0x63, 0x1e, 0x30, 0x40, 0xcd, 0x22, 0x30, 0xf5, 0x64, 0xc0, 0xef, 0x5a,
+    0x20, 0x0b, 0xab, 0xc0, 0x15, 0xd6, 0x94, 0xd5, 0x95, 0xd5, 0x00, 0x02, 0x55, 0x03, 0xa8, 0xaa,
+    0x2a, 0xa9, 0xa4, 0xa6, 0xa2, 0xa4, 0xa0, 0xa2, 0x1e, 0xab, 0x50, 0xd5, 0xed, 0x53, 0x9f, 0x06,
+    0x27, 0x01, 0x7d, 0x60, 0xbb, 0x26, 0x27, 0xcd, 0xa6, 0xba, 0x88, 0x29, 0x00, 0x5c, 0x00, 0xa5,
+    0xa5, 0x5a, 0xe9, 0x3f, 0x09, 0x09, 0xc0, 0x51, 0xd1, 0xff, 0x91, 0xd9, 0xd4, 0x68, 0xba, 0xb9,
+    0xe9, 0xc7, 0xb6, 0x89, 0x86, 0xfe, 0x9f, 0x88, 0xc7, 0x90, 0x50, 0x10, 0x1e, 0x21, 0x69, 0x54,
+    0x0a, 0x64, 0x03, 0xd5, 0x36, 0x19, 0x4a, 0xa7, 0xae, 0x69, 0x3f, 0xef, 0xf9, 0xa7, 0x9e, 0xf3,
+    0xff, 0xf4, 0xc4, 0xf3, 0xd9, 0xf9, 0xc7, 0xab, 0xb3, 0x4f, 0x4d, 0xf7, 0xe1, 0xf4, 0xc3, 0x87,
+    0x93, 0x0e, 0x9f, 0x3d, 0x78, 0x34, 0xad, 0xe6, 0x3d, 0x44, 0x79, 0xf4, 0x54, 0xe5, 0xb9, 0x43,
+    0x47, 0xd1, 0xce, 0x9d, 0x3a, 0x76, 0xea, 0xcc, 0xd9, 0x9c, 0x23, 0x67, 0x33, 0x8e, 0x1c, 0xad,
+    0x38, 0x72, 0x72, 0x7e, 0x7e, 0x3a, 0x74, 0x34, 0xb9, 0x12, 0x46, 0x0d, 0x9c, 0x44, 0x38, 0x6f,
+    0xd4, 0xb8, 0xf1, 0x6a, 0xb3, 0x86, 0xcb, 0x8d, 0x66, 0x1b, 0x4d, 0x36, 0x6b, 0xd8, 0x64, 0xbe,
+    0xc9, 0x4c, 0xa3, 0x26, 0x07, 0x9a, 0x34, 0x68, 0xce, 0x84, 0x31, 0x83, 0x79, 0x39, 0xe6, 0xcc,
+    0x0c, 0x2d, 0x06, 0xb3, 0xcc, 0x65, 0x19, 0x32, 0x63, 0xc8, 0x80, 0x39, 0x03, 0xe6, 0x4b, 0x18,
+    0x45, 0x2f, 0x5f, 0xbc, 0x74, 0xb9, 0xc2, 0x65, 0x4b, 0x16, 0x4b, 0x31, 0x2e, 0xd1, 0x37, 0xdb,
+    0xa2, 0x25, 0x8b, 0x16, 0x2c, 0x96, 0x58, 0xac, 0x74, 0xb1, 0x52, 0xe5, 0x0a, 0x99, 0x4a, 0x15,
+    0x2a, 0x53, 0x9a, 0x48, 0xa1, 0x84, 0x32, 0x29, 0x99, 0x25, 0x45, 0x5a, 0x49, 0x09, 0x59, 0x19,
+    0x05, 0x8a, 0x8f, 0x28, 0x4f, 0x26, 0x13, 0x9f, 0x38, 0x91, 0x8c, 0x3a, 0xb1, 0x99, 0x4c, 0x61,
+    0xb2, 0xa4, 0x89, 0x11, 0x25, 0x39, 0x8a, 0x2c, 0x89, 0x8c, 0x4c, 0xa2, 0x04, 0xc9, 0x91, 0x24,
+    0x47, 0x8c, 0x44, 0x1a, 0x29, 0x12, 0xa9, 0x13, 0x29, 0xe2, 0x48, 0x64, 0x08, 0xa4, 0x90, 0x21,
+    0x9a, 0x41, 0x84, 0x04, 0x01, 0xe2, 0xe3, 0xfa, 0x08, 0xe4, 0xf1, 0xc7, 0xe3, 0x8f, 0x1e, 0x8e,
+    0x3c, 0x76, 0xf4, 0xd8, 0x91, 0x43, 0x47, 0x0e, 0x1c, 0x3a, 0x6e, 0xe0, 0xf8, 0xab, 0x8d, 0x1b,
+    0x53, 0x35, 0x6c, 0x24, 0xd6, 0x58, 0x74, 0xe1, 0x82, 0xc6, 0x0c, 0x25, 0x1a, 0xb6, 0x99, 0x8c,
+    0x19, 0x31, 0x5e, 0xc8, 0x38, 0x82, 0x11, 0x63, 0x02, 0x8c, 0x17, 0x2d, 0x5c, 0xb4, 0x60, 0xe1,
+    0x62, 0x45, 0x0a, 0x16, 0x31, 0x54, 0xac, 0x80, 0x54, 0x81, 0xc2, 0x44, 0x8a, 0x1c, 0x27, 0x50,
+    0x3c, 0x62, 0x4f, 0x4c, 0x4b, 0x98, 0x20, 0x51, 0x42, 0x44, 0x08, 0x12, 0x23, 0x3c, 0x2c, 0x76,
+    0x48, 0xe4, 0xa0, 0xa1, 0x43, 0x06, 0x0e, 0x1b, 0x34, 0x6c, 0xc0, 0x60, 0x21, 0xc3, 0x85, 0x46,
+    0x0c, 0x8d, 0x8c, 0x15, 0x2c, 0x94, 0x2b, 0x94, 0x15, 0x3d, 0x28, 0x52, 0x58, 0x9c, 0x40, 0x41,
+    0xc2, 0x04, 0x09, 0x79, 0x22, 0x22, 0x56, 0x8b, 0x38, 0xc5, 0x0f, 0x23, 0x84, 0x0f, 0xcb, 0xe4,
+    0x08, 0x63, 0x31, 0xb9, 0x51, 0xbc, 0x87, 0x21, 0xec, 0x10, 0xc0, 0xf8, 0x57, 0xab, 0x13, 0x7e,
+    0xa7, 0x5e, 0xbd, 0x6b, 0xe8, 0x6d, 0x2c, 0xcc, 0x0d, 0x19, 0x0b, 0xb9, 0x84, 0x13, 0x06, 0xb9,
+    0x83, 0x5b, 0xf0, 0x36, 0x8b, 0xdf, 0xd9, 0x59, 0x8f, 0xe0, 0xfd, 0x27, 0xf8, 0xe0, 0xcf, 0x41,
+    0x83, 0x07, 0x0c, 0x00, 0x1b, 0x00, 0xf6, 0xf9, 0xf5, 0xf1, 0xf9, 0xed, 0xf1, 0xf1, 0xd0, 0xdb,
+    0xd3, 0xcb, 0x93, 0x5b, 0xe0, 0x75, 0x8d, 0x5b, 0x60, 0x96, 0xe0, 0x8a, 0xa7, 0x80, 0x8a, 0x77,
+    0x57, 0x97, 0x80, 0xed, 0x6a, 0x87, 0xe0, 0x6e, 0xce, 0x44, 0x40, 0x67, 0xad, 0xdb, 0x30, 0x67,
+    0x9d, 0x8b, 0xcb, 0x8b, 0x83, 0x93, 0x53, 0xbb, 0x1c, 0x83, 0x2b, 0x2b, 0x7b, 0xb7, 0xb3, 0x37,
+    0x35, 0xfa, 0x39, 0xdb, 0xdc, 0xd8, 0xd6, 0xda, 0xa2, 0xd6, 0xd2, 0xd4, 0xd2, 0xd0, 0xd4, 0xce,
+    0xd0, 0xc8, 0x66, 0x67, 0x3b, 0xb4, 0xcc, 0xc8, 0xc8, 0xfe, 0xcb, 0xf6, 0xe4, 0x62, 0x63, 0x3c,
+    0xc2, 0xc0, 0xc4, 0x68, 0x2a, 0xd8, 0x97, 0x57, 0xe7, 0x57, 0x97, 0x96, 0x22, 0x57, 0x57, 0xa5,
+    0xe6, 0x16, 0x57, 0xd5, 0xd6, 0x81, 0x3f, 0x7f, 0xd9, 0xe4, 0x13, 0x49, 0x24, 0x93, 0x4d, 0x98,
+    0x48, 0x3e, 0x36, 0x59, 0xa2, 0x84, 0x09, 0x8c, 0x25, 0x37, 0x94, 0x14, 0x79, 0x24, 0x22, 0xa4,
+    0xc8, 0x10, 0x22, 0xf9, 0x90, 0x20, 0x90, 0x42, 0x80, 0x40, 0xea, 0x70, 0x40, 0x7e, 0xdc, 0xf0,
+    0xd1, 0xe3, 0x87, 0x08, 0x1f, 0x3c, 0x76, 0xf4, 0x70, 0xd4, 0xb1, 0xa3, 0x6c, 0xc2, 0x31, 0x07,
+    0x0e, 0x1d, 0x8d, 0x2b, 0x70, 0xd8, 0x80, 0xf1, 0x62, 0x85, 0xee, 0xe2, 0x45, 0x0b, 0x17, 0x2c,
+    0xfe, 0x4d, 0x28, 0xa6, 0x50, 0x51, 0x89, 0xe2, 0x44, 0x8a, 0xc9, 0x13, 0x25, 0x44, 0x90, 0x28,
+    0xf1, 0x36, 0xe2, 0xf1, 0x06, 0x8c, 0x15, 0x26, 0x44, 0xc8, 0xc1, 0xb5, 0xbd, 0xb9, 0xc5, 0x7d,
+    0xf0, 0xd0, 0xe1, 0x03, 0x07, 0x0d, 0x1d, 0x12, 0x37, 0x70, 0xd8, 0x37, 0x64, 0xb8, 0xa0, 0x61,
+    0xc7, 0x90, 0x01, 0x11, 0xc3, 0xe2, 0x85, 0xc6, 0x45, 0x0b, 0x15, 0x1a, 0x19, 0x2d, 0xe8, 0x8c,
+    0xe5, 0x0a, 0x7a, 0x59, 0x11, 0x91, 0x82, 0x04, 0xc5, 0x09, 0x14, 0x0a, 0x27, 0x24, 0x4a, 0x28,
+    0x4c, 0x3c, 0xdc, 0x23, 0x8c, 0x0f, 0xa3, 0x90, 0x23, 0x4c, 0x92, 0xc5, 0xe1, 0x31, 0x94, 0xc1,
+    0x30, 0x04, 0xfd, 0x5b, 0x85, 0x00, 0xfe, 0x82, 0xbd, 0x85, 0x86, 0x4e, 0xde, 0xae, 0x61, 0x37,
+    0x1f, 0xe4, 0xe6, 0x84, 0xdc, 0x34, 0xc2, 0x45, 0xc4, 0xfd, 0xab, 0x1b, 0x16, 0x72, 0x07, 0xd7,
+    0xd2, 0xa4, 0x6a, 0xda, 0xec, 0x2d, 0x88, 0xd5, 0x66, 0x03, 0xef, 0x3c, 0xc1, 0x39, 0xec, 0x03,
+    0xbe, 0x40, 0x07, 0x0f, 0x1a, 0x30, 0x70, 0xd0, 0x00, 0xf0, 0x8f, 0x01, 0x60, 0xdf, 0x9f, 0x5f,
+    0x9f, 0x9f, 0x5e, 0x95, 0x6f, 0x4f, 0x6f, 0x6f, 0x41, 0x5d, 0xde, 0x75, 0x01, 0x9e, 0x82, 0x2b,
+    0x5e, 0x82, 0x3b, 0x05, 0x09, 0x10, 0xdc, 0xd9, 0x21, 0xb0, 0xb3, 0x3a, 0xd5, 0xd1, 0x59, 0xe9,
+    0xe4, 0xd4, 0xe6, 0x18, 0xe3, 0xe4, 0xe0, 0xde, 0xe2, 0xcc, 0xe0, 0xdc, 0xda, 0xde, 0xca, 0xdc,
+    0xd6, 0xda, 0xd8, 0xd6, 0xd8, 0xd0, 0xd4, 0xd2, 0xd0, 0xc8, 0xd2, 0xb2, 0xb7, 0x20, 0xb6, 0x4f,
+    0x0f, 0x81, 0x75, 0x0d, 0x0d, 0xcd, 0xac, 0x8c, 0xec, 0xac, 0x8c, 0x6c, 0x4c, 0x2c, 0xac, 0x8c,
+    0x0c, 0x6c, 0xcc, 0x4a, 0xac, 0x29, 0xec, 0xab, 0x00, 0x98, 0xd7, 0x57, 0x17, 0x97, 0x57, 0xd7,
+    0x96, 0x16, 0xd7, 0xd6, 0x01, 0xad, 0xac, 0x03, 0x06, 0xb2, 0x0c, 0x5c, 0x55, 0x0b, 0x60, 0x5d,
+    0x61, 0x11, 0x78, 0xb2, 0x1a, 0x40, 0xa0, 0x8a, 0x6a, 0x40, 0xd5, 0x94, 0x14, 0xd5, 0x54, 0x94,
+    0x54, 0x35, 0x0a, 0xaa, 0x0a, 0xe5, 0xe4, 0xf4, 0x24, 0xc0, 0x49, 0x00, 0xd3, 0xb4, 0x09, 0x92,
+    0xca, 0x34, 0xb9, 0x14, 0x80, 0x5a, 0x0e, 0x5b, 0x52, 0x4a, 0x0a, 0x00, 0xa6, 0x04, 0xc0, 0x9a,
+    0xc4, 0x78, 0x04, 0x00, 0xe9, 0x08, 0x89, 0x3a, 0xfd, 0x2f, 0xfa, 0x32, 0x22, 0x1b, 0x13, 0x0b,
+    0xcb, 0xba, 0xaa, 0x3a, 0x1d, 0x15, 0x8d, 0x85, 0x81, 0x7d, 0x79, 0x89, 0x3d, 0xfd, 0xf3, 0xcf,
+    0x42, 0x76, 0x41, 0x52, 0x3e, 0x51, 0x38, 0xf6, 0x1b, 0x28, 0xd0, 0x3f, 0x94, 0xee, 0xac, 0x67,
+    0x7a, 0x9e, 0x3d, 0xab, 0xff, 0xe9, 0xf9, 0xf9, 0xa7, 0xf3, 0x0f, 0x67, 0xd5, 0x4f, 0x1f, 0xce,
+    0x3e, 0x7b, 0xf8, 0xe8, 0xd9, 0x93, 0x47, 0x0f, 0x9e, 0x3c, 0x78, 0xea, 0x38, 0xdd, 0xb1, 0x53,
+    0xc7, 0xce, 0x26, 0x9d, 0xcd, 0x38, 0x4e, 0x73, 0xe4, 0xc4, 0x91, 0xf3, 0x06, 0x8e, 0xa6, 0x1b,
+    0x36, 0x6d, 0xd6, 0xb0, 0x11, 0xb3, 0x26, 0x8d, 0x9a, 0xcc, 0x34, 0x5b, 0x99, 0x67, 0xd0, 0x74,
+    0x39, 0x53, 0x86, 0x6a, 0x06, 0xb3, 0x8c, 0x16, 0xe6, 0xa5, 0x18, 0x32, 0x63, 0x2e, 0x19, 0xbb,
+    0x90, 0x09, 0xd3, 0x45, 0x0f, 0xf3, 0x05, 0x4c, 0x25, 0xe3, 0x17, 0x2d, 0x2f, 0xb6, 0x5a, 0x90,
+    0x34, 0x3a, 0xdb, 0x9e, 0x9c, 0x75, 0xe2, 0xa4, 0x29, 0x23, 0xa6, 0x4b, 0xd7, 0x96, 0xd6, 0x01,
+    0x2e, 0x2d, 0x59, 0x2c, 0xaf, 0x0c, 0xd0, 0x22, 0xb5, 0xcb, 0x62, 0x05, 0x4b, 0x13, 0xcb, 0x20,
+    0x57, 0x20, 0xad, 0x50, 0xa9, 0x32, 0x85, 0x8a, 0x94, 0x29, 0x52, 0xa2, 0x54, 0x2b, 0x29, 0xa3,
+    0x50, 0x3e, 0x81, 0xf2, 0x44, 0xb2, 0x3a, 0xe9, 0x44, 0xd2, 0x09, 0x93, 0x26, 0x4b, 0x98, 0x28,
+    0x59, 0x92, 0x44, 0x49, 0x92, 0x48, 0x24, 0x47, 0x22, 0x8f, 0x14, 0x31, 0x52, 0x44, 0x88, 0x13,
+    0x91, 0x21, 0x42, 0x86, 0x40, 0x06, 0x79, 0x04, 0xe2, 0xe3, 0x47, 0x0f, 0x1f, 0x05, 0x7a, 0x38,
+    0xf2, 0xd8, 0xe1, 0x78, 0xb5, 0x23, 0x87, 0x0e, 0xac, 0x1c, 0x36, 0xa8, 0x38, 0x6e, 0xd8, 0xb0,
+    0xba, 0x61, 0xab, 0x65, 0xc1, 0x62, 0x79, 0x25, 0x8a, 0x64, 0xa4, 0x10, 0x47, 0x1b, 0x06, 0x0a,
+    0x60, 0x5d, 0x59, 0x65, 0xcd, 0x90, 0x31, 0x83, 0x51, 0x46, 0x55, 0x8c, 0x17, 0x30, 0x12, 0x5f,
+    0xb4, 0x70, 0x41, 0xd5, 0x62, 0x05, 0x8b, 0x7d, 0x85, 0x55, 0xc5, 0x54, 0x0a, 0xeb, 0xa3, 0x90,
+    0x3a, 0x41, 0xa0, 0x8a, 0x6a, 0x4a, 0x2a, 0x6a, 0x00, 0x89, 0x11, 0x24, 0x12, 0x47, 0x3c, 0x89,
+    0x80, 0x7a, 0xaa, 0x7e, 0xf0, 0xf0, 0x61, 0xf7, 0x30, 0xd9, 0x41, 0x40, 0x93, 0x93, 0x06, 0xab,
+    0x86, 0xca, 0x0c, 0x4c, 0x4b, 0xd4, 0x46, 0x0b, 0x8d, 0x8c, 0x16, 0x28, 0x14, 0x55, 0x28, 0x53,
+    0x58, 0x2c, 0x2b, 0x2e, 0x4a, 0x10, 0x4f, 0x48, 0x94, 0x30, 0x46, 0x3c, 0x1c, 0x47, 0x38, 0x24,
+    0x47, 0x08, 0x77, 0xc5, 0x51, 0xf6, 0x30, 0x14, 0x2f, 0x04, 0xb0, 0xf7, 0x0b, 0xd6, 0xbf, 0x84,
+    0x42, 0x5d, 0xdb, 0x8c, 0xb0, 0xd0, 0x30, 0x2f, 0xcc, 0x0e, 0x06, 0x8a, 0x87, 0xa8, 0x04, 0xc2,
+    0xfa, 0x43, 0x43, 0x33, 0x00, 0x00, 0x00, 0x34, 0x00, 0x13, 0x7a, 0x09, 0xc4, 0xc3, 0x30, 0x75,
+    0xf2, 0x0a, 0x74, 0x2d, 0x41, 0xa2, 0x40, 0xcc, 0x60, 0x30, 0x88, 0x05, 0x86, 0x81, 0x23, 0xb1,
+    0x10, 0x47, 0xbe, 0xcb, 0xf7, 0x41, 0xaf, 0xb4, 0xf5, 0xe0, 0xdf, 0x47, 0xce, 0x74, 0xe7, 0xa2,
+    0x63, 0xb1, 0x7d, 0x99, 0x19, 0xe0, 0x65, 0x8e, 0xfe, 0x97, 0xb3, 0x46, 0x78, 0xb5, 0xee, 0x13,
+    0x4d, 0x23, 0x53, 0xaa, 0x07, 0xf2, 0xc3, 0xeb, 0xf6, 0xd8, 0xe3, 0xa9, 0x1e, 0xa6, 0x06, 0xbd,
+    0xb0, 0x05, 0xe0, 0x4f, 0x0a, 0xe8, 0x8f, 0x53, 0xdc, 0x81, 0x14, 0x0b, 0xaa, 0x3c, 0x47, 0xf5,
+    0x59, 0xfd, 0x77, 0x18, 0xf8, 0xeb, 0xd6, 0x31, 0x92, 0x4d, 0xe1, 0x02, 0xfc, 0x54, 0x6f, 0x3d,
+    0xc4, 0xe2, 0xa3, 0xf2, 0x9a, 0xe0, 0xfc, 0xee, 0x5f, 0x36, 0x10, 0x5e, 0xca, 0xb3, 0x9f, 0x9b,
+    0x26, 0x34, 0x31, 0x95, 0xdd, 0x3f, 0x15, 0x92, 0x4f, 0xb3, 0x96, 0x3e, 0xf2, 0xb3, 0xcc, 0x89,
+    0x4c, 0xff, 0xb1, 0x76, 0x99, 0xd0, 0x10, 0xc2, 0x6d, 0xbc, 0x24, 0x0c, 0x5f, 0xf1, 0xb9, 0xfa,
+    0x08, 0x0b, 0xa8, 0xe3, 0x70, 0x8b, 0x65, 0xe4, 0xcb, 0xd1, 0x75, 0x19, 0xdd, 0x8e, 0x1c, 0xf6,
+    0x7a, 0x71, 0x9c, 0x7f, 0xda, 0x62, 0x70, 0x70, 0xcc, 0x78, 0x87, 0x4d, 0x29, 0x45, 0x27, 0xa3,
+    0x41, 0xb2, 0x95, 0x62, 0x4d, 0x7b, 0x43, 0x69, 0x4a, 0x05, 0xc1, 0x28, 0xf1, 0x74, 0x46, 0xf8,
+    0x97, 0x95, 0x7d, 0x70, 0x0c, 0xa8, 0x27, 0x9a, 0x63, 0x4c, 0xaf, 0x40, 0x0d, 0x56, 0x50, 0x20,
+    0xa0, 0x6e, 0xf1, 0xf0, 0xd7, 0x7b, 0x01, 0xcf, 0xa7, 0x3b, 0x9e, 0xa6, 0x47, 0x6c, 0xb5, 0x66,
+    0x01, 0x6a, 0x63, 0x07, 0x69, 0xf0, 0x42, 0x8c, 0x69, 0xf0, 0xb8, 0x33, 0xde, 0xb2, 0xa7, 0x67,
+    0xe6, 0xdb, 0xd4, 0xb3, 0x91, 0x75, 0xba, 0xe7, 0x9b, 0x32, 0xe7, 0xf6, 0x4e, 0xc8, 0x3f, 0xb0,
+    0x79, 0x0e, 0x26, 0x9c, 0x80, 0x86, 0x1c, 0x2f, 0xb6, 0x9e, 0x53, 0x0b, 0x6f, 0x56, 0xfe, 0x39,
+    0x06, 0x67, 0xb4, 0xf3, 0xd8, 0x91, 0x30, 0xbf, 0x3c, 0x93, 0xb8, 0xfd, 0x8e, 0x82, 0xfc, 0x21,
+    0xfe, 0xef, 0xdb, 0x98, 0x43, 0xd4, 0xcb, 0xb0, 0xaf, 0xab, 0xdf, 0x43, 0xde, 0xcd, 0x9f, 0xe7,
+    0x54, 0xc3, 0x17, 0x0d, 0x50, 0x3d, 0x90, 0xd9, 0x8e, 0x7b, 0xcf, 0xe3, 0x35, 0x1f, 0xa6, 0xf7,
+    0xa9, 0x14, 0x98, 0xe2, 0xb2, 0xa6, 0xa5, 0xf6, 0xfd, 0x0d, 0xdf, 0x46, 0xa7, 0x8b, 0x70, 0xde,
+    0x6d, 0xaa, 0x47, 0xe6, 0xc3, 0xda, 0x2b, 0x40, 0x90, 0xe5, 0x6c, 0x3e, 0x46, 0xe0, 0x4b, 0xbb,
+    0x6b, 0x5c, 0xe5, 0x2b, 0xdc, 0x8f, 0xda, 0xaf, 0xf2, 0x5c, 0x31, 0xcf, 0x69, 0x61, 0xe0, 0xf6,
+    0x35, 0x4b, 0x3e, 0xcb, 0x9d, 0x3a, 0x29, 0xdd, 0x50, 0xda, 0x3b, 0x5e, 0x69, 0x9f, 0x4a, 0xfb,
+    0xee, 0xf1, 0xee, 0xf0, 0x8f, 0x85, 0xc1, 0xc7, 0x6c, 0x9a, 0x42, 0xce, 0x07, 0xf2, 0x77, 0xad,
+    0xb6, 0xe4, 0xfe, 0xf4, 0x61, 0x32, 0x62, 0x70, 0xea, 0x28, 0xf9, 0x3e, 0xad, 0x01, 0xb3, 0x09,
+    0x8e, 0xab, 0x55, 0x80, 0x27, 0x0c, 0x2d, 0x9b, 0x2f, 0xdc, 0xab, 0xbc, 0xd9, 0xd8, 0x3b, 0xcc,
+    0xbf, 0x00, 0xf1, 0x6a, 0x49, 0x10, 0xac, 0xc5, 0x9a, 0x84, 0x33, 0x7b, 0x3c, 0xfb, 0x5e, 0xed,
+    0xef, 0x71, 0x66, 0xef, 0xfa, 0xc4, 0xeb, 0x0d, 0x4e, 0x63, 0x57, 0xfe, 0xd9, 0x5e, 0xb0, 0x5f,
+    0x09, 0x38, 0x2f, 0x51, 0xce, 0xb7, 0xa4, 0x2b, 0x16, 0x61, 0xeb, 0x0e, 0xf0, 0x97, 0x22, 0x3e,
+    0x5a, 0x36, 0x45, 0x35, 0x77, 0x16, 0xf8, 0x21, 0x80, 0x13, 0x6f, 0x22, 0x81, 0x5b, 0x0c, 0x30,
+    0x30, 0x9b, 0x7d, 0x95, 0x8e, 0x21, 0xe0, 0xe1, 0x5f, 0xe0, 0x36, 0x16, 0xd8, 0x6b, 0x87, 0xb7,
+    0xba, 0xb8, 0xdd, 0x16, 0x30, 0xc1, 0xaa, 0xff, 0xb3, 0x5d, 0x05, 0xea, 0xa7, 0xe6, 0xf4, 0x8e,
+    0x2f, 0xb2, 0x23, 0xb2, 0x96, 0xf9, 0xbb, 0x6d, 0xeb, 0x7b, 0x30, 0x56, 0x8b, 0xc0, 0x37, 0xdd,
+    0x7d, 0xcb, 0x7c, 0xfe, 0x9c, 0x1c, 0x78, 0x1f, 0xf3, 0xa0, 0x5e, 0x4e, 0xf2, 0x3b, 0x95, 0x17,
+    0x6e, 0xf8, 0x16, 0x7e, 0x0d, 0x84, 0x58, 0xe8, 0xd1, 0x30, 0x81, 0x91, 0x4f, 0xe7, 0x23, 0xf9,
+    0x4e, 0xfc, 0x9d, 0xd2, 0x4d, 0x75, 0xc3, 0xf6, 0xd7, 0x86, 0xfc, 0x9d, 0xdf, 0xde, 0x70, 0x1c,
+    0xb0, 0x93, 0x41, 0x68, 0x2f, 0x5a, 0x5d, 0xff, 0xb4, 0x37, 0x59, 0x5a, 0x26, 0x2f, 0x4e, 0x0b,
+    0x0e, 0x5d, 0x80, 0x47, 0x85, 0x6e, 0xec, 0xc1, 0xe1, 0x05, 0x2f, 0x65, 0xa1, 0x67, 0x9e, 0x62,
+    0xbf, 0x6c, 0x1b, 0xd8, 0xea, 0x95, 0xbd, 0x43, 0x6d, 0xcc, 0x62, 0x71, 0x99, 0x49, 0x6d, 0xf1,
+    0x3b, 0x27, 0x23, 0x90, 0x2a, 0x7f, 0x2d, 0xd0, 0x67, 0x18, 0xec, 0x1c, 0xc9, 0x5d, 0xf9, 0xea,
+    0x83, 0x3a, 0xef, 0x7b, 0x27, 0x37, 0xba, 0x32, 0x9e, 0x95, 0xe4, 0x0e, 0xcf, 0xf4, 0x37, 0xf5,
+    0x13, 0x87, 0x66, 0xcb, 0x34, 0x88, 0x02, 0x7b, 0x5c, 0x99, 0xe3, 0x8f, 0xd0, 0xc1, 0xe1, 0xf0,
+    0xa1, 0x4b, 0x17, 0x08, 0x2a, 0xf4, 0x35, 0xc8, 0xc5, 0xec, 0x79, 0xcc, 0xab, 0xcf, 0xf9, 0x22,
+    0xb5, 0x46, 0xbf, 0x83, 0x69, 0xfb, 0xcb, 0x61, 0xe4, 0x03, 0x13, 0x3a, 0x0c, 0xbd, 0xbb, 0xa1,
+    0x37, 0x7a, 0x82, 0x45, 0x0a, 0xde, 0x46, 0x73, 0xd8, 0x09, 0xa9, 0x8e, 0x16, 0x24, 0x06, 0x67,
+    0x17, 0xb4, 0x7f, 0xeb, 0xf7, 0xca, 0x3c, 0x29, 0xb5, 0x77, 0x76, 0xec, 0x6f, 0x07, 0xe5, 0x73,
+    0xc1, 0xd0, 0x9a, 0x6e, 0x36, 0xa4, 0xa6, 0x71, 0x1f, 0xce, 0xd0, 0xc4, 0x6d, 0x9f, 0xfa, 0xfa,
+    0x83, 0xce, 0x77, 0x98, 0x5d, 0x71, 0x04, 0xfb, 0xc0, 0x4a, 0x6b, 0x80, 0xac, 0x3e, 0x15, 0xf7,
+    0x20, 0x78, 0x57, 0xf0, 0x0f, 0x61, 0x77, 0x34, 0x17, 0x34, 0x08, 0xe1, 0xff, 0xe8, 0xba, 0x75,
+    0xcf, 0xff, 0xd7, 0x4f, 0x32, 0x4d, 0xcb, 0xef, 0x88, 0x1c, 0x60, 0xaa, 0x2b, 0x3e, 0xfc, 0x34,
+    0x9b, 0xe7, 0xc0, 0xb2, 0xa3, 0x56, 0x3f, 0xa1, 0x8f, 0x04, 0xee, 0xd3, 0x68, 0xd1, 0x2a, 0xf6,
+    0x6f, 0x5f, 0x07, 0xc2, 0x65, 0x80, 0x1e, 0xec, 0x47, 0x3b, 0x1b, 0xfa, 0x3d, 0x1e, 0x79, 0xc8,
+    0x91, 0x15, 0x7d, 0x06, 0x47, 0xca, 0x38, 0x17, 0x4d, 0xe8, 0x91, 0x3e, 0x3d, 0xb2, 0x47, 0xed,
+    0x5a, 0xdf, 0xf7, 0xd1, 0x31, 0xfa, 0x38, 0x55, 0x9b, 0xc4, 0x3c, 0xae, 0xcf, 0x73, 0xc2, 0x93,
+    0x9f, 0xce, 0x0b, 0xd8, 0xfc, 0xa3, 0x63, 0x9f, 0x77, 0x23, 0x51, 0x1e, 0x60, 0x5b, 0xf4, 0x1c,
+    0x87, 0x77, 0x1e, 0x55, 0xbd, 0x32, 0x27, 0x6e, 0x8f, 0x7c, 0xf3, 0x28, 0x8f, 0xbc, 0x7a, 0xfb,
+    0xf6, 0x66, 0xfe, 0xa3, 0x46, 0xdc, 0xe2, 0xdc, 0x82, 0xe3, 0xfe, 0x12, 0x92, 0x99, 0xdc, 0x21,
+    0x91, 0x9a, 0x5f, 0x05, 0x55, 0x0d, 0xb5, 0xff, 0xa3, 0xf9, 0x5d, 0xc6, 0x04, 0x82, 0x8b, 0x74,
+    0xc8, 0x0d, 0x7e, 0xaf, 0xf7, 0xac, 0x06, 0xb9, 0x47, 0x3f, 0xb0, 0x6a, 0x83, 0x33, 0xca, 0xe9,
+    0x8d, 0x03, 0x01, 0x37, 0x19, 0x81, 0x64, 0x3d, 0x8e, 0x66, 0x46, 0x7e, 0x08, 0x44, 0x7f, 0x55,
+    0xcc, 0x8b, 0x02, 0xdd, 0x44, 0xbc, 0xe0, 0xb9, 0x38, 0x10, 0x0e, 0x26, 0xb9, 0x33, 0x00, 0xf9,
+    0xab, 0x80, 0x7a, 0x3a, 0x9f, 0x5e, 0x0f, 0xf7, 0x42, 0xf2, 0x7d, 0xbb, 0x33, 0x02, 0xe6, 0xb0,
+    0xbe, 0xcc, 0x1b, 0x3f, 0x0a, 0x96, 0x57, 0x12, 0xf2, 0xa9, 0xdc, 0x90, 0xe1, 0x9f, 0x27, 0x1e,
+    0x75, 0xc2, 0xe9, 0x09, 0x8d, 0xd9, 0xbd, 0xf2, 0x76, 0x16, 0x00, 0xf6, 0xd6, 0x3f, 0x65, 0x7c,
+    0x10, 0x01, 0x93, 0xd3, 0x60, 0xc7, 0x4f, 0xc6, 0xe8, 0xfb, 0x87, 0x2b, 0x97, 0xbf, 0xe1, 0x27,
+    0x8e, 0xd7, 0xdb, 0xfe, 0xdd, 0x53, 0xd2, 0x89, 0x95, 0xda, 0xe6, 0x70, 0x2e, 0xea, 0x88, 0x25,
+    0x84, 0xf5, 0x82, 0xd0, 0xd5, 0xd5, 0xfb, 0x43, 0xbf, 0x97, 0x5e, 0x5e, 0x76, 0xd6, 0x05, 0x13,
+    0x13, 0xc8, 0xe7, 0x3c, 0x6f, 0xf4, 0x69, 0x19, 0x52, 0x1c, 0xb0, 0xfb, 0xc8, 0x96, 0x73, 0xd9,
+    0xac, 0x33, 0x71, 0x46, 0x1e, 0xe7, 0xad, 0x29, 0xe2, 0x1b, 0x95, 0xe6, 0x31, 0xb8, 0x7d, 0x38,
+    0xe1, 0xe1, 0xde, 0x09, 0x9e, 0x90, 0xf6, 0xf3, 0x2f, 0xb7, 0xea, 0xdf, 0x5f, 0xd9, 0xb7, 0x97,
+    0x38, 0x0c, 0x8e, 0xe2, 0x7b, 0xe4, 0x7b, 0x9f, 0x99, 0xac, 0x51, 0x20, 0x1b, 0x01, 0xea, 0x57,
+    0x3e, 0x64, 0xf3, 0xa6, 0xde, 0x03, 0x77, 0xf3, 0x29, 0x9e, 0x2f, 0xc3, 0x24, 0x13, 0xf9, 0x7a,
+    0x9f, 0xbb, 0x5d, 0x9c, 0xd2, 0xbe, 0xe8, 0xb8, 0x4d, 0x34, 0xeb, 0xed, 0xd9, 0x93, 0x83, 0x61,
+    0xeb, 0x2d, 0xbe, 0xa5, 0x20, 0xdf, 0x6f, 0xe3, 0x82, 0x2b, 0xae, 0x4f, 0xe6, 0x42, 0x3f, 0x87,
+    0xaf, 0xe2, 0xdb, 0x37, 0xa1, 0x5b, 0x02, 0xc6, 0x7c, 0xd0, 0xbe, 0x7f, 0xf2, 0x2f, 0xe7, 0x91,
+    0xf9, 0x82, 0xc3, 0xee, 0x7e, 0xe8, 0x5d, 0x32, 0xd1, 0x71, 0x18, 0xec, 0xf7, 0x6d, 0xcc, 0x03,
+    0x85, 0xfc, 0x03, 0x8c, 0x31, 0x1b, 0x0e, 0xc2, 0x5c, 0xb9, 0x2a, 0x1d, 0xf0, 0x13, 0xad, 0x14,
+    0xa3, 0x87, 0xef, 0x18, 0x20, 0x8b, 0x21, 0xf6, 0x8f, 0x7f, 0x28, 0xdc, 0x18, 0xc1, 0x3a, 0xac,
+    0xb9, 0xbf, 0x45, 0xb5, 0x5f, 0xfa, 0x97, 0x2d, 0xea, 0x7a, 0x50, 0x83, 0xbc, 0x80, 0x3d, 0x0b,
+    0x8e, 0xee, 0xab, 0xe6, 0x4e, 0x85, 0xcc, 0x47, 0xe8, 0x9a, 0x4b, 0x97, 0x6f, 0x0f, 0x2b, 0xd1,
+    0x9e, 0xd7, 0x5a, 0xcc, 0xd1, 0xbe, 0x68, 0xb8, 0xd3, 0x8a, 0x2e, 0x67, 0xe1, 0x2f, 0x70, 0x7a,
+    0x1e, 0x2f, 0xa3, 0x1c, 0xd8, 0xd5, 0xe9, 0x77, 0x1a, 0xa3, 0x5b, 0x17, 0x8d, 0x31, 0x0f, 0xdb,
+    0x7b, 0x8b, 0xe6, 0x61, 0xcd, 0xff, 0x7b, 0x4f, 0x4c, 0xe6, 0x2b, 0xcc, 0x62, 0x04, 0x71, 0xf8,
+    0x15, 0xc1, 0x8f, 0xf3, 0x3c, 0xd1, 0xbc, 0x70, 0xfe, 0xaf, 0xf9, 0xf0, 0x34, 0x15, 0x84, 0x43,
+    0x8f, 0xa5, 0xc0, 0x82, 0xde, 0xc8, 0xfd, 0x85, 0x31, 0x6c, 0x9f, 0xdd, 0xd7, 0xfd, 0xdb, 0x96,
+    0x2a, 0xdd, 0xa7, 0xaf, 0x48, 0xc0, 0x93, 0xd0, 0xf1, 0x0a, 0xbc, 0x7f, 0x38, 0x38, 0xc0, 0x4b,
+    0x5e, 0x80, 0xf3, 0x31, 0x50, 0x34, 0x8a, 0x1e, 0x3e, 0x7d, 0x68, 0xd9, 0x8f, 0x61, 0x30, 0xd3,
+    0xff, 0xec, 0x4f, 0x1a, 0xc7, 0x9c, 0xe3, 0xd0, 0xac, 0xc2, 0xa6, 0x53, 0xa0, 0x9c, 0x3a, 0x60,
+    0x8b, 0xff, 0xc7, 0x54, 0xa4, 0x2b, 0x4a, 0x52, 0x3d, 0xdf, 0x77, 0xe3, 0x7c, 0x8a, 0x6d, 0x6b,
+    0x13, 0xf1, 0xbc, 0x14, 0x64, 0xb5, 0x23, 0x09, 0x80, 0xed, 0xe8, 0x05, 0x51, 0xab, 0x4b, 0x7d,
+    0xb4, 0xdd, 0x11, 0x73, 0x03, 0x7b, 0x83, 0xa1, 0x5d, 0xfa, 0x1f, 0xf7, 0x06, 0xc4, 0xb6, 0xd1,
+    0xdf, 0x17, 0x0a, 0x19, 0xe0, 0xde, 0x7f, 0x06, 0xe8, 0xdd, 0xfc, 0x99, 0x3a, 0x03, 0x39, 0x5c,
+    0x1a, 0xee, 0xcc, 0x9e, 0x22, 0x0a, 0x43, 0x06, 0x4e, 0x98, 0x86, 0x3f, 0xd9, 0x1f, 0xb9, 0xcf,
+    0x01, 0x8d, 0x84, 0xa5, 0x10, 0xb2, 0x48, 0x15, 0x68, 0x84, 0x1f, 0xce, 0x8c, 0x32, 0xaf, 0x08,
+    0x9c, 0xdb, 0xec, 0xde, 0x02, 0xee, 0x1f, 0xcd, 0x9b, 0x99, 0x49, 0xbb, 0x1f, 0x81, 0x6e, 0xd9,
+    0xff, 0x60, 0x0d, 0x19, 0x38, 0xbd, 0x23, 0x8f, 0x2e, 0x72, 0x12, 0xa5, 0xb3, 0x60, 0x29, 0xcb,
+    0x2e, 0x36, 0x32, 0x8c, 0x85, 0x1b, 0xbd, 0x6e, 0xef, 0x35, 0x6f, 0xef, 0x6d, 0x79, 0xe3, 0xda,
+    0xcf, 0x6f, 0x8d, 0x8e, 0x09, 0x61, 0xbc, 0x0f, 0xcc, 0x76, 0x1e, 0xe8, 0xec, 0x62, 0xc6, 0x20,
+    0x75, 0x53, 0xee, 0x61, 0xe3, 0x17, 0x81, 0x57, 0x3d, 0xd6, 0x98, 0x82, 0x30, 0x0b, 0x32, 0x68,
+    0x84, 0x69, 0x93, 0x1e, 0x67, 0xae, 0xbd, 0x63, 0xd2, 0xfe, 0x5c, 0xa7, 0xc4, 0x02, 0xde, 0x6b,
+    0x2a, 0xd3, 0x47, 0x54, 0x57, 0x89, 0x85, 0x7c, 0xc6, 0x2e, 0xd1, 0x89, 0x70, 0x62, 0xe1, 0xe0,
+    0xf9, 0x3f, 0x8f, 0x4c, 0x00, 0x6d, 0xbf, 0x29, 0xfa, 0xaf, 0x98, 0xe1, 0x42, 0xf4, 0x78, 0x02,
+    0x30, 0xf2, 0xf3, 0xa1, 0xb8, 0xe4, 0x0c, 0xec, 0xa6, 0xe5, 0xc6, 0xeb, 0xd3, 0x26, 0xf4, 0xe7,
+    0x8c, 0x62, 0x31, 0xef, 0x9b, 0xd0, 0xf6, 0x16, 0xd1, 0xc8, 0xf2, 0x1a, 0x16, 0xa2, 0xc4, 0xc7,
+    0xa1, 0x3c, 0x9b, 0x27, 0x4d, 0x86, 0x51, 0x30, 0x22, 0xf4, 0x4e, 0xca, 0xaf, 0x12, 0x0c, 0x9a,
+    0xdf, 0x9f, 0x00, 0x03, 0xa9, 0x61, 0x47, 0xe3, 0x9d, 0xfe, 0x86, 0x9d, 0x4f, 0x9c, 0x11, 0x71,
+    0x26, 0x4f, 0x60, 0x7b, 0x62, 0x9f, 0x17, 0x6b, 0xd0, 0x3b, 0xa6, 0xf0, 0x49, 0xd3, 0x0e, 0xb0,
+    0x81, 0x0c, 0x92, 0xf3, 0x28, 0x61, 0x26, 0x10, 0x6f, 0x95, 0x79, 0x9a, 0xa6, 0x3b, 0xe2, 0x95,
+    0xd0, 0xf3, 0xc2, 0xbc, 0x3f, 0x0b, 0x47, 0xd0, 0x32, 0xd1, 0x18, 0xbe, 0x2c, 0x9e, 0x9a, 0xa7,
+    0x0d, 0xf4, 0xd1, 0x25, 0xd9, 0x03, 0x8e, 0x7b, 0x6a, 0x3e, 0xab, 0xb2, 0xfc, 0x50, 0x2f, 0x38,
+    0x71, 0x64, 0xfe, 0xf3, 0xf2, 0x41, 0x2a, 0xd5, 0x0c, 0x05, 0x0e, 0x7f, 0x20, 0x06, 0xbc, 0xf8,
+    0xf8, 0x35, 0x71, 0x12, 0xd0, 0xf3, 0x24, 0x4f, 0x83, 0x11, 0xec, 0xae, 0xd7, 0xc6, 0xcf, 0xcf,
+    0x19, 0xd7, 0xe6, 0xfa, 0x78, 0xf1, 0x5f, 0x11, 0x08, 0x68, 0xc8, 0x51, 0xad, 0xb6, 0x82, 0xe8,
+    0x49, 0xe8, 0x28, 0x56, 0x5c, 0x2d, 0xa3, 0x3f, 0x34, 0x1c, 0x1e, 0xf8, 0x56, 0x97, 0x76, 0x41,
+    0x3b, 0x06, 0x33, 0x80, 0xe9, 0xcc, 0x9e, 0xeb, 0xd5, 0x94, 0x69, 0x62, 0x3c, 0xd3, 0x7d, 0x34,
+    0x60, 0xef, 0x84, 0x2c, 0xd0, 0xf1, 0x17, 0xd6, 0xe8, 0xd1, 0x87, 0x48, 0x22, 0x13, 0x67, 0x9f,
+    0xd9, 0x7a, 0x7e, 0x5a, 0x67, 0x4d, 0x9f, 0x3b, 0xae, 0x68, 0xce, 0xb9, 0xd3, 0x0b, 0xe8, 0x66,
+    0xc2, 0xe1, 0xc9, 0xd6, 0xcb, 0xd8, 0x04, 0x81, 0xe2, 0xf8, 0xba, 0xe3, 0x73, 0xf9, 0x88, 0xac,
+    0x56, 0x7e, 0xe8, 0xc3, 0x5f, 0x4c, 0x81, 0x39, 0xbb, 0x48, 0x91, 0xad, 0xf0, 0x8b, 0x83, 0x08,
+    0xe5, 0x52, 0xe0, 0x0e, 0xd4, 0x7c, 0x94, 0x83, 0xa7, 0x2b, 0x98, 0x5b, 0x6d, 0x26, 0xd7, 0xd0,
+    0x03, 0x10, 0xa5, 0x5e, 0x8a, 0x60, 0xef, 0x60, 0x7a, 0xef, 0xd1, 0xae, 0x6e, 0x3a, 0x64, 0x83,
+    0xb2, 0xa2, 0xc3, 0x08, 0x13, 0xff, 0x8e, 0x59, 0x60, 0x70, 0xa2, 0x34, 0x32, 0xb3, 0x18, 0x25,
+    0x9b, 0x51, 0x30, 0xa5, 0xa8, 0xf6, 0x12, 0x87, 0x27, 0x0b, 0x94, 0xcc, 0x17, 0xad, 0xfc, 0x60,
+    0xdc, 0x4e, 0x11, 0x2d, 0x38, 0x0a, 0xa9, 0x89, 0x26, 0x57, 0xfc, 0x8b, 0xca, 0x1e, 0x8d, 0x6e,
+    0xf5, 0x8c, 0x8e, 0xcf, 0x04, 0x3d, 0x37, 0xb6, 0xd0, 0x55, 0x56, 0xe9, 0xe1, 0x9d, 0x10, 0xc2,
+    0x82, 0xfe, 0x16, 0x35, 0xd4, 0x07, 0x78, 0x95, 0xc0, 0x11, 0x6f, 0x4a, 0x90, 0x36, 0x59, 0xf9,
+    0x38, 0xdb, 0x2a, 0xef, 0xa7, 0x23, 0xa9, 0x7f, 0x7e, 0x48, 0x45, 0x31, 0xb2, 0x6d, 0x4f, 0xcd,
+    0xa5, 0xc0, 0xbc, 0x73, 0xcd, 0x7d, 0xd7, 0x25, 0x21, 0xf3, 0xe8, 0xf5, 0x9f, 0xf6, 0x78, 0x9f,
+    0xb2, 0xb7, 0x44, 0x6d, 0xdc, 0x00, 0x8d, 0x9f, 0x0d, 0x90, 0xb4, 0xd6, 0x53, 0x31, 0x66, 0x24,
+    0x73, 0x40, 0xd6, 0x3e, 0x90, 0x10, 0xb3, 0x14, 0x12, 0xd9, 0xf1, 0x9f, 0x4d, 0x63, 0xd4, 0xfa,
+    0x88, 0x65, 0x92, 0xad, 0xf4, 0xcd, 0xee, 0x68, 0x0c, 0x11, 0x14, 0xac, 0xac, 0x7f, 0x8f, 0xf7,
+    0xfa, 0x99, 0x1d, 0xb0, 0x3e, 0x98, 0x31, 0xd2, 0x18, 0x7d, 0xcf, 0xcd, 0xa3, 0x08, 0x98, 0xe8,
+    0xc6, 0x36, 0x4d, 0xfd, 0xc3, 0xec, 0x7b, 0xd2, 0x1c, 0xd3, 0xbf, 0xce, 0xaa, 0xa5, 0xe2, 0xe2,
+    0x5e, 0xb7, 0x0f, 0xb5, 0xba, 0x9e, 0x74, 0xc7, 0xba, 0xca, 0x23, 0xbb, 0x20, 0x31, 0x2e, 0x6a,
+    0x53, 0x3c, 0x82, 0x4e, 0x76, 0xb5, 0xb2, 0x52, 0xcd, 0x12, 0x32, 0x9d, 0xc7, 0x43, 0xb7, 0x3b,
+    0x62, 0x9f, 0xf4, 0x88, 0xc9, 0xd1, 0x00, 0x3d, 0xe7, 0x12, 0x82, 0x84, 0x37, 0xed, 0x71, 0x4d,
+    0xc6, 0x0e, 0x23, 0x6f, 0x09, 0x6d, 0x25, 0x36, 0x91, 0x70, 0x9d, 0x04, 0x77, 0x5d, 0x99, 0x68,
+    0x75, 0x38, 0xb9, 0xcb, 0x6f, 0xb3, 0x93, 0x37, 0xf9, 0xf6, 0x85, 0x85, 0x4d, 0xa5, 0x69, 0xc5,
+    0x68, 0x09, 0x62, 0x7f, 0x9c, 0xb0, 0xd2, 0x5f, 0x63, 0x6e, 0xb2, 0x36, 0xa5, 0x86, 0xbe, 0x7f,
+    0x7f, 0xf7, 0x78, 0x1d, 0x07, 0x50, 0x56, 0x03, 0x6a, 0x0b, 0x3a, 0xa7, 0x45, 0x04, 0x2e, 0x6b,
+    0x94, 0xef, 0x39, 0xc1, 0x4d, 0x48, 0x99, 0x22, 0xa6, 0xc0, 0x21, 0x40, 0xf0, 0x00, 0x52, 0xc2,
+    0x7f, 0xbc, 0x57, 0x01, 0x97, 0xd9, 0x96, 0xf9, 0x55, 0xf4, 0x7d, 0x3e, 0x4e, 0xa6, 0xac, 0x9a,
+    0xb2, 0x63, 0x51, 0x3d, 0x8e, 0xc5, 0xf8, 0xcb, 0x07, 0x19, 0xf4, 0xd6, 0x80, 0x7c, 0x08, 0xfe,
+    0xb8, 0x18, 0xed, 0x36, 0x45, 0x1f, 0x5f, 0xd0, 0x87, 0x3a, 0x0a, 0x1b, 0xbb, 0xa1, 0x93, 0x5d,
+    0x81, 0x83, 0x3c, 0xb2, 0x2e, 0x07, 0x55, 0xc1, 0xcd, 0xc8, 0xcb, 0x32, 0xf8, 0x3c, 0x14, 0x7e,
+    0x32, 0x7d, 0xfd, 0x21, 0x78, 0xa7, 0x5c, 0xcc, 0x98, 0x50, 0x94, 0xdf, 0x3c, 0xdc, 0x9b, 0xfe,
+    0x58, 0xe4, 0xb5, 0x26, 0x90, 0x51, 0x0c, 0x39, 0x20, 0x3d, 0xf9, 0x11, 0x95, 0xed, 0x68, 0xa2,
+    0xc4, 0x55, 0x06, 0x2e, 0x94, 0xb0, 0xcb, 0xfd, 0x8e, 0xb4, 0xbd, 0xe2, 0x3d, 0xe5, 0x14, 0x9b,
+    0x78, 0x07, 0x17, 0x73, 0x84, 0xb7, 0x5a, 0x26, 0x58, 0x03, 0xdf, 0xc5, 0x4a, 0x7b, 0x2a, 0x8e,
+    0xd3, 0x2f, 0x07, 0x74, 0x15, 0xbc, 0xd6, 0x52, 0x5e, 0xba, 0x2b, 0x64, 0xdc, 0x62, 0xa2, 0xfd,
+    0x41, 0x8b, 0xf6, 0xe9, 0x44, 0xe6, 0xc0, 0xce, 0x8f, 0x42, 0x36, 0x11, 0xdf, 0x47, 0x62, 0xb3,
+    0x79, 0xa7, 0x48, 0x9f, 0x21, 0x0c, 0xd7, 0x52, 0x06, 0xac, 0xae, 0x9f, 0x74, 0xc7, 0x4f, 0x34,
+    0xcf, 0x0f, 0x72, 0x3b, 0x56, 0x9a, 0xf2, 0x3e, 0x57, 0x78, 0xf4, 0x4f, 0x5b, 0xa6, 0x3b, 0x82,
+    0x6d, 0xd4, 0x23, 0x77, 0x5b, 0xe2, 0xd3, 0xee, 0x47, 0xa8, 0x1c, 0x8c, 0xed, 0x84, 0x78, 0x19,
+    0x29, 0xa1, 0xfe, 0x9d, 0xa0, 0xb7, 0xcd, 0x8e, 0x07, 0x6b, 0x96, 0xe5, 0xda, 0xb6, 0x83, 0x67,
+    0x7a, 0xe0, 0x90, 0x91, 0xf7, 0x59, 0x6e, 0x0b, 0xd4, 0x8d, 0x5e, 0x26, 0x5d, 0xf1, 0x07,
 };
+const ShaderModule Blob035 = { Blob035_Data, 5583u, 5466u, 35u };
 
-extern const uint32_t Blob073[5466];
-const uint32_t Blob073[5466] = {
-    0x07230203, 0x00010300, 0x0008000b, 0x0000036a, 0x00000000, 0x00020011, 0x00000001, 0x0006000b,
-    0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001,
-    0x0006000f, 0x00000005, 0x00000004, 0x6e69616d, 0x00000000, 0x000001c9, 0x00060010, 0x00000004,
-    0x00000011, 0x00000008, 0x00000008, 0x00000001, 0x00030003, 0x00000002, 0x000001c2, 0x000a0004,
-    0x475f4c47, 0x4c474f4f, 0x70635f45, 0x74735f70, 0x5f656c79, 0x656e696c, 0x7269645f, 0x69746365,
-    0x00006576, 0x00080004, 0x475f4c47, 0x4c474f4f, 0x6e695f45, 0x64756c63, 0x69645f65, 0x74636572,
-    0x00657669, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000, 0x00070005, 0x0000000a, 0x726f6e55,
-    0x6f54386d, 0x36626752, 0x3b317528, 0x00000000, 0x00040005, 0x00000009, 0x756c6176, 0x00000065,
-    0x00070005, 0x0000000d, 0x726f6e55, 0x6f54386d, 0x68706c41, 0x75283561, 0x00003b31, 0x00040005,
-    0x0000000c, 0x756c6176, 0x00000065, 0x00070005, 0x00000014, 0x64616f4c, 0x616e6946, 0x2842466c,
-    0x3b326976, 0x00000000, 0x00050005, 0x00000013, 0x69736f70, 0x6e6f6974, 0x00000000, 0x00050005,
-    0x00000017, 0x6f6c6f43, 0x28523672, 0x003b3175, 0x00040005, 0x00000016, 0x6f6c6f63, 0x00000072,
-    0x00050005, 0x0000001a, 0x6f6c6f43, 0x28473672, 0x003b3175, 0x00040005, 0x00000019, 0x6f6c6f63,
-    0x00000072, 0x00050005, 0x0000001d, 0x6f6c6f43, 0x28423672, 0x003b3175, 0x00040005, 0x0000001c,
-    0x6f6c6f63, 0x00000072, 0x00080005, 0x00000024, 0x6b636150, 0x6f6c6f43, 0x75283672, 0x31753b31,
-    0x3b31753b, 0x003b3175, 0x00030005, 0x00000020, 0x00000072, 0x00030005, 0x00000021, 0x00000067,
-    0x00030005, 0x00000022, 0x00000062, 0x00040005, 0x00000023, 0x68706c61, 0x00000061, 0x00070005,
-    0x0000002a, 0x6e656c42, 0x75283464, 0x31753b31, 0x3b31753b, 0x003b3175, 0x00040005, 0x00000026,
-    0x73726966, 0x00000074, 0x00040005, 0x00000027, 0x6f636573, 0x0000646e, 0x00030005, 0x00000028,
-    0x00617665, 0x00030005, 0x00000029, 0x00627665, 0x00060005, 0x0000002f, 0x6e656c42, 0x75283564,
-    0x31753b31, 0x0000003b, 0x00040005, 0x0000002d, 0x73726966, 0x00000074, 0x00040005, 0x0000002e,
-    0x6f636573, 0x0000646e, 0x00080005, 0x00000035, 0x67697242, 0x656e7468, 0x70557373, 0x3b317528,
-    0x753b3175, 0x00003b31, 0x00040005, 0x00000032, 0x6f6c6f63, 0x00000072, 0x00040005, 0x00000033,
-    0x74636166, 0x0000726f, 0x00040005, 0x00000034, 0x73616962, 0x00000000, 0x00090005, 0x0000003a,
-    0x67697242, 0x656e7468, 0x6f447373, 0x75286e77, 0x31753b31, 0x3b31753b, 0x00000000, 0x00040005,
-    0x00000037, 0x6f6c6f63, 0x00000072, 0x00040005, 0x00000038, 0x74636166, 0x0000726f, 0x00040005,
-    0x00000039, 0x73616962, 0x00000000, 0x00050005, 0x0000003d, 0x67426f54, 0x28386172, 0x003b3175,
-    0x00040005, 0x0000003c, 0x6f6c6f63, 0x00000072, 0x00090005, 0x00000044, 0x64616f4c, 0x74706143,
-    0x53657275, 0x63656469, 0x75287261, 0x75763b31, 0x00003b32, 0x00050005, 0x00000042, 0x65666572,
-    0x636e6572, 0x00000065, 0x00070005, 0x00000043, 0x6c616373, 0x69576465, 0x6e696874, 0x65786950,
-    0x0000006c, 0x00040005, 0x00000059, 0x65786574, 0x0000006c, 0x00040005, 0x0000005c, 0x616e6946,
-    0x0042466c, 0x00050005, 0x00000062, 0x6e617571, 0x657a6974, 0x00000064, 0x00040005, 0x00000068,
-    0x61726170, 0x0000006d, 0x00040005, 0x0000006d, 0x61726170, 0x0000006d, 0x00040005, 0x00000075,
-    0x61726170, 0x0000006d, 0x00040005, 0x0000007d, 0x61726170, 0x0000006d, 0x00040005, 0x000000a4,
-    0x61726170, 0x0000006d, 0x00040005, 0x000000a9, 0x61726170, 0x0000006d, 0x00040005, 0x000000b3,
-    0x61726170, 0x0000006d, 0x00040005, 0x000000b8, 0x61726170, 0x0000006d, 0x00040005, 0x000000c0,
-    0x61726170, 0x0000006d, 0x00040005, 0x000000c5, 0x61726170, 0x0000006d, 0x00040005, 0x000000cd,
-    0x61726170, 0x0000006d, 0x00040005, 0x000000ce, 0x61726170, 0x0000006d, 0x00040005, 0x000000cf,
-    0x61726170, 0x0000006d, 0x00040005, 0x000000d0, 0x61726170, 0x0000006d, 0x00030005, 0x000000d4,
-    0x00617665, 0x00030005, 0x000000d9, 0x00627665, 0x00040005, 0x000000dd, 0x61726170, 0x0000006d,
-    0x00040005, 0x000000e2, 0x61726170, 0x0000006d, 0x00040005, 0x000000ec, 0x61726170, 0x0000006d,
-    0x00040005, 0x000000f1, 0x61726170, 0x0000006d, 0x00040005, 0x000000f9, 0x61726170, 0x0000006d,
-    0x00040005, 0x000000fe, 0x61726170, 0x0000006d, 0x00040005, 0x00000106, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000107, 0x61726170, 0x0000006d, 0x00040005, 0x00000108, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000109, 0x61726170, 0x0000006d, 0x00040005, 0x0000010d, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000110, 0x61726170, 0x0000006d, 0x00040005, 0x0000011a, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000011d, 0x61726170, 0x0000006d, 0x00040005, 0x00000127, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000012a, 0x61726170, 0x0000006d, 0x00040005, 0x00000134, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000135, 0x61726170, 0x0000006d, 0x00040005, 0x00000136, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000137, 0x61726170, 0x0000006d, 0x00040005, 0x0000013b, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000013e, 0x61726170, 0x0000006d, 0x00040005, 0x00000147, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000014a, 0x61726170, 0x0000006d, 0x00040005, 0x00000153, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000156, 0x61726170, 0x0000006d, 0x00040005, 0x0000015f, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000160, 0x61726170, 0x0000006d, 0x00040005, 0x00000161, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000162, 0x61726170, 0x0000006d, 0x00030005, 0x00000166, 0x00003672, 0x00040005,
-    0x00000167, 0x61726170, 0x0000006d, 0x00030005, 0x0000016a, 0x00003667, 0x00040005, 0x0000016b,
-    0x61726170, 0x0000006d, 0x00030005, 0x0000016e, 0x00003662, 0x00040005, 0x0000016f, 0x61726170,
-    0x0000006d, 0x00030005, 0x00000172, 0x00003872, 0x00030005, 0x00000179, 0x00003867, 0x00030005,
-    0x0000017f, 0x00003862, 0x00040005, 0x00000190, 0x72646461, 0x00737365, 0x00040005, 0x00000194,
-    0x6b6e6162, 0x00000000, 0x00040005, 0x00000199, 0x73726576, 0x006e6f69, 0x00060005, 0x0000019e,
-    0x706d6173, 0x5073656c, 0x69507265, 0x006c6578, 0x00050005, 0x0000019f, 0x65726353, 0x69576e65,
-    0x00687464, 0x00050005, 0x000001a1, 0x6c616353, 0x63614665, 0x00726f74, 0x00040005, 0x000001a5,
-    0x6c6c6563, 0x00000000, 0x00050005, 0x000001af, 0x706d6173, 0x6e49656c, 0x00786564, 0x00080005,
-    0x000001b8, 0x74706143, 0x53657275, 0x63656469, 0x75427261, 0x72656666, 0x00000000, 0x00090006,
-    0x000001b8, 0x00000000, 0x74706143, 0x53657275, 0x63656469, 0x69507261, 0x736c6578, 0x00000000,
-    0x00030005, 0x000001ba, 0x00000000, 0x00030005, 0x000001c6, 0x00006469, 0x00080005, 0x000001c9,
-    0x475f6c67, 0x61626f6c, 0x766e496c, 0x7461636f, 0x496e6f69, 0x00000044, 0x00060005, 0x000001d6,
-    0x65726353, 0x65486e65, 0x74686769, 0x00000000, 0x00040005, 0x000001de, 0x65726373, 0x00006e65,
-    0x00040005, 0x000001e3, 0x6c616373, 0x00596465, 0x00040005, 0x000001ea, 0x6974616e, 0x00586576,
-    0x00040005, 0x000001ef, 0x6974616e, 0x00596576, 0x00050005, 0x000001f3, 0x6974616e, 0x6e496576,
-    0x00786564, 0x00050005, 0x000001f9, 0x6e616c70, 0x73614265, 0x00000065, 0x00040005, 0x000001fd,
-    0x6f6c6562, 0x00000077, 0x00080005, 0x000001ff, 0x75727453, 0x72757463, 0x6e496465, 0x42747570,
-    0x65666675, 0x00000072, 0x00070006, 0x000001ff, 0x00000000, 0x75727453, 0x72757463, 0x6e496465,
-    0x00747570, 0x00030005, 0x00000201, 0x00000000, 0x00040005, 0x00000207, 0x766f6261, 0x00000065,
-    0x00040005, 0x0000020f, 0x746e6f63, 0x006c6f72, 0x00070005, 0x00000217, 0x74706163, 0x52657275,
-    0x72656665, 0x65636e65, 0x00000000, 0x00060005, 0x0000021f, 0x746e6f63, 0x466c6f72, 0x7367616c,
-    0x00000000, 0x00050005, 0x00000223, 0x656e696c, 0x6174654d, 0x00000000, 0x00050005, 0x0000022d,
-    0x70736964, 0x4d79616c, 0x0065646f, 0x00040005, 0x00000231, 0x6f6c6f63, 0x00000072, 0x00040005,
-    0x0000024e, 0x61726170, 0x0000006d, 0x00040005, 0x00000250, 0x61726170, 0x0000006d, 0x00050005,
-    0x00000258, 0x736f5078, 0x6f697469, 0x0000006e, 0x00040005, 0x0000025f, 0x72756f73, 0x00586563,
-    0x00040005, 0x0000027a, 0x65786970, 0x0044336c, 0x00040005, 0x00000288, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000028a, 0x61726170, 0x0000006d, 0x00060005, 0x0000028d, 0x68737550, 0x736e6f43,
-    0x746e6174, 0x00000073, 0x00060006, 0x0000028d, 0x00000000, 0x56727543, 0x61697261, 0x0000746e,
-    0x00060006, 0x0000028d, 0x00000001, 0x57786554, 0x68746469, 0x00000000, 0x00060006, 0x0000028d,
-    0x00000002, 0x48786554, 0x68676965, 0x00000074, 0x00060006, 0x0000028d, 0x00000003, 0x57786554,
-    0x53706172, 0x00000000, 0x00060006, 0x0000028d, 0x00000004, 0x57786554, 0x54706172, 0x00000000,
-    0x00070006, 0x0000028d, 0x00000005, 0x49786554, 0x70614373, 0x65727574, 0x00000000, 0x00070006,
-    0x0000028d, 0x00000006, 0x74706143, 0x59657275, 0x7366664f, 0x00007465, 0x00050006, 0x0000028d,
-    0x00000007, 0x6461705f, 0x00000000, 0x00030005, 0x0000028f, 0x00006370, 0x00040005, 0x000002a1,
-    0x61726170, 0x0000006d, 0x00060005, 0x000002a9, 0x706d6f63, 0x7469736f, 0x4d6e6f69, 0x0065646f,
-    0x00030005, 0x000002ad, 0x00617665, 0x00030005, 0x000002b1, 0x00627665, 0x00040005, 0x000002c0,
-    0x61726170, 0x0000006d, 0x00040005, 0x000002c2, 0x61726170, 0x0000006d, 0x00040005, 0x000002c4,
-    0x61726170, 0x0000006d, 0x00040005, 0x000002c6, 0x61726170, 0x0000006d, 0x00040005, 0x000002ce,
-    0x61726170, 0x0000006d, 0x00040005, 0x000002d0, 0x61726170, 0x0000006d, 0x00040005, 0x000002d2,
-    0x61726170, 0x0000006d, 0x00040005, 0x000002da, 0x61726170, 0x0000006d, 0x00040005, 0x000002dc,
-    0x61726170, 0x0000006d, 0x00040005, 0x000002de, 0x61726170, 0x0000006d, 0x00040005, 0x000002e5,
-    0x61726170, 0x0000006d, 0x00040005, 0x000002e7, 0x61726170, 0x0000006d, 0x00060005, 0x000002f0,
-    0x67697262, 0x656e7468, 0x6f4d7373, 0x00006564, 0x00070005, 0x000002f4, 0x67697262, 0x656e7468,
-    0x61467373, 0x726f7463, 0x00000000, 0x00040005, 0x000002fc, 0x61726170, 0x0000006d, 0x00040005,
-    0x000002fe, 0x61726170, 0x0000006d, 0x00040005, 0x00000300, 0x61726170, 0x0000006d, 0x00040005,
-    0x00000307, 0x61726170, 0x0000006d, 0x00040005, 0x00000309, 0x61726170, 0x0000006d, 0x00040005,
-    0x0000030b, 0x61726170, 0x0000006d, 0x00040005, 0x0000030d, 0x61726762, 0x00000038, 0x00040005,
-    0x0000030e, 0x61726170, 0x0000006d, 0x00040005, 0x00000317, 0x61626772, 0x00000038, 0x00060005,
-    0x00000330, 0x65726944, 0x754f7463, 0x74757074, 0x00706f54, 0x00070005, 0x0000033a, 0x65726944,
-    0x754f7463, 0x74757074, 0x74746f42, 0x00006d6f, 0x00090005, 0x00000345, 0x73657250, 0x61746e65,
-    0x6e6f6974, 0x7074754f, 0x75427475, 0x72656666, 0x00000000, 0x00080006, 0x00000345, 0x00000000,
-    0x73657250, 0x61746e65, 0x6e6f6974, 0x7074754f, 0x00007475, 0x00030005, 0x00000347, 0x00000000,
-    0x00070005, 0x00000349, 0x6d617246, 0x66756265, 0x53726566, 0x64697274, 0x00000065, 0x00060005,
-    0x00000355, 0x5778614d, 0x546b726f, 0x73656c69, 0x00000000, 0x00060005, 0x00000358, 0x656c6954,
-    0x72655073, 0x656e694c, 0x00000000, 0x00050005, 0x00000359, 0x656c6954, 0x656e694c, 0x00000073,
-    0x00050005, 0x0000035e, 0x6174654d, 0x66696e55, 0x006d726f, 0x00060006, 0x0000035e, 0x00000000,
-    0x506d754e, 0x67796c6f, 0x00736e6f, 0x00060006, 0x0000035e, 0x00000001, 0x566d754e, 0x61697261,
-    0x0073746e, 0x00060006, 0x0000035e, 0x00000002, 0x68706c41, 0x66655261, 0x00000000, 0x00050006,
-    0x0000035e, 0x00000003, 0x70736944, 0x00746e43, 0x00060006, 0x0000035e, 0x00000004, 0x6e6f6f54,
-    0x6c626154, 0x00000065, 0x00060006, 0x0000035e, 0x00000005, 0x61656c43, 0x6c6f4372, 0x0000726f,
-    0x00060006, 0x0000035e, 0x00000006, 0x61656c43, 0x70654472, 0x00006874, 0x00060006, 0x0000035e,
-    0x00000007, 0x61656c43, 0x74744172, 0x00000072, 0x00060006, 0x0000035e, 0x00000008, 0x4f676f46,
-    0x65736666, 0x00000074, 0x00060006, 0x0000035e, 0x00000009, 0x53676f46, 0x74666968, 0x00000000,
-    0x00060006, 0x0000035e, 0x0000000a, 0x43676f46, 0x726f6c6f, 0x00000000, 0x00080006, 0x0000035e,
-    0x0000000b, 0x61656c43, 0x74694272, 0x4f70616d, 0x65736666, 0x00000074, 0x00030005, 0x00000360,
-    0x00000000, 0x00040047, 0x0000005c, 0x00000022, 0x00000000, 0x00040047, 0x0000005c, 0x00000021,
-    0x0000000b, 0x00030047, 0x0000005c, 0x00000018, 0x00040047, 0x0000019f, 0x00000001, 0x00000000,
-    0x00040047, 0x000001b7, 0x00000006, 0x00000004, 0x00050048, 0x000001b8, 0x00000000, 0x00000023,
-    0x00000000, 0x00030047, 0x000001b8, 0x00000002, 0x00040047, 0x000001ba, 0x00000022, 0x00000000,
-    0x00040047, 0x000001ba, 0x00000021, 0x0000000e, 0x00040047, 0x000001c9, 0x0000000b, 0x0000001c,
-    0x00040047, 0x000001d6, 0x00000001, 0x00000001, 0x00040047, 0x000001fe, 0x00000006, 0x00000004,
-    0x00040048, 0x000001ff, 0x00000000, 0x00000018, 0x00050048, 0x000001ff, 0x00000000, 0x00000023,
-    0x00000000, 0x00030047, 0x000001ff, 0x00000002, 0x00040047, 0x00000201, 0x00000022, 0x00000000,
-    0x00040047, 0x00000201, 0x00000021, 0x0000000c, 0x00050048, 0x0000028d, 0x00000000, 0x00000023,
-    0x00000000, 0x00050048, 0x0000028d, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x0000028d,
-    0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x0000028d, 0x00000003, 0x00000023, 0x0000000c,
-    0x00050048, 0x0000028d, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x0000028d, 0x00000005,
-    0x00000023, 0x00000014, 0x00050048, 0x0000028d, 0x00000006, 0x00000023, 0x00000018, 0x00050048,
-    0x0000028d, 0x00000007, 0x00000023, 0x0000001c, 0x00030047, 0x0000028d, 0x00000002, 0x00040047,
-    0x00000330, 0x00000022, 0x00000000, 0x00040047, 0x00000330, 0x00000021, 0x00000011, 0x00030047,
-    0x00000330, 0x00000019, 0x00040047, 0x0000033a, 0x00000022, 0x00000000, 0x00040047, 0x0000033a,
-    0x00000021, 0x00000012, 0x00030047, 0x0000033a, 0x00000019, 0x00040047, 0x00000344, 0x00000006,
-    0x00000004, 0x00050048, 0x00000345, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000345,
-    0x00000002, 0x00040047, 0x00000347, 0x00000022, 0x00000000, 0x00040047, 0x00000347, 0x00000021,
-    0x0000000d, 0x00040047, 0x00000355, 0x00000001, 0x00000002, 0x00040047, 0x0000035c, 0x00000006,
-    0x00000010, 0x00050048, 0x0000035e, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x0000035e,
-    0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x0000035e, 0x00000002, 0x00000023, 0x00000008,
-    0x00050048, 0x0000035e, 0x00000003, 0x00000023, 0x0000000c, 0x00050048, 0x0000035e, 0x00000004,
-    0x00000023, 0x00000010, 0x00050048, 0x0000035e, 0x00000005, 0x00000023, 0x00000230, 0x00050048,
-    0x0000035e, 0x00000006, 0x00000023, 0x00000234, 0x00050048, 0x0000035e, 0x00000007, 0x00000023,
-    0x00000238, 0x00050048, 0x0000035e, 0x00000008, 0x00000023, 0x0000023c, 0x00050048, 0x0000035e,
-    0x00000009, 0x00000023, 0x00000240, 0x00050048, 0x0000035e, 0x0000000a, 0x00000023, 0x00000244,
-    0x00050048, 0x0000035e, 0x0000000b, 0x00000023, 0x00000248, 0x00030047, 0x0000035e, 0x00000002,
-    0x00040047, 0x00000360, 0x00000022, 0x00000000, 0x00040047, 0x00000360, 0x00000021, 0x00000000,
-    0x00040047, 0x00000367, 0x0000000b, 0x00000019, 0x00020013, 0x00000002, 0x00030021, 0x00000003,
-    0x00000002, 0x00040015, 0x00000006, 0x00000020, 0x00000000, 0x00040020, 0x00000007, 0x00000007,
-    0x00000006, 0x00040021, 0x00000008, 0x00000006, 0x00000007, 0x00040015, 0x0000000f, 0x00000020,
-    0x00000001, 0x00040017, 0x00000010, 0x0000000f, 0x00000002, 0x00040020, 0x00000011, 0x00000007,
-    0x00000010, 0x00040021, 0x00000012, 0x00000006, 0x00000011, 0x00070021, 0x0000001f, 0x00000006,
-    0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00050021, 0x0000002c, 0x00000006, 0x00000007,
-    0x00000007, 0x00060021, 0x00000031, 0x00000006, 0x00000007, 0x00000007, 0x00000007, 0x00040017,
-    0x0000003f, 0x00000006, 0x00000002, 0x00040020, 0x00000040, 0x00000007, 0x0000003f, 0x00050021,
-    0x00000041, 0x00000006, 0x00000007, 0x00000040, 0x0004002b, 0x00000006, 0x00000047, 0x0000003f,
-    0x0004002b, 0x00000006, 0x00000049, 0x0000007f, 0x0004002b, 0x00000006, 0x0000004b, 0x000000ff,
-    0x0004002b, 0x00000006, 0x00000050, 0x0000001f, 0x00030016, 0x00000056, 0x00000020, 0x00040017,
-    0x00000057, 0x00000056, 0x00000004, 0x00040020, 0x00000058, 0x00000007, 0x00000057, 0x00090019,
-    0x0000005a, 0x00000056, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000004,
-    0x00040020, 0x0000005b, 0x00000000, 0x0000005a, 0x0004003b, 0x0000005b, 0x0000005c, 0x00000000,
-    0x00040017, 0x00000060, 0x00000006, 0x00000004, 0x00040020, 0x00000061, 0x00000007, 0x00000060,
-    0x0004002b, 0x00000056, 0x00000064, 0x437f0000, 0x0004002b, 0x00000006, 0x00000069, 0x00000000,
-    0x0004002b, 0x00000006, 0x0000006e, 0x00000001, 0x0004002b, 0x0000000f, 0x00000072, 0x00000008,
-    0x0004002b, 0x00000006, 0x00000076, 0x00000002, 0x0004002b, 0x0000000f, 0x0000007a, 0x00000010,
-    0x0004002b, 0x00000006, 0x0000007e, 0x00000003, 0x0004002b, 0x0000000f, 0x00000082, 0x00000018,
-    0x0004002b, 0x00000006, 0x000000af, 0x00000008, 0x0004002b, 0x0000000f, 0x000000b1, 0x00000004,
-    0x0004002b, 0x00000006, 0x000000da, 0x00000020, 0x0004002b, 0x00000006, 0x000000e8, 0x00000010,
-    0x0004002b, 0x0000000f, 0x000000ea, 0x00000005, 0x0004002b, 0x0000000f, 0x00000174, 0x00000002,
-    0x0004002b, 0x00000006, 0x0000018c, 0xff000000, 0x0004002b, 0x00000006, 0x00000192, 0x0000ffff,
-    0x0004002b, 0x00000006, 0x00000196, 0x0000001c, 0x0004002b, 0x00000006, 0x0000019b, 0x0000001e,
-    0x00040032, 0x0000000f, 0x0000019f, 0x00000100, 0x0004002b, 0x0000000f, 0x000001a0, 0x00000100,
-    0x00060034, 0x0000000f, 0x000001a1, 0x00000087, 0x0000019f, 0x000001a0, 0x00060034, 0x00000006,
-    0x000001a2, 0x00000080, 0x000001a1, 0x00000069, 0x00060034, 0x00000006, 0x000001a3, 0x00000080,
-    0x000001a1, 0x00000069, 0x00060034, 0x00000006, 0x000001a4, 0x00000084, 0x000001a2, 0x000001a3,
-    0x0004002b, 0x00000006, 0x000001a7, 0x00000004, 0x0004002b, 0x00000006, 0x000001ab, 0x00010000,
-    0x00060034, 0x00000006, 0x000001b2, 0x00000080, 0x000001a1, 0x00000069, 0x0003001d, 0x000001b7,
-    0x00000006, 0x0003001e, 0x000001b8, 0x000001b7, 0x00040020, 0x000001b9, 0x0000000c, 0x000001b8,
-    0x0004003b, 0x000001b9, 0x000001ba, 0x0000000c, 0x0004002b, 0x0000000f, 0x000001bb, 0x00000000,
-    0x00040020, 0x000001c1, 0x0000000c, 0x00000006, 0x00040017, 0x000001c7, 0x00000006, 0x00000003,
-    0x00040020, 0x000001c8, 0x00000001, 0x000001c7, 0x0004003b, 0x000001c8, 0x000001c9, 0x00000001,
-    0x00020014, 0x000001cc, 0x00060034, 0x00000006, 0x000001cf, 0x00000080, 0x0000019f, 0x00000069,
-    0x00040032, 0x0000000f, 0x000001d6, 0x000000c0, 0x00060034, 0x00000006, 0x000001d7, 0x00000080,
-    0x000001d6, 0x00000069, 0x00060034, 0x00000006, 0x000001d8, 0x00000084, 0x000001d7, 0x00000076,
-    0x00060034, 0x00000006, 0x000001e1, 0x00000080, 0x000001d6, 0x00000069, 0x00060034, 0x00000006,
-    0x000001e7, 0x00000080, 0x000001d6, 0x00000069, 0x00060034, 0x00000006, 0x000001ed, 0x00000080,
-    0x000001a1, 0x00000069, 0x00060034, 0x00000006, 0x000001f1, 0x00000080, 0x000001a1, 0x00000069,
-    0x0004002b, 0x00000006, 0x000001f6, 0x00000100, 0x0004002b, 0x00000006, 0x000001fb, 0x00030000,
-    0x0003001d, 0x000001fe, 0x00000006, 0x0003001e, 0x000001ff, 0x000001fe, 0x00040020, 0x00000200,
-    0x0000000c, 0x000001ff, 0x0004003b, 0x00000200, 0x00000201, 0x0000000c, 0x0004002b, 0x00000006,
-    0x00000209, 0x0000c000, 0x0004002b, 0x00000006, 0x00000211, 0x00018000, 0x0004002b, 0x00000006,
-    0x00000219, 0x00024000, 0x0004002b, 0x00000006, 0x00000221, 0x00000018, 0x0004002b, 0x00000006,
-    0x00000224, 0x000a8000, 0x0004002b, 0x00000006, 0x00000226, 0x000000c0, 0x0004002b, 0x00000006,
-    0x00000234, 0x80000000, 0x0004002b, 0x00000006, 0x0000023f, 0x00000040, 0x00060034, 0x00000006,
-    0x00000248, 0x00000080, 0x000001a1, 0x00000069, 0x00060034, 0x00000006, 0x0000024b, 0x00000080,
-    0x000001a1, 0x00000069, 0x0004002b, 0x00000006, 0x0000025a, 0x00000017, 0x0004002b, 0x00000006,
-    0x0000025c, 0x000001ff, 0x00040020, 0x0000025e, 0x00000007, 0x0000000f, 0x0004002b, 0x00000006,
-    0x00000269, 0x00000200, 0x00060034, 0x00000006, 0x0000026c, 0x00000080, 0x000001a1, 0x00000069,
-    0x00060034, 0x00000006, 0x00000275, 0x00000080, 0x000001a1, 0x00000069, 0x00060034, 0x00000006,
-    0x00000282, 0x00000080, 0x000001a1, 0x00000069, 0x00060034, 0x00000006, 0x00000285, 0x00000080,
-    0x000001a1, 0x00000069, 0x000a001e, 0x0000028d, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x0000000f, 0x00000006, 0x00040020, 0x0000028e, 0x00000009, 0x0000028d,
-    0x0004003b, 0x0000028e, 0x0000028f, 0x00000009, 0x0004002b, 0x0000000f, 0x00000290, 0x00000001,
-    0x00040020, 0x00000291, 0x00000009, 0x00000006, 0x0004002b, 0x00000006, 0x000002ab, 0x0000000f,
-    0x0004002b, 0x00000006, 0x000002ba, 0x00000080, 0x0004002b, 0x00000006, 0x000002d9, 0x00000007,
-    0x0004002b, 0x0000000f, 0x00000311, 0x00000007, 0x0004003b, 0x0000005b, 0x00000330, 0x00000000,
-    0x0004003b, 0x0000005b, 0x0000033a, 0x00000000, 0x0003001d, 0x00000344, 0x00000006, 0x0003001e,
-    0x00000345, 0x00000344, 0x00040020, 0x00000346, 0x0000000c, 0x00000345, 0x0004003b, 0x00000346,
-    0x00000347, 0x0000000c, 0x00060034, 0x0000000f, 0x00000349, 0x00000084, 0x0000019f, 0x000001d6,
-    0x00060034, 0x00000006, 0x0000034a, 0x00000080, 0x00000349, 0x00000069, 0x00060034, 0x00000006,
-    0x0000034d, 0x00000080, 0x0000019f, 0x00000069, 0x00040032, 0x0000000f, 0x00000355, 0x00003000,
-    0x0004002b, 0x0000000f, 0x00000356, 0x00000080, 0x0004002b, 0x0000000f, 0x00000357, 0x00000040,
-    0x00060034, 0x0000000f, 0x00000358, 0x00000087, 0x0000019f, 0x0000007a, 0x00060034, 0x0000000f,
-    0x00000359, 0x00000087, 0x000001d6, 0x0000007a, 0x0004002b, 0x0000000f, 0x0000035a, 0x00000800,
-    0x0004002b, 0x00000006, 0x0000035b, 0x00000022, 0x0004001c, 0x0000035c, 0x00000060, 0x0000035b,
-    0x00040017, 0x0000035d, 0x00000056, 0x00000002, 0x000e001e, 0x0000035e, 0x00000006, 0x00000006,
-    0x0000000f, 0x00000006, 0x0000035c, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x0000035d, 0x00040020, 0x0000035f, 0x00000002, 0x0000035e, 0x0004003b, 0x0000035f,
-    0x00000360, 0x00000002, 0x0004002b, 0x0000000f, 0x00000361, 0x000000c0, 0x0004002b, 0x0000000f,
-    0x00000362, 0x0000c000, 0x0004002b, 0x00000006, 0x00000363, 0x00060000, 0x0004002b, 0x00000006,
-    0x00000364, 0x00090000, 0x0004002b, 0x00000006, 0x00000365, 0x0009c000, 0x0004002b, 0x00000006,
-    0x00000366, 0x000a8180, 0x0006002c, 0x000001c7, 0x00000367, 0x000000af, 0x000000af, 0x0000006e,
-    0x0004002b, 0x00000006, 0x00000368, 0x20000000, 0x0004002b, 0x00000006, 0x00000369, 0x40000000,
-    0x00050036, 0x00000002, 0x00000004, 0x00000000, 0x00000003, 0x000200f8, 0x00000005, 0x0004003b,
-    0x00000040, 0x000001c6, 0x00000007, 0x0004003b, 0x00000007, 0x000001de, 0x00000007, 0x0004003b,
-    0x00000007, 0x000001e3, 0x00000007, 0x0004003b, 0x00000007, 0x000001ea, 0x00000007, 0x0004003b,
-    0x00000007, 0x000001ef, 0x00000007, 0x0004003b, 0x00000007, 0x000001f3, 0x00000007, 0x0004003b,
-    0x00000007, 0x000001f9, 0x00000007, 0x0004003b, 0x00000007, 0x000001fd, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000207, 0x00000007, 0x0004003b, 0x00000007, 0x0000020f, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000217, 0x00000007, 0x0004003b, 0x00000007, 0x0000021f, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000223, 0x00000007, 0x0004003b, 0x00000007, 0x0000022d, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000231, 0x00000007, 0x0004003b, 0x00000007, 0x0000024e, 0x00000007, 0x0004003b,
-    0x00000040, 0x00000250, 0x00000007, 0x0004003b, 0x00000007, 0x00000258, 0x00000007, 0x0004003b,
-    0x0000025e, 0x0000025f, 0x00000007, 0x0004003b, 0x0000025e, 0x00000263, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000027a, 0x00000007, 0x0004003b, 0x00000007, 0x00000288, 0x00000007, 0x0004003b,
-    0x00000040, 0x0000028a, 0x00000007, 0x0004003b, 0x00000011, 0x000002a1, 0x00000007, 0x0004003b,
-    0x00000007, 0x000002a9, 0x00000007, 0x0004003b, 0x00000007, 0x000002ad, 0x00000007, 0x0004003b,
-    0x00000007, 0x000002b1, 0x00000007, 0x0004003b, 0x00000007, 0x000002c0, 0x00000007, 0x0004003b,
-    0x00000007, 0x000002c2, 0x00000007, 0x0004003b, 0x00000007, 0x000002c4, 0x00000007, 0x0004003b,
-    0x00000007, 0x000002c6, 0x00000007, 0x0004003b, 0x00000007, 0x000002ce, 0x00000007, 0x0004003b,
-    0x00000007, 0x000002d0, 0x00000007, 0x0004003b, 0x00000007, 0x000002d2, 0x00000007, 0x0004003b,
-    0x00000007, 0x000002da, 0x00000007, 0x0004003b, 0x00000007, 0x000002dc, 0x00000007, 0x0004003b,
-    0x00000007, 0x000002de, 0x00000007, 0x0004003b, 0x00000007, 0x000002e5, 0x00000007, 0x0004003b,
-    0x00000007, 0x000002e7, 0x00000007, 0x0004003b, 0x00000007, 0x000002f0, 0x00000007, 0x0004003b,
-    0x00000007, 0x000002f4, 0x00000007, 0x0004003b, 0x00000007, 0x000002fc, 0x00000007, 0x0004003b,
-    0x00000007, 0x000002fe, 0x00000007, 0x0004003b, 0x00000007, 0x00000300, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000307, 0x00000007, 0x0004003b, 0x00000007, 0x00000309, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000030b, 0x00000007, 0x0004003b, 0x00000007, 0x0000030d, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000030e, 0x00000007, 0x0004003b, 0x00000058, 0x00000317, 0x00000007, 0x0004003d,
-    0x000001c7, 0x000001ca, 0x000001c9, 0x0007004f, 0x0000003f, 0x000001cb, 0x000001ca, 0x000001ca,
-    0x00000000, 0x00000001, 0x0003003e, 0x000001c6, 0x000001cb, 0x00050041, 0x00000007, 0x000001cd,
-    0x000001c6, 0x00000069, 0x0004003d, 0x00000006, 0x000001ce, 0x000001cd, 0x000500ae, 0x000001cc,
-    0x000001d0, 0x000001ce, 0x000001cf, 0x000400a8, 0x000001cc, 0x000001d1, 0x000001d0, 0x000300f7,
-    0x000001d3, 0x00000000, 0x000400fa, 0x000001d1, 0x000001d2, 0x000001d3, 0x000200f8, 0x000001d2,
-    0x00050041, 0x00000007, 0x000001d4, 0x000001c6, 0x0000006e, 0x0004003d, 0x00000006, 0x000001d5,
-    0x000001d4, 0x000500ae, 0x000001cc, 0x000001d9, 0x000001d5, 0x000001d8, 0x000200f9, 0x000001d3,
-    0x000200f8, 0x000001d3, 0x000700f5, 0x000001cc, 0x000001da, 0x000001d0, 0x00000005, 0x000001d9,
-    0x000001d2, 0x000300f7, 0x000001dc, 0x00000000, 0x000400fa, 0x000001da, 0x000001db, 0x000001dc,
-    0x000200f8, 0x000001db, 0x000100fd, 0x000200f8, 0x000001dc, 0x00050041, 0x00000007, 0x000001df,
-    0x000001c6, 0x0000006e, 0x0004003d, 0x00000006, 0x000001e0, 0x000001df, 0x00050086, 0x00000006,
-    0x000001e2, 0x000001e0, 0x000001e1, 0x0003003e, 0x000001de, 0x000001e2, 0x00050041, 0x00000007,
-    0x000001e4, 0x000001c6, 0x0000006e, 0x0004003d, 0x00000006, 0x000001e5, 0x000001e4, 0x0004003d,
-    0x00000006, 0x000001e6, 0x000001de, 0x00050084, 0x00000006, 0x000001e8, 0x000001e6, 0x000001e7,
-    0x00050082, 0x00000006, 0x000001e9, 0x000001e5, 0x000001e8, 0x0003003e, 0x000001e3, 0x000001e9,
-    0x00050041, 0x00000007, 0x000001eb, 0x000001c6, 0x00000069, 0x0004003d, 0x00000006, 0x000001ec,
-    0x000001eb, 0x00050086, 0x00000006, 0x000001ee, 0x000001ec, 0x000001ed, 0x0003003e, 0x000001ea,
-    0x000001ee, 0x0004003d, 0x00000006, 0x000001f0, 0x000001e3, 0x00050086, 0x00000006, 0x000001f2,
-    0x000001f0, 0x000001f1, 0x0003003e, 0x000001ef, 0x000001f2, 0x0004003d, 0x00000006, 0x000001f4,
-    0x000001ea, 0x0004003d, 0x00000006, 0x000001f5, 0x000001ef, 0x00050084, 0x00000006, 0x000001f7,
-    0x000001f5, 0x000001f6, 0x00050080, 0x00000006, 0x000001f8, 0x000001f4, 0x000001f7, 0x0003003e,
-    0x000001f3, 0x000001f8, 0x0004003d, 0x00000006, 0x000001fa, 0x000001de, 0x00050084, 0x00000006,
-    0x000001fc, 0x000001fa, 0x000001fb, 0x0003003e, 0x000001f9, 0x000001fc, 0x0004003d, 0x00000006,
-    0x00000202, 0x000001f9, 0x0004003d, 0x00000006, 0x00000203, 0x000001f3, 0x00050080, 0x00000006,
-    0x00000204, 0x00000202, 0x00000203, 0x00060041, 0x000001c1, 0x00000205, 0x00000201, 0x000001bb,
-    0x00000204, 0x0004003d, 0x00000006, 0x00000206, 0x00000205, 0x0003003e, 0x000001fd, 0x00000206,
-    0x0004003d, 0x00000006, 0x00000208, 0x000001f9, 0x00050080, 0x00000006, 0x0000020a, 0x00000208,
-    0x00000209, 0x0004003d, 0x00000006, 0x0000020b, 0x000001f3, 0x00050080, 0x00000006, 0x0000020c,
-    0x0000020a, 0x0000020b, 0x00060041, 0x000001c1, 0x0000020d, 0x00000201, 0x000001bb, 0x0000020c,
-    0x0004003d, 0x00000006, 0x0000020e, 0x0000020d, 0x0003003e, 0x00000207, 0x0000020e, 0x0004003d,
-    0x00000006, 0x00000210, 0x000001f9, 0x00050080, 0x00000006, 0x00000212, 0x00000210, 0x00000211,
-    0x0004003d, 0x00000006, 0x00000213, 0x000001f3, 0x00050080, 0x00000006, 0x00000214, 0x00000212,
-    0x00000213, 0x00060041, 0x000001c1, 0x00000215, 0x00000201, 0x000001bb, 0x00000214, 0x0004003d,
-    0x00000006, 0x00000216, 0x00000215, 0x0003003e, 0x0000020f, 0x00000216, 0x0004003d, 0x00000006,
-    0x00000218, 0x000001f9, 0x00050080, 0x00000006, 0x0000021a, 0x00000218, 0x00000219, 0x0004003d,
-    0x00000006, 0x0000021b, 0x000001f3, 0x00050080, 0x00000006, 0x0000021c, 0x0000021a, 0x0000021b,
-    0x00060041, 0x000001c1, 0x0000021d, 0x00000201, 0x000001bb, 0x0000021c, 0x0004003d, 0x00000006,
-    0x0000021e, 0x0000021d, 0x0003003e, 0x00000217, 0x0000021e, 0x0004003d, 0x00000006, 0x00000220,
-    0x0000020f, 0x000500c2, 0x00000006, 0x00000222, 0x00000220, 0x00000221, 0x0003003e, 0x0000021f,
-    0x00000222, 0x0004003d, 0x00000006, 0x00000225, 0x000001de, 0x00050084, 0x00000006, 0x00000227,
-    0x00000225, 0x00000226, 0x00050080, 0x00000006, 0x00000228, 0x00000224, 0x00000227, 0x0004003d,
-    0x00000006, 0x00000229, 0x000001ef, 0x00050080, 0x00000006, 0x0000022a, 0x00000228, 0x00000229,
-    0x00060041, 0x000001c1, 0x0000022b, 0x00000201, 0x000001bb, 0x0000022a, 0x0004003d, 0x00000006,
-    0x0000022c, 0x0000022b, 0x0003003e, 0x00000223, 0x0000022c, 0x0004003d, 0x00000006, 0x0000022e,
-    0x00000223, 0x000500c2, 0x00000006, 0x0000022f, 0x0000022e, 0x000000e8, 0x000500c7, 0x00000006,
-    0x00000230, 0x0000022f, 0x0000007e, 0x0003003e, 0x0000022d, 0x00000230, 0x0004003d, 0x00000006,
-    0x00000232, 0x000001fd, 0x0003003e, 0x00000231, 0x00000232, 0x0004003d, 0x00000006, 0x00000233,
-    0x00000217, 0x000500c7, 0x00000006, 0x00000235, 0x00000233, 0x00000234, 0x000500ab, 0x000001cc,
-    0x00000236, 0x00000235, 0x00000069, 0x000300f7, 0x00000238, 0x00000000, 0x000400fa, 0x00000236,
-    0x00000237, 0x00000238, 0x000200f8, 0x00000237, 0x0004003d, 0x00000006, 0x00000239, 0x0000022d,
-    0x000500aa, 0x000001cc, 0x0000023a, 0x00000239, 0x00000076, 0x000400a8, 0x000001cc, 0x0000023b,
-    0x0000023a, 0x000300f7, 0x0000023d, 0x00000000, 0x000400fa, 0x0000023b, 0x0000023c, 0x0000023d,
-    0x000200f8, 0x0000023c, 0x0004003d, 0x00000006, 0x0000023e, 0x0000021f, 0x000500c7, 0x00000006,
-    0x00000240, 0x0000023e, 0x0000023f, 0x000500aa, 0x000001cc, 0x00000241, 0x00000240, 0x00000069,
-    0x000200f9, 0x0000023d, 0x000200f8, 0x0000023d, 0x000700f5, 0x000001cc, 0x00000242, 0x0000023a,
-    0x00000237, 0x00000241, 0x0000023c, 0x000200f9, 0x00000238, 0x000200f8, 0x00000238, 0x000700f5,
-    0x000001cc, 0x00000243, 0x00000236, 0x000001dc, 0x00000242, 0x0000023d, 0x000300f7, 0x00000245,
-    0x00000000, 0x000400fa, 0x00000243, 0x00000244, 0x00000252, 0x000200f8, 0x00000244, 0x00050041,
-    0x00000007, 0x00000246, 0x000001c6, 0x00000069, 0x0004003d, 0x00000006, 0x00000247, 0x00000246,
-    0x00050089, 0x00000006, 0x00000249, 0x00000247, 0x00000248, 0x0004003d, 0x00000006, 0x0000024a,
-    0x000001e3, 0x00050089, 0x00000006, 0x0000024c, 0x0000024a, 0x0000024b, 0x00050050, 0x0000003f,
-    0x0000024d, 0x00000249, 0x0000024c, 0x0004003d, 0x00000006, 0x0000024f, 0x00000217, 0x0003003e,
-    0x0000024e, 0x0000024f, 0x0003003e, 0x00000250, 0x0000024d, 0x00060039, 0x00000006, 0x00000251,
-    0x00000044, 0x0000024e, 0x00000250, 0x0003003e, 0x00000231, 0x00000251, 0x000200f9, 0x00000245,
-    0x000200f8, 0x00000252, 0x0004003d, 0x00000006, 0x00000253, 0x0000021f, 0x000500c7, 0x00000006,
-    0x00000254, 0x00000253, 0x0000023f, 0x000500ab, 0x000001cc, 0x00000255, 0x00000254, 0x00000069,
-    0x000300f7, 0x00000257, 0x00000000, 0x000400fa, 0x00000255, 0x00000256, 0x00000257, 0x000200f8,
-    0x00000256, 0x0004003d, 0x00000006, 0x00000259, 0x00000223, 0x000500c2, 0x00000006, 0x0000025b,
-    0x00000259, 0x0000025a, 0x000500c7, 0x00000006, 0x0000025d, 0x0000025b, 0x0000025c, 0x0003003e,
-    0x00000258, 0x0000025d, 0x0004003d, 0x00000006, 0x00000260, 0x00000258, 0x000500c7, 0x00000006,
-    0x00000261, 0x00000260, 0x000001f6, 0x000500ab, 0x000001cc, 0x00000262, 0x00000261, 0x00000069,
-    0x000300f7, 0x00000265, 0x00000000, 0x000400fa, 0x00000262, 0x00000264, 0x00000270, 0x000200f8,
-    0x00000264, 0x00050041, 0x00000007, 0x00000266, 0x000001c6, 0x00000069, 0x0004003d, 0x00000006,
-    0x00000267, 0x00000266, 0x0004007c, 0x0000000f, 0x00000268, 0x00000267, 0x0004003d, 0x00000006,
-    0x0000026a, 0x00000258, 0x00050082, 0x00000006, 0x0000026b, 0x00000269, 0x0000026a, 0x00050084,
-    0x00000006, 0x0000026d, 0x0000026b, 0x0000026c, 0x0004007c, 0x0000000f, 0x0000026e, 0x0000026d,
-    0x00050082, 0x0000000f, 0x0000026f, 0x00000268, 0x0000026e, 0x0003003e, 0x00000263, 0x0000026f,
-    0x000200f9, 0x00000265, 0x000200f8, 0x00000270, 0x00050041, 0x00000007, 0x00000271, 0x000001c6,
-    0x00000069, 0x0004003d, 0x00000006, 0x00000272, 0x00000271, 0x0004007c, 0x0000000f, 0x00000273,
-    0x00000272, 0x0004003d, 0x00000006, 0x00000274, 0x00000258, 0x00050084, 0x00000006, 0x00000276,
-    0x00000274, 0x00000275, 0x0004007c, 0x0000000f, 0x00000277, 0x00000276, 0x00050080, 0x0000000f,
-    0x00000278, 0x00000273, 0x00000277, 0x0003003e, 0x00000263, 0x00000278, 0x000200f9, 0x00000265,
-    0x000200f8, 0x00000265, 0x0004003d, 0x0000000f, 0x00000279, 0x00000263, 0x0003003e, 0x0000025f,
-    0x00000279, 0x0003003e, 0x0000027a, 0x00000069, 0x0004003d, 0x00000006, 0x0000027b, 0x00000217,
-    0x000500c7, 0x00000006, 0x0000027c, 0x0000027b, 0x00000234, 0x000500ab, 0x000001cc, 0x0000027d,
-    0x0000027c, 0x00000069, 0x000300f7, 0x0000027f, 0x00000000, 0x000400fa, 0x0000027d, 0x0000027e,
-    0x0000028c, 0x000200f8, 0x0000027e, 0x00050041, 0x00000007, 0x00000280, 0x000001c6, 0x00000069,
-    0x0004003d, 0x00000006, 0x00000281, 0x00000280, 0x00050089, 0x00000006, 0x00000283, 0x00000281,
-    0x00000282, 0x0004003d, 0x00000006, 0x00000284, 0x000001e3, 0x00050089, 0x00000006, 0x00000286,
-    0x00000284, 0x00000285, 0x00050050, 0x0000003f, 0x00000287, 0x00000283, 0x00000286, 0x0004003d,
-    0x00000006, 0x00000289, 0x00000217, 0x0003003e, 0x00000288, 0x00000289, 0x0003003e, 0x0000028a,
-    0x00000287, 0x00060039, 0x00000006, 0x0000028b, 0x00000044, 0x00000288, 0x0000028a, 0x0003003e,
-    0x0000027a, 0x0000028b, 0x000200f9, 0x0000027f, 0x000200f8, 0x0000028c, 0x00050041, 0x00000291,
-    0x00000292, 0x0000028f, 0x00000290, 0x0004003d, 0x00000006, 0x00000293, 0x00000292, 0x000500ab,
-    0x000001cc, 0x00000294, 0x00000293, 0x00000069, 0x0004003d, 0x0000000f, 0x00000295, 0x0000025f,
-    0x000500af, 0x000001cc, 0x00000296, 0x00000295, 0x000001bb, 0x000500a7, 0x000001cc, 0x00000297,
-    0x00000294, 0x00000296, 0x0004003d, 0x0000000f, 0x00000298, 0x0000025f, 0x000500b1, 0x000001cc,
-    0x00000299, 0x00000298, 0x0000019f, 0x000500a7, 0x000001cc, 0x0000029a, 0x00000297, 0x00000299,
-    0x000300f7, 0x0000029c, 0x00000000, 0x000400fa, 0x0000029a, 0x0000029b, 0x0000029c, 0x000200f8,
-    0x0000029b, 0x0004003d, 0x0000000f, 0x0000029d, 0x0000025f, 0x0004003d, 0x00000006, 0x0000029e,
-    0x000001e3, 0x0004007c, 0x0000000f, 0x0000029f, 0x0000029e, 0x00050050, 0x00000010, 0x000002a0,
-    0x0000029d, 0x0000029f, 0x0003003e, 0x000002a1, 0x000002a0, 0x00050039, 0x00000006, 0x000002a2,
-    0x00000014, 0x000002a1, 0x0003003e, 0x0000027a, 0x000002a2, 0x000200f9, 0x0000029c, 0x000200f8,
-    0x0000029c, 0x000200f9, 0x0000027f, 0x000200f8, 0x0000027f, 0x0004003d, 0x00000006, 0x000002a3,
-    0x0000027a, 0x000500c2, 0x00000006, 0x000002a4, 0x000002a3, 0x00000221, 0x000500c7, 0x00000006,
-    0x000002a5, 0x000002a4, 0x00000050, 0x000500ab, 0x000001cc, 0x000002a6, 0x000002a5, 0x00000069,
-    0x000300f7, 0x000002a8, 0x00000000, 0x000400fa, 0x000002a6, 0x000002a7, 0x000002a8, 0x000200f8,
-    0x000002a7, 0x0004003d, 0x00000006, 0x000002aa, 0x0000021f, 0x000500c7, 0x00000006, 0x000002ac,
-    0x000002aa, 0x000002ab, 0x0003003e, 0x000002a9, 0x000002ac, 0x0004003d, 0x00000006, 0x000002ae,
-    0x0000020f, 0x000500c2, 0x00000006, 0x000002af, 0x000002ae, 0x000000af, 0x000500c7, 0x00000006,
-    0x000002b0, 0x000002af, 0x00000050, 0x0003003e, 0x000002ad, 0x000002b0, 0x0004003d, 0x00000006,
-    0x000002b2, 0x0000020f, 0x000500c2, 0x00000006, 0x000002b3, 0x000002b2, 0x000000e8, 0x000500c7,
-    0x00000006, 0x000002b4, 0x000002b3, 0x00000050, 0x0003003e, 0x000002b1, 0x000002b4, 0x0004003d,
-    0x00000006, 0x000002b5, 0x000002a9, 0x000500aa, 0x000001cc, 0x000002b6, 0x000002b5, 0x0000006e,
-    0x000300f7, 0x000002b8, 0x00000000, 0x000400fa, 0x000002b6, 0x000002b7, 0x000002b8, 0x000200f8,
-    0x000002b7, 0x0004003d, 0x00000006, 0x000002b9, 0x0000021f, 0x000500c7, 0x00000006, 0x000002bb,
-    0x000002b9, 0x000002ba, 0x000500ab, 0x000001cc, 0x000002bc, 0x000002bb, 0x00000069, 0x000200f9,
-    0x000002b8, 0x000200f8, 0x000002b8, 0x000700f5, 0x000001cc, 0x000002bd, 0x000002b6, 0x000002a7,
-    0x000002bc, 0x000002b7, 0x000300f7, 0x000002bf, 0x00000000, 0x000400fa, 0x000002bd, 0x000002be,
-    0x000002c9, 0x000200f8, 0x000002be, 0x0004003d, 0x00000006, 0x000002c1, 0x00000207, 0x0003003e,
-    0x000002c0, 0x000002c1, 0x0004003d, 0x00000006, 0x000002c3, 0x0000027a, 0x0003003e, 0x000002c2,
-    0x000002c3, 0x0004003d, 0x00000006, 0x000002c5, 0x000002ad, 0x0003003e, 0x000002c4, 0x000002c5,
-    0x0004003d, 0x00000006, 0x000002c7, 0x000002b1, 0x0003003e, 0x000002c6, 0x000002c7, 0x00080039,
-    0x00000006, 0x000002c8, 0x0000002a, 0x000002c0, 0x000002c2, 0x000002c4, 0x000002c6, 0x0003003e,
-    0x00000231, 0x000002c8, 0x000200f9, 0x000002bf, 0x000200f8, 0x000002c9, 0x0004003d, 0x00000006,
-    0x000002ca, 0x000002a9, 0x000500aa, 0x000001cc, 0x000002cb, 0x000002ca, 0x00000076, 0x000300f7,
-    0x000002cd, 0x00000000, 0x000400fa, 0x000002cb, 0x000002cc, 0x000002d4, 0x000200f8, 0x000002cc,
-    0x0004003d, 0x00000006, 0x000002cf, 0x0000027a, 0x0003003e, 0x000002ce, 0x000002cf, 0x0004003d,
-    0x00000006, 0x000002d1, 0x000002ad, 0x0003003e, 0x000002d0, 0x000002d1, 0x0003003e, 0x000002d2,
-    0x000000af, 0x00070039, 0x00000006, 0x000002d3, 0x00000035, 0x000002ce, 0x000002d0, 0x000002d2,
-    0x0003003e, 0x00000231, 0x000002d3, 0x000200f9, 0x000002cd, 0x000200f8, 0x000002d4, 0x0004003d,
-    0x00000006, 0x000002d5, 0x000002a9, 0x000500aa, 0x000001cc, 0x000002d6, 0x000002d5, 0x0000007e,
-    0x000300f7, 0x000002d8, 0x00000000, 0x000400fa, 0x000002d6, 0x000002d7, 0x000002e0, 0x000200f8,
-    0x000002d7, 0x0004003d, 0x00000006, 0x000002db, 0x0000027a, 0x0003003e, 0x000002da, 0x000002db,
-    0x0004003d, 0x00000006, 0x000002dd, 0x000002ad, 0x0003003e, 0x000002dc, 0x000002dd, 0x0003003e,
-    0x000002de, 0x000002d9, 0x00070039, 0x00000006, 0x000002df, 0x0000003a, 0x000002da, 0x000002dc,
-    0x000002de, 0x0003003e, 0x00000231, 0x000002df, 0x000200f9, 0x000002d8, 0x000200f8, 0x000002e0,
-    0x0004003d, 0x00000006, 0x000002e1, 0x000002a9, 0x000500aa, 0x000001cc, 0x000002e2, 0x000002e1,
-    0x000001a7, 0x000300f7, 0x000002e4, 0x00000000, 0x000400fa, 0x000002e2, 0x000002e3, 0x000002ea,
-    0x000200f8, 0x000002e3, 0x0004003d, 0x00000006, 0x000002e6, 0x0000027a, 0x0003003e, 0x000002e5,
-    0x000002e6, 0x0004003d, 0x00000006, 0x000002e8, 0x000001fd, 0x0003003e, 0x000002e7, 0x000002e8,
-    0x00060039, 0x00000006, 0x000002e9, 0x0000002f, 0x000002e5, 0x000002e7, 0x0003003e, 0x00000231,
-    0x000002e9, 0x000200f9, 0x000002e4, 0x000200f8, 0x000002ea, 0x0004003d, 0x00000006, 0x000002eb,
-    0x0000027a, 0x0003003e, 0x00000231, 0x000002eb, 0x000200f9, 0x000002e4, 0x000200f8, 0x000002e4,
-    0x000200f9, 0x000002d8, 0x000200f8, 0x000002d8, 0x000200f9, 0x000002cd, 0x000200f8, 0x000002cd,
-    0x000200f9, 0x000002bf, 0x000200f8, 0x000002bf, 0x000200f9, 0x000002a8, 0x000200f8, 0x000002a8,
-    0x000200f9, 0x00000257, 0x000200f8, 0x00000257, 0x000200f9, 0x00000245, 0x000200f8, 0x00000245,
-    0x0004003d, 0x00000006, 0x000002ec, 0x0000022d, 0x000500ab, 0x000001cc, 0x000002ed, 0x000002ec,
-    0x00000069, 0x000300f7, 0x000002ef, 0x00000000, 0x000400fa, 0x000002ed, 0x000002ee, 0x000002ef,
-    0x000200f8, 0x000002ee, 0x0004003d, 0x00000006, 0x000002f1, 0x00000223, 0x000500c2, 0x00000006,
-    0x000002f2, 0x000002f1, 0x000000af, 0x000500c7, 0x00000006, 0x000002f3, 0x000002f2, 0x0000007e,
-    0x0003003e, 0x000002f0, 0x000002f3, 0x0004003d, 0x00000006, 0x000002f5, 0x00000223, 0x000500c7,
-    0x00000006, 0x000002f6, 0x000002f5, 0x00000050, 0x0007000c, 0x00000006, 0x000002f7, 0x00000001,
-    0x00000026, 0x000002f6, 0x000000e8, 0x0003003e, 0x000002f4, 0x000002f7, 0x0004003d, 0x00000006,
-    0x000002f8, 0x000002f0, 0x000500aa, 0x000001cc, 0x000002f9, 0x000002f8, 0x0000006e, 0x000300f7,
-    0x000002fb, 0x00000000, 0x000400fa, 0x000002f9, 0x000002fa, 0x00000302, 0x000200f8, 0x000002fa,
-    0x0004003d, 0x00000006, 0x000002fd, 0x00000231, 0x0003003e, 0x000002fc, 0x000002fd, 0x0004003d,
-    0x00000006, 0x000002ff, 0x000002f4, 0x0003003e, 0x000002fe, 0x000002ff, 0x0003003e, 0x00000300,
-    0x00000069, 0x00070039, 0x00000006, 0x00000301, 0x00000035, 0x000002fc, 0x000002fe, 0x00000300,
-    0x0003003e, 0x00000231, 0x00000301, 0x000200f9, 0x000002fb, 0x000200f8, 0x00000302, 0x0004003d,
-    0x00000006, 0x00000303, 0x000002f0, 0x000500aa, 0x000001cc, 0x00000304, 0x00000303, 0x00000076,
-    0x000300f7, 0x00000306, 0x00000000, 0x000400fa, 0x00000304, 0x00000305, 0x00000306, 0x000200f8,
-    0x00000305, 0x0004003d, 0x00000006, 0x00000308, 0x00000231, 0x0003003e, 0x00000307, 0x00000308,
-    0x0004003d, 0x00000006, 0x0000030a, 0x000002f4, 0x0003003e, 0x00000309, 0x0000030a, 0x0003003e,
-    0x0000030b, 0x000002ab, 0x00070039, 0x00000006, 0x0000030c, 0x0000003a, 0x00000307, 0x00000309,
-    0x0000030b, 0x0003003e, 0x00000231, 0x0000030c, 0x000200f9, 0x00000306, 0x000200f8, 0x00000306,
-    0x000200f9, 0x000002fb, 0x000200f8, 0x000002fb, 0x000200f9, 0x000002ef, 0x000200f8, 0x000002ef,
-    0x0004003d, 0x00000006, 0x0000030f, 0x00000231, 0x0003003e, 0x0000030e, 0x0000030f, 0x00050039,
-    0x00000006, 0x00000310, 0x0000003d, 0x0000030e, 0x0003003e, 0x0000030d, 0x00000310, 0x00050041,
-    0x00000291, 0x00000312, 0x0000028f, 0x00000311, 0x0004003d, 0x00000006, 0x00000313, 0x00000312,
-    0x000500ab, 0x000001cc, 0x00000314, 0x00000313, 0x00000069, 0x000300f7, 0x00000316, 0x00000000,
-    0x000400fa, 0x00000314, 0x00000315, 0x00000343, 0x000200f8, 0x00000315, 0x0004003d, 0x00000006,
-    0x00000318, 0x0000030d, 0x000500c2, 0x00000006, 0x00000319, 0x00000318, 0x000000e8, 0x000500c7,
-    0x00000006, 0x0000031a, 0x00000319, 0x0000004b, 0x00040070, 0x00000056, 0x0000031b, 0x0000031a,
-    0x00050088, 0x00000056, 0x0000031c, 0x0000031b, 0x00000064, 0x0004003d, 0x00000006, 0x0000031d,
-    0x0000030d, 0x000500c2, 0x00000006, 0x0000031e, 0x0000031d, 0x000000af, 0x000500c7, 0x00000006,
-    0x0000031f, 0x0000031e, 0x0000004b, 0x00040070, 0x00000056, 0x00000320, 0x0000031f, 0x00050088,
-    0x00000056, 0x00000321, 0x00000320, 0x00000064, 0x0004003d, 0x00000006, 0x00000322, 0x0000030d,
-    0x000500c7, 0x00000006, 0x00000323, 0x00000322, 0x0000004b, 0x00040070, 0x00000056, 0x00000324,
-    0x00000323, 0x00050088, 0x00000056, 0x00000325, 0x00000324, 0x00000064, 0x0004003d, 0x00000006,
-    0x00000326, 0x0000030d, 0x000500c2, 0x00000006, 0x00000327, 0x00000326, 0x00000221, 0x000500c7,
-    0x00000006, 0x00000328, 0x00000327, 0x0000004b, 0x00040070, 0x00000056, 0x00000329, 0x00000328,
-    0x00050088, 0x00000056, 0x0000032a, 0x00000329, 0x00000064, 0x00070050, 0x00000057, 0x0000032b,
-    0x0000031c, 0x00000321, 0x00000325, 0x0000032a, 0x0003003e, 0x00000317, 0x0000032b, 0x0004003d,
-    0x00000006, 0x0000032c, 0x000001de, 0x000500aa, 0x000001cc, 0x0000032d, 0x0000032c, 0x00000069,
-    0x000300f7, 0x0000032f, 0x00000000, 0x000400fa, 0x0000032d, 0x0000032e, 0x00000339, 0x000200f8,
-    0x0000032e, 0x0004003d, 0x0000005a, 0x00000331, 0x00000330, 0x00050041, 0x00000007, 0x00000332,
-    0x000001c6, 0x00000069, 0x0004003d, 0x00000006, 0x00000333, 0x00000332, 0x0004007c, 0x0000000f,
-    0x00000334, 0x00000333, 0x0004003d, 0x00000006, 0x00000335, 0x000001e3, 0x0004007c, 0x0000000f,
-    0x00000336, 0x00000335, 0x00050050, 0x00000010, 0x00000337, 0x00000334, 0x00000336, 0x0004003d,
-    0x00000057, 0x00000338, 0x00000317, 0x00040063, 0x00000331, 0x00000337, 0x00000338, 0x000200f9,
-    0x0000032f, 0x000200f8, 0x00000339, 0x0004003d, 0x0000005a, 0x0000033b, 0x0000033a, 0x00050041,
-    0x00000007, 0x0000033c, 0x000001c6, 0x00000069, 0x0004003d, 0x00000006, 0x0000033d, 0x0000033c,
-    0x0004007c, 0x0000000f, 0x0000033e, 0x0000033d, 0x0004003d, 0x00000006, 0x0000033f, 0x000001e3,
-    0x0004007c, 0x0000000f, 0x00000340, 0x0000033f, 0x00050050, 0x00000010, 0x00000341, 0x0000033e,
-    0x00000340, 0x0004003d, 0x00000057, 0x00000342, 0x00000317, 0x00040063, 0x0000033b, 0x00000341,
-    0x00000342, 0x000200f9, 0x0000032f, 0x000200f8, 0x0000032f, 0x000200f9, 0x00000316, 0x000200f8,
-    0x00000343, 0x0004003d, 0x00000006, 0x00000348, 0x000001de, 0x00050084, 0x00000006, 0x0000034b,
-    0x00000348, 0x0000034a, 0x0004003d, 0x00000006, 0x0000034c, 0x000001e3, 0x00050084, 0x00000006,
-    0x0000034e, 0x0000034c, 0x0000034d, 0x00050080, 0x00000006, 0x0000034f, 0x0000034b, 0x0000034e,
-    0x00050041, 0x00000007, 0x00000350, 0x000001c6, 0x00000069, 0x0004003d, 0x00000006, 0x00000351,
-    0x00000350, 0x00050080, 0x00000006, 0x00000352, 0x0000034f, 0x00000351, 0x0004003d, 0x00000006,
-    0x00000353, 0x0000030d, 0x00060041, 0x000001c1, 0x00000354, 0x00000347, 0x000001bb, 0x00000352,
-    0x0003003e, 0x00000354, 0x00000353, 0x000200f9, 0x00000316, 0x000200f8, 0x00000316, 0x000100fd,
-    0x00010038, 0x00050036, 0x00000006, 0x0000000a, 0x00000000, 0x00000008, 0x00030037, 0x00000007,
-    0x00000009, 0x000200f8, 0x0000000b, 0x0004003d, 0x00000006, 0x00000046, 0x00000009, 0x00050084,
-    0x00000006, 0x00000048, 0x00000046, 0x00000047, 0x00050080, 0x00000006, 0x0000004a, 0x00000048,
-    0x00000049, 0x00050086, 0x00000006, 0x0000004c, 0x0000004a, 0x0000004b, 0x000200fe, 0x0000004c,
-    0x00010038, 0x00050036, 0x00000006, 0x0000000d, 0x00000000, 0x00000008, 0x00030037, 0x00000007,
-    0x0000000c, 0x000200f8, 0x0000000e, 0x0004003d, 0x00000006, 0x0000004f, 0x0000000c, 0x00050084,
-    0x00000006, 0x00000051, 0x0000004f, 0x00000050, 0x00050080, 0x00000006, 0x00000052, 0x00000051,
-    0x00000049, 0x00050086, 0x00000006, 0x00000053, 0x00000052, 0x0000004b, 0x000200fe, 0x00000053,
-    0x00010038, 0x00050036, 0x00000006, 0x00000014, 0x00000000, 0x00000012, 0x00030037, 0x00000011,
-    0x00000013, 0x000200f8, 0x00000015, 0x0004003b, 0x00000058, 0x00000059, 0x00000007, 0x0004003b,
-    0x00000061, 0x00000062, 0x00000007, 0x0004003b, 0x00000007, 0x00000068, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000006d, 0x00000007, 0x0004003b, 0x00000007, 0x00000075, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000007d, 0x00000007, 0x0004003d, 0x0000005a, 0x0000005d, 0x0000005c, 0x0004003d,
-    0x00000010, 0x0000005e, 0x00000013, 0x00050062, 0x00000057, 0x0000005f, 0x0000005d, 0x0000005e,
-    0x0003003e, 0x00000059, 0x0000005f, 0x0004003d, 0x00000057, 0x00000063, 0x00000059, 0x0005008e,
-    0x00000057, 0x00000065, 0x00000063, 0x00000064, 0x0006000c, 0x00000057, 0x00000066, 0x00000001,
-    0x00000001, 0x00000065, 0x0004006d, 0x00000060, 0x00000067, 0x00000066, 0x0003003e, 0x00000062,
-    0x00000067, 0x00050041, 0x00000007, 0x0000006a, 0x00000062, 0x00000069, 0x0004003d, 0x00000006,
-    0x0000006b, 0x0000006a, 0x0003003e, 0x00000068, 0x0000006b, 0x00050039, 0x00000006, 0x0000006c,
-    0x0000000a, 0x00000068, 0x00050041, 0x00000007, 0x0000006f, 0x00000062, 0x0000006e, 0x0004003d,
-    0x00000006, 0x00000070, 0x0000006f, 0x0003003e, 0x0000006d, 0x00000070, 0x00050039, 0x00000006,
-    0x00000071, 0x0000000a, 0x0000006d, 0x000500c4, 0x00000006, 0x00000073, 0x00000071, 0x00000072,
-    0x000500c5, 0x00000006, 0x00000074, 0x0000006c, 0x00000073, 0x00050041, 0x00000007, 0x00000077,
-    0x00000062, 0x00000076, 0x0004003d, 0x00000006, 0x00000078, 0x00000077, 0x0003003e, 0x00000075,
-    0x00000078, 0x00050039, 0x00000006, 0x00000079, 0x0000000a, 0x00000075, 0x000500c4, 0x00000006,
-    0x0000007b, 0x00000079, 0x0000007a, 0x000500c5, 0x00000006, 0x0000007c, 0x00000074, 0x0000007b,
-    0x00050041, 0x00000007, 0x0000007f, 0x00000062, 0x0000007e, 0x0004003d, 0x00000006, 0x00000080,
-    0x0000007f, 0x0003003e, 0x0000007d, 0x00000080, 0x00050039, 0x00000006, 0x00000081, 0x0000000d,
-    0x0000007d, 0x000500c4, 0x00000006, 0x00000083, 0x00000081, 0x00000082, 0x000500c5, 0x00000006,
-    0x00000084, 0x0000007c, 0x00000083, 0x000200fe, 0x00000084, 0x00010038, 0x00050036, 0x00000006,
-    0x00000017, 0x00000000, 0x00000008, 0x00030037, 0x00000007, 0x00000016, 0x000200f8, 0x00000018,
-    0x0004003d, 0x00000006, 0x00000087, 0x00000016, 0x000500c7, 0x00000006, 0x00000088, 0x00000087,
-    0x00000047, 0x000200fe, 0x00000088, 0x00010038, 0x00050036, 0x00000006, 0x0000001a, 0x00000000,
-    0x00000008, 0x00030037, 0x00000007, 0x00000019, 0x000200f8, 0x0000001b, 0x0004003d, 0x00000006,
-    0x0000008b, 0x00000019, 0x000500c2, 0x00000006, 0x0000008c, 0x0000008b, 0x00000072, 0x000500c7,
-    0x00000006, 0x0000008d, 0x0000008c, 0x00000047, 0x000200fe, 0x0000008d, 0x00010038, 0x00050036,
-    0x00000006, 0x0000001d, 0x00000000, 0x00000008, 0x00030037, 0x00000007, 0x0000001c, 0x000200f8,
-    0x0000001e, 0x0004003d, 0x00000006, 0x00000090, 0x0000001c, 0x000500c2, 0x00000006, 0x00000091,
-    0x00000090, 0x0000007a, 0x000500c7, 0x00000006, 0x00000092, 0x00000091, 0x00000047, 0x000200fe,
-    0x00000092, 0x00010038, 0x00050036, 0x00000006, 0x00000024, 0x00000000, 0x0000001f, 0x00030037,
-    0x00000007, 0x00000020, 0x00030037, 0x00000007, 0x00000021, 0x00030037, 0x00000007, 0x00000022,
-    0x00030037, 0x00000007, 0x00000023, 0x000200f8, 0x00000025, 0x0004003d, 0x00000006, 0x00000095,
-    0x00000020, 0x0007000c, 0x00000006, 0x00000096, 0x00000001, 0x00000026, 0x00000095, 0x00000047,
-    0x0004003d, 0x00000006, 0x00000097, 0x00000021, 0x0007000c, 0x00000006, 0x00000098, 0x00000001,
-    0x00000026, 0x00000097, 0x00000047, 0x000500c4, 0x00000006, 0x00000099, 0x00000098, 0x00000072,
-    0x000500c5, 0x00000006, 0x0000009a, 0x00000096, 0x00000099, 0x0004003d, 0x00000006, 0x0000009b,
-    0x00000022, 0x0007000c, 0x00000006, 0x0000009c, 0x00000001, 0x00000026, 0x0000009b, 0x00000047,
-    0x000500c4, 0x00000006, 0x0000009d, 0x0000009c, 0x0000007a, 0x000500c5, 0x00000006, 0x0000009e,
-    0x0000009a, 0x0000009d, 0x0004003d, 0x00000006, 0x0000009f, 0x00000023, 0x000500c4, 0x00000006,
-    0x000000a0, 0x0000009f, 0x00000082, 0x000500c5, 0x00000006, 0x000000a1, 0x0000009e, 0x000000a0,
-    0x000200fe, 0x000000a1, 0x00010038, 0x00050036, 0x00000006, 0x0000002a, 0x00000000, 0x0000001f,
-    0x00030037, 0x00000007, 0x00000026, 0x00030037, 0x00000007, 0x00000027, 0x00030037, 0x00000007,
-    0x00000028, 0x00030037, 0x00000007, 0x00000029, 0x000200f8, 0x0000002b, 0x0004003b, 0x00000007,
-    0x000000a4, 0x00000007, 0x0004003b, 0x00000007, 0x000000a9, 0x00000007, 0x0004003b, 0x00000007,
-    0x000000b3, 0x00000007, 0x0004003b, 0x00000007, 0x000000b8, 0x00000007, 0x0004003b, 0x00000007,
-    0x000000c0, 0x00000007, 0x0004003b, 0x00000007, 0x000000c5, 0x00000007, 0x0004003b, 0x00000007,
-    0x000000cd, 0x00000007, 0x0004003b, 0x00000007, 0x000000ce, 0x00000007, 0x0004003b, 0x00000007,
-    0x000000cf, 0x00000007, 0x0004003b, 0x00000007, 0x000000d0, 0x00000007, 0x0004003d, 0x00000006,
-    0x000000a5, 0x00000026, 0x0003003e, 0x000000a4, 0x000000a5, 0x00050039, 0x00000006, 0x000000a6,
-    0x00000017, 0x000000a4, 0x0004003d, 0x00000006, 0x000000a7, 0x00000028, 0x00050084, 0x00000006,
-    0x000000a8, 0x000000a6, 0x000000a7, 0x0004003d, 0x00000006, 0x000000aa, 0x00000027, 0x0003003e,
-    0x000000a9, 0x000000aa, 0x00050039, 0x00000006, 0x000000ab, 0x00000017, 0x000000a9, 0x0004003d,
-    0x00000006, 0x000000ac, 0x00000029, 0x00050084, 0x00000006, 0x000000ad, 0x000000ab, 0x000000ac,
-    0x00050080, 0x00000006, 0x000000ae, 0x000000a8, 0x000000ad, 0x00050080, 0x00000006, 0x000000b0,
-    0x000000ae, 0x000000af, 0x000500c2, 0x00000006, 0x000000b2, 0x000000b0, 0x000000b1, 0x0004003d,
-    0x00000006, 0x000000b4, 0x00000026, 0x0003003e, 0x000000b3, 0x000000b4, 0x00050039, 0x00000006,
-    0x000000b5, 0x0000001a, 0x000000b3, 0x0004003d, 0x00000006, 0x000000b6, 0x00000028, 0x00050084,
-    0x00000006, 0x000000b7, 0x000000b5, 0x000000b6, 0x0004003d, 0x00000006, 0x000000b9, 0x00000027,
-    0x0003003e, 0x000000b8, 0x000000b9, 0x00050039, 0x00000006, 0x000000ba, 0x0000001a, 0x000000b8,
-    0x0004003d, 0x00000006, 0x000000bb, 0x00000029, 0x00050084, 0x00000006, 0x000000bc, 0x000000ba,
-    0x000000bb, 0x00050080, 0x00000006, 0x000000bd, 0x000000b7, 0x000000bc, 0x00050080, 0x00000006,
-    0x000000be, 0x000000bd, 0x000000af, 0x000500c2, 0x00000006, 0x000000bf, 0x000000be, 0x000000b1,
-    0x0004003d, 0x00000006, 0x000000c1, 0x00000026, 0x0003003e, 0x000000c0, 0x000000c1, 0x00050039,
-    0x00000006, 0x000000c2, 0x0000001d, 0x000000c0, 0x0004003d, 0x00000006, 0x000000c3, 0x00000028,
-    0x00050084, 0x00000006, 0x000000c4, 0x000000c2, 0x000000c3, 0x0004003d, 0x00000006, 0x000000c6,
-    0x00000027, 0x0003003e, 0x000000c5, 0x000000c6, 0x00050039, 0x00000006, 0x000000c7, 0x0000001d,
-    0x000000c5, 0x0004003d, 0x00000006, 0x000000c8, 0x00000029, 0x00050084, 0x00000006, 0x000000c9,
-    0x000000c7, 0x000000c8, 0x00050080, 0x00000006, 0x000000ca, 0x000000c4, 0x000000c9, 0x00050080,
-    0x00000006, 0x000000cb, 0x000000ca, 0x000000af, 0x000500c2, 0x00000006, 0x000000cc, 0x000000cb,
-    0x000000b1, 0x0003003e, 0x000000cd, 0x000000b2, 0x0003003e, 0x000000ce, 0x000000bf, 0x0003003e,
-    0x000000cf, 0x000000cc, 0x0003003e, 0x000000d0, 0x0000004b, 0x00080039, 0x00000006, 0x000000d1,
-    0x00000024, 0x000000cd, 0x000000ce, 0x000000cf, 0x000000d0, 0x000200fe, 0x000000d1, 0x00010038,
-    0x00050036, 0x00000006, 0x0000002f, 0x00000000, 0x0000002c, 0x00030037, 0x00000007, 0x0000002d,
-    0x00030037, 0x00000007, 0x0000002e, 0x000200f8, 0x00000030, 0x0004003b, 0x00000007, 0x000000d4,
-    0x00000007, 0x0004003b, 0x00000007, 0x000000d9, 0x00000007, 0x0004003b, 0x00000007, 0x000000dd,
-    0x00000007, 0x0004003b, 0x00000007, 0x000000e2, 0x00000007, 0x0004003b, 0x00000007, 0x000000ec,
-    0x00000007, 0x0004003b, 0x00000007, 0x000000f1, 0x00000007, 0x0004003b, 0x00000007, 0x000000f9,
-    0x00000007, 0x0004003b, 0x00000007, 0x000000fe, 0x00000007, 0x0004003b, 0x00000007, 0x00000106,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000107, 0x00000007, 0x0004003b, 0x00000007, 0x00000108,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000109, 0x00000007, 0x0004003d, 0x00000006, 0x000000d5,
-    0x0000002d, 0x000500c2, 0x00000006, 0x000000d6, 0x000000d5, 0x00000082, 0x000500c7, 0x00000006,
-    0x000000d7, 0x000000d6, 0x00000050, 0x00050080, 0x00000006, 0x000000d8, 0x000000d7, 0x0000006e,
-    0x0003003e, 0x000000d4, 0x000000d8, 0x0004003d, 0x00000006, 0x000000db, 0x000000d4, 0x00050082,
-    0x00000006, 0x000000dc, 0x000000da, 0x000000db, 0x0003003e, 0x000000d9, 0x000000dc, 0x0004003d,
-    0x00000006, 0x000000de, 0x0000002d, 0x0003003e, 0x000000dd, 0x000000de, 0x00050039, 0x00000006,
-    0x000000df, 0x00000017, 0x000000dd, 0x0004003d, 0x00000006, 0x000000e0, 0x000000d4, 0x00050084,
-    0x00000006, 0x000000e1, 0x000000df, 0x000000e0, 0x0004003d, 0x00000006, 0x000000e3, 0x0000002e,
-    0x0003003e, 0x000000e2, 0x000000e3, 0x00050039, 0x00000006, 0x000000e4, 0x00000017, 0x000000e2,
-    0x0004003d, 0x00000006, 0x000000e5, 0x000000d9, 0x00050084, 0x00000006, 0x000000e6, 0x000000e4,
-    0x000000e5, 0x00050080, 0x00000006, 0x000000e7, 0x000000e1, 0x000000e6, 0x00050080, 0x00000006,
-    0x000000e9, 0x000000e7, 0x000000e8, 0x000500c2, 0x00000006, 0x000000eb, 0x000000e9, 0x000000ea,
-    0x0004003d, 0x00000006, 0x000000ed, 0x0000002d, 0x0003003e, 0x000000ec, 0x000000ed, 0x00050039,
-    0x00000006, 0x000000ee, 0x0000001a, 0x000000ec, 0x0004003d, 0x00000006, 0x000000ef, 0x000000d4,
-    0x00050084, 0x00000006, 0x000000f0, 0x000000ee, 0x000000ef, 0x0004003d, 0x00000006, 0x000000f2,
-    0x0000002e, 0x0003003e, 0x000000f1, 0x000000f2, 0x00050039, 0x00000006, 0x000000f3, 0x0000001a,
-    0x000000f1, 0x0004003d, 0x00000006, 0x000000f4, 0x000000d9, 0x00050084, 0x00000006, 0x000000f5,
-    0x000000f3, 0x000000f4, 0x00050080, 0x00000006, 0x000000f6, 0x000000f0, 0x000000f5, 0x00050080,
-    0x00000006, 0x000000f7, 0x000000f6, 0x000000e8, 0x000500c2, 0x00000006, 0x000000f8, 0x000000f7,
-    0x000000ea, 0x0004003d, 0x00000006, 0x000000fa, 0x0000002d, 0x0003003e, 0x000000f9, 0x000000fa,
-    0x00050039, 0x00000006, 0x000000fb, 0x0000001d, 0x000000f9, 0x0004003d, 0x00000006, 0x000000fc,
-    0x000000d4, 0x00050084, 0x00000006, 0x000000fd, 0x000000fb, 0x000000fc, 0x0004003d, 0x00000006,
-    0x000000ff, 0x0000002e, 0x0003003e, 0x000000fe, 0x000000ff, 0x00050039, 0x00000006, 0x00000100,
-    0x0000001d, 0x000000fe, 0x0004003d, 0x00000006, 0x00000101, 0x000000d9, 0x00050084, 0x00000006,
-    0x00000102, 0x00000100, 0x00000101, 0x00050080, 0x00000006, 0x00000103, 0x000000fd, 0x00000102,
-    0x00050080, 0x00000006, 0x00000104, 0x00000103, 0x000000e8, 0x000500c2, 0x00000006, 0x00000105,
-    0x00000104, 0x000000ea, 0x0003003e, 0x00000106, 0x000000eb, 0x0003003e, 0x00000107, 0x000000f8,
-    0x0003003e, 0x00000108, 0x00000105, 0x0003003e, 0x00000109, 0x0000004b, 0x00080039, 0x00000006,
-    0x0000010a, 0x00000024, 0x00000106, 0x00000107, 0x00000108, 0x00000109, 0x000200fe, 0x0000010a,
-    0x00010038, 0x00050036, 0x00000006, 0x00000035, 0x00000000, 0x00000031, 0x00030037, 0x00000007,
-    0x00000032, 0x00030037, 0x00000007, 0x00000033, 0x00030037, 0x00000007, 0x00000034, 0x000200f8,
-    0x00000036, 0x0004003b, 0x00000007, 0x0000010d, 0x00000007, 0x0004003b, 0x00000007, 0x00000110,
-    0x00000007, 0x0004003b, 0x00000007, 0x0000011a, 0x00000007, 0x0004003b, 0x00000007, 0x0000011d,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000127, 0x00000007, 0x0004003b, 0x00000007, 0x0000012a,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000134, 0x00000007, 0x0004003b, 0x00000007, 0x00000135,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000136, 0x00000007, 0x0004003b, 0x00000007, 0x00000137,
-    0x00000007, 0x0004003d, 0x00000006, 0x0000010e, 0x00000032, 0x0003003e, 0x0000010d, 0x0000010e,
-    0x00050039, 0x00000006, 0x0000010f, 0x00000017, 0x0000010d, 0x0004003d, 0x00000006, 0x00000111,
-    0x00000032, 0x0003003e, 0x00000110, 0x00000111, 0x00050039, 0x00000006, 0x00000112, 0x00000017,
-    0x00000110, 0x00050082, 0x00000006, 0x00000113, 0x00000047, 0x00000112, 0x0004003d, 0x00000006,
-    0x00000114, 0x00000033, 0x00050084, 0x00000006, 0x00000115, 0x00000113, 0x00000114, 0x0004003d,
-    0x00000006, 0x00000116, 0x00000034, 0x00050080, 0x00000006, 0x00000117, 0x00000115, 0x00000116,
-    0x000500c2, 0x00000006, 0x00000118, 0x00000117, 0x000000b1, 0x00050080, 0x00000006, 0x00000119,
-    0x0000010f, 0x00000118, 0x0004003d, 0x00000006, 0x0000011b, 0x00000032, 0x0003003e, 0x0000011a,
-    0x0000011b, 0x00050039, 0x00000006, 0x0000011c, 0x0000001a, 0x0000011a, 0x0004003d, 0x00000006,
-    0x0000011e, 0x00000032, 0x0003003e, 0x0000011d, 0x0000011e, 0x00050039, 0x00000006, 0x0000011f,
-    0x0000001a, 0x0000011d, 0x00050082, 0x00000006, 0x00000120, 0x00000047, 0x0000011f, 0x0004003d,
-    0x00000006, 0x00000121, 0x00000033, 0x00050084, 0x00000006, 0x00000122, 0x00000120, 0x00000121,
-    0x0004003d, 0x00000006, 0x00000123, 0x00000034, 0x00050080, 0x00000006, 0x00000124, 0x00000122,
-    0x00000123, 0x000500c2, 0x00000006, 0x00000125, 0x00000124, 0x000000b1, 0x00050080, 0x00000006,
-    0x00000126, 0x0000011c, 0x00000125, 0x0004003d, 0x00000006, 0x00000128, 0x00000032, 0x0003003e,
-    0x00000127, 0x00000128, 0x00050039, 0x00000006, 0x00000129, 0x0000001d, 0x00000127, 0x0004003d,
-    0x00000006, 0x0000012b, 0x00000032, 0x0003003e, 0x0000012a, 0x0000012b, 0x00050039, 0x00000006,
-    0x0000012c, 0x0000001d, 0x0000012a, 0x00050082, 0x00000006, 0x0000012d, 0x00000047, 0x0000012c,
-    0x0004003d, 0x00000006, 0x0000012e, 0x00000033, 0x00050084, 0x00000006, 0x0000012f, 0x0000012d,
-    0x0000012e, 0x0004003d, 0x00000006, 0x00000130, 0x00000034, 0x00050080, 0x00000006, 0x00000131,
-    0x0000012f, 0x00000130, 0x000500c2, 0x00000006, 0x00000132, 0x00000131, 0x000000b1, 0x00050080,
-    0x00000006, 0x00000133, 0x00000129, 0x00000132, 0x0003003e, 0x00000134, 0x00000119, 0x0003003e,
-    0x00000135, 0x00000126, 0x0003003e, 0x00000136, 0x00000133, 0x0003003e, 0x00000137, 0x0000004b,
-    0x00080039, 0x00000006, 0x00000138, 0x00000024, 0x00000134, 0x00000135, 0x00000136, 0x00000137,
-    0x000200fe, 0x00000138, 0x00010038, 0x00050036, 0x00000006, 0x0000003a, 0x00000000, 0x00000031,
-    0x00030037, 0x00000007, 0x00000037, 0x00030037, 0x00000007, 0x00000038, 0x00030037, 0x00000007,
-    0x00000039, 0x000200f8, 0x0000003b, 0x0004003b, 0x00000007, 0x0000013b, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000013e, 0x00000007, 0x0004003b, 0x00000007, 0x00000147, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000014a, 0x00000007, 0x0004003b, 0x00000007, 0x00000153, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000156, 0x00000007, 0x0004003b, 0x00000007, 0x0000015f, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000160, 0x00000007, 0x0004003b, 0x00000007, 0x00000161, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000162, 0x00000007, 0x0004003d, 0x00000006, 0x0000013c, 0x00000037, 0x0003003e,
-    0x0000013b, 0x0000013c, 0x00050039, 0x00000006, 0x0000013d, 0x00000017, 0x0000013b, 0x0004003d,
-    0x00000006, 0x0000013f, 0x00000037, 0x0003003e, 0x0000013e, 0x0000013f, 0x00050039, 0x00000006,
-    0x00000140, 0x00000017, 0x0000013e, 0x0004003d, 0x00000006, 0x00000141, 0x00000038, 0x00050084,
-    0x00000006, 0x00000142, 0x00000140, 0x00000141, 0x0004003d, 0x00000006, 0x00000143, 0x00000039,
-    0x00050080, 0x00000006, 0x00000144, 0x00000142, 0x00000143, 0x000500c2, 0x00000006, 0x00000145,
-    0x00000144, 0x000000b1, 0x00050082, 0x00000006, 0x00000146, 0x0000013d, 0x00000145, 0x0004003d,
-    0x00000006, 0x00000148, 0x00000037, 0x0003003e, 0x00000147, 0x00000148, 0x00050039, 0x00000006,
-    0x00000149, 0x0000001a, 0x00000147, 0x0004003d, 0x00000006, 0x0000014b, 0x00000037, 0x0003003e,
-    0x0000014a, 0x0000014b, 0x00050039, 0x00000006, 0x0000014c, 0x0000001a, 0x0000014a, 0x0004003d,
-    0x00000006, 0x0000014d, 0x00000038, 0x00050084, 0x00000006, 0x0000014e, 0x0000014c, 0x0000014d,
-    0x0004003d, 0x00000006, 0x0000014f, 0x00000039, 0x00050080, 0x00000006, 0x00000150, 0x0000014e,
-    0x0000014f, 0x000500c2, 0x00000006, 0x00000151, 0x00000150, 0x000000b1, 0x00050082, 0x00000006,
-    0x00000152, 0x00000149, 0x00000151, 0x0004003d, 0x00000006, 0x00000154, 0x00000037, 0x0003003e,
-    0x00000153, 0x00000154, 0x00050039, 0x00000006, 0x00000155, 0x0000001d, 0x00000153, 0x0004003d,
-    0x00000006, 0x00000157, 0x00000037, 0x0003003e, 0x00000156, 0x00000157, 0x00050039, 0x00000006,
-    0x00000158, 0x0000001d, 0x00000156, 0x0004003d, 0x00000006, 0x00000159, 0x00000038, 0x00050084,
-    0x00000006, 0x0000015a, 0x00000158, 0x00000159, 0x0004003d, 0x00000006, 0x0000015b, 0x00000039,
-    0x00050080, 0x00000006, 0x0000015c, 0x0000015a, 0x0000015b, 0x000500c2, 0x00000006, 0x0000015d,
-    0x0000015c, 0x000000b1, 0x00050082, 0x00000006, 0x0000015e, 0x00000155, 0x0000015d, 0x0003003e,
-    0x0000015f, 0x00000146, 0x0003003e, 0x00000160, 0x00000152, 0x0003003e, 0x00000161, 0x0000015e,
-    0x0003003e, 0x00000162, 0x0000004b, 0x00080039, 0x00000006, 0x00000163, 0x00000024, 0x0000015f,
-    0x00000160, 0x00000161, 0x00000162, 0x000200fe, 0x00000163, 0x00010038, 0x00050036, 0x00000006,
-    0x0000003d, 0x00000000, 0x00000008, 0x00030037, 0x00000007, 0x0000003c, 0x000200f8, 0x0000003e,
-    0x0004003b, 0x00000007, 0x00000166, 0x00000007, 0x0004003b, 0x00000007, 0x00000167, 0x00000007,
-    0x0004003b, 0x00000007, 0x0000016a, 0x00000007, 0x0004003b, 0x00000007, 0x0000016b, 0x00000007,
-    0x0004003b, 0x00000007, 0x0000016e, 0x00000007, 0x0004003b, 0x00000007, 0x0000016f, 0x00000007,
-    0x0004003b, 0x00000007, 0x00000172, 0x00000007, 0x0004003b, 0x00000007, 0x00000179, 0x00000007,
-    0x0004003b, 0x00000007, 0x0000017f, 0x00000007, 0x0004003d, 0x00000006, 0x00000168, 0x0000003c,
-    0x0003003e, 0x00000167, 0x00000168, 0x00050039, 0x00000006, 0x00000169, 0x00000017, 0x00000167,
-    0x0003003e, 0x00000166, 0x00000169, 0x0004003d, 0x00000006, 0x0000016c, 0x0000003c, 0x0003003e,
-    0x0000016b, 0x0000016c, 0x00050039, 0x00000006, 0x0000016d, 0x0000001a, 0x0000016b, 0x0003003e,
-    0x0000016a, 0x0000016d, 0x0004003d, 0x00000006, 0x00000170, 0x0000003c, 0x0003003e, 0x0000016f,
-    0x00000170, 0x00050039, 0x00000006, 0x00000171, 0x0000001d, 0x0000016f, 0x0003003e, 0x0000016e,
-    0x00000171, 0x0004003d, 0x00000006, 0x00000173, 0x00000166, 0x000500c4, 0x00000006, 0x00000175,
-    0x00000173, 0x00000174, 0x0004003d, 0x00000006, 0x00000176, 0x00000166, 0x000500c2, 0x00000006,
-    0x00000177, 0x00000176, 0x000000b1, 0x000500c5, 0x00000006, 0x00000178, 0x00000175, 0x00000177,
-    0x0003003e, 0x00000172, 0x00000178, 0x0004003d, 0x00000006, 0x0000017a, 0x0000016a, 0x000500c4,
-    0x00000006, 0x0000017b, 0x0000017a, 0x00000174, 0x0004003d, 0x00000006, 0x0000017c, 0x0000016a,
-    0x000500c2, 0x00000006, 0x0000017d, 0x0000017c, 0x000000b1, 0x000500c5, 0x00000006, 0x0000017e,
-    0x0000017b, 0x0000017d, 0x0003003e, 0x00000179, 0x0000017e, 0x0004003d, 0x00000006, 0x00000180,
-    0x0000016e, 0x000500c4, 0x00000006, 0x00000181, 0x00000180, 0x00000174, 0x0004003d, 0x00000006,
-    0x00000182, 0x0000016e, 0x000500c2, 0x00000006, 0x00000183, 0x00000182, 0x000000b1, 0x000500c5,
-    0x00000006, 0x00000184, 0x00000181, 0x00000183, 0x0003003e, 0x0000017f, 0x00000184, 0x0004003d,
-    0x00000006, 0x00000185, 0x0000017f, 0x0004003d, 0x00000006, 0x00000186, 0x00000179, 0x000500c4,
-    0x00000006, 0x00000187, 0x00000186, 0x00000072, 0x000500c5, 0x00000006, 0x00000188, 0x00000185,
-    0x00000187, 0x0004003d, 0x00000006, 0x00000189, 0x00000172, 0x000500c4, 0x00000006, 0x0000018a,
-    0x00000189, 0x0000007a, 0x000500c5, 0x00000006, 0x0000018b, 0x00000188, 0x0000018a, 0x000500c5,
-    0x00000006, 0x0000018d, 0x0000018b, 0x0000018c, 0x000200fe, 0x0000018d, 0x00010038, 0x00050036,
-    0x00000006, 0x00000044, 0x00000000, 0x00000041, 0x00030037, 0x00000007, 0x00000042, 0x00030037,
-    0x00000040, 0x00000043, 0x000200f8, 0x00000045, 0x0004003b, 0x00000007, 0x00000190, 0x00000007,
-    0x0004003b, 0x00000007, 0x00000194, 0x00000007, 0x0004003b, 0x00000007, 0x00000199, 0x00000007,
-    0x0004003b, 0x00000007, 0x0000019e, 0x00000007, 0x0004003b, 0x00000007, 0x000001a5, 0x00000007,
-    0x0004003b, 0x00000007, 0x000001af, 0x00000007, 0x0004003d, 0x00000006, 0x00000191, 0x00000042,
-    0x000500c7, 0x00000006, 0x00000193, 0x00000191, 0x00000192, 0x0003003e, 0x00000190, 0x00000193,
-    0x0004003d, 0x00000006, 0x00000195, 0x00000042, 0x000500c2, 0x00000006, 0x00000197, 0x00000195,
-    0x00000196, 0x000500c7, 0x00000006, 0x00000198, 0x00000197, 0x0000007e, 0x0003003e, 0x00000194,
-    0x00000198, 0x0004003d, 0x00000006, 0x0000019a, 0x00000042, 0x000500c2, 0x00000006, 0x0000019c,
-    0x0000019a, 0x0000019b, 0x000500c7, 0x00000006, 0x0000019d, 0x0000019c, 0x0000006e, 0x0003003e,
-    0x00000199, 0x0000019d, 0x0003003e, 0x0000019e, 0x000001a4, 0x0004003d, 0x00000006, 0x000001a6,
-    0x00000199, 0x00050084, 0x00000006, 0x000001a8, 0x000001a6, 0x000001a7, 0x0004003d, 0x00000006,
-    0x000001a9, 0x00000194, 0x00050080, 0x00000006, 0x000001aa, 0x000001a8, 0x000001a9, 0x00050084,
-    0x00000006, 0x000001ac, 0x000001aa, 0x000001ab, 0x0004003d, 0x00000006, 0x000001ad, 0x00000190,
-    0x00050080, 0x00000006, 0x000001ae, 0x000001ac, 0x000001ad, 0x0003003e, 0x000001a5, 0x000001ae,
-    0x00050041, 0x00000007, 0x000001b0, 0x00000043, 0x0000006e, 0x0004003d, 0x00000006, 0x000001b1,
-    0x000001b0, 0x00050084, 0x00000006, 0x000001b3, 0x000001b1, 0x000001b2, 0x00050041, 0x00000007,
-    0x000001b4, 0x00000043, 0x00000069, 0x0004003d, 0x00000006, 0x000001b5, 0x000001b4, 0x00050080,
-    0x00000006, 0x000001b6, 0x000001b3, 0x000001b5, 0x0003003e, 0x000001af, 0x000001b6, 0x0004003d,
-    0x00000006, 0x000001bc, 0x000001a5, 0x0004003d, 0x00000006, 0x000001bd, 0x0000019e, 0x00050084,
-    0x00000006, 0x000001be, 0x000001bc, 0x000001bd, 0x0004003d, 0x00000006, 0x000001bf, 0x000001af,
-    0x00050080, 0x00000006, 0x000001c0, 0x000001be, 0x000001bf, 0x00060041, 0x000001c1, 0x000001c2,
-    0x000001ba, 0x000001bb, 0x000001c0, 0x0004003d, 0x00000006, 0x000001c3, 0x000001c2, 0x000200fe,
-    0x000001c3, 0x00010038,
+const uint8_t Blob073_Data[5585] =
+{
+    0x28, 0xb5, 0x2f, 0xfd, 0x60, 0x68, 0x54, 0x3d, 0xae, 0x00, 0x5a, 0xc2, 0x64, 0x2f, 0x37, 0x10,
+    0x80, 0xad, 0xc6, 0xa3, 0x08, 0xd0, 0x67, 0x70, 0xfa, 0xef, 0x6e, 0x1c, 0x50, 0x89, 0xeb, 0xbb,
+    0xf4, 0xff, 0xff, 0xcf, 0xcd, 0xe0, 0xdc, 0xee, 0xd2, 0x84, 0xe4, 0x24, 0x89, 0x09, 0x49, 0x91,
+    0xee, 0x34, 0x15, 0xc8, 0xc9, 0x34, 0x4d, 0xd3, 0x34, 0x98, 0x82, 0xa2, 0x25, 0x35, 0xf8, 0x64,
+    0xda, 0x26, 0x95, 0x48, 0x29, 0x53, 0x9e, 0x02, 0xd8, 0x02, 0x11, 0x03, 0x7a, 0x9f, 0x60, 0x38,
+    0xf0, 0xf1, 0x00, 0x3f, 0xe7, 0x3b, 0xdc, 0xbf, 0x7f, 0x89, 0xf7, 0x81, 0x3e, 0x9c, 0x9b, 0x6b,
+    0x71, 0x3a, 0xbb, 0xbf, 0xfe, 0x54, 0xac, 0xe3, 0xd8, 0x39, 0xc4, 0xaf, 0x58, 0xfc, 0x85, 0x43,
+    0x03, 0x7f, 0xf9, 0xc4, 0xe3, 0x3c, 0x39, 0xaf, 0xb7, 0xb5, 0xdd, 0xbd, 0x5a, 0xa4, 0x25, 0x12,
+    0x02, 0x92, 0xd6, 0x0f, 0xda, 0xc7, 0xce, 0xbf, 0x56, 0xce, 0x9a, 0x34, 0x9a, 0x99, 0x61, 0xb2,
+    0x5c, 0xc1, 0xb4, 0x74, 0x52, 0x49, 0x49, 0x4b, 0xe2, 0x3c, 0xbe, 0xd6, 0x11, 0x21, 0x63, 0x6c,
+    0x3f, 0x3c, 0xf7, 0x06, 0x67, 0xa5, 0x3f, 0x78, 0x98, 0x90, 0x30, 0x2f, 0xd0, 0xfe, 0xb0, 0xdd,
+    0x8f, 0x94, 0x2f, 0xfa, 0x7b, 0xe0, 0x7b, 0xaf, 0xe9, 0x4f, 0xc4, 0xf9, 0xe6, 0x7c, 0xbf, 0xfd,
+    0xf6, 0x71, 0x5c, 0x58, 0x1c, 0xd6, 0xbf, 0x71, 0x85, 0xe1, 0x31, 0xb6, 0xc3, 0xdb, 0x1a, 0x30,
+    0xc8, 0x85, 0x81, 0x17, 0xb7, 0xfb, 0xf8, 0x1b, 0xce, 0x62, 0x13, 0x01, 0x69, 0x2c, 0x18, 0xc1,
+    0xf6, 0x0b, 0xe7, 0x7e, 0x0f, 0x28, 0x86, 0x73, 0xee, 0xd6, 0xdf, 0x62, 0xfc, 0x00, 0x4e, 0xd5,
+    0xbd, 0xbd, 0x74, 0x50, 0xff, 0x7a, 0x77, 0xd5, 0xfb, 0xdd, 0xc5, 0x54, 0x9c, 0xfc, 0xd5, 0xde,
+    0xd2, 0xff, 0xa7, 0xe7, 0x97, 0xbe, 0x78, 0x0c, 0xd6, 0xed, 0xb8, 0xdb, 0xf1, 0x2e, 0x0e, 0x7d,
+    0xf0, 0xf5, 0xe2, 0xda, 0x4f, 0x3c, 0x7c, 0xc3, 0xe1, 0xfa, 0xed, 0x05, 0x7b, 0xd6, 0x09, 0xec,
+    0x04, 0xc4, 0xc9, 0x7a, 0x9b, 0xc0, 0x7b, 0xf3, 0xc3, 0x9a, 0x8f, 0xd7, 0x75, 0xf9, 0x97, 0xb3,
+    0xd3, 0xef, 0xed, 0x97, 0xac, 0xdb, 0x79, 0x6f, 0xed, 0xd7, 0x7b, 0xcd, 0x7a, 0xbb, 0x51, 0x72,
+    0x4b, 0x23, 0x1f, 0x06, 0xfa, 0x7f, 0xc2, 0x31, 0xdc, 0x64, 0x22, 0xce, 0xd5, 0xed, 0x22, 0xdf,
+    0xeb, 0xc5, 0xb7, 0x35, 0xe8, 0x62, 0x14, 0x8a, 0xb9, 0xf9, 0x9f, 0x8e, 0xe3, 0xfb, 0x76, 0xef,
+    0xc5, 0xcf, 0x8e, 0x63, 0xc3, 0xb8, 0x17, 0x8c, 0x78, 0x87, 0x5d, 0xbc, 0xad, 0x7f, 0xf3, 0xf0,
+    0x8e, 0x93, 0x53, 0xfc, 0xa1, 0x7e, 0x93, 0x08, 0x87, 0xf1, 0x9d, 0xcb, 0xbd, 0x41, 0x7c, 0x54,
+    0xdb, 0xd8, 0x55, 0x7c, 0xb3, 0x7d, 0xff, 0x6a, 0xf5, 0xc3, 0xae, 0x61, 0xf7, 0xc9, 0x76, 0xc2,
+    0xaf, 0xb5, 0xf7, 0x60, 0xd6, 0x6f, 0xcf, 0xc0, 0x95, 0x2d, 0xad, 0x8c, 0x6c, 0x4c, 0x4c, 0xeb,
+    0xca, 0xda, 0x64, 0x44, 0x04, 0x34, 0x95, 0xce, 0x36, 0xa8, 0xe7, 0x9c, 0x37, 0x67, 0xc6, 0x3c,
+    0x98, 0x2d, 0x5f, 0x5f, 0xb1, 0x82, 0x59, 0xe5, 0x09, 0xe5, 0x24, 0x10, 0x48, 0x1a, 0x12, 0xc6,
+    0x88, 0x88, 0xf7, 0x7e, 0x83, 0x0b, 0xff, 0xb9, 0xf8, 0x62, 0x2e, 0xd6, 0xef, 0xb1, 0x03, 0x2d,
+    0x03, 0x5c, 0x1c, 0xe8, 0xc5, 0x13, 0x73, 0xac, 0x9e, 0x17, 0x8a, 0xf3, 0x3f, 0x2e, 0xee, 0xbd,
+    0xb7, 0xe1, 0xb8, 0xad, 0x8e, 0xef, 0x38, 0x21, 0x0e, 0xf7, 0x33, 0x26, 0xef, 0xf7, 0x16, 0xe7,
+    0xe6, 0x7b, 0xf8, 0x3e, 0x16, 0x83, 0xef, 0x38, 0xb9, 0x57, 0x33, 0xbb, 0xf7, 0x2e, 0xdc, 0x97,
+    0x6f, 0xed, 0xe7, 0xcc, 0xac, 0x4c, 0x7f, 0xf0, 0x95, 0x43, 0x7b, 0xa0, 0xff, 0xf0, 0x9d, 0x6b,
+    0xc5, 0xc4, 0xdb, 0x9b, 0x30, 0x0c, 0xec, 0xc1, 0x7d, 0xe1, 0x30, 0xae, 0x8b, 0x0b, 0xbb, 0xf9,
+    0x0e, 0x37, 0xf6, 0x53, 0xae, 0xad, 0xb1, 0xae, 0xb7, 0xb5, 0x59, 0x37, 0x19, 0xc7, 0xe2, 0xea,
+    0xdf, 0x2d, 0x1e, 0xbe, 0x12, 0x87, 0xf7, 0x9c, 0xd0, 0x4a, 0x8c, 0xab, 0xe3, 0x5e, 0x38, 0xad,
+    0xfb, 0xa6, 0xd2, 0x4e, 0x75, 0xa5, 0xfe, 0xf7, 0xa8, 0xaf, 0x0f, 0xb7, 0x37, 0xb6, 0xea, 0xa7,
+    0x4e, 0x70, 0x56, 0xa6, 0x6b, 0xd3, 0xbe, 0x55, 0xd2, 0x23, 0xdb, 0xbf, 0xde, 0x6f, 0x5c, 0xf5,
+    0xf5, 0x6f, 0x2e, 0xce, 0xc3, 0x5f, 0x30, 0x12, 0x58, 0x4e, 0xc6, 0x82, 0xa3, 0xf3, 0xde, 0x7a,
+    0x4e, 0xc7, 0xbd, 0xbf, 0x78, 0x49, 0x43, 0x63, 0x77, 0x21, 0xd8, 0xfb, 0x46, 0x84, 0x8f, 0xbd,
+    0x37, 0x19, 0xe8, 0xff, 0xd3, 0xbe, 0xc6, 0x58, 0x64, 0xda, 0xae, 0xde, 0x97, 0xcf, 0x0c, 0x71,
+    0xff, 0xea, 0x7d, 0x41, 0x2f, 0xfd, 0x28, 0x77, 0xec, 0xdd, 0xea, 0xf9, 0xf4, 0x71, 0x72, 0x2e,
+    0xde, 0xe2, 0x7b, 0xce, 0xcd, 0xe2, 0x7a, 0xee, 0xcd, 0xe2, 0x5e, 0x45, 0x71, 0x38, 0x0b, 0x06,
+    0x6f, 0xb3, 0x73, 0x78, 0xd7, 0xbc, 0xbc, 0x6b, 0x36, 0xe8, 0xa3, 0x95, 0x74, 0x3d, 0x4f, 0x8f,
+    0xa2, 0x46, 0x51, 0xfe, 0xff, 0xf5, 0xfc, 0x46, 0x8c, 0xfe, 0x50, 0xff, 0xbf, 0xe8, 0xbd, 0xc6,
+    0xc4, 0xb8, 0xb8, 0xe2, 0x30, 0x17, 0xde, 0x1e, 0xde, 0xd5, 0xfe, 0x9f, 0x9f, 0xfe, 0xa3, 0xaf,
+    0x0d, 0x7f, 0xfa, 0x42, 0x3f, 0xd7, 0x2f, 0xa5, 0xa2, 0xeb, 0x5a, 0x04, 0xb2, 0xb0, 0xb4, 0xca,
+    0x9d, 0x59, 0x57, 0x55, 0x58, 0x65, 0xab, 0x01, 0x57, 0x9a, 0x03, 0xa6, 0xa0, 0xa4, 0xa2, 0xa6,
+    0x2a, 0xa9, 0x51, 0x4f, 0x55, 0xeb, 0x93, 0x93, 0x55, 0x40, 0x93, 0x93, 0x00, 0xa6, 0xa5, 0xa6,
+    0x25, 0x25, 0x6a, 0x00, 0xa5, 0xa4, 0x00, 0x48, 0x00, 0x92, 0x90, 0x8e, 0x8c, 0x00, 0x18, 0x15,
+    0x49, 0x89, 0x8a, 0x86, 0x88, 0x84, 0x82, 0x86, 0x84, 0x80, 0xa6, 0x41, 0x9e, 0x53, 0xfb, 0xd3,
+    0x8e, 0x1e, 0xf9, 0x61, 0xf2, 0x56, 0xd3, 0xd1, 0x3a, 0xb5, 0x27, 0xdd, 0xc7, 0x93, 0xcf, 0x9e,
+    0x3e, 0x9a, 0x7b, 0xf4, 0xd4, 0xc9, 0x63, 0x47, 0x4f, 0x19, 0xcf, 0x9d, 0x3c, 0x9d, 0x77, 0xda,
+    0xd8, 0xa1, 0xd3, 0x39, 0x47, 0x0e, 0x9d, 0x4d, 0x39, 0x71, 0xda, 0xc0, 0x79, 0x13, 0xc7, 0xcd,
+    0x9b, 0xdc, 0x0d, 0x9b, 0x4d, 0xce, 0x34, 0x6c, 0x1c, 0xd7, 0xa8, 0xe1, 0x7c, 0xd4, 0x54, 0x83,
+    0x26, 0x0d, 0x9a, 0x33, 0x9a, 0x6c, 0x66, 0xca, 0x9c, 0xb1, 0x2d, 0x90, 0x29, 0x43, 0x26, 0x73,
+    0xfe, 0x4f, 0x31, 0x99, 0x62, 0xc2, 0x64, 0x66, 0x01, 0xf3, 0x13, 0xe6, 0xef, 0x68, 0xa1, 0xdf,
+    0xf3, 0x0b, 0x17, 0x30, 0x5b, 0xb8, 0xe8, 0x5b, 0xb2, 0x64, 0xc1, 0xb2, 0x47, 0x4b, 0x1e, 0x2c,
+    0x54, 0x70, 0x58, 0xc1, 0xbc, 0x42, 0xa5, 0xc7, 0x8c, 0x69, 0xaf, 0x59, 0x56, 0xf9, 0xf9, 0xb7,
+    0x67, 0xfb, 0x29, 0x6d, 0x79, 0x52, 0xd6, 0xaa, 0x80, 0x45, 0x44, 0x42, 0x40, 0xd2, 0xfa, 0x41,
+    0xfb, 0xd8, 0x91, 0xb3, 0x26, 0x8d, 0x66, 0x66, 0x98, 0x2c, 0x57, 0x30, 0x2d, 0x9d, 0x54, 0x52,
+    0x4a, 0xf2, 0x80, 0x8c, 0x71, 0xa4, 0x01, 0xc3, 0xe2, 0x36, 0x2b, 0x08, 0x88, 0x75, 0x43, 0xf0,
+    0xb5, 0x45, 0x05, 0x55, 0xa5, 0xd2, 0xd2, 0x4f, 0xcf, 0x3a, 0x9d, 0x6d, 0x36, 0x35, 0xa5, 0x52,
+    0x4b, 0xb7, 0x1f, 0x3d, 0xff, 0xf3, 0x64, 0x6e, 0x79, 0x54, 0xa1, 0xad, 0x47, 0x76, 0xed, 0x2f,
+    0xf0, 0x41, 0x13, 0xca, 0x84, 0x94, 0x38, 0x10, 0xf7, 0x7f, 0xfb, 0x5a, 0xca, 0x9b, 0x1e, 0xcc,
+    0x0a, 0xd2, 0xd9, 0x06, 0xff, 0x82, 0x5f, 0x44, 0xfb, 0x35, 0xa8, 0x0e, 0x3a, 0x4d, 0x2d, 0x98,
+    0xbe, 0x82, 0x2e, 0x81, 0x8b, 0x17, 0x00, 0xdd, 0xfe, 0xca, 0x7e, 0x5e, 0x7d, 0xf5, 0x81, 0xda,
+    0x40, 0x97, 0x47, 0xbb, 0x6b, 0x4d, 0xf7, 0xf5, 0x5c, 0x2d, 0xf7, 0x68, 0xef, 0x55, 0x1f, 0x49,
+    0xc1, 0x94, 0x8d, 0x50, 0x75, 0xd8, 0x21, 0x66, 0x10, 0x1f, 0xd2, 0x80, 0x3c, 0xd8, 0xd4, 0xa0,
+    0x7f, 0xaa, 0xe0, 0x38, 0xf6, 0xd2, 0x9f, 0x53, 0xa5, 0x82, 0xa1, 0x0c, 0xaa, 0x0a, 0xf2, 0xbb,
+    0xff, 0x3a, 0xb7, 0xb6, 0x17, 0xa3, 0xb4, 0x0a, 0x2a, 0x57, 0x2d, 0x49, 0xfd, 0x33, 0xcd, 0xe5,
+    0x23, 0x4a, 0x1a, 0xc8, 0xa6, 0xe7, 0x0f, 0xa5, 0x1f, 0x34, 0x14, 0xb4, 0xfe, 0xe7, 0xf3, 0x78,
+    0xf2, 0x39, 0x31, 0xe0, 0xac, 0x31, 0x43, 0x7e, 0xfc, 0x92, 0x97, 0xbd, 0x50, 0x76, 0xc9, 0x5f,
+    0x58, 0xa1, 0x92, 0x14, 0x25, 0xed, 0x12, 0x4a, 0x7d, 0x69, 0x33, 0xf9, 0x23, 0x46, 0xd2, 0x86,
+    0x8a, 0x44, 0x11, 0x79, 0xaa, 0xdf, 0xfa, 0x63, 0xfe, 0xd7, 0x11, 0xbd, 0x61, 0xcf, 0x78, 0xa4,
+    0x31, 0x23, 0x2f, 0xcb, 0xb0, 0x61, 0x5c, 0x88, 0xf1, 0x62, 0x30, 0xe6, 0x7f, 0x01, 0xf6, 0xb4,
+    0xc2, 0xc9, 0x44, 0x68, 0xa8, 0x88, 0x50, 0x0e, 0xb4, 0xf8, 0xa7, 0x8d, 0x11, 0x67, 0x54, 0x98,
+    0xa8, 0xe4, 0x34, 0x72, 0xc9, 0xb1, 0x66, 0x34, 0x5a, 0xa4, 0xc9, 0xd3, 0x9d, 0x3a, 0xeb, 0x9f,
+    0xc7, 0x35, 0x72, 0xfd, 0x08, 0x0c, 0x4a, 0x6f, 0x7b, 0xb0, 0xfa, 0x0c, 0xd2, 0x14, 0xfc, 0x02,
+    0xfa, 0x67, 0x05, 0x4c, 0x7f, 0x80, 0xd1, 0xbf, 0x28, 0x3f, 0x25, 0x28, 0x6c, 0xe8, 0x5d, 0xa3,
+    0x5d, 0xdb, 0x95, 0x80, 0xdb, 0x5b, 0x9b, 0x9b, 0xdd, 0x26, 0xfd, 0x92, 0x2a, 0x20, 0x25, 0x85,
+    0x92, 0x3a, 0x02, 0x60, 0x74, 0x44, 0x53, 0x8d, 0xaa, 0x33, 0x55, 0x6a, 0x4f, 0xa5, 0x6c, 0xa9,
+    0x34, 0x2a, 0xca, 0x0e, 0x40, 0xd7, 0x34, 0x12, 0x53, 0xf7, 0x07, 0x07, 0xeb, 0x84, 0xe4, 0x82,
+    0xdc, 0x80, 0xd4, 0xa6, 0x66, 0x52, 0x31, 0x9b, 0xf6, 0xfa, 0x31, 0x8a, 0x0e, 0xd5, 0x53, 0x3a,
+    0x3a, 0xbf, 0xa0, 0xcd, 0x80, 0x9e, 0xfb, 0x88, 0xea, 0x97, 0x43, 0x03, 0x80, 0x86, 0xc6, 0x54,
+    0x1f, 0xd5, 0x5e, 0x4e, 0xd2, 0x25, 0x3b, 0xe9, 0xc7, 0x28, 0x3a, 0x54, 0x4f, 0xe9, 0xe8, 0xfc,
+    0xdf, 0x61, 0x88, 0x9e, 0x43, 0x43, 0x97, 0x42, 0xeb, 0x40, 0xe7, 0xb9, 0x8b, 0x93, 0x50, 0x94,
+    0x22, 0xa9, 0x9f, 0x32, 0x42, 0xd7, 0x54, 0x93, 0x75, 0x51, 0x9b, 0xc8, 0xfc, 0x4b, 0xb5, 0x90,
+    0xd4, 0x4f, 0x5d, 0x07, 0x1f, 0x7c, 0x23, 0x8a, 0x73, 0x38, 0xa1, 0xe9, 0x07, 0xbd, 0x98, 0x30,
+    0x2f, 0xdc, 0x03, 0xea, 0x7e, 0xe9, 0xa6, 0xbf, 0x8b, 0xc5, 0x6f, 0xd2, 0x42, 0x31, 0x18, 0x97,
+    0xb3, 0x7f, 0xbf, 0x71, 0x6f, 0x1c, 0xee, 0xd5, 0xde, 0x7c, 0xfa, 0xf7, 0x2b, 0xd6, 0xe3, 0xe4,
+    0xde, 0x7e, 0xfa, 0xe7, 0xff, 0xae, 0xa2, 0xf7, 0x8b, 0x45, 0x1c, 0x23, 0x10, 0x44, 0xdc, 0xbf,
+    0x84, 0x79, 0x83, 0x88, 0xf3, 0x4c, 0xf8, 0x43, 0x5c, 0xdc, 0x43, 0xe0, 0xf6, 0x2f, 0x1b, 0xc8,
+    0xd6, 0x20, 0xfb, 0xa7, 0x45, 0x12, 0x34, 0x62, 0xd0, 0x40, 0xc1, 0x9a, 0x84, 0x31, 0x62, 0xa1,
+    0x54, 0x7b, 0x4b, 0x03, 0x03, 0x20, 0x1d, 0x01, 0x48, 0xda, 0xd3, 0xdb, 0x4b, 0xa0, 0x87, 0x4d,
+    0x30, 0x94, 0x57, 0x34, 0x44, 0x64, 0x86, 0x07, 0x7a, 0x87, 0x67, 0xc1, 0xce, 0x40, 0xf9, 0x5a,
+    0xf7, 0x48, 0x27, 0xa4, 0x07, 0x48, 0x5a, 0x36, 0xfd, 0x20, 0x32, 0xb3, 0x4f, 0xa5, 0x3d, 0x3e,
+    0xbd, 0x2b, 0xdf, 0x5e, 0x82, 0x3c, 0x3d, 0x6c, 0x02, 0x2c, 0x82, 0xbc, 0x03, 0x78, 0x08, 0x36,
+    0xf1, 0x0c, 0xd4, 0xdd, 0x69, 0xd6, 0xc5, 0x29, 0x75, 0xc1, 0xbd, 0xa5, 0xc1, 0xb9, 0xb1, 0xbd,
+    0xb5, 0xb9, 0xb5, 0xad, 0xb1, 0xa9, 0xad, 0xa9, 0xa1, 0xa5, 0x9d, 0x75, 0x99, 0xfd, 0x6f, 0xab,
+    0x66, 0x7f, 0x64, 0x62, 0x65, 0x63, 0x64, 0x9b, 0x63, 0x61, 0x62, 0xd4, 0x08, 0x60, 0x61, 0x96,
+    0x60, 0x52, 0xaf, 0x2f, 0x05, 0x5c, 0x67, 0x5c, 0x5b, 0x5d, 0x79, 0x81, 0xad, 0x59, 0xb3, 0x00,
+    0x81, 0xaa, 0xd6, 0x00, 0x29, 0x27, 0x02, 0x7f, 0xd8, 0x2c, 0x2d, 0xac, 0xac, 0x2b, 0x2c, 0x29,
+    0xab, 0x2b, 0xab, 0xaa, 0x01, 0x54, 0x55, 0x53, 0x54, 0x97, 0x53, 0x51, 0x52, 0x50, 0x51, 0x4f,
+    0x50, 0x91, 0xd6, 0x27, 0x2b, 0xd7, 0xc9, 0x0f, 0x43, 0x93, 0x00, 0x3f, 0xf0, 0x1d, 0x53, 0x13,
+    0x27, 0x53, 0x4d, 0xb4, 0x14, 0x20, 0x2e, 0x40, 0x92, 0x52, 0x9d, 0xf4, 0x8f, 0x74, 0x04, 0xc0,
+    0x88, 0xe8, 0xdf, 0xe8, 0x8c, 0x5a, 0x44, 0xed, 0xec, 0xe4, 0x63, 0xdb, 0x43, 0x42, 0xff, 0x3f,
+    0xa4, 0x43, 0x28, 0x08, 0xc8, 0x4e, 0xd0, 0x54, 0x3a, 0xfd, 0xb1, 0x7f, 0x6a, 0x9b, 0x1c, 0x95,
+    0x53, 0xd7, 0x34, 0x9f, 0x07, 0xed, 0x53, 0xcf, 0xf9, 0x87, 0x82, 0xda, 0x09, 0xfd, 0xec, 0xf3,
+    0xf5, 0xb9, 0xa7, 0xa6, 0xf7, 0x78, 0xf2, 0xd1, 0xe3, 0x29, 0x47, 0x4f, 0x1e, 0x3b, 0x9c, 0x56,
+    0x73, 0x9e, 0xa1, 0x3b, 0x78, 0xa8, 0xee, 0xd4, 0x91, 0xc3, 0x48, 0xa7, 0xce, 0x1c, 0x3a, 0x73,
+    0xe2, 0x74, 0xc6, 0x81, 0xd3, 0xf9, 0x06, 0xce, 0xd6, 0x9b, 0xb9, 0xb9, 0xbf, 0x3f, 0x1c, 0x38,
+    0x96, 0x54, 0xf9, 0x82, 0xc6, 0xcd, 0xa2, 0x9b, 0x36, 0x68, 0xd8, 0x7c, 0xad, 0x49, 0xd3, 0xc5,
+    0x86, 0x73, 0x0d, 0xa7, 0x9a, 0x34, 0x6a, 0x36, 0xdb, 0x6c, 0x9e, 0x41, 0x73, 0xc3, 0xcc, 0x19,
+    0x33, 0x65, 0xbe, 0x90, 0xd1, 0xcc, 0x0c, 0x83, 0x46, 0x86, 0x06, 0xa3, 0x39, 0x26, 0x73, 0x8c,
+    0x98, 0x30, 0x62, 0xbc, 0x94, 0xf1, 0xd2, 0xe5, 0x0b, 0x23, 0x97, 0x2e, 0x5c, 0xb6, 0x54, 0xd1,
+    0x92, 0xe5, 0x0a, 0xe6, 0x98, 0x16, 0xe9, 0x9f, 0x65, 0xc1, 0x72, 0x05, 0x8b, 0x15, 0x4c, 0x2b,
+    0x54, 0xb6, 0x50, 0x99, 0x52, 0x85, 0x2c, 0x65, 0x8a, 0x94, 0x28, 0x4b, 0xa0, 0x58, 0x3a, 0xa9,
+    0xa4, 0xd4, 0x82, 0x32, 0xbd, 0xb4, 0x94, 0xbc, 0x7c, 0xe2, 0x84, 0xc7, 0x93, 0x26, 0x95, 0x8b,
+    0x4d, 0x98, 0x50, 0x4a, 0x99, 0xd8, 0x4a, 0xa2, 0x28, 0x49, 0xb2, 0x84, 0x08, 0x92, 0x1b, 0x43,
+    0x92, 0x4c, 0x4e, 0x1e, 0x41, 0x62, 0xa4, 0xc8, 0x91, 0x22, 0x44, 0x26, 0x89, 0x0c, 0x99, 0xd4,
+    0x85, 0x0c, 0x81, 0x14, 0x12, 0x44, 0x12, 0x48, 0x10, 0xce, 0x1f, 0x40, 0x7e, 0xf8, 0xe0, 0x81,
+    0x8d, 0xf4, 0x11, 0xd9, 0x23, 0xb2, 0xc7, 0x0e, 0x48, 0x1d, 0x39, 0x76, 0xe4, 0xb8, 0x81, 0xe3,
+    0x86, 0x0d, 0x1c, 0x35, 0x6c, 0x3c, 0x96, 0x46, 0x0d, 0xa9, 0x19, 0x34, 0x16, 0x67, 0x34, 0xb2,
+    0x60, 0x21, 0x23, 0x46, 0x92, 0x0c, 0xfb, 0x0c, 0x46, 0x8c, 0x17, 0x2d, 0x60, 0x18, 0xb9, 0x78,
+    0x11, 0xc1, 0x45, 0x8b, 0x15, 0x2c, 0x56, 0xa8, 0x60, 0x91, 0xe2, 0x84, 0x8a, 0x17, 0x28, 0x52,
+    0x48, 0xa2, 0x30, 0x41, 0xe2, 0xc4, 0x8d, 0x12, 0x26, 0x22, 0xb3, 0x25, 0xa8, 0x23, 0x48, 0x88,
+    0x18, 0x01, 0xe2, 0x83, 0x88, 0x10, 0x1c, 0x1a, 0x37, 0x2c, 0x6a, 0xc0, 0xb0, 0xe1, 0x82, 0x86,
+    0x0c, 0x18, 0x32, 0x58, 0xa0, 0x70, 0xa1, 0xc2, 0xa3, 0x85, 0x47, 0xc7, 0x09, 0x14, 0xca, 0x13,
+    0xca, 0x8c, 0x1c, 0x18, 0x25, 0x34, 0x46, 0x90, 0x00, 0x21, 0x02, 0x84, 0x7c, 0x51, 0x31, 0xbb,
+    0x55, 0xa4, 0xe2, 0x89, 0x0f, 0xc2, 0x89, 0x65, 0xf2, 0x83, 0xb1, 0x98, 0xfc, 0x28, 0xde, 0xc3,
+    0x0e, 0x76, 0x07, 0x60, 0xfc, 0xbb, 0xd5, 0x0b, 0xbf, 0x54, 0x44, 0xdd, 0x7b, 0x88, 0xf8, 0x68,
+    0x98, 0x1f, 0x3a, 0x1a, 0x76, 0x0b, 0x23, 0x10, 0x76, 0x09, 0xb9, 0x60, 0xae, 0x16, 0xbf, 0xb5,
+    0x33, 0x9e, 0xc1, 0x1b, 0x70, 0xb0, 0x01, 0x20, 0x83, 0x05, 0x0d, 0x14, 0x04, 0x2e, 0x08, 0xf4,
+    0xfb, 0xf3, 0xeb, 0xfb, 0xe3, 0xeb, 0xd3, 0xb1, 0xc7, 0xb7, 0xa7, 0x37, 0x97, 0xe0, 0x0b, 0x2b,
+    0x97, 0xe0, 0xec, 0x00, 0x36, 0x0f, 0x41, 0x35, 0x0f, 0xcf, 0xee, 0x40, 0x1b, 0xf6, 0xce, 0x00,
+    0xde, 0xbc, 0x69, 0xa0, 0xee, 0x6a, 0x97, 0x81, 0xee, 0x4a, 0x27, 0xa7, 0x27, 0x17, 0x37, 0xb7,
+    0x96, 0x49, 0x16, 0x67, 0x66, 0xf6, 0x6f, 0x68, 0x70, 0x6b, 0xf4, 0x7b, 0xba, 0xbd, 0xb5, 0xb1,
+    0xb9, 0x41, 0xb1, 0xa9, 0xad, 0xa9, 0xa5, 0xad, 0xa1, 0xa5, 0x91, 0xcf, 0xd0, 0x72, 0x6c, 0x9d,
+    0x95, 0x95, 0xfd, 0x9b, 0xe5, 0xc9, 0xc7, 0xc8, 0x74, 0x88, 0x85, 0x8d, 0xd1, 0xd5, 0x30, 0xb0,
+    0xaf, 0x4f, 0x30, 0xaf, 0x2d, 0xc6, 0x2e, 0xaf, 0x4b, 0x4e, 0xae, 0x2e, 0x2a, 0xae, 0x02, 0x54,
+    0x04, 0x0a, 0x04, 0x3f, 0xbf, 0x59, 0x65, 0x13, 0x4a, 0x23, 0x95, 0x4b, 0x94, 0x50, 0x46, 0x2e,
+    0x49, 0x82, 0x44, 0x89, 0x8b, 0x24, 0x35, 0x90, 0x0c, 0x89, 0x14, 0x02, 0x64, 0x48, 0x10, 0x21,
+    0x79, 0x90, 0x1f, 0x92, 0x40, 0x7c, 0x48, 0xea, 0x71, 0x3e, 0x7a, 0xd4, 0xe0, 0xb1, 0xa3, 0x07,
+    0x08, 0x1e, 0x3a, 0x72, 0xec, 0x80, 0xc4, 0x91, 0xa3, 0x4c, 0x02, 0xf2, 0x86, 0x0d, 0x1c, 0x8f,
+    0x29, 0x6c, 0xd0, 0x70, 0xd1, 0x22, 0x85, 0xce, 0xa2, 0xc5, 0x0a, 0x16, 0x2a, 0xfe, 0x49, 0x30,
+    0x9e, 0x40, 0x71, 0x69, 0xa2, 0xc4, 0x89, 0xca, 0x12, 0x23, 0x40, 0x88, 0x18, 0x01, 0x17, 0x22,
+    0xb2, 0x86, 0x8b, 0x14, 0x24, 0x40, 0xcc, 0xc5, 0xb9, 0xc1, 0xbd, 0xc9, 0x75, 0xe0, 0xb0, 0xa1,
+    0x83, 0x06, 0x0c, 0x1b, 0x16, 0x33, 0x68, 0xd8, 0x33, 0x5c, 0xa8, 0x80, 0x61, 0xb7, 0x70, 0x41,
+    0xd1, 0x42, 0x63, 0x85, 0xc7, 0x46, 0x0a, 0x13, 0x1e, 0x1d, 0x29, 0xe8, 0x8e, 0xe5, 0x09, 0x7a,
+    0x99, 0x51, 0x51, 0x02, 0x04, 0xc6, 0x08, 0x12, 0x0c, 0x23, 0x2c, 0x42, 0x30, 0x5c, 0x4c, 0xdc,
+    0x1f, 0x8c, 0x13, 0x9f, 0x90, 0x1f, 0x54, 0x92, 0xc5, 0xe1, 0xb1, 0x13, 0xc2, 0xb0, 0x03, 0xfd,
+    0x6b, 0x75, 0x00, 0xfe, 0x82, 0x11, 0x0d, 0x0f, 0x9b, 0x10, 0xbd, 0x87, 0xde, 0x9c, 0xb0, 0x9b,
+    0x17, 0x76, 0xd5, 0x0a, 0x1b, 0x15, 0xf7, 0xaf, 0x7e, 0x68, 0xd8, 0x25, 0x64, 0x53, 0x9b, 0xae,
+    0x6d, 0xb5, 0xf7, 0x60, 0x76, 0xab, 0x15, 0xbc, 0xf5, 0x06, 0xe9, 0xb2, 0x0d, 0xfa, 0x04, 0x19,
+    0x34, 0x58, 0xa0, 0x80, 0xc1, 0x82, 0x40, 0x40, 0x05, 0x81, 0x7e, 0x80, 0x7f, 0x7e, 0x7f, 0x7b,
+    0xd6, 0x3e, 0xbe, 0x3d, 0xbe, 0x04, 0x76, 0x7a, 0xd8, 0x04, 0x79, 0x08, 0xb0, 0x79, 0x07, 0xf0,
+    0x10, 0x1c, 0x30, 0x80, 0x77, 0x67, 0xe0, 0xee, 0xda, 0x64, 0x57, 0x77, 0xad, 0x9b, 0x5b, 0xa3,
+    0x73, 0x94, 0x9b, 0x8b, 0x83, 0x93, 0x3b, 0x8b, 0x7b, 0x73, 0x83, 0x33, 0x7b, 0x63, 0x73, 0x6b,
+    0x63, 0x6b, 0x4b, 0x5b, 0x53, 0x4b, 0x2b, 0x53, 0xd3, 0xde, 0x83, 0x59, 0xbf, 0x3d, 0x03, 0x57,
+    0xb6, 0xb4, 0xb4, 0x33, 0xb3, 0x32, 0x34, 0xb3, 0x32, 0xb2, 0x31, 0x31, 0xb3, 0xb2, 0x30, 0x32,
+    0xab, 0x31, 0x26, 0x31, 0xb0, 0xac, 0xb0, 0x2f, 0x30, 0xaf, 0xae, 0x2f, 0x2f, 0xae, 0xad, 0x2e,
+    0xae, 0x02, 0x5b, 0x5a, 0x05, 0x08, 0x68, 0x11, 0xb8, 0xb2, 0x66, 0x61, 0x5d, 0x61, 0x0d, 0x70,
+    0xb2, 0xaa, 0x1a, 0x40, 0x35, 0x55, 0x45, 0x25, 0x15, 0x35, 0x25, 0x05, 0x15, 0x65, 0x85, 0x7a,
+    0xb2, 0x3e, 0x35, 0x35, 0x39, 0x09, 0x68, 0x12, 0xb0, 0x44, 0x65, 0x92, 0xac, 0x2e, 0x55, 0x2a,
+    0x05, 0xa8, 0x96, 0xc5, 0x94, 0x92, 0x90, 0x02, 0x84, 0x25, 0x01, 0xb8, 0x22, 0x39, 0x1a, 0x01,
+    0x38, 0x32, 0x3a, 0xaa, 0x52, 0xff, 0x89, 0xc0, 0x8a, 0xca, 0xc8, 0xc6, 0xc4, 0xb4, 0xae, 0xac,
+    0x4d, 0x46, 0x44, 0x64, 0x62, 0x61, 0x60, 0x5f, 0x63, 0x4f, 0xff, 0xfc, 0x73, 0xd0, 0x1d, 0xd0,
+    0x54, 0x8f, 0xd4, 0x8d, 0xdd, 0x26, 0xfa, 0xf3, 0x1f, 0xa5, 0x3f, 0xeb, 0x99, 0x9e, 0x67, 0x50,
+    0xeb, 0x87, 0x82, 0x86, 0xf6, 0xf9, 0xec, 0xe3, 0x69, 0xe5, 0xb3, 0xc7, 0x73, 0x4f, 0x1e, 0x3d,
+    0x78, 0xf2, 0xdc, 0xc1, 0x63, 0xe7, 0x8e, 0x9d, 0x39, 0x75, 0xe8, 0xcc, 0xa1, 0xd3, 0x29, 0xa7,
+    0xf3, 0x4d, 0x53, 0x1c, 0x38, 0x6f, 0xe0, 0xb4, 0x71, 0xc3, 0xc9, 0x46, 0xcd, 0x9a, 0x34, 0x6a,
+    0xc0, 0xa4, 0x39, 0x83, 0x66, 0xf3, 0x0c, 0xd7, 0x66, 0x19, 0x33, 0x5b, 0xca, 0x8c, 0xa9, 0x92,
+    0xd1, 0x1c, 0xb3, 0xa5, 0x99, 0x09, 0x46, 0x4c, 0x98, 0x4c, 0xc7, 0x2d, 0x62, 0xbe, 0x6c, 0xd1,
+    0xbf, 0x74, 0xf1, 0x72, 0xe9, 0xd8, 0x65, 0x8b, 0x8b, 0xbd, 0x06, 0x34, 0x95, 0xce, 0x36, 0xa8,
+    0xe7, 0x9c, 0x37, 0x67, 0xc6, 0x80, 0xd9, 0xe2, 0xc5, 0xb5, 0x55, 0xa0, 0x0b, 0xcb, 0x15, 0xcc,
+    0x2a, 0x55, 0x58, 0xa6, 0x77, 0x57, 0xa8, 0x58, 0x59, 0x82, 0xf9, 0xa3, 0x8a, 0x24, 0x15, 0x29,
+    0x53, 0xa2, 0x48, 0x81, 0x12, 0x05, 0xca, 0x13, 0xeb, 0xa5, 0xe5, 0x13, 0xcb, 0x26, 0x4e, 0x9a,
+    0x50, 0x5a, 0x2b, 0x99, 0x50, 0x32, 0x51, 0xb2, 0x24, 0x89, 0x12, 0x24, 0x49, 0x8e, 0x20, 0x39,
+    0x32, 0x69, 0xa4, 0xc8, 0x64, 0x91, 0x21, 0x44, 0x86, 0x00, 0x69, 0x12, 0x12, 0x04, 0x48, 0x10,
+    0xc9, 0x1f, 0x91, 0x3e, 0x78, 0xf4, 0xd8, 0xc1, 0x23, 0x6b, 0x07, 0xa4, 0x8e, 0x1c, 0x90, 0x57,
+    0x39, 0x6e, 0xe0, 0xc0, 0xba, 0x41, 0xa3, 0x6a, 0xa3, 0x06, 0x0d, 0xab, 0x1a, 0xf6, 0xda, 0x15,
+    0x2b, 0x98, 0x55, 0x9e, 0x50, 0x4e, 0x02, 0x81, 0xa4, 0x41, 0x20, 0x0b, 0xeb, 0xca, 0x4a, 0x2b,
+    0x06, 0x8c, 0x18, 0x8e, 0x30, 0xa8, 0x5e, 0xb4, 0x70, 0xb1, 0xd8, 0x62, 0x05, 0x8b, 0xa9, 0x15,
+    0x29, 0x54, 0xec, 0x29, 0xae, 0x28, 0xa4, 0x4e, 0x5c, 0xdf, 0x44, 0x54, 0x89, 0x01, 0x54, 0x53,
+    0x52, 0x51, 0x50, 0x55, 0x22, 0x42, 0x88, 0x58, 0x0c, 0xe1, 0x04, 0xe2, 0xc9, 0xc9, 0xda, 0x81,
+    0x43, 0x87, 0x9d, 0x43, 0xe5, 0x06, 0x01, 0x4c, 0x4d, 0x18, 0xae, 0x18, 0x2e, 0x2f, 0x2c, 0x29,
+    0x55, 0x1f, 0x29, 0x3c, 0x3a, 0x52, 0x90, 0x40, 0x34, 0xa1, 0x2c, 0xa1, 0xb1, 0xcc, 0xd8, 0x08,
+    0x41, 0x1c, 0x61, 0x11, 0xc2, 0x58, 0x31, 0x71, 0xfc, 0x20, 0x91, 0xfc, 0x20, 0xec, 0x15, 0x3f,
+    0xd9, 0xc3, 0x4e, 0x10, 0x1d, 0x80, 0x11, 0xbf, 0x60, 0xfd, 0x5b, 0x18, 0xe4, 0xb5, 0xcf, 0x0a,
+    0x0d, 0x0f, 0x73, 0x43, 0x2d, 0x61, 0x37, 0x8a, 0x83, 0xa8, 0x04, 0xc2, 0xba, 0x4b, 0x43, 0x33,
+    0x00, 0x00, 0x00, 0x34, 0x00, 0x13, 0x7a, 0x09, 0xc4, 0xc3, 0x30, 0x75, 0xf2, 0x0a, 0x64, 0x2d,
+    0x61, 0x82, 0x60, 0xcc, 0x60, 0x30, 0x88, 0x05, 0x86, 0x81, 0x23, 0xb1, 0x10, 0x47, 0xbe, 0xc3,
+    0xf7, 0x21, 0xad, 0xb4, 0xf5, 0x60, 0xde, 0x47, 0xce, 0x74, 0x67, 0xe2, 0x03, 0xb0, 0xfd, 0x92,
+    0x09, 0xf0, 0xf5, 0x8a, 0xfe, 0xf7, 0xf5, 0x6f, 0xf8, 0x8a, 0xea, 0x1a, 0x4d, 0x23, 0x13, 0xda,
+    0x87, 0xd2, 0x13, 0xfb, 0x66, 0x98, 0xe3, 0x49, 0x3d, 0x06, 0x04, 0x7d, 0xb1, 0x18, 0x62, 0x4f,
+    0x14, 0x24, 0x8e, 0x97, 0x98, 0x81, 0x38, 0xda, 0xac, 0x7c, 0x66, 0xa5, 0xb3, 0x3a, 0xe9, 0x01,
+    0xb0, 0xeb, 0xd6, 0x73, 0xa4, 0x2e, 0xc7, 0x00, 0xdc, 0xa9, 0xde, 0xfc, 0x41, 0x02, 0x47, 0xe1,
+    0xc9, 0xe5, 0x94, 0x02, 0xdb, 0x6f, 0x18, 0xbe, 0xd4, 0xbb, 0x37, 0x9f, 0x1c, 0x20, 0xe7, 0x2f,
+    0x0a, 0x37, 0x77, 0x84, 0x5b, 0x7f, 0x3d, 0x3f, 0x56, 0x62, 0xc9, 0x09, 0x8c, 0xbf, 0x63, 0x71,
+    0x9f, 0x80, 0x45, 0x76, 0x69, 0x89, 0xc0, 0x18, 0x5f, 0xfd, 0x33, 0xf5, 0x08, 0x34, 0x51, 0xf3,
+    0x70, 0xe0, 0xeb, 0x14, 0x6c, 0xae, 0x73, 0x19, 0x88, 0x17, 0x38, 0xf0, 0x3a, 0x54, 0x39, 0x3e,
+    0xda, 0xc5, 0x25, 0xea, 0x6d, 0x65, 0xd1, 0x1a, 0x45, 0x82, 0xdb, 0x49, 0x97, 0x4a, 0x08, 0x63,
+    0x9a, 0x66, 0x83, 0x62, 0xda, 0x4c, 0xd2, 0x28, 0xe9, 0xe1, 0x11, 0x9f, 0xe3, 0x20, 0x7b, 0xf0,
+    0xd8, 0x51, 0xa6, 0x5e, 0x16, 0x01, 0x85, 0x09, 0xa0, 0x3c, 0x06, 0x88, 0x3a, 0x54, 0xa5, 0x71,
+    0xae, 0x17, 0x29, 0xee, 0x4b, 0x7d, 0x1c, 0x92, 0x98, 0x7d, 0xfc, 0xdc, 0x06, 0x89, 0xae, 0x46,
+    0xe8, 0xa2, 0x0c, 0xb8, 0x48, 0x75, 0x18, 0x67, 0xc0, 0xe7, 0x4f, 0xd6, 0x0c, 0xb7, 0xd9, 0x13,
+    0xa2, 0xb5, 0xb6, 0x67, 0x07, 0x27, 0x27, 0xe9, 0x4d, 0x98, 0x7b, 0x48, 0xf3, 0x2c, 0x47, 0x38,
+    0xe3, 0x86, 0x3b, 0x0e, 0x5a, 0x9f, 0xbf, 0x14, 0x6e, 0x56, 0x6e, 0xe7, 0xc8, 0x7c, 0x06, 0x19,
+    0xd1, 0x23, 0x39, 0x3f, 0x78, 0x26, 0x71, 0xff, 0x41, 0x85, 0x9f, 0x43, 0xfc, 0xdf, 0xb7, 0xc1,
+    0x87, 0x60, 0x97, 0xa1, 0x5f, 0x87, 0xfe, 0x87, 0x5c, 0x23, 0x07, 0x1e, 0xe1, 0x0d, 0x5f, 0x1f,
+    0xa0, 0x6d, 0x78, 0x96, 0x3b, 0x76, 0x9f, 0x87, 0xd7, 0x6f, 0x18, 0xdc, 0x3f, 0x9c, 0x52, 0x8d,
+    0xc5, 0x9a, 0xf6, 0xee, 0xf2, 0x66, 0x7c, 0xdd, 0x1f, 0x2c, 0xe3, 0x79, 0x87, 0xe1, 0x0b, 0xa1,
+    0x5d, 0x0c, 0x19, 0xe1, 0xa5, 0x12, 0x94, 0x70, 0xe6, 0x8f, 0x07, 0x9f, 0xa5, 0xe8, 0x0e, 0x4f,
+    0xf0, 0xfe, 0xed, 0xc5, 0x9f, 0x5a, 0xec, 0x97, 0xc6, 0xa7, 0xb5, 0x40, 0x80, 0x74, 0x0d, 0x5b,
+    0xdf, 0x9a, 0xcc, 0x91, 0xb6, 0x6e, 0xfb, 0xf7, 0xce, 0x57, 0x9a, 0x4f, 0xa5, 0x9f, 0x7b, 0x70,
+    0x77, 0xf1, 0xeb, 0xe2, 0x70, 0x13, 0x9b, 0x4c, 0x81, 0xf3, 0x03, 0xf9, 0x9d, 0x6d, 0x2a, 0xb9,
+    0x3f, 0xfb, 0xb0, 0x7d, 0x59, 0x3d, 0x55, 0xa3, 0x3c, 0x8f, 0x3e, 0xe0, 0xed, 0x82, 0x63, 0x2a,
+    0x54, 0x68, 0x52, 0xad, 0xcf, 0x69, 0xd3, 0xa4, 0x1f, 0xfe, 0x30, 0x78, 0x87, 0xa6, 0x3f, 0x46,
+    0x5c, 0x95, 0x22, 0x84, 0x15, 0x0a, 0x04, 0xd9, 0x99, 0x1f, 0x6f, 0x1f, 0xaf, 0xf6, 0x7b, 0x3a,
+    0xe3, 0xbb, 0x9a, 0x78, 0x29, 0xcb, 0xa5, 0xf1, 0xca, 0xe1, 0x6c, 0x17, 0xfc, 0xaf, 0x82, 0xe6,
+    0x33, 0xba, 0xf3, 0x09, 0x02, 0xc0, 0x79, 0x14, 0x94, 0x03, 0xe2, 0xa5, 0xc8, 0x8f, 0x3e, 0xcf,
+    0x40, 0xca, 0x3f, 0x0b, 0xfd, 0x08, 0xf8, 0x24, 0xdb, 0x59, 0x60, 0x0b, 0x00, 0x0d, 0x77, 0xde,
+    0xbe, 0x0a, 0x63, 0x00, 0x34, 0xfc, 0x2d, 0xc0, 0x99, 0x35, 0xf2, 0x35, 0xf9, 0x1f, 0x5d, 0xdf,
+    0xce, 0x86, 0x4f, 0x48, 0x95, 0x5f, 0x8f, 0xaf, 0x04, 0x74, 0xa8, 0xdc, 0x9b, 0xc3, 0x17, 0xe9,
+    0x13, 0x16, 0x24, 0x5c, 0x5d, 0xdb, 0xf6, 0x7e, 0x98, 0xc5, 0x62, 0xf8, 0x4d, 0xea, 0xba, 0x65,
+    0xcd, 0x7f, 0x3f, 0xb8, 0xc7, 0xc2, 0x7e, 0xbc, 0xbb, 0x12, 0xe7, 0x5f, 0xf9, 0x2a, 0x0f, 0xef,
+    0x0b, 0xde, 0x32, 0x85, 0x14, 0x7a, 0xcc, 0x26, 0xc8, 0xc8, 0xd3, 0x7b, 0xc9, 0xbf, 0x93, 0x28,
+    0x4f, 0xa9, 0x53, 0xb5, 0xc1, 0xf2, 0xb5, 0x03, 0x80, 0xe1, 0x69, 0x67, 0x3d, 0x25, 0x98, 0x49,
+    0x12, 0xb8, 0x13, 0xad, 0x9a, 0x7d, 0xfe, 0xaf, 0x13, 0xed, 0xa9, 0xfc, 0x38, 0xac, 0xcd, 0xbc,
+    0x5f, 0x00, 0xd2, 0x5e, 0xb0, 0xe5, 0x1a, 0x06, 0xfc, 0x5f, 0x63, 0x1e, 0x60, 0x2a, 0xc4, 0xd9,
+    0x2c, 0x7b, 0xdb, 0x6c, 0x38, 0xff, 0xef, 0x76, 0x31, 0x46, 0x8a, 0x8b, 0x96, 0x39, 0xf9, 0x56,
+    0xff, 0x39, 0x77, 0x87, 0xab, 0x32, 0xed, 0x02, 0xfd, 0x86, 0xc1, 0xcc, 0x4d, 0xb1, 0x1b, 0x56,
+    0x3a, 0x28, 0x46, 0xbf, 0xf7, 0x63, 0xe3, 0xad, 0xf6, 0x49, 0x49, 0x6e, 0x78, 0x8e, 0x72, 0xab,
+    0x3f, 0x43, 0x9b, 0x6b, 0xe0, 0x05, 0x91, 0x13, 0x87, 0x95, 0x41, 0xf8, 0x08, 0x3b, 0xd8, 0x1e,
+    0x4e, 0x72, 0x7d, 0x81, 0xa8, 0x71, 0xda, 0x06, 0x5d, 0x8c, 0xee, 0xa3, 0xfa, 0x5c, 0x4e, 0x5d,
+    0xe4, 0x3e, 0x5a, 0x3b, 0xf8, 0x54, 0xd7, 0x19, 0x17, 0x7c, 0x60, 0xe2, 0xc3, 0x10, 0xf3, 0x07,
+    0xd0, 0xc3, 0x27, 0x75, 0x26, 0xe1, 0x79, 0x74, 0x86, 0x3f, 0x29, 0xca, 0x61, 0xb1, 0xd0, 0xfb,
+    0xd7, 0xb4, 0xf9, 0x6f, 0xf5, 0x5e, 0x1b, 0xd5, 0xd5, 0x66, 0x4f, 0x87, 0x79, 0x4f, 0x11, 0x56,
+    0x11, 0x78, 0x7c, 0xc3, 0xcd, 0x86, 0xcc, 0x34, 0xee, 0xde, 0x59, 0xad, 0xec, 0x17, 0x53, 0x10,
+    0x3f, 0x90, 0xaa, 0x0e, 0xf3, 0xc5, 0x47, 0x64, 0x9f, 0xac, 0xf4, 0x06, 0xe8, 0xca, 0xe7, 0x70,
+    0x0e, 0x82, 0x74, 0x05, 0xf8, 0x11, 0x62, 0x47, 0x73, 0xc1, 0x07, 0x17, 0xfe, 0x8c, 0x86, 0x01,
+    0xad, 0xbf, 0x7f, 0xf5, 0x66, 0xa3, 0x5b, 0xbe, 0x8f, 0x56, 0x62, 0x94, 0xb8, 0xc4, 0x3d, 0x9e,
+    0xda, 0x9d, 0xc0, 0xe2, 0x78, 0x61, 0xe6, 0x87, 0xda, 0x98, 0x6e, 0x7d, 0x1e, 0x2d, 0x8a, 0x62,
+    0xff, 0xf5, 0xd1, 0x30, 0xec, 0x4b, 0x56, 0x03, 0xfa, 0x68, 0xef, 0x86, 0xb6, 0xd7, 0x23, 0x0d,
+    0x10, 0xbb, 0xa2, 0xce, 0x40, 0x03, 0x14, 0xfb, 0xa2, 0x08, 0x3f, 0x52, 0xa6, 0x4c, 0x7e, 0x54,
+    0x7d, 0xeb, 0xfb, 0x3d, 0x4a, 0x5e, 0xdf, 0xa7, 0x7a, 0x93, 0xa8, 0xc7, 0xf5, 0xf9, 0x4e, 0x78,
+    0xf3, 0x53, 0x3f, 0x2d, 0x4d, 0x7e, 0x64, 0xf4, 0xf3, 0x6a, 0x34, 0xc0, 0x6b, 0x0c, 0xc9, 0x3f,
+    0x50, 0xb9, 0xc5, 0xa3, 0xf1, 0xe3, 0xca, 0xe6, 0x8c, 0x11, 0x6e, 0x1f, 0x65, 0x91, 0x56, 0x62,
+    0xdf, 0xde, 0xcc, 0xfa, 0x80, 0x88, 0x5b, 0x95, 0xcd, 0x70, 0xe4, 0x1f, 0x86, 0xd9, 0x93, 0x33,
+    0x34, 0x5a, 0x7b, 0xab, 0xf8, 0xc3, 0xcb, 0xf7, 0xbf, 0x31, 0xdc, 0xe5, 0x0e, 0x48, 0x68, 0x11,
+    0x55, 0xba, 0xf1, 0x7b, 0x77, 0x9e, 0x7d, 0x21, 0x33, 0xf4, 0x06, 0x5e, 0x65, 0x70, 0xcb, 0x88,
+    0xd9, 0x75, 0x74, 0x49, 0x93, 0x11, 0x88, 0x8c, 0xc7, 0xd1, 0xcd, 0xca, 0x0c, 0x85, 0xd4, 0x57,
+    0xe5, 0x79, 0x58, 0xc0, 0x9b, 0x88, 0x37, 0x9e, 0x8b, 0x93, 0xc1, 0xc1, 0x24, 0x76, 0x07, 0x20,
+    0x7d, 0x19, 0x00, 0x4f, 0xe7, 0x93, 0xe3, 0xe1, 0x5f, 0xc8, 0x7e, 0x6f, 0x77, 0x47, 0xc8, 0x1c,
+    0xd6, 0x97, 0x3b, 0xe3, 0x47, 0xc3, 0xf2, 0x4a, 0x46, 0x7e, 0x95, 0x1b, 0x36, 0x7c, 0xc2, 0xe4,
+    0xa3, 0x46, 0x3a, 0x3d, 0xc1, 0x31, 0x7b, 0x56, 0xdc, 0xcd, 0x1a, 0xc4, 0xda, 0xda, 0xa7, 0x2d,
+    0x5a, 0x53, 0x79, 0xda, 0xa2, 0xea, 0xb8, 0xc9, 0x0a, 0x7d, 0xff, 0xf0, 0xe5, 0xe2, 0x36, 0xf9,
+    0xc4, 0xf9, 0x6a, 0xcb, 0xbd, 0x7d, 0x4a, 0x3d, 0xb1, 0x52, 0xdf, 0x1c, 0xfe, 0x65, 0x39, 0xf1,
+    0x9c, 0xb0, 0x5e, 0x10, 0x5c, 0x9d, 0x62, 0xdf, 0x68, 0xf7, 0x13, 0xcb, 0x4b, 0xcf, 0xfa, 0x64,
+    0x7a, 0x02, 0xf8, 0x9d, 0xe7, 0xac, 0x3e, 0x2d, 0x43, 0x8b, 0x03, 0x7a, 0x1f, 0xd9, 0xea, 0x4c,
+    0x43, 0x5e, 0x2f, 0xcc, 0xd6, 0xcb, 0x3c, 0xe9, 0x4d, 0x78, 0xe3, 0x41, 0xf8, 0x06, 0xf7, 0x8f,
+    0x27, 0x3f, 0xdc, 0x3e, 0x41, 0x13, 0x52, 0x7e, 0xf8, 0xe5, 0x56, 0x79, 0xf7, 0x2b, 0x7b, 0xf6,
+    0xf6, 0x8f, 0x83, 0xd1, 0xca, 0x1e, 0xfc, 0xef, 0x0c, 0x03, 0x35, 0x4b, 0x64, 0x47, 0x98, 0xf3,
+    0x95, 0x57, 0xde, 0xdd, 0x34, 0x7b, 0x79, 0x6e, 0x3f, 0x4d, 0xf3, 0xd5, 0x30, 0x33, 0xf3, 0x5f,
+    0xaf, 0x93, 0xf8, 0x8b, 0x67, 0xca, 0xd7, 0x5d, 0xb7, 0x19, 0x6c, 0xb9, 0x0d, 0x7a, 0x72, 0x68,
+    0x6c, 0xbd, 0xd5, 0xb3, 0x4c, 0xfc, 0xfb, 0x62, 0x1c, 0xb8, 0xc4, 0xf5, 0x29, 0x5c, 0xe8, 0xe7,
+    0x70, 0x75, 0x7c, 0xfb, 0x26, 0x74, 0x57, 0x70, 0xc9, 0x0f, 0xba, 0x6f, 0x1e, 0xff, 0xe5, 0x3a,
+    0xb2, 0xbf, 0x74, 0x58, 0xdd, 0x1e, 0xa7, 0xd6, 0x67, 0x3c, 0x0d, 0x47, 0xe7, 0xb9, 0x19, 0x71,
+    0xa2, 0x22, 0xff, 0x60, 0xb3, 0xcf, 0xc3, 0x41, 0xb0, 0xa7, 0x12, 0x1d, 0x7e, 0xac, 0xfa, 0xb8,
+    0xc5, 0x80, 0xc0, 0x3c, 0x4c, 0x1f, 0x55, 0xc5, 0xf9, 0x47, 0x4f, 0xc9, 0x36, 0x66, 0xda, 0xcf,
+    0x6b, 0xe6, 0xb7, 0xf2, 0xf1, 0x93, 0xfa, 0x12, 0x8b, 0x3a, 0x0f, 0xd7, 0x40, 0x2c, 0xb1, 0x66,
+    0xc7, 0xa3, 0x7d, 0xe5, 0x1c, 0x13, 0x1b, 0xc3, 0x91, 0x0d, 0x25, 0x39, 0x4b, 0x9b, 0xd9, 0x51,
+    0x98, 0xe6, 0xea, 0x0b, 0x73, 0xa8, 0x2f, 0x6c, 0xfa, 0xbc, 0x3a, 0xd7, 0x3d, 0x98, 0x0b, 0x1d,
+    0x3c, 0xb3, 0x7f, 0x91, 0x83, 0x76, 0xf5, 0xfd, 0x99, 0xc2, 0xc2, 0xd6, 0x45, 0x63, 0xf2, 0x63,
+    0xf3, 0xde, 0xe2, 0x79, 0xd8, 0xf8, 0x7f, 0xd5, 0x13, 0x92, 0x7b, 0xa6, 0xbe, 0x3c, 0xe3, 0x1d,
+    0x7f, 0x45, 0xd4, 0x71, 0x7e, 0xce, 0x9a, 0x2f, 0x9d, 0xff, 0xb5, 0x39, 0x3c, 0x25, 0x12, 0xc1,
+    0xd0, 0xb1, 0x6e, 0xbb, 0x66, 0xbb, 0xd1, 0xc2, 0x23, 0x56, 0x87, 0xd3, 0xd7, 0x27, 0xbe, 0xee,
+    0xdf, 0x6d, 0x0d, 0xd4, 0x9d, 0xbe, 0x42, 0x02, 0x98, 0x84, 0xce, 0x57, 0xe4, 0xdc, 0x94, 0x47,
+    0x6c, 0x5d, 0x72, 0x41, 0x9c, 0xc7, 0x90, 0xa2, 0x59, 0xf4, 0xf8, 0xf4, 0x43, 0x63, 0x33, 0x46,
+    0x01, 0x9d, 0xfe, 0xe7, 0x2f, 0xc5, 0xe8, 0x78, 0xbc, 0x6f, 0xb3, 0xae, 0x36, 0x4d, 0x21, 0xe5,
+    0xca, 0x80, 0x5b, 0xbc, 0x3f, 0x66, 0x91, 0x5f, 0x51, 0x97, 0x1c, 0xf1, 0xbe, 0x93, 0xe6, 0xd0,
+    0xc8, 0x76, 0xbb, 0x91, 0xe6, 0x25, 0xe0, 0xae, 0x1d, 0x09, 0x64, 0x6c, 0x47, 0x2f, 0x7a, 0xf5,
+    0xee, 0x2a, 0xa3, 0xf1, 0x9e, 0xd8, 0x0d, 0x85, 0x1b, 0x0f, 0x6d, 0xb0, 0xff, 0x38, 0x37, 0x98,
+    0xb7, 0x45, 0x7e, 0xb8, 0x50, 0xd8, 0x80, 0xf7, 0xfa, 0x33, 0x02, 0x2f, 0xe5, 0xcf, 0xd4, 0xef,
+    0x01, 0x80, 0xfb, 0xf6, 0xd8, 0xee, 0xdc, 0x94, 0x02, 0x1d, 0xb2, 0x71, 0xc2, 0x8a, 0x8e, 0xc9,
+    0xfe, 0x8f, 0x7b, 0x18, 0x8a, 0xa4, 0x3c, 0x05, 0xbd, 0x45, 0x3a, 0xe1, 0x26, 0x3e, 0x7f, 0xf4,
+    0xb1, 0x52, 0xad, 0xf8, 0xdc, 0x66, 0x77, 0x1b, 0x70, 0xed, 0x68, 0xde, 0x4d, 0x99, 0x84, 0xfd,
+    0x10, 0x78, 0xcb, 0xfe, 0x01, 0xd3, 0x92, 0x81, 0x53, 0x1d, 0x75, 0xf4, 0x69, 0x93, 0x28, 0x35,
+    0xcb, 0x4b, 0x44, 0x74, 0xb1, 0xaf, 0x61, 0x64, 0xda, 0xe8, 0xb5, 0xbd, 0x97, 0x79, 0x7b, 0x66,
+    0xcb, 0x1f, 0xc9, 0x66, 0x6e, 0x6f, 0x76, 0x4c, 0x04, 0xe3, 0x95, 0x23, 0xac, 0xf3, 0x8b, 0x6c,
+    0x17, 0xe5, 0x87, 0xb4, 0x9d, 0x72, 0x1b, 0xa6, 0xe6, 0x18, 0xbc, 0x02, 0xdc, 0x88, 0x97, 0x84,
+    0x37, 0x44, 0x81, 0x46, 0x11, 0xc8, 0xdb, 0x33, 0xe6, 0xda, 0x7b, 0x26, 0xef, 0x99, 0x3b, 0x72,
+    0x5a, 0xe1, 0xbd, 0xa6, 0x32, 0x3d, 0x4e, 0x75, 0x49, 0x2d, 0xcc, 0x67, 0xec, 0x88, 0x9e, 0x08,
+    0x27, 0x16, 0x0f, 0x98, 0xff, 0xe5, 0xc8, 0x24, 0xf8, 0xf6, 0x9b, 0xa2, 0x7e, 0xb5, 0x19, 0x2c,
+    0x2c, 0x8c, 0x07, 0xe0, 0x08, 0xde, 0xe7, 0xab, 0x27, 0x67, 0x60, 0xc7, 0xb3, 0x1b, 0x2f, 0x3d,
+    0xad, 0xbb, 0x6e, 0x3e, 0x1a, 0x9b, 0x79, 0xdf, 0x66, 0xa3, 0x57, 0x14, 0x0d, 0x96, 0xd7, 0x60,
+    0x79, 0x2b, 0x3c, 0x06, 0xed, 0x86, 0x79, 0x52, 0xb0, 0xbb, 0x82, 0xa6, 0x91, 0xe6, 0xa8, 0xfc,
+    0x2a, 0x60, 0xe0, 0xa4, 0x7c, 0x68, 0x04, 0xca, 0x52, 0x67, 0x18, 0xad, 0xeb, 0x6f, 0xf8, 0x09,
+    0x49, 0x33, 0x08, 0x6d, 0xf2, 0x8c, 0x36, 0x4e, 0xf7, 0x7d, 0xb1, 0xc6, 0x7d, 0x63, 0x0a, 0x4f,
+    0x7a, 0x72, 0x08, 0x31, 0x90, 0xa0, 0x39, 0xa5, 0x43, 0x76, 0x0a, 0x7e, 0x37, 0xd9, 0x27, 0x53,
+    0x66, 0xc7, 0x5e, 0x09, 0x3d, 0x5f, 0xce, 0xfb, 0xbb, 0xc8, 0xc8, 0x26, 0x03, 0xc5, 0xb0, 0x75,
+    0x71, 0xd3, 0x79, 0xba, 0x41, 0x1f, 0x2e, 0x99, 0x39, 0xc2, 0xba, 0xa7, 0xf1, 0x59, 0x25, 0xcb,
+    0x0c, 0x53, 0xf2, 0x4b, 0x4f, 0xfe, 0x3f, 0xee, 0x1a, 0xec, 0x17, 0x1e, 0x69, 0x71, 0x42, 0xd6,
+    0x37, 0xf8, 0x8b, 0xc6, 0x0f, 0x13, 0x6a, 0x01, 0x66, 0x22, 0xf7, 0x44, 0x88, 0x19, 0xcd, 0xbe,
+    0x2f, 0xec, 0xfc, 0xdc, 0xb8, 0xa6, 0x86, 0xdf, 0x17, 0xf9, 0x0f, 0x46, 0x47, 0xd3, 0x1c, 0x6a,
+    0x53, 0x1f, 0x85, 0x4f, 0x48, 0x7d, 0xf1, 0x6e, 0xc6, 0x2e, 0xc5, 0x21, 0xe1, 0xc0, 0x90, 0xb5,
+    0xb2, 0x54, 0x52, 0xd6, 0x69, 0x30, 0xc1, 0x58, 0x66, 0x97, 0xd9, 0xdd, 0xcf, 0x4c, 0x27, 0xd6,
+    0x33, 0xac, 0xa3, 0x04, 0x76, 0xa7, 0xc4, 0x01, 0x05, 0xbe, 0x50, 0x46, 0x8f, 0xfd, 0x6d, 0x0c,
+    0x9d, 0x3c, 0xb3, 0x99, 0xd5, 0x93, 0xd3, 0x62, 0x60, 0xfa, 0xee, 0x71, 0x4e, 0x86, 0xcb, 0x79,
+    0xbe, 0x55, 0xd7, 0x1a, 0x4e, 0x4f, 0xb6, 0x22, 0xf9, 0x71, 0x8e, 0x12, 0x82, 0xeb, 0x4b, 0x9f,
+    0x0e, 0x42, 0xe4, 0xb0, 0x72, 0x43, 0x5f, 0xff, 0x62, 0x0e, 0xcc, 0xff, 0x45, 0x8a, 0x2a, 0x85,
+    0x5f, 0x1c, 0xc4, 0x3a, 0x97, 0xe2, 0x76, 0xa0, 0x40, 0x74, 0x4e, 0x38, 0x2d, 0x01, 0x76, 0x35,
+    0x3b, 0xae, 0x61, 0x0f, 0xc0, 0x96, 0x7a, 0x29, 0x6a, 0xbd, 0x83, 0xaa, 0xb8, 0x47, 0x5e, 0xfd,
+    0xe9, 0xd0, 0x0d, 0x4a, 0x8e, 0x0e, 0x23, 0xa6, 0xae, 0x3b, 0xb2, 0xc0, 0x60, 0x84, 0xd2, 0xc8,
+    0x64, 0x62, 0x54, 0x3a, 0x46, 0x61, 0x1a, 0x56, 0xdc, 0x4b, 0x0f, 0x9f, 0x17, 0x28, 0x90, 0x2d,
+    0x5d, 0xd9, 0xc1, 0x80, 0x9d, 0x22, 0x53, 0x70, 0x58, 0xa8, 0x89, 0x4e, 0xae, 0xfc, 0xf7, 0xc5,
+    0x36, 0x1a, 0xc5, 0xea, 0x18, 0x1d, 0x5f, 0x0d, 0xf4, 0x9c, 0xb5, 0x10, 0xb9, 0x5c, 0x99, 0x43,
+    0x9d, 0xe4, 0xc2, 0x22, 0x74, 0x05, 0x3d, 0xd4, 0x07, 0x78, 0x95, 0xe0, 0x11, 0x21, 0x4a, 0x10,
+    0xf3, 0xb6, 0xf2, 0x38, 0xfb, 0x2b, 0xef, 0xcb, 0x23, 0xb1, 0x67, 0x9e, 0x91, 0xad, 0xd1, 0xb0,
+    0xe9, 0x4f, 0x5d, 0x4b, 0x70, 0xb6, 0xbb, 0x66, 0x71, 0xd7, 0x25, 0x11, 0xf3, 0xe8, 0xe6, 0xcf,
+    0xf7, 0x67, 0x9f, 0xa0, 0xb7, 0xfc, 0x75, 0x5c, 0x15, 0xed, 0x9f, 0x0d, 0x94, 0xb4, 0xce, 0x53,
+    0x33, 0x66, 0xca, 0x61, 0x80, 0x2f, 0xf6, 0x90, 0x07, 0xb3, 0x11, 0x12, 0x29, 0xf1, 0x3d, 0x1b,
+    0x61, 0xd4, 0xfe, 0x51, 0xe4, 0x18, 0x3a, 0xeb, 0xeb, 0xee, 0x48, 0x0c, 0x91, 0x28, 0x58, 0x99,
+    0xff, 0x8f, 0xf7, 0xfa, 0x29, 0x9d, 0xb4, 0x3e, 0x9a, 0x71, 0xd2, 0x18, 0x75, 0xff, 0xe6, 0x19,
+    0x0b, 0x98, 0x68, 0x63, 0xa7, 0x7c, 0xf5, 0x61, 0xc2, 0x77, 0xd2, 0x4e, 0x7c, 0x5f, 0x57, 0xac,
+    0xa5, 0x72, 0x71, 0xaf, 0xdb, 0x87, 0xbe, 0xfa, 0x42, 0xba, 0x63, 0x45, 0xcb, 0x23, 0x5d, 0x90,
+    0x33, 0x2e, 0x02, 0x53, 0x54, 0x82, 0x71, 0x7e, 0xb5, 0xa2, 0x52, 0x6d, 0x09, 0x99, 0x0e, 0x47,
+    0xa0, 0xdb, 0xdd, 0xb1, 0x4f, 0x78, 0xf2, 0x64, 0x68, 0x00, 0x9a, 0x53, 0x0d, 0x41, 0xa2, 0x9b,
+    0xf6, 0x70, 0x26, 0x43, 0x87, 0x91, 0xbf, 0x80, 0xb6, 0x32, 0x9b, 0x4a, 0xba, 0x5e, 0x83, 0xbb,
+    0xae, 0x8d, 0xb6, 0x1c, 0x4e, 0x8c, 0xe5, 0xb6, 0x69, 0x44, 0x99, 0xd4, 0xcd, 0x62, 0x61, 0xe7,
+    0x49, 0x5a, 0xf1, 0xba, 0x04, 0xb7, 0x3f, 0x4e, 0xac, 0xf4, 0xd7, 0x98, 0x99, 0x8c, 0x60, 0x69,
+    0xe1, 0xef, 0xdf, 0x9b, 0x3d, 0x5e, 0xc3, 0x01, 0x94, 0xdd, 0x80, 0xdb, 0x82, 0xde, 0x68, 0x11,
+    0x6d, 0xf6, 0x1a, 0xe5, 0x3d, 0xe9, 0xbf, 0x09, 0x69, 0xa7, 0x50, 0x09, 0x38, 0x60, 0x0b, 0x06,
+    0x80, 0x14, 0xff, 0x1f, 0xf0, 0x90, 0xe8, 0x92, 0x6d, 0x35, 0xbd, 0x8a, 0xbe, 0x07, 0x3a, 0x09,
+    0x83, 0x55, 0x7b, 0x3b, 0x3a, 0xa4, 0x33, 0xa4, 0x0c, 0x1f, 0xbf, 0xda, 0xba, 0x96, 0xaa, 0xfd,
+    0xb5, 0x44, 0x63, 0x51, 0xf4, 0x6d, 0x12, 0x3d, 0xbe, 0x40, 0x0f, 0xe9, 0x28, 0x36, 0xea, 0xb6,
+    0x4f, 0xba, 0x06, 0x2e, 0x29, 0x74, 0x11, 0x0c, 0x72, 0x02, 0x97, 0x91, 0x2d, 0x67, 0xe4, 0x73,
+    0xe8, 0xe5, 0x02, 0x5a, 0x94, 0x84, 0xe0, 0x9d, 0x72, 0x8d, 0x63, 0x8a, 0xac, 0xe0, 0xa6, 0x41,
+    0xd0, 0xf4, 0xc7, 0x22, 0xaf, 0x35, 0x95, 0x8c, 0x62, 0x91, 0x09, 0xe9, 0xcb, 0x8f, 0xa8, 0xbe,
+    0x53, 0x0b, 0x49, 0x57, 0x19, 0xf0, 0xc1, 0x86, 0x5e, 0x4e, 0x77, 0x24, 0xed, 0x15, 0xbf, 0x2d,
+    0xa7, 0x55, 0xa3, 0x53, 0xb1, 0x78, 0x12, 0xad, 0xb7, 0x9e, 0x60, 0x0c, 0x58, 0x16, 0x2a, 0xed,
+    0x9e, 0x39, 0x4e, 0x3f, 0x19, 0xd4, 0x39, 0xe3, 0x7a, 0x4a, 0x1d, 0xe8, 0xee, 0x90, 0xdd, 0x36,
+    0x1b, 0xf9, 0xa5, 0x5a, 0x61, 0xa6, 0x03, 0xb2, 0x83, 0x7b, 0x7f, 0x88, 0x33, 0x44, 0xfe, 0x8c,
+    0x6a, 0xce, 0x66, 0x55, 0xd9, 0x25, 0x43, 0x68, 0x2f, 0x51, 0x00, 0x54, 0x1a, 0xf4, 0xd0, 0x18,
+    0x3c, 0x59, 0x4e, 0x19, 0x40, 0x49, 0x2c, 0xb9, 0x81, 0x7b, 0x38, 0xe1, 0x11, 0x7f, 0x5a, 0x2e,
+    0xef, 0x78, 0xb6, 0x11, 0x8f, 0xdc, 0x6d, 0x89, 0x4f, 0xdb, 0x1b, 0xa1, 0x64, 0x30, 0x7b, 0x12,
+    0xd2, 0x65, 0xa4, 0xc4, 0xfa, 0x3b, 0x80, 0xda, 0x36, 0x5a, 0x0b, 0x5a, 0x13, 0x91, 0x6b, 0xd9,
+    0x2e, 0x3c, 0xf3, 0xe1, 0x29, 0x8c, 0xf8, 0xc8, 0x02, 0x5b, 0xa1, 0x2e, 0xf4, 0xc2, 0xe5, 0x8a,
+    0x3f,
 };
+const ShaderModule Blob073 = { Blob073_Data, 5585u, 5466u, 73u };
 
-extern const uint32_t Blob111[5466];
-const uint32_t Blob111[5466] = {
-    0x07230203, 0x00010300, 0x0008000b, 0x0000036a, 0x00000000, 0x00020011, 0x00000001, 0x0006000b,
-    0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001,
-    0x0006000f, 0x00000005, 0x00000004, 0x6e69616d, 0x00000000, 0x000001c9, 0x00060010, 0x00000004,
-    0x00000011, 0x00000008, 0x00000008, 0x00000001, 0x00030003, 0x00000002, 0x000001c2, 0x000a0004,
-    0x475f4c47, 0x4c474f4f, 0x70635f45, 0x74735f70, 0x5f656c79, 0x656e696c, 0x7269645f, 0x69746365,
-    0x00006576, 0x00080004, 0x475f4c47, 0x4c474f4f, 0x6e695f45, 0x64756c63, 0x69645f65, 0x74636572,
-    0x00657669, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000, 0x00070005, 0x0000000a, 0x726f6e55,
-    0x6f54386d, 0x36626752, 0x3b317528, 0x00000000, 0x00040005, 0x00000009, 0x756c6176, 0x00000065,
-    0x00070005, 0x0000000d, 0x726f6e55, 0x6f54386d, 0x68706c41, 0x75283561, 0x00003b31, 0x00040005,
-    0x0000000c, 0x756c6176, 0x00000065, 0x00070005, 0x00000014, 0x64616f4c, 0x616e6946, 0x2842466c,
-    0x3b326976, 0x00000000, 0x00050005, 0x00000013, 0x69736f70, 0x6e6f6974, 0x00000000, 0x00050005,
-    0x00000017, 0x6f6c6f43, 0x28523672, 0x003b3175, 0x00040005, 0x00000016, 0x6f6c6f63, 0x00000072,
-    0x00050005, 0x0000001a, 0x6f6c6f43, 0x28473672, 0x003b3175, 0x00040005, 0x00000019, 0x6f6c6f63,
-    0x00000072, 0x00050005, 0x0000001d, 0x6f6c6f43, 0x28423672, 0x003b3175, 0x00040005, 0x0000001c,
-    0x6f6c6f63, 0x00000072, 0x00080005, 0x00000024, 0x6b636150, 0x6f6c6f43, 0x75283672, 0x31753b31,
-    0x3b31753b, 0x003b3175, 0x00030005, 0x00000020, 0x00000072, 0x00030005, 0x00000021, 0x00000067,
-    0x00030005, 0x00000022, 0x00000062, 0x00040005, 0x00000023, 0x68706c61, 0x00000061, 0x00070005,
-    0x0000002a, 0x6e656c42, 0x75283464, 0x31753b31, 0x3b31753b, 0x003b3175, 0x00040005, 0x00000026,
-    0x73726966, 0x00000074, 0x00040005, 0x00000027, 0x6f636573, 0x0000646e, 0x00030005, 0x00000028,
-    0x00617665, 0x00030005, 0x00000029, 0x00627665, 0x00060005, 0x0000002f, 0x6e656c42, 0x75283564,
-    0x31753b31, 0x0000003b, 0x00040005, 0x0000002d, 0x73726966, 0x00000074, 0x00040005, 0x0000002e,
-    0x6f636573, 0x0000646e, 0x00080005, 0x00000035, 0x67697242, 0x656e7468, 0x70557373, 0x3b317528,
-    0x753b3175, 0x00003b31, 0x00040005, 0x00000032, 0x6f6c6f63, 0x00000072, 0x00040005, 0x00000033,
-    0x74636166, 0x0000726f, 0x00040005, 0x00000034, 0x73616962, 0x00000000, 0x00090005, 0x0000003a,
-    0x67697242, 0x656e7468, 0x6f447373, 0x75286e77, 0x31753b31, 0x3b31753b, 0x00000000, 0x00040005,
-    0x00000037, 0x6f6c6f63, 0x00000072, 0x00040005, 0x00000038, 0x74636166, 0x0000726f, 0x00040005,
-    0x00000039, 0x73616962, 0x00000000, 0x00050005, 0x0000003d, 0x67426f54, 0x28386172, 0x003b3175,
-    0x00040005, 0x0000003c, 0x6f6c6f63, 0x00000072, 0x00090005, 0x00000044, 0x64616f4c, 0x74706143,
-    0x53657275, 0x63656469, 0x75287261, 0x75763b31, 0x00003b32, 0x00050005, 0x00000042, 0x65666572,
-    0x636e6572, 0x00000065, 0x00070005, 0x00000043, 0x6c616373, 0x69576465, 0x6e696874, 0x65786950,
-    0x0000006c, 0x00040005, 0x00000059, 0x65786574, 0x0000006c, 0x00040005, 0x0000005c, 0x616e6946,
-    0x0042466c, 0x00050005, 0x00000062, 0x6e617571, 0x657a6974, 0x00000064, 0x00040005, 0x00000068,
-    0x61726170, 0x0000006d, 0x00040005, 0x0000006d, 0x61726170, 0x0000006d, 0x00040005, 0x00000075,
-    0x61726170, 0x0000006d, 0x00040005, 0x0000007d, 0x61726170, 0x0000006d, 0x00040005, 0x000000a4,
-    0x61726170, 0x0000006d, 0x00040005, 0x000000a9, 0x61726170, 0x0000006d, 0x00040005, 0x000000b3,
-    0x61726170, 0x0000006d, 0x00040005, 0x000000b8, 0x61726170, 0x0000006d, 0x00040005, 0x000000c0,
-    0x61726170, 0x0000006d, 0x00040005, 0x000000c5, 0x61726170, 0x0000006d, 0x00040005, 0x000000cd,
-    0x61726170, 0x0000006d, 0x00040005, 0x000000ce, 0x61726170, 0x0000006d, 0x00040005, 0x000000cf,
-    0x61726170, 0x0000006d, 0x00040005, 0x000000d0, 0x61726170, 0x0000006d, 0x00030005, 0x000000d4,
-    0x00617665, 0x00030005, 0x000000d9, 0x00627665, 0x00040005, 0x000000dd, 0x61726170, 0x0000006d,
-    0x00040005, 0x000000e2, 0x61726170, 0x0000006d, 0x00040005, 0x000000ec, 0x61726170, 0x0000006d,
-    0x00040005, 0x000000f1, 0x61726170, 0x0000006d, 0x00040005, 0x000000f9, 0x61726170, 0x0000006d,
-    0x00040005, 0x000000fe, 0x61726170, 0x0000006d, 0x00040005, 0x00000106, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000107, 0x61726170, 0x0000006d, 0x00040005, 0x00000108, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000109, 0x61726170, 0x0000006d, 0x00040005, 0x0000010d, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000110, 0x61726170, 0x0000006d, 0x00040005, 0x0000011a, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000011d, 0x61726170, 0x0000006d, 0x00040005, 0x00000127, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000012a, 0x61726170, 0x0000006d, 0x00040005, 0x00000134, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000135, 0x61726170, 0x0000006d, 0x00040005, 0x00000136, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000137, 0x61726170, 0x0000006d, 0x00040005, 0x0000013b, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000013e, 0x61726170, 0x0000006d, 0x00040005, 0x00000147, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000014a, 0x61726170, 0x0000006d, 0x00040005, 0x00000153, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000156, 0x61726170, 0x0000006d, 0x00040005, 0x0000015f, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000160, 0x61726170, 0x0000006d, 0x00040005, 0x00000161, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000162, 0x61726170, 0x0000006d, 0x00030005, 0x00000166, 0x00003672, 0x00040005,
-    0x00000167, 0x61726170, 0x0000006d, 0x00030005, 0x0000016a, 0x00003667, 0x00040005, 0x0000016b,
-    0x61726170, 0x0000006d, 0x00030005, 0x0000016e, 0x00003662, 0x00040005, 0x0000016f, 0x61726170,
-    0x0000006d, 0x00030005, 0x00000172, 0x00003872, 0x00030005, 0x00000179, 0x00003867, 0x00030005,
-    0x0000017f, 0x00003862, 0x00040005, 0x00000190, 0x72646461, 0x00737365, 0x00040005, 0x00000194,
-    0x6b6e6162, 0x00000000, 0x00040005, 0x00000199, 0x73726576, 0x006e6f69, 0x00060005, 0x0000019e,
-    0x706d6173, 0x5073656c, 0x69507265, 0x006c6578, 0x00050005, 0x0000019f, 0x65726353, 0x69576e65,
-    0x00687464, 0x00050005, 0x000001a1, 0x6c616353, 0x63614665, 0x00726f74, 0x00040005, 0x000001a5,
-    0x6c6c6563, 0x00000000, 0x00050005, 0x000001af, 0x706d6173, 0x6e49656c, 0x00786564, 0x00080005,
-    0x000001b8, 0x74706143, 0x53657275, 0x63656469, 0x75427261, 0x72656666, 0x00000000, 0x00090006,
-    0x000001b8, 0x00000000, 0x74706143, 0x53657275, 0x63656469, 0x69507261, 0x736c6578, 0x00000000,
-    0x00030005, 0x000001ba, 0x00000000, 0x00030005, 0x000001c6, 0x00006469, 0x00080005, 0x000001c9,
-    0x475f6c67, 0x61626f6c, 0x766e496c, 0x7461636f, 0x496e6f69, 0x00000044, 0x00060005, 0x000001d6,
-    0x65726353, 0x65486e65, 0x74686769, 0x00000000, 0x00040005, 0x000001de, 0x65726373, 0x00006e65,
-    0x00040005, 0x000001e3, 0x6c616373, 0x00596465, 0x00040005, 0x000001ea, 0x6974616e, 0x00586576,
-    0x00040005, 0x000001ef, 0x6974616e, 0x00596576, 0x00050005, 0x000001f3, 0x6974616e, 0x6e496576,
-    0x00786564, 0x00050005, 0x000001f9, 0x6e616c70, 0x73614265, 0x00000065, 0x00040005, 0x000001fd,
-    0x6f6c6562, 0x00000077, 0x00080005, 0x000001ff, 0x75727453, 0x72757463, 0x6e496465, 0x42747570,
-    0x65666675, 0x00000072, 0x00070006, 0x000001ff, 0x00000000, 0x75727453, 0x72757463, 0x6e496465,
-    0x00747570, 0x00030005, 0x00000201, 0x00000000, 0x00040005, 0x00000207, 0x766f6261, 0x00000065,
-    0x00040005, 0x0000020f, 0x746e6f63, 0x006c6f72, 0x00070005, 0x00000217, 0x74706163, 0x52657275,
-    0x72656665, 0x65636e65, 0x00000000, 0x00060005, 0x0000021f, 0x746e6f63, 0x466c6f72, 0x7367616c,
-    0x00000000, 0x00050005, 0x00000223, 0x656e696c, 0x6174654d, 0x00000000, 0x00050005, 0x0000022d,
-    0x70736964, 0x4d79616c, 0x0065646f, 0x00040005, 0x00000231, 0x6f6c6f63, 0x00000072, 0x00040005,
-    0x0000024e, 0x61726170, 0x0000006d, 0x00040005, 0x00000250, 0x61726170, 0x0000006d, 0x00050005,
-    0x00000258, 0x736f5078, 0x6f697469, 0x0000006e, 0x00040005, 0x0000025f, 0x72756f73, 0x00586563,
-    0x00040005, 0x0000027a, 0x65786970, 0x0044336c, 0x00040005, 0x00000288, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000028a, 0x61726170, 0x0000006d, 0x00060005, 0x0000028d, 0x68737550, 0x736e6f43,
-    0x746e6174, 0x00000073, 0x00060006, 0x0000028d, 0x00000000, 0x56727543, 0x61697261, 0x0000746e,
-    0x00060006, 0x0000028d, 0x00000001, 0x57786554, 0x68746469, 0x00000000, 0x00060006, 0x0000028d,
-    0x00000002, 0x48786554, 0x68676965, 0x00000074, 0x00060006, 0x0000028d, 0x00000003, 0x57786554,
-    0x53706172, 0x00000000, 0x00060006, 0x0000028d, 0x00000004, 0x57786554, 0x54706172, 0x00000000,
-    0x00070006, 0x0000028d, 0x00000005, 0x49786554, 0x70614373, 0x65727574, 0x00000000, 0x00070006,
-    0x0000028d, 0x00000006, 0x74706143, 0x59657275, 0x7366664f, 0x00007465, 0x00050006, 0x0000028d,
-    0x00000007, 0x6461705f, 0x00000000, 0x00030005, 0x0000028f, 0x00006370, 0x00040005, 0x000002a1,
-    0x61726170, 0x0000006d, 0x00060005, 0x000002a9, 0x706d6f63, 0x7469736f, 0x4d6e6f69, 0x0065646f,
-    0x00030005, 0x000002ad, 0x00617665, 0x00030005, 0x000002b1, 0x00627665, 0x00040005, 0x000002c0,
-    0x61726170, 0x0000006d, 0x00040005, 0x000002c2, 0x61726170, 0x0000006d, 0x00040005, 0x000002c4,
-    0x61726170, 0x0000006d, 0x00040005, 0x000002c6, 0x61726170, 0x0000006d, 0x00040005, 0x000002ce,
-    0x61726170, 0x0000006d, 0x00040005, 0x000002d0, 0x61726170, 0x0000006d, 0x00040005, 0x000002d2,
-    0x61726170, 0x0000006d, 0x00040005, 0x000002da, 0x61726170, 0x0000006d, 0x00040005, 0x000002dc,
-    0x61726170, 0x0000006d, 0x00040005, 0x000002de, 0x61726170, 0x0000006d, 0x00040005, 0x000002e5,
-    0x61726170, 0x0000006d, 0x00040005, 0x000002e7, 0x61726170, 0x0000006d, 0x00060005, 0x000002f0,
-    0x67697262, 0x656e7468, 0x6f4d7373, 0x00006564, 0x00070005, 0x000002f4, 0x67697262, 0x656e7468,
-    0x61467373, 0x726f7463, 0x00000000, 0x00040005, 0x000002fc, 0x61726170, 0x0000006d, 0x00040005,
-    0x000002fe, 0x61726170, 0x0000006d, 0x00040005, 0x00000300, 0x61726170, 0x0000006d, 0x00040005,
-    0x00000307, 0x61726170, 0x0000006d, 0x00040005, 0x00000309, 0x61726170, 0x0000006d, 0x00040005,
-    0x0000030b, 0x61726170, 0x0000006d, 0x00040005, 0x0000030d, 0x61726762, 0x00000038, 0x00040005,
-    0x0000030e, 0x61726170, 0x0000006d, 0x00040005, 0x00000317, 0x61626772, 0x00000038, 0x00060005,
-    0x00000330, 0x65726944, 0x754f7463, 0x74757074, 0x00706f54, 0x00070005, 0x0000033a, 0x65726944,
-    0x754f7463, 0x74757074, 0x74746f42, 0x00006d6f, 0x00090005, 0x00000345, 0x73657250, 0x61746e65,
-    0x6e6f6974, 0x7074754f, 0x75427475, 0x72656666, 0x00000000, 0x00080006, 0x00000345, 0x00000000,
-    0x73657250, 0x61746e65, 0x6e6f6974, 0x7074754f, 0x00007475, 0x00030005, 0x00000347, 0x00000000,
-    0x00070005, 0x00000349, 0x6d617246, 0x66756265, 0x53726566, 0x64697274, 0x00000065, 0x00060005,
-    0x00000355, 0x5778614d, 0x546b726f, 0x73656c69, 0x00000000, 0x00060005, 0x00000358, 0x656c6954,
-    0x72655073, 0x656e694c, 0x00000000, 0x00050005, 0x00000359, 0x656c6954, 0x656e694c, 0x00000073,
-    0x00050005, 0x0000035f, 0x6174654d, 0x66696e55, 0x006d726f, 0x00060006, 0x0000035f, 0x00000000,
-    0x506d754e, 0x67796c6f, 0x00736e6f, 0x00060006, 0x0000035f, 0x00000001, 0x566d754e, 0x61697261,
-    0x0073746e, 0x00060006, 0x0000035f, 0x00000002, 0x68706c41, 0x66655261, 0x00000000, 0x00050006,
-    0x0000035f, 0x00000003, 0x70736944, 0x00746e43, 0x00060006, 0x0000035f, 0x00000004, 0x6e6f6f54,
-    0x6c626154, 0x00000065, 0x00060006, 0x0000035f, 0x00000005, 0x61656c43, 0x6c6f4372, 0x0000726f,
-    0x00060006, 0x0000035f, 0x00000006, 0x61656c43, 0x70654472, 0x00006874, 0x00060006, 0x0000035f,
-    0x00000007, 0x61656c43, 0x74744172, 0x00000072, 0x00060006, 0x0000035f, 0x00000008, 0x4f676f46,
-    0x65736666, 0x00000074, 0x00060006, 0x0000035f, 0x00000009, 0x53676f46, 0x74666968, 0x00000000,
-    0x00060006, 0x0000035f, 0x0000000a, 0x43676f46, 0x726f6c6f, 0x00000000, 0x00080006, 0x0000035f,
-    0x0000000b, 0x61656c43, 0x74694272, 0x4f70616d, 0x65736666, 0x00000074, 0x00030005, 0x00000361,
-    0x00000000, 0x00040047, 0x0000005c, 0x00000022, 0x00000000, 0x00040047, 0x0000005c, 0x00000021,
-    0x0000000b, 0x00030047, 0x0000005c, 0x00000018, 0x00040047, 0x0000019f, 0x00000001, 0x00000000,
-    0x00040047, 0x000001b7, 0x00000006, 0x00000004, 0x00050048, 0x000001b8, 0x00000000, 0x00000023,
-    0x00000000, 0x00030047, 0x000001b8, 0x00000002, 0x00040047, 0x000001ba, 0x00000022, 0x00000000,
-    0x00040047, 0x000001ba, 0x00000021, 0x0000000e, 0x00040047, 0x000001c9, 0x0000000b, 0x0000001c,
-    0x00040047, 0x000001d6, 0x00000001, 0x00000001, 0x00040047, 0x000001fe, 0x00000006, 0x00000004,
-    0x00040048, 0x000001ff, 0x00000000, 0x00000018, 0x00050048, 0x000001ff, 0x00000000, 0x00000023,
-    0x00000000, 0x00030047, 0x000001ff, 0x00000002, 0x00040047, 0x00000201, 0x00000022, 0x00000000,
-    0x00040047, 0x00000201, 0x00000021, 0x0000000c, 0x00050048, 0x0000028d, 0x00000000, 0x00000023,
-    0x00000000, 0x00050048, 0x0000028d, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x0000028d,
-    0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x0000028d, 0x00000003, 0x00000023, 0x0000000c,
-    0x00050048, 0x0000028d, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x0000028d, 0x00000005,
-    0x00000023, 0x00000014, 0x00050048, 0x0000028d, 0x00000006, 0x00000023, 0x00000018, 0x00050048,
-    0x0000028d, 0x00000007, 0x00000023, 0x0000001c, 0x00030047, 0x0000028d, 0x00000002, 0x00040047,
-    0x00000330, 0x00000022, 0x00000000, 0x00040047, 0x00000330, 0x00000021, 0x00000011, 0x00030047,
-    0x00000330, 0x00000019, 0x00040047, 0x0000033a, 0x00000022, 0x00000000, 0x00040047, 0x0000033a,
-    0x00000021, 0x00000012, 0x00030047, 0x0000033a, 0x00000019, 0x00040047, 0x00000344, 0x00000006,
-    0x00000004, 0x00050048, 0x00000345, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000345,
-    0x00000002, 0x00040047, 0x00000347, 0x00000022, 0x00000000, 0x00040047, 0x00000347, 0x00000021,
-    0x0000000d, 0x00040047, 0x00000355, 0x00000001, 0x00000002, 0x00040047, 0x0000035d, 0x00000006,
-    0x00000010, 0x00050048, 0x0000035f, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x0000035f,
-    0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x0000035f, 0x00000002, 0x00000023, 0x00000008,
-    0x00050048, 0x0000035f, 0x00000003, 0x00000023, 0x0000000c, 0x00050048, 0x0000035f, 0x00000004,
-    0x00000023, 0x00000010, 0x00050048, 0x0000035f, 0x00000005, 0x00000023, 0x00000230, 0x00050048,
-    0x0000035f, 0x00000006, 0x00000023, 0x00000234, 0x00050048, 0x0000035f, 0x00000007, 0x00000023,
-    0x00000238, 0x00050048, 0x0000035f, 0x00000008, 0x00000023, 0x0000023c, 0x00050048, 0x0000035f,
-    0x00000009, 0x00000023, 0x00000240, 0x00050048, 0x0000035f, 0x0000000a, 0x00000023, 0x00000244,
-    0x00050048, 0x0000035f, 0x0000000b, 0x00000023, 0x00000248, 0x00030047, 0x0000035f, 0x00000002,
-    0x00040047, 0x00000361, 0x00000022, 0x00000000, 0x00040047, 0x00000361, 0x00000021, 0x00000000,
-    0x00040047, 0x00000367, 0x0000000b, 0x00000019, 0x00020013, 0x00000002, 0x00030021, 0x00000003,
-    0x00000002, 0x00040015, 0x00000006, 0x00000020, 0x00000000, 0x00040020, 0x00000007, 0x00000007,
-    0x00000006, 0x00040021, 0x00000008, 0x00000006, 0x00000007, 0x00040015, 0x0000000f, 0x00000020,
-    0x00000001, 0x00040017, 0x00000010, 0x0000000f, 0x00000002, 0x00040020, 0x00000011, 0x00000007,
-    0x00000010, 0x00040021, 0x00000012, 0x00000006, 0x00000011, 0x00070021, 0x0000001f, 0x00000006,
-    0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00050021, 0x0000002c, 0x00000006, 0x00000007,
-    0x00000007, 0x00060021, 0x00000031, 0x00000006, 0x00000007, 0x00000007, 0x00000007, 0x00040017,
-    0x0000003f, 0x00000006, 0x00000002, 0x00040020, 0x00000040, 0x00000007, 0x0000003f, 0x00050021,
-    0x00000041, 0x00000006, 0x00000007, 0x00000040, 0x0004002b, 0x00000006, 0x00000047, 0x0000003f,
-    0x0004002b, 0x00000006, 0x00000049, 0x0000007f, 0x0004002b, 0x00000006, 0x0000004b, 0x000000ff,
-    0x0004002b, 0x00000006, 0x00000050, 0x0000001f, 0x00030016, 0x00000056, 0x00000020, 0x00040017,
-    0x00000057, 0x00000056, 0x00000004, 0x00040020, 0x00000058, 0x00000007, 0x00000057, 0x00090019,
-    0x0000005a, 0x00000056, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000004,
-    0x00040020, 0x0000005b, 0x00000000, 0x0000005a, 0x0004003b, 0x0000005b, 0x0000005c, 0x00000000,
-    0x00040017, 0x00000060, 0x00000006, 0x00000004, 0x00040020, 0x00000061, 0x00000007, 0x00000060,
-    0x0004002b, 0x00000056, 0x00000064, 0x437f0000, 0x0004002b, 0x00000006, 0x00000069, 0x00000000,
-    0x0004002b, 0x00000006, 0x0000006e, 0x00000001, 0x0004002b, 0x0000000f, 0x00000072, 0x00000008,
-    0x0004002b, 0x00000006, 0x00000076, 0x00000002, 0x0004002b, 0x0000000f, 0x0000007a, 0x00000010,
-    0x0004002b, 0x00000006, 0x0000007e, 0x00000003, 0x0004002b, 0x0000000f, 0x00000082, 0x00000018,
-    0x0004002b, 0x00000006, 0x000000af, 0x00000008, 0x0004002b, 0x0000000f, 0x000000b1, 0x00000004,
-    0x0004002b, 0x00000006, 0x000000da, 0x00000020, 0x0004002b, 0x00000006, 0x000000e8, 0x00000010,
-    0x0004002b, 0x0000000f, 0x000000ea, 0x00000005, 0x0004002b, 0x0000000f, 0x00000174, 0x00000002,
-    0x0004002b, 0x00000006, 0x0000018c, 0xff000000, 0x0004002b, 0x00000006, 0x00000192, 0x0000ffff,
-    0x0004002b, 0x00000006, 0x00000196, 0x0000001c, 0x0004002b, 0x00000006, 0x0000019b, 0x0000001e,
-    0x00040032, 0x0000000f, 0x0000019f, 0x00000100, 0x0004002b, 0x0000000f, 0x000001a0, 0x00000100,
-    0x00060034, 0x0000000f, 0x000001a1, 0x00000087, 0x0000019f, 0x000001a0, 0x00060034, 0x00000006,
-    0x000001a2, 0x00000080, 0x000001a1, 0x00000069, 0x00060034, 0x00000006, 0x000001a3, 0x00000080,
-    0x000001a1, 0x00000069, 0x00060034, 0x00000006, 0x000001a4, 0x00000084, 0x000001a2, 0x000001a3,
-    0x0004002b, 0x00000006, 0x000001a7, 0x00000004, 0x0004002b, 0x00000006, 0x000001ab, 0x00010000,
-    0x00060034, 0x00000006, 0x000001b2, 0x00000080, 0x000001a1, 0x00000069, 0x0003001d, 0x000001b7,
-    0x00000006, 0x0003001e, 0x000001b8, 0x000001b7, 0x00040020, 0x000001b9, 0x0000000c, 0x000001b8,
-    0x0004003b, 0x000001b9, 0x000001ba, 0x0000000c, 0x0004002b, 0x0000000f, 0x000001bb, 0x00000000,
-    0x00040020, 0x000001c1, 0x0000000c, 0x00000006, 0x00040017, 0x000001c7, 0x00000006, 0x00000003,
-    0x00040020, 0x000001c8, 0x00000001, 0x000001c7, 0x0004003b, 0x000001c8, 0x000001c9, 0x00000001,
-    0x00020014, 0x000001cc, 0x00060034, 0x00000006, 0x000001cf, 0x00000080, 0x0000019f, 0x00000069,
-    0x00040032, 0x0000000f, 0x000001d6, 0x000000c0, 0x00060034, 0x00000006, 0x000001d7, 0x00000080,
-    0x000001d6, 0x00000069, 0x00060034, 0x00000006, 0x000001d8, 0x00000084, 0x000001d7, 0x00000076,
-    0x00060034, 0x00000006, 0x000001e1, 0x00000080, 0x000001d6, 0x00000069, 0x00060034, 0x00000006,
-    0x000001e7, 0x00000080, 0x000001d6, 0x00000069, 0x00060034, 0x00000006, 0x000001ed, 0x00000080,
-    0x000001a1, 0x00000069, 0x00060034, 0x00000006, 0x000001f1, 0x00000080, 0x000001a1, 0x00000069,
-    0x0004002b, 0x00000006, 0x000001f6, 0x00000100, 0x0004002b, 0x00000006, 0x000001fb, 0x00030000,
-    0x0003001d, 0x000001fe, 0x00000006, 0x0003001e, 0x000001ff, 0x000001fe, 0x00040020, 0x00000200,
-    0x0000000c, 0x000001ff, 0x0004003b, 0x00000200, 0x00000201, 0x0000000c, 0x0004002b, 0x00000006,
-    0x00000209, 0x0000c000, 0x0004002b, 0x00000006, 0x00000211, 0x00018000, 0x0004002b, 0x00000006,
-    0x00000219, 0x00024000, 0x0004002b, 0x00000006, 0x00000221, 0x00000018, 0x0004002b, 0x00000006,
-    0x00000224, 0x000a8000, 0x0004002b, 0x00000006, 0x00000226, 0x000000c0, 0x0004002b, 0x00000006,
-    0x00000234, 0x80000000, 0x0004002b, 0x00000006, 0x0000023f, 0x00000040, 0x00060034, 0x00000006,
-    0x00000248, 0x00000080, 0x000001a1, 0x00000069, 0x00060034, 0x00000006, 0x0000024b, 0x00000080,
-    0x000001a1, 0x00000069, 0x0004002b, 0x00000006, 0x0000025a, 0x00000017, 0x0004002b, 0x00000006,
-    0x0000025c, 0x000001ff, 0x00040020, 0x0000025e, 0x00000007, 0x0000000f, 0x0004002b, 0x00000006,
-    0x00000269, 0x00000200, 0x00060034, 0x00000006, 0x0000026c, 0x00000080, 0x000001a1, 0x00000069,
-    0x00060034, 0x00000006, 0x00000275, 0x00000080, 0x000001a1, 0x00000069, 0x00060034, 0x00000006,
-    0x00000282, 0x00000080, 0x000001a1, 0x00000069, 0x00060034, 0x00000006, 0x00000285, 0x00000080,
-    0x000001a1, 0x00000069, 0x000a001e, 0x0000028d, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x0000000f, 0x00000006, 0x00040020, 0x0000028e, 0x00000009, 0x0000028d,
-    0x0004003b, 0x0000028e, 0x0000028f, 0x00000009, 0x0004002b, 0x0000000f, 0x00000290, 0x00000001,
-    0x00040020, 0x00000291, 0x00000009, 0x00000006, 0x0004002b, 0x00000006, 0x000002ab, 0x0000000f,
-    0x0004002b, 0x00000006, 0x000002ba, 0x00000080, 0x0004002b, 0x00000006, 0x000002d9, 0x00000007,
-    0x0004002b, 0x0000000f, 0x00000311, 0x00000007, 0x0004003b, 0x0000005b, 0x00000330, 0x00000000,
-    0x0004003b, 0x0000005b, 0x0000033a, 0x00000000, 0x0003001d, 0x00000344, 0x00000006, 0x0003001e,
-    0x00000345, 0x00000344, 0x00040020, 0x00000346, 0x0000000c, 0x00000345, 0x0004003b, 0x00000346,
-    0x00000347, 0x0000000c, 0x00060034, 0x0000000f, 0x00000349, 0x00000084, 0x0000019f, 0x000001d6,
-    0x00060034, 0x00000006, 0x0000034a, 0x00000080, 0x00000349, 0x00000069, 0x00060034, 0x00000006,
-    0x0000034d, 0x00000080, 0x0000019f, 0x00000069, 0x00040032, 0x0000000f, 0x00000355, 0x00003000,
-    0x0004002b, 0x0000000f, 0x00000356, 0x000000c0, 0x0004002b, 0x0000000f, 0x00000357, 0x00000020,
-    0x00060034, 0x0000000f, 0x00000358, 0x00000087, 0x0000019f, 0x00000357, 0x00060034, 0x0000000f,
-    0x00000359, 0x00000087, 0x000001d6, 0x00000357, 0x0004002b, 0x0000000f, 0x0000035a, 0x00000040,
-    0x0004002b, 0x0000000f, 0x0000035b, 0x00000800, 0x0004002b, 0x00000006, 0x0000035c, 0x00000022,
-    0x0004001c, 0x0000035d, 0x00000060, 0x0000035c, 0x00040017, 0x0000035e, 0x00000056, 0x00000002,
-    0x000e001e, 0x0000035f, 0x00000006, 0x00000006, 0x0000000f, 0x00000006, 0x0000035d, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x0000035e, 0x00040020, 0x00000360,
-    0x00000002, 0x0000035f, 0x0004003b, 0x00000360, 0x00000361, 0x00000002, 0x0004002b, 0x0000000f,
-    0x00000362, 0x0000c000, 0x0004002b, 0x00000006, 0x00000363, 0x00060000, 0x0004002b, 0x00000006,
-    0x00000364, 0x00090000, 0x0004002b, 0x00000006, 0x00000365, 0x0009c000, 0x0004002b, 0x00000006,
-    0x00000366, 0x000a8180, 0x0006002c, 0x000001c7, 0x00000367, 0x000000af, 0x000000af, 0x0000006e,
-    0x0004002b, 0x00000006, 0x00000368, 0x20000000, 0x0004002b, 0x00000006, 0x00000369, 0x40000000,
-    0x00050036, 0x00000002, 0x00000004, 0x00000000, 0x00000003, 0x000200f8, 0x00000005, 0x0004003b,
-    0x00000040, 0x000001c6, 0x00000007, 0x0004003b, 0x00000007, 0x000001de, 0x00000007, 0x0004003b,
-    0x00000007, 0x000001e3, 0x00000007, 0x0004003b, 0x00000007, 0x000001ea, 0x00000007, 0x0004003b,
-    0x00000007, 0x000001ef, 0x00000007, 0x0004003b, 0x00000007, 0x000001f3, 0x00000007, 0x0004003b,
-    0x00000007, 0x000001f9, 0x00000007, 0x0004003b, 0x00000007, 0x000001fd, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000207, 0x00000007, 0x0004003b, 0x00000007, 0x0000020f, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000217, 0x00000007, 0x0004003b, 0x00000007, 0x0000021f, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000223, 0x00000007, 0x0004003b, 0x00000007, 0x0000022d, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000231, 0x00000007, 0x0004003b, 0x00000007, 0x0000024e, 0x00000007, 0x0004003b,
-    0x00000040, 0x00000250, 0x00000007, 0x0004003b, 0x00000007, 0x00000258, 0x00000007, 0x0004003b,
-    0x0000025e, 0x0000025f, 0x00000007, 0x0004003b, 0x0000025e, 0x00000263, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000027a, 0x00000007, 0x0004003b, 0x00000007, 0x00000288, 0x00000007, 0x0004003b,
-    0x00000040, 0x0000028a, 0x00000007, 0x0004003b, 0x00000011, 0x000002a1, 0x00000007, 0x0004003b,
-    0x00000007, 0x000002a9, 0x00000007, 0x0004003b, 0x00000007, 0x000002ad, 0x00000007, 0x0004003b,
-    0x00000007, 0x000002b1, 0x00000007, 0x0004003b, 0x00000007, 0x000002c0, 0x00000007, 0x0004003b,
-    0x00000007, 0x000002c2, 0x00000007, 0x0004003b, 0x00000007, 0x000002c4, 0x00000007, 0x0004003b,
-    0x00000007, 0x000002c6, 0x00000007, 0x0004003b, 0x00000007, 0x000002ce, 0x00000007, 0x0004003b,
-    0x00000007, 0x000002d0, 0x00000007, 0x0004003b, 0x00000007, 0x000002d2, 0x00000007, 0x0004003b,
-    0x00000007, 0x000002da, 0x00000007, 0x0004003b, 0x00000007, 0x000002dc, 0x00000007, 0x0004003b,
-    0x00000007, 0x000002de, 0x00000007, 0x0004003b, 0x00000007, 0x000002e5, 0x00000007, 0x0004003b,
-    0x00000007, 0x000002e7, 0x00000007, 0x0004003b, 0x00000007, 0x000002f0, 0x00000007, 0x0004003b,
-    0x00000007, 0x000002f4, 0x00000007, 0x0004003b, 0x00000007, 0x000002fc, 0x00000007, 0x0004003b,
-    0x00000007, 0x000002fe, 0x00000007, 0x0004003b, 0x00000007, 0x00000300, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000307, 0x00000007, 0x0004003b, 0x00000007, 0x00000309, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000030b, 0x00000007, 0x0004003b, 0x00000007, 0x0000030d, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000030e, 0x00000007, 0x0004003b, 0x00000058, 0x00000317, 0x00000007, 0x0004003d,
-    0x000001c7, 0x000001ca, 0x000001c9, 0x0007004f, 0x0000003f, 0x000001cb, 0x000001ca, 0x000001ca,
-    0x00000000, 0x00000001, 0x0003003e, 0x000001c6, 0x000001cb, 0x00050041, 0x00000007, 0x000001cd,
-    0x000001c6, 0x00000069, 0x0004003d, 0x00000006, 0x000001ce, 0x000001cd, 0x000500ae, 0x000001cc,
-    0x000001d0, 0x000001ce, 0x000001cf, 0x000400a8, 0x000001cc, 0x000001d1, 0x000001d0, 0x000300f7,
-    0x000001d3, 0x00000000, 0x000400fa, 0x000001d1, 0x000001d2, 0x000001d3, 0x000200f8, 0x000001d2,
-    0x00050041, 0x00000007, 0x000001d4, 0x000001c6, 0x0000006e, 0x0004003d, 0x00000006, 0x000001d5,
-    0x000001d4, 0x000500ae, 0x000001cc, 0x000001d9, 0x000001d5, 0x000001d8, 0x000200f9, 0x000001d3,
-    0x000200f8, 0x000001d3, 0x000700f5, 0x000001cc, 0x000001da, 0x000001d0, 0x00000005, 0x000001d9,
-    0x000001d2, 0x000300f7, 0x000001dc, 0x00000000, 0x000400fa, 0x000001da, 0x000001db, 0x000001dc,
-    0x000200f8, 0x000001db, 0x000100fd, 0x000200f8, 0x000001dc, 0x00050041, 0x00000007, 0x000001df,
-    0x000001c6, 0x0000006e, 0x0004003d, 0x00000006, 0x000001e0, 0x000001df, 0x00050086, 0x00000006,
-    0x000001e2, 0x000001e0, 0x000001e1, 0x0003003e, 0x000001de, 0x000001e2, 0x00050041, 0x00000007,
-    0x000001e4, 0x000001c6, 0x0000006e, 0x0004003d, 0x00000006, 0x000001e5, 0x000001e4, 0x0004003d,
-    0x00000006, 0x000001e6, 0x000001de, 0x00050084, 0x00000006, 0x000001e8, 0x000001e6, 0x000001e7,
-    0x00050082, 0x00000006, 0x000001e9, 0x000001e5, 0x000001e8, 0x0003003e, 0x000001e3, 0x000001e9,
-    0x00050041, 0x00000007, 0x000001eb, 0x000001c6, 0x00000069, 0x0004003d, 0x00000006, 0x000001ec,
-    0x000001eb, 0x00050086, 0x00000006, 0x000001ee, 0x000001ec, 0x000001ed, 0x0003003e, 0x000001ea,
-    0x000001ee, 0x0004003d, 0x00000006, 0x000001f0, 0x000001e3, 0x00050086, 0x00000006, 0x000001f2,
-    0x000001f0, 0x000001f1, 0x0003003e, 0x000001ef, 0x000001f2, 0x0004003d, 0x00000006, 0x000001f4,
-    0x000001ea, 0x0004003d, 0x00000006, 0x000001f5, 0x000001ef, 0x00050084, 0x00000006, 0x000001f7,
-    0x000001f5, 0x000001f6, 0x00050080, 0x00000006, 0x000001f8, 0x000001f4, 0x000001f7, 0x0003003e,
-    0x000001f3, 0x000001f8, 0x0004003d, 0x00000006, 0x000001fa, 0x000001de, 0x00050084, 0x00000006,
-    0x000001fc, 0x000001fa, 0x000001fb, 0x0003003e, 0x000001f9, 0x000001fc, 0x0004003d, 0x00000006,
-    0x00000202, 0x000001f9, 0x0004003d, 0x00000006, 0x00000203, 0x000001f3, 0x00050080, 0x00000006,
-    0x00000204, 0x00000202, 0x00000203, 0x00060041, 0x000001c1, 0x00000205, 0x00000201, 0x000001bb,
-    0x00000204, 0x0004003d, 0x00000006, 0x00000206, 0x00000205, 0x0003003e, 0x000001fd, 0x00000206,
-    0x0004003d, 0x00000006, 0x00000208, 0x000001f9, 0x00050080, 0x00000006, 0x0000020a, 0x00000208,
-    0x00000209, 0x0004003d, 0x00000006, 0x0000020b, 0x000001f3, 0x00050080, 0x00000006, 0x0000020c,
-    0x0000020a, 0x0000020b, 0x00060041, 0x000001c1, 0x0000020d, 0x00000201, 0x000001bb, 0x0000020c,
-    0x0004003d, 0x00000006, 0x0000020e, 0x0000020d, 0x0003003e, 0x00000207, 0x0000020e, 0x0004003d,
-    0x00000006, 0x00000210, 0x000001f9, 0x00050080, 0x00000006, 0x00000212, 0x00000210, 0x00000211,
-    0x0004003d, 0x00000006, 0x00000213, 0x000001f3, 0x00050080, 0x00000006, 0x00000214, 0x00000212,
-    0x00000213, 0x00060041, 0x000001c1, 0x00000215, 0x00000201, 0x000001bb, 0x00000214, 0x0004003d,
-    0x00000006, 0x00000216, 0x00000215, 0x0003003e, 0x0000020f, 0x00000216, 0x0004003d, 0x00000006,
-    0x00000218, 0x000001f9, 0x00050080, 0x00000006, 0x0000021a, 0x00000218, 0x00000219, 0x0004003d,
-    0x00000006, 0x0000021b, 0x000001f3, 0x00050080, 0x00000006, 0x0000021c, 0x0000021a, 0x0000021b,
-    0x00060041, 0x000001c1, 0x0000021d, 0x00000201, 0x000001bb, 0x0000021c, 0x0004003d, 0x00000006,
-    0x0000021e, 0x0000021d, 0x0003003e, 0x00000217, 0x0000021e, 0x0004003d, 0x00000006, 0x00000220,
-    0x0000020f, 0x000500c2, 0x00000006, 0x00000222, 0x00000220, 0x00000221, 0x0003003e, 0x0000021f,
-    0x00000222, 0x0004003d, 0x00000006, 0x00000225, 0x000001de, 0x00050084, 0x00000006, 0x00000227,
-    0x00000225, 0x00000226, 0x00050080, 0x00000006, 0x00000228, 0x00000224, 0x00000227, 0x0004003d,
-    0x00000006, 0x00000229, 0x000001ef, 0x00050080, 0x00000006, 0x0000022a, 0x00000228, 0x00000229,
-    0x00060041, 0x000001c1, 0x0000022b, 0x00000201, 0x000001bb, 0x0000022a, 0x0004003d, 0x00000006,
-    0x0000022c, 0x0000022b, 0x0003003e, 0x00000223, 0x0000022c, 0x0004003d, 0x00000006, 0x0000022e,
-    0x00000223, 0x000500c2, 0x00000006, 0x0000022f, 0x0000022e, 0x000000e8, 0x000500c7, 0x00000006,
-    0x00000230, 0x0000022f, 0x0000007e, 0x0003003e, 0x0000022d, 0x00000230, 0x0004003d, 0x00000006,
-    0x00000232, 0x000001fd, 0x0003003e, 0x00000231, 0x00000232, 0x0004003d, 0x00000006, 0x00000233,
-    0x00000217, 0x000500c7, 0x00000006, 0x00000235, 0x00000233, 0x00000234, 0x000500ab, 0x000001cc,
-    0x00000236, 0x00000235, 0x00000069, 0x000300f7, 0x00000238, 0x00000000, 0x000400fa, 0x00000236,
-    0x00000237, 0x00000238, 0x000200f8, 0x00000237, 0x0004003d, 0x00000006, 0x00000239, 0x0000022d,
-    0x000500aa, 0x000001cc, 0x0000023a, 0x00000239, 0x00000076, 0x000400a8, 0x000001cc, 0x0000023b,
-    0x0000023a, 0x000300f7, 0x0000023d, 0x00000000, 0x000400fa, 0x0000023b, 0x0000023c, 0x0000023d,
-    0x000200f8, 0x0000023c, 0x0004003d, 0x00000006, 0x0000023e, 0x0000021f, 0x000500c7, 0x00000006,
-    0x00000240, 0x0000023e, 0x0000023f, 0x000500aa, 0x000001cc, 0x00000241, 0x00000240, 0x00000069,
-    0x000200f9, 0x0000023d, 0x000200f8, 0x0000023d, 0x000700f5, 0x000001cc, 0x00000242, 0x0000023a,
-    0x00000237, 0x00000241, 0x0000023c, 0x000200f9, 0x00000238, 0x000200f8, 0x00000238, 0x000700f5,
-    0x000001cc, 0x00000243, 0x00000236, 0x000001dc, 0x00000242, 0x0000023d, 0x000300f7, 0x00000245,
-    0x00000000, 0x000400fa, 0x00000243, 0x00000244, 0x00000252, 0x000200f8, 0x00000244, 0x00050041,
-    0x00000007, 0x00000246, 0x000001c6, 0x00000069, 0x0004003d, 0x00000006, 0x00000247, 0x00000246,
-    0x00050089, 0x00000006, 0x00000249, 0x00000247, 0x00000248, 0x0004003d, 0x00000006, 0x0000024a,
-    0x000001e3, 0x00050089, 0x00000006, 0x0000024c, 0x0000024a, 0x0000024b, 0x00050050, 0x0000003f,
-    0x0000024d, 0x00000249, 0x0000024c, 0x0004003d, 0x00000006, 0x0000024f, 0x00000217, 0x0003003e,
-    0x0000024e, 0x0000024f, 0x0003003e, 0x00000250, 0x0000024d, 0x00060039, 0x00000006, 0x00000251,
-    0x00000044, 0x0000024e, 0x00000250, 0x0003003e, 0x00000231, 0x00000251, 0x000200f9, 0x00000245,
-    0x000200f8, 0x00000252, 0x0004003d, 0x00000006, 0x00000253, 0x0000021f, 0x000500c7, 0x00000006,
-    0x00000254, 0x00000253, 0x0000023f, 0x000500ab, 0x000001cc, 0x00000255, 0x00000254, 0x00000069,
-    0x000300f7, 0x00000257, 0x00000000, 0x000400fa, 0x00000255, 0x00000256, 0x00000257, 0x000200f8,
-    0x00000256, 0x0004003d, 0x00000006, 0x00000259, 0x00000223, 0x000500c2, 0x00000006, 0x0000025b,
-    0x00000259, 0x0000025a, 0x000500c7, 0x00000006, 0x0000025d, 0x0000025b, 0x0000025c, 0x0003003e,
-    0x00000258, 0x0000025d, 0x0004003d, 0x00000006, 0x00000260, 0x00000258, 0x000500c7, 0x00000006,
-    0x00000261, 0x00000260, 0x000001f6, 0x000500ab, 0x000001cc, 0x00000262, 0x00000261, 0x00000069,
-    0x000300f7, 0x00000265, 0x00000000, 0x000400fa, 0x00000262, 0x00000264, 0x00000270, 0x000200f8,
-    0x00000264, 0x00050041, 0x00000007, 0x00000266, 0x000001c6, 0x00000069, 0x0004003d, 0x00000006,
-    0x00000267, 0x00000266, 0x0004007c, 0x0000000f, 0x00000268, 0x00000267, 0x0004003d, 0x00000006,
-    0x0000026a, 0x00000258, 0x00050082, 0x00000006, 0x0000026b, 0x00000269, 0x0000026a, 0x00050084,
-    0x00000006, 0x0000026d, 0x0000026b, 0x0000026c, 0x0004007c, 0x0000000f, 0x0000026e, 0x0000026d,
-    0x00050082, 0x0000000f, 0x0000026f, 0x00000268, 0x0000026e, 0x0003003e, 0x00000263, 0x0000026f,
-    0x000200f9, 0x00000265, 0x000200f8, 0x00000270, 0x00050041, 0x00000007, 0x00000271, 0x000001c6,
-    0x00000069, 0x0004003d, 0x00000006, 0x00000272, 0x00000271, 0x0004007c, 0x0000000f, 0x00000273,
-    0x00000272, 0x0004003d, 0x00000006, 0x00000274, 0x00000258, 0x00050084, 0x00000006, 0x00000276,
-    0x00000274, 0x00000275, 0x0004007c, 0x0000000f, 0x00000277, 0x00000276, 0x00050080, 0x0000000f,
-    0x00000278, 0x00000273, 0x00000277, 0x0003003e, 0x00000263, 0x00000278, 0x000200f9, 0x00000265,
-    0x000200f8, 0x00000265, 0x0004003d, 0x0000000f, 0x00000279, 0x00000263, 0x0003003e, 0x0000025f,
-    0x00000279, 0x0003003e, 0x0000027a, 0x00000069, 0x0004003d, 0x00000006, 0x0000027b, 0x00000217,
-    0x000500c7, 0x00000006, 0x0000027c, 0x0000027b, 0x00000234, 0x000500ab, 0x000001cc, 0x0000027d,
-    0x0000027c, 0x00000069, 0x000300f7, 0x0000027f, 0x00000000, 0x000400fa, 0x0000027d, 0x0000027e,
-    0x0000028c, 0x000200f8, 0x0000027e, 0x00050041, 0x00000007, 0x00000280, 0x000001c6, 0x00000069,
-    0x0004003d, 0x00000006, 0x00000281, 0x00000280, 0x00050089, 0x00000006, 0x00000283, 0x00000281,
-    0x00000282, 0x0004003d, 0x00000006, 0x00000284, 0x000001e3, 0x00050089, 0x00000006, 0x00000286,
-    0x00000284, 0x00000285, 0x00050050, 0x0000003f, 0x00000287, 0x00000283, 0x00000286, 0x0004003d,
-    0x00000006, 0x00000289, 0x00000217, 0x0003003e, 0x00000288, 0x00000289, 0x0003003e, 0x0000028a,
-    0x00000287, 0x00060039, 0x00000006, 0x0000028b, 0x00000044, 0x00000288, 0x0000028a, 0x0003003e,
-    0x0000027a, 0x0000028b, 0x000200f9, 0x0000027f, 0x000200f8, 0x0000028c, 0x00050041, 0x00000291,
-    0x00000292, 0x0000028f, 0x00000290, 0x0004003d, 0x00000006, 0x00000293, 0x00000292, 0x000500ab,
-    0x000001cc, 0x00000294, 0x00000293, 0x00000069, 0x0004003d, 0x0000000f, 0x00000295, 0x0000025f,
-    0x000500af, 0x000001cc, 0x00000296, 0x00000295, 0x000001bb, 0x000500a7, 0x000001cc, 0x00000297,
-    0x00000294, 0x00000296, 0x0004003d, 0x0000000f, 0x00000298, 0x0000025f, 0x000500b1, 0x000001cc,
-    0x00000299, 0x00000298, 0x0000019f, 0x000500a7, 0x000001cc, 0x0000029a, 0x00000297, 0x00000299,
-    0x000300f7, 0x0000029c, 0x00000000, 0x000400fa, 0x0000029a, 0x0000029b, 0x0000029c, 0x000200f8,
-    0x0000029b, 0x0004003d, 0x0000000f, 0x0000029d, 0x0000025f, 0x0004003d, 0x00000006, 0x0000029e,
-    0x000001e3, 0x0004007c, 0x0000000f, 0x0000029f, 0x0000029e, 0x00050050, 0x00000010, 0x000002a0,
-    0x0000029d, 0x0000029f, 0x0003003e, 0x000002a1, 0x000002a0, 0x00050039, 0x00000006, 0x000002a2,
-    0x00000014, 0x000002a1, 0x0003003e, 0x0000027a, 0x000002a2, 0x000200f9, 0x0000029c, 0x000200f8,
-    0x0000029c, 0x000200f9, 0x0000027f, 0x000200f8, 0x0000027f, 0x0004003d, 0x00000006, 0x000002a3,
-    0x0000027a, 0x000500c2, 0x00000006, 0x000002a4, 0x000002a3, 0x00000221, 0x000500c7, 0x00000006,
-    0x000002a5, 0x000002a4, 0x00000050, 0x000500ab, 0x000001cc, 0x000002a6, 0x000002a5, 0x00000069,
-    0x000300f7, 0x000002a8, 0x00000000, 0x000400fa, 0x000002a6, 0x000002a7, 0x000002a8, 0x000200f8,
-    0x000002a7, 0x0004003d, 0x00000006, 0x000002aa, 0x0000021f, 0x000500c7, 0x00000006, 0x000002ac,
-    0x000002aa, 0x000002ab, 0x0003003e, 0x000002a9, 0x000002ac, 0x0004003d, 0x00000006, 0x000002ae,
-    0x0000020f, 0x000500c2, 0x00000006, 0x000002af, 0x000002ae, 0x000000af, 0x000500c7, 0x00000006,
-    0x000002b0, 0x000002af, 0x00000050, 0x0003003e, 0x000002ad, 0x000002b0, 0x0004003d, 0x00000006,
-    0x000002b2, 0x0000020f, 0x000500c2, 0x00000006, 0x000002b3, 0x000002b2, 0x000000e8, 0x000500c7,
-    0x00000006, 0x000002b4, 0x000002b3, 0x00000050, 0x0003003e, 0x000002b1, 0x000002b4, 0x0004003d,
-    0x00000006, 0x000002b5, 0x000002a9, 0x000500aa, 0x000001cc, 0x000002b6, 0x000002b5, 0x0000006e,
-    0x000300f7, 0x000002b8, 0x00000000, 0x000400fa, 0x000002b6, 0x000002b7, 0x000002b8, 0x000200f8,
-    0x000002b7, 0x0004003d, 0x00000006, 0x000002b9, 0x0000021f, 0x000500c7, 0x00000006, 0x000002bb,
-    0x000002b9, 0x000002ba, 0x000500ab, 0x000001cc, 0x000002bc, 0x000002bb, 0x00000069, 0x000200f9,
-    0x000002b8, 0x000200f8, 0x000002b8, 0x000700f5, 0x000001cc, 0x000002bd, 0x000002b6, 0x000002a7,
-    0x000002bc, 0x000002b7, 0x000300f7, 0x000002bf, 0x00000000, 0x000400fa, 0x000002bd, 0x000002be,
-    0x000002c9, 0x000200f8, 0x000002be, 0x0004003d, 0x00000006, 0x000002c1, 0x00000207, 0x0003003e,
-    0x000002c0, 0x000002c1, 0x0004003d, 0x00000006, 0x000002c3, 0x0000027a, 0x0003003e, 0x000002c2,
-    0x000002c3, 0x0004003d, 0x00000006, 0x000002c5, 0x000002ad, 0x0003003e, 0x000002c4, 0x000002c5,
-    0x0004003d, 0x00000006, 0x000002c7, 0x000002b1, 0x0003003e, 0x000002c6, 0x000002c7, 0x00080039,
-    0x00000006, 0x000002c8, 0x0000002a, 0x000002c0, 0x000002c2, 0x000002c4, 0x000002c6, 0x0003003e,
-    0x00000231, 0x000002c8, 0x000200f9, 0x000002bf, 0x000200f8, 0x000002c9, 0x0004003d, 0x00000006,
-    0x000002ca, 0x000002a9, 0x000500aa, 0x000001cc, 0x000002cb, 0x000002ca, 0x00000076, 0x000300f7,
-    0x000002cd, 0x00000000, 0x000400fa, 0x000002cb, 0x000002cc, 0x000002d4, 0x000200f8, 0x000002cc,
-    0x0004003d, 0x00000006, 0x000002cf, 0x0000027a, 0x0003003e, 0x000002ce, 0x000002cf, 0x0004003d,
-    0x00000006, 0x000002d1, 0x000002ad, 0x0003003e, 0x000002d0, 0x000002d1, 0x0003003e, 0x000002d2,
-    0x000000af, 0x00070039, 0x00000006, 0x000002d3, 0x00000035, 0x000002ce, 0x000002d0, 0x000002d2,
-    0x0003003e, 0x00000231, 0x000002d3, 0x000200f9, 0x000002cd, 0x000200f8, 0x000002d4, 0x0004003d,
-    0x00000006, 0x000002d5, 0x000002a9, 0x000500aa, 0x000001cc, 0x000002d6, 0x000002d5, 0x0000007e,
-    0x000300f7, 0x000002d8, 0x00000000, 0x000400fa, 0x000002d6, 0x000002d7, 0x000002e0, 0x000200f8,
-    0x000002d7, 0x0004003d, 0x00000006, 0x000002db, 0x0000027a, 0x0003003e, 0x000002da, 0x000002db,
-    0x0004003d, 0x00000006, 0x000002dd, 0x000002ad, 0x0003003e, 0x000002dc, 0x000002dd, 0x0003003e,
-    0x000002de, 0x000002d9, 0x00070039, 0x00000006, 0x000002df, 0x0000003a, 0x000002da, 0x000002dc,
-    0x000002de, 0x0003003e, 0x00000231, 0x000002df, 0x000200f9, 0x000002d8, 0x000200f8, 0x000002e0,
-    0x0004003d, 0x00000006, 0x000002e1, 0x000002a9, 0x000500aa, 0x000001cc, 0x000002e2, 0x000002e1,
-    0x000001a7, 0x000300f7, 0x000002e4, 0x00000000, 0x000400fa, 0x000002e2, 0x000002e3, 0x000002ea,
-    0x000200f8, 0x000002e3, 0x0004003d, 0x00000006, 0x000002e6, 0x0000027a, 0x0003003e, 0x000002e5,
-    0x000002e6, 0x0004003d, 0x00000006, 0x000002e8, 0x000001fd, 0x0003003e, 0x000002e7, 0x000002e8,
-    0x00060039, 0x00000006, 0x000002e9, 0x0000002f, 0x000002e5, 0x000002e7, 0x0003003e, 0x00000231,
-    0x000002e9, 0x000200f9, 0x000002e4, 0x000200f8, 0x000002ea, 0x0004003d, 0x00000006, 0x000002eb,
-    0x0000027a, 0x0003003e, 0x00000231, 0x000002eb, 0x000200f9, 0x000002e4, 0x000200f8, 0x000002e4,
-    0x000200f9, 0x000002d8, 0x000200f8, 0x000002d8, 0x000200f9, 0x000002cd, 0x000200f8, 0x000002cd,
-    0x000200f9, 0x000002bf, 0x000200f8, 0x000002bf, 0x000200f9, 0x000002a8, 0x000200f8, 0x000002a8,
-    0x000200f9, 0x00000257, 0x000200f8, 0x00000257, 0x000200f9, 0x00000245, 0x000200f8, 0x00000245,
-    0x0004003d, 0x00000006, 0x000002ec, 0x0000022d, 0x000500ab, 0x000001cc, 0x000002ed, 0x000002ec,
-    0x00000069, 0x000300f7, 0x000002ef, 0x00000000, 0x000400fa, 0x000002ed, 0x000002ee, 0x000002ef,
-    0x000200f8, 0x000002ee, 0x0004003d, 0x00000006, 0x000002f1, 0x00000223, 0x000500c2, 0x00000006,
-    0x000002f2, 0x000002f1, 0x000000af, 0x000500c7, 0x00000006, 0x000002f3, 0x000002f2, 0x0000007e,
-    0x0003003e, 0x000002f0, 0x000002f3, 0x0004003d, 0x00000006, 0x000002f5, 0x00000223, 0x000500c7,
-    0x00000006, 0x000002f6, 0x000002f5, 0x00000050, 0x0007000c, 0x00000006, 0x000002f7, 0x00000001,
-    0x00000026, 0x000002f6, 0x000000e8, 0x0003003e, 0x000002f4, 0x000002f7, 0x0004003d, 0x00000006,
-    0x000002f8, 0x000002f0, 0x000500aa, 0x000001cc, 0x000002f9, 0x000002f8, 0x0000006e, 0x000300f7,
-    0x000002fb, 0x00000000, 0x000400fa, 0x000002f9, 0x000002fa, 0x00000302, 0x000200f8, 0x000002fa,
-    0x0004003d, 0x00000006, 0x000002fd, 0x00000231, 0x0003003e, 0x000002fc, 0x000002fd, 0x0004003d,
-    0x00000006, 0x000002ff, 0x000002f4, 0x0003003e, 0x000002fe, 0x000002ff, 0x0003003e, 0x00000300,
-    0x00000069, 0x00070039, 0x00000006, 0x00000301, 0x00000035, 0x000002fc, 0x000002fe, 0x00000300,
-    0x0003003e, 0x00000231, 0x00000301, 0x000200f9, 0x000002fb, 0x000200f8, 0x00000302, 0x0004003d,
-    0x00000006, 0x00000303, 0x000002f0, 0x000500aa, 0x000001cc, 0x00000304, 0x00000303, 0x00000076,
-    0x000300f7, 0x00000306, 0x00000000, 0x000400fa, 0x00000304, 0x00000305, 0x00000306, 0x000200f8,
-    0x00000305, 0x0004003d, 0x00000006, 0x00000308, 0x00000231, 0x0003003e, 0x00000307, 0x00000308,
-    0x0004003d, 0x00000006, 0x0000030a, 0x000002f4, 0x0003003e, 0x00000309, 0x0000030a, 0x0003003e,
-    0x0000030b, 0x000002ab, 0x00070039, 0x00000006, 0x0000030c, 0x0000003a, 0x00000307, 0x00000309,
-    0x0000030b, 0x0003003e, 0x00000231, 0x0000030c, 0x000200f9, 0x00000306, 0x000200f8, 0x00000306,
-    0x000200f9, 0x000002fb, 0x000200f8, 0x000002fb, 0x000200f9, 0x000002ef, 0x000200f8, 0x000002ef,
-    0x0004003d, 0x00000006, 0x0000030f, 0x00000231, 0x0003003e, 0x0000030e, 0x0000030f, 0x00050039,
-    0x00000006, 0x00000310, 0x0000003d, 0x0000030e, 0x0003003e, 0x0000030d, 0x00000310, 0x00050041,
-    0x00000291, 0x00000312, 0x0000028f, 0x00000311, 0x0004003d, 0x00000006, 0x00000313, 0x00000312,
-    0x000500ab, 0x000001cc, 0x00000314, 0x00000313, 0x00000069, 0x000300f7, 0x00000316, 0x00000000,
-    0x000400fa, 0x00000314, 0x00000315, 0x00000343, 0x000200f8, 0x00000315, 0x0004003d, 0x00000006,
-    0x00000318, 0x0000030d, 0x000500c2, 0x00000006, 0x00000319, 0x00000318, 0x000000e8, 0x000500c7,
-    0x00000006, 0x0000031a, 0x00000319, 0x0000004b, 0x00040070, 0x00000056, 0x0000031b, 0x0000031a,
-    0x00050088, 0x00000056, 0x0000031c, 0x0000031b, 0x00000064, 0x0004003d, 0x00000006, 0x0000031d,
-    0x0000030d, 0x000500c2, 0x00000006, 0x0000031e, 0x0000031d, 0x000000af, 0x000500c7, 0x00000006,
-    0x0000031f, 0x0000031e, 0x0000004b, 0x00040070, 0x00000056, 0x00000320, 0x0000031f, 0x00050088,
-    0x00000056, 0x00000321, 0x00000320, 0x00000064, 0x0004003d, 0x00000006, 0x00000322, 0x0000030d,
-    0x000500c7, 0x00000006, 0x00000323, 0x00000322, 0x0000004b, 0x00040070, 0x00000056, 0x00000324,
-    0x00000323, 0x00050088, 0x00000056, 0x00000325, 0x00000324, 0x00000064, 0x0004003d, 0x00000006,
-    0x00000326, 0x0000030d, 0x000500c2, 0x00000006, 0x00000327, 0x00000326, 0x00000221, 0x000500c7,
-    0x00000006, 0x00000328, 0x00000327, 0x0000004b, 0x00040070, 0x00000056, 0x00000329, 0x00000328,
-    0x00050088, 0x00000056, 0x0000032a, 0x00000329, 0x00000064, 0x00070050, 0x00000057, 0x0000032b,
-    0x0000031c, 0x00000321, 0x00000325, 0x0000032a, 0x0003003e, 0x00000317, 0x0000032b, 0x0004003d,
-    0x00000006, 0x0000032c, 0x000001de, 0x000500aa, 0x000001cc, 0x0000032d, 0x0000032c, 0x00000069,
-    0x000300f7, 0x0000032f, 0x00000000, 0x000400fa, 0x0000032d, 0x0000032e, 0x00000339, 0x000200f8,
-    0x0000032e, 0x0004003d, 0x0000005a, 0x00000331, 0x00000330, 0x00050041, 0x00000007, 0x00000332,
-    0x000001c6, 0x00000069, 0x0004003d, 0x00000006, 0x00000333, 0x00000332, 0x0004007c, 0x0000000f,
-    0x00000334, 0x00000333, 0x0004003d, 0x00000006, 0x00000335, 0x000001e3, 0x0004007c, 0x0000000f,
-    0x00000336, 0x00000335, 0x00050050, 0x00000010, 0x00000337, 0x00000334, 0x00000336, 0x0004003d,
-    0x00000057, 0x00000338, 0x00000317, 0x00040063, 0x00000331, 0x00000337, 0x00000338, 0x000200f9,
-    0x0000032f, 0x000200f8, 0x00000339, 0x0004003d, 0x0000005a, 0x0000033b, 0x0000033a, 0x00050041,
-    0x00000007, 0x0000033c, 0x000001c6, 0x00000069, 0x0004003d, 0x00000006, 0x0000033d, 0x0000033c,
-    0x0004007c, 0x0000000f, 0x0000033e, 0x0000033d, 0x0004003d, 0x00000006, 0x0000033f, 0x000001e3,
-    0x0004007c, 0x0000000f, 0x00000340, 0x0000033f, 0x00050050, 0x00000010, 0x00000341, 0x0000033e,
-    0x00000340, 0x0004003d, 0x00000057, 0x00000342, 0x00000317, 0x00040063, 0x0000033b, 0x00000341,
-    0x00000342, 0x000200f9, 0x0000032f, 0x000200f8, 0x0000032f, 0x000200f9, 0x00000316, 0x000200f8,
-    0x00000343, 0x0004003d, 0x00000006, 0x00000348, 0x000001de, 0x00050084, 0x00000006, 0x0000034b,
-    0x00000348, 0x0000034a, 0x0004003d, 0x00000006, 0x0000034c, 0x000001e3, 0x00050084, 0x00000006,
-    0x0000034e, 0x0000034c, 0x0000034d, 0x00050080, 0x00000006, 0x0000034f, 0x0000034b, 0x0000034e,
-    0x00050041, 0x00000007, 0x00000350, 0x000001c6, 0x00000069, 0x0004003d, 0x00000006, 0x00000351,
-    0x00000350, 0x00050080, 0x00000006, 0x00000352, 0x0000034f, 0x00000351, 0x0004003d, 0x00000006,
-    0x00000353, 0x0000030d, 0x00060041, 0x000001c1, 0x00000354, 0x00000347, 0x000001bb, 0x00000352,
-    0x0003003e, 0x00000354, 0x00000353, 0x000200f9, 0x00000316, 0x000200f8, 0x00000316, 0x000100fd,
-    0x00010038, 0x00050036, 0x00000006, 0x0000000a, 0x00000000, 0x00000008, 0x00030037, 0x00000007,
-    0x00000009, 0x000200f8, 0x0000000b, 0x0004003d, 0x00000006, 0x00000046, 0x00000009, 0x00050084,
-    0x00000006, 0x00000048, 0x00000046, 0x00000047, 0x00050080, 0x00000006, 0x0000004a, 0x00000048,
-    0x00000049, 0x00050086, 0x00000006, 0x0000004c, 0x0000004a, 0x0000004b, 0x000200fe, 0x0000004c,
-    0x00010038, 0x00050036, 0x00000006, 0x0000000d, 0x00000000, 0x00000008, 0x00030037, 0x00000007,
-    0x0000000c, 0x000200f8, 0x0000000e, 0x0004003d, 0x00000006, 0x0000004f, 0x0000000c, 0x00050084,
-    0x00000006, 0x00000051, 0x0000004f, 0x00000050, 0x00050080, 0x00000006, 0x00000052, 0x00000051,
-    0x00000049, 0x00050086, 0x00000006, 0x00000053, 0x00000052, 0x0000004b, 0x000200fe, 0x00000053,
-    0x00010038, 0x00050036, 0x00000006, 0x00000014, 0x00000000, 0x00000012, 0x00030037, 0x00000011,
-    0x00000013, 0x000200f8, 0x00000015, 0x0004003b, 0x00000058, 0x00000059, 0x00000007, 0x0004003b,
-    0x00000061, 0x00000062, 0x00000007, 0x0004003b, 0x00000007, 0x00000068, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000006d, 0x00000007, 0x0004003b, 0x00000007, 0x00000075, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000007d, 0x00000007, 0x0004003d, 0x0000005a, 0x0000005d, 0x0000005c, 0x0004003d,
-    0x00000010, 0x0000005e, 0x00000013, 0x00050062, 0x00000057, 0x0000005f, 0x0000005d, 0x0000005e,
-    0x0003003e, 0x00000059, 0x0000005f, 0x0004003d, 0x00000057, 0x00000063, 0x00000059, 0x0005008e,
-    0x00000057, 0x00000065, 0x00000063, 0x00000064, 0x0006000c, 0x00000057, 0x00000066, 0x00000001,
-    0x00000001, 0x00000065, 0x0004006d, 0x00000060, 0x00000067, 0x00000066, 0x0003003e, 0x00000062,
-    0x00000067, 0x00050041, 0x00000007, 0x0000006a, 0x00000062, 0x00000069, 0x0004003d, 0x00000006,
-    0x0000006b, 0x0000006a, 0x0003003e, 0x00000068, 0x0000006b, 0x00050039, 0x00000006, 0x0000006c,
-    0x0000000a, 0x00000068, 0x00050041, 0x00000007, 0x0000006f, 0x00000062, 0x0000006e, 0x0004003d,
-    0x00000006, 0x00000070, 0x0000006f, 0x0003003e, 0x0000006d, 0x00000070, 0x00050039, 0x00000006,
-    0x00000071, 0x0000000a, 0x0000006d, 0x000500c4, 0x00000006, 0x00000073, 0x00000071, 0x00000072,
-    0x000500c5, 0x00000006, 0x00000074, 0x0000006c, 0x00000073, 0x00050041, 0x00000007, 0x00000077,
-    0x00000062, 0x00000076, 0x0004003d, 0x00000006, 0x00000078, 0x00000077, 0x0003003e, 0x00000075,
-    0x00000078, 0x00050039, 0x00000006, 0x00000079, 0x0000000a, 0x00000075, 0x000500c4, 0x00000006,
-    0x0000007b, 0x00000079, 0x0000007a, 0x000500c5, 0x00000006, 0x0000007c, 0x00000074, 0x0000007b,
-    0x00050041, 0x00000007, 0x0000007f, 0x00000062, 0x0000007e, 0x0004003d, 0x00000006, 0x00000080,
-    0x0000007f, 0x0003003e, 0x0000007d, 0x00000080, 0x00050039, 0x00000006, 0x00000081, 0x0000000d,
-    0x0000007d, 0x000500c4, 0x00000006, 0x00000083, 0x00000081, 0x00000082, 0x000500c5, 0x00000006,
-    0x00000084, 0x0000007c, 0x00000083, 0x000200fe, 0x00000084, 0x00010038, 0x00050036, 0x00000006,
-    0x00000017, 0x00000000, 0x00000008, 0x00030037, 0x00000007, 0x00000016, 0x000200f8, 0x00000018,
-    0x0004003d, 0x00000006, 0x00000087, 0x00000016, 0x000500c7, 0x00000006, 0x00000088, 0x00000087,
-    0x00000047, 0x000200fe, 0x00000088, 0x00010038, 0x00050036, 0x00000006, 0x0000001a, 0x00000000,
-    0x00000008, 0x00030037, 0x00000007, 0x00000019, 0x000200f8, 0x0000001b, 0x0004003d, 0x00000006,
-    0x0000008b, 0x00000019, 0x000500c2, 0x00000006, 0x0000008c, 0x0000008b, 0x00000072, 0x000500c7,
-    0x00000006, 0x0000008d, 0x0000008c, 0x00000047, 0x000200fe, 0x0000008d, 0x00010038, 0x00050036,
-    0x00000006, 0x0000001d, 0x00000000, 0x00000008, 0x00030037, 0x00000007, 0x0000001c, 0x000200f8,
-    0x0000001e, 0x0004003d, 0x00000006, 0x00000090, 0x0000001c, 0x000500c2, 0x00000006, 0x00000091,
-    0x00000090, 0x0000007a, 0x000500c7, 0x00000006, 0x00000092, 0x00000091, 0x00000047, 0x000200fe,
-    0x00000092, 0x00010038, 0x00050036, 0x00000006, 0x00000024, 0x00000000, 0x0000001f, 0x00030037,
-    0x00000007, 0x00000020, 0x00030037, 0x00000007, 0x00000021, 0x00030037, 0x00000007, 0x00000022,
-    0x00030037, 0x00000007, 0x00000023, 0x000200f8, 0x00000025, 0x0004003d, 0x00000006, 0x00000095,
-    0x00000020, 0x0007000c, 0x00000006, 0x00000096, 0x00000001, 0x00000026, 0x00000095, 0x00000047,
-    0x0004003d, 0x00000006, 0x00000097, 0x00000021, 0x0007000c, 0x00000006, 0x00000098, 0x00000001,
-    0x00000026, 0x00000097, 0x00000047, 0x000500c4, 0x00000006, 0x00000099, 0x00000098, 0x00000072,
-    0x000500c5, 0x00000006, 0x0000009a, 0x00000096, 0x00000099, 0x0004003d, 0x00000006, 0x0000009b,
-    0x00000022, 0x0007000c, 0x00000006, 0x0000009c, 0x00000001, 0x00000026, 0x0000009b, 0x00000047,
-    0x000500c4, 0x00000006, 0x0000009d, 0x0000009c, 0x0000007a, 0x000500c5, 0x00000006, 0x0000009e,
-    0x0000009a, 0x0000009d, 0x0004003d, 0x00000006, 0x0000009f, 0x00000023, 0x000500c4, 0x00000006,
-    0x000000a0, 0x0000009f, 0x00000082, 0x000500c5, 0x00000006, 0x000000a1, 0x0000009e, 0x000000a0,
-    0x000200fe, 0x000000a1, 0x00010038, 0x00050036, 0x00000006, 0x0000002a, 0x00000000, 0x0000001f,
-    0x00030037, 0x00000007, 0x00000026, 0x00030037, 0x00000007, 0x00000027, 0x00030037, 0x00000007,
-    0x00000028, 0x00030037, 0x00000007, 0x00000029, 0x000200f8, 0x0000002b, 0x0004003b, 0x00000007,
-    0x000000a4, 0x00000007, 0x0004003b, 0x00000007, 0x000000a9, 0x00000007, 0x0004003b, 0x00000007,
-    0x000000b3, 0x00000007, 0x0004003b, 0x00000007, 0x000000b8, 0x00000007, 0x0004003b, 0x00000007,
-    0x000000c0, 0x00000007, 0x0004003b, 0x00000007, 0x000000c5, 0x00000007, 0x0004003b, 0x00000007,
-    0x000000cd, 0x00000007, 0x0004003b, 0x00000007, 0x000000ce, 0x00000007, 0x0004003b, 0x00000007,
-    0x000000cf, 0x00000007, 0x0004003b, 0x00000007, 0x000000d0, 0x00000007, 0x0004003d, 0x00000006,
-    0x000000a5, 0x00000026, 0x0003003e, 0x000000a4, 0x000000a5, 0x00050039, 0x00000006, 0x000000a6,
-    0x00000017, 0x000000a4, 0x0004003d, 0x00000006, 0x000000a7, 0x00000028, 0x00050084, 0x00000006,
-    0x000000a8, 0x000000a6, 0x000000a7, 0x0004003d, 0x00000006, 0x000000aa, 0x00000027, 0x0003003e,
-    0x000000a9, 0x000000aa, 0x00050039, 0x00000006, 0x000000ab, 0x00000017, 0x000000a9, 0x0004003d,
-    0x00000006, 0x000000ac, 0x00000029, 0x00050084, 0x00000006, 0x000000ad, 0x000000ab, 0x000000ac,
-    0x00050080, 0x00000006, 0x000000ae, 0x000000a8, 0x000000ad, 0x00050080, 0x00000006, 0x000000b0,
-    0x000000ae, 0x000000af, 0x000500c2, 0x00000006, 0x000000b2, 0x000000b0, 0x000000b1, 0x0004003d,
-    0x00000006, 0x000000b4, 0x00000026, 0x0003003e, 0x000000b3, 0x000000b4, 0x00050039, 0x00000006,
-    0x000000b5, 0x0000001a, 0x000000b3, 0x0004003d, 0x00000006, 0x000000b6, 0x00000028, 0x00050084,
-    0x00000006, 0x000000b7, 0x000000b5, 0x000000b6, 0x0004003d, 0x00000006, 0x000000b9, 0x00000027,
-    0x0003003e, 0x000000b8, 0x000000b9, 0x00050039, 0x00000006, 0x000000ba, 0x0000001a, 0x000000b8,
-    0x0004003d, 0x00000006, 0x000000bb, 0x00000029, 0x00050084, 0x00000006, 0x000000bc, 0x000000ba,
-    0x000000bb, 0x00050080, 0x00000006, 0x000000bd, 0x000000b7, 0x000000bc, 0x00050080, 0x00000006,
-    0x000000be, 0x000000bd, 0x000000af, 0x000500c2, 0x00000006, 0x000000bf, 0x000000be, 0x000000b1,
-    0x0004003d, 0x00000006, 0x000000c1, 0x00000026, 0x0003003e, 0x000000c0, 0x000000c1, 0x00050039,
-    0x00000006, 0x000000c2, 0x0000001d, 0x000000c0, 0x0004003d, 0x00000006, 0x000000c3, 0x00000028,
-    0x00050084, 0x00000006, 0x000000c4, 0x000000c2, 0x000000c3, 0x0004003d, 0x00000006, 0x000000c6,
-    0x00000027, 0x0003003e, 0x000000c5, 0x000000c6, 0x00050039, 0x00000006, 0x000000c7, 0x0000001d,
-    0x000000c5, 0x0004003d, 0x00000006, 0x000000c8, 0x00000029, 0x00050084, 0x00000006, 0x000000c9,
-    0x000000c7, 0x000000c8, 0x00050080, 0x00000006, 0x000000ca, 0x000000c4, 0x000000c9, 0x00050080,
-    0x00000006, 0x000000cb, 0x000000ca, 0x000000af, 0x000500c2, 0x00000006, 0x000000cc, 0x000000cb,
-    0x000000b1, 0x0003003e, 0x000000cd, 0x000000b2, 0x0003003e, 0x000000ce, 0x000000bf, 0x0003003e,
-    0x000000cf, 0x000000cc, 0x0003003e, 0x000000d0, 0x0000004b, 0x00080039, 0x00000006, 0x000000d1,
-    0x00000024, 0x000000cd, 0x000000ce, 0x000000cf, 0x000000d0, 0x000200fe, 0x000000d1, 0x00010038,
-    0x00050036, 0x00000006, 0x0000002f, 0x00000000, 0x0000002c, 0x00030037, 0x00000007, 0x0000002d,
-    0x00030037, 0x00000007, 0x0000002e, 0x000200f8, 0x00000030, 0x0004003b, 0x00000007, 0x000000d4,
-    0x00000007, 0x0004003b, 0x00000007, 0x000000d9, 0x00000007, 0x0004003b, 0x00000007, 0x000000dd,
-    0x00000007, 0x0004003b, 0x00000007, 0x000000e2, 0x00000007, 0x0004003b, 0x00000007, 0x000000ec,
-    0x00000007, 0x0004003b, 0x00000007, 0x000000f1, 0x00000007, 0x0004003b, 0x00000007, 0x000000f9,
-    0x00000007, 0x0004003b, 0x00000007, 0x000000fe, 0x00000007, 0x0004003b, 0x00000007, 0x00000106,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000107, 0x00000007, 0x0004003b, 0x00000007, 0x00000108,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000109, 0x00000007, 0x0004003d, 0x00000006, 0x000000d5,
-    0x0000002d, 0x000500c2, 0x00000006, 0x000000d6, 0x000000d5, 0x00000082, 0x000500c7, 0x00000006,
-    0x000000d7, 0x000000d6, 0x00000050, 0x00050080, 0x00000006, 0x000000d8, 0x000000d7, 0x0000006e,
-    0x0003003e, 0x000000d4, 0x000000d8, 0x0004003d, 0x00000006, 0x000000db, 0x000000d4, 0x00050082,
-    0x00000006, 0x000000dc, 0x000000da, 0x000000db, 0x0003003e, 0x000000d9, 0x000000dc, 0x0004003d,
-    0x00000006, 0x000000de, 0x0000002d, 0x0003003e, 0x000000dd, 0x000000de, 0x00050039, 0x00000006,
-    0x000000df, 0x00000017, 0x000000dd, 0x0004003d, 0x00000006, 0x000000e0, 0x000000d4, 0x00050084,
-    0x00000006, 0x000000e1, 0x000000df, 0x000000e0, 0x0004003d, 0x00000006, 0x000000e3, 0x0000002e,
-    0x0003003e, 0x000000e2, 0x000000e3, 0x00050039, 0x00000006, 0x000000e4, 0x00000017, 0x000000e2,
-    0x0004003d, 0x00000006, 0x000000e5, 0x000000d9, 0x00050084, 0x00000006, 0x000000e6, 0x000000e4,
-    0x000000e5, 0x00050080, 0x00000006, 0x000000e7, 0x000000e1, 0x000000e6, 0x00050080, 0x00000006,
-    0x000000e9, 0x000000e7, 0x000000e8, 0x000500c2, 0x00000006, 0x000000eb, 0x000000e9, 0x000000ea,
-    0x0004003d, 0x00000006, 0x000000ed, 0x0000002d, 0x0003003e, 0x000000ec, 0x000000ed, 0x00050039,
-    0x00000006, 0x000000ee, 0x0000001a, 0x000000ec, 0x0004003d, 0x00000006, 0x000000ef, 0x000000d4,
-    0x00050084, 0x00000006, 0x000000f0, 0x000000ee, 0x000000ef, 0x0004003d, 0x00000006, 0x000000f2,
-    0x0000002e, 0x0003003e, 0x000000f1, 0x000000f2, 0x00050039, 0x00000006, 0x000000f3, 0x0000001a,
-    0x000000f1, 0x0004003d, 0x00000006, 0x000000f4, 0x000000d9, 0x00050084, 0x00000006, 0x000000f5,
-    0x000000f3, 0x000000f4, 0x00050080, 0x00000006, 0x000000f6, 0x000000f0, 0x000000f5, 0x00050080,
-    0x00000006, 0x000000f7, 0x000000f6, 0x000000e8, 0x000500c2, 0x00000006, 0x000000f8, 0x000000f7,
-    0x000000ea, 0x0004003d, 0x00000006, 0x000000fa, 0x0000002d, 0x0003003e, 0x000000f9, 0x000000fa,
-    0x00050039, 0x00000006, 0x000000fb, 0x0000001d, 0x000000f9, 0x0004003d, 0x00000006, 0x000000fc,
-    0x000000d4, 0x00050084, 0x00000006, 0x000000fd, 0x000000fb, 0x000000fc, 0x0004003d, 0x00000006,
-    0x000000ff, 0x0000002e, 0x0003003e, 0x000000fe, 0x000000ff, 0x00050039, 0x00000006, 0x00000100,
-    0x0000001d, 0x000000fe, 0x0004003d, 0x00000006, 0x00000101, 0x000000d9, 0x00050084, 0x00000006,
-    0x00000102, 0x00000100, 0x00000101, 0x00050080, 0x00000006, 0x00000103, 0x000000fd, 0x00000102,
-    0x00050080, 0x00000006, 0x00000104, 0x00000103, 0x000000e8, 0x000500c2, 0x00000006, 0x00000105,
-    0x00000104, 0x000000ea, 0x0003003e, 0x00000106, 0x000000eb, 0x0003003e, 0x00000107, 0x000000f8,
-    0x0003003e, 0x00000108, 0x00000105, 0x0003003e, 0x00000109, 0x0000004b, 0x00080039, 0x00000006,
-    0x0000010a, 0x00000024, 0x00000106, 0x00000107, 0x00000108, 0x00000109, 0x000200fe, 0x0000010a,
-    0x00010038, 0x00050036, 0x00000006, 0x00000035, 0x00000000, 0x00000031, 0x00030037, 0x00000007,
-    0x00000032, 0x00030037, 0x00000007, 0x00000033, 0x00030037, 0x00000007, 0x00000034, 0x000200f8,
-    0x00000036, 0x0004003b, 0x00000007, 0x0000010d, 0x00000007, 0x0004003b, 0x00000007, 0x00000110,
-    0x00000007, 0x0004003b, 0x00000007, 0x0000011a, 0x00000007, 0x0004003b, 0x00000007, 0x0000011d,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000127, 0x00000007, 0x0004003b, 0x00000007, 0x0000012a,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000134, 0x00000007, 0x0004003b, 0x00000007, 0x00000135,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000136, 0x00000007, 0x0004003b, 0x00000007, 0x00000137,
-    0x00000007, 0x0004003d, 0x00000006, 0x0000010e, 0x00000032, 0x0003003e, 0x0000010d, 0x0000010e,
-    0x00050039, 0x00000006, 0x0000010f, 0x00000017, 0x0000010d, 0x0004003d, 0x00000006, 0x00000111,
-    0x00000032, 0x0003003e, 0x00000110, 0x00000111, 0x00050039, 0x00000006, 0x00000112, 0x00000017,
-    0x00000110, 0x00050082, 0x00000006, 0x00000113, 0x00000047, 0x00000112, 0x0004003d, 0x00000006,
-    0x00000114, 0x00000033, 0x00050084, 0x00000006, 0x00000115, 0x00000113, 0x00000114, 0x0004003d,
-    0x00000006, 0x00000116, 0x00000034, 0x00050080, 0x00000006, 0x00000117, 0x00000115, 0x00000116,
-    0x000500c2, 0x00000006, 0x00000118, 0x00000117, 0x000000b1, 0x00050080, 0x00000006, 0x00000119,
-    0x0000010f, 0x00000118, 0x0004003d, 0x00000006, 0x0000011b, 0x00000032, 0x0003003e, 0x0000011a,
-    0x0000011b, 0x00050039, 0x00000006, 0x0000011c, 0x0000001a, 0x0000011a, 0x0004003d, 0x00000006,
-    0x0000011e, 0x00000032, 0x0003003e, 0x0000011d, 0x0000011e, 0x00050039, 0x00000006, 0x0000011f,
-    0x0000001a, 0x0000011d, 0x00050082, 0x00000006, 0x00000120, 0x00000047, 0x0000011f, 0x0004003d,
-    0x00000006, 0x00000121, 0x00000033, 0x00050084, 0x00000006, 0x00000122, 0x00000120, 0x00000121,
-    0x0004003d, 0x00000006, 0x00000123, 0x00000034, 0x00050080, 0x00000006, 0x00000124, 0x00000122,
-    0x00000123, 0x000500c2, 0x00000006, 0x00000125, 0x00000124, 0x000000b1, 0x00050080, 0x00000006,
-    0x00000126, 0x0000011c, 0x00000125, 0x0004003d, 0x00000006, 0x00000128, 0x00000032, 0x0003003e,
-    0x00000127, 0x00000128, 0x00050039, 0x00000006, 0x00000129, 0x0000001d, 0x00000127, 0x0004003d,
-    0x00000006, 0x0000012b, 0x00000032, 0x0003003e, 0x0000012a, 0x0000012b, 0x00050039, 0x00000006,
-    0x0000012c, 0x0000001d, 0x0000012a, 0x00050082, 0x00000006, 0x0000012d, 0x00000047, 0x0000012c,
-    0x0004003d, 0x00000006, 0x0000012e, 0x00000033, 0x00050084, 0x00000006, 0x0000012f, 0x0000012d,
-    0x0000012e, 0x0004003d, 0x00000006, 0x00000130, 0x00000034, 0x00050080, 0x00000006, 0x00000131,
-    0x0000012f, 0x00000130, 0x000500c2, 0x00000006, 0x00000132, 0x00000131, 0x000000b1, 0x00050080,
-    0x00000006, 0x00000133, 0x00000129, 0x00000132, 0x0003003e, 0x00000134, 0x00000119, 0x0003003e,
-    0x00000135, 0x00000126, 0x0003003e, 0x00000136, 0x00000133, 0x0003003e, 0x00000137, 0x0000004b,
-    0x00080039, 0x00000006, 0x00000138, 0x00000024, 0x00000134, 0x00000135, 0x00000136, 0x00000137,
-    0x000200fe, 0x00000138, 0x00010038, 0x00050036, 0x00000006, 0x0000003a, 0x00000000, 0x00000031,
-    0x00030037, 0x00000007, 0x00000037, 0x00030037, 0x00000007, 0x00000038, 0x00030037, 0x00000007,
-    0x00000039, 0x000200f8, 0x0000003b, 0x0004003b, 0x00000007, 0x0000013b, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000013e, 0x00000007, 0x0004003b, 0x00000007, 0x00000147, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000014a, 0x00000007, 0x0004003b, 0x00000007, 0x00000153, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000156, 0x00000007, 0x0004003b, 0x00000007, 0x0000015f, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000160, 0x00000007, 0x0004003b, 0x00000007, 0x00000161, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000162, 0x00000007, 0x0004003d, 0x00000006, 0x0000013c, 0x00000037, 0x0003003e,
-    0x0000013b, 0x0000013c, 0x00050039, 0x00000006, 0x0000013d, 0x00000017, 0x0000013b, 0x0004003d,
-    0x00000006, 0x0000013f, 0x00000037, 0x0003003e, 0x0000013e, 0x0000013f, 0x00050039, 0x00000006,
-    0x00000140, 0x00000017, 0x0000013e, 0x0004003d, 0x00000006, 0x00000141, 0x00000038, 0x00050084,
-    0x00000006, 0x00000142, 0x00000140, 0x00000141, 0x0004003d, 0x00000006, 0x00000143, 0x00000039,
-    0x00050080, 0x00000006, 0x00000144, 0x00000142, 0x00000143, 0x000500c2, 0x00000006, 0x00000145,
-    0x00000144, 0x000000b1, 0x00050082, 0x00000006, 0x00000146, 0x0000013d, 0x00000145, 0x0004003d,
-    0x00000006, 0x00000148, 0x00000037, 0x0003003e, 0x00000147, 0x00000148, 0x00050039, 0x00000006,
-    0x00000149, 0x0000001a, 0x00000147, 0x0004003d, 0x00000006, 0x0000014b, 0x00000037, 0x0003003e,
-    0x0000014a, 0x0000014b, 0x00050039, 0x00000006, 0x0000014c, 0x0000001a, 0x0000014a, 0x0004003d,
-    0x00000006, 0x0000014d, 0x00000038, 0x00050084, 0x00000006, 0x0000014e, 0x0000014c, 0x0000014d,
-    0x0004003d, 0x00000006, 0x0000014f, 0x00000039, 0x00050080, 0x00000006, 0x00000150, 0x0000014e,
-    0x0000014f, 0x000500c2, 0x00000006, 0x00000151, 0x00000150, 0x000000b1, 0x00050082, 0x00000006,
-    0x00000152, 0x00000149, 0x00000151, 0x0004003d, 0x00000006, 0x00000154, 0x00000037, 0x0003003e,
-    0x00000153, 0x00000154, 0x00050039, 0x00000006, 0x00000155, 0x0000001d, 0x00000153, 0x0004003d,
-    0x00000006, 0x00000157, 0x00000037, 0x0003003e, 0x00000156, 0x00000157, 0x00050039, 0x00000006,
-    0x00000158, 0x0000001d, 0x00000156, 0x0004003d, 0x00000006, 0x00000159, 0x00000038, 0x00050084,
-    0x00000006, 0x0000015a, 0x00000158, 0x00000159, 0x0004003d, 0x00000006, 0x0000015b, 0x00000039,
-    0x00050080, 0x00000006, 0x0000015c, 0x0000015a, 0x0000015b, 0x000500c2, 0x00000006, 0x0000015d,
-    0x0000015c, 0x000000b1, 0x00050082, 0x00000006, 0x0000015e, 0x00000155, 0x0000015d, 0x0003003e,
-    0x0000015f, 0x00000146, 0x0003003e, 0x00000160, 0x00000152, 0x0003003e, 0x00000161, 0x0000015e,
-    0x0003003e, 0x00000162, 0x0000004b, 0x00080039, 0x00000006, 0x00000163, 0x00000024, 0x0000015f,
-    0x00000160, 0x00000161, 0x00000162, 0x000200fe, 0x00000163, 0x00010038, 0x00050036, 0x00000006,
-    0x0000003d, 0x00000000, 0x00000008, 0x00030037, 0x00000007, 0x0000003c, 0x000200f8, 0x0000003e,
-    0x0004003b, 0x00000007, 0x00000166, 0x00000007, 0x0004003b, 0x00000007, 0x00000167, 0x00000007,
-    0x0004003b, 0x00000007, 0x0000016a, 0x00000007, 0x0004003b, 0x00000007, 0x0000016b, 0x00000007,
-    0x0004003b, 0x00000007, 0x0000016e, 0x00000007, 0x0004003b, 0x00000007, 0x0000016f, 0x00000007,
-    0x0004003b, 0x00000007, 0x00000172, 0x00000007, 0x0004003b, 0x00000007, 0x00000179, 0x00000007,
-    0x0004003b, 0x00000007, 0x0000017f, 0x00000007, 0x0004003d, 0x00000006, 0x00000168, 0x0000003c,
-    0x0003003e, 0x00000167, 0x00000168, 0x00050039, 0x00000006, 0x00000169, 0x00000017, 0x00000167,
-    0x0003003e, 0x00000166, 0x00000169, 0x0004003d, 0x00000006, 0x0000016c, 0x0000003c, 0x0003003e,
-    0x0000016b, 0x0000016c, 0x00050039, 0x00000006, 0x0000016d, 0x0000001a, 0x0000016b, 0x0003003e,
-    0x0000016a, 0x0000016d, 0x0004003d, 0x00000006, 0x00000170, 0x0000003c, 0x0003003e, 0x0000016f,
-    0x00000170, 0x00050039, 0x00000006, 0x00000171, 0x0000001d, 0x0000016f, 0x0003003e, 0x0000016e,
-    0x00000171, 0x0004003d, 0x00000006, 0x00000173, 0x00000166, 0x000500c4, 0x00000006, 0x00000175,
-    0x00000173, 0x00000174, 0x0004003d, 0x00000006, 0x00000176, 0x00000166, 0x000500c2, 0x00000006,
-    0x00000177, 0x00000176, 0x000000b1, 0x000500c5, 0x00000006, 0x00000178, 0x00000175, 0x00000177,
-    0x0003003e, 0x00000172, 0x00000178, 0x0004003d, 0x00000006, 0x0000017a, 0x0000016a, 0x000500c4,
-    0x00000006, 0x0000017b, 0x0000017a, 0x00000174, 0x0004003d, 0x00000006, 0x0000017c, 0x0000016a,
-    0x000500c2, 0x00000006, 0x0000017d, 0x0000017c, 0x000000b1, 0x000500c5, 0x00000006, 0x0000017e,
-    0x0000017b, 0x0000017d, 0x0003003e, 0x00000179, 0x0000017e, 0x0004003d, 0x00000006, 0x00000180,
-    0x0000016e, 0x000500c4, 0x00000006, 0x00000181, 0x00000180, 0x00000174, 0x0004003d, 0x00000006,
-    0x00000182, 0x0000016e, 0x000500c2, 0x00000006, 0x00000183, 0x00000182, 0x000000b1, 0x000500c5,
-    0x00000006, 0x00000184, 0x00000181, 0x00000183, 0x0003003e, 0x0000017f, 0x00000184, 0x0004003d,
-    0x00000006, 0x00000185, 0x0000017f, 0x0004003d, 0x00000006, 0x00000186, 0x00000179, 0x000500c4,
-    0x00000006, 0x00000187, 0x00000186, 0x00000072, 0x000500c5, 0x00000006, 0x00000188, 0x00000185,
-    0x00000187, 0x0004003d, 0x00000006, 0x00000189, 0x00000172, 0x000500c4, 0x00000006, 0x0000018a,
-    0x00000189, 0x0000007a, 0x000500c5, 0x00000006, 0x0000018b, 0x00000188, 0x0000018a, 0x000500c5,
-    0x00000006, 0x0000018d, 0x0000018b, 0x0000018c, 0x000200fe, 0x0000018d, 0x00010038, 0x00050036,
-    0x00000006, 0x00000044, 0x00000000, 0x00000041, 0x00030037, 0x00000007, 0x00000042, 0x00030037,
-    0x00000040, 0x00000043, 0x000200f8, 0x00000045, 0x0004003b, 0x00000007, 0x00000190, 0x00000007,
-    0x0004003b, 0x00000007, 0x00000194, 0x00000007, 0x0004003b, 0x00000007, 0x00000199, 0x00000007,
-    0x0004003b, 0x00000007, 0x0000019e, 0x00000007, 0x0004003b, 0x00000007, 0x000001a5, 0x00000007,
-    0x0004003b, 0x00000007, 0x000001af, 0x00000007, 0x0004003d, 0x00000006, 0x00000191, 0x00000042,
-    0x000500c7, 0x00000006, 0x00000193, 0x00000191, 0x00000192, 0x0003003e, 0x00000190, 0x00000193,
-    0x0004003d, 0x00000006, 0x00000195, 0x00000042, 0x000500c2, 0x00000006, 0x00000197, 0x00000195,
-    0x00000196, 0x000500c7, 0x00000006, 0x00000198, 0x00000197, 0x0000007e, 0x0003003e, 0x00000194,
-    0x00000198, 0x0004003d, 0x00000006, 0x0000019a, 0x00000042, 0x000500c2, 0x00000006, 0x0000019c,
-    0x0000019a, 0x0000019b, 0x000500c7, 0x00000006, 0x0000019d, 0x0000019c, 0x0000006e, 0x0003003e,
-    0x00000199, 0x0000019d, 0x0003003e, 0x0000019e, 0x000001a4, 0x0004003d, 0x00000006, 0x000001a6,
-    0x00000199, 0x00050084, 0x00000006, 0x000001a8, 0x000001a6, 0x000001a7, 0x0004003d, 0x00000006,
-    0x000001a9, 0x00000194, 0x00050080, 0x00000006, 0x000001aa, 0x000001a8, 0x000001a9, 0x00050084,
-    0x00000006, 0x000001ac, 0x000001aa, 0x000001ab, 0x0004003d, 0x00000006, 0x000001ad, 0x00000190,
-    0x00050080, 0x00000006, 0x000001ae, 0x000001ac, 0x000001ad, 0x0003003e, 0x000001a5, 0x000001ae,
-    0x00050041, 0x00000007, 0x000001b0, 0x00000043, 0x0000006e, 0x0004003d, 0x00000006, 0x000001b1,
-    0x000001b0, 0x00050084, 0x00000006, 0x000001b3, 0x000001b1, 0x000001b2, 0x00050041, 0x00000007,
-    0x000001b4, 0x00000043, 0x00000069, 0x0004003d, 0x00000006, 0x000001b5, 0x000001b4, 0x00050080,
-    0x00000006, 0x000001b6, 0x000001b3, 0x000001b5, 0x0003003e, 0x000001af, 0x000001b6, 0x0004003d,
-    0x00000006, 0x000001bc, 0x000001a5, 0x0004003d, 0x00000006, 0x000001bd, 0x0000019e, 0x00050084,
-    0x00000006, 0x000001be, 0x000001bc, 0x000001bd, 0x0004003d, 0x00000006, 0x000001bf, 0x000001af,
-    0x00050080, 0x00000006, 0x000001c0, 0x000001be, 0x000001bf, 0x00060041, 0x000001c1, 0x000001c2,
-    0x000001ba, 0x000001bb, 0x000001c0, 0x0004003d, 0x00000006, 0x000001c3, 0x000001c2, 0x000200fe,
-    0x000001c3, 0x00010038,
+const uint8_t Blob111_Data[5586] =
+{
+    0x28, 0xb5, 0x2f, 0xfd, 0x60, 0x68, 0x54, 0x45, 0xae, 0x00, 0x6a, 0xc2, 0x60, 0x2f, 0x37, 0x10,
+    0x80, 0xad, 0xc6, 0xa3, 0x08, 0xd0, 0x67, 0x70, 0xfa, 0xef, 0x6e, 0x1c, 0x50, 0x89, 0xeb, 0xbb,
+    0xf4, 0xff, 0xff, 0xcf, 0xcd, 0xe0, 0xdc, 0xee, 0xd2, 0x84, 0xe4, 0x24, 0x89, 0x09, 0x49, 0x91,
+    0x8f, 0xed, 0x84, 0x49, 0xac, 0x6d, 0xdb, 0xb6, 0x6d, 0xcd, 0xd3, 0xb6, 0x5c, 0xd5, 0x79, 0x9b,
+    0x79, 0x23, 0x95, 0x48, 0x29, 0x53, 0x9e, 0x02, 0xd6, 0x02, 0x11, 0x03, 0xba, 0x5f, 0x36, 0x2c,
+    0xf8, 0x79, 0x81, 0x9f, 0xf7, 0x1d, 0xee, 0x5f, 0xc0, 0xc4, 0xdb, 0x80, 0x1f, 0xce, 0xcd, 0xb5,
+    0x78, 0xdd, 0xdd, 0x5f, 0x7f, 0x2a, 0xd6, 0x71, 0x2c, 0x1d, 0xe2, 0x57, 0x2c, 0xfe, 0xc6, 0xa5,
+    0x81, 0xbf, 0x7d, 0xe2, 0xb1, 0xde, 0xdc, 0xd7, 0xdb, 0xda, 0xee, 0x5e, 0x2d, 0xd2, 0x12, 0x09,
+    0x01, 0x49, 0xeb, 0x07, 0xed, 0x63, 0xe7, 0x5f, 0x2b, 0x67, 0x4d, 0x1a, 0xcd, 0xcc, 0x30, 0x59,
+    0xae, 0x60, 0x5a, 0x3a, 0xa9, 0xa4, 0xa4, 0x25, 0x71, 0x1e, 0x5f, 0xeb, 0x88, 0x90, 0x31, 0xb6,
+    0x1f, 0x9e, 0x7b, 0x83, 0xb3, 0xd2, 0x1f, 0x3c, 0x4c, 0x48, 0xa8, 0x27, 0x68, 0x7f, 0xf8, 0xee,
+    0x47, 0xda, 0x17, 0x7d, 0x3e, 0xf0, 0xbd, 0xd7, 0xf4, 0x27, 0xe2, 0x7d, 0x73, 0xbe, 0xdf, 0x7f,
+    0xfb, 0x58, 0x2e, 0x2c, 0x0e, 0xeb, 0x5f, 0xb9, 0xc2, 0xf0, 0x18, 0xdb, 0xe1, 0x6d, 0x0d, 0x18,
+    0xe6, 0xc4, 0xc0, 0x8b, 0xdb, 0x7d, 0xfc, 0x0d, 0x67, 0xb1, 0x89, 0x81, 0x34, 0x16, 0x7c, 0x60,
+    0x0b, 0x86, 0x73, 0xbf, 0x06, 0x14, 0xc3, 0x39, 0x97, 0xeb, 0x6f, 0x31, 0x6e, 0x00, 0xa7, 0xea,
+    0xde, 0xde, 0x3a, 0xa8, 0xff, 0xbd, 0xbb, 0xea, 0xfd, 0xee, 0x62, 0x2a, 0x4e, 0xfe, 0x6a, 0x6f,
+    0xe9, 0xff, 0xd3, 0xf3, 0x4b, 0x5f, 0x3c, 0x06, 0xeb, 0x77, 0xdc, 0xed, 0x78, 0x17, 0x87, 0x3e,
+    0xf8, 0x7a, 0x71, 0xed, 0x27, 0x1e, 0xbe, 0xe3, 0x70, 0xfd, 0xf6, 0x82, 0x3d, 0xeb, 0x08, 0x76,
+    0x06, 0xe2, 0x64, 0xbd, 0x8d, 0xe0, 0xbd, 0xf9, 0x61, 0xcd, 0xc7, 0xed, 0xba, 0xfc, 0xcf, 0xdd,
+    0xe9, 0xf7, 0xf6, 0x4b, 0xd6, 0xef, 0xbc, 0xb7, 0xf6, 0xeb, 0xbd, 0x66, 0xbd, 0xdd, 0x28, 0xb9,
+    0xa5, 0x91, 0x0f, 0x03, 0xfd, 0x3f, 0xe1, 0x38, 0x6e, 0x32, 0x11, 0xe7, 0xea, 0x77, 0x91, 0xef,
+    0xf5, 0xe2, 0xdb, 0x1a, 0x75, 0x31, 0x0a, 0xc5, 0xdc, 0x1c, 0x50, 0xc7, 0xf1, 0x7d, 0xcb, 0xf7,
+    0xe2, 0x67, 0xc7, 0xb1, 0x61, 0xdc, 0x0b, 0x46, 0xbc, 0xc3, 0x2e, 0xde, 0xd6, 0xbf, 0x79, 0x78,
+    0xc7, 0xc9, 0x29, 0xfe, 0x50, 0xbf, 0x49, 0x84, 0xc3, 0xf8, 0xce, 0xe5, 0xde, 0x20, 0x3e, 0xaa,
+    0x6d, 0xec, 0x2a, 0xfe, 0xd9, 0xbe, 0x7f, 0xb5, 0xfa, 0x61, 0xd7, 0xb0, 0xfb, 0x65, 0x3b, 0xe1,
+    0xd7, 0xda, 0x7b, 0x30, 0xfb, 0xc7, 0x57, 0xe0, 0xda, 0xa6, 0x66, 0x56, 0x46, 0x36, 0xa6, 0x75,
+    0x65, 0x6d, 0x32, 0x22, 0x02, 0x9a, 0x4a, 0x67, 0x1b, 0xd4, 0x73, 0xce, 0x9b, 0x33, 0x63, 0x1e,
+    0xcc, 0x96, 0xaf, 0xaf, 0x58, 0xc1, 0xac, 0xf2, 0x84, 0x72, 0x12, 0x08, 0x24, 0x0d, 0x09, 0x63,
+    0x44, 0xc4, 0x7b, 0xbf, 0xc1, 0x85, 0xff, 0x5c, 0x7c, 0x31, 0x17, 0xeb, 0xf7, 0xd8, 0x81, 0x76,
+    0x01, 0x2e, 0x16, 0xf4, 0xe2, 0x89, 0x39, 0x56, 0xcf, 0x0b, 0xc5, 0x39, 0x20, 0x17, 0xf7, 0xde,
+    0xdb, 0xb0, 0xdc, 0x56, 0xc7, 0x77, 0x9c, 0x10, 0x8f, 0xfb, 0x19, 0x93, 0xf7, 0x7b, 0x8b, 0x73,
+    0x73, 0x3e, 0x7c, 0x1f, 0x8b, 0xc1, 0xb7, 0xdc, 0xdc, 0xaf, 0x9d, 0xdd, 0x7b, 0x37, 0xee, 0xdb,
+    0xc7, 0xf6, 0x83, 0x76, 0x66, 0xa6, 0x3f, 0xf8, 0xce, 0xa5, 0x3d, 0xd0, 0x7f, 0xf8, 0xce, 0xb5,
+    0x63, 0xe2, 0xed, 0x4d, 0x28, 0x16, 0xf6, 0x60, 0xbf, 0x70, 0x18, 0xd7, 0xc5, 0x85, 0xdd, 0x7c,
+    0x8f, 0x23, 0xfb, 0x69, 0x17, 0x17, 0x99, 0xd7, 0xdb, 0xda, 0xac, 0x9b, 0x8c, 0x63, 0x71, 0xf5,
+    0xef, 0x16, 0x0f, 0x5f, 0x89, 0xc3, 0x7b, 0x4e, 0x68, 0x35, 0xc6, 0xd5, 0x71, 0x6f, 0x9c, 0xd6,
+    0x7d, 0x53, 0x69, 0xa7, 0xba, 0x52, 0xff, 0x7b, 0xd4, 0xd7, 0x87, 0xdb, 0x1b, 0x5b, 0xf5, 0x53,
+    0xa7, 0x38, 0x2b, 0xd3, 0xb5, 0x69, 0xdf, 0x2a, 0xed, 0x95, 0xed, 0x5f, 0xef, 0x57, 0xae, 0xfa,
+    0xfa, 0x37, 0x17, 0xe7, 0xe1, 0x2f, 0x18, 0x29, 0x2c, 0x27, 0x63, 0xc5, 0xd5, 0x79, 0x6f, 0x3d,
+    0xaf, 0xe3, 0xde, 0xdf, 0xbc, 0xa4, 0x21, 0xb2, 0xbb, 0x10, 0xec, 0x85, 0x23, 0xc2, 0xc7, 0xde,
+    0x9b, 0x0c, 0xf4, 0xff, 0x6a, 0x60, 0x63, 0xac, 0x32, 0x6d, 0x77, 0xef, 0xdb, 0x77, 0x86, 0xb8,
+    0x7f, 0x75, 0xbf, 0xa0, 0x97, 0x7e, 0x94, 0x3b, 0xf6, 0x6e, 0xf5, 0x7c, 0xfa, 0x38, 0x39, 0x17,
+    0x6f, 0xf1, 0x3d, 0xe7, 0x66, 0x71, 0x3d, 0xf7, 0x66, 0x71, 0xaf, 0xa2, 0x38, 0x9c, 0x05, 0x83,
+    0xb7, 0x59, 0xba, 0xbc, 0xab, 0x9e, 0xde, 0x35, 0x1b, 0xf4, 0xd1, 0x4a, 0xba, 0x9e, 0xa7, 0x47,
+    0x51, 0xa3, 0x28, 0xff, 0xff, 0x7a, 0x7e, 0x23, 0x46, 0x7f, 0xa8, 0xff, 0x5f, 0xf4, 0x5f, 0x64,
+    0x63, 0x5d, 0x5c, 0x71, 0xb8, 0x2b, 0x8f, 0x2f, 0xef, 0x6a, 0xff, 0xcf, 0x4f, 0xff, 0xd1, 0xd7,
+    0x86, 0x3f, 0x7d, 0xa1, 0x9f, 0xeb, 0x97, 0x52, 0xd1, 0x75, 0x5a, 0x5b, 0x59, 0x58, 0x5a, 0xe5,
+    0xce, 0xac, 0xab, 0x2a, 0xac, 0xb2, 0xd5, 0x80, 0x2b, 0xcd, 0x01, 0x53, 0x50, 0x52, 0x51, 0x53,
+    0x95, 0xd4, 0xa8, 0xa7, 0xaa, 0xf5, 0xc9, 0xc9, 0x2a, 0xa0, 0xc9, 0x49, 0x00, 0xd3, 0x52, 0xd3,
+    0x92, 0x12, 0x35, 0x80, 0x52, 0x52, 0x00, 0x24, 0x00, 0x49, 0x48, 0x47, 0x46, 0x00, 0x8c, 0x8a,
+    0xa4, 0x44, 0x45, 0x43, 0x44, 0x42, 0x41, 0x43, 0x42, 0x40, 0xd3, 0x20, 0xcf, 0xa9, 0xfd, 0x69,
+    0x47, 0x8f, 0xfc, 0x30, 0x81, 0xab, 0xe9, 0x68, 0x9d, 0xda, 0x93, 0xee, 0xe3, 0xc9, 0x67, 0x4f,
+    0x1f, 0xcd, 0x3d, 0x7a, 0xea, 0xe4, 0xb1, 0xa3, 0xa7, 0x8c, 0xe7, 0x4e, 0x9e, 0xce, 0x3b, 0x6d,
+    0xec, 0xd0, 0xe9, 0x9c, 0x23, 0x87, 0xce, 0xa6, 0x9c, 0x38, 0x6d, 0xe0, 0xbc, 0x89, 0xe3, 0xe6,
+    0x4d, 0xee, 0x86, 0xcd, 0x26, 0x67, 0x1a, 0x36, 0x8e, 0x6b, 0xd4, 0x70, 0x3e, 0x6a, 0xaa, 0x41,
+    0x93, 0x06, 0xcd, 0x19, 0xcd, 0x36, 0x33, 0x65, 0xce, 0xd8, 0x16, 0xc8, 0x94, 0x21, 0x93, 0x39,
+    0xff, 0xa7, 0x98, 0x4c, 0x31, 0x61, 0x32, 0xb3, 0x80, 0xf9, 0x09, 0xf3, 0x77, 0xb4, 0xd0, 0xef,
+    0xf9, 0x85, 0x0b, 0x98, 0x2d, 0x5c, 0xf4, 0x2d, 0x59, 0xb2, 0x60, 0xd9, 0xa3, 0x25, 0x0f, 0x16,
+    0x2a, 0x38, 0xac, 0x60, 0x5e, 0xa1, 0xd2, 0x63, 0xc6, 0xb4, 0xd9, 0x2c, 0xab, 0xfc, 0x3c, 0xdc,
+    0xb7, 0xfd, 0x14, 0x37, 0x3d, 0x29, 0x6c, 0xd5, 0xc0, 0x22, 0x22, 0x21, 0x20, 0x69, 0xfd, 0xa0,
+    0x7d, 0xec, 0xc8, 0x59, 0x93, 0x46, 0x33, 0x33, 0x4c, 0x96, 0x2b, 0x98, 0x96, 0x4e, 0x2a, 0x29,
+    0x25, 0x79, 0x40, 0xc6, 0x38, 0xd2, 0x80, 0x61, 0x71, 0x9b, 0xfd, 0x40, 0xec, 0xdb, 0x01, 0x30,
+    0x2e, 0x2a, 0xa8, 0x2a, 0x95, 0x96, 0x7e, 0x7a, 0xd6, 0xe9, 0x6c, 0xb3, 0xa9, 0x29, 0x95, 0x5a,
+    0xbe, 0xfd, 0xe8, 0xf9, 0x9f, 0x2f, 0x7b, 0xcb, 0xa3, 0x0a, 0x6d, 0x3d, 0xb2, 0x6b, 0x3f, 0x81,
+    0x0f, 0x9a, 0x50, 0x26, 0xa4, 0xc4, 0x81, 0xb8, 0xff, 0x5b, 0x4a, 0x2d, 0x7d, 0x0f, 0x66, 0xe9,
+    0xc1, 0x06, 0xff, 0xd9, 0x2f, 0xa2, 0xff, 0x1a, 0x54, 0x07, 0x9d, 0xa6, 0xa6, 0xaf, 0xe0, 0x2d,
+    0x41, 0x17, 0xc1, 0xff, 0x0b, 0x81, 0x51, 0x80, 0x94, 0x7f, 0x5f, 0x7e, 0xb5, 0x81, 0xba, 0x40,
+    0x97, 0xc7, 0xbb, 0x6b, 0x5d, 0xf7, 0x35, 0x5d, 0x3d, 0xf7, 0x69, 0xff, 0x55, 0x1f, 0x49, 0xc1,
+    0x94, 0x8d, 0x50, 0x75, 0xd8, 0x21, 0x66, 0x10, 0x1f, 0xd4, 0x80, 0x3c, 0xd8, 0xd4, 0xa0, 0x7f,
+    0xaa, 0xe0, 0x38, 0xf6, 0xd2, 0x9f, 0x53, 0xa5, 0x0d, 0x42, 0x17, 0x54, 0x13, 0xe4, 0x78, 0xff,
+    0x76, 0x6f, 0x6e, 0x3f, 0x46, 0x69, 0x15, 0x54, 0xae, 0x5a, 0x92, 0xfa, 0x67, 0x9a, 0xcb, 0x47,
+    0x94, 0x34, 0x90, 0x4d, 0xcf, 0x1f, 0x4a, 0x3f, 0x68, 0x28, 0x68, 0xfd, 0xcf, 0xe7, 0xf1, 0xe4,
+    0x73, 0x62, 0xc0, 0x59, 0x63, 0x86, 0xfc, 0xf8, 0x25, 0x2f, 0x7b, 0xa1, 0xec, 0x92, 0xbf, 0xb0,
+    0x42, 0x25, 0x29, 0x8a, 0xda, 0x25, 0x94, 0xfa, 0xd2, 0x66, 0xf2, 0x47, 0x8c, 0xa8, 0x0d, 0x15,
+    0x89, 0x22, 0xf2, 0x54, 0xbf, 0xf5, 0xc7, 0xfc, 0xaf, 0x23, 0x7a, 0xc3, 0x9e, 0xf1, 0x48, 0x63,
+    0x46, 0x5e, 0x96, 0x61, 0xc3, 0xb8, 0x10, 0xe3, 0xc7, 0x60, 0xcc, 0xff, 0x22, 0xec, 0x69, 0x85,
+    0x93, 0x89, 0xd0, 0x50, 0x11, 0xa1, 0x1c, 0x68, 0xf1, 0x4f, 0x1b, 0x23, 0xce, 0xa8, 0x30, 0x51,
+    0xc9, 0x69, 0xe4, 0x92, 0x63, 0xcd, 0x68, 0xb4, 0x48, 0x93, 0xa7, 0x3b, 0x75, 0xd6, 0x3f, 0x97,
+    0x6b, 0xe4, 0xfe, 0x6d, 0x0d, 0x4a, 0x6f, 0x7b, 0xb0, 0xfa, 0x0b, 0xd4, 0x12, 0xbc, 0x02, 0xfa,
+    0xe7, 0x04, 0x4c, 0x80, 0x81, 0x51, 0xc0, 0xa8, 0x3f, 0x25, 0x28, 0x6c, 0x28, 0x5e, 0xe3, 0x9d,
+    0xdb, 0x75, 0xeb, 0x0d, 0xce, 0xed, 0xcd, 0x76, 0x93, 0x82, 0x49, 0x11, 0x90, 0x92, 0x42, 0x49,
+    0x1d, 0x01, 0x30, 0x3a, 0xa2, 0xa9, 0x46, 0xd5, 0x99, 0x2a, 0xb5, 0xa7, 0x52, 0xb6, 0x54, 0x1a,
+    0x15, 0x65, 0x07, 0xa0, 0x6b, 0x1a, 0x89, 0xa9, 0xfb, 0xf7, 0x6d, 0x27, 0x34, 0x17, 0xf4, 0x06,
+    0xb4, 0x36, 0x3d, 0x93, 0x8e, 0xd9, 0xf4, 0xd7, 0x8f, 0x51, 0x74, 0xa8, 0x9e, 0xd2, 0xd1, 0xf9,
+    0xb3, 0x36, 0x03, 0x7a, 0xf6, 0x23, 0xaa, 0x7f, 0x2e, 0x0d, 0x40, 0x5a, 0x1a, 0x53, 0x7d, 0x54,
+    0x7f, 0x39, 0x49, 0x97, 0xec, 0xa4, 0x1f, 0xa3, 0xe8, 0x50, 0x3d, 0xa5, 0xa3, 0xf3, 0x7f, 0x87,
+    0x21, 0x7a, 0x0e, 0x0d, 0x5d, 0x0a, 0xb5, 0x03, 0x9d, 0xe7, 0x2e, 0x4e, 0x42, 0x51, 0x8a, 0xa4,
+    0x7e, 0xca, 0x08, 0x5d, 0x53, 0x4d, 0xda, 0x45, 0x6d, 0x22, 0xf3, 0x2f, 0xd5, 0x42, 0x52, 0x3f,
+    0x75, 0xbd, 0x1f, 0x7c, 0x23, 0x8a, 0xf3, 0x38, 0xa1, 0xe9, 0x07, 0xbd, 0x98, 0x30, 0x2f, 0xe4,
+    0x03, 0xea, 0x7e, 0xeb, 0xa6, 0xbf, 0x8b, 0xc5, 0x70, 0xd2, 0x42, 0x31, 0x18, 0x9f, 0xb3, 0x7f,
+    0xbf, 0x71, 0xaf, 0x1c, 0xee, 0xd5, 0xde, 0x7d, 0xfa, 0xf7, 0x2b, 0xd6, 0xe5, 0xe6, 0xde, 0x7e,
+    0xfa, 0xe7, 0xff, 0xae, 0xa2, 0xf7, 0x8b, 0x45, 0x1c, 0x1f, 0xc8, 0x22, 0xee, 0x5f, 0xc2, 0x3c,
+    0x88, 0xf3, 0x4c, 0x68, 0x73, 0x71, 0x0f, 0x82, 0x5b, 0xc0, 0xac, 0x60, 0x1b, 0x83, 0x2c, 0xa0,
+    0x16, 0xa9, 0x81, 0xd1, 0x02, 0x06, 0x09, 0xd8, 0x24, 0x8c, 0x11, 0x0b, 0xa5, 0xda, 0x5b, 0x2a,
+    0x18, 0xa8, 0x16, 0x00, 0xe9, 0x08, 0x40, 0x12, 0xdf, 0x1e, 0x1f, 0x82, 0x3d, 0x2c, 0x82, 0x21,
+    0xbd, 0xa2, 0x21, 0xa2, 0xb3, 0x3c, 0x50, 0xbc, 0x3c, 0x0b, 0x77, 0x05, 0xca, 0x57, 0xbb, 0xc7,
+    0x3a, 0x21, 0x3d, 0x40, 0x52, 0xb3, 0xe9, 0x07, 0x95, 0x9d, 0x7d, 0x2a, 0xf1, 0xf5, 0xed, 0x5d,
+    0xfb, 0xf8, 0x10, 0xe8, 0xed, 0x61, 0x11, 0x60, 0x0f, 0xe8, 0x19, 0xc8, 0x3b, 0xb0, 0x99, 0x57,
+    0xc0, 0x0e, 0x4f, 0xd3, 0x4e, 0x4e, 0xc9, 0x2b, 0x0e, 0x4e, 0x2d, 0xee, 0xad, 0x0d, 0xce, 0xed,
+    0xcd, 0x8d, 0xad, 0x6d, 0x8d, 0x6d, 0x2d, 0x4d, 0x0d, 0xcd, 0xeb, 0xec, 0x7f, 0x5b, 0x3d, 0x03,
+    0x2c, 0x1b, 0x33, 0x23, 0x2b, 0xdb, 0x24, 0x13, 0x1b, 0xa3, 0x46, 0x08, 0x13, 0xb3, 0x0c, 0x93,
+    0x7e, 0x81, 0x25, 0xe8, 0x42, 0xeb, 0xe2, 0xf2, 0xca, 0x09, 0x70, 0xcd, 0x9a, 0x04, 0xb6, 0xaa,
+    0x5a, 0x03, 0xa4, 0x9c, 0xb6, 0x00, 0xb1, 0x59, 0x5a, 0x58, 0x59, 0x57, 0x58, 0x52, 0x56, 0x57,
+    0x56, 0x55, 0x03, 0xa8, 0xaa, 0xa6, 0xa8, 0x2e, 0xa7, 0xa2, 0xa4, 0xa0, 0xa2, 0x9e, 0xa0, 0x22,
+    0xad, 0x4f, 0x56, 0xae, 0xd3, 0x1f, 0x86, 0x26, 0x01, 0x7f, 0x60, 0x3c, 0xa6, 0x26, 0x4e, 0xa6,
+    0x9a, 0x68, 0x29, 0x80, 0x5c, 0x80, 0x24, 0xa5, 0x3a, 0xe9, 0x1f, 0xe9, 0x08, 0x80, 0x11, 0xd1,
+    0xbf, 0x11, 0x1a, 0xb5, 0x88, 0xda, 0xd9, 0xc9, 0xc7, 0xb6, 0x87, 0x84, 0xfe, 0x7f, 0x48, 0x87,
+    0x50, 0x10, 0x90, 0x9d, 0xa0, 0xa9, 0x74, 0xfa, 0x63, 0xff, 0xd4, 0x36, 0x39, 0x2a, 0xa7, 0xae,
+    0x69, 0x3e, 0x0f, 0xda, 0xa7, 0x9e, 0xf3, 0x0f, 0x05, 0xb5, 0x13, 0xfa, 0xd9, 0x07, 0xec, 0x73,
+    0x4f, 0x4d, 0xef, 0xf1, 0xe4, 0xa3, 0xc7, 0x53, 0x8e, 0x9e, 0x3c, 0x76, 0x38, 0xad, 0xe6, 0x3c,
+    0x43, 0x77, 0xf0, 0x50, 0xdd, 0xa9, 0x23, 0x87, 0x91, 0x4e, 0x9d, 0x39, 0x74, 0xe6, 0xc4, 0xe9,
+    0x8c, 0x03, 0xa7, 0xf3, 0x0d, 0x1c, 0xae, 0x37, 0x74, 0x74, 0x80, 0x80, 0x38, 0x70, 0x2c, 0xa9,
+    0xf2, 0x05, 0x8d, 0x9b, 0x45, 0x37, 0x6d, 0xd0, 0xb0, 0x01, 0x5b, 0x93, 0xc6, 0x8b, 0x0d, 0xe7,
+    0x1a, 0x4e, 0x35, 0x69, 0xd4, 0x6c, 0xb6, 0xd9, 0x3c, 0x83, 0xe6, 0x86, 0x99, 0x33, 0x66, 0xca,
+    0x7c, 0x21, 0xa3, 0x99, 0x19, 0x26, 0x8d, 0x0c, 0x0d, 0x46, 0x73, 0x4c, 0xe6, 0x18, 0x31, 0x61,
+    0xc4, 0x78, 0x29, 0xe3, 0xa5, 0xcb, 0x17, 0x46, 0x2e, 0x5d, 0xb8, 0x6c, 0xa9, 0xa2, 0x25, 0xcb,
+    0x15, 0x4c, 0x32, 0x2d, 0xd2, 0x47, 0xcb, 0x82, 0xe5, 0x0a, 0x16, 0x2b, 0x98, 0x56, 0xa8, 0x6c,
+    0xa1, 0x32, 0xa5, 0x0a, 0x59, 0xca, 0x14, 0x29, 0x51, 0x96, 0x40, 0xb1, 0x74, 0x52, 0x49, 0xa9,
+    0x05, 0x65, 0x7a, 0x69, 0x29, 0x79, 0xf9, 0xc4, 0x09, 0x8f, 0x27, 0x4d, 0x2a, 0x17, 0x9b, 0x30,
+    0xa1, 0x94, 0x32, 0xb1, 0x95, 0x44, 0x51, 0x92, 0x64, 0x09, 0x11, 0x24, 0x37, 0x86, 0x24, 0x99,
+    0x9c, 0x3c, 0x82, 0xc4, 0x48, 0x91, 0x23, 0x45, 0x88, 0x4c, 0x12, 0x19, 0x32, 0xa9, 0x0b, 0x19,
+    0x02, 0x29, 0x24, 0x88, 0x24, 0x90, 0x20, 0x9c, 0x3f, 0x80, 0xfc, 0xf0, 0xc1, 0x03, 0x1b, 0xe9,
+    0x23, 0xb2, 0x47, 0x64, 0x8f, 0x1d, 0x90, 0x3a, 0x72, 0xec, 0xc8, 0x71, 0x03, 0xc7, 0x0d, 0x1b,
+    0x38, 0x6a, 0xd8, 0x78, 0x2c, 0x8d, 0x1a, 0x52, 0x33, 0x68, 0x2c, 0xce, 0x68, 0x64, 0xc1, 0x42,
+    0x46, 0x8c, 0x24, 0x19, 0x36, 0x1a, 0x8c, 0x18, 0x2f, 0x5a, 0xc0, 0x30, 0x72, 0xf1, 0x22, 0x82,
+    0x8b, 0x16, 0x2b, 0x58, 0xac, 0x50, 0xc1, 0x22, 0xc5, 0x09, 0x15, 0x2f, 0x50, 0xa4, 0x90, 0x44,
+    0x61, 0x82, 0xc4, 0x89, 0x1b, 0x25, 0x4c, 0x44, 0x66, 0x4b, 0x50, 0x47, 0x90, 0x10, 0x31, 0x02,
+    0xc4, 0x07, 0x11, 0x21, 0x38, 0x34, 0x6e, 0x58, 0xd4, 0x80, 0x61, 0xc3, 0x05, 0x0d, 0x19, 0x30,
+    0x64, 0xb0, 0x40, 0xe1, 0x42, 0x85, 0x47, 0x0b, 0x8f, 0x8e, 0x13, 0x28, 0x94, 0x27, 0x94, 0x19,
+    0x39, 0x30, 0x4a, 0x68, 0x8c, 0x20, 0x01, 0x42, 0x04, 0x08, 0xf9, 0xa2, 0x62, 0x76, 0xab, 0x48,
+    0xc5, 0x13, 0x1f, 0x84, 0x13, 0xcb, 0xe4, 0x07, 0x63, 0x31, 0xf9, 0x51, 0xbc, 0x87, 0x1d, 0xec,
+    0x0e, 0xc0, 0xf8, 0x77, 0xab, 0x17, 0x7e, 0xa9, 0x88, 0xba, 0xf7, 0x10, 0xf1, 0xd1, 0x30, 0x3f,
+    0x74, 0x34, 0xec, 0x16, 0x46, 0x20, 0xec, 0x12, 0x72, 0xc1, 0x5c, 0x2d, 0x7e, 0x6b, 0x67, 0x3c,
+    0x83, 0x77, 0xe0, 0x20, 0x83, 0xc0, 0x05, 0x0a, 0x18, 0x24, 0x10, 0x54, 0x20, 0xf8, 0x07, 0xf8,
+    0xe7, 0x07, 0xd8, 0xe7, 0xa7, 0x83, 0xaf, 0x8f, 0x6f, 0x8f, 0x0e, 0x01, 0x18, 0x76, 0x0e, 0x01,
+    0x9a, 0x01, 0xac, 0xde, 0x81, 0xaa, 0x5e, 0xde, 0x9d, 0x01, 0x37, 0x2c, 0x5e, 0x81, 0xbc, 0x79,
+    0xb3, 0x80, 0xdd, 0xf5, 0x2e, 0x43, 0xdd, 0xb5, 0x6e, 0x6e, 0x6f, 0x4e, 0x8e, 0x8e, 0x2d, 0xb3,
+    0x4c, 0xee, 0xec, 0xec, 0xe1, 0xd2, 0xe2, 0xd8, 0xe8, 0xf7, 0x7c, 0x83, 0x73, 0x6b, 0x7b, 0x83,
+    0x6a, 0x5b, 0x63, 0x5b, 0x53, 0x63, 0x4b, 0x53, 0x23, 0xa3, 0xa5, 0xe5, 0xe0, 0x42, 0x33, 0x33,
+    0xfb, 0x3f, 0xcb, 0x93, 0x93, 0x95, 0xe9, 0x18, 0x13, 0x23, 0xa3, 0xab, 0x62, 0x61, 0x60, 0x9f,
+    0x61, 0x5f, 0x5c, 0x8c, 0x5e, 0x5f, 0x97, 0x9c, 0x5d, 0x5e, 0x54, 0x5d, 0x04, 0xa8, 0xb6, 0x08,
+    0x04, 0x3f, 0xff, 0x59, 0x65, 0x13, 0x4a, 0x23, 0x95, 0x4b, 0x94, 0x50, 0x46, 0x2e, 0x49, 0x82,
+    0x44, 0x89, 0x8b, 0x24, 0x35, 0x90, 0x0c, 0x89, 0x14, 0x02, 0x64, 0x48, 0x10, 0x21, 0x79, 0x90,
+    0x1f, 0x92, 0x40, 0x7c, 0x48, 0xea, 0x72, 0x3e, 0x7a, 0xd4, 0xe0, 0xb1, 0xa3, 0x07, 0x08, 0x1e,
+    0x3a, 0x72, 0xec, 0x80, 0xc4, 0x91, 0xa3, 0x4c, 0x02, 0xf2, 0x86, 0x0d, 0x1c, 0x8f, 0x29, 0x6c,
+    0xd0, 0x70, 0xd1, 0x22, 0x85, 0xce, 0xa2, 0xc5, 0x0a, 0x16, 0x2a, 0xfe, 0x49, 0x30, 0x9e, 0x40,
+    0x71, 0x69, 0xa2, 0xc4, 0x89, 0xca, 0x12, 0x23, 0x40, 0x88, 0x18, 0x11, 0x17, 0x22, 0xb2, 0x86,
+    0x8b, 0x14, 0x24, 0x40, 0xd0, 0xc9, 0xbd, 0xc5, 0xc1, 0xcd, 0x75, 0xe0, 0xb0, 0xa1, 0x83, 0x06,
+    0x0c, 0x1b, 0x16, 0x33, 0x68, 0xd8, 0x33, 0x5c, 0xa8, 0x80, 0x61, 0xb7, 0x70, 0x41, 0xd1, 0x42,
+    0x63, 0x85, 0xc7, 0x46, 0x0a, 0x13, 0x1e, 0x1d, 0x29, 0xe8, 0x8e, 0xe5, 0x09, 0x7a, 0x99, 0x51,
+    0x51, 0x02, 0x04, 0xc6, 0x08, 0x12, 0x0c, 0x23, 0x2c, 0x42, 0x30, 0x5c, 0x4c, 0xdc, 0x1f, 0x8c,
+    0x13, 0x9f, 0x90, 0x1f, 0x54, 0x92, 0xc5, 0xe1, 0xb1, 0x13, 0xc2, 0xb0, 0x03, 0xfd, 0x6b, 0x75,
+    0x00, 0xfe, 0x82, 0x11, 0x0d, 0x0f, 0x9b, 0x10, 0xbd, 0x87, 0xde, 0x9c, 0xb0, 0x9b, 0x17, 0x76,
+    0xd7, 0x0a, 0x1b, 0x15, 0xf7, 0xaf, 0x7e, 0x68, 0xd8, 0x25, 0x6c, 0x5b, 0x9b, 0xb2, 0x6d, 0xb5,
+    0xf7, 0x60, 0x76, 0xab, 0x6d, 0x70, 0xef, 0x0d, 0xd6, 0x65, 0x19, 0xf8, 0x35, 0x58, 0xc0, 0x40,
+    0x41, 0x82, 0x05, 0x0a, 0x04, 0x03, 0x13, 0x08, 0xfe, 0x05, 0x02, 0xfe, 0x01, 0xf2, 0x59, 0xfd,
+    0xfa, 0xf8, 0xfa, 0x10, 0xdc, 0xed, 0x61, 0x11, 0xe8, 0x1d, 0xc0, 0xea, 0x19, 0xc8, 0x3b, 0x60,
+    0xa0, 0x40, 0x1e, 0x5e, 0x01, 0xbc, 0x6b, 0xd3, 0x9d, 0xdd, 0xd5, 0x8e, 0x8e, 0xad, 0xce, 0x71,
+    0x8e, 0x4e, 0x2e, 0x6e, 0x0e, 0x4d, 0x0e, 0xee, 0x2d, 0xee, 0x0c, 0xae, 0xed, 0xcd, 0xad, 0xcd,
+    0x4d, 0x8d, 0x6d, 0x4d, 0xcd, 0x6c, 0x4d, 0x7b, 0x0f, 0x66, 0xff, 0xf8, 0x0a, 0x5c, 0xdb, 0xd4,
+    0xd4, 0xd0, 0xce, 0xcc, 0xd2, 0xce, 0xcc, 0xca, 0xc8, 0xc6, 0xce, 0xcc, 0xc4, 0xca, 0xac, 0xc8,
+    0x98, 0xc6, 0xc2, 0xb2, 0xc4, 0xc0, 0xc2, 0xbe, 0xbc, 0xc0, 0xbe, 0xba, 0xb8, 0xbc, 0xba, 0x08,
+    0x70, 0x69, 0x11, 0xd8, 0xd2, 0xda, 0xba, 0xb2, 0x66, 0x61, 0x5d, 0x61, 0x0d, 0x70, 0xb2, 0xaa,
+    0x1a, 0x40, 0x35, 0x55, 0x45, 0x25, 0x15, 0x35, 0x25, 0x05, 0x15, 0x65, 0x85, 0x7a, 0xb2, 0x3e,
+    0x35, 0x35, 0x39, 0x09, 0x68, 0x12, 0xb0, 0x44, 0x65, 0x92, 0xac, 0x2e, 0x55, 0x2a, 0x05, 0xa8,
+    0x96, 0xc7, 0x94, 0x92, 0x90, 0x02, 0x88, 0x25, 0x01, 0xb8, 0x22, 0x39, 0x1a, 0x01, 0x38, 0x32,
+    0x3a, 0xaa, 0x52, 0xff, 0x89, 0xc2, 0x8a, 0xcc, 0xca, 0xc8, 0xc6, 0xb4, 0xae, 0xac, 0x4d, 0x46,
+    0x44, 0x65, 0x63, 0x62, 0x61, 0x60, 0x64, 0x4f, 0xff, 0xfc, 0x73, 0x10, 0x1e, 0xd0, 0x54, 0x8f,
+    0xd4, 0x8d, 0xdd, 0x26, 0xfa, 0xf3, 0x1f, 0xa5, 0x3f, 0xeb, 0x99, 0x9e, 0x67, 0x50, 0xeb, 0x87,
+    0x82, 0x86, 0xf6, 0xf9, 0xec, 0xe3, 0x69, 0xe5, 0xb3, 0xc7, 0x73, 0x4f, 0x1e, 0x3d, 0x78, 0xf2,
+    0xdc, 0xc1, 0x63, 0xe7, 0x8e, 0x9d, 0x39, 0x75, 0xe8, 0xcc, 0xa1, 0xd3, 0x29, 0xa7, 0xf3, 0x4d,
+    0x53, 0x1c, 0x38, 0x6f, 0xe0, 0xb4, 0x71, 0xc3, 0xc9, 0x46, 0xcd, 0x9a, 0x34, 0x6a, 0xc0, 0xa4,
+    0x39, 0x83, 0x66, 0xf3, 0x4c, 0xd7, 0x66, 0x19, 0x33, 0x5b, 0xca, 0x8c, 0xa9, 0x92, 0xd1, 0x1c,
+    0xc3, 0xa5, 0x99, 0x09, 0x46, 0x4c, 0x98, 0x4c, 0xc7, 0x2d, 0x62, 0xbe, 0x6c, 0xd1, 0xbf, 0x74,
+    0xf1, 0x72, 0xe9, 0xd8, 0x85, 0x8b, 0x8b, 0xcd, 0x06, 0x34, 0x95, 0xce, 0x36, 0xa8, 0xe7, 0x9c,
+    0x37, 0x67, 0xc6, 0x80, 0xd9, 0xf2, 0xd5, 0xc5, 0x45, 0xc0, 0x0b, 0xcb, 0x15, 0xcc, 0x2a, 0x55,
+    0x58, 0xa6, 0x78, 0x57, 0xa8, 0x58, 0x59, 0x82, 0xf9, 0xa3, 0x8a, 0x24, 0x15, 0x29, 0x53, 0xa2,
+    0x48, 0x81, 0x12, 0x05, 0xca, 0x13, 0xeb, 0xa5, 0xe5, 0x13, 0xcb, 0x26, 0x4e, 0x9a, 0x50, 0x5a,
+    0x2b, 0x99, 0x50, 0x32, 0x51, 0xb2, 0x24, 0x89, 0x12, 0x24, 0x49, 0x8e, 0x20, 0x39, 0x32, 0x69,
+    0xa4, 0xc8, 0x64, 0x91, 0x21, 0x44, 0x86, 0x00, 0x69, 0x12, 0x12, 0x04, 0x48, 0x10, 0xc9, 0x1f,
+    0x91, 0x3e, 0x78, 0xf4, 0xd8, 0xc1, 0x23, 0x6b, 0x07, 0xa4, 0x8e, 0x1c, 0x90, 0x57, 0x39, 0x6e,
+    0xe0, 0xc0, 0xba, 0x41, 0xa3, 0x6a, 0xa3, 0x06, 0x0d, 0xab, 0x1a, 0x36, 0xdb, 0x15, 0x2b, 0x98,
+    0x55, 0x9e, 0x50, 0x4e, 0x02, 0x81, 0xa4, 0xb1, 0x95, 0x85, 0x75, 0x65, 0xa5, 0x15, 0x03, 0x46,
+    0x0c, 0x47, 0x18, 0x54, 0x2f, 0x5a, 0xb8, 0x58, 0x6c, 0xb1, 0x82, 0xc5, 0xd4, 0x8a, 0x14, 0x2a,
+    0xf6, 0x14, 0x57, 0x14, 0x52, 0x27, 0xae, 0x6f, 0x22, 0xaa, 0xc4, 0x00, 0xaa, 0x29, 0xa9, 0x28,
+    0xa8, 0x2a, 0x11, 0x21, 0x44, 0x2c, 0x86, 0x70, 0x02, 0xf1, 0xe4, 0x64, 0xed, 0xc0, 0xa1, 0xc3,
+    0xce, 0xa1, 0x72, 0x83, 0x00, 0xa6, 0x26, 0x0c, 0x57, 0x0c, 0x97, 0x17, 0x96, 0x94, 0xaa, 0x8f,
+    0x14, 0x1e, 0x1d, 0x29, 0x48, 0x20, 0x9a, 0x50, 0x96, 0xd0, 0x58, 0x66, 0x6c, 0x84, 0x20, 0x8e,
+    0xb0, 0x08, 0x61, 0xac, 0x98, 0x38, 0x7e, 0x90, 0x48, 0x7e, 0x10, 0xf6, 0x8a, 0x9f, 0xec, 0x61,
+    0x27, 0x88, 0x0e, 0xc0, 0x88, 0x5f, 0xb0, 0xfe, 0x2d, 0x0c, 0xf2, 0xda, 0x68, 0x85, 0x86, 0x87,
+    0xb9, 0xa1, 0x96, 0xb0, 0x3b, 0x18, 0x8a, 0x85, 0xa8, 0x14, 0xc2, 0xba, 0x4b, 0x43, 0x33, 0x00,
+    0x00, 0x00, 0x34, 0x00, 0x13, 0x7a, 0x09, 0xc4, 0xc3, 0x30, 0x75, 0xf2, 0x0a, 0x54, 0x2d, 0x81,
+    0x82, 0x60, 0xcc, 0x60, 0x30, 0x88, 0x05, 0x86, 0x81, 0x23, 0xb1, 0x10, 0x47, 0xbe, 0xc3, 0xff,
+    0x21, 0x85, 0xb4, 0xf3, 0xd0, 0xd6, 0x47, 0x8e, 0x54, 0x67, 0x83, 0x03, 0xd1, 0xfd, 0xb2, 0x09,
+    0xe0, 0xc5, 0x82, 0xfa, 0x6f, 0x35, 0x46, 0xf8, 0x8a, 0xe6, 0x0b, 0x8d, 0x23, 0x53, 0xb4, 0x87,
+    0xd3, 0xb1, 0xeb, 0xd6, 0xaa, 0xe3, 0xc9, 0x2d, 0x06, 0x17, 0x7f, 0xb1, 0x0c, 0xb6, 0xf5, 0x21,
+    0x24, 0x8f, 0x81, 0xd8, 0x81, 0x39, 0x1c, 0x62, 0x61, 0xae, 0x2a, 0x67, 0x95, 0xe0, 0x21, 0x30,
+    0xd6, 0xad, 0x63, 0xa4, 0xd8, 0xe3, 0x0b, 0xb8, 0xa9, 0xdc, 0x7b, 0x5f, 0x45, 0x47, 0xc5, 0x13,
+    0xe0, 0x69, 0x85, 0xb7, 0xd9, 0x26, 0xbc, 0x24, 0x77, 0x2f, 0x33, 0x2d, 0x86, 0xa2, 0x33, 0x1f,
+    0x27, 0xee, 0x08, 0x39, 0x65, 0x6d, 0x76, 0x84, 0x6e, 0xf2, 0x27, 0x08, 0xfe, 0x63, 0xf1, 0x3a,
+    0x21, 0xc2, 0xcc, 0x5c, 0xe9, 0xa8, 0x61, 0xbf, 0xf2, 0xe7, 0x8a, 0x23, 0xf2, 0x22, 0x8d, 0xc3,
+    0xc8, 0xd7, 0x52, 0xd8, 0xbc, 0xee, 0x32, 0x10, 0x1e, 0xc1, 0xc8, 0xeb, 0x80, 0xe3, 0xf8, 0x14,
+    0x8b, 0x03, 0xc1, 0xe1, 0xd7, 0x1d, 0x76, 0x0e, 0x13, 0xe4, 0xaa, 0x87, 0x03, 0x6b, 0x8d, 0x7b,
+    0x4a, 0x3e, 0x8a, 0xc9, 0x06, 0x84, 0xa3, 0xa4, 0xa7, 0x72, 0x4b, 0x2b, 0x5e, 0xd2, 0x83, 0x7f,
+    0x55, 0x31, 0x31, 0xca, 0x9a, 0x74, 0x04, 0x2c, 0x98, 0x82, 0x72, 0xb4, 0x39, 0x03, 0x8b, 0xb7,
+    0x1e, 0x0d, 0xb8, 0x1f, 0xed, 0xf8, 0xe4, 0xb8, 0x79, 0xa3, 0xa5, 0x0d, 0x58, 0x7f, 0xaa, 0x64,
+    0x2b, 0xb0, 0x7a, 0xa5, 0xc0, 0xc5, 0x9f, 0x55, 0x3e, 0x3b, 0x3d, 0x32, 0xbc, 0x8d, 0x9e, 0x15,
+    0xac, 0xa2, 0x3b, 0x37, 0x3c, 0x39, 0x5b, 0x67, 0x02, 0xce, 0x03, 0x2d, 0xe7, 0x2a, 0xd2, 0x9c,
+    0x38, 0xec, 0xb8, 0xd0, 0xf2, 0x3c, 0xa8, 0x70, 0xb3, 0x72, 0x3e, 0x47, 0xef, 0xd1, 0x68, 0xc6,
+    0x18, 0x69, 0xf3, 0xc7, 0x33, 0x89, 0xfb, 0x3f, 0x16, 0xcc, 0x0f, 0x71, 0xfe, 0x7a, 0x9b, 0x7d,
+    0xc8, 0xbc, 0x0c, 0x7b, 0x3d, 0xfd, 0x3b, 0x64, 0xb3, 0x39, 0x78, 0xde, 0x19, 0xf9, 0x7a, 0x80,
+    0xae, 0x03, 0xf9, 0xee, 0x90, 0x7b, 0x1e, 0x5e, 0xd1, 0xb1, 0x65, 0xaf, 0x42, 0x75, 0x3e, 0xac,
+    0x65, 0xda, 0x8e, 0xd3, 0x5f, 0x50, 0x50, 0xce, 0x78, 0x81, 0xfb, 0xdd, 0x0c, 0xbe, 0x84, 0x76,
+    0x39, 0x8d, 0x08, 0xae, 0xce, 0x08, 0xc2, 0x33, 0x3f, 0x1e, 0xfd, 0x2d, 0x45, 0x3b, 0x78, 0xf2,
+    0xfb, 0x71, 0x2f, 0xad, 0xc6, 0x6b, 0x5c, 0xb6, 0x9d, 0xe6, 0x85, 0x9d, 0xe4, 0x6b, 0xd8, 0x7d,
+    0xc4, 0x68, 0x86, 0x61, 0xbb, 0xd5, 0xb7, 0x77, 0x58, 0xc9, 0x7d, 0xea, 0xf3, 0xdd, 0x93, 0xbb,
+    0x0b, 0x7f, 0x57, 0xe3, 0xbd, 0x79, 0x4a, 0x4f, 0x98, 0x43, 0xf8, 0x77, 0xf1, 0x50, 0xe1, 0xfe,
+    0xc4, 0x87, 0xa1, 0xcb, 0xfd, 0x74, 0x1e, 0xe5, 0x7e, 0xba, 0x01, 0x67, 0x73, 0x8c, 0x5b, 0xa9,
+    0x83, 0x05, 0x90, 0x1d, 0x26, 0xd8, 0x9e, 0x7b, 0x49, 0xcb, 0x98, 0x77, 0x19, 0x3f, 0x31, 0xea,
+    0x65, 0x96, 0x20, 0x5f, 0x3d, 0x83, 0xc8, 0x67, 0xee, 0x78, 0xf4, 0xbf, 0xda, 0xde, 0xeb, 0x0c,
+    0xde, 0xd5, 0x89, 0x97, 0xca, 0xf8, 0x06, 0xaf, 0xbd, 0xb3, 0xbf, 0x20, 0xbf, 0x0a, 0x74, 0xce,
+    0xa1, 0x9d, 0x4f, 0x03, 0xce, 0xa5, 0xe0, 0xd4, 0x18, 0x60, 0x2f, 0x45, 0xfb, 0x28, 0xff, 0xfe,
+    0x6b, 0xee, 0x2c, 0xe4, 0xe7, 0xc0, 0x27, 0xd8, 0x06, 0xc2, 0xb6, 0x10, 0x30, 0xfc, 0x30, 0xeb,
+    0x2a, 0x34, 0xc6, 0xa0, 0xe1, 0xb9, 0xc0, 0x61, 0x6c, 0x90, 0xd7, 0x2c, 0x6f, 0x71, 0xe5, 0x76,
+    0x2d, 0x60, 0xa2, 0xaa, 0x7c, 0x1a, 0xd2, 0x0a, 0x36, 0x96, 0x95, 0xc9, 0x1d, 0xbc, 0xd8, 0x86,
+    0x68, 0x2d, 0x6c, 0xef, 0xde, 0x16, 0x77, 0xe1, 0xd9, 0x12, 0x4b, 0x6f, 0x7a, 0xf7, 0x2d, 0xc3,
+    0xfc, 0x7a, 0x41, 0x20, 0x7a, 0xf4, 0x43, 0xdc, 0xec, 0xb1, 0x6c, 0xea, 0xaf, 0x3b, 0xf1, 0x2e,
+    0xc0, 0x25, 0x13, 0xf0, 0xf0, 0xc7, 0x6f, 0x82, 0x46, 0x34, 0xbd, 0x47, 0xfe, 0x9d, 0x28, 0x3a,
+    0xa5, 0x32, 0xb5, 0x8d, 0xed, 0x5f, 0x1b, 0x14, 0x1e, 0xa7, 0x76, 0xaa, 0x07, 0x85, 0x3e, 0x11,
+    0x44, 0x8b, 0xf6, 0x95, 0x38, 0x51, 0x5f, 0xc9, 0x47, 0x35, 0xa4, 0xe6, 0xdd, 0xf5, 0xd3, 0x05,
+    0x78, 0xff, 0xbe, 0xcc, 0x1e, 0x1c, 0x5c, 0xf4, 0x52, 0x52, 0x79, 0xd6, 0x29, 0x96, 0x65, 0xba,
+    0x81, 0xad, 0x5a, 0xdf, 0xb3, 0xd4, 0xc6, 0xac, 0x17, 0x95, 0x59, 0xc1, 0x96, 0xbf, 0x73, 0x0e,
+    0x13, 0xab, 0x0a, 0xcb, 0x02, 0x7d, 0x87, 0x41, 0x99, 0x93, 0xba, 0x63, 0xa8, 0x74, 0x50, 0x0c,
+    0x7d, 0xef, 0xcd, 0x42, 0x51, 0xc6, 0xc9, 0x96, 0xec, 0xf0, 0x9c, 0x76, 0x5b, 0x7f, 0xea, 0x16,
+    0xdd, 0x95, 0xbb, 0x38, 0x17, 0x0e, 0x2b, 0x33, 0xfe, 0x08, 0x3b, 0x38, 0x1c, 0x12, 0x7d, 0x7d,
+    0x81, 0x51, 0xb1, 0x36, 0x06, 0x5f, 0x4c, 0x9d, 0x47, 0x3b, 0xbd, 0x9c, 0x5b, 0xe4, 0x7e, 0xf4,
+    0x77, 0xf0, 0xa5, 0xbf, 0x31, 0x6c, 0x67, 0x60, 0x02, 0x87, 0xa1, 0x57, 0x27, 0xa4, 0xc7, 0x4f,
+    0xe0, 0x3f, 0xb1, 0xe7, 0x68, 0x06, 0x7d, 0xd2, 0xd0, 0xb9, 0x85, 0x5d, 0xf1, 0xa0, 0xe5, 0xe6,
+    0x6f, 0xcd, 0xbd, 0xee, 0x7e, 0x65, 0xed, 0x5e, 0x0d, 0xff, 0x7e, 0xa1, 0x1c, 0x47, 0x70, 0x7b,
+    0xc3, 0x9b, 0x7d, 0xa1, 0x69, 0xdc, 0x91, 0xb3, 0x9a, 0xdb, 0x2c, 0x53, 0xbf, 0xfc, 0x20, 0xe8,
+    0x1c, 0x26, 0x4b, 0x8f, 0xb0, 0x8f, 0x59, 0x69, 0x0f, 0xc0, 0xc2, 0xa7, 0x74, 0x18, 0x04, 0x77,
+    0x05, 0xfa, 0x23, 0xca, 0x47, 0xd3, 0x82, 0x07, 0x13, 0xfd, 0x1b, 0x8d, 0x2d, 0x02, 0xfd, 0xff,
+    0xf2, 0xff, 0xb3, 0xbd, 0x7c, 0x8e, 0xd2, 0x08, 0xc4, 0x32, 0x8a, 0x8b, 0x3d, 0xb1, 0x79, 0xac,
+    0x46, 0x5a, 0xd8, 0xfc, 0x2f, 0xb6, 0x01, 0xf7, 0xe6, 0x3c, 0x5a, 0x94, 0x62, 0xfe, 0xcd, 0x8b,
+    0xc0, 0x0c, 0x5d, 0xb1, 0x04, 0xfa, 0x68, 0xd7, 0x0d, 0x97, 0xe7, 0x23, 0x19, 0x36, 0xb2, 0xa2,
+    0xff, 0x01, 0xd3, 0x11, 0xc3, 0x45, 0x11, 0x76, 0xa4, 0xf9, 0x93, 0xec, 0x28, 0xfb, 0xd7, 0xff,
+    0xf7, 0x08, 0xce, 0xfb, 0xa6, 0x6a, 0x93, 0x08, 0x8e, 0x8b, 0xf3, 0x31, 0x7d, 0x67, 0x4f, 0xfd,
+    0xc2, 0x98, 0x7f, 0x84, 0xb1, 0xe7, 0x85, 0xad, 0xf0, 0x42, 0xbe, 0x96, 0x72, 0xc3, 0xb1, 0x97,
+    0xf0, 0x82, 0x8b, 0x57, 0xd6, 0x5e, 0x0f, 0xbf, 0x39, 0xca, 0x44, 0x8e, 0xc0, 0xbd, 0xbf, 0x99,
+    0xf1, 0x75, 0x91, 0x6f, 0x7d, 0x34, 0xd3, 0x38, 0x7f, 0x4d, 0xe4, 0x27, 0x67, 0xe0, 0x83, 0xd6,
+    0x56, 0xc9, 0x55, 0xb7, 0x2d, 0x7f, 0x68, 0x72, 0xb7, 0x7e, 0xa1, 0xf0, 0x22, 0x30, 0x61, 0x73,
+    0xdf, 0xef, 0x3c, 0x7b, 0x46, 0xaa, 0xd1, 0x0d, 0xb4, 0xda, 0xc1, 0x3f, 0x60, 0x74, 0xe7, 0x91,
+    0x00, 0x1b, 0x47, 0x00, 0xb2, 0x8f, 0xa3, 0x73, 0x26, 0x1f, 0x42, 0x24, 0x5f, 0x95, 0xe6, 0xe3,
+    0x00, 0x37, 0x29, 0xdd, 0x63, 0x2e, 0x1c, 0x0e, 0xce, 0x93, 0xec, 0x1f, 0x80, 0xfa, 0xfa, 0x03,
+    0x9e, 0xce, 0xc6, 0x4f, 0x82, 0x7f, 0x61, 0x7c, 0xde, 0xb2, 0x1f, 0x81, 0x39, 0x5c, 0x59, 0x8e,
+    0x0c, 0x9f, 0x52, 0x4b, 0x56, 0x92, 0x18, 0xa9, 0x36, 0xd4, 0xf0, 0x0e, 0x27, 0x8c, 0xba, 0xcc,
+    0x49, 0x42, 0xc7, 0xda, 0x5b, 0x61, 0x3f, 0x6b, 0x20, 0xd6, 0x96, 0x4f, 0x41, 0x74, 0xde, 0xa8,
+    0x80, 0x1d, 0x3b, 0xe3, 0x4d, 0xa6, 0xf9, 0xea, 0x07, 0xfc, 0x4d, 0x6e, 0xf0, 0x13, 0xd7, 0xd7,
+    0xad, 0xfe, 0xfa, 0x61, 0xea, 0xf4, 0xb4, 0xca, 0x26, 0x77, 0xae, 0xef, 0x98, 0x38, 0x87, 0x79,
+    0x91, 0x78, 0xf5, 0x8a, 0xfb, 0x63, 0xb3, 0x4b, 0x5b, 0x5e, 0x7c, 0xd6, 0x75, 0x13, 0x13, 0xc8,
+    0xff, 0x3c, 0x7f, 0xe2, 0x69, 0x19, 0xdb, 0x22, 0x08, 0xc6, 0x48, 0xd4, 0x67, 0x5a, 0xd4, 0x2c,
+    0xe1, 0x8c, 0x9e, 0xe6, 0x5d, 0x73, 0xc2, 0x37, 0x82, 0xc6, 0x33, 0xb8, 0xf8, 0x34, 0xf1, 0xc1,
+    0xdd, 0x09, 0x32, 0x21, 0xdd, 0xcf, 0x2f, 0x6b, 0xe5, 0xbb, 0xba, 0xd2, 0xbb, 0x57, 0x3f, 0x3c,
+    0x8c, 0x0e, 0xea, 0xe0, 0xe7, 0x7d, 0x98, 0x58, 0xd1, 0x17, 0x36, 0xe2, 0x84, 0xaf, 0x2c, 0xf0,
+    0xf6, 0xa6, 0xde, 0x6b, 0x75, 0xf3, 0x69, 0x32, 0x5f, 0x87, 0x99, 0x61, 0xf2, 0x7a, 0x9d, 0x65,
+    0x5c, 0x3c, 0xa3, 0xbd, 0xe6, 0xb8, 0x05, 0xa5, 0x9b, 0xad, 0x94, 0x93, 0x03, 0x20, 0xeb, 0x0d,
+    0xde, 0xe5, 0x22, 0xbe, 0xef, 0xea, 0xe2, 0x35, 0xee, 0x4f, 0xeb, 0x42, 0x3b, 0x87, 0xab, 0x62,
+    0x9b, 0x37, 0xa1, 0x5b, 0x86, 0x04, 0x7a, 0x50, 0x7c, 0xff, 0xf4, 0x0f, 0xc7, 0x23, 0xfb, 0xe5,
+    0xc3, 0xe6, 0xfa, 0x28, 0x79, 0xaa, 0xd1, 0x79, 0xb8, 0xec, 0xef, 0xdd, 0xb1, 0xd3, 0x12, 0xe1,
+    0x87, 0x0a, 0x73, 0x32, 0x06, 0xe2, 0xdb, 0xf6, 0xa1, 0xb0, 0xce, 0x86, 0x97, 0x13, 0x26, 0x0c,
+    0xe5, 0x6f, 0xca, 0x00, 0x92, 0x98, 0x3f, 0x7e, 0xb0, 0xb8, 0x71, 0xb2, 0x35, 0xbd, 0x66, 0x78,
+    0x54, 0x44, 0xff, 0x94, 0x2f, 0x5d, 0xd4, 0xfd, 0x60, 0x05, 0x62, 0x89, 0xc5, 0x3c, 0x34, 0xfa,
+    0x57, 0xca, 0x39, 0x1d, 0xb3, 0x8e, 0xb2, 0xa2, 0x2e, 0x5d, 0xb6, 0x1b, 0x71, 0x46, 0x73, 0x5e,
+    0xb5, 0xf0, 0x4e, 0x7d, 0xa1, 0xaf, 0xa7, 0x56, 0xb9, 0xde, 0x8d, 0xbe, 0xc8, 0x95, 0x69, 0x54,
+    0x17, 0x3f, 0x6c, 0xac, 0xce, 0x9c, 0x53, 0xca, 0xdf, 0x5f, 0xb4, 0x43, 0x7f, 0x11, 0xef, 0x16,
+    0x4d, 0xc3, 0x62, 0xfa, 0x2f, 0x3f, 0x21, 0xa9, 0xbf, 0xe4, 0xc5, 0x20, 0xeb, 0xe3, 0x57, 0x58,
+    0x3d, 0xce, 0xff, 0xbc, 0x79, 0xf9, 0xf9, 0xbd, 0xc6, 0xe1, 0x29, 0x2d, 0x08, 0x0e, 0x1d, 0x8b,
+    0xaf, 0x8b, 0x76, 0x1b, 0x2d, 0x3e, 0xee, 0x64, 0x38, 0xfc, 0xfa, 0xfa, 0x75, 0xff, 0x6d, 0x6b,
+    0x89, 0xe6, 0x74, 0x2b, 0x24, 0xf0, 0x24, 0x74, 0x7f, 0x05, 0xbb, 0x9d, 0x4b, 0x21, 0xad, 0x93,
+    0x7c, 0x82, 0x14, 0x9c, 0xc1, 0xcf, 0x35, 0xac, 0x0d, 0x7e, 0x2b, 0x4c, 0x63, 0x00, 0xe8, 0xf4,
+    0x59, 0x0f, 0x7e, 0x49, 0xee, 0xc6, 0x33, 0x8f, 0x90, 0x86, 0xc3, 0xb2, 0xc9, 0x14, 0x28, 0xad,
+    0x0f, 0xb8, 0xe5, 0xfd, 0x63, 0x14, 0x21, 0x6a, 0x85, 0xe4, 0x82, 0xf7, 0x9d, 0x64, 0x0e, 0x8d,
+    0x68, 0xdb, 0x09, 0x79, 0x5e, 0x0a, 0x4e, 0xde, 0x91, 0x60, 0x62, 0x77, 0xf4, 0x2d, 0xdb, 0x89,
+    0x34, 0x48, 0xa9, 0xd8, 0x86, 0x2d, 0x02, 0xa7, 0x88, 0x91, 0x0f, 0xb8, 0xbb, 0x9f, 0xd6, 0xfd,
+    0x45, 0x39, 0x49, 0x65, 0xc6, 0x27, 0xe5, 0x35, 0x83, 0xa5, 0x61, 0x0b, 0xcb, 0x14, 0x1f, 0xf4,
+    0xa0, 0x69, 0xc2, 0x5a, 0xf0, 0x47, 0xb7, 0xd3, 0x3a, 0x75, 0x63, 0x43, 0x90, 0x9a, 0xa4, 0xe5,
+    0x6b, 0x32, 0xff, 0x3a, 0x7f, 0x23, 0x50, 0x0d, 0xce, 0x31, 0x70, 0x91, 0x5d, 0xff, 0xbc, 0xc1,
+    0x0e, 0xfc, 0xc6, 0xed, 0x2d, 0x3f, 0xff, 0xd9, 0x0d, 0x46, 0x6f, 0x1b, 0x8d, 0x32, 0x70, 0x53,
+    0x25, 0x19, 0x26, 0x6c, 0xd5, 0xb7, 0xf3, 0x64, 0x3e, 0x50, 0xe8, 0x1b, 0x1d, 0x39, 0x69, 0x92,
+    0x43, 0x66, 0x69, 0xed, 0x89, 0x2c, 0x36, 0x38, 0x8c, 0x4c, 0x1b, 0xbd, 0xb6, 0xf7, 0x32, 0x6f,
+    0xcf, 0x6f, 0x39, 0xe3, 0xde, 0xcc, 0x6f, 0xcd, 0x8e, 0x93, 0x72, 0xb8, 0x26, 0xc4, 0x76, 0x7e,
+    0xd4, 0xec, 0x42, 0x76, 0x28, 0xc9, 0x52, 0xee, 0x61, 0x8a, 0x16, 0x81, 0x17, 0x84, 0x8e, 0x78,
+    0x89, 0x75, 0x73, 0x28, 0xe8, 0x00, 0x23, 0x3d, 0x7f, 0x46, 0x5a, 0x63, 0x6f, 0xd2, 0xae, 0x73,
+    0x0f, 0xa7, 0x52, 0xbc, 0xd7, 0x54, 0xa6, 0xc7, 0x2c, 0xae, 0xc9, 0x85, 0x7e, 0x8e, 0x75, 0x91,
+    0x89, 0xf0, 0xc4, 0xf2, 0x41, 0xf3, 0x3e, 0x8e, 0x4c, 0x03, 0xdf, 0xfe, 0x53, 0xf4, 0xaf, 0x9f,
+    0xa1, 0x55, 0xce, 0xf1, 0x00, 0x1c, 0xc1, 0xe5, 0x4c, 0xf1, 0x64, 0x0f, 0xec, 0x86, 0x7b, 0xe3,
+    0x15, 0xd3, 0x78, 0xe7, 0x4e, 0x47, 0x69, 0x9f, 0x37, 0x1b, 0x88, 0xf4, 0x12, 0xc1, 0x98, 0xe2,
+    0x9a, 0x57, 0xc9, 0x86, 0x45, 0x9b, 0x70, 0x9a, 0x4c, 0x42, 0x2c, 0x9f, 0x20, 0x26, 0x40, 0xae,
+    0x8b, 0x97, 0x0a, 0x0c, 0x9c, 0xc6, 0x1f, 0x31, 0x16, 0x99, 0xe3, 0x4e, 0x63, 0x5b, 0xf5, 0x0c,
+    0x9b, 0xf9, 0x3e, 0xe3, 0xb2, 0x48, 0x9a, 0x22, 0xf6, 0x39, 0xfe, 0x2e, 0x56, 0xb8, 0x7b, 0xcc,
+    0xe1, 0x45, 0x03, 0xb8, 0x41, 0x06, 0x02, 0x3c, 0x27, 0x69, 0xc1, 0x9c, 0x81, 0xde, 0x36, 0xfb,
+    0xf9, 0x4c, 0xef, 0x88, 0x2b, 0x42, 0xfb, 0xc5, 0x79, 0xbf, 0x2c, 0x18, 0xd9, 0xc4, 0x4e, 0x19,
+    0xca, 0x50, 0x68, 0x5a, 0x9e, 0x1a, 0x48, 0xf7, 0x25, 0xb3, 0x4e, 0xd8, 0xee, 0x09, 0x7f, 0x56,
+    0x66, 0x59, 0xc3, 0x78, 0xd5, 0x19, 0x92, 0xe2, 0x67, 0xb9, 0x6c, 0x68, 0xc6, 0x25, 0xa3, 0x49,
+    0x70, 0xd4, 0x0c, 0x7c, 0xd1, 0xf1, 0x7b, 0x62, 0x22, 0x90, 0x53, 0xc9, 0x1a, 0x1d, 0x35, 0x22,
+    0x5f, 0x8f, 0x8c, 0xcd, 0xcf, 0x77, 0xd7, 0x4f, 0xfd, 0xf8, 0xe2, 0x3f, 0x42, 0x19, 0x6d, 0x76,
+    0x03, 0x13, 0x94, 0x49, 0xec, 0x69, 0x5a, 0xec, 0xf4, 0x47, 0x3e, 0xac, 0x9f, 0x30, 0x38, 0x18,
+    0x60, 0x56, 0x3f, 0x1d, 0xd0, 0x71, 0x0f, 0x06, 0x18, 0x7b, 0xc6, 0xcd, 0xf7, 0xfb, 0x7c, 0xc3,
+    0x44, 0x7e, 0x46, 0x3e, 0xaa, 0xc0, 0xea, 0x04, 0x39, 0xd0, 0xac, 0x17, 0xf8, 0xe8, 0x91, 0x9f,
+    0x49, 0x70, 0x13, 0x67, 0x9d, 0xd9, 0x7d, 0x74, 0x5a, 0x50, 0x4c, 0xdf, 0x3d, 0xce, 0x69, 0xa6,
+    0x5c, 0xdc, 0xbf, 0x75, 0xad, 0xeb, 0xa4, 0x64, 0x8b, 0x3a, 0x3f, 0xe6, 0x90, 0x22, 0x78, 0x7d,
+    0xf9, 0xe9, 0x01, 0x44, 0x4e, 0xa1, 0x2e, 0xf9, 0xf1, 0x17, 0xf3, 0x70, 0x1e, 0x5a, 0xa4, 0x08,
+    0x57, 0xf0, 0xc5, 0x45, 0x2c, 0xb9, 0x14, 0xaa, 0x07, 0x2a, 0xc9, 0xe5, 0xf1, 0x69, 0x26, 0x99,
+    0xab, 0x39, 0x76, 0x0d, 0x3d, 0x00, 0x7f, 0xea, 0xa5, 0xe8, 0xf7, 0x0e, 0x42, 0x59, 0x39, 0xea,
+    0xea, 0xa7, 0x43, 0x6d, 0x50, 0x3e, 0x3b, 0x8c, 0x3b, 0x71, 0x77, 0x3c, 0x2c, 0x83, 0x13, 0xa6,
+    0x91, 0xa9, 0x89, 0x51, 0xff, 0x8c, 0x82, 0x69, 0xaa, 0xfc, 0x4b, 0x34, 0x3c, 0x2d, 0x50, 0xac,
+    0xbc, 0xce, 0x32, 0x07, 0x5f, 0x3b, 0x45, 0xaa, 0xe0, 0xef, 0x50, 0x13, 0x49, 0xae, 0xfc, 0x97,
+    0x2b, 0x3d, 0x1a, 0xc5, 0xea, 0xb8, 0x1e, 0x1f, 0x11, 0x7a, 0x8e, 0xb5, 0xd0, 0x59, 0x50, 0x92,
+    0x87, 0x2b, 0x19, 0xc3, 0x82, 0x9b, 0x24, 0x36, 0xd4, 0x07, 0xe8, 0x2a, 0xb1, 0x23, 0x02, 0x94,
+    0x20, 0x66, 0xb8, 0xf2, 0x38, 0x13, 0x28, 0xef, 0xcb, 0x23, 0x51, 0xe7, 0x3c, 0x91, 0x2d, 0xe3,
+    0xb0, 0xd1, 0x9f, 0xba, 0x4b, 0xf0, 0xb6, 0x6b, 0xcd, 0xd6, 0x8e, 0x4b, 0x02, 0xf3, 0xe8, 0xe9,
+    0xef, 0xfb, 0xdd, 0x3e, 0x4d, 0x6f, 0x29, 0x66, 0x5c, 0x0f, 0xc2, 0x81, 0x1b, 0xf0, 0xb4, 0xde,
+    0xd3, 0x24, 0x33, 0x1b, 0x4f, 0xa3, 0xe7, 0x8f, 0xe0, 0x93, 0x62, 0x71, 0x12, 0x99, 0xfc, 0x9e,
+    0x8d, 0x40, 0x6a, 0xf9, 0x23, 0xe5, 0x22, 0x9a, 0xfb, 0xb7, 0xef, 0xd8, 0x87, 0x48, 0x76, 0x56,
+    0xc6, 0x1f, 0xc1, 0x7b, 0xfd, 0xac, 0x8e, 0x52, 0x1f, 0xcd, 0xd8, 0x69, 0x8c, 0xb8, 0x37, 0xf4,
+    0x10, 0x25, 0x4c, 0xb4, 0xb1, 0x41, 0xbf, 0xf6, 0x30, 0xe7, 0x3b, 0xe9, 0x97, 0x72, 0xaf, 0x13,
+    0x6b, 0x51, 0xcf, 0xb8, 0xd7, 0xed, 0x43, 0x5f, 0x9d, 0x5d, 0xdc, 0xb1, 0x34, 0xe5, 0x91, 0x2e,
+    0xc8, 0x18, 0x17, 0x8d, 0x29, 0xca, 0x41, 0xd1, 0x5f, 0xad, 0x54, 0xa9, 0xbe, 0x01, 0x4c, 0xc7,
+    0xb1, 0xd2, 0xed, 0xd6, 0xd8, 0x27, 0x39, 0x63, 0x72, 0x3c, 0xb0, 0xe6, 0x3b, 0x83, 0x20, 0xe2,
+    0x4d, 0x7b, 0x44, 0x93, 0x11, 0xc4, 0xc8, 0x2f, 0x49, 0x5b, 0x89, 0x4d, 0x13, 0x7e, 0x1b, 0x20,
+    0xae, 0xfb, 0xa6, 0x37, 0x6e, 0x67, 0x0f, 0xf9, 0x6d, 0x1a, 0x31, 0x26, 0xf1, 0xb6, 0x5c, 0xd8,
+    0x21, 0x9c, 0x56, 0xa4, 0x2c, 0x01, 0xe5, 0x8e, 0x13, 0x2b, 0xfd, 0x75, 0xe6, 0x4d, 0x76, 0xc0,
+    0x6a, 0xb8, 0xf1, 0xef, 0xd5, 0x1e, 0x4f, 0x78, 0x30, 0x64, 0x3e, 0x60, 0xb4, 0xa0, 0xb5, 0xb4,
+    0x88, 0x44, 0x6c, 0x8d, 0x7a, 0x8f, 0xbc, 0x6e, 0x42, 0xb8, 0x53, 0x7c, 0x02, 0x0e, 0x0a, 0x83,
+    0x06, 0x20, 0x45, 0xfd, 0x97, 0xfc, 0xa2, 0xb9, 0x6c, 0x5f, 0x83, 0xb2, 0xa2, 0xef, 0x85, 0x4e,
+    0x0e, 0x61, 0xd5, 0xe2, 0x0e, 0x88, 0xeb, 0x0c, 0x9b, 0xe1, 0xce, 0x27, 0xb8, 0x31, 0xa1, 0x23,
+    0x79, 0x9b, 0x82, 0x58, 0x1c, 0x7d, 0x3b, 0x45, 0x8f, 0x5f, 0xd0, 0xc3, 0x3a, 0x8a, 0x1b, 0xbb,
+    0xa9, 0x93, 0x5c, 0x81, 0x47, 0x3e, 0xb1, 0xfe, 0x07, 0x55, 0xc1, 0x65, 0xc4, 0xcb, 0x39, 0xf8,
+    0x1c, 0x3a, 0x3d, 0x92, 0x36, 0x2d, 0x11, 0xf8, 0xa7, 0xdc, 0xf2, 0x99, 0x10, 0xcc, 0x6f, 0x36,
+    0x18, 0x4e, 0x7f, 0xec, 0xf2, 0x7a, 0x8b, 0xd3, 0x28, 0xb6, 0x98, 0x90, 0x7e, 0xf9, 0x11, 0xc5,
+    0x77, 0x35, 0xf6, 0xe2, 0x2a, 0x01, 0x3f, 0x1d, 0xb8, 0xcb, 0x11, 0x47, 0xaa, 0xba, 0xe2, 0x23,
+    0xe5, 0xb4, 0x6a, 0x74, 0x6d, 0x16, 0x43, 0xf2, 0x81, 0xd6, 0x13, 0x0c, 0x41, 0xdd, 0x41, 0xa5,
+    0x1d, 0x0d, 0xc7, 0xe9, 0x57, 0x83, 0x3a, 0xc7, 0x5e, 0xdf, 0xd4, 0x95, 0xde, 0x4d, 0xe7, 0x6c,
+    0xe5, 0x27, 0xbf, 0xaf, 0x31, 0xc6, 0x74, 0x26, 0x73, 0xd0, 0xde, 0xc7, 0x23, 0x1b, 0xe5, 0xcf,
+    0xc8, 0xe4, 0x6c, 0xf6, 0x2a, 0xcf, 0x64, 0x82, 0xad, 0x05, 0x55, 0x06, 0xb6, 0xeb, 0x27, 0xba,
+    0xe3, 0x13, 0xc9, 0x66, 0x81, 0x90, 0xc4, 0x2e, 0x41, 0x70, 0x8f, 0x3f, 0x78, 0x82, 0xa4, 0xa5,
+    0x70, 0x18, 0xea, 0x19, 0xf5, 0xc9, 0x5d, 0x9c, 0xf8, 0xb0, 0x1d, 0x63, 0xba, 0x06, 0x43, 0x43,
+    0x42, 0x5a, 0x4c, 0x4a, 0x58, 0x7f, 0x07, 0xa8, 0x6d, 0x53, 0xeb, 0x82, 0x35, 0x29, 0xb9, 0xb6,
+    0xd5, 0xcd, 0x33, 0x1e, 0x00, 0xc3, 0xa8, 0x8f, 0xac, 0xb1, 0x25, 0xea, 0x58, 0x2f, 0x9f, 0xae,
+    0xf8, 0x03,
 };
+const ShaderModule Blob111 = { Blob111_Data, 5586u, 5466u, 111u };
 
 } // namespace detail
 } // namespace VulkanShaders
@@ -28,13 +28,12 @@
     Pipeline indices match ComputeRenderer3D::ShaderCompileStep() in
     src/GPU3D_Compute.cpp one for one.
 
-    The SPIR-V words live in per-stage translation units rather than in the
-    header so that including the public header stays cheap: the full module set
-    is a few megabytes of integer literals and would otherwise be re-parsed by
-    every consumer.
+    Every module is one zstd frame, inflated on first use by
+    Vk::InflateShaderModule(). The frames live in per-stage translation units
+    rather than in the header so that including the public header stays cheap.
 */
 
-// SPIR-V for src/GPU3D_Vulkan_shaders/CorrectCoverage.comp.
+// SPIR-V for src/GPU3D_Vulkan_shaders/CorrectCoverage.comp, one zstd frame per module.
 
 #include "GPU3D_Vulkan_ShaderBlobs.h"
 
@@ -45,1565 +44,828 @@ namespace VulkanShaders
 namespace detail
 {
 
-extern const uint32_t Blob036[4117];
-const uint32_t Blob036[4117] = {
-    0x07230203, 0x00010300, 0x0008000b, 0x0000021b, 0x00000000, 0x00020011, 0x00000001, 0x00020011,
-    0x0000002e, 0x0006000b, 0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e,
-    0x00000000, 0x00000001, 0x0006000f, 0x00000005, 0x00000004, 0x6e69616d, 0x00000000, 0x00000102,
-    0x00060010, 0x00000004, 0x00000011, 0x00000040, 0x00000001, 0x00000001, 0x00030003, 0x00000002,
-    0x000001c2, 0x000a0004, 0x475f4c47, 0x4c474f4f, 0x70635f45, 0x74735f70, 0x5f656c79, 0x656e696c,
-    0x7269645f, 0x69746365, 0x00006576, 0x00080004, 0x475f4c47, 0x4c474f4f, 0x6e695f45, 0x64756c63,
-    0x69645f65, 0x74636572, 0x00657669, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000, 0x000a0005,
-    0x0000000e, 0x65766f43, 0x65676172, 0x656c6954, 0x65786950, 0x3175286c, 0x3b31753b, 0x753b3175,
-    0x00003b31, 0x00060005, 0x0000000a, 0x796c6f70, 0x496e6f67, 0x7865646e, 0x00000000, 0x00030005,
-    0x0000000b, 0x00000078, 0x00030005, 0x0000000c, 0x00000079, 0x00050005, 0x0000000d, 0x656c6974,
-    0x65786950, 0x0000006c, 0x000a0005, 0x00000014, 0x65766f43, 0x65676172, 0x41736157, 0x70656363,
-    0x28646574, 0x753b3175, 0x31753b31, 0x0000003b, 0x00060005, 0x00000011, 0x796c6f70, 0x496e6f67,
-    0x7865646e, 0x00000000, 0x00030005, 0x00000012, 0x00000078, 0x00030005, 0x00000013, 0x00000079,
-    0x000b0005, 0x0000001b, 0x74697257, 0x6e695765, 0x676e696e, 0x65766f43, 0x65676172, 0x3b317528,
-    0x753b3175, 0x31753b31, 0x0000003b, 0x00060005, 0x00000017, 0x796c6f70, 0x496e6f67, 0x7865646e,
-    0x00000000, 0x00030005, 0x00000018, 0x00000078, 0x00030005, 0x00000019, 0x00000079, 0x00050005,
-    0x0000001a, 0x65766f63, 0x65676172, 0x00000000, 0x00040005, 0x0000001d, 0x656c6974, 0x00000058,
-    0x00040005, 0x00000021, 0x656c6974, 0x00000059, 0x00050005, 0x00000024, 0x656e696c, 0x69547261,
-    0x0000656c, 0x00050005, 0x00000028, 0x65726353, 0x69576e65, 0x00687464, 0x00060005, 0x0000002a,
-    0x656c6954, 0x72655073, 0x656e694c, 0x00000000, 0x00060005, 0x0000002f, 0x61636f6c, 0x6c6f506c,
-    0x6e6f6779, 0x00000000, 0x00060005, 0x00000031, 0x68737550, 0x736e6f43, 0x746e6174, 0x00000073,
-    0x00060006, 0x00000031, 0x00000000, 0x56727543, 0x61697261, 0x0000746e, 0x00060006, 0x00000031,
-    0x00000001, 0x57786554, 0x68746469, 0x00000000, 0x00060006, 0x00000031, 0x00000002, 0x48786554,
-    0x68676965, 0x00000074, 0x00060006, 0x00000031, 0x00000003, 0x57786554, 0x53706172, 0x00000000,
-    0x00060006, 0x00000031, 0x00000004, 0x57786554, 0x54706172, 0x00000000, 0x00070006, 0x00000031,
-    0x00000005, 0x49786554, 0x70614373, 0x65727574, 0x00000000, 0x00070006, 0x00000031, 0x00000006,
-    0x74706143, 0x59657275, 0x7366664f, 0x00007465, 0x00050006, 0x00000031, 0x00000007, 0x6461705f,
-    0x00000000, 0x00030005, 0x00000033, 0x00006370, 0x00040005, 0x00000039, 0x756f7267, 0x00000070,
-    0x00030005, 0x0000003d, 0x00746962, 0x00050005, 0x00000041, 0x6b73616d, 0x65646e49, 0x00000078,
-    0x00040005, 0x00000047, 0x6b73616d, 0x00000000, 0x00060005, 0x0000004e, 0x526e6942, 0x6c757365,
-    0x66754274, 0x00726566, 0x00080006, 0x0000004e, 0x00000000, 0x69726156, 0x57746e61, 0x436b726f,
-    0x746e756f, 0x00000000, 0x00080006, 0x0000004e, 0x00000001, 0x74726f53, 0x6f576465, 0x664f6b72,
-    0x74657366, 0x00000000, 0x00090006, 0x0000004e, 0x00000002, 0x69726156, 0x57746e61, 0x526b726f,
-    0x436c6165, 0x746e756f, 0x00000000, 0x00080006, 0x0000004e, 0x00000003, 0x74726f53, 0x6b726f57,
-    0x6b726f57, 0x6e756f43, 0x00000074, 0x00090006, 0x0000004e, 0x00000004, 0x6e6e6942, 0x4d676e69,
-    0x416b7361, 0x664f646e, 0x74657366, 0x00000000, 0x00030005, 0x00000050, 0x00000000, 0x00060005,
-    0x00000052, 0x65726353, 0x65486e65, 0x74686769, 0x00000000, 0x00050005, 0x00000053, 0x656c6954,
-    0x656e694c, 0x00000073, 0x00070005, 0x00000057, 0x6e6e6942, 0x4d676e69, 0x536b7361, 0x74726174,
-    0x00000000, 0x00050005, 0x00000068, 0x65776f6c, 0x73614d72, 0x0000006b, 0x00040005, 0x00000073,
-    0x6964726f, 0x006c616e, 0x00050005, 0x00000079, 0x6b726f77, 0x65646e49, 0x00000078, 0x00080005,
-    0x0000007d, 0x6e6e6942, 0x57676e69, 0x4f6b726f, 0x65736666, 0x74537374, 0x00747261, 0x00060005,
-    0x00000086, 0x5778614d, 0x546b726f, 0x73656c69, 0x00000000, 0x00050005, 0x0000008c, 0x656c6974,
-    0x656e6e49, 0x00000072, 0x00050005, 0x0000009a, 0x656c6974, 0x65786950, 0x0000006c, 0x00040005,
-    0x0000009b, 0x61726170, 0x0000006d, 0x00040005, 0x0000009d, 0x61726170, 0x0000006d, 0x00040005,
-    0x0000009f, 0x61726170, 0x0000006d, 0x00040005, 0x000000a1, 0x61726170, 0x0000006d, 0x00060005,
-    0x000000a7, 0x6f6c6f43, 0x6c695472, 0x66754265, 0x00726566, 0x00060006, 0x000000a7, 0x00000000,
-    0x6f6c6f43, 0x6c695472, 0x00007365, 0x00030005, 0x000000a9, 0x00000000, 0x00060005, 0x000000b2,
-    0x72747441, 0x656c6954, 0x66667542, 0x00007265, 0x00060006, 0x000000b2, 0x00000000, 0x72747441,
-    0x656c6954, 0x00000073, 0x00030005, 0x000000b4, 0x00000000, 0x00040005, 0x000000be, 0x65786970,
-    0x0000006c, 0x00040005, 0x000000c4, 0x67726174, 0x00007465, 0x00070005, 0x000000c7, 0x75736552,
-    0x6957746c, 0x72656e6e, 0x66667542, 0x00007265, 0x00070006, 0x000000c7, 0x00000000, 0x75736552,
-    0x6957746c, 0x72656e6e, 0x00000000, 0x00030005, 0x000000c9, 0x00000000, 0x00070005, 0x000000d3,
-    0x6d617246, 0x66756265, 0x53726566, 0x64697274, 0x00000065, 0x00040005, 0x000000e4, 0x72747461,
-    0x00000000, 0x00060005, 0x000000e6, 0x75736552, 0x7542746c, 0x72656666, 0x00000000, 0x00060006,
-    0x000000e6, 0x00000000, 0x75736552, 0x6156746c, 0x0065756c, 0x00030005, 0x000000e8, 0x00000000,
-    0x00070005, 0x000000ec, 0x75736552, 0x6544746c, 0x53687470, 0x74726174, 0x00000000, 0x00060005,
-    0x000000f0, 0x75736552, 0x7441746c, 0x74537274, 0x00747261, 0x00050005, 0x000000ff, 0x75746573,
-    0x646e4970, 0x00007865, 0x00080005, 0x00000102, 0x475f6c67, 0x61626f6c, 0x766e496c, 0x7461636f,
-    0x496e6f69, 0x00000044, 0x00040005, 0x0000010e, 0x75746573, 0x00000070, 0x00060005, 0x00000111,
-    0x75746553, 0x646e4970, 0x73656369, 0x00000000, 0x00060005, 0x00000116, 0x796c6f70, 0x496e6f67,
-    0x7865646e, 0x00000000, 0x00050005, 0x0000012c, 0x61705358, 0x7465536e, 0x00007075, 0x00040006,
-    0x0000012c, 0x00000000, 0x00003058, 0x00040006, 0x0000012c, 0x00000001, 0x00003158, 0x00060006,
-    0x0000012c, 0x00000002, 0x69736e49, 0x74536564, 0x00747261, 0x00060006, 0x0000012c, 0x00000003,
-    0x69736e49, 0x6e456564, 0x00000064, 0x00060006, 0x0000012c, 0x00000004, 0x65676445, 0x4c766f43,
-    0x00000000, 0x00060006, 0x0000012c, 0x00000005, 0x65676445, 0x52766f43, 0x00000000, 0x00050006,
-    0x0000012c, 0x00000006, 0x63655258, 0x00007069, 0x00050006, 0x0000012c, 0x00000007, 0x67616c46,
-    0x00000073, 0x00040006, 0x0000012c, 0x00000008, 0x0000305a, 0x00040006, 0x0000012c, 0x00000009,
-    0x0000315a, 0x00040006, 0x0000012c, 0x0000000a, 0x00003057, 0x00040006, 0x0000012c, 0x0000000b,
-    0x00003157, 0x00050006, 0x0000012c, 0x0000000c, 0x6f6c6f43, 0x00305272, 0x00050006, 0x0000012c,
-    0x0000000d, 0x6f6c6f43, 0x00304772, 0x00050006, 0x0000012c, 0x0000000e, 0x6f6c6f43, 0x00304272,
-    0x00050006, 0x0000012c, 0x0000000f, 0x6f6c6f43, 0x00315272, 0x00050006, 0x0000012c, 0x00000010,
-    0x6f6c6f43, 0x00314772, 0x00050006, 0x0000012c, 0x00000011, 0x6f6c6f43, 0x00314272, 0x00060006,
-    0x0000012c, 0x00000012, 0x63786554, 0x64726f6f, 0x00003055, 0x00060006, 0x0000012c, 0x00000013,
-    0x63786554, 0x64726f6f, 0x00003056, 0x00060006, 0x0000012c, 0x00000014, 0x63786554, 0x64726f6f,
-    0x00003155, 0x00060006, 0x0000012c, 0x00000015, 0x63786554, 0x64726f6f, 0x00003156, 0x00060006,
-    0x0000012c, 0x00000016, 0x4c766f43, 0x74696e49, 0x006c6169, 0x00060006, 0x0000012c, 0x00000017,
-    0x52766f43, 0x74696e49, 0x006c6169, 0x00040005, 0x0000012e, 0x6e617073, 0x00000000, 0x00050005,
-    0x0000012f, 0x61705358, 0x7465536e, 0x00007075, 0x00040006, 0x0000012f, 0x00000000, 0x00003058,
-    0x00040006, 0x0000012f, 0x00000001, 0x00003158, 0x00060006, 0x0000012f, 0x00000002, 0x69736e49,
-    0x74536564, 0x00747261, 0x00060006, 0x0000012f, 0x00000003, 0x69736e49, 0x6e456564, 0x00000064,
-    0x00060006, 0x0000012f, 0x00000004, 0x65676445, 0x4c766f43, 0x00000000, 0x00060006, 0x0000012f,
-    0x00000005, 0x65676445, 0x52766f43, 0x00000000, 0x00050006, 0x0000012f, 0x00000006, 0x63655258,
-    0x00007069, 0x00050006, 0x0000012f, 0x00000007, 0x67616c46, 0x00000073, 0x00040006, 0x0000012f,
-    0x00000008, 0x0000305a, 0x00040006, 0x0000012f, 0x00000009, 0x0000315a, 0x00040006, 0x0000012f,
-    0x0000000a, 0x00003057, 0x00040006, 0x0000012f, 0x0000000b, 0x00003157, 0x00050006, 0x0000012f,
-    0x0000000c, 0x6f6c6f43, 0x00305272, 0x00050006, 0x0000012f, 0x0000000d, 0x6f6c6f43, 0x00304772,
-    0x00050006, 0x0000012f, 0x0000000e, 0x6f6c6f43, 0x00304272, 0x00050006, 0x0000012f, 0x0000000f,
-    0x6f6c6f43, 0x00315272, 0x00050006, 0x0000012f, 0x00000010, 0x6f6c6f43, 0x00314772, 0x00050006,
-    0x0000012f, 0x00000011, 0x6f6c6f43, 0x00314272, 0x00060006, 0x0000012f, 0x00000012, 0x63786554,
-    0x64726f6f, 0x00003055, 0x00060006, 0x0000012f, 0x00000013, 0x63786554, 0x64726f6f, 0x00003056,
-    0x00060006, 0x0000012f, 0x00000014, 0x63786554, 0x64726f6f, 0x00003155, 0x00060006, 0x0000012f,
-    0x00000015, 0x63786554, 0x64726f6f, 0x00003156, 0x00060006, 0x0000012f, 0x00000016, 0x4c766f43,
-    0x74696e49, 0x006c6169, 0x00060006, 0x0000012f, 0x00000017, 0x52766f43, 0x74696e49, 0x006c6169,
-    0x00070005, 0x00000131, 0x61705358, 0x7465536e, 0x42737075, 0x65666675, 0x00000072, 0x00060006,
-    0x00000131, 0x00000000, 0x61705358, 0x7465536e, 0x00737075, 0x00030005, 0x00000133, 0x00000000,
-    0x00030005, 0x0000017c, 0x00000079, 0x00030005, 0x00000186, 0x00000078, 0x00050005, 0x0000018a,
-    0x65726373, 0x6e456e65, 0x00000064, 0x00040005, 0x0000018b, 0x7466656c, 0x00646e45, 0x00040005,
-    0x00000198, 0x766f6378, 0x00000000, 0x00040005, 0x000001a5, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001a7, 0x61726170, 0x0000006d, 0x00040005, 0x000001a8, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001b5, 0x61726170, 0x0000006d, 0x00040005, 0x000001b7, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001b8, 0x61726170, 0x0000006d, 0x00040005, 0x000001ba, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001c8, 0x79646f62, 0x00646e45, 0x00050005, 0x000001d3, 0x68676972, 0x646e4574, 0x00000000,
-    0x00040005, 0x000001dd, 0x766f6378, 0x00000000, 0x00040005, 0x000001ea, 0x61726170, 0x0000006d,
-    0x00040005, 0x000001ec, 0x61726170, 0x0000006d, 0x00040005, 0x000001ed, 0x61726170, 0x0000006d,
-    0x00040005, 0x000001fc, 0x61726170, 0x0000006d, 0x00040005, 0x000001fe, 0x61726170, 0x0000006d,
-    0x00040005, 0x000001ff, 0x61726170, 0x0000006d, 0x00040005, 0x00000201, 0x61726170, 0x0000006d,
-    0x00050005, 0x00000210, 0x6174654d, 0x66696e55, 0x006d726f, 0x00060006, 0x00000210, 0x00000000,
-    0x506d754e, 0x67796c6f, 0x00736e6f, 0x00060006, 0x00000210, 0x00000001, 0x566d754e, 0x61697261,
-    0x0073746e, 0x00060006, 0x00000210, 0x00000002, 0x68706c41, 0x66655261, 0x00000000, 0x00050006,
-    0x00000210, 0x00000003, 0x70736944, 0x00746e43, 0x00060006, 0x00000210, 0x00000004, 0x6e6f6f54,
-    0x6c626154, 0x00000065, 0x00060006, 0x00000210, 0x00000005, 0x61656c43, 0x6c6f4372, 0x0000726f,
-    0x00060006, 0x00000210, 0x00000006, 0x61656c43, 0x70654472, 0x00006874, 0x00060006, 0x00000210,
-    0x00000007, 0x61656c43, 0x74744172, 0x00000072, 0x00060006, 0x00000210, 0x00000008, 0x4f676f46,
-    0x65736666, 0x00000074, 0x00060006, 0x00000210, 0x00000009, 0x53676f46, 0x74666968, 0x00000000,
-    0x00060006, 0x00000210, 0x0000000a, 0x43676f46, 0x726f6c6f, 0x00000000, 0x00080006, 0x00000210,
-    0x0000000b, 0x61656c43, 0x74694272, 0x4f70616d, 0x65736666, 0x00000074, 0x00030005, 0x00000212,
-    0x00000000, 0x00060005, 0x00000216, 0x74706544, 0x6c695468, 0x66754265, 0x00726566, 0x00060006,
-    0x00000216, 0x00000000, 0x74706544, 0x6c695468, 0x00007365, 0x00030005, 0x00000218, 0x00000000,
-    0x00040047, 0x00000028, 0x00000001, 0x00000000, 0x00050048, 0x00000031, 0x00000000, 0x00000023,
-    0x00000000, 0x00050048, 0x00000031, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x00000031,
-    0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x00000031, 0x00000003, 0x00000023, 0x0000000c,
-    0x00050048, 0x00000031, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x00000031, 0x00000005,
-    0x00000023, 0x00000014, 0x00050048, 0x00000031, 0x00000006, 0x00000023, 0x00000018, 0x00050048,
-    0x00000031, 0x00000007, 0x00000023, 0x0000001c, 0x00030047, 0x00000031, 0x00000002, 0x00040047,
-    0x0000004a, 0x00000006, 0x00000010, 0x00040047, 0x0000004b, 0x00000006, 0x00000004, 0x00040047,
-    0x0000004c, 0x00000006, 0x00000004, 0x00040047, 0x0000004d, 0x00000006, 0x00000004, 0x00050048,
-    0x0000004e, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x0000004e, 0x00000001, 0x00000023,
-    0x00008000, 0x00050048, 0x0000004e, 0x00000002, 0x00000023, 0x0000a000, 0x00050048, 0x0000004e,
-    0x00000003, 0x00000023, 0x0000c000, 0x00050048, 0x0000004e, 0x00000004, 0x00000023, 0x0000c010,
-    0x00030047, 0x0000004e, 0x00000002, 0x00040047, 0x00000050, 0x00000022, 0x00000000, 0x00040047,
-    0x00000050, 0x00000021, 0x00000008, 0x00040047, 0x00000052, 0x00000001, 0x00000001, 0x00040047,
-    0x00000086, 0x00000001, 0x00000002, 0x00040047, 0x000000a6, 0x00000006, 0x00000004, 0x00050048,
-    0x000000a7, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x000000a7, 0x00000002, 0x00040047,
-    0x000000a9, 0x00000022, 0x00000000, 0x00040047, 0x000000a9, 0x00000021, 0x00000004, 0x00040047,
-    0x000000b1, 0x00000006, 0x00000004, 0x00050048, 0x000000b2, 0x00000000, 0x00000023, 0x00000000,
-    0x00030047, 0x000000b2, 0x00000002, 0x00040047, 0x000000b4, 0x00000022, 0x00000000, 0x00040047,
-    0x000000b4, 0x00000021, 0x00000006, 0x00040047, 0x000000c6, 0x00000006, 0x00000004, 0x00050048,
-    0x000000c7, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x000000c7, 0x00000002, 0x00040047,
-    0x000000c9, 0x00000022, 0x00000000, 0x00040047, 0x000000c9, 0x00000021, 0x00000010, 0x00040047,
-    0x000000e5, 0x00000006, 0x00000004, 0x00050048, 0x000000e6, 0x00000000, 0x00000023, 0x00000000,
-    0x00030047, 0x000000e6, 0x00000002, 0x00040047, 0x000000e8, 0x00000022, 0x00000000, 0x00040047,
-    0x000000e8, 0x00000021, 0x00000007, 0x00040047, 0x00000102, 0x0000000b, 0x0000001c, 0x00040047,
-    0x00000111, 0x00000022, 0x00000000, 0x00040047, 0x00000111, 0x00000021, 0x0000000a, 0x00050048,
-    0x0000012f, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x0000012f, 0x00000001, 0x00000023,
-    0x00000004, 0x00050048, 0x0000012f, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x0000012f,
-    0x00000003, 0x00000023, 0x0000000c, 0x00050048, 0x0000012f, 0x00000004, 0x00000023, 0x00000010,
-    0x00050048, 0x0000012f, 0x00000005, 0x00000023, 0x00000014, 0x00050048, 0x0000012f, 0x00000006,
-    0x00000023, 0x00000018, 0x00050048, 0x0000012f, 0x00000007, 0x00000023, 0x0000001c, 0x00050048,
-    0x0000012f, 0x00000008, 0x00000023, 0x00000020, 0x00050048, 0x0000012f, 0x00000009, 0x00000023,
-    0x00000024, 0x00050048, 0x0000012f, 0x0000000a, 0x00000023, 0x00000028, 0x00050048, 0x0000012f,
-    0x0000000b, 0x00000023, 0x0000002c, 0x00050048, 0x0000012f, 0x0000000c, 0x00000023, 0x00000030,
-    0x00050048, 0x0000012f, 0x0000000d, 0x00000023, 0x00000034, 0x00050048, 0x0000012f, 0x0000000e,
-    0x00000023, 0x00000038, 0x00050048, 0x0000012f, 0x0000000f, 0x00000023, 0x0000003c, 0x00050048,
-    0x0000012f, 0x00000010, 0x00000023, 0x00000040, 0x00050048, 0x0000012f, 0x00000011, 0x00000023,
-    0x00000044, 0x00050048, 0x0000012f, 0x00000012, 0x00000023, 0x00000048, 0x00050048, 0x0000012f,
-    0x00000013, 0x00000023, 0x0000004c, 0x00050048, 0x0000012f, 0x00000014, 0x00000023, 0x00000050,
-    0x00050048, 0x0000012f, 0x00000015, 0x00000023, 0x00000054, 0x00050048, 0x0000012f, 0x00000016,
-    0x00000023, 0x00000058, 0x00050048, 0x0000012f, 0x00000017, 0x00000023, 0x0000005c, 0x00040047,
-    0x00000130, 0x00000006, 0x00000060, 0x00050048, 0x00000131, 0x00000000, 0x00000023, 0x00000000,
-    0x00030047, 0x00000131, 0x00000002, 0x00040047, 0x00000133, 0x00000022, 0x00000000, 0x00040047,
-    0x00000133, 0x00000021, 0x00000002, 0x00040047, 0x0000020d, 0x00000006, 0x00000010, 0x00050048,
-    0x00000210, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000210, 0x00000001, 0x00000023,
-    0x00000004, 0x00050048, 0x00000210, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x00000210,
-    0x00000003, 0x00000023, 0x0000000c, 0x00050048, 0x00000210, 0x00000004, 0x00000023, 0x00000010,
-    0x00050048, 0x00000210, 0x00000005, 0x00000023, 0x00000230, 0x00050048, 0x00000210, 0x00000006,
-    0x00000023, 0x00000234, 0x00050048, 0x00000210, 0x00000007, 0x00000023, 0x00000238, 0x00050048,
-    0x00000210, 0x00000008, 0x00000023, 0x0000023c, 0x00050048, 0x00000210, 0x00000009, 0x00000023,
-    0x00000240, 0x00050048, 0x00000210, 0x0000000a, 0x00000023, 0x00000244, 0x00050048, 0x00000210,
-    0x0000000b, 0x00000023, 0x00000248, 0x00030047, 0x00000210, 0x00000002, 0x00040047, 0x00000212,
-    0x00000022, 0x00000000, 0x00040047, 0x00000212, 0x00000021, 0x00000000, 0x00040047, 0x00000215,
-    0x00000006, 0x00000004, 0x00050048, 0x00000216, 0x00000000, 0x00000023, 0x00000000, 0x00030047,
-    0x00000216, 0x00000002, 0x00040047, 0x00000218, 0x00000022, 0x00000000, 0x00040047, 0x00000218,
-    0x00000021, 0x00000005, 0x00040047, 0x0000021a, 0x0000000b, 0x00000019, 0x00020013, 0x00000002,
-    0x00030021, 0x00000003, 0x00000002, 0x00040015, 0x00000006, 0x00000020, 0x00000000, 0x00040020,
-    0x00000007, 0x00000007, 0x00000006, 0x00020014, 0x00000008, 0x00070021, 0x00000009, 0x00000008,
-    0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00060021, 0x00000010, 0x00000008, 0x00000007,
-    0x00000007, 0x00000007, 0x00070021, 0x00000016, 0x00000002, 0x00000007, 0x00000007, 0x00000007,
-    0x00000007, 0x0004002b, 0x00000006, 0x0000001f, 0x00000008, 0x00040015, 0x00000027, 0x00000020,
-    0x00000001, 0x00040032, 0x00000027, 0x00000028, 0x00000100, 0x0004002b, 0x00000027, 0x00000029,
-    0x00000008, 0x00060034, 0x00000027, 0x0000002a, 0x00000087, 0x00000028, 0x00000029, 0x0004002b,
-    0x00000006, 0x0000002b, 0x00000000, 0x00060034, 0x00000006, 0x0000002c, 0x00000080, 0x0000002a,
-    0x0000002b, 0x000a001e, 0x00000031, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000027, 0x00000006, 0x00040020, 0x00000032, 0x00000009, 0x00000031, 0x0004003b,
-    0x00000032, 0x00000033, 0x00000009, 0x0004002b, 0x00000027, 0x00000034, 0x00000000, 0x00040020,
-    0x00000035, 0x00000009, 0x00000006, 0x0004002b, 0x00000006, 0x0000003b, 0x00000005, 0x0004002b,
-    0x00000006, 0x0000003f, 0x0000001f, 0x0004002b, 0x00000006, 0x00000043, 0x00000040, 0x00040017,
-    0x00000048, 0x00000006, 0x00000004, 0x0004002b, 0x00000006, 0x00000049, 0x00000800, 0x0004001c,
-    0x0000004a, 0x00000048, 0x00000049, 0x0004001c, 0x0000004b, 0x00000006, 0x00000049, 0x0004001c,
-    0x0000004c, 0x00000006, 0x00000049, 0x0003001d, 0x0000004d, 0x00000006, 0x0007001e, 0x0000004e,
-    0x0000004a, 0x0000004b, 0x0000004c, 0x00000048, 0x0000004d, 0x00040020, 0x0000004f, 0x0000000c,
-    0x0000004e, 0x0004003b, 0x0000004f, 0x00000050, 0x0000000c, 0x0004002b, 0x00000027, 0x00000051,
-    0x00000004, 0x00040032, 0x00000027, 0x00000052, 0x000000c0, 0x00060034, 0x00000027, 0x00000053,
-    0x00000087, 0x00000052, 0x00000029, 0x00060034, 0x00000027, 0x00000054, 0x00000084, 0x0000002a,
-    0x00000053, 0x0004002b, 0x00000027, 0x00000055, 0x00000002, 0x00060034, 0x00000027, 0x00000056,
-    0x00000084, 0x00000054, 0x00000055, 0x00060034, 0x00000027, 0x00000057, 0x00000080, 0x00000034,
-    0x00000056, 0x00040020, 0x0000005b, 0x0000000c, 0x00000006, 0x0004002b, 0x00000006, 0x0000005f,
-    0x00000001, 0x0003002a, 0x00000008, 0x00000066, 0x00060034, 0x00000027, 0x0000007a, 0x00000084,
-    0x0000002a, 0x00000053, 0x0004002b, 0x00000027, 0x0000007b, 0x00000040, 0x00060034, 0x00000027,
-    0x0000007c, 0x00000084, 0x0000007a, 0x0000007b, 0x00060034, 0x00000027, 0x0000007d, 0x00000080,
-    0x00000057, 0x0000007c, 0x00040032, 0x00000027, 0x00000086, 0x00003000, 0x00060034, 0x00000006,
-    0x00000087, 0x00000080, 0x00000086, 0x0000002b, 0x00030029, 0x00000008, 0x00000097, 0x0003001d,
-    0x000000a6, 0x00000006, 0x0003001e, 0x000000a7, 0x000000a6, 0x00040020, 0x000000a8, 0x0000000c,
-    0x000000a7, 0x0004003b, 0x000000a8, 0x000000a9, 0x0000000c, 0x0003001d, 0x000000b1, 0x00000006,
-    0x0003001e, 0x000000b2, 0x000000b1, 0x00040020, 0x000000b3, 0x0000000c, 0x000000b2, 0x0004003b,
-    0x000000b3, 0x000000b4, 0x0000000c, 0x0004002b, 0x00000006, 0x000000b8, 0x80000000, 0x00060034,
-    0x00000006, 0x000000c0, 0x00000080, 0x00000028, 0x0000002b, 0x0004002b, 0x00000006, 0x000000c5,
-    0xffffffff, 0x0003001d, 0x000000c6, 0x00000006, 0x0003001e, 0x000000c7, 0x000000c6, 0x00040020,
-    0x000000c8, 0x0000000c, 0x000000c7, 0x0004003b, 0x000000c8, 0x000000c9, 0x0000000c, 0x00060034,
-    0x00000027, 0x000000d3, 0x00000084, 0x00000028, 0x00000052, 0x00060034, 0x00000006, 0x000000d4,
-    0x00000080, 0x000000d3, 0x0000002b, 0x00060034, 0x00000006, 0x000000dd, 0x00000080, 0x000000d3,
-    0x0000002b, 0x0003001d, 0x000000e5, 0x00000006, 0x0003001e, 0x000000e6, 0x000000e5, 0x00040020,
-    0x000000e7, 0x0000000c, 0x000000e6, 0x0004003b, 0x000000e7, 0x000000e8, 0x0000000c, 0x00060034,
-    0x00000027, 0x000000e9, 0x00000084, 0x00000028, 0x00000052, 0x00060034, 0x00000027, 0x000000ea,
-    0x00000084, 0x000000e9, 0x00000055, 0x00060034, 0x00000006, 0x000000eb, 0x00000080, 0x000000ea,
-    0x0000002b, 0x00060034, 0x00000006, 0x000000ec, 0x00000080, 0x0000002b, 0x000000eb, 0x00060034,
-    0x00000027, 0x000000ed, 0x00000084, 0x00000028, 0x00000052, 0x00060034, 0x00000027, 0x000000ee,
-    0x00000084, 0x000000ed, 0x00000055, 0x00060034, 0x00000006, 0x000000ef, 0x00000080, 0x000000ee,
-    0x0000002b, 0x00060034, 0x00000006, 0x000000f0, 0x00000080, 0x000000ec, 0x000000ef, 0x0004002b,
-    0x00000006, 0x000000f8, 0xffffe0ff, 0x00040017, 0x00000100, 0x00000006, 0x00000003, 0x00040020,
-    0x00000101, 0x00000001, 0x00000100, 0x0004003b, 0x00000101, 0x00000102, 0x00000001, 0x00040020,
-    0x00000103, 0x00000001, 0x00000006, 0x00040020, 0x0000010d, 0x00000007, 0x00000048, 0x00090019,
-    0x0000010f, 0x00000006, 0x00000005, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000,
-    0x00040020, 0x00000110, 0x00000000, 0x0000010f, 0x0004003b, 0x00000110, 0x00000111, 0x00000000,
-    0x0004002b, 0x00000027, 0x00000123, 0x00000001, 0x001a001e, 0x0000012c, 0x00000027, 0x00000027,
-    0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000006, 0x00000027, 0x00000027,
-    0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000027,
-    0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00040020, 0x0000012d,
-    0x00000007, 0x0000012c, 0x001a001e, 0x0000012f, 0x00000027, 0x00000027, 0x00000027, 0x00000027,
-    0x00000027, 0x00000027, 0x00000027, 0x00000006, 0x00000027, 0x00000027, 0x00000027, 0x00000027,
-    0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000027,
-    0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x0003001d, 0x00000130, 0x0000012f, 0x0003001e,
-    0x00000131, 0x00000130, 0x00040020, 0x00000132, 0x0000000c, 0x00000131, 0x0004003b, 0x00000132,
-    0x00000133, 0x0000000c, 0x00040020, 0x00000135, 0x0000000c, 0x0000012f, 0x00040020, 0x00000139,
-    0x00000007, 0x00000027, 0x0004002b, 0x00000027, 0x00000140, 0x00000003, 0x0004002b, 0x00000027,
-    0x00000145, 0x00000005, 0x0004002b, 0x00000027, 0x00000148, 0x00000006, 0x0004002b, 0x00000027,
-    0x0000014b, 0x00000007, 0x0004002b, 0x00000027, 0x00000150, 0x00000009, 0x0004002b, 0x00000027,
-    0x00000153, 0x0000000a, 0x0004002b, 0x00000027, 0x00000156, 0x0000000b, 0x0004002b, 0x00000027,
-    0x00000159, 0x0000000c, 0x0004002b, 0x00000027, 0x0000015c, 0x0000000d, 0x0004002b, 0x00000027,
-    0x0000015f, 0x0000000e, 0x0004002b, 0x00000027, 0x00000162, 0x0000000f, 0x0004002b, 0x00000027,
-    0x00000165, 0x00000010, 0x0004002b, 0x00000027, 0x00000168, 0x00000011, 0x0004002b, 0x00000027,
-    0x0000016b, 0x00000012, 0x0004002b, 0x00000027, 0x0000016e, 0x00000013, 0x0004002b, 0x00000027,
-    0x00000171, 0x00000014, 0x0004002b, 0x00000027, 0x00000174, 0x00000015, 0x0004002b, 0x00000027,
-    0x00000177, 0x00000016, 0x0004002b, 0x00000027, 0x0000017a, 0x00000017, 0x0004002b, 0x00000006,
-    0x0000017d, 0x00000003, 0x00060034, 0x00000006, 0x00000181, 0x00000080, 0x00000052, 0x0000002b,
-    0x0004002b, 0x00000027, 0x000001be, 0x000003ff, 0x0004002b, 0x00000027, 0x000001f6, 0x0000001f,
-    0x0004002b, 0x00000027, 0x0000020a, 0x00000020, 0x0004002b, 0x00000027, 0x0000020b, 0x00000800,
-    0x0004002b, 0x00000006, 0x0000020c, 0x00000022, 0x0004001c, 0x0000020d, 0x00000048, 0x0000020c,
-    0x00030016, 0x0000020e, 0x00000020, 0x00040017, 0x0000020f, 0x0000020e, 0x00000002, 0x000e001e,
-    0x00000210, 0x00000006, 0x00000006, 0x00000027, 0x00000006, 0x0000020d, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x0000020f, 0x00040020, 0x00000211, 0x00000002,
-    0x00000210, 0x0004003b, 0x00000211, 0x00000212, 0x00000002, 0x0004002b, 0x00000006, 0x00000213,
-    0x00000002, 0x0004002b, 0x00000006, 0x00000214, 0x00000004, 0x0003001d, 0x00000215, 0x00000006,
-    0x0003001e, 0x00000216, 0x00000215, 0x00040020, 0x00000217, 0x0000000c, 0x00000216, 0x0004003b,
-    0x00000217, 0x00000218, 0x0000000c, 0x0004002b, 0x00000006, 0x00000219, 0x00008000, 0x0006002c,
-    0x00000100, 0x0000021a, 0x00000043, 0x0000005f, 0x0000005f, 0x00050036, 0x00000002, 0x00000004,
-    0x00000000, 0x00000003, 0x000200f8, 0x00000005, 0x0004003b, 0x00000007, 0x000000ff, 0x00000007,
-    0x0004003b, 0x0000010d, 0x0000010e, 0x00000007, 0x0004003b, 0x00000007, 0x00000116, 0x00000007,
-    0x0004003b, 0x0000012d, 0x0000012e, 0x00000007, 0x0004003b, 0x00000007, 0x0000017c, 0x00000007,
-    0x0004003b, 0x00000139, 0x00000186, 0x00000007, 0x0004003b, 0x00000139, 0x0000018a, 0x00000007,
-    0x0004003b, 0x00000139, 0x0000018b, 0x00000007, 0x0004003b, 0x00000139, 0x00000198, 0x00000007,
-    0x0004003b, 0x00000007, 0x000001a5, 0x00000007, 0x0004003b, 0x00000007, 0x000001a7, 0x00000007,
-    0x0004003b, 0x00000007, 0x000001a8, 0x00000007, 0x0004003b, 0x00000007, 0x000001b5, 0x00000007,
-    0x0004003b, 0x00000007, 0x000001b7, 0x00000007, 0x0004003b, 0x00000007, 0x000001b8, 0x00000007,
-    0x0004003b, 0x00000007, 0x000001ba, 0x00000007, 0x0004003b, 0x00000139, 0x000001c8, 0x00000007,
-    0x0004003b, 0x00000139, 0x000001d3, 0x00000007, 0x0004003b, 0x00000139, 0x000001dd, 0x00000007,
-    0x0004003b, 0x00000007, 0x000001ea, 0x00000007, 0x0004003b, 0x00000007, 0x000001ec, 0x00000007,
-    0x0004003b, 0x00000007, 0x000001ed, 0x00000007, 0x0004003b, 0x00000007, 0x000001fc, 0x00000007,
-    0x0004003b, 0x00000007, 0x000001fe, 0x00000007, 0x0004003b, 0x00000007, 0x000001ff, 0x00000007,
-    0x0004003b, 0x00000007, 0x00000201, 0x00000007, 0x00050041, 0x00000103, 0x00000104, 0x00000102,
-    0x0000002b, 0x0004003d, 0x00000006, 0x00000105, 0x00000104, 0x0003003e, 0x000000ff, 0x00000105,
-    0x0004003d, 0x00000006, 0x00000106, 0x000000ff, 0x00050041, 0x00000035, 0x00000107, 0x00000033,
-    0x00000055, 0x0004003d, 0x00000006, 0x00000108, 0x00000107, 0x000500ae, 0x00000008, 0x00000109,
-    0x00000106, 0x00000108, 0x000300f7, 0x0000010b, 0x00000000, 0x000400fa, 0x00000109, 0x0000010a,
-    0x0000010b, 0x000200f8, 0x0000010a, 0x000100fd, 0x000200f8, 0x0000010b, 0x0004003d, 0x0000010f,
-    0x00000112, 0x00000111, 0x0004003d, 0x00000006, 0x00000113, 0x000000ff, 0x0004007c, 0x00000027,
-    0x00000114, 0x00000113, 0x0005005f, 0x00000048, 0x00000115, 0x00000112, 0x00000114, 0x0003003e,
-    0x0000010e, 0x00000115, 0x00050041, 0x00000007, 0x00000117, 0x0000010e, 0x0000002b, 0x0004003d,
-    0x00000006, 0x00000118, 0x00000117, 0x0003003e, 0x00000116, 0x00000118, 0x0004003d, 0x00000006,
-    0x00000119, 0x00000116, 0x00050041, 0x00000035, 0x0000011a, 0x00000033, 0x00000034, 0x0004003d,
-    0x00000006, 0x0000011b, 0x0000011a, 0x000500b0, 0x00000008, 0x0000011c, 0x00000119, 0x0000011b,
-    0x000400a8, 0x00000008, 0x0000011d, 0x0000011c, 0x000300f7, 0x0000011f, 0x00000000, 0x000400fa,
-    0x0000011d, 0x0000011e, 0x0000011f, 0x000200f8, 0x0000011e, 0x0004003d, 0x00000006, 0x00000120,
-    0x00000116, 0x00050041, 0x00000035, 0x00000121, 0x00000033, 0x00000034, 0x0004003d, 0x00000006,
-    0x00000122, 0x00000121, 0x00050041, 0x00000035, 0x00000124, 0x00000033, 0x00000123, 0x0004003d,
-    0x00000006, 0x00000125, 0x00000124, 0x00050080, 0x00000006, 0x00000126, 0x00000122, 0x00000125,
-    0x000500ae, 0x00000008, 0x00000127, 0x00000120, 0x00000126, 0x000200f9, 0x0000011f, 0x000200f8,
-    0x0000011f, 0x000700f5, 0x00000008, 0x00000128, 0x0000011c, 0x0000010b, 0x00000127, 0x0000011e,
-    0x000300f7, 0x0000012a, 0x00000000, 0x000400fa, 0x00000128, 0x00000129, 0x0000012a, 0x000200f8,
-    0x00000129, 0x000100fd, 0x000200f8, 0x0000012a, 0x0004003d, 0x00000006, 0x00000134, 0x000000ff,
-    0x00060041, 0x00000135, 0x00000136, 0x00000133, 0x00000034, 0x00000134, 0x0004003d, 0x0000012f,
-    0x00000137, 0x00000136, 0x00050051, 0x00000027, 0x00000138, 0x00000137, 0x00000000, 0x00050041,
-    0x00000139, 0x0000013a, 0x0000012e, 0x00000034, 0x0003003e, 0x0000013a, 0x00000138, 0x00050051,
-    0x00000027, 0x0000013b, 0x00000137, 0x00000001, 0x00050041, 0x00000139, 0x0000013c, 0x0000012e,
-    0x00000123, 0x0003003e, 0x0000013c, 0x0000013b, 0x00050051, 0x00000027, 0x0000013d, 0x00000137,
-    0x00000002, 0x00050041, 0x00000139, 0x0000013e, 0x0000012e, 0x00000055, 0x0003003e, 0x0000013e,
-    0x0000013d, 0x00050051, 0x00000027, 0x0000013f, 0x00000137, 0x00000003, 0x00050041, 0x00000139,
-    0x00000141, 0x0000012e, 0x00000140, 0x0003003e, 0x00000141, 0x0000013f, 0x00050051, 0x00000027,
-    0x00000142, 0x00000137, 0x00000004, 0x00050041, 0x00000139, 0x00000143, 0x0000012e, 0x00000051,
-    0x0003003e, 0x00000143, 0x00000142, 0x00050051, 0x00000027, 0x00000144, 0x00000137, 0x00000005,
-    0x00050041, 0x00000139, 0x00000146, 0x0000012e, 0x00000145, 0x0003003e, 0x00000146, 0x00000144,
-    0x00050051, 0x00000027, 0x00000147, 0x00000137, 0x00000006, 0x00050041, 0x00000139, 0x00000149,
-    0x0000012e, 0x00000148, 0x0003003e, 0x00000149, 0x00000147, 0x00050051, 0x00000006, 0x0000014a,
-    0x00000137, 0x00000007, 0x00050041, 0x00000007, 0x0000014c, 0x0000012e, 0x0000014b, 0x0003003e,
-    0x0000014c, 0x0000014a, 0x00050051, 0x00000027, 0x0000014d, 0x00000137, 0x00000008, 0x00050041,
-    0x00000139, 0x0000014e, 0x0000012e, 0x00000029, 0x0003003e, 0x0000014e, 0x0000014d, 0x00050051,
-    0x00000027, 0x0000014f, 0x00000137, 0x00000009, 0x00050041, 0x00000139, 0x00000151, 0x0000012e,
-    0x00000150, 0x0003003e, 0x00000151, 0x0000014f, 0x00050051, 0x00000027, 0x00000152, 0x00000137,
-    0x0000000a, 0x00050041, 0x00000139, 0x00000154, 0x0000012e, 0x00000153, 0x0003003e, 0x00000154,
-    0x00000152, 0x00050051, 0x00000027, 0x00000155, 0x00000137, 0x0000000b, 0x00050041, 0x00000139,
-    0x00000157, 0x0000012e, 0x00000156, 0x0003003e, 0x00000157, 0x00000155, 0x00050051, 0x00000027,
-    0x00000158, 0x00000137, 0x0000000c, 0x00050041, 0x00000139, 0x0000015a, 0x0000012e, 0x00000159,
-    0x0003003e, 0x0000015a, 0x00000158, 0x00050051, 0x00000027, 0x0000015b, 0x00000137, 0x0000000d,
-    0x00050041, 0x00000139, 0x0000015d, 0x0000012e, 0x0000015c, 0x0003003e, 0x0000015d, 0x0000015b,
-    0x00050051, 0x00000027, 0x0000015e, 0x00000137, 0x0000000e, 0x00050041, 0x00000139, 0x00000160,
-    0x0000012e, 0x0000015f, 0x0003003e, 0x00000160, 0x0000015e, 0x00050051, 0x00000027, 0x00000161,
-    0x00000137, 0x0000000f, 0x00050041, 0x00000139, 0x00000163, 0x0000012e, 0x00000162, 0x0003003e,
-    0x00000163, 0x00000161, 0x00050051, 0x00000027, 0x00000164, 0x00000137, 0x00000010, 0x00050041,
-    0x00000139, 0x00000166, 0x0000012e, 0x00000165, 0x0003003e, 0x00000166, 0x00000164, 0x00050051,
-    0x00000027, 0x00000167, 0x00000137, 0x00000011, 0x00050041, 0x00000139, 0x00000169, 0x0000012e,
-    0x00000168, 0x0003003e, 0x00000169, 0x00000167, 0x00050051, 0x00000027, 0x0000016a, 0x00000137,
-    0x00000012, 0x00050041, 0x00000139, 0x0000016c, 0x0000012e, 0x0000016b, 0x0003003e, 0x0000016c,
-    0x0000016a, 0x00050051, 0x00000027, 0x0000016d, 0x00000137, 0x00000013, 0x00050041, 0x00000139,
-    0x0000016f, 0x0000012e, 0x0000016e, 0x0003003e, 0x0000016f, 0x0000016d, 0x00050051, 0x00000027,
-    0x00000170, 0x00000137, 0x00000014, 0x00050041, 0x00000139, 0x00000172, 0x0000012e, 0x00000171,
-    0x0003003e, 0x00000172, 0x00000170, 0x00050051, 0x00000027, 0x00000173, 0x00000137, 0x00000015,
-    0x00050041, 0x00000139, 0x00000175, 0x0000012e, 0x00000174, 0x0003003e, 0x00000175, 0x00000173,
-    0x00050051, 0x00000027, 0x00000176, 0x00000137, 0x00000016, 0x00050041, 0x00000139, 0x00000178,
-    0x0000012e, 0x00000177, 0x0003003e, 0x00000178, 0x00000176, 0x00050051, 0x00000027, 0x00000179,
-    0x00000137, 0x00000017, 0x00050041, 0x00000139, 0x0000017b, 0x0000012e, 0x0000017a, 0x0003003e,
-    0x0000017b, 0x00000179, 0x00050041, 0x00000007, 0x0000017e, 0x0000010e, 0x0000017d, 0x0004003d,
-    0x00000006, 0x0000017f, 0x0000017e, 0x0003003e, 0x0000017c, 0x0000017f, 0x0004003d, 0x00000006,
-    0x00000180, 0x0000017c, 0x000500ae, 0x00000008, 0x00000182, 0x00000180, 0x00000181, 0x000300f7,
-    0x00000184, 0x00000000, 0x000400fa, 0x00000182, 0x00000183, 0x00000184, 0x000200f8, 0x00000183,
-    0x000100fd, 0x000200f8, 0x00000184, 0x00050041, 0x00000139, 0x00000187, 0x0000012e, 0x00000034,
-    0x0004003d, 0x00000027, 0x00000188, 0x00000187, 0x0007000c, 0x00000027, 0x00000189, 0x00000001,
-    0x0000002a, 0x00000188, 0x00000034, 0x0003003e, 0x00000186, 0x00000189, 0x0003003e, 0x0000018a,
-    0x00000028, 0x00050041, 0x00000139, 0x0000018c, 0x0000012e, 0x00000055, 0x0004003d, 0x00000027,
-    0x0000018d, 0x0000018c, 0x00050041, 0x00000139, 0x0000018e, 0x0000012e, 0x00000123, 0x0004003d,
-    0x00000027, 0x0000018f, 0x0000018e, 0x0007000c, 0x00000027, 0x00000190, 0x00000001, 0x00000027,
-    0x0000018d, 0x0000018f, 0x0004003d, 0x00000027, 0x00000191, 0x0000018a, 0x0007000c, 0x00000027,
-    0x00000192, 0x00000001, 0x00000027, 0x00000190, 0x00000191, 0x0003003e, 0x0000018b, 0x00000192,
-    0x00050041, 0x00000139, 0x00000193, 0x0000012e, 0x00000051, 0x0004003d, 0x00000027, 0x00000194,
-    0x00000193, 0x000500b1, 0x00000008, 0x00000195, 0x00000194, 0x00000034, 0x000300f7, 0x00000197,
-    0x00000000, 0x000400fa, 0x00000195, 0x00000196, 0x000001c4, 0x000200f8, 0x00000196, 0x00050041,
-    0x00000139, 0x00000199, 0x0000012e, 0x00000177, 0x0004003d, 0x00000027, 0x0000019a, 0x00000199,
-    0x0003003e, 0x00000198, 0x0000019a, 0x000200f9, 0x0000019b, 0x000200f8, 0x0000019b, 0x000400f6,
-    0x0000019d, 0x0000019e, 0x00000000, 0x000200f9, 0x0000019f, 0x000200f8, 0x0000019f, 0x0004003d,
-    0x00000027, 0x000001a0, 0x00000186, 0x0004003d, 0x00000027, 0x000001a1, 0x0000018b, 0x000500b1,
-    0x00000008, 0x000001a2, 0x000001a0, 0x000001a1, 0x000400fa, 0x000001a2, 0x0000019c, 0x0000019d,
-    0x000200f8, 0x0000019c, 0x0004003d, 0x00000027, 0x000001a3, 0x00000186, 0x0004007c, 0x00000006,
-    0x000001a4, 0x000001a3, 0x0004003d, 0x00000006, 0x000001a6, 0x00000116, 0x0003003e, 0x000001a5,
-    0x000001a6, 0x0003003e, 0x000001a7, 0x000001a4, 0x0004003d, 0x00000006, 0x000001a9, 0x0000017c,
-    0x0003003e, 0x000001a8, 0x000001a9, 0x00070039, 0x00000008, 0x000001aa, 0x00000014, 0x000001a5,
-    0x000001a7, 0x000001a8, 0x000400a8, 0x00000008, 0x000001ab, 0x000001aa, 0x000300f7, 0x000001ad,
-    0x00000000, 0x000400fa, 0x000001ab, 0x000001ac, 0x000001ad, 0x000200f8, 0x000001ac, 0x000200f9,
-    0x0000019e, 0x000200f8, 0x000001ad, 0x0004003d, 0x00000027, 0x000001af, 0x00000186, 0x0004007c,
-    0x00000006, 0x000001b0, 0x000001af, 0x0004003d, 0x00000027, 0x000001b1, 0x00000198, 0x000500c3,
-    0x00000027, 0x000001b2, 0x000001b1, 0x00000145, 0x0004007c, 0x00000006, 0x000001b3, 0x000001b2,
-    0x0007000c, 0x00000006, 0x000001b4, 0x00000001, 0x00000026, 0x000001b3, 0x0000003f, 0x0004003d,
-    0x00000006, 0x000001b6, 0x00000116, 0x0003003e, 0x000001b5, 0x000001b6, 0x0003003e, 0x000001b7,
-    0x000001b0, 0x0004003d, 0x00000006, 0x000001b9, 0x0000017c, 0x0003003e, 0x000001b8, 0x000001b9,
-    0x0003003e, 0x000001ba, 0x000001b4, 0x00080039, 0x00000002, 0x000001bb, 0x0000001b, 0x000001b5,
-    0x000001b7, 0x000001b8, 0x000001ba, 0x00050041, 0x00000139, 0x000001bc, 0x0000012e, 0x00000051,
-    0x0004003d, 0x00000027, 0x000001bd, 0x000001bc, 0x000500c7, 0x00000027, 0x000001bf, 0x000001bd,
-    0x000001be, 0x0004003d, 0x00000027, 0x000001c0, 0x00000198, 0x00050080, 0x00000027, 0x000001c1,
-    0x000001c0, 0x000001bf, 0x0003003e, 0x00000198, 0x000001c1, 0x000200f9, 0x0000019e, 0x000200f8,
-    0x0000019e, 0x0004003d, 0x00000027, 0x000001c2, 0x00000186, 0x00050080, 0x00000027, 0x000001c3,
-    0x000001c2, 0x00000123, 0x0003003e, 0x00000186, 0x000001c3, 0x000200f9, 0x0000019b, 0x000200f8,
-    0x0000019d, 0x000200f9, 0x00000197, 0x000200f8, 0x000001c4, 0x0004003d, 0x00000027, 0x000001c5,
-    0x00000186, 0x0004003d, 0x00000027, 0x000001c6, 0x0000018b, 0x0007000c, 0x00000027, 0x000001c7,
-    0x00000001, 0x0000002a, 0x000001c5, 0x000001c6, 0x0003003e, 0x00000186, 0x000001c7, 0x000200f9,
-    0x00000197, 0x000200f8, 0x00000197, 0x00050041, 0x00000139, 0x000001c9, 0x0000012e, 0x00000140,
-    0x0004003d, 0x00000027, 0x000001ca, 0x000001c9, 0x00050041, 0x00000139, 0x000001cb, 0x0000012e,
-    0x00000123, 0x0004003d, 0x00000027, 0x000001cc, 0x000001cb, 0x0007000c, 0x00000027, 0x000001cd,
-    0x00000001, 0x00000027, 0x000001ca, 0x000001cc, 0x0004003d, 0x00000027, 0x000001ce, 0x0000018a,
-    0x0007000c, 0x00000027, 0x000001cf, 0x00000001, 0x00000027, 0x000001cd, 0x000001ce, 0x0003003e,
-    0x000001c8, 0x000001cf, 0x0004003d, 0x00000027, 0x000001d0, 0x00000186, 0x0004003d, 0x00000027,
-    0x000001d1, 0x000001c8, 0x0007000c, 0x00000027, 0x000001d2, 0x00000001, 0x0000002a, 0x000001d0,
-    0x000001d1, 0x0003003e, 0x00000186, 0x000001d2, 0x00050041, 0x00000139, 0x000001d4, 0x0000012e,
-    0x00000123, 0x0004003d, 0x00000027, 0x000001d5, 0x000001d4, 0x0004003d, 0x00000027, 0x000001d6,
-    0x0000018a, 0x0007000c, 0x00000027, 0x000001d7, 0x00000001, 0x00000027, 0x000001d5, 0x000001d6,
-    0x0003003e, 0x000001d3, 0x000001d7, 0x00050041, 0x00000139, 0x000001d8, 0x0000012e, 0x00000145,
-    0x0004003d, 0x00000027, 0x000001d9, 0x000001d8, 0x000500b1, 0x00000008, 0x000001da, 0x000001d9,
-    0x00000034, 0x000300f7, 0x000001dc, 0x00000000, 0x000400fa, 0x000001da, 0x000001db, 0x000001dc,
-    0x000200f8, 0x000001db, 0x00050041, 0x00000139, 0x000001de, 0x0000012e, 0x0000017a, 0x0004003d,
-    0x00000027, 0x000001df, 0x000001de, 0x0003003e, 0x000001dd, 0x000001df, 0x000200f9, 0x000001e0,
-    0x000200f8, 0x000001e0, 0x000400f6, 0x000001e2, 0x000001e3, 0x00000000, 0x000200f9, 0x000001e4,
-    0x000200f8, 0x000001e4, 0x0004003d, 0x00000027, 0x000001e5, 0x00000186, 0x0004003d, 0x00000027,
-    0x000001e6, 0x000001d3, 0x000500b1, 0x00000008, 0x000001e7, 0x000001e5, 0x000001e6, 0x000400fa,
-    0x000001e7, 0x000001e1, 0x000001e2, 0x000200f8, 0x000001e1, 0x0004003d, 0x00000027, 0x000001e8,
-    0x00000186, 0x0004007c, 0x00000006, 0x000001e9, 0x000001e8, 0x0004003d, 0x00000006, 0x000001eb,
-    0x00000116, 0x0003003e, 0x000001ea, 0x000001eb, 0x0003003e, 0x000001ec, 0x000001e9, 0x0004003d,
-    0x00000006, 0x000001ee, 0x0000017c, 0x0003003e, 0x000001ed, 0x000001ee, 0x00070039, 0x00000008,
-    0x000001ef, 0x00000014, 0x000001ea, 0x000001ec, 0x000001ed, 0x000400a8, 0x00000008, 0x000001f0,
-    0x000001ef, 0x000300f7, 0x000001f2, 0x00000000, 0x000400fa, 0x000001f0, 0x000001f1, 0x000001f2,
-    0x000200f8, 0x000001f1, 0x000200f9, 0x000001e3, 0x000200f8, 0x000001f2, 0x0004003d, 0x00000027,
-    0x000001f4, 0x00000186, 0x0004007c, 0x00000006, 0x000001f5, 0x000001f4, 0x0004003d, 0x00000027,
-    0x000001f7, 0x000001dd, 0x000500c3, 0x00000027, 0x000001f8, 0x000001f7, 0x00000145, 0x00050082,
-    0x00000027, 0x000001f9, 0x000001f6, 0x000001f8, 0x0007000c, 0x00000027, 0x000001fa, 0x00000001,
-    0x0000002a, 0x000001f9, 0x00000034, 0x0004007c, 0x00000006, 0x000001fb, 0x000001fa, 0x0004003d,
-    0x00000006, 0x000001fd, 0x00000116, 0x0003003e, 0x000001fc, 0x000001fd, 0x0003003e, 0x000001fe,
-    0x000001f5, 0x0004003d, 0x00000006, 0x00000200, 0x0000017c, 0x0003003e, 0x000001ff, 0x00000200,
-    0x0003003e, 0x00000201, 0x000001fb, 0x00080039, 0x00000002, 0x00000202, 0x0000001b, 0x000001fc,
-    0x000001fe, 0x000001ff, 0x00000201, 0x00050041, 0x00000139, 0x00000203, 0x0000012e, 0x00000145,
-    0x0004003d, 0x00000027, 0x00000204, 0x00000203, 0x000500c7, 0x00000027, 0x00000205, 0x00000204,
-    0x000001be, 0x0004003d, 0x00000027, 0x00000206, 0x000001dd, 0x00050080, 0x00000027, 0x00000207,
-    0x00000206, 0x00000205, 0x0003003e, 0x000001dd, 0x00000207, 0x000200f9, 0x000001e3, 0x000200f8,
-    0x000001e3, 0x0004003d, 0x00000027, 0x00000208, 0x00000186, 0x00050080, 0x00000027, 0x00000209,
-    0x00000208, 0x00000123, 0x0003003e, 0x00000186, 0x00000209, 0x000200f9, 0x000001e0, 0x000200f8,
-    0x000001e2, 0x000200f9, 0x000001dc, 0x000200f8, 0x000001dc, 0x000100fd, 0x00010038, 0x00050036,
-    0x00000008, 0x0000000e, 0x00000000, 0x00000009, 0x00030037, 0x00000007, 0x0000000a, 0x00030037,
-    0x00000007, 0x0000000b, 0x00030037, 0x00000007, 0x0000000c, 0x00030037, 0x00000007, 0x0000000d,
-    0x000200f8, 0x0000000f, 0x0004003b, 0x00000007, 0x0000001d, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000021, 0x00000007, 0x0004003b, 0x00000007, 0x00000024, 0x00000007, 0x0004003b, 0x00000007,
-    0x0000002f, 0x00000007, 0x0004003b, 0x00000007, 0x00000039, 0x00000007, 0x0004003b, 0x00000007,
-    0x0000003d, 0x00000007, 0x0004003b, 0x00000007, 0x00000041, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000047, 0x00000007, 0x0004003b, 0x00000007, 0x00000068, 0x00000007, 0x0004003b, 0x00000007,
-    0x0000006b, 0x00000007, 0x0004003b, 0x00000007, 0x00000073, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000079, 0x00000007, 0x0004003b, 0x00000007, 0x0000008c, 0x00000007, 0x0004003d, 0x00000006,
-    0x0000001e, 0x0000000b, 0x00050086, 0x00000006, 0x00000020, 0x0000001e, 0x0000001f, 0x0003003e,
-    0x0000001d, 0x00000020, 0x0004003d, 0x00000006, 0x00000022, 0x0000000c, 0x00050086, 0x00000006,
-    0x00000023, 0x00000022, 0x0000001f, 0x0003003e, 0x00000021, 0x00000023, 0x0004003d, 0x00000006,
-    0x00000025, 0x0000001d, 0x0004003d, 0x00000006, 0x00000026, 0x00000021, 0x00050084, 0x00000006,
-    0x0000002d, 0x00000026, 0x0000002c, 0x00050080, 0x00000006, 0x0000002e, 0x00000025, 0x0000002d,
-    0x0003003e, 0x00000024, 0x0000002e, 0x0004003d, 0x00000006, 0x00000030, 0x0000000a, 0x00050041,
-    0x00000035, 0x00000036, 0x00000033, 0x00000034, 0x0004003d, 0x00000006, 0x00000037, 0x00000036,
-    0x00050082, 0x00000006, 0x00000038, 0x00000030, 0x00000037, 0x0003003e, 0x0000002f, 0x00000038,
-    0x0004003d, 0x00000006, 0x0000003a, 0x0000002f, 0x000500c2, 0x00000006, 0x0000003c, 0x0000003a,
-    0x0000003b, 0x0003003e, 0x00000039, 0x0000003c, 0x0004003d, 0x00000006, 0x0000003e, 0x0000002f,
-    0x000500c7, 0x00000006, 0x00000040, 0x0000003e, 0x0000003f, 0x0003003e, 0x0000003d, 0x00000040,
-    0x0004003d, 0x00000006, 0x00000042, 0x00000024, 0x00050084, 0x00000006, 0x00000044, 0x00000042,
-    0x00000043, 0x0004003d, 0x00000006, 0x00000045, 0x00000039, 0x00050080, 0x00000006, 0x00000046,
-    0x00000044, 0x00000045, 0x0003003e, 0x00000041, 0x00000046, 0x0004003d, 0x00000006, 0x00000058,
-    0x00000041, 0x0004007c, 0x00000027, 0x00000059, 0x00000058, 0x00050080, 0x00000027, 0x0000005a,
-    0x00000057, 0x00000059, 0x00060041, 0x0000005b, 0x0000005c, 0x00000050, 0x00000051, 0x0000005a,
-    0x0004003d, 0x00000006, 0x0000005d, 0x0000005c, 0x0003003e, 0x00000047, 0x0000005d, 0x0004003d,
-    0x00000006, 0x0000005e, 0x00000047, 0x0004003d, 0x00000006, 0x00000060, 0x0000003d, 0x000500c4,
-    0x00000006, 0x00000061, 0x0000005f, 0x00000060, 0x000500c7, 0x00000006, 0x00000062, 0x0000005e,
-    0x00000061, 0x000500aa, 0x00000008, 0x00000063, 0x00000062, 0x0000002b, 0x000300f7, 0x00000065,
-    0x00000000, 0x000400fa, 0x00000063, 0x00000064, 0x00000065, 0x000200f8, 0x00000064, 0x000200fe,
-    0x00000066, 0x000200f8, 0x00000065, 0x0004003d, 0x00000006, 0x00000069, 0x0000003d, 0x000500aa,
-    0x00000008, 0x0000006a, 0x00000069, 0x0000002b, 0x000300f7, 0x0000006d, 0x00000000, 0x000400fa,
-    0x0000006a, 0x0000006c, 0x0000006e, 0x000200f8, 0x0000006c, 0x0003003e, 0x0000006b, 0x0000002b,
-    0x000200f9, 0x0000006d, 0x000200f8, 0x0000006e, 0x0004003d, 0x00000006, 0x0000006f, 0x0000003d,
-    0x000500c4, 0x00000006, 0x00000070, 0x0000005f, 0x0000006f, 0x00050082, 0x00000006, 0x00000071,
-    0x00000070, 0x0000005f, 0x0003003e, 0x0000006b, 0x00000071, 0x000200f9, 0x0000006d, 0x000200f8,
-    0x0000006d, 0x0004003d, 0x00000006, 0x00000072, 0x0000006b, 0x0003003e, 0x00000068, 0x00000072,
-    0x0004003d, 0x00000006, 0x00000074, 0x00000047, 0x0004003d, 0x00000006, 0x00000075, 0x00000068,
-    0x000500c7, 0x00000006, 0x00000076, 0x00000074, 0x00000075, 0x000400cd, 0x00000027, 0x00000077,
-    0x00000076, 0x0004007c, 0x00000006, 0x00000078, 0x00000077, 0x0003003e, 0x00000073, 0x00000078,
-    0x0004003d, 0x00000006, 0x0000007e, 0x00000041, 0x0004007c, 0x00000027, 0x0000007f, 0x0000007e,
-    0x00050080, 0x00000027, 0x00000080, 0x0000007d, 0x0000007f, 0x00060041, 0x0000005b, 0x00000081,
-    0x00000050, 0x00000051, 0x00000080, 0x0004003d, 0x00000006, 0x00000082, 0x00000081, 0x0004003d,
-    0x00000006, 0x00000083, 0x00000073, 0x00050080, 0x00000006, 0x00000084, 0x00000082, 0x00000083,
-    0x0003003e, 0x00000079, 0x00000084, 0x0004003d, 0x00000006, 0x00000085, 0x00000079, 0x000500ae,
-    0x00000008, 0x00000088, 0x00000085, 0x00000087, 0x000300f7, 0x0000008a, 0x00000000, 0x000400fa,
-    0x00000088, 0x00000089, 0x0000008a, 0x000200f8, 0x00000089, 0x000200fe, 0x00000066, 0x000200f8,
-    0x0000008a, 0x0004003d, 0x00000006, 0x0000008d, 0x0000000c, 0x00050089, 0x00000006, 0x0000008e,
-    0x0000008d, 0x0000001f, 0x00050084, 0x00000006, 0x0000008f, 0x0000008e, 0x0000001f, 0x0004003d,
-    0x00000006, 0x00000090, 0x0000000b, 0x00050089, 0x00000006, 0x00000091, 0x00000090, 0x0000001f,
-    0x00050080, 0x00000006, 0x00000092, 0x0000008f, 0x00000091, 0x0003003e, 0x0000008c, 0x00000092,
-    0x0004003d, 0x00000006, 0x00000093, 0x00000079, 0x00050084, 0x00000006, 0x00000094, 0x00000093,
-    0x00000043, 0x0004003d, 0x00000006, 0x00000095, 0x0000008c, 0x00050080, 0x00000006, 0x00000096,
-    0x00000094, 0x00000095, 0x0003003e, 0x0000000d, 0x00000096, 0x000200fe, 0x00000097, 0x00010038,
-    0x00050036, 0x00000008, 0x00000014, 0x00000000, 0x00000010, 0x00030037, 0x00000007, 0x00000011,
-    0x00030037, 0x00000007, 0x00000012, 0x00030037, 0x00000007, 0x00000013, 0x000200f8, 0x00000015,
-    0x0004003b, 0x00000007, 0x0000009a, 0x00000007, 0x0004003b, 0x00000007, 0x0000009b, 0x00000007,
-    0x0004003b, 0x00000007, 0x0000009d, 0x00000007, 0x0004003b, 0x00000007, 0x0000009f, 0x00000007,
-    0x0004003b, 0x00000007, 0x000000a1, 0x00000007, 0x0004003d, 0x00000006, 0x0000009c, 0x00000011,
-    0x0003003e, 0x0000009b, 0x0000009c, 0x0004003d, 0x00000006, 0x0000009e, 0x00000012, 0x0003003e,
-    0x0000009d, 0x0000009e, 0x0004003d, 0x00000006, 0x000000a0, 0x00000013, 0x0003003e, 0x0000009f,
-    0x000000a0, 0x00080039, 0x00000008, 0x000000a2, 0x0000000e, 0x0000009b, 0x0000009d, 0x0000009f,
-    0x000000a1, 0x0004003d, 0x00000006, 0x000000a3, 0x000000a1, 0x0003003e, 0x0000009a, 0x000000a3,
-    0x000300f7, 0x000000a5, 0x00000000, 0x000400fa, 0x000000a2, 0x000000a4, 0x000000a5, 0x000200f8,
-    0x000000a4, 0x0004003d, 0x00000006, 0x000000aa, 0x0000009a, 0x00060041, 0x0000005b, 0x000000ab,
-    0x000000a9, 0x00000034, 0x000000aa, 0x0004003d, 0x00000006, 0x000000ac, 0x000000ab, 0x000500ab,
-    0x00000008, 0x000000ad, 0x000000ac, 0x0000002b, 0x000200f9, 0x000000a5, 0x000200f8, 0x000000a5,
-    0x000700f5, 0x00000008, 0x000000ae, 0x000000a2, 0x00000015, 0x000000ad, 0x000000a4, 0x000300f7,
-    0x000000b0, 0x00000000, 0x000400fa, 0x000000ae, 0x000000af, 0x000000b0, 0x000200f8, 0x000000af,
-    0x0004003d, 0x00000006, 0x000000b5, 0x0000009a, 0x00060041, 0x0000005b, 0x000000b6, 0x000000b4,
-    0x00000034, 0x000000b5, 0x0004003d, 0x00000006, 0x000000b7, 0x000000b6, 0x000500c7, 0x00000006,
-    0x000000b9, 0x000000b7, 0x000000b8, 0x000500ab, 0x00000008, 0x000000ba, 0x000000b9, 0x0000002b,
-    0x000200f9, 0x000000b0, 0x000200f8, 0x000000b0, 0x000700f5, 0x00000008, 0x000000bb, 0x000000ae,
-    0x000000a5, 0x000000ba, 0x000000af, 0x000200fe, 0x000000bb, 0x00010038, 0x00050036, 0x00000002,
-    0x0000001b, 0x00000000, 0x00000016, 0x00030037, 0x00000007, 0x00000017, 0x00030037, 0x00000007,
-    0x00000018, 0x00030037, 0x00000007, 0x00000019, 0x00030037, 0x00000007, 0x0000001a, 0x000200f8,
-    0x0000001c, 0x0004003b, 0x00000007, 0x000000be, 0x00000007, 0x0004003b, 0x00000007, 0x000000c4,
-    0x00000007, 0x0004003b, 0x00000007, 0x000000e4, 0x00000007, 0x0004003d, 0x00000006, 0x000000bf,
-    0x00000019, 0x00050084, 0x00000006, 0x000000c1, 0x000000bf, 0x000000c0, 0x0004003d, 0x00000006,
-    0x000000c2, 0x00000018, 0x00050080, 0x00000006, 0x000000c3, 0x000000c1, 0x000000c2, 0x0003003e,
-    0x000000be, 0x000000c3, 0x0003003e, 0x000000c4, 0x000000c5, 0x0004003d, 0x00000006, 0x000000ca,
-    0x000000be, 0x00060041, 0x0000005b, 0x000000cb, 0x000000c9, 0x00000034, 0x000000ca, 0x0004003d,
-    0x00000006, 0x000000cc, 0x000000cb, 0x0004003d, 0x00000006, 0x000000cd, 0x00000017, 0x000500aa,
-    0x00000008, 0x000000ce, 0x000000cc, 0x000000cd, 0x000300f7, 0x000000d0, 0x00000000, 0x000400fa,
-    0x000000ce, 0x000000cf, 0x000000d2, 0x000200f8, 0x000000cf, 0x0004003d, 0x00000006, 0x000000d1,
-    0x000000be, 0x0003003e, 0x000000c4, 0x000000d1, 0x000200f9, 0x000000d0, 0x000200f8, 0x000000d2,
-    0x0004003d, 0x00000006, 0x000000d5, 0x000000be, 0x00050080, 0x00000006, 0x000000d6, 0x000000d4,
-    0x000000d5, 0x00060041, 0x0000005b, 0x000000d7, 0x000000c9, 0x00000034, 0x000000d6, 0x0004003d,
-    0x00000006, 0x000000d8, 0x000000d7, 0x0004003d, 0x00000006, 0x000000d9, 0x00000017, 0x000500aa,
-    0x00000008, 0x000000da, 0x000000d8, 0x000000d9, 0x000300f7, 0x000000dc, 0x00000000, 0x000400fa,
-    0x000000da, 0x000000db, 0x000000dc, 0x000200f8, 0x000000db, 0x0004003d, 0x00000006, 0x000000de,
-    0x000000be, 0x00050080, 0x00000006, 0x000000df, 0x000000dd, 0x000000de, 0x0003003e, 0x000000c4,
-    0x000000df, 0x000200f9, 0x000000dc, 0x000200f8, 0x000000dc, 0x000200f9, 0x000000d0, 0x000200f8,
-    0x000000d0, 0x0004003d, 0x00000006, 0x000000e0, 0x000000c4, 0x000500ab, 0x00000008, 0x000000e1,
-    0x000000e0, 0x000000c5, 0x000300f7, 0x000000e3, 0x00000000, 0x000400fa, 0x000000e1, 0x000000e2,
-    0x000000e3, 0x000200f8, 0x000000e2, 0x0004003d, 0x00000006, 0x000000f1, 0x000000c4, 0x00050080,
-    0x00000006, 0x000000f2, 0x000000f0, 0x000000f1, 0x00060041, 0x0000005b, 0x000000f3, 0x000000e8,
-    0x00000034, 0x000000f2, 0x0004003d, 0x00000006, 0x000000f4, 0x000000f3, 0x0003003e, 0x000000e4,
-    0x000000f4, 0x0004003d, 0x00000006, 0x000000f5, 0x000000c4, 0x00050080, 0x00000006, 0x000000f6,
-    0x000000f0, 0x000000f5, 0x0004003d, 0x00000006, 0x000000f7, 0x000000e4, 0x000500c7, 0x00000006,
-    0x000000f9, 0x000000f7, 0x000000f8, 0x0004003d, 0x00000006, 0x000000fa, 0x0000001a, 0x000500c7,
-    0x00000006, 0x000000fb, 0x000000fa, 0x0000003f, 0x000500c4, 0x00000006, 0x000000fc, 0x000000fb,
-    0x0000001f, 0x000500c5, 0x00000006, 0x000000fd, 0x000000f9, 0x000000fc, 0x00060041, 0x0000005b,
-    0x000000fe, 0x000000e8, 0x00000034, 0x000000f6, 0x0003003e, 0x000000fe, 0x000000fd, 0x000200f9,
-    0x000000e3, 0x000200f8, 0x000000e3, 0x000100fd, 0x00010038,
+const uint8_t Blob036_Data[4296] =
+{
+    0x28, 0xb5, 0x2f, 0xfd, 0x60, 0x54, 0x3f, 0xf5, 0x85, 0x00, 0x8a, 0x88, 0x24, 0x21, 0x39, 0x10,
+    0x98, 0xc9, 0x0d, 0xc1, 0x21, 0x05, 0x0c, 0xd3, 0x21, 0x05, 0x42, 0x86, 0x91, 0x28, 0x92, 0x23,
+    0x25, 0x31, 0xeb, 0x02, 0xed, 0xb3, 0xbd, 0x43, 0x08, 0x79, 0xa4, 0xb0, 0x12, 0x69, 0x00, 0xe2,
+    0xd1, 0xb2, 0xed, 0x4c, 0x5f, 0x9b, 0x0d, 0xee, 0x6c, 0xeb, 0x6f, 0xf7, 0xf7, 0xb1, 0x2a, 0x00,
+    0xd0, 0xa4, 0xf6, 0x0a, 0xa9, 0xa5, 0x4c, 0x01, 0xc9, 0x01, 0xf4, 0x01, 0x18, 0x02, 0xb8, 0xf6,
+    0xb6, 0xce, 0x4a, 0xab, 0xf2, 0xb7, 0xdd, 0x75, 0x5b, 0xb5, 0xe4, 0xff, 0x5b, 0x5d, 0x0d, 0xf9,
+    0x3f, 0xaf, 0xb3, 0xc9, 0x73, 0x58, 0x0c, 0xf6, 0x7f, 0xf2, 0xeb, 0xb6, 0xf7, 0x6a, 0x81, 0x80,
+    0xf4, 0xf3, 0xb7, 0x16, 0xbf, 0x42, 0x63, 0xa5, 0x34, 0xbc, 0x07, 0xa1, 0xb3, 0xe5, 0xf6, 0x5c,
+    0x37, 0xaf, 0x66, 0xf3, 0x58, 0xf6, 0x7e, 0x1f, 0x05, 0xfd, 0x99, 0x9b, 0xd6, 0xc8, 0x78, 0x7f,
+    0x73, 0x5b, 0xee, 0xff, 0xc5, 0x6f, 0xe7, 0xb9, 0xb7, 0xf8, 0xde, 0x5f, 0xe7, 0x6e, 0x08, 0x88,
+    0x87, 0xff, 0xe3, 0xd8, 0xf0, 0xef, 0xef, 0x3a, 0xc3, 0xc2, 0x4f, 0xc8, 0xff, 0xf9, 0xf7, 0xbd,
+    0xd9, 0x60, 0x20, 0xff, 0xbb, 0x39, 0xe0, 0x1f, 0x12, 0xc4, 0xef, 0xce, 0xde, 0x6d, 0xaf, 0x8f,
+    0x1e, 0xfb, 0xad, 0xeb, 0x6c, 0xfd, 0x8b, 0x8f, 0x67, 0xbb, 0xf1, 0xf1, 0x24, 0xfe, 0x72, 0xef,
+    0x86, 0xc8, 0xcb, 0x6d, 0x1d, 0xdf, 0xee, 0x5d, 0x7e, 0xbf, 0x43, 0x70, 0x77, 0xbb, 0xbf, 0x62,
+    0x3f, 0xcd, 0x5f, 0xad, 0xff, 0x6d, 0xab, 0x9b, 0xb9, 0x9d, 0x25, 0xff, 0x47, 0xe6, 0xf6, 0x6d,
+    0x95, 0x91, 0xb6, 0x77, 0xbf, 0x77, 0xaf, 0xf1, 0xff, 0x76, 0xd1, 0xec, 0xf6, 0x2e, 0xf6, 0x2f,
+    0xf7, 0x9b, 0x8e, 0xee, 0x7b, 0xd6, 0xe7, 0x5f, 0xfe, 0xb6, 0xea, 0xf8, 0xd9, 0x84, 0x5f, 0xfd,
+    0xdf, 0x8e, 0x37, 0xeb, 0xf1, 0x39, 0x32, 0xef, 0xb7, 0xbb, 0xd7, 0x89, 0x69, 0xbd, 0x07, 0xfe,
+    0xd6, 0xf6, 0x66, 0x69, 0x65, 0x7f, 0xf3, 0x74, 0x74, 0x14, 0x2e, 0xcc, 0xff, 0xde, 0xbf, 0xbd,
+    0xd7, 0x46, 0xe3, 0xd9, 0x94, 0x34, 0x5c, 0xf2, 0x5f, 0xbd, 0xf6, 0x8e, 0xec, 0xb9, 0x75, 0xf8,
+    0xbd, 0x26, 0x7f, 0xbc, 0x3b, 0xc6, 0x77, 0x5b, 0x6e, 0xff, 0xfe, 0x99, 0xef, 0x75, 0xbb, 0xe7,
+    0xf5, 0x2e, 0x1a, 0x97, 0xff, 0xbe, 0x85, 0xfd, 0xb7, 0xdc, 0xd6, 0x76, 0xf3, 0xfa, 0xb7, 0xed,
+    0xf7, 0x1b, 0xdf, 0xc5, 0xed, 0xb7, 0x38, 0x56, 0xbf, 0xef, 0x5d, 0x7b, 0xe5, 0xfa, 0xbb, 0xad,
+    0x75, 0x01, 0xcb, 0x02, 0xd5, 0x4f, 0x7e, 0x6d, 0x14, 0xd4, 0xd3, 0xf4, 0xae, 0xd3, 0x71, 0x5d,
+    0xc7, 0xb1, 0x77, 0x8f, 0xef, 0x58, 0xa9, 0xdf, 0x6c, 0x62, 0x82, 0xfe, 0xed, 0xdd, 0x7b, 0x6f,
+    0xad, 0xd6, 0x8c, 0xb7, 0xb1, 0xd1, 0x3e, 0x29, 0xcf, 0x89, 0xd7, 0x54, 0x7e, 0xbc, 0x7b, 0xab,
+    0xb3, 0xe9, 0xdd, 0xba, 0xbc, 0xbc, 0xeb, 0x65, 0xfe, 0xf9, 0x8f, 0x85, 0x7d, 0xb9, 0xf2, 0x1b,
+    0x0f, 0x7f, 0xbb, 0x73, 0x1c, 0xee, 0xae, 0xb3, 0xf7, 0x1b, 0x44, 0x17, 0x4d, 0xe9, 0x33, 0x7f,
+    0x72, 0xfb, 0xcd, 0xb5, 0x3a, 0xbe, 0xbc, 0x41, 0xe0, 0xbd, 0xf6, 0xde, 0xf1, 0x6d, 0xf6, 0xd6,
+    0xf1, 0x3c, 0x7b, 0xe7, 0x79, 0x3d, 0x9f, 0xf5, 0x7a, 0xb5, 0x59, 0xb5, 0xb6, 0x2a, 0x05, 0x0a,
+    0xd5, 0x2c, 0x33, 0xee, 0x22, 0x23, 0xcb, 0xa0, 0xc9, 0xa7, 0xfc, 0xff, 0xff, 0x3a, 0x6e, 0xdf,
+    0x25, 0x95, 0x4b, 0xff, 0xff, 0x8f, 0xfc, 0x4a, 0x1f, 0x0c, 0x01, 0xf5, 0x6b, 0xdb, 0xf3, 0x5f,
+    0x6d, 0xd7, 0xb6, 0xea, 0xfc, 0x9b, 0x5f, 0xf1, 0x97, 0x3f, 0xf4, 0xcb, 0x52, 0x7f, 0xf9, 0x9b,
+    0x3f, 0x46, 0x7e, 0x3a, 0x4b, 0x46, 0x06, 0xca, 0x25, 0xa8, 0x35, 0x3a, 0x69, 0x46, 0xca, 0x63,
+    0x71, 0x8c, 0x8c, 0xff, 0xf4, 0xf1, 0xb1, 0x8e, 0xa2, 0x40, 0x8d, 0x82, 0x00, 0x05, 0xfa, 0x03,
+    0xe8, 0x8f, 0x1f, 0xaf, 0xc6, 0x3e, 0x7e, 0xe2, 0xf8, 0xf4, 0xe1, 0xc3, 0xb8, 0x67, 0x71, 0x8f,
+    0x9e, 0x45, 0x3d, 0x8a, 0x88, 0x6b, 0xac, 0x7b, 0x88, 0x87, 0x61, 0xc2, 0x61, 0xc0, 0x84, 0xc1,
+    0x3c, 0x7e, 0xe1, 0xda, 0x02, 0xa6, 0x32, 0x13, 0x0e, 0x42, 0x79, 0x32, 0xf8, 0xc4, 0x19, 0x38,
+    0x06, 0x88, 0xe4, 0xc8, 0x11, 0x1d, 0x03, 0xf8, 0x56, 0x80, 0x7d, 0x3e, 0x3d, 0x2c, 0x89, 0x11,
+    0x22, 0xf4, 0xca, 0x46, 0x88, 0xa0, 0xfb, 0xc8, 0x38, 0x3b, 0x67, 0x90, 0xa3, 0x62, 0xe3, 0xe0,
+    0xe4, 0xe4, 0xb8, 0xeb, 0x1e, 0x9c, 0xf5, 0xba, 0xc5, 0x9a, 0xac, 0xe0, 0x7c, 0x1b, 0x9b, 0xe0,
+    0xa4, 0xe0, 0xd6, 0x16, 0x81, 0xfe, 0xc8, 0x4f, 0xd5, 0x36, 0xb5, 0x36, 0xf5, 0xd9, 0x92, 0x6b,
+    0xd3, 0x32, 0x34, 0xab, 0x07, 0xca, 0xb1, 0x19, 0x01, 0xf5, 0xc0, 0x18, 0x92, 0x81, 0x79, 0x6b,
+    0x0e, 0xab, 0xf2, 0x02, 0xcf, 0xdf, 0x6b, 0xc0, 0x8a, 0xae, 0xf9, 0x53, 0x07, 0x78, 0x7d, 0x2e,
+    0x03, 0xf1, 0xd6, 0xd2, 0xca, 0x4b, 0x96, 0x3e, 0xff, 0xbc, 0xa4, 0x97, 0xd1, 0x99, 0xa6, 0xaf,
+    0xfe, 0xec, 0x24, 0x23, 0xe5, 0x26, 0xa8, 0x28, 0xe5, 0xd3, 0x93, 0x34, 0xe9, 0xc4, 0xb4, 0x96,
+    0x56, 0xd6, 0x60, 0x01, 0x55, 0x06, 0x5b, 0xca, 0xc9, 0xf8, 0xcb, 0x49, 0xf2, 0x81, 0x03, 0x71,
+    0x58, 0x87, 0x19, 0x4c, 0xc3, 0xd4, 0x82, 0x14, 0xce, 0xe9, 0x2d, 0xda, 0xd6, 0xb4, 0xc6, 0x94,
+    0x06, 0x2d, 0x7b, 0x36, 0x58, 0x5a, 0xa0, 0x44, 0x4d, 0x02, 0x73, 0x12, 0x68, 0x72, 0x31, 0xb5,
+    0x90, 0xae, 0x96, 0x4b, 0x39, 0x19, 0xc7, 0x35, 0x33, 0x86, 0x4e, 0xc9, 0x34, 0x23, 0xe3, 0xe2,
+    0xa2, 0x9e, 0xe7, 0xe1, 0x61, 0x38, 0x0c, 0x66, 0x26, 0x24, 0x1c, 0x1c, 0x7c, 0x12, 0x18, 0x08,
+    0xf8, 0x01, 0x8f, 0xc8, 0x7c, 0xb1, 0x75, 0x89, 0xf5, 0x01, 0xbc, 0x4d, 0xf8, 0x5b, 0x90, 0x42,
+    0x64, 0x70, 0xfc, 0xff, 0x04, 0xb7, 0xb6, 0xa4, 0x84, 0x67, 0x04, 0x19, 0x39, 0x45, 0x3f, 0xcd,
+    0x51, 0xe5, 0x33, 0xe9, 0x44, 0x2e, 0xe5, 0x64, 0x9c, 0xf5, 0xd7, 0x62, 0xae, 0xea, 0x93, 0xd7,
+    0xbe, 0xeb, 0xf1, 0xb3, 0xe6, 0xf2, 0x33, 0x7f, 0x4f, 0x87, 0x73, 0xaf, 0x48, 0x75, 0x5d, 0x08,
+    0xcb, 0x4f, 0xcf, 0xbb, 0x7d, 0xe7, 0x68, 0xff, 0xdf, 0xf9, 0x9c, 0x0d, 0xa7, 0x77, 0xbb, 0xbd,
+    0x8e, 0xe6, 0xe5, 0xf1, 0x34, 0xa4, 0xf2, 0xff, 0x4f, 0x77, 0x5b, 0x6d, 0xae, 0x37, 0x37, 0x93,
+    0x63, 0xfe, 0xee, 0x3b, 0xe1, 0x6e, 0xef, 0xd2, 0xe1, 0x7a, 0x9c, 0xdd, 0xdf, 0x6e, 0x4f, 0x39,
+    0x7e, 0x74, 0x74, 0xf4, 0xa7, 0xb1, 0x8f, 0xe2, 0xdf, 0x11, 0xf3, 0xb6, 0xdd, 0xb9, 0x30, 0x56,
+    0xa8, 0x4c, 0x89, 0x82, 0x04, 0xd0, 0xfb, 0xf7, 0xf1, 0x76, 0xf4, 0x74, 0x77, 0xee, 0x42, 0xc9,
+    0xf7, 0xe1, 0xf1, 0xe5, 0xe9, 0x1d, 0xf8, 0x7c, 0xd8, 0xa7, 0xeb, 0xba, 0xae, 0xeb, 0xba, 0xae,
+    0xeb, 0xba, 0xae, 0xeb, 0xba, 0xae, 0xeb, 0xba, 0xae, 0xeb, 0xba, 0xae, 0xeb, 0xff, 0x35, 0xcd,
+    0x6d, 0xbc, 0xc7, 0x75, 0x36, 0xa9, 0x9c, 0x53, 0x5c, 0x54, 0xae, 0xe9, 0xc7, 0x75, 0xb5, 0x4c,
+    0x33, 0xf4, 0x19, 0xb6, 0x74, 0xa6, 0x54, 0x4d, 0x02, 0xb3, 0x3a, 0x95, 0xd8, 0x26, 0x96, 0x19,
+    0x86, 0x84, 0x61, 0xf9, 0xf9, 0x3a, 0x3b, 0x87, 0x40, 0x7b, 0x03, 0x5e, 0xf8, 0xb2, 0xba, 0x78,
+    0xe1, 0xeb, 0x02, 0x04, 0x08, 0x17, 0x2d, 0x5b, 0xb8, 0x80, 0xb7, 0x14, 0x66, 0xd1, 0x12, 0xce,
+    0x82, 0xc5, 0x0a, 0x95, 0x29, 0x52, 0x57, 0x64, 0x31, 0x42, 0x2b, 0x55, 0xa8, 0x54, 0x11, 0x9c,
+    0x22, 0x25, 0x8a, 0x94, 0x07, 0x02, 0x08, 0xe7, 0x41, 0x28, 0x6a, 0x4f, 0x06, 0xbd, 0xec, 0x78,
+    0xe2, 0x44, 0xd0, 0x09, 0x13, 0x20, 0x4b, 0x98, 0x2c, 0x51, 0xc2, 0x24, 0x89, 0x12, 0x24, 0x80,
+    0xd1, 0x24, 0x62, 0x81, 0x48, 0xf4, 0x02, 0x8d, 0x00, 0x1e, 0xf9, 0x93, 0x1e, 0x29, 0x62, 0x64,
+    0xd6, 0x2b, 0xf2, 0xc3, 0xef, 0xc7, 0x17, 0x42, 0xc4, 0xc5, 0x10, 0x3e, 0x21, 0x41, 0x82, 0x00,
+    0xf1, 0x43, 0xe4, 0xc3, 0x47, 0x8f, 0x1d, 0x3c, 0x7a, 0xf0, 0xc8, 0x61, 0x98, 0x03, 0x87, 0x8e,
+    0x1b, 0x38, 0x9e, 0xdc, 0xa8, 0x60, 0xc3, 0x05, 0x8d, 0x19, 0x35, 0xfa, 0x68, 0xc8, 0x98, 0x11,
+    0x43, 0x46, 0x8c, 0x17, 0x30, 0xe2, 0x5e, 0x70, 0xf5, 0xf1, 0x75, 0xc5, 0x2d, 0xe8, 0xef, 0x64,
+    0xb1, 0xb5, 0x62, 0x2f, 0xc5, 0x5e, 0x0a, 0x14, 0x7b, 0x27, 0xc0, 0x28, 0xf4, 0xc0, 0x26, 0xf4,
+    0x4a, 0x98, 0x88, 0x49, 0x94, 0xc8, 0x13, 0x31, 0x62, 0x9a, 0x07, 0x22, 0x04, 0x9e, 0x14, 0x04,
+    0xdf, 0x7f, 0x9d, 0x78, 0xef, 0x87, 0x3d, 0xea, 0xbd, 0xd3, 0xbb, 0x4d, 0x77, 0x1e, 0xec, 0x72,
+    0x26, 0x0f, 0x75, 0x5c, 0x1c, 0x5a, 0xb7, 0xbd, 0xe9, 0x9e, 0x5b, 0x7b, 0x4e, 0xbb, 0x64, 0x73,
+    0xc8, 0x76, 0x50, 0xe2, 0x90, 0x41, 0xc3, 0x86, 0xa4, 0x0c, 0x16, 0x2e, 0x60, 0x70, 0x5a, 0x88,
+    0x93, 0xc3, 0x36, 0xe3, 0xac, 0x57, 0x38, 0xa6, 0x95, 0xc2, 0x5b, 0x05, 0x24, 0x0a, 0x6e, 0x7f,
+    0xc0, 0x84, 0xa5, 0x5b, 0x04, 0x09, 0x6d, 0x74, 0x84, 0xb9, 0xba, 0xc6, 0x36, 0x57, 0xd3, 0xd4,
+    0x20, 0x28, 0xd3, 0xce, 0x7e, 0x05, 0xb4, 0xe4, 0xd9, 0x83, 0x32, 0x33, 0xe4, 0x03, 0xb2, 0x1f,
+    0xe7, 0x40, 0x26, 0xcb, 0x6a, 0x10, 0x8f, 0x7d, 0x31, 0x10, 0xfb, 0x0b, 0xb6, 0x2a, 0x28, 0x20,
+    0xa3, 0x26, 0x98, 0xa9, 0x5d, 0x03, 0xba, 0x06, 0x70, 0x75, 0x55, 0x4d, 0x71, 0x2d, 0x0f, 0x59,
+    0xc9, 0x7f, 0x91, 0x80, 0xab, 0xad, 0x00, 0x02, 0x66, 0xb0, 0x56, 0x80, 0x2c, 0x2d, 0x2c, 0x00,
+    0x58, 0x57, 0x55, 0x56, 0x55, 0x54, 0x56, 0x53, 0x54, 0x4b, 0x24, 0x52, 0x50, 0x53, 0x82, 0x51,
+    0x52, 0xd4, 0xa8, 0xff, 0xa1, 0x9e, 0xa4, 0xd3, 0x27, 0xaf, 0x29, 0xad, 0x14, 0x75, 0x5a, 0xcb,
+    0x46, 0xf5, 0x9a, 0xa0, 0x4c, 0x4b, 0xcd, 0xf8, 0x3f, 0xfa, 0xbf, 0xc9, 0x64, 0xf4, 0x9b, 0x89,
+    0x66, 0xa4, 0x65, 0x13, 0x7a, 0x19, 0x77, 0x80, 0x46, 0xf0, 0x38, 0x3f, 0x3a, 0x50, 0x92, 0x79,
+    0x25, 0x91, 0x66, 0x72, 0xfc, 0xe8, 0xe8, 0xe8, 0x4f, 0x63, 0x1f, 0x45, 0xc4, 0x30, 0x56, 0xa8,
+    0x4c, 0x89, 0x82, 0x04, 0xf0, 0x6f, 0x87, 0x8b, 0x3e, 0x3e, 0x31, 0xbd, 0xaf, 0x02, 0xd2, 0x38,
+    0x89, 0x7e, 0xa4, 0x95, 0x8a, 0x90, 0x5f, 0x4e, 0x90, 0x45, 0xfb, 0x31, 0x81, 0x0f, 0xf5, 0x24,
+    0x4f, 0xbf, 0x2c, 0x75, 0x4a, 0x46, 0x9b, 0x64, 0xa6, 0xb1, 0xe7, 0x52, 0xd2, 0xfc, 0xac, 0x92,
+    0x97, 0xa6, 0x4a, 0xd2, 0xb5, 0x29, 0xe7, 0xf2, 0x37, 0xaf, 0xfe, 0x97, 0x99, 0x56, 0x88, 0x90,
+    0x8f, 0x85, 0x5e, 0xd6, 0x13, 0x48, 0x12, 0xf3, 0x54, 0x84, 0x34, 0x84, 0x53, 0x1f, 0xfd, 0xd0,
+    0xa4, 0x33, 0xd9, 0x41, 0xb9, 0xcf, 0x7b, 0x69, 0x4e, 0x29, 0x9b, 0xa4, 0xc1, 0x79, 0xa1, 0x29,
+    0xc7, 0xbc, 0x22, 0xbd, 0xd1, 0x12, 0xe6, 0x35, 0xa5, 0x1a, 0xb2, 0x6c, 0x4b, 0xac, 0x8e, 0x63,
+    0x67, 0x0d, 0x56, 0x17, 0xd8, 0x9a, 0xb7, 0x08, 0xfc, 0xa8, 0x5f, 0x95, 0xf5, 0xa1, 0xcf, 0xa5,
+    0xe7, 0xff, 0x01, 0x5f, 0x76, 0x44, 0xe4, 0xe8, 0xe8, 0xd1, 0x17, 0x2b, 0x47, 0x86, 0x0f, 0x1a,
+    0x45, 0x31, 0x52, 0xb4, 0x28, 0x9c, 0x27, 0xd1, 0x21, 0x44, 0x87, 0x0c, 0xe5, 0x29, 0x64, 0x88,
+    0x10, 0x63, 0xa1, 0x41, 0x82, 0x08, 0x19, 0x0e, 0xba, 0x83, 0xe7, 0x8e, 0x1d, 0x3c, 0x5f, 0xec,
+    0x18, 0xd6, 0x41, 0x93, 0x98, 0x48, 0x67, 0x8e, 0x22, 0x9d, 0x39, 0x72, 0x12, 0xe5, 0xc4, 0x49,
+    0x84, 0x13, 0x07, 0x8e, 0x9b, 0x37, 0x6d, 0xdc, 0xb0, 0x59, 0xd3, 0x86, 0x8d, 0x1a, 0x34, 0x69,
+    0x0a, 0xd3, 0x9c, 0x51, 0x73, 0xc6, 0x0c, 0x9a, 0x32, 0x66, 0xa6, 0x65, 0xc6, 0x90, 0x11, 0x73,
+    0x38, 0xa6, 0x50, 0xcc, 0x17, 0xc3, 0xc2, 0x2e, 0x5e, 0x9e, 0xba, 0x6c, 0xe1, 0x02, 0xa5, 0x25,
+    0x8f, 0x61, 0xe1, 0x54, 0x14, 0xd4, 0xd3, 0x54, 0x2a, 0x25, 0x5f, 0x71, 0xf2, 0x77, 0x45, 0x50,
+    0xb0, 0x8a, 0x15, 0x2a, 0x55, 0xa4, 0x4c, 0x89, 0x42, 0x28, 0x25, 0x8a, 0x13, 0x41, 0x27, 0x4d,
+    0x04, 0x8d, 0x38, 0x35, 0x39, 0xf4, 0xf7, 0xb7, 0x84, 0x89, 0x92, 0x25, 0x49, 0xa8, 0x81, 0x4a,
+    0x7a, 0x24, 0x31, 0xf2, 0x67, 0x84, 0xc8, 0x5f, 0x91, 0x1e, 0x43, 0x8a, 0x0c, 0xf1, 0x53, 0x22,
+    0xb2, 0x14, 0x0b, 0xd2, 0x24, 0xc4, 0x8f, 0x09, 0x88, 0x0f, 0xe8, 0x8f, 0x21, 0x41, 0xfc, 0x7c,
+    0xf4, 0x70, 0x6a, 0x62, 0x82, 0x3e, 0xa3, 0x3a, 0x72, 0x24, 0xe1, 0xc8, 0xf1, 0x02, 0x07, 0xda,
+    0x0d, 0x1b, 0x35, 0x5e, 0xd0, 0xa8, 0x01, 0xa6, 0xd1, 0x9c, 0x61, 0x25, 0x63, 0xcf, 0x2a, 0xc6,
+    0xdc, 0xc2, 0x09, 0xa3, 0xaf, 0x45, 0x5f, 0x0b, 0x16, 0x7d, 0x2b, 0x58, 0x34, 0xc9, 0x53, 0xb1,
+    0x97, 0x97, 0x62, 0x8f, 0x4f, 0x71, 0x02, 0x05, 0xf8, 0x84, 0x09, 0x12, 0xe0, 0x12, 0x26, 0x4a,
+    0xe0, 0xf1, 0x21, 0xf0, 0xf4, 0x42, 0x94, 0xe9, 0x41, 0x84, 0xb9, 0xdf, 0x7e, 0xe7, 0xda, 0xed,
+    0x77, 0x1f, 0x3e, 0xa0, 0xe8, 0x7a, 0xbb, 0xfa, 0x9d, 0x97, 0x5d, 0xae, 0xe7, 0x1e, 0xee, 0x70,
+    0x0f, 0xf8, 0x4d, 0xe7, 0xb8, 0xbd, 0xb7, 0xff, 0xdf, 0x5e, 0xda, 0x24, 0xf6, 0x5c, 0x38, 0x6b,
+    0x1b, 0x92, 0x75, 0xa8, 0x72, 0xd8, 0x50, 0xd5, 0xb0, 0x01, 0x43, 0x85, 0x37, 0x0d, 0x19, 0xcc,
+    0xb0, 0x18, 0x2e, 0x98, 0x59, 0x80, 0x60, 0xa6, 0x06, 0x01, 0x2c, 0xa6, 0x86, 0x96, 0xa6, 0x75,
+    0x46, 0xf6, 0xa0, 0x2c, 0x2c, 0x36, 0xd6, 0xa0, 0x4b, 0xcd, 0x60, 0x41, 0x0d, 0xb6, 0x00, 0x85,
+    0x02, 0x6a, 0x02, 0x26, 0x98, 0x56, 0x81, 0x2f, 0x30, 0x81, 0x02, 0x7b, 0x02, 0xa8, 0x02, 0x60,
+    0x65, 0x39, 0x01, 0x50, 0x59, 0x5d, 0xf1, 0x35, 0xab, 0x66, 0xb2, 0x17, 0x79, 0xbc, 0x1d, 0xb7,
+    0x6a, 0x46, 0x26, 0x56, 0x6b, 0x61, 0x7d, 0xaa, 0xa5, 0x24, 0x67, 0x93, 0x49, 0x2b, 0x40, 0xfa,
+    0x4a, 0x09, 0x16, 0x24, 0x26, 0xde, 0xa9, 0x83, 0x24, 0x2f, 0x95, 0x32, 0xad, 0x38, 0xff, 0x2f,
+    0x2b, 0xe5, 0xa4, 0x8c, 0x94, 0xe3, 0x47, 0x47, 0x47, 0xb2, 0xdc, 0x28, 0x7e, 0x94, 0xff, 0x21,
+    0xc7, 0x47, 0x8e, 0x1e, 0xcd, 0x8c, 0x1a, 0x7d, 0x6a, 0x17, 0x23, 0x45, 0x88, 0x16, 0xa1, 0x48,
+    0xa4, 0x48, 0x31, 0x91, 0xa1, 0x43, 0x86, 0x08, 0xe1, 0x19, 0x44, 0x68, 0x90, 0x20, 0x42, 0x81,
+    0x04, 0xfd, 0x69, 0xec, 0x13, 0x08, 0xd0, 0x1f, 0x40, 0x7c, 0x1a, 0xfd, 0xf4, 0xf1, 0xc3, 0xc8,
+    0x87, 0xd1, 0xce, 0x1d, 0x3b, 0x7b, 0x16, 0xf5, 0xec, 0x41, 0x5c, 0xd4, 0x93, 0x27, 0x0f, 0x9e,
+    0x3b, 0x75, 0xea, 0xd0, 0x51, 0x9c, 0x43, 0x47, 0xc4, 0x1c, 0x39, 0x89, 0x72, 0xe2, 0x24, 0xc2,
+    0x89, 0xf3, 0x06, 0x8e, 0xda, 0x1b, 0x37, 0x88, 0x6d, 0xd8, 0xb8, 0x69, 0xb3, 0x86, 0xcd, 0x1a,
+    0x35, 0x69, 0xd0, 0xa8, 0x09, 0x93, 0x06, 0xcd, 0x99, 0x30, 0x66, 0xca, 0x9c, 0xe9, 0x33, 0x43,
+    0xa6, 0xcc, 0x18, 0x32, 0x59, 0x63, 0x0e, 0xc5, 0x94, 0x1d, 0xea, 0x08, 0x83, 0xe9, 0x0a, 0xbb,
+    0x00, 0xf3, 0xc5, 0x50, 0x87, 0x9f, 0x8f, 0x87, 0xc9, 0xa8, 0x43, 0x82, 0x8e, 0x48, 0x46, 0x0a,
+    0x92, 0xa4, 0xb0, 0xcc, 0x01, 0x43, 0x99, 0x19, 0x88, 0x89, 0x69, 0x9a, 0xca, 0xf3, 0xb3, 0xe4,
+    0x60, 0x10, 0x8c, 0x05, 0x51, 0xd0, 0x44, 0x02, 0x17, 0x14, 0x16, 0x14, 0x66, 0xff, 0x67, 0x0c,
+    0x1b, 0xbd, 0x64, 0x8d, 0x23, 0xcb, 0xbc, 0xdd, 0xee, 0x90, 0xcb, 0xc0, 0xc4, 0x20, 0xbe, 0x8f,
+    0x4c, 0x24, 0xfc, 0x6b, 0x4e, 0x79, 0xfc, 0xea, 0x36, 0xbf, 0x0f, 0xc3, 0xf9, 0x50, 0x7f, 0xf1,
+    0xe2, 0x7d, 0xb8, 0x75, 0x73, 0x3b, 0xfe, 0x32, 0xf0, 0xff, 0xf9, 0x97, 0xbc, 0x82, 0xba, 0x2f,
+    0xed, 0xae, 0x0d, 0xed, 0xa4, 0x24, 0x1a, 0x37, 0xac, 0xe4, 0x5b, 0x13, 0xfa, 0x4b, 0x6e, 0x76,
+    0xe9, 0x03, 0xc8, 0x22, 0x5c, 0x83, 0xc6, 0x49, 0x1c, 0xd4, 0x86, 0xa1, 0x9c, 0xff, 0x3b, 0x67,
+    0xdf, 0x49, 0xbe, 0xca, 0xdc, 0x66, 0x2d, 0x5d, 0xf6, 0x41, 0x5d, 0xad, 0xd3, 0x19, 0x41, 0xf8,
+    0xa1, 0x58, 0x47, 0xfa, 0x1b, 0x81, 0xaf, 0xb6, 0x8b, 0x7d, 0xcf, 0x77, 0xbe, 0x1b, 0x03, 0xed,
+    0x98, 0xe9, 0xee, 0xbb, 0x81, 0xd4, 0x10, 0x3f, 0xbe, 0xd3, 0xc7, 0x60, 0x3e, 0x43, 0x33, 0x8b,
+    0x8a, 0xb0, 0x66, 0x50, 0xfa, 0xef, 0xf2, 0x58, 0x5d, 0x18, 0xf7, 0x9c, 0x81, 0x5c, 0x29, 0x33,
+    0x90, 0x05, 0x7d, 0xfc, 0xe0, 0xf8, 0xc0, 0x58, 0xcb, 0x4e, 0x1c, 0x91, 0x4b, 0x26, 0xf7, 0x96,
+    0x41, 0xbb, 0x62, 0xb2, 0x63, 0x96, 0x19, 0x9c, 0xf9, 0x1c, 0xf7, 0x73, 0xff, 0x18, 0x87, 0xb1,
+    0xe7, 0xc7, 0xa2, 0x31, 0xb6, 0x45, 0xb9, 0x6a, 0x17, 0x28, 0xb5, 0xfb, 0x5b, 0xd3, 0x7e, 0x73,
+    0x55, 0xff, 0x52, 0xb7, 0x81, 0xd6, 0xad, 0xb7, 0xf3, 0x86, 0x2a, 0x57, 0xd9, 0x70, 0xa8, 0x36,
+    0xd2, 0x5d, 0xc3, 0x3c, 0x39, 0x00, 0x38, 0xef, 0x5d, 0xd1, 0x8f, 0x94, 0x13, 0xc0, 0x2b, 0x5f,
+    0x90, 0xa8, 0x51, 0xd2, 0xcb, 0xe1, 0x9c, 0x6f, 0x9b, 0x83, 0xb4, 0xce, 0x3c, 0x5f, 0xd7, 0x1b,
+    0x09, 0x07, 0x17, 0x7b, 0x37, 0x24, 0x09, 0x93, 0xff, 0xb3, 0x30, 0xda, 0x67, 0xab, 0x33, 0x05,
+    0xb9, 0xbd, 0x86, 0x01, 0x33, 0x90, 0xf5, 0x14, 0x4c, 0x46, 0x7d, 0x45, 0xee, 0xee, 0x15, 0x6e,
+    0x69, 0xb1, 0xa0, 0x7b, 0xbb, 0x65, 0x37, 0xae, 0x10, 0xf8, 0x18, 0x9e, 0x5c, 0xd1, 0x7f, 0xd8,
+    0x8e, 0x45, 0x2d, 0x2e, 0xeb, 0x11, 0x1b, 0xea, 0x2f, 0x5f, 0xcf, 0x93, 0x39, 0x7c, 0x89, 0x96,
+    0x3b, 0xf2, 0xf0, 0xb3, 0xf7, 0x2e, 0xa6, 0x28, 0x9e, 0x47, 0x71, 0x85, 0x65, 0xc9, 0x77, 0xcd,
+    0xb9, 0xcc, 0xda, 0x30, 0xbd, 0x2d, 0xa4, 0x28, 0x3d, 0x3c, 0x4d, 0x0c, 0x39, 0xab, 0xab, 0x69,
+    0x03, 0xfd, 0x16, 0x83, 0xd8, 0x0d, 0x3d, 0xd8, 0x5d, 0x10, 0x00, 0x7d, 0xa9, 0xe7, 0x07, 0xf0,
+    0x93, 0xba, 0x97, 0xc7, 0xad, 0x95, 0xd2, 0x20, 0x33, 0xe7, 0x4c, 0x45, 0x73, 0x0e, 0x1a, 0xf2,
+    0x84, 0x45, 0xba, 0x20, 0xad, 0xbf, 0xb2, 0x04, 0xed, 0x2d, 0x53, 0x17, 0x23, 0xe5, 0x71, 0xab,
+    0x75, 0x02, 0x2f, 0xb3, 0x73, 0xe6, 0x3c, 0x8b, 0x46, 0x92, 0x79, 0xb5, 0x37, 0x68, 0x58, 0x46,
+    0xea, 0x54, 0xfb, 0x86, 0x9c, 0x81, 0x4f, 0x75, 0x46, 0xa0, 0x67, 0xf3, 0x00, 0xfe, 0xca, 0x21,
+    0x47, 0x33, 0x5b, 0xe3, 0xfa, 0xb0, 0xbd, 0x2f, 0x1e, 0x3c, 0xa2, 0x23, 0x45, 0xb1, 0xb3, 0xed,
+    0x4d, 0x83, 0xb2, 0x59, 0x28, 0xe5, 0x4a, 0x99, 0x75, 0xbc, 0xf3, 0x73, 0x2c, 0xe4, 0x49, 0xbb,
+    0x9f, 0x30, 0xeb, 0x0d, 0x0e, 0xac, 0x5b, 0xfe, 0x9f, 0x9a, 0x65, 0xbe, 0x1f, 0x2d, 0x91, 0xcf,
+    0x63, 0x2b, 0x8f, 0x67, 0xf3, 0x93, 0xef, 0x02, 0x05, 0x7f, 0x48, 0xc4, 0x57, 0x1c, 0x83, 0xfe,
+    0xae, 0xba, 0xc4, 0xa9, 0x41, 0x60, 0xf9, 0xb0, 0xd6, 0x57, 0x81, 0x3b, 0xc0, 0x6e, 0xfb, 0x62,
+    0x73, 0x55, 0x4f, 0x86, 0x0d, 0xf5, 0x06, 0x0b, 0xaf, 0x8f, 0x28, 0xdf, 0x0b, 0x47, 0xc2, 0xde,
+    0xd4, 0x15, 0xf9, 0x22, 0xf0, 0x37, 0x42, 0x01, 0x4f, 0x59, 0x4d, 0x56, 0x3a, 0xf2, 0xd2, 0xe0,
+    0x26, 0x17, 0x85, 0xf5, 0xed, 0x7e, 0xcb, 0xaf, 0xca, 0xfd, 0xd3, 0x57, 0x6d, 0x53, 0x3a, 0x54,
+    0x3b, 0x24, 0xf8, 0x25, 0x2d, 0x00, 0xf5, 0x1c, 0xe5, 0x7a, 0x0a, 0x17, 0xdb, 0x87, 0xd1, 0x5e,
+    0x26, 0x5d, 0xd2, 0xe9, 0x35, 0x7d, 0xab, 0xf5, 0x5b, 0x25, 0x95, 0xa3, 0xcd, 0x0c, 0xc4, 0xe6,
+    0xa4, 0xac, 0x44, 0x67, 0xe2, 0x72, 0xd8, 0x5f, 0x82, 0xa3, 0xb3, 0x56, 0x05, 0x7d, 0xe7, 0x0e,
+    0x45, 0x73, 0xa2, 0x1d, 0x1e, 0xf1, 0x13, 0x81, 0xcc, 0x19, 0xbc, 0x46, 0xac, 0xf7, 0xdb, 0x4d,
+    0x1e, 0x12, 0x3c, 0x14, 0xf3, 0x30, 0xac, 0x53, 0xd6, 0xbe, 0xa4, 0x7a, 0x6f, 0x21, 0x1f, 0xb4,
+    0xac, 0xb9, 0xe2, 0xf3, 0xcd, 0xec, 0xd2, 0xee, 0xcd, 0xf2, 0xaf, 0x65, 0xd3, 0x54, 0x45, 0x1e,
+    0xf0, 0x8f, 0xe2, 0x19, 0x3c, 0x5c, 0x32, 0x6c, 0x11, 0x50, 0xfc, 0x66, 0xd5, 0x6f, 0xda, 0x66,
+    0x9b, 0xff, 0x0b, 0xf0, 0x8f, 0x47, 0xfc, 0xaf, 0x75, 0xff, 0xb0, 0xad, 0x36, 0xe7, 0x96, 0xd9,
+    0x5e, 0xb3, 0xa0, 0xe4, 0x24, 0xbf, 0x5d, 0xca, 0x67, 0x48, 0xf4, 0x72, 0x1e, 0x47, 0xbc, 0x9d,
+    0xab, 0x51, 0x97, 0xbc, 0xce, 0x5a, 0xc0, 0x06, 0xc9, 0x20, 0x20, 0xa3, 0xa6, 0xa1, 0x50, 0x48,
+    0x84, 0x34, 0x08, 0x06, 0x89, 0x3a, 0x61, 0x0d, 0x8d, 0xa2, 0x32, 0xa0, 0x71, 0x73, 0x51, 0xd4,
+    0x01, 0x6b, 0x68, 0x15, 0xaa, 0x61, 0x8d, 0x9b, 0x89, 0xa0, 0x16, 0x58, 0x43, 0xa5, 0x58, 0x35,
+    0x00, 0x6d, 0x48, 0xcc, 0x51, 0x46, 0x1d, 0x78, 0x8d, 0xbc, 0x90, 0x12, 0xb8, 0xee, 0x80, 0x2f,
+    0xcd, 0xbb, 0x3a, 0x0a, 0x89, 0x80, 0x58, 0xe4, 0x40, 0x26, 0xbf, 0x32, 0x50, 0xef, 0x80, 0x6f,
+    0x78, 0x86, 0x6b, 0x46, 0x10, 0xbc, 0x36, 0xe0, 0xb6, 0x0b, 0x30, 0xf8, 0x20, 0xe3, 0x87, 0x22,
+    0x05, 0xb9, 0x18, 0x6b, 0xc9, 0xac, 0x3f, 0xc6, 0xfb, 0x49, 0x68, 0xf2, 0xa8, 0x3d, 0x00, 0x01,
+    0xf1, 0x79, 0x36, 0x9b, 0xff, 0x09, 0x16, 0xbc, 0x31, 0x2a, 0xa7, 0x7c, 0x5d, 0x46, 0xb6, 0x09,
+    0x28, 0x3f, 0x35, 0xd5, 0x7c, 0xbc, 0x1d, 0x37, 0xea, 0x81, 0x8a, 0xbf, 0x09, 0x73, 0xd6, 0xeb,
+    0x71, 0xec, 0x91, 0x60, 0xb0, 0xe4, 0xf7, 0x01, 0xaf, 0xfb, 0xdf, 0xbc, 0xd1, 0x42, 0x60, 0x3e,
+    0x49, 0xea, 0x61, 0x77, 0x79, 0x0f, 0xbc, 0x6f, 0x67, 0xd7, 0xcc, 0xd2, 0x5e, 0xa5, 0xcc, 0xd9,
+    0x11, 0x2f, 0x4f, 0x5d, 0xba, 0xaf, 0xa6, 0x1b, 0x13, 0xee, 0xa1, 0x57, 0x7b, 0xec, 0x82, 0x63,
+    0x9b, 0x7a, 0xc7, 0x6c, 0x31, 0xdf, 0xfe, 0x8f, 0x51, 0x88, 0x9f, 0xb4, 0xdb, 0xc7, 0x05, 0xd2,
+    0x75, 0x59, 0xe1, 0x04, 0xcf, 0x43, 0x05, 0xc3, 0x61, 0x8d, 0xf2, 0xc3, 0x70, 0x55, 0x8b, 0x6b,
+    0xdd, 0x57, 0x76, 0xc5, 0xa5, 0x2b, 0x75, 0x2d, 0x18, 0x20, 0xba, 0xe2, 0xd1, 0x45, 0x2d, 0xd3,
+    0x38, 0x03, 0x2a, 0x32, 0xf3, 0x2c, 0x29, 0x71, 0x6a, 0x47, 0x27, 0xa4, 0x3b, 0x44, 0x7c, 0x86,
+    0x81, 0x23, 0x47, 0xec, 0xa9, 0xd6, 0x87, 0x21, 0xe5, 0x18, 0xe7, 0xff, 0xe2, 0x4a, 0xdc, 0x77,
+    0xa3, 0x77, 0x47, 0x4a, 0x82, 0x83, 0xc4, 0x6a, 0xcb, 0xaf, 0x6f, 0x05, 0x93, 0x73, 0x12, 0x68,
+    0x11, 0x21, 0xce, 0x7a, 0x8a, 0x9d, 0xf2, 0x72, 0xce, 0x9f, 0xe1, 0x06, 0x19, 0xe9, 0x50, 0xc9,
+    0x5a, 0x49, 0x3e, 0x7c, 0x50, 0x8f, 0xe5, 0x68, 0xb4, 0x84, 0x0b, 0xab, 0xe7, 0x08, 0x1e, 0xb0,
+    0x8f, 0xcf, 0x0a, 0x30, 0x07, 0xed, 0x58, 0x34, 0x5f, 0xd1, 0x69, 0x58, 0xc5, 0x71, 0xdc, 0x00,
+    0x85, 0xc0, 0x1f, 0x0e, 0xde, 0x8f, 0x9a, 0x60, 0x27, 0xef, 0xf5, 0x9e, 0xd6, 0xfb, 0xfd, 0x9e,
+    0xaf, 0xfb, 0x7d, 0x5d, 0xf7, 0xd3, 0xf9, 0xe6, 0x12, 0x3d, 0xbc, 0x9a, 0x81, 0x5d, 0xb1, 0x07,
+    0x6b, 0xeb, 0x48, 0x5f, 0x76, 0x86, 0xfb, 0xd0, 0xf7, 0x40, 0xf1, 0xff, 0x20, 0xb8, 0x79, 0xf4,
+    0x3c, 0x02, 0xb5, 0xbf, 0xd9, 0x51, 0x9a, 0xc7, 0xcf, 0x18, 0x9b, 0x69, 0x29, 0x1f, 0x2f, 0xab,
+    0x13, 0xca, 0x57, 0x85, 0x9d, 0x0d, 0xfc, 0x94, 0x00, 0xe1, 0xad, 0x2e, 0x95, 0x45, 0x08, 0xd3,
+    0xd4, 0xc9, 0x4b, 0x40, 0xc6, 0x8c, 0xaa, 0x8f, 0xf7, 0x6c, 0xb4, 0x99, 0xfb, 0x00, 0x07, 0x62,
+    0x79, 0xdc, 0xff, 0x7e, 0xf1, 0x95, 0x19, 0x57, 0x05, 0x23, 0x64, 0xe1, 0x18, 0x17, 0x1c, 0x6c,
+    0x25, 0x2e, 0x60, 0xd9, 0xdf, 0xfc, 0x41, 0x18, 0x70, 0x39, 0x6e, 0x2c, 0x9e, 0x46, 0xf7, 0xf8,
+    0x52, 0x67, 0x5e, 0x8f, 0x25, 0xf3, 0x21, 0x1a, 0xc9, 0xfa, 0xa1, 0xe8, 0x89, 0xee, 0x17, 0xdb,
+    0x5d, 0xca, 0x32, 0x17, 0x36, 0x0c, 0x93, 0xd2, 0xa7, 0x94, 0xda, 0x04, 0xd2, 0x7e, 0xb2, 0x3c,
+    0xa2, 0xdf, 0xcc, 0x97, 0xc4, 0x3b, 0xff, 0x3a, 0xb0, 0x88, 0x6f, 0xc9, 0xe8, 0xc0, 0x91, 0x07,
+    0x52, 0x19, 0x21, 0x56, 0xf6, 0xad, 0xac, 0xcc, 0xd0, 0x3c, 0x1c, 0xdf, 0xbd, 0xbd, 0x44, 0x9b,
+    0x8a, 0x83, 0x01, 0x6c, 0x8d, 0xa4, 0x93, 0x31, 0x1e, 0x7d, 0x71, 0x6d, 0x63, 0xf2, 0x1c, 0x77,
+    0xe3, 0x62, 0x61, 0x77, 0x0d, 0xda, 0x7b, 0xb9, 0x13, 0x0b, 0xb8, 0x32, 0x91, 0xb1, 0x0f, 0x34,
+    0x7e, 0xc4, 0xf7, 0x71, 0xd8, 0xb8, 0x20, 0xbb, 0x21, 0x69, 0xb2, 0x7b, 0x68, 0xc8, 0x97, 0xdc,
+    0x4c, 0x87, 0x19, 0xb4, 0xb0, 0x98, 0x89, 0x9b, 0x62, 0x0f, 0xf8, 0x7a, 0xe3, 0x4c, 0xec, 0x73,
+    0xc2, 0x9a, 0xb6, 0x71, 0x91, 0xe0, 0xe6, 0xc9, 0x63, 0x10, 0x98, 0x19, 0xb7, 0x45, 0x94, 0x5d,
+    0xce, 0xb9, 0xf2, 0x4e, 0xc0, 0xa0, 0x42, 0x1e, 0x9e, 0xe2, 0x03, 0xa1, 0xdc, 0x20, 0x79, 0x45,
+    0x26, 0x60, 0x58, 0x39, 0x3d, 0xcf, 0x78, 0x84, 0xe9, 0xff, 0x4c, 0x4e, 0x37, 0xf1, 0xca, 0xf9,
+    0x35, 0xcf, 0xe4, 0xb4, 0x56, 0x92, 0x87, 0x28, 0x93, 0x39, 0x37, 0x52, 0xa4, 0x97, 0x13, 0x24,
+    0x84, 0x66, 0x1d, 0xd8, 0x69, 0xe3, 0xa0, 0x12, 0x1a, 0x34, 0x4b, 0xda, 0x76, 0xb3, 0xaa, 0x17,
+    0xc4, 0x10, 0x37, 0x0b, 0xdc, 0xa0, 0x43, 0x97, 0x75, 0xfb, 0x9b, 0xc3, 0xab, 0x95, 0x33, 0x20,
+    0x5d, 0x6e, 0x8e, 0x15, 0x60, 0x6a, 0xfe, 0xca, 0xee, 0x7b, 0x45, 0x3c, 0x14, 0xf6, 0xf1, 0x72,
+    0x91, 0xa7, 0xcb, 0x05, 0x86, 0x96, 0xc6, 0x72, 0xbc, 0xce, 0x48, 0xe9, 0x61, 0xf8, 0x67, 0xe0,
+    0x26, 0xa4, 0x59, 0xfc, 0xe3, 0xf1, 0xc9, 0x55, 0x27, 0xbf, 0xde, 0x07, 0x5f, 0x16, 0xd9, 0x85,
+    0x88, 0x49, 0x5b, 0x7f, 0xe8, 0x04, 0xf7, 0x84, 0x33, 0x64, 0x47, 0xe2, 0xe5, 0x10, 0x00, 0xb0,
+    0xbf, 0x3d, 0x0c, 0x74, 0xbf, 0x98, 0x41, 0x38, 0xef, 0x97, 0xce, 0xac, 0xbe, 0x45, 0xbc, 0xb9,
+    0x88, 0xc6, 0x20, 0xc1, 0x70, 0xba, 0x9b, 0xfe, 0x72, 0xe7, 0x3e, 0xa3, 0xa4, 0x9f, 0x5c, 0x2f,
+    0x98, 0xda, 0x71, 0xe3, 0xe0, 0x68, 0xf3, 0xa3, 0xbd, 0x0d, 0x6d, 0x7f, 0xf1, 0x25, 0xee, 0x9d,
+    0xd9, 0xd7, 0x71, 0x22, 0x9e, 0x78, 0xae, 0x0c, 0xba, 0x78, 0xcc, 0xf6, 0x3c, 0xc9, 0xa3, 0x89,
+    0x37, 0xc6, 0x9c, 0xb7, 0x95, 0x43, 0xf1, 0xc1, 0x84, 0x79, 0x4c, 0x9a, 0x37, 0x1a, 0x62, 0x63,
+    0x0b, 0x0c, 0x16, 0x12, 0x64, 0x19, 0xbc, 0x1c, 0x1f, 0x84, 0x05, 0xa8, 0x89, 0x13, 0x61, 0x22,
+    0xdf, 0xac, 0xae, 0xaf, 0x47, 0x55, 0x12, 0xcf, 0x0d, 0xc0, 0x6a, 0x09, 0x78, 0xb2, 0xb3, 0xf4,
+    0xe9, 0x1a, 0xbd, 0xdd, 0x34, 0xbb, 0x9b, 0xf1, 0x14, 0xba, 0xf4, 0xcb, 0x70, 0x08, 0xd1, 0x76,
+    0x9e, 0xee, 0x27, 0x3c, 0xa1, 0xcb, 0x02, 0xda, 0x5d, 0x17, 0x2c, 0x60, 0xd2, 0xf0, 0xa7, 0x44,
+    0xf3, 0x19, 0xf1, 0xb3, 0x46, 0x1e, 0x1e, 0x49, 0x54, 0xe7, 0xcf, 0x38, 0x50, 0x38, 0x7e, 0x4d,
+    0x0f, 0x20, 0xf3, 0x77, 0xf2, 0x5f, 0xbc, 0x83, 0xaa, 0x6b, 0x5b, 0x3d, 0x66, 0x60, 0xf9, 0x7e,
+    0x06, 0x1b, 0x04, 0x89, 0xf9, 0xf1, 0x81, 0x5b, 0x5d, 0xe8, 0xe8, 0xe8, 0xd2, 0xd3, 0x2f, 0xa0,
+    0xa1, 0xa3, 0x45, 0x23, 0xa9, 0x68, 0xce, 0x17, 0xd0, 0x47, 0x47, 0x45, 0xc7, 0xad, 0xa2, 0x72,
+    0xa1, 0x7d, 0x03, 0xf7, 0x10, 0x1c, 0x51, 0x75, 0x89, 0x83, 0xc0, 0x57, 0x7d, 0xe3, 0x70, 0xb2,
+    0xc5, 0xba, 0x9d, 0xae, 0x15, 0x8f, 0xc6, 0x07, 0x0c, 0x91, 0x78, 0x5e, 0x76, 0x57, 0x1e, 0x4a,
+    0xf2, 0x21, 0xd9, 0xfe, 0x95, 0x5c, 0x58, 0xae, 0x61, 0x79, 0x08, 0x3a, 0xed, 0x2d, 0xfe, 0x0f,
+    0x37, 0xca, 0xc6, 0x65, 0xa5, 0xa9, 0x36, 0x37, 0x23, 0xf4, 0x71, 0x62, 0xce, 0x4f, 0x8f, 0xed,
+    0xbd, 0x8a, 0x96, 0x25, 0xd9, 0xe3, 0x03, 0xe2, 0x6f, 0xc5, 0x70, 0x38, 0xea, 0x01, 0x51, 0x40,
+    0x2c, 0x79, 0x03, 0x98, 0x45, 0x70, 0x60, 0xf3, 0x3f, 0x82, 0xf3, 0x3c, 0xbc, 0x67, 0xfb, 0xb4,
+    0xc3, 0xc7, 0x7d, 0x1f, 0xdf, 0xf0, 0xe8, 0xbd, 0xec, 0x1b, 0xcb, 0xad, 0x25, 0x4e, 0x64, 0x8c,
+    0xd3, 0xed, 0x2e, 0x6c, 0x06, 0xc2, 0x50, 0xac, 0x81, 0x0a, 0x2a, 0xdf, 0xc7, 0x8a, 0x88, 0x80,
+    0x0f, 0x5f, 0xd8, 0xa1, 0x84, 0x32, 0xef, 0x46, 0xed, 0x2a, 0x87, 0x98, 0xce, 0xbb, 0x5c, 0x68,
+    0xac, 0x56, 0xd5, 0xd9, 0x27, 0x39, 0x9a, 0x6c, 0x68, 0xfe, 0x23, 0x80, 0x99, 0xfb, 0x09, 0x3f,
+    0x42, 0x38, 0x8b, 0x8c, 0xef, 0x0f, 0x19, 0x8c, 0x16, 0xa2, 0x41, 0x68, 0x46, 0x28, 0x70, 0xd7,
+    0xed, 0x71, 0x03, 0x86, 0x65, 0x2c, 0x0f, 0xf9, 0x02, 0xc5, 0xcd, 0xc5, 0x3f, 0xc0, 0x86, 0x42,
+    0xeb, 0x01, 0x73, 0xfc, 0xd5, 0x84, 0x9f, 0xb0, 0x2b, 0xe3, 0x3b, 0x26, 0xc4, 0x6d, 0x0e, 0xfe,
+    0x15, 0x7e, 0x07, 0xbf, 0xda, 0xcb, 0x19, 0xa7, 0xf0, 0xd0, 0xb3, 0x0b, 0xea, 0xc2, 0x71, 0x6e,
+    0x83, 0x75, 0xd6, 0x03, 0x79, 0xee, 0xda, 0x88, 0x8b, 0x87, 0x90, 0x53, 0x88, 0xa5, 0x5d, 0x9c,
+    0xf3, 0xd7, 0x20, 0x5d, 0x39, 0x0d, 0xb1, 0x73, 0x7b, 0x37, 0x35, 0x57, 0xf2, 0x70, 0x65, 0x06,
+    0xd9, 0xd4, 0xd0, 0x88, 0xb2, 0x83, 0xf3, 0x83, 0x97, 0x33, 0xdc, 0xbb, 0x12, 0xcb, 0x0e, 0xe6,
+    0x69, 0xb8, 0xe7, 0x74, 0xbc, 0x9e, 0x74, 0x54, 0xe6, 0x4a, 0xdc, 0x6d, 0x87, 0x7e, 0x30, 0x69,
+    0x6c, 0x1e, 0x1f, 0x50, 0x06, 0x0e, 0x28, 0xf0, 0x7c, 0x6e, 0x4a, 0x40, 0x48, 0xd1, 0x47, 0x50,
+    0x62, 0x31, 0x44, 0x14, 0x8c, 0xb4, 0x26, 0xe7, 0xb2, 0xb2, 0x5e, 0xf7, 0x4f, 0x66, 0x01, 0xc6,
+    0x7f, 0x58, 0xd6, 0xfb, 0x52, 0x2b, 0xf8, 0x31, 0x90, 0x4d, 0xa9, 0xe7, 0xdf, 0xd9, 0x5f, 0x7c,
+    0xf5, 0xab, 0x91, 0xd8, 0xbe, 0xda, 0x44, 0x68, 0x99, 0x6c, 0x33, 0x93, 0xd0, 0x2c, 0x34, 0xc9,
+    0x09, 0x3c, 0xe3, 0xb3, 0x3f, 0xb1, 0xe9, 0x1d, 0xec, 0x4b, 0x14, 0x2b, 0xbb, 0xa8, 0xc1, 0x61,
+    0xed, 0x3f, 0x5d, 0xc5, 0x33, 0x9e, 0x85, 0x65, 0x20, 0x3e, 0xd2, 0x3f, 0x71, 0x78, 0xd5, 0xe3,
+    0x7e, 0x72, 0x7b, 0x97, 0xcd, 0xfc, 0xfd, 0x8e, 0xc8, 0x4f, 0x69, 0x2f, 0x9d, 0x12, 0x50, 0x9f,
+    0x9c, 0x9c, 0x8d, 0xe7, 0x54, 0x74, 0x1b, 0x27, 0x45, 0xc9, 0x04, 0x32, 0xa6, 0xe4, 0x17, 0xb0,
+    0x89, 0x81, 0x9a, 0x93, 0xeb, 0xfc, 0x8f, 0x13, 0xb8, 0x5d, 0xda, 0xb2, 0xde, 0xd8, 0x95, 0xa2,
+    0x6b, 0xc6, 0xb1, 0x07, 0x0a, 0x52, 0xb2, 0xb7, 0xe6, 0x03, 0xd0, 0xef, 0x4f, 0x71, 0xd3, 0x8c,
+    0x85, 0xfd, 0x01, 0xbd, 0x38, 0xec, 0xb0, 0xc3, 0x84, 0x00, 0x8f, 0x25, 0x85, 0x5f, 0x91, 0x04,
+    0x3d, 0x3b, 0x57, 0x1f, 0x2e, 0x84, 0x85, 0x8b,
 };
+const ShaderModule Blob036 = { Blob036_Data, 4296u, 4117u, 36u };
 
-extern const uint32_t Blob074[4125];
-const uint32_t Blob074[4125] = {
-    0x07230203, 0x00010300, 0x0008000b, 0x0000021d, 0x00000000, 0x00020011, 0x00000001, 0x00020011,
-    0x0000002e, 0x0006000b, 0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e,
-    0x00000000, 0x00000001, 0x0006000f, 0x00000005, 0x00000004, 0x6e69616d, 0x00000000, 0x00000104,
-    0x00060010, 0x00000004, 0x00000011, 0x00000040, 0x00000001, 0x00000001, 0x00030003, 0x00000002,
-    0x000001c2, 0x000a0004, 0x475f4c47, 0x4c474f4f, 0x70635f45, 0x74735f70, 0x5f656c79, 0x656e696c,
-    0x7269645f, 0x69746365, 0x00006576, 0x00080004, 0x475f4c47, 0x4c474f4f, 0x6e695f45, 0x64756c63,
-    0x69645f65, 0x74636572, 0x00657669, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000, 0x000a0005,
-    0x0000000e, 0x65766f43, 0x65676172, 0x656c6954, 0x65786950, 0x3175286c, 0x3b31753b, 0x753b3175,
-    0x00003b31, 0x00060005, 0x0000000a, 0x796c6f70, 0x496e6f67, 0x7865646e, 0x00000000, 0x00030005,
-    0x0000000b, 0x00000078, 0x00030005, 0x0000000c, 0x00000079, 0x00050005, 0x0000000d, 0x656c6974,
-    0x65786950, 0x0000006c, 0x000a0005, 0x00000014, 0x65766f43, 0x65676172, 0x41736157, 0x70656363,
-    0x28646574, 0x753b3175, 0x31753b31, 0x0000003b, 0x00060005, 0x00000011, 0x796c6f70, 0x496e6f67,
-    0x7865646e, 0x00000000, 0x00030005, 0x00000012, 0x00000078, 0x00030005, 0x00000013, 0x00000079,
-    0x000b0005, 0x0000001b, 0x74697257, 0x6e695765, 0x676e696e, 0x65766f43, 0x65676172, 0x3b317528,
-    0x753b3175, 0x31753b31, 0x0000003b, 0x00060005, 0x00000017, 0x796c6f70, 0x496e6f67, 0x7865646e,
-    0x00000000, 0x00030005, 0x00000018, 0x00000078, 0x00030005, 0x00000019, 0x00000079, 0x00050005,
-    0x0000001a, 0x65766f63, 0x65676172, 0x00000000, 0x00040005, 0x0000001d, 0x656c6974, 0x00000058,
-    0x00040005, 0x00000021, 0x656c6974, 0x00000059, 0x00050005, 0x00000024, 0x656e696c, 0x69547261,
-    0x0000656c, 0x00050005, 0x00000028, 0x65726353, 0x69576e65, 0x00687464, 0x00060005, 0x0000002a,
-    0x656c6954, 0x72655073, 0x656e694c, 0x00000000, 0x00060005, 0x0000002f, 0x61636f6c, 0x6c6f506c,
-    0x6e6f6779, 0x00000000, 0x00060005, 0x00000031, 0x68737550, 0x736e6f43, 0x746e6174, 0x00000073,
-    0x00060006, 0x00000031, 0x00000000, 0x56727543, 0x61697261, 0x0000746e, 0x00060006, 0x00000031,
-    0x00000001, 0x57786554, 0x68746469, 0x00000000, 0x00060006, 0x00000031, 0x00000002, 0x48786554,
-    0x68676965, 0x00000074, 0x00060006, 0x00000031, 0x00000003, 0x57786554, 0x53706172, 0x00000000,
-    0x00060006, 0x00000031, 0x00000004, 0x57786554, 0x54706172, 0x00000000, 0x00070006, 0x00000031,
-    0x00000005, 0x49786554, 0x70614373, 0x65727574, 0x00000000, 0x00070006, 0x00000031, 0x00000006,
-    0x74706143, 0x59657275, 0x7366664f, 0x00007465, 0x00050006, 0x00000031, 0x00000007, 0x6461705f,
-    0x00000000, 0x00030005, 0x00000033, 0x00006370, 0x00040005, 0x00000039, 0x756f7267, 0x00000070,
-    0x00030005, 0x0000003d, 0x00746962, 0x00050005, 0x00000041, 0x6b73616d, 0x65646e49, 0x00000078,
-    0x00040005, 0x00000047, 0x6b73616d, 0x00000000, 0x00060005, 0x0000004e, 0x526e6942, 0x6c757365,
-    0x66754274, 0x00726566, 0x00080006, 0x0000004e, 0x00000000, 0x69726156, 0x57746e61, 0x436b726f,
-    0x746e756f, 0x00000000, 0x00080006, 0x0000004e, 0x00000001, 0x74726f53, 0x6f576465, 0x664f6b72,
-    0x74657366, 0x00000000, 0x00090006, 0x0000004e, 0x00000002, 0x69726156, 0x57746e61, 0x526b726f,
-    0x436c6165, 0x746e756f, 0x00000000, 0x00080006, 0x0000004e, 0x00000003, 0x74726f53, 0x6b726f57,
-    0x6b726f57, 0x6e756f43, 0x00000074, 0x00090006, 0x0000004e, 0x00000004, 0x6e6e6942, 0x4d676e69,
-    0x416b7361, 0x664f646e, 0x74657366, 0x00000000, 0x00030005, 0x00000050, 0x00000000, 0x00060005,
-    0x00000052, 0x65726353, 0x65486e65, 0x74686769, 0x00000000, 0x00050005, 0x00000053, 0x656c6954,
-    0x656e694c, 0x00000073, 0x00070005, 0x00000057, 0x6e6e6942, 0x4d676e69, 0x536b7361, 0x74726174,
-    0x00000000, 0x00050005, 0x00000068, 0x65776f6c, 0x73614d72, 0x0000006b, 0x00040005, 0x00000073,
-    0x6964726f, 0x006c616e, 0x00050005, 0x00000079, 0x6b726f77, 0x65646e49, 0x00000078, 0x00080005,
-    0x0000007d, 0x6e6e6942, 0x57676e69, 0x4f6b726f, 0x65736666, 0x74537374, 0x00747261, 0x00060005,
-    0x00000086, 0x5778614d, 0x546b726f, 0x73656c69, 0x00000000, 0x00050005, 0x0000008c, 0x656c6974,
-    0x656e6e49, 0x00000072, 0x00050005, 0x0000009b, 0x656c6974, 0x65786950, 0x0000006c, 0x00040005,
-    0x0000009c, 0x61726170, 0x0000006d, 0x00040005, 0x0000009e, 0x61726170, 0x0000006d, 0x00040005,
-    0x000000a0, 0x61726170, 0x0000006d, 0x00040005, 0x000000a2, 0x61726170, 0x0000006d, 0x00060005,
-    0x000000a8, 0x6f6c6f43, 0x6c695472, 0x66754265, 0x00726566, 0x00060006, 0x000000a8, 0x00000000,
-    0x6f6c6f43, 0x6c695472, 0x00007365, 0x00030005, 0x000000aa, 0x00000000, 0x00060005, 0x000000b3,
-    0x72747441, 0x656c6954, 0x66667542, 0x00007265, 0x00060006, 0x000000b3, 0x00000000, 0x72747441,
-    0x656c6954, 0x00000073, 0x00030005, 0x000000b5, 0x00000000, 0x00040005, 0x000000bf, 0x65786970,
-    0x0000006c, 0x00040005, 0x000000c5, 0x67726174, 0x00007465, 0x00070005, 0x000000c8, 0x75736552,
-    0x6957746c, 0x72656e6e, 0x66667542, 0x00007265, 0x00070006, 0x000000c8, 0x00000000, 0x75736552,
-    0x6957746c, 0x72656e6e, 0x00000000, 0x00030005, 0x000000ca, 0x00000000, 0x00070005, 0x000000d4,
-    0x6d617246, 0x66756265, 0x53726566, 0x64697274, 0x00000065, 0x00040005, 0x000000e5, 0x72747461,
-    0x00000000, 0x00060005, 0x000000e7, 0x75736552, 0x7542746c, 0x72656666, 0x00000000, 0x00060006,
-    0x000000e7, 0x00000000, 0x75736552, 0x6156746c, 0x0065756c, 0x00030005, 0x000000e9, 0x00000000,
-    0x00070005, 0x000000ed, 0x75736552, 0x6544746c, 0x53687470, 0x74726174, 0x00000000, 0x00060005,
-    0x000000f1, 0x75736552, 0x7441746c, 0x74537274, 0x00747261, 0x00050005, 0x00000101, 0x75746573,
-    0x646e4970, 0x00007865, 0x00080005, 0x00000104, 0x475f6c67, 0x61626f6c, 0x766e496c, 0x7461636f,
-    0x496e6f69, 0x00000044, 0x00040005, 0x00000110, 0x75746573, 0x00000070, 0x00060005, 0x00000113,
-    0x75746553, 0x646e4970, 0x73656369, 0x00000000, 0x00060005, 0x00000118, 0x796c6f70, 0x496e6f67,
-    0x7865646e, 0x00000000, 0x00050005, 0x0000012e, 0x61705358, 0x7465536e, 0x00007075, 0x00040006,
-    0x0000012e, 0x00000000, 0x00003058, 0x00040006, 0x0000012e, 0x00000001, 0x00003158, 0x00060006,
-    0x0000012e, 0x00000002, 0x69736e49, 0x74536564, 0x00747261, 0x00060006, 0x0000012e, 0x00000003,
-    0x69736e49, 0x6e456564, 0x00000064, 0x00060006, 0x0000012e, 0x00000004, 0x65676445, 0x4c766f43,
-    0x00000000, 0x00060006, 0x0000012e, 0x00000005, 0x65676445, 0x52766f43, 0x00000000, 0x00050006,
-    0x0000012e, 0x00000006, 0x63655258, 0x00007069, 0x00050006, 0x0000012e, 0x00000007, 0x67616c46,
-    0x00000073, 0x00040006, 0x0000012e, 0x00000008, 0x0000305a, 0x00040006, 0x0000012e, 0x00000009,
-    0x0000315a, 0x00040006, 0x0000012e, 0x0000000a, 0x00003057, 0x00040006, 0x0000012e, 0x0000000b,
-    0x00003157, 0x00050006, 0x0000012e, 0x0000000c, 0x6f6c6f43, 0x00305272, 0x00050006, 0x0000012e,
-    0x0000000d, 0x6f6c6f43, 0x00304772, 0x00050006, 0x0000012e, 0x0000000e, 0x6f6c6f43, 0x00304272,
-    0x00050006, 0x0000012e, 0x0000000f, 0x6f6c6f43, 0x00315272, 0x00050006, 0x0000012e, 0x00000010,
-    0x6f6c6f43, 0x00314772, 0x00050006, 0x0000012e, 0x00000011, 0x6f6c6f43, 0x00314272, 0x00060006,
-    0x0000012e, 0x00000012, 0x63786554, 0x64726f6f, 0x00003055, 0x00060006, 0x0000012e, 0x00000013,
-    0x63786554, 0x64726f6f, 0x00003056, 0x00060006, 0x0000012e, 0x00000014, 0x63786554, 0x64726f6f,
-    0x00003155, 0x00060006, 0x0000012e, 0x00000015, 0x63786554, 0x64726f6f, 0x00003156, 0x00060006,
-    0x0000012e, 0x00000016, 0x4c766f43, 0x74696e49, 0x006c6169, 0x00060006, 0x0000012e, 0x00000017,
-    0x52766f43, 0x74696e49, 0x006c6169, 0x00040005, 0x00000130, 0x6e617073, 0x00000000, 0x00050005,
-    0x00000131, 0x61705358, 0x7465536e, 0x00007075, 0x00040006, 0x00000131, 0x00000000, 0x00003058,
-    0x00040006, 0x00000131, 0x00000001, 0x00003158, 0x00060006, 0x00000131, 0x00000002, 0x69736e49,
-    0x74536564, 0x00747261, 0x00060006, 0x00000131, 0x00000003, 0x69736e49, 0x6e456564, 0x00000064,
-    0x00060006, 0x00000131, 0x00000004, 0x65676445, 0x4c766f43, 0x00000000, 0x00060006, 0x00000131,
-    0x00000005, 0x65676445, 0x52766f43, 0x00000000, 0x00050006, 0x00000131, 0x00000006, 0x63655258,
-    0x00007069, 0x00050006, 0x00000131, 0x00000007, 0x67616c46, 0x00000073, 0x00040006, 0x00000131,
-    0x00000008, 0x0000305a, 0x00040006, 0x00000131, 0x00000009, 0x0000315a, 0x00040006, 0x00000131,
-    0x0000000a, 0x00003057, 0x00040006, 0x00000131, 0x0000000b, 0x00003157, 0x00050006, 0x00000131,
-    0x0000000c, 0x6f6c6f43, 0x00305272, 0x00050006, 0x00000131, 0x0000000d, 0x6f6c6f43, 0x00304772,
-    0x00050006, 0x00000131, 0x0000000e, 0x6f6c6f43, 0x00304272, 0x00050006, 0x00000131, 0x0000000f,
-    0x6f6c6f43, 0x00315272, 0x00050006, 0x00000131, 0x00000010, 0x6f6c6f43, 0x00314772, 0x00050006,
-    0x00000131, 0x00000011, 0x6f6c6f43, 0x00314272, 0x00060006, 0x00000131, 0x00000012, 0x63786554,
-    0x64726f6f, 0x00003055, 0x00060006, 0x00000131, 0x00000013, 0x63786554, 0x64726f6f, 0x00003056,
-    0x00060006, 0x00000131, 0x00000014, 0x63786554, 0x64726f6f, 0x00003155, 0x00060006, 0x00000131,
-    0x00000015, 0x63786554, 0x64726f6f, 0x00003156, 0x00060006, 0x00000131, 0x00000016, 0x4c766f43,
-    0x74696e49, 0x006c6169, 0x00060006, 0x00000131, 0x00000017, 0x52766f43, 0x74696e49, 0x006c6169,
-    0x00070005, 0x00000133, 0x61705358, 0x7465536e, 0x42737075, 0x65666675, 0x00000072, 0x00060006,
-    0x00000133, 0x00000000, 0x61705358, 0x7465536e, 0x00737075, 0x00030005, 0x00000135, 0x00000000,
-    0x00030005, 0x0000017e, 0x00000079, 0x00030005, 0x00000188, 0x00000078, 0x00050005, 0x0000018c,
-    0x65726373, 0x6e456e65, 0x00000064, 0x00040005, 0x0000018d, 0x7466656c, 0x00646e45, 0x00040005,
-    0x0000019a, 0x766f6378, 0x00000000, 0x00040005, 0x000001a7, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001a9, 0x61726170, 0x0000006d, 0x00040005, 0x000001aa, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001b7, 0x61726170, 0x0000006d, 0x00040005, 0x000001b9, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001ba, 0x61726170, 0x0000006d, 0x00040005, 0x000001bc, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001ca, 0x79646f62, 0x00646e45, 0x00050005, 0x000001d5, 0x68676972, 0x646e4574, 0x00000000,
-    0x00040005, 0x000001df, 0x766f6378, 0x00000000, 0x00040005, 0x000001ec, 0x61726170, 0x0000006d,
-    0x00040005, 0x000001ee, 0x61726170, 0x0000006d, 0x00040005, 0x000001ef, 0x61726170, 0x0000006d,
-    0x00040005, 0x000001fe, 0x61726170, 0x0000006d, 0x00040005, 0x00000200, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000201, 0x61726170, 0x0000006d, 0x00040005, 0x00000203, 0x61726170, 0x0000006d,
-    0x00050005, 0x00000212, 0x6174654d, 0x66696e55, 0x006d726f, 0x00060006, 0x00000212, 0x00000000,
-    0x506d754e, 0x67796c6f, 0x00736e6f, 0x00060006, 0x00000212, 0x00000001, 0x566d754e, 0x61697261,
-    0x0073746e, 0x00060006, 0x00000212, 0x00000002, 0x68706c41, 0x66655261, 0x00000000, 0x00050006,
-    0x00000212, 0x00000003, 0x70736944, 0x00746e43, 0x00060006, 0x00000212, 0x00000004, 0x6e6f6f54,
-    0x6c626154, 0x00000065, 0x00060006, 0x00000212, 0x00000005, 0x61656c43, 0x6c6f4372, 0x0000726f,
-    0x00060006, 0x00000212, 0x00000006, 0x61656c43, 0x70654472, 0x00006874, 0x00060006, 0x00000212,
-    0x00000007, 0x61656c43, 0x74744172, 0x00000072, 0x00060006, 0x00000212, 0x00000008, 0x4f676f46,
-    0x65736666, 0x00000074, 0x00060006, 0x00000212, 0x00000009, 0x53676f46, 0x74666968, 0x00000000,
-    0x00060006, 0x00000212, 0x0000000a, 0x43676f46, 0x726f6c6f, 0x00000000, 0x00080006, 0x00000212,
-    0x0000000b, 0x61656c43, 0x74694272, 0x4f70616d, 0x65736666, 0x00000074, 0x00030005, 0x00000214,
-    0x00000000, 0x00060005, 0x00000218, 0x74706544, 0x6c695468, 0x66754265, 0x00726566, 0x00060006,
-    0x00000218, 0x00000000, 0x74706544, 0x6c695468, 0x00007365, 0x00030005, 0x0000021a, 0x00000000,
-    0x00040047, 0x00000028, 0x00000001, 0x00000000, 0x00050048, 0x00000031, 0x00000000, 0x00000023,
-    0x00000000, 0x00050048, 0x00000031, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x00000031,
-    0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x00000031, 0x00000003, 0x00000023, 0x0000000c,
-    0x00050048, 0x00000031, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x00000031, 0x00000005,
-    0x00000023, 0x00000014, 0x00050048, 0x00000031, 0x00000006, 0x00000023, 0x00000018, 0x00050048,
-    0x00000031, 0x00000007, 0x00000023, 0x0000001c, 0x00030047, 0x00000031, 0x00000002, 0x00040047,
-    0x0000004a, 0x00000006, 0x00000010, 0x00040047, 0x0000004b, 0x00000006, 0x00000004, 0x00040047,
-    0x0000004c, 0x00000006, 0x00000004, 0x00040047, 0x0000004d, 0x00000006, 0x00000004, 0x00050048,
-    0x0000004e, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x0000004e, 0x00000001, 0x00000023,
-    0x00008000, 0x00050048, 0x0000004e, 0x00000002, 0x00000023, 0x0000a000, 0x00050048, 0x0000004e,
-    0x00000003, 0x00000023, 0x0000c000, 0x00050048, 0x0000004e, 0x00000004, 0x00000023, 0x0000c010,
-    0x00030047, 0x0000004e, 0x00000002, 0x00040047, 0x00000050, 0x00000022, 0x00000000, 0x00040047,
-    0x00000050, 0x00000021, 0x00000008, 0x00040047, 0x00000052, 0x00000001, 0x00000001, 0x00040047,
-    0x00000086, 0x00000001, 0x00000002, 0x00040047, 0x000000a7, 0x00000006, 0x00000004, 0x00050048,
-    0x000000a8, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x000000a8, 0x00000002, 0x00040047,
-    0x000000aa, 0x00000022, 0x00000000, 0x00040047, 0x000000aa, 0x00000021, 0x00000004, 0x00040047,
-    0x000000b2, 0x00000006, 0x00000004, 0x00050048, 0x000000b3, 0x00000000, 0x00000023, 0x00000000,
-    0x00030047, 0x000000b3, 0x00000002, 0x00040047, 0x000000b5, 0x00000022, 0x00000000, 0x00040047,
-    0x000000b5, 0x00000021, 0x00000006, 0x00040047, 0x000000c7, 0x00000006, 0x00000004, 0x00050048,
-    0x000000c8, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x000000c8, 0x00000002, 0x00040047,
-    0x000000ca, 0x00000022, 0x00000000, 0x00040047, 0x000000ca, 0x00000021, 0x00000010, 0x00040047,
-    0x000000e6, 0x00000006, 0x00000004, 0x00050048, 0x000000e7, 0x00000000, 0x00000023, 0x00000000,
-    0x00030047, 0x000000e7, 0x00000002, 0x00040047, 0x000000e9, 0x00000022, 0x00000000, 0x00040047,
-    0x000000e9, 0x00000021, 0x00000007, 0x00040047, 0x00000104, 0x0000000b, 0x0000001c, 0x00040047,
-    0x00000113, 0x00000022, 0x00000000, 0x00040047, 0x00000113, 0x00000021, 0x0000000a, 0x00050048,
-    0x00000131, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000131, 0x00000001, 0x00000023,
-    0x00000004, 0x00050048, 0x00000131, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x00000131,
-    0x00000003, 0x00000023, 0x0000000c, 0x00050048, 0x00000131, 0x00000004, 0x00000023, 0x00000010,
-    0x00050048, 0x00000131, 0x00000005, 0x00000023, 0x00000014, 0x00050048, 0x00000131, 0x00000006,
-    0x00000023, 0x00000018, 0x00050048, 0x00000131, 0x00000007, 0x00000023, 0x0000001c, 0x00050048,
-    0x00000131, 0x00000008, 0x00000023, 0x00000020, 0x00050048, 0x00000131, 0x00000009, 0x00000023,
-    0x00000024, 0x00050048, 0x00000131, 0x0000000a, 0x00000023, 0x00000028, 0x00050048, 0x00000131,
-    0x0000000b, 0x00000023, 0x0000002c, 0x00050048, 0x00000131, 0x0000000c, 0x00000023, 0x00000030,
-    0x00050048, 0x00000131, 0x0000000d, 0x00000023, 0x00000034, 0x00050048, 0x00000131, 0x0000000e,
-    0x00000023, 0x00000038, 0x00050048, 0x00000131, 0x0000000f, 0x00000023, 0x0000003c, 0x00050048,
-    0x00000131, 0x00000010, 0x00000023, 0x00000040, 0x00050048, 0x00000131, 0x00000011, 0x00000023,
-    0x00000044, 0x00050048, 0x00000131, 0x00000012, 0x00000023, 0x00000048, 0x00050048, 0x00000131,
-    0x00000013, 0x00000023, 0x0000004c, 0x00050048, 0x00000131, 0x00000014, 0x00000023, 0x00000050,
-    0x00050048, 0x00000131, 0x00000015, 0x00000023, 0x00000054, 0x00050048, 0x00000131, 0x00000016,
-    0x00000023, 0x00000058, 0x00050048, 0x00000131, 0x00000017, 0x00000023, 0x0000005c, 0x00040047,
-    0x00000132, 0x00000006, 0x00000060, 0x00050048, 0x00000133, 0x00000000, 0x00000023, 0x00000000,
-    0x00030047, 0x00000133, 0x00000002, 0x00040047, 0x00000135, 0x00000022, 0x00000000, 0x00040047,
-    0x00000135, 0x00000021, 0x00000002, 0x00040047, 0x0000020f, 0x00000006, 0x00000010, 0x00050048,
-    0x00000212, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000212, 0x00000001, 0x00000023,
-    0x00000004, 0x00050048, 0x00000212, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x00000212,
-    0x00000003, 0x00000023, 0x0000000c, 0x00050048, 0x00000212, 0x00000004, 0x00000023, 0x00000010,
-    0x00050048, 0x00000212, 0x00000005, 0x00000023, 0x00000230, 0x00050048, 0x00000212, 0x00000006,
-    0x00000023, 0x00000234, 0x00050048, 0x00000212, 0x00000007, 0x00000023, 0x00000238, 0x00050048,
-    0x00000212, 0x00000008, 0x00000023, 0x0000023c, 0x00050048, 0x00000212, 0x00000009, 0x00000023,
-    0x00000240, 0x00050048, 0x00000212, 0x0000000a, 0x00000023, 0x00000244, 0x00050048, 0x00000212,
-    0x0000000b, 0x00000023, 0x00000248, 0x00030047, 0x00000212, 0x00000002, 0x00040047, 0x00000214,
-    0x00000022, 0x00000000, 0x00040047, 0x00000214, 0x00000021, 0x00000000, 0x00040047, 0x00000217,
-    0x00000006, 0x00000004, 0x00050048, 0x00000218, 0x00000000, 0x00000023, 0x00000000, 0x00030047,
-    0x00000218, 0x00000002, 0x00040047, 0x0000021a, 0x00000022, 0x00000000, 0x00040047, 0x0000021a,
-    0x00000021, 0x00000005, 0x00040047, 0x0000021c, 0x0000000b, 0x00000019, 0x00020013, 0x00000002,
-    0x00030021, 0x00000003, 0x00000002, 0x00040015, 0x00000006, 0x00000020, 0x00000000, 0x00040020,
-    0x00000007, 0x00000007, 0x00000006, 0x00020014, 0x00000008, 0x00070021, 0x00000009, 0x00000008,
-    0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00060021, 0x00000010, 0x00000008, 0x00000007,
-    0x00000007, 0x00000007, 0x00070021, 0x00000016, 0x00000002, 0x00000007, 0x00000007, 0x00000007,
-    0x00000007, 0x0004002b, 0x00000006, 0x0000001f, 0x00000010, 0x00040015, 0x00000027, 0x00000020,
-    0x00000001, 0x00040032, 0x00000027, 0x00000028, 0x00000100, 0x0004002b, 0x00000027, 0x00000029,
-    0x00000010, 0x00060034, 0x00000027, 0x0000002a, 0x00000087, 0x00000028, 0x00000029, 0x0004002b,
-    0x00000006, 0x0000002b, 0x00000000, 0x00060034, 0x00000006, 0x0000002c, 0x00000080, 0x0000002a,
-    0x0000002b, 0x000a001e, 0x00000031, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000027, 0x00000006, 0x00040020, 0x00000032, 0x00000009, 0x00000031, 0x0004003b,
-    0x00000032, 0x00000033, 0x00000009, 0x0004002b, 0x00000027, 0x00000034, 0x00000000, 0x00040020,
-    0x00000035, 0x00000009, 0x00000006, 0x0004002b, 0x00000006, 0x0000003b, 0x00000005, 0x0004002b,
-    0x00000006, 0x0000003f, 0x0000001f, 0x0004002b, 0x00000006, 0x00000043, 0x00000040, 0x00040017,
-    0x00000048, 0x00000006, 0x00000004, 0x0004002b, 0x00000006, 0x00000049, 0x00000800, 0x0004001c,
-    0x0000004a, 0x00000048, 0x00000049, 0x0004001c, 0x0000004b, 0x00000006, 0x00000049, 0x0004001c,
-    0x0000004c, 0x00000006, 0x00000049, 0x0003001d, 0x0000004d, 0x00000006, 0x0007001e, 0x0000004e,
-    0x0000004a, 0x0000004b, 0x0000004c, 0x00000048, 0x0000004d, 0x00040020, 0x0000004f, 0x0000000c,
-    0x0000004e, 0x0004003b, 0x0000004f, 0x00000050, 0x0000000c, 0x0004002b, 0x00000027, 0x00000051,
-    0x00000004, 0x00040032, 0x00000027, 0x00000052, 0x000000c0, 0x00060034, 0x00000027, 0x00000053,
-    0x00000087, 0x00000052, 0x00000029, 0x00060034, 0x00000027, 0x00000054, 0x00000084, 0x0000002a,
-    0x00000053, 0x0004002b, 0x00000027, 0x00000055, 0x00000002, 0x00060034, 0x00000027, 0x00000056,
-    0x00000084, 0x00000054, 0x00000055, 0x00060034, 0x00000027, 0x00000057, 0x00000080, 0x00000034,
-    0x00000056, 0x00040020, 0x0000005b, 0x0000000c, 0x00000006, 0x0004002b, 0x00000006, 0x0000005f,
-    0x00000001, 0x0003002a, 0x00000008, 0x00000066, 0x00060034, 0x00000027, 0x0000007a, 0x00000084,
-    0x0000002a, 0x00000053, 0x0004002b, 0x00000027, 0x0000007b, 0x00000040, 0x00060034, 0x00000027,
-    0x0000007c, 0x00000084, 0x0000007a, 0x0000007b, 0x00060034, 0x00000027, 0x0000007d, 0x00000080,
-    0x00000057, 0x0000007c, 0x00040032, 0x00000027, 0x00000086, 0x00003000, 0x00060034, 0x00000006,
-    0x00000087, 0x00000080, 0x00000086, 0x0000002b, 0x0004002b, 0x00000006, 0x00000094, 0x00000100,
-    0x00030029, 0x00000008, 0x00000098, 0x0003001d, 0x000000a7, 0x00000006, 0x0003001e, 0x000000a8,
-    0x000000a7, 0x00040020, 0x000000a9, 0x0000000c, 0x000000a8, 0x0004003b, 0x000000a9, 0x000000aa,
-    0x0000000c, 0x0003001d, 0x000000b2, 0x00000006, 0x0003001e, 0x000000b3, 0x000000b2, 0x00040020,
-    0x000000b4, 0x0000000c, 0x000000b3, 0x0004003b, 0x000000b4, 0x000000b5, 0x0000000c, 0x0004002b,
-    0x00000006, 0x000000b9, 0x80000000, 0x00060034, 0x00000006, 0x000000c1, 0x00000080, 0x00000028,
-    0x0000002b, 0x0004002b, 0x00000006, 0x000000c6, 0xffffffff, 0x0003001d, 0x000000c7, 0x00000006,
-    0x0003001e, 0x000000c8, 0x000000c7, 0x00040020, 0x000000c9, 0x0000000c, 0x000000c8, 0x0004003b,
-    0x000000c9, 0x000000ca, 0x0000000c, 0x00060034, 0x00000027, 0x000000d4, 0x00000084, 0x00000028,
-    0x00000052, 0x00060034, 0x00000006, 0x000000d5, 0x00000080, 0x000000d4, 0x0000002b, 0x00060034,
-    0x00000006, 0x000000de, 0x00000080, 0x000000d4, 0x0000002b, 0x0003001d, 0x000000e6, 0x00000006,
-    0x0003001e, 0x000000e7, 0x000000e6, 0x00040020, 0x000000e8, 0x0000000c, 0x000000e7, 0x0004003b,
-    0x000000e8, 0x000000e9, 0x0000000c, 0x00060034, 0x00000027, 0x000000ea, 0x00000084, 0x00000028,
-    0x00000052, 0x00060034, 0x00000027, 0x000000eb, 0x00000084, 0x000000ea, 0x00000055, 0x00060034,
-    0x00000006, 0x000000ec, 0x00000080, 0x000000eb, 0x0000002b, 0x00060034, 0x00000006, 0x000000ed,
-    0x00000080, 0x0000002b, 0x000000ec, 0x00060034, 0x00000027, 0x000000ee, 0x00000084, 0x00000028,
-    0x00000052, 0x00060034, 0x00000027, 0x000000ef, 0x00000084, 0x000000ee, 0x00000055, 0x00060034,
-    0x00000006, 0x000000f0, 0x00000080, 0x000000ef, 0x0000002b, 0x00060034, 0x00000006, 0x000000f1,
-    0x00000080, 0x000000ed, 0x000000f0, 0x0004002b, 0x00000006, 0x000000f9, 0xffffe0ff, 0x0004002b,
-    0x00000006, 0x000000fd, 0x00000008, 0x00040017, 0x00000102, 0x00000006, 0x00000003, 0x00040020,
-    0x00000103, 0x00000001, 0x00000102, 0x0004003b, 0x00000103, 0x00000104, 0x00000001, 0x00040020,
-    0x00000105, 0x00000001, 0x00000006, 0x00040020, 0x0000010f, 0x00000007, 0x00000048, 0x00090019,
-    0x00000111, 0x00000006, 0x00000005, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000,
-    0x00040020, 0x00000112, 0x00000000, 0x00000111, 0x0004003b, 0x00000112, 0x00000113, 0x00000000,
-    0x0004002b, 0x00000027, 0x00000125, 0x00000001, 0x001a001e, 0x0000012e, 0x00000027, 0x00000027,
-    0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000006, 0x00000027, 0x00000027,
-    0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000027,
-    0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00040020, 0x0000012f,
-    0x00000007, 0x0000012e, 0x001a001e, 0x00000131, 0x00000027, 0x00000027, 0x00000027, 0x00000027,
-    0x00000027, 0x00000027, 0x00000027, 0x00000006, 0x00000027, 0x00000027, 0x00000027, 0x00000027,
-    0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000027,
-    0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x0003001d, 0x00000132, 0x00000131, 0x0003001e,
-    0x00000133, 0x00000132, 0x00040020, 0x00000134, 0x0000000c, 0x00000133, 0x0004003b, 0x00000134,
-    0x00000135, 0x0000000c, 0x00040020, 0x00000137, 0x0000000c, 0x00000131, 0x00040020, 0x0000013b,
-    0x00000007, 0x00000027, 0x0004002b, 0x00000027, 0x00000142, 0x00000003, 0x0004002b, 0x00000027,
-    0x00000147, 0x00000005, 0x0004002b, 0x00000027, 0x0000014a, 0x00000006, 0x0004002b, 0x00000027,
-    0x0000014d, 0x00000007, 0x0004002b, 0x00000027, 0x00000150, 0x00000008, 0x0004002b, 0x00000027,
-    0x00000153, 0x00000009, 0x0004002b, 0x00000027, 0x00000156, 0x0000000a, 0x0004002b, 0x00000027,
-    0x00000159, 0x0000000b, 0x0004002b, 0x00000027, 0x0000015c, 0x0000000c, 0x0004002b, 0x00000027,
-    0x0000015f, 0x0000000d, 0x0004002b, 0x00000027, 0x00000162, 0x0000000e, 0x0004002b, 0x00000027,
-    0x00000165, 0x0000000f, 0x0004002b, 0x00000027, 0x0000016a, 0x00000011, 0x0004002b, 0x00000027,
-    0x0000016d, 0x00000012, 0x0004002b, 0x00000027, 0x00000170, 0x00000013, 0x0004002b, 0x00000027,
-    0x00000173, 0x00000014, 0x0004002b, 0x00000027, 0x00000176, 0x00000015, 0x0004002b, 0x00000027,
-    0x00000179, 0x00000016, 0x0004002b, 0x00000027, 0x0000017c, 0x00000017, 0x0004002b, 0x00000006,
-    0x0000017f, 0x00000003, 0x00060034, 0x00000006, 0x00000183, 0x00000080, 0x00000052, 0x0000002b,
-    0x0004002b, 0x00000027, 0x000001c0, 0x000003ff, 0x0004002b, 0x00000027, 0x000001f8, 0x0000001f,
-    0x0004002b, 0x00000027, 0x0000020c, 0x00000080, 0x0004002b, 0x00000027, 0x0000020d, 0x00000800,
-    0x0004002b, 0x00000006, 0x0000020e, 0x00000022, 0x0004001c, 0x0000020f, 0x00000048, 0x0000020e,
-    0x00030016, 0x00000210, 0x00000020, 0x00040017, 0x00000211, 0x00000210, 0x00000002, 0x000e001e,
-    0x00000212, 0x00000006, 0x00000006, 0x00000027, 0x00000006, 0x0000020f, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000211, 0x00040020, 0x00000213, 0x00000002,
-    0x00000212, 0x0004003b, 0x00000213, 0x00000214, 0x00000002, 0x0004002b, 0x00000006, 0x00000215,
-    0x00000002, 0x0004002b, 0x00000006, 0x00000216, 0x00000004, 0x0003001d, 0x00000217, 0x00000006,
-    0x0003001e, 0x00000218, 0x00000217, 0x00040020, 0x00000219, 0x0000000c, 0x00000218, 0x0004003b,
-    0x00000219, 0x0000021a, 0x0000000c, 0x0004002b, 0x00000006, 0x0000021b, 0x00008000, 0x0006002c,
-    0x00000102, 0x0000021c, 0x00000043, 0x0000005f, 0x0000005f, 0x00050036, 0x00000002, 0x00000004,
-    0x00000000, 0x00000003, 0x000200f8, 0x00000005, 0x0004003b, 0x00000007, 0x00000101, 0x00000007,
-    0x0004003b, 0x0000010f, 0x00000110, 0x00000007, 0x0004003b, 0x00000007, 0x00000118, 0x00000007,
-    0x0004003b, 0x0000012f, 0x00000130, 0x00000007, 0x0004003b, 0x00000007, 0x0000017e, 0x00000007,
-    0x0004003b, 0x0000013b, 0x00000188, 0x00000007, 0x0004003b, 0x0000013b, 0x0000018c, 0x00000007,
-    0x0004003b, 0x0000013b, 0x0000018d, 0x00000007, 0x0004003b, 0x0000013b, 0x0000019a, 0x00000007,
-    0x0004003b, 0x00000007, 0x000001a7, 0x00000007, 0x0004003b, 0x00000007, 0x000001a9, 0x00000007,
-    0x0004003b, 0x00000007, 0x000001aa, 0x00000007, 0x0004003b, 0x00000007, 0x000001b7, 0x00000007,
-    0x0004003b, 0x00000007, 0x000001b9, 0x00000007, 0x0004003b, 0x00000007, 0x000001ba, 0x00000007,
-    0x0004003b, 0x00000007, 0x000001bc, 0x00000007, 0x0004003b, 0x0000013b, 0x000001ca, 0x00000007,
-    0x0004003b, 0x0000013b, 0x000001d5, 0x00000007, 0x0004003b, 0x0000013b, 0x000001df, 0x00000007,
-    0x0004003b, 0x00000007, 0x000001ec, 0x00000007, 0x0004003b, 0x00000007, 0x000001ee, 0x00000007,
-    0x0004003b, 0x00000007, 0x000001ef, 0x00000007, 0x0004003b, 0x00000007, 0x000001fe, 0x00000007,
-    0x0004003b, 0x00000007, 0x00000200, 0x00000007, 0x0004003b, 0x00000007, 0x00000201, 0x00000007,
-    0x0004003b, 0x00000007, 0x00000203, 0x00000007, 0x00050041, 0x00000105, 0x00000106, 0x00000104,
-    0x0000002b, 0x0004003d, 0x00000006, 0x00000107, 0x00000106, 0x0003003e, 0x00000101, 0x00000107,
-    0x0004003d, 0x00000006, 0x00000108, 0x00000101, 0x00050041, 0x00000035, 0x00000109, 0x00000033,
-    0x00000055, 0x0004003d, 0x00000006, 0x0000010a, 0x00000109, 0x000500ae, 0x00000008, 0x0000010b,
-    0x00000108, 0x0000010a, 0x000300f7, 0x0000010d, 0x00000000, 0x000400fa, 0x0000010b, 0x0000010c,
-    0x0000010d, 0x000200f8, 0x0000010c, 0x000100fd, 0x000200f8, 0x0000010d, 0x0004003d, 0x00000111,
-    0x00000114, 0x00000113, 0x0004003d, 0x00000006, 0x00000115, 0x00000101, 0x0004007c, 0x00000027,
-    0x00000116, 0x00000115, 0x0005005f, 0x00000048, 0x00000117, 0x00000114, 0x00000116, 0x0003003e,
-    0x00000110, 0x00000117, 0x00050041, 0x00000007, 0x00000119, 0x00000110, 0x0000002b, 0x0004003d,
-    0x00000006, 0x0000011a, 0x00000119, 0x0003003e, 0x00000118, 0x0000011a, 0x0004003d, 0x00000006,
-    0x0000011b, 0x00000118, 0x00050041, 0x00000035, 0x0000011c, 0x00000033, 0x00000034, 0x0004003d,
-    0x00000006, 0x0000011d, 0x0000011c, 0x000500b0, 0x00000008, 0x0000011e, 0x0000011b, 0x0000011d,
-    0x000400a8, 0x00000008, 0x0000011f, 0x0000011e, 0x000300f7, 0x00000121, 0x00000000, 0x000400fa,
-    0x0000011f, 0x00000120, 0x00000121, 0x000200f8, 0x00000120, 0x0004003d, 0x00000006, 0x00000122,
-    0x00000118, 0x00050041, 0x00000035, 0x00000123, 0x00000033, 0x00000034, 0x0004003d, 0x00000006,
-    0x00000124, 0x00000123, 0x00050041, 0x00000035, 0x00000126, 0x00000033, 0x00000125, 0x0004003d,
-    0x00000006, 0x00000127, 0x00000126, 0x00050080, 0x00000006, 0x00000128, 0x00000124, 0x00000127,
-    0x000500ae, 0x00000008, 0x00000129, 0x00000122, 0x00000128, 0x000200f9, 0x00000121, 0x000200f8,
-    0x00000121, 0x000700f5, 0x00000008, 0x0000012a, 0x0000011e, 0x0000010d, 0x00000129, 0x00000120,
-    0x000300f7, 0x0000012c, 0x00000000, 0x000400fa, 0x0000012a, 0x0000012b, 0x0000012c, 0x000200f8,
-    0x0000012b, 0x000100fd, 0x000200f8, 0x0000012c, 0x0004003d, 0x00000006, 0x00000136, 0x00000101,
-    0x00060041, 0x00000137, 0x00000138, 0x00000135, 0x00000034, 0x00000136, 0x0004003d, 0x00000131,
-    0x00000139, 0x00000138, 0x00050051, 0x00000027, 0x0000013a, 0x00000139, 0x00000000, 0x00050041,
-    0x0000013b, 0x0000013c, 0x00000130, 0x00000034, 0x0003003e, 0x0000013c, 0x0000013a, 0x00050051,
-    0x00000027, 0x0000013d, 0x00000139, 0x00000001, 0x00050041, 0x0000013b, 0x0000013e, 0x00000130,
-    0x00000125, 0x0003003e, 0x0000013e, 0x0000013d, 0x00050051, 0x00000027, 0x0000013f, 0x00000139,
-    0x00000002, 0x00050041, 0x0000013b, 0x00000140, 0x00000130, 0x00000055, 0x0003003e, 0x00000140,
-    0x0000013f, 0x00050051, 0x00000027, 0x00000141, 0x00000139, 0x00000003, 0x00050041, 0x0000013b,
-    0x00000143, 0x00000130, 0x00000142, 0x0003003e, 0x00000143, 0x00000141, 0x00050051, 0x00000027,
-    0x00000144, 0x00000139, 0x00000004, 0x00050041, 0x0000013b, 0x00000145, 0x00000130, 0x00000051,
-    0x0003003e, 0x00000145, 0x00000144, 0x00050051, 0x00000027, 0x00000146, 0x00000139, 0x00000005,
-    0x00050041, 0x0000013b, 0x00000148, 0x00000130, 0x00000147, 0x0003003e, 0x00000148, 0x00000146,
-    0x00050051, 0x00000027, 0x00000149, 0x00000139, 0x00000006, 0x00050041, 0x0000013b, 0x0000014b,
-    0x00000130, 0x0000014a, 0x0003003e, 0x0000014b, 0x00000149, 0x00050051, 0x00000006, 0x0000014c,
-    0x00000139, 0x00000007, 0x00050041, 0x00000007, 0x0000014e, 0x00000130, 0x0000014d, 0x0003003e,
-    0x0000014e, 0x0000014c, 0x00050051, 0x00000027, 0x0000014f, 0x00000139, 0x00000008, 0x00050041,
-    0x0000013b, 0x00000151, 0x00000130, 0x00000150, 0x0003003e, 0x00000151, 0x0000014f, 0x00050051,
-    0x00000027, 0x00000152, 0x00000139, 0x00000009, 0x00050041, 0x0000013b, 0x00000154, 0x00000130,
-    0x00000153, 0x0003003e, 0x00000154, 0x00000152, 0x00050051, 0x00000027, 0x00000155, 0x00000139,
-    0x0000000a, 0x00050041, 0x0000013b, 0x00000157, 0x00000130, 0x00000156, 0x0003003e, 0x00000157,
-    0x00000155, 0x00050051, 0x00000027, 0x00000158, 0x00000139, 0x0000000b, 0x00050041, 0x0000013b,
-    0x0000015a, 0x00000130, 0x00000159, 0x0003003e, 0x0000015a, 0x00000158, 0x00050051, 0x00000027,
-    0x0000015b, 0x00000139, 0x0000000c, 0x00050041, 0x0000013b, 0x0000015d, 0x00000130, 0x0000015c,
-    0x0003003e, 0x0000015d, 0x0000015b, 0x00050051, 0x00000027, 0x0000015e, 0x00000139, 0x0000000d,
-    0x00050041, 0x0000013b, 0x00000160, 0x00000130, 0x0000015f, 0x0003003e, 0x00000160, 0x0000015e,
-    0x00050051, 0x00000027, 0x00000161, 0x00000139, 0x0000000e, 0x00050041, 0x0000013b, 0x00000163,
-    0x00000130, 0x00000162, 0x0003003e, 0x00000163, 0x00000161, 0x00050051, 0x00000027, 0x00000164,
-    0x00000139, 0x0000000f, 0x00050041, 0x0000013b, 0x00000166, 0x00000130, 0x00000165, 0x0003003e,
-    0x00000166, 0x00000164, 0x00050051, 0x00000027, 0x00000167, 0x00000139, 0x00000010, 0x00050041,
-    0x0000013b, 0x00000168, 0x00000130, 0x00000029, 0x0003003e, 0x00000168, 0x00000167, 0x00050051,
-    0x00000027, 0x00000169, 0x00000139, 0x00000011, 0x00050041, 0x0000013b, 0x0000016b, 0x00000130,
-    0x0000016a, 0x0003003e, 0x0000016b, 0x00000169, 0x00050051, 0x00000027, 0x0000016c, 0x00000139,
-    0x00000012, 0x00050041, 0x0000013b, 0x0000016e, 0x00000130, 0x0000016d, 0x0003003e, 0x0000016e,
-    0x0000016c, 0x00050051, 0x00000027, 0x0000016f, 0x00000139, 0x00000013, 0x00050041, 0x0000013b,
-    0x00000171, 0x00000130, 0x00000170, 0x0003003e, 0x00000171, 0x0000016f, 0x00050051, 0x00000027,
-    0x00000172, 0x00000139, 0x00000014, 0x00050041, 0x0000013b, 0x00000174, 0x00000130, 0x00000173,
-    0x0003003e, 0x00000174, 0x00000172, 0x00050051, 0x00000027, 0x00000175, 0x00000139, 0x00000015,
-    0x00050041, 0x0000013b, 0x00000177, 0x00000130, 0x00000176, 0x0003003e, 0x00000177, 0x00000175,
-    0x00050051, 0x00000027, 0x00000178, 0x00000139, 0x00000016, 0x00050041, 0x0000013b, 0x0000017a,
-    0x00000130, 0x00000179, 0x0003003e, 0x0000017a, 0x00000178, 0x00050051, 0x00000027, 0x0000017b,
-    0x00000139, 0x00000017, 0x00050041, 0x0000013b, 0x0000017d, 0x00000130, 0x0000017c, 0x0003003e,
-    0x0000017d, 0x0000017b, 0x00050041, 0x00000007, 0x00000180, 0x00000110, 0x0000017f, 0x0004003d,
-    0x00000006, 0x00000181, 0x00000180, 0x0003003e, 0x0000017e, 0x00000181, 0x0004003d, 0x00000006,
-    0x00000182, 0x0000017e, 0x000500ae, 0x00000008, 0x00000184, 0x00000182, 0x00000183, 0x000300f7,
-    0x00000186, 0x00000000, 0x000400fa, 0x00000184, 0x00000185, 0x00000186, 0x000200f8, 0x00000185,
-    0x000100fd, 0x000200f8, 0x00000186, 0x00050041, 0x0000013b, 0x00000189, 0x00000130, 0x00000034,
-    0x0004003d, 0x00000027, 0x0000018a, 0x00000189, 0x0007000c, 0x00000027, 0x0000018b, 0x00000001,
-    0x0000002a, 0x0000018a, 0x00000034, 0x0003003e, 0x00000188, 0x0000018b, 0x0003003e, 0x0000018c,
-    0x00000028, 0x00050041, 0x0000013b, 0x0000018e, 0x00000130, 0x00000055, 0x0004003d, 0x00000027,
-    0x0000018f, 0x0000018e, 0x00050041, 0x0000013b, 0x00000190, 0x00000130, 0x00000125, 0x0004003d,
-    0x00000027, 0x00000191, 0x00000190, 0x0007000c, 0x00000027, 0x00000192, 0x00000001, 0x00000027,
-    0x0000018f, 0x00000191, 0x0004003d, 0x00000027, 0x00000193, 0x0000018c, 0x0007000c, 0x00000027,
-    0x00000194, 0x00000001, 0x00000027, 0x00000192, 0x00000193, 0x0003003e, 0x0000018d, 0x00000194,
-    0x00050041, 0x0000013b, 0x00000195, 0x00000130, 0x00000051, 0x0004003d, 0x00000027, 0x00000196,
-    0x00000195, 0x000500b1, 0x00000008, 0x00000197, 0x00000196, 0x00000034, 0x000300f7, 0x00000199,
-    0x00000000, 0x000400fa, 0x00000197, 0x00000198, 0x000001c6, 0x000200f8, 0x00000198, 0x00050041,
-    0x0000013b, 0x0000019b, 0x00000130, 0x00000179, 0x0004003d, 0x00000027, 0x0000019c, 0x0000019b,
-    0x0003003e, 0x0000019a, 0x0000019c, 0x000200f9, 0x0000019d, 0x000200f8, 0x0000019d, 0x000400f6,
-    0x0000019f, 0x000001a0, 0x00000000, 0x000200f9, 0x000001a1, 0x000200f8, 0x000001a1, 0x0004003d,
-    0x00000027, 0x000001a2, 0x00000188, 0x0004003d, 0x00000027, 0x000001a3, 0x0000018d, 0x000500b1,
-    0x00000008, 0x000001a4, 0x000001a2, 0x000001a3, 0x000400fa, 0x000001a4, 0x0000019e, 0x0000019f,
-    0x000200f8, 0x0000019e, 0x0004003d, 0x00000027, 0x000001a5, 0x00000188, 0x0004007c, 0x00000006,
-    0x000001a6, 0x000001a5, 0x0004003d, 0x00000006, 0x000001a8, 0x00000118, 0x0003003e, 0x000001a7,
-    0x000001a8, 0x0003003e, 0x000001a9, 0x000001a6, 0x0004003d, 0x00000006, 0x000001ab, 0x0000017e,
-    0x0003003e, 0x000001aa, 0x000001ab, 0x00070039, 0x00000008, 0x000001ac, 0x00000014, 0x000001a7,
-    0x000001a9, 0x000001aa, 0x000400a8, 0x00000008, 0x000001ad, 0x000001ac, 0x000300f7, 0x000001af,
-    0x00000000, 0x000400fa, 0x000001ad, 0x000001ae, 0x000001af, 0x000200f8, 0x000001ae, 0x000200f9,
-    0x000001a0, 0x000200f8, 0x000001af, 0x0004003d, 0x00000027, 0x000001b1, 0x00000188, 0x0004007c,
-    0x00000006, 0x000001b2, 0x000001b1, 0x0004003d, 0x00000027, 0x000001b3, 0x0000019a, 0x000500c3,
-    0x00000027, 0x000001b4, 0x000001b3, 0x00000147, 0x0004007c, 0x00000006, 0x000001b5, 0x000001b4,
-    0x0007000c, 0x00000006, 0x000001b6, 0x00000001, 0x00000026, 0x000001b5, 0x0000003f, 0x0004003d,
-    0x00000006, 0x000001b8, 0x00000118, 0x0003003e, 0x000001b7, 0x000001b8, 0x0003003e, 0x000001b9,
-    0x000001b2, 0x0004003d, 0x00000006, 0x000001bb, 0x0000017e, 0x0003003e, 0x000001ba, 0x000001bb,
-    0x0003003e, 0x000001bc, 0x000001b6, 0x00080039, 0x00000002, 0x000001bd, 0x0000001b, 0x000001b7,
-    0x000001b9, 0x000001ba, 0x000001bc, 0x00050041, 0x0000013b, 0x000001be, 0x00000130, 0x00000051,
-    0x0004003d, 0x00000027, 0x000001bf, 0x000001be, 0x000500c7, 0x00000027, 0x000001c1, 0x000001bf,
-    0x000001c0, 0x0004003d, 0x00000027, 0x000001c2, 0x0000019a, 0x00050080, 0x00000027, 0x000001c3,
-    0x000001c2, 0x000001c1, 0x0003003e, 0x0000019a, 0x000001c3, 0x000200f9, 0x000001a0, 0x000200f8,
-    0x000001a0, 0x0004003d, 0x00000027, 0x000001c4, 0x00000188, 0x00050080, 0x00000027, 0x000001c5,
-    0x000001c4, 0x00000125, 0x0003003e, 0x00000188, 0x000001c5, 0x000200f9, 0x0000019d, 0x000200f8,
-    0x0000019f, 0x000200f9, 0x00000199, 0x000200f8, 0x000001c6, 0x0004003d, 0x00000027, 0x000001c7,
-    0x00000188, 0x0004003d, 0x00000027, 0x000001c8, 0x0000018d, 0x0007000c, 0x00000027, 0x000001c9,
-    0x00000001, 0x0000002a, 0x000001c7, 0x000001c8, 0x0003003e, 0x00000188, 0x000001c9, 0x000200f9,
-    0x00000199, 0x000200f8, 0x00000199, 0x00050041, 0x0000013b, 0x000001cb, 0x00000130, 0x00000142,
-    0x0004003d, 0x00000027, 0x000001cc, 0x000001cb, 0x00050041, 0x0000013b, 0x000001cd, 0x00000130,
-    0x00000125, 0x0004003d, 0x00000027, 0x000001ce, 0x000001cd, 0x0007000c, 0x00000027, 0x000001cf,
-    0x00000001, 0x00000027, 0x000001cc, 0x000001ce, 0x0004003d, 0x00000027, 0x000001d0, 0x0000018c,
-    0x0007000c, 0x00000027, 0x000001d1, 0x00000001, 0x00000027, 0x000001cf, 0x000001d0, 0x0003003e,
-    0x000001ca, 0x000001d1, 0x0004003d, 0x00000027, 0x000001d2, 0x00000188, 0x0004003d, 0x00000027,
-    0x000001d3, 0x000001ca, 0x0007000c, 0x00000027, 0x000001d4, 0x00000001, 0x0000002a, 0x000001d2,
-    0x000001d3, 0x0003003e, 0x00000188, 0x000001d4, 0x00050041, 0x0000013b, 0x000001d6, 0x00000130,
-    0x00000125, 0x0004003d, 0x00000027, 0x000001d7, 0x000001d6, 0x0004003d, 0x00000027, 0x000001d8,
-    0x0000018c, 0x0007000c, 0x00000027, 0x000001d9, 0x00000001, 0x00000027, 0x000001d7, 0x000001d8,
-    0x0003003e, 0x000001d5, 0x000001d9, 0x00050041, 0x0000013b, 0x000001da, 0x00000130, 0x00000147,
-    0x0004003d, 0x00000027, 0x000001db, 0x000001da, 0x000500b1, 0x00000008, 0x000001dc, 0x000001db,
-    0x00000034, 0x000300f7, 0x000001de, 0x00000000, 0x000400fa, 0x000001dc, 0x000001dd, 0x000001de,
-    0x000200f8, 0x000001dd, 0x00050041, 0x0000013b, 0x000001e0, 0x00000130, 0x0000017c, 0x0004003d,
-    0x00000027, 0x000001e1, 0x000001e0, 0x0003003e, 0x000001df, 0x000001e1, 0x000200f9, 0x000001e2,
-    0x000200f8, 0x000001e2, 0x000400f6, 0x000001e4, 0x000001e5, 0x00000000, 0x000200f9, 0x000001e6,
-    0x000200f8, 0x000001e6, 0x0004003d, 0x00000027, 0x000001e7, 0x00000188, 0x0004003d, 0x00000027,
-    0x000001e8, 0x000001d5, 0x000500b1, 0x00000008, 0x000001e9, 0x000001e7, 0x000001e8, 0x000400fa,
-    0x000001e9, 0x000001e3, 0x000001e4, 0x000200f8, 0x000001e3, 0x0004003d, 0x00000027, 0x000001ea,
-    0x00000188, 0x0004007c, 0x00000006, 0x000001eb, 0x000001ea, 0x0004003d, 0x00000006, 0x000001ed,
-    0x00000118, 0x0003003e, 0x000001ec, 0x000001ed, 0x0003003e, 0x000001ee, 0x000001eb, 0x0004003d,
-    0x00000006, 0x000001f0, 0x0000017e, 0x0003003e, 0x000001ef, 0x000001f0, 0x00070039, 0x00000008,
-    0x000001f1, 0x00000014, 0x000001ec, 0x000001ee, 0x000001ef, 0x000400a8, 0x00000008, 0x000001f2,
-    0x000001f1, 0x000300f7, 0x000001f4, 0x00000000, 0x000400fa, 0x000001f2, 0x000001f3, 0x000001f4,
-    0x000200f8, 0x000001f3, 0x000200f9, 0x000001e5, 0x000200f8, 0x000001f4, 0x0004003d, 0x00000027,
-    0x000001f6, 0x00000188, 0x0004007c, 0x00000006, 0x000001f7, 0x000001f6, 0x0004003d, 0x00000027,
-    0x000001f9, 0x000001df, 0x000500c3, 0x00000027, 0x000001fa, 0x000001f9, 0x00000147, 0x00050082,
-    0x00000027, 0x000001fb, 0x000001f8, 0x000001fa, 0x0007000c, 0x00000027, 0x000001fc, 0x00000001,
-    0x0000002a, 0x000001fb, 0x00000034, 0x0004007c, 0x00000006, 0x000001fd, 0x000001fc, 0x0004003d,
-    0x00000006, 0x000001ff, 0x00000118, 0x0003003e, 0x000001fe, 0x000001ff, 0x0003003e, 0x00000200,
-    0x000001f7, 0x0004003d, 0x00000006, 0x00000202, 0x0000017e, 0x0003003e, 0x00000201, 0x00000202,
-    0x0003003e, 0x00000203, 0x000001fd, 0x00080039, 0x00000002, 0x00000204, 0x0000001b, 0x000001fe,
-    0x00000200, 0x00000201, 0x00000203, 0x00050041, 0x0000013b, 0x00000205, 0x00000130, 0x00000147,
-    0x0004003d, 0x00000027, 0x00000206, 0x00000205, 0x000500c7, 0x00000027, 0x00000207, 0x00000206,
-    0x000001c0, 0x0004003d, 0x00000027, 0x00000208, 0x000001df, 0x00050080, 0x00000027, 0x00000209,
-    0x00000208, 0x00000207, 0x0003003e, 0x000001df, 0x00000209, 0x000200f9, 0x000001e5, 0x000200f8,
-    0x000001e5, 0x0004003d, 0x00000027, 0x0000020a, 0x00000188, 0x00050080, 0x00000027, 0x0000020b,
-    0x0000020a, 0x00000125, 0x0003003e, 0x00000188, 0x0000020b, 0x000200f9, 0x000001e2, 0x000200f8,
-    0x000001e4, 0x000200f9, 0x000001de, 0x000200f8, 0x000001de, 0x000100fd, 0x00010038, 0x00050036,
-    0x00000008, 0x0000000e, 0x00000000, 0x00000009, 0x00030037, 0x00000007, 0x0000000a, 0x00030037,
-    0x00000007, 0x0000000b, 0x00030037, 0x00000007, 0x0000000c, 0x00030037, 0x00000007, 0x0000000d,
-    0x000200f8, 0x0000000f, 0x0004003b, 0x00000007, 0x0000001d, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000021, 0x00000007, 0x0004003b, 0x00000007, 0x00000024, 0x00000007, 0x0004003b, 0x00000007,
-    0x0000002f, 0x00000007, 0x0004003b, 0x00000007, 0x00000039, 0x00000007, 0x0004003b, 0x00000007,
-    0x0000003d, 0x00000007, 0x0004003b, 0x00000007, 0x00000041, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000047, 0x00000007, 0x0004003b, 0x00000007, 0x00000068, 0x00000007, 0x0004003b, 0x00000007,
-    0x0000006b, 0x00000007, 0x0004003b, 0x00000007, 0x00000073, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000079, 0x00000007, 0x0004003b, 0x00000007, 0x0000008c, 0x00000007, 0x0004003d, 0x00000006,
-    0x0000001e, 0x0000000b, 0x00050086, 0x00000006, 0x00000020, 0x0000001e, 0x0000001f, 0x0003003e,
-    0x0000001d, 0x00000020, 0x0004003d, 0x00000006, 0x00000022, 0x0000000c, 0x00050086, 0x00000006,
-    0x00000023, 0x00000022, 0x0000001f, 0x0003003e, 0x00000021, 0x00000023, 0x0004003d, 0x00000006,
-    0x00000025, 0x0000001d, 0x0004003d, 0x00000006, 0x00000026, 0x00000021, 0x00050084, 0x00000006,
-    0x0000002d, 0x00000026, 0x0000002c, 0x00050080, 0x00000006, 0x0000002e, 0x00000025, 0x0000002d,
-    0x0003003e, 0x00000024, 0x0000002e, 0x0004003d, 0x00000006, 0x00000030, 0x0000000a, 0x00050041,
-    0x00000035, 0x00000036, 0x00000033, 0x00000034, 0x0004003d, 0x00000006, 0x00000037, 0x00000036,
-    0x00050082, 0x00000006, 0x00000038, 0x00000030, 0x00000037, 0x0003003e, 0x0000002f, 0x00000038,
-    0x0004003d, 0x00000006, 0x0000003a, 0x0000002f, 0x000500c2, 0x00000006, 0x0000003c, 0x0000003a,
-    0x0000003b, 0x0003003e, 0x00000039, 0x0000003c, 0x0004003d, 0x00000006, 0x0000003e, 0x0000002f,
-    0x000500c7, 0x00000006, 0x00000040, 0x0000003e, 0x0000003f, 0x0003003e, 0x0000003d, 0x00000040,
-    0x0004003d, 0x00000006, 0x00000042, 0x00000024, 0x00050084, 0x00000006, 0x00000044, 0x00000042,
-    0x00000043, 0x0004003d, 0x00000006, 0x00000045, 0x00000039, 0x00050080, 0x00000006, 0x00000046,
-    0x00000044, 0x00000045, 0x0003003e, 0x00000041, 0x00000046, 0x0004003d, 0x00000006, 0x00000058,
-    0x00000041, 0x0004007c, 0x00000027, 0x00000059, 0x00000058, 0x00050080, 0x00000027, 0x0000005a,
-    0x00000057, 0x00000059, 0x00060041, 0x0000005b, 0x0000005c, 0x00000050, 0x00000051, 0x0000005a,
-    0x0004003d, 0x00000006, 0x0000005d, 0x0000005c, 0x0003003e, 0x00000047, 0x0000005d, 0x0004003d,
-    0x00000006, 0x0000005e, 0x00000047, 0x0004003d, 0x00000006, 0x00000060, 0x0000003d, 0x000500c4,
-    0x00000006, 0x00000061, 0x0000005f, 0x00000060, 0x000500c7, 0x00000006, 0x00000062, 0x0000005e,
-    0x00000061, 0x000500aa, 0x00000008, 0x00000063, 0x00000062, 0x0000002b, 0x000300f7, 0x00000065,
-    0x00000000, 0x000400fa, 0x00000063, 0x00000064, 0x00000065, 0x000200f8, 0x00000064, 0x000200fe,
-    0x00000066, 0x000200f8, 0x00000065, 0x0004003d, 0x00000006, 0x00000069, 0x0000003d, 0x000500aa,
-    0x00000008, 0x0000006a, 0x00000069, 0x0000002b, 0x000300f7, 0x0000006d, 0x00000000, 0x000400fa,
-    0x0000006a, 0x0000006c, 0x0000006e, 0x000200f8, 0x0000006c, 0x0003003e, 0x0000006b, 0x0000002b,
-    0x000200f9, 0x0000006d, 0x000200f8, 0x0000006e, 0x0004003d, 0x00000006, 0x0000006f, 0x0000003d,
-    0x000500c4, 0x00000006, 0x00000070, 0x0000005f, 0x0000006f, 0x00050082, 0x00000006, 0x00000071,
-    0x00000070, 0x0000005f, 0x0003003e, 0x0000006b, 0x00000071, 0x000200f9, 0x0000006d, 0x000200f8,
-    0x0000006d, 0x0004003d, 0x00000006, 0x00000072, 0x0000006b, 0x0003003e, 0x00000068, 0x00000072,
-    0x0004003d, 0x00000006, 0x00000074, 0x00000047, 0x0004003d, 0x00000006, 0x00000075, 0x00000068,
-    0x000500c7, 0x00000006, 0x00000076, 0x00000074, 0x00000075, 0x000400cd, 0x00000027, 0x00000077,
-    0x00000076, 0x0004007c, 0x00000006, 0x00000078, 0x00000077, 0x0003003e, 0x00000073, 0x00000078,
-    0x0004003d, 0x00000006, 0x0000007e, 0x00000041, 0x0004007c, 0x00000027, 0x0000007f, 0x0000007e,
-    0x00050080, 0x00000027, 0x00000080, 0x0000007d, 0x0000007f, 0x00060041, 0x0000005b, 0x00000081,
-    0x00000050, 0x00000051, 0x00000080, 0x0004003d, 0x00000006, 0x00000082, 0x00000081, 0x0004003d,
-    0x00000006, 0x00000083, 0x00000073, 0x00050080, 0x00000006, 0x00000084, 0x00000082, 0x00000083,
-    0x0003003e, 0x00000079, 0x00000084, 0x0004003d, 0x00000006, 0x00000085, 0x00000079, 0x000500ae,
-    0x00000008, 0x00000088, 0x00000085, 0x00000087, 0x000300f7, 0x0000008a, 0x00000000, 0x000400fa,
-    0x00000088, 0x00000089, 0x0000008a, 0x000200f8, 0x00000089, 0x000200fe, 0x00000066, 0x000200f8,
-    0x0000008a, 0x0004003d, 0x00000006, 0x0000008d, 0x0000000c, 0x00050089, 0x00000006, 0x0000008e,
-    0x0000008d, 0x0000001f, 0x00050084, 0x00000006, 0x0000008f, 0x0000008e, 0x0000001f, 0x0004003d,
-    0x00000006, 0x00000090, 0x0000000b, 0x00050089, 0x00000006, 0x00000091, 0x00000090, 0x0000001f,
-    0x00050080, 0x00000006, 0x00000092, 0x0000008f, 0x00000091, 0x0003003e, 0x0000008c, 0x00000092,
-    0x0004003d, 0x00000006, 0x00000093, 0x00000079, 0x00050084, 0x00000006, 0x00000095, 0x00000093,
-    0x00000094, 0x0004003d, 0x00000006, 0x00000096, 0x0000008c, 0x00050080, 0x00000006, 0x00000097,
-    0x00000095, 0x00000096, 0x0003003e, 0x0000000d, 0x00000097, 0x000200fe, 0x00000098, 0x00010038,
-    0x00050036, 0x00000008, 0x00000014, 0x00000000, 0x00000010, 0x00030037, 0x00000007, 0x00000011,
-    0x00030037, 0x00000007, 0x00000012, 0x00030037, 0x00000007, 0x00000013, 0x000200f8, 0x00000015,
-    0x0004003b, 0x00000007, 0x0000009b, 0x00000007, 0x0004003b, 0x00000007, 0x0000009c, 0x00000007,
-    0x0004003b, 0x00000007, 0x0000009e, 0x00000007, 0x0004003b, 0x00000007, 0x000000a0, 0x00000007,
-    0x0004003b, 0x00000007, 0x000000a2, 0x00000007, 0x0004003d, 0x00000006, 0x0000009d, 0x00000011,
-    0x0003003e, 0x0000009c, 0x0000009d, 0x0004003d, 0x00000006, 0x0000009f, 0x00000012, 0x0003003e,
-    0x0000009e, 0x0000009f, 0x0004003d, 0x00000006, 0x000000a1, 0x00000013, 0x0003003e, 0x000000a0,
-    0x000000a1, 0x00080039, 0x00000008, 0x000000a3, 0x0000000e, 0x0000009c, 0x0000009e, 0x000000a0,
-    0x000000a2, 0x0004003d, 0x00000006, 0x000000a4, 0x000000a2, 0x0003003e, 0x0000009b, 0x000000a4,
-    0x000300f7, 0x000000a6, 0x00000000, 0x000400fa, 0x000000a3, 0x000000a5, 0x000000a6, 0x000200f8,
-    0x000000a5, 0x0004003d, 0x00000006, 0x000000ab, 0x0000009b, 0x00060041, 0x0000005b, 0x000000ac,
-    0x000000aa, 0x00000034, 0x000000ab, 0x0004003d, 0x00000006, 0x000000ad, 0x000000ac, 0x000500ab,
-    0x00000008, 0x000000ae, 0x000000ad, 0x0000002b, 0x000200f9, 0x000000a6, 0x000200f8, 0x000000a6,
-    0x000700f5, 0x00000008, 0x000000af, 0x000000a3, 0x00000015, 0x000000ae, 0x000000a5, 0x000300f7,
-    0x000000b1, 0x00000000, 0x000400fa, 0x000000af, 0x000000b0, 0x000000b1, 0x000200f8, 0x000000b0,
-    0x0004003d, 0x00000006, 0x000000b6, 0x0000009b, 0x00060041, 0x0000005b, 0x000000b7, 0x000000b5,
-    0x00000034, 0x000000b6, 0x0004003d, 0x00000006, 0x000000b8, 0x000000b7, 0x000500c7, 0x00000006,
-    0x000000ba, 0x000000b8, 0x000000b9, 0x000500ab, 0x00000008, 0x000000bb, 0x000000ba, 0x0000002b,
-    0x000200f9, 0x000000b1, 0x000200f8, 0x000000b1, 0x000700f5, 0x00000008, 0x000000bc, 0x000000af,
-    0x000000a6, 0x000000bb, 0x000000b0, 0x000200fe, 0x000000bc, 0x00010038, 0x00050036, 0x00000002,
-    0x0000001b, 0x00000000, 0x00000016, 0x00030037, 0x00000007, 0x00000017, 0x00030037, 0x00000007,
-    0x00000018, 0x00030037, 0x00000007, 0x00000019, 0x00030037, 0x00000007, 0x0000001a, 0x000200f8,
-    0x0000001c, 0x0004003b, 0x00000007, 0x000000bf, 0x00000007, 0x0004003b, 0x00000007, 0x000000c5,
-    0x00000007, 0x0004003b, 0x00000007, 0x000000e5, 0x00000007, 0x0004003d, 0x00000006, 0x000000c0,
-    0x00000019, 0x00050084, 0x00000006, 0x000000c2, 0x000000c0, 0x000000c1, 0x0004003d, 0x00000006,
-    0x000000c3, 0x00000018, 0x00050080, 0x00000006, 0x000000c4, 0x000000c2, 0x000000c3, 0x0003003e,
-    0x000000bf, 0x000000c4, 0x0003003e, 0x000000c5, 0x000000c6, 0x0004003d, 0x00000006, 0x000000cb,
-    0x000000bf, 0x00060041, 0x0000005b, 0x000000cc, 0x000000ca, 0x00000034, 0x000000cb, 0x0004003d,
-    0x00000006, 0x000000cd, 0x000000cc, 0x0004003d, 0x00000006, 0x000000ce, 0x00000017, 0x000500aa,
-    0x00000008, 0x000000cf, 0x000000cd, 0x000000ce, 0x000300f7, 0x000000d1, 0x00000000, 0x000400fa,
-    0x000000cf, 0x000000d0, 0x000000d3, 0x000200f8, 0x000000d0, 0x0004003d, 0x00000006, 0x000000d2,
-    0x000000bf, 0x0003003e, 0x000000c5, 0x000000d2, 0x000200f9, 0x000000d1, 0x000200f8, 0x000000d3,
-    0x0004003d, 0x00000006, 0x000000d6, 0x000000bf, 0x00050080, 0x00000006, 0x000000d7, 0x000000d5,
-    0x000000d6, 0x00060041, 0x0000005b, 0x000000d8, 0x000000ca, 0x00000034, 0x000000d7, 0x0004003d,
-    0x00000006, 0x000000d9, 0x000000d8, 0x0004003d, 0x00000006, 0x000000da, 0x00000017, 0x000500aa,
-    0x00000008, 0x000000db, 0x000000d9, 0x000000da, 0x000300f7, 0x000000dd, 0x00000000, 0x000400fa,
-    0x000000db, 0x000000dc, 0x000000dd, 0x000200f8, 0x000000dc, 0x0004003d, 0x00000006, 0x000000df,
-    0x000000bf, 0x00050080, 0x00000006, 0x000000e0, 0x000000de, 0x000000df, 0x0003003e, 0x000000c5,
-    0x000000e0, 0x000200f9, 0x000000dd, 0x000200f8, 0x000000dd, 0x000200f9, 0x000000d1, 0x000200f8,
-    0x000000d1, 0x0004003d, 0x00000006, 0x000000e1, 0x000000c5, 0x000500ab, 0x00000008, 0x000000e2,
-    0x000000e1, 0x000000c6, 0x000300f7, 0x000000e4, 0x00000000, 0x000400fa, 0x000000e2, 0x000000e3,
-    0x000000e4, 0x000200f8, 0x000000e3, 0x0004003d, 0x00000006, 0x000000f2, 0x000000c5, 0x00050080,
-    0x00000006, 0x000000f3, 0x000000f1, 0x000000f2, 0x00060041, 0x0000005b, 0x000000f4, 0x000000e9,
-    0x00000034, 0x000000f3, 0x0004003d, 0x00000006, 0x000000f5, 0x000000f4, 0x0003003e, 0x000000e5,
-    0x000000f5, 0x0004003d, 0x00000006, 0x000000f6, 0x000000c5, 0x00050080, 0x00000006, 0x000000f7,
-    0x000000f1, 0x000000f6, 0x0004003d, 0x00000006, 0x000000f8, 0x000000e5, 0x000500c7, 0x00000006,
-    0x000000fa, 0x000000f8, 0x000000f9, 0x0004003d, 0x00000006, 0x000000fb, 0x0000001a, 0x000500c7,
-    0x00000006, 0x000000fc, 0x000000fb, 0x0000003f, 0x000500c4, 0x00000006, 0x000000fe, 0x000000fc,
-    0x000000fd, 0x000500c5, 0x00000006, 0x000000ff, 0x000000fa, 0x000000fe, 0x00060041, 0x0000005b,
-    0x00000100, 0x000000e9, 0x00000034, 0x000000f7, 0x0003003e, 0x00000100, 0x000000ff, 0x000200f9,
-    0x000000e4, 0x000200f8, 0x000000e4, 0x000100fd, 0x00010038,
+const uint8_t Blob074_Data[4306] =
+{
+    0x28, 0xb5, 0x2f, 0xfd, 0x60, 0x74, 0x3f, 0x45, 0x86, 0x00, 0x6a, 0x8c, 0xf0, 0x21, 0x38, 0x10,
+    0x90, 0xca, 0x0d, 0x01, 0x18, 0x08, 0x37, 0x13, 0x20, 0x5b, 0x69, 0x20, 0x50, 0x20, 0x10, 0x08,
+    0x09, 0xc0, 0x0a, 0x1a, 0xc4, 0x4e, 0xdb, 0x7b, 0x84, 0xfc, 0x5f, 0x71, 0xa5, 0x42, 0x21, 0x9c,
+    0x86, 0x9d, 0x3d, 0xc8, 0x6f, 0x87, 0x20, 0xf5, 0x46, 0xad, 0xc5, 0x67, 0xa4, 0x4e, 0x67, 0x81,
+    0x5a, 0x70, 0xbb, 0x46, 0x2b, 0x77, 0x0a, 0xd6, 0x01, 0xfe, 0x01, 0x27, 0x02, 0x4d, 0x2c, 0x52,
+    0xcd, 0xc4, 0x40, 0x7f, 0xbe, 0xce, 0xce, 0xd1, 0x96, 0x5d, 0x5c, 0x7b, 0x5b, 0x67, 0xa5, 0x55,
+    0xf9, 0xd7, 0xee, 0xba, 0xed, 0x59, 0xf2, 0xff, 0xbf, 0xd5, 0xcf, 0xe4, 0xff, 0x79, 0x5d, 0x2d,
+    0x9e, 0x6b, 0xb8, 0xeb, 0xff, 0xe4, 0xd7, 0xed, 0xee, 0xd5, 0x42, 0x02, 0xa8, 0xcf, 0xdf, 0x5a,
+    0xfc, 0x1a, 0x7d, 0x9a, 0xe1, 0x3d, 0x08, 0x5d, 0x2d, 0xb7, 0xe7, 0xb8, 0x79, 0x35, 0x9b, 0xd7,
+    0x25, 0xbb, 0xde, 0xff, 0x61, 0x78, 0xd0, 0x9f, 0xed, 0xcc, 0xfe, 0x3c, 0xde, 0xde, 0xdc, 0x96,
+    0xfb, 0xdf, 0xf1, 0xdb, 0x79, 0xee, 0x2d, 0xbe, 0xf7, 0xd7, 0xb9, 0x1b, 0x4d, 0xcd, 0xe2, 0xff,
+    0x38, 0x56, 0xf1, 0xff, 0x3a, 0xc4, 0xc3, 0x0f, 0x85, 0xff, 0xf3, 0xef, 0x7b, 0xaa, 0x21, 0x21,
+    0xff, 0xb9, 0xf9, 0xe0, 0x17, 0x12, 0xf8, 0x03, 0xcf, 0xde, 0xed, 0x6e, 0x8f, 0x9c, 0xc7, 0x7e,
+    0xeb, 0xba, 0x5a, 0x0f, 0xf8, 0xf3, 0x6c, 0x36, 0x3f, 0x9e, 0xc4, 0xa7, 0x77, 0x6e, 0x08, 0xbd,
+    0xdc, 0xd6, 0xf1, 0xed, 0xce, 0xe5, 0xf7, 0x3b, 0x84, 0xdd, 0x6e, 0xf7, 0x57, 0xec, 0x5f, 0xf2,
+    0x57, 0xeb, 0x77, 0xdb, 0xea, 0x54, 0x36, 0xb2, 0xe4, 0xff, 0x72, 0x6e, 0xdf, 0xd6, 0x98, 0xb9,
+    0xbd, 0xfb, 0x9d, 0x7b, 0x85, 0xff, 0xf7, 0x72, 0xcb, 0xee, 0x76, 0x2e, 0xf6, 0xd3, 0xfb, 0x4d,
+    0x47, 0xe7, 0x25, 0xeb, 0x73, 0x2f, 0x7f, 0x5b, 0x75, 0x9c, 0xac, 0xed, 0x57, 0xff, 0xbf, 0xe3,
+    0xa9, 0x3d, 0x3e, 0x27, 0xd6, 0xf5, 0x72, 0xf7, 0xba, 0x30, 0x6d, 0xd7, 0xeb, 0x6f, 0xed, 0x6e,
+    0x76, 0xa9, 0xbc, 0x79, 0x3a, 0xba, 0x0a, 0x17, 0xe6, 0x7f, 0xef, 0xde, 0xbe, 0x6b, 0x97, 0xf1,
+    0x6a, 0xca, 0x25, 0x5c, 0xf2, 0x5f, 0xbb, 0xf6, 0x2e, 0xf7, 0x76, 0x75, 0xf8, 0x9d, 0x16, 0xff,
+    0xbc, 0x1b, 0xc6, 0x77, 0x5b, 0x6e, 0xf7, 0xfe, 0x99, 0xef, 0x75, 0xbb, 0xe7, 0x75, 0x6e, 0x99,
+    0x1d, 0xef, 0x75, 0xab, 0xbf, 0x5b, 0x6e, 0x6b, 0xb9, 0xb9, 0x82, 0xbf, 0xb6, 0xdf, 0x6e, 0xfc,
+    0x96, 0x5d, 0xbf, 0xc5, 0xb1, 0xfa, 0x7d, 0xef, 0xda, 0xab, 0xd6, 0xdf, 0xed, 0x01, 0x17, 0xb0,
+    0x2c, 0x50, 0xfd, 0xe4, 0xd7, 0x4a, 0x45, 0x41, 0x3d, 0xd5, 0xe9, 0xb8, 0xae, 0xe3, 0xd8, 0xbb,
+    0xc7, 0x77, 0x2c, 0x80, 0x28, 0x13, 0xf4, 0x6f, 0xef, 0xbe, 0x7b, 0x6b, 0xb5, 0x54, 0xde, 0xc6,
+    0x4a, 0xfb, 0xa4, 0xaf, 0xd4, 0x73, 0xe6, 0x35, 0x95, 0x3f, 0xef, 0xde, 0xea, 0x6a, 0x3a, 0xb7,
+    0x4e, 0x2f, 0xe7, 0x76, 0x91, 0xfe, 0xfc, 0xa7, 0xb5, 0x57, 0x2b, 0xbf, 0xf3, 0x70, 0xb7, 0x3b,
+    0xc7, 0xe1, 0xee, 0x3a, 0x7b, 0xbf, 0x41, 0x70, 0xcb, 0x94, 0x3e, 0xd2, 0x4f, 0x6e, 0xbd, 0xb9,
+    0x56, 0xc7, 0xe9, 0x1b, 0x04, 0xde, 0x6b, 0xef, 0x1d, 0xdf, 0x66, 0x6f, 0x1d, 0xcf, 0xb3, 0x77,
+    0xae, 0xd7, 0xf3, 0xd9, 0x6e, 0x57, 0x9b, 0x3d, 0x5b, 0xab, 0x56, 0xa8, 0x50, 0xcd, 0x22, 0xc1,
+    0x5c, 0x62, 0xf9, 0x8f, 0x41, 0x93, 0xcf, 0xe4, 0xd7, 0x71, 0x1b, 0x2f, 0xa9, 0x5c, 0x82, 0xff,
+    0x97, 0xbf, 0xd2, 0xef, 0x02, 0xfb, 0x4a, 0xb0, 0xed, 0xf9, 0x04, 0x6b, 0xd7, 0xb5, 0x2a, 0xfc,
+    0xe7, 0xdf, 0x4c, 0x00, 0xff, 0xf8, 0x43, 0x7f, 0x4c, 0xf5, 0xe9, 0xdf, 0xfc, 0xb0, 0xfc, 0x97,
+    0x02, 0x62, 0x39, 0x3f, 0xca, 0x04, 0x65, 0xfa, 0xff, 0x2b, 0xa1, 0x51, 0x69, 0xcb, 0xa5, 0x59,
+    0x79, 0x95, 0x9c, 0xc2, 0xb2, 0x0c, 0xc7, 0xf4, 0xa3, 0xc8, 0xc8, 0x3a, 0x8b, 0x04, 0xfd, 0x19,
+    0x14, 0x48, 0x10, 0xa0, 0x40, 0x80, 0xfc, 0x70, 0xfd, 0xe9, 0xe3, 0x27, 0x8e, 0x4f, 0x1f, 0x3e,
+    0x8f, 0x7b, 0x1c, 0xf7, 0xe8, 0x71, 0xd4, 0x43, 0x47, 0xcd, 0x1a, 0x6b, 0x9f, 0x9a, 0x45, 0x30,
+    0x8a, 0x60, 0x12, 0x15, 0x13, 0xa9, 0x22, 0xbf, 0x68, 0x6d, 0xf9, 0x52, 0x99, 0xa1, 0x18, 0x3e,
+    0x71, 0x62, 0xe8, 0xc4, 0x49, 0x38, 0x1d, 0x3c, 0x62, 0xc4, 0x48, 0x0e, 0x03, 0x35, 0xb8, 0xbe,
+    0x2a, 0xba, 0xbe, 0xdf, 0x1e, 0x96, 0xc4, 0x08, 0x11, 0x7b, 0x63, 0x23, 0x44, 0xd0, 0xd1, 0x5b,
+    0xd9, 0x39, 0x83, 0xdc, 0x17, 0x36, 0x0e, 0x4e, 0x2e, 0x8e, 0xbb, 0xf6, 0xc1, 0x59, 0xaf, 0x5a,
+    0xac, 0xc9, 0x37, 0xa7, 0xdb, 0xb4, 0xcd, 0x59, 0x81, 0x8d, 0xc2, 0x84, 0xe5, 0x97, 0x3f, 0xd5,
+    0xda, 0x54, 0xda, 0xd4, 0x57, 0x4b, 0xa6, 0x3d, 0x8d, 0x95, 0x59, 0x49, 0x50, 0x4e, 0x67, 0xb0,
+    0x2f, 0xaf, 0x69, 0xcd, 0x5c, 0x30, 0x67, 0xcd, 0x75, 0x15, 0xd7, 0x77, 0xfe, 0x5c, 0x06, 0x54,
+    0x6c, 0xfd, 0x2f, 0x03, 0x5c, 0x5f, 0x6b, 0x01, 0x9c, 0xf5, 0xb4, 0xe2, 0x8a, 0x9d, 0x66, 0x7a,
+    0x49, 0x4b, 0xe7, 0xe5, 0xf2, 0xea, 0xcf, 0x4d, 0xb1, 0x1c, 0x47, 0xa3, 0xa6, 0x94, 0x52, 0x52,
+    0x50, 0x1f, 0x2a, 0xf9, 0x24, 0x4d, 0x6b, 0x9a, 0x21, 0x8d, 0x31, 0x21, 0xd0, 0x0e, 0x96, 0x5f,
+    0x73, 0xdc, 0xa5, 0x7c, 0x26, 0x9d, 0x32, 0x1d, 0x27, 0xe1, 0x3f, 0x2f, 0xc5, 0x60, 0x60, 0x5e,
+    0x1d, 0xe6, 0x05, 0x1a, 0x9e, 0x2c, 0x38, 0xc1, 0x35, 0xb9, 0x49, 0xd7, 0xa2, 0x69, 0x4c, 0x66,
+    0xd0, 0xb1, 0x27, 0x84, 0x25, 0x07, 0x4a, 0x5f, 0x49, 0x5d, 0xce, 0x03, 0x4d, 0x2d, 0xa4, 0x01,
+    0xcc, 0x2b, 0xba, 0x46, 0x8a, 0x4e, 0x25, 0x97, 0x8f, 0x8f, 0x8e, 0x8e, 0x7a, 0x9e, 0x8b, 0x8b,
+    0x8a, 0x8a, 0x89, 0x33, 0x14, 0x28, 0x86, 0x86, 0x4e, 0x08, 0x09, 0x07, 0xff, 0xa0, 0x91, 0xd8,
+    0x0f, 0xb6, 0xd2, 0x58, 0x3f, 0x80, 0x5b, 0xdb, 0xd7, 0x22, 0x07, 0xc6, 0x5f, 0xf8, 0xff, 0x36,
+    0xb6, 0xb5, 0x24, 0x85, 0xe7, 0x84, 0x2f, 0x4f, 0x2d, 0xa1, 0x66, 0xa9, 0xf2, 0x99, 0x74, 0xca,
+    0x74, 0x9c, 0x84, 0x05, 0xfc, 0xb4, 0xaf, 0x55, 0x95, 0xfa, 0x3f, 0xfe, 0xd2, 0xdf, 0xb5, 0xf1,
+    0x7a, 0x9c, 0xac, 0x49, 0x7f, 0xa4, 0xdf, 0xd3, 0xe1, 0x76, 0x57, 0x66, 0x1d, 0x17, 0x8d, 0xfe,
+    0xd4, 0xe5, 0xff, 0xbb, 0x7d, 0xe7, 0x65, 0xff, 0xdf, 0xf9, 0x9c, 0x0d, 0xa7, 0x73, 0xb9, 0xbd,
+    0x5e, 0xd6, 0xe5, 0x71, 0x33, 0x59, 0xf9, 0xff, 0xa7, 0xbb, 0xad, 0xb6, 0x5d, 0x37, 0xa7, 0xc6,
+    0xf0, 0xe7, 0xf1, 0xbc, 0x6d, 0x1f, 0x6f, 0xe7, 0xd2, 0xe1, 0x7a, 0x9c, 0xdd, 0xdf, 0x6c, 0x4c,
+    0x5f, 0x86, 0xe3, 0x0f, 0x19, 0x08, 0x90, 0x1f, 0xc6, 0xbf, 0xaf, 0xd1, 0xdb, 0x72, 0xe7, 0x16,
+    0xaf, 0x54, 0xa1, 0x22, 0x85, 0xf0, 0x48, 0xd7, 0xc8, 0xcf, 0xdb, 0xf1, 0x7f, 0x4f, 0x77, 0xe7,
+    0x2e, 0xf8, 0xbc, 0x3f, 0x3d, 0x3e, 0xb0, 0xcf, 0x7b, 0xfd, 0x65, 0x5d, 0xd7, 0x75, 0x5d, 0xd7,
+    0x75, 0x5d, 0xd7, 0x75, 0x5d, 0xd7, 0x75, 0x5d, 0xd7, 0x75, 0x5d, 0xd7, 0x75, 0xfd, 0xbb, 0xac,
+    0x4f, 0x3f, 0xb7, 0xf1, 0x1e, 0xd7, 0xd5, 0x9c, 0xe4, 0x9a, 0xe2, 0xa4, 0x72, 0xd1, 0x1f, 0xc7,
+    0xd5, 0x32, 0xcd, 0xd0, 0xe7, 0xaf, 0x97, 0xc8, 0x94, 0xaa, 0x49, 0xbf, 0xcb, 0xea, 0x54, 0x62,
+    0x03, 0x7f, 0x5e, 0x02, 0x03, 0xbb, 0x6c, 0xe1, 0xd2, 0xe5, 0xcb, 0x45, 0xcb, 0xe1, 0x96, 0xc4,
+    0xc3, 0x2c, 0x57, 0xaa, 0x50, 0x01, 0x80, 0x25, 0x0e, 0x8b, 0x72, 0xc5, 0x4a, 0x15, 0x2b, 0x4e,
+    0xa8, 0x4c, 0x91, 0x32, 0x45, 0x42, 0x81, 0x28, 0xf3, 0x13, 0x28, 0x55, 0xc3, 0x27, 0x5d, 0x76,
+    0x18, 0x16, 0x3a, 0x29, 0x64, 0x12, 0xb8, 0x84, 0xc9, 0x12, 0x25, 0x4c, 0x92, 0x28, 0x21, 0x3c,
+    0x22, 0x4d, 0x12, 0x86, 0x84, 0x90, 0x0f, 0x89, 0xe0, 0x91, 0x41, 0x23, 0x50, 0x83, 0x45, 0x04,
+    0xe7, 0xbd, 0x22, 0x3f, 0x80, 0xfc, 0xf8, 0xff, 0x0b, 0x21, 0xe2, 0x62, 0xc8, 0x9f, 0x90, 0x20,
+    0x41, 0x02, 0x81, 0x20, 0xf2, 0xe1, 0xa3, 0xc7, 0x0e, 0x1e, 0x3d, 0xf4, 0x78, 0xe4, 0xf8, 0x92,
+    0x03, 0x87, 0x8e, 0x1b, 0x38, 0x0a, 0x6f, 0xbc, 0xd9, 0xf8, 0x2e, 0x68, 0xcc, 0xa8, 0x01, 0x48,
+    0x43, 0xc6, 0x8c, 0x18, 0x32, 0x62, 0xbc, 0x80, 0x11, 0xf7, 0x42, 0x0b, 0xf0, 0x6f, 0x0b, 0x6e,
+    0xf1, 0x9d, 0x2c, 0xb2, 0x56, 0xf8, 0xa5, 0xf0, 0x4b, 0xd1, 0xe7, 0x87, 0xe2, 0x44, 0x1f, 0xdf,
+    0x09, 0x13, 0x7c, 0x5f, 0x13, 0x70, 0x89, 0xef, 0x08, 0x12, 0x7b, 0x24, 0x9e, 0x46, 0xe4, 0x89,
+    0xd0, 0x13, 0xe1, 0x94, 0xe7, 0x0d, 0x01, 0x22, 0x44, 0x93, 0x77, 0xef, 0xf9, 0x5e, 0xba, 0x73,
+    0x3f, 0x74, 0x3f, 0x44, 0xb9, 0xb9, 0x8e, 0xa7, 0x33, 0xe5, 0xf8, 0x9d, 0x87, 0x3b, 0x28, 0x5e,
+    0x67, 0xf7, 0x0d, 0xd8, 0x3d, 0xeb, 0xb6, 0x74, 0x37, 0xdd, 0xd2, 0xd6, 0xd6, 0xce, 0x69, 0x95,
+    0x6c, 0x0e, 0x1d, 0xb2, 0x1d, 0x92, 0x38, 0x64, 0xd8, 0xa0, 0x61, 0x83, 0x33, 0x83, 0x05, 0x0c,
+    0x17, 0x30, 0x34, 0x2d, 0xc4, 0x61, 0xe5, 0xb0, 0x48, 0x71, 0x56, 0xb8, 0x2b, 0x1c, 0xd3, 0x5a,
+    0xe1, 0xcd, 0xed, 0x8d, 0xae, 0xb0, 0xd6, 0xc6, 0xd6, 0xb6, 0x5c, 0x9b, 0xd5, 0x28, 0x4c, 0xa0,
+    0x30, 0xab, 0xa1, 0xa5, 0x55, 0xd3, 0x94, 0x68, 0x66, 0x67, 0x6f, 0x67, 0x49, 0x33, 0x6a, 0x19,
+    0x59, 0x99, 0x4c, 0x95, 0x30, 0x16, 0x37, 0x16, 0x4b, 0x20, 0x10, 0x01, 0x16, 0xeb, 0x82, 0x30,
+    0xfd, 0x0f, 0xb2, 0xde, 0xc2, 0xc4, 0xbe, 0x1c, 0xcc, 0x9f, 0xc1, 0x01, 0xae, 0x03, 0x5c, 0x5b,
+    0x07, 0xae, 0xaa, 0xb6, 0xe8, 0x43, 0x58, 0xf1, 0x5f, 0xa4, 0x15, 0xc0, 0x40, 0x96, 0xd6, 0xfc,
+    0x2d, 0x90, 0x45, 0xa0, 0x80, 0x80, 0x01, 0x02, 0x02, 0x5c, 0x61, 0x5d, 0x59, 0x61, 0x55, 0x59,
+    0xd1, 0x83, 0x54, 0x00, 0xaa, 0x9a, 0x4c, 0x51, 0x7d, 0x4d, 0x41, 0x01, 0x90, 0x82, 0x8a, 0x92,
+    0x7a, 0x46, 0x2d, 0x9f, 0x9e, 0x4e, 0x4f, 0x69, 0xd9, 0x26, 0xa7, 0xbd, 0xa6, 0xa8, 0x14, 0x9a,
+    0x04, 0xff, 0xef, 0x6c, 0x32, 0xfa, 0x49, 0x89, 0xfe, 0x6f, 0xd2, 0x4b, 0x98, 0x48, 0x71, 0x5e,
+    0x4c, 0x30, 0x98, 0x86, 0xe5, 0x1f, 0x61, 0x29, 0xc6, 0x35, 0x2b, 0xa9, 0x32, 0x1c, 0x7f, 0xc8,
+    0x40, 0x80, 0xfc, 0x30, 0xae, 0x59, 0xbc, 0x52, 0x85, 0x8a, 0x14, 0xc2, 0x23, 0x46, 0x76, 0xb8,
+    0x00, 0xfc, 0x9b, 0xf2, 0x75, 0x41, 0x2d, 0x9f, 0x53, 0x78, 0xa9, 0x54, 0x24, 0xff, 0x98, 0x41,
+    0xb6, 0xec, 0xc3, 0xf1, 0x81, 0x0f, 0x40, 0x2a, 0x8e, 0xfa, 0x31, 0xd4, 0x53, 0xd2, 0xa9, 0x49,
+    0x3a, 0x8d, 0xfe, 0xff, 0x97, 0x66, 0xa6, 0xaa, 0x27, 0xf4, 0xea, 0xe9, 0x94, 0x36, 0xa5, 0x44,
+    0xff, 0xa4, 0xd8, 0x69, 0xa5, 0x48, 0x8e, 0xd4, 0xc2, 0x65, 0x45, 0x21, 0x97, 0x98, 0x9f, 0xf6,
+    0x9c, 0xf4, 0x9a, 0x40, 0x48, 0xf9, 0x68, 0x97, 0x09, 0x0f, 0xea, 0x61, 0xe9, 0x56, 0x9a, 0x4b,
+    0xca, 0x3a, 0x35, 0x34, 0x2f, 0x20, 0xc9, 0x31, 0xaf, 0xb4, 0xdb, 0x92, 0x6d, 0x9e, 0xa0, 0xac,
+    0xca, 0x64, 0x59, 0xd3, 0xba, 0xc1, 0x15, 0xd8, 0xd4, 0xcb, 0xf9, 0x55, 0x2f, 0xa8, 0x15, 0x64,
+    0xcd, 0x59, 0x09, 0xbe, 0xd4, 0xaf, 0x22, 0x10, 0xbf, 0xb1, 0x31, 0xf2, 0x27, 0x82, 0x3f, 0x64,
+    0x24, 0xe2, 0x23, 0x48, 0x2f, 0x12, 0x1c, 0x49, 0x35, 0x5a, 0xc4, 0x28, 0x31, 0x8f, 0x22, 0x44,
+    0x89, 0x10, 0x1d, 0xca, 0x63, 0xe8, 0x50, 0xa1, 0x47, 0x43, 0x84, 0x06, 0x15, 0x42, 0x24, 0x84,
+    0xa7, 0x11, 0xcf, 0x9d, 0xc6, 0x2f, 0x77, 0x10, 0xed, 0x9c, 0x99, 0x33, 0xa7, 0x0e, 0x23, 0x9d,
+    0x3a, 0x8c, 0x72, 0xe6, 0xc8, 0x89, 0x33, 0x07, 0x4e, 0x1c, 0x38, 0x6e, 0xde, 0xb4, 0x71, 0xc3,
+    0x66, 0x4d, 0x1b, 0x36, 0x69, 0xce, 0xa0, 0x39, 0x44, 0x63, 0x26, 0x8d, 0x99, 0x32, 0x67, 0xc8,
+    0x94, 0x79, 0x22, 0x23, 0x66, 0x4c, 0x98, 0x45, 0x31, 0x87, 0x61, 0xbe, 0x20, 0x7a, 0x39, 0xec,
+    0xe2, 0x05, 0xaa, 0xcb, 0x16, 0x2e, 0x51, 0x5a, 0xf2, 0x20, 0x1e, 0x4e, 0x49, 0x45, 0x41, 0x3d,
+    0x39, 0x01, 0x88, 0xaf, 0x34, 0x11, 0xbc, 0x52, 0x58, 0x58, 0xc5, 0x0a, 0x95, 0x2a, 0x52, 0xa6,
+    0x44, 0x81, 0x22, 0x25, 0x4a, 0x93, 0xc2, 0x26, 0x4c, 0x0a, 0x8b, 0x34, 0x31, 0x11, 0x14, 0x54,
+    0xb2, 0x04, 0x89, 0x12, 0x24, 0x5f, 0x84, 0x49, 0x78, 0x20, 0x29, 0x22, 0x58, 0x64, 0x88, 0x20,
+    0x11, 0x1e, 0x42, 0x88, 0x08, 0xf9, 0xa1, 0x34, 0x84, 0x0e, 0x0b, 0x8c, 0x06, 0xf9, 0xc1, 0x04,
+    0xa4, 0x07, 0xd4, 0x87, 0x90, 0xc0, 0x1f, 0x3d, 0x78, 0x34, 0x45, 0x99, 0xa0, 0x4f, 0x69, 0x0e,
+    0x1c, 0x49, 0x37, 0x70, 0x00, 0xde, 0xa8, 0x61, 0x83, 0xc6, 0x0c, 0x40, 0x19, 0x33, 0xbe, 0x32,
+    0x9a, 0x31, 0xac, 0x60, 0xf4, 0x59, 0xbd, 0x98, 0x57, 0x38, 0x5d, 0xb0, 0x58, 0xc1, 0x62, 0xc5,
+    0x1f, 0x0b, 0x15, 0x7f, 0x4b, 0xf4, 0x52, 0xf4, 0xe9, 0xa1, 0xe8, 0xe3, 0x51, 0x98, 0x38, 0xf1,
+    0x35, 0x51, 0x82, 0xc4, 0x97, 0xaf, 0x04, 0x5f, 0x1e, 0x1f, 0x22, 0x6f, 0x2f, 0xc4, 0x98, 0x1e,
+    0x44, 0xa2, 0x9d, 0xb7, 0xdf, 0xed, 0xee, 0x76, 0xbc, 0x0f, 0x1f, 0x4e, 0x70, 0xbb, 0x5c, 0x1d,
+    0x8f, 0xeb, 0x2e, 0xd7, 0x73, 0x0f, 0x78, 0xb8, 0x07, 0xfc, 0xa6, 0x83, 0xfc, 0xff, 0xde, 0xfe,
+    0x7f, 0x73, 0x69, 0x09, 0xed, 0xb9, 0x0e, 0x59, 0xdb, 0x8b, 0x58, 0x87, 0x2a, 0x87, 0x0d, 0x55,
+    0x0d, 0x1b, 0x30, 0xbc, 0xb9, 0x69, 0xc8, 0x40, 0xc5, 0x62, 0xb8, 0xb0, 0x47, 0xb5, 0x80, 0x46,
+    0x3d, 0x43, 0xfb, 0x86, 0x9d, 0x95, 0x99, 0x0d, 0x20, 0x1b, 0x13, 0x93, 0x30, 0x96, 0x18, 0x36,
+    0x85, 0xc0, 0xe5, 0x81, 0x03, 0x05, 0x5d, 0x0e, 0x4e, 0x34, 0xf8, 0xf2, 0x62, 0x00, 0xd6, 0x35,
+    0x00, 0x41, 0x82, 0xef, 0x01, 0x04, 0x7d, 0x58, 0x05, 0xa8, 0x08, 0x60, 0x09, 0x70, 0x06, 0xa0,
+    0xb2, 0xba, 0xf2, 0x6b, 0x56, 0xcd, 0x62, 0x80, 0x7a, 0xfc, 0x9d, 0x5d, 0x95, 0x2a, 0x16, 0xa6,
+    0x60, 0x00, 0xd6, 0xa7, 0x5a, 0x52, 0x94, 0xe4, 0x6c, 0x2e, 0x1b, 0x30, 0xbf, 0x12, 0x03, 0x07,
+    0x74, 0xe8, 0x34, 0xde, 0x69, 0xc6, 0x48, 0xff, 0xc7, 0x4c, 0x46, 0xfa, 0xff, 0x78, 0xf9, 0xe3,
+    0x39, 0x56, 0xc6, 0x32, 0xfc, 0x21, 0x93, 0x8f, 0xe4, 0x18, 0x8e, 0xe3, 0xf8, 0x47, 0x42, 0x46,
+    0xce, 0x8e, 0x1e, 0xfd, 0xaf, 0x2d, 0x47, 0x8c, 0x14, 0x35, 0x3a, 0xb1, 0x88, 0x11, 0xe3, 0x22,
+    0x44, 0x89, 0x10, 0x19, 0xca, 0x53, 0xc8, 0x50, 0x21, 0x42, 0x86, 0x06, 0x11, 0x0a, 0x04, 0xc8,
+    0xcf, 0x20, 0x41, 0x81, 0x04, 0xf5, 0x01, 0xf4, 0xc7, 0xcf, 0x1f, 0x3e, 0x7d, 0xf8, 0xe0, 0x69,
+    0xc4, 0xf3, 0xb8, 0xc7, 0xf1, 0x71, 0xcd, 0x1e, 0x47, 0x3d, 0x7a, 0xf2, 0x34, 0xde, 0xb9, 0x63,
+    0x87, 0xb1, 0x8e, 0x9d, 0xbd, 0x3a, 0x73, 0xe8, 0xcc, 0x91, 0x43, 0x27, 0x8e, 0x1c, 0x38, 0x71,
+    0xaa, 0x70, 0xde, 0xac, 0x71, 0xd3, 0xe6, 0x8d, 0x1b, 0x36, 0x6d, 0xd8, 0xa8, 0x49, 0x83, 0x46,
+    0xcd, 0x62, 0x1a, 0x34, 0x67, 0x16, 0xcd, 0x94, 0x39, 0x03, 0x68, 0x86, 0x4c, 0x99, 0x31, 0x64,
+    0x08, 0x8c, 0x09, 0x23, 0x86, 0x2c, 0x8c, 0x0e, 0x30, 0x8a, 0x5b, 0x60, 0x5c, 0x28, 0x26, 0x7e,
+    0xd1, 0x01, 0xc4, 0x07, 0xe2, 0x1f, 0x01, 0x2f, 0x88, 0x01, 0x87, 0xcc, 0xa8, 0xd3, 0x81, 0x9e,
+    0x48, 0x46, 0x4a, 0x92, 0x14, 0x96, 0x39, 0x73, 0x49, 0x19, 0x88, 0x89, 0x69, 0xdc, 0xca, 0xf3,
+    0xf3, 0x74, 0x48, 0x10, 0x94, 0xc9, 0x50, 0xc8, 0x22, 0xe2, 0x82, 0xc2, 0x82, 0xc2, 0xec, 0xff,
+    0x8c, 0x01, 0x1b, 0x3d, 0x5f, 0x13, 0xde, 0xb9, 0x0b, 0x3d, 0x73, 0x59, 0x30, 0x89, 0xbe, 0xf6,
+    0xd9, 0xe5, 0x55, 0xe6, 0x2d, 0xb8, 0x4f, 0xed, 0xdf, 0xd6, 0x8f, 0x62, 0x58, 0xa2, 0x85, 0x97,
+    0x30, 0x4a, 0x2c, 0x28, 0x9b, 0xee, 0xd4, 0xcb, 0x7c, 0x6d, 0xcf, 0x08, 0xf1, 0xca, 0x64, 0x5e,
+    0x1e, 0x65, 0x54, 0xae, 0xc3, 0xdd, 0x15, 0xd4, 0x30, 0x66, 0xe3, 0xfa, 0x96, 0x77, 0xcb, 0x59,
+    0xea, 0xe3, 0xc8, 0x85, 0x12, 0x9f, 0x91, 0x93, 0x1e, 0xd4, 0xd2, 0x21, 0x56, 0xf1, 0x9d, 0x00,
+    0xdf, 0x8a, 0xff, 0xaa, 0x5c, 0x17, 0x13, 0xf3, 0xa0, 0xaf, 0x86, 0xc5, 0x19, 0xe0, 0x99, 0xf9,
+    0x4a, 0xf6, 0x91, 0xdc, 0xad, 0x76, 0x90, 0x54, 0xe4, 0xda, 0x63, 0x4e, 0xff, 0xd6, 0xde, 0xc9,
+    0x33, 0xf5, 0xbe, 0x6c, 0x20, 0xcc, 0x54, 0xc2, 0x5c, 0x7d, 0xd2, 0x33, 0x35, 0x44, 0x44, 0xfd,
+    0xbe, 0xdc, 0x62, 0x86, 0xf3, 0x3f, 0xe4, 0xcb, 0x50, 0x61, 0xdc, 0x5c, 0x03, 0xed, 0x14, 0x9f,
+    0x01, 0xf9, 0xfc, 0xe1, 0x61, 0xf6, 0x51, 0x68, 0x2e, 0xe3, 0x58, 0xe8, 0x5c, 0x9e, 0x80, 0x4f,
+    0xe7, 0x3b, 0x60, 0x6a, 0x47, 0x87, 0x14, 0x68, 0x33, 0xfe, 0xd9, 0x6f, 0xf9, 0x01, 0xc0, 0x78,
+    0x0f, 0x1e, 0xab, 0x38, 0x16, 0x0b, 0x59, 0x7b, 0x97, 0x4c, 0xd8, 0x75, 0xe3, 0xab, 0xbf, 0x77,
+    0x05, 0x7c, 0x69, 0x12, 0x8b, 0xd0, 0xdb, 0x5b, 0x8e, 0x37, 0xfa, 0xe3, 0xdc, 0xd0, 0xbb, 0x29,
+    0xdd, 0xc5, 0xe1, 0x60, 0xc2, 0x19, 0x4e, 0xfa, 0x5d, 0xc7, 0x53, 0x68, 0x35, 0x14, 0xf8, 0x17,
+    0x9c, 0x36, 0xca, 0xf2, 0x4a, 0xc9, 0x79, 0x61, 0x23, 0x26, 0xcc, 0x19, 0xeb, 0x93, 0x9e, 0xa2,
+    0x8c, 0x71, 0x69, 0xb1, 0xd0, 0xe0, 0x12, 0x78, 0xfa, 0x85, 0x19, 0x3c, 0x33, 0x70, 0x1f, 0xb8,
+    0xdb, 0x80, 0x03, 0xc4, 0xb4, 0xd0, 0xc2, 0x1c, 0x6b, 0x94, 0x7e, 0x74, 0x05, 0xb9, 0xb7, 0x5c,
+    0xc4, 0xe2, 0x80, 0xdb, 0x70, 0xc2, 0x91, 0x57, 0x21, 0x99, 0xcb, 0xda, 0xeb, 0xb5, 0xa7, 0x64,
+    0x7e, 0xa9, 0x6a, 0x53, 0xca, 0xa5, 0x67, 0x0f, 0x45, 0x23, 0xd3, 0x45, 0xac, 0xdb, 0x3c, 0x07,
+    0xfc, 0xed, 0x41, 0x12, 0x6c, 0x24, 0x4c, 0x88, 0x04, 0x60, 0x9e, 0x31, 0xf7, 0xd7, 0x90, 0x9a,
+    0x8f, 0xbc, 0xc5, 0x02, 0x8e, 0x4d, 0xdc, 0x99, 0x77, 0xcd, 0x88, 0xd8, 0xe2, 0x6a, 0x6f, 0xb2,
+    0x1e, 0xe5, 0xa0, 0x88, 0xe9, 0x18, 0x0c, 0x82, 0xc2, 0x97, 0xaa, 0xe6, 0xc3, 0x7c, 0x52, 0x84,
+    0xbb, 0xde, 0x1a, 0xe2, 0xa3, 0x66, 0x73, 0x9c, 0x44, 0x34, 0xe3, 0xa1, 0x57, 0x86, 0xf4, 0x65,
+    0x0b, 0xd2, 0xa4, 0x44, 0xe2, 0x87, 0xf2, 0x2b, 0x2d, 0x4a, 0xce, 0xb9, 0x65, 0xf1, 0x3e, 0x97,
+    0x21, 0x0a, 0x73, 0x60, 0x04, 0x47, 0x8a, 0x76, 0xd7, 0x72, 0x30, 0x2a, 0x26, 0xcd, 0x85, 0xf6,
+    0x16, 0xbe, 0x7e, 0x9a, 0xe4, 0x09, 0x16, 0x09, 0xb2, 0x40, 0x51, 0xd2, 0x72, 0xc8, 0x72, 0xe0,
+    0x4e, 0xd5, 0x3f, 0x6c, 0xae, 0xbd, 0xed, 0xf2, 0x9a, 0xf5, 0x75, 0xa4, 0x32, 0xb1, 0x0f, 0xee,
+    0x46, 0x19, 0x0a, 0x48, 0x98, 0xf4, 0xd9, 0x95, 0x52, 0xfa, 0xfc, 0x13, 0x32, 0xa2, 0x7f, 0xe2,
+    0x35, 0xe7, 0x5b, 0x32, 0x08, 0x50, 0x75, 0xa5, 0x25, 0x94, 0xc5, 0x30, 0x58, 0x3a, 0xaf, 0xb5,
+    0x1e, 0x4f, 0xc5, 0xe7, 0x5c, 0x0e, 0x65, 0x18, 0xfe, 0x7b, 0xc8, 0x80, 0x2b, 0x96, 0x71, 0x7d,
+    0x9f, 0xc2, 0x78, 0x4a, 0x21, 0x2f, 0xe1, 0xf0, 0x84, 0x83, 0xea, 0x5d, 0xd9, 0x5b, 0x78, 0x05,
+    0xd9, 0xfa, 0xbc, 0xe9, 0x80, 0xaa, 0x41, 0xb8, 0xc2, 0x11, 0xfd, 0x9b, 0x66, 0x04, 0x8f, 0x4d,
+    0x59, 0x4f, 0xde, 0xb4, 0xdf, 0x5f, 0x33, 0xf1, 0x74, 0xd0, 0xd8, 0x1c, 0xeb, 0xa3, 0x83, 0x5a,
+    0xb6, 0x88, 0xcb, 0xf3, 0x9e, 0xdc, 0x5c, 0xc1, 0x2d, 0xdb, 0x57, 0x0a, 0x53, 0x8c, 0x79, 0x38,
+    0xa4, 0xa3, 0xc5, 0x2c, 0xb0, 0x8b, 0xcf, 0x35, 0x48, 0xf6, 0xc5, 0xd3, 0x87, 0x39, 0x3f, 0x99,
+    0x96, 0xdc, 0x75, 0xd9, 0xe1, 0x6a, 0xea, 0x62, 0x32, 0x3c, 0x72, 0x39, 0xb3, 0x72, 0x7d, 0xa2,
+    0x95, 0x5c, 0xc9, 0x2e, 0xe7, 0xec, 0x25, 0x7c, 0x7b, 0x73, 0x01, 0xf2, 0x29, 0x76, 0xb1, 0x9a,
+    0x93, 0x62, 0x7f, 0xd2, 0xbf, 0x3a, 0x4b, 0xc6, 0x7c, 0xdd, 0x58, 0x6c, 0xde, 0xf1, 0x32, 0x4f,
+    0x3d, 0xdc, 0xd6, 0xc3, 0xb8, 0x4e, 0x8d, 0xf4, 0x10, 0xea, 0xde, 0x0e, 0x3d, 0x88, 0xac, 0x70,
+    0xfd, 0x08, 0x0f, 0x8d, 0xfe, 0xdd, 0xfb, 0x8b, 0xbe, 0x98, 0xac, 0x44, 0xf7, 0xfe, 0x7c, 0x42,
+    0x2e, 0xeb, 0x89, 0xe9, 0x00, 0x2a, 0x6e, 0xce, 0x66, 0xc8, 0x3f, 0x96, 0xed, 0xc1, 0x7f, 0x96,
+    0xee, 0x7f, 0x12, 0x0b, 0xfe, 0x8a, 0x7f, 0xea, 0x48, 0x77, 0x42, 0x2a, 0xda, 0xff, 0xbc, 0x6b,
+    0x9e, 0x53, 0x4f, 0x7a, 0x92, 0x3c, 0x7d, 0x46, 0xbf, 0x2e, 0x47, 0xce, 0x49, 0x3f, 0x8c, 0x46,
+    0xbd, 0x81, 0xf7, 0xe2, 0xcb, 0xde, 0x4d, 0x5f, 0x7c, 0xdd, 0x9b, 0xf9, 0x7b, 0xce, 0xba, 0x21,
+    0x33, 0xdd, 0x75, 0xe6, 0xd0, 0x83, 0x16, 0x7b, 0xd5, 0x6b, 0x18, 0x87, 0x71, 0x38, 0x86, 0xe3,
+    0x30, 0x0e, 0xc7, 0x70, 0x9c, 0x52, 0x50, 0x7e, 0x0e, 0x26, 0x1c, 0xd4, 0x21, 0x14, 0x10, 0x00,
+    0xe8, 0x23, 0xf6, 0xd5, 0x97, 0xdf, 0xbb, 0xbe, 0x76, 0xb5, 0x2b, 0x36, 0x1f, 0x58, 0x08, 0x5c,
+    0x06, 0x33, 0xde, 0x01, 0xeb, 0xcb, 0x58, 0x73, 0x5c, 0xbe, 0x99, 0xf4, 0xac, 0x1f, 0x26, 0x23,
+    0xa0, 0x62, 0x3a, 0xfb, 0xff, 0xbd, 0x2c, 0xa2, 0xb0, 0xb1, 0x2b, 0xa6, 0x34, 0x17, 0xd4, 0x6d,
+    0xe0, 0x64, 0xa7, 0x49, 0xce, 0x4c, 0xdd, 0x8e, 0xa9, 0xe8, 0x79, 0x4b, 0xc9, 0xe4, 0xbe, 0xe0,
+    0x2b, 0x2f, 0xee, 0xc6, 0x59, 0xb9, 0x90, 0x79, 0x7c, 0x66, 0xd9, 0x7f, 0x70, 0x11, 0x17, 0xf8,
+    0x19, 0x8c, 0xd8, 0x3a, 0xbc, 0x55, 0xad, 0xfb, 0x4b, 0xda, 0xcd, 0x5e, 0x96, 0xef, 0x8b, 0xfb,
+    0x5b, 0x2a, 0x5d, 0x3d, 0x6c, 0xa1, 0x51, 0x1a, 0x61, 0xdf, 0x2a, 0x69, 0xdd, 0xa2, 0x1f, 0xfa,
+    0xf1, 0xd3, 0x01, 0xa1, 0x15, 0x4b, 0x9f, 0x4b, 0x5d, 0xc8, 0xdb, 0x50, 0xcf, 0xc3, 0x54, 0x9e,
+    0x5d, 0x35, 0x14, 0x54, 0x7c, 0xf8, 0xcf, 0xe1, 0x67, 0xfb, 0xf6, 0xc9, 0xac, 0xb8, 0x4c, 0x49,
+    0x7d, 0x82, 0x8e, 0x36, 0x15, 0x18, 0x87, 0xb3, 0x48, 0x89, 0x41, 0x6b, 0x1e, 0x42, 0xa8, 0xe9,
+    0x39, 0x3d, 0x88, 0xc2, 0xbe, 0xe8, 0x21, 0xed, 0x72, 0x53, 0x59, 0xc9, 0xb4, 0xee, 0x40, 0x6f,
+    0x4a, 0xeb, 0x65, 0x4e, 0x41, 0x1c, 0xf4, 0x81, 0xbb, 0x4a, 0x16, 0x23, 0x81, 0xbe, 0x2d, 0x11,
+    0x71, 0x43, 0xf0, 0x3a, 0x2f, 0xf1, 0x43, 0xe6, 0x9b, 0x3b, 0xc2, 0xaa, 0xfa, 0xe8, 0x8d, 0xf7,
+    0x6c, 0x4f, 0xb9, 0x41, 0xfa, 0xba, 0x1c, 0xc7, 0x8e, 0xfb, 0x66, 0xe0, 0xe3, 0xf0, 0x41, 0x3d,
+    0x4c, 0x32, 0xb9, 0x7f, 0x11, 0xad, 0x81, 0xd2, 0x69, 0xf1, 0xbb, 0xcd, 0xf5, 0xc9, 0x46, 0x6b,
+    0x69, 0xe0, 0x74, 0x9c, 0xcf, 0x75, 0xfd, 0x17, 0x72, 0xda, 0xca, 0x1f, 0x09, 0x84, 0x36, 0xc4,
+    0x7b, 0x87, 0x16, 0xb6, 0xaf, 0x7b, 0x75, 0xc0, 0x7d, 0x42, 0x56, 0x85, 0xd5, 0xb7, 0xcc, 0xca,
+    0x3c, 0x31, 0x97, 0x62, 0xeb, 0xf9, 0x86, 0x9f, 0x4b, 0xf5, 0x30, 0x3a, 0xa5, 0x9d, 0x44, 0xee,
+    0x69, 0xc4, 0xdc, 0x26, 0x40, 0xa6, 0x10, 0x3e, 0x72, 0xec, 0x86, 0xe9, 0xf2, 0xd3, 0x90, 0x86,
+    0x8e, 0x3d, 0x95, 0xb9, 0x7d, 0xae, 0xd8, 0x18, 0x4c, 0x65, 0xc2, 0xb2, 0xb9, 0x1f, 0x69, 0x0d,
+    0x6d, 0x75, 0x9b, 0x53, 0x84, 0xa7, 0xf4, 0xbe, 0xb5, 0xf1, 0xa6, 0x4f, 0x2f, 0x40, 0x48, 0xe6,
+    0xa7, 0x50, 0xef, 0xf1, 0xf6, 0x55, 0xbb, 0x36, 0xb1, 0xf6, 0xcb, 0x33, 0x8c, 0x48, 0x19, 0xad,
+    0xc5, 0xa2, 0x77, 0x66, 0x03, 0x70, 0x63, 0x70, 0x21, 0xd6, 0x05, 0xba, 0x8f, 0x3a, 0x4e, 0x2d,
+    0xdf, 0xab, 0xd3, 0xc1, 0x3e, 0x81, 0xa5, 0x91, 0x37, 0x9b, 0x47, 0x98, 0xf7, 0x8f, 0xf2, 0x9c,
+    0xe9, 0x4c, 0xa6, 0x41, 0x4c, 0xdc, 0xbd, 0xcd, 0x92, 0x7c, 0x97, 0xa9, 0x4f, 0x32, 0xb6, 0x9b,
+    0x72, 0x10, 0x79, 0x7c, 0xfb, 0xab, 0x90, 0x72, 0xa3, 0x82, 0xfe, 0xb3, 0xe6, 0x07, 0xdb, 0xa2,
+    0x12, 0x91, 0xf9, 0x03, 0xd3, 0x8e, 0x1e, 0x93, 0x87, 0xc2, 0x41, 0xcb, 0x5e, 0x37, 0x84, 0x77,
+    0xe5, 0xcb, 0x2c, 0xfb, 0x70, 0xb0, 0x59, 0x74, 0x11, 0x3c, 0x11, 0x07, 0x3b, 0xbe, 0x56, 0xa8,
+    0x4f, 0x3e, 0x34, 0xaa, 0xf0, 0x5a, 0xd1, 0x21, 0x74, 0x76, 0x24, 0xa4, 0x21, 0x28, 0xab, 0x7b,
+    0x7b, 0x77, 0x3c, 0x66, 0x5e, 0xa3, 0x4c, 0xe4, 0x38, 0xc6, 0xf7, 0xc8, 0x8e, 0x39, 0x32, 0x02,
+    0x19, 0x34, 0xf4, 0x4c, 0xee, 0xe7, 0x3e, 0x44, 0xb2, 0x1b, 0xf8, 0xea, 0x84, 0xf2, 0x4d, 0x34,
+    0xe4, 0xdd, 0xc1, 0xf7, 0xfa, 0x66, 0xca, 0x9e, 0x3b, 0xfb, 0x6f, 0xdc, 0x3a, 0x2c, 0x90, 0x20,
+    0x99, 0xbb, 0x08, 0xf9, 0xcc, 0x19, 0x58, 0x60, 0xdf, 0x01, 0x38, 0xc2, 0x55, 0x86, 0xf6, 0x66,
+    0x8c, 0xfa, 0xfa, 0xae, 0x0f, 0xf0, 0xbf, 0xd5, 0xe4, 0xc1, 0xcd, 0xad, 0xb0, 0xb2, 0x3d, 0xa9,
+    0xfb, 0x11, 0x43, 0xff, 0x5b, 0xbe, 0x7a, 0xd2, 0x89, 0xed, 0x04, 0xf3, 0x27, 0x5c, 0xee, 0x7f,
+    0x7d, 0x3a, 0x0c, 0x04, 0x20, 0x95, 0x97, 0xe6, 0x67, 0xd4, 0x00, 0x9f, 0x55, 0xd0, 0x12, 0x6d,
+    0x70, 0xbd, 0xf1, 0xa9, 0x2d, 0x5b, 0xf0, 0xbb, 0x4a, 0x82, 0x7a, 0x9c, 0x01, 0x19, 0xab, 0x91,
+    0x8d, 0x21, 0x85, 0x69, 0x9e, 0xc3, 0xb9, 0x8c, 0xf8, 0x18, 0x15, 0xe9, 0x51, 0x2c, 0xc4, 0xc7,
+    0xa8, 0x50, 0xd4, 0x7c, 0x94, 0x4c, 0x68, 0xb9, 0x1c, 0x93, 0x30, 0xbb, 0x78, 0xd8, 0xf4, 0x9c,
+    0xfc, 0x78, 0x66, 0x58, 0x78, 0x3e, 0x35, 0x7b, 0x73, 0xf2, 0x89, 0x8a, 0xc8, 0xf2, 0x8b, 0xc5,
+    0xda, 0xbe, 0xb0, 0xd8, 0xdb, 0xa9, 0x0f, 0x97, 0x9c, 0xb9, 0x1d, 0xd1, 0x81, 0x61, 0x23, 0xa8,
+    0xfc, 0x23, 0x36, 0x08, 0x05, 0xed, 0xec, 0x58, 0xdf, 0xf2, 0x13, 0xf9, 0x4d, 0xfe, 0xbb, 0xe8,
+    0xd4, 0x08, 0xef, 0xd8, 0x1e, 0xed, 0x7d, 0xf7, 0xe7, 0xec, 0x81, 0x66, 0x2c, 0xee, 0x5a, 0x86,
+    0xc6, 0xa0, 0xbe, 0x7c, 0xcf, 0xe0, 0xa8, 0x92, 0x37, 0xdc, 0x37, 0xf8, 0xe5, 0x3c, 0x5f, 0xdd,
+    0xac, 0x1e, 0xb3, 0x8e, 0x3b, 0x88, 0x27, 0xc6, 0x17, 0x23, 0x74, 0x7c, 0xa4, 0x68, 0x9d, 0x26,
+    0x8e, 0xd0, 0x2c, 0x66, 0x7e, 0x7e, 0x6d, 0xcf, 0xfb, 0xe2, 0x3c, 0xde, 0x68, 0xed, 0x6a, 0x05,
+    0x37, 0x21, 0xec, 0x97, 0x61, 0xb0, 0x22, 0x92, 0x58, 0x8d, 0x07, 0xd4, 0x7c, 0x62, 0xa6, 0x3f,
+    0x6f, 0x56, 0xd4, 0xdd, 0x87, 0x7d, 0x40, 0x14, 0xeb, 0x4e, 0xb5, 0x3c, 0x33, 0xe9, 0x9d, 0x2d,
+    0xa7, 0xeb, 0x48, 0xe2, 0xd7, 0x1f, 0xc0, 0x26, 0xe1, 0x7c, 0x5e, 0x30, 0xc6, 0x88, 0x46, 0x2b,
+    0xb3, 0xd3, 0xcf, 0x69, 0x71, 0xea, 0x89, 0x43, 0xb1, 0xe0, 0x49, 0xee, 0xb6, 0x04, 0x4c, 0x8e,
+    0x17, 0x6d, 0x38, 0x49, 0x63, 0x65, 0xd6, 0x9a, 0x23, 0x2d, 0x89, 0x28, 0xd8, 0x44, 0xbd, 0x5a,
+    0x75, 0xc7, 0xb8, 0xf5, 0x41, 0xf3, 0x7f, 0x33, 0xa2, 0x1c, 0xab, 0xa7, 0x43, 0x3c, 0x75, 0xe7,
+    0x11, 0xc3, 0x56, 0x24, 0xdf, 0x2f, 0x0d, 0x04, 0x89, 0x28, 0xf1, 0x40, 0xdc, 0x5d, 0xe9, 0xf4,
+    0xe8, 0xe8, 0xe9, 0x17, 0xd1, 0xd0, 0xa3, 0xd1, 0x51, 0x54, 0xd8, 0x39, 0x8b, 0xe8, 0xa8, 0x51,
+    0xd1, 0x71, 0x57, 0x68, 0x5c, 0x98, 0xd6, 0x40, 0x7f, 0x33, 0x8e, 0x94, 0x60, 0xf8, 0x25, 0xb2,
+    0x3c, 0xbe, 0x11, 0xbf, 0xd5, 0x45, 0x08, 0x06, 0xf3, 0xb5, 0x46, 0xb7, 0x01, 0x06, 0x97, 0x9d,
+    0x87, 0xc2, 0x7d, 0x38, 0xb3, 0x70, 0xa4, 0x39, 0x94, 0xdf, 0x9c, 0xbb, 0x71, 0x59, 0x5b, 0x5d,
+    0xdf, 0xa7, 0xd9, 0x78, 0xf8, 0x83, 0xde, 0xfe, 0x43, 0xb5, 0x62, 0x31, 0xf6, 0x4d, 0x16, 0x5d,
+    0x4e, 0x71, 0xe7, 0xf6, 0x43, 0x61, 0x66, 0x3d, 0xd1, 0x92, 0xe2, 0xc4, 0x36, 0x41, 0x64, 0xbb,
+    0xbc, 0x86, 0x9b, 0x01, 0x74, 0xa1, 0xd0, 0x7e, 0x36, 0x13, 0x5c, 0x8e, 0xe7, 0xd0, 0x24, 0x3e,
+    0xb0, 0x60, 0xfe, 0x26, 0x45, 0x4e, 0x9b, 0xfa, 0x57, 0xe8, 0x90, 0xa6, 0x4d, 0x76, 0x7f, 0x37,
+    0x27, 0x59, 0xab, 0x4c, 0x64, 0x4c, 0xfc, 0x86, 0x28, 0xdb, 0xc0, 0x98, 0x6e, 0x35, 0x98, 0x17,
+    0xf7, 0xbd, 0xb0, 0x88, 0xb0, 0xad, 0xbf, 0xb0, 0x43, 0x81, 0x32, 0xf7, 0x1c, 0x95, 0x55, 0x50,
+    0x1a, 0xcb, 0x5e, 0x7d, 0xbb, 0xa5, 0xda, 0x86, 0x16, 0x9f, 0xa6, 0x51, 0x97, 0xf1, 0x39, 0x59,
+    0x01, 0x1a, 0xf7, 0xec, 0x5f, 0x49, 0x7d, 0xfe, 0x3c, 0x92, 0x3f, 0xe0, 0x3c, 0x42, 0xf8, 0x0d,
+    0xd8, 0x64, 0x84, 0x66, 0xf0, 0x47, 0x6c, 0xf2, 0x2e, 0x0c, 0xaf, 0x69, 0x19, 0xed, 0x8b, 0x6e,
+    0x9b, 0xb8, 0xe7, 0xcf, 0xba, 0x92, 0x90, 0xcf, 0x4f, 0xfd, 0x45, 0x94, 0x8f, 0xb5, 0xf0, 0xfd,
+    0xfe, 0xc2, 0x70, 0x0b, 0x45, 0x78, 0x45, 0x75, 0x03, 0x1f, 0xf3, 0xdf, 0x47, 0xcb, 0x43, 0xc9,
+    0x05, 0x35, 0xfd, 0xda, 0x79, 0x5d, 0x72, 0x36, 0x1c, 0xfb, 0xfc, 0xf3, 0x51, 0x70, 0x8f, 0x97,
+    0xa7, 0x08, 0x96, 0x77, 0xa9, 0xb9, 0xaf, 0x60, 0xab, 0x75, 0x42, 0x6f, 0x27, 0x66, 0xa4, 0x4b,
+    0x7b, 0x45, 0x39, 0x25, 0x66, 0x42, 0x70, 0xdb, 0x5d, 0x39, 0xed, 0xe0, 0xfd, 0xe0, 0xf5, 0x0c,
+    0x87, 0xae, 0x75, 0x77, 0x87, 0x79, 0xce, 0xbc, 0x79, 0x02, 0x58, 0x87, 0x2e, 0x5a, 0xb9, 0x3a,
+    0xdc, 0xfd, 0x46, 0x13, 0x91, 0xf4, 0x62, 0xa3, 0x39, 0xb4, 0x68, 0xb8, 0xab, 0xf7, 0xe3, 0x39,
+    0xfd, 0x47, 0xe2, 0x65, 0x99, 0x01, 0x9a, 0x6c, 0x4c, 0x01, 0x25, 0x1c, 0xbf, 0xd1, 0x94, 0x5a,
+    0xc1, 0xef, 0xf1, 0xcd, 0x24, 0x80, 0x0f, 0x19, 0xf6, 0x85, 0x65, 0xa9, 0xb1, 0xf6, 0xe5, 0x81,
+    0x33, 0x15, 0xb6, 0xfe, 0x4e, 0x94, 0x88, 0xa5, 0xcd, 0x5a, 0x55, 0xb4, 0xfd, 0x1d, 0xf7, 0x8f,
+    0xbd, 0x11, 0x2a, 0x1d, 0x18, 0x68, 0xfb, 0x33, 0xfd, 0xc6, 0x0f, 0x77, 0x0e, 0xb6, 0xcc, 0xab,
+    0x7b, 0xf4, 0xc5, 0xfb, 0x6a, 0xee, 0x8d, 0x21, 0xac, 0xd8, 0xa7, 0x72, 0x3f, 0x1f, 0xf5, 0x25,
+    0x5a, 0xc2, 0x1e, 0xec, 0x9c, 0x5a, 0x75, 0x95, 0xb4, 0xf7, 0x49, 0xe0, 0xaa, 0x1f, 0x4c, 0xff,
+    0xa2, 0x47, 0x99, 0x1a, 0x2c, 0x55, 0x73, 0x62, 0xbf, 0xd6, 0xca, 0xc5, 0xdf, 0x3d, 0x6d, 0xbc,
+    0x0a, 0x30, 0xf6, 0x29, 0x0a, 0xdc, 0x8f, 0xb1, 0x97, 0xbd, 0xa9, 0x4c, 0x41, 0xce, 0x35, 0xdf,
+    0xf9, 0x13, 0xe4, 0x18, 0x7a, 0xbe, 0x98, 0x04, 0x89, 0xa6, 0x73, 0xa6, 0x79, 0x06, 0xaa, 0x3a,
+    0xd9, 0x5e, 0xc5, 0x25, 0xaa, 0xef, 0x67, 0x7a, 0x83, 0xf8, 0x45, 0x9b, 0x7c, 0xfb, 0x46, 0xbc,
+    0x05, 0xee, 0x19, 0x8d, 0xa5, 0x0f, 0x38, 0xc2, 0x2d, 0x0a, 0xba, 0xe0, 0x43, 0x59, 0xf4, 0xa3,
+    0xf2, 0x22,
 };
+const ShaderModule Blob074 = { Blob074_Data, 4306u, 4125u, 74u };
 
-extern const uint32_t Blob112[4133];
-const uint32_t Blob112[4133] = {
-    0x07230203, 0x00010300, 0x0008000b, 0x0000021f, 0x00000000, 0x00020011, 0x00000001, 0x00020011,
-    0x0000002e, 0x0006000b, 0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e,
-    0x00000000, 0x00000001, 0x0006000f, 0x00000005, 0x00000004, 0x6e69616d, 0x00000000, 0x00000104,
-    0x00060010, 0x00000004, 0x00000011, 0x00000040, 0x00000001, 0x00000001, 0x00030003, 0x00000002,
-    0x000001c2, 0x000a0004, 0x475f4c47, 0x4c474f4f, 0x70635f45, 0x74735f70, 0x5f656c79, 0x656e696c,
-    0x7269645f, 0x69746365, 0x00006576, 0x00080004, 0x475f4c47, 0x4c474f4f, 0x6e695f45, 0x64756c63,
-    0x69645f65, 0x74636572, 0x00657669, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000, 0x000a0005,
-    0x0000000e, 0x65766f43, 0x65676172, 0x656c6954, 0x65786950, 0x3175286c, 0x3b31753b, 0x753b3175,
-    0x00003b31, 0x00060005, 0x0000000a, 0x796c6f70, 0x496e6f67, 0x7865646e, 0x00000000, 0x00030005,
-    0x0000000b, 0x00000078, 0x00030005, 0x0000000c, 0x00000079, 0x00050005, 0x0000000d, 0x656c6974,
-    0x65786950, 0x0000006c, 0x000a0005, 0x00000014, 0x65766f43, 0x65676172, 0x41736157, 0x70656363,
-    0x28646574, 0x753b3175, 0x31753b31, 0x0000003b, 0x00060005, 0x00000011, 0x796c6f70, 0x496e6f67,
-    0x7865646e, 0x00000000, 0x00030005, 0x00000012, 0x00000078, 0x00030005, 0x00000013, 0x00000079,
-    0x000b0005, 0x0000001b, 0x74697257, 0x6e695765, 0x676e696e, 0x65766f43, 0x65676172, 0x3b317528,
-    0x753b3175, 0x31753b31, 0x0000003b, 0x00060005, 0x00000017, 0x796c6f70, 0x496e6f67, 0x7865646e,
-    0x00000000, 0x00030005, 0x00000018, 0x00000078, 0x00030005, 0x00000019, 0x00000079, 0x00050005,
-    0x0000001a, 0x65766f63, 0x65676172, 0x00000000, 0x00040005, 0x0000001d, 0x656c6974, 0x00000058,
-    0x00040005, 0x00000021, 0x656c6974, 0x00000059, 0x00050005, 0x00000024, 0x656e696c, 0x69547261,
-    0x0000656c, 0x00050005, 0x00000028, 0x65726353, 0x69576e65, 0x00687464, 0x00060005, 0x0000002a,
-    0x656c6954, 0x72655073, 0x656e694c, 0x00000000, 0x00060005, 0x0000002f, 0x61636f6c, 0x6c6f506c,
-    0x6e6f6779, 0x00000000, 0x00060005, 0x00000031, 0x68737550, 0x736e6f43, 0x746e6174, 0x00000073,
-    0x00060006, 0x00000031, 0x00000000, 0x56727543, 0x61697261, 0x0000746e, 0x00060006, 0x00000031,
-    0x00000001, 0x57786554, 0x68746469, 0x00000000, 0x00060006, 0x00000031, 0x00000002, 0x48786554,
-    0x68676965, 0x00000074, 0x00060006, 0x00000031, 0x00000003, 0x57786554, 0x53706172, 0x00000000,
-    0x00060006, 0x00000031, 0x00000004, 0x57786554, 0x54706172, 0x00000000, 0x00070006, 0x00000031,
-    0x00000005, 0x49786554, 0x70614373, 0x65727574, 0x00000000, 0x00070006, 0x00000031, 0x00000006,
-    0x74706143, 0x59657275, 0x7366664f, 0x00007465, 0x00050006, 0x00000031, 0x00000007, 0x6461705f,
-    0x00000000, 0x00030005, 0x00000033, 0x00006370, 0x00040005, 0x00000039, 0x756f7267, 0x00000070,
-    0x00030005, 0x0000003d, 0x00746962, 0x00050005, 0x00000041, 0x6b73616d, 0x65646e49, 0x00000078,
-    0x00040005, 0x00000047, 0x6b73616d, 0x00000000, 0x00060005, 0x0000004e, 0x526e6942, 0x6c757365,
-    0x66754274, 0x00726566, 0x00080006, 0x0000004e, 0x00000000, 0x69726156, 0x57746e61, 0x436b726f,
-    0x746e756f, 0x00000000, 0x00080006, 0x0000004e, 0x00000001, 0x74726f53, 0x6f576465, 0x664f6b72,
-    0x74657366, 0x00000000, 0x00090006, 0x0000004e, 0x00000002, 0x69726156, 0x57746e61, 0x526b726f,
-    0x436c6165, 0x746e756f, 0x00000000, 0x00080006, 0x0000004e, 0x00000003, 0x74726f53, 0x6b726f57,
-    0x6b726f57, 0x6e756f43, 0x00000074, 0x00090006, 0x0000004e, 0x00000004, 0x6e6e6942, 0x4d676e69,
-    0x416b7361, 0x664f646e, 0x74657366, 0x00000000, 0x00030005, 0x00000050, 0x00000000, 0x00060005,
-    0x00000052, 0x65726353, 0x65486e65, 0x74686769, 0x00000000, 0x00050005, 0x00000053, 0x656c6954,
-    0x656e694c, 0x00000073, 0x00070005, 0x00000057, 0x6e6e6942, 0x4d676e69, 0x536b7361, 0x74726174,
-    0x00000000, 0x00050005, 0x00000068, 0x65776f6c, 0x73614d72, 0x0000006b, 0x00040005, 0x00000073,
-    0x6964726f, 0x006c616e, 0x00050005, 0x00000079, 0x6b726f77, 0x65646e49, 0x00000078, 0x00080005,
-    0x0000007d, 0x6e6e6942, 0x57676e69, 0x4f6b726f, 0x65736666, 0x74537374, 0x00747261, 0x00060005,
-    0x00000086, 0x5778614d, 0x546b726f, 0x73656c69, 0x00000000, 0x00050005, 0x0000008c, 0x656c6974,
-    0x656e6e49, 0x00000072, 0x00050005, 0x0000009b, 0x656c6974, 0x65786950, 0x0000006c, 0x00040005,
-    0x0000009c, 0x61726170, 0x0000006d, 0x00040005, 0x0000009e, 0x61726170, 0x0000006d, 0x00040005,
-    0x000000a0, 0x61726170, 0x0000006d, 0x00040005, 0x000000a2, 0x61726170, 0x0000006d, 0x00060005,
-    0x000000a8, 0x6f6c6f43, 0x6c695472, 0x66754265, 0x00726566, 0x00060006, 0x000000a8, 0x00000000,
-    0x6f6c6f43, 0x6c695472, 0x00007365, 0x00030005, 0x000000aa, 0x00000000, 0x00060005, 0x000000b3,
-    0x72747441, 0x656c6954, 0x66667542, 0x00007265, 0x00060006, 0x000000b3, 0x00000000, 0x72747441,
-    0x656c6954, 0x00000073, 0x00030005, 0x000000b5, 0x00000000, 0x00040005, 0x000000bf, 0x65786970,
-    0x0000006c, 0x00040005, 0x000000c5, 0x67726174, 0x00007465, 0x00070005, 0x000000c8, 0x75736552,
-    0x6957746c, 0x72656e6e, 0x66667542, 0x00007265, 0x00070006, 0x000000c8, 0x00000000, 0x75736552,
-    0x6957746c, 0x72656e6e, 0x00000000, 0x00030005, 0x000000ca, 0x00000000, 0x00070005, 0x000000d4,
-    0x6d617246, 0x66756265, 0x53726566, 0x64697274, 0x00000065, 0x00040005, 0x000000e5, 0x72747461,
-    0x00000000, 0x00060005, 0x000000e7, 0x75736552, 0x7542746c, 0x72656666, 0x00000000, 0x00060006,
-    0x000000e7, 0x00000000, 0x75736552, 0x6156746c, 0x0065756c, 0x00030005, 0x000000e9, 0x00000000,
-    0x00070005, 0x000000ed, 0x75736552, 0x6544746c, 0x53687470, 0x74726174, 0x00000000, 0x00060005,
-    0x000000f1, 0x75736552, 0x7441746c, 0x74537274, 0x00747261, 0x00050005, 0x00000101, 0x75746573,
-    0x646e4970, 0x00007865, 0x00080005, 0x00000104, 0x475f6c67, 0x61626f6c, 0x766e496c, 0x7461636f,
-    0x496e6f69, 0x00000044, 0x00040005, 0x00000110, 0x75746573, 0x00000070, 0x00060005, 0x00000113,
-    0x75746553, 0x646e4970, 0x73656369, 0x00000000, 0x00060005, 0x00000118, 0x796c6f70, 0x496e6f67,
-    0x7865646e, 0x00000000, 0x00050005, 0x0000012e, 0x61705358, 0x7465536e, 0x00007075, 0x00040006,
-    0x0000012e, 0x00000000, 0x00003058, 0x00040006, 0x0000012e, 0x00000001, 0x00003158, 0x00060006,
-    0x0000012e, 0x00000002, 0x69736e49, 0x74536564, 0x00747261, 0x00060006, 0x0000012e, 0x00000003,
-    0x69736e49, 0x6e456564, 0x00000064, 0x00060006, 0x0000012e, 0x00000004, 0x65676445, 0x4c766f43,
-    0x00000000, 0x00060006, 0x0000012e, 0x00000005, 0x65676445, 0x52766f43, 0x00000000, 0x00050006,
-    0x0000012e, 0x00000006, 0x63655258, 0x00007069, 0x00050006, 0x0000012e, 0x00000007, 0x67616c46,
-    0x00000073, 0x00040006, 0x0000012e, 0x00000008, 0x0000305a, 0x00040006, 0x0000012e, 0x00000009,
-    0x0000315a, 0x00040006, 0x0000012e, 0x0000000a, 0x00003057, 0x00040006, 0x0000012e, 0x0000000b,
-    0x00003157, 0x00050006, 0x0000012e, 0x0000000c, 0x6f6c6f43, 0x00305272, 0x00050006, 0x0000012e,
-    0x0000000d, 0x6f6c6f43, 0x00304772, 0x00050006, 0x0000012e, 0x0000000e, 0x6f6c6f43, 0x00304272,
-    0x00050006, 0x0000012e, 0x0000000f, 0x6f6c6f43, 0x00315272, 0x00050006, 0x0000012e, 0x00000010,
-    0x6f6c6f43, 0x00314772, 0x00050006, 0x0000012e, 0x00000011, 0x6f6c6f43, 0x00314272, 0x00060006,
-    0x0000012e, 0x00000012, 0x63786554, 0x64726f6f, 0x00003055, 0x00060006, 0x0000012e, 0x00000013,
-    0x63786554, 0x64726f6f, 0x00003056, 0x00060006, 0x0000012e, 0x00000014, 0x63786554, 0x64726f6f,
-    0x00003155, 0x00060006, 0x0000012e, 0x00000015, 0x63786554, 0x64726f6f, 0x00003156, 0x00060006,
-    0x0000012e, 0x00000016, 0x4c766f43, 0x74696e49, 0x006c6169, 0x00060006, 0x0000012e, 0x00000017,
-    0x52766f43, 0x74696e49, 0x006c6169, 0x00040005, 0x00000130, 0x6e617073, 0x00000000, 0x00050005,
-    0x00000131, 0x61705358, 0x7465536e, 0x00007075, 0x00040006, 0x00000131, 0x00000000, 0x00003058,
-    0x00040006, 0x00000131, 0x00000001, 0x00003158, 0x00060006, 0x00000131, 0x00000002, 0x69736e49,
-    0x74536564, 0x00747261, 0x00060006, 0x00000131, 0x00000003, 0x69736e49, 0x6e456564, 0x00000064,
-    0x00060006, 0x00000131, 0x00000004, 0x65676445, 0x4c766f43, 0x00000000, 0x00060006, 0x00000131,
-    0x00000005, 0x65676445, 0x52766f43, 0x00000000, 0x00050006, 0x00000131, 0x00000006, 0x63655258,
-    0x00007069, 0x00050006, 0x00000131, 0x00000007, 0x67616c46, 0x00000073, 0x00040006, 0x00000131,
-    0x00000008, 0x0000305a, 0x00040006, 0x00000131, 0x00000009, 0x0000315a, 0x00040006, 0x00000131,
-    0x0000000a, 0x00003057, 0x00040006, 0x00000131, 0x0000000b, 0x00003157, 0x00050006, 0x00000131,
-    0x0000000c, 0x6f6c6f43, 0x00305272, 0x00050006, 0x00000131, 0x0000000d, 0x6f6c6f43, 0x00304772,
-    0x00050006, 0x00000131, 0x0000000e, 0x6f6c6f43, 0x00304272, 0x00050006, 0x00000131, 0x0000000f,
-    0x6f6c6f43, 0x00315272, 0x00050006, 0x00000131, 0x00000010, 0x6f6c6f43, 0x00314772, 0x00050006,
-    0x00000131, 0x00000011, 0x6f6c6f43, 0x00314272, 0x00060006, 0x00000131, 0x00000012, 0x63786554,
-    0x64726f6f, 0x00003055, 0x00060006, 0x00000131, 0x00000013, 0x63786554, 0x64726f6f, 0x00003056,
-    0x00060006, 0x00000131, 0x00000014, 0x63786554, 0x64726f6f, 0x00003155, 0x00060006, 0x00000131,
-    0x00000015, 0x63786554, 0x64726f6f, 0x00003156, 0x00060006, 0x00000131, 0x00000016, 0x4c766f43,
-    0x74696e49, 0x006c6169, 0x00060006, 0x00000131, 0x00000017, 0x52766f43, 0x74696e49, 0x006c6169,
-    0x00070005, 0x00000133, 0x61705358, 0x7465536e, 0x42737075, 0x65666675, 0x00000072, 0x00060006,
-    0x00000133, 0x00000000, 0x61705358, 0x7465536e, 0x00737075, 0x00030005, 0x00000135, 0x00000000,
-    0x00030005, 0x0000017f, 0x00000079, 0x00030005, 0x00000189, 0x00000078, 0x00050005, 0x0000018d,
-    0x65726373, 0x6e456e65, 0x00000064, 0x00040005, 0x0000018e, 0x7466656c, 0x00646e45, 0x00040005,
-    0x0000019b, 0x766f6378, 0x00000000, 0x00040005, 0x000001a8, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001aa, 0x61726170, 0x0000006d, 0x00040005, 0x000001ab, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001b8, 0x61726170, 0x0000006d, 0x00040005, 0x000001ba, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001bb, 0x61726170, 0x0000006d, 0x00040005, 0x000001bd, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001cb, 0x79646f62, 0x00646e45, 0x00050005, 0x000001d6, 0x68676972, 0x646e4574, 0x00000000,
-    0x00040005, 0x000001e0, 0x766f6378, 0x00000000, 0x00040005, 0x000001ed, 0x61726170, 0x0000006d,
-    0x00040005, 0x000001ef, 0x61726170, 0x0000006d, 0x00040005, 0x000001f0, 0x61726170, 0x0000006d,
-    0x00040005, 0x000001ff, 0x61726170, 0x0000006d, 0x00040005, 0x00000201, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000202, 0x61726170, 0x0000006d, 0x00040005, 0x00000204, 0x61726170, 0x0000006d,
-    0x00050005, 0x00000214, 0x6174654d, 0x66696e55, 0x006d726f, 0x00060006, 0x00000214, 0x00000000,
-    0x506d754e, 0x67796c6f, 0x00736e6f, 0x00060006, 0x00000214, 0x00000001, 0x566d754e, 0x61697261,
-    0x0073746e, 0x00060006, 0x00000214, 0x00000002, 0x68706c41, 0x66655261, 0x00000000, 0x00050006,
-    0x00000214, 0x00000003, 0x70736944, 0x00746e43, 0x00060006, 0x00000214, 0x00000004, 0x6e6f6f54,
-    0x6c626154, 0x00000065, 0x00060006, 0x00000214, 0x00000005, 0x61656c43, 0x6c6f4372, 0x0000726f,
-    0x00060006, 0x00000214, 0x00000006, 0x61656c43, 0x70654472, 0x00006874, 0x00060006, 0x00000214,
-    0x00000007, 0x61656c43, 0x74744172, 0x00000072, 0x00060006, 0x00000214, 0x00000008, 0x4f676f46,
-    0x65736666, 0x00000074, 0x00060006, 0x00000214, 0x00000009, 0x53676f46, 0x74666968, 0x00000000,
-    0x00060006, 0x00000214, 0x0000000a, 0x43676f46, 0x726f6c6f, 0x00000000, 0x00080006, 0x00000214,
-    0x0000000b, 0x61656c43, 0x74694272, 0x4f70616d, 0x65736666, 0x00000074, 0x00030005, 0x00000216,
-    0x00000000, 0x00060005, 0x0000021a, 0x74706544, 0x6c695468, 0x66754265, 0x00726566, 0x00060006,
-    0x0000021a, 0x00000000, 0x74706544, 0x6c695468, 0x00007365, 0x00030005, 0x0000021c, 0x00000000,
-    0x00040047, 0x00000028, 0x00000001, 0x00000000, 0x00050048, 0x00000031, 0x00000000, 0x00000023,
-    0x00000000, 0x00050048, 0x00000031, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x00000031,
-    0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x00000031, 0x00000003, 0x00000023, 0x0000000c,
-    0x00050048, 0x00000031, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x00000031, 0x00000005,
-    0x00000023, 0x00000014, 0x00050048, 0x00000031, 0x00000006, 0x00000023, 0x00000018, 0x00050048,
-    0x00000031, 0x00000007, 0x00000023, 0x0000001c, 0x00030047, 0x00000031, 0x00000002, 0x00040047,
-    0x0000004a, 0x00000006, 0x00000010, 0x00040047, 0x0000004b, 0x00000006, 0x00000004, 0x00040047,
-    0x0000004c, 0x00000006, 0x00000004, 0x00040047, 0x0000004d, 0x00000006, 0x00000004, 0x00050048,
-    0x0000004e, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x0000004e, 0x00000001, 0x00000023,
-    0x00008000, 0x00050048, 0x0000004e, 0x00000002, 0x00000023, 0x0000a000, 0x00050048, 0x0000004e,
-    0x00000003, 0x00000023, 0x0000c000, 0x00050048, 0x0000004e, 0x00000004, 0x00000023, 0x0000c010,
-    0x00030047, 0x0000004e, 0x00000002, 0x00040047, 0x00000050, 0x00000022, 0x00000000, 0x00040047,
-    0x00000050, 0x00000021, 0x00000008, 0x00040047, 0x00000052, 0x00000001, 0x00000001, 0x00040047,
-    0x00000086, 0x00000001, 0x00000002, 0x00040047, 0x000000a7, 0x00000006, 0x00000004, 0x00050048,
-    0x000000a8, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x000000a8, 0x00000002, 0x00040047,
-    0x000000aa, 0x00000022, 0x00000000, 0x00040047, 0x000000aa, 0x00000021, 0x00000004, 0x00040047,
-    0x000000b2, 0x00000006, 0x00000004, 0x00050048, 0x000000b3, 0x00000000, 0x00000023, 0x00000000,
-    0x00030047, 0x000000b3, 0x00000002, 0x00040047, 0x000000b5, 0x00000022, 0x00000000, 0x00040047,
-    0x000000b5, 0x00000021, 0x00000006, 0x00040047, 0x000000c7, 0x00000006, 0x00000004, 0x00050048,
-    0x000000c8, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x000000c8, 0x00000002, 0x00040047,
-    0x000000ca, 0x00000022, 0x00000000, 0x00040047, 0x000000ca, 0x00000021, 0x00000010, 0x00040047,
-    0x000000e6, 0x00000006, 0x00000004, 0x00050048, 0x000000e7, 0x00000000, 0x00000023, 0x00000000,
-    0x00030047, 0x000000e7, 0x00000002, 0x00040047, 0x000000e9, 0x00000022, 0x00000000, 0x00040047,
-    0x000000e9, 0x00000021, 0x00000007, 0x00040047, 0x00000104, 0x0000000b, 0x0000001c, 0x00040047,
-    0x00000113, 0x00000022, 0x00000000, 0x00040047, 0x00000113, 0x00000021, 0x0000000a, 0x00050048,
-    0x00000131, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000131, 0x00000001, 0x00000023,
-    0x00000004, 0x00050048, 0x00000131, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x00000131,
-    0x00000003, 0x00000023, 0x0000000c, 0x00050048, 0x00000131, 0x00000004, 0x00000023, 0x00000010,
-    0x00050048, 0x00000131, 0x00000005, 0x00000023, 0x00000014, 0x00050048, 0x00000131, 0x00000006,
-    0x00000023, 0x00000018, 0x00050048, 0x00000131, 0x00000007, 0x00000023, 0x0000001c, 0x00050048,
-    0x00000131, 0x00000008, 0x00000023, 0x00000020, 0x00050048, 0x00000131, 0x00000009, 0x00000023,
-    0x00000024, 0x00050048, 0x00000131, 0x0000000a, 0x00000023, 0x00000028, 0x00050048, 0x00000131,
-    0x0000000b, 0x00000023, 0x0000002c, 0x00050048, 0x00000131, 0x0000000c, 0x00000023, 0x00000030,
-    0x00050048, 0x00000131, 0x0000000d, 0x00000023, 0x00000034, 0x00050048, 0x00000131, 0x0000000e,
-    0x00000023, 0x00000038, 0x00050048, 0x00000131, 0x0000000f, 0x00000023, 0x0000003c, 0x00050048,
-    0x00000131, 0x00000010, 0x00000023, 0x00000040, 0x00050048, 0x00000131, 0x00000011, 0x00000023,
-    0x00000044, 0x00050048, 0x00000131, 0x00000012, 0x00000023, 0x00000048, 0x00050048, 0x00000131,
-    0x00000013, 0x00000023, 0x0000004c, 0x00050048, 0x00000131, 0x00000014, 0x00000023, 0x00000050,
-    0x00050048, 0x00000131, 0x00000015, 0x00000023, 0x00000054, 0x00050048, 0x00000131, 0x00000016,
-    0x00000023, 0x00000058, 0x00050048, 0x00000131, 0x00000017, 0x00000023, 0x0000005c, 0x00040047,
-    0x00000132, 0x00000006, 0x00000060, 0x00050048, 0x00000133, 0x00000000, 0x00000023, 0x00000000,
-    0x00030047, 0x00000133, 0x00000002, 0x00040047, 0x00000135, 0x00000022, 0x00000000, 0x00040047,
-    0x00000135, 0x00000021, 0x00000002, 0x00040047, 0x00000211, 0x00000006, 0x00000010, 0x00050048,
-    0x00000214, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000214, 0x00000001, 0x00000023,
-    0x00000004, 0x00050048, 0x00000214, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x00000214,
-    0x00000003, 0x00000023, 0x0000000c, 0x00050048, 0x00000214, 0x00000004, 0x00000023, 0x00000010,
-    0x00050048, 0x00000214, 0x00000005, 0x00000023, 0x00000230, 0x00050048, 0x00000214, 0x00000006,
-    0x00000023, 0x00000234, 0x00050048, 0x00000214, 0x00000007, 0x00000023, 0x00000238, 0x00050048,
-    0x00000214, 0x00000008, 0x00000023, 0x0000023c, 0x00050048, 0x00000214, 0x00000009, 0x00000023,
-    0x00000240, 0x00050048, 0x00000214, 0x0000000a, 0x00000023, 0x00000244, 0x00050048, 0x00000214,
-    0x0000000b, 0x00000023, 0x00000248, 0x00030047, 0x00000214, 0x00000002, 0x00040047, 0x00000216,
-    0x00000022, 0x00000000, 0x00040047, 0x00000216, 0x00000021, 0x00000000, 0x00040047, 0x00000219,
-    0x00000006, 0x00000004, 0x00050048, 0x0000021a, 0x00000000, 0x00000023, 0x00000000, 0x00030047,
-    0x0000021a, 0x00000002, 0x00040047, 0x0000021c, 0x00000022, 0x00000000, 0x00040047, 0x0000021c,
-    0x00000021, 0x00000005, 0x00040047, 0x0000021e, 0x0000000b, 0x00000019, 0x00020013, 0x00000002,
-    0x00030021, 0x00000003, 0x00000002, 0x00040015, 0x00000006, 0x00000020, 0x00000000, 0x00040020,
-    0x00000007, 0x00000007, 0x00000006, 0x00020014, 0x00000008, 0x00070021, 0x00000009, 0x00000008,
-    0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00060021, 0x00000010, 0x00000008, 0x00000007,
-    0x00000007, 0x00000007, 0x00070021, 0x00000016, 0x00000002, 0x00000007, 0x00000007, 0x00000007,
-    0x00000007, 0x0004002b, 0x00000006, 0x0000001f, 0x00000020, 0x00040015, 0x00000027, 0x00000020,
-    0x00000001, 0x00040032, 0x00000027, 0x00000028, 0x00000100, 0x0004002b, 0x00000027, 0x00000029,
-    0x00000020, 0x00060034, 0x00000027, 0x0000002a, 0x00000087, 0x00000028, 0x00000029, 0x0004002b,
-    0x00000006, 0x0000002b, 0x00000000, 0x00060034, 0x00000006, 0x0000002c, 0x00000080, 0x0000002a,
-    0x0000002b, 0x000a001e, 0x00000031, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000027, 0x00000006, 0x00040020, 0x00000032, 0x00000009, 0x00000031, 0x0004003b,
-    0x00000032, 0x00000033, 0x00000009, 0x0004002b, 0x00000027, 0x00000034, 0x00000000, 0x00040020,
-    0x00000035, 0x00000009, 0x00000006, 0x0004002b, 0x00000006, 0x0000003b, 0x00000005, 0x0004002b,
-    0x00000006, 0x0000003f, 0x0000001f, 0x0004002b, 0x00000006, 0x00000043, 0x00000040, 0x00040017,
-    0x00000048, 0x00000006, 0x00000004, 0x0004002b, 0x00000006, 0x00000049, 0x00000800, 0x0004001c,
-    0x0000004a, 0x00000048, 0x00000049, 0x0004001c, 0x0000004b, 0x00000006, 0x00000049, 0x0004001c,
-    0x0000004c, 0x00000006, 0x00000049, 0x0003001d, 0x0000004d, 0x00000006, 0x0007001e, 0x0000004e,
-    0x0000004a, 0x0000004b, 0x0000004c, 0x00000048, 0x0000004d, 0x00040020, 0x0000004f, 0x0000000c,
-    0x0000004e, 0x0004003b, 0x0000004f, 0x00000050, 0x0000000c, 0x0004002b, 0x00000027, 0x00000051,
-    0x00000004, 0x00040032, 0x00000027, 0x00000052, 0x000000c0, 0x00060034, 0x00000027, 0x00000053,
-    0x00000087, 0x00000052, 0x00000029, 0x00060034, 0x00000027, 0x00000054, 0x00000084, 0x0000002a,
-    0x00000053, 0x0004002b, 0x00000027, 0x00000055, 0x00000002, 0x00060034, 0x00000027, 0x00000056,
-    0x00000084, 0x00000054, 0x00000055, 0x00060034, 0x00000027, 0x00000057, 0x00000080, 0x00000034,
-    0x00000056, 0x00040020, 0x0000005b, 0x0000000c, 0x00000006, 0x0004002b, 0x00000006, 0x0000005f,
-    0x00000001, 0x0003002a, 0x00000008, 0x00000066, 0x00060034, 0x00000027, 0x0000007a, 0x00000084,
-    0x0000002a, 0x00000053, 0x0004002b, 0x00000027, 0x0000007b, 0x00000040, 0x00060034, 0x00000027,
-    0x0000007c, 0x00000084, 0x0000007a, 0x0000007b, 0x00060034, 0x00000027, 0x0000007d, 0x00000080,
-    0x00000057, 0x0000007c, 0x00040032, 0x00000027, 0x00000086, 0x00003000, 0x00060034, 0x00000006,
-    0x00000087, 0x00000080, 0x00000086, 0x0000002b, 0x0004002b, 0x00000006, 0x00000094, 0x00000400,
-    0x00030029, 0x00000008, 0x00000098, 0x0003001d, 0x000000a7, 0x00000006, 0x0003001e, 0x000000a8,
-    0x000000a7, 0x00040020, 0x000000a9, 0x0000000c, 0x000000a8, 0x0004003b, 0x000000a9, 0x000000aa,
-    0x0000000c, 0x0003001d, 0x000000b2, 0x00000006, 0x0003001e, 0x000000b3, 0x000000b2, 0x00040020,
-    0x000000b4, 0x0000000c, 0x000000b3, 0x0004003b, 0x000000b4, 0x000000b5, 0x0000000c, 0x0004002b,
-    0x00000006, 0x000000b9, 0x80000000, 0x00060034, 0x00000006, 0x000000c1, 0x00000080, 0x00000028,
-    0x0000002b, 0x0004002b, 0x00000006, 0x000000c6, 0xffffffff, 0x0003001d, 0x000000c7, 0x00000006,
-    0x0003001e, 0x000000c8, 0x000000c7, 0x00040020, 0x000000c9, 0x0000000c, 0x000000c8, 0x0004003b,
-    0x000000c9, 0x000000ca, 0x0000000c, 0x00060034, 0x00000027, 0x000000d4, 0x00000084, 0x00000028,
-    0x00000052, 0x00060034, 0x00000006, 0x000000d5, 0x00000080, 0x000000d4, 0x0000002b, 0x00060034,
-    0x00000006, 0x000000de, 0x00000080, 0x000000d4, 0x0000002b, 0x0003001d, 0x000000e6, 0x00000006,
-    0x0003001e, 0x000000e7, 0x000000e6, 0x00040020, 0x000000e8, 0x0000000c, 0x000000e7, 0x0004003b,
-    0x000000e8, 0x000000e9, 0x0000000c, 0x00060034, 0x00000027, 0x000000ea, 0x00000084, 0x00000028,
-    0x00000052, 0x00060034, 0x00000027, 0x000000eb, 0x00000084, 0x000000ea, 0x00000055, 0x00060034,
-    0x00000006, 0x000000ec, 0x00000080, 0x000000eb, 0x0000002b, 0x00060034, 0x00000006, 0x000000ed,
-    0x00000080, 0x0000002b, 0x000000ec, 0x00060034, 0x00000027, 0x000000ee, 0x00000084, 0x00000028,
-    0x00000052, 0x00060034, 0x00000027, 0x000000ef, 0x00000084, 0x000000ee, 0x00000055, 0x00060034,
-    0x00000006, 0x000000f0, 0x00000080, 0x000000ef, 0x0000002b, 0x00060034, 0x00000006, 0x000000f1,
-    0x00000080, 0x000000ed, 0x000000f0, 0x0004002b, 0x00000006, 0x000000f9, 0xffffe0ff, 0x0004002b,
-    0x00000006, 0x000000fd, 0x00000008, 0x00040017, 0x00000102, 0x00000006, 0x00000003, 0x00040020,
-    0x00000103, 0x00000001, 0x00000102, 0x0004003b, 0x00000103, 0x00000104, 0x00000001, 0x00040020,
-    0x00000105, 0x00000001, 0x00000006, 0x00040020, 0x0000010f, 0x00000007, 0x00000048, 0x00090019,
-    0x00000111, 0x00000006, 0x00000005, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000,
-    0x00040020, 0x00000112, 0x00000000, 0x00000111, 0x0004003b, 0x00000112, 0x00000113, 0x00000000,
-    0x0004002b, 0x00000027, 0x00000125, 0x00000001, 0x001a001e, 0x0000012e, 0x00000027, 0x00000027,
-    0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000006, 0x00000027, 0x00000027,
-    0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000027,
-    0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00040020, 0x0000012f,
-    0x00000007, 0x0000012e, 0x001a001e, 0x00000131, 0x00000027, 0x00000027, 0x00000027, 0x00000027,
-    0x00000027, 0x00000027, 0x00000027, 0x00000006, 0x00000027, 0x00000027, 0x00000027, 0x00000027,
-    0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x00000027,
-    0x00000027, 0x00000027, 0x00000027, 0x00000027, 0x0003001d, 0x00000132, 0x00000131, 0x0003001e,
-    0x00000133, 0x00000132, 0x00040020, 0x00000134, 0x0000000c, 0x00000133, 0x0004003b, 0x00000134,
-    0x00000135, 0x0000000c, 0x00040020, 0x00000137, 0x0000000c, 0x00000131, 0x00040020, 0x0000013b,
-    0x00000007, 0x00000027, 0x0004002b, 0x00000027, 0x00000142, 0x00000003, 0x0004002b, 0x00000027,
-    0x00000147, 0x00000005, 0x0004002b, 0x00000027, 0x0000014a, 0x00000006, 0x0004002b, 0x00000027,
-    0x0000014d, 0x00000007, 0x0004002b, 0x00000027, 0x00000150, 0x00000008, 0x0004002b, 0x00000027,
-    0x00000153, 0x00000009, 0x0004002b, 0x00000027, 0x00000156, 0x0000000a, 0x0004002b, 0x00000027,
-    0x00000159, 0x0000000b, 0x0004002b, 0x00000027, 0x0000015c, 0x0000000c, 0x0004002b, 0x00000027,
-    0x0000015f, 0x0000000d, 0x0004002b, 0x00000027, 0x00000162, 0x0000000e, 0x0004002b, 0x00000027,
-    0x00000165, 0x0000000f, 0x0004002b, 0x00000027, 0x00000168, 0x00000010, 0x0004002b, 0x00000027,
-    0x0000016b, 0x00000011, 0x0004002b, 0x00000027, 0x0000016e, 0x00000012, 0x0004002b, 0x00000027,
-    0x00000171, 0x00000013, 0x0004002b, 0x00000027, 0x00000174, 0x00000014, 0x0004002b, 0x00000027,
-    0x00000177, 0x00000015, 0x0004002b, 0x00000027, 0x0000017a, 0x00000016, 0x0004002b, 0x00000027,
-    0x0000017d, 0x00000017, 0x0004002b, 0x00000006, 0x00000180, 0x00000003, 0x00060034, 0x00000006,
-    0x00000184, 0x00000080, 0x00000052, 0x0000002b, 0x0004002b, 0x00000027, 0x000001c1, 0x000003ff,
-    0x0004002b, 0x00000027, 0x000001f9, 0x0000001f, 0x0004002b, 0x00000027, 0x0000020d, 0x00000100,
-    0x0004002b, 0x00000027, 0x0000020e, 0x000000c0, 0x0004002b, 0x00000027, 0x0000020f, 0x00000800,
-    0x0004002b, 0x00000006, 0x00000210, 0x00000022, 0x0004001c, 0x00000211, 0x00000048, 0x00000210,
-    0x00030016, 0x00000212, 0x00000020, 0x00040017, 0x00000213, 0x00000212, 0x00000002, 0x000e001e,
-    0x00000214, 0x00000006, 0x00000006, 0x00000027, 0x00000006, 0x00000211, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000213, 0x00040020, 0x00000215, 0x00000002,
-    0x00000214, 0x0004003b, 0x00000215, 0x00000216, 0x00000002, 0x0004002b, 0x00000006, 0x00000217,
-    0x00000002, 0x0004002b, 0x00000006, 0x00000218, 0x00000004, 0x0003001d, 0x00000219, 0x00000006,
-    0x0003001e, 0x0000021a, 0x00000219, 0x00040020, 0x0000021b, 0x0000000c, 0x0000021a, 0x0004003b,
-    0x0000021b, 0x0000021c, 0x0000000c, 0x0004002b, 0x00000006, 0x0000021d, 0x00008000, 0x0006002c,
-    0x00000102, 0x0000021e, 0x00000043, 0x0000005f, 0x0000005f, 0x00050036, 0x00000002, 0x00000004,
-    0x00000000, 0x00000003, 0x000200f8, 0x00000005, 0x0004003b, 0x00000007, 0x00000101, 0x00000007,
-    0x0004003b, 0x0000010f, 0x00000110, 0x00000007, 0x0004003b, 0x00000007, 0x00000118, 0x00000007,
-    0x0004003b, 0x0000012f, 0x00000130, 0x00000007, 0x0004003b, 0x00000007, 0x0000017f, 0x00000007,
-    0x0004003b, 0x0000013b, 0x00000189, 0x00000007, 0x0004003b, 0x0000013b, 0x0000018d, 0x00000007,
-    0x0004003b, 0x0000013b, 0x0000018e, 0x00000007, 0x0004003b, 0x0000013b, 0x0000019b, 0x00000007,
-    0x0004003b, 0x00000007, 0x000001a8, 0x00000007, 0x0004003b, 0x00000007, 0x000001aa, 0x00000007,
-    0x0004003b, 0x00000007, 0x000001ab, 0x00000007, 0x0004003b, 0x00000007, 0x000001b8, 0x00000007,
-    0x0004003b, 0x00000007, 0x000001ba, 0x00000007, 0x0004003b, 0x00000007, 0x000001bb, 0x00000007,
-    0x0004003b, 0x00000007, 0x000001bd, 0x00000007, 0x0004003b, 0x0000013b, 0x000001cb, 0x00000007,
-    0x0004003b, 0x0000013b, 0x000001d6, 0x00000007, 0x0004003b, 0x0000013b, 0x000001e0, 0x00000007,
-    0x0004003b, 0x00000007, 0x000001ed, 0x00000007, 0x0004003b, 0x00000007, 0x000001ef, 0x00000007,
-    0x0004003b, 0x00000007, 0x000001f0, 0x00000007, 0x0004003b, 0x00000007, 0x000001ff, 0x00000007,
-    0x0004003b, 0x00000007, 0x00000201, 0x00000007, 0x0004003b, 0x00000007, 0x00000202, 0x00000007,
-    0x0004003b, 0x00000007, 0x00000204, 0x00000007, 0x00050041, 0x00000105, 0x00000106, 0x00000104,
-    0x0000002b, 0x0004003d, 0x00000006, 0x00000107, 0x00000106, 0x0003003e, 0x00000101, 0x00000107,
-    0x0004003d, 0x00000006, 0x00000108, 0x00000101, 0x00050041, 0x00000035, 0x00000109, 0x00000033,
-    0x00000055, 0x0004003d, 0x00000006, 0x0000010a, 0x00000109, 0x000500ae, 0x00000008, 0x0000010b,
-    0x00000108, 0x0000010a, 0x000300f7, 0x0000010d, 0x00000000, 0x000400fa, 0x0000010b, 0x0000010c,
-    0x0000010d, 0x000200f8, 0x0000010c, 0x000100fd, 0x000200f8, 0x0000010d, 0x0004003d, 0x00000111,
-    0x00000114, 0x00000113, 0x0004003d, 0x00000006, 0x00000115, 0x00000101, 0x0004007c, 0x00000027,
-    0x00000116, 0x00000115, 0x0005005f, 0x00000048, 0x00000117, 0x00000114, 0x00000116, 0x0003003e,
-    0x00000110, 0x00000117, 0x00050041, 0x00000007, 0x00000119, 0x00000110, 0x0000002b, 0x0004003d,
-    0x00000006, 0x0000011a, 0x00000119, 0x0003003e, 0x00000118, 0x0000011a, 0x0004003d, 0x00000006,
-    0x0000011b, 0x00000118, 0x00050041, 0x00000035, 0x0000011c, 0x00000033, 0x00000034, 0x0004003d,
-    0x00000006, 0x0000011d, 0x0000011c, 0x000500b0, 0x00000008, 0x0000011e, 0x0000011b, 0x0000011d,
-    0x000400a8, 0x00000008, 0x0000011f, 0x0000011e, 0x000300f7, 0x00000121, 0x00000000, 0x000400fa,
-    0x0000011f, 0x00000120, 0x00000121, 0x000200f8, 0x00000120, 0x0004003d, 0x00000006, 0x00000122,
-    0x00000118, 0x00050041, 0x00000035, 0x00000123, 0x00000033, 0x00000034, 0x0004003d, 0x00000006,
-    0x00000124, 0x00000123, 0x00050041, 0x00000035, 0x00000126, 0x00000033, 0x00000125, 0x0004003d,
-    0x00000006, 0x00000127, 0x00000126, 0x00050080, 0x00000006, 0x00000128, 0x00000124, 0x00000127,
-    0x000500ae, 0x00000008, 0x00000129, 0x00000122, 0x00000128, 0x000200f9, 0x00000121, 0x000200f8,
-    0x00000121, 0x000700f5, 0x00000008, 0x0000012a, 0x0000011e, 0x0000010d, 0x00000129, 0x00000120,
-    0x000300f7, 0x0000012c, 0x00000000, 0x000400fa, 0x0000012a, 0x0000012b, 0x0000012c, 0x000200f8,
-    0x0000012b, 0x000100fd, 0x000200f8, 0x0000012c, 0x0004003d, 0x00000006, 0x00000136, 0x00000101,
-    0x00060041, 0x00000137, 0x00000138, 0x00000135, 0x00000034, 0x00000136, 0x0004003d, 0x00000131,
-    0x00000139, 0x00000138, 0x00050051, 0x00000027, 0x0000013a, 0x00000139, 0x00000000, 0x00050041,
-    0x0000013b, 0x0000013c, 0x00000130, 0x00000034, 0x0003003e, 0x0000013c, 0x0000013a, 0x00050051,
-    0x00000027, 0x0000013d, 0x00000139, 0x00000001, 0x00050041, 0x0000013b, 0x0000013e, 0x00000130,
-    0x00000125, 0x0003003e, 0x0000013e, 0x0000013d, 0x00050051, 0x00000027, 0x0000013f, 0x00000139,
-    0x00000002, 0x00050041, 0x0000013b, 0x00000140, 0x00000130, 0x00000055, 0x0003003e, 0x00000140,
-    0x0000013f, 0x00050051, 0x00000027, 0x00000141, 0x00000139, 0x00000003, 0x00050041, 0x0000013b,
-    0x00000143, 0x00000130, 0x00000142, 0x0003003e, 0x00000143, 0x00000141, 0x00050051, 0x00000027,
-    0x00000144, 0x00000139, 0x00000004, 0x00050041, 0x0000013b, 0x00000145, 0x00000130, 0x00000051,
-    0x0003003e, 0x00000145, 0x00000144, 0x00050051, 0x00000027, 0x00000146, 0x00000139, 0x00000005,
-    0x00050041, 0x0000013b, 0x00000148, 0x00000130, 0x00000147, 0x0003003e, 0x00000148, 0x00000146,
-    0x00050051, 0x00000027, 0x00000149, 0x00000139, 0x00000006, 0x00050041, 0x0000013b, 0x0000014b,
-    0x00000130, 0x0000014a, 0x0003003e, 0x0000014b, 0x00000149, 0x00050051, 0x00000006, 0x0000014c,
-    0x00000139, 0x00000007, 0x00050041, 0x00000007, 0x0000014e, 0x00000130, 0x0000014d, 0x0003003e,
-    0x0000014e, 0x0000014c, 0x00050051, 0x00000027, 0x0000014f, 0x00000139, 0x00000008, 0x00050041,
-    0x0000013b, 0x00000151, 0x00000130, 0x00000150, 0x0003003e, 0x00000151, 0x0000014f, 0x00050051,
-    0x00000027, 0x00000152, 0x00000139, 0x00000009, 0x00050041, 0x0000013b, 0x00000154, 0x00000130,
-    0x00000153, 0x0003003e, 0x00000154, 0x00000152, 0x00050051, 0x00000027, 0x00000155, 0x00000139,
-    0x0000000a, 0x00050041, 0x0000013b, 0x00000157, 0x00000130, 0x00000156, 0x0003003e, 0x00000157,
-    0x00000155, 0x00050051, 0x00000027, 0x00000158, 0x00000139, 0x0000000b, 0x00050041, 0x0000013b,
-    0x0000015a, 0x00000130, 0x00000159, 0x0003003e, 0x0000015a, 0x00000158, 0x00050051, 0x00000027,
-    0x0000015b, 0x00000139, 0x0000000c, 0x00050041, 0x0000013b, 0x0000015d, 0x00000130, 0x0000015c,
-    0x0003003e, 0x0000015d, 0x0000015b, 0x00050051, 0x00000027, 0x0000015e, 0x00000139, 0x0000000d,
-    0x00050041, 0x0000013b, 0x00000160, 0x00000130, 0x0000015f, 0x0003003e, 0x00000160, 0x0000015e,
-    0x00050051, 0x00000027, 0x00000161, 0x00000139, 0x0000000e, 0x00050041, 0x0000013b, 0x00000163,
-    0x00000130, 0x00000162, 0x0003003e, 0x00000163, 0x00000161, 0x00050051, 0x00000027, 0x00000164,
-    0x00000139, 0x0000000f, 0x00050041, 0x0000013b, 0x00000166, 0x00000130, 0x00000165, 0x0003003e,
-    0x00000166, 0x00000164, 0x00050051, 0x00000027, 0x00000167, 0x00000139, 0x00000010, 0x00050041,
-    0x0000013b, 0x00000169, 0x00000130, 0x00000168, 0x0003003e, 0x00000169, 0x00000167, 0x00050051,
-    0x00000027, 0x0000016a, 0x00000139, 0x00000011, 0x00050041, 0x0000013b, 0x0000016c, 0x00000130,
-    0x0000016b, 0x0003003e, 0x0000016c, 0x0000016a, 0x00050051, 0x00000027, 0x0000016d, 0x00000139,
-    0x00000012, 0x00050041, 0x0000013b, 0x0000016f, 0x00000130, 0x0000016e, 0x0003003e, 0x0000016f,
-    0x0000016d, 0x00050051, 0x00000027, 0x00000170, 0x00000139, 0x00000013, 0x00050041, 0x0000013b,
-    0x00000172, 0x00000130, 0x00000171, 0x0003003e, 0x00000172, 0x00000170, 0x00050051, 0x00000027,
-    0x00000173, 0x00000139, 0x00000014, 0x00050041, 0x0000013b, 0x00000175, 0x00000130, 0x00000174,
-    0x0003003e, 0x00000175, 0x00000173, 0x00050051, 0x00000027, 0x00000176, 0x00000139, 0x00000015,
-    0x00050041, 0x0000013b, 0x00000178, 0x00000130, 0x00000177, 0x0003003e, 0x00000178, 0x00000176,
-    0x00050051, 0x00000027, 0x00000179, 0x00000139, 0x00000016, 0x00050041, 0x0000013b, 0x0000017b,
-    0x00000130, 0x0000017a, 0x0003003e, 0x0000017b, 0x00000179, 0x00050051, 0x00000027, 0x0000017c,
-    0x00000139, 0x00000017, 0x00050041, 0x0000013b, 0x0000017e, 0x00000130, 0x0000017d, 0x0003003e,
-    0x0000017e, 0x0000017c, 0x00050041, 0x00000007, 0x00000181, 0x00000110, 0x00000180, 0x0004003d,
-    0x00000006, 0x00000182, 0x00000181, 0x0003003e, 0x0000017f, 0x00000182, 0x0004003d, 0x00000006,
-    0x00000183, 0x0000017f, 0x000500ae, 0x00000008, 0x00000185, 0x00000183, 0x00000184, 0x000300f7,
-    0x00000187, 0x00000000, 0x000400fa, 0x00000185, 0x00000186, 0x00000187, 0x000200f8, 0x00000186,
-    0x000100fd, 0x000200f8, 0x00000187, 0x00050041, 0x0000013b, 0x0000018a, 0x00000130, 0x00000034,
-    0x0004003d, 0x00000027, 0x0000018b, 0x0000018a, 0x0007000c, 0x00000027, 0x0000018c, 0x00000001,
-    0x0000002a, 0x0000018b, 0x00000034, 0x0003003e, 0x00000189, 0x0000018c, 0x0003003e, 0x0000018d,
-    0x00000028, 0x00050041, 0x0000013b, 0x0000018f, 0x00000130, 0x00000055, 0x0004003d, 0x00000027,
-    0x00000190, 0x0000018f, 0x00050041, 0x0000013b, 0x00000191, 0x00000130, 0x00000125, 0x0004003d,
-    0x00000027, 0x00000192, 0x00000191, 0x0007000c, 0x00000027, 0x00000193, 0x00000001, 0x00000027,
-    0x00000190, 0x00000192, 0x0004003d, 0x00000027, 0x00000194, 0x0000018d, 0x0007000c, 0x00000027,
-    0x00000195, 0x00000001, 0x00000027, 0x00000193, 0x00000194, 0x0003003e, 0x0000018e, 0x00000195,
-    0x00050041, 0x0000013b, 0x00000196, 0x00000130, 0x00000051, 0x0004003d, 0x00000027, 0x00000197,
-    0x00000196, 0x000500b1, 0x00000008, 0x00000198, 0x00000197, 0x00000034, 0x000300f7, 0x0000019a,
-    0x00000000, 0x000400fa, 0x00000198, 0x00000199, 0x000001c7, 0x000200f8, 0x00000199, 0x00050041,
-    0x0000013b, 0x0000019c, 0x00000130, 0x0000017a, 0x0004003d, 0x00000027, 0x0000019d, 0x0000019c,
-    0x0003003e, 0x0000019b, 0x0000019d, 0x000200f9, 0x0000019e, 0x000200f8, 0x0000019e, 0x000400f6,
-    0x000001a0, 0x000001a1, 0x00000000, 0x000200f9, 0x000001a2, 0x000200f8, 0x000001a2, 0x0004003d,
-    0x00000027, 0x000001a3, 0x00000189, 0x0004003d, 0x00000027, 0x000001a4, 0x0000018e, 0x000500b1,
-    0x00000008, 0x000001a5, 0x000001a3, 0x000001a4, 0x000400fa, 0x000001a5, 0x0000019f, 0x000001a0,
-    0x000200f8, 0x0000019f, 0x0004003d, 0x00000027, 0x000001a6, 0x00000189, 0x0004007c, 0x00000006,
-    0x000001a7, 0x000001a6, 0x0004003d, 0x00000006, 0x000001a9, 0x00000118, 0x0003003e, 0x000001a8,
-    0x000001a9, 0x0003003e, 0x000001aa, 0x000001a7, 0x0004003d, 0x00000006, 0x000001ac, 0x0000017f,
-    0x0003003e, 0x000001ab, 0x000001ac, 0x00070039, 0x00000008, 0x000001ad, 0x00000014, 0x000001a8,
-    0x000001aa, 0x000001ab, 0x000400a8, 0x00000008, 0x000001ae, 0x000001ad, 0x000300f7, 0x000001b0,
-    0x00000000, 0x000400fa, 0x000001ae, 0x000001af, 0x000001b0, 0x000200f8, 0x000001af, 0x000200f9,
-    0x000001a1, 0x000200f8, 0x000001b0, 0x0004003d, 0x00000027, 0x000001b2, 0x00000189, 0x0004007c,
-    0x00000006, 0x000001b3, 0x000001b2, 0x0004003d, 0x00000027, 0x000001b4, 0x0000019b, 0x000500c3,
-    0x00000027, 0x000001b5, 0x000001b4, 0x00000147, 0x0004007c, 0x00000006, 0x000001b6, 0x000001b5,
-    0x0007000c, 0x00000006, 0x000001b7, 0x00000001, 0x00000026, 0x000001b6, 0x0000003f, 0x0004003d,
-    0x00000006, 0x000001b9, 0x00000118, 0x0003003e, 0x000001b8, 0x000001b9, 0x0003003e, 0x000001ba,
-    0x000001b3, 0x0004003d, 0x00000006, 0x000001bc, 0x0000017f, 0x0003003e, 0x000001bb, 0x000001bc,
-    0x0003003e, 0x000001bd, 0x000001b7, 0x00080039, 0x00000002, 0x000001be, 0x0000001b, 0x000001b8,
-    0x000001ba, 0x000001bb, 0x000001bd, 0x00050041, 0x0000013b, 0x000001bf, 0x00000130, 0x00000051,
-    0x0004003d, 0x00000027, 0x000001c0, 0x000001bf, 0x000500c7, 0x00000027, 0x000001c2, 0x000001c0,
-    0x000001c1, 0x0004003d, 0x00000027, 0x000001c3, 0x0000019b, 0x00050080, 0x00000027, 0x000001c4,
-    0x000001c3, 0x000001c2, 0x0003003e, 0x0000019b, 0x000001c4, 0x000200f9, 0x000001a1, 0x000200f8,
-    0x000001a1, 0x0004003d, 0x00000027, 0x000001c5, 0x00000189, 0x00050080, 0x00000027, 0x000001c6,
-    0x000001c5, 0x00000125, 0x0003003e, 0x00000189, 0x000001c6, 0x000200f9, 0x0000019e, 0x000200f8,
-    0x000001a0, 0x000200f9, 0x0000019a, 0x000200f8, 0x000001c7, 0x0004003d, 0x00000027, 0x000001c8,
-    0x00000189, 0x0004003d, 0x00000027, 0x000001c9, 0x0000018e, 0x0007000c, 0x00000027, 0x000001ca,
-    0x00000001, 0x0000002a, 0x000001c8, 0x000001c9, 0x0003003e, 0x00000189, 0x000001ca, 0x000200f9,
-    0x0000019a, 0x000200f8, 0x0000019a, 0x00050041, 0x0000013b, 0x000001cc, 0x00000130, 0x00000142,
-    0x0004003d, 0x00000027, 0x000001cd, 0x000001cc, 0x00050041, 0x0000013b, 0x000001ce, 0x00000130,
-    0x00000125, 0x0004003d, 0x00000027, 0x000001cf, 0x000001ce, 0x0007000c, 0x00000027, 0x000001d0,
-    0x00000001, 0x00000027, 0x000001cd, 0x000001cf, 0x0004003d, 0x00000027, 0x000001d1, 0x0000018d,
-    0x0007000c, 0x00000027, 0x000001d2, 0x00000001, 0x00000027, 0x000001d0, 0x000001d1, 0x0003003e,
-    0x000001cb, 0x000001d2, 0x0004003d, 0x00000027, 0x000001d3, 0x00000189, 0x0004003d, 0x00000027,
-    0x000001d4, 0x000001cb, 0x0007000c, 0x00000027, 0x000001d5, 0x00000001, 0x0000002a, 0x000001d3,
-    0x000001d4, 0x0003003e, 0x00000189, 0x000001d5, 0x00050041, 0x0000013b, 0x000001d7, 0x00000130,
-    0x00000125, 0x0004003d, 0x00000027, 0x000001d8, 0x000001d7, 0x0004003d, 0x00000027, 0x000001d9,
-    0x0000018d, 0x0007000c, 0x00000027, 0x000001da, 0x00000001, 0x00000027, 0x000001d8, 0x000001d9,
-    0x0003003e, 0x000001d6, 0x000001da, 0x00050041, 0x0000013b, 0x000001db, 0x00000130, 0x00000147,
-    0x0004003d, 0x00000027, 0x000001dc, 0x000001db, 0x000500b1, 0x00000008, 0x000001dd, 0x000001dc,
-    0x00000034, 0x000300f7, 0x000001df, 0x00000000, 0x000400fa, 0x000001dd, 0x000001de, 0x000001df,
-    0x000200f8, 0x000001de, 0x00050041, 0x0000013b, 0x000001e1, 0x00000130, 0x0000017d, 0x0004003d,
-    0x00000027, 0x000001e2, 0x000001e1, 0x0003003e, 0x000001e0, 0x000001e2, 0x000200f9, 0x000001e3,
-    0x000200f8, 0x000001e3, 0x000400f6, 0x000001e5, 0x000001e6, 0x00000000, 0x000200f9, 0x000001e7,
-    0x000200f8, 0x000001e7, 0x0004003d, 0x00000027, 0x000001e8, 0x00000189, 0x0004003d, 0x00000027,
-    0x000001e9, 0x000001d6, 0x000500b1, 0x00000008, 0x000001ea, 0x000001e8, 0x000001e9, 0x000400fa,
-    0x000001ea, 0x000001e4, 0x000001e5, 0x000200f8, 0x000001e4, 0x0004003d, 0x00000027, 0x000001eb,
-    0x00000189, 0x0004007c, 0x00000006, 0x000001ec, 0x000001eb, 0x0004003d, 0x00000006, 0x000001ee,
-    0x00000118, 0x0003003e, 0x000001ed, 0x000001ee, 0x0003003e, 0x000001ef, 0x000001ec, 0x0004003d,
-    0x00000006, 0x000001f1, 0x0000017f, 0x0003003e, 0x000001f0, 0x000001f1, 0x00070039, 0x00000008,
-    0x000001f2, 0x00000014, 0x000001ed, 0x000001ef, 0x000001f0, 0x000400a8, 0x00000008, 0x000001f3,
-    0x000001f2, 0x000300f7, 0x000001f5, 0x00000000, 0x000400fa, 0x000001f3, 0x000001f4, 0x000001f5,
-    0x000200f8, 0x000001f4, 0x000200f9, 0x000001e6, 0x000200f8, 0x000001f5, 0x0004003d, 0x00000027,
-    0x000001f7, 0x00000189, 0x0004007c, 0x00000006, 0x000001f8, 0x000001f7, 0x0004003d, 0x00000027,
-    0x000001fa, 0x000001e0, 0x000500c3, 0x00000027, 0x000001fb, 0x000001fa, 0x00000147, 0x00050082,
-    0x00000027, 0x000001fc, 0x000001f9, 0x000001fb, 0x0007000c, 0x00000027, 0x000001fd, 0x00000001,
-    0x0000002a, 0x000001fc, 0x00000034, 0x0004007c, 0x00000006, 0x000001fe, 0x000001fd, 0x0004003d,
-    0x00000006, 0x00000200, 0x00000118, 0x0003003e, 0x000001ff, 0x00000200, 0x0003003e, 0x00000201,
-    0x000001f8, 0x0004003d, 0x00000006, 0x00000203, 0x0000017f, 0x0003003e, 0x00000202, 0x00000203,
-    0x0003003e, 0x00000204, 0x000001fe, 0x00080039, 0x00000002, 0x00000205, 0x0000001b, 0x000001ff,
-    0x00000201, 0x00000202, 0x00000204, 0x00050041, 0x0000013b, 0x00000206, 0x00000130, 0x00000147,
-    0x0004003d, 0x00000027, 0x00000207, 0x00000206, 0x000500c7, 0x00000027, 0x00000208, 0x00000207,
-    0x000001c1, 0x0004003d, 0x00000027, 0x00000209, 0x000001e0, 0x00050080, 0x00000027, 0x0000020a,
-    0x00000209, 0x00000208, 0x0003003e, 0x000001e0, 0x0000020a, 0x000200f9, 0x000001e6, 0x000200f8,
-    0x000001e6, 0x0004003d, 0x00000027, 0x0000020b, 0x00000189, 0x00050080, 0x00000027, 0x0000020c,
-    0x0000020b, 0x00000125, 0x0003003e, 0x00000189, 0x0000020c, 0x000200f9, 0x000001e3, 0x000200f8,
-    0x000001e5, 0x000200f9, 0x000001df, 0x000200f8, 0x000001df, 0x000100fd, 0x00010038, 0x00050036,
-    0x00000008, 0x0000000e, 0x00000000, 0x00000009, 0x00030037, 0x00000007, 0x0000000a, 0x00030037,
-    0x00000007, 0x0000000b, 0x00030037, 0x00000007, 0x0000000c, 0x00030037, 0x00000007, 0x0000000d,
-    0x000200f8, 0x0000000f, 0x0004003b, 0x00000007, 0x0000001d, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000021, 0x00000007, 0x0004003b, 0x00000007, 0x00000024, 0x00000007, 0x0004003b, 0x00000007,
-    0x0000002f, 0x00000007, 0x0004003b, 0x00000007, 0x00000039, 0x00000007, 0x0004003b, 0x00000007,
-    0x0000003d, 0x00000007, 0x0004003b, 0x00000007, 0x00000041, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000047, 0x00000007, 0x0004003b, 0x00000007, 0x00000068, 0x00000007, 0x0004003b, 0x00000007,
-    0x0000006b, 0x00000007, 0x0004003b, 0x00000007, 0x00000073, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000079, 0x00000007, 0x0004003b, 0x00000007, 0x0000008c, 0x00000007, 0x0004003d, 0x00000006,
-    0x0000001e, 0x0000000b, 0x00050086, 0x00000006, 0x00000020, 0x0000001e, 0x0000001f, 0x0003003e,
-    0x0000001d, 0x00000020, 0x0004003d, 0x00000006, 0x00000022, 0x0000000c, 0x00050086, 0x00000006,
-    0x00000023, 0x00000022, 0x0000001f, 0x0003003e, 0x00000021, 0x00000023, 0x0004003d, 0x00000006,
-    0x00000025, 0x0000001d, 0x0004003d, 0x00000006, 0x00000026, 0x00000021, 0x00050084, 0x00000006,
-    0x0000002d, 0x00000026, 0x0000002c, 0x00050080, 0x00000006, 0x0000002e, 0x00000025, 0x0000002d,
-    0x0003003e, 0x00000024, 0x0000002e, 0x0004003d, 0x00000006, 0x00000030, 0x0000000a, 0x00050041,
-    0x00000035, 0x00000036, 0x00000033, 0x00000034, 0x0004003d, 0x00000006, 0x00000037, 0x00000036,
-    0x00050082, 0x00000006, 0x00000038, 0x00000030, 0x00000037, 0x0003003e, 0x0000002f, 0x00000038,
-    0x0004003d, 0x00000006, 0x0000003a, 0x0000002f, 0x000500c2, 0x00000006, 0x0000003c, 0x0000003a,
-    0x0000003b, 0x0003003e, 0x00000039, 0x0000003c, 0x0004003d, 0x00000006, 0x0000003e, 0x0000002f,
-    0x000500c7, 0x00000006, 0x00000040, 0x0000003e, 0x0000003f, 0x0003003e, 0x0000003d, 0x00000040,
-    0x0004003d, 0x00000006, 0x00000042, 0x00000024, 0x00050084, 0x00000006, 0x00000044, 0x00000042,
-    0x00000043, 0x0004003d, 0x00000006, 0x00000045, 0x00000039, 0x00050080, 0x00000006, 0x00000046,
-    0x00000044, 0x00000045, 0x0003003e, 0x00000041, 0x00000046, 0x0004003d, 0x00000006, 0x00000058,
-    0x00000041, 0x0004007c, 0x00000027, 0x00000059, 0x00000058, 0x00050080, 0x00000027, 0x0000005a,
-    0x00000057, 0x00000059, 0x00060041, 0x0000005b, 0x0000005c, 0x00000050, 0x00000051, 0x0000005a,
-    0x0004003d, 0x00000006, 0x0000005d, 0x0000005c, 0x0003003e, 0x00000047, 0x0000005d, 0x0004003d,
-    0x00000006, 0x0000005e, 0x00000047, 0x0004003d, 0x00000006, 0x00000060, 0x0000003d, 0x000500c4,
-    0x00000006, 0x00000061, 0x0000005f, 0x00000060, 0x000500c7, 0x00000006, 0x00000062, 0x0000005e,
-    0x00000061, 0x000500aa, 0x00000008, 0x00000063, 0x00000062, 0x0000002b, 0x000300f7, 0x00000065,
-    0x00000000, 0x000400fa, 0x00000063, 0x00000064, 0x00000065, 0x000200f8, 0x00000064, 0x000200fe,
-    0x00000066, 0x000200f8, 0x00000065, 0x0004003d, 0x00000006, 0x00000069, 0x0000003d, 0x000500aa,
-    0x00000008, 0x0000006a, 0x00000069, 0x0000002b, 0x000300f7, 0x0000006d, 0x00000000, 0x000400fa,
-    0x0000006a, 0x0000006c, 0x0000006e, 0x000200f8, 0x0000006c, 0x0003003e, 0x0000006b, 0x0000002b,
-    0x000200f9, 0x0000006d, 0x000200f8, 0x0000006e, 0x0004003d, 0x00000006, 0x0000006f, 0x0000003d,
-    0x000500c4, 0x00000006, 0x00000070, 0x0000005f, 0x0000006f, 0x00050082, 0x00000006, 0x00000071,
-    0x00000070, 0x0000005f, 0x0003003e, 0x0000006b, 0x00000071, 0x000200f9, 0x0000006d, 0x000200f8,
-    0x0000006d, 0x0004003d, 0x00000006, 0x00000072, 0x0000006b, 0x0003003e, 0x00000068, 0x00000072,
-    0x0004003d, 0x00000006, 0x00000074, 0x00000047, 0x0004003d, 0x00000006, 0x00000075, 0x00000068,
-    0x000500c7, 0x00000006, 0x00000076, 0x00000074, 0x00000075, 0x000400cd, 0x00000027, 0x00000077,
-    0x00000076, 0x0004007c, 0x00000006, 0x00000078, 0x00000077, 0x0003003e, 0x00000073, 0x00000078,
-    0x0004003d, 0x00000006, 0x0000007e, 0x00000041, 0x0004007c, 0x00000027, 0x0000007f, 0x0000007e,
-    0x00050080, 0x00000027, 0x00000080, 0x0000007d, 0x0000007f, 0x00060041, 0x0000005b, 0x00000081,
-    0x00000050, 0x00000051, 0x00000080, 0x0004003d, 0x00000006, 0x00000082, 0x00000081, 0x0004003d,
-    0x00000006, 0x00000083, 0x00000073, 0x00050080, 0x00000006, 0x00000084, 0x00000082, 0x00000083,
-    0x0003003e, 0x00000079, 0x00000084, 0x0004003d, 0x00000006, 0x00000085, 0x00000079, 0x000500ae,
-    0x00000008, 0x00000088, 0x00000085, 0x00000087, 0x000300f7, 0x0000008a, 0x00000000, 0x000400fa,
-    0x00000088, 0x00000089, 0x0000008a, 0x000200f8, 0x00000089, 0x000200fe, 0x00000066, 0x000200f8,
-    0x0000008a, 0x0004003d, 0x00000006, 0x0000008d, 0x0000000c, 0x00050089, 0x00000006, 0x0000008e,
-    0x0000008d, 0x0000001f, 0x00050084, 0x00000006, 0x0000008f, 0x0000008e, 0x0000001f, 0x0004003d,
-    0x00000006, 0x00000090, 0x0000000b, 0x00050089, 0x00000006, 0x00000091, 0x00000090, 0x0000001f,
-    0x00050080, 0x00000006, 0x00000092, 0x0000008f, 0x00000091, 0x0003003e, 0x0000008c, 0x00000092,
-    0x0004003d, 0x00000006, 0x00000093, 0x00000079, 0x00050084, 0x00000006, 0x00000095, 0x00000093,
-    0x00000094, 0x0004003d, 0x00000006, 0x00000096, 0x0000008c, 0x00050080, 0x00000006, 0x00000097,
-    0x00000095, 0x00000096, 0x0003003e, 0x0000000d, 0x00000097, 0x000200fe, 0x00000098, 0x00010038,
-    0x00050036, 0x00000008, 0x00000014, 0x00000000, 0x00000010, 0x00030037, 0x00000007, 0x00000011,
-    0x00030037, 0x00000007, 0x00000012, 0x00030037, 0x00000007, 0x00000013, 0x000200f8, 0x00000015,
-    0x0004003b, 0x00000007, 0x0000009b, 0x00000007, 0x0004003b, 0x00000007, 0x0000009c, 0x00000007,
-    0x0004003b, 0x00000007, 0x0000009e, 0x00000007, 0x0004003b, 0x00000007, 0x000000a0, 0x00000007,
-    0x0004003b, 0x00000007, 0x000000a2, 0x00000007, 0x0004003d, 0x00000006, 0x0000009d, 0x00000011,
-    0x0003003e, 0x0000009c, 0x0000009d, 0x0004003d, 0x00000006, 0x0000009f, 0x00000012, 0x0003003e,
-    0x0000009e, 0x0000009f, 0x0004003d, 0x00000006, 0x000000a1, 0x00000013, 0x0003003e, 0x000000a0,
-    0x000000a1, 0x00080039, 0x00000008, 0x000000a3, 0x0000000e, 0x0000009c, 0x0000009e, 0x000000a0,
-    0x000000a2, 0x0004003d, 0x00000006, 0x000000a4, 0x000000a2, 0x0003003e, 0x0000009b, 0x000000a4,
-    0x000300f7, 0x000000a6, 0x00000000, 0x000400fa, 0x000000a3, 0x000000a5, 0x000000a6, 0x000200f8,
-    0x000000a5, 0x0004003d, 0x00000006, 0x000000ab, 0x0000009b, 0x00060041, 0x0000005b, 0x000000ac,
-    0x000000aa, 0x00000034, 0x000000ab, 0x0004003d, 0x00000006, 0x000000ad, 0x000000ac, 0x000500ab,
-    0x00000008, 0x000000ae, 0x000000ad, 0x0000002b, 0x000200f9, 0x000000a6, 0x000200f8, 0x000000a6,
-    0x000700f5, 0x00000008, 0x000000af, 0x000000a3, 0x00000015, 0x000000ae, 0x000000a5, 0x000300f7,
-    0x000000b1, 0x00000000, 0x000400fa, 0x000000af, 0x000000b0, 0x000000b1, 0x000200f8, 0x000000b0,
-    0x0004003d, 0x00000006, 0x000000b6, 0x0000009b, 0x00060041, 0x0000005b, 0x000000b7, 0x000000b5,
-    0x00000034, 0x000000b6, 0x0004003d, 0x00000006, 0x000000b8, 0x000000b7, 0x000500c7, 0x00000006,
-    0x000000ba, 0x000000b8, 0x000000b9, 0x000500ab, 0x00000008, 0x000000bb, 0x000000ba, 0x0000002b,
-    0x000200f9, 0x000000b1, 0x000200f8, 0x000000b1, 0x000700f5, 0x00000008, 0x000000bc, 0x000000af,
-    0x000000a6, 0x000000bb, 0x000000b0, 0x000200fe, 0x000000bc, 0x00010038, 0x00050036, 0x00000002,
-    0x0000001b, 0x00000000, 0x00000016, 0x00030037, 0x00000007, 0x00000017, 0x00030037, 0x00000007,
-    0x00000018, 0x00030037, 0x00000007, 0x00000019, 0x00030037, 0x00000007, 0x0000001a, 0x000200f8,
-    0x0000001c, 0x0004003b, 0x00000007, 0x000000bf, 0x00000007, 0x0004003b, 0x00000007, 0x000000c5,
-    0x00000007, 0x0004003b, 0x00000007, 0x000000e5, 0x00000007, 0x0004003d, 0x00000006, 0x000000c0,
-    0x00000019, 0x00050084, 0x00000006, 0x000000c2, 0x000000c0, 0x000000c1, 0x0004003d, 0x00000006,
-    0x000000c3, 0x00000018, 0x00050080, 0x00000006, 0x000000c4, 0x000000c2, 0x000000c3, 0x0003003e,
-    0x000000bf, 0x000000c4, 0x0003003e, 0x000000c5, 0x000000c6, 0x0004003d, 0x00000006, 0x000000cb,
-    0x000000bf, 0x00060041, 0x0000005b, 0x000000cc, 0x000000ca, 0x00000034, 0x000000cb, 0x0004003d,
-    0x00000006, 0x000000cd, 0x000000cc, 0x0004003d, 0x00000006, 0x000000ce, 0x00000017, 0x000500aa,
-    0x00000008, 0x000000cf, 0x000000cd, 0x000000ce, 0x000300f7, 0x000000d1, 0x00000000, 0x000400fa,
-    0x000000cf, 0x000000d0, 0x000000d3, 0x000200f8, 0x000000d0, 0x0004003d, 0x00000006, 0x000000d2,
-    0x000000bf, 0x0003003e, 0x000000c5, 0x000000d2, 0x000200f9, 0x000000d1, 0x000200f8, 0x000000d3,
-    0x0004003d, 0x00000006, 0x000000d6, 0x000000bf, 0x00050080, 0x00000006, 0x000000d7, 0x000000d5,
-    0x000000d6, 0x00060041, 0x0000005b, 0x000000d8, 0x000000ca, 0x00000034, 0x000000d7, 0x0004003d,
-    0x00000006, 0x000000d9, 0x000000d8, 0x0004003d, 0x00000006, 0x000000da, 0x00000017, 0x000500aa,
-    0x00000008, 0x000000db, 0x000000d9, 0x000000da, 0x000300f7, 0x000000dd, 0x00000000, 0x000400fa,
-    0x000000db, 0x000000dc, 0x000000dd, 0x000200f8, 0x000000dc, 0x0004003d, 0x00000006, 0x000000df,
-    0x000000bf, 0x00050080, 0x00000006, 0x000000e0, 0x000000de, 0x000000df, 0x0003003e, 0x000000c5,
-    0x000000e0, 0x000200f9, 0x000000dd, 0x000200f8, 0x000000dd, 0x000200f9, 0x000000d1, 0x000200f8,
-    0x000000d1, 0x0004003d, 0x00000006, 0x000000e1, 0x000000c5, 0x000500ab, 0x00000008, 0x000000e2,
-    0x000000e1, 0x000000c6, 0x000300f7, 0x000000e4, 0x00000000, 0x000400fa, 0x000000e2, 0x000000e3,
-    0x000000e4, 0x000200f8, 0x000000e3, 0x0004003d, 0x00000006, 0x000000f2, 0x000000c5, 0x00050080,
-    0x00000006, 0x000000f3, 0x000000f1, 0x000000f2, 0x00060041, 0x0000005b, 0x000000f4, 0x000000e9,
-    0x00000034, 0x000000f3, 0x0004003d, 0x00000006, 0x000000f5, 0x000000f4, 0x0003003e, 0x000000e5,
-    0x000000f5, 0x0004003d, 0x00000006, 0x000000f6, 0x000000c5, 0x00050080, 0x00000006, 0x000000f7,
-    0x000000f1, 0x000000f6, 0x0004003d, 0x00000006, 0x000000f8, 0x000000e5, 0x000500c7, 0x00000006,
-    0x000000fa, 0x000000f8, 0x000000f9, 0x0004003d, 0x00000006, 0x000000fb, 0x0000001a, 0x000500c7,
-    0x00000006, 0x000000fc, 0x000000fb, 0x0000003f, 0x000500c4, 0x00000006, 0x000000fe, 0x000000fc,
-    0x000000fd, 0x000500c5, 0x00000006, 0x000000ff, 0x000000fa, 0x000000fe, 0x00060041, 0x0000005b,
-    0x00000100, 0x000000e9, 0x00000034, 0x000000f7, 0x0003003e, 0x00000100, 0x000000ff, 0x000200f9,
-    0x000000e4, 0x000200f8, 0x000000e4, 0x000100fd, 0x00010038,
+const uint8_t Blob112_Data[4298] =
+{
+    0x28, 0xb5, 0x2f, 0xfd, 0x60, 0x94, 0x3f, 0x05, 0x86, 0x00, 0x8a, 0x8b, 0xb0, 0x21, 0x37, 0x10,
+    0x90, 0xca, 0xc5, 0x00, 0x4c, 0x91, 0x22, 0x13, 0x20, 0xe9, 0xe8, 0x02, 0x42, 0xad, 0xb7, 0x81,
+    0x2d, 0x90, 0x05, 0xb3, 0x98, 0x85, 0x16, 0x7b, 0x52, 0xca, 0x1b, 0x53, 0xa4, 0x12, 0x24, 0xa1,
+    0xb2, 0xd3, 0x2b, 0xe0, 0xe7, 0x10, 0x48, 0x6f, 0xd4, 0x5a, 0xbc, 0x8d, 0xd4, 0xe9, 0x2c, 0x50,
+    0x23, 0x88, 0x52, 0x32, 0xb9, 0x53, 0xcd, 0x01, 0xfa, 0x01, 0x27, 0x02, 0x33, 0x12, 0x86, 0xe7,
+    0xeb, 0x78, 0xf4, 0xad, 0xe6, 0xf4, 0xda, 0xdb, 0x1a, 0x2b, 0x37, 0xb1, 0xcd, 0x6f, 0xab, 0xf1,
+    0xb8, 0x69, 0xcc, 0xff, 0xe7, 0xe2, 0x69, 0xcb, 0x7f, 0x1d, 0x67, 0x8b, 0xe5, 0x19, 0xfe, 0xfa,
+    0x67, 0x3e, 0x4e, 0x7b, 0xb3, 0x16, 0x10, 0x44, 0xbd, 0x5e, 0x6f, 0xed, 0x2c, 0x55, 0x8a, 0x66,
+    0xef, 0x20, 0x70, 0xb6, 0x9b, 0xb6, 0xeb, 0xde, 0xd7, 0xba, 0x1b, 0x8f, 0xe9, 0xfd, 0xfe, 0xc3,
+    0xb0, 0xa0, 0x97, 0xf3, 0xd0, 0x28, 0x27, 0xeb, 0xef, 0x4d, 0xd3, 0xfd, 0x4b, 0x3e, 0x1d, 0x59,
+    0x73, 0xed, 0x7c, 0xcf, 0xda, 0xd5, 0x6a, 0x6a, 0x1e, 0xff, 0x6d, 0xed, 0x97, 0x7f, 0xbc, 0x46,
+    0x2c, 0xcf, 0xa8, 0xbf, 0xfc, 0xfb, 0x5e, 0xb6, 0x88, 0xa8, 0x7f, 0xf7, 0x3e, 0x7c, 0x21, 0x85,
+    0x84, 0x7b, 0x74, 0x4e, 0x7b, 0x7d, 0xdc, 0x83, 0x79, 0x8d, 0xe3, 0x6c, 0xfb, 0x8b, 0xe7, 0xa3,
+    0xdd, 0x54, 0xe8, 0x24, 0xfe, 0x99, 0x77, 0x43, 0xf4, 0xdd, 0x34, 0x6e, 0x73, 0xf3, 0xae, 0x9e,
+    0xd7, 0x21, 0xf2, 0x72, 0x7a, 0xcf, 0x6a, 0xdf, 0xa9, 0x67, 0xb1, 0x0f, 0xc7, 0xc5, 0xcb, 0xdc,
+    0xcc, 0x98, 0xff, 0xcb, 0x9b, 0xae, 0xb1, 0x31, 0x12, 0xb7, 0xde, 0xf3, 0x6e, 0x16, 0xfe, 0xff,
+    0x76, 0xcf, 0xf4, 0xf2, 0xae, 0xf6, 0x9f, 0x79, 0x7d, 0x77, 0xf7, 0x35, 0xdb, 0xef, 0xaf, 0x5e,
+    0x63, 0x71, 0xdb, 0xec, 0xed, 0xaf, 0xff, 0x7a, 0x7a, 0xd9, 0x6e, 0xdb, 0x8d, 0x79, 0xbf, 0xdd,
+    0x1c, 0x4f, 0x6c, 0xeb, 0x5d, 0xf0, 0x5c, 0xda, 0x5b, 0xe7, 0x6c, 0xee, 0xb5, 0x7e, 0x77, 0x57,
+    0xe1, 0x82, 0xfc, 0x75, 0xfe, 0xdd, 0xbd, 0xf4, 0x99, 0xce, 0xd6, 0x74, 0xca, 0x31, 0x3f, 0xeb,
+    0xa5, 0xf3, 0xe5, 0x9e, 0x87, 0x67, 0xd7, 0x6b, 0xf1, 0xf3, 0xd5, 0xb0, 0x9d, 0xd3, 0x74, 0xf9,
+    0xf7, 0x65, 0x7d, 0xc7, 0xe9, 0x5d, 0xc7, 0xbb, 0x67, 0x79, 0xfa, 0x17, 0x6e, 0x7e, 0xb8, 0x9b,
+    0xde, 0x76, 0xef, 0x04, 0xdf, 0x96, 0xd7, 0x70, 0x7a, 0x57, 0xde, 0xce, 0xb5, 0xb5, 0x78, 0x5d,
+    0xe7, 0xdb, 0x2c, 0xd7, 0xe7, 0xb4, 0x80, 0x0b, 0x5a, 0x16, 0xac, 0x9e, 0xf9, 0xdb, 0x29, 0xa9,
+    0x28, 0x28, 0x3c, 0xdc, 0xc6, 0x71, 0x5b, 0x5b, 0xef, 0x76, 0xae, 0xa5, 0xa2, 0x36, 0x4d, 0x9f,
+    0x5b, 0xef, 0xde, 0x7a, 0xbb, 0x2d, 0xd3, 0x69, 0x6d, 0x75, 0x57, 0xea, 0x8b, 0xf2, 0x41, 0x9b,
+    0xcf, 0x57, 0x73, 0x71, 0x36, 0xbc, 0x8b, 0xd7, 0x77, 0x77, 0xbd, 0x49, 0x2f, 0xbf, 0x75, 0xfe,
+    0x72, 0xdd, 0x35, 0x9f, 0x0d, 0x57, 0xdf, 0xb6, 0x5c, 0x8d, 0x47, 0xe7, 0x35, 0x88, 0xee, 0xd9,
+    0xd2, 0x27, 0x3d, 0x93, 0xfb, 0xbd, 0xb7, 0xb8, 0xfd, 0xac, 0x41, 0xd8, 0xfb, 0xb6, 0xce, 0x6d,
+    0x6e, 0x5d, 0x8d, 0xdb, 0x77, 0x5d, 0x7d, 0xf7, 0xed, 0x7a, 0x9d, 0xd7, 0xbb, 0xad, 0x4b, 0x6b,
+    0xbb, 0x56, 0xa8, 0x70, 0xad, 0x4b, 0x82, 0xb7, 0xc4, 0xcb, 0x27, 0x9b, 0x32, 0xa5, 0xcc, 0xc7,
+    0x6d, 0x7a, 0x8f, 0xd9, 0x64, 0x82, 0xff, 0x97, 0xbf, 0xf4, 0x5f, 0x61, 0x60, 0x08, 0xb8, 0xbb,
+    0x8e, 0xa0, 0x2d, 0xdb, 0x76, 0x85, 0x5f, 0x7e, 0x28, 0x02, 0xf8, 0xe3, 0x9f, 0x7e, 0x8c, 0xf5,
+    0xcf, 0x87, 0x3e, 0xbc, 0x7c, 0x67, 0x80, 0x78, 0x19, 0xf2, 0x16, 0x82, 0x9f, 0xfa, 0xab, 0x01,
+    0x4f, 0x6d, 0x9a, 0x36, 0xc1, 0xdf, 0x9c, 0x4a, 0xad, 0x39, 0x99, 0xe4, 0x26, 0xcc, 0xb4, 0xc2,
+    0xcb, 0x65, 0xfc, 0x74, 0x54, 0x59, 0x09, 0xa9, 0x28, 0x10, 0xa5, 0x20, 0x40, 0x81, 0xfe, 0x00,
+    0xfa, 0xe3, 0xc7, 0x8b, 0xb2, 0x8f, 0x9f, 0x39, 0x3e, 0x7d, 0xf8, 0x4c, 0xee, 0x91, 0xdc, 0xa3,
+    0x47, 0x52, 0x0f, 0x1d, 0x35, 0x6b, 0xb0, 0x81, 0x6a, 0x1e, 0xc1, 0x7c, 0x01, 0xe3, 0xf8, 0xc5,
+    0xd1, 0xaa, 0xd2, 0x0b, 0x97, 0x16, 0x40, 0x29, 0x32, 0xe3, 0xa2, 0x93, 0x26, 0x8b, 0x4d, 0xa2,
+    0x88, 0xd6, 0xc3, 0x23, 0x46, 0x8c, 0xec, 0x28, 0xf0, 0x37, 0xbc, 0x00, 0x57, 0x7c, 0xbd, 0x0a,
+    0x3f, 0x2d, 0x89, 0x11, 0x22, 0xfc, 0xc8, 0x46, 0x88, 0xb8, 0x7b, 0x76, 0xd5, 0xc9, 0x19, 0xe8,
+    0xc0, 0xb4, 0x73, 0x72, 0x74, 0xf1, 0x5c, 0x36, 0x50, 0x0e, 0x9b, 0xcd, 0x82, 0x65, 0xc6, 0x45,
+    0xe1, 0xac, 0x6f, 0xd1, 0x0a, 0x6e, 0x14, 0x26, 0x38, 0x7f, 0xf9, 0x56, 0x6d, 0x55, 0x6b, 0x55,
+    0xcf, 0xc6, 0x5c, 0x83, 0x22, 0x3b, 0xc3, 0x92, 0xd0, 0xb4, 0xca, 0x61, 0x60, 0x0b, 0xac, 0x33,
+    0x92, 0x02, 0x79, 0x4b, 0x9e, 0xaf, 0xbc, 0x00, 0xe5, 0xf7, 0x2a, 0xb0, 0xa2, 0xeb, 0xc1, 0x0a,
+    0x78, 0x3d, 0x97, 0x02, 0x78, 0x2b, 0x0b, 0xcb, 0x2b, 0x7e, 0x92, 0x9f, 0xce, 0x67, 0x55, 0x76,
+    0x3a, 0xb3, 0x5e, 0x76, 0x8a, 0x97, 0x31, 0x55, 0xea, 0xaa, 0x59, 0x55, 0x35, 0xc5, 0x94, 0x7a,
+    0x5a, 0x43, 0x23, 0x83, 0xe0, 0x00, 0x2c, 0xfe, 0x7a, 0xc6, 0x4c, 0xf8, 0xbf, 0x2a, 0x4f, 0xe3,
+    0xb0, 0xb0, 0x05, 0x1d, 0x64, 0x05, 0x1a, 0xa0, 0x2c, 0x3c, 0xc9, 0x39, 0xc1, 0x55, 0xdb, 0xa8,
+    0x6b, 0x4d, 0x68, 0x53, 0x32, 0x29, 0x04, 0x26, 0x07, 0x4b, 0x60, 0x4a, 0x5f, 0x51, 0x03, 0x50,
+    0xae, 0x24, 0x01, 0x48, 0x59, 0xcf, 0x39, 0x89, 0x5a, 0xc5, 0x74, 0x4e, 0x4e, 0x4a, 0x4a, 0xea,
+    0x91, 0x3e, 0x3e, 0x7e, 0xf9, 0xe2, 0x28, 0x33, 0x32, 0x2e, 0x2e, 0x36, 0x41, 0x44, 0x3c, 0xfc,
+    0x43, 0x23, 0xb1, 0x0a, 0x18, 0xfb, 0xd4, 0x7a, 0x00, 0x70, 0x6f, 0x9f, 0x65, 0x59, 0x18, 0x03,
+    0xc2, 0xff, 0x6f, 0x6e, 0x6d, 0x4c, 0x0a, 0xd2, 0x09, 0xbf, 0xac, 0x72, 0x46, 0xc9, 0xd5, 0xa6,
+    0x94, 0x19, 0x5d, 0x3e, 0x63, 0x26, 0x1c, 0xe0, 0xd7, 0x9e, 0xeb, 0x5a, 0x35, 0xf5, 0x4f, 0xef,
+    0xa5, 0xf7, 0x76, 0xdb, 0x0c, 0xfa, 0xfc, 0xa4, 0xdf, 0xef, 0xec, 0xbc, 0x2c, 0x12, 0x5e, 0x57,
+    0xed, 0xf9, 0xce, 0xff, 0x9c, 0xae, 0xef, 0xb3, 0xff, 0xfa, 0xb6, 0xa3, 0xe5, 0xf0, 0x6e, 0x77,
+    0xc7, 0xcf, 0xbc, 0xba, 0x8d, 0xb6, 0x6c, 0xfe, 0xff, 0x5d, 0x8d, 0xa5, 0xf3, 0xbc, 0x77, 0x59,
+    0x0c, 0xbf, 0xbe, 0xf7, 0x7d, 0xfb, 0xbd, 0xbc, 0x7b, 0x67, 0xe3, 0x73, 0xf4, 0x5e, 0xbb, 0x55,
+    0x9f, 0x19, 0xc7, 0x70, 0x65, 0x20, 0x40, 0x94, 0x90, 0x9f, 0xb3, 0xe9, 0xe3, 0x76, 0xed, 0xc2,
+    0x58, 0xa1, 0x32, 0x25, 0x4a, 0x22, 0xa2, 0xf7, 0xf0, 0xf9, 0x06, 0xf7, 0xbb, 0xfa, 0x8e, 0xd1,
+    0xd4, 0x61, 0xf0, 0x09, 0xf6, 0xfd, 0x85, 0xbd, 0xbe, 0xe0, 0x9d, 0xf3, 0x3c, 0xcf, 0xf3, 0x3c,
+    0xcf, 0xf3, 0x3c, 0xcf, 0xf3, 0x3c, 0xcf, 0xf3, 0x3c, 0xcf, 0xf3, 0x3c, 0xcf, 0xf3, 0x7f, 0x61,
+    0xa1, 0xfe, 0xa6, 0xed, 0xdd, 0xc6, 0xd9, 0x9e, 0xe8, 0x9c, 0xe6, 0xaa, 0x74, 0xd4, 0x9f, 0xeb,
+    0x6e, 0x9b, 0xe4, 0xa9, 0xf4, 0x67, 0x26, 0xb3, 0xa5, 0xab, 0xd2, 0x7f, 0x61, 0xa3, 0x4d, 0x2d,
+    0x54, 0x9b, 0x14, 0x5e, 0x04, 0x1b, 0x83, 0x04, 0xe9, 0xb2, 0x85, 0x4b, 0x17, 0x40, 0x2e, 0x5a,
+    0xb2, 0x6c, 0x71, 0xcc, 0x82, 0xc5, 0x0a, 0x95, 0x29, 0x54, 0x57, 0x62, 0x31, 0x28, 0x56, 0xaa,
+    0x50, 0xa9, 0xb2, 0x38, 0x45, 0x4a, 0x14, 0x29, 0x12, 0x08, 0x40, 0x91, 0x19, 0x9f, 0x5c, 0x9d,
+    0x30, 0x72, 0x19, 0x74, 0xd2, 0x64, 0xb1, 0x89, 0x62, 0x90, 0x25, 0x8a, 0x4b, 0x94, 0x28, 0x26,
+    0x51, 0x92, 0x88, 0x58, 0x4d, 0x22, 0x86, 0x24, 0xf1, 0x0f, 0x89, 0x11, 0xc4, 0x23, 0x87, 0x51,
+    0x47, 0x0c, 0x8d, 0xc8, 0x7e, 0x86, 0x40, 0x0a, 0x81, 0xfc, 0xff, 0x90, 0x22, 0x31, 0x88, 0x08,
+    0x0e, 0x11, 0x22, 0x24, 0x48, 0xe1, 0x21, 0x42, 0xc2, 0x1f, 0x83, 0x3e, 0x7e, 0xf8, 0xe0, 0xe1,
+    0xc8, 0x63, 0x47, 0x0f, 0x1d, 0x3b, 0x98, 0xe8, 0x88, 0xcb, 0xf1, 0x31, 0x6e, 0xd8, 0xc0, 0x01,
+    0xe3, 0x46, 0x0d, 0x1b, 0x34, 0x6a, 0xd0, 0x90, 0x31, 0x63, 0x4e, 0x06, 0x17, 0x8c, 0x17, 0x82,
+    0x5d, 0xf0, 0x8b, 0x8f, 0xba, 0xd8, 0x6a, 0xb1, 0x42, 0xc5, 0x0a, 0x15, 0x29, 0x56, 0x04, 0xa2,
+    0x48, 0xf1, 0x87, 0xe2, 0xc4, 0x9f, 0x89, 0x13, 0x30, 0xa0, 0x09, 0xbf, 0x12, 0x24, 0x4a, 0x40,
+    0xf9, 0xf5, 0x8d, 0x10, 0x31, 0xe2, 0xa9, 0x0f, 0x04, 0x5f, 0x08, 0x3e, 0x27, 0x10, 0xfa, 0x77,
+    0xff, 0x56, 0x75, 0x6f, 0xfe, 0x21, 0xa7, 0x7a, 0xf7, 0xba, 0x78, 0xb7, 0x69, 0xcf, 0xc3, 0xad,
+    0x77, 0x4f, 0x3d, 0xe0, 0xd9, 0x79, 0xb6, 0x14, 0x8f, 0x7b, 0x57, 0xdf, 0x31, 0x71, 0xe9, 0xad,
+    0xdd, 0x76, 0x89, 0xe6, 0xd0, 0xa1, 0xae, 0x83, 0x12, 0x87, 0x0c, 0x1b, 0x34, 0x6c, 0x88, 0x66,
+    0xb0, 0x80, 0xe1, 0x02, 0x06, 0xa8, 0x85, 0x39, 0x2d, 0x9d, 0x36, 0x69, 0x0e, 0x2b, 0x97, 0x95,
+    0x43, 0xc2, 0x56, 0x88, 0x83, 0x8b, 0x7b, 0x56, 0x68, 0x7b, 0x73, 0x7b, 0x73, 0xb6, 0xc9, 0x6c,
+    0x14, 0x26, 0x50, 0x90, 0xd9, 0xd4, 0xd6, 0xae, 0x6b, 0x4d, 0x35, 0xb4, 0xb4, 0xb8, 0x34, 0x26,
+    0x5a, 0xd9, 0x99, 0xd9, 0xd9, 0xb2, 0x4c, 0x02, 0xd9, 0x1c, 0x59, 0x2c, 0x61, 0x40, 0x04, 0x78,
+    0xec, 0x0b, 0x82, 0xf5, 0x1f, 0x6c, 0xc5, 0x89, 0xcd, 0x0c, 0xc0, 0x1c, 0xc8, 0xcf, 0xc0, 0x80,
+    0x97, 0x01, 0xaf, 0x2e, 0x03, 0x59, 0x57, 0x5d, 0x4f, 0x43, 0x5a, 0xf1, 0x2b, 0xe2, 0x02, 0x50,
+    0x60, 0x8b, 0x4b, 0x06, 0x24, 0xb0, 0x35, 0x80, 0x40, 0x00, 0x01, 0x01, 0x00, 0x64, 0x69, 0x65,
+    0x61, 0x69, 0x5d, 0x61, 0x3d, 0x0f, 0xad, 0xa8, 0xae, 0x14, 0xab, 0xac, 0xc0, 0xaa, 0xa2, 0xa8,
+    0xa6, 0xa2, 0xa4, 0xa6, 0xa4, 0x52, 0x4e, 0x28, 0xe9, 0x13, 0xd4, 0x5a, 0x9d, 0xd3, 0x93, 0x9f,
+    0x13, 0xb5, 0x3a, 0x55, 0x82, 0xff, 0xa3, 0xd0, 0x45, 0xaf, 0x84, 0xe8, 0x1f, 0xfa, 0x54, 0x82,
+    0x94, 0x34, 0xb7, 0x00, 0x29, 0x0c, 0x7e, 0xc2, 0xcb, 0x8f, 0xe0, 0x1c, 0xf3, 0x92, 0x9b, 0x65,
+    0xcc, 0x38, 0x86, 0x2b, 0x03, 0x01, 0xa2, 0x84, 0x64, 0x13, 0xc6, 0x0a, 0x95, 0x29, 0x51, 0x12,
+    0x11, 0x0f, 0x07, 0x63, 0xc0, 0x10, 0xb4, 0xfe, 0x7d, 0x45, 0x39, 0xa5, 0x56, 0xd8, 0xd9, 0x4c,
+    0xb4, 0xfc, 0x98, 0x41, 0x5d, 0x1c, 0x1b, 0x78, 0xab, 0x68, 0x15, 0xd5, 0x54, 0x94, 0x4a, 0xea,
+    0x4a, 0x8a, 0x19, 0x05, 0xf5, 0x64, 0x75, 0xfa, 0xff, 0xa9, 0x5c, 0xbd, 0x6a, 0xa2, 0x66, 0x35,
+    0x3d, 0xad, 0x55, 0x49, 0x9f, 0x4c, 0x59, 0x96, 0x62, 0x25, 0x2c, 0x45, 0xcb, 0x4a, 0x2d, 0x5e,
+    0xd8, 0xc0, 0x25, 0xa0, 0x0c, 0x45, 0xe2, 0x49, 0x84, 0x53, 0x88, 0xea, 0x4e, 0xfd, 0xd0, 0x84,
+    0x4f, 0xf5, 0xa4, 0x79, 0x4c, 0xf5, 0x92, 0x9d, 0x52, 0x5d, 0x54, 0x03, 0xf4, 0x42, 0x12, 0x1d,
+    0x52, 0xf6, 0x09, 0xe7, 0x74, 0x93, 0x27, 0x34, 0xaf, 0x4b, 0xb3, 0x2d, 0xeb, 0xdc, 0x20, 0x2b,
+    0xcc, 0x1a, 0x05, 0xcb, 0x9a, 0x15, 0xcc, 0x09, 0xb6, 0x02, 0x9f, 0x27, 0x4f, 0xe5, 0x23, 0x82,
+    0xff, 0x51, 0x65, 0xa3, 0xa3, 0x47, 0x5d, 0x24, 0x34, 0x9a, 0x62, 0xa4, 0x68, 0x91, 0x63, 0x64,
+    0xa2, 0x43, 0x88, 0x0e, 0x19, 0x8a, 0x2c, 0x64, 0x88, 0xd0, 0x64, 0xa1, 0x41, 0x82, 0x08, 0x35,
+    0x0e, 0xc2, 0x93, 0x07, 0xcf, 0x9d, 0x3c, 0x5e, 0xee, 0x34, 0xda, 0x39, 0x33, 0x67, 0x0e, 0x64,
+    0x1d, 0x3a, 0x90, 0x75, 0xe4, 0xcc, 0x91, 0x13, 0x67, 0x0e, 0x9c, 0x38, 0x70, 0xdc, 0xbc, 0x69,
+    0xe3, 0x86, 0xcd, 0x9a, 0x36, 0x6c, 0xd2, 0x9c, 0x41, 0x83, 0x05, 0x8d, 0x99, 0x34, 0x66, 0xca,
+    0x9c, 0x21, 0x53, 0x06, 0x8a, 0x8c, 0x98, 0x31, 0x61, 0x1e, 0xc5, 0x60, 0x09, 0xe3, 0xa5, 0xb1,
+    0x0b, 0x16, 0x2e, 0x5d, 0xa2, 0xb8, 0x68, 0xd9, 0x22, 0x95, 0x25, 0xb2, 0x11, 0x4b, 0xd5, 0x94,
+    0x54, 0x14, 0xd4, 0x13, 0x55, 0x5c, 0x45, 0xd1, 0xb0, 0x0a, 0x13, 0x26, 0x53, 0xa8, 0x48, 0x99,
+    0x02, 0x25, 0xca, 0x13, 0x46, 0x28, 0x4f, 0x14, 0x99, 0x28, 0x2e, 0x61, 0x52, 0xc4, 0x69, 0x89,
+    0x21, 0x43, 0xc3, 0x24, 0x4a, 0x12, 0x93, 0x24, 0x82, 0x21, 0x22, 0x19, 0x4c, 0x2c, 0x62, 0x58,
+    0x64, 0x88, 0x21, 0x91, 0x41, 0x21, 0x44, 0x84, 0x10, 0x2e, 0x0d, 0x79, 0x8a, 0x15, 0x52, 0x83,
+    0x10, 0x36, 0x01, 0xf1, 0x31, 0xfd, 0x21, 0xa4, 0x90, 0xd0, 0xc7, 0xa0, 0x13, 0xb5, 0x69, 0x2a,
+    0xad, 0xee, 0xd0, 0xa1, 0x94, 0x43, 0xc7, 0x8b, 0x1c, 0x37, 0x70, 0xd8, 0xa8, 0xf1, 0x82, 0x46,
+    0x0d, 0x40, 0x1a, 0xd0, 0x19, 0x58, 0x32, 0x02, 0xb1, 0x62, 0xc8, 0x82, 0x51, 0x18, 0x2d, 0x04,
+    0x5b, 0x08, 0xb2, 0x68, 0xb1, 0x82, 0x85, 0x92, 0xbe, 0x14, 0x81, 0x7d, 0x28, 0x02, 0x75, 0x14,
+    0x26, 0x4e, 0x00, 0x9a, 0xf8, 0x23, 0x01, 0x58, 0xe2, 0xaf, 0x04, 0x9f, 0x1e, 0x82, 0xcf, 0x2f,
+    0xc4, 0x98, 0x1d, 0x84, 0x63, 0xde, 0x77, 0xcf, 0xf3, 0xf4, 0xf2, 0xbd, 0x0f, 0x1f, 0x4e, 0x74,
+    0xbd, 0x5d, 0x7c, 0xcf, 0x4b, 0xef, 0xc6, 0x6f, 0x0f, 0x7b, 0xb6, 0x07, 0xbb, 0xbe, 0x7b, 0xf4,
+    0x5f, 0x73, 0xff, 0x6b, 0xaf, 0x2d, 0x22, 0x6d, 0xd7, 0xa1, 0x8e, 0xee, 0x32, 0xd6, 0xe1, 0xca,
+    0x61, 0xc3, 0x55, 0xc3, 0x06, 0x0c, 0x71, 0x70, 0x1a, 0x32, 0x94, 0x69, 0x31, 0x5c, 0xf0, 0x2b,
+    0xb3, 0xa0, 0x56, 0x96, 0xa6, 0x06, 0x28, 0x96, 0x76, 0x86, 0x26, 0xc0, 0x8c, 0x6c, 0x4c, 0x02,
+    0x99, 0xa3, 0x98, 0x15, 0xc2, 0x96, 0x07, 0x0e, 0x12, 0x7c, 0x39, 0x38, 0xd1, 0x00, 0x6c, 0x01,
+    0x83, 0xb0, 0x2f, 0x01, 0x07, 0x10, 0x00, 0x1a, 0x38, 0x10, 0xa8, 0x45, 0xc0, 0x6a, 0x80, 0x56,
+    0x80, 0x28, 0x00, 0x2b, 0xac, 0x2c, 0x15, 0xd0, 0x2b, 0x79, 0xec, 0x45, 0x9f, 0xae, 0x97, 0x77,
+    0x2d, 0x1b, 0x13, 0x4b, 0x20, 0x40, 0xeb, 0xad, 0x98, 0x94, 0xa2, 0x50, 0x67, 0x03, 0xa4, 0x5f,
+    0x62, 0xe0, 0xa0, 0x4e, 0x9d, 0x48, 0x3c, 0xd1, 0x18, 0xfa, 0x9f, 0x04, 0x89, 0xf4, 0xff, 0x94,
+    0x9d, 0xb1, 0xfc, 0x1f, 0xc3, 0x95, 0xcd, 0x47, 0xcc, 0x65, 0x1c, 0x2f, 0x13, 0xc1, 0xf1, 0x57,
+    0xc6, 0x2f, 0x3b, 0x7a, 0xf4, 0x60, 0x5d, 0x8e, 0x18, 0x29, 0x6a, 0x74, 0x62, 0x11, 0x23, 0xc8,
+    0x45, 0x88, 0x12, 0x21, 0x32, 0xa4, 0xa7, 0x90, 0xa1, 0x42, 0x84, 0x0c, 0x0d, 0x22, 0x14, 0x08,
+    0x10, 0xe5, 0x20, 0x41, 0x81, 0x04, 0xf9, 0x01, 0xf4, 0x87, 0xf2, 0x4f, 0x1f, 0x3f, 0x7d, 0xf2,
+    0x44, 0xe6, 0xe1, 0x33, 0xb9, 0x87, 0x0f, 0x9b, 0xc9, 0x3d, 0x92, 0x92, 0x7a, 0x22, 0xf1, 0xe0,
+    0xb9, 0x03, 0x69, 0xe7, 0x0e, 0x09, 0x3b, 0x74, 0xea, 0xd0, 0x99, 0x53, 0x47, 0xce, 0x9c, 0x38,
+    0x72, 0xae, 0x71, 0xe0, 0xb0, 0x79, 0xe3, 0x06, 0xce, 0x9b, 0x36, 0x6e, 0xda, 0xac, 0x51, 0x93,
+    0x66, 0x4d, 0x18, 0x35, 0x69, 0xd0, 0x84, 0x39, 0x63, 0x06, 0x0d, 0x8c, 0x33, 0x65, 0xcc, 0x90,
+    0x29, 0x33, 0x80, 0x8c, 0x98, 0x31, 0x66, 0x62, 0x7a, 0x3c, 0x82, 0xe9, 0x7a, 0x8c, 0x01, 0xe6,
+    0x8b, 0x63, 0x8f, 0x42, 0x42, 0x2f, 0x82, 0x03, 0x1a, 0x03, 0x87, 0xd7, 0xa8, 0xe3, 0x91, 0x8e,
+    0x48, 0x46, 0x4a, 0x92, 0x14, 0x96, 0x39, 0x63, 0x59, 0x19, 0x08, 0x89, 0x69, 0xdc, 0xd2, 0xf3,
+    0x03, 0x85, 0x40, 0x10, 0x92, 0xc9, 0x50, 0xc8, 0x22, 0xe2, 0x82, 0xc2, 0x82, 0xc2, 0xec, 0xff,
+    0x8c, 0x01, 0x1b, 0x5d, 0xb3, 0x26, 0x5d, 0xbb, 0xc3, 0xba, 0xd6, 0xd2, 0x30, 0x25, 0x22, 0x57,
+    0x87, 0xf2, 0x1f, 0xe6, 0xd5, 0x02, 0x9d, 0x98, 0xdc, 0x14, 0x1f, 0x7d, 0xb8, 0xff, 0xd1, 0x17,
+    0x58, 0x5b, 0x6b, 0x0b, 0x37, 0xdb, 0xc5, 0x97, 0x1d, 0x29, 0x9e, 0x51, 0xcf, 0x95, 0x00, 0x70,
+    0x91, 0xe2, 0x0a, 0xef, 0x43, 0xb6, 0x93, 0xf4, 0x30, 0x6b, 0xf9, 0x9a, 0xf9, 0xaf, 0x8b, 0x59,
+    0xf2, 0x07, 0xf1, 0x05, 0xb2, 0x21, 0xbd, 0x93, 0x1e, 0xd4, 0x03, 0xd3, 0x6a, 0xf2, 0x3b, 0x04,
+    0x3f, 0xcb, 0x5e, 0x1b, 0xb9, 0x96, 0x88, 0xea, 0x05, 0x57, 0xe3, 0xea, 0x19, 0x3d, 0xe3, 0xe8,
+    0x0a, 0xd7, 0x23, 0xed, 0xf6, 0xe8, 0xc7, 0xa8, 0xec, 0xde, 0xa3, 0x98, 0xf9, 0xd6, 0x56, 0xad,
+    0xb3, 0xea, 0x16, 0x37, 0x78, 0x99, 0x07, 0x79, 0xad, 0xfc, 0xc8, 0x73, 0x7c, 0x28, 0xb8, 0x28,
+    0x73, 0x6b, 0x06, 0xc7, 0xff, 0xd8, 0xdf, 0x40, 0xdf, 0xb8, 0xdc, 0x07, 0xdc, 0x4e, 0xcf, 0x38,
+    0x0c, 0xfe, 0xcd, 0x41, 0xfa, 0x51, 0x5c, 0x2e, 0x47, 0x37, 0x53, 0x4b, 0x44, 0x99, 0xe7, 0x92,
+    0xbb, 0xbb, 0xb0, 0xa3, 0xd0, 0x1e, 0x38, 0x1e, 0x6a, 0xda, 0xaf, 0xfc, 0x31, 0x61, 0x7b, 0x88,
+    0x1d, 0x7b, 0x33, 0xb6, 0x44, 0x5d, 0xb5, 0x97, 0x20, 0xd1, 0x4d, 0x7c, 0x2b, 0x69, 0xea, 0xea,
+    0x7e, 0x45, 0xfe, 0x5f, 0xb9, 0xbb, 0xdd, 0x41, 0x9d, 0xa1, 0xd3, 0xdc, 0x30, 0x4e, 0x7c, 0xd6,
+    0xc5, 0x61, 0xc7, 0x13, 0x63, 0x8f, 0xd4, 0xae, 0x79, 0x23, 0x6f, 0x9b, 0x38, 0xc0, 0x8b, 0xc7,
+    0x3d, 0x2e, 0xf0, 0x6a, 0xe8, 0xbc, 0x78, 0x17, 0xb1, 0xef, 0x8c, 0xef, 0xa5, 0x1f, 0xed, 0x99,
+    0x76, 0x69, 0xba, 0xcb, 0x6a, 0x99, 0x79, 0xba, 0x85, 0x2d, 0x9d, 0x73, 0x71, 0xed, 0x7a, 0x5b,
+    0x96, 0xc1, 0x30, 0x3f, 0xf6, 0x08, 0x5f, 0x7c, 0xc7, 0xfe, 0x8b, 0xff, 0xde, 0x5b, 0xed, 0xff,
+    0xe2, 0xb2, 0x1b, 0x6b, 0x42, 0x64, 0xab, 0x14, 0x31, 0x6d, 0xc5, 0xab, 0x80, 0x87, 0xfd, 0xbd,
+    0xaa, 0xe2, 0x42, 0x5e, 0x81, 0x73, 0x0c, 0x65, 0xb9, 0xf5, 0x22, 0xad, 0xc3, 0x7f, 0x07, 0xec,
+    0xef, 0x8b, 0xb9, 0xb8, 0xcd, 0x26, 0x79, 0x40, 0xab, 0x5d, 0x9c, 0xfd, 0x57, 0x8c, 0xf5, 0xef,
+    0x73, 0x75, 0xcb, 0xce, 0xd0, 0x54, 0xc3, 0xbb, 0x66, 0x82, 0x11, 0xe3, 0x4a, 0x77, 0x80, 0xdd,
+    0x35, 0x0c, 0xfe, 0xf4, 0xee, 0x00, 0x65, 0x6b, 0x38, 0x89, 0x53, 0x81, 0x6c, 0x52, 0xc7, 0x41,
+    0xdd, 0xda, 0x59, 0x60, 0xe0, 0xae, 0x7a, 0x22, 0x58, 0xf3, 0x50, 0x16, 0x27, 0x53, 0xc7, 0x0b,
+    0xd2, 0xca, 0xd7, 0x40, 0x5c, 0x73, 0x62, 0x1f, 0xd3, 0x12, 0x5c, 0xe3, 0x5b, 0xf3, 0xf7, 0xbf,
+    0x0c, 0x65, 0x6e, 0xf0, 0xfc, 0x64, 0xa4, 0x0d, 0x07, 0x9b, 0xc3, 0xc6, 0xe3, 0xef, 0x1a, 0x11,
+    0x6f, 0x64, 0xf7, 0xe9, 0xb8, 0xef, 0x87, 0xfa, 0x24, 0x5b, 0x4d, 0xcc, 0x27, 0x2d, 0xa9, 0x30,
+    0x80, 0xda, 0xc3, 0xe6, 0x8d, 0xce, 0x6c, 0x0c, 0x8e, 0xd5, 0x8c, 0x34, 0xf7, 0x4a, 0xbd, 0x43,
+    0x51, 0x39, 0x4c, 0x8d, 0x51, 0xf1, 0xbc, 0x42, 0x0c, 0x49, 0xe2, 0x84, 0x0e, 0xab, 0x9e, 0x94,
+    0xc5, 0x95, 0xa3, 0x52, 0x04, 0x32, 0xd4, 0x5d, 0x90, 0x6e, 0x09, 0x0d, 0x8b, 0x31, 0xcd, 0x71,
+    0xcf, 0xda, 0x72, 0x8a, 0xa5, 0xdd, 0xc1, 0xd4, 0x3a, 0x1f, 0x72, 0xd4, 0x15, 0x74, 0xb2, 0x1f,
+    0xeb, 0x20, 0x3c, 0x8d, 0x58, 0xf5, 0x30, 0x3c, 0xec, 0x1d, 0x7c, 0xa7, 0xee, 0xc1, 0x2f, 0x07,
+    0x98, 0x7e, 0xdf, 0x3b, 0x18, 0x33, 0x78, 0x69, 0x78, 0x64, 0xf7, 0x61, 0x1b, 0x11, 0xbb, 0x71,
+    0xaf, 0xc9, 0x4b, 0xf6, 0x6f, 0xe7, 0xbf, 0x77, 0xea, 0x3a, 0xd0, 0xd2, 0x91, 0xe4, 0x81, 0x1b,
+    0x2d, 0xda, 0x74, 0x7c, 0x6f, 0x96, 0xd7, 0x7d, 0xc3, 0xf2, 0xd5, 0xc7, 0x14, 0xfb, 0x7a, 0x0f,
+    0xe9, 0x74, 0xb1, 0x0b, 0xe4, 0xc3, 0x5b, 0xbb, 0xd3, 0xbb, 0xc0, 0xd5, 0x61, 0xee, 0x53, 0x8f,
+    0x25, 0x21, 0x2f, 0xea, 0x5c, 0xfd, 0xe0, 0xea, 0x56, 0xc7, 0xe5, 0x66, 0x4a, 0xcb, 0xe2, 0x5b,
+    0x09, 0x95, 0xc9, 0xe5, 0xcc, 0xb7, 0x04, 0x1d, 0xf3, 0xd7, 0xd5, 0x1e, 0x7a, 0x87, 0xcc, 0x9c,
+    0xb6, 0xd4, 0xe3, 0xf1, 0x27, 0x16, 0xdb, 0x94, 0x2f, 0xab, 0xfd, 0xe2, 0x3b, 0xc9, 0xa6, 0xf0,
+    0x43, 0x01, 0x77, 0x48, 0xeb, 0xc1, 0x0e, 0xef, 0xe8, 0xed, 0xed, 0xf1, 0xc1, 0x4f, 0x0e, 0x2b,
+    0x9a, 0x4f, 0x73, 0xcf, 0x4e, 0xde, 0xc5, 0x7f, 0x11, 0xfb, 0x92, 0xa0, 0x8d, 0x3f, 0x95, 0x0f,
+    0x02, 0xd4, 0x5f, 0x76, 0x0c, 0xb6, 0xeb, 0xee, 0xd8, 0xcc, 0xfb, 0x23, 0xbe, 0x11, 0xf9, 0x7f,
+    0xe3, 0xf5, 0x9a, 0xf9, 0xab, 0xf2, 0x37, 0xc0, 0xba, 0x61, 0x52, 0xed, 0x7a, 0xcd, 0x5a, 0x53,
+    0xe2, 0x72, 0x2a, 0xca, 0x60, 0xf3, 0xb3, 0x68, 0x74, 0xb9, 0x8b, 0xf6, 0xa1, 0x3b, 0x69, 0x54,
+    0xfb, 0x5d, 0x4a, 0x75, 0x5b, 0xa5, 0x5a, 0x29, 0x4d, 0xca, 0x7b, 0x33, 0xd5, 0x8b, 0x69, 0x6b,
+    0xec, 0x7b, 0x11, 0x5d, 0x89, 0x5c, 0x57, 0xf6, 0x5b, 0x91, 0xaf, 0x8a, 0x76, 0xa5, 0xd6, 0x95,
+    0xb2, 0xab, 0x58, 0xec, 0xb5, 0xee, 0xb2, 0x8b, 0x75, 0x5d, 0x3f, 0xe1, 0x0d, 0x50, 0x9f, 0xb9,
+    0x63, 0xef, 0x0e, 0x79, 0x73, 0xd8, 0xb5, 0x77, 0xf9, 0x82, 0x58, 0x61, 0x08, 0xda, 0x22, 0x7e,
+    0x9f, 0x5d, 0xb2, 0x03, 0xca, 0x31, 0xee, 0x13, 0xd9, 0xb3, 0xfc, 0x2e, 0xad, 0xca, 0x5f, 0xde,
+    0x7d, 0xcd, 0xfe, 0x34, 0x2a, 0x8e, 0x9d, 0x4b, 0x99, 0xd2, 0x5c, 0x62, 0x6d, 0x03, 0x29, 0x9d,
+    0xa2, 0x0f, 0x33, 0xbb, 0x7d, 0xaf, 0xed, 0x81, 0x6b, 0xc4, 0x93, 0x37, 0x68, 0xaf, 0xa5, 0xb8,
+    0x47, 0x7a, 0xee, 0x42, 0xd3, 0x31, 0x83, 0x75, 0xff, 0x11, 0x37, 0x5d, 0xb8, 0xa2, 0x61, 0x68,
+    0xc1, 0xfb, 0x59, 0x4e, 0xed, 0x13, 0x74, 0xe7, 0xce, 0xd2, 0xbc, 0xb3, 0xee, 0x3f, 0xe5, 0x59,
+    0xdd, 0xf9, 0xa2, 0xa7, 0xe1, 0xee, 0xee, 0x07, 0xea, 0xc2, 0x51, 0xfb, 0xe3, 0x0f, 0xcb, 0xfb,
+    0x44, 0xea, 0x68, 0x1d, 0x97, 0x7e, 0x23, 0xef, 0xfd, 0x39, 0x5b, 0xc5, 0x1f, 0xcb, 0x7b, 0x40,
+    0x9f, 0xf6, 0xf1, 0x47, 0xc3, 0xd8, 0x4e, 0xef, 0x2f, 0x58, 0x52, 0xb4, 0x9e, 0xca, 0x29, 0xf6,
+    0xba, 0x46, 0xf9, 0x50, 0x85, 0x9a, 0x1a, 0x83, 0x27, 0x11, 0xec, 0xf0, 0xc9, 0x68, 0x22, 0x9a,
+    0x4f, 0xfb, 0xe8, 0xb1, 0xe9, 0x7a, 0x10, 0xc4, 0x9b, 0x41, 0x5d, 0x22, 0xb0, 0xcb, 0xd6, 0x6d,
+    0xa1, 0x22, 0x5c, 0xc6, 0xd6, 0x82, 0x7a, 0x53, 0xbf, 0xc6, 0xdd, 0x0b, 0xbf, 0x10, 0xb0, 0x92,
+    0x7a, 0xf8, 0x62, 0xcb, 0x9c, 0x49, 0xfb, 0x54, 0x1d, 0x3b, 0x61, 0x09, 0xbd, 0x98, 0xb7, 0x0f,
+    0xa1, 0xdb, 0xa9, 0x83, 0xfc, 0x03, 0x1a, 0x82, 0x3f, 0xdc, 0x39, 0x14, 0x2e, 0x82, 0xb0, 0x34,
+    0x3d, 0xbb, 0xce, 0xe5, 0x64, 0xc3, 0xa7, 0x66, 0x24, 0xbc, 0x96, 0x83, 0xe9, 0xfe, 0xcc, 0x55,
+    0xf7, 0xc3, 0x47, 0x02, 0x3a, 0x37, 0xe0, 0x7b, 0x84, 0x71, 0xb7, 0x29, 0xd6, 0x17, 0x82, 0x73,
+    0x76, 0xe9, 0xbf, 0x75, 0x04, 0x8e, 0x87, 0xf6, 0x1d, 0x4d, 0xd7, 0x68, 0xb9, 0xe6, 0xfb, 0x9a,
+    0xe9, 0x29, 0x7c, 0xe9, 0x39, 0x5c, 0x66, 0xed, 0x5f, 0x1f, 0xe9, 0x2e, 0xbd, 0x4a, 0x28, 0xf5,
+    0xb1, 0xc8, 0x47, 0xb4, 0xbc, 0x05, 0x00, 0x7f, 0xd2, 0xd0, 0xae, 0x67, 0x1f, 0x3c, 0x9f, 0x4f,
+    0x63, 0x6d, 0x24, 0xc4, 0x22, 0x18, 0xfe, 0x37, 0xf9, 0x59, 0xa1, 0x5b, 0x0d, 0xf8, 0xcc, 0xc1,
+    0xfa, 0x9c, 0xa8, 0x04, 0xce, 0x7e, 0x9a, 0x7a, 0xa9, 0x71, 0x54, 0x32, 0x66, 0xe7, 0x38, 0xa2,
+    0x1d, 0xf1, 0x9d, 0x90, 0xce, 0x8e, 0x36, 0x43, 0x9b, 0xef, 0x41, 0xb2, 0x2c, 0xae, 0x46, 0x59,
+    0x26, 0x37, 0x02, 0x16, 0x5e, 0xd4, 0xd4, 0x28, 0xb6, 0xb8, 0x9a, 0xf9, 0xcd, 0x8d, 0x38, 0xd8,
+    0x10, 0xdb, 0xfe, 0x61, 0x33, 0x6f, 0x2c, 0x63, 0xfb, 0x51, 0x68, 0xb1, 0x9f, 0x43, 0x1c, 0x81,
+    0x4c, 0xe7, 0x5b, 0xbd, 0x5f, 0x6e, 0x99, 0x92, 0xff, 0xd3, 0xde, 0x71, 0x4f, 0xae, 0x8d, 0xb5,
+    0xb2, 0x0a, 0x3c, 0x7b, 0x94, 0x00, 0x81, 0x9a, 0xfd, 0x80, 0xab, 0x22, 0x97, 0xf7, 0xde, 0x41,
+    0x5f, 0xe7, 0xe4, 0xb2, 0x03, 0xe1, 0xe8, 0xbe, 0x07, 0x1f, 0xa2, 0x58, 0x71, 0x67, 0x16, 0x3b,
+    0x1c, 0xb9, 0xfa, 0xb5, 0x62, 0x99, 0x38, 0x83, 0x61, 0xad, 0x0d, 0x86, 0x93, 0x46, 0x8d, 0xca,
+    0xb1, 0xd6, 0x3d, 0xb6, 0x92, 0x1d, 0x13, 0xe9, 0x10, 0x1c, 0x64, 0x6f, 0xf4, 0xbb, 0xcc, 0xf8,
+    0xec, 0x50, 0x6f, 0xb9, 0xcb, 0xf8, 0xd1, 0x64, 0x44, 0x07, 0x17, 0x2d, 0xca, 0x18, 0xeb, 0x13,
+    0xd1, 0x3f, 0x86, 0xfc, 0xc4, 0x46, 0xbe, 0x77, 0xd8, 0x4d, 0x13, 0x08, 0x78, 0x6f, 0x60, 0xbd,
+    0xc3, 0xce, 0xe1, 0x73, 0x18, 0xb3, 0xcd, 0x6a, 0xa1, 0x6c, 0x92, 0x03, 0xd5, 0xa9, 0xed, 0x34,
+    0x60, 0x00, 0xb8, 0x78, 0xf3, 0x4e, 0xf7, 0x7b, 0x57, 0x6f, 0xb9, 0xd7, 0xc4, 0xfe, 0xee, 0xe3,
+    0x32, 0xf0, 0xdc, 0x45, 0x52, 0xe1, 0xc9, 0x20, 0xf0, 0x4a, 0xf8, 0x63, 0xfc, 0xa3, 0x17, 0xff,
+    0xcf, 0x66, 0xae, 0x93, 0x7f, 0x6b, 0xef, 0xc6, 0x3d, 0x4c, 0xe5, 0x2f, 0x3e, 0x99, 0x3f, 0x34,
+    0xb6, 0xa8, 0x43, 0xc2, 0x4b, 0xa5, 0x12, 0x2c, 0x78, 0x04, 0x43, 0x09, 0xc0, 0x08, 0x96, 0x17,
+    0x20, 0xe9, 0xa0, 0x61, 0x4e, 0xd7, 0xa3, 0x0e, 0xa1, 0xf4, 0xeb, 0x3b, 0x3d, 0xa3, 0xf9, 0x4e,
+    0xc4, 0x6f, 0xf5, 0x66, 0xfc, 0x8f, 0x04, 0x06, 0xc6, 0x80, 0x22, 0x99, 0x4f, 0x07, 0x2a, 0x07,
+    0x70, 0x50, 0x09, 0x86, 0xd8, 0x35, 0x80, 0x86, 0x45, 0x98, 0x44, 0x26, 0x06, 0xd1, 0xcf, 0x75,
+    0x8d, 0x42, 0x1c, 0x71, 0x3c, 0x34, 0x70, 0x7f, 0x2e, 0x36, 0xe7, 0xb0, 0x3e, 0x74, 0x54, 0xc4,
+    0x3d, 0x79, 0x00, 0x35, 0x62, 0xbb, 0xed, 0xb0, 0x36, 0x67, 0x1d, 0x96, 0xf7, 0xd4, 0x37, 0x4f,
+    0x66, 0x09, 0x8d, 0x28, 0x98, 0xe1, 0x54, 0x71, 0xbf, 0xc9, 0x1b, 0xb6, 0x85, 0x62, 0xa6, 0xb7,
+    0xef, 0x0b, 0xfd, 0x7f, 0xff, 0xb7, 0x2e, 0xcf, 0x1f, 0x57, 0x71, 0xbc, 0x67, 0x7e, 0x81, 0xfd,
+    0x81, 0x76, 0x95, 0xb3, 0xad, 0xae, 0x82, 0xcf, 0x78, 0x45, 0x9f, 0xc0, 0xf4, 0xe0, 0xe8, 0x27,
+    0x8f, 0x7f, 0x1b, 0xc2, 0xaf, 0x57, 0x0f, 0x06, 0x56, 0x59, 0xbe, 0x8e, 0xb3, 0xf6, 0x68, 0x3e,
+    0xf4, 0xe2, 0x82, 0x93, 0x47, 0x67, 0xe3, 0x29, 0xfd, 0xd8, 0x04, 0x95, 0xcc, 0xeb, 0xcb, 0xbc,
+    0xbf, 0xbd, 0x7b, 0xc7, 0x1b, 0x2a, 0x11, 0x72, 0x08, 0xec, 0x3b, 0xb9, 0xff, 0x18, 0xac, 0x0b,
+    0x43, 0xdb, 0x23, 0x84, 0x5a, 0x5c, 0xb9, 0x74, 0x81, 0xcd, 0xea, 0x2c, 0x7d, 0x83, 0xe5, 0xcf,
+    0x82, 0xf2, 0xa7, 0x16, 0xa0, 0x94, 0x7d, 0x5b, 0xf2, 0x74, 0x29, 0x6d, 0xd1, 0x5d, 0xf8, 0xb2,
+    0xd9, 0x1c, 0x44, 0x97, 0x0f, 0x9d, 0x8a, 0xec, 0x9e, 0xd9, 0xec, 0xe7, 0x44, 0x9c, 0x36, 0x2a,
+    0x4c, 0x59, 0xf0, 0x90, 0xbd, 0x15, 0x75, 0x93, 0x5f, 0x44, 0x9b, 0x8f, 0xd2, 0x34, 0x9d, 0x95,
+    0xc1, 0x00, 0x46, 0x22, 0x53, 0xd5, 0x34, 0xaf, 0x2a, 0xf4, 0x0f, 0x7f, 0x90, 0xf7, 0xbf, 0x2d,
+    0xff, 0xf2, 0x95, 0x3c, 0x3b, 0xb1, 0x64, 0x8c, 0x83, 0x04, 0x56, 0xef, 0x04, 0x8b, 0x04, 0x09,
+    0x12, 0xfe, 0x00, 0xdc, 0x5d, 0x74, 0x74, 0xe9, 0xe8, 0x74, 0x17, 0xd0, 0xd0, 0xa2, 0xd1, 0x10,
+    0x44, 0x98, 0xf9, 0x0b, 0xe8, 0xe8, 0xd1, 0xd1, 0x71, 0x53, 0x10, 0x5e, 0x50, 0xd4, 0x40, 0x8f,
+    0x39, 0x8f, 0xbc, 0x7f, 0x44, 0x13, 0xa1, 0x21, 0xbe, 0x15, 0x19, 0xc5, 0xc5, 0xa0, 0x64, 0xd8,
+    0xb5, 0xa3, 0xdb, 0x0b, 0x83, 0xb3, 0x9f, 0x47, 0x8b, 0x0c, 0x5b, 0xa1, 0xfb, 0xe1, 0x50, 0x4e,
+    0x1f, 0xd4, 0xe7, 0x7f, 0x33, 0x7d, 0xbb, 0xe5, 0xa7, 0xf5, 0x94, 0xe3, 0x07, 0x7f, 0x6a, 0x0d,
+    0xb0, 0xb2, 0x40, 0xc2, 0x9b, 0x1c, 0x62, 0x39, 0xb4, 0x67, 0xfc, 0xea, 0x5d, 0x63, 0x31, 0x8a,
+    0x4b, 0x8a, 0x8f, 0xd0, 0xd3, 0x9f, 0xb6, 0xbf, 0x0c, 0x9d, 0x11, 0x10, 0x29, 0x4a, 0xc6, 0xdf,
+    0xf4, 0x68, 0x0f, 0x38, 0xb3, 0x6d, 0xf2, 0xc0, 0x6d, 0xc4, 0xf7, 0xe7, 0x38, 0x8d, 0xaa, 0xb6,
+    0xf9, 0x47, 0x1e, 0x1e, 0xd8, 0x5b, 0xb9, 0x51, 0xd8, 0x5a, 0x8b, 0x50, 0x63, 0xbc, 0x17, 0xa5,
+    0x88, 0x08, 0x23, 0xab, 0xd8, 0x40, 0x36, 0xbc, 0x5f, 0xcc, 0x11, 0x38, 0x29, 0xfd, 0xdc, 0x0e,
+    0x25, 0x65, 0x6e, 0x35, 0xea, 0x56, 0x25, 0x69, 0x28, 0xfb, 0xf5, 0xa5, 0x6f, 0x68, 0x29, 0x7a,
+    0x78, 0x9a, 0x47, 0xe2, 0xc5, 0x67, 0x60, 0x05, 0xe0, 0x76, 0xc3, 0x68, 0x51, 0xdb, 0xd3, 0xf6,
+    0x80, 0xf8, 0xbf, 0xee, 0xf8, 0xa1, 0x33, 0x20, 0xf6, 0x11, 0x5a, 0x08, 0x8f, 0xc1, 0xe4, 0x4d,
+    0x62, 0xc0, 0xcc, 0xf2, 0x00, 0x2c, 0xca, 0x37, 0x03, 0x9e, 0x59, 0x5b, 0x18, 0x08, 0x3f, 0x2a,
+    0xf5, 0x6b, 0xfb, 0xbc, 0xe5, 0x5a, 0x99, 0xf7, 0xc2, 0xa1, 0xdb, 0x1f, 0xa9, 0x2b, 0xca, 0x1b,
+    0x80, 0xca, 0x53, 0x9f, 0x5f, 0x1e, 0xa8, 0x17, 0xac, 0xf3, 0x63, 0xd8, 0x88, 0x8c, 0x33, 0x45,
+    0xc2, 0x63, 0x6d, 0x47, 0x08, 0xf5, 0xc6, 0x21, 0x05, 0xb6, 0x8e, 0x4b, 0xcd, 0x7d, 0xa5, 0x55,
+    0xad, 0x33, 0xfb, 0x76, 0x72, 0x1c, 0xed, 0xda, 0x2b, 0x4c, 0x91, 0x98, 0x7b, 0x96, 0xdb, 0xee,
+    0x81, 0x6a, 0x87, 0xf5, 0xe3, 0xb3, 0x33, 0xf0, 0xb9, 0x4a, 0xa9, 0x1d, 0xec, 0xf9, 0xab, 0xf3,
+    0x92, 0x7a, 0xcd, 0xba, 0x4b, 0x75, 0x25, 0xec, 0xf4, 0x18, 0x85, 0x09, 0xa4, 0x4a, 0x52, 0x7b,
+    0x44, 0xd1, 0x60, 0x3b, 0xce, 0x50, 0x72, 0x71, 0xc1, 0x08, 0x4a, 0x75, 0x07, 0xde, 0x06, 0x31,
+    0x15, 0x14, 0x6c, 0xd8, 0x16, 0xb3, 0x62, 0x25, 0x8a, 0xc7, 0x31, 0x33, 0x0f, 0xfc, 0xda, 0xb0,
+    0xec, 0xdc, 0x4b, 0x91, 0xda, 0xa9, 0xd3, 0x33, 0x65, 0x57, 0xb9, 0x5b, 0x1e, 0xf4, 0xd1, 0x85,
+    0x8a, 0x03, 0xe8, 0xdf, 0xdc, 0x65, 0x05, 0x40, 0x78, 0x76, 0x00, 0xfc, 0x75, 0x4f, 0xf1, 0x3a,
+    0x7e, 0x84, 0x73, 0x5f, 0xe0, 0xa3, 0x4d, 0xc1, 0x57, 0xe9, 0xcf, 0xb6, 0x3c, 0x86, 0xb0, 0xd6,
+    0x38, 0x51, 0xfd, 0xec, 0xe8, 0x0b, 0xd6, 0x05, 0x3d, 0x48, 0x71, 0x7a, 0x65, 0x55, 0x09, 0xee,
+    0xa7, 0xdd, 0xd5, 0x65, 0x1e, 0xc4, 0x17, 0x81, 0x6e, 0x5a, 0x7c, 0xe9, 0x34, 0x1e, 0x7d, 0x16,
+    0x18, 0x4e, 0x21, 0xcc, 0xe9, 0xa3, 0x54, 0x78, 0xa3, 0x0f, 0x51, 0xf2, 0x86, 0x8b, 0x0d, 0xe8,
+    0x85, 0x75, 0x62, 0x68, 0xac, 0xeb, 0xc9, 0x2e, 0xd5, 0x09, 0x2c, 0x3c, 0xfd, 0x5d, 0x9d, 0x81,
+    0x44, 0xd3, 0xbd, 0x63, 0x10, 0x83, 0x38, 0x35, 0x11, 0xaf, 0xcc, 0x12, 0xd0, 0x47, 0xc8, 0xbc,
+    0xcf, 0x52, 0x3e, 0x5f, 0xda, 0xf9, 0x90, 0x7f, 0x3f, 0xe3, 0x61, 0x88, 0xf3, 0x33, 0x39, 0x21,
+    0x17, 0x15, 0x7d, 0xff, 0xe1, 0x12, 0x5d, 0x9d, 0xbf, 0x08,
 };
+const ShaderModule Blob112 = { Blob112_Data, 4298u, 4133u, 112u };
 
 } // namespace detail
 } // namespace VulkanShaders
@@ -28,13 +28,12 @@
     Pipeline indices match ComputeRenderer3D::ShaderCompileStep() in
     src/GPU3D_Compute.cpp one for one.
 
-    The SPIR-V words live in per-stage translation units rather than in the
-    header so that including the public header stays cheap: the full module set
-    is a few megabytes of integer literals and would otherwise be re-parsed by
-    every consumer.
+    Every module is one zstd frame, inflated on first use by
+    Vk::InflateShaderModule(). The frames live in per-stage translation units
+    rather than in the header so that including the public header stays cheap.
 */
 
-// SPIR-V for src/GPU3D_Vulkan_shaders/DepthBlend.comp.
+// SPIR-V for src/GPU3D_Vulkan_shaders/DepthBlend.comp, one zstd frame per module.
 
 #include "GPU3D_Vulkan_ShaderBlobs.h"
 
@@ -45,5045 +44,2645 @@ namespace VulkanShaders
 namespace detail
 {
 
-extern const uint32_t Blob003[6683];
-const uint32_t Blob003[6683] = {
-    0x07230203, 0x00010300, 0x0008000b, 0x000003e3, 0x00000000, 0x00020011, 0x00000001, 0x0006000b,
-    0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001,
-    0x0008000f, 0x00000005, 0x00000004, 0x6e69616d, 0x00000000, 0x000000d9, 0x0000029a, 0x000002b2,
-    0x00060010, 0x00000004, 0x00000011, 0x00000008, 0x00000008, 0x00000001, 0x00030003, 0x00000002,
-    0x000001c2, 0x000a0004, 0x475f4c47, 0x4c474f4f, 0x70635f45, 0x74735f70, 0x5f656c79, 0x656e696c,
-    0x7269645f, 0x69746365, 0x00006576, 0x00080004, 0x475f4c47, 0x4c474f4f, 0x6e695f45, 0x64756c63,
-    0x69645f65, 0x74636572, 0x00657669, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000, 0x000a0005,
-    0x00000010, 0x74706544, 0x73655468, 0x73615074, 0x28736573, 0x623b3162, 0x31753b31, 0x3b31753b,
-    0x003b3175, 0x00060005, 0x0000000b, 0x61757165, 0x7065446c, 0x65546874, 0x00007473, 0x00050005,
-    0x0000000c, 0x69636166, 0x6956676e, 0x00007765, 0x00050005, 0x0000000d, 0x44747364, 0x68747065,
-    0x00000000, 0x00050005, 0x0000000e, 0x656c6974, 0x74706544, 0x00000068, 0x00040005, 0x0000000f,
-    0x41747364, 0x00727474, 0x000d0005, 0x0000001c, 0x746f6c50, 0x6e617254, 0x63756c73, 0x28746e65,
-    0x753b3175, 0x31753b31, 0x3b31623b, 0x753b3175, 0x31753b31, 0x3b31753b, 0x003b3162, 0x00040005,
-    0x00000013, 0x6f6c6f63, 0x00000072, 0x00040005, 0x00000014, 0x74706564, 0x00000068, 0x00040005,
-    0x00000015, 0x72747461, 0x00000000, 0x00050005, 0x00000016, 0x68537369, 0x776f6461, 0x00000000,
-    0x00050005, 0x00000017, 0x656c6974, 0x6f6c6f43, 0x00000072, 0x00040005, 0x00000018, 0x41637273,
-    0x00000000, 0x00050005, 0x00000019, 0x656c6974, 0x74706544, 0x00000068, 0x00040005, 0x0000001a,
-    0x41637273, 0x00727474, 0x00050005, 0x0000001b, 0x74697277, 0x70654465, 0x00006874, 0x00100005,
-    0x0000002d, 0x636f7250, 0x43737365, 0x7372616f, 0x73614d65, 0x3169286b, 0x3b31753b, 0x763b3175,
-    0x763b3275, 0x763b3275, 0x763b3275, 0x623b3275, 0x31753b31, 0x3b31623b, 0x00000000, 0x00050005,
-    0x00000023, 0x656e696c, 0x69547261, 0x0000656c, 0x00050005, 0x00000024, 0x72616f63, 0x614d6573,
-    0x00006b73, 0x00060005, 0x00000025, 0x72616f63, 0x664f6573, 0x74657366, 0x00000000, 0x00040005,
-    0x00000026, 0x6f6c6f63, 0x00000072, 0x00040005, 0x00000027, 0x74706564, 0x00000068, 0x00040005,
-    0x00000028, 0x72747461, 0x00000000, 0x00040005, 0x00000029, 0x6e6e6977, 0x00007265, 0x00060005,
-    0x0000002a, 0x63617274, 0x766f436b, 0x67617265, 0x00000065, 0x00040005, 0x0000002b, 0x6e657473,
-    0x006c6963, 0x00070005, 0x0000002c, 0x76657270, 0x68537349, 0x776f6461, 0x6b73614d, 0x00000000,
-    0x00050005, 0x00000050, 0x6e656c62, 0x74744164, 0x00000072, 0x00040005, 0x0000008b, 0x52637273,
-    0x00000042, 0x00040005, 0x0000008f, 0x47637273, 0x00000000, 0x00040005, 0x00000093, 0x52747364,
-    0x00000042, 0x00040005, 0x00000096, 0x47747364, 0x00000000, 0x00040005, 0x00000099, 0x41747364,
-    0x00000000, 0x00040005, 0x0000009d, 0x68706c61, 0x00000061, 0x00050005, 0x000000ac, 0x6174654d,
-    0x66696e55, 0x006d726f, 0x00060006, 0x000000ac, 0x00000000, 0x506d754e, 0x67796c6f, 0x00736e6f,
-    0x00060006, 0x000000ac, 0x00000001, 0x566d754e, 0x61697261, 0x0073746e, 0x00060006, 0x000000ac,
-    0x00000002, 0x68706c41, 0x66655261, 0x00000000, 0x00050006, 0x000000ac, 0x00000003, 0x70736944,
-    0x00746e43, 0x00060006, 0x000000ac, 0x00000004, 0x6e6f6f54, 0x6c626154, 0x00000065, 0x00060006,
-    0x000000ac, 0x00000005, 0x61656c43, 0x6c6f4372, 0x0000726f, 0x00060006, 0x000000ac, 0x00000006,
-    0x61656c43, 0x70654472, 0x00006874, 0x00060006, 0x000000ac, 0x00000007, 0x61656c43, 0x74744172,
-    0x00000072, 0x00060006, 0x000000ac, 0x00000008, 0x4f676f46, 0x65736666, 0x00000074, 0x00060006,
-    0x000000ac, 0x00000009, 0x53676f46, 0x74666968, 0x00000000, 0x00060006, 0x000000ac, 0x0000000a,
-    0x43676f46, 0x726f6c6f, 0x00000000, 0x00080006, 0x000000ac, 0x0000000b, 0x61656c43, 0x74694272,
-    0x4f70616d, 0x65736666, 0x00000074, 0x00030005, 0x000000ae, 0x00000000, 0x00060005, 0x000000d6,
-    0x656c6974, 0x656e6e49, 0x66664f72, 0x00746573, 0x00080005, 0x000000d9, 0x4c5f6c67, 0x6c61636f,
-    0x6f766e49, 0x69746163, 0x44496e6f, 0x00000000, 0x00050005, 0x000000ea, 0x72616f63, 0x69426573,
-    0x00000074, 0x00050005, 0x000000f3, 0x656c6974, 0x7366664f, 0x00007465, 0x00050005, 0x000000fc,
-    0x656e6966, 0x6b73614d, 0x00000000, 0x00060005, 0x00000102, 0x526e6942, 0x6c757365, 0x66754274,
-    0x00726566, 0x00080006, 0x00000102, 0x00000000, 0x69726156, 0x57746e61, 0x436b726f, 0x746e756f,
-    0x00000000, 0x00080006, 0x00000102, 0x00000001, 0x74726f53, 0x6f576465, 0x664f6b72, 0x74657366,
-    0x00000000, 0x00090006, 0x00000102, 0x00000002, 0x69726156, 0x57746e61, 0x526b726f, 0x436c6165,
-    0x746e756f, 0x00000000, 0x00080006, 0x00000102, 0x00000003, 0x74726f53, 0x6b726f57, 0x6b726f57,
-    0x6e756f43, 0x00000074, 0x00090006, 0x00000102, 0x00000004, 0x6e6e6942, 0x4d676e69, 0x416b7361,
-    0x664f646e, 0x74657366, 0x00000000, 0x00030005, 0x00000104, 0x00000000, 0x00050005, 0x00000107,
-    0x65726353, 0x69576e65, 0x00687464, 0x00060005, 0x00000108, 0x656c6954, 0x72655073, 0x656e694c,
-    0x00000000, 0x00060005, 0x00000109, 0x65726353, 0x65486e65, 0x74686769, 0x00000000, 0x00050005,
-    0x0000010a, 0x656c6954, 0x656e694c, 0x00000073, 0x00070005, 0x0000010e, 0x6e6e6942, 0x4d676e69,
-    0x536b7361, 0x74726174, 0x00000000, 0x00040005, 0x00000115, 0x6b726f77, 0x00786449, 0x00080005,
-    0x00000118, 0x6e6e6942, 0x57676e69, 0x4f6b726f, 0x65736666, 0x74537374, 0x00747261, 0x00040005,
-    0x00000125, 0x656e6966, 0x00786449, 0x00050005, 0x0000012e, 0x65786970, 0x646e696c, 0x00007865,
-    0x00050005, 0x00000135, 0x656c6974, 0x6f6c6f43, 0x00000072, 0x00060005, 0x00000137, 0x6f6c6f43,
-    0x6c695472, 0x66754265, 0x00726566, 0x00060006, 0x00000137, 0x00000000, 0x6f6c6f43, 0x6c695472,
-    0x00007365, 0x00030005, 0x00000139, 0x00000000, 0x00050005, 0x00000140, 0x796c6f70, 0x496e6f67,
-    0x00007864, 0x00060005, 0x00000141, 0x68737550, 0x736e6f43, 0x746e6174, 0x00000073, 0x00060006,
-    0x00000141, 0x00000000, 0x56727543, 0x61697261, 0x0000746e, 0x00060006, 0x00000141, 0x00000001,
-    0x57786554, 0x68746469, 0x00000000, 0x00060006, 0x00000141, 0x00000002, 0x48786554, 0x68676965,
-    0x00000074, 0x00060006, 0x00000141, 0x00000003, 0x57786554, 0x53706172, 0x00000000, 0x00060006,
-    0x00000141, 0x00000004, 0x57786554, 0x54706172, 0x00000000, 0x00070006, 0x00000141, 0x00000005,
-    0x49786554, 0x70614373, 0x65727574, 0x00000000, 0x00070006, 0x00000141, 0x00000006, 0x74706143,
-    0x59657275, 0x7366664f, 0x00007465, 0x00050006, 0x00000141, 0x00000007, 0x6461705f, 0x00000000,
-    0x00030005, 0x00000143, 0x00006370, 0x00050005, 0x00000152, 0x796c6f70, 0x416e6f67, 0x00727474,
-    0x00040005, 0x00000153, 0x796c6f50, 0x006e6f67, 0x00060006, 0x00000153, 0x00000000, 0x73726946,
-    0x70535874, 0x00006e61, 0x00050006, 0x00000153, 0x00000001, 0x706f5459, 0x00000000, 0x00050006,
-    0x00000153, 0x00000002, 0x746f4259, 0x00000000, 0x00050006, 0x00000153, 0x00000003, 0x6e694d58,
-    0x00000000, 0x00050006, 0x00000153, 0x00000004, 0x78614d58, 0x00000000, 0x00050006, 0x00000153,
-    0x00000005, 0x6e694d58, 0x00000059, 0x00050006, 0x00000153, 0x00000006, 0x78614d58, 0x00000059,
-    0x00050006, 0x00000153, 0x00000007, 0x69726156, 0x00746e61, 0x00050006, 0x00000153, 0x00000008,
-    0x72747441, 0x00000000, 0x00070006, 0x00000153, 0x00000009, 0x74786554, 0x4c657275, 0x72657961,
-    0x00000000, 0x00060006, 0x00000153, 0x0000000a, 0x69636146, 0x6956676e, 0x00007765, 0x00060005,
-    0x00000155, 0x796c6f50, 0x426e6f67, 0x65666675, 0x00000072, 0x00060006, 0x00000155, 0x00000000,
-    0x796c6f50, 0x736e6f67, 0x00000000, 0x00030005, 0x00000157, 0x00000000, 0x00050005, 0x0000015b,
-    0x69636166, 0x6956676e, 0x00007765, 0x00060005, 0x00000161, 0x68537369, 0x776f6461, 0x6b73614d,
-    0x00000000, 0x00070005, 0x00000167, 0x76657270, 0x68537349, 0x776f6461, 0x6b73614d, 0x00646c4f,
-    0x00060005, 0x0000016a, 0x61757165, 0x7065446c, 0x65546874, 0x00007473, 0x00050005, 0x0000016f,
-    0x656c6974, 0x74706544, 0x00000068, 0x00060005, 0x00000171, 0x74706544, 0x6c695468, 0x66754265,
-    0x00726566, 0x00060006, 0x00000171, 0x00000000, 0x74706544, 0x6c695468, 0x00007365, 0x00030005,
-    0x00000173, 0x00000000, 0x00050005, 0x00000177, 0x656c6974, 0x72747441, 0x00000000, 0x00060005,
-    0x00000179, 0x72747441, 0x656c6954, 0x66667542, 0x00007265, 0x00060006, 0x00000179, 0x00000000,
-    0x72747441, 0x656c6954, 0x00000073, 0x00030005, 0x0000017b, 0x00000000, 0x00040005, 0x0000017f,
-    0x61747364, 0x00727474, 0x00050005, 0x00000186, 0x68537369, 0x776f6461, 0x00000000, 0x00070005,
-    0x0000018a, 0x74697277, 0x63655365, 0x4c646e6f, 0x72657961, 0x00000000, 0x00050005, 0x000001a3,
-    0x44747364, 0x68747065, 0x00000000, 0x00040005, 0x000001ae, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001b0, 0x61726170, 0x0000006d, 0x00040005, 0x000001b2, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001b4, 0x61726170, 0x0000006d, 0x00040005, 0x000001b6, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001c7, 0x61726170, 0x0000006d, 0x00040005, 0x000001c9, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001cb, 0x61726170, 0x0000006d, 0x00040005, 0x000001ce, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001d0, 0x61726170, 0x0000006d, 0x00040005, 0x000001d7, 0x41637273, 0x00727474, 0x00040005,
-    0x000001e1, 0x41637273, 0x00000000, 0x00050005, 0x00000223, 0x74697277, 0x70654465, 0x00006874,
-    0x00040005, 0x0000022b, 0x61726170, 0x0000006d, 0x00040005, 0x0000022e, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000231, 0x61726170, 0x0000006d, 0x00040005, 0x00000234, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000236, 0x61726170, 0x0000006d, 0x00040005, 0x00000238, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000023a, 0x61726170, 0x0000006d, 0x00040005, 0x0000023c, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000023e, 0x61726170, 0x0000006d, 0x00040005, 0x00000251, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000254, 0x61726170, 0x0000006d, 0x00040005, 0x00000257, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000025a, 0x61726170, 0x0000006d, 0x00040005, 0x0000025c, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000025e, 0x61726170, 0x0000006d, 0x00040005, 0x00000260, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000262, 0x61726170, 0x0000006d, 0x00040005, 0x00000264, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000272, 0x61726170, 0x0000006d, 0x00040005, 0x00000274, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000276, 0x61726170, 0x0000006d, 0x00040005, 0x00000279, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000027b, 0x61726170, 0x0000006d, 0x00040005, 0x00000287, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000289, 0x61726170, 0x0000006d, 0x00040005, 0x0000028b, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000028e, 0x61726170, 0x0000006d, 0x00040005, 0x00000290, 0x61726170, 0x0000006d,
-    0x00050005, 0x00000299, 0x656e696c, 0x69547261, 0x0000656c, 0x00060005, 0x0000029a, 0x575f6c67,
-    0x476b726f, 0x70756f72, 0x00004449, 0x00060005, 0x000002a3, 0x72616f63, 0x614d6573, 0x6f4c6b73,
-    0x00000000, 0x00060005, 0x000002aa, 0x72616f63, 0x614d6573, 0x69486b73, 0x00000000, 0x00060005,
-    0x000002b1, 0x75736572, 0x664f746c, 0x74657366, 0x00000000, 0x00080005, 0x000002b2, 0x475f6c67,
-    0x61626f6c, 0x766e496c, 0x7461636f, 0x496e6f69, 0x00000044, 0x00040005, 0x000002bb, 0x6e6e6977,
-    0x00007265, 0x00060005, 0x000002be, 0x63617274, 0x766f436b, 0x67617265, 0x00000065, 0x00040005,
-    0x000002c8, 0x6e657473, 0x006c6963, 0x00070005, 0x000002c9, 0x76657270, 0x68537349, 0x776f6461,
-    0x6b73614d, 0x00000000, 0x00040005, 0x000002cf, 0x6f6c6f63, 0x00000072, 0x00060005, 0x000002d1,
-    0x75736552, 0x7542746c, 0x72656666, 0x00000000, 0x00060006, 0x000002d1, 0x00000000, 0x75736552,
-    0x6156746c, 0x0065756c, 0x00030005, 0x000002d3, 0x00000000, 0x00070005, 0x000002dc, 0x6d617246,
-    0x66756265, 0x53726566, 0x64697274, 0x00000065, 0x00040005, 0x000002e2, 0x74706564, 0x00000068,
-    0x00070005, 0x000002e6, 0x75736552, 0x6544746c, 0x53687470, 0x74726174, 0x00000000, 0x00040005,
-    0x000002f4, 0x72747461, 0x00000000, 0x00060005, 0x000002f8, 0x75736552, 0x7441746c, 0x74537274,
-    0x00747261, 0x00070005, 0x0000030a, 0x75736552, 0x6957746c, 0x72656e6e, 0x66667542, 0x00007265,
-    0x00070006, 0x0000030a, 0x00000000, 0x75736552, 0x6957746c, 0x72656e6e, 0x00000000, 0x00030005,
-    0x0000030c, 0x00000000, 0x00060005, 0x00000315, 0x746e6f63, 0x61756e69, 0x6e6f6974, 0x00000000,
-    0x00080005, 0x00000317, 0x6e656c42, 0x6e6f4364, 0x756e6974, 0x6f697461, 0x6675426e, 0x00726566,
-    0x00090006, 0x00000317, 0x00000000, 0x6e656c42, 0x6e6f4364, 0x756e6974, 0x6f697461, 0x6174536e,
-    0x00006574, 0x00030005, 0x00000319, 0x00000000, 0x00040005, 0x00000330, 0x6c616373, 0x00000065,
-    0x00030005, 0x00000335, 0x00736f70, 0x00070005, 0x00000343, 0x61656c43, 0x74694272, 0x4370616d,
-    0x726f6c6f, 0x00000000, 0x00070005, 0x0000034a, 0x61656c43, 0x74694272, 0x4470616d, 0x68747065,
-    0x00000000, 0x00040005, 0x0000036f, 0x61726170, 0x0000006d, 0x00040005, 0x00000371, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000373, 0x61726170, 0x0000006d, 0x00040005, 0x00000374, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000376, 0x61726170, 0x0000006d, 0x00040005, 0x00000378, 0x61726170,
-    0x0000006d, 0x00040005, 0x0000037a, 0x61726170, 0x0000006d, 0x00040005, 0x0000037c, 0x61726170,
-    0x0000006d, 0x00040005, 0x0000037e, 0x61726170, 0x0000006d, 0x00040005, 0x00000380, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000389, 0x61726170, 0x0000006d, 0x00040005, 0x0000038b, 0x61726170,
-    0x0000006d, 0x00040005, 0x0000038d, 0x61726170, 0x0000006d, 0x00040005, 0x0000038e, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000390, 0x61726170, 0x0000006d, 0x00040005, 0x00000392, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000394, 0x61726170, 0x0000006d, 0x00040005, 0x00000396, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000398, 0x61726170, 0x0000006d, 0x00040005, 0x0000039a, 0x61726170,
-    0x0000006d, 0x00060005, 0x000003df, 0x5778614d, 0x546b726f, 0x73656c69, 0x00000000, 0x00040047,
-    0x000000a9, 0x00000006, 0x00000010, 0x00050048, 0x000000ac, 0x00000000, 0x00000023, 0x00000000,
-    0x00050048, 0x000000ac, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x000000ac, 0x00000002,
-    0x00000023, 0x00000008, 0x00050048, 0x000000ac, 0x00000003, 0x00000023, 0x0000000c, 0x00050048,
-    0x000000ac, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x000000ac, 0x00000005, 0x00000023,
-    0x00000230, 0x00050048, 0x000000ac, 0x00000006, 0x00000023, 0x00000234, 0x00050048, 0x000000ac,
-    0x00000007, 0x00000023, 0x00000238, 0x00050048, 0x000000ac, 0x00000008, 0x00000023, 0x0000023c,
-    0x00050048, 0x000000ac, 0x00000009, 0x00000023, 0x00000240, 0x00050048, 0x000000ac, 0x0000000a,
-    0x00000023, 0x00000244, 0x00050048, 0x000000ac, 0x0000000b, 0x00000023, 0x00000248, 0x00030047,
-    0x000000ac, 0x00000002, 0x00040047, 0x000000ae, 0x00000022, 0x00000000, 0x00040047, 0x000000ae,
-    0x00000021, 0x00000000, 0x00040047, 0x000000d9, 0x0000000b, 0x0000001b, 0x00040047, 0x000000fe,
-    0x00000006, 0x00000010, 0x00040047, 0x000000ff, 0x00000006, 0x00000004, 0x00040047, 0x00000100,
-    0x00000006, 0x00000004, 0x00040047, 0x00000101, 0x00000006, 0x00000004, 0x00050048, 0x00000102,
-    0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000102, 0x00000001, 0x00000023, 0x00008000,
-    0x00050048, 0x00000102, 0x00000002, 0x00000023, 0x0000a000, 0x00050048, 0x00000102, 0x00000003,
-    0x00000023, 0x0000c000, 0x00050048, 0x00000102, 0x00000004, 0x00000023, 0x0000c010, 0x00030047,
-    0x00000102, 0x00000002, 0x00040047, 0x00000104, 0x00000022, 0x00000000, 0x00040047, 0x00000104,
-    0x00000021, 0x00000008, 0x00040047, 0x00000107, 0x00000001, 0x00000000, 0x00040047, 0x00000109,
-    0x00000001, 0x00000001, 0x00040047, 0x00000136, 0x00000006, 0x00000004, 0x00050048, 0x00000137,
-    0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000137, 0x00000002, 0x00040047, 0x00000139,
-    0x00000022, 0x00000000, 0x00040047, 0x00000139, 0x00000021, 0x00000004, 0x00050048, 0x00000141,
-    0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000141, 0x00000001, 0x00000023, 0x00000004,
-    0x00050048, 0x00000141, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x00000141, 0x00000003,
-    0x00000023, 0x0000000c, 0x00050048, 0x00000141, 0x00000004, 0x00000023, 0x00000010, 0x00050048,
-    0x00000141, 0x00000005, 0x00000023, 0x00000014, 0x00050048, 0x00000141, 0x00000006, 0x00000023,
-    0x00000018, 0x00050048, 0x00000141, 0x00000007, 0x00000023, 0x0000001c, 0x00030047, 0x00000141,
-    0x00000002, 0x00050048, 0x00000153, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000153,
-    0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x00000153, 0x00000002, 0x00000023, 0x00000008,
-    0x00050048, 0x00000153, 0x00000003, 0x00000023, 0x0000000c, 0x00050048, 0x00000153, 0x00000004,
-    0x00000023, 0x00000010, 0x00050048, 0x00000153, 0x00000005, 0x00000023, 0x00000014, 0x00050048,
-    0x00000153, 0x00000006, 0x00000023, 0x00000018, 0x00050048, 0x00000153, 0x00000007, 0x00000023,
-    0x0000001c, 0x00050048, 0x00000153, 0x00000008, 0x00000023, 0x00000020, 0x00050048, 0x00000153,
-    0x00000009, 0x00000023, 0x00000024, 0x00050048, 0x00000153, 0x0000000a, 0x00000023, 0x00000028,
-    0x00040047, 0x00000154, 0x00000006, 0x0000002c, 0x00040048, 0x00000155, 0x00000000, 0x00000018,
-    0x00050048, 0x00000155, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000155, 0x00000002,
-    0x00040047, 0x00000157, 0x00000022, 0x00000000, 0x00040047, 0x00000157, 0x00000021, 0x00000001,
-    0x00040047, 0x00000170, 0x00000006, 0x00000004, 0x00050048, 0x00000171, 0x00000000, 0x00000023,
-    0x00000000, 0x00030047, 0x00000171, 0x00000002, 0x00040047, 0x00000173, 0x00000022, 0x00000000,
-    0x00040047, 0x00000173, 0x00000021, 0x00000005, 0x00040047, 0x00000178, 0x00000006, 0x00000004,
-    0x00050048, 0x00000179, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000179, 0x00000002,
-    0x00040047, 0x0000017b, 0x00000022, 0x00000000, 0x00040047, 0x0000017b, 0x00000021, 0x00000006,
-    0x00040047, 0x0000029a, 0x0000000b, 0x0000001a, 0x00040047, 0x000002b2, 0x0000000b, 0x0000001c,
-    0x00040047, 0x000002d0, 0x00000006, 0x00000004, 0x00050048, 0x000002d1, 0x00000000, 0x00000023,
-    0x00000000, 0x00030047, 0x000002d1, 0x00000002, 0x00040047, 0x000002d3, 0x00000022, 0x00000000,
-    0x00040047, 0x000002d3, 0x00000021, 0x00000007, 0x00040047, 0x00000309, 0x00000006, 0x00000004,
-    0x00050048, 0x0000030a, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x0000030a, 0x00000002,
-    0x00040047, 0x0000030c, 0x00000022, 0x00000000, 0x00040047, 0x0000030c, 0x00000021, 0x00000010,
-    0x00040047, 0x00000316, 0x00000006, 0x00000004, 0x00050048, 0x00000317, 0x00000000, 0x00000023,
-    0x00000000, 0x00030047, 0x00000317, 0x00000002, 0x00040047, 0x00000319, 0x00000022, 0x00000000,
-    0x00040047, 0x00000319, 0x00000021, 0x0000000f, 0x00040047, 0x00000343, 0x00000022, 0x00000001,
-    0x00040047, 0x00000343, 0x00000021, 0x00000003, 0x00040047, 0x0000034a, 0x00000022, 0x00000001,
-    0x00040047, 0x0000034a, 0x00000021, 0x00000004, 0x00040047, 0x000003df, 0x00000001, 0x00000002,
-    0x00040047, 0x000003e2, 0x0000000b, 0x00000019, 0x00020013, 0x00000002, 0x00030021, 0x00000003,
-    0x00000002, 0x00020014, 0x00000006, 0x00040020, 0x00000007, 0x00000007, 0x00000006, 0x00040015,
-    0x00000008, 0x00000020, 0x00000000, 0x00040020, 0x00000009, 0x00000007, 0x00000008, 0x00080021,
-    0x0000000a, 0x00000006, 0x00000007, 0x00000007, 0x00000009, 0x00000009, 0x00000009, 0x000c0021,
-    0x00000012, 0x00000002, 0x00000009, 0x00000009, 0x00000009, 0x00000007, 0x00000009, 0x00000009,
-    0x00000009, 0x00000009, 0x00000007, 0x00040015, 0x0000001e, 0x00000020, 0x00000001, 0x00040020,
-    0x0000001f, 0x00000007, 0x0000001e, 0x00040017, 0x00000020, 0x00000008, 0x00000002, 0x00040020,
-    0x00000021, 0x00000007, 0x00000020, 0x000d0021, 0x00000022, 0x00000002, 0x0000001f, 0x00000009,
-    0x00000009, 0x00000021, 0x00000021, 0x00000021, 0x00000021, 0x00000007, 0x00000009, 0x00000007,
-    0x0004002b, 0x00000008, 0x00000035, 0x00000200, 0x0004002b, 0x00000008, 0x00000037, 0x00000400,
-    0x0004002b, 0x00000008, 0x0000003e, 0x00400010, 0x0004002b, 0x00000008, 0x00000040, 0x00000010,
-    0x0004002b, 0x00000008, 0x00000052, 0x0000e0f0, 0x0004002b, 0x0000001e, 0x00000055, 0x00000008,
-    0x0004002b, 0x00000008, 0x00000057, 0x00ff0000, 0x0004002b, 0x00000008, 0x0000005a, 0x00400000,
-    0x0004002b, 0x00000008, 0x0000005d, 0xff001f0f, 0x0004002b, 0x00000008, 0x00000067, 0x00000000,
-    0x0004002b, 0x00000008, 0x0000006e, 0x007f0000, 0x0004002b, 0x00000008, 0x00000075, 0x3f000000,
-    0x0004002b, 0x00000008, 0x00000082, 0x00008000, 0x0004002b, 0x00000008, 0x00000087, 0xffff7fff,
-    0x0004002b, 0x00000008, 0x0000008d, 0x003f003f, 0x0004002b, 0x00000008, 0x00000091, 0x00003f00,
-    0x0004002b, 0x00000008, 0x0000009b, 0x1f000000, 0x0004002b, 0x0000001e, 0x0000009f, 0x00000018,
-    0x0004002b, 0x00000008, 0x000000a1, 0x00000001, 0x00040017, 0x000000a7, 0x00000008, 0x00000004,
-    0x0004002b, 0x00000008, 0x000000a8, 0x00000022, 0x0004001c, 0x000000a9, 0x000000a7, 0x000000a8,
-    0x00030016, 0x000000aa, 0x00000020, 0x00040017, 0x000000ab, 0x000000aa, 0x00000002, 0x000e001e,
-    0x000000ac, 0x00000008, 0x00000008, 0x0000001e, 0x00000008, 0x000000a9, 0x00000008, 0x00000008,
-    0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x000000ab, 0x00040020, 0x000000ad, 0x00000002,
-    0x000000ac, 0x0004003b, 0x000000ad, 0x000000ae, 0x00000002, 0x0004002b, 0x0000001e, 0x000000af,
-    0x00000003, 0x00040020, 0x000000b0, 0x00000002, 0x00000008, 0x0004002b, 0x00000008, 0x000000b3,
-    0x00000008, 0x0004002b, 0x00000008, 0x000000bd, 0x00000020, 0x0004002b, 0x0000001e, 0x000000c2,
-    0x00000005, 0x00040017, 0x000000d7, 0x00000008, 0x00000003, 0x00040020, 0x000000d8, 0x00000001,
-    0x000000d7, 0x0004003b, 0x000000d8, 0x000000d9, 0x00000001, 0x00040020, 0x000000da, 0x00000001,
-    0x00000008, 0x0004002b, 0x0000001e, 0x000000f5, 0x00000040, 0x0004002b, 0x00000008, 0x000000fd,
-    0x00000800, 0x0004001c, 0x000000fe, 0x000000a7, 0x000000fd, 0x0004001c, 0x000000ff, 0x00000008,
-    0x000000fd, 0x0004001c, 0x00000100, 0x00000008, 0x000000fd, 0x0003001d, 0x00000101, 0x00000008,
-    0x0007001e, 0x00000102, 0x000000fe, 0x000000ff, 0x00000100, 0x000000a7, 0x00000101, 0x00040020,
-    0x00000103, 0x0000000c, 0x00000102, 0x0004003b, 0x00000103, 0x00000104, 0x0000000c, 0x0004002b,
-    0x0000001e, 0x00000105, 0x00000004, 0x0004002b, 0x0000001e, 0x00000106, 0x00000000, 0x00040032,
-    0x0000001e, 0x00000107, 0x00000100, 0x00060034, 0x0000001e, 0x00000108, 0x00000087, 0x00000107,
-    0x00000055, 0x00040032, 0x0000001e, 0x00000109, 0x000000c0, 0x00060034, 0x0000001e, 0x0000010a,
-    0x00000087, 0x00000109, 0x00000055, 0x00060034, 0x0000001e, 0x0000010b, 0x00000084, 0x00000108,
-    0x0000010a, 0x0004002b, 0x0000001e, 0x0000010c, 0x00000002, 0x00060034, 0x0000001e, 0x0000010d,
-    0x00000084, 0x0000010b, 0x0000010c, 0x00060034, 0x0000001e, 0x0000010e, 0x00000080, 0x00000106,
-    0x0000010d, 0x00060034, 0x00000008, 0x0000010f, 0x00000080, 0x0000010e, 0x00000067, 0x00040020,
-    0x00000112, 0x0000000c, 0x00000008, 0x00060034, 0x0000001e, 0x00000116, 0x00000084, 0x00000108,
-    0x0000010a, 0x00060034, 0x0000001e, 0x00000117, 0x00000084, 0x00000116, 0x000000f5, 0x00060034,
-    0x0000001e, 0x00000118, 0x00000080, 0x0000010e, 0x00000117, 0x00060034, 0x00000008, 0x00000119,
-    0x00000080, 0x00000118, 0x00000067, 0x0003001d, 0x00000136, 0x00000008, 0x0003001e, 0x00000137,
-    0x00000136, 0x00040020, 0x00000138, 0x0000000c, 0x00000137, 0x0004003b, 0x00000138, 0x00000139,
-    0x0000000c, 0x0004002b, 0x0000001e, 0x0000013e, 0x00000001, 0x000a001e, 0x00000141, 0x00000008,
-    0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x0000001e, 0x00000008, 0x00040020,
-    0x00000142, 0x00000009, 0x00000141, 0x0004003b, 0x00000142, 0x00000143, 0x00000009, 0x00040020,
-    0x00000144, 0x00000009, 0x00000008, 0x000d001e, 0x00000153, 0x0000001e, 0x0000001e, 0x0000001e,
-    0x0000001e, 0x0000001e, 0x0000001e, 0x0000001e, 0x0000001e, 0x00000008, 0x000000aa, 0x00000008,
-    0x0003001d, 0x00000154, 0x00000153, 0x0003001e, 0x00000155, 0x00000154, 0x00040020, 0x00000156,
-    0x0000000c, 0x00000155, 0x0004003b, 0x00000156, 0x00000157, 0x0000000c, 0x0004002b, 0x0000001e,
-    0x0000015d, 0x0000000a, 0x0004002b, 0x00000008, 0x00000163, 0x3f000030, 0x0004002b, 0x00000008,
-    0x00000165, 0x00000030, 0x0004002b, 0x00000008, 0x0000016c, 0x00004000, 0x0003001d, 0x00000170,
-    0x00000008, 0x0003001e, 0x00000171, 0x00000170, 0x00040020, 0x00000172, 0x0000000c, 0x00000171,
-    0x0004003b, 0x00000172, 0x00000173, 0x0000000c, 0x0003001d, 0x00000178, 0x00000008, 0x0003001e,
-    0x00000179, 0x00000178, 0x00040020, 0x0000017a, 0x0000000c, 0x00000179, 0x0004003b, 0x0000017a,
-    0x0000017b, 0x0000000c, 0x0003002a, 0x00000006, 0x0000018b, 0x00030029, 0x00000006, 0x00000199,
-    0x0004002b, 0x00000008, 0x0000019b, 0x00000002, 0x0004002b, 0x00000008, 0x000001a0, 0xfffffffc,
-    0x0004002b, 0x00000008, 0x000001bd, 0x0000000f, 0x0004002b, 0x00000008, 0x000001d9, 0x3f008000,
-    0x0004002b, 0x00000008, 0x0000021f, 0x80000000, 0x0004003b, 0x000000d8, 0x0000029a, 0x00000001,
-    0x00060034, 0x00000008, 0x0000029f, 0x00000080, 0x00000108, 0x00000067, 0x0004003b, 0x000000d8,
-    0x000002b2, 0x00000001, 0x0004002b, 0x00000008, 0x000002bc, 0xffffffff, 0x0005002c, 0x00000020,
-    0x000002bd, 0x000002bc, 0x000002bc, 0x0004002b, 0x0000001e, 0x000002bf, 0x00000100, 0x00060034,
-    0x00000006, 0x000002c0, 0x000000aa, 0x00000107, 0x000002bf, 0x0003001d, 0x000002d0, 0x00000008,
-    0x0003001e, 0x000002d1, 0x000002d0, 0x00040020, 0x000002d2, 0x0000000c, 0x000002d1, 0x0004003b,
-    0x000002d2, 0x000002d3, 0x0000000c, 0x00060034, 0x0000001e, 0x000002dc, 0x00000084, 0x00000107,
-    0x00000109, 0x00060034, 0x00000008, 0x000002dd, 0x00000080, 0x000002dc, 0x00000067, 0x00060034,
-    0x0000001e, 0x000002e3, 0x00000084, 0x00000107, 0x00000109, 0x00060034, 0x0000001e, 0x000002e4,
-    0x00000084, 0x000002e3, 0x0000010c, 0x00060034, 0x00000008, 0x000002e5, 0x00000080, 0x000002e4,
-    0x00000067, 0x00060034, 0x00000008, 0x000002e6, 0x00000080, 0x00000067, 0x000002e5, 0x00060034,
-    0x00000008, 0x000002ef, 0x00000080, 0x000002dc, 0x00000067, 0x00060034, 0x0000001e, 0x000002f5,
-    0x00000084, 0x00000107, 0x00000109, 0x00060034, 0x0000001e, 0x000002f6, 0x00000084, 0x000002f5,
-    0x0000010c, 0x00060034, 0x00000008, 0x000002f7, 0x00000080, 0x000002f6, 0x00000067, 0x00060034,
-    0x00000008, 0x000002f8, 0x00000080, 0x000002e6, 0x000002f7, 0x00060034, 0x00000008, 0x00000301,
-    0x00000080, 0x000002dc, 0x00000067, 0x0003001d, 0x00000309, 0x00000008, 0x0003001e, 0x0000030a,
-    0x00000309, 0x00040020, 0x0000030b, 0x0000000c, 0x0000030a, 0x0004003b, 0x0000030b, 0x0000030c,
-    0x0000000c, 0x0003001d, 0x00000316, 0x00000008, 0x0003001e, 0x00000317, 0x00000316, 0x00040020,
-    0x00000318, 0x0000000c, 0x00000317, 0x0004003b, 0x00000318, 0x00000319, 0x0000000c, 0x0004002b,
-    0x00000008, 0x0000031e, 0x00000003, 0x0004002b, 0x00000008, 0x00000321, 0x00000004, 0x0004002b,
-    0x0000001e, 0x0000032b, 0x00000007, 0x00040020, 0x0000032f, 0x00000007, 0x000000aa, 0x0004002b,
-    0x000000aa, 0x00000331, 0x3f800000, 0x00040020, 0x00000334, 0x00000007, 0x000000ab, 0x0004002b,
-    0x0000001e, 0x0000033b, 0x0000000b, 0x00040020, 0x0000033c, 0x00000002, 0x000000ab, 0x00090019,
-    0x00000340, 0x00000008, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000,
-    0x0003001b, 0x00000341, 0x00000340, 0x00040020, 0x00000342, 0x00000000, 0x00000341, 0x0004003b,
-    0x00000342, 0x00000343, 0x00000000, 0x0004002b, 0x000000aa, 0x00000346, 0x00000000, 0x0004003b,
-    0x00000342, 0x0000034a, 0x00000000, 0x0004002b, 0x0000001e, 0x00000355, 0x00000009, 0x0004002b,
-    0x00000008, 0x0000035a, 0x00ffffff, 0x0004002b, 0x0000001e, 0x00000363, 0x00000006, 0x00060034,
-    0x00000008, 0x000003ac, 0x00000080, 0x000002dc, 0x00000067, 0x00060034, 0x00000008, 0x000003ba,
-    0x00000080, 0x000002dc, 0x00000067, 0x00060034, 0x00000008, 0x000003c8, 0x00000080, 0x000002dc,
-    0x00000067, 0x00040032, 0x0000001e, 0x000003df, 0x00003000, 0x0004002b, 0x0000001e, 0x000003e0,
-    0x00000020, 0x0004002b, 0x0000001e, 0x000003e1, 0x00000800, 0x0006002c, 0x000000d7, 0x000003e2,
-    0x000000b3, 0x000000b3, 0x000000a1, 0x00050036, 0x00000002, 0x00000004, 0x00000000, 0x00000003,
-    0x000200f8, 0x00000005, 0x0004003b, 0x0000001f, 0x00000299, 0x00000007, 0x0004003b, 0x00000009,
-    0x000002a3, 0x00000007, 0x0004003b, 0x00000009, 0x000002aa, 0x00000007, 0x0004003b, 0x0000001f,
-    0x000002b1, 0x00000007, 0x0004003b, 0x00000021, 0x000002bb, 0x00000007, 0x0004003b, 0x00000007,
-    0x000002be, 0x00000007, 0x0004003b, 0x00000009, 0x000002c8, 0x00000007, 0x0004003b, 0x00000007,
-    0x000002c9, 0x00000007, 0x0004003b, 0x00000021, 0x000002cf, 0x00000007, 0x0004003b, 0x00000021,
-    0x000002e2, 0x00000007, 0x0004003b, 0x00000021, 0x000002f4, 0x00000007, 0x0004003b, 0x00000009,
-    0x00000315, 0x00000007, 0x0004003b, 0x0000032f, 0x00000330, 0x00000007, 0x0004003b, 0x00000334,
-    0x00000335, 0x00000007, 0x0004003b, 0x0000001f, 0x0000036f, 0x00000007, 0x0004003b, 0x00000009,
-    0x00000371, 0x00000007, 0x0004003b, 0x00000009, 0x00000373, 0x00000007, 0x0004003b, 0x00000021,
-    0x00000374, 0x00000007, 0x0004003b, 0x00000021, 0x00000376, 0x00000007, 0x0004003b, 0x00000021,
-    0x00000378, 0x00000007, 0x0004003b, 0x00000021, 0x0000037a, 0x00000007, 0x0004003b, 0x00000007,
-    0x0000037c, 0x00000007, 0x0004003b, 0x00000009, 0x0000037e, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000380, 0x00000007, 0x0004003b, 0x0000001f, 0x00000389, 0x00000007, 0x0004003b, 0x00000009,
-    0x0000038b, 0x00000007, 0x0004003b, 0x00000009, 0x0000038d, 0x00000007, 0x0004003b, 0x00000021,
-    0x0000038e, 0x00000007, 0x0004003b, 0x00000021, 0x00000390, 0x00000007, 0x0004003b, 0x00000021,
-    0x00000392, 0x00000007, 0x0004003b, 0x00000021, 0x00000394, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000396, 0x00000007, 0x0004003b, 0x00000009, 0x00000398, 0x00000007, 0x0004003b, 0x00000007,
-    0x0000039a, 0x00000007, 0x00050041, 0x000000da, 0x0000029b, 0x0000029a, 0x00000067, 0x0004003d,
-    0x00000008, 0x0000029c, 0x0000029b, 0x00050041, 0x000000da, 0x0000029d, 0x0000029a, 0x000000a1,
-    0x0004003d, 0x00000008, 0x0000029e, 0x0000029d, 0x00050084, 0x00000008, 0x000002a0, 0x0000029e,
-    0x0000029f, 0x00050080, 0x00000008, 0x000002a1, 0x0000029c, 0x000002a0, 0x0004007c, 0x0000001e,
-    0x000002a2, 0x000002a1, 0x0003003e, 0x00000299, 0x000002a2, 0x0004003d, 0x0000001e, 0x000002a4,
-    0x00000299, 0x00050084, 0x0000001e, 0x000002a5, 0x000002a4, 0x0000010c, 0x00050080, 0x0000001e,
-    0x000002a6, 0x00000106, 0x000002a5, 0x00050080, 0x0000001e, 0x000002a7, 0x000002a6, 0x00000106,
-    0x00060041, 0x00000112, 0x000002a8, 0x00000104, 0x00000105, 0x000002a7, 0x0004003d, 0x00000008,
-    0x000002a9, 0x000002a8, 0x0003003e, 0x000002a3, 0x000002a9, 0x0004003d, 0x0000001e, 0x000002ab,
-    0x00000299, 0x00050084, 0x0000001e, 0x000002ac, 0x000002ab, 0x0000010c, 0x00050080, 0x0000001e,
-    0x000002ad, 0x00000106, 0x000002ac, 0x00050080, 0x0000001e, 0x000002ae, 0x000002ad, 0x0000013e,
-    0x00060041, 0x00000112, 0x000002af, 0x00000104, 0x00000105, 0x000002ae, 0x0004003d, 0x00000008,
-    0x000002b0, 0x000002af, 0x0003003e, 0x000002aa, 0x000002b0, 0x00050041, 0x000000da, 0x000002b3,
-    0x000002b2, 0x00000067, 0x0004003d, 0x00000008, 0x000002b4, 0x000002b3, 0x0004007c, 0x0000001e,
-    0x000002b5, 0x000002b4, 0x00050041, 0x000000da, 0x000002b6, 0x000002b2, 0x000000a1, 0x0004003d,
-    0x00000008, 0x000002b7, 0x000002b6, 0x0004007c, 0x0000001e, 0x000002b8, 0x000002b7, 0x00050084,
-    0x0000001e, 0x000002b9, 0x000002b8, 0x00000107, 0x00050080, 0x0000001e, 0x000002ba, 0x000002b5,
-    0x000002b9, 0x0003003e, 0x000002b1, 0x000002ba, 0x0003003e, 0x000002bb, 0x000002bd, 0x000300f7,
-    0x000002c2, 0x00000000, 0x000400fa, 0x000002c0, 0x000002c1, 0x000002c2, 0x000200f8, 0x000002c1,
-    0x00050041, 0x000000b0, 0x000002c3, 0x000000ae, 0x000000af, 0x0004003d, 0x00000008, 0x000002c4,
-    0x000002c3, 0x000500c7, 0x00000008, 0x000002c5, 0x000002c4, 0x00000040, 0x000500ab, 0x00000006,
-    0x000002c6, 0x000002c5, 0x00000067, 0x000200f9, 0x000002c2, 0x000200f8, 0x000002c2, 0x000700f5,
-    0x00000006, 0x000002c7, 0x000002c0, 0x00000005, 0x000002c6, 0x000002c1, 0x0003003e, 0x000002be,
-    0x000002c7, 0x0003003e, 0x000002c8, 0x00000067, 0x0003003e, 0x000002c9, 0x0000018b, 0x00050041,
-    0x00000144, 0x000002ca, 0x00000143, 0x0000010c, 0x0004003d, 0x00000008, 0x000002cb, 0x000002ca,
-    0x000500ab, 0x00000006, 0x000002cc, 0x000002cb, 0x00000067, 0x000300f7, 0x000002ce, 0x00000000,
-    0x000400fa, 0x000002cc, 0x000002cd, 0x00000324, 0x000200f8, 0x000002cd, 0x0004003d, 0x0000001e,
-    0x000002d4, 0x000002b1, 0x0004007c, 0x00000008, 0x000002d5, 0x000002d4, 0x00050080, 0x00000008,
-    0x000002d6, 0x00000067, 0x000002d5, 0x00060041, 0x00000112, 0x000002d7, 0x000002d3, 0x00000106,
-    0x000002d6, 0x0004003d, 0x00000008, 0x000002d8, 0x000002d7, 0x0004003d, 0x0000001e, 0x000002d9,
-    0x000002b1, 0x0004007c, 0x00000008, 0x000002da, 0x000002d9, 0x00050080, 0x00000008, 0x000002db,
-    0x00000067, 0x000002da, 0x00050080, 0x00000008, 0x000002de, 0x000002db, 0x000002dd, 0x00060041,
-    0x00000112, 0x000002df, 0x000002d3, 0x00000106, 0x000002de, 0x0004003d, 0x00000008, 0x000002e0,
-    0x000002df, 0x00050050, 0x00000020, 0x000002e1, 0x000002d8, 0x000002e0, 0x0003003e, 0x000002cf,
-    0x000002e1, 0x0004003d, 0x0000001e, 0x000002e7, 0x000002b1, 0x0004007c, 0x00000008, 0x000002e8,
-    0x000002e7, 0x00050080, 0x00000008, 0x000002e9, 0x000002e6, 0x000002e8, 0x00060041, 0x00000112,
-    0x000002ea, 0x000002d3, 0x00000106, 0x000002e9, 0x0004003d, 0x00000008, 0x000002eb, 0x000002ea,
-    0x0004003d, 0x0000001e, 0x000002ec, 0x000002b1, 0x0004007c, 0x00000008, 0x000002ed, 0x000002ec,
-    0x00050080, 0x00000008, 0x000002ee, 0x000002e6, 0x000002ed, 0x00050080, 0x00000008, 0x000002f0,
-    0x000002ee, 0x000002ef, 0x00060041, 0x00000112, 0x000002f1, 0x000002d3, 0x00000106, 0x000002f0,
-    0x0004003d, 0x00000008, 0x000002f2, 0x000002f1, 0x00050050, 0x00000020, 0x000002f3, 0x000002eb,
-    0x000002f2, 0x0003003e, 0x000002e2, 0x000002f3, 0x0004003d, 0x0000001e, 0x000002f9, 0x000002b1,
-    0x0004007c, 0x00000008, 0x000002fa, 0x000002f9, 0x00050080, 0x00000008, 0x000002fb, 0x000002f8,
-    0x000002fa, 0x00060041, 0x00000112, 0x000002fc, 0x000002d3, 0x00000106, 0x000002fb, 0x0004003d,
-    0x00000008, 0x000002fd, 0x000002fc, 0x0004003d, 0x0000001e, 0x000002fe, 0x000002b1, 0x0004007c,
-    0x00000008, 0x000002ff, 0x000002fe, 0x00050080, 0x00000008, 0x00000300, 0x000002f8, 0x000002ff,
-    0x00050080, 0x00000008, 0x00000302, 0x00000300, 0x00000301, 0x00060041, 0x00000112, 0x00000303,
-    0x000002d3, 0x00000106, 0x00000302, 0x0004003d, 0x00000008, 0x00000304, 0x00000303, 0x00050050,
-    0x00000020, 0x00000305, 0x000002fd, 0x00000304, 0x0003003e, 0x000002f4, 0x00000305, 0x0004003d,
-    0x00000006, 0x00000306, 0x000002be, 0x000300f7, 0x00000308, 0x00000000, 0x000400fa, 0x00000306,
-    0x00000307, 0x00000308, 0x000200f8, 0x00000307, 0x0004003d, 0x0000001e, 0x0000030d, 0x000002b1,
-    0x00060041, 0x00000112, 0x0000030e, 0x0000030c, 0x00000106, 0x0000030d, 0x0004003d, 0x00000008,
-    0x0000030f, 0x0000030e, 0x0004003d, 0x0000001e, 0x00000310, 0x000002b1, 0x00050080, 0x0000001e,
-    0x00000311, 0x00000310, 0x000002dc, 0x00060041, 0x00000112, 0x00000312, 0x0000030c, 0x00000106,
-    0x00000311, 0x0004003d, 0x00000008, 0x00000313, 0x00000312, 0x00050050, 0x00000020, 0x00000314,
-    0x0000030f, 0x00000313, 0x0003003e, 0x000002bb, 0x00000314, 0x000200f9, 0x00000308, 0x000200f8,
-    0x00000308, 0x0004003d, 0x0000001e, 0x0000031a, 0x000002b1, 0x00060041, 0x00000112, 0x0000031b,
-    0x00000319, 0x00000106, 0x0000031a, 0x0004003d, 0x00000008, 0x0000031c, 0x0000031b, 0x0003003e,
-    0x00000315, 0x0000031c, 0x0004003d, 0x00000008, 0x0000031d, 0x00000315, 0x000500c7, 0x00000008,
-    0x0000031f, 0x0000031d, 0x0000031e, 0x0003003e, 0x000002c8, 0x0000031f, 0x0004003d, 0x00000008,
-    0x00000320, 0x00000315, 0x000500c7, 0x00000008, 0x00000322, 0x00000320, 0x00000321, 0x000500ab,
-    0x00000006, 0x00000323, 0x00000322, 0x00000067, 0x0003003e, 0x000002c9, 0x00000323, 0x000200f9,
-    0x000002ce, 0x000200f8, 0x00000324, 0x00050041, 0x000000b0, 0x00000325, 0x000000ae, 0x000000af,
-    0x0004003d, 0x00000008, 0x00000326, 0x00000325, 0x000500c7, 0x00000008, 0x00000327, 0x00000326,
-    0x0000016c, 0x000500ab, 0x00000006, 0x00000328, 0x00000327, 0x00000067, 0x000300f7, 0x0000032a,
-    0x00000000, 0x000400fa, 0x00000328, 0x00000329, 0x0000035f, 0x000200f8, 0x00000329, 0x00050041,
-    0x000000b0, 0x0000032c, 0x000000ae, 0x0000032b, 0x0004003d, 0x00000008, 0x0000032d, 0x0000032c,
-    0x00050050, 0x00000020, 0x0000032e, 0x0000032d, 0x00000067, 0x0003003e, 0x000002f4, 0x0000032e,
-    0x0004006f, 0x000000aa, 0x00000332, 0x00000107, 0x00050088, 0x000000aa, 0x00000333, 0x00000331,
-    0x00000332, 0x0003003e, 0x00000330, 0x00000333, 0x0004003d, 0x000000d7, 0x00000336, 0x000002b2,
-    0x0007004f, 0x00000020, 0x00000337, 0x00000336, 0x00000336, 0x00000000, 0x00000001, 0x00040070,
-    0x000000ab, 0x00000338, 0x00000337, 0x0004003d, 0x000000aa, 0x00000339, 0x00000330, 0x0005008e,
-    0x000000ab, 0x0000033a, 0x00000338, 0x00000339, 0x00050041, 0x0000033c, 0x0000033d, 0x000000ae,
-    0x0000033b, 0x0004003d, 0x000000ab, 0x0000033e, 0x0000033d, 0x00050081, 0x000000ab, 0x0000033f,
-    0x0000033a, 0x0000033e, 0x0003003e, 0x00000335, 0x0000033f, 0x0004003d, 0x00000341, 0x00000344,
-    0x00000343, 0x0004003d, 0x000000ab, 0x00000345, 0x00000335, 0x00070058, 0x000000a7, 0x00000347,
-    0x00000344, 0x00000345, 0x00000002, 0x00000346, 0x00050051, 0x00000008, 0x00000348, 0x00000347,
-    0x00000000, 0x00050050, 0x00000020, 0x00000349, 0x00000348, 0x00000067, 0x0003003e, 0x000002cf,
-    0x00000349, 0x0004003d, 0x00000341, 0x0000034b, 0x0000034a, 0x0004003d, 0x000000ab, 0x0000034c,
-    0x00000335, 0x00070058, 0x000000a7, 0x0000034d, 0x0000034b, 0x0000034c, 0x00000002, 0x00000346,
-    0x00050051, 0x00000008, 0x0000034e, 0x0000034d, 0x00000000, 0x00050050, 0x00000020, 0x0000034f,
-    0x0000034e, 0x00000067, 0x0003003e, 0x000002e2, 0x0000034f, 0x00050041, 0x00000009, 0x00000350,
-    0x000002f4, 0x00000067, 0x0004003d, 0x00000008, 0x00000351, 0x00000350, 0x000500c7, 0x00000008,
-    0x00000352, 0x00000351, 0x00000087, 0x00050041, 0x00000009, 0x00000353, 0x000002e2, 0x00000067,
-    0x0004003d, 0x00000008, 0x00000354, 0x00000353, 0x000500c2, 0x00000008, 0x00000356, 0x00000354,
-    0x00000355, 0x000500c7, 0x00000008, 0x00000357, 0x00000356, 0x00000082, 0x000500c5, 0x00000008,
-    0x00000358, 0x00000352, 0x00000357, 0x00050041, 0x00000009, 0x00000359, 0x000002f4, 0x00000067,
-    0x0003003e, 0x00000359, 0x00000358, 0x00050041, 0x00000009, 0x0000035b, 0x000002e2, 0x00000067,
-    0x0004003d, 0x00000008, 0x0000035c, 0x0000035b, 0x000500c7, 0x00000008, 0x0000035d, 0x0000035c,
-    0x0000035a, 0x00050041, 0x00000009, 0x0000035e, 0x000002e2, 0x00000067, 0x0003003e, 0x0000035e,
-    0x0000035d, 0x000200f9, 0x0000032a, 0x000200f8, 0x0000035f, 0x00050041, 0x000000b0, 0x00000360,
-    0x000000ae, 0x000000c2, 0x0004003d, 0x00000008, 0x00000361, 0x00000360, 0x00050050, 0x00000020,
-    0x00000362, 0x00000361, 0x00000067, 0x0003003e, 0x000002cf, 0x00000362, 0x00050041, 0x000000b0,
-    0x00000364, 0x000000ae, 0x00000363, 0x0004003d, 0x00000008, 0x00000365, 0x00000364, 0x00050050,
-    0x00000020, 0x00000366, 0x00000365, 0x00000067, 0x0003003e, 0x000002e2, 0x00000366, 0x00050041,
-    0x000000b0, 0x00000367, 0x000000ae, 0x0000032b, 0x0004003d, 0x00000008, 0x00000368, 0x00000367,
-    0x00050050, 0x00000020, 0x00000369, 0x00000368, 0x00000067, 0x0003003e, 0x000002f4, 0x00000369,
-    0x000200f9, 0x0000032a, 0x000200f8, 0x0000032a, 0x000200f9, 0x000002ce, 0x000200f8, 0x000002ce,
-    0x00050041, 0x00000144, 0x0000036a, 0x00000143, 0x0000010c, 0x0004003d, 0x00000008, 0x0000036b,
-    0x0000036a, 0x000500aa, 0x00000006, 0x0000036c, 0x0000036b, 0x00000067, 0x000300f7, 0x0000036e,
-    0x00000000, 0x000400fa, 0x0000036c, 0x0000036d, 0x0000036e, 0x000200f8, 0x0000036d, 0x0003003e,
-    0x000002c8, 0x00000067, 0x0003003e, 0x000002c9, 0x0000018b, 0x000200f9, 0x0000036e, 0x000200f8,
-    0x0000036e, 0x0004003d, 0x0000001e, 0x00000370, 0x00000299, 0x0003003e, 0x0000036f, 0x00000370,
-    0x0004003d, 0x00000008, 0x00000372, 0x000002a3, 0x0003003e, 0x00000371, 0x00000372, 0x0003003e,
-    0x00000373, 0x00000067, 0x0004003d, 0x00000020, 0x00000375, 0x000002cf, 0x0003003e, 0x00000374,
-    0x00000375, 0x0004003d, 0x00000020, 0x00000377, 0x000002e2, 0x0003003e, 0x00000376, 0x00000377,
-    0x0004003d, 0x00000020, 0x00000379, 0x000002f4, 0x0003003e, 0x00000378, 0x00000379, 0x0004003d,
-    0x00000020, 0x0000037b, 0x000002bb, 0x0003003e, 0x0000037a, 0x0000037b, 0x0004003d, 0x00000006,
-    0x0000037d, 0x000002be, 0x0003003e, 0x0000037c, 0x0000037d, 0x0004003d, 0x00000008, 0x0000037f,
-    0x000002c8, 0x0003003e, 0x0000037e, 0x0000037f, 0x0004003d, 0x00000006, 0x00000381, 0x000002c9,
-    0x0003003e, 0x00000380, 0x00000381, 0x000e0039, 0x00000002, 0x00000382, 0x0000002d, 0x0000036f,
-    0x00000371, 0x00000373, 0x00000374, 0x00000376, 0x00000378, 0x0000037a, 0x0000037c, 0x0000037e,
-    0x00000380, 0x0004003d, 0x00000020, 0x00000383, 0x00000374, 0x0003003e, 0x000002cf, 0x00000383,
-    0x0004003d, 0x00000020, 0x00000384, 0x00000376, 0x0003003e, 0x000002e2, 0x00000384, 0x0004003d,
-    0x00000020, 0x00000385, 0x00000378, 0x0003003e, 0x000002f4, 0x00000385, 0x0004003d, 0x00000020,
-    0x00000386, 0x0000037a, 0x0003003e, 0x000002bb, 0x00000386, 0x0004003d, 0x00000008, 0x00000387,
-    0x0000037e, 0x0003003e, 0x000002c8, 0x00000387, 0x0004003d, 0x00000006, 0x00000388, 0x00000380,
-    0x0003003e, 0x000002c9, 0x00000388, 0x0004003d, 0x0000001e, 0x0000038a, 0x00000299, 0x0003003e,
-    0x00000389, 0x0000038a, 0x0004003d, 0x00000008, 0x0000038c, 0x000002aa, 0x0003003e, 0x0000038b,
-    0x0000038c, 0x0003003e, 0x0000038d, 0x000000bd, 0x0004003d, 0x00000020, 0x0000038f, 0x000002cf,
-    0x0003003e, 0x0000038e, 0x0000038f, 0x0004003d, 0x00000020, 0x00000391, 0x000002e2, 0x0003003e,
-    0x00000390, 0x00000391, 0x0004003d, 0x00000020, 0x00000393, 0x000002f4, 0x0003003e, 0x00000392,
-    0x00000393, 0x0004003d, 0x00000020, 0x00000395, 0x000002bb, 0x0003003e, 0x00000394, 0x00000395,
-    0x0004003d, 0x00000006, 0x00000397, 0x000002be, 0x0003003e, 0x00000396, 0x00000397, 0x0004003d,
-    0x00000008, 0x00000399, 0x000002c8, 0x0003003e, 0x00000398, 0x00000399, 0x0004003d, 0x00000006,
-    0x0000039b, 0x000002c9, 0x0003003e, 0x0000039a, 0x0000039b, 0x000e0039, 0x00000002, 0x0000039c,
-    0x0000002d, 0x00000389, 0x0000038b, 0x0000038d, 0x0000038e, 0x00000390, 0x00000392, 0x00000394,
-    0x00000396, 0x00000398, 0x0000039a, 0x0004003d, 0x00000020, 0x0000039d, 0x0000038e, 0x0003003e,
-    0x000002cf, 0x0000039d, 0x0004003d, 0x00000020, 0x0000039e, 0x00000390, 0x0003003e, 0x000002e2,
-    0x0000039e, 0x0004003d, 0x00000020, 0x0000039f, 0x00000392, 0x0003003e, 0x000002f4, 0x0000039f,
-    0x0004003d, 0x00000020, 0x000003a0, 0x00000394, 0x0003003e, 0x000002bb, 0x000003a0, 0x0004003d,
-    0x00000008, 0x000003a1, 0x00000398, 0x0003003e, 0x000002c8, 0x000003a1, 0x0004003d, 0x00000006,
-    0x000003a2, 0x0000039a, 0x0003003e, 0x000002c9, 0x000003a2, 0x0004003d, 0x0000001e, 0x000003a3,
-    0x000002b1, 0x0004007c, 0x00000008, 0x000003a4, 0x000003a3, 0x00050080, 0x00000008, 0x000003a5,
-    0x00000067, 0x000003a4, 0x00050041, 0x00000009, 0x000003a6, 0x000002cf, 0x00000067, 0x0004003d,
-    0x00000008, 0x000003a7, 0x000003a6, 0x00060041, 0x00000112, 0x000003a8, 0x000002d3, 0x00000106,
-    0x000003a5, 0x0003003e, 0x000003a8, 0x000003a7, 0x0004003d, 0x0000001e, 0x000003a9, 0x000002b1,
-    0x0004007c, 0x00000008, 0x000003aa, 0x000003a9, 0x00050080, 0x00000008, 0x000003ab, 0x00000067,
-    0x000003aa, 0x00050080, 0x00000008, 0x000003ad, 0x000003ab, 0x000003ac, 0x00050041, 0x00000009,
-    0x000003ae, 0x000002cf, 0x000000a1, 0x0004003d, 0x00000008, 0x000003af, 0x000003ae, 0x00060041,
-    0x00000112, 0x000003b0, 0x000002d3, 0x00000106, 0x000003ad, 0x0003003e, 0x000003b0, 0x000003af,
-    0x0004003d, 0x0000001e, 0x000003b1, 0x000002b1, 0x0004007c, 0x00000008, 0x000003b2, 0x000003b1,
-    0x00050080, 0x00000008, 0x000003b3, 0x000002e6, 0x000003b2, 0x00050041, 0x00000009, 0x000003b4,
-    0x000002e2, 0x00000067, 0x0004003d, 0x00000008, 0x000003b5, 0x000003b4, 0x00060041, 0x00000112,
-    0x000003b6, 0x000002d3, 0x00000106, 0x000003b3, 0x0003003e, 0x000003b6, 0x000003b5, 0x0004003d,
-    0x0000001e, 0x000003b7, 0x000002b1, 0x0004007c, 0x00000008, 0x000003b8, 0x000003b7, 0x00050080,
-    0x00000008, 0x000003b9, 0x000002e6, 0x000003b8, 0x00050080, 0x00000008, 0x000003bb, 0x000003b9,
-    0x000003ba, 0x00050041, 0x00000009, 0x000003bc, 0x000002e2, 0x000000a1, 0x0004003d, 0x00000008,
-    0x000003bd, 0x000003bc, 0x00060041, 0x00000112, 0x000003be, 0x000002d3, 0x00000106, 0x000003bb,
-    0x0003003e, 0x000003be, 0x000003bd, 0x0004003d, 0x0000001e, 0x000003bf, 0x000002b1, 0x0004007c,
-    0x00000008, 0x000003c0, 0x000003bf, 0x00050080, 0x00000008, 0x000003c1, 0x000002f8, 0x000003c0,
-    0x00050041, 0x00000009, 0x000003c2, 0x000002f4, 0x00000067, 0x0004003d, 0x00000008, 0x000003c3,
-    0x000003c2, 0x00060041, 0x00000112, 0x000003c4, 0x000002d3, 0x00000106, 0x000003c1, 0x0003003e,
-    0x000003c4, 0x000003c3, 0x0004003d, 0x0000001e, 0x000003c5, 0x000002b1, 0x0004007c, 0x00000008,
-    0x000003c6, 0x000003c5, 0x00050080, 0x00000008, 0x000003c7, 0x000002f8, 0x000003c6, 0x00050080,
-    0x00000008, 0x000003c9, 0x000003c7, 0x000003c8, 0x00050041, 0x00000009, 0x000003ca, 0x000002f4,
-    0x000000a1, 0x0004003d, 0x00000008, 0x000003cb, 0x000003ca, 0x00060041, 0x00000112, 0x000003cc,
-    0x000002d3, 0x00000106, 0x000003c9, 0x0003003e, 0x000003cc, 0x000003cb, 0x0004003d, 0x00000006,
-    0x000003cd, 0x000002be, 0x000300f7, 0x000003cf, 0x00000000, 0x000400fa, 0x000003cd, 0x000003ce,
-    0x000003cf, 0x000200f8, 0x000003ce, 0x0004003d, 0x0000001e, 0x000003d0, 0x000002b1, 0x00050041,
-    0x00000009, 0x000003d1, 0x000002bb, 0x00000067, 0x0004003d, 0x00000008, 0x000003d2, 0x000003d1,
-    0x00060041, 0x00000112, 0x000003d3, 0x0000030c, 0x00000106, 0x000003d0, 0x0003003e, 0x000003d3,
-    0x000003d2, 0x0004003d, 0x0000001e, 0x000003d4, 0x000002b1, 0x00050080, 0x0000001e, 0x000003d5,
-    0x000003d4, 0x000002dc, 0x00050041, 0x00000009, 0x000003d6, 0x000002bb, 0x000000a1, 0x0004003d,
-    0x00000008, 0x000003d7, 0x000003d6, 0x00060041, 0x00000112, 0x000003d8, 0x0000030c, 0x00000106,
-    0x000003d5, 0x0003003e, 0x000003d8, 0x000003d7, 0x000200f9, 0x000003cf, 0x000200f8, 0x000003cf,
-    0x0004003d, 0x0000001e, 0x000003d9, 0x000002b1, 0x0004003d, 0x00000008, 0x000003da, 0x000002c8,
-    0x0004003d, 0x00000006, 0x000003db, 0x000002c9, 0x000600a9, 0x00000008, 0x000003dc, 0x000003db,
-    0x00000321, 0x00000067, 0x000500c5, 0x00000008, 0x000003dd, 0x000003da, 0x000003dc, 0x00060041,
-    0x00000112, 0x000003de, 0x00000319, 0x00000106, 0x000003d9, 0x0003003e, 0x000003de, 0x000003dd,
-    0x000100fd, 0x00010038, 0x00050036, 0x00000006, 0x00000010, 0x00000000, 0x0000000a, 0x00030037,
-    0x00000007, 0x0000000b, 0x00030037, 0x00000007, 0x0000000c, 0x00030037, 0x00000009, 0x0000000d,
-    0x00030037, 0x00000009, 0x0000000e, 0x00030037, 0x00000009, 0x0000000f, 0x000200f8, 0x00000011,
-    0x0004003b, 0x00000007, 0x00000043, 0x00000007, 0x0004003d, 0x00000006, 0x0000002f, 0x0000000b,
-    0x000300f7, 0x00000031, 0x00000000, 0x000400fa, 0x0000002f, 0x00000030, 0x00000031, 0x000200f8,
-    0x00000030, 0x0004003d, 0x00000008, 0x00000032, 0x0000000d, 0x0004003d, 0x00000008, 0x00000033,
-    0x0000000e, 0x00050082, 0x00000008, 0x00000034, 0x00000032, 0x00000033, 0x00050080, 0x00000008,
-    0x00000036, 0x00000034, 0x00000035, 0x000500b2, 0x00000006, 0x00000038, 0x00000036, 0x00000037,
-    0x000200fe, 0x00000038, 0x000200f8, 0x00000031, 0x0004003d, 0x00000006, 0x0000003a, 0x0000000c,
-    0x000300f7, 0x0000003c, 0x00000000, 0x000400fa, 0x0000003a, 0x0000003b, 0x0000003c, 0x000200f8,
-    0x0000003b, 0x0004003d, 0x00000008, 0x0000003d, 0x0000000f, 0x000500c7, 0x00000008, 0x0000003f,
-    0x0000003d, 0x0000003e, 0x000500aa, 0x00000006, 0x00000041, 0x0000003f, 0x00000040, 0x000200f9,
-    0x0000003c, 0x000200f8, 0x0000003c, 0x000700f5, 0x00000006, 0x00000042, 0x0000003a, 0x00000031,
-    0x00000041, 0x0000003b, 0x000300f7, 0x00000045, 0x00000000, 0x000400fa, 0x00000042, 0x00000044,
-    0x00000049, 0x000200f8, 0x00000044, 0x0004003d, 0x00000008, 0x00000046, 0x0000000e, 0x0004003d,
-    0x00000008, 0x00000047, 0x0000000d, 0x000500b2, 0x00000006, 0x00000048, 0x00000046, 0x00000047,
-    0x0003003e, 0x00000043, 0x00000048, 0x000200f9, 0x00000045, 0x000200f8, 0x00000049, 0x0004003d,
-    0x00000008, 0x0000004a, 0x0000000e, 0x0004003d, 0x00000008, 0x0000004b, 0x0000000d, 0x000500b0,
-    0x00000006, 0x0000004c, 0x0000004a, 0x0000004b, 0x0003003e, 0x00000043, 0x0000004c, 0x000200f9,
-    0x00000045, 0x000200f8, 0x00000045, 0x0004003d, 0x00000006, 0x0000004d, 0x00000043, 0x000200fe,
-    0x0000004d, 0x00010038, 0x00050036, 0x00000002, 0x0000001c, 0x00000000, 0x00000012, 0x00030037,
-    0x00000009, 0x00000013, 0x00030037, 0x00000009, 0x00000014, 0x00030037, 0x00000009, 0x00000015,
-    0x00030037, 0x00000007, 0x00000016, 0x00030037, 0x00000009, 0x00000017, 0x00030037, 0x00000009,
-    0x00000018, 0x00030037, 0x00000009, 0x00000019, 0x00030037, 0x00000009, 0x0000001a, 0x00030037,
-    0x00000007, 0x0000001b, 0x000200f8, 0x0000001d, 0x0004003b, 0x00000009, 0x00000050, 0x00000007,
-    0x0004003b, 0x00000007, 0x0000006a, 0x00000007, 0x0004003b, 0x00000009, 0x0000008b, 0x00000007,
-    0x0004003b, 0x00000009, 0x0000008f, 0x00000007, 0x0004003b, 0x00000009, 0x00000093, 0x00000007,
-    0x0004003b, 0x00000009, 0x00000096, 0x00000007, 0x0004003b, 0x00000009, 0x00000099, 0x00000007,
-    0x0004003b, 0x00000009, 0x0000009d, 0x00000007, 0x0004003d, 0x00000008, 0x00000051, 0x0000001a,
-    0x000500c7, 0x00000008, 0x00000053, 0x00000051, 0x00000052, 0x0004003d, 0x00000008, 0x00000054,
-    0x0000001a, 0x000500c2, 0x00000008, 0x00000056, 0x00000054, 0x00000055, 0x000500c7, 0x00000008,
-    0x00000058, 0x00000056, 0x00000057, 0x000500c5, 0x00000008, 0x00000059, 0x00000053, 0x00000058,
-    0x000500c5, 0x00000008, 0x0000005b, 0x00000059, 0x0000005a, 0x0004003d, 0x00000008, 0x0000005c,
-    0x00000015, 0x000500c7, 0x00000008, 0x0000005e, 0x0000005c, 0x0000005d, 0x000500c5, 0x00000008,
-    0x0000005f, 0x0000005b, 0x0000005e, 0x0003003e, 0x00000050, 0x0000005f, 0x0004003d, 0x00000006,
-    0x00000060, 0x00000016, 0x000400a8, 0x00000006, 0x00000061, 0x00000060, 0x000400a8, 0x00000006,
-    0x00000062, 0x00000061, 0x000300f7, 0x00000064, 0x00000000, 0x000400fa, 0x00000062, 0x00000063,
-    0x00000064, 0x000200f8, 0x00000063, 0x0004003d, 0x00000008, 0x00000065, 0x00000015, 0x000500c7,
-    0x00000008, 0x00000066, 0x00000065, 0x0000005a, 0x000500ab, 0x00000006, 0x00000068, 0x00000066,
-    0x00000067, 0x000200f9, 0x00000064, 0x000200f8, 0x00000064, 0x000700f5, 0x00000006, 0x00000069,
-    0x00000061, 0x0000001d, 0x00000068, 0x00000063, 0x000300f7, 0x0000006c, 0x00000000, 0x000400fa,
-    0x00000069, 0x0000006b, 0x00000073, 0x000200f8, 0x0000006b, 0x0004003d, 0x00000008, 0x0000006d,
-    0x00000015, 0x000500c7, 0x00000008, 0x0000006f, 0x0000006d, 0x0000006e, 0x0004003d, 0x00000008,
-    0x00000070, 0x00000050, 0x000500c7, 0x00000008, 0x00000071, 0x00000070, 0x0000006e, 0x000500ab,
-    0x00000006, 0x00000072, 0x0000006f, 0x00000071, 0x0003003e, 0x0000006a, 0x00000072, 0x000200f9,
-    0x0000006c, 0x000200f8, 0x00000073, 0x0004003d, 0x00000008, 0x00000074, 0x00000015, 0x000500c7,
-    0x00000008, 0x00000076, 0x00000074, 0x00000075, 0x0004003d, 0x00000008, 0x00000077, 0x0000001a,
-    0x000500c7, 0x00000008, 0x00000078, 0x00000077, 0x00000075, 0x000500ab, 0x00000006, 0x00000079,
-    0x00000076, 0x00000078, 0x0003003e, 0x0000006a, 0x00000079, 0x000200f9, 0x0000006c, 0x000200f8,
-    0x0000006c, 0x0004003d, 0x00000006, 0x0000007a, 0x0000006a, 0x000300f7, 0x0000007c, 0x00000000,
-    0x000400fa, 0x0000007a, 0x0000007b, 0x0000007c, 0x000200f8, 0x0000007b, 0x0004003d, 0x00000006,
-    0x0000007d, 0x0000001b, 0x000300f7, 0x0000007f, 0x00000000, 0x000400fa, 0x0000007d, 0x0000007e,
-    0x0000007f, 0x000200f8, 0x0000007e, 0x0004003d, 0x00000008, 0x00000080, 0x00000019, 0x0003003e,
-    0x00000014, 0x00000080, 0x000200f9, 0x0000007f, 0x000200f8, 0x0000007f, 0x0004003d, 0x00000008,
-    0x00000081, 0x00000015, 0x000500c7, 0x00000008, 0x00000083, 0x00000081, 0x00000082, 0x000500aa,
-    0x00000006, 0x00000084, 0x00000083, 0x00000067, 0x000300f7, 0x00000086, 0x00000000, 0x000400fa,
-    0x00000084, 0x00000085, 0x00000086, 0x000200f8, 0x00000085, 0x0004003d, 0x00000008, 0x00000088,
-    0x00000050, 0x000500c7, 0x00000008, 0x00000089, 0x00000088, 0x00000087, 0x0003003e, 0x00000050,
-    0x00000089, 0x000200f9, 0x00000086, 0x000200f8, 0x00000086, 0x0004003d, 0x00000008, 0x0000008a,
-    0x00000050, 0x0003003e, 0x00000015, 0x0000008a, 0x0004003d, 0x00000008, 0x0000008c, 0x00000017,
-    0x000500c7, 0x00000008, 0x0000008e, 0x0000008c, 0x0000008d, 0x0003003e, 0x0000008b, 0x0000008e,
-    0x0004003d, 0x00000008, 0x00000090, 0x00000017, 0x000500c7, 0x00000008, 0x00000092, 0x00000090,
-    0x00000091, 0x0003003e, 0x0000008f, 0x00000092, 0x0004003d, 0x00000008, 0x00000094, 0x00000013,
-    0x000500c7, 0x00000008, 0x00000095, 0x00000094, 0x0000008d, 0x0003003e, 0x00000093, 0x00000095,
-    0x0004003d, 0x00000008, 0x00000097, 0x00000013, 0x000500c7, 0x00000008, 0x00000098, 0x00000097,
-    0x00000091, 0x0003003e, 0x00000096, 0x00000098, 0x0004003d, 0x00000008, 0x0000009a, 0x00000013,
-    0x000500c7, 0x00000008, 0x0000009c, 0x0000009a, 0x0000009b, 0x0003003e, 0x00000099, 0x0000009c,
-    0x0004003d, 0x00000008, 0x0000009e, 0x00000018, 0x000500c2, 0x00000008, 0x000000a0, 0x0000009e,
-    0x0000009f, 0x00050080, 0x00000008, 0x000000a2, 0x000000a0, 0x000000a1, 0x0003003e, 0x0000009d,
-    0x000000a2, 0x0004003d, 0x00000008, 0x000000a3, 0x00000099, 0x000500ab, 0x00000006, 0x000000a4,
-    0x000000a3, 0x00000067, 0x000300f7, 0x000000a6, 0x00000000, 0x000400fa, 0x000000a4, 0x000000a5,
-    0x000000a6, 0x000200f8, 0x000000a5, 0x00050041, 0x000000b0, 0x000000b1, 0x000000ae, 0x000000af,
-    0x0004003d, 0x00000008, 0x000000b2, 0x000000b1, 0x000500c7, 0x00000008, 0x000000b4, 0x000000b2,
-    0x000000b3, 0x000500ab, 0x00000006, 0x000000b5, 0x000000b4, 0x00000067, 0x000200f9, 0x000000a6,
-    0x000200f8, 0x000000a6, 0x000700f5, 0x00000006, 0x000000b6, 0x000000a4, 0x00000086, 0x000000b5,
-    0x000000a5, 0x000300f7, 0x000000b8, 0x00000000, 0x000400fa, 0x000000b6, 0x000000b7, 0x000000b8,
-    0x000200f8, 0x000000b7, 0x0004003d, 0x00000008, 0x000000b9, 0x0000008b, 0x0004003d, 0x00000008,
-    0x000000ba, 0x0000009d, 0x00050084, 0x00000008, 0x000000bb, 0x000000b9, 0x000000ba, 0x0004003d,
-    0x00000008, 0x000000bc, 0x00000093, 0x0004003d, 0x00000008, 0x000000be, 0x0000009d, 0x00050082,
-    0x00000008, 0x000000bf, 0x000000bd, 0x000000be, 0x00050084, 0x00000008, 0x000000c0, 0x000000bc,
-    0x000000bf, 0x00050080, 0x00000008, 0x000000c1, 0x000000bb, 0x000000c0, 0x000500c2, 0x00000008,
-    0x000000c3, 0x000000c1, 0x000000c2, 0x0003003e, 0x0000008b, 0x000000c3, 0x0004003d, 0x00000008,
-    0x000000c4, 0x0000008f, 0x0004003d, 0x00000008, 0x000000c5, 0x0000009d, 0x00050084, 0x00000008,
-    0x000000c6, 0x000000c4, 0x000000c5, 0x0004003d, 0x00000008, 0x000000c7, 0x00000096, 0x0004003d,
-    0x00000008, 0x000000c8, 0x0000009d, 0x00050082, 0x00000008, 0x000000c9, 0x000000bd, 0x000000c8,
-    0x00050084, 0x00000008, 0x000000ca, 0x000000c7, 0x000000c9, 0x00050080, 0x00000008, 0x000000cb,
-    0x000000c6, 0x000000ca, 0x000500c2, 0x00000008, 0x000000cc, 0x000000cb, 0x000000c2, 0x0003003e,
-    0x0000008f, 0x000000cc, 0x000200f9, 0x000000b8, 0x000200f8, 0x000000b8, 0x0004003d, 0x00000008,
-    0x000000cd, 0x0000008b, 0x000500c7, 0x00000008, 0x000000ce, 0x000000cd, 0x0000008d, 0x0004003d,
-    0x00000008, 0x000000cf, 0x0000008f, 0x000500c7, 0x00000008, 0x000000d0, 0x000000cf, 0x00000091,
-    0x000500c5, 0x00000008, 0x000000d1, 0x000000ce, 0x000000d0, 0x0004003d, 0x00000008, 0x000000d2,
-    0x00000099, 0x0004003d, 0x00000008, 0x000000d3, 0x00000018, 0x0007000c, 0x00000008, 0x000000d4,
-    0x00000001, 0x00000029, 0x000000d2, 0x000000d3, 0x000500c5, 0x00000008, 0x000000d5, 0x000000d1,
-    0x000000d4, 0x0003003e, 0x00000013, 0x000000d5, 0x000200f9, 0x0000007c, 0x000200f8, 0x0000007c,
-    0x000100fd, 0x00010038, 0x00050036, 0x00000002, 0x0000002d, 0x00000000, 0x00000022, 0x00030037,
-    0x0000001f, 0x00000023, 0x00030037, 0x00000009, 0x00000024, 0x00030037, 0x00000009, 0x00000025,
-    0x00030037, 0x00000021, 0x00000026, 0x00030037, 0x00000021, 0x00000027, 0x00030037, 0x00000021,
-    0x00000028, 0x00030037, 0x00000021, 0x00000029, 0x00030037, 0x00000007, 0x0000002a, 0x00030037,
-    0x00000009, 0x0000002b, 0x00030037, 0x00000007, 0x0000002c, 0x000200f8, 0x0000002e, 0x0004003b,
-    0x0000001f, 0x000000d6, 0x00000007, 0x0004003b, 0x00000009, 0x000000ea, 0x00000007, 0x0004003b,
-    0x00000009, 0x000000f3, 0x00000007, 0x0004003b, 0x00000009, 0x000000fc, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000115, 0x00000007, 0x0004003b, 0x00000009, 0x00000125, 0x00000007, 0x0004003b,
-    0x00000009, 0x0000012e, 0x00000007, 0x0004003b, 0x00000009, 0x00000135, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000140, 0x00000007, 0x0004003b, 0x00000009, 0x00000152, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000015b, 0x00000007, 0x0004003b, 0x00000007, 0x00000161, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000167, 0x00000007, 0x0004003b, 0x00000007, 0x0000016a, 0x00000007, 0x0004003b,
-    0x00000009, 0x0000016f, 0x00000007, 0x0004003b, 0x00000009, 0x00000177, 0x00000007, 0x0004003b,
-    0x00000009, 0x0000017f, 0x00000007, 0x0004003b, 0x00000007, 0x00000186, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000018a, 0x00000007, 0x0004003b, 0x00000009, 0x000001a3, 0x00000007, 0x0004003b,
-    0x00000009, 0x000001a5, 0x00000007, 0x0004003b, 0x00000007, 0x000001ae, 0x00000007, 0x0004003b,
-    0x00000007, 0x000001b0, 0x00000007, 0x0004003b, 0x00000009, 0x000001b2, 0x00000007, 0x0004003b,
-    0x00000009, 0x000001b4, 0x00000007, 0x0004003b, 0x00000009, 0x000001b6, 0x00000007, 0x0004003b,
-    0x00000007, 0x000001c7, 0x00000007, 0x0004003b, 0x00000007, 0x000001c9, 0x00000007, 0x0004003b,
-    0x00000009, 0x000001cb, 0x00000007, 0x0004003b, 0x00000009, 0x000001ce, 0x00000007, 0x0004003b,
-    0x00000009, 0x000001d0, 0x00000007, 0x0004003b, 0x00000009, 0x000001d7, 0x00000007, 0x0004003b,
-    0x00000009, 0x000001e1, 0x00000007, 0x0004003b, 0x00000007, 0x00000223, 0x00000007, 0x0004003b,
-    0x00000009, 0x0000022b, 0x00000007, 0x0004003b, 0x00000009, 0x0000022e, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000231, 0x00000007, 0x0004003b, 0x00000007, 0x00000234, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000236, 0x00000007, 0x0004003b, 0x00000009, 0x00000238, 0x00000007, 0x0004003b,
-    0x00000009, 0x0000023a, 0x00000007, 0x0004003b, 0x00000009, 0x0000023c, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000023e, 0x00000007, 0x0004003b, 0x00000009, 0x00000251, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000254, 0x00000007, 0x0004003b, 0x00000009, 0x00000257, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000025a, 0x00000007, 0x0004003b, 0x00000009, 0x0000025c, 0x00000007, 0x0004003b,
-    0x00000009, 0x0000025e, 0x00000007, 0x0004003b, 0x00000009, 0x00000260, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000262, 0x00000007, 0x0004003b, 0x00000007, 0x00000264, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000272, 0x00000007, 0x0004003b, 0x00000007, 0x00000274, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000276, 0x00000007, 0x0004003b, 0x00000009, 0x00000279, 0x00000007, 0x0004003b,
-    0x00000009, 0x0000027b, 0x00000007, 0x0004003b, 0x00000007, 0x00000287, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000289, 0x00000007, 0x0004003b, 0x00000009, 0x0000028b, 0x00000007, 0x0004003b,
-    0x00000009, 0x0000028e, 0x00000007, 0x0004003b, 0x00000009, 0x00000290, 0x00000007, 0x00050041,
-    0x000000da, 0x000000db, 0x000000d9, 0x00000067, 0x0004003d, 0x00000008, 0x000000dc, 0x000000db,
-    0x0004007c, 0x0000001e, 0x000000dd, 0x000000dc, 0x00050041, 0x000000da, 0x000000de, 0x000000d9,
-    0x000000a1, 0x0004003d, 0x00000008, 0x000000df, 0x000000de, 0x0004007c, 0x0000001e, 0x000000e0,
-    0x000000df, 0x00050084, 0x0000001e, 0x000000e1, 0x000000e0, 0x00000055, 0x00050080, 0x0000001e,
-    0x000000e2, 0x000000dd, 0x000000e1, 0x0003003e, 0x000000d6, 0x000000e2, 0x000200f9, 0x000000e3,
-    0x000200f8, 0x000000e3, 0x000400f6, 0x000000e5, 0x000000e6, 0x00000000, 0x000200f9, 0x000000e7,
-    0x000200f8, 0x000000e7, 0x0004003d, 0x00000008, 0x000000e8, 0x00000024, 0x000500ab, 0x00000006,
-    0x000000e9, 0x000000e8, 0x00000067, 0x000400fa, 0x000000e9, 0x000000e4, 0x000000e5, 0x000200f8,
-    0x000000e4, 0x0004003d, 0x00000008, 0x000000eb, 0x00000024, 0x0006000c, 0x0000001e, 0x000000ec,
-    0x00000001, 0x00000049, 0x000000eb, 0x0004007c, 0x00000008, 0x000000ed, 0x000000ec, 0x0003003e,
-    0x000000ea, 0x000000ed, 0x0004003d, 0x00000008, 0x000000ee, 0x000000ea, 0x000500c4, 0x00000008,
-    0x000000ef, 0x000000a1, 0x000000ee, 0x000400c8, 0x00000008, 0x000000f0, 0x000000ef, 0x0004003d,
-    0x00000008, 0x000000f1, 0x00000024, 0x000500c7, 0x00000008, 0x000000f2, 0x000000f1, 0x000000f0,
-    0x0003003e, 0x00000024, 0x000000f2, 0x0004003d, 0x0000001e, 0x000000f4, 0x00000023, 0x00050084,
-    0x0000001e, 0x000000f6, 0x000000f4, 0x000000f5, 0x0004007c, 0x00000008, 0x000000f7, 0x000000f6,
-    0x0004003d, 0x00000008, 0x000000f8, 0x000000ea, 0x00050080, 0x00000008, 0x000000f9, 0x000000f7,
-    0x000000f8, 0x0004003d, 0x00000008, 0x000000fa, 0x00000025, 0x00050080, 0x00000008, 0x000000fb,
-    0x000000f9, 0x000000fa, 0x0003003e, 0x000000f3, 0x000000fb, 0x0004003d, 0x00000008, 0x00000110,
-    0x000000f3, 0x00050080, 0x00000008, 0x00000111, 0x0000010f, 0x00000110, 0x00060041, 0x00000112,
-    0x00000113, 0x00000104, 0x00000105, 0x00000111, 0x0004003d, 0x00000008, 0x00000114, 0x00000113,
-    0x0003003e, 0x000000fc, 0x00000114, 0x0004003d, 0x00000008, 0x0000011a, 0x000000f3, 0x00050080,
-    0x00000008, 0x0000011b, 0x00000119, 0x0000011a, 0x00060041, 0x00000112, 0x0000011c, 0x00000104,
-    0x00000105, 0x0000011b, 0x0004003d, 0x00000008, 0x0000011d, 0x0000011c, 0x0003003e, 0x00000115,
-    0x0000011d, 0x000200f9, 0x0000011e, 0x000200f8, 0x0000011e, 0x000400f6, 0x00000120, 0x00000121,
-    0x00000000, 0x000200f9, 0x00000122, 0x000200f8, 0x00000122, 0x0004003d, 0x00000008, 0x00000123,
-    0x000000fc, 0x000500ab, 0x00000006, 0x00000124, 0x00000123, 0x00000067, 0x000400fa, 0x00000124,
-    0x0000011f, 0x00000120, 0x000200f8, 0x0000011f, 0x0004003d, 0x00000008, 0x00000126, 0x000000fc,
-    0x0006000c, 0x0000001e, 0x00000127, 0x00000001, 0x00000049, 0x00000126, 0x0004007c, 0x00000008,
-    0x00000128, 0x00000127, 0x0003003e, 0x00000125, 0x00000128, 0x0004003d, 0x00000008, 0x00000129,
-    0x00000125, 0x000500c4, 0x00000008, 0x0000012a, 0x000000a1, 0x00000129, 0x000400c8, 0x00000008,
-    0x0000012b, 0x0000012a, 0x0004003d, 0x00000008, 0x0000012c, 0x000000fc, 0x000500c7, 0x00000008,
-    0x0000012d, 0x0000012c, 0x0000012b, 0x0003003e, 0x000000fc, 0x0000012d, 0x0004003d, 0x0000001e,
-    0x0000012f, 0x000000d6, 0x0004007c, 0x00000008, 0x00000130, 0x0000012f, 0x0004003d, 0x00000008,
-    0x00000131, 0x00000115, 0x00050084, 0x00000008, 0x00000132, 0x00000131, 0x000000b3, 0x00050084,
-    0x00000008, 0x00000133, 0x00000132, 0x000000b3, 0x00050080, 0x00000008, 0x00000134, 0x00000130,
-    0x00000133, 0x0003003e, 0x0000012e, 0x00000134, 0x0004003d, 0x00000008, 0x0000013a, 0x0000012e,
-    0x00060041, 0x00000112, 0x0000013b, 0x00000139, 0x00000106, 0x0000013a, 0x0004003d, 0x00000008,
-    0x0000013c, 0x0000013b, 0x0003003e, 0x00000135, 0x0000013c, 0x0004003d, 0x00000008, 0x0000013d,
-    0x00000115, 0x00050080, 0x00000008, 0x0000013f, 0x0000013d, 0x0000013e, 0x0003003e, 0x00000115,
-    0x0000013f, 0x00050041, 0x00000144, 0x00000145, 0x00000143, 0x00000106, 0x0004003d, 0x00000008,
-    0x00000146, 0x00000145, 0x0004003d, 0x00000008, 0x00000147, 0x00000125, 0x00050080, 0x00000008,
-    0x00000148, 0x00000146, 0x00000147, 0x0004003d, 0x00000008, 0x00000149, 0x000000ea, 0x0004003d,
-    0x00000008, 0x0000014a, 0x00000025, 0x00050080, 0x00000008, 0x0000014b, 0x00000149, 0x0000014a,
-    0x00050084, 0x00000008, 0x0000014c, 0x0000014b, 0x000000bd, 0x00050080, 0x00000008, 0x0000014d,
-    0x00000148, 0x0000014c, 0x0003003e, 0x00000140, 0x0000014d, 0x0004003d, 0x00000008, 0x0000014e,
-    0x00000135, 0x000500ab, 0x00000006, 0x0000014f, 0x0000014e, 0x00000067, 0x000300f7, 0x00000151,
-    0x00000000, 0x000400fa, 0x0000014f, 0x00000150, 0x00000151, 0x000200f8, 0x00000150, 0x0004003d,
-    0x00000008, 0x00000158, 0x00000140, 0x00070041, 0x00000112, 0x00000159, 0x00000157, 0x00000106,
-    0x00000158, 0x00000055, 0x0004003d, 0x00000008, 0x0000015a, 0x00000159, 0x0003003e, 0x00000152,
-    0x0000015a, 0x0004003d, 0x00000008, 0x0000015c, 0x00000140, 0x00070041, 0x00000112, 0x0000015e,
-    0x00000157, 0x00000106, 0x0000015c, 0x0000015d, 0x0004003d, 0x00000008, 0x0000015f, 0x0000015e,
-    0x000500ab, 0x00000006, 0x00000160, 0x0000015f, 0x00000067, 0x0003003e, 0x0000015b, 0x00000160,
-    0x0004003d, 0x00000008, 0x00000162, 0x00000152, 0x000500c7, 0x00000008, 0x00000164, 0x00000162,
-    0x00000163, 0x000500aa, 0x00000006, 0x00000166, 0x00000164, 0x00000165, 0x0003003e, 0x00000161,
-    0x00000166, 0x0004003d, 0x00000006, 0x00000168, 0x0000002c, 0x0003003e, 0x00000167, 0x00000168,
-    0x0004003d, 0x00000006, 0x00000169, 0x00000161, 0x0003003e, 0x0000002c, 0x00000169, 0x0004003d,
-    0x00000008, 0x0000016b, 0x00000152, 0x000500c7, 0x00000008, 0x0000016d, 0x0000016b, 0x0000016c,
-    0x000500ab, 0x00000006, 0x0000016e, 0x0000016d, 0x00000067, 0x0003003e, 0x0000016a, 0x0000016e,
-    0x0004003d, 0x00000008, 0x00000174, 0x0000012e, 0x00060041, 0x00000112, 0x00000175, 0x00000173,
-    0x00000106, 0x00000174, 0x0004003d, 0x00000008, 0x00000176, 0x00000175, 0x0003003e, 0x0000016f,
-    0x00000176, 0x0004003d, 0x00000008, 0x0000017c, 0x0000012e, 0x00060041, 0x00000112, 0x0000017d,
-    0x0000017b, 0x00000106, 0x0000017c, 0x0004003d, 0x00000008, 0x0000017e, 0x0000017d, 0x0003003e,
-    0x00000177, 0x0000017e, 0x00050041, 0x00000009, 0x00000180, 0x00000028, 0x00000067, 0x0004003d,
-    0x00000008, 0x00000181, 0x00000180, 0x0003003e, 0x0000017f, 0x00000181, 0x0004003d, 0x00000006,
-    0x00000182, 0x00000161, 0x000400a8, 0x00000006, 0x00000183, 0x00000182, 0x000300f7, 0x00000185,
-    0x00000000, 0x000400fa, 0x00000183, 0x00000184, 0x0000026d, 0x000200f8, 0x00000184, 0x0004003d,
-    0x00000008, 0x00000187, 0x00000152, 0x000500c7, 0x00000008, 0x00000188, 0x00000187, 0x00000165,
-    0x000500aa, 0x00000006, 0x00000189, 0x00000188, 0x00000165, 0x0003003e, 0x00000186, 0x00000189,
-    0x0003003e, 0x0000018a, 0x0000018b, 0x0004003d, 0x00000006, 0x0000018c, 0x00000186, 0x000300f7,
-    0x0000018e, 0x00000000, 0x000400fa, 0x0000018c, 0x0000018d, 0x0000018e, 0x000200f8, 0x0000018d,
-    0x0004003d, 0x00000008, 0x0000018f, 0x0000002b, 0x000500aa, 0x00000006, 0x00000190, 0x0000018f,
-    0x00000067, 0x000300f7, 0x00000192, 0x00000000, 0x000400fa, 0x00000190, 0x00000191, 0x00000192,
-    0x000200f8, 0x00000191, 0x000200f9, 0x00000121, 0x000200f8, 0x00000192, 0x0004003d, 0x00000008,
-    0x00000194, 0x0000002b, 0x000500c7, 0x00000008, 0x00000195, 0x00000194, 0x000000a1, 0x000500aa,
-    0x00000006, 0x00000196, 0x00000195, 0x00000067, 0x000300f7, 0x00000198, 0x00000000, 0x000400fa,
-    0x00000196, 0x00000197, 0x00000198, 0x000200f8, 0x00000197, 0x0003003e, 0x0000018a, 0x00000199,
-    0x000200f9, 0x00000198, 0x000200f8, 0x00000198, 0x0004003d, 0x00000008, 0x0000019a, 0x0000002b,
-    0x000500c7, 0x00000008, 0x0000019c, 0x0000019a, 0x0000019b, 0x000500aa, 0x00000006, 0x0000019d,
-    0x0000019c, 0x00000067, 0x000300f7, 0x0000019f, 0x00000000, 0x000400fa, 0x0000019d, 0x0000019e,
-    0x0000019f, 0x000200f8, 0x0000019e, 0x0004003d, 0x00000008, 0x000001a1, 0x0000017f, 0x000500c7,
-    0x00000008, 0x000001a2, 0x000001a1, 0x000001a0, 0x0003003e, 0x0000017f, 0x000001a2, 0x000200f9,
-    0x0000019f, 0x000200f8, 0x0000019f, 0x000200f9, 0x0000018e, 0x000200f8, 0x0000018e, 0x0004003d,
-    0x00000006, 0x000001a4, 0x0000018a, 0x000300f7, 0x000001a7, 0x00000000, 0x000400fa, 0x000001a4,
-    0x000001a6, 0x000001aa, 0x000200f8, 0x000001a6, 0x00050041, 0x00000009, 0x000001a8, 0x00000027,
-    0x000000a1, 0x0004003d, 0x00000008, 0x000001a9, 0x000001a8, 0x0003003e, 0x000001a5, 0x000001a9,
-    0x000200f9, 0x000001a7, 0x000200f8, 0x000001aa, 0x00050041, 0x00000009, 0x000001ab, 0x00000027,
-    0x00000067, 0x0004003d, 0x00000008, 0x000001ac, 0x000001ab, 0x0003003e, 0x000001a5, 0x000001ac,
-    0x000200f9, 0x000001a7, 0x000200f8, 0x000001a7, 0x0004003d, 0x00000008, 0x000001ad, 0x000001a5,
-    0x0003003e, 0x000001a3, 0x000001ad, 0x0004003d, 0x00000006, 0x000001af, 0x0000016a, 0x0003003e,
-    0x000001ae, 0x000001af, 0x0004003d, 0x00000006, 0x000001b1, 0x0000015b, 0x0003003e, 0x000001b0,
-    0x000001b1, 0x0004003d, 0x00000008, 0x000001b3, 0x000001a3, 0x0003003e, 0x000001b2, 0x000001b3,
-    0x0004003d, 0x00000008, 0x000001b5, 0x0000016f, 0x0003003e, 0x000001b4, 0x000001b5, 0x0004003d,
-    0x00000008, 0x000001b7, 0x0000017f, 0x0003003e, 0x000001b6, 0x000001b7, 0x00090039, 0x00000006,
-    0x000001b8, 0x00000010, 0x000001ae, 0x000001b0, 0x000001b2, 0x000001b4, 0x000001b6, 0x000400a8,
-    0x00000006, 0x000001b9, 0x000001b8, 0x000300f7, 0x000001bb, 0x00000000, 0x000400fa, 0x000001b9,
-    0x000001ba, 0x000001bb, 0x000200f8, 0x000001ba, 0x0004003d, 0x00000008, 0x000001bc, 0x0000017f,
-    0x000500c7, 0x00000008, 0x000001be, 0x000001bc, 0x000001bd, 0x000500aa, 0x00000006, 0x000001bf,
-    0x000001be, 0x00000067, 0x0004003d, 0x00000006, 0x000001c0, 0x0000018a, 0x000500a6, 0x00000006,
-    0x000001c1, 0x000001bf, 0x000001c0, 0x000300f7, 0x000001c3, 0x00000000, 0x000400fa, 0x000001c1,
-    0x000001c2, 0x000001c3, 0x000200f8, 0x000001c2, 0x000200f9, 0x00000121, 0x000200f8, 0x000001c3,
-    0x0003003e, 0x0000018a, 0x00000199, 0x00050041, 0x00000009, 0x000001c5, 0x00000028, 0x000000a1,
-    0x0004003d, 0x00000008, 0x000001c6, 0x000001c5, 0x0003003e, 0x0000017f, 0x000001c6, 0x0004003d,
-    0x00000006, 0x000001c8, 0x0000016a, 0x0003003e, 0x000001c7, 0x000001c8, 0x0004003d, 0x00000006,
-    0x000001ca, 0x0000015b, 0x0003003e, 0x000001c9, 0x000001ca, 0x00050041, 0x00000009, 0x000001cc,
-    0x00000027, 0x000000a1, 0x0004003d, 0x00000008, 0x000001cd, 0x000001cc, 0x0003003e, 0x000001cb,
-    0x000001cd, 0x0004003d, 0x00000008, 0x000001cf, 0x0000016f, 0x0003003e, 0x000001ce, 0x000001cf,
-    0x0004003d, 0x00000008, 0x000001d1, 0x0000017f, 0x0003003e, 0x000001d0, 0x000001d1, 0x00090039,
-    0x00000006, 0x000001d2, 0x00000010, 0x000001c7, 0x000001c9, 0x000001cb, 0x000001ce, 0x000001d0,
-    0x000400a8, 0x00000006, 0x000001d3, 0x000001d2, 0x000300f7, 0x000001d5, 0x00000000, 0x000400fa,
-    0x000001d3, 0x000001d4, 0x000001d5, 0x000200f8, 0x000001d4, 0x000200f9, 0x00000121, 0x000200f8,
-    0x000001d5, 0x000200f9, 0x000001bb, 0x000200f8, 0x000001bb, 0x0004003d, 0x00000008, 0x000001d8,
-    0x00000152, 0x000500c7, 0x00000008, 0x000001da, 0x000001d8, 0x000001d9, 0x0003003e, 0x000001d7,
-    0x000001da, 0x0004003d, 0x00000006, 0x000001db, 0x0000015b, 0x000400a8, 0x00000006, 0x000001dc,
-    0x000001db, 0x000300f7, 0x000001de, 0x00000000, 0x000400fa, 0x000001dc, 0x000001dd, 0x000001de,
-    0x000200f8, 0x000001dd, 0x0004003d, 0x00000008, 0x000001df, 0x000001d7, 0x000500c5, 0x00000008,
-    0x000001e0, 0x000001df, 0x00000040, 0x0003003e, 0x000001d7, 0x000001e0, 0x000200f9, 0x000001de,
-    0x000200f8, 0x000001de, 0x0004003d, 0x00000008, 0x000001e2, 0x00000135, 0x000500c7, 0x00000008,
-    0x000001e3, 0x000001e2, 0x0000009b, 0x0003003e, 0x000001e1, 0x000001e3, 0x0004003d, 0x00000008,
-    0x000001e4, 0x000001e1, 0x000500aa, 0x00000006, 0x000001e5, 0x000001e4, 0x0000009b, 0x000300f7,
-    0x000001e7, 0x00000000, 0x000400fa, 0x000001e5, 0x000001e6, 0x00000222, 0x000200f8, 0x000001e6,
-    0x0004003d, 0x00000008, 0x000001e8, 0x00000177, 0x0004003d, 0x00000008, 0x000001e9, 0x000001d7,
-    0x000500c5, 0x00000008, 0x000001ea, 0x000001e9, 0x000001e8, 0x0003003e, 0x000001d7, 0x000001ea,
-    0x0004003d, 0x00000006, 0x000001eb, 0x0000018a, 0x000400a8, 0x00000006, 0x000001ec, 0x000001eb,
-    0x000300f7, 0x000001ee, 0x00000000, 0x000400fa, 0x000001ec, 0x000001ed, 0x0000020e, 0x000200f8,
-    0x000001ed, 0x0004003d, 0x00000008, 0x000001ef, 0x000001d7, 0x000500c7, 0x00000008, 0x000001f0,
-    0x000001ef, 0x000001bd, 0x000500ab, 0x00000006, 0x000001f1, 0x000001f0, 0x00000067, 0x000300f7,
-    0x000001f3, 0x00000000, 0x000400fa, 0x000001f1, 0x000001f2, 0x000001f3, 0x000200f8, 0x000001f2,
-    0x00050041, 0x00000009, 0x000001f4, 0x00000026, 0x00000067, 0x0004003d, 0x00000008, 0x000001f5,
-    0x000001f4, 0x00050041, 0x00000009, 0x000001f6, 0x00000026, 0x000000a1, 0x0003003e, 0x000001f6,
-    0x000001f5, 0x00050041, 0x00000009, 0x000001f7, 0x00000027, 0x00000067, 0x0004003d, 0x00000008,
-    0x000001f8, 0x000001f7, 0x00050041, 0x00000009, 0x000001f9, 0x00000027, 0x000000a1, 0x0003003e,
-    0x000001f9, 0x000001f8, 0x00050041, 0x00000009, 0x000001fa, 0x00000028, 0x00000067, 0x0004003d,
-    0x00000008, 0x000001fb, 0x000001fa, 0x00050041, 0x00000009, 0x000001fc, 0x00000028, 0x000000a1,
-    0x0003003e, 0x000001fc, 0x000001fb, 0x0004003d, 0x00000006, 0x000001fd, 0x0000002a, 0x000300f7,
-    0x000001ff, 0x00000000, 0x000400fa, 0x000001fd, 0x000001fe, 0x000001ff, 0x000200f8, 0x000001fe,
-    0x00050041, 0x00000009, 0x00000200, 0x00000029, 0x00000067, 0x0004003d, 0x00000008, 0x00000201,
-    0x00000200, 0x00050041, 0x00000009, 0x00000202, 0x00000029, 0x000000a1, 0x0003003e, 0x00000202,
-    0x00000201, 0x000200f9, 0x000001ff, 0x000200f8, 0x000001ff, 0x000200f9, 0x000001f3, 0x000200f8,
-    0x000001f3, 0x0004003d, 0x00000008, 0x00000203, 0x00000135, 0x00050041, 0x00000009, 0x00000204,
-    0x00000026, 0x00000067, 0x0003003e, 0x00000204, 0x00000203, 0x0004003d, 0x00000008, 0x00000205,
-    0x0000016f, 0x00050041, 0x00000009, 0x00000206, 0x00000027, 0x00000067, 0x0003003e, 0x00000206,
-    0x00000205, 0x0004003d, 0x00000008, 0x00000207, 0x000001d7, 0x00050041, 0x00000009, 0x00000208,
-    0x00000028, 0x00000067, 0x0003003e, 0x00000208, 0x00000207, 0x0004003d, 0x00000006, 0x00000209,
-    0x0000002a, 0x000300f7, 0x0000020b, 0x00000000, 0x000400fa, 0x00000209, 0x0000020a, 0x0000020b,
-    0x000200f8, 0x0000020a, 0x0004003d, 0x00000008, 0x0000020c, 0x00000140, 0x00050041, 0x00000009,
-    0x0000020d, 0x00000029, 0x00000067, 0x0003003e, 0x0000020d, 0x0000020c, 0x000200f9, 0x0000020b,
-    0x000200f8, 0x0000020b, 0x000200f9, 0x000001ee, 0x000200f8, 0x0000020e, 0x0004003d, 0x00000008,
-    0x0000020f, 0x00000135, 0x00050041, 0x00000009, 0x00000210, 0x00000026, 0x000000a1, 0x0003003e,
-    0x00000210, 0x0000020f, 0x0004003d, 0x00000008, 0x00000211, 0x0000016f, 0x00050041, 0x00000009,
-    0x00000212, 0x00000027, 0x000000a1, 0x0003003e, 0x00000212, 0x00000211, 0x0004003d, 0x00000008,
-    0x00000213, 0x000001d7, 0x00050041, 0x00000009, 0x00000214, 0x00000028, 0x000000a1, 0x0003003e,
-    0x00000214, 0x00000213, 0x0004003d, 0x00000006, 0x00000215, 0x0000002a, 0x000300f7, 0x00000217,
-    0x00000000, 0x000400fa, 0x00000215, 0x00000216, 0x00000217, 0x000200f8, 0x00000216, 0x0004003d,
-    0x00000008, 0x00000218, 0x00000140, 0x00050041, 0x00000009, 0x00000219, 0x00000029, 0x000000a1,
-    0x0003003e, 0x00000219, 0x00000218, 0x000200f9, 0x00000217, 0x000200f8, 0x00000217, 0x000200f9,
-    0x000001ee, 0x000200f8, 0x000001ee, 0x0004003d, 0x00000006, 0x0000021a, 0x0000002a, 0x000300f7,
-    0x0000021c, 0x00000000, 0x000400fa, 0x0000021a, 0x0000021b, 0x0000021c, 0x000200f8, 0x0000021b,
-    0x0004003d, 0x00000008, 0x0000021d, 0x0000012e, 0x0004003d, 0x00000008, 0x0000021e, 0x00000177,
-    0x000500c5, 0x00000008, 0x00000220, 0x0000021e, 0x0000021f, 0x00060041, 0x00000112, 0x00000221,
-    0x0000017b, 0x00000106, 0x0000021d, 0x0003003e, 0x00000221, 0x00000220, 0x000200f9, 0x0000021c,
-    0x000200f8, 0x0000021c, 0x000200f9, 0x000001e7, 0x000200f8, 0x00000222, 0x0004003d, 0x00000008,
-    0x00000224, 0x00000152, 0x000500c7, 0x00000008, 0x00000225, 0x00000224, 0x000000fd, 0x000500ab,
-    0x00000006, 0x00000226, 0x00000225, 0x00000067, 0x0003003e, 0x00000223, 0x00000226, 0x0004003d,
-    0x00000006, 0x00000227, 0x0000018a, 0x000400a8, 0x00000006, 0x00000228, 0x00000227, 0x000300f7,
-    0x0000022a, 0x00000000, 0x000400fa, 0x00000228, 0x00000229, 0x0000022a, 0x000200f8, 0x00000229,
-    0x00050041, 0x00000009, 0x0000022c, 0x00000026, 0x00000067, 0x0004003d, 0x00000008, 0x0000022d,
-    0x0000022c, 0x0003003e, 0x0000022b, 0x0000022d, 0x00050041, 0x00000009, 0x0000022f, 0x00000027,
-    0x00000067, 0x0004003d, 0x00000008, 0x00000230, 0x0000022f, 0x0003003e, 0x0000022e, 0x00000230,
-    0x00050041, 0x00000009, 0x00000232, 0x00000028, 0x00000067, 0x0004003d, 0x00000008, 0x00000233,
-    0x00000232, 0x0003003e, 0x00000231, 0x00000233, 0x0004003d, 0x00000006, 0x00000235, 0x00000186,
-    0x0003003e, 0x00000234, 0x00000235, 0x0004003d, 0x00000008, 0x00000237, 0x00000135, 0x0003003e,
-    0x00000236, 0x00000237, 0x0004003d, 0x00000008, 0x00000239, 0x000001e1, 0x0003003e, 0x00000238,
-    0x00000239, 0x0004003d, 0x00000008, 0x0000023b, 0x0000016f, 0x0003003e, 0x0000023a, 0x0000023b,
-    0x0004003d, 0x00000008, 0x0000023d, 0x000001d7, 0x0003003e, 0x0000023c, 0x0000023d, 0x0004003d,
-    0x00000006, 0x0000023f, 0x00000223, 0x0003003e, 0x0000023e, 0x0000023f, 0x000d0039, 0x00000002,
-    0x00000240, 0x0000001c, 0x0000022b, 0x0000022e, 0x00000231, 0x00000234, 0x00000236, 0x00000238,
-    0x0000023a, 0x0000023c, 0x0000023e, 0x0004003d, 0x00000008, 0x00000241, 0x0000022b, 0x00050041,
-    0x00000009, 0x00000242, 0x00000026, 0x00000067, 0x0003003e, 0x00000242, 0x00000241, 0x0004003d,
-    0x00000008, 0x00000243, 0x0000022e, 0x00050041, 0x00000009, 0x00000244, 0x00000027, 0x00000067,
-    0x0003003e, 0x00000244, 0x00000243, 0x0004003d, 0x00000008, 0x00000245, 0x00000231, 0x00050041,
-    0x00000009, 0x00000246, 0x00000028, 0x00000067, 0x0003003e, 0x00000246, 0x00000245, 0x000200f9,
-    0x0000022a, 0x000200f8, 0x0000022a, 0x0004003d, 0x00000006, 0x00000247, 0x0000018a, 0x000400a8,
-    0x00000006, 0x00000248, 0x00000247, 0x000300f7, 0x0000024a, 0x00000000, 0x000400fa, 0x00000248,
-    0x00000249, 0x0000024a, 0x000200f8, 0x00000249, 0x0004003d, 0x00000008, 0x0000024b, 0x0000017f,
-    0x000500c7, 0x00000008, 0x0000024c, 0x0000024b, 0x000001bd, 0x000500ab, 0x00000006, 0x0000024d,
-    0x0000024c, 0x00000067, 0x000200f9, 0x0000024a, 0x000200f8, 0x0000024a, 0x000700f5, 0x00000006,
-    0x0000024e, 0x00000247, 0x0000022a, 0x0000024d, 0x00000249, 0x000300f7, 0x00000250, 0x00000000,
-    0x000400fa, 0x0000024e, 0x0000024f, 0x00000250, 0x000200f8, 0x0000024f, 0x00050041, 0x00000009,
-    0x00000252, 0x00000026, 0x000000a1, 0x0004003d, 0x00000008, 0x00000253, 0x00000252, 0x0003003e,
-    0x00000251, 0x00000253, 0x00050041, 0x00000009, 0x00000255, 0x00000027, 0x000000a1, 0x0004003d,
-    0x00000008, 0x00000256, 0x00000255, 0x0003003e, 0x00000254, 0x00000256, 0x00050041, 0x00000009,
-    0x00000258, 0x00000028, 0x000000a1, 0x0004003d, 0x00000008, 0x00000259, 0x00000258, 0x0003003e,
-    0x00000257, 0x00000259, 0x0004003d, 0x00000006, 0x0000025b, 0x00000186, 0x0003003e, 0x0000025a,
-    0x0000025b, 0x0004003d, 0x00000008, 0x0000025d, 0x00000135, 0x0003003e, 0x0000025c, 0x0000025d,
-    0x0004003d, 0x00000008, 0x0000025f, 0x000001e1, 0x0003003e, 0x0000025e, 0x0000025f, 0x0004003d,
-    0x00000008, 0x00000261, 0x0000016f, 0x0003003e, 0x00000260, 0x00000261, 0x0004003d, 0x00000008,
-    0x00000263, 0x000001d7, 0x0003003e, 0x00000262, 0x00000263, 0x0004003d, 0x00000006, 0x00000265,
-    0x00000223, 0x0003003e, 0x00000264, 0x00000265, 0x000d0039, 0x00000002, 0x00000266, 0x0000001c,
-    0x00000251, 0x00000254, 0x00000257, 0x0000025a, 0x0000025c, 0x0000025e, 0x00000260, 0x00000262,
-    0x00000264, 0x0004003d, 0x00000008, 0x00000267, 0x00000251, 0x00050041, 0x00000009, 0x00000268,
-    0x00000026, 0x000000a1, 0x0003003e, 0x00000268, 0x00000267, 0x0004003d, 0x00000008, 0x00000269,
-    0x00000254, 0x00050041, 0x00000009, 0x0000026a, 0x00000027, 0x000000a1, 0x0003003e, 0x0000026a,
-    0x00000269, 0x0004003d, 0x00000008, 0x0000026b, 0x00000257, 0x00050041, 0x00000009, 0x0000026c,
-    0x00000028, 0x000000a1, 0x0003003e, 0x0000026c, 0x0000026b, 0x000200f9, 0x00000250, 0x000200f8,
-    0x00000250, 0x000200f9, 0x000001e7, 0x000200f8, 0x000001e7, 0x000200f9, 0x00000185, 0x000200f8,
-    0x0000026d, 0x0004003d, 0x00000006, 0x0000026e, 0x00000167, 0x000400a8, 0x00000006, 0x0000026f,
-    0x0000026e, 0x000300f7, 0x00000271, 0x00000000, 0x000400fa, 0x0000026f, 0x00000270, 0x00000271,
-    0x000200f8, 0x00000270, 0x0003003e, 0x0000002b, 0x00000067, 0x000200f9, 0x00000271, 0x000200f8,
-    0x00000271, 0x0004003d, 0x00000006, 0x00000273, 0x0000016a, 0x0003003e, 0x00000272, 0x00000273,
-    0x0004003d, 0x00000006, 0x00000275, 0x0000015b, 0x0003003e, 0x00000274, 0x00000275, 0x00050041,
-    0x00000009, 0x00000277, 0x00000027, 0x00000067, 0x0004003d, 0x00000008, 0x00000278, 0x00000277,
-    0x0003003e, 0x00000276, 0x00000278, 0x0004003d, 0x00000008, 0x0000027a, 0x0000016f, 0x0003003e,
-    0x00000279, 0x0000027a, 0x00050041, 0x00000009, 0x0000027c, 0x00000028, 0x00000067, 0x0004003d,
-    0x00000008, 0x0000027d, 0x0000027c, 0x0003003e, 0x0000027b, 0x0000027d, 0x00090039, 0x00000006,
-    0x0000027e, 0x00000010, 0x00000272, 0x00000274, 0x00000276, 0x00000279, 0x0000027b, 0x000400a8,
-    0x00000006, 0x0000027f, 0x0000027e, 0x000300f7, 0x00000281, 0x00000000, 0x000400fa, 0x0000027f,
-    0x00000280, 0x00000281, 0x000200f8, 0x00000280, 0x0003003e, 0x0000002b, 0x000000a1, 0x000200f9,
-    0x00000281, 0x000200f8, 0x00000281, 0x0004003d, 0x00000008, 0x00000282, 0x0000017f, 0x000500c7,
-    0x00000008, 0x00000283, 0x00000282, 0x000001bd, 0x000500ab, 0x00000006, 0x00000284, 0x00000283,
-    0x00000067, 0x000300f7, 0x00000286, 0x00000000, 0x000400fa, 0x00000284, 0x00000285, 0x00000286,
-    0x000200f8, 0x00000285, 0x0004003d, 0x00000006, 0x00000288, 0x0000016a, 0x0003003e, 0x00000287,
-    0x00000288, 0x0004003d, 0x00000006, 0x0000028a, 0x0000015b, 0x0003003e, 0x00000289, 0x0000028a,
-    0x00050041, 0x00000009, 0x0000028c, 0x00000027, 0x000000a1, 0x0004003d, 0x00000008, 0x0000028d,
-    0x0000028c, 0x0003003e, 0x0000028b, 0x0000028d, 0x0004003d, 0x00000008, 0x0000028f, 0x0000016f,
-    0x0003003e, 0x0000028e, 0x0000028f, 0x00050041, 0x00000009, 0x00000291, 0x00000028, 0x000000a1,
-    0x0004003d, 0x00000008, 0x00000292, 0x00000291, 0x0003003e, 0x00000290, 0x00000292, 0x00090039,
-    0x00000006, 0x00000293, 0x00000010, 0x00000287, 0x00000289, 0x0000028b, 0x0000028e, 0x00000290,
-    0x000400a8, 0x00000006, 0x00000294, 0x00000293, 0x000300f7, 0x00000296, 0x00000000, 0x000400fa,
-    0x00000294, 0x00000295, 0x00000296, 0x000200f8, 0x00000295, 0x0004003d, 0x00000008, 0x00000297,
-    0x0000002b, 0x000500c5, 0x00000008, 0x00000298, 0x00000297, 0x0000019b, 0x0003003e, 0x0000002b,
-    0x00000298, 0x000200f9, 0x00000296, 0x000200f8, 0x00000296, 0x000200f9, 0x00000286, 0x000200f8,
-    0x00000286, 0x000200f9, 0x00000185, 0x000200f8, 0x00000185, 0x000200f9, 0x00000151, 0x000200f8,
-    0x00000151, 0x000200f9, 0x00000121, 0x000200f8, 0x00000121, 0x000200f9, 0x0000011e, 0x000200f8,
-    0x00000120, 0x000200f9, 0x000000e6, 0x000200f8, 0x000000e6, 0x000200f9, 0x000000e3, 0x000200f8,
-    0x000000e5, 0x000100fd, 0x00010038,
+const uint8_t Blob003_Data[6947] =
+{
+    0x28, 0xb5, 0x2f, 0xfd, 0x60, 0x6c, 0x67, 0xcd, 0xd8, 0x00, 0x2a, 0xde, 0x60, 0x36, 0x36, 0x10,
+    0x80, 0x6e, 0xc6, 0x7c, 0xe9, 0xff, 0x6f, 0xbd, 0x57, 0x9f, 0x35, 0x14, 0xd3, 0xab, 0x51, 0xb8,
+    0xfd, 0x34, 0x63, 0x09, 0x6f, 0x58, 0xb5, 0xae, 0x44, 0x92, 0xdf, 0xf7, 0x96, 0x12, 0x97, 0x77,
+    0x86, 0x4a, 0xdf, 0x1a, 0xdf, 0xcd, 0xed, 0xfe, 0x9d, 0x3d, 0xf7, 0xa7, 0x9e, 0xcf, 0x42, 0x2b,
+    0x57, 0x76, 0x6f, 0x29, 0x53, 0x03, 0x03, 0x58, 0x03, 0x83, 0x03, 0xf3, 0x5b, 0x53, 0xeb, 0x20,
+    0x95, 0x36, 0x7d, 0x81, 0x4b, 0xba, 0xfa, 0x67, 0x68, 0x3c, 0x66, 0x3b, 0x62, 0x59, 0x30, 0xbb,
+    0x0b, 0x9b, 0x55, 0xd3, 0x57, 0xd7, 0x20, 0x6b, 0x4f, 0xd5, 0xa6, 0xad, 0xf3, 0x3b, 0x3d, 0x5a,
+    0x10, 0x8d, 0xb3, 0xcf, 0x32, 0x19, 0x09, 0x59, 0xe2, 0xd1, 0x91, 0x71, 0x51, 0x11, 0x91, 0x3c,
+    0x28, 0x08, 0xe8, 0xc7, 0xb7, 0xeb, 0x7b, 0x61, 0xb5, 0x32, 0x3d, 0x2c, 0xd6, 0xc2, 0xf5, 0xab,
+    0x3f, 0xc2, 0xe1, 0x3e, 0xfb, 0x65, 0x64, 0x45, 0x3f, 0x06, 0x7b, 0xf7, 0xa1, 0x6a, 0xcf, 0xd7,
+    0x72, 0xd5, 0x9d, 0xb1, 0x37, 0xf7, 0xe9, 0x17, 0x53, 0x9c, 0xeb, 0xcd, 0x77, 0x38, 0x3b, 0x1c,
+    0x82, 0x95, 0x7f, 0x82, 0x8f, 0xbf, 0x37, 0x85, 0xff, 0x26, 0xdb, 0x51, 0x5a, 0x94, 0x0e, 0xed,
+    0xdc, 0xb4, 0x0b, 0x7f, 0xcf, 0x34, 0xf3, 0x4c, 0x2f, 0x5a, 0xe5, 0x7f, 0x78, 0xed, 0x85, 0x59,
+    0x9a, 0x78, 0x1c, 0xce, 0xcf, 0x6a, 0xc9, 0xab, 0x23, 0xa3, 0x22, 0xe2, 0x61, 0xe0, 0x1f, 0xdf,
+    0x9e, 0x73, 0xed, 0x34, 0x64, 0xb8, 0x30, 0x27, 0xa7, 0x75, 0x0b, 0x03, 0x63, 0xd0, 0xb5, 0x95,
+    0x85, 0x65, 0x45, 0x53, 0xd1, 0x4e, 0xbf, 0x85, 0x94, 0xc9, 0x12, 0x24, 0xa2, 0xa0, 0x3b, 0x72,
+    0x68, 0x62, 0xea, 0xdd, 0xf9, 0x2d, 0xbe, 0x7c, 0xf1, 0xcf, 0x05, 0x87, 0xb7, 0x38, 0x5c, 0xe2,
+    0x1b, 0x72, 0x09, 0x03, 0xff, 0xf2, 0xbf, 0x3e, 0x7d, 0x6f, 0x6f, 0x0e, 0xe7, 0x71, 0xbf, 0x13,
+    0xc4, 0xdd, 0xf7, 0xde, 0x77, 0x74, 0x72, 0xfa, 0x7f, 0xdc, 0x5d, 0xe3, 0x7f, 0xf7, 0xda, 0x9e,
+    0xc5, 0xda, 0x8f, 0xad, 0x2d, 0x5c, 0xdf, 0xef, 0xb6, 0x3e, 0xd8, 0xcb, 0x56, 0xa1, 0xfa, 0x7b,
+    0x98, 0x8c, 0xfe, 0x17, 0x87, 0xb5, 0x16, 0x66, 0x38, 0xf0, 0x2d, 0x86, 0xab, 0xb0, 0xeb, 0xb9,
+    0x17, 0xc2, 0xc3, 0xc1, 0xbd, 0xf5, 0x6d, 0x2b, 0x2e, 0xe3, 0xde, 0xe2, 0x3a, 0xec, 0xd7, 0x16,
+    0xea, 0xc7, 0xf3, 0xf1, 0x2e, 0xbe, 0xcb, 0xf4, 0xb4, 0x2b, 0x56, 0x6b, 0x7d, 0x38, 0xf1, 0x9d,
+    0x57, 0xe9, 0xf7, 0xc3, 0xb5, 0xf9, 0xf8, 0xf7, 0x32, 0x3c, 0x7d, 0xdc, 0x36, 0xf6, 0x62, 0x31,
+    0x2f, 0x5d, 0xcb, 0xa5, 0xe5, 0x87, 0x73, 0x71, 0x3f, 0xaf, 0xd8, 0xea, 0xee, 0x49, 0x37, 0xf2,
+    0xe3, 0xa6, 0xf5, 0x0d, 0xe5, 0xf7, 0x0e, 0xf7, 0xf3, 0x58, 0x7d, 0xe7, 0x77, 0xbc, 0xae, 0x17,
+    0x47, 0xcb, 0xfe, 0x5a, 0x8e, 0xb7, 0xe9, 0x5a, 0x1b, 0x6f, 0xe7, 0x7a, 0xe5, 0xc0, 0x38, 0x9e,
+    0x6f, 0x67, 0x2b, 0x17, 0x3c, 0x06, 0xb6, 0xfe, 0x57, 0xbf, 0x37, 0xfe, 0x46, 0x67, 0x9f, 0x8b,
+    0xef, 0x79, 0x18, 0x6e, 0xfe, 0xff, 0x71, 0x1e, 0x96, 0x7b, 0x3b, 0xc7, 0xef, 0xee, 0xc6, 0x64,
+    0xfb, 0x77, 0xac, 0xe3, 0x6f, 0x60, 0x2f, 0x19, 0x0d, 0xf6, 0xde, 0xcd, 0x61, 0x33, 0xc6, 0x2c,
+    0x0d, 0x1c, 0xf6, 0xee, 0x7c, 0xe0, 0xb4, 0xef, 0xbd, 0x0d, 0xaf, 0xd5, 0x7d, 0xbb, 0xa5, 0xd7,
+    0x3c, 0x4d, 0xca, 0xf5, 0x2f, 0xaf, 0x2f, 0xbe, 0xf5, 0x76, 0x2f, 0x19, 0x8f, 0xfd, 0x3b, 0xbf,
+    0xdf, 0x79, 0xf1, 0xe0, 0xb2, 0xdd, 0x30, 0x04, 0x1b, 0x5b, 0x7f, 0xcb, 0xae, 0xb7, 0x16, 0x1c,
+    0x0e, 0x6b, 0xad, 0xbf, 0x83, 0xcb, 0xc4, 0xba, 0xd7, 0xac, 0x7a, 0xfd, 0xff, 0x3b, 0xfc, 0x6d,
+    0x8c, 0xde, 0xc1, 0xb7, 0x37, 0xbf, 0x29, 0xcc, 0xaf, 0x83, 0xc3, 0xdd, 0xbf, 0x6f, 0xb8, 0x4d,
+    0x6f, 0x2c, 0xa1, 0xd6, 0xcb, 0xc3, 0x77, 0x5e, 0x70, 0xdc, 0xbd, 0xe3, 0x6c, 0x35, 0x6e, 0x3c,
+    0xf1, 0xf7, 0x56, 0x31, 0x26, 0x09, 0x49, 0xe2, 0xac, 0x91, 0xec, 0x4d, 0x91, 0x0b, 0xc6, 0xbf,
+    0x76, 0x6d, 0x69, 0x7c, 0x78, 0x2e, 0xae, 0x7a, 0xec, 0xd7, 0xbb, 0x05, 0xe3, 0x3b, 0x15, 0xde,
+    0xbd, 0x73, 0x9c, 0x2f, 0x5c, 0xb6, 0x61, 0x7b, 0xe7, 0xfb, 0x54, 0x8e, 0x83, 0xc1, 0xde, 0x3e,
+    0xa9, 0x8f, 0x82, 0x3a, 0xf0, 0x3b, 0xae, 0xdf, 0xdd, 0x4d, 0x78, 0xfa, 0xad, 0x01, 0x6d, 0x7e,
+    0x7f, 0x9d, 0xde, 0x4e, 0xc1, 0x98, 0xcf, 0x1b, 0xb5, 0x41, 0xbf, 0xd9, 0x70, 0x3d, 0xbf, 0xc3,
+    0x65, 0xba, 0x8e, 0x6f, 0xc3, 0x79, 0x1b, 0x82, 0x0f, 0xda, 0xbd, 0x79, 0x1f, 0xd2, 0x80, 0xa3,
+    0xb1, 0x6d, 0xae, 0x1b, 0x95, 0x15, 0xf5, 0x85, 0xb9, 0x37, 0x1e, 0x9c, 0xee, 0x25, 0xfa, 0x7b,
+    0x48, 0x40, 0x1e, 0xfe, 0x86, 0xb7, 0x42, 0x51, 0x3b, 0x18, 0xdf, 0x8e, 0xbf, 0x3a, 0xf8, 0xce,
+    0xb5, 0x7b, 0xf8, 0xdb, 0x96, 0x94, 0xef, 0xfb, 0x18, 0x10, 0xfe, 0xf5, 0xee, 0x3f, 0xff, 0xbb,
+    0xce, 0xf5, 0xe9, 0xc3, 0xbd, 0x14, 0xba, 0x60, 0xef, 0xf6, 0xbe, 0xeb, 0xf9, 0xde, 0xe3, 0x3d,
+    0x9c, 0xe7, 0xfa, 0xe3, 0x2f, 0x2c, 0xbb, 0x28, 0x1d, 0xd7, 0xf5, 0xbb, 0x6d, 0xd7, 0x71, 0x2d,
+    0xde, 0x2e, 0xc6, 0xcd, 0x82, 0xae, 0x56, 0xee, 0xf8, 0xbb, 0x05, 0x7b, 0xed, 0xc7, 0xf9, 0xbc,
+    0xfb, 0x16, 0xcf, 0xbd, 0xdc, 0x3a, 0x1c, 0xec, 0xfd, 0xd6, 0xe1, 0xdf, 0xbf, 0x5d, 0xaf, 0x13,
+    0x8b, 0xb7, 0x75, 0x0f, 0xd6, 0xce, 0x26, 0x4c, 0x38, 0xab, 0xdb, 0x79, 0xab, 0x27, 0x5d, 0x9d,
+    0x6d, 0x00, 0xd6, 0x20, 0xcd, 0x7f, 0x7a, 0xb2, 0xf4, 0xc1, 0xde, 0x5b, 0xcf, 0x7a, 0x05, 0xfa,
+    0x9f, 0xbf, 0xd2, 0xca, 0xb2, 0xe2, 0xee, 0xba, 0xd5, 0x1a, 0xdc, 0xda, 0x59, 0xfd, 0x3f, 0x3f,
+    0xfd, 0x00, 0xbe, 0xca, 0xe5, 0xed, 0xe7, 0xf9, 0xb9, 0xfa, 0x58, 0x27, 0xba, 0x1a, 0x13, 0xd8,
+    0x24, 0xac, 0xb1, 0xad, 0xa9, 0x45, 0x48, 0x1b, 0x45, 0x4b, 0x3b, 0x43, 0x73, 0xa3, 0x1f, 0x9c,
+    0x51, 0x56, 0xd0, 0x7a, 0x50, 0x66, 0x36, 0xe6, 0x40, 0x8b, 0x81, 0x83, 0x0e, 0x61, 0x96, 0x5f,
+    0x60, 0x5e, 0x5d, 0x0c, 0x2c, 0x19, 0xaf, 0xbc, 0x2a, 0xb9, 0xba, 0x2c, 0xc5, 0xbf, 0xc5, 0xc5,
+    0x34, 0x41, 0x73, 0x8b, 0x74, 0xc1, 0x95, 0x02, 0xac, 0x05, 0x95, 0x21, 0xb0, 0x0a, 0xc2, 0x56,
+    0xa7, 0x08, 0xac, 0xaa, 0x10, 0x50, 0x55, 0x49, 0xd5, 0x49, 0x45, 0x4d, 0xa1, 0x42, 0x45, 0xcd,
+    0xdf, 0x03, 0x50, 0x4f, 0x07, 0x9e, 0x0c, 0xd0, 0x4b, 0x0a, 0x38, 0xd5, 0x96, 0x4d, 0x05, 0x98,
+    0x94, 0xaa, 0x4b, 0x43, 0x04, 0x92, 0x86, 0x90, 0x92, 0x06, 0x1c, 0x21, 0x0d, 0xb0, 0x5f, 0xc0,
+    0xa6, 0x90, 0x80, 0x00, 0x42, 0x00, 0x02, 0x58, 0xa9, 0x02, 0xc8, 0x0c, 0xaa, 0x02, 0xfd, 0x64,
+    0xfa, 0xfc, 0xbf, 0x8d, 0xad, 0xab, 0x76, 0x67, 0x5d, 0x5f, 0x4f, 0xe9, 0x5c, 0xff, 0xad, 0x74,
+    0xb5, 0x3a, 0x57, 0xe9, 0xd4, 0xea, 0xd7, 0x49, 0xad, 0x33, 0x87, 0x8e, 0x9c, 0x39, 0x71, 0xde,
+    0xc8, 0x81, 0x13, 0x07, 0x0e, 0x1b, 0xd3, 0x35, 0x64, 0xd8, 0xa8, 0x59, 0x93, 0x46, 0x0d, 0x9a,
+    0x33, 0x69, 0xcc, 0x9c, 0x29, 0x63, 0xa6, 0xcc, 0x18, 0x32, 0x62, 0xc6, 0x84, 0xf9, 0x22, 0x06,
+    0x4c, 0x18, 0x30, 0x5b, 0x46, 0xb5, 0x4c, 0xd9, 0xd2, 0x96, 0x45, 0x0b, 0x96, 0x2c, 0x57, 0xaa,
+    0x60, 0xa1, 0x52, 0xa5, 0x94, 0x4a, 0x29, 0xe9, 0x14, 0x29, 0x4f, 0x48, 0xbb, 0x52, 0xa0, 0x44,
+    0x11, 0xcc, 0x84, 0xa2, 0xa4, 0x6a, 0x40, 0x49, 0x92, 0x25, 0x48, 0x92, 0x1c, 0x41, 0x52, 0x76,
+    0xc4, 0x6c, 0x4c, 0x51, 0x34, 0x14, 0xb4, 0x73, 0xc8, 0x15, 0xb4, 0x6e, 0xe3, 0x09, 0xa7, 0xfb,
+    0x69, 0xa4, 0xb6, 0x14, 0x2b, 0xf2, 0x09, 0x4a, 0xa4, 0xc8, 0x8d, 0x4b, 0x22, 0x98, 0x43, 0x86,
+    0x08, 0x89, 0xf3, 0x9e, 0xa8, 0x9c, 0x9b, 0x3f, 0x32, 0x7d, 0xe8, 0xf8, 0x81, 0xed, 0xe1, 0x83,
+    0x47, 0x8f, 0x1d, 0x3c, 0xca, 0x3b, 0x72, 0xe8, 0xc0, 0x91, 0xa3, 0xab, 0x89, 0x03, 0xb3, 0xf2,
+    0x06, 0xe6, 0xe5, 0x8d, 0x30, 0x1b, 0x97, 0x35, 0x6c, 0x58, 0xd6, 0xb0, 0xa4, 0xf1, 0x62, 0x06,
+    0x0d, 0x9b, 0xf2, 0x6a, 0x9d, 0x51, 0x53, 0xce, 0xb5, 0x0c, 0x32, 0x8c, 0x18, 0x4a, 0x92, 0x30,
+    0x1a, 0x54, 0x3f, 0xac, 0xec, 0x42, 0xb0, 0x45, 0x8a, 0x32, 0x99, 0x45, 0x0b, 0xbb, 0x50, 0xc5,
+    0x8a, 0xb2, 0x0a, 0x14, 0x29, 0xec, 0x06, 0x34, 0x0a, 0x2a, 0x63, 0x93, 0x91, 0x90, 0x25, 0x1e,
+    0x1d, 0x19, 0x17, 0x15, 0x11, 0xc9, 0x83, 0x82, 0x58, 0x40, 0x3f, 0xbe, 0xbd, 0x49, 0xdf, 0xcb,
+    0x86, 0x97, 0xb4, 0xb2, 0xae, 0xaa, 0x43, 0xa7, 0xa6, 0xa3, 0xa2, 0xa1, 0x9d, 0xd8, 0xcd, 0xa6,
+    0xcc, 0xa5, 0xca, 0x17, 0x59, 0xac, 0xe4, 0xd2, 0xf5, 0xcd, 0x5b, 0xe9, 0xad, 0x32, 0x0e, 0x53,
+    0xd2, 0xaa, 0xdf, 0xc2, 0xa4, 0xe5, 0xea, 0xb3, 0x28, 0x08, 0xfd, 0x51, 0xa3, 0xde, 0xfe, 0x5c,
+    0x36, 0xee, 0xd5, 0x20, 0x7c, 0x19, 0xd9, 0xd8, 0x93, 0x89, 0x8d, 0x21, 0xfd, 0x2c, 0x76, 0x44,
+    0x83, 0xf1, 0x7c, 0x59, 0x66, 0x39, 0xc0, 0xaa, 0xac, 0x4c, 0xc0, 0x84, 0xa5, 0xaa, 0x36, 0x55,
+    0x95, 0x8e, 0x8c, 0x8a, 0x8c, 0x88, 0x8a, 0x88, 0x08, 0x54, 0x79, 0xaa, 0xd5, 0x9d, 0x6c, 0x75,
+    0x46, 0xfd, 0xf2, 0xc6, 0x0d, 0x6a, 0x1b, 0x37, 0x6d, 0xd0, 0x74, 0xbf, 0x78, 0xe9, 0xe9, 0xc2,
+    0xa5, 0x4b, 0x5f, 0xc9, 0x16, 0x5a, 0x79, 0xe2, 0x84, 0x66, 0x52, 0x29, 0xa4, 0xa6, 0x83, 0x00,
+    0xe1, 0x64, 0xaa, 0x4a, 0x05, 0xa2, 0x69, 0xd3, 0x2c, 0xe8, 0xc9, 0x5f, 0x22, 0x7f, 0x29, 0x10,
+    0x67, 0xea, 0x9c, 0x16, 0xb4, 0xa4, 0x94, 0x62, 0x3d, 0x15, 0x08, 0xf8, 0x07, 0xe8, 0xf7, 0xe7,
+    0xa7, 0xe7, 0x7b, 0xb9, 0x78, 0x4f, 0x2c, 0xf6, 0xdf, 0x7f, 0xfc, 0x6a, 0xbb, 0x83, 0x41, 0x8e,
+    0x42, 0x1c, 0x05, 0x6d, 0x9c, 0xd6, 0xae, 0xb4, 0x5f, 0x09, 0xee, 0x7d, 0x6c, 0xb3, 0x6c, 0x19,
+    0xd9, 0x58, 0x96, 0xec, 0x77, 0xe6, 0x30, 0xaf, 0x2e, 0xae, 0xae, 0xad, 0x2d, 0xa3, 0xa3, 0x22,
+    0xa3, 0x36, 0x44, 0x45, 0x44, 0x76, 0x80, 0xee, 0x0f, 0x90, 0xed, 0x53, 0x93, 0x7f, 0x7a, 0x78,
+    0x7c, 0xe8, 0x9e, 0x7f, 0xbb, 0x90, 0x27, 0xbb, 0x23, 0x24, 0x1b, 0x77, 0x68, 0xd7, 0x9f, 0xf5,
+    0x58, 0x05, 0x5f, 0x5f, 0xad, 0x5f, 0x74, 0x4f, 0x75, 0x9e, 0x29, 0x3f, 0xb5, 0x0e, 0xad, 0x34,
+    0x13, 0x98, 0x3f, 0x35, 0x89, 0xb2, 0x4e, 0xd2, 0xd3, 0x11, 0x6b, 0x63, 0xcf, 0x54, 0x4a, 0xbf,
+    0x48, 0xe7, 0x29, 0x36, 0xe9, 0xd5, 0x93, 0x89, 0x13, 0x87, 0x8d, 0x59, 0xbd, 0x71, 0xf9, 0x55,
+    0x83, 0xb6, 0x61, 0x49, 0x43, 0xe9, 0x87, 0xae, 0xb4, 0x64, 0xaa, 0x24, 0xa2, 0xa4, 0x91, 0x34,
+    0xc3, 0x4a, 0x39, 0x97, 0x8d, 0x58, 0x2c, 0xa1, 0xf8, 0x11, 0x0e, 0x16, 0x3f, 0x95, 0x30, 0xf5,
+    0xd0, 0x83, 0x83, 0x1f, 0x3f, 0x21, 0xf8, 0xbb, 0xa9, 0xbf, 0x04, 0x84, 0xe1, 0xe7, 0x3e, 0x55,
+    0xce, 0x8e, 0x53, 0xd2, 0x92, 0xe6, 0xed, 0x5f, 0xec, 0xc5, 0xc2, 0xac, 0x5c, 0xf4, 0x6b, 0xd9,
+    0x54, 0xd8, 0xa6, 0xa5, 0x02, 0xef, 0xc3, 0xd4, 0x44, 0xdb, 0x4c, 0x45, 0x4a, 0x4b, 0xb3, 0x52,
+    0x80, 0xa6, 0xec, 0x4e, 0x93, 0x9d, 0x7d, 0x7b, 0x08, 0x6b, 0xad, 0x05, 0x54, 0x9b, 0x84, 0x8e,
+    0x78, 0x4c, 0xe9, 0x39, 0x8b, 0x55, 0x4d, 0xad, 0x3a, 0x97, 0x01, 0x1d, 0x1d, 0x15, 0x15, 0x11,
+    0x05, 0x55, 0x7b, 0x76, 0xaa, 0x59, 0x2c, 0xfd, 0xa4, 0x49, 0xcd, 0x24, 0x49, 0x73, 0x00, 0xcf,
+    0x64, 0x1d, 0x18, 0xf8, 0xf7, 0xe7, 0x77, 0xd5, 0xf5, 0xbd, 0x3d, 0xf1, 0x2c, 0x27, 0x17, 0xf7,
+    0x71, 0x55, 0xb5, 0x36, 0x6a, 0xc7, 0x40, 0x96, 0xc9, 0x46, 0x1b, 0x4b, 0x32, 0x12, 0x60, 0xd3,
+    0xd6, 0xf9, 0xc7, 0xbc, 0xbc, 0xb8, 0xb8, 0xb6, 0xe6, 0xec, 0x63, 0xed, 0xd9, 0x2a, 0xa4, 0xda,
+    0x82, 0x26, 0xcf, 0xff, 0xf4, 0x1c, 0x72, 0x9e, 0xe2, 0xbc, 0x81, 0x43, 0x7e, 0xe3, 0x06, 0xb5,
+    0x8d, 0x1b, 0xa7, 0x53, 0xa5, 0x35, 0x06, 0xd2, 0xac, 0x01, 0x55, 0x93, 0x26, 0xb4, 0x8c, 0xa6,
+    0xc8, 0x98, 0x33, 0x66, 0xc6, 0x7c, 0xda, 0x5c, 0xa6, 0x87, 0x4c, 0x17, 0x2f, 0x5d, 0xc4, 0x74,
+    0xc5, 0x18, 0x08, 0x03, 0x06, 0xcc, 0x7f, 0xf1, 0xe2, 0x86, 0x0b, 0x17, 0x53, 0x29, 0x5b, 0x4c,
+    0xc9, 0x71, 0x5b, 0x94, 0x0a, 0xb5, 0x60, 0xc9, 0x52, 0xc6, 0x72, 0xc5, 0x4a, 0xb7, 0xb4, 0x8a,
+    0x23, 0xa3, 0x62, 0x16, 0xf1, 0x10, 0x1b, 0xf8, 0xc7, 0x97, 0xdd, 0x73, 0x2e, 0xd6, 0x4e, 0x43,
+    0x86, 0x0b, 0xd9, 0x39, 0xac, 0x9c, 0xd6, 0x2d, 0x1b, 0x86, 0x05, 0x63, 0xd0, 0xb5, 0x95, 0xcd,
+    0xc2, 0x62, 0x59, 0x51, 0x65, 0x9d, 0xb0, 0x5b, 0x48, 0x99, 0x2c, 0x41, 0x92, 0x15, 0x05, 0xc5,
+    0xee, 0xc8, 0xa1, 0x99, 0xc5, 0xbc, 0xc4, 0xc6, 0x78, 0x91, 0x4d, 0x34, 0xc4, 0x12, 0xf6, 0x85,
+    0xb3, 0x79, 0xdd, 0x9b, 0x0e, 0xfb, 0x26, 0xa6, 0x65, 0xf5, 0x34, 0x0f, 0xcd, 0x61, 0x33, 0xe6,
+    0xa5, 0x58, 0x55, 0x51, 0x4d, 0x61, 0xa5, 0xa2, 0xa0, 0x0e, 0x34, 0x3d, 0x19, 0xc8, 0x3a, 0x2d,
+    0x15, 0x40, 0x40, 0x0b, 0x0a, 0x46, 0x11, 0x82, 0x12, 0xe5, 0x89, 0xd4, 0x0c, 0x05, 0xfb, 0x3d,
+    0x46, 0x4f, 0x24, 0x9d, 0x30, 0x69, 0xf2, 0x39, 0x82, 0x49, 0xe3, 0xe8, 0xe2, 0x12, 0x50, 0x45,
+    0x25, 0x3d, 0x7a, 0x24, 0x69, 0x44, 0x92, 0xe4, 0x08, 0x12, 0xd1, 0x23, 0xa1, 0xa2, 0xa1, 0x90,
+    0xa0, 0x9f, 0x46, 0x3e, 0x1b, 0x8b, 0x10, 0xf1, 0x24, 0x22, 0x64, 0x48, 0x10, 0x21, 0x9d, 0x9c,
+    0x41, 0x3c, 0x74, 0x92, 0x00, 0xf2, 0x63, 0xb3, 0x50, 0xc5, 0x0f, 0x45, 0x1f, 0x3c, 0x7a, 0xf0,
+    0xd8, 0xd1, 0x23, 0x86, 0xe1, 0x0e, 0x19, 0x32, 0x72, 0xe8, 0xc0, 0x91, 0x23, 0x53, 0xf3, 0xc6,
+    0x67, 0xc6, 0x90, 0x11, 0x03, 0x86, 0x0c, 0x18, 0x92, 0x2f, 0x54, 0x94, 0x5d, 0x90, 0x59, 0xb4,
+    0xf0, 0x34, 0x5a, 0x21, 0x89, 0x22, 0xc5, 0x24, 0xe4, 0x88, 0xc8, 0x13, 0x24, 0x16, 0x4d, 0x08,
+    0x95, 0x68, 0x1c, 0xf1, 0xe8, 0xa8, 0xb8, 0xc8, 0x58, 0x24, 0x22, 0x71, 0xa8, 0x2d, 0xd1, 0xd0,
+    0x10, 0xf1, 0x10, 0x31, 0x04, 0x08, 0x43, 0x10, 0x85, 0x86, 0xdd, 0x42, 0x0f, 0x1f, 0x3a, 0x10,
+    0x12, 0x92, 0x05, 0x84, 0x1d, 0x91, 0xed, 0x41, 0xc2, 0x41, 0x0e, 0x84, 0x48, 0x1c, 0x02, 0x05,
+    0x03, 0x01, 0x05, 0xf3, 0x00, 0xeb, 0xef, 0x9f, 0xdf, 0xdf, 0xd8, 0x6f, 0x40, 0xdf, 0x98, 0x6f,
+    0xd7, 0xbf, 0x79, 0xde, 0x5e, 0x38, 0x07, 0xef, 0xb5, 0x89, 0xc1, 0x61, 0xbd, 0x0d, 0xfa, 0x06,
+    0xef, 0x77, 0x4b, 0xe0, 0xf6, 0x72, 0xb9, 0x5d, 0xbc, 0xda, 0x72, 0xee, 0x0e, 0xdf, 0x72, 0xb7,
+    0x76, 0xdc, 0xdb, 0x4e, 0xc3, 0x3d, 0x83, 0x48, 0x43, 0x5d, 0x5b, 0x86, 0x3a, 0x0c, 0x19, 0x86,
+    0x2e, 0xcc, 0xd1, 0xc1, 0x59, 0xf8, 0x94, 0xab, 0x10, 0x47, 0xc1, 0x53, 0xfb, 0x06, 0xa7, 0x42,
+    0x12, 0x92, 0x44, 0xa3, 0x62, 0x1e, 0xb6, 0x2d, 0xfb, 0x45, 0x00, 0x69, 0xc0, 0x91, 0x51, 0x11,
+    0x11, 0x76, 0x48, 0x80, 0x50, 0x36, 0x40, 0x12, 0xcd, 0x56, 0xc6, 0x56, 0x3f, 0x58, 0x8b, 0xb0,
+    0x86, 0x19, 0x41, 0x2d, 0xad, 0xec, 0x0c, 0xcd, 0xe7, 0xec, 0x07, 0x82, 0x59, 0x9a, 0x19, 0xd9,
+    0x83, 0x2f, 0x2c, 0x32, 0x30, 0x30, 0x38, 0x62, 0x63, 0x95, 0x61, 0x0e, 0x40, 0x81, 0x1a, 0x7c,
+    0x81, 0x7d, 0x31, 0x00, 0xeb, 0x61, 0x50, 0x63, 0x75, 0xd5, 0xe1, 0xea, 0xd2, 0xd4, 0xda, 0x22,
+    0x2f, 0xc8, 0xf2, 0xb0, 0xc0, 0x47, 0xc1, 0x15, 0xd6, 0xd5, 0x3f, 0x16, 0x6a, 0x82, 0xff, 0x32,
+    0x00, 0x6f, 0x80, 0x7e, 0x7c, 0xb2, 0x3d, 0x3c, 0x58, 0xae, 0x9d, 0x0f, 0xda, 0xea, 0xa2, 0x73,
+    0x05, 0x4b, 0xe9, 0x11, 0x16, 0x2b, 0x54, 0xae, 0x74, 0x9b, 0xaa, 0x58, 0xb1, 0x69, 0x88, 0x56,
+    0xa9, 0x43, 0xa9, 0x94, 0x8e, 0x8e, 0x92, 0x4e, 0x89, 0x32, 0x45, 0x0a, 0x69, 0x59, 0x0a, 0x94,
+    0x28, 0x50, 0x9c, 0x3c, 0x61, 0xf2, 0xa4, 0x89, 0x93, 0xee, 0x66, 0x13, 0x26, 0x4b, 0x46, 0x97,
+    0x28, 0x19, 0x55, 0x52, 0x23, 0x49, 0x22, 0x9a, 0xe4, 0x08, 0x92, 0xf2, 0x91, 0x50, 0x51, 0x23,
+    0xa0, 0x9f, 0x46, 0x3e, 0x89, 0x14, 0x19, 0x52, 0xc4, 0x93, 0x88, 0xa7, 0x90, 0x37, 0x43, 0x82,
+    0x08, 0x09, 0xc2, 0xd9, 0xb9, 0xd9, 0x09, 0x84, 0xb3, 0x0c, 0xe4, 0x87, 0x8f, 0xcd, 0x1e, 0x3e,
+    0x78, 0xf4, 0xe0, 0xa1, 0x63, 0x07, 0x8e, 0x1d, 0x39, 0x74, 0xe4, 0xd0, 0xfc, 0x82, 0x23, 0x53,
+    0x33, 0xf3, 0x06, 0xa6, 0x0d, 0xcc, 0xcb, 0x1b, 0xe5, 0xcb, 0x1a, 0x96, 0x36, 0x2a, 0x2d, 0x69,
+    0x54, 0xd2, 0xa0, 0x9c, 0x11, 0x63, 0x86, 0x0c, 0xca, 0x51, 0x19, 0xdd, 0x18, 0xff, 0x30, 0x5e,
+    0xb8, 0x98, 0x74, 0x51, 0x8e, 0x2c, 0xb7, 0x28, 0xd1, 0x82, 0xc5, 0x23, 0x8b, 0x15, 0x8e, 0x2b,
+    0x54, 0x30, 0xaa, 0x98, 0x8c, 0x84, 0x2c, 0xf1, 0xe8, 0xc8, 0xb8, 0xa8, 0x88, 0x98, 0x02, 0xc5,
+    0x24, 0x0a, 0xc9, 0x48, 0xc9, 0x13, 0x90, 0x27, 0x4c, 0x94, 0x30, 0x41, 0xe2, 0x91, 0xc4, 0x08,
+    0xc7, 0x11, 0x8d, 0x8c, 0x8d, 0x9c, 0x8b, 0x22, 0x14, 0x2b, 0x45, 0x24, 0x22, 0x26, 0x2a, 0x85,
+    0x10, 0x25, 0x87, 0xa8, 0x0f, 0x43, 0x07, 0x0f, 0x6d, 0xc3, 0x4d, 0x40, 0x43, 0x10, 0xa7, 0x7e,
+    0x20, 0x0a, 0x4d, 0xf9, 0x0a, 0x3f, 0x7c, 0x20, 0x0f, 0x0a, 0x02, 0xfa, 0xf1, 0xed, 0xfa, 0x1e,
+    0x02, 0x0f, 0xf4, 0xff, 0xbc, 0x57, 0x07, 0xb2, 0x68, 0x07, 0xc2, 0xc1, 0x50, 0x42, 0x9b, 0x83,
+    0x60, 0x27, 0x87, 0x3a, 0x10, 0x70, 0x33, 0xf0, 0xcf, 0xef, 0xf4, 0xaf, 0x8f, 0xcf, 0xb4, 0x6f,
+    0xbc, 0x8f, 0x8e, 0x99, 0xaa, 0x7a, 0xbe, 0xf7, 0x22, 0x17, 0x87, 0x25, 0xc5, 0x60, 0xb0, 0x1e,
+    0x78, 0xc3, 0xb7, 0x32, 0x6f, 0x43, 0xde, 0xff, 0x94, 0xf7, 0x14, 0xcf, 0xdb, 0xc5, 0xa3, 0xea,
+    0xde, 0x99, 0xe2, 0x77, 0x5c, 0x7c, 0xcb, 0xb5, 0x1b, 0xbd, 0xed, 0x34, 0xdc, 0x9e, 0x1a, 0xea,
+    0xaa, 0x53, 0x18, 0x32, 0x64, 0x98, 0xbb, 0x80, 0x81, 0xee, 0x82, 0x29, 0x9d, 0x05, 0xb9, 0xb7,
+    0x0a, 0x9f, 0x1e, 0x28, 0xc8, 0xc5, 0x69, 0x29, 0x78, 0xc2, 0x69, 0x4d, 0xe1, 0xfe, 0xd0, 0xed,
+    0xad, 0xcd, 0xed, 0xb4, 0x2d, 0x3b, 0xc1, 0x54, 0x42, 0x5e, 0xb8, 0xfc, 0x17, 0x26, 0xa5, 0xa6,
+    0x26, 0x37, 0x37, 0x43, 0x43, 0xc8, 0xa7, 0x42, 0x11, 0x49, 0x75, 0xc2, 0x04, 0xa4, 0x89, 0x12,
+    0x90, 0x24, 0x4a, 0x38, 0x32, 0x2a, 0x22, 0x1e, 0x92, 0x78, 0x74, 0x1c, 0xf1, 0x58, 0x1e, 0xd1,
+    0xc8, 0xd8, 0xb8, 0xa8, 0x28, 0x62, 0x51, 0x44, 0x22, 0x22, 0x5d, 0x62, 0x88, 0xc3, 0xbc, 0x10,
+    0x20, 0x0c, 0x41, 0x14, 0x1a, 0x7e, 0x28, 0xf4, 0xf0, 0xc1, 0x83, 0xdd, 0xa1, 0x43, 0x99, 0xdc,
+    0x81, 0xfc, 0xdf, 0x61, 0x90, 0x30, 0xf0, 0x8f, 0x6f, 0xcf, 0x07, 0x39, 0x04, 0x0a, 0x72, 0x88,
+    0x12, 0x04, 0xfc, 0x03, 0xf4, 0xe3, 0xeb, 0xf3, 0xeb, 0x1b, 0xef, 0x74, 0x63, 0x3d, 0xcf, 0xd3,
+    0xf7, 0xf6, 0x5e, 0xbc, 0x27, 0x0e, 0xef, 0x81, 0xc3, 0x5d, 0xb0, 0x1e, 0x08, 0x30, 0x6d, 0x6d,
+    0x1b, 0xbe, 0xe5, 0xaf, 0xdc, 0x06, 0x6f, 0x5e, 0x39, 0x4f, 0xeb, 0xed, 0xe2, 0x95, 0xf1, 0xdc,
+    0xba, 0x5c, 0x3b, 0x0d, 0x19, 0x2e, 0xcc, 0xc9, 0x69, 0xdd, 0xee, 0x70, 0x2e, 0xbe, 0xb5, 0xdb,
+    0xde, 0x1a, 0xee, 0xba, 0x0c, 0x75, 0x18, 0x2e, 0x60, 0xa0, 0x9b, 0xa3, 0xb3, 0x20, 0x57, 0xc1,
+    0x42, 0x54, 0x05, 0x0a, 0xda, 0x38, 0x0a, 0x50, 0x71, 0x70, 0x6e, 0x6f, 0x70, 0x07, 0xde, 0x26,
+    0xb4, 0x4d, 0x90, 0xd0, 0x86, 0xca, 0x76, 0x26, 0x41, 0x4d, 0x6d, 0x8d, 0x8d, 0x33, 0xc2, 0x1a,
+    0x61, 0x84, 0x34, 0xb5, 0x34, 0x34, 0xb5, 0x33, 0xb4, 0xb3, 0xa9, 0x07, 0x10, 0x20, 0x3c, 0x28,
+    0x33, 0x33, 0x2b, 0x1b, 0x23, 0x23, 0xa3, 0x1a, 0x0b, 0x03, 0x63, 0xd0, 0xb5, 0x95, 0x85, 0x65,
+    0x95, 0x24, 0x46, 0xbf, 0xcf, 0x7b, 0x39, 0x08, 0x73, 0x72, 0x50, 0x37, 0x00, 0x23, 0x6d, 0xf0,
+    0xc5, 0x20, 0xfc, 0xe5, 0xd5, 0xb5, 0xc5, 0x8b, 0x6b, 0x4b, 0x8b, 0x4b, 0x2b, 0xcb, 0x50, 0x6b,
+    0x01, 0x96, 0x82, 0x05, 0x51, 0x0a, 0xae, 0xac, 0x12, 0x5c, 0x41, 0x25, 0x40, 0x40, 0x55, 0x85,
+    0xe0, 0x40, 0x95, 0xd4, 0x94, 0xd4, 0xff, 0x14, 0x1d, 0x05, 0xf5, 0xef, 0xf4, 0x74, 0xe0, 0xe9,
+    0x3c, 0xbd, 0x19, 0x28, 0x00, 0x26, 0x29, 0x89, 0xa9, 0xa9, 0x69, 0x49, 0x89, 0xa9, 0x4f, 0xc9,
+    0x8a, 0x00, 0x52, 0x12, 0xd2, 0x80, 0xa4, 0x01, 0x67, 0x8a, 0x8a, 0x8c, 0x8e, 0xca, 0x47, 0x46,
+    0x44, 0x45, 0x44, 0x43, 0x45, 0x43, 0x42, 0x02, 0xca, 0x02, 0x84, 0x00, 0x04, 0x28, 0x07, 0x00,
+    0x00, 0x14, 0x54, 0x0e, 0x02, 0xfa, 0x39, 0xc3, 0xd3, 0xe3, 0x23, 0xe5, 0x23, 0xd6, 0xb3, 0xc3,
+    0xb3, 0xc3, 0x93, 0xad, 0xb1, 0x76, 0x94, 0x4d, 0x8a, 0xbd, 0xd6, 0x50, 0x75, 0xf8, 0x5a, 0xb5,
+    0x76, 0x0f, 0x58, 0xb5, 0xaa, 0x6c, 0xd8, 0xa4, 0xa6, 0x3e, 0xfd, 0x3f, 0x4b, 0x7d, 0x9d, 0xd4,
+    0x3a, 0x74, 0x52, 0xa7, 0xe8, 0xc8, 0x99, 0x13, 0x35, 0x27, 0x8e, 0x9c, 0xa8, 0x38, 0x6f, 0xe0,
+    0xc0, 0x41, 0x7d, 0x83, 0xda, 0xc6, 0x4d, 0xd9, 0xcd, 0x69, 0x9b, 0xee, 0x81, 0xd3, 0x35, 0x6c,
+    0xd6, 0xa8, 0x61, 0x93, 0x46, 0x8d, 0x25, 0x9a, 0x34, 0xa0, 0x68, 0xcc, 0xfc, 0x98, 0x29, 0x73,
+    0x86, 0x4c, 0x99, 0x44, 0x32, 0x62, 0xc6, 0x88, 0xe9, 0x0b, 0xf3, 0x85, 0x2e, 0xf0, 0xc5, 0x0b,
+    0x18, 0xd4, 0x2e, 0x5e, 0xb6, 0x74, 0xe1, 0xb2, 0x05, 0x85, 0x29, 0x17, 0x2d, 0x53, 0x2c, 0x58,
+    0xb4, 0xbc, 0x58, 0x16, 0x2d, 0x9f, 0xa4, 0x59, 0xae, 0x60, 0xb9, 0x62, 0x05, 0x4b, 0x15, 0x2b,
+    0x55, 0xa8, 0x90, 0x96, 0x4e, 0xa1, 0x32, 0x65, 0x73, 0x33, 0x0a, 0x94, 0x28, 0x50, 0x9e, 0x44,
+    0x71, 0xf2, 0x84, 0xc9, 0x12, 0x24, 0xa2, 0xa0, 0x4e, 0x9a, 0x30, 0x21, 0x6c, 0x32, 0xba, 0x24,
+    0x3c, 0xaa, 0x04, 0x49, 0x12, 0x25, 0x50, 0x49, 0x8e, 0x88, 0xd2, 0x1d, 0x09, 0x05, 0xcd, 0x0b,
+    0x35, 0x42, 0xf8, 0x69, 0xa4, 0x1c, 0xf5, 0x49, 0xc4, 0x93, 0x88, 0xe7, 0x10, 0x22, 0x42, 0x82,
+    0x0c, 0x91, 0x91, 0x28, 0xe4, 0xbf, 0x33, 0x08, 0x67, 0x27, 0x21, 0x90, 0x1f, 0x3f, 0x7c, 0x6c,
+    0xf6, 0xf0, 0xb1, 0x43, 0x13, 0x33, 0xa8, 0x47, 0xed, 0xc5, 0x63, 0x07, 0x21, 0x0f, 0x1d, 0x39,
+    0xc2, 0x3a, 0x70, 0x68, 0xbe, 0xc0, 0x61, 0x67, 0x62, 0xd2, 0x65, 0xde, 0xb8, 0xcc, 0xbb, 0x61,
+    0xe3, 0x45, 0x0c, 0x1b, 0x94, 0x35, 0x2c, 0x6b, 0x74, 0x2d, 0x2b, 0x29, 0x69, 0xc4, 0x98, 0x41,
+    0xa3, 0x0c, 0x35, 0x43, 0x46, 0xa5, 0x0c, 0x18, 0x94, 0x89, 0x30, 0x18, 0x19, 0x59, 0xb0, 0x70,
+    0xd1, 0xa2, 0xec, 0x82, 0xb0, 0xbc, 0x82, 0xc5, 0x0a, 0x15, 0x2c, 0x52, 0xa8, 0x40, 0x31, 0x99,
+    0x62, 0x32, 0x32, 0x52, 0xf2, 0x44, 0xe4, 0x09, 0xc8, 0x48, 0x13, 0x90, 0xe5, 0x12, 0x26, 0x4a,
+    0x3c, 0x36, 0x8d, 0x78, 0x1c, 0xe1, 0xf8, 0xf8, 0x8e, 0x54, 0x8d, 0x8b, 0x8b, 0x22, 0x18, 0x0d,
+    0x45, 0x28, 0x26, 0x22, 0x1a, 0x86, 0x40, 0xac, 0xc4, 0x0f, 0x43, 0x1c, 0x16, 0xd2, 0x7a, 0x85,
+    0x1f, 0x40, 0xa0, 0x7a, 0xf8, 0x30, 0xc3, 0x43, 0x07, 0x42, 0x72, 0x87, 0x28, 0x72, 0x76, 0xb0,
+    0x8f, 0xc3, 0xa0, 0x60, 0x20, 0x07, 0x41, 0xbe, 0xf0, 0x98, 0x6f, 0xd7, 0xc7, 0x3b, 0x38, 0x4f,
+    0x0f, 0xfc, 0xdd, 0xa0, 0xb7, 0xc1, 0x5b, 0x75, 0x7b, 0xf1, 0xba, 0x55, 0x78, 0xf5, 0xdd, 0x8d,
+    0x73, 0xef, 0x2a, 0xb7, 0x76, 0x5c, 0x1b, 0xf4, 0xcd, 0x4e, 0x03, 0x5d, 0x58, 0x9d, 0x86, 0x0c,
+    0x75, 0x18, 0x2e, 0x64, 0xb8, 0x30, 0xf7, 0x66, 0x61, 0x2e, 0xae, 0x82, 0x9c, 0x05, 0xac, 0x58,
+    0x85, 0xb6, 0xb6, 0x7f, 0xb7, 0x9f, 0xa0, 0x25, 0x81, 0x4d, 0x6c, 0x0d, 0x8d, 0x8d, 0x33, 0xc2,
+    0x9a, 0x5a, 0x84, 0x27, 0xb5, 0x31, 0x69, 0x67, 0x10, 0xd0, 0x9e, 0xce, 0x20, 0xd4, 0x0f, 0x1c,
+    0x84, 0x35, 0x70, 0x30, 0xd4, 0x00, 0x4c, 0xeb, 0x0b, 0x8c, 0x41, 0xed, 0xf5, 0x65, 0xc5, 0x20,
+    0xcb, 0x6a, 0xc1, 0x55, 0x16, 0x59, 0xc1, 0x02, 0x1c, 0x0a, 0x0a, 0x87, 0xb0, 0xfe, 0xaf, 0xa4,
+    0x24, 0x50, 0x42, 0x40, 0x85, 0xa0, 0x6a, 0xa6, 0x9a, 0x7a, 0x92, 0x9a, 0x9f, 0xa2, 0xa0, 0x0e,
+    0x2c, 0x31, 0x2d, 0xfd, 0xbf, 0x81, 0x39, 0x4e, 0x73, 0x81, 0x6f, 0x62, 0x72, 0x33, 0x2b, 0xfd,
+    0x0f, 0x25, 0x11, 0x40, 0x4a, 0x1a, 0x70, 0x84, 0x34, 0x60, 0x8e, 0x00, 0xa1, 0x20, 0x20, 0x00,
+    0x6c, 0x82, 0xe4, 0xb0, 0x89, 0x13, 0x8d, 0x6d, 0xa8, 0x34, 0x84, 0x3b, 0xac, 0x99, 0x01, 0x02,
+    0x00, 0x02, 0x68, 0x00, 0xa3, 0x99, 0x19, 0x88, 0x67, 0x71, 0x58, 0x42, 0x2b, 0x00, 0xe4, 0x0c,
+    0xa1, 0x61, 0x21, 0x0e, 0x33, 0x30, 0x78, 0x01, 0x10, 0x38, 0x10, 0x46, 0xd1, 0x02, 0xc7, 0x01,
+    0x1a, 0x07, 0xd1, 0xd5, 0x0c, 0xf7, 0x18, 0x4d, 0xf7, 0xb5, 0xa9, 0x78, 0x63, 0xc2, 0x0c, 0x19,
+    0x57, 0x77, 0xaa, 0x9d, 0x36, 0x3f, 0xc3, 0x61, 0xae, 0x82, 0xe8, 0x53, 0xb0, 0x93, 0x42, 0x53,
+    0x14, 0x42, 0x73, 0x9e, 0x43, 0xcc, 0xe2, 0x48, 0xc3, 0xda, 0x20, 0x76, 0xc7, 0x53, 0xe1, 0x87,
+    0x5c, 0x6b, 0x4f, 0xc9, 0xcf, 0xfb, 0x35, 0x2c, 0xf4, 0x0f, 0x0b, 0x4b, 0xb9, 0x42, 0xf6, 0x30,
+    0x71, 0x6b, 0x7c, 0x4f, 0x72, 0x15, 0xcd, 0x90, 0x37, 0x4e, 0x8d, 0xa9, 0x95, 0x7d, 0xf5, 0xbb,
+    0x47, 0xcf, 0xc3, 0xc0, 0x04, 0x03, 0x91, 0x87, 0xd7, 0xf0, 0x96, 0xb7, 0x3e, 0xec, 0x8b, 0x2b,
+    0x8f, 0xca, 0x8c, 0xef, 0xb0, 0x67, 0x22, 0x3a, 0x29, 0x61, 0xbc, 0x6a, 0x9f, 0xbf, 0x27, 0x3c,
+    0x67, 0x0c, 0x97, 0xfe, 0xba, 0x4d, 0x1c, 0x94, 0xa1, 0x56, 0xf0, 0xdb, 0xb1, 0x2c, 0xc5, 0x65,
+    0x5f, 0x13, 0x72, 0x8c, 0x70, 0xaa, 0xda, 0xc6, 0xfd, 0x5a, 0x38, 0xaf, 0x55, 0xa0, 0x70, 0xfe,
+    0x6c, 0xba, 0xb1, 0x75, 0xa8, 0xbe, 0xfe, 0x2a, 0x96, 0x85, 0x52, 0x39, 0xab, 0x6e, 0xf1, 0x71,
+    0xff, 0xd9, 0x68, 0xe1, 0xe3, 0x07, 0x55, 0x97, 0xe4, 0xb7, 0x25, 0x10, 0x4a, 0xe4, 0x1f, 0x6a,
+    0x8a, 0xd8, 0x7c, 0x30, 0x1f, 0x4c, 0x2f, 0xd1, 0xa0, 0x70, 0x17, 0x26, 0x5b, 0x4b, 0xbe, 0x85,
+    0xb6, 0x65, 0xe2, 0x3e, 0x9c, 0xbd, 0xbb, 0xb1, 0x78, 0x0b, 0xbc, 0xa7, 0x37, 0x8e, 0xd3, 0xb1,
+    0x52, 0x3a, 0x2a, 0x07, 0x5b, 0xc6, 0xdc, 0xe3, 0x70, 0x73, 0xee, 0xff, 0x07, 0xa1, 0xbf, 0x36,
+    0x7f, 0x65, 0x3d, 0x2e, 0x98, 0x92, 0x6c, 0xc5, 0x6c, 0x78, 0xd2, 0x9f, 0x7d, 0xcc, 0x70, 0x9d,
+    0xcc, 0x17, 0x50, 0x9d, 0x74, 0xd5, 0x47, 0x77, 0xa8, 0xb9, 0x1e, 0x7b, 0x9e, 0x78, 0x52, 0x1b,
+    0x7f, 0x1a, 0x97, 0x21, 0xbc, 0xa4, 0xdc, 0xdd, 0x34, 0xa5, 0x9e, 0x5e, 0xb1, 0x83, 0x93, 0x87,
+    0xa8, 0x32, 0xf1, 0x90, 0x74, 0xb9, 0xa4, 0xa3, 0x8c, 0xfc, 0xa6, 0x66, 0x11, 0x1c, 0x86, 0xa1,
+    0x90, 0xc3, 0x9a, 0x82, 0xf2, 0x4f, 0xc1, 0xcd, 0x97, 0x15, 0xac, 0xf8, 0x7b, 0xd7, 0x03, 0x9a,
+    0x42, 0xa5, 0x89, 0xda, 0x90, 0xbd, 0x38, 0xf8, 0x2f, 0xa7, 0xca, 0x97, 0xb2, 0x0d, 0xfc, 0xd2,
+    0x86, 0x67, 0xad, 0x95, 0x8f, 0xb8, 0xd2, 0x9c, 0x26, 0x9e, 0xcf, 0x86, 0x9a, 0x20, 0xe4, 0x16,
+    0x9e, 0xdc, 0xe1, 0x71, 0x91, 0x60, 0x3f, 0xbd, 0xca, 0x4d, 0x4f, 0xc0, 0xe1, 0xc3, 0x3d, 0xb7,
+    0xf7, 0xcc, 0x70, 0xe7, 0x22, 0x0f, 0xab, 0x81, 0x26, 0xdf, 0x7a, 0x73, 0x4d, 0x29, 0x0a, 0x87,
+    0x21, 0xce, 0x67, 0xd3, 0x5d, 0xae, 0x03, 0xd9, 0x1b, 0xa3, 0x9f, 0x7b, 0x04, 0xbd, 0x9b, 0x28,
+    0xd6, 0x7d, 0x4d, 0xee, 0xb2, 0xbb, 0x6b, 0xd1, 0xe1, 0xe0, 0xd3, 0x2a, 0xfe, 0x44, 0xb9, 0x27,
+    0xca, 0xb2, 0x6c, 0x4b, 0xd5, 0x48, 0xd2, 0xdf, 0xb4, 0xdd, 0x1d, 0x15, 0xdc, 0xe2, 0x63, 0xf6,
+    0x1e, 0xf8, 0x08, 0x8d, 0xdf, 0x0e, 0xe4, 0x20, 0x8f, 0xee, 0xd1, 0xe2, 0xa2, 0xe3, 0xd2, 0xf1,
+    0xc5, 0x29, 0x2b, 0xd5, 0x6d, 0x33, 0xd7, 0xe5, 0xf1, 0xe9, 0x70, 0x04, 0x48, 0x5f, 0x4e, 0x88,
+    0xf2, 0x78, 0xb5, 0x01, 0x32, 0x42, 0xf1, 0x3c, 0xae, 0x9b, 0x8e, 0x8f, 0x74, 0x5e, 0x5e, 0xf6,
+    0xfa, 0xda, 0x77, 0xc8, 0x87, 0x10, 0xac, 0x05, 0x04, 0xd4, 0xe0, 0xd7, 0x4f, 0x67, 0xfe, 0xd8,
+    0x67, 0xba, 0x98, 0x3a, 0x48, 0x11, 0xf2, 0xba, 0x19, 0xb6, 0xbe, 0x0d, 0x49, 0x1f, 0x78, 0x7c,
+    0x6e, 0xcc, 0xa1, 0xa7, 0xdb, 0x03, 0xe3, 0x37, 0xa3, 0x31, 0xc9, 0xf7, 0xc5, 0x9b, 0x3a, 0xff,
+    0x36, 0x1c, 0xac, 0x61, 0x65, 0x1b, 0x80, 0x72, 0xcb, 0x9d, 0x47, 0x56, 0xa9, 0x41, 0x2f, 0x9e,
+    0x55, 0xc2, 0xe0, 0xfe, 0x44, 0x9f, 0x80, 0x35, 0xce, 0x6b, 0x9f, 0x5c, 0xa6, 0x42, 0xc7, 0x18,
+    0xfa, 0xbc, 0xb7, 0xef, 0x02, 0xb1, 0xfc, 0xbd, 0xd1, 0x2a, 0xdf, 0x9f, 0x36, 0xbf, 0x9f, 0x78,
+    0xee, 0xbb, 0x2c, 0x66, 0x88, 0x7c, 0xf8, 0x46, 0x46, 0x12, 0x81, 0xb7, 0xc4, 0x3a, 0x28, 0x7e,
+    0x99, 0xac, 0x1b, 0xfd, 0x0d, 0xd8, 0xd6, 0x0f, 0xc5, 0x7f, 0x99, 0x78, 0x4c, 0xfb, 0x08, 0x6f,
+    0xc6, 0xb5, 0xc1, 0x6c, 0x56, 0xcc, 0x3c, 0x0f, 0xe2, 0x71, 0x4e, 0xfe, 0x67, 0xec, 0xa3, 0x04,
+    0xf0, 0x05, 0x98, 0x06, 0xee, 0xc8, 0x21, 0xae, 0x96, 0x5f, 0x26, 0xdd, 0xf6, 0xde, 0xc3, 0xa8,
+    0xcb, 0x63, 0x74, 0xaa, 0x03, 0x15, 0x51, 0xa9, 0x4d, 0x6d, 0x45, 0xbf, 0x9f, 0x5e, 0x97, 0xb8,
+    0x18, 0x99, 0x49, 0x7e, 0xcf, 0xa7, 0x4b, 0xbe, 0x11, 0x73, 0x21, 0xf7, 0x92, 0x27, 0x94, 0xaf,
+    0x46, 0xfc, 0x4a, 0x7f, 0x1e, 0xbd, 0xc5, 0x49, 0x47, 0x86, 0xa8, 0x57, 0xa6, 0x19, 0xd7, 0xae,
+    0x49, 0xbd, 0x83, 0xcd, 0x95, 0xd8, 0xc2, 0xa4, 0x0e, 0xd0, 0x5c, 0x77, 0xfd, 0x40, 0xdb, 0x80,
+    0x77, 0x55, 0xae, 0x1d, 0x68, 0xf0, 0x7a, 0xed, 0x7d, 0xf7, 0xf7, 0xde, 0x78, 0x70, 0x9a, 0xc8,
+    0x4d, 0x92, 0xee, 0x83, 0xb6, 0xa0, 0xa2, 0x0e, 0x8e, 0x2d, 0x30, 0xf8, 0x6f, 0xc5, 0xfc, 0x3b,
+    0x54, 0x5b, 0xdf, 0x74, 0xfe, 0x5b, 0x44, 0xec, 0x1d, 0x1f, 0xbe, 0x86, 0xbc, 0xe5, 0x0b, 0x5e,
+    0x1a, 0xa7, 0x12, 0x05, 0xf3, 0x84, 0x35, 0x22, 0xbe, 0xda, 0xcf, 0x7f, 0x67, 0x35, 0x3a, 0x5a,
+    0x7f, 0xb9, 0x7a, 0xcf, 0xde, 0xe2, 0x44, 0xec, 0xdf, 0xaf, 0xeb, 0x18, 0xfe, 0xc4, 0xe2, 0x2e,
+    0x73, 0xc6, 0x13, 0x10, 0xbd, 0x18, 0x75, 0x98, 0xb1, 0xb5, 0x91, 0xad, 0x73, 0xdc, 0xb3, 0x28,
+    0xfb, 0xc0, 0x38, 0x1c, 0xdb, 0x0d, 0xdc, 0x3d, 0xe3, 0xf7, 0x7c, 0x34, 0x34, 0xc8, 0xf6, 0xb4,
+    0xb8, 0xd0, 0x59, 0xb8, 0x0d, 0xa7, 0xa6, 0xcd, 0xf8, 0x99, 0xe8, 0xd4, 0xa5, 0xde, 0x3a, 0x2d,
+    0x7f, 0x7e, 0x4f, 0xe2, 0xef, 0x68, 0xe7, 0x22, 0x94, 0xe7, 0xd8, 0xf8, 0x5c, 0x70, 0xb9, 0x07,
+    0x27, 0xcd, 0x8a, 0xc0, 0xff, 0x83, 0xcf, 0xff, 0xc6, 0x87, 0xa5, 0xe5, 0xf3, 0x85, 0x5a, 0xf0,
+    0xf7, 0xfa, 0x15, 0xb8, 0xbf, 0xf4, 0x21, 0x0e, 0xc3, 0xf2, 0x0b, 0x7a, 0x2c, 0x57, 0xaa, 0xbe,
+    0xaa, 0x16, 0xa6, 0xa1, 0x94, 0x92, 0xb9, 0xa5, 0xb3, 0xb6, 0xee, 0x80, 0x06, 0xb6, 0x22, 0xb8,
+    0x1d, 0x56, 0xb9, 0xd5, 0x62, 0x0b, 0x8b, 0xc6, 0xbc, 0xe2, 0x36, 0xac, 0xce, 0xae, 0x2b, 0x7e,
+    0x18, 0x40, 0x17, 0x5f, 0x0b, 0x9d, 0xd4, 0x63, 0x4f, 0x82, 0x1e, 0xcc, 0x3c, 0xa5, 0x14, 0x7e,
+    0x96, 0xd4, 0xa0, 0x7a, 0x88, 0x80, 0x6b, 0x74, 0xfd, 0x12, 0x49, 0x8b, 0x0f, 0xb3, 0x5c, 0xfe,
+    0x8d, 0xf0, 0x7c, 0xc2, 0xa5, 0xb5, 0x30, 0xbb, 0xc0, 0x93, 0x6f, 0x58, 0x2c, 0xbe, 0xe5, 0xf0,
+    0x6e, 0x9b, 0x58, 0xa6, 0xaf, 0xd2, 0xb4, 0x7c, 0xd4, 0x29, 0xc5, 0xd3, 0x70, 0xba, 0xc3, 0x7e,
+    0xc9, 0x31, 0x8e, 0x55, 0x89, 0xab, 0xb1, 0x0c, 0x3e, 0x1b, 0xaa, 0xe7, 0x19, 0x25, 0xd1, 0x5d,
+    0x08, 0x82, 0x07, 0x73, 0x82, 0xce, 0x8c, 0xd3, 0x5a, 0x37, 0xe5, 0x56, 0x77, 0xf5, 0x38, 0xae,
+    0x0c, 0x92, 0x6c, 0x61, 0xd9, 0x63, 0x5c, 0xec, 0x58, 0x94, 0x93, 0x9b, 0x6e, 0x53, 0xfa, 0xe8,
+    0x9a, 0xf5, 0xcd, 0xbb, 0xf7, 0x8a, 0x66, 0x67, 0xf9, 0x0a, 0xa7, 0xc5, 0x3e, 0x49, 0xc2, 0xa7,
+    0xa6, 0x24, 0x9c, 0xeb, 0x78, 0xdb, 0x4a, 0xd7, 0x61, 0x30, 0x49, 0xfe, 0x87, 0xb0, 0x8f, 0x62,
+    0xdf, 0x77, 0xb4, 0xf6, 0xbd, 0x1e, 0x05, 0x91, 0x50, 0x59, 0x2c, 0xc7, 0x4a, 0x6c, 0xc2, 0x2d,
+    0x62, 0xda, 0x00, 0x66, 0x8d, 0x33, 0xdf, 0xea, 0xef, 0xcb, 0xdb, 0x78, 0x20, 0x2c, 0x1f, 0xed,
+    0x77, 0xf3, 0xa3, 0xf2, 0x9b, 0x1f, 0xb8, 0x2f, 0xde, 0x1b, 0xb9, 0x2b, 0xfa, 0xc5, 0x79, 0xa8,
+    0x1f, 0xf5, 0x2e, 0xd5, 0x7c, 0x85, 0x37, 0xdf, 0xdb, 0x0b, 0xff, 0x27, 0xc1, 0x39, 0x92, 0xfe,
+    0xaf, 0x00, 0xf3, 0x81, 0x0e, 0xee, 0xfe, 0xb9, 0x78, 0xb8, 0x3b, 0xe2, 0x68, 0xb7, 0x5e, 0x04,
+    0x57, 0x3b, 0x9e, 0x13, 0xb7, 0x18, 0x96, 0xcc, 0x86, 0xa7, 0x66, 0x5b, 0xab, 0xa4, 0x45, 0xc6,
+    0x4a, 0xcb, 0xeb, 0x76, 0x93, 0xfa, 0x51, 0x1e, 0xb7, 0x64, 0xd2, 0xac, 0xf5, 0x77, 0x10, 0xff,
+    0xfb, 0x5f, 0xc2, 0x5d, 0xf7, 0xc1, 0x71, 0x9c, 0xc5, 0x00, 0xdf, 0x58, 0xc1, 0x35, 0x6f, 0x18,
+    0x18, 0x75, 0x36, 0x6f, 0xd2, 0xc4, 0x29, 0x16, 0x16, 0x7d, 0x7b, 0x7a, 0xf2, 0xd2, 0x49, 0xee,
+    0x30, 0xc9, 0xb0, 0x87, 0x75, 0x27, 0xce, 0x27, 0x63, 0xe4, 0x6c, 0x34, 0x3d, 0x11, 0x38, 0xd7,
+    0x41, 0xe4, 0x7f, 0x6a, 0x54, 0xe5, 0x3d, 0x7f, 0x24, 0x13, 0x34, 0xc0, 0xe6, 0x76, 0xaa, 0xfe,
+    0xa3, 0xdd, 0x14, 0xe5, 0x04, 0x0c, 0xcc, 0x19, 0x9c, 0xf3, 0x6f, 0x0b, 0xfe, 0x24, 0x0f, 0xe2,
+    0x72, 0x13, 0x54, 0x24, 0x06, 0x56, 0x44, 0xfb, 0xd2, 0x7f, 0xd1, 0x74, 0x3b, 0x46, 0x06, 0xcf,
+    0xfb, 0x3f, 0xb9, 0xc1, 0xcf, 0x1e, 0xd6, 0x74, 0xf3, 0x4f, 0xe0, 0x6f, 0xb4, 0xaf, 0xf3, 0x24,
+    0xaf, 0x61, 0x0e, 0xd8, 0xb4, 0x91, 0xec, 0x8b, 0x1d, 0x6c, 0xce, 0x29, 0x33, 0xb6, 0xbd, 0x5a,
+    0x3f, 0xfd, 0x2e, 0x81, 0x73, 0xee, 0x1a, 0x49, 0xcb, 0x39, 0xba, 0x6d, 0xd5, 0xc6, 0xc9, 0xbc,
+    0x9b, 0x3c, 0x25, 0x53, 0x62, 0x7e, 0x51, 0x42, 0xd8, 0x19, 0x8d, 0xe7, 0x1a, 0xf8, 0x23, 0x34,
+    0xc2, 0x34, 0xc7, 0x0b, 0xf5, 0xf0, 0xdb, 0x7e, 0x03, 0x22, 0xfc, 0xae, 0x22, 0x98, 0xd7, 0x1f,
+    0x75, 0x7e, 0x56, 0xea, 0xb3, 0xb3, 0x7b, 0x8d, 0x0d, 0x14, 0xf4, 0x85, 0xf9, 0x65, 0x27, 0x48,
+    0x53, 0xa4, 0xd1, 0x57, 0x90, 0x7e, 0xf4, 0xa8, 0xa3, 0x40, 0xd7, 0xe5, 0xe4, 0x1f, 0xe3, 0x71,
+    0xd8, 0xa0, 0x82, 0xd9, 0x86, 0xb9, 0x6e, 0xec, 0xd7, 0x87, 0x49, 0xac, 0xb5, 0x60, 0xf4, 0x35,
+    0xe1, 0xcd, 0x9c, 0x5b, 0xe4, 0xa4, 0x1f, 0x3f, 0x90, 0xd9, 0x98, 0x69, 0x7e, 0x57, 0x64, 0x71,
+    0x9a, 0xbb, 0x3d, 0xfc, 0xd6, 0xeb, 0x9e, 0xc5, 0x5e, 0xd8, 0x65, 0xd6, 0x36, 0x66, 0xaf, 0x07,
+    0xf2, 0x10, 0x1d, 0x41, 0x8e, 0xf8, 0xc1, 0x96, 0x20, 0x4e, 0xaa, 0x22, 0x69, 0x4c, 0x55, 0x36,
+    0x70, 0x7d, 0x54, 0x87, 0xb9, 0xf2, 0x7a, 0x46, 0x32, 0xf9, 0xbf, 0x8e, 0xb5, 0xc8, 0x58, 0xec,
+    0x2b, 0x33, 0x5a, 0x1c, 0x59, 0xeb, 0xc3, 0xf3, 0xcc, 0x0d, 0xfe, 0x7d, 0xc2, 0x0d, 0xb9, 0x62,
+    0x07, 0xe0, 0xfc, 0xdf, 0x3f, 0x00, 0xaf, 0x81, 0x7f, 0xf4, 0x6e, 0x30, 0x82, 0x7e, 0x03, 0xf3,
+    0xbe, 0x7f, 0xcf, 0x0e, 0xea, 0xe1, 0x0a, 0xf1, 0x92, 0x03, 0x07, 0x50, 0x06, 0x76, 0x43, 0xe1,
+    0xc6, 0x02, 0x7f, 0xf0, 0xf0, 0xb0, 0x0f, 0xad, 0x03, 0x54, 0x29, 0xfd, 0xa7, 0x47, 0xb9, 0x66,
+    0xdc, 0xbc, 0xa3, 0xf2, 0xcb, 0xb5, 0xec, 0x66, 0xc5, 0x26, 0xd2, 0xaf, 0x94, 0x1d, 0xcc, 0x4f,
+    0x1b, 0x6b, 0x3e, 0x34, 0x43, 0x16, 0xf3, 0x0b, 0xdb, 0xbb, 0x9b, 0x63, 0x2a, 0xc1, 0xc6, 0x2d,
+    0xac, 0x31, 0x70, 0xb7, 0xd8, 0xe6, 0x00, 0x4f, 0xee, 0x78, 0xb6, 0xc2, 0xd7, 0x54, 0x7a, 0x67,
+    0x9b, 0x35, 0x86, 0x05, 0xa3, 0x28, 0x94, 0x8b, 0x3b, 0xc1, 0x29, 0xed, 0x4b, 0xd0, 0xf1, 0x97,
+    0x61, 0x16, 0x52, 0xbe, 0x47, 0xda, 0x88, 0x46, 0x43, 0x36, 0x29, 0xea, 0xd4, 0x74, 0x9b, 0xcd,
+    0xb0, 0x71, 0xa1, 0xe9, 0x7e, 0x31, 0x05, 0x47, 0xfb, 0xb1, 0xe5, 0xaf, 0xd3, 0xee, 0x3a, 0x3b,
+    0x5e, 0x25, 0xcf, 0x5f, 0x64, 0x9e, 0xc4, 0x11, 0x5e, 0xbe, 0xed, 0xce, 0x81, 0xee, 0x20, 0xb8,
+    0x2a, 0xb9, 0xc3, 0xb0, 0xfe, 0x30, 0xfe, 0x72, 0xf0, 0x7b, 0x3c, 0xf2, 0x23, 0xa3, 0x6d, 0x3c,
+    0x67, 0xba, 0xc1, 0x77, 0xba, 0xb3, 0xa0, 0xf2, 0xda, 0x3b, 0x72, 0x0e, 0xef, 0xbd, 0x85, 0x70,
+    0x6a, 0xbf, 0x4b, 0x33, 0x35, 0xc3, 0x4c, 0x93, 0x06, 0x70, 0xd9, 0xd3, 0x48, 0x5b, 0x16, 0x39,
+    0x47, 0x79, 0xe9, 0xf5, 0x1a, 0x6d, 0xfa, 0xc2, 0x3d, 0x17, 0xe3, 0x05, 0x08, 0x70, 0x4b, 0x6e,
+    0x89, 0x63, 0x99, 0x4d, 0x23, 0xc4, 0xed, 0x38, 0xf5, 0xa0, 0xa5, 0x28, 0xb8, 0x84, 0xa7, 0x10,
+    0xca, 0x66, 0xa3, 0x81, 0xee, 0xbc, 0x39, 0x9a, 0xd4, 0xe1, 0x0f, 0x23, 0xe8, 0x11, 0xc4, 0x8f,
+    0x82, 0xba, 0x91, 0x6a, 0x77, 0xf3, 0x35, 0x64, 0x0a, 0x98, 0xe7, 0x16, 0x8c, 0x99, 0x87, 0x7a,
+    0x00, 0x83, 0x3c, 0x42, 0x7b, 0xea, 0x19, 0xd1, 0x7e, 0x0d, 0xce, 0xa7, 0xcf, 0x5d, 0xac, 0x6a,
+    0x0a, 0x98, 0xe1, 0x84, 0xf8, 0xcd, 0xd1, 0x39, 0xf3, 0xfa, 0x4d, 0xd3, 0xc8, 0x2f, 0x44, 0xe6,
+    0x2f, 0xac, 0xa1, 0xd9, 0x24, 0xf4, 0x95, 0x06, 0xfc, 0xa0, 0x27, 0x4d, 0xce, 0x5a, 0xeb, 0xfb,
+    0x73, 0x22, 0x5f, 0xa5, 0x1e, 0x5b, 0x96, 0x7d, 0x2f, 0x2c, 0xeb, 0xe9, 0x22, 0xe4, 0x1b, 0xc7,
+    0x1f, 0x99, 0x8d, 0xb3, 0x1a, 0x61, 0xff, 0x31, 0xf0, 0x42, 0x30, 0xe8, 0xc3, 0x7a, 0xc0, 0x0b,
+    0x7b, 0x15, 0xdf, 0x53, 0xb3, 0x39, 0xa6, 0x9e, 0xe8, 0xaa, 0x3f, 0x5d, 0xfa, 0xaf, 0x03, 0xdc,
+    0x2b, 0xc9, 0xfe, 0xad, 0x0b, 0x76, 0x70, 0xfd, 0xc0, 0x1c, 0x81, 0x18, 0x83, 0xb9, 0x6c, 0x68,
+    0xc4, 0x1e, 0x91, 0x5c, 0xa2, 0x41, 0xdf, 0x0a, 0x02, 0x13, 0x3c, 0x85, 0xcf, 0xfa, 0xbf, 0xd7,
+    0xd6, 0x63, 0x4e, 0xb9, 0x33, 0x1d, 0x6a, 0x26, 0x65, 0xad, 0x23, 0x43, 0xa0, 0x50, 0x7d, 0x5f,
+    0x37, 0xb0, 0xdc, 0xf9, 0xe9, 0x99, 0x3b, 0x1b, 0x71, 0x1a, 0x4a, 0x37, 0x9a, 0xeb, 0x26, 0xd4,
+    0xf2, 0x65, 0xdd, 0xe8, 0x55, 0xe5, 0x76, 0x09, 0xf6, 0x39, 0x31, 0x17, 0xc3, 0xa7, 0x27, 0xad,
+    0x6b, 0x17, 0xe7, 0x56, 0xda, 0x9b, 0xc4, 0xe9, 0x20, 0x54, 0xec, 0x36, 0x89, 0x7b, 0x13, 0x2f,
+    0x85, 0xda, 0xac, 0xef, 0x58, 0x26, 0x53, 0xc5, 0xa3, 0xd1, 0x43, 0xdc, 0x58, 0x12, 0x0a, 0xb0,
+    0x3f, 0xa2, 0x76, 0x5e, 0x3d, 0x7f, 0x19, 0x4e, 0x9a, 0x7a, 0x6d, 0x74, 0xd4, 0x86, 0xbc, 0x61,
+    0x43, 0x3b, 0xa0, 0x18, 0x07, 0x92, 0xe3, 0xef, 0xa9, 0x8a, 0x3f, 0x81, 0x85, 0x78, 0xdb, 0xdf,
+    0x6b, 0x98, 0xed, 0xa2, 0x09, 0x89, 0x9b, 0xf9, 0xe2, 0x58, 0x38, 0xdb, 0xe6, 0x3b, 0xb0, 0xfa,
+    0xcd, 0x56, 0x4f, 0x87, 0x4b, 0xb2, 0x59, 0x59, 0xec, 0x38, 0xcf, 0x9a, 0xb2, 0x39, 0xce, 0xc0,
+    0xc9, 0xfc, 0x8f, 0x4e, 0xaf, 0xf3, 0xe8, 0x10, 0x1b, 0x60, 0x1e, 0xdb, 0xae, 0xaf, 0x8b, 0xd5,
+    0x7f, 0x39, 0xf0, 0x5b, 0xe2, 0x35, 0x73, 0x67, 0xbc, 0xff, 0xfb, 0x63, 0xac, 0x8a, 0xd3, 0x15,
+    0xc1, 0xb3, 0xe5, 0x44, 0x15, 0x7b, 0x67, 0x93, 0xd0, 0x69, 0x72, 0x14, 0x66, 0x9c, 0xad, 0x79,
+    0xe0, 0x19, 0xf3, 0x27, 0x24, 0x27, 0xc0, 0x2b, 0x84, 0x24, 0x5e, 0xff, 0x5e, 0x5f, 0x7a, 0xac,
+    0x52, 0x03, 0x2a, 0xa3, 0x65, 0x02, 0x20, 0x08, 0x96, 0x8b, 0xe6, 0xee, 0x86, 0x40, 0x4c, 0x3d,
+    0x29, 0x52, 0x9a, 0x98, 0x37, 0x74, 0x2e, 0xf3, 0xf9, 0xbf, 0xe7, 0x12, 0x9b, 0x28, 0xfe, 0xc4,
+    0x32, 0xd1, 0x4e, 0xf0, 0xbf, 0x8a, 0x18, 0x18, 0x91, 0xce, 0x9e, 0x94, 0x77, 0x72, 0x36, 0xdd,
+    0xea, 0xc4, 0x05, 0x71, 0xdc, 0xd2, 0x1e, 0x5d, 0x2a, 0x0e, 0x26, 0x79, 0xe2, 0x9b, 0x5f, 0xf2,
+    0x42, 0xbc, 0x42, 0x20, 0x91, 0xb5, 0xfe, 0xe1, 0xf8, 0xd3, 0x85, 0xc9, 0x58, 0xe5, 0xae, 0xca,
+    0xd1, 0xe1, 0x48, 0x9e, 0xfb, 0x37, 0x2e, 0x56, 0x0a, 0x13, 0xf9, 0xe4, 0x77, 0xb2, 0x1e, 0xee,
+    0x27, 0xdc, 0xfc, 0x5e, 0x06, 0x59, 0x38, 0x77, 0x59, 0x66, 0xd9, 0xbd, 0x0e, 0xfe, 0xcf, 0xd8,
+    0xf3, 0xce, 0x7c, 0xe5, 0xcc, 0x6f, 0x61, 0x65, 0xb8, 0x6d, 0x7b, 0x26, 0x5f, 0xb6, 0x7d, 0xe1,
+    0x98, 0xd9, 0x4a, 0x2e, 0x3d, 0x38, 0xfb, 0x47, 0xd7, 0x7c, 0x67, 0xfc, 0xd2, 0x62, 0x48, 0x1f,
+    0x43, 0x52, 0xb4, 0x69, 0x99, 0xff, 0xbc, 0x33, 0xcd, 0x5c, 0x1b, 0xe4, 0x32, 0x08, 0xd8, 0xdc,
+    0x6f, 0xcd, 0x62, 0x61, 0xb7, 0x23, 0xd3, 0x83, 0xa7, 0xbf, 0x06, 0xc7, 0xde, 0xcc, 0x19, 0x06,
+    0xd6, 0xee, 0x0a, 0xa3, 0xeb, 0xb2, 0x11, 0x60, 0x41, 0xac, 0xbd, 0xc0, 0x92, 0x1e, 0xb6, 0x49,
+    0x6e, 0xc3, 0x5c, 0x98, 0x5c, 0xf4, 0x80, 0x84, 0x3f, 0x9f, 0x2c, 0xcb, 0x4a, 0x2c, 0x2d, 0x52,
+    0x4e, 0xb2, 0xe4, 0x45, 0x38, 0x13, 0xc1, 0x6c, 0x78, 0xb4, 0xdc, 0x35, 0x0f, 0x27, 0xf5, 0x04,
+    0xb6, 0x8b, 0x6c, 0xf0, 0x62, 0x8a, 0xde, 0x8e, 0x4c, 0xcb, 0xdb, 0xb1, 0x73, 0xf8, 0x74, 0x58,
+    0xfb, 0x8a, 0xa7, 0xbf, 0x9e, 0xe9, 0xfa, 0x32, 0x9b, 0x02, 0x95, 0xaf, 0x09, 0xfc, 0xd7, 0xe6,
+    0x34, 0xcc, 0xc1, 0xc5, 0xf9, 0xbd, 0x59, 0xaf, 0x1d, 0xaa, 0x24, 0x3a, 0xcc, 0x11, 0xfc, 0xba,
+    0xc0, 0x17, 0x5c, 0x52, 0x2e, 0xee, 0x3b, 0xf5, 0x66, 0x4d, 0x2f, 0x63, 0xa9, 0x67, 0x35, 0x20,
+    0x8a, 0x37, 0x4d, 0xca, 0x20, 0x67, 0x87, 0x0d, 0xc3, 0x3c, 0x72, 0xd6, 0x27, 0x52, 0xea, 0x9b,
+    0x5f, 0x44, 0x69, 0xd8, 0xce, 0xd4, 0x74, 0x23, 0xe4, 0xd1, 0x83, 0xef, 0x5c, 0xc6, 0x81, 0x26,
+    0xf1, 0x22, 0xcd, 0xe5, 0x38, 0x1c, 0x8b, 0x1c, 0x8b, 0x9d, 0x50, 0x5c, 0x91, 0x3f, 0x59, 0xfb,
+    0xf9, 0x02, 0xf3, 0x7e, 0x87, 0xec, 0x34, 0xe5, 0x9f, 0x87, 0x9f, 0x9c, 0x9d, 0x5d, 0xd6, 0x70,
+    0x0f, 0x3e, 0xb2, 0x66, 0xab, 0xa7, 0xd2, 0x20, 0x22, 0xff, 0xc5, 0x8f, 0x0f, 0xf8, 0xc3, 0xc8,
+    0x2e, 0x83, 0xca, 0x03, 0xb2, 0x73, 0xd6, 0x49, 0xfd, 0x4a, 0x9a, 0x26, 0x90, 0x51, 0xd3, 0x5b,
+    0x6a, 0xf4, 0x0f, 0xe1, 0xf9, 0x67, 0xa7, 0x4e, 0x6b, 0x64, 0xcc, 0x14, 0xb5, 0xb6, 0x27, 0xd5,
+    0xbb, 0x2c, 0x7a, 0xbd, 0x23, 0xb3, 0x5e, 0xad, 0xbe, 0xfe, 0xd6, 0x6d, 0xbe, 0x77, 0xe0, 0xb0,
+    0xb4, 0x89, 0xe1, 0xd6, 0x0e, 0x39, 0xcb, 0xcc, 0xd8, 0x71, 0x84, 0xd2, 0xde, 0x17, 0x37, 0x88,
+    0x0c, 0x78, 0x51, 0x4f, 0xae, 0x89, 0x27, 0x1e, 0x67, 0x04, 0x62, 0x65, 0x07, 0x47, 0x08, 0xde,
+    0x6c, 0x8b, 0xc2, 0x41, 0x98, 0x0f, 0x2a, 0x1c, 0x36, 0x33, 0x26, 0x32, 0xac, 0x3b, 0x82, 0xfe,
+    0x15, 0x9c, 0xa2, 0x26, 0x6a, 0x77, 0x67, 0x35, 0x8e, 0xf1, 0xbd, 0x05, 0x07, 0x5f, 0x54, 0x1f,
+    0xd5, 0xf3, 0x05, 0xde, 0xf8, 0x48, 0x4a, 0x00, 0x54, 0x08, 0xf1, 0xa7, 0xc7, 0x0c, 0xd5, 0x1e,
+    0x4d, 0x7c, 0xa0, 0xcd, 0xc3, 0xb8, 0x12, 0x72, 0x8b, 0xb0, 0x0d, 0x9d, 0x25, 0x08, 0x67, 0x2e,
+    0x25, 0xcf, 0x5f, 0x2f, 0xd6, 0x95, 0x76, 0xfb, 0x92, 0x5f, 0x79, 0xa3, 0x2e, 0xd3, 0x2d, 0xb1,
+    0x43, 0x73, 0xfe, 0xcb, 0x4b, 0xe8, 0x3d, 0xd6, 0x64, 0x89, 0x75, 0x6e, 0x7c, 0xf3, 0xf7, 0x38,
+    0xa0, 0xc3, 0x06, 0xfd, 0x7c, 0xa7, 0xe8, 0xff, 0xa3, 0x44, 0x18, 0xdb, 0xe3, 0x92, 0x1f, 0x3b,
+    0x43, 0xde, 0x12, 0xfe, 0x01, 0xf4, 0x57, 0xdc, 0xfd, 0x1a, 0x69, 0x56, 0xc4, 0x8f, 0x8a, 0xc1,
+    0x99, 0xd2, 0x18, 0x87, 0xe7, 0xaf, 0x62, 0x20, 0x79, 0x87, 0x78, 0x16, 0xf8, 0x71, 0xeb, 0x00,
+    0xb8, 0x6d, 0xa3, 0xe2, 0x3a, 0xd7, 0xc6, 0xc0, 0xfe, 0xa6, 0x8b, 0x5b, 0x38, 0x5a, 0xf3, 0xcb,
+    0xbc, 0xc6, 0xd2, 0x19, 0xe0, 0xe5, 0xf4, 0x43, 0xa0, 0x9d, 0x24, 0x01, 0xc6, 0x93, 0x9d, 0x25,
+    0xfa, 0x91, 0xac, 0x4c, 0xe1, 0xfa, 0x70, 0x20, 0xce, 0x4e, 0x6f, 0x17, 0x3f, 0xa0, 0x64, 0xfc,
+    0x40, 0xbb, 0xf7, 0x8c, 0xb8, 0x70, 0xd6, 0xff, 0x87, 0x9b, 0x7c, 0x10, 0xe3, 0x7e, 0xe0, 0x05,
+    0x3c, 0x3d, 0xe5, 0x5e, 0x86, 0x5c, 0x6c, 0x67, 0x33, 0xd3, 0x33, 0x27, 0xf5, 0xc2, 0x94, 0x60,
+    0xd3, 0xef, 0xc9, 0xca, 0x9e, 0xfe, 0x27, 0x8d, 0x2e, 0xd1, 0xd1, 0xf1, 0x68, 0x5f, 0x37, 0xc5,
+    0xbc, 0xbc, 0x0b, 0xe0, 0xd0, 0x48, 0x58, 0x93, 0x9f, 0x6c, 0x3b, 0xf8, 0x63, 0x50, 0xd0, 0x6d,
+    0xdd, 0xe0, 0xd7, 0xba, 0x7f, 0x87, 0xb8, 0x30, 0xd4, 0xab, 0x47, 0x0e, 0x76, 0xd8, 0x05, 0x81,
+    0xf5, 0x6e, 0x9c, 0xf9, 0x87, 0x01, 0x82, 0x53, 0xe4, 0x6a, 0xcf, 0x36, 0x98, 0xe0, 0x2d, 0x9f,
+    0x95, 0x8c, 0xc9, 0x12, 0x87, 0x39, 0xaf, 0x12, 0x45, 0xbb, 0x77, 0xf1, 0x42, 0x80, 0xc3, 0x0c,
+    0xb2, 0xea, 0x68, 0x53, 0x06, 0xbe, 0x10, 0x77, 0x35, 0x50, 0x72, 0x6e, 0xed, 0x72, 0x79, 0xe2,
+    0x5e, 0x02, 0xc5, 0x7b, 0xfa, 0x0f, 0xe2, 0x0d, 0x82, 0x8e, 0x29, 0x41, 0x8d, 0xee, 0xf0, 0x8b,
+    0x83, 0xe1, 0x3f, 0x36, 0x85, 0x91, 0x76, 0x4e, 0x0b, 0x47, 0xbc, 0xc1, 0x4e, 0x02, 0x4a, 0x00,
+    0xcb, 0x7d, 0x1f, 0x0c, 0x3e, 0xc8, 0xbf, 0x43, 0xdb, 0xfd, 0x05, 0xf4, 0x7d, 0xe3, 0xbf, 0x1b,
+    0x97, 0x29, 0xa3, 0x8e, 0x7c, 0x73, 0xfe, 0xa1, 0xe6, 0x4f, 0x81, 0x5d, 0x62, 0xd1, 0x53, 0xc1,
+    0x77, 0x77, 0x96, 0x7d, 0x93, 0xf4, 0xe5, 0x7f, 0xb8, 0xfa, 0x5e, 0xa0, 0xa3, 0x49, 0x92, 0x2b,
+    0xf8, 0x64, 0x83, 0x24, 0x37, 0x65, 0xd1, 0x28, 0x53, 0x16, 0xc4, 0x4b, 0x22, 0x2c, 0x54, 0xbe,
+    0xa2, 0xb5, 0xd4, 0xb2, 0x45, 0xc9, 0xf4, 0x36, 0x56, 0xfb, 0xea, 0x31, 0x73, 0x7f, 0x45, 0x3f,
+    0x5d, 0x88, 0xfa, 0xe1, 0xad, 0x8a, 0xdd, 0x8e, 0x05, 0xfe, 0x43, 0x44, 0x58, 0x16, 0x5e, 0xc8,
+    0xad, 0x12, 0xca, 0x02, 0x13, 0x94, 0x27, 0x13, 0xdf, 0xed, 0xeb, 0xee, 0x4d, 0x44, 0xcd, 0xf8,
+    0xc9, 0x66, 0x42, 0xec, 0x50, 0x23, 0x29, 0x98, 0x22, 0xe6, 0x75, 0x71, 0x73, 0xdf, 0x4a, 0x4c,
+    0xa9, 0x16, 0x06, 0x16, 0x9e, 0x9f, 0x62, 0xc6, 0x44, 0xc5, 0xba, 0xf2, 0x12, 0x86, 0xfd, 0x6f,
+    0xe0, 0xfd, 0xd0, 0x8a, 0xed, 0x90, 0xae, 0x9e, 0x19, 0xd5, 0xa6, 0x7c, 0x7e, 0x06, 0xfa, 0x91,
+    0x4a, 0xe9, 0x76, 0x48, 0xae, 0xdc, 0xd1, 0x8b, 0x61, 0x29, 0xec, 0xaf, 0x0e, 0x31, 0xc3, 0x68,
+    0x25, 0x08, 0x18, 0x15, 0x7b, 0x8c, 0x76, 0xbe, 0xe2, 0xbb, 0xf1, 0x4b, 0xe5, 0xc2, 0xfc, 0x2c,
+    0x1f, 0x7a, 0x5e, 0x1b, 0x95, 0x41, 0x26, 0x49, 0xe9, 0x58, 0x18, 0x8f, 0x68, 0x1f, 0xc5, 0xfe,
+    0xa9, 0x05, 0x11, 0x32, 0x3b, 0x56, 0x1f, 0xcb, 0x32, 0xfa, 0x38, 0xf0, 0x1c, 0x3a, 0xd9, 0xd6,
+    0xcd, 0xa7, 0xbb, 0xd1, 0x53, 0x71, 0x24, 0x9f, 0xfd, 0x04, 0x15, 0x82, 0x08, 0x25, 0x99, 0xe9,
+    0xa1, 0xf4, 0x00, 0x12, 0x2d, 0xc1, 0xd6, 0x06, 0x18, 0xe2, 0x1e, 0x46, 0xc6, 0x16, 0xf0, 0x94,
+    0xa8, 0x64, 0x41, 0x5a, 0xa9, 0xd8, 0x5d, 0xdb, 0x2d, 0xd7, 0x19, 0x31, 0xb9, 0x67, 0x07, 0x27,
+    0x43, 0x72, 0x91, 0x54, 0xec, 0x9f, 0x81, 0x07, 0x45, 0xfe, 0x74, 0x8f, 0x72, 0x19, 0x99, 0x0f,
+    0xe9, 0xa5, 0x19, 0x87, 0x20, 0xc9, 0x25, 0xb4, 0xee, 0x51, 0x64, 0x98, 0x95, 0x8d, 0xe1, 0x9e,
+    0x9c, 0x8f, 0x92, 0x83, 0x7f, 0xee, 0x7a, 0x0c, 0xa2, 0x57, 0x77, 0x84, 0x5c, 0xb1, 0x20, 0xce,
+    0x20, 0xc8, 0x9d, 0x66, 0x00, 0x0c, 0xa3, 0x20, 0x19, 0xeb, 0x6a, 0x1c, 0xbd, 0x3c, 0x83, 0x14,
+    0xaf, 0x8b, 0x21, 0xf6, 0x8e, 0x04, 0x0a, 0xc0, 0xb3, 0x85, 0x8e, 0x05, 0xfd, 0x4f, 0x0e, 0x6c,
+    0xe1, 0x23, 0xe3, 0x69, 0x61, 0x9a, 0x23, 0xee, 0xdd, 0xbe, 0x1b, 0xf4, 0xf1, 0x88, 0x73, 0x0f,
+    0x32, 0xa4, 0xf8, 0xa1, 0x07, 0xe5, 0xb3, 0x2a, 0xe7, 0xfd, 0xa1, 0xd7, 0x85, 0x79, 0xdc, 0xf2,
+    0xe4, 0x47, 0x6e, 0xdc, 0xb9, 0xfc, 0x7d, 0x75, 0x4b, 0xa9, 0x80, 0x19, 0x5b, 0x9d, 0xf5, 0x36,
+    0x1d, 0xc6, 0x39, 0xb4, 0x3c, 0xa2, 0x60, 0x74, 0x62, 0xca, 0x44, 0x1c, 0x55, 0x50, 0xe8, 0x72,
+    0xf6, 0xc4, 0x60, 0x20, 0xba, 0xce, 0x61, 0x47, 0x16, 0xcc, 0xc2, 0x51, 0xda, 0xbc, 0xd8, 0xca,
+    0xee, 0x01, 0x40, 0x18, 0xbd, 0xd1, 0xa8, 0x80, 0xf0, 0x30, 0x36, 0xce, 0xe9, 0x73, 0x11, 0x3e,
+    0x46, 0x1b, 0xbe, 0x1a, 0x8b, 0x80, 0xb4, 0xdf, 0xd3, 0xc9, 0x65, 0xbe, 0xf0, 0xfd, 0xc3, 0xcd,
+    0x12, 0xfb, 0x0a, 0xd8, 0x60, 0x24, 0xc6, 0x28, 0xf2, 0xf2, 0x1b, 0x57, 0x1c, 0x7b, 0x18, 0xcd,
+    0x51, 0xeb, 0x83, 0xa7, 0x49, 0x1b, 0x53, 0x1c, 0x6e, 0xcc, 0x67, 0x19, 0x0c, 0x96, 0x04, 0x09,
+    0x36, 0xfc, 0x53, 0xe2, 0xbf, 0xb6, 0xd6, 0xcb, 0x6f, 0x06, 0xa0, 0x5e, 0x44, 0x39, 0x49, 0xb0,
+    0x75, 0x45, 0x4a, 0xfb, 0xa9, 0x80, 0xc8, 0x52, 0x60, 0x3d, 0xb2, 0x79, 0xb7, 0xf9, 0x5d, 0xf8,
+    0xfb, 0xec, 0xad, 0xfd, 0xe8, 0x0c, 0x18, 0x51, 0x4a, 0x50, 0x7f, 0x9c, 0x9e, 0x83, 0xff, 0x5f,
+    0x8b, 0xcc, 0x1f,
 };
+const ShaderModule Blob003 = { Blob003_Data, 6947u, 6683u, 3u };
 
-extern const uint32_t Blob004[6683];
-const uint32_t Blob004[6683] = {
-    0x07230203, 0x00010300, 0x0008000b, 0x000003e3, 0x00000000, 0x00020011, 0x00000001, 0x0006000b,
-    0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001,
-    0x0008000f, 0x00000005, 0x00000004, 0x6e69616d, 0x00000000, 0x000000d9, 0x0000029a, 0x000002b2,
-    0x00060010, 0x00000004, 0x00000011, 0x00000008, 0x00000008, 0x00000001, 0x00030003, 0x00000002,
-    0x000001c2, 0x000a0004, 0x475f4c47, 0x4c474f4f, 0x70635f45, 0x74735f70, 0x5f656c79, 0x656e696c,
-    0x7269645f, 0x69746365, 0x00006576, 0x00080004, 0x475f4c47, 0x4c474f4f, 0x6e695f45, 0x64756c63,
-    0x69645f65, 0x74636572, 0x00657669, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000, 0x000a0005,
-    0x00000010, 0x74706544, 0x73655468, 0x73615074, 0x28736573, 0x623b3162, 0x31753b31, 0x3b31753b,
-    0x003b3175, 0x00060005, 0x0000000b, 0x61757165, 0x7065446c, 0x65546874, 0x00007473, 0x00050005,
-    0x0000000c, 0x69636166, 0x6956676e, 0x00007765, 0x00050005, 0x0000000d, 0x44747364, 0x68747065,
-    0x00000000, 0x00050005, 0x0000000e, 0x656c6974, 0x74706544, 0x00000068, 0x00040005, 0x0000000f,
-    0x41747364, 0x00727474, 0x000d0005, 0x0000001c, 0x746f6c50, 0x6e617254, 0x63756c73, 0x28746e65,
-    0x753b3175, 0x31753b31, 0x3b31623b, 0x753b3175, 0x31753b31, 0x3b31753b, 0x003b3162, 0x00040005,
-    0x00000013, 0x6f6c6f63, 0x00000072, 0x00040005, 0x00000014, 0x74706564, 0x00000068, 0x00040005,
-    0x00000015, 0x72747461, 0x00000000, 0x00050005, 0x00000016, 0x68537369, 0x776f6461, 0x00000000,
-    0x00050005, 0x00000017, 0x656c6974, 0x6f6c6f43, 0x00000072, 0x00040005, 0x00000018, 0x41637273,
-    0x00000000, 0x00050005, 0x00000019, 0x656c6974, 0x74706544, 0x00000068, 0x00040005, 0x0000001a,
-    0x41637273, 0x00727474, 0x00050005, 0x0000001b, 0x74697277, 0x70654465, 0x00006874, 0x00100005,
-    0x0000002d, 0x636f7250, 0x43737365, 0x7372616f, 0x73614d65, 0x3169286b, 0x3b31753b, 0x763b3175,
-    0x763b3275, 0x763b3275, 0x763b3275, 0x623b3275, 0x31753b31, 0x3b31623b, 0x00000000, 0x00050005,
-    0x00000023, 0x656e696c, 0x69547261, 0x0000656c, 0x00050005, 0x00000024, 0x72616f63, 0x614d6573,
-    0x00006b73, 0x00060005, 0x00000025, 0x72616f63, 0x664f6573, 0x74657366, 0x00000000, 0x00040005,
-    0x00000026, 0x6f6c6f63, 0x00000072, 0x00040005, 0x00000027, 0x74706564, 0x00000068, 0x00040005,
-    0x00000028, 0x72747461, 0x00000000, 0x00040005, 0x00000029, 0x6e6e6977, 0x00007265, 0x00060005,
-    0x0000002a, 0x63617274, 0x766f436b, 0x67617265, 0x00000065, 0x00040005, 0x0000002b, 0x6e657473,
-    0x006c6963, 0x00070005, 0x0000002c, 0x76657270, 0x68537349, 0x776f6461, 0x6b73614d, 0x00000000,
-    0x00050005, 0x00000050, 0x6e656c62, 0x74744164, 0x00000072, 0x00040005, 0x0000008b, 0x52637273,
-    0x00000042, 0x00040005, 0x0000008f, 0x47637273, 0x00000000, 0x00040005, 0x00000093, 0x52747364,
-    0x00000042, 0x00040005, 0x00000096, 0x47747364, 0x00000000, 0x00040005, 0x00000099, 0x41747364,
-    0x00000000, 0x00040005, 0x0000009d, 0x68706c61, 0x00000061, 0x00050005, 0x000000ac, 0x6174654d,
-    0x66696e55, 0x006d726f, 0x00060006, 0x000000ac, 0x00000000, 0x506d754e, 0x67796c6f, 0x00736e6f,
-    0x00060006, 0x000000ac, 0x00000001, 0x566d754e, 0x61697261, 0x0073746e, 0x00060006, 0x000000ac,
-    0x00000002, 0x68706c41, 0x66655261, 0x00000000, 0x00050006, 0x000000ac, 0x00000003, 0x70736944,
-    0x00746e43, 0x00060006, 0x000000ac, 0x00000004, 0x6e6f6f54, 0x6c626154, 0x00000065, 0x00060006,
-    0x000000ac, 0x00000005, 0x61656c43, 0x6c6f4372, 0x0000726f, 0x00060006, 0x000000ac, 0x00000006,
-    0x61656c43, 0x70654472, 0x00006874, 0x00060006, 0x000000ac, 0x00000007, 0x61656c43, 0x74744172,
-    0x00000072, 0x00060006, 0x000000ac, 0x00000008, 0x4f676f46, 0x65736666, 0x00000074, 0x00060006,
-    0x000000ac, 0x00000009, 0x53676f46, 0x74666968, 0x00000000, 0x00060006, 0x000000ac, 0x0000000a,
-    0x43676f46, 0x726f6c6f, 0x00000000, 0x00080006, 0x000000ac, 0x0000000b, 0x61656c43, 0x74694272,
-    0x4f70616d, 0x65736666, 0x00000074, 0x00030005, 0x000000ae, 0x00000000, 0x00060005, 0x000000d6,
-    0x656c6974, 0x656e6e49, 0x66664f72, 0x00746573, 0x00080005, 0x000000d9, 0x4c5f6c67, 0x6c61636f,
-    0x6f766e49, 0x69746163, 0x44496e6f, 0x00000000, 0x00050005, 0x000000ea, 0x72616f63, 0x69426573,
-    0x00000074, 0x00050005, 0x000000f3, 0x656c6974, 0x7366664f, 0x00007465, 0x00050005, 0x000000fc,
-    0x656e6966, 0x6b73614d, 0x00000000, 0x00060005, 0x00000102, 0x526e6942, 0x6c757365, 0x66754274,
-    0x00726566, 0x00080006, 0x00000102, 0x00000000, 0x69726156, 0x57746e61, 0x436b726f, 0x746e756f,
-    0x00000000, 0x00080006, 0x00000102, 0x00000001, 0x74726f53, 0x6f576465, 0x664f6b72, 0x74657366,
-    0x00000000, 0x00090006, 0x00000102, 0x00000002, 0x69726156, 0x57746e61, 0x526b726f, 0x436c6165,
-    0x746e756f, 0x00000000, 0x00080006, 0x00000102, 0x00000003, 0x74726f53, 0x6b726f57, 0x6b726f57,
-    0x6e756f43, 0x00000074, 0x00090006, 0x00000102, 0x00000004, 0x6e6e6942, 0x4d676e69, 0x416b7361,
-    0x664f646e, 0x74657366, 0x00000000, 0x00030005, 0x00000104, 0x00000000, 0x00050005, 0x00000107,
-    0x65726353, 0x69576e65, 0x00687464, 0x00060005, 0x00000108, 0x656c6954, 0x72655073, 0x656e694c,
-    0x00000000, 0x00060005, 0x00000109, 0x65726353, 0x65486e65, 0x74686769, 0x00000000, 0x00050005,
-    0x0000010a, 0x656c6954, 0x656e694c, 0x00000073, 0x00070005, 0x0000010e, 0x6e6e6942, 0x4d676e69,
-    0x536b7361, 0x74726174, 0x00000000, 0x00040005, 0x00000115, 0x6b726f77, 0x00786449, 0x00080005,
-    0x00000118, 0x6e6e6942, 0x57676e69, 0x4f6b726f, 0x65736666, 0x74537374, 0x00747261, 0x00040005,
-    0x00000125, 0x656e6966, 0x00786449, 0x00050005, 0x0000012e, 0x65786970, 0x646e696c, 0x00007865,
-    0x00050005, 0x00000135, 0x656c6974, 0x6f6c6f43, 0x00000072, 0x00060005, 0x00000137, 0x6f6c6f43,
-    0x6c695472, 0x66754265, 0x00726566, 0x00060006, 0x00000137, 0x00000000, 0x6f6c6f43, 0x6c695472,
-    0x00007365, 0x00030005, 0x00000139, 0x00000000, 0x00050005, 0x00000140, 0x796c6f70, 0x496e6f67,
-    0x00007864, 0x00060005, 0x00000141, 0x68737550, 0x736e6f43, 0x746e6174, 0x00000073, 0x00060006,
-    0x00000141, 0x00000000, 0x56727543, 0x61697261, 0x0000746e, 0x00060006, 0x00000141, 0x00000001,
-    0x57786554, 0x68746469, 0x00000000, 0x00060006, 0x00000141, 0x00000002, 0x48786554, 0x68676965,
-    0x00000074, 0x00060006, 0x00000141, 0x00000003, 0x57786554, 0x53706172, 0x00000000, 0x00060006,
-    0x00000141, 0x00000004, 0x57786554, 0x54706172, 0x00000000, 0x00070006, 0x00000141, 0x00000005,
-    0x49786554, 0x70614373, 0x65727574, 0x00000000, 0x00070006, 0x00000141, 0x00000006, 0x74706143,
-    0x59657275, 0x7366664f, 0x00007465, 0x00050006, 0x00000141, 0x00000007, 0x6461705f, 0x00000000,
-    0x00030005, 0x00000143, 0x00006370, 0x00050005, 0x00000152, 0x796c6f70, 0x416e6f67, 0x00727474,
-    0x00040005, 0x00000153, 0x796c6f50, 0x006e6f67, 0x00060006, 0x00000153, 0x00000000, 0x73726946,
-    0x70535874, 0x00006e61, 0x00050006, 0x00000153, 0x00000001, 0x706f5459, 0x00000000, 0x00050006,
-    0x00000153, 0x00000002, 0x746f4259, 0x00000000, 0x00050006, 0x00000153, 0x00000003, 0x6e694d58,
-    0x00000000, 0x00050006, 0x00000153, 0x00000004, 0x78614d58, 0x00000000, 0x00050006, 0x00000153,
-    0x00000005, 0x6e694d58, 0x00000059, 0x00050006, 0x00000153, 0x00000006, 0x78614d58, 0x00000059,
-    0x00050006, 0x00000153, 0x00000007, 0x69726156, 0x00746e61, 0x00050006, 0x00000153, 0x00000008,
-    0x72747441, 0x00000000, 0x00070006, 0x00000153, 0x00000009, 0x74786554, 0x4c657275, 0x72657961,
-    0x00000000, 0x00060006, 0x00000153, 0x0000000a, 0x69636146, 0x6956676e, 0x00007765, 0x00060005,
-    0x00000155, 0x796c6f50, 0x426e6f67, 0x65666675, 0x00000072, 0x00060006, 0x00000155, 0x00000000,
-    0x796c6f50, 0x736e6f67, 0x00000000, 0x00030005, 0x00000157, 0x00000000, 0x00050005, 0x0000015b,
-    0x69636166, 0x6956676e, 0x00007765, 0x00060005, 0x00000161, 0x68537369, 0x776f6461, 0x6b73614d,
-    0x00000000, 0x00070005, 0x00000167, 0x76657270, 0x68537349, 0x776f6461, 0x6b73614d, 0x00646c4f,
-    0x00060005, 0x0000016a, 0x61757165, 0x7065446c, 0x65546874, 0x00007473, 0x00050005, 0x0000016f,
-    0x656c6974, 0x74706544, 0x00000068, 0x00060005, 0x00000171, 0x74706544, 0x6c695468, 0x66754265,
-    0x00726566, 0x00060006, 0x00000171, 0x00000000, 0x74706544, 0x6c695468, 0x00007365, 0x00030005,
-    0x00000173, 0x00000000, 0x00050005, 0x00000177, 0x656c6974, 0x72747441, 0x00000000, 0x00060005,
-    0x00000179, 0x72747441, 0x656c6954, 0x66667542, 0x00007265, 0x00060006, 0x00000179, 0x00000000,
-    0x72747441, 0x656c6954, 0x00000073, 0x00030005, 0x0000017b, 0x00000000, 0x00040005, 0x0000017f,
-    0x61747364, 0x00727474, 0x00050005, 0x00000186, 0x68537369, 0x776f6461, 0x00000000, 0x00070005,
-    0x0000018a, 0x74697277, 0x63655365, 0x4c646e6f, 0x72657961, 0x00000000, 0x00050005, 0x000001a3,
-    0x44747364, 0x68747065, 0x00000000, 0x00040005, 0x000001ae, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001b0, 0x61726170, 0x0000006d, 0x00040005, 0x000001b2, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001b4, 0x61726170, 0x0000006d, 0x00040005, 0x000001b6, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001c7, 0x61726170, 0x0000006d, 0x00040005, 0x000001c9, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001cb, 0x61726170, 0x0000006d, 0x00040005, 0x000001ce, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001d0, 0x61726170, 0x0000006d, 0x00040005, 0x000001d7, 0x41637273, 0x00727474, 0x00040005,
-    0x000001e1, 0x41637273, 0x00000000, 0x00050005, 0x00000223, 0x74697277, 0x70654465, 0x00006874,
-    0x00040005, 0x0000022b, 0x61726170, 0x0000006d, 0x00040005, 0x0000022e, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000231, 0x61726170, 0x0000006d, 0x00040005, 0x00000234, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000236, 0x61726170, 0x0000006d, 0x00040005, 0x00000238, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000023a, 0x61726170, 0x0000006d, 0x00040005, 0x0000023c, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000023e, 0x61726170, 0x0000006d, 0x00040005, 0x00000251, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000254, 0x61726170, 0x0000006d, 0x00040005, 0x00000257, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000025a, 0x61726170, 0x0000006d, 0x00040005, 0x0000025c, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000025e, 0x61726170, 0x0000006d, 0x00040005, 0x00000260, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000262, 0x61726170, 0x0000006d, 0x00040005, 0x00000264, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000272, 0x61726170, 0x0000006d, 0x00040005, 0x00000274, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000276, 0x61726170, 0x0000006d, 0x00040005, 0x00000279, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000027b, 0x61726170, 0x0000006d, 0x00040005, 0x00000287, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000289, 0x61726170, 0x0000006d, 0x00040005, 0x0000028b, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000028e, 0x61726170, 0x0000006d, 0x00040005, 0x00000290, 0x61726170, 0x0000006d,
-    0x00050005, 0x00000299, 0x656e696c, 0x69547261, 0x0000656c, 0x00060005, 0x0000029a, 0x575f6c67,
-    0x476b726f, 0x70756f72, 0x00004449, 0x00060005, 0x000002a3, 0x72616f63, 0x614d6573, 0x6f4c6b73,
-    0x00000000, 0x00060005, 0x000002aa, 0x72616f63, 0x614d6573, 0x69486b73, 0x00000000, 0x00060005,
-    0x000002b1, 0x75736572, 0x664f746c, 0x74657366, 0x00000000, 0x00080005, 0x000002b2, 0x475f6c67,
-    0x61626f6c, 0x766e496c, 0x7461636f, 0x496e6f69, 0x00000044, 0x00040005, 0x000002bb, 0x6e6e6977,
-    0x00007265, 0x00060005, 0x000002be, 0x63617274, 0x766f436b, 0x67617265, 0x00000065, 0x00040005,
-    0x000002c8, 0x6e657473, 0x006c6963, 0x00070005, 0x000002c9, 0x76657270, 0x68537349, 0x776f6461,
-    0x6b73614d, 0x00000000, 0x00040005, 0x000002cf, 0x6f6c6f63, 0x00000072, 0x00060005, 0x000002d1,
-    0x75736552, 0x7542746c, 0x72656666, 0x00000000, 0x00060006, 0x000002d1, 0x00000000, 0x75736552,
-    0x6156746c, 0x0065756c, 0x00030005, 0x000002d3, 0x00000000, 0x00070005, 0x000002dc, 0x6d617246,
-    0x66756265, 0x53726566, 0x64697274, 0x00000065, 0x00040005, 0x000002e2, 0x74706564, 0x00000068,
-    0x00070005, 0x000002e6, 0x75736552, 0x6544746c, 0x53687470, 0x74726174, 0x00000000, 0x00040005,
-    0x000002f4, 0x72747461, 0x00000000, 0x00060005, 0x000002f8, 0x75736552, 0x7441746c, 0x74537274,
-    0x00747261, 0x00070005, 0x0000030a, 0x75736552, 0x6957746c, 0x72656e6e, 0x66667542, 0x00007265,
-    0x00070006, 0x0000030a, 0x00000000, 0x75736552, 0x6957746c, 0x72656e6e, 0x00000000, 0x00030005,
-    0x0000030c, 0x00000000, 0x00060005, 0x00000315, 0x746e6f63, 0x61756e69, 0x6e6f6974, 0x00000000,
-    0x00080005, 0x00000317, 0x6e656c42, 0x6e6f4364, 0x756e6974, 0x6f697461, 0x6675426e, 0x00726566,
-    0x00090006, 0x00000317, 0x00000000, 0x6e656c42, 0x6e6f4364, 0x756e6974, 0x6f697461, 0x6174536e,
-    0x00006574, 0x00030005, 0x00000319, 0x00000000, 0x00040005, 0x00000330, 0x6c616373, 0x00000065,
-    0x00030005, 0x00000335, 0x00736f70, 0x00070005, 0x00000343, 0x61656c43, 0x74694272, 0x4370616d,
-    0x726f6c6f, 0x00000000, 0x00070005, 0x0000034a, 0x61656c43, 0x74694272, 0x4470616d, 0x68747065,
-    0x00000000, 0x00040005, 0x0000036f, 0x61726170, 0x0000006d, 0x00040005, 0x00000371, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000373, 0x61726170, 0x0000006d, 0x00040005, 0x00000374, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000376, 0x61726170, 0x0000006d, 0x00040005, 0x00000378, 0x61726170,
-    0x0000006d, 0x00040005, 0x0000037a, 0x61726170, 0x0000006d, 0x00040005, 0x0000037c, 0x61726170,
-    0x0000006d, 0x00040005, 0x0000037e, 0x61726170, 0x0000006d, 0x00040005, 0x00000380, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000389, 0x61726170, 0x0000006d, 0x00040005, 0x0000038b, 0x61726170,
-    0x0000006d, 0x00040005, 0x0000038d, 0x61726170, 0x0000006d, 0x00040005, 0x0000038e, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000390, 0x61726170, 0x0000006d, 0x00040005, 0x00000392, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000394, 0x61726170, 0x0000006d, 0x00040005, 0x00000396, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000398, 0x61726170, 0x0000006d, 0x00040005, 0x0000039a, 0x61726170,
-    0x0000006d, 0x00060005, 0x000003df, 0x5778614d, 0x546b726f, 0x73656c69, 0x00000000, 0x00040047,
-    0x000000a9, 0x00000006, 0x00000010, 0x00050048, 0x000000ac, 0x00000000, 0x00000023, 0x00000000,
-    0x00050048, 0x000000ac, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x000000ac, 0x00000002,
-    0x00000023, 0x00000008, 0x00050048, 0x000000ac, 0x00000003, 0x00000023, 0x0000000c, 0x00050048,
-    0x000000ac, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x000000ac, 0x00000005, 0x00000023,
-    0x00000230, 0x00050048, 0x000000ac, 0x00000006, 0x00000023, 0x00000234, 0x00050048, 0x000000ac,
-    0x00000007, 0x00000023, 0x00000238, 0x00050048, 0x000000ac, 0x00000008, 0x00000023, 0x0000023c,
-    0x00050048, 0x000000ac, 0x00000009, 0x00000023, 0x00000240, 0x00050048, 0x000000ac, 0x0000000a,
-    0x00000023, 0x00000244, 0x00050048, 0x000000ac, 0x0000000b, 0x00000023, 0x00000248, 0x00030047,
-    0x000000ac, 0x00000002, 0x00040047, 0x000000ae, 0x00000022, 0x00000000, 0x00040047, 0x000000ae,
-    0x00000021, 0x00000000, 0x00040047, 0x000000d9, 0x0000000b, 0x0000001b, 0x00040047, 0x000000fe,
-    0x00000006, 0x00000010, 0x00040047, 0x000000ff, 0x00000006, 0x00000004, 0x00040047, 0x00000100,
-    0x00000006, 0x00000004, 0x00040047, 0x00000101, 0x00000006, 0x00000004, 0x00050048, 0x00000102,
-    0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000102, 0x00000001, 0x00000023, 0x00008000,
-    0x00050048, 0x00000102, 0x00000002, 0x00000023, 0x0000a000, 0x00050048, 0x00000102, 0x00000003,
-    0x00000023, 0x0000c000, 0x00050048, 0x00000102, 0x00000004, 0x00000023, 0x0000c010, 0x00030047,
-    0x00000102, 0x00000002, 0x00040047, 0x00000104, 0x00000022, 0x00000000, 0x00040047, 0x00000104,
-    0x00000021, 0x00000008, 0x00040047, 0x00000107, 0x00000001, 0x00000000, 0x00040047, 0x00000109,
-    0x00000001, 0x00000001, 0x00040047, 0x00000136, 0x00000006, 0x00000004, 0x00050048, 0x00000137,
-    0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000137, 0x00000002, 0x00040047, 0x00000139,
-    0x00000022, 0x00000000, 0x00040047, 0x00000139, 0x00000021, 0x00000004, 0x00050048, 0x00000141,
-    0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000141, 0x00000001, 0x00000023, 0x00000004,
-    0x00050048, 0x00000141, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x00000141, 0x00000003,
-    0x00000023, 0x0000000c, 0x00050048, 0x00000141, 0x00000004, 0x00000023, 0x00000010, 0x00050048,
-    0x00000141, 0x00000005, 0x00000023, 0x00000014, 0x00050048, 0x00000141, 0x00000006, 0x00000023,
-    0x00000018, 0x00050048, 0x00000141, 0x00000007, 0x00000023, 0x0000001c, 0x00030047, 0x00000141,
-    0x00000002, 0x00050048, 0x00000153, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000153,
-    0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x00000153, 0x00000002, 0x00000023, 0x00000008,
-    0x00050048, 0x00000153, 0x00000003, 0x00000023, 0x0000000c, 0x00050048, 0x00000153, 0x00000004,
-    0x00000023, 0x00000010, 0x00050048, 0x00000153, 0x00000005, 0x00000023, 0x00000014, 0x00050048,
-    0x00000153, 0x00000006, 0x00000023, 0x00000018, 0x00050048, 0x00000153, 0x00000007, 0x00000023,
-    0x0000001c, 0x00050048, 0x00000153, 0x00000008, 0x00000023, 0x00000020, 0x00050048, 0x00000153,
-    0x00000009, 0x00000023, 0x00000024, 0x00050048, 0x00000153, 0x0000000a, 0x00000023, 0x00000028,
-    0x00040047, 0x00000154, 0x00000006, 0x0000002c, 0x00040048, 0x00000155, 0x00000000, 0x00000018,
-    0x00050048, 0x00000155, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000155, 0x00000002,
-    0x00040047, 0x00000157, 0x00000022, 0x00000000, 0x00040047, 0x00000157, 0x00000021, 0x00000001,
-    0x00040047, 0x00000170, 0x00000006, 0x00000004, 0x00050048, 0x00000171, 0x00000000, 0x00000023,
-    0x00000000, 0x00030047, 0x00000171, 0x00000002, 0x00040047, 0x00000173, 0x00000022, 0x00000000,
-    0x00040047, 0x00000173, 0x00000021, 0x00000005, 0x00040047, 0x00000178, 0x00000006, 0x00000004,
-    0x00050048, 0x00000179, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000179, 0x00000002,
-    0x00040047, 0x0000017b, 0x00000022, 0x00000000, 0x00040047, 0x0000017b, 0x00000021, 0x00000006,
-    0x00040047, 0x0000029a, 0x0000000b, 0x0000001a, 0x00040047, 0x000002b2, 0x0000000b, 0x0000001c,
-    0x00040047, 0x000002d0, 0x00000006, 0x00000004, 0x00050048, 0x000002d1, 0x00000000, 0x00000023,
-    0x00000000, 0x00030047, 0x000002d1, 0x00000002, 0x00040047, 0x000002d3, 0x00000022, 0x00000000,
-    0x00040047, 0x000002d3, 0x00000021, 0x00000007, 0x00040047, 0x00000309, 0x00000006, 0x00000004,
-    0x00050048, 0x0000030a, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x0000030a, 0x00000002,
-    0x00040047, 0x0000030c, 0x00000022, 0x00000000, 0x00040047, 0x0000030c, 0x00000021, 0x00000010,
-    0x00040047, 0x00000316, 0x00000006, 0x00000004, 0x00050048, 0x00000317, 0x00000000, 0x00000023,
-    0x00000000, 0x00030047, 0x00000317, 0x00000002, 0x00040047, 0x00000319, 0x00000022, 0x00000000,
-    0x00040047, 0x00000319, 0x00000021, 0x0000000f, 0x00040047, 0x00000343, 0x00000022, 0x00000001,
-    0x00040047, 0x00000343, 0x00000021, 0x00000003, 0x00040047, 0x0000034a, 0x00000022, 0x00000001,
-    0x00040047, 0x0000034a, 0x00000021, 0x00000004, 0x00040047, 0x000003df, 0x00000001, 0x00000002,
-    0x00040047, 0x000003e2, 0x0000000b, 0x00000019, 0x00020013, 0x00000002, 0x00030021, 0x00000003,
-    0x00000002, 0x00020014, 0x00000006, 0x00040020, 0x00000007, 0x00000007, 0x00000006, 0x00040015,
-    0x00000008, 0x00000020, 0x00000000, 0x00040020, 0x00000009, 0x00000007, 0x00000008, 0x00080021,
-    0x0000000a, 0x00000006, 0x00000007, 0x00000007, 0x00000009, 0x00000009, 0x00000009, 0x000c0021,
-    0x00000012, 0x00000002, 0x00000009, 0x00000009, 0x00000009, 0x00000007, 0x00000009, 0x00000009,
-    0x00000009, 0x00000009, 0x00000007, 0x00040015, 0x0000001e, 0x00000020, 0x00000001, 0x00040020,
-    0x0000001f, 0x00000007, 0x0000001e, 0x00040017, 0x00000020, 0x00000008, 0x00000002, 0x00040020,
-    0x00000021, 0x00000007, 0x00000020, 0x000d0021, 0x00000022, 0x00000002, 0x0000001f, 0x00000009,
-    0x00000009, 0x00000021, 0x00000021, 0x00000021, 0x00000021, 0x00000007, 0x00000009, 0x00000007,
-    0x0004002b, 0x00000008, 0x00000035, 0x000000ff, 0x0004002b, 0x00000008, 0x00000037, 0x000001fe,
-    0x0004002b, 0x00000008, 0x0000003e, 0x00400010, 0x0004002b, 0x00000008, 0x00000040, 0x00000010,
-    0x0004002b, 0x00000008, 0x00000052, 0x0000e0f0, 0x0004002b, 0x0000001e, 0x00000055, 0x00000008,
-    0x0004002b, 0x00000008, 0x00000057, 0x00ff0000, 0x0004002b, 0x00000008, 0x0000005a, 0x00400000,
-    0x0004002b, 0x00000008, 0x0000005d, 0xff001f0f, 0x0004002b, 0x00000008, 0x00000067, 0x00000000,
-    0x0004002b, 0x00000008, 0x0000006e, 0x007f0000, 0x0004002b, 0x00000008, 0x00000075, 0x3f000000,
-    0x0004002b, 0x00000008, 0x00000082, 0x00008000, 0x0004002b, 0x00000008, 0x00000087, 0xffff7fff,
-    0x0004002b, 0x00000008, 0x0000008d, 0x003f003f, 0x0004002b, 0x00000008, 0x00000091, 0x00003f00,
-    0x0004002b, 0x00000008, 0x0000009b, 0x1f000000, 0x0004002b, 0x0000001e, 0x0000009f, 0x00000018,
-    0x0004002b, 0x00000008, 0x000000a1, 0x00000001, 0x00040017, 0x000000a7, 0x00000008, 0x00000004,
-    0x0004002b, 0x00000008, 0x000000a8, 0x00000022, 0x0004001c, 0x000000a9, 0x000000a7, 0x000000a8,
-    0x00030016, 0x000000aa, 0x00000020, 0x00040017, 0x000000ab, 0x000000aa, 0x00000002, 0x000e001e,
-    0x000000ac, 0x00000008, 0x00000008, 0x0000001e, 0x00000008, 0x000000a9, 0x00000008, 0x00000008,
-    0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x000000ab, 0x00040020, 0x000000ad, 0x00000002,
-    0x000000ac, 0x0004003b, 0x000000ad, 0x000000ae, 0x00000002, 0x0004002b, 0x0000001e, 0x000000af,
-    0x00000003, 0x00040020, 0x000000b0, 0x00000002, 0x00000008, 0x0004002b, 0x00000008, 0x000000b3,
-    0x00000008, 0x0004002b, 0x00000008, 0x000000bd, 0x00000020, 0x0004002b, 0x0000001e, 0x000000c2,
-    0x00000005, 0x00040017, 0x000000d7, 0x00000008, 0x00000003, 0x00040020, 0x000000d8, 0x00000001,
-    0x000000d7, 0x0004003b, 0x000000d8, 0x000000d9, 0x00000001, 0x00040020, 0x000000da, 0x00000001,
-    0x00000008, 0x0004002b, 0x0000001e, 0x000000f5, 0x00000040, 0x0004002b, 0x00000008, 0x000000fd,
-    0x00000800, 0x0004001c, 0x000000fe, 0x000000a7, 0x000000fd, 0x0004001c, 0x000000ff, 0x00000008,
-    0x000000fd, 0x0004001c, 0x00000100, 0x00000008, 0x000000fd, 0x0003001d, 0x00000101, 0x00000008,
-    0x0007001e, 0x00000102, 0x000000fe, 0x000000ff, 0x00000100, 0x000000a7, 0x00000101, 0x00040020,
-    0x00000103, 0x0000000c, 0x00000102, 0x0004003b, 0x00000103, 0x00000104, 0x0000000c, 0x0004002b,
-    0x0000001e, 0x00000105, 0x00000004, 0x0004002b, 0x0000001e, 0x00000106, 0x00000000, 0x00040032,
-    0x0000001e, 0x00000107, 0x00000100, 0x00060034, 0x0000001e, 0x00000108, 0x00000087, 0x00000107,
-    0x00000055, 0x00040032, 0x0000001e, 0x00000109, 0x000000c0, 0x00060034, 0x0000001e, 0x0000010a,
-    0x00000087, 0x00000109, 0x00000055, 0x00060034, 0x0000001e, 0x0000010b, 0x00000084, 0x00000108,
-    0x0000010a, 0x0004002b, 0x0000001e, 0x0000010c, 0x00000002, 0x00060034, 0x0000001e, 0x0000010d,
-    0x00000084, 0x0000010b, 0x0000010c, 0x00060034, 0x0000001e, 0x0000010e, 0x00000080, 0x00000106,
-    0x0000010d, 0x00060034, 0x00000008, 0x0000010f, 0x00000080, 0x0000010e, 0x00000067, 0x00040020,
-    0x00000112, 0x0000000c, 0x00000008, 0x00060034, 0x0000001e, 0x00000116, 0x00000084, 0x00000108,
-    0x0000010a, 0x00060034, 0x0000001e, 0x00000117, 0x00000084, 0x00000116, 0x000000f5, 0x00060034,
-    0x0000001e, 0x00000118, 0x00000080, 0x0000010e, 0x00000117, 0x00060034, 0x00000008, 0x00000119,
-    0x00000080, 0x00000118, 0x00000067, 0x0003001d, 0x00000136, 0x00000008, 0x0003001e, 0x00000137,
-    0x00000136, 0x00040020, 0x00000138, 0x0000000c, 0x00000137, 0x0004003b, 0x00000138, 0x00000139,
-    0x0000000c, 0x0004002b, 0x0000001e, 0x0000013e, 0x00000001, 0x000a001e, 0x00000141, 0x00000008,
-    0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x0000001e, 0x00000008, 0x00040020,
-    0x00000142, 0x00000009, 0x00000141, 0x0004003b, 0x00000142, 0x00000143, 0x00000009, 0x00040020,
-    0x00000144, 0x00000009, 0x00000008, 0x000d001e, 0x00000153, 0x0000001e, 0x0000001e, 0x0000001e,
-    0x0000001e, 0x0000001e, 0x0000001e, 0x0000001e, 0x0000001e, 0x00000008, 0x000000aa, 0x00000008,
-    0x0003001d, 0x00000154, 0x00000153, 0x0003001e, 0x00000155, 0x00000154, 0x00040020, 0x00000156,
-    0x0000000c, 0x00000155, 0x0004003b, 0x00000156, 0x00000157, 0x0000000c, 0x0004002b, 0x0000001e,
-    0x0000015d, 0x0000000a, 0x0004002b, 0x00000008, 0x00000163, 0x3f000030, 0x0004002b, 0x00000008,
-    0x00000165, 0x00000030, 0x0004002b, 0x00000008, 0x0000016c, 0x00004000, 0x0003001d, 0x00000170,
-    0x00000008, 0x0003001e, 0x00000171, 0x00000170, 0x00040020, 0x00000172, 0x0000000c, 0x00000171,
-    0x0004003b, 0x00000172, 0x00000173, 0x0000000c, 0x0003001d, 0x00000178, 0x00000008, 0x0003001e,
-    0x00000179, 0x00000178, 0x00040020, 0x0000017a, 0x0000000c, 0x00000179, 0x0004003b, 0x0000017a,
-    0x0000017b, 0x0000000c, 0x0003002a, 0x00000006, 0x0000018b, 0x00030029, 0x00000006, 0x00000199,
-    0x0004002b, 0x00000008, 0x0000019b, 0x00000002, 0x0004002b, 0x00000008, 0x000001a0, 0xfffffffc,
-    0x0004002b, 0x00000008, 0x000001bd, 0x0000000f, 0x0004002b, 0x00000008, 0x000001d9, 0x3f008000,
-    0x0004002b, 0x00000008, 0x0000021f, 0x80000000, 0x0004003b, 0x000000d8, 0x0000029a, 0x00000001,
-    0x00060034, 0x00000008, 0x0000029f, 0x00000080, 0x00000108, 0x00000067, 0x0004003b, 0x000000d8,
-    0x000002b2, 0x00000001, 0x0004002b, 0x00000008, 0x000002bc, 0xffffffff, 0x0005002c, 0x00000020,
-    0x000002bd, 0x000002bc, 0x000002bc, 0x0004002b, 0x0000001e, 0x000002bf, 0x00000100, 0x00060034,
-    0x00000006, 0x000002c0, 0x000000aa, 0x00000107, 0x000002bf, 0x0003001d, 0x000002d0, 0x00000008,
-    0x0003001e, 0x000002d1, 0x000002d0, 0x00040020, 0x000002d2, 0x0000000c, 0x000002d1, 0x0004003b,
-    0x000002d2, 0x000002d3, 0x0000000c, 0x00060034, 0x0000001e, 0x000002dc, 0x00000084, 0x00000107,
-    0x00000109, 0x00060034, 0x00000008, 0x000002dd, 0x00000080, 0x000002dc, 0x00000067, 0x00060034,
-    0x0000001e, 0x000002e3, 0x00000084, 0x00000107, 0x00000109, 0x00060034, 0x0000001e, 0x000002e4,
-    0x00000084, 0x000002e3, 0x0000010c, 0x00060034, 0x00000008, 0x000002e5, 0x00000080, 0x000002e4,
-    0x00000067, 0x00060034, 0x00000008, 0x000002e6, 0x00000080, 0x00000067, 0x000002e5, 0x00060034,
-    0x00000008, 0x000002ef, 0x00000080, 0x000002dc, 0x00000067, 0x00060034, 0x0000001e, 0x000002f5,
-    0x00000084, 0x00000107, 0x00000109, 0x00060034, 0x0000001e, 0x000002f6, 0x00000084, 0x000002f5,
-    0x0000010c, 0x00060034, 0x00000008, 0x000002f7, 0x00000080, 0x000002f6, 0x00000067, 0x00060034,
-    0x00000008, 0x000002f8, 0x00000080, 0x000002e6, 0x000002f7, 0x00060034, 0x00000008, 0x00000301,
-    0x00000080, 0x000002dc, 0x00000067, 0x0003001d, 0x00000309, 0x00000008, 0x0003001e, 0x0000030a,
-    0x00000309, 0x00040020, 0x0000030b, 0x0000000c, 0x0000030a, 0x0004003b, 0x0000030b, 0x0000030c,
-    0x0000000c, 0x0003001d, 0x00000316, 0x00000008, 0x0003001e, 0x00000317, 0x00000316, 0x00040020,
-    0x00000318, 0x0000000c, 0x00000317, 0x0004003b, 0x00000318, 0x00000319, 0x0000000c, 0x0004002b,
-    0x00000008, 0x0000031e, 0x00000003, 0x0004002b, 0x00000008, 0x00000321, 0x00000004, 0x0004002b,
-    0x0000001e, 0x0000032b, 0x00000007, 0x00040020, 0x0000032f, 0x00000007, 0x000000aa, 0x0004002b,
-    0x000000aa, 0x00000331, 0x3f800000, 0x00040020, 0x00000334, 0x00000007, 0x000000ab, 0x0004002b,
-    0x0000001e, 0x0000033b, 0x0000000b, 0x00040020, 0x0000033c, 0x00000002, 0x000000ab, 0x00090019,
-    0x00000340, 0x00000008, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000,
-    0x0003001b, 0x00000341, 0x00000340, 0x00040020, 0x00000342, 0x00000000, 0x00000341, 0x0004003b,
-    0x00000342, 0x00000343, 0x00000000, 0x0004002b, 0x000000aa, 0x00000346, 0x00000000, 0x0004003b,
-    0x00000342, 0x0000034a, 0x00000000, 0x0004002b, 0x0000001e, 0x00000355, 0x00000009, 0x0004002b,
-    0x00000008, 0x0000035a, 0x00ffffff, 0x0004002b, 0x0000001e, 0x00000363, 0x00000006, 0x00060034,
-    0x00000008, 0x000003ac, 0x00000080, 0x000002dc, 0x00000067, 0x00060034, 0x00000008, 0x000003ba,
-    0x00000080, 0x000002dc, 0x00000067, 0x00060034, 0x00000008, 0x000003c8, 0x00000080, 0x000002dc,
-    0x00000067, 0x00040032, 0x0000001e, 0x000003df, 0x00003000, 0x0004002b, 0x0000001e, 0x000003e0,
-    0x00000020, 0x0004002b, 0x0000001e, 0x000003e1, 0x00000800, 0x0006002c, 0x000000d7, 0x000003e2,
-    0x000000b3, 0x000000b3, 0x000000a1, 0x00050036, 0x00000002, 0x00000004, 0x00000000, 0x00000003,
-    0x000200f8, 0x00000005, 0x0004003b, 0x0000001f, 0x00000299, 0x00000007, 0x0004003b, 0x00000009,
-    0x000002a3, 0x00000007, 0x0004003b, 0x00000009, 0x000002aa, 0x00000007, 0x0004003b, 0x0000001f,
-    0x000002b1, 0x00000007, 0x0004003b, 0x00000021, 0x000002bb, 0x00000007, 0x0004003b, 0x00000007,
-    0x000002be, 0x00000007, 0x0004003b, 0x00000009, 0x000002c8, 0x00000007, 0x0004003b, 0x00000007,
-    0x000002c9, 0x00000007, 0x0004003b, 0x00000021, 0x000002cf, 0x00000007, 0x0004003b, 0x00000021,
-    0x000002e2, 0x00000007, 0x0004003b, 0x00000021, 0x000002f4, 0x00000007, 0x0004003b, 0x00000009,
-    0x00000315, 0x00000007, 0x0004003b, 0x0000032f, 0x00000330, 0x00000007, 0x0004003b, 0x00000334,
-    0x00000335, 0x00000007, 0x0004003b, 0x0000001f, 0x0000036f, 0x00000007, 0x0004003b, 0x00000009,
-    0x00000371, 0x00000007, 0x0004003b, 0x00000009, 0x00000373, 0x00000007, 0x0004003b, 0x00000021,
-    0x00000374, 0x00000007, 0x0004003b, 0x00000021, 0x00000376, 0x00000007, 0x0004003b, 0x00000021,
-    0x00000378, 0x00000007, 0x0004003b, 0x00000021, 0x0000037a, 0x00000007, 0x0004003b, 0x00000007,
-    0x0000037c, 0x00000007, 0x0004003b, 0x00000009, 0x0000037e, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000380, 0x00000007, 0x0004003b, 0x0000001f, 0x00000389, 0x00000007, 0x0004003b, 0x00000009,
-    0x0000038b, 0x00000007, 0x0004003b, 0x00000009, 0x0000038d, 0x00000007, 0x0004003b, 0x00000021,
-    0x0000038e, 0x00000007, 0x0004003b, 0x00000021, 0x00000390, 0x00000007, 0x0004003b, 0x00000021,
-    0x00000392, 0x00000007, 0x0004003b, 0x00000021, 0x00000394, 0x00000007, 0x0004003b, 0x00000007,
-    0x00000396, 0x00000007, 0x0004003b, 0x00000009, 0x00000398, 0x00000007, 0x0004003b, 0x00000007,
-    0x0000039a, 0x00000007, 0x00050041, 0x000000da, 0x0000029b, 0x0000029a, 0x00000067, 0x0004003d,
-    0x00000008, 0x0000029c, 0x0000029b, 0x00050041, 0x000000da, 0x0000029d, 0x0000029a, 0x000000a1,
-    0x0004003d, 0x00000008, 0x0000029e, 0x0000029d, 0x00050084, 0x00000008, 0x000002a0, 0x0000029e,
-    0x0000029f, 0x00050080, 0x00000008, 0x000002a1, 0x0000029c, 0x000002a0, 0x0004007c, 0x0000001e,
-    0x000002a2, 0x000002a1, 0x0003003e, 0x00000299, 0x000002a2, 0x0004003d, 0x0000001e, 0x000002a4,
-    0x00000299, 0x00050084, 0x0000001e, 0x000002a5, 0x000002a4, 0x0000010c, 0x00050080, 0x0000001e,
-    0x000002a6, 0x00000106, 0x000002a5, 0x00050080, 0x0000001e, 0x000002a7, 0x000002a6, 0x00000106,
-    0x00060041, 0x00000112, 0x000002a8, 0x00000104, 0x00000105, 0x000002a7, 0x0004003d, 0x00000008,
-    0x000002a9, 0x000002a8, 0x0003003e, 0x000002a3, 0x000002a9, 0x0004003d, 0x0000001e, 0x000002ab,
-    0x00000299, 0x00050084, 0x0000001e, 0x000002ac, 0x000002ab, 0x0000010c, 0x00050080, 0x0000001e,
-    0x000002ad, 0x00000106, 0x000002ac, 0x00050080, 0x0000001e, 0x000002ae, 0x000002ad, 0x0000013e,
-    0x00060041, 0x00000112, 0x000002af, 0x00000104, 0x00000105, 0x000002ae, 0x0004003d, 0x00000008,
-    0x000002b0, 0x000002af, 0x0003003e, 0x000002aa, 0x000002b0, 0x00050041, 0x000000da, 0x000002b3,
-    0x000002b2, 0x00000067, 0x0004003d, 0x00000008, 0x000002b4, 0x000002b3, 0x0004007c, 0x0000001e,
-    0x000002b5, 0x000002b4, 0x00050041, 0x000000da, 0x000002b6, 0x000002b2, 0x000000a1, 0x0004003d,
-    0x00000008, 0x000002b7, 0x000002b6, 0x0004007c, 0x0000001e, 0x000002b8, 0x000002b7, 0x00050084,
-    0x0000001e, 0x000002b9, 0x000002b8, 0x00000107, 0x00050080, 0x0000001e, 0x000002ba, 0x000002b5,
-    0x000002b9, 0x0003003e, 0x000002b1, 0x000002ba, 0x0003003e, 0x000002bb, 0x000002bd, 0x000300f7,
-    0x000002c2, 0x00000000, 0x000400fa, 0x000002c0, 0x000002c1, 0x000002c2, 0x000200f8, 0x000002c1,
-    0x00050041, 0x000000b0, 0x000002c3, 0x000000ae, 0x000000af, 0x0004003d, 0x00000008, 0x000002c4,
-    0x000002c3, 0x000500c7, 0x00000008, 0x000002c5, 0x000002c4, 0x00000040, 0x000500ab, 0x00000006,
-    0x000002c6, 0x000002c5, 0x00000067, 0x000200f9, 0x000002c2, 0x000200f8, 0x000002c2, 0x000700f5,
-    0x00000006, 0x000002c7, 0x000002c0, 0x00000005, 0x000002c6, 0x000002c1, 0x0003003e, 0x000002be,
-    0x000002c7, 0x0003003e, 0x000002c8, 0x00000067, 0x0003003e, 0x000002c9, 0x0000018b, 0x00050041,
-    0x00000144, 0x000002ca, 0x00000143, 0x0000010c, 0x0004003d, 0x00000008, 0x000002cb, 0x000002ca,
-    0x000500ab, 0x00000006, 0x000002cc, 0x000002cb, 0x00000067, 0x000300f7, 0x000002ce, 0x00000000,
-    0x000400fa, 0x000002cc, 0x000002cd, 0x00000324, 0x000200f8, 0x000002cd, 0x0004003d, 0x0000001e,
-    0x000002d4, 0x000002b1, 0x0004007c, 0x00000008, 0x000002d5, 0x000002d4, 0x00050080, 0x00000008,
-    0x000002d6, 0x00000067, 0x000002d5, 0x00060041, 0x00000112, 0x000002d7, 0x000002d3, 0x00000106,
-    0x000002d6, 0x0004003d, 0x00000008, 0x000002d8, 0x000002d7, 0x0004003d, 0x0000001e, 0x000002d9,
-    0x000002b1, 0x0004007c, 0x00000008, 0x000002da, 0x000002d9, 0x00050080, 0x00000008, 0x000002db,
-    0x00000067, 0x000002da, 0x00050080, 0x00000008, 0x000002de, 0x000002db, 0x000002dd, 0x00060041,
-    0x00000112, 0x000002df, 0x000002d3, 0x00000106, 0x000002de, 0x0004003d, 0x00000008, 0x000002e0,
-    0x000002df, 0x00050050, 0x00000020, 0x000002e1, 0x000002d8, 0x000002e0, 0x0003003e, 0x000002cf,
-    0x000002e1, 0x0004003d, 0x0000001e, 0x000002e7, 0x000002b1, 0x0004007c, 0x00000008, 0x000002e8,
-    0x000002e7, 0x00050080, 0x00000008, 0x000002e9, 0x000002e6, 0x000002e8, 0x00060041, 0x00000112,
-    0x000002ea, 0x000002d3, 0x00000106, 0x000002e9, 0x0004003d, 0x00000008, 0x000002eb, 0x000002ea,
-    0x0004003d, 0x0000001e, 0x000002ec, 0x000002b1, 0x0004007c, 0x00000008, 0x000002ed, 0x000002ec,
-    0x00050080, 0x00000008, 0x000002ee, 0x000002e6, 0x000002ed, 0x00050080, 0x00000008, 0x000002f0,
-    0x000002ee, 0x000002ef, 0x00060041, 0x00000112, 0x000002f1, 0x000002d3, 0x00000106, 0x000002f0,
-    0x0004003d, 0x00000008, 0x000002f2, 0x000002f1, 0x00050050, 0x00000020, 0x000002f3, 0x000002eb,
-    0x000002f2, 0x0003003e, 0x000002e2, 0x000002f3, 0x0004003d, 0x0000001e, 0x000002f9, 0x000002b1,
-    0x0004007c, 0x00000008, 0x000002fa, 0x000002f9, 0x00050080, 0x00000008, 0x000002fb, 0x000002f8,
-    0x000002fa, 0x00060041, 0x00000112, 0x000002fc, 0x000002d3, 0x00000106, 0x000002fb, 0x0004003d,
-    0x00000008, 0x000002fd, 0x000002fc, 0x0004003d, 0x0000001e, 0x000002fe, 0x000002b1, 0x0004007c,
-    0x00000008, 0x000002ff, 0x000002fe, 0x00050080, 0x00000008, 0x00000300, 0x000002f8, 0x000002ff,
-    0x00050080, 0x00000008, 0x00000302, 0x00000300, 0x00000301, 0x00060041, 0x00000112, 0x00000303,
-    0x000002d3, 0x00000106, 0x00000302, 0x0004003d, 0x00000008, 0x00000304, 0x00000303, 0x00050050,
-    0x00000020, 0x00000305, 0x000002fd, 0x00000304, 0x0003003e, 0x000002f4, 0x00000305, 0x0004003d,
-    0x00000006, 0x00000306, 0x000002be, 0x000300f7, 0x00000308, 0x00000000, 0x000400fa, 0x00000306,
-    0x00000307, 0x00000308, 0x000200f8, 0x00000307, 0x0004003d, 0x0000001e, 0x0000030d, 0x000002b1,
-    0x00060041, 0x00000112, 0x0000030e, 0x0000030c, 0x00000106, 0x0000030d, 0x0004003d, 0x00000008,
-    0x0000030f, 0x0000030e, 0x0004003d, 0x0000001e, 0x00000310, 0x000002b1, 0x00050080, 0x0000001e,
-    0x00000311, 0x00000310, 0x000002dc, 0x00060041, 0x00000112, 0x00000312, 0x0000030c, 0x00000106,
-    0x00000311, 0x0004003d, 0x00000008, 0x00000313, 0x00000312, 0x00050050, 0x00000020, 0x00000314,
-    0x0000030f, 0x00000313, 0x0003003e, 0x000002bb, 0x00000314, 0x000200f9, 0x00000308, 0x000200f8,
-    0x00000308, 0x0004003d, 0x0000001e, 0x0000031a, 0x000002b1, 0x00060041, 0x00000112, 0x0000031b,
-    0x00000319, 0x00000106, 0x0000031a, 0x0004003d, 0x00000008, 0x0000031c, 0x0000031b, 0x0003003e,
-    0x00000315, 0x0000031c, 0x0004003d, 0x00000008, 0x0000031d, 0x00000315, 0x000500c7, 0x00000008,
-    0x0000031f, 0x0000031d, 0x0000031e, 0x0003003e, 0x000002c8, 0x0000031f, 0x0004003d, 0x00000008,
-    0x00000320, 0x00000315, 0x000500c7, 0x00000008, 0x00000322, 0x00000320, 0x00000321, 0x000500ab,
-    0x00000006, 0x00000323, 0x00000322, 0x00000067, 0x0003003e, 0x000002c9, 0x00000323, 0x000200f9,
-    0x000002ce, 0x000200f8, 0x00000324, 0x00050041, 0x000000b0, 0x00000325, 0x000000ae, 0x000000af,
-    0x0004003d, 0x00000008, 0x00000326, 0x00000325, 0x000500c7, 0x00000008, 0x00000327, 0x00000326,
-    0x0000016c, 0x000500ab, 0x00000006, 0x00000328, 0x00000327, 0x00000067, 0x000300f7, 0x0000032a,
-    0x00000000, 0x000400fa, 0x00000328, 0x00000329, 0x0000035f, 0x000200f8, 0x00000329, 0x00050041,
-    0x000000b0, 0x0000032c, 0x000000ae, 0x0000032b, 0x0004003d, 0x00000008, 0x0000032d, 0x0000032c,
-    0x00050050, 0x00000020, 0x0000032e, 0x0000032d, 0x00000067, 0x0003003e, 0x000002f4, 0x0000032e,
-    0x0004006f, 0x000000aa, 0x00000332, 0x00000107, 0x00050088, 0x000000aa, 0x00000333, 0x00000331,
-    0x00000332, 0x0003003e, 0x00000330, 0x00000333, 0x0004003d, 0x000000d7, 0x00000336, 0x000002b2,
-    0x0007004f, 0x00000020, 0x00000337, 0x00000336, 0x00000336, 0x00000000, 0x00000001, 0x00040070,
-    0x000000ab, 0x00000338, 0x00000337, 0x0004003d, 0x000000aa, 0x00000339, 0x00000330, 0x0005008e,
-    0x000000ab, 0x0000033a, 0x00000338, 0x00000339, 0x00050041, 0x0000033c, 0x0000033d, 0x000000ae,
-    0x0000033b, 0x0004003d, 0x000000ab, 0x0000033e, 0x0000033d, 0x00050081, 0x000000ab, 0x0000033f,
-    0x0000033a, 0x0000033e, 0x0003003e, 0x00000335, 0x0000033f, 0x0004003d, 0x00000341, 0x00000344,
-    0x00000343, 0x0004003d, 0x000000ab, 0x00000345, 0x00000335, 0x00070058, 0x000000a7, 0x00000347,
-    0x00000344, 0x00000345, 0x00000002, 0x00000346, 0x00050051, 0x00000008, 0x00000348, 0x00000347,
-    0x00000000, 0x00050050, 0x00000020, 0x00000349, 0x00000348, 0x00000067, 0x0003003e, 0x000002cf,
-    0x00000349, 0x0004003d, 0x00000341, 0x0000034b, 0x0000034a, 0x0004003d, 0x000000ab, 0x0000034c,
-    0x00000335, 0x00070058, 0x000000a7, 0x0000034d, 0x0000034b, 0x0000034c, 0x00000002, 0x00000346,
-    0x00050051, 0x00000008, 0x0000034e, 0x0000034d, 0x00000000, 0x00050050, 0x00000020, 0x0000034f,
-    0x0000034e, 0x00000067, 0x0003003e, 0x000002e2, 0x0000034f, 0x00050041, 0x00000009, 0x00000350,
-    0x000002f4, 0x00000067, 0x0004003d, 0x00000008, 0x00000351, 0x00000350, 0x000500c7, 0x00000008,
-    0x00000352, 0x00000351, 0x00000087, 0x00050041, 0x00000009, 0x00000353, 0x000002e2, 0x00000067,
-    0x0004003d, 0x00000008, 0x00000354, 0x00000353, 0x000500c2, 0x00000008, 0x00000356, 0x00000354,
-    0x00000355, 0x000500c7, 0x00000008, 0x00000357, 0x00000356, 0x00000082, 0x000500c5, 0x00000008,
-    0x00000358, 0x00000352, 0x00000357, 0x00050041, 0x00000009, 0x00000359, 0x000002f4, 0x00000067,
-    0x0003003e, 0x00000359, 0x00000358, 0x00050041, 0x00000009, 0x0000035b, 0x000002e2, 0x00000067,
-    0x0004003d, 0x00000008, 0x0000035c, 0x0000035b, 0x000500c7, 0x00000008, 0x0000035d, 0x0000035c,
-    0x0000035a, 0x00050041, 0x00000009, 0x0000035e, 0x000002e2, 0x00000067, 0x0003003e, 0x0000035e,
-    0x0000035d, 0x000200f9, 0x0000032a, 0x000200f8, 0x0000035f, 0x00050041, 0x000000b0, 0x00000360,
-    0x000000ae, 0x000000c2, 0x0004003d, 0x00000008, 0x00000361, 0x00000360, 0x00050050, 0x00000020,
-    0x00000362, 0x00000361, 0x00000067, 0x0003003e, 0x000002cf, 0x00000362, 0x00050041, 0x000000b0,
-    0x00000364, 0x000000ae, 0x00000363, 0x0004003d, 0x00000008, 0x00000365, 0x00000364, 0x00050050,
-    0x00000020, 0x00000366, 0x00000365, 0x00000067, 0x0003003e, 0x000002e2, 0x00000366, 0x00050041,
-    0x000000b0, 0x00000367, 0x000000ae, 0x0000032b, 0x0004003d, 0x00000008, 0x00000368, 0x00000367,
-    0x00050050, 0x00000020, 0x00000369, 0x00000368, 0x00000067, 0x0003003e, 0x000002f4, 0x00000369,
-    0x000200f9, 0x0000032a, 0x000200f8, 0x0000032a, 0x000200f9, 0x000002ce, 0x000200f8, 0x000002ce,
-    0x00050041, 0x00000144, 0x0000036a, 0x00000143, 0x0000010c, 0x0004003d, 0x00000008, 0x0000036b,
-    0x0000036a, 0x000500aa, 0x00000006, 0x0000036c, 0x0000036b, 0x00000067, 0x000300f7, 0x0000036e,
-    0x00000000, 0x000400fa, 0x0000036c, 0x0000036d, 0x0000036e, 0x000200f8, 0x0000036d, 0x0003003e,
-    0x000002c8, 0x00000067, 0x0003003e, 0x000002c9, 0x0000018b, 0x000200f9, 0x0000036e, 0x000200f8,
-    0x0000036e, 0x0004003d, 0x0000001e, 0x00000370, 0x00000299, 0x0003003e, 0x0000036f, 0x00000370,
-    0x0004003d, 0x00000008, 0x00000372, 0x000002a3, 0x0003003e, 0x00000371, 0x00000372, 0x0003003e,
-    0x00000373, 0x00000067, 0x0004003d, 0x00000020, 0x00000375, 0x000002cf, 0x0003003e, 0x00000374,
-    0x00000375, 0x0004003d, 0x00000020, 0x00000377, 0x000002e2, 0x0003003e, 0x00000376, 0x00000377,
-    0x0004003d, 0x00000020, 0x00000379, 0x000002f4, 0x0003003e, 0x00000378, 0x00000379, 0x0004003d,
-    0x00000020, 0x0000037b, 0x000002bb, 0x0003003e, 0x0000037a, 0x0000037b, 0x0004003d, 0x00000006,
-    0x0000037d, 0x000002be, 0x0003003e, 0x0000037c, 0x0000037d, 0x0004003d, 0x00000008, 0x0000037f,
-    0x000002c8, 0x0003003e, 0x0000037e, 0x0000037f, 0x0004003d, 0x00000006, 0x00000381, 0x000002c9,
-    0x0003003e, 0x00000380, 0x00000381, 0x000e0039, 0x00000002, 0x00000382, 0x0000002d, 0x0000036f,
-    0x00000371, 0x00000373, 0x00000374, 0x00000376, 0x00000378, 0x0000037a, 0x0000037c, 0x0000037e,
-    0x00000380, 0x0004003d, 0x00000020, 0x00000383, 0x00000374, 0x0003003e, 0x000002cf, 0x00000383,
-    0x0004003d, 0x00000020, 0x00000384, 0x00000376, 0x0003003e, 0x000002e2, 0x00000384, 0x0004003d,
-    0x00000020, 0x00000385, 0x00000378, 0x0003003e, 0x000002f4, 0x00000385, 0x0004003d, 0x00000020,
-    0x00000386, 0x0000037a, 0x0003003e, 0x000002bb, 0x00000386, 0x0004003d, 0x00000008, 0x00000387,
-    0x0000037e, 0x0003003e, 0x000002c8, 0x00000387, 0x0004003d, 0x00000006, 0x00000388, 0x00000380,
-    0x0003003e, 0x000002c9, 0x00000388, 0x0004003d, 0x0000001e, 0x0000038a, 0x00000299, 0x0003003e,
-    0x00000389, 0x0000038a, 0x0004003d, 0x00000008, 0x0000038c, 0x000002aa, 0x0003003e, 0x0000038b,
-    0x0000038c, 0x0003003e, 0x0000038d, 0x000000bd, 0x0004003d, 0x00000020, 0x0000038f, 0x000002cf,
-    0x0003003e, 0x0000038e, 0x0000038f, 0x0004003d, 0x00000020, 0x00000391, 0x000002e2, 0x0003003e,
-    0x00000390, 0x00000391, 0x0004003d, 0x00000020, 0x00000393, 0x000002f4, 0x0003003e, 0x00000392,
-    0x00000393, 0x0004003d, 0x00000020, 0x00000395, 0x000002bb, 0x0003003e, 0x00000394, 0x00000395,
-    0x0004003d, 0x00000006, 0x00000397, 0x000002be, 0x0003003e, 0x00000396, 0x00000397, 0x0004003d,
-    0x00000008, 0x00000399, 0x000002c8, 0x0003003e, 0x00000398, 0x00000399, 0x0004003d, 0x00000006,
-    0x0000039b, 0x000002c9, 0x0003003e, 0x0000039a, 0x0000039b, 0x000e0039, 0x00000002, 0x0000039c,
-    0x0000002d, 0x00000389, 0x0000038b, 0x0000038d, 0x0000038e, 0x00000390, 0x00000392, 0x00000394,
-    0x00000396, 0x00000398, 0x0000039a, 0x0004003d, 0x00000020, 0x0000039d, 0x0000038e, 0x0003003e,
-    0x000002cf, 0x0000039d, 0x0004003d, 0x00000020, 0x0000039e, 0x00000390, 0x0003003e, 0x000002e2,
-    0x0000039e, 0x0004003d, 0x00000020, 0x0000039f, 0x00000392, 0x0003003e, 0x000002f4, 0x0000039f,
-    0x0004003d, 0x00000020, 0x000003a0, 0x00000394, 0x0003003e, 0x000002bb, 0x000003a0, 0x0004003d,
-    0x00000008, 0x000003a1, 0x00000398, 0x0003003e, 0x000002c8, 0x000003a1, 0x0004003d, 0x00000006,
-    0x000003a2, 0x0000039a, 0x0003003e, 0x000002c9, 0x000003a2, 0x0004003d, 0x0000001e, 0x000003a3,
-    0x000002b1, 0x0004007c, 0x00000008, 0x000003a4, 0x000003a3, 0x00050080, 0x00000008, 0x000003a5,
-    0x00000067, 0x000003a4, 0x00050041, 0x00000009, 0x000003a6, 0x000002cf, 0x00000067, 0x0004003d,
-    0x00000008, 0x000003a7, 0x000003a6, 0x00060041, 0x00000112, 0x000003a8, 0x000002d3, 0x00000106,
-    0x000003a5, 0x0003003e, 0x000003a8, 0x000003a7, 0x0004003d, 0x0000001e, 0x000003a9, 0x000002b1,
-    0x0004007c, 0x00000008, 0x000003aa, 0x000003a9, 0x00050080, 0x00000008, 0x000003ab, 0x00000067,
-    0x000003aa, 0x00050080, 0x00000008, 0x000003ad, 0x000003ab, 0x000003ac, 0x00050041, 0x00000009,
-    0x000003ae, 0x000002cf, 0x000000a1, 0x0004003d, 0x00000008, 0x000003af, 0x000003ae, 0x00060041,
-    0x00000112, 0x000003b0, 0x000002d3, 0x00000106, 0x000003ad, 0x0003003e, 0x000003b0, 0x000003af,
-    0x0004003d, 0x0000001e, 0x000003b1, 0x000002b1, 0x0004007c, 0x00000008, 0x000003b2, 0x000003b1,
-    0x00050080, 0x00000008, 0x000003b3, 0x000002e6, 0x000003b2, 0x00050041, 0x00000009, 0x000003b4,
-    0x000002e2, 0x00000067, 0x0004003d, 0x00000008, 0x000003b5, 0x000003b4, 0x00060041, 0x00000112,
-    0x000003b6, 0x000002d3, 0x00000106, 0x000003b3, 0x0003003e, 0x000003b6, 0x000003b5, 0x0004003d,
-    0x0000001e, 0x000003b7, 0x000002b1, 0x0004007c, 0x00000008, 0x000003b8, 0x000003b7, 0x00050080,
-    0x00000008, 0x000003b9, 0x000002e6, 0x000003b8, 0x00050080, 0x00000008, 0x000003bb, 0x000003b9,
-    0x000003ba, 0x00050041, 0x00000009, 0x000003bc, 0x000002e2, 0x000000a1, 0x0004003d, 0x00000008,
-    0x000003bd, 0x000003bc, 0x00060041, 0x00000112, 0x000003be, 0x000002d3, 0x00000106, 0x000003bb,
-    0x0003003e, 0x000003be, 0x000003bd, 0x0004003d, 0x0000001e, 0x000003bf, 0x000002b1, 0x0004007c,
-    0x00000008, 0x000003c0, 0x000003bf, 0x00050080, 0x00000008, 0x000003c1, 0x000002f8, 0x000003c0,
-    0x00050041, 0x00000009, 0x000003c2, 0x000002f4, 0x00000067, 0x0004003d, 0x00000008, 0x000003c3,
-    0x000003c2, 0x00060041, 0x00000112, 0x000003c4, 0x000002d3, 0x00000106, 0x000003c1, 0x0003003e,
-    0x000003c4, 0x000003c3, 0x0004003d, 0x0000001e, 0x000003c5, 0x000002b1, 0x0004007c, 0x00000008,
-    0x000003c6, 0x000003c5, 0x00050080, 0x00000008, 0x000003c7, 0x000002f8, 0x000003c6, 0x00050080,
-    0x00000008, 0x000003c9, 0x000003c7, 0x000003c8, 0x00050041, 0x00000009, 0x000003ca, 0x000002f4,
-    0x000000a1, 0x0004003d, 0x00000008, 0x000003cb, 0x000003ca, 0x00060041, 0x00000112, 0x000003cc,
-    0x000002d3, 0x00000106, 0x000003c9, 0x0003003e, 0x000003cc, 0x000003cb, 0x0004003d, 0x00000006,
-    0x000003cd, 0x000002be, 0x000300f7, 0x000003cf, 0x00000000, 0x000400fa, 0x000003cd, 0x000003ce,
-    0x000003cf, 0x000200f8, 0x000003ce, 0x0004003d, 0x0000001e, 0x000003d0, 0x000002b1, 0x00050041,
-    0x00000009, 0x000003d1, 0x000002bb, 0x00000067, 0x0004003d, 0x00000008, 0x000003d2, 0x000003d1,
-    0x00060041, 0x00000112, 0x000003d3, 0x0000030c, 0x00000106, 0x000003d0, 0x0003003e, 0x000003d3,
-    0x000003d2, 0x0004003d, 0x0000001e, 0x000003d4, 0x000002b1, 0x00050080, 0x0000001e, 0x000003d5,
-    0x000003d4, 0x000002dc, 0x00050041, 0x00000009, 0x000003d6, 0x000002bb, 0x000000a1, 0x0004003d,
-    0x00000008, 0x000003d7, 0x000003d6, 0x00060041, 0x00000112, 0x000003d8, 0x0000030c, 0x00000106,
-    0x000003d5, 0x0003003e, 0x000003d8, 0x000003d7, 0x000200f9, 0x000003cf, 0x000200f8, 0x000003cf,
-    0x0004003d, 0x0000001e, 0x000003d9, 0x000002b1, 0x0004003d, 0x00000008, 0x000003da, 0x000002c8,
-    0x0004003d, 0x00000006, 0x000003db, 0x000002c9, 0x000600a9, 0x00000008, 0x000003dc, 0x000003db,
-    0x00000321, 0x00000067, 0x000500c5, 0x00000008, 0x000003dd, 0x000003da, 0x000003dc, 0x00060041,
-    0x00000112, 0x000003de, 0x00000319, 0x00000106, 0x000003d9, 0x0003003e, 0x000003de, 0x000003dd,
-    0x000100fd, 0x00010038, 0x00050036, 0x00000006, 0x00000010, 0x00000000, 0x0000000a, 0x00030037,
-    0x00000007, 0x0000000b, 0x00030037, 0x00000007, 0x0000000c, 0x00030037, 0x00000009, 0x0000000d,
-    0x00030037, 0x00000009, 0x0000000e, 0x00030037, 0x00000009, 0x0000000f, 0x000200f8, 0x00000011,
-    0x0004003b, 0x00000007, 0x00000043, 0x00000007, 0x0004003d, 0x00000006, 0x0000002f, 0x0000000b,
-    0x000300f7, 0x00000031, 0x00000000, 0x000400fa, 0x0000002f, 0x00000030, 0x00000031, 0x000200f8,
-    0x00000030, 0x0004003d, 0x00000008, 0x00000032, 0x0000000d, 0x0004003d, 0x00000008, 0x00000033,
-    0x0000000e, 0x00050082, 0x00000008, 0x00000034, 0x00000032, 0x00000033, 0x00050080, 0x00000008,
-    0x00000036, 0x00000034, 0x00000035, 0x000500b2, 0x00000006, 0x00000038, 0x00000036, 0x00000037,
-    0x000200fe, 0x00000038, 0x000200f8, 0x00000031, 0x0004003d, 0x00000006, 0x0000003a, 0x0000000c,
-    0x000300f7, 0x0000003c, 0x00000000, 0x000400fa, 0x0000003a, 0x0000003b, 0x0000003c, 0x000200f8,
-    0x0000003b, 0x0004003d, 0x00000008, 0x0000003d, 0x0000000f, 0x000500c7, 0x00000008, 0x0000003f,
-    0x0000003d, 0x0000003e, 0x000500aa, 0x00000006, 0x00000041, 0x0000003f, 0x00000040, 0x000200f9,
-    0x0000003c, 0x000200f8, 0x0000003c, 0x000700f5, 0x00000006, 0x00000042, 0x0000003a, 0x00000031,
-    0x00000041, 0x0000003b, 0x000300f7, 0x00000045, 0x00000000, 0x000400fa, 0x00000042, 0x00000044,
-    0x00000049, 0x000200f8, 0x00000044, 0x0004003d, 0x00000008, 0x00000046, 0x0000000e, 0x0004003d,
-    0x00000008, 0x00000047, 0x0000000d, 0x000500b2, 0x00000006, 0x00000048, 0x00000046, 0x00000047,
-    0x0003003e, 0x00000043, 0x00000048, 0x000200f9, 0x00000045, 0x000200f8, 0x00000049, 0x0004003d,
-    0x00000008, 0x0000004a, 0x0000000e, 0x0004003d, 0x00000008, 0x0000004b, 0x0000000d, 0x000500b0,
-    0x00000006, 0x0000004c, 0x0000004a, 0x0000004b, 0x0003003e, 0x00000043, 0x0000004c, 0x000200f9,
-    0x00000045, 0x000200f8, 0x00000045, 0x0004003d, 0x00000006, 0x0000004d, 0x00000043, 0x000200fe,
-    0x0000004d, 0x00010038, 0x00050036, 0x00000002, 0x0000001c, 0x00000000, 0x00000012, 0x00030037,
-    0x00000009, 0x00000013, 0x00030037, 0x00000009, 0x00000014, 0x00030037, 0x00000009, 0x00000015,
-    0x00030037, 0x00000007, 0x00000016, 0x00030037, 0x00000009, 0x00000017, 0x00030037, 0x00000009,
-    0x00000018, 0x00030037, 0x00000009, 0x00000019, 0x00030037, 0x00000009, 0x0000001a, 0x00030037,
-    0x00000007, 0x0000001b, 0x000200f8, 0x0000001d, 0x0004003b, 0x00000009, 0x00000050, 0x00000007,
-    0x0004003b, 0x00000007, 0x0000006a, 0x00000007, 0x0004003b, 0x00000009, 0x0000008b, 0x00000007,
-    0x0004003b, 0x00000009, 0x0000008f, 0x00000007, 0x0004003b, 0x00000009, 0x00000093, 0x00000007,
-    0x0004003b, 0x00000009, 0x00000096, 0x00000007, 0x0004003b, 0x00000009, 0x00000099, 0x00000007,
-    0x0004003b, 0x00000009, 0x0000009d, 0x00000007, 0x0004003d, 0x00000008, 0x00000051, 0x0000001a,
-    0x000500c7, 0x00000008, 0x00000053, 0x00000051, 0x00000052, 0x0004003d, 0x00000008, 0x00000054,
-    0x0000001a, 0x000500c2, 0x00000008, 0x00000056, 0x00000054, 0x00000055, 0x000500c7, 0x00000008,
-    0x00000058, 0x00000056, 0x00000057, 0x000500c5, 0x00000008, 0x00000059, 0x00000053, 0x00000058,
-    0x000500c5, 0x00000008, 0x0000005b, 0x00000059, 0x0000005a, 0x0004003d, 0x00000008, 0x0000005c,
-    0x00000015, 0x000500c7, 0x00000008, 0x0000005e, 0x0000005c, 0x0000005d, 0x000500c5, 0x00000008,
-    0x0000005f, 0x0000005b, 0x0000005e, 0x0003003e, 0x00000050, 0x0000005f, 0x0004003d, 0x00000006,
-    0x00000060, 0x00000016, 0x000400a8, 0x00000006, 0x00000061, 0x00000060, 0x000400a8, 0x00000006,
-    0x00000062, 0x00000061, 0x000300f7, 0x00000064, 0x00000000, 0x000400fa, 0x00000062, 0x00000063,
-    0x00000064, 0x000200f8, 0x00000063, 0x0004003d, 0x00000008, 0x00000065, 0x00000015, 0x000500c7,
-    0x00000008, 0x00000066, 0x00000065, 0x0000005a, 0x000500ab, 0x00000006, 0x00000068, 0x00000066,
-    0x00000067, 0x000200f9, 0x00000064, 0x000200f8, 0x00000064, 0x000700f5, 0x00000006, 0x00000069,
-    0x00000061, 0x0000001d, 0x00000068, 0x00000063, 0x000300f7, 0x0000006c, 0x00000000, 0x000400fa,
-    0x00000069, 0x0000006b, 0x00000073, 0x000200f8, 0x0000006b, 0x0004003d, 0x00000008, 0x0000006d,
-    0x00000015, 0x000500c7, 0x00000008, 0x0000006f, 0x0000006d, 0x0000006e, 0x0004003d, 0x00000008,
-    0x00000070, 0x00000050, 0x000500c7, 0x00000008, 0x00000071, 0x00000070, 0x0000006e, 0x000500ab,
-    0x00000006, 0x00000072, 0x0000006f, 0x00000071, 0x0003003e, 0x0000006a, 0x00000072, 0x000200f9,
-    0x0000006c, 0x000200f8, 0x00000073, 0x0004003d, 0x00000008, 0x00000074, 0x00000015, 0x000500c7,
-    0x00000008, 0x00000076, 0x00000074, 0x00000075, 0x0004003d, 0x00000008, 0x00000077, 0x0000001a,
-    0x000500c7, 0x00000008, 0x00000078, 0x00000077, 0x00000075, 0x000500ab, 0x00000006, 0x00000079,
-    0x00000076, 0x00000078, 0x0003003e, 0x0000006a, 0x00000079, 0x000200f9, 0x0000006c, 0x000200f8,
-    0x0000006c, 0x0004003d, 0x00000006, 0x0000007a, 0x0000006a, 0x000300f7, 0x0000007c, 0x00000000,
-    0x000400fa, 0x0000007a, 0x0000007b, 0x0000007c, 0x000200f8, 0x0000007b, 0x0004003d, 0x00000006,
-    0x0000007d, 0x0000001b, 0x000300f7, 0x0000007f, 0x00000000, 0x000400fa, 0x0000007d, 0x0000007e,
-    0x0000007f, 0x000200f8, 0x0000007e, 0x0004003d, 0x00000008, 0x00000080, 0x00000019, 0x0003003e,
-    0x00000014, 0x00000080, 0x000200f9, 0x0000007f, 0x000200f8, 0x0000007f, 0x0004003d, 0x00000008,
-    0x00000081, 0x00000015, 0x000500c7, 0x00000008, 0x00000083, 0x00000081, 0x00000082, 0x000500aa,
-    0x00000006, 0x00000084, 0x00000083, 0x00000067, 0x000300f7, 0x00000086, 0x00000000, 0x000400fa,
-    0x00000084, 0x00000085, 0x00000086, 0x000200f8, 0x00000085, 0x0004003d, 0x00000008, 0x00000088,
-    0x00000050, 0x000500c7, 0x00000008, 0x00000089, 0x00000088, 0x00000087, 0x0003003e, 0x00000050,
-    0x00000089, 0x000200f9, 0x00000086, 0x000200f8, 0x00000086, 0x0004003d, 0x00000008, 0x0000008a,
-    0x00000050, 0x0003003e, 0x00000015, 0x0000008a, 0x0004003d, 0x00000008, 0x0000008c, 0x00000017,
-    0x000500c7, 0x00000008, 0x0000008e, 0x0000008c, 0x0000008d, 0x0003003e, 0x0000008b, 0x0000008e,
-    0x0004003d, 0x00000008, 0x00000090, 0x00000017, 0x000500c7, 0x00000008, 0x00000092, 0x00000090,
-    0x00000091, 0x0003003e, 0x0000008f, 0x00000092, 0x0004003d, 0x00000008, 0x00000094, 0x00000013,
-    0x000500c7, 0x00000008, 0x00000095, 0x00000094, 0x0000008d, 0x0003003e, 0x00000093, 0x00000095,
-    0x0004003d, 0x00000008, 0x00000097, 0x00000013, 0x000500c7, 0x00000008, 0x00000098, 0x00000097,
-    0x00000091, 0x0003003e, 0x00000096, 0x00000098, 0x0004003d, 0x00000008, 0x0000009a, 0x00000013,
-    0x000500c7, 0x00000008, 0x0000009c, 0x0000009a, 0x0000009b, 0x0003003e, 0x00000099, 0x0000009c,
-    0x0004003d, 0x00000008, 0x0000009e, 0x00000018, 0x000500c2, 0x00000008, 0x000000a0, 0x0000009e,
-    0x0000009f, 0x00050080, 0x00000008, 0x000000a2, 0x000000a0, 0x000000a1, 0x0003003e, 0x0000009d,
-    0x000000a2, 0x0004003d, 0x00000008, 0x000000a3, 0x00000099, 0x000500ab, 0x00000006, 0x000000a4,
-    0x000000a3, 0x00000067, 0x000300f7, 0x000000a6, 0x00000000, 0x000400fa, 0x000000a4, 0x000000a5,
-    0x000000a6, 0x000200f8, 0x000000a5, 0x00050041, 0x000000b0, 0x000000b1, 0x000000ae, 0x000000af,
-    0x0004003d, 0x00000008, 0x000000b2, 0x000000b1, 0x000500c7, 0x00000008, 0x000000b4, 0x000000b2,
-    0x000000b3, 0x000500ab, 0x00000006, 0x000000b5, 0x000000b4, 0x00000067, 0x000200f9, 0x000000a6,
-    0x000200f8, 0x000000a6, 0x000700f5, 0x00000006, 0x000000b6, 0x000000a4, 0x00000086, 0x000000b5,
-    0x000000a5, 0x000300f7, 0x000000b8, 0x00000000, 0x000400fa, 0x000000b6, 0x000000b7, 0x000000b8,
-    0x000200f8, 0x000000b7, 0x0004003d, 0x00000008, 0x000000b9, 0x0000008b, 0x0004003d, 0x00000008,
-    0x000000ba, 0x0000009d, 0x00050084, 0x00000008, 0x000000bb, 0x000000b9, 0x000000ba, 0x0004003d,
-    0x00000008, 0x000000bc, 0x00000093, 0x0004003d, 0x00000008, 0x000000be, 0x0000009d, 0x00050082,
-    0x00000008, 0x000000bf, 0x000000bd, 0x000000be, 0x00050084, 0x00000008, 0x000000c0, 0x000000bc,
-    0x000000bf, 0x00050080, 0x00000008, 0x000000c1, 0x000000bb, 0x000000c0, 0x000500c2, 0x00000008,
-    0x000000c3, 0x000000c1, 0x000000c2, 0x0003003e, 0x0000008b, 0x000000c3, 0x0004003d, 0x00000008,
-    0x000000c4, 0x0000008f, 0x0004003d, 0x00000008, 0x000000c5, 0x0000009d, 0x00050084, 0x00000008,
-    0x000000c6, 0x000000c4, 0x000000c5, 0x0004003d, 0x00000008, 0x000000c7, 0x00000096, 0x0004003d,
-    0x00000008, 0x000000c8, 0x0000009d, 0x00050082, 0x00000008, 0x000000c9, 0x000000bd, 0x000000c8,
-    0x00050084, 0x00000008, 0x000000ca, 0x000000c7, 0x000000c9, 0x00050080, 0x00000008, 0x000000cb,
-    0x000000c6, 0x000000ca, 0x000500c2, 0x00000008, 0x000000cc, 0x000000cb, 0x000000c2, 0x0003003e,
-    0x0000008f, 0x000000cc, 0x000200f9, 0x000000b8, 0x000200f8, 0x000000b8, 0x0004003d, 0x00000008,
-    0x000000cd, 0x0000008b, 0x000500c7, 0x00000008, 0x000000ce, 0x000000cd, 0x0000008d, 0x0004003d,
-    0x00000008, 0x000000cf, 0x0000008f, 0x000500c7, 0x00000008, 0x000000d0, 0x000000cf, 0x00000091,
-    0x000500c5, 0x00000008, 0x000000d1, 0x000000ce, 0x000000d0, 0x0004003d, 0x00000008, 0x000000d2,
-    0x00000099, 0x0004003d, 0x00000008, 0x000000d3, 0x00000018, 0x0007000c, 0x00000008, 0x000000d4,
-    0x00000001, 0x00000029, 0x000000d2, 0x000000d3, 0x000500c5, 0x00000008, 0x000000d5, 0x000000d1,
-    0x000000d4, 0x0003003e, 0x00000013, 0x000000d5, 0x000200f9, 0x0000007c, 0x000200f8, 0x0000007c,
-    0x000100fd, 0x00010038, 0x00050036, 0x00000002, 0x0000002d, 0x00000000, 0x00000022, 0x00030037,
-    0x0000001f, 0x00000023, 0x00030037, 0x00000009, 0x00000024, 0x00030037, 0x00000009, 0x00000025,
-    0x00030037, 0x00000021, 0x00000026, 0x00030037, 0x00000021, 0x00000027, 0x00030037, 0x00000021,
-    0x00000028, 0x00030037, 0x00000021, 0x00000029, 0x00030037, 0x00000007, 0x0000002a, 0x00030037,
-    0x00000009, 0x0000002b, 0x00030037, 0x00000007, 0x0000002c, 0x000200f8, 0x0000002e, 0x0004003b,
-    0x0000001f, 0x000000d6, 0x00000007, 0x0004003b, 0x00000009, 0x000000ea, 0x00000007, 0x0004003b,
-    0x00000009, 0x000000f3, 0x00000007, 0x0004003b, 0x00000009, 0x000000fc, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000115, 0x00000007, 0x0004003b, 0x00000009, 0x00000125, 0x00000007, 0x0004003b,
-    0x00000009, 0x0000012e, 0x00000007, 0x0004003b, 0x00000009, 0x00000135, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000140, 0x00000007, 0x0004003b, 0x00000009, 0x00000152, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000015b, 0x00000007, 0x0004003b, 0x00000007, 0x00000161, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000167, 0x00000007, 0x0004003b, 0x00000007, 0x0000016a, 0x00000007, 0x0004003b,
-    0x00000009, 0x0000016f, 0x00000007, 0x0004003b, 0x00000009, 0x00000177, 0x00000007, 0x0004003b,
-    0x00000009, 0x0000017f, 0x00000007, 0x0004003b, 0x00000007, 0x00000186, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000018a, 0x00000007, 0x0004003b, 0x00000009, 0x000001a3, 0x00000007, 0x0004003b,
-    0x00000009, 0x000001a5, 0x00000007, 0x0004003b, 0x00000007, 0x000001ae, 0x00000007, 0x0004003b,
-    0x00000007, 0x000001b0, 0x00000007, 0x0004003b, 0x00000009, 0x000001b2, 0x00000007, 0x0004003b,
-    0x00000009, 0x000001b4, 0x00000007, 0x0004003b, 0x00000009, 0x000001b6, 0x00000007, 0x0004003b,
-    0x00000007, 0x000001c7, 0x00000007, 0x0004003b, 0x00000007, 0x000001c9, 0x00000007, 0x0004003b,
-    0x00000009, 0x000001cb, 0x00000007, 0x0004003b, 0x00000009, 0x000001ce, 0x00000007, 0x0004003b,
-    0x00000009, 0x000001d0, 0x00000007, 0x0004003b, 0x00000009, 0x000001d7, 0x00000007, 0x0004003b,
-    0x00000009, 0x000001e1, 0x00000007, 0x0004003b, 0x00000007, 0x00000223, 0x00000007, 0x0004003b,
-    0x00000009, 0x0000022b, 0x00000007, 0x0004003b, 0x00000009, 0x0000022e, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000231, 0x00000007, 0x0004003b, 0x00000007, 0x00000234, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000236, 0x00000007, 0x0004003b, 0x00000009, 0x00000238, 0x00000007, 0x0004003b,
-    0x00000009, 0x0000023a, 0x00000007, 0x0004003b, 0x00000009, 0x0000023c, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000023e, 0x00000007, 0x0004003b, 0x00000009, 0x00000251, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000254, 0x00000007, 0x0004003b, 0x00000009, 0x00000257, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000025a, 0x00000007, 0x0004003b, 0x00000009, 0x0000025c, 0x00000007, 0x0004003b,
-    0x00000009, 0x0000025e, 0x00000007, 0x0004003b, 0x00000009, 0x00000260, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000262, 0x00000007, 0x0004003b, 0x00000007, 0x00000264, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000272, 0x00000007, 0x0004003b, 0x00000007, 0x00000274, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000276, 0x00000007, 0x0004003b, 0x00000009, 0x00000279, 0x00000007, 0x0004003b,
-    0x00000009, 0x0000027b, 0x00000007, 0x0004003b, 0x00000007, 0x00000287, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000289, 0x00000007, 0x0004003b, 0x00000009, 0x0000028b, 0x00000007, 0x0004003b,
-    0x00000009, 0x0000028e, 0x00000007, 0x0004003b, 0x00000009, 0x00000290, 0x00000007, 0x00050041,
-    0x000000da, 0x000000db, 0x000000d9, 0x00000067, 0x0004003d, 0x00000008, 0x000000dc, 0x000000db,
-    0x0004007c, 0x0000001e, 0x000000dd, 0x000000dc, 0x00050041, 0x000000da, 0x000000de, 0x000000d9,
-    0x000000a1, 0x0004003d, 0x00000008, 0x000000df, 0x000000de, 0x0004007c, 0x0000001e, 0x000000e0,
-    0x000000df, 0x00050084, 0x0000001e, 0x000000e1, 0x000000e0, 0x00000055, 0x00050080, 0x0000001e,
-    0x000000e2, 0x000000dd, 0x000000e1, 0x0003003e, 0x000000d6, 0x000000e2, 0x000200f9, 0x000000e3,
-    0x000200f8, 0x000000e3, 0x000400f6, 0x000000e5, 0x000000e6, 0x00000000, 0x000200f9, 0x000000e7,
-    0x000200f8, 0x000000e7, 0x0004003d, 0x00000008, 0x000000e8, 0x00000024, 0x000500ab, 0x00000006,
-    0x000000e9, 0x000000e8, 0x00000067, 0x000400fa, 0x000000e9, 0x000000e4, 0x000000e5, 0x000200f8,
-    0x000000e4, 0x0004003d, 0x00000008, 0x000000eb, 0x00000024, 0x0006000c, 0x0000001e, 0x000000ec,
-    0x00000001, 0x00000049, 0x000000eb, 0x0004007c, 0x00000008, 0x000000ed, 0x000000ec, 0x0003003e,
-    0x000000ea, 0x000000ed, 0x0004003d, 0x00000008, 0x000000ee, 0x000000ea, 0x000500c4, 0x00000008,
-    0x000000ef, 0x000000a1, 0x000000ee, 0x000400c8, 0x00000008, 0x000000f0, 0x000000ef, 0x0004003d,
-    0x00000008, 0x000000f1, 0x00000024, 0x000500c7, 0x00000008, 0x000000f2, 0x000000f1, 0x000000f0,
-    0x0003003e, 0x00000024, 0x000000f2, 0x0004003d, 0x0000001e, 0x000000f4, 0x00000023, 0x00050084,
-    0x0000001e, 0x000000f6, 0x000000f4, 0x000000f5, 0x0004007c, 0x00000008, 0x000000f7, 0x000000f6,
-    0x0004003d, 0x00000008, 0x000000f8, 0x000000ea, 0x00050080, 0x00000008, 0x000000f9, 0x000000f7,
-    0x000000f8, 0x0004003d, 0x00000008, 0x000000fa, 0x00000025, 0x00050080, 0x00000008, 0x000000fb,
-    0x000000f9, 0x000000fa, 0x0003003e, 0x000000f3, 0x000000fb, 0x0004003d, 0x00000008, 0x00000110,
-    0x000000f3, 0x00050080, 0x00000008, 0x00000111, 0x0000010f, 0x00000110, 0x00060041, 0x00000112,
-    0x00000113, 0x00000104, 0x00000105, 0x00000111, 0x0004003d, 0x00000008, 0x00000114, 0x00000113,
-    0x0003003e, 0x000000fc, 0x00000114, 0x0004003d, 0x00000008, 0x0000011a, 0x000000f3, 0x00050080,
-    0x00000008, 0x0000011b, 0x00000119, 0x0000011a, 0x00060041, 0x00000112, 0x0000011c, 0x00000104,
-    0x00000105, 0x0000011b, 0x0004003d, 0x00000008, 0x0000011d, 0x0000011c, 0x0003003e, 0x00000115,
-    0x0000011d, 0x000200f9, 0x0000011e, 0x000200f8, 0x0000011e, 0x000400f6, 0x00000120, 0x00000121,
-    0x00000000, 0x000200f9, 0x00000122, 0x000200f8, 0x00000122, 0x0004003d, 0x00000008, 0x00000123,
-    0x000000fc, 0x000500ab, 0x00000006, 0x00000124, 0x00000123, 0x00000067, 0x000400fa, 0x00000124,
-    0x0000011f, 0x00000120, 0x000200f8, 0x0000011f, 0x0004003d, 0x00000008, 0x00000126, 0x000000fc,
-    0x0006000c, 0x0000001e, 0x00000127, 0x00000001, 0x00000049, 0x00000126, 0x0004007c, 0x00000008,
-    0x00000128, 0x00000127, 0x0003003e, 0x00000125, 0x00000128, 0x0004003d, 0x00000008, 0x00000129,
-    0x00000125, 0x000500c4, 0x00000008, 0x0000012a, 0x000000a1, 0x00000129, 0x000400c8, 0x00000008,
-    0x0000012b, 0x0000012a, 0x0004003d, 0x00000008, 0x0000012c, 0x000000fc, 0x000500c7, 0x00000008,
-    0x0000012d, 0x0000012c, 0x0000012b, 0x0003003e, 0x000000fc, 0x0000012d, 0x0004003d, 0x0000001e,
-    0x0000012f, 0x000000d6, 0x0004007c, 0x00000008, 0x00000130, 0x0000012f, 0x0004003d, 0x00000008,
-    0x00000131, 0x00000115, 0x00050084, 0x00000008, 0x00000132, 0x00000131, 0x000000b3, 0x00050084,
-    0x00000008, 0x00000133, 0x00000132, 0x000000b3, 0x00050080, 0x00000008, 0x00000134, 0x00000130,
-    0x00000133, 0x0003003e, 0x0000012e, 0x00000134, 0x0004003d, 0x00000008, 0x0000013a, 0x0000012e,
-    0x00060041, 0x00000112, 0x0000013b, 0x00000139, 0x00000106, 0x0000013a, 0x0004003d, 0x00000008,
-    0x0000013c, 0x0000013b, 0x0003003e, 0x00000135, 0x0000013c, 0x0004003d, 0x00000008, 0x0000013d,
-    0x00000115, 0x00050080, 0x00000008, 0x0000013f, 0x0000013d, 0x0000013e, 0x0003003e, 0x00000115,
-    0x0000013f, 0x00050041, 0x00000144, 0x00000145, 0x00000143, 0x00000106, 0x0004003d, 0x00000008,
-    0x00000146, 0x00000145, 0x0004003d, 0x00000008, 0x00000147, 0x00000125, 0x00050080, 0x00000008,
-    0x00000148, 0x00000146, 0x00000147, 0x0004003d, 0x00000008, 0x00000149, 0x000000ea, 0x0004003d,
-    0x00000008, 0x0000014a, 0x00000025, 0x00050080, 0x00000008, 0x0000014b, 0x00000149, 0x0000014a,
-    0x00050084, 0x00000008, 0x0000014c, 0x0000014b, 0x000000bd, 0x00050080, 0x00000008, 0x0000014d,
-    0x00000148, 0x0000014c, 0x0003003e, 0x00000140, 0x0000014d, 0x0004003d, 0x00000008, 0x0000014e,
-    0x00000135, 0x000500ab, 0x00000006, 0x0000014f, 0x0000014e, 0x00000067, 0x000300f7, 0x00000151,
-    0x00000000, 0x000400fa, 0x0000014f, 0x00000150, 0x00000151, 0x000200f8, 0x00000150, 0x0004003d,
-    0x00000008, 0x00000158, 0x00000140, 0x00070041, 0x00000112, 0x00000159, 0x00000157, 0x00000106,
-    0x00000158, 0x00000055, 0x0004003d, 0x00000008, 0x0000015a, 0x00000159, 0x0003003e, 0x00000152,
-    0x0000015a, 0x0004003d, 0x00000008, 0x0000015c, 0x00000140, 0x00070041, 0x00000112, 0x0000015e,
-    0x00000157, 0x00000106, 0x0000015c, 0x0000015d, 0x0004003d, 0x00000008, 0x0000015f, 0x0000015e,
-    0x000500ab, 0x00000006, 0x00000160, 0x0000015f, 0x00000067, 0x0003003e, 0x0000015b, 0x00000160,
-    0x0004003d, 0x00000008, 0x00000162, 0x00000152, 0x000500c7, 0x00000008, 0x00000164, 0x00000162,
-    0x00000163, 0x000500aa, 0x00000006, 0x00000166, 0x00000164, 0x00000165, 0x0003003e, 0x00000161,
-    0x00000166, 0x0004003d, 0x00000006, 0x00000168, 0x0000002c, 0x0003003e, 0x00000167, 0x00000168,
-    0x0004003d, 0x00000006, 0x00000169, 0x00000161, 0x0003003e, 0x0000002c, 0x00000169, 0x0004003d,
-    0x00000008, 0x0000016b, 0x00000152, 0x000500c7, 0x00000008, 0x0000016d, 0x0000016b, 0x0000016c,
-    0x000500ab, 0x00000006, 0x0000016e, 0x0000016d, 0x00000067, 0x0003003e, 0x0000016a, 0x0000016e,
-    0x0004003d, 0x00000008, 0x00000174, 0x0000012e, 0x00060041, 0x00000112, 0x00000175, 0x00000173,
-    0x00000106, 0x00000174, 0x0004003d, 0x00000008, 0x00000176, 0x00000175, 0x0003003e, 0x0000016f,
-    0x00000176, 0x0004003d, 0x00000008, 0x0000017c, 0x0000012e, 0x00060041, 0x00000112, 0x0000017d,
-    0x0000017b, 0x00000106, 0x0000017c, 0x0004003d, 0x00000008, 0x0000017e, 0x0000017d, 0x0003003e,
-    0x00000177, 0x0000017e, 0x00050041, 0x00000009, 0x00000180, 0x00000028, 0x00000067, 0x0004003d,
-    0x00000008, 0x00000181, 0x00000180, 0x0003003e, 0x0000017f, 0x00000181, 0x0004003d, 0x00000006,
-    0x00000182, 0x00000161, 0x000400a8, 0x00000006, 0x00000183, 0x00000182, 0x000300f7, 0x00000185,
-    0x00000000, 0x000400fa, 0x00000183, 0x00000184, 0x0000026d, 0x000200f8, 0x00000184, 0x0004003d,
-    0x00000008, 0x00000187, 0x00000152, 0x000500c7, 0x00000008, 0x00000188, 0x00000187, 0x00000165,
-    0x000500aa, 0x00000006, 0x00000189, 0x00000188, 0x00000165, 0x0003003e, 0x00000186, 0x00000189,
-    0x0003003e, 0x0000018a, 0x0000018b, 0x0004003d, 0x00000006, 0x0000018c, 0x00000186, 0x000300f7,
-    0x0000018e, 0x00000000, 0x000400fa, 0x0000018c, 0x0000018d, 0x0000018e, 0x000200f8, 0x0000018d,
-    0x0004003d, 0x00000008, 0x0000018f, 0x0000002b, 0x000500aa, 0x00000006, 0x00000190, 0x0000018f,
-    0x00000067, 0x000300f7, 0x00000192, 0x00000000, 0x000400fa, 0x00000190, 0x00000191, 0x00000192,
-    0x000200f8, 0x00000191, 0x000200f9, 0x00000121, 0x000200f8, 0x00000192, 0x0004003d, 0x00000008,
-    0x00000194, 0x0000002b, 0x000500c7, 0x00000008, 0x00000195, 0x00000194, 0x000000a1, 0x000500aa,
-    0x00000006, 0x00000196, 0x00000195, 0x00000067, 0x000300f7, 0x00000198, 0x00000000, 0x000400fa,
-    0x00000196, 0x00000197, 0x00000198, 0x000200f8, 0x00000197, 0x0003003e, 0x0000018a, 0x00000199,
-    0x000200f9, 0x00000198, 0x000200f8, 0x00000198, 0x0004003d, 0x00000008, 0x0000019a, 0x0000002b,
-    0x000500c7, 0x00000008, 0x0000019c, 0x0000019a, 0x0000019b, 0x000500aa, 0x00000006, 0x0000019d,
-    0x0000019c, 0x00000067, 0x000300f7, 0x0000019f, 0x00000000, 0x000400fa, 0x0000019d, 0x0000019e,
-    0x0000019f, 0x000200f8, 0x0000019e, 0x0004003d, 0x00000008, 0x000001a1, 0x0000017f, 0x000500c7,
-    0x00000008, 0x000001a2, 0x000001a1, 0x000001a0, 0x0003003e, 0x0000017f, 0x000001a2, 0x000200f9,
-    0x0000019f, 0x000200f8, 0x0000019f, 0x000200f9, 0x0000018e, 0x000200f8, 0x0000018e, 0x0004003d,
-    0x00000006, 0x000001a4, 0x0000018a, 0x000300f7, 0x000001a7, 0x00000000, 0x000400fa, 0x000001a4,
-    0x000001a6, 0x000001aa, 0x000200f8, 0x000001a6, 0x00050041, 0x00000009, 0x000001a8, 0x00000027,
-    0x000000a1, 0x0004003d, 0x00000008, 0x000001a9, 0x000001a8, 0x0003003e, 0x000001a5, 0x000001a9,
-    0x000200f9, 0x000001a7, 0x000200f8, 0x000001aa, 0x00050041, 0x00000009, 0x000001ab, 0x00000027,
-    0x00000067, 0x0004003d, 0x00000008, 0x000001ac, 0x000001ab, 0x0003003e, 0x000001a5, 0x000001ac,
-    0x000200f9, 0x000001a7, 0x000200f8, 0x000001a7, 0x0004003d, 0x00000008, 0x000001ad, 0x000001a5,
-    0x0003003e, 0x000001a3, 0x000001ad, 0x0004003d, 0x00000006, 0x000001af, 0x0000016a, 0x0003003e,
-    0x000001ae, 0x000001af, 0x0004003d, 0x00000006, 0x000001b1, 0x0000015b, 0x0003003e, 0x000001b0,
-    0x000001b1, 0x0004003d, 0x00000008, 0x000001b3, 0x000001a3, 0x0003003e, 0x000001b2, 0x000001b3,
-    0x0004003d, 0x00000008, 0x000001b5, 0x0000016f, 0x0003003e, 0x000001b4, 0x000001b5, 0x0004003d,
-    0x00000008, 0x000001b7, 0x0000017f, 0x0003003e, 0x000001b6, 0x000001b7, 0x00090039, 0x00000006,
-    0x000001b8, 0x00000010, 0x000001ae, 0x000001b0, 0x000001b2, 0x000001b4, 0x000001b6, 0x000400a8,
-    0x00000006, 0x000001b9, 0x000001b8, 0x000300f7, 0x000001bb, 0x00000000, 0x000400fa, 0x000001b9,
-    0x000001ba, 0x000001bb, 0x000200f8, 0x000001ba, 0x0004003d, 0x00000008, 0x000001bc, 0x0000017f,
-    0x000500c7, 0x00000008, 0x000001be, 0x000001bc, 0x000001bd, 0x000500aa, 0x00000006, 0x000001bf,
-    0x000001be, 0x00000067, 0x0004003d, 0x00000006, 0x000001c0, 0x0000018a, 0x000500a6, 0x00000006,
-    0x000001c1, 0x000001bf, 0x000001c0, 0x000300f7, 0x000001c3, 0x00000000, 0x000400fa, 0x000001c1,
-    0x000001c2, 0x000001c3, 0x000200f8, 0x000001c2, 0x000200f9, 0x00000121, 0x000200f8, 0x000001c3,
-    0x0003003e, 0x0000018a, 0x00000199, 0x00050041, 0x00000009, 0x000001c5, 0x00000028, 0x000000a1,
-    0x0004003d, 0x00000008, 0x000001c6, 0x000001c5, 0x0003003e, 0x0000017f, 0x000001c6, 0x0004003d,
-    0x00000006, 0x000001c8, 0x0000016a, 0x0003003e, 0x000001c7, 0x000001c8, 0x0004003d, 0x00000006,
-    0x000001ca, 0x0000015b, 0x0003003e, 0x000001c9, 0x000001ca, 0x00050041, 0x00000009, 0x000001cc,
-    0x00000027, 0x000000a1, 0x0004003d, 0x00000008, 0x000001cd, 0x000001cc, 0x0003003e, 0x000001cb,
-    0x000001cd, 0x0004003d, 0x00000008, 0x000001cf, 0x0000016f, 0x0003003e, 0x000001ce, 0x000001cf,
-    0x0004003d, 0x00000008, 0x000001d1, 0x0000017f, 0x0003003e, 0x000001d0, 0x000001d1, 0x00090039,
-    0x00000006, 0x000001d2, 0x00000010, 0x000001c7, 0x000001c9, 0x000001cb, 0x000001ce, 0x000001d0,
-    0x000400a8, 0x00000006, 0x000001d3, 0x000001d2, 0x000300f7, 0x000001d5, 0x00000000, 0x000400fa,
-    0x000001d3, 0x000001d4, 0x000001d5, 0x000200f8, 0x000001d4, 0x000200f9, 0x00000121, 0x000200f8,
-    0x000001d5, 0x000200f9, 0x000001bb, 0x000200f8, 0x000001bb, 0x0004003d, 0x00000008, 0x000001d8,
-    0x00000152, 0x000500c7, 0x00000008, 0x000001da, 0x000001d8, 0x000001d9, 0x0003003e, 0x000001d7,
-    0x000001da, 0x0004003d, 0x00000006, 0x000001db, 0x0000015b, 0x000400a8, 0x00000006, 0x000001dc,
-    0x000001db, 0x000300f7, 0x000001de, 0x00000000, 0x000400fa, 0x000001dc, 0x000001dd, 0x000001de,
-    0x000200f8, 0x000001dd, 0x0004003d, 0x00000008, 0x000001df, 0x000001d7, 0x000500c5, 0x00000008,
-    0x000001e0, 0x000001df, 0x00000040, 0x0003003e, 0x000001d7, 0x000001e0, 0x000200f9, 0x000001de,
-    0x000200f8, 0x000001de, 0x0004003d, 0x00000008, 0x000001e2, 0x00000135, 0x000500c7, 0x00000008,
-    0x000001e3, 0x000001e2, 0x0000009b, 0x0003003e, 0x000001e1, 0x000001e3, 0x0004003d, 0x00000008,
-    0x000001e4, 0x000001e1, 0x000500aa, 0x00000006, 0x000001e5, 0x000001e4, 0x0000009b, 0x000300f7,
-    0x000001e7, 0x00000000, 0x000400fa, 0x000001e5, 0x000001e6, 0x00000222, 0x000200f8, 0x000001e6,
-    0x0004003d, 0x00000008, 0x000001e8, 0x00000177, 0x0004003d, 0x00000008, 0x000001e9, 0x000001d7,
-    0x000500c5, 0x00000008, 0x000001ea, 0x000001e9, 0x000001e8, 0x0003003e, 0x000001d7, 0x000001ea,
-    0x0004003d, 0x00000006, 0x000001eb, 0x0000018a, 0x000400a8, 0x00000006, 0x000001ec, 0x000001eb,
-    0x000300f7, 0x000001ee, 0x00000000, 0x000400fa, 0x000001ec, 0x000001ed, 0x0000020e, 0x000200f8,
-    0x000001ed, 0x0004003d, 0x00000008, 0x000001ef, 0x000001d7, 0x000500c7, 0x00000008, 0x000001f0,
-    0x000001ef, 0x000001bd, 0x000500ab, 0x00000006, 0x000001f1, 0x000001f0, 0x00000067, 0x000300f7,
-    0x000001f3, 0x00000000, 0x000400fa, 0x000001f1, 0x000001f2, 0x000001f3, 0x000200f8, 0x000001f2,
-    0x00050041, 0x00000009, 0x000001f4, 0x00000026, 0x00000067, 0x0004003d, 0x00000008, 0x000001f5,
-    0x000001f4, 0x00050041, 0x00000009, 0x000001f6, 0x00000026, 0x000000a1, 0x0003003e, 0x000001f6,
-    0x000001f5, 0x00050041, 0x00000009, 0x000001f7, 0x00000027, 0x00000067, 0x0004003d, 0x00000008,
-    0x000001f8, 0x000001f7, 0x00050041, 0x00000009, 0x000001f9, 0x00000027, 0x000000a1, 0x0003003e,
-    0x000001f9, 0x000001f8, 0x00050041, 0x00000009, 0x000001fa, 0x00000028, 0x00000067, 0x0004003d,
-    0x00000008, 0x000001fb, 0x000001fa, 0x00050041, 0x00000009, 0x000001fc, 0x00000028, 0x000000a1,
-    0x0003003e, 0x000001fc, 0x000001fb, 0x0004003d, 0x00000006, 0x000001fd, 0x0000002a, 0x000300f7,
-    0x000001ff, 0x00000000, 0x000400fa, 0x000001fd, 0x000001fe, 0x000001ff, 0x000200f8, 0x000001fe,
-    0x00050041, 0x00000009, 0x00000200, 0x00000029, 0x00000067, 0x0004003d, 0x00000008, 0x00000201,
-    0x00000200, 0x00050041, 0x00000009, 0x00000202, 0x00000029, 0x000000a1, 0x0003003e, 0x00000202,
-    0x00000201, 0x000200f9, 0x000001ff, 0x000200f8, 0x000001ff, 0x000200f9, 0x000001f3, 0x000200f8,
-    0x000001f3, 0x0004003d, 0x00000008, 0x00000203, 0x00000135, 0x00050041, 0x00000009, 0x00000204,
-    0x00000026, 0x00000067, 0x0003003e, 0x00000204, 0x00000203, 0x0004003d, 0x00000008, 0x00000205,
-    0x0000016f, 0x00050041, 0x00000009, 0x00000206, 0x00000027, 0x00000067, 0x0003003e, 0x00000206,
-    0x00000205, 0x0004003d, 0x00000008, 0x00000207, 0x000001d7, 0x00050041, 0x00000009, 0x00000208,
-    0x00000028, 0x00000067, 0x0003003e, 0x00000208, 0x00000207, 0x0004003d, 0x00000006, 0x00000209,
-    0x0000002a, 0x000300f7, 0x0000020b, 0x00000000, 0x000400fa, 0x00000209, 0x0000020a, 0x0000020b,
-    0x000200f8, 0x0000020a, 0x0004003d, 0x00000008, 0x0000020c, 0x00000140, 0x00050041, 0x00000009,
-    0x0000020d, 0x00000029, 0x00000067, 0x0003003e, 0x0000020d, 0x0000020c, 0x000200f9, 0x0000020b,
-    0x000200f8, 0x0000020b, 0x000200f9, 0x000001ee, 0x000200f8, 0x0000020e, 0x0004003d, 0x00000008,
-    0x0000020f, 0x00000135, 0x00050041, 0x00000009, 0x00000210, 0x00000026, 0x000000a1, 0x0003003e,
-    0x00000210, 0x0000020f, 0x0004003d, 0x00000008, 0x00000211, 0x0000016f, 0x00050041, 0x00000009,
-    0x00000212, 0x00000027, 0x000000a1, 0x0003003e, 0x00000212, 0x00000211, 0x0004003d, 0x00000008,
-    0x00000213, 0x000001d7, 0x00050041, 0x00000009, 0x00000214, 0x00000028, 0x000000a1, 0x0003003e,
-    0x00000214, 0x00000213, 0x0004003d, 0x00000006, 0x00000215, 0x0000002a, 0x000300f7, 0x00000217,
-    0x00000000, 0x000400fa, 0x00000215, 0x00000216, 0x00000217, 0x000200f8, 0x00000216, 0x0004003d,
-    0x00000008, 0x00000218, 0x00000140, 0x00050041, 0x00000009, 0x00000219, 0x00000029, 0x000000a1,
-    0x0003003e, 0x00000219, 0x00000218, 0x000200f9, 0x00000217, 0x000200f8, 0x00000217, 0x000200f9,
-    0x000001ee, 0x000200f8, 0x000001ee, 0x0004003d, 0x00000006, 0x0000021a, 0x0000002a, 0x000300f7,
-    0x0000021c, 0x00000000, 0x000400fa, 0x0000021a, 0x0000021b, 0x0000021c, 0x000200f8, 0x0000021b,
-    0x0004003d, 0x00000008, 0x0000021d, 0x0000012e, 0x0004003d, 0x00000008, 0x0000021e, 0x00000177,
-    0x000500c5, 0x00000008, 0x00000220, 0x0000021e, 0x0000021f, 0x00060041, 0x00000112, 0x00000221,
-    0x0000017b, 0x00000106, 0x0000021d, 0x0003003e, 0x00000221, 0x00000220, 0x000200f9, 0x0000021c,
-    0x000200f8, 0x0000021c, 0x000200f9, 0x000001e7, 0x000200f8, 0x00000222, 0x0004003d, 0x00000008,
-    0x00000224, 0x00000152, 0x000500c7, 0x00000008, 0x00000225, 0x00000224, 0x000000fd, 0x000500ab,
-    0x00000006, 0x00000226, 0x00000225, 0x00000067, 0x0003003e, 0x00000223, 0x00000226, 0x0004003d,
-    0x00000006, 0x00000227, 0x0000018a, 0x000400a8, 0x00000006, 0x00000228, 0x00000227, 0x000300f7,
-    0x0000022a, 0x00000000, 0x000400fa, 0x00000228, 0x00000229, 0x0000022a, 0x000200f8, 0x00000229,
-    0x00050041, 0x00000009, 0x0000022c, 0x00000026, 0x00000067, 0x0004003d, 0x00000008, 0x0000022d,
-    0x0000022c, 0x0003003e, 0x0000022b, 0x0000022d, 0x00050041, 0x00000009, 0x0000022f, 0x00000027,
-    0x00000067, 0x0004003d, 0x00000008, 0x00000230, 0x0000022f, 0x0003003e, 0x0000022e, 0x00000230,
-    0x00050041, 0x00000009, 0x00000232, 0x00000028, 0x00000067, 0x0004003d, 0x00000008, 0x00000233,
-    0x00000232, 0x0003003e, 0x00000231, 0x00000233, 0x0004003d, 0x00000006, 0x00000235, 0x00000186,
-    0x0003003e, 0x00000234, 0x00000235, 0x0004003d, 0x00000008, 0x00000237, 0x00000135, 0x0003003e,
-    0x00000236, 0x00000237, 0x0004003d, 0x00000008, 0x00000239, 0x000001e1, 0x0003003e, 0x00000238,
-    0x00000239, 0x0004003d, 0x00000008, 0x0000023b, 0x0000016f, 0x0003003e, 0x0000023a, 0x0000023b,
-    0x0004003d, 0x00000008, 0x0000023d, 0x000001d7, 0x0003003e, 0x0000023c, 0x0000023d, 0x0004003d,
-    0x00000006, 0x0000023f, 0x00000223, 0x0003003e, 0x0000023e, 0x0000023f, 0x000d0039, 0x00000002,
-    0x00000240, 0x0000001c, 0x0000022b, 0x0000022e, 0x00000231, 0x00000234, 0x00000236, 0x00000238,
-    0x0000023a, 0x0000023c, 0x0000023e, 0x0004003d, 0x00000008, 0x00000241, 0x0000022b, 0x00050041,
-    0x00000009, 0x00000242, 0x00000026, 0x00000067, 0x0003003e, 0x00000242, 0x00000241, 0x0004003d,
-    0x00000008, 0x00000243, 0x0000022e, 0x00050041, 0x00000009, 0x00000244, 0x00000027, 0x00000067,
-    0x0003003e, 0x00000244, 0x00000243, 0x0004003d, 0x00000008, 0x00000245, 0x00000231, 0x00050041,
-    0x00000009, 0x00000246, 0x00000028, 0x00000067, 0x0003003e, 0x00000246, 0x00000245, 0x000200f9,
-    0x0000022a, 0x000200f8, 0x0000022a, 0x0004003d, 0x00000006, 0x00000247, 0x0000018a, 0x000400a8,
-    0x00000006, 0x00000248, 0x00000247, 0x000300f7, 0x0000024a, 0x00000000, 0x000400fa, 0x00000248,
-    0x00000249, 0x0000024a, 0x000200f8, 0x00000249, 0x0004003d, 0x00000008, 0x0000024b, 0x0000017f,
-    0x000500c7, 0x00000008, 0x0000024c, 0x0000024b, 0x000001bd, 0x000500ab, 0x00000006, 0x0000024d,
-    0x0000024c, 0x00000067, 0x000200f9, 0x0000024a, 0x000200f8, 0x0000024a, 0x000700f5, 0x00000006,
-    0x0000024e, 0x00000247, 0x0000022a, 0x0000024d, 0x00000249, 0x000300f7, 0x00000250, 0x00000000,
-    0x000400fa, 0x0000024e, 0x0000024f, 0x00000250, 0x000200f8, 0x0000024f, 0x00050041, 0x00000009,
-    0x00000252, 0x00000026, 0x000000a1, 0x0004003d, 0x00000008, 0x00000253, 0x00000252, 0x0003003e,
-    0x00000251, 0x00000253, 0x00050041, 0x00000009, 0x00000255, 0x00000027, 0x000000a1, 0x0004003d,
-    0x00000008, 0x00000256, 0x00000255, 0x0003003e, 0x00000254, 0x00000256, 0x00050041, 0x00000009,
-    0x00000258, 0x00000028, 0x000000a1, 0x0004003d, 0x00000008, 0x00000259, 0x00000258, 0x0003003e,
-    0x00000257, 0x00000259, 0x0004003d, 0x00000006, 0x0000025b, 0x00000186, 0x0003003e, 0x0000025a,
-    0x0000025b, 0x0004003d, 0x00000008, 0x0000025d, 0x00000135, 0x0003003e, 0x0000025c, 0x0000025d,
-    0x0004003d, 0x00000008, 0x0000025f, 0x000001e1, 0x0003003e, 0x0000025e, 0x0000025f, 0x0004003d,
-    0x00000008, 0x00000261, 0x0000016f, 0x0003003e, 0x00000260, 0x00000261, 0x0004003d, 0x00000008,
-    0x00000263, 0x000001d7, 0x0003003e, 0x00000262, 0x00000263, 0x0004003d, 0x00000006, 0x00000265,
-    0x00000223, 0x0003003e, 0x00000264, 0x00000265, 0x000d0039, 0x00000002, 0x00000266, 0x0000001c,
-    0x00000251, 0x00000254, 0x00000257, 0x0000025a, 0x0000025c, 0x0000025e, 0x00000260, 0x00000262,
-    0x00000264, 0x0004003d, 0x00000008, 0x00000267, 0x00000251, 0x00050041, 0x00000009, 0x00000268,
-    0x00000026, 0x000000a1, 0x0003003e, 0x00000268, 0x00000267, 0x0004003d, 0x00000008, 0x00000269,
-    0x00000254, 0x00050041, 0x00000009, 0x0000026a, 0x00000027, 0x000000a1, 0x0003003e, 0x0000026a,
-    0x00000269, 0x0004003d, 0x00000008, 0x0000026b, 0x00000257, 0x00050041, 0x00000009, 0x0000026c,
-    0x00000028, 0x000000a1, 0x0003003e, 0x0000026c, 0x0000026b, 0x000200f9, 0x00000250, 0x000200f8,
-    0x00000250, 0x000200f9, 0x000001e7, 0x000200f8, 0x000001e7, 0x000200f9, 0x00000185, 0x000200f8,
-    0x0000026d, 0x0004003d, 0x00000006, 0x0000026e, 0x00000167, 0x000400a8, 0x00000006, 0x0000026f,
-    0x0000026e, 0x000300f7, 0x00000271, 0x00000000, 0x000400fa, 0x0000026f, 0x00000270, 0x00000271,
-    0x000200f8, 0x00000270, 0x0003003e, 0x0000002b, 0x00000067, 0x000200f9, 0x00000271, 0x000200f8,
-    0x00000271, 0x0004003d, 0x00000006, 0x00000273, 0x0000016a, 0x0003003e, 0x00000272, 0x00000273,
-    0x0004003d, 0x00000006, 0x00000275, 0x0000015b, 0x0003003e, 0x00000274, 0x00000275, 0x00050041,
-    0x00000009, 0x00000277, 0x00000027, 0x00000067, 0x0004003d, 0x00000008, 0x00000278, 0x00000277,
-    0x0003003e, 0x00000276, 0x00000278, 0x0004003d, 0x00000008, 0x0000027a, 0x0000016f, 0x0003003e,
-    0x00000279, 0x0000027a, 0x00050041, 0x00000009, 0x0000027c, 0x00000028, 0x00000067, 0x0004003d,
-    0x00000008, 0x0000027d, 0x0000027c, 0x0003003e, 0x0000027b, 0x0000027d, 0x00090039, 0x00000006,
-    0x0000027e, 0x00000010, 0x00000272, 0x00000274, 0x00000276, 0x00000279, 0x0000027b, 0x000400a8,
-    0x00000006, 0x0000027f, 0x0000027e, 0x000300f7, 0x00000281, 0x00000000, 0x000400fa, 0x0000027f,
-    0x00000280, 0x00000281, 0x000200f8, 0x00000280, 0x0003003e, 0x0000002b, 0x000000a1, 0x000200f9,
-    0x00000281, 0x000200f8, 0x00000281, 0x0004003d, 0x00000008, 0x00000282, 0x0000017f, 0x000500c7,
-    0x00000008, 0x00000283, 0x00000282, 0x000001bd, 0x000500ab, 0x00000006, 0x00000284, 0x00000283,
-    0x00000067, 0x000300f7, 0x00000286, 0x00000000, 0x000400fa, 0x00000284, 0x00000285, 0x00000286,
-    0x000200f8, 0x00000285, 0x0004003d, 0x00000006, 0x00000288, 0x0000016a, 0x0003003e, 0x00000287,
-    0x00000288, 0x0004003d, 0x00000006, 0x0000028a, 0x0000015b, 0x0003003e, 0x00000289, 0x0000028a,
-    0x00050041, 0x00000009, 0x0000028c, 0x00000027, 0x000000a1, 0x0004003d, 0x00000008, 0x0000028d,
-    0x0000028c, 0x0003003e, 0x0000028b, 0x0000028d, 0x0004003d, 0x00000008, 0x0000028f, 0x0000016f,
-    0x0003003e, 0x0000028e, 0x0000028f, 0x00050041, 0x00000009, 0x00000291, 0x00000028, 0x000000a1,
-    0x0004003d, 0x00000008, 0x00000292, 0x00000291, 0x0003003e, 0x00000290, 0x00000292, 0x00090039,
-    0x00000006, 0x00000293, 0x00000010, 0x00000287, 0x00000289, 0x0000028b, 0x0000028e, 0x00000290,
-    0x000400a8, 0x00000006, 0x00000294, 0x00000293, 0x000300f7, 0x00000296, 0x00000000, 0x000400fa,
-    0x00000294, 0x00000295, 0x00000296, 0x000200f8, 0x00000295, 0x0004003d, 0x00000008, 0x00000297,
-    0x0000002b, 0x000500c5, 0x00000008, 0x00000298, 0x00000297, 0x0000019b, 0x0003003e, 0x0000002b,
-    0x00000298, 0x000200f9, 0x00000296, 0x000200f8, 0x00000296, 0x000200f9, 0x00000286, 0x000200f8,
-    0x00000286, 0x000200f9, 0x00000185, 0x000200f8, 0x00000185, 0x000200f9, 0x00000151, 0x000200f8,
-    0x00000151, 0x000200f9, 0x00000121, 0x000200f8, 0x00000121, 0x000200f9, 0x0000011e, 0x000200f8,
-    0x00000120, 0x000200f9, 0x000000e6, 0x000200f8, 0x000000e6, 0x000200f9, 0x000000e3, 0x000200f8,
-    0x000000e5, 0x000100fd, 0x00010038,
+const uint8_t Blob004_Data[6950] =
+{
+    0x28, 0xb5, 0x2f, 0xfd, 0x60, 0x6c, 0x67, 0xe5, 0xd8, 0x00, 0x8a, 0xdf, 0xa8, 0x36, 0x37, 0x10,
+    0x80, 0x6e, 0xc6, 0xfc, 0xeb, 0xff, 0x6f, 0xbd, 0xd3, 0x75, 0x75, 0x5a, 0xfb, 0xb5, 0x20, 0x0a,
+    0xfd, 0x34, 0x63, 0x09, 0x2f, 0x23, 0xdf, 0x99, 0x24, 0x81, 0x7d, 0x6f, 0x29, 0x71, 0x79, 0x67,
+    0xa8, 0x74, 0xeb, 0x8f, 0xe7, 0x9f, 0xee, 0xfc, 0xab, 0x7b, 0xee, 0x4f, 0x1d, 0xae, 0x88, 0x48,
+    0x92, 0x90, 0x2d, 0xa5, 0x4c, 0x01, 0x06, 0x03, 0x59, 0x03, 0x8a, 0x03, 0x4f, 0xcf, 0xf3, 0x53,
+    0x4f, 0xef, 0x20, 0x91, 0x36, 0xbd, 0x01, 0x4b, 0xba, 0x7e, 0xb3, 0xb3, 0x9e, 0x32, 0x1e, 0xb1,
+    0x2b, 0xd8, 0xdd, 0x65, 0xcd, 0xb2, 0xe9, 0xab, 0xaa, 0x10, 0xd5, 0xa7, 0xbe, 0x69, 0xea, 0xfc,
+    0x4e, 0x7f, 0x26, 0x54, 0xc3, 0xec, 0xb5, 0x48, 0x42, 0x3e, 0x9a, 0x70, 0x6c, 0x5c, 0x54, 0x4c,
+    0x3c, 0x1c, 0x0c, 0x04, 0xf4, 0xe3, 0xd3, 0xdb, 0xc7, 0x79, 0xe1, 0x34, 0xec, 0x38, 0x2c, 0xd6,
+    0xca, 0xc7, 0x57, 0x7f, 0x94, 0x67, 0xff, 0xfa, 0x58, 0xb2, 0xa2, 0x27, 0x83, 0xbd, 0xfb, 0x50,
+    0xed, 0xf3, 0x36, 0x5c, 0xcd, 0x33, 0x16, 0x07, 0x37, 0x05, 0xf3, 0x5f, 0x9a, 0x73, 0xbd, 0xfa,
+    0x9e, 0xa5, 0xcb, 0x23, 0x5c, 0x79, 0x28, 0x39, 0xf9, 0x8b, 0x57, 0xf8, 0x77, 0xb2, 0x15, 0xa5,
+    0x43, 0x69, 0x50, 0x4e, 0x4d, 0xba, 0xf0, 0xd7, 0x2c, 0x53, 0xc7, 0xf4, 0x9e, 0x51, 0xfe, 0x87,
+    0xd5, 0x60, 0x94, 0xa1, 0x89, 0xc9, 0x61, 0xdd, 0xcc, 0x8e, 0xac, 0x36, 0x2e, 0x26, 0x1e, 0x1a,
+    0xfe, 0xf5, 0xe9, 0xed, 0x3a, 0x97, 0x6e, 0x83, 0x06, 0x0c, 0x71, 0x70, 0xda, 0xb6, 0x30, 0xb0,
+    0x06, 0x5d, 0x5b, 0x59, 0x58, 0x56, 0x34, 0x15, 0xed, 0xf4, 0x5c, 0x46, 0x9b, 0x30, 0x49, 0x12,
+    0xfa, 0xc9, 0x43, 0x47, 0xe6, 0x25, 0x1e, 0xae, 0xe3, 0x62, 0x4b, 0x18, 0xff, 0x5c, 0x70, 0x78,
+    0x9b, 0x67, 0x11, 0xbf, 0x90, 0x2b, 0xf8, 0xd7, 0xa7, 0xf7, 0xed, 0x8d, 0xf3, 0xf2, 0xe6, 0xf0,
+    0x1d, 0xf7, 0x4b, 0x41, 0xdc, 0x7d, 0x2f, 0x5e, 0x27, 0x07, 0x37, 0xfe, 0x7f, 0xc3, 0xed, 0xbc,
+    0x0f, 0x57, 0xdb, 0xaf, 0xd6, 0xfb, 0xad, 0xf6, 0x85, 0xea, 0xf3, 0xe1, 0xd4, 0x07, 0x7b, 0xd7,
+    0x2c, 0xd4, 0xbf, 0x87, 0xc9, 0x5e, 0x1c, 0xd6, 0x5e, 0x98, 0xb3, 0x60, 0x5c, 0x9c, 0xb5, 0xb0,
+    0x8f, 0x75, 0x6f, 0x84, 0xcf, 0x66, 0x9f, 0xea, 0xb6, 0x15, 0x63, 0xb9, 0xb8, 0x78, 0xce, 0xfa,
+    0xf6, 0x05, 0xfb, 0x73, 0x9d, 0xbc, 0x8b, 0x71, 0xec, 0x18, 0xad, 0x6a, 0xd5, 0x52, 0x3f, 0x2b,
+    0xc6, 0xf5, 0x9a, 0x7e, 0xbe, 0x5c, 0xab, 0x93, 0x7f, 0xc7, 0xda, 0x8d, 0xc9, 0x6c, 0x63, 0x2f,
+    0x16, 0xf3, 0x1a, 0x6b, 0xb9, 0xb4, 0xf8, 0x72, 0x6e, 0xce, 0xe7, 0x15, 0x5b, 0xd5, 0x3d, 0x8d,
+    0x8d, 0xf8, 0xb8, 0x68, 0x7b, 0x43, 0x3a, 0xbe, 0x67, 0x81, 0xde, 0x3a, 0xe6, 0xf9, 0xdd, 0xae,
+    0xeb, 0xcd, 0xcf, 0xae, 0xaf, 0xa6, 0xe7, 0x6c, 0x63, 0xed, 0x6d, 0xb7, 0x73, 0xbd, 0x70, 0xe0,
+    0x3c, 0xd7, 0xb7, 0x33, 0x95, 0x0b, 0x1e, 0x03, 0x53, 0xff, 0xeb, 0xff, 0xe2, 0xb9, 0x1b, 0x7d,
+    0x7d, 0x6e, 0xbe, 0xeb, 0xe1, 0xec, 0xfc, 0xff, 0x64, 0x3d, 0x0c, 0xf7, 0xb7, 0x9e, 0xd7, 0xd5,
+    0x91, 0xc9, 0xf6, 0x2f, 0x79, 0x9c, 0xbb, 0x81, 0xbd, 0x64, 0x34, 0xd8, 0x5b, 0x57, 0xa7, 0x0d,
+    0x99, 0x32, 0x34, 0x70, 0xd8, 0xbb, 0xeb, 0x81, 0xd1, 0xbe, 0xf8, 0x36, 0xac, 0x36, 0xf7, 0xed,
+    0x92, 0x56, 0x75, 0xb4, 0x29, 0xd5, 0xb7, 0xac, 0xbe, 0x18, 0xc7, 0xdb, 0xbd, 0x64, 0x3d, 0xf7,
+    0xf3, 0xfc, 0x5e, 0xe7, 0xb5, 0xcb, 0x5e, 0xbb, 0xe1, 0x08, 0xb7, 0xd5, 0xfe, 0x62, 0xab, 0xb8,
+    0x16, 0x1c, 0x0e, 0x6b, 0xa9, 0xbf, 0x83, 0xb1, 0xe2, 0xb1, 0xb7, 0xac, 0xae, 0xfe, 0x7f, 0x5d,
+    0xee, 0x36, 0x46, 0xef, 0x60, 0xdc, 0xab, 0xe3, 0x15, 0xe6, 0x1f, 0x83, 0xc3, 0xdd, 0xbe, 0x6f,
+    0x98, 0x0d, 0x8f, 0x3c, 0xc1, 0xc6, 0xd3, 0xc3, 0x75, 0x5e, 0xf0, 0x1b, 0xbe, 0xe7, 0x6b, 0x36,
+    0x70, 0x3b, 0xf1, 0x17, 0x5f, 0x31, 0x16, 0xf9, 0x58, 0xc2, 0x8c, 0x91, 0xcc, 0x2d, 0x91, 0x0b,
+    0xce, 0xbf, 0x74, 0x6c, 0x68, 0x7a, 0xb9, 0x2e, 0xae, 0x7a, 0xeb, 0xd7, 0xbb, 0x05, 0xe7, 0x3b,
+    0x55, 0xde, 0xc5, 0xf5, 0x5c, 0x2f, 0x8c, 0xe5, 0xb0, 0xc5, 0xf5, 0x7d, 0x4a, 0xcf, 0xc1, 0x60,
+    0xef, 0x9e, 0xd4, 0x47, 0x41, 0x21, 0xf8, 0x3d, 0x1f, 0xd7, 0xd5, 0x51, 0x78, 0xfa, 0xed, 0x01,
+    0xad, 0x8e, 0x7f, 0x9d, 0x9e, 0x6e, 0x01, 0x59, 0xcf, 0x1b, 0xc5, 0x61, 0x8c, 0xaf, 0xe5, 0x63,
+    0x1d, 0x0f, 0x63, 0xc7, 0xe3, 0x7c, 0x1b, 0xd6, 0xd9, 0x12, 0xbc, 0xd0, 0xee, 0xd5, 0xf7, 0x90,
+    0x08, 0x1c, 0x8d, 0x6d, 0xf5, 0xb1, 0x11, 0xb6, 0x68, 0x2f, 0xcc, 0xc5, 0xed, 0xb2, 0x63, 0x2f,
+    0xd1, 0xe3, 0x43, 0xdc, 0x01, 0x7a, 0xf8, 0x1b, 0xde, 0x0a, 0x88, 0xda, 0xc1, 0xf9, 0x96, 0xfc,
+    0x1d, 0x83, 0x71, 0x5d, 0xbb, 0x87, 0xbf, 0x6c, 0x49, 0xfa, 0xbe, 0x8f, 0x05, 0xe5, 0x5f, 0xef,
+    0x0e, 0xf4, 0xbf, 0x8f, 0xb9, 0x3f, 0x7b, 0xb9, 0xb7, 0x42, 0x17, 0xec, 0xdd, 0xe2, 0x75, 0x3e,
+    0x5f, 0x9c, 0x9c, 0x97, 0xf7, 0x54, 0x9f, 0xfc, 0x85, 0x45, 0x17, 0x35, 0xce, 0xc7, 0x63, 0x9c,
+    0x6d, 0x1f, 0xe7, 0x5a, 0xbb, 0x5d, 0x9c, 0x97, 0x09, 0x55, 0xa9, 0x5c, 0xf2, 0x77, 0x0b, 0xf6,
+    0xde, 0x9f, 0xeb, 0x79, 0xf7, 0x6d, 0xae, 0x7b, 0xb9, 0x73, 0x39, 0xd8, 0xfb, 0x9d, 0xcb, 0xbf,
+    0x7d, 0xfb, 0x78, 0x4e, 0x2c, 0xde, 0xce, 0x41, 0x50, 0x33, 0xa3, 0x40, 0xc1, 0x6c, 0x8e, 0xe7,
+    0xa9, 0x9d, 0x74, 0x3d, 0xdf, 0x00, 0xa8, 0x42, 0x99, 0xff, 0xb4, 0x24, 0xe9, 0x83, 0xbd, 0x38,
+    0x1e, 0xb5, 0x1a, 0xf4, 0x40, 0x7f, 0xa5, 0x95, 0x65, 0xc5, 0xdd, 0xc7, 0x56, 0x6a, 0x59, 0x35,
+    0x33, 0xfb, 0x7f, 0x7e, 0xfa, 0x01, 0x7c, 0xdd, 0xe5, 0xef, 0xef, 0xf9, 0xb9, 0x7e, 0xab, 0x13,
+    0x5d, 0x07, 0x6a, 0x69, 0x12, 0xd0, 0x44, 0xcf, 0xd0, 0xcc, 0xce, 0xda, 0x68, 0x08, 0x66, 0x93,
+    0x16, 0xb4, 0x20, 0x60, 0xcb, 0xc6, 0x1e, 0x68, 0x35, 0x78, 0xe0, 0x21, 0xac, 0xf2, 0x0b, 0xcc,
+    0xab, 0xab, 0x41, 0xe5, 0xe2, 0x95, 0x17, 0x25, 0x57, 0x57, 0xa5, 0xf8, 0xb7, 0xb8, 0x98, 0x28,
+    0x64, 0x6e, 0x8d, 0x32, 0xb8, 0x5a, 0x80, 0xc5, 0x80, 0x52, 0x84, 0x75, 0x41, 0xd8, 0xca, 0x34,
+    0x81, 0x55, 0x55, 0x02, 0xaa, 0x2a, 0xa9, 0x39, 0xa9, 0xa8, 0x29, 0x38, 0x50, 0x51, 0xf3, 0x17,
+    0x01, 0xd4, 0x13, 0x82, 0xa7, 0x03, 0x34, 0x13, 0x03, 0x4e, 0x76, 0x65, 0x93, 0x01, 0x26, 0xa5,
+    0x7a, 0x69, 0xa8, 0x40, 0xd2, 0x10, 0x52, 0x12, 0x81, 0x23, 0x24, 0x02, 0xf7, 0x0f, 0xd0, 0x14,
+    0x30, 0x20, 0x80, 0x00, 0x00, 0x01, 0xae, 0xd4, 0x00, 0x30, 0x85, 0xea, 0x20, 0x20, 0xcc, 0x9f,
+    0xff, 0xbf, 0xad, 0x76, 0x7d, 0x73, 0xda, 0x76, 0xd5, 0xd4, 0x4e, 0xf5, 0x9f, 0x4a, 0xd7, 0xf5,
+    0x5c, 0xd3, 0xa7, 0xf5, 0xdf, 0x39, 0xbd, 0x53, 0xc7, 0x0e, 0x9d, 0x3a, 0x73, 0xe2, 0xd0, 0x91,
+    0x33, 0x47, 0x4e, 0x9b, 0x52, 0x36, 0x65, 0xda, 0xac, 0x61, 0xa3, 0x66, 0x4d, 0x1a, 0x34, 0x6a,
+    0xce, 0xa0, 0x31, 0x73, 0xc6, 0x0c, 0x99, 0x32, 0x63, 0xc8, 0x88, 0x01, 0x33, 0x26, 0x8c, 0x98,
+    0x30, 0x5c, 0x44, 0xb7, 0x50, 0xe1, 0xc2, 0xa6, 0x65, 0x4b, 0x16, 0x2d, 0x58, 0xac, 0x64, 0xa9,
+    0x62, 0x85, 0xb4, 0x0a, 0xe9, 0x28, 0x95, 0x29, 0x50, 0x46, 0xbb, 0x53, 0xa2, 0x48, 0x01, 0xc4,
+    0x8c, 0xb2, 0xa4, 0x3e, 0xb0, 0x44, 0x09, 0x93, 0x24, 0x4a, 0x90, 0x24, 0xc1, 0x22, 0x29, 0x1b,
+    0x4b, 0x0c, 0x05, 0xfd, 0xe4, 0x24, 0x52, 0xfd, 0xb4, 0xdd, 0x74, 0xca, 0xe9, 0x7a, 0x1e, 0xb1,
+    0x2b, 0xc5, 0x8c, 0x78, 0x7e, 0x16, 0x31, 0x82, 0xc3, 0xb2, 0xc8, 0x25, 0x11, 0x22, 0x43, 0xe6,
+    0x7c, 0x27, 0x9c, 0x4d, 0x4d, 0x20, 0x98, 0x3f, 0x76, 0x00, 0xb1, 0xfa, 0xf8, 0xd1, 0xc3, 0x07,
+    0x8f, 0x1e, 0x65, 0x1e, 0x3a, 0x76, 0xe4, 0xd0, 0xd1, 0xcd, 0xcc, 0x71, 0x49, 0x89, 0xe3, 0xd2,
+    0x12, 0x47, 0xd8, 0x0d, 0x4b, 0x1b, 0x37, 0x2a, 0x6d, 0x54, 0xd6, 0x80, 0x41, 0xa3, 0xc6, 0x3d,
+    0x59, 0xa5, 0xd2, 0xb0, 0x27, 0x67, 0x7b, 0xc6, 0x60, 0x0c, 0x19, 0x4a, 0x91, 0x31, 0x1c, 0xd4,
+    0x1f, 0x56, 0x7e, 0x01, 0xe8, 0x42, 0x45, 0x79, 0xb0, 0x85, 0x8b, 0x9b, 0x70, 0x05, 0x8b, 0xf2,
+    0x8a, 0x14, 0x2a, 0x6e, 0x07, 0x74, 0x8a, 0x2a, 0x63, 0x92, 0x90, 0x8f, 0x26, 0x1c, 0x1b, 0x17,
+    0x15, 0x13, 0x0f, 0x07, 0x03, 0x01, 0xad, 0x7e, 0x7c, 0x7a, 0x7b, 0xd3, 0x38, 0xef, 0x1a, 0x5e,
+    0xd2, 0xca, 0xba, 0xaa, 0x87, 0x4c, 0x4b, 0x45, 0x43, 0x41, 0x39, 0xad, 0x9a, 0x4d, 0x98, 0x4b,
+    0x94, 0x30, 0xae, 0xd6, 0xc8, 0xa5, 0x6a, 0x9c, 0xa7, 0xd2, 0x5b, 0xe5, 0x1c, 0xa5, 0xa3, 0x55,
+    0xcf, 0x85, 0x69, 0xcb, 0xd5, 0x6b, 0x59, 0x00, 0x0a, 0xc4, 0x86, 0xbd, 0xfd, 0xb8, 0xeb, 0xdb,
+    0xa7, 0x45, 0x78, 0x2c, 0xd9, 0xd8, 0x93, 0x89, 0x8d, 0x21, 0xfd, 0x2c, 0x76, 0x44, 0x83, 0xf5,
+    0x7c, 0x55, 0x66, 0x3d, 0xc0, 0xa2, 0xa4, 0x54, 0xc0, 0x64, 0xa5, 0xaa, 0x9b, 0x6a, 0xa5, 0x23,
+    0xa3, 0x22, 0x23, 0xa2, 0x22, 0xa2, 0x02, 0x75, 0x4f, 0x5d, 0xf3, 0x5c, 0xeb, 0x19, 0x0e, 0x98,
+    0x38, 0x6f, 0xe0, 0xb8, 0x79, 0xe3, 0x26, 0x4d, 0x17, 0xcc, 0x17, 0x1f, 0x2f, 0x5d, 0xba, 0x34,
+    0x96, 0x2b, 0xe1, 0x15, 0x28, 0x4f, 0xe8, 0x26, 0x94, 0x43, 0x6c, 0x5a, 0x48, 0x90, 0x4d, 0xa6,
+    0xaa, 0xd3, 0x20, 0x99, 0x37, 0xdd, 0x82, 0x96, 0xfc, 0xa5, 0xc1, 0x27, 0x0d, 0xda, 0x3c, 0xad,
+    0xe3, 0x22, 0x45, 0xa4, 0x54, 0xa2, 0x3d, 0xf5, 0xe7, 0xd7, 0xe7, 0xc7, 0xd7, 0xc7, 0x37, 0xd6,
+    0xf3, 0x74, 0x71, 0x9e, 0x58, 0xec, 0xbf, 0xff, 0xf9, 0xd5, 0x96, 0x27, 0x03, 0x5c, 0x85, 0xb7,
+    0x0a, 0xda, 0x37, 0xed, 0x4d, 0x79, 0xbf, 0x52, 0xf6, 0x7f, 0xee, 0xb2, 0x2b, 0x96, 0x6c, 0xec,
+    0x4a, 0xf6, 0x3c, 0x73, 0x98, 0x57, 0x17, 0x57, 0xd7, 0xd6, 0x96, 0xd1, 0x51, 0x91, 0x91, 0x1b,
+    0xa2, 0x22, 0xa2, 0x3b, 0x40, 0x17, 0x28, 0xe8, 0xfe, 0xb1, 0x07, 0x81, 0x7c, 0x7a, 0x7e, 0x68,
+    0x9f, 0xff, 0x9b, 0xb0, 0xe7, 0xca, 0x33, 0xe4, 0xfa, 0x66, 0x78, 0xdb, 0x9f, 0xf5, 0xd6, 0x05,
+    0x6f, 0x57, 0xa9, 0x5f, 0xb4, 0x4f, 0x3d, 0xcf, 0x93, 0x7f, 0x87, 0x56, 0x9a, 0x0b, 0xcc, 0x7f,
+    0x9a, 0x34, 0x79, 0x27, 0xe9, 0xed, 0x88, 0xb9, 0xb9, 0xe7, 0x2a, 0xa4, 0x5f, 0xa3, 0x33, 0x95,
+    0x7b, 0xb4, 0xda, 0xc9, 0xb4, 0x99, 0xe3, 0xbe, 0xac, 0x71, 0x58, 0x7e, 0xd9, 0xa0, 0x6f, 0x54,
+    0xde, 0x35, 0x94, 0x80, 0x68, 0xca, 0x4a, 0x26, 0x4a, 0xa2, 0xc9, 0x1a, 0x49, 0x34, 0xa8, 0x93,
+    0x73, 0xd9, 0xa8, 0xc5, 0x52, 0x8a, 0x27, 0xf1, 0x40, 0xf1, 0x4f, 0x05, 0x4f, 0x0d, 0x3f, 0x3c,
+    0x78, 0xf2, 0x0b, 0x82, 0xbf, 0x7b, 0xfa, 0x4b, 0x41, 0x19, 0x3e, 0xee, 0x4f, 0xe1, 0xee, 0x37,
+    0xa5, 0x2d, 0x6a, 0xdc, 0xfe, 0xc5, 0x5e, 0x2c, 0x6c, 0xbe, 0xc3, 0x75, 0xaa, 0x75, 0x53, 0x59,
+    0x9b, 0x96, 0x0c, 0xfc, 0x0f, 0x53, 0x13, 0x7d, 0x33, 0x15, 0x29, 0x2d, 0xcd, 0x4a, 0x01, 0x9a,
+    0xae, 0x3c, 0x4d, 0xf7, 0xf5, 0x99, 0xee, 0x21, 0xdb, 0xca, 0x44, 0xd3, 0xf5, 0xd3, 0x02, 0x8e,
+    0x7a, 0x4a, 0xe9, 0x59, 0x0b, 0x35, 0x2d, 0xad, 0xc6, 0xce, 0xd8, 0xa0, 0xa3, 0xa3, 0xa2, 0x22,
+    0x22, 0xa1, 0xda, 0x87, 0xa7, 0xbe, 0x5a, 0x69, 0x28, 0x4e, 0xec, 0x26, 0x49, 0x99, 0x04, 0x7a,
+    0x24, 0xed, 0xbf, 0xbf, 0xbe, 0x3e, 0xbe, 0xea, 0x78, 0x9c, 0x97, 0x27, 0x9e, 0xe1, 0xe0, 0xde,
+    0xfe, 0xad, 0xca, 0xd6, 0x46, 0xf1, 0x1c, 0xb8, 0x32, 0xdd, 0xff, 0x9f, 0x4d, 0xb2, 0x1a, 0xd9,
+    0x03, 0xaa, 0x42, 0x54, 0x9f, 0xfa, 0xa6, 0xa9, 0xf3, 0x8f, 0x79, 0x79, 0x71, 0x71, 0x6d, 0xcd,
+    0xd7, 0xb7, 0xde, 0x33, 0x75, 0x48, 0xed, 0x82, 0x1e, 0x9c, 0x3f, 0x4f, 0x73, 0xe2, 0xc8, 0x19,
+    0x8c, 0xf3, 0x06, 0x8e, 0x9b, 0x37, 0x4e, 0xa6, 0x4a, 0x6c, 0x0e, 0xa8, 0x61, 0xf3, 0xb9, 0x46,
+    0x0d, 0x68, 0x39, 0x8d, 0x11, 0x32, 0x68, 0xce, 0x90, 0x79, 0xb4, 0xd9, 0x8c, 0x4f, 0x19, 0x2f,
+    0x5f, 0xbc, 0x8c, 0xe9, 0x8e, 0x39, 0x20, 0x26, 0x4c, 0x98, 0x07, 0xf3, 0xe5, 0x4d, 0x97, 0x2e,
+    0xa5, 0x53, 0xb8, 0x94, 0x0e, 0xbe, 0x71, 0x51, 0x22, 0xdc, 0x92, 0x45, 0x4b, 0x39, 0x0b, 0x96,
+    0x2b, 0x5d, 0x52, 0x2b, 0x8d, 0x8b, 0x89, 0xd7, 0x43, 0x43, 0xeb, 0x5f, 0x9f, 0xde, 0x75, 0xd7,
+    0xb9, 0x56, 0xba, 0x0d, 0x1a, 0x30, 0x5c, 0xe3, 0xac, 0x70, 0xda, 0xb6, 0x6b, 0x98, 0x15, 0xac,
+    0x41, 0xd7, 0xd6, 0x35, 0xcb, 0x8a, 0x65, 0x45, 0x75, 0x75, 0xb2, 0x72, 0x19, 0x6d, 0xc2, 0x24,
+    0xc9, 0x35, 0xf4, 0xd3, 0xca, 0x43, 0x47, 0xe6, 0xf5, 0xd2, 0xd2, 0x2a, 0x03, 0xc6, 0x15, 0xb1,
+    0xd0, 0x2a, 0xb8, 0x17, 0xbe, 0xde, 0x75, 0x71, 0x39, 0xab, 0x9b, 0x98, 0x96, 0xd5, 0xd3, 0x3c,
+    0x54, 0xa7, 0x0d, 0x99, 0x9f, 0x62, 0x55, 0x45, 0x35, 0x65, 0x95, 0x8a, 0x82, 0x42, 0xd0, 0xf4,
+    0x74, 0xe0, 0xea, 0xb4, 0x64, 0x20, 0x01, 0x0d, 0x08, 0x28, 0x45, 0x40, 0x14, 0x29, 0x50, 0xa4,
+    0xe6, 0x28, 0xd6, 0xf7, 0x31, 0x82, 0x12, 0xf9, 0xa4, 0x89, 0x13, 0x4f, 0x12, 0x4d, 0x18, 0x45,
+    0x15, 0x99, 0x7c, 0x26, 0x2e, 0xf1, 0xe1, 0x43, 0x09, 0x63, 0x12, 0x25, 0x48, 0x92, 0x84, 0x22,
+    0x01, 0x0d, 0x05, 0x7d, 0xfc, 0xf4, 0x3c, 0xe2, 0xc9, 0x68, 0xa4, 0x48, 0x67, 0x91, 0x21, 0x44,
+    0x84, 0x0c, 0xe1, 0xdc, 0x14, 0xf2, 0x81, 0xb3, 0x44, 0x10, 0x20, 0x9a, 0x84, 0x2b, 0x80, 0x24,
+    0xfe, 0xe8, 0xe1, 0xa3, 0x07, 0x0f, 0x1f, 0x32, 0x0a, 0x79, 0xcc, 0x98, 0xa1, 0x63, 0x47, 0x0e,
+    0x1d, 0x98, 0x99, 0x38, 0x1e, 0x53, 0xc6, 0x0c, 0x19, 0x31, 0x66, 0xc4, 0x88, 0x84, 0xb1, 0xa2,
+    0xfc, 0x62, 0xb0, 0x85, 0x8b, 0x4e, 0x23, 0x16, 0x91, 0x29, 0x54, 0x48, 0x3e, 0x92, 0x80, 0x44,
+    0x51, 0x42, 0xf1, 0x84, 0x00, 0x13, 0x8c, 0x24, 0x1c, 0x1b, 0x17, 0x13, 0x15, 0x17, 0x8b, 0x46,
+    0x20, 0x0e, 0xb1, 0x21, 0x16, 0x16, 0x1e, 0x1a, 0x1e, 0x8a, 0x08, 0x51, 0x18, 0x82, 0xb0, 0xb0,
+    0x4b, 0xf8, 0x01, 0x84, 0x07, 0x41, 0xc1, 0xc1, 0x01, 0x61, 0x47, 0x83, 0x77, 0xa0, 0x60, 0x60,
+    0x07, 0x41, 0xa4, 0x0e, 0x7f, 0x80, 0x7f, 0x7e, 0x80, 0x77, 0x7e, 0xf6, 0xb7, 0x8f, 0xaf, 0x8f,
+    0xcc, 0x47, 0x60, 0x8f, 0xac, 0xb7, 0x8f, 0xbf, 0xfa, 0x5d, 0x5e, 0x58, 0x07, 0xe7, 0xb1, 0x89,
+    0xc1, 0x61, 0x3c, 0x0e, 0x63, 0x0e, 0xde, 0xef, 0xb6, 0x00, 0xee, 0xe5, 0x72, 0xbb, 0x76, 0x76,
+    0x65, 0x5c, 0x5d, 0xbe, 0xe5, 0x6e, 0xe9, 0xb8, 0x38, 0xdd, 0x06, 0x9c, 0x06, 0xd1, 0x86, 0x39,
+    0x36, 0x0d, 0x73, 0x19, 0x34, 0x0c, 0x61, 0x88, 0x93, 0xcb, 0x5e, 0xf0, 0x84, 0xb3, 0xf0, 0x56,
+    0xa1, 0x53, 0xeb, 0x96, 0x5d, 0x11, 0xf9, 0x58, 0x82, 0x31, 0xf1, 0xce, 0xca, 0x76, 0xfd, 0x2a,
+    0x80, 0x44, 0xe0, 0xc8, 0xa8, 0x88, 0xc8, 0x3a, 0x34, 0x40, 0xc0, 0x35, 0x40, 0x12, 0xbd, 0x86,
+    0x5d, 0xb3, 0x21, 0xa8, 0x49, 0x50, 0xbb, 0x94, 0x90, 0x86, 0x86, 0x35, 0x3b, 0xfb, 0x31, 0x03,
+    0x8a, 0x50, 0x86, 0x56, 0x46, 0x06, 0xe1, 0x0b, 0x8b, 0x0c, 0x0c, 0x4c, 0x8e, 0xd8, 0x18, 0x65,
+    0xd8, 0x83, 0xcf, 0x20, 0x07, 0x5f, 0x60, 0x5f, 0x0d, 0xc0, 0x7c, 0x1a, 0xd8, 0x58, 0x5d, 0x77,
+    0xb8, 0xba, 0x32, 0xb5, 0xb6, 0x06, 0x19, 0x64, 0x7d, 0x60, 0xf0, 0xb3, 0xe0, 0x0a, 0xeb, 0xea,
+    0x1f, 0x0b, 0x8e, 0x82, 0x7f, 0x2c, 0x80, 0x38, 0x41, 0x40, 0x3f, 0x57, 0x9f, 0x1e, 0x2b, 0x17,
+    0xcf, 0x0b, 0x6d, 0x75, 0xd9, 0xc1, 0x92, 0x85, 0xf4, 0x28, 0xcb, 0x95, 0x2a, 0x58, 0xba, 0x4d,
+    0x56, 0xae, 0xdc, 0x35, 0x42, 0xad, 0xd8, 0xa0, 0x55, 0x48, 0x45, 0x45, 0x47, 0xa9, 0x48, 0xa1,
+    0x32, 0x65, 0xb4, 0x3c, 0x25, 0x8a, 0x94, 0x28, 0x4f, 0xa0, 0x34, 0x81, 0xe2, 0xe4, 0x49, 0x57,
+    0xd3, 0x49, 0x13, 0x26, 0xa2, 0x4c, 0x96, 0x88, 0x2e, 0xb1, 0x93, 0x28, 0x09, 0x55, 0x82, 0x24,
+    0x49, 0x19, 0x09, 0x68, 0xe8, 0x91, 0x4f, 0xcf, 0x23, 0x9e, 0x45, 0x8c, 0x10, 0x31, 0xd2, 0x59,
+    0xa4, 0x73, 0x48, 0x1c, 0x22, 0x42, 0x86, 0x08, 0xd9, 0xe4, 0xd4, 0xe4, 0x0c, 0xb2, 0x59, 0x0e,
+    0x02, 0xe4, 0x87, 0xa6, 0x8f, 0x1f, 0x3d, 0x7c, 0xf4, 0xd8, 0xc1, 0x23, 0x07, 0x0f, 0x1d, 0x3b,
+    0x74, 0x64, 0x82, 0xc9, 0x81, 0x99, 0x89, 0x89, 0xe3, 0xf2, 0xc6, 0xa5, 0x25, 0x8e, 0xb2, 0xa5,
+    0x8d, 0xca, 0x1b, 0x94, 0x95, 0x35, 0x28, 0x6b, 0x4c, 0xd2, 0x90, 0x41, 0x63, 0xc6, 0xa4, 0xe8,
+    0x8c, 0xae, 0x8c, 0xff, 0x18, 0x30, 0x5e, 0x48, 0xbe, 0x28, 0x43, 0x96, 0x5d, 0x98, 0x70, 0xd1,
+    0xc2, 0xb1, 0x05, 0x8b, 0x46, 0x16, 0x2b, 0x16, 0x57, 0x48, 0x42, 0x3e, 0x9a, 0x70, 0x6c, 0x5c,
+    0x54, 0x4c, 0x3c, 0x54, 0x91, 0x42, 0x32, 0x45, 0x24, 0x64, 0x24, 0x8a, 0x47, 0x14, 0x27, 0x4c,
+    0x9c, 0x28, 0xe1, 0x58, 0x82, 0x44, 0x23, 0x09, 0xc6, 0x45, 0xc6, 0x4d, 0xc5, 0x11, 0x89, 0x94,
+    0x23, 0x10, 0x0f, 0x11, 0x95, 0x44, 0x84, 0x0e, 0x8a, 0xb0, 0x0d, 0x41, 0x03, 0x0d, 0xef, 0x42,
+    0x4d, 0xbf, 0xc2, 0x10, 0xa6, 0x7c, 0x21, 0x08, 0x4b, 0xf5, 0x08, 0x41, 0x80, 0x18, 0x0c, 0x04,
+    0xf4, 0xe3, 0xd3, 0xdb, 0xc7, 0x79, 0x09, 0x3e, 0xd0, 0x0f, 0xf4, 0x5e, 0x1e, 0x06, 0x43, 0x3d,
+    0x08, 0x06, 0x82, 0x0a, 0xde, 0x1d, 0x00, 0x39, 0x3b, 0xd8, 0x7f, 0x7e, 0x9a, 0x7f, 0x7d, 0x7c,
+    0xa6, 0x7d, 0x7b, 0x7a, 0xa5, 0x7b, 0xe4, 0x5d, 0x94, 0xcc, 0x54, 0x8f, 0xf5, 0x3c, 0x18, 0xba,
+    0x38, 0x1c, 0x29, 0x06, 0x83, 0xf1, 0xc0, 0x1c, 0xbe, 0x94, 0x77, 0x1c, 0xee, 0xfe, 0xa7, 0xbc,
+    0xa6, 0x76, 0xde, 0xae, 0x1d, 0x55, 0xb7, 0xae, 0x34, 0xaf, 0xe3, 0xe6, 0x5b, 0x2e, 0x9d, 0x28,
+    0x4e, 0xb7, 0x01, 0xef, 0xdc, 0x30, 0x57, 0x4f, 0x65, 0xd0, 0xa0, 0x21, 0x0e, 0x43, 0x06, 0x39,
+    0x0c, 0xa5, 0x72, 0x17, 0xe0, 0xdc, 0x2c, 0x78, 0x7e, 0xa8, 0x00, 0xf7, 0xa6, 0xad, 0xd0, 0x99,
+    0xd5, 0x96, 0x66, 0xdf, 0xb0, 0xcd, 0x8d, 0xad, 0xcd, 0x94, 0xed, 0x4a, 0xa1, 0x74, 0x02, 0x85,
+    0xb5, 0x09, 0x6a, 0x6b, 0x01, 0x5f, 0xba, 0x3c, 0x18, 0x26, 0xa5, 0xa6, 0xa6, 0xb6, 0xb6, 0xc2,
+    0xc2, 0xc7, 0xa7, 0x4a, 0x41, 0x43, 0x52, 0xa1, 0x38, 0xf1, 0x78, 0xc2, 0xc4, 0x63, 0x09, 0x13,
+    0x8d, 0x8b, 0x89, 0x87, 0x86, 0x25, 0x1c, 0x1b, 0x49, 0x38, 0x96, 0x49, 0x30, 0x2e, 0x32, 0x2a,
+    0x26, 0x8e, 0x50, 0x1c, 0x81, 0x78, 0x28, 0x87, 0x28, 0xc2, 0xf0, 0x4e, 0x44, 0x88, 0xc2, 0x10,
+    0x84, 0x85, 0x20, 0x08, 0x3f, 0x80, 0xf8, 0x70, 0x7b, 0xf0, 0x50, 0x1e, 0xf4, 0x30, 0xf8, 0xef,
+    0x21, 0x50, 0xf0, 0xaf, 0x4f, 0x6f, 0xd7, 0xe9, 0xc0, 0x0e, 0x7f, 0x80, 0x1d, 0xa2, 0x00, 0xfd,
+    0xfa, 0xfc, 0xf8, 0xf4, 0xf6, 0xf8, 0xf6, 0xc8, 0xbb, 0x1c, 0x79, 0xac, 0xdf, 0x8d, 0xf3, 0xf2,
+    0x5e, 0x9c, 0x27, 0x0e, 0xe7, 0x81, 0xc3, 0x5d, 0x30, 0x5e, 0x88, 0x30, 0x6c, 0x6c, 0x1c, 0xbe,
+    0xe5, 0x2f, 0x1c, 0x07, 0xef, 0x5d, 0xf9, 0x4e, 0xeb, 0xed, 0xda, 0x95, 0xed, 0xda, 0xba, 0x5c,
+    0xba, 0x0d, 0x1a, 0x30, 0xc4, 0xc1, 0x69, 0xdb, 0xea, 0x72, 0x6e, 0xbe, 0xa5, 0xdb, 0xe2, 0x1b,
+    0xf0, 0x39, 0x0d, 0x73, 0x19, 0x30, 0x64, 0x90, 0x8b, 0x93, 0xbb, 0x00, 0x67, 0xe1, 0x42, 0x94,
+    0x85, 0x0a, 0xda, 0xb7, 0x0a, 0x50, 0x6f, 0xd9, 0x36, 0xb7, 0x2c, 0x02, 0x37, 0x0a, 0x6c, 0x14,
+    0x26, 0xb0, 0xc1, 0x59, 0x33, 0x9b, 0x90, 0x96, 0xa6, 0xb6, 0xb6, 0x29, 0x41, 0x4d, 0x50, 0x02,
+    0x5a, 0x1a, 0xda, 0x59, 0x9a, 0xd9, 0x99, 0xd9, 0x14, 0x84, 0x08, 0x11, 0x20, 0x60, 0xcb, 0xca,
+    0xb0, 0x63, 0x64, 0x64, 0x54, 0x63, 0x61, 0x60, 0x0d, 0xba, 0xb6, 0xb2, 0xb0, 0xac, 0x92, 0xc4,
+    0xe8, 0xff, 0x79, 0xaf, 0x07, 0x61, 0x4e, 0x0f, 0x6c, 0x07, 0x60, 0xa3, 0x0e, 0xbe, 0x1a, 0x84,
+    0xbf, 0xbc, 0xba, 0xb8, 0x78, 0x71, 0x6d, 0x69, 0x71, 0x69, 0x65, 0x15, 0x6a, 0x31, 0xc0, 0x5a,
+    0xc0, 0x20, 0x6a, 0xc1, 0x95, 0x95, 0x82, 0x2b, 0x28, 0x05, 0x09, 0xa8, 0xaa, 0x12, 0x20, 0xa8,
+    0x92, 0x9a, 0x92, 0xfa, 0x9f, 0xa2, 0xa3, 0xa0, 0xfe, 0x9d, 0x9e, 0x10, 0xbc, 0x1d, 0xfa, 0xc9,
+    0xed, 0x80, 0x81, 0x30, 0x49, 0x49, 0x4c, 0x4d, 0x4d, 0x4b, 0x4a, 0x4c, 0x7b, 0x4a, 0x56, 0x05,
+    0x90, 0x92, 0x90, 0x08, 0x24, 0x11, 0x40, 0x53, 0x54, 0x64, 0x74, 0x54, 0x3e, 0x32, 0x22, 0x2a,
+    0x22, 0x1a, 0x2a, 0x1a, 0x12, 0x30, 0xa0, 0x3c, 0x40, 0x00, 0x80, 0x00, 0xe5, 0x00, 0x00, 0x82,
+    0x84, 0xca, 0x42, 0x41, 0x40, 0x68, 0x7a, 0x7c, 0x7e, 0xa4, 0x7e, 0xc4, 0x7c, 0x78, 0x7a, 0x78,
+    0x7a, 0xae, 0xb6, 0xf5, 0x8e, 0xba, 0x47, 0xad, 0x55, 0x1b, 0xca, 0x0e, 0x57, 0x6b, 0x6a, 0x17,
+    0x01, 0x55, 0xab, 0x6e, 0xd3, 0xe6, 0xf4, 0xf4, 0xe9, 0xff, 0x59, 0xea, 0xef, 0x9c, 0xde, 0xb1,
+    0x73, 0x3a, 0x65, 0x87, 0x4e, 0x9d, 0xa8, 0x3a, 0x73, 0xe8, 0x44, 0xcd, 0x89, 0x23, 0x47, 0x0e,
+    0x9c, 0x38, 0x70, 0xdc, 0xbc, 0x29, 0xbf, 0x31, 0x75, 0xd3, 0x45, 0x60, 0xca, 0xa6, 0x0d, 0x9b,
+    0x35, 0x6d, 0xd4, 0xac, 0xa9, 0x4c, 0xa3, 0xe6, 0x33, 0xcd, 0x19, 0xa0, 0x33, 0x66, 0xd0, 0x94,
+    0x31, 0x83, 0x58, 0x66, 0x0c, 0x99, 0x31, 0x7b, 0x62, 0xc0, 0xd0, 0x06, 0xc0, 0x7c, 0x09, 0x03,
+    0xc7, 0xcb, 0x17, 0x2e, 0x5e, 0xba, 0x70, 0x49, 0x51, 0xda, 0x45, 0xab, 0x34, 0x4b, 0x96, 0x2d,
+    0x2f, 0xa6, 0x65, 0x8b, 0xe7, 0xa8, 0x16, 0x2c, 0x59, 0xb0, 0x5c, 0xc9, 0x62, 0xe5, 0x8a, 0x95,
+    0x2a, 0xa3, 0xa4, 0x54, 0xaa, 0x50, 0xd1, 0xd4, 0x94, 0x12, 0x45, 0x4a, 0x14, 0x28, 0x52, 0x9e,
+    0x40, 0x69, 0xc2, 0x24, 0x49, 0xe8, 0xe7, 0x13, 0x27, 0x4d, 0x04, 0x9d, 0x88, 0x32, 0x09, 0x8b,
+    0x2e, 0x49, 0xa2, 0x64, 0x09, 0x94, 0x12, 0x24, 0xa1, 0x72, 0x48, 0x40, 0x3f, 0xef, 0x40, 0x8f,
+    0x08, 0x7a, 0x1e, 0x29, 0x47, 0x79, 0x16, 0xe9, 0x2c, 0xd2, 0x49, 0xa4, 0xc8, 0x10, 0x21, 0x44,
+    0x66, 0x20, 0x0e, 0xf9, 0xe7, 0x14, 0xb2, 0xc9, 0x29, 0x18, 0x04, 0x08, 0x90, 0x1f, 0x9a, 0x3e,
+    0x7e, 0xf0, 0xc8, 0xbc, 0x14, 0xf2, 0x61, 0x7b, 0xf5, 0xe0, 0x21, 0xd8, 0x63, 0x87, 0x8e, 0xf0,
+    0x8e, 0x1c, 0x99, 0x30, 0x72, 0xdc, 0x98, 0x97, 0x72, 0x98, 0x38, 0x2c, 0xef, 0x70, 0xdc, 0x80,
+    0x21, 0xe3, 0xc6, 0xa4, 0x8d, 0x4a, 0x1b, 0xdd, 0x4a, 0xca, 0xc9, 0x1a, 0x32, 0x68, 0xd4, 0x28,
+    0x43, 0xd1, 0x98, 0x41, 0x39, 0x23, 0xc6, 0x24, 0x62, 0x8c, 0xc5, 0xc5, 0x16, 0x2d, 0x5e, 0xb8,
+    0x28, 0xbf, 0x10, 0x2c, 0xb3, 0x68, 0xc1, 0x62, 0x45, 0x0b, 0x15, 0x2b, 0x52, 0x48, 0xaa, 0x90,
+    0x84, 0x84, 0x8c, 0x44, 0x01, 0x89, 0xe2, 0x11, 0xf2, 0xc4, 0x63, 0xd9, 0xc4, 0x09, 0x13, 0x8e,
+    0x4d, 0x24, 0x1c, 0x49, 0x34, 0x3a, 0x7e, 0x23, 0x15, 0xa3, 0xa2, 0xe2, 0x88, 0xc5, 0xc2, 0x11,
+    0x89, 0x88, 0x87, 0x85, 0x22, 0x0e, 0x29, 0x73, 0x43, 0x11, 0x86, 0x84, 0x34, 0x1e, 0x21, 0x88,
+    0x10, 0x70, 0x3e, 0x80, 0xa0, 0xf1, 0xc1, 0x83, 0xe0, 0xa0, 0x87, 0xa8, 0xc1, 0x6b, 0xe0, 0x5e,
+    0x87, 0x40, 0xc0, 0xbf, 0x0e, 0x80, 0x7a, 0x61, 0xb2, 0xde, 0x3e, 0x26, 0xef, 0xe0, 0x3b, 0x3c,
+    0xf0, 0x97, 0x03, 0x1e, 0x07, 0x6f, 0x15, 0xee, 0xb5, 0xeb, 0x56, 0xd9, 0xd9, 0x75, 0x78, 0xce,
+    0xad, 0xa3, 0xdc, 0xd2, 0x71, 0xef, 0x4f, 0x37, 0xba, 0x0d, 0x72, 0x61, 0x73, 0x1b, 0x34, 0xcc,
+    0x65, 0xc0, 0xa0, 0x01, 0x43, 0x9c, 0xdb, 0x85, 0xb8, 0x37, 0x0b, 0x70, 0x17, 0xac, 0x62, 0x16,
+    0xd8, 0xd8, 0xfe, 0xdb, 0x9e, 0x82, 0xd6, 0x84, 0x35, 0x31, 0xb5, 0xb3, 0xb5, 0x4d, 0x09, 0x6a,
+    0x69, 0x12, 0x9e, 0xd2, 0xc8, 0xa0, 0x99, 0x45, 0x38, 0x7b, 0x32, 0x8b, 0x60, 0xcf, 0x10, 0x1e,
+    0x84, 0x39, 0x78, 0x30, 0xe4, 0x00, 0x4c, 0xeb, 0x0b, 0xac, 0x81, 0xed, 0xf5, 0x65, 0xd5, 0xe0,
+    0x9e, 0xad, 0x18, 0x5c, 0x65, 0x0d, 0x2e, 0x60, 0x90, 0x63, 0x5e, 0x40, 0x38, 0x84, 0xa5, 0xe0,
+    0x6a, 0x8a, 0x82, 0x7f, 0xaa, 0x39, 0x41, 0xd5, 0x4c, 0x35, 0xf5, 0x24, 0x35, 0x3f, 0x45, 0x41,
+    0x21, 0x58, 0x62, 0x5a, 0xfa, 0xff, 0x03, 0x75, 0x9c, 0x66, 0x03, 0xdf, 0xc4, 0xf4, 0x66, 0x56,
+    0xfa, 0x1f, 0x4a, 0x2a, 0x80, 0x94, 0x44, 0xe0, 0x08, 0x89, 0x40, 0x9d, 0x01, 0x02, 0x84, 0x82,
+    0x00, 0xb4, 0x11, 0xa2, 0xd3, 0x66, 0x0e, 0x9d, 0x8d, 0x6a, 0xa8, 0x14, 0x44, 0xbb, 0xac, 0x99,
+    0x01, 0x02, 0x00, 0x02, 0x68, 0x00, 0xc3, 0x89, 0x0d, 0xc4, 0xb3, 0x34, 0x2c, 0xa1, 0x15, 0x14,
+    0xed, 0xa0, 0x81, 0x21, 0x0e, 0x23, 0x28, 0x78, 0x01, 0x10, 0x39, 0xd2, 0x28, 0x5a, 0xc7, 0x01,
+    0x9a, 0x12, 0xe1, 0xb8, 0xd4, 0x02, 0x9f, 0x96, 0x26, 0x46, 0x53, 0xb5, 0x32, 0x74, 0x0d, 0x5b,
+    0x61, 0xcd, 0xee, 0x31, 0x70, 0x11, 0x7d, 0x15, 0x20, 0x3c, 0xf5, 0xdb, 0x9f, 0x76, 0xd6, 0x86,
+    0xb9, 0x49, 0x1c, 0x2e, 0x4f, 0xba, 0x2d, 0xd6, 0x06, 0x25, 0x3b, 0x37, 0xee, 0x47, 0x60, 0xac,
+    0x19, 0xf7, 0x13, 0xdf, 0xa9, 0x8d, 0xcf, 0x3f, 0x1c, 0x85, 0x6f, 0xa5, 0xd2, 0x83, 0x48, 0x6c,
+    0x04, 0xf8, 0x2e, 0xef, 0x5d, 0x57, 0xc6, 0xef, 0x50, 0xe3, 0x7e, 0x5f, 0x65, 0x1b, 0xa5, 0x3f,
+    0x97, 0x9f, 0x20, 0x68, 0x6c, 0x0c, 0x58, 0x6f, 0xc5, 0xae, 0xbd, 0x3e, 0xca, 0xef, 0x63, 0x8b,
+    0xd1, 0xb6, 0xfc, 0x19, 0xe7, 0x4e, 0xaa, 0xbf, 0x0c, 0xd9, 0xe7, 0xe8, 0xc4, 0x6e, 0x1b, 0xc3,
+    0x9d, 0xbf, 0xb6, 0x0a, 0xd7, 0xae, 0x02, 0x4a, 0x72, 0x58, 0x44, 0x71, 0xb5, 0xb4, 0x8b, 0x08,
+    0x6d, 0xf8, 0x09, 0xd7, 0x6d, 0x0d, 0x5f, 0x86, 0x0a, 0x83, 0x53, 0x39, 0x13, 0x4f, 0xd3, 0x23,
+    0xfc, 0x87, 0xf2, 0xf8, 0xb7, 0x1f, 0x2e, 0xae, 0xfd, 0x6c, 0xbd, 0x05, 0x7b, 0xfd, 0x67, 0x13,
+    0xc1, 0x1f, 0x33, 0xd8, 0x3b, 0x5b, 0xb4, 0xad, 0x4b, 0xb9, 0x37, 0x7b, 0xb5, 0x53, 0x66, 0x73,
+    0xda, 0xff, 0xa0, 0x71, 0xc9, 0x60, 0xa6, 0xb7, 0x50, 0x02, 0x69, 0xeb, 0xb3, 0xab, 0x5f, 0xa6,
+    0xf4, 0x91, 0xe5, 0x45, 0x7f, 0x7a, 0x46, 0x9a, 0x9e, 0x5e, 0xe0, 0xd2, 0xae, 0x55, 0x26, 0x6b,
+    0x49, 0x51, 0x06, 0x3d, 0x6f, 0xc2, 0x8d, 0xdc, 0x45, 0x1f, 0x3c, 0xe3, 0x1a, 0x3e, 0x30, 0xa5,
+    0xd0, 0xef, 0xb4, 0xd8, 0xee, 0xcd, 0x70, 0xf0, 0x7c, 0x2e, 0xbe, 0xe5, 0x4e, 0x96, 0x2a, 0x4c,
+    0xf4, 0x33, 0x99, 0x8f, 0xde, 0x37, 0x73, 0xf9, 0xb5, 0x3d, 0x61, 0x04, 0xbd, 0xa5, 0x62, 0x38,
+    0xc3, 0x2e, 0xf9, 0xd8, 0x1d, 0x10, 0x34, 0xcb, 0x2b, 0xc5, 0x30, 0x0d, 0x43, 0x7c, 0x84, 0x0e,
+    0x49, 0x47, 0x82, 0x3b, 0x4a, 0xf0, 0xdf, 0x58, 0x6b, 0xcb, 0x43, 0xdc, 0x17, 0x1f, 0x06, 0x35,
+    0x43, 0xf6, 0x0c, 0x59, 0x3d, 0x19, 0xa1, 0x79, 0xfe, 0xf8, 0x26, 0xfd, 0x64, 0xdb, 0x8f, 0x77,
+    0x0c, 0xe5, 0x8b, 0x5b, 0x2d, 0x7c, 0x16, 0x22, 0xc6, 0xb4, 0x5d, 0x5c, 0x41, 0x7f, 0xce, 0xbb,
+    0x82, 0x27, 0xae, 0xd9, 0x06, 0x07, 0xdc, 0x69, 0x63, 0x53, 0xad, 0xef, 0xe2, 0x1d, 0x1a, 0x26,
+    0x37, 0xeb, 0xfc, 0xf9, 0x57, 0x3d, 0xe6, 0xc0, 0xb9, 0x7b, 0xe2, 0x24, 0x37, 0x1e, 0x8a, 0x64,
+    0x8e, 0xe9, 0xcf, 0x3e, 0xc0, 0xe1, 0xdb, 0x9e, 0x7c, 0xf8, 0x63, 0x74, 0x94, 0xfb, 0xa9, 0xd4,
+    0xde, 0x15, 0x33, 0x5e, 0x7c, 0xc3, 0xcb, 0xa1, 0xe9, 0xf8, 0x1d, 0x96, 0xa2, 0xdc, 0x77, 0x4e,
+    0x2e, 0x6f, 0x49, 0xb7, 0x0e, 0x36, 0xbb, 0xb7, 0xd0, 0x0f, 0xc6, 0x11, 0x19, 0xac, 0x2a, 0xb2,
+    0x9c, 0x4d, 0x87, 0x08, 0xef, 0xed, 0x3e, 0x6d, 0xf8, 0x16, 0x63, 0xb3, 0xc0, 0x40, 0x6e, 0xa7,
+    0xfb, 0x56, 0x5b, 0x8f, 0xf8, 0xba, 0x39, 0x71, 0x86, 0xa6, 0x4b, 0xf6, 0x2f, 0x76, 0xad, 0xba,
+    0xd0, 0xcd, 0x62, 0x2e, 0xd8, 0x0d, 0x98, 0xa3, 0x7a, 0xb7, 0x0d, 0x65, 0x96, 0x63, 0xa8, 0x95,
+    0x7f, 0xf5, 0xd2, 0x00, 0x58, 0xc3, 0x07, 0x3e, 0x7c, 0x77, 0x09, 0x09, 0xfe, 0xce, 0xdf, 0x81,
+    0x1f, 0x42, 0xb3, 0x76, 0x69, 0xd2, 0xc1, 0xc1, 0x9c, 0x12, 0x74, 0x13, 0x67, 0x24, 0xa4, 0xf6,
+    0x95, 0xa2, 0x2a, 0xba, 0xe6, 0x1c, 0xe8, 0xb6, 0xc0, 0x32, 0x84, 0xab, 0xb8, 0x71, 0x38, 0x2d,
+    0x2d, 0x1c, 0x7c, 0x15, 0x11, 0x51, 0x4d, 0xf0, 0x0f, 0x33, 0x65, 0xf0, 0x55, 0x74, 0xa0, 0xaf,
+    0xd4, 0x32, 0x98, 0xe9, 0x06, 0x20, 0xbd, 0xaf, 0x62, 0xb9, 0x4e, 0x3d, 0x3b, 0xe9, 0x19, 0xf8,
+    0xd1, 0x38, 0x11, 0x4d, 0xe9, 0x3d, 0x3e, 0x71, 0xe5, 0x63, 0x8d, 0x83, 0x78, 0x7b, 0xb7, 0xdf,
+    0x87, 0xdb, 0x75, 0xbc, 0x1c, 0xb3, 0xdf, 0x8c, 0x6f, 0x66, 0x39, 0xf1, 0x10, 0x6d, 0x59, 0x0c,
+    0xa7, 0xcd, 0xf6, 0x46, 0x62, 0x5f, 0x7c, 0x0f, 0x04, 0x39, 0xc0, 0xe3, 0xb2, 0x0d, 0x9f, 0xfc,
+    0xbb, 0x9c, 0xeb, 0x0f, 0xd9, 0x99, 0xc0, 0x63, 0xcc, 0xfc, 0x68, 0x38, 0x92, 0xdf, 0x00, 0x68,
+    0x2e, 0x6c, 0x3d, 0xef, 0xaf, 0x72, 0xee, 0x8c, 0xe8, 0xb3, 0xc3, 0xe2, 0xc5, 0xbc, 0x9a, 0x26,
+    0xf3, 0xe4, 0xf0, 0xc9, 0x91, 0x7f, 0xc7, 0x37, 0xb4, 0x6f, 0x31, 0x12, 0x82, 0x3a, 0xb2, 0xd7,
+    0xd1, 0xc0, 0xd8, 0xfb, 0x93, 0x86, 0xc9, 0xdf, 0xbb, 0xd7, 0x71, 0x2c, 0xf7, 0x69, 0x32, 0xdd,
+    0xe7, 0x6b, 0xd4, 0x6f, 0x04, 0x5d, 0xd8, 0xb6, 0xa0, 0x3c, 0x98, 0x67, 0x2f, 0x7f, 0x68, 0xbb,
+    0xc1, 0x3c, 0x10, 0xfb, 0x91, 0x41, 0xd2, 0x9a, 0xf1, 0x6c, 0x90, 0xd7, 0x08, 0xd8, 0xd9, 0x6b,
+    0x2b, 0xb3, 0xd0, 0xc2, 0x09, 0xfd, 0x0b, 0x0d, 0x34, 0xd9, 0x0e, 0xe3, 0xc8, 0x5d, 0x3b, 0xc2,
+    0xb0, 0xf4, 0xec, 0x3d, 0xc4, 0xf7, 0x43, 0xee, 0xe9, 0xf4, 0xe6, 0x6c, 0xe8, 0xee, 0xf4, 0x0e,
+    0x3b, 0x68, 0xe1, 0x5f, 0x17, 0x1f, 0xdc, 0x27, 0xef, 0x0e, 0xda, 0x03, 0x2f, 0xee, 0x5b, 0xd5,
+    0xe3, 0xe0, 0x4b, 0xbb, 0xcb, 0x9b, 0xab, 0xd2, 0xf2, 0x3b, 0x0c, 0x39, 0x16, 0xea, 0xd3, 0x88,
+    0x69, 0x75, 0x06, 0xdb, 0x27, 0x7d, 0xfc, 0x00, 0xbc, 0xed, 0xe3, 0xfd, 0x7b, 0x7e, 0xcf, 0x77,
+    0xdd, 0x30, 0xf9, 0xef, 0xed, 0x09, 0x12, 0xe3, 0x89, 0xe8, 0x39, 0x82, 0x1f, 0x4b, 0x4b, 0xf4,
+    0xa2, 0x28, 0x0a, 0x0d, 0x7d, 0x45, 0x36, 0x3b, 0xe8, 0xc6, 0x25, 0xd5, 0x5f, 0x28, 0x71, 0x5c,
+    0xd9, 0xbd, 0xf6, 0x8c, 0x9f, 0xb3, 0x81, 0x45, 0x40, 0xc2, 0xd3, 0xda, 0x05, 0x70, 0x51, 0xe0,
+    0x1e, 0x2c, 0x6f, 0xa2, 0x13, 0x63, 0xa7, 0x39, 0x75, 0xcb, 0xa8, 0xcf, 0xc9, 0x3d, 0x48, 0x64,
+    0xdf, 0xc9, 0x4b, 0xa8, 0x3b, 0xd2, 0xa2, 0x78, 0xc1, 0xa3, 0x38, 0x28, 0x78, 0xe6, 0x70, 0xff,
+    0x0f, 0xfe, 0xfd, 0xb2, 0x2a, 0x97, 0x96, 0xef, 0x6f, 0xde, 0x89, 0xdf, 0x5d, 0x77, 0x71, 0xff,
+    0xef, 0xc3, 0xfc, 0x07, 0xb8, 0xd7, 0x12, 0x2c, 0x58, 0xa9, 0xfe, 0xfe, 0xc6, 0xe3, 0x80, 0x52,
+    0xde, 0xea, 0xee, 0x0e, 0x27, 0x7d, 0x91, 0x8a, 0x6d, 0xb5, 0xba, 0x1d, 0x02, 0xb3, 0x8a, 0x03,
+    0x90, 0x59, 0xe3, 0x42, 0x17, 0xb2, 0xcc, 0x6a, 0x87, 0xe2, 0x4c, 0x07, 0x9c, 0xd8, 0x63, 0x0e,
+    0x3c, 0x7e, 0xa9, 0x7b, 0x93, 0xd3, 0x1c, 0x3c, 0xae, 0x78, 0x15, 0xb2, 0xd1, 0x05, 0x2c, 0x0d,
+    0xf3, 0x0f, 0x85, 0xd0, 0x38, 0xb0, 0x63, 0x06, 0xd1, 0x45, 0x7e, 0x23, 0xbc, 0x9f, 0xc0, 0xa5,
+    0x2c, 0x18, 0x3f, 0xc1, 0x81, 0xf6, 0xff, 0x06, 0x12, 0x7c, 0x78, 0x03, 0x9c, 0x5a, 0x06, 0x17,
+    0xd7, 0x94, 0x7d, 0x27, 0x28, 0x13, 0x78, 0x8e, 0xdf, 0xca, 0xef, 0xbe, 0x69, 0xce, 0xd5, 0xf6,
+    0x6c, 0xc4, 0x48, 0x9a, 0x45, 0xc1, 0xb8, 0x8e, 0x49, 0xb8, 0x7d, 0xce, 0x89, 0x15, 0x77, 0x02,
+    0x33, 0xf3, 0x39, 0x60, 0x9b, 0x32, 0xab, 0xb1, 0x7a, 0x1a, 0x33, 0x83, 0x7b, 0xb6, 0xb8, 0x38,
+    0x9c, 0x2e, 0xee, 0x60, 0xd9, 0xd1, 0xed, 0x6c, 0xc6, 0xd3, 0xff, 0xa7, 0xef, 0x06, 0x93, 0xba,
+    0x22, 0x8f, 0x19, 0x3e, 0xfa, 0xd3, 0xed, 0x4f, 0x69, 0x5e, 0x9e, 0xa6, 0xe4, 0xe6, 0x43, 0x60,
+    0xdb, 0xd2, 0xe7, 0x30, 0x4c, 0x8d, 0x8d, 0xe3, 0xb5, 0xde, 0x8c, 0x53, 0xed, 0xeb, 0x98, 0xe9,
+    0x8d, 0x0c, 0x89, 0xc3, 0x79, 0x08, 0x2d, 0x5e, 0x03, 0xbe, 0x62, 0x20, 0x6f, 0x7c, 0xce, 0x74,
+    0x39, 0xfc, 0xeb, 0xe7, 0x4f, 0x5e, 0x47, 0x8b, 0x9f, 0xe4, 0xbb, 0xec, 0xb4, 0xfa, 0xad, 0x67,
+    0x81, 0x17, 0xa4, 0x05, 0x74, 0x97, 0x7f, 0x77, 0x3f, 0x6c, 0x5f, 0xe1, 0x2e, 0xbc, 0xa8, 0x2f,
+    0xa7, 0xc5, 0x6d, 0xc9, 0xdb, 0x89, 0xa3, 0xb2, 0xe8, 0x7e, 0x2c, 0x43, 0xe4, 0xdd, 0x77, 0xb7,
+    0x3b, 0xb9, 0x64, 0xed, 0xde, 0x7d, 0x44, 0x16, 0xaf, 0x2d, 0x2b, 0x9e, 0xfd, 0x61, 0x5a, 0x5c,
+    0x22, 0x0d, 0xb9, 0xe9, 0xd2, 0xd7, 0x5e, 0x64, 0x91, 0x61, 0xc9, 0xcf, 0x19, 0xd9, 0x14, 0x5a,
+    0x6e, 0xe3, 0xdc, 0x8f, 0xb9, 0xbe, 0xfc, 0xfe, 0xe6, 0x7f, 0xfd, 0x17, 0x3a, 0xe7, 0x7e, 0x76,
+    0x1a, 0xc7, 0xd6, 0xd9, 0xa3, 0x5a, 0xb7, 0xe5, 0x76, 0xf6, 0x94, 0x9f, 0xfd, 0x8d, 0x93, 0x7a,
+    0x8a, 0xdb, 0xa2, 0x1f, 0x03, 0x22, 0xb0, 0x39, 0x18, 0x3e, 0xec, 0x32, 0x2c, 0xb8, 0xdf, 0x89,
+    0xf4, 0xd7, 0xb0, 0x0d, 0xe6, 0x38, 0x0e, 0xb5, 0x03, 0x1b, 0xc4, 0xd8, 0xdf, 0x0d, 0xad, 0xc8,
+    0x1c, 0x2d, 0xff, 0x24, 0x1b, 0xb6, 0x25, 0x9c, 0xc2, 0x74, 0x63, 0x36, 0xa5, 0x3b, 0x58, 0x03,
+    0xed, 0x8d, 0xf3, 0xcd, 0xee, 0x82, 0x9e, 0x35, 0x83, 0x21, 0xf5, 0x09, 0xda, 0x82, 0x98, 0xdd,
+    0x98, 0xbc, 0xc4, 0xbf, 0x79, 0x8b, 0xaf, 0x91, 0xe4, 0xf4, 0x7e, 0xe7, 0x64, 0xde, 0xb9, 0xfa,
+    0xa5, 0xcf, 0xfc, 0x13, 0xfd, 0x8d, 0xf7, 0xec, 0x58, 0x30, 0x6b, 0x95, 0x83, 0xb8, 0xaf, 0x93,
+    0xfb, 0x8a, 0x7c, 0x5b, 0x7e, 0x3a, 0xe7, 0x93, 0xaf, 0xd6, 0x97, 0xf8, 0x0e, 0x78, 0x0e, 0x76,
+    0xee, 0xa5, 0x7d, 0x0e, 0x7a, 0x5b, 0xdb, 0xd8, 0x5d, 0x2d, 0x26, 0x0b, 0x67, 0x4a, 0xba, 0x39,
+    0xac, 0x38, 0x5f, 0x03, 0x42, 0xbd, 0xc6, 0x84, 0xed, 0x43, 0x56, 0xec, 0xbc, 0xe5, 0xe3, 0x7e,
+    0xdb, 0x6d, 0xa8, 0x78, 0xbe, 0x6b, 0x8a, 0x55, 0xcb, 0x8f, 0x04, 0x5f, 0x42, 0x7f, 0xf6, 0xab,
+    0xf1, 0x6e, 0x8f, 0x8b, 0xb9, 0x49, 0xaa, 0xe7, 0x58, 0xe8, 0xd2, 0xa8, 0xff, 0x8a, 0xee, 0x77,
+    0x2a, 0x50, 0xe7, 0xa0, 0x01, 0x38, 0xc9, 0xf9, 0x1d, 0x42, 0x0a, 0xb3, 0x5e, 0xf9, 0xfa, 0xeb,
+    0x56, 0x7f, 0xdb, 0xa8, 0x0e, 0x65, 0x8c, 0x1a, 0x1a, 0x13, 0x1d, 0xfe, 0x05, 0xa2, 0x06, 0x7f,
+    0xe3, 0x57, 0xe8, 0xc6, 0x74, 0xea, 0x77, 0xdf, 0xf5, 0xd3, 0x76, 0x7b, 0x40, 0xfe, 0xbc, 0x14,
+    0x33, 0xfc, 0xc2, 0x4c, 0x08, 0xfc, 0x51, 0x69, 0xee, 0x15, 0x44, 0xae, 0x38, 0x00, 0xd8, 0x69,
+    0xc6, 0xd1, 0xde, 0xe1, 0x73, 0xc9, 0xe9, 0xa9, 0x59, 0xd3, 0x3a, 0x5a, 0xa7, 0x41, 0x07, 0x62,
+    0x0f, 0x79, 0xab, 0xfb, 0x48, 0xb7, 0xa8, 0x5d, 0x04, 0x56, 0xb1, 0x54, 0x34, 0x83, 0xf6, 0xc3,
+    0x71, 0x98, 0x7b, 0xcf, 0x4d, 0xc1, 0xfb, 0xdc, 0x43, 0xd5, 0xb1, 0xa3, 0x78, 0x7f, 0xd1, 0x56,
+    0xf7, 0x32, 0xea, 0x30, 0x8e, 0xf7, 0x3f, 0x3c, 0x73, 0xea, 0x39, 0x66, 0xef, 0xe3, 0x70, 0x71,
+    0xb5, 0x9e, 0xe8, 0x03, 0xf5, 0xee, 0xbb, 0xf9, 0x40, 0xf9, 0xab, 0x5f, 0xca, 0xfc, 0xfc, 0xb2,
+    0x4f, 0x0b, 0x71, 0xc1, 0xca, 0x87, 0xa3, 0x5c, 0x32, 0xee, 0xdf, 0x51, 0xfa, 0x75, 0xd6, 0xb3,
+    0x76, 0x32, 0x77, 0xfe, 0xab, 0xcb, 0x0f, 0xf9, 0xef, 0xc6, 0x60, 0xce, 0x08, 0x45, 0x8b, 0x39,
+    0xf0, 0x76, 0x8a, 0x3d, 0xed, 0x10, 0x50, 0x0d, 0x96, 0x8a, 0x39, 0xd8, 0x75, 0x78, 0x53, 0xab,
+    0x2b, 0x42, 0x1e, 0x03, 0xa2, 0x09, 0xbd, 0xba, 0x3f, 0x72, 0x4d, 0xae, 0xd7, 0x51, 0x1c, 0xea,
+    0x2d, 0x4f, 0x84, 0x43, 0xfe, 0x4e, 0x76, 0xec, 0xc0, 0xce, 0xd8, 0x5b, 0xec, 0x51, 0xe7, 0xcc,
+    0x51, 0xa2, 0x4d, 0x8e, 0x39, 0x93, 0xde, 0xbe, 0x3a, 0x54, 0x05, 0x64, 0x5e, 0x41, 0x00, 0x9f,
+    0xc1, 0xc6, 0x2f, 0x82, 0xef, 0xfc, 0xbc, 0xe6, 0xf1, 0x57, 0xea, 0xa2, 0x7f, 0x19, 0x4f, 0x6a,
+    0x84, 0x97, 0x36, 0xc2, 0x38, 0xb0, 0x1c, 0xd3, 0x26, 0xea, 0xdd, 0x31, 0xe8, 0x3e, 0x84, 0x7a,
+    0xb9, 0xa4, 0x3c, 0xba, 0xfd, 0x18, 0x61, 0x2b, 0x8b, 0xd9, 0xf9, 0xf0, 0x1e, 0x8f, 0x81, 0x98,
+    0x76, 0x15, 0x6f, 0xf3, 0xe2, 0xd1, 0xde, 0x7a, 0x1a, 0xe9, 0xf0, 0xb2, 0xeb, 0x61, 0x98, 0x5f,
+    0x79, 0xb5, 0xb3, 0xe0, 0xdc, 0x05, 0xfa, 0x22, 0x42, 0xe5, 0x8e, 0x51, 0x5e, 0x13, 0x8e, 0x9f,
+    0x3e, 0xfe, 0x8b, 0xb2, 0xa8, 0xf3, 0x6f, 0xcf, 0x2e, 0x91, 0x06, 0x5d, 0x6d, 0x9c, 0x7b, 0xfb,
+    0xc8, 0x9f, 0x07, 0x36, 0xff, 0xeb, 0xf8, 0xa9, 0x32, 0xf6, 0x30, 0xe0, 0xab, 0xe3, 0xf7, 0x59,
+    0x93, 0xa2, 0xf9, 0x53, 0x41, 0x7c, 0x64, 0x9f, 0xa9, 0xde, 0x4e, 0x01, 0x7c, 0xd2, 0x7c, 0xa7,
+    0x99, 0x05, 0x74, 0xb6, 0x09, 0x19, 0x60, 0x1a, 0xbf, 0x58, 0x33, 0x0f, 0x24, 0xce, 0x91, 0xc3,
+    0xe2, 0xef, 0x1d, 0xd8, 0xf0, 0xeb, 0xb8, 0xa2, 0xd9, 0x0c, 0x56, 0x58, 0x70, 0xbd, 0xff, 0x1f,
+    0xcd, 0x29, 0x3e, 0x5f, 0xd4, 0xf2, 0x1d, 0x3f, 0xfc, 0xbf, 0x40, 0x13, 0x98, 0x64, 0x77, 0x45,
+    0xd8, 0x1f, 0x04, 0xde, 0xfa, 0xdc, 0x10, 0x7d, 0xa2, 0xd4, 0xe4, 0xc3, 0x25, 0xba, 0x05, 0xfb,
+    0xfb, 0x42, 0xd8, 0x6e, 0x5e, 0xdc, 0x64, 0xcb, 0x53, 0x47, 0x52, 0x75, 0xd2, 0x6a, 0xf6, 0xd4,
+    0x75, 0x16, 0xfc, 0x35, 0x7e, 0xcc, 0x0e, 0xa8, 0xf4, 0xcf, 0xfe, 0x4d, 0x17, 0x4f, 0x47, 0xd3,
+    0x4f, 0x59, 0x25, 0xcf, 0x78, 0xf0, 0x9f, 0xf2, 0xf6, 0xea, 0x3a, 0xbf, 0xfc, 0x92, 0x66, 0x8f,
+    0x09, 0x89, 0x11, 0x1c, 0x25, 0x73, 0xa4, 0xcd, 0x60, 0xb5, 0x87, 0xd3, 0x7d, 0xd0, 0xf2, 0x39,
+    0x27, 0x7a, 0xd8, 0x2f, 0xf5, 0x49, 0xe9, 0xd5, 0xde, 0x82, 0xe9, 0x56, 0x77, 0xda, 0x21, 0x4f,
+    0x79, 0xae, 0x85, 0xed, 0x09, 0x4f, 0x83, 0xce, 0x85, 0x06, 0x5b, 0x38, 0x57, 0x6d, 0x99, 0x54,
+    0x19, 0x4f, 0xd3, 0x77, 0xeb, 0x64, 0xad, 0x06, 0xef, 0x1f, 0xa9, 0xa3, 0xbf, 0x2a, 0xb3, 0x2e,
+    0xcc, 0x47, 0xad, 0x73, 0x25, 0x3f, 0x1d, 0x92, 0x5d, 0x73, 0x3e, 0x61, 0xfb, 0x57, 0x1a, 0xb8,
+    0x07, 0x8f, 0x4e, 0x65, 0x13, 0x9f, 0x67, 0xc0, 0xa7, 0x80, 0xbd, 0xed, 0x7d, 0x04, 0x08, 0x58,
+    0x8e, 0x5e, 0x18, 0x9f, 0x63, 0x19, 0xf3, 0x86, 0xd9, 0x2d, 0xf1, 0x44, 0x3e, 0xfa, 0x8b, 0x2c,
+    0xeb, 0x84, 0x6c, 0x0e, 0x6b, 0x32, 0x36, 0x0f, 0x0f, 0x00, 0xde, 0x1a, 0x93, 0x08, 0x59, 0x7f,
+    0xf7, 0x0b, 0xfd, 0x09, 0x8f, 0xb9, 0xdb, 0x72, 0x59, 0x43, 0x59, 0x0b, 0x4f, 0x54, 0xbb, 0x11,
+    0x92, 0x6b, 0xf1, 0xd1, 0x26, 0x58, 0x9d, 0xdd, 0x4a, 0xbe, 0x7a, 0x32, 0x3c, 0x5a, 0x7f, 0xc2,
+    0x62, 0xe1, 0xf9, 0x0a, 0x79, 0xad, 0x01, 0x86, 0x4d, 0x9a, 0xa5, 0x6e, 0x9a, 0x9c, 0xd8, 0x31,
+    0xd6, 0xa0, 0xb6, 0x98, 0x77, 0x3d, 0x5d, 0x2c, 0x94, 0xa4, 0x21, 0xde, 0xa6, 0xb6, 0xe9, 0xb3,
+    0xe3, 0xfd, 0xb4, 0x9d, 0x02, 0xcf, 0x9f, 0xae, 0x48, 0x62, 0x34, 0xc4, 0xaa, 0xdc, 0x3b, 0x07,
+    0xec, 0x4f, 0x64, 0xe8, 0x42, 0x28, 0x1a, 0x19, 0xf4, 0x2f, 0xda, 0x7f, 0xd8, 0x2e, 0x95, 0x01,
+    0xc8, 0xfd, 0xed, 0xfb, 0x77, 0x5b, 0xeb, 0xf9, 0x34, 0x05, 0x81, 0x42, 0x17, 0x53, 0xaa, 0x47,
+    0xb6, 0x56, 0x31, 0x8f, 0x3d, 0xaa, 0x6d, 0x7b, 0x2a, 0xd5, 0xca, 0xc4, 0xf9, 0x33, 0xf3, 0x6a,
+    0x0f, 0xe7, 0x85, 0x04, 0xe2, 0xa0, 0xf5, 0x27, 0x4f, 0xd3, 0x74, 0x82, 0xf8, 0x75, 0xfc, 0xec,
+    0x82, 0x78, 0xf6, 0x5c, 0xbc, 0x93, 0xbf, 0x62, 0x4d, 0x27, 0x45, 0x40, 0xa2, 0x16, 0x6d, 0xfe,
+    0xca, 0x31, 0x18, 0xc9, 0x93, 0x46, 0x42, 0xa2, 0x17, 0x90, 0x85, 0x02, 0x1f, 0x50, 0xd6, 0xdb,
+    0xe3, 0x3e, 0x0b, 0xd0, 0x8e, 0xb5, 0x3d, 0xbf, 0x3e, 0x41, 0x0d, 0xb8, 0xf8, 0xff, 0x71, 0x8d,
+    0x75, 0xaf, 0xc0, 0xc3, 0xdd, 0xed, 0x25, 0x87, 0x9e, 0xe4, 0x31, 0x3b, 0xad, 0x89, 0x80, 0xde,
+    0x65, 0xcf, 0xe2, 0x7b, 0xe4, 0xde, 0x77, 0xed, 0xab, 0x4d, 0xc5, 0x55, 0x35, 0x18, 0xce, 0x79,
+    0x48, 0xac, 0xf1, 0xff, 0xfd, 0xdd, 0xb8, 0xec, 0x71, 0x02, 0x2b, 0x33, 0xfd, 0x20, 0xf4, 0x1f,
+    0x7a, 0xf9, 0x3a, 0x2d, 0x96, 0xc5, 0x53, 0x3d, 0xc6, 0x38, 0x79, 0x93, 0xc8, 0x98, 0x39, 0x18,
+    0x30, 0xd7, 0xad, 0xa1, 0xca, 0xc1, 0x7d, 0x5b, 0xbe, 0x6f, 0x8b, 0x25, 0xdc, 0x72, 0xae, 0x06,
+    0xbd, 0x68, 0x21, 0x9e, 0xbd, 0xdd, 0xb9, 0x7f, 0xf8, 0x8a, 0x08, 0xb3, 0xaf, 0x68, 0x4f, 0x0c,
+    0x37, 0x48, 0xa6, 0x80, 0xfe, 0x58, 0x7e, 0x73, 0x3d, 0xfd, 0x01, 0xb1, 0xfe, 0x38, 0xa3, 0x16,
+    0x7b, 0xd5, 0xc3, 0x66, 0x17, 0x27, 0x33, 0x21, 0x13, 0xa4, 0xdd, 0x9c, 0xa7, 0xa4, 0x7a, 0x48,
+    0xb3, 0x38, 0x7d, 0xe6, 0x7f, 0x3f, 0xed, 0x6a, 0x27, 0x78, 0x4f, 0x1e, 0xde, 0x6d, 0x18, 0xf0,
+    0x30, 0xf7, 0xad, 0x87, 0x93, 0x6a, 0x3a, 0x02, 0x6e, 0x74, 0xc6, 0x88, 0xfd, 0xad, 0x91, 0x3b,
+    0x6b, 0x82, 0x93, 0x4e, 0xa1, 0x2b, 0xd7, 0x35, 0xff, 0x2f, 0x3e, 0x8d, 0xf9, 0x51, 0xda, 0xfc,
+    0x8e, 0x51, 0x93, 0x0f, 0x77, 0x38, 0x1f, 0x36, 0xa5, 0x7e, 0x41, 0xc2, 0xc2, 0x20, 0x69, 0x72,
+    0xdf, 0xe5, 0x2b, 0xb3, 0xc6, 0xe4, 0xf3, 0x26, 0xb6, 0x0f, 0x02, 0x62, 0x99, 0xa6, 0xec, 0xed,
+    0xfa, 0xba, 0x47, 0x33, 0xcc, 0x56, 0x95, 0xc3, 0x81, 0x96, 0xe7, 0xa5, 0x81, 0xe7, 0x99, 0x21,
+    0xee, 0xa6, 0xbe, 0x18, 0xf0, 0xaf, 0xf8, 0xa1, 0xe2, 0x90, 0xa7, 0xd5, 0xf3, 0xd0, 0x03, 0xdb,
+    0x92, 0xb8, 0xc0, 0xb3, 0x39, 0xae, 0x85, 0xad, 0xcf, 0x96, 0x5f, 0xad, 0xec, 0xa4, 0x61, 0xf2,
+    0x49, 0xc4, 0x15, 0xb5, 0x17, 0x65, 0x68, 0xde, 0x77, 0x4b, 0x21, 0xac, 0x37, 0xf5, 0xeb, 0xe9,
+    0xbc, 0xd0, 0x1d, 0x41, 0xf7, 0xe7, 0x7d, 0x00, 0xb3, 0xb6, 0xef, 0xe3, 0x40, 0x17, 0xd2, 0x4b,
+    0x93, 0x98, 0x60, 0x3d, 0x59, 0xb0, 0x77, 0x7c, 0x3d, 0xeb, 0xa6, 0x31, 0xc7, 0x87, 0x4f, 0x10,
+    0x6b, 0xb1, 0xc6, 0x32, 0x9d, 0x4c, 0xc2, 0xcd, 0x79, 0xef, 0x1d, 0x4d, 0x50, 0xdd, 0xfa, 0xba,
+    0x3b, 0xdb, 0x5c, 0x97, 0xc9, 0x42, 0xda, 0x66, 0xfc, 0xef, 0x8e, 0xa3, 0x78, 0x22, 0xf6, 0x95,
+    0xd6, 0x76, 0x64, 0x9d, 0x11, 0xd8, 0x17, 0xbf, 0xfc, 0x37, 0x66, 0x0e, 0xf7, 0xb9, 0xb3, 0x18,
+    0xbf, 0x64, 0x5b, 0xdd, 0x07, 0x68, 0x18, 0x5c, 0xf2, 0xa7, 0xcd, 0x52, 0x9b, 0xe1, 0x53, 0x6f,
+    0xe2, 0xb7, 0x02, 0xf2, 0xc7, 0x5b, 0x10, 0x83, 0xc6, 0x38, 0x78, 0xe1, 0xcd, 0x0a, 0x7c, 0x5c,
+    0x80, 0xf0, 0x1e, 0xa9, 0x98, 0x28, 0x47, 0x23, 0x06, 0x62, 0x86, 0x00, 0x3f, 0x54, 0xc2, 0x40,
+    0xe6, 0xe4, 0xd8, 0x83, 0x52, 0x77, 0x89, 0xeb, 0x11, 0x59, 0x8f, 0xd0, 0xc0, 0x11, 0xb9, 0xb4,
+    0x71, 0xaa, 0x24, 0xff, 0x7a, 0x10, 0xae, 0x94, 0xd2, 0x4b, 0x75, 0xc9, 0x8b, 0x06, 0x9b, 0x6e,
+    0xa5, 0x1d, 0x34, 0xf5, 0xdf, 0x46, 0x7b, 0x5e, 0xc3, 0x13, 0xee, 0x9d, 0x39, 0xe3, 0x1f, 0x07,
+    0xc1, 0x01, 0x3a, 0x9a, 0x99, 0xce, 0x77, 0x2a, 0xff, 0x5f, 0x2a, 0x7e, 0xc2, 0x1e, 0x74, 0xf8,
+    0x58, 0x7c, 0x23, 0x97, 0x82, 0x0f, 0x7d, 0xbf, 0x52, 0x74, 0xd7, 0x55, 0x59, 0x79, 0x3f, 0x5a,
+    0x57, 0xa7, 0x2e, 0x66, 0x78, 0xce, 0xbf, 0xca, 0x80, 0x94, 0x1b, 0xe2, 0x59, 0xb0, 0xc7, 0x3d,
+    0x7d, 0xe0, 0x36, 0x41, 0xc5, 0xed, 0xbc, 0xb7, 0x04, 0x4b, 0x9d, 0x2e, 0xa6, 0xf4, 0xe8, 0x8b,
+    0x3f, 0x56, 0xad, 0x8b, 0x19, 0xf1, 0xbf, 0x3d, 0xc7, 0x44, 0xb9, 0x32, 0x75, 0xf0, 0x77, 0x30,
+    0x4b, 0xf9, 0x8b, 0x04, 0x9f, 0x02, 0xed, 0xc7, 0x01, 0xbf, 0x18, 0x7f, 0xd8, 0x38, 0x60, 0xdc,
+    0xa0, 0x36, 0xb5, 0x0f, 0x8c, 0x8e, 0x2b, 0x56, 0x4c, 0xd8, 0x9a, 0x3e, 0x88, 0xf4, 0x7e, 0xfc,
+    0x05, 0x3a, 0x3c, 0xe5, 0x0a, 0x86, 0x1c, 0x62, 0x67, 0x77, 0xe8, 0x81, 0x14, 0xf5, 0x66, 0x4a,
+    0x5a, 0xea, 0xe9, 0x60, 0x65, 0x1b, 0x8a, 0x93, 0xd6, 0x86, 0xe8, 0xe8, 0x74, 0x74, 0xaa, 0x9b,
+    0xa5, 0x5e, 0xbe, 0xe0, 0x70, 0xc8, 0x36, 0x70, 0xb4, 0x1f, 0xea, 0x79, 0xfb, 0x63, 0xcc, 0x96,
+    0x6f, 0x23, 0xfe, 0x6b, 0xa3, 0x42, 0x87, 0xd0, 0x1f, 0x2a, 0x8d, 0xad, 0x07, 0x2b, 0xe1, 0x65,
+    0xa0, 0x3a, 0x67, 0xae, 0x79, 0xc7, 0x01, 0xc2, 0x29, 0x12, 0xb5, 0xe7, 0x1e, 0x4c, 0xb3, 0x96,
+    0xdf, 0x8a, 0xeb, 0x4b, 0xe3, 0x61, 0xee, 0x57, 0xbb, 0xd9, 0xe0, 0xbb, 0xa4, 0xa4, 0xde, 0xc7,
+    0x8e, 0x9c, 0x1c, 0x94, 0xa1, 0xf6, 0x5e, 0x70, 0x5c, 0x4d, 0x25, 0x37, 0xeb, 0x37, 0x5c, 0x86,
+    0x63, 0x2f, 0x61, 0x70, 0xff, 0xf4, 0xd7, 0xb6, 0x83, 0xe8, 0x63, 0x8e, 0x5e, 0x47, 0x27, 0x14,
+    0xc8, 0x61, 0x8e, 0x57, 0x16, 0x30, 0x4b, 0xaf, 0x83, 0x63, 0xda, 0xba, 0xa1, 0xa6, 0x1e, 0x86,
+    0x4b, 0x47, 0x79, 0x9f, 0xe0, 0x99, 0xdb, 0xbc, 0x60, 0xe0, 0xfd, 0x6e, 0x66, 0x7f, 0x03, 0x43,
+    0xb7, 0xf7, 0xb5, 0x51, 0x7f, 0x7b, 0xd3, 0x72, 0xe8, 0x96, 0x27, 0x0d, 0x2e, 0x81, 0xf8, 0x09,
+    0xe3, 0x71, 0xf6, 0xb5, 0x07, 0x92, 0x98, 0xee, 0x0f, 0x60, 0xc7, 0x5e, 0xa0, 0xfb, 0x49, 0x7e,
+    0x39, 0x7f, 0x72, 0x83, 0x78, 0x37, 0x65, 0x4d, 0xd5, 0x94, 0x4f, 0xa0, 0xb1, 0x09, 0xf1, 0xe5,
+    0x7f, 0xf9, 0xaa, 0x8f, 0xc5, 0x6c, 0xc5, 0x17, 0x77, 0xf3, 0x19, 0xdd, 0xef, 0x4c, 0x6d, 0x7f,
+    0x25, 0x21, 0x5c, 0x34, 0xf2, 0xac, 0x5e, 0x00, 0xd5, 0x8e, 0xd1, 0xf8, 0x2f, 0x9a, 0x53, 0x86,
+    0xbb, 0xc0, 0x95, 0x26, 0xc9, 0x02, 0x3d, 0x34, 0x13, 0x0e, 0xaf, 0x1a, 0x74, 0xbb, 0x17, 0xd5,
+    0x9f, 0x7a, 0x0d, 0x66, 0xfa, 0xbe, 0x6c, 0x18, 0x21, 0x60, 0xd5, 0xce, 0xf7, 0x46, 0xbc, 0xbe,
+    0xca, 0x3d, 0x0d, 0x5f, 0x0b, 0x2e, 0xdc, 0xf0, 0x61, 0x16, 0xc1, 0x1a, 0xf5, 0xd9, 0x11, 0x6e,
+    0x26, 0xdf, 0xd0, 0xe6, 0x03, 0x12, 0x58, 0xaa, 0x58, 0x0d, 0x3c, 0x48, 0x8c, 0xa9, 0xc3, 0x2c,
+    0x56, 0x23, 0x79, 0x0a, 0xe2, 0x10, 0x5b, 0xb9, 0xc3, 0x17, 0xbb, 0x16, 0xe0, 0xbe, 0x22, 0x71,
+    0xbe, 0xae, 0x55, 0xd1, 0x62, 0x90, 0xd8, 0x93, 0x91, 0xf4, 0x5a, 0x77, 0xd0, 0x1f, 0x4b, 0xac,
+    0xcd, 0x37, 0x7c, 0xe0, 0x59, 0x2a, 0x58, 0x23, 0x3e, 0x23, 0xfb, 0x47, 0x03, 0xf1, 0x1e, 0xf7,
+    0x44, 0xe3, 0x0f, 0x58, 0x18, 0xe0, 0xd8, 0x71, 0xef, 0x93, 0x2b, 0xe3, 0x04, 0x40, 0xe2, 0xa1,
+    0x50, 0x61, 0xdd, 0x55, 0xba, 0x9b, 0xf4, 0x54, 0x8f, 0x8c, 0x7f, 0x00, 0x50, 0x34, 0x84, 0x2c,
+    0x56, 0x6e, 0x9f, 0x03, 0xea, 0x81, 0x5a, 0x0e, 0xf0, 0x6d, 0x4e, 0x07, 0x89, 0x3d, 0x64, 0x1d,
+    0x4f, 0x40, 0x19, 0x59, 0x49, 0x48, 0x1a, 0xea, 0x64, 0x60, 0x11, 0x99, 0xbc, 0x33, 0x6e, 0x7f,
+    0x3b, 0x3f, 0x9e, 0x4c, 0xe5, 0xe5, 0x50, 0xb1, 0x3d, 0x4b, 0xef, 0x1a, 0xe9, 0x38, 0xf9, 0xc8,
+    0x22, 0xda, 0x7c, 0x45, 0x2f, 0xc9, 0x1f, 0xad, 0xf4, 0x2a, 0x41, 0x70, 0x0f, 0x20, 0xa4, 0x85,
+    0x2c, 0x57, 0xe3, 0xf4, 0xd3, 0x38, 0x1f, 0xf2, 0xe5, 0xfa, 0xd2, 0x48, 0xaa, 0x2f, 0x53, 0xe4,
+    0xfa, 0xc6, 0x38, 0x13, 0xff, 0x1e, 0x36, 0x63, 0x0d, 0x03, 0xa9, 0x93, 0x81, 0x81, 0xb1, 0x76,
+    0xd0, 0x6f, 0xe0, 0xf8, 0xbd, 0x75, 0x9d, 0x57, 0xbd, 0x46, 0x68, 0xcc, 0x16, 0x25, 0x57, 0xe3,
+    0x47, 0x8f, 0x7b, 0x53, 0x98, 0x18, 0x67, 0x9a, 0xd3, 0xac, 0xa5, 0x77, 0x57, 0x48, 0xbd, 0x8c,
+    0x2d, 0x9a, 0x6c, 0x9c, 0x41, 0xa2, 0x0f, 0x6e, 0xe8, 0x98, 0x25, 0xe5, 0xed, 0x0f, 0x1d, 0x2c,
+    0xcc, 0xe3, 0x96, 0x9f, 0x3e, 0xb2, 0xe6, 0xce, 0xed, 0xf5, 0xab, 0x1b, 0x4a, 0x7b, 0x7d, 0x58,
+    0xc5, 0x93, 0xb7, 0xd9, 0xff, 0x4e, 0x0d, 0x91, 0x11, 0xbc, 0x94, 0xd3, 0x90, 0x9e, 0xd0, 0x28,
+    0x36, 0x09, 0xc1, 0x6e, 0x1d, 0xca, 0x06, 0xae, 0xf5, 0x04, 0x77, 0x47, 0x60, 0x2d, 0x51, 0xd0,
+    0xe6, 0xc5, 0x56, 0x76, 0x2f, 0x62, 0xe1, 0xe8, 0x65, 0xc6, 0xb6, 0x69, 0x87, 0xdc, 0x7c, 0x87,
+    0x5d, 0xcb, 0xf8, 0x81, 0x22, 0xf8, 0xd6, 0x58, 0x30, 0xe4, 0xde, 0xb3, 0xe9, 0xe5, 0xe5, 0xe0,
+    0x7b, 0xac, 0x94, 0x03, 0xaa, 0xf4, 0x58, 0x2c, 0x11, 0xfc, 0xfe, 0x2e, 0xfb, 0xb8, 0xa2, 0xd6,
+    0xc3, 0xe4, 0x8f, 0x93, 0x17, 0xaa, 0xe2, 0x36, 0x21, 0x38, 0x7f, 0x19, 0x61, 0x95, 0x61, 0xc8,
+    0xb6, 0xf0, 0xa0, 0xd0, 0x9f, 0x8c, 0x4d, 0x85, 0xb5, 0x9c, 0x70, 0xdb, 0x46, 0xcd, 0x02, 0xb0,
+    0x4b, 0x30, 0x2c, 0x2a, 0x12, 0xd8, 0x4f, 0x09, 0x14, 0x5a, 0xcf, 0xcd, 0xd1, 0x3c, 0x7b, 0xaa,
+    0x2f, 0xb3, 0xb1, 0x77, 0x6f, 0x6c, 0x8f, 0x09, 0xc3, 0x88, 0x52, 0x82, 0x76, 0xc7, 0xf2, 0x9c,
+    0xee, 0xbf, 0x86, 0xbc, 0xfc, 0x01,
 };
+const ShaderModule Blob004 = { Blob004_Data, 6950u, 6683u, 4u };
 
-extern const uint32_t Blob041[6687];
-const uint32_t Blob041[6687] = {
-    0x07230203, 0x00010300, 0x0008000b, 0x000003e4, 0x00000000, 0x00020011, 0x00000001, 0x0006000b,
-    0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001,
-    0x0008000f, 0x00000005, 0x00000004, 0x6e69616d, 0x00000000, 0x000000d9, 0x0000029b, 0x000002b3,
-    0x00060010, 0x00000004, 0x00000011, 0x00000010, 0x00000010, 0x00000001, 0x00030003, 0x00000002,
-    0x000001c2, 0x000a0004, 0x475f4c47, 0x4c474f4f, 0x70635f45, 0x74735f70, 0x5f656c79, 0x656e696c,
-    0x7269645f, 0x69746365, 0x00006576, 0x00080004, 0x475f4c47, 0x4c474f4f, 0x6e695f45, 0x64756c63,
-    0x69645f65, 0x74636572, 0x00657669, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000, 0x000a0005,
-    0x00000010, 0x74706544, 0x73655468, 0x73615074, 0x28736573, 0x623b3162, 0x31753b31, 0x3b31753b,
-    0x003b3175, 0x00060005, 0x0000000b, 0x61757165, 0x7065446c, 0x65546874, 0x00007473, 0x00050005,
-    0x0000000c, 0x69636166, 0x6956676e, 0x00007765, 0x00050005, 0x0000000d, 0x44747364, 0x68747065,
-    0x00000000, 0x00050005, 0x0000000e, 0x656c6974, 0x74706544, 0x00000068, 0x00040005, 0x0000000f,
-    0x41747364, 0x00727474, 0x000d0005, 0x0000001c, 0x746f6c50, 0x6e617254, 0x63756c73, 0x28746e65,
-    0x753b3175, 0x31753b31, 0x3b31623b, 0x753b3175, 0x31753b31, 0x3b31753b, 0x003b3162, 0x00040005,
-    0x00000013, 0x6f6c6f63, 0x00000072, 0x00040005, 0x00000014, 0x74706564, 0x00000068, 0x00040005,
-    0x00000015, 0x72747461, 0x00000000, 0x00050005, 0x00000016, 0x68537369, 0x776f6461, 0x00000000,
-    0x00050005, 0x00000017, 0x656c6974, 0x6f6c6f43, 0x00000072, 0x00040005, 0x00000018, 0x41637273,
-    0x00000000, 0x00050005, 0x00000019, 0x656c6974, 0x74706544, 0x00000068, 0x00040005, 0x0000001a,
-    0x41637273, 0x00727474, 0x00050005, 0x0000001b, 0x74697277, 0x70654465, 0x00006874, 0x00100005,
-    0x0000002d, 0x636f7250, 0x43737365, 0x7372616f, 0x73614d65, 0x3169286b, 0x3b31753b, 0x763b3175,
-    0x763b3275, 0x763b3275, 0x763b3275, 0x623b3275, 0x31753b31, 0x3b31623b, 0x00000000, 0x00050005,
-    0x00000023, 0x656e696c, 0x69547261, 0x0000656c, 0x00050005, 0x00000024, 0x72616f63, 0x614d6573,
-    0x00006b73, 0x00060005, 0x00000025, 0x72616f63, 0x664f6573, 0x74657366, 0x00000000, 0x00040005,
-    0x00000026, 0x6f6c6f63, 0x00000072, 0x00040005, 0x00000027, 0x74706564, 0x00000068, 0x00040005,
-    0x00000028, 0x72747461, 0x00000000, 0x00040005, 0x00000029, 0x6e6e6977, 0x00007265, 0x00060005,
-    0x0000002a, 0x63617274, 0x766f436b, 0x67617265, 0x00000065, 0x00040005, 0x0000002b, 0x6e657473,
-    0x006c6963, 0x00070005, 0x0000002c, 0x76657270, 0x68537349, 0x776f6461, 0x6b73614d, 0x00000000,
-    0x00050005, 0x00000050, 0x6e656c62, 0x74744164, 0x00000072, 0x00040005, 0x0000008b, 0x52637273,
-    0x00000042, 0x00040005, 0x0000008f, 0x47637273, 0x00000000, 0x00040005, 0x00000093, 0x52747364,
-    0x00000042, 0x00040005, 0x00000096, 0x47747364, 0x00000000, 0x00040005, 0x00000099, 0x41747364,
-    0x00000000, 0x00040005, 0x0000009d, 0x68706c61, 0x00000061, 0x00050005, 0x000000ac, 0x6174654d,
-    0x66696e55, 0x006d726f, 0x00060006, 0x000000ac, 0x00000000, 0x506d754e, 0x67796c6f, 0x00736e6f,
-    0x00060006, 0x000000ac, 0x00000001, 0x566d754e, 0x61697261, 0x0073746e, 0x00060006, 0x000000ac,
-    0x00000002, 0x68706c41, 0x66655261, 0x00000000, 0x00050006, 0x000000ac, 0x00000003, 0x70736944,
-    0x00746e43, 0x00060006, 0x000000ac, 0x00000004, 0x6e6f6f54, 0x6c626154, 0x00000065, 0x00060006,
-    0x000000ac, 0x00000005, 0x61656c43, 0x6c6f4372, 0x0000726f, 0x00060006, 0x000000ac, 0x00000006,
-    0x61656c43, 0x70654472, 0x00006874, 0x00060006, 0x000000ac, 0x00000007, 0x61656c43, 0x74744172,
-    0x00000072, 0x00060006, 0x000000ac, 0x00000008, 0x4f676f46, 0x65736666, 0x00000074, 0x00060006,
-    0x000000ac, 0x00000009, 0x53676f46, 0x74666968, 0x00000000, 0x00060006, 0x000000ac, 0x0000000a,
-    0x43676f46, 0x726f6c6f, 0x00000000, 0x00080006, 0x000000ac, 0x0000000b, 0x61656c43, 0x74694272,
-    0x4f70616d, 0x65736666, 0x00000074, 0x00030005, 0x000000ae, 0x00000000, 0x00060005, 0x000000d6,
-    0x656c6974, 0x656e6e49, 0x66664f72, 0x00746573, 0x00080005, 0x000000d9, 0x4c5f6c67, 0x6c61636f,
-    0x6f766e49, 0x69746163, 0x44496e6f, 0x00000000, 0x00050005, 0x000000eb, 0x72616f63, 0x69426573,
-    0x00000074, 0x00050005, 0x000000f4, 0x656c6974, 0x7366664f, 0x00007465, 0x00050005, 0x000000fd,
-    0x656e6966, 0x6b73614d, 0x00000000, 0x00060005, 0x00000103, 0x526e6942, 0x6c757365, 0x66754274,
-    0x00726566, 0x00080006, 0x00000103, 0x00000000, 0x69726156, 0x57746e61, 0x436b726f, 0x746e756f,
-    0x00000000, 0x00080006, 0x00000103, 0x00000001, 0x74726f53, 0x6f576465, 0x664f6b72, 0x74657366,
-    0x00000000, 0x00090006, 0x00000103, 0x00000002, 0x69726156, 0x57746e61, 0x526b726f, 0x436c6165,
-    0x746e756f, 0x00000000, 0x00080006, 0x00000103, 0x00000003, 0x74726f53, 0x6b726f57, 0x6b726f57,
-    0x6e756f43, 0x00000074, 0x00090006, 0x00000103, 0x00000004, 0x6e6e6942, 0x4d676e69, 0x416b7361,
-    0x664f646e, 0x74657366, 0x00000000, 0x00030005, 0x00000105, 0x00000000, 0x00050005, 0x00000108,
-    0x65726353, 0x69576e65, 0x00687464, 0x00060005, 0x00000109, 0x656c6954, 0x72655073, 0x656e694c,
-    0x00000000, 0x00060005, 0x0000010a, 0x65726353, 0x65486e65, 0x74686769, 0x00000000, 0x00050005,
-    0x0000010b, 0x656c6954, 0x656e694c, 0x00000073, 0x00070005, 0x0000010f, 0x6e6e6942, 0x4d676e69,
-    0x536b7361, 0x74726174, 0x00000000, 0x00040005, 0x00000116, 0x6b726f77, 0x00786449, 0x00080005,
-    0x00000119, 0x6e6e6942, 0x57676e69, 0x4f6b726f, 0x65736666, 0x74537374, 0x00747261, 0x00040005,
-    0x00000126, 0x656e6966, 0x00786449, 0x00050005, 0x0000012f, 0x65786970, 0x646e696c, 0x00007865,
-    0x00050005, 0x00000136, 0x656c6974, 0x6f6c6f43, 0x00000072, 0x00060005, 0x00000138, 0x6f6c6f43,
-    0x6c695472, 0x66754265, 0x00726566, 0x00060006, 0x00000138, 0x00000000, 0x6f6c6f43, 0x6c695472,
-    0x00007365, 0x00030005, 0x0000013a, 0x00000000, 0x00050005, 0x00000141, 0x796c6f70, 0x496e6f67,
-    0x00007864, 0x00060005, 0x00000142, 0x68737550, 0x736e6f43, 0x746e6174, 0x00000073, 0x00060006,
-    0x00000142, 0x00000000, 0x56727543, 0x61697261, 0x0000746e, 0x00060006, 0x00000142, 0x00000001,
-    0x57786554, 0x68746469, 0x00000000, 0x00060006, 0x00000142, 0x00000002, 0x48786554, 0x68676965,
-    0x00000074, 0x00060006, 0x00000142, 0x00000003, 0x57786554, 0x53706172, 0x00000000, 0x00060006,
-    0x00000142, 0x00000004, 0x57786554, 0x54706172, 0x00000000, 0x00070006, 0x00000142, 0x00000005,
-    0x49786554, 0x70614373, 0x65727574, 0x00000000, 0x00070006, 0x00000142, 0x00000006, 0x74706143,
-    0x59657275, 0x7366664f, 0x00007465, 0x00050006, 0x00000142, 0x00000007, 0x6461705f, 0x00000000,
-    0x00030005, 0x00000144, 0x00006370, 0x00050005, 0x00000153, 0x796c6f70, 0x416e6f67, 0x00727474,
-    0x00040005, 0x00000154, 0x796c6f50, 0x006e6f67, 0x00060006, 0x00000154, 0x00000000, 0x73726946,
-    0x70535874, 0x00006e61, 0x00050006, 0x00000154, 0x00000001, 0x706f5459, 0x00000000, 0x00050006,
-    0x00000154, 0x00000002, 0x746f4259, 0x00000000, 0x00050006, 0x00000154, 0x00000003, 0x6e694d58,
-    0x00000000, 0x00050006, 0x00000154, 0x00000004, 0x78614d58, 0x00000000, 0x00050006, 0x00000154,
-    0x00000005, 0x6e694d58, 0x00000059, 0x00050006, 0x00000154, 0x00000006, 0x78614d58, 0x00000059,
-    0x00050006, 0x00000154, 0x00000007, 0x69726156, 0x00746e61, 0x00050006, 0x00000154, 0x00000008,
-    0x72747441, 0x00000000, 0x00070006, 0x00000154, 0x00000009, 0x74786554, 0x4c657275, 0x72657961,
-    0x00000000, 0x00060006, 0x00000154, 0x0000000a, 0x69636146, 0x6956676e, 0x00007765, 0x00060005,
-    0x00000156, 0x796c6f50, 0x426e6f67, 0x65666675, 0x00000072, 0x00060006, 0x00000156, 0x00000000,
-    0x796c6f50, 0x736e6f67, 0x00000000, 0x00030005, 0x00000158, 0x00000000, 0x00050005, 0x0000015c,
-    0x69636166, 0x6956676e, 0x00007765, 0x00060005, 0x00000162, 0x68537369, 0x776f6461, 0x6b73614d,
-    0x00000000, 0x00070005, 0x00000168, 0x76657270, 0x68537349, 0x776f6461, 0x6b73614d, 0x00646c4f,
-    0x00060005, 0x0000016b, 0x61757165, 0x7065446c, 0x65546874, 0x00007473, 0x00050005, 0x00000170,
-    0x656c6974, 0x74706544, 0x00000068, 0x00060005, 0x00000172, 0x74706544, 0x6c695468, 0x66754265,
-    0x00726566, 0x00060006, 0x00000172, 0x00000000, 0x74706544, 0x6c695468, 0x00007365, 0x00030005,
-    0x00000174, 0x00000000, 0x00050005, 0x00000178, 0x656c6974, 0x72747441, 0x00000000, 0x00060005,
-    0x0000017a, 0x72747441, 0x656c6954, 0x66667542, 0x00007265, 0x00060006, 0x0000017a, 0x00000000,
-    0x72747441, 0x656c6954, 0x00000073, 0x00030005, 0x0000017c, 0x00000000, 0x00040005, 0x00000180,
-    0x61747364, 0x00727474, 0x00050005, 0x00000187, 0x68537369, 0x776f6461, 0x00000000, 0x00070005,
-    0x0000018b, 0x74697277, 0x63655365, 0x4c646e6f, 0x72657961, 0x00000000, 0x00050005, 0x000001a4,
-    0x44747364, 0x68747065, 0x00000000, 0x00040005, 0x000001af, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001b1, 0x61726170, 0x0000006d, 0x00040005, 0x000001b3, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001b5, 0x61726170, 0x0000006d, 0x00040005, 0x000001b7, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001c8, 0x61726170, 0x0000006d, 0x00040005, 0x000001ca, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001cc, 0x61726170, 0x0000006d, 0x00040005, 0x000001cf, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001d1, 0x61726170, 0x0000006d, 0x00040005, 0x000001d8, 0x41637273, 0x00727474, 0x00040005,
-    0x000001e2, 0x41637273, 0x00000000, 0x00050005, 0x00000224, 0x74697277, 0x70654465, 0x00006874,
-    0x00040005, 0x0000022c, 0x61726170, 0x0000006d, 0x00040005, 0x0000022f, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000232, 0x61726170, 0x0000006d, 0x00040005, 0x00000235, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000237, 0x61726170, 0x0000006d, 0x00040005, 0x00000239, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000023b, 0x61726170, 0x0000006d, 0x00040005, 0x0000023d, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000023f, 0x61726170, 0x0000006d, 0x00040005, 0x00000252, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000255, 0x61726170, 0x0000006d, 0x00040005, 0x00000258, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000025b, 0x61726170, 0x0000006d, 0x00040005, 0x0000025d, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000025f, 0x61726170, 0x0000006d, 0x00040005, 0x00000261, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000263, 0x61726170, 0x0000006d, 0x00040005, 0x00000265, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000273, 0x61726170, 0x0000006d, 0x00040005, 0x00000275, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000277, 0x61726170, 0x0000006d, 0x00040005, 0x0000027a, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000027c, 0x61726170, 0x0000006d, 0x00040005, 0x00000288, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000028a, 0x61726170, 0x0000006d, 0x00040005, 0x0000028c, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000028f, 0x61726170, 0x0000006d, 0x00040005, 0x00000291, 0x61726170, 0x0000006d,
-    0x00050005, 0x0000029a, 0x656e696c, 0x69547261, 0x0000656c, 0x00060005, 0x0000029b, 0x575f6c67,
-    0x476b726f, 0x70756f72, 0x00004449, 0x00060005, 0x000002a4, 0x72616f63, 0x614d6573, 0x6f4c6b73,
-    0x00000000, 0x00060005, 0x000002ab, 0x72616f63, 0x614d6573, 0x69486b73, 0x00000000, 0x00060005,
-    0x000002b2, 0x75736572, 0x664f746c, 0x74657366, 0x00000000, 0x00080005, 0x000002b3, 0x475f6c67,
-    0x61626f6c, 0x766e496c, 0x7461636f, 0x496e6f69, 0x00000044, 0x00040005, 0x000002bc, 0x6e6e6977,
-    0x00007265, 0x00060005, 0x000002bf, 0x63617274, 0x766f436b, 0x67617265, 0x00000065, 0x00040005,
-    0x000002c9, 0x6e657473, 0x006c6963, 0x00070005, 0x000002ca, 0x76657270, 0x68537349, 0x776f6461,
-    0x6b73614d, 0x00000000, 0x00040005, 0x000002d0, 0x6f6c6f63, 0x00000072, 0x00060005, 0x000002d2,
-    0x75736552, 0x7542746c, 0x72656666, 0x00000000, 0x00060006, 0x000002d2, 0x00000000, 0x75736552,
-    0x6156746c, 0x0065756c, 0x00030005, 0x000002d4, 0x00000000, 0x00070005, 0x000002dd, 0x6d617246,
-    0x66756265, 0x53726566, 0x64697274, 0x00000065, 0x00040005, 0x000002e3, 0x74706564, 0x00000068,
-    0x00070005, 0x000002e7, 0x75736552, 0x6544746c, 0x53687470, 0x74726174, 0x00000000, 0x00040005,
-    0x000002f5, 0x72747461, 0x00000000, 0x00060005, 0x000002f9, 0x75736552, 0x7441746c, 0x74537274,
-    0x00747261, 0x00070005, 0x0000030b, 0x75736552, 0x6957746c, 0x72656e6e, 0x66667542, 0x00007265,
-    0x00070006, 0x0000030b, 0x00000000, 0x75736552, 0x6957746c, 0x72656e6e, 0x00000000, 0x00030005,
-    0x0000030d, 0x00000000, 0x00060005, 0x00000316, 0x746e6f63, 0x61756e69, 0x6e6f6974, 0x00000000,
-    0x00080005, 0x00000318, 0x6e656c42, 0x6e6f4364, 0x756e6974, 0x6f697461, 0x6675426e, 0x00726566,
-    0x00090006, 0x00000318, 0x00000000, 0x6e656c42, 0x6e6f4364, 0x756e6974, 0x6f697461, 0x6174536e,
-    0x00006574, 0x00030005, 0x0000031a, 0x00000000, 0x00040005, 0x00000331, 0x6c616373, 0x00000065,
-    0x00030005, 0x00000336, 0x00736f70, 0x00070005, 0x00000344, 0x61656c43, 0x74694272, 0x4370616d,
-    0x726f6c6f, 0x00000000, 0x00070005, 0x0000034b, 0x61656c43, 0x74694272, 0x4470616d, 0x68747065,
-    0x00000000, 0x00040005, 0x00000370, 0x61726170, 0x0000006d, 0x00040005, 0x00000372, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000374, 0x61726170, 0x0000006d, 0x00040005, 0x00000375, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000377, 0x61726170, 0x0000006d, 0x00040005, 0x00000379, 0x61726170,
-    0x0000006d, 0x00040005, 0x0000037b, 0x61726170, 0x0000006d, 0x00040005, 0x0000037d, 0x61726170,
-    0x0000006d, 0x00040005, 0x0000037f, 0x61726170, 0x0000006d, 0x00040005, 0x00000381, 0x61726170,
-    0x0000006d, 0x00040005, 0x0000038a, 0x61726170, 0x0000006d, 0x00040005, 0x0000038c, 0x61726170,
-    0x0000006d, 0x00040005, 0x0000038e, 0x61726170, 0x0000006d, 0x00040005, 0x0000038f, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000391, 0x61726170, 0x0000006d, 0x00040005, 0x00000393, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000395, 0x61726170, 0x0000006d, 0x00040005, 0x00000397, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000399, 0x61726170, 0x0000006d, 0x00040005, 0x0000039b, 0x61726170,
-    0x0000006d, 0x00060005, 0x000003e0, 0x5778614d, 0x546b726f, 0x73656c69, 0x00000000, 0x00040047,
-    0x000000a9, 0x00000006, 0x00000010, 0x00050048, 0x000000ac, 0x00000000, 0x00000023, 0x00000000,
-    0x00050048, 0x000000ac, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x000000ac, 0x00000002,
-    0x00000023, 0x00000008, 0x00050048, 0x000000ac, 0x00000003, 0x00000023, 0x0000000c, 0x00050048,
-    0x000000ac, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x000000ac, 0x00000005, 0x00000023,
-    0x00000230, 0x00050048, 0x000000ac, 0x00000006, 0x00000023, 0x00000234, 0x00050048, 0x000000ac,
-    0x00000007, 0x00000023, 0x00000238, 0x00050048, 0x000000ac, 0x00000008, 0x00000023, 0x0000023c,
-    0x00050048, 0x000000ac, 0x00000009, 0x00000023, 0x00000240, 0x00050048, 0x000000ac, 0x0000000a,
-    0x00000023, 0x00000244, 0x00050048, 0x000000ac, 0x0000000b, 0x00000023, 0x00000248, 0x00030047,
-    0x000000ac, 0x00000002, 0x00040047, 0x000000ae, 0x00000022, 0x00000000, 0x00040047, 0x000000ae,
-    0x00000021, 0x00000000, 0x00040047, 0x000000d9, 0x0000000b, 0x0000001b, 0x00040047, 0x000000ff,
-    0x00000006, 0x00000010, 0x00040047, 0x00000100, 0x00000006, 0x00000004, 0x00040047, 0x00000101,
-    0x00000006, 0x00000004, 0x00040047, 0x00000102, 0x00000006, 0x00000004, 0x00050048, 0x00000103,
-    0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000103, 0x00000001, 0x00000023, 0x00008000,
-    0x00050048, 0x00000103, 0x00000002, 0x00000023, 0x0000a000, 0x00050048, 0x00000103, 0x00000003,
-    0x00000023, 0x0000c000, 0x00050048, 0x00000103, 0x00000004, 0x00000023, 0x0000c010, 0x00030047,
-    0x00000103, 0x00000002, 0x00040047, 0x00000105, 0x00000022, 0x00000000, 0x00040047, 0x00000105,
-    0x00000021, 0x00000008, 0x00040047, 0x00000108, 0x00000001, 0x00000000, 0x00040047, 0x0000010a,
-    0x00000001, 0x00000001, 0x00040047, 0x00000137, 0x00000006, 0x00000004, 0x00050048, 0x00000138,
-    0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000138, 0x00000002, 0x00040047, 0x0000013a,
-    0x00000022, 0x00000000, 0x00040047, 0x0000013a, 0x00000021, 0x00000004, 0x00050048, 0x00000142,
-    0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000142, 0x00000001, 0x00000023, 0x00000004,
-    0x00050048, 0x00000142, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x00000142, 0x00000003,
-    0x00000023, 0x0000000c, 0x00050048, 0x00000142, 0x00000004, 0x00000023, 0x00000010, 0x00050048,
-    0x00000142, 0x00000005, 0x00000023, 0x00000014, 0x00050048, 0x00000142, 0x00000006, 0x00000023,
-    0x00000018, 0x00050048, 0x00000142, 0x00000007, 0x00000023, 0x0000001c, 0x00030047, 0x00000142,
-    0x00000002, 0x00050048, 0x00000154, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000154,
-    0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x00000154, 0x00000002, 0x00000023, 0x00000008,
-    0x00050048, 0x00000154, 0x00000003, 0x00000023, 0x0000000c, 0x00050048, 0x00000154, 0x00000004,
-    0x00000023, 0x00000010, 0x00050048, 0x00000154, 0x00000005, 0x00000023, 0x00000014, 0x00050048,
-    0x00000154, 0x00000006, 0x00000023, 0x00000018, 0x00050048, 0x00000154, 0x00000007, 0x00000023,
-    0x0000001c, 0x00050048, 0x00000154, 0x00000008, 0x00000023, 0x00000020, 0x00050048, 0x00000154,
-    0x00000009, 0x00000023, 0x00000024, 0x00050048, 0x00000154, 0x0000000a, 0x00000023, 0x00000028,
-    0x00040047, 0x00000155, 0x00000006, 0x0000002c, 0x00040048, 0x00000156, 0x00000000, 0x00000018,
-    0x00050048, 0x00000156, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000156, 0x00000002,
-    0x00040047, 0x00000158, 0x00000022, 0x00000000, 0x00040047, 0x00000158, 0x00000021, 0x00000001,
-    0x00040047, 0x00000171, 0x00000006, 0x00000004, 0x00050048, 0x00000172, 0x00000000, 0x00000023,
-    0x00000000, 0x00030047, 0x00000172, 0x00000002, 0x00040047, 0x00000174, 0x00000022, 0x00000000,
-    0x00040047, 0x00000174, 0x00000021, 0x00000005, 0x00040047, 0x00000179, 0x00000006, 0x00000004,
-    0x00050048, 0x0000017a, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x0000017a, 0x00000002,
-    0x00040047, 0x0000017c, 0x00000022, 0x00000000, 0x00040047, 0x0000017c, 0x00000021, 0x00000006,
-    0x00040047, 0x0000029b, 0x0000000b, 0x0000001a, 0x00040047, 0x000002b3, 0x0000000b, 0x0000001c,
-    0x00040047, 0x000002d1, 0x00000006, 0x00000004, 0x00050048, 0x000002d2, 0x00000000, 0x00000023,
-    0x00000000, 0x00030047, 0x000002d2, 0x00000002, 0x00040047, 0x000002d4, 0x00000022, 0x00000000,
-    0x00040047, 0x000002d4, 0x00000021, 0x00000007, 0x00040047, 0x0000030a, 0x00000006, 0x00000004,
-    0x00050048, 0x0000030b, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x0000030b, 0x00000002,
-    0x00040047, 0x0000030d, 0x00000022, 0x00000000, 0x00040047, 0x0000030d, 0x00000021, 0x00000010,
-    0x00040047, 0x00000317, 0x00000006, 0x00000004, 0x00050048, 0x00000318, 0x00000000, 0x00000023,
-    0x00000000, 0x00030047, 0x00000318, 0x00000002, 0x00040047, 0x0000031a, 0x00000022, 0x00000000,
-    0x00040047, 0x0000031a, 0x00000021, 0x0000000f, 0x00040047, 0x00000344, 0x00000022, 0x00000001,
-    0x00040047, 0x00000344, 0x00000021, 0x00000003, 0x00040047, 0x0000034b, 0x00000022, 0x00000001,
-    0x00040047, 0x0000034b, 0x00000021, 0x00000004, 0x00040047, 0x000003e0, 0x00000001, 0x00000002,
-    0x00040047, 0x000003e3, 0x0000000b, 0x00000019, 0x00020013, 0x00000002, 0x00030021, 0x00000003,
-    0x00000002, 0x00020014, 0x00000006, 0x00040020, 0x00000007, 0x00000007, 0x00000006, 0x00040015,
-    0x00000008, 0x00000020, 0x00000000, 0x00040020, 0x00000009, 0x00000007, 0x00000008, 0x00080021,
-    0x0000000a, 0x00000006, 0x00000007, 0x00000007, 0x00000009, 0x00000009, 0x00000009, 0x000c0021,
-    0x00000012, 0x00000002, 0x00000009, 0x00000009, 0x00000009, 0x00000007, 0x00000009, 0x00000009,
-    0x00000009, 0x00000009, 0x00000007, 0x00040015, 0x0000001e, 0x00000020, 0x00000001, 0x00040020,
-    0x0000001f, 0x00000007, 0x0000001e, 0x00040017, 0x00000020, 0x00000008, 0x00000002, 0x00040020,
-    0x00000021, 0x00000007, 0x00000020, 0x000d0021, 0x00000022, 0x00000002, 0x0000001f, 0x00000009,
-    0x00000009, 0x00000021, 0x00000021, 0x00000021, 0x00000021, 0x00000007, 0x00000009, 0x00000007,
-    0x0004002b, 0x00000008, 0x00000035, 0x00000200, 0x0004002b, 0x00000008, 0x00000037, 0x00000400,
-    0x0004002b, 0x00000008, 0x0000003e, 0x00400010, 0x0004002b, 0x00000008, 0x00000040, 0x00000010,
-    0x0004002b, 0x00000008, 0x00000052, 0x0000e0f0, 0x0004002b, 0x0000001e, 0x00000055, 0x00000008,
-    0x0004002b, 0x00000008, 0x00000057, 0x00ff0000, 0x0004002b, 0x00000008, 0x0000005a, 0x00400000,
-    0x0004002b, 0x00000008, 0x0000005d, 0xff001f0f, 0x0004002b, 0x00000008, 0x00000067, 0x00000000,
-    0x0004002b, 0x00000008, 0x0000006e, 0x007f0000, 0x0004002b, 0x00000008, 0x00000075, 0x3f000000,
-    0x0004002b, 0x00000008, 0x00000082, 0x00008000, 0x0004002b, 0x00000008, 0x00000087, 0xffff7fff,
-    0x0004002b, 0x00000008, 0x0000008d, 0x003f003f, 0x0004002b, 0x00000008, 0x00000091, 0x00003f00,
-    0x0004002b, 0x00000008, 0x0000009b, 0x1f000000, 0x0004002b, 0x0000001e, 0x0000009f, 0x00000018,
-    0x0004002b, 0x00000008, 0x000000a1, 0x00000001, 0x00040017, 0x000000a7, 0x00000008, 0x00000004,
-    0x0004002b, 0x00000008, 0x000000a8, 0x00000022, 0x0004001c, 0x000000a9, 0x000000a7, 0x000000a8,
-    0x00030016, 0x000000aa, 0x00000020, 0x00040017, 0x000000ab, 0x000000aa, 0x00000002, 0x000e001e,
-    0x000000ac, 0x00000008, 0x00000008, 0x0000001e, 0x00000008, 0x000000a9, 0x00000008, 0x00000008,
-    0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x000000ab, 0x00040020, 0x000000ad, 0x00000002,
-    0x000000ac, 0x0004003b, 0x000000ad, 0x000000ae, 0x00000002, 0x0004002b, 0x0000001e, 0x000000af,
-    0x00000003, 0x00040020, 0x000000b0, 0x00000002, 0x00000008, 0x0004002b, 0x00000008, 0x000000b3,
-    0x00000008, 0x0004002b, 0x00000008, 0x000000bd, 0x00000020, 0x0004002b, 0x0000001e, 0x000000c2,
-    0x00000005, 0x00040017, 0x000000d7, 0x00000008, 0x00000003, 0x00040020, 0x000000d8, 0x00000001,
-    0x000000d7, 0x0004003b, 0x000000d8, 0x000000d9, 0x00000001, 0x00040020, 0x000000da, 0x00000001,
-    0x00000008, 0x0004002b, 0x0000001e, 0x000000e1, 0x00000010, 0x0004002b, 0x0000001e, 0x000000f6,
-    0x00000040, 0x0004002b, 0x00000008, 0x000000fe, 0x00000800, 0x0004001c, 0x000000ff, 0x000000a7,
-    0x000000fe, 0x0004001c, 0x00000100, 0x00000008, 0x000000fe, 0x0004001c, 0x00000101, 0x00000008,
-    0x000000fe, 0x0003001d, 0x00000102, 0x00000008, 0x0007001e, 0x00000103, 0x000000ff, 0x00000100,
-    0x00000101, 0x000000a7, 0x00000102, 0x00040020, 0x00000104, 0x0000000c, 0x00000103, 0x0004003b,
-    0x00000104, 0x00000105, 0x0000000c, 0x0004002b, 0x0000001e, 0x00000106, 0x00000004, 0x0004002b,
-    0x0000001e, 0x00000107, 0x00000000, 0x00040032, 0x0000001e, 0x00000108, 0x00000100, 0x00060034,
-    0x0000001e, 0x00000109, 0x00000087, 0x00000108, 0x000000e1, 0x00040032, 0x0000001e, 0x0000010a,
-    0x000000c0, 0x00060034, 0x0000001e, 0x0000010b, 0x00000087, 0x0000010a, 0x000000e1, 0x00060034,
-    0x0000001e, 0x0000010c, 0x00000084, 0x00000109, 0x0000010b, 0x0004002b, 0x0000001e, 0x0000010d,
-    0x00000002, 0x00060034, 0x0000001e, 0x0000010e, 0x00000084, 0x0000010c, 0x0000010d, 0x00060034,
-    0x0000001e, 0x0000010f, 0x00000080, 0x00000107, 0x0000010e, 0x00060034, 0x00000008, 0x00000110,
-    0x00000080, 0x0000010f, 0x00000067, 0x00040020, 0x00000113, 0x0000000c, 0x00000008, 0x00060034,
-    0x0000001e, 0x00000117, 0x00000084, 0x00000109, 0x0000010b, 0x00060034, 0x0000001e, 0x00000118,
-    0x00000084, 0x00000117, 0x000000f6, 0x00060034, 0x0000001e, 0x00000119, 0x00000080, 0x0000010f,
-    0x00000118, 0x00060034, 0x00000008, 0x0000011a, 0x00000080, 0x00000119, 0x00000067, 0x0003001d,
-    0x00000137, 0x00000008, 0x0003001e, 0x00000138, 0x00000137, 0x00040020, 0x00000139, 0x0000000c,
-    0x00000138, 0x0004003b, 0x00000139, 0x0000013a, 0x0000000c, 0x0004002b, 0x0000001e, 0x0000013f,
-    0x00000001, 0x000a001e, 0x00000142, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000008,
-    0x00000008, 0x0000001e, 0x00000008, 0x00040020, 0x00000143, 0x00000009, 0x00000142, 0x0004003b,
-    0x00000143, 0x00000144, 0x00000009, 0x00040020, 0x00000145, 0x00000009, 0x00000008, 0x000d001e,
-    0x00000154, 0x0000001e, 0x0000001e, 0x0000001e, 0x0000001e, 0x0000001e, 0x0000001e, 0x0000001e,
-    0x0000001e, 0x00000008, 0x000000aa, 0x00000008, 0x0003001d, 0x00000155, 0x00000154, 0x0003001e,
-    0x00000156, 0x00000155, 0x00040020, 0x00000157, 0x0000000c, 0x00000156, 0x0004003b, 0x00000157,
-    0x00000158, 0x0000000c, 0x0004002b, 0x0000001e, 0x0000015e, 0x0000000a, 0x0004002b, 0x00000008,
-    0x00000164, 0x3f000030, 0x0004002b, 0x00000008, 0x00000166, 0x00000030, 0x0004002b, 0x00000008,
-    0x0000016d, 0x00004000, 0x0003001d, 0x00000171, 0x00000008, 0x0003001e, 0x00000172, 0x00000171,
-    0x00040020, 0x00000173, 0x0000000c, 0x00000172, 0x0004003b, 0x00000173, 0x00000174, 0x0000000c,
-    0x0003001d, 0x00000179, 0x00000008, 0x0003001e, 0x0000017a, 0x00000179, 0x00040020, 0x0000017b,
-    0x0000000c, 0x0000017a, 0x0004003b, 0x0000017b, 0x0000017c, 0x0000000c, 0x0003002a, 0x00000006,
-    0x0000018c, 0x00030029, 0x00000006, 0x0000019a, 0x0004002b, 0x00000008, 0x0000019c, 0x00000002,
-    0x0004002b, 0x00000008, 0x000001a1, 0xfffffffc, 0x0004002b, 0x00000008, 0x000001be, 0x0000000f,
-    0x0004002b, 0x00000008, 0x000001da, 0x3f008000, 0x0004002b, 0x00000008, 0x00000220, 0x80000000,
-    0x0004003b, 0x000000d8, 0x0000029b, 0x00000001, 0x00060034, 0x00000008, 0x000002a0, 0x00000080,
-    0x00000109, 0x00000067, 0x0004003b, 0x000000d8, 0x000002b3, 0x00000001, 0x0004002b, 0x00000008,
-    0x000002bd, 0xffffffff, 0x0005002c, 0x00000020, 0x000002be, 0x000002bd, 0x000002bd, 0x0004002b,
-    0x0000001e, 0x000002c0, 0x00000100, 0x00060034, 0x00000006, 0x000002c1, 0x000000aa, 0x00000108,
-    0x000002c0, 0x0003001d, 0x000002d1, 0x00000008, 0x0003001e, 0x000002d2, 0x000002d1, 0x00040020,
-    0x000002d3, 0x0000000c, 0x000002d2, 0x0004003b, 0x000002d3, 0x000002d4, 0x0000000c, 0x00060034,
-    0x0000001e, 0x000002dd, 0x00000084, 0x00000108, 0x0000010a, 0x00060034, 0x00000008, 0x000002de,
-    0x00000080, 0x000002dd, 0x00000067, 0x00060034, 0x0000001e, 0x000002e4, 0x00000084, 0x00000108,
-    0x0000010a, 0x00060034, 0x0000001e, 0x000002e5, 0x00000084, 0x000002e4, 0x0000010d, 0x00060034,
-    0x00000008, 0x000002e6, 0x00000080, 0x000002e5, 0x00000067, 0x00060034, 0x00000008, 0x000002e7,
-    0x00000080, 0x00000067, 0x000002e6, 0x00060034, 0x00000008, 0x000002f0, 0x00000080, 0x000002dd,
-    0x00000067, 0x00060034, 0x0000001e, 0x000002f6, 0x00000084, 0x00000108, 0x0000010a, 0x00060034,
-    0x0000001e, 0x000002f7, 0x00000084, 0x000002f6, 0x0000010d, 0x00060034, 0x00000008, 0x000002f8,
-    0x00000080, 0x000002f7, 0x00000067, 0x00060034, 0x00000008, 0x000002f9, 0x00000080, 0x000002e7,
-    0x000002f8, 0x00060034, 0x00000008, 0x00000302, 0x00000080, 0x000002dd, 0x00000067, 0x0003001d,
-    0x0000030a, 0x00000008, 0x0003001e, 0x0000030b, 0x0000030a, 0x00040020, 0x0000030c, 0x0000000c,
-    0x0000030b, 0x0004003b, 0x0000030c, 0x0000030d, 0x0000000c, 0x0003001d, 0x00000317, 0x00000008,
-    0x0003001e, 0x00000318, 0x00000317, 0x00040020, 0x00000319, 0x0000000c, 0x00000318, 0x0004003b,
-    0x00000319, 0x0000031a, 0x0000000c, 0x0004002b, 0x00000008, 0x0000031f, 0x00000003, 0x0004002b,
-    0x00000008, 0x00000322, 0x00000004, 0x0004002b, 0x0000001e, 0x0000032c, 0x00000007, 0x00040020,
-    0x00000330, 0x00000007, 0x000000aa, 0x0004002b, 0x000000aa, 0x00000332, 0x3f800000, 0x00040020,
-    0x00000335, 0x00000007, 0x000000ab, 0x0004002b, 0x0000001e, 0x0000033c, 0x0000000b, 0x00040020,
-    0x0000033d, 0x00000002, 0x000000ab, 0x00090019, 0x00000341, 0x00000008, 0x00000001, 0x00000000,
-    0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x0003001b, 0x00000342, 0x00000341, 0x00040020,
-    0x00000343, 0x00000000, 0x00000342, 0x0004003b, 0x00000343, 0x00000344, 0x00000000, 0x0004002b,
-    0x000000aa, 0x00000347, 0x00000000, 0x0004003b, 0x00000343, 0x0000034b, 0x00000000, 0x0004002b,
-    0x0000001e, 0x00000356, 0x00000009, 0x0004002b, 0x00000008, 0x0000035b, 0x00ffffff, 0x0004002b,
-    0x0000001e, 0x00000364, 0x00000006, 0x00060034, 0x00000008, 0x000003ad, 0x00000080, 0x000002dd,
-    0x00000067, 0x00060034, 0x00000008, 0x000003bb, 0x00000080, 0x000002dd, 0x00000067, 0x00060034,
-    0x00000008, 0x000003c9, 0x00000080, 0x000002dd, 0x00000067, 0x00040032, 0x0000001e, 0x000003e0,
-    0x00003000, 0x0004002b, 0x0000001e, 0x000003e1, 0x00000080, 0x0004002b, 0x0000001e, 0x000003e2,
-    0x00000800, 0x0006002c, 0x000000d7, 0x000003e3, 0x00000040, 0x00000040, 0x000000a1, 0x00050036,
-    0x00000002, 0x00000004, 0x00000000, 0x00000003, 0x000200f8, 0x00000005, 0x0004003b, 0x0000001f,
-    0x0000029a, 0x00000007, 0x0004003b, 0x00000009, 0x000002a4, 0x00000007, 0x0004003b, 0x00000009,
-    0x000002ab, 0x00000007, 0x0004003b, 0x0000001f, 0x000002b2, 0x00000007, 0x0004003b, 0x00000021,
-    0x000002bc, 0x00000007, 0x0004003b, 0x00000007, 0x000002bf, 0x00000007, 0x0004003b, 0x00000009,
-    0x000002c9, 0x00000007, 0x0004003b, 0x00000007, 0x000002ca, 0x00000007, 0x0004003b, 0x00000021,
-    0x000002d0, 0x00000007, 0x0004003b, 0x00000021, 0x000002e3, 0x00000007, 0x0004003b, 0x00000021,
-    0x000002f5, 0x00000007, 0x0004003b, 0x00000009, 0x00000316, 0x00000007, 0x0004003b, 0x00000330,
-    0x00000331, 0x00000007, 0x0004003b, 0x00000335, 0x00000336, 0x00000007, 0x0004003b, 0x0000001f,
-    0x00000370, 0x00000007, 0x0004003b, 0x00000009, 0x00000372, 0x00000007, 0x0004003b, 0x00000009,
-    0x00000374, 0x00000007, 0x0004003b, 0x00000021, 0x00000375, 0x00000007, 0x0004003b, 0x00000021,
-    0x00000377, 0x00000007, 0x0004003b, 0x00000021, 0x00000379, 0x00000007, 0x0004003b, 0x00000021,
-    0x0000037b, 0x00000007, 0x0004003b, 0x00000007, 0x0000037d, 0x00000007, 0x0004003b, 0x00000009,
-    0x0000037f, 0x00000007, 0x0004003b, 0x00000007, 0x00000381, 0x00000007, 0x0004003b, 0x0000001f,
-    0x0000038a, 0x00000007, 0x0004003b, 0x00000009, 0x0000038c, 0x00000007, 0x0004003b, 0x00000009,
-    0x0000038e, 0x00000007, 0x0004003b, 0x00000021, 0x0000038f, 0x00000007, 0x0004003b, 0x00000021,
-    0x00000391, 0x00000007, 0x0004003b, 0x00000021, 0x00000393, 0x00000007, 0x0004003b, 0x00000021,
-    0x00000395, 0x00000007, 0x0004003b, 0x00000007, 0x00000397, 0x00000007, 0x0004003b, 0x00000009,
-    0x00000399, 0x00000007, 0x0004003b, 0x00000007, 0x0000039b, 0x00000007, 0x00050041, 0x000000da,
-    0x0000029c, 0x0000029b, 0x00000067, 0x0004003d, 0x00000008, 0x0000029d, 0x0000029c, 0x00050041,
-    0x000000da, 0x0000029e, 0x0000029b, 0x000000a1, 0x0004003d, 0x00000008, 0x0000029f, 0x0000029e,
-    0x00050084, 0x00000008, 0x000002a1, 0x0000029f, 0x000002a0, 0x00050080, 0x00000008, 0x000002a2,
-    0x0000029d, 0x000002a1, 0x0004007c, 0x0000001e, 0x000002a3, 0x000002a2, 0x0003003e, 0x0000029a,
-    0x000002a3, 0x0004003d, 0x0000001e, 0x000002a5, 0x0000029a, 0x00050084, 0x0000001e, 0x000002a6,
-    0x000002a5, 0x0000010d, 0x00050080, 0x0000001e, 0x000002a7, 0x00000107, 0x000002a6, 0x00050080,
-    0x0000001e, 0x000002a8, 0x000002a7, 0x00000107, 0x00060041, 0x00000113, 0x000002a9, 0x00000105,
-    0x00000106, 0x000002a8, 0x0004003d, 0x00000008, 0x000002aa, 0x000002a9, 0x0003003e, 0x000002a4,
-    0x000002aa, 0x0004003d, 0x0000001e, 0x000002ac, 0x0000029a, 0x00050084, 0x0000001e, 0x000002ad,
-    0x000002ac, 0x0000010d, 0x00050080, 0x0000001e, 0x000002ae, 0x00000107, 0x000002ad, 0x00050080,
-    0x0000001e, 0x000002af, 0x000002ae, 0x0000013f, 0x00060041, 0x00000113, 0x000002b0, 0x00000105,
-    0x00000106, 0x000002af, 0x0004003d, 0x00000008, 0x000002b1, 0x000002b0, 0x0003003e, 0x000002ab,
-    0x000002b1, 0x00050041, 0x000000da, 0x000002b4, 0x000002b3, 0x00000067, 0x0004003d, 0x00000008,
-    0x000002b5, 0x000002b4, 0x0004007c, 0x0000001e, 0x000002b6, 0x000002b5, 0x00050041, 0x000000da,
-    0x000002b7, 0x000002b3, 0x000000a1, 0x0004003d, 0x00000008, 0x000002b8, 0x000002b7, 0x0004007c,
-    0x0000001e, 0x000002b9, 0x000002b8, 0x00050084, 0x0000001e, 0x000002ba, 0x000002b9, 0x00000108,
-    0x00050080, 0x0000001e, 0x000002bb, 0x000002b6, 0x000002ba, 0x0003003e, 0x000002b2, 0x000002bb,
-    0x0003003e, 0x000002bc, 0x000002be, 0x000300f7, 0x000002c3, 0x00000000, 0x000400fa, 0x000002c1,
-    0x000002c2, 0x000002c3, 0x000200f8, 0x000002c2, 0x00050041, 0x000000b0, 0x000002c4, 0x000000ae,
-    0x000000af, 0x0004003d, 0x00000008, 0x000002c5, 0x000002c4, 0x000500c7, 0x00000008, 0x000002c6,
-    0x000002c5, 0x00000040, 0x000500ab, 0x00000006, 0x000002c7, 0x000002c6, 0x00000067, 0x000200f9,
-    0x000002c3, 0x000200f8, 0x000002c3, 0x000700f5, 0x00000006, 0x000002c8, 0x000002c1, 0x00000005,
-    0x000002c7, 0x000002c2, 0x0003003e, 0x000002bf, 0x000002c8, 0x0003003e, 0x000002c9, 0x00000067,
-    0x0003003e, 0x000002ca, 0x0000018c, 0x00050041, 0x00000145, 0x000002cb, 0x00000144, 0x0000010d,
-    0x0004003d, 0x00000008, 0x000002cc, 0x000002cb, 0x000500ab, 0x00000006, 0x000002cd, 0x000002cc,
-    0x00000067, 0x000300f7, 0x000002cf, 0x00000000, 0x000400fa, 0x000002cd, 0x000002ce, 0x00000325,
-    0x000200f8, 0x000002ce, 0x0004003d, 0x0000001e, 0x000002d5, 0x000002b2, 0x0004007c, 0x00000008,
-    0x000002d6, 0x000002d5, 0x00050080, 0x00000008, 0x000002d7, 0x00000067, 0x000002d6, 0x00060041,
-    0x00000113, 0x000002d8, 0x000002d4, 0x00000107, 0x000002d7, 0x0004003d, 0x00000008, 0x000002d9,
-    0x000002d8, 0x0004003d, 0x0000001e, 0x000002da, 0x000002b2, 0x0004007c, 0x00000008, 0x000002db,
-    0x000002da, 0x00050080, 0x00000008, 0x000002dc, 0x00000067, 0x000002db, 0x00050080, 0x00000008,
-    0x000002df, 0x000002dc, 0x000002de, 0x00060041, 0x00000113, 0x000002e0, 0x000002d4, 0x00000107,
-    0x000002df, 0x0004003d, 0x00000008, 0x000002e1, 0x000002e0, 0x00050050, 0x00000020, 0x000002e2,
-    0x000002d9, 0x000002e1, 0x0003003e, 0x000002d0, 0x000002e2, 0x0004003d, 0x0000001e, 0x000002e8,
-    0x000002b2, 0x0004007c, 0x00000008, 0x000002e9, 0x000002e8, 0x00050080, 0x00000008, 0x000002ea,
-    0x000002e7, 0x000002e9, 0x00060041, 0x00000113, 0x000002eb, 0x000002d4, 0x00000107, 0x000002ea,
-    0x0004003d, 0x00000008, 0x000002ec, 0x000002eb, 0x0004003d, 0x0000001e, 0x000002ed, 0x000002b2,
-    0x0004007c, 0x00000008, 0x000002ee, 0x000002ed, 0x00050080, 0x00000008, 0x000002ef, 0x000002e7,
-    0x000002ee, 0x00050080, 0x00000008, 0x000002f1, 0x000002ef, 0x000002f0, 0x00060041, 0x00000113,
-    0x000002f2, 0x000002d4, 0x00000107, 0x000002f1, 0x0004003d, 0x00000008, 0x000002f3, 0x000002f2,
-    0x00050050, 0x00000020, 0x000002f4, 0x000002ec, 0x000002f3, 0x0003003e, 0x000002e3, 0x000002f4,
-    0x0004003d, 0x0000001e, 0x000002fa, 0x000002b2, 0x0004007c, 0x00000008, 0x000002fb, 0x000002fa,
-    0x00050080, 0x00000008, 0x000002fc, 0x000002f9, 0x000002fb, 0x00060041, 0x00000113, 0x000002fd,
-    0x000002d4, 0x00000107, 0x000002fc, 0x0004003d, 0x00000008, 0x000002fe, 0x000002fd, 0x0004003d,
-    0x0000001e, 0x000002ff, 0x000002b2, 0x0004007c, 0x00000008, 0x00000300, 0x000002ff, 0x00050080,
-    0x00000008, 0x00000301, 0x000002f9, 0x00000300, 0x00050080, 0x00000008, 0x00000303, 0x00000301,
-    0x00000302, 0x00060041, 0x00000113, 0x00000304, 0x000002d4, 0x00000107, 0x00000303, 0x0004003d,
-    0x00000008, 0x00000305, 0x00000304, 0x00050050, 0x00000020, 0x00000306, 0x000002fe, 0x00000305,
-    0x0003003e, 0x000002f5, 0x00000306, 0x0004003d, 0x00000006, 0x00000307, 0x000002bf, 0x000300f7,
-    0x00000309, 0x00000000, 0x000400fa, 0x00000307, 0x00000308, 0x00000309, 0x000200f8, 0x00000308,
-    0x0004003d, 0x0000001e, 0x0000030e, 0x000002b2, 0x00060041, 0x00000113, 0x0000030f, 0x0000030d,
-    0x00000107, 0x0000030e, 0x0004003d, 0x00000008, 0x00000310, 0x0000030f, 0x0004003d, 0x0000001e,
-    0x00000311, 0x000002b2, 0x00050080, 0x0000001e, 0x00000312, 0x00000311, 0x000002dd, 0x00060041,
-    0x00000113, 0x00000313, 0x0000030d, 0x00000107, 0x00000312, 0x0004003d, 0x00000008, 0x00000314,
-    0x00000313, 0x00050050, 0x00000020, 0x00000315, 0x00000310, 0x00000314, 0x0003003e, 0x000002bc,
-    0x00000315, 0x000200f9, 0x00000309, 0x000200f8, 0x00000309, 0x0004003d, 0x0000001e, 0x0000031b,
-    0x000002b2, 0x00060041, 0x00000113, 0x0000031c, 0x0000031a, 0x00000107, 0x0000031b, 0x0004003d,
-    0x00000008, 0x0000031d, 0x0000031c, 0x0003003e, 0x00000316, 0x0000031d, 0x0004003d, 0x00000008,
-    0x0000031e, 0x00000316, 0x000500c7, 0x00000008, 0x00000320, 0x0000031e, 0x0000031f, 0x0003003e,
-    0x000002c9, 0x00000320, 0x0004003d, 0x00000008, 0x00000321, 0x00000316, 0x000500c7, 0x00000008,
-    0x00000323, 0x00000321, 0x00000322, 0x000500ab, 0x00000006, 0x00000324, 0x00000323, 0x00000067,
-    0x0003003e, 0x000002ca, 0x00000324, 0x000200f9, 0x000002cf, 0x000200f8, 0x00000325, 0x00050041,
-    0x000000b0, 0x00000326, 0x000000ae, 0x000000af, 0x0004003d, 0x00000008, 0x00000327, 0x00000326,
-    0x000500c7, 0x00000008, 0x00000328, 0x00000327, 0x0000016d, 0x000500ab, 0x00000006, 0x00000329,
-    0x00000328, 0x00000067, 0x000300f7, 0x0000032b, 0x00000000, 0x000400fa, 0x00000329, 0x0000032a,
-    0x00000360, 0x000200f8, 0x0000032a, 0x00050041, 0x000000b0, 0x0000032d, 0x000000ae, 0x0000032c,
-    0x0004003d, 0x00000008, 0x0000032e, 0x0000032d, 0x00050050, 0x00000020, 0x0000032f, 0x0000032e,
-    0x00000067, 0x0003003e, 0x000002f5, 0x0000032f, 0x0004006f, 0x000000aa, 0x00000333, 0x00000108,
-    0x00050088, 0x000000aa, 0x00000334, 0x00000332, 0x00000333, 0x0003003e, 0x00000331, 0x00000334,
-    0x0004003d, 0x000000d7, 0x00000337, 0x000002b3, 0x0007004f, 0x00000020, 0x00000338, 0x00000337,
-    0x00000337, 0x00000000, 0x00000001, 0x00040070, 0x000000ab, 0x00000339, 0x00000338, 0x0004003d,
-    0x000000aa, 0x0000033a, 0x00000331, 0x0005008e, 0x000000ab, 0x0000033b, 0x00000339, 0x0000033a,
-    0x00050041, 0x0000033d, 0x0000033e, 0x000000ae, 0x0000033c, 0x0004003d, 0x000000ab, 0x0000033f,
-    0x0000033e, 0x00050081, 0x000000ab, 0x00000340, 0x0000033b, 0x0000033f, 0x0003003e, 0x00000336,
-    0x00000340, 0x0004003d, 0x00000342, 0x00000345, 0x00000344, 0x0004003d, 0x000000ab, 0x00000346,
-    0x00000336, 0x00070058, 0x000000a7, 0x00000348, 0x00000345, 0x00000346, 0x00000002, 0x00000347,
-    0x00050051, 0x00000008, 0x00000349, 0x00000348, 0x00000000, 0x00050050, 0x00000020, 0x0000034a,
-    0x00000349, 0x00000067, 0x0003003e, 0x000002d0, 0x0000034a, 0x0004003d, 0x00000342, 0x0000034c,
-    0x0000034b, 0x0004003d, 0x000000ab, 0x0000034d, 0x00000336, 0x00070058, 0x000000a7, 0x0000034e,
-    0x0000034c, 0x0000034d, 0x00000002, 0x00000347, 0x00050051, 0x00000008, 0x0000034f, 0x0000034e,
-    0x00000000, 0x00050050, 0x00000020, 0x00000350, 0x0000034f, 0x00000067, 0x0003003e, 0x000002e3,
-    0x00000350, 0x00050041, 0x00000009, 0x00000351, 0x000002f5, 0x00000067, 0x0004003d, 0x00000008,
-    0x00000352, 0x00000351, 0x000500c7, 0x00000008, 0x00000353, 0x00000352, 0x00000087, 0x00050041,
-    0x00000009, 0x00000354, 0x000002e3, 0x00000067, 0x0004003d, 0x00000008, 0x00000355, 0x00000354,
-    0x000500c2, 0x00000008, 0x00000357, 0x00000355, 0x00000356, 0x000500c7, 0x00000008, 0x00000358,
-    0x00000357, 0x00000082, 0x000500c5, 0x00000008, 0x00000359, 0x00000353, 0x00000358, 0x00050041,
-    0x00000009, 0x0000035a, 0x000002f5, 0x00000067, 0x0003003e, 0x0000035a, 0x00000359, 0x00050041,
-    0x00000009, 0x0000035c, 0x000002e3, 0x00000067, 0x0004003d, 0x00000008, 0x0000035d, 0x0000035c,
-    0x000500c7, 0x00000008, 0x0000035e, 0x0000035d, 0x0000035b, 0x00050041, 0x00000009, 0x0000035f,
-    0x000002e3, 0x00000067, 0x0003003e, 0x0000035f, 0x0000035e, 0x000200f9, 0x0000032b, 0x000200f8,
-    0x00000360, 0x00050041, 0x000000b0, 0x00000361, 0x000000ae, 0x000000c2, 0x0004003d, 0x00000008,
-    0x00000362, 0x00000361, 0x00050050, 0x00000020, 0x00000363, 0x00000362, 0x00000067, 0x0003003e,
-    0x000002d0, 0x00000363, 0x00050041, 0x000000b0, 0x00000365, 0x000000ae, 0x00000364, 0x0004003d,
-    0x00000008, 0x00000366, 0x00000365, 0x00050050, 0x00000020, 0x00000367, 0x00000366, 0x00000067,
-    0x0003003e, 0x000002e3, 0x00000367, 0x00050041, 0x000000b0, 0x00000368, 0x000000ae, 0x0000032c,
-    0x0004003d, 0x00000008, 0x00000369, 0x00000368, 0x00050050, 0x00000020, 0x0000036a, 0x00000369,
-    0x00000067, 0x0003003e, 0x000002f5, 0x0000036a, 0x000200f9, 0x0000032b, 0x000200f8, 0x0000032b,
-    0x000200f9, 0x000002cf, 0x000200f8, 0x000002cf, 0x00050041, 0x00000145, 0x0000036b, 0x00000144,
-    0x0000010d, 0x0004003d, 0x00000008, 0x0000036c, 0x0000036b, 0x000500aa, 0x00000006, 0x0000036d,
-    0x0000036c, 0x00000067, 0x000300f7, 0x0000036f, 0x00000000, 0x000400fa, 0x0000036d, 0x0000036e,
-    0x0000036f, 0x000200f8, 0x0000036e, 0x0003003e, 0x000002c9, 0x00000067, 0x0003003e, 0x000002ca,
-    0x0000018c, 0x000200f9, 0x0000036f, 0x000200f8, 0x0000036f, 0x0004003d, 0x0000001e, 0x00000371,
-    0x0000029a, 0x0003003e, 0x00000370, 0x00000371, 0x0004003d, 0x00000008, 0x00000373, 0x000002a4,
-    0x0003003e, 0x00000372, 0x00000373, 0x0003003e, 0x00000374, 0x00000067, 0x0004003d, 0x00000020,
-    0x00000376, 0x000002d0, 0x0003003e, 0x00000375, 0x00000376, 0x0004003d, 0x00000020, 0x00000378,
-    0x000002e3, 0x0003003e, 0x00000377, 0x00000378, 0x0004003d, 0x00000020, 0x0000037a, 0x000002f5,
-    0x0003003e, 0x00000379, 0x0000037a, 0x0004003d, 0x00000020, 0x0000037c, 0x000002bc, 0x0003003e,
-    0x0000037b, 0x0000037c, 0x0004003d, 0x00000006, 0x0000037e, 0x000002bf, 0x0003003e, 0x0000037d,
-    0x0000037e, 0x0004003d, 0x00000008, 0x00000380, 0x000002c9, 0x0003003e, 0x0000037f, 0x00000380,
-    0x0004003d, 0x00000006, 0x00000382, 0x000002ca, 0x0003003e, 0x00000381, 0x00000382, 0x000e0039,
-    0x00000002, 0x00000383, 0x0000002d, 0x00000370, 0x00000372, 0x00000374, 0x00000375, 0x00000377,
-    0x00000379, 0x0000037b, 0x0000037d, 0x0000037f, 0x00000381, 0x0004003d, 0x00000020, 0x00000384,
-    0x00000375, 0x0003003e, 0x000002d0, 0x00000384, 0x0004003d, 0x00000020, 0x00000385, 0x00000377,
-    0x0003003e, 0x000002e3, 0x00000385, 0x0004003d, 0x00000020, 0x00000386, 0x00000379, 0x0003003e,
-    0x000002f5, 0x00000386, 0x0004003d, 0x00000020, 0x00000387, 0x0000037b, 0x0003003e, 0x000002bc,
-    0x00000387, 0x0004003d, 0x00000008, 0x00000388, 0x0000037f, 0x0003003e, 0x000002c9, 0x00000388,
-    0x0004003d, 0x00000006, 0x00000389, 0x00000381, 0x0003003e, 0x000002ca, 0x00000389, 0x0004003d,
-    0x0000001e, 0x0000038b, 0x0000029a, 0x0003003e, 0x0000038a, 0x0000038b, 0x0004003d, 0x00000008,
-    0x0000038d, 0x000002ab, 0x0003003e, 0x0000038c, 0x0000038d, 0x0003003e, 0x0000038e, 0x000000bd,
-    0x0004003d, 0x00000020, 0x00000390, 0x000002d0, 0x0003003e, 0x0000038f, 0x00000390, 0x0004003d,
-    0x00000020, 0x00000392, 0x000002e3, 0x0003003e, 0x00000391, 0x00000392, 0x0004003d, 0x00000020,
-    0x00000394, 0x000002f5, 0x0003003e, 0x00000393, 0x00000394, 0x0004003d, 0x00000020, 0x00000396,
-    0x000002bc, 0x0003003e, 0x00000395, 0x00000396, 0x0004003d, 0x00000006, 0x00000398, 0x000002bf,
-    0x0003003e, 0x00000397, 0x00000398, 0x0004003d, 0x00000008, 0x0000039a, 0x000002c9, 0x0003003e,
-    0x00000399, 0x0000039a, 0x0004003d, 0x00000006, 0x0000039c, 0x000002ca, 0x0003003e, 0x0000039b,
-    0x0000039c, 0x000e0039, 0x00000002, 0x0000039d, 0x0000002d, 0x0000038a, 0x0000038c, 0x0000038e,
-    0x0000038f, 0x00000391, 0x00000393, 0x00000395, 0x00000397, 0x00000399, 0x0000039b, 0x0004003d,
-    0x00000020, 0x0000039e, 0x0000038f, 0x0003003e, 0x000002d0, 0x0000039e, 0x0004003d, 0x00000020,
-    0x0000039f, 0x00000391, 0x0003003e, 0x000002e3, 0x0000039f, 0x0004003d, 0x00000020, 0x000003a0,
-    0x00000393, 0x0003003e, 0x000002f5, 0x000003a0, 0x0004003d, 0x00000020, 0x000003a1, 0x00000395,
-    0x0003003e, 0x000002bc, 0x000003a1, 0x0004003d, 0x00000008, 0x000003a2, 0x00000399, 0x0003003e,
-    0x000002c9, 0x000003a2, 0x0004003d, 0x00000006, 0x000003a3, 0x0000039b, 0x0003003e, 0x000002ca,
-    0x000003a3, 0x0004003d, 0x0000001e, 0x000003a4, 0x000002b2, 0x0004007c, 0x00000008, 0x000003a5,
-    0x000003a4, 0x00050080, 0x00000008, 0x000003a6, 0x00000067, 0x000003a5, 0x00050041, 0x00000009,
-    0x000003a7, 0x000002d0, 0x00000067, 0x0004003d, 0x00000008, 0x000003a8, 0x000003a7, 0x00060041,
-    0x00000113, 0x000003a9, 0x000002d4, 0x00000107, 0x000003a6, 0x0003003e, 0x000003a9, 0x000003a8,
-    0x0004003d, 0x0000001e, 0x000003aa, 0x000002b2, 0x0004007c, 0x00000008, 0x000003ab, 0x000003aa,
-    0x00050080, 0x00000008, 0x000003ac, 0x00000067, 0x000003ab, 0x00050080, 0x00000008, 0x000003ae,
-    0x000003ac, 0x000003ad, 0x00050041, 0x00000009, 0x000003af, 0x000002d0, 0x000000a1, 0x0004003d,
-    0x00000008, 0x000003b0, 0x000003af, 0x00060041, 0x00000113, 0x000003b1, 0x000002d4, 0x00000107,
-    0x000003ae, 0x0003003e, 0x000003b1, 0x000003b0, 0x0004003d, 0x0000001e, 0x000003b2, 0x000002b2,
-    0x0004007c, 0x00000008, 0x000003b3, 0x000003b2, 0x00050080, 0x00000008, 0x000003b4, 0x000002e7,
-    0x000003b3, 0x00050041, 0x00000009, 0x000003b5, 0x000002e3, 0x00000067, 0x0004003d, 0x00000008,
-    0x000003b6, 0x000003b5, 0x00060041, 0x00000113, 0x000003b7, 0x000002d4, 0x00000107, 0x000003b4,
-    0x0003003e, 0x000003b7, 0x000003b6, 0x0004003d, 0x0000001e, 0x000003b8, 0x000002b2, 0x0004007c,
-    0x00000008, 0x000003b9, 0x000003b8, 0x00050080, 0x00000008, 0x000003ba, 0x000002e7, 0x000003b9,
-    0x00050080, 0x00000008, 0x000003bc, 0x000003ba, 0x000003bb, 0x00050041, 0x00000009, 0x000003bd,
-    0x000002e3, 0x000000a1, 0x0004003d, 0x00000008, 0x000003be, 0x000003bd, 0x00060041, 0x00000113,
-    0x000003bf, 0x000002d4, 0x00000107, 0x000003bc, 0x0003003e, 0x000003bf, 0x000003be, 0x0004003d,
-    0x0000001e, 0x000003c0, 0x000002b2, 0x0004007c, 0x00000008, 0x000003c1, 0x000003c0, 0x00050080,
-    0x00000008, 0x000003c2, 0x000002f9, 0x000003c1, 0x00050041, 0x00000009, 0x000003c3, 0x000002f5,
-    0x00000067, 0x0004003d, 0x00000008, 0x000003c4, 0x000003c3, 0x00060041, 0x00000113, 0x000003c5,
-    0x000002d4, 0x00000107, 0x000003c2, 0x0003003e, 0x000003c5, 0x000003c4, 0x0004003d, 0x0000001e,
-    0x000003c6, 0x000002b2, 0x0004007c, 0x00000008, 0x000003c7, 0x000003c6, 0x00050080, 0x00000008,
-    0x000003c8, 0x000002f9, 0x000003c7, 0x00050080, 0x00000008, 0x000003ca, 0x000003c8, 0x000003c9,
-    0x00050041, 0x00000009, 0x000003cb, 0x000002f5, 0x000000a1, 0x0004003d, 0x00000008, 0x000003cc,
-    0x000003cb, 0x00060041, 0x00000113, 0x000003cd, 0x000002d4, 0x00000107, 0x000003ca, 0x0003003e,
-    0x000003cd, 0x000003cc, 0x0004003d, 0x00000006, 0x000003ce, 0x000002bf, 0x000300f7, 0x000003d0,
-    0x00000000, 0x000400fa, 0x000003ce, 0x000003cf, 0x000003d0, 0x000200f8, 0x000003cf, 0x0004003d,
-    0x0000001e, 0x000003d1, 0x000002b2, 0x00050041, 0x00000009, 0x000003d2, 0x000002bc, 0x00000067,
-    0x0004003d, 0x00000008, 0x000003d3, 0x000003d2, 0x00060041, 0x00000113, 0x000003d4, 0x0000030d,
-    0x00000107, 0x000003d1, 0x0003003e, 0x000003d4, 0x000003d3, 0x0004003d, 0x0000001e, 0x000003d5,
-    0x000002b2, 0x00050080, 0x0000001e, 0x000003d6, 0x000003d5, 0x000002dd, 0x00050041, 0x00000009,
-    0x000003d7, 0x000002bc, 0x000000a1, 0x0004003d, 0x00000008, 0x000003d8, 0x000003d7, 0x00060041,
-    0x00000113, 0x000003d9, 0x0000030d, 0x00000107, 0x000003d6, 0x0003003e, 0x000003d9, 0x000003d8,
-    0x000200f9, 0x000003d0, 0x000200f8, 0x000003d0, 0x0004003d, 0x0000001e, 0x000003da, 0x000002b2,
-    0x0004003d, 0x00000008, 0x000003db, 0x000002c9, 0x0004003d, 0x00000006, 0x000003dc, 0x000002ca,
-    0x000600a9, 0x00000008, 0x000003dd, 0x000003dc, 0x00000322, 0x00000067, 0x000500c5, 0x00000008,
-    0x000003de, 0x000003db, 0x000003dd, 0x00060041, 0x00000113, 0x000003df, 0x0000031a, 0x00000107,
-    0x000003da, 0x0003003e, 0x000003df, 0x000003de, 0x000100fd, 0x00010038, 0x00050036, 0x00000006,
-    0x00000010, 0x00000000, 0x0000000a, 0x00030037, 0x00000007, 0x0000000b, 0x00030037, 0x00000007,
-    0x0000000c, 0x00030037, 0x00000009, 0x0000000d, 0x00030037, 0x00000009, 0x0000000e, 0x00030037,
-    0x00000009, 0x0000000f, 0x000200f8, 0x00000011, 0x0004003b, 0x00000007, 0x00000043, 0x00000007,
-    0x0004003d, 0x00000006, 0x0000002f, 0x0000000b, 0x000300f7, 0x00000031, 0x00000000, 0x000400fa,
-    0x0000002f, 0x00000030, 0x00000031, 0x000200f8, 0x00000030, 0x0004003d, 0x00000008, 0x00000032,
-    0x0000000d, 0x0004003d, 0x00000008, 0x00000033, 0x0000000e, 0x00050082, 0x00000008, 0x00000034,
-    0x00000032, 0x00000033, 0x00050080, 0x00000008, 0x00000036, 0x00000034, 0x00000035, 0x000500b2,
-    0x00000006, 0x00000038, 0x00000036, 0x00000037, 0x000200fe, 0x00000038, 0x000200f8, 0x00000031,
-    0x0004003d, 0x00000006, 0x0000003a, 0x0000000c, 0x000300f7, 0x0000003c, 0x00000000, 0x000400fa,
-    0x0000003a, 0x0000003b, 0x0000003c, 0x000200f8, 0x0000003b, 0x0004003d, 0x00000008, 0x0000003d,
-    0x0000000f, 0x000500c7, 0x00000008, 0x0000003f, 0x0000003d, 0x0000003e, 0x000500aa, 0x00000006,
-    0x00000041, 0x0000003f, 0x00000040, 0x000200f9, 0x0000003c, 0x000200f8, 0x0000003c, 0x000700f5,
-    0x00000006, 0x00000042, 0x0000003a, 0x00000031, 0x00000041, 0x0000003b, 0x000300f7, 0x00000045,
-    0x00000000, 0x000400fa, 0x00000042, 0x00000044, 0x00000049, 0x000200f8, 0x00000044, 0x0004003d,
-    0x00000008, 0x00000046, 0x0000000e, 0x0004003d, 0x00000008, 0x00000047, 0x0000000d, 0x000500b2,
-    0x00000006, 0x00000048, 0x00000046, 0x00000047, 0x0003003e, 0x00000043, 0x00000048, 0x000200f9,
-    0x00000045, 0x000200f8, 0x00000049, 0x0004003d, 0x00000008, 0x0000004a, 0x0000000e, 0x0004003d,
-    0x00000008, 0x0000004b, 0x0000000d, 0x000500b0, 0x00000006, 0x0000004c, 0x0000004a, 0x0000004b,
-    0x0003003e, 0x00000043, 0x0000004c, 0x000200f9, 0x00000045, 0x000200f8, 0x00000045, 0x0004003d,
-    0x00000006, 0x0000004d, 0x00000043, 0x000200fe, 0x0000004d, 0x00010038, 0x00050036, 0x00000002,
-    0x0000001c, 0x00000000, 0x00000012, 0x00030037, 0x00000009, 0x00000013, 0x00030037, 0x00000009,
-    0x00000014, 0x00030037, 0x00000009, 0x00000015, 0x00030037, 0x00000007, 0x00000016, 0x00030037,
-    0x00000009, 0x00000017, 0x00030037, 0x00000009, 0x00000018, 0x00030037, 0x00000009, 0x00000019,
-    0x00030037, 0x00000009, 0x0000001a, 0x00030037, 0x00000007, 0x0000001b, 0x000200f8, 0x0000001d,
-    0x0004003b, 0x00000009, 0x00000050, 0x00000007, 0x0004003b, 0x00000007, 0x0000006a, 0x00000007,
-    0x0004003b, 0x00000009, 0x0000008b, 0x00000007, 0x0004003b, 0x00000009, 0x0000008f, 0x00000007,
-    0x0004003b, 0x00000009, 0x00000093, 0x00000007, 0x0004003b, 0x00000009, 0x00000096, 0x00000007,
-    0x0004003b, 0x00000009, 0x00000099, 0x00000007, 0x0004003b, 0x00000009, 0x0000009d, 0x00000007,
-    0x0004003d, 0x00000008, 0x00000051, 0x0000001a, 0x000500c7, 0x00000008, 0x00000053, 0x00000051,
-    0x00000052, 0x0004003d, 0x00000008, 0x00000054, 0x0000001a, 0x000500c2, 0x00000008, 0x00000056,
-    0x00000054, 0x00000055, 0x000500c7, 0x00000008, 0x00000058, 0x00000056, 0x00000057, 0x000500c5,
-    0x00000008, 0x00000059, 0x00000053, 0x00000058, 0x000500c5, 0x00000008, 0x0000005b, 0x00000059,
-    0x0000005a, 0x0004003d, 0x00000008, 0x0000005c, 0x00000015, 0x000500c7, 0x00000008, 0x0000005e,
-    0x0000005c, 0x0000005d, 0x000500c5, 0x00000008, 0x0000005f, 0x0000005b, 0x0000005e, 0x0003003e,
-    0x00000050, 0x0000005f, 0x0004003d, 0x00000006, 0x00000060, 0x00000016, 0x000400a8, 0x00000006,
-    0x00000061, 0x00000060, 0x000400a8, 0x00000006, 0x00000062, 0x00000061, 0x000300f7, 0x00000064,
-    0x00000000, 0x000400fa, 0x00000062, 0x00000063, 0x00000064, 0x000200f8, 0x00000063, 0x0004003d,
-    0x00000008, 0x00000065, 0x00000015, 0x000500c7, 0x00000008, 0x00000066, 0x00000065, 0x0000005a,
-    0x000500ab, 0x00000006, 0x00000068, 0x00000066, 0x00000067, 0x000200f9, 0x00000064, 0x000200f8,
-    0x00000064, 0x000700f5, 0x00000006, 0x00000069, 0x00000061, 0x0000001d, 0x00000068, 0x00000063,
-    0x000300f7, 0x0000006c, 0x00000000, 0x000400fa, 0x00000069, 0x0000006b, 0x00000073, 0x000200f8,
-    0x0000006b, 0x0004003d, 0x00000008, 0x0000006d, 0x00000015, 0x000500c7, 0x00000008, 0x0000006f,
-    0x0000006d, 0x0000006e, 0x0004003d, 0x00000008, 0x00000070, 0x00000050, 0x000500c7, 0x00000008,
-    0x00000071, 0x00000070, 0x0000006e, 0x000500ab, 0x00000006, 0x00000072, 0x0000006f, 0x00000071,
-    0x0003003e, 0x0000006a, 0x00000072, 0x000200f9, 0x0000006c, 0x000200f8, 0x00000073, 0x0004003d,
-    0x00000008, 0x00000074, 0x00000015, 0x000500c7, 0x00000008, 0x00000076, 0x00000074, 0x00000075,
-    0x0004003d, 0x00000008, 0x00000077, 0x0000001a, 0x000500c7, 0x00000008, 0x00000078, 0x00000077,
-    0x00000075, 0x000500ab, 0x00000006, 0x00000079, 0x00000076, 0x00000078, 0x0003003e, 0x0000006a,
-    0x00000079, 0x000200f9, 0x0000006c, 0x000200f8, 0x0000006c, 0x0004003d, 0x00000006, 0x0000007a,
-    0x0000006a, 0x000300f7, 0x0000007c, 0x00000000, 0x000400fa, 0x0000007a, 0x0000007b, 0x0000007c,
-    0x000200f8, 0x0000007b, 0x0004003d, 0x00000006, 0x0000007d, 0x0000001b, 0x000300f7, 0x0000007f,
-    0x00000000, 0x000400fa, 0x0000007d, 0x0000007e, 0x0000007f, 0x000200f8, 0x0000007e, 0x0004003d,
-    0x00000008, 0x00000080, 0x00000019, 0x0003003e, 0x00000014, 0x00000080, 0x000200f9, 0x0000007f,
-    0x000200f8, 0x0000007f, 0x0004003d, 0x00000008, 0x00000081, 0x00000015, 0x000500c7, 0x00000008,
-    0x00000083, 0x00000081, 0x00000082, 0x000500aa, 0x00000006, 0x00000084, 0x00000083, 0x00000067,
-    0x000300f7, 0x00000086, 0x00000000, 0x000400fa, 0x00000084, 0x00000085, 0x00000086, 0x000200f8,
-    0x00000085, 0x0004003d, 0x00000008, 0x00000088, 0x00000050, 0x000500c7, 0x00000008, 0x00000089,
-    0x00000088, 0x00000087, 0x0003003e, 0x00000050, 0x00000089, 0x000200f9, 0x00000086, 0x000200f8,
-    0x00000086, 0x0004003d, 0x00000008, 0x0000008a, 0x00000050, 0x0003003e, 0x00000015, 0x0000008a,
-    0x0004003d, 0x00000008, 0x0000008c, 0x00000017, 0x000500c7, 0x00000008, 0x0000008e, 0x0000008c,
-    0x0000008d, 0x0003003e, 0x0000008b, 0x0000008e, 0x0004003d, 0x00000008, 0x00000090, 0x00000017,
-    0x000500c7, 0x00000008, 0x00000092, 0x00000090, 0x00000091, 0x0003003e, 0x0000008f, 0x00000092,
-    0x0004003d, 0x00000008, 0x00000094, 0x00000013, 0x000500c7, 0x00000008, 0x00000095, 0x00000094,
-    0x0000008d, 0x0003003e, 0x00000093, 0x00000095, 0x0004003d, 0x00000008, 0x00000097, 0x00000013,
-    0x000500c7, 0x00000008, 0x00000098, 0x00000097, 0x00000091, 0x0003003e, 0x00000096, 0x00000098,
-    0x0004003d, 0x00000008, 0x0000009a, 0x00000013, 0x000500c7, 0x00000008, 0x0000009c, 0x0000009a,
-    0x0000009b, 0x0003003e, 0x00000099, 0x0000009c, 0x0004003d, 0x00000008, 0x0000009e, 0x00000018,
-    0x000500c2, 0x00000008, 0x000000a0, 0x0000009e, 0x0000009f, 0x00050080, 0x00000008, 0x000000a2,
-    0x000000a0, 0x000000a1, 0x0003003e, 0x0000009d, 0x000000a2, 0x0004003d, 0x00000008, 0x000000a3,
-    0x00000099, 0x000500ab, 0x00000006, 0x000000a4, 0x000000a3, 0x00000067, 0x000300f7, 0x000000a6,
-    0x00000000, 0x000400fa, 0x000000a4, 0x000000a5, 0x000000a6, 0x000200f8, 0x000000a5, 0x00050041,
-    0x000000b0, 0x000000b1, 0x000000ae, 0x000000af, 0x0004003d, 0x00000008, 0x000000b2, 0x000000b1,
-    0x000500c7, 0x00000008, 0x000000b4, 0x000000b2, 0x000000b3, 0x000500ab, 0x00000006, 0x000000b5,
-    0x000000b4, 0x00000067, 0x000200f9, 0x000000a6, 0x000200f8, 0x000000a6, 0x000700f5, 0x00000006,
-    0x000000b6, 0x000000a4, 0x00000086, 0x000000b5, 0x000000a5, 0x000300f7, 0x000000b8, 0x00000000,
-    0x000400fa, 0x000000b6, 0x000000b7, 0x000000b8, 0x000200f8, 0x000000b7, 0x0004003d, 0x00000008,
-    0x000000b9, 0x0000008b, 0x0004003d, 0x00000008, 0x000000ba, 0x0000009d, 0x00050084, 0x00000008,
-    0x000000bb, 0x000000b9, 0x000000ba, 0x0004003d, 0x00000008, 0x000000bc, 0x00000093, 0x0004003d,
-    0x00000008, 0x000000be, 0x0000009d, 0x00050082, 0x00000008, 0x000000bf, 0x000000bd, 0x000000be,
-    0x00050084, 0x00000008, 0x000000c0, 0x000000bc, 0x000000bf, 0x00050080, 0x00000008, 0x000000c1,
-    0x000000bb, 0x000000c0, 0x000500c2, 0x00000008, 0x000000c3, 0x000000c1, 0x000000c2, 0x0003003e,
-    0x0000008b, 0x000000c3, 0x0004003d, 0x00000008, 0x000000c4, 0x0000008f, 0x0004003d, 0x00000008,
-    0x000000c5, 0x0000009d, 0x00050084, 0x00000008, 0x000000c6, 0x000000c4, 0x000000c5, 0x0004003d,
-    0x00000008, 0x000000c7, 0x00000096, 0x0004003d, 0x00000008, 0x000000c8, 0x0000009d, 0x00050082,
-    0x00000008, 0x000000c9, 0x000000bd, 0x000000c8, 0x00050084, 0x00000008, 0x000000ca, 0x000000c7,
-    0x000000c9, 0x00050080, 0x00000008, 0x000000cb, 0x000000c6, 0x000000ca, 0x000500c2, 0x00000008,
-    0x000000cc, 0x000000cb, 0x000000c2, 0x0003003e, 0x0000008f, 0x000000cc, 0x000200f9, 0x000000b8,
-    0x000200f8, 0x000000b8, 0x0004003d, 0x00000008, 0x000000cd, 0x0000008b, 0x000500c7, 0x00000008,
-    0x000000ce, 0x000000cd, 0x0000008d, 0x0004003d, 0x00000008, 0x000000cf, 0x0000008f, 0x000500c7,
-    0x00000008, 0x000000d0, 0x000000cf, 0x00000091, 0x000500c5, 0x00000008, 0x000000d1, 0x000000ce,
-    0x000000d0, 0x0004003d, 0x00000008, 0x000000d2, 0x00000099, 0x0004003d, 0x00000008, 0x000000d3,
-    0x00000018, 0x0007000c, 0x00000008, 0x000000d4, 0x00000001, 0x00000029, 0x000000d2, 0x000000d3,
-    0x000500c5, 0x00000008, 0x000000d5, 0x000000d1, 0x000000d4, 0x0003003e, 0x00000013, 0x000000d5,
-    0x000200f9, 0x0000007c, 0x000200f8, 0x0000007c, 0x000100fd, 0x00010038, 0x00050036, 0x00000002,
-    0x0000002d, 0x00000000, 0x00000022, 0x00030037, 0x0000001f, 0x00000023, 0x00030037, 0x00000009,
-    0x00000024, 0x00030037, 0x00000009, 0x00000025, 0x00030037, 0x00000021, 0x00000026, 0x00030037,
-    0x00000021, 0x00000027, 0x00030037, 0x00000021, 0x00000028, 0x00030037, 0x00000021, 0x00000029,
-    0x00030037, 0x00000007, 0x0000002a, 0x00030037, 0x00000009, 0x0000002b, 0x00030037, 0x00000007,
-    0x0000002c, 0x000200f8, 0x0000002e, 0x0004003b, 0x0000001f, 0x000000d6, 0x00000007, 0x0004003b,
-    0x00000009, 0x000000eb, 0x00000007, 0x0004003b, 0x00000009, 0x000000f4, 0x00000007, 0x0004003b,
-    0x00000009, 0x000000fd, 0x00000007, 0x0004003b, 0x00000009, 0x00000116, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000126, 0x00000007, 0x0004003b, 0x00000009, 0x0000012f, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000136, 0x00000007, 0x0004003b, 0x00000009, 0x00000141, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000153, 0x00000007, 0x0004003b, 0x00000007, 0x0000015c, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000162, 0x00000007, 0x0004003b, 0x00000007, 0x00000168, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000016b, 0x00000007, 0x0004003b, 0x00000009, 0x00000170, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000178, 0x00000007, 0x0004003b, 0x00000009, 0x00000180, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000187, 0x00000007, 0x0004003b, 0x00000007, 0x0000018b, 0x00000007, 0x0004003b,
-    0x00000009, 0x000001a4, 0x00000007, 0x0004003b, 0x00000009, 0x000001a6, 0x00000007, 0x0004003b,
-    0x00000007, 0x000001af, 0x00000007, 0x0004003b, 0x00000007, 0x000001b1, 0x00000007, 0x0004003b,
-    0x00000009, 0x000001b3, 0x00000007, 0x0004003b, 0x00000009, 0x000001b5, 0x00000007, 0x0004003b,
-    0x00000009, 0x000001b7, 0x00000007, 0x0004003b, 0x00000007, 0x000001c8, 0x00000007, 0x0004003b,
-    0x00000007, 0x000001ca, 0x00000007, 0x0004003b, 0x00000009, 0x000001cc, 0x00000007, 0x0004003b,
-    0x00000009, 0x000001cf, 0x00000007, 0x0004003b, 0x00000009, 0x000001d1, 0x00000007, 0x0004003b,
-    0x00000009, 0x000001d8, 0x00000007, 0x0004003b, 0x00000009, 0x000001e2, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000224, 0x00000007, 0x0004003b, 0x00000009, 0x0000022c, 0x00000007, 0x0004003b,
-    0x00000009, 0x0000022f, 0x00000007, 0x0004003b, 0x00000009, 0x00000232, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000235, 0x00000007, 0x0004003b, 0x00000009, 0x00000237, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000239, 0x00000007, 0x0004003b, 0x00000009, 0x0000023b, 0x00000007, 0x0004003b,
-    0x00000009, 0x0000023d, 0x00000007, 0x0004003b, 0x00000007, 0x0000023f, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000252, 0x00000007, 0x0004003b, 0x00000009, 0x00000255, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000258, 0x00000007, 0x0004003b, 0x00000007, 0x0000025b, 0x00000007, 0x0004003b,
-    0x00000009, 0x0000025d, 0x00000007, 0x0004003b, 0x00000009, 0x0000025f, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000261, 0x00000007, 0x0004003b, 0x00000009, 0x00000263, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000265, 0x00000007, 0x0004003b, 0x00000007, 0x00000273, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000275, 0x00000007, 0x0004003b, 0x00000009, 0x00000277, 0x00000007, 0x0004003b,
-    0x00000009, 0x0000027a, 0x00000007, 0x0004003b, 0x00000009, 0x0000027c, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000288, 0x00000007, 0x0004003b, 0x00000007, 0x0000028a, 0x00000007, 0x0004003b,
-    0x00000009, 0x0000028c, 0x00000007, 0x0004003b, 0x00000009, 0x0000028f, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000291, 0x00000007, 0x00050041, 0x000000da, 0x000000db, 0x000000d9, 0x00000067,
-    0x0004003d, 0x00000008, 0x000000dc, 0x000000db, 0x0004007c, 0x0000001e, 0x000000dd, 0x000000dc,
-    0x00050041, 0x000000da, 0x000000de, 0x000000d9, 0x000000a1, 0x0004003d, 0x00000008, 0x000000df,
-    0x000000de, 0x0004007c, 0x0000001e, 0x000000e0, 0x000000df, 0x00050084, 0x0000001e, 0x000000e2,
-    0x000000e0, 0x000000e1, 0x00050080, 0x0000001e, 0x000000e3, 0x000000dd, 0x000000e2, 0x0003003e,
-    0x000000d6, 0x000000e3, 0x000200f9, 0x000000e4, 0x000200f8, 0x000000e4, 0x000400f6, 0x000000e6,
-    0x000000e7, 0x00000000, 0x000200f9, 0x000000e8, 0x000200f8, 0x000000e8, 0x0004003d, 0x00000008,
-    0x000000e9, 0x00000024, 0x000500ab, 0x00000006, 0x000000ea, 0x000000e9, 0x00000067, 0x000400fa,
-    0x000000ea, 0x000000e5, 0x000000e6, 0x000200f8, 0x000000e5, 0x0004003d, 0x00000008, 0x000000ec,
-    0x00000024, 0x0006000c, 0x0000001e, 0x000000ed, 0x00000001, 0x00000049, 0x000000ec, 0x0004007c,
-    0x00000008, 0x000000ee, 0x000000ed, 0x0003003e, 0x000000eb, 0x000000ee, 0x0004003d, 0x00000008,
-    0x000000ef, 0x000000eb, 0x000500c4, 0x00000008, 0x000000f0, 0x000000a1, 0x000000ef, 0x000400c8,
-    0x00000008, 0x000000f1, 0x000000f0, 0x0004003d, 0x00000008, 0x000000f2, 0x00000024, 0x000500c7,
-    0x00000008, 0x000000f3, 0x000000f2, 0x000000f1, 0x0003003e, 0x00000024, 0x000000f3, 0x0004003d,
-    0x0000001e, 0x000000f5, 0x00000023, 0x00050084, 0x0000001e, 0x000000f7, 0x000000f5, 0x000000f6,
-    0x0004007c, 0x00000008, 0x000000f8, 0x000000f7, 0x0004003d, 0x00000008, 0x000000f9, 0x000000eb,
-    0x00050080, 0x00000008, 0x000000fa, 0x000000f8, 0x000000f9, 0x0004003d, 0x00000008, 0x000000fb,
-    0x00000025, 0x00050080, 0x00000008, 0x000000fc, 0x000000fa, 0x000000fb, 0x0003003e, 0x000000f4,
-    0x000000fc, 0x0004003d, 0x00000008, 0x00000111, 0x000000f4, 0x00050080, 0x00000008, 0x00000112,
-    0x00000110, 0x00000111, 0x00060041, 0x00000113, 0x00000114, 0x00000105, 0x00000106, 0x00000112,
-    0x0004003d, 0x00000008, 0x00000115, 0x00000114, 0x0003003e, 0x000000fd, 0x00000115, 0x0004003d,
-    0x00000008, 0x0000011b, 0x000000f4, 0x00050080, 0x00000008, 0x0000011c, 0x0000011a, 0x0000011b,
-    0x00060041, 0x00000113, 0x0000011d, 0x00000105, 0x00000106, 0x0000011c, 0x0004003d, 0x00000008,
-    0x0000011e, 0x0000011d, 0x0003003e, 0x00000116, 0x0000011e, 0x000200f9, 0x0000011f, 0x000200f8,
-    0x0000011f, 0x000400f6, 0x00000121, 0x00000122, 0x00000000, 0x000200f9, 0x00000123, 0x000200f8,
-    0x00000123, 0x0004003d, 0x00000008, 0x00000124, 0x000000fd, 0x000500ab, 0x00000006, 0x00000125,
-    0x00000124, 0x00000067, 0x000400fa, 0x00000125, 0x00000120, 0x00000121, 0x000200f8, 0x00000120,
-    0x0004003d, 0x00000008, 0x00000127, 0x000000fd, 0x0006000c, 0x0000001e, 0x00000128, 0x00000001,
-    0x00000049, 0x00000127, 0x0004007c, 0x00000008, 0x00000129, 0x00000128, 0x0003003e, 0x00000126,
-    0x00000129, 0x0004003d, 0x00000008, 0x0000012a, 0x00000126, 0x000500c4, 0x00000008, 0x0000012b,
-    0x000000a1, 0x0000012a, 0x000400c8, 0x00000008, 0x0000012c, 0x0000012b, 0x0004003d, 0x00000008,
-    0x0000012d, 0x000000fd, 0x000500c7, 0x00000008, 0x0000012e, 0x0000012d, 0x0000012c, 0x0003003e,
-    0x000000fd, 0x0000012e, 0x0004003d, 0x0000001e, 0x00000130, 0x000000d6, 0x0004007c, 0x00000008,
-    0x00000131, 0x00000130, 0x0004003d, 0x00000008, 0x00000132, 0x00000116, 0x00050084, 0x00000008,
-    0x00000133, 0x00000132, 0x00000040, 0x00050084, 0x00000008, 0x00000134, 0x00000133, 0x00000040,
-    0x00050080, 0x00000008, 0x00000135, 0x00000131, 0x00000134, 0x0003003e, 0x0000012f, 0x00000135,
-    0x0004003d, 0x00000008, 0x0000013b, 0x0000012f, 0x00060041, 0x00000113, 0x0000013c, 0x0000013a,
-    0x00000107, 0x0000013b, 0x0004003d, 0x00000008, 0x0000013d, 0x0000013c, 0x0003003e, 0x00000136,
-    0x0000013d, 0x0004003d, 0x00000008, 0x0000013e, 0x00000116, 0x00050080, 0x00000008, 0x00000140,
-    0x0000013e, 0x0000013f, 0x0003003e, 0x00000116, 0x00000140, 0x00050041, 0x00000145, 0x00000146,
-    0x00000144, 0x00000107, 0x0004003d, 0x00000008, 0x00000147, 0x00000146, 0x0004003d, 0x00000008,
-    0x00000148, 0x00000126, 0x00050080, 0x00000008, 0x00000149, 0x00000147, 0x00000148, 0x0004003d,
-    0x00000008, 0x0000014a, 0x000000eb, 0x0004003d, 0x00000008, 0x0000014b, 0x00000025, 0x00050080,
-    0x00000008, 0x0000014c, 0x0000014a, 0x0000014b, 0x00050084, 0x00000008, 0x0000014d, 0x0000014c,
-    0x000000bd, 0x00050080, 0x00000008, 0x0000014e, 0x00000149, 0x0000014d, 0x0003003e, 0x00000141,
-    0x0000014e, 0x0004003d, 0x00000008, 0x0000014f, 0x00000136, 0x000500ab, 0x00000006, 0x00000150,
-    0x0000014f, 0x00000067, 0x000300f7, 0x00000152, 0x00000000, 0x000400fa, 0x00000150, 0x00000151,
-    0x00000152, 0x000200f8, 0x00000151, 0x0004003d, 0x00000008, 0x00000159, 0x00000141, 0x00070041,
-    0x00000113, 0x0000015a, 0x00000158, 0x00000107, 0x00000159, 0x00000055, 0x0004003d, 0x00000008,
-    0x0000015b, 0x0000015a, 0x0003003e, 0x00000153, 0x0000015b, 0x0004003d, 0x00000008, 0x0000015d,
-    0x00000141, 0x00070041, 0x00000113, 0x0000015f, 0x00000158, 0x00000107, 0x0000015d, 0x0000015e,
-    0x0004003d, 0x00000008, 0x00000160, 0x0000015f, 0x000500ab, 0x00000006, 0x00000161, 0x00000160,
-    0x00000067, 0x0003003e, 0x0000015c, 0x00000161, 0x0004003d, 0x00000008, 0x00000163, 0x00000153,
-    0x000500c7, 0x00000008, 0x00000165, 0x00000163, 0x00000164, 0x000500aa, 0x00000006, 0x00000167,
-    0x00000165, 0x00000166, 0x0003003e, 0x00000162, 0x00000167, 0x0004003d, 0x00000006, 0x00000169,
-    0x0000002c, 0x0003003e, 0x00000168, 0x00000169, 0x0004003d, 0x00000006, 0x0000016a, 0x00000162,
-    0x0003003e, 0x0000002c, 0x0000016a, 0x0004003d, 0x00000008, 0x0000016c, 0x00000153, 0x000500c7,
-    0x00000008, 0x0000016e, 0x0000016c, 0x0000016d, 0x000500ab, 0x00000006, 0x0000016f, 0x0000016e,
-    0x00000067, 0x0003003e, 0x0000016b, 0x0000016f, 0x0004003d, 0x00000008, 0x00000175, 0x0000012f,
-    0x00060041, 0x00000113, 0x00000176, 0x00000174, 0x00000107, 0x00000175, 0x0004003d, 0x00000008,
-    0x00000177, 0x00000176, 0x0003003e, 0x00000170, 0x00000177, 0x0004003d, 0x00000008, 0x0000017d,
-    0x0000012f, 0x00060041, 0x00000113, 0x0000017e, 0x0000017c, 0x00000107, 0x0000017d, 0x0004003d,
-    0x00000008, 0x0000017f, 0x0000017e, 0x0003003e, 0x00000178, 0x0000017f, 0x00050041, 0x00000009,
-    0x00000181, 0x00000028, 0x00000067, 0x0004003d, 0x00000008, 0x00000182, 0x00000181, 0x0003003e,
-    0x00000180, 0x00000182, 0x0004003d, 0x00000006, 0x00000183, 0x00000162, 0x000400a8, 0x00000006,
-    0x00000184, 0x00000183, 0x000300f7, 0x00000186, 0x00000000, 0x000400fa, 0x00000184, 0x00000185,
-    0x0000026e, 0x000200f8, 0x00000185, 0x0004003d, 0x00000008, 0x00000188, 0x00000153, 0x000500c7,
-    0x00000008, 0x00000189, 0x00000188, 0x00000166, 0x000500aa, 0x00000006, 0x0000018a, 0x00000189,
-    0x00000166, 0x0003003e, 0x00000187, 0x0000018a, 0x0003003e, 0x0000018b, 0x0000018c, 0x0004003d,
-    0x00000006, 0x0000018d, 0x00000187, 0x000300f7, 0x0000018f, 0x00000000, 0x000400fa, 0x0000018d,
-    0x0000018e, 0x0000018f, 0x000200f8, 0x0000018e, 0x0004003d, 0x00000008, 0x00000190, 0x0000002b,
-    0x000500aa, 0x00000006, 0x00000191, 0x00000190, 0x00000067, 0x000300f7, 0x00000193, 0x00000000,
-    0x000400fa, 0x00000191, 0x00000192, 0x00000193, 0x000200f8, 0x00000192, 0x000200f9, 0x00000122,
-    0x000200f8, 0x00000193, 0x0004003d, 0x00000008, 0x00000195, 0x0000002b, 0x000500c7, 0x00000008,
-    0x00000196, 0x00000195, 0x000000a1, 0x000500aa, 0x00000006, 0x00000197, 0x00000196, 0x00000067,
-    0x000300f7, 0x00000199, 0x00000000, 0x000400fa, 0x00000197, 0x00000198, 0x00000199, 0x000200f8,
-    0x00000198, 0x0003003e, 0x0000018b, 0x0000019a, 0x000200f9, 0x00000199, 0x000200f8, 0x00000199,
-    0x0004003d, 0x00000008, 0x0000019b, 0x0000002b, 0x000500c7, 0x00000008, 0x0000019d, 0x0000019b,
-    0x0000019c, 0x000500aa, 0x00000006, 0x0000019e, 0x0000019d, 0x00000067, 0x000300f7, 0x000001a0,
-    0x00000000, 0x000400fa, 0x0000019e, 0x0000019f, 0x000001a0, 0x000200f8, 0x0000019f, 0x0004003d,
-    0x00000008, 0x000001a2, 0x00000180, 0x000500c7, 0x00000008, 0x000001a3, 0x000001a2, 0x000001a1,
-    0x0003003e, 0x00000180, 0x000001a3, 0x000200f9, 0x000001a0, 0x000200f8, 0x000001a0, 0x000200f9,
-    0x0000018f, 0x000200f8, 0x0000018f, 0x0004003d, 0x00000006, 0x000001a5, 0x0000018b, 0x000300f7,
-    0x000001a8, 0x00000000, 0x000400fa, 0x000001a5, 0x000001a7, 0x000001ab, 0x000200f8, 0x000001a7,
-    0x00050041, 0x00000009, 0x000001a9, 0x00000027, 0x000000a1, 0x0004003d, 0x00000008, 0x000001aa,
-    0x000001a9, 0x0003003e, 0x000001a6, 0x000001aa, 0x000200f9, 0x000001a8, 0x000200f8, 0x000001ab,
-    0x00050041, 0x00000009, 0x000001ac, 0x00000027, 0x00000067, 0x0004003d, 0x00000008, 0x000001ad,
-    0x000001ac, 0x0003003e, 0x000001a6, 0x000001ad, 0x000200f9, 0x000001a8, 0x000200f8, 0x000001a8,
-    0x0004003d, 0x00000008, 0x000001ae, 0x000001a6, 0x0003003e, 0x000001a4, 0x000001ae, 0x0004003d,
-    0x00000006, 0x000001b0, 0x0000016b, 0x0003003e, 0x000001af, 0x000001b0, 0x0004003d, 0x00000006,
-    0x000001b2, 0x0000015c, 0x0003003e, 0x000001b1, 0x000001b2, 0x0004003d, 0x00000008, 0x000001b4,
-    0x000001a4, 0x0003003e, 0x000001b3, 0x000001b4, 0x0004003d, 0x00000008, 0x000001b6, 0x00000170,
-    0x0003003e, 0x000001b5, 0x000001b6, 0x0004003d, 0x00000008, 0x000001b8, 0x00000180, 0x0003003e,
-    0x000001b7, 0x000001b8, 0x00090039, 0x00000006, 0x000001b9, 0x00000010, 0x000001af, 0x000001b1,
-    0x000001b3, 0x000001b5, 0x000001b7, 0x000400a8, 0x00000006, 0x000001ba, 0x000001b9, 0x000300f7,
-    0x000001bc, 0x00000000, 0x000400fa, 0x000001ba, 0x000001bb, 0x000001bc, 0x000200f8, 0x000001bb,
-    0x0004003d, 0x00000008, 0x000001bd, 0x00000180, 0x000500c7, 0x00000008, 0x000001bf, 0x000001bd,
-    0x000001be, 0x000500aa, 0x00000006, 0x000001c0, 0x000001bf, 0x00000067, 0x0004003d, 0x00000006,
-    0x000001c1, 0x0000018b, 0x000500a6, 0x00000006, 0x000001c2, 0x000001c0, 0x000001c1, 0x000300f7,
-    0x000001c4, 0x00000000, 0x000400fa, 0x000001c2, 0x000001c3, 0x000001c4, 0x000200f8, 0x000001c3,
-    0x000200f9, 0x00000122, 0x000200f8, 0x000001c4, 0x0003003e, 0x0000018b, 0x0000019a, 0x00050041,
-    0x00000009, 0x000001c6, 0x00000028, 0x000000a1, 0x0004003d, 0x00000008, 0x000001c7, 0x000001c6,
-    0x0003003e, 0x00000180, 0x000001c7, 0x0004003d, 0x00000006, 0x000001c9, 0x0000016b, 0x0003003e,
-    0x000001c8, 0x000001c9, 0x0004003d, 0x00000006, 0x000001cb, 0x0000015c, 0x0003003e, 0x000001ca,
-    0x000001cb, 0x00050041, 0x00000009, 0x000001cd, 0x00000027, 0x000000a1, 0x0004003d, 0x00000008,
-    0x000001ce, 0x000001cd, 0x0003003e, 0x000001cc, 0x000001ce, 0x0004003d, 0x00000008, 0x000001d0,
-    0x00000170, 0x0003003e, 0x000001cf, 0x000001d0, 0x0004003d, 0x00000008, 0x000001d2, 0x00000180,
-    0x0003003e, 0x000001d1, 0x000001d2, 0x00090039, 0x00000006, 0x000001d3, 0x00000010, 0x000001c8,
-    0x000001ca, 0x000001cc, 0x000001cf, 0x000001d1, 0x000400a8, 0x00000006, 0x000001d4, 0x000001d3,
-    0x000300f7, 0x000001d6, 0x00000000, 0x000400fa, 0x000001d4, 0x000001d5, 0x000001d6, 0x000200f8,
-    0x000001d5, 0x000200f9, 0x00000122, 0x000200f8, 0x000001d6, 0x000200f9, 0x000001bc, 0x000200f8,
-    0x000001bc, 0x0004003d, 0x00000008, 0x000001d9, 0x00000153, 0x000500c7, 0x00000008, 0x000001db,
-    0x000001d9, 0x000001da, 0x0003003e, 0x000001d8, 0x000001db, 0x0004003d, 0x00000006, 0x000001dc,
-    0x0000015c, 0x000400a8, 0x00000006, 0x000001dd, 0x000001dc, 0x000300f7, 0x000001df, 0x00000000,
-    0x000400fa, 0x000001dd, 0x000001de, 0x000001df, 0x000200f8, 0x000001de, 0x0004003d, 0x00000008,
-    0x000001e0, 0x000001d8, 0x000500c5, 0x00000008, 0x000001e1, 0x000001e0, 0x00000040, 0x0003003e,
-    0x000001d8, 0x000001e1, 0x000200f9, 0x000001df, 0x000200f8, 0x000001df, 0x0004003d, 0x00000008,
-    0x000001e3, 0x00000136, 0x000500c7, 0x00000008, 0x000001e4, 0x000001e3, 0x0000009b, 0x0003003e,
-    0x000001e2, 0x000001e4, 0x0004003d, 0x00000008, 0x000001e5, 0x000001e2, 0x000500aa, 0x00000006,
-    0x000001e6, 0x000001e5, 0x0000009b, 0x000300f7, 0x000001e8, 0x00000000, 0x000400fa, 0x000001e6,
-    0x000001e7, 0x00000223, 0x000200f8, 0x000001e7, 0x0004003d, 0x00000008, 0x000001e9, 0x00000178,
-    0x0004003d, 0x00000008, 0x000001ea, 0x000001d8, 0x000500c5, 0x00000008, 0x000001eb, 0x000001ea,
-    0x000001e9, 0x0003003e, 0x000001d8, 0x000001eb, 0x0004003d, 0x00000006, 0x000001ec, 0x0000018b,
-    0x000400a8, 0x00000006, 0x000001ed, 0x000001ec, 0x000300f7, 0x000001ef, 0x00000000, 0x000400fa,
-    0x000001ed, 0x000001ee, 0x0000020f, 0x000200f8, 0x000001ee, 0x0004003d, 0x00000008, 0x000001f0,
-    0x000001d8, 0x000500c7, 0x00000008, 0x000001f1, 0x000001f0, 0x000001be, 0x000500ab, 0x00000006,
-    0x000001f2, 0x000001f1, 0x00000067, 0x000300f7, 0x000001f4, 0x00000000, 0x000400fa, 0x000001f2,
-    0x000001f3, 0x000001f4, 0x000200f8, 0x000001f3, 0x00050041, 0x00000009, 0x000001f5, 0x00000026,
-    0x00000067, 0x0004003d, 0x00000008, 0x000001f6, 0x000001f5, 0x00050041, 0x00000009, 0x000001f7,
-    0x00000026, 0x000000a1, 0x0003003e, 0x000001f7, 0x000001f6, 0x00050041, 0x00000009, 0x000001f8,
-    0x00000027, 0x00000067, 0x0004003d, 0x00000008, 0x000001f9, 0x000001f8, 0x00050041, 0x00000009,
-    0x000001fa, 0x00000027, 0x000000a1, 0x0003003e, 0x000001fa, 0x000001f9, 0x00050041, 0x00000009,
-    0x000001fb, 0x00000028, 0x00000067, 0x0004003d, 0x00000008, 0x000001fc, 0x000001fb, 0x00050041,
-    0x00000009, 0x000001fd, 0x00000028, 0x000000a1, 0x0003003e, 0x000001fd, 0x000001fc, 0x0004003d,
-    0x00000006, 0x000001fe, 0x0000002a, 0x000300f7, 0x00000200, 0x00000000, 0x000400fa, 0x000001fe,
-    0x000001ff, 0x00000200, 0x000200f8, 0x000001ff, 0x00050041, 0x00000009, 0x00000201, 0x00000029,
-    0x00000067, 0x0004003d, 0x00000008, 0x00000202, 0x00000201, 0x00050041, 0x00000009, 0x00000203,
-    0x00000029, 0x000000a1, 0x0003003e, 0x00000203, 0x00000202, 0x000200f9, 0x00000200, 0x000200f8,
-    0x00000200, 0x000200f9, 0x000001f4, 0x000200f8, 0x000001f4, 0x0004003d, 0x00000008, 0x00000204,
-    0x00000136, 0x00050041, 0x00000009, 0x00000205, 0x00000026, 0x00000067, 0x0003003e, 0x00000205,
-    0x00000204, 0x0004003d, 0x00000008, 0x00000206, 0x00000170, 0x00050041, 0x00000009, 0x00000207,
-    0x00000027, 0x00000067, 0x0003003e, 0x00000207, 0x00000206, 0x0004003d, 0x00000008, 0x00000208,
-    0x000001d8, 0x00050041, 0x00000009, 0x00000209, 0x00000028, 0x00000067, 0x0003003e, 0x00000209,
-    0x00000208, 0x0004003d, 0x00000006, 0x0000020a, 0x0000002a, 0x000300f7, 0x0000020c, 0x00000000,
-    0x000400fa, 0x0000020a, 0x0000020b, 0x0000020c, 0x000200f8, 0x0000020b, 0x0004003d, 0x00000008,
-    0x0000020d, 0x00000141, 0x00050041, 0x00000009, 0x0000020e, 0x00000029, 0x00000067, 0x0003003e,
-    0x0000020e, 0x0000020d, 0x000200f9, 0x0000020c, 0x000200f8, 0x0000020c, 0x000200f9, 0x000001ef,
-    0x000200f8, 0x0000020f, 0x0004003d, 0x00000008, 0x00000210, 0x00000136, 0x00050041, 0x00000009,
-    0x00000211, 0x00000026, 0x000000a1, 0x0003003e, 0x00000211, 0x00000210, 0x0004003d, 0x00000008,
-    0x00000212, 0x00000170, 0x00050041, 0x00000009, 0x00000213, 0x00000027, 0x000000a1, 0x0003003e,
-    0x00000213, 0x00000212, 0x0004003d, 0x00000008, 0x00000214, 0x000001d8, 0x00050041, 0x00000009,
-    0x00000215, 0x00000028, 0x000000a1, 0x0003003e, 0x00000215, 0x00000214, 0x0004003d, 0x00000006,
-    0x00000216, 0x0000002a, 0x000300f7, 0x00000218, 0x00000000, 0x000400fa, 0x00000216, 0x00000217,
-    0x00000218, 0x000200f8, 0x00000217, 0x0004003d, 0x00000008, 0x00000219, 0x00000141, 0x00050041,
-    0x00000009, 0x0000021a, 0x00000029, 0x000000a1, 0x0003003e, 0x0000021a, 0x00000219, 0x000200f9,
-    0x00000218, 0x000200f8, 0x00000218, 0x000200f9, 0x000001ef, 0x000200f8, 0x000001ef, 0x0004003d,
-    0x00000006, 0x0000021b, 0x0000002a, 0x000300f7, 0x0000021d, 0x00000000, 0x000400fa, 0x0000021b,
-    0x0000021c, 0x0000021d, 0x000200f8, 0x0000021c, 0x0004003d, 0x00000008, 0x0000021e, 0x0000012f,
-    0x0004003d, 0x00000008, 0x0000021f, 0x00000178, 0x000500c5, 0x00000008, 0x00000221, 0x0000021f,
-    0x00000220, 0x00060041, 0x00000113, 0x00000222, 0x0000017c, 0x00000107, 0x0000021e, 0x0003003e,
-    0x00000222, 0x00000221, 0x000200f9, 0x0000021d, 0x000200f8, 0x0000021d, 0x000200f9, 0x000001e8,
-    0x000200f8, 0x00000223, 0x0004003d, 0x00000008, 0x00000225, 0x00000153, 0x000500c7, 0x00000008,
-    0x00000226, 0x00000225, 0x000000fe, 0x000500ab, 0x00000006, 0x00000227, 0x00000226, 0x00000067,
-    0x0003003e, 0x00000224, 0x00000227, 0x0004003d, 0x00000006, 0x00000228, 0x0000018b, 0x000400a8,
-    0x00000006, 0x00000229, 0x00000228, 0x000300f7, 0x0000022b, 0x00000000, 0x000400fa, 0x00000229,
-    0x0000022a, 0x0000022b, 0x000200f8, 0x0000022a, 0x00050041, 0x00000009, 0x0000022d, 0x00000026,
-    0x00000067, 0x0004003d, 0x00000008, 0x0000022e, 0x0000022d, 0x0003003e, 0x0000022c, 0x0000022e,
-    0x00050041, 0x00000009, 0x00000230, 0x00000027, 0x00000067, 0x0004003d, 0x00000008, 0x00000231,
-    0x00000230, 0x0003003e, 0x0000022f, 0x00000231, 0x00050041, 0x00000009, 0x00000233, 0x00000028,
-    0x00000067, 0x0004003d, 0x00000008, 0x00000234, 0x00000233, 0x0003003e, 0x00000232, 0x00000234,
-    0x0004003d, 0x00000006, 0x00000236, 0x00000187, 0x0003003e, 0x00000235, 0x00000236, 0x0004003d,
-    0x00000008, 0x00000238, 0x00000136, 0x0003003e, 0x00000237, 0x00000238, 0x0004003d, 0x00000008,
-    0x0000023a, 0x000001e2, 0x0003003e, 0x00000239, 0x0000023a, 0x0004003d, 0x00000008, 0x0000023c,
-    0x00000170, 0x0003003e, 0x0000023b, 0x0000023c, 0x0004003d, 0x00000008, 0x0000023e, 0x000001d8,
-    0x0003003e, 0x0000023d, 0x0000023e, 0x0004003d, 0x00000006, 0x00000240, 0x00000224, 0x0003003e,
-    0x0000023f, 0x00000240, 0x000d0039, 0x00000002, 0x00000241, 0x0000001c, 0x0000022c, 0x0000022f,
-    0x00000232, 0x00000235, 0x00000237, 0x00000239, 0x0000023b, 0x0000023d, 0x0000023f, 0x0004003d,
-    0x00000008, 0x00000242, 0x0000022c, 0x00050041, 0x00000009, 0x00000243, 0x00000026, 0x00000067,
-    0x0003003e, 0x00000243, 0x00000242, 0x0004003d, 0x00000008, 0x00000244, 0x0000022f, 0x00050041,
-    0x00000009, 0x00000245, 0x00000027, 0x00000067, 0x0003003e, 0x00000245, 0x00000244, 0x0004003d,
-    0x00000008, 0x00000246, 0x00000232, 0x00050041, 0x00000009, 0x00000247, 0x00000028, 0x00000067,
-    0x0003003e, 0x00000247, 0x00000246, 0x000200f9, 0x0000022b, 0x000200f8, 0x0000022b, 0x0004003d,
-    0x00000006, 0x00000248, 0x0000018b, 0x000400a8, 0x00000006, 0x00000249, 0x00000248, 0x000300f7,
-    0x0000024b, 0x00000000, 0x000400fa, 0x00000249, 0x0000024a, 0x0000024b, 0x000200f8, 0x0000024a,
-    0x0004003d, 0x00000008, 0x0000024c, 0x00000180, 0x000500c7, 0x00000008, 0x0000024d, 0x0000024c,
-    0x000001be, 0x000500ab, 0x00000006, 0x0000024e, 0x0000024d, 0x00000067, 0x000200f9, 0x0000024b,
-    0x000200f8, 0x0000024b, 0x000700f5, 0x00000006, 0x0000024f, 0x00000248, 0x0000022b, 0x0000024e,
-    0x0000024a, 0x000300f7, 0x00000251, 0x00000000, 0x000400fa, 0x0000024f, 0x00000250, 0x00000251,
-    0x000200f8, 0x00000250, 0x00050041, 0x00000009, 0x00000253, 0x00000026, 0x000000a1, 0x0004003d,
-    0x00000008, 0x00000254, 0x00000253, 0x0003003e, 0x00000252, 0x00000254, 0x00050041, 0x00000009,
-    0x00000256, 0x00000027, 0x000000a1, 0x0004003d, 0x00000008, 0x00000257, 0x00000256, 0x0003003e,
-    0x00000255, 0x00000257, 0x00050041, 0x00000009, 0x00000259, 0x00000028, 0x000000a1, 0x0004003d,
-    0x00000008, 0x0000025a, 0x00000259, 0x0003003e, 0x00000258, 0x0000025a, 0x0004003d, 0x00000006,
-    0x0000025c, 0x00000187, 0x0003003e, 0x0000025b, 0x0000025c, 0x0004003d, 0x00000008, 0x0000025e,
-    0x00000136, 0x0003003e, 0x0000025d, 0x0000025e, 0x0004003d, 0x00000008, 0x00000260, 0x000001e2,
-    0x0003003e, 0x0000025f, 0x00000260, 0x0004003d, 0x00000008, 0x00000262, 0x00000170, 0x0003003e,
-    0x00000261, 0x00000262, 0x0004003d, 0x00000008, 0x00000264, 0x000001d8, 0x0003003e, 0x00000263,
-    0x00000264, 0x0004003d, 0x00000006, 0x00000266, 0x00000224, 0x0003003e, 0x00000265, 0x00000266,
-    0x000d0039, 0x00000002, 0x00000267, 0x0000001c, 0x00000252, 0x00000255, 0x00000258, 0x0000025b,
-    0x0000025d, 0x0000025f, 0x00000261, 0x00000263, 0x00000265, 0x0004003d, 0x00000008, 0x00000268,
-    0x00000252, 0x00050041, 0x00000009, 0x00000269, 0x00000026, 0x000000a1, 0x0003003e, 0x00000269,
-    0x00000268, 0x0004003d, 0x00000008, 0x0000026a, 0x00000255, 0x00050041, 0x00000009, 0x0000026b,
-    0x00000027, 0x000000a1, 0x0003003e, 0x0000026b, 0x0000026a, 0x0004003d, 0x00000008, 0x0000026c,
-    0x00000258, 0x00050041, 0x00000009, 0x0000026d, 0x00000028, 0x000000a1, 0x0003003e, 0x0000026d,
-    0x0000026c, 0x000200f9, 0x00000251, 0x000200f8, 0x00000251, 0x000200f9, 0x000001e8, 0x000200f8,
-    0x000001e8, 0x000200f9, 0x00000186, 0x000200f8, 0x0000026e, 0x0004003d, 0x00000006, 0x0000026f,
-    0x00000168, 0x000400a8, 0x00000006, 0x00000270, 0x0000026f, 0x000300f7, 0x00000272, 0x00000000,
-    0x000400fa, 0x00000270, 0x00000271, 0x00000272, 0x000200f8, 0x00000271, 0x0003003e, 0x0000002b,
-    0x00000067, 0x000200f9, 0x00000272, 0x000200f8, 0x00000272, 0x0004003d, 0x00000006, 0x00000274,
-    0x0000016b, 0x0003003e, 0x00000273, 0x00000274, 0x0004003d, 0x00000006, 0x00000276, 0x0000015c,
-    0x0003003e, 0x00000275, 0x00000276, 0x00050041, 0x00000009, 0x00000278, 0x00000027, 0x00000067,
-    0x0004003d, 0x00000008, 0x00000279, 0x00000278, 0x0003003e, 0x00000277, 0x00000279, 0x0004003d,
-    0x00000008, 0x0000027b, 0x00000170, 0x0003003e, 0x0000027a, 0x0000027b, 0x00050041, 0x00000009,
-    0x0000027d, 0x00000028, 0x00000067, 0x0004003d, 0x00000008, 0x0000027e, 0x0000027d, 0x0003003e,
-    0x0000027c, 0x0000027e, 0x00090039, 0x00000006, 0x0000027f, 0x00000010, 0x00000273, 0x00000275,
-    0x00000277, 0x0000027a, 0x0000027c, 0x000400a8, 0x00000006, 0x00000280, 0x0000027f, 0x000300f7,
-    0x00000282, 0x00000000, 0x000400fa, 0x00000280, 0x00000281, 0x00000282, 0x000200f8, 0x00000281,
-    0x0003003e, 0x0000002b, 0x000000a1, 0x000200f9, 0x00000282, 0x000200f8, 0x00000282, 0x0004003d,
-    0x00000008, 0x00000283, 0x00000180, 0x000500c7, 0x00000008, 0x00000284, 0x00000283, 0x000001be,
-    0x000500ab, 0x00000006, 0x00000285, 0x00000284, 0x00000067, 0x000300f7, 0x00000287, 0x00000000,
-    0x000400fa, 0x00000285, 0x00000286, 0x00000287, 0x000200f8, 0x00000286, 0x0004003d, 0x00000006,
-    0x00000289, 0x0000016b, 0x0003003e, 0x00000288, 0x00000289, 0x0004003d, 0x00000006, 0x0000028b,
-    0x0000015c, 0x0003003e, 0x0000028a, 0x0000028b, 0x00050041, 0x00000009, 0x0000028d, 0x00000027,
-    0x000000a1, 0x0004003d, 0x00000008, 0x0000028e, 0x0000028d, 0x0003003e, 0x0000028c, 0x0000028e,
-    0x0004003d, 0x00000008, 0x00000290, 0x00000170, 0x0003003e, 0x0000028f, 0x00000290, 0x00050041,
-    0x00000009, 0x00000292, 0x00000028, 0x000000a1, 0x0004003d, 0x00000008, 0x00000293, 0x00000292,
-    0x0003003e, 0x00000291, 0x00000293, 0x00090039, 0x00000006, 0x00000294, 0x00000010, 0x00000288,
-    0x0000028a, 0x0000028c, 0x0000028f, 0x00000291, 0x000400a8, 0x00000006, 0x00000295, 0x00000294,
-    0x000300f7, 0x00000297, 0x00000000, 0x000400fa, 0x00000295, 0x00000296, 0x00000297, 0x000200f8,
-    0x00000296, 0x0004003d, 0x00000008, 0x00000298, 0x0000002b, 0x000500c5, 0x00000008, 0x00000299,
-    0x00000298, 0x0000019c, 0x0003003e, 0x0000002b, 0x00000299, 0x000200f9, 0x00000297, 0x000200f8,
-    0x00000297, 0x000200f9, 0x00000287, 0x000200f8, 0x00000287, 0x000200f9, 0x00000186, 0x000200f8,
-    0x00000186, 0x000200f9, 0x00000152, 0x000200f8, 0x00000152, 0x000200f9, 0x00000122, 0x000200f8,
-    0x00000122, 0x000200f9, 0x0000011f, 0x000200f8, 0x00000121, 0x000200f9, 0x000000e7, 0x000200f8,
-    0x000000e7, 0x000200f9, 0x000000e4, 0x000200f8, 0x000000e6, 0x000100fd, 0x00010038,
+const uint8_t Blob041_Data[6947] =
+{
+    0x28, 0xb5, 0x2f, 0xfd, 0x60, 0x7c, 0x67, 0xcd, 0xd8, 0x00, 0xea, 0xdc, 0x08, 0x36, 0x35, 0x10,
+    0x70, 0x7b, 0xc6, 0x30, 0xc3, 0x88, 0x31, 0x8e, 0x78, 0x10, 0xc3, 0xde, 0x78, 0x00, 0x34, 0xc4,
+    0x98, 0x78, 0xb1, 0xc7, 0x7e, 0x11, 0x6d, 0xf2, 0xdb, 0x93, 0x24, 0xb8, 0xd6, 0x9c, 0x92, 0x13,
+    0x9b, 0x52, 0xb6, 0x5d, 0x96, 0xb3, 0xb7, 0xc9, 0x9f, 0xba, 0x6d, 0xb3, 0xdd, 0xf2, 0x96, 0xac,
+    0xec, 0x2d, 0x72, 0xa7, 0x01, 0x03, 0x52, 0x03, 0x7d, 0x03, 0x4b, 0xcf, 0xa4, 0xa2, 0xb6, 0x5f,
+    0x6d, 0xed, 0x06, 0xcd, 0x86, 0xac, 0x0b, 0xc6, 0xe5, 0xda, 0x62, 0xdd, 0x75, 0x95, 0x96, 0x27,
+    0x8b, 0x63, 0x73, 0xeb, 0x2c, 0xf6, 0x05, 0xfc, 0x1a, 0xcf, 0x09, 0xb5, 0x8f, 0xb2, 0xa9, 0xa9,
+    0x01, 0x43, 0x26, 0xe6, 0xa5, 0x25, 0xa5, 0x24, 0xe3, 0xa2, 0x22, 0xa2, 0x21, 0xe1, 0x79, 0xd7,
+    0xcb, 0x6d, 0x68, 0x66, 0x72, 0x59, 0x2b, 0x37, 0x5b, 0x3d, 0x51, 0x4e, 0xf7, 0xdd, 0x3f, 0x33,
+    0x13, 0xfa, 0xf3, 0x38, 0xbc, 0x03, 0xd9, 0x39, 0xaf, 0xff, 0x8d, 0x67, 0xdf, 0x94, 0xb9, 0xe2,
+    0xac, 0x57, 0xfe, 0x57, 0xf3, 0x6f, 0x58, 0xdf, 0xe9, 0xfa, 0xf2, 0x34, 0x27, 0x7f, 0x24, 0x3f,
+    0x8b, 0xf1, 0xbb, 0xff, 0x22, 0x5e, 0xd4, 0xfa, 0xb4, 0x36, 0x1d, 0x15, 0xed, 0x23, 0x8b, 0xd5,
+    0x42, 0x75, 0xd0, 0xf0, 0xda, 0xe7, 0x3f, 0xd9, 0x8d, 0x13, 0x8d, 0xad, 0x7c, 0x26, 0xeb, 0x6a,
+    0x37, 0x07, 0x2d, 0xe6, 0x25, 0xa5, 0x64, 0x64, 0xe2, 0x21, 0xe1, 0xd9, 0x9c, 0x7b, 0x71, 0xbe,
+    0xbd, 0x06, 0x79, 0x76, 0x73, 0x63, 0x61, 0x5f, 0x5d, 0x5b, 0x59, 0x57, 0x54, 0xf5, 0x54, 0xdd,
+    0xf4, 0x53, 0x52, 0x89, 0x0c, 0x01, 0x72, 0xea, 0x23, 0xc6, 0x8b, 0xd0, 0x16, 0x81, 0xb8, 0x8e,
+    0x97, 0x57, 0x70, 0xfe, 0x7f, 0xc7, 0x64, 0x6f, 0x4e, 0x37, 0xf9, 0x90, 0x5f, 0x74, 0xe2, 0xa1,
+    0x7e, 0x58, 0xb8, 0xeb, 0x3a, 0xb6, 0x0c, 0xf8, 0x15, 0xc3, 0x95, 0xff, 0x3e, 0xdc, 0xe7, 0xa7,
+    0x97, 0x67, 0xfe, 0xbf, 0xd3, 0xa6, 0xd9, 0xdc, 0xb9, 0x21, 0xee, 0xb6, 0x77, 0xb7, 0xdc, 0xdf,
+    0xde, 0x0b, 0xb4, 0x85, 0x78, 0xf6, 0xc7, 0xe1, 0xb7, 0x3c, 0xfb, 0x77, 0xb2, 0x59, 0xfd, 0x5f,
+    0x26, 0xd7, 0x2d, 0xc0, 0xd6, 0x8d, 0xf1, 0x32, 0x5d, 0xde, 0x6e, 0xd6, 0xc3, 0x69, 0x5f, 0x57,
+    0xf7, 0x59, 0x3a, 0x6f, 0x19, 0xed, 0x8b, 0x97, 0xf9, 0xb6, 0x7f, 0x2f, 0xb8, 0x3f, 0xd7, 0xcf,
+    0x7b, 0x19, 0x3f, 0x33, 0xb3, 0x69, 0xb7, 0x75, 0xd9, 0xa7, 0x2b, 0xe3, 0xba, 0x5d, 0x7f, 0x61,
+    0x5e, 0xa7, 0x9f, 0x7f, 0x3f, 0xfb, 0x33, 0x9f, 0xe3, 0xcc, 0xbe, 0x5c, 0xe6, 0x65, 0xae, 0xe3,
+    0xd2, 0x2a, 0xcc, 0xbf, 0x79, 0x61, 0xb8, 0x4c, 0xe5, 0xe7, 0x64, 0x1e, 0x2a, 0xfc, 0xb2, 0x11,
+    0x02, 0xe9, 0xf8, 0x4e, 0xb7, 0xf3, 0x5b, 0xf3, 0xcd, 0xef, 0x7f, 0xe0, 0x70, 0xbe, 0x66, 0xf3,
+    0x6e, 0x7a, 0x1e, 0x67, 0xae, 0xeb, 0xfe, 0xed, 0xdf, 0x30, 0xde, 0x38, 0xcf, 0x75, 0x2f, 0x56,
+    0xfb, 0x1d, 0x97, 0x8d, 0xb3, 0xff, 0xb6, 0x18, 0xcf, 0xe7, 0xea, 0xee, 0x7f, 0xf3, 0x5d, 0x27,
+    0xd3, 0x61, 0xff, 0xff, 0xac, 0x93, 0xf1, 0xfe, 0xf5, 0xdc, 0xcf, 0xef, 0x6c, 0xb6, 0x8b, 0xcf,
+    0xe6, 0x7c, 0x6e, 0x1c, 0x36, 0xfb, 0xdb, 0x4f, 0x0d, 0x99, 0x2d, 0x68, 0x6c, 0x63, 0x72, 0x78,
+    0x1f, 0x1c, 0xb3, 0x89, 0x71, 0x2f, 0xd9, 0x8d, 0x4f, 0x0c, 0x56, 0xd5, 0xea, 0x6c, 0x49, 0xb4,
+    0xaf, 0x42, 0xfb, 0x65, 0x3c, 0x70, 0x0f, 0x9b, 0xdd, 0x70, 0xdf, 0xe6, 0x77, 0xbf, 0xf0, 0x1f,
+    0x5d, 0x17, 0x4c, 0x4e, 0xe3, 0x6e, 0x6f, 0xf1, 0x99, 0x16, 0xaf, 0x1b, 0x93, 0xc9, 0x75, 0xd9,
+    0xdf, 0xc7, 0x67, 0x65, 0x73, 0x18, 0xcd, 0xd6, 0xfe, 0xbf, 0x5f, 0x3e, 0x57, 0x56, 0xef, 0x63,
+    0x3c, 0xac, 0xe3, 0x77, 0xd8, 0x37, 0x8f, 0xc9, 0x60, 0x43, 0x31, 0x39, 0x2e, 0xf0, 0xac, 0xe0,
+    0x0e, 0xd4, 0xc9, 0x7e, 0xe1, 0xb1, 0x1d, 0xbe, 0xe7, 0x6f, 0x28, 0xf0, 0xbf, 0xb2, 0x18, 0xf7,
+    0x50, 0xa6, 0x99, 0x21, 0x53, 0xed, 0xd2, 0x6c, 0x6e, 0xf2, 0x3b, 0xce, 0xc5, 0x7d, 0x71, 0x6c,
+    0x83, 0xb9, 0x5e, 0x9e, 0xfa, 0xad, 0x38, 0xec, 0x1d, 0xe7, 0xbb, 0x54, 0x0e, 0xc6, 0xf5, 0x7c,
+    0x90, 0x7c, 0x06, 0xe8, 0xc5, 0xf5, 0x9d, 0x80, 0x9e, 0x8f, 0xc7, 0x61, 0xc2, 0xa8, 0x87, 0x7a,
+    0x72, 0xfa, 0x3d, 0x37, 0xfb, 0xf9, 0xc1, 0x0d, 0x78, 0x6f, 0x53, 0x9d, 0x8e, 0x0b, 0xf8, 0xbe,
+    0xab, 0xf3, 0x60, 0x18, 0x0a, 0xd0, 0x8c, 0xbf, 0xe5, 0x66, 0x1d, 0x27, 0x9f, 0x99, 0xcd, 0xb9,
+    0x97, 0xac, 0xc7, 0x15, 0x78, 0x9e, 0x3d, 0xac, 0x13, 0x16, 0x11, 0x0d, 0x95, 0x79, 0x75, 0xb3,
+    0xd0, 0x59, 0x10, 0x21, 0xf9, 0x8b, 0xff, 0xd1, 0x99, 0xc3, 0x40, 0x8f, 0xff, 0xf8, 0xe8, 0x64,
+    0x31, 0xd9, 0xdb, 0x03, 0xb5, 0x8f, 0x73, 0xef, 0x59, 0x6c, 0x1e, 0xe3, 0x7a, 0xdd, 0x4e, 0x16,
+    0xc7, 0x19, 0xe9, 0xfb, 0x5e, 0xb6, 0x93, 0x8b, 0xc3, 0xbb, 0xce, 0xff, 0x6e, 0xfe, 0xe6, 0x10,
+    0xe6, 0xe1, 0x3b, 0xf0, 0x38, 0xec, 0xc5, 0xfd, 0x70, 0xc4, 0xf8, 0x59, 0x30, 0xbf, 0xd1, 0xfe,
+    0xf9, 0xcb, 0xaa, 0x0f, 0xca, 0x9c, 0x9b, 0xcd, 0x78, 0xdc, 0x6e, 0xce, 0xeb, 0xfe, 0xf6, 0x72,
+    0x8e, 0x66, 0xf3, 0xd9, 0xef, 0x59, 0xec, 0x1d, 0x87, 0xb9, 0x9f, 0x0f, 0x86, 0x77, 0x6f, 0xae,
+    0x87, 0xbf, 0x7c, 0xf9, 0x38, 0x2c, 0xe6, 0xcb, 0xc5, 0x86, 0xbb, 0x99, 0xaf, 0x5c, 0xf6, 0xf2,
+    0x21, 0x70, 0x53, 0x83, 0x83, 0x53, 0xe3, 0xb3, 0xc1, 0x92, 0xd6, 0x36, 0x96, 0x07, 0x40, 0x96,
+    0x27, 0xf4, 0xbf, 0xde, 0x54, 0xfd, 0x71, 0x18, 0x0f, 0xcc, 0x6a, 0x77, 0x5e, 0xe7, 0xab, 0xb2,
+    0xb0, 0x0c, 0x7c, 0x77, 0xb3, 0x01, 0x37, 0x3a, 0x37, 0xb5, 0xfb, 0x1f, 0xfb, 0xf5, 0x03, 0x78,
+    0x9b, 0xca, 0x73, 0xff, 0xe6, 0xb1, 0xf6, 0x6f, 0x05, 0xd4, 0x76, 0x6c, 0x09, 0xd6, 0xd8, 0xe4,
+    0xea, 0xb4, 0xb5, 0x12, 0x79, 0x5a, 0x69, 0x68, 0x08, 0xcc, 0xc8, 0xb4, 0xbe, 0xc8, 0x18, 0xc7,
+    0x3e, 0xc1, 0xc4, 0xc2, 0xbc, 0xba, 0xbe, 0x3e, 0x2d, 0xad, 0xbc, 0x3c, 0xb9, 0xba, 0x3e, 0xcb,
+    0xbf, 0xc5, 0xa5, 0x04, 0x17, 0xba, 0xa5, 0x04, 0xcb, 0xea, 0xc0, 0x15, 0x96, 0x67, 0x24, 0xf7,
+    0x00, 0x99, 0x8a, 0xd5, 0x00, 0x55, 0x01, 0x03, 0x53, 0x05, 0x08, 0x3c, 0x20, 0x10, 0x25, 0xd5,
+    0x0a, 0x15, 0x85, 0x0d, 0x7c, 0x82, 0x72, 0x7a, 0x72, 0x1a, 0x50, 0x0f, 0x69, 0x62, 0x5a, 0x12,
+    0xb0, 0xa4, 0x94, 0x64, 0x2b, 0x01, 0x21, 0x1d, 0x01, 0x19, 0x1d, 0x15, 0x11, 0x19, 0x15, 0x75,
+    0xff, 0x47, 0xd4, 0xe7, 0xa7, 0xc7, 0x27, 0x40, 0x8f, 0x13, 0x3b, 0x00, 0x28, 0x00, 0x9b, 0x67,
+    0x07, 0x54, 0xe7, 0xff, 0xbb, 0xdc, 0xad, 0xdd, 0x1d, 0xdd, 0xde, 0x37, 0xeb, 0x9a, 0xfb, 0x5f,
+    0x6b, 0x67, 0xed, 0xda, 0xb6, 0xdf, 0x15, 0x6b, 0xff, 0xab, 0x9a, 0x35, 0x69, 0xd4, 0xa0, 0x71,
+    0x4d, 0x73, 0x06, 0xcd, 0x19, 0x32, 0xab, 0x63, 0xb8, 0x90, 0x11, 0x33, 0x26, 0x8c, 0x18, 0x30,
+    0x5f, 0xc2, 0x78, 0xf9, 0xd2, 0xc5, 0x4b, 0x97, 0x2d, 0x5c, 0xb4, 0x6c, 0xc9, 0x72, 0x45, 0x0b,
+    0x96, 0x2c, 0x58, 0xa6, 0xa0, 0x4a, 0x51, 0x9d, 0x12, 0x17, 0x45, 0x0a, 0x94, 0x28, 0x4f, 0x9a,
+    0x40, 0x61, 0xd2, 0x64, 0x09, 0x93, 0x25, 0xa9, 0xaa, 0x4a, 0x8e, 0xa4, 0x82, 0x95, 0x20, 0x49,
+    0x92, 0x08, 0x8a, 0x44, 0x88, 0x3d, 0x40, 0x48, 0x90, 0x21, 0x40, 0x82, 0xfc, 0x00, 0x82, 0xf6,
+    0x03, 0x41, 0x19, 0xe5, 0xa9, 0xa9, 0x8f, 0x51, 0x52, 0xad, 0x8f, 0x9b, 0x55, 0x87, 0x2b, 0xb8,
+    0x47, 0xe9, 0xfd, 0x49, 0xc6, 0xa3, 0x47, 0xe9, 0x0e, 0x1e, 0x2b, 0x54, 0xec, 0x60, 0x41, 0x4a,
+    0x9a, 0xe3, 0xcc, 0xeb, 0x68, 0xbd, 0x21, 0x5a, 0x03, 0x94, 0x06, 0x8c, 0x1a, 0xdc, 0x19, 0x34,
+    0x64, 0xcc, 0x88, 0x21, 0x23, 0x1d, 0xe3, 0x05, 0x0c, 0x17, 0x2f, 0xc0, 0xa1, 0x2e, 0x5a, 0x7c,
+    0xb2, 0x68, 0xb1, 0x82, 0xc5, 0x98, 0x8a, 0x15, 0x29, 0x54, 0xa0, 0x48, 0x81, 0xc2, 0x93, 0xf3,
+    0x84, 0x27, 0xf6, 0xd6, 0x9e, 0xb8, 0x4d, 0x60, 0xb7, 0x25, 0xd0, 0x24, 0x3a, 0x91, 0x38, 0x90,
+    0x08, 0xb3, 0x5f, 0x4c, 0xc4, 0x88, 0xc4, 0xb4, 0x07, 0x11, 0xe8, 0x10, 0x69, 0xae, 0xe3, 0x07,
+    0x10, 0xe9, 0x0f, 0x1d, 0x3c, 0x70, 0xc3, 0xea, 0x0e, 0x4b, 0xca, 0x36, 0x35, 0x35, 0x60, 0xc8,
+    0xc4, 0xbc, 0xb4, 0xa4, 0x94, 0x64, 0x5c, 0x54, 0xdc, 0x22, 0x1a, 0x12, 0x9e, 0x97, 0x76, 0xbd,
+    0x5b, 0x4e, 0xd2, 0xca, 0xb2, 0xb2, 0x81, 0x58, 0x57, 0x51, 0x4f, 0x4d, 0x47, 0xb7, 0xa2, 0x4b,
+    0xa0, 0x49, 0x9f, 0x9c, 0xdd, 0x2d, 0x87, 0x24, 0xad, 0x19, 0xfb, 0xb3, 0xb5, 0x16, 0x19, 0xd9,
+    0xaa, 0x92, 0xa9, 0x9f, 0x52, 0xf5, 0x51, 0xae, 0x4c, 0x6b, 0xa4, 0xb8, 0xbf, 0xdf, 0xa0, 0x7b,
+    0xf7, 0x6d, 0x6a, 0x8f, 0x76, 0x66, 0xf6, 0x67, 0x65, 0x66, 0x45, 0x8f, 0x2d, 0x1b, 0xaa, 0xc3,
+    0x6e, 0xc0, 0x3e, 0xb3, 0xc6, 0xae, 0x3c, 0x3d, 0xab, 0x94, 0xb6, 0x53, 0x36, 0x93, 0x9d, 0x44,
+    0x34, 0x24, 0x34, 0x14, 0x24, 0x14, 0x74, 0x94, 0x63, 0xe3, 0xd8, 0xf6, 0x8d, 0x8d, 0x5d, 0x9b,
+    0xb9, 0xe2, 0xda, 0x6a, 0xa6, 0x4c, 0x6b, 0x19, 0x30, 0xe0, 0x2b, 0x56, 0x72, 0xaa, 0x50, 0x01,
+    0xd7, 0x4f, 0x6c, 0x1c, 0x9d, 0x1c, 0x31, 0x52, 0x13, 0xa9, 0x73, 0xdc, 0x8f, 0xa3, 0x56, 0x9a,
+    0x7a, 0x0d, 0xed, 0xd6, 0x21, 0xea, 0xcd, 0x57, 0x42, 0xff, 0x92, 0x9d, 0x1b, 0xaf, 0x69, 0xd2,
+    0x75, 0x07, 0x0e, 0x51, 0x94, 0x37, 0x81, 0x44, 0xc4, 0x43, 0x44, 0xc3, 0x43, 0xc3, 0xdd, 0xac,
+    0x9b, 0x05, 0x75, 0x41, 0xb2, 0x0f, 0xfc, 0xf7, 0xab, 0xfa, 0xda, 0x38, 0xc8, 0xc3, 0xbb, 0xc3,
+    0xb3, 0xbb, 0xb3, 0xe3, 0x7a, 0x72, 0x1f, 0xa9, 0xee, 0x73, 0xb8, 0x08, 0xba, 0x68, 0x67, 0x66,
+    0xdd, 0xb3, 0xb7, 0xc1, 0x8e, 0x79, 0x75, 0x71, 0x75, 0x6d, 0x6d, 0x0d, 0x11, 0x09, 0x0d, 0x95,
+    0x09, 0x12, 0x0a, 0xe2, 0xf6, 0x80, 0x77, 0x78, 0xb8, 0x3a, 0x5b, 0xf4, 0x4e, 0x0e, 0x8e, 0x4e,
+    0x9d, 0xf3, 0xef, 0x88, 0x63, 0x73, 0x83, 0xc3, 0x46, 0x0a, 0x64, 0xf7, 0x7e, 0xac, 0xe7, 0x5e,
+    0xfd, 0x36, 0x7b, 0x6b, 0xbf, 0x6c, 0x9c, 0xac, 0x52, 0x5d, 0x02, 0xfb, 0xaf, 0x36, 0x52, 0x7d,
+    0x84, 0xfd, 0x12, 0xaf, 0x46, 0xbf, 0x86, 0x4b, 0x56, 0x86, 0x47, 0x0a, 0x17, 0xbb, 0x44, 0xf5,
+    0x4b, 0x09, 0x36, 0x95, 0xab, 0x44, 0x4b, 0xaa, 0x64, 0x23, 0x94, 0xcb, 0xc2, 0x5e, 0xa1, 0xe2,
+    0x0b, 0x45, 0x9d, 0xe2, 0xf3, 0x04, 0x92, 0x4e, 0xed, 0xf9, 0xa9, 0xe4, 0x09, 0x54, 0xe2, 0x84,
+    0x91, 0x89, 0x6c, 0x09, 0x6c, 0x5a, 0x08, 0x44, 0xd2, 0xe6, 0x63, 0x8e, 0x55, 0xfe, 0xeb, 0xe2,
+    0x2b, 0x64, 0xe3, 0xd8, 0x9f, 0x7f, 0x71, 0xfc, 0xe0, 0xd7, 0x4f, 0xda, 0xd9, 0x7b, 0x06, 0xff,
+    0x8a, 0xc7, 0xb5, 0x43, 0x8a, 0x02, 0x66, 0xee, 0x9f, 0xec, 0xc9, 0xc4, 0xb2, 0x5b, 0xf5, 0x67,
+    0x71, 0xa5, 0xb6, 0x4b, 0x49, 0x4c, 0x9f, 0xa3, 0xb4, 0x54, 0x2b, 0x05, 0x21, 0x25, 0x61, 0x91,
+    0x02, 0x2c, 0x75, 0x6d, 0x96, 0xb8, 0xdd, 0xe7, 0xfe, 0x6c, 0xb3, 0xb7, 0x8f, 0xbd, 0xd4, 0x33,
+    0x74, 0xb3, 0x5a, 0x63, 0xa3, 0x64, 0xdb, 0xda, 0x6c, 0x2c, 0xda, 0x0e, 0x11, 0x91, 0x90, 0x50,
+    0x10, 0x8f, 0x9d, 0x73, 0x63, 0xdb, 0x6c, 0xeb, 0x23, 0x45, 0x6e, 0x22, 0x46, 0xa1, 0x44, 0x37,
+    0x9b, 0x77, 0x62, 0xe2, 0xe1, 0xa1, 0xa1, 0x76, 0xdf, 0x75, 0x5d, 0x10, 0x9b, 0x97, 0x77, 0xf7,
+    0x77, 0x53, 0xb7, 0x1d, 0x94, 0x4d, 0x53, 0x57, 0x89, 0xbb, 0x66, 0x66, 0x24, 0xe4, 0xc3, 0xad,
+    0xb3, 0xd8, 0x37, 0xf3, 0xf2, 0xe2, 0xe2, 0xda, 0xc2, 0xda, 0x3c, 0x97, 0x8b, 0xd5, 0xe2, 0xb0,
+    0x43, 0xd4, 0x68, 0xec, 0xbf, 0x5d, 0x63, 0xb3, 0xd8, 0x7f, 0x2d, 0x52, 0x0d, 0x68, 0x5c, 0xcf,
+    0xa0, 0x5d, 0x5b, 0xcd, 0x94, 0x69, 0x15, 0xc0, 0x8a, 0x34, 0xa6, 0x29, 0xcc, 0x98, 0x52, 0x31,
+    0x61, 0x7c, 0xa4, 0xc1, 0xec, 0xd8, 0xf2, 0xc5, 0xcb, 0x96, 0x67, 0xc3, 0x76, 0xc1, 0xe1, 0x52,
+    0xc5, 0x4a, 0x15, 0x2d, 0x60, 0x2d, 0x4d, 0x59, 0xb0, 0x60, 0xf9, 0x2b, 0x56, 0xca, 0x50, 0xa1,
+    0xb2, 0x9a, 0x64, 0xca, 0x2a, 0x5a, 0xca, 0x14, 0x24, 0xc7, 0x28, 0x4f, 0xa0, 0xa4, 0x9f, 0x38,
+    0x69, 0x02, 0x56, 0x65, 0x82, 0x79, 0x49, 0x29, 0x19, 0xb9, 0x4d, 0x3c, 0x24, 0xec, 0x9e, 0xcd,
+    0xf9, 0xd6, 0x8b, 0xf3, 0xed, 0x35, 0xd8, 0xe6, 0xd9, 0xcd, 0x8d, 0x6d, 0xc3, 0xbe, 0xba, 0xb6,
+    0xb2, 0xb6, 0x57, 0x54, 0x53, 0x75, 0xd3, 0x76, 0x4a, 0x2a, 0x91, 0x21, 0x40, 0x4e, 0x7d, 0x6c,
+    0x63, 0xbc, 0x08, 0x6d, 0xb1, 0xa2, 0x93, 0x73, 0x12, 0x72, 0x8b, 0x2e, 0x2c, 0x77, 0x01, 0xff,
+    0xfa, 0xf4, 0xb6, 0x74, 0x65, 0x5a, 0x54, 0x4e, 0x58, 0x20, 0x35, 0x64, 0xb6, 0x7c, 0x12, 0x03,
+    0x53, 0x52, 0x04, 0xb6, 0x51, 0x50, 0x4f, 0x4e, 0x4b, 0x03, 0x9a, 0xba, 0x02, 0x92, 0x98, 0x0a,
+    0xd4, 0x89, 0x89, 0x48, 0x7a, 0x8e, 0x20, 0x31, 0x12, 0x85, 0x3d, 0xb2, 0x7d, 0x1c, 0x21, 0x23,
+    0x9a, 0x45, 0x50, 0x89, 0xf0, 0xc0, 0x44, 0xbd, 0x1c, 0x52, 0x29, 0xa4, 0x74, 0x32, 0x88, 0x0c,
+    0x19, 0x40, 0x2e, 0x7f, 0x00, 0x39, 0xfd, 0x61, 0x7a, 0xea, 0xc3, 0xd4, 0x47, 0x86, 0x52, 0x1e,
+    0x3d, 0x78, 0x5c, 0xee, 0xd0, 0x41, 0xaa, 0x03, 0x47, 0x8e, 0x51, 0x1c, 0x37, 0x6c, 0x8c, 0x36,
+    0xde, 0xc8, 0x14, 0xa5, 0x51, 0xc3, 0xd1, 0x03, 0x8d, 0xc9, 0x19, 0x31, 0x64, 0xc4, 0x80, 0x21,
+    0x83, 0xc4, 0x23, 0x8c, 0xce, 0x4e, 0x17, 0x2f, 0x42, 0x5d, 0xb4, 0x00, 0x5d, 0xf1, 0x2d, 0x48,
+    0x74, 0x92, 0xe0, 0xec, 0xe4, 0xd4, 0x1c, 0xe1, 0x21, 0x2d, 0x02, 0x0d, 0x22, 0x04, 0xa9, 0xd0,
+    0x07, 0xcd, 0xcd, 0x0e, 0x1c, 0x32, 0x60, 0x6e, 0xd0, 0x90, 0x59, 0x89, 0xa1, 0xe7, 0xc2, 0x25,
+    0xa6, 0x85, 0x0a, 0x93, 0x95, 0x96, 0x41, 0x94, 0x92, 0x3f, 0x71, 0x92, 0x8f, 0x8f, 0x14, 0x20,
+    0x29, 0x44, 0x4e, 0x78, 0x9c, 0xe0, 0xf8, 0x08, 0x76, 0x6c, 0x94, 0xc0, 0xb8, 0xb8, 0x88, 0xf6,
+    0x19, 0x42, 0x73, 0x23, 0x2c, 0x46, 0x50, 0x5c, 0x2c, 0x52, 0x44, 0x4c, 0x44, 0x3c, 0x4c, 0x84,
+    0x70, 0x78, 0x8b, 0x0d, 0x0b, 0x0d, 0xcf, 0x85, 0x44, 0x84, 0xe7, 0xc1, 0xdd, 0x2c, 0xd6, 0x21,
+    0x08, 0xea, 0x63, 0xc1, 0xb8, 0xf2, 0x98, 0x1c, 0x08, 0x68, 0x06, 0x0c, 0x8b, 0xbd, 0x47, 0x78,
+    0xf8, 0xfb, 0x05, 0xff, 0xdd, 0x9f, 0x0c, 0xfc, 0x72, 0xef, 0xd7, 0xdb, 0xf7, 0xc5, 0xfb, 0x1e,
+    0xe0, 0x26, 0x80, 0x1e, 0xf0, 0xc5, 0x39, 0xe0, 0xdb, 0x73, 0xf0, 0xa3, 0xc7, 0xa0, 0xc1, 0x3f,
+    0x5e, 0x9e, 0xdd, 0x1d, 0x69, 0xdd, 0x9c, 0x9c, 0x07, 0xcd, 0x0c, 0x99, 0x97, 0x93, 0x5d, 0x08,
+    0x1f, 0x77, 0x54, 0x44, 0x34, 0x24, 0x14, 0x04, 0xb4, 0xfd, 0xf1, 0xe9, 0xe9, 0x06, 0x30, 0xaa,
+    0xdf, 0xce, 0xde, 0x6e, 0x04, 0x6e, 0x6d, 0x6e, 0x2c, 0xda, 0x12, 0xb0, 0x9d, 0xa9, 0xad, 0xe5,
+    0xa8, 0xe9, 0xa4, 0xa1, 0xb1, 0xa1, 0x99, 0x21, 0xf8, 0xb2, 0x32, 0x03, 0x03, 0x73, 0x25, 0x2b,
+    0xf3, 0x14, 0x1b, 0x2b, 0xdd, 0x09, 0xfb, 0x02, 0xfb, 0xf2, 0x02, 0xc3, 0xf1, 0xba, 0xad, 0xb8,
+    0xd6, 0x6c, 0x71, 0x81, 0x66, 0x69, 0xa1, 0x0f, 0x60, 0x35, 0x1e, 0xc8, 0xb9, 0xaa, 0xb2, 0xaa,
+    0xfa, 0xb7, 0x6a, 0xa5, 0xfa, 0x3f, 0x03, 0x60, 0x66, 0x47, 0x27, 0xa7, 0x8b, 0x73, 0xb3, 0xdd,
+    0xb2, 0x79, 0x1e, 0x2d, 0x2e, 0x35, 0x4f, 0xa0, 0x2c, 0x21, 0x82, 0xe2, 0x84, 0xc9, 0x13, 0x30,
+    0x53, 0x13, 0x27, 0xdc, 0x13, 0xa7, 0x4d, 0x6e, 0x53, 0x26, 0x4b, 0x50, 0x51, 0x53, 0x55, 0x93,
+    0xa8, 0x2a, 0x49, 0x4d, 0x2b, 0x41, 0x92, 0x04, 0x89, 0x91, 0x23, 0x44, 0x8e, 0x14, 0x31, 0x02,
+    0x16, 0x2d, 0x42, 0x64, 0x08, 0xea, 0x10, 0x21, 0xa8, 0x42, 0x6e, 0x20, 0x41, 0x4e, 0x83, 0xfc,
+    0x00, 0x92, 0xfe, 0x61, 0x7a, 0x5a, 0xea, 0xa3, 0x47, 0x69, 0x8f, 0x1d, 0x3c, 0x48, 0x79, 0xe8,
+    0xd8, 0xa1, 0x23, 0x87, 0x2b, 0x29, 0x8e, 0x1c, 0x38, 0x6e, 0x8c, 0x8a, 0x8e, 0xda, 0xb8, 0x91,
+    0xb6, 0x51, 0x83, 0x86, 0xe8, 0x0c, 0x1a, 0x32, 0x66, 0xc8, 0x80, 0x11, 0xc3, 0x45, 0x8c, 0x17,
+    0x30, 0x5e, 0x84, 0x5e, 0x71, 0x01, 0x1a, 0x0a, 0xca, 0xa2, 0x85, 0x8a, 0x16, 0x2b, 0x58, 0xa4,
+    0x57, 0xa4, 0x40, 0xa1, 0xe2, 0x13, 0x85, 0xe7, 0xa7, 0xa7, 0x89, 0x13, 0x9d, 0x27, 0x4a, 0x98,
+    0x40, 0x2d, 0x01, 0xee, 0x7c, 0x12, 0x9c, 0x23, 0x36, 0x47, 0x88, 0xd0, 0x14, 0x91, 0xc6, 0x90,
+    0x0e, 0x91, 0x19, 0x02, 0x04, 0x26, 0x88, 0x0f, 0x97, 0x1f, 0x36, 0x35, 0x35, 0x60, 0xc8, 0xc4,
+    0xbc, 0xb4, 0xa4, 0x94, 0xf4, 0xd0, 0x61, 0xb3, 0x03, 0x07, 0x4d, 0x0e, 0x1b, 0x34, 0x6c, 0xc8,
+    0x80, 0x21, 0xc3, 0x85, 0xcc, 0x0b, 0x16, 0x30, 0x2d, 0x54, 0xb8, 0xac, 0x60, 0xc3, 0xb2, 0x92,
+    0xf2, 0xb3, 0x72, 0x52, 0x72, 0x12, 0x89, 0xc2, 0x29, 0x23, 0x85, 0x3b, 0xd2, 0x74, 0x31, 0x92,
+    0x0b, 0x29, 0x8a, 0x08, 0xf9, 0xc8, 0x6a, 0xf8, 0x38, 0x61, 0x95, 0x70, 0x82, 0xa3, 0x23, 0xe3,
+    0xa2, 0x22, 0xa2, 0x21, 0xe1, 0x79, 0xd7, 0x0b, 0x48, 0xa8, 0x5f, 0xe7, 0xbb, 0x1a, 0x19, 0x4f,
+    0x1b, 0xd1, 0x8b, 0xa6, 0x68, 0x6e, 0x04, 0xc5, 0xd1, 0x08, 0x77, 0x22, 0xa2, 0x68, 0xe2, 0xa1,
+    0x21, 0xeb, 0x61, 0x21, 0xe1, 0x6a, 0xe1, 0xe0, 0x19, 0x75, 0x50, 0xc9, 0xde, 0xcd, 0x3a, 0xa7,
+    0x59, 0xb0, 0xcc, 0x41, 0x90, 0x4c, 0x1e, 0x93, 0xc5, 0x81, 0x9e, 0x80, 0x62, 0xc0, 0x7f, 0x29,
+    0x08, 0xac, 0x61, 0x08, 0x7f, 0xe1, 0xa9, 0x3f, 0xf0, 0xaa, 0x1f, 0x38, 0xf7, 0xfb, 0xe6, 0x5e,
+    0xd4, 0x3e, 0x2f, 0xde, 0x47, 0x8a, 0x3f, 0xb0, 0xa5, 0x1c, 0xf0, 0xf1, 0x35, 0xd8, 0x73, 0xa0,
+    0xb7, 0xb7, 0xaa, 0xc7, 0x20, 0x8f, 0x6e, 0x01, 0x8f, 0x46, 0xbc, 0xbc, 0x3b, 0x3b, 0x3c, 0xd2,
+    0x3a, 0xbb, 0xd5, 0xba, 0x87, 0x9c, 0xa3, 0x93, 0x9b, 0x63, 0x95, 0xeb, 0xc6, 0xad, 0xc2, 0xc5,
+    0x29, 0x80, 0x7b, 0x53, 0xf0, 0xd6, 0xe6, 0x96, 0x00, 0x35, 0x56, 0xa8, 0xfc, 0x95, 0xa5, 0x24,
+    0x26, 0xa6, 0xb9, 0x39, 0x48, 0x48, 0x0d, 0x2f, 0xd5, 0x41, 0x53, 0x6a, 0x43, 0x06, 0x0d, 0x19,
+    0x30, 0x68, 0xb8, 0x80, 0x01, 0xf3, 0x92, 0x52, 0x32, 0xf2, 0x42, 0x26, 0xa6, 0x85, 0xcc, 0xb4,
+    0x85, 0x0a, 0x97, 0x15, 0x2c, 0x29, 0x2b, 0x2d, 0x2b, 0x27, 0x25, 0xf5, 0x26, 0x29, 0x44, 0x02,
+    0x52, 0x78, 0x84, 0x7c, 0x9c, 0x00, 0xe9, 0x38, 0x41, 0x82, 0xa3, 0x04, 0x6e, 0x63, 0x63, 0x9a,
+    0xb1, 0x91, 0xf1, 0xbf, 0x71, 0x11, 0x9d, 0x78, 0x48, 0x78, 0x36, 0x2f, 0x46, 0x48, 0x54, 0x8c,
+    0x00, 0xa5, 0x88, 0x78, 0x88, 0x68, 0x48, 0x58, 0x68, 0x58, 0x38, 0x78, 0xd6, 0x1b, 0xdc, 0xcd,
+    0x80, 0xbb, 0x2e, 0x25, 0xa8, 0x0b, 0x96, 0x75, 0x72, 0xf9, 0x8f, 0x3c, 0x7e, 0xc4, 0x22, 0x27,
+    0x27, 0x0e, 0x4c, 0x07, 0xe6, 0x89, 0x21, 0x00, 0xa6, 0x01, 0xed, 0x20, 0xfc, 0x85, 0xd3, 0xe1,
+    0xb9, 0xbf, 0xdc, 0x8b, 0xf3, 0xed, 0x35, 0xc8, 0xb3, 0x9b, 0x03, 0xfb, 0xe5, 0x7e, 0x5f, 0xef,
+    0xb7, 0x0f, 0xef, 0x7b, 0xc0, 0xf7, 0xc0, 0xc1, 0x9e, 0x03, 0xbd, 0x06, 0x7a, 0x0c, 0xf2, 0x16,
+    0x30, 0x80, 0x5a, 0x80, 0x67, 0x77, 0x87, 0xf7, 0x74, 0x57, 0x37, 0x47, 0x57, 0xe7, 0x44, 0x17,
+    0x27, 0x17, 0x07, 0x27, 0xd7, 0xaa, 0x60, 0x0d, 0xae, 0xad, 0xed, 0x4d, 0x81, 0xdb, 0x1b, 0xda,
+    0x2d, 0x41, 0x5b, 0x02, 0xb6, 0xb6, 0x35, 0xb6, 0x35, 0xa9, 0x34, 0x35, 0xb5, 0x34, 0x34, 0x04,
+    0x08, 0xd0, 0xcc, 0xce, 0xce, 0xa6, 0xcc, 0xc6, 0xc2, 0xbe, 0xba, 0xb6, 0xb2, 0xae, 0xa8, 0x8c,
+    0xca, 0xea, 0xcf, 0xf9, 0x2e, 0xb2, 0xb1, 0x26, 0xb2, 0x5b, 0x2c, 0x2c, 0x55, 0x0c, 0xec, 0xab,
+    0x0c, 0xe6, 0xd5, 0x35, 0xc5, 0x8b, 0x6b, 0x4b, 0x8b, 0x4b, 0x2b, 0x0b, 0x52, 0x0b, 0xeb, 0xea,
+    0x00, 0x16, 0xd4, 0x01, 0x2b, 0xaa, 0x2a, 0xab, 0xa7, 0x2a, 0x03, 0x53, 0x05, 0x0c, 0x38, 0x15,
+    0x20, 0x20, 0x45, 0x20, 0x4a, 0x2a, 0x0a, 0xea, 0xa9, 0x49, 0xcc, 0xe9, 0xe9, 0xd7, 0x38, 0xd1,
+    0x0d, 0x10, 0x80, 0xe5, 0xe8, 0x68, 0x89, 0x89, 0x49, 0x29, 0x69, 0xa9, 0x30, 0x89, 0x0a, 0xc9,
+    0xe8, 0xc8, 0xe8, 0xa8, 0xe8, 0x8b, 0x90, 0xd0, 0x10, 0x51, 0x9a, 0x68, 0x28, 0x48, 0x28, 0x08,
+    0x48, 0x08, 0xc8, 0xe7, 0x27, 0xfd, 0xe3, 0x13, 0xa0, 0x27, 0xdd, 0x13, 0x80, 0x07, 0x40, 0x1a,
+    0x00, 0xcf, 0xce, 0x17, 0x9c, 0x1c, 0x9d, 0x28, 0x9d, 0xb2, 0x9c, 0x1b, 0x9c, 0x1b, 0x1c, 0x9b,
+    0x9b, 0xdb, 0x85, 0xea, 0xa6, 0x72, 0xef, 0xed, 0xd3, 0xb6, 0x7c, 0x67, 0xb5, 0x4e, 0x5a, 0xad,
+    0x2c, 0x99, 0xff, 0xb7, 0xff, 0xeb, 0x28, 0xec, 0xeb, 0xbf, 0xae, 0xa9, 0x9f, 0xc0, 0x9a, 0x34,
+    0x6a, 0xa0, 0xd4, 0xa0, 0x49, 0x03, 0x85, 0xc6, 0xf5, 0xcc, 0x19, 0x33, 0xae, 0x66, 0xca, 0xb4,
+    0xa6, 0x5b, 0x59, 0xcb, 0x80, 0x9d, 0x58, 0xc7, 0x90, 0x19, 0x23, 0x86, 0x4c, 0x18, 0x31, 0x9f,
+    0x60, 0xc2, 0x94, 0x82, 0xf1, 0xb2, 0xe3, 0xa5, 0xcb, 0x17, 0x2e, 0x5d, 0x26, 0xb9, 0x68, 0xd9,
+    0xa2, 0xa5, 0x30, 0xcb, 0x95, 0x5a, 0xc0, 0x15, 0x2b, 0x58, 0x5a, 0xab, 0x58, 0x99, 0x52, 0x85,
+    0xca, 0x94, 0xcd, 0x55, 0x2a, 0x5a, 0xab, 0x50, 0xa0, 0x48, 0x79, 0xb2, 0x28, 0x52, 0x78, 0xa4,
+    0x46, 0x79, 0x02, 0xe5, 0x89, 0x13, 0x28, 0x4d, 0x9c, 0x34, 0x61, 0x92, 0xba, 0x44, 0x95, 0x89,
+    0xaa, 0xa8, 0x68, 0x12, 0x24, 0x49, 0x90, 0x1c, 0x49, 0x62, 0xe4, 0x08, 0x91, 0x21, 0x40, 0x4e,
+    0x7d, 0x18, 0x29, 0x42, 0x04, 0x5d, 0x04, 0x75, 0x48, 0x19, 0x55, 0x08, 0x90, 0x20, 0x42, 0x9e,
+    0x82, 0xfc, 0x38, 0xd5, 0xfb, 0x61, 0xea, 0x03, 0xd0, 0xb4, 0x14, 0xdd, 0xa3, 0x34, 0x0d, 0xd5,
+    0x63, 0x87, 0x8e, 0x1d, 0x3a, 0x48, 0x77, 0xe4, 0xc0, 0x41, 0xda, 0x39, 0x99, 0xe3, 0x7f, 0x14,
+    0xc7, 0x8d, 0x51, 0xb4, 0x8d, 0x1a, 0x35, 0x68, 0x88, 0xce, 0xa0, 0x11, 0x23, 0xb4, 0x05, 0xcf,
+    0x8c, 0xbb, 0x4b, 0x46, 0x0c, 0xb4, 0x0c, 0x18, 0x2f, 0xca, 0x30, 0x5c, 0x84, 0x72, 0xba, 0xe0,
+    0x82, 0xb6, 0xd0, 0x03, 0x65, 0xb1, 0x02, 0x90, 0x85, 0x0a, 0xce, 0x4e, 0x15, 0x26, 0x52, 0xa0,
+    0x48, 0x01, 0x46, 0xf1, 0x69, 0xc2, 0xb3, 0xf3, 0x84, 0x67, 0xfa, 0xe9, 0x44, 0x89, 0xcf, 0x12,
+    0x24, 0x4c, 0x4c, 0x92, 0xb8, 0xbc, 0x0c, 0x11, 0x62, 0x44, 0x5a, 0xc4, 0x08, 0xb4, 0x08, 0x10,
+    0x21, 0x40, 0x7c, 0x08, 0xe1, 0xe1, 0x43, 0x87, 0x4d, 0x0f, 0x9b, 0x9a, 0x9a, 0x1c, 0x36, 0x68,
+    0x6e, 0xd0, 0xa0, 0x99, 0x41, 0x43, 0x1a, 0x43, 0x06, 0x0c, 0x99, 0x4c, 0x16, 0x32, 0x2d, 0x60,
+    0x66, 0x3e, 0xa6, 0x54, 0x05, 0x4b, 0xcb, 0xca, 0x4b, 0xc8, 0x4a, 0xca, 0x49, 0x49, 0x48, 0x0a,
+    0x92, 0x9e, 0x7e, 0x91, 0x14, 0x22, 0x27, 0xd4, 0xe3, 0x09, 0x8e, 0x8f, 0xad, 0x12, 0x1c, 0x4d,
+    0x48, 0x68, 0x44, 0x33, 0x36, 0x42, 0x31, 0x2e, 0x16, 0x46, 0x58, 0x54, 0x4c, 0x8c, 0xa0, 0x48,
+    0x58, 0x1e, 0x24, 0x3c, 0xef, 0x83, 0x67, 0x32, 0xe0, 0x98, 0xfc, 0x19, 0x28, 0x1e, 0x8b, 0xa7,
+    0xfa, 0x20, 0x84, 0xff, 0xa6, 0xc2, 0x37, 0xb8, 0xcf, 0x2f, 0x07, 0x7b, 0x7e, 0xbd, 0x39, 0xb7,
+    0x94, 0xce, 0x8b, 0xeb, 0x89, 0x3d, 0xc0, 0xf9, 0x1e, 0x38, 0xd8, 0xe3, 0xdb, 0x6b, 0x40, 0xc7,
+    0xa0, 0x81, 0xdd, 0x82, 0x3c, 0x06, 0xdb, 0xb2, 0x05, 0x72, 0x72, 0xff, 0x73, 0x1f, 0xa7, 0x05,
+    0xa7, 0xa0, 0xec, 0x8d, 0x4d, 0x81, 0x0d, 0xb7, 0xb7, 0x36, 0xb7, 0x01, 0x6d, 0x5b, 0x12, 0xac,
+    0xa9, 0xb1, 0x39, 0xad, 0xa9, 0x6d, 0xd3, 0xc8, 0xc6, 0xc4, 0xc8, 0x80, 0xc4, 0xc2, 0xb4, 0xc0,
+    0xc2, 0xbe, 0xb6, 0x5e, 0x60, 0x54, 0x5f, 0x59, 0x54, 0x58, 0x56, 0x59, 0xe8, 0x03, 0x58, 0x64,
+    0x07, 0x1c, 0x81, 0xae, 0xfe, 0xad, 0x92, 0x54, 0x21, 0x19, 0x98, 0x32, 0x50, 0x00, 0x3b, 0x25,
+    0xe5, 0x44, 0x00, 0xeb, 0x14, 0x05, 0xf5, 0xa4, 0xb4, 0xa4, 0xf4, 0xff, 0x03, 0xd4, 0x34, 0x61,
+    0x05, 0x3c, 0xd3, 0x52, 0x19, 0x6c, 0xd2, 0x3f, 0xd0, 0x11, 0x92, 0xd1, 0x51, 0x11, 0x91, 0x51,
+    0x91, 0x9a, 0x1f, 0x1f, 0x00, 0x3c, 0x01, 0xc8, 0x00, 0x48, 0x43, 0x06, 0x4d, 0x9a, 0x01, 0x01,
+    0x8d, 0x5f, 0xa8, 0x44, 0x84, 0x7b, 0xac, 0x99, 0x01, 0x02, 0x10, 0x08, 0xa0, 0x01, 0x93, 0xa9,
+    0x19, 0x86, 0x67, 0x71, 0x98, 0x42, 0x2b, 0x00, 0xc4, 0x2c, 0xa1, 0x61, 0x21, 0x2e, 0x23, 0x28,
+    0x78, 0x05, 0x00, 0x38, 0x10, 0x46, 0xd1, 0x02, 0xc7, 0x01, 0x1b, 0x00, 0x83, 0xfc, 0xbd, 0x0b,
+    0x58, 0x8c, 0x96, 0x6b, 0x53, 0x93, 0x70, 0x56, 0x19, 0x54, 0xaf, 0xb6, 0x16, 0x3b, 0xba, 0x72,
+    0x60, 0xf3, 0xaf, 0x02, 0xe9, 0xd3, 0x9a, 0xf3, 0x81, 0x29, 0x0b, 0x91, 0xf9, 0xa6, 0xc3, 0x7f,
+    0xa2, 0x7a, 0xd6, 0xdc, 0x20, 0x66, 0xe7, 0xea, 0xeb, 0x35, 0x70, 0x6b, 0xfe, 0x5d, 0x34, 0x3b,
+    0xde, 0x61, 0xe3, 0x07, 0xc2, 0xbd, 0x5a, 0x09, 0x3d, 0x58, 0xe6, 0x9d, 0xbc, 0x91, 0x2f, 0x08,
+    0x8a, 0x52, 0xa1, 0x8d, 0x99, 0xc3, 0x8a, 0xbe, 0xba, 0xa4, 0x65, 0xf3, 0x11, 0x7b, 0x82, 0x19,
+    0x8e, 0x38, 0x5e, 0xbd, 0xe5, 0x5a, 0x37, 0xe5, 0x4e, 0x7d, 0xec, 0x35, 0xb6, 0xd7, 0x8f, 0xe0,
+    0x1f, 0xf8, 0x8f, 0xb8, 0x9c, 0x1f, 0xd9, 0x07, 0xe0, 0x84, 0xa7, 0x7d, 0x4c, 0x9f, 0xbf, 0x2a,
+    0xce, 0x9e, 0x0e, 0x9d, 0x95, 0x38, 0x4c, 0xb7, 0xfb, 0xaa, 0xf4, 0x32, 0x87, 0x0e, 0xb5, 0x15,
+    0xb6, 0xb7, 0xb5, 0x7c, 0xbd, 0x42, 0xd2, 0xc5, 0x97, 0x9c, 0x78, 0x4d, 0x0f, 0xc4, 0x0f, 0xa5,
+    0x95, 0xbf, 0xda, 0xb6, 0x70, 0xda, 0x66, 0xf8, 0x2d, 0xbe, 0xe0, 0x3f, 0x23, 0x45, 0x7e, 0x2c,
+    0x52, 0x1d, 0xd9, 0xdb, 0x22, 0xdf, 0x66, 0x34, 0x34, 0xa6, 0x67, 0xae, 0x29, 0x8d, 0xf3, 0x0b,
+    0x3f, 0x80, 0x78, 0x29, 0xe7, 0xc4, 0x59, 0x48, 0x0a, 0xf9, 0xfd, 0xe1, 0x9d, 0x2e, 0xe3, 0xf6,
+    0x71, 0xfa, 0xfd, 0x41, 0x63, 0x36, 0x6c, 0x9c, 0x5e, 0x3e, 0x61, 0xd5, 0xd5, 0xfe, 0xb6, 0x32,
+    0x1f, 0xad, 0x3e, 0xbe, 0x52, 0x37, 0x95, 0xce, 0xf5, 0x60, 0xf4, 0xd7, 0x39, 0x45, 0x34, 0xf2,
+    0x16, 0xe7, 0xe8, 0x76, 0x51, 0x87, 0x87, 0xf2, 0xb3, 0x20, 0x6c, 0x40, 0x36, 0x01, 0x38, 0x78,
+    0x00, 0xf0, 0x8f, 0x52, 0xdd, 0x3d, 0x6d, 0xde, 0x2f, 0xaa, 0x2b, 0xa0, 0x3e, 0xb0, 0xfd, 0x92,
+    0xe8, 0xbb, 0xfe, 0x74, 0x92, 0xbe, 0x12, 0x87, 0x52, 0x1d, 0xa2, 0x06, 0x91, 0x21, 0xe9, 0x76,
+    0xda, 0x8e, 0x92, 0xfa, 0x4d, 0xe8, 0x87, 0x18, 0xdc, 0x47, 0xc7, 0x6a, 0x5a, 0x4a, 0x1a, 0x46,
+    0xed, 0xdc, 0xde, 0xf8, 0xd1, 0x6e, 0x8f, 0xe7, 0xa8, 0x0f, 0x9b, 0x83, 0xc3, 0x09, 0x76, 0xb1,
+    0x8f, 0xbd, 0x0d, 0x85, 0x03, 0x1a, 0xd3, 0x7c, 0x9a, 0x42, 0xda, 0x74, 0xad, 0x4e, 0xfa, 0x8a,
+    0x39, 0x70, 0xcd, 0x39, 0x34, 0x93, 0x66, 0xe5, 0x79, 0x72, 0xb6, 0xbf, 0x9b, 0x8f, 0x1d, 0x3e,
+    0xdb, 0x19, 0x6a, 0xf4, 0xd7, 0x52, 0xff, 0x8a, 0x22, 0x30, 0xad, 0xec, 0xce, 0xab, 0x7e, 0x13,
+    0x73, 0xca, 0x25, 0xd6, 0xbe, 0x76, 0xde, 0xbe, 0x06, 0x40, 0x79, 0x7b, 0x4f, 0x7b, 0xb9, 0xb5,
+    0x0f, 0x8a, 0x3e, 0x7a, 0xc2, 0xbb, 0xa2, 0x8c, 0x64, 0x6f, 0x9e, 0x3f, 0xa3, 0x0d, 0x7c, 0x87,
+    0x5d, 0x28, 0xf7, 0x65, 0xff, 0x65, 0xca, 0xa6, 0xe8, 0xc3, 0xa8, 0xd5, 0x27, 0xff, 0x39, 0xe5,
+    0xf8, 0x93, 0xe5, 0x77, 0x2e, 0xa1, 0x29, 0x14, 0x44, 0x99, 0x77, 0x4f, 0x70, 0x74, 0x4b, 0xca,
+    0xf4, 0x64, 0x68, 0x7b, 0xb1, 0xbd, 0xd5, 0x77, 0x06, 0x3b, 0xbd, 0xdd, 0x20, 0xb6, 0xf4, 0xa5,
+    0xb9, 0x97, 0xfd, 0x56, 0x28, 0xc8, 0xcd, 0xca, 0x8b, 0x90, 0x23, 0xfc, 0x48, 0xec, 0xe0, 0xd4,
+    0x72, 0xa6, 0x63, 0x23, 0xe7, 0xd5, 0xb8, 0xd1, 0x0a, 0xbc, 0xda, 0x02, 0xef, 0xf9, 0xbb, 0xf4,
+    0x32, 0x3e, 0x3e, 0xdf, 0xcf, 0x3f, 0xb4, 0x67, 0xed, 0x02, 0x85, 0xc1, 0xfb, 0x1e, 0xcf, 0xf6,
+    0xe8, 0xcf, 0x3c, 0xa1, 0x97, 0xa0, 0x0a, 0x0b, 0xe1, 0xec, 0xdd, 0xe5, 0x6d, 0x48, 0x7b, 0x18,
+    0xf8, 0xb8, 0xf1, 0xd5, 0x99, 0xee, 0x63, 0xac, 0xcb, 0x4f, 0x3c, 0xda, 0xee, 0x4f, 0x3a, 0xdd,
+    0xec, 0x31, 0xfb, 0x00, 0xcd, 0xc5, 0x6c, 0xc0, 0xe4, 0x56, 0x07, 0x6b, 0xaf, 0x12, 0xdf, 0x9e,
+    0x74, 0xd6, 0xb3, 0x41, 0xe9, 0xa3, 0x71, 0x62, 0x44, 0xb0, 0x86, 0x7e, 0x54, 0xb8, 0x3b, 0x9a,
+    0xe1, 0xd4, 0xf7, 0x8e, 0xb8, 0xb3, 0xa5, 0x07, 0xbd, 0x86, 0x18, 0x7f, 0x93, 0xd9, 0x1c, 0x7b,
+    0xe2, 0x1f, 0x68, 0xd1, 0x73, 0xe0, 0xf0, 0xd1, 0x8d, 0x74, 0xb5, 0x4f, 0x5c, 0x97, 0xe3, 0xc1,
+    0xe4, 0xe5, 0xb3, 0xae, 0x94, 0x5f, 0x84, 0x9d, 0x37, 0x94, 0x97, 0xa2, 0x8f, 0x31, 0xb0, 0x17,
+    0xa3, 0xc9, 0xf7, 0xc6, 0xbf, 0x33, 0x19, 0xec, 0xf9, 0xb6, 0x49, 0x33, 0x8e, 0x1b, 0x80, 0x3e,
+    0xff, 0x78, 0x7a, 0x29, 0xfc, 0xd3, 0xa8, 0xe1, 0x30, 0x9b, 0x59, 0xc9, 0xfd, 0x81, 0xa1, 0xdb,
+    0xb8, 0x1e, 0xe8, 0xc8, 0x42, 0xfb, 0x88, 0x74, 0x8e, 0xf3, 0x2b, 0x77, 0xce, 0x5d, 0xd0, 0x7f,
+    0x23, 0xbd, 0x74, 0xb5, 0x04, 0xb4, 0x09, 0x7e, 0x9e, 0x31, 0x9b, 0xbd, 0xd5, 0xb8, 0x50, 0xf2,
+    0xc2, 0x71, 0xbc, 0x8f, 0x49, 0x3e, 0x2d, 0x72, 0xbc, 0x72, 0xd8, 0xe0, 0x23, 0x43, 0x29, 0xeb,
+    0xd3, 0x8c, 0xf5, 0x57, 0x1b, 0xda, 0x29, 0xfd, 0xec, 0x7d, 0x21, 0x40, 0x67, 0x72, 0x2f, 0x27,
+    0x75, 0x62, 0xab, 0x79, 0x2c, 0x88, 0xd7, 0x8e, 0x2f, 0x69, 0x0a, 0xf8, 0xde, 0xe1, 0x1f, 0xcd,
+    0xb0, 0x3f, 0xfd, 0x67, 0xeb, 0x36, 0x77, 0x92, 0x56, 0xd7, 0xe8, 0x6d, 0x8a, 0x97, 0x9c, 0x93,
+    0x9a, 0x9c, 0xd6, 0x0e, 0x98, 0x3f, 0x6f, 0x51, 0xf5, 0xa6, 0x1a, 0xd3, 0xee, 0x1d, 0xf3, 0x2a,
+    0x23, 0xfb, 0x6a, 0x20, 0x0c, 0x45, 0xdd, 0x71, 0x63, 0x80, 0x37, 0xe6, 0x8a, 0xaa, 0xa3, 0xaf,
+    0x2f, 0x3a, 0x39, 0xaa, 0x5f, 0x33, 0x35, 0x0b, 0xce, 0x98, 0x15, 0x93, 0x33, 0xd7, 0xa6, 0x3f,
+    0x3e, 0x11, 0xf1, 0x04, 0xac, 0x89, 0x71, 0x94, 0x5e, 0x8c, 0x02, 0x1c, 0xb7, 0xd5, 0xc7, 0x06,
+    0x70, 0xf8, 0x29, 0xf8, 0xf4, 0x59, 0xbd, 0x19, 0xe2, 0x22, 0xdb, 0x9e, 0xf1, 0xfb, 0x3c, 0x3a,
+    0x1e, 0x48, 0x7d, 0xca, 0xbf, 0xa0, 0x2c, 0x12, 0xaa, 0x67, 0xa8, 0x1b, 0xe2, 0xbc, 0x77, 0x02,
+    0xfc, 0x6f, 0x75, 0xfa, 0x7c, 0x4e, 0x87, 0xed, 0xef, 0x7c, 0x70, 0x3d, 0xde, 0xa9, 0x2c, 0x4f,
+    0x16, 0xbc, 0xbe, 0x83, 0x73, 0x67, 0xfc, 0xb0, 0xff, 0x83, 0x97, 0xef, 0xd1, 0xc3, 0xa5, 0xe5,
+    0xfd, 0xea, 0x6a, 0xf2, 0x7b, 0xf5, 0x0a, 0xee, 0xbf, 0xf6, 0x70, 0xa4, 0xa1, 0xfb, 0x35, 0xca,
+    0xd7, 0x95, 0x2a, 0x1f, 0x4a, 0x3d, 0x21, 0x5c, 0x2d, 0xd7, 0x5c, 0xd4, 0xd9, 0xbe, 0xb6, 0x7a,
+    0xe9, 0x67, 0xaf, 0xb7, 0x03, 0x93, 0x44, 0x2a, 0x4e, 0xde, 0x1f, 0xfd, 0x19, 0xce, 0x9d, 0xcb,
+    0xc0, 0x47, 0xd0, 0x34, 0xac, 0x6b, 0x34, 0xc3, 0xcc, 0xfb, 0x37, 0x40, 0xe5, 0xb1, 0xdb, 0xd9,
+    0x91, 0xd9, 0x92, 0x91, 0x6c, 0x6c, 0x45, 0x9a, 0x99, 0x4e, 0xdb, 0x62, 0x37, 0xdf, 0x85, 0xa3,
+    0x74, 0x61, 0x45, 0x62, 0xa2, 0xac, 0x6c, 0xd2, 0xf5, 0xf6, 0x6f, 0x84, 0xe7, 0x13, 0x58, 0xfa,
+    0x45, 0x3f, 0x08, 0x3f, 0xf5, 0x16, 0x3f, 0x77, 0xcd, 0x0d, 0xcf, 0x92, 0xc6, 0x65, 0x7a, 0x15,
+    0xa6, 0xad, 0xe7, 0x27, 0x07, 0x30, 0xe6, 0xdd, 0x9d, 0xfc, 0x5e, 0x1b, 0xeb, 0xe0, 0xe1, 0x5e,
+    0x59, 0x4a, 0xe7, 0x2c, 0xc1, 0x30, 0x7a, 0xfc, 0xf1, 0xec, 0x01, 0x1a, 0x88, 0xfb, 0x83, 0x3b,
+    0xeb, 0x1a, 0x8b, 0xd9, 0x94, 0xb5, 0xfa, 0x55, 0xcc, 0x38, 0x38, 0x78, 0xde, 0xfe, 0x42, 0x62,
+    0x7e, 0x49, 0xc7, 0xc5, 0x9d, 0x62, 0x9b, 0xe1, 0x0c, 0x35, 0xc2, 0x44, 0x37, 0x55, 0xf1, 0x57,
+    0xac, 0x3c, 0x6f, 0x77, 0x4e, 0x0b, 0xf9, 0xa9, 0xec, 0x38, 0x3b, 0x25, 0x09, 0x83, 0x65, 0x6c,
+    0x8b, 0xc1, 0x0c, 0x0b, 0x47, 0xbd, 0x3a, 0x96, 0x8d, 0x76, 0x99, 0x14, 0x0a, 0xa3, 0xa6, 0x2f,
+    0x6f, 0xae, 0x42, 0x17, 0x2c, 0x75, 0x8a, 0x3d, 0xf6, 0x12, 0x41, 0x5c, 0xa8, 0xce, 0x85, 0x43,
+    0x71, 0xe2, 0x0f, 0xb9, 0xf7, 0xf6, 0x54, 0x64, 0x7e, 0x34, 0xef, 0xc6, 0xa3, 0xe5, 0x57, 0x36,
+    0x75, 0x2f, 0x1c, 0x37, 0xe6, 0xae, 0xc8, 0x85, 0x7e, 0x38, 0x3c, 0x48, 0x99, 0x0b, 0x6d, 0x5e,
+    0xfb, 0xe3, 0x4d, 0x54, 0x85, 0x13, 0x26, 0x83, 0x09, 0x7f, 0x1f, 0xd7, 0x50, 0xbb, 0xee, 0x62,
+    0xff, 0x5d, 0x82, 0xda, 0x9d, 0x72, 0xf4, 0xf8, 0x8f, 0x17, 0x65, 0x81, 0x39, 0xd5, 0x69, 0x5d,
+    0x74, 0x6e, 0x36, 0xed, 0x19, 0x39, 0x6b, 0x47, 0xbd, 0x48, 0xdc, 0x62, 0x94, 0x83, 0xda, 0x18,
+    0xad, 0x59, 0xe3, 0xaa, 0xcc, 0x49, 0xae, 0xe8, 0xdd, 0xd4, 0x7f, 0xf0, 0x47, 0xd0, 0x2e, 0xf6,
+    0xec, 0x1c, 0xd3, 0x88, 0x9d, 0xea, 0x67, 0xde, 0xb9, 0x5d, 0xf3, 0x8e, 0xec, 0x75, 0x87, 0xb5,
+    0x8b, 0xd0, 0xa2, 0x3f, 0x5e, 0x1d, 0x67, 0xe1, 0xf7, 0x87, 0x08, 0x33, 0x8c, 0xc9, 0x0b, 0x6b,
+    0xf8, 0x79, 0x8a, 0xff, 0xf1, 0x9c, 0x6f, 0xb8, 0x43, 0x8f, 0x72, 0x2a, 0x35, 0x28, 0xed, 0x6f,
+    0x66, 0x81, 0x78, 0xe7, 0xf1, 0x7d, 0x02, 0x0d, 0x63, 0x7a, 0xce, 0xe3, 0x70, 0xf4, 0x9b, 0xa2,
+    0x9e, 0x84, 0x01, 0xe6, 0xf3, 0xd0, 0xb3, 0xb0, 0x20, 0x9c, 0xec, 0x81, 0x96, 0x60, 0x82, 0xbe,
+    0x62, 0xbe, 0xa5, 0x21, 0xbe, 0xd0, 0x7f, 0xbe, 0x4b, 0xcc, 0x28, 0x7e, 0xf7, 0x9e, 0x33, 0x53,
+    0xde, 0x79, 0xec, 0xad, 0xaf, 0xfe, 0x49, 0xf8, 0x5f, 0xf7, 0x71, 0x10, 0xdb, 0x35, 0xf9, 0x58,
+    0x78, 0x97, 0xfa, 0x7d, 0xcb, 0xfa, 0x4d, 0x9e, 0x72, 0x5a, 0x87, 0x57, 0xeb, 0x35, 0xbe, 0x15,
+    0xe0, 0x9c, 0x97, 0xc8, 0x0a, 0xda, 0x39, 0x2e, 0xb6, 0x6e, 0xe3, 0x20, 0x8c, 0x9c, 0xa8, 0x90,
+    0x53, 0x5a, 0xdd, 0xeb, 0x43, 0xb6, 0xcc, 0xc5, 0xeb, 0x02, 0x74, 0x76, 0xd1, 0x19, 0x4c, 0xf7,
+    0x92, 0xc4, 0xfb, 0x6d, 0xbb, 0xcd, 0x20, 0x7b, 0x57, 0x58, 0x2c, 0xad, 0x3d, 0xd6, 0x68, 0x12,
+    0xf9, 0x59, 0x03, 0x84, 0xa5, 0x9c, 0xdc, 0xd4, 0xe6, 0x48, 0xc1, 0x64, 0xd7, 0x19, 0x86, 0xc4,
+    0x2b, 0x5a, 0x7f, 0x57, 0x8b, 0x59, 0x29, 0xc5, 0xd4, 0xe4, 0x3a, 0xf1, 0x79, 0x11, 0x28, 0xd8,
+    0x89, 0x49, 0x59, 0x37, 0xe6, 0xd7, 0x87, 0x71, 0x50, 0x91, 0x46, 0xad, 0x3d, 0xd9, 0x13, 0x1f,
+    0xde, 0x79, 0x02, 0x36, 0x7f, 0x1e, 0xdb, 0xd8, 0x80, 0xbe, 0x53, 0x95, 0x75, 0x5a, 0xbd, 0x5f,
+    0x9b, 0xeb, 0xd7, 0x21, 0x3a, 0x0b, 0x53, 0x80, 0x18, 0x47, 0x16, 0x11, 0x29, 0xcf, 0xd5, 0x9a,
+    0x37, 0x1f, 0xcd, 0xc3, 0x56, 0x7b, 0xd2, 0x38, 0xae, 0xe2, 0x6b, 0x6b, 0xab, 0xac, 0x5b, 0x87,
+    0x8e, 0xe7, 0x17, 0x54, 0x49, 0x5b, 0x49, 0xff, 0x86, 0x8b, 0xe6, 0x56, 0x62, 0x75, 0x32, 0xc1,
+    0xb6, 0xc6, 0xf2, 0xf0, 0x8f, 0x81, 0xda, 0x62, 0x2f, 0x7c, 0x90, 0x62, 0x13, 0xd9, 0x0d, 0x5e,
+    0xd1, 0xff, 0x98, 0x15, 0xf9, 0x1d, 0x55, 0xc8, 0x47, 0xd0, 0x7f, 0x73, 0x6e, 0xf6, 0xb9, 0x67,
+    0x3f, 0xf1, 0x70, 0xce, 0x5c, 0x04, 0xee, 0x10, 0xb3, 0xe6, 0x6e, 0x6a, 0xe1, 0x6d, 0x0a, 0x3e,
+    0xbc, 0x7f, 0x3b, 0x49, 0xce, 0xae, 0xbf, 0x3b, 0x95, 0xf2, 0x51, 0xba, 0x3e, 0x4e, 0xee, 0x28,
+    0xfd, 0xca, 0xc4, 0x85, 0xb5, 0x43, 0xaa, 0xe5, 0xab, 0x69, 0x87, 0xf2, 0xdf, 0x8d, 0xc9, 0xc2,
+    0x50, 0xa4, 0xc5, 0x80, 0xdc, 0x86, 0xf3, 0xee, 0xe3, 0xbe, 0x9f, 0xe8, 0x17, 0xce, 0x18, 0xee,
+    0x66, 0xb6, 0x59, 0xe3, 0xcb, 0x55, 0x9e, 0x20, 0x7c, 0x5d, 0x76, 0xb2, 0xdd, 0x7e, 0x4d, 0x6d,
+    0xd0, 0x28, 0x08, 0xd0, 0x21, 0x4f, 0xfc, 0x56, 0xbe, 0xc4, 0x77, 0x6e, 0x60, 0x39, 0xcb, 0xbe,
+    0xc1, 0x11, 0xe7, 0xe8, 0x28, 0x81, 0x9b, 0x1c, 0x3a, 0x36, 0xdd, 0xc4, 0x70, 0x18, 0x8b, 0xc2,
+    0xfc, 0xda, 0x09, 0x97, 0x87, 0x2d, 0xae, 0xe0, 0x03, 0x4b, 0x57, 0xfc, 0x7a, 0x9f, 0x0d, 0xfe,
+    0x27, 0xff, 0x02, 0x8f, 0xb0, 0xcb, 0xd6, 0x4e, 0x07, 0xfa, 0x03, 0x49, 0x88, 0xf4, 0x1d, 0x9e,
+    0xd8, 0x83, 0xd2, 0x97, 0xa3, 0xb5, 0xa3, 0x1f, 0x1e, 0xff, 0xb6, 0xe8, 0x9a, 0x7f, 0xb3, 0xef,
+    0xb7, 0x85, 0x51, 0xc5, 0xd7, 0x88, 0x08, 0x31, 0xa1, 0xf0, 0xad, 0xe8, 0x15, 0xeb, 0x65, 0x8e,
+    0x5b, 0x66, 0x98, 0x95, 0xdd, 0x30, 0xbe, 0x3f, 0x90, 0xfe, 0x72, 0xbe, 0xdb, 0x45, 0xd4, 0xa9,
+    0x1d, 0xc2, 0x5c, 0xe3, 0x39, 0x5f, 0xf0, 0x72, 0x57, 0xde, 0xa8, 0x40, 0xbd, 0x31, 0x5e, 0x82,
+    0xb3, 0x22, 0xac, 0xb1, 0xc3, 0x56, 0xea, 0x3d, 0x80, 0xc9, 0x55, 0x9e, 0xe8, 0x53, 0x43, 0x81,
+    0x1d, 0x9d, 0x6c, 0x83, 0xbf, 0x0b, 0x4c, 0x4a, 0xff, 0x9f, 0x66, 0xcb, 0x91, 0xe5, 0x7c, 0x16,
+    0xf6, 0x00, 0x05, 0x44, 0xf3, 0x81, 0x60, 0xde, 0x94, 0x0d, 0x60, 0x2a, 0xad, 0xf9, 0x5f, 0x72,
+    0xbf, 0x14, 0x1f, 0xaa, 0xa5, 0xe5, 0xa1, 0xd1, 0xf9, 0x76, 0x26, 0xf1, 0x33, 0x07, 0x38, 0x98,
+    0xf2, 0x12, 0xa3, 0x32, 0x6f, 0xf8, 0xbf, 0xf3, 0x65, 0x4e, 0xbc, 0xb1, 0xfb, 0x68, 0x82, 0xfe,
+    0x47, 0xd8, 0x9b, 0x4f, 0x46, 0xba, 0x12, 0xff, 0x07, 0x71, 0x04, 0x61, 0xb6, 0x24, 0x76, 0x5e,
+    0x84, 0xf0, 0x39, 0x50, 0xdf, 0x32, 0x8d, 0x7c, 0xc1, 0x5d, 0x8e, 0x2f, 0x86, 0xdc, 0xae, 0xc5,
+    0x91, 0x5c, 0x2a, 0x93, 0x59, 0xfb, 0xff, 0x21, 0x8b, 0xef, 0xa3, 0x9f, 0xdb, 0x03, 0x32, 0x70,
+    0xb7, 0xf9, 0x3e, 0xf3, 0x9d, 0x63, 0xd2, 0x2d, 0x5d, 0xf5, 0xa7, 0x4b, 0xfe, 0xc5, 0x7b, 0x7a,
+    0xa5, 0x44, 0xdf, 0x7a, 0x91, 0x9f, 0xaf, 0x1f, 0xd9, 0x11, 0x38, 0xd7, 0xf8, 0xdc, 0xc6, 0x59,
+    0xd9, 0x63, 0xef, 0x76, 0xbe, 0xff, 0x6c, 0x52, 0xf0, 0xe2, 0xd7, 0xfc, 0x19, 0x7f, 0xd4, 0xde,
+    0xd6, 0xcc, 0x3f, 0x6f, 0xd2, 0x21, 0xac, 0xae, 0xd7, 0x9e, 0xee, 0xde, 0xac, 0x5b, 0xa2, 0x05,
+    0x07, 0x7e, 0xf8, 0x0e, 0x04, 0x33, 0xb0, 0x8e, 0xe5, 0xc0, 0xd3, 0x5c, 0xb8, 0x81, 0xde, 0x05,
+    0x77, 0x70, 0x5f, 0xf3, 0x15, 0x5c, 0xd5, 0x3d, 0x97, 0xa3, 0x8f, 0x73, 0x03, 0x44, 0x3e, 0x85,
+    0x23, 0x5f, 0xcb, 0xd6, 0xc5, 0x05, 0xf6, 0x54, 0x91, 0x67, 0x86, 0xbf, 0x76, 0x53, 0xd6, 0xa7,
+    0xf1, 0x53, 0x50, 0x28, 0xee, 0x5e, 0x90, 0x94, 0x03, 0x1d, 0xe9, 0x1e, 0xe2, 0x31, 0xf7, 0x67,
+    0x96, 0xed, 0x03, 0x15, 0xb5, 0x36, 0xf6, 0x45, 0xfa, 0x61, 0xaa, 0x63, 0x85, 0x40, 0x0f, 0xe6,
+    0x81, 0x3f, 0xa7, 0x90, 0x6e, 0xde, 0x64, 0x77, 0xdf, 0xce, 0x72, 0x69, 0xf1, 0xed, 0xbc, 0xa9,
+    0xd8, 0xd9, 0x96, 0x41, 0xa4, 0x81, 0x35, 0x2e, 0xf9, 0xf8, 0x81, 0x6e, 0x6f, 0x4c, 0x2c, 0x7d,
+    0xf9, 0x56, 0x65, 0xc3, 0x5b, 0xda, 0xce, 0x2d, 0x4e, 0x9f, 0xeb, 0x69, 0xe4, 0x8e, 0xad, 0x6b,
+    0xe2, 0xcd, 0xcb, 0xa6, 0xf4, 0xb0, 0x1d, 0xe5, 0xc6, 0x40, 0x63, 0x7a, 0x37, 0xd8, 0x85, 0x15,
+    0x03, 0x1f, 0xee, 0x26, 0xd6, 0xcd, 0xe2, 0x1f, 0xe4, 0x3e, 0x86, 0xe9, 0x9a, 0xf1, 0xe9, 0x6a,
+    0xcb, 0x65, 0x3c, 0xb9, 0x69, 0x9b, 0x2e, 0x75, 0x8c, 0x25, 0xa6, 0x0f, 0xe9, 0x58, 0x1d, 0x21,
+    0x38, 0xa7, 0xfe, 0x88, 0x78, 0x90, 0xfa, 0xf8, 0xdf, 0x84, 0xf5, 0xef, 0xf5, 0xe6, 0x4e, 0x30,
+    0xa4, 0x83, 0xe1, 0x2d, 0xe5, 0x05, 0x9a, 0xf2, 0xfe, 0x6b, 0xd6, 0x32, 0xdc, 0x7c, 0xe6, 0x64,
+    0x83, 0x91, 0x89, 0xed, 0x84, 0x19, 0xdb, 0x8f, 0x83, 0x0a, 0xc4, 0xfa, 0x5c, 0xfc, 0x29, 0xbf,
+    0xad, 0x9e, 0xff, 0x14, 0xd4, 0xf4, 0xbd, 0xab, 0x36, 0x90, 0xdd, 0xe1, 0xa4, 0xe7, 0xd3, 0xf6,
+    0xbe, 0xb6, 0x82, 0x3e, 0x75, 0xa6, 0x5b, 0xea, 0x35, 0xb6, 0x14, 0xcf, 0x1b, 0xfb, 0x64, 0x3a,
+    0xf4, 0xfb, 0x87, 0xb5, 0x16, 0x40, 0xfb, 0x61, 0x9d, 0xa4, 0x91, 0xe7, 0x22, 0xc5, 0xb9, 0xd6,
+    0x5c, 0x3d, 0x45, 0x1b, 0xfe, 0x3a, 0x1f, 0x71, 0x2b, 0x96, 0xc6, 0xbc, 0x59, 0x76, 0xf5, 0x06,
+    0xa5, 0x27, 0x9c, 0x9a, 0x5d, 0xfb, 0x3e, 0x61, 0x96, 0x59, 0x66, 0xe9, 0x9e, 0x94, 0x8a, 0xe8,
+    0x96, 0x61, 0xf3, 0x70, 0x4d, 0x62, 0xcc, 0x66, 0xf9, 0xfa, 0xb3, 0x7b, 0x4e, 0xe6, 0xb7, 0xa1,
+    0x6c, 0xec, 0xb8, 0x9d, 0x56, 0x77, 0xb1, 0xf5, 0x90, 0xab, 0xbe, 0x98, 0xfc, 0xf2, 0xe2, 0xf6,
+    0x3e, 0x33, 0x81, 0xba, 0xf9, 0x5c, 0x3c, 0xd7, 0x77, 0x66, 0xae, 0x7d, 0x96, 0x6d, 0xc0, 0x6c,
+    0xd0, 0x6f, 0xda, 0xe6, 0xf4, 0x64, 0x1d, 0x96, 0xc1, 0x1c, 0x5a, 0x07, 0xc8, 0x2e, 0xea, 0xc8,
+    0x97, 0x62, 0xf9, 0xc6, 0x45, 0xac, 0xc5, 0xb8, 0x4a, 0xf2, 0x71, 0xad, 0xdc, 0x26, 0x56, 0xd8,
+    0x9c, 0x9c, 0x6e, 0xf0, 0x69, 0xf6, 0xfd, 0x06, 0xb6, 0x26, 0xcf, 0x67, 0xf3, 0x5b, 0x33, 0x42,
+    0x0f, 0x30, 0xe6, 0x31, 0xdd, 0xfd, 0x50, 0xa7, 0xf6, 0x5d, 0xda, 0x6e, 0xc6, 0x2e, 0x79, 0xae,
+    0xd1, 0x29, 0x9c, 0x1d, 0x4e, 0x43, 0x63, 0x63, 0x72, 0x7b, 0x76, 0x62, 0x38, 0xc7, 0xbe, 0x43,
+    0x66, 0xe7, 0xdc, 0x97, 0x73, 0xca, 0xf4, 0x1d, 0xcd, 0x93, 0x9c, 0x29, 0x74, 0xe9, 0x5a, 0x7d,
+    0x3e, 0x44, 0x4a, 0x63, 0x9e, 0x41, 0xc5, 0xdf, 0x7f, 0x35, 0xf8, 0xe1, 0xed, 0xfb, 0xc3, 0x3a,
+    0xcd, 0x87, 0x49, 0x94, 0x9a, 0x44, 0x2a, 0x36, 0xfa, 0x17, 0x68, 0xd6, 0x17, 0xca, 0x3e, 0xec,
+    0x4f, 0x83, 0x3b, 0x32, 0x74, 0x2a, 0xb8, 0xbb, 0x44, 0x77, 0xd4, 0x24, 0x81, 0x7c, 0xf5, 0x69,
+    0xd0, 0xfe, 0xfc, 0x6e, 0xd9, 0x5b, 0x74, 0x9a, 0xc8, 0xf7, 0x41, 0xff, 0x13, 0x15, 0x99, 0x39,
+    0x8e, 0xdd, 0x7f, 0x4f, 0x39, 0x6e, 0x9e, 0xb1, 0xbe, 0xb5, 0xd7, 0xdb, 0xdb, 0x9f, 0x3c, 0x71,
+    0x2d, 0xda, 0x26, 0xb6, 0xf0, 0x98, 0x25, 0x08, 0x8e, 0x64, 0xd3, 0x04, 0x7e, 0x16, 0xe5, 0xe4,
+    0x14, 0xbb, 0x2c, 0xc2, 0x71, 0x82, 0x08, 0x39, 0xee, 0x92, 0x0f, 0x88, 0xb1, 0x70, 0x9c, 0x99,
+    0x39, 0xe6, 0x25, 0x8a, 0xfa, 0x30, 0xaa, 0xe1, 0x97, 0x5a, 0xed, 0x57, 0x29, 0xcd, 0xee, 0x9a,
+    0xb8, 0xe1, 0x70, 0x78, 0xd1, 0xea, 0x7f, 0x9e, 0xca, 0x98, 0xf1, 0x6d, 0x1e, 0x35, 0xdb, 0x3b,
+    0xa9, 0x74, 0x3d, 0x2d, 0x09, 0x68, 0xc1, 0xe8, 0x1d, 0x12, 0x84, 0xbc, 0xcb, 0x3a, 0xce, 0xd9,
+    0xbc, 0x28, 0x53, 0x6c, 0x90, 0x4d, 0x82, 0xeb, 0xf7, 0x74, 0xdd, 0x54, 0xd1, 0x97, 0x3f, 0x02,
+    0xab, 0xf0, 0xce, 0x9c, 0x9a, 0xf8, 0xa2, 0x9e, 0x1c, 0x6a, 0x9f, 0xa8, 0x17, 0x8f, 0x0c, 0x3d,
+    0x16, 0x86, 0xb7, 0xbf, 0xf1, 0x72, 0xa1, 0x07, 0x69, 0x19, 0x2c, 0x74, 0x3a, 0xcf, 0x66, 0x64,
+    0xc8, 0xf7, 0x48, 0xf7, 0x4f, 0x1e, 0x6b, 0xcc, 0x33, 0xd5, 0xa1, 0x66, 0x4c, 0x24, 0x7a, 0x0b,
+    0x02, 0x6b, 0x4f, 0x69, 0xe1, 0x87, 0x5a, 0xf9, 0xec, 0x28, 0x3d, 0xfb, 0xfd, 0x16, 0xf9, 0x33,
+    0x20, 0x0e, 0x45, 0x8f, 0xc5, 0x3d, 0xb8, 0x74, 0x8c, 0xfe, 0xbb, 0x71, 0x00, 0x82, 0x2b, 0x5d,
+    0x19, 0x0f, 0x7d, 0xd7, 0xae, 0xec, 0xaf, 0x04, 0xd4, 0x95, 0xea, 0x66, 0x61, 0x66, 0x79, 0x9d,
+    0x86, 0xe9, 0xdc, 0xd9, 0xa1, 0x20, 0xfc, 0xbf, 0x88, 0xa7, 0x5e, 0xd9, 0x5f, 0x1f, 0xb2, 0x62,
+    0xd4, 0x1a, 0x5e, 0x1e, 0x4a, 0x25, 0x08, 0x4b, 0xd9, 0xa9, 0xfe, 0x7f, 0xbd, 0x5c, 0x62, 0x7b,
+    0xd0, 0xf0, 0xc7, 0x86, 0x2c, 0xb2, 0x4c, 0xf2, 0x40, 0xfd, 0xd5, 0x6f, 0x71, 0x2d, 0xf9, 0x55,
+    0xf5, 0x11, 0x1a, 0x39, 0xdc, 0xfc, 0x87, 0x64, 0xfe, 0x15, 0x07, 0xde, 0xdc, 0x10, 0xdb, 0x9a,
+    0x1f, 0x25, 0xfe, 0x01, 0xb7, 0x09, 0x2a, 0x2e, 0xcf, 0x69, 0xbb, 0x02, 0x39, 0x5d, 0xec, 0xa8,
+    0xf2, 0x77, 0xac, 0x1a, 0x8d, 0x19, 0xf5, 0x92, 0xe7, 0xc1, 0xa9, 0x3b, 0x9f, 0xc2, 0xdc, 0xf3,
+    0x64, 0x96, 0xf2, 0x85, 0x57, 0x4e, 0x81, 0xfe, 0xe1, 0x80, 0xcd, 0x3d, 0xbe, 0x20, 0x1f, 0x30,
+    0x08, 0x72, 0x3b, 0xda, 0xa7, 0x8c, 0x7c, 0xf3, 0xab, 0x7c, 0x80, 0xc5, 0x3e, 0x28, 0xb9, 0x5f,
+    0x7e, 0x97, 0x81, 0xa7, 0x96, 0xc2, 0x10, 0x02, 0xd8, 0xd9, 0x25, 0xf1, 0x91, 0x0c, 0xbd, 0x64,
+    0xff, 0xc3, 0xb4, 0x3f, 0x58, 0x19, 0xcb, 0xf2, 0xc9, 0x11, 0x00, 0x74, 0xe8, 0x33, 0x4e, 0xdd,
+    0x4d, 0x64, 0x97, 0x5f, 0x16, 0x1c, 0x2c, 0x48, 0x96, 0xfc, 0x1f, 0x7a, 0x4c, 0xfe, 0xd8, 0x1a,
+    0x5f, 0xdb, 0x68, 0xfe, 0xda, 0xa8, 0xd5, 0x21, 0x74, 0x87, 0x4a, 0x1b, 0xea, 0xc1, 0x2a, 0xa4,
+    0xd2, 0xbe, 0xac, 0x2f, 0x77, 0xce, 0x43, 0xa1, 0x19, 0x6d, 0x86, 0x93, 0xbe, 0xdc, 0x1d, 0x8f,
+    0x90, 0x35, 0xca, 0xfa, 0x12, 0x7c, 0x18, 0xea, 0x55, 0xc7, 0x02, 0x7f, 0x17, 0x3e, 0xd2, 0x1c,
+    0x27, 0x75, 0xf9, 0x0a, 0x32, 0x8b, 0x9d, 0x4b, 0x75, 0xab, 0x31, 0xea, 0xf3, 0x51, 0xfd, 0xe5,
+    0x56, 0x75, 0x89, 0x83, 0xf6, 0xb7, 0xff, 0xd0, 0x3a, 0x88, 0x3e, 0xe6, 0x00, 0x48, 0xb4, 0x17,
+    0x11, 0x0a, 0x8c, 0xfc, 0xb7, 0x02, 0x2f, 0x99, 0x1e, 0x8f, 0x10, 0xef, 0x66, 0x35, 0x35, 0x36,
+    0x01, 0x8c, 0x98, 0x7d, 0xbc, 0x7e, 0x38, 0xfc, 0xa4, 0x92, 0xfb, 0xa3, 0x71, 0xfb, 0x86, 0xeb,
+    0xc7, 0xdc, 0x54, 0x46, 0xb5, 0xee, 0x66, 0xce, 0x43, 0xd7, 0x9e, 0x34, 0xbd, 0xa4, 0xe5, 0x53,
+    0x49, 0xaf, 0xc1, 0x28, 0x5c, 0x27, 0xe9, 0xf0, 0xff, 0xac, 0x2e, 0x2f, 0x30, 0x59, 0x76, 0xbd,
+    0x73, 0x63, 0x7f, 0x37, 0x52, 0xf6, 0xa1, 0x29, 0x93, 0x99, 0x8f, 0x09, 0x1d, 0xcd, 0x1a, 0x76,
+    0x95, 0x6e, 0x5c, 0x64, 0x59, 0xaa, 0x2b, 0xb6, 0xf9, 0xe3, 0x22, 0x01, 0xff, 0xdc, 0x70, 0xbf,
+    0xa4, 0xe3, 0xdb, 0xc0, 0xc6, 0xbc, 0x1d, 0xd1, 0xe6, 0xbf, 0xb4, 0x0f, 0xe3, 0xe7, 0x42, 0x47,
+    0x0d, 0x87, 0x0a, 0xb4, 0xd1, 0x77, 0x02, 0x3c, 0xb8, 0x74, 0xa9, 0x98, 0x50, 0x6b, 0x42, 0x5e,
+    0x9f, 0xe9, 0x4b, 0xe9, 0x8e, 0x88, 0x60, 0x8f, 0x98, 0x8f, 0xe9, 0xef, 0xbe, 0x2f, 0x35, 0xa9,
+    0xdd, 0x3a, 0x5e, 0xb8, 0x4d, 0x84, 0x19, 0xf4, 0x7d, 0x75, 0x1b, 0x11, 0x86, 0x77, 0xbf, 0x51,
+    0xe1, 0x21, 0x4c, 0xdb, 0x5f, 0xb7, 0x5a, 0x18, 0x14, 0xe7, 0x0c, 0x68, 0x66, 0x56, 0x23, 0x95,
+    0x95, 0xe0, 0x60, 0x5e, 0xb9, 0x63, 0xc3, 0xd3, 0x82, 0x5c, 0x1f, 0xe9, 0x62, 0x66, 0x67, 0x89,
+    0xc6, 0x18, 0x18, 0xfd, 0x61, 0xd4, 0x7a, 0xa5, 0x76, 0xc6, 0x47, 0x97, 0x1c, 0xe6, 0xb3, 0x7c,
+    0x08, 0xc9, 0x93, 0x16, 0xa9, 0x3e, 0xff, 0xfd, 0xc3, 0x92, 0x7b, 0xa8, 0xfb, 0x0e, 0xe4, 0x1f,
+    0x2d, 0xe4, 0x6d, 0xdb, 0x31, 0xf8, 0x19, 0xd9, 0xb2, 0x87, 0xe2, 0x78, 0xe8, 0x79, 0x59, 0x15,
+    0x9a, 0xee, 0x46, 0x4f, 0xed, 0x91, 0x9d, 0xd0, 0x35, 0x2a, 0x92, 0x10, 0x98, 0x64, 0x4a, 0x87,
+    0xd2, 0x03, 0xd7, 0x98, 0x68, 0xed, 0xdf, 0x23, 0x44, 0x3a, 0x42, 0x1b, 0x35, 0xa0, 0xca, 0x51,
+    0x29, 0x87, 0x54, 0xe2, 0xb5, 0x98, 0xfe, 0xd8, 0xdd, 0x60, 0xb7, 0xca, 0x4f, 0x2f, 0xa6, 0x6f,
+    0xbc, 0x3b, 0x64, 0x15, 0xe5, 0x03, 0xec, 0xe8, 0x90, 0xb3, 0x9a, 0x47, 0x4d, 0xec, 0xcc, 0x57,
+    0xf6, 0x92, 0xc8, 0xe3, 0x9f, 0x82, 0x12, 0x26, 0xee, 0x49, 0xcd, 0xec, 0xce, 0x5e, 0x27, 0x9e,
+    0x66, 0x8c, 0xc1, 0xc9, 0x76, 0x1e, 0xb1, 0x86, 0xad, 0x7c, 0x41, 0x41, 0x8e, 0x1f, 0xae, 0x33,
+    0x71, 0x8c, 0x8e, 0x33, 0x04, 0x00, 0x35, 0x47, 0x46, 0xcc, 0x8d, 0x19, 0xbe, 0x68, 0x68, 0xc7,
+    0x69, 0x49, 0x95, 0xbe, 0x5a, 0x01, 0x03, 0x05, 0xb6, 0x3e, 0x68, 0x95, 0x3f, 0x07, 0xf4, 0x8d,
+    0x70, 0xc4, 0x38, 0x03, 0x96, 0x66, 0x73, 0xbe, 0x9b, 0x3c, 0x8e, 0x32, 0xb8, 0xe2, 0x68, 0x93,
+    0x1a, 0x5e, 0xfc, 0x90, 0x06, 0x64, 0x03, 0x93, 0xfd, 0xfe, 0xc8, 0xdf, 0x82, 0xf4, 0x6c, 0x89,
+    0xa6, 0x23, 0x9f, 0xef, 0x5c, 0xe3, 0xbe, 0xb8, 0x55, 0xca, 0x60, 0x9d, 0x5d, 0x47, 0x7b, 0xdb,
+    0x1e, 0x77, 0x70, 0x71, 0x1f, 0x91, 0x42, 0x39, 0x71, 0xce, 0x4b, 0x1c, 0x5d, 0x44, 0x50, 0x4d,
+    0xe4, 0x19, 0x82, 0x01, 0xf6, 0x75, 0xdd, 0x7c, 0x57, 0x0c, 0x7c, 0xc3, 0x51, 0x7e, 0xfe, 0x52,
+    0x95, 0xe3, 0x43, 0x8f, 0x16, 0x79, 0xd6, 0x79, 0x70, 0xf2, 0x30, 0x36, 0xca, 0x39, 0x64, 0xd9,
+    0x3f, 0x27, 0x1c, 0x1f, 0x8e, 0x8b, 0x99, 0x14, 0xce, 0x13, 0x82, 0x7b, 0xbe, 0xc4, 0xa3, 0x03,
+    0x79, 0x59, 0x99, 0x8a, 0x92, 0x27, 0x12, 0x6d, 0x5f, 0x7a, 0x79, 0x53, 0xcb, 0x3f, 0x3f, 0x78,
+    0xd5, 0x58, 0x1d, 0x83, 0xa5, 0x7d, 0x0b, 0xc2, 0xf6, 0x07, 0x1b, 0x60, 0x53, 0x86, 0xc1, 0xa9,
+    0x03, 0xe9, 0x8b, 0xd3, 0x93, 0x7e, 0xdb, 0x59, 0xcc, 0xd3, 0x10, 0x67, 0x91, 0xc4, 0x49, 0x02,
+    0x16, 0x2c, 0x62, 0x3e, 0xb5, 0xce, 0xdf, 0x99, 0x0a, 0x1d, 0x0e, 0xbe, 0xd9, 0x87, 0x85, 0x09,
+    0x53, 0xe3, 0xee, 0xb8, 0xfc, 0x32, 0x0e, 0x16, 0x07, 0x6e, 0xdc, 0xcb, 0xf6, 0x9c, 0xf9, 0xdf,
+    0xf5, 0x5d, 0x7f,
 };
+const ShaderModule Blob041 = { Blob041_Data, 6947u, 6687u, 41u };
 
-extern const uint32_t Blob042[6687];
-const uint32_t Blob042[6687] = {
-    0x07230203, 0x00010300, 0x0008000b, 0x000003e4, 0x00000000, 0x00020011, 0x00000001, 0x0006000b,
-    0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001,
-    0x0008000f, 0x00000005, 0x00000004, 0x6e69616d, 0x00000000, 0x000000d9, 0x0000029b, 0x000002b3,
-    0x00060010, 0x00000004, 0x00000011, 0x00000010, 0x00000010, 0x00000001, 0x00030003, 0x00000002,
-    0x000001c2, 0x000a0004, 0x475f4c47, 0x4c474f4f, 0x70635f45, 0x74735f70, 0x5f656c79, 0x656e696c,
-    0x7269645f, 0x69746365, 0x00006576, 0x00080004, 0x475f4c47, 0x4c474f4f, 0x6e695f45, 0x64756c63,
-    0x69645f65, 0x74636572, 0x00657669, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000, 0x000a0005,
-    0x00000010, 0x74706544, 0x73655468, 0x73615074, 0x28736573, 0x623b3162, 0x31753b31, 0x3b31753b,
-    0x003b3175, 0x00060005, 0x0000000b, 0x61757165, 0x7065446c, 0x65546874, 0x00007473, 0x00050005,
-    0x0000000c, 0x69636166, 0x6956676e, 0x00007765, 0x00050005, 0x0000000d, 0x44747364, 0x68747065,
-    0x00000000, 0x00050005, 0x0000000e, 0x656c6974, 0x74706544, 0x00000068, 0x00040005, 0x0000000f,
-    0x41747364, 0x00727474, 0x000d0005, 0x0000001c, 0x746f6c50, 0x6e617254, 0x63756c73, 0x28746e65,
-    0x753b3175, 0x31753b31, 0x3b31623b, 0x753b3175, 0x31753b31, 0x3b31753b, 0x003b3162, 0x00040005,
-    0x00000013, 0x6f6c6f63, 0x00000072, 0x00040005, 0x00000014, 0x74706564, 0x00000068, 0x00040005,
-    0x00000015, 0x72747461, 0x00000000, 0x00050005, 0x00000016, 0x68537369, 0x776f6461, 0x00000000,
-    0x00050005, 0x00000017, 0x656c6974, 0x6f6c6f43, 0x00000072, 0x00040005, 0x00000018, 0x41637273,
-    0x00000000, 0x00050005, 0x00000019, 0x656c6974, 0x74706544, 0x00000068, 0x00040005, 0x0000001a,
-    0x41637273, 0x00727474, 0x00050005, 0x0000001b, 0x74697277, 0x70654465, 0x00006874, 0x00100005,
-    0x0000002d, 0x636f7250, 0x43737365, 0x7372616f, 0x73614d65, 0x3169286b, 0x3b31753b, 0x763b3175,
-    0x763b3275, 0x763b3275, 0x763b3275, 0x623b3275, 0x31753b31, 0x3b31623b, 0x00000000, 0x00050005,
-    0x00000023, 0x656e696c, 0x69547261, 0x0000656c, 0x00050005, 0x00000024, 0x72616f63, 0x614d6573,
-    0x00006b73, 0x00060005, 0x00000025, 0x72616f63, 0x664f6573, 0x74657366, 0x00000000, 0x00040005,
-    0x00000026, 0x6f6c6f63, 0x00000072, 0x00040005, 0x00000027, 0x74706564, 0x00000068, 0x00040005,
-    0x00000028, 0x72747461, 0x00000000, 0x00040005, 0x00000029, 0x6e6e6977, 0x00007265, 0x00060005,
-    0x0000002a, 0x63617274, 0x766f436b, 0x67617265, 0x00000065, 0x00040005, 0x0000002b, 0x6e657473,
-    0x006c6963, 0x00070005, 0x0000002c, 0x76657270, 0x68537349, 0x776f6461, 0x6b73614d, 0x00000000,
-    0x00050005, 0x00000050, 0x6e656c62, 0x74744164, 0x00000072, 0x00040005, 0x0000008b, 0x52637273,
-    0x00000042, 0x00040005, 0x0000008f, 0x47637273, 0x00000000, 0x00040005, 0x00000093, 0x52747364,
-    0x00000042, 0x00040005, 0x00000096, 0x47747364, 0x00000000, 0x00040005, 0x00000099, 0x41747364,
-    0x00000000, 0x00040005, 0x0000009d, 0x68706c61, 0x00000061, 0x00050005, 0x000000ac, 0x6174654d,
-    0x66696e55, 0x006d726f, 0x00060006, 0x000000ac, 0x00000000, 0x506d754e, 0x67796c6f, 0x00736e6f,
-    0x00060006, 0x000000ac, 0x00000001, 0x566d754e, 0x61697261, 0x0073746e, 0x00060006, 0x000000ac,
-    0x00000002, 0x68706c41, 0x66655261, 0x00000000, 0x00050006, 0x000000ac, 0x00000003, 0x70736944,
-    0x00746e43, 0x00060006, 0x000000ac, 0x00000004, 0x6e6f6f54, 0x6c626154, 0x00000065, 0x00060006,
-    0x000000ac, 0x00000005, 0x61656c43, 0x6c6f4372, 0x0000726f, 0x00060006, 0x000000ac, 0x00000006,
-    0x61656c43, 0x70654472, 0x00006874, 0x00060006, 0x000000ac, 0x00000007, 0x61656c43, 0x74744172,
-    0x00000072, 0x00060006, 0x000000ac, 0x00000008, 0x4f676f46, 0x65736666, 0x00000074, 0x00060006,
-    0x000000ac, 0x00000009, 0x53676f46, 0x74666968, 0x00000000, 0x00060006, 0x000000ac, 0x0000000a,
-    0x43676f46, 0x726f6c6f, 0x00000000, 0x00080006, 0x000000ac, 0x0000000b, 0x61656c43, 0x74694272,
-    0x4f70616d, 0x65736666, 0x00000074, 0x00030005, 0x000000ae, 0x00000000, 0x00060005, 0x000000d6,
-    0x656c6974, 0x656e6e49, 0x66664f72, 0x00746573, 0x00080005, 0x000000d9, 0x4c5f6c67, 0x6c61636f,
-    0x6f766e49, 0x69746163, 0x44496e6f, 0x00000000, 0x00050005, 0x000000eb, 0x72616f63, 0x69426573,
-    0x00000074, 0x00050005, 0x000000f4, 0x656c6974, 0x7366664f, 0x00007465, 0x00050005, 0x000000fd,
-    0x656e6966, 0x6b73614d, 0x00000000, 0x00060005, 0x00000103, 0x526e6942, 0x6c757365, 0x66754274,
-    0x00726566, 0x00080006, 0x00000103, 0x00000000, 0x69726156, 0x57746e61, 0x436b726f, 0x746e756f,
-    0x00000000, 0x00080006, 0x00000103, 0x00000001, 0x74726f53, 0x6f576465, 0x664f6b72, 0x74657366,
-    0x00000000, 0x00090006, 0x00000103, 0x00000002, 0x69726156, 0x57746e61, 0x526b726f, 0x436c6165,
-    0x746e756f, 0x00000000, 0x00080006, 0x00000103, 0x00000003, 0x74726f53, 0x6b726f57, 0x6b726f57,
-    0x6e756f43, 0x00000074, 0x00090006, 0x00000103, 0x00000004, 0x6e6e6942, 0x4d676e69, 0x416b7361,
-    0x664f646e, 0x74657366, 0x00000000, 0x00030005, 0x00000105, 0x00000000, 0x00050005, 0x00000108,
-    0x65726353, 0x69576e65, 0x00687464, 0x00060005, 0x00000109, 0x656c6954, 0x72655073, 0x656e694c,
-    0x00000000, 0x00060005, 0x0000010a, 0x65726353, 0x65486e65, 0x74686769, 0x00000000, 0x00050005,
-    0x0000010b, 0x656c6954, 0x656e694c, 0x00000073, 0x00070005, 0x0000010f, 0x6e6e6942, 0x4d676e69,
-    0x536b7361, 0x74726174, 0x00000000, 0x00040005, 0x00000116, 0x6b726f77, 0x00786449, 0x00080005,
-    0x00000119, 0x6e6e6942, 0x57676e69, 0x4f6b726f, 0x65736666, 0x74537374, 0x00747261, 0x00040005,
-    0x00000126, 0x656e6966, 0x00786449, 0x00050005, 0x0000012f, 0x65786970, 0x646e696c, 0x00007865,
-    0x00050005, 0x00000136, 0x656c6974, 0x6f6c6f43, 0x00000072, 0x00060005, 0x00000138, 0x6f6c6f43,
-    0x6c695472, 0x66754265, 0x00726566, 0x00060006, 0x00000138, 0x00000000, 0x6f6c6f43, 0x6c695472,
-    0x00007365, 0x00030005, 0x0000013a, 0x00000000, 0x00050005, 0x00000141, 0x796c6f70, 0x496e6f67,
-    0x00007864, 0x00060005, 0x00000142, 0x68737550, 0x736e6f43, 0x746e6174, 0x00000073, 0x00060006,
-    0x00000142, 0x00000000, 0x56727543, 0x61697261, 0x0000746e, 0x00060006, 0x00000142, 0x00000001,
-    0x57786554, 0x68746469, 0x00000000, 0x00060006, 0x00000142, 0x00000002, 0x48786554, 0x68676965,
-    0x00000074, 0x00060006, 0x00000142, 0x00000003, 0x57786554, 0x53706172, 0x00000000, 0x00060006,
-    0x00000142, 0x00000004, 0x57786554, 0x54706172, 0x00000000, 0x00070006, 0x00000142, 0x00000005,
-    0x49786554, 0x70614373, 0x65727574, 0x00000000, 0x00070006, 0x00000142, 0x00000006, 0x74706143,
-    0x59657275, 0x7366664f, 0x00007465, 0x00050006, 0x00000142, 0x00000007, 0x6461705f, 0x00000000,
-    0x00030005, 0x00000144, 0x00006370, 0x00050005, 0x00000153, 0x796c6f70, 0x416e6f67, 0x00727474,
-    0x00040005, 0x00000154, 0x796c6f50, 0x006e6f67, 0x00060006, 0x00000154, 0x00000000, 0x73726946,
-    0x70535874, 0x00006e61, 0x00050006, 0x00000154, 0x00000001, 0x706f5459, 0x00000000, 0x00050006,
-    0x00000154, 0x00000002, 0x746f4259, 0x00000000, 0x00050006, 0x00000154, 0x00000003, 0x6e694d58,
-    0x00000000, 0x00050006, 0x00000154, 0x00000004, 0x78614d58, 0x00000000, 0x00050006, 0x00000154,
-    0x00000005, 0x6e694d58, 0x00000059, 0x00050006, 0x00000154, 0x00000006, 0x78614d58, 0x00000059,
-    0x00050006, 0x00000154, 0x00000007, 0x69726156, 0x00746e61, 0x00050006, 0x00000154, 0x00000008,
-    0x72747441, 0x00000000, 0x00070006, 0x00000154, 0x00000009, 0x74786554, 0x4c657275, 0x72657961,
-    0x00000000, 0x00060006, 0x00000154, 0x0000000a, 0x69636146, 0x6956676e, 0x00007765, 0x00060005,
-    0x00000156, 0x796c6f50, 0x426e6f67, 0x65666675, 0x00000072, 0x00060006, 0x00000156, 0x00000000,
-    0x796c6f50, 0x736e6f67, 0x00000000, 0x00030005, 0x00000158, 0x00000000, 0x00050005, 0x0000015c,
-    0x69636166, 0x6956676e, 0x00007765, 0x00060005, 0x00000162, 0x68537369, 0x776f6461, 0x6b73614d,
-    0x00000000, 0x00070005, 0x00000168, 0x76657270, 0x68537349, 0x776f6461, 0x6b73614d, 0x00646c4f,
-    0x00060005, 0x0000016b, 0x61757165, 0x7065446c, 0x65546874, 0x00007473, 0x00050005, 0x00000170,
-    0x656c6974, 0x74706544, 0x00000068, 0x00060005, 0x00000172, 0x74706544, 0x6c695468, 0x66754265,
-    0x00726566, 0x00060006, 0x00000172, 0x00000000, 0x74706544, 0x6c695468, 0x00007365, 0x00030005,
-    0x00000174, 0x00000000, 0x00050005, 0x00000178, 0x656c6974, 0x72747441, 0x00000000, 0x00060005,
-    0x0000017a, 0x72747441, 0x656c6954, 0x66667542, 0x00007265, 0x00060006, 0x0000017a, 0x00000000,
-    0x72747441, 0x656c6954, 0x00000073, 0x00030005, 0x0000017c, 0x00000000, 0x00040005, 0x00000180,
-    0x61747364, 0x00727474, 0x00050005, 0x00000187, 0x68537369, 0x776f6461, 0x00000000, 0x00070005,
-    0x0000018b, 0x74697277, 0x63655365, 0x4c646e6f, 0x72657961, 0x00000000, 0x00050005, 0x000001a4,
-    0x44747364, 0x68747065, 0x00000000, 0x00040005, 0x000001af, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001b1, 0x61726170, 0x0000006d, 0x00040005, 0x000001b3, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001b5, 0x61726170, 0x0000006d, 0x00040005, 0x000001b7, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001c8, 0x61726170, 0x0000006d, 0x00040005, 0x000001ca, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001cc, 0x61726170, 0x0000006d, 0x00040005, 0x000001cf, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001d1, 0x61726170, 0x0000006d, 0x00040005, 0x000001d8, 0x41637273, 0x00727474, 0x00040005,
-    0x000001e2, 0x41637273, 0x00000000, 0x00050005, 0x00000224, 0x74697277, 0x70654465, 0x00006874,
-    0x00040005, 0x0000022c, 0x61726170, 0x0000006d, 0x00040005, 0x0000022f, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000232, 0x61726170, 0x0000006d, 0x00040005, 0x00000235, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000237, 0x61726170, 0x0000006d, 0x00040005, 0x00000239, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000023b, 0x61726170, 0x0000006d, 0x00040005, 0x0000023d, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000023f, 0x61726170, 0x0000006d, 0x00040005, 0x00000252, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000255, 0x61726170, 0x0000006d, 0x00040005, 0x00000258, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000025b, 0x61726170, 0x0000006d, 0x00040005, 0x0000025d, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000025f, 0x61726170, 0x0000006d, 0x00040005, 0x00000261, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000263, 0x61726170, 0x0000006d, 0x00040005, 0x00000265, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000273, 0x61726170, 0x0000006d, 0x00040005, 0x00000275, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000277, 0x61726170, 0x0000006d, 0x00040005, 0x0000027a, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000027c, 0x61726170, 0x0000006d, 0x00040005, 0x00000288, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000028a, 0x61726170, 0x0000006d, 0x00040005, 0x0000028c, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000028f, 0x61726170, 0x0000006d, 0x00040005, 0x00000291, 0x61726170, 0x0000006d,
-    0x00050005, 0x0000029a, 0x656e696c, 0x69547261, 0x0000656c, 0x00060005, 0x0000029b, 0x575f6c67,
-    0x476b726f, 0x70756f72, 0x00004449, 0x00060005, 0x000002a4, 0x72616f63, 0x614d6573, 0x6f4c6b73,
-    0x00000000, 0x00060005, 0x000002ab, 0x72616f63, 0x614d6573, 0x69486b73, 0x00000000, 0x00060005,
-    0x000002b2, 0x75736572, 0x664f746c, 0x74657366, 0x00000000, 0x00080005, 0x000002b3, 0x475f6c67,
-    0x61626f6c, 0x766e496c, 0x7461636f, 0x496e6f69, 0x00000044, 0x00040005, 0x000002bc, 0x6e6e6977,
-    0x00007265, 0x00060005, 0x000002bf, 0x63617274, 0x766f436b, 0x67617265, 0x00000065, 0x00040005,
-    0x000002c9, 0x6e657473, 0x006c6963, 0x00070005, 0x000002ca, 0x76657270, 0x68537349, 0x776f6461,
-    0x6b73614d, 0x00000000, 0x00040005, 0x000002d0, 0x6f6c6f63, 0x00000072, 0x00060005, 0x000002d2,
-    0x75736552, 0x7542746c, 0x72656666, 0x00000000, 0x00060006, 0x000002d2, 0x00000000, 0x75736552,
-    0x6156746c, 0x0065756c, 0x00030005, 0x000002d4, 0x00000000, 0x00070005, 0x000002dd, 0x6d617246,
-    0x66756265, 0x53726566, 0x64697274, 0x00000065, 0x00040005, 0x000002e3, 0x74706564, 0x00000068,
-    0x00070005, 0x000002e7, 0x75736552, 0x6544746c, 0x53687470, 0x74726174, 0x00000000, 0x00040005,
-    0x000002f5, 0x72747461, 0x00000000, 0x00060005, 0x000002f9, 0x75736552, 0x7441746c, 0x74537274,
-    0x00747261, 0x00070005, 0x0000030b, 0x75736552, 0x6957746c, 0x72656e6e, 0x66667542, 0x00007265,
-    0x00070006, 0x0000030b, 0x00000000, 0x75736552, 0x6957746c, 0x72656e6e, 0x00000000, 0x00030005,
-    0x0000030d, 0x00000000, 0x00060005, 0x00000316, 0x746e6f63, 0x61756e69, 0x6e6f6974, 0x00000000,
-    0x00080005, 0x00000318, 0x6e656c42, 0x6e6f4364, 0x756e6974, 0x6f697461, 0x6675426e, 0x00726566,
-    0x00090006, 0x00000318, 0x00000000, 0x6e656c42, 0x6e6f4364, 0x756e6974, 0x6f697461, 0x6174536e,
-    0x00006574, 0x00030005, 0x0000031a, 0x00000000, 0x00040005, 0x00000331, 0x6c616373, 0x00000065,
-    0x00030005, 0x00000336, 0x00736f70, 0x00070005, 0x00000344, 0x61656c43, 0x74694272, 0x4370616d,
-    0x726f6c6f, 0x00000000, 0x00070005, 0x0000034b, 0x61656c43, 0x74694272, 0x4470616d, 0x68747065,
-    0x00000000, 0x00040005, 0x00000370, 0x61726170, 0x0000006d, 0x00040005, 0x00000372, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000374, 0x61726170, 0x0000006d, 0x00040005, 0x00000375, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000377, 0x61726170, 0x0000006d, 0x00040005, 0x00000379, 0x61726170,
-    0x0000006d, 0x00040005, 0x0000037b, 0x61726170, 0x0000006d, 0x00040005, 0x0000037d, 0x61726170,
-    0x0000006d, 0x00040005, 0x0000037f, 0x61726170, 0x0000006d, 0x00040005, 0x00000381, 0x61726170,
-    0x0000006d, 0x00040005, 0x0000038a, 0x61726170, 0x0000006d, 0x00040005, 0x0000038c, 0x61726170,
-    0x0000006d, 0x00040005, 0x0000038e, 0x61726170, 0x0000006d, 0x00040005, 0x0000038f, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000391, 0x61726170, 0x0000006d, 0x00040005, 0x00000393, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000395, 0x61726170, 0x0000006d, 0x00040005, 0x00000397, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000399, 0x61726170, 0x0000006d, 0x00040005, 0x0000039b, 0x61726170,
-    0x0000006d, 0x00060005, 0x000003e0, 0x5778614d, 0x546b726f, 0x73656c69, 0x00000000, 0x00040047,
-    0x000000a9, 0x00000006, 0x00000010, 0x00050048, 0x000000ac, 0x00000000, 0x00000023, 0x00000000,
-    0x00050048, 0x000000ac, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x000000ac, 0x00000002,
-    0x00000023, 0x00000008, 0x00050048, 0x000000ac, 0x00000003, 0x00000023, 0x0000000c, 0x00050048,
-    0x000000ac, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x000000ac, 0x00000005, 0x00000023,
-    0x00000230, 0x00050048, 0x000000ac, 0x00000006, 0x00000023, 0x00000234, 0x00050048, 0x000000ac,
-    0x00000007, 0x00000023, 0x00000238, 0x00050048, 0x000000ac, 0x00000008, 0x00000023, 0x0000023c,
-    0x00050048, 0x000000ac, 0x00000009, 0x00000023, 0x00000240, 0x00050048, 0x000000ac, 0x0000000a,
-    0x00000023, 0x00000244, 0x00050048, 0x000000ac, 0x0000000b, 0x00000023, 0x00000248, 0x00030047,
-    0x000000ac, 0x00000002, 0x00040047, 0x000000ae, 0x00000022, 0x00000000, 0x00040047, 0x000000ae,
-    0x00000021, 0x00000000, 0x00040047, 0x000000d9, 0x0000000b, 0x0000001b, 0x00040047, 0x000000ff,
-    0x00000006, 0x00000010, 0x00040047, 0x00000100, 0x00000006, 0x00000004, 0x00040047, 0x00000101,
-    0x00000006, 0x00000004, 0x00040047, 0x00000102, 0x00000006, 0x00000004, 0x00050048, 0x00000103,
-    0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000103, 0x00000001, 0x00000023, 0x00008000,
-    0x00050048, 0x00000103, 0x00000002, 0x00000023, 0x0000a000, 0x00050048, 0x00000103, 0x00000003,
-    0x00000023, 0x0000c000, 0x00050048, 0x00000103, 0x00000004, 0x00000023, 0x0000c010, 0x00030047,
-    0x00000103, 0x00000002, 0x00040047, 0x00000105, 0x00000022, 0x00000000, 0x00040047, 0x00000105,
-    0x00000021, 0x00000008, 0x00040047, 0x00000108, 0x00000001, 0x00000000, 0x00040047, 0x0000010a,
-    0x00000001, 0x00000001, 0x00040047, 0x00000137, 0x00000006, 0x00000004, 0x00050048, 0x00000138,
-    0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000138, 0x00000002, 0x00040047, 0x0000013a,
-    0x00000022, 0x00000000, 0x00040047, 0x0000013a, 0x00000021, 0x00000004, 0x00050048, 0x00000142,
-    0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000142, 0x00000001, 0x00000023, 0x00000004,
-    0x00050048, 0x00000142, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x00000142, 0x00000003,
-    0x00000023, 0x0000000c, 0x00050048, 0x00000142, 0x00000004, 0x00000023, 0x00000010, 0x00050048,
-    0x00000142, 0x00000005, 0x00000023, 0x00000014, 0x00050048, 0x00000142, 0x00000006, 0x00000023,
-    0x00000018, 0x00050048, 0x00000142, 0x00000007, 0x00000023, 0x0000001c, 0x00030047, 0x00000142,
-    0x00000002, 0x00050048, 0x00000154, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000154,
-    0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x00000154, 0x00000002, 0x00000023, 0x00000008,
-    0x00050048, 0x00000154, 0x00000003, 0x00000023, 0x0000000c, 0x00050048, 0x00000154, 0x00000004,
-    0x00000023, 0x00000010, 0x00050048, 0x00000154, 0x00000005, 0x00000023, 0x00000014, 0x00050048,
-    0x00000154, 0x00000006, 0x00000023, 0x00000018, 0x00050048, 0x00000154, 0x00000007, 0x00000023,
-    0x0000001c, 0x00050048, 0x00000154, 0x00000008, 0x00000023, 0x00000020, 0x00050048, 0x00000154,
-    0x00000009, 0x00000023, 0x00000024, 0x00050048, 0x00000154, 0x0000000a, 0x00000023, 0x00000028,
-    0x00040047, 0x00000155, 0x00000006, 0x0000002c, 0x00040048, 0x00000156, 0x00000000, 0x00000018,
-    0x00050048, 0x00000156, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000156, 0x00000002,
-    0x00040047, 0x00000158, 0x00000022, 0x00000000, 0x00040047, 0x00000158, 0x00000021, 0x00000001,
-    0x00040047, 0x00000171, 0x00000006, 0x00000004, 0x00050048, 0x00000172, 0x00000000, 0x00000023,
-    0x00000000, 0x00030047, 0x00000172, 0x00000002, 0x00040047, 0x00000174, 0x00000022, 0x00000000,
-    0x00040047, 0x00000174, 0x00000021, 0x00000005, 0x00040047, 0x00000179, 0x00000006, 0x00000004,
-    0x00050048, 0x0000017a, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x0000017a, 0x00000002,
-    0x00040047, 0x0000017c, 0x00000022, 0x00000000, 0x00040047, 0x0000017c, 0x00000021, 0x00000006,
-    0x00040047, 0x0000029b, 0x0000000b, 0x0000001a, 0x00040047, 0x000002b3, 0x0000000b, 0x0000001c,
-    0x00040047, 0x000002d1, 0x00000006, 0x00000004, 0x00050048, 0x000002d2, 0x00000000, 0x00000023,
-    0x00000000, 0x00030047, 0x000002d2, 0x00000002, 0x00040047, 0x000002d4, 0x00000022, 0x00000000,
-    0x00040047, 0x000002d4, 0x00000021, 0x00000007, 0x00040047, 0x0000030a, 0x00000006, 0x00000004,
-    0x00050048, 0x0000030b, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x0000030b, 0x00000002,
-    0x00040047, 0x0000030d, 0x00000022, 0x00000000, 0x00040047, 0x0000030d, 0x00000021, 0x00000010,
-    0x00040047, 0x00000317, 0x00000006, 0x00000004, 0x00050048, 0x00000318, 0x00000000, 0x00000023,
-    0x00000000, 0x00030047, 0x00000318, 0x00000002, 0x00040047, 0x0000031a, 0x00000022, 0x00000000,
-    0x00040047, 0x0000031a, 0x00000021, 0x0000000f, 0x00040047, 0x00000344, 0x00000022, 0x00000001,
-    0x00040047, 0x00000344, 0x00000021, 0x00000003, 0x00040047, 0x0000034b, 0x00000022, 0x00000001,
-    0x00040047, 0x0000034b, 0x00000021, 0x00000004, 0x00040047, 0x000003e0, 0x00000001, 0x00000002,
-    0x00040047, 0x000003e3, 0x0000000b, 0x00000019, 0x00020013, 0x00000002, 0x00030021, 0x00000003,
-    0x00000002, 0x00020014, 0x00000006, 0x00040020, 0x00000007, 0x00000007, 0x00000006, 0x00040015,
-    0x00000008, 0x00000020, 0x00000000, 0x00040020, 0x00000009, 0x00000007, 0x00000008, 0x00080021,
-    0x0000000a, 0x00000006, 0x00000007, 0x00000007, 0x00000009, 0x00000009, 0x00000009, 0x000c0021,
-    0x00000012, 0x00000002, 0x00000009, 0x00000009, 0x00000009, 0x00000007, 0x00000009, 0x00000009,
-    0x00000009, 0x00000009, 0x00000007, 0x00040015, 0x0000001e, 0x00000020, 0x00000001, 0x00040020,
-    0x0000001f, 0x00000007, 0x0000001e, 0x00040017, 0x00000020, 0x00000008, 0x00000002, 0x00040020,
-    0x00000021, 0x00000007, 0x00000020, 0x000d0021, 0x00000022, 0x00000002, 0x0000001f, 0x00000009,
-    0x00000009, 0x00000021, 0x00000021, 0x00000021, 0x00000021, 0x00000007, 0x00000009, 0x00000007,
-    0x0004002b, 0x00000008, 0x00000035, 0x000000ff, 0x0004002b, 0x00000008, 0x00000037, 0x000001fe,
-    0x0004002b, 0x00000008, 0x0000003e, 0x00400010, 0x0004002b, 0x00000008, 0x00000040, 0x00000010,
-    0x0004002b, 0x00000008, 0x00000052, 0x0000e0f0, 0x0004002b, 0x0000001e, 0x00000055, 0x00000008,
-    0x0004002b, 0x00000008, 0x00000057, 0x00ff0000, 0x0004002b, 0x00000008, 0x0000005a, 0x00400000,
-    0x0004002b, 0x00000008, 0x0000005d, 0xff001f0f, 0x0004002b, 0x00000008, 0x00000067, 0x00000000,
-    0x0004002b, 0x00000008, 0x0000006e, 0x007f0000, 0x0004002b, 0x00000008, 0x00000075, 0x3f000000,
-    0x0004002b, 0x00000008, 0x00000082, 0x00008000, 0x0004002b, 0x00000008, 0x00000087, 0xffff7fff,
-    0x0004002b, 0x00000008, 0x0000008d, 0x003f003f, 0x0004002b, 0x00000008, 0x00000091, 0x00003f00,
-    0x0004002b, 0x00000008, 0x0000009b, 0x1f000000, 0x0004002b, 0x0000001e, 0x0000009f, 0x00000018,
-    0x0004002b, 0x00000008, 0x000000a1, 0x00000001, 0x00040017, 0x000000a7, 0x00000008, 0x00000004,
-    0x0004002b, 0x00000008, 0x000000a8, 0x00000022, 0x0004001c, 0x000000a9, 0x000000a7, 0x000000a8,
-    0x00030016, 0x000000aa, 0x00000020, 0x00040017, 0x000000ab, 0x000000aa, 0x00000002, 0x000e001e,
-    0x000000ac, 0x00000008, 0x00000008, 0x0000001e, 0x00000008, 0x000000a9, 0x00000008, 0x00000008,
-    0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x000000ab, 0x00040020, 0x000000ad, 0x00000002,
-    0x000000ac, 0x0004003b, 0x000000ad, 0x000000ae, 0x00000002, 0x0004002b, 0x0000001e, 0x000000af,
-    0x00000003, 0x00040020, 0x000000b0, 0x00000002, 0x00000008, 0x0004002b, 0x00000008, 0x000000b3,
-    0x00000008, 0x0004002b, 0x00000008, 0x000000bd, 0x00000020, 0x0004002b, 0x0000001e, 0x000000c2,
-    0x00000005, 0x00040017, 0x000000d7, 0x00000008, 0x00000003, 0x00040020, 0x000000d8, 0x00000001,
-    0x000000d7, 0x0004003b, 0x000000d8, 0x000000d9, 0x00000001, 0x00040020, 0x000000da, 0x00000001,
-    0x00000008, 0x0004002b, 0x0000001e, 0x000000e1, 0x00000010, 0x0004002b, 0x0000001e, 0x000000f6,
-    0x00000040, 0x0004002b, 0x00000008, 0x000000fe, 0x00000800, 0x0004001c, 0x000000ff, 0x000000a7,
-    0x000000fe, 0x0004001c, 0x00000100, 0x00000008, 0x000000fe, 0x0004001c, 0x00000101, 0x00000008,
-    0x000000fe, 0x0003001d, 0x00000102, 0x00000008, 0x0007001e, 0x00000103, 0x000000ff, 0x00000100,
-    0x00000101, 0x000000a7, 0x00000102, 0x00040020, 0x00000104, 0x0000000c, 0x00000103, 0x0004003b,
-    0x00000104, 0x00000105, 0x0000000c, 0x0004002b, 0x0000001e, 0x00000106, 0x00000004, 0x0004002b,
-    0x0000001e, 0x00000107, 0x00000000, 0x00040032, 0x0000001e, 0x00000108, 0x00000100, 0x00060034,
-    0x0000001e, 0x00000109, 0x00000087, 0x00000108, 0x000000e1, 0x00040032, 0x0000001e, 0x0000010a,
-    0x000000c0, 0x00060034, 0x0000001e, 0x0000010b, 0x00000087, 0x0000010a, 0x000000e1, 0x00060034,
-    0x0000001e, 0x0000010c, 0x00000084, 0x00000109, 0x0000010b, 0x0004002b, 0x0000001e, 0x0000010d,
-    0x00000002, 0x00060034, 0x0000001e, 0x0000010e, 0x00000084, 0x0000010c, 0x0000010d, 0x00060034,
-    0x0000001e, 0x0000010f, 0x00000080, 0x00000107, 0x0000010e, 0x00060034, 0x00000008, 0x00000110,
-    0x00000080, 0x0000010f, 0x00000067, 0x00040020, 0x00000113, 0x0000000c, 0x00000008, 0x00060034,
-    0x0000001e, 0x00000117, 0x00000084, 0x00000109, 0x0000010b, 0x00060034, 0x0000001e, 0x00000118,
-    0x00000084, 0x00000117, 0x000000f6, 0x00060034, 0x0000001e, 0x00000119, 0x00000080, 0x0000010f,
-    0x00000118, 0x00060034, 0x00000008, 0x0000011a, 0x00000080, 0x00000119, 0x00000067, 0x0003001d,
-    0x00000137, 0x00000008, 0x0003001e, 0x00000138, 0x00000137, 0x00040020, 0x00000139, 0x0000000c,
-    0x00000138, 0x0004003b, 0x00000139, 0x0000013a, 0x0000000c, 0x0004002b, 0x0000001e, 0x0000013f,
-    0x00000001, 0x000a001e, 0x00000142, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000008,
-    0x00000008, 0x0000001e, 0x00000008, 0x00040020, 0x00000143, 0x00000009, 0x00000142, 0x0004003b,
-    0x00000143, 0x00000144, 0x00000009, 0x00040020, 0x00000145, 0x00000009, 0x00000008, 0x000d001e,
-    0x00000154, 0x0000001e, 0x0000001e, 0x0000001e, 0x0000001e, 0x0000001e, 0x0000001e, 0x0000001e,
-    0x0000001e, 0x00000008, 0x000000aa, 0x00000008, 0x0003001d, 0x00000155, 0x00000154, 0x0003001e,
-    0x00000156, 0x00000155, 0x00040020, 0x00000157, 0x0000000c, 0x00000156, 0x0004003b, 0x00000157,
-    0x00000158, 0x0000000c, 0x0004002b, 0x0000001e, 0x0000015e, 0x0000000a, 0x0004002b, 0x00000008,
-    0x00000164, 0x3f000030, 0x0004002b, 0x00000008, 0x00000166, 0x00000030, 0x0004002b, 0x00000008,
-    0x0000016d, 0x00004000, 0x0003001d, 0x00000171, 0x00000008, 0x0003001e, 0x00000172, 0x00000171,
-    0x00040020, 0x00000173, 0x0000000c, 0x00000172, 0x0004003b, 0x00000173, 0x00000174, 0x0000000c,
-    0x0003001d, 0x00000179, 0x00000008, 0x0003001e, 0x0000017a, 0x00000179, 0x00040020, 0x0000017b,
-    0x0000000c, 0x0000017a, 0x0004003b, 0x0000017b, 0x0000017c, 0x0000000c, 0x0003002a, 0x00000006,
-    0x0000018c, 0x00030029, 0x00000006, 0x0000019a, 0x0004002b, 0x00000008, 0x0000019c, 0x00000002,
-    0x0004002b, 0x00000008, 0x000001a1, 0xfffffffc, 0x0004002b, 0x00000008, 0x000001be, 0x0000000f,
-    0x0004002b, 0x00000008, 0x000001da, 0x3f008000, 0x0004002b, 0x00000008, 0x00000220, 0x80000000,
-    0x0004003b, 0x000000d8, 0x0000029b, 0x00000001, 0x00060034, 0x00000008, 0x000002a0, 0x00000080,
-    0x00000109, 0x00000067, 0x0004003b, 0x000000d8, 0x000002b3, 0x00000001, 0x0004002b, 0x00000008,
-    0x000002bd, 0xffffffff, 0x0005002c, 0x00000020, 0x000002be, 0x000002bd, 0x000002bd, 0x0004002b,
-    0x0000001e, 0x000002c0, 0x00000100, 0x00060034, 0x00000006, 0x000002c1, 0x000000aa, 0x00000108,
-    0x000002c0, 0x0003001d, 0x000002d1, 0x00000008, 0x0003001e, 0x000002d2, 0x000002d1, 0x00040020,
-    0x000002d3, 0x0000000c, 0x000002d2, 0x0004003b, 0x000002d3, 0x000002d4, 0x0000000c, 0x00060034,
-    0x0000001e, 0x000002dd, 0x00000084, 0x00000108, 0x0000010a, 0x00060034, 0x00000008, 0x000002de,
-    0x00000080, 0x000002dd, 0x00000067, 0x00060034, 0x0000001e, 0x000002e4, 0x00000084, 0x00000108,
-    0x0000010a, 0x00060034, 0x0000001e, 0x000002e5, 0x00000084, 0x000002e4, 0x0000010d, 0x00060034,
-    0x00000008, 0x000002e6, 0x00000080, 0x000002e5, 0x00000067, 0x00060034, 0x00000008, 0x000002e7,
-    0x00000080, 0x00000067, 0x000002e6, 0x00060034, 0x00000008, 0x000002f0, 0x00000080, 0x000002dd,
-    0x00000067, 0x00060034, 0x0000001e, 0x000002f6, 0x00000084, 0x00000108, 0x0000010a, 0x00060034,
-    0x0000001e, 0x000002f7, 0x00000084, 0x000002f6, 0x0000010d, 0x00060034, 0x00000008, 0x000002f8,
-    0x00000080, 0x000002f7, 0x00000067, 0x00060034, 0x00000008, 0x000002f9, 0x00000080, 0x000002e7,
-    0x000002f8, 0x00060034, 0x00000008, 0x00000302, 0x00000080, 0x000002dd, 0x00000067, 0x0003001d,
-    0x0000030a, 0x00000008, 0x0003001e, 0x0000030b, 0x0000030a, 0x00040020, 0x0000030c, 0x0000000c,
-    0x0000030b, 0x0004003b, 0x0000030c, 0x0000030d, 0x0000000c, 0x0003001d, 0x00000317, 0x00000008,
-    0x0003001e, 0x00000318, 0x00000317, 0x00040020, 0x00000319, 0x0000000c, 0x00000318, 0x0004003b,
-    0x00000319, 0x0000031a, 0x0000000c, 0x0004002b, 0x00000008, 0x0000031f, 0x00000003, 0x0004002b,
-    0x00000008, 0x00000322, 0x00000004, 0x0004002b, 0x0000001e, 0x0000032c, 0x00000007, 0x00040020,
-    0x00000330, 0x00000007, 0x000000aa, 0x0004002b, 0x000000aa, 0x00000332, 0x3f800000, 0x00040020,
-    0x00000335, 0x00000007, 0x000000ab, 0x0004002b, 0x0000001e, 0x0000033c, 0x0000000b, 0x00040020,
-    0x0000033d, 0x00000002, 0x000000ab, 0x00090019, 0x00000341, 0x00000008, 0x00000001, 0x00000000,
-    0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x0003001b, 0x00000342, 0x00000341, 0x00040020,
-    0x00000343, 0x00000000, 0x00000342, 0x0004003b, 0x00000343, 0x00000344, 0x00000000, 0x0004002b,
-    0x000000aa, 0x00000347, 0x00000000, 0x0004003b, 0x00000343, 0x0000034b, 0x00000000, 0x0004002b,
-    0x0000001e, 0x00000356, 0x00000009, 0x0004002b, 0x00000008, 0x0000035b, 0x00ffffff, 0x0004002b,
-    0x0000001e, 0x00000364, 0x00000006, 0x00060034, 0x00000008, 0x000003ad, 0x00000080, 0x000002dd,
-    0x00000067, 0x00060034, 0x00000008, 0x000003bb, 0x00000080, 0x000002dd, 0x00000067, 0x00060034,
-    0x00000008, 0x000003c9, 0x00000080, 0x000002dd, 0x00000067, 0x00040032, 0x0000001e, 0x000003e0,
-    0x00003000, 0x0004002b, 0x0000001e, 0x000003e1, 0x00000080, 0x0004002b, 0x0000001e, 0x000003e2,
-    0x00000800, 0x0006002c, 0x000000d7, 0x000003e3, 0x00000040, 0x00000040, 0x000000a1, 0x00050036,
-    0x00000002, 0x00000004, 0x00000000, 0x00000003, 0x000200f8, 0x00000005, 0x0004003b, 0x0000001f,
-    0x0000029a, 0x00000007, 0x0004003b, 0x00000009, 0x000002a4, 0x00000007, 0x0004003b, 0x00000009,
-    0x000002ab, 0x00000007, 0x0004003b, 0x0000001f, 0x000002b2, 0x00000007, 0x0004003b, 0x00000021,
-    0x000002bc, 0x00000007, 0x0004003b, 0x00000007, 0x000002bf, 0x00000007, 0x0004003b, 0x00000009,
-    0x000002c9, 0x00000007, 0x0004003b, 0x00000007, 0x000002ca, 0x00000007, 0x0004003b, 0x00000021,
-    0x000002d0, 0x00000007, 0x0004003b, 0x00000021, 0x000002e3, 0x00000007, 0x0004003b, 0x00000021,
-    0x000002f5, 0x00000007, 0x0004003b, 0x00000009, 0x00000316, 0x00000007, 0x0004003b, 0x00000330,
-    0x00000331, 0x00000007, 0x0004003b, 0x00000335, 0x00000336, 0x00000007, 0x0004003b, 0x0000001f,
-    0x00000370, 0x00000007, 0x0004003b, 0x00000009, 0x00000372, 0x00000007, 0x0004003b, 0x00000009,
-    0x00000374, 0x00000007, 0x0004003b, 0x00000021, 0x00000375, 0x00000007, 0x0004003b, 0x00000021,
-    0x00000377, 0x00000007, 0x0004003b, 0x00000021, 0x00000379, 0x00000007, 0x0004003b, 0x00000021,
-    0x0000037b, 0x00000007, 0x0004003b, 0x00000007, 0x0000037d, 0x00000007, 0x0004003b, 0x00000009,
-    0x0000037f, 0x00000007, 0x0004003b, 0x00000007, 0x00000381, 0x00000007, 0x0004003b, 0x0000001f,
-    0x0000038a, 0x00000007, 0x0004003b, 0x00000009, 0x0000038c, 0x00000007, 0x0004003b, 0x00000009,
-    0x0000038e, 0x00000007, 0x0004003b, 0x00000021, 0x0000038f, 0x00000007, 0x0004003b, 0x00000021,
-    0x00000391, 0x00000007, 0x0004003b, 0x00000021, 0x00000393, 0x00000007, 0x0004003b, 0x00000021,
-    0x00000395, 0x00000007, 0x0004003b, 0x00000007, 0x00000397, 0x00000007, 0x0004003b, 0x00000009,
-    0x00000399, 0x00000007, 0x0004003b, 0x00000007, 0x0000039b, 0x00000007, 0x00050041, 0x000000da,
-    0x0000029c, 0x0000029b, 0x00000067, 0x0004003d, 0x00000008, 0x0000029d, 0x0000029c, 0x00050041,
-    0x000000da, 0x0000029e, 0x0000029b, 0x000000a1, 0x0004003d, 0x00000008, 0x0000029f, 0x0000029e,
-    0x00050084, 0x00000008, 0x000002a1, 0x0000029f, 0x000002a0, 0x00050080, 0x00000008, 0x000002a2,
-    0x0000029d, 0x000002a1, 0x0004007c, 0x0000001e, 0x000002a3, 0x000002a2, 0x0003003e, 0x0000029a,
-    0x000002a3, 0x0004003d, 0x0000001e, 0x000002a5, 0x0000029a, 0x00050084, 0x0000001e, 0x000002a6,
-    0x000002a5, 0x0000010d, 0x00050080, 0x0000001e, 0x000002a7, 0x00000107, 0x000002a6, 0x00050080,
-    0x0000001e, 0x000002a8, 0x000002a7, 0x00000107, 0x00060041, 0x00000113, 0x000002a9, 0x00000105,
-    0x00000106, 0x000002a8, 0x0004003d, 0x00000008, 0x000002aa, 0x000002a9, 0x0003003e, 0x000002a4,
-    0x000002aa, 0x0004003d, 0x0000001e, 0x000002ac, 0x0000029a, 0x00050084, 0x0000001e, 0x000002ad,
-    0x000002ac, 0x0000010d, 0x00050080, 0x0000001e, 0x000002ae, 0x00000107, 0x000002ad, 0x00050080,
-    0x0000001e, 0x000002af, 0x000002ae, 0x0000013f, 0x00060041, 0x00000113, 0x000002b0, 0x00000105,
-    0x00000106, 0x000002af, 0x0004003d, 0x00000008, 0x000002b1, 0x000002b0, 0x0003003e, 0x000002ab,
-    0x000002b1, 0x00050041, 0x000000da, 0x000002b4, 0x000002b3, 0x00000067, 0x0004003d, 0x00000008,
-    0x000002b5, 0x000002b4, 0x0004007c, 0x0000001e, 0x000002b6, 0x000002b5, 0x00050041, 0x000000da,
-    0x000002b7, 0x000002b3, 0x000000a1, 0x0004003d, 0x00000008, 0x000002b8, 0x000002b7, 0x0004007c,
-    0x0000001e, 0x000002b9, 0x000002b8, 0x00050084, 0x0000001e, 0x000002ba, 0x000002b9, 0x00000108,
-    0x00050080, 0x0000001e, 0x000002bb, 0x000002b6, 0x000002ba, 0x0003003e, 0x000002b2, 0x000002bb,
-    0x0003003e, 0x000002bc, 0x000002be, 0x000300f7, 0x000002c3, 0x00000000, 0x000400fa, 0x000002c1,
-    0x000002c2, 0x000002c3, 0x000200f8, 0x000002c2, 0x00050041, 0x000000b0, 0x000002c4, 0x000000ae,
-    0x000000af, 0x0004003d, 0x00000008, 0x000002c5, 0x000002c4, 0x000500c7, 0x00000008, 0x000002c6,
-    0x000002c5, 0x00000040, 0x000500ab, 0x00000006, 0x000002c7, 0x000002c6, 0x00000067, 0x000200f9,
-    0x000002c3, 0x000200f8, 0x000002c3, 0x000700f5, 0x00000006, 0x000002c8, 0x000002c1, 0x00000005,
-    0x000002c7, 0x000002c2, 0x0003003e, 0x000002bf, 0x000002c8, 0x0003003e, 0x000002c9, 0x00000067,
-    0x0003003e, 0x000002ca, 0x0000018c, 0x00050041, 0x00000145, 0x000002cb, 0x00000144, 0x0000010d,
-    0x0004003d, 0x00000008, 0x000002cc, 0x000002cb, 0x000500ab, 0x00000006, 0x000002cd, 0x000002cc,
-    0x00000067, 0x000300f7, 0x000002cf, 0x00000000, 0x000400fa, 0x000002cd, 0x000002ce, 0x00000325,
-    0x000200f8, 0x000002ce, 0x0004003d, 0x0000001e, 0x000002d5, 0x000002b2, 0x0004007c, 0x00000008,
-    0x000002d6, 0x000002d5, 0x00050080, 0x00000008, 0x000002d7, 0x00000067, 0x000002d6, 0x00060041,
-    0x00000113, 0x000002d8, 0x000002d4, 0x00000107, 0x000002d7, 0x0004003d, 0x00000008, 0x000002d9,
-    0x000002d8, 0x0004003d, 0x0000001e, 0x000002da, 0x000002b2, 0x0004007c, 0x00000008, 0x000002db,
-    0x000002da, 0x00050080, 0x00000008, 0x000002dc, 0x00000067, 0x000002db, 0x00050080, 0x00000008,
-    0x000002df, 0x000002dc, 0x000002de, 0x00060041, 0x00000113, 0x000002e0, 0x000002d4, 0x00000107,
-    0x000002df, 0x0004003d, 0x00000008, 0x000002e1, 0x000002e0, 0x00050050, 0x00000020, 0x000002e2,
-    0x000002d9, 0x000002e1, 0x0003003e, 0x000002d0, 0x000002e2, 0x0004003d, 0x0000001e, 0x000002e8,
-    0x000002b2, 0x0004007c, 0x00000008, 0x000002e9, 0x000002e8, 0x00050080, 0x00000008, 0x000002ea,
-    0x000002e7, 0x000002e9, 0x00060041, 0x00000113, 0x000002eb, 0x000002d4, 0x00000107, 0x000002ea,
-    0x0004003d, 0x00000008, 0x000002ec, 0x000002eb, 0x0004003d, 0x0000001e, 0x000002ed, 0x000002b2,
-    0x0004007c, 0x00000008, 0x000002ee, 0x000002ed, 0x00050080, 0x00000008, 0x000002ef, 0x000002e7,
-    0x000002ee, 0x00050080, 0x00000008, 0x000002f1, 0x000002ef, 0x000002f0, 0x00060041, 0x00000113,
-    0x000002f2, 0x000002d4, 0x00000107, 0x000002f1, 0x0004003d, 0x00000008, 0x000002f3, 0x000002f2,
-    0x00050050, 0x00000020, 0x000002f4, 0x000002ec, 0x000002f3, 0x0003003e, 0x000002e3, 0x000002f4,
-    0x0004003d, 0x0000001e, 0x000002fa, 0x000002b2, 0x0004007c, 0x00000008, 0x000002fb, 0x000002fa,
-    0x00050080, 0x00000008, 0x000002fc, 0x000002f9, 0x000002fb, 0x00060041, 0x00000113, 0x000002fd,
-    0x000002d4, 0x00000107, 0x000002fc, 0x0004003d, 0x00000008, 0x000002fe, 0x000002fd, 0x0004003d,
-    0x0000001e, 0x000002ff, 0x000002b2, 0x0004007c, 0x00000008, 0x00000300, 0x000002ff, 0x00050080,
-    0x00000008, 0x00000301, 0x000002f9, 0x00000300, 0x00050080, 0x00000008, 0x00000303, 0x00000301,
-    0x00000302, 0x00060041, 0x00000113, 0x00000304, 0x000002d4, 0x00000107, 0x00000303, 0x0004003d,
-    0x00000008, 0x00000305, 0x00000304, 0x00050050, 0x00000020, 0x00000306, 0x000002fe, 0x00000305,
-    0x0003003e, 0x000002f5, 0x00000306, 0x0004003d, 0x00000006, 0x00000307, 0x000002bf, 0x000300f7,
-    0x00000309, 0x00000000, 0x000400fa, 0x00000307, 0x00000308, 0x00000309, 0x000200f8, 0x00000308,
-    0x0004003d, 0x0000001e, 0x0000030e, 0x000002b2, 0x00060041, 0x00000113, 0x0000030f, 0x0000030d,
-    0x00000107, 0x0000030e, 0x0004003d, 0x00000008, 0x00000310, 0x0000030f, 0x0004003d, 0x0000001e,
-    0x00000311, 0x000002b2, 0x00050080, 0x0000001e, 0x00000312, 0x00000311, 0x000002dd, 0x00060041,
-    0x00000113, 0x00000313, 0x0000030d, 0x00000107, 0x00000312, 0x0004003d, 0x00000008, 0x00000314,
-    0x00000313, 0x00050050, 0x00000020, 0x00000315, 0x00000310, 0x00000314, 0x0003003e, 0x000002bc,
-    0x00000315, 0x000200f9, 0x00000309, 0x000200f8, 0x00000309, 0x0004003d, 0x0000001e, 0x0000031b,
-    0x000002b2, 0x00060041, 0x00000113, 0x0000031c, 0x0000031a, 0x00000107, 0x0000031b, 0x0004003d,
-    0x00000008, 0x0000031d, 0x0000031c, 0x0003003e, 0x00000316, 0x0000031d, 0x0004003d, 0x00000008,
-    0x0000031e, 0x00000316, 0x000500c7, 0x00000008, 0x00000320, 0x0000031e, 0x0000031f, 0x0003003e,
-    0x000002c9, 0x00000320, 0x0004003d, 0x00000008, 0x00000321, 0x00000316, 0x000500c7, 0x00000008,
-    0x00000323, 0x00000321, 0x00000322, 0x000500ab, 0x00000006, 0x00000324, 0x00000323, 0x00000067,
-    0x0003003e, 0x000002ca, 0x00000324, 0x000200f9, 0x000002cf, 0x000200f8, 0x00000325, 0x00050041,
-    0x000000b0, 0x00000326, 0x000000ae, 0x000000af, 0x0004003d, 0x00000008, 0x00000327, 0x00000326,
-    0x000500c7, 0x00000008, 0x00000328, 0x00000327, 0x0000016d, 0x000500ab, 0x00000006, 0x00000329,
-    0x00000328, 0x00000067, 0x000300f7, 0x0000032b, 0x00000000, 0x000400fa, 0x00000329, 0x0000032a,
-    0x00000360, 0x000200f8, 0x0000032a, 0x00050041, 0x000000b0, 0x0000032d, 0x000000ae, 0x0000032c,
-    0x0004003d, 0x00000008, 0x0000032e, 0x0000032d, 0x00050050, 0x00000020, 0x0000032f, 0x0000032e,
-    0x00000067, 0x0003003e, 0x000002f5, 0x0000032f, 0x0004006f, 0x000000aa, 0x00000333, 0x00000108,
-    0x00050088, 0x000000aa, 0x00000334, 0x00000332, 0x00000333, 0x0003003e, 0x00000331, 0x00000334,
-    0x0004003d, 0x000000d7, 0x00000337, 0x000002b3, 0x0007004f, 0x00000020, 0x00000338, 0x00000337,
-    0x00000337, 0x00000000, 0x00000001, 0x00040070, 0x000000ab, 0x00000339, 0x00000338, 0x0004003d,
-    0x000000aa, 0x0000033a, 0x00000331, 0x0005008e, 0x000000ab, 0x0000033b, 0x00000339, 0x0000033a,
-    0x00050041, 0x0000033d, 0x0000033e, 0x000000ae, 0x0000033c, 0x0004003d, 0x000000ab, 0x0000033f,
-    0x0000033e, 0x00050081, 0x000000ab, 0x00000340, 0x0000033b, 0x0000033f, 0x0003003e, 0x00000336,
-    0x00000340, 0x0004003d, 0x00000342, 0x00000345, 0x00000344, 0x0004003d, 0x000000ab, 0x00000346,
-    0x00000336, 0x00070058, 0x000000a7, 0x00000348, 0x00000345, 0x00000346, 0x00000002, 0x00000347,
-    0x00050051, 0x00000008, 0x00000349, 0x00000348, 0x00000000, 0x00050050, 0x00000020, 0x0000034a,
-    0x00000349, 0x00000067, 0x0003003e, 0x000002d0, 0x0000034a, 0x0004003d, 0x00000342, 0x0000034c,
-    0x0000034b, 0x0004003d, 0x000000ab, 0x0000034d, 0x00000336, 0x00070058, 0x000000a7, 0x0000034e,
-    0x0000034c, 0x0000034d, 0x00000002, 0x00000347, 0x00050051, 0x00000008, 0x0000034f, 0x0000034e,
-    0x00000000, 0x00050050, 0x00000020, 0x00000350, 0x0000034f, 0x00000067, 0x0003003e, 0x000002e3,
-    0x00000350, 0x00050041, 0x00000009, 0x00000351, 0x000002f5, 0x00000067, 0x0004003d, 0x00000008,
-    0x00000352, 0x00000351, 0x000500c7, 0x00000008, 0x00000353, 0x00000352, 0x00000087, 0x00050041,
-    0x00000009, 0x00000354, 0x000002e3, 0x00000067, 0x0004003d, 0x00000008, 0x00000355, 0x00000354,
-    0x000500c2, 0x00000008, 0x00000357, 0x00000355, 0x00000356, 0x000500c7, 0x00000008, 0x00000358,
-    0x00000357, 0x00000082, 0x000500c5, 0x00000008, 0x00000359, 0x00000353, 0x00000358, 0x00050041,
-    0x00000009, 0x0000035a, 0x000002f5, 0x00000067, 0x0003003e, 0x0000035a, 0x00000359, 0x00050041,
-    0x00000009, 0x0000035c, 0x000002e3, 0x00000067, 0x0004003d, 0x00000008, 0x0000035d, 0x0000035c,
-    0x000500c7, 0x00000008, 0x0000035e, 0x0000035d, 0x0000035b, 0x00050041, 0x00000009, 0x0000035f,
-    0x000002e3, 0x00000067, 0x0003003e, 0x0000035f, 0x0000035e, 0x000200f9, 0x0000032b, 0x000200f8,
-    0x00000360, 0x00050041, 0x000000b0, 0x00000361, 0x000000ae, 0x000000c2, 0x0004003d, 0x00000008,
-    0x00000362, 0x00000361, 0x00050050, 0x00000020, 0x00000363, 0x00000362, 0x00000067, 0x0003003e,
-    0x000002d0, 0x00000363, 0x00050041, 0x000000b0, 0x00000365, 0x000000ae, 0x00000364, 0x0004003d,
-    0x00000008, 0x00000366, 0x00000365, 0x00050050, 0x00000020, 0x00000367, 0x00000366, 0x00000067,
-    0x0003003e, 0x000002e3, 0x00000367, 0x00050041, 0x000000b0, 0x00000368, 0x000000ae, 0x0000032c,
-    0x0004003d, 0x00000008, 0x00000369, 0x00000368, 0x00050050, 0x00000020, 0x0000036a, 0x00000369,
-    0x00000067, 0x0003003e, 0x000002f5, 0x0000036a, 0x000200f9, 0x0000032b, 0x000200f8, 0x0000032b,
-    0x000200f9, 0x000002cf, 0x000200f8, 0x000002cf, 0x00050041, 0x00000145, 0x0000036b, 0x00000144,
-    0x0000010d, 0x0004003d, 0x00000008, 0x0000036c, 0x0000036b, 0x000500aa, 0x00000006, 0x0000036d,
-    0x0000036c, 0x00000067, 0x000300f7, 0x0000036f, 0x00000000, 0x000400fa, 0x0000036d, 0x0000036e,
-    0x0000036f, 0x000200f8, 0x0000036e, 0x0003003e, 0x000002c9, 0x00000067, 0x0003003e, 0x000002ca,
-    0x0000018c, 0x000200f9, 0x0000036f, 0x000200f8, 0x0000036f, 0x0004003d, 0x0000001e, 0x00000371,
-    0x0000029a, 0x0003003e, 0x00000370, 0x00000371, 0x0004003d, 0x00000008, 0x00000373, 0x000002a4,
-    0x0003003e, 0x00000372, 0x00000373, 0x0003003e, 0x00000374, 0x00000067, 0x0004003d, 0x00000020,
-    0x00000376, 0x000002d0, 0x0003003e, 0x00000375, 0x00000376, 0x0004003d, 0x00000020, 0x00000378,
-    0x000002e3, 0x0003003e, 0x00000377, 0x00000378, 0x0004003d, 0x00000020, 0x0000037a, 0x000002f5,
-    0x0003003e, 0x00000379, 0x0000037a, 0x0004003d, 0x00000020, 0x0000037c, 0x000002bc, 0x0003003e,
-    0x0000037b, 0x0000037c, 0x0004003d, 0x00000006, 0x0000037e, 0x000002bf, 0x0003003e, 0x0000037d,
-    0x0000037e, 0x0004003d, 0x00000008, 0x00000380, 0x000002c9, 0x0003003e, 0x0000037f, 0x00000380,
-    0x0004003d, 0x00000006, 0x00000382, 0x000002ca, 0x0003003e, 0x00000381, 0x00000382, 0x000e0039,
-    0x00000002, 0x00000383, 0x0000002d, 0x00000370, 0x00000372, 0x00000374, 0x00000375, 0x00000377,
-    0x00000379, 0x0000037b, 0x0000037d, 0x0000037f, 0x00000381, 0x0004003d, 0x00000020, 0x00000384,
-    0x00000375, 0x0003003e, 0x000002d0, 0x00000384, 0x0004003d, 0x00000020, 0x00000385, 0x00000377,
-    0x0003003e, 0x000002e3, 0x00000385, 0x0004003d, 0x00000020, 0x00000386, 0x00000379, 0x0003003e,
-    0x000002f5, 0x00000386, 0x0004003d, 0x00000020, 0x00000387, 0x0000037b, 0x0003003e, 0x000002bc,
-    0x00000387, 0x0004003d, 0x00000008, 0x00000388, 0x0000037f, 0x0003003e, 0x000002c9, 0x00000388,
-    0x0004003d, 0x00000006, 0x00000389, 0x00000381, 0x0003003e, 0x000002ca, 0x00000389, 0x0004003d,
-    0x0000001e, 0x0000038b, 0x0000029a, 0x0003003e, 0x0000038a, 0x0000038b, 0x0004003d, 0x00000008,
-    0x0000038d, 0x000002ab, 0x0003003e, 0x0000038c, 0x0000038d, 0x0003003e, 0x0000038e, 0x000000bd,
-    0x0004003d, 0x00000020, 0x00000390, 0x000002d0, 0x0003003e, 0x0000038f, 0x00000390, 0x0004003d,
-    0x00000020, 0x00000392, 0x000002e3, 0x0003003e, 0x00000391, 0x00000392, 0x0004003d, 0x00000020,
-    0x00000394, 0x000002f5, 0x0003003e, 0x00000393, 0x00000394, 0x0004003d, 0x00000020, 0x00000396,
-    0x000002bc, 0x0003003e, 0x00000395, 0x00000396, 0x0004003d, 0x00000006, 0x00000398, 0x000002bf,
-    0x0003003e, 0x00000397, 0x00000398, 0x0004003d, 0x00000008, 0x0000039a, 0x000002c9, 0x0003003e,
-    0x00000399, 0x0000039a, 0x0004003d, 0x00000006, 0x0000039c, 0x000002ca, 0x0003003e, 0x0000039b,
-    0x0000039c, 0x000e0039, 0x00000002, 0x0000039d, 0x0000002d, 0x0000038a, 0x0000038c, 0x0000038e,
-    0x0000038f, 0x00000391, 0x00000393, 0x00000395, 0x00000397, 0x00000399, 0x0000039b, 0x0004003d,
-    0x00000020, 0x0000039e, 0x0000038f, 0x0003003e, 0x000002d0, 0x0000039e, 0x0004003d, 0x00000020,
-    0x0000039f, 0x00000391, 0x0003003e, 0x000002e3, 0x0000039f, 0x0004003d, 0x00000020, 0x000003a0,
-    0x00000393, 0x0003003e, 0x000002f5, 0x000003a0, 0x0004003d, 0x00000020, 0x000003a1, 0x00000395,
-    0x0003003e, 0x000002bc, 0x000003a1, 0x0004003d, 0x00000008, 0x000003a2, 0x00000399, 0x0003003e,
-    0x000002c9, 0x000003a2, 0x0004003d, 0x00000006, 0x000003a3, 0x0000039b, 0x0003003e, 0x000002ca,
-    0x000003a3, 0x0004003d, 0x0000001e, 0x000003a4, 0x000002b2, 0x0004007c, 0x00000008, 0x000003a5,
-    0x000003a4, 0x00050080, 0x00000008, 0x000003a6, 0x00000067, 0x000003a5, 0x00050041, 0x00000009,
-    0x000003a7, 0x000002d0, 0x00000067, 0x0004003d, 0x00000008, 0x000003a8, 0x000003a7, 0x00060041,
-    0x00000113, 0x000003a9, 0x000002d4, 0x00000107, 0x000003a6, 0x0003003e, 0x000003a9, 0x000003a8,
-    0x0004003d, 0x0000001e, 0x000003aa, 0x000002b2, 0x0004007c, 0x00000008, 0x000003ab, 0x000003aa,
-    0x00050080, 0x00000008, 0x000003ac, 0x00000067, 0x000003ab, 0x00050080, 0x00000008, 0x000003ae,
-    0x000003ac, 0x000003ad, 0x00050041, 0x00000009, 0x000003af, 0x000002d0, 0x000000a1, 0x0004003d,
-    0x00000008, 0x000003b0, 0x000003af, 0x00060041, 0x00000113, 0x000003b1, 0x000002d4, 0x00000107,
-    0x000003ae, 0x0003003e, 0x000003b1, 0x000003b0, 0x0004003d, 0x0000001e, 0x000003b2, 0x000002b2,
-    0x0004007c, 0x00000008, 0x000003b3, 0x000003b2, 0x00050080, 0x00000008, 0x000003b4, 0x000002e7,
-    0x000003b3, 0x00050041, 0x00000009, 0x000003b5, 0x000002e3, 0x00000067, 0x0004003d, 0x00000008,
-    0x000003b6, 0x000003b5, 0x00060041, 0x00000113, 0x000003b7, 0x000002d4, 0x00000107, 0x000003b4,
-    0x0003003e, 0x000003b7, 0x000003b6, 0x0004003d, 0x0000001e, 0x000003b8, 0x000002b2, 0x0004007c,
-    0x00000008, 0x000003b9, 0x000003b8, 0x00050080, 0x00000008, 0x000003ba, 0x000002e7, 0x000003b9,
-    0x00050080, 0x00000008, 0x000003bc, 0x000003ba, 0x000003bb, 0x00050041, 0x00000009, 0x000003bd,
-    0x000002e3, 0x000000a1, 0x0004003d, 0x00000008, 0x000003be, 0x000003bd, 0x00060041, 0x00000113,
-    0x000003bf, 0x000002d4, 0x00000107, 0x000003bc, 0x0003003e, 0x000003bf, 0x000003be, 0x0004003d,
-    0x0000001e, 0x000003c0, 0x000002b2, 0x0004007c, 0x00000008, 0x000003c1, 0x000003c0, 0x00050080,
-    0x00000008, 0x000003c2, 0x000002f9, 0x000003c1, 0x00050041, 0x00000009, 0x000003c3, 0x000002f5,
-    0x00000067, 0x0004003d, 0x00000008, 0x000003c4, 0x000003c3, 0x00060041, 0x00000113, 0x000003c5,
-    0x000002d4, 0x00000107, 0x000003c2, 0x0003003e, 0x000003c5, 0x000003c4, 0x0004003d, 0x0000001e,
-    0x000003c6, 0x000002b2, 0x0004007c, 0x00000008, 0x000003c7, 0x000003c6, 0x00050080, 0x00000008,
-    0x000003c8, 0x000002f9, 0x000003c7, 0x00050080, 0x00000008, 0x000003ca, 0x000003c8, 0x000003c9,
-    0x00050041, 0x00000009, 0x000003cb, 0x000002f5, 0x000000a1, 0x0004003d, 0x00000008, 0x000003cc,
-    0x000003cb, 0x00060041, 0x00000113, 0x000003cd, 0x000002d4, 0x00000107, 0x000003ca, 0x0003003e,
-    0x000003cd, 0x000003cc, 0x0004003d, 0x00000006, 0x000003ce, 0x000002bf, 0x000300f7, 0x000003d0,
-    0x00000000, 0x000400fa, 0x000003ce, 0x000003cf, 0x000003d0, 0x000200f8, 0x000003cf, 0x0004003d,
-    0x0000001e, 0x000003d1, 0x000002b2, 0x00050041, 0x00000009, 0x000003d2, 0x000002bc, 0x00000067,
-    0x0004003d, 0x00000008, 0x000003d3, 0x000003d2, 0x00060041, 0x00000113, 0x000003d4, 0x0000030d,
-    0x00000107, 0x000003d1, 0x0003003e, 0x000003d4, 0x000003d3, 0x0004003d, 0x0000001e, 0x000003d5,
-    0x000002b2, 0x00050080, 0x0000001e, 0x000003d6, 0x000003d5, 0x000002dd, 0x00050041, 0x00000009,
-    0x000003d7, 0x000002bc, 0x000000a1, 0x0004003d, 0x00000008, 0x000003d8, 0x000003d7, 0x00060041,
-    0x00000113, 0x000003d9, 0x0000030d, 0x00000107, 0x000003d6, 0x0003003e, 0x000003d9, 0x000003d8,
-    0x000200f9, 0x000003d0, 0x000200f8, 0x000003d0, 0x0004003d, 0x0000001e, 0x000003da, 0x000002b2,
-    0x0004003d, 0x00000008, 0x000003db, 0x000002c9, 0x0004003d, 0x00000006, 0x000003dc, 0x000002ca,
-    0x000600a9, 0x00000008, 0x000003dd, 0x000003dc, 0x00000322, 0x00000067, 0x000500c5, 0x00000008,
-    0x000003de, 0x000003db, 0x000003dd, 0x00060041, 0x00000113, 0x000003df, 0x0000031a, 0x00000107,
-    0x000003da, 0x0003003e, 0x000003df, 0x000003de, 0x000100fd, 0x00010038, 0x00050036, 0x00000006,
-    0x00000010, 0x00000000, 0x0000000a, 0x00030037, 0x00000007, 0x0000000b, 0x00030037, 0x00000007,
-    0x0000000c, 0x00030037, 0x00000009, 0x0000000d, 0x00030037, 0x00000009, 0x0000000e, 0x00030037,
-    0x00000009, 0x0000000f, 0x000200f8, 0x00000011, 0x0004003b, 0x00000007, 0x00000043, 0x00000007,
-    0x0004003d, 0x00000006, 0x0000002f, 0x0000000b, 0x000300f7, 0x00000031, 0x00000000, 0x000400fa,
-    0x0000002f, 0x00000030, 0x00000031, 0x000200f8, 0x00000030, 0x0004003d, 0x00000008, 0x00000032,
-    0x0000000d, 0x0004003d, 0x00000008, 0x00000033, 0x0000000e, 0x00050082, 0x00000008, 0x00000034,
-    0x00000032, 0x00000033, 0x00050080, 0x00000008, 0x00000036, 0x00000034, 0x00000035, 0x000500b2,
-    0x00000006, 0x00000038, 0x00000036, 0x00000037, 0x000200fe, 0x00000038, 0x000200f8, 0x00000031,
-    0x0004003d, 0x00000006, 0x0000003a, 0x0000000c, 0x000300f7, 0x0000003c, 0x00000000, 0x000400fa,
-    0x0000003a, 0x0000003b, 0x0000003c, 0x000200f8, 0x0000003b, 0x0004003d, 0x00000008, 0x0000003d,
-    0x0000000f, 0x000500c7, 0x00000008, 0x0000003f, 0x0000003d, 0x0000003e, 0x000500aa, 0x00000006,
-    0x00000041, 0x0000003f, 0x00000040, 0x000200f9, 0x0000003c, 0x000200f8, 0x0000003c, 0x000700f5,
-    0x00000006, 0x00000042, 0x0000003a, 0x00000031, 0x00000041, 0x0000003b, 0x000300f7, 0x00000045,
-    0x00000000, 0x000400fa, 0x00000042, 0x00000044, 0x00000049, 0x000200f8, 0x00000044, 0x0004003d,
-    0x00000008, 0x00000046, 0x0000000e, 0x0004003d, 0x00000008, 0x00000047, 0x0000000d, 0x000500b2,
-    0x00000006, 0x00000048, 0x00000046, 0x00000047, 0x0003003e, 0x00000043, 0x00000048, 0x000200f9,
-    0x00000045, 0x000200f8, 0x00000049, 0x0004003d, 0x00000008, 0x0000004a, 0x0000000e, 0x0004003d,
-    0x00000008, 0x0000004b, 0x0000000d, 0x000500b0, 0x00000006, 0x0000004c, 0x0000004a, 0x0000004b,
-    0x0003003e, 0x00000043, 0x0000004c, 0x000200f9, 0x00000045, 0x000200f8, 0x00000045, 0x0004003d,
-    0x00000006, 0x0000004d, 0x00000043, 0x000200fe, 0x0000004d, 0x00010038, 0x00050036, 0x00000002,
-    0x0000001c, 0x00000000, 0x00000012, 0x00030037, 0x00000009, 0x00000013, 0x00030037, 0x00000009,
-    0x00000014, 0x00030037, 0x00000009, 0x00000015, 0x00030037, 0x00000007, 0x00000016, 0x00030037,
-    0x00000009, 0x00000017, 0x00030037, 0x00000009, 0x00000018, 0x00030037, 0x00000009, 0x00000019,
-    0x00030037, 0x00000009, 0x0000001a, 0x00030037, 0x00000007, 0x0000001b, 0x000200f8, 0x0000001d,
-    0x0004003b, 0x00000009, 0x00000050, 0x00000007, 0x0004003b, 0x00000007, 0x0000006a, 0x00000007,
-    0x0004003b, 0x00000009, 0x0000008b, 0x00000007, 0x0004003b, 0x00000009, 0x0000008f, 0x00000007,
-    0x0004003b, 0x00000009, 0x00000093, 0x00000007, 0x0004003b, 0x00000009, 0x00000096, 0x00000007,
-    0x0004003b, 0x00000009, 0x00000099, 0x00000007, 0x0004003b, 0x00000009, 0x0000009d, 0x00000007,
-    0x0004003d, 0x00000008, 0x00000051, 0x0000001a, 0x000500c7, 0x00000008, 0x00000053, 0x00000051,
-    0x00000052, 0x0004003d, 0x00000008, 0x00000054, 0x0000001a, 0x000500c2, 0x00000008, 0x00000056,
-    0x00000054, 0x00000055, 0x000500c7, 0x00000008, 0x00000058, 0x00000056, 0x00000057, 0x000500c5,
-    0x00000008, 0x00000059, 0x00000053, 0x00000058, 0x000500c5, 0x00000008, 0x0000005b, 0x00000059,
-    0x0000005a, 0x0004003d, 0x00000008, 0x0000005c, 0x00000015, 0x000500c7, 0x00000008, 0x0000005e,
-    0x0000005c, 0x0000005d, 0x000500c5, 0x00000008, 0x0000005f, 0x0000005b, 0x0000005e, 0x0003003e,
-    0x00000050, 0x0000005f, 0x0004003d, 0x00000006, 0x00000060, 0x00000016, 0x000400a8, 0x00000006,
-    0x00000061, 0x00000060, 0x000400a8, 0x00000006, 0x00000062, 0x00000061, 0x000300f7, 0x00000064,
-    0x00000000, 0x000400fa, 0x00000062, 0x00000063, 0x00000064, 0x000200f8, 0x00000063, 0x0004003d,
-    0x00000008, 0x00000065, 0x00000015, 0x000500c7, 0x00000008, 0x00000066, 0x00000065, 0x0000005a,
-    0x000500ab, 0x00000006, 0x00000068, 0x00000066, 0x00000067, 0x000200f9, 0x00000064, 0x000200f8,
-    0x00000064, 0x000700f5, 0x00000006, 0x00000069, 0x00000061, 0x0000001d, 0x00000068, 0x00000063,
-    0x000300f7, 0x0000006c, 0x00000000, 0x000400fa, 0x00000069, 0x0000006b, 0x00000073, 0x000200f8,
-    0x0000006b, 0x0004003d, 0x00000008, 0x0000006d, 0x00000015, 0x000500c7, 0x00000008, 0x0000006f,
-    0x0000006d, 0x0000006e, 0x0004003d, 0x00000008, 0x00000070, 0x00000050, 0x000500c7, 0x00000008,
-    0x00000071, 0x00000070, 0x0000006e, 0x000500ab, 0x00000006, 0x00000072, 0x0000006f, 0x00000071,
-    0x0003003e, 0x0000006a, 0x00000072, 0x000200f9, 0x0000006c, 0x000200f8, 0x00000073, 0x0004003d,
-    0x00000008, 0x00000074, 0x00000015, 0x000500c7, 0x00000008, 0x00000076, 0x00000074, 0x00000075,
-    0x0004003d, 0x00000008, 0x00000077, 0x0000001a, 0x000500c7, 0x00000008, 0x00000078, 0x00000077,
-    0x00000075, 0x000500ab, 0x00000006, 0x00000079, 0x00000076, 0x00000078, 0x0003003e, 0x0000006a,
-    0x00000079, 0x000200f9, 0x0000006c, 0x000200f8, 0x0000006c, 0x0004003d, 0x00000006, 0x0000007a,
-    0x0000006a, 0x000300f7, 0x0000007c, 0x00000000, 0x000400fa, 0x0000007a, 0x0000007b, 0x0000007c,
-    0x000200f8, 0x0000007b, 0x0004003d, 0x00000006, 0x0000007d, 0x0000001b, 0x000300f7, 0x0000007f,
-    0x00000000, 0x000400fa, 0x0000007d, 0x0000007e, 0x0000007f, 0x000200f8, 0x0000007e, 0x0004003d,
-    0x00000008, 0x00000080, 0x00000019, 0x0003003e, 0x00000014, 0x00000080, 0x000200f9, 0x0000007f,
-    0x000200f8, 0x0000007f, 0x0004003d, 0x00000008, 0x00000081, 0x00000015, 0x000500c7, 0x00000008,
-    0x00000083, 0x00000081, 0x00000082, 0x000500aa, 0x00000006, 0x00000084, 0x00000083, 0x00000067,
-    0x000300f7, 0x00000086, 0x00000000, 0x000400fa, 0x00000084, 0x00000085, 0x00000086, 0x000200f8,
-    0x00000085, 0x0004003d, 0x00000008, 0x00000088, 0x00000050, 0x000500c7, 0x00000008, 0x00000089,
-    0x00000088, 0x00000087, 0x0003003e, 0x00000050, 0x00000089, 0x000200f9, 0x00000086, 0x000200f8,
-    0x00000086, 0x0004003d, 0x00000008, 0x0000008a, 0x00000050, 0x0003003e, 0x00000015, 0x0000008a,
-    0x0004003d, 0x00000008, 0x0000008c, 0x00000017, 0x000500c7, 0x00000008, 0x0000008e, 0x0000008c,
-    0x0000008d, 0x0003003e, 0x0000008b, 0x0000008e, 0x0004003d, 0x00000008, 0x00000090, 0x00000017,
-    0x000500c7, 0x00000008, 0x00000092, 0x00000090, 0x00000091, 0x0003003e, 0x0000008f, 0x00000092,
-    0x0004003d, 0x00000008, 0x00000094, 0x00000013, 0x000500c7, 0x00000008, 0x00000095, 0x00000094,
-    0x0000008d, 0x0003003e, 0x00000093, 0x00000095, 0x0004003d, 0x00000008, 0x00000097, 0x00000013,
-    0x000500c7, 0x00000008, 0x00000098, 0x00000097, 0x00000091, 0x0003003e, 0x00000096, 0x00000098,
-    0x0004003d, 0x00000008, 0x0000009a, 0x00000013, 0x000500c7, 0x00000008, 0x0000009c, 0x0000009a,
-    0x0000009b, 0x0003003e, 0x00000099, 0x0000009c, 0x0004003d, 0x00000008, 0x0000009e, 0x00000018,
-    0x000500c2, 0x00000008, 0x000000a0, 0x0000009e, 0x0000009f, 0x00050080, 0x00000008, 0x000000a2,
-    0x000000a0, 0x000000a1, 0x0003003e, 0x0000009d, 0x000000a2, 0x0004003d, 0x00000008, 0x000000a3,
-    0x00000099, 0x000500ab, 0x00000006, 0x000000a4, 0x000000a3, 0x00000067, 0x000300f7, 0x000000a6,
-    0x00000000, 0x000400fa, 0x000000a4, 0x000000a5, 0x000000a6, 0x000200f8, 0x000000a5, 0x00050041,
-    0x000000b0, 0x000000b1, 0x000000ae, 0x000000af, 0x0004003d, 0x00000008, 0x000000b2, 0x000000b1,
-    0x000500c7, 0x00000008, 0x000000b4, 0x000000b2, 0x000000b3, 0x000500ab, 0x00000006, 0x000000b5,
-    0x000000b4, 0x00000067, 0x000200f9, 0x000000a6, 0x000200f8, 0x000000a6, 0x000700f5, 0x00000006,
-    0x000000b6, 0x000000a4, 0x00000086, 0x000000b5, 0x000000a5, 0x000300f7, 0x000000b8, 0x00000000,
-    0x000400fa, 0x000000b6, 0x000000b7, 0x000000b8, 0x000200f8, 0x000000b7, 0x0004003d, 0x00000008,
-    0x000000b9, 0x0000008b, 0x0004003d, 0x00000008, 0x000000ba, 0x0000009d, 0x00050084, 0x00000008,
-    0x000000bb, 0x000000b9, 0x000000ba, 0x0004003d, 0x00000008, 0x000000bc, 0x00000093, 0x0004003d,
-    0x00000008, 0x000000be, 0x0000009d, 0x00050082, 0x00000008, 0x000000bf, 0x000000bd, 0x000000be,
-    0x00050084, 0x00000008, 0x000000c0, 0x000000bc, 0x000000bf, 0x00050080, 0x00000008, 0x000000c1,
-    0x000000bb, 0x000000c0, 0x000500c2, 0x00000008, 0x000000c3, 0x000000c1, 0x000000c2, 0x0003003e,
-    0x0000008b, 0x000000c3, 0x0004003d, 0x00000008, 0x000000c4, 0x0000008f, 0x0004003d, 0x00000008,
-    0x000000c5, 0x0000009d, 0x00050084, 0x00000008, 0x000000c6, 0x000000c4, 0x000000c5, 0x0004003d,
-    0x00000008, 0x000000c7, 0x00000096, 0x0004003d, 0x00000008, 0x000000c8, 0x0000009d, 0x00050082,
-    0x00000008, 0x000000c9, 0x000000bd, 0x000000c8, 0x00050084, 0x00000008, 0x000000ca, 0x000000c7,
-    0x000000c9, 0x00050080, 0x00000008, 0x000000cb, 0x000000c6, 0x000000ca, 0x000500c2, 0x00000008,
-    0x000000cc, 0x000000cb, 0x000000c2, 0x0003003e, 0x0000008f, 0x000000cc, 0x000200f9, 0x000000b8,
-    0x000200f8, 0x000000b8, 0x0004003d, 0x00000008, 0x000000cd, 0x0000008b, 0x000500c7, 0x00000008,
-    0x000000ce, 0x000000cd, 0x0000008d, 0x0004003d, 0x00000008, 0x000000cf, 0x0000008f, 0x000500c7,
-    0x00000008, 0x000000d0, 0x000000cf, 0x00000091, 0x000500c5, 0x00000008, 0x000000d1, 0x000000ce,
-    0x000000d0, 0x0004003d, 0x00000008, 0x000000d2, 0x00000099, 0x0004003d, 0x00000008, 0x000000d3,
-    0x00000018, 0x0007000c, 0x00000008, 0x000000d4, 0x00000001, 0x00000029, 0x000000d2, 0x000000d3,
-    0x000500c5, 0x00000008, 0x000000d5, 0x000000d1, 0x000000d4, 0x0003003e, 0x00000013, 0x000000d5,
-    0x000200f9, 0x0000007c, 0x000200f8, 0x0000007c, 0x000100fd, 0x00010038, 0x00050036, 0x00000002,
-    0x0000002d, 0x00000000, 0x00000022, 0x00030037, 0x0000001f, 0x00000023, 0x00030037, 0x00000009,
-    0x00000024, 0x00030037, 0x00000009, 0x00000025, 0x00030037, 0x00000021, 0x00000026, 0x00030037,
-    0x00000021, 0x00000027, 0x00030037, 0x00000021, 0x00000028, 0x00030037, 0x00000021, 0x00000029,
-    0x00030037, 0x00000007, 0x0000002a, 0x00030037, 0x00000009, 0x0000002b, 0x00030037, 0x00000007,
-    0x0000002c, 0x000200f8, 0x0000002e, 0x0004003b, 0x0000001f, 0x000000d6, 0x00000007, 0x0004003b,
-    0x00000009, 0x000000eb, 0x00000007, 0x0004003b, 0x00000009, 0x000000f4, 0x00000007, 0x0004003b,
-    0x00000009, 0x000000fd, 0x00000007, 0x0004003b, 0x00000009, 0x00000116, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000126, 0x00000007, 0x0004003b, 0x00000009, 0x0000012f, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000136, 0x00000007, 0x0004003b, 0x00000009, 0x00000141, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000153, 0x00000007, 0x0004003b, 0x00000007, 0x0000015c, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000162, 0x00000007, 0x0004003b, 0x00000007, 0x00000168, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000016b, 0x00000007, 0x0004003b, 0x00000009, 0x00000170, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000178, 0x00000007, 0x0004003b, 0x00000009, 0x00000180, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000187, 0x00000007, 0x0004003b, 0x00000007, 0x0000018b, 0x00000007, 0x0004003b,
-    0x00000009, 0x000001a4, 0x00000007, 0x0004003b, 0x00000009, 0x000001a6, 0x00000007, 0x0004003b,
-    0x00000007, 0x000001af, 0x00000007, 0x0004003b, 0x00000007, 0x000001b1, 0x00000007, 0x0004003b,
-    0x00000009, 0x000001b3, 0x00000007, 0x0004003b, 0x00000009, 0x000001b5, 0x00000007, 0x0004003b,
-    0x00000009, 0x000001b7, 0x00000007, 0x0004003b, 0x00000007, 0x000001c8, 0x00000007, 0x0004003b,
-    0x00000007, 0x000001ca, 0x00000007, 0x0004003b, 0x00000009, 0x000001cc, 0x00000007, 0x0004003b,
-    0x00000009, 0x000001cf, 0x00000007, 0x0004003b, 0x00000009, 0x000001d1, 0x00000007, 0x0004003b,
-    0x00000009, 0x000001d8, 0x00000007, 0x0004003b, 0x00000009, 0x000001e2, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000224, 0x00000007, 0x0004003b, 0x00000009, 0x0000022c, 0x00000007, 0x0004003b,
-    0x00000009, 0x0000022f, 0x00000007, 0x0004003b, 0x00000009, 0x00000232, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000235, 0x00000007, 0x0004003b, 0x00000009, 0x00000237, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000239, 0x00000007, 0x0004003b, 0x00000009, 0x0000023b, 0x00000007, 0x0004003b,
-    0x00000009, 0x0000023d, 0x00000007, 0x0004003b, 0x00000007, 0x0000023f, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000252, 0x00000007, 0x0004003b, 0x00000009, 0x00000255, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000258, 0x00000007, 0x0004003b, 0x00000007, 0x0000025b, 0x00000007, 0x0004003b,
-    0x00000009, 0x0000025d, 0x00000007, 0x0004003b, 0x00000009, 0x0000025f, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000261, 0x00000007, 0x0004003b, 0x00000009, 0x00000263, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000265, 0x00000007, 0x0004003b, 0x00000007, 0x00000273, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000275, 0x00000007, 0x0004003b, 0x00000009, 0x00000277, 0x00000007, 0x0004003b,
-    0x00000009, 0x0000027a, 0x00000007, 0x0004003b, 0x00000009, 0x0000027c, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000288, 0x00000007, 0x0004003b, 0x00000007, 0x0000028a, 0x00000007, 0x0004003b,
-    0x00000009, 0x0000028c, 0x00000007, 0x0004003b, 0x00000009, 0x0000028f, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000291, 0x00000007, 0x00050041, 0x000000da, 0x000000db, 0x000000d9, 0x00000067,
-    0x0004003d, 0x00000008, 0x000000dc, 0x000000db, 0x0004007c, 0x0000001e, 0x000000dd, 0x000000dc,
-    0x00050041, 0x000000da, 0x000000de, 0x000000d9, 0x000000a1, 0x0004003d, 0x00000008, 0x000000df,
-    0x000000de, 0x0004007c, 0x0000001e, 0x000000e0, 0x000000df, 0x00050084, 0x0000001e, 0x000000e2,
-    0x000000e0, 0x000000e1, 0x00050080, 0x0000001e, 0x000000e3, 0x000000dd, 0x000000e2, 0x0003003e,
-    0x000000d6, 0x000000e3, 0x000200f9, 0x000000e4, 0x000200f8, 0x000000e4, 0x000400f6, 0x000000e6,
-    0x000000e7, 0x00000000, 0x000200f9, 0x000000e8, 0x000200f8, 0x000000e8, 0x0004003d, 0x00000008,
-    0x000000e9, 0x00000024, 0x000500ab, 0x00000006, 0x000000ea, 0x000000e9, 0x00000067, 0x000400fa,
-    0x000000ea, 0x000000e5, 0x000000e6, 0x000200f8, 0x000000e5, 0x0004003d, 0x00000008, 0x000000ec,
-    0x00000024, 0x0006000c, 0x0000001e, 0x000000ed, 0x00000001, 0x00000049, 0x000000ec, 0x0004007c,
-    0x00000008, 0x000000ee, 0x000000ed, 0x0003003e, 0x000000eb, 0x000000ee, 0x0004003d, 0x00000008,
-    0x000000ef, 0x000000eb, 0x000500c4, 0x00000008, 0x000000f0, 0x000000a1, 0x000000ef, 0x000400c8,
-    0x00000008, 0x000000f1, 0x000000f0, 0x0004003d, 0x00000008, 0x000000f2, 0x00000024, 0x000500c7,
-    0x00000008, 0x000000f3, 0x000000f2, 0x000000f1, 0x0003003e, 0x00000024, 0x000000f3, 0x0004003d,
-    0x0000001e, 0x000000f5, 0x00000023, 0x00050084, 0x0000001e, 0x000000f7, 0x000000f5, 0x000000f6,
-    0x0004007c, 0x00000008, 0x000000f8, 0x000000f7, 0x0004003d, 0x00000008, 0x000000f9, 0x000000eb,
-    0x00050080, 0x00000008, 0x000000fa, 0x000000f8, 0x000000f9, 0x0004003d, 0x00000008, 0x000000fb,
-    0x00000025, 0x00050080, 0x00000008, 0x000000fc, 0x000000fa, 0x000000fb, 0x0003003e, 0x000000f4,
-    0x000000fc, 0x0004003d, 0x00000008, 0x00000111, 0x000000f4, 0x00050080, 0x00000008, 0x00000112,
-    0x00000110, 0x00000111, 0x00060041, 0x00000113, 0x00000114, 0x00000105, 0x00000106, 0x00000112,
-    0x0004003d, 0x00000008, 0x00000115, 0x00000114, 0x0003003e, 0x000000fd, 0x00000115, 0x0004003d,
-    0x00000008, 0x0000011b, 0x000000f4, 0x00050080, 0x00000008, 0x0000011c, 0x0000011a, 0x0000011b,
-    0x00060041, 0x00000113, 0x0000011d, 0x00000105, 0x00000106, 0x0000011c, 0x0004003d, 0x00000008,
-    0x0000011e, 0x0000011d, 0x0003003e, 0x00000116, 0x0000011e, 0x000200f9, 0x0000011f, 0x000200f8,
-    0x0000011f, 0x000400f6, 0x00000121, 0x00000122, 0x00000000, 0x000200f9, 0x00000123, 0x000200f8,
-    0x00000123, 0x0004003d, 0x00000008, 0x00000124, 0x000000fd, 0x000500ab, 0x00000006, 0x00000125,
-    0x00000124, 0x00000067, 0x000400fa, 0x00000125, 0x00000120, 0x00000121, 0x000200f8, 0x00000120,
-    0x0004003d, 0x00000008, 0x00000127, 0x000000fd, 0x0006000c, 0x0000001e, 0x00000128, 0x00000001,
-    0x00000049, 0x00000127, 0x0004007c, 0x00000008, 0x00000129, 0x00000128, 0x0003003e, 0x00000126,
-    0x00000129, 0x0004003d, 0x00000008, 0x0000012a, 0x00000126, 0x000500c4, 0x00000008, 0x0000012b,
-    0x000000a1, 0x0000012a, 0x000400c8, 0x00000008, 0x0000012c, 0x0000012b, 0x0004003d, 0x00000008,
-    0x0000012d, 0x000000fd, 0x000500c7, 0x00000008, 0x0000012e, 0x0000012d, 0x0000012c, 0x0003003e,
-    0x000000fd, 0x0000012e, 0x0004003d, 0x0000001e, 0x00000130, 0x000000d6, 0x0004007c, 0x00000008,
-    0x00000131, 0x00000130, 0x0004003d, 0x00000008, 0x00000132, 0x00000116, 0x00050084, 0x00000008,
-    0x00000133, 0x00000132, 0x00000040, 0x00050084, 0x00000008, 0x00000134, 0x00000133, 0x00000040,
-    0x00050080, 0x00000008, 0x00000135, 0x00000131, 0x00000134, 0x0003003e, 0x0000012f, 0x00000135,
-    0x0004003d, 0x00000008, 0x0000013b, 0x0000012f, 0x00060041, 0x00000113, 0x0000013c, 0x0000013a,
-    0x00000107, 0x0000013b, 0x0004003d, 0x00000008, 0x0000013d, 0x0000013c, 0x0003003e, 0x00000136,
-    0x0000013d, 0x0004003d, 0x00000008, 0x0000013e, 0x00000116, 0x00050080, 0x00000008, 0x00000140,
-    0x0000013e, 0x0000013f, 0x0003003e, 0x00000116, 0x00000140, 0x00050041, 0x00000145, 0x00000146,
-    0x00000144, 0x00000107, 0x0004003d, 0x00000008, 0x00000147, 0x00000146, 0x0004003d, 0x00000008,
-    0x00000148, 0x00000126, 0x00050080, 0x00000008, 0x00000149, 0x00000147, 0x00000148, 0x0004003d,
-    0x00000008, 0x0000014a, 0x000000eb, 0x0004003d, 0x00000008, 0x0000014b, 0x00000025, 0x00050080,
-    0x00000008, 0x0000014c, 0x0000014a, 0x0000014b, 0x00050084, 0x00000008, 0x0000014d, 0x0000014c,
-    0x000000bd, 0x00050080, 0x00000008, 0x0000014e, 0x00000149, 0x0000014d, 0x0003003e, 0x00000141,
-    0x0000014e, 0x0004003d, 0x00000008, 0x0000014f, 0x00000136, 0x000500ab, 0x00000006, 0x00000150,
-    0x0000014f, 0x00000067, 0x000300f7, 0x00000152, 0x00000000, 0x000400fa, 0x00000150, 0x00000151,
-    0x00000152, 0x000200f8, 0x00000151, 0x0004003d, 0x00000008, 0x00000159, 0x00000141, 0x00070041,
-    0x00000113, 0x0000015a, 0x00000158, 0x00000107, 0x00000159, 0x00000055, 0x0004003d, 0x00000008,
-    0x0000015b, 0x0000015a, 0x0003003e, 0x00000153, 0x0000015b, 0x0004003d, 0x00000008, 0x0000015d,
-    0x00000141, 0x00070041, 0x00000113, 0x0000015f, 0x00000158, 0x00000107, 0x0000015d, 0x0000015e,
-    0x0004003d, 0x00000008, 0x00000160, 0x0000015f, 0x000500ab, 0x00000006, 0x00000161, 0x00000160,
-    0x00000067, 0x0003003e, 0x0000015c, 0x00000161, 0x0004003d, 0x00000008, 0x00000163, 0x00000153,
-    0x000500c7, 0x00000008, 0x00000165, 0x00000163, 0x00000164, 0x000500aa, 0x00000006, 0x00000167,
-    0x00000165, 0x00000166, 0x0003003e, 0x00000162, 0x00000167, 0x0004003d, 0x00000006, 0x00000169,
-    0x0000002c, 0x0003003e, 0x00000168, 0x00000169, 0x0004003d, 0x00000006, 0x0000016a, 0x00000162,
-    0x0003003e, 0x0000002c, 0x0000016a, 0x0004003d, 0x00000008, 0x0000016c, 0x00000153, 0x000500c7,
-    0x00000008, 0x0000016e, 0x0000016c, 0x0000016d, 0x000500ab, 0x00000006, 0x0000016f, 0x0000016e,
-    0x00000067, 0x0003003e, 0x0000016b, 0x0000016f, 0x0004003d, 0x00000008, 0x00000175, 0x0000012f,
-    0x00060041, 0x00000113, 0x00000176, 0x00000174, 0x00000107, 0x00000175, 0x0004003d, 0x00000008,
-    0x00000177, 0x00000176, 0x0003003e, 0x00000170, 0x00000177, 0x0004003d, 0x00000008, 0x0000017d,
-    0x0000012f, 0x00060041, 0x00000113, 0x0000017e, 0x0000017c, 0x00000107, 0x0000017d, 0x0004003d,
-    0x00000008, 0x0000017f, 0x0000017e, 0x0003003e, 0x00000178, 0x0000017f, 0x00050041, 0x00000009,
-    0x00000181, 0x00000028, 0x00000067, 0x0004003d, 0x00000008, 0x00000182, 0x00000181, 0x0003003e,
-    0x00000180, 0x00000182, 0x0004003d, 0x00000006, 0x00000183, 0x00000162, 0x000400a8, 0x00000006,
-    0x00000184, 0x00000183, 0x000300f7, 0x00000186, 0x00000000, 0x000400fa, 0x00000184, 0x00000185,
-    0x0000026e, 0x000200f8, 0x00000185, 0x0004003d, 0x00000008, 0x00000188, 0x00000153, 0x000500c7,
-    0x00000008, 0x00000189, 0x00000188, 0x00000166, 0x000500aa, 0x00000006, 0x0000018a, 0x00000189,
-    0x00000166, 0x0003003e, 0x00000187, 0x0000018a, 0x0003003e, 0x0000018b, 0x0000018c, 0x0004003d,
-    0x00000006, 0x0000018d, 0x00000187, 0x000300f7, 0x0000018f, 0x00000000, 0x000400fa, 0x0000018d,
-    0x0000018e, 0x0000018f, 0x000200f8, 0x0000018e, 0x0004003d, 0x00000008, 0x00000190, 0x0000002b,
-    0x000500aa, 0x00000006, 0x00000191, 0x00000190, 0x00000067, 0x000300f7, 0x00000193, 0x00000000,
-    0x000400fa, 0x00000191, 0x00000192, 0x00000193, 0x000200f8, 0x00000192, 0x000200f9, 0x00000122,
-    0x000200f8, 0x00000193, 0x0004003d, 0x00000008, 0x00000195, 0x0000002b, 0x000500c7, 0x00000008,
-    0x00000196, 0x00000195, 0x000000a1, 0x000500aa, 0x00000006, 0x00000197, 0x00000196, 0x00000067,
-    0x000300f7, 0x00000199, 0x00000000, 0x000400fa, 0x00000197, 0x00000198, 0x00000199, 0x000200f8,
-    0x00000198, 0x0003003e, 0x0000018b, 0x0000019a, 0x000200f9, 0x00000199, 0x000200f8, 0x00000199,
-    0x0004003d, 0x00000008, 0x0000019b, 0x0000002b, 0x000500c7, 0x00000008, 0x0000019d, 0x0000019b,
-    0x0000019c, 0x000500aa, 0x00000006, 0x0000019e, 0x0000019d, 0x00000067, 0x000300f7, 0x000001a0,
-    0x00000000, 0x000400fa, 0x0000019e, 0x0000019f, 0x000001a0, 0x000200f8, 0x0000019f, 0x0004003d,
-    0x00000008, 0x000001a2, 0x00000180, 0x000500c7, 0x00000008, 0x000001a3, 0x000001a2, 0x000001a1,
-    0x0003003e, 0x00000180, 0x000001a3, 0x000200f9, 0x000001a0, 0x000200f8, 0x000001a0, 0x000200f9,
-    0x0000018f, 0x000200f8, 0x0000018f, 0x0004003d, 0x00000006, 0x000001a5, 0x0000018b, 0x000300f7,
-    0x000001a8, 0x00000000, 0x000400fa, 0x000001a5, 0x000001a7, 0x000001ab, 0x000200f8, 0x000001a7,
-    0x00050041, 0x00000009, 0x000001a9, 0x00000027, 0x000000a1, 0x0004003d, 0x00000008, 0x000001aa,
-    0x000001a9, 0x0003003e, 0x000001a6, 0x000001aa, 0x000200f9, 0x000001a8, 0x000200f8, 0x000001ab,
-    0x00050041, 0x00000009, 0x000001ac, 0x00000027, 0x00000067, 0x0004003d, 0x00000008, 0x000001ad,
-    0x000001ac, 0x0003003e, 0x000001a6, 0x000001ad, 0x000200f9, 0x000001a8, 0x000200f8, 0x000001a8,
-    0x0004003d, 0x00000008, 0x000001ae, 0x000001a6, 0x0003003e, 0x000001a4, 0x000001ae, 0x0004003d,
-    0x00000006, 0x000001b0, 0x0000016b, 0x0003003e, 0x000001af, 0x000001b0, 0x0004003d, 0x00000006,
-    0x000001b2, 0x0000015c, 0x0003003e, 0x000001b1, 0x000001b2, 0x0004003d, 0x00000008, 0x000001b4,
-    0x000001a4, 0x0003003e, 0x000001b3, 0x000001b4, 0x0004003d, 0x00000008, 0x000001b6, 0x00000170,
-    0x0003003e, 0x000001b5, 0x000001b6, 0x0004003d, 0x00000008, 0x000001b8, 0x00000180, 0x0003003e,
-    0x000001b7, 0x000001b8, 0x00090039, 0x00000006, 0x000001b9, 0x00000010, 0x000001af, 0x000001b1,
-    0x000001b3, 0x000001b5, 0x000001b7, 0x000400a8, 0x00000006, 0x000001ba, 0x000001b9, 0x000300f7,
-    0x000001bc, 0x00000000, 0x000400fa, 0x000001ba, 0x000001bb, 0x000001bc, 0x000200f8, 0x000001bb,
-    0x0004003d, 0x00000008, 0x000001bd, 0x00000180, 0x000500c7, 0x00000008, 0x000001bf, 0x000001bd,
-    0x000001be, 0x000500aa, 0x00000006, 0x000001c0, 0x000001bf, 0x00000067, 0x0004003d, 0x00000006,
-    0x000001c1, 0x0000018b, 0x000500a6, 0x00000006, 0x000001c2, 0x000001c0, 0x000001c1, 0x000300f7,
-    0x000001c4, 0x00000000, 0x000400fa, 0x000001c2, 0x000001c3, 0x000001c4, 0x000200f8, 0x000001c3,
-    0x000200f9, 0x00000122, 0x000200f8, 0x000001c4, 0x0003003e, 0x0000018b, 0x0000019a, 0x00050041,
-    0x00000009, 0x000001c6, 0x00000028, 0x000000a1, 0x0004003d, 0x00000008, 0x000001c7, 0x000001c6,
-    0x0003003e, 0x00000180, 0x000001c7, 0x0004003d, 0x00000006, 0x000001c9, 0x0000016b, 0x0003003e,
-    0x000001c8, 0x000001c9, 0x0004003d, 0x00000006, 0x000001cb, 0x0000015c, 0x0003003e, 0x000001ca,
-    0x000001cb, 0x00050041, 0x00000009, 0x000001cd, 0x00000027, 0x000000a1, 0x0004003d, 0x00000008,
-    0x000001ce, 0x000001cd, 0x0003003e, 0x000001cc, 0x000001ce, 0x0004003d, 0x00000008, 0x000001d0,
-    0x00000170, 0x0003003e, 0x000001cf, 0x000001d0, 0x0004003d, 0x00000008, 0x000001d2, 0x00000180,
-    0x0003003e, 0x000001d1, 0x000001d2, 0x00090039, 0x00000006, 0x000001d3, 0x00000010, 0x000001c8,
-    0x000001ca, 0x000001cc, 0x000001cf, 0x000001d1, 0x000400a8, 0x00000006, 0x000001d4, 0x000001d3,
-    0x000300f7, 0x000001d6, 0x00000000, 0x000400fa, 0x000001d4, 0x000001d5, 0x000001d6, 0x000200f8,
-    0x000001d5, 0x000200f9, 0x00000122, 0x000200f8, 0x000001d6, 0x000200f9, 0x000001bc, 0x000200f8,
-    0x000001bc, 0x0004003d, 0x00000008, 0x000001d9, 0x00000153, 0x000500c7, 0x00000008, 0x000001db,
-    0x000001d9, 0x000001da, 0x0003003e, 0x000001d8, 0x000001db, 0x0004003d, 0x00000006, 0x000001dc,
-    0x0000015c, 0x000400a8, 0x00000006, 0x000001dd, 0x000001dc, 0x000300f7, 0x000001df, 0x00000000,
-    0x000400fa, 0x000001dd, 0x000001de, 0x000001df, 0x000200f8, 0x000001de, 0x0004003d, 0x00000008,
-    0x000001e0, 0x000001d8, 0x000500c5, 0x00000008, 0x000001e1, 0x000001e0, 0x00000040, 0x0003003e,
-    0x000001d8, 0x000001e1, 0x000200f9, 0x000001df, 0x000200f8, 0x000001df, 0x0004003d, 0x00000008,
-    0x000001e3, 0x00000136, 0x000500c7, 0x00000008, 0x000001e4, 0x000001e3, 0x0000009b, 0x0003003e,
-    0x000001e2, 0x000001e4, 0x0004003d, 0x00000008, 0x000001e5, 0x000001e2, 0x000500aa, 0x00000006,
-    0x000001e6, 0x000001e5, 0x0000009b, 0x000300f7, 0x000001e8, 0x00000000, 0x000400fa, 0x000001e6,
-    0x000001e7, 0x00000223, 0x000200f8, 0x000001e7, 0x0004003d, 0x00000008, 0x000001e9, 0x00000178,
-    0x0004003d, 0x00000008, 0x000001ea, 0x000001d8, 0x000500c5, 0x00000008, 0x000001eb, 0x000001ea,
-    0x000001e9, 0x0003003e, 0x000001d8, 0x000001eb, 0x0004003d, 0x00000006, 0x000001ec, 0x0000018b,
-    0x000400a8, 0x00000006, 0x000001ed, 0x000001ec, 0x000300f7, 0x000001ef, 0x00000000, 0x000400fa,
-    0x000001ed, 0x000001ee, 0x0000020f, 0x000200f8, 0x000001ee, 0x0004003d, 0x00000008, 0x000001f0,
-    0x000001d8, 0x000500c7, 0x00000008, 0x000001f1, 0x000001f0, 0x000001be, 0x000500ab, 0x00000006,
-    0x000001f2, 0x000001f1, 0x00000067, 0x000300f7, 0x000001f4, 0x00000000, 0x000400fa, 0x000001f2,
-    0x000001f3, 0x000001f4, 0x000200f8, 0x000001f3, 0x00050041, 0x00000009, 0x000001f5, 0x00000026,
-    0x00000067, 0x0004003d, 0x00000008, 0x000001f6, 0x000001f5, 0x00050041, 0x00000009, 0x000001f7,
-    0x00000026, 0x000000a1, 0x0003003e, 0x000001f7, 0x000001f6, 0x00050041, 0x00000009, 0x000001f8,
-    0x00000027, 0x00000067, 0x0004003d, 0x00000008, 0x000001f9, 0x000001f8, 0x00050041, 0x00000009,
-    0x000001fa, 0x00000027, 0x000000a1, 0x0003003e, 0x000001fa, 0x000001f9, 0x00050041, 0x00000009,
-    0x000001fb, 0x00000028, 0x00000067, 0x0004003d, 0x00000008, 0x000001fc, 0x000001fb, 0x00050041,
-    0x00000009, 0x000001fd, 0x00000028, 0x000000a1, 0x0003003e, 0x000001fd, 0x000001fc, 0x0004003d,
-    0x00000006, 0x000001fe, 0x0000002a, 0x000300f7, 0x00000200, 0x00000000, 0x000400fa, 0x000001fe,
-    0x000001ff, 0x00000200, 0x000200f8, 0x000001ff, 0x00050041, 0x00000009, 0x00000201, 0x00000029,
-    0x00000067, 0x0004003d, 0x00000008, 0x00000202, 0x00000201, 0x00050041, 0x00000009, 0x00000203,
-    0x00000029, 0x000000a1, 0x0003003e, 0x00000203, 0x00000202, 0x000200f9, 0x00000200, 0x000200f8,
-    0x00000200, 0x000200f9, 0x000001f4, 0x000200f8, 0x000001f4, 0x0004003d, 0x00000008, 0x00000204,
-    0x00000136, 0x00050041, 0x00000009, 0x00000205, 0x00000026, 0x00000067, 0x0003003e, 0x00000205,
-    0x00000204, 0x0004003d, 0x00000008, 0x00000206, 0x00000170, 0x00050041, 0x00000009, 0x00000207,
-    0x00000027, 0x00000067, 0x0003003e, 0x00000207, 0x00000206, 0x0004003d, 0x00000008, 0x00000208,
-    0x000001d8, 0x00050041, 0x00000009, 0x00000209, 0x00000028, 0x00000067, 0x0003003e, 0x00000209,
-    0x00000208, 0x0004003d, 0x00000006, 0x0000020a, 0x0000002a, 0x000300f7, 0x0000020c, 0x00000000,
-    0x000400fa, 0x0000020a, 0x0000020b, 0x0000020c, 0x000200f8, 0x0000020b, 0x0004003d, 0x00000008,
-    0x0000020d, 0x00000141, 0x00050041, 0x00000009, 0x0000020e, 0x00000029, 0x00000067, 0x0003003e,
-    0x0000020e, 0x0000020d, 0x000200f9, 0x0000020c, 0x000200f8, 0x0000020c, 0x000200f9, 0x000001ef,
-    0x000200f8, 0x0000020f, 0x0004003d, 0x00000008, 0x00000210, 0x00000136, 0x00050041, 0x00000009,
-    0x00000211, 0x00000026, 0x000000a1, 0x0003003e, 0x00000211, 0x00000210, 0x0004003d, 0x00000008,
-    0x00000212, 0x00000170, 0x00050041, 0x00000009, 0x00000213, 0x00000027, 0x000000a1, 0x0003003e,
-    0x00000213, 0x00000212, 0x0004003d, 0x00000008, 0x00000214, 0x000001d8, 0x00050041, 0x00000009,
-    0x00000215, 0x00000028, 0x000000a1, 0x0003003e, 0x00000215, 0x00000214, 0x0004003d, 0x00000006,
-    0x00000216, 0x0000002a, 0x000300f7, 0x00000218, 0x00000000, 0x000400fa, 0x00000216, 0x00000217,
-    0x00000218, 0x000200f8, 0x00000217, 0x0004003d, 0x00000008, 0x00000219, 0x00000141, 0x00050041,
-    0x00000009, 0x0000021a, 0x00000029, 0x000000a1, 0x0003003e, 0x0000021a, 0x00000219, 0x000200f9,
-    0x00000218, 0x000200f8, 0x00000218, 0x000200f9, 0x000001ef, 0x000200f8, 0x000001ef, 0x0004003d,
-    0x00000006, 0x0000021b, 0x0000002a, 0x000300f7, 0x0000021d, 0x00000000, 0x000400fa, 0x0000021b,
-    0x0000021c, 0x0000021d, 0x000200f8, 0x0000021c, 0x0004003d, 0x00000008, 0x0000021e, 0x0000012f,
-    0x0004003d, 0x00000008, 0x0000021f, 0x00000178, 0x000500c5, 0x00000008, 0x00000221, 0x0000021f,
-    0x00000220, 0x00060041, 0x00000113, 0x00000222, 0x0000017c, 0x00000107, 0x0000021e, 0x0003003e,
-    0x00000222, 0x00000221, 0x000200f9, 0x0000021d, 0x000200f8, 0x0000021d, 0x000200f9, 0x000001e8,
-    0x000200f8, 0x00000223, 0x0004003d, 0x00000008, 0x00000225, 0x00000153, 0x000500c7, 0x00000008,
-    0x00000226, 0x00000225, 0x000000fe, 0x000500ab, 0x00000006, 0x00000227, 0x00000226, 0x00000067,
-    0x0003003e, 0x00000224, 0x00000227, 0x0004003d, 0x00000006, 0x00000228, 0x0000018b, 0x000400a8,
-    0x00000006, 0x00000229, 0x00000228, 0x000300f7, 0x0000022b, 0x00000000, 0x000400fa, 0x00000229,
-    0x0000022a, 0x0000022b, 0x000200f8, 0x0000022a, 0x00050041, 0x00000009, 0x0000022d, 0x00000026,
-    0x00000067, 0x0004003d, 0x00000008, 0x0000022e, 0x0000022d, 0x0003003e, 0x0000022c, 0x0000022e,
-    0x00050041, 0x00000009, 0x00000230, 0x00000027, 0x00000067, 0x0004003d, 0x00000008, 0x00000231,
-    0x00000230, 0x0003003e, 0x0000022f, 0x00000231, 0x00050041, 0x00000009, 0x00000233, 0x00000028,
-    0x00000067, 0x0004003d, 0x00000008, 0x00000234, 0x00000233, 0x0003003e, 0x00000232, 0x00000234,
-    0x0004003d, 0x00000006, 0x00000236, 0x00000187, 0x0003003e, 0x00000235, 0x00000236, 0x0004003d,
-    0x00000008, 0x00000238, 0x00000136, 0x0003003e, 0x00000237, 0x00000238, 0x0004003d, 0x00000008,
-    0x0000023a, 0x000001e2, 0x0003003e, 0x00000239, 0x0000023a, 0x0004003d, 0x00000008, 0x0000023c,
-    0x00000170, 0x0003003e, 0x0000023b, 0x0000023c, 0x0004003d, 0x00000008, 0x0000023e, 0x000001d8,
-    0x0003003e, 0x0000023d, 0x0000023e, 0x0004003d, 0x00000006, 0x00000240, 0x00000224, 0x0003003e,
-    0x0000023f, 0x00000240, 0x000d0039, 0x00000002, 0x00000241, 0x0000001c, 0x0000022c, 0x0000022f,
-    0x00000232, 0x00000235, 0x00000237, 0x00000239, 0x0000023b, 0x0000023d, 0x0000023f, 0x0004003d,
-    0x00000008, 0x00000242, 0x0000022c, 0x00050041, 0x00000009, 0x00000243, 0x00000026, 0x00000067,
-    0x0003003e, 0x00000243, 0x00000242, 0x0004003d, 0x00000008, 0x00000244, 0x0000022f, 0x00050041,
-    0x00000009, 0x00000245, 0x00000027, 0x00000067, 0x0003003e, 0x00000245, 0x00000244, 0x0004003d,
-    0x00000008, 0x00000246, 0x00000232, 0x00050041, 0x00000009, 0x00000247, 0x00000028, 0x00000067,
-    0x0003003e, 0x00000247, 0x00000246, 0x000200f9, 0x0000022b, 0x000200f8, 0x0000022b, 0x0004003d,
-    0x00000006, 0x00000248, 0x0000018b, 0x000400a8, 0x00000006, 0x00000249, 0x00000248, 0x000300f7,
-    0x0000024b, 0x00000000, 0x000400fa, 0x00000249, 0x0000024a, 0x0000024b, 0x000200f8, 0x0000024a,
-    0x0004003d, 0x00000008, 0x0000024c, 0x00000180, 0x000500c7, 0x00000008, 0x0000024d, 0x0000024c,
-    0x000001be, 0x000500ab, 0x00000006, 0x0000024e, 0x0000024d, 0x00000067, 0x000200f9, 0x0000024b,
-    0x000200f8, 0x0000024b, 0x000700f5, 0x00000006, 0x0000024f, 0x00000248, 0x0000022b, 0x0000024e,
-    0x0000024a, 0x000300f7, 0x00000251, 0x00000000, 0x000400fa, 0x0000024f, 0x00000250, 0x00000251,
-    0x000200f8, 0x00000250, 0x00050041, 0x00000009, 0x00000253, 0x00000026, 0x000000a1, 0x0004003d,
-    0x00000008, 0x00000254, 0x00000253, 0x0003003e, 0x00000252, 0x00000254, 0x00050041, 0x00000009,
-    0x00000256, 0x00000027, 0x000000a1, 0x0004003d, 0x00000008, 0x00000257, 0x00000256, 0x0003003e,
-    0x00000255, 0x00000257, 0x00050041, 0x00000009, 0x00000259, 0x00000028, 0x000000a1, 0x0004003d,
-    0x00000008, 0x0000025a, 0x00000259, 0x0003003e, 0x00000258, 0x0000025a, 0x0004003d, 0x00000006,
-    0x0000025c, 0x00000187, 0x0003003e, 0x0000025b, 0x0000025c, 0x0004003d, 0x00000008, 0x0000025e,
-    0x00000136, 0x0003003e, 0x0000025d, 0x0000025e, 0x0004003d, 0x00000008, 0x00000260, 0x000001e2,
-    0x0003003e, 0x0000025f, 0x00000260, 0x0004003d, 0x00000008, 0x00000262, 0x00000170, 0x0003003e,
-    0x00000261, 0x00000262, 0x0004003d, 0x00000008, 0x00000264, 0x000001d8, 0x0003003e, 0x00000263,
-    0x00000264, 0x0004003d, 0x00000006, 0x00000266, 0x00000224, 0x0003003e, 0x00000265, 0x00000266,
-    0x000d0039, 0x00000002, 0x00000267, 0x0000001c, 0x00000252, 0x00000255, 0x00000258, 0x0000025b,
-    0x0000025d, 0x0000025f, 0x00000261, 0x00000263, 0x00000265, 0x0004003d, 0x00000008, 0x00000268,
-    0x00000252, 0x00050041, 0x00000009, 0x00000269, 0x00000026, 0x000000a1, 0x0003003e, 0x00000269,
-    0x00000268, 0x0004003d, 0x00000008, 0x0000026a, 0x00000255, 0x00050041, 0x00000009, 0x0000026b,
-    0x00000027, 0x000000a1, 0x0003003e, 0x0000026b, 0x0000026a, 0x0004003d, 0x00000008, 0x0000026c,
-    0x00000258, 0x00050041, 0x00000009, 0x0000026d, 0x00000028, 0x000000a1, 0x0003003e, 0x0000026d,
-    0x0000026c, 0x000200f9, 0x00000251, 0x000200f8, 0x00000251, 0x000200f9, 0x000001e8, 0x000200f8,
-    0x000001e8, 0x000200f9, 0x00000186, 0x000200f8, 0x0000026e, 0x0004003d, 0x00000006, 0x0000026f,
-    0x00000168, 0x000400a8, 0x00000006, 0x00000270, 0x0000026f, 0x000300f7, 0x00000272, 0x00000000,
-    0x000400fa, 0x00000270, 0x00000271, 0x00000272, 0x000200f8, 0x00000271, 0x0003003e, 0x0000002b,
-    0x00000067, 0x000200f9, 0x00000272, 0x000200f8, 0x00000272, 0x0004003d, 0x00000006, 0x00000274,
-    0x0000016b, 0x0003003e, 0x00000273, 0x00000274, 0x0004003d, 0x00000006, 0x00000276, 0x0000015c,
-    0x0003003e, 0x00000275, 0x00000276, 0x00050041, 0x00000009, 0x00000278, 0x00000027, 0x00000067,
-    0x0004003d, 0x00000008, 0x00000279, 0x00000278, 0x0003003e, 0x00000277, 0x00000279, 0x0004003d,
-    0x00000008, 0x0000027b, 0x00000170, 0x0003003e, 0x0000027a, 0x0000027b, 0x00050041, 0x00000009,
-    0x0000027d, 0x00000028, 0x00000067, 0x0004003d, 0x00000008, 0x0000027e, 0x0000027d, 0x0003003e,
-    0x0000027c, 0x0000027e, 0x00090039, 0x00000006, 0x0000027f, 0x00000010, 0x00000273, 0x00000275,
-    0x00000277, 0x0000027a, 0x0000027c, 0x000400a8, 0x00000006, 0x00000280, 0x0000027f, 0x000300f7,
-    0x00000282, 0x00000000, 0x000400fa, 0x00000280, 0x00000281, 0x00000282, 0x000200f8, 0x00000281,
-    0x0003003e, 0x0000002b, 0x000000a1, 0x000200f9, 0x00000282, 0x000200f8, 0x00000282, 0x0004003d,
-    0x00000008, 0x00000283, 0x00000180, 0x000500c7, 0x00000008, 0x00000284, 0x00000283, 0x000001be,
-    0x000500ab, 0x00000006, 0x00000285, 0x00000284, 0x00000067, 0x000300f7, 0x00000287, 0x00000000,
-    0x000400fa, 0x00000285, 0x00000286, 0x00000287, 0x000200f8, 0x00000286, 0x0004003d, 0x00000006,
-    0x00000289, 0x0000016b, 0x0003003e, 0x00000288, 0x00000289, 0x0004003d, 0x00000006, 0x0000028b,
-    0x0000015c, 0x0003003e, 0x0000028a, 0x0000028b, 0x00050041, 0x00000009, 0x0000028d, 0x00000027,
-    0x000000a1, 0x0004003d, 0x00000008, 0x0000028e, 0x0000028d, 0x0003003e, 0x0000028c, 0x0000028e,
-    0x0004003d, 0x00000008, 0x00000290, 0x00000170, 0x0003003e, 0x0000028f, 0x00000290, 0x00050041,
-    0x00000009, 0x00000292, 0x00000028, 0x000000a1, 0x0004003d, 0x00000008, 0x00000293, 0x00000292,
-    0x0003003e, 0x00000291, 0x00000293, 0x00090039, 0x00000006, 0x00000294, 0x00000010, 0x00000288,
-    0x0000028a, 0x0000028c, 0x0000028f, 0x00000291, 0x000400a8, 0x00000006, 0x00000295, 0x00000294,
-    0x000300f7, 0x00000297, 0x00000000, 0x000400fa, 0x00000295, 0x00000296, 0x00000297, 0x000200f8,
-    0x00000296, 0x0004003d, 0x00000008, 0x00000298, 0x0000002b, 0x000500c5, 0x00000008, 0x00000299,
-    0x00000298, 0x0000019c, 0x0003003e, 0x0000002b, 0x00000299, 0x000200f9, 0x00000297, 0x000200f8,
-    0x00000297, 0x000200f9, 0x00000287, 0x000200f8, 0x00000287, 0x000200f9, 0x00000186, 0x000200f8,
-    0x00000186, 0x000200f9, 0x00000152, 0x000200f8, 0x00000152, 0x000200f9, 0x00000122, 0x000200f8,
-    0x00000122, 0x000200f9, 0x0000011f, 0x000200f8, 0x00000121, 0x000200f9, 0x000000e7, 0x000200f8,
-    0x000000e7, 0x000200f9, 0x000000e4, 0x000200f8, 0x000000e6, 0x000100fd, 0x00010038,
+const uint8_t Blob042_Data[6950] =
+{
+    0x28, 0xb5, 0x2f, 0xfd, 0x60, 0x7c, 0x67, 0xe5, 0xd8, 0x00, 0x1a, 0xdd, 0x14, 0x36, 0x36, 0x10,
+    0x78, 0x6f, 0xc6, 0xcc, 0xe4, 0x19, 0x78, 0x06, 0x76, 0x52, 0xc7, 0xe1, 0xcd, 0x36, 0xbb, 0x9d,
+    0x2a, 0x32, 0xf3, 0xac, 0xde, 0xe7, 0x47, 0x3f, 0x9e, 0x24, 0xe1, 0xb5, 0x2e, 0x7b, 0xb7, 0xd8,
+    0x14, 0xf8, 0x14, 0x22, 0xe9, 0x82, 0x02, 0xb6, 0xbc, 0x2a, 0xa5, 0x44, 0xe0, 0x3b, 0x2e, 0x59,
+    0xd9, 0x5b, 0x4a, 0x99, 0x02, 0x01, 0x03, 0x52, 0x03, 0x7e, 0x03, 0xa8, 0x4d, 0xef, 0xe4, 0xa2,
+    0xb6, 0x9f, 0xad, 0x2d, 0x47, 0x0d, 0xc7, 0x6c, 0x2b, 0xa6, 0xf5, 0xca, 0x6a, 0xdd, 0xf5, 0x15,
+    0xd6, 0xe7, 0xaa, 0x63, 0x6b, 0xeb, 0x2b, 0xfd, 0x02, 0xbe, 0xcd, 0x67, 0x05, 0xdb, 0x57, 0xc9,
+    0xc4, 0xf4, 0xc0, 0xe1, 0xd2, 0xb2, 0x12, 0x03, 0xa5, 0x64, 0x23, 0x63, 0x04, 0x45, 0x44, 0xc3,
+    0xf2, 0xae, 0x8f, 0xdf, 0xd4, 0xc8, 0xe2, 0x31, 0x57, 0x4e, 0xc6, 0x7a, 0xa3, 0xdc, 0xee, 0xb7,
+    0x9f, 0x86, 0x46, 0xf4, 0xe5, 0xf0, 0x77, 0x17, 0xb2, 0x77, 0x5e, 0xff, 0x5b, 0xcf, 0xce, 0x39,
+    0x63, 0xc5, 0x55, 0xb7, 0xfc, 0xa7, 0xe6, 0xdd, 0xaf, 0xbe, 0xdb, 0xfd, 0xe5, 0x6b, 0x52, 0x7e,
+    0x49, 0x5e, 0x06, 0xe3, 0x79, 0xff, 0x49, 0xb8, 0xa6, 0x75, 0x69, 0x4d, 0x1a, 0x0a, 0xfa, 0x27,
+    0x06, 0xb3, 0x7d, 0xea, 0x9e, 0xdf, 0xb6, 0xce, 0x7f, 0x31, 0x9c, 0xa6, 0x9a, 0xdb, 0xb8, 0x2c,
+    0xd6, 0xd9, 0x6e, 0x10, 0x58, 0xcb, 0x4a, 0x4a, 0xc9, 0x0a, 0x8b, 0x89, 0x86, 0x65, 0x72, 0xce,
+    0xc5, 0xfd, 0xfa, 0x1a, 0xec, 0xe1, 0xd5, 0x95, 0x8d, 0x85, 0x7d, 0x75, 0x6d, 0x65, 0x59, 0xd5,
+    0x55, 0xf5, 0xd3, 0x5f, 0x39, 0x45, 0x72, 0x84, 0x48, 0xa9, 0x90, 0x1a, 0x33, 0x3e, 0x63, 0x0c,
+    0xe2, 0x3a, 0x3e, 0x7e, 0xa1, 0xf9, 0xdf, 0x0d, 0x8b, 0xb9, 0xb9, 0xdd, 0xe4, 0x47, 0x76, 0xcd,
+    0x8b, 0x89, 0x7a, 0xe2, 0xe1, 0xae, 0xeb, 0xf4, 0x58, 0xb0, 0x0b, 0x96, 0x1b, 0x07, 0xfe, 0xf7,
+    0x0f, 0x90, 0x6f, 0x8f, 0xfc, 0x9f, 0x87, 0x5d, 0xc3, 0xb9, 0x73, 0x44, 0x1c, 0x6e, 0xdf, 0x66,
+    0xb5, 0x9f, 0xbd, 0x17, 0x60, 0x0f, 0xf1, 0xeb, 0x87, 0xbf, 0x71, 0x7b, 0xf6, 0xef, 0x62, 0xb4,
+    0xfa, 0x7f, 0x2c, 0xbe, 0x5b, 0x40, 0xdf, 0x85, 0xf1, 0xb1, 0xdd, 0xde, 0x4e, 0xd6, 0xbf, 0x6b,
+    0x7f, 0x77, 0xf7, 0x57, 0x3b, 0xee, 0x58, 0xad, 0x8b, 0x8f, 0xfd, 0xb2, 0x7f, 0x2f, 0xb8, 0x3f,
+    0xd7, 0xcb, 0xfb, 0x18, 0x4f, 0x23, 0xbb, 0x61, 0xb3, 0x77, 0xd7, 0xb7, 0x1b, 0xe3, 0xba, 0x5d,
+    0xff, 0x61, 0x7e, 0xa7, 0x97, 0x7f, 0x4f, 0x0b, 0x24, 0x97, 0xe7, 0xd0, 0x7e, 0x7c, 0x06, 0x46,
+    0xbe, 0xf3, 0xe2, 0x3a, 0xcc, 0xbb, 0xf9, 0xe1, 0x77, 0x6c, 0x05, 0x08, 0x45, 0x2e, 0x3a, 0xec,
+    0xba, 0x19, 0x0a, 0xe9, 0xf8, 0x6e, 0xd7, 0xf3, 0x59, 0x72, 0xce, 0xef, 0x81, 0xde, 0x6f, 0xde,
+    0x86, 0xf3, 0x70, 0x7a, 0x3e, 0x47, 0xbe, 0xdb, 0x06, 0xee, 0xdd, 0xaf, 0x5e, 0x38, 0xcf, 0x75,
+    0x2e, 0x8d, 0xed, 0x86, 0xcf, 0xc2, 0xd7, 0x7f, 0x1b, 0x8c, 0xe7, 0x75, 0xf5, 0xf6, 0xbb, 0xf9,
+    0xae, 0x8b, 0xed, 0xe8, 0xff, 0x2f, 0xeb, 0x62, 0xbd, 0x7f, 0x3d, 0x07, 0x04, 0x2c, 0xa3, 0xed,
+    0xe0, 0x32, 0x39, 0xaf, 0x0b, 0x7f, 0xd1, 0xfe, 0x06, 0x74, 0x83, 0xe6, 0x8b, 0x9a, 0x5b, 0x58,
+    0xfc, 0xdd, 0x0b, 0xc3, 0x6e, 0x60, 0x9c, 0x2b, 0x86, 0xf3, 0x03, 0x7b, 0x51, 0xb1, 0xba, 0x5b,
+    0x13, 0xec, 0xbb, 0xc0, 0xfe, 0x18, 0x1f, 0xdc, 0xbf, 0x68, 0x39, 0xda, 0xc7, 0xf9, 0x1d, 0xf0,
+    0x1b, 0x68, 0xb7, 0xf5, 0x8a, 0xd7, 0xb4, 0xd9, 0x1b, 0x9c, 0x86, 0xc5, 0xef, 0xc2, 0x62, 0xf1,
+    0xdd, 0xf5, 0xf7, 0x70, 0xda, 0x98, 0xfc, 0x55, 0xb3, 0xb1, 0xff, 0x0f, 0x98, 0xd7, 0x9d, 0xd5,
+    0x7b, 0x18, 0xff, 0xea, 0x78, 0x1e, 0xfd, 0xe4, 0xb0, 0xd8, 0x8b, 0x08, 0x16, 0xcf, 0x0d, 0x96,
+    0x15, 0xdc, 0x83, 0xba, 0x18, 0xf0, 0x1b, 0xc6, 0xc3, 0xf7, 0x3c, 0x8e, 0x05, 0x1e, 0x38, 0x06,
+    0xe3, 0x22, 0xce, 0x30, 0x3b, 0x5c, 0xb2, 0x55, 0xa2, 0xd5, 0x4d, 0x76, 0xc3, 0x39, 0xf8, 0x6f,
+    0xce, 0xad, 0x30, 0xd7, 0xc7, 0x55, 0x9f, 0x05, 0x7f, 0xb9, 0xe1, 0x7c, 0xa7, 0xca, 0xbd, 0xb8,
+    0x9e, 0x17, 0x8a, 0xd3, 0x04, 0xb9, 0xb8, 0xbe, 0x13, 0xd0, 0xf3, 0x70, 0xf8, 0x6b, 0x38, 0xf5,
+    0x52, 0x51, 0x50, 0xbf, 0xe7, 0x64, 0x40, 0x40, 0xb9, 0x01, 0xcf, 0x7d, 0xba, 0xd3, 0x71, 0x01,
+    0xff, 0x97, 0x55, 0x2e, 0xfc, 0x4a, 0x09, 0x92, 0xf1, 0xb8, 0x9c, 0xac, 0xe3, 0xe2, 0x34, 0x32,
+    0x39, 0xe7, 0x8a, 0xf5, 0xb9, 0x02, 0xef, 0xb3, 0x7f, 0x75, 0xc3, 0x23, 0xa3, 0xa2, 0x33, 0xae,
+    0x4e, 0x26, 0x4a, 0x1b, 0x32, 0x14, 0x77, 0xf1, 0x40, 0x3b, 0xf2, 0x57, 0xe8, 0xf1, 0x20, 0x20,
+    0x5d, 0x0c, 0x16, 0x73, 0x7f, 0xa4, 0xf6, 0x70, 0xce, 0x2d, 0x83, 0xc9, 0x61, 0x5c, 0xbf, 0xdb,
+    0xc5, 0xe0, 0x39, 0x24, 0x7d, 0xdf, 0xcf, 0x7a, 0x72, 0xf0, 0x77, 0xe7, 0xf9, 0xdf, 0xc9, 0xdd,
+    0x1d, 0xc3, 0xfc, 0x9b, 0xe7, 0x0d, 0x7f, 0xb9, 0x38, 0xa0, 0x0e, 0x18, 0x2f, 0x13, 0xe6, 0x39,
+    0xd8, 0x2f, 0x87, 0x61, 0xfd, 0x49, 0x91, 0x73, 0x32, 0x19, 0x9f, 0xdb, 0xc9, 0xf9, 0x5d, 0xe0,
+    0x3e, 0xce, 0xd5, 0x70, 0xfe, 0xda, 0x2d, 0x83, 0xb9, 0xe1, 0xaf, 0xf6, 0xf3, 0xc2, 0xef, 0xce,
+    0xcd, 0xf5, 0x6f, 0xd7, 0x2f, 0x0f, 0x7f, 0xc1, 0x7e, 0x39, 0x18, 0x71, 0x27, 0xfb, 0x8d, 0xc7,
+    0x5c, 0x3f, 0x04, 0x70, 0x6c, 0x72, 0x72, 0x6c, 0x7e, 0x38, 0xb4, 0x68, 0x6d, 0xd3, 0x3e, 0x00,
+    0xae, 0x3e, 0x9f, 0xff, 0x75, 0x26, 0xea, 0x87, 0xbf, 0xf8, 0xe0, 0x15, 0xdb, 0xf3, 0x3c, 0x7f,
+    0xb5, 0xa5, 0x65, 0xa0, 0xbb, 0x93, 0x0d, 0xc0, 0xd9, 0xc1, 0xb1, 0xdd, 0xff, 0xf4, 0xd7, 0x0f,
+    0xe0, 0x6d, 0x2c, 0xaf, 0xfd, 0x9c, 0xa7, 0xed, 0xcf, 0x0a, 0xa8, 0xed, 0x70, 0x09, 0x4c, 0xdd,
+    0x12, 0xb4, 0xb9, 0xd1, 0xd5, 0x6b, 0x6d, 0x29, 0xf6, 0xb8, 0xd6, 0xd4, 0x10, 0xa0, 0x99, 0x71,
+    0x85, 0x99, 0x35, 0x96, 0x75, 0x8a, 0x91, 0x8d, 0x81, 0x7d, 0x85, 0x75, 0x62, 0xc0, 0x02, 0xe3,
+    0xf4, 0xfa, 0xea, 0x1c, 0x7f, 0x97, 0x17, 0x93, 0xdc, 0x67, 0x97, 0x13, 0x2d, 0xac, 0x03, 0x59,
+    0x5a, 0x9c, 0x15, 0xb4, 0x07, 0xc4, 0x56, 0xaa, 0x06, 0xac, 0x0a, 0x18, 0xa8, 0x2a, 0x40, 0xe0,
+    0x01, 0x81, 0x29, 0xaa, 0x55, 0xa9, 0x29, 0x7a, 0x30, 0x4a, 0x0a, 0x2a, 0x0a, 0x6a, 0x40, 0x7d,
+    0xe4, 0xc9, 0xa9, 0x49, 0x40, 0x13, 0xd3, 0x92, 0xcd, 0x24, 0xa4, 0x94, 0x24, 0x84, 0x94, 0x74,
+    0x64, 0x84, 0x74, 0xb4, 0xfd, 0x20, 0x50, 0xa0, 0xa0, 0x1f, 0xa0, 0x00, 0x3f, 0x52, 0xec, 0x00,
+    0x9e, 0x00, 0x6c, 0x9f, 0x1e, 0x4f, 0x9e, 0xff, 0xdf, 0x6a, 0xb3, 0xf6, 0x36, 0x34, 0x7b, 0xdf,
+    0xaa, 0x6f, 0xee, 0x7f, 0xac, 0x7d, 0xb5, 0x6b, 0xdb, 0x7e, 0x56, 0xda, 0xfe, 0x56, 0x37, 0x6f,
+    0xda, 0xb8, 0x61, 0xc3, 0xda, 0x66, 0x0d, 0x9b, 0x35, 0x68, 0x52, 0xcf, 0x80, 0x41, 0x63, 0xe6,
+    0x4c, 0x19, 0x33, 0x64, 0xc6, 0x94, 0x11, 0x33, 0x26, 0x8c, 0x98, 0x30, 0x5f, 0xc0, 0x78, 0xf9,
+    0xd2, 0x65, 0x8b, 0x17, 0x2e, 0x5d, 0xb8, 0x5c, 0x31, 0xb5, 0x82, 0x7a, 0x65, 0xae, 0x8a, 0x15,
+    0x2a, 0x55, 0xa6, 0x44, 0xa1, 0x02, 0x25, 0xca, 0x13, 0x28, 0x4f, 0x4e, 0x51, 0x9d, 0x2c, 0x39,
+    0xf5, 0x3a, 0x61, 0xd2, 0x64, 0xd1, 0x93, 0x89, 0x11, 0x7b, 0x80, 0x91, 0x22, 0x47, 0x88, 0x14,
+    0x19, 0x42, 0x44, 0x6d, 0x08, 0x82, 0x33, 0xca, 0x52, 0x52, 0x21, 0xa1, 0xa2, 0x58, 0x21, 0xb7,
+    0xaa, 0x0f, 0x56, 0x6f, 0x90, 0xd1, 0xbb, 0xd3, 0x0c, 0x48, 0x90, 0xd1, 0x1f, 0x40, 0x5e, 0xb8,
+    0xf8, 0x01, 0x43, 0x54, 0xb4, 0xc7, 0x9a, 0xf7, 0xb1, 0xba, 0x03, 0x34, 0x87, 0x27, 0x0e, 0x1a,
+    0x39, 0xb4, 0x37, 0x70, 0xd8, 0xb8, 0x51, 0xc3, 0xc6, 0xb9, 0xc6, 0x0c, 0x1a, 0x32, 0x66, 0x78,
+    0x3f, 0x65, 0xc4, 0xe8, 0x84, 0x11, 0xe3, 0x05, 0x8c, 0x32, 0x17, 0x2f, 0x5a, 0xb8, 0x60, 0xd1,
+    0x82, 0x05, 0xa7, 0xe6, 0x0a, 0x4e, 0xfa, 0xc6, 0xae, 0xb8, 0x55, 0xd0, 0xd9, 0x14, 0x66, 0x14,
+    0x9b, 0x4a, 0x20, 0x50, 0x8c, 0xd9, 0x4f, 0x66, 0xe2, 0xc4, 0xe2, 0x59, 0x84, 0x09, 0x73, 0x89,
+    0xb3, 0xf6, 0x71, 0x04, 0x89, 0xf3, 0x88, 0x10, 0x22, 0xb4, 0x63, 0x75, 0x88, 0x27, 0x67, 0x99,
+    0x98, 0x1e, 0x38, 0x5c, 0x5a, 0x56, 0x62, 0xa0, 0x94, 0x6c, 0x64, 0x8c, 0x90, 0x55, 0x44, 0x34,
+    0x2c, 0x37, 0xed, 0xfa, 0x76, 0xbc, 0xc4, 0xb5, 0x85, 0x65, 0x0b, 0xa9, 0xa6, 0x9a, 0x96, 0x92,
+    0x86, 0x66, 0x41, 0x9b, 0x3c, 0x97, 0x3a, 0x35, 0xb7, 0x59, 0x10, 0x4b, 0x58, 0x35, 0xf6, 0x5f,
+    0x6b, 0x2e, 0x33, 0xb3, 0x54, 0x27, 0x55, 0x7f, 0xe5, 0xea, 0xab, 0x64, 0x91, 0xe6, 0x68, 0x71,
+    0x77, 0xbf, 0xc1, 0x36, 0xef, 0xdf, 0xd8, 0x5e, 0x2d, 0x0d, 0xed, 0xd3, 0xce, 0xd0, 0x8e, 0x9e,
+    0x3e, 0x2b, 0xaa, 0xc7, 0x72, 0xc4, 0x3a, 0xb7, 0xca, 0xb2, 0x38, 0x39, 0xaf, 0x98, 0xb2, 0x55,
+    0xb6, 0x93, 0xbd, 0x64, 0x54, 0x44, 0x54, 0x34, 0x44, 0x34, 0x94, 0xb4, 0x63, 0xeb, 0xd8, 0x76,
+    0x0e, 0x8e, 0x5d, 0xab, 0xd9, 0xc2, 0xba, 0xaa, 0x26, 0xcd, 0x6a, 0x1a, 0x32, 0xde, 0x2d, 0x5a,
+    0x76, 0xb2, 0x60, 0xf1, 0xd6, 0x53, 0x70, 0x1e, 0xa5, 0x2c, 0x51, 0x52, 0x23, 0xa9, 0x7b, 0xdc,
+    0xcf, 0xa3, 0x66, 0xaa, 0x6a, 0xfd, 0xdc, 0xd6, 0x25, 0xea, 0xcc, 0x67, 0x32, 0xff, 0x93, 0x9e,
+    0x1d, 0xad, 0x6d, 0xce, 0x21, 0x40, 0x4c, 0x51, 0xde, 0x04, 0x16, 0x15, 0x13, 0x15, 0x11, 0x13,
+    0x11, 0x77, 0xb2, 0x4e, 0x26, 0xd4, 0x09, 0xcd, 0x7e, 0xf0, 0x1f, 0xf0, 0xaa, 0x8b, 0xe3, 0x60,
+    0x4f, 0x2f, 0x4f, 0x0f, 0x2f, 0x0f, 0x4f, 0xcb, 0xa9, 0x7d, 0xa5, 0xbb, 0xdf, 0xd1, 0x22, 0xd8,
+    0xaa, 0xa5, 0xa1, 0x6d, 0xd3, 0x1e, 0x87, 0x2e, 0x03, 0xfb, 0xf2, 0xfa, 0xea, 0xea, 0x2a, 0x32,
+    0x22, 0x2a, 0x4a, 0x33, 0x44, 0x34, 0xa4, 0xfd, 0xf1, 0xf6, 0xf8, 0x68, 0x79, 0xb2, 0xe6, 0x9e,
+    0x1d, 0x1d, 0x9e, 0x7a, 0xe7, 0xff, 0x51, 0x07, 0x27, 0x87, 0x07, 0x8e, 0x95, 0xc8, 0xed, 0xfd,
+    0x5a, 0xaf, 0xcd, 0xfa, 0xec, 0xf5, 0xc6, 0x86, 0xd9, 0x3a, 0x57, 0xa6, 0x3a, 0x05, 0xfd, 0xad,
+    0xb6, 0x52, 0x9d, 0x44, 0x7f, 0x8a, 0x56, 0xa4, 0x7f, 0xa3, 0x35, 0x4b, 0xe3, 0x63, 0x45, 0x4b,
+    0x3f, 0x41, 0x0d, 0x73, 0x42, 0x9f, 0x6a, 0x9d, 0x60, 0x45, 0x99, 0x74, 0x7c, 0x6a, 0x61, 0xd8,
+    0x2f, 0x5c, 0x84, 0xb1, 0xa8, 0x5b, 0x74, 0xae, 0x50, 0xe2, 0xa9, 0x39, 0x3b, 0x99, 0x38, 0x85,
+    0x52, 0xac, 0x40, 0x52, 0x71, 0x4d, 0x41, 0x9f, 0x89, 0x48, 0x2c, 0x65, 0xbe, 0x65, 0xd9, 0x85,
+    0x6f, 0x65, 0x6c, 0x8d, 0x74, 0x2c, 0xfb, 0xf2, 0x33, 0x86, 0xdf, 0xdb, 0xfa, 0x4b, 0x3d, 0x7d,
+    0xcf, 0xe0, 0x5b, 0xf5, 0xb4, 0x78, 0x4a, 0x55, 0xc8, 0xd4, 0xfd, 0x9b, 0xbd, 0x19, 0x19, 0xfd,
+    0xa6, 0xab, 0x75, 0x4b, 0x4b, 0x95, 0x6d, 0x5a, 0x72, 0xfa, 0x1d, 0xa6, 0xa6, 0x9a, 0x69, 0x48,
+    0x69, 0x89, 0x56, 0x0a, 0xd0, 0xb4, 0xc5, 0x69, 0xd2, 0x6e, 0x5f, 0x1b, 0x94, 0xbd, 0xde, 0x40,
+    0x76, 0xd3, 0x4f, 0x51, 0x4e, 0x6a, 0x4d, 0x57, 0xb9, 0xbe, 0xbd, 0xd9, 0xb4, 0x5a, 0x8f, 0x91,
+    0x11, 0x11, 0xd1, 0x90, 0x8f, 0xbd, 0x93, 0x63, 0xe3, 0x64, 0xeb, 0x25, 0x49, 0x6e, 0x24, 0x48,
+    0x9f, 0x46, 0x39, 0x99, 0xf7, 0xe2, 0x62, 0x62, 0x22, 0x22, 0x76, 0xdf, 0x75, 0x9d, 0x90, 0xde,
+    0xdb, 0xcb, 0xfb, 0xbc, 0xaa, 0x1b, 0x4f, 0x0a, 0xe7, 0x69, 0xcb, 0xa4, 0x6d, 0x43, 0x43, 0x22,
+    0x02, 0xd2, 0xd6, 0x57, 0xfa, 0xd1, 0xc0, 0xc0, 0xbc, 0xbc, 0xba, 0x68, 0x9c, 0xd7, 0x6a, 0x69,
+    0x2c, 0x0f, 0xbb, 0x44, 0x6d, 0xa6, 0xff, 0xed, 0x9a, 0xbe, 0xd2, 0xdf, 0x7a, 0x14, 0x6c, 0x58,
+    0xd7, 0x98, 0x59, 0x57, 0xd5, 0xa4, 0x59, 0x15, 0xa0, 0xaa, 0x74, 0xe6, 0xa9, 0xcc, 0x99, 0x51,
+    0x33, 0x65, 0x84, 0x9c, 0xc9, 0xfc, 0xf8, 0x32, 0x46, 0xcc, 0x97, 0x77, 0xa3, 0xc3, 0xe8, 0x80,
+    0xc9, 0xa2, 0x25, 0x8b, 0x17, 0xaf, 0x97, 0xa7, 0x2e, 0x5c, 0xb8, 0xfc, 0x16, 0x2d, 0x69, 0xb0,
+    0x60, 0x49, 0x6d, 0x72, 0x25, 0xd5, 0x6c, 0xe5, 0x8a, 0xd2, 0x63, 0x95, 0x29, 0x54, 0xce, 0x53,
+    0xa4, 0x44, 0xf1, 0xa2, 0x42, 0xb1, 0xac, 0xa4, 0x94, 0xac, 0x90, 0x5d, 0x4c, 0x34, 0xdc, 0x96,
+    0xc9, 0x79, 0x96, 0x8b, 0xfb, 0xf5, 0x35, 0xc8, 0xee, 0xe1, 0xd5, 0x95, 0x65, 0xc7, 0xc2, 0xbe,
+    0xba, 0xb6, 0xb2, 0x59, 0x56, 0x55, 0xf5, 0x53, 0xf6, 0xca, 0x29, 0x92, 0x23, 0x44, 0x4a, 0x85,
+    0x64, 0x6b, 0xcc, 0xf8, 0x8c, 0xf1, 0x62, 0x53, 0x73, 0x32, 0x32, 0x6b, 0x3e, 0x1c, 0x6f, 0x05,
+    0x03, 0xff, 0xf8, 0xb2, 0x76, 0x67, 0x5c, 0x56, 0x50, 0xb4, 0x90, 0x1b, 0x34, 0x5f, 0xbe, 0x89,
+    0x81, 0x2a, 0x2a, 0x02, 0xd9, 0x29, 0xa9, 0x28, 0xa8, 0xa6, 0x01, 0x4f, 0x5b, 0x01, 0x4b, 0x4e,
+    0x05, 0xea, 0xc5, 0x45, 0x26, 0x3f, 0x4b, 0x98, 0x28, 0x99, 0xa2, 0x97, 0xbc, 0x0e, 0x91, 0x12,
+    0xcc, 0x24, 0xa6, 0x48, 0x80, 0x58, 0x9a, 0x56, 0x1e, 0xb9, 0x60, 0x64, 0x74, 0xb2, 0x88, 0x0d,
+    0x1b, 0x44, 0x2a, 0x87, 0x10, 0x29, 0x1d, 0x42, 0x5a, 0x2a, 0x84, 0x54, 0x48, 0x87, 0x51, 0x20,
+    0x41, 0x80, 0x54, 0xfe, 0xf0, 0x21, 0xea, 0x83, 0x47, 0x8f, 0x50, 0x1e, 0x3b, 0x74, 0x84, 0x3a,
+    0xee, 0xb8, 0x04, 0xc5, 0x91, 0xe3, 0x51, 0x04, 0x8e, 0xc9, 0x1b, 0x35, 0x6c, 0xd4, 0xa0, 0x61,
+    0x03, 0x05, 0xa4, 0x26, 0x8d, 0xcd, 0x4d, 0x19, 0x33, 0x3e, 0x65, 0xc4, 0xf0, 0x7c, 0xf1, 0x31,
+    0x50, 0x6c, 0xa2, 0xd0, 0xdc, 0xd4, 0xc4, 0x3c, 0x21, 0xe2, 0x6c, 0xc2, 0x4c, 0xa2, 0x84, 0x28,
+    0xd1, 0x08, 0xcc, 0xcc, 0x10, 0x20, 0x3a, 0x58, 0x7e, 0xf0, 0x70, 0x79, 0x81, 0xc3, 0xcf, 0x86,
+    0x4a, 0x4b, 0x0d, 0x19, 0x26, 0x2f, 0x60, 0x18, 0xa2, 0x94, 0x0c, 0x9a, 0x93, 0x84, 0x84, 0xb4,
+    0x10, 0x69, 0xa1, 0x02, 0x05, 0x48, 0x0a, 0x8f, 0x90, 0xde, 0x47, 0xc7, 0x09, 0x8d, 0x8c, 0x8c,
+    0x66, 0xa0, 0x22, 0xb3, 0x56, 0x02, 0xa3, 0x84, 0x08, 0x8c, 0x47, 0x11, 0x14, 0x17, 0x15, 0x13,
+    0x17, 0x21, 0x24, 0xde, 0x60, 0xc4, 0x43, 0xc4, 0xf2, 0xa1, 0x91, 0x61, 0xb9, 0x70, 0x27, 0x83,
+    0x75, 0x08, 0x84, 0x7a, 0x98, 0x70, 0x6e, 0x1c, 0x16, 0x0f, 0x0a, 0x92, 0x05, 0xbf, 0x60, 0x6e,
+    0x12, 0xfe, 0xed, 0x76, 0xbd, 0x81, 0x77, 0x27, 0x03, 0xc0, 0x9c, 0xdb, 0xe5, 0xfe, 0x75, 0xf1,
+    0xbf, 0x07, 0xb8, 0x0a, 0xa1, 0x07, 0x7e, 0x73, 0x0e, 0xfc, 0xfa, 0x1c, 0x04, 0xf1, 0x31, 0x68,
+    0xf0, 0xaf, 0xb7, 0x87, 0x97, 0x27, 0x7a, 0x57, 0x47, 0x27, 0x02, 0xb3, 0xc3, 0x65, 0xe5, 0xe4,
+    0x16, 0xc2, 0xcf, 0x25, 0x1d, 0x19, 0x15, 0x11, 0x0d, 0x09, 0x65, 0x83, 0x80, 0x7e, 0xb6, 0x01,
+    0x90, 0xea, 0xb8, 0xb4, 0xb8, 0x1b, 0x01, 0xdc, 0x1b, 0x1c, 0x8c, 0xb7, 0x04, 0x6e, 0x69, 0x6c,
+    0x6d, 0x3b, 0x6c, 0x3c, 0x6b, 0x6a, 0x6e, 0x6a, 0x68, 0x08, 0xc2, 0xb0, 0xd0, 0xc4, 0xc4, 0x58,
+    0xcd, 0xce, 0x38, 0xc9, 0xca, 0x46, 0x7b, 0xc6, 0xc2, 0xc4, 0xc2, 0xc0, 0xc4, 0x74, 0xc0, 0x6e,
+    0x2c, 0xaf, 0x37, 0x5d, 0x5e, 0x9e, 0x5b, 0x5c, 0xe6, 0x03, 0x5a, 0x8e, 0x07, 0x76, 0xb2, 0xae,
+    0xb0, 0xae, 0xfe, 0xb1, 0x56, 0xad, 0xfe, 0xd3, 0x00, 0xa8, 0xe9, 0xe1, 0xd9, 0xd9, 0xea, 0xe4,
+    0x64, 0xbb, 0x70, 0xde, 0x87, 0xcb, 0xcb, 0xcd, 0x14, 0x2a, 0x4f, 0x8c, 0xa8, 0x48, 0x81, 0x32,
+    0xc5, 0xeb, 0x14, 0x45, 0x8a, 0x76, 0x45, 0x69, 0x94, 0x9b, 0x14, 0xca, 0x13, 0x53, 0xd3, 0x53,
+    0xd4, 0x26, 0xa8, 0x4e, 0x4e, 0xcf, 0x4e, 0x98, 0x34, 0x61, 0xa2, 0x64, 0x09, 0x92, 0x25, 0x49,
+    0x94, 0x78, 0x41, 0x93, 0x20, 0x39, 0x62, 0x7a, 0xc4, 0x88, 0xa9, 0x91, 0x9b, 0x48, 0x91, 0xd2,
+    0x22, 0x43, 0x88, 0x9c, 0x87, 0x90, 0x96, 0x8e, 0x0a, 0x09, 0x32, 0x1a, 0xe4, 0x07, 0x10, 0x51,
+    0x20, 0x3e, 0x7e, 0xf8, 0xe8, 0xc1, 0x2a, 0xca, 0xa3, 0x07, 0x8f, 0x1d, 0xa1, 0xa0, 0xa1, 0x3a,
+    0x76, 0x9c, 0x75, 0xe4, 0xc0, 0x01, 0x7a, 0x03, 0x87, 0x8d, 0x1b, 0x36, 0x68, 0xd4, 0x90, 0x51,
+    0x63, 0x06, 0x8d, 0x19, 0x9f, 0x5b, 0x64, 0x78, 0x7e, 0x7a, 0xc2, 0x88, 0xe1, 0x22, 0xc6, 0x0b,
+    0x18, 0xe7, 0x17, 0x2d, 0x58, 0xb8, 0xe8, 0x64, 0xc1, 0xd9, 0xc9, 0xa9, 0x62, 0xc5, 0xe6, 0x8a,
+    0x14, 0x2a, 0x4c, 0x53, 0x78, 0x37, 0x1f, 0x85, 0xe6, 0x89, 0xcc, 0x13, 0x26, 0x30, 0x4d, 0x9c,
+    0x39, 0x9c, 0x4b, 0x5c, 0x96, 0x20, 0x61, 0x49, 0x62, 0x44, 0xe5, 0x88, 0x4c, 0x4c, 0x0f, 0x1c,
+    0x2e, 0x2d, 0x2b, 0x31, 0x50, 0x4a, 0x8a, 0x08, 0x91, 0x19, 0x02, 0x04, 0x26, 0x88, 0x0f, 0x1e,
+    0x3e, 0x74, 0xe0, 0xd0, 0x61, 0xc3, 0xe5, 0x06, 0x0d, 0x96, 0x1a, 0x32, 0x54, 0x66, 0xd0, 0x81,
+    0xe1, 0x02, 0x65, 0xe7, 0x85, 0x49, 0xc9, 0x49, 0x25, 0x0b, 0xa5, 0x8d, 0x16, 0xee, 0x0a, 0xa4,
+    0x8c, 0x15, 0xb4, 0x91, 0xa0, 0x8a, 0x91, 0x90, 0xaa, 0x88, 0x90, 0x14, 0x52, 0x0d, 0x29, 0x3c,
+    0x3e, 0x36, 0x32, 0x46, 0x50, 0x44, 0x34, 0x2c, 0xef, 0x7a, 0x81, 0x09, 0xf5, 0xf3, 0xfc, 0x97,
+    0x63, 0x63, 0xa9, 0xa3, 0x99, 0x91, 0xd4, 0xac, 0x95, 0x10, 0x21, 0x54, 0xc2, 0xbd, 0xa8, 0x08,
+    0xba, 0x98, 0x88, 0xa8, 0x9a, 0x78, 0x68, 0x98, 0x7a, 0x58, 0x58, 0x36, 0x2d, 0x64, 0xb2, 0x77,
+    0xb2, 0xae, 0x49, 0x26, 0x1c, 0x83, 0x20, 0x14, 0xff, 0x87, 0xc5, 0x61, 0x5b, 0x0c, 0x1e, 0xe4,
+    0x14, 0x04, 0x0b, 0xfe, 0x53, 0x41, 0x50, 0xfd, 0x42, 0x08, 0xfc, 0x56, 0x05, 0x7a, 0x53, 0x01,
+    0xbd, 0x39, 0x60, 0x37, 0xe7, 0x9a, 0xfe, 0x71, 0xf1, 0x3f, 0x51, 0xfc, 0x81, 0x4d, 0xe5, 0xc0,
+    0xcf, 0xaf, 0x41, 0x9f, 0x03, 0xbe, 0xbe, 0x54, 0x3e, 0x06, 0x7b, 0x76, 0x0b, 0x80, 0x38, 0xea,
+    0xed, 0xe5, 0xe1, 0xe9, 0x89, 0xde, 0xe1, 0xa5, 0xde, 0x7d, 0x64, 0x9d, 0x1d, 0x5d, 0x9d, 0x2a,
+    0xdd, 0x76, 0x2e, 0x55, 0x6e, 0x4e, 0x81, 0x5c, 0x9c, 0x82, 0xb8, 0xb7, 0x5a, 0xb0, 0xfc, 0x96,
+    0xa6, 0x25, 0x27, 0xa7, 0xba, 0xba, 0xc8, 0x48, 0x0f, 0x4f, 0x15, 0x02, 0x93, 0xea, 0x43, 0x07,
+    0x0f, 0x1d, 0x38, 0x78, 0xd8, 0xc0, 0xc1, 0xb2, 0x92, 0x52, 0xb2, 0xc2, 0x86, 0x4b, 0x4b, 0x0d,
+    0x97, 0x67, 0x0d, 0x19, 0x2a, 0x33, 0x60, 0xa0, 0xbc, 0x80, 0xe1, 0xc2, 0xa4, 0x24, 0xdf, 0xa4,
+    0x85, 0x0a, 0x82, 0x16, 0x20, 0x23, 0x21, 0x29, 0x44, 0x3e, 0x52, 0x98, 0xf0, 0x38, 0x41, 0xeb,
+    0xe8, 0x78, 0x6e, 0x74, 0x6c, 0xfc, 0x77, 0x64, 0x34, 0x2f, 0x26, 0x1a, 0x96, 0xc9, 0x8c, 0x12,
+    0x16, 0x23, 0x48, 0x90, 0x8a, 0xa0, 0x98, 0xa8, 0x88, 0x68, 0x78, 0x88, 0x78, 0x58, 0x58, 0xe6,
+    0x2b, 0xdc, 0xc9, 0x82, 0xbb, 0x4e, 0x45, 0xa8, 0x13, 0x8e, 0x75, 0xf1, 0x38, 0x50, 0x1c, 0x86,
+    0xe4, 0x42, 0x47, 0x07, 0x1e, 0x3c, 0x0f, 0xee, 0x81, 0x21, 0x08, 0x9e, 0x05, 0xf1, 0x20, 0x04,
+    0x7e, 0xcf, 0xdf, 0xba, 0xc0, 0x9c, 0x8b, 0xfb, 0xf5, 0x35, 0xd8, 0xc3, 0xab, 0xf3, 0x02, 0xe6,
+    0x80, 0x5d, 0x6e, 0xf7, 0x0f, 0xff, 0x7b, 0xe0, 0xf7, 0xc0, 0x41, 0x9f, 0x03, 0xbe, 0x06, 0x7c,
+    0x0c, 0xf6, 0x16, 0x30, 0x90, 0x5a, 0xa0, 0x87, 0x97, 0xa7, 0x17, 0x95, 0x77, 0x57, 0x67, 0x77,
+    0x07, 0x65, 0x37, 0x47, 0x37, 0x27, 0x47, 0xb7, 0xaa, 0xa0, 0x4d, 0xee, 0xed, 0x2d, 0x4e, 0x01,
+    0x5c, 0x9c, 0x19, 0x2e, 0xc1, 0x5b, 0x02, 0xb7, 0xb7, 0x36, 0xb7, 0x36, 0xaa, 0x35, 0x36, 0xb6,
+    0x35, 0x35, 0x04, 0x08, 0xd4, 0xd0, 0xd2, 0xd2, 0xaa, 0xd0, 0xca, 0xc6, 0xc2, 0xbe, 0xba, 0xb6,
+    0xb2, 0xac, 0x90, 0xce, 0xea, 0xdf, 0xf9, 0x2f, 0xb3, 0xb2, 0x27, 0xb3, 0x9b, 0x6c, 0xec, 0x94,
+    0x4c, 0x2c, 0x6c, 0x2c, 0x06, 0xf6, 0x75, 0x05, 0xcc, 0xab, 0x8b, 0xcb, 0x8b, 0x6b, 0x2b, 0x92,
+    0x4b, 0x2b, 0xeb, 0x80, 0x96, 0xd4, 0x01, 0x2c, 0xab, 0x2b, 0xac, 0xa8, 0x2b, 0x03, 0x55, 0x05,
+    0x0c, 0x40, 0x15, 0x20, 0x40, 0x45, 0x60, 0x8a, 0x6a, 0x4a, 0x2a, 0xea, 0x89, 0x0c, 0x2a, 0xea,
+    0xdf, 0x40, 0xd9, 0x0d, 0x10, 0xc0, 0x25, 0x29, 0xa9, 0xc9, 0xc9, 0x89, 0x69, 0xa9, 0xe9, 0x70,
+    0xc9, 0x4a, 0x09, 0x29, 0x09, 0x29, 0xe9, 0x68, 0x0c, 0x11, 0x51, 0x91, 0xd1, 0xd9, 0xa8, 0x68,
+    0x88, 0x68, 0x48, 0x88, 0x48, 0x08, 0x28, 0xe8, 0x1c, 0x04, 0x14, 0xe0, 0xe7, 0xfc, 0x13, 0xc0,
+    0x07, 0xc0, 0x19, 0x80, 0x4f, 0xcf, 0x18, 0x9d, 0x1d, 0x9e, 0x29, 0x9e, 0xb3, 0x9d, 0x1c, 0x9d,
+    0x1c, 0x1d, 0x9c, 0x5b, 0xbb, 0x95, 0xda, 0x9e, 0x6a, 0xef, 0x6c, 0x54, 0x76, 0x7c, 0x5f, 0xb1,
+    0x50, 0x58, 0xae, 0x2b, 0x9a, 0xff, 0xb7, 0xff, 0xeb, 0x29, 0xba, 0xf5, 0x5b, 0xdf, 0xd4, 0x4f,
+    0xe0, 0x4d, 0x1b, 0x37, 0x52, 0x6e, 0xd8, 0xb4, 0x91, 0x62, 0xc3, 0xba, 0x66, 0x8d, 0x1a, 0x56,
+    0x35, 0x69, 0x56, 0xcf, 0xab, 0xaa, 0x69, 0xbc, 0x50, 0xaa, 0x67, 0xd0, 0x9c, 0x31, 0x83, 0xa6,
+    0x8c, 0x99, 0x4e, 0x32, 0x65, 0x46, 0xc9, 0x88, 0xe9, 0x11, 0x13, 0x66, 0x0c, 0x98, 0x30, 0x93,
+    0x60, 0xbc, 0x7c, 0xf1, 0x72, 0xd8, 0x65, 0x4b, 0x2d, 0x60, 0x8b, 0x16, 0x2e, 0xab, 0x59, 0xb4,
+    0x5c, 0xc9, 0x82, 0xe5, 0x4a, 0x66, 0x2a, 0x16, 0xae, 0x54, 0x2a, 0x54, 0xac, 0xbc, 0x59, 0x15,
+    0x2b, 0x40, 0x4e, 0xab, 0x4c, 0xa1, 0x32, 0x45, 0x0a, 0x95, 0x28, 0x52, 0xa2, 0x40, 0x39, 0x7d,
+    0x82, 0x0a, 0x05, 0x15, 0x14, 0xb4, 0x09, 0x93, 0x26, 0x4c, 0x96, 0x34, 0x51, 0xb2, 0x04, 0xc9,
+    0x11, 0x22, 0xa5, 0x42, 0x94, 0x24, 0x41, 0x62, 0x4e, 0x62, 0x7a, 0x64, 0x6c, 0x6a, 0x84, 0x48,
+    0x11, 0x23, 0x51, 0x45, 0x86, 0x94, 0xf2, 0x0d, 0x21, 0x15, 0x22, 0x48, 0x3a, 0x6a, 0x0e, 0x32,
+    0x7a, 0x96, 0x0a, 0xf2, 0xc3, 0xc7, 0x0f, 0x1f, 0xa2, 0x3f, 0x7a, 0xf0, 0x10, 0xdd, 0x9c, 0xec,
+    0xf1, 0x1f, 0xca, 0x63, 0x47, 0xa8, 0x59, 0x47, 0x8e, 0x1c, 0x38, 0x40, 0x6f, 0xe0, 0xa8, 0xf1,
+    0x19, 0xc3, 0xe7, 0xc6, 0xfd, 0x65, 0xa3, 0x86, 0xd9, 0x06, 0x8d, 0x19, 0x63, 0x1a, 0x32, 0x3e,
+    0x35, 0x65, 0x68, 0x3d, 0x63, 0xf0, 0x79, 0xc2, 0x78, 0x21, 0x08, 0xc3, 0x85, 0xe6, 0xa6, 0x0b,
+    0x15, 0x2d, 0x58, 0xb4, 0xf0, 0xb2, 0xe8, 0x54, 0xc1, 0xb9, 0xb9, 0x82, 0xf3, 0x1c, 0xb5, 0x22,
+    0x45, 0x67, 0x0a, 0x14, 0x2a, 0x26, 0x51, 0x54, 0x56, 0x96, 0x28, 0x71, 0xe2, 0x6c, 0xe2, 0x84,
+    0xd9, 0x04, 0x89, 0x12, 0x24, 0x46, 0x94, 0x10, 0x31, 0x22, 0x44, 0xa6, 0x88, 0x4c, 0x4c, 0x4c,
+    0x10, 0x1f, 0x30, 0x3f, 0x78, 0xc0, 0xec, 0xe0, 0xe1, 0xcc, 0xa1, 0x03, 0x87, 0x4b, 0x27, 0x0d,
+    0x97, 0x1a, 0x2c, 0x2f, 0xdf, 0x92, 0x2a, 0x03, 0x06, 0x0c, 0x17, 0x2a, 0x23, 0x2f, 0x50, 0x4e,
+    0x4a, 0x46, 0x5a, 0x90, 0xe4, 0x04, 0xac, 0x60, 0xa1, 0x02, 0x85, 0x3a, 0x4c, 0xe1, 0x11, 0x72,
+    0x75, 0xc2, 0xa3, 0x8a, 0x09, 0x8e, 0xe6, 0x46, 0x47, 0xa9, 0x46, 0xc6, 0x43, 0x09, 0x8c, 0x11,
+    0x16, 0x25, 0x44, 0x30, 0x1c, 0x17, 0x1a, 0x96, 0xf7, 0xc2, 0xb2, 0x58, 0x30, 0x2c, 0xee, 0x1c,
+    0x04, 0x87, 0xc1, 0x55, 0x7f, 0x10, 0xbe, 0x81, 0x55, 0xdf, 0xdb, 0xfb, 0x07, 0x98, 0x7b, 0x39,
+    0xbb, 0xdc, 0x5c, 0x3b, 0x6a, 0xc7, 0xc5, 0xf9, 0xc8, 0x1e, 0xe0, 0x7e, 0x0f, 0x1c, 0xf4, 0xf9,
+    0xf5, 0x35, 0xb0, 0x63, 0xd0, 0x00, 0x6f, 0xc1, 0x1e, 0x83, 0xec, 0xd9, 0x02, 0x3a, 0xba, 0xff,
+    0xba, 0x9f, 0xe3, 0x92, 0x53, 0x70, 0x16, 0xe7, 0xa6, 0x40, 0x07, 0x5c, 0xdc, 0x1b, 0xdc, 0x80,
+    0xb7, 0x2f, 0x09, 0xda, 0xd8, 0xdc, 0xa0, 0xda, 0xd8, 0xb2, 0x6b, 0x66, 0x65, 0x64, 0x66, 0x42,
+    0x64, 0x63, 0x5c, 0x62, 0x63, 0x61, 0x59, 0x30, 0x31, 0xab, 0xb0, 0x2d, 0x2b, 0x2d, 0xac, 0x2d,
+    0xf3, 0x01, 0x2d, 0xb3, 0x03, 0x8f, 0x42, 0x59, 0xff, 0x58, 0x4d, 0xae, 0x94, 0x0c, 0x54, 0x19,
+    0x28, 0x40, 0x57, 0x51, 0x41, 0x11, 0xa0, 0xa1, 0xa6, 0xa4, 0xa2, 0x98, 0x9a, 0x98, 0xfe, 0x7f,
+    0x80, 0x9b, 0x27, 0x5a, 0xc0, 0x3b, 0x35, 0xa5, 0xa1, 0x97, 0xfe, 0x85, 0x92, 0x94, 0x90, 0x92,
+    0x8e, 0x8c, 0x90, 0x8e, 0xdc, 0x04, 0x01, 0x01, 0xf0, 0x09, 0x80, 0x06, 0x40, 0x1b, 0x34, 0x6c,
+    0xda, 0x0c, 0x08, 0x8d, 0x5f, 0xa8, 0x44, 0xa4, 0x7b, 0xa4, 0x99, 0x01, 0x02, 0x10, 0x08, 0xa0,
+    0x01, 0x93, 0xa9, 0x19, 0x86, 0x67, 0x71, 0x98, 0x42, 0x2b, 0x00, 0xc4, 0x2c, 0xa1, 0x41, 0x01,
+    0x2e, 0x33, 0x28, 0x7c, 0x05, 0x00, 0x38, 0x10, 0x46, 0xd1, 0x02, 0xc7, 0x01, 0x29, 0x23, 0xb4,
+    0xe3, 0xb8, 0xeb, 0x55, 0x2c, 0x2d, 0x67, 0x53, 0x57, 0x69, 0xd6, 0x0c, 0x0a, 0xac, 0x16, 0x56,
+    0x3b, 0x52, 0x7f, 0x68, 0xf3, 0xaf, 0x82, 0xa9, 0xd3, 0x31, 0xb1, 0xc7, 0xf2, 0x9a, 0xf4, 0x58,
+    0xd3, 0xc3, 0xa7, 0xb7, 0x72, 0x36, 0xde, 0x20, 0x76, 0x67, 0xfa, 0xfd, 0xd7, 0x31, 0x6b, 0xce,
+    0xaf, 0x1b, 0x3b, 0x36, 0xb1, 0xed, 0x07, 0x23, 0xba, 0xae, 0x04, 0x3e, 0x58, 0xa5, 0xcd, 0xac,
+    0x47, 0xd2, 0x38, 0xc5, 0xd2, 0xa1, 0x8d, 0x88, 0x62, 0x6f, 0x5f, 0x4d, 0x82, 0xc9, 0xee, 0x11,
+    0x6b, 0x82, 0x57, 0x62, 0x1d, 0xfb, 0xbe, 0xe5, 0x5a, 0x9f, 0xd4, 0x4a, 0x7a, 0xfc, 0x1f, 0xdb,
+    0xe3, 0x47, 0xe0, 0x1f, 0xf8, 0x8e, 0x58, 0xcc, 0x1a, 0xdb, 0x07, 0xd0, 0xc4, 0xa7, 0x3f, 0xa6,
+    0xeb, 0xbf, 0x1a, 0xdb, 0x8a, 0x1b, 0x57, 0x95, 0x59, 0xf6, 0xf3, 0x79, 0x05, 0xfa, 0xf8, 0x67,
+    0x1f, 0x4c, 0x19, 0x5a, 0xdb, 0xda, 0xbf, 0xce, 0xaf, 0x31, 0xe3, 0xce, 0xa7, 0xf9, 0xa6, 0x07,
+    0x42, 0x0f, 0x45, 0xcd, 0xbf, 0x76, 0xb7, 0xf0, 0x9a, 0x33, 0xdc, 0x2d, 0xbe, 0xf8, 0x9f, 0x91,
+    0x54, 0x3e, 0x3e, 0x55, 0xf5, 0xf5, 0xb6, 0x90, 0x6f, 0x03, 0x36, 0x4d, 0x8c, 0x33, 0xe7, 0x94,
+    0xc6, 0xfc, 0x6a, 0x1f, 0x40, 0x5c, 0xc2, 0x63, 0x60, 0x17, 0x50, 0x45, 0x7f, 0x7f, 0xef, 0xde,
+    0xcb, 0xb8, 0x7d, 0x34, 0x79, 0xef, 0xd0, 0xbc, 0x1d, 0xdb, 0x4e, 0xaf, 0x11, 0x5d, 0x79, 0xb5,
+    0xfb, 0x57, 0xdd, 0xc3, 0xaf, 0x4f, 0x8f, 0xd4, 0x4d, 0x85, 0x73, 0x3e, 0x98, 0xce, 0x35, 0xde,
+    0x54, 0x4f, 0x95, 0xa5, 0x19, 0xba, 0x3d, 0x9a, 0xe1, 0xa3, 0x7e, 0x56, 0x85, 0x1b, 0xd0, 0x56,
+    0x40, 0x07, 0x1f, 0x00, 0xfc, 0xa3, 0xd4, 0xbb, 0x77, 0x81, 0xf7, 0x45, 0x75, 0x04, 0x14, 0x07,
+    0x6c, 0xbf, 0x64, 0xcd, 0x0e, 0x94, 0x19, 0x77, 0xaf, 0xb4, 0x43, 0x69, 0x87, 0xa8, 0x41, 0xec,
+    0x90, 0x74, 0x9d, 0xe6, 0x51, 0xa6, 0x7a, 0x23, 0xfd, 0x21, 0x06, 0xff, 0x04, 0x5c, 0xec, 0x0e,
+    0x92, 0x87, 0x19, 0xb9, 0xb2, 0x53, 0xde, 0xdd, 0xcc, 0xb8, 0x50, 0xc8, 0x6f, 0xf9, 0xcc, 0x3d,
+    0x41, 0x2e, 0xd6, 0x63, 0x91, 0x43, 0xf9, 0x00, 0x4b, 0x30, 0x9e, 0xd6, 0x10, 0xb6, 0xa7, 0xb5,
+    0x53, 0xbb, 0x62, 0xb9, 0x37, 0x12, 0xba, 0x65, 0xbf, 0xb9, 0xb8, 0x98, 0x8a, 0xf6, 0x77, 0xfb,
+    0x83, 0xc3, 0x47, 0x7d, 0x86, 0x8e, 0xc6, 0xb5, 0x8e, 0xbe, 0xa2, 0x91, 0x0c, 0x28, 0x85, 0x73,
+    0x2b, 0xb4, 0x69, 0x8c, 0x72, 0xa9, 0xe5, 0x57, 0x6e, 0xd3, 0x8f, 0x01, 0xd1, 0xbe, 0xdd, 0x67,
+    0x79, 0xd2, 0x16, 0x07, 0x51, 0x8e, 0x7d, 0xee, 0x5d, 0xb1, 0xb1, 0xb2, 0xb7, 0xe6, 0x9e, 0xd9,
+    0xc6, 0xef, 0x2c, 0x12, 0xc2, 0x7d, 0xd3, 0xef, 0x32, 0x98, 0x73, 0x78, 0x38, 0x40, 0x31, 0xf9,
+    0x7f, 0xce, 0x5e, 0xfb, 0x74, 0x11, 0x6b, 0x4b, 0x78, 0x4e, 0xb5, 0x45, 0x36, 0x3b, 0x33, 0x3f,
+    0xde, 0x4a, 0x65, 0x32, 0x0d, 0x37, 0x39, 0x75, 0x6f, 0x4f, 0x07, 0x01, 0x0d, 0x6f, 0x5b, 0xd3,
+    0x2d, 0x74, 0x69, 0xe6, 0xcb, 0xbf, 0x95, 0x0c, 0x70, 0xb3, 0xf2, 0x85, 0xf4, 0x11, 0x7d, 0x24,
+    0x38, 0xba, 0xf0, 0x8d, 0xc9, 0x31, 0xbc, 0x79, 0xa0, 0x63, 0x31, 0x09, 0xaf, 0x2a, 0xf0, 0x3b,
+    0xfd, 0x5f, 0xb2, 0x9d, 0x19, 0xd4, 0xf7, 0xe3, 0x0f, 0x6d, 0x59, 0xab, 0x40, 0x61, 0xf0, 0x3d,
+    0x87, 0xf1, 0x35, 0xd6, 0x33, 0x4d, 0xfa, 0x74, 0xfa, 0xa0, 0x03, 0xbf, 0x59, 0x77, 0x75, 0x1b,
+    0x86, 0x0f, 0x46, 0xfe, 0x6e, 0x5c, 0x71, 0xa5, 0x17, 0x78, 0xac, 0x33, 0xcb, 0x5f, 0x42, 0xef,
+    0x93, 0x9b, 0x36, 0x7b, 0xce, 0x1e, 0x88, 0xb1, 0x34, 0x18, 0x24, 0xbf, 0xf5, 0x88, 0x5a, 0xab,
+    0xd8, 0x35, 0x22, 0x9f, 0xcd, 0x64, 0x2e, 0xf8, 0xd1, 0x9d, 0x98, 0x53, 0xb6, 0xa3, 0x4f, 0x0f,
+    0xc8, 0x78, 0x65, 0x10, 0xfe, 0xd9, 0x11, 0xde, 0xeb, 0x66, 0x81, 0xaf, 0x29, 0xd0, 0xef, 0xca,
+    0xb6, 0x62, 0x9c, 0xf8, 0x0f, 0xb6, 0xa8, 0x6e, 0x1c, 0x7c, 0x72, 0x23, 0xad, 0x99, 0x61, 0x37,
+    0xe7, 0x3e, 0x3c, 0x7b, 0x79, 0xd6, 0x4b, 0xf6, 0x4b, 0x39, 0xcf, 0x87, 0xc2, 0x6d, 0xfa, 0x61,
+    0x0c, 0xf4, 0xd5, 0xd8, 0xec, 0xbc, 0xf1, 0xdf, 0x4c, 0x86, 0x79, 0xbe, 0xdb, 0xbc, 0x8f, 0x63,
+    0xa5, 0x2a, 0xe5, 0x1c, 0xb7, 0xda, 0x1c, 0xc7, 0x34, 0x39, 0x62, 0x78, 0xc1, 0x9e, 0x90, 0x7f,
+    0xd0, 0xd0, 0x37, 0x6e, 0x2f, 0x32, 0xda, 0xd0, 0x18, 0xb1, 0xda, 0xf1, 0x2c, 0xd8, 0xdc, 0x73,
+    0x1d, 0xf4, 0xdf, 0x08, 0x6f, 0x2e, 0x58, 0x4e, 0x65, 0xa2, 0xaf, 0x27, 0xfd, 0x7e, 0x6f, 0xe5,
+    0x58, 0x88, 0x5c, 0xb8, 0x35, 0xd7, 0xa3, 0x08, 0xef, 0xeb, 0x0c, 0x6f, 0x1e, 0x1a, 0xfc, 0xc8,
+    0x40, 0x72, 0xfd, 0x6c, 0x66, 0x9d, 0x2b, 0x86, 0x77, 0x0a, 0x1b, 0xbc, 0x59, 0x28, 0xe8, 0x5c,
+    0xce, 0xeb, 0xe3, 0x9d, 0xd8, 0x2a, 0x30, 0x03, 0xf1, 0x6b, 0xc7, 0x90, 0x5b, 0xe5, 0xdc, 0x60,
+    0xfa, 0xc1, 0x25, 0xde, 0x4f, 0xff, 0xb9, 0xb5, 0xe6, 0xae, 0xd6, 0x41, 0x68, 0x95, 0x4a, 0xe5,
+    0x99, 0xfa, 0xb4, 0x3a, 0xaf, 0x65, 0x07, 0xe3, 0xff, 0x2d, 0x60, 0xdd, 0x20, 0xc8, 0xda, 0x3d,
+    0x04, 0x0c, 0x59, 0x62, 0xbb, 0x16, 0x9d, 0x48, 0x91, 0x73, 0x2f, 0x18, 0x48, 0x5b, 0x38, 0xeb,
+    0xed, 0xe4, 0xf7, 0x8f, 0x00, 0xfa, 0xf2, 0x57, 0x8d, 0xdd, 0xf2, 0x33, 0x67, 0xc7, 0xe4, 0x62,
+    0x14, 0xf1, 0xcf, 0x4f, 0x44, 0x7e, 0x42, 0xeb, 0x39, 0x74, 0x48, 0x2f, 0xe6, 0x60, 0x9f, 0x0c,
+    0xee, 0x67, 0x83, 0x24, 0xdc, 0xb0, 0x7d, 0x3c, 0x74, 0xef, 0x86, 0x6c, 0xc8, 0x7e, 0xcf, 0xf8,
+    0x7f, 0x8c, 0x02, 0x1f, 0xa4, 0x9a, 0xe0, 0x5d, 0x90, 0x4b, 0x8a, 0xda, 0x79, 0xe4, 0x86, 0x38,
+    0xc3, 0x3d, 0x81, 0x1f, 0xb7, 0x9e, 0x7d, 0x9e, 0xb3, 0x03, 0xec, 0x3b, 0xf7, 0x5c, 0x8f, 0xfb,
+    0x29, 0xd6, 0x73, 0x0b, 0x9e, 0xf7, 0xd1, 0xb9, 0x33, 0x3e, 0x9c, 0xff, 0xe0, 0xf7, 0xff, 0xea,
+    0x69, 0x69, 0xf9, 0x7e, 0xfc, 0x37, 0xf8, 0xbd, 0x78, 0x85, 0xf7, 0x47, 0x3f, 0x2c, 0x7a, 0xec,
+    0x75, 0x1d, 0xf0, 0xbd, 0x95, 0xea, 0x4f, 0xa4, 0x4d, 0x18, 0xde, 0xd2, 0x65, 0x2e, 0x7e, 0xfe,
+    0xee, 0x2d, 0xb4, 0xf4, 0x59, 0xf5, 0xed, 0x90, 0x47, 0x97, 0x47, 0xf4, 0x6a, 0x25, 0x3a, 0x2b,
+    0x73, 0x8e, 0xe3, 0x49, 0x11, 0x4c, 0x16, 0xb2, 0x14, 0xc4, 0x48, 0xf2, 0xb8, 0x69, 0x49, 0xfa,
+    0xc9, 0x74, 0xdd, 0x2d, 0x0e, 0x60, 0x4c, 0x12, 0xb7, 0x9a, 0x22, 0x96, 0x93, 0xfe, 0x94, 0x85,
+    0x64, 0x98, 0xb4, 0xf0, 0xdb, 0x50, 0xf7, 0x9d, 0x5a, 0x3e, 0x67, 0xb3, 0xfd, 0x1b, 0xe1, 0xfd,
+    0xc4, 0x96, 0x6e, 0xb9, 0x4f, 0x02, 0x5d, 0x48, 0xc3, 0xc2, 0x3d, 0xfa, 0xc3, 0xb3, 0x50, 0x6b,
+    0x99, 0x5d, 0x25, 0xd3, 0xf6, 0xb9, 0xf8, 0xb0, 0x17, 0x89, 0x9e, 0xcb, 0xee, 0xc0, 0x27, 0xc7,
+    0xc0, 0xb1, 0x41, 0x3e, 0x5e, 0x02, 0x89, 0xcc, 0xd6, 0x4f, 0xd4, 0x23, 0xc3, 0xdd, 0x7f, 0x45,
+    0x91, 0x40, 0x4e, 0xbd, 0xd9, 0x68, 0xce, 0xd5, 0x4d, 0xdd, 0xbd, 0xae, 0xd2, 0x46, 0xc4, 0xa0,
+    0xf4, 0xce, 0x2f, 0xce, 0xeb, 0x0b, 0x85, 0xb3, 0x67, 0xbf, 0xf9, 0x43, 0x33, 0xff, 0x80, 0xf5,
+    0xcd, 0x19, 0x2c, 0x73, 0xc5, 0x8a, 0xb3, 0x74, 0xa5, 0x69, 0xd3, 0x1f, 0x42, 0xe5, 0xc3, 0x53,
+    0x92, 0x80, 0xd8, 0xe8, 0xb6, 0x0e, 0xfe, 0x30, 0x5a, 0xc4, 0xab, 0x63, 0xdf, 0x71, 0x31, 0x0c,
+    0x27, 0x10, 0xb4, 0xa6, 0xff, 0xe2, 0xd5, 0xf1, 0x87, 0xae, 0xa0, 0x41, 0xb7, 0x1c, 0x21, 0x6c,
+    0x80, 0xcd, 0xdc, 0xf0, 0xb4, 0x27, 0xf0, 0x91, 0xfa, 0x9e, 0x8f, 0x55, 0xfe, 0xa3, 0xff, 0x6e,
+    0x76, 0xd4, 0x7e, 0x3d, 0x8a, 0x87, 0x85, 0xc3, 0x46, 0xef, 0x8a, 0x5e, 0xd8, 0xc3, 0x91, 0x87,
+    0x9e, 0x7d, 0xd1, 0x59, 0x0c, 0x34, 0xbf, 0x83, 0x28, 0x3d, 0xe1, 0x07, 0xa0, 0x80, 0xef, 0x30,
+    0x16, 0xad, 0xfb, 0xce, 0xec, 0xef, 0x45, 0xf4, 0xbb, 0xb3, 0xa3, 0xf7, 0xff, 0xf2, 0x62, 0x0e,
+    0xd0, 0x29, 0x9d, 0xfe, 0xc5, 0x8d, 0x6b, 0xd7, 0x9e, 0x30, 0xb3, 0x36, 0x55, 0x16, 0x89, 0x1b,
+    0x84, 0x1d, 0xe4, 0xc6, 0x40, 0x87, 0x39, 0xee, 0x9a, 0x49, 0x82, 0xca, 0xbd, 0x9b, 0xfd, 0x87,
+    0x3f, 0x02, 0xea, 0xe2, 0x27, 0xbd, 0x31, 0x46, 0xef, 0xbd, 0xee, 0xfb, 0xce, 0xed, 0x35, 0xee,
+    0xa8, 0x53, 0x3d, 0x8c, 0x5e, 0x04, 0x2f, 0xfa, 0xe2, 0xa2, 0x3e, 0x4b, 0xef, 0xef, 0x45, 0xb1,
+    0xe3, 0x69, 0xbc, 0xb0, 0x86, 0xff, 0x53, 0xe4, 0x37, 0xe6, 0x0c, 0x8e, 0x3a, 0xf8, 0xe2, 0xd3,
+    0xfe, 0x41, 0x69, 0xff, 0x32, 0x0e, 0xc8, 0x7f, 0xd2, 0xdf, 0x27, 0x70, 0x68, 0xd0, 0xe5, 0xcc,
+    0xbd, 0xa3, 0xdd, 0x14, 0xf5, 0x49, 0x1b, 0x30, 0x1b, 0x5e, 0x1a, 0x0a, 0x17, 0xc4, 0x64, 0x0d,
+    0xb4, 0xb6, 0x27, 0xe8, 0x13, 0x67, 0x2c, 0x2d, 0xc9, 0x0b, 0xff, 0xa2, 0xaf, 0x61, 0x8d, 0xb4,
+    0x9b, 0xf7, 0x38, 0x1b, 0x72, 0x9f, 0x47, 0x6d, 0x71, 0xe9, 0x3b, 0xc9, 0xff, 0xb2, 0x4f, 0x0c,
+    0xda, 0xae, 0x89, 0x8f, 0x80, 0xb3, 0x94, 0xdf, 0x67, 0xce, 0x6d, 0x62, 0x53, 0x48, 0x3b, 0x6c,
+    0xb5, 0x7e, 0x60, 0x71, 0x01, 0xe7, 0x7c, 0x89, 0x5f, 0x20, 0xce, 0x71, 0x69, 0xcb, 0x36, 0x46,
+    0x49, 0xd4, 0x09, 0x86, 0x33, 0xa5, 0x65, 0x9c, 0x16, 0xce, 0xdd, 0x44, 0x7e, 0x17, 0x50, 0x97,
+    0x46, 0xbe, 0xd8, 0xd8, 0xaf, 0x4c, 0xe4, 0x6f, 0x1b, 0xdb, 0x37, 0x19, 0x77, 0x95, 0xa3, 0xd0,
+    0xe7, 0xb1, 0xba, 0x75, 0xb1, 0xcf, 0xde, 0x6a, 0x82, 0xec, 0xc0, 0x01, 0xec, 0xff, 0x4e, 0xce,
+    0x5d, 0x7f, 0x6c, 0x7c, 0xbd, 0xa2, 0xfb, 0x67, 0xaa, 0xd3, 0xe0, 0x38, 0x10, 0x4f, 0xee, 0x48,
+    0xee, 0x16, 0x84, 0xf1, 0x42, 0xcd, 0xfc, 0xba, 0xb1, 0x5f, 0x3b, 0x4c, 0x39, 0x21, 0x0e, 0x46,
+    0xe3, 0xc9, 0x5e, 0xf4, 0xdc, 0xc5, 0x03, 0xb4, 0xf9, 0x7f, 0x60, 0x63, 0x01, 0xf3, 0x1d, 0x95,
+    0xfe, 0x69, 0xc5, 0x8d, 0xb2, 0xdf, 0xdc, 0x8f, 0x93, 0x5b, 0x98, 0x32, 0x6b, 0x54, 0x33, 0x1e,
+    0x5c, 0x30, 0x19, 0x6e, 0xca, 0xcc, 0xe1, 0x3e, 0x1f, 0x2c, 0x07, 0x31, 0x52, 0xdb, 0xb7, 0x73,
+    0xa2, 0x5c, 0x17, 0x19, 0x4e, 0x54, 0x56, 0x53, 0xac, 0xc3, 0x4c, 0xfd, 0x3b, 0x5d, 0x34, 0x5d,
+    0x89, 0x55, 0x1e, 0x83, 0xdf, 0x8d, 0xfd, 0xe1, 0x69, 0x03, 0x7b, 0xab, 0x7d, 0xf8, 0x63, 0xc7,
+    0x13, 0x1d, 0xc3, 0xd1, 0x92, 0xbc, 0xe1, 0xae, 0xe5, 0x75, 0x54, 0x97, 0x1f, 0x8d, 0xfd, 0xac,
+    0x73, 0xf3, 0xe7, 0x98, 0xbd, 0xc9, 0xc3, 0x39, 0x5d, 0xc4, 0x43, 0xac, 0xac, 0xdd, 0x54, 0x70,
+    0xdb, 0xc6, 0x8f, 0x5a, 0x3f, 0x8e, 0x64, 0xc9, 0xce, 0xa8, 0x7b, 0x7b, 0x8f, 0x72, 0xa1, 0x71,
+    0x7f, 0x47, 0xa9, 0xaf, 0x46, 0x0c, 0xd4, 0xe5, 0xe8, 0x9a, 0x5f, 0x4b, 0x7f, 0xc4, 0x7e, 0x6c,
+    0x8c, 0x05, 0x48, 0x26, 0x2d, 0x26, 0xfc, 0x6d, 0x98, 0xf6, 0xfe, 0xeb, 0x3d, 0xc5, 0xb1, 0xb0,
+    0xc7, 0xc0, 0xae, 0x93, 0x4d, 0x17, 0x5e, 0xb8, 0xfe, 0x4c, 0xf2, 0xea, 0xd2, 0x82, 0xed, 0x76,
+    0xd6, 0x14, 0x03, 0x8e, 0x82, 0x02, 0x0f, 0xfd, 0xc4, 0x27, 0xf7, 0x78, 0xbe, 0x33, 0x39, 0xcb,
+    0x39, 0xfc, 0x47, 0x8f, 0x48, 0x47, 0x47, 0x09, 0xd8, 0x64, 0xe0, 0xa1, 0xf9, 0x76, 0x87, 0xc3,
+    0x9a, 0xa8, 0xe6, 0xd7, 0x0e, 0xb4, 0x3c, 0x6c, 0x71, 0x1d, 0x1b, 0xb4, 0xb8, 0x56, 0xd6, 0xfb,
+    0x2d, 0xd0, 0x0f, 0x99, 0x17, 0x68, 0x84, 0x5d, 0xb7, 0x78, 0x3a, 0xd0, 0x1f, 0x4e, 0xc4, 0x49,
+    0xec, 0xb8, 0xc1, 0x1f, 0x93, 0xba, 0x9c, 0x5d, 0x1e, 0xf9, 0x7b, 0xdc, 0x67, 0x6b, 0xd7, 0xbc,
+    0x9d, 0xf9, 0x1e, 0x29, 0xfc, 0x14, 0x6f, 0x4d, 0x3a, 0x8d, 0x09, 0x05, 0x6f, 0x45, 0x58, 0xb8,
+    0x97, 0xf9, 0x6e, 0x91, 0xc3, 0xec, 0xdd, 0xc5, 0xa0, 0xff, 0xf0, 0xe1, 0x57, 0xf3, 0x1d, 0x2d,
+    0xa2, 0x3a, 0xf6, 0x90, 0xd9, 0x35, 0xce, 0xf9, 0x05, 0xcb, 0xbd, 0xd0, 0x37, 0x01, 0xd5, 0x8d,
+    0xb1, 0x25, 0xd8, 0x17, 0xfb, 0x8e, 0x1f, 0xb7, 0x6e, 0xe7, 0x21, 0x3a, 0x5b, 0x77, 0x62, 0x9f,
+    0x9a, 0x48, 0xcd, 0x4a, 0x02, 0x1d, 0xff, 0xa5, 0x78, 0x52, 0xda, 0xff, 0x36, 0xb6, 0x47, 0xd6,
+    0xe7, 0x8a, 0xd0, 0x23, 0x29, 0x42, 0x30, 0xbf, 0x08, 0xe6, 0xf1, 0xd9, 0x81, 0x81, 0x14, 0x1a,
+    0xfe, 0x83, 0x7b, 0x9b, 0xe8, 0x00, 0x23, 0x45, 0x05, 0x15, 0x3d, 0x77, 0x77, 0xf2, 0x63, 0xba,
+    0x29, 0xfb, 0x14, 0x93, 0x17, 0x35, 0x7d, 0x53, 0xfb, 0x3f, 0x3b, 0xf1, 0x8c, 0x20, 0xeb, 0x67,
+    0x04, 0xfa, 0xbf, 0xd2, 0xe2, 0x70, 0x52, 0xd4, 0x95, 0xfa, 0x7b, 0x90, 0x03, 0xa9, 0xb3, 0x49,
+    0xd2, 0xed, 0x05, 0xa9, 0x0f, 0x41, 0xcd, 0x96, 0x53, 0xd1, 0x0b, 0x76, 0xe1, 0x74, 0x71, 0xa2,
+    0xad, 0x57, 0x1f, 0x89, 0x01, 0x4a, 0xd8, 0xee, 0xeb, 0x5f, 0x59, 0xb4, 0x9f, 0x7e, 0x6e, 0x3d,
+    0x20, 0x01, 0x5b, 0x1a, 0xef, 0x49, 0x76, 0x3a, 0x26, 0x1d, 0x61, 0xd5, 0x39, 0xfd, 0xf3, 0x4f,
+    0xec, 0xd9, 0x2b, 0xda, 0xfe, 0xd6, 0xc5, 0xca, 0x7c, 0x6d, 0xc8, 0x8f, 0xe0, 0xb3, 0x46, 0xa7,
+    0x36, 0xce, 0xc3, 0x1e, 0xab, 0xb7, 0x30, 0xfb, 0x67, 0x93, 0x3e, 0x2f, 0x7c, 0xa3, 0xcf, 0xd2,
+    0x40, 0xe3, 0xb6, 0xb9, 0xfa, 0xbf, 0x97, 0x1c, 0x32, 0xa9, 0xb6, 0xb6, 0xb1, 0xb9, 0xa2, 0xbc,
+    0x10, 0x11, 0x1c, 0xd0, 0xdf, 0x76, 0xc0, 0x4f, 0x03, 0x7b, 0x9c, 0x83, 0x38, 0xcd, 0xf9, 0x06,
+    0x6a, 0x93, 0xb3, 0x6b, 0xf1, 0xdb, 0x57, 0xd8, 0x55, 0xf3, 0x5f, 0x3c, 0x7c, 0xec, 0x19, 0xb0,
+    0xfa, 0x69, 0x04, 0xe1, 0x5a, 0x6c, 0x7d, 0x4a, 0xb1, 0x47, 0xaa, 0x7a, 0x98, 0xe8, 0xf2, 0x9b,
+    0x52, 0x3f, 0xc5, 0x33, 0x05, 0x9a, 0x77, 0x21, 0x28, 0x46, 0x3b, 0x78, 0xa4, 0x71, 0x48, 0x1a,
+    0x9b, 0xb7, 0x9b, 0x45, 0xb3, 0x51, 0x7a, 0xb1, 0xf5, 0x2f, 0x6a, 0x5f, 0xd3, 0x36, 0x2b, 0x06,
+    0x78, 0xb0, 0x1c, 0x9c, 0x91, 0x2c, 0xb4, 0xe6, 0x93, 0xb5, 0xf3, 0xed, 0xd4, 0x56, 0x45, 0xde,
+    0xce, 0x99, 0x8a, 0x85, 0x5d, 0x66, 0x22, 0x1b, 0xb3, 0xca, 0x5a, 0x8d, 0x3f, 0x70, 0x8b, 0xc1,
+    0x7d, 0x69, 0xcb, 0x5b, 0x95, 0x0e, 0x77, 0xab, 0xba, 0xb5, 0x88, 0xe2, 0xdc, 0x37, 0x43, 0x32,
+    0x56, 0xdd, 0x89, 0x66, 0x57, 0x98, 0x92, 0xc3, 0xea, 0xe8, 0x35, 0x06, 0x12, 0xb3, 0xbb, 0x41,
+    0x17, 0x9e, 0x00, 0xfc, 0xd0, 0x9b, 0xd8, 0x37, 0x9b, 0x7f, 0x90, 0xf7, 0x19, 0x4d, 0xf7, 0x4d,
+    0x4c, 0x57, 0xdb, 0x0b, 0xd0, 0xe7, 0x21, 0x6e, 0x7a, 0xad, 0x74, 0x00, 0x11, 0x54, 0xcb, 0xc2,
+    0x8e, 0xb5, 0xe1, 0xdc, 0xfc, 0x23, 0xee, 0xc3, 0xb2, 0xd7, 0xe8, 0x34, 0xd6, 0x7f, 0xaf, 0x35,
+    0x3f, 0x41, 0x15, 0x44, 0x8e, 0x77, 0x29, 0xa3, 0x69, 0x0a, 0xfb, 0xce, 0x59, 0xd9, 0x90, 0xf2,
+    0xf3, 0x93, 0x05, 0xb6, 0x26, 0xb6, 0xe7, 0xa6, 0xea, 0x3b, 0x88, 0x54, 0x1e, 0xb3, 0xb9, 0xc6,
+    0xa7, 0xac, 0x38, 0xf9, 0xfa, 0x5a, 0xa8, 0xd3, 0x7b, 0x5f, 0xb5, 0x81, 0xe5, 0x0e, 0x27, 0x3f,
+    0x4f, 0x6b, 0xfb, 0xba, 0x15, 0xf4, 0xa4, 0x33, 0xdc, 0x72, 0xd6, 0xc8, 0x52, 0x63, 0x6d, 0x93,
+    0x27, 0xb9, 0xd0, 0x55, 0x3f, 0xac, 0x5a, 0x00, 0x0a, 0xb8, 0xeb, 0xa6, 0x46, 0x7a, 0x2e, 0x0a,
+    0x9f, 0xcb, 0x2c, 0xe3, 0x7d, 0xe2, 0x9a, 0xd0, 0xe5, 0xf3, 0x23, 0xbe, 0x58, 0x5b, 0xe1, 0x8b,
+    0x69, 0xa7, 0xf9, 0xa0, 0x7c, 0xc2, 0x00, 0xdc, 0x93, 0x5a, 0x2f, 0xec, 0x32, 0x6b, 0x96, 0xb9,
+    0x47, 0xa2, 0x38, 0x5d, 0xd9, 0xd8, 0x4c, 0xd7, 0x59, 0x5c, 0x6b, 0x2e, 0x6b, 0x7f, 0x76, 0xce,
+    0x1c, 0xd9, 0x56, 0x68, 0x1b, 0x3b, 0xbd, 0xd3, 0xca, 0x2e, 0xb6, 0x1e, 0x72, 0xf4, 0x17, 0x13,
+    0x53, 0x5a, 0xdc, 0xdc, 0x67, 0x0a, 0x10, 0x36, 0x87, 0x09, 0xe6, 0xea, 0xcd, 0xdc, 0x69, 0x7b,
+    0x25, 0x0d, 0x78, 0x1b, 0xfc, 0x4d, 0xdf, 0x0c, 0x9c, 0xac, 0xc2, 0x36, 0x90, 0xc3, 0xab, 0x10,
+    0xb7, 0x0b, 0x1e, 0xf9, 0xb2, 0x3b, 0x56, 0x56, 0x39, 0xbf, 0x98, 0xb6, 0x6a, 0x01, 0x4c, 0xa6,
+    0x93, 0x99, 0x61, 0x6d, 0xae, 0xd3, 0x18, 0x78, 0xdb, 0x7d, 0xbf, 0x01, 0xcb, 0xc4, 0xf3, 0xb3,
+    0x79, 0x8b, 0xcc, 0x14, 0x02, 0xc7, 0x9c, 0x4e, 0xbb, 0x38, 0xd4, 0x34, 0xff, 0x56, 0xe3, 0xce,
+    0xb2, 0x4b, 0x9a, 0x19, 0xc4, 0x94, 0x77, 0xa7, 0x7b, 0xc8, 0xf4, 0x18, 0x6e, 0x36, 0x99, 0x0e,
+    0xd7, 0xb1, 0x77, 0xc8, 0xe9, 0xb9, 0xf7, 0xe5, 0x30, 0x35, 0xbd, 0xa3, 0xb3, 0x52, 0x76, 0x0a,
+    0x3d, 0x5d, 0x4b, 0xff, 0x87, 0x88, 0xd2, 0x58, 0x07, 0xa0, 0xf2, 0x77, 0x53, 0x00, 0x7a, 0xd8,
+    0xf7, 0x70, 0x28, 0xd3, 0x86, 0xf3, 0x32, 0x86, 0xa6, 0x74, 0xbd, 0x81, 0xb9, 0x07, 0x9b, 0x75,
+    0x45, 0x06, 0xa7, 0xe1, 0xf3, 0xd0, 0x36, 0x39, 0x36, 0xcd, 0x2f, 0xde, 0xdb, 0x3d, 0xa6, 0xc1,
+    0x6c, 0x95, 0xdb, 0xe4, 0xb4, 0x70, 0x3e, 0x68, 0xed, 0x99, 0x26, 0xfe, 0x3e, 0xd8, 0x55, 0x99,
+    0xca, 0xb3, 0x0e, 0xc7, 0xe6, 0xdf, 0x13, 0x1e, 0xf7, 0xcc, 0x78, 0xdc, 0xb2, 0xf5, 0xde, 0xb6,
+    0x4e, 0x7e, 0x5c, 0x8b, 0xb6, 0xcb, 0x2d, 0x79, 0xcc, 0x93, 0xc2, 0x47, 0xc2, 0x34, 0x41, 0x3f,
+    0x6b, 0x9d, 0x9c, 0xe3, 0x2e, 0x8b, 0xe1, 0x9e, 0x20, 0x42, 0xc7, 0xbb, 0xcc, 0x07, 0x26, 0xf9,
+    0x32, 0x4d, 0x65, 0x8d, 0x79, 0x3b, 0x6c, 0x3d, 0x13, 0xea, 0x4a, 0xa5, 0x4e, 0xf3, 0x95, 0x4b,
+    0xb3, 0x5b, 0x26, 0xae, 0x34, 0x08, 0xb7, 0x53, 0xda, 0x5e, 0xb4, 0xb0, 0xcc, 0xba, 0x97, 0x5f,
+    0xcd, 0xca, 0x25, 0xc9, 0x5c, 0x4f, 0xab, 0x8b, 0xb5, 0x30, 0x7a, 0x87, 0xc4, 0xe3, 0xee, 0xb0,
+    0x8e, 0x6b, 0x76, 0x1e, 0xe7, 0xdc, 0x09, 0x6e, 0x53, 0xc2, 0xfb, 0xf6, 0x3c, 0x73, 0x05, 0xc7,
+    0xbb, 0xcd, 0xe8, 0x4a, 0x40, 0xd7, 0x8b, 0x36, 0xbd, 0xa8, 0x4e, 0xce, 0xfa, 0x93, 0xc9, 0xa7,
+    0x35, 0x44, 0x50, 0xb9, 0xe6, 0xad, 0x6f, 0x60, 0x2f, 0xdc, 0x49, 0xb2, 0x06, 0x61, 0x9e, 0xff,
+    0x33, 0x1b, 0x1e, 0xf2, 0x19, 0xea, 0xf8, 0x5f, 0xc7, 0xe2, 0x69, 0x72, 0xb6, 0xaf, 0x33, 0xae,
+    0x9c, 0xde, 0x6e, 0x03, 0x17, 0xa1, 0x58, 0xb8, 0x03, 0x36, 0xbe, 0x38, 0x5a, 0x4d, 0x28, 0x95,
+    0x25, 0xfc, 0xec, 0x50, 0xc3, 0xe2, 0x53, 0x31, 0x0f, 0xc6, 0x31, 0x2a, 0x25, 0x7c, 0x0f, 0xda,
+    0x06, 0x9f, 0x42, 0x03, 0xc6, 0xff, 0xd7, 0x2b, 0xfd, 0x57, 0x02, 0x74, 0xa5, 0xfa, 0x59, 0xd8,
+    0x96, 0xbc, 0x0e, 0xea, 0x74, 0x4e, 0xed, 0x30, 0x98, 0xfe, 0xeb, 0x4e, 0xdb, 0xe3, 0xd4, 0x17,
+    0xf7, 0xf7, 0x22, 0xd1, 0x0c, 0x5d, 0x0f, 0x13, 0x10, 0x84, 0xa5, 0xee, 0x54, 0xff, 0x7d, 0x8d,
+    0x2a, 0x99, 0x3d, 0xe8, 0xf0, 0x63, 0x85, 0x8e, 0xb5, 0x2c, 0xe9, 0x40, 0xf9, 0xd5, 0xb7, 0x70,
+    0x2d, 0x9b, 0x55, 0xf5, 0x11, 0x52, 0x3d, 0xf4, 0x7c, 0x87, 0xe4, 0xfe, 0x15, 0x07, 0x5e, 0x79,
+    0x88, 0xed, 0x9a, 0x1f, 0xa5, 0xe1, 0x0b, 0xb7, 0x35, 0x2a, 0x2e, 0xe7, 0xba, 0x05, 0x85, 0x36,
+    0x5d, 0xfc, 0x68, 0xe2, 0x3b, 0xa0, 0x1a, 0x85, 0x19, 0xe1, 0xd1, 0xfe, 0xc1, 0xf5, 0x9c, 0x93,
+    0x82, 0xe9, 0x79, 0x9c, 0xa5, 0xfa, 0xc2, 0x1b, 0xa6, 0x40, 0xff, 0x3a, 0x60, 0xaf, 0x8f, 0x5e,
+    0x50, 0x0e, 0x38, 0x82, 0xbb, 0xb9, 0xee, 0x53, 0x23, 0xd3, 0xbc, 0x55, 0x1e, 0x74, 0xcb, 0x0f,
+    0x4a, 0xe8, 0x97, 0xdc, 0x45, 0xf9, 0x53, 0x0b, 0x66, 0x08, 0x05, 0x7e, 0x76, 0xd3, 0xfb, 0x7e,
+    0x84, 0x5e, 0xbf, 0xff, 0x71, 0xda, 0x9f, 0xac, 0x8c, 0xb2, 0x7a, 0x72, 0xd2, 0x13, 0x1d, 0xfa,
+    0x8e, 0x13, 0x76, 0x13, 0xdd, 0xe5, 0x17, 0x0f, 0x0e, 0x6c, 0x8e, 0x28, 0xff, 0x85, 0x1e, 0x9f,
+    0x3f, 0x76, 0x75, 0xac, 0x6d, 0x94, 0x7f, 0x6d, 0x94, 0x75, 0x08, 0xfd, 0xa1, 0xd2, 0x8e, 0x79,
+    0xb0, 0x0a, 0xa9, 0xac, 0x2f, 0xeb, 0xcb, 0x9d, 0xf3, 0x50, 0x68, 0x46, 0x9b, 0xf1, 0xa4, 0x17,
+    0x77, 0xc7, 0x23, 0x64, 0x8d, 0xa7, 0xbf, 0x04, 0x1c, 0x86, 0x7a, 0xcd, 0x86, 0xc0, 0xdf, 0xc5,
+    0xa2, 0xb8, 0xfb, 0x41, 0x2a, 0xbe, 0x28, 0x8c, 0xe2, 0xff, 0x52, 0xe3, 0x6a, 0xf2, 0xfa, 0x7c,
+    0xd7, 0x7c, 0xb9, 0xb1, 0xba, 0x44, 0xc0, 0xfd, 0xe5, 0x3f, 0x4c, 0x0c, 0xa2, 0x8f, 0x39, 0x01,
+    0x1a, 0xed, 0xc5, 0x82, 0x0a, 0xe3, 0xbf, 0x1d, 0xc5, 0x96, 0xac, 0xc7, 0x36, 0x10, 0xbb, 0x59,
+    0x4c, 0x3f, 0x6f, 0x06, 0xc6, 0x7b, 0x1f, 0xe3, 0x1f, 0x8f, 0x3c, 0x29, 0xf7, 0xfe, 0x28, 0x2a,
+    0xbf, 0xe1, 0xfa, 0xa7, 0x6e, 0xaa, 0x51, 0x5d, 0x77, 0x33, 0xff, 0xd0, 0xd4, 0x4c, 0x4a, 0x2f,
+    0x69, 0xf2, 0xa9, 0xe4, 0x1b, 0x34, 0x3b, 0xaf, 0x49, 0x1a, 0xfa, 0xbf, 0x57, 0xcf, 0x0b, 0x1c,
+    0x2e, 0x63, 0xde, 0xd9, 0xd8, 0xcb, 0x0d, 0x8c, 0xf9, 0xc1, 0x94, 0xa3, 0xd8, 0x33, 0x42, 0xb4,
+    0x08, 0x89, 0xbd, 0x6c, 0x37, 0x2e, 0x85, 0x28, 0x98, 0xe1, 0x5a, 0x9c, 0xb3, 0x7c, 0xbc, 0x3f,
+    0x36, 0x36, 0x2f, 0x59, 0xf8, 0xf6, 0xb5, 0x31, 0x62, 0x47, 0xa4, 0xf6, 0xbf, 0xba, 0x82, 0x54,
+    0xbe, 0xd0, 0x11, 0xc3, 0xf9, 0x02, 0x8d, 0x35, 0xad, 0xfb, 0xe7, 0xc5, 0x28, 0x5a, 0xc8, 0x69,
+    0x4f, 0x8d, 0xaf, 0x67, 0x2a, 0x89, 0xd5, 0x45, 0x60, 0xb0, 0x67, 0xe7, 0xa3, 0xf7, 0x67, 0xdf,
+    0xa7, 0x9e, 0x14, 0x6c, 0xbd, 0x14, 0x6e, 0x5d, 0x60, 0x06, 0xe8, 0xc6, 0xba, 0x0d, 0x08, 0xe3,
+    0x9b, 0xdf, 0x28, 0xfb, 0x39, 0xda, 0xd9, 0x9f, 0x5a, 0x2d, 0x0c, 0x5a, 0x26, 0x73, 0x35, 0x33,
+    0xfd, 0x48, 0xe5, 0x6a, 0x73, 0x30, 0x97, 0xde, 0x31, 0xe1, 0xb1, 0xa5, 0xf7, 0xe7, 0xf4, 0x38,
+    0x53, 0xb4, 0x04, 0x14, 0x0c, 0x5c, 0x7a, 0x78, 0xb5, 0xbe, 0x52, 0x3b, 0xe3, 0x91, 0xe8, 0xc0,
+    0x7c, 0x66, 0x0e, 0xf7, 0xf1, 0x5a, 0x2e, 0xc9, 0xce, 0x7f, 0xff, 0xb0, 0x99, 0x0f, 0xb7, 0xef,
+    0x3b, 0xfe, 0xb1, 0x85, 0x5f, 0xa7, 0x1d, 0x83, 0x3f, 0x73, 0x2d, 0x9f, 0x10, 0x4e, 0x87, 0x5e,
+    0x2f, 0xab, 0x0e, 0xd0, 0xdd, 0xd0, 0x53, 0x3d, 0x72, 0x22, 0x7b, 0x43, 0xc5, 0x7f, 0x32, 0x43,
+    0x42, 0xfd, 0x50, 0x7a, 0x70, 0x19, 0x13, 0xbd, 0xfd, 0xbb, 0x82, 0x48, 0x47, 0x68, 0xa3, 0x06,
+    0x54, 0x35, 0x54, 0xca, 0x91, 0xea, 0x58, 0x16, 0x5b, 0x78, 0xbb, 0x1b, 0xec, 0x56, 0xf9, 0xe5,
+    0xc5, 0xfc, 0x4d, 0xdf, 0x83, 0xaa, 0xa2, 0x7c, 0x60, 0x1f, 0x3d, 0x72, 0x76, 0x78, 0xd4, 0x78,
+    0xcc, 0x7c, 0x45, 0x2f, 0x49, 0x3e, 0x3e, 0x29, 0x20, 0x61, 0x7e, 0x4f, 0xd4, 0x64, 0xc7, 0xec,
+    0x4d, 0xe2, 0x69, 0x6c, 0x8c, 0x8c, 0x6c, 0xf2, 0x96, 0x33, 0xd8, 0xbc, 0x47, 0x15, 0xe4, 0xf8,
+    0xe2, 0x38, 0x53, 0x8d, 0xd4, 0x39, 0xc3, 0x03, 0xa8, 0x66, 0xc8, 0x08, 0x84, 0xb1, 0xb9, 0xf9,
+    0xcd, 0xac, 0xf8, 0x2e, 0x6f, 0xa3, 0x57, 0x2b, 0x54, 0xa0, 0xc0, 0xd6, 0x87, 0xac, 0xf5, 0x67,
+    0x03, 0x7d, 0x23, 0x99, 0x58, 0xce, 0xb8, 0xd2, 0x6c, 0xb2, 0x77, 0x27, 0x08, 0x1b, 0x17, 0xfb,
+    0x8d, 0x4e, 0xcb, 0xf0, 0xdf, 0x87, 0x4c, 0x40, 0x1d, 0x50, 0x6c, 0xf1, 0x47, 0xa2, 0x16, 0xb4,
+    0x67, 0x4b, 0x94, 0x1c, 0x19, 0x79, 0xe7, 0x1a, 0xf7, 0xc5, 0xed, 0x15, 0x3e, 0xd6, 0x8a, 0x75,
+    0xa5, 0xb7, 0xed, 0x71, 0xc7, 0x01, 0x97, 0x11, 0x29, 0x93, 0x13, 0x2b, 0x5f, 0x7f, 0x74, 0xbb,
+    0xa0, 0x1c, 0xef, 0x33, 0xe9, 0x02, 0x8c, 0xdd, 0xfa, 0xe9, 0x5d, 0x2f, 0xf8, 0x96, 0x61, 0xfb,
+    0xfc, 0xe8, 0x2b, 0xc7, 0xd7, 0x8e, 0x3f, 0xc4, 0xa7, 0x7b, 0x60, 0xe1, 0xc3, 0xd8, 0x0e, 0x67,
+    0xc8, 0xb2, 0xf9, 0x9c, 0x98, 0x72, 0x38, 0x2e, 0x46, 0x92, 0x98, 0x4f, 0x0c, 0xae, 0xf8, 0x02,
+    0x5f, 0x0e, 0xe4, 0x65, 0x49, 0x2a, 0xca, 0x9e, 0x48, 0xf4, 0x3d, 0xe4, 0xe5, 0x4d, 0x2d, 0x6f,
+    0xf2, 0xc1, 0x56, 0xe3, 0x15, 0x09, 0x16, 0xf6, 0x2d, 0xd0, 0xb7, 0x39, 0xd4, 0xc0, 0x9a, 0x33,
+    0x0c, 0x9a, 0x0e, 0x84, 0x17, 0x4e, 0x28, 0xbd, 0x6d, 0xe7, 0x33, 0xcf, 0x61, 0xbc, 0x45, 0x82,
+    0x24, 0x09, 0x59, 0x56, 0xc4, 0xf8, 0x54, 0xfd, 0x7e, 0x07, 0x3a, 0x6d, 0x3c, 0xf8, 0x56, 0x1f,
+    0x09, 0xa6, 0x4c, 0xc6, 0xbf, 0xe3, 0xe2, 0x4b, 0x31, 0x58, 0x1c, 0xb8, 0x21, 0x97, 0xd1, 0x73,
+    0xe1, 0xbf, 0xc3, 0x77, 0xfd, 0x01,
 };
+const ShaderModule Blob042 = { Blob042_Data, 6950u, 6687u, 42u };
 
-extern const uint32_t Blob079[6687];
-const uint32_t Blob079[6687] = {
-    0x07230203, 0x00010300, 0x0008000b, 0x000003e4, 0x00000000, 0x00020011, 0x00000001, 0x0006000b,
-    0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001,
-    0x0008000f, 0x00000005, 0x00000004, 0x6e69616d, 0x00000000, 0x000000d9, 0x0000029b, 0x000002b3,
-    0x00060010, 0x00000004, 0x00000011, 0x00000020, 0x00000020, 0x00000001, 0x00030003, 0x00000002,
-    0x000001c2, 0x000a0004, 0x475f4c47, 0x4c474f4f, 0x70635f45, 0x74735f70, 0x5f656c79, 0x656e696c,
-    0x7269645f, 0x69746365, 0x00006576, 0x00080004, 0x475f4c47, 0x4c474f4f, 0x6e695f45, 0x64756c63,
-    0x69645f65, 0x74636572, 0x00657669, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000, 0x000a0005,
-    0x00000010, 0x74706544, 0x73655468, 0x73615074, 0x28736573, 0x623b3162, 0x31753b31, 0x3b31753b,
-    0x003b3175, 0x00060005, 0x0000000b, 0x61757165, 0x7065446c, 0x65546874, 0x00007473, 0x00050005,
-    0x0000000c, 0x69636166, 0x6956676e, 0x00007765, 0x00050005, 0x0000000d, 0x44747364, 0x68747065,
-    0x00000000, 0x00050005, 0x0000000e, 0x656c6974, 0x74706544, 0x00000068, 0x00040005, 0x0000000f,
-    0x41747364, 0x00727474, 0x000d0005, 0x0000001c, 0x746f6c50, 0x6e617254, 0x63756c73, 0x28746e65,
-    0x753b3175, 0x31753b31, 0x3b31623b, 0x753b3175, 0x31753b31, 0x3b31753b, 0x003b3162, 0x00040005,
-    0x00000013, 0x6f6c6f63, 0x00000072, 0x00040005, 0x00000014, 0x74706564, 0x00000068, 0x00040005,
-    0x00000015, 0x72747461, 0x00000000, 0x00050005, 0x00000016, 0x68537369, 0x776f6461, 0x00000000,
-    0x00050005, 0x00000017, 0x656c6974, 0x6f6c6f43, 0x00000072, 0x00040005, 0x00000018, 0x41637273,
-    0x00000000, 0x00050005, 0x00000019, 0x656c6974, 0x74706544, 0x00000068, 0x00040005, 0x0000001a,
-    0x41637273, 0x00727474, 0x00050005, 0x0000001b, 0x74697277, 0x70654465, 0x00006874, 0x00100005,
-    0x0000002d, 0x636f7250, 0x43737365, 0x7372616f, 0x73614d65, 0x3169286b, 0x3b31753b, 0x763b3175,
-    0x763b3275, 0x763b3275, 0x763b3275, 0x623b3275, 0x31753b31, 0x3b31623b, 0x00000000, 0x00050005,
-    0x00000023, 0x656e696c, 0x69547261, 0x0000656c, 0x00050005, 0x00000024, 0x72616f63, 0x614d6573,
-    0x00006b73, 0x00060005, 0x00000025, 0x72616f63, 0x664f6573, 0x74657366, 0x00000000, 0x00040005,
-    0x00000026, 0x6f6c6f63, 0x00000072, 0x00040005, 0x00000027, 0x74706564, 0x00000068, 0x00040005,
-    0x00000028, 0x72747461, 0x00000000, 0x00040005, 0x00000029, 0x6e6e6977, 0x00007265, 0x00060005,
-    0x0000002a, 0x63617274, 0x766f436b, 0x67617265, 0x00000065, 0x00040005, 0x0000002b, 0x6e657473,
-    0x006c6963, 0x00070005, 0x0000002c, 0x76657270, 0x68537349, 0x776f6461, 0x6b73614d, 0x00000000,
-    0x00050005, 0x00000050, 0x6e656c62, 0x74744164, 0x00000072, 0x00040005, 0x0000008b, 0x52637273,
-    0x00000042, 0x00040005, 0x0000008f, 0x47637273, 0x00000000, 0x00040005, 0x00000093, 0x52747364,
-    0x00000042, 0x00040005, 0x00000096, 0x47747364, 0x00000000, 0x00040005, 0x00000099, 0x41747364,
-    0x00000000, 0x00040005, 0x0000009d, 0x68706c61, 0x00000061, 0x00050005, 0x000000ac, 0x6174654d,
-    0x66696e55, 0x006d726f, 0x00060006, 0x000000ac, 0x00000000, 0x506d754e, 0x67796c6f, 0x00736e6f,
-    0x00060006, 0x000000ac, 0x00000001, 0x566d754e, 0x61697261, 0x0073746e, 0x00060006, 0x000000ac,
-    0x00000002, 0x68706c41, 0x66655261, 0x00000000, 0x00050006, 0x000000ac, 0x00000003, 0x70736944,
-    0x00746e43, 0x00060006, 0x000000ac, 0x00000004, 0x6e6f6f54, 0x6c626154, 0x00000065, 0x00060006,
-    0x000000ac, 0x00000005, 0x61656c43, 0x6c6f4372, 0x0000726f, 0x00060006, 0x000000ac, 0x00000006,
-    0x61656c43, 0x70654472, 0x00006874, 0x00060006, 0x000000ac, 0x00000007, 0x61656c43, 0x74744172,
-    0x00000072, 0x00060006, 0x000000ac, 0x00000008, 0x4f676f46, 0x65736666, 0x00000074, 0x00060006,
-    0x000000ac, 0x00000009, 0x53676f46, 0x74666968, 0x00000000, 0x00060006, 0x000000ac, 0x0000000a,
-    0x43676f46, 0x726f6c6f, 0x00000000, 0x00080006, 0x000000ac, 0x0000000b, 0x61656c43, 0x74694272,
-    0x4f70616d, 0x65736666, 0x00000074, 0x00030005, 0x000000ae, 0x00000000, 0x00060005, 0x000000d6,
-    0x656c6974, 0x656e6e49, 0x66664f72, 0x00746573, 0x00080005, 0x000000d9, 0x4c5f6c67, 0x6c61636f,
-    0x6f766e49, 0x69746163, 0x44496e6f, 0x00000000, 0x00050005, 0x000000eb, 0x72616f63, 0x69426573,
-    0x00000074, 0x00050005, 0x000000f4, 0x656c6974, 0x7366664f, 0x00007465, 0x00050005, 0x000000fd,
-    0x656e6966, 0x6b73614d, 0x00000000, 0x00060005, 0x00000103, 0x526e6942, 0x6c757365, 0x66754274,
-    0x00726566, 0x00080006, 0x00000103, 0x00000000, 0x69726156, 0x57746e61, 0x436b726f, 0x746e756f,
-    0x00000000, 0x00080006, 0x00000103, 0x00000001, 0x74726f53, 0x6f576465, 0x664f6b72, 0x74657366,
-    0x00000000, 0x00090006, 0x00000103, 0x00000002, 0x69726156, 0x57746e61, 0x526b726f, 0x436c6165,
-    0x746e756f, 0x00000000, 0x00080006, 0x00000103, 0x00000003, 0x74726f53, 0x6b726f57, 0x6b726f57,
-    0x6e756f43, 0x00000074, 0x00090006, 0x00000103, 0x00000004, 0x6e6e6942, 0x4d676e69, 0x416b7361,
-    0x664f646e, 0x74657366, 0x00000000, 0x00030005, 0x00000105, 0x00000000, 0x00050005, 0x00000108,
-    0x65726353, 0x69576e65, 0x00687464, 0x00060005, 0x00000109, 0x656c6954, 0x72655073, 0x656e694c,
-    0x00000000, 0x00060005, 0x0000010a, 0x65726353, 0x65486e65, 0x74686769, 0x00000000, 0x00050005,
-    0x0000010b, 0x656c6954, 0x656e694c, 0x00000073, 0x00070005, 0x0000010f, 0x6e6e6942, 0x4d676e69,
-    0x536b7361, 0x74726174, 0x00000000, 0x00040005, 0x00000116, 0x6b726f77, 0x00786449, 0x00080005,
-    0x00000119, 0x6e6e6942, 0x57676e69, 0x4f6b726f, 0x65736666, 0x74537374, 0x00747261, 0x00040005,
-    0x00000126, 0x656e6966, 0x00786449, 0x00050005, 0x0000012f, 0x65786970, 0x646e696c, 0x00007865,
-    0x00050005, 0x00000136, 0x656c6974, 0x6f6c6f43, 0x00000072, 0x00060005, 0x00000138, 0x6f6c6f43,
-    0x6c695472, 0x66754265, 0x00726566, 0x00060006, 0x00000138, 0x00000000, 0x6f6c6f43, 0x6c695472,
-    0x00007365, 0x00030005, 0x0000013a, 0x00000000, 0x00050005, 0x00000141, 0x796c6f70, 0x496e6f67,
-    0x00007864, 0x00060005, 0x00000142, 0x68737550, 0x736e6f43, 0x746e6174, 0x00000073, 0x00060006,
-    0x00000142, 0x00000000, 0x56727543, 0x61697261, 0x0000746e, 0x00060006, 0x00000142, 0x00000001,
-    0x57786554, 0x68746469, 0x00000000, 0x00060006, 0x00000142, 0x00000002, 0x48786554, 0x68676965,
-    0x00000074, 0x00060006, 0x00000142, 0x00000003, 0x57786554, 0x53706172, 0x00000000, 0x00060006,
-    0x00000142, 0x00000004, 0x57786554, 0x54706172, 0x00000000, 0x00070006, 0x00000142, 0x00000005,
-    0x49786554, 0x70614373, 0x65727574, 0x00000000, 0x00070006, 0x00000142, 0x00000006, 0x74706143,
-    0x59657275, 0x7366664f, 0x00007465, 0x00050006, 0x00000142, 0x00000007, 0x6461705f, 0x00000000,
-    0x00030005, 0x00000144, 0x00006370, 0x00050005, 0x00000153, 0x796c6f70, 0x416e6f67, 0x00727474,
-    0x00040005, 0x00000154, 0x796c6f50, 0x006e6f67, 0x00060006, 0x00000154, 0x00000000, 0x73726946,
-    0x70535874, 0x00006e61, 0x00050006, 0x00000154, 0x00000001, 0x706f5459, 0x00000000, 0x00050006,
-    0x00000154, 0x00000002, 0x746f4259, 0x00000000, 0x00050006, 0x00000154, 0x00000003, 0x6e694d58,
-    0x00000000, 0x00050006, 0x00000154, 0x00000004, 0x78614d58, 0x00000000, 0x00050006, 0x00000154,
-    0x00000005, 0x6e694d58, 0x00000059, 0x00050006, 0x00000154, 0x00000006, 0x78614d58, 0x00000059,
-    0x00050006, 0x00000154, 0x00000007, 0x69726156, 0x00746e61, 0x00050006, 0x00000154, 0x00000008,
-    0x72747441, 0x00000000, 0x00070006, 0x00000154, 0x00000009, 0x74786554, 0x4c657275, 0x72657961,
-    0x00000000, 0x00060006, 0x00000154, 0x0000000a, 0x69636146, 0x6956676e, 0x00007765, 0x00060005,
-    0x00000156, 0x796c6f50, 0x426e6f67, 0x65666675, 0x00000072, 0x00060006, 0x00000156, 0x00000000,
-    0x796c6f50, 0x736e6f67, 0x00000000, 0x00030005, 0x00000158, 0x00000000, 0x00050005, 0x0000015c,
-    0x69636166, 0x6956676e, 0x00007765, 0x00060005, 0x00000162, 0x68537369, 0x776f6461, 0x6b73614d,
-    0x00000000, 0x00070005, 0x00000168, 0x76657270, 0x68537349, 0x776f6461, 0x6b73614d, 0x00646c4f,
-    0x00060005, 0x0000016b, 0x61757165, 0x7065446c, 0x65546874, 0x00007473, 0x00050005, 0x00000170,
-    0x656c6974, 0x74706544, 0x00000068, 0x00060005, 0x00000172, 0x74706544, 0x6c695468, 0x66754265,
-    0x00726566, 0x00060006, 0x00000172, 0x00000000, 0x74706544, 0x6c695468, 0x00007365, 0x00030005,
-    0x00000174, 0x00000000, 0x00050005, 0x00000178, 0x656c6974, 0x72747441, 0x00000000, 0x00060005,
-    0x0000017a, 0x72747441, 0x656c6954, 0x66667542, 0x00007265, 0x00060006, 0x0000017a, 0x00000000,
-    0x72747441, 0x656c6954, 0x00000073, 0x00030005, 0x0000017c, 0x00000000, 0x00040005, 0x00000180,
-    0x61747364, 0x00727474, 0x00050005, 0x00000187, 0x68537369, 0x776f6461, 0x00000000, 0x00070005,
-    0x0000018b, 0x74697277, 0x63655365, 0x4c646e6f, 0x72657961, 0x00000000, 0x00050005, 0x000001a4,
-    0x44747364, 0x68747065, 0x00000000, 0x00040005, 0x000001af, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001b1, 0x61726170, 0x0000006d, 0x00040005, 0x000001b3, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001b5, 0x61726170, 0x0000006d, 0x00040005, 0x000001b7, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001c8, 0x61726170, 0x0000006d, 0x00040005, 0x000001ca, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001cc, 0x61726170, 0x0000006d, 0x00040005, 0x000001cf, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001d1, 0x61726170, 0x0000006d, 0x00040005, 0x000001d8, 0x41637273, 0x00727474, 0x00040005,
-    0x000001e2, 0x41637273, 0x00000000, 0x00050005, 0x00000224, 0x74697277, 0x70654465, 0x00006874,
-    0x00040005, 0x0000022c, 0x61726170, 0x0000006d, 0x00040005, 0x0000022f, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000232, 0x61726170, 0x0000006d, 0x00040005, 0x00000235, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000237, 0x61726170, 0x0000006d, 0x00040005, 0x00000239, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000023b, 0x61726170, 0x0000006d, 0x00040005, 0x0000023d, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000023f, 0x61726170, 0x0000006d, 0x00040005, 0x00000252, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000255, 0x61726170, 0x0000006d, 0x00040005, 0x00000258, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000025b, 0x61726170, 0x0000006d, 0x00040005, 0x0000025d, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000025f, 0x61726170, 0x0000006d, 0x00040005, 0x00000261, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000263, 0x61726170, 0x0000006d, 0x00040005, 0x00000265, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000273, 0x61726170, 0x0000006d, 0x00040005, 0x00000275, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000277, 0x61726170, 0x0000006d, 0x00040005, 0x0000027a, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000027c, 0x61726170, 0x0000006d, 0x00040005, 0x00000288, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000028a, 0x61726170, 0x0000006d, 0x00040005, 0x0000028c, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000028f, 0x61726170, 0x0000006d, 0x00040005, 0x00000291, 0x61726170, 0x0000006d,
-    0x00050005, 0x0000029a, 0x656e696c, 0x69547261, 0x0000656c, 0x00060005, 0x0000029b, 0x575f6c67,
-    0x476b726f, 0x70756f72, 0x00004449, 0x00060005, 0x000002a4, 0x72616f63, 0x614d6573, 0x6f4c6b73,
-    0x00000000, 0x00060005, 0x000002ab, 0x72616f63, 0x614d6573, 0x69486b73, 0x00000000, 0x00060005,
-    0x000002b2, 0x75736572, 0x664f746c, 0x74657366, 0x00000000, 0x00080005, 0x000002b3, 0x475f6c67,
-    0x61626f6c, 0x766e496c, 0x7461636f, 0x496e6f69, 0x00000044, 0x00040005, 0x000002bc, 0x6e6e6977,
-    0x00007265, 0x00060005, 0x000002bf, 0x63617274, 0x766f436b, 0x67617265, 0x00000065, 0x00040005,
-    0x000002c9, 0x6e657473, 0x006c6963, 0x00070005, 0x000002ca, 0x76657270, 0x68537349, 0x776f6461,
-    0x6b73614d, 0x00000000, 0x00040005, 0x000002d0, 0x6f6c6f63, 0x00000072, 0x00060005, 0x000002d2,
-    0x75736552, 0x7542746c, 0x72656666, 0x00000000, 0x00060006, 0x000002d2, 0x00000000, 0x75736552,
-    0x6156746c, 0x0065756c, 0x00030005, 0x000002d4, 0x00000000, 0x00070005, 0x000002dd, 0x6d617246,
-    0x66756265, 0x53726566, 0x64697274, 0x00000065, 0x00040005, 0x000002e3, 0x74706564, 0x00000068,
-    0x00070005, 0x000002e7, 0x75736552, 0x6544746c, 0x53687470, 0x74726174, 0x00000000, 0x00040005,
-    0x000002f5, 0x72747461, 0x00000000, 0x00060005, 0x000002f9, 0x75736552, 0x7441746c, 0x74537274,
-    0x00747261, 0x00070005, 0x0000030b, 0x75736552, 0x6957746c, 0x72656e6e, 0x66667542, 0x00007265,
-    0x00070006, 0x0000030b, 0x00000000, 0x75736552, 0x6957746c, 0x72656e6e, 0x00000000, 0x00030005,
-    0x0000030d, 0x00000000, 0x00060005, 0x00000316, 0x746e6f63, 0x61756e69, 0x6e6f6974, 0x00000000,
-    0x00080005, 0x00000318, 0x6e656c42, 0x6e6f4364, 0x756e6974, 0x6f697461, 0x6675426e, 0x00726566,
-    0x00090006, 0x00000318, 0x00000000, 0x6e656c42, 0x6e6f4364, 0x756e6974, 0x6f697461, 0x6174536e,
-    0x00006574, 0x00030005, 0x0000031a, 0x00000000, 0x00040005, 0x00000331, 0x6c616373, 0x00000065,
-    0x00030005, 0x00000336, 0x00736f70, 0x00070005, 0x00000344, 0x61656c43, 0x74694272, 0x4370616d,
-    0x726f6c6f, 0x00000000, 0x00070005, 0x0000034b, 0x61656c43, 0x74694272, 0x4470616d, 0x68747065,
-    0x00000000, 0x00040005, 0x00000370, 0x61726170, 0x0000006d, 0x00040005, 0x00000372, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000374, 0x61726170, 0x0000006d, 0x00040005, 0x00000375, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000377, 0x61726170, 0x0000006d, 0x00040005, 0x00000379, 0x61726170,
-    0x0000006d, 0x00040005, 0x0000037b, 0x61726170, 0x0000006d, 0x00040005, 0x0000037d, 0x61726170,
-    0x0000006d, 0x00040005, 0x0000037f, 0x61726170, 0x0000006d, 0x00040005, 0x00000381, 0x61726170,
-    0x0000006d, 0x00040005, 0x0000038a, 0x61726170, 0x0000006d, 0x00040005, 0x0000038c, 0x61726170,
-    0x0000006d, 0x00040005, 0x0000038e, 0x61726170, 0x0000006d, 0x00040005, 0x0000038f, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000391, 0x61726170, 0x0000006d, 0x00040005, 0x00000393, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000395, 0x61726170, 0x0000006d, 0x00040005, 0x00000397, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000399, 0x61726170, 0x0000006d, 0x00040005, 0x0000039b, 0x61726170,
-    0x0000006d, 0x00060005, 0x000003e0, 0x5778614d, 0x546b726f, 0x73656c69, 0x00000000, 0x00040047,
-    0x000000a9, 0x00000006, 0x00000010, 0x00050048, 0x000000ac, 0x00000000, 0x00000023, 0x00000000,
-    0x00050048, 0x000000ac, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x000000ac, 0x00000002,
-    0x00000023, 0x00000008, 0x00050048, 0x000000ac, 0x00000003, 0x00000023, 0x0000000c, 0x00050048,
-    0x000000ac, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x000000ac, 0x00000005, 0x00000023,
-    0x00000230, 0x00050048, 0x000000ac, 0x00000006, 0x00000023, 0x00000234, 0x00050048, 0x000000ac,
-    0x00000007, 0x00000023, 0x00000238, 0x00050048, 0x000000ac, 0x00000008, 0x00000023, 0x0000023c,
-    0x00050048, 0x000000ac, 0x00000009, 0x00000023, 0x00000240, 0x00050048, 0x000000ac, 0x0000000a,
-    0x00000023, 0x00000244, 0x00050048, 0x000000ac, 0x0000000b, 0x00000023, 0x00000248, 0x00030047,
-    0x000000ac, 0x00000002, 0x00040047, 0x000000ae, 0x00000022, 0x00000000, 0x00040047, 0x000000ae,
-    0x00000021, 0x00000000, 0x00040047, 0x000000d9, 0x0000000b, 0x0000001b, 0x00040047, 0x000000ff,
-    0x00000006, 0x00000010, 0x00040047, 0x00000100, 0x00000006, 0x00000004, 0x00040047, 0x00000101,
-    0x00000006, 0x00000004, 0x00040047, 0x00000102, 0x00000006, 0x00000004, 0x00050048, 0x00000103,
-    0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000103, 0x00000001, 0x00000023, 0x00008000,
-    0x00050048, 0x00000103, 0x00000002, 0x00000023, 0x0000a000, 0x00050048, 0x00000103, 0x00000003,
-    0x00000023, 0x0000c000, 0x00050048, 0x00000103, 0x00000004, 0x00000023, 0x0000c010, 0x00030047,
-    0x00000103, 0x00000002, 0x00040047, 0x00000105, 0x00000022, 0x00000000, 0x00040047, 0x00000105,
-    0x00000021, 0x00000008, 0x00040047, 0x00000108, 0x00000001, 0x00000000, 0x00040047, 0x0000010a,
-    0x00000001, 0x00000001, 0x00040047, 0x00000137, 0x00000006, 0x00000004, 0x00050048, 0x00000138,
-    0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000138, 0x00000002, 0x00040047, 0x0000013a,
-    0x00000022, 0x00000000, 0x00040047, 0x0000013a, 0x00000021, 0x00000004, 0x00050048, 0x00000142,
-    0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000142, 0x00000001, 0x00000023, 0x00000004,
-    0x00050048, 0x00000142, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x00000142, 0x00000003,
-    0x00000023, 0x0000000c, 0x00050048, 0x00000142, 0x00000004, 0x00000023, 0x00000010, 0x00050048,
-    0x00000142, 0x00000005, 0x00000023, 0x00000014, 0x00050048, 0x00000142, 0x00000006, 0x00000023,
-    0x00000018, 0x00050048, 0x00000142, 0x00000007, 0x00000023, 0x0000001c, 0x00030047, 0x00000142,
-    0x00000002, 0x00050048, 0x00000154, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000154,
-    0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x00000154, 0x00000002, 0x00000023, 0x00000008,
-    0x00050048, 0x00000154, 0x00000003, 0x00000023, 0x0000000c, 0x00050048, 0x00000154, 0x00000004,
-    0x00000023, 0x00000010, 0x00050048, 0x00000154, 0x00000005, 0x00000023, 0x00000014, 0x00050048,
-    0x00000154, 0x00000006, 0x00000023, 0x00000018, 0x00050048, 0x00000154, 0x00000007, 0x00000023,
-    0x0000001c, 0x00050048, 0x00000154, 0x00000008, 0x00000023, 0x00000020, 0x00050048, 0x00000154,
-    0x00000009, 0x00000023, 0x00000024, 0x00050048, 0x00000154, 0x0000000a, 0x00000023, 0x00000028,
-    0x00040047, 0x00000155, 0x00000006, 0x0000002c, 0x00040048, 0x00000156, 0x00000000, 0x00000018,
-    0x00050048, 0x00000156, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000156, 0x00000002,
-    0x00040047, 0x00000158, 0x00000022, 0x00000000, 0x00040047, 0x00000158, 0x00000021, 0x00000001,
-    0x00040047, 0x00000171, 0x00000006, 0x00000004, 0x00050048, 0x00000172, 0x00000000, 0x00000023,
-    0x00000000, 0x00030047, 0x00000172, 0x00000002, 0x00040047, 0x00000174, 0x00000022, 0x00000000,
-    0x00040047, 0x00000174, 0x00000021, 0x00000005, 0x00040047, 0x00000179, 0x00000006, 0x00000004,
-    0x00050048, 0x0000017a, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x0000017a, 0x00000002,
-    0x00040047, 0x0000017c, 0x00000022, 0x00000000, 0x00040047, 0x0000017c, 0x00000021, 0x00000006,
-    0x00040047, 0x0000029b, 0x0000000b, 0x0000001a, 0x00040047, 0x000002b3, 0x0000000b, 0x0000001c,
-    0x00040047, 0x000002d1, 0x00000006, 0x00000004, 0x00050048, 0x000002d2, 0x00000000, 0x00000023,
-    0x00000000, 0x00030047, 0x000002d2, 0x00000002, 0x00040047, 0x000002d4, 0x00000022, 0x00000000,
-    0x00040047, 0x000002d4, 0x00000021, 0x00000007, 0x00040047, 0x0000030a, 0x00000006, 0x00000004,
-    0x00050048, 0x0000030b, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x0000030b, 0x00000002,
-    0x00040047, 0x0000030d, 0x00000022, 0x00000000, 0x00040047, 0x0000030d, 0x00000021, 0x00000010,
-    0x00040047, 0x00000317, 0x00000006, 0x00000004, 0x00050048, 0x00000318, 0x00000000, 0x00000023,
-    0x00000000, 0x00030047, 0x00000318, 0x00000002, 0x00040047, 0x0000031a, 0x00000022, 0x00000000,
-    0x00040047, 0x0000031a, 0x00000021, 0x0000000f, 0x00040047, 0x00000344, 0x00000022, 0x00000001,
-    0x00040047, 0x00000344, 0x00000021, 0x00000003, 0x00040047, 0x0000034b, 0x00000022, 0x00000001,
-    0x00040047, 0x0000034b, 0x00000021, 0x00000004, 0x00040047, 0x000003e0, 0x00000001, 0x00000002,
-    0x00040047, 0x000003e3, 0x0000000b, 0x00000019, 0x00020013, 0x00000002, 0x00030021, 0x00000003,
-    0x00000002, 0x00020014, 0x00000006, 0x00040020, 0x00000007, 0x00000007, 0x00000006, 0x00040015,
-    0x00000008, 0x00000020, 0x00000000, 0x00040020, 0x00000009, 0x00000007, 0x00000008, 0x00080021,
-    0x0000000a, 0x00000006, 0x00000007, 0x00000007, 0x00000009, 0x00000009, 0x00000009, 0x000c0021,
-    0x00000012, 0x00000002, 0x00000009, 0x00000009, 0x00000009, 0x00000007, 0x00000009, 0x00000009,
-    0x00000009, 0x00000009, 0x00000007, 0x00040015, 0x0000001e, 0x00000020, 0x00000001, 0x00040020,
-    0x0000001f, 0x00000007, 0x0000001e, 0x00040017, 0x00000020, 0x00000008, 0x00000002, 0x00040020,
-    0x00000021, 0x00000007, 0x00000020, 0x000d0021, 0x00000022, 0x00000002, 0x0000001f, 0x00000009,
-    0x00000009, 0x00000021, 0x00000021, 0x00000021, 0x00000021, 0x00000007, 0x00000009, 0x00000007,
-    0x0004002b, 0x00000008, 0x00000035, 0x00000200, 0x0004002b, 0x00000008, 0x00000037, 0x00000400,
-    0x0004002b, 0x00000008, 0x0000003e, 0x00400010, 0x0004002b, 0x00000008, 0x00000040, 0x00000010,
-    0x0004002b, 0x00000008, 0x00000052, 0x0000e0f0, 0x0004002b, 0x0000001e, 0x00000055, 0x00000008,
-    0x0004002b, 0x00000008, 0x00000057, 0x00ff0000, 0x0004002b, 0x00000008, 0x0000005a, 0x00400000,
-    0x0004002b, 0x00000008, 0x0000005d, 0xff001f0f, 0x0004002b, 0x00000008, 0x00000067, 0x00000000,
-    0x0004002b, 0x00000008, 0x0000006e, 0x007f0000, 0x0004002b, 0x00000008, 0x00000075, 0x3f000000,
-    0x0004002b, 0x00000008, 0x00000082, 0x00008000, 0x0004002b, 0x00000008, 0x00000087, 0xffff7fff,
-    0x0004002b, 0x00000008, 0x0000008d, 0x003f003f, 0x0004002b, 0x00000008, 0x00000091, 0x00003f00,
-    0x0004002b, 0x00000008, 0x0000009b, 0x1f000000, 0x0004002b, 0x0000001e, 0x0000009f, 0x00000018,
-    0x0004002b, 0x00000008, 0x000000a1, 0x00000001, 0x00040017, 0x000000a7, 0x00000008, 0x00000004,
-    0x0004002b, 0x00000008, 0x000000a8, 0x00000022, 0x0004001c, 0x000000a9, 0x000000a7, 0x000000a8,
-    0x00030016, 0x000000aa, 0x00000020, 0x00040017, 0x000000ab, 0x000000aa, 0x00000002, 0x000e001e,
-    0x000000ac, 0x00000008, 0x00000008, 0x0000001e, 0x00000008, 0x000000a9, 0x00000008, 0x00000008,
-    0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x000000ab, 0x00040020, 0x000000ad, 0x00000002,
-    0x000000ac, 0x0004003b, 0x000000ad, 0x000000ae, 0x00000002, 0x0004002b, 0x0000001e, 0x000000af,
-    0x00000003, 0x00040020, 0x000000b0, 0x00000002, 0x00000008, 0x0004002b, 0x00000008, 0x000000b3,
-    0x00000008, 0x0004002b, 0x00000008, 0x000000bd, 0x00000020, 0x0004002b, 0x0000001e, 0x000000c2,
-    0x00000005, 0x00040017, 0x000000d7, 0x00000008, 0x00000003, 0x00040020, 0x000000d8, 0x00000001,
-    0x000000d7, 0x0004003b, 0x000000d8, 0x000000d9, 0x00000001, 0x00040020, 0x000000da, 0x00000001,
-    0x00000008, 0x0004002b, 0x0000001e, 0x000000e1, 0x00000020, 0x0004002b, 0x0000001e, 0x000000f6,
-    0x00000040, 0x0004002b, 0x00000008, 0x000000fe, 0x00000800, 0x0004001c, 0x000000ff, 0x000000a7,
-    0x000000fe, 0x0004001c, 0x00000100, 0x00000008, 0x000000fe, 0x0004001c, 0x00000101, 0x00000008,
-    0x000000fe, 0x0003001d, 0x00000102, 0x00000008, 0x0007001e, 0x00000103, 0x000000ff, 0x00000100,
-    0x00000101, 0x000000a7, 0x00000102, 0x00040020, 0x00000104, 0x0000000c, 0x00000103, 0x0004003b,
-    0x00000104, 0x00000105, 0x0000000c, 0x0004002b, 0x0000001e, 0x00000106, 0x00000004, 0x0004002b,
-    0x0000001e, 0x00000107, 0x00000000, 0x00040032, 0x0000001e, 0x00000108, 0x00000100, 0x00060034,
-    0x0000001e, 0x00000109, 0x00000087, 0x00000108, 0x000000e1, 0x00040032, 0x0000001e, 0x0000010a,
-    0x000000c0, 0x00060034, 0x0000001e, 0x0000010b, 0x00000087, 0x0000010a, 0x000000e1, 0x00060034,
-    0x0000001e, 0x0000010c, 0x00000084, 0x00000109, 0x0000010b, 0x0004002b, 0x0000001e, 0x0000010d,
-    0x00000002, 0x00060034, 0x0000001e, 0x0000010e, 0x00000084, 0x0000010c, 0x0000010d, 0x00060034,
-    0x0000001e, 0x0000010f, 0x00000080, 0x00000107, 0x0000010e, 0x00060034, 0x00000008, 0x00000110,
-    0x00000080, 0x0000010f, 0x00000067, 0x00040020, 0x00000113, 0x0000000c, 0x00000008, 0x00060034,
-    0x0000001e, 0x00000117, 0x00000084, 0x00000109, 0x0000010b, 0x00060034, 0x0000001e, 0x00000118,
-    0x00000084, 0x00000117, 0x000000f6, 0x00060034, 0x0000001e, 0x00000119, 0x00000080, 0x0000010f,
-    0x00000118, 0x00060034, 0x00000008, 0x0000011a, 0x00000080, 0x00000119, 0x00000067, 0x0003001d,
-    0x00000137, 0x00000008, 0x0003001e, 0x00000138, 0x00000137, 0x00040020, 0x00000139, 0x0000000c,
-    0x00000138, 0x0004003b, 0x00000139, 0x0000013a, 0x0000000c, 0x0004002b, 0x0000001e, 0x0000013f,
-    0x00000001, 0x000a001e, 0x00000142, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000008,
-    0x00000008, 0x0000001e, 0x00000008, 0x00040020, 0x00000143, 0x00000009, 0x00000142, 0x0004003b,
-    0x00000143, 0x00000144, 0x00000009, 0x00040020, 0x00000145, 0x00000009, 0x00000008, 0x000d001e,
-    0x00000154, 0x0000001e, 0x0000001e, 0x0000001e, 0x0000001e, 0x0000001e, 0x0000001e, 0x0000001e,
-    0x0000001e, 0x00000008, 0x000000aa, 0x00000008, 0x0003001d, 0x00000155, 0x00000154, 0x0003001e,
-    0x00000156, 0x00000155, 0x00040020, 0x00000157, 0x0000000c, 0x00000156, 0x0004003b, 0x00000157,
-    0x00000158, 0x0000000c, 0x0004002b, 0x0000001e, 0x0000015e, 0x0000000a, 0x0004002b, 0x00000008,
-    0x00000164, 0x3f000030, 0x0004002b, 0x00000008, 0x00000166, 0x00000030, 0x0004002b, 0x00000008,
-    0x0000016d, 0x00004000, 0x0003001d, 0x00000171, 0x00000008, 0x0003001e, 0x00000172, 0x00000171,
-    0x00040020, 0x00000173, 0x0000000c, 0x00000172, 0x0004003b, 0x00000173, 0x00000174, 0x0000000c,
-    0x0003001d, 0x00000179, 0x00000008, 0x0003001e, 0x0000017a, 0x00000179, 0x00040020, 0x0000017b,
-    0x0000000c, 0x0000017a, 0x0004003b, 0x0000017b, 0x0000017c, 0x0000000c, 0x0003002a, 0x00000006,
-    0x0000018c, 0x00030029, 0x00000006, 0x0000019a, 0x0004002b, 0x00000008, 0x0000019c, 0x00000002,
-    0x0004002b, 0x00000008, 0x000001a1, 0xfffffffc, 0x0004002b, 0x00000008, 0x000001be, 0x0000000f,
-    0x0004002b, 0x00000008, 0x000001da, 0x3f008000, 0x0004002b, 0x00000008, 0x00000220, 0x80000000,
-    0x0004003b, 0x000000d8, 0x0000029b, 0x00000001, 0x00060034, 0x00000008, 0x000002a0, 0x00000080,
-    0x00000109, 0x00000067, 0x0004003b, 0x000000d8, 0x000002b3, 0x00000001, 0x0004002b, 0x00000008,
-    0x000002bd, 0xffffffff, 0x0005002c, 0x00000020, 0x000002be, 0x000002bd, 0x000002bd, 0x0004002b,
-    0x0000001e, 0x000002c0, 0x00000100, 0x00060034, 0x00000006, 0x000002c1, 0x000000aa, 0x00000108,
-    0x000002c0, 0x0003001d, 0x000002d1, 0x00000008, 0x0003001e, 0x000002d2, 0x000002d1, 0x00040020,
-    0x000002d3, 0x0000000c, 0x000002d2, 0x0004003b, 0x000002d3, 0x000002d4, 0x0000000c, 0x00060034,
-    0x0000001e, 0x000002dd, 0x00000084, 0x00000108, 0x0000010a, 0x00060034, 0x00000008, 0x000002de,
-    0x00000080, 0x000002dd, 0x00000067, 0x00060034, 0x0000001e, 0x000002e4, 0x00000084, 0x00000108,
-    0x0000010a, 0x00060034, 0x0000001e, 0x000002e5, 0x00000084, 0x000002e4, 0x0000010d, 0x00060034,
-    0x00000008, 0x000002e6, 0x00000080, 0x000002e5, 0x00000067, 0x00060034, 0x00000008, 0x000002e7,
-    0x00000080, 0x00000067, 0x000002e6, 0x00060034, 0x00000008, 0x000002f0, 0x00000080, 0x000002dd,
-    0x00000067, 0x00060034, 0x0000001e, 0x000002f6, 0x00000084, 0x00000108, 0x0000010a, 0x00060034,
-    0x0000001e, 0x000002f7, 0x00000084, 0x000002f6, 0x0000010d, 0x00060034, 0x00000008, 0x000002f8,
-    0x00000080, 0x000002f7, 0x00000067, 0x00060034, 0x00000008, 0x000002f9, 0x00000080, 0x000002e7,
-    0x000002f8, 0x00060034, 0x00000008, 0x00000302, 0x00000080, 0x000002dd, 0x00000067, 0x0003001d,
-    0x0000030a, 0x00000008, 0x0003001e, 0x0000030b, 0x0000030a, 0x00040020, 0x0000030c, 0x0000000c,
-    0x0000030b, 0x0004003b, 0x0000030c, 0x0000030d, 0x0000000c, 0x0003001d, 0x00000317, 0x00000008,
-    0x0003001e, 0x00000318, 0x00000317, 0x00040020, 0x00000319, 0x0000000c, 0x00000318, 0x0004003b,
-    0x00000319, 0x0000031a, 0x0000000c, 0x0004002b, 0x00000008, 0x0000031f, 0x00000003, 0x0004002b,
-    0x00000008, 0x00000322, 0x00000004, 0x0004002b, 0x0000001e, 0x0000032c, 0x00000007, 0x00040020,
-    0x00000330, 0x00000007, 0x000000aa, 0x0004002b, 0x000000aa, 0x00000332, 0x3f800000, 0x00040020,
-    0x00000335, 0x00000007, 0x000000ab, 0x0004002b, 0x0000001e, 0x0000033c, 0x0000000b, 0x00040020,
-    0x0000033d, 0x00000002, 0x000000ab, 0x00090019, 0x00000341, 0x00000008, 0x00000001, 0x00000000,
-    0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x0003001b, 0x00000342, 0x00000341, 0x00040020,
-    0x00000343, 0x00000000, 0x00000342, 0x0004003b, 0x00000343, 0x00000344, 0x00000000, 0x0004002b,
-    0x000000aa, 0x00000347, 0x00000000, 0x0004003b, 0x00000343, 0x0000034b, 0x00000000, 0x0004002b,
-    0x0000001e, 0x00000356, 0x00000009, 0x0004002b, 0x00000008, 0x0000035b, 0x00ffffff, 0x0004002b,
-    0x0000001e, 0x00000364, 0x00000006, 0x00060034, 0x00000008, 0x000003ad, 0x00000080, 0x000002dd,
-    0x00000067, 0x00060034, 0x00000008, 0x000003bb, 0x00000080, 0x000002dd, 0x00000067, 0x00060034,
-    0x00000008, 0x000003c9, 0x00000080, 0x000002dd, 0x00000067, 0x00040032, 0x0000001e, 0x000003e0,
-    0x00003000, 0x0004002b, 0x0000001e, 0x000003e1, 0x000000c0, 0x0004002b, 0x0000001e, 0x000003e2,
-    0x00000800, 0x0006002c, 0x000000d7, 0x000003e3, 0x000000bd, 0x000000bd, 0x000000a1, 0x00050036,
-    0x00000002, 0x00000004, 0x00000000, 0x00000003, 0x000200f8, 0x00000005, 0x0004003b, 0x0000001f,
-    0x0000029a, 0x00000007, 0x0004003b, 0x00000009, 0x000002a4, 0x00000007, 0x0004003b, 0x00000009,
-    0x000002ab, 0x00000007, 0x0004003b, 0x0000001f, 0x000002b2, 0x00000007, 0x0004003b, 0x00000021,
-    0x000002bc, 0x00000007, 0x0004003b, 0x00000007, 0x000002bf, 0x00000007, 0x0004003b, 0x00000009,
-    0x000002c9, 0x00000007, 0x0004003b, 0x00000007, 0x000002ca, 0x00000007, 0x0004003b, 0x00000021,
-    0x000002d0, 0x00000007, 0x0004003b, 0x00000021, 0x000002e3, 0x00000007, 0x0004003b, 0x00000021,
-    0x000002f5, 0x00000007, 0x0004003b, 0x00000009, 0x00000316, 0x00000007, 0x0004003b, 0x00000330,
-    0x00000331, 0x00000007, 0x0004003b, 0x00000335, 0x00000336, 0x00000007, 0x0004003b, 0x0000001f,
-    0x00000370, 0x00000007, 0x0004003b, 0x00000009, 0x00000372, 0x00000007, 0x0004003b, 0x00000009,
-    0x00000374, 0x00000007, 0x0004003b, 0x00000021, 0x00000375, 0x00000007, 0x0004003b, 0x00000021,
-    0x00000377, 0x00000007, 0x0004003b, 0x00000021, 0x00000379, 0x00000007, 0x0004003b, 0x00000021,
-    0x0000037b, 0x00000007, 0x0004003b, 0x00000007, 0x0000037d, 0x00000007, 0x0004003b, 0x00000009,
-    0x0000037f, 0x00000007, 0x0004003b, 0x00000007, 0x00000381, 0x00000007, 0x0004003b, 0x0000001f,
-    0x0000038a, 0x00000007, 0x0004003b, 0x00000009, 0x0000038c, 0x00000007, 0x0004003b, 0x00000009,
-    0x0000038e, 0x00000007, 0x0004003b, 0x00000021, 0x0000038f, 0x00000007, 0x0004003b, 0x00000021,
-    0x00000391, 0x00000007, 0x0004003b, 0x00000021, 0x00000393, 0x00000007, 0x0004003b, 0x00000021,
-    0x00000395, 0x00000007, 0x0004003b, 0x00000007, 0x00000397, 0x00000007, 0x0004003b, 0x00000009,
-    0x00000399, 0x00000007, 0x0004003b, 0x00000007, 0x0000039b, 0x00000007, 0x00050041, 0x000000da,
-    0x0000029c, 0x0000029b, 0x00000067, 0x0004003d, 0x00000008, 0x0000029d, 0x0000029c, 0x00050041,
-    0x000000da, 0x0000029e, 0x0000029b, 0x000000a1, 0x0004003d, 0x00000008, 0x0000029f, 0x0000029e,
-    0x00050084, 0x00000008, 0x000002a1, 0x0000029f, 0x000002a0, 0x00050080, 0x00000008, 0x000002a2,
-    0x0000029d, 0x000002a1, 0x0004007c, 0x0000001e, 0x000002a3, 0x000002a2, 0x0003003e, 0x0000029a,
-    0x000002a3, 0x0004003d, 0x0000001e, 0x000002a5, 0x0000029a, 0x00050084, 0x0000001e, 0x000002a6,
-    0x000002a5, 0x0000010d, 0x00050080, 0x0000001e, 0x000002a7, 0x00000107, 0x000002a6, 0x00050080,
-    0x0000001e, 0x000002a8, 0x000002a7, 0x00000107, 0x00060041, 0x00000113, 0x000002a9, 0x00000105,
-    0x00000106, 0x000002a8, 0x0004003d, 0x00000008, 0x000002aa, 0x000002a9, 0x0003003e, 0x000002a4,
-    0x000002aa, 0x0004003d, 0x0000001e, 0x000002ac, 0x0000029a, 0x00050084, 0x0000001e, 0x000002ad,
-    0x000002ac, 0x0000010d, 0x00050080, 0x0000001e, 0x000002ae, 0x00000107, 0x000002ad, 0x00050080,
-    0x0000001e, 0x000002af, 0x000002ae, 0x0000013f, 0x00060041, 0x00000113, 0x000002b0, 0x00000105,
-    0x00000106, 0x000002af, 0x0004003d, 0x00000008, 0x000002b1, 0x000002b0, 0x0003003e, 0x000002ab,
-    0x000002b1, 0x00050041, 0x000000da, 0x000002b4, 0x000002b3, 0x00000067, 0x0004003d, 0x00000008,
-    0x000002b5, 0x000002b4, 0x0004007c, 0x0000001e, 0x000002b6, 0x000002b5, 0x00050041, 0x000000da,
-    0x000002b7, 0x000002b3, 0x000000a1, 0x0004003d, 0x00000008, 0x000002b8, 0x000002b7, 0x0004007c,
-    0x0000001e, 0x000002b9, 0x000002b8, 0x00050084, 0x0000001e, 0x000002ba, 0x000002b9, 0x00000108,
-    0x00050080, 0x0000001e, 0x000002bb, 0x000002b6, 0x000002ba, 0x0003003e, 0x000002b2, 0x000002bb,
-    0x0003003e, 0x000002bc, 0x000002be, 0x000300f7, 0x000002c3, 0x00000000, 0x000400fa, 0x000002c1,
-    0x000002c2, 0x000002c3, 0x000200f8, 0x000002c2, 0x00050041, 0x000000b0, 0x000002c4, 0x000000ae,
-    0x000000af, 0x0004003d, 0x00000008, 0x000002c5, 0x000002c4, 0x000500c7, 0x00000008, 0x000002c6,
-    0x000002c5, 0x00000040, 0x000500ab, 0x00000006, 0x000002c7, 0x000002c6, 0x00000067, 0x000200f9,
-    0x000002c3, 0x000200f8, 0x000002c3, 0x000700f5, 0x00000006, 0x000002c8, 0x000002c1, 0x00000005,
-    0x000002c7, 0x000002c2, 0x0003003e, 0x000002bf, 0x000002c8, 0x0003003e, 0x000002c9, 0x00000067,
-    0x0003003e, 0x000002ca, 0x0000018c, 0x00050041, 0x00000145, 0x000002cb, 0x00000144, 0x0000010d,
-    0x0004003d, 0x00000008, 0x000002cc, 0x000002cb, 0x000500ab, 0x00000006, 0x000002cd, 0x000002cc,
-    0x00000067, 0x000300f7, 0x000002cf, 0x00000000, 0x000400fa, 0x000002cd, 0x000002ce, 0x00000325,
-    0x000200f8, 0x000002ce, 0x0004003d, 0x0000001e, 0x000002d5, 0x000002b2, 0x0004007c, 0x00000008,
-    0x000002d6, 0x000002d5, 0x00050080, 0x00000008, 0x000002d7, 0x00000067, 0x000002d6, 0x00060041,
-    0x00000113, 0x000002d8, 0x000002d4, 0x00000107, 0x000002d7, 0x0004003d, 0x00000008, 0x000002d9,
-    0x000002d8, 0x0004003d, 0x0000001e, 0x000002da, 0x000002b2, 0x0004007c, 0x00000008, 0x000002db,
-    0x000002da, 0x00050080, 0x00000008, 0x000002dc, 0x00000067, 0x000002db, 0x00050080, 0x00000008,
-    0x000002df, 0x000002dc, 0x000002de, 0x00060041, 0x00000113, 0x000002e0, 0x000002d4, 0x00000107,
-    0x000002df, 0x0004003d, 0x00000008, 0x000002e1, 0x000002e0, 0x00050050, 0x00000020, 0x000002e2,
-    0x000002d9, 0x000002e1, 0x0003003e, 0x000002d0, 0x000002e2, 0x0004003d, 0x0000001e, 0x000002e8,
-    0x000002b2, 0x0004007c, 0x00000008, 0x000002e9, 0x000002e8, 0x00050080, 0x00000008, 0x000002ea,
-    0x000002e7, 0x000002e9, 0x00060041, 0x00000113, 0x000002eb, 0x000002d4, 0x00000107, 0x000002ea,
-    0x0004003d, 0x00000008, 0x000002ec, 0x000002eb, 0x0004003d, 0x0000001e, 0x000002ed, 0x000002b2,
-    0x0004007c, 0x00000008, 0x000002ee, 0x000002ed, 0x00050080, 0x00000008, 0x000002ef, 0x000002e7,
-    0x000002ee, 0x00050080, 0x00000008, 0x000002f1, 0x000002ef, 0x000002f0, 0x00060041, 0x00000113,
-    0x000002f2, 0x000002d4, 0x00000107, 0x000002f1, 0x0004003d, 0x00000008, 0x000002f3, 0x000002f2,
-    0x00050050, 0x00000020, 0x000002f4, 0x000002ec, 0x000002f3, 0x0003003e, 0x000002e3, 0x000002f4,
-    0x0004003d, 0x0000001e, 0x000002fa, 0x000002b2, 0x0004007c, 0x00000008, 0x000002fb, 0x000002fa,
-    0x00050080, 0x00000008, 0x000002fc, 0x000002f9, 0x000002fb, 0x00060041, 0x00000113, 0x000002fd,
-    0x000002d4, 0x00000107, 0x000002fc, 0x0004003d, 0x00000008, 0x000002fe, 0x000002fd, 0x0004003d,
-    0x0000001e, 0x000002ff, 0x000002b2, 0x0004007c, 0x00000008, 0x00000300, 0x000002ff, 0x00050080,
-    0x00000008, 0x00000301, 0x000002f9, 0x00000300, 0x00050080, 0x00000008, 0x00000303, 0x00000301,
-    0x00000302, 0x00060041, 0x00000113, 0x00000304, 0x000002d4, 0x00000107, 0x00000303, 0x0004003d,
-    0x00000008, 0x00000305, 0x00000304, 0x00050050, 0x00000020, 0x00000306, 0x000002fe, 0x00000305,
-    0x0003003e, 0x000002f5, 0x00000306, 0x0004003d, 0x00000006, 0x00000307, 0x000002bf, 0x000300f7,
-    0x00000309, 0x00000000, 0x000400fa, 0x00000307, 0x00000308, 0x00000309, 0x000200f8, 0x00000308,
-    0x0004003d, 0x0000001e, 0x0000030e, 0x000002b2, 0x00060041, 0x00000113, 0x0000030f, 0x0000030d,
-    0x00000107, 0x0000030e, 0x0004003d, 0x00000008, 0x00000310, 0x0000030f, 0x0004003d, 0x0000001e,
-    0x00000311, 0x000002b2, 0x00050080, 0x0000001e, 0x00000312, 0x00000311, 0x000002dd, 0x00060041,
-    0x00000113, 0x00000313, 0x0000030d, 0x00000107, 0x00000312, 0x0004003d, 0x00000008, 0x00000314,
-    0x00000313, 0x00050050, 0x00000020, 0x00000315, 0x00000310, 0x00000314, 0x0003003e, 0x000002bc,
-    0x00000315, 0x000200f9, 0x00000309, 0x000200f8, 0x00000309, 0x0004003d, 0x0000001e, 0x0000031b,
-    0x000002b2, 0x00060041, 0x00000113, 0x0000031c, 0x0000031a, 0x00000107, 0x0000031b, 0x0004003d,
-    0x00000008, 0x0000031d, 0x0000031c, 0x0003003e, 0x00000316, 0x0000031d, 0x0004003d, 0x00000008,
-    0x0000031e, 0x00000316, 0x000500c7, 0x00000008, 0x00000320, 0x0000031e, 0x0000031f, 0x0003003e,
-    0x000002c9, 0x00000320, 0x0004003d, 0x00000008, 0x00000321, 0x00000316, 0x000500c7, 0x00000008,
-    0x00000323, 0x00000321, 0x00000322, 0x000500ab, 0x00000006, 0x00000324, 0x00000323, 0x00000067,
-    0x0003003e, 0x000002ca, 0x00000324, 0x000200f9, 0x000002cf, 0x000200f8, 0x00000325, 0x00050041,
-    0x000000b0, 0x00000326, 0x000000ae, 0x000000af, 0x0004003d, 0x00000008, 0x00000327, 0x00000326,
-    0x000500c7, 0x00000008, 0x00000328, 0x00000327, 0x0000016d, 0x000500ab, 0x00000006, 0x00000329,
-    0x00000328, 0x00000067, 0x000300f7, 0x0000032b, 0x00000000, 0x000400fa, 0x00000329, 0x0000032a,
-    0x00000360, 0x000200f8, 0x0000032a, 0x00050041, 0x000000b0, 0x0000032d, 0x000000ae, 0x0000032c,
-    0x0004003d, 0x00000008, 0x0000032e, 0x0000032d, 0x00050050, 0x00000020, 0x0000032f, 0x0000032e,
-    0x00000067, 0x0003003e, 0x000002f5, 0x0000032f, 0x0004006f, 0x000000aa, 0x00000333, 0x00000108,
-    0x00050088, 0x000000aa, 0x00000334, 0x00000332, 0x00000333, 0x0003003e, 0x00000331, 0x00000334,
-    0x0004003d, 0x000000d7, 0x00000337, 0x000002b3, 0x0007004f, 0x00000020, 0x00000338, 0x00000337,
-    0x00000337, 0x00000000, 0x00000001, 0x00040070, 0x000000ab, 0x00000339, 0x00000338, 0x0004003d,
-    0x000000aa, 0x0000033a, 0x00000331, 0x0005008e, 0x000000ab, 0x0000033b, 0x00000339, 0x0000033a,
-    0x00050041, 0x0000033d, 0x0000033e, 0x000000ae, 0x0000033c, 0x0004003d, 0x000000ab, 0x0000033f,
-    0x0000033e, 0x00050081, 0x000000ab, 0x00000340, 0x0000033b, 0x0000033f, 0x0003003e, 0x00000336,
-    0x00000340, 0x0004003d, 0x00000342, 0x00000345, 0x00000344, 0x0004003d, 0x000000ab, 0x00000346,
-    0x00000336, 0x00070058, 0x000000a7, 0x00000348, 0x00000345, 0x00000346, 0x00000002, 0x00000347,
-    0x00050051, 0x00000008, 0x00000349, 0x00000348, 0x00000000, 0x00050050, 0x00000020, 0x0000034a,
-    0x00000349, 0x00000067, 0x0003003e, 0x000002d0, 0x0000034a, 0x0004003d, 0x00000342, 0x0000034c,
-    0x0000034b, 0x0004003d, 0x000000ab, 0x0000034d, 0x00000336, 0x00070058, 0x000000a7, 0x0000034e,
-    0x0000034c, 0x0000034d, 0x00000002, 0x00000347, 0x00050051, 0x00000008, 0x0000034f, 0x0000034e,
-    0x00000000, 0x00050050, 0x00000020, 0x00000350, 0x0000034f, 0x00000067, 0x0003003e, 0x000002e3,
-    0x00000350, 0x00050041, 0x00000009, 0x00000351, 0x000002f5, 0x00000067, 0x0004003d, 0x00000008,
-    0x00000352, 0x00000351, 0x000500c7, 0x00000008, 0x00000353, 0x00000352, 0x00000087, 0x00050041,
-    0x00000009, 0x00000354, 0x000002e3, 0x00000067, 0x0004003d, 0x00000008, 0x00000355, 0x00000354,
-    0x000500c2, 0x00000008, 0x00000357, 0x00000355, 0x00000356, 0x000500c7, 0x00000008, 0x00000358,
-    0x00000357, 0x00000082, 0x000500c5, 0x00000008, 0x00000359, 0x00000353, 0x00000358, 0x00050041,
-    0x00000009, 0x0000035a, 0x000002f5, 0x00000067, 0x0003003e, 0x0000035a, 0x00000359, 0x00050041,
-    0x00000009, 0x0000035c, 0x000002e3, 0x00000067, 0x0004003d, 0x00000008, 0x0000035d, 0x0000035c,
-    0x000500c7, 0x00000008, 0x0000035e, 0x0000035d, 0x0000035b, 0x00050041, 0x00000009, 0x0000035f,
-    0x000002e3, 0x00000067, 0x0003003e, 0x0000035f, 0x0000035e, 0x000200f9, 0x0000032b, 0x000200f8,
-    0x00000360, 0x00050041, 0x000000b0, 0x00000361, 0x000000ae, 0x000000c2, 0x0004003d, 0x00000008,
-    0x00000362, 0x00000361, 0x00050050, 0x00000020, 0x00000363, 0x00000362, 0x00000067, 0x0003003e,
-    0x000002d0, 0x00000363, 0x00050041, 0x000000b0, 0x00000365, 0x000000ae, 0x00000364, 0x0004003d,
-    0x00000008, 0x00000366, 0x00000365, 0x00050050, 0x00000020, 0x00000367, 0x00000366, 0x00000067,
-    0x0003003e, 0x000002e3, 0x00000367, 0x00050041, 0x000000b0, 0x00000368, 0x000000ae, 0x0000032c,
-    0x0004003d, 0x00000008, 0x00000369, 0x00000368, 0x00050050, 0x00000020, 0x0000036a, 0x00000369,
-    0x00000067, 0x0003003e, 0x000002f5, 0x0000036a, 0x000200f9, 0x0000032b, 0x000200f8, 0x0000032b,
-    0x000200f9, 0x000002cf, 0x000200f8, 0x000002cf, 0x00050041, 0x00000145, 0x0000036b, 0x00000144,
-    0x0000010d, 0x0004003d, 0x00000008, 0x0000036c, 0x0000036b, 0x000500aa, 0x00000006, 0x0000036d,
-    0x0000036c, 0x00000067, 0x000300f7, 0x0000036f, 0x00000000, 0x000400fa, 0x0000036d, 0x0000036e,
-    0x0000036f, 0x000200f8, 0x0000036e, 0x0003003e, 0x000002c9, 0x00000067, 0x0003003e, 0x000002ca,
-    0x0000018c, 0x000200f9, 0x0000036f, 0x000200f8, 0x0000036f, 0x0004003d, 0x0000001e, 0x00000371,
-    0x0000029a, 0x0003003e, 0x00000370, 0x00000371, 0x0004003d, 0x00000008, 0x00000373, 0x000002a4,
-    0x0003003e, 0x00000372, 0x00000373, 0x0003003e, 0x00000374, 0x00000067, 0x0004003d, 0x00000020,
-    0x00000376, 0x000002d0, 0x0003003e, 0x00000375, 0x00000376, 0x0004003d, 0x00000020, 0x00000378,
-    0x000002e3, 0x0003003e, 0x00000377, 0x00000378, 0x0004003d, 0x00000020, 0x0000037a, 0x000002f5,
-    0x0003003e, 0x00000379, 0x0000037a, 0x0004003d, 0x00000020, 0x0000037c, 0x000002bc, 0x0003003e,
-    0x0000037b, 0x0000037c, 0x0004003d, 0x00000006, 0x0000037e, 0x000002bf, 0x0003003e, 0x0000037d,
-    0x0000037e, 0x0004003d, 0x00000008, 0x00000380, 0x000002c9, 0x0003003e, 0x0000037f, 0x00000380,
-    0x0004003d, 0x00000006, 0x00000382, 0x000002ca, 0x0003003e, 0x00000381, 0x00000382, 0x000e0039,
-    0x00000002, 0x00000383, 0x0000002d, 0x00000370, 0x00000372, 0x00000374, 0x00000375, 0x00000377,
-    0x00000379, 0x0000037b, 0x0000037d, 0x0000037f, 0x00000381, 0x0004003d, 0x00000020, 0x00000384,
-    0x00000375, 0x0003003e, 0x000002d0, 0x00000384, 0x0004003d, 0x00000020, 0x00000385, 0x00000377,
-    0x0003003e, 0x000002e3, 0x00000385, 0x0004003d, 0x00000020, 0x00000386, 0x00000379, 0x0003003e,
-    0x000002f5, 0x00000386, 0x0004003d, 0x00000020, 0x00000387, 0x0000037b, 0x0003003e, 0x000002bc,
-    0x00000387, 0x0004003d, 0x00000008, 0x00000388, 0x0000037f, 0x0003003e, 0x000002c9, 0x00000388,
-    0x0004003d, 0x00000006, 0x00000389, 0x00000381, 0x0003003e, 0x000002ca, 0x00000389, 0x0004003d,
-    0x0000001e, 0x0000038b, 0x0000029a, 0x0003003e, 0x0000038a, 0x0000038b, 0x0004003d, 0x00000008,
-    0x0000038d, 0x000002ab, 0x0003003e, 0x0000038c, 0x0000038d, 0x0003003e, 0x0000038e, 0x000000bd,
-    0x0004003d, 0x00000020, 0x00000390, 0x000002d0, 0x0003003e, 0x0000038f, 0x00000390, 0x0004003d,
-    0x00000020, 0x00000392, 0x000002e3, 0x0003003e, 0x00000391, 0x00000392, 0x0004003d, 0x00000020,
-    0x00000394, 0x000002f5, 0x0003003e, 0x00000393, 0x00000394, 0x0004003d, 0x00000020, 0x00000396,
-    0x000002bc, 0x0003003e, 0x00000395, 0x00000396, 0x0004003d, 0x00000006, 0x00000398, 0x000002bf,
-    0x0003003e, 0x00000397, 0x00000398, 0x0004003d, 0x00000008, 0x0000039a, 0x000002c9, 0x0003003e,
-    0x00000399, 0x0000039a, 0x0004003d, 0x00000006, 0x0000039c, 0x000002ca, 0x0003003e, 0x0000039b,
-    0x0000039c, 0x000e0039, 0x00000002, 0x0000039d, 0x0000002d, 0x0000038a, 0x0000038c, 0x0000038e,
-    0x0000038f, 0x00000391, 0x00000393, 0x00000395, 0x00000397, 0x00000399, 0x0000039b, 0x0004003d,
-    0x00000020, 0x0000039e, 0x0000038f, 0x0003003e, 0x000002d0, 0x0000039e, 0x0004003d, 0x00000020,
-    0x0000039f, 0x00000391, 0x0003003e, 0x000002e3, 0x0000039f, 0x0004003d, 0x00000020, 0x000003a0,
-    0x00000393, 0x0003003e, 0x000002f5, 0x000003a0, 0x0004003d, 0x00000020, 0x000003a1, 0x00000395,
-    0x0003003e, 0x000002bc, 0x000003a1, 0x0004003d, 0x00000008, 0x000003a2, 0x00000399, 0x0003003e,
-    0x000002c9, 0x000003a2, 0x0004003d, 0x00000006, 0x000003a3, 0x0000039b, 0x0003003e, 0x000002ca,
-    0x000003a3, 0x0004003d, 0x0000001e, 0x000003a4, 0x000002b2, 0x0004007c, 0x00000008, 0x000003a5,
-    0x000003a4, 0x00050080, 0x00000008, 0x000003a6, 0x00000067, 0x000003a5, 0x00050041, 0x00000009,
-    0x000003a7, 0x000002d0, 0x00000067, 0x0004003d, 0x00000008, 0x000003a8, 0x000003a7, 0x00060041,
-    0x00000113, 0x000003a9, 0x000002d4, 0x00000107, 0x000003a6, 0x0003003e, 0x000003a9, 0x000003a8,
-    0x0004003d, 0x0000001e, 0x000003aa, 0x000002b2, 0x0004007c, 0x00000008, 0x000003ab, 0x000003aa,
-    0x00050080, 0x00000008, 0x000003ac, 0x00000067, 0x000003ab, 0x00050080, 0x00000008, 0x000003ae,
-    0x000003ac, 0x000003ad, 0x00050041, 0x00000009, 0x000003af, 0x000002d0, 0x000000a1, 0x0004003d,
-    0x00000008, 0x000003b0, 0x000003af, 0x00060041, 0x00000113, 0x000003b1, 0x000002d4, 0x00000107,
-    0x000003ae, 0x0003003e, 0x000003b1, 0x000003b0, 0x0004003d, 0x0000001e, 0x000003b2, 0x000002b2,
-    0x0004007c, 0x00000008, 0x000003b3, 0x000003b2, 0x00050080, 0x00000008, 0x000003b4, 0x000002e7,
-    0x000003b3, 0x00050041, 0x00000009, 0x000003b5, 0x000002e3, 0x00000067, 0x0004003d, 0x00000008,
-    0x000003b6, 0x000003b5, 0x00060041, 0x00000113, 0x000003b7, 0x000002d4, 0x00000107, 0x000003b4,
-    0x0003003e, 0x000003b7, 0x000003b6, 0x0004003d, 0x0000001e, 0x000003b8, 0x000002b2, 0x0004007c,
-    0x00000008, 0x000003b9, 0x000003b8, 0x00050080, 0x00000008, 0x000003ba, 0x000002e7, 0x000003b9,
-    0x00050080, 0x00000008, 0x000003bc, 0x000003ba, 0x000003bb, 0x00050041, 0x00000009, 0x000003bd,
-    0x000002e3, 0x000000a1, 0x0004003d, 0x00000008, 0x000003be, 0x000003bd, 0x00060041, 0x00000113,
-    0x000003bf, 0x000002d4, 0x00000107, 0x000003bc, 0x0003003e, 0x000003bf, 0x000003be, 0x0004003d,
-    0x0000001e, 0x000003c0, 0x000002b2, 0x0004007c, 0x00000008, 0x000003c1, 0x000003c0, 0x00050080,
-    0x00000008, 0x000003c2, 0x000002f9, 0x000003c1, 0x00050041, 0x00000009, 0x000003c3, 0x000002f5,
-    0x00000067, 0x0004003d, 0x00000008, 0x000003c4, 0x000003c3, 0x00060041, 0x00000113, 0x000003c5,
-    0x000002d4, 0x00000107, 0x000003c2, 0x0003003e, 0x000003c5, 0x000003c4, 0x0004003d, 0x0000001e,
-    0x000003c6, 0x000002b2, 0x0004007c, 0x00000008, 0x000003c7, 0x000003c6, 0x00050080, 0x00000008,
-    0x000003c8, 0x000002f9, 0x000003c7, 0x00050080, 0x00000008, 0x000003ca, 0x000003c8, 0x000003c9,
-    0x00050041, 0x00000009, 0x000003cb, 0x000002f5, 0x000000a1, 0x0004003d, 0x00000008, 0x000003cc,
-    0x000003cb, 0x00060041, 0x00000113, 0x000003cd, 0x000002d4, 0x00000107, 0x000003ca, 0x0003003e,
-    0x000003cd, 0x000003cc, 0x0004003d, 0x00000006, 0x000003ce, 0x000002bf, 0x000300f7, 0x000003d0,
-    0x00000000, 0x000400fa, 0x000003ce, 0x000003cf, 0x000003d0, 0x000200f8, 0x000003cf, 0x0004003d,
-    0x0000001e, 0x000003d1, 0x000002b2, 0x00050041, 0x00000009, 0x000003d2, 0x000002bc, 0x00000067,
-    0x0004003d, 0x00000008, 0x000003d3, 0x000003d2, 0x00060041, 0x00000113, 0x000003d4, 0x0000030d,
-    0x00000107, 0x000003d1, 0x0003003e, 0x000003d4, 0x000003d3, 0x0004003d, 0x0000001e, 0x000003d5,
-    0x000002b2, 0x00050080, 0x0000001e, 0x000003d6, 0x000003d5, 0x000002dd, 0x00050041, 0x00000009,
-    0x000003d7, 0x000002bc, 0x000000a1, 0x0004003d, 0x00000008, 0x000003d8, 0x000003d7, 0x00060041,
-    0x00000113, 0x000003d9, 0x0000030d, 0x00000107, 0x000003d6, 0x0003003e, 0x000003d9, 0x000003d8,
-    0x000200f9, 0x000003d0, 0x000200f8, 0x000003d0, 0x0004003d, 0x0000001e, 0x000003da, 0x000002b2,
-    0x0004003d, 0x00000008, 0x000003db, 0x000002c9, 0x0004003d, 0x00000006, 0x000003dc, 0x000002ca,
-    0x000600a9, 0x00000008, 0x000003dd, 0x000003dc, 0x00000322, 0x00000067, 0x000500c5, 0x00000008,
-    0x000003de, 0x000003db, 0x000003dd, 0x00060041, 0x00000113, 0x000003df, 0x0000031a, 0x00000107,
-    0x000003da, 0x0003003e, 0x000003df, 0x000003de, 0x000100fd, 0x00010038, 0x00050036, 0x00000006,
-    0x00000010, 0x00000000, 0x0000000a, 0x00030037, 0x00000007, 0x0000000b, 0x00030037, 0x00000007,
-    0x0000000c, 0x00030037, 0x00000009, 0x0000000d, 0x00030037, 0x00000009, 0x0000000e, 0x00030037,
-    0x00000009, 0x0000000f, 0x000200f8, 0x00000011, 0x0004003b, 0x00000007, 0x00000043, 0x00000007,
-    0x0004003d, 0x00000006, 0x0000002f, 0x0000000b, 0x000300f7, 0x00000031, 0x00000000, 0x000400fa,
-    0x0000002f, 0x00000030, 0x00000031, 0x000200f8, 0x00000030, 0x0004003d, 0x00000008, 0x00000032,
-    0x0000000d, 0x0004003d, 0x00000008, 0x00000033, 0x0000000e, 0x00050082, 0x00000008, 0x00000034,
-    0x00000032, 0x00000033, 0x00050080, 0x00000008, 0x00000036, 0x00000034, 0x00000035, 0x000500b2,
-    0x00000006, 0x00000038, 0x00000036, 0x00000037, 0x000200fe, 0x00000038, 0x000200f8, 0x00000031,
-    0x0004003d, 0x00000006, 0x0000003a, 0x0000000c, 0x000300f7, 0x0000003c, 0x00000000, 0x000400fa,
-    0x0000003a, 0x0000003b, 0x0000003c, 0x000200f8, 0x0000003b, 0x0004003d, 0x00000008, 0x0000003d,
-    0x0000000f, 0x000500c7, 0x00000008, 0x0000003f, 0x0000003d, 0x0000003e, 0x000500aa, 0x00000006,
-    0x00000041, 0x0000003f, 0x00000040, 0x000200f9, 0x0000003c, 0x000200f8, 0x0000003c, 0x000700f5,
-    0x00000006, 0x00000042, 0x0000003a, 0x00000031, 0x00000041, 0x0000003b, 0x000300f7, 0x00000045,
-    0x00000000, 0x000400fa, 0x00000042, 0x00000044, 0x00000049, 0x000200f8, 0x00000044, 0x0004003d,
-    0x00000008, 0x00000046, 0x0000000e, 0x0004003d, 0x00000008, 0x00000047, 0x0000000d, 0x000500b2,
-    0x00000006, 0x00000048, 0x00000046, 0x00000047, 0x0003003e, 0x00000043, 0x00000048, 0x000200f9,
-    0x00000045, 0x000200f8, 0x00000049, 0x0004003d, 0x00000008, 0x0000004a, 0x0000000e, 0x0004003d,
-    0x00000008, 0x0000004b, 0x0000000d, 0x000500b0, 0x00000006, 0x0000004c, 0x0000004a, 0x0000004b,
-    0x0003003e, 0x00000043, 0x0000004c, 0x000200f9, 0x00000045, 0x000200f8, 0x00000045, 0x0004003d,
-    0x00000006, 0x0000004d, 0x00000043, 0x000200fe, 0x0000004d, 0x00010038, 0x00050036, 0x00000002,
-    0x0000001c, 0x00000000, 0x00000012, 0x00030037, 0x00000009, 0x00000013, 0x00030037, 0x00000009,
-    0x00000014, 0x00030037, 0x00000009, 0x00000015, 0x00030037, 0x00000007, 0x00000016, 0x00030037,
-    0x00000009, 0x00000017, 0x00030037, 0x00000009, 0x00000018, 0x00030037, 0x00000009, 0x00000019,
-    0x00030037, 0x00000009, 0x0000001a, 0x00030037, 0x00000007, 0x0000001b, 0x000200f8, 0x0000001d,
-    0x0004003b, 0x00000009, 0x00000050, 0x00000007, 0x0004003b, 0x00000007, 0x0000006a, 0x00000007,
-    0x0004003b, 0x00000009, 0x0000008b, 0x00000007, 0x0004003b, 0x00000009, 0x0000008f, 0x00000007,
-    0x0004003b, 0x00000009, 0x00000093, 0x00000007, 0x0004003b, 0x00000009, 0x00000096, 0x00000007,
-    0x0004003b, 0x00000009, 0x00000099, 0x00000007, 0x0004003b, 0x00000009, 0x0000009d, 0x00000007,
-    0x0004003d, 0x00000008, 0x00000051, 0x0000001a, 0x000500c7, 0x00000008, 0x00000053, 0x00000051,
-    0x00000052, 0x0004003d, 0x00000008, 0x00000054, 0x0000001a, 0x000500c2, 0x00000008, 0x00000056,
-    0x00000054, 0x00000055, 0x000500c7, 0x00000008, 0x00000058, 0x00000056, 0x00000057, 0x000500c5,
-    0x00000008, 0x00000059, 0x00000053, 0x00000058, 0x000500c5, 0x00000008, 0x0000005b, 0x00000059,
-    0x0000005a, 0x0004003d, 0x00000008, 0x0000005c, 0x00000015, 0x000500c7, 0x00000008, 0x0000005e,
-    0x0000005c, 0x0000005d, 0x000500c5, 0x00000008, 0x0000005f, 0x0000005b, 0x0000005e, 0x0003003e,
-    0x00000050, 0x0000005f, 0x0004003d, 0x00000006, 0x00000060, 0x00000016, 0x000400a8, 0x00000006,
-    0x00000061, 0x00000060, 0x000400a8, 0x00000006, 0x00000062, 0x00000061, 0x000300f7, 0x00000064,
-    0x00000000, 0x000400fa, 0x00000062, 0x00000063, 0x00000064, 0x000200f8, 0x00000063, 0x0004003d,
-    0x00000008, 0x00000065, 0x00000015, 0x000500c7, 0x00000008, 0x00000066, 0x00000065, 0x0000005a,
-    0x000500ab, 0x00000006, 0x00000068, 0x00000066, 0x00000067, 0x000200f9, 0x00000064, 0x000200f8,
-    0x00000064, 0x000700f5, 0x00000006, 0x00000069, 0x00000061, 0x0000001d, 0x00000068, 0x00000063,
-    0x000300f7, 0x0000006c, 0x00000000, 0x000400fa, 0x00000069, 0x0000006b, 0x00000073, 0x000200f8,
-    0x0000006b, 0x0004003d, 0x00000008, 0x0000006d, 0x00000015, 0x000500c7, 0x00000008, 0x0000006f,
-    0x0000006d, 0x0000006e, 0x0004003d, 0x00000008, 0x00000070, 0x00000050, 0x000500c7, 0x00000008,
-    0x00000071, 0x00000070, 0x0000006e, 0x000500ab, 0x00000006, 0x00000072, 0x0000006f, 0x00000071,
-    0x0003003e, 0x0000006a, 0x00000072, 0x000200f9, 0x0000006c, 0x000200f8, 0x00000073, 0x0004003d,
-    0x00000008, 0x00000074, 0x00000015, 0x000500c7, 0x00000008, 0x00000076, 0x00000074, 0x00000075,
-    0x0004003d, 0x00000008, 0x00000077, 0x0000001a, 0x000500c7, 0x00000008, 0x00000078, 0x00000077,
-    0x00000075, 0x000500ab, 0x00000006, 0x00000079, 0x00000076, 0x00000078, 0x0003003e, 0x0000006a,
-    0x00000079, 0x000200f9, 0x0000006c, 0x000200f8, 0x0000006c, 0x0004003d, 0x00000006, 0x0000007a,
-    0x0000006a, 0x000300f7, 0x0000007c, 0x00000000, 0x000400fa, 0x0000007a, 0x0000007b, 0x0000007c,
-    0x000200f8, 0x0000007b, 0x0004003d, 0x00000006, 0x0000007d, 0x0000001b, 0x000300f7, 0x0000007f,
-    0x00000000, 0x000400fa, 0x0000007d, 0x0000007e, 0x0000007f, 0x000200f8, 0x0000007e, 0x0004003d,
-    0x00000008, 0x00000080, 0x00000019, 0x0003003e, 0x00000014, 0x00000080, 0x000200f9, 0x0000007f,
-    0x000200f8, 0x0000007f, 0x0004003d, 0x00000008, 0x00000081, 0x00000015, 0x000500c7, 0x00000008,
-    0x00000083, 0x00000081, 0x00000082, 0x000500aa, 0x00000006, 0x00000084, 0x00000083, 0x00000067,
-    0x000300f7, 0x00000086, 0x00000000, 0x000400fa, 0x00000084, 0x00000085, 0x00000086, 0x000200f8,
-    0x00000085, 0x0004003d, 0x00000008, 0x00000088, 0x00000050, 0x000500c7, 0x00000008, 0x00000089,
-    0x00000088, 0x00000087, 0x0003003e, 0x00000050, 0x00000089, 0x000200f9, 0x00000086, 0x000200f8,
-    0x00000086, 0x0004003d, 0x00000008, 0x0000008a, 0x00000050, 0x0003003e, 0x00000015, 0x0000008a,
-    0x0004003d, 0x00000008, 0x0000008c, 0x00000017, 0x000500c7, 0x00000008, 0x0000008e, 0x0000008c,
-    0x0000008d, 0x0003003e, 0x0000008b, 0x0000008e, 0x0004003d, 0x00000008, 0x00000090, 0x00000017,
-    0x000500c7, 0x00000008, 0x00000092, 0x00000090, 0x00000091, 0x0003003e, 0x0000008f, 0x00000092,
-    0x0004003d, 0x00000008, 0x00000094, 0x00000013, 0x000500c7, 0x00000008, 0x00000095, 0x00000094,
-    0x0000008d, 0x0003003e, 0x00000093, 0x00000095, 0x0004003d, 0x00000008, 0x00000097, 0x00000013,
-    0x000500c7, 0x00000008, 0x00000098, 0x00000097, 0x00000091, 0x0003003e, 0x00000096, 0x00000098,
-    0x0004003d, 0x00000008, 0x0000009a, 0x00000013, 0x000500c7, 0x00000008, 0x0000009c, 0x0000009a,
-    0x0000009b, 0x0003003e, 0x00000099, 0x0000009c, 0x0004003d, 0x00000008, 0x0000009e, 0x00000018,
-    0x000500c2, 0x00000008, 0x000000a0, 0x0000009e, 0x0000009f, 0x00050080, 0x00000008, 0x000000a2,
-    0x000000a0, 0x000000a1, 0x0003003e, 0x0000009d, 0x000000a2, 0x0004003d, 0x00000008, 0x000000a3,
-    0x00000099, 0x000500ab, 0x00000006, 0x000000a4, 0x000000a3, 0x00000067, 0x000300f7, 0x000000a6,
-    0x00000000, 0x000400fa, 0x000000a4, 0x000000a5, 0x000000a6, 0x000200f8, 0x000000a5, 0x00050041,
-    0x000000b0, 0x000000b1, 0x000000ae, 0x000000af, 0x0004003d, 0x00000008, 0x000000b2, 0x000000b1,
-    0x000500c7, 0x00000008, 0x000000b4, 0x000000b2, 0x000000b3, 0x000500ab, 0x00000006, 0x000000b5,
-    0x000000b4, 0x00000067, 0x000200f9, 0x000000a6, 0x000200f8, 0x000000a6, 0x000700f5, 0x00000006,
-    0x000000b6, 0x000000a4, 0x00000086, 0x000000b5, 0x000000a5, 0x000300f7, 0x000000b8, 0x00000000,
-    0x000400fa, 0x000000b6, 0x000000b7, 0x000000b8, 0x000200f8, 0x000000b7, 0x0004003d, 0x00000008,
-    0x000000b9, 0x0000008b, 0x0004003d, 0x00000008, 0x000000ba, 0x0000009d, 0x00050084, 0x00000008,
-    0x000000bb, 0x000000b9, 0x000000ba, 0x0004003d, 0x00000008, 0x000000bc, 0x00000093, 0x0004003d,
-    0x00000008, 0x000000be, 0x0000009d, 0x00050082, 0x00000008, 0x000000bf, 0x000000bd, 0x000000be,
-    0x00050084, 0x00000008, 0x000000c0, 0x000000bc, 0x000000bf, 0x00050080, 0x00000008, 0x000000c1,
-    0x000000bb, 0x000000c0, 0x000500c2, 0x00000008, 0x000000c3, 0x000000c1, 0x000000c2, 0x0003003e,
-    0x0000008b, 0x000000c3, 0x0004003d, 0x00000008, 0x000000c4, 0x0000008f, 0x0004003d, 0x00000008,
-    0x000000c5, 0x0000009d, 0x00050084, 0x00000008, 0x000000c6, 0x000000c4, 0x000000c5, 0x0004003d,
-    0x00000008, 0x000000c7, 0x00000096, 0x0004003d, 0x00000008, 0x000000c8, 0x0000009d, 0x00050082,
-    0x00000008, 0x000000c9, 0x000000bd, 0x000000c8, 0x00050084, 0x00000008, 0x000000ca, 0x000000c7,
-    0x000000c9, 0x00050080, 0x00000008, 0x000000cb, 0x000000c6, 0x000000ca, 0x000500c2, 0x00000008,
-    0x000000cc, 0x000000cb, 0x000000c2, 0x0003003e, 0x0000008f, 0x000000cc, 0x000200f9, 0x000000b8,
-    0x000200f8, 0x000000b8, 0x0004003d, 0x00000008, 0x000000cd, 0x0000008b, 0x000500c7, 0x00000008,
-    0x000000ce, 0x000000cd, 0x0000008d, 0x0004003d, 0x00000008, 0x000000cf, 0x0000008f, 0x000500c7,
-    0x00000008, 0x000000d0, 0x000000cf, 0x00000091, 0x000500c5, 0x00000008, 0x000000d1, 0x000000ce,
-    0x000000d0, 0x0004003d, 0x00000008, 0x000000d2, 0x00000099, 0x0004003d, 0x00000008, 0x000000d3,
-    0x00000018, 0x0007000c, 0x00000008, 0x000000d4, 0x00000001, 0x00000029, 0x000000d2, 0x000000d3,
-    0x000500c5, 0x00000008, 0x000000d5, 0x000000d1, 0x000000d4, 0x0003003e, 0x00000013, 0x000000d5,
-    0x000200f9, 0x0000007c, 0x000200f8, 0x0000007c, 0x000100fd, 0x00010038, 0x00050036, 0x00000002,
-    0x0000002d, 0x00000000, 0x00000022, 0x00030037, 0x0000001f, 0x00000023, 0x00030037, 0x00000009,
-    0x00000024, 0x00030037, 0x00000009, 0x00000025, 0x00030037, 0x00000021, 0x00000026, 0x00030037,
-    0x00000021, 0x00000027, 0x00030037, 0x00000021, 0x00000028, 0x00030037, 0x00000021, 0x00000029,
-    0x00030037, 0x00000007, 0x0000002a, 0x00030037, 0x00000009, 0x0000002b, 0x00030037, 0x00000007,
-    0x0000002c, 0x000200f8, 0x0000002e, 0x0004003b, 0x0000001f, 0x000000d6, 0x00000007, 0x0004003b,
-    0x00000009, 0x000000eb, 0x00000007, 0x0004003b, 0x00000009, 0x000000f4, 0x00000007, 0x0004003b,
-    0x00000009, 0x000000fd, 0x00000007, 0x0004003b, 0x00000009, 0x00000116, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000126, 0x00000007, 0x0004003b, 0x00000009, 0x0000012f, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000136, 0x00000007, 0x0004003b, 0x00000009, 0x00000141, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000153, 0x00000007, 0x0004003b, 0x00000007, 0x0000015c, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000162, 0x00000007, 0x0004003b, 0x00000007, 0x00000168, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000016b, 0x00000007, 0x0004003b, 0x00000009, 0x00000170, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000178, 0x00000007, 0x0004003b, 0x00000009, 0x00000180, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000187, 0x00000007, 0x0004003b, 0x00000007, 0x0000018b, 0x00000007, 0x0004003b,
-    0x00000009, 0x000001a4, 0x00000007, 0x0004003b, 0x00000009, 0x000001a6, 0x00000007, 0x0004003b,
-    0x00000007, 0x000001af, 0x00000007, 0x0004003b, 0x00000007, 0x000001b1, 0x00000007, 0x0004003b,
-    0x00000009, 0x000001b3, 0x00000007, 0x0004003b, 0x00000009, 0x000001b5, 0x00000007, 0x0004003b,
-    0x00000009, 0x000001b7, 0x00000007, 0x0004003b, 0x00000007, 0x000001c8, 0x00000007, 0x0004003b,
-    0x00000007, 0x000001ca, 0x00000007, 0x0004003b, 0x00000009, 0x000001cc, 0x00000007, 0x0004003b,
-    0x00000009, 0x000001cf, 0x00000007, 0x0004003b, 0x00000009, 0x000001d1, 0x00000007, 0x0004003b,
-    0x00000009, 0x000001d8, 0x00000007, 0x0004003b, 0x00000009, 0x000001e2, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000224, 0x00000007, 0x0004003b, 0x00000009, 0x0000022c, 0x00000007, 0x0004003b,
-    0x00000009, 0x0000022f, 0x00000007, 0x0004003b, 0x00000009, 0x00000232, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000235, 0x00000007, 0x0004003b, 0x00000009, 0x00000237, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000239, 0x00000007, 0x0004003b, 0x00000009, 0x0000023b, 0x00000007, 0x0004003b,
-    0x00000009, 0x0000023d, 0x00000007, 0x0004003b, 0x00000007, 0x0000023f, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000252, 0x00000007, 0x0004003b, 0x00000009, 0x00000255, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000258, 0x00000007, 0x0004003b, 0x00000007, 0x0000025b, 0x00000007, 0x0004003b,
-    0x00000009, 0x0000025d, 0x00000007, 0x0004003b, 0x00000009, 0x0000025f, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000261, 0x00000007, 0x0004003b, 0x00000009, 0x00000263, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000265, 0x00000007, 0x0004003b, 0x00000007, 0x00000273, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000275, 0x00000007, 0x0004003b, 0x00000009, 0x00000277, 0x00000007, 0x0004003b,
-    0x00000009, 0x0000027a, 0x00000007, 0x0004003b, 0x00000009, 0x0000027c, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000288, 0x00000007, 0x0004003b, 0x00000007, 0x0000028a, 0x00000007, 0x0004003b,
-    0x00000009, 0x0000028c, 0x00000007, 0x0004003b, 0x00000009, 0x0000028f, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000291, 0x00000007, 0x00050041, 0x000000da, 0x000000db, 0x000000d9, 0x00000067,
-    0x0004003d, 0x00000008, 0x000000dc, 0x000000db, 0x0004007c, 0x0000001e, 0x000000dd, 0x000000dc,
-    0x00050041, 0x000000da, 0x000000de, 0x000000d9, 0x000000a1, 0x0004003d, 0x00000008, 0x000000df,
-    0x000000de, 0x0004007c, 0x0000001e, 0x000000e0, 0x000000df, 0x00050084, 0x0000001e, 0x000000e2,
-    0x000000e0, 0x000000e1, 0x00050080, 0x0000001e, 0x000000e3, 0x000000dd, 0x000000e2, 0x0003003e,
-    0x000000d6, 0x000000e3, 0x000200f9, 0x000000e4, 0x000200f8, 0x000000e4, 0x000400f6, 0x000000e6,
-    0x000000e7, 0x00000000, 0x000200f9, 0x000000e8, 0x000200f8, 0x000000e8, 0x0004003d, 0x00000008,
-    0x000000e9, 0x00000024, 0x000500ab, 0x00000006, 0x000000ea, 0x000000e9, 0x00000067, 0x000400fa,
-    0x000000ea, 0x000000e5, 0x000000e6, 0x000200f8, 0x000000e5, 0x0004003d, 0x00000008, 0x000000ec,
-    0x00000024, 0x0006000c, 0x0000001e, 0x000000ed, 0x00000001, 0x00000049, 0x000000ec, 0x0004007c,
-    0x00000008, 0x000000ee, 0x000000ed, 0x0003003e, 0x000000eb, 0x000000ee, 0x0004003d, 0x00000008,
-    0x000000ef, 0x000000eb, 0x000500c4, 0x00000008, 0x000000f0, 0x000000a1, 0x000000ef, 0x000400c8,
-    0x00000008, 0x000000f1, 0x000000f0, 0x0004003d, 0x00000008, 0x000000f2, 0x00000024, 0x000500c7,
-    0x00000008, 0x000000f3, 0x000000f2, 0x000000f1, 0x0003003e, 0x00000024, 0x000000f3, 0x0004003d,
-    0x0000001e, 0x000000f5, 0x00000023, 0x00050084, 0x0000001e, 0x000000f7, 0x000000f5, 0x000000f6,
-    0x0004007c, 0x00000008, 0x000000f8, 0x000000f7, 0x0004003d, 0x00000008, 0x000000f9, 0x000000eb,
-    0x00050080, 0x00000008, 0x000000fa, 0x000000f8, 0x000000f9, 0x0004003d, 0x00000008, 0x000000fb,
-    0x00000025, 0x00050080, 0x00000008, 0x000000fc, 0x000000fa, 0x000000fb, 0x0003003e, 0x000000f4,
-    0x000000fc, 0x0004003d, 0x00000008, 0x00000111, 0x000000f4, 0x00050080, 0x00000008, 0x00000112,
-    0x00000110, 0x00000111, 0x00060041, 0x00000113, 0x00000114, 0x00000105, 0x00000106, 0x00000112,
-    0x0004003d, 0x00000008, 0x00000115, 0x00000114, 0x0003003e, 0x000000fd, 0x00000115, 0x0004003d,
-    0x00000008, 0x0000011b, 0x000000f4, 0x00050080, 0x00000008, 0x0000011c, 0x0000011a, 0x0000011b,
-    0x00060041, 0x00000113, 0x0000011d, 0x00000105, 0x00000106, 0x0000011c, 0x0004003d, 0x00000008,
-    0x0000011e, 0x0000011d, 0x0003003e, 0x00000116, 0x0000011e, 0x000200f9, 0x0000011f, 0x000200f8,
-    0x0000011f, 0x000400f6, 0x00000121, 0x00000122, 0x00000000, 0x000200f9, 0x00000123, 0x000200f8,
-    0x00000123, 0x0004003d, 0x00000008, 0x00000124, 0x000000fd, 0x000500ab, 0x00000006, 0x00000125,
-    0x00000124, 0x00000067, 0x000400fa, 0x00000125, 0x00000120, 0x00000121, 0x000200f8, 0x00000120,
-    0x0004003d, 0x00000008, 0x00000127, 0x000000fd, 0x0006000c, 0x0000001e, 0x00000128, 0x00000001,
-    0x00000049, 0x00000127, 0x0004007c, 0x00000008, 0x00000129, 0x00000128, 0x0003003e, 0x00000126,
-    0x00000129, 0x0004003d, 0x00000008, 0x0000012a, 0x00000126, 0x000500c4, 0x00000008, 0x0000012b,
-    0x000000a1, 0x0000012a, 0x000400c8, 0x00000008, 0x0000012c, 0x0000012b, 0x0004003d, 0x00000008,
-    0x0000012d, 0x000000fd, 0x000500c7, 0x00000008, 0x0000012e, 0x0000012d, 0x0000012c, 0x0003003e,
-    0x000000fd, 0x0000012e, 0x0004003d, 0x0000001e, 0x00000130, 0x000000d6, 0x0004007c, 0x00000008,
-    0x00000131, 0x00000130, 0x0004003d, 0x00000008, 0x00000132, 0x00000116, 0x00050084, 0x00000008,
-    0x00000133, 0x00000132, 0x000000bd, 0x00050084, 0x00000008, 0x00000134, 0x00000133, 0x000000bd,
-    0x00050080, 0x00000008, 0x00000135, 0x00000131, 0x00000134, 0x0003003e, 0x0000012f, 0x00000135,
-    0x0004003d, 0x00000008, 0x0000013b, 0x0000012f, 0x00060041, 0x00000113, 0x0000013c, 0x0000013a,
-    0x00000107, 0x0000013b, 0x0004003d, 0x00000008, 0x0000013d, 0x0000013c, 0x0003003e, 0x00000136,
-    0x0000013d, 0x0004003d, 0x00000008, 0x0000013e, 0x00000116, 0x00050080, 0x00000008, 0x00000140,
-    0x0000013e, 0x0000013f, 0x0003003e, 0x00000116, 0x00000140, 0x00050041, 0x00000145, 0x00000146,
-    0x00000144, 0x00000107, 0x0004003d, 0x00000008, 0x00000147, 0x00000146, 0x0004003d, 0x00000008,
-    0x00000148, 0x00000126, 0x00050080, 0x00000008, 0x00000149, 0x00000147, 0x00000148, 0x0004003d,
-    0x00000008, 0x0000014a, 0x000000eb, 0x0004003d, 0x00000008, 0x0000014b, 0x00000025, 0x00050080,
-    0x00000008, 0x0000014c, 0x0000014a, 0x0000014b, 0x00050084, 0x00000008, 0x0000014d, 0x0000014c,
-    0x000000bd, 0x00050080, 0x00000008, 0x0000014e, 0x00000149, 0x0000014d, 0x0003003e, 0x00000141,
-    0x0000014e, 0x0004003d, 0x00000008, 0x0000014f, 0x00000136, 0x000500ab, 0x00000006, 0x00000150,
-    0x0000014f, 0x00000067, 0x000300f7, 0x00000152, 0x00000000, 0x000400fa, 0x00000150, 0x00000151,
-    0x00000152, 0x000200f8, 0x00000151, 0x0004003d, 0x00000008, 0x00000159, 0x00000141, 0x00070041,
-    0x00000113, 0x0000015a, 0x00000158, 0x00000107, 0x00000159, 0x00000055, 0x0004003d, 0x00000008,
-    0x0000015b, 0x0000015a, 0x0003003e, 0x00000153, 0x0000015b, 0x0004003d, 0x00000008, 0x0000015d,
-    0x00000141, 0x00070041, 0x00000113, 0x0000015f, 0x00000158, 0x00000107, 0x0000015d, 0x0000015e,
-    0x0004003d, 0x00000008, 0x00000160, 0x0000015f, 0x000500ab, 0x00000006, 0x00000161, 0x00000160,
-    0x00000067, 0x0003003e, 0x0000015c, 0x00000161, 0x0004003d, 0x00000008, 0x00000163, 0x00000153,
-    0x000500c7, 0x00000008, 0x00000165, 0x00000163, 0x00000164, 0x000500aa, 0x00000006, 0x00000167,
-    0x00000165, 0x00000166, 0x0003003e, 0x00000162, 0x00000167, 0x0004003d, 0x00000006, 0x00000169,
-    0x0000002c, 0x0003003e, 0x00000168, 0x00000169, 0x0004003d, 0x00000006, 0x0000016a, 0x00000162,
-    0x0003003e, 0x0000002c, 0x0000016a, 0x0004003d, 0x00000008, 0x0000016c, 0x00000153, 0x000500c7,
-    0x00000008, 0x0000016e, 0x0000016c, 0x0000016d, 0x000500ab, 0x00000006, 0x0000016f, 0x0000016e,
-    0x00000067, 0x0003003e, 0x0000016b, 0x0000016f, 0x0004003d, 0x00000008, 0x00000175, 0x0000012f,
-    0x00060041, 0x00000113, 0x00000176, 0x00000174, 0x00000107, 0x00000175, 0x0004003d, 0x00000008,
-    0x00000177, 0x00000176, 0x0003003e, 0x00000170, 0x00000177, 0x0004003d, 0x00000008, 0x0000017d,
-    0x0000012f, 0x00060041, 0x00000113, 0x0000017e, 0x0000017c, 0x00000107, 0x0000017d, 0x0004003d,
-    0x00000008, 0x0000017f, 0x0000017e, 0x0003003e, 0x00000178, 0x0000017f, 0x00050041, 0x00000009,
-    0x00000181, 0x00000028, 0x00000067, 0x0004003d, 0x00000008, 0x00000182, 0x00000181, 0x0003003e,
-    0x00000180, 0x00000182, 0x0004003d, 0x00000006, 0x00000183, 0x00000162, 0x000400a8, 0x00000006,
-    0x00000184, 0x00000183, 0x000300f7, 0x00000186, 0x00000000, 0x000400fa, 0x00000184, 0x00000185,
-    0x0000026e, 0x000200f8, 0x00000185, 0x0004003d, 0x00000008, 0x00000188, 0x00000153, 0x000500c7,
-    0x00000008, 0x00000189, 0x00000188, 0x00000166, 0x000500aa, 0x00000006, 0x0000018a, 0x00000189,
-    0x00000166, 0x0003003e, 0x00000187, 0x0000018a, 0x0003003e, 0x0000018b, 0x0000018c, 0x0004003d,
-    0x00000006, 0x0000018d, 0x00000187, 0x000300f7, 0x0000018f, 0x00000000, 0x000400fa, 0x0000018d,
-    0x0000018e, 0x0000018f, 0x000200f8, 0x0000018e, 0x0004003d, 0x00000008, 0x00000190, 0x0000002b,
-    0x000500aa, 0x00000006, 0x00000191, 0x00000190, 0x00000067, 0x000300f7, 0x00000193, 0x00000000,
-    0x000400fa, 0x00000191, 0x00000192, 0x00000193, 0x000200f8, 0x00000192, 0x000200f9, 0x00000122,
-    0x000200f8, 0x00000193, 0x0004003d, 0x00000008, 0x00000195, 0x0000002b, 0x000500c7, 0x00000008,
-    0x00000196, 0x00000195, 0x000000a1, 0x000500aa, 0x00000006, 0x00000197, 0x00000196, 0x00000067,
-    0x000300f7, 0x00000199, 0x00000000, 0x000400fa, 0x00000197, 0x00000198, 0x00000199, 0x000200f8,
-    0x00000198, 0x0003003e, 0x0000018b, 0x0000019a, 0x000200f9, 0x00000199, 0x000200f8, 0x00000199,
-    0x0004003d, 0x00000008, 0x0000019b, 0x0000002b, 0x000500c7, 0x00000008, 0x0000019d, 0x0000019b,
-    0x0000019c, 0x000500aa, 0x00000006, 0x0000019e, 0x0000019d, 0x00000067, 0x000300f7, 0x000001a0,
-    0x00000000, 0x000400fa, 0x0000019e, 0x0000019f, 0x000001a0, 0x000200f8, 0x0000019f, 0x0004003d,
-    0x00000008, 0x000001a2, 0x00000180, 0x000500c7, 0x00000008, 0x000001a3, 0x000001a2, 0x000001a1,
-    0x0003003e, 0x00000180, 0x000001a3, 0x000200f9, 0x000001a0, 0x000200f8, 0x000001a0, 0x000200f9,
-    0x0000018f, 0x000200f8, 0x0000018f, 0x0004003d, 0x00000006, 0x000001a5, 0x0000018b, 0x000300f7,
-    0x000001a8, 0x00000000, 0x000400fa, 0x000001a5, 0x000001a7, 0x000001ab, 0x000200f8, 0x000001a7,
-    0x00050041, 0x00000009, 0x000001a9, 0x00000027, 0x000000a1, 0x0004003d, 0x00000008, 0x000001aa,
-    0x000001a9, 0x0003003e, 0x000001a6, 0x000001aa, 0x000200f9, 0x000001a8, 0x000200f8, 0x000001ab,
-    0x00050041, 0x00000009, 0x000001ac, 0x00000027, 0x00000067, 0x0004003d, 0x00000008, 0x000001ad,
-    0x000001ac, 0x0003003e, 0x000001a6, 0x000001ad, 0x000200f9, 0x000001a8, 0x000200f8, 0x000001a8,
-    0x0004003d, 0x00000008, 0x000001ae, 0x000001a6, 0x0003003e, 0x000001a4, 0x000001ae, 0x0004003d,
-    0x00000006, 0x000001b0, 0x0000016b, 0x0003003e, 0x000001af, 0x000001b0, 0x0004003d, 0x00000006,
-    0x000001b2, 0x0000015c, 0x0003003e, 0x000001b1, 0x000001b2, 0x0004003d, 0x00000008, 0x000001b4,
-    0x000001a4, 0x0003003e, 0x000001b3, 0x000001b4, 0x0004003d, 0x00000008, 0x000001b6, 0x00000170,
-    0x0003003e, 0x000001b5, 0x000001b6, 0x0004003d, 0x00000008, 0x000001b8, 0x00000180, 0x0003003e,
-    0x000001b7, 0x000001b8, 0x00090039, 0x00000006, 0x000001b9, 0x00000010, 0x000001af, 0x000001b1,
-    0x000001b3, 0x000001b5, 0x000001b7, 0x000400a8, 0x00000006, 0x000001ba, 0x000001b9, 0x000300f7,
-    0x000001bc, 0x00000000, 0x000400fa, 0x000001ba, 0x000001bb, 0x000001bc, 0x000200f8, 0x000001bb,
-    0x0004003d, 0x00000008, 0x000001bd, 0x00000180, 0x000500c7, 0x00000008, 0x000001bf, 0x000001bd,
-    0x000001be, 0x000500aa, 0x00000006, 0x000001c0, 0x000001bf, 0x00000067, 0x0004003d, 0x00000006,
-    0x000001c1, 0x0000018b, 0x000500a6, 0x00000006, 0x000001c2, 0x000001c0, 0x000001c1, 0x000300f7,
-    0x000001c4, 0x00000000, 0x000400fa, 0x000001c2, 0x000001c3, 0x000001c4, 0x000200f8, 0x000001c3,
-    0x000200f9, 0x00000122, 0x000200f8, 0x000001c4, 0x0003003e, 0x0000018b, 0x0000019a, 0x00050041,
-    0x00000009, 0x000001c6, 0x00000028, 0x000000a1, 0x0004003d, 0x00000008, 0x000001c7, 0x000001c6,
-    0x0003003e, 0x00000180, 0x000001c7, 0x0004003d, 0x00000006, 0x000001c9, 0x0000016b, 0x0003003e,
-    0x000001c8, 0x000001c9, 0x0004003d, 0x00000006, 0x000001cb, 0x0000015c, 0x0003003e, 0x000001ca,
-    0x000001cb, 0x00050041, 0x00000009, 0x000001cd, 0x00000027, 0x000000a1, 0x0004003d, 0x00000008,
-    0x000001ce, 0x000001cd, 0x0003003e, 0x000001cc, 0x000001ce, 0x0004003d, 0x00000008, 0x000001d0,
-    0x00000170, 0x0003003e, 0x000001cf, 0x000001d0, 0x0004003d, 0x00000008, 0x000001d2, 0x00000180,
-    0x0003003e, 0x000001d1, 0x000001d2, 0x00090039, 0x00000006, 0x000001d3, 0x00000010, 0x000001c8,
-    0x000001ca, 0x000001cc, 0x000001cf, 0x000001d1, 0x000400a8, 0x00000006, 0x000001d4, 0x000001d3,
-    0x000300f7, 0x000001d6, 0x00000000, 0x000400fa, 0x000001d4, 0x000001d5, 0x000001d6, 0x000200f8,
-    0x000001d5, 0x000200f9, 0x00000122, 0x000200f8, 0x000001d6, 0x000200f9, 0x000001bc, 0x000200f8,
-    0x000001bc, 0x0004003d, 0x00000008, 0x000001d9, 0x00000153, 0x000500c7, 0x00000008, 0x000001db,
-    0x000001d9, 0x000001da, 0x0003003e, 0x000001d8, 0x000001db, 0x0004003d, 0x00000006, 0x000001dc,
-    0x0000015c, 0x000400a8, 0x00000006, 0x000001dd, 0x000001dc, 0x000300f7, 0x000001df, 0x00000000,
-    0x000400fa, 0x000001dd, 0x000001de, 0x000001df, 0x000200f8, 0x000001de, 0x0004003d, 0x00000008,
-    0x000001e0, 0x000001d8, 0x000500c5, 0x00000008, 0x000001e1, 0x000001e0, 0x00000040, 0x0003003e,
-    0x000001d8, 0x000001e1, 0x000200f9, 0x000001df, 0x000200f8, 0x000001df, 0x0004003d, 0x00000008,
-    0x000001e3, 0x00000136, 0x000500c7, 0x00000008, 0x000001e4, 0x000001e3, 0x0000009b, 0x0003003e,
-    0x000001e2, 0x000001e4, 0x0004003d, 0x00000008, 0x000001e5, 0x000001e2, 0x000500aa, 0x00000006,
-    0x000001e6, 0x000001e5, 0x0000009b, 0x000300f7, 0x000001e8, 0x00000000, 0x000400fa, 0x000001e6,
-    0x000001e7, 0x00000223, 0x000200f8, 0x000001e7, 0x0004003d, 0x00000008, 0x000001e9, 0x00000178,
-    0x0004003d, 0x00000008, 0x000001ea, 0x000001d8, 0x000500c5, 0x00000008, 0x000001eb, 0x000001ea,
-    0x000001e9, 0x0003003e, 0x000001d8, 0x000001eb, 0x0004003d, 0x00000006, 0x000001ec, 0x0000018b,
-    0x000400a8, 0x00000006, 0x000001ed, 0x000001ec, 0x000300f7, 0x000001ef, 0x00000000, 0x000400fa,
-    0x000001ed, 0x000001ee, 0x0000020f, 0x000200f8, 0x000001ee, 0x0004003d, 0x00000008, 0x000001f0,
-    0x000001d8, 0x000500c7, 0x00000008, 0x000001f1, 0x000001f0, 0x000001be, 0x000500ab, 0x00000006,
-    0x000001f2, 0x000001f1, 0x00000067, 0x000300f7, 0x000001f4, 0x00000000, 0x000400fa, 0x000001f2,
-    0x000001f3, 0x000001f4, 0x000200f8, 0x000001f3, 0x00050041, 0x00000009, 0x000001f5, 0x00000026,
-    0x00000067, 0x0004003d, 0x00000008, 0x000001f6, 0x000001f5, 0x00050041, 0x00000009, 0x000001f7,
-    0x00000026, 0x000000a1, 0x0003003e, 0x000001f7, 0x000001f6, 0x00050041, 0x00000009, 0x000001f8,
-    0x00000027, 0x00000067, 0x0004003d, 0x00000008, 0x000001f9, 0x000001f8, 0x00050041, 0x00000009,
-    0x000001fa, 0x00000027, 0x000000a1, 0x0003003e, 0x000001fa, 0x000001f9, 0x00050041, 0x00000009,
-    0x000001fb, 0x00000028, 0x00000067, 0x0004003d, 0x00000008, 0x000001fc, 0x000001fb, 0x00050041,
-    0x00000009, 0x000001fd, 0x00000028, 0x000000a1, 0x0003003e, 0x000001fd, 0x000001fc, 0x0004003d,
-    0x00000006, 0x000001fe, 0x0000002a, 0x000300f7, 0x00000200, 0x00000000, 0x000400fa, 0x000001fe,
-    0x000001ff, 0x00000200, 0x000200f8, 0x000001ff, 0x00050041, 0x00000009, 0x00000201, 0x00000029,
-    0x00000067, 0x0004003d, 0x00000008, 0x00000202, 0x00000201, 0x00050041, 0x00000009, 0x00000203,
-    0x00000029, 0x000000a1, 0x0003003e, 0x00000203, 0x00000202, 0x000200f9, 0x00000200, 0x000200f8,
-    0x00000200, 0x000200f9, 0x000001f4, 0x000200f8, 0x000001f4, 0x0004003d, 0x00000008, 0x00000204,
-    0x00000136, 0x00050041, 0x00000009, 0x00000205, 0x00000026, 0x00000067, 0x0003003e, 0x00000205,
-    0x00000204, 0x0004003d, 0x00000008, 0x00000206, 0x00000170, 0x00050041, 0x00000009, 0x00000207,
-    0x00000027, 0x00000067, 0x0003003e, 0x00000207, 0x00000206, 0x0004003d, 0x00000008, 0x00000208,
-    0x000001d8, 0x00050041, 0x00000009, 0x00000209, 0x00000028, 0x00000067, 0x0003003e, 0x00000209,
-    0x00000208, 0x0004003d, 0x00000006, 0x0000020a, 0x0000002a, 0x000300f7, 0x0000020c, 0x00000000,
-    0x000400fa, 0x0000020a, 0x0000020b, 0x0000020c, 0x000200f8, 0x0000020b, 0x0004003d, 0x00000008,
-    0x0000020d, 0x00000141, 0x00050041, 0x00000009, 0x0000020e, 0x00000029, 0x00000067, 0x0003003e,
-    0x0000020e, 0x0000020d, 0x000200f9, 0x0000020c, 0x000200f8, 0x0000020c, 0x000200f9, 0x000001ef,
-    0x000200f8, 0x0000020f, 0x0004003d, 0x00000008, 0x00000210, 0x00000136, 0x00050041, 0x00000009,
-    0x00000211, 0x00000026, 0x000000a1, 0x0003003e, 0x00000211, 0x00000210, 0x0004003d, 0x00000008,
-    0x00000212, 0x00000170, 0x00050041, 0x00000009, 0x00000213, 0x00000027, 0x000000a1, 0x0003003e,
-    0x00000213, 0x00000212, 0x0004003d, 0x00000008, 0x00000214, 0x000001d8, 0x00050041, 0x00000009,
-    0x00000215, 0x00000028, 0x000000a1, 0x0003003e, 0x00000215, 0x00000214, 0x0004003d, 0x00000006,
-    0x00000216, 0x0000002a, 0x000300f7, 0x00000218, 0x00000000, 0x000400fa, 0x00000216, 0x00000217,
-    0x00000218, 0x000200f8, 0x00000217, 0x0004003d, 0x00000008, 0x00000219, 0x00000141, 0x00050041,
-    0x00000009, 0x0000021a, 0x00000029, 0x000000a1, 0x0003003e, 0x0000021a, 0x00000219, 0x000200f9,
-    0x00000218, 0x000200f8, 0x00000218, 0x000200f9, 0x000001ef, 0x000200f8, 0x000001ef, 0x0004003d,
-    0x00000006, 0x0000021b, 0x0000002a, 0x000300f7, 0x0000021d, 0x00000000, 0x000400fa, 0x0000021b,
-    0x0000021c, 0x0000021d, 0x000200f8, 0x0000021c, 0x0004003d, 0x00000008, 0x0000021e, 0x0000012f,
-    0x0004003d, 0x00000008, 0x0000021f, 0x00000178, 0x000500c5, 0x00000008, 0x00000221, 0x0000021f,
-    0x00000220, 0x00060041, 0x00000113, 0x00000222, 0x0000017c, 0x00000107, 0x0000021e, 0x0003003e,
-    0x00000222, 0x00000221, 0x000200f9, 0x0000021d, 0x000200f8, 0x0000021d, 0x000200f9, 0x000001e8,
-    0x000200f8, 0x00000223, 0x0004003d, 0x00000008, 0x00000225, 0x00000153, 0x000500c7, 0x00000008,
-    0x00000226, 0x00000225, 0x000000fe, 0x000500ab, 0x00000006, 0x00000227, 0x00000226, 0x00000067,
-    0x0003003e, 0x00000224, 0x00000227, 0x0004003d, 0x00000006, 0x00000228, 0x0000018b, 0x000400a8,
-    0x00000006, 0x00000229, 0x00000228, 0x000300f7, 0x0000022b, 0x00000000, 0x000400fa, 0x00000229,
-    0x0000022a, 0x0000022b, 0x000200f8, 0x0000022a, 0x00050041, 0x00000009, 0x0000022d, 0x00000026,
-    0x00000067, 0x0004003d, 0x00000008, 0x0000022e, 0x0000022d, 0x0003003e, 0x0000022c, 0x0000022e,
-    0x00050041, 0x00000009, 0x00000230, 0x00000027, 0x00000067, 0x0004003d, 0x00000008, 0x00000231,
-    0x00000230, 0x0003003e, 0x0000022f, 0x00000231, 0x00050041, 0x00000009, 0x00000233, 0x00000028,
-    0x00000067, 0x0004003d, 0x00000008, 0x00000234, 0x00000233, 0x0003003e, 0x00000232, 0x00000234,
-    0x0004003d, 0x00000006, 0x00000236, 0x00000187, 0x0003003e, 0x00000235, 0x00000236, 0x0004003d,
-    0x00000008, 0x00000238, 0x00000136, 0x0003003e, 0x00000237, 0x00000238, 0x0004003d, 0x00000008,
-    0x0000023a, 0x000001e2, 0x0003003e, 0x00000239, 0x0000023a, 0x0004003d, 0x00000008, 0x0000023c,
-    0x00000170, 0x0003003e, 0x0000023b, 0x0000023c, 0x0004003d, 0x00000008, 0x0000023e, 0x000001d8,
-    0x0003003e, 0x0000023d, 0x0000023e, 0x0004003d, 0x00000006, 0x00000240, 0x00000224, 0x0003003e,
-    0x0000023f, 0x00000240, 0x000d0039, 0x00000002, 0x00000241, 0x0000001c, 0x0000022c, 0x0000022f,
-    0x00000232, 0x00000235, 0x00000237, 0x00000239, 0x0000023b, 0x0000023d, 0x0000023f, 0x0004003d,
-    0x00000008, 0x00000242, 0x0000022c, 0x00050041, 0x00000009, 0x00000243, 0x00000026, 0x00000067,
-    0x0003003e, 0x00000243, 0x00000242, 0x0004003d, 0x00000008, 0x00000244, 0x0000022f, 0x00050041,
-    0x00000009, 0x00000245, 0x00000027, 0x00000067, 0x0003003e, 0x00000245, 0x00000244, 0x0004003d,
-    0x00000008, 0x00000246, 0x00000232, 0x00050041, 0x00000009, 0x00000247, 0x00000028, 0x00000067,
-    0x0003003e, 0x00000247, 0x00000246, 0x000200f9, 0x0000022b, 0x000200f8, 0x0000022b, 0x0004003d,
-    0x00000006, 0x00000248, 0x0000018b, 0x000400a8, 0x00000006, 0x00000249, 0x00000248, 0x000300f7,
-    0x0000024b, 0x00000000, 0x000400fa, 0x00000249, 0x0000024a, 0x0000024b, 0x000200f8, 0x0000024a,
-    0x0004003d, 0x00000008, 0x0000024c, 0x00000180, 0x000500c7, 0x00000008, 0x0000024d, 0x0000024c,
-    0x000001be, 0x000500ab, 0x00000006, 0x0000024e, 0x0000024d, 0x00000067, 0x000200f9, 0x0000024b,
-    0x000200f8, 0x0000024b, 0x000700f5, 0x00000006, 0x0000024f, 0x00000248, 0x0000022b, 0x0000024e,
-    0x0000024a, 0x000300f7, 0x00000251, 0x00000000, 0x000400fa, 0x0000024f, 0x00000250, 0x00000251,
-    0x000200f8, 0x00000250, 0x00050041, 0x00000009, 0x00000253, 0x00000026, 0x000000a1, 0x0004003d,
-    0x00000008, 0x00000254, 0x00000253, 0x0003003e, 0x00000252, 0x00000254, 0x00050041, 0x00000009,
-    0x00000256, 0x00000027, 0x000000a1, 0x0004003d, 0x00000008, 0x00000257, 0x00000256, 0x0003003e,
-    0x00000255, 0x00000257, 0x00050041, 0x00000009, 0x00000259, 0x00000028, 0x000000a1, 0x0004003d,
-    0x00000008, 0x0000025a, 0x00000259, 0x0003003e, 0x00000258, 0x0000025a, 0x0004003d, 0x00000006,
-    0x0000025c, 0x00000187, 0x0003003e, 0x0000025b, 0x0000025c, 0x0004003d, 0x00000008, 0x0000025e,
-    0x00000136, 0x0003003e, 0x0000025d, 0x0000025e, 0x0004003d, 0x00000008, 0x00000260, 0x000001e2,
-    0x0003003e, 0x0000025f, 0x00000260, 0x0004003d, 0x00000008, 0x00000262, 0x00000170, 0x0003003e,
-    0x00000261, 0x00000262, 0x0004003d, 0x00000008, 0x00000264, 0x000001d8, 0x0003003e, 0x00000263,
-    0x00000264, 0x0004003d, 0x00000006, 0x00000266, 0x00000224, 0x0003003e, 0x00000265, 0x00000266,
-    0x000d0039, 0x00000002, 0x00000267, 0x0000001c, 0x00000252, 0x00000255, 0x00000258, 0x0000025b,
-    0x0000025d, 0x0000025f, 0x00000261, 0x00000263, 0x00000265, 0x0004003d, 0x00000008, 0x00000268,
-    0x00000252, 0x00050041, 0x00000009, 0x00000269, 0x00000026, 0x000000a1, 0x0003003e, 0x00000269,
-    0x00000268, 0x0004003d, 0x00000008, 0x0000026a, 0x00000255, 0x00050041, 0x00000009, 0x0000026b,
-    0x00000027, 0x000000a1, 0x0003003e, 0x0000026b, 0x0000026a, 0x0004003d, 0x00000008, 0x0000026c,
-    0x00000258, 0x00050041, 0x00000009, 0x0000026d, 0x00000028, 0x000000a1, 0x0003003e, 0x0000026d,
-    0x0000026c, 0x000200f9, 0x00000251, 0x000200f8, 0x00000251, 0x000200f9, 0x000001e8, 0x000200f8,
-    0x000001e8, 0x000200f9, 0x00000186, 0x000200f8, 0x0000026e, 0x0004003d, 0x00000006, 0x0000026f,
-    0x00000168, 0x000400a8, 0x00000006, 0x00000270, 0x0000026f, 0x000300f7, 0x00000272, 0x00000000,
-    0x000400fa, 0x00000270, 0x00000271, 0x00000272, 0x000200f8, 0x00000271, 0x0003003e, 0x0000002b,
-    0x00000067, 0x000200f9, 0x00000272, 0x000200f8, 0x00000272, 0x0004003d, 0x00000006, 0x00000274,
-    0x0000016b, 0x0003003e, 0x00000273, 0x00000274, 0x0004003d, 0x00000006, 0x00000276, 0x0000015c,
-    0x0003003e, 0x00000275, 0x00000276, 0x00050041, 0x00000009, 0x00000278, 0x00000027, 0x00000067,
-    0x0004003d, 0x00000008, 0x00000279, 0x00000278, 0x0003003e, 0x00000277, 0x00000279, 0x0004003d,
-    0x00000008, 0x0000027b, 0x00000170, 0x0003003e, 0x0000027a, 0x0000027b, 0x00050041, 0x00000009,
-    0x0000027d, 0x00000028, 0x00000067, 0x0004003d, 0x00000008, 0x0000027e, 0x0000027d, 0x0003003e,
-    0x0000027c, 0x0000027e, 0x00090039, 0x00000006, 0x0000027f, 0x00000010, 0x00000273, 0x00000275,
-    0x00000277, 0x0000027a, 0x0000027c, 0x000400a8, 0x00000006, 0x00000280, 0x0000027f, 0x000300f7,
-    0x00000282, 0x00000000, 0x000400fa, 0x00000280, 0x00000281, 0x00000282, 0x000200f8, 0x00000281,
-    0x0003003e, 0x0000002b, 0x000000a1, 0x000200f9, 0x00000282, 0x000200f8, 0x00000282, 0x0004003d,
-    0x00000008, 0x00000283, 0x00000180, 0x000500c7, 0x00000008, 0x00000284, 0x00000283, 0x000001be,
-    0x000500ab, 0x00000006, 0x00000285, 0x00000284, 0x00000067, 0x000300f7, 0x00000287, 0x00000000,
-    0x000400fa, 0x00000285, 0x00000286, 0x00000287, 0x000200f8, 0x00000286, 0x0004003d, 0x00000006,
-    0x00000289, 0x0000016b, 0x0003003e, 0x00000288, 0x00000289, 0x0004003d, 0x00000006, 0x0000028b,
-    0x0000015c, 0x0003003e, 0x0000028a, 0x0000028b, 0x00050041, 0x00000009, 0x0000028d, 0x00000027,
-    0x000000a1, 0x0004003d, 0x00000008, 0x0000028e, 0x0000028d, 0x0003003e, 0x0000028c, 0x0000028e,
-    0x0004003d, 0x00000008, 0x00000290, 0x00000170, 0x0003003e, 0x0000028f, 0x00000290, 0x00050041,
-    0x00000009, 0x00000292, 0x00000028, 0x000000a1, 0x0004003d, 0x00000008, 0x00000293, 0x00000292,
-    0x0003003e, 0x00000291, 0x00000293, 0x00090039, 0x00000006, 0x00000294, 0x00000010, 0x00000288,
-    0x0000028a, 0x0000028c, 0x0000028f, 0x00000291, 0x000400a8, 0x00000006, 0x00000295, 0x00000294,
-    0x000300f7, 0x00000297, 0x00000000, 0x000400fa, 0x00000295, 0x00000296, 0x00000297, 0x000200f8,
-    0x00000296, 0x0004003d, 0x00000008, 0x00000298, 0x0000002b, 0x000500c5, 0x00000008, 0x00000299,
-    0x00000298, 0x0000019c, 0x0003003e, 0x0000002b, 0x00000299, 0x000200f9, 0x00000297, 0x000200f8,
-    0x00000297, 0x000200f9, 0x00000287, 0x000200f8, 0x00000287, 0x000200f9, 0x00000186, 0x000200f8,
-    0x00000186, 0x000200f9, 0x00000152, 0x000200f8, 0x00000152, 0x000200f9, 0x00000122, 0x000200f8,
-    0x00000122, 0x000200f9, 0x0000011f, 0x000200f8, 0x00000121, 0x000200f9, 0x000000e7, 0x000200f8,
-    0x000000e7, 0x000200f9, 0x000000e4, 0x000200f8, 0x000000e6, 0x000100fd, 0x00010038,
+const uint8_t Blob079_Data[6952] =
+{
+    0x28, 0xb5, 0x2f, 0xfd, 0x60, 0x7c, 0x67, 0xf5, 0xd8, 0x00, 0x8a, 0xdd, 0x34, 0x36, 0x36, 0x10,
+    0x78, 0x6f, 0xc6, 0xcc, 0xe4, 0x19, 0x78, 0x06, 0x76, 0x52, 0xc7, 0xe1, 0xcd, 0x36, 0xbb, 0x9d,
+    0x2a, 0x32, 0xf3, 0xac, 0xde, 0xe7, 0x47, 0x3f, 0x9e, 0x24, 0xe1, 0xb5, 0x2e, 0x7b, 0xb7, 0xd8,
+    0x14, 0xf8, 0x14, 0x22, 0xe9, 0x82, 0x02, 0xb6, 0xbc, 0x2a, 0xa5, 0x44, 0xe0, 0x3b, 0x6e, 0x22,
+    0xb2, 0xb7, 0xc8, 0x9d, 0x02, 0x03, 0x03, 0x53, 0x03, 0x7f, 0x03, 0x47, 0xa8, 0x4d, 0xef, 0xe4,
+    0x82, 0xae, 0x9f, 0xad, 0x2d, 0x47, 0x0d, 0xc7, 0x6c, 0x2b, 0xa6, 0xf5, 0xba, 0xb5, 0x6c, 0xfa,
+    0x2a, 0xeb, 0x83, 0xd5, 0xa9, 0xb5, 0x34, 0xf6, 0xfa, 0x02, 0xbe, 0xcd, 0x67, 0x05, 0xdb, 0x57,
+    0xc9, 0xc4, 0xf4, 0xc0, 0xe1, 0xd2, 0xb2, 0x12, 0x03, 0xa5, 0x64, 0x23, 0x63, 0x04, 0x45, 0x44,
+    0xc3, 0xf2, 0xae, 0x8f, 0xdf, 0xd4, 0xc8, 0xe2, 0x31, 0x57, 0x4e, 0xc6, 0x7a, 0xa3, 0xdc, 0xee,
+    0xb7, 0x9f, 0x86, 0x46, 0xf4, 0xe5, 0xf0, 0x77, 0x17, 0xaa, 0x77, 0x5e, 0x7f, 0x5b, 0xaf, 0xce,
+    0x39, 0x63, 0xc5, 0x55, 0xb7, 0xfc, 0xa7, 0xe6, 0xdd, 0xaf, 0xbe, 0xdb, 0xfd, 0xe5, 0x6b, 0x52,
+    0x7e, 0x49, 0x5e, 0x06, 0xe3, 0x79, 0xff, 0x49, 0xb8, 0xa6, 0x74, 0x29, 0x4d, 0x1a, 0x0a, 0xfa,
+    0x27, 0x06, 0xb3, 0x7d, 0xea, 0x9e, 0xdf, 0xb6, 0xce, 0x7f, 0x31, 0x9c, 0xa6, 0x9a, 0xdb, 0xb8,
+    0x2c, 0xd6, 0xd9, 0x6c, 0x10, 0x59, 0xcb, 0x4a, 0x4a, 0xc9, 0x0a, 0x8b, 0x89, 0x86, 0x65, 0x72,
+    0xce, 0xc5, 0xfd, 0xfa, 0x1a, 0xec, 0xe1, 0xd5, 0x95, 0x8d, 0x85, 0x7d, 0x75, 0x6d, 0x65, 0x59,
+    0xd1, 0x55, 0xf4, 0xd3, 0x5f, 0x39, 0x45, 0x72, 0x84, 0x48, 0xa9, 0x90, 0x1a, 0x33, 0x3e, 0x63,
+    0x0c, 0xe2, 0x3a, 0x3e, 0x7e, 0xa1, 0xf9, 0xdf, 0x0d, 0x8b, 0xb9, 0xb9, 0xdd, 0xe4, 0x47, 0x76,
+    0xcd, 0x8b, 0x89, 0x7a, 0xe2, 0xe1, 0xae, 0xeb, 0xd7, 0xb1, 0x60, 0x17, 0x2c, 0x37, 0x0e, 0xfc,
+    0xef, 0x1f, 0x20, 0xdf, 0x1e, 0xf9, 0x3f, 0x2f, 0xbb, 0x86, 0x63, 0xe7, 0x88, 0x38, 0xdc, 0xbe,
+    0xbd, 0xb5, 0x7f, 0xdb, 0x0b, 0xb2, 0x87, 0x38, 0xf6, 0xc3, 0xdf, 0xb8, 0xbd, 0xfa, 0x77, 0x31,
+    0x1a, 0xfd, 0x3f, 0x16, 0xdf, 0x2d, 0xb8, 0xde, 0x85, 0xf1, 0xb1, 0xdd, 0xde, 0x4e, 0xd6, 0xbf,
+    0x6b, 0x7f, 0x77, 0xf7, 0x58, 0x3b, 0xee, 0x58, 0xad, 0x8b, 0x8f, 0xfd, 0xee, 0xb7, 0x17, 0xd8,
+    0x9f, 0xeb, 0xe5, 0x7d, 0x8c, 0xa7, 0x91, 0xdd, 0xb2, 0xf7, 0x1d, 0xf6, 0xed, 0xc6, 0xb8, 0x5e,
+    0xd3, 0x7f, 0x98, 0xdf, 0xe9, 0xe5, 0xdf, 0xd3, 0x02, 0xc9, 0xe5, 0x39, 0xb4, 0x1f, 0x9f, 0x81,
+    0x91, 0xef, 0xbc, 0xb8, 0x0e, 0xf3, 0x6e, 0x7e, 0xf8, 0x1d, 0x5b, 0x01, 0x42, 0x91, 0x8b, 0x0e,
+    0xbb, 0x6e, 0x86, 0x42, 0x3a, 0xbe, 0xdb, 0xf5, 0xfc, 0x4d, 0xce, 0xf9, 0x3d, 0xd0, 0xfb, 0xcd,
+    0xdb, 0x70, 0x1e, 0x4e, 0xcf, 0xe7, 0xc8, 0x77, 0xdb, 0xc0, 0xbd, 0xfb, 0xd5, 0x0b, 0xe7, 0xb9,
+    0xce, 0xbd, 0x66, 0xbb, 0xe1, 0xb3, 0x30, 0xf6, 0xbf, 0x06, 0xe3, 0x79, 0x1d, 0xbd, 0xfd, 0x6e,
+    0xbe, 0xeb, 0x62, 0xbb, 0xeb, 0xff, 0x97, 0x75, 0xb1, 0xde, 0xbf, 0x9e, 0x03, 0x02, 0x96, 0xd1,
+    0x76, 0x70, 0x99, 0x9c, 0xd7, 0x85, 0xbf, 0x68, 0x6f, 0x03, 0xba, 0x41, 0xf3, 0x45, 0xcd, 0x2d,
+    0x2c, 0xfe, 0xee, 0x85, 0x61, 0x37, 0x30, 0xce, 0x15, 0xc3, 0xf9, 0x81, 0xbd, 0xa8, 0x59, 0xdd,
+    0xad, 0x49, 0xf6, 0x5d, 0x64, 0x7f, 0x8c, 0x0f, 0xee, 0x5f, 0xb4, 0x1c, 0xed, 0xe3, 0xfc, 0x0e,
+    0xf8, 0x0d, 0xb4, 0xdb, 0x7a, 0xc5, 0x6b, 0xda, 0xdb, 0x06, 0xa7, 0x65, 0xf1, 0xbb, 0xb0, 0x58,
+    0x7c, 0x87, 0xfd, 0x3d, 0x9c, 0x36, 0x26, 0x7f, 0xd5, 0xea, 0xec, 0xff, 0x03, 0xe6, 0x75, 0x67,
+    0xf4, 0x1e, 0xc6, 0xbf, 0x3a, 0x9e, 0x77, 0x7d, 0x72, 0x58, 0xec, 0x45, 0x04, 0x8b, 0xe7, 0x06,
+    0xcb, 0x0a, 0xec, 0x41, 0x5d, 0x0c, 0xf8, 0x0d, 0xe3, 0xe1, 0x7b, 0x1e, 0xc7, 0x02, 0x0f, 0x1c,
+    0x83, 0x71, 0x11, 0x67, 0x98, 0x1d, 0x2e, 0xd9, 0x2a, 0xd1, 0xea, 0x26, 0xbb, 0xe1, 0x1c, 0xfc,
+    0x37, 0xe7, 0x56, 0x98, 0xeb, 0xe3, 0xaa, 0xbf, 0xc1, 0x5f, 0x6e, 0x38, 0xdf, 0xa9, 0x72, 0x2f,
+    0xae, 0xe7, 0x85, 0xe2, 0x34, 0x41, 0x2e, 0xae, 0xef, 0x04, 0xf4, 0x3c, 0x1c, 0xfe, 0x1a, 0x4e,
+    0xbd, 0x54, 0x14, 0xd4, 0xef, 0x39, 0x19, 0x10, 0x50, 0x6e, 0xc0, 0x73, 0x9f, 0xee, 0x74, 0x5c,
+    0xc0, 0xff, 0x65, 0x95, 0x0b, 0xbf, 0x52, 0x82, 0x64, 0x3c, 0x2e, 0x27, 0xeb, 0xb8, 0x38, 0x8d,
+    0x4c, 0xce, 0xb9, 0x62, 0x7d, 0xae, 0xc0, 0xfb, 0xec, 0x5f, 0xdd, 0xf0, 0xc8, 0xa8, 0xe8, 0x8c,
+    0xab, 0x93, 0x89, 0xd2, 0x86, 0x0c, 0xc5, 0x5d, 0x3c, 0xd0, 0x8e, 0xfc, 0x15, 0x7a, 0x3c, 0x08,
+    0x48, 0x17, 0x83, 0xc5, 0xdc, 0x1f, 0xa9, 0x3d, 0x9c, 0x73, 0xcb, 0x60, 0x72, 0x18, 0xd7, 0xef,
+    0x76, 0x31, 0x78, 0x0e, 0x49, 0xdf, 0xf7, 0xb3, 0x9e, 0x1c, 0xfc, 0xdd, 0x79, 0xfe, 0x77, 0x72,
+    0x77, 0xc7, 0x30, 0xff, 0xe6, 0x79, 0xc3, 0x5f, 0x2e, 0x0e, 0xa8, 0x03, 0xc6, 0xcb, 0x84, 0x79,
+    0x4e, 0xf6, 0xcb, 0x61, 0x58, 0x7f, 0x52, 0xe4, 0x9c, 0x4c, 0xc6, 0xe7, 0x76, 0x72, 0x7e, 0x17,
+    0xb8, 0x8f, 0x73, 0x35, 0x9f, 0x2c, 0xb6, 0x5b, 0x06, 0x73, 0xc3, 0x5f, 0xed, 0xe7, 0x85, 0xdf,
+    0x9d, 0x9b, 0xeb, 0xdf, 0xae, 0x5f, 0x1e, 0xfe, 0x82, 0xfd, 0x72, 0x30, 0xe2, 0x4e, 0xf6, 0x1b,
+    0x8f, 0xb9, 0x7e, 0x08, 0xe0, 0xd8, 0xe4, 0xe4, 0xd8, 0xfc, 0x70, 0xae, 0xa2, 0x74, 0x7d, 0x65,
+    0x02, 0x80, 0xf5, 0xf9, 0xfc, 0xa7, 0x33, 0x51, 0x3f, 0xfc, 0xc5, 0x07, 0xb1, 0xd9, 0x9e, 0xe7,
+    0xf9, 0xab, 0x2d, 0x2d, 0x03, 0xdd, 0x9d, 0x6c, 0x00, 0xce, 0x0e, 0x8e, 0xcd, 0xfe, 0xbf, 0x3e,
+    0xfd, 0x00, 0xbe, 0xc6, 0xf2, 0xda, 0xcf, 0xf9, 0x6b, 0xfd, 0xb7, 0x00, 0xba, 0x0e, 0x09, 0x4c,
+    0xdd, 0x12, 0xb4, 0xb9, 0xd1, 0xd1, 0x6b, 0x6d, 0x29, 0xf6, 0xb8, 0xd6, 0xd4, 0x10, 0xa0, 0x99,
+    0x71, 0x85, 0x99, 0x35, 0x96, 0x75, 0x8a, 0x91, 0x8d, 0x81, 0x7d, 0x85, 0x75, 0x62, 0xc0, 0x02,
+    0xe3, 0xf4, 0xfa, 0xea, 0x1c, 0x7f, 0x97, 0x17, 0x93, 0xdc, 0x67, 0x97, 0x13, 0x2d, 0xac, 0x03,
+    0x59, 0x5a, 0x9c, 0x15, 0xb4, 0x07, 0xc4, 0x56, 0xaa, 0x06, 0xac, 0x0a, 0x18, 0xa8, 0x2a, 0x40,
+    0xe0, 0x01, 0x81, 0x29, 0xaa, 0x55, 0xa9, 0xa9, 0xeb, 0x60, 0x94, 0x14, 0x54, 0x14, 0xd4, 0x00,
+    0xfa, 0xc8, 0x93, 0x53, 0x93, 0x80, 0x26, 0xa6, 0xa5, 0x9a, 0x49, 0x48, 0x29, 0x49, 0x08, 0x29,
+    0xe9, 0xc8, 0x08, 0xe9, 0x68, 0xfb, 0x41, 0xa0, 0x40, 0x41, 0x3f, 0x40, 0x01, 0x7e, 0xa4, 0xd4,
+    0x01, 0x3c, 0x01, 0xd4, 0x3e, 0x3d, 0x9e, 0x3c, 0xff, 0xbf, 0xd5, 0xde, 0xf5, 0x36, 0xf4, 0xb6,
+    0x6d, 0xd5, 0x37, 0xf6, 0x7f, 0xb6, 0xae, 0xb1, 0x4f, 0xd7, 0xf5, 0xb3, 0x5e, 0xeb, 0x6f, 0x75,
+    0xf3, 0xa6, 0x8d, 0x1b, 0x36, 0xac, 0x6d, 0xd6, 0xb0, 0x59, 0x83, 0x26, 0xf5, 0x0c, 0x18, 0x34,
+    0x66, 0xce, 0x94, 0x31, 0x43, 0x66, 0x4c, 0x19, 0x31, 0x63, 0xc2, 0x88, 0x09, 0xf3, 0x05, 0x8c,
+    0x97, 0x2f, 0x5d, 0xb6, 0x78, 0xe1, 0xd2, 0x85, 0xcb, 0x15, 0x53, 0x2b, 0xa8, 0x57, 0xe6, 0xaa,
+    0x58, 0xa1, 0x52, 0x65, 0x4a, 0x14, 0x2a, 0x50, 0xa2, 0x3c, 0x81, 0xf2, 0xe4, 0x14, 0xd5, 0xc9,
+    0x92, 0x53, 0xaf, 0x13, 0x26, 0x4d, 0x16, 0x3d, 0x99, 0x18, 0xa9, 0x07, 0x18, 0x29, 0x72, 0x84,
+    0x48, 0x91, 0x21, 0x44, 0xd4, 0x86, 0x20, 0x38, 0xa3, 0x2c, 0x25, 0x15, 0x12, 0x2a, 0x9a, 0x15,
+    0x62, 0xab, 0xfa, 0x60, 0xf5, 0x06, 0x19, 0xb5, 0x3b, 0xcd, 0x80, 0x04, 0x19, 0xfd, 0x01, 0xe4,
+    0x85, 0x8b, 0x1f, 0x30, 0x44, 0x45, 0x7b, 0xac, 0x79, 0x1f, 0xab, 0x3b, 0x40, 0x73, 0x78, 0xe2,
+    0xa0, 0x91, 0x43, 0x7b, 0x03, 0x87, 0x8d, 0x1b, 0x35, 0x6c, 0x9c, 0x6b, 0xcc, 0xa0, 0x21, 0x63,
+    0x86, 0xf7, 0x53, 0x46, 0x8c, 0x4e, 0x18, 0x31, 0x5e, 0xc0, 0x28, 0x73, 0xf1, 0xa2, 0x85, 0x0b,
+    0x16, 0x2d, 0x58, 0x70, 0x6a, 0xae, 0xe0, 0xd4, 0xaa, 0xb0, 0xb3, 0x2b, 0x6c, 0x15, 0xd7, 0x3b,
+    0x85, 0x19, 0xc5, 0xa6, 0x12, 0x08, 0x14, 0x63, 0xf5, 0x93, 0x99, 0x38, 0xb1, 0x78, 0x16, 0x61,
+    0xc2, 0x5c, 0xe2, 0xac, 0x7d, 0x1c, 0x41, 0xe2, 0x3c, 0x22, 0x84, 0x08, 0xed, 0x18, 0x1d, 0xe2,
+    0xc9, 0x59, 0x26, 0xa6, 0x07, 0x0e, 0x97, 0x96, 0x95, 0x18, 0x28, 0x25, 0x1b, 0x19, 0x23, 0xdc,
+    0x8a, 0x88, 0x86, 0xe5, 0xa6, 0x5d, 0xdf, 0x8e, 0x97, 0xb8, 0xb6, 0xb0, 0x6a, 0x21, 0xd5, 0x54,
+    0xd3, 0x52, 0xd2, 0xd0, 0x1b, 0xb4, 0xc9, 0x73, 0xa9, 0x53, 0x73, 0x7b, 0x83, 0x58, 0xca, 0xaa,
+    0x79, 0x2c, 0xcd, 0x75, 0xd6, 0x91, 0xea, 0xa4, 0xea, 0xaf, 0xf0, 0xb8, 0xfa, 0x2a, 0x59, 0xa4,
+    0x39, 0x5a, 0xd8, 0xdd, 0x6f, 0xb0, 0xcd, 0xfb, 0x37, 0xb6, 0x57, 0x4b, 0x43, 0xfb, 0xb4, 0x33,
+    0xb4, 0xa3, 0xbf, 0x9e, 0x15, 0xd1, 0x63, 0x39, 0x62, 0x9d, 0x5b, 0x65, 0x59, 0x9c, 0x9c, 0x57,
+    0x4c, 0x77, 0x55, 0xed, 0x54, 0x2f, 0x19, 0x15, 0x11, 0x15, 0x0d, 0x11, 0x0d, 0x25, 0xed, 0xd4,
+    0x3a, 0x75, 0x9d, 0x83, 0x53, 0xd3, 0x6a, 0xb6, 0xb0, 0xae, 0xaa, 0x49, 0xb3, 0x9a, 0x86, 0x8c,
+    0x77, 0x8b, 0x96, 0x9d, 0x2c, 0x58, 0xbc, 0xf4, 0x14, 0x9c, 0x47, 0x29, 0x4b, 0x94, 0xd0, 0x48,
+    0xe8, 0x1e, 0xf6, 0xf3, 0xa0, 0x99, 0xaa, 0x5a, 0x3f, 0xb7, 0x74, 0x09, 0x3a, 0xf3, 0x99, 0xcc,
+    0xff, 0xa4, 0x67, 0x47, 0x6b, 0x9b, 0x33, 0x1d, 0x02, 0xc4, 0x14, 0xa5, 0x4d, 0x60, 0x51, 0x31,
+    0x51, 0x11, 0x31, 0x11, 0x71, 0x27, 0xeb, 0x64, 0x42, 0x9d, 0xd0, 0xec, 0x07, 0xff, 0x01, 0xaf,
+    0xba, 0x38, 0x0e, 0xf6, 0xf4, 0xf2, 0xf4, 0xf0, 0xf2, 0xf0, 0xb4, 0x9c, 0xda, 0x57, 0xba, 0xfb,
+    0x1d, 0x2d, 0x82, 0xad, 0x5a, 0x1a, 0xda, 0x36, 0xed, 0x71, 0xae, 0x65, 0x60, 0x5f, 0x5e, 0x5f,
+    0x5d, 0x5d, 0x45, 0x46, 0x44, 0x45, 0x69, 0x86, 0x88, 0x86, 0xb4, 0x3f, 0xde, 0x1e, 0x1f, 0x2d,
+    0xcf, 0x6d, 0xee, 0xd9, 0xd1, 0xe1, 0xa1, 0x77, 0xfe, 0x1f, 0x75, 0x70, 0x72, 0x78, 0xe0, 0x58,
+    0x89, 0xdc, 0xda, 0xaf, 0xf5, 0xda, 0xac, 0xbf, 0xb1, 0x76, 0x36, 0xac, 0xd6, 0xc1, 0x32, 0xd1,
+    0x29, 0xae, 0xdf, 0x5a, 0x2b, 0xd1, 0x49, 0xd7, 0xeb, 0x23, 0xa5, 0x68, 0x45, 0xfa, 0x37, 0x66,
+    0x69, 0xac, 0x68, 0xaf, 0x4f, 0x50, 0xc3, 0x9c, 0x5c, 0x4f, 0xb5, 0x4e, 0xb2, 0xa2, 0x4c, 0x3a,
+    0x3e, 0xb5, 0x30, 0xea, 0x17, 0x2e, 0xc2, 0x58, 0xd0, 0x2d, 0x3a, 0x57, 0x28, 0xf1, 0xd0, 0x9c,
+    0x9d, 0x4c, 0x9c, 0x42, 0x29, 0x56, 0x20, 0xa9, 0xc0, 0xa6, 0xb8, 0x9e, 0x89, 0x48, 0x2c, 0x65,
+    0xbe, 0x65, 0xd9, 0x85, 0x6f, 0x65, 0x6c, 0x8d, 0x74, 0x2c, 0xfb, 0xf2, 0x33, 0x86, 0xdf, 0xdb,
+    0xfa, 0x4b, 0x3d, 0x7d, 0xcf, 0xe0, 0x5b, 0xf5, 0xb4, 0x78, 0x4a, 0x55, 0xc8, 0xd4, 0xfd, 0x9b,
+    0xbd, 0x19, 0x19, 0xb6, 0x8b, 0xfe, 0x2d, 0x2d, 0xd5, 0xdd, 0xb4, 0xe4, 0xf4, 0x3b, 0x4c, 0x4d,
+    0x34, 0xd3, 0x90, 0xd2, 0xd2, 0x55, 0x29, 0x40, 0xd3, 0x16, 0xa7, 0x49, 0xbb, 0x7d, 0x6d, 0xd0,
+    0x8d, 0xb5, 0x81, 0xea, 0xa6, 0x9f, 0xa2, 0x9c, 0x54, 0xfa, 0x5a, 0x05, 0xfb, 0xf6, 0x56, 0x5f,
+    0xd5, 0x7a, 0x8c, 0x8c, 0x88, 0x88, 0x86, 0x7c, 0xea, 0x9d, 0x9c, 0x1a, 0xe7, 0xa6, 0x97, 0x24,
+    0xb1, 0x91, 0x20, 0x7d, 0x1a, 0xe5, 0x64, 0xda, 0x8b, 0x8b, 0x89, 0x89, 0x88, 0xd9, 0x7d, 0xd7,
+    0x75, 0xc2, 0xeb, 0xde, 0x5e, 0xde, 0xe7, 0x55, 0xd9, 0x78, 0x52, 0x38, 0x4f, 0x5b, 0x26, 0x6d,
+    0x1b, 0x1a, 0x12, 0x11, 0x90, 0x96, 0xc6, 0x5e, 0x1f, 0x0d, 0x0c, 0xcc, 0xcb, 0xab, 0xeb, 0x8a,
+    0xf3, 0x5a, 0xed, 0x35, 0xcb, 0xa3, 0x2e, 0x41, 0x9b, 0xaf, 0xff, 0x35, 0x7d, 0xc5, 0x5e, 0xbf,
+    0x35, 0x6b, 0xcc, 0xac, 0xab, 0x6a, 0xd2, 0xac, 0x0a, 0x50, 0x55, 0x3a, 0xf3, 0x54, 0xe6, 0xcc,
+    0xa8, 0x99, 0x32, 0x42, 0xce, 0x64, 0x7e, 0x7c, 0x19, 0x23, 0xe6, 0xcb, 0xbb, 0x5d, 0xc3, 0xe8,
+    0x80, 0xc9, 0xa2, 0x25, 0x8b, 0x17, 0xaf, 0x97, 0xa7, 0x2e, 0x5c, 0xb8, 0xfc, 0x16, 0x2d, 0x69,
+    0xb0, 0x60, 0x49, 0x6d, 0x72, 0x25, 0xd5, 0x6c, 0xe5, 0x8a, 0xd2, 0x63, 0x95, 0x29, 0x54, 0xce,
+    0x53, 0xa4, 0x44, 0xf1, 0xa2, 0x42, 0xb1, 0xac, 0xa4, 0x94, 0xac, 0x70, 0x2f, 0x26, 0x1a, 0x6e,
+    0xcb, 0xe4, 0xfc, 0xe6, 0xe2, 0x7e, 0x7d, 0x0d, 0xee, 0x3d, 0xbc, 0xba, 0xb2, 0x7b, 0x2c, 0xec,
+    0xab, 0x6b, 0xeb, 0xce, 0xb2, 0xaa, 0xa2, 0x9f, 0xee, 0x2b, 0xa7, 0x48, 0x8e, 0x10, 0x29, 0x15,
+    0x72, 0xd7, 0x98, 0xf1, 0x19, 0xe3, 0xc5, 0xa6, 0xe6, 0x64, 0xe4, 0x6d, 0x3e, 0x1c, 0x6f, 0x05,
+    0x03, 0xff, 0xf8, 0x6e, 0xbb, 0x33, 0x2e, 0x2b, 0xa8, 0xab, 0x90, 0x1b, 0x34, 0x5f, 0xbe, 0x89,
+    0x81, 0x2a, 0x2a, 0x02, 0xf7, 0x94, 0x54, 0x14, 0x54, 0xd3, 0x80, 0xa7, 0xad, 0x80, 0x25, 0xa7,
+    0x02, 0xf4, 0xe2, 0x22, 0x93, 0x9f, 0x25, 0x4c, 0x94, 0x4c, 0x5d, 0x97, 0xdc, 0xaf, 0x43, 0xa4,
+    0x04, 0x33, 0x89, 0x29, 0x12, 0x20, 0x96, 0xa6, 0x95, 0x47, 0x2e, 0x18, 0x19, 0x9d, 0x2c, 0x62,
+    0xc3, 0x06, 0x91, 0xca, 0x21, 0x44, 0x4a, 0x87, 0x90, 0x96, 0x0a, 0x21, 0x15, 0xd2, 0x61, 0x14,
+    0x48, 0x10, 0x20, 0x95, 0x3f, 0x7c, 0x88, 0xfa, 0xe0, 0xd1, 0x23, 0x94, 0xc7, 0x0e, 0x1d, 0xa1,
+    0x8e, 0x3b, 0x2e, 0x41, 0x71, 0xe4, 0x78, 0x14, 0x81, 0x63, 0xf2, 0x46, 0x0d, 0x1b, 0x35, 0x68,
+    0xd8, 0x40, 0x01, 0xa9, 0x49, 0x63, 0x73, 0x53, 0xc6, 0x8c, 0x4f, 0x19, 0x31, 0x3c, 0x5f, 0x7c,
+    0x0c, 0x14, 0x9b, 0x28, 0x34, 0x37, 0x35, 0x31, 0x4f, 0x88, 0x38, 0x9b, 0x30, 0x93, 0x28, 0x21,
+    0x4a, 0x34, 0x02, 0x33, 0x33, 0x04, 0x88, 0x0e, 0x96, 0x1f, 0x3c, 0x5c, 0x5e, 0xe0, 0xf0, 0xb3,
+    0xa1, 0xd2, 0x52, 0x43, 0x86, 0xc9, 0x0b, 0x18, 0x86, 0x28, 0x25, 0x83, 0xe6, 0x24, 0x21, 0x21,
+    0x2d, 0x44, 0x5a, 0xa8, 0x40, 0x01, 0x92, 0xc2, 0x23, 0xa4, 0xf7, 0xd1, 0x71, 0x42, 0x23, 0x23,
+    0xa3, 0x19, 0xa8, 0xc8, 0xac, 0x95, 0xc0, 0x28, 0x21, 0x02, 0xe3, 0x51, 0x04, 0xc5, 0x45, 0xc5,
+    0xc4, 0x45, 0x08, 0x89, 0x36, 0x18, 0xf1, 0x10, 0xb1, 0x7c, 0x68, 0x64, 0x58, 0x2e, 0xdc, 0xc9,
+    0x60, 0x1d, 0x02, 0xa1, 0x1e, 0x26, 0x9c, 0x1b, 0x87, 0xc5, 0x83, 0x82, 0x64, 0xc1, 0x2f, 0x98,
+    0x9b, 0x84, 0x7f, 0xbb, 0x5d, 0x6f, 0xa0, 0xdd, 0xc9, 0x00, 0x30, 0xe7, 0x76, 0xb9, 0x7f, 0x5d,
+    0xfc, 0xef, 0x01, 0xae, 0x42, 0xe8, 0x81, 0xdf, 0x9c, 0x03, 0xbf, 0x3e, 0x07, 0x41, 0x7c, 0x0c,
+    0x1a, 0xfc, 0xeb, 0xed, 0xe1, 0xe5, 0x89, 0xde, 0xd5, 0xd9, 0x19, 0xd1, 0x89, 0xc0, 0xec, 0x70,
+    0x59, 0x39, 0x09, 0xe1, 0x9e, 0xdb, 0x86, 0x25, 0x1d, 0x19, 0x15, 0x11, 0x0d, 0x09, 0xdd, 0x41,
+    0x40, 0x3f, 0xdb, 0x00, 0x48, 0x74, 0x5c, 0x5a, 0x9c, 0x8d, 0x00, 0xee, 0x0d, 0x0e, 0xc6, 0x5b,
+    0x02, 0xb7, 0x34, 0xb6, 0xb6, 0x1d, 0x36, 0x9e, 0x35, 0x35, 0x37, 0x35, 0x34, 0x04, 0x61, 0x58,
+    0x68, 0x62, 0x62, 0xac, 0x66, 0x67, 0x9c, 0x64, 0x65, 0xa3, 0x3d, 0x63, 0x61, 0x62, 0x61, 0x60,
+    0x62, 0x3a, 0x60, 0x36, 0x96, 0xd7, 0x9b, 0x2e, 0x2f, 0xcf, 0x2d, 0x2e, 0xf3, 0x01, 0x2d, 0xc7,
+    0x03, 0x3b, 0x59, 0x57, 0x58, 0x57, 0xff, 0x58, 0xab, 0x56, 0xff, 0x69, 0x00, 0xd4, 0xf4, 0xf0,
+    0xec, 0x6c, 0x75, 0x72, 0xee, 0x2e, 0x9c, 0xf7, 0xe1, 0xf2, 0x72, 0x33, 0x85, 0xca, 0x13, 0x23,
+    0x2a, 0x52, 0xa0, 0x4c, 0xf1, 0x3a, 0x45, 0x91, 0xa2, 0x5d, 0x51, 0x1a, 0xc5, 0x26, 0x85, 0xf2,
+    0xc4, 0xd4, 0xf4, 0x14, 0xb5, 0x09, 0xaa, 0x93, 0xd3, 0xb3, 0x13, 0x26, 0x4d, 0x98, 0x28, 0x59,
+    0x82, 0x64, 0x49, 0x12, 0x25, 0x5e, 0xd0, 0x24, 0x48, 0x8e, 0x98, 0x1e, 0x31, 0x62, 0x6a, 0xc4,
+    0x26, 0x52, 0xa4, 0xb4, 0xc8, 0x10, 0x22, 0xe7, 0x21, 0xa4, 0xa5, 0xa3, 0x42, 0x82, 0x8c, 0x06,
+    0xf9, 0x01, 0x44, 0x14, 0x88, 0x8f, 0x1f, 0x3e, 0x7a, 0xb0, 0x8a, 0xf2, 0xe8, 0xc1, 0x63, 0x47,
+    0x28, 0x68, 0xa8, 0x8e, 0x1d, 0x67, 0x1d, 0x39, 0x70, 0x80, 0xde, 0xc0, 0x61, 0xe3, 0x86, 0x0d,
+    0x1a, 0x35, 0x64, 0xd4, 0x98, 0x41, 0x63, 0xc6, 0xe7, 0x16, 0x19, 0x9e, 0x9f, 0x9e, 0x30, 0x62,
+    0xb8, 0x88, 0xf1, 0x02, 0xc6, 0xf9, 0x45, 0x0b, 0x16, 0x2e, 0x3a, 0x59, 0x70, 0x76, 0x72, 0xaa,
+    0x58, 0xb1, 0xb9, 0x22, 0x85, 0x0a, 0xd3, 0x14, 0xde, 0xcd, 0x47, 0xa1, 0x79, 0x22, 0xf3, 0x84,
+    0x09, 0x4c, 0x13, 0x67, 0x0e, 0xe7, 0x12, 0x97, 0x25, 0x48, 0x58, 0x92, 0x18, 0x51, 0x39, 0x22,
+    0x13, 0xd3, 0x03, 0x87, 0x4b, 0xcb, 0x4a, 0x0c, 0x94, 0x92, 0x22, 0x42, 0x64, 0x86, 0x00, 0x81,
+    0x09, 0xe2, 0x83, 0x87, 0x0f, 0x1d, 0x38, 0x74, 0xd8, 0x70, 0xb9, 0x41, 0x83, 0xa5, 0x86, 0x0c,
+    0x95, 0x19, 0x74, 0x60, 0xb8, 0x40, 0xd9, 0x79, 0x61, 0x52, 0x72, 0x52, 0xc9, 0x42, 0x69, 0xa3,
+    0x05, 0xbb, 0x02, 0x29, 0x63, 0x05, 0x6d, 0x24, 0xa8, 0x62, 0x24, 0xa4, 0x2a, 0x22, 0x24, 0x85,
+    0x54, 0x43, 0x0a, 0x8f, 0x8f, 0x8d, 0x8c, 0x11, 0x14, 0x11, 0x0d, 0xcb, 0xbb, 0x5e, 0x60, 0x02,
+    0xfd, 0x3c, 0xff, 0xe5, 0xd8, 0x58, 0xea, 0x68, 0x66, 0x24, 0x35, 0x6b, 0x25, 0x44, 0x08, 0x95,
+    0x60, 0x2f, 0x2a, 0x82, 0x2e, 0x26, 0x22, 0xaa, 0x26, 0x1e, 0x1a, 0xa6, 0x1e, 0x32, 0x15, 0x96,
+    0x4d, 0x0b, 0x99, 0xea, 0x9d, 0xac, 0x6b, 0x92, 0x09, 0xc7, 0x20, 0x08, 0xc5, 0xe2, 0xb0, 0x18,
+    0x3c, 0xc8, 0x29, 0x08, 0xae, 0x05, 0xff, 0xa9, 0x20, 0xa8, 0x7e, 0x21, 0x04, 0x7e, 0xab, 0x02,
+    0xbd, 0xa9, 0x80, 0xde, 0x1c, 0xb0, 0x9b, 0x73, 0x4d, 0xff, 0xb8, 0xf8, 0x9f, 0x28, 0xfe, 0xa0,
+    0xa6, 0x72, 0xe0, 0xe7, 0xd7, 0xa0, 0xcf, 0x01, 0x5f, 0x5f, 0x2a, 0x1f, 0x83, 0x3d, 0xbb, 0x05,
+    0x40, 0x1c, 0xf5, 0xf6, 0xf2, 0xf0, 0xf4, 0x44, 0xef, 0xf0, 0x52, 0xef, 0x3e, 0xb2, 0xce, 0x8e,
+    0xae, 0x4e, 0x95, 0x6e, 0x3b, 0x97, 0x2a, 0x37, 0xa7, 0x40, 0x2e, 0x4e, 0x41, 0xdc, 0x1b, 0x5c,
+    0x5a, 0xb0, 0xfc, 0x96, 0xa6, 0x25, 0x27, 0xa7, 0xba, 0xba, 0xc8, 0x48, 0x0f, 0x4f, 0x15, 0x02,
+    0x93, 0xea, 0x43, 0x07, 0x0f, 0x1d, 0x38, 0x78, 0xd8, 0xc0, 0xc1, 0xb2, 0x92, 0x52, 0xb2, 0xc2,
+    0x86, 0x4b, 0x4b, 0x0d, 0x97, 0x67, 0x0d, 0x19, 0x2a, 0x33, 0x60, 0xa0, 0xbc, 0x80, 0xe1, 0xc2,
+    0xa4, 0x24, 0xdf, 0xa4, 0x85, 0x0a, 0x82, 0x16, 0x20, 0x23, 0x21, 0x29, 0x44, 0x3e, 0x52, 0x98,
+    0xf0, 0x38, 0x41, 0xeb, 0xe8, 0x78, 0x6e, 0x74, 0x6c, 0xfc, 0x77, 0x64, 0x34, 0x2f, 0x26, 0x1a,
+    0x96, 0xc9, 0x8c, 0x12, 0x16, 0x23, 0x48, 0x90, 0x8a, 0xa0, 0x98, 0xa8, 0x88, 0x68, 0x78, 0x88,
+    0x78, 0x58, 0x58, 0xe6, 0x2b, 0xdc, 0xc9, 0x82, 0xbb, 0x4e, 0x45, 0xa8, 0x13, 0x8e, 0x75, 0xf1,
+    0x38, 0x50, 0x1c, 0x86, 0xe4, 0x42, 0x47, 0x07, 0x1e, 0x3c, 0x0f, 0xee, 0x81, 0x21, 0x08, 0x9e,
+    0x05, 0xf1, 0x20, 0x04, 0x7e, 0xcf, 0xdf, 0xba, 0xc0, 0x9c, 0x8b, 0xfb, 0xf5, 0x35, 0xd8, 0xc3,
+    0xab, 0xf3, 0x02, 0xe6, 0x80, 0x5d, 0x6e, 0xf7, 0x0f, 0xff, 0x7b, 0xe0, 0xf7, 0xc0, 0x41, 0x9f,
+    0x03, 0xbe, 0x06, 0x7c, 0x0c, 0xf6, 0x16, 0x30, 0x90, 0x5a, 0xa0, 0x87, 0x97, 0xa7, 0x17, 0x95,
+    0x77, 0x57, 0x67, 0x77, 0x07, 0x65, 0x37, 0x47, 0x37, 0x27, 0x47, 0xb7, 0xaa, 0xa0, 0x4d, 0xee,
+    0xed, 0x2d, 0x4e, 0x01, 0x5c, 0x9c, 0x19, 0x2e, 0xc1, 0x5b, 0x02, 0xb7, 0xb7, 0x36, 0xb7, 0x36,
+    0xaa, 0x35, 0x36, 0xb6, 0x35, 0x35, 0x04, 0x08, 0xd4, 0xd0, 0xd2, 0xd2, 0xaa, 0xd0, 0xca, 0xc6,
+    0xc2, 0xbe, 0xba, 0xb6, 0xb2, 0xac, 0x90, 0xce, 0xe8, 0xdf, 0xf9, 0x2f, 0xb3, 0xb2, 0x27, 0x33,
+    0x9b, 0x6c, 0xec, 0x94, 0x4c, 0x2c, 0x6c, 0x2c, 0x06, 0xf6, 0x75, 0x05, 0xcc, 0xab, 0x8b, 0xcb,
+    0x8b, 0x6b, 0x2b, 0x92, 0x4b, 0x2b, 0xeb, 0x80, 0x96, 0xd4, 0x01, 0x2c, 0xab, 0x2b, 0xac, 0xa8,
+    0x2b, 0x03, 0x55, 0x05, 0x0c, 0x40, 0x15, 0x20, 0x40, 0x45, 0x60, 0x8a, 0x6a, 0x4a, 0x2a, 0xea,
+    0x89, 0x0c, 0x2a, 0xea, 0xdf, 0x40, 0xd9, 0x0d, 0x10, 0xc0, 0x25, 0x29, 0xa9, 0xc9, 0xc9, 0x89,
+    0x69, 0xa9, 0xe9, 0x70, 0xc9, 0x4a, 0x09, 0x29, 0x09, 0x29, 0xe9, 0x68, 0x0c, 0x11, 0x51, 0x91,
+    0xd1, 0xd9, 0xa8, 0x68, 0x88, 0x68, 0x48, 0x88, 0x48, 0x08, 0x28, 0xe8, 0x1c, 0x04, 0x14, 0xe0,
+    0xe7, 0xfc, 0x13, 0xc0, 0x07, 0xc0, 0x19, 0x80, 0x4f, 0xcf, 0x18, 0x9d, 0x1d, 0x9e, 0x29, 0x9e,
+    0xb3, 0x9d, 0x1c, 0x9d, 0x1c, 0x1d, 0x1c, 0x5b, 0xbb, 0x95, 0xda, 0x9e, 0x6a, 0xed, 0x3b, 0xea,
+    0x1e, 0xdb, 0xd8, 0x2c, 0x54, 0x96, 0x0b, 0x8b, 0xe6, 0xff, 0xeb, 0x7f, 0x7a, 0xea, 0xda, 0xfa,
+    0xad, 0x6f, 0xe8, 0x27, 0xf0, 0xa6, 0x8d, 0x1b, 0x29, 0x37, 0x6c, 0xda, 0x48, 0xb1, 0x61, 0x5d,
+    0xb3, 0x46, 0x0d, 0xab, 0x9a, 0x34, 0xab, 0xe7, 0x55, 0xd5, 0x34, 0x5e, 0x28, 0xd5, 0x33, 0x68,
+    0xce, 0x98, 0x41, 0x53, 0xc6, 0x4c, 0x27, 0x99, 0x32, 0xa3, 0x64, 0xc4, 0xf4, 0x88, 0x09, 0x33,
+    0x06, 0x4c, 0x98, 0x49, 0x30, 0x5e, 0xbe, 0x78, 0x39, 0xec, 0xb2, 0x85, 0x16, 0xb0, 0x45, 0x0b,
+    0x97, 0xd5, 0x2c, 0x5a, 0xae, 0x64, 0xc1, 0x72, 0x25, 0x33, 0x15, 0x0b, 0x57, 0x2a, 0x15, 0x2a,
+    0x56, 0xde, 0xac, 0x8a, 0x15, 0x20, 0xa7, 0x55, 0xa6, 0x50, 0x99, 0x22, 0x85, 0x4a, 0x14, 0x29,
+    0x51, 0xa0, 0x9c, 0x3e, 0x41, 0x85, 0x82, 0x0a, 0x0a, 0xda, 0x84, 0x49, 0x13, 0x26, 0x4b, 0x9a,
+    0x28, 0x59, 0x82, 0xe4, 0x08, 0x91, 0x52, 0x21, 0x4a, 0x92, 0x20, 0x31, 0x27, 0x31, 0x3d, 0x32,
+    0x36, 0x35, 0x42, 0xa4, 0x88, 0x91, 0xa8, 0x22, 0x43, 0x4a, 0xf9, 0x86, 0x90, 0x0a, 0x11, 0x24,
+    0x1d, 0x35, 0x07, 0x19, 0x3d, 0x4b, 0x05, 0xf9, 0xe1, 0xe3, 0x87, 0x0f, 0xd1, 0x1f, 0x3d, 0x78,
+    0x88, 0x6e, 0x4e, 0xf6, 0xf8, 0x0f, 0xe5, 0xb1, 0x23, 0xd4, 0xac, 0x23, 0x47, 0x0e, 0x1c, 0xa0,
+    0x37, 0x70, 0xd4, 0xf8, 0x8c, 0xe1, 0x73, 0xc3, 0xfe, 0xb2, 0x51, 0xc3, 0x6c, 0x83, 0xc6, 0x8c,
+    0x31, 0x0d, 0x19, 0x9f, 0x9a, 0x32, 0xb4, 0x9e, 0x31, 0xf8, 0x3c, 0x61, 0xbc, 0x10, 0x84, 0xe1,
+    0x42, 0x73, 0xd3, 0x85, 0x8a, 0x16, 0x2c, 0x5a, 0x78, 0x59, 0x74, 0xaa, 0xe0, 0xdc, 0x5c, 0xc1,
+    0x79, 0x8e, 0x5a, 0x91, 0xa2, 0x33, 0x05, 0x0a, 0x15, 0x93, 0x28, 0x2a, 0x2b, 0x4b, 0x94, 0x38,
+    0x71, 0x36, 0x71, 0xc2, 0x6c, 0x82, 0x44, 0x09, 0x12, 0x23, 0x4a, 0x88, 0x18, 0x11, 0x22, 0x53,
+    0x44, 0x26, 0x26, 0x26, 0x88, 0x0f, 0x98, 0x1f, 0x3c, 0x60, 0x76, 0xf0, 0x70, 0xe6, 0xd0, 0x81,
+    0xc3, 0xa5, 0x93, 0x86, 0x4b, 0x0d, 0x96, 0x97, 0x6f, 0x49, 0x95, 0x01, 0x03, 0x86, 0x0b, 0x95,
+    0x91, 0x17, 0x28, 0x27, 0x25, 0x23, 0x2d, 0x48, 0x72, 0x02, 0x56, 0xb0, 0x50, 0x81, 0x02, 0x1d,
+    0xa6, 0xf0, 0x08, 0xb9, 0x3a, 0xe1, 0x51, 0xc5, 0x04, 0x47, 0x73, 0xa3, 0xa3, 0x54, 0xe3, 0x96,
+    0xf1, 0x50, 0x02, 0x63, 0x84, 0x45, 0x09, 0x11, 0x0c, 0xc7, 0x85, 0x86, 0xe5, 0xbd, 0xb0, 0x2c,
+    0x16, 0x0c, 0x8b, 0x3b, 0x07, 0xc1, 0x61, 0x70, 0xd5, 0x1f, 0x84, 0x6f, 0x60, 0xd5, 0xd7, 0xf6,
+    0xfe, 0x01, 0xe6, 0x5e, 0xce, 0x2e, 0x37, 0xd7, 0x8e, 0xda, 0x71, 0x71, 0x3e, 0xb2, 0x07, 0xb8,
+    0xdf, 0x03, 0x07, 0x7d, 0x7e, 0x7d, 0x0d, 0xec, 0x18, 0x34, 0xc0, 0x5b, 0xb0, 0xc7, 0xe0, 0x3e,
+    0x5b, 0x40, 0x47, 0xf7, 0x5f, 0x27, 0x37, 0xc7, 0x25, 0xa7, 0xe0, 0x2c, 0xce, 0x4d, 0x81, 0x19,
+    0x2e, 0xee, 0x0d, 0x6e, 0xc0, 0xdb, 0x97, 0x04, 0x6d, 0x6c, 0x6e, 0x50, 0x6d, 0x6b, 0x6c, 0xf7,
+    0x9a, 0x59, 0x19, 0x99, 0x99, 0x10, 0xd9, 0x18, 0x97, 0xd8, 0x58, 0xd8, 0x0d, 0x26, 0x66, 0x15,
+    0xb6, 0x65, 0xa5, 0x85, 0xb5, 0x65, 0x3e, 0xa0, 0xa5, 0xe3, 0xc0, 0xa3, 0x50, 0xd6, 0x3f, 0x56,
+    0x93, 0x2b, 0x25, 0x03, 0x55, 0x06, 0x0a, 0x5c, 0xab, 0xa8, 0xa0, 0x08, 0x5c, 0xa1, 0xa6, 0xa4,
+    0xa2, 0x98, 0x9a, 0x98, 0xfe, 0x7f, 0x80, 0x9b, 0xa7, 0xab, 0x80, 0x77, 0x6a, 0x4a, 0x73, 0x5d,
+    0xfa, 0x17, 0x4a, 0x52, 0x42, 0x4a, 0x3a, 0x32, 0x42, 0x3a, 0x72, 0x13, 0x04, 0x04, 0xc0, 0x27,
+    0x00, 0x1a, 0x00, 0x6d, 0xd0, 0xb0, 0x69, 0x33, 0x80, 0x0d, 0x6b, 0x8d, 0x5f, 0xa8, 0x34, 0x84,
+    0x7b, 0xac, 0x99, 0x01, 0x02, 0x10, 0x08, 0xa0, 0x01, 0x93, 0xa9, 0x19, 0x86, 0x67, 0x71, 0x98,
+    0x42, 0x2b, 0x00, 0xd4, 0x2c, 0xa1, 0x41, 0x21, 0x0e, 0x23, 0x28, 0x78, 0x05, 0x00, 0x37, 0x80,
+    0x51, 0xb4, 0x00, 0xc7, 0x01, 0x1b, 0x0b, 0x91, 0xf8, 0x2e, 0x0b, 0x87, 0x58, 0x96, 0x57, 0x53,
+    0x81, 0x7c, 0x96, 0x1d, 0x94, 0xad, 0x56, 0x16, 0x3b, 0xa2, 0x72, 0x68, 0xf3, 0x57, 0x81, 0x89,
+    0xd3, 0x1e, 0xdb, 0xa0, 0x73, 0x1d, 0xe4, 0xfb, 0xa6, 0xc3, 0xc7, 0x32, 0x4f, 0xee, 0xd9, 0x20,
+    0x66, 0xe7, 0xf8, 0xf3, 0x9f, 0xb0, 0x6b, 0x4f, 0x2d, 0xb8, 0xbb, 0xb6, 0x68, 0xff, 0x07, 0x1e,
+    0xbc, 0x5b, 0x09, 0x3f, 0x70, 0xe6, 0xcd, 0xcc, 0xf3, 0xaf, 0x28, 0xc6, 0xb2, 0xb8, 0xcf, 0x98,
+    0x60, 0x61, 0xbe, 0x7a, 0x23, 0x6f, 0xfd, 0x19, 0x33, 0xc1, 0xdf, 0xee, 0x3c, 0x3a, 0xbf, 0xe5,
+    0xad, 0x3f, 0x34, 0x47, 0x3f, 0xee, 0x3d, 0xb6, 0xfd, 0x47, 0xe8, 0x1f, 0xf8, 0x8f, 0xc4, 0x82,
+    0x1f, 0xef, 0x43, 0xe0, 0x84, 0x53, 0x3e, 0xa6, 0xf7, 0x5f, 0x33, 0x43, 0xde, 0x2f, 0xa6, 0x30,
+    0x19, 0xbc, 0x61, 0x5c, 0x25, 0xb2, 0x4c, 0x5f, 0xc8, 0xc3, 0x83, 0x8d, 0xb7, 0x35, 0xbe, 0x9a,
+    0xbf, 0xb5, 0x27, 0x49, 0x4e, 0xfb, 0xa7, 0x07, 0xa4, 0x0f, 0x45, 0xe5, 0x7f, 0x66, 0xbb, 0xf0,
+    0xad, 0x19, 0xd2, 0x2d, 0xbf, 0xf8, 0xcf, 0x3c, 0xd5, 0x7f, 0x34, 0x54, 0xde, 0xf0, 0xb6, 0x91,
+    0x6e, 0x03, 0x03, 0x75, 0x9d, 0x58, 0xc6, 0x94, 0xc6, 0xfc, 0x0a, 0x1e, 0x40, 0xbb, 0x24, 0xd0,
+    0x60, 0x16, 0x2c, 0xcc, 0x7a, 0xf1, 0xdd, 0x2e, 0xcb, 0xb8, 0xf8, 0x38, 0xfb, 0xde, 0xad, 0x31,
+    0x0d, 0xb6, 0x4f, 0xaf, 0xdf, 0xa0, 0x62, 0xf5, 0xb4, 0xa0, 0xbe, 0x91, 0x6f, 0xce, 0x2f, 0xe9,
+    0x4d, 0x85, 0x73, 0x7e, 0x70, 0xed, 0x75, 0x5e, 0xe0, 0x34, 0x39, 0xcb, 0x39, 0x66, 0x5b, 0xe4,
+    0xe1, 0xa3, 0xfb, 0x0c, 0x0d, 0x1b, 0xd0, 0x46, 0xc0, 0x0f, 0x0e, 0xf1, 0xf7, 0x51, 0xba, 0xbb,
+    0xef, 0x00, 0xf6, 0x85, 0x68, 0x05, 0x94, 0x87, 0xb6, 0x5f, 0x52, 0x65, 0xd7, 0x97, 0x1e, 0x0d,
+    0xaf, 0xac, 0xa1, 0xac, 0x86, 0xa8, 0x41, 0x3c, 0x24, 0xfd, 0x86, 0xf6, 0x28, 0x53, 0x79, 0x03,
+    0xe5, 0x10, 0x04, 0xff, 0x40, 0x5a, 0x0e, 0x47, 0xc9, 0x87, 0x35, 0x10, 0xbb, 0x05, 0x1d, 0x9e,
+    0x4d, 0xe1, 0x7c, 0xb1, 0x72, 0x3f, 0x70, 0x39, 0x41, 0x2f, 0xb6, 0xb1, 0xe8, 0xa1, 0xe4, 0x00,
+    0xe5, 0x18, 0x9d, 0x66, 0x48, 0x1b, 0x8a, 0xe5, 0x89, 0xac, 0x50, 0x27, 0x27, 0x18, 0xcd, 0xb3,
+    0xaa, 0x59, 0x3c, 0x4c, 0xdb, 0xf7, 0xbb, 0xe9, 0x83, 0xe1, 0xd3, 0x71, 0x86, 0x8c, 0xe6, 0x5a,
+    0x85, 0x5f, 0x91, 0x88, 0x4c, 0x28, 0x8c, 0xf3, 0xaa, 0xdd, 0x68, 0x47, 0x71, 0xd1, 0xe2, 0x57,
+    0x26, 0xe7, 0xd7, 0x80, 0x29, 0xde, 0xce, 0xe3, 0x1d, 0x6e, 0xca, 0x83, 0xd0, 0x07, 0x4f, 0xeb,
+    0xae, 0xa8, 0x91, 0xd4, 0x9b, 0xf3, 0xe7, 0x70, 0xc3, 0xef, 0x78, 0x07, 0xe1, 0xbe, 0xec, 0xbd,
+    0xac, 0x98, 0x20, 0x7a, 0x98, 0x98, 0xf0, 0xb4, 0x3f, 0xa7, 0x1e, 0x7e, 0xbe, 0xf8, 0x86, 0x25,
+    0x38, 0xb3, 0x19, 0x05, 0x96, 0x9d, 0x11, 0x9f, 0x6f, 0x41, 0x9d, 0x9c, 0x0e, 0xef, 0xbf, 0x36,
+    0xb7, 0x0e, 0x05, 0x61, 0x4e, 0xb7, 0x19, 0xb1, 0x76, 0xbc, 0x24, 0xeb, 0xa5, 0xdf, 0x2a, 0x06,
+    0xbd, 0x59, 0x75, 0x51, 0xf4, 0x88, 0x3b, 0x62, 0x3d, 0xcf, 0x58, 0xcb, 0x7c, 0x2c, 0x85, 0x70,
+    0xc8, 0x3f, 0x87, 0xc2, 0x57, 0x7d, 0xf0, 0xd1, 0x7f, 0x2f, 0xad, 0x85, 0xcc, 0xe8, 0xfb, 0xa9,
+    0x87, 0x96, 0xad, 0x55, 0x86, 0x30, 0xf8, 0x9e, 0xc3, 0x4c, 0x1b, 0xcf, 0x19, 0xe2, 0xed, 0x82,
+    0x3d, 0x31, 0xa1, 0xdf, 0x39, 0xb9, 0xba, 0x0d, 0x69, 0x06, 0x23, 0x9f, 0x1b, 0xaf, 0xb8, 0xe9,
+    0x0b, 0x0d, 0xde, 0xa1, 0xf4, 0xef, 0xd2, 0xf8, 0xc8, 0xa6, 0x4e, 0x3d, 0x66, 0x07, 0x98, 0x6c,
+    0x9e, 0x07, 0x4b, 0xdf, 0x7a, 0xd5, 0x96, 0x55, 0xc2, 0xde, 0x13, 0x67, 0x31, 0x35, 0x97, 0x7d,
+    0xb4, 0x27, 0xc2, 0x82, 0xdb, 0xd0, 0xf7, 0x82, 0xa3, 0x42, 0x0d, 0xa2, 0xfb, 0xef, 0xe8, 0x77,
+    0x97, 0x37, 0xa0, 0x17, 0x85, 0xc4, 0xf7, 0xb2, 0xcd, 0xf1, 0x4f, 0xfc, 0x06, 0x2d, 0xc2, 0x17,
+    0x0e, 0x9f, 0xb9, 0x91, 0xab, 0xfe, 0xe4, 0xd5, 0xb9, 0x1e, 0x98, 0x5f, 0x9e, 0xf1, 0x91, 0xfd,
+    0x82, 0xae, 0x83, 0x43, 0xb5, 0x0a, 0xf6, 0x30, 0x06, 0xf6, 0x26, 0x3c, 0x7d, 0x6f, 0xec, 0x63,
+    0xa6, 0xc1, 0x3e, 0x9f, 0xa8, 0x7b, 0x6e, 0x4b, 0xb6, 0xfc, 0x21, 0xae, 0x27, 0xcc, 0xa6, 0x0d,
+    0xa5, 0xc3, 0x33, 0xd0, 0xa6, 0xf4, 0xcb, 0xa6, 0x60, 0x8f, 0xfc, 0x9c, 0xa3, 0x09, 0xd6, 0x48,
+    0xd3, 0x8f, 0x47, 0x8b, 0xe6, 0x3e, 0x71, 0xa0, 0xfe, 0x82, 0x7e, 0xf0, 0xda, 0x12, 0x52, 0x26,
+    0x7e, 0x7d, 0x72, 0x36, 0xfc, 0x56, 0x60, 0x21, 0x84, 0x85, 0x2f, 0x71, 0x39, 0x93, 0xf8, 0x92,
+    0xc2, 0xe0, 0x54, 0xb5, 0x91, 0x61, 0xda, 0x5b, 0x7b, 0xd8, 0x8f, 0x3b, 0x92, 0xf6, 0x5a, 0x16,
+    0x2a, 0x74, 0xdc, 0xe6, 0x12, 0x67, 0x7a, 0xa6, 0x0b, 0x92, 0xbb, 0x76, 0xd0, 0x9b, 0x56, 0x29,
+    0x77, 0x66, 0x3f, 0x26, 0x02, 0xed, 0x74, 0x5e, 0x5b, 0x6f, 0xd8, 0xbd, 0x9b, 0xa4, 0xaa, 0x0f,
+    0x69, 0x9e, 0xe9, 0xce, 0xab, 0x71, 0xda, 0x77, 0xf8, 0x7e, 0xdf, 0x82, 0xec, 0x0d, 0x3e, 0xad,
+    0x1d, 0x6a, 0x30, 0x97, 0x18, 0x7e, 0x2b, 0x41, 0x99, 0xb4, 0x34, 0xf7, 0x81, 0x41, 0xa0, 0x05,
+    0xb7, 0x10, 0x0f, 0xbf, 0xfb, 0x78, 0x60, 0x59, 0x7f, 0xe6, 0xd8, 0x5f, 0x7b, 0xd6, 0x6c, 0x4c,
+    0x9c, 0x80, 0x0e, 0xc1, 0xe9, 0x13, 0x91, 0x07, 0xc0, 0x7a, 0x0f, 0xa4, 0xf4, 0x62, 0x1e, 0x34,
+    0x43, 0x47, 0x7e, 0x36, 0x60, 0xc1, 0x4f, 0xe8, 0xf7, 0x7f, 0xf2, 0x72, 0xd0, 0x36, 0x59, 0xf7,
+    0x8c, 0x9f, 0x87, 0xd1, 0xf0, 0x41, 0xca, 0x09, 0xde, 0x05, 0xbd, 0x80, 0x2e, 0x9f, 0x44, 0x6d,
+    0x88, 0x67, 0xbc, 0x13, 0xf0, 0x7f, 0xeb, 0xf0, 0xf7, 0x39, 0x3b, 0x68, 0xbf, 0xf3, 0xfb, 0xf5,
+    0x70, 0x4e, 0x75, 0x39, 0xb5, 0xe0, 0xfa, 0x1d, 0x1c, 0x35, 0xe3, 0x23, 0xf8, 0x0f, 0x9e, 0x78,
+    0xaf, 0x9e, 0x96, 0x96, 0xdf, 0x67, 0x76, 0xf3, 0xef, 0x85, 0x57, 0x78, 0xff, 0x3a, 0x87, 0xa2,
+    0x06, 0x58, 0xd7, 0x0e, 0xde, 0xae, 0x54, 0xf9, 0x2c, 0x62, 0x04, 0x85, 0x39, 0x1c, 0xea, 0xa2,
+    0xe7, 0xf7, 0xb2, 0x55, 0x4a, 0x3e, 0xfb, 0xbf, 0x1d, 0x8e, 0x0a, 0x29, 0x50, 0x69, 0xfe, 0xe8,
+    0x56, 0x38, 0xef, 0x1c, 0x03, 0x05, 0x41, 0xa7, 0xe1, 0x4f, 0xc3, 0x18, 0x26, 0xde, 0xdf, 0x9c,
+    0x9b, 0xbc, 0xe5, 0xef, 0x1e, 0xca, 0x2a, 0xe7, 0xe4, 0xf1, 0x35, 0x52, 0x61, 0x3a, 0xf1, 0x62,
+    0xb9, 0x1c, 0x8f, 0xca, 0xd2, 0x8d, 0x15, 0xb1, 0xd4, 0xb0, 0xe5, 0x89, 0x68, 0xdb, 0xbf, 0x11,
+    0x1e, 0x9f, 0x60, 0xe9, 0x17, 0xff, 0x48, 0xf8, 0x81, 0x5c, 0xa4, 0xbe, 0x79, 0x76, 0x78, 0x6e,
+    0x36, 0x96, 0xe9, 0x55, 0x32, 0xad, 0x1f, 0x2b, 0xec, 0x9a, 0x37, 0x75, 0xee, 0xd4, 0x67, 0xcd,
+    0xf8, 0xa3, 0x13, 0x7f, 0xa7, 0x89, 0x3a, 0xcc, 0x22, 0x87, 0xa8, 0xf1, 0x81, 0xb3, 0x8f, 0x69,
+    0xa0, 0x6d, 0x0e, 0xf2, 0x59, 0x6f, 0x1a, 0xfe, 0xa6, 0xec, 0xea, 0x57, 0x31, 0xc6, 0xf9, 0xe0,
+    0x79, 0xfb, 0x17, 0x22, 0xf3, 0xa5, 0x2e, 0x60, 0x07, 0xdd, 0xc4, 0xc2, 0x54, 0x58, 0xd8, 0xab,
+    0x9e, 0xdd, 0x20, 0x5c, 0x11, 0xd0, 0x5c, 0x38, 0xfc, 0xe9, 0xe9, 0xc7, 0xa6, 0x69, 0x55, 0x53,
+    0xd2, 0x38, 0x59, 0xd4, 0x6d, 0x1d, 0x6c, 0x98, 0x71, 0xc4, 0xeb, 0x63, 0xdf, 0xb3, 0x3b, 0x75,
+    0x21, 0xe2, 0x14, 0xef, 0xe6, 0xca, 0x6a, 0xa4, 0xbc, 0x4e, 0xa1, 0x67, 0x62, 0x9f, 0x18, 0xdc,
+    0x81, 0xef, 0x5c, 0xb3, 0x14, 0x27, 0xfc, 0x95, 0x7b, 0xdf, 0xcf, 0x5f, 0xf6, 0xa3, 0xff, 0x6e,
+    0x7a, 0x54, 0x7f, 0xd1, 0xeb, 0xae, 0x85, 0x6b, 0x63, 0xde, 0x15, 0xbd, 0xd8, 0x87, 0xe3, 0x93,
+    0x95, 0x7f, 0xc1, 0x6b, 0x3e, 0x3e, 0xbc, 0x75, 0x2a, 0x9c, 0x60, 0x32, 0x90, 0xc0, 0x77, 0x30,
+    0xa2, 0x86, 0xfb, 0x6e, 0xf6, 0xf7, 0x25, 0xe4, 0xdd, 0xb2, 0xa3, 0xc7, 0x7f, 0xf1, 0xa2, 0x26,
+    0xc0, 0x29, 0x4e, 0xdb, 0xa2, 0xfe, 0x66, 0x6a, 0x9f, 0x91, 0xb7, 0x76, 0x15, 0x8b, 0xc4, 0x9b,
+    0xc3, 0x1c, 0xe8, 0x06, 0x8d, 0x9f, 0x31, 0x6e, 0xe5, 0x59, 0xd1, 0x8a, 0xef, 0x4e, 0xff, 0x07,
+    0x3e, 0x08, 0xe9, 0xe2, 0x67, 0xee, 0x31, 0x44, 0xd8, 0x99, 0xfe, 0xf6, 0xce, 0xed, 0x9a, 0x77,
+    0x64, 0xaf, 0x3f, 0xac, 0x8b, 0x78, 0x12, 0x1d, 0x3c, 0x03, 0x76, 0x2f, 0x46, 0xa6, 0x6b, 0x8c,
+    0x41, 0x0e, 0x83, 0x4a, 0x70, 0xba, 0x7e, 0x89, 0xcf, 0x55, 0x4e, 0xc5, 0x07, 0x21, 0xd5, 0x1c,
+    0x94, 0xfe, 0x57, 0xf8, 0x61, 0xb8, 0xe7, 0xf2, 0x31, 0x01, 0x43, 0x16, 0xde, 0xce, 0xe9, 0x1e,
+    0xcd, 0x4d, 0x51, 0x9f, 0xd4, 0x80, 0xd3, 0xb3, 0x52, 0xa4, 0xbc, 0x20, 0x27, 0xeb, 0x40, 0xcb,
+    0x6a, 0x82, 0xbe, 0x26, 0x6e, 0xe9, 0x22, 0x5c, 0xf4, 0x1f, 0x7e, 0x0d, 0xf6, 0xa8, 0xbf, 0x7e,
+    0x8f, 0xf3, 0x89, 0xff, 0x79, 0x64, 0xcb, 0xcb, 0xfe, 0xc9, 0xfe, 0x37, 0xfb, 0x7c, 0xd0, 0xf6,
+    0x9a, 0xf8, 0x78, 0xba, 0xa5, 0xc7, 0xbe, 0xe5, 0xf1, 0x26, 0x9f, 0x12, 0xd2, 0x81, 0x57, 0xeb,
+    0xf5, 0xbd, 0x0a, 0x7a, 0x8e, 0xa5, 0x74, 0x05, 0xe9, 0x1c, 0x97, 0x5b, 0xb5, 0x71, 0xe0, 0xc6,
+    0x27, 0x66, 0xf8, 0x94, 0xaa, 0x73, 0x34, 0x81, 0x5d, 0xe7, 0x12, 0xb9, 0x48, 0xbd, 0xf5, 0xf6,
+    0x68, 0x96, 0x7f, 0x5d, 0xb1, 0x7e, 0xdb, 0xb2, 0xbd, 0xc8, 0x7a, 0x57, 0x8f, 0x9a, 0x92, 0x8f,
+    0x3e, 0x39, 0x8b, 0x7e, 0xd6, 0x41, 0x0a, 0x04, 0x77, 0x3e, 0x61, 0xf7, 0xf3, 0x95, 0xe3, 0xe5,
+    0xa5, 0x91, 0xfd, 0x8a, 0x96, 0xbf, 0xf6, 0x84, 0x1f, 0x44, 0x17, 0x31, 0xb9, 0x42, 0x3c, 0xbf,
+    0x32, 0x5c, 0x6e, 0x62, 0x14, 0xd6, 0x8d, 0xfd, 0xf5, 0xc1, 0xca, 0x98, 0xd6, 0x58, 0x6d, 0x4d,
+    0x76, 0x04, 0xc7, 0xed, 0x1f, 0xc0, 0xcd, 0x3f, 0x87, 0x37, 0x36, 0x18, 0xdf, 0x59, 0xe1, 0x9f,
+    0x56, 0xef, 0x87, 0xdc, 0xfa, 0x7d, 0x6c, 0xc6, 0xc2, 0xb8, 0x5a, 0x72, 0x98, 0xe4, 0xc8, 0x9b,
+    0xcf, 0x21, 0xfe, 0x20, 0x07, 0x73, 0xf8, 0xb2, 0xf3, 0xea, 0xc6, 0x3f, 0x5e, 0x94, 0x53, 0xca,
+    0x75, 0x91, 0xca, 0x31, 0xfb, 0x0f, 0x34, 0x9c, 0x06, 0xca, 0x5f, 0xca, 0xa2, 0xa9, 0x95, 0x5f,
+    0x75, 0x1d, 0xd8, 0x2d, 0x2c, 0x1e, 0x3e, 0x09, 0x32, 0xdb, 0xda, 0xa3, 0x6d, 0xea, 0xd4, 0x66,
+    0xd2, 0xe8, 0xcf, 0xeb, 0xcb, 0xb0, 0x70, 0x4b, 0xa3, 0xb9, 0x77, 0xbc, 0xeb, 0xc1, 0xce, 0x13,
+    0x3c, 0x67, 0xf6, 0x13, 0x1e, 0xce, 0x73, 0x8b, 0x34, 0x3f, 0xc4, 0xef, 0xb0, 0x9b, 0x06, 0xa8,
+    0x8d, 0xd0, 0xe7, 0xb7, 0x7f, 0x66, 0xca, 0xa9, 0x5f, 0xf3, 0x60, 0xec, 0x28, 0x17, 0x1a, 0x87,
+    0xee, 0x28, 0xfa, 0x6a, 0xbd, 0xed, 0x8a, 0xa0, 0xb7, 0xfd, 0xf5, 0x54, 0x07, 0xf8, 0x7f, 0x63,
+    0x79, 0x4a, 0x43, 0xc4, 0xc5, 0x02, 0xff, 0xa6, 0xf1, 0x4e, 0xe7, 0x9f, 0x9f, 0xf8, 0x0b, 0x6b,
+    0x4c, 0xee, 0x7c, 0xba, 0x79, 0xe3, 0xbb, 0x17, 0x4f, 0xe0, 0xfa, 0x2d, 0xf6, 0xdf, 0xe8, 0x66,
+    0x4d, 0x1b, 0xe8, 0x28, 0x18, 0xf0, 0x50, 0x4f, 0xfe, 0xb3, 0xef, 0xee, 0x3d, 0x09, 0xb2, 0x98,
+    0xf3, 0xbe, 0xe0, 0x88, 0xa8, 0xc8, 0x28, 0xd1, 0x26, 0x03, 0x3a, 0xcc, 0x6f, 0x36, 0x1e, 0x26,
+    0x4b, 0x35, 0x5f, 0xed, 0x08, 0xda, 0xe3, 0x16, 0xd6, 0xb3, 0xa1, 0xc5, 0x75, 0xb4, 0x78, 0xdf,
+    0x07, 0xf8, 0x99, 0x79, 0x41, 0x23, 0xec, 0xb6, 0xcb, 0xf3, 0x81, 0xfe, 0xc1, 0x12, 0x94, 0x6c,
+    0xc7, 0x0f, 0xf6, 0xb1, 0xe4, 0xe5, 0xb4, 0xe2, 0xc8, 0xcf, 0xc7, 0xbf, 0xb6, 0x72, 0xe7, 0xb9,
+    0xec, 0xfb, 0xc1, 0x41, 0x30, 0xd1, 0x35, 0xe4, 0x8e, 0x99, 0xf0, 0xf5, 0x56, 0x6e, 0xcc, 0xdc,
+    0x32, 0xfd, 0x96, 0x30, 0xcc, 0x8e, 0x5d, 0x8c, 0xf2, 0x0f, 0x5e, 0xb8, 0x32, 0xdf, 0xe9, 0x22,
+    0xaa, 0x6c, 0x0e, 0xd5, 0x5e, 0xc3, 0xbe, 0x5f, 0xb0, 0xcc, 0x55, 0x2e, 0xf8, 0x70, 0xde, 0x98,
+    0x2f, 0xe1, 0x0c, 0xf1, 0xe1, 0xc8, 0x69, 0x8b, 0x74, 0x3c, 0xc2, 0x52, 0x01, 0x27, 0xfa, 0xa9,
+    0x8d, 0xd6, 0x94, 0xa0, 0xee, 0x51, 0xaf, 0x05, 0x27, 0xa5, 0xf9, 0x0f, 0x62, 0x7b, 0x64, 0x7d,
+    0x6e, 0x0a, 0x3d, 0x44, 0xc9, 0x04, 0xf3, 0x59, 0x64, 0xfe, 0x84, 0x1d, 0x9a, 0x88, 0xa6, 0xf5,
+    0x0f, 0x83, 0xff, 0x29, 0xcd, 0x26, 0xfc, 0x03, 0x14, 0x10, 0x77, 0x76, 0x62, 0xb8, 0x6f, 0xc6,
+    0x46, 0xcd, 0x2b, 0xc3, 0x73, 0xe9, 0x7f, 0xab, 0x9c, 0x3d, 0x3f, 0xef, 0x1d, 0x30, 0xd4, 0xc7,
+    0xbf, 0xf9, 0x37, 0x78, 0x46, 0x66, 0x42, 0xcf, 0x95, 0xf4, 0x7d, 0x10, 0x1d, 0x13, 0xb3, 0x29,
+    0xc2, 0xe5, 0x35, 0xe9, 0xcf, 0x81, 0xea, 0x96, 0x50, 0xfd, 0x0b, 0x66, 0xf5, 0x74, 0xb1, 0xb4,
+    0xad, 0x96, 0x1e, 0xc9, 0x17, 0x20, 0xd1, 0xda, 0xef, 0xdf, 0xb8, 0x28, 0x0f, 0xf9, 0xb9, 0x39,
+    0x20, 0x03, 0xb7, 0x1a, 0xef, 0xb2, 0xf6, 0x3d, 0x26, 0x5d, 0xd1, 0xaa, 0x3b, 0xfd, 0xcb, 0x6f,
+    0xdc, 0xd3, 0x0b, 0x1a, 0xf9, 0xf6, 0x85, 0xb9, 0x71, 0x2d, 0xc9, 0x8d, 0xa0, 0x92, 0xce, 0xe5,
+    0x1b, 0x27, 0xf2, 0x1e, 0x4b, 0xb7, 0x70, 0xdb, 0x67, 0x93, 0x9d, 0x2f, 0x7c, 0x83, 0xcf, 0x54,
+    0x65, 0xdb, 0xed, 0x6e, 0xf8, 0xbe, 0x95, 0x1d, 0x1a, 0xaf, 0x7a, 0xad, 0xaa, 0xeb, 0xc3, 0x9c,
+    0x20, 0x1c, 0x3e, 0xe0, 0x8e, 0x53, 0x75, 0x2b, 0x63, 0x39, 0xe9, 0x34, 0x97, 0x6f, 0x30, 0x36,
+    0x9d, 0x1d, 0xec, 0xc7, 0xbc, 0x02, 0x57, 0xa5, 0xef, 0xe5, 0xfc, 0x71, 0x74, 0x40, 0xe5, 0x4f,
+    0x23, 0xe4, 0x6b, 0xab, 0x62, 0xb7, 0x80, 0x7c, 0x2a, 0x82, 0xd3, 0xe8, 0xb7, 0x6d, 0xca, 0xf5,
+    0x54, 0xfe, 0x14, 0x24, 0x1c, 0x69, 0xc3, 0x92, 0xae, 0xc0, 0x23, 0xed, 0x43, 0xee, 0x78, 0xee,
+    0x3d, 0xa7, 0x7a, 0xc7, 0x22, 0xcd, 0xc6, 0xbf, 0xc0, 0xbe, 0x4d, 0x65, 0xa4, 0x30, 0xf0, 0xc1,
+    0xee, 0x70, 0x2f, 0xb8, 0xd2, 0x9c, 0x97, 0xec, 0xde, 0xdb, 0x59, 0x91, 0xbe, 0x70, 0x02, 0xbf,
+    0x2d, 0xd8, 0x35, 0xa8, 0xb4, 0x94, 0xc4, 0x3e, 0x27, 0x38, 0x13, 0xc6, 0xa7, 0xba, 0x85, 0x0c,
+    0x6c, 0x33, 0x9f, 0xad, 0x62, 0x87, 0x25, 0x9f, 0x18, 0x5b, 0x94, 0x7a, 0xde, 0x9a, 0x86, 0x7f,
+    0x88, 0x8b, 0x49, 0x5e, 0x7a, 0x4d, 0x87, 0x23, 0xeb, 0x00, 0x9b, 0x71, 0x82, 0xd9, 0xdd, 0xa0,
+    0x0b, 0xc7, 0x01, 0x7a, 0xe0, 0xfd, 0x0c, 0x9a, 0xef, 0x35, 0xc8, 0x7f, 0x0a, 0xa7, 0x13, 0x54,
+    0xa6, 0xab, 0xad, 0xe5, 0xf8, 0x1a, 0xd2, 0x37, 0xb1, 0xd4, 0x3b, 0xbc, 0x04, 0x87, 0x84, 0x62,
+    0xd3, 0xc9, 0x70, 0xee, 0xfd, 0x71, 0xf7, 0x20, 0x31, 0x67, 0x94, 0x59, 0xce, 0xbf, 0xcf, 0x98,
+    0x9e, 0x83, 0x69, 0xa1, 0xa6, 0xb3, 0x14, 0x27, 0x69, 0xe2, 0xed, 0xd7, 0x59, 0xe7, 0x10, 0xb2,
+    0xf9, 0xc9, 0x02, 0x96, 0x27, 0x96, 0xe3, 0xcc, 0xe9, 0x39, 0x05, 0x6b, 0x31, 0x0b, 0x73, 0x8d,
+    0xa7, 0x14, 0x50, 0x7b, 0xf4, 0x54, 0x52, 0xd3, 0xf7, 0xaf, 0x9a, 0xc0, 0x79, 0x87, 0x0b, 0x9f,
+    0x4f, 0x3b, 0xfb, 0xda, 0x0a, 0xfa, 0xb4, 0xf3, 0x6f, 0x21, 0xd5, 0xec, 0xc2, 0x9c, 0x6e, 0xcf,
+    0x27, 0x00, 0xd1, 0xa4, 0x3f, 0xec, 0x5a, 0x03, 0xaa, 0xf8, 0xeb, 0x26, 0x8e, 0x3c, 0x97, 0x26,
+    0xce, 0x45, 0xf5, 0xaa, 0x01, 0xd9, 0xf0, 0xe7, 0xd9, 0x88, 0xdb, 0x1c, 0xef, 0xea, 0x4d, 0xb3,
+    0xa3, 0xe2, 0xaa, 0x3e, 0x61, 0xba, 0x76, 0x48, 0x16, 0x17, 0xb6, 0xcc, 0x32, 0x0b, 0xef, 0x41,
+    0xe4, 0xac, 0x0e, 0x8c, 0x36, 0x93, 0xeb, 0x10, 0x1f, 0x66, 0xa3, 0x5e, 0x9f, 0xed, 0xf3, 0x23,
+    0xb1, 0x0d, 0xdd, 0x63, 0x27, 0xee, 0xb4, 0xcb, 0x8b, 0xad, 0x87, 0x1c, 0xf5, 0xad, 0x24, 0x96,
+    0x17, 0xb7, 0xf7, 0x99, 0x09, 0xa4, 0xcd, 0x75, 0xc3, 0xb9, 0x62, 0x37, 0xbf, 0x6d, 0xaa, 0x6c,
+    0x03, 0x66, 0x83, 0x78, 0x13, 0x37, 0x13, 0x25, 0x4b, 0xb0, 0x0f, 0xf0, 0xf0, 0x6a, 0xa2, 0x76,
+    0x41, 0x47, 0xba, 0xdc, 0xe1, 0x54, 0x2d, 0xe6, 0x2d, 0xc6, 0x5d, 0x84, 0x8e, 0x4b, 0xd5, 0x3e,
+    0xb3, 0xcd, 0xe6, 0xe2, 0xf4, 0x03, 0x17, 0xb3, 0xf7, 0x37, 0xb0, 0x30, 0x79, 0x2e, 0x9b, 0xdf,
+    0x9a, 0x41, 0x76, 0x63, 0x14, 0x86, 0x57, 0x63, 0x97, 0x4a, 0x83, 0x44, 0x38, 0xce, 0x17, 0x78,
+    0x57, 0x67, 0x72, 0xef, 0xa9, 0xe9, 0xce, 0xd3, 0x81, 0x94, 0x83, 0xb9, 0x2d, 0x65, 0x86, 0x34,
+    0xc7, 0xf8, 0xa8, 0xf1, 0x12, 0xdf, 0xaf, 0xa0, 0xd6, 0xf2, 0xce, 0xa6, 0x4a, 0xa5, 0x29, 0x74,
+    0x79, 0xad, 0x5e, 0x1f, 0x22, 0xd2, 0x98, 0x9e, 0xa0, 0xc2, 0xdf, 0xab, 0x19, 0xfc, 0xf0, 0xff,
+    0xa5, 0x21, 0x5b, 0x3f, 0x4f, 0x49, 0x46, 0x9a, 0xe2, 0x14, 0xee, 0xf3, 0x04, 0x64, 0xd6, 0x7b,
+    0x75, 0x7f, 0xfd, 0x57, 0x83, 0x8f, 0x38, 0x64, 0xba, 0xfe, 0xbe, 0xb6, 0x6f, 0xdc, 0x49, 0xa1,
+    0x75, 0xcd, 0x92, 0x6a, 0xf6, 0xfc, 0xe5, 0xda, 0xf9, 0x66, 0x2e, 0xa8, 0xf7, 0x61, 0xc7, 0x6f,
+    0x45, 0x99, 0x39, 0x8e, 0xcd, 0x7f, 0x4d, 0x7f, 0x6f, 0x30, 0x23, 0xbf, 0x35, 0xd6, 0x17, 0xdb,
+    0x9f, 0xfc, 0xb8, 0x16, 0xda, 0x2a, 0xb6, 0xfc, 0x98, 0x64, 0x0a, 0x8e, 0x64, 0xd3, 0x00, 0x7d,
+    0xd6, 0xec, 0xe4, 0xd4, 0xbb, 0x2c, 0xc2, 0x3d, 0x91, 0x08, 0xab, 0xed, 0x9a, 0x0f, 0xc2, 0xee,
+    0x22, 0x48, 0xcf, 0x3e, 0xf2, 0x46, 0x53, 0xfa, 0x30, 0xe9, 0xf7, 0x98, 0x64, 0x4d, 0x47, 0x2a,
+    0x4d, 0x6e, 0x9a, 0xb8, 0xb1, 0x54, 0x72, 0x78, 0xea, 0x38, 0x45, 0xc5, 0x9a, 0x35, 0x2d, 0xbf,
+    0x1a, 0x23, 0xaf, 0x74, 0x3a, 0x9d, 0xb6, 0xe2, 0x10, 0x79, 0xf4, 0x0e, 0x09, 0x4e, 0xde, 0x79,
+    0x1d, 0xf7, 0x6c, 0x56, 0xac, 0xb1, 0x02, 0xe4, 0xa6, 0xed, 0x65, 0xb8, 0x68, 0x51, 0xe9, 0x3e,
+    0xe9, 0x5a, 0x17, 0x80, 0x10, 0xce, 0x18, 0xda, 0xf0, 0xa2, 0x9a, 0xdc, 0xd5, 0x4f, 0xc6, 0x8b,
+    0xde, 0x4c, 0x25, 0x9c, 0x07, 0x37, 0xbc, 0xf1, 0x6a, 0xa1, 0x43, 0x69, 0x1e, 0x8c, 0x31, 0xe7,
+    0x67, 0x7c, 0x76, 0xe8, 0x7f, 0x54, 0xf3, 0xdf, 0xa4, 0x3b, 0xf3, 0x9a, 0x84, 0x54, 0x71, 0xac,
+    0x65, 0x7c, 0x9b, 0xc1, 0x6e, 0x27, 0x10, 0x22, 0x0f, 0xb6, 0x78, 0xdd, 0x51, 0xb2, 0x13, 0x66,
+    0x2e, 0xfa, 0xb3, 0x40, 0x1f, 0x8c, 0x1e, 0xc3, 0x7b, 0x40, 0x4a, 0x12, 0x1c, 0x41, 0xe2, 0x80,
+    0xf6, 0x1b, 0xbe, 0x57, 0x88, 0x7f, 0xae, 0x4f, 0xc9, 0x5f, 0x09, 0xd8, 0x95, 0xea, 0xea, 0xc2,
+    0xec, 0xf2, 0xba, 0xfa, 0xe9, 0x5c, 0xd9, 0xe1, 0x80, 0xfe, 0xe7, 0x74, 0x67, 0x7f, 0x3e, 0x0a,
+    0x9d, 0x69, 0x63, 0x98, 0xab, 0x3d, 0x36, 0xdc, 0x58, 0x10, 0x93, 0xba, 0x53, 0xfd, 0xff, 0x1a,
+    0xb7, 0xcc, 0xf6, 0xa0, 0xfb, 0x8f, 0x05, 0xcf, 0x63, 0x99, 0xd4, 0x81, 0xf2, 0xab, 0xdb, 0xe2,
+    0x5a, 0x52, 0xab, 0xfa, 0x23, 0x54, 0x7c, 0x88, 0xe9, 0x0f, 0x69, 0xfc, 0x2b, 0x0a, 0xbc, 0xca,
+    0x21, 0xb6, 0x35, 0x3c, 0xca, 0x3f, 0x05, 0x6e, 0x1b, 0x54, 0x5c, 0x9f, 0xcf, 0x36, 0x0c, 0x72,
+    0xba, 0xb8, 0x23, 0x44, 0xef, 0x02, 0x6b, 0x14, 0x32, 0x42, 0xa2, 0x89, 0x07, 0x4f, 0x70, 0x2e,
+    0xc5, 0xfa, 0xcf, 0xd3, 0x2c, 0xe5, 0x0b, 0xad, 0x99, 0x02, 0xfd, 0xd3, 0x01, 0xd7, 0x76, 0x78,
+    0x41, 0x3a, 0xe0, 0xa3, 0x8e, 0x6d, 0x77, 0x9f, 0x18, 0x8d, 0xa6, 0xad, 0xf2, 0x70, 0xae, 0x7e,
+    0x50, 0x41, 0xbf, 0xe0, 0x2e, 0x1e, 0x9e, 0x5a, 0x0c, 0x86, 0x30, 0xd0, 0xb3, 0x27, 0x81, 0x47,
+    0x9b, 0xf5, 0xf2, 0xfd, 0x1f, 0xd2, 0xfc, 0x64, 0x65, 0xd4, 0xa4, 0x93, 0x13, 0xdf, 0xe8, 0xd0,
+    0xd6, 0x38, 0xad, 0x9b, 0x08, 0x2f, 0xbf, 0x0c, 0x70, 0x40, 0x55, 0x40, 0xf0, 0x2f, 0xea, 0xa9,
+    0xfb, 0x63, 0xab, 0xda, 0x6d, 0x63, 0xfd, 0x6b, 0xa3, 0x62, 0x87, 0xd0, 0x1b, 0x2a, 0x5d, 0x2e,
+    0x07, 0xab, 0x90, 0xdb, 0xf5, 0x52, 0xbd, 0xdc, 0x3b, 0x0f, 0x85, 0xe6, 0xb4, 0x19, 0x4e, 0xfa,
+    0x72, 0x77, 0x3c, 0x42, 0xd6, 0x58, 0xea, 0xeb, 0xc5, 0x61, 0xa8, 0x57, 0x21, 0x05, 0xe3, 0x5d,
+    0xd8, 0x9b, 0x71, 0x9c, 0xf4, 0xe5, 0x2b, 0xd1, 0x2c, 0xf2, 0x2f, 0xb5, 0xae, 0x26, 0xad, 0xcd,
+    0xb7, 0xf3, 0x97, 0x1b, 0xa7, 0x4b, 0x0c, 0xda, 0xdf, 0xff, 0x87, 0xda, 0x20, 0xfa, 0x98, 0x23,
+    0xe0, 0xd1, 0xb4, 0x02, 0x29, 0x67, 0xe2, 0x53, 0x7e, 0x3c, 0xc9, 0x7c, 0x38, 0x0e, 0xc2, 0x9b,
+    0xf5, 0xf4, 0xe3, 0x4c, 0x53, 0x1c, 0xec, 0x63, 0xd7, 0xe1, 0xec, 0x27, 0x49, 0xdc, 0x1f, 0xf9,
+    0xc0, 0x37, 0xa8, 0xfa, 0xdc, 0x4d, 0x36, 0xaa, 0x2b, 0x6e, 0xe6, 0x1f, 0xba, 0x82, 0x89, 0x89,
+    0x25, 0x2d, 0x3c, 0x95, 0x7a, 0x8d, 0x01, 0xe6, 0x2d, 0x49, 0x3f, 0xff, 0xd7, 0xea, 0x7a, 0x81,
+    0x37, 0x55, 0xd5, 0xbb, 0x1b, 0x3b, 0xb9, 0x71, 0x20, 0x3f, 0x99, 0x92, 0xf0, 0xf7, 0x4f, 0xa8,
+    0x95, 0xab, 0xb1, 0x56, 0x69, 0xc7, 0x45, 0x94, 0xfc, 0xba, 0x5c, 0x8d, 0x72, 0x96, 0x46, 0xf7,
+    0xe7, 0x05, 0xd7, 0x25, 0x9d, 0xdf, 0xbe, 0x55, 0xe6, 0xed, 0x88, 0x3e, 0xff, 0x65, 0x59, 0x30,
+    0x51, 0x17, 0x3a, 0x6a, 0x3e, 0x54, 0xa0, 0x99, 0x4e, 0xcb, 0xe0, 0x1d, 0x0f, 0x1a, 0xc9, 0x88,
+    0xda, 0x27, 0xee, 0x8b, 0x99, 0xe2, 0x14, 0xe8, 0x2e, 0x15, 0xec, 0x81, 0xf9, 0x58, 0x3e, 0xdc,
+    0xf7, 0x61, 0x26, 0xb5, 0xbd, 0x2e, 0x0a, 0xb7, 0x83, 0x98, 0x09, 0xbb, 0x5f, 0xb7, 0x4a, 0xc2,
+    0xd4, 0x5e, 0x36, 0x8a, 0x3f, 0x88, 0xd8, 0xf6, 0x4b, 0x57, 0x6b, 0x86, 0xb6, 0xb9, 0x11, 0x9f,
+    0x99, 0x7e, 0xa4, 0xb2, 0xba, 0x1d, 0x4c, 0x57, 0xee, 0xd8, 0xf0, 0x58, 0x17, 0xe7, 0x33, 0x19,
+    0x99, 0x19, 0x2d, 0x71, 0x04, 0x03, 0x97, 0x3c, 0x5c, 0x3a, 0x5f, 0xc9, 0xce, 0xfc, 0xc8, 0x28,
+    0xc3, 0x7c, 0x96, 0x0f, 0x3d, 0x69, 0x8a, 0x2e, 0x45, 0xe6, 0x3f, 0x71, 0x58, 0x72, 0x1e, 0x6a,
+    0xdf, 0xc5, 0xfe, 0xe3, 0x85, 0xfd, 0x3b, 0x3b, 0x06, 0x3f, 0xe3, 0x5a, 0x5a, 0x10, 0x1c, 0x0e,
+    0xbd, 0x6c, 0xab, 0x52, 0xd3, 0xdd, 0xe8, 0x29, 0x3a, 0x92, 0x93, 0xfb, 0x8c, 0x8a, 0x22, 0x24,
+    0xb3, 0xa8, 0xef, 0x50, 0x7a, 0x60, 0x99, 0x52, 0x69, 0xfb, 0x03, 0x0c, 0x51, 0xc7, 0x6a, 0xa3,
+    0x0e, 0xa8, 0x2c, 0x2a, 0xe5, 0x91, 0x6a, 0xdc, 0x17, 0xf3, 0x1f, 0xbb, 0xdb, 0xe9, 0x56, 0xb1,
+    0xe7, 0xc5, 0xf4, 0x8d, 0x47, 0x84, 0xac, 0xa2, 0x7b, 0xe0, 0x3c, 0x1a, 0x72, 0x52, 0xf3, 0xa8,
+    0x89, 0xb2, 0xf9, 0x8a, 0x5e, 0x12, 0x79, 0x7c, 0x53, 0x40, 0xc2, 0xd4, 0x3d, 0xa1, 0x91, 0x79,
+    0xd9, 0xfb, 0xc4, 0xd3, 0x8c, 0x31, 0x10, 0xf8, 0xc8, 0x2f, 0x04, 0x81, 0x69, 0x0f, 0x8e, 0x90,
+    0xbb, 0x9c, 0xe7, 0x4c, 0x3e, 0xaa, 0xd5, 0x0c, 0x1f, 0x72, 0x9a, 0x92, 0x11, 0x2e, 0x63, 0x24,
+    0xef, 0x31, 0x52, 0xe2, 0xbb, 0x6c, 0x8d, 0x5e, 0x9d, 0x4c, 0x81, 0x3e, 0xdb, 0x8f, 0xb1, 0xdc,
+    0x9f, 0x11, 0xfa, 0x46, 0x64, 0x62, 0x3e, 0x33, 0x4c, 0x93, 0xe9, 0xde, 0xad, 0x10, 0xcd, 0x77,
+    0x5e, 0x71, 0x74, 0xdd, 0x0c, 0x2f, 0x7e, 0xc8, 0x0a, 0x20, 0x03, 0x97, 0xdd, 0xff, 0x48, 0xc9,
+    0x82, 0xbe, 0xb6, 0x8c, 0xfa, 0x23, 0x73, 0x77, 0x6e, 0x7f, 0x5f, 0xba, 0x55, 0xca, 0x60, 0xc9,
+    0x52, 0x7b, 0xbd, 0x8d, 0x1e, 0x75, 0x3c, 0x18, 0x8e, 0xc8, 0xa8, 0x9c, 0x78, 0xfc, 0x25, 0x8e,
+    0x2e, 0x22, 0xa8, 0xa6, 0xf5, 0x19, 0xc1, 0x00, 0x03, 0xba, 0x7e, 0xbe, 0xeb, 0x0f, 0xbe, 0x7d,
+    0x32, 0x3f, 0x7f, 0xa9, 0xca, 0xf0, 0xa1, 0x27, 0x8c, 0x0c, 0x69, 0x3c, 0xb8, 0x78, 0x18, 0x3b,
+    0xe7, 0x18, 0xbe, 0x2c, 0x9f, 0xd3, 0x87, 0x4f, 0xe7, 0xc5, 0x40, 0x02, 0xf5, 0xa9, 0x46, 0x98,
+    0x2f, 0xe3, 0xfe, 0x81, 0xb6, 0xac, 0x7e, 0x45, 0x1b, 0x8c, 0x44, 0xb7, 0xd3, 0xbc, 0xbc, 0xcd,
+    0xe5, 0xdf, 0x1e, 0x3c, 0x73, 0xac, 0xcd, 0xc0, 0xf0, 0xbe, 0x01, 0x01, 0xf5, 0x07, 0x0d, 0xac,
+    0x09, 0x86, 0x29, 0x81, 0x04, 0xe9, 0xff, 0x13, 0x92, 0x46, 0xd9, 0x19, 0xcb, 0x6f, 0x0a, 0xe4,
+    0x5a, 0xc4, 0x47, 0x49, 0xd6, 0x62, 0x45, 0xc6, 0x93, 0xa7, 0xf7, 0x63, 0x39, 0x45, 0xe2, 0x71,
+    0x30, 0xf5, 0xf9, 0x2f, 0xcd, 0x74, 0xdc, 0x1d, 0x8b, 0xbf, 0xa4, 0xc1, 0xe2, 0xc0, 0xcd, 0x7a,
+    0x99, 0x9e, 0x53, 0xff, 0x6b, 0x78, 0xd7, 0x1f,
 };
+const ShaderModule Blob079 = { Blob079_Data, 6952u, 6687u, 79u };
 
-extern const uint32_t Blob080[6687];
-const uint32_t Blob080[6687] = {
-    0x07230203, 0x00010300, 0x0008000b, 0x000003e4, 0x00000000, 0x00020011, 0x00000001, 0x0006000b,
-    0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001,
-    0x0008000f, 0x00000005, 0x00000004, 0x6e69616d, 0x00000000, 0x000000d9, 0x0000029b, 0x000002b3,
-    0x00060010, 0x00000004, 0x00000011, 0x00000020, 0x00000020, 0x00000001, 0x00030003, 0x00000002,
-    0x000001c2, 0x000a0004, 0x475f4c47, 0x4c474f4f, 0x70635f45, 0x74735f70, 0x5f656c79, 0x656e696c,
-    0x7269645f, 0x69746365, 0x00006576, 0x00080004, 0x475f4c47, 0x4c474f4f, 0x6e695f45, 0x64756c63,
-    0x69645f65, 0x74636572, 0x00657669, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000, 0x000a0005,
-    0x00000010, 0x74706544, 0x73655468, 0x73615074, 0x28736573, 0x623b3162, 0x31753b31, 0x3b31753b,
-    0x003b3175, 0x00060005, 0x0000000b, 0x61757165, 0x7065446c, 0x65546874, 0x00007473, 0x00050005,
-    0x0000000c, 0x69636166, 0x6956676e, 0x00007765, 0x00050005, 0x0000000d, 0x44747364, 0x68747065,
-    0x00000000, 0x00050005, 0x0000000e, 0x656c6974, 0x74706544, 0x00000068, 0x00040005, 0x0000000f,
-    0x41747364, 0x00727474, 0x000d0005, 0x0000001c, 0x746f6c50, 0x6e617254, 0x63756c73, 0x28746e65,
-    0x753b3175, 0x31753b31, 0x3b31623b, 0x753b3175, 0x31753b31, 0x3b31753b, 0x003b3162, 0x00040005,
-    0x00000013, 0x6f6c6f63, 0x00000072, 0x00040005, 0x00000014, 0x74706564, 0x00000068, 0x00040005,
-    0x00000015, 0x72747461, 0x00000000, 0x00050005, 0x00000016, 0x68537369, 0x776f6461, 0x00000000,
-    0x00050005, 0x00000017, 0x656c6974, 0x6f6c6f43, 0x00000072, 0x00040005, 0x00000018, 0x41637273,
-    0x00000000, 0x00050005, 0x00000019, 0x656c6974, 0x74706544, 0x00000068, 0x00040005, 0x0000001a,
-    0x41637273, 0x00727474, 0x00050005, 0x0000001b, 0x74697277, 0x70654465, 0x00006874, 0x00100005,
-    0x0000002d, 0x636f7250, 0x43737365, 0x7372616f, 0x73614d65, 0x3169286b, 0x3b31753b, 0x763b3175,
-    0x763b3275, 0x763b3275, 0x763b3275, 0x623b3275, 0x31753b31, 0x3b31623b, 0x00000000, 0x00050005,
-    0x00000023, 0x656e696c, 0x69547261, 0x0000656c, 0x00050005, 0x00000024, 0x72616f63, 0x614d6573,
-    0x00006b73, 0x00060005, 0x00000025, 0x72616f63, 0x664f6573, 0x74657366, 0x00000000, 0x00040005,
-    0x00000026, 0x6f6c6f63, 0x00000072, 0x00040005, 0x00000027, 0x74706564, 0x00000068, 0x00040005,
-    0x00000028, 0x72747461, 0x00000000, 0x00040005, 0x00000029, 0x6e6e6977, 0x00007265, 0x00060005,
-    0x0000002a, 0x63617274, 0x766f436b, 0x67617265, 0x00000065, 0x00040005, 0x0000002b, 0x6e657473,
-    0x006c6963, 0x00070005, 0x0000002c, 0x76657270, 0x68537349, 0x776f6461, 0x6b73614d, 0x00000000,
-    0x00050005, 0x00000050, 0x6e656c62, 0x74744164, 0x00000072, 0x00040005, 0x0000008b, 0x52637273,
-    0x00000042, 0x00040005, 0x0000008f, 0x47637273, 0x00000000, 0x00040005, 0x00000093, 0x52747364,
-    0x00000042, 0x00040005, 0x00000096, 0x47747364, 0x00000000, 0x00040005, 0x00000099, 0x41747364,
-    0x00000000, 0x00040005, 0x0000009d, 0x68706c61, 0x00000061, 0x00050005, 0x000000ac, 0x6174654d,
-    0x66696e55, 0x006d726f, 0x00060006, 0x000000ac, 0x00000000, 0x506d754e, 0x67796c6f, 0x00736e6f,
-    0x00060006, 0x000000ac, 0x00000001, 0x566d754e, 0x61697261, 0x0073746e, 0x00060006, 0x000000ac,
-    0x00000002, 0x68706c41, 0x66655261, 0x00000000, 0x00050006, 0x000000ac, 0x00000003, 0x70736944,
-    0x00746e43, 0x00060006, 0x000000ac, 0x00000004, 0x6e6f6f54, 0x6c626154, 0x00000065, 0x00060006,
-    0x000000ac, 0x00000005, 0x61656c43, 0x6c6f4372, 0x0000726f, 0x00060006, 0x000000ac, 0x00000006,
-    0x61656c43, 0x70654472, 0x00006874, 0x00060006, 0x000000ac, 0x00000007, 0x61656c43, 0x74744172,
-    0x00000072, 0x00060006, 0x000000ac, 0x00000008, 0x4f676f46, 0x65736666, 0x00000074, 0x00060006,
-    0x000000ac, 0x00000009, 0x53676f46, 0x74666968, 0x00000000, 0x00060006, 0x000000ac, 0x0000000a,
-    0x43676f46, 0x726f6c6f, 0x00000000, 0x00080006, 0x000000ac, 0x0000000b, 0x61656c43, 0x74694272,
-    0x4f70616d, 0x65736666, 0x00000074, 0x00030005, 0x000000ae, 0x00000000, 0x00060005, 0x000000d6,
-    0x656c6974, 0x656e6e49, 0x66664f72, 0x00746573, 0x00080005, 0x000000d9, 0x4c5f6c67, 0x6c61636f,
-    0x6f766e49, 0x69746163, 0x44496e6f, 0x00000000, 0x00050005, 0x000000eb, 0x72616f63, 0x69426573,
-    0x00000074, 0x00050005, 0x000000f4, 0x656c6974, 0x7366664f, 0x00007465, 0x00050005, 0x000000fd,
-    0x656e6966, 0x6b73614d, 0x00000000, 0x00060005, 0x00000103, 0x526e6942, 0x6c757365, 0x66754274,
-    0x00726566, 0x00080006, 0x00000103, 0x00000000, 0x69726156, 0x57746e61, 0x436b726f, 0x746e756f,
-    0x00000000, 0x00080006, 0x00000103, 0x00000001, 0x74726f53, 0x6f576465, 0x664f6b72, 0x74657366,
-    0x00000000, 0x00090006, 0x00000103, 0x00000002, 0x69726156, 0x57746e61, 0x526b726f, 0x436c6165,
-    0x746e756f, 0x00000000, 0x00080006, 0x00000103, 0x00000003, 0x74726f53, 0x6b726f57, 0x6b726f57,
-    0x6e756f43, 0x00000074, 0x00090006, 0x00000103, 0x00000004, 0x6e6e6942, 0x4d676e69, 0x416b7361,
-    0x664f646e, 0x74657366, 0x00000000, 0x00030005, 0x00000105, 0x00000000, 0x00050005, 0x00000108,
-    0x65726353, 0x69576e65, 0x00687464, 0x00060005, 0x00000109, 0x656c6954, 0x72655073, 0x656e694c,
-    0x00000000, 0x00060005, 0x0000010a, 0x65726353, 0x65486e65, 0x74686769, 0x00000000, 0x00050005,
-    0x0000010b, 0x656c6954, 0x656e694c, 0x00000073, 0x00070005, 0x0000010f, 0x6e6e6942, 0x4d676e69,
-    0x536b7361, 0x74726174, 0x00000000, 0x00040005, 0x00000116, 0x6b726f77, 0x00786449, 0x00080005,
-    0x00000119, 0x6e6e6942, 0x57676e69, 0x4f6b726f, 0x65736666, 0x74537374, 0x00747261, 0x00040005,
-    0x00000126, 0x656e6966, 0x00786449, 0x00050005, 0x0000012f, 0x65786970, 0x646e696c, 0x00007865,
-    0x00050005, 0x00000136, 0x656c6974, 0x6f6c6f43, 0x00000072, 0x00060005, 0x00000138, 0x6f6c6f43,
-    0x6c695472, 0x66754265, 0x00726566, 0x00060006, 0x00000138, 0x00000000, 0x6f6c6f43, 0x6c695472,
-    0x00007365, 0x00030005, 0x0000013a, 0x00000000, 0x00050005, 0x00000141, 0x796c6f70, 0x496e6f67,
-    0x00007864, 0x00060005, 0x00000142, 0x68737550, 0x736e6f43, 0x746e6174, 0x00000073, 0x00060006,
-    0x00000142, 0x00000000, 0x56727543, 0x61697261, 0x0000746e, 0x00060006, 0x00000142, 0x00000001,
-    0x57786554, 0x68746469, 0x00000000, 0x00060006, 0x00000142, 0x00000002, 0x48786554, 0x68676965,
-    0x00000074, 0x00060006, 0x00000142, 0x00000003, 0x57786554, 0x53706172, 0x00000000, 0x00060006,
-    0x00000142, 0x00000004, 0x57786554, 0x54706172, 0x00000000, 0x00070006, 0x00000142, 0x00000005,
-    0x49786554, 0x70614373, 0x65727574, 0x00000000, 0x00070006, 0x00000142, 0x00000006, 0x74706143,
-    0x59657275, 0x7366664f, 0x00007465, 0x00050006, 0x00000142, 0x00000007, 0x6461705f, 0x00000000,
-    0x00030005, 0x00000144, 0x00006370, 0x00050005, 0x00000153, 0x796c6f70, 0x416e6f67, 0x00727474,
-    0x00040005, 0x00000154, 0x796c6f50, 0x006e6f67, 0x00060006, 0x00000154, 0x00000000, 0x73726946,
-    0x70535874, 0x00006e61, 0x00050006, 0x00000154, 0x00000001, 0x706f5459, 0x00000000, 0x00050006,
-    0x00000154, 0x00000002, 0x746f4259, 0x00000000, 0x00050006, 0x00000154, 0x00000003, 0x6e694d58,
-    0x00000000, 0x00050006, 0x00000154, 0x00000004, 0x78614d58, 0x00000000, 0x00050006, 0x00000154,
-    0x00000005, 0x6e694d58, 0x00000059, 0x00050006, 0x00000154, 0x00000006, 0x78614d58, 0x00000059,
-    0x00050006, 0x00000154, 0x00000007, 0x69726156, 0x00746e61, 0x00050006, 0x00000154, 0x00000008,
-    0x72747441, 0x00000000, 0x00070006, 0x00000154, 0x00000009, 0x74786554, 0x4c657275, 0x72657961,
-    0x00000000, 0x00060006, 0x00000154, 0x0000000a, 0x69636146, 0x6956676e, 0x00007765, 0x00060005,
-    0x00000156, 0x796c6f50, 0x426e6f67, 0x65666675, 0x00000072, 0x00060006, 0x00000156, 0x00000000,
-    0x796c6f50, 0x736e6f67, 0x00000000, 0x00030005, 0x00000158, 0x00000000, 0x00050005, 0x0000015c,
-    0x69636166, 0x6956676e, 0x00007765, 0x00060005, 0x00000162, 0x68537369, 0x776f6461, 0x6b73614d,
-    0x00000000, 0x00070005, 0x00000168, 0x76657270, 0x68537349, 0x776f6461, 0x6b73614d, 0x00646c4f,
-    0x00060005, 0x0000016b, 0x61757165, 0x7065446c, 0x65546874, 0x00007473, 0x00050005, 0x00000170,
-    0x656c6974, 0x74706544, 0x00000068, 0x00060005, 0x00000172, 0x74706544, 0x6c695468, 0x66754265,
-    0x00726566, 0x00060006, 0x00000172, 0x00000000, 0x74706544, 0x6c695468, 0x00007365, 0x00030005,
-    0x00000174, 0x00000000, 0x00050005, 0x00000178, 0x656c6974, 0x72747441, 0x00000000, 0x00060005,
-    0x0000017a, 0x72747441, 0x656c6954, 0x66667542, 0x00007265, 0x00060006, 0x0000017a, 0x00000000,
-    0x72747441, 0x656c6954, 0x00000073, 0x00030005, 0x0000017c, 0x00000000, 0x00040005, 0x00000180,
-    0x61747364, 0x00727474, 0x00050005, 0x00000187, 0x68537369, 0x776f6461, 0x00000000, 0x00070005,
-    0x0000018b, 0x74697277, 0x63655365, 0x4c646e6f, 0x72657961, 0x00000000, 0x00050005, 0x000001a4,
-    0x44747364, 0x68747065, 0x00000000, 0x00040005, 0x000001af, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001b1, 0x61726170, 0x0000006d, 0x00040005, 0x000001b3, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001b5, 0x61726170, 0x0000006d, 0x00040005, 0x000001b7, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001c8, 0x61726170, 0x0000006d, 0x00040005, 0x000001ca, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001cc, 0x61726170, 0x0000006d, 0x00040005, 0x000001cf, 0x61726170, 0x0000006d, 0x00040005,
-    0x000001d1, 0x61726170, 0x0000006d, 0x00040005, 0x000001d8, 0x41637273, 0x00727474, 0x00040005,
-    0x000001e2, 0x41637273, 0x00000000, 0x00050005, 0x00000224, 0x74697277, 0x70654465, 0x00006874,
-    0x00040005, 0x0000022c, 0x61726170, 0x0000006d, 0x00040005, 0x0000022f, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000232, 0x61726170, 0x0000006d, 0x00040005, 0x00000235, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000237, 0x61726170, 0x0000006d, 0x00040005, 0x00000239, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000023b, 0x61726170, 0x0000006d, 0x00040005, 0x0000023d, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000023f, 0x61726170, 0x0000006d, 0x00040005, 0x00000252, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000255, 0x61726170, 0x0000006d, 0x00040005, 0x00000258, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000025b, 0x61726170, 0x0000006d, 0x00040005, 0x0000025d, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000025f, 0x61726170, 0x0000006d, 0x00040005, 0x00000261, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000263, 0x61726170, 0x0000006d, 0x00040005, 0x00000265, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000273, 0x61726170, 0x0000006d, 0x00040005, 0x00000275, 0x61726170, 0x0000006d,
-    0x00040005, 0x00000277, 0x61726170, 0x0000006d, 0x00040005, 0x0000027a, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000027c, 0x61726170, 0x0000006d, 0x00040005, 0x00000288, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000028a, 0x61726170, 0x0000006d, 0x00040005, 0x0000028c, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000028f, 0x61726170, 0x0000006d, 0x00040005, 0x00000291, 0x61726170, 0x0000006d,
-    0x00050005, 0x0000029a, 0x656e696c, 0x69547261, 0x0000656c, 0x00060005, 0x0000029b, 0x575f6c67,
-    0x476b726f, 0x70756f72, 0x00004449, 0x00060005, 0x000002a4, 0x72616f63, 0x614d6573, 0x6f4c6b73,
-    0x00000000, 0x00060005, 0x000002ab, 0x72616f63, 0x614d6573, 0x69486b73, 0x00000000, 0x00060005,
-    0x000002b2, 0x75736572, 0x664f746c, 0x74657366, 0x00000000, 0x00080005, 0x000002b3, 0x475f6c67,
-    0x61626f6c, 0x766e496c, 0x7461636f, 0x496e6f69, 0x00000044, 0x00040005, 0x000002bc, 0x6e6e6977,
-    0x00007265, 0x00060005, 0x000002bf, 0x63617274, 0x766f436b, 0x67617265, 0x00000065, 0x00040005,
-    0x000002c9, 0x6e657473, 0x006c6963, 0x00070005, 0x000002ca, 0x76657270, 0x68537349, 0x776f6461,
-    0x6b73614d, 0x00000000, 0x00040005, 0x000002d0, 0x6f6c6f63, 0x00000072, 0x00060005, 0x000002d2,
-    0x75736552, 0x7542746c, 0x72656666, 0x00000000, 0x00060006, 0x000002d2, 0x00000000, 0x75736552,
-    0x6156746c, 0x0065756c, 0x00030005, 0x000002d4, 0x00000000, 0x00070005, 0x000002dd, 0x6d617246,
-    0x66756265, 0x53726566, 0x64697274, 0x00000065, 0x00040005, 0x000002e3, 0x74706564, 0x00000068,
-    0x00070005, 0x000002e7, 0x75736552, 0x6544746c, 0x53687470, 0x74726174, 0x00000000, 0x00040005,
-    0x000002f5, 0x72747461, 0x00000000, 0x00060005, 0x000002f9, 0x75736552, 0x7441746c, 0x74537274,
-    0x00747261, 0x00070005, 0x0000030b, 0x75736552, 0x6957746c, 0x72656e6e, 0x66667542, 0x00007265,
-    0x00070006, 0x0000030b, 0x00000000, 0x75736552, 0x6957746c, 0x72656e6e, 0x00000000, 0x00030005,
-    0x0000030d, 0x00000000, 0x00060005, 0x00000316, 0x746e6f63, 0x61756e69, 0x6e6f6974, 0x00000000,
-    0x00080005, 0x00000318, 0x6e656c42, 0x6e6f4364, 0x756e6974, 0x6f697461, 0x6675426e, 0x00726566,
-    0x00090006, 0x00000318, 0x00000000, 0x6e656c42, 0x6e6f4364, 0x756e6974, 0x6f697461, 0x6174536e,
-    0x00006574, 0x00030005, 0x0000031a, 0x00000000, 0x00040005, 0x00000331, 0x6c616373, 0x00000065,
-    0x00030005, 0x00000336, 0x00736f70, 0x00070005, 0x00000344, 0x61656c43, 0x74694272, 0x4370616d,
-    0x726f6c6f, 0x00000000, 0x00070005, 0x0000034b, 0x61656c43, 0x74694272, 0x4470616d, 0x68747065,
-    0x00000000, 0x00040005, 0x00000370, 0x61726170, 0x0000006d, 0x00040005, 0x00000372, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000374, 0x61726170, 0x0000006d, 0x00040005, 0x00000375, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000377, 0x61726170, 0x0000006d, 0x00040005, 0x00000379, 0x61726170,
-    0x0000006d, 0x00040005, 0x0000037b, 0x61726170, 0x0000006d, 0x00040005, 0x0000037d, 0x61726170,
-    0x0000006d, 0x00040005, 0x0000037f, 0x61726170, 0x0000006d, 0x00040005, 0x00000381, 0x61726170,
-    0x0000006d, 0x00040005, 0x0000038a, 0x61726170, 0x0000006d, 0x00040005, 0x0000038c, 0x61726170,
-    0x0000006d, 0x00040005, 0x0000038e, 0x61726170, 0x0000006d, 0x00040005, 0x0000038f, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000391, 0x61726170, 0x0000006d, 0x00040005, 0x00000393, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000395, 0x61726170, 0x0000006d, 0x00040005, 0x00000397, 0x61726170,
-    0x0000006d, 0x00040005, 0x00000399, 0x61726170, 0x0000006d, 0x00040005, 0x0000039b, 0x61726170,
-    0x0000006d, 0x00060005, 0x000003e0, 0x5778614d, 0x546b726f, 0x73656c69, 0x00000000, 0x00040047,
-    0x000000a9, 0x00000006, 0x00000010, 0x00050048, 0x000000ac, 0x00000000, 0x00000023, 0x00000000,
-    0x00050048, 0x000000ac, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x000000ac, 0x00000002,
-    0x00000023, 0x00000008, 0x00050048, 0x000000ac, 0x00000003, 0x00000023, 0x0000000c, 0x00050048,
-    0x000000ac, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x000000ac, 0x00000005, 0x00000023,
-    0x00000230, 0x00050048, 0x000000ac, 0x00000006, 0x00000023, 0x00000234, 0x00050048, 0x000000ac,
-    0x00000007, 0x00000023, 0x00000238, 0x00050048, 0x000000ac, 0x00000008, 0x00000023, 0x0000023c,
-    0x00050048, 0x000000ac, 0x00000009, 0x00000023, 0x00000240, 0x00050048, 0x000000ac, 0x0000000a,
-    0x00000023, 0x00000244, 0x00050048, 0x000000ac, 0x0000000b, 0x00000023, 0x00000248, 0x00030047,
-    0x000000ac, 0x00000002, 0x00040047, 0x000000ae, 0x00000022, 0x00000000, 0x00040047, 0x000000ae,
-    0x00000021, 0x00000000, 0x00040047, 0x000000d9, 0x0000000b, 0x0000001b, 0x00040047, 0x000000ff,
-    0x00000006, 0x00000010, 0x00040047, 0x00000100, 0x00000006, 0x00000004, 0x00040047, 0x00000101,
-    0x00000006, 0x00000004, 0x00040047, 0x00000102, 0x00000006, 0x00000004, 0x00050048, 0x00000103,
-    0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000103, 0x00000001, 0x00000023, 0x00008000,
-    0x00050048, 0x00000103, 0x00000002, 0x00000023, 0x0000a000, 0x00050048, 0x00000103, 0x00000003,
-    0x00000023, 0x0000c000, 0x00050048, 0x00000103, 0x00000004, 0x00000023, 0x0000c010, 0x00030047,
-    0x00000103, 0x00000002, 0x00040047, 0x00000105, 0x00000022, 0x00000000, 0x00040047, 0x00000105,
-    0x00000021, 0x00000008, 0x00040047, 0x00000108, 0x00000001, 0x00000000, 0x00040047, 0x0000010a,
-    0x00000001, 0x00000001, 0x00040047, 0x00000137, 0x00000006, 0x00000004, 0x00050048, 0x00000138,
-    0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000138, 0x00000002, 0x00040047, 0x0000013a,
-    0x00000022, 0x00000000, 0x00040047, 0x0000013a, 0x00000021, 0x00000004, 0x00050048, 0x00000142,
-    0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000142, 0x00000001, 0x00000023, 0x00000004,
-    0x00050048, 0x00000142, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x00000142, 0x00000003,
-    0x00000023, 0x0000000c, 0x00050048, 0x00000142, 0x00000004, 0x00000023, 0x00000010, 0x00050048,
-    0x00000142, 0x00000005, 0x00000023, 0x00000014, 0x00050048, 0x00000142, 0x00000006, 0x00000023,
-    0x00000018, 0x00050048, 0x00000142, 0x00000007, 0x00000023, 0x0000001c, 0x00030047, 0x00000142,
-    0x00000002, 0x00050048, 0x00000154, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000154,
-    0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x00000154, 0x00000002, 0x00000023, 0x00000008,
-    0x00050048, 0x00000154, 0x00000003, 0x00000023, 0x0000000c, 0x00050048, 0x00000154, 0x00000004,
-    0x00000023, 0x00000010, 0x00050048, 0x00000154, 0x00000005, 0x00000023, 0x00000014, 0x00050048,
-    0x00000154, 0x00000006, 0x00000023, 0x00000018, 0x00050048, 0x00000154, 0x00000007, 0x00000023,
-    0x0000001c, 0x00050048, 0x00000154, 0x00000008, 0x00000023, 0x00000020, 0x00050048, 0x00000154,
-    0x00000009, 0x00000023, 0x00000024, 0x00050048, 0x00000154, 0x0000000a, 0x00000023, 0x00000028,
-    0x00040047, 0x00000155, 0x00000006, 0x0000002c, 0x00040048, 0x00000156, 0x00000000, 0x00000018,
-    0x00050048, 0x00000156, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000156, 0x00000002,
-    0x00040047, 0x00000158, 0x00000022, 0x00000000, 0x00040047, 0x00000158, 0x00000021, 0x00000001,
-    0x00040047, 0x00000171, 0x00000006, 0x00000004, 0x00050048, 0x00000172, 0x00000000, 0x00000023,
-    0x00000000, 0x00030047, 0x00000172, 0x00000002, 0x00040047, 0x00000174, 0x00000022, 0x00000000,
-    0x00040047, 0x00000174, 0x00000021, 0x00000005, 0x00040047, 0x00000179, 0x00000006, 0x00000004,
-    0x00050048, 0x0000017a, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x0000017a, 0x00000002,
-    0x00040047, 0x0000017c, 0x00000022, 0x00000000, 0x00040047, 0x0000017c, 0x00000021, 0x00000006,
-    0x00040047, 0x0000029b, 0x0000000b, 0x0000001a, 0x00040047, 0x000002b3, 0x0000000b, 0x0000001c,
-    0x00040047, 0x000002d1, 0x00000006, 0x00000004, 0x00050048, 0x000002d2, 0x00000000, 0x00000023,
-    0x00000000, 0x00030047, 0x000002d2, 0x00000002, 0x00040047, 0x000002d4, 0x00000022, 0x00000000,
-    0x00040047, 0x000002d4, 0x00000021, 0x00000007, 0x00040047, 0x0000030a, 0x00000006, 0x00000004,
-    0x00050048, 0x0000030b, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x0000030b, 0x00000002,
-    0x00040047, 0x0000030d, 0x00000022, 0x00000000, 0x00040047, 0x0000030d, 0x00000021, 0x00000010,
-    0x00040047, 0x00000317, 0x00000006, 0x00000004, 0x00050048, 0x00000318, 0x00000000, 0x00000023,
-    0x00000000, 0x00030047, 0x00000318, 0x00000002, 0x00040047, 0x0000031a, 0x00000022, 0x00000000,
-    0x00040047, 0x0000031a, 0x00000021, 0x0000000f, 0x00040047, 0x00000344, 0x00000022, 0x00000001,
-    0x00040047, 0x00000344, 0x00000021, 0x00000003, 0x00040047, 0x0000034b, 0x00000022, 0x00000001,
-    0x00040047, 0x0000034b, 0x00000021, 0x00000004, 0x00040047, 0x000003e0, 0x00000001, 0x00000002,
-    0x00040047, 0x000003e3, 0x0000000b, 0x00000019, 0x00020013, 0x00000002, 0x00030021, 0x00000003,
-    0x00000002, 0x00020014, 0x00000006, 0x00040020, 0x00000007, 0x00000007, 0x00000006, 0x00040015,
-    0x00000008, 0x00000020, 0x00000000, 0x00040020, 0x00000009, 0x00000007, 0x00000008, 0x00080021,
-    0x0000000a, 0x00000006, 0x00000007, 0x00000007, 0x00000009, 0x00000009, 0x00000009, 0x000c0021,
-    0x00000012, 0x00000002, 0x00000009, 0x00000009, 0x00000009, 0x00000007, 0x00000009, 0x00000009,
-    0x00000009, 0x00000009, 0x00000007, 0x00040015, 0x0000001e, 0x00000020, 0x00000001, 0x00040020,
-    0x0000001f, 0x00000007, 0x0000001e, 0x00040017, 0x00000020, 0x00000008, 0x00000002, 0x00040020,
-    0x00000021, 0x00000007, 0x00000020, 0x000d0021, 0x00000022, 0x00000002, 0x0000001f, 0x00000009,
-    0x00000009, 0x00000021, 0x00000021, 0x00000021, 0x00000021, 0x00000007, 0x00000009, 0x00000007,
-    0x0004002b, 0x00000008, 0x00000035, 0x000000ff, 0x0004002b, 0x00000008, 0x00000037, 0x000001fe,
-    0x0004002b, 0x00000008, 0x0000003e, 0x00400010, 0x0004002b, 0x00000008, 0x00000040, 0x00000010,
-    0x0004002b, 0x00000008, 0x00000052, 0x0000e0f0, 0x0004002b, 0x0000001e, 0x00000055, 0x00000008,
-    0x0004002b, 0x00000008, 0x00000057, 0x00ff0000, 0x0004002b, 0x00000008, 0x0000005a, 0x00400000,
-    0x0004002b, 0x00000008, 0x0000005d, 0xff001f0f, 0x0004002b, 0x00000008, 0x00000067, 0x00000000,
-    0x0004002b, 0x00000008, 0x0000006e, 0x007f0000, 0x0004002b, 0x00000008, 0x00000075, 0x3f000000,
-    0x0004002b, 0x00000008, 0x00000082, 0x00008000, 0x0004002b, 0x00000008, 0x00000087, 0xffff7fff,
-    0x0004002b, 0x00000008, 0x0000008d, 0x003f003f, 0x0004002b, 0x00000008, 0x00000091, 0x00003f00,
-    0x0004002b, 0x00000008, 0x0000009b, 0x1f000000, 0x0004002b, 0x0000001e, 0x0000009f, 0x00000018,
-    0x0004002b, 0x00000008, 0x000000a1, 0x00000001, 0x00040017, 0x000000a7, 0x00000008, 0x00000004,
-    0x0004002b, 0x00000008, 0x000000a8, 0x00000022, 0x0004001c, 0x000000a9, 0x000000a7, 0x000000a8,
-    0x00030016, 0x000000aa, 0x00000020, 0x00040017, 0x000000ab, 0x000000aa, 0x00000002, 0x000e001e,
-    0x000000ac, 0x00000008, 0x00000008, 0x0000001e, 0x00000008, 0x000000a9, 0x00000008, 0x00000008,
-    0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x000000ab, 0x00040020, 0x000000ad, 0x00000002,
-    0x000000ac, 0x0004003b, 0x000000ad, 0x000000ae, 0x00000002, 0x0004002b, 0x0000001e, 0x000000af,
-    0x00000003, 0x00040020, 0x000000b0, 0x00000002, 0x00000008, 0x0004002b, 0x00000008, 0x000000b3,
-    0x00000008, 0x0004002b, 0x00000008, 0x000000bd, 0x00000020, 0x0004002b, 0x0000001e, 0x000000c2,
-    0x00000005, 0x00040017, 0x000000d7, 0x00000008, 0x00000003, 0x00040020, 0x000000d8, 0x00000001,
-    0x000000d7, 0x0004003b, 0x000000d8, 0x000000d9, 0x00000001, 0x00040020, 0x000000da, 0x00000001,
-    0x00000008, 0x0004002b, 0x0000001e, 0x000000e1, 0x00000020, 0x0004002b, 0x0000001e, 0x000000f6,
-    0x00000040, 0x0004002b, 0x00000008, 0x000000fe, 0x00000800, 0x0004001c, 0x000000ff, 0x000000a7,
-    0x000000fe, 0x0004001c, 0x00000100, 0x00000008, 0x000000fe, 0x0004001c, 0x00000101, 0x00000008,
-    0x000000fe, 0x0003001d, 0x00000102, 0x00000008, 0x0007001e, 0x00000103, 0x000000ff, 0x00000100,
-    0x00000101, 0x000000a7, 0x00000102, 0x00040020, 0x00000104, 0x0000000c, 0x00000103, 0x0004003b,
-    0x00000104, 0x00000105, 0x0000000c, 0x0004002b, 0x0000001e, 0x00000106, 0x00000004, 0x0004002b,
-    0x0000001e, 0x00000107, 0x00000000, 0x00040032, 0x0000001e, 0x00000108, 0x00000100, 0x00060034,
-    0x0000001e, 0x00000109, 0x00000087, 0x00000108, 0x000000e1, 0x00040032, 0x0000001e, 0x0000010a,
-    0x000000c0, 0x00060034, 0x0000001e, 0x0000010b, 0x00000087, 0x0000010a, 0x000000e1, 0x00060034,
-    0x0000001e, 0x0000010c, 0x00000084, 0x00000109, 0x0000010b, 0x0004002b, 0x0000001e, 0x0000010d,
-    0x00000002, 0x00060034, 0x0000001e, 0x0000010e, 0x00000084, 0x0000010c, 0x0000010d, 0x00060034,
-    0x0000001e, 0x0000010f, 0x00000080, 0x00000107, 0x0000010e, 0x00060034, 0x00000008, 0x00000110,
-    0x00000080, 0x0000010f, 0x00000067, 0x00040020, 0x00000113, 0x0000000c, 0x00000008, 0x00060034,
-    0x0000001e, 0x00000117, 0x00000084, 0x00000109, 0x0000010b, 0x00060034, 0x0000001e, 0x00000118,
-    0x00000084, 0x00000117, 0x000000f6, 0x00060034, 0x0000001e, 0x00000119, 0x00000080, 0x0000010f,
-    0x00000118, 0x00060034, 0x00000008, 0x0000011a, 0x00000080, 0x00000119, 0x00000067, 0x0003001d,
-    0x00000137, 0x00000008, 0x0003001e, 0x00000138, 0x00000137, 0x00040020, 0x00000139, 0x0000000c,
-    0x00000138, 0x0004003b, 0x00000139, 0x0000013a, 0x0000000c, 0x0004002b, 0x0000001e, 0x0000013f,
-    0x00000001, 0x000a001e, 0x00000142, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000008,
-    0x00000008, 0x0000001e, 0x00000008, 0x00040020, 0x00000143, 0x00000009, 0x00000142, 0x0004003b,
-    0x00000143, 0x00000144, 0x00000009, 0x00040020, 0x00000145, 0x00000009, 0x00000008, 0x000d001e,
-    0x00000154, 0x0000001e, 0x0000001e, 0x0000001e, 0x0000001e, 0x0000001e, 0x0000001e, 0x0000001e,
-    0x0000001e, 0x00000008, 0x000000aa, 0x00000008, 0x0003001d, 0x00000155, 0x00000154, 0x0003001e,
-    0x00000156, 0x00000155, 0x00040020, 0x00000157, 0x0000000c, 0x00000156, 0x0004003b, 0x00000157,
-    0x00000158, 0x0000000c, 0x0004002b, 0x0000001e, 0x0000015e, 0x0000000a, 0x0004002b, 0x00000008,
-    0x00000164, 0x3f000030, 0x0004002b, 0x00000008, 0x00000166, 0x00000030, 0x0004002b, 0x00000008,
-    0x0000016d, 0x00004000, 0x0003001d, 0x00000171, 0x00000008, 0x0003001e, 0x00000172, 0x00000171,
-    0x00040020, 0x00000173, 0x0000000c, 0x00000172, 0x0004003b, 0x00000173, 0x00000174, 0x0000000c,
-    0x0003001d, 0x00000179, 0x00000008, 0x0003001e, 0x0000017a, 0x00000179, 0x00040020, 0x0000017b,
-    0x0000000c, 0x0000017a, 0x0004003b, 0x0000017b, 0x0000017c, 0x0000000c, 0x0003002a, 0x00000006,
-    0x0000018c, 0x00030029, 0x00000006, 0x0000019a, 0x0004002b, 0x00000008, 0x0000019c, 0x00000002,
-    0x0004002b, 0x00000008, 0x000001a1, 0xfffffffc, 0x0004002b, 0x00000008, 0x000001be, 0x0000000f,
-    0x0004002b, 0x00000008, 0x000001da, 0x3f008000, 0x0004002b, 0x00000008, 0x00000220, 0x80000000,
-    0x0004003b, 0x000000d8, 0x0000029b, 0x00000001, 0x00060034, 0x00000008, 0x000002a0, 0x00000080,
-    0x00000109, 0x00000067, 0x0004003b, 0x000000d8, 0x000002b3, 0x00000001, 0x0004002b, 0x00000008,
-    0x000002bd, 0xffffffff, 0x0005002c, 0x00000020, 0x000002be, 0x000002bd, 0x000002bd, 0x0004002b,
-    0x0000001e, 0x000002c0, 0x00000100, 0x00060034, 0x00000006, 0x000002c1, 0x000000aa, 0x00000108,
-    0x000002c0, 0x0003001d, 0x000002d1, 0x00000008, 0x0003001e, 0x000002d2, 0x000002d1, 0x00040020,
-    0x000002d3, 0x0000000c, 0x000002d2, 0x0004003b, 0x000002d3, 0x000002d4, 0x0000000c, 0x00060034,
-    0x0000001e, 0x000002dd, 0x00000084, 0x00000108, 0x0000010a, 0x00060034, 0x00000008, 0x000002de,
-    0x00000080, 0x000002dd, 0x00000067, 0x00060034, 0x0000001e, 0x000002e4, 0x00000084, 0x00000108,
-    0x0000010a, 0x00060034, 0x0000001e, 0x000002e5, 0x00000084, 0x000002e4, 0x0000010d, 0x00060034,
-    0x00000008, 0x000002e6, 0x00000080, 0x000002e5, 0x00000067, 0x00060034, 0x00000008, 0x000002e7,
-    0x00000080, 0x00000067, 0x000002e6, 0x00060034, 0x00000008, 0x000002f0, 0x00000080, 0x000002dd,
-    0x00000067, 0x00060034, 0x0000001e, 0x000002f6, 0x00000084, 0x00000108, 0x0000010a, 0x00060034,
-    0x0000001e, 0x000002f7, 0x00000084, 0x000002f6, 0x0000010d, 0x00060034, 0x00000008, 0x000002f8,
-    0x00000080, 0x000002f7, 0x00000067, 0x00060034, 0x00000008, 0x000002f9, 0x00000080, 0x000002e7,
-    0x000002f8, 0x00060034, 0x00000008, 0x00000302, 0x00000080, 0x000002dd, 0x00000067, 0x0003001d,
-    0x0000030a, 0x00000008, 0x0003001e, 0x0000030b, 0x0000030a, 0x00040020, 0x0000030c, 0x0000000c,
-    0x0000030b, 0x0004003b, 0x0000030c, 0x0000030d, 0x0000000c, 0x0003001d, 0x00000317, 0x00000008,
-    0x0003001e, 0x00000318, 0x00000317, 0x00040020, 0x00000319, 0x0000000c, 0x00000318, 0x0004003b,
-    0x00000319, 0x0000031a, 0x0000000c, 0x0004002b, 0x00000008, 0x0000031f, 0x00000003, 0x0004002b,
-    0x00000008, 0x00000322, 0x00000004, 0x0004002b, 0x0000001e, 0x0000032c, 0x00000007, 0x00040020,
-    0x00000330, 0x00000007, 0x000000aa, 0x0004002b, 0x000000aa, 0x00000332, 0x3f800000, 0x00040020,
-    0x00000335, 0x00000007, 0x000000ab, 0x0004002b, 0x0000001e, 0x0000033c, 0x0000000b, 0x00040020,
-    0x0000033d, 0x00000002, 0x000000ab, 0x00090019, 0x00000341, 0x00000008, 0x00000001, 0x00000000,
-    0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x0003001b, 0x00000342, 0x00000341, 0x00040020,
-    0x00000343, 0x00000000, 0x00000342, 0x0004003b, 0x00000343, 0x00000344, 0x00000000, 0x0004002b,
-    0x000000aa, 0x00000347, 0x00000000, 0x0004003b, 0x00000343, 0x0000034b, 0x00000000, 0x0004002b,
-    0x0000001e, 0x00000356, 0x00000009, 0x0004002b, 0x00000008, 0x0000035b, 0x00ffffff, 0x0004002b,
-    0x0000001e, 0x00000364, 0x00000006, 0x00060034, 0x00000008, 0x000003ad, 0x00000080, 0x000002dd,
-    0x00000067, 0x00060034, 0x00000008, 0x000003bb, 0x00000080, 0x000002dd, 0x00000067, 0x00060034,
-    0x00000008, 0x000003c9, 0x00000080, 0x000002dd, 0x00000067, 0x00040032, 0x0000001e, 0x000003e0,
-    0x00003000, 0x0004002b, 0x0000001e, 0x000003e1, 0x000000c0, 0x0004002b, 0x0000001e, 0x000003e2,
-    0x00000800, 0x0006002c, 0x000000d7, 0x000003e3, 0x000000bd, 0x000000bd, 0x000000a1, 0x00050036,
-    0x00000002, 0x00000004, 0x00000000, 0x00000003, 0x000200f8, 0x00000005, 0x0004003b, 0x0000001f,
-    0x0000029a, 0x00000007, 0x0004003b, 0x00000009, 0x000002a4, 0x00000007, 0x0004003b, 0x00000009,
-    0x000002ab, 0x00000007, 0x0004003b, 0x0000001f, 0x000002b2, 0x00000007, 0x0004003b, 0x00000021,
-    0x000002bc, 0x00000007, 0x0004003b, 0x00000007, 0x000002bf, 0x00000007, 0x0004003b, 0x00000009,
-    0x000002c9, 0x00000007, 0x0004003b, 0x00000007, 0x000002ca, 0x00000007, 0x0004003b, 0x00000021,
-    0x000002d0, 0x00000007, 0x0004003b, 0x00000021, 0x000002e3, 0x00000007, 0x0004003b, 0x00000021,
-    0x000002f5, 0x00000007, 0x0004003b, 0x00000009, 0x00000316, 0x00000007, 0x0004003b, 0x00000330,
-    0x00000331, 0x00000007, 0x0004003b, 0x00000335, 0x00000336, 0x00000007, 0x0004003b, 0x0000001f,
-    0x00000370, 0x00000007, 0x0004003b, 0x00000009, 0x00000372, 0x00000007, 0x0004003b, 0x00000009,
-    0x00000374, 0x00000007, 0x0004003b, 0x00000021, 0x00000375, 0x00000007, 0x0004003b, 0x00000021,
-    0x00000377, 0x00000007, 0x0004003b, 0x00000021, 0x00000379, 0x00000007, 0x0004003b, 0x00000021,
-    0x0000037b, 0x00000007, 0x0004003b, 0x00000007, 0x0000037d, 0x00000007, 0x0004003b, 0x00000009,
-    0x0000037f, 0x00000007, 0x0004003b, 0x00000007, 0x00000381, 0x00000007, 0x0004003b, 0x0000001f,
-    0x0000038a, 0x00000007, 0x0004003b, 0x00000009, 0x0000038c, 0x00000007, 0x0004003b, 0x00000009,
-    0x0000038e, 0x00000007, 0x0004003b, 0x00000021, 0x0000038f, 0x00000007, 0x0004003b, 0x00000021,
-    0x00000391, 0x00000007, 0x0004003b, 0x00000021, 0x00000393, 0x00000007, 0x0004003b, 0x00000021,
-    0x00000395, 0x00000007, 0x0004003b, 0x00000007, 0x00000397, 0x00000007, 0x0004003b, 0x00000009,
-    0x00000399, 0x00000007, 0x0004003b, 0x00000007, 0x0000039b, 0x00000007, 0x00050041, 0x000000da,
-    0x0000029c, 0x0000029b, 0x00000067, 0x0004003d, 0x00000008, 0x0000029d, 0x0000029c, 0x00050041,
-    0x000000da, 0x0000029e, 0x0000029b, 0x000000a1, 0x0004003d, 0x00000008, 0x0000029f, 0x0000029e,
-    0x00050084, 0x00000008, 0x000002a1, 0x0000029f, 0x000002a0, 0x00050080, 0x00000008, 0x000002a2,
-    0x0000029d, 0x000002a1, 0x0004007c, 0x0000001e, 0x000002a3, 0x000002a2, 0x0003003e, 0x0000029a,
-    0x000002a3, 0x0004003d, 0x0000001e, 0x000002a5, 0x0000029a, 0x00050084, 0x0000001e, 0x000002a6,
-    0x000002a5, 0x0000010d, 0x00050080, 0x0000001e, 0x000002a7, 0x00000107, 0x000002a6, 0x00050080,
-    0x0000001e, 0x000002a8, 0x000002a7, 0x00000107, 0x00060041, 0x00000113, 0x000002a9, 0x00000105,
-    0x00000106, 0x000002a8, 0x0004003d, 0x00000008, 0x000002aa, 0x000002a9, 0x0003003e, 0x000002a4,
-    0x000002aa, 0x0004003d, 0x0000001e, 0x000002ac, 0x0000029a, 0x00050084, 0x0000001e, 0x000002ad,
-    0x000002ac, 0x0000010d, 0x00050080, 0x0000001e, 0x000002ae, 0x00000107, 0x000002ad, 0x00050080,
-    0x0000001e, 0x000002af, 0x000002ae, 0x0000013f, 0x00060041, 0x00000113, 0x000002b0, 0x00000105,
-    0x00000106, 0x000002af, 0x0004003d, 0x00000008, 0x000002b1, 0x000002b0, 0x0003003e, 0x000002ab,
-    0x000002b1, 0x00050041, 0x000000da, 0x000002b4, 0x000002b3, 0x00000067, 0x0004003d, 0x00000008,
-    0x000002b5, 0x000002b4, 0x0004007c, 0x0000001e, 0x000002b6, 0x000002b5, 0x00050041, 0x000000da,
-    0x000002b7, 0x000002b3, 0x000000a1, 0x0004003d, 0x00000008, 0x000002b8, 0x000002b7, 0x0004007c,
-    0x0000001e, 0x000002b9, 0x000002b8, 0x00050084, 0x0000001e, 0x000002ba, 0x000002b9, 0x00000108,
-    0x00050080, 0x0000001e, 0x000002bb, 0x000002b6, 0x000002ba, 0x0003003e, 0x000002b2, 0x000002bb,
-    0x0003003e, 0x000002bc, 0x000002be, 0x000300f7, 0x000002c3, 0x00000000, 0x000400fa, 0x000002c1,
-    0x000002c2, 0x000002c3, 0x000200f8, 0x000002c2, 0x00050041, 0x000000b0, 0x000002c4, 0x000000ae,
-    0x000000af, 0x0004003d, 0x00000008, 0x000002c5, 0x000002c4, 0x000500c7, 0x00000008, 0x000002c6,
-    0x000002c5, 0x00000040, 0x000500ab, 0x00000006, 0x000002c7, 0x000002c6, 0x00000067, 0x000200f9,
-    0x000002c3, 0x000200f8, 0x000002c3, 0x000700f5, 0x00000006, 0x000002c8, 0x000002c1, 0x00000005,
-    0x000002c7, 0x000002c2, 0x0003003e, 0x000002bf, 0x000002c8, 0x0003003e, 0x000002c9, 0x00000067,
-    0x0003003e, 0x000002ca, 0x0000018c, 0x00050041, 0x00000145, 0x000002cb, 0x00000144, 0x0000010d,
-    0x0004003d, 0x00000008, 0x000002cc, 0x000002cb, 0x000500ab, 0x00000006, 0x000002cd, 0x000002cc,
-    0x00000067, 0x000300f7, 0x000002cf, 0x00000000, 0x000400fa, 0x000002cd, 0x000002ce, 0x00000325,
-    0x000200f8, 0x000002ce, 0x0004003d, 0x0000001e, 0x000002d5, 0x000002b2, 0x0004007c, 0x00000008,
-    0x000002d6, 0x000002d5, 0x00050080, 0x00000008, 0x000002d7, 0x00000067, 0x000002d6, 0x00060041,
-    0x00000113, 0x000002d8, 0x000002d4, 0x00000107, 0x000002d7, 0x0004003d, 0x00000008, 0x000002d9,
-    0x000002d8, 0x0004003d, 0x0000001e, 0x000002da, 0x000002b2, 0x0004007c, 0x00000008, 0x000002db,
-    0x000002da, 0x00050080, 0x00000008, 0x000002dc, 0x00000067, 0x000002db, 0x00050080, 0x00000008,
-    0x000002df, 0x000002dc, 0x000002de, 0x00060041, 0x00000113, 0x000002e0, 0x000002d4, 0x00000107,
-    0x000002df, 0x0004003d, 0x00000008, 0x000002e1, 0x000002e0, 0x00050050, 0x00000020, 0x000002e2,
-    0x000002d9, 0x000002e1, 0x0003003e, 0x000002d0, 0x000002e2, 0x0004003d, 0x0000001e, 0x000002e8,
-    0x000002b2, 0x0004007c, 0x00000008, 0x000002e9, 0x000002e8, 0x00050080, 0x00000008, 0x000002ea,
-    0x000002e7, 0x000002e9, 0x00060041, 0x00000113, 0x000002eb, 0x000002d4, 0x00000107, 0x000002ea,
-    0x0004003d, 0x00000008, 0x000002ec, 0x000002eb, 0x0004003d, 0x0000001e, 0x000002ed, 0x000002b2,
-    0x0004007c, 0x00000008, 0x000002ee, 0x000002ed, 0x00050080, 0x00000008, 0x000002ef, 0x000002e7,
-    0x000002ee, 0x00050080, 0x00000008, 0x000002f1, 0x000002ef, 0x000002f0, 0x00060041, 0x00000113,
-    0x000002f2, 0x000002d4, 0x00000107, 0x000002f1, 0x0004003d, 0x00000008, 0x000002f3, 0x000002f2,
-    0x00050050, 0x00000020, 0x000002f4, 0x000002ec, 0x000002f3, 0x0003003e, 0x000002e3, 0x000002f4,
-    0x0004003d, 0x0000001e, 0x000002fa, 0x000002b2, 0x0004007c, 0x00000008, 0x000002fb, 0x000002fa,
-    0x00050080, 0x00000008, 0x000002fc, 0x000002f9, 0x000002fb, 0x00060041, 0x00000113, 0x000002fd,
-    0x000002d4, 0x00000107, 0x000002fc, 0x0004003d, 0x00000008, 0x000002fe, 0x000002fd, 0x0004003d,
-    0x0000001e, 0x000002ff, 0x000002b2, 0x0004007c, 0x00000008, 0x00000300, 0x000002ff, 0x00050080,
-    0x00000008, 0x00000301, 0x000002f9, 0x00000300, 0x00050080, 0x00000008, 0x00000303, 0x00000301,
-    0x00000302, 0x00060041, 0x00000113, 0x00000304, 0x000002d4, 0x00000107, 0x00000303, 0x0004003d,
-    0x00000008, 0x00000305, 0x00000304, 0x00050050, 0x00000020, 0x00000306, 0x000002fe, 0x00000305,
-    0x0003003e, 0x000002f5, 0x00000306, 0x0004003d, 0x00000006, 0x00000307, 0x000002bf, 0x000300f7,
-    0x00000309, 0x00000000, 0x000400fa, 0x00000307, 0x00000308, 0x00000309, 0x000200f8, 0x00000308,
-    0x0004003d, 0x0000001e, 0x0000030e, 0x000002b2, 0x00060041, 0x00000113, 0x0000030f, 0x0000030d,
-    0x00000107, 0x0000030e, 0x0004003d, 0x00000008, 0x00000310, 0x0000030f, 0x0004003d, 0x0000001e,
-    0x00000311, 0x000002b2, 0x00050080, 0x0000001e, 0x00000312, 0x00000311, 0x000002dd, 0x00060041,
-    0x00000113, 0x00000313, 0x0000030d, 0x00000107, 0x00000312, 0x0004003d, 0x00000008, 0x00000314,
-    0x00000313, 0x00050050, 0x00000020, 0x00000315, 0x00000310, 0x00000314, 0x0003003e, 0x000002bc,
-    0x00000315, 0x000200f9, 0x00000309, 0x000200f8, 0x00000309, 0x0004003d, 0x0000001e, 0x0000031b,
-    0x000002b2, 0x00060041, 0x00000113, 0x0000031c, 0x0000031a, 0x00000107, 0x0000031b, 0x0004003d,
-    0x00000008, 0x0000031d, 0x0000031c, 0x0003003e, 0x00000316, 0x0000031d, 0x0004003d, 0x00000008,
-    0x0000031e, 0x00000316, 0x000500c7, 0x00000008, 0x00000320, 0x0000031e, 0x0000031f, 0x0003003e,
-    0x000002c9, 0x00000320, 0x0004003d, 0x00000008, 0x00000321, 0x00000316, 0x000500c7, 0x00000008,
-    0x00000323, 0x00000321, 0x00000322, 0x000500ab, 0x00000006, 0x00000324, 0x00000323, 0x00000067,
-    0x0003003e, 0x000002ca, 0x00000324, 0x000200f9, 0x000002cf, 0x000200f8, 0x00000325, 0x00050041,
-    0x000000b0, 0x00000326, 0x000000ae, 0x000000af, 0x0004003d, 0x00000008, 0x00000327, 0x00000326,
-    0x000500c7, 0x00000008, 0x00000328, 0x00000327, 0x0000016d, 0x000500ab, 0x00000006, 0x00000329,
-    0x00000328, 0x00000067, 0x000300f7, 0x0000032b, 0x00000000, 0x000400fa, 0x00000329, 0x0000032a,
-    0x00000360, 0x000200f8, 0x0000032a, 0x00050041, 0x000000b0, 0x0000032d, 0x000000ae, 0x0000032c,
-    0x0004003d, 0x00000008, 0x0000032e, 0x0000032d, 0x00050050, 0x00000020, 0x0000032f, 0x0000032e,
-    0x00000067, 0x0003003e, 0x000002f5, 0x0000032f, 0x0004006f, 0x000000aa, 0x00000333, 0x00000108,
-    0x00050088, 0x000000aa, 0x00000334, 0x00000332, 0x00000333, 0x0003003e, 0x00000331, 0x00000334,
-    0x0004003d, 0x000000d7, 0x00000337, 0x000002b3, 0x0007004f, 0x00000020, 0x00000338, 0x00000337,
-    0x00000337, 0x00000000, 0x00000001, 0x00040070, 0x000000ab, 0x00000339, 0x00000338, 0x0004003d,
-    0x000000aa, 0x0000033a, 0x00000331, 0x0005008e, 0x000000ab, 0x0000033b, 0x00000339, 0x0000033a,
-    0x00050041, 0x0000033d, 0x0000033e, 0x000000ae, 0x0000033c, 0x0004003d, 0x000000ab, 0x0000033f,
-    0x0000033e, 0x00050081, 0x000000ab, 0x00000340, 0x0000033b, 0x0000033f, 0x0003003e, 0x00000336,
-    0x00000340, 0x0004003d, 0x00000342, 0x00000345, 0x00000344, 0x0004003d, 0x000000ab, 0x00000346,
-    0x00000336, 0x00070058, 0x000000a7, 0x00000348, 0x00000345, 0x00000346, 0x00000002, 0x00000347,
-    0x00050051, 0x00000008, 0x00000349, 0x00000348, 0x00000000, 0x00050050, 0x00000020, 0x0000034a,
-    0x00000349, 0x00000067, 0x0003003e, 0x000002d0, 0x0000034a, 0x0004003d, 0x00000342, 0x0000034c,
-    0x0000034b, 0x0004003d, 0x000000ab, 0x0000034d, 0x00000336, 0x00070058, 0x000000a7, 0x0000034e,
-    0x0000034c, 0x0000034d, 0x00000002, 0x00000347, 0x00050051, 0x00000008, 0x0000034f, 0x0000034e,
-    0x00000000, 0x00050050, 0x00000020, 0x00000350, 0x0000034f, 0x00000067, 0x0003003e, 0x000002e3,
-    0x00000350, 0x00050041, 0x00000009, 0x00000351, 0x000002f5, 0x00000067, 0x0004003d, 0x00000008,
-    0x00000352, 0x00000351, 0x000500c7, 0x00000008, 0x00000353, 0x00000352, 0x00000087, 0x00050041,
-    0x00000009, 0x00000354, 0x000002e3, 0x00000067, 0x0004003d, 0x00000008, 0x00000355, 0x00000354,
-    0x000500c2, 0x00000008, 0x00000357, 0x00000355, 0x00000356, 0x000500c7, 0x00000008, 0x00000358,
-    0x00000357, 0x00000082, 0x000500c5, 0x00000008, 0x00000359, 0x00000353, 0x00000358, 0x00050041,
-    0x00000009, 0x0000035a, 0x000002f5, 0x00000067, 0x0003003e, 0x0000035a, 0x00000359, 0x00050041,
-    0x00000009, 0x0000035c, 0x000002e3, 0x00000067, 0x0004003d, 0x00000008, 0x0000035d, 0x0000035c,
-    0x000500c7, 0x00000008, 0x0000035e, 0x0000035d, 0x0000035b, 0x00050041, 0x00000009, 0x0000035f,
-    0x000002e3, 0x00000067, 0x0003003e, 0x0000035f, 0x0000035e, 0x000200f9, 0x0000032b, 0x000200f8,
-    0x00000360, 0x00050041, 0x000000b0, 0x00000361, 0x000000ae, 0x000000c2, 0x0004003d, 0x00000008,
-    0x00000362, 0x00000361, 0x00050050, 0x00000020, 0x00000363, 0x00000362, 0x00000067, 0x0003003e,
-    0x000002d0, 0x00000363, 0x00050041, 0x000000b0, 0x00000365, 0x000000ae, 0x00000364, 0x0004003d,
-    0x00000008, 0x00000366, 0x00000365, 0x00050050, 0x00000020, 0x00000367, 0x00000366, 0x00000067,
-    0x0003003e, 0x000002e3, 0x00000367, 0x00050041, 0x000000b0, 0x00000368, 0x000000ae, 0x0000032c,
-    0x0004003d, 0x00000008, 0x00000369, 0x00000368, 0x00050050, 0x00000020, 0x0000036a, 0x00000369,
-    0x00000067, 0x0003003e, 0x000002f5, 0x0000036a, 0x000200f9, 0x0000032b, 0x000200f8, 0x0000032b,
-    0x000200f9, 0x000002cf, 0x000200f8, 0x000002cf, 0x00050041, 0x00000145, 0x0000036b, 0x00000144,
-    0x0000010d, 0x0004003d, 0x00000008, 0x0000036c, 0x0000036b, 0x000500aa, 0x00000006, 0x0000036d,
-    0x0000036c, 0x00000067, 0x000300f7, 0x0000036f, 0x00000000, 0x000400fa, 0x0000036d, 0x0000036e,
-    0x0000036f, 0x000200f8, 0x0000036e, 0x0003003e, 0x000002c9, 0x00000067, 0x0003003e, 0x000002ca,
-    0x0000018c, 0x000200f9, 0x0000036f, 0x000200f8, 0x0000036f, 0x0004003d, 0x0000001e, 0x00000371,
-    0x0000029a, 0x0003003e, 0x00000370, 0x00000371, 0x0004003d, 0x00000008, 0x00000373, 0x000002a4,
-    0x0003003e, 0x00000372, 0x00000373, 0x0003003e, 0x00000374, 0x00000067, 0x0004003d, 0x00000020,
-    0x00000376, 0x000002d0, 0x0003003e, 0x00000375, 0x00000376, 0x0004003d, 0x00000020, 0x00000378,
-    0x000002e3, 0x0003003e, 0x00000377, 0x00000378, 0x0004003d, 0x00000020, 0x0000037a, 0x000002f5,
-    0x0003003e, 0x00000379, 0x0000037a, 0x0004003d, 0x00000020, 0x0000037c, 0x000002bc, 0x0003003e,
-    0x0000037b, 0x0000037c, 0x0004003d, 0x00000006, 0x0000037e, 0x000002bf, 0x0003003e, 0x0000037d,
-    0x0000037e, 0x0004003d, 0x00000008, 0x00000380, 0x000002c9, 0x0003003e, 0x0000037f, 0x00000380,
-    0x0004003d, 0x00000006, 0x00000382, 0x000002ca, 0x0003003e, 0x00000381, 0x00000382, 0x000e0039,
-    0x00000002, 0x00000383, 0x0000002d, 0x00000370, 0x00000372, 0x00000374, 0x00000375, 0x00000377,
-    0x00000379, 0x0000037b, 0x0000037d, 0x0000037f, 0x00000381, 0x0004003d, 0x00000020, 0x00000384,
-    0x00000375, 0x0003003e, 0x000002d0, 0x00000384, 0x0004003d, 0x00000020, 0x00000385, 0x00000377,
-    0x0003003e, 0x000002e3, 0x00000385, 0x0004003d, 0x00000020, 0x00000386, 0x00000379, 0x0003003e,
-    0x000002f5, 0x00000386, 0x0004003d, 0x00000020, 0x00000387, 0x0000037b, 0x0003003e, 0x000002bc,
-    0x00000387, 0x0004003d, 0x00000008, 0x00000388, 0x0000037f, 0x0003003e, 0x000002c9, 0x00000388,
-    0x0004003d, 0x00000006, 0x00000389, 0x00000381, 0x0003003e, 0x000002ca, 0x00000389, 0x0004003d,
-    0x0000001e, 0x0000038b, 0x0000029a, 0x0003003e, 0x0000038a, 0x0000038b, 0x0004003d, 0x00000008,
-    0x0000038d, 0x000002ab, 0x0003003e, 0x0000038c, 0x0000038d, 0x0003003e, 0x0000038e, 0x000000bd,
-    0x0004003d, 0x00000020, 0x00000390, 0x000002d0, 0x0003003e, 0x0000038f, 0x00000390, 0x0004003d,
-    0x00000020, 0x00000392, 0x000002e3, 0x0003003e, 0x00000391, 0x00000392, 0x0004003d, 0x00000020,
-    0x00000394, 0x000002f5, 0x0003003e, 0x00000393, 0x00000394, 0x0004003d, 0x00000020, 0x00000396,
-    0x000002bc, 0x0003003e, 0x00000395, 0x00000396, 0x0004003d, 0x00000006, 0x00000398, 0x000002bf,
-    0x0003003e, 0x00000397, 0x00000398, 0x0004003d, 0x00000008, 0x0000039a, 0x000002c9, 0x0003003e,
-    0x00000399, 0x0000039a, 0x0004003d, 0x00000006, 0x0000039c, 0x000002ca, 0x0003003e, 0x0000039b,
-    0x0000039c, 0x000e0039, 0x00000002, 0x0000039d, 0x0000002d, 0x0000038a, 0x0000038c, 0x0000038e,
-    0x0000038f, 0x00000391, 0x00000393, 0x00000395, 0x00000397, 0x00000399, 0x0000039b, 0x0004003d,
-    0x00000020, 0x0000039e, 0x0000038f, 0x0003003e, 0x000002d0, 0x0000039e, 0x0004003d, 0x00000020,
-    0x0000039f, 0x00000391, 0x0003003e, 0x000002e3, 0x0000039f, 0x0004003d, 0x00000020, 0x000003a0,
-    0x00000393, 0x0003003e, 0x000002f5, 0x000003a0, 0x0004003d, 0x00000020, 0x000003a1, 0x00000395,
-    0x0003003e, 0x000002bc, 0x000003a1, 0x0004003d, 0x00000008, 0x000003a2, 0x00000399, 0x0003003e,
-    0x000002c9, 0x000003a2, 0x0004003d, 0x00000006, 0x000003a3, 0x0000039b, 0x0003003e, 0x000002ca,
-    0x000003a3, 0x0004003d, 0x0000001e, 0x000003a4, 0x000002b2, 0x0004007c, 0x00000008, 0x000003a5,
-    0x000003a4, 0x00050080, 0x00000008, 0x000003a6, 0x00000067, 0x000003a5, 0x00050041, 0x00000009,
-    0x000003a7, 0x000002d0, 0x00000067, 0x0004003d, 0x00000008, 0x000003a8, 0x000003a7, 0x00060041,
-    0x00000113, 0x000003a9, 0x000002d4, 0x00000107, 0x000003a6, 0x0003003e, 0x000003a9, 0x000003a8,
-    0x0004003d, 0x0000001e, 0x000003aa, 0x000002b2, 0x0004007c, 0x00000008, 0x000003ab, 0x000003aa,
-    0x00050080, 0x00000008, 0x000003ac, 0x00000067, 0x000003ab, 0x00050080, 0x00000008, 0x000003ae,
-    0x000003ac, 0x000003ad, 0x00050041, 0x00000009, 0x000003af, 0x000002d0, 0x000000a1, 0x0004003d,
-    0x00000008, 0x000003b0, 0x000003af, 0x00060041, 0x00000113, 0x000003b1, 0x000002d4, 0x00000107,
-    0x000003ae, 0x0003003e, 0x000003b1, 0x000003b0, 0x0004003d, 0x0000001e, 0x000003b2, 0x000002b2,
-    0x0004007c, 0x00000008, 0x000003b3, 0x000003b2, 0x00050080, 0x00000008, 0x000003b4, 0x000002e7,
-    0x000003b3, 0x00050041, 0x00000009, 0x000003b5, 0x000002e3, 0x00000067, 0x0004003d, 0x00000008,
-    0x000003b6, 0x000003b5, 0x00060041, 0x00000113, 0x000003b7, 0x000002d4, 0x00000107, 0x000003b4,
-    0x0003003e, 0x000003b7, 0x000003b6, 0x0004003d, 0x0000001e, 0x000003b8, 0x000002b2, 0x0004007c,
-    0x00000008, 0x000003b9, 0x000003b8, 0x00050080, 0x00000008, 0x000003ba, 0x000002e7, 0x000003b9,
-    0x00050080, 0x00000008, 0x000003bc, 0x000003ba, 0x000003bb, 0x00050041, 0x00000009, 0x000003bd,
-    0x000002e3, 0x000000a1, 0x0004003d, 0x00000008, 0x000003be, 0x000003bd, 0x00060041, 0x00000113,
-    0x000003bf, 0x000002d4, 0x00000107, 0x000003bc, 0x0003003e, 0x000003bf, 0x000003be, 0x0004003d,
-    0x0000001e, 0x000003c0, 0x000002b2, 0x0004007c, 0x00000008, 0x000003c1, 0x000003c0, 0x00050080,
-    0x00000008, 0x000003c2, 0x000002f9, 0x000003c1, 0x00050041, 0x00000009, 0x000003c3, 0x000002f5,
-    0x00000067, 0x0004003d, 0x00000008, 0x000003c4, 0x000003c3, 0x00060041, 0x00000113, 0x000003c5,
-    0x000002d4, 0x00000107, 0x000003c2, 0x0003003e, 0x000003c5, 0x000003c4, 0x0004003d, 0x0000001e,
-    0x000003c6, 0x000002b2, 0x0004007c, 0x00000008, 0x000003c7, 0x000003c6, 0x00050080, 0x00000008,
-    0x000003c8, 0x000002f9, 0x000003c7, 0x00050080, 0x00000008, 0x000003ca, 0x000003c8, 0x000003c9,
-    0x00050041, 0x00000009, 0x000003cb, 0x000002f5, 0x000000a1, 0x0004003d, 0x00000008, 0x000003cc,
-    0x000003cb, 0x00060041, 0x00000113, 0x000003cd, 0x000002d4, 0x00000107, 0x000003ca, 0x0003003e,
-    0x000003cd, 0x000003cc, 0x0004003d, 0x00000006, 0x000003ce, 0x000002bf, 0x000300f7, 0x000003d0,
-    0x00000000, 0x000400fa, 0x000003ce, 0x000003cf, 0x000003d0, 0x000200f8, 0x000003cf, 0x0004003d,
-    0x0000001e, 0x000003d1, 0x000002b2, 0x00050041, 0x00000009, 0x000003d2, 0x000002bc, 0x00000067,
-    0x0004003d, 0x00000008, 0x000003d3, 0x000003d2, 0x00060041, 0x00000113, 0x000003d4, 0x0000030d,
-    0x00000107, 0x000003d1, 0x0003003e, 0x000003d4, 0x000003d3, 0x0004003d, 0x0000001e, 0x000003d5,
-    0x000002b2, 0x00050080, 0x0000001e, 0x000003d6, 0x000003d5, 0x000002dd, 0x00050041, 0x00000009,
-    0x000003d7, 0x000002bc, 0x000000a1, 0x0004003d, 0x00000008, 0x000003d8, 0x000003d7, 0x00060041,
-    0x00000113, 0x000003d9, 0x0000030d, 0x00000107, 0x000003d6, 0x0003003e, 0x000003d9, 0x000003d8,
-    0x000200f9, 0x000003d0, 0x000200f8, 0x000003d0, 0x0004003d, 0x0000001e, 0x000003da, 0x000002b2,
-    0x0004003d, 0x00000008, 0x000003db, 0x000002c9, 0x0004003d, 0x00000006, 0x000003dc, 0x000002ca,
-    0x000600a9, 0x00000008, 0x000003dd, 0x000003dc, 0x00000322, 0x00000067, 0x000500c5, 0x00000008,
-    0x000003de, 0x000003db, 0x000003dd, 0x00060041, 0x00000113, 0x000003df, 0x0000031a, 0x00000107,
-    0x000003da, 0x0003003e, 0x000003df, 0x000003de, 0x000100fd, 0x00010038, 0x00050036, 0x00000006,
-    0x00000010, 0x00000000, 0x0000000a, 0x00030037, 0x00000007, 0x0000000b, 0x00030037, 0x00000007,
-    0x0000000c, 0x00030037, 0x00000009, 0x0000000d, 0x00030037, 0x00000009, 0x0000000e, 0x00030037,
-    0x00000009, 0x0000000f, 0x000200f8, 0x00000011, 0x0004003b, 0x00000007, 0x00000043, 0x00000007,
-    0x0004003d, 0x00000006, 0x0000002f, 0x0000000b, 0x000300f7, 0x00000031, 0x00000000, 0x000400fa,
-    0x0000002f, 0x00000030, 0x00000031, 0x000200f8, 0x00000030, 0x0004003d, 0x00000008, 0x00000032,
-    0x0000000d, 0x0004003d, 0x00000008, 0x00000033, 0x0000000e, 0x00050082, 0x00000008, 0x00000034,
-    0x00000032, 0x00000033, 0x00050080, 0x00000008, 0x00000036, 0x00000034, 0x00000035, 0x000500b2,
-    0x00000006, 0x00000038, 0x00000036, 0x00000037, 0x000200fe, 0x00000038, 0x000200f8, 0x00000031,
-    0x0004003d, 0x00000006, 0x0000003a, 0x0000000c, 0x000300f7, 0x0000003c, 0x00000000, 0x000400fa,
-    0x0000003a, 0x0000003b, 0x0000003c, 0x000200f8, 0x0000003b, 0x0004003d, 0x00000008, 0x0000003d,
-    0x0000000f, 0x000500c7, 0x00000008, 0x0000003f, 0x0000003d, 0x0000003e, 0x000500aa, 0x00000006,
-    0x00000041, 0x0000003f, 0x00000040, 0x000200f9, 0x0000003c, 0x000200f8, 0x0000003c, 0x000700f5,
-    0x00000006, 0x00000042, 0x0000003a, 0x00000031, 0x00000041, 0x0000003b, 0x000300f7, 0x00000045,
-    0x00000000, 0x000400fa, 0x00000042, 0x00000044, 0x00000049, 0x000200f8, 0x00000044, 0x0004003d,
-    0x00000008, 0x00000046, 0x0000000e, 0x0004003d, 0x00000008, 0x00000047, 0x0000000d, 0x000500b2,
-    0x00000006, 0x00000048, 0x00000046, 0x00000047, 0x0003003e, 0x00000043, 0x00000048, 0x000200f9,
-    0x00000045, 0x000200f8, 0x00000049, 0x0004003d, 0x00000008, 0x0000004a, 0x0000000e, 0x0004003d,
-    0x00000008, 0x0000004b, 0x0000000d, 0x000500b0, 0x00000006, 0x0000004c, 0x0000004a, 0x0000004b,
-    0x0003003e, 0x00000043, 0x0000004c, 0x000200f9, 0x00000045, 0x000200f8, 0x00000045, 0x0004003d,
-    0x00000006, 0x0000004d, 0x00000043, 0x000200fe, 0x0000004d, 0x00010038, 0x00050036, 0x00000002,
-    0x0000001c, 0x00000000, 0x00000012, 0x00030037, 0x00000009, 0x00000013, 0x00030037, 0x00000009,
-    0x00000014, 0x00030037, 0x00000009, 0x00000015, 0x00030037, 0x00000007, 0x00000016, 0x00030037,
-    0x00000009, 0x00000017, 0x00030037, 0x00000009, 0x00000018, 0x00030037, 0x00000009, 0x00000019,
-    0x00030037, 0x00000009, 0x0000001a, 0x00030037, 0x00000007, 0x0000001b, 0x000200f8, 0x0000001d,
-    0x0004003b, 0x00000009, 0x00000050, 0x00000007, 0x0004003b, 0x00000007, 0x0000006a, 0x00000007,
-    0x0004003b, 0x00000009, 0x0000008b, 0x00000007, 0x0004003b, 0x00000009, 0x0000008f, 0x00000007,
-    0x0004003b, 0x00000009, 0x00000093, 0x00000007, 0x0004003b, 0x00000009, 0x00000096, 0x00000007,
-    0x0004003b, 0x00000009, 0x00000099, 0x00000007, 0x0004003b, 0x00000009, 0x0000009d, 0x00000007,
-    0x0004003d, 0x00000008, 0x00000051, 0x0000001a, 0x000500c7, 0x00000008, 0x00000053, 0x00000051,
-    0x00000052, 0x0004003d, 0x00000008, 0x00000054, 0x0000001a, 0x000500c2, 0x00000008, 0x00000056,
-    0x00000054, 0x00000055, 0x000500c7, 0x00000008, 0x00000058, 0x00000056, 0x00000057, 0x000500c5,
-    0x00000008, 0x00000059, 0x00000053, 0x00000058, 0x000500c5, 0x00000008, 0x0000005b, 0x00000059,
-    0x0000005a, 0x0004003d, 0x00000008, 0x0000005c, 0x00000015, 0x000500c7, 0x00000008, 0x0000005e,
-    0x0000005c, 0x0000005d, 0x000500c5, 0x00000008, 0x0000005f, 0x0000005b, 0x0000005e, 0x0003003e,
-    0x00000050, 0x0000005f, 0x0004003d, 0x00000006, 0x00000060, 0x00000016, 0x000400a8, 0x00000006,
-    0x00000061, 0x00000060, 0x000400a8, 0x00000006, 0x00000062, 0x00000061, 0x000300f7, 0x00000064,
-    0x00000000, 0x000400fa, 0x00000062, 0x00000063, 0x00000064, 0x000200f8, 0x00000063, 0x0004003d,
-    0x00000008, 0x00000065, 0x00000015, 0x000500c7, 0x00000008, 0x00000066, 0x00000065, 0x0000005a,
-    0x000500ab, 0x00000006, 0x00000068, 0x00000066, 0x00000067, 0x000200f9, 0x00000064, 0x000200f8,
-    0x00000064, 0x000700f5, 0x00000006, 0x00000069, 0x00000061, 0x0000001d, 0x00000068, 0x00000063,
-    0x000300f7, 0x0000006c, 0x00000000, 0x000400fa, 0x00000069, 0x0000006b, 0x00000073, 0x000200f8,
-    0x0000006b, 0x0004003d, 0x00000008, 0x0000006d, 0x00000015, 0x000500c7, 0x00000008, 0x0000006f,
-    0x0000006d, 0x0000006e, 0x0004003d, 0x00000008, 0x00000070, 0x00000050, 0x000500c7, 0x00000008,
-    0x00000071, 0x00000070, 0x0000006e, 0x000500ab, 0x00000006, 0x00000072, 0x0000006f, 0x00000071,
-    0x0003003e, 0x0000006a, 0x00000072, 0x000200f9, 0x0000006c, 0x000200f8, 0x00000073, 0x0004003d,
-    0x00000008, 0x00000074, 0x00000015, 0x000500c7, 0x00000008, 0x00000076, 0x00000074, 0x00000075,
-    0x0004003d, 0x00000008, 0x00000077, 0x0000001a, 0x000500c7, 0x00000008, 0x00000078, 0x00000077,
-    0x00000075, 0x000500ab, 0x00000006, 0x00000079, 0x00000076, 0x00000078, 0x0003003e, 0x0000006a,
-    0x00000079, 0x000200f9, 0x0000006c, 0x000200f8, 0x0000006c, 0x0004003d, 0x00000006, 0x0000007a,
-    0x0000006a, 0x000300f7, 0x0000007c, 0x00000000, 0x000400fa, 0x0000007a, 0x0000007b, 0x0000007c,
-    0x000200f8, 0x0000007b, 0x0004003d, 0x00000006, 0x0000007d, 0x0000001b, 0x000300f7, 0x0000007f,
-    0x00000000, 0x000400fa, 0x0000007d, 0x0000007e, 0x0000007f, 0x000200f8, 0x0000007e, 0x0004003d,
-    0x00000008, 0x00000080, 0x00000019, 0x0003003e, 0x00000014, 0x00000080, 0x000200f9, 0x0000007f,
-    0x000200f8, 0x0000007f, 0x0004003d, 0x00000008, 0x00000081, 0x00000015, 0x000500c7, 0x00000008,
-    0x00000083, 0x00000081, 0x00000082, 0x000500aa, 0x00000006, 0x00000084, 0x00000083, 0x00000067,
-    0x000300f7, 0x00000086, 0x00000000, 0x000400fa, 0x00000084, 0x00000085, 0x00000086, 0x000200f8,
-    0x00000085, 0x0004003d, 0x00000008, 0x00000088, 0x00000050, 0x000500c7, 0x00000008, 0x00000089,
-    0x00000088, 0x00000087, 0x0003003e, 0x00000050, 0x00000089, 0x000200f9, 0x00000086, 0x000200f8,
-    0x00000086, 0x0004003d, 0x00000008, 0x0000008a, 0x00000050, 0x0003003e, 0x00000015, 0x0000008a,
-    0x0004003d, 0x00000008, 0x0000008c, 0x00000017, 0x000500c7, 0x00000008, 0x0000008e, 0x0000008c,
-    0x0000008d, 0x0003003e, 0x0000008b, 0x0000008e, 0x0004003d, 0x00000008, 0x00000090, 0x00000017,
-    0x000500c7, 0x00000008, 0x00000092, 0x00000090, 0x00000091, 0x0003003e, 0x0000008f, 0x00000092,
-    0x0004003d, 0x00000008, 0x00000094, 0x00000013, 0x000500c7, 0x00000008, 0x00000095, 0x00000094,
-    0x0000008d, 0x0003003e, 0x00000093, 0x00000095, 0x0004003d, 0x00000008, 0x00000097, 0x00000013,
-    0x000500c7, 0x00000008, 0x00000098, 0x00000097, 0x00000091, 0x0003003e, 0x00000096, 0x00000098,
-    0x0004003d, 0x00000008, 0x0000009a, 0x00000013, 0x000500c7, 0x00000008, 0x0000009c, 0x0000009a,
-    0x0000009b, 0x0003003e, 0x00000099, 0x0000009c, 0x0004003d, 0x00000008, 0x0000009e, 0x00000018,
-    0x000500c2, 0x00000008, 0x000000a0, 0x0000009e, 0x0000009f, 0x00050080, 0x00000008, 0x000000a2,
-    0x000000a0, 0x000000a1, 0x0003003e, 0x0000009d, 0x000000a2, 0x0004003d, 0x00000008, 0x000000a3,
-    0x00000099, 0x000500ab, 0x00000006, 0x000000a4, 0x000000a3, 0x00000067, 0x000300f7, 0x000000a6,
-    0x00000000, 0x000400fa, 0x000000a4, 0x000000a5, 0x000000a6, 0x000200f8, 0x000000a5, 0x00050041,
-    0x000000b0, 0x000000b1, 0x000000ae, 0x000000af, 0x0004003d, 0x00000008, 0x000000b2, 0x000000b1,
-    0x000500c7, 0x00000008, 0x000000b4, 0x000000b2, 0x000000b3, 0x000500ab, 0x00000006, 0x000000b5,
-    0x000000b4, 0x00000067, 0x000200f9, 0x000000a6, 0x000200f8, 0x000000a6, 0x000700f5, 0x00000006,
-    0x000000b6, 0x000000a4, 0x00000086, 0x000000b5, 0x000000a5, 0x000300f7, 0x000000b8, 0x00000000,
-    0x000400fa, 0x000000b6, 0x000000b7, 0x000000b8, 0x000200f8, 0x000000b7, 0x0004003d, 0x00000008,
-    0x000000b9, 0x0000008b, 0x0004003d, 0x00000008, 0x000000ba, 0x0000009d, 0x00050084, 0x00000008,
-    0x000000bb, 0x000000b9, 0x000000ba, 0x0004003d, 0x00000008, 0x000000bc, 0x00000093, 0x0004003d,
-    0x00000008, 0x000000be, 0x0000009d, 0x00050082, 0x00000008, 0x000000bf, 0x000000bd, 0x000000be,
-    0x00050084, 0x00000008, 0x000000c0, 0x000000bc, 0x000000bf, 0x00050080, 0x00000008, 0x000000c1,
-    0x000000bb, 0x000000c0, 0x000500c2, 0x00000008, 0x000000c3, 0x000000c1, 0x000000c2, 0x0003003e,
-    0x0000008b, 0x000000c3, 0x0004003d, 0x00000008, 0x000000c4, 0x0000008f, 0x0004003d, 0x00000008,
-    0x000000c5, 0x0000009d, 0x00050084, 0x00000008, 0x000000c6, 0x000000c4, 0x000000c5, 0x0004003d,
-    0x00000008, 0x000000c7, 0x00000096, 0x0004003d, 0x00000008, 0x000000c8, 0x0000009d, 0x00050082,
-    0x00000008, 0x000000c9, 0x000000bd, 0x000000c8, 0x00050084, 0x00000008, 0x000000ca, 0x000000c7,
-    0x000000c9, 0x00050080, 0x00000008, 0x000000cb, 0x000000c6, 0x000000ca, 0x000500c2, 0x00000008,
-    0x000000cc, 0x000000cb, 0x000000c2, 0x0003003e, 0x0000008f, 0x000000cc, 0x000200f9, 0x000000b8,
-    0x000200f8, 0x000000b8, 0x0004003d, 0x00000008, 0x000000cd, 0x0000008b, 0x000500c7, 0x00000008,
-    0x000000ce, 0x000000cd, 0x0000008d, 0x0004003d, 0x00000008, 0x000000cf, 0x0000008f, 0x000500c7,
-    0x00000008, 0x000000d0, 0x000000cf, 0x00000091, 0x000500c5, 0x00000008, 0x000000d1, 0x000000ce,
-    0x000000d0, 0x0004003d, 0x00000008, 0x000000d2, 0x00000099, 0x0004003d, 0x00000008, 0x000000d3,
-    0x00000018, 0x0007000c, 0x00000008, 0x000000d4, 0x00000001, 0x00000029, 0x000000d2, 0x000000d3,
-    0x000500c5, 0x00000008, 0x000000d5, 0x000000d1, 0x000000d4, 0x0003003e, 0x00000013, 0x000000d5,
-    0x000200f9, 0x0000007c, 0x000200f8, 0x0000007c, 0x000100fd, 0x00010038, 0x00050036, 0x00000002,
-    0x0000002d, 0x00000000, 0x00000022, 0x00030037, 0x0000001f, 0x00000023, 0x00030037, 0x00000009,
-    0x00000024, 0x00030037, 0x00000009, 0x00000025, 0x00030037, 0x00000021, 0x00000026, 0x00030037,
-    0x00000021, 0x00000027, 0x00030037, 0x00000021, 0x00000028, 0x00030037, 0x00000021, 0x00000029,
-    0x00030037, 0x00000007, 0x0000002a, 0x00030037, 0x00000009, 0x0000002b, 0x00030037, 0x00000007,
-    0x0000002c, 0x000200f8, 0x0000002e, 0x0004003b, 0x0000001f, 0x000000d6, 0x00000007, 0x0004003b,
-    0x00000009, 0x000000eb, 0x00000007, 0x0004003b, 0x00000009, 0x000000f4, 0x00000007, 0x0004003b,
-    0x00000009, 0x000000fd, 0x00000007, 0x0004003b, 0x00000009, 0x00000116, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000126, 0x00000007, 0x0004003b, 0x00000009, 0x0000012f, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000136, 0x00000007, 0x0004003b, 0x00000009, 0x00000141, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000153, 0x00000007, 0x0004003b, 0x00000007, 0x0000015c, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000162, 0x00000007, 0x0004003b, 0x00000007, 0x00000168, 0x00000007, 0x0004003b,
-    0x00000007, 0x0000016b, 0x00000007, 0x0004003b, 0x00000009, 0x00000170, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000178, 0x00000007, 0x0004003b, 0x00000009, 0x00000180, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000187, 0x00000007, 0x0004003b, 0x00000007, 0x0000018b, 0x00000007, 0x0004003b,
-    0x00000009, 0x000001a4, 0x00000007, 0x0004003b, 0x00000009, 0x000001a6, 0x00000007, 0x0004003b,
-    0x00000007, 0x000001af, 0x00000007, 0x0004003b, 0x00000007, 0x000001b1, 0x00000007, 0x0004003b,
-    0x00000009, 0x000001b3, 0x00000007, 0x0004003b, 0x00000009, 0x000001b5, 0x00000007, 0x0004003b,
-    0x00000009, 0x000001b7, 0x00000007, 0x0004003b, 0x00000007, 0x000001c8, 0x00000007, 0x0004003b,
-    0x00000007, 0x000001ca, 0x00000007, 0x0004003b, 0x00000009, 0x000001cc, 0x00000007, 0x0004003b,
-    0x00000009, 0x000001cf, 0x00000007, 0x0004003b, 0x00000009, 0x000001d1, 0x00000007, 0x0004003b,
-    0x00000009, 0x000001d8, 0x00000007, 0x0004003b, 0x00000009, 0x000001e2, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000224, 0x00000007, 0x0004003b, 0x00000009, 0x0000022c, 0x00000007, 0x0004003b,
-    0x00000009, 0x0000022f, 0x00000007, 0x0004003b, 0x00000009, 0x00000232, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000235, 0x00000007, 0x0004003b, 0x00000009, 0x00000237, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000239, 0x00000007, 0x0004003b, 0x00000009, 0x0000023b, 0x00000007, 0x0004003b,
-    0x00000009, 0x0000023d, 0x00000007, 0x0004003b, 0x00000007, 0x0000023f, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000252, 0x00000007, 0x0004003b, 0x00000009, 0x00000255, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000258, 0x00000007, 0x0004003b, 0x00000007, 0x0000025b, 0x00000007, 0x0004003b,
-    0x00000009, 0x0000025d, 0x00000007, 0x0004003b, 0x00000009, 0x0000025f, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000261, 0x00000007, 0x0004003b, 0x00000009, 0x00000263, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000265, 0x00000007, 0x0004003b, 0x00000007, 0x00000273, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000275, 0x00000007, 0x0004003b, 0x00000009, 0x00000277, 0x00000007, 0x0004003b,
-    0x00000009, 0x0000027a, 0x00000007, 0x0004003b, 0x00000009, 0x0000027c, 0x00000007, 0x0004003b,
-    0x00000007, 0x00000288, 0x00000007, 0x0004003b, 0x00000007, 0x0000028a, 0x00000007, 0x0004003b,
-    0x00000009, 0x0000028c, 0x00000007, 0x0004003b, 0x00000009, 0x0000028f, 0x00000007, 0x0004003b,
-    0x00000009, 0x00000291, 0x00000007, 0x00050041, 0x000000da, 0x000000db, 0x000000d9, 0x00000067,
-    0x0004003d, 0x00000008, 0x000000dc, 0x000000db, 0x0004007c, 0x0000001e, 0x000000dd, 0x000000dc,
-    0x00050041, 0x000000da, 0x000000de, 0x000000d9, 0x000000a1, 0x0004003d, 0x00000008, 0x000000df,
-    0x000000de, 0x0004007c, 0x0000001e, 0x000000e0, 0x000000df, 0x00050084, 0x0000001e, 0x000000e2,
-    0x000000e0, 0x000000e1, 0x00050080, 0x0000001e, 0x000000e3, 0x000000dd, 0x000000e2, 0x0003003e,
-    0x000000d6, 0x000000e3, 0x000200f9, 0x000000e4, 0x000200f8, 0x000000e4, 0x000400f6, 0x000000e6,
-    0x000000e7, 0x00000000, 0x000200f9, 0x000000e8, 0x000200f8, 0x000000e8, 0x0004003d, 0x00000008,
-    0x000000e9, 0x00000024, 0x000500ab, 0x00000006, 0x000000ea, 0x000000e9, 0x00000067, 0x000400fa,
-    0x000000ea, 0x000000e5, 0x000000e6, 0x000200f8, 0x000000e5, 0x0004003d, 0x00000008, 0x000000ec,
-    0x00000024, 0x0006000c, 0x0000001e, 0x000000ed, 0x00000001, 0x00000049, 0x000000ec, 0x0004007c,
-    0x00000008, 0x000000ee, 0x000000ed, 0x0003003e, 0x000000eb, 0x000000ee, 0x0004003d, 0x00000008,
-    0x000000ef, 0x000000eb, 0x000500c4, 0x00000008, 0x000000f0, 0x000000a1, 0x000000ef, 0x000400c8,
-    0x00000008, 0x000000f1, 0x000000f0, 0x0004003d, 0x00000008, 0x000000f2, 0x00000024, 0x000500c7,
-    0x00000008, 0x000000f3, 0x000000f2, 0x000000f1, 0x0003003e, 0x00000024, 0x000000f3, 0x0004003d,
-    0x0000001e, 0x000000f5, 0x00000023, 0x00050084, 0x0000001e, 0x000000f7, 0x000000f5, 0x000000f6,
-    0x0004007c, 0x00000008, 0x000000f8, 0x000000f7, 0x0004003d, 0x00000008, 0x000000f9, 0x000000eb,
-    0x00050080, 0x00000008, 0x000000fa, 0x000000f8, 0x000000f9, 0x0004003d, 0x00000008, 0x000000fb,
-    0x00000025, 0x00050080, 0x00000008, 0x000000fc, 0x000000fa, 0x000000fb, 0x0003003e, 0x000000f4,
-    0x000000fc, 0x0004003d, 0x00000008, 0x00000111, 0x000000f4, 0x00050080, 0x00000008, 0x00000112,
-    0x00000110, 0x00000111, 0x00060041, 0x00000113, 0x00000114, 0x00000105, 0x00000106, 0x00000112,
-    0x0004003d, 0x00000008, 0x00000115, 0x00000114, 0x0003003e, 0x000000fd, 0x00000115, 0x0004003d,
-    0x00000008, 0x0000011b, 0x000000f4, 0x00050080, 0x00000008, 0x0000011c, 0x0000011a, 0x0000011b,
-    0x00060041, 0x00000113, 0x0000011d, 0x00000105, 0x00000106, 0x0000011c, 0x0004003d, 0x00000008,
-    0x0000011e, 0x0000011d, 0x0003003e, 0x00000116, 0x0000011e, 0x000200f9, 0x0000011f, 0x000200f8,
-    0x0000011f, 0x000400f6, 0x00000121, 0x00000122, 0x00000000, 0x000200f9, 0x00000123, 0x000200f8,
-    0x00000123, 0x0004003d, 0x00000008, 0x00000124, 0x000000fd, 0x000500ab, 0x00000006, 0x00000125,
-    0x00000124, 0x00000067, 0x000400fa, 0x00000125, 0x00000120, 0x00000121, 0x000200f8, 0x00000120,
-    0x0004003d, 0x00000008, 0x00000127, 0x000000fd, 0x0006000c, 0x0000001e, 0x00000128, 0x00000001,
-    0x00000049, 0x00000127, 0x0004007c, 0x00000008, 0x00000129, 0x00000128, 0x0003003e, 0x00000126,
-    0x00000129, 0x0004003d, 0x00000008, 0x0000012a, 0x00000126, 0x000500c4, 0x00000008, 0x0000012b,
-    0x000000a1, 0x0000012a, 0x000400c8, 0x00000008, 0x0000012c, 0x0000012b, 0x0004003d, 0x00000008,
-    0x0000012d, 0x000000fd, 0x000500c7, 0x00000008, 0x0000012e, 0x0000012d, 0x0000012c, 0x0003003e,
-    0x000000fd, 0x0000012e, 0x0004003d, 0x0000001e, 0x00000130, 0x000000d6, 0x0004007c, 0x00000008,
-    0x00000131, 0x00000130, 0x0004003d, 0x00000008, 0x00000132, 0x00000116, 0x00050084, 0x00000008,
-    0x00000133, 0x00000132, 0x000000bd, 0x00050084, 0x00000008, 0x00000134, 0x00000133, 0x000000bd,
-    0x00050080, 0x00000008, 0x00000135, 0x00000131, 0x00000134, 0x0003003e, 0x0000012f, 0x00000135,
-    0x0004003d, 0x00000008, 0x0000013b, 0x0000012f, 0x00060041, 0x00000113, 0x0000013c, 0x0000013a,
-    0x00000107, 0x0000013b, 0x0004003d, 0x00000008, 0x0000013d, 0x0000013c, 0x0003003e, 0x00000136,
-    0x0000013d, 0x0004003d, 0x00000008, 0x0000013e, 0x00000116, 0x00050080, 0x00000008, 0x00000140,
-    0x0000013e, 0x0000013f, 0x0003003e, 0x00000116, 0x00000140, 0x00050041, 0x00000145, 0x00000146,
-    0x00000144, 0x00000107, 0x0004003d, 0x00000008, 0x00000147, 0x00000146, 0x0004003d, 0x00000008,
-    0x00000148, 0x00000126, 0x00050080, 0x00000008, 0x00000149, 0x00000147, 0x00000148, 0x0004003d,
-    0x00000008, 0x0000014a, 0x000000eb, 0x0004003d, 0x00000008, 0x0000014b, 0x00000025, 0x00050080,
-    0x00000008, 0x0000014c, 0x0000014a, 0x0000014b, 0x00050084, 0x00000008, 0x0000014d, 0x0000014c,
-    0x000000bd, 0x00050080, 0x00000008, 0x0000014e, 0x00000149, 0x0000014d, 0x0003003e, 0x00000141,
-    0x0000014e, 0x0004003d, 0x00000008, 0x0000014f, 0x00000136, 0x000500ab, 0x00000006, 0x00000150,
-    0x0000014f, 0x00000067, 0x000300f7, 0x00000152, 0x00000000, 0x000400fa, 0x00000150, 0x00000151,
-    0x00000152, 0x000200f8, 0x00000151, 0x0004003d, 0x00000008, 0x00000159, 0x00000141, 0x00070041,
-    0x00000113, 0x0000015a, 0x00000158, 0x00000107, 0x00000159, 0x00000055, 0x0004003d, 0x00000008,
-    0x0000015b, 0x0000015a, 0x0003003e, 0x00000153, 0x0000015b, 0x0004003d, 0x00000008, 0x0000015d,
-    0x00000141, 0x00070041, 0x00000113, 0x0000015f, 0x00000158, 0x00000107, 0x0000015d, 0x0000015e,
-    0x0004003d, 0x00000008, 0x00000160, 0x0000015f, 0x000500ab, 0x00000006, 0x00000161, 0x00000160,
-    0x00000067, 0x0003003e, 0x0000015c, 0x00000161, 0x0004003d, 0x00000008, 0x00000163, 0x00000153,
-    0x000500c7, 0x00000008, 0x00000165, 0x00000163, 0x00000164, 0x000500aa, 0x00000006, 0x00000167,
-    0x00000165, 0x00000166, 0x0003003e, 0x00000162, 0x00000167, 0x0004003d, 0x00000006, 0x00000169,
-    0x0000002c, 0x0003003e, 0x00000168, 0x00000169, 0x0004003d, 0x00000006, 0x0000016a, 0x00000162,
-    0x0003003e, 0x0000002c, 0x0000016a, 0x0004003d, 0x00000008, 0x0000016c, 0x00000153, 0x000500c7,
-    0x00000008, 0x0000016e, 0x0000016c, 0x0000016d, 0x000500ab, 0x00000006, 0x0000016f, 0x0000016e,
-    0x00000067, 0x0003003e, 0x0000016b, 0x0000016f, 0x0004003d, 0x00000008, 0x00000175, 0x0000012f,
-    0x00060041, 0x00000113, 0x00000176, 0x00000174, 0x00000107, 0x00000175, 0x0004003d, 0x00000008,
-    0x00000177, 0x00000176, 0x0003003e, 0x00000170, 0x00000177, 0x0004003d, 0x00000008, 0x0000017d,
-    0x0000012f, 0x00060041, 0x00000113, 0x0000017e, 0x0000017c, 0x00000107, 0x0000017d, 0x0004003d,
-    0x00000008, 0x0000017f, 0x0000017e, 0x0003003e, 0x00000178, 0x0000017f, 0x00050041, 0x00000009,
-    0x00000181, 0x00000028, 0x00000067, 0x0004003d, 0x00000008, 0x00000182, 0x00000181, 0x0003003e,
-    0x00000180, 0x00000182, 0x0004003d, 0x00000006, 0x00000183, 0x00000162, 0x000400a8, 0x00000006,
-    0x00000184, 0x00000183, 0x000300f7, 0x00000186, 0x00000000, 0x000400fa, 0x00000184, 0x00000185,
-    0x0000026e, 0x000200f8, 0x00000185, 0x0004003d, 0x00000008, 0x00000188, 0x00000153, 0x000500c7,
-    0x00000008, 0x00000189, 0x00000188, 0x00000166, 0x000500aa, 0x00000006, 0x0000018a, 0x00000189,
-    0x00000166, 0x0003003e, 0x00000187, 0x0000018a, 0x0003003e, 0x0000018b, 0x0000018c, 0x0004003d,
-    0x00000006, 0x0000018d, 0x00000187, 0x000300f7, 0x0000018f, 0x00000000, 0x000400fa, 0x0000018d,
-    0x0000018e, 0x0000018f, 0x000200f8, 0x0000018e, 0x0004003d, 0x00000008, 0x00000190, 0x0000002b,
-    0x000500aa, 0x00000006, 0x00000191, 0x00000190, 0x00000067, 0x000300f7, 0x00000193, 0x00000000,
-    0x000400fa, 0x00000191, 0x00000192, 0x00000193, 0x000200f8, 0x00000192, 0x000200f9, 0x00000122,
-    0x000200f8, 0x00000193, 0x0004003d, 0x00000008, 0x00000195, 0x0000002b, 0x000500c7, 0x00000008,
-    0x00000196, 0x00000195, 0x000000a1, 0x000500aa, 0x00000006, 0x00000197, 0x00000196, 0x00000067,
-    0x000300f7, 0x00000199, 0x00000000, 0x000400fa, 0x00000197, 0x00000198, 0x00000199, 0x000200f8,
-    0x00000198, 0x0003003e, 0x0000018b, 0x0000019a, 0x000200f9, 0x00000199, 0x000200f8, 0x00000199,
-    0x0004003d, 0x00000008, 0x0000019b, 0x0000002b, 0x000500c7, 0x00000008, 0x0000019d, 0x0000019b,
-    0x0000019c, 0x000500aa, 0x00000006, 0x0000019e, 0x0000019d, 0x00000067, 0x000300f7, 0x000001a0,
-    0x00000000, 0x000400fa, 0x0000019e, 0x0000019f, 0x000001a0, 0x000200f8, 0x0000019f, 0x0004003d,
-    0x00000008, 0x000001a2, 0x00000180, 0x000500c7, 0x00000008, 0x000001a3, 0x000001a2, 0x000001a1,
-    0x0003003e, 0x00000180, 0x000001a3, 0x000200f9, 0x000001a0, 0x000200f8, 0x000001a0, 0x000200f9,
-    0x0000018f, 0x000200f8, 0x0000018f, 0x0004003d, 0x00000006, 0x000001a5, 0x0000018b, 0x000300f7,
-    0x000001a8, 0x00000000, 0x000400fa, 0x000001a5, 0x000001a7, 0x000001ab, 0x000200f8, 0x000001a7,
-    0x00050041, 0x00000009, 0x000001a9, 0x00000027, 0x000000a1, 0x0004003d, 0x00000008, 0x000001aa,
-    0x000001a9, 0x0003003e, 0x000001a6, 0x000001aa, 0x000200f9, 0x000001a8, 0x000200f8, 0x000001ab,
-    0x00050041, 0x00000009, 0x000001ac, 0x00000027, 0x00000067, 0x0004003d, 0x00000008, 0x000001ad,
-    0x000001ac, 0x0003003e, 0x000001a6, 0x000001ad, 0x000200f9, 0x000001a8, 0x000200f8, 0x000001a8,
-    0x0004003d, 0x00000008, 0x000001ae, 0x000001a6, 0x0003003e, 0x000001a4, 0x000001ae, 0x0004003d,
-    0x00000006, 0x000001b0, 0x0000016b, 0x0003003e, 0x000001af, 0x000001b0, 0x0004003d, 0x00000006,
-    0x000001b2, 0x0000015c, 0x0003003e, 0x000001b1, 0x000001b2, 0x0004003d, 0x00000008, 0x000001b4,
-    0x000001a4, 0x0003003e, 0x000001b3, 0x000001b4, 0x0004003d, 0x00000008, 0x000001b6, 0x00000170,
-    0x0003003e, 0x000001b5, 0x000001b6, 0x0004003d, 0x00000008, 0x000001b8, 0x00000180, 0x0003003e,
-    0x000001b7, 0x000001b8, 0x00090039, 0x00000006, 0x000001b9, 0x00000010, 0x000001af, 0x000001b1,
-    0x000001b3, 0x000001b5, 0x000001b7, 0x000400a8, 0x00000006, 0x000001ba, 0x000001b9, 0x000300f7,
-    0x000001bc, 0x00000000, 0x000400fa, 0x000001ba, 0x000001bb, 0x000001bc, 0x000200f8, 0x000001bb,
-    0x0004003d, 0x00000008, 0x000001bd, 0x00000180, 0x000500c7, 0x00000008, 0x000001bf, 0x000001bd,
-    0x000001be, 0x000500aa, 0x00000006, 0x000001c0, 0x000001bf, 0x00000067, 0x0004003d, 0x00000006,
-    0x000001c1, 0x0000018b, 0x000500a6, 0x00000006, 0x000001c2, 0x000001c0, 0x000001c1, 0x000300f7,
-    0x000001c4, 0x00000000, 0x000400fa, 0x000001c2, 0x000001c3, 0x000001c4, 0x000200f8, 0x000001c3,
-    0x000200f9, 0x00000122, 0x000200f8, 0x000001c4, 0x0003003e, 0x0000018b, 0x0000019a, 0x00050041,
-    0x00000009, 0x000001c6, 0x00000028, 0x000000a1, 0x0004003d, 0x00000008, 0x000001c7, 0x000001c6,
-    0x0003003e, 0x00000180, 0x000001c7, 0x0004003d, 0x00000006, 0x000001c9, 0x0000016b, 0x0003003e,
-    0x000001c8, 0x000001c9, 0x0004003d, 0x00000006, 0x000001cb, 0x0000015c, 0x0003003e, 0x000001ca,
-    0x000001cb, 0x00050041, 0x00000009, 0x000001cd, 0x00000027, 0x000000a1, 0x0004003d, 0x00000008,
-    0x000001ce, 0x000001cd, 0x0003003e, 0x000001cc, 0x000001ce, 0x0004003d, 0x00000008, 0x000001d0,
-    0x00000170, 0x0003003e, 0x000001cf, 0x000001d0, 0x0004003d, 0x00000008, 0x000001d2, 0x00000180,
-    0x0003003e, 0x000001d1, 0x000001d2, 0x00090039, 0x00000006, 0x000001d3, 0x00000010, 0x000001c8,
-    0x000001ca, 0x000001cc, 0x000001cf, 0x000001d1, 0x000400a8, 0x00000006, 0x000001d4, 0x000001d3,
-    0x000300f7, 0x000001d6, 0x00000000, 0x000400fa, 0x000001d4, 0x000001d5, 0x000001d6, 0x000200f8,
-    0x000001d5, 0x000200f9, 0x00000122, 0x000200f8, 0x000001d6, 0x000200f9, 0x000001bc, 0x000200f8,
-    0x000001bc, 0x0004003d, 0x00000008, 0x000001d9, 0x00000153, 0x000500c7, 0x00000008, 0x000001db,
-    0x000001d9, 0x000001da, 0x0003003e, 0x000001d8, 0x000001db, 0x0004003d, 0x00000006, 0x000001dc,
-    0x0000015c, 0x000400a8, 0x00000006, 0x000001dd, 0x000001dc, 0x000300f7, 0x000001df, 0x00000000,
-    0x000400fa, 0x000001dd, 0x000001de, 0x000001df, 0x000200f8, 0x000001de, 0x0004003d, 0x00000008,
-    0x000001e0, 0x000001d8, 0x000500c5, 0x00000008, 0x000001e1, 0x000001e0, 0x00000040, 0x0003003e,
-    0x000001d8, 0x000001e1, 0x000200f9, 0x000001df, 0x000200f8, 0x000001df, 0x0004003d, 0x00000008,
-    0x000001e3, 0x00000136, 0x000500c7, 0x00000008, 0x000001e4, 0x000001e3, 0x0000009b, 0x0003003e,
-    0x000001e2, 0x000001e4, 0x0004003d, 0x00000008, 0x000001e5, 0x000001e2, 0x000500aa, 0x00000006,
-    0x000001e6, 0x000001e5, 0x0000009b, 0x000300f7, 0x000001e8, 0x00000000, 0x000400fa, 0x000001e6,
-    0x000001e7, 0x00000223, 0x000200f8, 0x000001e7, 0x0004003d, 0x00000008, 0x000001e9, 0x00000178,
-    0x0004003d, 0x00000008, 0x000001ea, 0x000001d8, 0x000500c5, 0x00000008, 0x000001eb, 0x000001ea,
-    0x000001e9, 0x0003003e, 0x000001d8, 0x000001eb, 0x0004003d, 0x00000006, 0x000001ec, 0x0000018b,
-    0x000400a8, 0x00000006, 0x000001ed, 0x000001ec, 0x000300f7, 0x000001ef, 0x00000000, 0x000400fa,
-    0x000001ed, 0x000001ee, 0x0000020f, 0x000200f8, 0x000001ee, 0x0004003d, 0x00000008, 0x000001f0,
-    0x000001d8, 0x000500c7, 0x00000008, 0x000001f1, 0x000001f0, 0x000001be, 0x000500ab, 0x00000006,
-    0x000001f2, 0x000001f1, 0x00000067, 0x000300f7, 0x000001f4, 0x00000000, 0x000400fa, 0x000001f2,
-    0x000001f3, 0x000001f4, 0x000200f8, 0x000001f3, 0x00050041, 0x00000009, 0x000001f5, 0x00000026,
-    0x00000067, 0x0004003d, 0x00000008, 0x000001f6, 0x000001f5, 0x00050041, 0x00000009, 0x000001f7,
-    0x00000026, 0x000000a1, 0x0003003e, 0x000001f7, 0x000001f6, 0x00050041, 0x00000009, 0x000001f8,
-    0x00000027, 0x00000067, 0x0004003d, 0x00000008, 0x000001f9, 0x000001f8, 0x00050041, 0x00000009,
-    0x000001fa, 0x00000027, 0x000000a1, 0x0003003e, 0x000001fa, 0x000001f9, 0x00050041, 0x00000009,
-    0x000001fb, 0x00000028, 0x00000067, 0x0004003d, 0x00000008, 0x000001fc, 0x000001fb, 0x00050041,
-    0x00000009, 0x000001fd, 0x00000028, 0x000000a1, 0x0003003e, 0x000001fd, 0x000001fc, 0x0004003d,
-    0x00000006, 0x000001fe, 0x0000002a, 0x000300f7, 0x00000200, 0x00000000, 0x000400fa, 0x000001fe,
-    0x000001ff, 0x00000200, 0x000200f8, 0x000001ff, 0x00050041, 0x00000009, 0x00000201, 0x00000029,
-    0x00000067, 0x0004003d, 0x00000008, 0x00000202, 0x00000201, 0x00050041, 0x00000009, 0x00000203,
-    0x00000029, 0x000000a1, 0x0003003e, 0x00000203, 0x00000202, 0x000200f9, 0x00000200, 0x000200f8,
-    0x00000200, 0x000200f9, 0x000001f4, 0x000200f8, 0x000001f4, 0x0004003d, 0x00000008, 0x00000204,
-    0x00000136, 0x00050041, 0x00000009, 0x00000205, 0x00000026, 0x00000067, 0x0003003e, 0x00000205,
-    0x00000204, 0x0004003d, 0x00000008, 0x00000206, 0x00000170, 0x00050041, 0x00000009, 0x00000207,
-    0x00000027, 0x00000067, 0x0003003e, 0x00000207, 0x00000206, 0x0004003d, 0x00000008, 0x00000208,
-    0x000001d8, 0x00050041, 0x00000009, 0x00000209, 0x00000028, 0x00000067, 0x0003003e, 0x00000209,
-    0x00000208, 0x0004003d, 0x00000006, 0x0000020a, 0x0000002a, 0x000300f7, 0x0000020c, 0x00000000,
-    0x000400fa, 0x0000020a, 0x0000020b, 0x0000020c, 0x000200f8, 0x0000020b, 0x0004003d, 0x00000008,
-    0x0000020d, 0x00000141, 0x00050041, 0x00000009, 0x0000020e, 0x00000029, 0x00000067, 0x0003003e,
-    0x0000020e, 0x0000020d, 0x000200f9, 0x0000020c, 0x000200f8, 0x0000020c, 0x000200f9, 0x000001ef,
-    0x000200f8, 0x0000020f, 0x0004003d, 0x00000008, 0x00000210, 0x00000136, 0x00050041, 0x00000009,
-    0x00000211, 0x00000026, 0x000000a1, 0x0003003e, 0x00000211, 0x00000210, 0x0004003d, 0x00000008,
-    0x00000212, 0x00000170, 0x00050041, 0x00000009, 0x00000213, 0x00000027, 0x000000a1, 0x0003003e,
-    0x00000213, 0x00000212, 0x0004003d, 0x00000008, 0x00000214, 0x000001d8, 0x00050041, 0x00000009,
-    0x00000215, 0x00000028, 0x000000a1, 0x0003003e, 0x00000215, 0x00000214, 0x0004003d, 0x00000006,
-    0x00000216, 0x0000002a, 0x000300f7, 0x00000218, 0x00000000, 0x000400fa, 0x00000216, 0x00000217,
-    0x00000218, 0x000200f8, 0x00000217, 0x0004003d, 0x00000008, 0x00000219, 0x00000141, 0x00050041,
-    0x00000009, 0x0000021a, 0x00000029, 0x000000a1, 0x0003003e, 0x0000021a, 0x00000219, 0x000200f9,
-    0x00000218, 0x000200f8, 0x00000218, 0x000200f9, 0x000001ef, 0x000200f8, 0x000001ef, 0x0004003d,
-    0x00000006, 0x0000021b, 0x0000002a, 0x000300f7, 0x0000021d, 0x00000000, 0x000400fa, 0x0000021b,
-    0x0000021c, 0x0000021d, 0x000200f8, 0x0000021c, 0x0004003d, 0x00000008, 0x0000021e, 0x0000012f,
-    0x0004003d, 0x00000008, 0x0000021f, 0x00000178, 0x000500c5, 0x00000008, 0x00000221, 0x0000021f,
-    0x00000220, 0x00060041, 0x00000113, 0x00000222, 0x0000017c, 0x00000107, 0x0000021e, 0x0003003e,
-    0x00000222, 0x00000221, 0x000200f9, 0x0000021d, 0x000200f8, 0x0000021d, 0x000200f9, 0x000001e8,
-    0x000200f8, 0x00000223, 0x0004003d, 0x00000008, 0x00000225, 0x00000153, 0x000500c7, 0x00000008,
-    0x00000226, 0x00000225, 0x000000fe, 0x000500ab, 0x00000006, 0x00000227, 0x00000226, 0x00000067,
-    0x0003003e, 0x00000224, 0x00000227, 0x0004003d, 0x00000006, 0x00000228, 0x0000018b, 0x000400a8,
-    0x00000006, 0x00000229, 0x00000228, 0x000300f7, 0x0000022b, 0x00000000, 0x000400fa, 0x00000229,
-    0x0000022a, 0x0000022b, 0x000200f8, 0x0000022a, 0x00050041, 0x00000009, 0x0000022d, 0x00000026,
-    0x00000067, 0x0004003d, 0x00000008, 0x0000022e, 0x0000022d, 0x0003003e, 0x0000022c, 0x0000022e,
-    0x00050041, 0x00000009, 0x00000230, 0x00000027, 0x00000067, 0x0004003d, 0x00000008, 0x00000231,
-    0x00000230, 0x0003003e, 0x0000022f, 0x00000231, 0x00050041, 0x00000009, 0x00000233, 0x00000028,
-    0x00000067, 0x0004003d, 0x00000008, 0x00000234, 0x00000233, 0x0003003e, 0x00000232, 0x00000234,
-    0x0004003d, 0x00000006, 0x00000236, 0x00000187, 0x0003003e, 0x00000235, 0x00000236, 0x0004003d,
-    0x00000008, 0x00000238, 0x00000136, 0x0003003e, 0x00000237, 0x00000238, 0x0004003d, 0x00000008,
-    0x0000023a, 0x000001e2, 0x0003003e, 0x00000239, 0x0000023a, 0x0004003d, 0x00000008, 0x0000023c,
-    0x00000170, 0x0003003e, 0x0000023b, 0x0000023c, 0x0004003d, 0x00000008, 0x0000023e, 0x000001d8,
-    0x0003003e, 0x0000023d, 0x0000023e, 0x0004003d, 0x00000006, 0x00000240, 0x00000224, 0x0003003e,
-    0x0000023f, 0x00000240, 0x000d0039, 0x00000002, 0x00000241, 0x0000001c, 0x0000022c, 0x0000022f,
-    0x00000232, 0x00000235, 0x00000237, 0x00000239, 0x0000023b, 0x0000023d, 0x0000023f, 0x0004003d,
-    0x00000008, 0x00000242, 0x0000022c, 0x00050041, 0x00000009, 0x00000243, 0x00000026, 0x00000067,
-    0x0003003e, 0x00000243, 0x00000242, 0x0004003d, 0x00000008, 0x00000244, 0x0000022f, 0x00050041,
-    0x00000009, 0x00000245, 0x00000027, 0x00000067, 0x0003003e, 0x00000245, 0x00000244, 0x0004003d,
-    0x00000008, 0x00000246, 0x00000232, 0x00050041, 0x00000009, 0x00000247, 0x00000028, 0x00000067,
-    0x0003003e, 0x00000247, 0x00000246, 0x000200f9, 0x0000022b, 0x000200f8, 0x0000022b, 0x0004003d,
-    0x00000006, 0x00000248, 0x0000018b, 0x000400a8, 0x00000006, 0x00000249, 0x00000248, 0x000300f7,
-    0x0000024b, 0x00000000, 0x000400fa, 0x00000249, 0x0000024a, 0x0000024b, 0x000200f8, 0x0000024a,
-    0x0004003d, 0x00000008, 0x0000024c, 0x00000180, 0x000500c7, 0x00000008, 0x0000024d, 0x0000024c,
-    0x000001be, 0x000500ab, 0x00000006, 0x0000024e, 0x0000024d, 0x00000067, 0x000200f9, 0x0000024b,
-    0x000200f8, 0x0000024b, 0x000700f5, 0x00000006, 0x0000024f, 0x00000248, 0x0000022b, 0x0000024e,
-    0x0000024a, 0x000300f7, 0x00000251, 0x00000000, 0x000400fa, 0x0000024f, 0x00000250, 0x00000251,
-    0x000200f8, 0x00000250, 0x00050041, 0x00000009, 0x00000253, 0x00000026, 0x000000a1, 0x0004003d,
-    0x00000008, 0x00000254, 0x00000253, 0x0003003e, 0x00000252, 0x00000254, 0x00050041, 0x00000009,
-    0x00000256, 0x00000027, 0x000000a1, 0x0004003d, 0x00000008, 0x00000257, 0x00000256, 0x0003003e,
-    0x00000255, 0x00000257, 0x00050041, 0x00000009, 0x00000259, 0x00000028, 0x000000a1, 0x0004003d,
-    0x00000008, 0x0000025a, 0x00000259, 0x0003003e, 0x00000258, 0x0000025a, 0x0004003d, 0x00000006,
-    0x0000025c, 0x00000187, 0x0003003e, 0x0000025b, 0x0000025c, 0x0004003d, 0x00000008, 0x0000025e,
-    0x00000136, 0x0003003e, 0x0000025d, 0x0000025e, 0x0004003d, 0x00000008, 0x00000260, 0x000001e2,
-    0x0003003e, 0x0000025f, 0x00000260, 0x0004003d, 0x00000008, 0x00000262, 0x00000170, 0x0003003e,
-    0x00000261, 0x00000262, 0x0004003d, 0x00000008, 0x00000264, 0x000001d8, 0x0003003e, 0x00000263,
-    0x00000264, 0x0004003d, 0x00000006, 0x00000266, 0x00000224, 0x0003003e, 0x00000265, 0x00000266,
-    0x000d0039, 0x00000002, 0x00000267, 0x0000001c, 0x00000252, 0x00000255, 0x00000258, 0x0000025b,
-    0x0000025d, 0x0000025f, 0x00000261, 0x00000263, 0x00000265, 0x0004003d, 0x00000008, 0x00000268,
-    0x00000252, 0x00050041, 0x00000009, 0x00000269, 0x00000026, 0x000000a1, 0x0003003e, 0x00000269,
-    0x00000268, 0x0004003d, 0x00000008, 0x0000026a, 0x00000255, 0x00050041, 0x00000009, 0x0000026b,
-    0x00000027, 0x000000a1, 0x0003003e, 0x0000026b, 0x0000026a, 0x0004003d, 0x00000008, 0x0000026c,
-    0x00000258, 0x00050041, 0x00000009, 0x0000026d, 0x00000028, 0x000000a1, 0x0003003e, 0x0000026d,
-    0x0000026c, 0x000200f9, 0x00000251, 0x000200f8, 0x00000251, 0x000200f9, 0x000001e8, 0x000200f8,
-    0x000001e8, 0x000200f9, 0x00000186, 0x000200f8, 0x0000026e, 0x0004003d, 0x00000006, 0x0000026f,
-    0x00000168, 0x000400a8, 0x00000006, 0x00000270, 0x0000026f, 0x000300f7, 0x00000272, 0x00000000,
-    0x000400fa, 0x00000270, 0x00000271, 0x00000272, 0x000200f8, 0x00000271, 0x0003003e, 0x0000002b,
-    0x00000067, 0x000200f9, 0x00000272, 0x000200f8, 0x00000272, 0x0004003d, 0x00000006, 0x00000274,
-    0x0000016b, 0x0003003e, 0x00000273, 0x00000274, 0x0004003d, 0x00000006, 0x00000276, 0x0000015c,
-    0x0003003e, 0x00000275, 0x00000276, 0x00050041, 0x00000009, 0x00000278, 0x00000027, 0x00000067,
-    0x0004003d, 0x00000008, 0x00000279, 0x00000278, 0x0003003e, 0x00000277, 0x00000279, 0x0004003d,
-    0x00000008, 0x0000027b, 0x00000170, 0x0003003e, 0x0000027a, 0x0000027b, 0x00050041, 0x00000009,
-    0x0000027d, 0x00000028, 0x00000067, 0x0004003d, 0x00000008, 0x0000027e, 0x0000027d, 0x0003003e,
-    0x0000027c, 0x0000027e, 0x00090039, 0x00000006, 0x0000027f, 0x00000010, 0x00000273, 0x00000275,
-    0x00000277, 0x0000027a, 0x0000027c, 0x000400a8, 0x00000006, 0x00000280, 0x0000027f, 0x000300f7,
-    0x00000282, 0x00000000, 0x000400fa, 0x00000280, 0x00000281, 0x00000282, 0x000200f8, 0x00000281,
-    0x0003003e, 0x0000002b, 0x000000a1, 0x000200f9, 0x00000282, 0x000200f8, 0x00000282, 0x0004003d,
-    0x00000008, 0x00000283, 0x00000180, 0x000500c7, 0x00000008, 0x00000284, 0x00000283, 0x000001be,
-    0x000500ab, 0x00000006, 0x00000285, 0x00000284, 0x00000067, 0x000300f7, 0x00000287, 0x00000000,
-    0x000400fa, 0x00000285, 0x00000286, 0x00000287, 0x000200f8, 0x00000286, 0x0004003d, 0x00000006,
-    0x00000289, 0x0000016b, 0x0003003e, 0x00000288, 0x00000289, 0x0004003d, 0x00000006, 0x0000028b,
-    0x0000015c, 0x0003003e, 0x0000028a, 0x0000028b, 0x00050041, 0x00000009, 0x0000028d, 0x00000027,
-    0x000000a1, 0x0004003d, 0x00000008, 0x0000028e, 0x0000028d, 0x0003003e, 0x0000028c, 0x0000028e,
-    0x0004003d, 0x00000008, 0x00000290, 0x00000170, 0x0003003e, 0x0000028f, 0x00000290, 0x00050041,
-    0x00000009, 0x00000292, 0x00000028, 0x000000a1, 0x0004003d, 0x00000008, 0x00000293, 0x00000292,
-    0x0003003e, 0x00000291, 0x00000293, 0x00090039, 0x00000006, 0x00000294, 0x00000010, 0x00000288,
-    0x0000028a, 0x0000028c, 0x0000028f, 0x00000291, 0x000400a8, 0x00000006, 0x00000295, 0x00000294,
-    0x000300f7, 0x00000297, 0x00000000, 0x000400fa, 0x00000295, 0x00000296, 0x00000297, 0x000200f8,
-    0x00000296, 0x0004003d, 0x00000008, 0x00000298, 0x0000002b, 0x000500c5, 0x00000008, 0x00000299,
-    0x00000298, 0x0000019c, 0x0003003e, 0x0000002b, 0x00000299, 0x000200f9, 0x00000297, 0x000200f8,
-    0x00000297, 0x000200f9, 0x00000287, 0x000200f8, 0x00000287, 0x000200f9, 0x00000186, 0x000200f8,
-    0x00000186, 0x000200f9, 0x00000152, 0x000200f8, 0x00000152, 0x000200f9, 0x00000122, 0x000200f8,
-    0x00000122, 0x000200f9, 0x0000011f, 0x000200f8, 0x00000121, 0x000200f9, 0x000000e7, 0x000200f8,
-    0x000000e7, 0x000200f9, 0x000000e4, 0x000200f8, 0x000000e6, 0x000100fd, 0x00010038,
+const uint8_t Blob080_Data[6959] =
+{
+    0x28, 0xb5, 0x2f, 0xfd, 0x60, 0x7c, 0x67, 0x2d, 0xd9, 0x00, 0x6a, 0xdd, 0x2c, 0x36, 0x36, 0x10,
+    0x78, 0x6f, 0xc6, 0xcc, 0xe4, 0x19, 0x78, 0x06, 0x76, 0x52, 0xc7, 0xe1, 0xcd, 0x36, 0xbb, 0x9d,
+    0x2a, 0x32, 0xf3, 0xac, 0xde, 0xe7, 0xc7, 0x8a, 0x9e, 0x24, 0xe1, 0xb5, 0x2e, 0x7b, 0xb7, 0xd8,
+    0x14, 0xf8, 0x14, 0x22, 0xe9, 0xc2, 0x52, 0xba, 0x7c, 0x2b, 0xa6, 0x50, 0xf0, 0xfa, 0x2c, 0x59,
+    0xd9, 0x5b, 0x4a, 0x99, 0x02, 0x03, 0x03, 0x53, 0x03, 0x81, 0x03, 0xa8, 0x4d, 0xef, 0xe4, 0xa2,
+    0xb6, 0x7f, 0x8d, 0x2d, 0x27, 0x0d, 0xa7, 0x6c, 0x2b, 0xa6, 0xf5, 0xca, 0x6a, 0xdd, 0xf5, 0x15,
+    0xd6, 0xe7, 0xaa, 0x63, 0x6b, 0xeb, 0x2b, 0xfd, 0x02, 0x9e, 0xcd, 0x67, 0xc5, 0xda, 0x57, 0xc9,
+    0xc4, 0xf4, 0xc0, 0xe1, 0xd2, 0xb2, 0x12, 0x03, 0xa5, 0x64, 0x23, 0xe3, 0x62, 0xe2, 0x61, 0x61,
+    0x79, 0xd7, 0xc7, 0x6e, 0x69, 0x64, 0xf1, 0x98, 0x2b, 0x27, 0x63, 0xbd, 0x51, 0x5e, 0xf7, 0xdb,
+    0x47, 0x3b, 0x23, 0xfa, 0x72, 0xf8, 0xbb, 0x0b, 0xd9, 0x3b, 0xaf, 0xff, 0x9d, 0x67, 0xe7, 0x98,
+    0xb1, 0xe2, 0xaa, 0x5b, 0xfe, 0x53, 0xf3, 0xee, 0x57, 0xdf, 0xeb, 0xfc, 0x72, 0x35, 0x29, 0xbf,
+    0x24, 0x2f, 0x83, 0x71, 0xbc, 0xff, 0x24, 0x5c, 0xd3, 0xba, 0xb4, 0x26, 0x0d, 0x05, 0xf5, 0x13,
+    0x83, 0xd7, 0x3e, 0x75, 0xcf, 0x2f, 0x5b, 0xe7, 0xbf, 0xf8, 0x4d, 0x33, 0xad, 0x6d, 0x5c, 0x16,
+    0xeb, 0x6b, 0x37, 0x08, 0xac, 0x65, 0x25, 0xa5, 0x64, 0x05, 0x45, 0xc4, 0xc2, 0x32, 0x39, 0xe7,
+    0xe2, 0x7d, 0x7c, 0x0e, 0xf4, 0xee, 0xe8, 0xc8, 0xc6, 0xc2, 0xbe, 0xba, 0xb6, 0xb2, 0xac, 0xea,
+    0xaa, 0xfa, 0xe9, 0xaf, 0x9c, 0x22, 0x39, 0x42, 0xa4, 0x54, 0x48, 0x8d, 0x19, 0x9f, 0x31, 0x04,
+    0x71, 0x1d, 0x1f, 0xbf, 0xd0, 0xfc, 0xef, 0x86, 0xc5, 0xdc, 0xbc, 0x6e, 0xf2, 0x23, 0xbb, 0x66,
+    0x45, 0x44, 0x1d, 0xd1, 0x70, 0xd7, 0x75, 0x7a, 0x1c, 0xd8, 0x05, 0xc7, 0x8d, 0x01, 0xff, 0xeb,
+    0xf7, 0xb7, 0xa7, 0x47, 0xfe, 0xc7, 0xc3, 0xaa, 0xe1, 0xdc, 0xf9, 0x21, 0xfe, 0xb6, 0x6f, 0xb3,
+    0xda, 0xcf, 0xde, 0x0c, 0xb0, 0x86, 0xf8, 0xf5, 0xc3, 0x5f, 0x38, 0x3d, 0xfb, 0x77, 0xf1, 0x59,
+    0xfd, 0x3f, 0x16, 0xdb, 0x31, 0xa0, 0xed, 0xc2, 0xf8, 0xb8, 0x4e, 0x6f, 0x27, 0xeb, 0x5f, 0xb5,
+    0xb7, 0xb3, 0xfb, 0x6b, 0x1d, 0x77, 0x9c, 0xd6, 0xc5, 0xc7, 0x7d, 0xd9, 0xbf, 0x19, 0xdc, 0x9f,
+    0xeb, 0xe5, 0x7d, 0x8c, 0xa3, 0x91, 0xdb, 0xb0, 0x59, 0xbb, 0xeb, 0xd7, 0x8d, 0x71, 0xdd, 0xae,
+    0xdf, 0x30, 0xb7, 0xd3, 0xcb, 0xbf, 0xa3, 0x01, 0x92, 0xcb, 0x72, 0x67, 0x3f, 0x36, 0x03, 0x23,
+    0xdb, 0x79, 0x71, 0x19, 0xe6, 0xdd, 0xdc, 0xf0, 0x3b, 0xb6, 0xfa, 0x83, 0x22, 0x17, 0x19, 0x76,
+    0xdb, 0x0a, 0x85, 0x74, 0x7c, 0xaf, 0xeb, 0xf9, 0x2c, 0x39, 0xe7, 0x77, 0x40, 0xef, 0x37, 0x67,
+    0xc3, 0xf9, 0x37, 0x3d, 0x97, 0x23, 0xdb, 0x6d, 0x01, 0xf7, 0xee, 0x37, 0x2f, 0x9c, 0xe7, 0x3a,
+    0x97, 0xc6, 0x76, 0xc3, 0x66, 0xe1, 0xeb, 0xbf, 0x0d, 0xc6, 0x73, 0xba, 0x7a, 0xfb, 0xdd, 0x7c,
+    0xd7, 0xc5, 0x75, 0xf4, 0xff, 0x97, 0x75, 0x71, 0xde, 0xbf, 0x9e, 0xff, 0xfd, 0x95, 0xcf, 0x76,
+    0x70, 0x99, 0x9c, 0xd3, 0x85, 0xbf, 0x67, 0x7f, 0xff, 0xb9, 0x41, 0xf3, 0x25, 0xad, 0x2d, 0x2c,
+    0xfe, 0xee, 0x84, 0xe1, 0x36, 0x30, 0xce, 0x15, 0xbf, 0xf5, 0x81, 0xbd, 0xa8, 0x58, 0xbd, 0xad,
+    0x09, 0xf6, 0x5d, 0x60, 0x7f, 0x8c, 0x0b, 0xee, 0xdf, 0xb3, 0x1c, 0xed, 0xe3, 0xfc, 0xfe, 0xf7,
+    0x05, 0xac, 0xdb, 0x7a, 0xc5, 0x6a, 0xda, 0xec, 0x0d, 0x46, 0xc3, 0xe2, 0x76, 0x61, 0xb1, 0xd8,
+    0xee, 0xfa, 0x7b, 0x18, 0x6d, 0x4c, 0xfe, 0xa6, 0xd9, 0xd8, 0xff, 0xff, 0xcb, 0xe9, 0xcc, 0xea,
+    0x3d, 0x8c, 0x7f, 0x75, 0x1c, 0x8f, 0x7e, 0x72, 0x58, 0xec, 0x3d, 0x04, 0x8b, 0xe5, 0x04, 0xcb,
+    0x0b, 0x6e, 0x41, 0x5d, 0xfc, 0xf7, 0x0d, 0xdf, 0xe1, 0x7b, 0x0e, 0xc7, 0x02, 0x07, 0x1c, 0x83,
+    0x71, 0x11, 0x66, 0x98, 0x1d, 0x2e, 0xd7, 0x2a, 0xcf, 0xe8, 0x26, 0xbb, 0xe1, 0x1c, 0xec, 0x27,
+    0xd7, 0x46, 0x98, 0xeb, 0xe3, 0xaa, 0xcf, 0x82, 0xbf, 0xdc, 0x70, 0xbe, 0x53, 0xe5, 0x5e, 0x5c,
+    0xcf, 0x09, 0xc5, 0x68, 0x81, 0x5c, 0x5c, 0xdf, 0x09, 0xe8, 0x79, 0x38, 0xfc, 0x2d, 0x9c, 0x7a,
+    0xa9, 0x28, 0xa8, 0xdf, 0x73, 0xf2, 0xdf, 0x5f, 0xdc, 0x80, 0xe7, 0x3e, 0xd9, 0xe9, 0x38, 0x58,
+    0xc0, 0xfb, 0x65, 0x95, 0x09, 0xbf, 0x52, 0x81, 0x64, 0x1c, 0x2e, 0x27, 0xeb, 0xb8, 0x18, 0x8d,
+    0x4c, 0xce, 0xb9, 0x62, 0x5d, 0xae, 0xc0, 0xfb, 0xec, 0x5f, 0xbd, 0xf0, 0xc8, 0xa8, 0xc8, 0x8c,
+    0xab, 0x93, 0x89, 0xd0, 0x86, 0x0a, 0xc5, 0x5d, 0x1c, 0xb0, 0x8e, 0xfc, 0x15, 0x7a, 0x3c, 0x08,
+    0x48, 0x17, 0x83, 0xc5, 0xdc, 0x1f, 0xa9, 0x3d, 0x9c, 0x73, 0xcb, 0x60, 0x72, 0x18, 0xd7, 0xed,
+    0x76, 0x31, 0x58, 0x0e, 0x49, 0xdf, 0x77, 0xb3, 0x9e, 0x1c, 0xfc, 0xdd, 0x79, 0xfe, 0x77, 0x72,
+    0x77, 0xa7, 0x30, 0xff, 0xe2, 0x79, 0xc3, 0x5f, 0x2e, 0xfe, 0xa7, 0x03, 0xc6, 0xcb, 0x83, 0x79,
+    0x0e, 0xf6, 0xcb, 0x61, 0x58, 0x7e, 0x52, 0xe4, 0x9c, 0x4c, 0xc6, 0xe5, 0x76, 0x72, 0x6e, 0x07,
+    0xb8, 0x8f, 0xf3, 0x34, 0x1f, 0xec, 0xb5, 0x5b, 0x06, 0x73, 0xc3, 0x5f, 0xed, 0xe7, 0x84, 0xdf,
+    0x9d, 0x9b, 0xeb, 0xdf, 0x6e, 0x5f, 0x1e, 0xfe, 0x82, 0xfb, 0x72, 0xf0, 0xe1, 0x4e, 0xee, 0x1b,
+    0x8f, 0xb9, 0x7d, 0x09, 0xde, 0xd6, 0xe2, 0xe2, 0xd6, 0xfa, 0x70, 0x68, 0xd1, 0xda, 0xa6, 0x99,
+    0x00, 0x5c, 0x7d, 0x3e, 0xff, 0xeb, 0x4c, 0xd4, 0x0f, 0x7f, 0x71, 0xc1, 0x2b, 0xb6, 0xe7, 0x79,
+    0xfe, 0x6a, 0x4b, 0xcb, 0x40, 0x77, 0x27, 0x1b, 0x78, 0xab, 0x7b, 0x5b, 0xbb, 0xff, 0xe9, 0xaf,
+    0x1f, 0xc0, 0xdb, 0x58, 0x5e, 0xfb, 0x39, 0x4f, 0xdb, 0x9f, 0x15, 0x50, 0xdb, 0x01, 0x0a, 0x4c,
+    0xdb, 0x14, 0xb0, 0xb5, 0xcd, 0xd5, 0x6a, 0x6c, 0x29, 0xf4, 0xb8, 0xd4, 0xd2, 0x12, 0x9c, 0x95,
+    0x71, 0x85, 0x95, 0x35, 0x92, 0x75, 0x8a, 0x21, 0x18, 0x03, 0xfb, 0x0a, 0xeb, 0xc4, 0x80, 0x05,
+    0xc6, 0xe9, 0xf5, 0xd5, 0x39, 0xfe, 0x2e, 0x2f, 0xa6, 0xb8, 0xcf, 0x2e, 0x27, 0x5a, 0x58, 0x07,
+    0xb2, 0xb4, 0x38, 0x2b, 0x68, 0x0f, 0x88, 0xad, 0x54, 0x0d, 0x58, 0x15, 0x30, 0x50, 0x55, 0x80,
+    0x00, 0x04, 0x02, 0x53, 0x54, 0xab, 0x52, 0x53, 0xb4, 0x60, 0x94, 0x14, 0x54, 0x14, 0xd4, 0x80,
+    0xfa, 0xc8, 0x93, 0x53, 0x93, 0x80, 0x26, 0xa6, 0x25, 0x9b, 0x49, 0x48, 0x29, 0x49, 0x08, 0x29,
+    0xe9, 0xc8, 0x08, 0xe9, 0x68, 0xfb, 0x41, 0xa0, 0x40, 0x41, 0x3f, 0x40, 0x01, 0x7e, 0xa4, 0xd8,
+    0x01, 0x3c, 0x01, 0xd8, 0x3e, 0x3d, 0x9e, 0x3c, 0xff, 0xbf, 0xd5, 0x66, 0xed, 0x6d, 0x68, 0xf6,
+    0xbe, 0x55, 0xdf, 0xdc, 0xff, 0x58, 0xfb, 0x6a, 0xd7, 0xb6, 0xfd, 0xac, 0xb4, 0xfd, 0xad, 0x6e,
+    0xde, 0xb4, 0x71, 0xc3, 0x86, 0xb5, 0xcd, 0x1a, 0x36, 0x6b, 0xd0, 0xa4, 0x9e, 0x01, 0x83, 0xc6,
+    0xcc, 0x99, 0x32, 0x66, 0xc8, 0x8c, 0x29, 0x23, 0x66, 0x4c, 0x18, 0x31, 0x61, 0xbe, 0x80, 0xf1,
+    0xf2, 0xa5, 0xcb, 0x16, 0x2f, 0x5c, 0xba, 0x70, 0xb9, 0x62, 0x6a, 0x05, 0xf5, 0x8a, 0x5c, 0x15,
+    0x2b, 0x54, 0xaa, 0x4c, 0x89, 0x42, 0x05, 0x4a, 0x94, 0x27, 0x50, 0x9e, 0x9c, 0xa2, 0x3a, 0x59,
+    0x72, 0xea, 0x75, 0xc2, 0xa4, 0x89, 0xa2, 0x27, 0x13, 0x23, 0xf6, 0x00, 0x23, 0x45, 0x8e, 0x10,
+    0x29, 0x32, 0x84, 0x48, 0xda, 0x90, 0x04, 0x66, 0x94, 0xa5, 0xa4, 0x42, 0x42, 0x45, 0xb1, 0x42,
+    0x6e, 0x55, 0x1f, 0xac, 0xde, 0x20, 0xa3, 0x77, 0x67, 0x19, 0x90, 0x20, 0xa3, 0x3f, 0x80, 0xbc,
+    0x70, 0xf1, 0x03, 0x86, 0xa8, 0x68, 0x8f, 0x35, 0xef, 0x63, 0x75, 0x07, 0x68, 0x0e, 0x4f, 0x1c,
+    0x34, 0x72, 0x68, 0x6f, 0xe0, 0xb0, 0x71, 0xa3, 0x86, 0x8d, 0x73, 0x8d, 0x19, 0x34, 0x64, 0xcc,
+    0xf0, 0x7e, 0xca, 0x88, 0xd1, 0x09, 0x23, 0xc6, 0x0b, 0x18, 0x64, 0x2e, 0x5e, 0xb4, 0x70, 0xc1,
+    0xa2, 0x05, 0x0b, 0x4e, 0xcd, 0x15, 0x9c, 0xf4, 0x8d, 0x5d, 0x71, 0xab, 0xa0, 0xb3, 0x29, 0xcc,
+    0x28, 0x36, 0x95, 0x40, 0xa0, 0x18, 0xb3, 0x1f, 0x81, 0x89, 0x13, 0x8a, 0x67, 0x11, 0x26, 0xcc,
+    0x25, 0xce, 0xda, 0xc7, 0x11, 0x24, 0xce, 0x23, 0x42, 0x88, 0xd0, 0x8e, 0xd5, 0x21, 0x9e, 0x98,
+    0x65, 0x62, 0x7a, 0xc8, 0x72, 0xb8, 0xb4, 0xac, 0xc4, 0x40, 0x29, 0xb9, 0xd4, 0xc8, 0xb8, 0x98,
+    0x4d, 0x3c, 0x2c, 0x2c, 0x37, 0xed, 0xfa, 0x76, 0xbc, 0xc4, 0xb5, 0x85, 0x65, 0x0b, 0xa9, 0xa6,
+    0x9a, 0x96, 0x92, 0x86, 0x66, 0x41, 0x9b, 0x3c, 0x97, 0x3a, 0x35, 0xb7, 0x59, 0x10, 0x4b, 0x58,
+    0x35, 0x7f, 0xad, 0xb9, 0xce, 0x3a, 0x52, 0x9d, 0x54, 0xfd, 0x15, 0x1e, 0x57, 0x5f, 0x25, 0x8b,
+    0x34, 0x47, 0x8b, 0xbb, 0xfb, 0x0e, 0xb6, 0x78, 0xef, 0xb6, 0xf6, 0x69, 0x68, 0x67, 0x8f, 0x66,
+    0x76, 0x76, 0xf4, 0xb4, 0x59, 0x51, 0x3d, 0x96, 0x23, 0xd6, 0xb9, 0x45, 0x96, 0xc5, 0xc9, 0x79,
+    0xc5, 0x94, 0xad, 0xb2, 0x9d, 0xec, 0x25, 0xa3, 0x22, 0xa2, 0xa2, 0x21, 0xa2, 0xa1, 0xa4, 0x1d,
+    0x5b, 0xc7, 0xb6, 0x73, 0x70, 0xec, 0x5a, 0xcd, 0x16, 0xd6, 0x55, 0x35, 0x69, 0x56, 0xd3, 0x90,
+    0xf1, 0x6e, 0xd1, 0xb2, 0x93, 0x05, 0x8b, 0xb7, 0x9e, 0x82, 0xf3, 0x28, 0x65, 0x89, 0x92, 0x1a,
+    0x49, 0xdd, 0xe3, 0x7e, 0x1e, 0x35, 0x53, 0x55, 0xeb, 0xe7, 0xb6, 0x2e, 0x51, 0x67, 0x3e, 0x93,
+    0xf9, 0x9f, 0xf4, 0xec, 0x68, 0x6d, 0x73, 0x0e, 0x01, 0x62, 0x8a, 0xf2, 0x26, 0xa0, 0x98, 0x88,
+    0x98, 0x78, 0x88, 0x78, 0xb8, 0x93, 0x75, 0xf2, 0xa0, 0x3e, 0x58, 0xf6, 0x82, 0xff, 0x7f, 0x57,
+    0x5d, 0x9c, 0x07, 0x7a, 0x79, 0x78, 0x79, 0x77, 0x78, 0x77, 0x5a, 0x4e, 0xed, 0x2b, 0xd9, 0xfd,
+    0x8e, 0x36, 0xc1, 0x36, 0x0d, 0xed, 0x6c, 0x8b, 0xf6, 0x38, 0x34, 0x19, 0xd8, 0x97, 0xd7, 0x57,
+    0x57, 0x57, 0x91, 0x11, 0x51, 0x51, 0x9a, 0x21, 0xa2, 0x21, 0xed, 0x8f, 0xb7, 0xc7, 0x47, 0xcb,
+    0x93, 0x35, 0xf7, 0xec, 0xe8, 0xf0, 0xd4, 0x3b, 0xff, 0x8f, 0x3a, 0x38, 0x39, 0x3c, 0x70, 0xac,
+    0x44, 0x6e, 0xef, 0xd7, 0x7a, 0x6d, 0xd6, 0x67, 0xaf, 0x37, 0x36, 0xcc, 0xd6, 0xb9, 0x32, 0xd5,
+    0x29, 0xe8, 0x6f, 0xb5, 0x95, 0xea, 0x24, 0x9a, 0x7e, 0xa4, 0x14, 0xad, 0x48, 0xff, 0xa6, 0x2c,
+    0x8d, 0x15, 0x2d, 0xfd, 0x04, 0x35, 0xcc, 0x09, 0x7d, 0xaa, 0x75, 0x82, 0x15, 0x65, 0xd2, 0xf1,
+    0xa9, 0x85, 0x61, 0xbf, 0x70, 0x11, 0xc6, 0xa2, 0x6e, 0xd1, 0xb9, 0x42, 0x89, 0xa7, 0xe6, 0xec,
+    0x64, 0xe2, 0x14, 0x4a, 0xb1, 0x02, 0x49, 0xc5, 0x35, 0x05, 0x7d, 0x26, 0x22, 0xb1, 0x94, 0xf9,
+    0x96, 0x64, 0x17, 0xbe, 0x95, 0xb1, 0x35, 0xd2, 0x91, 0xec, 0xcb, 0xcf, 0x18, 0x7e, 0x6f, 0xeb,
+    0x2f, 0xf5, 0xf0, 0x7d, 0x83, 0x6f, 0xcd, 0xd3, 0xde, 0x29, 0x55, 0x21, 0x43, 0xf7, 0x5f, 0xf6,
+    0x65, 0x08, 0xe8, 0x37, 0x5d, 0xad, 0x5b, 0x5a, 0xaa, 0x6c, 0xd3, 0x92, 0xd3, 0xef, 0x30, 0x35,
+    0xd5, 0x4c, 0x43, 0x4a, 0x4b, 0xb4, 0x52, 0x80, 0xa6, 0x2d, 0x4e, 0x93, 0x76, 0xfb, 0xda, 0xa0,
+    0xec, 0xf5, 0x06, 0xb2, 0x9b, 0x7e, 0x8a, 0x72, 0x52, 0x6b, 0xba, 0xca, 0xd5, 0xcd, 0xcd, 0xa6,
+    0xd3, 0x7a, 0x8c, 0x8c, 0x88, 0x88, 0x86, 0x7c, 0xec, 0x9d, 0x1c, 0x1b, 0x27, 0x5b, 0x2f, 0x49,
+    0x72, 0x23, 0x41, 0xfa, 0x34, 0xca, 0xc9, 0xbc, 0x15, 0x15, 0x11, 0x11, 0x0f, 0xb1, 0xfb, 0xae,
+    0xeb, 0x83, 0xb4, 0x9e, 0x1e, 0xde, 0xe3, 0x55, 0xdd, 0x77, 0x52, 0x38, 0x4f, 0x5b, 0x26, 0x2d,
+    0xdb, 0x19, 0x12, 0x11, 0x90, 0xb6, 0xbe, 0xd2, 0x7f, 0x06, 0x06, 0xe6, 0xe5, 0xd5, 0x45, 0xe3,
+    0xbc, 0x56, 0x4b, 0x63, 0x79, 0xd8, 0x25, 0x6a, 0x33, 0xfd, 0x6f, 0xd7, 0xf4, 0x95, 0xfe, 0xd6,
+    0xa3, 0x6c, 0xda, 0x0c, 0x60, 0xc3, 0xba, 0xc6, 0xcc, 0xba, 0xaa, 0x26, 0xcd, 0xaa, 0x00, 0x55,
+    0xa5, 0x33, 0x4f, 0x65, 0xce, 0x8c, 0x9a, 0x29, 0x23, 0xe4, 0x4c, 0xe6, 0xc7, 0x97, 0x31, 0x62,
+    0xbe, 0x7c, 0x1b, 0x1d, 0x46, 0x07, 0x4c, 0x16, 0x2d, 0x59, 0xbc, 0x78, 0xbd, 0x3c, 0x75, 0xe1,
+    0xc2, 0xe5, 0xb7, 0x68, 0x49, 0x83, 0x05, 0x4b, 0x6a, 0x93, 0x2b, 0xa9, 0x66, 0x2b, 0x57, 0x94,
+    0x1e, 0xab, 0x4c, 0xa1, 0x72, 0x9e, 0x22, 0x25, 0x8a, 0x17, 0x15, 0x8a, 0x65, 0x25, 0xa5, 0x64,
+    0x85, 0xac, 0x22, 0x62, 0xe1, 0xb6, 0x4c, 0xce, 0xb3, 0x5c, 0xbc, 0x8f, 0xcf, 0x41, 0x56, 0xef,
+    0x8e, 0x8e, 0x2c, 0x3b, 0x16, 0xf6, 0xd5, 0xb5, 0x95, 0xcd, 0xb2, 0xaa, 0xaa, 0x9f, 0xb2, 0x57,
+    0x4e, 0x91, 0x1c, 0x21, 0x52, 0x2a, 0x24, 0x5b, 0x63, 0xc6, 0x67, 0x8c, 0x17, 0x9b, 0x9a, 0x93,
+    0x91, 0x59, 0xb3, 0xe1, 0x78, 0x1b, 0x08, 0xe8, 0xb7, 0x97, 0xad, 0x33, 0xe3, 0xb2, 0x82, 0xa2,
+    0x85, 0xdc, 0xa0, 0xf9, 0xf2, 0x4d, 0x0c, 0x54, 0x51, 0x11, 0xc8, 0x4e, 0x49, 0x45, 0x41, 0x35,
+    0x0d, 0x78, 0xda, 0x0a, 0x58, 0x72, 0x2a, 0x50, 0x2b, 0x2a, 0x32, 0xf9, 0x59, 0xc2, 0x44, 0xc9,
+    0x14, 0xbd, 0xe4, 0x75, 0x88, 0x94, 0x60, 0x26, 0x31, 0x45, 0x02, 0xc4, 0xd2, 0xb4, 0xf2, 0xc8,
+    0x05, 0x23, 0xa3, 0x93, 0x45, 0x6c, 0xd8, 0x20, 0x52, 0x39, 0x84, 0x48, 0xe9, 0x10, 0xd2, 0x52,
+    0x21, 0xa4, 0x42, 0x3a, 0x8c, 0x02, 0x09, 0x02, 0xa4, 0xf2, 0x87, 0x0f, 0x51, 0x1f, 0x3c, 0x7a,
+    0x84, 0xf2, 0xd8, 0xa1, 0x23, 0xd4, 0x71, 0xc7, 0x25, 0x28, 0x8e, 0x1c, 0x8f, 0x22, 0x70, 0x4c,
+    0xde, 0xa8, 0x61, 0xa3, 0x06, 0x0d, 0x1b, 0x28, 0x20, 0x35, 0x69, 0x6c, 0x6e, 0xca, 0x98, 0xf1,
+    0x29, 0x23, 0x86, 0xe7, 0x8b, 0x8f, 0x81, 0x62, 0x13, 0x85, 0xe6, 0xa6, 0x26, 0xe6, 0x09, 0x11,
+    0x67, 0x13, 0x66, 0x12, 0x25, 0x44, 0x89, 0x46, 0x60, 0x66, 0x86, 0x00, 0xd1, 0xc1, 0xf2, 0x83,
+    0x87, 0xcb, 0x0b, 0x1c, 0x7e, 0x36, 0x54, 0x5a, 0x6a, 0xc8, 0x30, 0x79, 0x01, 0xc3, 0x10, 0xa5,
+    0x64, 0x90, 0x9c, 0x24, 0x24, 0xa4, 0x85, 0x48, 0x0b, 0x15, 0x28, 0x40, 0x52, 0x78, 0x84, 0xf4,
+    0x3e, 0x3a, 0x4e, 0x68, 0x64, 0x64, 0x34, 0x03, 0x15, 0x99, 0xb5, 0x12, 0x18, 0x25, 0x2c, 0x32,
+    0x1e, 0x2d, 0x26, 0x2a, 0x26, 0x22, 0x2a, 0x46, 0x40, 0xbc, 0xc1, 0x87, 0x86, 0x87, 0x65, 0x43,
+    0xa3, 0xc2, 0x32, 0xe1, 0x4e, 0x06, 0xeb, 0x11, 0x06, 0xf5, 0xf0, 0xa0, 0xdc, 0x38, 0x2c, 0x16,
+    0x0c, 0x24, 0x07, 0x7e, 0xc1, 0xdc, 0x24, 0xfc, 0xdb, 0xed, 0x7a, 0x01, 0xef, 0xce, 0x06, 0x7f,
+    0x39, 0xb7, 0xcb, 0xf5, 0xeb, 0xe2, 0x7e, 0x10, 0x70, 0x15, 0x42, 0x10, 0xfa, 0xe4, 0x1e, 0xf4,
+    0xf1, 0x3d, 0x08, 0xda, 0x6b, 0xe0, 0xe0, 0x3f, 0x4f, 0xef, 0x0e, 0x4f, 0xd4, 0x8e, 0x6e, 0x4e,
+    0x04, 0x66, 0x87, 0xcb, 0xca, 0xc9, 0x6d, 0x84, 0x97, 0x4b, 0x3a, 0x32, 0x2a, 0x22, 0x1a, 0x12,
+    0xca, 0x06, 0x01, 0xfd, 0x6c, 0x03, 0x20, 0xd5, 0x70, 0x68, 0x70, 0x77, 0x82, 0x37, 0xb7, 0x37,
+    0x18, 0x6e, 0x0a, 0xda, 0xd0, 0xd6, 0xd8, 0x76, 0xd6, 0x78, 0xd4, 0xd2, 0xda, 0xd2, 0xce, 0x12,
+    0x84, 0x61, 0x9d, 0x89, 0x89, 0xb1, 0x96, 0x99, 0x71, 0x22, 0x20, 0x1b, 0xed, 0x19, 0x0b, 0x13,
+    0x0b, 0x03, 0x13, 0xd3, 0x01, 0xbb, 0xb1, 0xbc, 0xde, 0x74, 0x79, 0x79, 0x6e, 0x71, 0x99, 0x0f,
+    0x68, 0x39, 0x1e, 0xd8, 0xc9, 0xba, 0xc2, 0xba, 0xfa, 0xc7, 0x5a, 0xb5, 0xfa, 0x47, 0x03, 0xa0,
+    0xa6, 0x87, 0x67, 0x67, 0xab, 0x93, 0x93, 0xed, 0xc2, 0x79, 0x1f, 0x2e, 0x2f, 0x37, 0x53, 0xa8,
+    0x3c, 0x31, 0xa2, 0x22, 0x05, 0xca, 0x14, 0xaf, 0x53, 0x14, 0x29, 0xda, 0x15, 0xa5, 0x51, 0x6e,
+    0x52, 0x28, 0x4f, 0x4c, 0x4d, 0x4f, 0x51, 0x9b, 0xa0, 0x3a, 0x39, 0x3d, 0x3b, 0x61, 0xd2, 0x84,
+    0x89, 0x92, 0x25, 0x48, 0x96, 0x24, 0x51, 0xe2, 0x05, 0x4d, 0x82, 0xe4, 0x88, 0xe9, 0x11, 0x23,
+    0xa6, 0x46, 0x6e, 0x22, 0x45, 0x4a, 0x8b, 0x0c, 0x21, 0x72, 0x1e, 0x42, 0x5a, 0x3a, 0x2a, 0x24,
+    0xc8, 0x68, 0x90, 0x1f, 0x40, 0x44, 0x81, 0xf8, 0xf8, 0xe1, 0xa3, 0x07, 0xab, 0x28, 0x8f, 0x1e,
+    0x3c, 0x76, 0x84, 0x82, 0x86, 0xea, 0xd8, 0x71, 0xd6, 0x91, 0x03, 0x07, 0xe8, 0x0d, 0x1c, 0x36,
+    0x6e, 0xd8, 0xa0, 0x51, 0x43, 0x46, 0x8d, 0x19, 0x34, 0x66, 0x7c, 0x6e, 0x91, 0xe1, 0xf9, 0xe9,
+    0x09, 0x23, 0x86, 0x8b, 0x18, 0x2f, 0x60, 0x9c, 0x5f, 0xb4, 0x60, 0xe1, 0xa2, 0x93, 0x05, 0x67,
+    0x27, 0xa7, 0x8a, 0x15, 0x9b, 0x2b, 0x52, 0xa8, 0x30, 0x4d, 0xe1, 0xdd, 0x7c, 0x14, 0x9a, 0x27,
+    0x32, 0x4f, 0x98, 0xc0, 0x34, 0x71, 0xe6, 0x70, 0x2e, 0x71, 0x59, 0x82, 0x84, 0x25, 0x89, 0x11,
+    0x95, 0x23, 0x32, 0x31, 0x3d, 0x70, 0xb8, 0xb4, 0xac, 0xc4, 0x40, 0x29, 0x29, 0x22, 0x44, 0x66,
+    0x08, 0x10, 0x98, 0x20, 0x3e, 0x78, 0xf8, 0xd0, 0x81, 0x43, 0x87, 0x0d, 0x97, 0x1b, 0x34, 0x58,
+    0x6a, 0xc8, 0x50, 0x99, 0x41, 0x07, 0x86, 0x0b, 0x94, 0x9d, 0x17, 0x26, 0x25, 0x27, 0x95, 0x2c,
+    0x94, 0x36, 0x5a, 0xb8, 0x2b, 0x90, 0x32, 0x56, 0xd0, 0x46, 0x82, 0x26, 0x46, 0x42, 0xaa, 0x1e,
+    0x42, 0x52, 0x48, 0x2d, 0xa4, 0xf0, 0xf8, 0xd8, 0xc8, 0xb8, 0x98, 0x78, 0x58, 0x58, 0xde, 0xf5,
+    0x02, 0x13, 0xea, 0xe7, 0xf9, 0x2f, 0xc7, 0xc6, 0x52, 0x47, 0x33, 0x23, 0xa9, 0x59, 0x2b, 0x61,
+    0x31, 0x54, 0xc2, 0xad, 0x98, 0x08, 0xaa, 0x88, 0x78, 0xa8, 0x8a, 0x68, 0x58, 0x98, 0x6a, 0xc8,
+    0x44, 0x58, 0x36, 0x25, 0x64, 0xb2, 0x77, 0xb2, 0xae, 0x49, 0x1e, 0x1c, 0x83, 0x18, 0x14, 0x8b,
+    0xc3, 0x62, 0xb0, 0x20, 0x67, 0x20, 0x38, 0xf0, 0x9f, 0x2a, 0x82, 0xea, 0x37, 0x02, 0xe0, 0xb7,
+    0x0a, 0xd0, 0x9b, 0xfa, 0xe7, 0xcd, 0xff, 0xba, 0x39, 0xd7, 0xd4, 0x8f, 0x8b, 0xfb, 0x89, 0xe2,
+    0x10, 0x6c, 0xaa, 0x07, 0x7d, 0x7d, 0x0e, 0xf8, 0x1e, 0xec, 0xf1, 0xa5, 0xee, 0x35, 0xd0, 0xab,
+    0x63, 0x00, 0xc4, 0x31, 0x4f, 0x0f, 0xef, 0x2e, 0x4f, 0xd4, 0xee, 0x2e, 0xd5, 0xee, 0x23, 0xe9,
+    0xea, 0xe6, 0xe8, 0x54, 0xe7, 0xb6, 0x72, 0xa9, 0x71, 0x72, 0x0b, 0xe2, 0xe0, 0x16, 0xc0, 0xb9,
+    0xbd, 0x05, 0x5a, 0xb0, 0xfc, 0x96, 0xa6, 0x25, 0x27, 0x27, 0x3a, 0xba, 0xc8, 0x48, 0x0f, 0x4f,
+    0x15, 0x02, 0x93, 0xea, 0x43, 0x07, 0x0f, 0x1d, 0x38, 0x78, 0xd8, 0xc0, 0xc1, 0xb2, 0x92, 0x52,
+    0xb2, 0xc2, 0x86, 0x4b, 0x4b, 0x0d, 0x97, 0x67, 0x0d, 0x19, 0x2a, 0x33, 0x60, 0xa0, 0xbc, 0x80,
+    0xe1, 0xc2, 0xa4, 0xe4, 0xde, 0xa4, 0x85, 0x0a, 0x81, 0x16, 0x20, 0x23, 0x21, 0x29, 0x44, 0x3e,
+    0x52, 0x98, 0xf0, 0x38, 0x41, 0xeb, 0xe8, 0x78, 0x6e, 0x74, 0x6c, 0xfc, 0x77, 0x64, 0x34, 0x2b,
+    0x22, 0x16, 0x96, 0xc9, 0x8c, 0x12, 0x14, 0x17, 0x25, 0x48, 0x2d, 0x26, 0x22, 0x26, 0x1e, 0x16,
+    0x1a, 0x1e, 0x1a, 0x12, 0x96, 0xf7, 0x08, 0x77, 0x72, 0xe0, 0xae, 0x53, 0x0d, 0xea, 0x83, 0x63,
+    0x5d, 0x3c, 0x06, 0x14, 0x87, 0x21, 0xb9, 0xcc, 0xcd, 0x81, 0x05, 0xcf, 0x82, 0x7a, 0xe0, 0x08,
+    0x81, 0xe7, 0xc0, 0xbb, 0x08, 0x80, 0xdf, 0xf3, 0x97, 0x0e, 0x30, 0xe7, 0xe2, 0x7d, 0x7c, 0x0e,
+    0xf4, 0xee, 0xe8, 0xbc, 0x7f, 0xf9, 0x5f, 0x97, 0xdb, 0xf5, 0xc3, 0xfd, 0x20, 0xf4, 0x41, 0x78,
+    0xc0, 0xf7, 0x60, 0xcf, 0xc1, 0x5e, 0x03, 0x3d, 0x06, 0x0d, 0xa4, 0x18, 0xe4, 0xdd, 0xe1, 0xe5,
+    0x45, 0xe1, 0xd9, 0xd1, 0xd5, 0xd9, 0x41, 0xd5, 0xc9, 0xcd, 0xc9, 0xc5, 0xcd, 0xad, 0x2e, 0x60,
+    0x8b, 0x73, 0x73, 0x83, 0x5b, 0xf0, 0x06, 0x67, 0x7e, 0x53, 0xe0, 0xa6, 0xa0, 0xcd, 0x8d, 0xad,
+    0x8d, 0x8d, 0x4a, 0x6d, 0x6d, 0x4d, 0x2d, 0x2d, 0x41, 0x82, 0xb4, 0x33, 0x34, 0xb4, 0xaa, 0x33,
+    0xb2, 0xb1, 0xb0, 0xaf, 0xae, 0xad, 0x2c, 0x2b, 0x24, 0xb3, 0xfa, 0x77, 0xfe, 0xab, 0x8c, 0xec,
+    0xa9, 0xec, 0x46, 0x30, 0x76, 0x8a, 0x40, 0x2c, 0x6c, 0x2c, 0x06, 0xf6, 0x75, 0x05, 0xcc, 0xab,
+    0x8b, 0xcb, 0x8b, 0x6b, 0x2b, 0x92, 0x4b, 0x2b, 0xeb, 0x80, 0x96, 0xd4, 0x01, 0x2c, 0xab, 0x2b,
+    0xac, 0xa8, 0x2b, 0x03, 0x55, 0x05, 0x0c, 0x40, 0x15, 0x20, 0x40, 0x45, 0xe0, 0x9f, 0xaa, 0x9e,
+    0x92, 0xfa, 0x7f, 0x82, 0x8a, 0xfa, 0x37, 0x50, 0x75, 0x03, 0x04, 0x70, 0x49, 0x4a, 0x6a, 0x72,
+    0x72, 0x62, 0x5a, 0x6a, 0x32, 0x5c, 0xb2, 0x52, 0x42, 0x4a, 0x42, 0x4a, 0x3a, 0x1a, 0x43, 0x44,
+    0x54, 0x64, 0x74, 0x36, 0x2a, 0x1a, 0x22, 0x1a, 0x12, 0x22, 0x12, 0x02, 0x0a, 0x3a, 0x07, 0x01,
+    0x05, 0xf8, 0x39, 0xff, 0x04, 0xf0, 0x01, 0x70, 0x06, 0xe0, 0xd3, 0x33, 0x46, 0x67, 0x87, 0x67,
+    0x8a, 0xc7, 0x6c, 0x27, 0x47, 0x27, 0x47, 0x07, 0xe7, 0xd6, 0x6e, 0xa5, 0xb6, 0xa7, 0xda, 0x3b,
+    0x1b, 0x95, 0x1d, 0xdf, 0x57, 0xac, 0x17, 0x0a, 0xcb, 0x75, 0x45, 0xf3, 0xff, 0xf6, 0x7f, 0x3d,
+    0x45, 0xb7, 0x7e, 0xeb, 0x9b, 0xfa, 0x09, 0xbc, 0x69, 0xe3, 0x46, 0xca, 0x0d, 0x9b, 0x36, 0x52,
+    0x6c, 0x58, 0xd7, 0xac, 0x51, 0xc3, 0xaa, 0x26, 0xcd, 0xea, 0x79, 0x55, 0x35, 0x8d, 0x17, 0x4a,
+    0xf5, 0x0c, 0x9a, 0x33, 0x66, 0xd0, 0x94, 0x31, 0xd3, 0x49, 0xa6, 0xcc, 0x28, 0x19, 0x31, 0x3d,
+    0x62, 0xc2, 0x8c, 0x01, 0x13, 0x66, 0x12, 0x8c, 0x97, 0x2f, 0x5e, 0x0c, 0xbb, 0x6c, 0xa9, 0x05,
+    0x6c, 0xd1, 0xc2, 0x65, 0x35, 0x8b, 0x96, 0x2b, 0x59, 0xb0, 0x5c, 0xc9, 0x4c, 0xc5, 0xc2, 0x95,
+    0x4a, 0x85, 0x8a, 0x95, 0x2f, 0xab, 0x62, 0x05, 0xc8, 0x69, 0x95, 0x29, 0x54, 0xa6, 0x48, 0xa1,
+    0x12, 0x45, 0x4a, 0x14, 0x28, 0xa7, 0x4f, 0x50, 0xa1, 0xa0, 0x82, 0x82, 0x36, 0x61, 0xd2, 0x84,
+    0xc9, 0x92, 0x26, 0x4a, 0x96, 0x20, 0x39, 0x42, 0xa4, 0x54, 0x88, 0x92, 0x24, 0x48, 0xcc, 0x49,
+    0x4c, 0x8f, 0x8c, 0x4d, 0x8d, 0x10, 0x29, 0x62, 0x24, 0xaa, 0xc8, 0x90, 0xd2, 0xbd, 0x21, 0xa4,
+    0x42, 0x02, 0x49, 0x47, 0xcd, 0x41, 0x46, 0xcf, 0x52, 0x41, 0x7e, 0xf8, 0xf8, 0xe1, 0x43, 0xf4,
+    0x47, 0x0f, 0x1e, 0xa2, 0x9b, 0x93, 0x3d, 0xfe, 0x43, 0x79, 0xec, 0x08, 0x35, 0xeb, 0xc8, 0x91,
+    0x03, 0x07, 0xe8, 0x0d, 0x1c, 0x35, 0x3e, 0x63, 0xf8, 0xdc, 0xb8, 0xbf, 0x6c, 0xd4, 0x30, 0xdb,
+    0xa0, 0x31, 0x63, 0x4c, 0x43, 0xc6, 0xa7, 0xa6, 0x0c, 0xad, 0x67, 0x8c, 0x3d, 0x4f, 0x18, 0x2f,
+    0x02, 0x61, 0xb8, 0xd0, 0xdc, 0x74, 0xa1, 0xa2, 0x05, 0x8b, 0x16, 0x5e, 0x16, 0x9d, 0x2a, 0x38,
+    0x37, 0x57, 0x70, 0x9e, 0xa3, 0x56, 0xa4, 0xe8, 0x4c, 0x81, 0x42, 0xc5, 0x24, 0x8a, 0xca, 0xca,
+    0x12, 0x25, 0x4e, 0x9c, 0x4d, 0x9c, 0x30, 0x9b, 0x20, 0x51, 0x82, 0xc4, 0x88, 0x12, 0x22, 0x46,
+    0x84, 0xc8, 0x14, 0x91, 0x89, 0x89, 0x09, 0xe2, 0x03, 0xe6, 0x07, 0x0f, 0x98, 0x1d, 0x3c, 0x9c,
+    0x39, 0x74, 0xe0, 0x70, 0xe9, 0xa4, 0xe1, 0x52, 0x83, 0xe5, 0xe5, 0x5b, 0x52, 0x65, 0xc0, 0x80,
+    0xe1, 0x42, 0x65, 0xe4, 0x05, 0xca, 0x49, 0xc9, 0x48, 0x0b, 0x92, 0x9c, 0x7f, 0x15, 0x2c, 0x54,
+    0xa0, 0x50, 0x87, 0x29, 0x3c, 0x42, 0xae, 0x4e, 0x78, 0x54, 0x31, 0xc1, 0xd1, 0xdc, 0xe8, 0x28,
+    0xd5, 0xb8, 0x65, 0x34, 0x94, 0xc0, 0xb8, 0xa8, 0x28, 0x61, 0xb1, 0x70, 0x4c, 0x58, 0x58, 0xde,
+    0x09, 0xcb, 0xe2, 0xc0, 0xb0, 0xb8, 0x53, 0x10, 0x1c, 0x06, 0x57, 0xf9, 0x45, 0xf8, 0x02, 0x56,
+    0x7d, 0x6f, 0xaf, 0xdf, 0x5f, 0xee, 0xe5, 0xec, 0x72, 0x73, 0xed, 0x68, 0x1d, 0x17, 0xdf, 0x43,
+    0x00, 0x01, 0xef, 0x83, 0xf0, 0x80, 0xaf, 0x8f, 0xcf, 0x41, 0x5d, 0x03, 0x07, 0x77, 0x0c, 0xf4,
+    0x1a, 0x64, 0xcd, 0x18, 0xcc, 0xcd, 0xfd, 0xd3, 0xc5, 0xc9, 0x71, 0xc5, 0x2d, 0x30, 0x83, 0x6b,
+    0x5b, 0x60, 0x7e, 0x83, 0x73, 0x7b, 0x1b, 0xe0, 0xf6, 0x45, 0x01, 0xdb, 0x5a, 0x1b, 0x14, 0x9b,
+    0xda, 0x5a, 0x56, 0xad, 0x8c, 0x0c, 0x41, 0x99, 0x10, 0x82, 0x31, 0x2e, 0xb1, 0xb1, 0xb0, 0x2c,
+    0x98, 0x98, 0x55, 0xd8, 0x96, 0x95, 0x16, 0xd6, 0x96, 0xf9, 0x80, 0x96, 0x8e, 0x03, 0x8f, 0x42,
+    0x59, 0xff, 0x58, 0x4d, 0xae, 0x94, 0x0c, 0x54, 0x19, 0x28, 0x40, 0x57, 0x51, 0x41, 0x11, 0xa0,
+    0xa1, 0xa6, 0xa4, 0xa2, 0x98, 0x9a, 0x98, 0xfe, 0x7f, 0x80, 0x9b, 0x27, 0x5a, 0xc0, 0x3b, 0x35,
+    0xa5, 0xa1, 0x97, 0xfe, 0x85, 0x92, 0x94, 0x90, 0x92, 0x8e, 0x8c, 0x90, 0x8e, 0xdc, 0x04, 0x01,
+    0x01, 0xf0, 0x09, 0x80, 0x06, 0x40, 0x1b, 0x34, 0x01, 0x8d, 0x5e, 0xa8, 0x34, 0x84, 0xbb, 0xa4,
+    0x99, 0x01, 0x02, 0x10, 0x08, 0xa0, 0x01, 0x83, 0xb9, 0x19, 0x86, 0x67, 0x71, 0x98, 0x42, 0x2b,
+    0x00, 0xd4, 0x0c, 0xa1, 0x61, 0x21, 0x0e, 0x23, 0x28, 0x7c, 0x05, 0x00, 0x38, 0x10, 0x46, 0xd1,
+    0x02, 0xc7, 0x01, 0x1b, 0x1f, 0x23, 0x80, 0x70, 0xf8, 0x9c, 0x2c, 0x2e, 0x6f, 0x53, 0x15, 0x77,
+    0x96, 0x1b, 0x14, 0xac, 0xb6, 0xe8, 0x5d, 0x57, 0x79, 0x80, 0x8d, 0xae, 0x82, 0x6b, 0xa7, 0xa6,
+    0x20, 0xf1, 0x3e, 0xe0, 0x03, 0xf5, 0x71, 0x87, 0xa5, 0x07, 0x91, 0x73, 0xbf, 0x81, 0xcb, 0x4e,
+    0x3d, 0xf3, 0xc3, 0xc7, 0x6b, 0x65, 0x4c, 0x00, 0xbb, 0x31, 0x05, 0xec, 0x0f, 0xf9, 0x2e, 0x5c,
+    0x09, 0x7c, 0xc0, 0x58, 0xdb, 0x40, 0xe0, 0x45, 0xf4, 0x5d, 0x43, 0xe6, 0x4c, 0x21, 0xca, 0x61,
+    0x7f, 0xb5, 0xb8, 0xd5, 0xff, 0x59, 0x65, 0x42, 0xc2, 0x2b, 0xce, 0x54, 0x79, 0x2b, 0xb6, 0x16,
+    0x74, 0xd4, 0xf1, 0xe8, 0xfd, 0x88, 0xca, 0x5f, 0xd6, 0x3f, 0xf0, 0x1f, 0x91, 0x28, 0x86, 0xdf,
+    0xa7, 0xe1, 0x09, 0xab, 0x7d, 0x4c, 0x8f, 0xbf, 0xf6, 0x9b, 0x01, 0xd4, 0x05, 0xc8, 0x1a, 0x3f,
+    0x39, 0xf6, 0x51, 0xab, 0x6a, 0x27, 0x37, 0x2a, 0xe1, 0xb7, 0xb6, 0xc1, 0x7f, 0x85, 0xb2, 0x15,
+    0x54, 0xd1, 0x32, 0xa3, 0x4f, 0x97, 0x28, 0x1e, 0xea, 0xf1, 0x7f, 0x1a, 0xc9, 0x22, 0x87, 0xe7,
+    0xc5, 0x5b, 0x0e, 0xe9, 0x3f, 0xfb, 0x82, 0xf5, 0x88, 0xe6, 0xf7, 0xe8, 0x6d, 0x1e, 0xb1, 0x2d,
+    0x0f, 0xf4, 0x5b, 0x64, 0xb3, 0x29, 0x30, 0x73, 0x3d, 0x7c, 0x30, 0xbf, 0x04, 0xd7, 0xcd, 0x5a,
+    0x84, 0x35, 0xfb, 0xf4, 0xf9, 0xb7, 0x97, 0x41, 0xf3, 0xa1, 0xf9, 0x1e, 0x56, 0xf8, 0x03, 0x64,
+    0x9c, 0xde, 0xd9, 0x6f, 0xe0, 0x6a, 0xd8, 0x2b, 0x6d, 0x76, 0x9f, 0xbf, 0xbf, 0xef, 0x9b, 0x6d,
+    0xe7, 0x7a, 0xb0, 0xed, 0xf5, 0x00, 0x35, 0xe5, 0xea, 0xec, 0x79, 0x62, 0x6b, 0x38, 0xc3, 0xb7,
+    0xfe, 0x2c, 0xb7, 0x90, 0x57, 0xdd, 0x0c, 0x4c, 0x97, 0x10, 0x14, 0x3f, 0x0a, 0x88, 0xe7, 0x71,
+    0xd3, 0xaf, 0x34, 0xe7, 0x53, 0x74, 0xc5, 0xbc, 0x86, 0xff, 0x92, 0x2f, 0xbb, 0xf9, 0x6e, 0x53,
+    0x78, 0x19, 0x1a, 0xd6, 0x34, 0xc4, 0x83, 0xca, 0x21, 0xe9, 0x3c, 0xd6, 0x47, 0x01, 0xc8, 0x1b,
+    0x36, 0x87, 0x60, 0xd2, 0x13, 0xd1, 0xaa, 0x30, 0x93, 0x1e, 0x06, 0x39, 0xbb, 0xd9, 0xc0, 0xbc,
+    0x01, 0xda, 0xe5, 0x9e, 0x56, 0xaf, 0x9a, 0xd6, 0xe9, 0x70, 0x21, 0x0c, 0xe5, 0x1e, 0x26, 0x07,
+    0xb1, 0x0d, 0xe8, 0x64, 0x9e, 0x6e, 0x71, 0xac, 0x92, 0xc8, 0x8a, 0x54, 0x45, 0xd8, 0xfd, 0xee,
+    0x4e, 0x4d, 0xfe, 0x9a, 0x54, 0xf6, 0x1e, 0x0f, 0x36, 0x4c, 0xf2, 0x67, 0xc4, 0x94, 0x5f, 0xe5,
+    0xfb, 0x2b, 0x9b, 0x72, 0xf0, 0x04, 0x3c, 0x3a, 0xd1, 0x75, 0xd0, 0xd8, 0x7b, 0x6d, 0x7d, 0x01,
+    0x43, 0x83, 0x0c, 0x70, 0xe9, 0x0d, 0x88, 0x5a, 0xe0, 0xea, 0x74, 0x48, 0x73, 0xa6, 0x2a, 0xdf,
+    0xe5, 0x0d, 0xa9, 0xbe, 0xd9, 0xf0, 0x74, 0x1e, 0xf4, 0xce, 0xfc, 0xc8, 0xee, 0xa3, 0xe2, 0x2f,
+    0x6f, 0x42, 0xde, 0x87, 0x7b, 0xc5, 0x67, 0xf5, 0x27, 0xf4, 0x42, 0x4a, 0xd7, 0x7f, 0x5b, 0x4e,
+    0x66, 0xa2, 0x60, 0xd5, 0xed, 0x94, 0x71, 0xfe, 0x56, 0xd6, 0x33, 0xd9, 0xb0, 0x74, 0x3d, 0x7f,
+    0x23, 0xef, 0x3b, 0x26, 0xb9, 0x11, 0xfd, 0x30, 0xac, 0xcb, 0x94, 0x5e, 0x06, 0xae, 0x42, 0x13,
+    0x9b, 0x15, 0x2e, 0x6e, 0x8c, 0x98, 0x23, 0x06, 0x6b, 0x4a, 0x06, 0xfb, 0x8f, 0x49, 0x54, 0xfd,
+    0xdb, 0xf3, 0x58, 0x7e, 0x8d, 0x95, 0x9e, 0xe0, 0xee, 0x72, 0xae, 0xb6, 0x2b, 0x7d, 0x93, 0x7a,
+    0x38, 0xf9, 0x5a, 0x3e, 0x64, 0x07, 0xce, 0x78, 0x34, 0x3c, 0x8b, 0x3f, 0xbb, 0x4a, 0x1f, 0x3f,
+    0x2c, 0xc9, 0xc9, 0x25, 0x65, 0x8d, 0xb7, 0x79, 0xd2, 0xf0, 0x11, 0x77, 0x63, 0xbf, 0x66, 0x7a,
+    0x8f, 0x2e, 0x5f, 0x37, 0xf3, 0xf8, 0x34, 0x3e, 0xec, 0x54, 0xf6, 0x57, 0xea, 0x20, 0x2b, 0x88,
+    0xcd, 0x70, 0xc0, 0x5d, 0x90, 0xc1, 0xb5, 0x2a, 0x5a, 0xf1, 0xf0, 0xec, 0x07, 0xd3, 0xbf, 0x0f,
+    0xf5, 0x89, 0xfc, 0xd9, 0x4d, 0x7e, 0xf0, 0x2d, 0xac, 0x44, 0x76, 0x49, 0xcb, 0x5d, 0x76, 0x37,
+    0xab, 0xa3, 0xfb, 0xa2, 0xc8, 0x7e, 0x15, 0xb2, 0xa9, 0xce, 0x89, 0x02, 0xf6, 0x62, 0xef, 0x83,
+    0x37, 0xc8, 0x1b, 0xe9, 0xd3, 0x7f, 0xde, 0xa3, 0xfc, 0x83, 0xea, 0x65, 0x6b, 0x5c, 0xbf, 0x5f,
+    0x3c, 0x6a, 0x3c, 0x94, 0xff, 0x66, 0xc2, 0x63, 0xac, 0x47, 0xad, 0x53, 0xf4, 0x0d, 0x2e, 0xb3,
+    0xf0, 0xd2, 0xf3, 0x29, 0xd0, 0xe7, 0x32, 0x93, 0x7e, 0x1c, 0xb7, 0x2b, 0x50, 0xdf, 0x34, 0xf5,
+    0x30, 0x9c, 0x84, 0x8d, 0x77, 0xfe, 0x61, 0x40, 0x6c, 0xd2, 0xcf, 0x61, 0xfc, 0x96, 0x1e, 0x4d,
+    0xf7, 0x71, 0xf1, 0x08, 0x5d, 0x67, 0x08, 0xe9, 0x4f, 0x01, 0x8f, 0x29, 0xbb, 0xd4, 0xec, 0x89,
+    0xea, 0xb3, 0xeb, 0xc9, 0xde, 0x94, 0x5e, 0xc0, 0x72, 0xb9, 0x38, 0x40, 0xa7, 0xc6, 0xbe, 0xc4,
+    0x62, 0x12, 0x39, 0x3c, 0x32, 0x58, 0xf2, 0xfd, 0x77, 0xb6, 0x66, 0x27, 0x67, 0xce, 0xac, 0x85,
+    0x2c, 0x1e, 0x96, 0xb8, 0xa8, 0xc7, 0x4e, 0x00, 0xb8, 0xc1, 0xad, 0x1d, 0x9e, 0xf9, 0x21, 0xeb,
+    0x36, 0xe0, 0xbf, 0xcf, 0x34, 0x67, 0x9a, 0xea, 0x26, 0xb3, 0x76, 0xdf, 0x40, 0x3a, 0xea, 0x53,
+    0x18, 0x40, 0x5d, 0x96, 0x43, 0x90, 0xe3, 0x0e, 0x67, 0xac, 0x6f, 0x42, 0xeb, 0x08, 0xf6, 0xd2,
+    0x2e, 0x1e, 0xce, 0xc2, 0x11, 0xc6, 0x8e, 0x40, 0x52, 0x92, 0x01, 0xc1, 0x61, 0x52, 0x1f, 0x6d,
+    0x95, 0x2c, 0x8e, 0x3f, 0xd8, 0x7d, 0x01, 0x64, 0x5f, 0xe2, 0xb7, 0xbb, 0x4e, 0x3c, 0x10, 0xdb,
+    0x7b, 0x39, 0x5a, 0x43, 0x3c, 0x11, 0xf9, 0xf4, 0xf9, 0xca, 0x70, 0xf1, 0xbc, 0xd8, 0xcb, 0xc6,
+    0x4e, 0xd1, 0xdc, 0xed, 0x2f, 0xa0, 0x09, 0x1c, 0xf7, 0x9d, 0x44, 0x1c, 0xd8, 0x2d, 0xb6, 0x3d,
+    0xe3, 0xf7, 0x6c, 0x74, 0x07, 0x48, 0x6d, 0x0a, 0xb8, 0x60, 0x2f, 0x09, 0xb6, 0x07, 0xe0, 0x0d,
+    0xe7, 0x49, 0xf1, 0xe4, 0x0f, 0x6c, 0xdd, 0xbc, 0x77, 0xea, 0xee, 0xdb, 0x76, 0xae, 0x7e, 0x1d,
+    0xd8, 0xe3, 0x2c, 0x54, 0x2c, 0xf8, 0x20, 0x87, 0x89, 0x66, 0xad, 0x19, 0xff, 0xc1, 0x4b, 0x7f,
+    0x74, 0xf2, 0xd2, 0xf2, 0xf9, 0xf2, 0x8e, 0xf9, 0x7b, 0xfd, 0x0a, 0xdc, 0xdf, 0xee, 0x50, 0xf5,
+    0x11, 0xec, 0x55, 0xb1, 0xcd, 0x2b, 0xed, 0x5f, 0x0e, 0x78, 0x98, 0x10, 0x1e, 0x58, 0xdd, 0xd2,
+    0xe9, 0x66, 0x76, 0xe2, 0xdb, 0x67, 0xfb, 0x6f, 0x07, 0x4e, 0x9d, 0x1c, 0x9f, 0x75, 0x86, 0xa5,
+    0xdb, 0xf9, 0xb2, 0xf4, 0x96, 0xbb, 0xe9, 0x5a, 0xfc, 0xda, 0x3d, 0x0f, 0x44, 0x9d, 0xe2, 0xb9,
+    0x79, 0x43, 0x78, 0xdc, 0x8e, 0xef, 0x5d, 0x99, 0x92, 0x35, 0x74, 0x40, 0x34, 0xa7, 0x96, 0x68,
+    0xeb, 0xbb, 0xde, 0x7c, 0xfd, 0xd7, 0x40, 0x87, 0xab, 0x1a, 0x3e, 0x42, 0x00, 0x0a, 0x37, 0xc2,
+    0xfb, 0x89, 0x2c, 0xed, 0xb2, 0x09, 0x99, 0x3e, 0xfe, 0x6d, 0x38, 0xa7, 0xe2, 0x86, 0x97, 0xed,
+    0xd2, 0xb2, 0x7f, 0x6d, 0x26, 0xd8, 0xd7, 0x9e, 0x09, 0x2f, 0xd4, 0x68, 0xe6, 0xde, 0xac, 0xbf,
+    0xee, 0xbb, 0x93, 0x04, 0xef, 0x62, 0x62, 0xfc, 0x9c, 0xfd, 0x39, 0xdd, 0xc7, 0x19, 0x6b, 0x53,
+    0x4f, 0x87, 0x8b, 0x9e, 0x9d, 0xb3, 0x68, 0xc8, 0xd2, 0x4d, 0xec, 0x6b, 0x5c, 0x15, 0xc7, 0xb6,
+    0xc1, 0x90, 0x8d, 0x2d, 0x7f, 0x8b, 0x6b, 0x29, 0x09, 0x9f, 0x7c, 0x53, 0xee, 0x03, 0xec, 0x68,
+    0xd6, 0xcc, 0x19, 0x07, 0x74, 0xc5, 0xe2, 0xb9, 0xe8, 0x90, 0x69, 0xea, 0xdf, 0xaa, 0x02, 0xe2,
+    0xa7, 0xa4, 0xef, 0x64, 0xd8, 0x6d, 0x69, 0xb8, 0x61, 0xa4, 0xfa, 0x21, 0xc7, 0xb2, 0xcb, 0x45,
+    0xb5, 0x74, 0xb2, 0x60, 0xac, 0x62, 0xa7, 0x80, 0x40, 0xb6, 0x46, 0xc3, 0x60, 0x16, 0x7c, 0x9a,
+    0x99, 0x9e, 0xd7, 0x33, 0xe2, 0x80, 0x0e, 0xff, 0x51, 0xfc, 0x10, 0xef, 0xc7, 0xe7, 0x73, 0xfd,
+    0x1d, 0xe4, 0x62, 0x7f, 0x47, 0xa5, 0xe0, 0x0b, 0xc6, 0x5e, 0xde, 0xe5, 0xbe, 0xcb, 0x07, 0x82,
+    0x4f, 0x38, 0x73, 0x91, 0x65, 0xc4, 0x03, 0x73, 0xdb, 0x92, 0x73, 0xe2, 0x8b, 0x83, 0xda, 0x5f,
+    0xe3, 0xe6, 0x54, 0xfd, 0x6c, 0xf7, 0x82, 0x6b, 0x9a, 0x5d, 0xaa, 0x47, 0xd5, 0xcf, 0x7e, 0xc9,
+    0x8a, 0xf8, 0xd9, 0x3c, 0xdc, 0xc5, 0x56, 0x08, 0x87, 0x98, 0xc1, 0x78, 0xad, 0xf6, 0x17, 0x59,
+    0xd6, 0x99, 0x1d, 0xa5, 0x4d, 0x69, 0xd3, 0x38, 0x6e, 0xf6, 0x21, 0x80, 0x64, 0xef, 0x58, 0xfe,
+    0x13, 0x7f, 0x1d, 0x7d, 0x96, 0x67, 0xe5, 0xc8, 0x7f, 0xfb, 0xb6, 0x07, 0xe3, 0xce, 0xea, 0xea,
+    0x6d, 0xc3, 0x81, 0x7c, 0x12, 0xdf, 0x75, 0x2c, 0xba, 0x72, 0x2c, 0x3b, 0xc3, 0x65, 0x1c, 0x4d,
+    0x33, 0xe6, 0x4e, 0xf4, 0xb1, 0x86, 0xbf, 0x53, 0xfc, 0x07, 0x17, 0xec, 0xdc, 0xe7, 0xbd, 0xa6,
+    0xf1, 0x6f, 0xd0, 0x2c, 0xff, 0x22, 0x77, 0xb4, 0x7d, 0xea, 0xcf, 0xa6, 0x79, 0x18, 0xe0, 0xff,
+    0x0c, 0xdf, 0x03, 0xde, 0x54, 0xdf, 0x91, 0x06, 0x6e, 0x1d, 0xc1, 0xcd, 0x9e, 0x85, 0xf9, 0xf4,
+    0x0e, 0x58, 0xbc, 0x13, 0x94, 0x6b, 0x4c, 0x6f, 0x27, 0xf2, 0x86, 0xbf, 0xa0, 0x7b, 0x09, 0x46,
+    0xfb, 0xbe, 0x17, 0x9e, 0xc7, 0x80, 0xce, 0xd7, 0xaf, 0x77, 0xfb, 0x1d, 0xe9, 0x0f, 0xbc, 0x4f,
+    0x06, 0x10, 0xac, 0x49, 0x8e, 0x1e, 0xb0, 0xeb, 0xec, 0xcf, 0x64, 0x6d, 0x90, 0xa9, 0x11, 0x97,
+    0xbc, 0x5a, 0x2f, 0x69, 0xbc, 0xcd, 0xf3, 0x5a, 0x52, 0x04, 0xc7, 0x73, 0x5c, 0xd8, 0xb2, 0x8d,
+    0x21, 0x80, 0x69, 0xa2, 0xa3, 0x4c, 0xe9, 0x9d, 0xcb, 0xc6, 0x44, 0x36, 0xa6, 0xf1, 0x65, 0xf8,
+    0xc7, 0xb1, 0x07, 0x68, 0xad, 0x97, 0x62, 0xe8, 0xb7, 0xf4, 0x16, 0x00, 0xf8, 0x5d, 0xfd, 0x1a,
+    0xd7, 0xff, 0x18, 0x8a, 0xf6, 0xfc, 0x67, 0xad, 0xa2, 0xf7, 0x00, 0xe8, 0x39, 0x9b, 0xf9, 0xf8,
+    0x73, 0x39, 0xad, 0x11, 0x78, 0xaf, 0xd0, 0xfd, 0x8d, 0xb8, 0x2d, 0xde, 0x3e, 0x39, 0x26, 0xba,
+    0xe8, 0x8b, 0x6c, 0xa4, 0x33, 0xf6, 0x93, 0x77, 0xdd, 0xea, 0x47, 0x19, 0x99, 0xaf, 0xc2, 0xe9,
+    0x07, 0x63, 0xe2, 0x6b, 0x7c, 0xcc, 0xad, 0xd3, 0xce, 0xfe, 0x56, 0xde, 0x98, 0x2f, 0x7f, 0xe7,
+    0x25, 0x79, 0x5a, 0x75, 0x7b, 0x1d, 0x5d, 0x17, 0x64, 0xe4, 0x16, 0xe6, 0x1e, 0x64, 0xff, 0x7e,
+    0xca, 0xdc, 0xad, 0x3d, 0xdf, 0x47, 0xf7, 0x4a, 0xe7, 0xfc, 0x9e, 0x5c, 0x5f, 0xf5, 0x2b, 0xdf,
+    0x5c, 0x6b, 0xad, 0x63, 0x1b, 0x91, 0x37, 0x35, 0x0e, 0x78, 0xd8, 0x1e, 0x9f, 0xe2, 0x2c, 0x82,
+    0xad, 0xe7, 0x6a, 0xee, 0xb2, 0x3f, 0x86, 0xf0, 0x70, 0x5f, 0xab, 0x1b, 0x6e, 0x77, 0x38, 0x24,
+    0x06, 0x72, 0x70, 0x9b, 0x7f, 0x6a, 0x31, 0xc7, 0xa2, 0x44, 0x1a, 0xe5, 0x2a, 0xc7, 0x73, 0x3f,
+    0x6e, 0x1e, 0xf7, 0x1c, 0xb3, 0x6f, 0x79, 0xb8, 0xf8, 0xbb, 0x5e, 0xc0, 0x81, 0xf2, 0xf9, 0x6e,
+    0xae, 0x50, 0x9e, 0x63, 0x2f, 0x24, 0x1f, 0x1b, 0xca, 0x04, 0x83, 0xc5, 0x3e, 0x5d, 0xf9, 0x28,
+    0xba, 0x5d, 0x7e, 0x77, 0x2c, 0xf9, 0x12, 0x1e, 0xfb, 0xda, 0x17, 0xef, 0xfe, 0x35, 0x86, 0x63,
+    0x7d, 0xf8, 0xc6, 0x2d, 0x0f, 0xe0, 0xcc, 0xc5, 0x2d, 0xef, 0x96, 0xe9, 0x56, 0x0b, 0x38, 0x9f,
+    0xda, 0x97, 0xc4, 0x40, 0xec, 0xcc, 0xbe, 0x51, 0xd6, 0x6d, 0x6e, 0x4f, 0x2a, 0x4a, 0x84, 0xce,
+    0xd8, 0xfb, 0xb3, 0x06, 0xaa, 0xfc, 0x28, 0x0e, 0xea, 0x4c, 0x27, 0xd6, 0x9e, 0x81, 0xa0, 0x75,
+    0x16, 0x2a, 0xce, 0xd8, 0x28, 0xff, 0xe8, 0xa1, 0x61, 0x34, 0xc4, 0x26, 0x75, 0x9f, 0x12, 0x6f,
+    0x01, 0x3a, 0x08, 0x82, 0x60, 0x5e, 0xc4, 0xf0, 0x7d, 0x69, 0xef, 0x76, 0xd1, 0x0c, 0xf7, 0x95,
+    0xc2, 0xbe, 0x92, 0xea, 0xfe, 0x28, 0xdf, 0xee, 0x11, 0xea, 0xf6, 0xac, 0xd0, 0x81, 0xfb, 0x68,
+    0x80, 0x81, 0xd9, 0x41, 0xc9, 0xf6, 0x58, 0xa1, 0xcb, 0xcd, 0xdd, 0x51, 0xed, 0xd1, 0x96, 0xdb,
+    0xa9, 0x66, 0x1e, 0xe1, 0xf7, 0xbf, 0x13, 0xdf, 0x9b, 0x55, 0xe1, 0x02, 0x97, 0xf6, 0xfd, 0x96,
+    0x3d, 0x63, 0x6e, 0x39, 0xff, 0x0a, 0x31, 0x4c, 0xc1, 0x16, 0x60, 0xf0, 0x8f, 0x37, 0x78, 0x33,
+    0x03, 0xee, 0x22, 0x82, 0x64, 0xee, 0xbf, 0x5e, 0x63, 0x31, 0x6f, 0xb0, 0xdc, 0x85, 0x30, 0x31,
+    0x79, 0x6e, 0x0c, 0x2c, 0xe1, 0x92, 0x2d, 0x75, 0xb4, 0x7a, 0x7b, 0x82, 0x3f, 0x9d, 0x0b, 0x7e,
+    0x37, 0xfe, 0xd4, 0xe4, 0x72, 0x23, 0x8a, 0xc3, 0xd5, 0x9f, 0x14, 0x27, 0x45, 0xf9, 0xd3, 0x8c,
+    0x38, 0xf6, 0x3f, 0x2f, 0xe0, 0x1e, 0x35, 0x52, 0xc1, 0x7c, 0xe9, 0x98, 0xa9, 0xf6, 0xe2, 0x99,
+    0xb4, 0x05, 0xfb, 0xc0, 0xc0, 0x7e, 0xbd, 0xd6, 0x43, 0x61, 0xe9, 0x21, 0xd2, 0x5d, 0xd2, 0xa4,
+    0x81, 0xf4, 0xa2, 0x27, 0xba, 0x98, 0xa2, 0x2e, 0xec, 0xbb, 0x71, 0x76, 0xb6, 0xb7, 0x13, 0x79,
+    0xae, 0x0f, 0x56, 0xf2, 0x5f, 0xd1, 0xf7, 0xad, 0x49, 0x94, 0xab, 0x71, 0xec, 0x41, 0x0f, 0x4d,
+    0x9f, 0x53, 0xf1, 0x1b, 0x72, 0x62, 0x1f, 0x34, 0x9c, 0x5b, 0xb4, 0xe9, 0x2f, 0xac, 0x95, 0xe4,
+    0x45, 0xb6, 0x1b, 0x9a, 0x3c, 0x62, 0x7c, 0xad, 0x20, 0x71, 0x2f, 0x93, 0xdb, 0xa2, 0xcc, 0xc4,
+    0x27, 0xe1, 0x80, 0x2c, 0x69, 0x81, 0xbc, 0x0f, 0x0b, 0xf4, 0x50, 0x7d, 0x9c, 0x57, 0xfd, 0xe9,
+    0x57, 0x7f, 0x15, 0xae, 0x5e, 0xac, 0xde, 0xb7, 0x2e, 0x75, 0xce, 0xeb, 0x12, 0x61, 0x84, 0x9d,
+    0x0c, 0x98, 0xdb, 0x38, 0xc9, 0x7b, 0xec, 0xbc, 0x0d, 0x25, 0xbe, 0x0f, 0xfa, 0x6e, 0xe9, 0x21,
+    0x7c, 0x06, 0xcd, 0xf7, 0xdb, 0x70, 0x7f, 0xfe, 0x06, 0x75, 0x48, 0x59, 0xb9, 0xb5, 0x70, 0x87,
+    0xa9, 0x9c, 0x0b, 0x40, 0xf5, 0x80, 0x40, 0xbe, 0x23, 0xe2, 0x0c, 0xa6, 0x65, 0xce, 0xe0, 0x34,
+    0xd7, 0x37, 0x98, 0x5b, 0x7c, 0xd8, 0xdf, 0x93, 0x5d, 0x41, 0x57, 0x3d, 0x78, 0x75, 0xfe, 0xc8,
+    0x70, 0xee, 0xef, 0xa7, 0x38, 0x8d, 0x6b, 0x3e, 0xce, 0xce, 0x55, 0x71, 0xb9, 0xc4, 0x59, 0x12,
+    0x03, 0x6f, 0x82, 0xc7, 0x05, 0xda, 0x14, 0xb3, 0x1a, 0xdb, 0x00, 0x0b, 0x18, 0x76, 0xce, 0xc6,
+    0xa3, 0x69, 0x7a, 0x84, 0x83, 0xc4, 0x28, 0x82, 0xd5, 0x2f, 0x2f, 0x4b, 0x0d, 0x65, 0x3b, 0xfb,
+    0xa2, 0x1c, 0x3b, 0xa9, 0xba, 0x3d, 0x14, 0xe3, 0x65, 0x60, 0x3c, 0x2a, 0xad, 0x99, 0x31, 0xb1,
+    0x38, 0xef, 0xb0, 0xe8, 0xbe, 0x40, 0xe4, 0xbd, 0x6d, 0xa8, 0x35, 0x8c, 0x7a, 0x59, 0x09, 0x30,
+    0x34, 0x51, 0xc8, 0xc7, 0xcf, 0x7e, 0xc3, 0xda, 0x68, 0x6b, 0x23, 0xbf, 0x4a, 0x1a, 0x56, 0x3e,
+    0x07, 0x65, 0x51, 0xdb, 0x1c, 0xc0, 0xe4, 0x7f, 0x2c, 0x8f, 0x93, 0x9f, 0x8d, 0x3e, 0xa5, 0x87,
+    0xdd, 0x51, 0x39, 0x86, 0x08, 0x93, 0xbb, 0xc1, 0x2e, 0x2c, 0x52, 0xd7, 0xf0, 0x33, 0x29, 0x6c,
+    0xf6, 0xc3, 0xd8, 0xf3, 0x84, 0x4e, 0x17, 0x50, 0x4e, 0x57, 0xe3, 0x88, 0x73, 0x80, 0xd5, 0xdf,
+    0x3c, 0x4c, 0x71, 0xc0, 0x28, 0xc7, 0x8c, 0xb2, 0xad, 0x24, 0x7c, 0xe3, 0xf9, 0x03, 0x65, 0x52,
+    0xcd, 0xd6, 0x94, 0xa3, 0xa1, 0x7f, 0xa7, 0xa1, 0x9e, 0x93, 0x4d, 0x70, 0x9f, 0x6b, 0x11, 0xc0,
+    0x86, 0xe9, 0xdd, 0x11, 0x53, 0x8e, 0x81, 0x81, 0x41, 0xa7, 0x8d, 0xcd, 0x26, 0xca, 0x3a, 0x9e,
+    0x8d, 0x7e, 0x05, 0xf4, 0xbe, 0xf9, 0xb3, 0x8c, 0xa7, 0x08, 0x8c, 0x8c, 0xf4, 0x4a, 0x59, 0xd3,
+    0xac, 0x5a, 0x65, 0x29, 0xcd, 0x1d, 0x91, 0x6e, 0xce, 0x10, 0x7b, 0x49, 0x2b, 0x8b, 0x8c, 0xb4,
+    0xbc, 0x05, 0x0b, 0xce, 0x6b, 0x44, 0x92, 0xc4, 0x4f, 0x98, 0x3a, 0xc8, 0x3f, 0xa0, 0x0b, 0x07,
+    0x20, 0xb8, 0xaf, 0x51, 0x1e, 0x6f, 0xba, 0xcb, 0x99, 0xab, 0x59, 0x43, 0x7e, 0x9a, 0x77, 0x42,
+    0xd7, 0x67, 0x23, 0x76, 0xb3, 0x1f, 0x42, 0x62, 0xcc, 0x8e, 0x45, 0x0f, 0xe2, 0xa9, 0x68, 0xdc,
+    0x37, 0x7b, 0x4b, 0xe1, 0x32, 0xe8, 0xa0, 0xbe, 0x27, 0x9b, 0xbe, 0x52, 0xba, 0xb1, 0xcb, 0xaf,
+    0x2a, 0xed, 0x69, 0x3f, 0x6b, 0x7c, 0x64, 0x9e, 0x09, 0xc4, 0xad, 0xb3, 0x30, 0x66, 0xb7, 0x93,
+    0xab, 0x2f, 0xce, 0x1e, 0xd2, 0xa5, 0xbf, 0x52, 0x91, 0x5f, 0x0c, 0xef, 0x67, 0xe4, 0xab, 0x6f,
+    0xae, 0xe9, 0xe6, 0xda, 0xd6, 0x74, 0x75, 0xd9, 0xe8, 0x0c, 0x58, 0x1b, 0xdc, 0x9b, 0xd8, 0xdc,
+    0xbb, 0x2f, 0x2c, 0x33, 0x08, 0xdb, 0x2b, 0x2e, 0xdd, 0xc5, 0x1d, 0xf1, 0x52, 0x5a, 0xd8, 0x97,
+    0x78, 0xbb, 0xd8, 0xf7, 0x0b, 0x08, 0x90, 0x5b, 0x9e, 0x02, 0x6f, 0x6c, 0x82, 0xa3, 0x8d, 0x0a,
+    0xc9, 0x4d, 0x9e, 0x92, 0xd3, 0xeb, 0xb9, 0xd9, 0x72, 0x6f, 0x66, 0x75, 0x4c, 0x07, 0x51, 0x0e,
+    0xec, 0x1e, 0x8b, 0x3a, 0x48, 0xef, 0xa8, 0xd2, 0xad, 0x5d, 0xdd, 0x74, 0xe4, 0x13, 0xd5, 0xbb,
+    0xab, 0x06, 0x94, 0xe6, 0xf3, 0xa6, 0xc0, 0xbc, 0x04, 0x1d, 0xd3, 0x5b, 0x4f, 0x79, 0x67, 0xbf,
+    0xc2, 0x00, 0xd3, 0xf3, 0x34, 0xc3, 0x23, 0xa7, 0xd0, 0x93, 0x6b, 0x0d, 0xfc, 0x1f, 0x39, 0x8d,
+    0x7d, 0xca, 0xbc, 0xbf, 0xeb, 0x76, 0xf7, 0xc3, 0x40, 0x3b, 0x43, 0x4a, 0x65, 0x32, 0x26, 0x99,
+    0x79, 0xed, 0x14, 0xeb, 0x8b, 0x22, 0x9e, 0x59, 0xe9, 0xcd, 0x7e, 0x61, 0xf7, 0x06, 0x7e, 0xa2,
+    0x84, 0x89, 0xba, 0x60, 0xb2, 0xc1, 0x41, 0x10, 0x24, 0x2b, 0x57, 0xa1, 0x61, 0xf8, 0x79, 0x14,
+    0xc2, 0xd4, 0x7c, 0xb2, 0x77, 0x33, 0xfe, 0xf9, 0xe3, 0x9b, 0x2b, 0x39, 0xa4, 0x3f, 0x1b, 0xf7,
+    0x59, 0x33, 0xb7, 0xe3, 0x42, 0x2c, 0x46, 0x6c, 0x7c, 0x66, 0x71, 0xe7, 0xb2, 0xd5, 0x6e, 0xe1,
+    0x31, 0xcb, 0x44, 0x1e, 0x09, 0xd3, 0x1c, 0xfe, 0x2c, 0xe5, 0xe4, 0x14, 0x77, 0x59, 0x84, 0x77,
+    0x22, 0x11, 0x62, 0xdb, 0x35, 0x59, 0xcd, 0x3a, 0x9b, 0x19, 0x7d, 0x60, 0xf4, 0x4f, 0xab, 0xf7,
+    0x66, 0x84, 0xde, 0x60, 0xfd, 0x2c, 0x97, 0x06, 0xfa, 0xdc, 0x3c, 0x75, 0xa3, 0xfd, 0x14, 0x75,
+    0xee, 0x3e, 0xa4, 0x84, 0x6f, 0x86, 0x94, 0x6b, 0x20, 0x13, 0x54, 0x0b, 0xde, 0x36, 0x75, 0x00,
+    0x33, 0x81, 0xe9, 0x3b, 0x1a, 0x04, 0x74, 0xc4, 0xba, 0xf8, 0xdb, 0xac, 0xce, 0x19, 0x97, 0xd1,
+    0xcd, 0x6b, 0x5e, 0xaf, 0x95, 0xe7, 0xc4, 0x21, 0x10, 0x80, 0xe0, 0x49, 0x0e, 0x6f, 0x47, 0x7b,
+    0xf6, 0x4a, 0x9a, 0x1c, 0xdc, 0x4f, 0xe0, 0x91, 0xe7, 0xdd, 0xd3, 0x5c, 0x92, 0xed, 0x7b, 0xf3,
+    0x62, 0x64, 0xce, 0x59, 0x32, 0xb8, 0x4a, 0x69, 0xcd, 0x07, 0x88, 0xa1, 0xe5, 0x8f, 0xed, 0x47,
+    0xbe, 0x57, 0x8e, 0x1a, 0x3d, 0xe1, 0xc1, 0x78, 0x50, 0xf0, 0xd6, 0x06, 0x75, 0x05, 0x28, 0x56,
+    0x9e, 0x83, 0x83, 0xdf, 0x51, 0xe0, 0x13, 0xac, 0x82, 0xfd, 0x47, 0x4b, 0x18, 0x9a, 0x3f, 0x27,
+    0x78, 0x50, 0x32, 0x8f, 0xb5, 0x8e, 0x1f, 0x76, 0x5f, 0x43, 0xa9, 0xfe, 0x32, 0xcc, 0xb9, 0x8c,
+    0x8e, 0xbf, 0x1e, 0x94, 0x2b, 0xed, 0xda, 0x92, 0x32, 0xf2, 0x46, 0xd0, 0xa6, 0x5b, 0x6b, 0x07,
+    0x6e, 0xfe, 0x3f, 0x8c, 0xe2, 0x49, 0x3b, 0x9c, 0xd4, 0x62, 0xee, 0x5e, 0x90, 0x54, 0x79, 0x50,
+    0x7a, 0xe4, 0x27, 0x75, 0x27, 0xf4, 0xff, 0x61, 0xf8, 0x39, 0xd8, 0xe3, 0x0a, 0x3e, 0xf6, 0x16,
+    0x9a, 0x25, 0xa0, 0xc3, 0xfd, 0x57, 0xa4, 0xd4, 0x15, 0xc0, 0xaf, 0xf0, 0x8f, 0x1c, 0xe4, 0xd0,
+    0xd5, 0x18, 0x81, 0xed, 0x2f, 0x17, 0x20, 0x87, 0x43, 0x54, 0xab, 0xf9, 0x88, 0xfb, 0x20, 0x9c,
+    0x22, 0xa8, 0x14, 0x7b, 0x8e, 0xad, 0x98, 0xe4, 0x74, 0xd1, 0xc6, 0xa7, 0xde, 0xdd, 0xd6, 0x08,
+    0x64, 0x3c, 0x64, 0xa9, 0x0e, 0x8e, 0xec, 0xbc, 0x14, 0x1b, 0x3e, 0xef, 0x59, 0x8a, 0x2f, 0x6c,
+    0x6c, 0x0a, 0xf4, 0x3f, 0x07, 0x6c, 0x78, 0xe6, 0xa5, 0xfc, 0x80, 0x1d, 0x62, 0xd6, 0xea, 0x9e,
+    0x34, 0xf2, 0x32, 0x5c, 0xdb, 0x50, 0x44, 0xfb, 0x20, 0x0a, 0xfd, 0x90, 0x0b, 0xdc, 0x78, 0xca,
+    0x0d, 0x0c, 0xb9, 0xa8, 0xce, 0x16, 0x7c, 0xef, 0x43, 0xd0, 0xeb, 0xf9, 0x87, 0xa6, 0xf7, 0x93,
+    0x95, 0xb9, 0xd3, 0x4f, 0x9a, 0x5c, 0xa2, 0xa3, 0xcf, 0xf8, 0xb9, 0x6e, 0x8a, 0xbc, 0xbc, 0x8b,
+    0xe0, 0xb0, 0x5f, 0x10, 0xed, 0x5f, 0x48, 0x33, 0xf9, 0x63, 0xbe, 0xd5, 0x6d, 0x5d, 0xd6, 0xaf,
+    0x75, 0xf3, 0x0e, 0x71, 0x35, 0xd4, 0x6b, 0x71, 0x0e, 0x76, 0x51, 0xa7, 0x07, 0xa5, 0xba, 0x98,
+    0x77, 0x17, 0x08, 0xe5, 0x48, 0x33, 0x94, 0xb4, 0x65, 0xee, 0x78, 0xa8, 0xac, 0xb1, 0xf0, 0xe3,
+    0xcf, 0x61, 0xa8, 0xae, 0x42, 0x68, 0xf6, 0xbb, 0xb0, 0x37, 0xe3, 0x38, 0xab, 0x8d, 0x43, 0xef,
+    0x19, 0xe7, 0x5f, 0x82, 0x5e, 0xcd, 0x3f, 0x9c, 0x44, 0x93, 0x2f, 0xf1, 0xa6, 0x97, 0xe0, 0xb2,
+    0x77, 0xfd, 0xb5, 0xc2, 0x41, 0x74, 0x31, 0x87, 0xd4, 0xd1, 0x1d, 0xb4, 0x90, 0xf0, 0xf9, 0x0b,
+    0xbe, 0xdc, 0xd2, 0xe5, 0x54, 0x72, 0x9b, 0x37, 0xd5, 0xf4, 0xe4, 0x2f, 0xc8, 0xcd, 0xef, 0x33,
+    0xf1, 0x43, 0xfe, 0xab, 0xb3, 0xdd, 0x5f, 0xec, 0xe3, 0x37, 0x1e, 0x7e, 0xe9, 0x92, 0x35, 0xea,
+    0x97, 0x6e, 0xce, 0x1c, 0x0a, 0x8c, 0x49, 0x8a, 0x25, 0x4d, 0x3c, 0x55, 0x7a, 0x1c, 0x16, 0x40,
+    0x2d, 0x49, 0x03, 0xfe, 0xb7, 0xd5, 0x7f, 0x81, 0x35, 0x48, 0xd5, 0x3b, 0x1b, 0x9b, 0xbb, 0xf1,
+    0xac, 0x20, 0x99, 0xb2, 0x38, 0x47, 0x42, 0x78, 0x4c, 0xd5, 0x37, 0xd7, 0xcb, 0x81, 0xa3, 0x30,
+    0xfd, 0x25, 0xb8, 0xf0, 0xc9, 0xc7, 0x4e, 0xf7, 0x57, 0xda, 0xd5, 0xc5, 0x14, 0x3f, 0xe0, 0x55,
+    0xac, 0xd8, 0xd1, 0xb3, 0xfe, 0xd7, 0xfb, 0x4d, 0xa2, 0x17, 0x74, 0x69, 0x95, 0x57, 0x80, 0x87,
+    0x22, 0x77, 0xff, 0xfb, 0x42, 0x17, 0x56, 0x89, 0xcc, 0x19, 0x57, 0xd2, 0x4c, 0x7d, 0x04, 0xae,
+    0x92, 0x1a, 0x6c, 0xd7, 0x79, 0x6a, 0xc4, 0xe3, 0x2b, 0xc8, 0x53, 0xab, 0x7d, 0xb8, 0x85, 0xad,
+    0x11, 0xcc, 0x4c, 0xfe, 0x58, 0x87, 0x2a, 0x61, 0xc3, 0x50, 0x1b, 0x55, 0x3e, 0x48, 0x18, 0xfb,
+    0x13, 0xab, 0x05, 0xc3, 0xfe, 0x84, 0x89, 0x67, 0xa6, 0x1e, 0xe9, 0x75, 0x56, 0x0f, 0xe6, 0xd2,
+    0x3b, 0x96, 0xf0, 0xd5, 0x3b, 0xff, 0x54, 0x6f, 0x67, 0x8e, 0x96, 0x20, 0x82, 0x81, 0x4b, 0x0f,
+    0xaf, 0x07, 0xaf, 0x74, 0x67, 0x7e, 0xc4, 0x99, 0x61, 0x3e, 0xef, 0x43, 0x9e, 0x6c, 0x2f, 0x91,
+    0x89, 0x89, 0x0e, 0x3c, 0xfe, 0x03, 0x2f, 0xde, 0x1b, 0xb1, 0xff, 0xf8, 0xc2, 0x90, 0xce, 0x8e,
+    0xef, 0x9f, 0xb9, 0x96, 0x08, 0xdc, 0x85, 0x43, 0xb8, 0xb6, 0x75, 0x10, 0xe8, 0x40, 0xe8, 0x29,
+    0x1f, 0x59, 0x9b, 0x97, 0xa2, 0x7b, 0x3a, 0x51, 0x2d, 0xa2, 0x3e, 0x38, 0x3d, 0x44, 0x1a, 0x3d,
+    0xda, 0x0a, 0x0d, 0x86, 0xd8, 0xe5, 0xd5, 0xf1, 0x04, 0xdc, 0x93, 0x95, 0xe6, 0x48, 0xd7, 0xa0,
+    0xd5, 0xde, 0x9c, 0x5d, 0xdc, 0x75, 0xcb, 0xcd, 0xf2, 0x82, 0xfb, 0x6d, 0x23, 0xd4, 0x56, 0xb1,
+    0x7a, 0x26, 0x1e, 0x84, 0x44, 0xb7, 0x3d, 0xca, 0x5f, 0x36, 0xaf, 0xb8, 0x97, 0x86, 0x1e, 0x83,
+    0xc4, 0x24, 0xc1, 0x7a, 0xaf, 0xc1, 0x6a, 0x5f, 0x96, 0x48, 0xe3, 0x94, 0x3f, 0x9e, 0x03, 0x14,
+    0x72, 0x60, 0x20, 0x4c, 0x58, 0xba, 0x11, 0xf2, 0x25, 0xc5, 0x35, 0x23, 0x08, 0x04, 0x66, 0xc6,
+    0x35, 0x90, 0x12, 0xc8, 0xf0, 0x80, 0x31, 0xf3, 0xf0, 0x31, 0x64, 0xfc, 0xae, 0x40, 0x9d, 0xb7,
+    0x85, 0x28, 0x84, 0xc2, 0x06, 0x2d, 0x16, 0xf1, 0x8f, 0xc9, 0xbc, 0x1d, 0x40, 0xa6, 0xa7, 0x87,
+    0x69, 0xa6, 0xdc, 0xbb, 0x17, 0x83, 0x1b, 0x97, 0xf9, 0x1b, 0x20, 0x23, 0x43, 0x7e, 0x1f, 0x2a,
+    0xb8, 0x31, 0x6d, 0xc1, 0xda, 0x0f, 0x4e, 0x2d, 0x06, 0x86, 0x2d, 0x6e, 0x3f, 0x26, 0xc0, 0x1d,
+    0xe6, 0xdf, 0x97, 0x5b, 0x2b, 0xad, 0xb8, 0x15, 0x7f, 0x57, 0x6f, 0xb3, 0xab, 0xce, 0xcb, 0x76,
+    0x23, 0xef, 0x1f, 0x27, 0x11, 0x3a, 0xfe, 0x51, 0xed, 0x0a, 0xad, 0x0c, 0x9f, 0x10, 0x0c, 0xc4,
+    0xd6, 0x07, 0xec, 0xf0, 0x80, 0x29, 0x19, 0x78, 0xb7, 0x5f, 0xaa, 0x32, 0x7c, 0xb4, 0x64, 0x88,
+    0x7a, 0x96, 0x15, 0x19, 0x6e, 0x38, 0xba, 0xe4, 0x28, 0x5f, 0x54, 0x9f, 0x4b, 0x52, 0x4e, 0xe9,
+    0xc5, 0x44, 0x42, 0xf5, 0x89, 0xa4, 0x31, 0x5f, 0xaa, 0xfb, 0x03, 0xb5, 0x2c, 0x7d, 0x45, 0x25,
+    0x18, 0x89, 0xfe, 0x9d, 0x79, 0x99, 0x88, 0xe5, 0xfd, 0x3d, 0x58, 0x73, 0xcc, 0xde, 0x50, 0x13,
+    0xb7, 0x45, 0xb6, 0x36, 0x17, 0xa3, 0x5e, 0x06, 0xc3, 0x8f, 0x89, 0x04, 0x4f, 0xff, 0x69, 0x2b,
+    0x2d, 0xac, 0x75, 0x63, 0x1b, 0x63, 0x6a, 0x2d, 0xc6, 0xa3, 0x44, 0x6e, 0xb9, 0x22, 0xf0, 0x59,
+    0x22, 0xf7, 0xfb, 0x4a, 0xe1, 0xd3, 0x71, 0x18, 0xf9, 0xdc, 0x6f, 0x05, 0x39, 0xee, 0x1d, 0xc8,
+    0x5f, 0x9c, 0x61, 0x81, 0x3b, 0xa1, 0x5c, 0x4e, 0xcf, 0xed, 0xff, 0xa0, 0xe2, 0xf5, 0x07,
 };
+const ShaderModule Blob080 = { Blob080_Data, 6959u, 6687u, 80u };
 
 } // namespace detail
 } // namespace VulkanShaders
@@ -28,13 +28,12 @@
     Pipeline indices match ComputeRenderer3D::ShaderCompileStep() in
     src/GPU3D_Compute.cpp one for one.
 
-    The SPIR-V words live in per-stage translation units rather than in the
-    header so that including the public header stays cheap: the full module set
-    is a few megabytes of integer literals and would otherwise be re-parsed by
-    every consumer.
+    Every module is one zstd frame, inflated on first use by
+    Vk::InflateShaderModule(). The frames live in per-stage translation units
+    rather than in the header so that including the public header stays cheap.
 */
 
-// SPIR-V for src/GPU3D_Vulkan_shaders/Resolve.comp.
+// SPIR-V for src/GPU3D_Vulkan_shaders/Resolve.comp, one zstd frame per module.
 
 #include "GPU3D_Vulkan_ShaderBlobs.h"
 
@@ -45,560 +44,371 @@ namespace VulkanShaders
 namespace detail
 {
 
-extern const uint32_t Blob033[1448];
-const uint32_t Blob033[1448] = {
-    0x07230203, 0x00010300, 0x0008000b, 0x000000b8, 0x00000000, 0x00020011, 0x00000001, 0x0006000b,
-    0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001,
-    0x0006000f, 0x00000005, 0x00000004, 0x6e69616d, 0x00000000, 0x0000005c, 0x00060010, 0x00000004,
-    0x00000011, 0x00000008, 0x00000008, 0x00000001, 0x00030003, 0x00000002, 0x000001c2, 0x000a0004,
-    0x475f4c47, 0x4c474f4f, 0x70635f45, 0x74735f70, 0x5f656c79, 0x656e696c, 0x7269645f, 0x69746365,
-    0x00006576, 0x00080004, 0x475f4c47, 0x4c474f4f, 0x6e695f45, 0x64756c63, 0x69645f65, 0x74636572,
-    0x00657669, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000, 0x00070005, 0x0000000a, 0x726f6e55,
-    0x6f54386d, 0x36626752, 0x3b317528, 0x00000000, 0x00040005, 0x00000009, 0x756c6176, 0x00000065,
-    0x00070005, 0x0000000d, 0x726f6e55, 0x6f54386d, 0x68706c41, 0x75283561, 0x00003b31, 0x00040005,
-    0x0000000c, 0x756c6176, 0x00000065, 0x00070005, 0x00000014, 0x64616f4c, 0x616e6946, 0x2842466c,
-    0x3b326976, 0x00000000, 0x00050005, 0x00000013, 0x69736f70, 0x6e6f6974, 0x00000000, 0x00040005,
-    0x00000029, 0x65786574, 0x0000006c, 0x00040005, 0x0000002c, 0x616e6946, 0x0042466c, 0x00050005,
-    0x00000032, 0x6e617571, 0x657a6974, 0x00000064, 0x00040005, 0x00000038, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000003d, 0x61726170, 0x0000006d, 0x00040005, 0x00000045, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000004d, 0x61726170, 0x0000006d, 0x00030005, 0x00000059, 0x00006469, 0x00080005,
-    0x0000005c, 0x475f6c67, 0x61626f6c, 0x766e496c, 0x7461636f, 0x496e6f69, 0x00000044, 0x00050005,
-    0x0000006f, 0x4f74756f, 0x65736666, 0x00000074, 0x00040005, 0x00000076, 0x746e6563, 0x00006572,
-    0x00050005, 0x00000077, 0x65726353, 0x69576e65, 0x00687464, 0x00050005, 0x00000079, 0x6c616353,
-    0x63614665, 0x00726f74, 0x00040005, 0x0000007c, 0x72756f73, 0x00006563, 0x00090005, 0x00000085,
-    0x73657250, 0x61746e65, 0x6e6f6974, 0x7074754f, 0x75427475, 0x72656666, 0x00000000, 0x00080006,
-    0x00000085, 0x00000000, 0x73657250, 0x61746e65, 0x6e6f6974, 0x7074754f, 0x00007475, 0x00030005,
-    0x00000087, 0x00000000, 0x00040005, 0x0000008c, 0x61726170, 0x0000006d, 0x00060005, 0x00000090,
-    0x65726353, 0x65486e65, 0x74686769, 0x00000000, 0x00060005, 0x00000091, 0x5778614d, 0x546b726f,
-    0x73656c69, 0x00000000, 0x00070005, 0x00000094, 0x6d617246, 0x66756265, 0x53726566, 0x64697274,
-    0x00000065, 0x00060005, 0x00000095, 0x656c6954, 0x72655073, 0x656e694c, 0x00000000, 0x00050005,
-    0x00000096, 0x656c6954, 0x656e694c, 0x00000073, 0x00050005, 0x0000009c, 0x6174654d, 0x66696e55,
-    0x006d726f, 0x00060006, 0x0000009c, 0x00000000, 0x506d754e, 0x67796c6f, 0x00736e6f, 0x00060006,
-    0x0000009c, 0x00000001, 0x566d754e, 0x61697261, 0x0073746e, 0x00060006, 0x0000009c, 0x00000002,
-    0x68706c41, 0x66655261, 0x00000000, 0x00050006, 0x0000009c, 0x00000003, 0x70736944, 0x00746e43,
-    0x00060006, 0x0000009c, 0x00000004, 0x6e6f6f54, 0x6c626154, 0x00000065, 0x00060006, 0x0000009c,
-    0x00000005, 0x61656c43, 0x6c6f4372, 0x0000726f, 0x00060006, 0x0000009c, 0x00000006, 0x61656c43,
-    0x70654472, 0x00006874, 0x00060006, 0x0000009c, 0x00000007, 0x61656c43, 0x74744172, 0x00000072,
-    0x00060006, 0x0000009c, 0x00000008, 0x4f676f46, 0x65736666, 0x00000074, 0x00060006, 0x0000009c,
-    0x00000009, 0x53676f46, 0x74666968, 0x00000000, 0x00060006, 0x0000009c, 0x0000000a, 0x43676f46,
-    0x726f6c6f, 0x00000000, 0x00080006, 0x0000009c, 0x0000000b, 0x61656c43, 0x74694272, 0x4f70616d,
-    0x65736666, 0x00000074, 0x00030005, 0x0000009e, 0x00000000, 0x00060005, 0x0000009f, 0x68737550,
-    0x736e6f43, 0x746e6174, 0x00000073, 0x00060006, 0x0000009f, 0x00000000, 0x56727543, 0x61697261,
-    0x0000746e, 0x00060006, 0x0000009f, 0x00000001, 0x57786554, 0x68746469, 0x00000000, 0x00060006,
-    0x0000009f, 0x00000002, 0x48786554, 0x68676965, 0x00000074, 0x00060006, 0x0000009f, 0x00000003,
-    0x57786554, 0x53706172, 0x00000000, 0x00060006, 0x0000009f, 0x00000004, 0x57786554, 0x54706172,
-    0x00000000, 0x00070006, 0x0000009f, 0x00000005, 0x49786554, 0x70614373, 0x65727574, 0x00000000,
-    0x00070006, 0x0000009f, 0x00000006, 0x74706143, 0x59657275, 0x7366664f, 0x00007465, 0x00050006,
-    0x0000009f, 0x00000007, 0x6461705f, 0x00000000, 0x00030005, 0x000000a1, 0x00006370, 0x00080005,
-    0x000000a5, 0x75727453, 0x72757463, 0x6e496465, 0x42747570, 0x65666675, 0x00000072, 0x00070006,
-    0x000000a5, 0x00000000, 0x75727453, 0x72757463, 0x6e496465, 0x00747570, 0x00030005, 0x000000a7,
-    0x00000000, 0x00080005, 0x000000a9, 0x74706143, 0x53657275, 0x63656469, 0x75427261, 0x72656666,
-    0x00000000, 0x00090006, 0x000000a9, 0x00000000, 0x74706143, 0x53657275, 0x63656469, 0x69507261,
-    0x736c6578, 0x00000000, 0x00030005, 0x000000ab, 0x00000000, 0x00060005, 0x000000ac, 0x65726944,
-    0x754f7463, 0x74757074, 0x00706f54, 0x00070005, 0x000000ad, 0x65726944, 0x754f7463, 0x74757074,
-    0x74746f42, 0x00006d6f, 0x00040047, 0x0000002c, 0x00000022, 0x00000000, 0x00040047, 0x0000002c,
-    0x00000021, 0x0000000b, 0x00030047, 0x0000002c, 0x00000018, 0x00040047, 0x0000005c, 0x0000000b,
-    0x0000001c, 0x00040047, 0x00000077, 0x00000001, 0x00000000, 0x00040047, 0x00000084, 0x00000006,
-    0x00000004, 0x00050048, 0x00000085, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000085,
-    0x00000002, 0x00040047, 0x00000087, 0x00000022, 0x00000000, 0x00040047, 0x00000087, 0x00000021,
-    0x0000000d, 0x00040047, 0x00000090, 0x00000001, 0x00000001, 0x00040047, 0x00000091, 0x00000001,
-    0x00000002, 0x00040047, 0x0000009a, 0x00000006, 0x00000010, 0x00050048, 0x0000009c, 0x00000000,
-    0x00000023, 0x00000000, 0x00050048, 0x0000009c, 0x00000001, 0x00000023, 0x00000004, 0x00050048,
-    0x0000009c, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x0000009c, 0x00000003, 0x00000023,
-    0x0000000c, 0x00050048, 0x0000009c, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x0000009c,
-    0x00000005, 0x00000023, 0x00000230, 0x00050048, 0x0000009c, 0x00000006, 0x00000023, 0x00000234,
-    0x00050048, 0x0000009c, 0x00000007, 0x00000023, 0x00000238, 0x00050048, 0x0000009c, 0x00000008,
-    0x00000023, 0x0000023c, 0x00050048, 0x0000009c, 0x00000009, 0x00000023, 0x00000240, 0x00050048,
-    0x0000009c, 0x0000000a, 0x00000023, 0x00000244, 0x00050048, 0x0000009c, 0x0000000b, 0x00000023,
-    0x00000248, 0x00030047, 0x0000009c, 0x00000002, 0x00040047, 0x0000009e, 0x00000022, 0x00000000,
-    0x00040047, 0x0000009e, 0x00000021, 0x00000000, 0x00050048, 0x0000009f, 0x00000000, 0x00000023,
-    0x00000000, 0x00050048, 0x0000009f, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x0000009f,
-    0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x0000009f, 0x00000003, 0x00000023, 0x0000000c,
-    0x00050048, 0x0000009f, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x0000009f, 0x00000005,
-    0x00000023, 0x00000014, 0x00050048, 0x0000009f, 0x00000006, 0x00000023, 0x00000018, 0x00050048,
-    0x0000009f, 0x00000007, 0x00000023, 0x0000001c, 0x00030047, 0x0000009f, 0x00000002, 0x00040047,
-    0x000000a4, 0x00000006, 0x00000004, 0x00040048, 0x000000a5, 0x00000000, 0x00000018, 0x00050048,
-    0x000000a5, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x000000a5, 0x00000002, 0x00040047,
-    0x000000a7, 0x00000022, 0x00000000, 0x00040047, 0x000000a7, 0x00000021, 0x0000000c, 0x00040047,
-    0x000000a8, 0x00000006, 0x00000004, 0x00050048, 0x000000a9, 0x00000000, 0x00000023, 0x00000000,
-    0x00030047, 0x000000a9, 0x00000002, 0x00040047, 0x000000ab, 0x00000022, 0x00000000, 0x00040047,
-    0x000000ab, 0x00000021, 0x0000000e, 0x00040047, 0x000000ac, 0x00000022, 0x00000000, 0x00040047,
-    0x000000ac, 0x00000021, 0x00000011, 0x00030047, 0x000000ac, 0x00000019, 0x00040047, 0x000000ad,
-    0x00000022, 0x00000000, 0x00040047, 0x000000ad, 0x00000021, 0x00000012, 0x00030047, 0x000000ad,
-    0x00000019, 0x00040047, 0x000000b7, 0x0000000b, 0x00000019, 0x00020013, 0x00000002, 0x00030021,
-    0x00000003, 0x00000002, 0x00040015, 0x00000006, 0x00000020, 0x00000000, 0x00040020, 0x00000007,
-    0x00000007, 0x00000006, 0x00040021, 0x00000008, 0x00000006, 0x00000007, 0x00040015, 0x0000000f,
-    0x00000020, 0x00000001, 0x00040017, 0x00000010, 0x0000000f, 0x00000002, 0x00040020, 0x00000011,
-    0x00000007, 0x00000010, 0x00040021, 0x00000012, 0x00000006, 0x00000011, 0x0004002b, 0x00000006,
-    0x00000017, 0x0000003f, 0x0004002b, 0x00000006, 0x00000019, 0x0000007f, 0x0004002b, 0x00000006,
-    0x0000001b, 0x000000ff, 0x0004002b, 0x00000006, 0x00000020, 0x0000001f, 0x00030016, 0x00000026,
-    0x00000020, 0x00040017, 0x00000027, 0x00000026, 0x00000004, 0x00040020, 0x00000028, 0x00000007,
-    0x00000027, 0x00090019, 0x0000002a, 0x00000026, 0x00000001, 0x00000000, 0x00000000, 0x00000000,
-    0x00000002, 0x00000004, 0x00040020, 0x0000002b, 0x00000000, 0x0000002a, 0x0004003b, 0x0000002b,
-    0x0000002c, 0x00000000, 0x00040017, 0x00000030, 0x00000006, 0x00000004, 0x00040020, 0x00000031,
-    0x00000007, 0x00000030, 0x0004002b, 0x00000026, 0x00000034, 0x437f0000, 0x0004002b, 0x00000006,
-    0x00000039, 0x00000000, 0x0004002b, 0x00000006, 0x0000003e, 0x00000001, 0x0004002b, 0x0000000f,
-    0x00000042, 0x00000008, 0x0004002b, 0x00000006, 0x00000046, 0x00000002, 0x0004002b, 0x0000000f,
-    0x0000004a, 0x00000010, 0x0004002b, 0x00000006, 0x0000004e, 0x00000003, 0x0004002b, 0x0000000f,
-    0x00000052, 0x00000018, 0x00040017, 0x00000057, 0x00000006, 0x00000002, 0x00040020, 0x00000058,
-    0x00000007, 0x00000057, 0x00040017, 0x0000005a, 0x00000006, 0x00000003, 0x00040020, 0x0000005b,
-    0x00000001, 0x0000005a, 0x0004003b, 0x0000005b, 0x0000005c, 0x00000001, 0x00020014, 0x0000005f,
-    0x0004002b, 0x00000006, 0x00000062, 0x00000100, 0x0004002b, 0x00000006, 0x00000069, 0x000000c0,
-    0x00040032, 0x0000000f, 0x00000077, 0x00000100, 0x0004002b, 0x0000000f, 0x00000078, 0x00000100,
-    0x00060034, 0x0000000f, 0x00000079, 0x00000087, 0x00000077, 0x00000078, 0x00060034, 0x00000006,
-    0x0000007a, 0x00000080, 0x00000079, 0x00000039, 0x00060034, 0x00000006, 0x0000007b, 0x000000c2,
-    0x0000007a, 0x0000003e, 0x00060034, 0x00000006, 0x0000007e, 0x00000080, 0x00000079, 0x00000039,
-    0x0003001d, 0x00000084, 0x00000006, 0x0003001e, 0x00000085, 0x00000084, 0x00040020, 0x00000086,
-    0x0000000c, 0x00000085, 0x0004003b, 0x00000086, 0x00000087, 0x0000000c, 0x0004002b, 0x0000000f,
-    0x00000088, 0x00000000, 0x00040020, 0x0000008e, 0x0000000c, 0x00000006, 0x00040032, 0x0000000f,
-    0x00000090, 0x000000c0, 0x00040032, 0x0000000f, 0x00000091, 0x00003000, 0x0004002b, 0x0000000f,
-    0x00000092, 0x00000040, 0x0004002b, 0x0000000f, 0x00000093, 0x00000020, 0x00060034, 0x0000000f,
-    0x00000094, 0x00000084, 0x00000077, 0x00000090, 0x00060034, 0x0000000f, 0x00000095, 0x00000087,
-    0x00000077, 0x00000042, 0x00060034, 0x0000000f, 0x00000096, 0x00000087, 0x00000090, 0x00000042,
-    0x0004002b, 0x0000000f, 0x00000097, 0x00000002, 0x0004002b, 0x0000000f, 0x00000098, 0x00000800,
-    0x0004002b, 0x00000006, 0x00000099, 0x00000022, 0x0004001c, 0x0000009a, 0x00000030, 0x00000099,
-    0x00040017, 0x0000009b, 0x00000026, 0x00000002, 0x000e001e, 0x0000009c, 0x00000006, 0x00000006,
-    0x0000000f, 0x00000006, 0x0000009a, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x0000009b, 0x00040020, 0x0000009d, 0x00000002, 0x0000009c, 0x0004003b, 0x0000009d,
-    0x0000009e, 0x00000002, 0x000a001e, 0x0000009f, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x0000000f, 0x00000006, 0x00040020, 0x000000a0, 0x00000009, 0x0000009f,
-    0x0004003b, 0x000000a0, 0x000000a1, 0x00000009, 0x0004002b, 0x0000000f, 0x000000a2, 0x000000c0,
-    0x0004002b, 0x0000000f, 0x000000a3, 0x0000c000, 0x0003001d, 0x000000a4, 0x00000006, 0x0003001e,
-    0x000000a5, 0x000000a4, 0x00040020, 0x000000a6, 0x0000000c, 0x000000a5, 0x0004003b, 0x000000a6,
-    0x000000a7, 0x0000000c, 0x0003001d, 0x000000a8, 0x00000006, 0x0003001e, 0x000000a9, 0x000000a8,
-    0x00040020, 0x000000aa, 0x0000000c, 0x000000a9, 0x0004003b, 0x000000aa, 0x000000ab, 0x0000000c,
-    0x0004003b, 0x0000002b, 0x000000ac, 0x00000000, 0x0004003b, 0x0000002b, 0x000000ad, 0x00000000,
-    0x0004002b, 0x00000006, 0x000000ae, 0x0000c000, 0x0004002b, 0x00000006, 0x000000af, 0x00030000,
-    0x0004002b, 0x00000006, 0x000000b0, 0x00060000, 0x0004002b, 0x00000006, 0x000000b1, 0x00090000,
-    0x0004002b, 0x00000006, 0x000000b2, 0x0009c000, 0x0004002b, 0x00000006, 0x000000b3, 0x000a8000,
-    0x0004002b, 0x00000006, 0x000000b4, 0x000a8180, 0x0004002b, 0x00000006, 0x000000b5, 0x00000020,
-    0x0004002b, 0x00000006, 0x000000b6, 0x00000008, 0x0006002c, 0x0000005a, 0x000000b7, 0x000000b6,
-    0x000000b6, 0x0000003e, 0x00050036, 0x00000002, 0x00000004, 0x00000000, 0x00000003, 0x000200f8,
-    0x00000005, 0x0004003b, 0x00000058, 0x00000059, 0x00000007, 0x0004003b, 0x00000007, 0x0000006f,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000076, 0x00000007, 0x0004003b, 0x00000058, 0x0000007c,
-    0x00000007, 0x0004003b, 0x00000011, 0x0000008c, 0x00000007, 0x0004003d, 0x0000005a, 0x0000005d,
-    0x0000005c, 0x0007004f, 0x00000057, 0x0000005e, 0x0000005d, 0x0000005d, 0x00000000, 0x00000001,
-    0x0003003e, 0x00000059, 0x0000005e, 0x00050041, 0x00000007, 0x00000060, 0x00000059, 0x00000039,
-    0x0004003d, 0x00000006, 0x00000061, 0x00000060, 0x000500ae, 0x0000005f, 0x00000063, 0x00000061,
-    0x00000062, 0x000400a8, 0x0000005f, 0x00000064, 0x00000063, 0x000300f7, 0x00000066, 0x00000000,
-    0x000400fa, 0x00000064, 0x00000065, 0x00000066, 0x000200f8, 0x00000065, 0x00050041, 0x00000007,
-    0x00000067, 0x00000059, 0x0000003e, 0x0004003d, 0x00000006, 0x00000068, 0x00000067, 0x000500ae,
-    0x0000005f, 0x0000006a, 0x00000068, 0x00000069, 0x000200f9, 0x00000066, 0x000200f8, 0x00000066,
-    0x000700f5, 0x0000005f, 0x0000006b, 0x00000063, 0x00000005, 0x0000006a, 0x00000065, 0x000300f7,
-    0x0000006d, 0x00000000, 0x000400fa, 0x0000006b, 0x0000006c, 0x0000006d, 0x000200f8, 0x0000006c,
-    0x000100fd, 0x000200f8, 0x0000006d, 0x00050041, 0x00000007, 0x00000070, 0x00000059, 0x00000039,
-    0x0004003d, 0x00000006, 0x00000071, 0x00000070, 0x00050041, 0x00000007, 0x00000072, 0x00000059,
-    0x0000003e, 0x0004003d, 0x00000006, 0x00000073, 0x00000072, 0x00050084, 0x00000006, 0x00000074,
-    0x00000073, 0x00000062, 0x00050080, 0x00000006, 0x00000075, 0x00000071, 0x00000074, 0x0003003e,
-    0x0000006f, 0x00000075, 0x0003003e, 0x00000076, 0x0000007b, 0x0004003d, 0x00000057, 0x0000007d,
-    0x00000059, 0x00050050, 0x00000057, 0x0000007f, 0x0000007e, 0x0000007e, 0x00050084, 0x00000057,
-    0x00000080, 0x0000007d, 0x0000007f, 0x0004003d, 0x00000006, 0x00000081, 0x00000076, 0x00050050,
-    0x00000057, 0x00000082, 0x00000081, 0x00000081, 0x00050080, 0x00000057, 0x00000083, 0x00000080,
-    0x00000082, 0x0003003e, 0x0000007c, 0x00000083, 0x0004003d, 0x00000006, 0x00000089, 0x0000006f,
-    0x0004003d, 0x00000057, 0x0000008a, 0x0000007c, 0x0004007c, 0x00000010, 0x0000008b, 0x0000008a,
-    0x0003003e, 0x0000008c, 0x0000008b, 0x00050039, 0x00000006, 0x0000008d, 0x00000014, 0x0000008c,
-    0x00060041, 0x0000008e, 0x0000008f, 0x00000087, 0x00000088, 0x00000089, 0x0003003e, 0x0000008f,
-    0x0000008d, 0x000100fd, 0x00010038, 0x00050036, 0x00000006, 0x0000000a, 0x00000000, 0x00000008,
-    0x00030037, 0x00000007, 0x00000009, 0x000200f8, 0x0000000b, 0x0004003d, 0x00000006, 0x00000016,
-    0x00000009, 0x00050084, 0x00000006, 0x00000018, 0x00000016, 0x00000017, 0x00050080, 0x00000006,
-    0x0000001a, 0x00000018, 0x00000019, 0x00050086, 0x00000006, 0x0000001c, 0x0000001a, 0x0000001b,
-    0x000200fe, 0x0000001c, 0x00010038, 0x00050036, 0x00000006, 0x0000000d, 0x00000000, 0x00000008,
-    0x00030037, 0x00000007, 0x0000000c, 0x000200f8, 0x0000000e, 0x0004003d, 0x00000006, 0x0000001f,
-    0x0000000c, 0x00050084, 0x00000006, 0x00000021, 0x0000001f, 0x00000020, 0x00050080, 0x00000006,
-    0x00000022, 0x00000021, 0x00000019, 0x00050086, 0x00000006, 0x00000023, 0x00000022, 0x0000001b,
-    0x000200fe, 0x00000023, 0x00010038, 0x00050036, 0x00000006, 0x00000014, 0x00000000, 0x00000012,
-    0x00030037, 0x00000011, 0x00000013, 0x000200f8, 0x00000015, 0x0004003b, 0x00000028, 0x00000029,
-    0x00000007, 0x0004003b, 0x00000031, 0x00000032, 0x00000007, 0x0004003b, 0x00000007, 0x00000038,
-    0x00000007, 0x0004003b, 0x00000007, 0x0000003d, 0x00000007, 0x0004003b, 0x00000007, 0x00000045,
-    0x00000007, 0x0004003b, 0x00000007, 0x0000004d, 0x00000007, 0x0004003d, 0x0000002a, 0x0000002d,
-    0x0000002c, 0x0004003d, 0x00000010, 0x0000002e, 0x00000013, 0x00050062, 0x00000027, 0x0000002f,
-    0x0000002d, 0x0000002e, 0x0003003e, 0x00000029, 0x0000002f, 0x0004003d, 0x00000027, 0x00000033,
-    0x00000029, 0x0005008e, 0x00000027, 0x00000035, 0x00000033, 0x00000034, 0x0006000c, 0x00000027,
-    0x00000036, 0x00000001, 0x00000001, 0x00000035, 0x0004006d, 0x00000030, 0x00000037, 0x00000036,
-    0x0003003e, 0x00000032, 0x00000037, 0x00050041, 0x00000007, 0x0000003a, 0x00000032, 0x00000039,
-    0x0004003d, 0x00000006, 0x0000003b, 0x0000003a, 0x0003003e, 0x00000038, 0x0000003b, 0x00050039,
-    0x00000006, 0x0000003c, 0x0000000a, 0x00000038, 0x00050041, 0x00000007, 0x0000003f, 0x00000032,
-    0x0000003e, 0x0004003d, 0x00000006, 0x00000040, 0x0000003f, 0x0003003e, 0x0000003d, 0x00000040,
-    0x00050039, 0x00000006, 0x00000041, 0x0000000a, 0x0000003d, 0x000500c4, 0x00000006, 0x00000043,
-    0x00000041, 0x00000042, 0x000500c5, 0x00000006, 0x00000044, 0x0000003c, 0x00000043, 0x00050041,
-    0x00000007, 0x00000047, 0x00000032, 0x00000046, 0x0004003d, 0x00000006, 0x00000048, 0x00000047,
-    0x0003003e, 0x00000045, 0x00000048, 0x00050039, 0x00000006, 0x00000049, 0x0000000a, 0x00000045,
-    0x000500c4, 0x00000006, 0x0000004b, 0x00000049, 0x0000004a, 0x000500c5, 0x00000006, 0x0000004c,
-    0x00000044, 0x0000004b, 0x00050041, 0x00000007, 0x0000004f, 0x00000032, 0x0000004e, 0x0004003d,
-    0x00000006, 0x00000050, 0x0000004f, 0x0003003e, 0x0000004d, 0x00000050, 0x00050039, 0x00000006,
-    0x00000051, 0x0000000d, 0x0000004d, 0x000500c4, 0x00000006, 0x00000053, 0x00000051, 0x00000052,
-    0x000500c5, 0x00000006, 0x00000054, 0x0000004c, 0x00000053, 0x000200fe, 0x00000054, 0x00010038,
+const uint8_t Blob033_Data[1866] =
+{
+    0x28, 0xb5, 0x2f, 0xfd, 0x60, 0xa0, 0x15, 0x05, 0x3a, 0x00, 0x4a, 0x47, 0x44, 0x10, 0x4b, 0x80,
+    0xda, 0x71, 0xc6, 0x35, 0xb4, 0xd5, 0x7f, 0x12, 0x4a, 0xf5, 0x9f, 0x84, 0x52, 0xfd, 0x27, 0xa1,
+    0x54, 0xbf, 0x35, 0x72, 0xa3, 0x80, 0x2d, 0xcb, 0x53, 0x25, 0x9f, 0x0d, 0x5c, 0x03, 0xae, 0x01,
+    0x82, 0x8c, 0x10, 0x9f, 0xe2, 0xca, 0x72, 0x5d, 0x24, 0x62, 0xe5, 0x3b, 0x73, 0x5d, 0x25, 0x56,
+    0x9b, 0xae, 0x25, 0x7e, 0xe0, 0x07, 0x42, 0xff, 0xb1, 0x07, 0x4a, 0x2c, 0x9c, 0xa9, 0x47, 0xac,
+    0x8e, 0x56, 0x6d, 0xf1, 0xbf, 0xbb, 0xdd, 0x44, 0x48, 0x0a, 0xdb, 0x00, 0xd8, 0x00, 0x03, 0x01,
+    0x4a, 0x2d, 0x07, 0x63, 0xbc, 0x66, 0x94, 0x67, 0x58, 0x79, 0x25, 0xc3, 0xdb, 0xc8, 0xfa, 0xb4,
+    0xcb, 0x5a, 0x51, 0xed, 0x63, 0x0b, 0xf5, 0x6a, 0x2d, 0x1b, 0x85, 0x29, 0xae, 0xe5, 0xfd, 0x6a,
+    0xe3, 0x72, 0x6b, 0x25, 0x12, 0xe9, 0xb4, 0x67, 0x18, 0x4e, 0x62, 0x62, 0x8d, 0xf0, 0xf2, 0x65,
+    0x72, 0xd9, 0x22, 0xec, 0xfe, 0x88, 0xee, 0x94, 0xd4, 0xd7, 0x1f, 0xdb, 0xa8, 0xa3, 0x6f, 0x52,
+    0x2a, 0x4a, 0xb2, 0x32, 0x1b, 0xef, 0x8e, 0x5a, 0x45, 0xbb, 0x5f, 0x76, 0x46, 0x01, 0xf4, 0xf7,
+    0xb8, 0xba, 0x4a, 0x6f, 0x07, 0x7f, 0xe1, 0x76, 0xb7, 0x4a, 0x38, 0x16, 0x70, 0x1a, 0x50, 0xbb,
+    0xe4, 0xe1, 0xf9, 0x5c, 0xf6, 0x6d, 0x7d, 0x47, 0x16, 0x06, 0xd6, 0xdc, 0x2a, 0xb0, 0x54, 0xb1,
+    0x8b, 0x04, 0x40, 0xcf, 0x2e, 0xbb, 0xac, 0xfd, 0x27, 0x9a, 0x30, 0xf3, 0x08, 0x15, 0xa7, 0x9e,
+    0xe0, 0xe1, 0x2e, 0x29, 0xc3, 0xaf, 0x07, 0xdb, 0xd5, 0xcf, 0x4e, 0x3b, 0xce, 0xae, 0xf1, 0x6d,
+    0xd7, 0xeb, 0x65, 0xbb, 0x8d, 0x5a, 0x6e, 0x8f, 0x44, 0xfd, 0xb6, 0x2e, 0x51, 0xbb, 0x56, 0x5b,
+    0x49, 0x8c, 0x63, 0x23, 0x51, 0x09, 0xf8, 0x73, 0x72, 0xfa, 0x11, 0x6d, 0x9f, 0x6d, 0x39, 0x51,
+    0x73, 0xd5, 0xcd, 0x72, 0x52, 0xff, 0xff, 0xb6, 0x6c, 0xf2, 0xff, 0x8c, 0x86, 0xfb, 0x7f, 0xf4,
+    0x34, 0xff, 0xa9, 0x10, 0xe4, 0x73, 0xdc, 0x4a, 0x1f, 0xa0, 0x10, 0xf8, 0x4b, 0x7f, 0xf3, 0xe7,
+    0x75, 0x7f, 0x96, 0xaf, 0x9f, 0xb9, 0x89, 0x5e, 0xd5, 0x39, 0xd1, 0x5a, 0x66, 0x8a, 0x1b, 0x29,
+    0x1b, 0x74, 0x06, 0x27, 0xe7, 0xf7, 0x27, 0xe1, 0xbd, 0x61, 0x5e, 0x59, 0x0c, 0x0f, 0x93, 0x9c,
+    0x90, 0x5d, 0xd9, 0x06, 0x5f, 0x93, 0x59, 0xa3, 0x70, 0xec, 0x0f, 0xbb, 0xfa, 0x32, 0x1d, 0x8d,
+    0x33, 0xd8, 0x8d, 0x31, 0x92, 0x1f, 0xd9, 0x98, 0xa8, 0xd2, 0xa2, 0x52, 0x2d, 0xcf, 0x3b, 0x66,
+    0x7b, 0x4a, 0x26, 0x9a, 0x3a, 0x9c, 0x5d, 0x18, 0xb3, 0x32, 0x7a, 0xbe, 0x4a, 0x0f, 0x4d, 0x79,
+    0x7e, 0xfa, 0xdd, 0xa3, 0x52, 0xce, 0xc1, 0xaf, 0x7b, 0x1d, 0x8d, 0xd9, 0xe4, 0x6e, 0x79, 0x33,
+    0xeb, 0x6d, 0xdf, 0xc8, 0x96, 0x4a, 0x58, 0x9b, 0x82, 0x7d, 0xeb, 0xe5, 0xbd, 0x91, 0x54, 0xaa,
+    0x1d, 0xeb, 0xa4, 0xa7, 0xbf, 0x0c, 0xbb, 0x70, 0x4f, 0x66, 0xb5, 0xdb, 0xfb, 0xaf, 0xdd, 0x22,
+    0x3b, 0x7c, 0x61, 0x78, 0xf8, 0xfd, 0xf6, 0x62, 0x65, 0x9b, 0x84, 0xa6, 0xff, 0x8f, 0xd4, 0x4f,
+    0xe7, 0x7e, 0xd9, 0x56, 0x66, 0x3f, 0xdc, 0xbc, 0xf2, 0x85, 0xa7, 0xac, 0x5c, 0x38, 0x98, 0x9c,
+    0x39, 0x3c, 0x4d, 0xca, 0x30, 0xb2, 0x7d, 0x3d, 0xb0, 0x5b, 0x37, 0x75, 0x29, 0x81, 0x40, 0xf4,
+    0xdb, 0x02, 0x65, 0x1d, 0xfc, 0xa1, 0x8f, 0xad, 0xbc, 0x85, 0x45, 0xed, 0xf3, 0x71, 0xa5, 0x76,
+    0xdb, 0xe1, 0x09, 0x19, 0x86, 0xaa, 0x62, 0x9b, 0x76, 0x7c, 0x53, 0x4d, 0xb5, 0x7a, 0x89, 0xeb,
+    0xe9, 0x8d, 0x6f, 0xfd, 0xeb, 0xd3, 0xff, 0x97, 0x35, 0x12, 0x39, 0xf3, 0xf6, 0x1c, 0xef, 0xd9,
+    0x69, 0xbf, 0x3a, 0x65, 0x77, 0x72, 0xb2, 0x26, 0x63, 0x4d, 0xc4, 0xc6, 0xc4, 0x1e, 0xc6, 0x04,
+    0x8c, 0xc9, 0x12, 0xb0, 0x25, 0xbf, 0x12, 0x2d, 0x49, 0x6a, 0x48, 0x8e, 0x7c, 0xd5, 0x8e, 0xa4,
+    0xb8, 0xaf, 0xdb, 0xee, 0x65, 0xa4, 0xcb, 0x48, 0x11, 0x22, 0xb8, 0xd3, 0x5c, 0x41, 0x83, 0x22,
+    0x43, 0x88, 0xdc, 0xe4, 0x0c, 0x59, 0x2f, 0x24, 0x08, 0x17, 0x10, 0xde, 0xd6, 0x0f, 0x2e, 0x2d,
+    0x1f, 0x3d, 0x8e, 0x78, 0xfc, 0xec, 0xe0, 0x4a, 0x73, 0xcc, 0xb8, 0xc9, 0x88, 0x21, 0x43, 0x4b,
+    0xc1, 0xd1, 0x27, 0x68, 0x61, 0xb4, 0x65, 0xc5, 0x50, 0x96, 0x8a, 0xf4, 0xdf, 0xb2, 0x4a, 0x1f,
+    0x54, 0x85, 0x4b, 0x01, 0xa4, 0xa5, 0xfd, 0x5f, 0x24, 0xd6, 0x48, 0x11, 0x5d, 0x04, 0x1a, 0x02,
+    0x0a, 0xc4, 0x09, 0x65, 0xf3, 0x84, 0x72, 0xc8, 0x69, 0x38, 0x7d, 0x2b, 0x0f, 0x67, 0x1a, 0x7d,
+    0xa8, 0x87, 0x15, 0xd4, 0xe0, 0x67, 0x42, 0xfa, 0xf3, 0x1e, 0xa2, 0x07, 0x10, 0xce, 0x9b, 0x0f,
+    0x5e, 0xdb, 0xe1, 0x99, 0xed, 0xbc, 0x01, 0x81, 0x05, 0x65, 0x10, 0x60, 0x19, 0xc8, 0x50, 0x00,
+    0x82, 0x2e, 0x40, 0x4e, 0x77, 0xe2, 0x72, 0x05, 0x4c, 0x9c, 0xba, 0xe2, 0xa8, 0x2a, 0x03, 0x06,
+    0xe9, 0x00, 0xf4, 0xe8, 0x29, 0x60, 0x06, 0x4b, 0x59, 0x80, 0xb2, 0x32, 0x03, 0xa8, 0xce, 0x89,
+    0x13, 0x1a, 0x32, 0xb2, 0xb1, 0x31, 0xb1, 0x5b, 0x58, 0x18, 0xd8, 0x0f, 0x76, 0xb0, 0x25, 0x5f,
+    0x37, 0xaa, 0x4d, 0x5a, 0x43, 0xcb, 0xcd, 0x6e, 0xe8, 0x7a, 0xce, 0xcc, 0xff, 0xeb, 0x5e, 0x5e,
+    0x5d, 0x5f, 0x9a, 0x49, 0xb2, 0x1d, 0xd5, 0x30, 0xac, 0x3b, 0x35, 0x28, 0x3d, 0x7f, 0x68, 0xb9,
+    0xd9, 0x0d, 0x5d, 0xcf, 0x99, 0xf9, 0xae, 0x1c, 0x91, 0x73, 0x87, 0xc9, 0x05, 0x60, 0x6b, 0xeb,
+    0x44, 0x75, 0x62, 0x2c, 0xa5, 0x01, 0x37, 0xbf, 0xbb, 0x70, 0xf8, 0x24, 0x6c, 0xea, 0x10, 0x6c,
+    0x72, 0x0a, 0x72, 0x70, 0xda, 0x00, 0xd4, 0xb0, 0x41, 0x89, 0x69, 0x49, 0xe9, 0xb7, 0xe4, 0xfb,
+    0xf5, 0x92, 0xba, 0xf0, 0x7a, 0x5c, 0x8a, 0x90, 0x8e, 0x8a, 0x32, 0x1c, 0x19, 0x65, 0xd8, 0xd9,
+    0x30, 0x7c, 0x77, 0x81, 0x68, 0xe8, 0x82, 0x05, 0x20, 0x21, 0x0b, 0x49, 0xd3, 0x14, 0x4a, 0x83,
+    0x2a, 0xe4, 0xa0, 0xb0, 0x23, 0xc1, 0x81, 0x8f, 0x84, 0x9d, 0xa2, 0x4f, 0xae, 0x27, 0xc2, 0x83,
+    0xa2, 0x26, 0xa5, 0xa2, 0x9d, 0x0a, 0x34, 0x41, 0x75, 0xc0, 0x43, 0x34, 0x40, 0x80, 0x2e, 0x40,
+    0x8d, 0x4e, 0x8e, 0x0e, 0x4e, 0x0e, 0x03, 0x9c, 0xdb, 0x02, 0x9a, 0x1b, 0x80, 0x9f, 0x27, 0x83,
+    0xe0, 0x46, 0x86, 0x81, 0x03, 0x05, 0x6c, 0x6a, 0x04, 0x66, 0x6a, 0xaa, 0x85, 0xf5, 0x36, 0xa1,
+    0x1d, 0x0e, 0x1d, 0x34, 0xb6, 0x74, 0xe4, 0x40, 0xaa, 0xc1, 0x31, 0x74, 0xa3, 0x86, 0x8d, 0xdc,
+    0x55, 0x0d, 0x98, 0xc6, 0xaf, 0x5e, 0xc0, 0xc8, 0x72, 0xf1, 0x62, 0xe9, 0x02, 0x2b, 0x4b, 0xab,
+    0x05, 0x16, 0x54, 0x90, 0x05, 0xd4, 0x8a, 0xe5, 0x0c, 0xef, 0x39, 0xab, 0xb8, 0x53, 0x2d, 0xa5,
+    0x91, 0x1c, 0xa3, 0x18, 0x8a, 0x93, 0xe6, 0xc7, 0xb8, 0x49, 0xf7, 0x44, 0x52, 0xd3, 0x4e, 0xa8,
+    0xf7, 0x72, 0x9e, 0x0f, 0xd3, 0x9a, 0x98, 0xa2, 0x32, 0x9a, 0xd2, 0x48, 0x7d, 0x14, 0x73, 0xe4,
+    0x97, 0x23, 0x51, 0xac, 0x68, 0x24, 0x3e, 0x61, 0xd3, 0xa1, 0x12, 0xb4, 0x23, 0x45, 0x19, 0x99,
+    0x23, 0x48, 0x40, 0x39, 0x49, 0x8d, 0x08, 0x51, 0x74, 0x43, 0x77, 0x05, 0x62, 0x09, 0xab, 0x6a,
+    0x14, 0x08, 0x1a, 0x98, 0xff, 0xb4, 0x0b, 0x5d, 0xc1, 0x12, 0xa2, 0x67, 0xbd, 0x62, 0xc5, 0xc5,
+    0xab, 0xfc, 0xb6, 0x2c, 0x2a, 0x5a, 0x3e, 0xe5, 0x35, 0x29, 0x4f, 0xa3, 0x1c, 0xca, 0x93, 0x82,
+    0xcd, 0xa8, 0x72, 0x50, 0x97, 0xc9, 0x48, 0x52, 0x50, 0x28, 0x0c, 0x9b, 0x01, 0x52, 0x5c, 0x84,
+    0x68, 0x29, 0x65, 0xd9, 0x06, 0xb2, 0x12, 0x18, 0xe1, 0x24, 0x82, 0x50, 0x29, 0x54, 0x50, 0x48,
+    0xbb, 0x01, 0x13, 0x6e, 0x05, 0x73, 0x05, 0xb5, 0x69, 0xf2, 0x79, 0xa2, 0x38, 0x81, 0x42, 0xee,
+    0x41, 0xeb, 0x20, 0x16, 0x1d, 0xdc, 0x1b, 0xcd, 0x18, 0x9a, 0xeb, 0xce, 0x21, 0xb2, 0x80, 0xa3,
+    0xc3, 0x2a, 0xe9, 0x4e, 0x0a, 0xe6, 0x9b, 0x89, 0x5c, 0xef, 0xbe, 0x7f, 0x87, 0x36, 0x78, 0xb5,
+    0x9e, 0x36, 0xc6, 0x97, 0x4b, 0x76, 0xde, 0x1d, 0x9f, 0x53, 0xd7, 0xec, 0xc0, 0xb4, 0x3c, 0x17,
+    0xae, 0xe0, 0x22, 0xea, 0x08, 0x76, 0x04, 0xe5, 0x3a, 0x4d, 0xbc, 0x08, 0xfb, 0x38, 0x99, 0xa5,
+    0xd4, 0xf9, 0x54, 0x2a, 0x14, 0x21, 0x0d, 0x28, 0x33, 0x2a, 0x6b, 0x65, 0x6e, 0x0c, 0x3f, 0x04,
+    0x73, 0x35, 0x4f, 0x64, 0xb7, 0x37, 0x6b, 0x0a, 0x60, 0x58, 0x58, 0x7d, 0xe8, 0x69, 0x1b, 0xcf,
+    0x07, 0x3e, 0xa9, 0x9d, 0x49, 0x48, 0xcf, 0x8a, 0xea, 0xaf, 0x71, 0xea, 0x73, 0xbc, 0x0f, 0x65,
+    0xa6, 0x07, 0x5f, 0xf8, 0xd1, 0xcf, 0x8f, 0x4b, 0xdc, 0xb1, 0x2e, 0x8c, 0xa5, 0x9f, 0x85, 0x85,
+    0x0b, 0x73, 0x5e, 0x9a, 0x22, 0xe0, 0xa3, 0xf9, 0x2b, 0x8f, 0x52, 0x9f, 0x0b, 0x7d, 0xa5, 0x9b,
+    0x23, 0x56, 0xfe, 0x85, 0x50, 0xf3, 0xf7, 0xf9, 0x72, 0x61, 0x4e, 0xfd, 0xe7, 0xe3, 0x33, 0xa7,
+    0xb5, 0xbf, 0x80, 0xbc, 0x49, 0x0d, 0xe6, 0x15, 0xee, 0xf3, 0x7c, 0x0b, 0x5f, 0x41, 0x5d, 0xe0,
+    0x1e, 0xe4, 0x28, 0xd6, 0xe0, 0x11, 0x3c, 0x26, 0xc3, 0x90, 0x9f, 0x6e, 0x40, 0x1d, 0xcc, 0x67,
+    0x9c, 0x04, 0x34, 0x9b, 0x3c, 0x17, 0xd4, 0xac, 0x64, 0xa6, 0x6b, 0xe9, 0x5c, 0xd5, 0x3b, 0x7a,
+    0x43, 0xc9, 0x65, 0x4a, 0xe4, 0x85, 0x27, 0xaf, 0x21, 0x06, 0x0d, 0x89, 0x1d, 0xd0, 0x37, 0xc1,
+    0xfb, 0x41, 0x0d, 0x84, 0x8c, 0xa3, 0x2e, 0xf5, 0x11, 0xb1, 0xed, 0xe1, 0x69, 0x1b, 0xc4, 0x02,
+    0x3e, 0x80, 0xf2, 0xe5, 0x86, 0x99, 0x52, 0x07, 0xc9, 0xf9, 0x92, 0x84, 0x6d, 0xca, 0x1e, 0x4f,
+    0x2e, 0xe5, 0xe5, 0x0c, 0x60, 0x59, 0x6d, 0xab, 0xe8, 0x54, 0x71, 0x48, 0x23, 0xdb, 0xfe, 0x81,
+    0xd6, 0x81, 0x15, 0xe4, 0x4c, 0x28, 0x89, 0xb8, 0xc4, 0xe0, 0xf1, 0xd7, 0x65, 0x03, 0xa1, 0xb0,
+    0x59, 0x5b, 0x51, 0xf6, 0xfb, 0x29, 0xfb, 0x99, 0x4f, 0x78, 0x62, 0xa0, 0x71, 0xfd, 0xf5, 0x78,
+    0x2b, 0x2f, 0x7e, 0xde, 0xc6, 0x10, 0x77, 0x98, 0xa9, 0xab, 0x83, 0xb1, 0x2d, 0xb8, 0x50, 0x73,
+    0xf7, 0x45, 0xd5, 0x93, 0xd0, 0x8a, 0x1b, 0x71, 0x88, 0xed, 0x85, 0xbe, 0x65, 0x41, 0x46, 0x32,
+    0x9c, 0x0f, 0x63, 0x01, 0x2f, 0xcc, 0x59, 0xca, 0x8c, 0xde, 0x57, 0xc9, 0x5c, 0x99, 0x4c, 0xfb,
+    0x79, 0x10, 0x1b, 0xa8, 0x77, 0x74, 0x3c, 0x6a, 0x27, 0x3b, 0x08, 0x3f, 0x22, 0x0e, 0xad, 0x11,
+    0xcc, 0xac, 0x47, 0xba, 0x11, 0x4a, 0xaf, 0xb3, 0x7e, 0xc6, 0x1c, 0xfa, 0x66, 0x06, 0xc0, 0x31,
+    0xda, 0xaf, 0x1a, 0x44, 0x1b, 0xac, 0x9f, 0x4d, 0xd9, 0x2b, 0x55, 0xaa, 0x86, 0xcb, 0x78, 0x9a,
+    0x31, 0x6d, 0x34, 0x18, 0xdc, 0xd4, 0xa4, 0xfe, 0xe6, 0x1d, 0xcf, 0x1a, 0xbe, 0xff, 0xa4, 0x48,
+    0x23, 0x72, 0xa8, 0x12, 0xab, 0xcf, 0xfe, 0x66, 0xa7, 0x31, 0x60, 0xa8, 0x5a, 0x08, 0x7a, 0x95,
+    0xcf, 0x13, 0xf5, 0x60, 0x8a, 0xd8, 0x03, 0xac, 0x69, 0xbd, 0xc4, 0x93, 0x1b, 0x30, 0xd0, 0xad,
+    0x98, 0x01, 0x1e, 0xd2, 0xea, 0xda, 0x69, 0xc7, 0x00, 0xd2, 0x27, 0xf4, 0xaa, 0xbb, 0x07, 0x38,
+    0x48, 0xf8, 0xfc, 0x84, 0x46, 0xf7, 0xb9, 0xc3, 0x37, 0xdf, 0xa0, 0x63, 0x9c, 0x73, 0x49, 0xfe,
+    0x38, 0x6d, 0x5d, 0xd8, 0x4e, 0xf8, 0xa3, 0xff, 0x3e, 0x12, 0xf9, 0x85, 0x76, 0xd6, 0x1f, 0x6c,
+    0x5e, 0x52, 0x33, 0x1f, 0x3f, 0xe5, 0x2f, 0x6f, 0xeb, 0xd0, 0x9e, 0xf4, 0xd7, 0xc4, 0x0d, 0xb5,
+    0x28, 0xb9, 0xac, 0x41, 0xb9, 0x81, 0xca, 0x7d, 0xe8, 0xec, 0x50, 0x18, 0xf4, 0x05, 0x4b, 0xe9,
+    0x73, 0xf9, 0x1d, 0xcc, 0x57, 0xbb, 0x62, 0x29, 0x78, 0x5a, 0x19, 0x63, 0xc8, 0xb8, 0x49, 0x90,
+    0xbc, 0xa9, 0x1b, 0xc1, 0x46, 0x93, 0xf7, 0x60, 0x9b, 0xe0, 0xda, 0xbe, 0x29, 0x09, 0x9b, 0x88,
+    0x46, 0x22, 0xea, 0x7b, 0xd3, 0x5e, 0x08, 0xac, 0x33, 0xf5, 0xba, 0x3e, 0x02, 0x44, 0x29, 0x4e,
+    0x63, 0x05, 0x11, 0x53, 0x3d, 0x45, 0x30, 0x53, 0xa8, 0x43, 0x5e, 0x9b, 0xcc, 0xe0, 0xbd, 0x2c,
+    0x6d, 0xcf, 0x4d, 0xfb, 0xfd, 0x2d, 0xa1, 0xc6, 0x52, 0x8c, 0x30, 0x9f, 0x46, 0x01, 0x7b, 0xe1,
+    0x60, 0x5e, 0x00, 0x40, 0xd1, 0x70, 0x6a, 0xfd, 0x16, 0x1c, 0xa8, 0xf8, 0x7f, 0xc9, 0x07, 0xbe,
+    0xe3, 0xc2, 0x83, 0x20, 0x3b, 0xf9, 0x36, 0x3b, 0xa7, 0xcf, 0xce, 0x41, 0x2d, 0x74, 0x9c, 0xe1,
+    0xdd, 0x02, 0xd5, 0xbd, 0x74, 0x5d, 0x9e, 0x5c, 0xb3, 0x22, 0x48, 0xa4, 0xbc, 0x90, 0xd5, 0xa0,
+    0x0b, 0x9b, 0xad, 0xbf, 0xa6, 0xf2, 0x32, 0x16, 0x61, 0x90, 0x35, 0xb9, 0x91, 0xec, 0xd9, 0xb6,
+    0xa5, 0x0a, 0x7b, 0xf4, 0x5a, 0x1c, 0x48, 0xa0, 0x3d, 0xbd, 0xec, 0x09, 0xb2, 0x9d, 0xd4, 0x8f,
+    0xa3, 0x4f, 0x3c, 0xec, 0xed, 0xf6, 0x2a, 0x51, 0x87, 0x8d, 0x27, 0x61, 0xe4, 0x13, 0x3a, 0x9e,
+    0x53, 0xdf, 0x0d, 0xd7, 0xc6, 0xff, 0xc0, 0x98, 0x05, 0x89, 0xbd, 0xd8, 0xe0, 0x68, 0x8b, 0xbd,
+    0x1c, 0x02, 0x88, 0x19, 0x7f, 0x96, 0xfa, 0x57, 0x6d, 0x33, 0xfb, 0x03, 0x48, 0x42, 0x09, 0x7d,
+    0xd1, 0x17, 0xac, 0x7d, 0x07, 0xc0, 0xd1, 0x11, 0xf8, 0xe1, 0xb7, 0x35, 0xfc, 0x9e, 0xce, 0xc8,
+    0x47, 0x74, 0xac, 0x56, 0xca, 0x17, 0xe8, 0x71, 0xee, 0x10,
 };
+const ShaderModule Blob033 = { Blob033_Data, 1866u, 1448u, 33u };
 
-extern const uint32_t Blob071[1448];
-const uint32_t Blob071[1448] = {
-    0x07230203, 0x00010300, 0x0008000b, 0x000000b8, 0x00000000, 0x00020011, 0x00000001, 0x0006000b,
-    0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001,
-    0x0006000f, 0x00000005, 0x00000004, 0x6e69616d, 0x00000000, 0x0000005c, 0x00060010, 0x00000004,
-    0x00000011, 0x00000008, 0x00000008, 0x00000001, 0x00030003, 0x00000002, 0x000001c2, 0x000a0004,
-    0x475f4c47, 0x4c474f4f, 0x70635f45, 0x74735f70, 0x5f656c79, 0x656e696c, 0x7269645f, 0x69746365,
-    0x00006576, 0x00080004, 0x475f4c47, 0x4c474f4f, 0x6e695f45, 0x64756c63, 0x69645f65, 0x74636572,
-    0x00657669, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000, 0x00070005, 0x0000000a, 0x726f6e55,
-    0x6f54386d, 0x36626752, 0x3b317528, 0x00000000, 0x00040005, 0x00000009, 0x756c6176, 0x00000065,
-    0x00070005, 0x0000000d, 0x726f6e55, 0x6f54386d, 0x68706c41, 0x75283561, 0x00003b31, 0x00040005,
-    0x0000000c, 0x756c6176, 0x00000065, 0x00070005, 0x00000014, 0x64616f4c, 0x616e6946, 0x2842466c,
-    0x3b326976, 0x00000000, 0x00050005, 0x00000013, 0x69736f70, 0x6e6f6974, 0x00000000, 0x00040005,
-    0x00000029, 0x65786574, 0x0000006c, 0x00040005, 0x0000002c, 0x616e6946, 0x0042466c, 0x00050005,
-    0x00000032, 0x6e617571, 0x657a6974, 0x00000064, 0x00040005, 0x00000038, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000003d, 0x61726170, 0x0000006d, 0x00040005, 0x00000045, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000004d, 0x61726170, 0x0000006d, 0x00030005, 0x00000059, 0x00006469, 0x00080005,
-    0x0000005c, 0x475f6c67, 0x61626f6c, 0x766e496c, 0x7461636f, 0x496e6f69, 0x00000044, 0x00050005,
-    0x0000006f, 0x4f74756f, 0x65736666, 0x00000074, 0x00040005, 0x00000076, 0x746e6563, 0x00006572,
-    0x00050005, 0x00000077, 0x65726353, 0x69576e65, 0x00687464, 0x00050005, 0x00000079, 0x6c616353,
-    0x63614665, 0x00726f74, 0x00040005, 0x0000007c, 0x72756f73, 0x00006563, 0x00090005, 0x00000085,
-    0x73657250, 0x61746e65, 0x6e6f6974, 0x7074754f, 0x75427475, 0x72656666, 0x00000000, 0x00080006,
-    0x00000085, 0x00000000, 0x73657250, 0x61746e65, 0x6e6f6974, 0x7074754f, 0x00007475, 0x00030005,
-    0x00000087, 0x00000000, 0x00040005, 0x0000008c, 0x61726170, 0x0000006d, 0x00060005, 0x00000090,
-    0x65726353, 0x65486e65, 0x74686769, 0x00000000, 0x00060005, 0x00000091, 0x5778614d, 0x546b726f,
-    0x73656c69, 0x00000000, 0x00070005, 0x00000094, 0x6d617246, 0x66756265, 0x53726566, 0x64697274,
-    0x00000065, 0x00060005, 0x00000095, 0x656c6954, 0x72655073, 0x656e694c, 0x00000000, 0x00050005,
-    0x00000096, 0x656c6954, 0x656e694c, 0x00000073, 0x00050005, 0x0000009c, 0x6174654d, 0x66696e55,
-    0x006d726f, 0x00060006, 0x0000009c, 0x00000000, 0x506d754e, 0x67796c6f, 0x00736e6f, 0x00060006,
-    0x0000009c, 0x00000001, 0x566d754e, 0x61697261, 0x0073746e, 0x00060006, 0x0000009c, 0x00000002,
-    0x68706c41, 0x66655261, 0x00000000, 0x00050006, 0x0000009c, 0x00000003, 0x70736944, 0x00746e43,
-    0x00060006, 0x0000009c, 0x00000004, 0x6e6f6f54, 0x6c626154, 0x00000065, 0x00060006, 0x0000009c,
-    0x00000005, 0x61656c43, 0x6c6f4372, 0x0000726f, 0x00060006, 0x0000009c, 0x00000006, 0x61656c43,
-    0x70654472, 0x00006874, 0x00060006, 0x0000009c, 0x00000007, 0x61656c43, 0x74744172, 0x00000072,
-    0x00060006, 0x0000009c, 0x00000008, 0x4f676f46, 0x65736666, 0x00000074, 0x00060006, 0x0000009c,
-    0x00000009, 0x53676f46, 0x74666968, 0x00000000, 0x00060006, 0x0000009c, 0x0000000a, 0x43676f46,
-    0x726f6c6f, 0x00000000, 0x00080006, 0x0000009c, 0x0000000b, 0x61656c43, 0x74694272, 0x4f70616d,
-    0x65736666, 0x00000074, 0x00030005, 0x0000009e, 0x00000000, 0x00060005, 0x0000009f, 0x68737550,
-    0x736e6f43, 0x746e6174, 0x00000073, 0x00060006, 0x0000009f, 0x00000000, 0x56727543, 0x61697261,
-    0x0000746e, 0x00060006, 0x0000009f, 0x00000001, 0x57786554, 0x68746469, 0x00000000, 0x00060006,
-    0x0000009f, 0x00000002, 0x48786554, 0x68676965, 0x00000074, 0x00060006, 0x0000009f, 0x00000003,
-    0x57786554, 0x53706172, 0x00000000, 0x00060006, 0x0000009f, 0x00000004, 0x57786554, 0x54706172,
-    0x00000000, 0x00070006, 0x0000009f, 0x00000005, 0x49786554, 0x70614373, 0x65727574, 0x00000000,
-    0x00070006, 0x0000009f, 0x00000006, 0x74706143, 0x59657275, 0x7366664f, 0x00007465, 0x00050006,
-    0x0000009f, 0x00000007, 0x6461705f, 0x00000000, 0x00030005, 0x000000a1, 0x00006370, 0x00080005,
-    0x000000a5, 0x75727453, 0x72757463, 0x6e496465, 0x42747570, 0x65666675, 0x00000072, 0x00070006,
-    0x000000a5, 0x00000000, 0x75727453, 0x72757463, 0x6e496465, 0x00747570, 0x00030005, 0x000000a7,
-    0x00000000, 0x00080005, 0x000000a9, 0x74706143, 0x53657275, 0x63656469, 0x75427261, 0x72656666,
-    0x00000000, 0x00090006, 0x000000a9, 0x00000000, 0x74706143, 0x53657275, 0x63656469, 0x69507261,
-    0x736c6578, 0x00000000, 0x00030005, 0x000000ab, 0x00000000, 0x00060005, 0x000000ac, 0x65726944,
-    0x754f7463, 0x74757074, 0x00706f54, 0x00070005, 0x000000ad, 0x65726944, 0x754f7463, 0x74757074,
-    0x74746f42, 0x00006d6f, 0x00040047, 0x0000002c, 0x00000022, 0x00000000, 0x00040047, 0x0000002c,
-    0x00000021, 0x0000000b, 0x00030047, 0x0000002c, 0x00000018, 0x00040047, 0x0000005c, 0x0000000b,
-    0x0000001c, 0x00040047, 0x00000077, 0x00000001, 0x00000000, 0x00040047, 0x00000084, 0x00000006,
-    0x00000004, 0x00050048, 0x00000085, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000085,
-    0x00000002, 0x00040047, 0x00000087, 0x00000022, 0x00000000, 0x00040047, 0x00000087, 0x00000021,
-    0x0000000d, 0x00040047, 0x00000090, 0x00000001, 0x00000001, 0x00040047, 0x00000091, 0x00000001,
-    0x00000002, 0x00040047, 0x0000009a, 0x00000006, 0x00000010, 0x00050048, 0x0000009c, 0x00000000,
-    0x00000023, 0x00000000, 0x00050048, 0x0000009c, 0x00000001, 0x00000023, 0x00000004, 0x00050048,
-    0x0000009c, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x0000009c, 0x00000003, 0x00000023,
-    0x0000000c, 0x00050048, 0x0000009c, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x0000009c,
-    0x00000005, 0x00000023, 0x00000230, 0x00050048, 0x0000009c, 0x00000006, 0x00000023, 0x00000234,
-    0x00050048, 0x0000009c, 0x00000007, 0x00000023, 0x00000238, 0x00050048, 0x0000009c, 0x00000008,
-    0x00000023, 0x0000023c, 0x00050048, 0x0000009c, 0x00000009, 0x00000023, 0x00000240, 0x00050048,
-    0x0000009c, 0x0000000a, 0x00000023, 0x00000244, 0x00050048, 0x0000009c, 0x0000000b, 0x00000023,
-    0x00000248, 0x00030047, 0x0000009c, 0x00000002, 0x00040047, 0x0000009e, 0x00000022, 0x00000000,
-    0x00040047, 0x0000009e, 0x00000021, 0x00000000, 0x00050048, 0x0000009f, 0x00000000, 0x00000023,
-    0x00000000, 0x00050048, 0x0000009f, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x0000009f,
-    0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x0000009f, 0x00000003, 0x00000023, 0x0000000c,
-    0x00050048, 0x0000009f, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x0000009f, 0x00000005,
-    0x00000023, 0x00000014, 0x00050048, 0x0000009f, 0x00000006, 0x00000023, 0x00000018, 0x00050048,
-    0x0000009f, 0x00000007, 0x00000023, 0x0000001c, 0x00030047, 0x0000009f, 0x00000002, 0x00040047,
-    0x000000a4, 0x00000006, 0x00000004, 0x00040048, 0x000000a5, 0x00000000, 0x00000018, 0x00050048,
-    0x000000a5, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x000000a5, 0x00000002, 0x00040047,
-    0x000000a7, 0x00000022, 0x00000000, 0x00040047, 0x000000a7, 0x00000021, 0x0000000c, 0x00040047,
-    0x000000a8, 0x00000006, 0x00000004, 0x00050048, 0x000000a9, 0x00000000, 0x00000023, 0x00000000,
-    0x00030047, 0x000000a9, 0x00000002, 0x00040047, 0x000000ab, 0x00000022, 0x00000000, 0x00040047,
-    0x000000ab, 0x00000021, 0x0000000e, 0x00040047, 0x000000ac, 0x00000022, 0x00000000, 0x00040047,
-    0x000000ac, 0x00000021, 0x00000011, 0x00030047, 0x000000ac, 0x00000019, 0x00040047, 0x000000ad,
-    0x00000022, 0x00000000, 0x00040047, 0x000000ad, 0x00000021, 0x00000012, 0x00030047, 0x000000ad,
-    0x00000019, 0x00040047, 0x000000b7, 0x0000000b, 0x00000019, 0x00020013, 0x00000002, 0x00030021,
-    0x00000003, 0x00000002, 0x00040015, 0x00000006, 0x00000020, 0x00000000, 0x00040020, 0x00000007,
-    0x00000007, 0x00000006, 0x00040021, 0x00000008, 0x00000006, 0x00000007, 0x00040015, 0x0000000f,
-    0x00000020, 0x00000001, 0x00040017, 0x00000010, 0x0000000f, 0x00000002, 0x00040020, 0x00000011,
-    0x00000007, 0x00000010, 0x00040021, 0x00000012, 0x00000006, 0x00000011, 0x0004002b, 0x00000006,
-    0x00000017, 0x0000003f, 0x0004002b, 0x00000006, 0x00000019, 0x0000007f, 0x0004002b, 0x00000006,
-    0x0000001b, 0x000000ff, 0x0004002b, 0x00000006, 0x00000020, 0x0000001f, 0x00030016, 0x00000026,
-    0x00000020, 0x00040017, 0x00000027, 0x00000026, 0x00000004, 0x00040020, 0x00000028, 0x00000007,
-    0x00000027, 0x00090019, 0x0000002a, 0x00000026, 0x00000001, 0x00000000, 0x00000000, 0x00000000,
-    0x00000002, 0x00000004, 0x00040020, 0x0000002b, 0x00000000, 0x0000002a, 0x0004003b, 0x0000002b,
-    0x0000002c, 0x00000000, 0x00040017, 0x00000030, 0x00000006, 0x00000004, 0x00040020, 0x00000031,
-    0x00000007, 0x00000030, 0x0004002b, 0x00000026, 0x00000034, 0x437f0000, 0x0004002b, 0x00000006,
-    0x00000039, 0x00000000, 0x0004002b, 0x00000006, 0x0000003e, 0x00000001, 0x0004002b, 0x0000000f,
-    0x00000042, 0x00000008, 0x0004002b, 0x00000006, 0x00000046, 0x00000002, 0x0004002b, 0x0000000f,
-    0x0000004a, 0x00000010, 0x0004002b, 0x00000006, 0x0000004e, 0x00000003, 0x0004002b, 0x0000000f,
-    0x00000052, 0x00000018, 0x00040017, 0x00000057, 0x00000006, 0x00000002, 0x00040020, 0x00000058,
-    0x00000007, 0x00000057, 0x00040017, 0x0000005a, 0x00000006, 0x00000003, 0x00040020, 0x0000005b,
-    0x00000001, 0x0000005a, 0x0004003b, 0x0000005b, 0x0000005c, 0x00000001, 0x00020014, 0x0000005f,
-    0x0004002b, 0x00000006, 0x00000062, 0x00000100, 0x0004002b, 0x00000006, 0x00000069, 0x000000c0,
-    0x00040032, 0x0000000f, 0x00000077, 0x00000100, 0x0004002b, 0x0000000f, 0x00000078, 0x00000100,
-    0x00060034, 0x0000000f, 0x00000079, 0x00000087, 0x00000077, 0x00000078, 0x00060034, 0x00000006,
-    0x0000007a, 0x00000080, 0x00000079, 0x00000039, 0x00060034, 0x00000006, 0x0000007b, 0x000000c2,
-    0x0000007a, 0x0000003e, 0x00060034, 0x00000006, 0x0000007e, 0x00000080, 0x00000079, 0x00000039,
-    0x0003001d, 0x00000084, 0x00000006, 0x0003001e, 0x00000085, 0x00000084, 0x00040020, 0x00000086,
-    0x0000000c, 0x00000085, 0x0004003b, 0x00000086, 0x00000087, 0x0000000c, 0x0004002b, 0x0000000f,
-    0x00000088, 0x00000000, 0x00040020, 0x0000008e, 0x0000000c, 0x00000006, 0x00040032, 0x0000000f,
-    0x00000090, 0x000000c0, 0x00040032, 0x0000000f, 0x00000091, 0x00003000, 0x0004002b, 0x0000000f,
-    0x00000092, 0x00000080, 0x0004002b, 0x0000000f, 0x00000093, 0x00000040, 0x00060034, 0x0000000f,
-    0x00000094, 0x00000084, 0x00000077, 0x00000090, 0x00060034, 0x0000000f, 0x00000095, 0x00000087,
-    0x00000077, 0x0000004a, 0x00060034, 0x0000000f, 0x00000096, 0x00000087, 0x00000090, 0x0000004a,
-    0x0004002b, 0x0000000f, 0x00000097, 0x00000002, 0x0004002b, 0x0000000f, 0x00000098, 0x00000800,
-    0x0004002b, 0x00000006, 0x00000099, 0x00000022, 0x0004001c, 0x0000009a, 0x00000030, 0x00000099,
-    0x00040017, 0x0000009b, 0x00000026, 0x00000002, 0x000e001e, 0x0000009c, 0x00000006, 0x00000006,
-    0x0000000f, 0x00000006, 0x0000009a, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x0000009b, 0x00040020, 0x0000009d, 0x00000002, 0x0000009c, 0x0004003b, 0x0000009d,
-    0x0000009e, 0x00000002, 0x000a001e, 0x0000009f, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x0000000f, 0x00000006, 0x00040020, 0x000000a0, 0x00000009, 0x0000009f,
-    0x0004003b, 0x000000a0, 0x000000a1, 0x00000009, 0x0004002b, 0x0000000f, 0x000000a2, 0x000000c0,
-    0x0004002b, 0x0000000f, 0x000000a3, 0x0000c000, 0x0003001d, 0x000000a4, 0x00000006, 0x0003001e,
-    0x000000a5, 0x000000a4, 0x00040020, 0x000000a6, 0x0000000c, 0x000000a5, 0x0004003b, 0x000000a6,
-    0x000000a7, 0x0000000c, 0x0003001d, 0x000000a8, 0x00000006, 0x0003001e, 0x000000a9, 0x000000a8,
-    0x00040020, 0x000000aa, 0x0000000c, 0x000000a9, 0x0004003b, 0x000000aa, 0x000000ab, 0x0000000c,
-    0x0004003b, 0x0000002b, 0x000000ac, 0x00000000, 0x0004003b, 0x0000002b, 0x000000ad, 0x00000000,
-    0x0004002b, 0x00000006, 0x000000ae, 0x0000c000, 0x0004002b, 0x00000006, 0x000000af, 0x00030000,
-    0x0004002b, 0x00000006, 0x000000b0, 0x00060000, 0x0004002b, 0x00000006, 0x000000b1, 0x00090000,
-    0x0004002b, 0x00000006, 0x000000b2, 0x0009c000, 0x0004002b, 0x00000006, 0x000000b3, 0x000a8000,
-    0x0004002b, 0x00000006, 0x000000b4, 0x000a8180, 0x0004002b, 0x00000006, 0x000000b5, 0x00000020,
-    0x0004002b, 0x00000006, 0x000000b6, 0x00000008, 0x0006002c, 0x0000005a, 0x000000b7, 0x000000b6,
-    0x000000b6, 0x0000003e, 0x00050036, 0x00000002, 0x00000004, 0x00000000, 0x00000003, 0x000200f8,
-    0x00000005, 0x0004003b, 0x00000058, 0x00000059, 0x00000007, 0x0004003b, 0x00000007, 0x0000006f,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000076, 0x00000007, 0x0004003b, 0x00000058, 0x0000007c,
-    0x00000007, 0x0004003b, 0x00000011, 0x0000008c, 0x00000007, 0x0004003d, 0x0000005a, 0x0000005d,
-    0x0000005c, 0x0007004f, 0x00000057, 0x0000005e, 0x0000005d, 0x0000005d, 0x00000000, 0x00000001,
-    0x0003003e, 0x00000059, 0x0000005e, 0x00050041, 0x00000007, 0x00000060, 0x00000059, 0x00000039,
-    0x0004003d, 0x00000006, 0x00000061, 0x00000060, 0x000500ae, 0x0000005f, 0x00000063, 0x00000061,
-    0x00000062, 0x000400a8, 0x0000005f, 0x00000064, 0x00000063, 0x000300f7, 0x00000066, 0x00000000,
-    0x000400fa, 0x00000064, 0x00000065, 0x00000066, 0x000200f8, 0x00000065, 0x00050041, 0x00000007,
-    0x00000067, 0x00000059, 0x0000003e, 0x0004003d, 0x00000006, 0x00000068, 0x00000067, 0x000500ae,
-    0x0000005f, 0x0000006a, 0x00000068, 0x00000069, 0x000200f9, 0x00000066, 0x000200f8, 0x00000066,
-    0x000700f5, 0x0000005f, 0x0000006b, 0x00000063, 0x00000005, 0x0000006a, 0x00000065, 0x000300f7,
-    0x0000006d, 0x00000000, 0x000400fa, 0x0000006b, 0x0000006c, 0x0000006d, 0x000200f8, 0x0000006c,
-    0x000100fd, 0x000200f8, 0x0000006d, 0x00050041, 0x00000007, 0x00000070, 0x00000059, 0x00000039,
-    0x0004003d, 0x00000006, 0x00000071, 0x00000070, 0x00050041, 0x00000007, 0x00000072, 0x00000059,
-    0x0000003e, 0x0004003d, 0x00000006, 0x00000073, 0x00000072, 0x00050084, 0x00000006, 0x00000074,
-    0x00000073, 0x00000062, 0x00050080, 0x00000006, 0x00000075, 0x00000071, 0x00000074, 0x0003003e,
-    0x0000006f, 0x00000075, 0x0003003e, 0x00000076, 0x0000007b, 0x0004003d, 0x00000057, 0x0000007d,
-    0x00000059, 0x00050050, 0x00000057, 0x0000007f, 0x0000007e, 0x0000007e, 0x00050084, 0x00000057,
-    0x00000080, 0x0000007d, 0x0000007f, 0x0004003d, 0x00000006, 0x00000081, 0x00000076, 0x00050050,
-    0x00000057, 0x00000082, 0x00000081, 0x00000081, 0x00050080, 0x00000057, 0x00000083, 0x00000080,
-    0x00000082, 0x0003003e, 0x0000007c, 0x00000083, 0x0004003d, 0x00000006, 0x00000089, 0x0000006f,
-    0x0004003d, 0x00000057, 0x0000008a, 0x0000007c, 0x0004007c, 0x00000010, 0x0000008b, 0x0000008a,
-    0x0003003e, 0x0000008c, 0x0000008b, 0x00050039, 0x00000006, 0x0000008d, 0x00000014, 0x0000008c,
-    0x00060041, 0x0000008e, 0x0000008f, 0x00000087, 0x00000088, 0x00000089, 0x0003003e, 0x0000008f,
-    0x0000008d, 0x000100fd, 0x00010038, 0x00050036, 0x00000006, 0x0000000a, 0x00000000, 0x00000008,
-    0x00030037, 0x00000007, 0x00000009, 0x000200f8, 0x0000000b, 0x0004003d, 0x00000006, 0x00000016,
-    0x00000009, 0x00050084, 0x00000006, 0x00000018, 0x00000016, 0x00000017, 0x00050080, 0x00000006,
-    0x0000001a, 0x00000018, 0x00000019, 0x00050086, 0x00000006, 0x0000001c, 0x0000001a, 0x0000001b,
-    0x000200fe, 0x0000001c, 0x00010038, 0x00050036, 0x00000006, 0x0000000d, 0x00000000, 0x00000008,
-    0x00030037, 0x00000007, 0x0000000c, 0x000200f8, 0x0000000e, 0x0004003d, 0x00000006, 0x0000001f,
-    0x0000000c, 0x00050084, 0x00000006, 0x00000021, 0x0000001f, 0x00000020, 0x00050080, 0x00000006,
-    0x00000022, 0x00000021, 0x00000019, 0x00050086, 0x00000006, 0x00000023, 0x00000022, 0x0000001b,
-    0x000200fe, 0x00000023, 0x00010038, 0x00050036, 0x00000006, 0x00000014, 0x00000000, 0x00000012,
-    0x00030037, 0x00000011, 0x00000013, 0x000200f8, 0x00000015, 0x0004003b, 0x00000028, 0x00000029,
-    0x00000007, 0x0004003b, 0x00000031, 0x00000032, 0x00000007, 0x0004003b, 0x00000007, 0x00000038,
-    0x00000007, 0x0004003b, 0x00000007, 0x0000003d, 0x00000007, 0x0004003b, 0x00000007, 0x00000045,
-    0x00000007, 0x0004003b, 0x00000007, 0x0000004d, 0x00000007, 0x0004003d, 0x0000002a, 0x0000002d,
-    0x0000002c, 0x0004003d, 0x00000010, 0x0000002e, 0x00000013, 0x00050062, 0x00000027, 0x0000002f,
-    0x0000002d, 0x0000002e, 0x0003003e, 0x00000029, 0x0000002f, 0x0004003d, 0x00000027, 0x00000033,
-    0x00000029, 0x0005008e, 0x00000027, 0x00000035, 0x00000033, 0x00000034, 0x0006000c, 0x00000027,
-    0x00000036, 0x00000001, 0x00000001, 0x00000035, 0x0004006d, 0x00000030, 0x00000037, 0x00000036,
-    0x0003003e, 0x00000032, 0x00000037, 0x00050041, 0x00000007, 0x0000003a, 0x00000032, 0x00000039,
-    0x0004003d, 0x00000006, 0x0000003b, 0x0000003a, 0x0003003e, 0x00000038, 0x0000003b, 0x00050039,
-    0x00000006, 0x0000003c, 0x0000000a, 0x00000038, 0x00050041, 0x00000007, 0x0000003f, 0x00000032,
-    0x0000003e, 0x0004003d, 0x00000006, 0x00000040, 0x0000003f, 0x0003003e, 0x0000003d, 0x00000040,
-    0x00050039, 0x00000006, 0x00000041, 0x0000000a, 0x0000003d, 0x000500c4, 0x00000006, 0x00000043,
-    0x00000041, 0x00000042, 0x000500c5, 0x00000006, 0x00000044, 0x0000003c, 0x00000043, 0x00050041,
-    0x00000007, 0x00000047, 0x00000032, 0x00000046, 0x0004003d, 0x00000006, 0x00000048, 0x00000047,
-    0x0003003e, 0x00000045, 0x00000048, 0x00050039, 0x00000006, 0x00000049, 0x0000000a, 0x00000045,
-    0x000500c4, 0x00000006, 0x0000004b, 0x00000049, 0x0000004a, 0x000500c5, 0x00000006, 0x0000004c,
-    0x00000044, 0x0000004b, 0x00050041, 0x00000007, 0x0000004f, 0x00000032, 0x0000004e, 0x0004003d,
-    0x00000006, 0x00000050, 0x0000004f, 0x0003003e, 0x0000004d, 0x00000050, 0x00050039, 0x00000006,
-    0x00000051, 0x0000000d, 0x0000004d, 0x000500c4, 0x00000006, 0x00000053, 0x00000051, 0x00000052,
-    0x000500c5, 0x00000006, 0x00000054, 0x0000004c, 0x00000053, 0x000200fe, 0x00000054, 0x00010038,
+const uint8_t Blob071_Data[1869] =
+{
+    0x28, 0xb5, 0x2f, 0xfd, 0x60, 0xa0, 0x15, 0x1d, 0x3a, 0x00, 0x6a, 0x47, 0x4c, 0x10, 0x4b, 0x80,
+    0xda, 0x71, 0xc6, 0x35, 0xb4, 0xd5, 0x7f, 0x12, 0x4a, 0xf5, 0x9f, 0x84, 0x52, 0xfd, 0x27, 0xa1,
+    0x54, 0xbf, 0x35, 0x72, 0xa3, 0x80, 0x6d, 0x14, 0x03, 0x81, 0xa6, 0x0a, 0x6c, 0x05, 0x98, 0x13,
+    0x4d, 0xb9, 0x21, 0x3e, 0xc5, 0x95, 0xe5, 0xba, 0x48, 0xc4, 0xca, 0x77, 0xe6, 0xba, 0x4a, 0xac,
+    0xf6, 0xda, 0x36, 0xd0, 0x95, 0x52, 0xa5, 0xcf, 0x1d, 0x84, 0xf5, 0xe9, 0x66, 0xea, 0x5a, 0x52,
+    0xde, 0x6d, 0xbd, 0xf1, 0xbd, 0x5c, 0xeb, 0x25, 0x3b, 0x05, 0xdc, 0x00, 0xda, 0x00, 0x03, 0x01,
+    0x5a, 0xa9, 0xe5, 0xa0, 0x8c, 0xd7, 0x8c, 0xf2, 0x0c, 0x2b, 0xad, 0x64, 0x78, 0x1b, 0xd9, 0x9e,
+    0x76, 0xd9, 0xaa, 0xa9, 0x7d, 0x6c, 0x9f, 0x5e, 0xad, 0x65, 0xa3, 0x50, 0xc5, 0xb5, 0xbc, 0x5f,
+    0x6d, 0x5c, 0x6e, 0xad, 0x44, 0x22, 0x81, 0x7b, 0x86, 0xe1, 0x24, 0x26, 0xd6, 0x08, 0x2f, 0x5f,
+    0x26, 0x97, 0x2d, 0xc2, 0xae, 0x8f, 0xe8, 0x4a, 0x45, 0x7d, 0xfd, 0xb1, 0x85, 0x3a, 0xfa, 0x26,
+    0xa5, 0xa2, 0x24, 0x2b, 0xb3, 0xf1, 0xee, 0xa8, 0x57, 0xb4, 0xfb, 0x65, 0xe7, 0x14, 0x40, 0x7f,
+    0x8f, 0xab, 0xa9, 0xf4, 0x76, 0xf0, 0x17, 0x6e, 0x77, 0xab, 0x84, 0x63, 0x01, 0xa7, 0x01, 0xb5,
+    0x4b, 0x1e, 0xa4, 0x9e, 0xcb, 0xbe, 0x6d, 0xef, 0xc8, 0xc2, 0xbf, 0x9a, 0x5b, 0x05, 0x76, 0x2a,
+    0x76, 0x8f, 0x00, 0xe8, 0xd9, 0x65, 0x97, 0xb5, 0xff, 0x44, 0x13, 0x66, 0x1e, 0xa1, 0xa2, 0x94,
+    0x13, 0x3c, 0xdc, 0x25, 0x65, 0xf8, 0xfd, 0x60, 0xbb, 0xfa, 0xd9, 0x69, 0xc7, 0xd9, 0x35, 0xbe,
+    0xed, 0x7a, 0xbd, 0x6c, 0xb7, 0x51, 0xcb, 0xed, 0x91, 0xa8, 0xdf, 0xd6, 0x25, 0x6a, 0xb7, 0x6a,
+    0x2b, 0x89, 0x71, 0x6c, 0x24, 0x2a, 0xfd, 0x7c, 0x40, 0xa0, 0x8f, 0x68, 0xfb, 0x6c, 0xcb, 0x89,
+    0x9a, 0xab, 0x6e, 0x96, 0x8b, 0xfa, 0xff, 0xb7, 0x65, 0x93, 0xff, 0x67, 0x34, 0xdc, 0xff, 0xa3,
+    0xa7, 0xf9, 0x4f, 0x85, 0x20, 0x9f, 0xe3, 0x56, 0xfa, 0xfc, 0x84, 0x3f, 0x5f, 0xfa, 0x9b, 0x3f,
+    0xaf, 0xfb, 0xb3, 0x7c, 0xfd, 0xcc, 0x4d, 0xf4, 0xaa, 0xce, 0x89, 0x06, 0x32, 0x96, 0xd2, 0x2c,
+    0x53, 0xc5, 0x4d, 0x94, 0x0d, 0x3a, 0x83, 0x93, 0xe3, 0xfb, 0x93, 0xf0, 0xde, 0x30, 0x52, 0x59,
+    0x0c, 0x0f, 0x93, 0xc8, 0xc6, 0xae, 0x6c, 0x83, 0xaf, 0xc9, 0xac, 0x51, 0x28, 0xf6, 0x83, 0x5d,
+    0x7d, 0x99, 0x8e, 0xc6, 0xf9, 0xeb, 0xc6, 0x38, 0xc9, 0x8f, 0x6c, 0x4c, 0x54, 0x69, 0x50, 0xa9,
+    0x96, 0xe7, 0x1d, 0xb3, 0x3c, 0x25, 0x13, 0x4d, 0x1d, 0xce, 0x2e, 0x8c, 0x59, 0x19, 0x3d, 0x4f,
+    0xa5, 0x87, 0xa6, 0x3c, 0xff, 0x9b, 0x37, 0xa5, 0x9c, 0x83, 0x5e, 0xef, 0x3a, 0x1a, 0xb3, 0xc9,
+    0xdd, 0x22, 0xcd, 0xac, 0xb7, 0x7d, 0x23, 0xdb, 0x29, 0x61, 0x4d, 0x0a, 0xee, 0xad, 0x97, 0xf7,
+    0x3e, 0x52, 0xa7, 0x76, 0xac, 0x93, 0x9e, 0xfe, 0x32, 0xec, 0xc2, 0x3c, 0x99, 0xd5, 0x2e, 0xef,
+    0xbf, 0x76, 0x8b, 0xec, 0xf0, 0x85, 0xe1, 0xe1, 0xf7, 0xcb, 0x8b, 0x95, 0x6d, 0x12, 0x9a, 0xfe,
+    0x3f, 0x52, 0x3b, 0x9d, 0xfb, 0x65, 0x5b, 0x99, 0x05, 0x71, 0xf3, 0xca, 0x17, 0x96, 0xaa, 0x72,
+    0xe1, 0x60, 0x72, 0xee, 0xf0, 0x34, 0x29, 0xc3, 0xc8, 0xf6, 0xfd, 0xc0, 0x6e, 0xdd, 0xc4, 0xa5,
+    0xfc, 0x05, 0xd1, 0x6f, 0xfb, 0x93, 0x75, 0x10, 0x88, 0x3e, 0xb6, 0xf2, 0x16, 0x16, 0x75, 0xef,
+    0xc7, 0x95, 0xda, 0x6d, 0x87, 0x28, 0x64, 0xf8, 0x89, 0x8a, 0x6d, 0xe2, 0xf1, 0x3d, 0x25, 0xd5,
+    0xea, 0xa5, 0xad, 0xa7, 0x38, 0xae, 0xf5, 0xaf, 0x4f, 0xff, 0x5f, 0xd6, 0x48, 0xe4, 0x8c, 0xb4,
+    0xe7, 0x78, 0xcf, 0xc0, 0xfd, 0x06, 0x4f, 0xca, 0x4e, 0xf6, 0x31, 0x27, 0x62, 0x4e, 0xc2, 0xc4,
+    0xc2, 0x0e, 0xd6, 0xe4, 0xab, 0x09, 0x93, 0x2f, 0x26, 0xff, 0x97, 0x68, 0x51, 0x52, 0x4b, 0x82,
+    0xc4, 0xab, 0x86, 0x24, 0xc5, 0x79, 0xdd, 0xf6, 0xae, 0x23, 0x5c, 0x47, 0x8c, 0x14, 0xc1, 0x9d,
+    0xe6, 0x0a, 0x1a, 0x18, 0x21, 0x52, 0xe4, 0x26, 0x87, 0xc8, 0xfa, 0x21, 0x42, 0xb6, 0x82, 0x6c,
+    0xd0, 0x02, 0xb2, 0x95, 0xf5, 0xe3, 0x1a, 0x7c, 0x60, 0xf5, 0xf8, 0xe1, 0xb1, 0x95, 0xea, 0xa0,
+    0x71, 0x9b, 0x21, 0x63, 0x46, 0x96, 0x82, 0xa3, 0x4f, 0xe0, 0xc2, 0x68, 0x0b, 0x8b, 0x21, 0xac,
+    0x15, 0xe9, 0xaf, 0x55, 0x95, 0x3e, 0x88, 0x0a, 0xa7, 0x02, 0x48, 0x4b, 0xfb, 0xbf, 0x48, 0xac,
+    0x89, 0x22, 0xfa, 0x08, 0x54, 0xc4, 0x53, 0x88, 0xf3, 0xc9, 0xc6, 0x09, 0xed, 0x90, 0xdb, 0x70,
+    0xf6, 0x56, 0x24, 0x9c, 0x69, 0xf4, 0x21, 0xde, 0x55, 0x50, 0x83, 0x9f, 0x09, 0xe9, 0xcf, 0x7b,
+    0x88, 0x1e, 0x40, 0x38, 0x6f, 0x3e, 0x78, 0x6d, 0x87, 0x67, 0xb6, 0xf3, 0x06, 0x04, 0x16, 0x94,
+    0x41, 0x70, 0x65, 0x20, 0x43, 0x01, 0x08, 0xba, 0x00, 0x39, 0xdd, 0x89, 0xcb, 0x15, 0x30, 0x71,
+    0xea, 0x8a, 0xa3, 0xaa, 0x0c, 0x18, 0xa4, 0x03, 0xd0, 0xa3, 0xa7, 0x80, 0x19, 0x2c, 0x65, 0x01,
+    0xca, 0xca, 0x0c, 0xa0, 0x3a, 0x32, 0x32, 0x9a, 0xb1, 0x31, 0x31, 0xb1, 0xb0, 0x1b, 0x18, 0xd8,
+    0xd7, 0xff, 0xf5, 0x2f, 0x26, 0x5e, 0x37, 0xaa, 0x4d, 0x5a, 0x43, 0xcb, 0xcd, 0x6e, 0xe8, 0x7a,
+    0xce, 0xcc, 0xdf, 0xeb, 0x5d, 0x5d, 0x5c, 0x5f, 0x9a, 0x49, 0xb2, 0x69, 0xa8, 0x61, 0x58, 0x77,
+    0x6a, 0x50, 0x7a, 0xfe, 0xd0, 0x72, 0xb3, 0x1b, 0xba, 0x9e, 0x33, 0xf3, 0x5c, 0xb9, 0x22, 0x27,
+    0x0f, 0x73, 0x0b, 0x80, 0x96, 0xd6, 0x89, 0xea, 0x04, 0x37, 0xbf, 0xbb, 0x70, 0xe8, 0x24, 0x6c,
+    0xf2, 0x10, 0x6c, 0x02, 0x06, 0x3b, 0x00, 0x39, 0xfc, 0x36, 0x70, 0x50, 0x62, 0x5a, 0x52, 0xf2,
+    0x2d, 0xf5, 0x7c, 0xbc, 0xa4, 0x2e, 0x48, 0x3c, 0x2e, 0x45, 0x47, 0x45, 0x19, 0x34, 0x18, 0x65,
+    0xd8, 0xd9, 0x30, 0x7c, 0x77, 0x81, 0x68, 0xe8, 0x82, 0x05, 0x20, 0x21, 0x0b, 0x49, 0xd3, 0x14,
+    0x4a, 0x83, 0x2a, 0xe8, 0xa0, 0xb0, 0x23, 0xc1, 0x81, 0x8f, 0x84, 0x9d, 0xa2, 0x4f, 0xae, 0x27,
+    0xc2, 0x83, 0xa2, 0x26, 0xa5, 0xa2, 0x9d, 0x0a, 0x34, 0x41, 0x75, 0xc0, 0x43, 0x34, 0x40, 0x80,
+    0x2e, 0x40, 0x8d, 0x4e, 0x8e, 0x0e, 0x4e, 0x0e, 0x03, 0x9c, 0xdb, 0x02, 0x9a, 0x1b, 0x80, 0x9f,
+    0x27, 0x83, 0xe0, 0x66, 0x86, 0x81, 0x03, 0x05, 0x6c, 0x6a, 0x04, 0x66, 0x6a, 0xaa, 0x85, 0xf5,
+    0x36, 0xa1, 0x5d, 0x8e, 0x1d, 0x35, 0xb4, 0x76, 0xe8, 0x38, 0xaa, 0xc9, 0x31, 0x84, 0xc3, 0xc6,
+    0x8d, 0x9c, 0x95, 0x0d, 0xb8, 0xc6, 0xad, 0x60, 0xc4, 0xc0, 0x7a, 0x01, 0x63, 0xf9, 0xe2, 0x0a,
+    0x2b, 0xcb, 0xc5, 0xd5, 0x53, 0xb0, 0xc5, 0x13, 0x8b, 0xe5, 0x0c, 0xef, 0x19, 0xab, 0xb8, 0xd3,
+    0x2c, 0xa5, 0x91, 0x1c, 0xa7, 0x18, 0x8a, 0x93, 0xe6, 0xc7, 0xb8, 0x49, 0x17, 0x45, 0x52, 0xd3,
+    0x50, 0xa8, 0xf7, 0x72, 0x9e, 0x0f, 0xd3, 0x9e, 0x90, 0x9a, 0x32, 0x92, 0xd2, 0x48, 0x7d, 0x14,
+    0x73, 0xe4, 0x97, 0x23, 0x31, 0xac, 0x68, 0x24, 0x3e, 0x61, 0xd3, 0x21, 0x13, 0xb4, 0x1f, 0x41,
+    0x19, 0x99, 0x24, 0x4a, 0x3c, 0x01, 0xa3, 0x48, 0x88, 0x28, 0xc2, 0xa1, 0xb3, 0x0a, 0xb1, 0x84,
+    0x55, 0x15, 0x2a, 0x04, 0x0d, 0xcc, 0x7f, 0xda, 0x85, 0xae, 0x60, 0x11, 0xd1, 0xb3, 0x5e, 0xb9,
+    0x95, 0x17, 0xaf, 0xf2, 0xdb, 0xb0, 0xa8, 0x68, 0xf9, 0x94, 0xd7, 0xa4, 0x3c, 0x8d, 0x72, 0x28,
+    0x01, 0x82, 0xcc, 0xa8, 0x72, 0x48, 0x9b, 0xc9, 0x48, 0x52, 0x50, 0x28, 0x0c, 0x9b, 0x01, 0x52,
+    0x5c, 0x84, 0x68, 0x29, 0x65, 0xd9, 0x06, 0xb2, 0x12, 0x18, 0xe1, 0x24, 0x82, 0x50, 0x29, 0x54,
+    0x50, 0x48, 0xbb, 0x01, 0x13, 0x6e, 0x05, 0x73, 0x05, 0xb5, 0x69, 0xb2, 0x79, 0xa2, 0x38, 0x81,
+    0x42, 0xde, 0x43, 0xeb, 0x20, 0x0a, 0x2d, 0xdc, 0x1b, 0x99, 0x31, 0x32, 0xeb, 0xce, 0x22, 0x98,
+    0x37, 0x83, 0x77, 0x1d, 0x44, 0x1e, 0x68, 0x12, 0x9f, 0x7c, 0xc6, 0x44, 0xfa, 0x4e, 0xfe, 0x6b,
+    0x6e, 0xab, 0xc9, 0x7a, 0x5a, 0x23, 0x3c, 0xb9, 0xdf, 0xf9, 0xdc, 0xf5, 0x9e, 0xb6, 0xcc, 0x04,
+    0xa6, 0xe5, 0x93, 0x68, 0x05, 0x2c, 0x66, 0x94, 0x50, 0xdd, 0xaa, 0x93, 0xd4, 0x9a, 0x0d, 0xc8,
+    0xaa, 0x3f, 0x2d, 0xa5, 0xce, 0xa7, 0x42, 0xa1, 0x85, 0x77, 0x40, 0xc1, 0x48, 0xa9, 0x29, 0xb3,
+    0x31, 0xf8, 0x21, 0xcc, 0xb5, 0x79, 0x22, 0xdf, 0xae, 0x59, 0x4b, 0x80, 0xc3, 0xc2, 0xea, 0x43,
+    0x4b, 0xdb, 0x78, 0x3e, 0xf0, 0x49, 0xed, 0x4c, 0x42, 0x3a, 0x2b, 0x54, 0x7f, 0x8d, 0x53, 0x9b,
+    0xe3, 0x7d, 0x68, 0x33, 0x3a, 0x78, 0xe1, 0x8f, 0x7e, 0x7e, 0x5c, 0x62, 0x87, 0x75, 0x61, 0x96,
+    0xee, 0x2c, 0x6c, 0x5c, 0x98, 0xf3, 0xd2, 0x14, 0x01, 0x1f, 0xcd, 0x5f, 0x79, 0x44, 0xfa, 0x54,
+    0xe8, 0x2b, 0xdd, 0x1c, 0xb1, 0xf2, 0x2f, 0x84, 0xda, 0xbf, 0xc7, 0x17, 0x0b, 0x73, 0xea, 0x3f,
+    0x5f, 0x9d, 0x39, 0x59, 0xb3, 0x05, 0xe4, 0x8d, 0x6a, 0x60, 0xaf, 0x70, 0x3f, 0xe7, 0xab, 0xf8,
+    0x0a, 0xd4, 0x06, 0xee, 0x40, 0x8e, 0xb2, 0x06, 0x1e, 0xe1, 0x31, 0x29, 0x87, 0xf4, 0x69, 0x03,
+    0xea, 0xc1, 0x3c, 0xe3, 0x48, 0xa0, 0x5b, 0xe9, 0x73, 0x41, 0xcd, 0x44, 0x66, 0xa0, 0xd6, 0xce,
+    0x55, 0xbc, 0xa3, 0x37, 0x94, 0x5c, 0x46, 0x45, 0xa6, 0x53, 0x82, 0xff, 0xe8, 0x33, 0x9f, 0x60,
+    0x0c, 0xf0, 0x69, 0x30, 0xdd, 0x20, 0x1d, 0xa2, 0x6a, 0xa9, 0x95, 0x7d, 0xa4, 0xd8, 0x76, 0xdb,
+    0x84, 0x29, 0x77, 0x01, 0x0f, 0x20, 0x7c, 0xb9, 0x41, 0xa6, 0xb4, 0x4f, 0x72, 0xbe, 0xa0, 0xc4,
+    0x1f, 0x29, 0x63, 0x74, 0x6b, 0xb5, 0xf0, 0xb3, 0x40, 0xab, 0x6d, 0x15, 0x9d, 0x2a, 0x0e, 0xe9,
+    0xc8, 0x76, 0x3d, 0xf0, 0x3a, 0xb0, 0x02, 0x9e, 0x09, 0x25, 0x11, 0x97, 0x18, 0x3c, 0xea, 0xba,
+    0x6c, 0x20, 0x54, 0x36, 0x6b, 0x2b, 0xca, 0x6e, 0x3f, 0xfb, 0xfe, 0xaa, 0x49, 0x19, 0x63, 0x79,
+    0xeb, 0xf6, 0xb6, 0xbd, 0xdd, 0x3c, 0x84, 0xa1, 0xef, 0x60, 0x13, 0xaf, 0x26, 0x8c, 0x13, 0xeb,
+    0x42, 0xcd, 0xdd, 0x17, 0x55, 0x9f, 0x04, 0x2b, 0x6c, 0xc4, 0xa1, 0xb6, 0x17, 0xf2, 0x96, 0x05,
+    0xd1, 0xc9, 0x70, 0x3e, 0xcc, 0x05, 0xbc, 0x36, 0x67, 0x29, 0x31, 0x7a, 0x5f, 0x93, 0x79, 0x65,
+    0x32, 0xf7, 0xe3, 0x41, 0x36, 0x60, 0xdd, 0xd1, 0xf1, 0xa8, 0x8d, 0xec, 0x00, 0xfd, 0x48, 0x34,
+    0xb4, 0xc6, 0x37, 0xb3, 0x8e, 0xec, 0x46, 0x90, 0xbd, 0x67, 0xfb, 0x99, 0x71, 0xe8, 0x9b, 0x19,
+    0x00, 0xd7, 0x68, 0xbf, 0x6a, 0x10, 0x65, 0xb1, 0x7e, 0xb6, 0x52, 0xaf, 0xa4, 0xd4, 0x1a, 0x2e,
+    0xa3, 0x69, 0xc6, 0xb6, 0xf1, 0x60, 0x78, 0xa7, 0x93, 0xfa, 0x1b, 0x6f, 0x3c, 0x75, 0xf0, 0xf5,
+    0x93, 0x32, 0x8d, 0x48, 0xc3, 0x8a, 0xac, 0x3e, 0xeb, 0x97, 0x3d, 0xcd, 0x80, 0x41, 0xda, 0x42,
+    0xd0, 0x55, 0x6e, 0x9e, 0xe8, 0x83, 0x51, 0xc6, 0x0e, 0xd0, 0x4f, 0xeb, 0x12, 0x9f, 0xdc, 0x80,
+    0x80, 0x76, 0x65, 0x0d, 0xf4, 0x94, 0x56, 0xd7, 0x4e, 0x3b, 0x1e, 0xc8, 0x3f, 0xc1, 0x93, 0xce,
+    0x1d, 0xe0, 0x40, 0x82, 0xf3, 0x07, 0x32, 0x9d, 0xef, 0x0e, 0xfe, 0x7c, 0x06, 0x0d, 0xe3, 0x9c,
+    0x27, 0xf1, 0xc7, 0x69, 0x7b, 0x61, 0x7b, 0xc2, 0x8f, 0xfe, 0xeb, 0x91, 0xe4, 0x2f, 0xd4, 0xb1,
+    0xfe, 0xa0, 0xf1, 0x12, 0x98, 0xf9, 0xf8, 0x91, 0x7e, 0x79, 0x5b, 0x87, 0xf7, 0xa4, 0xbf, 0x26,
+    0x6e, 0xa8, 0x45, 0xc9, 0xe5, 0x0d, 0xca, 0x0d, 0x54, 0xea, 0x43, 0x67, 0x87, 0x62, 0xd0, 0x57,
+    0x5e, 0x4a, 0x9f, 0xcb, 0xef, 0x60, 0x5e, 0xda, 0xcd, 0xa5, 0xe0, 0xd3, 0x68, 0x8c, 0x51, 0xc7,
+    0x01, 0x41, 0xf2, 0xda, 0x6e, 0x04, 0x1b, 0x4d, 0xee, 0x83, 0x6d, 0x86, 0x6b, 0xdb, 0xe6, 0x24,
+    0x6c, 0x32, 0x1a, 0x89, 0xaa, 0xef, 0x4d, 0x7b, 0x21, 0x30, 0xc0, 0xac, 0xe3, 0xca, 0x10, 0x20,
+    0xaa, 0x38, 0x8d, 0x49, 0x44, 0x9c, 0x2a, 0x14, 0xcd, 0x4c, 0xa1, 0x0e, 0x79, 0x72, 0x39, 0x37,
+    0x83, 0x7b, 0x59, 0xd6, 0x32, 0xb7, 0x77, 0xfa, 0x5b, 0x02, 0x1a, 0xeb, 0x08, 0xdf, 0xbc, 0x05,
+    0x07, 0xec, 0xc5, 0x83, 0x79, 0x01, 0x00, 0x46, 0xc3, 0xc1, 0xf5, 0x5b, 0x70, 0xa0, 0xe2, 0xff,
+    0x25, 0x21, 0xf8, 0x8e, 0x0b, 0x10, 0x82, 0x2c, 0xe5, 0xdb, 0xec, 0x9c, 0x3e, 0x3d, 0x07, 0xb5,
+    0xd0, 0x71, 0x86, 0x97, 0x0b, 0x54, 0xf7, 0xd2, 0x75, 0xf9, 0x72, 0xcd, 0x8a, 0x20, 0xd1, 0xf2,
+    0x42, 0x96, 0x41, 0x27, 0x6c, 0xc6, 0xfd, 0x9a, 0xce, 0xcb, 0x58, 0x84, 0x41, 0xd6, 0xe4, 0x46,
+    0xf2, 0x67, 0xdb, 0x96, 0xaa, 0xed, 0xd1, 0x6b, 0x71, 0x20, 0x81, 0xf6, 0x14, 0xb3, 0x27, 0xe8,
+    0x76, 0x52, 0x43, 0x8e, 0x4e, 0xf1, 0xb8, 0xb7, 0xdb, 0x13, 0x44, 0x1d, 0x36, 0x4e, 0xef, 0xc8,
+    0x27, 0x74, 0x44, 0x07, 0xbf, 0x0f, 0xaf, 0xad, 0xff, 0xa0, 0x9a, 0x1f, 0x89, 0xbd, 0xd8, 0xe0,
+    0x68, 0x8b, 0xbd, 0x00, 0xf2, 0x89, 0x99, 0x7f, 0x16, 0xfc, 0x57, 0x6d, 0x67, 0x16, 0x03, 0x48,
+    0xda, 0x09, 0x7d, 0xf1, 0x17, 0xac, 0x7d, 0x07, 0xc0, 0xd1, 0x11, 0xf8, 0xe1, 0xb7, 0x59, 0xfc,
+    0x9e, 0xce, 0xc9, 0x47, 0x74, 0xac, 0x56, 0xce, 0x17, 0xe8, 0x71, 0xee, 0x10,
 };
+const ShaderModule Blob071 = { Blob071_Data, 1869u, 1448u, 71u };
 
-extern const uint32_t Blob109[1448];
-const uint32_t Blob109[1448] = {
-    0x07230203, 0x00010300, 0x0008000b, 0x000000b8, 0x00000000, 0x00020011, 0x00000001, 0x0006000b,
-    0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001,
-    0x0006000f, 0x00000005, 0x00000004, 0x6e69616d, 0x00000000, 0x0000005c, 0x00060010, 0x00000004,
-    0x00000011, 0x00000008, 0x00000008, 0x00000001, 0x00030003, 0x00000002, 0x000001c2, 0x000a0004,
-    0x475f4c47, 0x4c474f4f, 0x70635f45, 0x74735f70, 0x5f656c79, 0x656e696c, 0x7269645f, 0x69746365,
-    0x00006576, 0x00080004, 0x475f4c47, 0x4c474f4f, 0x6e695f45, 0x64756c63, 0x69645f65, 0x74636572,
-    0x00657669, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000, 0x00070005, 0x0000000a, 0x726f6e55,
-    0x6f54386d, 0x36626752, 0x3b317528, 0x00000000, 0x00040005, 0x00000009, 0x756c6176, 0x00000065,
-    0x00070005, 0x0000000d, 0x726f6e55, 0x6f54386d, 0x68706c41, 0x75283561, 0x00003b31, 0x00040005,
-    0x0000000c, 0x756c6176, 0x00000065, 0x00070005, 0x00000014, 0x64616f4c, 0x616e6946, 0x2842466c,
-    0x3b326976, 0x00000000, 0x00050005, 0x00000013, 0x69736f70, 0x6e6f6974, 0x00000000, 0x00040005,
-    0x00000029, 0x65786574, 0x0000006c, 0x00040005, 0x0000002c, 0x616e6946, 0x0042466c, 0x00050005,
-    0x00000032, 0x6e617571, 0x657a6974, 0x00000064, 0x00040005, 0x00000038, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000003d, 0x61726170, 0x0000006d, 0x00040005, 0x00000045, 0x61726170, 0x0000006d,
-    0x00040005, 0x0000004d, 0x61726170, 0x0000006d, 0x00030005, 0x00000059, 0x00006469, 0x00080005,
-    0x0000005c, 0x475f6c67, 0x61626f6c, 0x766e496c, 0x7461636f, 0x496e6f69, 0x00000044, 0x00050005,
-    0x0000006f, 0x4f74756f, 0x65736666, 0x00000074, 0x00040005, 0x00000076, 0x746e6563, 0x00006572,
-    0x00050005, 0x00000077, 0x65726353, 0x69576e65, 0x00687464, 0x00050005, 0x00000079, 0x6c616353,
-    0x63614665, 0x00726f74, 0x00040005, 0x0000007c, 0x72756f73, 0x00006563, 0x00090005, 0x00000085,
-    0x73657250, 0x61746e65, 0x6e6f6974, 0x7074754f, 0x75427475, 0x72656666, 0x00000000, 0x00080006,
-    0x00000085, 0x00000000, 0x73657250, 0x61746e65, 0x6e6f6974, 0x7074754f, 0x00007475, 0x00030005,
-    0x00000087, 0x00000000, 0x00040005, 0x0000008c, 0x61726170, 0x0000006d, 0x00060005, 0x00000090,
-    0x65726353, 0x65486e65, 0x74686769, 0x00000000, 0x00060005, 0x00000091, 0x5778614d, 0x546b726f,
-    0x73656c69, 0x00000000, 0x00070005, 0x00000093, 0x6d617246, 0x66756265, 0x53726566, 0x64697274,
-    0x00000065, 0x00060005, 0x00000095, 0x656c6954, 0x72655073, 0x656e694c, 0x00000000, 0x00050005,
-    0x00000096, 0x656c6954, 0x656e694c, 0x00000073, 0x00050005, 0x0000009d, 0x6174654d, 0x66696e55,
-    0x006d726f, 0x00060006, 0x0000009d, 0x00000000, 0x506d754e, 0x67796c6f, 0x00736e6f, 0x00060006,
-    0x0000009d, 0x00000001, 0x566d754e, 0x61697261, 0x0073746e, 0x00060006, 0x0000009d, 0x00000002,
-    0x68706c41, 0x66655261, 0x00000000, 0x00050006, 0x0000009d, 0x00000003, 0x70736944, 0x00746e43,
-    0x00060006, 0x0000009d, 0x00000004, 0x6e6f6f54, 0x6c626154, 0x00000065, 0x00060006, 0x0000009d,
-    0x00000005, 0x61656c43, 0x6c6f4372, 0x0000726f, 0x00060006, 0x0000009d, 0x00000006, 0x61656c43,
-    0x70654472, 0x00006874, 0x00060006, 0x0000009d, 0x00000007, 0x61656c43, 0x74744172, 0x00000072,
-    0x00060006, 0x0000009d, 0x00000008, 0x4f676f46, 0x65736666, 0x00000074, 0x00060006, 0x0000009d,
-    0x00000009, 0x53676f46, 0x74666968, 0x00000000, 0x00060006, 0x0000009d, 0x0000000a, 0x43676f46,
-    0x726f6c6f, 0x00000000, 0x00080006, 0x0000009d, 0x0000000b, 0x61656c43, 0x74694272, 0x4f70616d,
-    0x65736666, 0x00000074, 0x00030005, 0x0000009f, 0x00000000, 0x00060005, 0x000000a0, 0x68737550,
-    0x736e6f43, 0x746e6174, 0x00000073, 0x00060006, 0x000000a0, 0x00000000, 0x56727543, 0x61697261,
-    0x0000746e, 0x00060006, 0x000000a0, 0x00000001, 0x57786554, 0x68746469, 0x00000000, 0x00060006,
-    0x000000a0, 0x00000002, 0x48786554, 0x68676965, 0x00000074, 0x00060006, 0x000000a0, 0x00000003,
-    0x57786554, 0x53706172, 0x00000000, 0x00060006, 0x000000a0, 0x00000004, 0x57786554, 0x54706172,
-    0x00000000, 0x00070006, 0x000000a0, 0x00000005, 0x49786554, 0x70614373, 0x65727574, 0x00000000,
-    0x00070006, 0x000000a0, 0x00000006, 0x74706143, 0x59657275, 0x7366664f, 0x00007465, 0x00050006,
-    0x000000a0, 0x00000007, 0x6461705f, 0x00000000, 0x00030005, 0x000000a2, 0x00006370, 0x00080005,
-    0x000000a5, 0x75727453, 0x72757463, 0x6e496465, 0x42747570, 0x65666675, 0x00000072, 0x00070006,
-    0x000000a5, 0x00000000, 0x75727453, 0x72757463, 0x6e496465, 0x00747570, 0x00030005, 0x000000a7,
-    0x00000000, 0x00080005, 0x000000a9, 0x74706143, 0x53657275, 0x63656469, 0x75427261, 0x72656666,
-    0x00000000, 0x00090006, 0x000000a9, 0x00000000, 0x74706143, 0x53657275, 0x63656469, 0x69507261,
-    0x736c6578, 0x00000000, 0x00030005, 0x000000ab, 0x00000000, 0x00060005, 0x000000ac, 0x65726944,
-    0x754f7463, 0x74757074, 0x00706f54, 0x00070005, 0x000000ad, 0x65726944, 0x754f7463, 0x74757074,
-    0x74746f42, 0x00006d6f, 0x00040047, 0x0000002c, 0x00000022, 0x00000000, 0x00040047, 0x0000002c,
-    0x00000021, 0x0000000b, 0x00030047, 0x0000002c, 0x00000018, 0x00040047, 0x0000005c, 0x0000000b,
-    0x0000001c, 0x00040047, 0x00000077, 0x00000001, 0x00000000, 0x00040047, 0x00000084, 0x00000006,
-    0x00000004, 0x00050048, 0x00000085, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000085,
-    0x00000002, 0x00040047, 0x00000087, 0x00000022, 0x00000000, 0x00040047, 0x00000087, 0x00000021,
-    0x0000000d, 0x00040047, 0x00000090, 0x00000001, 0x00000001, 0x00040047, 0x00000091, 0x00000001,
-    0x00000002, 0x00040047, 0x0000009b, 0x00000006, 0x00000010, 0x00050048, 0x0000009d, 0x00000000,
-    0x00000023, 0x00000000, 0x00050048, 0x0000009d, 0x00000001, 0x00000023, 0x00000004, 0x00050048,
-    0x0000009d, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x0000009d, 0x00000003, 0x00000023,
-    0x0000000c, 0x00050048, 0x0000009d, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x0000009d,
-    0x00000005, 0x00000023, 0x00000230, 0x00050048, 0x0000009d, 0x00000006, 0x00000023, 0x00000234,
-    0x00050048, 0x0000009d, 0x00000007, 0x00000023, 0x00000238, 0x00050048, 0x0000009d, 0x00000008,
-    0x00000023, 0x0000023c, 0x00050048, 0x0000009d, 0x00000009, 0x00000023, 0x00000240, 0x00050048,
-    0x0000009d, 0x0000000a, 0x00000023, 0x00000244, 0x00050048, 0x0000009d, 0x0000000b, 0x00000023,
-    0x00000248, 0x00030047, 0x0000009d, 0x00000002, 0x00040047, 0x0000009f, 0x00000022, 0x00000000,
-    0x00040047, 0x0000009f, 0x00000021, 0x00000000, 0x00050048, 0x000000a0, 0x00000000, 0x00000023,
-    0x00000000, 0x00050048, 0x000000a0, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x000000a0,
-    0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x000000a0, 0x00000003, 0x00000023, 0x0000000c,
-    0x00050048, 0x000000a0, 0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x000000a0, 0x00000005,
-    0x00000023, 0x00000014, 0x00050048, 0x000000a0, 0x00000006, 0x00000023, 0x00000018, 0x00050048,
-    0x000000a0, 0x00000007, 0x00000023, 0x0000001c, 0x00030047, 0x000000a0, 0x00000002, 0x00040047,
-    0x000000a4, 0x00000006, 0x00000004, 0x00040048, 0x000000a5, 0x00000000, 0x00000018, 0x00050048,
-    0x000000a5, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x000000a5, 0x00000002, 0x00040047,
-    0x000000a7, 0x00000022, 0x00000000, 0x00040047, 0x000000a7, 0x00000021, 0x0000000c, 0x00040047,
-    0x000000a8, 0x00000006, 0x00000004, 0x00050048, 0x000000a9, 0x00000000, 0x00000023, 0x00000000,
-    0x00030047, 0x000000a9, 0x00000002, 0x00040047, 0x000000ab, 0x00000022, 0x00000000, 0x00040047,
-    0x000000ab, 0x00000021, 0x0000000e, 0x00040047, 0x000000ac, 0x00000022, 0x00000000, 0x00040047,
-    0x000000ac, 0x00000021, 0x00000011, 0x00030047, 0x000000ac, 0x00000019, 0x00040047, 0x000000ad,
-    0x00000022, 0x00000000, 0x00040047, 0x000000ad, 0x00000021, 0x00000012, 0x00030047, 0x000000ad,
-    0x00000019, 0x00040047, 0x000000b7, 0x0000000b, 0x00000019, 0x00020013, 0x00000002, 0x00030021,
-    0x00000003, 0x00000002, 0x00040015, 0x00000006, 0x00000020, 0x00000000, 0x00040020, 0x00000007,
-    0x00000007, 0x00000006, 0x00040021, 0x00000008, 0x00000006, 0x00000007, 0x00040015, 0x0000000f,
-    0x00000020, 0x00000001, 0x00040017, 0x00000010, 0x0000000f, 0x00000002, 0x00040020, 0x00000011,
-    0x00000007, 0x00000010, 0x00040021, 0x00000012, 0x00000006, 0x00000011, 0x0004002b, 0x00000006,
-    0x00000017, 0x0000003f, 0x0004002b, 0x00000006, 0x00000019, 0x0000007f, 0x0004002b, 0x00000006,
-    0x0000001b, 0x000000ff, 0x0004002b, 0x00000006, 0x00000020, 0x0000001f, 0x00030016, 0x00000026,
-    0x00000020, 0x00040017, 0x00000027, 0x00000026, 0x00000004, 0x00040020, 0x00000028, 0x00000007,
-    0x00000027, 0x00090019, 0x0000002a, 0x00000026, 0x00000001, 0x00000000, 0x00000000, 0x00000000,
-    0x00000002, 0x00000004, 0x00040020, 0x0000002b, 0x00000000, 0x0000002a, 0x0004003b, 0x0000002b,
-    0x0000002c, 0x00000000, 0x00040017, 0x00000030, 0x00000006, 0x00000004, 0x00040020, 0x00000031,
-    0x00000007, 0x00000030, 0x0004002b, 0x00000026, 0x00000034, 0x437f0000, 0x0004002b, 0x00000006,
-    0x00000039, 0x00000000, 0x0004002b, 0x00000006, 0x0000003e, 0x00000001, 0x0004002b, 0x0000000f,
-    0x00000042, 0x00000008, 0x0004002b, 0x00000006, 0x00000046, 0x00000002, 0x0004002b, 0x0000000f,
-    0x0000004a, 0x00000010, 0x0004002b, 0x00000006, 0x0000004e, 0x00000003, 0x0004002b, 0x0000000f,
-    0x00000052, 0x00000018, 0x00040017, 0x00000057, 0x00000006, 0x00000002, 0x00040020, 0x00000058,
-    0x00000007, 0x00000057, 0x00040017, 0x0000005a, 0x00000006, 0x00000003, 0x00040020, 0x0000005b,
-    0x00000001, 0x0000005a, 0x0004003b, 0x0000005b, 0x0000005c, 0x00000001, 0x00020014, 0x0000005f,
-    0x0004002b, 0x00000006, 0x00000062, 0x00000100, 0x0004002b, 0x00000006, 0x00000069, 0x000000c0,
-    0x00040032, 0x0000000f, 0x00000077, 0x00000100, 0x0004002b, 0x0000000f, 0x00000078, 0x00000100,
-    0x00060034, 0x0000000f, 0x00000079, 0x00000087, 0x00000077, 0x00000078, 0x00060034, 0x00000006,
-    0x0000007a, 0x00000080, 0x00000079, 0x00000039, 0x00060034, 0x00000006, 0x0000007b, 0x000000c2,
-    0x0000007a, 0x0000003e, 0x00060034, 0x00000006, 0x0000007e, 0x00000080, 0x00000079, 0x00000039,
-    0x0003001d, 0x00000084, 0x00000006, 0x0003001e, 0x00000085, 0x00000084, 0x00040020, 0x00000086,
-    0x0000000c, 0x00000085, 0x0004003b, 0x00000086, 0x00000087, 0x0000000c, 0x0004002b, 0x0000000f,
-    0x00000088, 0x00000000, 0x00040020, 0x0000008e, 0x0000000c, 0x00000006, 0x00040032, 0x0000000f,
-    0x00000090, 0x000000c0, 0x00040032, 0x0000000f, 0x00000091, 0x00003000, 0x0004002b, 0x0000000f,
-    0x00000092, 0x000000c0, 0x00060034, 0x0000000f, 0x00000093, 0x00000084, 0x00000077, 0x00000090,
-    0x0004002b, 0x0000000f, 0x00000094, 0x00000020, 0x00060034, 0x0000000f, 0x00000095, 0x00000087,
-    0x00000077, 0x00000094, 0x00060034, 0x0000000f, 0x00000096, 0x00000087, 0x00000090, 0x00000094,
-    0x0004002b, 0x0000000f, 0x00000097, 0x00000040, 0x0004002b, 0x0000000f, 0x00000098, 0x00000002,
-    0x0004002b, 0x0000000f, 0x00000099, 0x00000800, 0x0004002b, 0x00000006, 0x0000009a, 0x00000022,
-    0x0004001c, 0x0000009b, 0x00000030, 0x0000009a, 0x00040017, 0x0000009c, 0x00000026, 0x00000002,
-    0x000e001e, 0x0000009d, 0x00000006, 0x00000006, 0x0000000f, 0x00000006, 0x0000009b, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x0000009c, 0x00040020, 0x0000009e,
-    0x00000002, 0x0000009d, 0x0004003b, 0x0000009e, 0x0000009f, 0x00000002, 0x000a001e, 0x000000a0,
-    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x0000000f, 0x00000006,
-    0x00040020, 0x000000a1, 0x00000009, 0x000000a0, 0x0004003b, 0x000000a1, 0x000000a2, 0x00000009,
-    0x0004002b, 0x0000000f, 0x000000a3, 0x0000c000, 0x0003001d, 0x000000a4, 0x00000006, 0x0003001e,
-    0x000000a5, 0x000000a4, 0x00040020, 0x000000a6, 0x0000000c, 0x000000a5, 0x0004003b, 0x000000a6,
-    0x000000a7, 0x0000000c, 0x0003001d, 0x000000a8, 0x00000006, 0x0003001e, 0x000000a9, 0x000000a8,
-    0x00040020, 0x000000aa, 0x0000000c, 0x000000a9, 0x0004003b, 0x000000aa, 0x000000ab, 0x0000000c,
-    0x0004003b, 0x0000002b, 0x000000ac, 0x00000000, 0x0004003b, 0x0000002b, 0x000000ad, 0x00000000,
-    0x0004002b, 0x00000006, 0x000000ae, 0x0000c000, 0x0004002b, 0x00000006, 0x000000af, 0x00030000,
-    0x0004002b, 0x00000006, 0x000000b0, 0x00060000, 0x0004002b, 0x00000006, 0x000000b1, 0x00090000,
-    0x0004002b, 0x00000006, 0x000000b2, 0x0009c000, 0x0004002b, 0x00000006, 0x000000b3, 0x000a8000,
-    0x0004002b, 0x00000006, 0x000000b4, 0x000a8180, 0x0004002b, 0x00000006, 0x000000b5, 0x00000020,
-    0x0004002b, 0x00000006, 0x000000b6, 0x00000008, 0x0006002c, 0x0000005a, 0x000000b7, 0x000000b6,
-    0x000000b6, 0x0000003e, 0x00050036, 0x00000002, 0x00000004, 0x00000000, 0x00000003, 0x000200f8,
-    0x00000005, 0x0004003b, 0x00000058, 0x00000059, 0x00000007, 0x0004003b, 0x00000007, 0x0000006f,
-    0x00000007, 0x0004003b, 0x00000007, 0x00000076, 0x00000007, 0x0004003b, 0x00000058, 0x0000007c,
-    0x00000007, 0x0004003b, 0x00000011, 0x0000008c, 0x00000007, 0x0004003d, 0x0000005a, 0x0000005d,
-    0x0000005c, 0x0007004f, 0x00000057, 0x0000005e, 0x0000005d, 0x0000005d, 0x00000000, 0x00000001,
-    0x0003003e, 0x00000059, 0x0000005e, 0x00050041, 0x00000007, 0x00000060, 0x00000059, 0x00000039,
-    0x0004003d, 0x00000006, 0x00000061, 0x00000060, 0x000500ae, 0x0000005f, 0x00000063, 0x00000061,
-    0x00000062, 0x000400a8, 0x0000005f, 0x00000064, 0x00000063, 0x000300f7, 0x00000066, 0x00000000,
-    0x000400fa, 0x00000064, 0x00000065, 0x00000066, 0x000200f8, 0x00000065, 0x00050041, 0x00000007,
-    0x00000067, 0x00000059, 0x0000003e, 0x0004003d, 0x00000006, 0x00000068, 0x00000067, 0x000500ae,
-    0x0000005f, 0x0000006a, 0x00000068, 0x00000069, 0x000200f9, 0x00000066, 0x000200f8, 0x00000066,
-    0x000700f5, 0x0000005f, 0x0000006b, 0x00000063, 0x00000005, 0x0000006a, 0x00000065, 0x000300f7,
-    0x0000006d, 0x00000000, 0x000400fa, 0x0000006b, 0x0000006c, 0x0000006d, 0x000200f8, 0x0000006c,
-    0x000100fd, 0x000200f8, 0x0000006d, 0x00050041, 0x00000007, 0x00000070, 0x00000059, 0x00000039,
-    0x0004003d, 0x00000006, 0x00000071, 0x00000070, 0x00050041, 0x00000007, 0x00000072, 0x00000059,
-    0x0000003e, 0x0004003d, 0x00000006, 0x00000073, 0x00000072, 0x00050084, 0x00000006, 0x00000074,
-    0x00000073, 0x00000062, 0x00050080, 0x00000006, 0x00000075, 0x00000071, 0x00000074, 0x0003003e,
-    0x0000006f, 0x00000075, 0x0003003e, 0x00000076, 0x0000007b, 0x0004003d, 0x00000057, 0x0000007d,
-    0x00000059, 0x00050050, 0x00000057, 0x0000007f, 0x0000007e, 0x0000007e, 0x00050084, 0x00000057,
-    0x00000080, 0x0000007d, 0x0000007f, 0x0004003d, 0x00000006, 0x00000081, 0x00000076, 0x00050050,
-    0x00000057, 0x00000082, 0x00000081, 0x00000081, 0x00050080, 0x00000057, 0x00000083, 0x00000080,
-    0x00000082, 0x0003003e, 0x0000007c, 0x00000083, 0x0004003d, 0x00000006, 0x00000089, 0x0000006f,
-    0x0004003d, 0x00000057, 0x0000008a, 0x0000007c, 0x0004007c, 0x00000010, 0x0000008b, 0x0000008a,
-    0x0003003e, 0x0000008c, 0x0000008b, 0x00050039, 0x00000006, 0x0000008d, 0x00000014, 0x0000008c,
-    0x00060041, 0x0000008e, 0x0000008f, 0x00000087, 0x00000088, 0x00000089, 0x0003003e, 0x0000008f,
-    0x0000008d, 0x000100fd, 0x00010038, 0x00050036, 0x00000006, 0x0000000a, 0x00000000, 0x00000008,
-    0x00030037, 0x00000007, 0x00000009, 0x000200f8, 0x0000000b, 0x0004003d, 0x00000006, 0x00000016,
-    0x00000009, 0x00050084, 0x00000006, 0x00000018, 0x00000016, 0x00000017, 0x00050080, 0x00000006,
-    0x0000001a, 0x00000018, 0x00000019, 0x00050086, 0x00000006, 0x0000001c, 0x0000001a, 0x0000001b,
-    0x000200fe, 0x0000001c, 0x00010038, 0x00050036, 0x00000006, 0x0000000d, 0x00000000, 0x00000008,
-    0x00030037, 0x00000007, 0x0000000c, 0x000200f8, 0x0000000e, 0x0004003d, 0x00000006, 0x0000001f,
-    0x0000000c, 0x00050084, 0x00000006, 0x00000021, 0x0000001f, 0x00000020, 0x00050080, 0x00000006,
-    0x00000022, 0x00000021, 0x00000019, 0x00050086, 0x00000006, 0x00000023, 0x00000022, 0x0000001b,
-    0x000200fe, 0x00000023, 0x00010038, 0x00050036, 0x00000006, 0x00000014, 0x00000000, 0x00000012,
-    0x00030037, 0x00000011, 0x00000013, 0x000200f8, 0x00000015, 0x0004003b, 0x00000028, 0x00000029,
-    0x00000007, 0x0004003b, 0x00000031, 0x00000032, 0x00000007, 0x0004003b, 0x00000007, 0x00000038,
-    0x00000007, 0x0004003b, 0x00000007, 0x0000003d, 0x00000007, 0x0004003b, 0x00000007, 0x00000045,
-    0x00000007, 0x0004003b, 0x00000007, 0x0000004d, 0x00000007, 0x0004003d, 0x0000002a, 0x0000002d,
-    0x0000002c, 0x0004003d, 0x00000010, 0x0000002e, 0x00000013, 0x00050062, 0x00000027, 0x0000002f,
-    0x0000002d, 0x0000002e, 0x0003003e, 0x00000029, 0x0000002f, 0x0004003d, 0x00000027, 0x00000033,
-    0x00000029, 0x0005008e, 0x00000027, 0x00000035, 0x00000033, 0x00000034, 0x0006000c, 0x00000027,
-    0x00000036, 0x00000001, 0x00000001, 0x00000035, 0x0004006d, 0x00000030, 0x00000037, 0x00000036,
-    0x0003003e, 0x00000032, 0x00000037, 0x00050041, 0x00000007, 0x0000003a, 0x00000032, 0x00000039,
-    0x0004003d, 0x00000006, 0x0000003b, 0x0000003a, 0x0003003e, 0x00000038, 0x0000003b, 0x00050039,
-    0x00000006, 0x0000003c, 0x0000000a, 0x00000038, 0x00050041, 0x00000007, 0x0000003f, 0x00000032,
-    0x0000003e, 0x0004003d, 0x00000006, 0x00000040, 0x0000003f, 0x0003003e, 0x0000003d, 0x00000040,
-    0x00050039, 0x00000006, 0x00000041, 0x0000000a, 0x0000003d, 0x000500c4, 0x00000006, 0x00000043,
-    0x00000041, 0x00000042, 0x000500c5, 0x00000006, 0x00000044, 0x0000003c, 0x00000043, 0x00050041,
-    0x00000007, 0x00000047, 0x00000032, 0x00000046, 0x0004003d, 0x00000006, 0x00000048, 0x00000047,
-    0x0003003e, 0x00000045, 0x00000048, 0x00050039, 0x00000006, 0x00000049, 0x0000000a, 0x00000045,
-    0x000500c4, 0x00000006, 0x0000004b, 0x00000049, 0x0000004a, 0x000500c5, 0x00000006, 0x0000004c,
-    0x00000044, 0x0000004b, 0x00050041, 0x00000007, 0x0000004f, 0x00000032, 0x0000004e, 0x0004003d,
-    0x00000006, 0x00000050, 0x0000004f, 0x0003003e, 0x0000004d, 0x00000050, 0x00050039, 0x00000006,
-    0x00000051, 0x0000000d, 0x0000004d, 0x000500c4, 0x00000006, 0x00000053, 0x00000051, 0x00000052,
-    0x000500c5, 0x00000006, 0x00000054, 0x0000004c, 0x00000053, 0x000200fe, 0x00000054, 0x00010038,
+const uint8_t Blob109_Data[1867] =
+{
+    0x28, 0xb5, 0x2f, 0xfd, 0x60, 0xa0, 0x15, 0x0d, 0x3a, 0x00, 0xda, 0x46, 0x38, 0x10, 0x4b, 0x80,
+    0xd8, 0x75, 0xc6, 0x35, 0x48, 0xc8, 0x2d, 0xe5, 0x96, 0x72, 0x4b, 0xb9, 0xa5, 0xdc, 0x52, 0x6e,
+    0x29, 0x1f, 0x84, 0x53, 0x7d, 0x00, 0x20, 0x72, 0xe4, 0x04, 0x70, 0x02, 0x00, 0x40, 0x00, 0x10,
+    0x04, 0x0c, 0x8a, 0x26, 0x48, 0x42, 0x49, 0xa3, 0x2d, 0x69, 0x64, 0xd9, 0x9c, 0x91, 0xe6, 0x25,
+    0x50, 0xfe, 0xa8, 0x12, 0x7b, 0x13, 0xbf, 0x1a, 0xd9, 0xc4, 0xc4, 0x44, 0xb4, 0x2d, 0x07, 0x02,
+    0x81, 0x80, 0xed, 0x8d, 0xb4, 0xd1, 0xf8, 0xb8, 0x64, 0xa7, 0xdc, 0x00, 0xda, 0x00, 0x01, 0x01,
+    0x3f, 0x1a, 0xde, 0xcc, 0x3d, 0x03, 0x61, 0x9c, 0x66, 0x9c, 0xeb, 0x98, 0x49, 0x35, 0xc7, 0xb4,
+    0xb1, 0xe5, 0xed, 0xb7, 0x9d, 0x52, 0xd2, 0x47, 0x77, 0x08, 0xef, 0x3d, 0x1b, 0x83, 0x28, 0xbe,
+    0x67, 0x1a, 0xde, 0xc6, 0x26, 0xbd, 0x99, 0x48, 0xe4, 0x8f, 0xae, 0xe3, 0x58, 0xa9, 0xa9, 0x35,
+    0xc6, 0x4d, 0xb8, 0xe9, 0x6d, 0x8b, 0xf1, 0xdb, 0x23, 0xbe, 0x49, 0xf6, 0x47, 0x17, 0xea, 0xe9,
+    0x9d, 0x96, 0x8a, 0x96, 0xed, 0xdc, 0xca, 0xba, 0xe3, 0x4e, 0xe1, 0xd2, 0x70, 0x5b, 0x9f, 0x00,
+    0xfa, 0x7b, 0xde, 0x2d, 0xb5, 0xe9, 0x06, 0x87, 0x63, 0x97, 0x76, 0x99, 0xb1, 0x1c, 0xe0, 0x33,
+    0x20, 0xb7, 0xc9, 0x93, 0xc4, 0x7b, 0x5b, 0xd8, 0xe5, 0x1d, 0xdb, 0xd8, 0x57, 0x63, 0xa3, 0xd0,
+    0x2a, 0xe5, 0x17, 0x69, 0x66, 0xd7, 0x6f, 0xdb, 0xa4, 0xfd, 0x27, 0x92, 0x50, 0xf3, 0x08, 0x15,
+    0x93, 0x4f, 0xb1, 0x50, 0xb7, 0x9c, 0x63, 0xb8, 0x43, 0xed, 0xeb, 0x65, 0x9f, 0x1d, 0xeb, 0xd7,
+    0x08, 0xbb, 0xec, 0x77, 0xd3, 0xa5, 0x8d, 0x7b, 0x76, 0x8f, 0xc4, 0x0d, 0xbb, 0x2f, 0x71, 0xbf,
+    0x53, 0x34, 0x93, 0x28, 0xcb, 0x46, 0xe2, 0x92, 0xaf, 0xf7, 0xfb, 0xf5, 0x88, 0xb5, 0xcb, 0xb2,
+    0xa0, 0xe9, 0xc9, 0xe6, 0x64, 0xb8, 0xa8, 0xff, 0x87, 0xdd, 0x76, 0x29, 0x9b, 0xdd, 0xfe, 0x3f,
+    0x3d, 0xcd, 0x7f, 0x28, 0x04, 0xf9, 0x1c, 0x69, 0xa6, 0x8f, 0x2f, 0xe8, 0xeb, 0xa9, 0xff, 0x79,
+    0xf4, 0xb9, 0xff, 0xca, 0xd9, 0xcb, 0xfc, 0x4c, 0xbf, 0xea, 0xa0, 0x69, 0x30, 0x98, 0xd4, 0xab,
+    0x13, 0xc5, 0x4d, 0x94, 0x4d, 0x2a, 0x93, 0xb3, 0xa0, 0xf7, 0x2f, 0x63, 0x9a, 0x8e, 0x93, 0xc6,
+    0xe4, 0x58, 0xa8, 0x24, 0x16, 0x76, 0xa6, 0x0b, 0x3c, 0x6d, 0x6e, 0x8d, 0x41, 0xb0, 0xdf, 0xeb,
+    0x2b, 0xdc, 0x74, 0x34, 0xd6, 0x5d, 0x37, 0xca, 0x48, 0x7e, 0x6c, 0x65, 0xe2, 0x3a, 0x83, 0x52,
+    0xf7, 0x5c, 0xd3, 0x72, 0xbb, 0x63, 0x36, 0xcd, 0x56, 0xa1, 0xec, 0x41, 0xb9, 0x9d, 0x53, 0xf4,
+    0x52, 0x5b, 0x78, 0x7e, 0xae, 0xaf, 0x9e, 0xde, 0x29, 0x99, 0x35, 0x90, 0xeb, 0x5b, 0x4f, 0xe5,
+    0x76, 0x49, 0xbb, 0x49, 0x32, 0xec, 0x6b, 0xa7, 0x91, 0xae, 0x32, 0x48, 0x4b, 0xc6, 0x3c, 0xf6,
+    0x33, 0x4d, 0x23, 0xad, 0x4a, 0x5a, 0xde, 0x4a, 0x57, 0xff, 0x39, 0x7e, 0xe3, 0xdd, 0xdc, 0xee,
+    0x77, 0xf7, 0x7f, 0xbf, 0xc5, 0x56, 0x08, 0xc7, 0xb1, 0xf0, 0x34, 0xbc, 0x93, 0x99, 0xae, 0x52,
+    0xaa, 0xfe, 0x3f, 0x72, 0x3f, 0xa1, 0x34, 0xdc, 0xba, 0x73, 0xeb, 0xe1, 0xe7, 0x99, 0x70, 0x9c,
+    0x9c, 0x7a, 0x63, 0xe0, 0xb2, 0xde, 0x70, 0x75, 0x39, 0xc7, 0x48, 0x17, 0xee, 0xd0, 0xd2, 0xdb,
+    0x49, 0x8b, 0xe9, 0xfb, 0xb1, 0x61, 0xd7, 0x37, 0x6f, 0xa0, 0x8f, 0x7d, 0x74, 0x67, 0x3a, 0x58,
+    0xdc, 0x3c, 0x1e, 0x67, 0xee, 0xd7, 0x15, 0x9a, 0x98, 0xe3, 0xa1, 0x54, 0xeb, 0xa4, 0xe3, 0xb4,
+    0x32, 0xe9, 0x6e, 0xa6, 0xac, 0x99, 0x8d, 0x63, 0xfd, 0xec, 0xd5, 0xff, 0x9f, 0x37, 0x12, 0x59,
+    0x27, 0xd1, 0xb5, 0x4c, 0xd7, 0x01, 0x4f, 0xee, 0xa4, 0xc9, 0xd8, 0xc5, 0x1e, 0xc6, 0x04, 0x8c,
+    0xc9, 0x17, 0xd8, 0xd7, 0xbd, 0x96, 0x74, 0x2d, 0x51, 0xd2, 0xa5, 0x04, 0x4b, 0x12, 0x1a, 0x92,
+    0x23, 0x5c, 0xb4, 0x23, 0xea, 0x8d, 0xeb, 0xb5, 0x2d, 0x23, 0x5a, 0x46, 0x8a, 0x10, 0xb9, 0x9d,
+    0x06, 0x2d, 0xf2, 0x9f, 0x9b, 0x21, 0xea, 0xd9, 0x0b, 0x41, 0x83, 0x1c, 0x01, 0xc9, 0xfa, 0xd1,
+    0x03, 0xcb, 0x07, 0x4e, 0x8f, 0xac, 0x2b, 0x1e, 0x3b, 0x7e, 0x74, 0x64, 0xa9, 0x38, 0x64, 0xd8,
+    0x62, 0xc0, 0x88, 0x71, 0x95, 0xe0, 0xe9, 0x11, 0xb0, 0x30, 0xca, 0xa2, 0x62, 0xc8, 0x2a, 0x85,
+    0xfa, 0x63, 0x4d, 0xa9, 0x0f, 0x92, 0xba, 0xa1, 0x00, 0xc2, 0xe2, 0xfe, 0x2f, 0x12, 0x6b, 0xa2,
+    0x88, 0x1e, 0x22, 0x05, 0x31, 0xfc, 0x80, 0x0e, 0x6d, 0x9e, 0xd2, 0x0d, 0xb8, 0x0c, 0x28, 0x8f,
+    0x4d, 0xba, 0x9d, 0x46, 0x1f, 0xda, 0x55, 0x05, 0x31, 0xf8, 0x91, 0xa0, 0xfe, 0xbc, 0x87, 0xc8,
+    0xc1, 0x03, 0xf4, 0xa7, 0x83, 0xd3, 0x76, 0x78, 0x64, 0x3b, 0x67, 0x30, 0x40, 0xc1, 0x98, 0x03,
+    0x55, 0x05, 0x30, 0x10, 0x78, 0x90, 0x03, 0x80, 0xcb, 0xa1, 0x37, 0x1c, 0x81, 0xf3, 0xb6, 0xb2,
+    0x39, 0xeb, 0x8a, 0x83, 0xa3, 0x0a, 0x48, 0x9f, 0xa2, 0x01, 0x64, 0xac, 0x8c, 0x01, 0x18, 0x1b,
+    0x2b, 0x90, 0xe6, 0xc4, 0xc4, 0x68, 0xc2, 0xc2, 0xc0, 0xc0, 0xbe, 0x6c, 0x5e, 0x5e, 0x5d, 0x7f,
+    0xd7, 0xbb, 0x94, 0x70, 0xdd, 0xac, 0x36, 0x6a, 0xcd, 0x0c, 0x27, 0xb3, 0xa5, 0x2c, 0x2a, 0x3b,
+    0x7f, 0xae, 0x6f, 0x6d, 0x69, 0x9d, 0x49, 0x46, 0xa9, 0x76, 0x44, 0xbb, 0xc0, 0xea, 0xd6, 0x20,
+    0x15, 0xfd, 0x99, 0xe1, 0x64, 0xb6, 0x94, 0x45, 0x65, 0xe7, 0xb5, 0x70, 0x44, 0x50, 0x1d, 0x67,
+    0xd6, 0x0c, 0x16, 0x16, 0x9a, 0xea, 0x04, 0x3f, 0xaf, 0x7b, 0x50, 0xf8, 0x14, 0x74, 0xe2, 0x00,
+    0x74, 0xfa, 0x01, 0x37, 0xfc, 0x34, 0xf8, 0x32, 0x68, 0x58, 0x6a, 0x62, 0x5a, 0xea, 0x31, 0xf1,
+    0x7a, 0x3b, 0xa5, 0x2d, 0x49, 0x3b, 0x2d, 0x45, 0x48, 0x47, 0x45, 0x18, 0x8e, 0x8c, 0x30, 0xe8,
+    0x6a, 0x17, 0xae, 0xb3, 0x40, 0x34, 0x64, 0xa1, 0x02, 0x90, 0x50, 0x85, 0xe5, 0x79, 0x0a, 0xa9,
+    0x41, 0x14, 0x70, 0x4c, 0xd8, 0x89, 0xd0, 0xc0, 0x27, 0xc2, 0x4e, 0xd1, 0x07, 0xd7, 0x03, 0xc1,
+    0x41, 0x91, 0xd3, 0x52, 0x91, 0x6e, 0x05, 0x92, 0xb0, 0x36, 0xe0, 0x21, 0x12, 0x10, 0x20, 0x07,
+    0xa0, 0x46, 0x67, 0x81, 0x4e, 0xce, 0x02, 0x9c, 0x1c, 0x9b, 0x02, 0x1a, 0xdb, 0xcc, 0xd1, 0x8b,
+    0x39, 0x70, 0x13, 0xa3, 0x80, 0x01, 0x02, 0x36, 0xb4, 0x01, 0x32, 0xb4, 0xb5, 0x02, 0xfb, 0x9a,
+    0x90, 0xee, 0x46, 0x8e, 0x19, 0x58, 0x39, 0x70, 0x20, 0xd5, 0xdc, 0x18, 0xb2, 0x41, 0xa3, 0x06,
+    0x8e, 0x8a, 0x46, 0x3c, 0xe3, 0x54, 0x2e, 0x5e, 0x58, 0xb5, 0x70, 0xd1, 0x6c, 0x51, 0x65, 0x75,
+    0xc5, 0xa2, 0x6a, 0x08, 0x5c, 0x31, 0x54, 0xd1, 0xac, 0x63, 0xba, 0xb6, 0x2a, 0xd2, 0xea, 0x15,
+    0xd3, 0x68, 0x96, 0x4f, 0x0c, 0xc9, 0xcb, 0xf3, 0x61, 0xde, 0xe5, 0x6b, 0x62, 0xb9, 0x67, 0x26,
+    0xd6, 0x73, 0x41, 0xd1, 0x7f, 0x71, 0x4b, 0x24, 0x95, 0x46, 0xc9, 0x8d, 0xdc, 0x47, 0x30, 0x47,
+    0x76, 0x39, 0x12, 0xbf, 0x8a, 0x46, 0x62, 0x93, 0x56, 0x1d, 0x22, 0x31, 0x3b, 0x12, 0x94, 0xd1,
+    0x29, 0x62, 0xc4, 0xf0, 0x17, 0x25, 0x02, 0x44, 0x91, 0x8d, 0x1c, 0xd5, 0x87, 0x66, 0xbc, 0xae,
+    0x50, 0x1f, 0x66, 0x5e, 0xfe, 0xcf, 0x2e, 0x54, 0xc5, 0x0a, 0x88, 0x1e, 0xb6, 0x0a, 0x95, 0x16,
+    0x9f, 0xf2, 0xd7, 0xac, 0xa4, 0x60, 0x79, 0x94, 0xd3, 0xa0, 0x5c, 0x0d, 0x82, 0xce, 0xa8, 0x62,
+    0x50, 0x97, 0xc9, 0x48, 0x52, 0x50, 0x28, 0x0c, 0x9b, 0x01, 0x52, 0x5c, 0x84, 0x68, 0x29, 0x65,
+    0xd9, 0x06, 0xa2, 0x12, 0x18, 0x21, 0x25, 0x62, 0x50, 0xa5, 0x0a, 0x92, 0xb4, 0x1b, 0x13, 0x6e,
+    0x85, 0x73, 0x91, 0xdc, 0x1c, 0xc9, 0x3c, 0x1c, 0x36, 0xc7, 0x20, 0x77, 0x10, 0x6b, 0x2d, 0x86,
+    0x3f, 0xfb, 0x1b, 0x67, 0x9c, 0xef, 0xba, 0xb3, 0xd8, 0x10, 0xd1, 0xf0, 0x00, 0xa3, 0x44, 0x93,
+    0xc2, 0xf9, 0xe6, 0x03, 0xe7, 0xbb, 0xef, 0x6f, 0xc0, 0x8d, 0xaf, 0xad, 0xa7, 0x8d, 0xc3, 0xed,
+    0xf6, 0xce, 0x77, 0xc7, 0x7f, 0xda, 0x3a, 0x1f, 0x98, 0x16, 0x4f, 0x82, 0x15, 0xb0, 0x48, 0x98,
+    0x41, 0xb8, 0xd9, 0x8f, 0xb3, 0xb7, 0x73, 0xc5, 0x8a, 0x64, 0x94, 0x4c, 0x3d, 0xf6, 0x07, 0x5e,
+    0x11, 0xd2, 0x80, 0x9a, 0xa3, 0x92, 0x0a, 0xd6, 0xc6, 0xf0, 0xa1, 0x99, 0x4b, 0xf7, 0x44, 0xbc,
+    0x7d, 0xb7, 0xb6, 0x81, 0xc3, 0x82, 0x55, 0x87, 0xc8, 0xb6, 0xf1, 0x7c, 0xf4, 0xb2, 0xda, 0x4e,
+    0x42, 0x76, 0x56, 0xd4, 0xff, 0x89, 0x53, 0x9d, 0xe3, 0xf6, 0x18, 0x33, 0x3a, 0xf8, 0xe5, 0x8f,
+    0x7c, 0x78, 0x5e, 0xde, 0xce, 0xb0, 0x30, 0x2c, 0xe5, 0x2c, 0x06, 0x1e, 0xbc, 0x73, 0x72, 0x2a,
+    0xc1, 0x8f, 0xe6, 0xaf, 0x7c, 0x00, 0x75, 0x96, 0xb4, 0x65, 0xed, 0x0e, 0xc4, 0xb9, 0x0b, 0x01,
+    0xe4, 0xa7, 0x30, 0xeb, 0xc2, 0x9c, 0xca, 0xcf, 0x98, 0x67, 0xfe, 0x6b, 0x7c, 0x61, 0xb9, 0x9d,
+    0x0f, 0xe2, 0x15, 0xef, 0xe5, 0x7e, 0x05, 0xb9, 0xc2, 0x1e, 0xe0, 0x9d, 0xf4, 0x68, 0xd7, 0xf0,
+    0x91, 0x3f, 0x66, 0x62, 0x88, 0x9f, 0x36, 0xac, 0x1c, 0xec, 0xf3, 0xae, 0x34, 0x8f, 0x14, 0xce,
+    0x97, 0xda, 0x4c, 0x62, 0x26, 0xb5, 0x77, 0xae, 0xfd, 0x1d, 0xed, 0xa1, 0x74, 0x09, 0x25, 0x76,
+    0x41, 0x89, 0xa6, 0xd0, 0x81, 0x06, 0x79, 0xbc, 0x5f, 0x36, 0x6c, 0x5b, 0x43, 0x0d, 0xbe, 0x4c,
+    0xe3, 0x1f, 0xc5, 0x11, 0x85, 0xed, 0xd1, 0x59, 0x1a, 0xc5, 0x05, 0xbe, 0xce, 0xf4, 0x71, 0x9b,
+    0xcc, 0xbb, 0x26, 0x9c, 0xf9, 0xaf, 0xde, 0xf8, 0x7d, 0x26, 0x96, 0xb5, 0x86, 0xe4, 0xd6, 0xed,
+    0xc2, 0xb1, 0xe2, 0x90, 0xcc, 0x04, 0x8e, 0x07, 0x5d, 0x07, 0x2b, 0xdd, 0xa9, 0xc1, 0x8d, 0x20,
+    0x1e, 0x52, 0x69, 0x81, 0x7f, 0xb5, 0x6f, 0x8f, 0x3f, 0x50, 0xd7, 0xa0, 0x1b, 0x03, 0x95, 0xaf,
+    0x57, 0x97, 0xb2, 0x2f, 0xc6, 0xd7, 0x1a, 0x8c, 0xd2, 0x91, 0x94, 0xb9, 0x65, 0x3d, 0xda, 0x8a,
+    0x17, 0x3b, 0x6f, 0x6f, 0x88, 0x1d, 0x06, 0x8a, 0xd5, 0x71, 0x6c, 0xd3, 0x2e, 0xd4, 0xd0, 0x7d,
+    0x51, 0xf5, 0x24, 0xb0, 0x72, 0x25, 0x1a, 0x94, 0x73, 0xc1, 0xb7, 0x5e, 0x30, 0x9f, 0x87, 0x47,
+    0xc3, 0x2c, 0x80, 0xf5, 0x71, 0xd6, 0x11, 0x23, 0xf6, 0x9d, 0xac, 0xd7, 0x27, 0xbb, 0xdf, 0x8f,
+    0xb3, 0x13, 0x72, 0x8f, 0xc2, 0x01, 0xca, 0x52, 0x03, 0x74, 0x43, 0xfa, 0xd0, 0x4a, 0xd5, 0xcc,
+    0x7a, 0xa4, 0x19, 0x89, 0xf7, 0x3e, 0x6f, 0xd3, 0xec, 0x61, 0x37, 0xe3, 0x08, 0x66, 0xa3, 0x79,
+    0xa5, 0x65, 0x1f, 0xc6, 0xff, 0x3c, 0xc5, 0xde, 0x54, 0x01, 0x99, 0xb4, 0x19, 0xce, 0x59, 0xdb,
+    0x66, 0x03, 0xf6, 0xc9, 0x4c, 0xea, 0x57, 0xae, 0xf1, 0xa8, 0xe1, 0xb6, 0x4f, 0x46, 0x2a, 0x22,
+    0x23, 0x25, 0xec, 0x7f, 0xe6, 0xcb, 0x28, 0xfd, 0x40, 0x99, 0xca, 0x42, 0xd0, 0x55, 0xde, 0x9c,
+    0xd2, 0x03, 0x60, 0x45, 0x0f, 0x52, 0xcd, 0xbc, 0x25, 0x9e, 0xdc, 0x40, 0x00, 0x67, 0xb0, 0x40,
+    0xc1, 0x44, 0xe7, 0x61, 0xc7, 0xc1, 0x1a, 0xec, 0x3e, 0xa1, 0xb7, 0xf4, 0x62, 0x35, 0x70, 0xf6,
+    0x71, 0x4b, 0x2d, 0xfd, 0x76, 0xc7, 0x73, 0x8e, 0x05, 0xc3, 0xb8, 0x13, 0x89, 0xfe, 0x78, 0xda,
+    0x5c, 0x70, 0x4f, 0xfe, 0x61, 0xff, 0x3d, 0x82, 0xe2, 0x03, 0xbb, 0xd7, 0xbd, 0xa7, 0x9c, 0xbc,
+    0x33, 0x1c, 0x7f, 0xd0, 0x2f, 0x77, 0xeb, 0x64, 0x9e, 0x74, 0xc8, 0x88, 0x1b, 0xbe, 0x28, 0x39,
+    0xa3, 0x41, 0x69, 0x03, 0xf9, 0x7d, 0x68, 0xf7, 0x90, 0x0f, 0x4a, 0xe4, 0xa5, 0x74, 0xb9, 0x5c,
+    0x1f, 0x64, 0xc2, 0xd7, 0x7f, 0xa9, 0xde, 0x99, 0x38, 0xd4, 0x8c, 0x99, 0x04, 0x89, 0x9d, 0xba,
+    0x39, 0xb2, 0x31, 0x25, 0x18, 0x4c, 0xdb, 0xac, 0x9f, 0x5b, 0x27, 0x62, 0x13, 0x50, 0xc8, 0x07,
+    0x7a, 0x6f, 0x1f, 0x87, 0x97, 0xd4, 0xac, 0x74, 0xae, 0x0c, 0x01, 0x76, 0xca, 0x4f, 0xb3, 0x41,
+    0x44, 0x79, 0x5b, 0x0e, 0x33, 0x05, 0x3c, 0xb4, 0x97, 0x49, 0x19, 0x9c, 0xc7, 0xb2, 0xad, 0xb9,
+    0x7b, 0x63, 0xb4, 0x25, 0xd8, 0xb1, 0x80, 0x70, 0xca, 0x3f, 0xfa, 0xc6, 0xe8, 0xcb, 0x21, 0x2c,
+    0x00, 0x81, 0xd6, 0x00, 0xce, 0xfa, 0x16, 0x68, 0xa8, 0x88, 0x7f, 0xc9, 0x06, 0xce, 0xe3, 0x62,
+    0x83, 0x20, 0x27, 0xf9, 0xb6, 0x7b, 0xce, 0x52, 0xa0, 0x41, 0x47, 0xe8, 0x98, 0xec, 0x95, 0x05,
+    0xd6, 0x79, 0x61, 0x5d, 0xd5, 0xb8, 0x66, 0x20, 0x48, 0x78, 0xe0, 0xc2, 0xab, 0x41, 0x11, 0x36,
+    0x3d, 0x7f, 0x4d, 0xe3, 0x65, 0xba, 0x7c, 0xb0, 0x5e, 0x53, 0x37, 0xb2, 0x9f, 0x7d, 0xb1, 0x54,
+    0x23, 0x8f, 0x5e, 0x8b, 0x03, 0x21, 0xb4, 0xe7, 0x96, 0x3d, 0x41, 0xb3, 0x93, 0xa8, 0x71, 0x30,
+    0x89, 0xe7, 0xbc, 0xdd, 0x5d, 0x25, 0xba, 0x7b, 0x1e, 0x05, 0x09, 0xc2, 0xd9, 0x27, 0x74, 0x32,
+    0x3d, 0xaf, 0x9b, 0xaf, 0x29, 0xff, 0x11, 0x38, 0x05, 0x19, 0x7b, 0xbd, 0xc1, 0x68, 0x2b, 0x71,
+    0x2b, 0xc4, 0x14, 0x33, 0xfc, 0x7c, 0xf3, 0x2f, 0xed, 0x66, 0xca, 0x07, 0x80, 0x83, 0x12, 0xfa,
+    0x22, 0x2f, 0x48, 0xfb, 0x0e, 0xe0, 0xa3, 0x05, 0x00, 0x1a, 0x8b, 0x7e, 0xf6, 0x80, 0x4e, 0xe7,
+    0xe3, 0x23, 0x3a, 0xb6, 0x2b, 0xe3, 0x3b, 0xf4, 0x38, 0x77, 0x08,
 };
+const ShaderModule Blob109 = { Blob109_Data, 1867u, 1448u, 109u };
 
 } // namespace detail
 } // namespace VulkanShaders
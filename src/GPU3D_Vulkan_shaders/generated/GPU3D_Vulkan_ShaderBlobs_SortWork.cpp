@@ -28,13 +28,12 @@
     Pipeline indices match ComputeRenderer3D::ShaderCompileStep() in
     src/GPU3D_Compute.cpp one for one.
 
-    The SPIR-V words live in per-stage translation units rather than in the
-    header so that including the public header stays cheap: the full module set
-    is a few megabytes of integer literals and would otherwise be re-parsed by
-    every consumer.
+    Every module is one zstd frame, inflated on first use by
+    Vk::InflateShaderModule(). The frames live in per-stage translation units
+    rather than in the header so that including the public header stays cheap.
 */
 
-// SPIR-V for src/GPU3D_Vulkan_shaders/SortWork.comp.
+// SPIR-V for src/GPU3D_Vulkan_shaders/SortWork.comp, one zstd frame per module.
 
 #include "GPU3D_Vulkan_ShaderBlobs.h"
 
@@ -45,508 +44,330 @@ namespace VulkanShaders
 namespace detail
 {
 
-extern const uint32_t Blob024[1301];
-const uint32_t Blob024[1301] = {
-    0x07230203, 0x00010300, 0x0008000b, 0x0000007c, 0x00000000, 0x00020011, 0x00000001, 0x0006000b,
-    0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001,
-    0x0006000f, 0x00000005, 0x00000004, 0x6e69616d, 0x00000000, 0x00000009, 0x00060010, 0x00000004,
-    0x00000011, 0x00000020, 0x00000001, 0x00000001, 0x00030003, 0x00000002, 0x000001c2, 0x000a0004,
-    0x475f4c47, 0x4c474f4f, 0x70635f45, 0x74735f70, 0x5f656c79, 0x656e696c, 0x7269645f, 0x69746365,
-    0x00006576, 0x00080004, 0x475f4c47, 0x4c474f4f, 0x6e695f45, 0x64756c63, 0x69645f65, 0x74636572,
-    0x00657669, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000, 0x00080005, 0x00000009, 0x475f6c67,
-    0x61626f6c, 0x766e496c, 0x7461636f, 0x496e6f69, 0x00000044, 0x00060005, 0x00000014, 0x526e6942,
-    0x6c757365, 0x66754274, 0x00726566, 0x00080006, 0x00000014, 0x00000000, 0x69726156, 0x57746e61,
-    0x436b726f, 0x746e756f, 0x00000000, 0x00080006, 0x00000014, 0x00000001, 0x74726f53, 0x6f576465,
-    0x664f6b72, 0x74657366, 0x00000000, 0x00090006, 0x00000014, 0x00000002, 0x69726156, 0x57746e61,
-    0x526b726f, 0x436c6165, 0x746e756f, 0x00000000, 0x00080006, 0x00000014, 0x00000003, 0x74726f53,
-    0x6b726f57, 0x6b726f57, 0x6e756f43, 0x00000074, 0x00090006, 0x00000014, 0x00000004, 0x6e6e6942,
-    0x4d676e69, 0x416b7361, 0x664f646e, 0x74657366, 0x00000000, 0x00030005, 0x00000016, 0x00000000,
-    0x00050005, 0x00000023, 0x6b726f77, 0x63736544, 0x00000000, 0x00060005, 0x00000025, 0x6b726f57,
-    0x63736544, 0x66667542, 0x00007265, 0x00060006, 0x00000025, 0x00000000, 0x6b726f57, 0x63736544,
-    0x00000073, 0x00030005, 0x00000027, 0x00000000, 0x00060005, 0x0000002f, 0x61566e69, 0x6e616972,
-    0x66664f74, 0x00746573, 0x00050005, 0x00000038, 0x796c6f70, 0x496e6f67, 0x00007864, 0x00050005,
-    0x0000003d, 0x69726176, 0x49746e61, 0x00007864, 0x00040005, 0x0000003f, 0x796c6f50, 0x006e6f67,
-    0x00060006, 0x0000003f, 0x00000000, 0x73726946, 0x70535874, 0x00006e61, 0x00050006, 0x0000003f,
-    0x00000001, 0x706f5459, 0x00000000, 0x00050006, 0x0000003f, 0x00000002, 0x746f4259, 0x00000000,
-    0x00050006, 0x0000003f, 0x00000003, 0x6e694d58, 0x00000000, 0x00050006, 0x0000003f, 0x00000004,
-    0x78614d58, 0x00000000, 0x00050006, 0x0000003f, 0x00000005, 0x6e694d58, 0x00000059, 0x00050006,
-    0x0000003f, 0x00000006, 0x78614d58, 0x00000059, 0x00050006, 0x0000003f, 0x00000007, 0x69726156,
-    0x00746e61, 0x00050006, 0x0000003f, 0x00000008, 0x72747441, 0x00000000, 0x00070006, 0x0000003f,
-    0x00000009, 0x74786554, 0x4c657275, 0x72657961, 0x00000000, 0x00060006, 0x0000003f, 0x0000000a,
-    0x69636146, 0x6956676e, 0x00007765, 0x00060005, 0x00000041, 0x796c6f50, 0x426e6f67, 0x65666675,
-    0x00000072, 0x00060006, 0x00000041, 0x00000000, 0x796c6f50, 0x736e6f67, 0x00000000, 0x00030005,
-    0x00000043, 0x00000000, 0x00050005, 0x00000049, 0x74726f73, 0x6e496465, 0x00786564, 0x00060005,
-    0x00000051, 0x5778614d, 0x546b726f, 0x73656c69, 0x00000000, 0x00080005, 0x00000053, 0x6b726f57,
-    0x63736544, 0x726f5373, 0x53646574, 0x74726174, 0x00000000, 0x00050005, 0x00000060, 0x65726353,
-    0x69576e65, 0x00687464, 0x00060005, 0x00000061, 0x65726353, 0x65486e65, 0x74686769, 0x00000000,
-    0x00070005, 0x00000065, 0x6d617246, 0x66756265, 0x53726566, 0x64697274, 0x00000065, 0x00060005,
-    0x00000066, 0x656c6954, 0x72655073, 0x656e694c, 0x00000000, 0x00050005, 0x00000067, 0x656c6954,
-    0x656e694c, 0x00000073, 0x00050005, 0x0000006d, 0x6174654d, 0x66696e55, 0x006d726f, 0x00060006,
-    0x0000006d, 0x00000000, 0x506d754e, 0x67796c6f, 0x00736e6f, 0x00060006, 0x0000006d, 0x00000001,
-    0x566d754e, 0x61697261, 0x0073746e, 0x00060006, 0x0000006d, 0x00000002, 0x68706c41, 0x66655261,
-    0x00000000, 0x00050006, 0x0000006d, 0x00000003, 0x70736944, 0x00746e43, 0x00060006, 0x0000006d,
-    0x00000004, 0x6e6f6f54, 0x6c626154, 0x00000065, 0x00060006, 0x0000006d, 0x00000005, 0x61656c43,
-    0x6c6f4372, 0x0000726f, 0x00060006, 0x0000006d, 0x00000006, 0x61656c43, 0x70654472, 0x00006874,
-    0x00060006, 0x0000006d, 0x00000007, 0x61656c43, 0x74744172, 0x00000072, 0x00060006, 0x0000006d,
-    0x00000008, 0x4f676f46, 0x65736666, 0x00000074, 0x00060006, 0x0000006d, 0x00000009, 0x53676f46,
-    0x74666968, 0x00000000, 0x00060006, 0x0000006d, 0x0000000a, 0x43676f46, 0x726f6c6f, 0x00000000,
-    0x00080006, 0x0000006d, 0x0000000b, 0x61656c43, 0x74694272, 0x4f70616d, 0x65736666, 0x00000074,
-    0x00030005, 0x0000006f, 0x00000000, 0x00060005, 0x00000070, 0x68737550, 0x736e6f43, 0x746e6174,
-    0x00000073, 0x00060006, 0x00000070, 0x00000000, 0x56727543, 0x61697261, 0x0000746e, 0x00060006,
-    0x00000070, 0x00000001, 0x57786554, 0x68746469, 0x00000000, 0x00060006, 0x00000070, 0x00000002,
-    0x48786554, 0x68676965, 0x00000074, 0x00060006, 0x00000070, 0x00000003, 0x57786554, 0x53706172,
-    0x00000000, 0x00060006, 0x00000070, 0x00000004, 0x57786554, 0x54706172, 0x00000000, 0x00070006,
-    0x00000070, 0x00000005, 0x49786554, 0x70614373, 0x65727574, 0x00000000, 0x00070006, 0x00000070,
-    0x00000006, 0x74706143, 0x59657275, 0x7366664f, 0x00007465, 0x00050006, 0x00000070, 0x00000007,
-    0x6461705f, 0x00000000, 0x00030005, 0x00000072, 0x00006370, 0x00070005, 0x00000076, 0x6e6e6942,
-    0x4d676e69, 0x536b7361, 0x74726174, 0x00000000, 0x00080005, 0x00000079, 0x6e6e6942, 0x57676e69,
-    0x4f6b726f, 0x65736666, 0x74537374, 0x00747261, 0x00040047, 0x00000009, 0x0000000b, 0x0000001c,
-    0x00040047, 0x00000010, 0x00000006, 0x00000010, 0x00040047, 0x00000011, 0x00000006, 0x00000004,
-    0x00040047, 0x00000012, 0x00000006, 0x00000004, 0x00040047, 0x00000013, 0x00000006, 0x00000004,
-    0x00050048, 0x00000014, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000014, 0x00000001,
-    0x00000023, 0x00008000, 0x00050048, 0x00000014, 0x00000002, 0x00000023, 0x0000a000, 0x00050048,
-    0x00000014, 0x00000003, 0x00000023, 0x0000c000, 0x00050048, 0x00000014, 0x00000004, 0x00000023,
-    0x0000c010, 0x00030047, 0x00000014, 0x00000002, 0x00040047, 0x00000016, 0x00000022, 0x00000000,
-    0x00040047, 0x00000016, 0x00000021, 0x00000008, 0x00040047, 0x00000024, 0x00000006, 0x00000008,
-    0x00050048, 0x00000025, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000025, 0x00000002,
-    0x00040047, 0x00000027, 0x00000022, 0x00000000, 0x00040047, 0x00000027, 0x00000021, 0x00000009,
-    0x00050048, 0x0000003f, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x0000003f, 0x00000001,
-    0x00000023, 0x00000004, 0x00050048, 0x0000003f, 0x00000002, 0x00000023, 0x00000008, 0x00050048,
-    0x0000003f, 0x00000003, 0x00000023, 0x0000000c, 0x00050048, 0x0000003f, 0x00000004, 0x00000023,
-    0x00000010, 0x00050048, 0x0000003f, 0x00000005, 0x00000023, 0x00000014, 0x00050048, 0x0000003f,
-    0x00000006, 0x00000023, 0x00000018, 0x00050048, 0x0000003f, 0x00000007, 0x00000023, 0x0000001c,
-    0x00050048, 0x0000003f, 0x00000008, 0x00000023, 0x00000020, 0x00050048, 0x0000003f, 0x00000009,
-    0x00000023, 0x00000024, 0x00050048, 0x0000003f, 0x0000000a, 0x00000023, 0x00000028, 0x00040047,
-    0x00000040, 0x00000006, 0x0000002c, 0x00040048, 0x00000041, 0x00000000, 0x00000018, 0x00050048,
-    0x00000041, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000041, 0x00000002, 0x00040047,
-    0x00000043, 0x00000022, 0x00000000, 0x00040047, 0x00000043, 0x00000021, 0x00000001, 0x00040047,
-    0x00000051, 0x00000001, 0x00000002, 0x00040047, 0x00000060, 0x00000001, 0x00000000, 0x00040047,
-    0x00000061, 0x00000001, 0x00000001, 0x00040047, 0x0000006b, 0x00000006, 0x00000010, 0x00050048,
-    0x0000006d, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x0000006d, 0x00000001, 0x00000023,
-    0x00000004, 0x00050048, 0x0000006d, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x0000006d,
-    0x00000003, 0x00000023, 0x0000000c, 0x00050048, 0x0000006d, 0x00000004, 0x00000023, 0x00000010,
-    0x00050048, 0x0000006d, 0x00000005, 0x00000023, 0x00000230, 0x00050048, 0x0000006d, 0x00000006,
-    0x00000023, 0x00000234, 0x00050048, 0x0000006d, 0x00000007, 0x00000023, 0x00000238, 0x00050048,
-    0x0000006d, 0x00000008, 0x00000023, 0x0000023c, 0x00050048, 0x0000006d, 0x00000009, 0x00000023,
-    0x00000240, 0x00050048, 0x0000006d, 0x0000000a, 0x00000023, 0x00000244, 0x00050048, 0x0000006d,
-    0x0000000b, 0x00000023, 0x00000248, 0x00030047, 0x0000006d, 0x00000002, 0x00040047, 0x0000006f,
-    0x00000022, 0x00000000, 0x00040047, 0x0000006f, 0x00000021, 0x00000000, 0x00050048, 0x00000070,
-    0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000070, 0x00000001, 0x00000023, 0x00000004,
-    0x00050048, 0x00000070, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x00000070, 0x00000003,
-    0x00000023, 0x0000000c, 0x00050048, 0x00000070, 0x00000004, 0x00000023, 0x00000010, 0x00050048,
-    0x00000070, 0x00000005, 0x00000023, 0x00000014, 0x00050048, 0x00000070, 0x00000006, 0x00000023,
-    0x00000018, 0x00050048, 0x00000070, 0x00000007, 0x00000023, 0x0000001c, 0x00030047, 0x00000070,
-    0x00000002, 0x00040047, 0x0000007b, 0x0000000b, 0x00000019, 0x00020013, 0x00000002, 0x00030021,
-    0x00000003, 0x00000002, 0x00040015, 0x00000006, 0x00000020, 0x00000000, 0x00040017, 0x00000007,
-    0x00000006, 0x00000003, 0x00040020, 0x00000008, 0x00000001, 0x00000007, 0x0004003b, 0x00000008,
-    0x00000009, 0x00000001, 0x0004002b, 0x00000006, 0x0000000a, 0x00000000, 0x00040020, 0x0000000b,
-    0x00000001, 0x00000006, 0x00040017, 0x0000000e, 0x00000006, 0x00000004, 0x0004002b, 0x00000006,
-    0x0000000f, 0x00000800, 0x0004001c, 0x00000010, 0x0000000e, 0x0000000f, 0x0004001c, 0x00000011,
-    0x00000006, 0x0000000f, 0x0004001c, 0x00000012, 0x00000006, 0x0000000f, 0x0003001d, 0x00000013,
-    0x00000006, 0x0007001e, 0x00000014, 0x00000010, 0x00000011, 0x00000012, 0x0000000e, 0x00000013,
-    0x00040020, 0x00000015, 0x0000000c, 0x00000014, 0x0004003b, 0x00000015, 0x00000016, 0x0000000c,
-    0x00040015, 0x00000017, 0x00000020, 0x00000001, 0x0004002b, 0x00000017, 0x00000018, 0x00000000,
-    0x0004002b, 0x00000006, 0x00000019, 0x00000003, 0x00040020, 0x0000001a, 0x0000000c, 0x00000006,
-    0x00020014, 0x0000001d, 0x00040017, 0x00000021, 0x00000006, 0x00000002, 0x00040020, 0x00000022,
-    0x00000007, 0x00000021, 0x0003001d, 0x00000024, 0x00000021, 0x0003001e, 0x00000025, 0x00000024,
-    0x00040020, 0x00000026, 0x0000000c, 0x00000025, 0x0004003b, 0x00000026, 0x00000027, 0x0000000c,
-    0x00040020, 0x0000002b, 0x0000000c, 0x00000021, 0x00040020, 0x0000002e, 0x00000007, 0x00000017,
-    0x0004002b, 0x00000006, 0x00000030, 0x00000001, 0x00040020, 0x00000031, 0x00000007, 0x00000006,
-    0x0004002b, 0x00000017, 0x00000034, 0x0000000b, 0x0004002b, 0x00000017, 0x00000035, 0x00000015,
-    0x00030016, 0x0000003e, 0x00000020, 0x000d001e, 0x0000003f, 0x00000017, 0x00000017, 0x00000017,
-    0x00000017, 0x00000017, 0x00000017, 0x00000017, 0x00000017, 0x00000006, 0x0000003e, 0x00000006,
-    0x0003001d, 0x00000040, 0x0000003f, 0x0003001e, 0x00000041, 0x00000040, 0x00040020, 0x00000042,
-    0x0000000c, 0x00000041, 0x0004003b, 0x00000042, 0x00000043, 0x0000000c, 0x0004002b, 0x00000017,
-    0x00000045, 0x00000007, 0x00040020, 0x00000046, 0x0000000c, 0x00000017, 0x0004002b, 0x00000017,
-    0x0000004a, 0x00000001, 0x00040032, 0x00000017, 0x00000051, 0x00003000, 0x00060034, 0x00000006,
-    0x00000052, 0x00000080, 0x00000051, 0x0000000a, 0x00060034, 0x00000006, 0x00000053, 0x00000080,
-    0x0000000a, 0x00000052, 0x00040032, 0x00000017, 0x00000060, 0x00000100, 0x00040032, 0x00000017,
-    0x00000061, 0x000000c0, 0x0004002b, 0x00000017, 0x00000062, 0x00000008, 0x0004002b, 0x00000017,
-    0x00000063, 0x00000040, 0x0004002b, 0x00000017, 0x00000064, 0x00000020, 0x00060034, 0x00000017,
-    0x00000065, 0x00000084, 0x00000060, 0x00000061, 0x00060034, 0x00000017, 0x00000066, 0x00000087,
-    0x00000060, 0x00000062, 0x00060034, 0x00000017, 0x00000067, 0x00000087, 0x00000061, 0x00000062,
-    0x0004002b, 0x00000017, 0x00000068, 0x00000002, 0x0004002b, 0x00000017, 0x00000069, 0x00000800,
-    0x0004002b, 0x00000006, 0x0000006a, 0x00000022, 0x0004001c, 0x0000006b, 0x0000000e, 0x0000006a,
-    0x00040017, 0x0000006c, 0x0000003e, 0x00000002, 0x000e001e, 0x0000006d, 0x00000006, 0x00000006,
-    0x00000017, 0x00000006, 0x0000006b, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x0000006c, 0x00040020, 0x0000006e, 0x00000002, 0x0000006d, 0x0004003b, 0x0000006e,
-    0x0000006f, 0x00000002, 0x000a001e, 0x00000070, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000017, 0x00000006, 0x00040020, 0x00000071, 0x00000009, 0x00000070,
-    0x0004003b, 0x00000071, 0x00000072, 0x00000009, 0x0004002b, 0x00000006, 0x00000073, 0x00008000,
-    0x00060034, 0x00000017, 0x00000074, 0x00000084, 0x00000066, 0x00000067, 0x00060034, 0x00000017,
-    0x00000075, 0x00000084, 0x00000074, 0x00000068, 0x00060034, 0x00000017, 0x00000076, 0x00000080,
-    0x00000018, 0x00000075, 0x00060034, 0x00000017, 0x00000077, 0x00000084, 0x00000066, 0x00000067,
-    0x00060034, 0x00000017, 0x00000078, 0x00000084, 0x00000077, 0x00000063, 0x00060034, 0x00000017,
-    0x00000079, 0x00000080, 0x00000076, 0x00000078, 0x0004002b, 0x00000006, 0x0000007a, 0x00000020,
-    0x0006002c, 0x00000007, 0x0000007b, 0x0000007a, 0x00000030, 0x00000030, 0x00050036, 0x00000002,
-    0x00000004, 0x00000000, 0x00000003, 0x000200f8, 0x00000005, 0x0004003b, 0x00000022, 0x00000023,
-    0x00000007, 0x0004003b, 0x0000002e, 0x0000002f, 0x00000007, 0x0004003b, 0x0000002e, 0x00000038,
-    0x00000007, 0x0004003b, 0x0000002e, 0x0000003d, 0x00000007, 0x0004003b, 0x0000002e, 0x00000049,
-    0x00000007, 0x00050041, 0x0000000b, 0x0000000c, 0x00000009, 0x0000000a, 0x0004003d, 0x00000006,
-    0x0000000d, 0x0000000c, 0x00070041, 0x0000001a, 0x0000001b, 0x00000016, 0x00000018, 0x00000018,
-    0x00000019, 0x0004003d, 0x00000006, 0x0000001c, 0x0000001b, 0x000500b0, 0x0000001d, 0x0000001e,
-    0x0000000d, 0x0000001c, 0x000300f7, 0x00000020, 0x00000000, 0x000400fa, 0x0000001e, 0x0000001f,
-    0x00000020, 0x000200f8, 0x0000001f, 0x00050041, 0x0000000b, 0x00000028, 0x00000009, 0x0000000a,
-    0x0004003d, 0x00000006, 0x00000029, 0x00000028, 0x00050080, 0x00000006, 0x0000002a, 0x0000000a,
-    0x00000029, 0x00060041, 0x0000002b, 0x0000002c, 0x00000027, 0x00000018, 0x0000002a, 0x0004003d,
-    0x00000021, 0x0000002d, 0x0000002c, 0x0003003e, 0x00000023, 0x0000002d, 0x00050041, 0x00000031,
-    0x00000032, 0x00000023, 0x00000030, 0x0004003d, 0x00000006, 0x00000033, 0x00000032, 0x000600cb,
-    0x00000006, 0x00000036, 0x00000033, 0x00000034, 0x00000035, 0x0004007c, 0x00000017, 0x00000037,
-    0x00000036, 0x0003003e, 0x0000002f, 0x00000037, 0x00050041, 0x00000031, 0x00000039, 0x00000023,
-    0x00000030, 0x0004003d, 0x00000006, 0x0000003a, 0x00000039, 0x000600cb, 0x00000006, 0x0000003b,
-    0x0000003a, 0x00000018, 0x00000034, 0x0004007c, 0x00000017, 0x0000003c, 0x0000003b, 0x0003003e,
-    0x00000038, 0x0000003c, 0x0004003d, 0x00000017, 0x00000044, 0x00000038, 0x00070041, 0x00000046,
-    0x00000047, 0x00000043, 0x00000018, 0x00000044, 0x00000045, 0x0004003d, 0x00000017, 0x00000048,
-    0x00000047, 0x0003003e, 0x0000003d, 0x00000048, 0x0004003d, 0x00000017, 0x0000004b, 0x0000003d,
-    0x00060041, 0x0000001a, 0x0000004c, 0x00000016, 0x0000004a, 0x0000004b, 0x0004003d, 0x00000006,
-    0x0000004d, 0x0000004c, 0x0004007c, 0x00000017, 0x0000004e, 0x0000004d, 0x0004003d, 0x00000017,
-    0x0000004f, 0x0000002f, 0x00050080, 0x00000017, 0x00000050, 0x0000004e, 0x0000004f, 0x0003003e,
-    0x00000049, 0x00000050, 0x0004003d, 0x00000017, 0x00000054, 0x00000049, 0x0004007c, 0x00000006,
-    0x00000055, 0x00000054, 0x00050080, 0x00000006, 0x00000056, 0x00000053, 0x00000055, 0x00050041,
-    0x00000031, 0x00000057, 0x00000023, 0x0000000a, 0x0004003d, 0x00000006, 0x00000058, 0x00000057,
-    0x00050041, 0x00000031, 0x00000059, 0x00000023, 0x00000030, 0x0004003d, 0x00000006, 0x0000005a,
-    0x00000059, 0x00050041, 0x0000000b, 0x0000005b, 0x00000009, 0x0000000a, 0x0004003d, 0x00000006,
-    0x0000005c, 0x0000005b, 0x000700c9, 0x00000006, 0x0000005d, 0x0000005a, 0x0000005c, 0x00000034,
-    0x00000035, 0x00050050, 0x00000021, 0x0000005e, 0x00000058, 0x0000005d, 0x00060041, 0x0000002b,
-    0x0000005f, 0x00000027, 0x00000018, 0x00000056, 0x0003003e, 0x0000005f, 0x0000005e, 0x000200f9,
-    0x00000020, 0x000200f8, 0x00000020, 0x000100fd, 0x00010038,
+const uint8_t Blob024_Data[1641] =
+{
+    0x28, 0xb5, 0x2f, 0xfd, 0x60, 0x54, 0x13, 0xfd, 0x32, 0x00, 0x86, 0xbd, 0xd4, 0x4a, 0xf0, 0xce,
+    0x38, 0x63, 0x00, 0xc0, 0x03, 0xcf, 0xc0, 0x33, 0xf0, 0x9c, 0xf9, 0x0a, 0x9f, 0xc8, 0x8e, 0x61,
+    0x51, 0xd2, 0x33, 0xf0, 0x5c, 0x56, 0x86, 0x50, 0x31, 0xb4, 0x97, 0xed, 0x13, 0x5a, 0xa6, 0x5f,
+    0x6b, 0x95, 0x37, 0xc4, 0xed, 0xae, 0x00, 0xfc, 0x23, 0xff, 0x63, 0x69, 0x29, 0xf6, 0xd6, 0xcd,
+    0x5c, 0xc0, 0x7d, 0xb5, 0x82, 0x41, 0x06, 0x96, 0x18, 0xb1, 0x6c, 0xb0, 0x41, 0x7c, 0x66, 0x13,
+    0x89, 0x6c, 0x3f, 0x59, 0xd9, 0xdd, 0xbd, 0x53, 0xb0, 0x00, 0xb5, 0x00, 0xc1, 0x00, 0xfa, 0x7f,
+    0x4a, 0x54, 0xcf, 0x96, 0xa7, 0xb4, 0xbf, 0xdf, 0x41, 0x39, 0xad, 0xcd, 0xad, 0x9f, 0xff, 0x26,
+    0xe2, 0x87, 0x58, 0x53, 0x4b, 0x9f, 0x16, 0xdb, 0xdc, 0xd4, 0x53, 0x7d, 0xf8, 0x83, 0x28, 0xce,
+    0x39, 0x5f, 0x28, 0xb7, 0x36, 0xdb, 0x4d, 0x2d, 0x6f, 0x76, 0x35, 0xff, 0x7f, 0xab, 0xb9, 0x95,
+    0xe5, 0xc3, 0xae, 0x3b, 0x5b, 0xc5, 0x27, 0x8b, 0x75, 0xfe, 0x9f, 0x64, 0xb3, 0xcd, 0x96, 0x5b,
+    0x6d, 0x34, 0xd7, 0xe6, 0x1c, 0xf5, 0x5c, 0x75, 0xfc, 0xb6, 0x5e, 0xea, 0x7a, 0x6e, 0x4c, 0x5b,
+    0x75, 0xea, 0x0b, 0xc5, 0x3d, 0x2b, 0xea, 0x9a, 0xa1, 0x37, 0xf2, 0xe1, 0xc5, 0x5a, 0x0e, 0xa5,
+    0xa9, 0x27, 0xf9, 0xac, 0x3b, 0x37, 0x2d, 0xb3, 0x67, 0x6d, 0x96, 0xd5, 0x13, 0x9d, 0x65, 0x14,
+    0x68, 0xb7, 0x33, 0xad, 0x69, 0xb3, 0x19, 0x98, 0xeb, 0xe6, 0xc6, 0x35, 0x13, 0x3d, 0x44, 0xf1,
+    0xff, 0x03, 0xbd, 0xd2, 0x46, 0xa8, 0x11, 0xfa, 0x7f, 0xf5, 0xc4, 0xe9, 0xff, 0x50, 0x0c, 0xf0,
+    0xff, 0xe0, 0x33, 0xfe, 0xff, 0xe4, 0x00, 0xc5, 0x52, 0xdb, 0x2d, 0x0b, 0xcc, 0x84, 0xb9, 0xee,
+    0xef, 0xfd, 0xfb, 0xc6, 0x45, 0x9c, 0xfc, 0xe8, 0x1e, 0xf8, 0xd1, 0xe4, 0x03, 0x03, 0xb9, 0x98,
+    0x5e, 0xaf, 0x71, 0xba, 0xcf, 0xd5, 0x88, 0xbc, 0xe8, 0xdb, 0x76, 0xe2, 0xcc, 0xd0, 0x6d, 0xa5,
+    0x21, 0x47, 0xdc, 0xd6, 0xb9, 0x75, 0xd9, 0x15, 0x5d, 0x59, 0x2c, 0xce, 0x28, 0x4b, 0xcc, 0x68,
+    0x0f, 0x96, 0xa9, 0xeb, 0x2a, 0x0b, 0xff, 0xad, 0xb2, 0x74, 0x7b, 0xb6, 0x40, 0x5b, 0xce, 0xc1,
+    0x38, 0x8d, 0x96, 0xdf, 0xbd, 0x3f, 0xcd, 0x55, 0x48, 0x53, 0x76, 0xb5, 0x9d, 0xaa, 0x05, 0xbc,
+    0x73, 0xda, 0xde, 0x9e, 0xd5, 0x13, 0xc6, 0xe6, 0x98, 0x2d, 0xd7, 0x4e, 0x76, 0x9b, 0x3d, 0x39,
+    0xc5, 0x6c, 0xfe, 0x88, 0xbb, 0x9d, 0xb9, 0x06, 0xe3, 0x76, 0xed, 0xdc, 0x51, 0x73, 0x66, 0x69,
+    0x66, 0x87, 0xcd, 0xe2, 0x6d, 0x9a, 0x37, 0xdf, 0x66, 0xf4, 0x94, 0xe1, 0xec, 0x72, 0x4d, 0x7d,
+    0xb5, 0x2f, 0x56, 0xfb, 0xfb, 0xf2, 0x3f, 0xf9, 0xd4, 0xa1, 0x61, 0xd1, 0xcd, 0x40, 0x18, 0x96,
+    0xd9, 0xdc, 0xde, 0x65, 0x59, 0x68, 0x3c, 0xbb, 0x77, 0x49, 0x7e, 0xbc, 0x3c, 0xe2, 0x77, 0x38,
+    0xbc, 0x7a, 0xda, 0x5c, 0x00, 0xf7, 0xba, 0xfa, 0x7e, 0xbd, 0xca, 0x78, 0x3c, 0xf1, 0xf7, 0x57,
+    0xb1, 0x36, 0x2f, 0xec, 0x96, 0x3d, 0x69, 0x62, 0x62, 0x31, 0x0f, 0x75, 0xaa, 0xef, 0x6a, 0x37,
+    0x20, 0x74, 0x0d, 0xe0, 0xef, 0x60, 0x84, 0xba, 0x0b, 0xbc, 0x13, 0x89, 0xc5, 0xa4, 0x52, 0x4a,
+    0x79, 0x41, 0x31, 0x70, 0x82, 0x42, 0x72, 0x62, 0x2a, 0xf9, 0x4c, 0x23, 0xff, 0xee, 0x80, 0x90,
+    0x7b, 0x90, 0x12, 0xc9, 0xe3, 0xe3, 0x05, 0x80, 0x07, 0x47, 0xc6, 0xbf, 0xd1, 0xf1, 0xf1, 0x24,
+    0x07, 0x3f, 0x22, 0x92, 0x21, 0xf2, 0x00, 0x61, 0xc6, 0x1d, 0x95, 0x44, 0x2a, 0xa1, 0x17, 0x8f,
+    0x2c, 0x81, 0x23, 0xa9, 0x74, 0x3d, 0xc0, 0x83, 0x1f, 0x47, 0x48, 0x08, 0xad, 0xb5, 0xd6, 0x5a,
+    0x6b, 0xfd, 0x75, 0x4d, 0xff, 0x8d, 0x5a, 0x32, 0x12, 0x52, 0xa8, 0xef, 0x94, 0xa6, 0x69, 0x9a,
+    0xfe, 0xe9, 0xf5, 0xc1, 0xef, 0xe0, 0xe1, 0x78, 0x2c, 0x56, 0x59, 0x96, 0x0f, 0x57, 0x64, 0x0e,
+    0x88, 0x4e, 0x42, 0x25, 0x52, 0x64, 0x04, 0xb9, 0x1d, 0xa2, 0x46, 0x08, 0x00, 0x24, 0xbf, 0xd0,
+    0x7b, 0x4c, 0x28, 0x25, 0x05, 0xe5, 0x47, 0x21, 0x4f, 0x48, 0xd3, 0x4b, 0x3e, 0x3e, 0xf0, 0x2e,
+    0x8d, 0xf0, 0x04, 0x58, 0xe2, 0x0b, 0xf2, 0x7e, 0xf1, 0x35, 0x1c, 0x02, 0xc2, 0x0d, 0x0d, 0x8d,
+    0x5f, 0x24, 0xf4, 0xf0, 0xae, 0x16, 0xe8, 0xa4, 0x8e, 0xa6, 0xd9, 0xd7, 0xb0, 0x9e, 0x8d, 0x22,
+    0xcf, 0xbd, 0xc6, 0xac, 0xf6, 0x25, 0x8e, 0xb2, 0xf0, 0xa6, 0xc6, 0x2c, 0xf8, 0xdd, 0x63, 0x73,
+    0xff, 0x66, 0xe1, 0xda, 0xf7, 0x9e, 0xba, 0xf7, 0x17, 0xa5, 0xef, 0x2d, 0x66, 0x3a, 0xb3, 0x0d,
+    0x1c, 0x4c, 0x31, 0x0d, 0x1b, 0xc6, 0xa7, 0xd0, 0x90, 0x61, 0xc4, 0x83, 0xe1, 0xc4, 0x73, 0x41,
+    0xb4, 0x63, 0xea, 0xc8, 0x2c, 0xdc, 0x97, 0x2c, 0xf6, 0xba, 0x89, 0xb5, 0xdc, 0xa8, 0x2a, 0xd8,
+    0x4c, 0x80, 0x5d, 0x15, 0x05, 0x95, 0xab, 0x66, 0x86, 0xe5, 0xa2, 0x49, 0xb5, 0x54, 0xa9, 0x17,
+    0x09, 0x28, 0x90, 0x97, 0x08, 0x10, 0x5a, 0x5c, 0x1e, 0x88, 0x40, 0xb9, 0xa8, 0x68, 0x70, 0x62,
+    0xb0, 0x40, 0x81, 0x09, 0x8c, 0x02, 0x53, 0x82, 0x94, 0x15, 0x95, 0x52, 0x94, 0xe0, 0x06, 0x21,
+    0x38, 0x50, 0xa0, 0x54, 0x80, 0xc4, 0xc5, 0xc1, 0xaf, 0xc0, 0x20, 0x19, 0x31, 0x21, 0x12, 0x02,
+    0x42, 0x60, 0x40, 0x89, 0xa1, 0x0a, 0x8d, 0xca, 0x97, 0x2a, 0xd5, 0xc2, 0x62, 0x52, 0x22, 0xb2,
+    0xf8, 0x77, 0xf1, 0x2e, 0xa7, 0x10, 0xe3, 0x0a, 0x88, 0x9d, 0x0e, 0x88, 0xf6, 0xb3, 0xfb, 0xc9,
+    0x81, 0xe8, 0x70, 0x3b, 0x77, 0xb3, 0xed, 0xa0, 0xb7, 0xec, 0x07, 0x1d, 0xfa, 0xa0, 0x2f, 0x5a,
+    0xd5, 0x54, 0x45, 0x7d, 0x6e, 0x4a, 0xf2, 0xa1, 0xa4, 0x0c, 0x9f, 0x12, 0x0f, 0xe4, 0xcf, 0x0f,
+    0x87, 0x6f, 0x3d, 0x24, 0x6c, 0x78, 0x44, 0x2e, 0xd5, 0x64, 0x68, 0x64, 0xcf, 0x09, 0xec, 0x75,
+    0xc8, 0x11, 0x99, 0x17, 0x05, 0xe5, 0xdc, 0xa3, 0x8e, 0xc3, 0x60, 0x02, 0x89, 0x66, 0x9c, 0x61,
+    0xad, 0xca, 0x95, 0x4c, 0x19, 0x23, 0x73, 0x61, 0x2e, 0x29, 0xe6, 0x18, 0x25, 0x98, 0x07, 0x82,
+    0x5f, 0xa8, 0xd2, 0x20, 0x93, 0x23, 0x35, 0x92, 0xa4, 0x20, 0xa9, 0xb4, 0x06, 0xe2, 0x63, 0x86,
+    0x78, 0x90, 0x52, 0xd9, 0x01, 0x22, 0x22, 0x14, 0x62, 0x3d, 0xc2, 0x50, 0x05, 0x2d, 0x28, 0x30,
+    0x0d, 0xbb, 0x01, 0x00, 0x10, 0xe3, 0xce, 0x3b, 0xde, 0x67, 0xcc, 0x9d, 0x7f, 0x57, 0x6e, 0x28,
+    0xce, 0x3f, 0x77, 0xda, 0xa4, 0x96, 0xbe, 0x25, 0x03, 0xe6, 0xaf, 0x3f, 0x3d, 0x43, 0x6f, 0x3e,
+    0xb1, 0x5b, 0xe7, 0x6d, 0x40, 0x9a, 0x6a, 0x07, 0xd8, 0x6d, 0xa7, 0xc0, 0x6d, 0x33, 0xdb, 0x7c,
+    0xd7, 0xb3, 0x0f, 0x93, 0x0a, 0xb7, 0xf5, 0xc0, 0xdc, 0x2e, 0xbf, 0xac, 0x1e, 0x6c, 0xc9, 0xef,
+    0x97, 0x7d, 0x0b, 0x6f, 0x12, 0xea, 0xa7, 0x49, 0xe8, 0xb1, 0x3e, 0xc9, 0x78, 0xfb, 0x79, 0xc3,
+    0xb1, 0x37, 0xae, 0xbf, 0xdb, 0x68, 0x77, 0x79, 0x1f, 0x2e, 0x0e, 0xb8, 0xb4, 0xe1, 0xed, 0xe2,
+    0xa0, 0x3e, 0x98, 0x6f, 0x46, 0x5f, 0x96, 0x53, 0x74, 0x8f, 0xba, 0xeb, 0xcb, 0x82, 0xde, 0xea,
+    0xe1, 0x09, 0x59, 0xfe, 0x2b, 0x3b, 0x4e, 0x4e, 0x7f, 0x10, 0x3f, 0xbd, 0xb1, 0x7f, 0xa3, 0x19,
+    0x9b, 0xdb, 0xc1, 0x4a, 0x75, 0xcd, 0xfd, 0xf1, 0xcc, 0x0c, 0x06, 0x0d, 0x7a, 0x52, 0xf2, 0x4b,
+    0x35, 0xdf, 0x57, 0xf1, 0xfc, 0xa0, 0xb5, 0x9e, 0x69, 0xf3, 0xde, 0x3a, 0xb1, 0x8e, 0x1b, 0x89,
+    0x08, 0x37, 0x47, 0xcb, 0x9c, 0xf7, 0x71, 0x8f, 0x70, 0x97, 0xdb, 0xa5, 0x4a, 0xe9, 0x06, 0x2b,
+    0xd0, 0x74, 0xef, 0xea, 0x8c, 0xb7, 0xe0, 0x58, 0x31, 0x61, 0x4d, 0xbb, 0x81, 0x34, 0x39, 0xa4,
+    0x03, 0x11, 0x3b, 0x34, 0xb3, 0xcf, 0xe7, 0xb3, 0x09, 0x4f, 0xf2, 0xef, 0x0d, 0x78, 0x61, 0xf6,
+    0x14, 0xe3, 0x6f, 0xdd, 0xe5, 0xe4, 0x88, 0xe6, 0xcb, 0xde, 0xe4, 0x0e, 0xb4, 0x82, 0xbb, 0xce,
+    0x6b, 0xf3, 0xff, 0x6e, 0x6e, 0x1b, 0x2c, 0xe7, 0xe9, 0x1b, 0x1f, 0x9d, 0x01, 0x87, 0xcb, 0x3a,
+    0x48, 0xc8, 0x98, 0x7f, 0xc3, 0x16, 0x0b, 0x4d, 0x05, 0xb9, 0xb2, 0xc5, 0xf4, 0x8a, 0x6f, 0xc6,
+    0x36, 0xfb, 0x79, 0x17, 0x06, 0x93, 0x8c, 0xd3, 0x38, 0x54, 0x3e, 0x23, 0xb8, 0xfd, 0x15, 0xba,
+    0x93, 0x9c, 0x3a, 0xab, 0xa7, 0xd2, 0x6a, 0x69, 0xb8, 0x6f, 0x76, 0xbd, 0x20, 0x57, 0x6c, 0x8d,
+    0x7d, 0xaf, 0xcf, 0x27, 0x2f, 0x40, 0xab, 0xef, 0xb9, 0xec, 0x2a, 0x5e, 0x34, 0x70, 0xc8, 0x80,
+    0x05, 0x2d, 0xca, 0x15, 0xae, 0x9b, 0xc2, 0x64, 0xd2, 0x65, 0xe6, 0x80, 0x76, 0x8a, 0x0b, 0x69,
+    0x99, 0x97, 0xcf, 0xce, 0x93, 0xbd, 0x2f, 0x33, 0x14, 0x87, 0x41, 0x4c, 0xbb, 0x70, 0xbd, 0x13,
+    0x4b, 0xcb, 0x7b, 0x5a, 0xa7, 0x19, 0xe5, 0x5d, 0xc2, 0xf2, 0x14, 0x4f, 0x88, 0xce, 0xa6, 0x74,
+    0x88, 0x8b, 0x5a, 0xf8, 0x63, 0xed, 0x2e, 0xa9, 0x8f, 0xf2, 0x17, 0x09, 0xa6, 0xb9, 0x4c, 0x49,
+    0xae, 0x4f, 0xaa, 0x85, 0x43, 0x01, 0x4d, 0xf9, 0xab, 0x2e, 0x0e, 0x54, 0x42, 0x7f, 0x35, 0xfc,
+    0x37, 0xfe, 0x72, 0xa2, 0x52, 0x4d, 0xfc, 0xe3, 0x11, 0xf4, 0xfe, 0xe7, 0xbd, 0x67, 0xa2, 0x94,
+    0xe1, 0x14, 0xbe, 0x35, 0xf3, 0x83, 0xb8, 0xbd, 0x01, 0xfe, 0x79, 0x85, 0xe2, 0xb7, 0xdd, 0x41,
+    0x31, 0x9b, 0x26, 0x4f, 0x3d, 0x5e, 0x1d, 0xad, 0xe5, 0xf8, 0x19, 0x83, 0x66, 0x15, 0x66, 0x33,
+    0x62, 0x8e, 0x09, 0xbd, 0xe1, 0x2e, 0xa5, 0x8d, 0xf7, 0x71, 0x2e, 0xd3, 0x97, 0x16, 0x3b, 0x33,
+    0x0c, 0x99, 0x92, 0x69, 0xb6, 0xce, 0x64, 0x29, 0xf1, 0xef, 0xe0, 0x57, 0x48, 0x38, 0x8e, 0x5c,
+    0xaf, 0x4c, 0x4f, 0xd7, 0x72, 0x90, 0x10, 0xb1, 0x13, 0x54, 0x98, 0x4f, 0xeb, 0x30, 0x3c, 0xd1,
+    0xa5, 0x3a, 0x87, 0x90, 0xb3, 0xf2, 0x2d, 0xf0, 0xdf, 0x76, 0x25, 0x9f, 0x5d, 0xf4, 0xa7, 0x48,
+    0x45, 0xc9, 0xcc, 0xd4, 0x3c, 0x34, 0x69, 0xc9, 0x24, 0x63, 0xcd, 0x2c, 0x70, 0xf0, 0x97, 0xde,
+    0x01, 0x7f, 0x4f, 0x63, 0xc7, 0x6a, 0x28, 0x3d, 0x0f, 0x6f, 0x23, 0x71, 0xa2, 0xc7, 0x84, 0x14,
+    0xfa, 0x35, 0x81, 0xbc, 0xce, 0x8c, 0x60, 0xc3, 0xf1, 0xad, 0x57, 0xf9, 0xdf, 0x9b, 0x48, 0xe2,
+    0xfb, 0x16, 0x16, 0x4d, 0x2b, 0x9e, 0x6c, 0x5b, 0x50, 0xf9, 0x4f, 0x07, 0xee, 0x17, 0x7b, 0x65,
+    0xce, 0x9c, 0x2d, 0x69, 0x1e, 0x53, 0x85, 0xe7, 0x96, 0x3f, 0xb8, 0xf1, 0x9a, 0x4b, 0xb3, 0x0c,
+    0xf7, 0xd1, 0xe9, 0x80, 0x8c, 0xee, 0xcd, 0xc3, 0x1a, 0x07, 0xd9, 0x71, 0x65, 0x8d, 0xbb, 0x3e,
+    0xd9, 0x7a, 0x7c, 0x92, 0x48, 0xa0, 0x6c, 0x11, 0xdf, 0xb1, 0x1c, 0xfa, 0xf9, 0xb0, 0xf8, 0xd2,
+    0x2b, 0xf7, 0x4f, 0xd9, 0x7e, 0xca, 0x61, 0xca, 0xf8, 0xd5, 0x08, 0xf7, 0x6f, 0x10, 0xc7, 0xd9,
+    0x2d, 0xc9, 0x79, 0x3a, 0x53, 0xd3, 0x73, 0x7e, 0xc2, 0xff, 0x6d, 0xcc, 0x2b, 0x16, 0x36, 0xe8,
+    0xc4, 0x6a, 0x5b, 0xb7, 0xf9, 0x35, 0xd8, 0x51, 0xa6, 0xcd, 0x7a, 0xce, 0x20, 0x2c, 0x71, 0xb6,
+    0x51, 0x4f, 0x62, 0x91, 0x95, 0x9f, 0x7f, 0xca, 0x7f, 0xb1, 0xab, 0x2f, 0x56, 0x6f, 0x9d, 0x30,
+    0x56, 0xc6, 0x91, 0xd5, 0xb2, 0x1a, 0x83, 0xf1, 0x9e, 0xb5, 0x72, 0x47, 0xc0, 0x81, 0xa0, 0x42,
+    0x86, 0xf8, 0x10, 0xd2, 0x03, 0x76, 0x43, 0x19, 0x60, 0x33, 0x21, 0x91, 0xb9, 0x74, 0x20, 0xaf,
+    0x96, 0x78, 0x92, 0x84, 0xeb, 0x3d, 0x56, 0x0e, 0xd9, 0x68, 0x7b, 0xa0, 0xd0, 0x98, 0xf4, 0xd7,
+    0xc4, 0xb9, 0xfa, 0xb3, 0x17, 0xc4, 0x85, 0x61, 0x7c, 0x5d, 0x5c, 0x31, 0x34, 0x3a, 0x3a, 0xcb,
+    0x7f, 0xa0, 0x79, 0x9e, 0xbb, 0xbe, 0x2f, 0x97, 0x70,
 };
+const ShaderModule Blob024 = { Blob024_Data, 1641u, 1301u, 24u };
 
-extern const uint32_t Blob062[1305];
-const uint32_t Blob062[1305] = {
-    0x07230203, 0x00010300, 0x0008000b, 0x0000007d, 0x00000000, 0x00020011, 0x00000001, 0x0006000b,
-    0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001,
-    0x0006000f, 0x00000005, 0x00000004, 0x6e69616d, 0x00000000, 0x00000009, 0x00060010, 0x00000004,
-    0x00000011, 0x00000020, 0x00000001, 0x00000001, 0x00030003, 0x00000002, 0x000001c2, 0x000a0004,
-    0x475f4c47, 0x4c474f4f, 0x70635f45, 0x74735f70, 0x5f656c79, 0x656e696c, 0x7269645f, 0x69746365,
-    0x00006576, 0x00080004, 0x475f4c47, 0x4c474f4f, 0x6e695f45, 0x64756c63, 0x69645f65, 0x74636572,
-    0x00657669, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000, 0x00080005, 0x00000009, 0x475f6c67,
-    0x61626f6c, 0x766e496c, 0x7461636f, 0x496e6f69, 0x00000044, 0x00060005, 0x00000014, 0x526e6942,
-    0x6c757365, 0x66754274, 0x00726566, 0x00080006, 0x00000014, 0x00000000, 0x69726156, 0x57746e61,
-    0x436b726f, 0x746e756f, 0x00000000, 0x00080006, 0x00000014, 0x00000001, 0x74726f53, 0x6f576465,
-    0x664f6b72, 0x74657366, 0x00000000, 0x00090006, 0x00000014, 0x00000002, 0x69726156, 0x57746e61,
-    0x526b726f, 0x436c6165, 0x746e756f, 0x00000000, 0x00080006, 0x00000014, 0x00000003, 0x74726f53,
-    0x6b726f57, 0x6b726f57, 0x6e756f43, 0x00000074, 0x00090006, 0x00000014, 0x00000004, 0x6e6e6942,
-    0x4d676e69, 0x416b7361, 0x664f646e, 0x74657366, 0x00000000, 0x00030005, 0x00000016, 0x00000000,
-    0x00050005, 0x00000023, 0x6b726f77, 0x63736544, 0x00000000, 0x00060005, 0x00000025, 0x6b726f57,
-    0x63736544, 0x66667542, 0x00007265, 0x00060006, 0x00000025, 0x00000000, 0x6b726f57, 0x63736544,
-    0x00000073, 0x00030005, 0x00000027, 0x00000000, 0x00060005, 0x0000002f, 0x61566e69, 0x6e616972,
-    0x66664f74, 0x00746573, 0x00050005, 0x00000038, 0x796c6f70, 0x496e6f67, 0x00007864, 0x00050005,
-    0x0000003d, 0x69726176, 0x49746e61, 0x00007864, 0x00040005, 0x0000003f, 0x796c6f50, 0x006e6f67,
-    0x00060006, 0x0000003f, 0x00000000, 0x73726946, 0x70535874, 0x00006e61, 0x00050006, 0x0000003f,
-    0x00000001, 0x706f5459, 0x00000000, 0x00050006, 0x0000003f, 0x00000002, 0x746f4259, 0x00000000,
-    0x00050006, 0x0000003f, 0x00000003, 0x6e694d58, 0x00000000, 0x00050006, 0x0000003f, 0x00000004,
-    0x78614d58, 0x00000000, 0x00050006, 0x0000003f, 0x00000005, 0x6e694d58, 0x00000059, 0x00050006,
-    0x0000003f, 0x00000006, 0x78614d58, 0x00000059, 0x00050006, 0x0000003f, 0x00000007, 0x69726156,
-    0x00746e61, 0x00050006, 0x0000003f, 0x00000008, 0x72747441, 0x00000000, 0x00070006, 0x0000003f,
-    0x00000009, 0x74786554, 0x4c657275, 0x72657961, 0x00000000, 0x00060006, 0x0000003f, 0x0000000a,
-    0x69636146, 0x6956676e, 0x00007765, 0x00060005, 0x00000041, 0x796c6f50, 0x426e6f67, 0x65666675,
-    0x00000072, 0x00060006, 0x00000041, 0x00000000, 0x796c6f50, 0x736e6f67, 0x00000000, 0x00030005,
-    0x00000043, 0x00000000, 0x00050005, 0x00000049, 0x74726f73, 0x6e496465, 0x00786564, 0x00060005,
-    0x00000051, 0x5778614d, 0x546b726f, 0x73656c69, 0x00000000, 0x00080005, 0x00000053, 0x6b726f57,
-    0x63736544, 0x726f5373, 0x53646574, 0x74726174, 0x00000000, 0x00050005, 0x00000060, 0x65726353,
-    0x69576e65, 0x00687464, 0x00060005, 0x00000061, 0x65726353, 0x65486e65, 0x74686769, 0x00000000,
-    0x00070005, 0x00000065, 0x6d617246, 0x66756265, 0x53726566, 0x64697274, 0x00000065, 0x00060005,
-    0x00000067, 0x656c6954, 0x72655073, 0x656e694c, 0x00000000, 0x00050005, 0x00000068, 0x656c6954,
-    0x656e694c, 0x00000073, 0x00050005, 0x0000006e, 0x6174654d, 0x66696e55, 0x006d726f, 0x00060006,
-    0x0000006e, 0x00000000, 0x506d754e, 0x67796c6f, 0x00736e6f, 0x00060006, 0x0000006e, 0x00000001,
-    0x566d754e, 0x61697261, 0x0073746e, 0x00060006, 0x0000006e, 0x00000002, 0x68706c41, 0x66655261,
-    0x00000000, 0x00050006, 0x0000006e, 0x00000003, 0x70736944, 0x00746e43, 0x00060006, 0x0000006e,
-    0x00000004, 0x6e6f6f54, 0x6c626154, 0x00000065, 0x00060006, 0x0000006e, 0x00000005, 0x61656c43,
-    0x6c6f4372, 0x0000726f, 0x00060006, 0x0000006e, 0x00000006, 0x61656c43, 0x70654472, 0x00006874,
-    0x00060006, 0x0000006e, 0x00000007, 0x61656c43, 0x74744172, 0x00000072, 0x00060006, 0x0000006e,
-    0x00000008, 0x4f676f46, 0x65736666, 0x00000074, 0x00060006, 0x0000006e, 0x00000009, 0x53676f46,
-    0x74666968, 0x00000000, 0x00060006, 0x0000006e, 0x0000000a, 0x43676f46, 0x726f6c6f, 0x00000000,
-    0x00080006, 0x0000006e, 0x0000000b, 0x61656c43, 0x74694272, 0x4f70616d, 0x65736666, 0x00000074,
-    0x00030005, 0x00000070, 0x00000000, 0x00060005, 0x00000071, 0x68737550, 0x736e6f43, 0x746e6174,
-    0x00000073, 0x00060006, 0x00000071, 0x00000000, 0x56727543, 0x61697261, 0x0000746e, 0x00060006,
-    0x00000071, 0x00000001, 0x57786554, 0x68746469, 0x00000000, 0x00060006, 0x00000071, 0x00000002,
-    0x48786554, 0x68676965, 0x00000074, 0x00060006, 0x00000071, 0x00000003, 0x57786554, 0x53706172,
-    0x00000000, 0x00060006, 0x00000071, 0x00000004, 0x57786554, 0x54706172, 0x00000000, 0x00070006,
-    0x00000071, 0x00000005, 0x49786554, 0x70614373, 0x65727574, 0x00000000, 0x00070006, 0x00000071,
-    0x00000006, 0x74706143, 0x59657275, 0x7366664f, 0x00007465, 0x00050006, 0x00000071, 0x00000007,
-    0x6461705f, 0x00000000, 0x00030005, 0x00000073, 0x00006370, 0x00070005, 0x00000077, 0x6e6e6942,
-    0x4d676e69, 0x536b7361, 0x74726174, 0x00000000, 0x00080005, 0x0000007a, 0x6e6e6942, 0x57676e69,
-    0x4f6b726f, 0x65736666, 0x74537374, 0x00747261, 0x00040047, 0x00000009, 0x0000000b, 0x0000001c,
-    0x00040047, 0x00000010, 0x00000006, 0x00000010, 0x00040047, 0x00000011, 0x00000006, 0x00000004,
-    0x00040047, 0x00000012, 0x00000006, 0x00000004, 0x00040047, 0x00000013, 0x00000006, 0x00000004,
-    0x00050048, 0x00000014, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000014, 0x00000001,
-    0x00000023, 0x00008000, 0x00050048, 0x00000014, 0x00000002, 0x00000023, 0x0000a000, 0x00050048,
-    0x00000014, 0x00000003, 0x00000023, 0x0000c000, 0x00050048, 0x00000014, 0x00000004, 0x00000023,
-    0x0000c010, 0x00030047, 0x00000014, 0x00000002, 0x00040047, 0x00000016, 0x00000022, 0x00000000,
-    0x00040047, 0x00000016, 0x00000021, 0x00000008, 0x00040047, 0x00000024, 0x00000006, 0x00000008,
-    0x00050048, 0x00000025, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000025, 0x00000002,
-    0x00040047, 0x00000027, 0x00000022, 0x00000000, 0x00040047, 0x00000027, 0x00000021, 0x00000009,
-    0x00050048, 0x0000003f, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x0000003f, 0x00000001,
-    0x00000023, 0x00000004, 0x00050048, 0x0000003f, 0x00000002, 0x00000023, 0x00000008, 0x00050048,
-    0x0000003f, 0x00000003, 0x00000023, 0x0000000c, 0x00050048, 0x0000003f, 0x00000004, 0x00000023,
-    0x00000010, 0x00050048, 0x0000003f, 0x00000005, 0x00000023, 0x00000014, 0x00050048, 0x0000003f,
-    0x00000006, 0x00000023, 0x00000018, 0x00050048, 0x0000003f, 0x00000007, 0x00000023, 0x0000001c,
-    0x00050048, 0x0000003f, 0x00000008, 0x00000023, 0x00000020, 0x00050048, 0x0000003f, 0x00000009,
-    0x00000023, 0x00000024, 0x00050048, 0x0000003f, 0x0000000a, 0x00000023, 0x00000028, 0x00040047,
-    0x00000040, 0x00000006, 0x0000002c, 0x00040048, 0x00000041, 0x00000000, 0x00000018, 0x00050048,
-    0x00000041, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000041, 0x00000002, 0x00040047,
-    0x00000043, 0x00000022, 0x00000000, 0x00040047, 0x00000043, 0x00000021, 0x00000001, 0x00040047,
-    0x00000051, 0x00000001, 0x00000002, 0x00040047, 0x00000060, 0x00000001, 0x00000000, 0x00040047,
-    0x00000061, 0x00000001, 0x00000001, 0x00040047, 0x0000006c, 0x00000006, 0x00000010, 0x00050048,
-    0x0000006e, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x0000006e, 0x00000001, 0x00000023,
-    0x00000004, 0x00050048, 0x0000006e, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x0000006e,
-    0x00000003, 0x00000023, 0x0000000c, 0x00050048, 0x0000006e, 0x00000004, 0x00000023, 0x00000010,
-    0x00050048, 0x0000006e, 0x00000005, 0x00000023, 0x00000230, 0x00050048, 0x0000006e, 0x00000006,
-    0x00000023, 0x00000234, 0x00050048, 0x0000006e, 0x00000007, 0x00000023, 0x00000238, 0x00050048,
-    0x0000006e, 0x00000008, 0x00000023, 0x0000023c, 0x00050048, 0x0000006e, 0x00000009, 0x00000023,
-    0x00000240, 0x00050048, 0x0000006e, 0x0000000a, 0x00000023, 0x00000244, 0x00050048, 0x0000006e,
-    0x0000000b, 0x00000023, 0x00000248, 0x00030047, 0x0000006e, 0x00000002, 0x00040047, 0x00000070,
-    0x00000022, 0x00000000, 0x00040047, 0x00000070, 0x00000021, 0x00000000, 0x00050048, 0x00000071,
-    0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000071, 0x00000001, 0x00000023, 0x00000004,
-    0x00050048, 0x00000071, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x00000071, 0x00000003,
-    0x00000023, 0x0000000c, 0x00050048, 0x00000071, 0x00000004, 0x00000023, 0x00000010, 0x00050048,
-    0x00000071, 0x00000005, 0x00000023, 0x00000014, 0x00050048, 0x00000071, 0x00000006, 0x00000023,
-    0x00000018, 0x00050048, 0x00000071, 0x00000007, 0x00000023, 0x0000001c, 0x00030047, 0x00000071,
-    0x00000002, 0x00040047, 0x0000007c, 0x0000000b, 0x00000019, 0x00020013, 0x00000002, 0x00030021,
-    0x00000003, 0x00000002, 0x00040015, 0x00000006, 0x00000020, 0x00000000, 0x00040017, 0x00000007,
-    0x00000006, 0x00000003, 0x00040020, 0x00000008, 0x00000001, 0x00000007, 0x0004003b, 0x00000008,
-    0x00000009, 0x00000001, 0x0004002b, 0x00000006, 0x0000000a, 0x00000000, 0x00040020, 0x0000000b,
-    0x00000001, 0x00000006, 0x00040017, 0x0000000e, 0x00000006, 0x00000004, 0x0004002b, 0x00000006,
-    0x0000000f, 0x00000800, 0x0004001c, 0x00000010, 0x0000000e, 0x0000000f, 0x0004001c, 0x00000011,
-    0x00000006, 0x0000000f, 0x0004001c, 0x00000012, 0x00000006, 0x0000000f, 0x0003001d, 0x00000013,
-    0x00000006, 0x0007001e, 0x00000014, 0x00000010, 0x00000011, 0x00000012, 0x0000000e, 0x00000013,
-    0x00040020, 0x00000015, 0x0000000c, 0x00000014, 0x0004003b, 0x00000015, 0x00000016, 0x0000000c,
-    0x00040015, 0x00000017, 0x00000020, 0x00000001, 0x0004002b, 0x00000017, 0x00000018, 0x00000000,
-    0x0004002b, 0x00000006, 0x00000019, 0x00000003, 0x00040020, 0x0000001a, 0x0000000c, 0x00000006,
-    0x00020014, 0x0000001d, 0x00040017, 0x00000021, 0x00000006, 0x00000002, 0x00040020, 0x00000022,
-    0x00000007, 0x00000021, 0x0003001d, 0x00000024, 0x00000021, 0x0003001e, 0x00000025, 0x00000024,
-    0x00040020, 0x00000026, 0x0000000c, 0x00000025, 0x0004003b, 0x00000026, 0x00000027, 0x0000000c,
-    0x00040020, 0x0000002b, 0x0000000c, 0x00000021, 0x00040020, 0x0000002e, 0x00000007, 0x00000017,
-    0x0004002b, 0x00000006, 0x00000030, 0x00000001, 0x00040020, 0x00000031, 0x00000007, 0x00000006,
-    0x0004002b, 0x00000017, 0x00000034, 0x0000000b, 0x0004002b, 0x00000017, 0x00000035, 0x00000015,
-    0x00030016, 0x0000003e, 0x00000020, 0x000d001e, 0x0000003f, 0x00000017, 0x00000017, 0x00000017,
-    0x00000017, 0x00000017, 0x00000017, 0x00000017, 0x00000017, 0x00000006, 0x0000003e, 0x00000006,
-    0x0003001d, 0x00000040, 0x0000003f, 0x0003001e, 0x00000041, 0x00000040, 0x00040020, 0x00000042,
-    0x0000000c, 0x00000041, 0x0004003b, 0x00000042, 0x00000043, 0x0000000c, 0x0004002b, 0x00000017,
-    0x00000045, 0x00000007, 0x00040020, 0x00000046, 0x0000000c, 0x00000017, 0x0004002b, 0x00000017,
-    0x0000004a, 0x00000001, 0x00040032, 0x00000017, 0x00000051, 0x00003000, 0x00060034, 0x00000006,
-    0x00000052, 0x00000080, 0x00000051, 0x0000000a, 0x00060034, 0x00000006, 0x00000053, 0x00000080,
-    0x0000000a, 0x00000052, 0x00040032, 0x00000017, 0x00000060, 0x00000100, 0x00040032, 0x00000017,
-    0x00000061, 0x000000c0, 0x0004002b, 0x00000017, 0x00000062, 0x00000008, 0x0004002b, 0x00000017,
-    0x00000063, 0x00000080, 0x0004002b, 0x00000017, 0x00000064, 0x00000040, 0x00060034, 0x00000017,
-    0x00000065, 0x00000084, 0x00000060, 0x00000061, 0x0004002b, 0x00000017, 0x00000066, 0x00000010,
-    0x00060034, 0x00000017, 0x00000067, 0x00000087, 0x00000060, 0x00000066, 0x00060034, 0x00000017,
-    0x00000068, 0x00000087, 0x00000061, 0x00000066, 0x0004002b, 0x00000017, 0x00000069, 0x00000002,
-    0x0004002b, 0x00000017, 0x0000006a, 0x00000800, 0x0004002b, 0x00000006, 0x0000006b, 0x00000022,
-    0x0004001c, 0x0000006c, 0x0000000e, 0x0000006b, 0x00040017, 0x0000006d, 0x0000003e, 0x00000002,
-    0x000e001e, 0x0000006e, 0x00000006, 0x00000006, 0x00000017, 0x00000006, 0x0000006c, 0x00000006,
-    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x0000006d, 0x00040020, 0x0000006f,
-    0x00000002, 0x0000006e, 0x0004003b, 0x0000006f, 0x00000070, 0x00000002, 0x000a001e, 0x00000071,
-    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000017, 0x00000006,
-    0x00040020, 0x00000072, 0x00000009, 0x00000071, 0x0004003b, 0x00000072, 0x00000073, 0x00000009,
-    0x0004002b, 0x00000006, 0x00000074, 0x00008000, 0x00060034, 0x00000017, 0x00000075, 0x00000084,
-    0x00000067, 0x00000068, 0x00060034, 0x00000017, 0x00000076, 0x00000084, 0x00000075, 0x00000069,
-    0x00060034, 0x00000017, 0x00000077, 0x00000080, 0x00000018, 0x00000076, 0x00060034, 0x00000017,
-    0x00000078, 0x00000084, 0x00000067, 0x00000068, 0x00060034, 0x00000017, 0x00000079, 0x00000084,
-    0x00000078, 0x00000064, 0x00060034, 0x00000017, 0x0000007a, 0x00000080, 0x00000077, 0x00000079,
-    0x0004002b, 0x00000006, 0x0000007b, 0x00000020, 0x0006002c, 0x00000007, 0x0000007c, 0x0000007b,
-    0x00000030, 0x00000030, 0x00050036, 0x00000002, 0x00000004, 0x00000000, 0x00000003, 0x000200f8,
-    0x00000005, 0x0004003b, 0x00000022, 0x00000023, 0x00000007, 0x0004003b, 0x0000002e, 0x0000002f,
-    0x00000007, 0x0004003b, 0x0000002e, 0x00000038, 0x00000007, 0x0004003b, 0x0000002e, 0x0000003d,
-    0x00000007, 0x0004003b, 0x0000002e, 0x00000049, 0x00000007, 0x00050041, 0x0000000b, 0x0000000c,
-    0x00000009, 0x0000000a, 0x0004003d, 0x00000006, 0x0000000d, 0x0000000c, 0x00070041, 0x0000001a,
-    0x0000001b, 0x00000016, 0x00000018, 0x00000018, 0x00000019, 0x0004003d, 0x00000006, 0x0000001c,
-    0x0000001b, 0x000500b0, 0x0000001d, 0x0000001e, 0x0000000d, 0x0000001c, 0x000300f7, 0x00000020,
-    0x00000000, 0x000400fa, 0x0000001e, 0x0000001f, 0x00000020, 0x000200f8, 0x0000001f, 0x00050041,
-    0x0000000b, 0x00000028, 0x00000009, 0x0000000a, 0x0004003d, 0x00000006, 0x00000029, 0x00000028,
-    0x00050080, 0x00000006, 0x0000002a, 0x0000000a, 0x00000029, 0x00060041, 0x0000002b, 0x0000002c,
-    0x00000027, 0x00000018, 0x0000002a, 0x0004003d, 0x00000021, 0x0000002d, 0x0000002c, 0x0003003e,
-    0x00000023, 0x0000002d, 0x00050041, 0x00000031, 0x00000032, 0x00000023, 0x00000030, 0x0004003d,
-    0x00000006, 0x00000033, 0x00000032, 0x000600cb, 0x00000006, 0x00000036, 0x00000033, 0x00000034,
-    0x00000035, 0x0004007c, 0x00000017, 0x00000037, 0x00000036, 0x0003003e, 0x0000002f, 0x00000037,
-    0x00050041, 0x00000031, 0x00000039, 0x00000023, 0x00000030, 0x0004003d, 0x00000006, 0x0000003a,
-    0x00000039, 0x000600cb, 0x00000006, 0x0000003b, 0x0000003a, 0x00000018, 0x00000034, 0x0004007c,
-    0x00000017, 0x0000003c, 0x0000003b, 0x0003003e, 0x00000038, 0x0000003c, 0x0004003d, 0x00000017,
-    0x00000044, 0x00000038, 0x00070041, 0x00000046, 0x00000047, 0x00000043, 0x00000018, 0x00000044,
-    0x00000045, 0x0004003d, 0x00000017, 0x00000048, 0x00000047, 0x0003003e, 0x0000003d, 0x00000048,
-    0x0004003d, 0x00000017, 0x0000004b, 0x0000003d, 0x00060041, 0x0000001a, 0x0000004c, 0x00000016,
-    0x0000004a, 0x0000004b, 0x0004003d, 0x00000006, 0x0000004d, 0x0000004c, 0x0004007c, 0x00000017,
-    0x0000004e, 0x0000004d, 0x0004003d, 0x00000017, 0x0000004f, 0x0000002f, 0x00050080, 0x00000017,
-    0x00000050, 0x0000004e, 0x0000004f, 0x0003003e, 0x00000049, 0x00000050, 0x0004003d, 0x00000017,
-    0x00000054, 0x00000049, 0x0004007c, 0x00000006, 0x00000055, 0x00000054, 0x00050080, 0x00000006,
-    0x00000056, 0x00000053, 0x00000055, 0x00050041, 0x00000031, 0x00000057, 0x00000023, 0x0000000a,
-    0x0004003d, 0x00000006, 0x00000058, 0x00000057, 0x00050041, 0x00000031, 0x00000059, 0x00000023,
-    0x00000030, 0x0004003d, 0x00000006, 0x0000005a, 0x00000059, 0x00050041, 0x0000000b, 0x0000005b,
-    0x00000009, 0x0000000a, 0x0004003d, 0x00000006, 0x0000005c, 0x0000005b, 0x000700c9, 0x00000006,
-    0x0000005d, 0x0000005a, 0x0000005c, 0x00000034, 0x00000035, 0x00050050, 0x00000021, 0x0000005e,
-    0x00000058, 0x0000005d, 0x00060041, 0x0000002b, 0x0000005f, 0x00000027, 0x00000018, 0x00000056,
-    0x0003003e, 0x0000005f, 0x0000005e, 0x000200f9, 0x00000020, 0x000200f8, 0x00000020, 0x000100fd,
-    0x00010038,
+const uint8_t Blob062_Data[1648] =
+{
+    0x28, 0xb5, 0x2f, 0xfd, 0x60, 0x64, 0x13, 0x35, 0x33, 0x00, 0xd6, 0x7c, 0xd2, 0x4a, 0xf0, 0xce,
+    0x38, 0x63, 0x00, 0xc0, 0x03, 0xcf, 0xc0, 0x33, 0xf0, 0x9c, 0xf9, 0x0a, 0x9f, 0xc8, 0x8e, 0x61,
+    0x51, 0xd2, 0x33, 0xf0, 0x5c, 0x56, 0x8e, 0xb1, 0x64, 0xa2, 0x97, 0xdd, 0xde, 0x14, 0x4f, 0x5c,
+    0xac, 0xb5, 0xd0, 0x24, 0x57, 0x3b, 0x24, 0xe1, 0xdd, 0x47, 0xc2, 0x6e, 0x73, 0xf0, 0xbf, 0x9b,
+    0xb9, 0x80, 0xfb, 0x6a, 0x05, 0x83, 0x0c, 0x2c, 0x31, 0x62, 0xd9, 0x60, 0x83, 0xf8, 0xcc, 0x82,
+    0x45, 0xac, 0xf6, 0xbb, 0xbb, 0xbb, 0x7b, 0xa7, 0xae, 0x00, 0xb1, 0x00, 0xc1, 0x00, 0xa8, 0x0d,
+    0x28, 0x55, 0x57, 0x95, 0xce, 0x2d, 0x4f, 0x69, 0x3f, 0x7e, 0x07, 0xe5, 0xb4, 0x16, 0xbb, 0x7e,
+    0xfe, 0x9b, 0x88, 0x1f, 0x22, 0xaa, 0x4d, 0x10, 0xed, 0xb5, 0xb1, 0xe9, 0xac, 0x1f, 0xfe, 0x60,
+    0x7a, 0x71, 0xce, 0x17, 0xc2, 0x6d, 0xad, 0x76, 0x83, 0xe2, 0xcd, 0xaa, 0xe7, 0xff, 0x6f, 0xad,
+    0x53, 0x5b, 0x20, 0x58, 0x75, 0x67, 0xeb, 0x9b, 0xd9, 0xab, 0xf3, 0xff, 0x25, 0x8b, 0x6b, 0x35,
+    0x1d, 0x6b, 0xa7, 0xba, 0x16, 0xe7, 0xe8, 0xcc, 0xea, 0xf8, 0xe8, 0x82, 0x69, 0x35, 0xef, 0x4b,
+    0x53, 0x7d, 0x34, 0x2c, 0xbd, 0x3d, 0x6a, 0xfa, 0x9a, 0xa5, 0xb6, 0xf2, 0xe1, 0x45, 0x54, 0x97,
+    0xd2, 0x74, 0x2e, 0x8f, 0x7d, 0xf2, 0xa6, 0x61, 0x36, 0xa3, 0x33, 0xac, 0x73, 0x3a, 0xc3, 0x29,
+    0xd0, 0x6e, 0x67, 0xeb, 0x4a, 0x9b, 0xcd, 0xc4, 0x5e, 0x37, 0x37, 0xaf, 0x99, 0xe8, 0xa1, 0x8a,
+    0x0f, 0x34, 0xfd, 0x21, 0x29, 0xf4, 0xff, 0x3a, 0x5f, 0xdc, 0xff, 0x50, 0x04, 0xf0, 0xff, 0xe0,
+    0x37, 0xfe, 0x1f, 0xe5, 0x20, 0xc5, 0x82, 0xee, 0x96, 0x25, 0x76, 0xc6, 0x5e, 0xe3, 0xef, 0xfd,
+    0x7b, 0x80, 0x93, 0x78, 0xf9, 0xd1, 0x3d, 0xf0, 0xa4, 0xc9, 0x07, 0x06, 0xad, 0x0e, 0x27, 0xb7,
+    0x7e, 0xbd, 0xb8, 0x9d, 0x59, 0xa3, 0xf2, 0xa2, 0xef, 0x5a, 0xbe, 0x9d, 0x21, 0x9b, 0x4a, 0x53,
+    0x92, 0xb7, 0xbd, 0x62, 0xd7, 0xc8, 0xaa, 0xa9, 0xda, 0x62, 0x2f, 0x4e, 0x5b, 0xff, 0x71, 0xda,
+    0x73, 0x65, 0x5a, 0x55, 0x65, 0xe1, 0xbf, 0x75, 0x6b, 0x6d, 0xb3, 0x0b, 0xac, 0xe1, 0x9c, 0x7b,
+    0x5b, 0x53, 0xf3, 0xbb, 0xf7, 0xe3, 0x74, 0x15, 0x34, 0x8e, 0x55, 0x6b, 0x59, 0x5f, 0xb8, 0x1b,
+    0xeb, 0xf6, 0x76, 0xac, 0x73, 0x8c, 0xc5, 0x38, 0x36, 0x8c, 0x66, 0x76, 0x9f, 0x3d, 0x18, 0x77,
+    0x59, 0x7c, 0xf2, 0x66, 0xcb, 0xb8, 0xe6, 0xde, 0x36, 0x9a, 0x77, 0x34, 0xc6, 0x2c, 0xed, 0xf4,
+    0xb0, 0xd9, 0xbb, 0xcf, 0xf3, 0xe7, 0x5b, 0x9c, 0x66, 0x99, 0x85, 0x1d, 0x46, 0x35, 0xac, 0x85,
+    0xb5, 0xda, 0x8f, 0x37, 0xff, 0x83, 0xb3, 0x0e, 0xed, 0x8a, 0x46, 0x0c, 0x74, 0x63, 0x98, 0xd5,
+    0xed, 0x1d, 0x96, 0x85, 0xc8, 0xb3, 0x7b, 0x9b, 0xe5, 0xc9, 0x91, 0x47, 0xfc, 0xee, 0x86, 0xd7,
+    0xd9, 0x06, 0x03, 0xb8, 0x55, 0xd6, 0xf7, 0xaf, 0xaa, 0x8c, 0xc7, 0x13, 0x3f, 0xfe, 0xfa, 0xae,
+    0x27, 0x86, 0xdd, 0xb2, 0x99, 0x26, 0x06, 0x27, 0xe6, 0xa1, 0xcf, 0xea, 0xbb, 0xbf, 0x83, 0x51,
+    0x6a, 0x5c, 0xe0, 0xa1, 0x4a, 0x2c, 0x27, 0x95, 0x8c, 0x94, 0x17, 0x14, 0x03, 0x27, 0x24, 0x27,
+    0xa7, 0x92, 0xef, 0x34, 0xf2, 0x6f, 0x1c, 0x10, 0x32, 0x1e, 0xc4, 0x54, 0xf2, 0xf8, 0x78, 0xc9,
+    0xf0, 0xe0, 0x10, 0xf0, 0x8e, 0x93, 0x27, 0x39, 0xf8, 0x11, 0x91, 0x0d, 0x91, 0x03, 0x08, 0x37,
+    0xc6, 0x91, 0x49, 0xa4, 0x12, 0x7a, 0xf1, 0x42, 0x90, 0x2c, 0x99, 0x46, 0x0f, 0xf0, 0xe0, 0xc7,
+    0x11, 0x32, 0x22, 0xf7, 0xe7, 0x72, 0xb9, 0x5c, 0x2e, 0x97, 0xcb, 0x7d, 0x5d, 0xf5, 0xbf, 0x91,
+    0x4b, 0x46, 0x82, 0x2a, 0xa5, 0xff, 0xa1, 0xb4, 0xd6, 0x5a, 0xff, 0x7a, 0x4c, 0xef, 0x3d, 0x78,
+    0x16, 0xbc, 0x56, 0xcb, 0x34, 0xcd, 0x87, 0x2b, 0x32, 0x07, 0x44, 0x27, 0x21, 0x53, 0x29, 0x42,
+    0x82, 0x8c, 0x1d, 0x22, 0x29, 0xcc, 0x00, 0xcb, 0x2f, 0xf4, 0x1e, 0x13, 0x4a, 0x49, 0x41, 0xf9,
+    0x51, 0xca, 0x93, 0xf2, 0xf4, 0x92, 0x8f, 0x0f, 0xfc, 0x8b, 0x14, 0xa6, 0x00, 0x4f, 0x7c, 0x41,
+    0xde, 0x2f, 0xbe, 0x86, 0x43, 0x40, 0x18, 0x80, 0x44, 0xfa, 0x45, 0x42, 0x0f, 0xff, 0x6a, 0x43,
+    0xbc, 0xfc, 0xa1, 0xad, 0xed, 0xd1, 0xbb, 0xce, 0x48, 0x91, 0x67, 0xfc, 0x7a, 0x5b, 0x2d, 0x4c,
+    0x24, 0x65, 0xe1, 0xcf, 0xf5, 0xb2, 0xe0, 0x77, 0x8f, 0xd5, 0xfd, 0xbb, 0x75, 0x0b, 0xf7, 0xae,
+    0xba, 0xf7, 0x18, 0xa6, 0xef, 0x2f, 0x66, 0x3a, 0x33, 0x0e, 0x1d, 0x4e, 0x38, 0x1b, 0x38, 0x90,
+    0x5f, 0xb1, 0x41, 0x43, 0x06, 0x14, 0x0f, 0x06, 0xd1, 0xce, 0xa9, 0x73, 0x61, 0x84, 0xc9, 0x60,
+    0x37, 0x38, 0x2d, 0x37, 0xab, 0x0a, 0x36, 0x13, 0x62, 0xe3, 0x8a, 0xc2, 0xea, 0x55, 0x33, 0xd3,
+    0x7a, 0xd1, 0xa8, 0x5c, 0x2b, 0xd5, 0x8b, 0x84, 0x14, 0xc8, 0x4b, 0x04, 0x08, 0x2d, 0x2e, 0x0f,
+    0x46, 0xa4, 0x5c, 0x58, 0x34, 0x40, 0x31, 0x58, 0xa0, 0xc0, 0x04, 0x46, 0xc1, 0x29, 0x41, 0xca,
+    0x8a, 0x8a, 0x29, 0x4a, 0x30, 0x06, 0x21, 0x38, 0x50, 0xc0, 0x54, 0x80, 0x04, 0xc6, 0xc1, 0xb7,
+    0xd0, 0x20, 0x19, 0x41, 0x21, 0x12, 0x02, 0x42, 0x60, 0x80, 0xa9, 0xb1, 0x0a, 0x8d, 0x4c, 0xd8,
+    0x4a, 0xd5, 0xc2, 0x62, 0x52, 0x22, 0xba, 0xf8, 0x77, 0xf1, 0x2e, 0xa8, 0x11, 0xe4, 0x8a, 0x88,
+    0x9f, 0x10, 0xe8, 0x0e, 0x68, 0x07, 0xf2, 0x93, 0x75, 0x3e, 0x37, 0x9b, 0x2e, 0xe8, 0xbb, 0x65,
+    0x73, 0x21, 0x36, 0x77, 0xd1, 0xaa, 0x6a, 0x15, 0x97, 0x8e, 0x9a, 0xe4, 0xc3, 0x95, 0x36, 0xd2,
+    0x12, 0x10, 0x1f, 0xbe, 0x7c, 0x6f, 0x35, 0x13, 0x36, 0x52, 0xed, 0x96, 0xc0, 0x32, 0x68, 0x10,
+    0xad, 0xec, 0x49, 0x71, 0x3d, 0x0f, 0x39, 0xa2, 0xf3, 0xa2, 0xa0, 0x9c, 0xf1, 0xa9, 0x5b, 0x60,
+    0x30, 0xa1, 0x44, 0x43, 0xce, 0xb4, 0x58, 0x26, 0x4b, 0xc6, 0x8c, 0x91, 0x19, 0x61, 0xc6, 0x52,
+    0xcc, 0x35, 0x4c, 0x30, 0x07, 0x03, 0x82, 0x5e, 0xa8, 0xe2, 0x28, 0x93, 0x23, 0x35, 0x52, 0x90,
+    0x82, 0xa4, 0xd2, 0x1a, 0xb2, 0x6b, 0x84, 0x80, 0xd0, 0x52, 0xd9, 0x03, 0xf2, 0x29, 0x16, 0x62,
+    0x4d, 0xa2, 0x50, 0x05, 0x2d, 0x28, 0x30, 0x0d, 0xbb, 0x01, 0x00, 0x10, 0xe3, 0xfc, 0x07, 0xdf,
+    0x8b, 0x92, 0x3b, 0x76, 0x27, 0xf1, 0x50, 0x9b, 0x7f, 0xed, 0x44, 0x0b, 0x28, 0x0d, 0x61, 0x8b,
+    0x45, 0xb7, 0x82, 0x27, 0x34, 0x34, 0x82, 0xa7, 0xb7, 0xa2, 0x5f, 0xdb, 0x6d, 0xb3, 0xe9, 0x05,
+    0xe9, 0x39, 0xf6, 0x76, 0xf0, 0x5d, 0x37, 0xa7, 0x8c, 0x7d, 0xf4, 0xfc, 0x2c, 0xe0, 0xbc, 0x45,
+    0x0f, 0xb8, 0xed, 0x83, 0x90, 0xbf, 0x59, 0x8b, 0x91, 0x3d, 0x3d, 0xee, 0x01, 0x4d, 0xae, 0x7d,
+    0x9a, 0xcf, 0x8f, 0x23, 0x47, 0x8a, 0x77, 0x80, 0x8f, 0x0f, 0x71, 0x83, 0xfa, 0xb5, 0xce, 0x7d,
+    0xd6, 0x7f, 0x7b, 0x2b, 0xde, 0xd2, 0x37, 0x6f, 0x66, 0x07, 0xf4, 0xf9, 0x7f, 0x53, 0x5e, 0xa9,
+    0x06, 0x1d, 0xed, 0x81, 0xbb, 0xe2, 0x2c, 0xa6, 0x6d, 0x01, 0x09, 0xba, 0xf2, 0xa0, 0x5e, 0x10,
+    0x74, 0x9a, 0x8f, 0x90, 0x87, 0xb8, 0xdc, 0x3b, 0x9a, 0x61, 0xbb, 0xcb, 0xaf, 0x14, 0xce, 0xd1,
+    0x5e, 0x12, 0xb2, 0x98, 0xa1, 0x47, 0x0f, 0xf6, 0xf4, 0x53, 0xa8, 0x3b, 0x29, 0xab, 0x17, 0x5a,
+    0xe4, 0x1b, 0xed, 0xcb, 0x63, 0x90, 0xce, 0x49, 0x4b, 0x47, 0xfd, 0x40, 0x24, 0xfc, 0x4b, 0x5f,
+    0xe3, 0x07, 0xb9, 0x1a, 0x61, 0xab, 0x7e, 0x26, 0xdd, 0x16, 0x72, 0xbb, 0xb1, 0x34, 0x9d, 0x9a,
+    0x23, 0xe3, 0xbe, 0x5d, 0x24, 0xd6, 0x59, 0x95, 0xa1, 0xdd, 0xac, 0x78, 0x1c, 0x87, 0xce, 0xf5,
+    0xce, 0xea, 0xe1, 0x94, 0xeb, 0x32, 0x47, 0x97, 0xf3, 0x70, 0x78, 0x06, 0x9c, 0x4f, 0x57, 0x0e,
+    0x27, 0x47, 0x18, 0x8c, 0x5a, 0x1b, 0xdf, 0x96, 0xad, 0x6d, 0xdb, 0x6c, 0xaa, 0x15, 0xa0, 0x1d,
+    0xc6, 0x31, 0x03, 0xc4, 0x98, 0x70, 0x68, 0x04, 0x24, 0xbc, 0xbb, 0xcd, 0x0d, 0xe0, 0x70, 0xa3,
+    0x91, 0xd6, 0x8e, 0xf7, 0x1c, 0x31, 0xd2, 0xb0, 0xbf, 0x61, 0xb7, 0xdb, 0x61, 0xd6, 0x7a, 0x49,
+    0xf9, 0xa6, 0x95, 0xec, 0x42, 0x7c, 0x70, 0x33, 0x3d, 0xc6, 0xda, 0x7a, 0xe4, 0x6c, 0x0f, 0x59,
+    0x87, 0xce, 0xd0, 0x3c, 0xa5, 0xeb, 0x3c, 0x90, 0xd6, 0xd7, 0x99, 0xf7, 0x82, 0xbc, 0x5a, 0x65,
+    0xdc, 0xba, 0xfa, 0x9f, 0xba, 0x40, 0x78, 0x6b, 0xca, 0xe5, 0x20, 0x76, 0xd2, 0xdc, 0x87, 0xd4,
+    0x2e, 0x3c, 0xb4, 0x7c, 0xb8, 0x65, 0xbd, 0x11, 0x7f, 0xb8, 0xdc, 0x91, 0x33, 0x8a, 0xbc, 0x6e,
+    0xa1, 0x0e, 0x63, 0xa9, 0x93, 0xf8, 0x84, 0x6f, 0xd4, 0x0c, 0x7e, 0xd0, 0x80, 0x91, 0x7f, 0xdb,
+    0xed, 0xab, 0xce, 0x3c, 0xfb, 0x2a, 0x9c, 0xe0, 0x38, 0x77, 0xbd, 0xe5, 0x5d, 0x7b, 0x92, 0x7e,
+    0x7d, 0xb7, 0x29, 0x5d, 0xd8, 0x49, 0x2d, 0xf4, 0x31, 0x76, 0x81, 0xd4, 0x56, 0xf9, 0xe5, 0x62,
+    0x9e, 0xb4, 0x31, 0xd4, 0x9e, 0x4c, 0x60, 0x95, 0x68, 0x9f, 0x18, 0x1d, 0x09, 0xb4, 0x70, 0xba,
+    0xbf, 0x98, 0xb6, 0x1b, 0xbb, 0x96, 0xc1, 0x1c, 0xa6, 0xae, 0xb1, 0x18, 0x8d, 0xfc, 0xcf, 0x90,
+    0x66, 0xbe, 0xea, 0x7b, 0xbe, 0x6f, 0x67, 0x69, 0xec, 0x2d, 0x75, 0x68, 0x69, 0xf1, 0x2a, 0x51,
+    0x6f, 0xf0, 0x83, 0xd1, 0x41, 0x55, 0x4f, 0xa4, 0x4c, 0x19, 0xcd, 0xe9, 0xd0, 0x05, 0x07, 0xa0,
+    0x26, 0xd1, 0x19, 0xfc, 0x39, 0xdf, 0x7c, 0x2b, 0x2e, 0xa5, 0xc1, 0xfb, 0x02, 0xe2, 0xb4, 0x47,
+    0x8b, 0x9e, 0x9e, 0xef, 0xa7, 0x6a, 0x67, 0xce, 0x3d, 0x59, 0xca, 0xfe, 0x30, 0xfe, 0x2b, 0x1c,
+    0x8d, 0x73, 0xd3, 0x5e, 0x75, 0xca, 0xb5, 0x2c, 0x29, 0x0d, 0x58, 0x8a, 0xb2, 0xfb, 0xbc, 0x50,
+    0x86, 0x40, 0x2e, 0x5e, 0x97, 0x31, 0x70, 0xbe, 0x8c, 0x04, 0x7e, 0xd5, 0xea, 0xb0, 0x66, 0xe7,
+    0xd7, 0x29, 0x93, 0x03, 0xa7, 0x99, 0x9c, 0x07, 0x9a, 0x2c, 0x64, 0x66, 0x20, 0x85, 0x65, 0x05,
+    0xfd, 0x75, 0x77, 0xc0, 0xdc, 0x13, 0xd7, 0xd1, 0x42, 0xf6, 0x72, 0xa5, 0x2a, 0xf7, 0x2e, 0xdc,
+    0x91, 0x90, 0xea, 0xbb, 0x20, 0x90, 0x77, 0xcd, 0xb3, 0x63, 0x0b, 0x6f, 0x01, 0xa1, 0x84, 0x2d,
+    0xca, 0x0f, 0xdf, 0x2c, 0xe0, 0xfb, 0x0e, 0xab, 0x50, 0x6c, 0xdf, 0x17, 0xec, 0xfb, 0x73, 0x42,
+    0xee, 0x41, 0x7a, 0x91, 0x6c, 0x4e, 0xf7, 0xda, 0x8e, 0x1d, 0xe5, 0x09, 0x4e, 0x1e, 0x10, 0xf3,
+    0x9a, 0xb2, 0x59, 0xee, 0xf7, 0x01, 0xe1, 0xce, 0x85, 0x9d, 0xcc, 0x93, 0x8b, 0x8f, 0xec, 0x78,
+    0xb4, 0xc6, 0x11, 0x9a, 0xac, 0x44, 0x5f, 0x92, 0x4c, 0xcc, 0xb7, 0xc8, 0x7e, 0x2f, 0x4f, 0x7b,
+    0xd2, 0x37, 0x0a, 0x7a, 0xe8, 0xfe, 0xe1, 0xd3, 0x0f, 0x9a, 0x98, 0xbe, 0xb9, 0x1a, 0x97, 0xf9,
+    0x11, 0x98, 0x61, 0x20, 0xae, 0x72, 0x4e, 0xfd, 0xc5, 0xaa, 0xcc, 0x8d, 0x22, 0x0a, 0x91, 0xfb,
+    0x16, 0xfc, 0x49, 0xc0, 0x2c, 0xb4, 0xea, 0xd6, 0xff, 0xba, 0x79, 0x0b, 0xb7, 0xfb, 0xfd, 0xf4,
+    0x77, 0xe9, 0x5a, 0x7d, 0xfd, 0xd6, 0xb3, 0xb5, 0xa8, 0xc8, 0xef, 0x31, 0x25, 0x3f, 0xcf, 0x1d,
+    0x24, 0x0e, 0x67, 0xd8, 0x8c, 0x41, 0x78, 0xfc, 0x94, 0xb4, 0x52, 0x07, 0x52, 0x9d, 0x75, 0xb2,
+    0xa3, 0xdb, 0x35, 0xe8, 0x4c, 0x24, 0x5d, 0xc6, 0xec, 0xe0, 0xdd, 0x81, 0xe0, 0xe3, 0xec, 0x51,
+    0x1c, 0x2c, 0x37, 0x78, 0xd8, 0x02, 0x9e, 0x64, 0x1a, 0x79, 0x0f, 0xc4, 0xa1, 0x3d, 0x27, 0x0f,
+    0xba, 0x5d, 0x25, 0xf1, 0xa5, 0xe0, 0xfc, 0xfe, 0xc6, 0x70, 0x02, 0x1f, 0x93, 0x9a, 0x3d, 0xc2,
+    0xf3, 0xdc, 0x24, 0xfa, 0x79, 0x72, 0xca, 0xb7, 0xbc, 0x55, 0xcf, 0x21, 0x85, 0x17, 0x53, 0x38,
 };
+const ShaderModule Blob062 = { Blob062_Data, 1648u, 1305u, 62u };
 
-extern const uint32_t Blob100[1309];
-const uint32_t Blob100[1309] = {
-    0x07230203, 0x00010300, 0x0008000b, 0x0000007e, 0x00000000, 0x00020011, 0x00000001, 0x0006000b,
-    0x00000001, 0x4c534c47, 0x6474732e, 0x3035342e, 0x00000000, 0x0003000e, 0x00000000, 0x00000001,
-    0x0006000f, 0x00000005, 0x00000004, 0x6e69616d, 0x00000000, 0x00000009, 0x00060010, 0x00000004,
-    0x00000011, 0x00000020, 0x00000001, 0x00000001, 0x00030003, 0x00000002, 0x000001c2, 0x000a0004,
-    0x475f4c47, 0x4c474f4f, 0x70635f45, 0x74735f70, 0x5f656c79, 0x656e696c, 0x7269645f, 0x69746365,
-    0x00006576, 0x00080004, 0x475f4c47, 0x4c474f4f, 0x6e695f45, 0x64756c63, 0x69645f65, 0x74636572,
-    0x00657669, 0x00040005, 0x00000004, 0x6e69616d, 0x00000000, 0x00080005, 0x00000009, 0x475f6c67,
-    0x61626f6c, 0x766e496c, 0x7461636f, 0x496e6f69, 0x00000044, 0x00060005, 0x00000014, 0x526e6942,
-    0x6c757365, 0x66754274, 0x00726566, 0x00080006, 0x00000014, 0x00000000, 0x69726156, 0x57746e61,
-    0x436b726f, 0x746e756f, 0x00000000, 0x00080006, 0x00000014, 0x00000001, 0x74726f53, 0x6f576465,
-    0x664f6b72, 0x74657366, 0x00000000, 0x00090006, 0x00000014, 0x00000002, 0x69726156, 0x57746e61,
-    0x526b726f, 0x436c6165, 0x746e756f, 0x00000000, 0x00080006, 0x00000014, 0x00000003, 0x74726f53,
-    0x6b726f57, 0x6b726f57, 0x6e756f43, 0x00000074, 0x00090006, 0x00000014, 0x00000004, 0x6e6e6942,
-    0x4d676e69, 0x416b7361, 0x664f646e, 0x74657366, 0x00000000, 0x00030005, 0x00000016, 0x00000000,
-    0x00050005, 0x00000023, 0x6b726f77, 0x63736544, 0x00000000, 0x00060005, 0x00000025, 0x6b726f57,
-    0x63736544, 0x66667542, 0x00007265, 0x00060006, 0x00000025, 0x00000000, 0x6b726f57, 0x63736544,
-    0x00000073, 0x00030005, 0x00000027, 0x00000000, 0x00060005, 0x0000002f, 0x61566e69, 0x6e616972,
-    0x66664f74, 0x00746573, 0x00050005, 0x00000038, 0x796c6f70, 0x496e6f67, 0x00007864, 0x00050005,
-    0x0000003d, 0x69726176, 0x49746e61, 0x00007864, 0x00040005, 0x0000003f, 0x796c6f50, 0x006e6f67,
-    0x00060006, 0x0000003f, 0x00000000, 0x73726946, 0x70535874, 0x00006e61, 0x00050006, 0x0000003f,
-    0x00000001, 0x706f5459, 0x00000000, 0x00050006, 0x0000003f, 0x00000002, 0x746f4259, 0x00000000,
-    0x00050006, 0x0000003f, 0x00000003, 0x6e694d58, 0x00000000, 0x00050006, 0x0000003f, 0x00000004,
-    0x78614d58, 0x00000000, 0x00050006, 0x0000003f, 0x00000005, 0x6e694d58, 0x00000059, 0x00050006,
-    0x0000003f, 0x00000006, 0x78614d58, 0x00000059, 0x00050006, 0x0000003f, 0x00000007, 0x69726156,
-    0x00746e61, 0x00050006, 0x0000003f, 0x00000008, 0x72747441, 0x00000000, 0x00070006, 0x0000003f,
-    0x00000009, 0x74786554, 0x4c657275, 0x72657961, 0x00000000, 0x00060006, 0x0000003f, 0x0000000a,
-    0x69636146, 0x6956676e, 0x00007765, 0x00060005, 0x00000041, 0x796c6f50, 0x426e6f67, 0x65666675,
-    0x00000072, 0x00060006, 0x00000041, 0x00000000, 0x796c6f50, 0x736e6f67, 0x00000000, 0x00030005,
-    0x00000043, 0x00000000, 0x00050005, 0x00000049, 0x74726f73, 0x6e496465, 0x00786564, 0x00060005,
-    0x00000051, 0x5778614d, 0x546b726f, 0x73656c69, 0x00000000, 0x00080005, 0x00000053, 0x6b726f57,
-    0x63736544, 0x726f5373, 0x53646574, 0x74726174, 0x00000000, 0x00050005, 0x00000060, 0x65726353,
-    0x69576e65, 0x00687464, 0x00060005, 0x00000061, 0x65726353, 0x65486e65, 0x74686769, 0x00000000,
-    0x00070005, 0x00000065, 0x6d617246, 0x66756265, 0x53726566, 0x64697274, 0x00000065, 0x00060005,
-    0x00000067, 0x656c6954, 0x72655073, 0x656e694c, 0x00000000, 0x00050005, 0x00000068, 0x656c6954,
-    0x656e694c, 0x00000073, 0x00050005, 0x0000006f, 0x6174654d, 0x66696e55, 0x006d726f, 0x00060006,
-    0x0000006f, 0x00000000, 0x506d754e, 0x67796c6f, 0x00736e6f, 0x00060006, 0x0000006f, 0x00000001,
-    0x566d754e, 0x61697261, 0x0073746e, 0x00060006, 0x0000006f, 0x00000002, 0x68706c41, 0x66655261,
-    0x00000000, 0x00050006, 0x0000006f, 0x00000003, 0x70736944, 0x00746e43, 0x00060006, 0x0000006f,
-    0x00000004, 0x6e6f6f54, 0x6c626154, 0x00000065, 0x00060006, 0x0000006f, 0x00000005, 0x61656c43,
-    0x6c6f4372, 0x0000726f, 0x00060006, 0x0000006f, 0x00000006, 0x61656c43, 0x70654472, 0x00006874,
-    0x00060006, 0x0000006f, 0x00000007, 0x61656c43, 0x74744172, 0x00000072, 0x00060006, 0x0000006f,
-    0x00000008, 0x4f676f46, 0x65736666, 0x00000074, 0x00060006, 0x0000006f, 0x00000009, 0x53676f46,
-    0x74666968, 0x00000000, 0x00060006, 0x0000006f, 0x0000000a, 0x43676f46, 0x726f6c6f, 0x00000000,
-    0x00080006, 0x0000006f, 0x0000000b, 0x61656c43, 0x74694272, 0x4f70616d, 0x65736666, 0x00000074,
-    0x00030005, 0x00000071, 0x00000000, 0x00060005, 0x00000072, 0x68737550, 0x736e6f43, 0x746e6174,
-    0x00000073, 0x00060006, 0x00000072, 0x00000000, 0x56727543, 0x61697261, 0x0000746e, 0x00060006,
-    0x00000072, 0x00000001, 0x57786554, 0x68746469, 0x00000000, 0x00060006, 0x00000072, 0x00000002,
-    0x48786554, 0x68676965, 0x00000074, 0x00060006, 0x00000072, 0x00000003, 0x57786554, 0x53706172,
-    0x00000000, 0x00060006, 0x00000072, 0x00000004, 0x57786554, 0x54706172, 0x00000000, 0x00070006,
-    0x00000072, 0x00000005, 0x49786554, 0x70614373, 0x65727574, 0x00000000, 0x00070006, 0x00000072,
-    0x00000006, 0x74706143, 0x59657275, 0x7366664f, 0x00007465, 0x00050006, 0x00000072, 0x00000007,
-    0x6461705f, 0x00000000, 0x00030005, 0x00000074, 0x00006370, 0x00070005, 0x00000078, 0x6e6e6942,
-    0x4d676e69, 0x536b7361, 0x74726174, 0x00000000, 0x00080005, 0x0000007b, 0x6e6e6942, 0x57676e69,
-    0x4f6b726f, 0x65736666, 0x74537374, 0x00747261, 0x00040047, 0x00000009, 0x0000000b, 0x0000001c,
-    0x00040047, 0x00000010, 0x00000006, 0x00000010, 0x00040047, 0x00000011, 0x00000006, 0x00000004,
-    0x00040047, 0x00000012, 0x00000006, 0x00000004, 0x00040047, 0x00000013, 0x00000006, 0x00000004,
-    0x00050048, 0x00000014, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000014, 0x00000001,
-    0x00000023, 0x00008000, 0x00050048, 0x00000014, 0x00000002, 0x00000023, 0x0000a000, 0x00050048,
-    0x00000014, 0x00000003, 0x00000023, 0x0000c000, 0x00050048, 0x00000014, 0x00000004, 0x00000023,
-    0x0000c010, 0x00030047, 0x00000014, 0x00000002, 0x00040047, 0x00000016, 0x00000022, 0x00000000,
-    0x00040047, 0x00000016, 0x00000021, 0x00000008, 0x00040047, 0x00000024, 0x00000006, 0x00000008,
-    0x00050048, 0x00000025, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000025, 0x00000002,
-    0x00040047, 0x00000027, 0x00000022, 0x00000000, 0x00040047, 0x00000027, 0x00000021, 0x00000009,
-    0x00050048, 0x0000003f, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x0000003f, 0x00000001,
-    0x00000023, 0x00000004, 0x00050048, 0x0000003f, 0x00000002, 0x00000023, 0x00000008, 0x00050048,
-    0x0000003f, 0x00000003, 0x00000023, 0x0000000c, 0x00050048, 0x0000003f, 0x00000004, 0x00000023,
-    0x00000010, 0x00050048, 0x0000003f, 0x00000005, 0x00000023, 0x00000014, 0x00050048, 0x0000003f,
-    0x00000006, 0x00000023, 0x00000018, 0x00050048, 0x0000003f, 0x00000007, 0x00000023, 0x0000001c,
-    0x00050048, 0x0000003f, 0x00000008, 0x00000023, 0x00000020, 0x00050048, 0x0000003f, 0x00000009,
-    0x00000023, 0x00000024, 0x00050048, 0x0000003f, 0x0000000a, 0x00000023, 0x00000028, 0x00040047,
-    0x00000040, 0x00000006, 0x0000002c, 0x00040048, 0x00000041, 0x00000000, 0x00000018, 0x00050048,
-    0x00000041, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000041, 0x00000002, 0x00040047,
-    0x00000043, 0x00000022, 0x00000000, 0x00040047, 0x00000043, 0x00000021, 0x00000001, 0x00040047,
-    0x00000051, 0x00000001, 0x00000002, 0x00040047, 0x00000060, 0x00000001, 0x00000000, 0x00040047,
-    0x00000061, 0x00000001, 0x00000001, 0x00040047, 0x0000006d, 0x00000006, 0x00000010, 0x00050048,
-    0x0000006f, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x0000006f, 0x00000001, 0x00000023,
-    0x00000004, 0x00050048, 0x0000006f, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x0000006f,
-    0x00000003, 0x00000023, 0x0000000c, 0x00050048, 0x0000006f, 0x00000004, 0x00000023, 0x00000010,
-    0x00050048, 0x0000006f, 0x00000005, 0x00000023, 0x00000230, 0x00050048, 0x0000006f, 0x00000006,
-    0x00000023, 0x00000234, 0x00050048, 0x0000006f, 0x00000007, 0x00000023, 0x00000238, 0x00050048,
-    0x0000006f, 0x00000008, 0x00000023, 0x0000023c, 0x00050048, 0x0000006f, 0x00000009, 0x00000023,
-    0x00000240, 0x00050048, 0x0000006f, 0x0000000a, 0x00000023, 0x00000244, 0x00050048, 0x0000006f,
-    0x0000000b, 0x00000023, 0x00000248, 0x00030047, 0x0000006f, 0x00000002, 0x00040047, 0x00000071,
-    0x00000022, 0x00000000, 0x00040047, 0x00000071, 0x00000021, 0x00000000, 0x00050048, 0x00000072,
-    0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000072, 0x00000001, 0x00000023, 0x00000004,
-    0x00050048, 0x00000072, 0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x00000072, 0x00000003,
-    0x00000023, 0x0000000c, 0x00050048, 0x00000072, 0x00000004, 0x00000023, 0x00000010, 0x00050048,
-    0x00000072, 0x00000005, 0x00000023, 0x00000014, 0x00050048, 0x00000072, 0x00000006, 0x00000023,
-    0x00000018, 0x00050048, 0x00000072, 0x00000007, 0x00000023, 0x0000001c, 0x00030047, 0x00000072,
-    0x00000002, 0x00040047, 0x0000007d, 0x0000000b, 0x00000019, 0x00020013, 0x00000002, 0x00030021,
-    0x00000003, 0x00000002, 0x00040015, 0x00000006, 0x00000020, 0x00000000, 0x00040017, 0x00000007,
-    0x00000006, 0x00000003, 0x00040020, 0x00000008, 0x00000001, 0x00000007, 0x0004003b, 0x00000008,
-    0x00000009, 0x00000001, 0x0004002b, 0x00000006, 0x0000000a, 0x00000000, 0x00040020, 0x0000000b,
-    0x00000001, 0x00000006, 0x00040017, 0x0000000e, 0x00000006, 0x00000004, 0x0004002b, 0x00000006,
-    0x0000000f, 0x00000800, 0x0004001c, 0x00000010, 0x0000000e, 0x0000000f, 0x0004001c, 0x00000011,
-    0x00000006, 0x0000000f, 0x0004001c, 0x00000012, 0x00000006, 0x0000000f, 0x0003001d, 0x00000013,
-    0x00000006, 0x0007001e, 0x00000014, 0x00000010, 0x00000011, 0x00000012, 0x0000000e, 0x00000013,
-    0x00040020, 0x00000015, 0x0000000c, 0x00000014, 0x0004003b, 0x00000015, 0x00000016, 0x0000000c,
-    0x00040015, 0x00000017, 0x00000020, 0x00000001, 0x0004002b, 0x00000017, 0x00000018, 0x00000000,
-    0x0004002b, 0x00000006, 0x00000019, 0x00000003, 0x00040020, 0x0000001a, 0x0000000c, 0x00000006,
-    0x00020014, 0x0000001d, 0x00040017, 0x00000021, 0x00000006, 0x00000002, 0x00040020, 0x00000022,
-    0x00000007, 0x00000021, 0x0003001d, 0x00000024, 0x00000021, 0x0003001e, 0x00000025, 0x00000024,
-    0x00040020, 0x00000026, 0x0000000c, 0x00000025, 0x0004003b, 0x00000026, 0x00000027, 0x0000000c,
-    0x00040020, 0x0000002b, 0x0000000c, 0x00000021, 0x00040020, 0x0000002e, 0x00000007, 0x00000017,
-    0x0004002b, 0x00000006, 0x00000030, 0x00000001, 0x00040020, 0x00000031, 0x00000007, 0x00000006,
-    0x0004002b, 0x00000017, 0x00000034, 0x0000000b, 0x0004002b, 0x00000017, 0x00000035, 0x00000015,
-    0x00030016, 0x0000003e, 0x00000020, 0x000d001e, 0x0000003f, 0x00000017, 0x00000017, 0x00000017,
-    0x00000017, 0x00000017, 0x00000017, 0x00000017, 0x00000017, 0x00000006, 0x0000003e, 0x00000006,
-    0x0003001d, 0x00000040, 0x0000003f, 0x0003001e, 0x00000041, 0x00000040, 0x00040020, 0x00000042,
-    0x0000000c, 0x00000041, 0x0004003b, 0x00000042, 0x00000043, 0x0000000c, 0x0004002b, 0x00000017,
-    0x00000045, 0x00000007, 0x00040020, 0x00000046, 0x0000000c, 0x00000017, 0x0004002b, 0x00000017,
-    0x0000004a, 0x00000001, 0x00040032, 0x00000017, 0x00000051, 0x00003000, 0x00060034, 0x00000006,
-    0x00000052, 0x00000080, 0x00000051, 0x0000000a, 0x00060034, 0x00000006, 0x00000053, 0x00000080,
-    0x0000000a, 0x00000052, 0x00040032, 0x00000017, 0x00000060, 0x00000100, 0x00040032, 0x00000017,
-    0x00000061, 0x000000c0, 0x0004002b, 0x00000017, 0x00000062, 0x00000008, 0x0004002b, 0x00000017,
-    0x00000063, 0x00000100, 0x0004002b, 0x00000017, 0x00000064, 0x000000c0, 0x00060034, 0x00000017,
-    0x00000065, 0x00000084, 0x00000060, 0x00000061, 0x0004002b, 0x00000017, 0x00000066, 0x00000020,
-    0x00060034, 0x00000017, 0x00000067, 0x00000087, 0x00000060, 0x00000066, 0x00060034, 0x00000017,
-    0x00000068, 0x00000087, 0x00000061, 0x00000066, 0x0004002b, 0x00000017, 0x00000069, 0x00000040,
-    0x0004002b, 0x00000017, 0x0000006a, 0x00000002, 0x0004002b, 0x00000017, 0x0000006b, 0x00000800,
-    0x0004002b, 0x00000006, 0x0000006c, 0x00000022, 0x0004001c, 0x0000006d, 0x0000000e, 0x0000006c,
-    0x00040017, 0x0000006e, 0x0000003e, 0x00000002, 0x000e001e, 0x0000006f, 0x00000006, 0x00000006,
-    0x00000017, 0x00000006, 0x0000006d, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x0000006e, 0x00040020, 0x00000070, 0x00000002, 0x0000006f, 0x0004003b, 0x00000070,
-    0x00000071, 0x00000002, 0x000a001e, 0x00000072, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
-    0x00000006, 0x00000006, 0x00000017, 0x00000006, 0x00040020, 0x00000073, 0x00000009, 0x00000072,
-    0x0004003b, 0x00000073, 0x00000074, 0x00000009, 0x0004002b, 0x00000006, 0x00000075, 0x00008000,
-    0x00060034, 0x00000017, 0x00000076, 0x00000084, 0x00000067, 0x00000068, 0x00060034, 0x00000017,
-    0x00000077, 0x00000084, 0x00000076, 0x0000006a, 0x00060034, 0x00000017, 0x00000078, 0x00000080,
-    0x00000018, 0x00000077, 0x00060034, 0x00000017, 0x00000079, 0x00000084, 0x00000067, 0x00000068,
-    0x00060034, 0x00000017, 0x0000007a, 0x00000084, 0x00000079, 0x00000069, 0x00060034, 0x00000017,
-    0x0000007b, 0x00000080, 0x00000078, 0x0000007a, 0x0004002b, 0x00000006, 0x0000007c, 0x00000020,
-    0x0006002c, 0x00000007, 0x0000007d, 0x0000007c, 0x00000030, 0x00000030, 0x00050036, 0x00000002,
-    0x00000004, 0x00000000, 0x00000003, 0x000200f8, 0x00000005, 0x0004003b, 0x00000022, 0x00000023,
-    0x00000007, 0x0004003b, 0x0000002e, 0x0000002f, 0x00000007, 0x0004003b, 0x0000002e, 0x00000038,
-    0x00000007, 0x0004003b, 0x0000002e, 0x0000003d, 0x00000007, 0x0004003b, 0x0000002e, 0x00000049,
-    0x00000007, 0x00050041, 0x0000000b, 0x0000000c, 0x00000009, 0x0000000a, 0x0004003d, 0x00000006,
-    0x0000000d, 0x0000000c, 0x00070041, 0x0000001a, 0x0000001b, 0x00000016, 0x00000018, 0x00000018,
-    0x00000019, 0x0004003d, 0x00000006, 0x0000001c, 0x0000001b, 0x000500b0, 0x0000001d, 0x0000001e,
-    0x0000000d, 0x0000001c, 0x000300f7, 0x00000020, 0x00000000, 0x000400fa, 0x0000001e, 0x0000001f,
-    0x00000020, 0x000200f8, 0x0000001f, 0x00050041, 0x0000000b, 0x00000028, 0x00000009, 0x0000000a,
-    0x0004003d, 0x00000006, 0x00000029, 0x00000028, 0x00050080, 0x00000006, 0x0000002a, 0x0000000a,
-    0x00000029, 0x00060041, 0x0000002b, 0x0000002c, 0x00000027, 0x00000018, 0x0000002a, 0x0004003d,
-    0x00000021, 0x0000002d, 0x0000002c, 0x0003003e, 0x00000023, 0x0000002d, 0x00050041, 0x00000031,
-    0x00000032, 0x00000023, 0x00000030, 0x0004003d, 0x00000006, 0x00000033, 0x00000032, 0x000600cb,
-    0x00000006, 0x00000036, 0x00000033, 0x00000034, 0x00000035, 0x0004007c, 0x00000017, 0x00000037,
-    0x00000036, 0x0003003e, 0x0000002f, 0x00000037, 0x00050041, 0x00000031, 0x00000039, 0x00000023,
-    0x00000030, 0x0004003d, 0x00000006, 0x0000003a, 0x00000039, 0x000600cb, 0x00000006, 0x0000003b,
-    0x0000003a, 0x00000018, 0x00000034, 0x0004007c, 0x00000017, 0x0000003c, 0x0000003b, 0x0003003e,
-    0x00000038, 0x0000003c, 0x0004003d, 0x00000017, 0x00000044, 0x00000038, 0x00070041, 0x00000046,
-    0x00000047, 0x00000043, 0x00000018, 0x00000044, 0x00000045, 0x0004003d, 0x00000017, 0x00000048,
-    0x00000047, 0x0003003e, 0x0000003d, 0x00000048, 0x0004003d, 0x00000017, 0x0000004b, 0x0000003d,
-    0x00060041, 0x0000001a, 0x0000004c, 0x00000016, 0x0000004a, 0x0000004b, 0x0004003d, 0x00000006,
-    0x0000004d, 0x0000004c, 0x0004007c, 0x00000017, 0x0000004e, 0x0000004d, 0x0004003d, 0x00000017,
-    0x0000004f, 0x0000002f, 0x00050080, 0x00000017, 0x00000050, 0x0000004e, 0x0000004f, 0x0003003e,
-    0x00000049, 0x00000050, 0x0004003d, 0x00000017, 0x00000054, 0x00000049, 0x0004007c, 0x00000006,
-    0x00000055, 0x00000054, 0x00050080, 0x00000006, 0x00000056, 0x00000053, 0x00000055, 0x00050041,
-    0x00000031, 0x00000057, 0x00000023, 0x0000000a, 0x0004003d, 0x00000006, 0x00000058, 0x00000057,
-    0x00050041, 0x00000031, 0x00000059, 0x00000023, 0x00000030, 0x0004003d, 0x00000006, 0x0000005a,
-    0x00000059, 0x00050041, 0x0000000b, 0x0000005b, 0x00000009, 0x0000000a, 0x0004003d, 0x00000006,
-    0x0000005c, 0x0000005b, 0x000700c9, 0x00000006, 0x0000005d, 0x0000005a, 0x0000005c, 0x00000034,
-    0x00000035, 0x00050050, 0x00000021, 0x0000005e, 0x00000058, 0x0000005d, 0x00060041, 0x0000002b,
-    0x0000005f, 0x00000027, 0x00000018, 0x00000056, 0x0003003e, 0x0000005f, 0x0000005e, 0x000200f9,
-    0x00000020, 0x000200f8, 0x00000020, 0x000100fd, 0x00010038,
+const uint8_t Blob100_Data[1655] =
+{
+    0x28, 0xb5, 0x2f, 0xfd, 0x60, 0x74, 0x13, 0x6d, 0x33, 0x00, 0x66, 0x3d, 0xd4, 0x4a, 0xe0, 0xce,
+    0x3a, 0x63, 0xf0, 0x35, 0xc3, 0x0c, 0x33, 0xcc, 0x30, 0xc3, 0x3c, 0x66, 0x20, 0x84, 0x31, 0x86,
+    0x18, 0x8b, 0x18, 0xcc, 0x30, 0x83, 0x0d, 0xa3, 0xb1, 0xa8, 0xc9, 0x5a, 0x22, 0x7a, 0xb5, 0x9e,
+    0x9c, 0x40, 0x55, 0xed, 0xda, 0xf1, 0x61, 0x5b, 0x19, 0xbc, 0x9a, 0xfb, 0xeb, 0x89, 0xcd, 0x63,
+    0xf6, 0xc4, 0x3f, 0xb0, 0x1a, 0x7e, 0xdd, 0x7d, 0x1a, 0xb2, 0xfa, 0x54, 0x5b, 0x93, 0xbf, 0x6e,
+    0x2b, 0xa3, 0x91, 0x95, 0xdd, 0xdd, 0x3b, 0x05, 0xb1, 0x00, 0xb3, 0x00, 0xc1, 0x00, 0xef, 0xdd,
+    0x72, 0x42, 0x68, 0x56, 0x55, 0xe9, 0xe9, 0x72, 0x95, 0xf5, 0xf6, 0x3c, 0x29, 0xb7, 0xad, 0xd8,
+    0x15, 0xf4, 0xff, 0x64, 0x04, 0x19, 0x6f, 0xa9, 0xf9, 0x61, 0xbd, 0x37, 0xb9, 0xf4, 0x4c, 0x2f,
+    0xfe, 0x21, 0x7a, 0xb1, 0x0e, 0x28, 0xc2, 0x2b, 0x0e, 0x87, 0x73, 0xc3, 0x5b, 0xe7, 0xd9, 0xff,
+    0xef, 0x94, 0x97, 0x5b, 0x1f, 0x74, 0xe6, 0xd9, 0xe9, 0x3d, 0xf5, 0xdd, 0xf9, 0xff, 0x52, 0x63,
+    0x1c, 0x8e, 0xc7, 0xda, 0x28, 0x6f, 0xc5, 0x3a, 0xe9, 0xc9, 0xf2, 0xb8, 0x75, 0xc1, 0xd2, 0x7c,
+    0xee, 0x6b, 0xcb, 0x40, 0x29, 0x0c, 0xbd, 0x3e, 0x19, 0x7d, 0xd5, 0xd0, 0x5c, 0x79, 0xf1, 0xe3,
+    0x8d, 0x87, 0xda, 0xd2, 0xb3, 0x3c, 0x06, 0x3a, 0xb7, 0x0d, 0xeb, 0xf3, 0x56, 0xc3, 0xe9, 0x89,
+    0xd6, 0x30, 0x2a, 0xb4, 0xd7, 0x9a, 0xaa, 0xda, 0x6a, 0x34, 0xb1, 0x17, 0x0e, 0xce, 0xab, 0x36,
+    0xba, 0xa8, 0x02, 0x0c, 0x4d, 0xbf, 0xb8, 0x21, 0xfa, 0xff, 0xf4, 0xbc, 0xbb, 0xff, 0xe2, 0x18,
+    0xe0, 0xff, 0xc3, 0x6b, 0xfc, 0x3f, 0xca, 0x41, 0xaa, 0xe5, 0xb6, 0xd7, 0x96, 0xd8, 0x2c, 0xf6,
+    0xb2, 0xff, 0x77, 0xf0, 0x1c, 0x27, 0xf1, 0xf2, 0xa4, 0x7f, 0xe1, 0xc9, 0x13, 0x30, 0x0c, 0xdf,
+    0x2d, 0xdd, 0xca, 0x93, 0xe9, 0x9f, 0xab, 0x77, 0xb7, 0x4f, 0x16, 0xa9, 0xfc, 0xe8, 0x1b, 0x77,
+    0xea, 0x66, 0xa2, 0x5c, 0xae, 0x29, 0x49, 0xdd, 0x56, 0xb1, 0xcb, 0xea, 0x8c, 0xe6, 0x96, 0xbe,
+    0x18, 0x6d, 0xfd, 0xc7, 0xa8, 0xcf, 0xa5, 0xa5, 0x39, 0xd3, 0xc4, 0x7f, 0xa7, 0x2d, 0x75, 0x3d,
+    0x5d, 0x21, 0x0e, 0xeb, 0x5c, 0x9d, 0x8a, 0x9a, 0xe0, 0xbf, 0x7f, 0xc7, 0xab, 0x90, 0x77, 0x3a,
+    0xe3, 0xce, 0xd4, 0xc2, 0xdd, 0x38, 0xaf, 0xba, 0xe3, 0xf4, 0x8c, 0x69, 0x2c, 0xcb, 0xe1, 0xdb,
+    0xa9, 0xf7, 0xcc, 0x07, 0xef, 0xae, 0xc6, 0x27, 0x75, 0xb9, 0x13, 0xdb, 0x5c, 0xdd, 0xbe, 0x9d,
+    0x3c, 0x29, 0xc6, 0xda, 0x36, 0xeb, 0xb0, 0xf5, 0xdd, 0xb3, 0xd9, 0x67, 0x5f, 0x31, 0x7a, 0xd2,
+    0x72, 0x7a, 0xf8, 0x96, 0xc2, 0x56, 0x58, 0x6b, 0xbd, 0xbd, 0xf9, 0x20, 0x7c, 0xee, 0xd8, 0xee,
+    0xc8, 0x62, 0xa1, 0x1b, 0xc3, 0x9a, 0xb7, 0x7b, 0x98, 0x26, 0x22, 0xaf, 0xf7, 0x36, 0xcb, 0x93,
+    0xb6, 0x67, 0x7c, 0xef, 0x8a, 0x4f, 0xcf, 0x9b, 0x0b, 0xe1, 0xce, 0x2c, 0xf0, 0x57, 0x33, 0xad,
+    0xe7, 0x1b, 0x6f, 0xff, 0xf4, 0xaa, 0xb3, 0x0b, 0x7b, 0xd5, 0x67, 0x8d, 0x8c, 0x4c, 0xe6, 0x22,
+    0xd0, 0x2a, 0xcf, 0x30, 0xc5, 0x3c, 0xfc, 0x1d, 0x90, 0x52, 0x76, 0xc1, 0x87, 0x2a, 0xb5, 0x9c,
+    0x56, 0x4c, 0x2a, 0x30, 0x29, 0x06, 0x50, 0x4a, 0x50, 0x4e, 0x26, 0xe0, 0x89, 0xe4, 0xa0, 0x1d,
+    0x20, 0x62, 0x1f, 0x62, 0x2a, 0x7d, 0x80, 0xc0, 0x00, 0xf8, 0xe8, 0xd0, 0xf8, 0x39, 0x3c, 0x4e,
+    0xbe, 0xe4, 0xe1, 0x49, 0x46, 0x34, 0x46, 0x1e, 0x40, 0xd4, 0xb0, 0x24, 0xd3, 0x68, 0x45, 0x04,
+    0xf3, 0x89, 0x21, 0x59, 0x32, 0xd9, 0x8f, 0xf0, 0x21, 0xd8, 0x21, 0x32, 0x42, 0x6b, 0xad, 0xb5,
+    0xd6, 0x5a, 0xff, 0xe7, 0x27, 0x1f, 0x24, 0xb9, 0x66, 0x24, 0xa8, 0x52, 0xf9, 0x20, 0x2a, 0xe7,
+    0x9c, 0xf3, 0x9f, 0xed, 0xee, 0xbe, 0xc3, 0x97, 0xf3, 0xb5, 0x5a, 0xa6, 0x69, 0x5e, 0x64, 0x99,
+    0x39, 0x30, 0x42, 0x11, 0x99, 0xca, 0x11, 0x32, 0xc4, 0x7a, 0x8c, 0x1b, 0x22, 0x80, 0xb0, 0x04,
+    0xc5, 0xef, 0x32, 0x22, 0x15, 0x95, 0x94, 0x3f, 0xa5, 0x44, 0x29, 0x4f, 0x37, 0x01, 0x01, 0xc3,
+    0xbf, 0x36, 0xc4, 0x14, 0xe1, 0x09, 0x70, 0xe8, 0xfb, 0xc7, 0xdb, 0x74, 0x08, 0x10, 0x39, 0x36,
+    0x36, 0xfe, 0x11, 0xd1, 0xc5, 0xbf, 0xd6, 0x10, 0x2f, 0x7b, 0x36, 0x75, 0xff, 0x76, 0xd5, 0x1a,
+    0x39, 0xf6, 0xd8, 0xab, 0xb7, 0xb5, 0xc2, 0x46, 0x92, 0x26, 0x7e, 0xa6, 0x5e, 0x1d, 0x82, 0xff,
+    0x34, 0xef, 0x01, 0xff, 0xae, 0xfa, 0xf7, 0x18, 0x26, 0xf0, 0x2f, 0x6a, 0x3b, 0xb5, 0x0d, 0x1c,
+    0x4e, 0x32, 0x0d, 0x1b, 0xc8, 0xaf, 0xd0, 0x90, 0x81, 0xd4, 0x83, 0x01, 0xd5, 0x73, 0x61, 0xc4,
+    0x33, 0xdb, 0xa1, 0x59, 0xb0, 0x30, 0x9a, 0x0c, 0x86, 0x23, 0x73, 0xc1, 0x59, 0x55, 0xb8, 0x99,
+    0x10, 0xb3, 0x2b, 0x0a, 0xab, 0x97, 0x0d, 0x4d, 0xeb, 0x55, 0xa3, 0x72, 0xad, 0x54, 0x30, 0x12,
+    0x52, 0x21, 0x30, 0x11, 0x20, 0xb8, 0xbc, 0x3c, 0x10, 0x91, 0x7a, 0x61, 0xd1, 0x00, 0xc5, 0x60,
+    0x81, 0x82, 0x93, 0x18, 0x05, 0xa7, 0x04, 0x2a, 0x2c, 0x2b, 0xe6, 0x28, 0x81, 0x1d, 0x42, 0x70,
+    0xa0, 0x80, 0xa9, 0x40, 0x09, 0x8c, 0x87, 0x6f, 0x91, 0x51, 0x42, 0x82, 0x62, 0x44, 0x24, 0x84,
+    0xc0, 0x00, 0x33, 0x63, 0x25, 0x22, 0x99, 0xb0, 0x95, 0xca, 0xa5, 0xe5, 0xc4, 0x64, 0x74, 0x71,
+    0xf0, 0xe3, 0x5f, 0x50, 0x23, 0x48, 0x16, 0x11, 0xbd, 0x10, 0xa7, 0x10, 0x08, 0xa1, 0xa0, 0xa1,
+    0x9e, 0x07, 0xa0, 0x20, 0x5d, 0x0e, 0x68, 0xe8, 0xbc, 0xbd, 0x6a, 0xd1, 0xaa, 0x3f, 0xfa, 0x51,
+    0xb3, 0x9a, 0xee, 0x6c, 0x2e, 0x01, 0xd3, 0x92, 0xc6, 0xce, 0x04, 0xb5, 0x2f, 0xff, 0x01, 0xf4,
+    0x30, 0x73, 0x5e, 0x1d, 0xce, 0x44, 0xce, 0x84, 0xbb, 0x25, 0xf0, 0xcd, 0x56, 0xfa, 0xa4, 0xb8,
+    0x5f, 0x07, 0x9d, 0xd1, 0xec, 0xa3, 0x21, 0x1d, 0xfb, 0xd4, 0x73, 0x18, 0x4c, 0x28, 0xd5, 0x90,
+    0x34, 0x2d, 0x96, 0xc9, 0x9a, 0x31, 0x65, 0x66, 0x6c, 0x8c, 0x2d, 0xc9, 0x04, 0x82, 0x62, 0xa8,
+    0xe2, 0x20, 0x13, 0x24, 0x35, 0x52, 0x90, 0x82, 0xa4, 0xd2, 0x1a, 0xd2, 0x63, 0x84, 0x78, 0xd0,
+    0x52, 0xd9, 0x03, 0x02, 0x22, 0x18, 0x62, 0x45, 0xa2, 0x50, 0x05, 0x2d, 0x28, 0x30, 0x0d, 0xbb,
+    0x01, 0x00, 0x10, 0xe3, 0xfc, 0x07, 0xdf, 0x8b, 0x91, 0x3b, 0xb6, 0x2b, 0x37, 0x34, 0x9f, 0x4f,
+    0x36, 0xa9, 0x90, 0x06, 0xbe, 0xa5, 0xc1, 0xbb, 0x85, 0x3a, 0xc7, 0x44, 0x13, 0x7e, 0xaa, 0x0d,
+    0xe3, 0x6d, 0x28, 0x3f, 0xc5, 0xf7, 0xb1, 0x1b, 0x0e, 0xf8, 0x79, 0x33, 0xbf, 0x31, 0xb7, 0xc8,
+    0xcf, 0xec, 0x6a, 0xb7, 0xf8, 0xe9, 0xb4, 0xcd, 0xed, 0x5f, 0x1c, 0xba, 0x80, 0xf3, 0x0b, 0x28,
+    0x1b, 0x6b, 0x52, 0xe9, 0xb7, 0x66, 0x25, 0x2b, 0x7f, 0x9e, 0xe7, 0x52, 0x20, 0xa4, 0x21, 0x37,
+    0xb1, 0x4d, 0xed, 0xf3, 0xd7, 0xf3, 0x40, 0xaf, 0x96, 0x69, 0x09, 0x8c, 0x97, 0x7d, 0x07, 0xfe,
+    0x14, 0x60, 0x63, 0x43, 0x5e, 0x4c, 0x48, 0xc3, 0xc1, 0x75, 0x7c, 0x2f, 0xc6, 0xb6, 0x8d, 0x7d,
+    0xd7, 0xff, 0xb0, 0xad, 0x81, 0x9e, 0xec, 0x83, 0xfa, 0xb6, 0x5f, 0xfe, 0xa7, 0x45, 0x6b, 0xe1,
+    0x36, 0x2b, 0xf2, 0x3d, 0xf7, 0x9f, 0x36, 0x13, 0x07, 0x14, 0xd0, 0x09, 0x2b, 0x4f, 0xa1, 0x72,
+    0x47, 0x75, 0xf7, 0x87, 0x43, 0x7b, 0xa7, 0xe5, 0xee, 0x0e, 0xf0, 0xb8, 0x40, 0x8f, 0xe2, 0xf9,
+    0x40, 0xee, 0x7d, 0xb1, 0x37, 0x2f, 0x17, 0x15, 0xba, 0x5a, 0x43, 0xa9, 0xae, 0x21, 0x94, 0x2b,
+    0xfb, 0xff, 0xe9, 0xbb, 0x4d, 0xc3, 0xdf, 0xa2, 0x66, 0xed, 0x34, 0x9c, 0x76, 0xfb, 0x08, 0xe0,
+    0x40, 0xed, 0xed, 0xfd, 0xf4, 0x4c, 0x17, 0xbf, 0x44, 0x63, 0x9f, 0xcd, 0xce, 0xd7, 0xd6, 0x95,
+    0x16, 0x0b, 0x99, 0x73, 0x9a, 0x36, 0xf4, 0x20, 0x02, 0x16, 0x44, 0x74, 0x35, 0x61, 0x83, 0x0d,
+    0x60, 0x5d, 0xd7, 0x02, 0x0f, 0xd7, 0xac, 0xb2, 0xc7, 0x3c, 0x10, 0xfb, 0x0e, 0x03, 0x23, 0xe8,
+    0xf6, 0xca, 0x05, 0x3a, 0xd0, 0xc2, 0x87, 0xcc, 0x4e, 0x71, 0x84, 0x6f, 0x14, 0x3d, 0xd6, 0x42,
+    0xd2, 0xb2, 0xdb, 0xfa, 0x2e, 0xbe, 0x57, 0x7b, 0x9b, 0x0c, 0x73, 0x0b, 0xad, 0xa9, 0xfd, 0x54,
+    0x1d, 0x0a, 0xc8, 0x51, 0xb8, 0x25, 0xe6, 0x1c, 0xa3, 0x8e, 0x0c, 0x08, 0x53, 0xbb, 0xa8, 0x0c,
+    0x74, 0x78, 0xec, 0x0c, 0x7b, 0x91, 0x96, 0x26, 0x8f, 0xa1, 0x5d, 0xcf, 0xaf, 0x5e, 0xf0, 0xe1,
+    0xdd, 0x5f, 0x36, 0x4d, 0xbe, 0x3c, 0xf7, 0x90, 0x54, 0x0b, 0x72, 0x9b, 0x15, 0xab, 0x37, 0x35,
+    0xb6, 0xf8, 0xf3, 0x31, 0x9e, 0xfb, 0xfc, 0x16, 0x3a, 0x99, 0xac, 0x9b, 0xcf, 0x13, 0xe7, 0x03,
+    0x71, 0xd0, 0x6e, 0x46, 0x7f, 0xe6, 0xc7, 0xdc, 0xbe, 0xea, 0xc6, 0x38, 0xfc, 0xfb, 0x44, 0x91,
+    0x9c, 0xe9, 0x7d, 0x08, 0xf8, 0x54, 0x2a, 0x5c, 0xce, 0xa6, 0xb4, 0x10, 0x97, 0x8a, 0xf0, 0x83,
+    0xd9, 0x39, 0x69, 0x51, 0xf0, 0xd7, 0x2e, 0x1d, 0xc1, 0xde, 0x55, 0x39, 0x05, 0x73, 0x8d, 0xf5,
+    0x78, 0xeb, 0x42, 0x51, 0xc2, 0x39, 0xa0, 0xff, 0xe6, 0x3c, 0xdb, 0xb0, 0x71, 0x75, 0x21, 0x31,
+    0x23, 0xe6, 0xcb, 0xb7, 0x72, 0x3f, 0x25, 0xcd, 0xf7, 0x10, 0xc8, 0x09, 0x7e, 0x2f, 0x0a, 0x07,
+    0x79, 0xe3, 0x06, 0xf8, 0xf2, 0x02, 0xb9, 0xdf, 0x86, 0x06, 0xcb, 0xd4, 0x46, 0x9e, 0x8e, 0x5b,
+    0x1a, 0x95, 0xe0, 0x53, 0x27, 0x0d, 0x96, 0xb4, 0x2a, 0x13, 0x65, 0x51, 0xf6, 0x74, 0xdc, 0x97,
+    0xd2, 0xf6, 0x7d, 0x17, 0x62, 0xfd, 0x91, 0xc5, 0xef, 0xe7, 0xf8, 0x29, 0x0b, 0x33, 0xe1, 0x86,
+    0xac, 0xe6, 0x7a, 0x95, 0xfb, 0xb5, 0x47, 0xe3, 0x48, 0xb5, 0xac, 0x86, 0xeb, 0x5a, 0xea, 0x78,
+    0x0f, 0x8b, 0xa5, 0x28, 0x78, 0x3b, 0x34, 0x43, 0x20, 0x2f, 0xe3, 0x8d, 0x24, 0x39, 0x5d, 0x0f,
+    0x02, 0xaf, 0xb2, 0xda, 0xac, 0xd8, 0xdf, 0x7d, 0x2a, 0x7a, 0xc9, 0xe4, 0x8c, 0xbc, 0x03, 0xb3,
+    0xb6, 0x2f, 0x32, 0x12, 0xc4, 0x92, 0x3a, 0x7f, 0xb7, 0x1f, 0xa0, 0xfe, 0x94, 0x7d, 0xd4, 0xb8,
+    0x3a, 0x39, 0x7d, 0xd7, 0x89, 0x3b, 0x6c, 0x24, 0x2c, 0x87, 0x35, 0x08, 0x9c, 0xe8, 0x6b, 0x43,
+    0xdd, 0xa4, 0x59, 0x40, 0x52, 0xb0, 0xaf, 0xf2, 0x8b, 0xca, 0x06, 0xf8, 0xc6, 0x9c, 0x0c, 0x14,
+    0xd5, 0xa7, 0x35, 0xc7, 0x7e, 0x34, 0xc1, 0x7d, 0xe3, 0x5e, 0x13, 0x76, 0xf7, 0x4b, 0x74, 0x47,
+    0xb1, 0xfc, 0x00, 0x28, 0x0f, 0x3c, 0xbc, 0xd6, 0x7e, 0x96, 0x77, 0x7c, 0x43, 0x3c, 0x67, 0x82,
+    0x60, 0xf4, 0x4c, 0xc2, 0x51, 0x77, 0x5c, 0x25, 0xe3, 0x5c, 0x4c, 0xb6, 0xa6, 0x8f, 0x1b, 0xd5,
+    0xf1, 0x2d, 0x93, 0x8a, 0x96, 0x11, 0xf8, 0x8f, 0x96, 0xbe, 0xf4, 0x06, 0xfc, 0xf7, 0xe9, 0x4f,
+    0x09, 0x99, 0xb2, 0xba, 0x9a, 0xb5, 0x79, 0x3e, 0xda, 0x13, 0xa0, 0xa0, 0x00, 0x4e, 0xff, 0xe4,
+    0x4d, 0x98, 0x41, 0xb2, 0x86, 0x3b, 0xbd, 0xd9, 0xf0, 0x2a, 0xbb, 0x8b, 0xb8, 0xed, 0x4e, 0xb3,
+    0x96, 0xc4, 0x9e, 0x6d, 0x53, 0x79, 0x69, 0x5c, 0xea, 0x37, 0x5b, 0x1b, 0xeb, 0xf0, 0x5a, 0x2c,
+    0xfd, 0x0f, 0x98, 0xa2, 0xe7, 0x78, 0x65, 0x89, 0x91, 0x1b, 0x51, 0x63, 0x17, 0x1e, 0xbf, 0x55,
+    0x57, 0xee, 0xe0, 0xbd, 0x68, 0xcd, 0xdf, 0x11, 0x09, 0x36, 0x0a, 0xd7, 0x89, 0x15, 0xfb, 0x38,
+    0xb2, 0x3b, 0x28, 0xa7, 0x04, 0x78, 0x14, 0xd4, 0x25, 0x3a, 0x9e, 0xb5, 0x0c, 0x94, 0x43, 0x0f,
+    0xdc, 0x41, 0x7b, 0x80, 0x46, 0x04, 0x03, 0x50, 0xa9, 0x64, 0xbf, 0x76, 0x1c, 0xa5, 0x3f, 0x1f,
+    0xf2, 0xb2, 0x75, 0xa4, 0xb7, 0x07, 0x7c, 0xd8, 0x2d, 0x4f, 0xf2, 0x63, 0xbf, 0x7c, 0x25, 0x0d,
+    0x07, 0x9d, 0x40, 0xd8, 0x33, 0x84, 0x03,
 };
+const ShaderModule Blob100 = { Blob100_Data, 1655u, 1309u, 100u };
 
 } // namespace detail
 } // namespace VulkanShaders
@@ -28,10 +28,9 @@
     Pipeline indices match ComputeRenderer3D::ShaderCompileStep() in
     src/GPU3D_Compute.cpp one for one.
 
-    The SPIR-V words live in per-stage translation units rather than in the
-    header so that including the public header stays cheap: the full module set
-    is a few megabytes of integer literals and would otherwise be re-parsed by
-    every consumer.
+    Every module is one zstd frame, inflated on first use by
+    Vk::InflateShaderModule(). The frames live in per-stage translation units
+    rather than in the header so that including the public header stays cheap.
 */
 
 #include "GPU3D_Vulkan_ShaderModules.h"
@@ -42,130 +41,130 @@ namespace melonDS
 namespace VulkanShaders
 {
 
-const ShaderModule Modules[TileGeometryBucketCount][Pipeline_Count] =
+const ShaderModule* const Modules[TileGeometryBucketCount][Pipeline_Count] =
 {
     // bucket 0: TileSize 8, CoarseTileCountY 4, CoarseTileArea 32, ClearCoarseBinMaskLocalSize 64
     {
-        { detail::Blob000, detail::Blob000_Words }, // InterpSpansZ
-        { detail::Blob001, detail::Blob001_Words }, // InterpSpansW
-        { detail::Blob002, detail::Blob002_Words }, // BinCombined
-        { detail::Blob003, detail::Blob003_Words }, // DepthBlendZ
-        { detail::Blob004, detail::Blob004_Words }, // DepthBlendW
-        { detail::Blob005, detail::Blob005_Words }, // RasteriseNoTextureZ
-        { detail::Blob006, detail::Blob006_Words }, // RasteriseNoTextureW
-        { detail::Blob007, detail::Blob007_Words }, // RasteriseNoTextureToonZ
-        { detail::Blob008, detail::Blob008_Words }, // RasteriseNoTextureToonW
-        { detail::Blob009, detail::Blob009_Words }, // RasteriseNoTextureHighlightZ
-        { detail::Blob010, detail::Blob010_Words }, // RasteriseNoTextureHighlightW
-        { detail::Blob011, detail::Blob011_Words }, // RasteriseUseTextureDecalZ
-        { detail::Blob012, detail::Blob012_Words }, // RasteriseUseTextureDecalW
-        { detail::Blob013, detail::Blob013_Words }, // RasteriseUseTextureModulateZ
-        { detail::Blob014, detail::Blob014_Words }, // RasteriseUseTextureModulateW
-        { detail::Blob015, detail::Blob015_Words }, // RasteriseUseTextureToonZ
-        { detail::Blob016, detail::Blob016_Words }, // RasteriseUseTextureToonW
-        { detail::Blob017, detail::Blob017_Words }, // RasteriseUseTextureHighlightZ
-        { detail::Blob018, detail::Blob018_Words }, // RasteriseUseTextureHighlightW
-        { detail::Blob019, detail::Blob019_Words }, // RasteriseShadowMaskZ
-        { detail::Blob020, detail::Blob020_Words }, // RasteriseShadowMaskW
-        { detail::Blob021, detail::Blob021_Words }, // ClearCoarseBinMask
-        { detail::Blob022, detail::Blob022_Words }, // ClearIndirectWorkCount
-        { detail::Blob023, detail::Blob023_Words }, // CalculateWorkOffsets
-        { detail::Blob024, detail::Blob024_Words }, // SortWork
-        { detail::Blob025, detail::Blob025_Words }, // FinalPass0
-        { detail::Blob026, detail::Blob026_Words }, // FinalPass1
-        { detail::Blob027, detail::Blob027_Words }, // FinalPass2
-        { detail::Blob028, detail::Blob028_Words }, // FinalPass3
-        { detail::Blob029, detail::Blob029_Words }, // FinalPass4
-        { detail::Blob030, detail::Blob030_Words }, // FinalPass5
-        { detail::Blob031, detail::Blob031_Words }, // FinalPass6
-        { detail::Blob032, detail::Blob032_Words }, // FinalPass7
-        { detail::Blob033, detail::Blob033_Words }, // Resolve
-        { detail::Blob034, detail::Blob034_Words }, // CaptureSidecar
-        { detail::Blob035, detail::Blob035_Words }, // Compositor
-        { detail::Blob036, detail::Blob036_Words }, // CorrectCoverage
-        { detail::Blob037, detail::Blob037_Words }, // GPU2DNative
+        &detail::Blob000, // InterpSpansZ
+        &detail::Blob001, // InterpSpansW
+        &detail::Blob002, // BinCombined
+        &detail::Blob003, // DepthBlendZ
+        &detail::Blob004, // DepthBlendW
+        &detail::Blob005, // RasteriseNoTextureZ
+        &detail::Blob006, // RasteriseNoTextureW
+        &detail::Blob007, // RasteriseNoTextureToonZ
+        &detail::Blob008, // RasteriseNoTextureToonW
+        &detail::Blob009, // RasteriseNoTextureHighlightZ
+        &detail::Blob010, // RasteriseNoTextureHighlightW
+        &detail::Blob011, // RasteriseUseTextureDecalZ
+        &detail::Blob012, // RasteriseUseTextureDecalW
+        &detail::Blob013, // RasteriseUseTextureModulateZ
+        &detail::Blob014, // RasteriseUseTextureModulateW
+        &detail::Blob015, // RasteriseUseTextureToonZ
+        &detail::Blob016, // RasteriseUseTextureToonW
+        &detail::Blob017, // RasteriseUseTextureHighlightZ
+        &detail::Blob018, // RasteriseUseTextureHighlightW
+        &detail::Blob019, // RasteriseShadowMaskZ
+        &detail::Blob020, // RasteriseShadowMaskW
+        &detail::Blob021, // ClearCoarseBinMask
+        &detail::Blob022, // ClearIndirectWorkCount
+        &detail::Blob023, // CalculateWorkOffsets
+        &detail::Blob024, // SortWork
+        &detail::Blob025, // FinalPass0
+        &detail::Blob026, // FinalPass1
+        &detail::Blob027, // FinalPass2
+        &detail::Blob028, // FinalPass3
+        &detail::Blob029, // FinalPass4
+        &detail::Blob030, // FinalPass5
+        &detail::Blob031, // FinalPass6
+        &detail::Blob032, // FinalPass7
+        &detail::Blob033, // Resolve
+        &detail::Blob034, // CaptureSidecar
+        &detail::Blob035, // Compositor
+        &detail::Blob036, // CorrectCoverage
+        &detail::Blob037, // GPU2DNative
     },
     // bucket 1: TileSize 16, CoarseTileCountY 4, CoarseTileArea 32, ClearCoarseBinMaskLocalSize 64
     {
-        { detail::Blob038, detail::Blob038_Words }, // InterpSpansZ
-        { detail::Blob039, detail::Blob039_Words }, // InterpSpansW
-        { detail::Blob040, detail::Blob040_Words }, // BinCombined
-        { detail::Blob041, detail::Blob041_Words }, // DepthBlendZ
-        { detail::Blob042, detail::Blob042_Words }, // DepthBlendW
-        { detail::Blob043, detail::Blob043_Words }, // RasteriseNoTextureZ
-        { detail::Blob044, detail::Blob044_Words }, // RasteriseNoTextureW
-        { detail::Blob045, detail::Blob045_Words }, // RasteriseNoTextureToonZ
-        { detail::Blob046, detail::Blob046_Words }, // RasteriseNoTextureToonW
-        { detail::Blob047, detail::Blob047_Words }, // RasteriseNoTextureHighlightZ
-        { detail::Blob048, detail::Blob048_Words }, // RasteriseNoTextureHighlightW
-        { detail::Blob049, detail::Blob049_Words }, // RasteriseUseTextureDecalZ
-        { detail::Blob050, detail::Blob050_Words }, // RasteriseUseTextureDecalW
-        { detail::Blob051, detail::Blob051_Words }, // RasteriseUseTextureModulateZ
-        { detail::Blob052, detail::Blob052_Words }, // RasteriseUseTextureModulateW
-        { detail::Blob053, detail::Blob053_Words }, // RasteriseUseTextureToonZ
-        { detail::Blob054, detail::Blob054_Words }, // RasteriseUseTextureToonW
-        { detail::Blob055, detail::Blob055_Words }, // RasteriseUseTextureHighlightZ
-        { detail::Blob056, detail::Blob056_Words }, // RasteriseUseTextureHighlightW
-        { detail::Blob057, detail::Blob057_Words }, // RasteriseShadowMaskZ
-        { detail::Blob058, detail::Blob058_Words }, // RasteriseShadowMaskW
-        { detail::Blob059, detail::Blob059_Words }, // ClearCoarseBinMask
-        { detail::Blob060, detail::Blob060_Words }, // ClearIndirectWorkCount
-        { detail::Blob061, detail::Blob061_Words }, // CalculateWorkOffsets
-        { detail::Blob062, detail::Blob062_Words }, // SortWork
-        { detail::Blob063, detail::Blob063_Words }, // FinalPass0
-        { detail::Blob064, detail::Blob064_Words }, // FinalPass1
-        { detail::Blob065, detail::Blob065_Words }, // FinalPass2
-        { detail::Blob066, detail::Blob066_Words }, // FinalPass3
-        { detail::Blob067, detail::Blob067_Words }, // FinalPass4
-        { detail::Blob068, detail::Blob068_Words }, // FinalPass5
-        { detail::Blob069, detail::Blob069_Words }, // FinalPass6
-        { detail::Blob070, detail::Blob070_Words }, // FinalPass7
-        { detail::Blob071, detail::Blob071_Words }, // Resolve
-        { detail::Blob072, detail::Blob072_Words }, // CaptureSidecar
-        { detail::Blob073, detail::Blob073_Words }, // Compositor
-        { detail::Blob074, detail::Blob074_Words }, // CorrectCoverage
-        { detail::Blob075, detail::Blob075_Words }, // GPU2DNative
+        &detail::Blob038, // InterpSpansZ
+        &detail::Blob039, // InterpSpansW
+        &detail::Blob040, // BinCombined
+        &detail::Blob041, // DepthBlendZ
+        &detail::Blob042, // DepthBlendW
+        &detail::Blob043, // RasteriseNoTextureZ
+        &detail::Blob044, // RasteriseNoTextureW
+        &detail::Blob045, // RasteriseNoTextureToonZ
+        &detail::Blob046, // RasteriseNoTextureToonW
+        &detail::Blob047, // RasteriseNoTextureHighlightZ
+        &detail::Blob048, // RasteriseNoTextureHighlightW
+        &detail::Blob049, // RasteriseUseTextureDecalZ
+        &detail::Blob050, // RasteriseUseTextureDecalW
+        &detail::Blob051, // RasteriseUseTextureModulateZ
+        &detail::Blob052, // RasteriseUseTextureModulateW
+        &detail::Blob053, // RasteriseUseTextureToonZ
+        &detail::Blob054, // RasteriseUseTextureToonW
+        &detail::Blob055, // RasteriseUseTextureHighlightZ
+        &detail::Blob056, // RasteriseUseTextureHighlightW
+        &detail::Blob057, // RasteriseShadowMaskZ
+        &detail::Blob058, // RasteriseShadowMaskW
+        &detail::Blob059, // ClearCoarseBinMask
+        &detail::Blob060, // ClearIndirectWorkCount
+        &detail::Blob061, // CalculateWorkOffsets
+        &detail::Blob062, // SortWork
+        &detail::Blob063, // FinalPass0
+        &detail::Blob064, // FinalPass1
+        &detail::Blob065, // FinalPass2
+        &detail::Blob066, // FinalPass3
+        &detail::Blob067, // FinalPass4
+        &detail::Blob068, // FinalPass5
+        &detail::Blob069, // FinalPass6
+        &detail::Blob070, // FinalPass7
+        &detail::Blob071, // Resolve
+        &detail::Blob072, // CaptureSidecar
+        &detail::Blob073, // Compositor
+        &detail::Blob074, // CorrectCoverage
+        &detail::Blob075, // GPU2DNative
     },
     // bucket 2: TileSize 32, CoarseTileCountY 6, CoarseTileArea 48, ClearCoarseBinMaskLocalSize 48
     {
-        { detail::Blob076, detail::Blob076_Words }, // InterpSpansZ
-        { detail::Blob077, detail::Blob077_Words }, // InterpSpansW
-        { detail::Blob078, detail::Blob078_Words }, // BinCombined
-        { detail::Blob079, detail::Blob079_Words }, // DepthBlendZ
-        { detail::Blob080, detail::Blob080_Words }, // DepthBlendW
-        { detail::Blob081, detail::Blob081_Words }, // RasteriseNoTextureZ
-        { detail::Blob082, detail::Blob082_Words }, // RasteriseNoTextureW
-        { detail::Blob083, detail::Blob083_Words }, // RasteriseNoTextureToonZ
-        { detail::Blob084, detail::Blob084_Words }, // RasteriseNoTextureToonW
-        { detail::Blob085, detail::Blob085_Words }, // RasteriseNoTextureHighlightZ
-        { detail::Blob086, detail::Blob086_Words }, // RasteriseNoTextureHighlightW
-        { detail::Blob087, detail::Blob087_Words }, // RasteriseUseTextureDecalZ
-        { detail::Blob088, detail::Blob088_Words }, // RasteriseUseTextureDecalW
-        { detail::Blob089, detail::Blob089_Words }, // RasteriseUseTextureModulateZ
-        { detail::Blob090, detail::Blob090_Words }, // RasteriseUseTextureModulateW
-        { detail::Blob091, detail::Blob091_Words }, // RasteriseUseTextureToonZ
-        { detail::Blob092, detail::Blob092_Words }, // RasteriseUseTextureToonW
-        { detail::Blob093, detail::Blob093_Words }, // RasteriseUseTextureHighlightZ
-        { detail::Blob094, detail::Blob094_Words }, // RasteriseUseTextureHighlightW
-        { detail::Blob095, detail::Blob095_Words }, // RasteriseShadowMaskZ
-        { detail::Blob096, detail::Blob096_Words }, // RasteriseShadowMaskW
-        { detail::Blob097, detail::Blob097_Words }, // ClearCoarseBinMask
-        { detail::Blob098, detail::Blob098_Words }, // ClearIndirectWorkCount
-        { detail::Blob099, detail::Blob099_Words }, // CalculateWorkOffsets
-        { detail::Blob100, detail::Blob100_Words }, // SortWork
-        { detail::Blob101, detail::Blob101_Words }, // FinalPass0
-        { detail::Blob102, detail::Blob102_Words }, // FinalPass1
-        { detail::Blob103, detail::Blob103_Words }, // FinalPass2
-        { detail::Blob104, detail::Blob104_Words }, // FinalPass3
-        { detail::Blob105, detail::Blob105_Words }, // FinalPass4
-        { detail::Blob106, detail::Blob106_Words }, // FinalPass5
-        { detail::Blob107, detail::Blob107_Words }, // FinalPass6
-        { detail::Blob108, detail::Blob108_Words }, // FinalPass7
-        { detail::Blob109, detail::Blob109_Words }, // Resolve
-        { detail::Blob110, detail::Blob110_Words }, // CaptureSidecar
-        { detail::Blob111, detail::Blob111_Words }, // Compositor
-        { detail::Blob112, detail::Blob112_Words }, // CorrectCoverage
-        { detail::Blob113, detail::Blob113_Words }, // GPU2DNative
+        &detail::Blob076, // InterpSpansZ
+        &detail::Blob077, // InterpSpansW
+        &detail::Blob078, // BinCombined
+        &detail::Blob079, // DepthBlendZ
+        &detail::Blob080, // DepthBlendW
+        &detail::Blob081, // RasteriseNoTextureZ
+        &detail::Blob082, // RasteriseNoTextureW
+        &detail::Blob083, // RasteriseNoTextureToonZ
+        &detail::Blob084, // RasteriseNoTextureToonW
+        &detail::Blob085, // RasteriseNoTextureHighlightZ
+        &detail::Blob086, // RasteriseNoTextureHighlightW
+        &detail::Blob087, // RasteriseUseTextureDecalZ
+        &detail::Blob088, // RasteriseUseTextureDecalW
+        &detail::Blob089, // RasteriseUseTextureModulateZ
+        &detail::Blob090, // RasteriseUseTextureModulateW
+        &detail::Blob091, // RasteriseUseTextureToonZ
+        &detail::Blob092, // RasteriseUseTextureToonW
+        &detail::Blob093, // RasteriseUseTextureHighlightZ
+        &detail::Blob094, // RasteriseUseTextureHighlightW
+        &detail::Blob095, // RasteriseShadowMaskZ
+        &detail::Blob096, // RasteriseShadowMaskW
+        &detail::Blob097, // ClearCoarseBinMask
+        &detail::Blob098, // ClearIndirectWorkCount
+        &detail::Blob099, // CalculateWorkOffsets
+        &detail::Blob100, // SortWork
+        &detail::Blob101, // FinalPass0
+        &detail::Blob102, // FinalPass1
+        &detail::Blob103, // FinalPass2
+        &detail::Blob104, // FinalPass3
+        &detail::Blob105, // FinalPass4
+        &detail::Blob106, // FinalPass5
+        &detail::Blob107, // FinalPass6
+        &detail::Blob108, // FinalPass7
+        &detail::Blob109, // Resolve
+        &detail::Blob110, // CaptureSidecar
+        &detail::Blob111, // Compositor
+        &detail::Blob112, // CorrectCoverage
+        &detail::Blob113, // GPU2DNative
     },
 };
 
@@ -28,10 +28,9 @@
     Pipeline indices match ComputeRenderer3D::ShaderCompileStep() in
     src/GPU3D_Compute.cpp one for one.
 
-    The SPIR-V words live in per-stage translation units rather than in the
-    header so that including the public header stays cheap: the full module set
-    is a few megabytes of integer literals and would otherwise be re-parsed by
-    every consumer.
+    Every module is one zstd frame, inflated on first use by
+    Vk::InflateShaderModule(). The frames live in per-stage translation units
+    rather than in the header so that including the public header stays cheap.
 */
 
 #ifndef GPU3D_VULKAN_SHADERMODULES_H
@@ -169,16 +168,22 @@ inline constexpr uint32_t TileGeometryBucketForScale(uint32_t scale)
     return (scale >= 5 ? 1u : 0u) + (scale >= 9 ? 1u : 0u);
 }
 
+// One SPIR-V module, as a zstd frame. Vk::InflateShaderModule() turns it into
+// words and keeps them, keyed by Index.
 struct ShaderModule
 {
-    const uint32_t* Words;
+    const uint8_t* Data;
+    uint32_t DataBytes;
     uint32_t WordCount;
+    uint32_t Index;
 };
 
+inline constexpr uint32_t ModuleCount = 114;
+
 // [tile geometry bucket][pipeline]. Defined in
 // generated/GPU3D_Vulkan_ShaderModules.cpp; identical modules are shared, so
-// two entries may point at the same words.
-extern const ShaderModule Modules[TileGeometryBucketCount][Pipeline_Count];
+// two entries may point at the same module.
+extern const ShaderModule* const Modules[TileGeometryBucketCount][Pipeline_Count];
 extern const char* const PipelineNames[Pipeline_Count];
 
 } // namespace VulkanShaders
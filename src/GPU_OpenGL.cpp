@@ -54,6 +54,8 @@ GLRenderer::GLRenderer(melonDS::NDS& nds, bool compute)
         Rend3D = std::make_unique<GLRenderer3D>(GPU.GPU3D, *this);
 
     ScaleFactor = 0;
+    CapturedLayers256 = 0;
+    CapturedLayers128 = 0;
 }
 
 #define glTexParams(target, wrap) \
@@ -276,6 +278,12 @@ GLRenderer::~GLRenderer()
     glDeleteTextures(1, &CaptureSyncTex);
     glDeleteFramebuffers(1, &CaptureSyncFB);
 
+    InvalidateCaptureReadbacks();
+    for (CaptureReadback& slot : Readback256)
+        glDeleteBuffers(1, &slot.PBO);
+    for (CaptureReadback& slot : Readback128)
+        glDeleteBuffers(1, &slot.PBO);
+
     glDeleteBuffers(1, &FPConfigUBO);
     glDeleteBuffers(1, &CaptureConfigUBO);
 
@@ -301,6 +309,16 @@ void GLRenderer::Reset()
     LastCapLine = 0;
     Aux0VRAMCap = -1;
 
+    if (ReadbackStats.Issued || ReadbackStats.Synchronous)
+    {
+        Log(LogLevel::Debug, "GPU_OpenGL: capture readbacks: %llu issued, %llu unused; syncs: %llu pre-resolved, %llu waited, %llu synchronous\n",
+            (unsigned long long)ReadbackStats.Issued, (unsigned long long)ReadbackStats.Unused,
+            (unsigned long long)ReadbackStats.PreResolved, (unsigned long long)ReadbackStats.Waited,
+            (unsigned long long)ReadbackStats.Synchronous);
+    }
+    InvalidateCaptureReadbacks();
+    ReadbackStats = {};
+
     Rend2D_A->Reset();
     Rend2D_B->Reset();
     Rend3D->Reset();
@@ -355,6 +373,9 @@ void GLRenderer::SetScaleFactor(int scale)
     ScreenW = 256 * scale;
     ScreenH = 192 * scale;
 
+    // the capture layers are reallocated below
+    InvalidateCaptureReadbacks();
+
     const GLenum fbassign2[] = {GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1};
 
     glBindTexture(GL_TEXTURE_2D_ARRAY, CaptureOutput256Tex);
@@ -626,6 +647,25 @@ void GLRenderer::VBlank()
     if (GPU.CaptureEnable)
         DoCapture(LastCapLine, 192);
 
+    // the frame's captures are finished, get them on their way to the CPU
+    // before anything asks for them
+    if (CapturedLayers256 | CapturedLayers128)
+    {
+        glDisable(GL_DITHER);
+        for (int i = 0; i < 4; i++)
+        {
+            if (CapturedLayers256 & (1 << i))
+                IssueCaptureReadback(Readback256[i], 256, i);
+        }
+        for (int i = 0; i < 16; i++)
+        {
+            if (CapturedLayers128 & (1 << i))
+                IssueCaptureReadback(Readback128[i], 128, i);
+        }
+        CapturedLayers256 = 0;
+        CapturedLayers128 = 0;
+    }
+
 #if defined(MELONPRIME_ENABLE_DEVELOPER_FEATURES)
     DumpFrameForValidation();
 #endif
@@ -774,13 +814,20 @@ void GLRenderer::DoCapture(int ystart, int yend)
     glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
     if (capsize == 0)
     {
-        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, CaptureOutput128FB[(dstblock << 2) | dstoffset]);
+        u32 layer = (dstblock << 2) | dstoffset;
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, CaptureOutput128FB[layer]);
         glViewport(0, 0, 128*ScaleFactor, 128*ScaleFactor);
+
+        InvalidateCaptureReadback(Readback128[layer]);
+        CapturedLayers128 |= (1 << layer);
     }
     else
     {
         glBindFramebuffer(GL_DRAW_FRAMEBUFFER, CaptureOutput256FB[dstblock]);
         glViewport(0, 0, 256*ScaleFactor, 256*ScaleFactor);
+
+        InvalidateCaptureReadback(Readback256[dstblock]);
+        CapturedLayers256 |= (1 << dstblock);
     }
 
     CaptureConfig.uInvCaptureSize[0] = 1.f / (float)dstwidth;
@@ -902,6 +949,93 @@ void GLRenderer::DownscaleCapture(int width, int height, int layer)
     glDrawArrays(GL_TRIANGLES, 0, 2*3);
 }
 
+void GLRenderer::IssueCaptureReadback(CaptureReadback& slot, int size, int layer)
+{
+    DownscaleCapture(size, size, layer);
+
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, CaptureSyncFB);
+
+    if (!slot.PBO)
+    {
+        glGenBuffers(1, &slot.PBO);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.PBO);
+        glBufferData(GL_PIXEL_PACK_BUFFER, size * size * 2, nullptr, GL_STREAM_READ);
+    }
+    else
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.PBO);
+    glReadPixels(0, 0, size, size, GL_RGBA, GL_UNSIGNED_SHORT_1_5_5_5_REV, nullptr);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    slot.Fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    slot.Valid = true;
+    slot.Used = false;
+    ReadbackStats.Issued++;
+}
+
+void GLRenderer::InvalidateCaptureReadback(CaptureReadback& slot)
+{
+    if (slot.Valid && !slot.Used)
+        ReadbackStats.Unused++;
+    if (slot.Fence)
+        glDeleteSync(slot.Fence);
+    slot.Fence = nullptr;
+    slot.Valid = false;
+}
+
+void GLRenderer::InvalidateCaptureReadbacks()
+{
+    for (CaptureReadback& slot : Readback256)
+        InvalidateCaptureReadback(slot);
+    for (CaptureReadback& slot : Readback128)
+        InvalidateCaptureReadback(slot);
+    CapturedLayers256 = 0;
+    CapturedLayers128 = 0;
+}
+
+const u8* GLRenderer::MapCaptureReadback(CaptureReadback& slot, u32 bytes)
+{
+    if (!slot.Valid)
+    {
+        ReadbackStats.Synchronous++;
+        return nullptr;
+    }
+
+    if (slot.Fence)
+    {
+        GLenum status = glClientWaitSync(slot.Fence, 0, 0);
+        if (status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED)
+            ReadbackStats.PreResolved++;
+        else
+        {
+            // still in flight, which is no worse than reading back now
+            status = glClientWaitSync(slot.Fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000ull);
+            if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+            {
+                InvalidateCaptureReadback(slot);
+                ReadbackStats.Synchronous++;
+                return nullptr;
+            }
+            ReadbackStats.Waited++;
+        }
+        glDeleteSync(slot.Fence);
+        slot.Fence = nullptr;
+    }
+    else
+        ReadbackStats.PreResolved++;
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.PBO);
+    const u8* data = (const u8*)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, bytes, GL_MAP_READ_BIT);
+    if (!data)
+    {
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        InvalidateCaptureReadback(slot);
+        ReadbackStats.Synchronous++;
+        return nullptr;
+    }
+    slot.Used = true;
+    return data;
+}
+
 CaptureSyncResult GLRenderer::SyncVRAMCapture(
     u32 bank, u32 start, u32 len, bool complete)
 {
@@ -916,31 +1050,48 @@ CaptureSyncResult GLRenderer::SyncVRAMCapture(
 
     if (len == 0) // 128x128
     {
-        DownscaleCapture(128, 128, (bank<<2) | start);
+        u32 layer = (bank<<2) | start;
+        if (const u8* data = MapCaptureReadback(Readback128[layer], 128 * 128 * 2))
+        {
+            memcpy(&vram[start * 64 * 512], data, 128 * 128 * 2);
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        }
+        else
+        {
+            DownscaleCapture(128, 128, layer);
 
-        glBindFramebuffer(GL_READ_FRAMEBUFFER, CaptureSyncFB);
+            glBindFramebuffer(GL_READ_FRAMEBUFFER, CaptureSyncFB);
 
-        glReadPixels(0, 0, 128, 128,
-                     GL_RGBA, GL_UNSIGNED_SHORT_1_5_5_5_REV, &vram[start * 64 * 512]);
+            glReadPixels(0, 0, 128, 128,
+                         GL_RGBA, GL_UNSIGNED_SHORT_1_5_5_5_REV, &vram[start * 64 * 512]);
+        }
 
         for (u32 j = start * 64; j < (start+1) * 64; j++)
             GPU.VRAMDirty[bank][j] = true;
     }
     else
     {
-        DownscaleCapture(256, 256, bank);
+        const u8* data = MapCaptureReadback(Readback256[bank], 256 * 256 * 2);
+        if (!data)
+        {
+            DownscaleCapture(256, 256, bank);
 
-        glBindFramebuffer(GL_READ_FRAMEBUFFER, CaptureSyncFB);
+            glBindFramebuffer(GL_READ_FRAMEBUFFER, CaptureSyncFB);
+        }
 
         u32 pos = start;
         for (u32 i = 0; i < len;)
         {
-            u32 end = pos + len;
+            u32 end = pos + (len - i);
             if (end > 4)
                 end = 4;
 
-            glReadPixels(0, pos * 64, 256, (end - pos) * 64,
-                         GL_RGBA, GL_UNSIGNED_SHORT_1_5_5_5_REV, &vram[pos * 64 * 512]);
+            if (data)
+                memcpy(&vram[pos * 64 * 512], &data[pos * 64 * 512], (end - pos) * 64 * 512);
+            else
+                glReadPixels(0, pos * 64, 256, (end - pos) * 64,
+                             GL_RGBA, GL_UNSIGNED_SHORT_1_5_5_5_REV, &vram[pos * 64 * 512]);
 
             for (u32 j = pos * 64; j < end * 64; j++)
                 GPU.VRAMDirty[bank][j] = true;
@@ -949,6 +1100,12 @@ CaptureSyncResult GLRenderer::SyncVRAMCapture(
             pos += (end - pos);
             pos &= 3;
         }
+
+        if (data)
+        {
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        }
     }
     MarkCaptureCpuCoherent(
         bank, start, len,
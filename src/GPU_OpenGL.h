@@ -28,6 +28,18 @@
 namespace melonDS
 {
 
+// How VRAM capture syncs were served since the last Reset(). Finished
+// captures are read back into a pixel buffer at VBlank with a fence behind
+// them, so a sync normally only has to map a buffer the GPU already filled.
+struct CaptureReadbackStats
+{
+    u64 Issued = 0;         // speculative readbacks started at VBlank
+    u64 PreResolved = 0;    // syncs served from a readback that had completed
+    u64 Waited = 0;         // syncs that had to wait for a readback's fence
+    u64 Synchronous = 0;    // syncs with no readback, read back on the spot
+    u64 Unused = 0;         // readbacks dropped without serving a sync
+};
+
 class GLRenderer : public Renderer
 {
 public:
@@ -60,6 +72,16 @@ public:
     bool NeedsShaderCompile() override;
     void ShaderCompileStep(int& current, int& count) override;
 
+    [[nodiscard]] const CaptureReadbackStats& GetCaptureReadbackStats() const noexcept
+    {
+        return ReadbackStats;
+    }
+    // null with the compute shader renderer
+    [[nodiscard]] GLRenderer3D* GetGLRenderer3D() noexcept
+    {
+        return IsCompute ? nullptr : static_cast<GLRenderer3D*>(Rend3D.get());
+    }
+
 private:
     friend class GLRenderer2D;
     friend class GLRenderer3D;
@@ -136,6 +158,20 @@ private:
     GLuint CaptureSyncFB;
     GLuint CaptureSyncTex;
 
+    // downscaled copy of a capture layer, read back ahead of the sync
+    struct CaptureReadback
+    {
+        GLuint PBO = 0;
+        GLsync Fence = nullptr;
+        bool Valid = false;         // holds what the layer holds now
+        bool Used = false;
+    };
+    CaptureReadback Readback256[4];
+    CaptureReadback Readback128[16];
+    u32 CapturedLayers256;          // captured to since the last VBlank
+    u32 CapturedLayers128;
+    CaptureReadbackStats ReadbackStats;
+
     u16* AuxInputBuffer[2];
     u8 AuxUsageMask;
 
@@ -153,6 +189,10 @@ private:
     void RenderScreen(int ystart, int yend);
     void DoCapture(int ystart, int yend);
     void DownscaleCapture(int width, int height, int layer);
+    void IssueCaptureReadback(CaptureReadback& slot, int size, int layer);
+    void InvalidateCaptureReadback(CaptureReadback& slot);
+    void InvalidateCaptureReadbacks();
+    const u8* MapCaptureReadback(CaptureReadback& slot, u32 bytes);
 #if defined(MELONPRIME_ENABLE_DEVELOPER_FEATURES)
     void DumpFrameForValidation();
 #endif
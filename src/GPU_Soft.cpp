@@ -22,6 +22,7 @@
 #include <chrono>
 #include <cstring>
 #include "GPU2DFrameDump.h"
+#include "MelonPrimeTrace.h"
 #if defined(MELONPRIME_HAS_STRUCTURED_SOFT_2D)
 #include "MelonPrimeStructuredComposition.h"
 #endif
@@ -203,9 +204,60 @@ void SoftRenderer::RebuildAfterSavestateLoad(u32 vcount)
 
 void SoftRenderer::VBlank()
 {
+    if (Deferred2D && NativeGPU2DProducerForFrame)
+        ExecuteDeferredGPU2D();
+
     DumpGPU2DFrame(Framebuffer[BackBuffer][0], Framebuffer[BackBuffer][1]);
 }
 
+void SoftRenderer::ExecuteDeferredGPU2D()
+{
+    MelonPrimeTrace::Scope trace(MelonPrimeTrace::Category::GPU, "Render deferred 2D");
+    // DrawScanline() didn't take the 3D lines during the frame, so the render
+    // thread's line count has to be drained here either way
+    auto rend3d = dynamic_cast<SoftRenderer3D*>(Rend3D.get());
+    const u32* lines3D[192] = {};
+    if (rend3d)
+    {
+        for (int line = 0; line < 192; line++)
+            lines3D[line] = rend3d->GetRawLine(line);
+    }
+
+    if (!rend3d || !HasNativeGPU2DFrameForCurrentEmulatedFrame())
+    {
+        // nothing was drawn this frame: show the last one again
+        const size_t len = 256 * 192 * sizeof(u32);
+        memcpy(Framebuffer[BackBuffer][0], Framebuffer[BackBuffer ^ 1][0], len);
+        memcpy(Framebuffer[BackBuffer][1], Framebuffer[BackBuffer ^ 1][1], len);
+        RecordGPU2DRuntimeNativeUnavailableFallback();
+        return;
+    }
+
+    NativeGPU2DExecutor.Execute(GetNativeGPU2DFrame(), lines3D,
+                                Framebuffer[BackBuffer][0], Framebuffer[BackBuffer][1]);
+    for (int line = 0; line < 192; line++)
+    {
+        ExpandColor(&Framebuffer[BackBuffer][0][line * 256]);
+        ExpandColor(&Framebuffer[BackBuffer][1][line * 256]);
+    }
+
+    // captures the executor applied land in VRAM all at once. Frames that
+    // start with a capture armed are drawn inline instead (see
+    // CanUseNativeGPU2DForFrame), so this is normally empty.
+    static_assert(VRAMDirtyGranularity == 512);
+    for (const GPU2DNative::CpuCaptureWrite& write : NativeGPU2DExecutor.GetCaptureWrites())
+    {
+        memcpy(&GPU.VRAM[write.Bank][write.Offset],
+               NativeGPU2DExecutor.GetLCDCBank(write.Bank) + write.Offset, write.Length);
+        for (u32 granule = write.Offset / VRAMDirtyGranularity;
+             granule <= (write.Offset + write.Length - 1) / VRAMDirtyGranularity; granule++)
+        {
+            GPU.VRAMDirty[write.Bank][granule] = true;
+            GPU.RecordGPU2DWrite(GPU2DWriteKind::VRAM, write.Bank, granule);
+        }
+    }
+}
+
 void SoftRenderer::Stop()
 {
     // clear framebuffers to black
@@ -400,6 +452,7 @@ void SoftRenderer::SetRenderSettings(RendererSettings& settings)
 {
     auto rend3d = dynamic_cast<SoftRenderer3D*>(Rend3D.get());
     rend3d->SetThreaded(settings.Threaded);
+    Deferred2D = settings.Deferred2D;
 }
 
 
@@ -418,6 +471,7 @@ void SoftRenderer::DrawScanline(u32 line)
 #endif
         const bool nativeGPU2DReady = CanUseNativeGPU2DForFrame();
         const bool exactValidation = GPU2DNative::ExactValidationEnabled();
+        const bool wasNativeGPU2DProducer = NativeGPU2DProducerForFrame;
         SoftwareScreenFrame.fill(0u);
         NativeGPU2DProducerForFrame = nativeGPU2DReady
             && !exactValidation;
@@ -434,8 +488,10 @@ void SoftRenderer::DrawScanline(u32 line)
         // cache without the preceding VBlank (VCOUNT 262) that normally
         // prepares line 0. Rebuild it only for the exact native GPU2D oracle:
         // standalone Software remains an independent baseline path, while a
-        // native producer does not consume this CPU-side cache at all.
-        if (exactValidation && !NativeGPU2DProducerForFrame)
+        // native producer does not consume this CPU-side cache at all. A
+        // deferred 2D frame followed by a capture frame leaves it unprepared
+        // the same way.
+        if ((exactValidation || wasNativeGPU2DProducer) && !NativeGPU2DProducerForFrame)
         {
             Rend2D_A->DrawSprites(0u);
             Rend2D_B->DrawSprites(0u);
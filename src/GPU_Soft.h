@@ -21,6 +21,7 @@
 
 #include "GPU.h"
 #include "GPU2DNative.h"
+#include "GPU2DNativeCPU.h"
 #include "GPU2D_Soft.h"
 #include "GPU3D_Soft.h"
 
@@ -172,13 +173,25 @@ public:
         ++GPU2DFallbacks.structured_fallback;
     }
 
+    // Deferred 2D renders the frame's 2D lines from the native recorder at
+    // VBlank, across several threads, instead of one by one during the frame.
+    [[nodiscard]] bool UsesDeferred2D() const noexcept { return Deferred2D; }
+    void SetDeferred2DThreads(int threads) { NativeGPU2DExecutor.SetThreadCount(threads); }
+    [[nodiscard]] const GPU2DNative::CpuExecutorStats& GetDeferred2DStats() const noexcept
+    {
+        return NativeGPU2DExecutor.GetStats();
+    }
+
 protected:
     // Vulkan/DX12 override this only when their native GPU2D pipeline is
     // already usable for the next frame.  The default keeps Software and
-    // other SoftRenderer-derived backends on their existing raster path.
+    // other SoftRenderer-derived backends on their existing raster path,
+    // unless deferred 2D hands the recorded frame to the CPU executor.
+    // Frames with a display capture stay on the raster path even then: the
+    // game may read the captured lines back from VRAM before VBlank.
     [[nodiscard]] virtual bool CanUseNativeGPU2DForFrame() const noexcept
     {
-        return false;
+        return Deferred2D && !GPU.CaptureEnable;
     }
 
     [[nodiscard]] const u32* GetSoftwareCaptureSourceLine(bool source3D) const noexcept
@@ -236,6 +249,7 @@ private:
     friend class SoftRenderer3D;
 
     void ResetDerivedState(bool sessionReset) noexcept;
+    void ExecuteDeferredGPU2D();
 
     u32* Framebuffer[2][2];
 
@@ -249,6 +263,8 @@ private:
     u64 EmulatedFrameSerial = 0;
     u64 NativeGPU2DRecordedFrameSerial = 0;
     GPU2DFallbackCounters GPU2DFallbacks{};
+    GPU2DNative::CpuExecutor NativeGPU2DExecutor;
+    bool Deferred2D = false;
 
 #if defined(MELONPRIME_HAS_STRUCTURED_SOFT_2D)
     static constexpr std::size_t StructuredPixelCount = 256u * 192u;
@@ -0,0 +1,142 @@
+/*
+    Copyright 2016-2026 melonDS team
+
+    This file is part of melonDS.
+
+    melonDS is free software: you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the Free
+    Software Foundation, either version 3 of the License, or (at your option)
+    any later version.
+
+    melonDS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with melonDS. If not, see http://www.gnu.org/licenses/.
+*/
+
+#if !defined(_WIN32) && !defined(__SWITCH__) && !defined(__ANDROID__)
+#define VRAMALIAS_SHARED
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "GPU_VRAMAlias.h"
+#include "Platform.h"
+
+namespace melonDS
+{
+using Platform::Log;
+using Platform::LogLevel;
+
+VRAMAliasArena::VRAMAliasArena(const u32* banksizes, int numbanks, const u32* viewsizes, int numviews) noexcept
+{
+    NumBanks = numbanks;
+
+    u32 offset = 0;
+    int n = 0;
+    for (int i = 0; i < numbanks && n < kMaxRegions; i++, n++)
+    {
+        Offsets[n] = offset;
+        offset += banksizes[i];
+    }
+    for (int i = 0; i < numviews && n < kMaxRegions; i++, n++)
+    {
+        Offsets[n] = offset;
+        offset += viewsizes[i];
+    }
+    Offsets[n] = offset;
+    TotalSize = offset;
+
+#ifdef VRAMALIAS_SHARED
+    PageSize = sysconf(_SC_PAGESIZE);
+
+#if defined(__linux__) && defined(MFD_CLOEXEC)
+    MemoryFile = memfd_create("melondsvram", MFD_CLOEXEC);
+#else
+    char name[snprintf(NULL, 0, "/melondsvram%d-%p", getpid(), (void*)this) + 1];
+    snprintf(name, sizeof(name), "/melondsvram%d-%p", getpid(), (void*)this);
+    MemoryFile = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (MemoryFile >= 0)
+        shm_unlink(name);
+#endif
+
+    if (MemoryFile >= 0 && ftruncate(MemoryFile, TotalSize) == 0)
+    {
+        void* base = mmap(nullptr, TotalSize, PROT_READ | PROT_WRITE, MAP_SHARED, MemoryFile, 0);
+        if (base != MAP_FAILED)
+        {
+            Base = (u8*)base;
+            Shared = true;
+            return;
+        }
+    }
+
+    Log(LogLevel::Warn, "VRAM: couldn't set up shared memory (%s), flat VRAM views will be copied\n", strerror(errno));
+    if (MemoryFile >= 0)
+    {
+        close(MemoryFile);
+        MemoryFile = -1;
+    }
+#endif
+
+    // zeroed like the plain arrays this replaces
+    Base = (u8*)calloc(1, TotalSize);
+}
+
+VRAMAliasArena::~VRAMAliasArena() noexcept
+{
+#ifdef VRAMALIAS_SHARED
+    if (Shared)
+    {
+        munmap(Base, TotalSize);
+        close(MemoryFile);
+        return;
+    }
+#endif
+    free(Base);
+}
+
+bool VRAMAliasArena::CanAlias(u32 size) const noexcept
+{
+    return Shared && size && (size % PageSize) == 0;
+}
+
+bool VRAMAliasArena::MapAt(u8* dst, u32 fileoffset, u32 size) noexcept
+{
+#ifdef VRAMALIAS_SHARED
+    return mmap(dst, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, MemoryFile, fileoffset) != MAP_FAILED;
+#else
+    return false;
+#endif
+}
+
+bool VRAMAliasArena::Alias(int view, u32 offset, const u8* src, u32 size) noexcept
+{
+    if (!CanAlias(size) || (offset % PageSize) != 0)
+        return false;
+
+    // the source has to be page aligned and lie entirely within the banks
+    uintptr_t srcoffset = (uintptr_t)(src - Base);
+    if (src < Base || (srcoffset % PageSize) != 0 || srcoffset + size > Offsets[NumBanks])
+        return false;
+
+    return MapAt(View(view) + offset, (u32)srcoffset, size);
+}
+
+bool VRAMAliasArena::Unalias(int view, u32 offset, u32 size) noexcept
+{
+    if (!Shared)
+        return false;
+
+    return MapAt(View(view) + offset, Offsets[NumBanks + view] + offset, size);
+}
+
+}
@@ -0,0 +1,82 @@
+/*
+    Copyright 2016-2026 melonDS team
+
+    This file is part of melonDS.
+
+    melonDS is free software: you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the Free
+    Software Foundation, either version 3 of the License, or (at your option)
+    any later version.
+
+    melonDS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with melonDS. If not, see http://www.gnu.org/licenses/.
+*/
+
+#ifndef GPU_VRAMALIAS_H
+#define GPU_VRAMALIAS_H
+
+#include "types.h"
+
+namespace melonDS
+{
+
+// Backing memory for the VRAM banks and the flat (linear) VRAM views.
+//
+// Everything lives in one shared memory file, mapped once in order: the
+// banks, then each flat view over its own backing. A range of a flat view can
+// then be remapped onto the part of a bank it mirrors, the same way
+// ARMJIT_Memory maps fastmem, so that a slot served by a single bank needs
+// no copying at all; remapping it back to its own backing restores a plain
+// buffer for slots that mix several banks.
+//
+// Where shared memory isn't available (Windows, or pages larger than the
+// smallest slot) it's one ordinary allocation and aliasing always fails, so
+// callers fall back to copying.
+class VRAMAliasArena
+{
+public:
+    static constexpr int kMaxRegions = 24;
+
+    // sizes must be multiples of 8 KB
+    VRAMAliasArena(const u32* banksizes, int numbanks, const u32* viewsizes, int numviews) noexcept;
+    ~VRAMAliasArena() noexcept;
+    VRAMAliasArena(const VRAMAliasArena&) = delete;
+    VRAMAliasArena& operator=(const VRAMAliasArena&) = delete;
+
+    [[nodiscard]] u8* Bank(int num) const noexcept { return Base + Offsets[num]; }
+    [[nodiscard]] u8* View(int num) const noexcept { return Base + Offsets[NumBanks + num]; }
+
+    template <u32 Size>
+    [[nodiscard]] u8 (&BankArray(int num) const noexcept)[Size] { return *reinterpret_cast<u8(*)[Size]>(Bank(num)); }
+    template <u32 Size>
+    [[nodiscard]] u8 (&ViewArray(int num) const noexcept)[Size] { return *reinterpret_cast<u8(*)[Size]>(View(num)); }
+
+    // whether ranges of this size can be aliased at all
+    [[nodiscard]] bool CanAlias(u32 size) const noexcept;
+
+    // maps view[offset, offset+size) onto bank memory starting at 'src',
+    // which must point into one of the banks
+    bool Alias(int view, u32 offset, const u8* src, u32 size) noexcept;
+    // gives view[offset, offset+size) its own backing back; the contents are
+    // whatever was left there from before, so the caller has to refill it
+    bool Unalias(int view, u32 offset, u32 size) noexcept;
+
+private:
+    bool MapAt(u8* dst, u32 fileoffset, u32 size) noexcept;
+
+    u8* Base = nullptr;
+    u32 TotalSize = 0;
+    int NumBanks = 0;
+    u32 Offsets[kMaxRegions + 1] {};
+    u32 PageSize = 0;
+    int MemoryFile = -1;
+    bool Shared = false;
+};
+
+}
+
+#endif // GPU_VRAMALIAS_H
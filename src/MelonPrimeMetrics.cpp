@@ -0,0 +1,278 @@
+/*
+    Copyright 2016-2026 melonDS team
+
+    This file is part of melonDS.
+
+    melonDS is free software: you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the Free
+    Software Foundation, either version 3 of the License, or (at your option)
+    any later version.
+*/
+
+#include "MelonPrimeMetrics.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <new>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "Platform.h"
+
+namespace melonDS::MelonPrimeMetrics
+{
+
+using Platform::Log;
+using Platform::LogLevel;
+
+namespace
+{
+
+struct MetricInfo
+{
+    const char* Name;
+    const char* Unit;
+};
+
+constexpr MetricInfo Metrics[] = {
+    {"frame time", "us"},
+    {"input to RunFrame", "us"},
+    {"input to present", "us"},
+    {"audio fill", "samples"},
+};
+static_assert(std::size(Metrics) == (size_t)Metric::Count);
+
+// the mapping kept for Close(), written only by Open() and Close()
+void* WriterMapping = nullptr;
+
+// returns the address the file is mapped at, null on failure; on Windows
+// mapping is set to the mapping object's handle
+void* MapFile(const std::string& path, bool write, void*& mapping)
+{
+    mapping = nullptr;
+#if defined(_WIN32)
+    std::wstring wpath(path.begin(), path.end());
+    HANDLE file = CreateFileW(wpath.c_str(), write ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ,
+                              FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                              write ? CREATE_ALWAYS : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return nullptr;
+    LARGE_INTEGER size {};
+    if (!write && (!GetFileSizeEx(file, &size) || (u64)size.QuadPart < sizeof(Page)))
+    {
+        CloseHandle(file);
+        return nullptr;
+    }
+    HANDLE object = CreateFileMappingW(file, nullptr, write ? PAGE_READWRITE : PAGE_READONLY,
+                                       0, sizeof(Page), nullptr);
+    CloseHandle(file);
+    if (!object)
+        return nullptr;
+    void* view = MapViewOfFile(object, write ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, sizeof(Page));
+    if (!view)
+    {
+        CloseHandle(object);
+        return nullptr;
+    }
+    mapping = object;
+    return view;
+#else
+    int fd = open(path.c_str(), write ? O_RDWR | O_CREAT | O_TRUNC : O_RDONLY, 0644);
+    if (fd < 0)
+        return nullptr;
+    bool ok;
+    if (write)
+        ok = ftruncate(fd, sizeof(Page)) == 0;
+    else
+    {
+        off_t size = lseek(fd, 0, SEEK_END);
+        ok = size >= (off_t)sizeof(Page);
+    }
+    void* view = ok ? mmap(nullptr, sizeof(Page), write ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0)
+                    : MAP_FAILED;
+    close(fd);
+    return view == MAP_FAILED ? nullptr : view;
+#endif
+}
+
+void UnmapFile(const void* view, void* mapping)
+{
+#if defined(_WIN32)
+    UnmapViewOfFile(view);
+    CloseHandle(mapping);
+#else
+    (void)mapping;
+    munmap(const_cast<void*>(view), sizeof(Page));
+#endif
+}
+
+bool OpenFromEnvironment()
+{
+    const char* path = std::getenv("MELONPRIME_METRICS");
+    return path && path[0] && Open(path);
+}
+
+}
+
+namespace Detail
+{
+std::atomic<Page*> Shared = nullptr;
+}
+
+namespace
+{
+const bool OpenedFromEnvironment = OpenFromEnvironment();
+}
+
+bool Open(const std::string& path)
+{
+    Close();
+
+    void* mapping;
+    void* view = MapFile(path, true, mapping);
+    if (!view)
+    {
+        Log(LogLevel::Error, "Failed to map %s for metrics\n", path.c_str());
+        return false;
+    }
+
+    // the file was just truncated, so everything but the header is zero
+    Page* page = new (view) Page;
+    for (u32 i = 0; i < (u32)Metric::Count; i++)
+    {
+        Histogram& hist = page->Histograms[i];
+        strncpy(hist.Name, Metrics[i].Name, sizeof(hist.Name) - 1);
+        strncpy(hist.Unit, Metrics[i].Unit, sizeof(hist.Unit) - 1);
+    }
+    page->Version = Page::CurrentVersion;
+    page->HistogramCount = (u32)Metric::Count;
+    page->BucketCount = BucketCount;
+    page->SubBucketBits = SubBucketBits;
+#if defined(_WIN32)
+    page->ProcessID = GetCurrentProcessId();
+#else
+    page->ProcessID = (u64)getpid();
+#endif
+    // readers check the magic last
+    std::atomic_thread_fence(std::memory_order_release);
+    memcpy(page->Magic, Page::ExpectedMagic, sizeof(page->Magic));
+
+    WriterMapping = mapping;
+    Detail::Shared.store(page, std::memory_order_release);
+    Log(LogLevel::Info, "Recording metrics to %s\n", path.c_str());
+    return true;
+}
+
+void Close()
+{
+    // a producer may still be recording into the page it loaded, so the
+    // view stays mapped
+    Detail::Shared.store(nullptr, std::memory_order_release);
+#if defined(_WIN32)
+    if (WriterMapping)
+        CloseHandle(WriterMapping);
+#endif
+    WriterMapping = nullptr;
+}
+
+const char* MetricName(Metric metric) noexcept
+{
+    return metric < Metric::Count ? Metrics[(u32)metric].Name : "?";
+}
+
+u64 Snapshot::ValueAtPercentile(double percentile) const noexcept
+{
+    u64 total = 0;
+    for (u64 count : Buckets)
+        total += count;
+    if (!total)
+        return 0;
+
+    u64 rank = (u64)(percentile / 100.0 * (double)total + 0.5);
+    if (rank < 1)
+        rank = 1;
+    if (rank > total)
+        rank = total;
+
+    u64 seen = 0;
+    for (u32 i = 0; i < BucketCount; i++)
+    {
+        seen += Buckets[i];
+        if (seen >= rank)
+        {
+            const u64 value = BucketHighest(i);
+            return Max && value > Max ? Max : value;
+        }
+    }
+    return Max;
+}
+
+Snapshot Snapshot::Since(const Snapshot& earlier) const noexcept
+{
+    Snapshot diff;
+    diff.Count = Count - earlier.Count;
+    diff.Sum = Sum - earlier.Sum;
+    for (u32 i = 0; i < BucketCount; i++)
+    {
+        diff.Buckets[i] = Buckets[i] - earlier.Buckets[i];
+        if (diff.Buckets[i])
+            diff.Max = std::min(BucketHighest(i), Max);
+    }
+    return diff;
+}
+
+Reader::~Reader()
+{
+    if (Mapped)
+        UnmapFile(Mapped, Mapping);
+}
+
+bool Reader::Open(const std::string& path)
+{
+    if (Mapped)
+    {
+        UnmapFile(Mapped, Mapping);
+        Mapped = nullptr;
+    }
+
+    const void* view = MapFile(path, false, Mapping);
+    if (!view)
+        return false;
+    const Page* page = static_cast<const Page*>(view);
+    if (memcmp(page->Magic, Page::ExpectedMagic, sizeof(page->Magic)) != 0
+        || page->Version != Page::CurrentVersion
+        || page->HistogramCount != (u32)Metric::Count
+        || page->BucketCount != BucketCount)
+    {
+        UnmapFile(view, Mapping);
+        return false;
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    Mapped = page;
+    return true;
+}
+
+Snapshot Reader::Read(Metric metric) const noexcept
+{
+    Snapshot snap;
+    const Histogram& hist = Mapped->Histograms[(u32)metric];
+    snap.Count = hist.Count.load(std::memory_order_acquire);
+    snap.Sum = hist.Sum.load(std::memory_order_relaxed);
+    snap.Max = hist.Max.load(std::memory_order_relaxed);
+    for (u32 i = 0; i < BucketCount; i++)
+        snap.Buckets[i] = hist.Buckets[i].load(std::memory_order_relaxed);
+    return snap;
+}
+
+}
@@ -0,0 +1,176 @@
+/*
+    Copyright 2016-2026 melonDS team
+
+    Live latency histograms for long soak runs.
+
+    With MELONPRIME_METRICS set to a file path (/dev/shm/... on Linux), a few
+    HDR-style histograms are kept in a shared page mapped from that file.
+    Producer threads record into it with relaxed atomic adds, no lock and no
+    syscall; melonprime_metrics maps the same file read-only and prints
+    percentiles while the emulator runs. The counts are cumulative and the
+    file stays behind on exit, so the last numbers can still be read.
+
+    Frame time and the two input latencies are recorded by the Qt
+    frontend's emulation loop in MELONPRIME_DS builds, with or without the
+    developer perf probe; audio fill by any frontend build. Other builds
+    leave those histograms empty.
+
+    Buckets are log-linear: exact below 128, then 64 per power of two, which
+    keeps any value within 1.6% of the bucket it's reported as.
+*/
+
+#ifndef MELONPRIME_METRICS_H
+#define MELONPRIME_METRICS_H
+
+#include <array>
+#include <atomic>
+#include <string>
+
+#include "types.h"
+
+namespace melonDS::MelonPrimeMetrics
+{
+
+enum class Metric : u8
+{
+    FrameTime,          // us, one pass of the emulation loop, limiter included
+    InputToRunFrame,    // us, input sample to RunFrame
+    InputToPresent,     // us, input sample to the end of the present
+    AudioFill,          // samples left in the output buffer after a callback
+    Count
+};
+
+constexpr u32 SubBucketBits = 7;
+constexpr u32 SubBucketCount = 1 << SubBucketBits;
+constexpr u32 SubBucketHalf = SubBucketCount / 2;
+constexpr u64 MaxValue = 0xFFFFFFFF;   // larger values are clamped
+constexpr u32 BucketCount = SubBucketCount + (32 - SubBucketBits) * SubBucketHalf;
+
+[[nodiscard]] inline u32 BucketIndex(u64 value) noexcept
+{
+    if (value > MaxValue)
+        value = MaxValue;
+    if (value < SubBucketCount)
+        return (u32)value;
+    const u32 shift = (63 - __builtin_clzll(value)) - (SubBucketBits - 1);
+    return SubBucketCount + (shift - 1) * SubBucketHalf + (u32)(value >> shift) - SubBucketHalf;
+}
+
+[[nodiscard]] inline u64 BucketLowest(u32 index) noexcept
+{
+    if (index < SubBucketCount)
+        return index;
+    const u32 shift = (index - SubBucketCount) / SubBucketHalf + 1;
+    return (u64)((index - SubBucketCount) % SubBucketHalf + SubBucketHalf) << shift;
+}
+
+[[nodiscard]] inline u64 BucketHighest(u32 index) noexcept
+{
+    if (index < SubBucketCount)
+        return index;
+    const u32 shift = (index - SubBucketCount) / SubBucketHalf + 1;
+    return BucketLowest(index) + ((u64)1 << shift) - 1;
+}
+
+static_assert(std::atomic<u64>::is_always_lock_free, "the shared page needs address-free atomics");
+
+// One histogram in the shared page
+struct Histogram
+{
+    char Name[24];
+    char Unit[8];
+    std::atomic<u64> Count;
+    std::atomic<u64> Sum;
+    std::atomic<u64> Max;
+    std::atomic<u64> Buckets[BucketCount];
+
+    void Record(u64 value) noexcept
+    {
+        if (value > MaxValue)
+            value = MaxValue;
+        Buckets[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+        Sum.fetch_add(value, std::memory_order_relaxed);
+        u64 max = Max.load(std::memory_order_relaxed);
+        while (value > max && !Max.compare_exchange_weak(max, value, std::memory_order_relaxed)) {}
+        Count.fetch_add(1, std::memory_order_release);
+    }
+};
+
+struct Page
+{
+    char Magic[8];
+    u32 Version;
+    u32 HistogramCount;
+    u32 BucketCount;
+    u32 SubBucketBits;
+    u64 ProcessID;
+    Histogram Histograms[(u32)Metric::Count];
+
+    static constexpr char ExpectedMagic[8] = {'M', 'P', 'M', 'E', 'T', 'R', 'I', 'C'};
+    static constexpr u32 CurrentVersion = 1;
+};
+
+// A histogram's counts copied out of the page
+struct Snapshot
+{
+    u64 Count = 0;
+    u64 Sum = 0;
+    u64 Max = 0;
+    std::array<u64, BucketCount> Buckets {};
+
+    // the highest value in the bucket holding the given percentile (0-100),
+    // 0 if nothing was recorded
+    [[nodiscard]] u64 ValueAtPercentile(double percentile) const noexcept;
+    [[nodiscard]] double Mean() const noexcept { return Count ? (double)Sum / Count : 0; }
+
+    // what was recorded since an earlier snapshot; Max becomes the top of
+    // the highest bucket that got anything
+    [[nodiscard]] Snapshot Since(const Snapshot& earlier) const noexcept;
+};
+
+namespace Detail
+{
+extern std::atomic<Page*> Shared;
+}
+
+[[nodiscard]] inline bool IsEnabled() noexcept
+{
+    return Detail::Shared.load(std::memory_order_relaxed) != nullptr;
+}
+
+inline void Record(Metric metric, u64 value) noexcept
+{
+    if (Page* page = Detail::Shared.load(std::memory_order_relaxed))
+        page->Histograms[(u32)metric].Record(value);
+}
+
+// Creates (or empties) the page at path and records into it from now on
+bool Open(const std::string& path);
+// Stops recording. The file is left as it is.
+void Close();
+
+[[nodiscard]] const char* MetricName(Metric metric) noexcept;
+
+// Maps a page another process (or this one) records into, read-only
+class Reader
+{
+public:
+    Reader() = default;
+    ~Reader();
+    Reader(const Reader&) = delete;
+    Reader& operator=(const Reader&) = delete;
+
+    // false if the file doesn't exist or isn't a page this build can read
+    bool Open(const std::string& path);
+    [[nodiscard]] bool IsOpen() const noexcept { return Mapped != nullptr; }
+    [[nodiscard]] const Page& GetPage() const noexcept { return *Mapped; }
+    [[nodiscard]] Snapshot Read(Metric metric) const noexcept;
+
+private:
+    const Page* Mapped = nullptr;
+    void* Mapping = nullptr;
+};
+
+}
+
+#endif // MELONPRIME_METRICS_H
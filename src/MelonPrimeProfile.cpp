@@ -0,0 +1,390 @@
+/*
+    Copyright 2016-2026 melonDS team
+
+    This file is part of melonDS.
+
+    melonDS is free software: you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the Free
+    Software Foundation, either version 3 of the License, or (at your option)
+    any later version.
+*/
+
+#include "MelonPrimeProfile.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "Platform.h"
+
+namespace melonDS::MelonPrimeProfile
+{
+
+using Platform::Log;
+using Platform::LogLevel;
+
+namespace
+{
+
+constexpr u32 InitialSlots = 1 << 12;
+// blocks listed per CPU, the rest are summed up in one line
+constexpr size_t ReportedBlocks = 1000;
+
+// Only the owning thread writes a slot. The report reads the counts while
+// it may still be counting, so they're atomics, but keys are only added
+// and the table only grows with the lock held.
+struct Slot
+{
+    u32 Key = 0;    // the block address | 1, 0 if free
+    std::atomic<bool> Idle = false;
+    std::atomic<u64> Entries = 0;
+    std::atomic<u64> Cycles = 0;
+};
+
+inline void Add(std::atomic<u64>& counter, u64 value) noexcept
+{
+    // single writer, no need for a locked add
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+struct BlockTable
+{
+    std::unique_ptr<Slot[]> Slots = std::make_unique<Slot[]>(InitialSlots);
+    u32 Size = InitialSlots;
+    u32 Used = 0;
+
+    static u32 Hash(u32 key) noexcept { return (key * 0x9E3779B1u) >> 7; }
+
+    Slot* Lookup(u32 key) const noexcept
+    {
+        for (u32 i = Hash(key) & (Size - 1);; i = (i + 1) & (Size - 1))
+        {
+            Slot& slot = Slots[i];
+            if (slot.Key == key || !slot.Key)
+                return &slot;
+        }
+    }
+
+    // with the lock held
+    Slot* Insert(u32 key)
+    {
+        if ((Used + 1) * 2 > Size)
+        {
+            std::unique_ptr<Slot[]> old = std::move(Slots);
+            const u32 oldSize = Size;
+            Size *= 2;
+            Slots = std::make_unique<Slot[]>(Size);
+            for (u32 i = 0; i < oldSize; i++)
+            {
+                if (!old[i].Key)
+                    continue;
+                Slot* slot = Lookup(old[i].Key);
+                slot->Key = old[i].Key;
+                slot->Idle.store(old[i].Idle.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                slot->Entries.store(old[i].Entries.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                slot->Cycles.store(old[i].Cycles.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            }
+        }
+        Slot* slot = Lookup(key);
+        slot->Key = key;
+        Used++;
+        return slot;
+    }
+
+    void Clear()
+    {
+        Slots = std::make_unique<Slot[]>(InitialSlots);
+        Size = InitialSlots;
+        Used = 0;
+    }
+};
+
+struct ThreadProfile
+{
+    std::mutex Lock;
+    BlockTable Tables[2];
+    std::atomic<u64> Frames = 0;
+    u32 Generation = 0;
+};
+
+struct Registry
+{
+    std::mutex Lock;
+    std::vector<std::unique_ptr<ThreadProfile>> Profiles;
+    std::atomic<u32> Generation = 1;
+    std::string Path;
+    SymbolMap Symbols;
+};
+
+Registry& Reg()
+{
+    static Registry* reg = []
+    {
+        auto* r = new Registry();
+        // writes a profile still running at exit; the registry is never
+        // destroyed, as threads outliving static destruction may still count
+        std::atexit([] { Stop(); });
+        return r;
+    }();
+    return *reg;
+}
+
+thread_local ThreadProfile* Local = nullptr;
+
+ThreadProfile* RegisterThread()
+{
+    Registry& reg = Reg();
+    std::lock_guard<std::mutex> guard(reg.Lock);
+    reg.Profiles.push_back(std::make_unique<ThreadProfile>());
+    Local = reg.Profiles.back().get();
+    return Local;
+}
+
+// the calling thread's profile, emptied if it still has an earlier one's counts
+ThreadProfile* Current() noexcept
+{
+    ThreadProfile* profile = Local ? Local : RegisterThread();
+    const u32 generation = Reg().Generation.load(std::memory_order_acquire);
+    if (profile->Generation != generation)
+    {
+        std::lock_guard<std::mutex> guard(profile->Lock);
+        profile->Tables[0].Clear();
+        profile->Tables[1].Clear();
+        profile->Frames.store(0, std::memory_order_relaxed);
+        profile->Generation = generation;
+    }
+    return profile;
+}
+
+bool WriteReport(const std::string& path, const Report& report, const SymbolMap& symbols)
+{
+    FILE* file = fopen(path.c_str(), "w");
+    if (!file)
+        return false;
+
+    fprintf(file, "JIT block profile, %llu frames\n", (unsigned long long)report.Frames);
+    const double frames = report.Frames ? (double)report.Frames : 1.0;
+    for (u32 cpu = 0; cpu < 2; cpu++)
+    {
+        const std::vector<BlockStats>& blocks = report.Blocks[cpu];
+        u64 total = 0;
+        for (const BlockStats& block : blocks)
+            total += block.Cycles;
+
+        fprintf(file, "\n%s: %zu blocks, %llu cycles (%s clock), %.1f per frame\n", cpu ? "ARM7" : "ARM9",
+                blocks.size(), (unsigned long long)total, cpu ? "ARM7" : "ARM9", total / frames);
+        fprintf(file, "  cycles     cum  cycles/frame  entries/frame     block  idle  symbol\n");
+
+        u64 cumulative = 0;
+        for (size_t i = 0; i < blocks.size() && i < ReportedBlocks; i++)
+        {
+            const BlockStats& block = blocks[i];
+            cumulative += block.Cycles;
+            fprintf(file, "%7.2f%% %6.2f%%  %12.1f  %13.1f  %08X  %4s  %s\n",
+                    total ? 100.0 * block.Cycles / total : 0.0, total ? 100.0 * cumulative / total : 0.0,
+                    block.Cycles / frames, block.Entries / frames, block.Addr, block.Idle ? "idle" : "",
+                    symbols.Describe(block.Addr).c_str());
+        }
+        if (blocks.size() > ReportedBlocks)
+        {
+            fprintf(file, "%7.2f%% in %zu more blocks\n", total ? 100.0 * (total - cumulative) / total : 0.0,
+                    blocks.size() - ReportedBlocks);
+        }
+    }
+
+    const bool ok = !ferror(file);
+    return fclose(file) == 0 && ok;
+}
+
+bool StartFromEnvironment()
+{
+    const char* path = std::getenv("MELONPRIME_PROFILE");
+    const char* symbols = std::getenv("MELONPRIME_PROFILE_SYMBOLS");
+    return path && path[0] && Start(path, symbols ? symbols : "");
+}
+
+}
+
+namespace Detail
+{
+
+std::atomic<bool> Active = false;
+
+void Record(u32 cpu, u32 addr, u64 cycles, bool idle) noexcept
+{
+    ThreadProfile* profile = Current();
+    BlockTable& table = profile->Tables[cpu];
+    const u32 key = addr | 1;
+    Slot* slot = table.Lookup(key);
+    if (!slot->Key)
+    {
+        std::lock_guard<std::mutex> guard(profile->Lock);
+        slot = table.Insert(key);
+    }
+    Add(slot->Entries, 1);
+    Add(slot->Cycles, cycles);
+    if (idle)
+        slot->Idle.store(true, std::memory_order_relaxed);
+}
+
+void FrameDone() noexcept
+{
+    Add(Current()->Frames, 1);
+}
+
+}
+
+namespace
+{
+const bool StartedFromEnvironment = StartFromEnvironment();
+}
+
+bool Start(const std::string& path, const std::string& symbolsPath)
+{
+    Registry& reg = Reg();
+    {
+        std::lock_guard<std::mutex> guard(reg.Lock);
+        reg.Path = path;
+        reg.Symbols = SymbolMap();
+        if (!symbolsPath.empty())
+        {
+            if (reg.Symbols.Load(symbolsPath))
+                Log(LogLevel::Info, "Loaded %zu symbols from %s\n", reg.Symbols.Size(), symbolsPath.c_str());
+            else
+                Log(LogLevel::Warn, "Couldn't read symbols from %s\n", symbolsPath.c_str());
+        }
+        // every thread empties its table before it counts again
+        reg.Generation.fetch_add(1, std::memory_order_release);
+    }
+    Detail::Active.store(true, std::memory_order_release);
+    Log(LogLevel::Info, "Profiling JIT blocks to %s\n", path.c_str());
+    return true;
+}
+
+bool Stop()
+{
+    if (!Detail::Active.exchange(false, std::memory_order_acq_rel))
+        return false;
+
+    Registry& reg = Reg();
+    const Report report = GetReport();
+    std::lock_guard<std::mutex> guard(reg.Lock);
+    if (!WriteReport(reg.Path, report, reg.Symbols))
+    {
+        Log(LogLevel::Error, "Failed to write the profile to %s\n", reg.Path.c_str());
+        return false;
+    }
+    Log(LogLevel::Info, "Wrote the JIT block profile to %s\n", reg.Path.c_str());
+    return true;
+}
+
+Report GetReport()
+{
+    Registry& reg = Reg();
+    std::lock_guard<std::mutex> guard(reg.Lock);
+    const u32 generation = reg.Generation.load(std::memory_order_acquire);
+
+    Report report;
+    std::unordered_map<u32, size_t> index[2];
+    for (const std::unique_ptr<ThreadProfile>& profile : reg.Profiles)
+    {
+        std::lock_guard<std::mutex> profileGuard(profile->Lock);
+        if (profile->Generation != generation)
+            continue;
+
+        report.Frames += profile->Frames.load(std::memory_order_relaxed);
+        for (u32 cpu = 0; cpu < 2; cpu++)
+        {
+            const BlockTable& table = profile->Tables[cpu];
+            for (u32 i = 0; i < table.Size; i++)
+            {
+                const Slot& slot = table.Slots[i];
+                if (!slot.Key)
+                    continue;
+                auto [it, added] = index[cpu].emplace(slot.Key, report.Blocks[cpu].size());
+                if (added)
+                    report.Blocks[cpu].push_back({slot.Key & ~1u, false, 0, 0});
+                BlockStats& block = report.Blocks[cpu][it->second];
+                block.Idle |= slot.Idle.load(std::memory_order_relaxed);
+                block.Entries += slot.Entries.load(std::memory_order_relaxed);
+                block.Cycles += slot.Cycles.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    for (std::vector<BlockStats>& blocks : report.Blocks)
+    {
+        std::sort(blocks.begin(), blocks.end(), [](const BlockStats& a, const BlockStats& b)
+        {
+            return a.Cycles != b.Cycles ? a.Cycles > b.Cycles : a.Addr < b.Addr;
+        });
+    }
+    return report;
+}
+
+bool SymbolMap::Load(const std::string& path)
+{
+    std::ifstream file(path);
+    if (!file)
+        return false;
+
+    Symbols.clear();
+    std::string line;
+    while (std::getline(file, line))
+    {
+        const size_t start = line.find_first_not_of(" \t");
+        if (start == std::string::npos || line[start] == '#' || line.compare(start, 2, "//") == 0)
+            continue;
+
+        const char* text = line.c_str() + start;
+        char* end;
+        std::string name;
+        u32 addr;
+        if (const char* equals = strchr(text, '='))
+        {
+            // name = 0x02001234;
+            addr = (u32)strtoul(equals + 1, &end, 16);
+            if (end == equals + 1)
+                continue;
+            name.assign(text, equals - text);
+        }
+        else
+        {
+            // 02001234 name
+            addr = (u32)strtoul(text, &end, 16);
+            if (end == text || (*end != ' ' && *end != '\t'))
+                continue;
+            name = end;
+        }
+
+        const size_t first = name.find_first_not_of(" \t");
+        const size_t last = name.find_last_not_of(" \t\r");
+        if (first == std::string::npos)
+            continue;
+        Symbols.emplace_back(addr, name.substr(first, last - first + 1));
+    }
+
+    std::stable_sort(Symbols.begin(), Symbols.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+    return true;
+}
+
+std::string SymbolMap::Describe(u32 addr) const
+{
+    auto it = std::upper_bound(Symbols.begin(), Symbols.end(), addr,
+                               [](u32 value, const auto& symbol) { return value < symbol.first; });
+    if (it == Symbols.begin())
+        return {};
+    --it;
+    if (it->first == addr)
+        return it->second;
+    char offset[16];
+    snprintf(offset, sizeof(offset), "+0x%x", addr - it->first);
+    return it->second + offset;
+}
+
+}
@@ -0,0 +1,100 @@
+/*
+    Copyright 2016-2026 melonDS team
+
+    Opt-in profile of the guest code the JIT runs.
+
+    With MELONPRIME_PROFILE set to a file path, the dispatcher counts every
+    JIT block it enters and the cycles the block took, per CPU and block
+    start address, along with whether the block ended as a detected idle
+    loop. A report sorted by cycles is written when the process exits, or
+    on Stop(). With MELONPRIME_PROFILE_SYMBOLS set to a map file, blocks are
+    named after the nearest symbol at or below them.
+
+    Every thread counts into a table of its own, so several instances can
+    be profiled at once; the report adds them up. Profiling off, a block
+    entry costs one relaxed load and a branch. The interpreter isn't
+    profiled.
+*/
+
+#ifndef MELONPRIME_PROFILE_H
+#define MELONPRIME_PROFILE_H
+
+#include <atomic>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "types.h"
+
+namespace melonDS::MelonPrimeProfile
+{
+
+struct BlockStats
+{
+    u32 Addr;
+    bool Idle;      // ended as an idle loop at least once
+    u64 Entries;
+    u64 Cycles;     // in the CPU's own clock
+};
+
+struct Report
+{
+    u64 Frames = 0;
+    std::vector<BlockStats> Blocks[2];  // ARM9, ARM7; most cycles first
+};
+
+namespace Detail
+{
+extern std::atomic<bool> Active;
+void Record(u32 cpu, u32 addr, u64 cycles, bool idle) noexcept;
+void FrameDone() noexcept;
+}
+
+[[nodiscard]] inline bool IsEnabled() noexcept
+{
+    return Detail::Active.load(std::memory_order_relaxed);
+}
+
+// a block entry of the given CPU (0 for the ARM9), for callers that
+// checked IsEnabled()
+inline void Record(u32 cpu, u32 addr, u64 cycles, bool idle) noexcept
+{
+    Detail::Record(cpu, addr, cycles, idle);
+}
+
+inline void FrameDone() noexcept
+{
+    if (IsEnabled())
+        Detail::FrameDone();
+}
+
+// Begins a profile, dropping the counts of a previous one. The report is
+// written to path by Stop(), or when the process exits, with the symbols
+// of the map file if one is given.
+bool Start(const std::string& path, const std::string& symbolsPath = {});
+// Stops counting and writes the report. False if nothing was profiling or
+// the file couldn't be written. Counts from threads still emulating may
+// be a block behind.
+bool Stop();
+// the counts so far, of the running profile or the last one
+[[nodiscard]] Report GetReport();
+
+// Symbols from a map file, one per line as "02001234 name" (no$gba .sym
+// style) or "name = 0x02001234;" (linker script style). Empty lines and
+// lines starting with # or // are skipped.
+class SymbolMap
+{
+public:
+    bool Load(const std::string& path);
+    [[nodiscard]] size_t Size() const noexcept { return Symbols.size(); }
+    // "name" or "name+0x1c" for the nearest symbol at or below addr, empty
+    // if there is none
+    [[nodiscard]] std::string Describe(u32 addr) const;
+
+private:
+    std::vector<std::pair<u32, std::string>> Symbols;
+};
+
+}
+
+#endif // MELONPRIME_PROFILE_H
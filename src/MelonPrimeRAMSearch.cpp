@@ -0,0 +1,298 @@
+/*
+    Copyright 2016-2026 melonDS team
+
+    This file is part of melonDS.
+
+    melonDS is free software: you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the Free
+    Software Foundation, either version 3 of the License, or (at your option)
+    any later version.
+*/
+
+#include "MelonPrimeRAMSearch.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <thread>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RAMSEARCH_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace melonDS::MelonPrimeRAMSearch
+{
+
+namespace
+{
+
+constexpr bool UsesPrevious(Compare cmp) noexcept
+{
+    return !NeedsValue(cmp);
+}
+
+// these are computed as the opposite compare, then inverted
+constexpr bool Inverted(Compare cmp) noexcept
+{
+    return cmp == Compare::NotEqualTo || cmp == Compare::Changed;
+}
+
+template <Compare Cmp, typename T>
+inline bool Holds(T now, T prev, T value) noexcept
+{
+    if constexpr (Cmp == Compare::EqualTo) return now == value;
+    if constexpr (Cmp == Compare::NotEqualTo) return now != value;
+    if constexpr (Cmp == Compare::Changed) return now != prev;
+    if constexpr (Cmp == Compare::Unchanged) return now == prev;
+    if constexpr (Cmp == Compare::Increased) return now > prev;
+    if constexpr (Cmp == Compare::Decreased) return now < prev;
+    return false;
+}
+
+#if defined(RAMSEARCH_SSE2)
+
+template <typename T>
+inline __m128i Splat(T value) noexcept
+{
+    if constexpr (sizeof(T) == 1) return _mm_set1_epi8(value);
+    else if constexpr (sizeof(T) == 2) return _mm_set1_epi16(value);
+    else return _mm_set1_epi32(value);
+}
+
+template <typename T>
+inline __m128i Equal(__m128i a, __m128i b) noexcept
+{
+    if constexpr (sizeof(T) == 1) return _mm_cmpeq_epi8(a, b);
+    else if constexpr (sizeof(T) == 2) return _mm_cmpeq_epi16(a, b);
+    else return _mm_cmpeq_epi32(a, b);
+}
+
+template <typename T>
+inline __m128i Greater(__m128i a, __m128i b) noexcept
+{
+    if constexpr (sizeof(T) == 1) return _mm_cmpgt_epi8(a, b);
+    else if constexpr (sizeof(T) == 2) return _mm_cmpgt_epi16(a, b);
+    else return _mm_cmpgt_epi32(a, b);
+}
+
+// one bit per value for the 16 values at now, before inverting
+template <typename T, Compare Cmp>
+inline u32 Match16(const u8* now, const u8* prev, __m128i value) noexcept
+{
+    __m128i c[sizeof(T)];
+    for (u32 i = 0; i < sizeof(T); i++)
+    {
+        const __m128i n = _mm_loadu_si128((const __m128i*)(now + i * 16));
+        const __m128i p = UsesPrevious(Cmp) ? _mm_loadu_si128((const __m128i*)(prev + i * 16)) : value;
+        if constexpr (Cmp == Compare::Increased)
+            c[i] = Greater<T>(n, p);
+        else if constexpr (Cmp == Compare::Decreased)
+            c[i] = Greater<T>(p, n);
+        else
+            c[i] = Equal<T>(n, p);
+    }
+
+    // the compares give 0 or -1 per lane, which packing keeps as they are
+    __m128i bytes;
+    if constexpr (sizeof(T) == 1)
+        bytes = c[0];
+    else if constexpr (sizeof(T) == 2)
+        bytes = _mm_packs_epi16(c[0], c[1]);
+    else
+        bytes = _mm_packs_epi16(_mm_packs_epi32(c[0], c[1]), _mm_packs_epi32(c[2], c[3]));
+    return (u32)_mm_movemask_epi8(bytes);
+}
+
+template <typename T, Compare Cmp>
+inline u64 MatchWord(const u8* now, const u8* prev, T value) noexcept
+{
+    const __m128i splat = Splat<T>(value);
+    u64 mask = 0;
+    for (u32 i = 0; i < 4; i++)
+        mask |= (u64)Match16<T, Cmp>(now + i * 16 * sizeof(T), prev + i * 16 * sizeof(T), splat) << (i * 16);
+    return Inverted(Cmp) ? ~mask : mask;
+}
+
+#else
+
+template <typename T, Compare Cmp>
+inline u64 MatchWord(const u8* now, const u8* prev, T value) noexcept
+{
+    const T* n = (const T*)now;
+    const T* p = (const T*)prev;
+    u64 mask = 0;
+    for (u32 i = 0; i < 64; i++)
+        mask |= (u64)Holds<Cmp>(n[i], p[i], value) << i;
+    return mask;
+}
+
+#endif
+
+}
+
+const char* CompareName(Compare cmp) noexcept
+{
+    switch (cmp)
+    {
+    case Compare::EqualTo: return "Equal to";
+    case Compare::NotEqualTo: return "Not equal to";
+    case Compare::Changed: return "Changed";
+    case Compare::Unchanged: return "Unchanged";
+    case Compare::Increased: return "Increased";
+    case Compare::Decreased: return "Decreased";
+    default: return "?";
+    }
+}
+
+Search::Search(int threads)
+{
+    if (threads <= 0)
+    {
+        // the emu thread, the 3D render thread and the GUI thread are busy
+        // already; a few helpers are plenty for a memory bound job
+        int hw = (int)std::thread::hardware_concurrency();
+        threads = std::clamp(hw - 2, 1, 4);
+    }
+    Threads = threads;
+}
+
+void Search::Start(const u8* ram, u32 size, u32 width)
+{
+    assert(width == 1 || width == 2 || width == 4);
+    assert(size % (64 * 4) == 0);
+
+    Width = width;
+    Previous.assign(ram, ram + size);
+    Bits.assign(size / width / 64, ~(u64)0);
+    Recount();
+}
+
+void Search::Clear()
+{
+    Width = 0;
+    Count = 0;
+    Previous.clear();
+    Previous.shrink_to_fit();
+    Bits.clear();
+    BlockStart.clear();
+}
+
+template <typename T, Compare Cmp>
+void Search::RefineWords(const u8* ram, s32 value, u32 first, u32 last) noexcept
+{
+    constexpr u32 wordBytes = 64 * sizeof(T);
+    for (u32 w = first; w < last; w++)
+    {
+        u64 bits = Bits[w];
+        if (!bits)
+            continue;
+
+        const u8* now = ram + w * wordBytes;
+        u8* prev = &Previous[w * wordBytes];
+        bits &= MatchWord<T, Cmp>(now, prev, (T)value);
+        Bits[w] = bits;
+
+        // values out of the set never get compared again, so only the ones
+        // still in it need the new copy
+        if (bits)
+            memcpy(prev, now, wordBytes);
+    }
+}
+
+template <typename T>
+void Search::RefineWords(const u8* ram, Compare cmp, s32 value, u32 first, u32 last) noexcept
+{
+    switch (cmp)
+    {
+    case Compare::EqualTo: RefineWords<T, Compare::EqualTo>(ram, value, first, last); break;
+    case Compare::NotEqualTo: RefineWords<T, Compare::NotEqualTo>(ram, value, first, last); break;
+    case Compare::Changed: RefineWords<T, Compare::Changed>(ram, value, first, last); break;
+    case Compare::Unchanged: RefineWords<T, Compare::Unchanged>(ram, value, first, last); break;
+    case Compare::Increased: RefineWords<T, Compare::Increased>(ram, value, first, last); break;
+    case Compare::Decreased: RefineWords<T, Compare::Decreased>(ram, value, first, last); break;
+    default: break;
+    }
+}
+
+u32 Search::Refine(const u8* ram, u32 size, Compare cmp, s32 value)
+{
+    if (!Width)
+        return 0;
+    if (size != Previous.size())
+    {
+        Clear();
+        return 0;
+    }
+
+    auto refine = [&](u32 first, u32 last)
+    {
+        if (Width == 1) RefineWords<s8>(ram, cmp, value, first, last);
+        else if (Width == 2) RefineWords<s16>(ram, cmp, value, first, last);
+        else RefineWords<s32>(ram, cmp, value, first, last);
+    };
+
+    const u32 words = (u32)Bits.size();
+    const u32 threads = Count >= ParallelMinimum ? (u32)Threads : 1;
+    const u32 perThread = (words + threads - 1) / threads;
+
+    std::vector<std::thread> helpers;
+    for (u32 i = 1; i < threads; i++)
+    {
+        const u32 first = std::min(i * perThread, words);
+        helpers.emplace_back(refine, first, std::min(first + perThread, words));
+    }
+    refine(0, std::min(perThread, words));
+    for (std::thread& helper : helpers)
+        helper.join();
+
+    Recount();
+    return Count;
+}
+
+void Search::Recount() noexcept
+{
+    BlockStart.resize((Bits.size() + BlockWords - 1) / BlockWords);
+    u32 total = 0;
+    for (u32 w = 0; w < Bits.size(); w++)
+    {
+        if (w % BlockWords == 0)
+            BlockStart[w / BlockWords] = total;
+        total += (u32)__builtin_popcountll(Bits[w]);
+    }
+    Count = total;
+}
+
+u32 Search::GetOffset(u32 index) const noexcept
+{
+    // the last block starting at or before index
+    const u32 block = (u32)(std::upper_bound(BlockStart.begin(), BlockStart.end(), index) - BlockStart.begin()) - 1;
+    u32 left = index - BlockStart[block];
+    for (u32 w = block * BlockWords; w < Bits.size(); w++)
+    {
+        u64 bits = Bits[w];
+        const u32 count = (u32)__builtin_popcountll(bits);
+        if (left < count)
+        {
+            while (left--)
+                bits &= bits - 1;
+            return (w * 64 + (u32)__builtin_ctzll(bits)) * Width;
+        }
+        left -= count;
+    }
+    return 0;
+}
+
+s32 Search::GetPrevious(u32 offset) const noexcept
+{
+    const u8* p = &Previous[offset];
+    switch (Width)
+    {
+    case 1: return *(const s8*)p;
+    case 2: return *(const s16*)p;
+    case 4: return *(const s32*)p;
+    default: return 0;
+    }
+}
+
+}
@@ -0,0 +1,87 @@
+/*
+    Copyright 2016-2026 melonDS team
+
+    Main RAM search, for hunting game addresses.
+
+    The candidates are a bitmap with one bit per aligned value. A refine
+    compares a new copy of main RAM against the previous one (or against a
+    value) 16 bytes at a time, split across a few threads, and only looks
+    at the bitmap words that still have candidates, so refines get cheaper
+    as the set shrinks. The caller takes the copies; the frontend takes
+    them on the emu thread between two frames.
+*/
+
+#ifndef MELONPRIME_RAMSEARCH_H
+#define MELONPRIME_RAMSEARCH_H
+
+#include <vector>
+
+#include "types.h"
+
+namespace melonDS::MelonPrimeRAMSearch
+{
+
+enum class Compare : u8
+{
+    EqualTo,        // the value given
+    NotEqualTo,
+    Changed,        // since the previous copy
+    Unchanged,
+    Increased,      // signed, like the values are shown
+    Decreased,
+    Count
+};
+
+[[nodiscard]] const char* CompareName(Compare cmp) noexcept;
+[[nodiscard]] constexpr bool NeedsValue(Compare cmp) noexcept
+{
+    return cmp == Compare::EqualTo || cmp == Compare::NotEqualTo;
+}
+
+class Search
+{
+public:
+    // threads <= 0 picks a few from the hardware
+    explicit Search(int threads = 0);
+
+    // every aligned value of the given width (1, 2 or 4 bytes) becomes a
+    // candidate, and ram the previous copy. size has to be a multiple of 256
+    void Start(const u8* ram, u32 size, u32 width);
+    // keeps the candidates for which cmp holds and makes ram the previous
+    // copy; returns how many are left. A copy of another size than the
+    // first one (DS and DSi main RAM differ) clears the search instead
+    u32 Refine(const u8* ram, u32 size, Compare cmp, s32 value = 0);
+    void Clear();
+
+    [[nodiscard]] bool IsStarted() const noexcept { return Width != 0; }
+    [[nodiscard]] u32 GetWidth() const noexcept { return Width; }
+    [[nodiscard]] u32 GetSize() const noexcept { return (u32)Previous.size(); }
+    [[nodiscard]] u32 GetCount() const noexcept { return Count; }
+    // byte offset of the index-th candidate in address order, index < GetCount()
+    [[nodiscard]] u32 GetOffset(u32 index) const noexcept;
+    // the candidate at offset as it was in the previous copy, sign extended
+    [[nodiscard]] s32 GetPrevious(u32 offset) const noexcept;
+
+private:
+    // candidates before each run of BlockWords bitmap words, for GetOffset
+    static constexpr u32 BlockWords = 64;
+    // fewer candidates than this aren't worth starting threads for
+    static constexpr u32 ParallelMinimum = 1 << 16;
+
+    int Threads;
+    u32 Width = 0;
+    u32 Count = 0;
+    std::vector<u8> Previous;
+    std::vector<u64> Bits;
+    std::vector<u32> BlockStart;
+
+    template <typename T, Compare Cmp>
+    void RefineWords(const u8* ram, s32 value, u32 first, u32 last) noexcept;
+    template <typename T>
+    void RefineWords(const u8* ram, Compare cmp, s32 value, u32 first, u32 last) noexcept;
+    void Recount() noexcept;
+};
+
+}
+
+#endif // MELONPRIME_RAMSEARCH_H
@@ -0,0 +1,296 @@
+/*
+    Copyright 2016-2026 melonDS team
+
+    This file is part of melonDS.
+
+    melonDS is free software: you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the Free
+    Software Foundation, either version 3 of the License, or (at your option)
+    any later version.
+*/
+
+#include "MelonPrimeTrace.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "Platform.h"
+
+namespace melonDS::MelonPrimeTrace
+{
+
+using Platform::Log;
+using Platform::LogLevel;
+
+namespace
+{
+
+constexpr u32 EventsPerThread = 1 << 16;
+
+struct Event
+{
+    u64 Ticks;
+    u64 Duration;
+    u64 Arg;
+    const char* Name;
+    char Phase;
+    Category Cat;
+    ArgKind Kind;
+};
+
+// Only its own thread writes to a buffer. The trace writer reads it from
+// another thread and throws away whatever may have been overwritten while
+// it was copying.
+struct ThreadBuffer
+{
+    std::unique_ptr<Event[]> Events = std::make_unique<Event[]>(EventsPerThread);
+    std::atomic<u64> Head = 0;
+    std::atomic<const char*> Name = nullptr;
+    std::atomic<bool> Exited = false;
+    u32 ID = 0;
+};
+
+struct Registry
+{
+    std::mutex Lock;
+    std::vector<std::unique_ptr<ThreadBuffer>> Buffers;
+    u32 NextID = 1;
+    std::string Path;
+    u64 Origin = 0;
+    TraceStats Stats;
+};
+
+Registry& Reg()
+{
+    static Registry* reg = []
+    {
+        auto* r = new Registry();
+        // writes a trace still running at exit, before anything it uses goes
+        // away; the registry itself is never destroyed, as threads outliving
+        // static destruction may still hold their buffer
+        std::atexit([] { Stop(); });
+        return r;
+    }();
+    return *reg;
+}
+
+// marks its buffer for reuse when the thread exits
+struct LocalBuffer
+{
+    ThreadBuffer* Buffer = nullptr;
+    const char* Name = nullptr;  // until the thread records its first event
+    ~LocalBuffer()
+    {
+        if (Buffer)
+            Buffer->Exited.store(true, std::memory_order_release);
+    }
+};
+
+thread_local LocalBuffer Local;
+
+ThreadBuffer* RegisterThread()
+{
+    Registry& reg = Reg();
+    std::lock_guard<std::mutex> guard(reg.Lock);
+    auto buffer = std::make_unique<ThreadBuffer>();
+    buffer->ID = reg.NextID++;
+    buffer->Name.store(Local.Name, std::memory_order_relaxed);
+    Local.Buffer = buffer.get();
+    reg.Buffers.push_back(std::move(buffer));
+    return Local.Buffer;
+}
+
+const char* CategoryName(Category cat)
+{
+    switch (cat)
+    {
+    case Category::Frame: return "frame";
+    case Category::Hud: return "hud";
+    case Category::JIT: return "jit";
+    case Category::GPU: return "gpu";
+    case Category::Texture: return "texture";
+    case Category::Savestate: return "savestate";
+    case Category::Present: return "present";
+    default: return "other";
+    }
+}
+
+void AppendString(std::string& out, const char* str)
+{
+    out += '"';
+    for (const char* c = str ? str : "?"; *c; c++)
+    {
+        if (*c == '"' || *c == '\\')
+            out += '\\';
+        if ((u8)*c >= 0x20)
+            out += *c;
+    }
+    out += '"';
+}
+
+bool StartFromEnvironment()
+{
+    const char* path = std::getenv("MELONPRIME_TRACE");
+    return path && path[0] && Start(path);
+}
+
+}
+
+namespace Detail
+{
+
+std::atomic<bool> Active = false;
+
+void Record(char phase, Category cat, const char* name, u64 ticks, u64 duration, u64 arg, ArgKind kind) noexcept
+{
+    ThreadBuffer* buffer = Local.Buffer;
+    if (!buffer)
+        buffer = RegisterThread();
+
+    const u64 head = buffer->Head.load(std::memory_order_relaxed);
+    buffer->Events[head & (EventsPerThread - 1)] = {ticks, duration, arg, name, phase, cat, kind};
+    buffer->Head.store(head + 1, std::memory_order_release);
+}
+
+}
+
+namespace
+{
+const bool StartedFromEnvironment = StartFromEnvironment();
+}
+
+bool Start(const std::string& path)
+{
+    Registry& reg = Reg();
+    {
+        std::lock_guard<std::mutex> guard(reg.Lock);
+        // threads gone since the last trace don't need their buffer anymore
+        reg.Buffers.erase(std::remove_if(reg.Buffers.begin(), reg.Buffers.end(),
+            [](const std::unique_ptr<ThreadBuffer>& buffer)
+            {
+                return buffer->Exited.load(std::memory_order_acquire);
+            }), reg.Buffers.end());
+        reg.Path = path;
+        reg.Origin = MelonPrimePerfClock::Ticks();
+        reg.Stats = {};
+    }
+    Detail::Active.store(true, std::memory_order_release);
+    Log(LogLevel::Info, "Tracing to %s\n", path.c_str());
+    return true;
+}
+
+bool Stop()
+{
+    if (!Detail::Active.exchange(false))
+        return false;
+
+    Registry& reg = Reg();
+    std::lock_guard<std::mutex> guard(reg.Lock);
+    const double usPerTick = 1'000'000.0 / (double)MelonPrimePerfClock::Frequency();
+
+    std::string json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    json += "{\"ph\":\"M\",\"pid\":1,\"tid\":0,\"name\":\"process_name\",\"args\":{\"name\":\"melonDS\"}}";
+    TraceStats stats;
+    std::vector<Event> events;
+    char buffer[160];
+    for (const auto& thread : reg.Buffers)
+    {
+        // a thread may still be recording, only what came before this is
+        // written
+        const u64 head = thread->Head.load(std::memory_order_acquire);
+        const u64 first = head > EventsPerThread ? head - EventsPerThread : 0;
+        events.clear();
+        for (u64 i = first; i < head; i++)
+            events.push_back(thread->Events[i & (EventsPerThread - 1)]);
+        const u64 after = thread->Head.load(std::memory_order_acquire);
+        const u64 valid = after > EventsPerThread ? after - EventsPerThread : 0;
+        stats.Overwritten += valid;
+
+        u64 written = 0;
+        for (u64 i = std::max(first, valid); i < head; i++)
+        {
+            const Event& ev = events[i - first];
+            if (ev.Ticks < reg.Origin)
+                continue; // from an earlier trace
+
+            json += ",\n{\"ph\":\"";
+            json += ev.Phase;
+            snprintf(buffer, sizeof(buffer), "\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"cat\":\"%s\",\"name\":",
+                     thread->ID, (double)(ev.Ticks - reg.Origin) * usPerTick, CategoryName(ev.Cat));
+            json += buffer;
+            AppendString(json, ev.Name);
+            if (ev.Phase == 'X')
+            {
+                snprintf(buffer, sizeof(buffer), ",\"dur\":%.3f", (double)ev.Duration * usPerTick);
+                json += buffer;
+            }
+            else if (ev.Phase == 'i')
+                json += ",\"s\":\"t\"";
+            if (ev.Kind == ArgKind::Count)
+                snprintf(buffer, sizeof(buffer), ",\"args\":{\"value\":%llu}", (unsigned long long)ev.Arg);
+            else if (ev.Kind == ArgKind::Address)
+                snprintf(buffer, sizeof(buffer), ",\"args\":{\"addr\":\"0x%08llX\"}", (unsigned long long)ev.Arg);
+            else
+                buffer[0] = '\0';
+            json += buffer;
+            json += '}';
+            written++;
+        }
+        if (!written)
+            continue;
+
+        stats.Threads++;
+        stats.Events += written;
+        snprintf(buffer, sizeof(buffer), ",\n{\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"name\":\"thread_name\",\"args\":{\"name\":",
+                 thread->ID);
+        json += buffer;
+        const char* name = thread->Name.load(std::memory_order_relaxed);
+        if (name)
+            AppendString(json, name);
+        else
+        {
+            snprintf(buffer, sizeof(buffer), "\"thread %u\"", thread->ID);
+            json += buffer;
+        }
+        json += "}}";
+    }
+    json += "\n]}\n";
+    reg.Stats = stats;
+
+    std::FILE* file = std::fopen(reg.Path.c_str(), "wb");
+    if (!file)
+    {
+        Log(LogLevel::Error, "Failed to open %s to write the trace\n", reg.Path.c_str());
+        return false;
+    }
+    const bool ok = std::fwrite(json.data(), 1, json.size(), file) == json.size();
+    if (std::fclose(file) != 0 || !ok)
+    {
+        Log(LogLevel::Error, "Failed to write the trace to %s\n", reg.Path.c_str());
+        return false;
+    }
+    Log(LogLevel::Info, "Wrote %llu trace events from %u thread(s) to %s\n",
+        (unsigned long long)stats.Events, stats.Threads, reg.Path.c_str());
+    return true;
+}
+
+TraceStats GetStats()
+{
+    Registry& reg = Reg();
+    std::lock_guard<std::mutex> guard(reg.Lock);
+    return reg.Stats;
+}
+
+void SetThreadName(const char* name) noexcept
+{
+    // threads that never record don't get a buffer
+    Local.Name = name;
+    if (Local.Buffer)
+        Local.Buffer->Name.store(name, std::memory_order_relaxed);
+}
+
+}
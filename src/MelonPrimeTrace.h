@@ -0,0 +1,126 @@
+/*
+    Copyright 2016-2026 melonDS team
+
+    Opt-in event trace, to see why one particular frame took long.
+
+    With MELONPRIME_TRACE set to a file path, every thread records its events
+    into a buffer of its own (no locks, the last 64K events per thread) and
+    the whole trace is written as Chrome trace event JSON when the process
+    exits, or on Stop(). chrome://tracing and ui.perfetto.dev open it as is.
+
+    Tracing off, an event costs one relaxed load and a branch. Event and
+    thread names are kept as pointers: pass string literals.
+*/
+
+#ifndef MELONPRIME_TRACE_H
+#define MELONPRIME_TRACE_H
+
+#include <atomic>
+#include <string>
+
+#include "MelonPrimePerfClock.h"
+#include "types.h"
+
+namespace melonDS::MelonPrimeTrace
+{
+
+enum class Category : u8
+{
+    Frame,
+    Hud,
+    JIT,
+    GPU,
+    Texture,
+    Savestate,
+    Present,
+    Count
+};
+
+// how an event's argument is shown in the trace
+enum class ArgKind : u8
+{
+    None,
+    Count,
+    Address,
+};
+
+struct TraceStats
+{
+    u32 Threads = 0;
+    u64 Events = 0;     // written to the last trace
+    u64 Overwritten = 0;
+};
+
+namespace Detail
+{
+extern std::atomic<bool> Active;
+void Record(char phase, Category cat, const char* name, u64 ticks, u64 duration, u64 arg, ArgKind kind) noexcept;
+}
+
+[[nodiscard]] inline bool IsEnabled() noexcept
+{
+    return Detail::Active.load(std::memory_order_relaxed);
+}
+
+// Begins a trace in memory, dropping what a previous one recorded. The
+// trace is written to path by Stop(), or when the process exits.
+bool Start(const std::string& path);
+// Stops recording and writes the trace. False if nothing was tracing or
+// the file couldn't be written.
+bool Stop();
+[[nodiscard]] TraceStats GetStats();
+
+// Names the calling thread in the trace
+void SetThreadName(const char* name) noexcept;
+
+// Begin and End must pair up on one thread, like the spans they mark
+inline void Begin(Category cat, const char* name) noexcept
+{
+    if (IsEnabled())
+        Detail::Record('B', cat, name, MelonPrimePerfClock::Ticks(), 0, 0, ArgKind::None);
+}
+
+inline void End(Category cat, const char* name) noexcept
+{
+    if (IsEnabled())
+        Detail::Record('E', cat, name, MelonPrimePerfClock::Ticks(), 0, 0, ArgKind::None);
+}
+
+inline void Instant(Category cat, const char* name, u64 arg = 0, ArgKind kind = ArgKind::None) noexcept
+{
+    if (IsEnabled())
+        Detail::Record('i', cat, name, MelonPrimePerfClock::Ticks(), 0, arg, kind);
+}
+
+// A span recorded as one complete event when it goes out of scope, so it
+// takes half the buffer space of a Begin/End pair
+class Scope
+{
+public:
+    Scope(Category cat, const char* name, u64 arg = 0, ArgKind kind = ArgKind::None) noexcept
+        : Start(IsEnabled() ? MelonPrimePerfClock::Ticks() : 0), Name(name), Arg(arg), Cat(cat), Kind(kind)
+    {
+    }
+
+    ~Scope()
+    {
+        if (Start)
+            Detail::Record('X', Cat, Name, Start, MelonPrimePerfClock::Ticks() - Start, Arg, Kind);
+    }
+
+    void SetArg(u64 arg, ArgKind kind = ArgKind::Count) noexcept { Arg = arg; Kind = kind; }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+private:
+    u64 Start;
+    const char* Name;
+    u64 Arg;
+    Category Cat;
+    ArgKind Kind;
+};
+
+}
+
+#endif // MELONPRIME_TRACE_H
@@ -47,6 +47,8 @@
 #include "DSi_DSP.h"
 #include "ARMJIT.h"
 #include "ARMJIT_Memory.h"
+#include "MelonPrimeProfile.h"
+#include "MelonPrimeTrace.h"
 
 namespace melonDS
 {
@@ -107,14 +109,15 @@ NDS::NDS(NDSArgs&& args, int type, void* userdata) noexcept :
     NDSCartSlot(*this, 0, nullptr),
     GBACartSlot(*this, nullptr),
     AREngine(*this),
-    ARM9(*this, args.GDB, args.JIT.has_value()),
-    ARM7(*this, args.GDB, args.JIT.has_value()),
+    ARM9(*this, args.GDB),
+    ARM7(*this, args.GDB),
 #ifdef GDBSTUB_ENABLED
     EnableGDBStub(args.GDB.has_value()),
 #endif
 #ifdef JIT_ENABLED
     EnableJIT(args.JIT.has_value()),
 #endif
+    StateHash(*this),
     DMAs {
         DMA(0, 0, *this),
         DMA(0, 1, *this),
@@ -482,6 +485,7 @@ void NDS::Reset()
     memset(MainRAM, 0, MainRAMMask + 1);
     memset(SharedWRAM, 0, 0x8000);
     memset(ARM7WRAM, 0, 0x10000);
+    StateHash.MarkAllDirty();
 
     MapSharedWRAM(0);
 
@@ -637,8 +641,10 @@ u32 NDS::GetSavestateConfig()
     return ret;
 }
 
-bool NDS::DoSavestate(Savestate* file)
+bool NDS::DoSavestate(Savestate* file, bool mainram)
 {
+    MelonPrimeTrace::Scope trace(MelonPrimeTrace::Category::Savestate,
+                                 file->Saving ? "Save state" : "Load state");
     file->Section("NDSG");
 
     u32 config = GetSavestateConfig();
@@ -657,7 +663,8 @@ bool NDS::DoSavestate(Savestate* file)
         }
     }
 
-    file->VarArray(MainRAM, MainRAMMaxSize);
+    if (mainram)
+        file->VarArray(MainRAM, MainRAMMaxSize);
     file->VarArray(SharedWRAM, SharedWRAMSize);
     file->VarArray(ARM7WRAM, ARM7WRAMSize);
 
@@ -775,6 +782,9 @@ bool NDS::DoSavestate(Savestate* file)
 #ifdef JIT_ENABLED
         JIT.Reset();
 #endif
+
+        if (mainram)
+            StateHash.MarkAllDirty();
     }
 
     file->Finish();
@@ -974,7 +984,11 @@ u32 NDS::RunFrame()
         }
         else
         {
-            if (cpuMode == CPUExecuteMode::InterpreterGDB)
+            if (cpuMode == CPUExecuteMode::InterpreterGDB
+#ifdef JIT_ENABLED
+                || cpuMode == CPUExecuteMode::JITGDB
+#endif
+                )
             {
                 ARM9.CheckGdbIncoming();
                 ARM7.CheckGdbIncoming();
@@ -1085,20 +1099,34 @@ u32 NDS::RunFrame()
 
 u32 NDS::RunFrame()
 {
+    u32 ret;
 #ifdef JIT_ENABLED
     if (EnableJIT)
-        return RunFrame<CPUExecuteMode::JIT>();
+    {
+#ifdef GDBSTUB_ENABLED
+        if (EnableGDBStub)
+            ret = RunFrame<CPUExecuteMode::JITGDB>();
+        else
+#endif
+            ret = RunFrame<CPUExecuteMode::JIT>();
+    }
     else
 #endif
 #ifdef GDBSTUB_ENABLED
     if (EnableGDBStub)
     {
-        return RunFrame<CPUExecuteMode::InterpreterGDB>();
+        ret = RunFrame<CPUExecuteMode::InterpreterGDB>();
     } else
 #endif
     {
-        return RunFrame<CPUExecuteMode::Interpreter>();
+        ret = RunFrame<CPUExecuteMode::Interpreter>();
     }
+
+    if (StateHash.IsEnabled())
+        StateHash.Update();
+    MelonPrimeProfile::FrameDone();
+
+    return ret;
 }
 
 void NDS::Reschedule(u64 target)
@@ -2171,6 +2199,7 @@ void NDS::ARM9Write8(u32 addr, u8 val)
     case 0x02000000:
         JIT.CheckAndInvalidate<0, ARMJIT_Memory::memregion_MainRAM>(addr);
         *(u8*)&MainRAM[addr & MainRAMMask] = val;
+        StateHash.MarkMainRAMDirty(addr & MainRAMMask);
         return;
 
     case 0x03000000:
@@ -2212,6 +2241,7 @@ void NDS::ARM9Write16(u32 addr, u16 val)
     case 0x02000000:
         JIT.CheckAndInvalidate<0, ARMJIT_Memory::memregion_MainRAM>(addr);
         *(u16*)&MainRAM[addr & MainRAMMask] = val;
+        StateHash.MarkMainRAMDirty(addr & MainRAMMask);
         return;
 
     case 0x03000000:
@@ -2272,6 +2302,7 @@ void NDS::ARM9Write32(u32 addr, u32 val)
     case 0x02000000:
         JIT.CheckAndInvalidate<0, ARMJIT_Memory::memregion_MainRAM>(addr);
         *(u32*)&MainRAM[addr & MainRAMMask] = val;
+        StateHash.MarkMainRAMDirty(addr & MainRAMMask);
         return ;
 
     case 0x03000000:
@@ -2567,6 +2598,7 @@ void NDS::ARM7Write8(u32 addr, u8 val)
     case 0x02800000:
         JIT.CheckAndInvalidate<1, ARMJIT_Memory::memregion_MainRAM>(addr);
         *(u8*)&MainRAM[addr & MainRAMMask] = val;
+        StateHash.MarkMainRAMDirty(addr & MainRAMMask);
         return;
 
     case 0x03000000:
@@ -2626,6 +2658,7 @@ void NDS::ARM7Write16(u32 addr, u16 val)
     case 0x02800000:
         JIT.CheckAndInvalidate<1, ARMJIT_Memory::memregion_MainRAM>(addr);
         *(u16*)&MainRAM[addr & MainRAMMask] = val;
+        StateHash.MarkMainRAMDirty(addr & MainRAMMask);
         return;
 
     case 0x03000000:
@@ -2696,6 +2729,7 @@ void NDS::ARM7Write32(u32 addr, u32 val)
     case 0x02800000:
         JIT.CheckAndInvalidate<1, ARMJIT_Memory::memregion_MainRAM>(addr);
         *(u32*)&MainRAM[addr & MainRAMMask] = val;
+        StateHash.MarkMainRAMDirty(addr & MainRAMMask);
         return;
 
     case 0x03000000:
@@ -35,6 +35,7 @@
 #include "RTC.h"
 #include "Wifi.h"
 #include "AREngine.h"
+#include "StateHash.h"
 #include "GPU.h"
 #include "ARMJIT.h"
 #include "MemRegion.h"
@@ -336,6 +337,7 @@ public: // TODO: Encapsulate the rest of these members
     GBACart::GBACartSlot GBACartSlot;
     melonDS::GPU GPU;
     melonDS::AREngine AREngine;
+    melonDS::StateHash StateHash;
 
 #ifdef MELONPRIME_DS
 #define MELONPRIME_ARM9_INSTRUCTION_HOOK_NDS_FIELDS
@@ -355,7 +357,9 @@ public: // TODO: Encapsulate the rest of these members
     /// Stop the emulator.
     virtual void Stop(Platform::StopReason reason = Platform::StopReason::External);
 
-    bool DoSavestate(Savestate* file);
+    // without mainram, main RAM is left out of the state; the caller keeps
+    // it (and marks what it restores in StateHash) itself
+    bool DoSavestate(Savestate* file, bool mainram = true);
 
     void SetARM9RegionTimings(u32 addrstart, u32 addrend, u32 region, int buswidth, int nonseq, int seq);
     void SetARM7RegionTimings(u32 addrstart, u32 addrend, u32 region, int buswidth, int nonseq, int seq);
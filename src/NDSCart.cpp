@@ -385,7 +385,12 @@ std::unique_ptr<CartCommon> ParseROM(const u8* romdata, u32 romlen, void* userda
 
 std::unique_ptr<CartCommon> ParseROM(std::unique_ptr<u8[]>&& romdata, u32 romlen, void* userdata, std::optional<NDSCartArgs>&& args)
 {
-    if (romdata == nullptr)
+    return ParseROM(ROMStorage(std::move(romdata)), romlen, userdata, std::move(args));
+}
+
+std::unique_ptr<CartCommon> ParseROM(ROMStorage&& romdata, u32 romlen, void* userdata, std::optional<NDSCartArgs>&& args)
+{
+    if (!romdata)
     {
         Log(LogLevel::Error, "NDSCart: romdata is null\n");
         return nullptr;
@@ -403,10 +408,18 @@ std::unique_ptr<CartCommon> ParseROM(std::unique_ptr<u8[]>&& romdata, u32 romlen
         return nullptr;
     }
 
-    auto [cartrom, cartromsize] = PadToPowerOf2(std::move(romdata), romlen);
+    // a mapping comes padded already
+    ROMStorage cartrom;
+    u32 cartromsize = 1;
+    while (cartromsize < romlen)
+        cartromsize <<= 1;
+    if (romdata.IsMapped())
+        cartrom = std::move(romdata);
+    else
+        cartrom = ROMStorage(PadToPowerOf2(romdata.Release(), romlen).first);
 
     NDSHeader header {};
-    memcpy(&header, cartrom.get(), sizeof(header));
+    memcpy(&header, cartrom.Data(), sizeof(header));
 
     if (!ValidateROM(cartromsize, header))
     {
@@ -245,6 +245,11 @@ private:
 /// or \c nullptr if the ROM data couldn't be parsed.
 std::unique_ptr<CartCommon> ParseROM(const u8* romdata, u32 romlen, void* userdata = nullptr, std::optional<NDSCartArgs>&& args = std::nullopt);
 std::unique_ptr<CartCommon> ParseROM(std::unique_ptr<u8[]>&& romdata, u32 romlen, void* userdata = nullptr, std::optional<NDSCartArgs>&& args = std::nullopt);
+
+/// Same as above, but the cart takes over \c romdata, which may be a file
+/// mapping from \c ROMStorage::MapFile.
+/// @param romlen The length of the ROM file in bytes, before padding.
+std::unique_ptr<CartCommon> ParseROM(ROMStorage&& romdata, u32 romlen, void* userdata = nullptr, std::optional<NDSCartArgs>&& args = std::nullopt);
 }
 
 #endif
@@ -41,7 +41,7 @@ CartCommon::CartCommon(const u8* rom, u32 len, u32 chipid, bool badDSiDump, ROML
 {
 }
 
-CartCommon::CartCommon(std::unique_ptr<u8[]>&& rom, u32 len, u32 chipid, bool badDSiDump, ROMListEntry romparams, melonDS::NDSCart::CartType type, void* userdata) :
+CartCommon::CartCommon(ROMStorage&& rom, u32 len, u32 chipid, bool badDSiDump, ROMListEntry romparams, melonDS::NDSCart::CartType type, void* userdata) :
     ROM(std::move(rom)),
     ROMLength(len),
     ChipID(chipid),
@@ -51,7 +51,7 @@ CartCommon::CartCommon(std::unique_ptr<u8[]>&& rom, u32 len, u32 chipid, bool ba
 {
     ROMMask = ROMLength - 1;
 
-    memcpy(&Header, ROM.get(), sizeof(Header));
+    memcpy(&Header, ROM.Data(), sizeof(Header));
     IsDSi = Header.IsDSi() && !badDSiDump;
     DSiBase = Header.DSiRegionStart << 19;
 }
@@ -61,7 +61,7 @@ CartCommon::~CartCommon() = default;
 u32 CartCommon::Checksum() const
 {
     const NDSHeader& header = GetHeader();
-    u32 crc = CRC32(ROM.get(), 0x40);
+    u32 crc = CRC32(ROM.Data(), 0x40);
 
     crc = CRC32(&ROM[header.ARM9ROMOffset], header.ARM9Size, crc);
     crc = CRC32(&ROM[header.ARM7ROMOffset], header.ARM7Size, crc);
@@ -309,7 +309,7 @@ const NDSBanner* CartCommon::Banner() const
     size_t bannersize = header.IsDSi() ? 0x23C0 : 0xA40;
     if (header.BannerOffset >= 0x200 && header.BannerOffset < (ROMLength - bannersize))
     {
-        return reinterpret_cast<const NDSBanner*>(ROM.get() + header.BannerOffset);
+        return reinterpret_cast<const NDSBanner*>(ROM.Data() + header.BannerOffset);
     }
 
     return nullptr;
@@ -25,6 +25,7 @@
 #include "../Savestate.h"
 #include "../NDS_Header.h"
 #include "../ROMList.h"
+#include "ROMStorage.h"
 
 namespace melonDS
 {
@@ -51,7 +52,7 @@ class CartCommon
 {
 public:
     CartCommon(const u8* rom, u32 len, u32 chipid, bool badDSiDump, ROMListEntry romparams, CartType type, void* userdata);
-    CartCommon(std::unique_ptr<u8[]>&& rom, u32 len, u32 chipid, bool badDSiDump, ROMListEntry romparams, CartType type, void* userdata);
+    CartCommon(ROMStorage&& rom, u32 len, u32 chipid, bool badDSiDump, ROMListEntry romparams, CartType type, void* userdata);
     virtual ~CartCommon();
 
     [[nodiscard]] u32 Type() const { return CartType; };
@@ -85,7 +86,7 @@ public:
     [[nodiscard]] const NDSBanner* Banner() const;
     [[nodiscard]] const ROMListEntry& GetROMParams() const { return ROMParams; };
     [[nodiscard]] u32 ID() const { return ChipID; }
-    [[nodiscard]] const u8* GetROM() const { return ROM.get(); }
+    [[nodiscard]] const u8* GetROM() const { return ROM.Data(); }
     [[nodiscard]] u32 GetROMLength() const { return ROMLength; }
 
 protected:
@@ -95,7 +96,7 @@ protected:
 
     bool ResetState;
 
-    std::unique_ptr<u8[]> ROM = nullptr;
+    ROMStorage ROM;
     u32 ROMLength = 0;
     u32 ROMMask = 0;
     u32 ChipID = 0;
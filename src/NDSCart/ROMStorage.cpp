@@ -0,0 +1,173 @@
+/*
+    Copyright 2016-2026 melonDS team
+
+    This file is part of melonDS.
+
+    melonDS is free software: you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the Free
+    Software Foundation, either version 3 of the License, or (at your option)
+    any later version.
+
+    melonDS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with melonDS. If not, see http://www.gnu.org/licenses/.
+*/
+
+#if defined(__SWITCH__)
+// no file mappings, ROMs are always read
+#elif defined(_WIN32)
+#include <filesystem>
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "ROMStorage.h"
+#include "../Platform.h"
+
+namespace melonDS
+{
+using Platform::Log;
+using Platform::LogLevel;
+
+namespace NDSCart
+{
+
+ROMStorage::~ROMStorage()
+{
+    Unmap();
+}
+
+ROMStorage::ROMStorage(ROMStorage&& other) noexcept :
+    Owned(std::move(other.Owned)),
+    Ptr(other.Ptr),
+    MappedLength(other.MappedLength)
+{
+    other.Ptr = nullptr;
+    other.MappedLength = 0;
+}
+
+ROMStorage& ROMStorage::operator=(ROMStorage&& other) noexcept
+{
+    if (this != &other)
+    {
+        Unmap();
+        Owned = std::move(other.Owned);
+        Ptr = other.Ptr;
+        MappedLength = other.MappedLength;
+        other.Ptr = nullptr;
+        other.MappedLength = 0;
+    }
+    return *this;
+}
+
+std::unique_ptr<u8[]> ROMStorage::Release() noexcept
+{
+    if (IsMapped())
+        return nullptr;
+
+    Ptr = nullptr;
+    return std::move(Owned);
+}
+
+void ROMStorage::Unmap() noexcept
+{
+    if (!IsMapped())
+        return;
+
+#if defined(_WIN32)
+    UnmapViewOfFile(Ptr);
+#elif !defined(__SWITCH__)
+    munmap(Ptr, MappedLength);
+#endif
+    Ptr = nullptr;
+    MappedLength = 0;
+}
+
+ROMStorage ROMStorage::MapFile(const std::string& path, u32& filelen) noexcept
+{
+    ROMStorage ret;
+    filelen = 0;
+
+#if defined(__SWITCH__)
+    return ret;
+#elif defined(_WIN32)
+    HANDLE file = CreateFileW(std::filesystem::u8path(path).c_str(), GENERIC_READ, FILE_SHARE_READ,
+                              nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return ret;
+
+    LARGE_INTEGER size;
+    bool ok = GetFileSizeEx(file, &size);
+    // a view can't be followed by zero padding here, so trimmed ROMs are
+    // read into a padded buffer as before
+    if (!ok || size.QuadPart < 0x1000 || size.QuadPart > 0x40000000
+        || (size.QuadPart & (size.QuadPart - 1)) != 0)
+    {
+        CloseHandle(file);
+        return ret;
+    }
+
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr)
+        return ret;
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+    CloseHandle(mapping);
+    if (view == nullptr)
+        return ret;
+
+    filelen = (u32)size.QuadPart;
+    ret.Ptr = static_cast<u8*>(view);
+    ret.MappedLength = filelen;
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return ret;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size < 0x1000 || st.st_size > 0x40000000)
+    {
+        close(fd);
+        return ret;
+    }
+
+    u64 len = st.st_size;
+    u64 padded = 1;
+    while (padded < len)
+        padded <<= 1;
+
+    // reserve the padded size as zeroed memory, then put the file over the
+    // start of it
+    void* base = mmap(nullptr, padded, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED)
+    {
+        close(fd);
+        return ret;
+    }
+    void* view = mmap(base, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0);
+    close(fd);
+    if (view == MAP_FAILED)
+    {
+        munmap(base, padded);
+        return ret;
+    }
+
+    filelen = (u32)len;
+    ret.Ptr = static_cast<u8*>(base);
+    ret.MappedLength = padded;
+#endif
+
+    Log(LogLevel::Info, "NDSCart: mapped %u-byte ROM file %s\n", filelen, path.c_str());
+    return ret;
+}
+
+}
+}
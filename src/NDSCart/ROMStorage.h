@@ -0,0 +1,76 @@
+/*
+    Copyright 2016-2026 melonDS team
+
+    This file is part of melonDS.
+
+    melonDS is free software: you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the Free
+    Software Foundation, either version 3 of the License, or (at your option)
+    any later version.
+
+    melonDS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with melonDS. If not, see http://www.gnu.org/licenses/.
+*/
+
+#ifndef NDSCART_ROMSTORAGE_H
+#define NDSCART_ROMSTORAGE_H
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "../types.h"
+
+namespace melonDS::NDSCart
+{
+
+// Where a cart's ROM image lives: either a buffer the cart owns, or a
+// private mapping of the ROM file.
+//
+// A mapping is copy-on-write, so the few places that modify the image
+// (secure area re-encryption, DLDI patching) only get their own copy of the
+// pages they touch; everything else is shared with the page cache and with
+// any other instance running the same ROM, and only read in as it's used.
+// The mapping is padded to a power of two with zeroes, as PadToPowerOf2()
+// does for owned buffers.
+class ROMStorage
+{
+public:
+    ROMStorage() noexcept = default;
+    ROMStorage(std::unique_ptr<u8[]>&& data) noexcept : Owned(std::move(data)), Ptr(Owned.get()) {}
+    ~ROMStorage();
+
+    ROMStorage(ROMStorage&& other) noexcept;
+    ROMStorage& operator=(ROMStorage&& other) noexcept;
+    ROMStorage(const ROMStorage&) = delete;
+    ROMStorage& operator=(const ROMStorage&) = delete;
+
+    // Maps a ROM file. Returns an empty storage if that isn't possible,
+    // in which case the caller should read the file instead; `filelen` is
+    // the unpadded file size.
+    static ROMStorage MapFile(const std::string& path, u32& filelen) noexcept;
+
+    [[nodiscard]] u8* Data() const noexcept { return Ptr; }
+    u8& operator[](std::size_t i) const noexcept { return Ptr[i]; }
+    explicit operator bool() const noexcept { return Ptr != nullptr; }
+
+    [[nodiscard]] bool IsMapped() const noexcept { return MappedLength != 0; }
+
+    // Hands over an owned buffer; nullptr for a mapping.
+    std::unique_ptr<u8[]> Release() noexcept;
+
+private:
+    void Unmap() noexcept;
+
+    std::unique_ptr<u8[]> Owned;
+    u8* Ptr = nullptr;
+    u64 MappedLength = 0;
+};
+
+}
+
+#endif
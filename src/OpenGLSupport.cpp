@@ -18,6 +18,8 @@
 
 #include "OpenGLSupport.h"
 
+#include <chrono>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -35,154 +37,251 @@ using Platform::LogLevel;
 namespace OpenGL
 {
 
-struct ShaderCacheEntry
+namespace
 {
-    u32 Length;
-    u8* Data;
-    u32 BinaryFormat;
 
-    ShaderCacheEntry(u8* data, u32 length, u32 binaryFmt)
-        : Length(length), Data(data), BinaryFormat(binaryFmt)
-    {
-        assert(data != nullptr);
-    }
+// Linked program binaries, by the hash of everything that went into
+// linking them. The file is only used with the driver that wrote it: the
+// header holds a hash of GL_VENDOR, GL_RENDERER, GL_VERSION and
+// GL_SHADING_LANGUAGE_VERSION, and a driver is still free to reject any
+// binary, in which case that program is compiled from source again.
+struct ProgramBinary
+{
+    u32 Format;
+    std::vector<u8> Data;
+};
 
-    ShaderCacheEntry(const ShaderCacheEntry&) = delete;
-    ShaderCacheEntry(ShaderCacheEntry&& other)
-    {
-        Data = other.Data;
-        Length = other.Length;
-        BinaryFormat = other.BinaryFormat;
+std::mutex ShaderCacheLock;
+std::unordered_map<u64, ProgramBinary> ShaderCache;
+ShaderCacheStats CacheStats;
+bool ShaderCacheLoaded = false;
+bool ShaderCacheUsable = false;
+bool ShaderCacheDirty = false;
+u64 DriverHash = 0;
 
-        other.Data = nullptr;
-        other.Length = 0;
-        other.BinaryFormat = 0;
-    }
+constexpr u32 ShaderCacheMagic = 0x11CAC4E1;
+constexpr u32 ShaderCacheVersion = 2;
+constexpr const char* ShaderCacheFileName = "shadercache";
 
-    ~ShaderCacheEntry()
+u64 MicrosecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count();
+}
+
+u64 HashDriver()
+{
+    XXH3_state_t* state = XXH3_createState();
+    XXH3_64bits_reset(state);
+    for (GLenum name : {GL_VENDOR, GL_RENDERER, GL_VERSION, GL_SHADING_LANGUAGE_VERSION})
     {
-        if (Data) // check whether it was moved
-            delete[] Data;
+        const char* str = reinterpret_cast<const char*>(glGetString(name));
+        if (!str) str = "";
+        XXH3_64bits_update(state, str, strlen(str) + 1);
     }
-};
-
-std::unordered_map<u64, ShaderCacheEntry> ShaderCache;
-std::vector<u64> NewShaders;
-
-constexpr u32 ShaderCacheMagic = 0x11CAC4E1;
-constexpr u32 ShaderCacheVersion = 1;
+    u64 hash = XXH3_64bits_digest(state);
+    XXH3_freeState(state);
+    return hash;
+}
 
-void LoadShaderCache()
+// needs ShaderCacheLock and a current context
+void LoadShaderCacheLocked()
 {
-    // for now the shader cache only contains only compute shaders
-    // because they take the longest to compile
-    Platform::FileHandle* file = Platform::OpenLocalFile("shadercache", Platform::FileMode::Read);
+    ShaderCacheLoaded = true;
+    ShaderCache.clear();
+
+    GLint numFormats = 0;
+    if (glProgramBinary && glGetProgramBinary && glProgramParameteri)
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numFormats);
+    ShaderCacheUsable = numFormats > 0;
+    if (!ShaderCacheUsable)
+    {
+        Log(LogLevel::Info, "OpenGL: driver can't save program binaries, shader cache disabled\n");
+        return;
+    }
+    DriverHash = HashDriver();
+
+    Platform::FileHandle* file = Platform::OpenLocalFile(ShaderCacheFileName, Platform::FileMode::Read);
     if (file == nullptr)
     {
-        Log(LogLevel::Error, "Could not find shader cache\n");
+        Log(LogLevel::Info, "OpenGL: no shader cache yet\n");
         return;
     }
 
     u32 magic, version, numPrograms;
-    if (Platform::FileRead(&magic, 4, 1, file) != 1 || magic != ShaderCacheMagic)
+    u64 driverHash;
+    if (Platform::FileRead(&magic, 4, 1, file) != 1 || magic != ShaderCacheMagic
+        || Platform::FileRead(&version, 4, 1, file) != 1 || version != ShaderCacheVersion)
     {
-        Log(LogLevel::Error, "Shader cache file has invalid magic\n");
-        goto fileInvalid;
+        Log(LogLevel::Info, "OpenGL: shader cache is from another version, starting over\n");
+        Platform::CloseFile(file);
+        return;
     }
-
-    if (Platform::FileRead(&version, 4, 1, file) != 1 || version != ShaderCacheVersion)
+    if (Platform::FileRead(&driverHash, 8, 1, file) != 1 || driverHash != DriverHash)
     {
-        Log(LogLevel::Error, "Shader cache file has bad version\n");
-        goto fileInvalid;
+        Log(LogLevel::Info, "OpenGL: shader cache is from another driver, starting over\n");
+        Platform::CloseFile(file);
+        return;
     }
-
     if (Platform::FileRead(&numPrograms, 4, 1, file) != 1)
     {
-        Log(LogLevel::Error, "Shader cache file invalid program count\n");
-        goto fileInvalid;
+        Log(LogLevel::Error, "OpenGL: shader cache has no program count\n");
+        Platform::CloseFile(file);
+        return;
     }
 
-    // not the best approach, because once changes pile up
-    // we read and overwrite the old files
     for (u32 i = 0; i < numPrograms; i++)
     {
         int error = 3;
 
-        u32 length, binaryFormat;
-        u64 sourceHash;
-        error -= Platform::FileRead(&sourceHash, 8, 1, file);
+        u64 key;
+        u32 length;
+        ProgramBinary binary;
+        error -= Platform::FileRead(&key, 8, 1, file);
+        error -= Platform::FileRead(&binary.Format, 4, 1, file);
         error -= Platform::FileRead(&length, 4, 1, file);
-        error -= Platform::FileRead(&binaryFormat, 4, 1, file);
-
-        if (error != 0)
+        if (error != 0 || length == 0 || length > 0x4000000)
         {
-            Log(LogLevel::Error, "Invalid shader cache entry\n");
-            goto fileInvalid;
+            Log(LogLevel::Error, "OpenGL: invalid shader cache entry\n");
+            break;
         }
 
-        u8* data = new u8[length];
-        if (Platform::FileRead(data, length, 1, file) != 1)
+        binary.Data.resize(length);
+        if (Platform::FileRead(binary.Data.data(), length, 1, file) != 1)
         {
-            Log(LogLevel::Error, "Could not read shader cache entry data\n");
-            delete[] data;
-            goto fileInvalid;
+            Log(LogLevel::Error, "OpenGL: could not read shader cache entry\n");
+            break;
         }
+        ShaderCache[key] = std::move(binary);
+    }
+    Platform::CloseFile(file);
 
-        ShaderCache.erase(sourceHash);
-        ShaderCache.emplace(sourceHash, ShaderCacheEntry(data, length, binaryFormat));
+    Log(LogLevel::Info, "OpenGL: %zu programs in the shader cache\n", ShaderCache.size());
+}
+
+bool CacheUsable()
+{
+    std::lock_guard<std::mutex> guard(ShaderCacheLock);
+    if (!ShaderCacheLoaded)
+        LoadShaderCacheLocked();
+    return ShaderCacheUsable;
+}
+
+// Links `program` from its cached binary, if there is one the driver
+// accepts.
+bool RestoreProgram(GLuint program, u64 key, const std::string& name)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    std::unique_lock<std::mutex> guard(ShaderCacheLock);
+    auto it = ShaderCache.find(key);
+    if (it == ShaderCache.end())
+        return false;
+    glProgramBinary(program, it->second.Format, it->second.Data.data(), it->second.Data.size());
+
+    GLint linkStatus = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+    if (linkStatus != GL_TRUE)
+    {
+        Log(LogLevel::Info, "OpenGL: cached binary for %s was rejected\n", name.c_str());
+        ShaderCache.erase(it);
+        ShaderCacheDirty = true;
+        CacheStats.Rejected++;
+        return false;
     }
 
-fileInvalid:
-    Platform::CloseFile(file);
+    CacheStats.Restored++;
+    CacheStats.RestoreUS += MicrosecondsSince(start);
+    return true;
+}
+
+void StoreProgram(GLuint program, u64 key)
+{
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0)
+        return;
+
+    ProgramBinary binary;
+    binary.Data.resize(length);
+    GLenum format = 0;
+    glGetProgramBinary(program, length, &length, &format, binary.Data.data());
+    binary.Data.resize(length);
+    binary.Format = format;
+
+    std::lock_guard<std::mutex> guard(ShaderCacheLock);
+    ShaderCache[key] = std::move(binary);
+    ShaderCacheDirty = true;
+}
+
+void CountCompile(std::chrono::steady_clock::time_point start)
+{
+    std::lock_guard<std::mutex> guard(ShaderCacheLock);
+    CacheStats.Compiled++;
+    CacheStats.CompileUS += MicrosecondsSince(start);
+}
+
+void HashString(XXH3_state_t* state, const std::string& str)
+{
+    // the terminator keeps "ab"+"c" apart from "a"+"bc"
+    XXH3_64bits_update(state, str.c_str(), str.size() + 1);
+}
+
+}
+
+void LoadShaderCache()
+{
+    std::lock_guard<std::mutex> guard(ShaderCacheLock);
+    LoadShaderCacheLocked();
 }
 
 void SaveShaderCache()
 {
-    Platform::FileHandle* file = Platform::OpenLocalFile("shadercache", Platform::FileMode::ReadWrite);
+    std::lock_guard<std::mutex> guard(ShaderCacheLock);
+    if (!ShaderCacheDirty || !ShaderCacheUsable)
+        return;
 
+    Platform::FileHandle* file = Platform::OpenLocalFile(ShaderCacheFileName, Platform::FileMode::Write);
     if (file == nullptr)
     {
-        Log(LogLevel::Error, "Could not open or create shader cache file\n");
+        Log(LogLevel::Error, "OpenGL: could not open or create shader cache file\n");
         return;
     }
 
-    int written = 3;
+    int written = 4;
     u32 magic = ShaderCacheMagic, version = ShaderCacheVersion, numPrograms = ShaderCache.size();
     written -= Platform::FileWrite(&magic, 4, 1, file);
     written -= Platform::FileWrite(&version, 4, 1, file);
+    written -= Platform::FileWrite(&DriverHash, 8, 1, file);
     written -= Platform::FileWrite(&numPrograms, 4, 1, file);
 
-    if (written != 0)
+    for (const auto& [key, binary] : ShaderCache)
     {
-        Log(LogLevel::Error, "Could not write shader cache header\n");
-        goto writeError;
+        if (written != 0)
+            break;
+
+        u32 length = binary.Data.size();
+        written += 4;
+        written -= Platform::FileWrite(&key, 8, 1, file);
+        written -= Platform::FileWrite(&binary.Format, 4, 1, file);
+        written -= Platform::FileWrite(&length, 4, 1, file);
+        written -= Platform::FileWrite(binary.Data.data(), length, 1, file);
     }
+    Platform::CloseFile(file);
 
-    Platform::FileSeek(file, 0, Platform::FileSeekOrigin::End);
-
-    printf("new shaders %zu\n", NewShaders.size());
-
-    for (u64 newShader : NewShaders)
+    if (written != 0)
     {
-        int error = 4;
-        auto it = ShaderCache.find(newShader);
-
-        error -= Platform::FileWrite(&it->first, 8, 1, file);
-        error -= Platform::FileWrite(&it->second.Length, 4, 1, file);
-        error -= Platform::FileWrite(&it->second.BinaryFormat, 4, 1, file);
-        error -= Platform::FileWrite(it->second.Data, it->second.Length, 1, file);
-
-        if (error != 0)
-        {
-            Log(LogLevel::Error, "Could not insert new shader cache entry\n");
-            goto writeError;
-        }
+        Log(LogLevel::Error, "OpenGL: could not write shader cache\n");
+        return;
     }
+    ShaderCacheDirty = false;
+    Log(LogLevel::Info, "OpenGL: saved %u programs to the shader cache\n", numPrograms);
+}
 
-writeError:
-    Platform::CloseFile(file);
-
-    NewShaders.clear();
+ShaderCacheStats GetShaderCacheStats()
+{
+    std::lock_guard<std::mutex> guard(ShaderCacheLock);
+    return CacheStats;
 }
 
 bool CompilerShader(GLuint& id, const std::string& source, const std::string& name, const std::string& type)
@@ -260,26 +359,24 @@ bool CompileComputeProgram(GLuint& result, const std::string& source, const std:
 {
     result = glCreateProgram();
 
-    /*u64 sourceHash = XXH64(source.data(), source.size(), 0);
-    auto it = ShaderCache.find(sourceHash);
-    if (it != ShaderCache.end())
+    bool useCache = CacheUsable();
+    u64 key = 0;
+    if (useCache)
     {
-        glProgramBinary(result, it->second.BinaryFormat, it->second.Data, it->second.Length);
-
-        GLint linkStatus;
-        glGetProgramiv(result, GL_LINK_STATUS, &linkStatus);
-        if (linkStatus == GL_TRUE)
-        {
-            Log(LogLevel::Info, "Restored shader %s from cache\n", name.c_str());
+        XXH3_state_t* state = XXH3_createState();
+        XXH3_64bits_reset(state);
+        HashString(state, "compute");
+        HashString(state, source);
+        key = XXH3_64bits_digest(state);
+        XXH3_freeState(state);
+
+        if (RestoreProgram(result, key, name))
             return true;
-        }
-        else
-        {
-        }
-    }*/
-    Log(LogLevel::Error, "Shader %s from cache was rejected\n", name.c_str());
+        glProgramParameteri(result, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
 
-    GLuint shader;
+    auto start = std::chrono::steady_clock::now();
+    GLuint shader = 0;
     bool linkingSucess = false;
 
     if (!glCreateShader || !glDeleteShader)
@@ -298,21 +395,13 @@ error:
     if (!linkingSucess)
     {
         glDeleteProgram(result);
+        return false;
     }
-    /*else
-    {
-        GLint length;
-        GLenum format;
-        glGetProgramiv(result, GL_PROGRAM_BINARY_LENGTH, &length);
-
-        u8* buffer = new u8[length];
-        glGetProgramBinary(result, length, nullptr, &format, buffer);
-
-        ShaderCache.emplace(sourceHash, ShaderCacheEntry(buffer, length, format));
-        NewShaders.push_back(sourceHash);
-    }*/
 
-    return linkingSucess;
+    CountCompile(start);
+    if (useCache)
+        StoreProgram(result, key);
+    return true;
 }
 
 bool CompileVertexFragmentProgram(GLuint& result,
@@ -321,12 +410,42 @@ bool CompileVertexFragmentProgram(GLuint& result,
     const std::initializer_list<AttributeTarget>& vertexInAttrs,
     const std::initializer_list<AttributeTarget>& fragmentOutAttrs)
 {
+    result = glCreateProgram();
+
+    // the attribute bindings are part of what gets linked
+    bool useCache = CacheUsable();
+    u64 key = 0;
+    if (useCache)
+    {
+        XXH3_state_t* state = XXH3_createState();
+        XXH3_64bits_reset(state);
+        HashString(state, vs);
+        HashString(state, fs);
+        for (const AttributeTarget& target : vertexInAttrs)
+        {
+            HashString(state, target.Name);
+            XXH3_64bits_update(state, &target.Location, sizeof(target.Location));
+        }
+        HashString(state, "out");
+        for (const AttributeTarget& target : fragmentOutAttrs)
+        {
+            HashString(state, target.Name);
+            XXH3_64bits_update(state, &target.Location, sizeof(target.Location));
+        }
+        key = XXH3_64bits_digest(state);
+        XXH3_freeState(state);
+
+        if (RestoreProgram(result, key, name))
+            return true;
+        glProgramParameteri(result, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+
+    auto start = std::chrono::steady_clock::now();
     GLuint shaders[2] =
     {
         glCreateShader(GL_VERTEX_SHADER),
         glCreateShader(GL_FRAGMENT_SHADER)
     };
-    result = glCreateProgram();
 
     bool linkingSucess = false;
 
@@ -353,11 +472,17 @@ error:
     glDeleteShader(shaders[0]);
 
     if (!linkingSucess)
+    {
         glDeleteProgram(result);
+        return false;
+    }
 
-    return linkingSucess;
+    CountCompile(start);
+    if (useCache)
+        StoreProgram(result, key);
+    return true;
 }
 
 }
 
-}
\ No newline at end of file
+}
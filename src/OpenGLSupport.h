@@ -28,8 +28,22 @@
 namespace melonDS::OpenGL
 {
 
+// Linked programs are kept in an on-disk cache (GL_ARB_get_program_binary),
+// keyed by their sources and only reused with the driver that wrote them.
+// The cache is loaded by the first compile with a context current, or by
+// LoadShaderCache(); SaveShaderCache() writes it out if anything was added.
+struct ShaderCacheStats
+{
+    u32 Restored = 0;   // programs loaded from a cached binary
+    u32 Compiled = 0;   // programs compiled from source
+    u32 Rejected = 0;   // cached binaries the driver refused
+    u64 RestoreUS = 0;
+    u64 CompileUS = 0;
+};
+
 void LoadShaderCache();
 void SaveShaderCache();
+ShaderCacheStats GetShaderCacheStats();
 
 struct AttributeTarget
 {
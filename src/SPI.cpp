@@ -106,8 +106,10 @@ void FirmwareMem::Reset()
 
     Hold = 0;
     CurCmd = 0;
+    DataPos = 0;
     Data = 0;
     StatusReg = 0x00;
+    Addr = 0;
 }
 
 void FirmwareMem::DoSavestate(Savestate* file)
@@ -256,6 +256,11 @@ public:
     void SetOutputSampleRate(double rate);
     void SetOutputSkew(double skew);
 
+    // while suppressed, mixed samples are discarded instead of being buffered
+    // for output (used when re-simulating frames that were already heard)
+    void SetOutputSuppressed(bool suppressed) { OutputSuppressed = suppressed; }
+    [[nodiscard]] bool IsOutputSuppressed() const { return OutputSuppressed; }
+
     u8 Read8(u32 addr);
     u16 Read16(u32 addr);
     u32 Read32(u32 addr);
@@ -277,6 +282,7 @@ private:
     u32 OutputBufferWritePos = 0;
     u32 OutputBufferReadPos = 0;
     s16 OutputLastSamples[2];
+    bool OutputSuppressed = false;
 
     u32 MixInterval;
 
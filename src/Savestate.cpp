@@ -222,7 +222,7 @@ void Savestate::Bool32(bool* var)
     }
 }
 
-void Savestate::VarArray(void* data, u32 len)
+void Savestate::VarArrayChecked(void* data, u32 len)
 {
     if (Error || finished) return;
 
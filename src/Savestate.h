@@ -76,7 +76,21 @@ public:
     void VarBool(bool* var);
     void Bool32(bool* var); // backwards compatibility (TODO remove)
 
-    void VarArray(void* data, u32 len);
+    void VarArray(void* data, u32 len)
+    {
+        // inline for the common case: the GPU3D state alone is a couple
+        // hundred thousand small fields
+        if (!Error && !finished && len <= buffer_length - buffer_offset)
+        {
+            if (Saving)
+                memcpy(buffer + buffer_offset, data, len);
+            else
+                memcpy(data, buffer + buffer_offset, len);
+            buffer_offset += len;
+            return;
+        }
+        VarArrayChecked(data, len);
+    }
 
     void Finish();
 
@@ -116,6 +130,7 @@ public:
 
 private:
     static constexpr u32 NO_SECTION = 0xffffffff;
+    void VarArrayChecked(void* data, u32 len);
     void CloseCurrentSection();
     bool Resize(u32 new_length);
     void WriteSavestateHeader();
@@ -0,0 +1,195 @@
+/*
+    Copyright 2016-2026 melonDS team
+
+    This file is part of melonDS.
+
+    melonDS is free software: you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the Free
+    Software Foundation, either version 3 of the License, or (at your option)
+    any later version.
+
+    melonDS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with melonDS. If not, see http://www.gnu.org/licenses/.
+*/
+
+#include <string.h>
+
+#define XXH_STATIC_LINKING_ONLY
+#include "xxhash/xxhash.h"
+
+#include "StateHash.h"
+#include "NDS.h"
+
+namespace melonDS
+{
+
+StateHash::StateHash(melonDS::NDS& nds) noexcept : NDS(nds)
+{
+}
+
+bool StateHash::IsWriteTrackingComplete() const noexcept
+{
+#ifdef JIT_ENABLED
+    // fastmem stores go straight to memory, they're only seen through faults
+    if (NDS.IsJITEnabled() && NDS.JIT.FastMemoryEnabled())
+        return NDS.JIT.Memory.IsWriteTracking();
+#endif
+    return true;
+}
+
+void StateHash::UpdateWriteTracking() noexcept
+{
+#ifdef JIT_ENABLED
+    bool wanted = Enabled || TrackingRequests > 0;
+    if (wanted == NDS.JIT.Memory.IsWriteTracking())
+        return;
+
+    // fastmem stores before this weren't seen
+    if (NDS.JIT.Memory.SetWriteTracking(wanted) && wanted)
+        MarkAllDirty();
+#endif
+}
+
+void StateHash::SetEnabled(bool enabled) noexcept
+{
+    if (enabled && !Enabled)
+        ForceFull = true;
+    Enabled = enabled;
+    UpdateWriteTracking();
+}
+
+void StateHash::RequestWriteTracking(bool request) noexcept
+{
+    if (request)
+        TrackingRequests++;
+    else if (TrackingRequests > 0)
+        TrackingRequests--;
+    UpdateWriteTracking();
+}
+
+u32 StateHash::NewGeneration() noexcept
+{
+    // pages written in the generation that ends fault again on their next store
+    NDS.JIT.Memory.RearmWriteTracking();
+    return WriteGen++;
+}
+
+static void HashCPU(XXH3_state_t* state, const ARM& cpu)
+{
+    XXH3_64bits_update(state, cpu.R, sizeof(cpu.R));
+    XXH3_64bits_update(state, &cpu.CPSR, sizeof(cpu.CPSR));
+    XXH3_64bits_update(state, cpu.R_FIQ, sizeof(cpu.R_FIQ));
+    XXH3_64bits_update(state, cpu.R_SVC, sizeof(cpu.R_SVC));
+    XXH3_64bits_update(state, cpu.R_ABT, sizeof(cpu.R_ABT));
+    XXH3_64bits_update(state, cpu.R_IRQ, sizeof(cpu.R_IRQ));
+    XXH3_64bits_update(state, cpu.R_UND, sizeof(cpu.R_UND));
+    XXH3_64bits_update(state, &cpu.Halted, sizeof(cpu.Halted));
+}
+
+void StateHash::HashSmallState(Components& parts) const noexcept
+{
+    XXH3_state_t state;
+
+    XXH3_64bits_reset(&state);
+    XXH3_64bits_update(&state, NDS.SharedWRAM, NDS.SharedWRAMSize);
+    XXH3_64bits_update(&state, NDS.ARM7WRAM, NDS.ARM7WRAMSize);
+    XXH3_64bits_update(&state, NDS.ARM9.ITCM, ITCMPhysicalSize);
+    XXH3_64bits_update(&state, NDS.ARM9.DTCM, DTCMPhysicalSize);
+    parts.WRAM = XXH3_64bits_digest(&state);
+
+    const GPU& gpu = NDS.GPU;
+    XXH3_64bits_reset(&state);
+    XXH3_64bits_update(&state, gpu.VRAMCNT, sizeof(gpu.VRAMCNT));
+    XXH3_64bits_update(&state, gpu.Palette, sizeof(gpu.Palette));
+    XXH3_64bits_update(&state, gpu.OAM, sizeof(gpu.OAM));
+    XXH3_64bits_update(&state, gpu.VRAM_A, sizeof(gpu.VRAM_A));
+    XXH3_64bits_update(&state, gpu.VRAM_B, sizeof(gpu.VRAM_B));
+    XXH3_64bits_update(&state, gpu.VRAM_C, sizeof(gpu.VRAM_C));
+    XXH3_64bits_update(&state, gpu.VRAM_D, sizeof(gpu.VRAM_D));
+    XXH3_64bits_update(&state, gpu.VRAM_E, sizeof(gpu.VRAM_E));
+    XXH3_64bits_update(&state, gpu.VRAM_F, sizeof(gpu.VRAM_F));
+    XXH3_64bits_update(&state, gpu.VRAM_G, sizeof(gpu.VRAM_G));
+    XXH3_64bits_update(&state, gpu.VRAM_H, sizeof(gpu.VRAM_H));
+    XXH3_64bits_update(&state, gpu.VRAM_I, sizeof(gpu.VRAM_I));
+    parts.VRAM = XXH3_64bits_digest(&state);
+
+    XXH3_64bits_reset(&state);
+    HashCPU(&state, NDS.ARM9);
+    HashCPU(&state, NDS.ARM7);
+    parts.CPU = XXH3_64bits_digest(&state);
+
+    XXH3_64bits_reset(&state);
+    XXH3_64bits_update(&state, NDS.IME, sizeof(NDS.IME));
+    XXH3_64bits_update(&state, NDS.IE, sizeof(NDS.IE));
+    XXH3_64bits_update(&state, NDS.IF, sizeof(NDS.IF));
+    XXH3_64bits_update(&state, &NDS.IE2, sizeof(NDS.IE2));
+    XXH3_64bits_update(&state, &NDS.IF2, sizeof(NDS.IF2));
+    XXH3_64bits_update(&state, NDS.Timers, sizeof(NDS.Timers));
+    XXH3_64bits_update(&state, &NDS.KeyInput, sizeof(NDS.KeyInput));
+    XXH3_64bits_update(&state, &NDS.RCnt, sizeof(NDS.RCnt));
+    XXH3_64bits_update(&state, NDS.ExMemCnt, sizeof(NDS.ExMemCnt));
+    XXH3_64bits_update(&state, &NDS.PowerControl9, sizeof(NDS.PowerControl9));
+    parts.IO = XXH3_64bits_digest(&state);
+}
+
+u64 StateHash::Update() noexcept
+{
+    const u32 numpages = (NDS.MainRAMMask + 1) >> kPageShift;
+
+    bool full = ForceFull || (NDS.NumFrames % kFullInterval) == 0 || !IsWriteTrackingComplete();
+    u32 since = HashedGen;
+    HashedGen = NewGeneration();
+
+    PagesRehashed = 0;
+    if (full)
+    {
+        for (u32 i = 0; i < numpages; i++)
+            PageHashes[i] = XXH3_64bits(&NDS.MainRAM[i << kPageShift], 1 << kPageShift);
+        PagesRehashed = numpages;
+
+        ForceFull = false;
+    }
+    else
+    {
+        for (u32 page = 0; page < numpages; page++)
+        {
+            if (!PageWrittenSince(page, since))
+                continue;
+            PageHashes[page] = XXH3_64bits(&NDS.MainRAM[page << kPageShift], 1 << kPageShift);
+            PagesRehashed++;
+        }
+    }
+
+    Parts.MainRAM = XXH3_64bits(PageHashes, numpages * sizeof(u64));
+    HashSmallState(Parts);
+
+    Hash = XXH3_64bits(&Parts, sizeof(Parts));
+    return Hash;
+}
+
+u64 StateHash::ComputeFull(Components* components) const noexcept
+{
+    const u32 numpages = (NDS.MainRAMMask + 1) >> kPageShift;
+
+    // same page layout as the incremental path, so the results compare
+    XXH3_state_t state;
+    XXH3_64bits_reset(&state);
+    for (u32 i = 0; i < numpages; i++)
+    {
+        u64 pagehash = XXH3_64bits(&NDS.MainRAM[i << kPageShift], 1 << kPageShift);
+        XXH3_64bits_update(&state, &pagehash, sizeof(pagehash));
+    }
+
+    Components parts;
+    parts.MainRAM = XXH3_64bits_digest(&state);
+    HashSmallState(parts);
+
+    if (components) *components = parts;
+    return XXH3_64bits(&parts, sizeof(parts));
+}
+
+}
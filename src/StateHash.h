@@ -0,0 +1,134 @@
+/*
+    Copyright 2016-2026 melonDS team
+
+    This file is part of melonDS.
+
+    melonDS is free software: you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the Free
+    Software Foundation, either version 3 of the License, or (at your option)
+    any later version.
+
+    melonDS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with melonDS. If not, see http://www.gnu.org/licenses/.
+*/
+
+#ifndef STATEHASH_H
+#define STATEHASH_H
+
+#include "types.h"
+
+namespace melonDS
+{
+class NDS;
+
+// Per-frame hash of the emulated machine state, for telling whether two runs
+// have diverged (netplay peers, JIT vs interpreter, two builds).
+//
+// Main RAM is hashed in 4 KB pages, and only pages written since the last
+// update are rehashed; the NDS/DSi bus write handlers mark them. Everything
+// else covered (WRAM, TCM, VRAM, palette/OAM, CPU registers, interrupt/timer/
+// key state) is small enough to hash in full every frame.
+//
+// JIT fastmem stores bypass the bus handlers; while anything relies on the
+// tracking, ARMJIT_Memory maps main RAM read-only so the first store to each
+// page of a generation faults and marks it. Frontend code poking MainRAM
+// directly still can't be tracked, a full pass on every frame number that is
+// a multiple of kFullInterval bounds how long such a write can go unnoticed
+// (and keeps the passes in step across netplay peers).
+class StateHash
+{
+public:
+    static constexpr u32 kPageShift = 12;
+    static constexpr u32 kMaxPages = 0x1000000 >> kPageShift;
+    static constexpr u32 kFullInterval = 60;
+
+    struct Components
+    {
+        u64 MainRAM;
+        u64 WRAM;
+        u64 VRAM;
+        u64 CPU;
+        u64 IO;
+    };
+
+    explicit StateHash(melonDS::NDS& nds) noexcept;
+
+    // hashing is off by default; the dirty bookkeeping runs regardless, so
+    // enabling it later only costs one full pass
+    void SetEnabled(bool enabled) noexcept;
+    [[nodiscard]] bool IsEnabled() const noexcept { return Enabled; }
+
+    // for other users of PageWrittenSince() (rollback snapshots), counted;
+    // hashing holds a request of its own while enabled
+    void RequestWriteTracking(bool request) noexcept;
+
+    // offset is into MainRAM (already masked)
+    void MarkMainRAMDirty(u32 offset) noexcept
+    {
+        PageWriteGen[offset >> kPageShift] = WriteGen;
+    }
+    void MarkAllDirty() noexcept
+    {
+        AllWrittenGen = WriteGen;
+        ForceFull = true;
+    }
+
+    // The write tracking is also there for anything else that keeps a copy
+    // of main RAM (rollback snapshots): every marked page carries the
+    // generation it was last written in. NewGeneration() returns the current
+    // generation and starts a new one; a copy made right after it only needs
+    // the pages for which PageWrittenSince(page, that generation) the next
+    // time around.
+    u32 NewGeneration() noexcept;
+    [[nodiscard]] bool PageWrittenSince(u32 page, u32 generation) const noexcept
+    {
+        u32 gen = PageWriteGen[page];
+        if (AllWrittenGen > gen) gen = AllWrittenGen;
+        return gen > generation;
+    }
+
+    // false while writes go around the bus handlers (JIT fastmem without
+    // fault tracking), in which case PageWrittenSince() can't be trusted
+    [[nodiscard]] bool IsWriteTrackingComplete() const noexcept;
+
+    // hashes the current state; called by NDS::RunFrame at the end of each
+    // frame while enabled, or directly by tools
+    u64 Update() noexcept;
+
+    // hashes everything from scratch without touching the incremental state
+    // (for checking the dirty tracking)
+    u64 ComputeFull(Components* components = nullptr) const noexcept;
+
+    [[nodiscard]] u64 GetHash() const noexcept { return Hash; }
+    [[nodiscard]] const Components& GetComponents() const noexcept { return Parts; }
+    [[nodiscard]] u32 GetPagesRehashed() const noexcept { return PagesRehashed; }
+
+private:
+    void HashSmallState(Components& parts) const noexcept;
+    void UpdateWriteTracking() noexcept;
+
+    melonDS::NDS& NDS;
+    bool Enabled = false;
+    bool ForceFull = true;
+    u32 TrackingRequests = 0;
+    u32 PagesRehashed = 0;
+
+    u64 Hash = 0;
+    Components Parts {};
+
+    // generation 0 is older than any copy, so nothing reads as written
+    // before the first MarkAllDirty()
+    u32 WriteGen = 1;
+    u32 AllWrittenGen = 0;
+    u32 HashedGen = 0;
+    u32 PageWriteGen[kMaxPages] {};
+    u64 PageHashes[kMaxPages] {};
+};
+
+}
+
+#endif // STATEHASH_H
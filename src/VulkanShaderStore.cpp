@@ -0,0 +1,113 @@
+/*
+    Copyright 2016-2026 melonDS team
+
+    This file is part of melonDS.
+
+    melonDS is free software: you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the Free
+    Software Foundation, either version 3 of the License, or (at your option)
+    any later version.
+
+    melonDS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with melonDS. If not, see http://www.gnu.org/licenses/.
+*/
+
+#include "VulkanShaderStore.h"
+
+#if defined(MELONPRIME_DS) && defined(MELONPRIME_ENABLE_VULKAN)
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <new>
+
+#include <zstd.h>
+
+#include "Platform.h"
+
+namespace melonDS::Vk
+{
+
+using Platform::Log;
+using Platform::LogLevel;
+
+namespace
+{
+
+struct InflatedModule
+{
+    std::once_flag Once;
+    std::unique_ptr<u32[]> Words;
+};
+
+InflatedModule Inflated[VulkanShaders::ModuleCount];
+
+std::atomic<u32> InflatedCount {0};
+std::atomic<u64> InflatedCompressedBytes {0};
+std::atomic<u64> InflatedBytes {0};
+std::atomic<u64> InflateNanoseconds {0};
+
+void Inflate(const VulkanShaders::ShaderModule& module, InflatedModule& slot)
+{
+    const auto start = std::chrono::steady_clock::now();
+    const size_t bytes = static_cast<size_t>(module.WordCount) * sizeof(u32);
+
+    auto words = std::make_unique<u32[]>(module.WordCount);
+    const size_t size = ZSTD_decompress(words.get(), bytes, module.Data, module.DataBytes);
+    if (ZSTD_isError(size) || size != bytes)
+    {
+        Log(LogLevel::Error,
+            "[Vulkan] shader module %u doesn't inflate to %u words: %s\n",
+            module.Index, module.WordCount,
+            ZSTD_isError(size) ? ZSTD_getErrorName(size) : "wrong size");
+        return;
+    }
+
+    slot.Words = std::move(words);
+    InflatedCount.fetch_add(1, std::memory_order_relaxed);
+    InflatedCompressedBytes.fetch_add(module.DataBytes, std::memory_order_relaxed);
+    InflatedBytes.fetch_add(bytes, std::memory_order_relaxed);
+    InflateNanoseconds.fetch_add(static_cast<u64>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count()), std::memory_order_relaxed);
+}
+
+} // namespace
+
+const u32* InflateShaderModule(const VulkanShaders::ShaderModule& module) noexcept
+{
+    if (module.Index >= VulkanShaders::ModuleCount || !module.Data || module.WordCount == 0)
+        return nullptr;
+
+    InflatedModule& slot = Inflated[module.Index];
+    // call_once only throws if the callable does, and a failed allocation is
+    // the one way Inflate() can; that is treated like a bad frame.
+    try
+    {
+        std::call_once(slot.Once, Inflate, module, slot);
+    }
+    catch (const std::bad_alloc&)
+    {
+        return nullptr;
+    }
+    return slot.Words.get();
+}
+
+ShaderInflateStats GetShaderInflateStats() noexcept
+{
+    ShaderInflateStats stats;
+    stats.Modules = InflatedCount.load(std::memory_order_relaxed);
+    stats.CompressedBytes = InflatedCompressedBytes.load(std::memory_order_relaxed);
+    stats.InflatedBytes = InflatedBytes.load(std::memory_order_relaxed);
+    stats.Nanoseconds = InflateNanoseconds.load(std::memory_order_relaxed);
+    return stats;
+}
+
+} // namespace melonDS::Vk
+
+#endif // MELONPRIME_DS && MELONPRIME_ENABLE_VULKAN
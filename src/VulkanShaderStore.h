@@ -0,0 +1,52 @@
+/*
+    Copyright 2016-2026 melonDS team
+
+    This file is part of melonDS.
+
+    melonDS is free software: you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the Free
+    Software Foundation, either version 3 of the License, or (at your option)
+    any later version.
+
+    melonDS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with melonDS. If not, see http://www.gnu.org/licenses/.
+*/
+
+#ifndef VULKAN_SHADER_STORE_H
+#define VULKAN_SHADER_STORE_H
+
+#if defined(MELONPRIME_DS) && defined(MELONPRIME_ENABLE_VULKAN)
+
+#include "types.h"
+#include "GPU3D_Vulkan_ShaderModules.h"
+
+namespace melonDS::Vk
+{
+
+// The generated compute modules are committed as zstd frames (see
+// tools/vulkan/compile-shaders.py). Each one is inflated the first time a
+// pipeline is built from it and kept for the rest of the process, so a module
+// shared by several pipelines or tile-geometry buckets is inflated once.
+//
+// Safe to call from any thread. Returns nullptr, after logging why, if the
+// frame does not inflate to the recorded word count.
+const u32* InflateShaderModule(const VulkanShaders::ShaderModule& module) noexcept;
+
+struct ShaderInflateStats
+{
+    u32 Modules = 0;            // inflated so far, out of VulkanShaders::ModuleCount
+    u64 CompressedBytes = 0;
+    u64 InflatedBytes = 0;
+    u64 Nanoseconds = 0;        // spent in the decoder, summed across threads
+};
+
+ShaderInflateStats GetShaderInflateStats() noexcept;
+
+} // namespace melonDS::Vk
+
+#endif // MELONPRIME_DS && MELONPRIME_ENABLE_VULKAN
+#endif // VULKAN_SHADER_STORE_H
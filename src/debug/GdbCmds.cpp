@@ -589,8 +589,8 @@ ExecResult GdbStub::Handle_Question(GdbStub* stub, const u8* cmd, ssize_t len)
 				//stub->RespFmt("T%02Xhwbreak:"/*"%08X"*/";", GdbSignal::TRAP/*, arg*/);
 				break;
 			case 2:
-				stub->RespFmt("S%02X", GdbSignal::TRAP);
-				//stub->RespFmt("T%02Xwatch:"/*"%08X"*/";", GdbSignal::TRAP/*, arg*/);
+				stub->RespFmt("T%02X%s:%08X;", GdbSignal::TRAP,
+						stub->CurWatchptKind == 3 ? "rwatch" : stub->CurWatchptKind == 4 ? "awatch" : "watch", arg);
 				break;
 			default:
 				stub->RespFmt("S%02X", GdbSignal::TRAP);
@@ -662,7 +662,7 @@ ExecResult GdbStub::Handle_z(GdbStub* stub, const u8* cmd, ssize_t len)
 	case 0: case 1: // remove breakpoint (we cheat & always insert a hardware breakpoint)
 		stub->DelBkpt(addr, kind);
 		break;
-	case 2: case 3: case 4: // watchpoint. currently not distinguishing between reads & writes oops
+	case 2: case 3: case 4: // watchpoint: write, read, access
 		stub->DelWatchpt(addr, kind, typ);
 		break;
 	default:
@@ -690,7 +690,7 @@ ExecResult GdbStub::Handle_Z(GdbStub* stub, const u8* cmd, ssize_t len)
 	case 0: case 1: // insert breakpoint (we cheat & always insert a hardware breakpoint)
 		stub->AddBkpt(addr, kind);
 		break;
-	case 2: case 3: case 4: // watchpoint. currently not distinguishing between reads & writes oops
+	case 2: case 3: case 4: // watchpoint: write, read, access
 		stub->AddWatchpt(addr, kind, typ);
 		break;
 	default:
@@ -58,7 +58,7 @@ namespace Gdb
 GdbStub::GdbStub(StubCallbacks* cb)
 	: Cb(cb), Port(0)
 	, SockFd(0), ConnFd(0)
-	, Stat(TgtStatus::None), CurBkpt(0), CurWatchpt(0), StatFlag(false), NoAck(false)
+	, Stat(TgtStatus::None), CurBkpt(0), CurWatchpt(0), CurWatchptKind(0), StatFlag(false), NoAck(false)
 	, ServerSA((void*)new struct sockaddr_in())
 	, ClientSA((void*)new struct sockaddr_in())
 { }
@@ -553,6 +553,7 @@ void GdbStub::AddBkpt(u32 addr, int kind)
 	}
 
 	BpList.insert({np.addr, np});
+	Cb->BreakpointsChanged();
 
 	Log(LogLevel::Debug, "[GDB] added bkpt:\n");
 	size_t i = 0;
@@ -573,16 +574,22 @@ void GdbStub::AddWatchpt(u32 addr, u32 len, int kind)
 		if (search->addr > addr)
 		{
 			WpList.insert(search, np);
+			Cb->BreakpointsChanged();
 			return;
 		}
 		else if (search->addr == addr && search->kind == kind)
 		{
-			if (search->len < len) search->len = len;
+			if (search->len < len)
+			{
+				search->len = len;
+				Cb->BreakpointsChanged();
+			}
 			return;
 		}
 	}
 
 	WpList.push_back(np);
+	Cb->BreakpointsChanged();
 }
 
 void GdbStub::DelBkpt(u32 addr, int kind)
@@ -593,6 +600,7 @@ void GdbStub::DelBkpt(u32 addr, int kind)
 	if (search != BpList.end())
 	{
 		BpList.erase(search);
+		Cb->BreakpointsChanged();
 	}
 }
 void GdbStub::DelWatchpt(u32 addr, u32 len, int kind)
@@ -604,6 +612,7 @@ void GdbStub::DelWatchpt(u32 addr, u32 len, int kind)
 		if (search->addr == addr && search->kind == kind)
 		{
 			WpList.erase(search);
+			Cb->BreakpointsChanged();
 			return;
 		}
 		else if (search->addr > addr) return;
@@ -612,8 +621,10 @@ void GdbStub::DelWatchpt(u32 addr, u32 len, int kind)
 
 void GdbStub::DelAllBpWp()
 {
+	bool changed = !BpList.empty() || !WpList.empty();
 	BpList.erase(BpList.begin(), BpList.end());
 	WpList.erase(WpList.begin(), WpList.end());
+	if (changed) Cb->BreakpointsChanged();
 }
 
 StubState GdbStub::CheckBkpt(u32 addr, bool enter, bool stay)
@@ -635,24 +646,33 @@ StubState GdbStub::CheckBkpt(u32 addr, bool enter, bool stay)
 		return StubState::None;
 	}
 }
-StubState GdbStub::CheckWatchpt(u32 addr, int kind, bool enter, bool stay)
+const GdbStub::BpWp* GdbStub::FindWatchpt(u32 addr, u32 len, int kind) const
 {
 	for (auto search = WpList.begin(); search != WpList.end(); ++search)
 	{
-		if (search->addr > addr) break;
+		if (search->addr >= addr + len) break;
 
-		if (addr >= search->addr && addr < search->addr + search->len && search->kind == kind)
-		{
-			if (enter) return Enter(stay, TgtStatus::Watchpt, addr);
-			else
-			{
-				SignalStatus(TgtStatus::Watchpt, addr);
-				return StubState::None;
-			}
-		}
+		if (addr < search->addr + search->len
+			&& (kind == 4 || search->kind == 4 || search->kind == kind))
+			return &*search;
 	}
 
-	return StubState::CheckNoHit;
+	return NULL;
+}
+StubState GdbStub::CheckWatchpt(u32 addr, u32 len, int kind, bool enter, bool stay)
+{
+	const BpWp* wp = FindWatchpt(addr, len, kind);
+	if (!wp) return StubState::CheckNoHit;
+
+	// report the watched address the access touched, gdb looks it up by that
+	u32 hit = addr > wp->addr ? addr : wp->addr;
+	CurWatchptKind = wp->kind;
+	if (enter) return Enter(stay, TgtStatus::Watchpt, hit);
+	else
+	{
+		SignalStatus(TgtStatus::Watchpt, hit);
+		return StubState::None;
+	}
 }
 
 int GdbStub::Resp(const u8* data1, size_t len1, const u8* data2, size_t len2)
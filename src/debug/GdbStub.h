@@ -50,6 +50,9 @@ public:
 
 	virtual void ResetGdb() = 0;
 	virtual int RemoteCmd(const u8* cmd, size_t len) = 0;
+
+	// a breakpoint or watchpoint was added or removed
+	virtual void BreakpointsChanged() {}
 };
 
 enum class StubState
@@ -128,14 +131,20 @@ public:
 	// kind: 2=thumb, 3=thumb2 (not relevant), 4=arm
 	void AddBkpt(u32 addr, int kind);
 	void DelBkpt(u32 addr, int kind);
-	// kind: 2=read, 3=write, 4=rdwr
+	// kind: 2=write, 3=read, 4=rdwr
 	void AddWatchpt(u32 addr, u32 len, int kind);
 	void DelWatchpt(u32 addr, u32 len, int kind);
 
 	void DelAllBpWp();
 
 	StubState CheckBkpt(u32 addr, bool enter, bool stay);
-	StubState CheckWatchpt(u32 addr, int kind, bool enter, bool stay);
+	StubState CheckWatchpt(u32 addr, u32 len, int kind, bool enter, bool stay);
+
+	bool HasBkpt(u32 addr) const { return !BpList.empty() && BpList.count(addr & ~(u32)1); }
+	bool HasWatchpts() const { return !WpList.empty(); }
+	// the first watchpoint overlapping addr..addr+len-1 that fires on an
+	// access of the given kind (4 matches any watchpoint), NULL if none
+	const BpWp* FindWatchpt(u32 addr, u32 len, int kind) const;
 
 #include "GdbCmds.h"
 
@@ -181,6 +190,7 @@ private:
 
 	TgtStatus Stat;
 	u32 CurBkpt, CurWatchpt;
+	int CurWatchptKind;
 	bool StatFlag;
 	bool NoAck;
 
@@ -0,0 +1,420 @@
+/*
+    Copyright 2016-2026 melonDS team
+
+    This file is part of melonDS.
+
+    melonDS is free software: you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the Free
+    Software Foundation, either version 3 of the License, or (at your option)
+    any later version.
+
+    melonDS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with melonDS. If not, see http://www.gnu.org/licenses/.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SCALER_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#define SCALER_NEON
+#include <arm_neon.h>
+#endif
+
+#include "SoftwareScaler.h"
+
+using namespace melonDS;
+
+// all kernels compute (c0 * (256-w) + c1 * w) >> 8 per 8-bit channel, with
+// no intermediate rounding, so the SIMD and scalar paths match bit for bit
+
+static inline u32 LerpPixel(u32 p0, u32 p1, u32 w1)
+{
+    u32 w0 = 256 - w1;
+    u32 rb = (((p0 & 0x00FF00FF) * w0 + (p1 & 0x00FF00FF) * w1) >> 8) & 0x00FF00FF;
+    u32 ag = (((p0 >> 8) & 0x00FF00FF) * w0 + ((p1 >> 8) & 0x00FF00FF) * w1) & 0xFF00FF00;
+    return rb | ag;
+}
+
+static void LerpRows(u32* dst, const u32* r0, const u32* r1, int n, u32 w1, bool simd)
+{
+    int i = 0;
+#if defined(SCALER_SSE2)
+    if (simd)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i w0v = _mm_set1_epi16((short)(256 - w1));
+        const __m128i w1v = _mm_set1_epi16((short)w1);
+        for (; i + 4 <= n; i += 4)
+        {
+            __m128i a = _mm_loadu_si128((const __m128i*)&r0[i]);
+            __m128i b = _mm_loadu_si128((const __m128i*)&r1[i]);
+            __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(a, zero), w0v),
+                                       _mm_mullo_epi16(_mm_unpacklo_epi8(b, zero), w1v));
+            __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(a, zero), w0v),
+                                       _mm_mullo_epi16(_mm_unpackhi_epi8(b, zero), w1v));
+            _mm_storeu_si128((__m128i*)&dst[i],
+                _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8)));
+        }
+    }
+#elif defined(SCALER_NEON)
+    if (simd)
+    {
+        const u16 w0 = 256 - w1;
+        for (; i + 4 <= n; i += 4)
+        {
+            uint8x16_t a = vld1q_u8((const u8*)&r0[i]);
+            uint8x16_t b = vld1q_u8((const u8*)&r1[i]);
+            uint16x8_t lo = vmlaq_n_u16(vmulq_n_u16(vmovl_u8(vget_low_u8(a)), w0), vmovl_u8(vget_low_u8(b)), (u16)w1);
+            uint16x8_t hi = vmlaq_n_u16(vmulq_n_u16(vmovl_u8(vget_high_u8(a)), w0), vmovl_u8(vget_high_u8(b)), (u16)w1);
+            vst1q_u8((u8*)&dst[i], vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8)));
+        }
+    }
+#endif
+    for (; i < n; i++)
+        dst[i] = LerpPixel(r0[i], r1[i], w1);
+}
+
+SoftwareScaler::SoftwareScaler(int numThreads)
+{
+    if (numThreads <= 0)
+    {
+        // the emu thread, the 3D render thread and the GUI thread are busy
+        // already; a few helpers are plenty for a memory bound job
+        int hw = (int)std::thread::hardware_concurrency();
+        numThreads = std::clamp(hw - 2, 1, 4);
+    }
+
+    Scratch.resize(numThreads);
+    for (int i = 1; i < numThreads; i++)
+        Workers.emplace_back([this, i]() { WorkerFunc(i); });
+}
+
+SoftwareScaler::~SoftwareScaler()
+{
+    {
+        std::lock_guard<std::mutex> guard(Lock);
+        Quit = true;
+    }
+    WorkReady.notify_all();
+    for (std::thread& worker : Workers)
+        worker.join();
+}
+
+void SoftwareScaler::WorkerFunc(int index)
+{
+    u64 seen = 0;
+    std::unique_lock<std::mutex> lock(Lock);
+    for (;;)
+    {
+        WorkReady.wait(lock, [&]() { return Quit || Generation != seen; });
+        if (Quit) return;
+        seen = Generation;
+
+        while (NextBand < NumBands)
+        {
+            int band = NextBand++;
+            const auto* job = CurrentJob;
+            lock.unlock();
+            (*job)(band, Scratch[index]);
+            lock.lock();
+            if (--BandsLeft == 0)
+                WorkDone.notify_one();
+        }
+    }
+}
+
+void SoftwareScaler::RunBands(const std::function<void(int, std::vector<u32>&)>& func, int bands)
+{
+    if (bands <= 1 || Workers.empty())
+    {
+        for (int i = 0; i < bands; i++)
+            func(i, Scratch[0]);
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(Lock);
+    CurrentJob = &func;
+    NumBands = bands;
+    NextBand = 0;
+    BandsLeft = bands;
+    Generation++;
+    WorkReady.notify_all();
+
+    // lend a hand instead of just waiting
+    while (NextBand < NumBands)
+    {
+        int band = NextBand++;
+        lock.unlock();
+        func(band, Scratch[0]);
+        lock.lock();
+        BandsLeft--;
+    }
+    WorkDone.wait(lock, [&]() { return BandsLeft == 0; });
+    CurrentJob = nullptr;
+}
+
+void SoftwareScaler::BuildAxis(Axis& axis, double scale, double offset, int srcSize, int dstSize, ScreenScaleFilter filter)
+{
+    // target pixels whose centers fall within the screen
+    double lo = std::min(offset, offset + scale * srcSize);
+    double hi = std::max(offset, offset + scale * srcSize);
+    axis.Start = std::clamp((int)std::ceil(lo - 0.5), 0, dstSize);
+    axis.End = std::clamp((int)std::ceil(hi - 0.5), axis.Start, dstSize);
+
+    int n = axis.End - axis.Start;
+    axis.Index0.resize(n);
+    axis.Index1.resize(n);
+    axis.Weight.resize(n);
+
+    // sharp bilinear: blend only across the band that remains around each
+    // texel edge after nearest upscaling by the largest integer factor
+    double prescale = std::max(1.0, std::floor(std::fabs(scale)));
+    double region = 0.5 - 0.5 / prescale;
+
+    for (int i = 0; i < n; i++)
+    {
+        // source position of the target pixel's center, in texels
+        double u = (axis.Start + i + 0.5 - offset) / scale;
+
+        if (filter == screenScale_Nearest)
+        {
+            int t = std::clamp((int)std::floor(u), 0, srcSize - 1);
+            axis.Index0[i] = axis.Index1[i] = t;
+            axis.Weight[i] = 0;
+            continue;
+        }
+
+        if (filter == screenScale_SharpBilinear)
+        {
+            double texel = std::floor(u);
+            double dist = (u - texel) - 0.5;
+            u = texel + (dist - std::clamp(dist, -region, region)) * prescale + 0.5;
+        }
+
+        double pos = u - 0.5;
+        int t = (int)std::floor(pos);
+        double f = pos - t;
+        if (t < 0)
+        {
+            t = 0;
+            f = 0;
+        }
+        else if (t >= srcSize - 1)
+        {
+            t = srcSize - 1;
+            f = 0;
+        }
+
+        int w = (int)std::lround(f * 256);
+        if (w >= 256)
+        {
+            t++;
+            w = 0;
+        }
+        axis.Index0[i] = t;
+        axis.Index1[i] = std::min(t + 1, srcSize - 1);
+        axis.Weight[i] = w;
+    }
+}
+
+void SoftwareScaler::BuildRuns()
+{
+    RunsX.clear();
+    int n = AxisX.End - AxisX.Start;
+    for (int i = 0; i < n; )
+    {
+        int start = i;
+        int index = AxisX.Index0[i];
+        while (i < n && AxisX.Index0[i] == index) i++;
+        RunsX.push_back({start, i - start, index});
+    }
+}
+
+void SoftwareScaler::BuildWeightVectors()
+{
+    int n = AxisX.End - AxisX.Start;
+    WeightVecX.resize(n * 8);
+    for (int i = 0; i < n; i++)
+    {
+        u16 w1 = AxisX.Weight[i];
+        for (int c = 0; c < 4; c++)
+        {
+            WeightVecX[i*8 + c] = 256 - w1;
+            WeightVecX[i*8 + 4 + c] = w1;
+        }
+    }
+}
+
+void SoftwareScaler::DrawRows(const Job& job, int y0, int y1, std::vector<u32>& tmp)
+{
+    const int n = AxisX.End - AxisX.Start;
+    const bool simd = UseSIMD;
+    tmp.resize(job.SrcWidth);
+
+    const u32* prevOut = nullptr;
+    int prevIndex = -1, prevWeight = -1;
+
+    for (int y = y0; y < y1; y++)
+    {
+        u32* out = job.Dst + (size_t)y * job.DstStride + AxisX.Start;
+        int yy = y - AxisY.Start;
+        int i0 = AxisY.Index0[yy];
+        int w = AxisY.Weight[yy];
+
+        // integer and near-integer scales repeat rows a lot
+        if (prevOut && i0 == prevIndex && w == prevWeight)
+        {
+            memcpy(out, prevOut, n * sizeof(u32));
+            continue;
+        }
+        prevOut = out;
+        prevIndex = i0;
+        prevWeight = w;
+
+        const u32* row = job.Src + (size_t)i0 * job.SrcStride;
+        if (w)
+        {
+            LerpRows(tmp.data(), row, job.Src + (size_t)AxisY.Index1[yy] * job.SrcStride, job.SrcWidth, w, simd);
+            row = tmp.data();
+        }
+
+        if (job.Nearest)
+        {
+            for (const Run& run : RunsX)
+            {
+                u32* dst = out + run.Start;
+                u32 pixel = row[run.Index];
+                int k = 0;
+#if defined(SCALER_SSE2)
+                if (simd)
+                {
+                    __m128i v = _mm_set1_epi32((int)pixel);
+                    for (; k + 4 <= run.Length; k += 4)
+                        _mm_storeu_si128((__m128i*)&dst[k], v);
+                }
+#elif defined(SCALER_NEON)
+                if (simd)
+                {
+                    uint32x4_t v = vdupq_n_u32(pixel);
+                    for (; k + 4 <= run.Length; k += 4)
+                        vst1q_u32(&dst[k], v);
+                }
+#endif
+                for (; k < run.Length; k++)
+                    dst[k] = pixel;
+            }
+            continue;
+        }
+
+        const int* x0 = AxisX.Index0.data();
+        const int* x1 = AxisX.Index1.data();
+        int x = 0;
+#if defined(SCALER_SSE2)
+        if (simd)
+        {
+            const __m128i zero = _mm_setzero_si128();
+            const u16* wv = WeightVecX.data();
+            for (; x + 2 <= n; x += 2)
+            {
+                __m128i p = _mm_set_epi32((int)row[x1[x+1]], (int)row[x0[x+1]], (int)row[x1[x]], (int)row[x0[x]]);
+                __m128i a = _mm_mullo_epi16(_mm_unpacklo_epi8(p, zero), _mm_loadu_si128((const __m128i*)&wv[x*8]));
+                __m128i b = _mm_mullo_epi16(_mm_unpackhi_epi8(p, zero), _mm_loadu_si128((const __m128i*)&wv[x*8 + 8]));
+                a = _mm_add_epi16(a, _mm_srli_si128(a, 8));
+                b = _mm_add_epi16(b, _mm_srli_si128(b, 8));
+                __m128i r = _mm_srli_epi16(_mm_unpacklo_epi64(a, b), 8);
+                _mm_storel_epi64((__m128i*)&out[x], _mm_packus_epi16(r, r));
+            }
+        }
+#elif defined(SCALER_NEON)
+        if (simd)
+        {
+            const u16* wv = WeightVecX.data();
+            for (; x < n; x++)
+            {
+                uint32x2_t p = vset_lane_u32(row[x1[x]], vdup_n_u32(row[x0[x]]), 1);
+                uint16x8_t v = vmulq_u16(vmovl_u8(vreinterpret_u8_u32(p)), vld1q_u16(&wv[x*8]));
+                uint16x4_t s = vshr_n_u16(vadd_u16(vget_low_u16(v), vget_high_u16(v)), 8);
+                uint8x8_t r = vmovn_u16(vcombine_u16(s, s));
+                out[x] = vget_lane_u32(vreinterpret_u32_u8(r), 0);
+            }
+        }
+#endif
+        for (; x < n; x++)
+            out[x] = LerpPixel(row[x0[x]], row[x1[x]], AxisX.Weight[x]);
+    }
+}
+
+bool SoftwareScaler::Draw(u32* dst, int dstWidth, int dstHeight, int dstStride,
+                          const u32* src, int srcWidth, int srcHeight, int srcStride,
+                          const float* mtx, ScreenScaleFilter filter)
+{
+    const double a = mtx[0], b = mtx[1], c = mtx[2], d = mtx[3];
+    const double tx = mtx[4], ty = mtx[5];
+    const double eps = 1e-6 * std::max(1.0, std::fabs(a) + std::fabs(b) + std::fabs(c) + std::fabs(d));
+
+    if (srcWidth < 1 || srcHeight < 1)
+        return true;
+
+    // target pixels per source texel along each target axis
+    double sx, sy;
+    if (std::fabs(b) < eps && std::fabs(c) < eps)
+    {
+        sx = a * 256.0 / srcWidth;
+        sy = d * 192.0 / srcHeight;
+    }
+    else if (std::fabs(a) < eps && std::fabs(d) < eps)
+    {
+        // rotated by 90 or 270 degrees: target X follows the source Y and
+        // the other way around, so transpose the source and scale that
+        Transposed.resize((size_t)srcWidth * srcHeight);
+        for (int y = 0; y < srcHeight; y++)
+        {
+            const u32* in = src + (size_t)y * srcStride;
+            for (int x = 0; x < srcWidth; x++)
+                Transposed[(size_t)x * srcHeight + y] = in[x];
+        }
+        sx = c * 192.0 / srcHeight;
+        sy = b * 256.0 / srcWidth;
+        src = Transposed.data();
+        std::swap(srcWidth, srcHeight);
+        srcStride = srcWidth;
+    }
+    else
+        return false;
+
+    if (std::fabs(sx) < eps || std::fabs(sy) < eps)
+        return true;
+
+    BuildAxis(AxisX, sx, tx, srcWidth, dstWidth, filter);
+    BuildAxis(AxisY, sy, ty, srcHeight, dstHeight, filter);
+    int cols = AxisX.End - AxisX.Start;
+    int rows = AxisY.End - AxisY.Start;
+    if (cols <= 0 || rows <= 0)
+        return true;
+
+    const bool nearest = (filter == screenScale_Nearest);
+    if (nearest)
+        BuildRuns();
+    else
+        BuildWeightVectors();
+
+    Job job {dst, dstStride, src, srcWidth, srcStride, nearest};
+
+    // not worth waking the workers for small windows
+    int bands = ((size_t)cols * rows >= 128 * 1024) ? std::min(GetNumThreads() * 2, rows) : 1;
+    RunBands([&](int band, std::vector<u32>& tmp)
+    {
+        int y0 = AxisY.Start + (int)((s64)rows * band / bands);
+        int y1 = AxisY.Start + (int)((s64)rows * (band + 1) / bands);
+        DrawRows(job, y0, y1, tmp);
+    }, bands);
+    return true;
+}
@@ -0,0 +1,115 @@
+/*
+    Copyright 2016-2026 melonDS team
+
+    This file is part of melonDS.
+
+    melonDS is free software: you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the Free
+    Software Foundation, either version 3 of the License, or (at your option)
+    any later version.
+
+    melonDS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with melonDS. If not, see http://www.gnu.org/licenses/.
+*/
+
+#ifndef SOFTWARESCALER_H
+#define SOFTWARESCALER_H
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "types.h"
+
+enum ScreenScaleFilter
+{
+    screenScale_Nearest,
+    screenScale_SharpBilinear, // nearest to the largest integer scale, bilinear for the rest
+    screenScale_Bilinear,
+    screenScale_MAX,
+};
+
+// CPU scaler for presenting the DS screens without GPU help.
+//
+// Draws a screen image through a ScreenLayout transform straight into a
+// 32-bit target the size of the display. Transforms are expected to be
+// axis aligned, which all ScreenLayout rotations are; the 90/270 degree ones
+// are handled by transposing the source first. Rows are split across
+// worker threads, and the per-pixel work uses SSE2 or NEON where available.
+class SoftwareScaler
+{
+public:
+    // numThreads: 0 to pick from the hardware, 1 to stay on the calling thread
+    explicit SoftwareScaler(int numThreads = 0);
+    ~SoftwareScaler();
+    SoftwareScaler(const SoftwareScaler&) = delete;
+    SoftwareScaler& operator=(const SoftwareScaler&) = delete;
+
+    // draws a srcWidth x srcHeight image (XRGB8888, strides in pixels) showing
+    // one 256x192 DS screen, through the 2x3 matrix 'mtx' as returned by
+    // ScreenLayout::GetScreenTransforms (in target pixels)
+    // pixels outside the screen are left alone
+    // returns false without drawing if the transform isn't axis aligned
+    bool Draw(melonDS::u32* dst, int dstWidth, int dstHeight, int dstStride,
+              const melonDS::u32* src, int srcWidth, int srcHeight, int srcStride,
+              const float* mtx, ScreenScaleFilter filter);
+
+    int GetNumThreads() const { return 1 + (int)Workers.size(); }
+
+    // scalar code only, as a reference for the SIMD kernels
+    void SetUseSIMD(bool enable) { UseSIMD = enable; }
+
+private:
+    struct Axis
+    {
+        int Start = 0, End = 0;         // target range covered
+        std::vector<int> Index0;        // per target pixel: source texels
+        std::vector<int> Index1;
+        std::vector<melonDS::u16> Weight;   // of Index1, out of 256
+    };
+
+    struct Job
+    {
+        melonDS::u32* Dst;
+        int DstStride;
+        const melonDS::u32* Src;
+        int SrcWidth, SrcStride;
+        bool Nearest;
+    };
+
+    static void BuildAxis(Axis& axis, double scale, double offset, int srcSize, int dstSize, ScreenScaleFilter filter);
+    void BuildRuns();
+    void BuildWeightVectors();
+    void DrawRows(const Job& job, int y0, int y1, std::vector<melonDS::u32>& tmp);
+    void RunBands(const std::function<void(int band, std::vector<melonDS::u32>& tmp)>& func, int bands);
+    void WorkerFunc(int index);
+
+    bool UseSIMD = true;
+
+    Axis AxisX, AxisY;
+    // runs of target pixels showing the same source texel, for nearest
+    struct Run { int Start, Length, Index; };
+    std::vector<Run> RunsX;
+    // per target column: 8 x u16 weights, 4 for Index0 then 4 for Index1
+    std::vector<melonDS::u16> WeightVecX;
+    std::vector<melonDS::u32> Transposed;
+
+    std::vector<std::thread> Workers;
+    std::vector<std::vector<melonDS::u32>> Scratch;
+    std::mutex Lock;
+    std::condition_variable WorkReady, WorkDone;
+    const std::function<void(int, std::vector<melonDS::u32>&)>* CurrentJob = nullptr;
+    int NumBands = 0;
+    int NextBand = 0;
+    int BandsLeft = 0;
+    melonDS::u64 Generation = 0;
+    bool Quit = false;
+};
+
+#endif // SOFTWARESCALER_H
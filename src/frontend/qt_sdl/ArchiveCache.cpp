@@ -0,0 +1,508 @@
+/*
+    Copyright 2016-2026 melonDS team
+
+    This file is part of melonDS.
+
+    melonDS is free software: you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the Free
+    Software Foundation, either version 3 of the License, or (at your option)
+    any later version.
+
+    melonDS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with melonDS. If not, see http://www.gnu.org/licenses/.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <memory>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+
+#include <archive.h>
+#include <archive_entry.h>
+
+#include "ArchiveCache.h"
+#include "Platform.h"
+#include "xxhash/xxhash.h"
+
+using namespace melonDS;
+using namespace melonDS::Platform;
+namespace fs = std::filesystem;
+
+namespace
+{
+
+constexpr size_t kChunkSize = 1024 * 1024;
+constexpr auto kProgressInterval = std::chrono::milliseconds(50);
+constexpr const char* kListHeader = "melonDS archive list 1";
+
+u64 MicrosecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count();
+}
+
+archive* OpenArchive(const std::string& path)
+{
+    archive* a = archive_read_new();
+    archive_read_support_filter_all(a);
+    archive_read_support_format_all(a);
+#ifdef _WIN32
+    int r = archive_read_open_filename_w(a, fs::u8path(path).c_str(), 10240);
+#else
+    int r = archive_read_open_filename(a, path.c_str(), 10240);
+#endif
+    if (r != ARCHIVE_OK)
+    {
+        archive_read_free(a);
+        return nullptr;
+    }
+    return a;
+}
+
+bool LessCI(const ArchiveCache::Entry& a, const ArchiveCache::Entry& b)
+{
+    return std::lexicographical_compare(a.Name.begin(), a.Name.end(), b.Name.begin(), b.Name.end(),
+        [](unsigned char x, unsigned char y) { return std::tolower(x) < std::tolower(y); });
+}
+
+// unique per writer, so two instances extracting the same entry don't
+// write into each other's file
+std::string TempPath(const std::string& path)
+{
+    char suffix[32];
+    snprintf(suffix, sizeof(suffix), ".%zx.tmp", std::hash<std::thread::id>()(std::this_thread::get_id()));
+    return path + suffix;
+}
+
+}
+
+ArchiveCache::ArchiveCache(std::string dir, u64 maxBytes)
+    : Dir(std::move(dir)), MaxBytes(maxBytes)
+{
+}
+
+bool ArchiveCache::ArchiveKey(const std::string& archive, u64& key) const
+{
+    std::error_code ec;
+    fs::path path = fs::absolute(fs::u8path(archive), ec);
+    if (ec) return false;
+    u64 size = fs::file_size(path, ec);
+    if (ec) return false;
+    auto mtime = fs::last_write_time(path, ec);
+    if (ec) return false;
+
+    std::string id = path.u8string();
+    u64 stamp[2] = { size, (u64)mtime.time_since_epoch().count() };
+    id.append(reinterpret_cast<const char*>(stamp), sizeof(stamp));
+    key = XXH3_64bits(id.data(), id.size());
+    return true;
+}
+
+std::string ArchiveCache::EntryPath(u64 archiveKey, const std::string& entry) const
+{
+    char name[64];
+    snprintf(name, sizeof(name), "%016llx-%016llx.bin", (unsigned long long)archiveKey,
+             (unsigned long long)XXH3_64bits_withSeed(entry.data(), entry.size(), archiveKey));
+    return (fs::u8path(Dir) / name).u8string();
+}
+
+std::string ArchiveCache::ListPath(u64 archiveKey) const
+{
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.list", (unsigned long long)archiveKey);
+    return (fs::u8path(Dir) / name).u8string();
+}
+
+bool ArchiveCache::ScanArchive(const std::string& archive, std::vector<Entry>& entries) const
+{
+    ::archive* a = OpenArchive(archive);
+    if (!a) return false;
+
+    archive_entry* entry;
+    int r;
+    while ((r = archive_read_next_header(a, &entry)) == ARCHIVE_OK)
+    {
+        if (archive_entry_filetype(entry) != AE_IFREG)
+            continue;
+
+        const char* name = archive_entry_pathname_utf8(entry);
+        if (name)
+            entries.push_back({name, (u64)archive_entry_size(entry)});
+        archive_read_data_skip(a);
+    }
+    archive_read_close(a);
+    archive_read_free(a);
+
+    if (r != ARCHIVE_EOF)
+    {
+        Log(LogLevel::Error, "ArchiveCache: failed to list %s\n", archive.c_str());
+        return false;
+    }
+    std::stable_sort(entries.begin(), entries.end(), LessCI);
+    return true;
+}
+
+bool ArchiveCache::List(const std::string& archive, std::vector<Entry>& entries)
+{
+    entries.clear();
+    u64 key;
+    if (!ArchiveKey(archive, key))
+        return false;
+
+    {
+        std::lock_guard<std::mutex> guard(Lock);
+        auto it = Listings.find(key);
+        if (it != Listings.end())
+        {
+            Totals.ListHits++;
+            entries = it->second;
+            return true;
+        }
+    }
+
+    // one "size name" line per entry
+    std::string listPath = ListPath(key);
+    if (FileHandle* f = OpenFile(listPath, FileMode::ReadText))
+    {
+        char line[4096];
+        bool valid = FileReadLine(line, sizeof(line), f) && strncmp(line, kListHeader, strlen(kListHeader)) == 0;
+        while (valid && FileReadLine(line, sizeof(line), f))
+        {
+            char* name = nullptr;
+            unsigned long long size = strtoull(line, &name, 10);
+            if (*name != ' ')
+            {
+                valid = false;
+                break;
+            }
+            name++;
+            name[strcspn(name, "\r\n")] = '\0';
+            entries.push_back({name, size});
+        }
+        CloseFile(f);
+
+        if (valid)
+        {
+            std::error_code ec;
+            fs::last_write_time(fs::u8path(listPath), fs::file_time_type::clock::now(), ec);
+            std::lock_guard<std::mutex> guard(Lock);
+            Totals.ListHits++;
+            Listings[key] = entries;
+            return true;
+        }
+        entries.clear();
+    }
+
+    if (!ScanArchive(archive, entries))
+        return false;
+
+    std::error_code ec;
+    fs::create_directories(fs::u8path(Dir), ec);
+    std::string tempPath = TempPath(listPath);
+    if (FileHandle* f = OpenFile(tempPath, FileMode::WriteText))
+    {
+        FileWriteFormatted(f, "%s\n", kListHeader);
+        for (const Entry& e : entries)
+            FileWriteFormatted(f, "%llu %s\n", (unsigned long long)e.Size, e.Name.c_str());
+        if (CloseFile(f))
+            fs::rename(fs::u8path(tempPath), fs::u8path(listPath), ec);
+        else
+            fs::remove(fs::u8path(tempPath), ec);
+    }
+
+    std::lock_guard<std::mutex> guard(Lock);
+    Listings[key] = entries;
+    return true;
+}
+
+bool ArchiveCache::Contains(const std::string& archive, const std::string& entry)
+{
+    u64 key;
+    if (!ArchiveKey(archive, key))
+        return false;
+    std::error_code ec;
+    return fs::exists(fs::u8path(EntryPath(key, entry)), ec);
+}
+
+bool ArchiveCache::ExtractEntry(const std::string& archive, const std::string& entry, const std::string& dest,
+                                const ProgressCallback& progress, bool& storeFailed)
+{
+    std::mutex lock;
+    std::condition_variable finished;
+    bool done = false;
+    bool ok = false;
+    storeFailed = false;
+    std::atomic<u64> written = 0;
+    std::atomic<u64> total = 0;
+    std::atomic<bool> cancel = false;
+    std::string tempPath = TempPath(dest);
+
+    std::thread worker([&]
+    {
+        bool result = [&]
+        {
+            ::archive* a = OpenArchive(archive);
+            if (!a)
+            {
+                Log(LogLevel::Error, "ArchiveCache: failed to open %s\n", archive.c_str());
+                return false;
+            }
+
+            archive_entry* header = nullptr;
+            bool found = false;
+            while (archive_read_next_header(a, &header) == ARCHIVE_OK)
+            {
+                const char* name = archive_entry_pathname_utf8(header);
+                if (name && entry == name)
+                {
+                    found = true;
+                    break;
+                }
+            }
+            if (!found)
+            {
+                Log(LogLevel::Error, "ArchiveCache: %s has no entry %s\n", archive.c_str(), entry.c_str());
+                archive_read_free(a);
+                return false;
+            }
+            total = (u64)archive_entry_size(header);
+
+            FileHandle* f = OpenFile(tempPath, FileMode::Write);
+            if (!f)
+            {
+                Log(LogLevel::Error, "ArchiveCache: failed to open %s for writing\n", tempPath.c_str());
+                archive_read_free(a);
+                storeFailed = true;
+                return false;
+            }
+
+            auto buffer = std::make_unique<u8[]>(kChunkSize);
+            bool res = true;
+            for (;;)
+            {
+                if (cancel)
+                {
+                    res = false;
+                    break;
+                }
+                la_ssize_t len = archive_read_data(a, buffer.get(), kChunkSize);
+                if (len == 0)
+                    break;
+                if (len < 0)
+                {
+                    Log(LogLevel::Error, "ArchiveCache: error whilst reading %s: %s\n", archive.c_str(),
+                        archive_error_string(a));
+                    res = false;
+                    break;
+                }
+                if (FileWrite(buffer.get(), len, 1, f) != 1)
+                {
+                    Log(LogLevel::Error, "ArchiveCache: failed to write %s\n", tempPath.c_str());
+                    storeFailed = true;
+                    res = false;
+                    break;
+                }
+                written += len;
+            }
+            if (!CloseFile(f) && res)
+            {
+                storeFailed = true;
+                res = false;
+            }
+            archive_read_close(a);
+            archive_read_free(a);
+            return res;
+        }();
+
+        std::lock_guard<std::mutex> guard(lock);
+        ok = result;
+        done = true;
+        finished.notify_one();
+    });
+
+    {
+        std::unique_lock<std::mutex> guard(lock);
+        while (!finished.wait_for(guard, kProgressInterval, [&] { return done; }))
+        {
+            if (progress && !cancel)
+            {
+                guard.unlock();
+                if (!progress(written, total))
+                    cancel = true;
+                guard.lock();
+            }
+        }
+    }
+    worker.join();
+
+    std::error_code ec;
+    if (ok)
+    {
+        if (progress)
+            progress(written, total);
+        fs::rename(fs::u8path(tempPath), fs::u8path(dest), ec);
+        if (!ec)
+            return true;
+        Log(LogLevel::Error, "ArchiveCache: failed to replace %s: %s\n", dest.c_str(), ec.message().c_str());
+        storeFailed = true;
+    }
+    else if (cancel)
+    {
+        Log(LogLevel::Info, "ArchiveCache: extraction of %s cancelled\n", entry.c_str());
+    }
+    fs::remove(fs::u8path(tempPath), ec);
+    return false;
+}
+
+std::string ArchiveCache::Lookup(const std::string& archive, const std::string& entry)
+{
+    u64 key;
+    if (!ArchiveKey(archive, key))
+        return {};
+    std::string path = EntryPath(key, entry);
+    fs::path fspath = fs::u8path(path);
+
+    std::error_code ec;
+    if (!fs::exists(fspath, ec))
+        return {};
+    // for Trim(), which goes by modification time
+    fs::last_write_time(fspath, fs::file_time_type::clock::now(), ec);
+    std::lock_guard<std::mutex> guard(Lock);
+    Totals.Hits++;
+    return path;
+}
+
+bool ArchiveCache::StoreFailed(const std::string& archive, const std::string& entry)
+{
+    u64 key;
+    if (!ArchiveKey(archive, key))
+        return false;
+    std::lock_guard<std::mutex> guard(Lock);
+    return FailedStores.count(EntryPath(key, entry)) != 0;
+}
+
+std::string ArchiveCache::Fetch(const std::string& archive, const std::string& entry,
+                                const ProgressCallback& progress)
+{
+    std::string cached = Lookup(archive, entry);
+    if (!cached.empty())
+        return cached;
+
+    u64 key;
+    if (!ArchiveKey(archive, key))
+    {
+        Log(LogLevel::Error, "ArchiveCache: can't access %s\n", archive.c_str());
+        return {};
+    }
+    std::string path = EntryPath(key, entry);
+    fs::path fspath = fs::u8path(path);
+    {
+        // the cache couldn't take this entry before, the caller reads the
+        // archive itself instead of extracting it again
+        std::lock_guard<std::mutex> guard(Lock);
+        if (FailedStores.count(path))
+            return {};
+    }
+
+    std::error_code ec;
+    fs::create_directories(fs::u8path(Dir), ec);
+    auto start = std::chrono::steady_clock::now();
+    bool storeFailed;
+    if (!ExtractEntry(archive, entry, path, progress, storeFailed))
+    {
+        if (storeFailed)
+        {
+            std::lock_guard<std::mutex> guard(Lock);
+            FailedStores.insert(path);
+            Totals.StoreFailures++;
+        }
+        return {};
+    }
+    u64 elapsed = MicrosecondsSince(start);
+    u64 size = fs::file_size(fspath, ec);
+
+    {
+        std::lock_guard<std::mutex> guard(Lock);
+        Totals.Misses++;
+        Totals.BytesExtracted += size;
+        Totals.ExtractUS += elapsed;
+    }
+    Log(LogLevel::Info, "ArchiveCache: extracted %s (%llu bytes) in %.1f ms\n", entry.c_str(),
+        (unsigned long long)size, elapsed / 1000.0);
+
+    Trim(path);
+    return path;
+}
+
+void ArchiveCache::Trim(const std::string& keep)
+{
+    struct CachedFile
+    {
+        fs::path Path;
+        u64 Size;
+        fs::file_time_type Time;
+        std::string ArchiveKey;     // the first 16 hex digits of the name
+    };
+    std::vector<CachedFile> files;
+    // per archive: how many extracted copies are left, and its listing
+    std::unordered_map<std::string, u32> copies;
+    std::unordered_map<std::string, CachedFile> lists;
+    u64 total = 0;
+
+    std::error_code ec;
+    for (const fs::directory_entry& e : fs::directory_iterator(fs::u8path(Dir), ec))
+    {
+        const fs::path ext = e.path().extension();
+        if ((ext != ".bin" && ext != ".list") || !e.is_regular_file(ec))
+            continue;
+        CachedFile file = { e.path(), (u64)e.file_size(ec), e.last_write_time(ec),
+                            e.path().stem().u8string().substr(0, 16) };
+        total += file.Size;
+        if (ext == ".bin")
+            copies[file.ArchiveKey]++;
+        else
+            lists[file.ArchiveKey] = file;
+        files.push_back(std::move(file));
+    }
+    if (total <= MaxBytes)
+        return;
+
+    std::sort(files.begin(), files.end(), [](const CachedFile& a, const CachedFile& b) { return a.Time < b.Time; });
+    fs::path keepPath = fs::u8path(keep);
+    for (const CachedFile& file : files)
+    {
+        if (total <= MaxBytes)
+            break;
+        if (!keep.empty() && file.Path == keepPath)
+            continue;
+        if (!fs::remove(file.Path, ec))
+            continue;
+        total -= file.Size;
+
+        // an archive's listing goes with its last extracted copy
+        if (file.Path.extension() == ".bin" && --copies[file.ArchiveKey] == 0)
+        {
+            auto list = lists.find(file.ArchiveKey);
+            if (list != lists.end() && fs::remove(list->second.Path, ec))
+                total -= list->second.Size;
+        }
+    }
+}
+
+ArchiveCache::Stats ArchiveCache::GetStats() const
+{
+    std::lock_guard<std::mutex> guard(Lock);
+    return Totals;
+}
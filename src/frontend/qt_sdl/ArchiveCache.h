@@ -0,0 +1,117 @@
+/*
+    Copyright 2016-2026 melonDS team
+
+    This file is part of melonDS.
+
+    melonDS is free software: you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the Free
+    Software Foundation, either version 3 of the License, or (at your option)
+    any later version.
+
+    melonDS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with melonDS. If not, see http://www.gnu.org/licenses/.
+*/
+
+#ifndef ARCHIVECACHE_H
+#define ARCHIVECACHE_H
+
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "types.h"
+
+// Extracted copies of files inside ROM archives, kept in a directory so
+// that booting the same zipped ROM again loads a plain file (which can be
+// mapped) instead of decompressing the archive every time.
+//
+// Everything is keyed by the archive's absolute path, size and modification
+// time, so replacing or touching an archive makes its old entries stale;
+// those are removed by Trim() like any other old file. Archive listings are
+// cached the same way, so the archive picker doesn't rescan either.
+class ArchiveCache
+{
+public:
+    struct Entry
+    {
+        std::string Name;
+        melonDS::u64 Size;
+    };
+
+    struct Stats
+    {
+        melonDS::u64 Hits = 0;
+        melonDS::u64 Misses = 0;
+        melonDS::u64 ListHits = 0;
+        melonDS::u64 BytesExtracted = 0;
+        melonDS::u64 ExtractUS = 0;
+        melonDS::u64 StoreFailures = 0;
+    };
+
+    // Called on the thread that called Fetch() while an extraction runs, with
+    // the bytes written so far and the entry's size. Returning false cancels
+    // the extraction.
+    using ProgressCallback = std::function<bool(melonDS::u64 done, melonDS::u64 total)>;
+
+    ArchiveCache(std::string dir, melonDS::u64 maxBytes);
+
+    // The regular files in an archive, sorted case-insensitively. Returns
+    // false if the archive can't be read.
+    bool List(const std::string& archive, std::vector<Entry>& entries);
+
+    // Path of an extracted copy of `entry`, extracting it first if there
+    // isn't one yet. The extraction is streamed to disk on a worker thread
+    // while this thread reports progress. Returns an empty string if the
+    // entry can't be extracted or the extraction was cancelled.
+    //
+    // If the copy couldn't be written (e.g. the cache directory isn't
+    // writable), that is remembered, and later calls for the same entry
+    // return an empty string straight away so the caller can read the
+    // archive into memory instead of extracting it once more.
+    std::string Fetch(const std::string& archive, const std::string& entry,
+                      const ProgressCallback& progress = {});
+
+    // Path of an existing extracted copy of `entry`, or an empty string.
+    // Never extracts anything.
+    std::string Lookup(const std::string& archive, const std::string& entry);
+
+    // Whether a Fetch() of `entry` failed to store its copy.
+    [[nodiscard]] bool StoreFailed(const std::string& archive, const std::string& entry);
+
+    // Whether Fetch() would return without extracting anything.
+    [[nodiscard]] bool Contains(const std::string& archive, const std::string& entry);
+
+    // Deletes the least recently used extracted files and listings until the
+    // cache is under its size limit, sparing `keep`. An archive's listing is
+    // deleted along with the last extracted copy from it.
+    void Trim(const std::string& keep = {});
+
+    [[nodiscard]] Stats GetStats() const;
+    [[nodiscard]] const std::string& Directory() const noexcept { return Dir; }
+
+private:
+    bool ArchiveKey(const std::string& archive, melonDS::u64& key) const;
+    std::string EntryPath(melonDS::u64 archiveKey, const std::string& entry) const;
+    std::string ListPath(melonDS::u64 archiveKey) const;
+
+    bool ScanArchive(const std::string& archive, std::vector<Entry>& entries) const;
+    bool ExtractEntry(const std::string& archive, const std::string& entry, const std::string& dest,
+                      const ProgressCallback& progress, bool& storeFailed);
+
+    std::string Dir;
+    melonDS::u64 MaxBytes;
+
+    mutable std::mutex Lock;
+    std::unordered_map<melonDS::u64, std::vector<Entry>> Listings;
+    std::unordered_set<std::string> FailedStores;   // entry paths
+    Stats Totals;
+};
+
+#endif // ARCHIVECACHE_H
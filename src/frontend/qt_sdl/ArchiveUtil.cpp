@@ -17,6 +17,7 @@
 */
 
 #include "ArchiveUtil.h"
+#include "ArchiveCache.h"
 #include "Platform.h"
 
 using namespace melonDS;
@@ -32,6 +33,18 @@ namespace Archive
 #define melon_archive_open(a, f, b) archive_read_open_filename(a, f.toUtf8().constData(), b)
 #endif // __WIN32__
 
+std::unique_ptr<ArchiveCache> Cache;
+
+void SetCache(std::unique_ptr<ArchiveCache> cache)
+{
+    Cache = std::move(cache);
+}
+
+ArchiveCache* GetCache()
+{
+    return Cache.get();
+}
+
 bool compareCI(const QString& s1, const QString& s2)
 {
     return s1.toLower() < s2.toLower();
@@ -45,6 +58,18 @@ QVector<QString> ListArchive(QString path)
 
     QVector<QString> fileList;
 
+    if (Cache)
+    {
+        std::vector<ArchiveCache::Entry> entries;
+        if (!Cache->List(path.toStdString(), entries))
+            return QVector<QString> {"Err"};
+
+        fileList.push_back("OK");
+        for (const ArchiveCache::Entry& entry : entries)
+            fileList.push_back(QString::fromStdString(entry.Name));
+        return fileList;
+    }
+
     a = archive_read_new();
 
     archive_read_support_filter_all(a);
@@ -122,6 +147,33 @@ QVector<QString> ExtractFileFromArchive(QString path, QString wantedFile, QByteA
 
 s32 ExtractFileFromArchive(QString path, QString wantedFile, std::unique_ptr<u8[]>& filedata, u32* filesize)
 {
+    if (Cache)
+    {
+        // if the cache can't be written, extract straight from the archive;
+        // Fetch() remembers that and doesn't try to store the entry again
+        std::string cached = Cache->Fetch(path.toStdString(), wantedFile.toStdString());
+        Platform::FileHandle* f = cached.empty() ? nullptr : Platform::OpenFile(cached, Platform::FileMode::Read);
+        if (f)
+        {
+            u64 len = Platform::FileLength(f);
+            if (len > 0x40000000)
+            {
+                Platform::CloseFile(f);
+                return -1;
+            }
+            filedata = std::make_unique<u8[]>(len);
+            size_t nread = Platform::FileRead(filedata.get(), len, 1, f);
+            Platform::CloseFile(f);
+            if (len > 0 && nread != 1)
+            {
+                filedata = nullptr;
+                return -1;
+            }
+            if (filesize) *filesize = (u32)len;
+            return (s32)len;
+        }
+    }
+
     struct archive *a = archive_read_new();
     struct archive_entry *entry;
     int r;
@@ -32,12 +32,19 @@
 
 #include "types.h"
 
+class ArchiveCache;
+
 namespace Archive
 {
 
 using namespace melonDS;
 QVector<QString> ListArchive(QString path);
 s32 ExtractFileFromArchive(QString path, QString wantedFile, std::unique_ptr<u8[]>& filedata, u32* filesize);
+
+// Extracted files and listings are kept in this cache when one is set,
+// and read back from it instead of the archive.
+void SetCache(std::unique_ptr<ArchiveCache> cache);
+ArchiveCache* GetCache();
 //QVector<QString> ExtractFileFromArchive(QString path, QString wantedFile, QByteArray *romBuffer);
 //u32 ExtractFileFromArchive(const char* path, const char* wantedFile, u8 **romdata);
 
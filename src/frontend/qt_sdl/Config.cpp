@@ -85,6 +85,7 @@ namespace Config
         {"Instance*.Firmware.BirthdayDay", 1},
         {"MP.AudioMode", 1},
         {"MP.RecvTimeout", 25},
+        {"ArchiveCache.MaxSizeMB", 4096},
         {"Instance*.Audio.Volume", 256},
         {"Mic.InputType", 1},
         {"Mouse.HideSeconds", 5},
@@ -172,6 +173,7 @@ namespace Config
         {"Emu.ConsoleType", {0, 1}},
         {"3D.Renderer", {0, renderer3D_Max - 1}},
         {"Screen.VSyncInterval", {1, 20}},
+        {"Screen.SoftwareScaleFilter", {0, 3}},
         {"3D.GL.ScaleFactor", {1, 16}},
     #ifdef MELONPRIME_DS
         {MelonPrime::CfgKey::NvidiaReflexMode, {0, 2}},
@@ -219,6 +221,7 @@ namespace Config
         {"Screen.Filter", true},
     #endif
         {"3D.Soft.Threaded", true},
+        {"3D.Soft.Deferred2D", false},
     #ifdef MELONPRIME_DS
         // Keep menu and other non-match screens on the software renderer when
         // requested. Vulkan enables this behavior at runtime without changing
@@ -234,6 +237,7 @@ namespace Config
         {"LimitFPS", true},
         {"Instance*.Window*.ShowOSD", true},
         {"Emu.DirectBoot", true},
+        {"ArchiveCache.Enable", true},
         {"Instance*.DS.Battery.LevelOkay", true},
         {"Instance*.DSi.Battery.Charging", true},
     #ifdef MELONPRIME_DS
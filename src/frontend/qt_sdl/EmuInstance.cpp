@@ -20,7 +20,9 @@
 #include <stdio.h>
 #include <string.h>
 
+#include <chrono>
 #include <codecvt>
+#include <filesystem>
 #include <locale>
 #include <memory>
 #include <tuple>
@@ -33,6 +35,7 @@
 #include <zstd.h>
 #ifdef ARCHIVE_SUPPORT_ENABLED
 #include "ArchiveUtil.h"
+#include "ArchiveCache.h"
 #endif
 #include "EmuInstance.h"
 #include "Config.h"
@@ -52,6 +55,7 @@
 #ifdef MELONPRIME_DS
 #include "MelonPrimeDef.h"
 #include "MelonPrimeVideoBackend.h"
+#include "MelonPrimePerfProbe.h"
 #include "MelonPrimeHudPropSchema.inc"
 
 namespace {
@@ -129,6 +133,19 @@ EmuInstance::EmuInstance(int inst) : deleting(false),
         Config::Save();
     }
 
+    stateWriter.SetResultCallback([this](const SavestateWriter::Result& result)
+    {
+        if (result.OK)
+            MelonPrimePerf::LogSavestate("save-write", 0.0,
+                result.CompressUS / 1000.0, result.WriteUS / 1000.0, result.RawBytes, result.FileBytes);
+        else
+        {
+            // the save was already reported as done when it was queued
+            std::string name = std::filesystem::u8path(result.Path).filename().u8string();
+            osdAddMessage(0xFFA0A0, "State save failed, couldn't write %s", name.c_str());
+        }
+    });
+
     ndsSave = nullptr;
     cartType = -1;
     baseROMDir = "";
@@ -220,6 +237,9 @@ EmuInstance::EmuInstance(int inst) : deleting(false),
 EmuInstance::~EmuInstance()
 {
     deleting = true;
+    // saves still being written don't report to the windows from here on
+    stateWriter.SetResultCallback(nullptr);
+    stateWriter.WaitAll();
     deleteAllWindows();
 
     emuThread->emuExit();
@@ -842,15 +862,19 @@ std::string EmuInstance::getSavestateName(int slot)
 bool EmuInstance::savestateExists(int slot)
 {
     std::string ssfile = getSavestateName(slot);
-    return Platform::FileExists(ssfile);
+    return Platform::FileExists(ssfile) || stateWriter.IsPending(ssfile);
 }
 
 bool EmuInstance::loadState(const std::string& filename)
 {
-    Platform::FileHandle* file = Platform::OpenFile(filename, Platform::FileMode::Read);
-    if (file == nullptr)
+    const auto start = std::chrono::steady_clock::now();
+
+    // a save to the same file may still be on its way to the disk
+    stateWriter.Wait(filename);
+
+    SavestateFileReader file;
+    if (!file.Open(filename))
     { // If we couldn't open the state file...
-        Platform::Log(Platform::LogLevel::Error, "Failed to open state file \"%s\"\n", filename.c_str());
         return false;
     }
 
@@ -858,34 +882,20 @@ bool EmuInstance::loadState(const std::string& filename)
     if (backup->Error)
     { // If we couldn't allocate memory for the backup...
         Platform::Log(Platform::LogLevel::Error, "Failed to allocate memory for state backup\n");
-        Platform::CloseFile(file);
         return false;
     }
 
     if (!nds->DoSavestate(backup.get()) || backup->Error)
     { // Back up the emulator's state. If that failed...
         Platform::Log(Platform::LogLevel::Error, "Failed to back up state, aborting load (from \"%s\")\n", filename.c_str());
-        Platform::CloseFile(file);
         return false;
     }
     // We'll store the backup once we're sure that the state was loaded.
     // Now that we know the file and backup are both good, let's load the new state.
 
-    // Get the size of the file that we opened
-    size_t size = Platform::FileLength(file);
-
-    // Allocate exactly as much memory as we need for the savestate
-    std::vector<u8> buffer(size);
-    if (Platform::FileRead(buffer.data(), size, 1, file) == 0)
-    { // Read the state file into the buffer. If that failed...
-        Platform::Log(Platform::LogLevel::Error, "Failed to read %u-byte state file \"%s\"\n", size, filename.c_str());
-        Platform::CloseFile(file);
-        return false;
-    }
-    Platform::CloseFile(file); // done with the file now
-
-    // Get ready to load the state from the buffer into the emulator
-    std::unique_ptr<Savestate> state = std::make_unique<Savestate>(buffer.data(), size, false);
+    // The state is read straight out of the file mapping (or the buffer it
+    // was inflated into), which stays alive until we return
+    std::unique_ptr<Savestate> state = std::make_unique<Savestate>(file.Data(), file.Length(), false);
 
     if (!nds->DoSavestate(state.get()) || state->Error)
     { // If we couldn't load the savestate from the buffer...
@@ -899,46 +909,39 @@ bool EmuInstance::loadState(const std::string& filename)
 
     savestateLoaded = true;
 
+    MelonPrimePerf::LogSavestate("load",
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count(),
+        file.InflateUS() / 1000.0, file.MapUS() / 1000.0, file.Length(), file.FileLength());
+
     return true;
 }
 
 bool EmuInstance::saveState(const std::string& filename)
 {
-    Platform::FileHandle* file = Platform::OpenFile(filename, Platform::FileMode::Write);
+    const auto start = std::chrono::steady_clock::now();
 
-    if (file == nullptr)
-    { // If the file couldn't be opened...
-        return false;
-    }
-
-    Savestate state;
-    if (state.Error)
+    std::unique_ptr<Savestate> state = std::make_unique<Savestate>();
+    if (state->Error)
     { // If there was an error creating the state (and allocating its memory)...
-        Platform::CloseFile(file);
         return false;
     }
 
     // Write the savestate to the in-memory buffer
-    nds->DoSavestate(&state);
+    nds->DoSavestate(state.get());
 
-    if (state.Error)
+    if (state->Error)
     {
-        Platform::CloseFile(file);
         return false;
     }
 
-    if (Platform::FileWrite(state.Buffer(), state.Length(), 1, file) == 0)
-    { // Write the Savestate buffer to the file. If that fails...
-        Platform::Log(Platform::Error,
-                      "Failed to write %d-byte savestate to %s\n",
-                      state.Length(),
-                      filename.c_str()
-        );
-        Platform::CloseFile(file);
-        return false;
-    }
+    // Compressing and writing it happens on the writer thread, which puts
+    // up an OSD message if the file can't be created or renamed into place.
+    const u32 length = state->Length();
+    stateWriter.Queue(filename, std::move(state), globalCfg.GetBool("Savestate.Compress"));
 
-    Platform::CloseFile(file);
+    MelonPrimePerf::LogSavestate("save",
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count(),
+        0.0, 0.0, length, 0);
 
     return true;
 }
@@ -1420,6 +1423,7 @@ bool EmuInstance::updateConsole() noexcept
             jitopt.GetBool("LiteralOptimisations"),
             jitopt.GetBool("BranchOptimisations"),
             jitopt.GetBool("FastMemory"),
+            jitopt.GetBool("HugePages"),
     };
     auto jitargs = jitopt.GetBool("Enable") ? std::make_optional(_jitargs) : std::nullopt;
 #else
@@ -2006,15 +2010,54 @@ QString EmuInstance::getSavErrorString(std::string& filepath, bool gba)
 
 bool EmuInstance::loadROM(QStringList filepath, bool reset, QString& errorstr)
 {
-    unique_ptr<u8[]> filedata = nullptr;
+    NDSCart::ROMStorage romdata;
     u32 filelen;
     std::string basepath;
     std::string romname;
 
-    if (!loadROMData(filepath, filedata, filelen, basepath, romname))
+    // A plain ROM file is mapped instead of read, so loading doesn't wait on
+    // the whole file and instances running the same ROM share its pages.
+    // ROMs inside archives are mapped from their extracted copy in the
+    // archive cache; compressed ROMs are still read into memory.
+    if (filepath.count() == 1 && !filepath.at(0).endsWith(".zst"))
     {
-        errorstr = "Failed to load the DS ROM.";
-        return false;
+        std::string filename = filepath.at(0).toStdString();
+        romdata = NDSCart::ROMStorage::MapFile(filename, filelen);
+        if (romdata)
+        {
+            int pos = lastSep(filename);
+            if (pos != -1)
+                basepath = filename.substr(0, pos);
+            romname = filename.substr(pos+1);
+        }
+    }
+#ifdef ARCHIVE_SUPPORT_ENABLED
+    else if (filepath.count() == 2 && Archive::GetCache())
+    {
+        std::string archivepath = filepath.at(0).toStdString();
+        std::string entryname = filepath.at(1).toStdString();
+        // extractArchiveROM() has already extracted it if the cache could
+        // take it; otherwise loadROMData() reads the archive into memory
+        std::string cached = Archive::GetCache()->Lookup(archivepath, entryname);
+        if (!cached.empty())
+            romdata = NDSCart::ROMStorage::MapFile(cached, filelen);
+        if (romdata)
+        {
+            basepath = archivepath.substr(0, lastSep(archivepath));
+            romname = entryname.substr(lastSep(entryname)+1);
+        }
+    }
+#endif
+
+    if (!romdata)
+    {
+        unique_ptr<u8[]> filedata = nullptr;
+        if (!loadROMData(filepath, filedata, filelen, basepath, romname))
+        {
+            errorstr = "Failed to load the DS ROM.";
+            return false;
+        }
+        romdata = NDSCart::ROMStorage(std::move(filedata));
     }
 
     ndsSave = nullptr;
@@ -2066,7 +2109,7 @@ bool EmuInstance::loadROM(QStringList filepath, bool reset, QString& errorstr)
             .SRAMLength = savelen,
     };
 
-    auto cart = NDSCart::ParseROM(std::move(filedata), filelen, this, std::move(cartargs));
+    auto cart = NDSCart::ParseROM(std::move(romdata), filelen, this, std::move(cartargs));
     if (!cart)
     {
         // If we couldn't parse the ROM...
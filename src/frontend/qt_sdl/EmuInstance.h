@@ -28,6 +28,8 @@
 #include "Window.h"
 #include "Config.h"
 #include "SaveManager.h"
+#include "FrameMailbox.h"
+#include "SavestateFile.h"
 #ifdef MELONPRIME_DS
 #include <atomic>
 #include <cstdint>
@@ -160,6 +162,8 @@ public:
     int getConsoleType() { return consoleType; }
     EmuThread* getEmuThread() { return emuThread; }
     melonDS::NDS* getNDS() { return nds; }
+    // software frames for the screen panel of the given window
+    FrameMailbox& getFrameMailbox(int window) { return frameMailbox[window]; }
 
     MainWindow* getMainWindow() { return mainWindow; }
     int getNumWindows() { return numWindows; }
@@ -372,6 +376,7 @@ private:
 
     MainWindow* mainWindow;
     MainWindow* windowList[kMaxWindows];
+    FrameMailbox frameMailbox[kMaxWindows];
     int numWindows;
 
     Config::Table globalCfg;
@@ -420,6 +425,7 @@ private:
 
     std::unique_ptr<melonDS::Savestate> backupState;
     bool savestateLoaded;
+    SavestateWriter stateWriter;
 
     std::unique_ptr<melonDS::ARCodeFile> cheatFile;
     bool cheatsOn;
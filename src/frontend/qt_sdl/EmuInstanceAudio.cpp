@@ -20,6 +20,7 @@
 #include "NDS.h"
 #include "SPU.h"
 #include "Platform.h"
+#include "MelonPrimeMetrics.h"
 #include "main.h"
 
 #include "mic_blow.h"
@@ -174,6 +175,8 @@ void EmuInstance::audioCallback(void* data, Uint8* stream, int len)
     int num_in = inst->nds->SPU.ReadOutput((s16*) stream, len_in);
     SDL_CondSignal(inst->audioSyncCond);
     SDL_UnlockMutex(inst->audioSyncLock);
+    if (MelonPrimeMetrics::IsEnabled())
+        MelonPrimeMetrics::Record(MelonPrimeMetrics::Metric::AudioFill, inst->nds->SPU.GetOutputSize());
 
     if ((num_in < 1) || inst->audioMutedByWindowFocus || inst->audioMutedToggle || inst->audioMutedByFastForward)
     {
@@ -556,20 +556,14 @@ void EmuSettingsDialog::on_chkEnableJIT_toggled()
 void EmuSettingsDialog::on_cbGdbEnabled_toggled()
 {
 #ifdef GDBSTUB_ENABLED
+    // the JIT stops at breakpoints and watched pages by itself
     bool disabled = !ui->cbGdbEnabled->isChecked();
-    bool jitenable = ui->chkEnableJIT->isChecked();
-
-    if (jitenable && !disabled) {
-        ui->cbGdbEnabled->setChecked(false);
-        disabled = true;
-    }
 #else
     bool disabled = true;
-    bool jitenable = true;
     ui->cbGdbEnabled->setChecked(false);
+    ui->cbGdbEnabled->setDisabled(true);
 #endif
 
-    ui->cbGdbEnabled->setDisabled(jitenable);
     ui->intGdbPortA7->setDisabled(disabled);
     ui->intGdbPortA9->setDisabled(disabled);
     ui->cbGdbBOSA7->setDisabled(disabled);
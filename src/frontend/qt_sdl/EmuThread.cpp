@@ -47,6 +47,7 @@
 #include "DSi_I2C.h"
 #include "GPU_Soft.h"
 #include "GPU_OpenGL.h"
+#include "MelonPrimeTrace.h"
 #if defined(MELONPRIME_DS)
 #include "MelonPrimeDef.h"
 #include "GPU3D_RasterDifferential.h"
@@ -65,8 +66,14 @@
 #include "MelonPrimeDX12FeatureCheck.h"
 #endif
 
+#include <QCoreApplication>
+#include <QFileInfo>
+#include <QProgressDialog>
+
 #include "Savestate.h"
 #include "EmuInstance.h"
+#include "ArchiveUtil.h"
+#include "ArchiveCache.h"
 
 #include "MelonPrimeEmuThreadIncludes.inc"
 
@@ -128,6 +135,7 @@ void EmuThread::run()
 {
     Config::Table& globalCfg = emuInstance->getGlobalConfig();
     u32 mainScreenPos[3];
+    MelonPrimeTrace::SetThreadName("Emu thread");
 
 #if defined(MELONPRIME_DS) && defined(MELONPRIME_ENABLE_DEVELOPER_FEATURES)
     const char* testSoftwareOpenGLDisplayOff =
@@ -735,6 +743,7 @@ void EmuThread::run()
 #endif
         emuInstance->drawScreen();
         MelonPrimePerf::MarkPresentEnd();
+        MelonPrimeTrace::Instant(MelonPrimeTrace::Category::Present, "Present");
 #if defined(MELONPRIME_DS) && defined(_WIN32) && defined(MELONPRIME_ENABLE_DX12)
         if (dx12LowLatencyRenderer)
         {
@@ -1407,10 +1416,23 @@ void EmuThread::handleMessages()
         case msg_EnableCheats:
             emuInstance->enableCheats(msg.param.value<bool>());
             break;
+
         }
 
         msgSemaphore.release();
     }
+
+    // RAM snapshots aren't in msgQueue, so waitMessage() and
+    // waitAllMessages() never count them
+    for (RAMSnapshotRequest* request : ramSnapshotRequests)
+    {
+        if (NDS* nds = emuInstance->getNDS())
+            request->Snapshot.assign(nds->MainRAM, nds->MainRAM + nds->MainRAMMask + 1);
+        else
+            request->Snapshot.clear();
+        request->Done.release();
+    }
+    ramSnapshotRequests.clear();
 #include "MelonPrimeEmuThreadHandleMessagesDrained.inc"
     msgMutex.unlock();
 
@@ -1605,8 +1627,50 @@ bool EmuThread::emuIsActive()
     return emuActive;
 }
 
+// A ROM picked from an archive is extracted into the archive cache here,
+// on the UI thread and with a progress dialog, before the emu thread is
+// asked to load it; the emu thread then only has to map the extracted copy.
+bool EmuThread::extractArchiveROM(const QStringList& filename, QString& errorstr)
+{
+#ifdef ARCHIVE_SUPPORT_ENABLED
+    ArchiveCache* cache = Archive::GetCache();
+    if (filename.size() != 2 || !cache)
+        return true;
+
+    std::string archive = filename.at(0).toStdString();
+    std::string entry = filename.at(1).toStdString();
+    if (cache->Contains(archive, entry) || cache->StoreFailed(archive, entry))
+        return true;
+
+    QProgressDialog dialog(QString("Extracting %1...").arg(QFileInfo(filename.at(1)).fileName()),
+                           "Cancel", 0, 1000, emuInstance->getMainWindow());
+    dialog.setWindowTitle("melonDS");
+    dialog.setWindowModality(Qt::WindowModal);
+    dialog.setMinimumDuration(300);
+
+    bool extracted = !cache->Fetch(archive, entry, [&](u64 done, u64 total)
+    {
+        if (total > 0)
+            dialog.setValue((int)(done * 1000 / total));
+        QCoreApplication::processEvents();
+        return !dialog.wasCanceled();
+    }).empty();
+
+    // any other failure is left to loadROM(), which reads the archive itself
+    if (!extracted && dialog.wasCanceled())
+    {
+        errorstr = "Extraction was cancelled.";
+        return false;
+    }
+#endif
+    return true;
+}
+
 int EmuThread::bootROM(const QStringList& filename, QString& errorstr)
 {
+    if (!extractArchiveROM(filename, errorstr))
+        return 0;
+
     sendMessage({ .type = msg_BootROM, .param = filename });
     waitMessage();
     if (!msgResult) {
@@ -1635,6 +1699,9 @@ int EmuThread::bootFirmware(QString& errorstr)
 
 int EmuThread::insertCart(const QStringList& filename, bool gba, QString& errorstr)
 {
+    if (!extractArchiveROM(filename, errorstr))
+        return 0;
+
     MessageType msgtype = gba ? msg_InsertGBACart : msg_InsertCart;
     sendMessage({ .type = msgtype, .param = filename });
     waitMessage();
@@ -1691,6 +1758,16 @@ void EmuThread::enableCheats(bool enable)
     waitMessage();
 }
 
+void EmuThread::takeRAMSnapshot(std::vector<u8>& snapshot)
+{
+    RAMSnapshotRequest request { snapshot };
+    msgMutex.lock();
+    ramSnapshotRequests.append(&request);
+    msgMutex.unlock();
+#include "MelonPrimeEmuThreadSendMessage.inc"
+    request.Done.acquire();
+}
+
 void EmuThread::updateRenderer()
 {
     auto nds = emuInstance->nds;
@@ -1813,6 +1890,7 @@ void EmuThread::updateRenderer()
         .Threaded = cfg.GetBool("3D.Soft.Threaded"),
         .HiresCoordinates = cfg.GetBool("3D.GL.HiresCoordinates"),
         .BetterPolygons = cfg.GetBool("3D.GL.BetterPolygons"),
+        .Deferred2D = cfg.GetBool("3D.Soft.Deferred2D"),
 #if defined(MELONPRIME_DS) && (defined(MELONPRIME_ENABLE_VULKAN) \
     || (defined(_WIN32) && defined(MELONPRIME_ENABLE_DX12)))
         .NvidiaReflexMode = cfg.GetInt(MelonPrime::CfgKey::NvidiaReflexMode),
@@ -1830,6 +1908,11 @@ void EmuThread::updateRenderer()
     };
     nds->GetRenderer().SetRenderSettings(settings);
 
+    // the GL renderers link most of their programs in Init() and when their
+    // settings change
+    if (useOpenGL)
+        OpenGL::SaveShaderCache();
+
 #include "MelonPrimeEmuThreadUpdateRendererAfter.inc"
 }
 
@@ -1846,6 +1929,15 @@ void EmuThread::compileShaders()
     } while (renderer.NeedsShaderCompile() &&
         (SDL_GetPerformanceCounter() - startTime) * perfCountsSec < 1.0 / 6.0);
     emuInstance->osdAddMessage(0, "Compiling shader %d/%d", currentShader + 1, shadersCount);
+
+    if (!renderer.NeedsShaderCompile())
+    {
+        OpenGL::ShaderCacheStats stats = OpenGL::GetShaderCacheStats();
+        Platform::Log(Platform::LogLevel::Info,
+            "OpenGL: shaders ready, %u from the cache in %.1f ms, %u compiled in %.1f ms, %u rejected\n",
+            stats.Restored, stats.RestoreUS / 1000.0, stats.Compiled, stats.CompileUS / 1000.0, stats.Rejected);
+        OpenGL::SaveShaderCache();
+    }
 }
 
 #if defined(MELONPRIME_DS) && defined(_WIN32) && defined(MELONPRIME_ENABLE_DX12)
@@ -31,6 +31,7 @@
 #include <variant>
 #include <optional>
 #include <list>
+#include <vector>
 
 #include "NDSCart.h"
 #include "GBACart.h"
@@ -143,6 +144,12 @@ public:
 
     void enableCheats(bool enable);
 
+    // copies main RAM between two frames, so the copy is one consistent
+    // state; empty if there is no console. Can be called from any thread
+    // but the emu thread; it waits on a semaphore of its own, so it doesn't
+    // take msgSemaphore permits the GUI thread is waiting for.
+    void takeRAMSnapshot(std::vector<melonDS::u8>& snapshot);
+
     bool emuIsRunning();
     bool emuIsActive();
 
@@ -190,6 +197,7 @@ private:
 
     void updateRenderer();
     void compileShaders();
+    bool extractArchiveROM(const QStringList& filename, QString& errorstr);
 #if defined(MELONPRIME_DS) && defined(_WIN32) && defined(MELONPRIME_ENABLE_DX12)
     bool handleDX12RuntimeFailure();
 #endif
@@ -216,6 +224,14 @@ private:
     QMutex msgMutex;
     QSemaphore msgSemaphore;
     QQueue<Message> msgQueue;
+
+    struct RAMSnapshotRequest
+    {
+        std::vector<melonDS::u8>& Snapshot;
+        QSemaphore Done { 0 };
+    };
+    // guarded by msgMutex, handled with the messages
+    QList<RAMSnapshotRequest*> ramSnapshotRequests;
 #ifdef MELONPRIME_DS
     // P-46: Fast-path flag for handleMessages().
     // Set (release) in sendMessage() before enqueue; cleared (relaxed) after
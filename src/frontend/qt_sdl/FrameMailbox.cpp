@@ -0,0 +1,100 @@
+/*
+    Copyright 2016-2026 melonDS team
+
+    This file is part of melonDS.
+
+    melonDS is free software: you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the Free
+    Software Foundation, either version 3 of the License, or (at your option)
+    any later version.
+
+    melonDS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with melonDS. If not, see http://www.gnu.org/licenses/.
+*/
+
+#include <string.h>
+
+#include "FrameMailbox.h"
+#include "Platform.h"
+
+using namespace melonDS;
+
+void FrameMailbox::Swap() noexcept
+{
+    Slots[WriteIndex].Serial = NextSerial++;
+
+    u32 prev = Latest.exchange(WriteIndex | kFresh, std::memory_order_acq_rel);
+    if (prev & kFresh)
+        Dropped.fetch_add(1, std::memory_order_relaxed);
+    WriteIndex = prev & kIndexMask;
+
+    Published.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FrameMailbox::Publish(const void* top, const void* bottom, int width, int height) noexcept
+{
+    u64 start = Platform::GetUSCount();
+
+    Frame& slot = Slots[WriteIndex];
+    int pixels = width * height;
+    if (slot.Capacity < pixels)
+    {
+        slot.Top = std::make_unique<u32[]>(pixels);
+        slot.Bottom = std::make_unique<u32[]>(pixels);
+        slot.Capacity = pixels;
+    }
+
+    memcpy(slot.Top.get(), top, pixels * sizeof(u32));
+    memcpy(slot.Bottom.get(), bottom, pixels * sizeof(u32));
+    slot.Width = width;
+    slot.Height = height;
+    slot.Valid = true;
+    Swap();
+
+    ProducerUS.fetch_add(Platform::GetUSCount() - start, std::memory_order_relaxed);
+}
+
+void FrameMailbox::PublishEmpty() noexcept
+{
+    Frame& slot = Slots[WriteIndex];
+    slot.Valid = false;
+    Swap();
+}
+
+const FrameMailbox::Frame& FrameMailbox::Acquire(bool* fresh) noexcept
+{
+    u64 start = Platform::GetUSCount();
+
+    bool isnew = false;
+    if (Latest.load(std::memory_order_acquire) & kFresh)
+    {
+        // only the producer can change Latest in between, and it always
+        // leaves it fresh, so whatever comes back here is a new frame
+        u32 prev = Latest.exchange(ReadIndex, std::memory_order_acq_rel);
+        ReadIndex = prev & kIndexMask;
+        isnew = true;
+        Presented.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+        Repeated.fetch_add(1, std::memory_order_relaxed);
+
+    if (fresh) *fresh = isnew;
+    PresenterUS.fetch_add(Platform::GetUSCount() - start, std::memory_order_relaxed);
+    return Slots[ReadIndex];
+}
+
+FrameMailbox::Stats FrameMailbox::GetStats() const noexcept
+{
+    Stats stats;
+    stats.Published = Published.load(std::memory_order_relaxed);
+    stats.Presented = Presented.load(std::memory_order_relaxed);
+    stats.Dropped = Dropped.load(std::memory_order_relaxed);
+    stats.Repeated = Repeated.load(std::memory_order_relaxed);
+    stats.ProducerUS = ProducerUS.load(std::memory_order_relaxed);
+    stats.PresenterUS = PresenterUS.load(std::memory_order_relaxed);
+    return stats;
+}
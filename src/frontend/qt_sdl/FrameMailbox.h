@@ -0,0 +1,97 @@
+/*
+    Copyright 2016-2026 melonDS team
+
+    This file is part of melonDS.
+
+    melonDS is free software: you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the Free
+    Software Foundation, either version 3 of the License, or (at your option)
+    any later version.
+
+    melonDS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with melonDS. If not, see http://www.gnu.org/licenses/.
+*/
+
+#ifndef FRAMEMAILBOX_H
+#define FRAMEMAILBOX_H
+
+#include <atomic>
+#include <memory>
+
+#include "types.h"
+
+// Triple-buffered handoff of finished software frames from the emu thread
+// to one presenter (a screen panel on the GUI thread).
+//
+// The producer fills the slot it owns and swaps it with the shared "latest"
+// slot; the presenter swaps that with the slot it owns whenever a new frame
+// is waiting. Each slot belongs to exactly one side at a time, so neither
+// side ever locks or waits, and the presenter can use its slot in place
+// until its next Acquire().
+class FrameMailbox
+{
+public:
+    struct Frame
+    {
+        std::unique_ptr<melonDS::u32[]> Top;
+        std::unique_ptr<melonDS::u32[]> Bottom;
+        int Width = 0;
+        int Height = 0;
+        int Capacity = 0;       // in pixels
+        bool Valid = false;     // false: nothing to show
+        melonDS::u64 Serial = 0;
+    };
+
+    struct Stats
+    {
+        melonDS::u64 Published = 0;
+        melonDS::u64 Presented = 0;     // new frames picked up by the presenter
+        melonDS::u64 Dropped = 0;       // replaced before the presenter got to them
+        melonDS::u64 Repeated = 0;      // presenter repaints with no new frame
+        melonDS::u64 ProducerUS = 0;    // emu thread time spent handing frames over
+        melonDS::u64 PresenterUS = 0;   // GUI thread time spent picking them up
+    };
+
+    FrameMailbox() noexcept = default;
+    FrameMailbox(const FrameMailbox&) = delete;
+    FrameMailbox& operator=(const FrameMailbox&) = delete;
+
+    // producer side, emu thread only
+    // copies both screens (width x height, 32-bit) into the next slot and publishes it
+    void Publish(const void* top, const void* bottom, int width, int height) noexcept;
+    // publishes "no frame", e.g. when the renderer doesn't output to RAM
+    void PublishEmpty() noexcept;
+
+    // presenter side, one thread only
+    // returns the latest frame, which stays valid until the next call;
+    // 'fresh' tells whether it changed since the last call
+    const Frame& Acquire(bool* fresh = nullptr) noexcept;
+
+    [[nodiscard]] Stats GetStats() const noexcept;
+
+private:
+    static constexpr melonDS::u32 kFresh = 0x4;
+    static constexpr melonDS::u32 kIndexMask = 0x3;
+
+    void Swap() noexcept;
+
+    Frame Slots[3];
+    melonDS::u32 WriteIndex = 0;
+    melonDS::u32 ReadIndex = 1;
+    // index of the latest complete slot, plus kFresh if the presenter hasn't taken it yet
+    std::atomic<melonDS::u32> Latest {2};
+    melonDS::u64 NextSerial = 1;
+
+    std::atomic<melonDS::u64> Published {0};
+    std::atomic<melonDS::u64> Presented {0};
+    std::atomic<melonDS::u64> Dropped {0};
+    std::atomic<melonDS::u64> Repeated {0};
+    std::atomic<melonDS::u64> ProducerUS {0};
+    std::atomic<melonDS::u64> PresenterUS {0};
+};
+
+#endif // FRAMEMAILBOX_H
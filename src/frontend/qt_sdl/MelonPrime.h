@@ -385,6 +385,11 @@ namespace MelonPrime {
         {
             return *m_hudConfigState;
         }
+        // for work that can outlive the core (the HUD raster worker)
+        [[nodiscard]] std::shared_ptr<CustomHudConfigState> HudConfigStatePtr() const noexcept
+        {
+            return m_hudConfigState;
+        }
 #endif
 
         [[nodiscard]] MelonPrimeThreadBridge& ThreadBridge() noexcept { return m_threadBridge; }
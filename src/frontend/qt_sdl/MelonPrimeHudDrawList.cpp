@@ -0,0 +1,179 @@
+#ifdef MELONPRIME_CUSTOM_HUD
+
+#include "MelonPrimeHudDrawList.h"
+
+#include <cstring>
+
+#include <QPainter>
+#include <QTransform>
+
+namespace MelonPrime {
+
+namespace {
+
+// Border around every entry, filled with copies of the entry's edge pixels,
+// so bilinear sampling at an entry's edge clamps the way sampling the
+// original image does and never picks up a neighbour.
+constexpr int kGutter = 1;
+
+} // namespace
+
+HudAtlas::HudAtlas()
+    : Pixels(kSize, kSize, QImage::Format_ARGB32_Premultiplied)
+{
+    Pixels.fill(Qt::transparent);
+}
+
+QRect HudAtlas::Place(const QImage& image)
+{
+    const auto it = Entries.constFind(image.cacheKey());
+    if (it != Entries.constEnd())
+        return it.value();
+    if (Full)
+        return QRect();
+
+    const int boxW = image.width() + kGutter * 2;
+    const int boxH = image.height() + kGutter * 2;
+    if (boxW > kSize || boxH > kSize)
+        return QRect();
+
+    // first shelf that is tall enough and has room left, otherwise a new one
+    Shelf* shelf = nullptr;
+    for (Shelf& s : Shelves)
+    {
+        if (s.Height >= boxH && s.X + boxW <= kSize)
+        {
+            shelf = &s;
+            break;
+        }
+    }
+    if (!shelf)
+    {
+        if (NextShelfY + boxH > kSize)
+        {
+            Full = true;
+            return QRect();
+        }
+        Shelves.push_back({NextShelfY, boxH, 0});
+        NextShelfY += boxH;
+        shelf = &Shelves.back();
+    }
+
+    const QRect rect(shelf->X + kGutter, shelf->Y + kGutter, image.width(), image.height());
+    shelf->X += boxW;
+
+    const QImage src = (image.format() == QImage::Format_ARGB32_Premultiplied)
+        ? image : image.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+    const size_t rowBytes = static_cast<size_t>(rect.width()) * 4;
+    for (int y = 0; y < rect.height(); y++)
+    {
+        uint32_t* row = reinterpret_cast<uint32_t*>(Pixels.scanLine(rect.y() + y)) + rect.x();
+        std::memcpy(row, src.constScanLine(y), rowBytes);
+        row[-1] = row[0];
+        row[rect.width()] = row[rect.width() - 1];
+    }
+    const size_t boxBytes = rowBytes + kGutter * 2 * 4;
+    const int boxX = (rect.x() - kGutter) * 4;
+    std::memcpy(Pixels.scanLine(rect.y() - 1) + boxX, Pixels.constScanLine(rect.y()) + boxX, boxBytes);
+    std::memcpy(Pixels.scanLine(rect.bottom() + 1) + boxX, Pixels.constScanLine(rect.bottom()) + boxX, boxBytes);
+
+    Entries.insert(image.cacheKey(), rect);
+    Dirty |= rect.adjusted(-kGutter, -kGutter, kGutter, kGutter);
+    return rect;
+}
+
+void HudAtlas::Clear()
+{
+    Pixels.fill(Qt::transparent);
+    Entries.clear();
+    Shelves.clear();
+    NextShelfY = 0;
+    Dirty = QRect();
+    Full = false;
+    Gen++;
+}
+
+QRect HudAtlas::TakeDirty()
+{
+    const QRect dirty = Dirty;
+    Dirty = QRect();
+    return dirty;
+}
+
+void HudDrawList::Begin()
+{
+    if (AtlasImage.IsFull())
+        AtlasImage.Clear();
+    QuadList.clear();
+    PaintedRects.clear();
+    ListSerial++;
+}
+
+bool HudDrawList::Record(const QPainter* painter, const QImage& image, const QRectF& dst)
+{
+    if (image.isNull() || dst.isEmpty() || painter->opacity() <= 0.0)
+        return true;
+
+    // the instanced quads have no clip, no rotation and only blend over
+    const QTransform& xf = painter->transform();
+    if (xf.type() > QTransform::TxScale || xf.m11() <= 0.0 || xf.m22() <= 0.0)
+        return false;
+    if (painter->hasClipping() || painter->compositionMode() != QPainter::CompositionMode_SourceOver)
+        return false;
+
+    // The quads end up under the painter layer, so anything the painter drew
+    // earlier in the frame has to stay below this bitmap: draw it in order.
+    const QRectF out = xf.mapRect(dst);
+    const QRect cover = out.toAlignedRect().adjusted(-1, -1, 1, 1);
+    for (const QRect& painted : PaintedRects)
+    {
+        if (painted.intersects(cover))
+            return false;
+    }
+
+    const QRect src = AtlasImage.Place(image);
+    if (src.isEmpty())
+        return false;
+
+    HudQuad quad;
+    quad.X0 = static_cast<float>(out.left());
+    quad.Y0 = static_cast<float>(out.top());
+    quad.X1 = static_cast<float>(out.right());
+    quad.Y1 = static_cast<float>(out.bottom());
+    quad.U0 = static_cast<float>(src.x());
+    quad.V0 = static_cast<float>(src.y());
+    quad.U1 = static_cast<float>(src.x() + src.width());
+    quad.V1 = static_cast<float>(src.y() + src.height());
+    quad.Opacity = static_cast<float>(painter->opacity());
+    quad.Smooth = painter->testRenderHint(QPainter::SmoothPixmapTransform) ? 1.0f : 0.0f;
+    quad.Pad[0] = quad.Pad[1] = 0.0f;
+    QuadList.push_back(quad);
+    return true;
+}
+
+void HudDrawList::NotePainted(const QRect& deviceRect)
+{
+    if (!deviceRect.isEmpty())
+        PaintedRects.push_back(deviceRect);
+}
+
+void HudDrawList::Replay(QPainter& painter) const
+{
+    painter.save();
+    painter.resetTransform();
+    painter.setClipping(false);
+    painter.setCompositionMode(QPainter::CompositionMode_SourceOver);
+    for (const HudQuad& quad : QuadList)
+    {
+        painter.setOpacity(quad.Opacity);
+        painter.setRenderHint(QPainter::SmoothPixmapTransform, quad.Smooth != 0.0f);
+        painter.drawImage(QRectF(QPointF(quad.X0, quad.Y0), QPointF(quad.X1, quad.Y1)),
+                          AtlasImage.Image(),
+                          QRectF(QPointF(quad.U0, quad.V0), QPointF(quad.U1, quad.V1)));
+    }
+    painter.restore();
+}
+
+} // namespace MelonPrime
+
+#endif // MELONPRIME_CUSTOM_HUD
@@ -0,0 +1,125 @@
+#pragma once
+
+#ifdef MELONPRIME_CUSTOM_HUD
+
+#include <cstdint>
+#include <vector>
+
+#include <QHash>
+#include <QImage>
+#include <QRect>
+#include <QRectF>
+
+class QPainter;
+
+namespace MelonPrime {
+
+// Packs the HUD's cached text and icon bitmaps (TextBitmapCache, the icon and
+// outline caches in MelonPrimeHudRenderAssets.inc) into one premultiplied
+// texture. Entries are keyed by QImage::cacheKey(), which changes whenever a
+// cache is rebuilt, so a bitmap is copied in once and reused until the atlas
+// fills up and gets cleared.
+class HudAtlas
+{
+public:
+    static constexpr int kSize = 1024;
+
+    HudAtlas();
+
+    // Returns where `image` lives in the atlas, copying it in if needed.
+    // An empty rect means it doesn't fit; the atlas is then marked full.
+    QRect Place(const QImage& image);
+
+    void Clear();
+    [[nodiscard]] bool IsFull() const { return Full; }
+
+    [[nodiscard]] const QImage& Image() const { return Pixels; }
+
+    // Bumped by Clear(); a consumer holding a copy has to refetch all of it.
+    [[nodiscard]] uint64_t Generation() const { return Gen; }
+
+    // Returns and forgets the region written since the last call.
+    QRect TakeDirty();
+
+private:
+    struct Shelf
+    {
+        int Y;
+        int Height;
+        int X;
+    };
+
+    QImage Pixels;
+    QHash<qint64, QRect> Entries;
+    std::vector<Shelf> Shelves;
+    int NextShelfY = 0;
+    QRect Dirty;
+    uint64_t Gen = 0;
+    bool Full = false;
+};
+
+// One atlas bitmap drawn into an overlay rectangle. Laid out as three RGBA
+// texels so the GL path can fetch it from a buffer texture per instance.
+struct HudQuad
+{
+    float X0, Y0, X1, Y1;   // overlay pixels
+    float U0, V0, U1, V1;   // atlas texels
+    float Opacity;
+    float Smooth;           // 1: bilinear (SmoothPixmapTransform), 0: nearest
+    float Pad[2];
+};
+static_assert(sizeof(HudQuad) == 12 * sizeof(float), "HudQuad must stay three RGBA32F texels");
+
+// Retained-mode alternative to drawing the HUD's cached bitmaps with QPainter.
+//
+// While a draw list is active (CustomHud_SetDrawList), the HUD's bitmap draw
+// funnels hand their images to Record() instead of the painter. Whatever it
+// can express as an axis-aligned quad is placed in the atlas and recorded;
+// the rest (clipped, rotated, unusual composition) is left for the painter.
+// The recorded quads go under the painter layer, either as instanced GL quads
+// (ScreenPanelGL) or through Replay(), which is what the golden harness
+// compares against the all-QPainter reference. To keep the reference draw
+// order, the HUD's dirty-rect funnels report every painter draw through
+// NotePainted(), and a bitmap that overlaps anything painted before it in the
+// frame is left to the painter as well.
+//
+// Only bitmaps go through here. Gauges, the radar and the crosshair are
+// vector/QPainter primitives and stay on the painter layer, so the overlay
+// image is still rasterised and uploaded wherever they change; the list
+// saves the text and icon blits, not the overlay upload.
+class HudDrawList
+{
+public:
+    // Starts a new frame. A full atlas is only cleared here, so quads that
+    // were recorded before it filled up stay valid until they are replaced.
+    void Begin();
+
+    // Records `image` drawn into `dst` (painter coordinates) with the
+    // painter's current transform, opacity and smoothing. Returns false if
+    // the caller has to draw it itself.
+    bool Record(const QPainter* painter, const QImage& image, const QRectF& dst);
+
+    // The painter drew into `deviceRect` (overlay pixels) this frame.
+    void NotePainted(const QRect& deviceRect);
+
+    [[nodiscard]] const std::vector<HudQuad>& Quads() const { return QuadList; }
+    [[nodiscard]] HudAtlas& Atlas() { return AtlasImage; }
+    [[nodiscard]] const HudAtlas& Atlas() const { return AtlasImage; }
+
+    // Bumped by Begin(), so a consumer can tell a new list from a retained one.
+    [[nodiscard]] uint64_t Serial() const { return ListSerial; }
+
+    // Draws the quads with QPainter, for the software reference comparison.
+    // The painter layer goes over the result.
+    void Replay(QPainter& painter) const;
+
+private:
+    HudAtlas AtlasImage;
+    std::vector<HudQuad> QuadList;
+    std::vector<QRect> PaintedRects;
+    uint64_t ListSerial = 0;
+};
+
+} // namespace MelonPrime
+
+#endif // MELONPRIME_CUSTOM_HUD
@@ -0,0 +1,36 @@
+#pragma once
+
+#ifdef MELONPRIME_CUSTOM_HUD
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "MelonPrime.h"
+#include "MelonPrimeGameRomAddrTable.h"
+
+namespace MelonPrime {
+
+    // Everything CustomHud_Render reads from the emulator for one HUD visual
+    // frame, copied out so the HUD can be rasterised on another thread
+    // without renderLock (CustomHud_CaptureInputSnapshot /
+    // CustomHud_RenderSnapshot).
+    //
+    // ndsIdentity and gameFrame are the HudVisualFrameIdentity the snapshot
+    // was taken for; the identity is only compared, never dereferenced.
+    // mainRAM is laid out like main RAM so the same readers work on it, but
+    // only the fields the HUD reads are refreshed (CopyHudSnapshotRanges,
+    // about a kilobyte); the rest of the buffer is stale.
+    struct CustomHudInputSnapshot {
+        const void* ndsIdentity = nullptr;
+        uint32_t gameFrame = 0;
+        std::shared_ptr<std::vector<uint8_t>> mainRAM;
+        RomAddresses rom{};
+        GameAddressesHot addrHot{};
+        uint8_t playerPosition = 0;
+        bool isInGame = false;
+    };
+
+} // namespace MelonPrime
+
+#endif // MELONPRIME_CUSTOM_HUD
@@ -0,0 +1,152 @@
+#ifdef MELONPRIME_CUSTOM_HUD
+
+#include "MelonPrimeHudRasterWorker.h"
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+namespace MelonPrime {
+
+namespace {
+
+uint64_t ElapsedUS(std::chrono::steady_clock::time_point start)
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count());
+}
+
+} // namespace
+
+HudRasterWorker::HudRasterWorker()
+{
+    Worker = std::thread([this]() { WorkerFunc(); });
+}
+
+HudRasterWorker::~HudRasterWorker()
+{
+    {
+        std::lock_guard<std::mutex> guard(Lock);
+        Quit = true;
+    }
+    WorkReady.notify_all();
+    Worker.join();
+}
+
+void HudRasterWorker::WorkerFunc()
+{
+    std::unique_lock<std::mutex> lock(Lock);
+    for (;;)
+    {
+        // the back buffer has to be handed over before it can be reused
+        WorkReady.wait(lock, [this]() { return Quit || (HasPending && Back == BackState::Idle); });
+        if (Quit)
+            return;
+
+        Job job = std::move(Pending);
+        HasPending = false;
+        Back = BackState::Rendering;
+        // Front only changes once the back buffer is Ready, so this is ours
+        Buffer& buffer = Buffers[Front ^ 1];
+        lock.unlock();
+
+        const auto start = std::chrono::steady_clock::now();
+        if (buffer.Image.width() != job.Width || buffer.Image.height() != job.Height)
+        {
+            buffer.Image = QImage(job.Width, job.Height, QImage::Format_ARGB32_Premultiplied);
+            buffer.Image.fill(Qt::transparent);
+            buffer.Dirty = QRect();
+        }
+        const QRect dirty = job.Render(buffer.Image, buffer.Dirty);
+        const uint64_t renderUS = ElapsedUS(start);
+
+        lock.lock();
+        buffer.Dirty = dirty;
+        buffer.Valid = true;
+        Back = BackState::Ready;
+        CurStats.Rendered++;
+        CurStats.RenderUS += renderUS;
+        WorkDone.notify_all();
+    }
+}
+
+void HudRasterWorker::SwapIfReady()
+{
+    if (Back != BackState::Ready)
+        return;
+
+    Front ^= 1;
+    Back = BackState::Idle;
+    WorkReady.notify_one();
+}
+
+void HudRasterWorker::Submit(int width, int height, RenderFunc render)
+{
+    {
+        std::lock_guard<std::mutex> guard(Lock);
+        if (HasPending)
+            CurStats.Superseded++;
+        Pending.Width = std::max(1, width);
+        Pending.Height = std::max(1, height);
+        Pending.Render = std::move(render);
+        HasPending = true;
+        CurStats.Submitted++;
+    }
+    WorkReady.notify_one();
+}
+
+bool HudRasterWorker::Acquire(int64_t timeoutUS, const QImage** image, QRect* dirty)
+{
+    const auto start = std::chrono::steady_clock::now();
+    const auto deadline = start + std::chrono::microseconds(std::max<int64_t>(0, timeoutUS));
+    const auto finished = [this]() { return Back == BackState::Ready; };
+
+    std::unique_lock<std::mutex> lock(Lock);
+    for (;;)
+    {
+        SwapIfReady();
+        if (!HasPending && Back == BackState::Idle)
+            break;
+
+        if (timeoutUS < 0)
+            WorkDone.wait(lock, finished);
+        else if (!WorkDone.wait_until(lock, deadline, finished))
+        {
+            // show the previous HUD frame rather than hold up presentation
+            CurStats.LateFrames++;
+            break;
+        }
+    }
+    CurStats.Acquired++;
+    CurStats.WaitUS += ElapsedUS(start);
+
+    const Buffer& front = Buffers[Front];
+    if (!front.Valid)
+        return false;
+
+    *image = &front.Image;
+    *dirty = front.Dirty;
+    return true;
+}
+
+void HudRasterWorker::Reset()
+{
+    std::unique_lock<std::mutex> lock(Lock);
+    HasPending = false;
+    WorkDone.wait(lock, [this]() { return Back != BackState::Rendering; });
+    Back = BackState::Idle;
+    // the images keep their pixels and dirty rects, so the next frame drawn
+    // into each still knows what to clear
+    Buffers[0].Valid = false;
+    Buffers[1].Valid = false;
+}
+
+HudRasterWorker::Stats HudRasterWorker::GetStats() const
+{
+    std::lock_guard<std::mutex> guard(Lock);
+    return CurStats;
+}
+
+} // namespace MelonPrime
+
+#endif // MELONPRIME_CUSTOM_HUD
@@ -0,0 +1,100 @@
+#pragma once
+
+#ifdef MELONPRIME_CUSTOM_HUD
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include <QImage>
+#include <QRect>
+
+namespace MelonPrime {
+
+// Rasterises the Custom HUD off the presenting thread, into one of two
+// overlay images.
+//
+// The presenter submits one job per new HUD visual frame (HudVisualFrameKey)
+// and then acquires the newest finished image, waiting at most a caller
+// chosen time for the job it just submitted. The acquired image belongs to
+// the presenter until its next Acquire(); the worker only ever draws into
+// the other one, so compositing never waits on rasterisation.
+class HudRasterWorker
+{
+public:
+    // Draws one HUD frame into `image` (ARGB32 premultiplied, already the
+    // requested size). `stale` is what this image still holds from the last
+    // frame drawn into it, which the job has to clear first. Returns the
+    // dirty rect of what was drawn. Runs on the worker thread.
+    using RenderFunc = std::function<QRect(QImage& image, const QRect& stale)>;
+
+    struct Stats
+    {
+        uint64_t Submitted = 0;
+        uint64_t Rendered = 0;
+        uint64_t Superseded = 0;    // replaced by a newer job before starting
+        uint64_t Acquired = 0;
+        uint64_t LateFrames = 0;    // acquires that gave up waiting
+        uint64_t RenderUS = 0;      // worker time spent rasterising
+        uint64_t WaitUS = 0;        // presenter time spent waiting in Acquire
+    };
+
+    HudRasterWorker();
+    ~HudRasterWorker();
+    HudRasterWorker(const HudRasterWorker&) = delete;
+    HudRasterWorker& operator=(const HudRasterWorker&) = delete;
+
+    // Queues a frame, replacing a queued one the worker hasn't started.
+    void Submit(int width, int height, RenderFunc render);
+
+    // Takes the newest finished frame, waiting up to `timeoutUS` for the
+    // last submitted one (negative: wait as long as it takes).
+    // Returns false if no frame was ever finished since the last Reset().
+    bool Acquire(int64_t timeoutUS, const QImage** image, QRect* dirty);
+
+    // Forgets all finished frames, e.g. when the HUD gets hidden. Waits for
+    // a job in progress.
+    void Reset();
+
+    [[nodiscard]] Stats GetStats() const;
+
+private:
+    enum class BackState { Idle, Rendering, Ready };
+
+    struct Buffer
+    {
+        QImage Image;
+        QRect Dirty;
+        bool Valid = false;
+    };
+
+    struct Job
+    {
+        int Width = 0;
+        int Height = 0;
+        RenderFunc Render;
+    };
+
+    void WorkerFunc();
+    void SwapIfReady();
+
+    Buffer Buffers[2];
+    int Front = 0;
+    BackState Back = BackState::Idle;
+    Job Pending;
+    bool HasPending = false;
+    bool Quit = false;
+
+    mutable std::mutex Lock;
+    std::condition_variable WorkReady;
+    std::condition_variable WorkDone;
+    std::thread Worker;
+
+    Stats CurStats;
+};
+
+} // namespace MelonPrime
+
+#endif // MELONPRIME_CUSTOM_HUD
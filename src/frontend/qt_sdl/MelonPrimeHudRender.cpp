@@ -1,6 +1,7 @@
 #ifdef MELONPRIME_CUSTOM_HUD
 
 #include "MelonPrimeHudRender.h"
+#include "MelonPrimeHudInputSnapshot.h"
 #include "MelonPrimePatchNoHud.h"
 #include "MelonPrimeInternal.h"
 #include "MelonPrimeGameRomAddrTable.h"
@@ -14,6 +15,7 @@
 #include "MelonPrime.h"
 #include "MelonPrimeDef.h"
 #include "MelonPrimeHudGeometry.h"
+#include "MelonPrimeHudDrawList.h"
 #include "MelonPrimePerfProbe.h"
 #include "MelonPrimeLocalization.h"
 #include "MelonPrimeColorDialogPrefs.h"
@@ -39,6 +41,7 @@
 #include <QTextStream>
 #include <array>
 #include <algorithm>
+#include <chrono>
 #include <string>
 #include <map>
 #include <set>
@@ -78,6 +81,9 @@ static constexpr int kRadarArtSize = 76;
 // Developer-only golden hash harness.
 #include "MelonPrimeHudGoldenHarness.inc"
 
+// Developer-only HUD render benchmark (uses the golden harness cases).
+#include "MelonPrimeHudBench.inc"
+
 #undef s_cacheEpoch
 #undef s_cache
 
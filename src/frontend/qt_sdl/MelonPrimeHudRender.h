@@ -6,6 +6,7 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <vector>
 #include <QMouseEvent>
 #include <QRect>
 #include "MelonPrimeDef.h"
@@ -22,6 +23,8 @@ namespace MelonPrime {
     struct RomAddresses;
     struct GameAddressesHot;
     struct CustomHudConfigState;
+    struct CustomHudInputSnapshot;
+    class HudDrawList;
 
     std::shared_ptr<CustomHudConfigState> CustomHud_CreateConfigState();
 
@@ -71,6 +74,43 @@ namespace MelonPrime {
         float hudOriginYds = 0.0f
     );
 
+    // CustomHud_Render split in two for rasterising on another thread
+    // (MelonPrimeHudInputSnapshot.h).
+    //
+    // CustomHud_CaptureInputSnapshot does the part that touches the
+    // emulator: it applies the NoHudPatch state for this frame (which writes
+    // game code) and copies the HUD inputs into `out`. Call it where
+    // CustomHud_Render would be called, with renderLock held. `ramBuffer`
+    // is reused for the main RAM copy unless an earlier snapshot still holds
+    // it. Returns false if there is no emulator to read from.
+    //
+    // CustomHud_RenderSnapshot draws from the snapshot alone. It still uses
+    // the per-config caches in `hudConfig`, so only one thread may draw the
+    // HUD for a given config at a time.
+    bool CustomHud_CaptureInputSnapshot(
+        CustomHudConfigState& hudConfig,
+        EmuInstance* emu,
+        Config::Table& localCfg,
+        const RomAddresses& rom,
+        const GameAddressesHot& addrHot,
+        uint8_t playerPosition,
+        bool isInGame,
+        std::shared_ptr<std::vector<uint8_t>>& ramBuffer,
+        CustomHudInputSnapshot& out);
+
+    QRect CustomHud_RenderSnapshot(
+        CustomHudConfigState& hudConfig,
+        const CustomHudInputSnapshot& inputs,
+        Config::Table& localCfg,
+        QPainter* topPaint,
+        QImage* topBuffer,
+        QImage* btmBuffer,
+        float topStretchX = 1.0f,
+        float hudScale = 1.0f,
+        float hudOriginXds = 0.0f,
+        float hudOriginYds = 0.0f
+    );
+
     // Returns true if the custom HUD setting is enabled in config.
     bool CustomHud_IsEnabled(Config::Table& localCfg);
 
@@ -163,6 +203,11 @@ namespace MelonPrime {
     // NDS::NumFrames value (match join, reset, ROM/savestate replacement).
     uint32_t CustomHud_GetVisualGeneration(const CustomHudConfigState& hudConfig);
 
+    // Routes the HUD's cached text/icon bitmaps to `drawList` as atlas quads
+    // instead of painting them (nullptr: paint everything). The caller draws
+    // the recorded quads over the overlay image itself.
+    void CustomHud_SetDrawList(CustomHudConfigState& hudConfig, HudDrawList* drawList);
+
     // Lightweight presentation identity used by renderer front-ends to skip
     // rebuilding an unchanged overlay.  The returned frame is the emulated
     // NDS frame, while `ndsIdentity` receives the instance identity pointer.
@@ -229,6 +274,12 @@ namespace MelonPrime {
 #ifdef MELONPRIME_ENABLE_DEVELOPER_FEATURES
     // Developer-only CLI hook: render deterministic HUD cases and write hashes.
     int CustomHud_RunGoldenHarness(const QString& outputPath);
+
+    // Developer-only CLI hook: time the golden cases plus scoreboard/radar
+    // heavy states for `iterations` frames each and print per-phase times.
+    // Fails if a case is slower than its entry in `thresholdsPath`
+    // ("-" only reports).
+    int CustomHud_RunBenchmark(int iterations, const QString& thresholdsPath);
 #endif
 
 } // namespace MelonPrime
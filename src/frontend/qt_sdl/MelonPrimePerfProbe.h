@@ -4,7 +4,12 @@
 // Frame-time, hot-path, and Custom HUD phase counters for measured optimization.
 // Compile gate: MELONPRIME_ENABLE_DEVELOPER_FEATURES + MELONPRIME_DS
 // Runtime gate: MELONPRIME_PERF=1
-// Release builds (developer features off): zero symbols, zero hot-path cost.
+// Release builds (developer features off): zero symbols, zero hot-path cost,
+// except the frame and latency points, which still feed the
+// MELONPRIME_METRICS histograms (MelonPrimeMetrics.h) while that is set.
+// With the probe, sections, HUD phases and frames also go to the
+// MELONPRIME_TRACE event trace (MelonPrimeTrace.h); neither needs
+// MELONPRIME_PERF.
 
 #if defined(MELONPRIME_ENABLE_DEVELOPER_FEATURES) && defined(MELONPRIME_DS)
 
@@ -16,8 +21,11 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <iterator>
 
+#include "MelonPrimeMetrics.h"
 #include "MelonPrimePerfClock.h"
+#include "MelonPrimeTrace.h"
 
 namespace MelonPrimePerf {
 
@@ -54,6 +62,25 @@ enum class HudPhase : uint8_t {
     Count
 };
 
+inline const char* SectionName(Section sec)
+{
+    static const char* const kNames[] = {
+        "Limiter sleep", "Limiter spin", "Input", "RunFrame", "Draw", "Deferred drain",
+    };
+    static_assert(std::size(kNames) == static_cast<std::size_t>(Section::Count));
+    return kNames[static_cast<uint32_t>(sec)];
+}
+
+inline const char* HudPhaseName(HudPhase phase)
+{
+    static const char* const kNames[] = {
+        "HUD state", "Scoreboard plan", "Scoreboard raster", "QPainter", "HUD clear",
+        "HUD hash", "HUD upload prepare", "HUD GPU upload", "HUD composite", "HUD total",
+    };
+    static_assert(std::size(kNames) == static_cast<std::size_t>(HudPhase::Count));
+    return kNames[static_cast<uint32_t>(phase)];
+}
+
 inline bool IsEnabled()
 {
     static const bool kEnabled = [] {
@@ -63,6 +90,12 @@ inline bool IsEnabled()
     return kEnabled;
 }
 
+// Frames are also measured for the live metrics page, without the reports
+inline bool IsMeasuring()
+{
+    return IsEnabled() || melonDS::MelonPrimeMetrics::IsEnabled();
+}
+
 struct State {
     bool frameOpen = false;
     Uint64 freq = 0;
@@ -330,7 +363,7 @@ inline void ResetWindowStats()
 inline void MaybeReport1Hz()
 {
     State& st = S();
-    if (!st.freq)
+    if (!st.freq || !IsEnabled())
         return;
 
     const Uint64 now = SDL_GetPerformanceCounter();
@@ -528,14 +561,16 @@ inline void MaybeReport1Hz()
 
 inline void FrameBegin()
 {
-    if (!IsEnabled())
+    melonDS::MelonPrimeTrace::Begin(melonDS::MelonPrimeTrace::Category::Frame, "Frame");
+    if (!IsMeasuring())
         return;
 
     State& st = S();
     if (!st.freq)
         st.freq = SDL_GetPerformanceFrequency();
 
-    EnsureFrameCsv();
+    if (IsEnabled())
+        EnsureFrameCsv();
 
     st.frameOpen = true;
     st.frameStartTick = SDL_GetPerformanceCounter();
@@ -567,6 +602,8 @@ inline void MarkRunFrameBegin()
     const Uint64 now = SDL_GetPerformanceCounter();
     const double latencyUs = TicksToMs(now - st.inputSampleTick) * 1000.0;
     RecordLatencySample(st.inputToRunFrameUs, st.inputToRunFrameCount, latencyUs);
+    melonDS::MelonPrimeMetrics::Record(melonDS::MelonPrimeMetrics::Metric::InputToRunFrame,
+                                       static_cast<uint64_t>(latencyUs));
     st.currentInputToRunFrameUs = latencyUs;
     st.runFrameBeginRecorded = true;
 }
@@ -579,12 +616,15 @@ inline void MarkPresentEnd()
     const Uint64 now = SDL_GetPerformanceCounter();
     const double latencyUs = TicksToMs(now - st.inputSampleTick) * 1000.0;
     RecordLatencySample(st.inputToPresentEndUs, st.inputToPresentEndCount, latencyUs);
+    melonDS::MelonPrimeMetrics::Record(melonDS::MelonPrimeMetrics::Metric::InputToPresent,
+                                       static_cast<uint64_t>(latencyUs));
     st.currentInputToPresentEndUs = latencyUs;
     st.presentEndRecorded = true;
 }
 
 inline void SectionBegin(Section sec)
 {
+    melonDS::MelonPrimeTrace::Begin(melonDS::MelonPrimeTrace::Category::Frame, SectionName(sec));
     if (!S().frameOpen)
         return;
 
@@ -596,6 +636,7 @@ inline void SectionBegin(Section sec)
 
 inline void SectionEnd(Section sec)
 {
+    melonDS::MelonPrimeTrace::End(melonDS::MelonPrimeTrace::Category::Frame, SectionName(sec));
     State& st = S();
     if (!st.frameOpen || !st.sectionOpen || st.openSection != sec)
         return;
@@ -612,6 +653,7 @@ inline void SectionEnd(Section sec)
 
 inline void FrameEnd()
 {
+    melonDS::MelonPrimeTrace::End(melonDS::MelonPrimeTrace::Category::Frame, "Frame");
     State& st = S();
     if (!st.frameOpen)
         return;
@@ -629,12 +671,35 @@ inline void FrameEnd()
             st.hudPhaseMaxTicks[index] = st.currentHudPhaseTicks;
     }
     const double frameMs = TicksToMs(endTick - st.frameStartTick);
+    melonDS::MelonPrimeMetrics::Record(melonDS::MelonPrimeMetrics::Metric::FrameTime,
+                                       static_cast<uint64_t>(frameMs * 1000.0));
     WriteFrameCsv(st, endTick, frameMs);
     RecordFrameMs(frameMs);
     st.frameOpen = false;
     MaybeReport1Hz();
 }
 
+// A frame that only collects Custom HUD phase ticks: no frame time, CSV row
+// or 1 Hz report. The headless HUD benchmark reads hudPhaseSumTicks itself
+// between the two calls.
+inline void HudSampleBegin()
+{
+    if (!IsEnabled())
+        return;
+
+    State& st = S();
+    if (!st.freq)
+        st.freq = SDL_GetPerformanceFrequency();
+    st.frameOpen = true;
+    st.currentHudPhaseTicks = 0;
+    st.currentHudDrawn = false;
+}
+
+inline void HudSampleEnd()
+{
+    S().frameOpen = false;
+}
+
 struct ScopedSection {
     Section sec;
     explicit ScopedSection(Section s) : sec(s) { SectionBegin(s); }
@@ -826,12 +891,22 @@ inline void CountHudUploadCall()
 class ScopedHudPhase {
 public:
     explicit ScopedHudPhase(HudPhase phase)
-        : phase_(phase), start_(ReadTicksIfActive()) {}
+        : phase_(phase), start_(ReadTicksIfActive()),
+          traced_(melonDS::MelonPrimeTrace::IsEnabled())
+    {
+        if (traced_)
+            melonDS::MelonPrimeTrace::Begin(melonDS::MelonPrimeTrace::Category::Hud, HudPhaseName(phase));
+    }
 
     ~ScopedHudPhase() { Stop(); }
 
     void Stop()
     {
+        if (traced_)
+        {
+            melonDS::MelonPrimeTrace::End(melonDS::MelonPrimeTrace::Category::Hud, HudPhaseName(phase_));
+            traced_ = false;
+        }
         if (!start_)
             return;
         AddHudPhaseTicks(phase_, ReadTicksIfActive() - start_);
@@ -844,8 +919,27 @@ public:
 private:
     HudPhase phase_;
     Uint64 start_ = 0;
+    bool traced_ = false;
 };
 
+// One line per savestate save or load. Savestate files are written on
+// their own thread, so this only formats and never touches State.
+//   save:       emu thread serialising and queueing the state
+//   save-write: writer thread compressing (codec) and writing (io) the file
+//   load:       emu thread, the whole load; codec inflating, io mapping
+inline void LogSavestate(const char* op, double emuThreadMs, double codecMs, double ioMs,
+                         uint64_t rawBytes, uint64_t fileBytes)
+{
+    if (!IsEnabled())
+        return;
+    std::fprintf(stderr,
+        "[MelonPrimePerf] savestate op=%s emu_thread_ms=%.3f codec_ms=%.3f io_ms=%.3f "
+        "raw_B=%llu file_B=%llu\n",
+        op, emuThreadMs, codecMs, ioMs,
+        static_cast<unsigned long long>(rawBytes),
+        static_cast<unsigned long long>(fileBytes));
+}
+
 inline void ShutdownReport()
 {
     if (!IsEnabled())
@@ -892,6 +986,9 @@ inline void ShutdownReport()
 
 #else // !MELONPRIME_ENABLE_DEVELOPER_FEATURES || !MELONPRIME_DS
 
+#include "MelonPrimeMetrics.h"
+#include "MelonPrimePerfClock.h"
+
 namespace MelonPrimePerf {
 
 enum class InputSource : uint8_t {
@@ -917,14 +1014,91 @@ enum class HudPhase : uint8_t {
     UploadPrepare, GpuUpload, Composite, TotalActive, Count
 };
 
+// Without the probe, the frame and latency points still feed the
+// MELONPRIME_METRICS histograms; they only read the clock while the
+// metrics page is open. The emu thread is the only caller.
+namespace MetricsOnly {
+
+struct State {
+    bool frameOpen = false;
+    bool inputSampleOpen = false;
+    bool runFrameBeginRecorded = false;
+    bool presentEndRecorded = false;
+    std::uint64_t frameStartTick = 0;
+    std::uint64_t inputSampleTick = 0;
+};
+
+inline State& S()
+{
+    static State st;
+    return st;
+}
+
+inline std::uint64_t MicrosecondsSince(std::uint64_t tick)
+{
+    return (melonDS::MelonPrimePerfClock::Ticks() - tick) * 1000000ULL
+        / melonDS::MelonPrimePerfClock::Frequency();
+}
+
+} // namespace MetricsOnly
+
 inline bool IsEnabled() { return false; }
 inline bool IsFrameActive() { return false; }
 inline unsigned long long ReadTicksIfActive() { return 0; }
-inline void FrameBegin() {}
-inline void FrameEnd() {}
-inline void MarkInputSample() {}
-inline void MarkRunFrameBegin() {}
-inline void MarkPresentEnd() {}
+
+inline void FrameBegin()
+{
+    MetricsOnly::State& st = MetricsOnly::S();
+    st.frameOpen = melonDS::MelonPrimeMetrics::IsEnabled();
+    if (!st.frameOpen)
+        return;
+    st.frameStartTick = melonDS::MelonPrimePerfClock::Ticks();
+    st.inputSampleOpen = false;
+    st.runFrameBeginRecorded = false;
+    st.presentEndRecorded = false;
+}
+
+inline void FrameEnd()
+{
+    MetricsOnly::State& st = MetricsOnly::S();
+    if (!st.frameOpen)
+        return;
+    melonDS::MelonPrimeMetrics::Record(melonDS::MelonPrimeMetrics::Metric::FrameTime,
+                                       MetricsOnly::MicrosecondsSince(st.frameStartTick));
+    st.frameOpen = false;
+}
+
+inline void HudSampleBegin() {}
+inline void HudSampleEnd() {}
+
+inline void MarkInputSample()
+{
+    MetricsOnly::State& st = MetricsOnly::S();
+    if (!st.frameOpen || st.inputSampleOpen)
+        return;
+    st.inputSampleTick = melonDS::MelonPrimePerfClock::Ticks();
+    st.inputSampleOpen = true;
+}
+
+inline void MarkRunFrameBegin()
+{
+    MetricsOnly::State& st = MetricsOnly::S();
+    if (!st.frameOpen || !st.inputSampleOpen || st.runFrameBeginRecorded)
+        return;
+    melonDS::MelonPrimeMetrics::Record(melonDS::MelonPrimeMetrics::Metric::InputToRunFrame,
+                                       MetricsOnly::MicrosecondsSince(st.inputSampleTick));
+    st.runFrameBeginRecorded = true;
+}
+
+inline void MarkPresentEnd()
+{
+    MetricsOnly::State& st = MetricsOnly::S();
+    if (!st.frameOpen || !st.inputSampleOpen || st.presentEndRecorded)
+        return;
+    melonDS::MelonPrimeMetrics::Record(melonDS::MelonPrimeMetrics::Metric::InputToPresent,
+                                       MetricsOnly::MicrosecondsSince(st.inputSampleTick));
+    st.presentEndRecorded = true;
+}
 inline void SectionBegin(Section) {}
 inline void SectionEnd(Section) {}
 inline void CountInputSource(InputSource) {}
@@ -952,6 +1126,7 @@ inline void CountScoreboardOutlinePathHit() {}
 inline void CountScoreboardOutlinePathMiss() {}
 inline void CountHudRegionHash(std::size_t) {}
 inline void CountHudUploadCall() {}
+inline void LogSavestate(const char*, double, double, double, uint64_t, uint64_t) {}
 inline void ShutdownReport() {}
 
 class ScopedHudPhase {
@@ -16,12 +16,15 @@
     with melonDS. If not, see http://www.gnu.org/licenses/.
 */
 
+#include <QSignalBlocker>
+
 #include "RAMInfoDialog.h"
 #include "ui_RAMInfoDialog.h"
 
 #include "main.h"
 
 using namespace melonDS;
+using MelonPrimeRAMSearch::Compare;
 
 s32 GetMainRAMValue(NDS& nds, const u32& addr, const ramInfo_ByteType& byteType)
 {
@@ -53,6 +56,9 @@ RAMInfoDialog::RAMInfoDialog(QWidget* parent) : QDialog(parent), ui(new Ui::RAMI
     qRegisterMetaType<s16>("s16");
     qRegisterMetaType<s8>("s8");
 
+    for (int i = 0; i < (int)Compare::Count; i++)
+        ui->cbCompare->addItem(MelonPrimeRAMSearch::CompareName((Compare)i));
+
     SearchThread = new RAMSearchThread(this);
     connect(SearchThread, &RAMSearchThread::SetProgressbarValue, this, &RAMInfoDialog::SetProgressbarValue);
     connect(SearchThread, &RAMSearchThread::finished, this, &RAMInfoDialog::OnSearchFinished);
@@ -79,19 +85,25 @@ void RAMInfoDialog::OnSearchFinished()
     SearchThread->wait();
     ui->btnSearch->setEnabled(true);
     ui->ramTable->clearContents();
-    ui->ramTable->setRowCount(SearchThread->GetResults()->size());
+    ui->ramTable->setRowCount(SearchThread->GetResultCount());
     ui->ramTable->verticalScrollBar()->setSliderPosition(0);
-    ui->txtFound->setText(QString("Found: %1").arg(SearchThread->GetResults()->size()));
+    ui->txtFound->setText(QString("Found: %1").arg(SearchThread->GetResultCount()));
 }
 
 void RAMInfoDialog::ShowRowsInTable()
 {
+    if (SearchThread->isRunning())
+        return;
+
+    // the values shown aren't edits to write back
+    QSignalBlocker blocker(ui->ramTable);
+
     const u32& scrollValue = ui->ramTable->verticalScrollBar()->sliderPosition();
-    std::vector<ramInfo_RowData>* RowDataVector = SearchThread->GetResults();
+    const u32 count = SearchThread->GetResultCount();
 
-    for (u32 row = scrollValue; row < std::min<u32>(scrollValue+25, RowDataVector->size()); row++)
+    for (u32 row = scrollValue; row < std::min<u32>(scrollValue+25, count); row++)
     {
-        ramInfo_RowData& rowData = RowDataVector->at(row);
+        ramInfo_RowData rowData = SearchThread->GetResult(row);
         rowData.Update(*emuInstance->getNDS(), SearchThread->GetSearchByteType());
 
         if (ui->ramTable->item(row, ramInfo_Address) == nullptr)
@@ -145,10 +157,11 @@ void RAMInfoDialog::on_btnSearch_clicked()
     ui->radiobtn2bytes->setEnabled(false);
     ui->radiobtn4bytes->setEnabled(false);
 
-    if (ui->txtSearch->text().isEmpty())
+    const Compare compare = (Compare)ui->cbCompare->currentIndex();
+    if (MelonPrimeRAMSearch::NeedsValue(compare) && ui->txtSearch->text().isEmpty())
         SearchThread->Start(ramInfoSTh_SearchAll);
     else
-        SearchThread->Start(ui->txtSearch->text().toInt());
+        SearchThread->Start(compare, ui->txtSearch->text().toInt());
     
     if (!TableUpdater->isActive())
         TableUpdater->start();
@@ -181,9 +194,18 @@ void RAMInfoDialog::on_radiobtn4bytes_clicked()
     SearchThread->SetSearchByteType(ramInfo_FourBytes);
 }
 
+void RAMInfoDialog::on_cbCompare_currentIndexChanged(int index)
+{
+    ui->txtSearch->setEnabled(MelonPrimeRAMSearch::NeedsValue((Compare)index));
+}
+
 void RAMInfoDialog::on_ramTable_itemChanged(QTableWidgetItem *item)
 {
-    ramInfo_RowData& rowData = SearchThread->GetResults()->at(item->row());
+    if (SearchThread->isRunning())
+        return;
+
+    ramInfo_RowData rowData = SearchThread->GetResult(item->row());
+    rowData.Update(*emuInstance->getNDS(), SearchThread->GetSearchByteType());
     s32 itemValue = item->text().toInt();
 
     if (rowData.Value != itemValue)
@@ -196,23 +218,18 @@ void RAMInfoDialog::on_ramTable_itemChanged(QTableWidgetItem *item)
 
 RAMSearchThread::RAMSearchThread(RAMInfoDialog* dialog) : Dialog(dialog)
 {
-    RowDataVector = new std::vector<ramInfo_RowData>();
 }
 
 RAMSearchThread::~RAMSearchThread()
 {
     Stop();
-    if (RowDataVector)
-    {
-        delete RowDataVector;
-        RowDataVector = nullptr;
-    }
 }
 
-void RAMSearchThread::Start(const s32& searchValue, const ramInfoSTh_SearchMode& searchMode)
+void RAMSearchThread::Start(const Compare& compare, const s32& searchValue)
 {
+    SearchCompare = compare;
     SearchValue = searchValue;
-    SearchMode = searchMode;
+    SearchMode = ramInfoSTh_Default;
     start();
 }
 
@@ -224,68 +241,37 @@ void RAMSearchThread::Start(const ramInfoSTh_SearchMode& searchMode)
 
 void RAMSearchThread::Stop()
 {
-    SearchRunning = false;
-    RowDataVector->clear();
     quit();
     wait();
+    Engine.Clear();
 }
 
 void RAMSearchThread::run()
 {
-    SearchRunning = true;
-    u32 progress = 0;
-
-    // Pause game running
-    Dialog->emuInstance->getEmuThread()->emuPause();
+    emit SetProgressbarValue(0);
 
-    // For following search modes below, RowDataVector must be filled.
-    if (SearchMode == ramInfoSTh_SearchAll || RowDataVector->size() == 0)
+    // The game keeps running; only the copy waits for the end of a frame
+    Dialog->emuInstance->getEmuThread()->takeRAMSnapshot(Snapshot);
+    if (Snapshot.empty())
     {
-        // First search mode
-        for (u32 addr = 0x02000000; SearchRunning && addr < 0x02000000+MainRAMMaxSize; addr += SearchByteType)
-        {
-            const s32& value = GetMainRAMValue(*Dialog->emuInstance->getNDS(), addr, SearchByteType);
-
-            RowDataVector->push_back({ addr, value, value });
-
-            // A solution to prevent to call too many slot.
-            u32 newProgress = (int)((addr-0x02000000) / (MainRAMMaxSize-1.0f) * 100);
-            if (progress < newProgress)
-            {
-                progress = newProgress;
-                emit SetProgressbarValue(progress);
-            }
-        }
-    }
-    
-    if (SearchMode == ramInfoSTh_Default)
-    {
-        // Next search mode
-        std::vector<ramInfo_RowData>* newRowDataVector = new std::vector<ramInfo_RowData>();
-        for (u32 row = 0; SearchRunning && row < RowDataVector->size(); row++)
-        {
-            const u32& addr = RowDataVector->at(row).Address;
-            const s32& value = GetMainRAMValue(*Dialog->emuInstance->getNDS(), addr, SearchByteType);
-
-            if (SearchValue == value)
-                newRowDataVector->push_back({ addr, value, value });
-
-            // A solution to prevent to call too many slot.
-            u32 newProgress = (int)(row / (RowDataVector->size()-1.0f) * 100);
-            if (progress < newProgress)
-            {
-                progress = newProgress;
-                emit SetProgressbarValue(progress);
-            }
-        }
-        delete RowDataVector;
-        RowDataVector = newRowDataVector;
+        Engine.Clear();
+        return;
     }
+    emit SetProgressbarValue(50);
+
+    // For following search modes below, the candidates must be set up.
+    // a DS and a DSi have different amounts of main RAM
+    const bool first = SearchMode == ramInfoSTh_SearchAll || !Engine.IsStarted()
+        || Engine.GetWidth() != (u32)SearchByteType || Engine.GetSize() != Snapshot.size();
+    if (first)
+        Engine.Start(Snapshot.data(), (u32)Snapshot.size(), SearchByteType);
 
-    // Unpause game running
-    Dialog->emuInstance->getEmuThread()->emuUnpause();
+    // A first search can only look for a value, the other compares need a
+    // previous copy
+    if (SearchMode == ramInfoSTh_Default && (!first || MelonPrimeRAMSearch::NeedsValue(SearchCompare)))
+        Engine.Refine(Snapshot.data(), (u32)Snapshot.size(), SearchCompare, SearchValue);
 
-    SearchRunning = false;
+    emit SetProgressbarValue(100);
 }
 
 void RAMSearchThread::SetSearchByteType(const ramInfo_ByteType& bytetype)
@@ -298,7 +284,14 @@ ramInfo_ByteType RAMSearchThread::GetSearchByteType() const
     return SearchByteType;
 }
 
-std::vector<ramInfo_RowData>* RAMSearchThread::GetResults()
+u32 RAMSearchThread::GetResultCount() const
+{
+    return Engine.GetCount();
+}
+
+ramInfo_RowData RAMSearchThread::GetResult(const u32& row) const
 {
-    return RowDataVector;
+    const u32 offset = Engine.GetOffset(row);
+    const s32 previous = Engine.GetPrevious(offset);
+    return { 0x02000000 + offset, previous, previous };
 }
@@ -27,6 +27,7 @@
 
 #include "types.h"
 #include "NDS.h"
+#include "MelonPrimeRAMSearch.h"
 
 namespace Ui { class RAMInfoDialog; }
 class RAMInfoDialog;
@@ -112,6 +113,7 @@ private slots:
     void on_radiobtn1byte_clicked();
     void on_radiobtn2bytes_clicked();
     void on_radiobtn4bytes_clicked();
+    void on_cbCompare_currentIndexChanged(int index);
     void on_ramTable_itemChanged(QTableWidgetItem *item);
 
     void OnSearchFinished();
@@ -136,12 +138,14 @@ public:
     explicit RAMSearchThread(RAMInfoDialog* dialog);
     ~RAMSearchThread() override;
 
-    void Start(const melonDS::s32& searchValue, const ramInfoSTh_SearchMode& searchMode = ramInfoSTh_Default);
+    void Start(const melonDS::MelonPrimeRAMSearch::Compare& compare, const melonDS::s32& searchValue);
     void Start(const ramInfoSTh_SearchMode& searchMode);
     
     void SetSearchByteType(const ramInfo_ByteType& bytetype);
     ramInfo_ByteType GetSearchByteType() const;
-    std::vector<ramInfo_RowData>* GetResults();
+    // not while a search is running
+    melonDS::u32 GetResultCount() const;
+    ramInfo_RowData GetResult(const melonDS::u32& row) const;
 
     void Stop();
 
@@ -149,14 +153,15 @@ private:
     virtual void run() override;
 
     RAMInfoDialog* Dialog;
-    bool SearchRunning = false;
 
     ramInfoSTh_SearchMode SearchMode;
+    melonDS::MelonPrimeRAMSearch::Compare SearchCompare = melonDS::MelonPrimeRAMSearch::Compare::EqualTo;
     melonDS::s32 SearchValue;
     ramInfo_ByteType SearchByteType = ramInfo_OneByte;
-    std::vector<ramInfo_RowData>* RowDataVector = nullptr;
 
-    void ClearTableContents();
+    // main RAM as the emu thread copied it between two frames
+    std::vector<melonDS::u8> Snapshot;
+    melonDS::MelonPrimeRAMSearch::Search Engine;
 
 signals:
     void SetProgressbarValue(const melonDS::u32& value);
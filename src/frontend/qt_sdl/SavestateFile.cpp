@@ -0,0 +1,409 @@
+/*
+    Copyright 2016-2026 melonDS team
+
+    This file is part of melonDS.
+
+    melonDS is free software: you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the Free
+    Software Foundation, either version 3 of the License, or (at your option)
+    any later version.
+
+    melonDS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with melonDS. If not, see http://www.gnu.org/licenses/.
+*/
+
+#include <string.h>
+#include <chrono>
+#include <filesystem>
+#include <system_error>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <zstd.h>
+
+#include "SavestateFile.h"
+#include "Savestate.h"
+#include "MelonPrimeTrace.h"
+#include "Platform.h"
+
+using namespace melonDS;
+using namespace melonDS::Platform;
+
+namespace
+{
+
+constexpr char kCompressedMagic[4] = {'M', 'L', 'N', 'Z'};
+constexpr u32 kCompressedVersion = 1;
+constexpr u32 kHeaderSize = 16;
+// well over a DSi state; a header claiming more than this is corrupt
+constexpr u32 kMaxStateLength = 256 * 1024 * 1024;
+
+// fast enough to stay well under the time it takes to write the raw state,
+// and savestates are mostly zeroes and repeated VRAM anyway
+constexpr int kCompressionLevel = 1;
+
+u64 MicrosecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count();
+}
+
+}
+
+SavestateFileReader::~SavestateFileReader()
+{
+    Close();
+}
+
+void SavestateFileReader::Close() noexcept
+{
+    if (Mapping)
+    {
+#ifdef _WIN32
+        UnmapViewOfFile(Mapping);
+#else
+        munmap(Mapping, MappingLength);
+#endif
+        Mapping = nullptr;
+    }
+    MappingLength = 0;
+    Inflated.reset();
+    StateData = nullptr;
+    StateLength = 0;
+}
+
+bool SavestateFileReader::Open(const std::string& path)
+{
+    Close();
+    MapTime = InflateTime = 0;
+    auto start = std::chrono::steady_clock::now();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileW(std::filesystem::u8path(path).c_str(), GENERIC_READ, FILE_SHARE_READ,
+                              nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        Log(LogLevel::Error, "Failed to open state file \"%s\"\n", path.c_str());
+        return false;
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+    {
+        Log(LogLevel::Error, "State file \"%s\" is empty\n", path.c_str());
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr)
+    {
+        Log(LogLevel::Error, "Failed to map state file \"%s\"\n", path.c_str());
+        return false;
+    }
+    Mapping = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+    CloseHandle(mapping);
+    MappingLength = size.QuadPart;
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        Log(LogLevel::Error, "Failed to open state file \"%s\"\n", path.c_str());
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0)
+    {
+        Log(LogLevel::Error, "State file \"%s\" is empty\n", path.c_str());
+        close(fd);
+        return false;
+    }
+    MappingLength = st.st_size;
+    Mapping = mmap(nullptr, MappingLength, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (Mapping == MAP_FAILED)
+        Mapping = nullptr;
+#endif
+    if (!Mapping)
+    {
+        Log(LogLevel::Error, "Failed to map state file \"%s\"\n", path.c_str());
+        MappingLength = 0;
+        return false;
+    }
+    MapTime = MicrosecondsSince(start);
+
+    u8* data = static_cast<u8*>(Mapping);
+    if (MappingLength < kHeaderSize || memcmp(data, kCompressedMagic, 4) != 0)
+    {
+        // an uncompressed state, which Savestate checks itself
+        if (MappingLength > 0xFFFFFFFF)
+        {
+            Log(LogLevel::Error, "State file \"%s\" is too large\n", path.c_str());
+            Close();
+            return false;
+        }
+        StateData = data;
+        StateLength = (u32)MappingLength;
+        return true;
+    }
+
+    u32 version, rawLength;
+    memcpy(&version, &data[4], 4);
+    memcpy(&rawLength, &data[8], 4);
+    if (version != kCompressedVersion)
+    {
+        Log(LogLevel::Error, "State file \"%s\" has unknown compressed format %u\n", path.c_str(), version);
+        Close();
+        return false;
+    }
+
+    // the length in the header is only trusted if the zstd frame agrees
+    const unsigned long long frameLength = ZSTD_getFrameContentSize(&data[kHeaderSize], MappingLength - kHeaderSize);
+    if (rawLength == 0 || rawLength > kMaxStateLength || frameLength != rawLength)
+    {
+        Log(LogLevel::Error, "State file \"%s\" is corrupt (length %u, frame %s)\n", path.c_str(), rawLength,
+            frameLength == ZSTD_CONTENTSIZE_ERROR ? "unreadable"
+            : frameLength == ZSTD_CONTENTSIZE_UNKNOWN ? "without a length" : "of another length");
+        Close();
+        return false;
+    }
+
+    start = std::chrono::steady_clock::now();
+    Inflated = std::make_unique<u8[]>(rawLength);
+    size_t res = ZSTD_decompress(Inflated.get(), rawLength, &data[kHeaderSize], MappingLength - kHeaderSize);
+    if (ZSTD_isError(res) || res != rawLength)
+    {
+        Log(LogLevel::Error, "Failed to decompress state file \"%s\": %s\n", path.c_str(),
+            ZSTD_isError(res) ? ZSTD_getErrorName(res) : "truncated");
+        Close();
+        return false;
+    }
+    InflateTime = MicrosecondsSince(start);
+
+    // the compressed image isn't needed past this point
+    u64 fileLength = MappingLength;
+    std::unique_ptr<u8[]> inflated = std::move(Inflated);
+    Close();
+    Inflated = std::move(inflated);
+    MappingLength = fileLength;
+    StateData = Inflated.get();
+    StateLength = rawLength;
+    return true;
+}
+
+SavestateWriter::SavestateWriter()
+{
+    Thread = std::thread([this] { Run(); });
+}
+
+SavestateWriter::~SavestateWriter()
+{
+    {
+        std::lock_guard<std::mutex> guard(Lock);
+        Quit = true;
+    }
+    Wake.notify_one();
+    Thread.join();
+}
+
+void SavestateWriter::SetResultCallback(std::function<void(const Result&)> callback)
+{
+    std::lock_guard<std::mutex> guard(Lock);
+    OnResult = std::move(callback);
+}
+
+void SavestateWriter::Queue(const std::string& path, std::unique_ptr<Savestate> state, bool compress)
+{
+    {
+        std::lock_guard<std::mutex> guard(Lock);
+        bool replaced = false;
+        for (Job& job : Jobs)
+        {
+            if (job.Path == path)
+            {
+                job.State = std::move(state);
+                job.Compress = compress;
+                Totals.Superseded++;
+                replaced = true;
+                break;
+            }
+        }
+        if (!replaced)
+            Jobs.push_back({path, std::move(state), compress});
+    }
+    Wake.notify_one();
+}
+
+bool SavestateWriter::IsPending(const std::string& path) const
+{
+    std::lock_guard<std::mutex> guard(Lock);
+    if (Busy && ActivePath == path)
+        return true;
+    for (const Job& job : Jobs)
+    {
+        if (job.Path == path)
+            return true;
+    }
+    return false;
+}
+
+void SavestateWriter::Wait(const std::string& path)
+{
+    std::unique_lock<std::mutex> guard(Lock);
+    Idle.wait(guard, [&]
+    {
+        if (Busy && ActivePath == path)
+            return false;
+        for (const Job& job : Jobs)
+        {
+            if (job.Path == path)
+                return false;
+        }
+        return true;
+    });
+}
+
+void SavestateWriter::WaitAll()
+{
+    std::unique_lock<std::mutex> guard(Lock);
+    Idle.wait(guard, [&] { return !Busy && Jobs.empty(); });
+}
+
+SavestateWriter::Stats SavestateWriter::GetStats() const
+{
+    std::lock_guard<std::mutex> guard(Lock);
+    return Totals;
+}
+
+bool SavestateWriter::Compress(const u8* data, u32 length, std::unique_ptr<u8[]>& out, u64& outLength)
+{
+    size_t bound = ZSTD_compressBound(length);
+    out = std::make_unique<u8[]>(kHeaderSize + bound);
+
+    memcpy(&out[0], kCompressedMagic, 4);
+    memcpy(&out[4], &kCompressedVersion, 4);
+    memcpy(&out[8], &length, 4);
+    memset(&out[12], 0, 4);
+
+    size_t res = ZSTD_compress(&out[kHeaderSize], bound, data, length, kCompressionLevel);
+    if (ZSTD_isError(res))
+    {
+        Log(LogLevel::Error, "Failed to compress savestate: %s\n", ZSTD_getErrorName(res));
+        out.reset();
+        outLength = 0;
+        return false;
+    }
+    outLength = kHeaderSize + res;
+    return true;
+}
+
+SavestateWriter::Result SavestateWriter::Write(Job& job)
+{
+    MelonPrimeTrace::Scope trace(MelonPrimeTrace::Category::Savestate, "Write state file");
+    Result result;
+    result.Path = job.Path;
+
+    const u8* data = static_cast<const u8*>(job.State->Buffer());
+    result.RawBytes = job.State->Length();
+    result.FileBytes = result.RawBytes;
+
+    std::unique_ptr<u8[]> compressed;
+    if (job.Compress)
+    {
+        auto start = std::chrono::steady_clock::now();
+        if (Compress(data, job.State->Length(), compressed, result.FileBytes))
+            data = compressed.get();
+        else
+            result.FileBytes = result.RawBytes; // write it uncompressed then
+        result.CompressUS = MicrosecondsSince(start);
+    }
+    // the buffer isn't needed anymore once it's compressed
+    if (compressed)
+        job.State.reset();
+
+    auto start = std::chrono::steady_clock::now();
+    std::string tempPath = job.Path + ".tmp";
+    FileHandle* file = OpenFile(tempPath, FileMode::Write);
+    if (file == nullptr)
+    {
+        Log(LogLevel::Error, "Failed to open %s for writing\n", tempPath.c_str());
+        return result;
+    }
+    bool written = FileWrite(data, result.FileBytes, 1, file) == 1;
+    written = CloseFile(file) && written;
+    if (!written)
+    {
+        Log(LogLevel::Error, "Failed to write %llu-byte savestate to %s\n",
+            (unsigned long long)result.FileBytes, tempPath.c_str());
+        std::error_code ec;
+        std::filesystem::remove(std::filesystem::u8path(tempPath), ec);
+        return result;
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(std::filesystem::u8path(tempPath), std::filesystem::u8path(job.Path), ec);
+    if (ec)
+    {
+        Log(LogLevel::Error, "Failed to replace %s: %s\n", job.Path.c_str(), ec.message().c_str());
+        std::filesystem::remove(std::filesystem::u8path(tempPath), ec);
+        return result;
+    }
+    result.WriteUS = MicrosecondsSince(start);
+    result.OK = true;
+    return result;
+}
+
+void SavestateWriter::Run()
+{
+    MelonPrimeTrace::SetThreadName("Savestate writer");
+    std::unique_lock<std::mutex> guard(Lock);
+    for (;;)
+    {
+        Wake.wait(guard, [&] { return Quit || !Jobs.empty(); });
+        if (Jobs.empty())
+            break; // quitting with nothing left to write
+
+        Job job = std::move(Jobs.front());
+        Jobs.pop_front();
+        ActivePath = job.Path;
+        Busy = true;
+        guard.unlock();
+
+        Result result = Write(job);
+        job.State.reset();
+
+        guard.lock();
+        if (result.OK)
+        {
+            Totals.Written++;
+            Totals.RawBytes += result.RawBytes;
+            Totals.FileBytes += result.FileBytes;
+        }
+        else
+        {
+            Totals.Failed++;
+        }
+        std::function<void(const Result&)> callback = OnResult;
+
+        // still busy during the callback, so that once WaitAll() returns
+        // after the callback was replaced, the old one isn't running
+        guard.unlock();
+        if (callback)
+            callback(result);
+        guard.lock();
+        Busy = false;
+        ActivePath.clear();
+        Idle.notify_all();
+    }
+}
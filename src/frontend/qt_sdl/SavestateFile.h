@@ -0,0 +1,148 @@
+/*
+    Copyright 2016-2026 melonDS team
+
+    This file is part of melonDS.
+
+    melonDS is free software: you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the Free
+    Software Foundation, either version 3 of the License, or (at your option)
+    any later version.
+
+    melonDS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with melonDS. If not, see http://www.gnu.org/licenses/.
+*/
+
+#ifndef SAVESTATEFILE_H
+#define SAVESTATEFILE_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "types.h"
+
+namespace melonDS
+{
+class Savestate;
+}
+
+// Savestate files come in two forms: the raw savestate buffer ("MELN"),
+// which is what melonDS has always written, and a compressed one: a
+// 16-byte header ("MLNZ", format version, uncompressed length) followed by
+// a single zstd frame. Both are read back; which one gets written is up to
+// the caller.
+
+// Maps a savestate file for loading, inflating it first if it's compressed.
+// The data stays valid until the reader is destroyed or reopened.
+class SavestateFileReader
+{
+public:
+    SavestateFileReader() noexcept = default;
+    ~SavestateFileReader();
+    SavestateFileReader(const SavestateFileReader&) = delete;
+    SavestateFileReader& operator=(const SavestateFileReader&) = delete;
+
+    bool Open(const std::string& path);
+    void Close() noexcept;
+
+    // writable: Savestate takes a non-const buffer, and the mapping is
+    // copy-on-write so nothing ever reaches the file
+    [[nodiscard]] melonDS::u8* Data() const noexcept { return StateData; }
+    [[nodiscard]] melonDS::u32 Length() const noexcept { return StateLength; }
+    [[nodiscard]] melonDS::u64 FileLength() const noexcept { return MappingLength; }
+    [[nodiscard]] bool WasCompressed() const noexcept { return Inflated != nullptr; }
+
+    // time spent mapping and inflating in the last Open()
+    [[nodiscard]] melonDS::u64 MapUS() const noexcept { return MapTime; }
+    [[nodiscard]] melonDS::u64 InflateUS() const noexcept { return InflateTime; }
+
+private:
+    void* Mapping = nullptr;
+    melonDS::u64 MappingLength = 0;
+    std::unique_ptr<melonDS::u8[]> Inflated;
+    melonDS::u8* StateData = nullptr;
+    melonDS::u32 StateLength = 0;
+    melonDS::u64 MapTime = 0;
+    melonDS::u64 InflateTime = 0;
+};
+
+// Writes finished savestates on a background thread, so the emu thread
+// only pays for serialising. Each file is written next to its destination
+// and renamed over it, so a load never sees a half-written state.
+class SavestateWriter
+{
+public:
+    struct Result
+    {
+        std::string Path;
+        bool OK = false;
+        melonDS::u64 RawBytes = 0;
+        melonDS::u64 FileBytes = 0;
+        melonDS::u64 CompressUS = 0;
+        melonDS::u64 WriteUS = 0;
+    };
+
+    struct Stats
+    {
+        melonDS::u64 Written = 0;
+        melonDS::u64 Failed = 0;
+        melonDS::u64 Superseded = 0;    // replaced by a newer save before being written
+        melonDS::u64 RawBytes = 0;
+        melonDS::u64 FileBytes = 0;
+    };
+
+    SavestateWriter();
+    ~SavestateWriter(); // writes whatever is still queued
+    SavestateWriter(const SavestateWriter&) = delete;
+    SavestateWriter& operator=(const SavestateWriter&) = delete;
+
+    // Called on the writer thread after every file.
+    void SetResultCallback(std::function<void(const Result&)> callback);
+
+    // Takes over a finished savestate. A save to the same path that hasn't
+    // been started yet is dropped in favour of this one.
+    void Queue(const std::string& path, std::unique_ptr<melonDS::Savestate> state, bool compress);
+
+    // Returns once nothing is queued or being written for `path`.
+    void Wait(const std::string& path);
+    void WaitAll();
+
+    [[nodiscard]] bool IsPending(const std::string& path) const;
+    [[nodiscard]] Stats GetStats() const;
+
+    // Builds the compressed file image (header and zstd frame) for a
+    // savestate buffer.
+    static bool Compress(const melonDS::u8* data, melonDS::u32 length, std::unique_ptr<melonDS::u8[]>& out, melonDS::u64& outLength);
+
+private:
+    struct Job
+    {
+        std::string Path;
+        std::unique_ptr<melonDS::Savestate> State;
+        bool Compress;
+    };
+
+    void Run();
+    Result Write(Job& job);
+
+    mutable std::mutex Lock;
+    std::condition_variable Wake;
+    std::condition_variable Idle;
+    std::deque<Job> Jobs;
+    std::string ActivePath;
+    bool Busy = false;
+    bool Quit = false;
+    Stats Totals;
+    std::function<void(const Result&)> OnResult;
+    std::thread Thread;
+};
+
+#endif // SAVESTATEFILE_H
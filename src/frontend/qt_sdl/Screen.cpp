@@ -84,6 +84,7 @@
 #ifdef MELONPRIME_CUSTOM_HUD
 #include "MelonPrimeConstants.h"
 #include "MelonPrimeHudRender.h"
+#include "MelonPrimeHudInputSnapshot.h"
 #include "MelonPrimeHudConfigOnScreenEdit.h"
 #include "InputConfig/InputConfigDialog.h"
 #include <QFontDatabase>
@@ -1558,7 +1559,7 @@ std::optional<std::pair<void*, void*>> ResolveMelonPrimeWaylandHandles(QWindow*
 
 ScreenPanelNative::ScreenPanelNative(QWidget * parent) : ScreenPanel(parent)
 {
-    hasBuffers = false;
+    frames = &emuInstance->getFrameMailbox(mainWindow->getWindowID());
 
     screen[0] = QImage(256, 192, QImage::Format_RGB32);
     screen[1] = QImage(256, 192, QImage::Format_RGB32);
@@ -1575,6 +1576,21 @@ ScreenPanelNative::ScreenPanelNative(QWidget * parent) : ScreenPanel(parent)
 
 ScreenPanelNative::~ScreenPanelNative()
 {
+#ifdef MELONPRIME_CUSTOM_HUD
+    const MelonPrime::HudRasterWorker::Stats hudStats = hudRaster.GetStats();
+    if (hudStats.Rendered)
+    {
+        Platform::Log(Platform::LogLevel::Info,
+            "HUD raster: %llu submitted, %llu rendered, %llu superseded, %llu late, "
+            "%.1f us/frame rendering, %.1f us/paint waiting\n",
+            static_cast<unsigned long long>(hudStats.Submitted),
+            static_cast<unsigned long long>(hudStats.Rendered),
+            static_cast<unsigned long long>(hudStats.Superseded),
+            static_cast<unsigned long long>(hudStats.LateFrames),
+            static_cast<double>(hudStats.RenderUS) / hudStats.Rendered,
+            hudStats.Acquired ? static_cast<double>(hudStats.WaitUS) / hudStats.Acquired : 0.0);
+    }
+#endif
 #if defined(__linux__) && defined(MELONPRIME_ENABLE_WAYLAND_POINTER_LOCK)
     if (waylandPointerLock)
         waylandPointerLock->setLocked(nullptr, nullptr, false);
@@ -1622,6 +1638,9 @@ void ScreenPanelNative::setupScreenLayout()
             mtx[2], mtx[3], 0.f,
             mtx[4], mtx[5], 1.f);
     }
+
+    scaleFilterSetting = emuInstance->getGlobalConfig().GetInt("Screen.SoftwareScaleFilter");
+    scaledLayoutChanged = true;
 }
 
 #ifdef MELONPRIME_DS
@@ -1656,14 +1675,7 @@ void ScreenPanelNative::finishLatestFramePaint()
 
 void ScreenPanelNative::invalidateRendererOutput()
 {
-    bufferLock.lock();
-    hasBuffers = false;
-    topBuffer = nullptr;
-    bottomBuffer = nullptr;
-    bufferWidth = 256;
-    bufferHeight = 192;
-    bufferLock.unlock();
-
+    frames->PublishEmpty();
     requestLatestFrameUpdate();
 }
 #endif
@@ -1678,9 +1690,7 @@ void ScreenPanelNative::drawScreen()
 #ifdef MELONPRIME_DS
         invalidateRendererOutput();
 #else
-        bufferLock.lock();
-        hasBuffers = false;
-        bufferLock.unlock();
+        frames->PublishEmpty();
 #endif
         return;
     }
@@ -1688,24 +1698,83 @@ void ScreenPanelNative::drawScreen()
     auto nds = emuInstance->getNDS();
     assert(nds != nullptr);
 
+    // this runs on the emu thread, which is the only one touching the
+    // renderer's buffers, so they can be copied out without any lock
     const RendererOutput output = nds->GPU.GetRendererOutput();
-    bufferLock.lock();
-    hasBuffers = (output.Kind == RendererOutputKind::CpuBgra);
-    topBuffer = hasBuffers ? output.Top : nullptr;
-    bottomBuffer = hasBuffers ? output.Bottom : nullptr;
-    bufferWidth = hasBuffers ? static_cast<int>(std::max(1u, output.Width)) : 256;
-    bufferHeight = hasBuffers ? static_cast<int>(std::max(1u, output.Height)) : 192;
-    bufferLock.unlock();
+    if (output.Kind == RendererOutputKind::CpuBgra)
+        frames->Publish(output.Top, output.Bottom,
+            static_cast<int>(std::max(1u, output.Width)),
+            static_cast<int>(std::max(1u, output.Height)));
+    else
+        frames->PublishEmpty();
 #ifdef MELONPRIME_DS
     requestLatestFrameUpdate();
 #endif
 }
 
+#include "MelonPrimeHudScreenCppOverlayOfNative.inc"
+
+bool ScreenPanelNative::drawScaledScreens(QPainter& painter)
+{
+    if (numScreens < 1)
+        return true;
+
+    // work in physical pixels so nothing gets scaled again on the way out
+    const qreal dpr = devicePixelRatioF();
+    const QSize size(std::max(1, qRound(width() * dpr)), std::max(1, qRound(height() * dpr)));
+    if (scaled.size() != size)
+    {
+        scaled = QImage(size, QImage::Format_RGB32);
+        scaled.setDevicePixelRatio(dpr);
+        scaledLayoutChanged = true;
+    }
+    if (scaledLayoutChanged)
+    {
+        // the screens cover the same pixels every frame until the layout
+        // changes, so the borders only need clearing then
+        scaled.fill(Qt::black);
+        scaledLayoutChanged = false;
+    }
+
+    // 0 follows the regular screen filter toggle
+    ScreenScaleFilter scaleFilter;
+    switch (scaleFilterSetting)
+    {
+    case 1: scaleFilter = screenScale_Nearest; break;
+    case 2: scaleFilter = screenScale_SharpBilinear; break;
+    case 3: scaleFilter = screenScale_Bilinear; break;
+    default: scaleFilter = filter ? screenScale_Bilinear : screenScale_Nearest; break;
+    }
+
+    u32* dst = reinterpret_cast<u32*>(scaled.bits());
+    const int dstStride = static_cast<int>(scaled.bytesPerLine() / sizeof(u32));
+    for (int i = 0; i < numScreens; i++)
+    {
+        const QImage& img = screen[screenKind[i]];
+        float mtx[6];
+        for (int j = 0; j < 6; j++)
+            mtx[j] = screenMatrix[i][j] * dpr;
+
+        if (!scaler.Draw(dst, size.width(), size.height(), dstStride,
+                reinterpret_cast<const u32*>(img.constBits()), img.width(), img.height(),
+                static_cast<int>(img.bytesPerLine() / sizeof(u32)), mtx, scaleFilter))
+        {
+            scaledLayoutChanged = true;
+            return false;
+        }
+    }
+
+    painter.drawImage(QPoint(0, 0), scaled);
+    // the HUD overlay expects to find the last screen's transform
+    painter.setTransform(screenTrans[numScreens - 1]);
+    return true;
+}
+
 void ScreenPanelNative::paintEvent(QPaintEvent * event)
 {
 #ifdef MELONPRIME_DS
-    // Everything published before this point is represented by the buffer
-    // pointers sampled below. Publications during paint request one follow-up.
+    // Every frame published before this point is covered by the mailbox
+    // Acquire() below. Frames published during paint request one follow-up.
     latestFrameDirty.store(false, std::memory_order_release);
 #endif
 
@@ -1717,38 +1786,56 @@ void ScreenPanelNative::paintEvent(QPaintEvent * event)
 
     if (emuThread->emuIsActive())
     {
-        emuInstance->renderLock.lock();
-
-        bufferLock.lock();
-        if (hasBuffers)
+        // the frame we get stays ours until the next Acquire(), so the
+        // images can point straight at it
+        const FrameMailbox::Frame& frame = frames->Acquire();
+        if (frame.Serial != screenSerial)
         {
-            const int sourceWidth = bufferWidth;
-            const int sourceHeight = bufferHeight;
-            if (screen[0].width() != sourceWidth || screen[0].height() != sourceHeight)
+            screenSerial = frame.Serial;
+            if (frame.Valid)
+            {
+                const qsizetype stride = static_cast<qsizetype>(frame.Width) * sizeof(u32);
+                screen[0] = QImage(reinterpret_cast<const uchar*>(frame.Top.get()),
+                    frame.Width, frame.Height, stride, QImage::Format_RGB32);
+                screen[1] = QImage(reinterpret_cast<const uchar*>(frame.Bottom.get()),
+                    frame.Width, frame.Height, stride, QImage::Format_RGB32);
+            }
+            else
             {
-                screen[0] = QImage(sourceWidth, sourceHeight, QImage::Format_RGB32);
-                screen[1] = QImage(sourceWidth, sourceHeight, QImage::Format_RGB32);
+                // the images may still point into a slot we just gave back
+                screen[0] = QImage(256, 192, QImage::Format_RGB32);
+                screen[1] = QImage(256, 192, QImage::Format_RGB32);
+                screen[0].fill(Qt::black);
+                screen[1].fill(Qt::black);
             }
-            const std::size_t bytes = static_cast<std::size_t>(sourceWidth)
-                * static_cast<std::size_t>(sourceHeight) * sizeof(u32);
-            memcpy(screen[0].scanLine(0), topBuffer, bytes);
-            memcpy(screen[1].scanLine(0), bottomBuffer, bytes);
         }
-        bufferLock.unlock();
 
-        QRect screenrc(0, 0, 256, 192);
+#ifdef MELONPRIME_CUSTOM_HUD
+        // the HUD reads emulator state, which still needs the renderer
+        // and NDS to stay put
+        bool hudEditMode = false;
+        emuInstance->renderLock.lock();
+        const bool hudVisible = submitHudOverlay(emuThread, hudEditMode);
+        emuInstance->renderLock.unlock();
+        if (!hudVisible)
+            hudRaster.Reset();
+#endif
 
-        for (int i = 0; i < numScreens; i++)
+        if (!drawScaledScreens(painter))
         {
-            painter.setTransform(screenTrans[i]);
-            painter.drawImage(screenrc, screen[screenKind[i]]);
-        }
+            QRect screenrc(0, 0, 256, 192);
 
-#define MELONPRIME_HUD_BOTTOM_SCREEN_IMAGE (&screen[1])
-#include "MelonPrimeHudScreenCppOverlayOfSoftware.inc"
-#undef MELONPRIME_HUD_BOTTOM_SCREEN_IMAGE
+            for (int i = 0; i < numScreens; i++)
+            {
+                painter.setTransform(screenTrans[i]);
+                painter.drawImage(screenrc, screen[screenKind[i]]);
+            }
+        }
 
-        emuInstance->renderLock.unlock();
+#ifdef MELONPRIME_CUSTOM_HUD
+        if (hudVisible)
+            compositeHudOverlay(painter, hudEditMode);
+#endif
     }
 
     osdUpdate();
@@ -25,6 +25,7 @@
 #include <atomic>
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include <QWidget>
 #include <QImage>
@@ -37,12 +38,16 @@
 
 #include "glad/glad.h"
 #include "ScreenLayout.h"
+#include "SoftwareScaler.h"
+#include "FrameMailbox.h"
 #include "duckstation/gl/context.h"
 #include "MelonPrimePresentationSnapshot.h"
 
 #ifdef MELONPRIME_CUSTOM_HUD
 #include "MelonPrimeHudConfigOnScreenEdit.h"
 #include "MelonPrimeHudRender.h"
+#include "MelonPrimeHudRasterWorker.h"
+#include "MelonPrimeHudDrawList.h"
 #include "MelonPrimeLocalization.h"
 
 // The emulation identity is probed separately from the extended stamp.  New
@@ -103,6 +108,7 @@ struct HudVisualFrameKey {
 #endif // MELONPRIME_CUSTOM_HUD
 
 class MainWindow;
+class QPainter;
 class EmuInstance;
 class EmuThread;
 
@@ -546,20 +552,41 @@ protected:
 
 private:
     void setupScreenLayout() override;
+    // draws the screens through the software scaler, false if it can't
+    bool drawScaledScreens(QPainter& painter);
+#ifdef MELONPRIME_CUSTOM_HUD
+    // queues the HUD for the current visual frame on hudRaster, false if it
+    // isn't shown. Needs renderLock to snapshot the HUD inputs; the worker
+    // only sees the snapshot.
+    bool submitHudOverlay(EmuThread* emuThread, bool& editMode);
+    // draws the newest finished HUD frame over the screens
+    void compositeHudOverlay(QPainter& painter, bool editMode);
+#endif
 #ifdef MELONPRIME_DS
     void requestLatestFrameUpdate();
     void finishLatestFramePaint();
 #endif
 
-    QMutex bufferLock;
-    bool hasBuffers;
-    void* topBuffer;
-    void* bottomBuffer;
-    int bufferWidth = 256;
-    int bufferHeight = 192;
+    // frames come from the emu thread through this, see FrameMailbox
+    FrameMailbox* frames;
+    // serial of the mailbox frame screen[] currently wraps, 0 if none
+    melonDS::u64 screenSerial = 0;
 
     QImage screen[2];
     QTransform screenTrans[kMaxScreenTransforms];
+
+    // the screens get scaled on the CPU into this widget-sized image, which
+    // is then blitted 1:1; QPainter is only used for odd transforms
+    SoftwareScaler scaler;
+    QImage scaled;
+    int scaleFilterSetting = 0;     // Screen.SoftwareScaleFilter
+    bool scaledLayoutChanged = true;
+#ifdef MELONPRIME_CUSTOM_HUD
+    MelonPrime::HudRasterWorker hudRaster;
+    // main RAM copy for the HUD input snapshots, reused once the worker is
+    // done with it
+    std::shared_ptr<std::vector<uint8_t>> m_hudRAMBuffer;
+#endif
 #ifdef MELONPRIME_DS
     // Single-slot latest-frame mailbox. The emulation thread only posts a Qt
     // update when no earlier request is awaiting paint; newer frames replace
@@ -823,6 +850,21 @@ private:
     GLuint btmOverlayShader;
     GLint btmOverlayScreenSizeULoc, btmOverlayOpacityULoc, btmOverlaySrcCenterULoc, btmOverlaySrcRadiusULoc;
     GLuint btmOverlayVertexArray, btmOverlayVertexBuffer;
+
+    // Screen.HudAtlasRenderer: the HUD's text and icons are drawn from an
+    // atlas as instanced quads instead of being rasterised into Overlay[0].
+    // Gauges, the radar and the crosshair are still painted into Overlay[0]
+    // and uploaded through the dirty rect as without it.
+    bool hudAtlasEnabled = false;
+    MelonPrime::HudDrawList hudDrawList;
+    GLuint hudQuadShader;
+    GLint hudQuadScreenSizeULoc, hudQuadScaleFactorULoc;
+    GLuint hudQuadVertexArray;          // attribute-less, the shader builds the corners
+    GLuint hudQuadBuffer, hudQuadBufferTexture;
+    GLuint hudAtlasTexture;
+    uint64_t hudAtlasUploadedGen = 0;
+    uint64_t hudQuadUploadedSerial = 0;
+    size_t hudQuadBufferCapacity = 0;   // in quads
 #endif
 
     GLuint logoTexture;
@@ -21,6 +21,7 @@
 #include <stdio.h>
 #include <string.h>
 
+#include <algorithm>
 #include <optional>
 #include <string>
 
@@ -67,6 +68,7 @@
 
 #include "EmuInstance.h"
 #include "ArchiveUtil.h"
+#include "ArchiveCache.h"
 #include "CameraManager.h"
 #include "MPInterface.h"
 #include "Net.h"
@@ -302,6 +304,27 @@ static std::optional<QString> melonPrimeHudGoldenOutputPath(int argc, char** arg
     return std::nullopt;
 }
 
+struct MelonPrimeHudBenchArgs
+{
+    int Iterations;
+    QString Thresholds;
+};
+
+// --melonprime-hud-bench <iterations> <thresholds file|->
+static std::optional<MelonPrimeHudBenchArgs> melonPrimeHudBenchArgs(int argc, char** argv)
+{
+#if defined(MELONPRIME_CUSTOM_HUD) && defined(MELONPRIME_ENABLE_DEVELOPER_FEATURES)
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--melonprime-hud-bench") == 0 && i + 2 < argc)
+            return MelonPrimeHudBenchArgs{atoi(argv[i + 1]), QString::fromLocal8Bit(argv[i + 2])};
+    }
+#endif
+    (void)argc;
+    (void)argv;
+    return std::nullopt;
+}
+
 static std::string melonPrimeJsonString(const char* value)
 {
     std::string result = "\"";
@@ -500,6 +523,15 @@ int main(int argc, char** argv)
         }
         return MelonPrime::CustomHud_RunGoldenHarness(*goldenOut);
     }
+    if (const auto bench = melonPrimeHudBenchArgs(argc, argv); bench.has_value())
+    {
+        if (!Config::Load())
+        {
+            fprintf(stderr, "Unable to write to config.\n");
+            return 1;
+        }
+        return MelonPrime::CustomHud_RunBenchmark(bench->Iterations, bench->Thresholds);
+    }
 #endif
 
     CLI::CommandLineOptions* options = CLI::ManageArgs(melon);
@@ -555,6 +587,13 @@ int main(int argc, char** argv)
         {
             QApplication::setStyle(uitheme);
         }
+
+        if (cfg.GetBool("ArchiveCache.Enable"))
+        {
+            QString cachedir = emuDirectory + QDir::separator() + "archive-cache";
+            u64 maxbytes = (u64)std::max(cfg.GetInt("ArchiveCache.MaxSizeMB"), 0) << 20;
+            Archive::SetCache(std::make_unique<ArchiveCache>(cachedir.toStdString(), maxbytes));
+        }
     }
 
     // fix for Wayland OpenGL glitches
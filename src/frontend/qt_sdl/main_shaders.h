@@ -160,6 +160,78 @@ void main()
     oColor = vec4(keyedPixel.rgb / keyedPixel.a, alpha * keyedPixel.a);
 }
 )";
+
+// Custom HUD atlas quads (MelonPrime::HudDrawList). One instance per quad,
+// drawn as a 4-vertex strip; the quad itself is three RGBA32F texels in a
+// buffer texture (dst rect, atlas rect, opacity + smoothing), since the GL 3.2
+// baseline has no instanced vertex attributes.
+const char* kHudQuadVS = R"(#version 140
+
+uniform vec2 uScreenSize;
+uniform float uScaleFactor;
+uniform samplerBuffer QuadTex;
+
+flat out vec4 fSrcRect;
+flat out vec2 fParams;
+smooth out vec2 fTexcoord;
+
+void main()
+{
+    int base = gl_InstanceID * 3;
+    vec4 dstRect = texelFetch(QuadTex, base);
+    fSrcRect = texelFetch(QuadTex, base + 1);
+    fParams = texelFetch(QuadTex, base + 2).xy;
+
+    vec2 corner = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1));
+    vec2 pos = mix(dstRect.xy, dstRect.zw, corner);
+    fTexcoord = mix(fSrcRect.xy, fSrcRect.zw, corner);
+
+    vec4 fpos;
+    fpos.xy = ((pos * 2.0) / uScreenSize * uScaleFactor) - 1.0;
+    fpos.y *= -1;
+    fpos.z = 0.0;
+    fpos.w = 1.0;
+    gl_Position = fpos;
+}
+)";
+
+const char* kHudQuadFS = R"(#version 140
+
+uniform sampler2D AtlasTex;
+
+flat in vec4 fSrcRect;
+flat in vec2 fParams;   // x: opacity, y: smooth
+smooth in vec2 fTexcoord;
+
+out vec4 oColor;
+
+void main()
+{
+    // the atlas is premultiplied and sampled by hand, clamped to this entry,
+    // which is what QPainter::drawImage does with and without
+    // SmoothPixmapTransform
+    ivec2 texelMin = ivec2(fSrcRect.xy);
+    ivec2 texelMax = ivec2(fSrcRect.zw) - ivec2(1);
+    vec4 color;
+    if (fParams.y != 0.0)
+    {
+        vec2 texelPosition = fTexcoord - vec2(0.5);
+        ivec2 texelBase = ivec2(floor(texelPosition));
+        vec2 texelWeight = fract(texelPosition);
+        ivec2 texel00 = clamp(texelBase, texelMin, texelMax);
+        ivec2 texel11 = clamp(texelBase + ivec2(1), texelMin, texelMax);
+        color = mix(
+            mix(texelFetch(AtlasTex, texel00, 0), texelFetch(AtlasTex, ivec2(texel11.x, texel00.y), 0), texelWeight.x),
+            mix(texelFetch(AtlasTex, ivec2(texel00.x, texel11.y), 0), texelFetch(AtlasTex, texel11, 0), texelWeight.x),
+            texelWeight.y);
+    }
+    else
+    {
+        color = texelFetch(AtlasTex, clamp(ivec2(floor(fTexcoord)), texelMin, texelMax), 0);
+    }
+    oColor = color * fParams.x;
+}
+)";
 #endif
 
 #endif // MAIN_SHADERS_H
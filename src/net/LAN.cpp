@@ -17,6 +17,7 @@
 */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #ifdef __WIN32__
@@ -74,6 +75,9 @@ enum
 const int kDiscoveryPort = 7063;
 const int kLANPort = 7064;
 
+// how long a received MP packet may sit in the queue before it is considered stale
+const u64 kRXStaleTime = 16000;
+
 
 LAN::LAN() noexcept : Inited(false)
 {
@@ -95,9 +99,10 @@ LAN::LAN() noexcept : Inited(false)
 
     ConnectedBitmask = 0;
 
-    MPRecvTimeout = 25;
     LastHostID = -1;
     LastHostPeer = nullptr;
+    LastCmdTime = 0;
+    AdaptiveReplyTimeout = true;
 
     FrameCount = 0;
 
@@ -253,6 +258,7 @@ bool LAN::StartHost(const char* playername, int numplayers)
     HostAddress = kLocalhost;
     LastHostID = -1;
     LastHostPeer = nullptr;
+    ResetLinkState();
 
     Active = true;
     IsHost = true;
@@ -363,6 +369,7 @@ bool LAN::StartClient(const char* playername, const char* host)
     HostAddress = addr.host;
     LastHostID = -1;
     LastHostPeer = nullptr;
+    ResetLinkState();
     RemotePeers[0] = peer;
     peer->data = &Players[0];
 
@@ -378,13 +385,20 @@ void LAN::EndSession()
 
     Active = false;
 
+    if (IsHost)
+        LogLinkStats();
+
     while (!RXQueue.empty())
     {
-        ENetPacket* packet = RXQueue.front();
+        ENetPacket* packet = RXQueue.front().Packet;
         RXQueue.pop();
         enet_packet_destroy(packet);
     }
 
+    for (const RXEntry& entry : DelayQueue)
+        enet_packet_destroy(entry.Packet);
+    DelayQueue.clear();
+
     for (int i = 0; i < 16; i++)
     {
         if (i == MyPlayer.ID) continue;
@@ -792,14 +806,86 @@ void LAN::ProcessEvent(ENetEvent& event)
         ProcessClientEvent(event);
 }
 
+bool LAN::QueueMPPacket(ENetEvent& event)
+{
+    if (event.type != ENET_EVENT_TYPE_RECEIVE || event.channelID != Chan_MP)
+        return false;
+
+    MPPacketHeader* header = (MPPacketHeader*)&event.packet->data[0];
+
+    bool good = true;
+    if (event.packet->dataLength < sizeof(MPPacketHeader))
+        good = false;
+    else if (header->Magic != 0x4946494E)
+        good = false;
+    else if (header->SenderID == MyPlayer.ID)
+        good = false;
+    else if (header->SenderID >= 16)
+        good = false;
+
+    if (!good)
+    {
+        enet_packet_destroy(event.packet);
+        return true;
+    }
+
+    // mark this packet with the time it was received
+    RXEntry entry = {event.packet, event.peer, Platform::GetUSCount()};
+
+    if (Impairment.IsEnabled())
+    {
+        u64 release;
+        if (Impairment.Admit(entry.Time, &release))
+        {
+            entry.Time = release;
+            DelayQueue.push_back(entry);
+        }
+        else
+            enet_packet_destroy(event.packet);
+        return true;
+    }
+
+    RXQueue.push(entry);
+    return true;
+}
+
+bool LAN::ReleaseDelayedPackets(u64 now)
+{
+    bool released = false;
+
+    // release in delivery order, so that jitter can reorder packets like a real network would
+    for (;;)
+    {
+        auto next = DelayQueue.end();
+        for (auto it = DelayQueue.begin(); it != DelayQueue.end(); it++)
+        {
+            if (it->Time > now) continue;
+            if (next == DelayQueue.end() || it->Time < next->Time)
+                next = it;
+        }
+
+        if (next == DelayQueue.end())
+            break;
+
+        RXQueue.push(*next);
+        DelayQueue.erase(next);
+        released = true;
+    }
+
+    return released;
+}
+
 // 0 = per-frame processing of events and eventual misc. frame
 // 1 = checking if a misc. frame has arrived
-// 2 = waiting for a MP frame
-void LAN::ProcessLAN(int type)
+// 2 = waiting for a MP frame, for at most 'timeout' microseconds
+void LAN::ProcessLAN(int type, u32 timeout)
 {
     if (!Host) return;
 
-    u32 time_last = (u32)Platform::GetMSCount();
+    u64 time_last = Platform::GetUSCount();
+
+    if (!DelayQueue.empty())
+        ReleaseDelayedPackets(time_last);
 
     // see if we have queued packets already, get rid of the stale ones
     // any incoming packet should be consumed by the core quickly, so if
@@ -807,14 +893,13 @@ void LAN::ProcessLAN(int type)
     // we can assume they're stale
     while (!RXQueue.empty())
     {
-        ENetPacket* enetpacket = RXQueue.front();
-        MPPacketHeader* header = (MPPacketHeader*)&enetpacket->data[0];
-        u32 packettime = header->Magic;
+        RXEntry& entry = RXQueue.front();
+        MPPacketHeader* header = (MPPacketHeader*)&entry.Packet->data[0];
 
-        if ((packettime > time_last) || (packettime < (time_last - 16)))
+        if ((entry.Time > time_last) || ((time_last - entry.Time) > kRXStaleTime))
         {
+            enet_packet_destroy(entry.Packet);
             RXQueue.pop();
-            enet_packet_destroy(enetpacket);
         }
         else
         {
@@ -826,48 +911,66 @@ void LAN::ProcessLAN(int type)
                 if (header->Type == 0)
                     return;
 
+                enet_packet_destroy(entry.Packet);
                 RXQueue.pop();
-                enet_packet_destroy(enetpacket);
             }
 
             break;
         }
     }
 
-    int timeout = (type == 2) ? MPRecvTimeout : 0;
-    time_last = (u32)Platform::GetMSCount();
+    u64 deadline = time_last + ((type == 2) ? timeout : 0);
 
     ENetEvent event;
-    while (enet_host_service(Host, &event, timeout) > 0)
+    for (;;)
     {
-        if (event.type == ENET_EVENT_TYPE_RECEIVE && event.channelID == Chan_MP)
+        int waitms = 0;
+        if (type == 2)
         {
-            MPPacketHeader* header = (MPPacketHeader*)&event.packet->data[0];
-
-            bool good = true;
-            if (event.packet->dataLength < sizeof(MPPacketHeader))
-                good = false;
-            else if (header->Magic != 0x4946494E)
-                good = false;
-            else if (header->SenderID == MyPlayer.ID)
-                good = false;
-
-            if (!good)
+            // wake up early if an impaired packet is due before the deadline
+            u64 wake = deadline;
+            for (const RXEntry& entry : DelayQueue)
             {
-                enet_packet_destroy(event.packet);
+                if (entry.Time < wake) wake = entry.Time;
             }
-            else
-            {
-                // mark this packet with the time it was received
-                header->Magic = (u32)Platform::GetMSCount();
 
-                event.packet->userData = event.peer;
-                RXQueue.push(event.packet);
+            u64 now = Platform::GetUSCount();
+            if (wake > now)
+                waitms = (int)((wake - now + 999) / 1000);
+        }
+
+        int res = enet_host_service(Host, &event, waitms);
+        if (res < 0) return;
 
-                // return now -- if we are receiving MP frames, if we keep going
-                // we'll consume too many even if we have no timeout set
+        if (res == 0)
+        {
+            u64 now = Platform::GetUSCount();
+            if (!DelayQueue.empty() && ReleaseDelayedPackets(now))
                 return;
+            if ((type != 2) || (now >= deadline))
+                return;
+            continue;
+        }
+
+        size_t prevqueued = RXQueue.size();
+        if (QueueMPPacket(event))
+        {
+            if (type == 2)
+            {
+                // coalesce: everything ENet already pulled off the socket during
+                // this service call gets queued now, so a batch of replies is
+                // handled without going through enet_host_service once per reply
+                while (enet_host_check_events(Host, &event) > 0)
+                {
+                    if (!QueueMPPacket(event))
+                        ProcessEvent(event);
+                }
             }
+
+            // return now -- if we are receiving MP frames, if we keep going
+            // we'll consume too many even if we have no timeout set
+            if (RXQueue.size() > prevqueued)
+                return;
         }
         else
         {
@@ -876,21 +979,77 @@ void LAN::ProcessLAN(int type)
 
         if (type == 2)
         {
-            u32 time = (u32)Platform::GetMSCount();
-            if (time < time_last) return;
-            timeout -= (int)(time - time_last);
-            if (timeout <= 0) return;
-            time_last = time;
+            if (Platform::GetUSCount() >= deadline) return;
         }
     }
 }
 
+void LAN::ResetLinkState()
+{
+    LastCmdTime = 0;
+    for (int i = 0; i < 16; i++)
+    {
+        LinkStats[i].Reset();
+        LinkStatsSnapshot[i].Reset();
+    }
+
+    DelayQueue.clear();
+    if (Impairment.Parse(getenv("MELONDS_LAN_IMPAIR")))
+    {
+        Platform::Log(Platform::LogLevel::Warn,
+                      "LAN: network impairment active: delay=%uus jitter=%uus loss=%u/1000\n",
+                      Impairment.GetDelay(), Impairment.GetJitter(), Impairment.GetLossPermille());
+    }
+}
+
+u32 LAN::ReplyTimeout()
+{
+    u32 ceiling = (u32)RecvTimeout * 1000;
+    if (!AdaptiveReplyTimeout)
+        return ceiling;
+
+    u32 ret = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        if (i == MyPlayer.ID) continue;
+        if (!(ConnectedBitmask & (1 << i))) continue;
+
+        u32 timeout = LinkStats[i].ReplyTimeout(LANLinkStats::kMinReplyTimeout, ceiling);
+        if (timeout > ret) ret = timeout;
+    }
+
+    return ret ? ret : ceiling;
+}
+
+LANLinkStats LAN::GetLinkStats(int id)
+{
+    if (id < 0 || id >= 16) return LANLinkStats();
+
+    Platform::Mutex_Lock(PlayersMutex);
+    LANLinkStats ret = LinkStatsSnapshot[id];
+    Platform::Mutex_Unlock(PlayersMutex);
+    return ret;
+}
+
+void LAN::LogLinkStats()
+{
+    for (int i = 0; i < 16; i++)
+    {
+        if (i == MyPlayer.ID) continue;
+        if (LinkStats[i].GetRepliesExpected() == 0) continue;
+
+        Platform::Log(Platform::LogLevel::Info, "LAN: player %d MP replies: %s",
+                      i, LinkStats[i].Summary().c_str());
+    }
+}
+
 void LAN::Process()
 {
     if (!Active) return;
 
     ProcessDiscovery();
-    ProcessLAN(0);
+    ProcessLAN(0, 0);
 
     FrameCount++;
     if (FrameCount >= 60)
@@ -908,6 +1067,8 @@ void LAN::Process()
             Players[i].Ping = RemotePeers[i]->roundTripTime;
         }
 
+        memcpy(LinkStatsSnapshot, LinkStats, sizeof(LinkStats));
+
         Platform::Mutex_Unlock(PlayersMutex);
     }
 }
@@ -962,7 +1123,12 @@ int LAN::SendPacketGeneric(u32 type, u8* packet, int len, u64 timestamp)
         enet_peer_send(LastHostPeer, Chan_MP, enetpacket);
     else
         enet_host_broadcast(Host, Chan_MP, enetpacket);
-    enet_host_flush(Host);
+
+    // ACKs aren't flushed on their own: the next host service call or the
+    // next CMD sends them, in the same datagram as whatever else is queued
+    // for that client
+    if ((type & 0xFFFF) != 3)
+        enet_host_flush(Host);
 
     return len;
 }
@@ -971,10 +1137,11 @@ int LAN::RecvPacketGeneric(u8* packet, bool block, u64* timestamp)
 {
     if (!Host) return 0;
 
-    ProcessLAN(block ? 2 : 1);
+    ProcessLAN(block ? 2 : 1, (u32)RecvTimeout * 1000);
     if (RXQueue.empty()) return 0;
 
-    ENetPacket* enetpacket = RXQueue.front();
+    ENetPacket* enetpacket = RXQueue.front().Packet;
+    ENetPeer* peer = RXQueue.front().Peer;
     RXQueue.pop();
     MPPacketHeader* header = (MPPacketHeader*)&enetpacket->data[0];
 
@@ -988,7 +1155,7 @@ int LAN::RecvPacketGeneric(u8* packet, bool block, u64* timestamp)
         if (header->Type == 1)
         {
             LastHostID = header->SenderID;
-            LastHostPeer = (ENetPeer*)enetpacket->userData;
+            LastHostPeer = peer;
         }
     }
 
@@ -1011,6 +1178,7 @@ int LAN::RecvPacket(int inst, u8* packet, u64* timestamp)
 
 int LAN::SendCmd(int inst, u8* packet, int len, u64 timestamp)
 {
+    LastCmdTime = Platform::GetUSCount();
     return SendPacketGeneric(1, packet, len, timestamp);
 }
 
@@ -1043,22 +1211,30 @@ u16 LAN::RecvReplies(int inst, u8* packets, u64 timestamp, u16 aidmask)
 
     u16 ret = 0;
     u16 myinstmask = 1 << MyPlayer.ID;
+    u16 expectmask = ConnectedBitmask & ~myinstmask;
 
     if ((myinstmask & ConnectedBitmask) == ConnectedBitmask)
         return 0;
 
+    // only wait as long as the connected clients usually take to reply,
+    // counting from when the CMD frame went out
+    u64 deadline = LastCmdTime + ReplyTimeout();
+    bool timedout = false;
+
     for (;;)
     {
-        ProcessLAN(2);
+        u64 now = Platform::GetUSCount();
+        ProcessLAN(2, (deadline > now) ? (u32)(deadline - now) : 0);
         if (RXQueue.empty())
         {
             // no more replies available
-            return ret;
+            timedout = true;
+            break;
         }
 
-        ENetPacket* enetpacket = RXQueue.front();
+        RXEntry entry = RXQueue.front();
         RXQueue.pop();
-        MPPacketHeader* header = (MPPacketHeader*)&enetpacket->data[0];
+        MPPacketHeader* header = (MPPacketHeader*)&entry.Packet->data[0];
         bool good = true;
         if ((header->Type & 0xFFFF) != 2)
             good = false;
@@ -1073,23 +1249,39 @@ u16 LAN::RecvReplies(int inst, u8* packets, u64 timestamp, u16 aidmask)
                 if (len > 1024) len = 1024;
 
                 u32 aid = header->Type >> 16;
-                memcpy(&packets[(aid-1)*1024], &enetpacket->data[sizeof(MPPacketHeader)], len);
+                memcpy(&packets[(aid-1)*1024], &entry.Packet->data[sizeof(MPPacketHeader)], len);
 
                 ret |= (1<<aid);
             }
 
-            myinstmask |= (1<<header->SenderID);
+            u32 sender = header->SenderID;
+            if (!(myinstmask & (1<<sender)) && (entry.Time >= LastCmdTime))
+                LinkStats[sender].AddRTTSample((u32)(entry.Time - LastCmdTime));
+
+            myinstmask |= (1<<sender);
             if (((myinstmask & ConnectedBitmask) == ConnectedBitmask) ||
                 ((ret & aidmask) == aidmask))
             {
                 // all the clients have sent their reply
-                enet_packet_destroy(enetpacket);
-                return ret;
+                enet_packet_destroy(entry.Packet);
+                break;
             }
         }
 
-        enet_packet_destroy(enetpacket);
+        enet_packet_destroy(entry.Packet);
+    }
+
+    for (int i = 0; i < 16; i++)
+    {
+        if (!(expectmask & (1<<i))) continue;
+
+        if (myinstmask & (1<<i))
+            LinkStats[i].AddReplyReceived();
+        else if (timedout)
+            LinkStats[i].AddReplyLost();
     }
+
+    return ret;
 }
 
 }
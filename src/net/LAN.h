@@ -38,6 +38,7 @@
 #include "types.h"
 #include "Platform.h"
 #include "MPInterface.h"
+#include "LANLinkStats.h"
 
 namespace melonDS
 {
@@ -107,6 +108,14 @@ public:
     int RecvHostPacket(int inst, u8* data, u64* timestamp) override;
     u16 RecvReplies(int inst, u8* data, u64 timestamp, u16 aidmask) override;
 
+    // MP reply latency statistics for the given player, as seen by the host
+    // refreshed about once per second
+    LANLinkStats GetLinkStats(int id);
+
+    // when disabled, the host always waits the full MP.RecvTimeout for
+    // replies instead of adapting to the measured link latency
+    void SetAdaptiveReplyTimeout(bool enable) noexcept { AdaptiveReplyTimeout = enable; }
+
 private:
     bool Inited;
     bool Active;
@@ -130,10 +139,24 @@ private:
 
     u16 ConnectedBitmask;
 
-    int MPRecvTimeout;
+    struct RXEntry
+    {
+        ENetPacket* Packet;
+        ENetPeer* Peer;
+        u64 Time;       // when the packet was received, in microseconds
+    };
+
     int LastHostID;
     ENetPeer* LastHostPeer;
-    std::queue<ENetPacket*> RXQueue;
+    std::queue<RXEntry> RXQueue;
+
+    u64 LastCmdTime;
+    bool AdaptiveReplyTimeout;
+    LANLinkStats LinkStats[16];
+    LANLinkStats LinkStatsSnapshot[16];
+
+    LANImpairment Impairment;
+    std::vector<RXEntry> DelayQueue;
 
     u32 FrameCount;
 
@@ -145,7 +168,13 @@ private:
     void ProcessHostEvent(ENetEvent& event);
     void ProcessClientEvent(ENetEvent& event);
     void ProcessEvent(ENetEvent& event);
-    void ProcessLAN(int type);
+    bool QueueMPPacket(ENetEvent& event);
+    bool ReleaseDelayedPackets(u64 now);
+    void ProcessLAN(int type, u32 timeout);
+
+    void ResetLinkState();
+    u32 ReplyTimeout();
+    void LogLinkStats();
 
     int SendPacketGeneric(u32 type, u8* packet, int len, u64 timestamp);
     int RecvPacketGeneric(u8* packet, bool block, u64* timestamp);
@@ -0,0 +1,243 @@
+/*
+    Copyright 2016-2026 melonDS team
+
+    This file is part of melonDS.
+
+    melonDS is free software: you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the Free
+    Software Foundation, either version 3 of the License, or (at your option)
+    any later version.
+
+    melonDS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with melonDS. If not, see http://www.gnu.org/licenses/.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "LANLinkStats.h"
+
+namespace melonDS
+{
+
+void LANLinkStats::Reset() noexcept
+{
+    SRTT = 0;
+    RTTVar = 0;
+    Jitter = 0;
+    LastRTT = 0;
+    MinRTT = 0;
+    MaxRTT = 0;
+    NumSamples = 0;
+    Backoff = 0;
+
+    RepliesExpected = 0;
+    RepliesLost = 0;
+
+    memset(RTTHist, 0, sizeof(RTTHist));
+    memset(JitterHist, 0, sizeof(JitterHist));
+}
+
+int LANLinkStats::HistBucket(u32 us) noexcept
+{
+    int bucket = 0;
+    u32 edge = kHistBase;
+    while (us >= edge && bucket < (kHistBuckets-1))
+    {
+        bucket++;
+        edge <<= 1;
+    }
+    return bucket;
+}
+
+u32 LANLinkStats::HistBucketUpperEdge(int bucket) noexcept
+{
+    if (bucket >= (kHistBuckets-1)) return 0xFFFFFFFF;
+    return kHistBase << bucket;
+}
+
+void LANLinkStats::AddRTTSample(u32 us) noexcept
+{
+    if (NumSamples == 0)
+    {
+        SRTT = us;
+        RTTVar = us / 2;
+        MinRTT = us;
+        MaxRTT = us;
+    }
+    else
+    {
+        // RFC 6298: alpha = 1/8, beta = 1/4
+        u32 delta = (us > SRTT) ? (us - SRTT) : (SRTT - us);
+        RTTVar = RTTVar - (RTTVar >> 2) + (delta >> 2);
+        SRTT = SRTT - (SRTT >> 3) + (us >> 3);
+
+        // RFC 3550 interarrival jitter: J += (|D| - J) / 16
+        u32 d = (us > LastRTT) ? (us - LastRTT) : (LastRTT - us);
+        Jitter = (u32)((s32)Jitter + (((s32)d - (s32)Jitter) / 16));
+        JitterHist[HistBucket(d)]++;
+
+        if (us < MinRTT) MinRTT = us;
+        if (us > MaxRTT) MaxRTT = us;
+    }
+
+    LastRTT = us;
+    NumSamples++;
+    Backoff = 0;
+    RTTHist[HistBucket(us)]++;
+}
+
+void LANLinkStats::AddReplyLost() noexcept
+{
+    RepliesExpected++;
+    RepliesLost++;
+
+    // the reply may just have been slower than we thought, so wait longer
+    // next time -- lost replies never produce a sample to learn from
+    if (Backoff < 4) Backoff++;
+}
+
+u32 LANLinkStats::ReplyTimeout(u32 floor, u32 ceiling) const noexcept
+{
+    if (NumSamples < 8)
+        return ceiling;
+
+    // RFC 6298 RTO, with the variance term doubled: losing a reply costs the
+    // game a retransmission, waiting a little longer only costs host time
+    u64 timeout = (u64)SRTT + 8 * (u64)RTTVar;
+    timeout <<= Backoff;
+
+    if (timeout < floor) timeout = floor;
+    if (timeout > ceiling) timeout = ceiling;
+    return (u32)timeout;
+}
+
+u32 LANLinkStats::RTTPercentile(double p) const noexcept
+{
+    if (NumSamples == 0) return 0;
+
+    u64 total = 0;
+    for (int i = 0; i < kHistBuckets; i++)
+        total += RTTHist[i];
+
+    u64 target = (u64)(p * (double)total);
+    if (target >= total) target = total - 1;
+
+    u64 acc = 0;
+    for (int i = 0; i < kHistBuckets; i++)
+    {
+        acc += RTTHist[i];
+        if (acc > target)
+        {
+            u32 edge = HistBucketUpperEdge(i);
+            return (edge > MaxRTT) ? MaxRTT : edge;
+        }
+    }
+
+    return MaxRTT;
+}
+
+std::string LANLinkStats::Summary() const
+{
+    char buf[512];
+    int len = snprintf(buf, sizeof(buf),
+        "rtt %u/%u/%u us (min/avg/max) p50=%u p99=%u jitter=%u us, %llu samples, lost %llu/%llu\n  rtt hist:",
+        MinRTT, SRTT, MaxRTT,
+        RTTPercentile(0.5), RTTPercentile(0.99),
+        Jitter, (unsigned long long)NumSamples,
+        (unsigned long long)RepliesLost, (unsigned long long)RepliesExpected);
+
+    std::string ret(buf, len);
+    for (int i = 0; i < kHistBuckets; i++)
+    {
+        snprintf(buf, sizeof(buf), " %u", RTTHist[i]);
+        ret += buf;
+    }
+    ret += "\n  jitter hist:";
+    for (int i = 0; i < kHistBuckets; i++)
+    {
+        snprintf(buf, sizeof(buf), " %u", JitterHist[i]);
+        ret += buf;
+    }
+    ret += "\n";
+    return ret;
+}
+
+
+bool LANImpairment::Parse(const char* spec) noexcept
+{
+    Enabled = false;
+    if (!spec || !spec[0]) return false;
+
+    u32 delay = 0, jitter = 0, loss = 0, seed = 1;
+
+    const char* p = spec;
+    while (*p)
+    {
+        const char* eq = strchr(p, '=');
+        if (!eq) return false;
+
+        int keylen = (int)(eq - p);
+        char* end;
+        double val = strtod(eq+1, &end);
+        if (end == eq+1 || val < 0) return false;
+
+        if (keylen == 5 && !strncmp(p, "delay", 5))
+            delay = (u32)(val * 1000);
+        else if (keylen == 6 && !strncmp(p, "jitter", 6))
+            jitter = (u32)(val * 1000);
+        else if (keylen == 4 && !strncmp(p, "loss", 4))
+            loss = (u32)(val * 10);
+        else if (keylen == 4 && !strncmp(p, "seed", 4))
+            seed = (u32)val;
+        else
+            return false;
+
+        p = end;
+        if (*p == ',') p++;
+        else if (*p) return false;
+    }
+
+    Configure(delay, jitter, loss, seed);
+    return true;
+}
+
+void LANImpairment::Configure(u32 delayus, u32 jitterus, u32 losspermille, u32 seed) noexcept
+{
+    Delay = delayus;
+    JitterRange = jitterus;
+    LossPermille = (losspermille > 1000) ? 1000 : losspermille;
+    RandomState = seed ? seed : 1;
+    Enabled = (Delay != 0) || (JitterRange != 0) || (LossPermille != 0);
+}
+
+u32 LANImpairment::NextRandom() noexcept
+{
+    // xorshift32
+    u32 x = RandomState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    RandomState = x;
+    return x;
+}
+
+bool LANImpairment::Admit(u64 now, u64* release) noexcept
+{
+    if (LossPermille && (NextRandom() % 1000) < LossPermille)
+        return false;
+
+    u64 delay = Delay;
+    if (JitterRange)
+        delay += NextRandom() % (JitterRange + 1);
+
+    *release = now + delay;
+    return true;
+}
+
+}
@@ -0,0 +1,139 @@
+/*
+    Copyright 2016-2026 melonDS team
+
+    This file is part of melonDS.
+
+    melonDS is free software: you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the Free
+    Software Foundation, either version 3 of the License, or (at your option)
+    any later version.
+
+    melonDS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with melonDS. If not, see http://www.gnu.org/licenses/.
+*/
+
+#ifndef LANLINKSTATS_H
+#define LANLINKSTATS_H
+
+#include <string>
+
+#include "types.h"
+
+namespace melonDS
+{
+
+// Per-peer latency bookkeeping for the LAN MP transport.
+//
+// The host samples the time between sending a MP CMD frame and receiving each
+// client's reply. The smoothed RTT and its variance (RFC 6298 estimator) drive
+// the reply timeout, so a healthy LAN doesn't wait the full MP.RecvTimeout for
+// a reply that is never coming. Samples are also binned into log2 histograms
+// for RTT and jitter, and replies that never arrive are counted as lost.
+//
+// This has no ENet dependency so the loopback harness can drive it directly.
+class LANLinkStats
+{
+public:
+    // bucket N covers [kHistBase << (N-1), kHistBase << N) microseconds,
+    // bucket 0 is everything below kHistBase, the last bucket is open-ended
+    static constexpr int kHistBuckets = 12;
+    static constexpr u32 kHistBase = 125;
+
+    // lower bound for the adaptive MP reply timeout, in microseconds
+    // ENet services with millisecond granularity, so going lower buys nothing
+    static constexpr u32 kMinReplyTimeout = 2000;
+
+    LANLinkStats() noexcept { Reset(); }
+
+    void Reset() noexcept;
+
+    void AddRTTSample(u32 us) noexcept;
+    void AddReplyReceived() noexcept { RepliesExpected++; }
+    void AddReplyLost() noexcept;
+
+    // how long the host should wait for this peer's reply, in microseconds
+    // without enough samples this returns the ceiling (the configured timeout)
+    u32 ReplyTimeout(u32 floor, u32 ceiling) const noexcept;
+
+    bool HasSamples() const noexcept { return NumSamples > 0; }
+    u32 GetSmoothedRTT() const noexcept { return SRTT; }
+    u32 GetRTTVariance() const noexcept { return RTTVar; }
+    u32 GetJitter() const noexcept { return Jitter; }
+    u32 GetMinRTT() const noexcept { return MinRTT; }
+    u32 GetMaxRTT() const noexcept { return MaxRTT; }
+    u64 GetNumSamples() const noexcept { return NumSamples; }
+    u64 GetRepliesExpected() const noexcept { return RepliesExpected; }
+    u64 GetRepliesLost() const noexcept { return RepliesLost; }
+    const u32* GetRTTHistogram() const noexcept { return RTTHist; }
+    const u32* GetJitterHistogram() const noexcept { return JitterHist; }
+
+    // approximate percentile (0..1) from the RTT histogram, in microseconds
+    // (upper edge of the bucket containing it)
+    u32 RTTPercentile(double p) const noexcept;
+
+    std::string Summary() const;
+
+    static int HistBucket(u32 us) noexcept;
+    static u32 HistBucketUpperEdge(int bucket) noexcept;
+
+private:
+    u32 SRTT;
+    u32 RTTVar;
+    u32 Jitter;
+    u32 LastRTT;
+    u32 MinRTT;
+    u32 MaxRTT;
+    u64 NumSamples;
+
+    // exponential backoff after lost replies, cleared by the next sample
+    int Backoff;
+
+    u64 RepliesExpected;
+    u64 RepliesLost;
+
+    u32 RTTHist[kHistBuckets];
+    u32 JitterHist[kHistBuckets];
+};
+
+// Network impairment for evaluating the MP transport without real hardware.
+// Applied on the receive side: each MP packet is either dropped or held back
+// until its delivery time. Deterministic for a given seed.
+//
+// Configured from a spec string such as "delay=8,jitter=3,loss=2,seed=1"
+// (delay/jitter in milliseconds, loss in percent). The LAN frontend reads it
+// from the MELONDS_LAN_IMPAIR environment variable.
+class LANImpairment
+{
+public:
+    LANImpairment() noexcept = default;
+
+    bool Parse(const char* spec) noexcept;
+    void Configure(u32 delayus, u32 jitterus, u32 losspermille, u32 seed) noexcept;
+
+    bool IsEnabled() const noexcept { return Enabled; }
+
+    // decides the fate of one packet received at 'now' (microseconds)
+    // returns false if the packet is to be dropped, otherwise sets 'release'
+    bool Admit(u64 now, u64* release) noexcept;
+
+    u32 GetDelay() const noexcept { return Delay; }
+    u32 GetJitter() const noexcept { return JitterRange; }
+    u32 GetLossPermille() const noexcept { return LossPermille; }
+
+private:
+    u32 NextRandom() noexcept;
+
+    bool Enabled = false;
+    u32 Delay = 0;
+    u32 JitterRange = 0;
+    u32 LossPermille = 0;
+    u32 RandomState = 1;
+};
+
+}
+
+#endif // LANLINKSTATS_H
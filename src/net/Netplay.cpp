@@ -19,7 +19,9 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <algorithm>
 #include <queue>
+#include <vector>
 
 #include <enet/enet.h>
 
@@ -27,6 +29,7 @@
 #include "NDSCart.h"
 //#include "IPC.h"
 #include "Netplay.h"
+#include "NetplayBlob.h"
 //#include "Input.h"
 //#include "ROMManager.h"
 //#include "Config.h"
@@ -73,12 +76,14 @@ enum
     Blob_MAX
 };
 
-const u32 kChunkSize = 0x10000;
-u8 ChunkBuffer[0x10 + kChunkSize];
-u8* Blobs[Blob_MAX];
-u32 BlobLens[Blob_MAX];
-int CurBlobType;
-u32 CurBlobLen;
+u8 ChunkBuffer[NetplayBlobSender::kMaxMessageSize];
+NetplayBlobReceiver BlobReceiver;
+
+// how long SendBlobToMirrorClients waits for all clients to get a blob, and
+// how long it blocks in one go while waiting (ms)
+constexpr u64 kBlobSendTimeout = 30000;
+constexpr u32 kBlobSendPoll = 10;
+BlobSendProgressFunc BlobSendProgress;
 
 
 bool Init()
@@ -95,13 +100,18 @@ bool Init()
 
     NumMirrorClients = 0;
 
-    for (int i = 0; i < Blob_MAX; i++)
+    BlobReceiver.Reset();
+    BlobReceiver.SetCachePrefix(Platform::GetLocalFilePath("netplay_"));
+    // what the host may announce per blob: the largest DS ROM, the largest
+    // save memory (8 MB flash) and a savestate with DSi main RAM
+    BlobReceiver.SetMaxLength(Blob_CartROM, 512 * 1024 * 1024);
+    BlobReceiver.SetMaxLength(Blob_CartSRAM, 8 * 1024 * 1024);
+    BlobReceiver.SetMaxLength(Blob_InitState, 32 * 1024 * 1024);
+    BlobReceiver.SetProgress([](u8 type, u32 received, u32 total)
     {
-        Blobs[i] = nullptr;
-        BlobLens[i] = 0;
-    }
-    CurBlobType = -1;
-    CurBlobLen = 0;
+        if (received == total || (received % (NetplayBlobSender::kChunkSize * 64)) == 0)
+            Platform::Log(Platform::LogLevel::Info, "[MC] blob %d: %u/%u\n", type, received, total);
+    });
 
     /*if (enet_initialize() != 0)
     {
@@ -219,13 +229,8 @@ void StartClient(const char* playername, const char* host, int port)
 
 void StartMirror(const Player* player)
 {
-    for (int i = 0; i < Blob_MAX; i++)
-    {
-        Blobs[i] = nullptr;
-        BlobLens[i] = 0;
-    }
-    CurBlobType = -1;
-    CurBlobLen = 0;
+    // blobs and partial transfers are kept, so reconnecting to the mirror
+    // host resumes where the previous connection stopped
 
     MirrorHost = enet_host_create(nullptr, 1, 2, 0, 0);
     if (!MirrorHost)
@@ -340,123 +345,201 @@ bool SpawnMirrorInstance(Player player)
     return true;
 }
 
-bool SendBlobToMirrorClients(int type, u32 len, u8* data)
+// events SendBlobToMirrorClients took off MirrorHost that aren't part of the
+// transfer; ProcessMirrorHost() handles them before servicing the host again
+std::queue<ENetEvent> MirrorHostDeferred;
+
+int ServiceMirrorHost(ENetEvent* event, u32 timeout)
 {
-    u8* buf = ChunkBuffer;
+    if (!MirrorHostDeferred.empty())
+    {
+        *event = MirrorHostDeferred.front();
+        MirrorHostDeferred.pop();
+        return 1;
+    }
 
-    buf[0] = 0x01;
-    buf[1] = type & 0xFF;
-    buf[2] = 0;
-    buf[3] = 0;
-    *(u32*)&buf[4] = len;
+    return enet_host_service(MirrorHost, event, timeout);
+}
 
-    ENetPacket* pkt = enet_packet_create(buf, 8, ENET_PACKET_FLAG_RELIABLE);
-    enet_host_broadcast(MirrorHost, 1, pkt);
+void SetBlobSendProgress(BlobSendProgressFunc func)
+{
+    BlobSendProgress = std::move(func);
+}
 
-    if (len > 0)
-    {
-        buf[0] = 0x02;
-        *(u32*)&buf[12] = 0;
+void SendBlobManifest(ENetPeer* peer, const NetplayBlobSender& sender)
+{
+    u32 msglen = sender.WriteManifest(ChunkBuffer);
+    ENetPacket* pkt = enet_packet_create(ChunkBuffer, msglen, ENET_PACKET_FLAG_RELIABLE);
+    enet_peer_send(peer, 1, pkt);
+}
 
-        for (u32 pos = 0; pos < len; pos += kChunkSize)
-        {
-            u32 chunklen = kChunkSize;
-            if ((pos + chunklen) > len)
-                chunklen = len - pos;
+void SendBlobData(ENetPeer* peer, const NetplayBlobSender& sender, u32 offset)
+{
+    u32 msglen;
+    for (u32 pos = offset; (msglen = sender.WriteChunk(ChunkBuffer, pos)) > 0;
+         pos += NetplayBlobSender::kChunkSize)
+    {
+        ENetPacket* chunk = enet_packet_create(ChunkBuffer, msglen, ENET_PACKET_FLAG_RELIABLE);
+        enet_peer_send(peer, 1, chunk);
+    }
 
-            *(u32*)&buf[8] = pos;
-            memcpy(&buf[16], &data[pos], chunklen);
+    msglen = sender.WriteEnd(ChunkBuffer);
+    ENetPacket* end = enet_packet_create(ChunkBuffer, msglen, ENET_PACKET_FLAG_RELIABLE);
+    enet_peer_send(peer, 1, end);
+}
 
-            ENetPacket* pkt = enet_packet_create(buf, 16+chunklen, ENET_PACKET_FLAG_RELIABLE);
-            enet_host_broadcast(MirrorHost, 1, pkt);
-            //enet_host_flush(MirrorHost);
-        }
-    }
+bool SendBlobToMirrorClients(int type, u32 len, u8* data)
+{
+    // the ROM barely compresses and is usually already on the client's side
+    // from an earlier session; save memory and savestates are mostly zeroes
+    u8 flags = (type == Blob_CartROM) ? BlobFlag_Cacheable : BlobFlag_Compressed;
 
-    buf[0] = 0x03;
+    NetplayBlobSender sender;
+    if (!sender.Prepare(type, data, len, flags))
+        return false;
 
-    pkt = enet_packet_create(buf, 8, ENET_PACKET_FLAG_RELIABLE);
-    enet_host_broadcast(MirrorHost, 1, pkt);
+    const NetplayBlobManifest& manifest = sender.GetManifest();
+    Platform::Log(Platform::LogLevel::Info, "[MH] blob %d: %u bytes, %u on the wire, hash %016llX\n",
+                  type, manifest.RawLength, manifest.EncodedLength, (unsigned long long)manifest.Hash);
 
-    return true;
-}
+    // where each peer slot of MirrorHost is in the transfer
+    enum { Peer_Idle = 0, Peer_Pending, Peer_Done, Peer_Failed, Peer_Disconnected };
+    std::vector<u8> peerstate(MirrorHost->peerCount, Peer_Idle);
 
-void RecvBlobFromMirrorHost(ENetPeer* peer, ENetPacket* pkt)
-{
-    u8* buf = pkt->data;
-    if (buf[0] == 0x01)
+    // every client tells us where to start from: it may already have the
+    // blob, or part of it from an interrupted transfer
+    int ntotal = 0;
+    for (size_t i = 0; i < MirrorHost->peerCount; i++)
     {
-        if (CurBlobType != -1) return;
-        if (pkt->dataLength != 8) return;
+        ENetPeer* peer = &MirrorHost->peers[i];
+        if (peer->state != ENET_PEER_STATE_CONNECTED) continue;
 
-        int type = buf[1];
-        if (type > Blob_MAX) return;
+        SendBlobManifest(peer, sender);
+        peerstate[i] = Peer_Pending;
+        ntotal++;
+    }
+    enet_host_flush(MirrorHost);
 
-        u32 len = *(u32*)&buf[4];
-        if (len > 0x40000000) return;
+    int npending = ntotal;
+    int ndone = 0;
+    auto finish = [&](size_t i, u8 state)
+    {
+        if (peerstate[i] != Peer_Pending) return;
+        peerstate[i] = state;
+        npending--;
+        if (state == Peer_Done) ndone++;
+        Platform::Log(Platform::LogLevel::Info, "[MH] blob %d: %d/%d clients done\n", type, ndone, ntotal);
+        if (BlobSendProgress) BlobSendProgress(type, ndone, ntotal);
+    };
+
+    // the host is polled rather than blocked on, so one silent client can't
+    // hold the others up past the deadline
+    const u64 deadline = Platform::GetMSCount() + kBlobSendTimeout;
+    ENetEvent evt;
+    while (npending > 0)
+    {
+        u64 now = Platform::GetMSCount();
+        if (now >= deadline) break;
 
-        if (Blobs[type] != nullptr) return;
-        if (BlobLens[type] != 0) return;
-printf("[MC] start blob type=%d len=%d\n", type, len);
-        if (len) Blobs[type] = new u8[len];
-        BlobLens[type] = len;
+        u32 wait = (u32)std::min<u64>(deadline - now, kBlobSendPoll);
+        if (enet_host_service(MirrorHost, &evt, wait) <= 0)
+            continue;
 
-        CurBlobType = type;
-        CurBlobLen = len;
+        size_t slot = evt.peer ? (size_t)(evt.peer - MirrorHost->peers) : 0;
+        if (evt.type == ENET_EVENT_TYPE_CONNECT)
+        {
+            // a client that dropped out during the transfer gets the manifest
+            // again and resumes from what it already received
+            if (peerstate[slot] != Peer_Pending)
+            {
+                if (peerstate[slot] == Peer_Idle) ntotal++;
+                if (peerstate[slot] == Peer_Done) ndone--;
+                SendBlobManifest(evt.peer, sender);
+                enet_host_flush(MirrorHost);
+                peerstate[slot] = Peer_Pending;
+                npending++;
+            }
+            MirrorHostDeferred.push(evt);
+            continue;
+        }
+        if (evt.type == ENET_EVENT_TYPE_DISCONNECT)
+        {
+            if (peerstate[slot] == Peer_Pending)
+            {
+                Platform::Log(Platform::LogLevel::Warn, "[MH] client dropped out of blob %d\n", type);
+                finish(slot, Peer_Disconnected);
+            }
+            MirrorHostDeferred.push(evt);
+            continue;
+        }
+        if (evt.type != ENET_EVENT_TYPE_RECEIVE)
+            continue;
 
-        ENetEvent evt;
-        while (enet_host_service(MirrorHost, &evt, 5000) > 0)
+        bool consumed = false;
+        if (evt.channelID == 1 && peerstate[slot] == Peer_Pending)
         {
-            if (evt.type == ENET_EVENT_TYPE_RECEIVE && evt.channelID == 1)
+            u32 offset;
+            bool ok;
+            if (sender.ParseRequest(evt.packet->data, evt.packet->dataLength, &offset))
             {
-                RecvBlobFromMirrorHost(evt.peer, evt.packet);
-                if (evt.packet->dataLength >= 1 && evt.packet->data[0] == 0x03)
+                consumed = true;
+                if (offset == NetplayBlobSender::kSkip)
                 {
-                    printf("[MC] blob done while in fast recv loop\n");
-                    break;
+                    Platform::Log(Platform::LogLevel::Info, "[MH] client already has blob %d\n", type);
+                    finish(slot, Peer_Done);
+                }
+                else
+                {
+                    SendBlobData(evt.peer, sender, offset);
+                    enet_host_flush(MirrorHost);
                 }
             }
-            else
+            else if (sender.ParseAck(evt.packet->data, evt.packet->dataLength, &ok))
             {
-                printf("[MC] fast recv loop aborted because evt %d ch %d\n", evt.type, evt.channelID);
-                break;
+                consumed = true;
+                if (!ok)
+                    Platform::Log(Platform::LogLevel::Warn, "[MH] client failed to receive blob %d\n", type);
+                finish(slot, ok ? Peer_Done : Peer_Failed);
             }
         }
-    }
-    else if (buf[0] == 0x02)
-    {
-        if (CurBlobType < 0 || CurBlobType > Blob_MAX) return;
-        if (pkt->dataLength > (16+kChunkSize)) return;
 
-        int type = buf[1];
-        if (type != CurBlobType) return;
-
-        u32 len = *(u32*)&buf[4];
-        if (len != CurBlobLen) return;
+        if (consumed)
+            enet_packet_destroy(evt.packet);
+        else
+            MirrorHostDeferred.push(evt);
+    }
 
-        u32 pos = *(u32*)&buf[8];
-        if (pos >= len) return;
-        if ((pos + (pkt->dataLength-16)) > len) return;
+    if (npending > 0)
+        Platform::Log(Platform::LogLevel::Warn, "[MH] blob %d: %d clients timed out\n", type, npending);
 
-        u8* dst = Blobs[type];
-        if (!dst) return;
-        if (BlobLens[type] != len) return;
-        printf("[MC] recv blob data, type=%d pos=%08X len=%08X data=%08zX\n", type, pos, len, pkt->dataLength-16);
-        memcpy(&dst[pos], &buf[16], pkt->dataLength-16);
-    }
-    else if (buf[0] == 0x03)
+    // clients that left have nothing to load the blob into; they get it
+    // again with the next sync
+    bool ret = true;
+    for (size_t i = 0; i < MirrorHost->peerCount; i++)
     {
-        if (CurBlobType < 0 || CurBlobType > Blob_MAX) return;
-        if (pkt->dataLength != 8) return;
-
-        int type = buf[1];
-        if (type != CurBlobType) return;
+        if (peerstate[i] == Peer_Idle || peerstate[i] == Peer_Disconnected) continue;
+        if (MirrorHost->peers[i].state != ENET_PEER_STATE_CONNECTED) continue;
+        if (peerstate[i] != Peer_Done) ret = false;
+    }
+    return ret;
+}
 
-        u32 len = *(u32*)&buf[4];
-        if (len != CurBlobLen) return;
-printf("[MC] finish blob type=%d len=%d\n", type, len);
-        CurBlobType = -1;
-        CurBlobLen = 0;
+void RecvBlobFromMirrorHost(ENetPeer* peer, ENetPacket* pkt)
+{
+    u8* buf = pkt->data;
+    if (buf[0] == BlobMsg_Manifest || buf[0] == BlobMsg_Chunk || buf[0] == BlobMsg_End)
+    {
+        u8 reply[NetplayBlobReceiver::kMaxReplySize];
+        u32 replylen;
+        NetplayBlobReceiver::Result res = BlobReceiver.HandleMessage(buf, pkt->dataLength, reply, &replylen);
+        if (replylen)
+        {
+            ENetPacket* resp = enet_packet_create(reply, replylen, ENET_PACKET_FLAG_RELIABLE);
+            enet_peer_send(peer, 1, resp);
+            enet_host_flush(MirrorHost);
+        }
+        if (res == NetplayBlobReceiver::Result::Failed)
+            Platform::Log(Platform::LogLevel::Warn, "[MC] blob %d failed verification\n", buf[1]);
     }
     else if (buf[0] == 0x04)
     {
@@ -470,10 +553,11 @@ printf("[MC] finish blob type=%d len=%d\n", type, len);
         NDS::Reset();
         //SetBatteryLevels();
 
-        if (Blobs[Blob_CartROM])
+        if (BlobReceiver.HasBlob(Blob_CartROM))
         {
-            res = NDS::LoadCart(Blobs[Blob_CartROM], BlobLens[Blob_CartROM],
-                                Blobs[Blob_CartSRAM], BlobLens[Blob_CartSRAM]);
+            const std::vector<u8>& rom = BlobReceiver.GetBlob(Blob_CartROM);
+            const std::vector<u8>& sram = BlobReceiver.GetBlob(Blob_CartSRAM);
+            res = NDS::LoadCart(rom.data(), rom.size(), sram.data(), sram.size());
             if (!res)
             {
                 printf("!!!! FAIL!!\n");
@@ -493,18 +577,16 @@ printf("[MC] finish blob type=%d len=%d\n", type, len);
         // TODO: terrible hack!!
         #if 0
         FILE* f = Platform::OpenFile("netplay2.mln", "wb");
-        fwrite(Blobs[Blob_InitState], BlobLens[Blob_InitState], 1, f);
+        const std::vector<u8>& initstate = BlobReceiver.GetBlob(Blob_InitState);
+        fwrite(initstate.data(), initstate.size(), 1, f);
         fclose(f);
         Savestate* state = new Savestate("netplay2.mln", false);
         NDS::DoSavestate(state);
         delete state;
 
-        for (int i = 0; i < Blob_MAX; i++)
-        {
-            if (Blobs[i]) delete[] Blobs[i];
-            Blobs[i] = nullptr;
-            BlobLens[i] = 0;
-        }
+        // the ROM stays around, the next session will most likely use it again
+        BlobReceiver.TakeBlob(Blob_CartSRAM);
+        BlobReceiver.TakeBlob(Blob_InitState);
 
         /*Savestate* zorp = new Savestate("netplay3.mln", true);
         NDS::DoSavestate(zorp);
@@ -833,10 +915,10 @@ printf("birf\n");
 void ProcessMirrorHost()
 {
     if (!MirrorHost) return;
-#if 0
+
     bool block = false;
     ENetEvent event;
-    while (enet_host_service(MirrorHost, &event, block ? 5000 : 0) > 0)
+    while (ServiceMirrorHost(&event, block ? 5000 : 0) > 0)
     {
         switch (event.type)
         {
@@ -866,6 +948,7 @@ void ProcessMirrorHost()
             break;
 
         case ENET_EVENT_TYPE_RECEIVE:
+#if 0
             if (event.channelID == 0)
             {
                 if (event.packet->dataLength != 4) break;
@@ -916,10 +999,14 @@ void ProcessMirrorHost()
                     }
                 }
             }
+#endif
+            enet_packet_destroy(event.packet);
+            break;
+
+        case ENET_EVENT_TYPE_NONE:
             break;
         }
     }
-#endif
 }
 
 void ProcessMirrorClient()
@@ -19,6 +19,8 @@
 #ifndef NETPLAY_H
 #define NETPLAY_H
 
+#include <functional>
+
 #include "types.h"
 
 namespace Netplay
@@ -52,6 +54,12 @@ void StartGame();
 void ProcessFrame();
 void ProcessInput();
 
+// called while the host sends a blob (ROM, save memory, initial state) to its
+// mirror clients, whenever one of them got it, gave up or dropped: 'done' of
+// the 'total' clients that were sent the manifest hold it now
+using BlobSendProgressFunc = std::function<void(int type, int done, int total)>;
+void SetBlobSendProgress(BlobSendProgressFunc func);
+
 }
 
 #endif // NETPLAY_H
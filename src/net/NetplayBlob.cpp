@@ -0,0 +1,421 @@
+/*
+    Copyright 2016-2026 melonDS team
+
+    This file is part of melonDS.
+
+    melonDS is free software: you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the Free
+    Software Foundation, either version 3 of the License, or (at your option)
+    any later version.
+
+    melonDS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with melonDS. If not, see http://www.gnu.org/licenses/.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+
+#include <zstd.h>
+
+#include "NetplayBlob.h"
+#include "Platform.h"
+#include "xxhash/xxhash.h"
+
+namespace melonDS
+{
+using Platform::Log;
+using Platform::LogLevel;
+
+/*
+    Message formats (little endian, all on the reliable blob channel)
+
+    manifest (host -> client), 24 bytes:
+    00 - 0x01, type, flags, 0
+    04 - raw length
+    08 - encoded length
+    0C - reserved
+    10 - XXH3 hash of the raw blob (64-bit)
+
+    chunk (host -> client), 16 bytes + data:
+    00 - 0x02, type, 0, 0
+    04 - encoded length
+    08 - offset into the encoded stream
+    0C - reserved
+
+    end (host -> client), 16 bytes:
+    00 - 0x03, type, 0, 0
+    04 - encoded length
+    08 - hash
+
+    request (client -> host), 16 bytes:
+    00 - 0x06, type, 0, 0
+    04 - offset to send from, or 0xFFFFFFFF to skip the blob
+    08 - hash
+
+    ack (client -> host), 16 bytes:
+    00 - 0x07, type, ok, 0
+    04 - reserved
+    08 - hash
+*/
+
+// anything bigger than a DSi NAND is not something we'd ever send
+constexpr u32 kMaxBlobLength = 0x40000000;
+
+constexpr u32 kInitialReserve = 0x100000;
+
+static u32 Read32(const u8* p) { u32 v; memcpy(&v, p, 4); return v; }
+static u64 Read64(const u8* p) { u64 v; memcpy(&v, p, 8); return v; }
+static void Write32(u8* p, u32 v) { memcpy(p, &v, 4); }
+static void Write64(u8* p, u64 v) { memcpy(p, &v, 8); }
+
+u64 NetplayBlobHash(const u8* data, u32 len) noexcept
+{
+    return XXH3_64bits(data, len);
+}
+
+
+bool NetplayBlobSender::Prepare(u8 type, const u8* data, u32 len, u8 flags)
+{
+    if (len > kMaxBlobLength)
+        return false;
+
+    Manifest.Type = type;
+    Manifest.Flags = flags;
+    Manifest.RawLength = len;
+    Manifest.Hash = NetplayBlobHash(data, len);
+
+    Encoded.clear();
+    if ((flags & BlobFlag_Compressed) && len > 0)
+    {
+        Encoded.resize(ZSTD_compressBound(len));
+        size_t res = ZSTD_compress(Encoded.data(), Encoded.size(), data, len, ZSTD_CLEVEL_DEFAULT);
+        if (ZSTD_isError(res) || res >= len)
+        {
+            // incompressible, just send it as is
+            Manifest.Flags &= ~BlobFlag_Compressed;
+            Encoded.clear();
+        }
+        else
+        {
+            Encoded.resize(res);
+            Encoded.shrink_to_fit();
+        }
+    }
+
+    if (!(Manifest.Flags & BlobFlag_Compressed))
+        Encoded.assign(data, data + len);
+
+    Manifest.EncodedLength = (u32)Encoded.size();
+    return true;
+}
+
+u32 NetplayBlobSender::WriteManifest(u8* buf) const noexcept
+{
+    memset(buf, 0, 24);
+    buf[0] = BlobMsg_Manifest;
+    buf[1] = Manifest.Type;
+    buf[2] = Manifest.Flags;
+    Write32(&buf[4], Manifest.RawLength);
+    Write32(&buf[8], Manifest.EncodedLength);
+    Write64(&buf[16], Manifest.Hash);
+    return 24;
+}
+
+u32 NetplayBlobSender::WriteChunk(u8* buf, u32 offset) const noexcept
+{
+    if (offset >= Manifest.EncodedLength)
+        return 0;
+
+    u32 chunklen = Manifest.EncodedLength - offset;
+    if (chunklen > kChunkSize) chunklen = kChunkSize;
+
+    memset(buf, 0, kChunkHeaderSize);
+    buf[0] = BlobMsg_Chunk;
+    buf[1] = Manifest.Type;
+    Write32(&buf[4], Manifest.EncodedLength);
+    Write32(&buf[8], offset);
+    memcpy(&buf[kChunkHeaderSize], &Encoded[offset], chunklen);
+    return kChunkHeaderSize + chunklen;
+}
+
+u32 NetplayBlobSender::WriteEnd(u8* buf) const noexcept
+{
+    memset(buf, 0, 16);
+    buf[0] = BlobMsg_End;
+    buf[1] = Manifest.Type;
+    Write32(&buf[4], Manifest.EncodedLength);
+    Write64(&buf[8], Manifest.Hash);
+    return 16;
+}
+
+bool NetplayBlobSender::ParseRequest(const u8* msg, u32 len, u32* offset) const noexcept
+{
+    if (len != 16 || msg[0] != BlobMsg_Request || msg[1] != Manifest.Type)
+        return false;
+    if (Read64(&msg[8]) != Manifest.Hash)
+        return false;
+
+    u32 off = Read32(&msg[4]);
+    if (off != kSkip && off > Manifest.EncodedLength)
+        off = 0;
+    *offset = off;
+    return true;
+}
+
+bool NetplayBlobSender::ParseAck(const u8* msg, u32 len, bool* ok) const noexcept
+{
+    if (len != 16 || msg[0] != BlobMsg_Ack || msg[1] != Manifest.Type)
+        return false;
+    if (Read64(&msg[8]) != Manifest.Hash)
+        return false;
+
+    *ok = msg[2] != 0;
+    return true;
+}
+
+
+static u32 WriteRequest(u8* buf, const NetplayBlobManifest& manifest, u32 offset)
+{
+    memset(buf, 0, 16);
+    buf[0] = BlobMsg_Request;
+    buf[1] = manifest.Type;
+    Write32(&buf[4], offset);
+    Write64(&buf[8], manifest.Hash);
+    return 16;
+}
+
+static u32 WriteAck(u8* buf, const NetplayBlobManifest& manifest, bool ok)
+{
+    memset(buf, 0, 16);
+    buf[0] = BlobMsg_Ack;
+    buf[1] = manifest.Type;
+    buf[2] = ok ? 1 : 0;
+    Write64(&buf[8], manifest.Hash);
+    return 16;
+}
+
+NetplayBlobReceiver::NetplayBlobReceiver() noexcept
+{
+    for (u32& maxlen : MaxLength)
+        maxlen = kMaxBlobLength;
+}
+
+void NetplayBlobReceiver::SetMaxLength(u8 type, u32 maxlen)
+{
+    if (type < kMaxBlobs)
+        MaxLength[type] = std::min(maxlen, kMaxBlobLength);
+}
+
+void NetplayBlobReceiver::Reset()
+{
+    for (Slot& slot : Blobs)
+        slot = Slot();
+}
+
+std::vector<u8> NetplayBlobReceiver::TakeBlob(u8 type)
+{
+    if (type >= kMaxBlobs) return {};
+
+    Slot& slot = Blobs[type];
+    std::vector<u8> ret = std::move(slot.Data);
+    slot = Slot();
+    return ret;
+}
+
+std::string NetplayBlobReceiver::CachePath(u64 hash) const
+{
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.bin", (unsigned long long)hash);
+
+    return CachePrefix + name;
+}
+
+bool NetplayBlobReceiver::LoadFromCache(const NetplayBlobManifest& manifest, std::vector<u8>& out) const
+{
+    if (CachePrefix.empty())
+        return false;
+
+    Platform::FileHandle* file = Platform::OpenFile(CachePath(manifest.Hash), Platform::FileMode::Read);
+    if (!file)
+        return false;
+
+    bool ok = false;
+    if (Platform::FileLength(file) == manifest.RawLength)
+    {
+        out.resize(manifest.RawLength);
+        ok = Platform::FileRead(out.data(), manifest.RawLength, 1, file) == 1 || manifest.RawLength == 0;
+    }
+    Platform::CloseFile(file);
+
+    // a stale or truncated cache entry is no worse than a cache miss
+    return ok && NetplayBlobHash(out.data(), (u32)out.size()) == manifest.Hash;
+}
+
+void NetplayBlobReceiver::StoreInCache(const NetplayBlobManifest& manifest, const std::vector<u8>& data) const
+{
+    if (CachePrefix.empty() || !(manifest.Flags & BlobFlag_Cacheable))
+        return;
+
+    std::string path = CachePath(manifest.Hash);
+    Platform::FileHandle* file = Platform::OpenFile(path, Platform::FileMode::Write);
+    if (!file)
+    {
+        Log(LogLevel::Warn, "Netplay: could not write blob cache file %s\n", path.c_str());
+        return;
+    }
+
+    Platform::FileWrite(data.data(), data.size(), 1, file);
+    Platform::CloseFile(file);
+}
+
+bool NetplayBlobReceiver::Finish(Slot& slot)
+{
+    const NetplayBlobManifest& manifest = slot.Manifest;
+
+    if (manifest.Flags & BlobFlag_Compressed)
+    {
+        slot.Data.resize(manifest.RawLength);
+        size_t res = ZSTD_decompress(slot.Data.data(), slot.Data.size(), slot.Encoded.data(), slot.Encoded.size());
+        if (ZSTD_isError(res) || res != manifest.RawLength)
+        {
+            Log(LogLevel::Error, "Netplay: blob %d failed to decompress\n", manifest.Type);
+            return false;
+        }
+        slot.Encoded = std::vector<u8>();
+    }
+    else
+        slot.Data = std::move(slot.Encoded);
+
+    if (NetplayBlobHash(slot.Data.data(), (u32)slot.Data.size()) != manifest.Hash)
+    {
+        Log(LogLevel::Error, "Netplay: blob %d hash mismatch\n", manifest.Type);
+        return false;
+    }
+
+    StoreInCache(manifest, slot.Data);
+    return true;
+}
+
+NetplayBlobReceiver::Result NetplayBlobReceiver::HandleMessage(const u8* msg, u32 len, u8* reply, u32* replylen)
+{
+    *replylen = 0;
+    if (len < 1)
+        return Result::Ignored;
+
+    u8 type = (len >= 2) ? msg[1] : 0xFF;
+    if (type >= kMaxBlobs)
+        return Result::Ignored;
+    Slot& slot = Blobs[type];
+
+    switch (msg[0])
+    {
+    case BlobMsg_Manifest:
+        {
+            if (len != 24) return Result::Ignored;
+
+            NetplayBlobManifest manifest;
+            manifest.Type = type;
+            manifest.Flags = msg[2];
+            manifest.RawLength = Read32(&msg[4]);
+            manifest.EncodedLength = Read32(&msg[8]);
+            manifest.Hash = Read64(&msg[16]);
+            if (manifest.RawLength > MaxLength[type] || manifest.EncodedLength > MaxLength[type])
+                return Result::Ignored;
+
+            if (slot.Complete && slot.Manifest.Hash == manifest.Hash && slot.Data.size() == manifest.RawLength)
+            {
+                *replylen = WriteRequest(reply, manifest, NetplayBlobSender::kSkip);
+                return Result::Reply;
+            }
+
+            std::vector<u8> local;
+            if (LoadFromCache(manifest, local) ||
+                (Lookup && Lookup(manifest, local) && local.size() == manifest.RawLength &&
+                 NetplayBlobHash(local.data(), (u32)local.size()) == manifest.Hash))
+            {
+                slot = Slot();
+                slot.Manifest = manifest;
+                slot.Data = std::move(local);
+                slot.Complete = true;
+                slot.Skipped = true;
+                Log(LogLevel::Info, "Netplay: blob %d (%u bytes) found locally, skipping transfer\n", type, manifest.RawLength);
+                if (Progress) Progress(type, manifest.EncodedLength, manifest.EncodedLength);
+
+                *replylen = WriteRequest(reply, manifest, NetplayBlobSender::kSkip);
+                return Result::Reply;
+            }
+
+            u32 offset = 0;
+            if (slot.Active && slot.Manifest.Hash == manifest.Hash &&
+                slot.Manifest.EncodedLength == manifest.EncodedLength &&
+                slot.Manifest.Flags == manifest.Flags)
+            {
+                // same blob as the interrupted transfer, pick up where it stopped
+                offset = (u32)slot.Encoded.size();
+                Log(LogLevel::Info, "Netplay: resuming blob %d at %u/%u\n", type, offset, manifest.EncodedLength);
+            }
+            else
+            {
+                slot = Slot();
+                slot.Manifest = manifest;
+                slot.Active = true;
+                // the length comes from the peer: grow with the chunks that
+                // actually arrive rather than allocate all of it up front
+                slot.Encoded.reserve(std::min<u32>(manifest.EncodedLength, kInitialReserve));
+            }
+
+            *replylen = WriteRequest(reply, manifest, offset);
+            return Result::Reply;
+        }
+
+    case BlobMsg_Chunk:
+        {
+            if (len < NetplayBlobSender::kChunkHeaderSize || len > NetplayBlobSender::kMaxMessageSize)
+                return Result::Ignored;
+            if (!slot.Active || Read32(&msg[4]) != slot.Manifest.EncodedLength)
+                return Result::Ignored;
+
+            // the channel is ordered, so anything but the next chunk is a
+            // leftover from before a resume
+            u32 offset = Read32(&msg[8]);
+            u32 datalen = len - NetplayBlobSender::kChunkHeaderSize;
+            if (offset != slot.Encoded.size() || (offset + datalen) > slot.Manifest.EncodedLength)
+                return Result::Ignored;
+
+            const u8* data = &msg[NetplayBlobSender::kChunkHeaderSize];
+            slot.Encoded.insert(slot.Encoded.end(), data, data + datalen);
+            if (Progress) Progress(type, (u32)slot.Encoded.size(), slot.Manifest.EncodedLength);
+            return Result::Progress;
+        }
+
+    case BlobMsg_End:
+        {
+            if (len != 16) return Result::Ignored;
+            if (!slot.Active || Read64(&msg[8]) != slot.Manifest.Hash)
+                return Result::Ignored;
+            if (slot.Encoded.size() != slot.Manifest.EncodedLength)
+                return Result::Ignored;
+
+            slot.Active = false;
+            bool ok = Finish(slot);
+            *replylen = WriteAck(reply, slot.Manifest, ok);
+            if (!ok)
+            {
+                slot = Slot();
+                return Result::Failed;
+            }
+
+            slot.Complete = true;
+            return Result::Reply;
+        }
+    }
+
+    return Result::Ignored;
+}
+
+}
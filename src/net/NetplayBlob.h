@@ -0,0 +1,178 @@
+/*
+    Copyright 2016-2026 melonDS team
+
+    This file is part of melonDS.
+
+    melonDS is free software: you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the Free
+    Software Foundation, either version 3 of the License, or (at your option)
+    any later version.
+
+    melonDS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with melonDS. If not, see http://www.gnu.org/licenses/.
+*/
+
+#ifndef NETPLAYBLOB_H
+#define NETPLAYBLOB_H
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "types.h"
+
+namespace melonDS
+{
+
+// Blob transfer protocol used to bring mirror clients up to date when a
+// netplay session starts (cart ROM, save memory, initial savestate).
+//
+// The host announces each blob with a manifest carrying its XXH3 hash and
+// lengths. The client answers with the offset it wants the data from: zero
+// for a fresh transfer, the number of bytes it already holds when resuming an
+// interrupted one, or "skip" when it already has a blob with that hash (a ROM
+// from an earlier session, kept in the local cache). The host then streams
+// fixed-size chunks from that offset, and the client checks the hash of the
+// reassembled blob and acknowledges it.
+//
+// Blobs may be zstd-compressed; lengths and offsets in chunk messages always
+// refer to the encoded (possibly compressed) stream. The hash is of the raw
+// data, so a cached ROM matches no matter how it was sent.
+//
+// This has no ENet dependency: callers move the messages over a reliable,
+// ordered channel themselves.
+
+enum
+{
+    BlobMsg_Manifest = 0x01,
+    BlobMsg_Chunk = 0x02,
+    BlobMsg_End = 0x03,
+    // 0x04/0x05 are the session sync/start messages
+    BlobMsg_Request = 0x06,
+    BlobMsg_Ack = 0x07,
+};
+
+enum
+{
+    BlobFlag_Compressed = (1<<0),
+    BlobFlag_Cacheable = (1<<1),
+};
+
+struct NetplayBlobManifest
+{
+    u8 Type = 0;
+    u8 Flags = 0;
+    u32 RawLength = 0;
+    u32 EncodedLength = 0;
+    u64 Hash = 0;
+};
+
+class NetplayBlobSender
+{
+public:
+    static constexpr u32 kChunkSize = 0x10000;
+    static constexpr u32 kChunkHeaderSize = 16;
+    static constexpr u32 kMaxMessageSize = kChunkHeaderSize + kChunkSize;
+    static constexpr u32 kSkip = 0xFFFFFFFF;
+
+    NetplayBlobSender() noexcept = default;
+
+    // hashes (and compresses, if asked) the blob; the data is copied
+    // flags is a combination of BlobFlag_*
+    bool Prepare(u8 type, const u8* data, u32 len, u8 flags);
+
+    const NetplayBlobManifest& GetManifest() const noexcept { return Manifest; }
+
+    // message builders, return the message length
+    u32 WriteManifest(u8* buf) const noexcept;
+    // returns 0 once offset is past the end of the blob
+    u32 WriteChunk(u8* buf, u32 offset) const noexcept;
+    u32 WriteEnd(u8* buf) const noexcept;
+
+    // parses a client's request; returns false if it isn't a request for
+    // this blob. offset is kSkip if the client already has the blob
+    bool ParseRequest(const u8* msg, u32 len, u32* offset) const noexcept;
+    // parses a client's ack; returns false if it isn't an ack for this blob
+    bool ParseAck(const u8* msg, u32 len, bool* ok) const noexcept;
+
+private:
+    NetplayBlobManifest Manifest;
+    std::vector<u8> Encoded;
+};
+
+class NetplayBlobReceiver
+{
+public:
+    static constexpr int kMaxBlobs = 8;
+
+    // looks for a blob matching the manifest outside of the cache
+    // (eg. a ROM the user already has), fills 'out' and returns true if found
+    using LookupFunc = std::function<bool(const NetplayBlobManifest& manifest, std::vector<u8>& out)>;
+    using ProgressFunc = std::function<void(u8 type, u32 received, u32 total)>;
+
+    enum class Result
+    {
+        Ignored,    // not a blob message, or not one we expected
+        Progress,   // data taken in, nothing to send back
+        Reply,      // 'reply' holds a message for the host
+        Failed,     // the blob was bad; 'reply' holds a failure ack
+    };
+
+    NetplayBlobReceiver() noexcept;
+
+    // completed cacheable blobs are stored as <prefix><hash>.bin, and looked
+    // up again when a manifest with the same hash comes in
+    void SetCachePrefix(std::string prefix) { CachePrefix = std::move(prefix); }
+    void SetLookup(LookupFunc func) { Lookup = std::move(func); }
+    void SetProgress(ProgressFunc func) { Progress = std::move(func); }
+
+    // manifests announcing more than this many raw or encoded bytes for a
+    // blob type are ignored (default: kMaxBlobLength)
+    void SetMaxLength(u8 type, u32 maxlen);
+
+    // reply must have room for kMaxReplySize bytes
+    static constexpr u32 kMaxReplySize = 16;
+    Result HandleMessage(const u8* msg, u32 len, u8* reply, u32* replylen);
+
+    bool HasBlob(u8 type) const noexcept { return type < kMaxBlobs && Blobs[type].Complete; }
+    const std::vector<u8>& GetBlob(u8 type) const noexcept { return Blobs[type].Data; }
+    std::vector<u8> TakeBlob(u8 type);
+
+    // whether the last blob of this type was taken from a local copy
+    bool WasSkipped(u8 type) const noexcept { return type < kMaxBlobs && Blobs[type].Skipped; }
+
+    // forgets blobs and partial transfers
+    void Reset();
+
+private:
+    struct Slot
+    {
+        NetplayBlobManifest Manifest;
+        std::vector<u8> Encoded;    // received so far, for resume
+        std::vector<u8> Data;
+        bool Active = false;
+        bool Complete = false;
+        bool Skipped = false;
+    };
+
+    std::string CachePath(u64 hash) const;
+    bool LoadFromCache(const NetplayBlobManifest& manifest, std::vector<u8>& out) const;
+    void StoreInCache(const NetplayBlobManifest& manifest, const std::vector<u8>& data) const;
+    bool Finish(Slot& slot);
+
+    Slot Blobs[kMaxBlobs];
+    u32 MaxLength[kMaxBlobs];
+    std::string CachePrefix;
+    LookupFunc Lookup;
+    ProgressFunc Progress;
+};
+
+u64 NetplayBlobHash(const u8* data, u32 len) noexcept;
+
+}
+
+#endif // NETPLAYBLOB_H
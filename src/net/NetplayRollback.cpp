@@ -0,0 +1,456 @@
+/*
+    Copyright 2016-2026 melonDS team
+
+    This file is part of melonDS.
+
+    melonDS is free software: you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the Free
+    Software Foundation, either version 3 of the License, or (at your option)
+    any later version.
+
+    melonDS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with melonDS. If not, see http://www.gnu.org/licenses/.
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "NetplayRollback.h"
+#include "NDS.h"
+#include "Savestate.h"
+#include "Platform.h"
+
+namespace melonDS
+{
+using Platform::Log;
+using Platform::LogLevel;
+
+// the savestate part of a snapshot, without main RAM; grown on demand
+constexpr u32 kInitialSnapshotSize = 4 * 1024 * 1024;
+constexpr u32 kMaxSnapshotSize = 64 * 1024 * 1024;
+constexpr u32 kPageSize = 1 << StateHash::kPageShift;
+
+static RollbackInput DefaultCombiner(const RollbackInput* inputs, int numplayers)
+{
+    RollbackInput ret;
+    for (int i = 0; i < numplayers; i++)
+    {
+        ret.KeyMask &= inputs[i].KeyMask;
+        if (inputs[i].Touching && !ret.Touching)
+        {
+            ret.Touching = true;
+            ret.TouchX = inputs[i].TouchX;
+            ret.TouchY = inputs[i].TouchY;
+        }
+    }
+    return ret;
+}
+
+NetplayRollback::NetplayRollback(melonDS::NDS& nds, int numplayers, int localplayer, int maxrollback, int inputdelay) :
+    NDS(nds),
+    NumPlayers(numplayers),
+    LocalPlayer(localplayer),
+    MaxRollback(maxrollback),
+    InputDelay(inputdelay),
+    Combiner(DefaultCombiner),
+    SnapshotSize(kInitialSnapshotSize)
+{
+    if (NumPlayers < 1) NumPlayers = 1;
+    if (NumPlayers > kMaxPlayers) NumPlayers = kMaxPlayers;
+    if (LocalPlayer < 0 || LocalPlayer >= NumPlayers) LocalPlayer = 0;
+    if (MaxRollback < 1) MaxRollback = 1;
+    if (MaxRollback > (int)kHistoryLength / 2) MaxRollback = kHistoryLength / 2;
+    if (InputDelay < 0) InputDelay = 0;
+    if (InputDelay > (int)kHistoryLength / 2) InputDelay = kHistoryLength / 2;
+
+    History.resize(kHistoryLength * NumPlayers);
+    Used.resize(kHistoryLength * NumPlayers);
+    Hashes.resize(kHistoryLength);
+    Snapshots.resize(MaxRollback + 1);
+
+    // nobody can have sent input for the frames covered by the input delay,
+    // so they run with neutral input everywhere
+    for (int i = 0; i < NumPlayers; i++)
+        NextInput[i] = InputDelay;
+
+    // snapshots copy only the main RAM pages written since, which needs the
+    // write tracking to see fastmem stores too
+    NDS.StateHash.RequestWriteTracking(true);
+}
+
+NetplayRollback::~NetplayRollback()
+{
+    NDS.StateHash.RequestWriteTracking(false);
+}
+
+void NetplayRollback::SetInputCombiner(InputCombiner combiner)
+{
+    Combiner = combiner ? std::move(combiner) : InputCombiner(DefaultCombiner);
+}
+
+void NetplayRollback::SetHashInterval(u32 interval)
+{
+    HashInterval = interval;
+    NDS.StateHash.SetEnabled(interval != 0);
+
+    // only report frames we'll actually have a hash for
+    NextHashReport = CurFrame;
+    if (interval)
+        NextHashReport = ((CurFrame + interval - 1) / interval) * interval;
+}
+
+u32 NetplayRollback::GetConfirmedFrame() const noexcept
+{
+    u32 ret = NextInput[0];
+    for (int i = 1; i < NumPlayers; i++)
+        if (NextInput[i] < ret) ret = NextInput[i];
+    return ret;
+}
+
+u32 NetplayRollback::AddLocalInput(const RollbackInput& input)
+{
+    u32 frame = NextInput[LocalPlayer]++;
+    HistoryInput(frame, LocalPlayer) = input;
+    return frame;
+}
+
+bool NetplayRollback::AddRemoteInput(int player, u32 frame, const RollbackInput& input)
+{
+    if (player < 0 || player >= NumPlayers || player == LocalPlayer)
+        return false;
+    if (frame != NextInput[player])
+        return false;
+
+    // we can't hold on to input further ahead than the history, and the
+    // oldest unconfirmed frame mustn't be overwritten before it's resolved
+    if ((frame - GetConfirmedFrame()) >= (kHistoryLength - MaxRollback - InputDelay))
+        return false;
+
+    HistoryInput(frame, player) = input;
+    NextInput[player]++;
+
+    if (frame < CurFrame && UsedInput(frame, player) != input)
+    {
+        Stats.Mispredictions++;
+        if (frame < PendingRollback)
+            PendingRollback = frame;
+    }
+
+    return true;
+}
+
+bool NetplayRollback::CanAdvance() const noexcept
+{
+    if (CurFrame >= NextInput[LocalPlayer])
+        return false;
+
+    u32 confirmed = GetConfirmedFrame();
+    return confirmed > CurFrame || (CurFrame - confirmed) < (u32)MaxRollback;
+}
+
+RollbackInput NetplayRollback::PredictInput(u32 frame, int player) noexcept
+{
+    if (frame < NextInput[player])
+        return HistoryInput(frame, player);
+
+    // repeat the last input we know of -- held buttons are by far the most
+    // common case, and it keeps mispredictions to press/release edges
+    if (NextInput[player] == 0)
+        return RollbackInput();
+    return HistoryInput(NextInput[player] - 1, player);
+}
+
+void NetplayRollback::RunFrame()
+{
+    u32 frame = CurFrame;
+
+    // frames that only depend on confirmed input can never be rolled back to
+    if (frame >= GetConfirmedFrame())
+        SaveSnapshot(frame);
+
+    RollbackInput inputs[kMaxPlayers];
+    for (int i = 0; i < NumPlayers; i++)
+    {
+        inputs[i] = PredictInput(frame, i);
+        UsedInput(frame, i) = inputs[i];
+    }
+
+    RollbackInput combined = Combiner(inputs, NumPlayers);
+    NDS.SetKeyMask(combined.KeyMask);
+    if (combined.Touching)
+        NDS.TouchScreen(combined.TouchX, combined.TouchY);
+    else
+        NDS.ReleaseScreen();
+
+    NDS.RunFrame();
+
+    if (HashInterval && (frame % HashInterval) == 0)
+    {
+        FrameHash& fh = Hashes[frame % kHistoryLength];
+        fh.Frame = frame;
+        fh.Hash = NDS.StateHash.GetHash();
+    }
+
+    CurFrame++;
+}
+
+bool NetplayRollback::SaveSnapshot(u32 frame)
+{
+    u64 start = Platform::GetUSCount();
+    Snapshot& snap = Snapshots[frame % Snapshots.size()];
+
+    for (;;)
+    {
+        if (snap.Data.size() < SnapshotSize)
+            snap.Data.resize(SnapshotSize);
+
+        Savestate state(snap.Data.data(), (u32)snap.Data.size(), true);
+        if (!state.Error)
+        {
+            NDS.DoSavestate(&state, false);
+            state.Finish();
+        }
+
+        if (!state.Error)
+        {
+            snap.Length = state.Length();
+            snap.Frame = frame;
+            break;
+        }
+
+        if (SnapshotSize >= kMaxSnapshotSize)
+        {
+            Log(LogLevel::Error, "Netplay: rollback snapshot for frame %u doesn't fit in %u bytes\n", frame, SnapshotSize);
+            snap.Frame = 0xFFFFFFFF;
+            return false;
+        }
+        SnapshotSize *= 2;
+    }
+
+    Stats.SnapshotRAMBytes += SaveMainRAM(snap, frame);
+    Stats.SnapshotsTaken++;
+    Stats.SnapshotTime += Platform::GetUSCount() - start;
+    return true;
+}
+
+u32 NetplayRollback::SaveMainRAM(Snapshot& snap, u32 frame)
+{
+    StateHash& tracker = NDS.StateHash;
+    const u32 size = NDS.MainRAMMask + 1;
+
+    bool full = snap.MainRAM.size() != size || snap.RAMGeneration == 0 || !tracker.IsWriteTrackingComplete()
+        || (frame - snap.LastFullCopy) >= StateHash::kFullInterval;
+    u32 since = snap.RAMGeneration;
+    snap.RAMGeneration = tracker.NewGeneration();
+
+    if (full)
+    {
+        snap.MainRAM.resize(size);
+        memcpy(snap.MainRAM.data(), NDS.MainRAM, size);
+        snap.LastFullCopy = frame;
+        return size;
+    }
+
+    u32 copied = 0;
+    for (u32 page = 0; page < (size >> StateHash::kPageShift); page++)
+    {
+        if (!tracker.PageWrittenSince(page, since))
+            continue;
+        memcpy(&snap.MainRAM[page * kPageSize], &NDS.MainRAM[page * kPageSize], kPageSize);
+        copied += kPageSize;
+    }
+    return copied;
+}
+
+void NetplayRollback::LoadMainRAM(const Snapshot& snap)
+{
+    StateHash& tracker = NDS.StateHash;
+    const u32 size = (u32)snap.MainRAM.size();
+
+    if (!tracker.IsWriteTrackingComplete())
+    {
+        memcpy(NDS.MainRAM, snap.MainRAM.data(), size);
+        tracker.MarkAllDirty();
+        return;
+    }
+
+    // pages nobody wrote since the snapshot still match it; the restored ones
+    // count as written for the other snapshots and the state hash
+    for (u32 page = 0; page < (size >> StateHash::kPageShift); page++)
+    {
+        if (!tracker.PageWrittenSince(page, snap.RAMGeneration))
+            continue;
+        memcpy(&NDS.MainRAM[page * kPageSize], &snap.MainRAM[page * kPageSize], kPageSize);
+        tracker.MarkMainRAMDirty(page * kPageSize);
+    }
+}
+
+bool NetplayRollback::LoadSnapshot(u32 frame)
+{
+    Snapshot& snap = Snapshots[frame % Snapshots.size()];
+    if (snap.Frame != frame || snap.MainRAM.size() != NDS.MainRAMMask + 1)
+        return false;
+
+    Savestate state(snap.Data.data(), snap.Length, false);
+    if (state.Error || !NDS.DoSavestate(&state, false) || state.Error)
+        return false;
+    LoadMainRAM(snap);
+
+    CurFrame = frame;
+    return true;
+}
+
+void NetplayRollback::Rollback()
+{
+    u32 target = PendingRollback;
+    PendingRollback = 0xFFFFFFFF;
+    if (target >= CurFrame)
+        return;
+
+    u32 endframe = CurFrame;
+    u64 start = Platform::GetUSCount();
+
+    if (!LoadSnapshot(target))
+    {
+        // this means the session let itself get further ahead than the
+        // snapshot ring covers; the peers will diverge from here on
+        Log(LogLevel::Error, "Netplay: no snapshot for frame %u, can't roll back (at frame %u)\n", target, endframe);
+        return;
+    }
+
+    u32 depth = endframe - target;
+    Stats.Rollbacks++;
+    Stats.FramesResimulated += depth;
+    if (depth > Stats.MaxRollbackDepth)
+        Stats.MaxRollbackDepth = depth;
+
+    // these frames were already presented; only the state matters
+    bool wassuppressed = NDS.SPU.IsOutputSuppressed();
+    bool wasundrawn = NDS.GPU.IsRenderingSuppressed();
+    NDS.SPU.SetOutputSuppressed(true);
+    NDS.GPU.SetRenderingSuppressed(true);
+    while (CurFrame < endframe)
+        RunFrame();
+    NDS.GPU.SetRenderingSuppressed(wasundrawn);
+    NDS.SPU.SetOutputSuppressed(wassuppressed);
+
+    Stats.ResimTime += Platform::GetUSCount() - start;
+}
+
+bool NetplayRollback::AdvanceFrame()
+{
+    Synchronize();
+
+    if (!CanAdvance())
+        return false;
+
+    RunFrame();
+    Stats.FramesAdvanced++;
+
+    if (!RemoteHashes.empty())
+        CheckRemoteHashes();
+    return true;
+}
+
+void NetplayRollback::Synchronize()
+{
+    if (PendingRollback != 0xFFFFFFFF)
+        Rollback();
+
+    if (!RemoteHashes.empty())
+        CheckRemoteHashes();
+}
+
+bool NetplayRollback::IsFrameFinal(u32 frame) const noexcept
+{
+    return frame < CurFrame && frame < GetConfirmedFrame() && frame < PendingRollback;
+}
+
+bool NetplayRollback::PollLocalHash(u32* frame, u64* hash)
+{
+    if (!HashInterval || !IsFrameFinal(NextHashReport))
+        return false;
+
+    const FrameHash& fh = Hashes[NextHashReport % kHistoryLength];
+    u32 report = NextHashReport;
+    NextHashReport += HashInterval;
+
+    // fell too far behind polling; the hash has been overwritten
+    if (fh.Frame != report)
+        return false;
+
+    *frame = report;
+    *hash = fh.Hash;
+    return true;
+}
+
+bool NetplayRollback::AddRemoteHash(int player, u32 frame, u64 hash)
+{
+    if (player < 0 || player >= NumPlayers || player == LocalPlayer)
+        return true;
+    if (!HashInterval || (frame % HashInterval) != 0)
+        return true;
+
+    RemoteHashes.push_back({player, frame, hash});
+    return CheckRemoteHashes();
+}
+
+bool NetplayRollback::CheckRemoteHashes()
+{
+    bool ok = true;
+    while (!RemoteHashes.empty())
+    {
+        const RemoteHash& remote = RemoteHashes.front();
+        const FrameHash& local = Hashes[remote.Frame % kHistoryLength];
+
+        if (remote.Frame + kHistoryLength <= CurFrame || (local.Frame != remote.Frame && remote.Frame < CurFrame))
+        {
+            // too old to check; the local hash is gone
+            RemoteHashes.pop_front();
+            continue;
+        }
+        if (!IsFrameFinal(remote.Frame))
+            break;
+
+        Stats.HashesChecked++;
+        if (local.Hash != remote.Hash)
+        {
+            // once diverged, every later frame differs too; only report the first
+            if (Stats.Desyncs == 0)
+            {
+                Log(LogLevel::Error, "Netplay: desync with player %d at frame %u (local %016llx, remote %016llx)\n",
+                    remote.Player, remote.Frame, (unsigned long long)local.Hash, (unsigned long long)remote.Hash);
+            }
+            if (Stats.Desyncs == 0 || remote.Frame < Stats.FirstDesyncFrame)
+                Stats.FirstDesyncFrame = remote.Frame;
+            Stats.Desyncs++;
+            ok = false;
+        }
+        RemoteHashes.pop_front();
+    }
+    return ok;
+}
+
+std::string NetplayRollback::StatsSummary() const
+{
+    char buf[640];
+    snprintf(buf, sizeof(buf),
+        "frame %u (confirmed %u), %llu rollbacks, %llu frames resimulated (max depth %u), "
+        "%llu mispredictions, %llu snapshots (%.1f us, %.0f KB of main RAM avg), resim %.1f us avg per rollback, "
+        "%llu hashes checked, %llu desyncs\n",
+        CurFrame, GetConfirmedFrame(),
+        (unsigned long long)Stats.Rollbacks, (unsigned long long)Stats.FramesResimulated,
+        Stats.MaxRollbackDepth, (unsigned long long)Stats.Mispredictions,
+        (unsigned long long)Stats.SnapshotsTaken,
+        Stats.SnapshotsTaken ? (double)Stats.SnapshotTime / Stats.SnapshotsTaken : 0.0,
+        Stats.SnapshotsTaken ? (double)Stats.SnapshotRAMBytes / Stats.SnapshotsTaken / 1024.0 : 0.0,
+        Stats.Rollbacks ? (double)Stats.ResimTime / Stats.Rollbacks : 0.0,
+        (unsigned long long)Stats.HashesChecked, (unsigned long long)Stats.Desyncs);
+    return buf;
+}
+
+}
@@ -0,0 +1,215 @@
+/*
+    Copyright 2016-2026 melonDS team
+
+    This file is part of melonDS.
+
+    melonDS is free software: you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the Free
+    Software Foundation, either version 3 of the License, or (at your option)
+    any later version.
+
+    melonDS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with melonDS. If not, see http://www.gnu.org/licenses/.
+*/
+
+#ifndef NETPLAYROLLBACK_H
+#define NETPLAYROLLBACK_H
+
+#include <deque>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "types.h"
+
+namespace melonDS
+{
+class NDS;
+
+// One player's input for one frame, in the form NDS::SetKeyMask and
+// NDS::TouchScreen take it (key bits are active low).
+struct RollbackInput
+{
+    u32 KeyMask = 0xFFF;
+    bool Touching = false;
+    u16 TouchX = 0;
+    u16 TouchY = 0;
+
+    bool operator==(const RollbackInput& other) const noexcept
+    {
+        return KeyMask == other.KeyMask && Touching == other.Touching &&
+            (!Touching || (TouchX == other.TouchX && TouchY == other.TouchY));
+    }
+    bool operator!=(const RollbackInput& other) const noexcept { return !(*this == other); }
+};
+
+struct RollbackStats
+{
+    u64 FramesAdvanced = 0;
+    u64 Rollbacks = 0;
+    u64 FramesResimulated = 0;
+    u32 MaxRollbackDepth = 0;
+    u64 Mispredictions = 0;
+    u64 SnapshotsTaken = 0;
+    u64 SnapshotTime = 0;   // microseconds spent saving snapshots
+    u64 SnapshotRAMBytes = 0; // main RAM copied into snapshots
+    u64 ResimTime = 0;      // microseconds spent loading + re-simulating
+    u64 HashesChecked = 0;
+    u64 Desyncs = 0;
+    u32 FirstDesyncFrame = 0xFFFFFFFF;
+};
+
+// Rollback netcode on top of savestates.
+//
+// Every peer runs the same emulation. Local input is applied InputDelay frames
+// after it is sampled; input from remote players that hasn't arrived yet is
+// predicted by repeating their last known input. Before running a frame that
+// depends on a prediction, the emulator state is snapshotted into a ring of
+// MaxRollback+1 in-memory snapshots. When a remote input turns out to differ
+// from what was predicted, the state is restored to the first wrong frame and
+// the frames up to the present are re-simulated with audio output and 2D
+// drawing suppressed (see GPU::SetRenderingSuppressed). Frames whose inputs
+// are all confirmed are never snapshotted, so when the input delay covers the
+// link latency this costs nothing.
+//
+// A snapshot is a savestate of everything but main RAM, plus a raw copy of
+// main RAM (only the console's actual size of it). Main RAM is the bulk of the
+// state, so each slot only copies the pages written since that slot was last
+// saved, going by StateHash's write tracking, and loading only copies back the
+// pages written since the snapshot. While the tracking is incomplete (JIT
+// fastmem), main RAM is copied in full both ways; either way a slot gets a full
+// copy at least every StateHash::kFullInterval frames, which bounds how long
+// a write that bypasses the bus handlers can linger in it.
+//
+// The session is transport-agnostic: the caller sends whatever AddLocalInput
+// returns to the other peers, and feeds what it receives into AddRemoteInput.
+// Remote input must arrive in order for each player.
+//
+// Desync detection: with a hash interval set, the NDS state hash (see
+// StateHash) is recorded after every Nth frame. Once a frame is final (all of
+// its input confirmed, nothing left to roll back), PollLocalHash hands the
+// hash out for sending, and hashes received through AddRemoteHash are
+// compared against it.
+class NetplayRollback
+{
+public:
+    static constexpr int kMaxPlayers = 16;
+    static constexpr u32 kHistoryLength = 128;
+
+    // merges the per-player inputs of one frame into what the emulator sees
+    // the default ANDs the key masks and uses the first touching player
+    using InputCombiner = std::function<RollbackInput(const RollbackInput* inputs, int numplayers)>;
+
+    NetplayRollback(melonDS::NDS& nds, int numplayers, int localplayer, int maxrollback = 8, int inputdelay = 2);
+    ~NetplayRollback();
+    NetplayRollback(const NetplayRollback&) = delete;
+    NetplayRollback& operator=(const NetplayRollback&) = delete;
+
+    void SetInputCombiner(InputCombiner combiner);
+
+    // records the state hash every 'interval' frames; 0 turns it off
+    void SetHashInterval(u32 interval);
+
+    // queues the local player's input; returns the frame it applies to
+    u32 AddLocalInput(const RollbackInput& input);
+
+    // returns false if the input is out of order or older than the history
+    bool AddRemoteInput(int player, u32 frame, const RollbackInput& input);
+
+    // whether the local input for the next frame is known and running it
+    // would not take the session further ahead than it can roll back
+    [[nodiscard]] bool CanAdvance() const noexcept;
+
+    // resolves any pending rollback, then runs the next frame
+    // returns false if the frame can't be run yet (see CanAdvance)
+    bool AdvanceFrame();
+
+    // resolves any pending rollback without running a new frame
+    void Synchronize();
+
+    // returns the next final local hash not handed out yet, if any
+    bool PollLocalHash(u32* frame, u64* hash);
+
+    // queues a peer's hash for comparison; it's checked as soon as the local
+    // hash for that frame is final. returns false if a desync was found
+    bool AddRemoteHash(int player, u32 frame, u64 hash);
+
+    [[nodiscard]] bool HasDesynced() const noexcept { return Stats.Desyncs != 0; }
+
+    [[nodiscard]] u32 GetCurrentFrame() const noexcept { return CurFrame; }
+    [[nodiscard]] u32 GetConfirmedFrame() const noexcept;
+    [[nodiscard]] int GetInputDelay() const noexcept { return InputDelay; }
+    [[nodiscard]] int GetMaxRollback() const noexcept { return MaxRollback; }
+    [[nodiscard]] const RollbackStats& GetStats() const noexcept { return Stats; }
+    std::string StatsSummary() const;
+
+private:
+    struct Snapshot
+    {
+        std::vector<u8> Data;       // savestate without main RAM
+        u32 Length = 0;
+        std::vector<u8> MainRAM;
+        u32 RAMGeneration = 0;      // StateHash generation MainRAM is current to
+        u32 LastFullCopy = 0;       // frame of the last full main RAM copy
+        u32 Frame = 0xFFFFFFFF;
+    };
+
+    struct FrameHash
+    {
+        u32 Frame = 0xFFFFFFFF;
+        u64 Hash = 0;
+    };
+
+    struct RemoteHash
+    {
+        int Player;
+        u32 Frame;
+        u64 Hash;
+    };
+
+    RollbackInput& HistoryInput(u32 frame, int player) noexcept
+    { return History[(frame % kHistoryLength) * NumPlayers + player]; }
+    RollbackInput& UsedInput(u32 frame, int player) noexcept
+    { return Used[(frame % kHistoryLength) * NumPlayers + player]; }
+
+    RollbackInput PredictInput(u32 frame, int player) noexcept;
+    void RunFrame();
+    bool SaveSnapshot(u32 frame);
+    bool LoadSnapshot(u32 frame);
+    u32 SaveMainRAM(Snapshot& snap, u32 frame);
+    void LoadMainRAM(const Snapshot& snap);
+    void Rollback();
+    bool IsFrameFinal(u32 frame) const noexcept;
+    bool CheckRemoteHashes();
+
+    melonDS::NDS& NDS;
+    int NumPlayers;
+    int LocalPlayer;
+    int MaxRollback;
+    int InputDelay;
+    InputCombiner Combiner;
+
+    u32 CurFrame = 0;           // next frame to be simulated
+    u32 NextInput[kMaxPlayers]; // next frame whose input we expect per player
+    u32 PendingRollback = 0xFFFFFFFF;
+
+    std::vector<RollbackInput> History; // confirmed inputs
+    std::vector<RollbackInput> Used;    // inputs the frame was simulated with
+    std::vector<Snapshot> Snapshots;
+    u32 SnapshotSize;
+
+    u32 HashInterval = 0;
+    u32 NextHashReport = 0;
+    std::vector<FrameHash> Hashes;      // state after each hashed frame
+    std::deque<RemoteHash> RemoteHashes;
+
+    RollbackStats Stats;
+};
+
+}
+
+#endif // NETPLAYROLLBACK_H
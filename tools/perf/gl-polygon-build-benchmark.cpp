@@ -0,0 +1,251 @@
+/*
+    Per-frame CPU time GLRenderer3D spends building and uploading polygons,
+    on the calling thread only and split across worker threads.
+
+    Fills the 3D engine's render polygon list with a grid of overlapping
+    colored quads (and a few lines and pentagons) and renders frames from it
+    on a surfaceless EGL context (Mesa llvmpipe works), with and without "better
+    polygons", for a few polygon counts. Fails if the threaded build draws
+    anything different from the single-threaded one.
+
+    usage: melonprime_gl_polygon_build_bench [frames per run]
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+#include "NDS.h"
+#include "GPU_OpenGL.h"
+#include "../testing/headless/TestROM.h"
+
+using namespace melonDS;
+
+namespace
+{
+
+bool CreateContext()
+{
+    EGLDisplay display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    if (display == EGL_NO_DISPLAY || !eglInitialize(display, nullptr, nullptr))
+        return false;
+    if (!eglBindAPI(EGL_OPENGL_API))
+        return false;
+
+    const EGLint configAttribs[] = {
+        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_NONE
+    };
+    EGLConfig config;
+    EGLint numConfigs = 0;
+    if (!eglChooseConfig(display, configAttribs, &config, 1, &numConfigs) || numConfigs < 1)
+        return false;
+
+    const EGLint contextAttribs[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 4,
+        EGL_CONTEXT_MINOR_VERSION, 3,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE
+    };
+    EGLContext context = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttribs);
+    if (context == EGL_NO_CONTEXT)
+        return false;
+    if (!eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context))
+        return false;
+
+    return gladLoadGLLoader(reinterpret_cast<GLADloadproc>(eglGetProcAddress)) != 0;
+}
+
+struct Scene
+{
+    std::vector<Vertex> Vertices;
+    std::vector<Polygon> Polygons;
+};
+
+void BuildScene(Scene& scene, u32 count)
+{
+    scene.Vertices.assign(count * 5, Vertex {});
+    scene.Polygons.assign(count, Polygon {});
+
+    for (u32 i = 0; i < count; i++)
+    {
+        Polygon& poly = scene.Polygons[i];
+        // mostly quads, like most games
+        u32 nverts = (i % 17 == 0) ? 5 : 4;
+        bool line = (i % 29 == 0);
+
+        s32 x = (s32)((i * 37) % 224), y = (s32)((i * 53) % 160);
+        s32 size = 8 + (s32)(i % 24);
+        const s32 corners[5][2] = {
+            {x, y}, {x + size, y}, {x + size + size / 4, y + size / 2},
+            {x + size, y + size}, {x, y + size},
+        };
+        const s32 quad[4] = {0, 1, 3, 4};
+
+        poly.NumVertices = line ? 2 : nverts;
+        for (u32 j = 0; j < poly.NumVertices; j++)
+        {
+            Vertex& vtx = scene.Vertices[i * 5 + j];
+            const s32* pos = corners[(nverts == 4 || line) ? quad[j] : j];
+            vtx.FinalPosition[0] = pos[0];
+            vtx.FinalPosition[1] = pos[1];
+            vtx.HiresPosition[0] = pos[0] << 4;
+            vtx.HiresPosition[1] = pos[1] << 4;
+            vtx.FinalColor[0] = (s32)((i * 8 + j * 40) & 0x1FF);
+            vtx.FinalColor[1] = (s32)((i * 3 + 100) & 0x1FF);
+            vtx.FinalColor[2] = (s32)((j * 90 + i) & 0x1FF);
+
+            poly.Vertices[j] = &vtx;
+            poly.FinalZ[j] = (s32)(0x10000 + i * 64 + j);
+            poly.FinalW[j] = 0x1000;
+        }
+
+        poly.Type = line ? 1 : 0;
+        poly.Attr = (31 << 16) | (0x3 << 6) | ((i & 0x3F) << 24);
+        poly.FacingView = true;
+        poly.YTop = y;
+        poly.YBottom = y + size;
+    }
+}
+
+struct RunResult
+{
+    u64 Frames = 0;
+    double AvgUS = 0;
+    u32 Threads = 0;
+    u64 RingWaits = 0;
+    bool Persistent = false;
+    std::vector<u8> Image;
+};
+
+RunResult Run(NDS& nds, GLRenderer& renderer, Scene& scene, bool better, int threads, int frames)
+{
+    GLRenderer3D* rend3d = renderer.GetGLRenderer3D();
+    rend3d->SetPolygonBuildThreads(threads);
+
+    RendererSettings settings {};
+    settings.ScaleFactor = 1;
+    settings.BetterPolygons = better;
+    renderer.SetRenderSettings(settings);
+
+    GPU3D& gpu3d = nds.GPU.GPU3D;
+    for (size_t i = 0; i < scene.Polygons.size(); i++)
+        gpu3d.RenderPolygonRAM[i] = &scene.Polygons[i];
+    gpu3d.RenderNumPolygons = (u32)scene.Polygons.size();
+
+    // the stats count from the last reset; frames are rendered directly,
+    // as nothing would flush a new polygon list through the geometry engine
+    rend3d->Reset();
+    for (int i = 0; i < frames; i++)
+    {
+        gpu3d.RenderFrameIdentical = false;
+        rend3d->RenderFrame();
+    }
+
+    const GLPolygonBuildStats& stats = rend3d->GetPolygonBuildStats();
+    RunResult result;
+    result.Frames = stats.Frames;
+    result.AvgUS = stats.Frames ? (double)stats.TotalUS / stats.Frames : 0;
+    result.Threads = stats.LastThreads;
+    result.RingWaits = stats.RingWaits;
+    result.Persistent = stats.Persistent;
+
+    // RenderFrame() leaves its color buffer bound for drawing
+    GLint framebuffer = 0;
+    glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &framebuffer);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+    glReadBuffer(GL_COLOR_ATTACHMENT0);
+    result.Image.resize(256 * 192 * 4);
+    glReadPixels(0, 0, 256, 192, GL_RGBA, GL_UNSIGNED_BYTE, result.Image.data());
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    setenv("EGL_PLATFORM", "surfaceless", 0);
+    int frames = argc > 1 ? atoi(argv[1]) : 120;
+    if (frames < 1) frames = 1;
+
+    if (!CreateContext())
+    {
+        fprintf(stderr, "could not create an OpenGL 4.3 context through EGL\n");
+        return 1;
+    }
+    printf("%s, %s\n", glGetString(GL_RENDERER), glGetString(GL_VERSION));
+
+    std::vector<u8> rom = TestROM::Build();
+    auto nds = TestROM::Boot(rom);
+    if (!nds)
+    {
+        fprintf(stderr, "could not boot the test ROM\n");
+        return 1;
+    }
+    nds->SetRenderer(std::make_unique<GLRenderer>(*nds, false));
+    auto* renderer = dynamic_cast<GLRenderer*>(&nds->GetRenderer());
+    if (!renderer || !renderer->GetGLRenderer3D())
+    {
+        fprintf(stderr, "OpenGL renderer didn't start\n");
+        return 1;
+    }
+
+    int failures = 0;
+    bool printedMode = false;
+    for (bool better : {false, true})
+    {
+        for (u32 count : {256u, 1024u, 2048u})
+        {
+            Scene scene;
+            BuildScene(scene, count);
+
+            RunResult single = Run(*nds, *renderer, scene, better, 1, frames);
+            // as many threads as the renderer would use on a big machine, so
+            // the banded path is exercised even on a small one
+            RunResult threaded = Run(*nds, *renderer, scene, better, 4, frames);
+
+            if (!printedMode)
+            {
+                printf("%s\n", single.Persistent ? "persistently mapped vertex ring" : "orphaned vertex buffers");
+                printedMode = true;
+            }
+            printf("%-15s %4u polygons: %7.1f us on 1 thread, %7.1f us on %u   %.2fx   (%llu ring waits)\n",
+                   better ? "better polygons" : "plain polygons", count, single.AvgUS, threaded.AvgUS,
+                   threaded.Threads, threaded.AvgUS > 0 ? single.AvgUS / threaded.AvgUS : 0.0,
+                   (unsigned long long)(single.RingWaits + threaded.RingWaits));
+
+            if (single.Frames != (u64)frames || threaded.Frames != (u64)frames)
+            {
+                fprintf(stderr, "FAIL: %u %s polygons: frames rendered without building polygons\n",
+                        count, better ? "better" : "plain");
+                failures++;
+            }
+            if (single.Image != threaded.Image)
+            {
+                fprintf(stderr, "FAIL: %u %s polygons drew differently when built on several threads\n",
+                        count, better ? "better" : "plain");
+                failures++;
+            }
+            bool drawn = false;
+            for (size_t i = 0; i < single.Image.size() && !drawn; i += 4)
+                drawn = single.Image[i] || single.Image[i + 1] || single.Image[i + 2];
+            if (!drawn)
+            {
+                fprintf(stderr, "FAIL: %u %s polygons drew nothing\n", count, better ? "better" : "plain");
+                failures++;
+            }
+        }
+    }
+
+    if (glGetError() != GL_NO_ERROR)
+    {
+        fprintf(stderr, "FAIL: OpenGL error\n");
+        failures++;
+    }
+    return failures ? 1 : 0;
+}
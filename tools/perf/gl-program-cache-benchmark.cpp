@@ -0,0 +1,196 @@
+/*
+    Cold and warm startup of the OpenGL renderers with the program binary
+    cache (OpenGL::LoadShaderCache/SaveShaderCache).
+
+    For the classic and the compute renderer, times getting from
+    SetRenderer() to the last ShaderCompileStep() on a surfaceless EGL
+    context (Mesa llvmpipe works), first with no cache file and then with
+    the one the cold run wrote. Each run is a separate process with an
+    empty Mesa shader cache directory of its own, so the warm run only
+    gains what this cache gives (Mesa doesn't offer program binaries with
+    its cache turned off). Fails if the warm run still compiles anything
+    from source.
+
+    usage: melonprime_gl_program_cache_bench [scratch directory]
+*/
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+#include "NDS.h"
+#include "GPU_OpenGL.h"
+#include "OpenGLSupport.h"
+#include "../testing/headless/TestROM.h"
+
+using namespace melonDS;
+
+namespace
+{
+
+bool CreateContext()
+{
+    EGLDisplay display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    if (display == EGL_NO_DISPLAY || !eglInitialize(display, nullptr, nullptr))
+        return false;
+    if (!eglBindAPI(EGL_OPENGL_API))
+        return false;
+
+    const EGLint configAttribs[] = {
+        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_NONE
+    };
+    EGLConfig config;
+    EGLint numConfigs = 0;
+    if (!eglChooseConfig(display, configAttribs, &config, 1, &numConfigs) || numConfigs < 1)
+        return false;
+
+    const EGLint contextAttribs[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 4,
+        EGL_CONTEXT_MINOR_VERSION, 3,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE
+    };
+    EGLContext context = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttribs);
+    if (context == EGL_NO_CONTEXT)
+        return false;
+    if (!eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context))
+        return false;
+
+    return gladLoadGLLoader(reinterpret_cast<GLADloadproc>(eglGetProcAddress)) != 0;
+}
+
+struct RunResult
+{
+    bool OK = false;
+    double Ms = 0;
+    OpenGL::ShaderCacheStats Stats;
+};
+
+RunResult StartRenderer(bool compute)
+{
+    RunResult result;
+
+    std::vector<u8> rom = TestROM::Build();
+    auto nds = TestROM::Boot(rom);
+    if (!nds)
+        return result;
+
+    auto start = std::chrono::steady_clock::now();
+    nds->SetRenderer(std::make_unique<GLRenderer>(*nds, compute));
+    auto* renderer = dynamic_cast<GLRenderer*>(&nds->GetRenderer());
+    if (!renderer)
+        return result;
+
+    RendererSettings settings {};
+    settings.ScaleFactor = 1;
+    settings.HiresCoordinates = true;
+    renderer->SetRenderSettings(settings);
+
+    int current = 0, count = 0;
+    while (renderer->NeedsShaderCompile())
+        renderer->ShaderCompileStep(current, count);
+    glFinish();
+    result.Ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    OpenGL::SaveShaderCache();
+    result.Stats = OpenGL::GetShaderCacheStats();
+
+    for (int i = 0; i < 3; i++)
+        nds->RunFrame();
+    result.OK = glGetError() == GL_NO_ERROR;
+    return result;
+}
+
+// runs in a child process, so every run gets a fresh context and driver
+RunResult RunInChild(bool compute, bool cold, const std::filesystem::path& dir)
+{
+    RunResult result;
+    if (cold)
+        std::filesystem::remove(dir / "shadercache");
+
+    int fds[2];
+    if (pipe(fds) != 0)
+        return result;
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+        close(fds[0]);
+        std::filesystem::path mesaCache = dir / ("mesa-cache-" + std::to_string(getpid()));
+        std::filesystem::remove_all(mesaCache);
+        setenv("MESA_SHADER_CACHE_DIR", mesaCache.c_str(), 1);
+
+        RunResult child;
+        if (CreateContext())
+            child = StartRenderer(compute);
+        else
+            fprintf(stderr, "could not create an OpenGL 4.3 context through EGL\n");
+        if (cold && !compute && child.OK)
+            printf("%s, %s\n", glGetString(GL_RENDERER), glGetString(GL_VERSION));
+        std::filesystem::remove_all(mesaCache);
+        fflush(stdout);
+
+        bool written = write(fds[1], &child, sizeof(child)) == sizeof(child);
+        close(fds[1]);
+        _exit(written ? 0 : 1);
+    }
+    close(fds[1]);
+    if (pid > 0)
+    {
+        if (read(fds[0], &result, sizeof(result)) != sizeof(result))
+            result = {};
+        waitpid(pid, nullptr, 0);
+    }
+    close(fds[0]);
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    setenv("EGL_PLATFORM", "surfaceless", 0);
+
+    std::filesystem::path dir = argc > 1 ? std::filesystem::path(argv[1])
+                                         : std::filesystem::temp_directory_path() / "melonprime-gl-cache-bench";
+    std::filesystem::create_directories(dir);
+    dir = std::filesystem::absolute(dir);
+    std::filesystem::current_path(dir);
+
+    int failures = 0;
+    for (bool compute : {false, true})
+    {
+        const char* name = compute ? "compute" : "classic";
+        fflush(stdout);
+        RunResult cold = RunInChild(compute, true, dir);
+        RunResult warm = RunInChild(compute, false, dir);
+
+        printf("%-8s cold %8.1f ms (%u compiled)   warm %8.1f ms (%u restored, %u compiled, %u rejected)   %.1fx\n",
+               name, cold.Ms, cold.Stats.Compiled, warm.Ms, warm.Stats.Restored, warm.Stats.Compiled,
+               warm.Stats.Rejected, warm.Ms > 0 ? cold.Ms / warm.Ms : 0.0);
+
+        if (!cold.OK || !warm.OK)
+        {
+            fprintf(stderr, "FAIL: %s renderer didn't start cleanly\n", name);
+            failures++;
+        }
+        else if (warm.Stats.Restored == 0 || warm.Stats.Compiled != 0)
+        {
+            fprintf(stderr, "FAIL: %s renderer compiled programs on the warm start\n", name);
+            failures++;
+        }
+    }
+
+    std::filesystem::remove(dir / "shadercache");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,178 @@
+/*
+    Headless JIT benchmark comparing normal and huge page backing for the
+    fastmem arena and JIT code memory (JITArgs::HugePages).
+
+    Runs the synthetic test ROM (tools/testing/headless/TestROM.h) with the
+    JIT and fastmem, once per mode, and reports frames per second together
+    with dTLB/iTLB load misses read through perf_event_open. The counters
+    need perf_event_paranoid <= 2 (or CAP_PERFMON); without them the timing
+    is still printed. /proc/self/smaps_rollup tells whether huge pages were
+    actually handed out.
+
+    usage: melonprime_jit_hugepage_bench [frames] [rounds]
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "NDS.h"
+#include "Platform.h"
+#include "../testing/headless/TestROM.h"
+
+using namespace melonDS;
+
+namespace
+{
+
+class TLBCounter
+{
+public:
+    explicit TLBCounter(u64 cache)
+    {
+        perf_event_attr attr {};
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.size = sizeof(attr);
+        attr.config = cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        FD = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+    }
+    ~TLBCounter() { if (FD >= 0) close(FD); }
+
+    bool Valid() const { return FD >= 0; }
+    void Start()
+    {
+        if (FD < 0) return;
+        ioctl(FD, PERF_EVENT_IOC_RESET, 0);
+        ioctl(FD, PERF_EVENT_IOC_ENABLE, 0);
+    }
+    u64 Stop()
+    {
+        if (FD < 0) return 0;
+        ioctl(FD, PERF_EVENT_IOC_DISABLE, 0);
+        u64 count = 0;
+        if (read(FD, &count, sizeof(count)) != sizeof(count))
+            return 0;
+        return count;
+    }
+
+private:
+    int FD = -1;
+};
+
+// kB of anonymous + shmem memory currently mapped with huge pages
+u64 HugePageKB()
+{
+    FILE* f = fopen("/proc/self/smaps_rollup", "r");
+    if (!f) return 0;
+
+    u64 total = 0;
+    char line[256];
+    while (fgets(line, sizeof(line), f))
+    {
+        unsigned long long kb;
+        if (sscanf(line, "AnonHugePages: %llu kB", &kb) == 1 ||
+            sscanf(line, "ShmemPmdMapped: %llu kB", &kb) == 1)
+            total += kb;
+    }
+    fclose(f);
+    return total;
+}
+
+struct Result
+{
+    double FPS = 0;
+    u64 DTLBMisses = 0;
+    u64 ITLBMisses = 0;
+    u64 HugeKB = 0;
+    bool ArenaHuge = false;
+};
+
+bool RunMode(const std::vector<u8>& rom, bool hugepages, int frames, Result& out)
+{
+    JITArgs jit;
+    jit.FastMemory = true;
+    jit.HugePages = hugepages;
+
+    auto nds = TestROM::Boot(rom, jit);
+    if (!nds)
+        return false;
+
+    // warm up: compile the blocks and fault in the memory
+    for (int i = 0; i < 30; i++)
+        nds->RunFrame();
+
+    TLBCounter dtlb(PERF_COUNT_HW_CACHE_DTLB);
+    TLBCounter itlb(PERF_COUNT_HW_CACHE_ITLB);
+
+    u32 keys = 0xFFF;
+    dtlb.Start();
+    itlb.Start();
+    u64 start = Platform::GetUSCount();
+    for (int i = 0; i < frames; i++)
+    {
+        keys = 0xFFF & ~(1u << (i % 12));
+        nds->SetKeyMask(keys);
+        nds->RunFrame();
+    }
+    u64 elapsed = Platform::GetUSCount() - start;
+    out.ITLBMisses = itlb.Stop();
+    out.DTLBMisses = dtlb.Stop();
+
+    out.FPS = elapsed ? (frames * 1000000.0) / elapsed : 0;
+    out.HugeKB = HugePageKB();
+    out.ArenaHuge = nds->JIT.Memory.UsingHugePages();
+
+    if (!dtlb.Valid() || !itlb.Valid())
+        out.DTLBMisses = out.ITLBMisses = ~0ull;
+    return true;
+}
+
+std::string FormatCount(u64 count, int frames)
+{
+    if (count == ~0ull) return "n/a";
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.0f", (double)count / frames);
+    return buf;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    int frames = (argc > 1) ? atoi(argv[1]) : 600;
+    int rounds = (argc > 2) ? atoi(argv[2]) : 3;
+    if (frames < 1 || rounds < 1)
+    {
+        fprintf(stderr, "usage: %s [frames] [rounds]\n", argv[0]);
+        return 2;
+    }
+
+    std::vector<u8> rom = TestROM::Build();
+
+    printf("%-6s %5s %10s %14s %14s %10s %s\n", "mode", "round", "fps", "dTLB miss/fr", "iTLB miss/fr", "huge kB", "arena");
+    for (int r = 0; r < rounds; r++)
+    {
+        for (int mode = 0; mode < 2; mode++)
+        {
+            Result res;
+            if (!RunMode(rom, mode == 1, frames, res))
+            {
+                fprintf(stderr, "could not boot the test ROM\n");
+                return 1;
+            }
+            printf("%-6s %5d %10.1f %14s %14s %10llu %s\n", mode ? "huge" : "normal", r, res.FPS,
+                   FormatCount(res.DTLBMisses, frames).c_str(), FormatCount(res.ITLBMisses, frames).c_str(),
+                   (unsigned long long)res.HugeKB, res.ArenaHuge ? "huge" : "normal");
+        }
+    }
+    return 0;
+}
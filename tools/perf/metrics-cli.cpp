@@ -0,0 +1,88 @@
+/*
+    Prints the live MELONPRIME_METRICS histograms of a running melonDS.
+
+    Maps the metrics page read-only and, every interval, prints each
+    histogram's percentiles over the last interval and since the emulator
+    started recording. It never writes to the page, so any number of these
+    can watch the same run.
+
+    usage: melonprime_metrics <metrics file> [interval seconds] [count]
+      count 0 (the default) runs until interrupted; count 1 prints the
+      totals once and exits
+*/
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+#include "MelonPrimeMetrics.h"
+
+using namespace melonDS;
+using namespace melonDS::MelonPrimeMetrics;
+
+namespace
+{
+
+void PrintLine(const char* name, const char* unit, bool total, const Snapshot& snap)
+{
+    const char* scope = total ? "total" : "interval";
+    if (!snap.Count)
+    {
+        // frame time and latencies only come from MELONPRIME_DS frontend
+        // builds, see MelonPrimeMetrics.h
+        printf("%-18s %-8s %8s  no samples%s\n", name, scope, "0",
+               total ? " (not recorded by every build)" : "");
+        return;
+    }
+    printf("%-18s %-8s %8llu  mean %9.1f  p50 %8llu  p90 %8llu  p99 %8llu  p99.9 %8llu  max %8llu %s\n",
+           name, scope, (unsigned long long)snap.Count, snap.Mean(),
+           (unsigned long long)snap.ValueAtPercentile(50), (unsigned long long)snap.ValueAtPercentile(90),
+           (unsigned long long)snap.ValueAtPercentile(99), (unsigned long long)snap.ValueAtPercentile(99.9),
+           (unsigned long long)snap.Max, unit);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        fprintf(stderr, "usage: %s <metrics file> [interval seconds] [count]\n", argv[0]);
+        return 1;
+    }
+    const double interval = argc > 2 ? atof(argv[2]) : 1.0;
+    const int count = argc > 3 ? atoi(argv[3]) : 0;
+
+    Reader reader;
+    if (!reader.Open(argv[1]))
+    {
+        fprintf(stderr, "%s isn't a metrics page (is melonDS running with MELONPRIME_METRICS=%s?)\n",
+                argv[1], argv[1]);
+        return 1;
+    }
+    printf("metrics of process %llu\n", (unsigned long long)reader.GetPage().ProcessID);
+
+    Snapshot last[(u32)Metric::Count];
+    for (u32 i = 0; i < (u32)Metric::Count; i++)
+        last[i] = reader.Read((Metric)i);
+
+    for (int round = 1; count == 0 || round <= count; round++)
+    {
+        if (count != 1)
+            std::this_thread::sleep_for(std::chrono::duration<double>(interval > 0 ? interval : 1.0));
+
+        for (u32 i = 0; i < (u32)Metric::Count; i++)
+        {
+            const Histogram& hist = reader.GetPage().Histograms[i];
+            const Snapshot now = reader.Read((Metric)i);
+            if (count != 1)
+                PrintLine(hist.Name, hist.Unit, false, now.Since(last[i]));
+            PrintLine(hist.Name, hist.Unit, true, now);
+            last[i] = now;
+        }
+        printf("\n");
+        fflush(stdout);
+    }
+    return 0;
+}
@@ -0,0 +1,295 @@
+/*
+    Extracted-ROM cache checks.
+
+    Writes a zip with two ROM-sized entries and drives ArchiveCache over it:
+
+    - the listing is scanned once, then read back from the cache directory
+      by a fresh cache object;
+    - the first fetch of an entry extracts it on the worker thread with
+      progress reported, and the copy matches the entry byte for byte;
+    - a second fetch, also from a fresh cache object, doesn't extract, and
+      neither does a lookup;
+    - touching the archive makes its cached copies stale;
+    - the size limit evicts the least recently used copy, and an archive's
+      listing goes with the last copy extracted from it;
+    - a cache directory that can't be written is tried once per entry,
+      later fetches fail straight away;
+    - a missing entry fails without leaving temporary files behind.
+
+    Prints how long the extraction took against a cached fetch.
+
+    usage: melonprime_archive_cache_tests [scratch directory]
+*/
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <archive.h>
+#include <archive_entry.h>
+
+#include "frontend/qt_sdl/ArchiveCache.h"
+
+using namespace melonDS;
+namespace fs = std::filesystem;
+
+namespace
+{
+
+int Failures = 0;
+
+void Expect(bool cond, const char* what)
+{
+    if (!cond)
+    {
+        fprintf(stderr, "FAIL: %s\n", what);
+        Failures++;
+    }
+}
+
+double MsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// compressible, but not trivially so
+std::vector<u8> MakeROM(u32 size, u32 seed)
+{
+    std::vector<u8> data(size);
+    u32 x = seed * 0x9E3779B1u + 1;
+    for (u32 i = 0; i < size; i++)
+    {
+        if ((i & 0xFFF) == 0)
+            x = x * 1664525u + 1013904223u;
+        data[i] = (u8)((x >> 24) + (i & 0x3F));
+    }
+    return data;
+}
+
+bool WriteZip(const std::string& path, const std::vector<std::pair<std::string, const std::vector<u8>*>>& files)
+{
+    archive* a = archive_write_new();
+    archive_write_set_format_zip(a);
+    if (archive_write_open_filename(a, path.c_str()) != ARCHIVE_OK)
+    {
+        archive_write_free(a);
+        return false;
+    }
+    bool ok = true;
+    for (const auto& [name, data] : files)
+    {
+        archive_entry* entry = archive_entry_new();
+        archive_entry_set_pathname(entry, name.c_str());
+        archive_entry_set_size(entry, data->size());
+        archive_entry_set_filetype(entry, AE_IFREG);
+        archive_entry_set_perm(entry, 0644);
+        ok = ok && archive_write_header(a, entry) == ARCHIVE_OK;
+        ok = ok && archive_write_data(a, data->data(), data->size()) == (la_ssize_t)data->size();
+        archive_entry_free(entry);
+    }
+    ok = archive_write_close(a) == ARCHIVE_OK && ok;
+    archive_write_free(a);
+    return ok;
+}
+
+bool SameContents(const std::string& path, const std::vector<u8>& expected)
+{
+    std::error_code ec;
+    if (path.empty() || fs::file_size(path, ec) != expected.size())
+        return false;
+    std::vector<u8> data(expected.size());
+    FILE* f = fopen(path.c_str(), "rb");
+    if (!f) return false;
+    bool ok = fread(data.data(), 1, data.size(), f) == data.size();
+    fclose(f);
+    return ok && data == expected;
+}
+
+int CountFiles(const fs::path& dir, const char* extension)
+{
+    int count = 0;
+    std::error_code ec;
+    for (const fs::directory_entry& e : fs::directory_iterator(dir, ec))
+    {
+        if (e.path().extension() == extension)
+            count++;
+    }
+    return count;
+}
+
+bool HasTempFiles(const fs::path& dir)
+{
+    std::error_code ec;
+    for (const fs::directory_entry& e : fs::directory_iterator(dir, ec))
+    {
+        if (e.path().extension() == ".tmp")
+            return true;
+    }
+    return false;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    fs::path dir = argc > 1 ? fs::path(argv[1]) : fs::temp_directory_path();
+    fs::path cacheDir = dir / "melonprime-archive-cache-test";
+    std::string zipPath = (dir / "melonprime-archive-cache-test.zip").string();
+    std::error_code ec;
+    fs::remove_all(cacheDir, ec);
+
+    const std::vector<u8> romA = MakeROM(32 * 1024 * 1024, 1);
+    const std::vector<u8> romB = MakeROM(8 * 1024 * 1024, 2);
+    if (!WriteZip(zipPath, {{"games/Metroid Prime Hunters.nds", &romA}, {"b.nds", &romB}}))
+    {
+        fprintf(stderr, "FAIL: could not write %s\n", zipPath.c_str());
+        return 1;
+    }
+    const std::string entryA = "games/Metroid Prime Hunters.nds";
+    const u64 limit = 48 * 1024 * 1024;
+
+    // listing
+    {
+        ArchiveCache cache(cacheDir.string(), limit);
+        std::vector<ArchiveCache::Entry> entries;
+        Expect(cache.List(zipPath, entries), "listing the archive");
+        Expect(entries.size() == 2 && entries[0].Name == "b.nds" && entries[1].Name == entryA,
+               "listed names, sorted");
+        Expect(entries.size() == 2 && entries[0].Size == romB.size() && entries[1].Size == romA.size(),
+               "listed sizes");
+        Expect(cache.List(zipPath, entries) && cache.GetStats().ListHits == 1, "listing not kept in memory");
+    }
+    {
+        ArchiveCache cache(cacheDir.string(), limit);
+        std::vector<ArchiveCache::Entry> entries;
+        Expect(cache.List(zipPath, entries) && entries.size() == 2, "listing read back");
+        Expect(cache.GetStats().ListHits == 1, "listing not read from the cache directory");
+    }
+
+    // extraction, then cached fetches
+    double extractMs, cachedMs;
+    {
+        ArchiveCache cache(cacheDir.string(), limit);
+        Expect(!cache.Contains(zipPath, entryA), "entry cached before extraction");
+        Expect(cache.Lookup(zipPath, entryA).empty() && cache.GetStats().Misses == 0,
+               "lookup extracted the entry");
+
+        u64 lastDone = 0, lastTotal = 0;
+        int calls = 0;
+        auto start = std::chrono::steady_clock::now();
+        std::string path = cache.Fetch(zipPath, entryA, [&](u64 done, u64 total)
+        {
+            Expect(done >= lastDone, "progress went backwards");
+            lastDone = done;
+            lastTotal = total;
+            calls++;
+            return true;
+        });
+        extractMs = MsSince(start);
+        Expect(!path.empty(), "extraction failed");
+        Expect(SameContents(path, romA), "extracted copy differs from the entry");
+        Expect(calls >= 1 && lastDone == romA.size() && lastTotal == romA.size(), "final progress");
+        Expect(cache.Contains(zipPath, entryA), "entry not cached after extraction");
+        Expect(cache.GetStats().Misses == 1 && cache.GetStats().BytesExtracted == romA.size(), "extraction stats");
+    }
+    {
+        ArchiveCache cache(cacheDir.string(), limit);
+        bool called = false;
+        auto start = std::chrono::steady_clock::now();
+        std::string path = cache.Fetch(zipPath, entryA, [&](u64, u64) { called = true; return true; });
+        cachedMs = MsSince(start);
+        Expect(SameContents(path, romA), "cached copy differs from the entry");
+        Expect(!called, "cached fetch reported progress");
+        Expect(cache.GetStats().Hits == 1 && cache.GetStats().Misses == 0, "cached fetch extracted again");
+        Expect(cache.Lookup(zipPath, entryA) == path && cache.GetStats().Hits == 2, "lookup of a cached copy");
+    }
+
+    // a touched archive doesn't reuse the old copies
+    {
+        Expect(CountFiles(cacheDir, ".list") == 1, "listing not stored");
+        fs::last_write_time(zipPath, fs::last_write_time(zipPath) + std::chrono::seconds(10));
+
+        // room for A or for B, not both
+        const u64 smallLimit = 36 * 1024 * 1024;
+        ArchiveCache cache(cacheDir.string(), smallLimit);
+        Expect(!cache.Contains(zipPath, entryA), "stale copy used after the archive changed");
+        std::string pathA = cache.Fetch(zipPath, entryA);
+        Expect(SameContents(pathA, romA), "re-extracted copy");
+        Expect(fs::exists(pathA), "copy just extracted was evicted");
+
+        // the stale copy went to make room for the new one, and A goes to
+        // make room for B
+        Expect(CountFiles(cacheDir, ".list") == 0, "stale listing kept after its copies were evicted");
+        std::vector<ArchiveCache::Entry> entries;
+        Expect(cache.List(zipPath, entries) && CountFiles(cacheDir, ".list") == 1, "listing not stored");
+
+        std::string pathB = cache.Fetch(zipPath, "b.nds");
+        Expect(SameContents(pathB, romB), "second entry");
+        Expect(!fs::exists(pathA), "least recently used copy kept over the limit");
+        Expect(CountFiles(cacheDir, ".list") == 1, "listing evicted while a copy from the archive is left");
+
+        u64 total = 0;
+        for (const fs::directory_entry& e : fs::directory_iterator(cacheDir))
+            total += e.file_size();
+        Expect(total <= smallLimit, "cache over its size limit");
+    }
+
+    // evicting B, the last copy, takes the listing with it even though the
+    // listing is newer and would fit on its own
+    {
+        u64 listSize = 0;
+        for (const fs::directory_entry& e : fs::directory_iterator(cacheDir))
+        {
+            if (e.path().extension() == ".list")
+            {
+                listSize = e.file_size();
+                fs::last_write_time(e.path(), fs::file_time_type::clock::now() + std::chrono::seconds(60));
+            }
+        }
+        ArchiveCache cache(cacheDir.string(), listSize + 1);
+        cache.Trim();
+        Expect(CountFiles(cacheDir, ".bin") == 0, "last copy kept over the limit");
+        Expect(CountFiles(cacheDir, ".list") == 0, "listing kept without any of its copies");
+    }
+
+    // a cache that can't store anything: its directory would have to be
+    // created inside the zip file
+    {
+        ArchiveCache cache(zipPath + "/cache", limit);
+        int calls = 0;
+        auto progress = [&](u64, u64) { calls++; return true; };
+        Expect(cache.Fetch(zipPath, entryA, progress).empty(), "fetch into an unwritable cache");
+        Expect(cache.StoreFailed(zipPath, entryA) && cache.GetStats().StoreFailures == 1,
+               "failed store not recorded");
+        Expect(!cache.StoreFailed(zipPath, "b.nds"), "failure recorded for another entry");
+        calls = 0;
+        Expect(cache.Fetch(zipPath, entryA, progress).empty(), "second fetch into an unwritable cache");
+        Expect(calls == 0 && cache.GetStats().StoreFailures == 1, "entry extracted again after a failed store");
+        Expect(cache.Lookup(zipPath, entryA).empty(), "lookup after a failed store");
+    }
+
+    {
+        ArchiveCache cache(cacheDir.string(), limit);
+        Expect(cache.Fetch(zipPath, "missing.nds").empty(), "missing entry fetched");
+        Expect(cache.Fetch((dir / "melonprime-no-such-archive.zip").string(), entryA).empty(),
+               "missing archive fetched");
+        Expect(!HasTempFiles(cacheDir), "temporary files left behind");
+    }
+
+    printf("extracted %u MiB in %.1f ms, cached fetch %.3f ms\n",
+           (unsigned)(romA.size() >> 20), extractMs, cachedMs);
+
+    fs::remove_all(cacheDir, ec);
+    fs::remove(zipPath, ec);
+
+    if (Failures)
+    {
+        fprintf(stderr, "%d check(s) failed\n", Failures);
+        return 1;
+    }
+    printf("all archive cache checks passed\n");
+    return 0;
+}
@@ -0,0 +1,268 @@
+/*
+    GDB stub checks with the JIT enabled.
+
+    Boots the test ROM with the JIT and a GDB stub on the ARM9, connects to
+    it as a GDB client would, and checks that
+    - a breakpoint in the middle of the ARM9 loop stops there, with the PC
+      on it, although the loop was already compiled into a block;
+    - a write watchpoint on main RAM (fastmem) and a read watchpoint on
+      KEYINPUT (an I/O register the JIT reads directly) both stop with the
+      right address;
+    - the target keeps running after detaching.
+
+    Prints the frame rate with the JIT alone, with the JIT and a stub with
+    a breakpoint the guest never reaches, and with the interpreter and a
+    stub.
+
+    usage: melonprime_gdb_jit_tests [port]
+*/
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+
+#include "NDS.h"
+#include "headless/TestROM.h"
+
+using namespace melonDS;
+
+namespace
+{
+
+int Failures = 0;
+
+void Expect(bool cond, const char* what)
+{
+    if (!cond)
+    {
+        fprintf(stderr, "FAIL: %s\n", what);
+        Failures++;
+    }
+}
+
+// the client side of the remote protocol, just what the checks need
+class Client
+{
+public:
+    ~Client()
+    {
+        if (Fd >= 0)
+            close(Fd);
+    }
+
+    bool Connect(u16 port)
+    {
+        Fd = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in addr {};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(port);
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        if (Fd < 0 || connect(Fd, (sockaddr*)&addr, sizeof(addr)) != 0)
+            return false;
+
+        // the stub takes the connection on its next poll, then wants an ack
+        timeval timeout {10, 0};
+        setsockopt(Fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        return SendRaw("+") && ReadChar() == '+';
+    }
+
+    // sends a command and returns the reply, "!" if there wasn't one
+    std::string Command(const std::string& cmd)
+    {
+        return Send(cmd) ? Reply() : "!";
+    }
+
+    // sends a command answered later, like the stop reply of a continue
+    bool Send(const std::string& cmd)
+    {
+        char trailer[4];
+        snprintf(trailer, sizeof(trailer), "#%02x", Checksum(cmd));
+        return SendRaw("$" + cmd + trailer) && ReadChar() == '+';
+    }
+
+    std::string Reply()
+    {
+        int c;
+        while ((c = ReadChar()) != '$')
+        {
+            if (c < 0)
+                return "!";
+        }
+        std::string data;
+        while ((c = ReadChar()) != '#')
+        {
+            if (c < 0)
+                return "!";
+            data += (char)c;
+        }
+        ReadChar();
+        ReadChar();
+        SendRaw("+");
+        return data;
+    }
+
+private:
+    int Fd = -1;
+
+    static u8 Checksum(const std::string& data)
+    {
+        u8 sum = 0;
+        for (char c : data)
+            sum += (u8)c;
+        return sum;
+    }
+
+    bool SendRaw(const std::string& data)
+    {
+        return send(Fd, data.data(), data.size(), 0) == (ssize_t)data.size();
+    }
+
+    int ReadChar()
+    {
+        u8 c;
+        return recv(Fd, &c, 1, 0) == 1 ? c : -1;
+    }
+};
+
+// the PC as 'p f' returns it, little endian hex
+std::string PCReply(u32 pc)
+{
+    char buf[9];
+    snprintf(buf, sizeof(buf), "%02x%02x%02x%02x", pc & 0xFF, (pc >> 8) & 0xFF, (pc >> 16) & 0xFF, pc >> 24);
+    return buf;
+}
+
+bool SameHex(const std::string& a, const std::string& b)
+{
+    if (a.size() != b.size())
+        return false;
+    for (size_t i = 0; i < a.size(); i++)
+    {
+        if (tolower(a[i]) != tolower(b[i]))
+            return false;
+    }
+    return true;
+}
+
+void CheckSession(NDS& nds, u16 port)
+{
+    std::atomic<bool> running = true;
+    std::atomic<u32> frames = 0;
+    std::thread emulation([&]
+    {
+        while (running)
+        {
+            nds.RunFrame();
+            frames++;
+        }
+    });
+
+    {
+        Client client;
+        Expect(client.Connect(port), "couldn't connect to the stub");
+
+        // let the loop run (and get compiled) before breaking into it
+        Expect(client.Command("Z0,2000808,4") == "OK", "breakpoint not set");
+        Expect(client.Send("c"), "continue not acked");
+        const std::string stop = client.Reply();
+        Expect(stop == "S05", "no stop at the breakpoint");
+        Expect(SameHex(client.Command("pf"), PCReply(TestROM::kLoopAddress + 8)), "wrong PC at the breakpoint");
+
+        // hit it a second time, now that the loop around it is compiled
+        Expect(client.Send("c") && client.Reply() == "S05", "no second stop at the breakpoint");
+        Expect(SameHex(client.Command("pf"), PCReply(TestROM::kLoopAddress + 8)), "wrong PC at the second stop");
+        Expect(client.Command("z0,2000808,4") == "OK", "breakpoint not removed");
+
+        Expect(client.Command("Z2,2100000,4") == "OK", "write watchpoint not set");
+        Expect(client.Send("c"), "continue not acked");
+        const std::string watch = client.Reply();
+        Expect(SameHex(watch, "T05watch:02100000;"), "no stop at the write watchpoint");
+        Expect(client.Command("z2,2100000,4") == "OK", "write watchpoint not removed");
+
+        Expect(client.Command("Z3,4000130,2") == "OK", "read watchpoint not set");
+        Expect(client.Send("c"), "continue not acked");
+        const std::string rwatch = client.Reply();
+        Expect(SameHex(rwatch, "T05rwatch:04000130;"), "no stop at the read watchpoint");
+        Expect(client.Command("z3,4000130,2") == "OK", "read watchpoint not removed");
+
+        printf("stops: %s, %s, %s\n", stop.c_str(), watch.c_str(), rwatch.c_str());
+        Expect(client.Command("D") == "OK", "detach failed");
+    }
+
+    // it runs on by itself after detaching
+    const u32 before = frames;
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    Expect(frames != before, "stopped after detaching");
+
+    running = false;
+    emulation.join();
+}
+
+double FramesPerSecond(const std::vector<u8>& rom, std::optional<JITArgs> jit, std::optional<GDBArgs> gdb)
+{
+    auto nds = TestROM::Boot(rom, jit, gdb);
+    if (!nds)
+        return 0;
+    if (gdb)
+    {
+        // a breakpoint the guest never reaches still shortens blocks around it
+        nds->ARM9.GdbStub.AddBkpt(TestROM::kLoopAddress + 0x100, 4);
+    }
+    for (int i = 0; i < 10; i++)
+        nds->RunFrame();
+
+    constexpr int Frames = 300;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < Frames; i++)
+        nds->RunFrame();
+    return Frames / std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const u16 port = argc > 1 ? (u16)atoi(argv[1]) : (u16)(40000 + getpid() % 10000 * 2);
+    std::vector<u8> rom = TestROM::Build();
+
+    GDBArgs gdb;
+    gdb.PortARM9 = port;
+    gdb.PortARM7 = port + 1;
+    auto nds = TestROM::Boot(rom, JITArgs{}, gdb);
+    if (!nds)
+    {
+        fprintf(stderr, "FAIL: could not boot the test ROM\n");
+        return 1;
+    }
+    for (int i = 0; i < 5; i++)
+        nds->RunFrame();
+    CheckSession(*nds, port);
+    nds.reset();
+
+    GDBArgs idle;
+    idle.PortARM9 = port + 2;
+    idle.PortARM7 = port + 3;
+    const double jitFps = FramesPerSecond(rom, JITArgs{}, std::nullopt);
+    const double jitGdbFps = FramesPerSecond(rom, JITArgs{}, idle);
+    idle.PortARM9 = port + 4;
+    idle.PortARM7 = port + 5;
+    const double interpGdbFps = FramesPerSecond(rom, std::nullopt, idle);
+    printf("JIT %.0f fps, JIT with GDB stub %.0f fps, interpreter with GDB stub %.0f fps\n",
+           jitFps, jitGdbFps, interpGdbFps);
+
+    if (Failures)
+    {
+        fprintf(stderr, "%d check(s) failed\n", Failures);
+        return 1;
+    }
+    printf("all GDB JIT checks passed\n");
+    return 0;
+}
@@ -0,0 +1,251 @@
+/*
+    OpenGL display capture readback checks.
+
+    Captures a VRAM bank filled with a known pattern into another bank
+    (256x192, 256x128 wrapping around the end of the bank, and 128x128),
+    then reads the destination bank from the ARM9 the next frame, as a game
+    would. Runs on a surfaceless EGL context (Mesa llvmpipe works) at 1x and
+    2x internal resolution:
+
+    - the syncs are served from the readback issued at VBlank, never read
+      back on the spot;
+    - the bank read that way is the same as the one read back on the spot
+      (forced by dropping the readbacks with PostSavestate());
+    - it covers the same blocks as what the software renderer produces,
+      including around a wrapping capture, with colors within one step
+      (the OpenGL capture pass doesn't round like the software one).
+
+    Prints the average time the ARM9 read that triggers a sync took, both
+    ways.
+
+    usage: melonprime_gl_capture_readback_tests
+*/
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+#include "NDS.h"
+#include "GPU_OpenGL.h"
+#include "headless/TestROM.h"
+
+using namespace melonDS;
+
+namespace
+{
+
+int Failures = 0;
+
+void Expect(bool cond, const char* what)
+{
+    if (!cond)
+    {
+        fprintf(stderr, "FAIL: %s\n", what);
+        Failures++;
+    }
+}
+
+bool CreateContext()
+{
+    EGLDisplay display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    if (display == EGL_NO_DISPLAY || !eglInitialize(display, nullptr, nullptr))
+        return false;
+    if (!eglBindAPI(EGL_OPENGL_API))
+        return false;
+
+    const EGLint configAttribs[] = {
+        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_NONE
+    };
+    EGLConfig config;
+    EGLint numConfigs = 0;
+    if (!eglChooseConfig(display, configAttribs, &config, 1, &numConfigs) || numConfigs < 1)
+        return false;
+
+    const EGLint contextAttribs[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 3,
+        EGL_CONTEXT_MINOR_VERSION, 2,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE
+    };
+    EGLContext context = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttribs);
+    if (context == EGL_NO_CONTEXT)
+        return false;
+    if (!eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context))
+        return false;
+
+    return gladLoadGLLoader(reinterpret_cast<GLADloadproc>(eglGetProcAddress)) != 0;
+}
+
+struct Capture
+{
+    const char* Name;
+    u32 Size;       // DISPCAPCNT capture size
+    u32 Offset;     // DISPCAPCNT write offset
+};
+
+const Capture Captures[] = {
+    {"256x192", 3, 0},
+    {"256x128 wrapping", 2, 3},
+    {"128x128", 0, 2},
+};
+
+u16 Pattern(u32 i)
+{
+    return (u16)(((i * 37) ^ (i >> 7) * 11) & 0x7FFF) | 0x8000;
+}
+
+// [read back on the spot, served from the readback]
+double SyncMs[2] = {};
+int Syncs[2] = {};
+
+// bank A as the ARM9 sees it the frame after the capture
+std::vector<u16> RunCapture(NDS& nds, const Capture& cap, bool dropReadbacks = false)
+{
+    nds.ARM9Write8(0x04000240, 0x80);   // bank A: LCDC
+    nds.ARM9Write8(0x04000241, 0x80);   // bank B: LCDC
+
+    for (u32 i = 0; i < 0x10000; i++)
+    {
+        nds.ARM9Write16(0x06800000 + i * 2, 0x1234);
+        nds.ARM9Write16(0x06820000 + i * 2, Pattern(i));
+    }
+
+    // normal display mode, capture source B reads bank B
+    nds.ARM9Write32(0x04000000, 0x00010000 | (1 << 18));
+    // source B only, into bank A
+    nds.ARM9Write32(0x04000064, (1u << 31) | (1 << 29) | (cap.Size << 20) | (cap.Offset << 18));
+
+    nds.RunFrame();
+    nds.RunFrame();
+    if (dropReadbacks)
+        nds.GetRenderer().PostSavestate();
+
+    std::vector<u16> bank(0x10000);
+    // the first read of a capture block syncs the whole capture
+    auto start = std::chrono::steady_clock::now();
+    bank[cap.Offset * 0x4000] = nds.ARM9Read16(0x06800000 + cap.Offset * 0x8000);
+    SyncMs[!dropReadbacks] += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    Syncs[!dropReadbacks]++;
+
+    for (u32 i = 0; i < 0x10000; i++)
+        bank[i] = nds.ARM9Read16(0x06800000 + i * 2);
+    return bank;
+}
+
+bool Close(u16 a, u16 b)
+{
+    if (a == 0x1234 || b == 0x1234)
+        return a == b;
+    for (int shift : {0, 5, 10})
+    {
+        int diff = (int)((a >> shift) & 0x1F) - (int)((b >> shift) & 0x1F);
+        if (diff < -1 || diff > 1)
+            return false;
+    }
+    return (a & 0x8000) == (b & 0x8000);
+}
+
+} // namespace
+
+int main()
+{
+    setenv("EGL_PLATFORM", "surfaceless", 0);
+
+    std::vector<u8> rom = TestROM::Build();
+
+    std::vector<std::vector<u16>> expected;
+    {
+        auto nds = TestROM::Boot(rom);
+        if (!nds)
+        {
+            fprintf(stderr, "FAIL: could not boot the test ROM\n");
+            return 1;
+        }
+        for (const Capture& cap : Captures)
+            expected.push_back(RunCapture(*nds, cap));
+    }
+    SyncMs[0] = SyncMs[1] = 0;
+    Syncs[0] = Syncs[1] = 0;
+
+    if (!CreateContext())
+    {
+        fprintf(stderr, "FAIL: could not create an OpenGL context through EGL\n");
+        return 1;
+    }
+
+    for (int scale : {1, 2})
+    {
+        auto nds = TestROM::Boot(rom);
+        nds->SetRenderer(std::make_unique<GLRenderer>(*nds, false));
+        auto* renderer = dynamic_cast<GLRenderer*>(&nds->GetRenderer());
+        if (!renderer)
+        {
+            fprintf(stderr, "FAIL: OpenGL renderer didn't start\n");
+            return 1;
+        }
+
+        RendererSettings settings {};
+        settings.ScaleFactor = scale;
+        renderer->SetRenderSettings(settings);
+        int current = 0, count = 0;
+        while (renderer->NeedsShaderCompile())
+            renderer->ShaderCompileStep(current, count);
+
+        for (size_t i = 0; i < std::size(Captures); i++)
+        {
+            const char* name = Captures[i].Name;
+
+            // PostSavestate() also resets the counters
+            std::vector<u16> direct = RunCapture(*nds, Captures[i], true);
+            Expect(renderer->GetCaptureReadbackStats().Synchronous == 1, "dropped readback still used");
+
+            std::vector<u16> bank = RunCapture(*nds, Captures[i]);
+            const CaptureReadbackStats& stats = renderer->GetCaptureReadbackStats();
+            printf("%dx %-16s  %llu readback(s) issued, syncs: %llu pre-resolved, %llu waited, %llu synchronous\n",
+                   scale, name, (unsigned long long)stats.Issued, (unsigned long long)stats.PreResolved,
+                   (unsigned long long)stats.Waited, (unsigned long long)stats.Synchronous);
+            Expect(stats.Issued >= 1, "capture wasn't read back at VBlank");
+            Expect(stats.PreResolved + stats.Waited == 1, "sync not served from the readback");
+            Expect(stats.Synchronous == 1, "second sync read back on the spot");
+
+            u32 first = 0;
+            while (first < bank.size() && bank[first] == direct[first])
+                first++;
+            if (first < bank.size())
+            {
+                fprintf(stderr, "FAIL: %dx %s capture: readback differs from a direct one at 0x%05X (0x%04X, expected 0x%04X)\n",
+                        scale, name, first * 2, bank[first], direct[first]);
+                Failures++;
+            }
+
+            first = 0;
+            while (first < bank.size() && Close(bank[first], expected[i][first]))
+                first++;
+            if (first < bank.size())
+            {
+                fprintf(stderr, "FAIL: %dx %s capture: differs from the software renderer at 0x%05X (0x%04X, expected 0x%04X)\n",
+                        scale, name, first * 2, bank[first], expected[i][first]);
+                Failures++;
+            }
+        }
+        Expect(glGetError() == GL_NO_ERROR, "OpenGL error");
+    }
+
+    printf("sync on first read: %.3f ms read back on the spot, %.3f ms from the readback (average)\n",
+           SyncMs[0] / Syncs[0], SyncMs[1] / Syncs[1]);
+
+    if (Failures)
+    {
+        fprintf(stderr, "%d check(s) failed\n", Failures);
+        return 1;
+    }
+    printf("all OpenGL capture readback checks passed\n");
+    return 0;
+}
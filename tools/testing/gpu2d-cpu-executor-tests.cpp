@@ -0,0 +1,380 @@
+/*
+    Deferred 2D (GPU2DNative::CpuExecutor) against the software renderer.
+
+    Runs the same scenes on two consoles, one drawing its 2D lines during the
+    frame as usual and one rendering them at VBlank from the native recorder,
+    and requires both screens and the display capture banks to match exactly:
+
+    - text BGs with 4bpp and 8bpp tiles, an HBlank DMA changing the scroll
+      every line, windows and alpha blending;
+    - rotscale and bitmap BGs, extended palettes and mosaic;
+    - normal and rotscale sprites, including semi-transparent ones;
+    - the 3D layer (clear color only) under the 2D BGs, with master
+      brightness and the screens swapped;
+    - display captures, source A and A+B, displayed the next frame and,
+      with a write offset, later in the same frame. Frames that capture are
+      drawn inline so the capture reaches VRAM line by line; these scenes
+      check that they aren't deferred;
+    - VRAM display and screens turned off.
+
+    Every scene runs with the executor on 1 and on 4 threads. Prints the
+    average time the executor took per frame, and the whole frame on both
+    consoles, so the deferred path can be compared against drawing inline.
+
+    usage: melonprime_gpu2d_cpu_executor_tests
+*/
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "NDS.h"
+#include "GPU.h"
+#include "GPU_Soft.h"
+#include "headless/TestROM.h"
+
+using namespace melonDS;
+
+namespace
+{
+
+int Failures = 0;
+
+void Expect(bool cond, const char* what)
+{
+    if (!cond)
+    {
+        fprintf(stderr, "FAIL: %s\n", what);
+        Failures++;
+    }
+}
+
+u32 Pattern(u32 seed, u32 i)
+{
+    u32 x = (i * 0x9E3779B1u) ^ (seed * 0x85EBCA6Bu);
+    x ^= x >> 15;
+    return x * 0x2C1B3C6Du;
+}
+
+void Fill(NDS& nds, u32 addr, u32 size, u32 seed)
+{
+    for (u32 i = 0; i < size; i += 4)
+        nds.ARM9Write32(addr + i, Pattern(seed, i));
+}
+
+// banks A/B: engine A BG, E: engine A OBJ, C: engine B BG, D: engine B OBJ,
+// F/G: engine A BG/OBJ extended palettes, H/I: engine B ones
+void SetupMemory(NDS& nds)
+{
+    nds.ARM9Write32(0x04000304, 0x020F);
+
+    // extended palettes are only reachable through LCDC
+    for (u32 cnt : {0x04000245u, 0x04000246u, 0x04000248u, 0x04000249u})
+        nds.ARM9Write8(cnt, 0x80);
+    Fill(nds, 0x06890000, 0x4000, 10);
+    Fill(nds, 0x06894000, 0x4000, 11);
+    Fill(nds, 0x06898000, 0x8000, 12);
+    Fill(nds, 0x068A0000, 0x4000, 13);
+
+    nds.ARM9Write8(0x04000240, 0x81);
+    nds.ARM9Write8(0x04000241, 0x89);
+    nds.ARM9Write8(0x04000242, 0x84);
+    nds.ARM9Write8(0x04000243, 0x84);
+    nds.ARM9Write8(0x04000244, 0x82);
+    nds.ARM9Write8(0x04000245, 0x84);
+    nds.ARM9Write8(0x04000246, 0x85);
+    nds.ARM9Write8(0x04000248, 0x82);
+    nds.ARM9Write8(0x04000249, 0x83);
+
+    Fill(nds, 0x06000000, 0x40000, 1);
+    Fill(nds, 0x06400000, 0x10000, 2);
+    Fill(nds, 0x06200000, 0x20000, 3);
+    Fill(nds, 0x06600000, 0x20000, 4);
+    Fill(nds, 0x05000000, 0x800, 5);
+
+    // sprites: on screen, mixed sizes, some rotscale, some semi-transparent
+    for (u32 base : {0x07000000u, 0x07000400u})
+    {
+        for (u32 i = 0; i < 128; i++)
+        {
+            u32 p = Pattern(20 + base, i);
+            u16 attr0 = (u16)(((i * 23) & 0xFF) | ((p >> 8) & 0x3000) | ((i % 3) << 14));
+            if (i % 7 == 0) attr0 |= 0x0100;
+            if (i % 11 == 0) attr0 |= 0x0400;
+            u16 attr1 = (u16)(((i * 41) & 0x1FF) | ((p >> 16) & 0xF000));
+            u16 attr2 = (u16)((p & 0x3FF) | ((i & 3) << 10) | ((p >> 12) & 0xF000));
+            nds.ARM9Write16(base + i * 8, attr0);
+            nds.ARM9Write16(base + i * 8 + 2, attr1);
+            nds.ARM9Write16(base + i * 8 + 4, attr2);
+            nds.ARM9Write16(base + i * 8 + 6, (u16)(p >> 7));
+        }
+    }
+}
+
+void SetupEngine(NDS& nds, u32 io, u32 dispcnt, u32 scene)
+{
+    nds.ARM9Write32(io, dispcnt);
+    for (u32 bg = 0; bg < 4; bg++)
+    {
+        u16 cnt = (u16)(bg | (bg * 4 << 8) | (bg << 2) | ((scene + bg) & 1 ? 0x80 : 0) | ((bg & 2) ? 0x4000 : 0));
+        if (scene == 2 && bg >= 2)
+            cnt = (u16)(bg | (bg == 3 ? 0x84 : 0x80) | (6 << 8) | 0x2000);
+        if (scene == 1)
+            cnt |= 0x40;
+        nds.ARM9Write16(io + 0x08 + bg * 2, cnt);
+        nds.ARM9Write16(io + 0x10 + bg * 4, (u16)(bg * 37));
+        nds.ARM9Write16(io + 0x12 + bg * 4, (u16)(bg * 11));
+    }
+    for (u32 set = 0; set < 2; set++)
+    {
+        u32 a = io + 0x20 + set * 0x10;
+        nds.ARM9Write16(a + 0, 0x00F0);
+        nds.ARM9Write16(a + 2, (u16)(0x0030 + set * 8));
+        nds.ARM9Write16(a + 4, (u16)-0x0020);
+        nds.ARM9Write16(a + 6, 0x0110);
+        nds.ARM9Write32(a + 8, 0x00001800);
+        nds.ARM9Write32(a + 12, (u32)-0x00000A00);
+    }
+    nds.ARM9Write16(io + 0x40, 0x2090);
+    nds.ARM9Write16(io + 0x42, 0x60F0);
+    nds.ARM9Write16(io + 0x44, 0x1870);
+    nds.ARM9Write16(io + 0x46, 0x40B0);
+    nds.ARM9Write16(io + 0x48, 0x1F2B);
+    nds.ARM9Write16(io + 0x4A, 0x3D17);
+    nds.ARM9Write16(io + 0x4C, scene == 1 ? 0x3232 : 0);
+    nds.ARM9Write16(io + 0x50, (u16)(0x0F41 | (scene == 3 ? 0x80 : 0)));
+    nds.ARM9Write16(io + 0x52, 0x0A06);
+    nds.ARM9Write16(io + 0x54, 7);
+}
+
+struct Scene
+{
+    const char* Name;
+    u32 DispCntA, DispCntB;
+    u32 Setup;          // selects the BG settings in SetupEngine()
+    u32 CaptureCnt;     // DISPCAPCNT, written every frame
+    bool Swap;
+    bool ScrollDMA;
+    u16 Bright;
+};
+
+// DISPCNT: mode, BG0 3D, OBJ 1D mapping, layers, windows, display mode,
+// VRAM block, char/screen base, extended palettes
+const Scene Scenes[] = {
+    {"text", 0x00011F10 | 0xE000, 0x00011F10, 0, 0, false, true, 0},
+    {"text mosaic", 0x00011F10 | 0x2000 | (1 << 27) | (2 << 24) | (1 << 30), 0x40011F10, 1, 0, true, false, 0},
+    {"affine", 0x00011F12, 0x00011F11, 0, 0, false, true, 0x4008},
+    {"bitmap", 0x00011F15, 0x40011F15, 2, 0, true, false, 0x800A},
+    {"3D", 0x00011F18 | 0x4000, 0x00011F13, 3, 0, true, false, 0},
+    {"capture A", 0x00011F10, 0x00011F10, 0, (1u << 31) | (2 << 16) | (3 << 20) | 0, false, false, 0},
+    {"capture A+B", 0x00011F18, 0x00011F12, 0, (1u << 31) | (2 << 29) | (3 << 16) | (3 << 20) | 0x0A06, false, false, 0},
+    {"vram display", 0x00021F10 | (2 << 18), 0x00011F10, 0, 0, true, false, 0x4004},
+    {"capture under vram display", 0x00021F10 | (3 << 18), 0x00011F10, 0,
+        (1u << 31) | (3 << 16) | (2 << 20) | (1 << 18) | (3 << 29) | 0x0808, false, false, 0},
+    {"screens off", 0x00011F10, 0x00011F10, 0, 0, false, false, 0},
+};
+
+struct Console
+{
+    std::unique_ptr<NDS> Nds;
+    SoftRenderer* Renderer = nullptr;
+};
+
+Console Boot(const std::vector<u8>& rom, bool deferred, int threads)
+{
+    Console console;
+    console.Nds = TestROM::Boot(rom);
+    if (!console.Nds)
+        return console;
+    console.Renderer = dynamic_cast<SoftRenderer*>(&console.Nds->GetRenderer());
+    if (!console.Renderer)
+        return console;
+
+    RendererSettings settings {};
+    settings.Threaded = true;
+    settings.Deferred2D = deferred;
+    console.Renderer->SetRenderSettings(settings);
+    console.Renderer->SetDeferred2DThreads(threads);
+    return console;
+}
+
+void SetupScene(NDS& nds, const Scene& scene)
+{
+    SetupMemory(nds);
+    if (scene.CaptureCnt)
+    {
+        // capture destinations: C and D go to LCDC, engine B takes H for its BG
+        nds.ARM9Write8(0x04000242, 0x80);
+        nds.ARM9Write8(0x04000243, 0x80);
+        nds.ARM9Write8(0x04000248, 0x81);
+    }
+    if (((scene.DispCntA >> 16) & 0x3) == 2)
+    {
+        // VRAM display reads from LCDC
+        nds.ARM9Write8(0x04000240 + ((scene.DispCntA >> 18) & 3), 0x80);
+    }
+
+    SetupEngine(nds, 0x04000000, scene.DispCntA, scene.Setup);
+    SetupEngine(nds, 0x04001000, scene.DispCntB, scene.Setup ^ 1);
+    nds.ARM9Write16(0x0400006C, scene.Bright);
+    nds.ARM9Write16(0x0400106C, (u16)(scene.Bright ? scene.Bright ^ 0xC000 : 0));
+
+    // 3D: no polygons, a clear color with some alpha
+    nds.ARM9Write16(0x04000060, 0x0008);
+    nds.ARM9Write32(0x04000350, 0x1F107C1F);
+    nds.ARM9Write16(0x04000354, 0x7FFF);
+
+    u32 pow = 0x020F | (scene.Swap ? 0x8000 : 0);
+    if (!strcmp(scene.Name, "screens off"))
+        pow &= ~1u;
+    nds.ARM9Write32(0x04000304, pow);
+
+    if (scene.ScrollDMA)
+    {
+        for (u32 i = 0; i < 2048; i++)
+            nds.ARM9Write16(0x02200000 + i * 2, (u16)((i * 3) ^ (i >> 2)));
+        nds.ARM9Write32(0x040000B0, 0x02200000);
+        nds.ARM9Write32(0x040000B4, 0x04000010);
+        // one halfword every HBlank, destination fixed, repeat
+        nds.ARM9Write32(0x040000B8, 1 | (2 << 21) | (1 << 25) | (2 << 27) | (1u << 31));
+    }
+}
+
+bool ScreensMatch(Console& a, Console& b, char* where, size_t len)
+{
+    void* top[2];
+    void* bottom[2];
+    a.Nds->GPU.GetFramebuffers(&top[0], &bottom[0]);
+    b.Nds->GPU.GetFramebuffers(&top[1], &bottom[1]);
+    for (int screen = 0; screen < 2; screen++)
+    {
+        const u32* fa = (const u32*)(screen ? bottom[0] : top[0]);
+        const u32* fb = (const u32*)(screen ? bottom[1] : top[1]);
+        for (u32 i = 0; i < 256 * 192; i++)
+        {
+            if (fa[i] != fb[i])
+            {
+                snprintf(where, len, "%s screen differs at %u,%u (0x%08X, expected 0x%08X)",
+                         screen ? "bottom" : "top", i % 256, i / 256, fb[i], fa[i]);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool BanksMatch(Console& a, Console& b, char* where, size_t len)
+{
+    for (u32 bank = 0; bank < 4; bank++)
+    {
+        const u8* va = a.Nds->GPU.VRAM[bank];
+        const u8* vb = b.Nds->GPU.VRAM[bank];
+        for (u32 i = 0; i < 0x20000; i += 2)
+        {
+            if (memcmp(&va[i], &vb[i], 2))
+            {
+                snprintf(where, len, "bank %c differs at 0x%05X", 'A' + bank, i);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+struct Timing
+{
+    double ExecutorMs = 0;
+    double InlineFrameMs = 0;
+    double DeferredFrameMs = 0;
+    int Scenes = 0;
+};
+
+double RunFrameMs(NDS& nds)
+{
+    const auto start = std::chrono::steady_clock::now();
+    nds.RunFrame();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void RunScene(const std::vector<u8>& rom, const Scene& scene, int threads, Timing& timing)
+{
+    Console reference = Boot(rom, false, 0);
+    Console deferred = Boot(rom, true, threads);
+    if (!reference.Renderer || !deferred.Renderer)
+    {
+        Expect(false, "could not boot the test ROM on the software renderer");
+        return;
+    }
+
+    SetupScene(*reference.Nds, scene);
+    SetupScene(*deferred.Nds, scene);
+
+    char what[256], where[160];
+    double inlineMs = 0, deferredMs = 0;
+    const int frames = 4;
+    for (int frame = 0; frame < frames; frame++)
+    {
+        if (scene.CaptureCnt)
+        {
+            reference.Nds->ARM9Write32(0x04000064, scene.CaptureCnt);
+            deferred.Nds->ARM9Write32(0x04000064, scene.CaptureCnt);
+        }
+        inlineMs += RunFrameMs(*reference.Nds);
+        deferredMs += RunFrameMs(*deferred.Nds);
+
+        if (!ScreensMatch(reference, deferred, where, sizeof(where)))
+        {
+            snprintf(what, sizeof(what), "%s, %d thread(s), frame %d: %s", scene.Name, threads, frame, where);
+            Expect(false, what);
+            break;
+        }
+        if (!BanksMatch(reference, deferred, where, sizeof(where)))
+        {
+            snprintf(what, sizeof(what), "%s, %d thread(s), frame %d: %s", scene.Name, threads, frame, where);
+            Expect(false, what);
+            break;
+        }
+    }
+
+    const GPU2DNative::CpuExecutorStats& stats = deferred.Renderer->GetDeferred2DStats();
+    if (scene.CaptureCnt)
+    {
+        snprintf(what, sizeof(what), "%s, %d thread(s): frames with a display capture were deferred", scene.Name, threads);
+        Expect(stats.Frames == 0 && stats.CaptureLines == 0, what);
+        return;
+    }
+    snprintf(what, sizeof(what), "%s, %d thread(s): frames weren't rendered at VBlank", scene.Name, threads);
+    Expect(stats.Frames >= 3, what);
+    timing.ExecutorMs += stats.Frames ? (double)stats.TotalNs / stats.Frames / 1e6 : 0;
+    timing.InlineFrameMs += inlineMs / frames;
+    timing.DeferredFrameMs += deferredMs / frames;
+    timing.Scenes++;
+}
+
+} // namespace
+
+int main()
+{
+    std::vector<u8> rom = TestROM::Build();
+
+    for (int threads : {1, 4})
+    {
+        Timing timing;
+        for (const Scene& scene : Scenes)
+            RunScene(rom, scene, threads, timing);
+        const int n = timing.Scenes ? timing.Scenes : 1;
+        printf("%d thread(s): %.3f ms per frame in the executor; whole frame %.3f ms deferred, "
+               "%.3f ms inline (average over %d scenes without a capture)\n",
+               threads, timing.ExecutorMs / n, timing.DeferredFrameMs / n, timing.InlineFrameMs / n, timing.Scenes);
+    }
+
+    if (Failures)
+    {
+        fprintf(stderr, "%d check(s) failed\n", Failures);
+        return 1;
+    }
+    printf("all deferred 2D checks passed\n");
+    return 0;
+}
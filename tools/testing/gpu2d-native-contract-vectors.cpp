@@ -1,6 +1,7 @@
 /*
     GPU-independent contract vectors for the native Vulkan/DX12 GPU2D input
-    ABI and exact logical-pixel comparator.
+    ABI and exact logical-pixel comparator, and for the CPU executor that
+    renders the same input.
 */
 
 #include <array>
@@ -10,6 +11,7 @@
 #include <vector>
 
 #include "GPU2DNative.h"
+#include "GPU2DNativeCPU.h"
 
 namespace
 {
@@ -1720,6 +1722,74 @@ bool RunCaptureFeedbackVectors()
     return passed;
 }
 
+bool RunCpuExecutorVectors()
+{
+    bool passed = true;
+
+    // Engine A shows a red backdrop on the bottom screen and captures it into
+    // bank B; engine B's blue backdrop goes to the top screen, brightened to
+    // white on its lower half.
+    auto input = std::make_unique<FrameInput>();
+    input->Palette[0] = 0x1F;
+    input->Palette[0x400 + 1] = 0x7C;
+    for (u32 line = 0u; line < ScreenHeight; ++line)
+    {
+        for (u32 engine = 0u; engine < 2u; ++engine)
+        {
+            LineState& state = input->Lines[engine * ScreenHeight + line];
+            state.DispCnt = 0x00010000u;
+            state.UnitEnabled = 1u;
+            state.ScreensEnabled = 1u;
+            state.LCDVRAMMap = 0x2u;
+            if (engine == 1u && line >= ScreenHeight / 2u)
+                state.MasterBrightness = 0x4000u | 16u;
+        }
+        LineState& stateA = input->Lines[line];
+        stateA.CaptureEnable = 1u;
+        stateA.CaptureCnt = (1u << 31u) | (1u << 16u);
+        input->ScreenSource[line] = 1u;
+        input->ScreenSource[ScreenHeight + line] = 0u;
+    }
+
+    std::vector<u32> frames[2];
+    for (const int threads : {1, 4})
+    {
+        CpuExecutor executor;
+        executor.SetThreadCount(threads);
+        std::vector<u32> screens(2u * ScreenPixelCount);
+        executor.Execute(*input, nullptr, screens.data(), screens.data() + ScreenPixelCount);
+
+        bool routed = true;
+        for (u32 line = 0u; line < ScreenHeight; ++line)
+        {
+            const u32 top = line < ScreenHeight / 2u ? 0x3E0000u : 0x3F3F3Fu;
+            routed &= screens[line * ScreenWidth] == top
+                && screens[line * ScreenWidth + 255u] == top
+                && screens[ScreenPixelCount + line * ScreenWidth + 128u] == 0x3Eu;
+        }
+        passed &= Require(routed, "CPU executor routed or brightened the engines wrongly");
+
+        const std::vector<CpuCaptureWrite>& writes = executor.GetCaptureWrites();
+        passed &= Require(
+            writes.size() == 128u && writes[1].Bank == 1u
+                && writes[1].Offset == 256u && writes[1].Length == 256u,
+            "CPU executor capture did not cover 128 lines of 128 pixels");
+        const u8* bank = executor.GetLCDCBank(1u);
+        passed &= Require(
+            bank[0] == 0x1Fu && bank[1] == 0x80u
+                && bank[127u * 256u + 254u] == 0x1Fu && bank[128u * 256u] == 0u,
+            "CPU executor capture wrote the wrong pixels");
+        passed &= Require(
+            executor.GetStats().Frames == 1u && executor.GetStats().CaptureLines == 128u,
+            "CPU executor stats did not count the frame");
+        frames[threads == 1 ? 0 : 1] = std::move(screens);
+    }
+    passed &= Require(
+        frames[0] == frames[1],
+        "CPU executor output depends on the thread count");
+    return passed;
+}
+
 } // namespace
 
 int main()
@@ -1733,7 +1803,8 @@ int main()
         && RunUploadPlanVectors() && RunTemporalLineVectors()
         && RunFrameIdentityVectors() && RunCaptureOwnershipVectors()
         && RunCaptureFeedbackVectors()
-        && RunHighResCaptureProvenanceVectors();
+        && RunHighResCaptureProvenanceVectors()
+        && RunCpuExecutorVectors();
     std::fprintf(stderr, "%s: GPU2D native contract vectors\n", passed ? "PASS" : "FAIL");
     return passed ? 0 : 1;
 }
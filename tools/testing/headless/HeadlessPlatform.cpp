@@ -0,0 +1,340 @@
+/*
+    Copyright 2016-2026 melonDS team
+
+    This file is part of melonDS.
+    melonDS is free software: you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the Free
+    Software Foundation, either version 3 of the License, or (at your option)
+    any later version.
+*/
+
+// Minimal Platform implementation for headless tools that link core and run
+// real NDS instances (no Qt, no SDL, no audio/video output). Files map onto
+// stdio, threading onto the standard library; MP/network/camera/mic are inert.
+// Log output goes to stderr at Warn and above unless MELONDS_HEADLESS_LOG=1.
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+
+#include <sys/stat.h>
+
+#include "Platform.h"
+#include "SPI_Firmware.h"
+
+namespace melonDS::Platform
+{
+
+void SignalStop(StopReason, void*)
+{
+}
+
+std::string GetLocalFilePath(const std::string& filename)
+{
+    return filename;
+}
+
+static std::FILE* AsFile(FileHandle* file)
+{
+    return reinterpret_cast<std::FILE*>(file);
+}
+
+FileHandle* OpenFile(const std::string& path, FileMode mode)
+{
+    if ((mode & (FileMode::ReadWrite | FileMode::Append)) == FileMode::None)
+        return nullptr;
+
+    if ((mode & FileMode::Write) && (mode & FileMode::NoCreate) && !FileExists(path))
+        return nullptr;
+
+    const char* fmode;
+    if (mode & FileMode::Append)
+        fmode = (mode & FileMode::Read) ? "a+" : "a";
+    else if ((mode & FileMode::ReadWrite) == FileMode::ReadWrite)
+        fmode = (mode & FileMode::Preserve) ? "r+" : "w+";
+    else if (mode & FileMode::Write)
+        fmode = (mode & FileMode::Preserve) ? "r+" : "w";
+    else
+        fmode = "r";
+
+    std::string m = fmode;
+    if (!(mode & FileMode::Text))
+        m += "b";
+
+    return reinterpret_cast<FileHandle*>(std::fopen(path.c_str(), m.c_str()));
+}
+
+FileHandle* OpenLocalFile(const std::string& path, FileMode mode)
+{
+    return OpenFile(path, mode);
+}
+
+bool FileExists(const std::string& name)
+{
+    struct stat st;
+    return stat(name.c_str(), &st) == 0;
+}
+
+bool LocalFileExists(const std::string& name)
+{
+    return FileExists(name);
+}
+
+bool CheckFileWritable(const std::string& filepath)
+{
+    FileHandle* file = OpenFile(filepath, FileMode::Append);
+    if (!file) return false;
+    CloseFile(file);
+    return true;
+}
+
+bool CheckLocalFileWritable(const std::string& filepath)
+{
+    return CheckFileWritable(filepath);
+}
+
+bool CloseFile(FileHandle* file)
+{
+    return std::fclose(AsFile(file)) == 0;
+}
+
+bool IsEndOfFile(FileHandle* file)
+{
+    return std::feof(AsFile(file)) != 0;
+}
+
+bool FileReadLine(char* str, int count, FileHandle* file)
+{
+    return std::fgets(str, count, AsFile(file)) != nullptr;
+}
+
+u64 FilePosition(FileHandle* file)
+{
+    return (u64)std::ftell(AsFile(file));
+}
+
+bool FileSeek(FileHandle* file, s64 offset, FileSeekOrigin origin)
+{
+    int stdorigin = SEEK_SET;
+    if (origin == FileSeekOrigin::Current) stdorigin = SEEK_CUR;
+    else if (origin == FileSeekOrigin::End) stdorigin = SEEK_END;
+    return std::fseek(AsFile(file), (long)offset, stdorigin) == 0;
+}
+
+void FileRewind(FileHandle* file)
+{
+    std::rewind(AsFile(file));
+}
+
+u64 FileRead(void* data, u64 size, u64 count, FileHandle* file)
+{
+    return std::fread(data, size, count, AsFile(file));
+}
+
+bool FileFlush(FileHandle* file)
+{
+    return std::fflush(AsFile(file)) == 0;
+}
+
+u64 FileWrite(const void* data, u64 size, u64 count, FileHandle* file)
+{
+    return std::fwrite(data, size, count, AsFile(file));
+}
+
+u64 FileWriteFormatted(FileHandle* file, const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    int ret = std::vfprintf(AsFile(file), fmt, args);
+    va_end(args);
+    return ret < 0 ? 0 : (u64)ret;
+}
+
+u64 FileLength(FileHandle* file)
+{
+    std::FILE* f = AsFile(file);
+    long pos = std::ftell(f);
+    std::fseek(f, 0, SEEK_END);
+    long len = std::ftell(f);
+    std::fseek(f, pos, SEEK_SET);
+    return (u64)len;
+}
+
+void Log(LogLevel level, const char* fmt, ...)
+{
+    static const bool verbose = [] {
+        const char* v = std::getenv("MELONDS_HEADLESS_LOG");
+        return v && v[0] == '1';
+    }();
+    if (level < LogLevel::Warn && !verbose)
+        return;
+
+    va_list args;
+    va_start(args, fmt);
+    std::vfprintf(stderr, fmt, args);
+    va_end(args);
+}
+
+struct Thread
+{
+    std::thread Impl;
+};
+
+Thread* Thread_Create(std::function<void()> func)
+{
+    return new Thread{std::thread(std::move(func))};
+}
+
+void Thread_Free(Thread* thread)
+{
+    if (thread->Impl.joinable())
+        thread->Impl.detach();
+    delete thread;
+}
+
+void Thread_Wait(Thread* thread)
+{
+    if (thread->Impl.joinable())
+        thread->Impl.join();
+}
+
+struct Semaphore
+{
+    std::mutex Lock;
+    std::condition_variable Cond;
+    int Count = 0;
+};
+
+Semaphore* Semaphore_Create()
+{
+    return new Semaphore;
+}
+
+void Semaphore_Free(Semaphore* sema)
+{
+    delete sema;
+}
+
+void Semaphore_Reset(Semaphore* sema)
+{
+    std::lock_guard<std::mutex> lock(sema->Lock);
+    sema->Count = 0;
+}
+
+void Semaphore_Wait(Semaphore* sema)
+{
+    std::unique_lock<std::mutex> lock(sema->Lock);
+    sema->Cond.wait(lock, [sema] { return sema->Count > 0; });
+    sema->Count--;
+}
+
+bool Semaphore_TryWait(Semaphore* sema, int timeout_ms)
+{
+    std::unique_lock<std::mutex> lock(sema->Lock);
+    if (!sema->Cond.wait_for(lock, std::chrono::milliseconds(timeout_ms), [sema] { return sema->Count > 0; }))
+        return false;
+    sema->Count--;
+    return true;
+}
+
+void Semaphore_Post(Semaphore* sema, int count)
+{
+    {
+        std::lock_guard<std::mutex> lock(sema->Lock);
+        sema->Count += count;
+    }
+    sema->Cond.notify_all();
+}
+
+struct Mutex
+{
+    std::mutex Impl;
+};
+
+Mutex* Mutex_Create()
+{
+    return new Mutex;
+}
+
+void Mutex_Free(Mutex* mutex)
+{
+    delete mutex;
+}
+
+void Mutex_Lock(Mutex* mutex)
+{
+    mutex->Impl.lock();
+}
+
+void Mutex_Unlock(Mutex* mutex)
+{
+    mutex->Impl.unlock();
+}
+
+bool Mutex_TryLock(Mutex* mutex)
+{
+    return mutex->Impl.try_lock();
+}
+
+void Sleep(u64 usecs)
+{
+    std::this_thread::sleep_for(std::chrono::microseconds(usecs));
+}
+
+u64 GetMSCount()
+{
+    using namespace std::chrono;
+    return (u64)duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+u64 GetUSCount()
+{
+    using namespace std::chrono;
+    return (u64)duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+void WriteNDSSave(const u8*, u32, u32, u32, void*) {}
+void WriteGBASave(const u8*, u32, u32, u32, void*) {}
+void WriteFirmware(const Firmware&, u32, u32, void*) {}
+void WriteDateTime(int, int, int, int, int, int, void*) {}
+
+void MP_Begin(void*) {}
+void MP_End(void*) {}
+int MP_SendPacket(u8*, int len, u64, void*) { return len; }
+int MP_RecvPacket(u8*, u64*, void*) { return 0; }
+int MP_SendCmd(u8*, int len, u64, void*) { return len; }
+int MP_SendReply(u8*, int len, u64, u16, void*) { return len; }
+int MP_SendAck(u8*, int len, u64, void*) { return len; }
+int MP_RecvHostPacket(u8*, u64*, void*) { return 0; }
+u16 MP_RecvReplies(u8*, u64, u16, void*) { return 0; }
+
+int Net_SendPacket(u8*, int len, void*) { return len; }
+int Net_RecvPacket(u8*, void*) { return 0; }
+
+void Camera_Start(int, void*) {}
+void Camera_Stop(int, void*) {}
+void Camera_CaptureFrame(int, u32*, int, int, bool, void*) {}
+
+void Mic_Start(void*) {}
+void Mic_Stop(void*) {}
+int Mic_ReadInput(s16*, int, void*) { return 0; }
+
+AACDecoder* AAC_Init() { return nullptr; }
+void AAC_DeInit(AACDecoder*) {}
+bool AAC_Configure(AACDecoder*, int, int) { return false; }
+bool AAC_DecodeFrame(AACDecoder*, const void*, int, void*, int) { return false; }
+
+bool Addon_KeyDown(KeyType, void*) { return false; }
+void Addon_RumbleStart(u32, void*) {}
+void Addon_RumbleStop(void*) {}
+float Addon_MotionQuery(MotionQueryType, void*) { return 0.0f; }
+
+DynamicLibrary* DynamicLibrary_Load(const char*) { return nullptr; }
+void DynamicLibrary_Unload(DynamicLibrary*) {}
+void* DynamicLibrary_LoadFunction(DynamicLibrary*, const char*) { return nullptr; }
+
+} // namespace melonDS::Platform
@@ -0,0 +1,142 @@
+/*
+    Copyright 2016-2026 melonDS team
+
+    This file is part of melonDS.
+    melonDS is free software: you can redistribute it and/or modify it under
+    the terms of the GNU General Public License as published by the Free
+    Software Foundation, either version 3 of the License, or (at your option)
+    any later version.
+*/
+
+// Synthetic ROM for headless tools, and a helper to direct-boot it.
+//
+// The ARM9 loop folds KEYINPUT into r2 every iteration and stores r2 both at
+// 0x02100000 and at a page of 0x02100000..0x021FF000 picked from its bits, so
+// the guest state depends on exactly which input was seen on which frame and
+// main RAM writes are spread over a few hundred pages. The ARM7 just spins.
+//
+// The capture variant also turns on the 3D engine and, once per frame from
+// line 220 on, sets the 3D clear color from r2, swaps the geometry buffers
+// and arms a 256x192 display capture of the 3D layer into VRAM bank A. The
+// capture is armed after line 215, so it copies the 3D frame rendered there
+// into VRAM on the following frame.
+
+#ifndef HEADLESS_TESTROM_H
+#define HEADLESS_TESTROM_H
+
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "NDS.h"
+#include "NDSCart.h"
+#include "NDS_Header.h"
+
+namespace TestROM
+{
+
+constexpr melonDS::u32 kLoopAddress = 0x02000800;
+
+inline std::vector<melonDS::u8> Build(bool capture3D = false)
+{
+    using namespace melonDS;
+
+    std::vector<u8> rom(0x1000, 0);
+    NDSHeader& header = *reinterpret_cast<NDSHeader*>(rom.data());
+
+    memcpy(header.GameTitle, "HEADLESSTEST", 12);
+    memcpy(header.GameCode, "####", 4);
+
+    static const u32 arm9[] = {
+        0xE59F0018, // ldr r0, =0x04000130
+        0xE1D010B0, // ldrh r1, [r0]
+        0xE0822001, // add r2, r2, r1
+        0xE59F3010, // ldr r3, =0x02100000
+        0xE5832000, // str r2, [r3]
+        0xE2024AFF, // and r4, r2, #0xFF000
+        0xE7832004, // str r2, [r3, r4]
+        0xEAFFFFF7, // b loop
+        0x04000130,
+        0x02100000,
+    };
+    static const u32 arm9Capture[] = {
+        0xE3A05301, // mov r5, #0x04000000
+        0xE59F6064, // ldr r6, =0x820F
+        0xE5856304, // str r6, [r5, #0x304]     POWCNT1: both engines, 3D
+        0xE59F6060, // ldr r6, =0x00010108
+        0xE5856000, // str r6, [r5]             DISPCNT: BG0 is 3D
+        0xE3A06080, // mov r6, #0x80
+        0xE5C56240, // strb r6, [r5, #0x240]    VRAMCNT_A: LCDC
+        // loop:
+        0xE59F0054, // ldr r0, =0x04000130
+        0xE1D010B0, // ldrh r1, [r0]
+        0xE0822001, // add r2, r2, r1
+        0xE3A03621, // mov r3, #0x02100000
+        0xE5832000, // str r2, [r3]
+        0xE2024AFF, // and r4, r2, #0xFF000
+        0xE7832004, // str r2, [r3, r4]
+        0xE1D560B6, // ldrh r6, [r5, #6]        VCOUNT
+        0xE35600DC, // cmp r6, #220
+        0xB3A08000, // movlt r8, #0
+        0xBAFFFFF4, // blt loop
+        0xE3580000, // cmp r8, #0
+        0x1AFFFFF2, // bne loop
+        0xE3A08001, // mov r8, #1
+        0xE59F6020, // ldr r6, =0x81300000
+        0xE5856064, // str r6, [r5, #0x64]      DISPCAPCNT
+        0xE382681F, // orr r6, r2, #0x1F0000
+        0xE5856350, // str r6, [r5, #0x350]     CLEAR_COLOR
+        0xE3A06000, // mov r6, #0
+        0xE5856540, // str r6, [r5, #0x540]     SWAP_BUFFERS
+        0xEAFFFFEA, // b loop
+        0x0000820F,
+        0x00010108,
+        0x04000130,
+        0x81300000,
+    };
+    const u32* code = capture3D ? arm9Capture : arm9;
+    const u32 codeSize = capture3D ? sizeof(arm9Capture) : sizeof(arm9);
+    header.ARM9ROMOffset = 0x200;
+    header.ARM9EntryAddress = kLoopAddress;
+    header.ARM9RAMAddress = kLoopAddress;
+    header.ARM9Size = codeSize;
+    memcpy(&rom[0x200], code, codeSize);
+
+    // b .
+    static const u32 arm7[] = { 0xEAFFFFFE };
+    header.ARM7ROMOffset = 0x400;
+    header.ARM7EntryAddress = 0x03800000;
+    header.ARM7RAMAddress = 0x03800000;
+    header.ARM7Size = sizeof(arm7);
+    memcpy(&rom[0x400], arm7, sizeof(arm7));
+
+    header.ROMSize = (u32)rom.size();
+    header.HeaderSize = 0x4000;
+    return rom;
+}
+
+// returns null if the ROM can't be loaded
+inline std::unique_ptr<melonDS::NDS> Boot(const std::vector<melonDS::u8>& rom,
+                                          std::optional<melonDS::JITArgs> jit = std::nullopt,
+                                          std::optional<melonDS::GDBArgs> gdb = std::nullopt)
+{
+    using namespace melonDS;
+
+    NDSArgs args;
+    args.JIT = jit;
+    args.GDB = gdb;
+    auto nds = std::make_unique<NDS>(std::move(args));
+
+    auto cart = NDSCart::ParseROM(rom.data(), (u32)rom.size());
+    if (!cart) return nullptr;
+    nds->SetNDSCart(std::move(cart));
+    nds->Reset();
+    nds->SetupDirectBoot("headless-test.nds");
+    nds->Start();
+    return nds;
+}
+
+}
+
+#endif // HEADLESS_TESTROM_H
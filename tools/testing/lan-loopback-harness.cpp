@@ -0,0 +1,320 @@
+/*
+    Loopback harness for the LAN MP reply policy.
+
+    Runs one host and N clients of the real LAN transport (src/net/LAN.cpp)
+    in one process, talking ENet over 127.0.0.1. The host plays the MP
+    CMD/reply/ACK exchange the DS wifi core drives through
+    LAN::SendCmd/RecvReplies/SendAck; clients answer every CMD as soon as
+    RecvHostPacket hands it over. Everything between the calls -- ENet
+    servicing, reply coalescing, the MELONDS_LAN_IMPAIR delay/jitter/loss and
+    the per-peer reply timeout -- is LAN's own code, so the fixed 25 ms reply
+    timeout can be compared against the adaptive one without DS hardware or a
+    second machine.
+
+    The host listens on the usual LAN ports (7063/7064), so nothing else may
+    be hosting a LAN session on this machine while it runs.
+
+    usage: melonprime_lan_loopback_harness [clients] [frames] [impair-spec]
+    e.g.   melonprime_lan_loopback_harness 3 600 delay=1,jitter=1,loss=5
+
+    Exits non-zero if the adaptive policy stalls the host longer than the
+    fixed timeout, or captures clearly fewer replies.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "net/LAN.h"
+
+using melonDS::LAN;
+using melonDS::LANImpairment;
+using melonDS::LANLinkStats;
+using melonDS::u8;
+using melonDS::u16;
+using melonDS::u32;
+using melonDS::u64;
+
+namespace
+{
+
+constexpr int kCmdsPerFrame = 4;
+
+// CMD timestamps step by more than the 32 RecvReplies tolerates, so a late
+// reply to an earlier CMD is never taken for one to the current CMD
+constexpr u64 kTimestampStep = 1000;
+
+// first payload byte, so clients can tell CMDs from ACKs
+constexpr u8 kPayloadCmd = 'C';
+constexpr u8 kPayloadAck = 'A';
+
+u64 NowUS()
+{
+    using namespace std::chrono;
+    return (u64)duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+void SleepMS(int ms)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+struct Session
+{
+    std::atomic<int> Joined{0};
+    std::atomic<int> Failed{0};
+    std::atomic<bool> Go{false};
+    std::atomic<int> Begun{0};
+    std::atomic<bool> Stop{false};
+};
+
+void ClientThread(Session& session)
+{
+    LAN lan;
+    if (!lan.StartClient("client", "127.0.0.1"))
+    {
+        session.Failed++;
+        return;
+    }
+    session.Joined++;
+
+    // All clients share 127.0.0.1, so the direct connections a client opens
+    // to the other clients on the player list all end up at the host. Hold
+    // off until every client joined: the host is full then and turns them
+    // away instead of taking them for new players.
+    while (!session.Go && !session.Stop)
+        SleepMS(1);
+
+    // the AID a DS client gets is its player ID
+    u16 aid = 0;
+    while (!aid && !session.Stop)
+    {
+        lan.Process();
+        for (const LAN::Player& player : lan.GetPlayerList())
+        {
+            if (player.IsLocalPlayer)
+                aid = (u16)player.ID;
+        }
+        SleepMS(1);
+    }
+
+    lan.Begin(0);
+    session.Begun++;
+
+    u8 buf[2048];
+    while (!session.Stop)
+    {
+        u64 timestamp;
+        int len = lan.RecvHostPacket(0, buf, &timestamp);
+        if (len < 0) break;
+        if (len < 1 || buf[0] != kPayloadCmd) continue;
+
+        u8 reply[2] = {'R', (u8)aid};
+        lan.SendReply(0, reply, sizeof(reply), timestamp, aid);
+    }
+
+    lan.End(0);
+    lan.EndSession();
+}
+
+struct RunResult
+{
+    double StallMean;
+    double StallP99;
+    u64 Expected;
+    u64 Captured;
+    std::vector<LANLinkStats> Stats;
+};
+
+RunResult RunSession(int numclients, int frames, bool adaptive)
+{
+    RunResult res = {};
+
+    LAN host;
+    host.SetAdaptiveReplyTimeout(adaptive);
+    if (!host.StartHost("host", numclients + 1))
+    {
+        fprintf(stderr, "could not host a LAN session (ports in use?)\n");
+        exit(2);
+    }
+
+    Session session;
+    std::vector<std::thread> clients;
+    for (int i = 0; i < numclients; i++)
+        clients.emplace_back(ClientThread, std::ref(session));
+
+    // service the host while the clients join, until all of them sent their
+    // player info and told it they're taking part
+    u64 start = NowUS();
+    while (session.Joined + session.Failed < numclients)
+    {
+        host.Process();
+        SleepMS(1);
+    }
+    if (session.Failed)
+    {
+        fprintf(stderr, "%d clients failed to join\n", session.Failed.load());
+        session.Stop = true;
+        for (auto& t : clients) t.join();
+        exit(2);
+    }
+
+    session.Go = true;
+    host.Begin(0);
+
+    u16 aidmask = 0;
+    for (;;)
+    {
+        host.Process();
+
+        aidmask = 0;
+        for (const LAN::Player& player : host.GetPlayerList())
+        {
+            if (!player.IsLocalPlayer && player.Status == LAN::Player_Client)
+                aidmask |= (1 << player.ID);
+        }
+
+        if (__builtin_popcount(aidmask) == numclients && session.Begun == numclients)
+            break;
+        if (NowUS() - start > 10000000)
+        {
+            fprintf(stderr, "session didn't come up\n");
+            session.Stop = true;
+            for (auto& t : clients) t.join();
+            exit(2);
+        }
+        SleepMS(1);
+    }
+
+    // the Begin() notifications travel on the command channel, make sure
+    // they're in before the first CMD
+    for (u64 t = NowUS(); NowUS() - t < 200000;)
+    {
+        host.Process();
+        SleepMS(1);
+    }
+    printf("session up after %.1f ms\n", (NowUS() - start) / 1000.0);
+
+    std::vector<double> stalls;
+    std::vector<u8> replies(15 * 1024);
+    u64 timestamp = 0;
+    for (int f = 0; f < frames; f++)
+    {
+        double framestall = 0;
+
+        for (int c = 0; c < kCmdsPerFrame; c++)
+        {
+            timestamp += kTimestampStep;
+            u8 cmd[2] = {kPayloadCmd, 0};
+            u64 cmdtime = NowUS();
+            host.SendCmd(0, cmd, sizeof(cmd), timestamp);
+            u16 got = host.RecvReplies(0, replies.data(), timestamp, aidmask);
+            framestall += (double)(NowUS() - cmdtime) / 1000.0;
+
+            for (int i = 1; i < 16; i++)
+            {
+                if (!(aidmask & (1 << i))) continue;
+                res.Expected++;
+                if (got & (1 << i)) res.Captured++;
+            }
+
+            u8 ack[2] = {kPayloadAck, 0};
+            host.SendAck(0, ack, sizeof(ack), timestamp);
+        }
+
+        // once per video frame, as the frontend does
+        host.Process();
+        stalls.push_back(framestall);
+    }
+
+    // Process() refreshes the stats snapshot every 60 calls
+    for (int i = 0; i < 60; i++)
+        host.Process();
+    for (int i = 1; i < 16; i++)
+    {
+        if (aidmask & (1 << i))
+            res.Stats.push_back(host.GetLinkStats(i));
+    }
+
+    session.Stop = true;
+    host.End(0);
+    for (auto& t : clients)
+        t.join();
+    host.EndSession();
+
+    double sum = 0;
+    for (double s : stalls) sum += s;
+    std::sort(stalls.begin(), stalls.end());
+    res.StallMean = stalls.empty() ? 0 : sum / stalls.size();
+    res.StallP99 = stalls.empty() ? 0 : stalls[(size_t)((stalls.size() - 1) * 0.99)];
+    return res;
+}
+
+void Report(const char* name, const RunResult& res)
+{
+    printf("%s: host stall per frame mean %.3f ms, p99 %.3f ms, replies %llu/%llu (%.2f%%)\n",
+           name, res.StallMean, res.StallP99,
+           (unsigned long long)res.Captured, (unsigned long long)res.Expected,
+           res.Expected ? (100.0 * res.Captured / res.Expected) : 0.0);
+
+    for (size_t i = 0; i < res.Stats.size(); i++)
+        printf("  client %zu: %s", i + 1, res.Stats[i].Summary().c_str());
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    int numclients = (argc > 1) ? atoi(argv[1]) : 3;
+    int frames = (argc > 2) ? atoi(argv[2]) : 300;
+    const char* impairspec = (argc > 3) ? argv[3] : "delay=0.5,jitter=1,loss=5,seed=7";
+
+    if (numclients < 1 || numclients > 15 || frames < 1)
+    {
+        fprintf(stderr, "usage: %s [clients 1-15] [frames] [impair-spec]\n", argv[0]);
+        return 2;
+    }
+
+    LANImpairment check;
+    if (impairspec[0] && !check.Parse(impairspec))
+    {
+        fprintf(stderr, "bad impairment spec '%s'\n", impairspec);
+        return 2;
+    }
+
+    // LAN reads this when a session starts, on the host and on every client
+    setenv("MELONDS_LAN_IMPAIR", impairspec, 1);
+
+    printf("%d clients, %d frames, %d CMDs per frame, impairment '%s', reply timeout floor %u us\n",
+           numclients, frames, kCmdsPerFrame, impairspec, LANLinkStats::kMinReplyTimeout);
+
+    RunResult fixed = RunSession(numclients, frames, false);
+    Report("fixed 25 ms", fixed);
+    RunResult adaptive = RunSession(numclients, frames, true);
+    Report("adaptive", adaptive);
+
+    int failures = 0;
+    if (adaptive.StallMean > fixed.StallMean)
+    {
+        fprintf(stderr, "FAIL: adaptive timeout stalls the host longer than the fixed one\n");
+        failures++;
+    }
+
+    // the adaptive policy gives up on replies slower than its estimate, but
+    // it must not throw away a meaningful share of replies that would arrive
+    double fixedrate = fixed.Expected ? (double)fixed.Captured / fixed.Expected : 1.0;
+    double adaptiverate = adaptive.Expected ? (double)adaptive.Captured / adaptive.Expected : 1.0;
+    if (adaptiverate < fixedrate - 0.02)
+    {
+        fprintf(stderr, "FAIL: adaptive timeout captured %.2f%% of replies, fixed %.2f%%\n",
+                adaptiverate * 100, fixedrate * 100);
+        failures++;
+    }
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,179 @@
+/*
+    MELONPRIME_METRICS histogram and shared page checks.
+
+    - every value falls in a bucket no wider than 1/64 of it, and the
+      buckets cover 0 to MaxValue without gaps;
+    - percentiles of a skewed sample stay within a bucket of the exact ones;
+    - counts recorded from several threads at once all reach the page, and
+      a Reader mapping the file sees them, totals and intervals alike;
+    - nothing is recorded once the page is closed, and other files aren't
+      taken for a page.
+
+    Prints what a Record() costs.
+
+    usage: melonprime_metrics_tests [scratch directory]
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "MelonPrimeMetrics.h"
+
+using namespace melonDS;
+using namespace melonDS::MelonPrimeMetrics;
+
+namespace
+{
+
+int Failures = 0;
+
+void Expect(bool cond, const char* what)
+{
+    if (!cond)
+    {
+        fprintf(stderr, "FAIL: %s\n", what);
+        Failures++;
+    }
+}
+
+void CheckBuckets()
+{
+    bool contiguous = true;
+    for (u32 i = 0; i + 1 < BucketCount; i++)
+        contiguous &= BucketHighest(i) + 1 == BucketLowest(i + 1);
+    Expect(contiguous, "buckets have gaps or overlap");
+    Expect(BucketLowest(0) == 0 && BucketHighest(BucketCount - 1) == MaxValue, "buckets don't cover 0 to MaxValue");
+
+    std::mt19937_64 rng(1);
+    bool inside = true, narrow = true;
+    for (int i = 0; i < 1'000'000; i++)
+    {
+        const u64 value = i < 100'000 ? (u64)i : rng() >> (rng() % 64);
+        const u64 clamped = std::min(value, MaxValue);
+        const u32 index = BucketIndex(value);
+        inside &= index < BucketCount && BucketLowest(index) <= clamped && clamped <= BucketHighest(index);
+        narrow &= (BucketHighest(index) - BucketLowest(index)) * 64 <= BucketLowest(index);
+    }
+    Expect(inside, "value outside its bucket");
+    Expect(narrow, "bucket wider than 1/64 of its values");
+}
+
+void CheckPercentiles()
+{
+    // mostly around a 16.7 ms frame, with a long tail
+    std::mt19937 rng(2);
+    std::lognormal_distribution<double> dist(std::log(16'700.0), 0.15);
+    std::vector<u64> values(200'000);
+    Snapshot snap;
+    for (u64& value : values)
+    {
+        value = (u64)dist(rng);
+        if (rng() % 1000 == 0)
+            value *= 20;
+        snap.Buckets[BucketIndex(value)]++;
+        snap.Count++;
+        snap.Sum += value;
+        snap.Max = std::max(snap.Max, value);
+    }
+    std::sort(values.begin(), values.end());
+
+    for (double percentile : {50.0, 90.0, 99.0, 99.9, 100.0})
+    {
+        size_t rank = (size_t)(percentile / 100.0 * values.size() + 0.5);
+        const u64 exact = values[std::max<size_t>(rank, 1) - 1];
+        const u64 reported = snap.ValueAtPercentile(percentile);
+        printf("p%-5g exact %6llu  histogram %6llu\n", percentile, (unsigned long long)exact,
+               (unsigned long long)reported);
+        if (reported < exact || (reported - exact) * 64 > exact)
+        {
+            fprintf(stderr, "FAIL: p%g is %llu, exact %llu\n", percentile, (unsigned long long)reported,
+                    (unsigned long long)exact);
+            Failures++;
+        }
+    }
+    Expect(snap.ValueAtPercentile(100) == values.back(), "p100 isn't the maximum");
+    Expect(Snapshot{}.ValueAtPercentile(50) == 0, "empty histogram has a percentile");
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::filesystem::path dir = argc > 1 ? std::filesystem::path(argv[1])
+                                         : std::filesystem::temp_directory_path() / "melonprime-metrics-tests";
+    std::filesystem::create_directories(dir);
+    const std::filesystem::path path = dir / "metrics", other = dir / "not-metrics";
+
+    CheckBuckets();
+    CheckPercentiles();
+
+    Expect(!IsEnabled(), "recording without MELONPRIME_METRICS");
+    Expect(Open(path.string()) && IsEnabled(), "couldn't open the page");
+
+    constexpr int Threads = 4, PerThread = 250'000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < Threads; t++)
+    {
+        threads.emplace_back([t]
+        {
+            for (int i = 0; i < PerThread; i++)
+                Record(Metric::FrameTime, 16'000 + (u64)((i * 7 + t) % 1500));
+            Record(Metric::AudioFill, (u64)t);
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+
+    Reader reader;
+    Expect(reader.Open(path.string()), "reader couldn't map the page");
+    if (reader.IsOpen())
+    {
+        Snapshot frames = reader.Read(Metric::FrameTime);
+        u64 bucketTotal = 0;
+        for (u64 count : frames.Buckets)
+            bucketTotal += count;
+        Expect(frames.Count == (u64)Threads * PerThread && bucketTotal == frames.Count, "samples lost between threads");
+        Expect(frames.Max == 17'499, "wrong maximum");
+        Expect(reader.Read(Metric::AudioFill).Count == Threads, "wrong audio fill count");
+        Expect(reader.Read(Metric::InputToPresent).Count == 0, "samples in an unused histogram");
+
+        const Snapshot before = reader.Read(Metric::InputToRunFrame);
+        for (u64 value : {900, 1100, 5000})
+            Record(Metric::InputToRunFrame, value);
+        const Snapshot interval = reader.Read(Metric::InputToRunFrame).Since(before);
+        Expect(interval.Count == 3 && interval.ValueAtPercentile(100) == 5000, "wrong interval");
+
+        const auto start = std::chrono::steady_clock::now();
+        constexpr int Timed = 10'000'000;
+        for (int i = 0; i < Timed; i++)
+            Record(Metric::InputToPresent, (u64)(i & 0xFFFF));
+        printf("Record(): %.2f ns\n",
+               std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / Timed);
+
+        Close();
+        Expect(!IsEnabled(), "still recording after Close()");
+        Record(Metric::InputToPresent, 1);
+        Expect(reader.Read(Metric::InputToPresent).Count == Timed, "recorded after Close()");
+    }
+
+    std::ofstream(other) << "not a metrics page";
+    Reader bad;
+    Expect(!bad.Open(other.string()), "took a text file for a page");
+    Expect(!bad.Open((dir / "missing").string()), "opened a missing file");
+
+    std::filesystem::remove(path);
+    std::filesystem::remove(other);
+    if (Failures)
+    {
+        fprintf(stderr, "%d check(s) failed\n", Failures);
+        return 1;
+    }
+    printf("all metrics checks passed\n");
+    return 0;
+}
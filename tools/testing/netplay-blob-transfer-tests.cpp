@@ -0,0 +1,453 @@
+/*
+    Join-time test for the netplay blob transfer.
+
+    A host thread and a client talk over a TCP connection on 127.0.0.1 (a
+    reliable ordered channel, like the ENet blob channel), throttled to a
+    configurable bandwidth. The host runs the same manifest/request/chunk/end
+    exchange as Netplay's SendBlobToMirrorClients, the client feeds everything
+    through NetplayBlobReceiver, for a synthetic cart ROM, save memory and a
+    real initial savestate.
+
+    Scenarios:
+    - raw: everything sent uncompressed with no cache (the previous protocol)
+    - first join: save memory and savestate compressed, ROM cached on arrival
+    - rejoin: the ROM is skipped thanks to the cache
+    - resume: the connection drops halfway through the ROM; the client
+      reconnects and the transfer picks up where it stopped
+
+    usage: melonprime_netplay_blob_transfer_tests [rom MB] [link Mbit/s]
+*/
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "NDS.h"
+#include "Savestate.h"
+#include "net/NetplayBlob.h"
+
+using namespace melonDS;
+
+namespace
+{
+
+enum
+{
+    Blob_CartROM = 0,
+    Blob_CartSRAM,
+    Blob_InitState,
+
+    Blob_MAX
+};
+
+constexpr u8 Msg_Start = 0x05;
+
+double NowMS()
+{
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+// length-prefixed messages over a TCP socket, throttled on the send side
+struct Link
+{
+    int Sock = -1;
+    double BytesPerMS = 0;
+    double Start = 0;
+    u64 Sent = 0;
+
+    bool Send(const u8* data, u32 len)
+    {
+        u8 hdr[4];
+        memcpy(hdr, &len, 4);
+        if (!WriteAll(hdr, 4) || !WriteAll(data, len))
+            return false;
+
+        Sent += 4 + len;
+        if (BytesPerMS > 0)
+        {
+            double due = Start + (double)Sent / BytesPerMS;
+            double now = NowMS();
+            if (due > now)
+                std::this_thread::sleep_for(std::chrono::microseconds((u64)((due - now) * 1000)));
+        }
+        return true;
+    }
+
+    bool Recv(std::vector<u8>& out)
+    {
+        u32 len;
+        if (!ReadAll((u8*)&len, 4) || len > NetplayBlobSender::kMaxMessageSize)
+            return false;
+        out.resize(len);
+        return ReadAll(out.data(), len);
+    }
+
+    bool WriteAll(const u8* data, u32 len)
+    {
+        while (len)
+        {
+            ssize_t res = send(Sock, data, len, MSG_NOSIGNAL);
+            if (res <= 0) return false;
+            data += res;
+            len -= res;
+        }
+        return true;
+    }
+
+    bool ReadAll(u8* data, u32 len)
+    {
+        while (len)
+        {
+            ssize_t res = recv(Sock, data, len, 0);
+            if (res <= 0) return false;
+            data += res;
+            len -= res;
+        }
+        return true;
+    }
+
+    void Close()
+    {
+        if (Sock >= 0)
+        {
+            shutdown(Sock, SHUT_RDWR);
+            close(Sock);
+        }
+        Sock = -1;
+    }
+};
+
+struct HostOptions
+{
+    bool Raw = false;
+    double BytesPerMS = 0;
+    // drop the connection once this many ROM bytes went out (0 = never)
+    u32 DropAfter = 0;
+};
+
+struct HostResult
+{
+    bool Dropped = false;
+    bool Ok = false;
+    u64 BytesSent = 0;
+};
+
+// one connection's worth of the mirror host side
+HostResult RunHost(int listensock, const std::vector<u8>* blobs, const HostOptions& opt)
+{
+    HostResult res;
+
+    Link link;
+    link.Sock = accept(listensock, nullptr, nullptr);
+    if (link.Sock < 0) return res;
+    int one = 1;
+    setsockopt(link.Sock, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    link.BytesPerMS = opt.BytesPerMS;
+    link.Start = NowMS();
+
+    std::vector<u8> buf(NetplayBlobSender::kMaxMessageSize);
+    std::vector<u8> msg;
+
+    for (int type = 0; type < Blob_MAX; type++)
+    {
+        u8 flags = 0;
+        if (!opt.Raw)
+            flags = (type == Blob_CartROM) ? BlobFlag_Cacheable : BlobFlag_Compressed;
+
+        NetplayBlobSender sender;
+        sender.Prepare(type, blobs[type].data(), (u32)blobs[type].size(), flags);
+
+        u32 len = sender.WriteManifest(buf.data());
+        if (!link.Send(buf.data(), len)) goto out;
+
+        u32 offset;
+        if (!link.Recv(msg) || !sender.ParseRequest(msg.data(), (u32)msg.size(), &offset))
+            goto out;
+        if (offset == NetplayBlobSender::kSkip)
+            continue;
+
+        for (u32 pos = offset; (len = sender.WriteChunk(buf.data(), pos)) > 0; pos += NetplayBlobSender::kChunkSize)
+        {
+            if (type == Blob_CartROM && opt.DropAfter && pos >= opt.DropAfter)
+            {
+                res.Dropped = true;
+                goto out;
+            }
+            if (!link.Send(buf.data(), len)) goto out;
+        }
+
+        len = sender.WriteEnd(buf.data());
+        if (!link.Send(buf.data(), len)) goto out;
+
+        bool ok;
+        if (!link.Recv(msg) || !sender.ParseAck(msg.data(), (u32)msg.size(), &ok) || !ok)
+            goto out;
+    }
+
+    buf[0] = Msg_Start;
+    res.Ok = link.Send(buf.data(), 1);
+
+out:
+    res.BytesSent = link.Sent;
+    link.Close();
+    return res;
+}
+
+// returns true once the host said to start
+bool RunClient(u16 port, NetplayBlobReceiver& receiver)
+{
+    Link link;
+    link.Sock = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(port);
+    if (connect(link.Sock, (sockaddr*)&addr, sizeof(addr)) < 0)
+    {
+        link.Close();
+        return false;
+    }
+    int one = 1;
+    setsockopt(link.Sock, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+    std::vector<u8> msg;
+    u8 reply[NetplayBlobReceiver::kMaxReplySize];
+    bool started = false;
+    while (link.Recv(msg))
+    {
+        if (msg.size() == 1 && msg[0] == Msg_Start)
+        {
+            started = true;
+            break;
+        }
+
+        u32 replylen;
+        NetplayBlobReceiver::Result res = receiver.HandleMessage(msg.data(), (u32)msg.size(), reply, &replylen);
+        if (replylen && !link.Send(reply, replylen))
+            break;
+        if (res == NetplayBlobReceiver::Result::Failed)
+            break;
+    }
+
+    link.Close();
+    return started;
+}
+
+struct JoinResult
+{
+    bool Ok = false;
+    double TimeMS = 0;
+    u64 BytesSent = 0;
+    int Connections = 0;
+};
+
+JoinResult Join(const std::vector<u8>* blobs, NetplayBlobReceiver& receiver, const HostOptions& opt)
+{
+    JoinResult ret;
+
+    int listensock = socket(AF_INET, SOCK_STREAM, 0);
+    int one = 1;
+    setsockopt(listensock, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    bind(listensock, (sockaddr*)&addr, sizeof(addr));
+    listen(listensock, 1);
+    socklen_t addrlen = sizeof(addr);
+    getsockname(listensock, (sockaddr*)&addr, &addrlen);
+    u16 port = ntohs(addr.sin_port);
+
+    double start = NowMS();
+    HostOptions hostopt = opt;
+    for (int attempt = 0; attempt < 4 && !ret.Ok; attempt++)
+    {
+        HostResult host;
+        std::thread hostthread([&] { host = RunHost(listensock, blobs, hostopt); });
+        bool started = RunClient(port, receiver);
+        hostthread.join();
+
+        ret.Connections++;
+        ret.BytesSent += host.BytesSent;
+        ret.Ok = started && host.Ok;
+
+        // only drop the first connection
+        hostopt.DropAfter = 0;
+    }
+    ret.TimeMS = NowMS() - start;
+
+    close(listensock);
+
+    for (int type = 0; type < Blob_MAX && ret.Ok; type++)
+    {
+        if (!receiver.HasBlob(type) || receiver.GetBlob(type) != blobs[type])
+            ret.Ok = false;
+    }
+    return ret;
+}
+
+std::vector<u8> BuildROM(u32 len)
+{
+    // ROM contents are mostly already compressed or packed data
+    std::vector<u8> rom(len);
+    u32 x = 0x12345678;
+    for (u32 i = 0; i < len; i += 4)
+    {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        memcpy(&rom[i], &x, 4);
+    }
+    memcpy(rom.data(), "METROIDPRIME", 12);
+    return rom;
+}
+
+std::vector<u8> BuildSRAM()
+{
+    std::vector<u8> sram(0x80000, 0xFF);
+    for (u32 i = 0; i < 0x2000; i++)
+        sram[i] = (u8)(i * 7);
+    return sram;
+}
+
+std::vector<u8> BuildInitState()
+{
+    NDSArgs args;
+    args.JIT = std::nullopt;
+    auto nds = std::make_unique<NDS>(std::move(args));
+    nds->Reset();
+
+    Savestate state;
+    nds->DoSavestate(&state);
+    state.Finish();
+    const u8* data = (const u8*)state.Buffer();
+    return std::vector<u8>(data, data + state.Length());
+}
+
+void Report(const char* name, const JoinResult& res)
+{
+    printf("%-12s %s  join %8.1f ms, %7.2f MB on the wire, %d connection(s)\n", name,
+           res.Ok ? "ok  " : "FAIL", res.TimeMS, res.BytesSent / 1048576.0, res.Connections);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    int rommb = (argc > 1) ? atoi(argv[1]) : 32;
+    double mbit = (argc > 2) ? atof(argv[2]) : 100;
+    if (rommb < 1 || rommb > 512 || mbit <= 0)
+    {
+        fprintf(stderr, "usage: %s [rom MB] [link Mbit/s]\n", argv[0]);
+        return 2;
+    }
+
+    char cachedir[] = "/tmp/melonprime-blob-cacheXXXXXX";
+    if (!mkdtemp(cachedir))
+    {
+        fprintf(stderr, "could not create a cache directory\n");
+        return 2;
+    }
+    std::string cacheprefix = std::string(cachedir) + "/netplay_";
+
+    std::vector<u8> blobs[Blob_MAX];
+    blobs[Blob_CartROM] = BuildROM((u32)rommb << 20);
+    blobs[Blob_CartSRAM] = BuildSRAM();
+    blobs[Blob_InitState] = BuildInitState();
+
+    printf("ROM %u bytes, save memory %u bytes, savestate %u bytes, link %.0f Mbit/s\n",
+           (u32)blobs[0].size(), (u32)blobs[1].size(), (u32)blobs[2].size(), mbit);
+
+    HostOptions opt;
+    opt.BytesPerMS = mbit * 1000000.0 / 8 / 1000;
+
+    int failures = 0;
+
+    opt.Raw = true;
+    NetplayBlobReceiver rawreceiver;
+    JoinResult raw = Join(blobs, rawreceiver, opt);
+    Report("raw", raw);
+    opt.Raw = false;
+
+    NetplayBlobReceiver first;
+    first.SetCachePrefix(cacheprefix);
+    JoinResult firstjoin = Join(blobs, first, opt);
+    Report("first join", firstjoin);
+
+    // a new session: the receiver starts out empty, but the cache remains
+    NetplayBlobReceiver second;
+    second.SetCachePrefix(cacheprefix);
+    JoinResult rejoin = Join(blobs, second, opt);
+    Report("rejoin", rejoin);
+    if (!second.WasSkipped(Blob_CartROM))
+    {
+        fprintf(stderr, "FAIL: rejoin transferred the ROM again\n");
+        failures++;
+    }
+
+    char resumedir[] = "/tmp/melonprime-blob-resumeXXXXXX";
+    mkdtemp(resumedir);
+    NetplayBlobReceiver third;
+    third.SetCachePrefix(std::string(resumedir) + "/netplay_");
+    opt.DropAfter = (u32)(blobs[Blob_CartROM].size() / 2);
+    JoinResult resumed = Join(blobs, third, opt);
+    Report("resume", resumed);
+
+    if (!raw.Ok || !firstjoin.Ok || !rejoin.Ok || !resumed.Ok)
+    {
+        fprintf(stderr, "FAIL: a transfer did not complete or delivered wrong data\n");
+        failures++;
+    }
+    if (firstjoin.BytesSent >= raw.BytesSent || firstjoin.TimeMS >= raw.TimeMS)
+    {
+        fprintf(stderr, "FAIL: compression did not make the first join faster\n");
+        failures++;
+    }
+    if (rejoin.TimeMS >= firstjoin.TimeMS / 4)
+    {
+        fprintf(stderr, "FAIL: rejoining with a cached ROM is not much faster\n");
+        failures++;
+    }
+    if (resumed.Connections < 2 || resumed.BytesSent > firstjoin.BytesSent + firstjoin.BytesSent / 20)
+    {
+        fprintf(stderr, "FAIL: the interrupted transfer started over instead of resuming\n");
+        failures++;
+    }
+
+    // a manifest announcing more than the type's limit is turned away
+    // before anything is allocated for it
+    {
+        NetplayBlobReceiver capped;
+        capped.SetMaxLength(Blob_CartSRAM, 8 << 20);
+        u8 manifest[24] = {BlobMsg_Manifest, Blob_CartSRAM, 0};
+        const u32 length = 512u << 20;
+        memcpy(&manifest[4], &length, 4);
+        memcpy(&manifest[8], &length, 4);
+        u8 reply[NetplayBlobReceiver::kMaxReplySize];
+        u32 replylen = 0;
+        if (capped.HandleMessage(manifest, sizeof(manifest), reply, &replylen) != NetplayBlobReceiver::Result::Ignored
+            || replylen != 0)
+        {
+            fprintf(stderr, "FAIL: an oversized save memory manifest was accepted\n");
+            failures++;
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::remove_all(cachedir, ec);
+    std::filesystem::remove_all(resumedir, ec);
+
+    return failures ? 1 : 0;
+}
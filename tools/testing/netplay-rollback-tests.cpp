@@ -0,0 +1,353 @@
+/*
+    Deterministic two-instance test for the netplay rollback session.
+
+    Two peers, each with its own NDS instance, play the synthetic test ROM
+    (headless/TestROM.h), whose guest state depends on exactly which input was
+    seen on which frame. Each peer feeds its local input through
+    NetplayRollback and "sends" it to the other over a simulated link with
+    per-message latency and jitter (in frames, delivered in order). A third
+    instance runs the same inputs with no latency at all.
+
+    After all inputs are delivered, both peers must end up with savestates
+    that hash identically to the reference, and the lossy scenarios must
+    actually have rolled back. Snapshots must mostly copy only the main RAM
+    pages written since their slot was last saved.
+
+    The peers also exchange per-frame state hashes over the same link. No
+    desync may be reported in the normal scenarios; the desync one pokes main
+    RAM on one peer only and must be caught on exactly that frame. The
+    capture scenario runs the ROM variant that captures the 3D layer into
+    VRAM, armed after the line the 3D frame is started on, so re-simulated
+    frames must still render 3D.
+
+    usage: melonprime_netplay_rollback_tests [frames]
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include "NDS.h"
+#include "Savestate.h"
+#include "net/NetplayRollback.h"
+#include "xxhash/xxhash.h"
+#include "headless/TestROM.h"
+
+using namespace melonDS;
+
+namespace
+{
+
+std::unique_ptr<NDS> CreateNDS(const std::vector<u8>& rom)
+{
+    return TestROM::Boot(rom);
+}
+
+u64 StateHash(NDS& nds)
+{
+    Savestate state;
+    nds.DoSavestate(&state);
+    state.Finish();
+    if (state.Error) return 0;
+    return XXH3_64bits(state.Buffer(), state.Length());
+}
+
+u32 Random(u32& state)
+{
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+// per-player input script: buttons held for a few frames at a time, with the
+// occasional touch, so that repeating the last input is right most of the
+// time but not always
+std::vector<RollbackInput> BuildScript(int player, int frames)
+{
+    std::vector<RollbackInput> script(frames);
+    u32 rng = 0x9E3779B9u * (player + 1);
+    RollbackInput cur;
+    int hold = 0;
+    for (int i = 0; i < frames; i++)
+    {
+        if (hold-- <= 0)
+        {
+            cur.KeyMask = 0xFFF & ~(1u << (Random(rng) % 12));
+            cur.Touching = (Random(rng) % 4) == 0;
+            cur.TouchX = Random(rng) % 256;
+            cur.TouchY = Random(rng) % 192;
+            hold = Random(rng) % 8;
+        }
+        script[i] = cur;
+    }
+    return script;
+}
+
+struct Message
+{
+    int DeliverTick;
+    u32 Frame;
+    RollbackInput Input;
+    bool IsHash;
+    u64 Hash;
+};
+
+struct Peer
+{
+    std::unique_ptr<NDS> Console;
+    std::unique_ptr<NetplayRollback> Session;
+    int LocalSamples = 0;
+    std::deque<Message> Inbox;
+    int LastDelivery = 0;
+};
+
+struct Scenario
+{
+    const char* Name;
+    int Latency;     // frames
+    int Jitter;      // extra frames, uniformly 0..Jitter
+    int InputDelay;
+    int MaxRollback;
+    bool ExpectRollbacks;
+    int PokeFrame;   // peer 1 writes to main RAM before this frame, -1 for none
+    bool Capture3D;  // run the display capture variant of the ROM
+};
+
+bool RunScenario(const std::vector<u8>& plainRom, const std::vector<u8>& captureRom, const Scenario& sc, int frames)
+{
+    const std::vector<u8>& rom = sc.Capture3D ? captureRom : plainRom;
+    const int numplayers = 2;
+    std::vector<RollbackInput> scripts[numplayers];
+    for (int p = 0; p < numplayers; p++)
+        scripts[p] = BuildScript(p, frames + 1);
+
+    // reference: every input known in time, no prediction involved
+    auto reference = CreateNDS(rom);
+    if (!reference)
+    {
+        fprintf(stderr, "FAIL: could not load the test ROM\n");
+        return false;
+    }
+    for (int f = 0; f < frames; f++)
+    {
+        RollbackInput inputs[numplayers];
+        for (int p = 0; p < numplayers; p++)
+            if (f >= sc.InputDelay) inputs[p] = scripts[p][f - sc.InputDelay];
+
+        RollbackInput combined;
+        for (int p = 0; p < numplayers; p++)
+        {
+            combined.KeyMask &= inputs[p].KeyMask;
+            if (inputs[p].Touching && !combined.Touching)
+                combined = {combined.KeyMask, true, inputs[p].TouchX, inputs[p].TouchY};
+        }
+        reference->SetKeyMask(combined.KeyMask);
+        if (combined.Touching) reference->TouchScreen(combined.TouchX, combined.TouchY);
+        else reference->ReleaseScreen();
+        reference->RunFrame();
+    }
+    u64 refhash = StateHash(*reference);
+
+    Peer peers[numplayers];
+    for (int p = 0; p < numplayers; p++)
+    {
+        peers[p].Console = CreateNDS(rom);
+        peers[p].Session = std::make_unique<NetplayRollback>(*peers[p].Console, numplayers, p, sc.MaxRollback, sc.InputDelay);
+        peers[p].Session->SetHashInterval(1);
+    }
+    bool poked = false;
+
+    u32 linkrng = 12345;
+    int tick = 0;
+    for (;; tick++)
+    {
+        bool done = true;
+        for (int p = 0; p < numplayers; p++)
+        {
+            Peer& peer = peers[p];
+
+            while (!peer.Inbox.empty() && peer.Inbox.front().DeliverTick <= tick)
+            {
+                const Message& msg = peer.Inbox.front();
+                if (msg.IsHash)
+                {
+                    peer.Session->AddRemoteHash(1 - p, msg.Frame, msg.Hash);
+                }
+                else if (!peer.Session->AddRemoteInput(1 - p, msg.Frame, msg.Input))
+                {
+                    fprintf(stderr, "FAIL: %s: peer %d rejected input for frame %u\n", sc.Name, p, msg.Frame);
+                    return false;
+                }
+                peer.Inbox.pop_front();
+            }
+
+            NetplayRollback& session = *peer.Session;
+            Peer& other = peers[1 - p];
+            auto send = [&](const Message& msg)
+            {
+                Message m = msg;
+                m.DeliverTick = tick + sc.Latency + (sc.Jitter ? (int)(Random(linkrng) % (sc.Jitter + 1)) : 0);
+                if (m.DeliverTick < other.LastDelivery) m.DeliverTick = other.LastDelivery;
+                other.LastDelivery = m.DeliverTick;
+                other.Inbox.push_back(m);
+            };
+
+            u32 hashframe;
+            u64 hash;
+            while (session.PollLocalHash(&hashframe, &hash))
+                send({0, hashframe, {}, true, hash});
+
+            if (session.GetCurrentFrame() >= (u32)frames)
+                continue;
+            done = false;
+
+            // sample local input once per frame we're about to run
+            if (peer.LocalSamples <= (int)session.GetCurrentFrame() && peer.LocalSamples <= frames)
+            {
+                RollbackInput input = scripts[p][peer.LocalSamples++];
+                u32 frame = session.AddLocalInput(input);
+                send({0, frame, input, false, 0});
+            }
+
+            if (p == 1 && !poked && (int)session.GetCurrentFrame() == sc.PokeFrame)
+            {
+                // goes through the bus, like a cheat or a stray DMA would
+                peer.Console->ARM9Write32(0x02200000, 0xDEADBEEF);
+                poked = true;
+            }
+
+            session.AdvanceFrame();
+        }
+
+        if (done) break;
+        if (tick > frames * 8)
+        {
+            fprintf(stderr, "FAIL: %s: session stalled at frames %u/%u\n", sc.Name,
+                    peers[0].Session->GetCurrentFrame(), peers[1].Session->GetCurrentFrame());
+            return false;
+        }
+    }
+
+    // let the link drain, then resolve whatever is still mispredicted
+    for (int p = 0; p < numplayers; p++)
+    {
+        Peer& peer = peers[p];
+        for (const Message& msg : peer.Inbox)
+            if (!msg.IsHash)
+                peer.Session->AddRemoteInput(1 - p, msg.Frame, msg.Input);
+        peer.Session->Synchronize();
+        for (const Message& msg : peer.Inbox)
+            if (msg.IsHash)
+                peer.Session->AddRemoteHash(1 - p, msg.Frame, msg.Hash);
+        peer.Inbox.clear();
+    }
+
+    bool ok = true;
+    for (int p = 0; p < numplayers; p++)
+    {
+        NetplayRollback& session = *peers[p].Session;
+        u64 hash = StateHash(*peers[p].Console);
+        printf("%s: peer %d state %016llx (reference %016llx), %s", sc.Name, p,
+               (unsigned long long)hash, (unsigned long long)refhash, session.StatsSummary().c_str());
+
+        if (sc.PokeFrame >= 0)
+        {
+            const RollbackStats& stats = session.GetStats();
+            if (!stats.Desyncs || stats.FirstDesyncFrame != (u32)sc.PokeFrame)
+            {
+                fprintf(stderr, "FAIL: %s: peer %d reported desync at frame %d, expected %d\n", sc.Name, p,
+                        stats.Desyncs ? (int)stats.FirstDesyncFrame : -1, sc.PokeFrame);
+                ok = false;
+            }
+            continue;
+        }
+
+        if (session.GetStats().Desyncs)
+        {
+            fprintf(stderr, "FAIL: %s: peer %d reported a desync at frame %u\n", sc.Name, p,
+                    session.GetStats().FirstDesyncFrame);
+            ok = false;
+        }
+        if (session.GetStats().HashesChecked == 0)
+        {
+            fprintf(stderr, "FAIL: %s: peer %d never checked a state hash\n", sc.Name, p);
+            ok = false;
+        }
+        if (hash != refhash)
+        {
+            fprintf(stderr, "FAIL: %s: peer %d diverged from the reference\n", sc.Name, p);
+            ok = false;
+        }
+        if (sc.ExpectRollbacks && session.GetStats().Rollbacks == 0)
+        {
+            fprintf(stderr, "FAIL: %s: peer %d never rolled back\n", sc.Name, p);
+            ok = false;
+        }
+        if (!sc.ExpectRollbacks && (session.GetStats().Rollbacks || session.GetStats().SnapshotsTaken))
+        {
+            fprintf(stderr, "FAIL: %s: peer %d rolled back although the input delay covers the latency\n", sc.Name, p);
+            ok = false;
+        }
+        if (session.GetStats().MaxRollbackDepth > (u32)sc.MaxRollback)
+        {
+            fprintf(stderr, "FAIL: %s: peer %d rolled back further than allowed\n", sc.Name, p);
+            ok = false;
+        }
+        if (peers[p].Console->SPU.IsOutputSuppressed())
+        {
+            fprintf(stderr, "FAIL: %s: peer %d left audio output suppressed\n", sc.Name, p);
+            ok = false;
+        }
+        if (peers[p].Console->GPU.IsRenderingSuppressed())
+        {
+            fprintf(stderr, "FAIL: %s: peer %d left rendering suppressed\n", sc.Name, p);
+            ok = false;
+        }
+
+        // most snapshots only copy the main RAM pages written since their
+        // slot was last saved
+        const RollbackStats& stats = session.GetStats();
+        const u64 ramsize = peers[p].Console->MainRAMMask + 1;
+        if (stats.SnapshotsTaken > (u64)sc.MaxRollback * 4 && stats.SnapshotRAMBytes >= stats.SnapshotsTaken * ramsize / 2)
+        {
+            fprintf(stderr, "FAIL: %s: peer %d copied %llu KB of main RAM per snapshot\n", sc.Name, p,
+                    (unsigned long long)(stats.SnapshotRAMBytes / stats.SnapshotsTaken / 1024));
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    int frames = (argc > 1) ? atoi(argv[1]) : 240;
+    if (frames < 1)
+    {
+        fprintf(stderr, "usage: %s [frames]\n", argv[0]);
+        return 2;
+    }
+
+    std::vector<u8> rom = TestROM::Build();
+    std::vector<u8> captureRom = TestROM::Build(true);
+
+    const Scenario scenarios[] = {
+        {"delay covers latency", 2, 0, 2, 8, false, -1, false},
+        {"latency 3, jitter 2", 3, 2, 1, 8, true, -1, false},
+        {"latency 6, no delay", 6, 1, 0, 8, true, -1, false},
+        {"desync", 2, 0, 2, 8, false, frames / 2, false},
+        {"3D display capture", 3, 2, 1, 8, true, -1, true},
+    };
+
+    int failures = 0;
+    for (const Scenario& sc : scenarios)
+        if (!RunScenario(rom, captureRom, sc, frames))
+            failures++;
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,188 @@
+/*
+    MELONPRIME_PROFILE JIT block profile checks.
+
+    - Runs the test ROM under the JIT and checks the ARM9 loop and the
+      ARM7's spin loop are the hottest code of their CPUs, with the cycles
+      adding up to about the frames run, and both named from a map file
+      with the two symbol formats;
+    - counts and idle loops recorded from several threads are all in the
+      report;
+    - a second profile doesn't carry the first one's counts over;
+    - prints the frame rate with profiling off and on.
+
+    usage: melonprime_profile_tests [scratch directory]
+*/
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "NDS.h"
+#include "MelonPrimeProfile.h"
+#include "headless/TestROM.h"
+
+using namespace melonDS;
+namespace Profile = melonDS::MelonPrimeProfile;
+
+namespace
+{
+
+int Failures = 0;
+
+void Expect(bool cond, const char* what)
+{
+    if (!cond)
+    {
+        fprintf(stderr, "FAIL: %s\n", what);
+        Failures++;
+    }
+}
+
+std::string ReadFile(const std::filesystem::path& path)
+{
+    std::ifstream file(path);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+double FramesPerSecond(NDS& nds)
+{
+    constexpr int Frames = 200;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < Frames; i++)
+        nds.RunFrame();
+    return Frames / std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void CheckSymbols(const std::filesystem::path& path)
+{
+    std::ofstream(path) << "# test symbols\n"
+                           "02000800 MainLoop\n"
+                           "\n"
+                           "ArmSevenSpin = 0x03800000;\n"
+                           "// a comment\n"
+                           "02000000 RAMStart\n"
+                           "not a symbol\n";
+    Profile::SymbolMap symbols;
+    Expect(symbols.Load(path.string()) && symbols.Size() == 3, "wrong symbol count");
+    Expect(symbols.Describe(0x02000800) == "MainLoop", "symbol not found");
+    Expect(symbols.Describe(0x0200081C) == "MainLoop+0x1c", "offset from symbol wrong");
+    Expect(symbols.Describe(0x02000010) == "RAMStart+0x10", "unsorted symbols not sorted");
+    Expect(symbols.Describe(0x03800000) == "ArmSevenSpin", "linker script symbol not found");
+    Expect(symbols.Describe(0x01000000).empty(), "symbol below every other one");
+    Expect(!Profile::SymbolMap().Load((path.string() + ".missing")), "loaded a missing map");
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::filesystem::path dir = argc > 1 ? std::filesystem::path(argv[1])
+                                         : std::filesystem::temp_directory_path() / "melonprime-profile-tests";
+    std::filesystem::create_directories(dir);
+    const std::filesystem::path report = dir / "profile.txt", symbols = dir / "symbols.txt", second = dir / "second.txt";
+    std::filesystem::remove(report);
+    std::filesystem::remove(second);
+
+    CheckSymbols(symbols);
+    Expect(!Profile::IsEnabled(), "profiling without MELONPRIME_PROFILE");
+    Expect(!Profile::Stop(), "stopped a profile that never started");
+
+    std::vector<u8> rom = TestROM::Build();
+    auto nds = TestROM::Boot(rom, JITArgs{});
+    if (!nds)
+    {
+        fprintf(stderr, "FAIL: could not boot the test ROM\n");
+        return 1;
+    }
+    for (int i = 0; i < 10; i++)
+        nds->RunFrame();
+    const double offFps = FramesPerSecond(*nds);
+
+    Expect(Profile::Start(report.string(), symbols.string()) && Profile::IsEnabled(), "couldn't start profiling");
+    constexpr int Frames = 60;
+    for (int i = 0; i < Frames; i++)
+        nds->RunFrame();
+
+    // another thread's counts are added to the emulator's
+    std::thread([]
+    {
+        for (int i = 0; i < 1000; i++)
+            Profile::Record(0, 0x02000800, 10, false);
+        Profile::Record(1, 0x037F8000, 5, true);
+    }).join();
+
+    Profile::Report counts = Profile::GetReport();
+    Expect(counts.Frames == Frames, "wrong frame count");
+    Expect(!counts.Blocks[0].empty() && !counts.Blocks[1].empty(), "no blocks counted");
+    if (!counts.Blocks[0].empty() && !counts.Blocks[1].empty())
+    {
+        const Profile::BlockStats& hot9 = counts.Blocks[0][0];
+        Expect(hot9.Addr >= TestROM::kLoopAddress && hot9.Addr < TestROM::kLoopAddress + 0x20, "ARM9 loop isn't the hottest block");
+
+        u64 cycles9 = 0, entries9 = 0;
+        for (const Profile::BlockStats& block : counts.Blocks[0])
+        {
+            cycles9 += block.Cycles;
+            entries9 += block.Entries;
+        }
+        // the ARM9 loop never idles: nearly all of its 560190 cycles per
+        // frame, at twice the system clock, are spent in blocks
+        const double perFrame = (double)(cycles9 - 10000) / Frames;
+        printf("ARM9: %zu blocks, %.0f cycles and %.0f entries per frame\n", counts.Blocks[0].size(), perFrame,
+               (double)entries9 / Frames);
+        Expect(perFrame > 560190 * 2 * 0.9 && perFrame < 560190 * 2 * 1.1, "ARM9 cycles don't add up to the frames");
+
+        // an unconditional branch to itself isn't one of the JIT's idle
+        // loops, so the ARM7 spins through all of its 560190 cycles
+        const Profile::BlockStats& hot7 = counts.Blocks[1][0];
+        Expect(hot7.Addr == 0x03800000 && !hot7.Idle, "ARM7 spin loop isn't the hottest block");
+        Expect(hot7.Cycles > 560190 * Frames * 0.9 && hot7.Cycles < 560190 * Frames * 1.1,
+               "ARM7 cycles don't add up to the frames");
+
+        bool recorded = false;
+        for (const Profile::BlockStats& block : counts.Blocks[1])
+            recorded |= block.Addr == 0x037F8000 && block.Idle && block.Entries == 1 && block.Cycles == 5;
+        Expect(recorded, "other thread's ARM7 count missing");
+    }
+
+    const double onFps = FramesPerSecond(*nds);
+    Expect(Profile::Stop() && !Profile::IsEnabled(), "couldn't write the profile");
+
+    const std::string text = ReadFile(report);
+    Expect(text.find("JIT block profile, " + std::to_string(Frames + 200) + " frames") == 0, "report header wrong");
+    Expect(text.find("MainLoop") != std::string::npos, "ARM9 loop not named in the report");
+    Expect(text.find("      ArmSevenSpin") != std::string::npos, "ARM7 spin loop not named in the report");
+    Expect(text.find("037F8000  idle") != std::string::npos, "idle loop not marked in the report");
+    Expect(text.find("ARM9:") < text.find("ARM7:"), "CPUs missing from the report");
+
+    Expect(Profile::Start(second.string()), "couldn't start a second profile");
+    nds->RunFrame();
+    counts = Profile::GetReport();
+    Expect(counts.Frames == 1, "second profile has the first one's frames");
+    bool carried = false;
+    for (const Profile::BlockStats& block : counts.Blocks[1])
+        carried |= block.Addr == 0x037F8000;
+    Expect(!carried, "second profile has the first one's blocks");
+    Expect(Profile::Stop(), "couldn't write the second profile");
+    Expect(ReadFile(second).find("MainLoop") == std::string::npos, "second profile has symbols it wasn't given");
+
+    printf("%.0f fps with profiling off, %.0f fps on\n", offFps, onFps);
+
+    std::filesystem::remove(report);
+    std::filesystem::remove(second);
+    std::filesystem::remove(symbols);
+    if (Failures)
+    {
+        fprintf(stderr, "%d check(s) failed\n", Failures);
+        return 1;
+    }
+    printf("all profile checks passed\n");
+    return 0;
+}
@@ -0,0 +1,251 @@
+/*
+    MelonPrimeRAMSearch checks.
+
+    - For every width and compare, a few refines over a 4 MB RAM that
+      changes a little between copies keep exactly the candidates a plain
+      loop over the values keeps, in the same order and with the same
+      previous values;
+    - a refine down to a handful of candidates, then one that keeps them
+      all, with one thread and with several;
+    - a search that isn't started finds nothing, and a copy of another
+      size than the first clears the search.
+
+    Prints how long a refine of all of main RAM takes, against the plain
+    loop.
+
+    usage: melonprime_ram_search_tests
+*/
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "MelonPrimeRAMSearch.h"
+
+using namespace melonDS;
+using namespace melonDS::MelonPrimeRAMSearch;
+
+namespace
+{
+
+int Failures = 0;
+
+void Expect(bool cond, const char* what)
+{
+    if (!cond)
+    {
+        fprintf(stderr, "FAIL: %s\n", what);
+        Failures++;
+    }
+}
+
+constexpr u32 RAMSize = 4 * 1024 * 1024;
+
+s32 ValueAt(const std::vector<u8>& ram, u32 offset, u32 width)
+{
+    switch (width)
+    {
+    case 1: return (s8)ram[offset];
+    case 2: { s16 v; memcpy(&v, &ram[offset], 2); return v; }
+    default: { s32 v; memcpy(&v, &ram[offset], 4); return v; }
+    }
+}
+
+bool Holds(Compare cmp, s32 now, s32 prev, s32 value)
+{
+    switch (cmp)
+    {
+    case Compare::EqualTo: return now == value;
+    case Compare::NotEqualTo: return now != value;
+    case Compare::Changed: return now != prev;
+    case Compare::Unchanged: return now == prev;
+    case Compare::Increased: return now > prev;
+    case Compare::Decreased: return now < prev;
+    default: return false;
+    }
+}
+
+// the plain loop over the values, what the search has to match
+struct Reference
+{
+    u32 Width;
+    std::vector<u32> Offsets;
+    std::vector<u8> Previous;
+
+    void Start(const std::vector<u8>& ram, u32 width)
+    {
+        Width = width;
+        Previous = ram;
+        Offsets.clear();
+        for (u32 offset = 0; offset < ram.size(); offset += width)
+            Offsets.push_back(offset);
+    }
+
+    void Refine(const std::vector<u8>& ram, Compare cmp, s32 value)
+    {
+        std::vector<u32> kept;
+        for (u32 offset : Offsets)
+        {
+            if (Holds(cmp, ValueAt(ram, offset, Width), ValueAt(Previous, offset, Width), value))
+                kept.push_back(offset);
+        }
+        Offsets.swap(kept);
+        Previous = ram;
+    }
+};
+
+// nudges a few values up or down, mostly in a small part of the RAM
+void Mutate(std::vector<u8>& ram, std::mt19937& rng)
+{
+    for (int i = 0; i < 20000; i++)
+    {
+        const u32 offset = i % 4 ? rng() % 0x10000 : rng() % RAMSize;
+        ram[offset] += (u8)(rng() % 5) - 2;
+    }
+}
+
+bool SameAsReference(const Search& search, const Reference& ref)
+{
+    if (search.GetCount() != ref.Offsets.size())
+    {
+        fprintf(stderr, "%u candidates, expected %zu\n", search.GetCount(), ref.Offsets.size());
+        return false;
+    }
+    // all of them when there are few, a sample otherwise
+    const u32 step = std::max<u32>(1, (u32)ref.Offsets.size() / 5000);
+    for (u32 i = 0; i < ref.Offsets.size(); i += step)
+    {
+        const u32 offset = search.GetOffset(i);
+        if (offset != ref.Offsets[i] || search.GetPrevious(offset) != ValueAt(ref.Previous, offset, ref.Width))
+        {
+            fprintf(stderr, "candidate %u at %x, expected %x\n", i, offset, ref.Offsets[i]);
+            return false;
+        }
+    }
+    return ref.Offsets.empty() || search.GetOffset((u32)ref.Offsets.size() - 1) == ref.Offsets.back();
+}
+
+void CheckCompares(int threads)
+{
+    std::mt19937 rng(threads);
+    for (u32 width : {1u, 2u, 4u})
+    {
+        for (u32 c = 0; c < (u32)Compare::Count; c++)
+        {
+            const Compare cmp = (Compare)c;
+            std::vector<u8> ram(RAMSize);
+            for (u8& b : ram)
+                b = rng() % 4 ? 0 : (u8)rng();
+
+            Search search(threads);
+            Reference ref;
+            search.Start(ram.data(), RAMSize, width);
+            ref.Start(ram, width);
+
+            bool same = SameAsReference(search, ref);
+            for (int round = 0; round < 3 && same; round++)
+            {
+                Mutate(ram, rng);
+                // a value that's in the RAM, alternating with a common one
+                const s32 value = round % 2 ? 0 : ValueAt(ram, (rng() % (RAMSize / width)) * width, width);
+                search.Refine(ram.data(), RAMSize, cmp, value);
+                ref.Refine(ram, cmp, value);
+                same = SameAsReference(search, ref);
+            }
+            if (!same)
+            {
+                fprintf(stderr, "FAIL: %s, %u bytes, %d thread(s)\n", CompareName(cmp), width, threads);
+                Failures++;
+            }
+        }
+    }
+}
+
+void CheckNarrowing()
+{
+    std::vector<u8> ram(RAMSize, 0);
+    Search search(4);
+    search.Start(ram.data(), RAMSize, 4);
+    Expect(search.GetCount() == RAMSize / 4, "not every value is a candidate");
+
+    // a counter that only ever goes up, and one that resets
+    const u32 counters[] = {0x1234, 0x3FFFFC, 0x200000};
+    for (s32 frame = 1; frame <= 5; frame++)
+    {
+        for (u32 offset : counters)
+            memcpy(&ram[offset], &frame, 4);
+        search.Refine(ram.data(), RAMSize, Compare::Increased);
+    }
+    Expect(search.GetCount() == 3, "increasing values not narrowed down");
+    for (u32 i = 0; i < 3 && i < search.GetCount(); i++)
+        Expect(search.GetOffset(i) == (i == 0 ? 0x1234u : i == 1 ? 0x200000u : 0x3FFFFCu), "wrong candidate order");
+
+    search.Refine(ram.data(), RAMSize, Compare::Unchanged);
+    Expect(search.GetCount() == 3, "unchanged values dropped");
+    Expect(search.Refine(ram.data(), RAMSize, Compare::EqualTo, 5) == 3 && search.GetPrevious(0x1234) == 5, "wrong value");
+    Expect(search.Refine(ram.data(), RAMSize, Compare::NotEqualTo, 5) == 0, "values kept that don't hold");
+
+    Search idle;
+    Expect(!idle.IsStarted() && idle.Refine(ram.data(), RAMSize, Compare::Changed) == 0, "search not started found something");
+    search.Clear();
+    Expect(!search.IsStarted() && search.GetCount() == 0, "search not cleared");
+
+    // a DSi's main RAM after a search started on a DS's
+    std::vector<u8> larger(RAMSize * 4, 0);
+    search.Start(ram.data(), RAMSize, 4);
+    Expect(search.Refine(larger.data(), (u32)larger.size(), Compare::Unchanged) == 0 && !search.IsStarted(),
+           "refined a copy of another size");
+    search.Start(larger.data(), (u32)larger.size(), 4);
+    Expect(search.Refine(ram.data(), RAMSize, Compare::Unchanged) == 0 && !search.IsStarted(),
+           "refined a smaller copy");
+}
+
+void PrintTiming()
+{
+    std::mt19937 rng(3);
+    std::vector<u8> ram(RAMSize);
+    for (u8& b : ram)
+        b = (u8)rng();
+
+    for (u32 width : {1u, 4u})
+    {
+        Search search;
+        Reference ref;
+        double searchMs = 0, plainMs = 0;
+        constexpr int Rounds = 5;
+        for (int i = 0; i < Rounds; i++)
+        {
+            search.Start(ram.data(), RAMSize, width);
+            auto start = std::chrono::steady_clock::now();
+            search.Refine(ram.data(), RAMSize, Compare::Unchanged);
+            searchMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+            ref.Start(ram, width);
+            start = std::chrono::steady_clock::now();
+            ref.Refine(ram, Compare::Unchanged, 0);
+            plainMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }
+        printf("refine of 4 MB, %u byte values: %.2f ms, plain loop %.2f ms\n", width, searchMs / Rounds,
+               plainMs / Rounds);
+    }
+}
+
+} // namespace
+
+int main()
+{
+    CheckCompares(1);
+    CheckCompares(3);
+    CheckNarrowing();
+    PrintTiming();
+
+    if (Failures)
+    {
+        fprintf(stderr, "%d check(s) failed\n", Failures);
+        return 1;
+    }
+    printf("all RAM search checks passed\n");
+    return 0;
+}
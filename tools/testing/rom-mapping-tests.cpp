@@ -0,0 +1,152 @@
+/*
+    Copy-on-write ROM file mapping checks.
+
+    Writes the synthetic ROM to a file padded to a size that isn't a power
+    of two, then:
+
+    - maps it, and checks the image matches the file and is padded with
+      zeroes up to the next power of two;
+    - boots a cart built from the mapping and checks the guest runs;
+    - writes into the cart's ROM image (as secure area re-encryption and
+      DLDI patching do) and checks the file on disk is unchanged;
+    - checks that a file too small to be a ROM isn't mapped.
+
+    usage: melonprime_rom_mapping_tests [scratch directory]
+*/
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "NDS.h"
+#include "NDSCart.h"
+#include "NDSCart/ROMStorage.h"
+#include "headless/TestROM.h"
+
+using namespace melonDS;
+
+namespace
+{
+
+int Failures = 0;
+
+void Expect(bool cond, const char* what)
+{
+    if (!cond)
+    {
+        fprintf(stderr, "FAIL: %s\n", what);
+        Failures++;
+    }
+}
+
+bool WriteFile(const std::string& path, const std::vector<u8>& data)
+{
+    FILE* f = fopen(path.c_str(), "wb");
+    if (!f) return false;
+    bool ok = fwrite(data.data(), 1, data.size(), f) == data.size();
+    return fclose(f) == 0 && ok;
+}
+
+std::vector<u8> ReadFile(const std::string& path)
+{
+    std::vector<u8> data(std::filesystem::file_size(path));
+    FILE* f = fopen(path.c_str(), "rb");
+    if (!f) return {};
+    if (fread(data.data(), 1, data.size(), f) != data.size())
+        data.clear();
+    fclose(f);
+    return data;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::filesystem::path dir = argc > 1 ? std::filesystem::path(argv[1])
+                                         : std::filesystem::temp_directory_path();
+    std::string path = (dir / "melonprime-rom-mapping-test.nds").string();
+
+    std::vector<u8> rom = TestROM::Build();
+    // something past the code, so the padding check has a boundary to look at
+    rom.resize(0x1800);
+    for (u32 i = 0x1000; i < rom.size(); i++)
+        rom[i] = (u8)(i * 7 + 1);
+    if (!WriteFile(path, rom))
+    {
+        fprintf(stderr, "FAIL: could not write %s\n", path.c_str());
+        return 1;
+    }
+
+    u32 filelen = 0;
+    NDSCart::ROMStorage storage = NDSCart::ROMStorage::MapFile(path, filelen);
+    Expect((bool)storage, "ROM file not mapped");
+#ifndef _WIN32
+    // Windows only maps files that are already a power of two long
+    Expect(storage.IsMapped(), "ROM file read instead of mapped");
+#endif
+    if (!storage)
+    {
+        std::filesystem::remove(path);
+        fprintf(stderr, "%d check(s) failed\n", Failures);
+        return 1;
+    }
+
+    Expect(filelen == rom.size(), "file length");
+    Expect(memcmp(storage.Data(), rom.data(), rom.size()) == 0, "mapped image differs from the file");
+    bool zeroes = true;
+    for (u32 i = (u32)rom.size(); i < 0x2000; i++)
+        zeroes = zeroes && storage[i] == 0;
+    Expect(zeroes, "padding isn't zeroed");
+    Expect(storage.Release() == nullptr, "a mapping handed over a buffer");
+
+    auto cart = NDSCart::ParseROM(std::move(storage), filelen);
+    Expect(cart != nullptr, "cart not built from the mapping");
+    if (!cart)
+    {
+        std::filesystem::remove(path);
+        fprintf(stderr, "%d check(s) failed\n", Failures);
+        return 1;
+    }
+    Expect(cart->GetROMLength() == 0x2000, "cart ROM length isn't padded");
+    Expect(strncmp(cart->GetHeader().GameTitle, "HEADLESSTEST", 12) == 0, "header read from the mapping");
+
+    // the cart owns the only writable view of the image
+    u8* image = const_cast<u8*>(cart->GetROM());
+
+    auto nds = std::make_unique<NDS>();
+    nds->SetNDSCart(std::move(cart));
+    nds->Reset();
+    nds->SetupDirectBoot("headless-test.nds");
+    nds->Start();
+    for (int i = 0; i < 10; i++)
+        nds->RunFrame();
+    Expect(nds->ARM9Read32(0x02100000) != 0, "guest didn't run from the mapped ROM");
+
+    memset(image, 0xA5, 0x2000);
+    Expect(ReadFile(path) == rom, "writes to the cart's image reached the file");
+
+    nds.reset();
+    Expect(ReadFile(path) == rom, "file changed when the mapping was dropped");
+
+    // anything smaller than a header page is read the normal way
+    {
+        std::string small = (dir / "melonprime-rom-mapping-small.nds").string();
+        WriteFile(small, std::vector<u8>(0x200, 0xFF));
+        u32 len = 0;
+        Expect(!NDSCart::ROMStorage::MapFile(small, len), "undersized file mapped");
+        std::filesystem::remove(small);
+    }
+
+    std::filesystem::remove(path);
+
+    if (Failures)
+    {
+        fprintf(stderr, "%d check(s) failed\n", Failures);
+        return 1;
+    }
+    printf("all ROM mapping checks passed\n");
+    return 0;
+}
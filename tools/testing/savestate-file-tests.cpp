@@ -0,0 +1,199 @@
+/*
+    Savestate file round trips through SavestateWriter and SavestateFileReader.
+
+    Saves the synthetic ROM's state after a few frames, then:
+
+    - writes it compressed and uncompressed (as older builds did) on the
+      writer thread, and checks both read back byte for byte;
+    - loads each of them into the emulator;
+    - checks that a truncated compressed file, a header with a length the
+      zstd frame doesn't have or past any real state, and a missing file
+      are rejected, and that no temporary file is left behind;
+    - checks a destination that can't take files is caught before a save
+      is queued, and that a failed write is reported to the callback.
+
+    Prints the file sizes and the time spent on each side.
+
+    usage: melonprime_savestate_file_tests [scratch directory]
+*/
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "NDS.h"
+#include "Savestate.h"
+#include "Platform.h"
+#include "frontend/qt_sdl/SavestateFile.h"
+#include "headless/TestROM.h"
+
+using namespace melonDS;
+
+namespace
+{
+
+int Failures = 0;
+
+void Expect(bool cond, const char* what)
+{
+    if (!cond)
+    {
+        fprintf(stderr, "FAIL: %s\n", what);
+        Failures++;
+    }
+}
+
+double MsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+std::unique_ptr<Savestate> SaveState(NDS& nds)
+{
+    auto state = std::make_unique<Savestate>();
+    if (!state->Error)
+        nds.DoSavestate(state.get());
+    return state;
+}
+
+void CheckRoundTrip(NDS& nds, SavestateWriter& writer, const std::vector<u8>& expected,
+                    const std::string& path, bool compress)
+{
+    const char* name = compress ? "compressed" : "uncompressed";
+    char what[128];
+
+    auto state = SaveState(nds);
+    Expect(!state->Error, "savestate failed");
+    auto start = std::chrono::steady_clock::now();
+    writer.Queue(path, std::move(state), compress);
+    double queueMs = MsSince(start);
+    writer.Wait(path);
+    double writeMs = MsSince(start);
+
+    snprintf(what, sizeof(what), "%s: still pending after Wait", name);
+    Expect(!writer.IsPending(path), what);
+    snprintf(what, sizeof(what), "%s: temporary file left behind", name);
+    Expect(!std::filesystem::exists(path + ".tmp"), what);
+
+    SavestateFileReader reader;
+    start = std::chrono::steady_clock::now();
+    bool opened = reader.Open(path);
+    double openMs = MsSince(start);
+    snprintf(what, sizeof(what), "%s: could not be opened", name);
+    Expect(opened, what);
+    if (!opened)
+        return;
+
+    snprintf(what, sizeof(what), "%s: compression flag", name);
+    Expect(reader.WasCompressed() == compress, what);
+    snprintf(what, sizeof(what), "%s: contents differ", name);
+    Expect(reader.Length() == expected.size()
+        && memcmp(reader.Data(), expected.data(), expected.size()) == 0, what);
+
+    Savestate load(reader.Data(), reader.Length(), false);
+    snprintf(what, sizeof(what), "%s: loading into the emulator", name);
+    Expect(nds.DoSavestate(&load) && !load.Error, what);
+
+    printf("%-12s %9llu -> %9llu bytes, queue %.3f ms, written after %.2f ms, opened in %.2f ms\n",
+           name, (unsigned long long)reader.Length(), (unsigned long long)reader.FileLength(),
+           queueMs, writeMs, openMs);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::filesystem::path dir = argc > 1 ? std::filesystem::path(argv[1])
+                                         : std::filesystem::temp_directory_path();
+    std::string base = (dir / "melonprime-savestate-test").string();
+
+    std::vector<u8> rom = TestROM::Build();
+    auto nds = TestROM::Boot(rom);
+    if (!nds)
+    {
+        fprintf(stderr, "FAIL: could not load the test ROM\n");
+        return 1;
+    }
+    for (int i = 0; i < 10; i++)
+        nds->RunFrame();
+
+    // what every file written below has to read back as
+    auto reference = SaveState(*nds);
+    std::vector<u8> expected((const u8*)reference->Buffer(),
+                             (const u8*)reference->Buffer() + reference->Length());
+
+    {
+        SavestateWriter writer;
+        CheckRoundTrip(*nds, writer, expected, base + ".mlz", true);
+        CheckRoundTrip(*nds, writer, expected, base + ".mln", false);
+
+        SavestateWriter::Stats stats = writer.GetStats();
+        Expect(stats.Written == 2 && stats.Failed == 0, "writer stats");
+    }
+
+    // a compressed file cut short
+    {
+        std::unique_ptr<u8[]> image;
+        u64 length = 0;
+        Expect(SavestateWriter::Compress(expected.data(), (u32)expected.size(), image, length),
+               "compressing");
+        std::string path = base + "-truncated.mlz";
+        FILE* f = fopen(path.c_str(), "wb");
+        fwrite(image.get(), 1, length / 2, f);
+        fclose(f);
+
+        SavestateFileReader reader;
+        Expect(!reader.Open(path), "truncated compressed file accepted");
+        std::filesystem::remove(path);
+    }
+
+    // the uncompressed length in the header changed
+    for (u32 length : {0xFFFFFFF0u, (u32)expected.size() - 4, 0u})
+    {
+        std::unique_ptr<u8[]> image;
+        u64 imageLength = 0;
+        SavestateWriter::Compress(expected.data(), (u32)expected.size(), image, imageLength);
+        memcpy(&image[8], &length, 4);
+        std::string path = base + "-badlength.mlz";
+        FILE* f = fopen(path.c_str(), "wb");
+        fwrite(image.get(), 1, imageLength, f);
+        fclose(f);
+
+        SavestateFileReader reader;
+        Expect(!reader.Open(path), "compressed file with a wrong length accepted");
+        std::filesystem::remove(path);
+    }
+
+    {
+        SavestateFileReader reader;
+        Expect(!reader.Open(base + "-missing.mln"), "missing file accepted");
+    }
+
+    // a directory that doesn't exist can't take the file, and the writer
+    // thread is what reports it
+    {
+        const std::string missingDir = (dir / "melonprime-no-such-dir" / "state.mln").string();
+
+        SavestateWriter writer;
+        bool failed = false;
+        writer.SetResultCallback([&](const SavestateWriter::Result& result) { failed = !result.OK; });
+        writer.Queue(missingDir, SaveState(*nds), true);
+        writer.WaitAll();
+        Expect(failed && writer.GetStats().Failed == 1, "failed write not reported");
+    }
+
+    std::filesystem::remove(base + ".mlz");
+    std::filesystem::remove(base + ".mln");
+
+    if (Failures)
+    {
+        fprintf(stderr, "%d check(s) failed\n", Failures);
+        return 1;
+    }
+    printf("all savestate file checks passed\n");
+    return 0;
+}
@@ -0,0 +1,238 @@
+/*
+    Frame state hash checks and JIT-vs-interpreter divergence finder.
+
+    Runs the synthetic test ROM (headless/TestROM.h) on several NDS instances
+    with the same scripted input and StateHash enabled, and checks that:
+
+    - the incremental hash (dirty main RAM pages only) equals a from-scratch
+      hash of the same state on every frame;
+    - two interpreter runs, and two JIT runs, hash identically frame by frame;
+    - with the JIT, fastmem stores are tracked through write faults, so only
+      the written pages get rehashed there too;
+    - a main RAM write that bypasses the bus handlers is picked up by the
+      periodic full pass within StateHash::kFullInterval frames.
+
+    Then it compares the JIT against the interpreter and prints the first
+    frame where they diverge and which components differ. The two aren't
+    cycle-identical, so a divergence only fails the run with --expect-match.
+
+    usage: melonprime_state_hash_divergence [frames] [--expect-match]
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "NDS.h"
+#include "Platform.h"
+#include "StateHash.h"
+#include "headless/TestROM.h"
+
+using namespace melonDS;
+
+namespace
+{
+
+constexpr u32 kPokeAddress = 0x02300000;
+
+struct Run
+{
+    std::vector<u64> Hashes;
+    std::vector<StateHash::Components> Parts;
+    u64 PagesRehashed = 0;
+    u64 FullTime = 0;
+    int Mismatches = 0;     // incremental vs from-scratch
+    bool TrackingComplete = true;
+};
+
+u32 Random(u32& state)
+{
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+std::vector<u32> BuildKeyScript(int frames)
+{
+    std::vector<u32> script(frames);
+    u32 rng = 0x2545F491;
+    u32 cur = 0xFFF;
+    for (int i = 0; i < frames; i++)
+    {
+        if ((Random(rng) % 4) == 0)
+            cur = 0xFFF & ~(1u << (Random(rng) % 12));
+        script[i] = cur;
+    }
+    return script;
+}
+
+// pokeframe: before this frame, write to main RAM behind the hasher's back
+bool RunScript(const std::vector<u8>& rom, std::optional<JITArgs> jit, const std::vector<u32>& keys,
+               bool checkfull, int pokeframe, Run& out)
+{
+    auto nds = TestROM::Boot(rom, jit);
+    if (!nds)
+    {
+        fprintf(stderr, "FAIL: could not load the test ROM\n");
+        return false;
+    }
+    nds->StateHash.SetEnabled(true);
+    out.TrackingComplete = nds->StateHash.IsWriteTrackingComplete();
+
+    for (int f = 0; f < (int)keys.size(); f++)
+    {
+        if (f == pokeframe)
+            nds->MainRAM[kPokeAddress & nds->MainRAMMask] ^= 0x5A;
+
+        nds->SetKeyMask(keys[f]);
+        nds->RunFrame();
+
+        // RunFrame ran the incremental update
+        u64 hash = nds->StateHash.GetHash();
+        out.Hashes.push_back(hash);
+        out.Parts.push_back(nds->StateHash.GetComponents());
+        out.PagesRehashed += nds->StateHash.GetPagesRehashed();
+
+        if (checkfull)
+        {
+            u64 t0 = Platform::GetUSCount();
+            u64 full = nds->StateHash.ComputeFull();
+            out.FullTime += Platform::GetUSCount() - t0;
+            if (full != hash)
+            {
+                if (out.Mismatches == 0)
+                    fprintf(stderr, "incremental hash %016llx != full hash %016llx at frame %d\n",
+                            (unsigned long long)hash, (unsigned long long)full, f);
+                out.Mismatches++;
+            }
+        }
+    }
+    return true;
+}
+
+int FirstDivergence(const Run& a, const Run& b)
+{
+    for (size_t i = 0; i < a.Hashes.size() && i < b.Hashes.size(); i++)
+        if (a.Hashes[i] != b.Hashes[i])
+            return (int)i;
+    return -1;
+}
+
+void PrintComponents(const StateHash::Components& a, const StateHash::Components& b)
+{
+    printf("  differing components:%s%s%s%s%s\n",
+           a.MainRAM != b.MainRAM ? " MainRAM" : "",
+           a.WRAM != b.WRAM ? " WRAM" : "",
+           a.VRAM != b.VRAM ? " VRAM" : "",
+           a.CPU != b.CPU ? " CPU" : "",
+           a.IO != b.IO ? " IO" : "");
+}
+
+bool ExpectIdentical(const char* what, const Run& a, const Run& b)
+{
+    int f = FirstDivergence(a, b);
+    if (f < 0)
+    {
+        printf("%s: identical over %zu frames\n", what, a.Hashes.size());
+        return true;
+    }
+    fprintf(stderr, "FAIL: %s: diverged at frame %d\n", what, f);
+    PrintComponents(a.Parts[f], b.Parts[f]);
+    return false;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    int frames = 300;
+    bool expectmatch = false;
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--expect-match"))
+            expectmatch = true;
+        else
+            frames = atoi(argv[i]);
+    }
+    if (frames < 2)
+    {
+        fprintf(stderr, "usage: %s [frames] [--expect-match]\n", argv[0]);
+        return 2;
+    }
+
+    std::vector<u8> rom = TestROM::Build();
+    std::vector<u32> keys = BuildKeyScript(frames);
+    int failures = 0;
+
+    Run interp1, interp2;
+    if (!RunScript(rom, std::nullopt, keys, true, -1, interp1) ||
+        !RunScript(rom, std::nullopt, keys, false, -1, interp2))
+        return 1;
+
+    const u32 numpages = (0x400000 >> StateHash::kPageShift);
+    printf("interpreter: %.1f of %u main RAM pages rehashed per frame, full rehash %.1f us per frame\n",
+           (double)interp1.PagesRehashed / frames, numpages, (double)interp1.FullTime / frames);
+    if (interp1.Mismatches)
+    {
+        fprintf(stderr, "FAIL: incremental hash disagreed with the full hash on %d frames\n", interp1.Mismatches);
+        failures++;
+    }
+    if (!ExpectIdentical("interpreter vs interpreter", interp1, interp2))
+        failures++;
+
+    // an untracked write must show up by the next full pass at the latest
+    int pokeframe = frames / 3;
+    Run poked;
+    if (!RunScript(rom, std::nullopt, keys, false, pokeframe, poked))
+        return 1;
+    int caught = FirstDivergence(interp1, poked);
+    if (caught < pokeframe || caught > pokeframe + (int)StateHash::kFullInterval)
+    {
+        fprintf(stderr, "FAIL: untracked write before frame %d caught at frame %d\n", pokeframe, caught);
+        failures++;
+    }
+    else
+        printf("untracked write before frame %d caught at frame %d\n", pokeframe, caught);
+
+#ifdef JIT_ENABLED
+    Run jit1, jit2;
+    if (!RunScript(rom, JITArgs{}, keys, true, -1, jit1) ||
+        !RunScript(rom, JITArgs{}, keys, false, -1, jit2))
+        return 1;
+
+    printf("JIT: %.1f of %u main RAM pages rehashed per frame\n",
+           (double)jit1.PagesRehashed / frames, numpages);
+    if (!jit1.TrackingComplete)
+    {
+        fprintf(stderr, "FAIL: JIT: fastmem writes aren't tracked, every page is rehashed each frame\n");
+        failures++;
+    }
+    if (jit1.Mismatches)
+    {
+        fprintf(stderr, "FAIL: JIT: incremental hash disagreed with the full hash on %d frames\n", jit1.Mismatches);
+        failures++;
+    }
+    if (!ExpectIdentical("JIT vs JIT", jit1, jit2))
+        failures++;
+
+    int f = FirstDivergence(interp1, jit1);
+    if (f < 0)
+        printf("JIT vs interpreter: identical over %d frames\n", frames);
+    else
+    {
+        printf("JIT vs interpreter: first divergence at frame %d (interpreter %016llx, JIT %016llx)\n", f,
+               (unsigned long long)interp1.Hashes[f], (unsigned long long)jit1.Hashes[f]);
+        PrintComponents(interp1.Parts[f], jit1.Parts[f]);
+        if (expectmatch)
+            failures++;
+    }
+#else
+    printf("JIT vs interpreter: skipped, built without the JIT\n");
+#endif
+
+    return failures ? 1 : 0;
+}
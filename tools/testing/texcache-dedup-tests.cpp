@@ -0,0 +1,195 @@
+/*
+    Texture cache content deduplication checks.
+
+    Drives the shared Texcache<> template with a loader that only counts
+    uploads, over texture/palette VRAM filled through LCDC:
+
+    - the same texels at two addresses share one layer and one upload;
+    - a different palette or color 0 mode is decoded separately;
+    - overwriting one copy decodes it again but leaves the other one's
+      layer alone;
+    - content whose last copy was invalidated is picked up from the freed
+      layer when it shows up at a new address (a texture moving in VRAM).
+
+    Prints the cache counters at the end.
+
+    usage: melonprime_texcache_dedup_tests
+*/
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "NDS.h"
+#include "GPU.h"
+#include "GPU3D_Texcache.h"
+#include "headless/TestROM.h"
+
+using namespace melonDS;
+
+namespace
+{
+
+int Failures = 0;
+
+void Expect(bool cond, const char* what)
+{
+    if (!cond)
+    {
+        fprintf(stderr, "FAIL: %s\n", what);
+        Failures++;
+    }
+}
+
+// the template copies its loader, so the counts live outside of it
+u32 NextHandle = 1;
+u32 Uploads = 0;
+
+class CountingLoader
+{
+public:
+    u32 GenerateTexture(u32, u32, u32) { return NextHandle++; }
+    void UploadTexture(u32, u32, u32, u32, void*) { Uploads++; }
+    void DeleteTexture(u32) {}
+
+    NoopTextureDecodeTimer BeginTextureDecode() noexcept { return {}; }
+    TextureDecodeTarget BeginTextureUpload(u32, u32, u32, u32) noexcept { return {}; }
+    void CommitTextureUpload(u32) noexcept {}
+    void CancelTextureUpload(u32) noexcept {}
+};
+
+using TestTexcache = Texcache<CountingLoader, u32>;
+
+constexpr u32 TexBankLCDC = 0x06800000; // bank A, mapped as texture slot 0
+constexpr u32 PalBankLCDC = 0x06880000; // bank E, mapped as texture palette
+
+u32 Pattern(u32 seed, u32 i)
+{
+    u32 x = (i * 0x9E3779B1u) ^ (seed * 0x85EBCA6Bu);
+    return x ^ (x >> 15);
+}
+
+// writes go through LCDC, then the banks are mapped back for the 3D engine
+void WriteTexels(NDS& nds, u32 addr, u32 size, u32 seed)
+{
+    nds.ARM9Write8(0x04000240, 0x80);
+    for (u32 i = 0; i < size; i += 4)
+        nds.ARM9Write32(TexBankLCDC + addr + i, Pattern(seed, i));
+    nds.ARM9Write8(0x04000240, 0x83);
+}
+
+void WritePalette(NDS& nds, u32 addr, u32 size, u32 seed)
+{
+    nds.ARM9Write8(0x04000244, 0x80);
+    for (u32 i = 0; i < size; i += 4)
+        nds.ARM9Write32(PalBankLCDC + addr + i, Pattern(seed, i) & 0x7FFF7FFF);
+    nds.ARM9Write8(0x04000244, 0x83);
+}
+
+// 32x32, 16 colors
+u32 Param4bpp(u32 addr, bool color0Transparent)
+{
+    return (addr / 8) | (2 << 20) | (2 << 23) | (3 << 26) | (color0Transparent ? (1 << 29) : 0);
+}
+
+constexpr u32 TexSize4bpp = 32 * 32 / 2;
+
+struct Lookup
+{
+    u32 Handle = 0;
+    u32 Layer = 0;
+};
+
+Lookup Get(TestTexcache& cache, u32 texParam, u32 palBase)
+{
+    Lookup res;
+    u32* helper = nullptr;
+    cache.GetTexture(texParam, palBase, res.Handle, res.Layer, helper);
+    return res;
+}
+
+bool SameLayer(const Lookup& a, const Lookup& b)
+{
+    return a.Handle == b.Handle && a.Layer == b.Layer;
+}
+
+} // namespace
+
+int main()
+{
+    std::vector<u8> rom = TestROM::Build();
+    auto nds = TestROM::Boot(rom);
+    if (!nds)
+    {
+        fprintf(stderr, "FAIL: could not load the test ROM\n");
+        return 1;
+    }
+    GPU& gpu = nds->GPU;
+
+    WriteTexels(*nds, 0x0000, TexSize4bpp, 1);
+    WriteTexels(*nds, 0x1000, TexSize4bpp, 1);
+    WritePalette(*nds, 0x000, 0x20, 7);
+    WritePalette(*nds, 0x100, 0x20, 7);
+    WritePalette(*nds, 0x200, 0x20, 8);
+
+    TestTexcache cache(gpu, CountingLoader());
+    u8 clrBitmapDirty;
+    cache.Update(clrBitmapDirty);
+
+    const Lookup a = Get(cache, Param4bpp(0x0000, false), 0x00);
+    const Lookup b = Get(cache, Param4bpp(0x1000, false), 0x00);
+    const Lookup c = Get(cache, Param4bpp(0x0000, false), 0x10);
+    Expect(SameLayer(a, b), "same texels at two addresses not shared");
+    Expect(SameLayer(a, c), "same palette at two addresses not shared");
+    Expect(Uploads == 1, "shared content uploaded more than once");
+    Expect(cache.GetStats().BytesSaved == 2 * 32 * 32 * 4, "shared bytes with three users");
+
+    const Lookup again = Get(cache, Param4bpp(0x1000, false), 0x00);
+    Expect(SameLayer(a, again), "repeated lookup moved to another layer");
+    Expect(cache.GetStats().Hits == 1, "repeated lookup not counted as a hit");
+
+    const Lookup otherPal = Get(cache, Param4bpp(0x0000, false), 0x20);
+    const Lookup transparent = Get(cache, Param4bpp(0x0000, true), 0x00);
+    Expect(!SameLayer(a, otherPal), "different palette shared a layer");
+    Expect(!SameLayer(a, transparent), "different color 0 mode shared a layer");
+    Expect(Uploads == 3, "different content not uploaded");
+
+    // the texels at 0x0000 change; the copy at 0x1000 keeps the layer
+    WriteTexels(*nds, 0x0000, TexSize4bpp, 2);
+    Expect(cache.Update(clrBitmapDirty), "texture write not reported");
+    const Lookup changed = Get(cache, Param4bpp(0x0000, false), 0x00);
+    const Lookup untouched = Get(cache, Param4bpp(0x1000, false), 0x00);
+    Expect(!SameLayer(a, changed), "changed texels kept the shared layer");
+    Expect(SameLayer(a, untouched), "unchanged copy lost its layer");
+    Expect(Uploads == 4, "changed texels not decoded again");
+
+    // the last copy of the original texels moves from 0x1000 to 0x2000
+    WriteTexels(*nds, 0x1000, TexSize4bpp, 3);
+    WriteTexels(*nds, 0x2000, TexSize4bpp, 1);
+    cache.Update(clrBitmapDirty);
+    const Lookup moved = Get(cache, Param4bpp(0x2000, false), 0x00);
+    Expect(SameLayer(a, moved), "moved texture not picked up from its freed layer");
+    Expect(Uploads == 4, "moved texture decoded again");
+
+    const TexcacheStats& stats = cache.GetStats();
+    printf("hits %llu, decoded %llu, deduplicated %llu, revived %llu, %llu bytes shared\n",
+           (unsigned long long)stats.Hits, (unsigned long long)stats.Misses,
+           (unsigned long long)stats.DedupHits, (unsigned long long)stats.Revived,
+           (unsigned long long)stats.BytesSaved);
+    Expect(stats.Misses == 4, "decode count");
+    Expect(stats.DedupHits == 2, "deduplication count");
+    Expect(stats.Revived == 1, "revival count");
+    // every user but the moved texture has been invalidated by now
+    Expect(stats.BytesSaved == 0, "shared bytes after the invalidations");
+
+    cache.Reset();
+    Expect(cache.GetStats().Misses == 0, "stats not cleared by Reset");
+
+    if (Failures)
+    {
+        fprintf(stderr, "%d check(s) failed\n", Failures);
+        return 1;
+    }
+    printf("all texture cache deduplication checks passed\n");
+    return 0;
+}
@@ -0,0 +1,238 @@
+/*
+    MELONPRIME_TRACE event trace checks.
+
+    - Records from the emulator (JIT block compiles, savestates) and from a
+      few threads that fill their buffers more than once over, and checks
+      the file written is well-formed JSON with every thread named and only
+      the newest events of the threads that wrapped around;
+    - a second trace doesn't carry the first one's events over;
+    - prints what an event costs with tracing off and on.
+
+    usage: melonprime_trace_tests [scratch directory]
+*/
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "NDS.h"
+#include "Savestate.h"
+#include "MelonPrimeTrace.h"
+#include "headless/TestROM.h"
+
+using namespace melonDS;
+namespace Trace = melonDS::MelonPrimeTrace;
+
+namespace
+{
+
+int Failures = 0;
+
+void Expect(bool cond, const char* what)
+{
+    if (!cond)
+    {
+        fprintf(stderr, "FAIL: %s\n", what);
+        Failures++;
+    }
+}
+
+// just enough of a JSON parser to tell whether the trace is well-formed
+struct JsonChecker
+{
+    const char* P;
+
+    void Space() { while (*P == ' ' || *P == '\n' || *P == '\r' || *P == '\t') P++; }
+
+    bool String()
+    {
+        if (*P++ != '"') return false;
+        for (; *P != '"'; P++)
+        {
+            if ((unsigned char)*P < 0x20) return false;
+            if (*P == '\\' && !*++P) return false;
+        }
+        P++;
+        return true;
+    }
+
+    bool Value()
+    {
+        Space();
+        if (*P == '"') return String();
+        if (*P == '{' || *P == '[')
+        {
+            const char close = *P == '{' ? '}' : ']';
+            const bool object = *P++ == '{';
+            Space();
+            if (*P == close) { P++; return true; }
+            for (;;)
+            {
+                if (object)
+                {
+                    Space();
+                    if (!String()) return false;
+                    Space();
+                    if (*P++ != ':') return false;
+                }
+                if (!Value()) return false;
+                Space();
+                if (*P == close) { P++; return true; }
+                if (*P++ != ',') return false;
+            }
+        }
+        const char* start = P;
+        while (*P == '-' || *P == '.' || (*P >= '0' && *P <= '9') || *P == 'e' || *P == 'E' || *P == '+')
+            P++;
+        return P != start;
+    }
+
+    bool Document()
+    {
+        if (!Value()) return false;
+        Space();
+        return *P == '\0';
+    }
+};
+
+std::string ReadFile(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+size_t Count(const std::string& haystack, const char* needle)
+{
+    size_t count = 0;
+    for (size_t pos = haystack.find(needle); pos != std::string::npos; pos = haystack.find(needle, pos + 1))
+        count++;
+    return count;
+}
+
+const char* const WorkerNames[] = {"Worker 0", "Worker 1", "Worker 2"};
+constexpr u32 WorkerEvents = 150000;   // more than a thread's buffer holds
+
+void Worker(int index)
+{
+    Trace::SetThreadName(WorkerNames[index]);
+    for (u32 i = 0; i < WorkerEvents; i++)
+    {
+        Trace::Scope scope(Trace::Category::GPU, i < 1000 ? "Early" : "Late", i, Trace::ArgKind::Count);
+    }
+}
+
+double NsPerEvent(u32 pairs)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (u32 i = 0; i < pairs; i++)
+    {
+        Trace::Begin(Trace::Category::Frame, "Timed");
+        Trace::End(Trace::Category::Frame, "Timed");
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / (pairs * 2.0);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::filesystem::path dir = argc > 1 ? std::filesystem::path(argv[1])
+                                         : std::filesystem::temp_directory_path() / "melonprime-trace-tests";
+    std::filesystem::create_directories(dir);
+    const std::filesystem::path first = dir / "first.json", second = dir / "second.json";
+    std::filesystem::remove(first);
+    std::filesystem::remove(second);
+
+    Expect(!Trace::IsEnabled(), "tracing on without MELONPRIME_TRACE");
+    Expect(!Trace::Stop(), "stopped a trace that never started");
+    const double offNs = NsPerEvent(10'000'000);
+
+    Trace::SetThreadName("Main");
+    Expect(Trace::Start(first.string()), "couldn't start tracing");
+    Expect(Trace::IsEnabled(), "tracing didn't start");
+
+    std::vector<u8> rom = TestROM::Build();
+    auto nds = TestROM::Boot(rom, JITArgs{});
+    if (!nds)
+    {
+        fprintf(stderr, "FAIL: could not boot the test ROM\n");
+        return 1;
+    }
+    Trace::Begin(Trace::Category::Frame, "Frames");
+    for (int i = 0; i < 10; i++)
+        nds->RunFrame();
+    Trace::End(Trace::Category::Frame, "Frames");
+
+    auto state = std::make_unique<Savestate>();
+    Expect(nds->DoSavestate(state.get()) && !state->Error, "savestate failed");
+    Savestate load(state->Buffer(), state->Length(), false);
+    Expect(nds->DoSavestate(&load) && !load.Error, "savestate didn't load");
+    Trace::Instant(Trace::Category::Present, "Present \"quoted\"");
+
+    std::vector<std::thread> workers;
+    for (int i = 0; i < (int)std::size(WorkerNames); i++)
+        workers.emplace_back(Worker, i);
+    for (std::thread& worker : workers)
+        worker.join();
+
+    // on a thread of its own, it would push everything else out of the
+    // main thread's buffer
+    double onNs = 0;
+    std::thread([&]
+    {
+        Trace::SetThreadName("Timing");
+        onNs = NsPerEvent(1'000'000);
+    }).join();
+    Expect(Trace::Stop(), "couldn't write the trace");
+    Expect(!Trace::IsEnabled(), "tracing still on after Stop()");
+    Trace::TraceStats stats = Trace::GetStats();
+
+    std::string json = ReadFile(first);
+    printf("first trace: %llu events from %u threads, %llu overwritten, %zu KB\n",
+           (unsigned long long)stats.Events, stats.Threads, (unsigned long long)stats.Overwritten,
+           json.size() / 1024);
+    Expect(JsonChecker{json.c_str()}.Document(), "trace isn't valid JSON");
+    Expect(stats.Threads == 2 + std::size(WorkerNames), "wrong thread count");
+    Expect(stats.Overwritten > 0, "worker buffers didn't wrap around");
+    Expect(Count(json, "\"ph\":") == stats.Events + stats.Threads + 1, "event count differs from the file");
+    Expect(Count(json, "ARM9 compile block") > 0, "no JIT compile in the trace");
+    Expect(Count(json, "\"Save state\"") == 1 && Count(json, "\"Load state\"") == 1, "savestates not in the trace");
+    Expect(Count(json, "\"name\":\"Frames\"") == 2, "frame span not in the trace");
+    Expect(Count(json, "Present \\\"quoted\\\"") == 1, "instant event not escaped");
+    Expect(Count(json, "\"name\":\"Main\"") == 1, "main thread not named");
+    for (const char* name : WorkerNames)
+        Expect(Count(json, (std::string("\"name\":\"") + name + "\"").c_str()) == 1, "worker not named");
+    Expect(Count(json, "\"Early\"") == 0, "overwritten events in the trace");
+    Expect(Count(json, "\"Late\"") == std::size(WorkerNames) * (1 << 16), "worker events missing");
+
+    // the other threads are gone, the main thread only has what it records now
+    Expect(Trace::Start(second.string()), "couldn't start a second trace");
+    Trace::Instant(Trace::Category::Frame, "Second");
+    Expect(Trace::Stop(), "couldn't write the second trace");
+    stats = Trace::GetStats();
+    json = ReadFile(second);
+    Expect(JsonChecker{json.c_str()}.Document(), "second trace isn't valid JSON");
+    Expect(stats.Events == 1 && stats.Threads == 1, "second trace has the first one's events");
+    Expect(Count(json, "\"Second\"") == 1 && Count(json, "compile block") == 0, "second trace has the wrong events");
+
+    printf("Begin/End: %.2f ns per event with tracing off, %.2f ns on\n", offNs, onNs);
+
+    std::filesystem::remove(first);
+    std::filesystem::remove(second);
+    if (Failures)
+    {
+        fprintf(stderr, "%d check(s) failed\n", Failures);
+        return 1;
+    }
+    printf("all trace checks passed\n");
+    return 0;
+}
@@ -3,8 +3,13 @@
 
 Every `.comp` under src/GPU3D_Vulkan_shaders/ is compiled once per pipeline
 variant and once per tile-geometry bucket, targeting vulkan1.1, and the
-resulting SPIR-V words are written into
-src/GPU3D_Vulkan_shaders/generated/ as a committed header plus a JSON manifest.
+resulting SPIR-V is written into src/GPU3D_Vulkan_shaders/generated/ as a
+committed header plus a JSON manifest.
+
+Each module is stored as one zstd frame (the zstd command line tool does the
+compression) and inflated by the renderer the first time it builds a pipeline
+from it, so the binary carries about a quarter of the SPIR-V size and nothing
+is touched at startup.
 
 Why buckets instead of one module per internal resolution: the OpenGL compute
 renderer bakes every geometry constant into the shader text and recompiles the
@@ -28,8 +33,9 @@ The output is deterministic -- stable ordering, no timestamps, no absolute
 paths -- so regenerating without a source change produces no diff.
 
 Usage:
-    python tools/vulkan/compile-shaders.py [--glslang PATH]
-                                           [--check | --check-source-sync]
+    python tools/vulkan/compile-shaders.py [--glslang PATH] [--zstd PATH]
+                                           [--check | --check-source-sync |
+                                            --repack]
                                            [--verbose]
 
 --check recompiles and fails if the committed output is stale, without
@@ -40,7 +46,14 @@ committed manifest was generated from the current GLSL/generator inputs and
 that every committed SPIR-V blob still matches the manifest. CI uses this mode
 because different supported glslang releases can emit different, equally valid
 SPIR-V for the same GLSL; shader compilation and spirv-val remain covered by
-tools/ci/audits/check-vulkan-shaders.py.
+tools/ci/audits/check-vulkan-shaders.py. The compressed frames are checked
+against their manifest hashes, and inflated and checked against the SPIR-V
+hashes as well when the zstd tool is found.
+
+--repack rewrites the committed output in the layout this generator emits,
+from the committed SPIR-V rather than from glslang. It is meant for changes to
+the emitted layout only: it trusts that the committed modules are what the
+current sources compile to.
 """
 
 from __future__ import annotations
@@ -64,6 +77,10 @@ BLOBS_HEADER_NAME = "GPU3D_Vulkan_ShaderBlobs.h"
 TABLE_SOURCE_NAME = "GPU3D_Vulkan_ShaderModules.cpp"
 MANIFEST_NAME = "manifest.json"
 
+# Level 19 without --ultra keeps the decoder window small; the frames carry
+# their content size but no checksum, the manifest hashes cover that.
+ZSTD_ARGS = ["-19", "--no-check", "-q", "-f"]
+
 LICENSE_HEADER = """/*
     Copyright 2016-2026 melonDS team
 
@@ -110,13 +127,39 @@ def read_spirv(path: str) -> list[int]:
     return words
 
 
-def format_blob(name: str, words: list[int]) -> str:
-    lines = [f"extern const uint32_t {name}[{len(words)}];",
-             f"const uint32_t {name}[{len(words)}] = {{"]
-    for start in range(0, len(words), 8):
-        chunk = words[start:start + 8]
-        lines.append("    " + " ".join(f"0x{word:08x}," for word in chunk))
+def pack_words(words: list[int]) -> bytes:
+    return struct.pack(f"<{len(words)}I", *words)
+
+
+def compress_spirv(zstd: str, words: list[int], tmpdir: str) -> bytes:
+    # Through files rather than a pipe so the frame records its content size.
+    in_path = os.path.join(tmpdir, "module.spv")
+    out_path = in_path + ".zst"
+    with open(in_path, "wb") as handle:
+        handle.write(pack_words(words))
+    result = subprocess.run([zstd] + ZSTD_ARGS + ["-o", out_path, in_path],
+                            capture_output=True, text=True)
+    if result.returncode != 0:
+        raise SystemExit(f"zstd failed: {result.stderr.strip()}")
+    with open(out_path, "rb") as handle:
+        return handle.read()
+
+
+def inflate_spirv(zstd: str, data: bytes) -> list[int] | None:
+    result = subprocess.run([zstd, "-d", "-q", "-c"], input=data, capture_output=True)
+    if result.returncode != 0 or len(result.stdout) % 4 != 0:
+        return None
+    return list(struct.unpack(f"<{len(result.stdout) // 4}I", result.stdout))
+
+
+def format_blob(index: int, words: int, data: bytes) -> str:
+    name = f"Blob{index:03d}"
+    lines = [f"const uint8_t {name}_Data[{len(data)}] =", "{"]
+    for start in range(0, len(data), 16):
+        chunk = data[start:start + 16]
+        lines.append("    " + " ".join(f"0x{byte:02x}," for byte in chunk))
     lines.append("};")
+    lines.append(f"const ShaderModule {name} = {{ {name}_Data, {len(data)}u, {words}u, {index}u }};")
     return "\n".join(lines)
 
 
@@ -133,16 +176,14 @@ GENERATED_BANNER = """
     Pipeline indices match ComputeRenderer3D::ShaderCompileStep() in
     src/GPU3D_Compute.cpp one for one.
 
-    The SPIR-V words live in per-stage translation units rather than in the
-    header so that including the public header stays cheap: the full module set
-    is a few megabytes of integer literals and would otherwise be re-parsed by
-    every consumer.
+    Every module is one zstd frame, inflated on first use by
+    Vk::InflateShaderModule(). The frames live in per-stage translation units
+    rather than in the header so that including the public header stays cheap.
 */
 """
 
 
-def build_header(pipeline_names: list[str], blobs: list[list[int]],
-                 table: list[list[int]]) -> str:
+def build_header(pipeline_names: list[str], module_count: int) -> str:
     out: list[str] = [LICENSE_HEADER, GENERATED_BANNER.lstrip("\n")]
     out.append("""
 #ifndef GPU3D_VULKAN_SHADERMODULES_H
@@ -221,17 +262,22 @@ struct TileGeometry
     return (scale >= 5 ? 1u : 0u) + (scale >= 9 ? 1u : 0u);
 }
 
+// One SPIR-V module, as a zstd frame. Vk::InflateShaderModule() turns it into
+// words and keeps them, keyed by Index.
 struct ShaderModule
 {
-    const uint32_t* Words;
+    const uint8_t* Data;
+    uint32_t DataBytes;
     uint32_t WordCount;
+    uint32_t Index;
 };
 """)
+    out.append(f"inline constexpr uint32_t ModuleCount = {module_count};\n")
 
     out.append("""// [tile geometry bucket][pipeline]. Defined in
 // generated/GPU3D_Vulkan_ShaderModules.cpp; identical modules are shared, so
-// two entries may point at the same words.
-extern const ShaderModule Modules[TileGeometryBucketCount][Pipeline_Count];
+// two entries may point at the same module.
+extern const ShaderModule* const Modules[TileGeometryBucketCount][Pipeline_Count];
 extern const char* const PipelineNames[Pipeline_Count];
 """)
 
@@ -243,14 +289,14 @@ extern const char* const PipelineNames[Pipeline_Count];
     return "\n".join(out) + "\n"
 
 
-def build_blobs_header(blobs: list[list[int]]) -> str:
-    """Internal header: declares every SPIR-V blob and its word count."""
+def build_blobs_header(module_count: int) -> str:
+    """Internal header: declares every compressed module."""
     out: list[str] = [LICENSE_HEADER, GENERATED_BANNER.lstrip("\n")]
     out.append("""
 #ifndef GPU3D_VULKAN_SHADERBLOBS_H
 #define GPU3D_VULKAN_SHADERBLOBS_H
 
-#include <cstdint>
+#include "GPU3D_Vulkan_ShaderModules.h"
 
 // Internal to the generated shader module set. Consumers should include
 // GPU3D_Vulkan_ShaderModules.h instead.
@@ -262,9 +308,8 @@ namespace VulkanShaders
 namespace detail
 {
 """.lstrip("\n"))
-    for index, words in enumerate(blobs):
-        out.append(f"extern const uint32_t Blob{index:03d}[{len(words)}];")
-        out.append(f"inline constexpr uint32_t Blob{index:03d}_Words = {len(words)}u;")
+    for index in range(module_count):
+        out.append(f"extern const ShaderModule Blob{index:03d};")
     out.append("""
 } // namespace detail
 } // namespace VulkanShaders
@@ -274,26 +319,25 @@ namespace detail
     return "\n".join(out) + "\n"
 
 
-def build_blob_source(stem: str, entries: list[tuple[int, list[int]]]) -> str:
-    """One translation unit per .comp stem holding that stage's SPIR-V words."""
+def build_blob_source(stem: str, entries: list[tuple[int, int, bytes]]) -> str:
+    """One translation unit per .comp stem holding that stage's modules."""
     out: list[str] = [LICENSE_HEADER, GENERATED_BANNER.lstrip("\n")]
-    out.append(f'// SPIR-V for src/GPU3D_Vulkan_shaders/{stem}.comp.\n')
+    out.append(f'// SPIR-V for src/GPU3D_Vulkan_shaders/{stem}.comp, one zstd frame per module.\n')
     out.append('#include "GPU3D_Vulkan_ShaderBlobs.h"\n')
     out.append("namespace melonDS\n{\nnamespace VulkanShaders\n{\nnamespace detail\n{\n")
-    for index, words in entries:
-        out.append(format_blob(f"Blob{index:03d}", words))
+    for index, words, data in entries:
+        out.append(format_blob(index, words, data))
         out.append("")
     out.append("} // namespace detail\n} // namespace VulkanShaders\n} // namespace melonDS")
     return "\n".join(out) + "\n"
 
 
-def build_table_source(pipeline_names: list[str], blobs: list[list[int]],
-                       table: list[list[int]]) -> str:
+def build_table_source(pipeline_names: list[str], table: list[list[int]]) -> str:
     out: list[str] = [LICENSE_HEADER, GENERATED_BANNER.lstrip("\n")]
     out.append('#include "GPU3D_Vulkan_ShaderModules.h"')
     out.append('#include "GPU3D_Vulkan_ShaderBlobs.h"\n')
     out.append("namespace melonDS\n{\nnamespace VulkanShaders\n{\n")
-    out.append("const ShaderModule Modules[TileGeometryBucketCount][Pipeline_Count] =\n{")
+    out.append("const ShaderModule* const Modules[TileGeometryBucketCount][Pipeline_Count] =\n{")
     for bucket in range(vss.BUCKET_COUNT):
         geo = vss.tile_geometry(bucket)
         out.append(f"    // bucket {bucket}: TileSize {geo['TileSize']}, "
@@ -303,8 +347,7 @@ def build_table_source(pipeline_names: list[str], blobs: list[list[int]],
         out.append("    {")
         for pipeline in range(len(pipeline_names)):
             blob = table[bucket][pipeline]
-            out.append(f"        {{ detail::Blob{blob:03d}, detail::Blob{blob:03d}_Words }},"
-                       f" // {pipeline_names[pipeline]}")
+            out.append(f"        &detail::Blob{blob:03d}, // {pipeline_names[pipeline]}")
         out.append("    },")
     out.append("};\n")
 
@@ -376,7 +419,57 @@ def expected_variant_metadata() -> list[dict[str, object]]:
     return result
 
 
-def verify_committed_source_sync(expected_source_hash: str) -> int:
+DATA_PATTERN = re.compile(
+    r"const uint8_t Blob(\d{3})_Data\[(\d+)\] =\s*\{(.*?)\};", re.DOTALL)
+RECORD_PATTERN = re.compile(
+    r"const ShaderModule Blob(\d{3}) = \{ Blob\d{3}_Data, (\d+)u, (\d+)u, (\d+)u \};")
+# The layout before the modules were compressed, read by --repack.
+WORDS_PATTERN = re.compile(
+    r"const uint32_t Blob(\d{3})\[(\d+)\] = \{(.*?)\};", re.DOTALL)
+BYTE_PATTERN = re.compile(r"0x[0-9a-fA-F]{2}\b")
+WORD_PATTERN = re.compile(r"0x[0-9a-fA-F]{8}")
+
+
+def read_committed_modules(failures: list[str]) -> dict[int, dict[str, object]]:
+    """Every module in the committed blob sources, by blob index.
+
+    Compressed modules come back as {"data", "wordCount"}, modules in the old
+    uncompressed layout as {"words", "wordCount"}.
+    """
+    modules: dict[int, dict[str, object]] = {}
+    for path in sorted(glob.glob(os.path.join(
+            vss.GENERATED_DIR, "GPU3D_Vulkan_ShaderBlobs_*.cpp"))):
+        with open(path, "r", encoding="utf-8", newline="") as handle:
+            source = handle.read()
+
+        records = {int(m.group(1)): (int(m.group(2)), int(m.group(3)), int(m.group(4)))
+                   for m in RECORD_PATTERN.finditer(source)}
+        found: list[tuple[int, dict[str, object]]] = []
+        for match in DATA_PATTERN.finditer(source):
+            blob = int(match.group(1))
+            data = bytes(int(token, 16) for token in BYTE_PATTERN.findall(match.group(3)))
+            record = records.get(blob)
+            if len(data) != int(match.group(2)) or record is None \
+                    or record[0] != len(data) or record[2] != blob:
+                failures.append(f"blob {blob} has an inconsistent module record")
+                continue
+            found.append((blob, {"data": data, "wordCount": record[1]}))
+        for match in WORDS_PATTERN.finditer(source):
+            blob = int(match.group(1))
+            words = [int(token, 16) for token in WORD_PATTERN.findall(match.group(3))]
+            if len(words) != int(match.group(2)):
+                failures.append(
+                    f"blob {blob} declares {match.group(2)} words but contains {len(words)}")
+            found.append((blob, {"words": words, "wordCount": len(words)}))
+
+        for blob, module in found:
+            if blob in modules:
+                failures.append(f"blob {blob} is defined more than once")
+            modules[blob] = module
+    return modules
+
+
+def verify_committed_source_sync(expected_source_hash: str, zstd: str | None) -> int:
     """Verify generated-source freshness without depending on glslang output."""
     manifest_path = os.path.join(vss.GENERATED_DIR, MANIFEST_NAME)
     failures: list[str] = []
@@ -396,6 +489,7 @@ def verify_committed_source_sync(expected_source_hash: str) -> int:
         "generator": "tools/vulkan/compile-shaders.py",
         "targetEnv": "vulkan1.1",
         "entryPoint": "main",
+        "compression": "zstd",
         "pipelineCount": len(vss.pipelines()),
         "bucketCount": vss.BUCKET_COUNT,
         "bucketRepresentativeScale": vss.BUCKET_REPRESENTATIVE_SCALE,
@@ -445,37 +539,21 @@ def verify_committed_source_sync(expected_source_hash: str) -> int:
         failures.append("manifest generatedFiles does not match the committed file set")
 
     expected_blob_hashes: dict[int, str] = {}
+    expected_data_hashes: dict[int, str] = {}
     for variant in variants:
         blob = variant.get("blob")
         digest = variant.get("sha256")
+        data_digest = variant.get("compressedSha256")
         if not isinstance(blob, int) or not isinstance(digest, str):
             failures.append("manifest contains an invalid blob reference")
             continue
         previous = expected_blob_hashes.setdefault(blob, digest)
         if previous != digest:
             failures.append(f"manifest assigns conflicting hashes to blob {blob}")
+        if isinstance(data_digest, str):
+            expected_data_hashes.setdefault(blob, data_digest)
 
-    blob_pattern = re.compile(
-        r"const uint32_t Blob(\d{3})\[(\d+)\] = \{(.*?)\};",
-        re.DOTALL,
-    )
-    word_pattern = re.compile(r"0x[0-9a-fA-F]{8}")
-    committed_blobs: dict[int, list[int]] = {}
-    for path in glob.glob(os.path.join(
-            vss.GENERATED_DIR, "GPU3D_Vulkan_ShaderBlobs_*.cpp")):
-        with open(path, "r", encoding="utf-8", newline="") as handle:
-            source = handle.read()
-        for match in blob_pattern.finditer(source):
-            blob = int(match.group(1))
-            declared_words = int(match.group(2))
-            words = [int(token, 16) for token in word_pattern.findall(match.group(3))]
-            if len(words) != declared_words:
-                failures.append(
-                    f"blob {blob} declares {declared_words} words but contains {len(words)}"
-                )
-            if blob in committed_blobs:
-                failures.append(f"blob {blob} is defined more than once")
-            committed_blobs[blob] = words
+    committed_blobs = read_committed_modules(failures)
 
     unique_modules = manifest.get("uniqueModules")
     if not isinstance(unique_modules, int):
@@ -488,17 +566,31 @@ def verify_committed_source_sync(expected_source_hash: str) -> int:
         failures.append("manifest variants do not reference every committed blob")
 
     total_bytes = 0
-    for blob, words in committed_blobs.items():
-        total_bytes += len(words) * 4
+    total_compressed = 0
+    for blob, module in sorted(committed_blobs.items()):
+        total_bytes += int(module["wordCount"]) * 4
+        data = module.get("data")
+        if not isinstance(data, bytes):
+            failures.append(f"blob {blob} is not compressed")
+            continue
+        total_compressed += len(data)
+        if expected_data_hashes.get(blob) != hashlib.sha256(data).hexdigest():
+            failures.append(f"blob {blob} does not match its manifest compressed SHA-256")
+        if not zstd:
+            continue
+        words = inflate_spirv(zstd, data)
+        if words is None or len(words) != module["wordCount"]:
+            failures.append(f"blob {blob} does not inflate to its recorded size")
+            continue
         if not words or words[0] != 0x07230203:
             failures.append(f"blob {blob} has an invalid SPIR-V magic number")
             continue
-        packed = struct.pack(f"<{len(words)}I", *words)
-        actual_digest = hashlib.sha256(packed).hexdigest()
-        if expected_blob_hashes.get(blob) != actual_digest:
+        if expected_blob_hashes.get(blob) != hashlib.sha256(pack_words(words)).hexdigest():
             failures.append(f"blob {blob} does not match its manifest SHA-256")
     if manifest.get("totalSpirvBytes") != total_bytes:
         failures.append("manifest totalSpirvBytes does not match committed blobs")
+    if manifest.get("totalCompressedBytes") != total_compressed:
+        failures.append("manifest totalCompressedBytes does not match committed blobs")
 
     if failures:
         print("FAIL: committed Vulkan shader output is not source-synchronized:")
@@ -508,7 +600,129 @@ def verify_committed_source_sync(expected_source_hash: str) -> int:
         return 1
 
     print(f"PASS: source fingerprint {expected_source_hash}")
-    print(f"PASS: {len(committed_blobs)} committed SPIR-V modules match manifest hashes")
+    print(f"PASS: {len(committed_blobs)} committed SPIR-V modules match manifest hashes"
+          + ("" if zstd else " (compressed frames only, zstd was not found)"))
+    return 0
+
+
+def write_outputs(zstd: str, pipeline_names: list[str], blobs: list[list[int] | None],
+                  blob_stem: list[str], table: list[list[int]],
+                  manifest_entries: list[dict[str, object]], source_hash: str,
+                  check_only: bool) -> tuple[dict[str, str], list[str]]:
+    """Compresses the modules and writes (or, with check_only, compares) every
+    generated file. Modules given as None have no words to emit; their blob
+    source is left out. Returns the outputs and the names that differed."""
+    compressed: list[bytes | None] = []
+    with tempfile.TemporaryDirectory(prefix="melonprime-vk-zst-") as tmpdir:
+        for words in blobs:
+            compressed.append(compress_spirv(zstd, words, tmpdir) if words is not None else None)
+
+    word_counts: dict[int, int] = {}
+    for entry in manifest_entries:
+        blob = int(entry["blob"])
+        word_counts[blob] = int(entry["words"])
+        data = compressed[blob]
+        entry.pop("compressedBytes", None)
+        entry.pop("compressedSha256", None)
+        if data is not None:
+            entry["compressedBytes"] = len(data)
+            entry["compressedSha256"] = hashlib.sha256(data).hexdigest()
+
+    outputs: dict[str, str] = {
+        HEADER_NAME: build_header(pipeline_names, len(blobs)),
+        BLOBS_HEADER_NAME: build_blobs_header(len(blobs)),
+        TABLE_SOURCE_NAME: build_table_source(pipeline_names, table),
+    }
+    generated_files = set(outputs)
+    for stem in sorted(set(blob_stem)):
+        name = f"GPU3D_Vulkan_ShaderBlobs_{stem}.cpp"
+        generated_files.add(name)
+        entries = [(index, len(words), compressed[index])
+                   for index, words in enumerate(blobs)
+                   if blob_stem[index] == stem and words is not None]
+        if entries:
+            outputs[name] = build_blob_source(stem, entries)
+
+    manifest = {
+        "generator": "tools/vulkan/compile-shaders.py",
+        "sourceSetSha256": source_hash,
+        "targetEnv": "vulkan1.1",
+        "entryPoint": "main",
+        "compression": "zstd",
+        "pipelineCount": len(pipeline_names),
+        "bucketCount": vss.BUCKET_COUNT,
+        "bucketRepresentativeScale": vss.BUCKET_REPRESENTATIVE_SCALE,
+        "specializationConstants": [
+            {"name": name, "id": cid} for name, cid in vss.SPEC_CONSTANTS
+        ],
+        "pushConstantBytes": vss.PUSH_CONSTANT_SIZE,
+        "set0Bindings": [{"name": n, "binding": b} for n, b in vss.SET0_BINDINGS],
+        "set1Bindings": [{"name": n, "binding": b} for n, b in vss.SET1_BINDINGS],
+        "uniqueModules": len(blobs),
+        "totalSpirvBytes": sum(word_counts.values()) * 4,
+        "totalCompressedBytes": sum(len(data) for data in compressed if data is not None),
+        "generatedFiles": sorted(generated_files) + [MANIFEST_NAME],
+        "variants": manifest_entries,
+    }
+    outputs[MANIFEST_NAME] = json.dumps(manifest, indent=2, sort_keys=False) + "\n"
+
+    stale: list[str] = []
+    for name in sorted(outputs):
+        path = os.path.join(vss.GENERATED_DIR, name)
+        if not write_if_changed(path, outputs[name], check_only):
+            stale.append(name)
+    return outputs, stale
+
+
+def repack(zstd: str, source_hash: str) -> int:
+    """Rewrites the committed output from the committed SPIR-V."""
+    manifest_path = os.path.join(vss.GENERATED_DIR, MANIFEST_NAME)
+    with open(manifest_path, "r", encoding="utf-8") as handle:
+        manifest = json.load(handle)
+
+    failures: list[str] = []
+    committed = read_committed_modules(failures)
+    if failures:
+        for failure in failures:
+            print(f"FAIL: {failure}")
+        return 1
+
+    pipeline_names = [name for name, _, _ in vss.pipelines()]
+    unique_modules = int(manifest["uniqueModules"])
+    blobs: list[list[int] | None] = [None] * unique_modules
+    blob_stem = [""] * unique_modules
+    table = [[0] * len(pipeline_names) for _ in range(vss.BUCKET_COUNT)]
+    entries: list[dict[str, object]] = manifest["variants"]
+
+    for entry in entries:
+        blob = int(entry["blob"])
+        table[int(entry["bucket"])][int(entry["pipeline"])] = blob
+        blob_stem[blob] = os.path.splitext(os.path.basename(str(entry["source"])))[0]
+        if blobs[blob] is not None or blob not in committed:
+            continue
+        module = committed[blob]
+        words = module.get("words")
+        if words is None:
+            words = inflate_spirv(zstd, module["data"])
+        if not words or hashlib.sha256(pack_words(words)).hexdigest() != entry["sha256"]:
+            print(f"FAIL: committed blob {blob} does not match its manifest SHA-256")
+            return 1
+        blobs[blob] = words
+
+    # Only the layout changes here, so the output is as fresh as the current
+    # sources are.
+    _, stale = write_outputs(zstd, pipeline_names, blobs, blob_stem, table, entries,
+                             source_hash, False)
+    for name in stale:
+        print(f"  updated   src/GPU3D_Vulkan_shaders/generated/{name}")
+
+    missing = [index for index, words in enumerate(blobs) if words is None]
+    if missing:
+        print(f"\nFAIL: {len(missing)} of {unique_modules} modules aren't committed "
+              f"(blobs {missing[0]}..{missing[-1]}); rerun the generator with glslang "
+              "to emit them")
+        return 1
+    print(f"repacked {unique_modules} modules")
     return 0
 
 
@@ -516,18 +730,29 @@ def main() -> int:
     parser = argparse.ArgumentParser(description=__doc__,
                                      formatter_class=argparse.RawDescriptionHelpFormatter)
     parser.add_argument("--glslang", default=None, help="path to glslangValidator")
+    parser.add_argument("--zstd", default=None, help="path to the zstd command line tool")
     check_group = parser.add_mutually_exclusive_group()
     check_group.add_argument("--check", action="store_true",
                              help="recompile and byte-compare committed output")
     check_group.add_argument(
         "--check-source-sync", action="store_true",
         help="verify source fingerprint and committed blob integrity without recompiling")
+    check_group.add_argument(
+        "--repack", action="store_true",
+        help="rewrite the committed output from the committed SPIR-V")
     parser.add_argument("--verbose", action="store_true")
     args = parser.parse_args()
 
     source_hash = source_set_sha256()
+    zstd = vss.find_tool("zstd", args.zstd)
     if args.check_source_sync:
-        return verify_committed_source_sync(source_hash)
+        return verify_committed_source_sync(source_hash, zstd)
+
+    if not zstd:
+        print("ERROR: zstd was not found. Install it, or pass --zstd PATH.")
+        return 1
+    if args.repack:
+        return repack(zstd, source_hash)
 
     glslang = vss.find_tool("glslangValidator", args.glslang)
     if not glslang:
@@ -565,8 +790,7 @@ def main() -> int:
                     continue
 
                 words = read_spirv(out_path)
-                digest = hashlib.sha256(
-                    struct.pack(f"<{len(words)}I", *words)).hexdigest()
+                digest = hashlib.sha256(pack_words(words)).hexdigest()
                 blob = blob_index_by_hash.get(digest)
                 if blob is None:
                     blob = len(blobs)
@@ -599,48 +823,16 @@ def main() -> int:
               f"shader variants failed to compile")
         return 1
 
-    outputs: dict[str, str] = {
-        HEADER_NAME: build_header(pipeline_names, blobs, table),
-        BLOBS_HEADER_NAME: build_blobs_header(blobs),
-        TABLE_SOURCE_NAME: build_table_source(pipeline_names, blobs, table),
-    }
-    for stem in sorted(set(blob_stem)):
-        entries = [(index, words) for index, words in enumerate(blobs)
-                   if blob_stem[index] == stem]
-        outputs[f"GPU3D_Vulkan_ShaderBlobs_{stem}.cpp"] = build_blob_source(stem, entries)
-
-    manifest = {
-        "generator": "tools/vulkan/compile-shaders.py",
-        "sourceSetSha256": source_hash,
-        "targetEnv": "vulkan1.1",
-        "entryPoint": "main",
-        "pipelineCount": len(pipeline_list),
-        "bucketCount": vss.BUCKET_COUNT,
-        "bucketRepresentativeScale": vss.BUCKET_REPRESENTATIVE_SCALE,
-        "specializationConstants": [
-            {"name": name, "id": cid} for name, cid in vss.SPEC_CONSTANTS
-        ],
-        "pushConstantBytes": vss.PUSH_CONSTANT_SIZE,
-        "set0Bindings": [{"name": n, "binding": b} for n, b in vss.SET0_BINDINGS],
-        "set1Bindings": [{"name": n, "binding": b} for n, b in vss.SET1_BINDINGS],
-        "uniqueModules": len(blobs),
-        "totalSpirvBytes": sum(len(words) for words in blobs) * 4,
-        "generatedFiles": sorted(outputs) + [MANIFEST_NAME],
-        "variants": manifest_entries,
-    }
-    outputs[MANIFEST_NAME] = json.dumps(manifest, indent=2, sort_keys=False) + "\n"
-
-    stale: list[str] = []
-    for name in sorted(outputs):
-        path = os.path.join(vss.GENERATED_DIR, name)
-        if not write_if_changed(path, outputs[name], args.check):
-            stale.append(name)
+    outputs, stale = write_outputs(zstd, pipeline_names, blobs, blob_stem, table,
+                                   manifest_entries, source_hash, args.check)
 
     total = vss.BUCKET_COUNT * len(pipeline_list)
+    manifest = json.loads(outputs[MANIFEST_NAME])
     print(f"compiled {total} variants "
           f"({len(pipeline_list)} pipelines x {vss.BUCKET_COUNT} tile geometry buckets)")
     print(f"unique SPIR-V modules: {len(blobs)}  "
-          f"({sum(len(w) for w in blobs) * 4} bytes)")
+          f"({manifest['totalSpirvBytes']} bytes, "
+          f"{manifest['totalCompressedBytes']} compressed)")
 
     if args.check:
         if stale: